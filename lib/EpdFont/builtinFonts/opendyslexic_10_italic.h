@@ -2,2859 +2,1748 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_italic
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_italicBitmaps[45536] = {
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xD0, 0x00, 0x0F,
-    0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x0F, 0xD0, 0xFC, 0x3F, 0x83,
-    0xF0, 0xBE, 0x0F, 0xC1, 0xF8, 0x2F, 0x83, 0xF0, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0x40, 0x38,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0xB8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x38, 0x00, 0x00, 0x00, 0x70, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0xF5, 0x80, 0x00, 0xFE, 0xC3, 0x40, 0x00, 0x07,
-    0xDB, 0x0C, 0x00, 0x00, 0x2F, 0x28, 0x70, 0x00, 0x00, 0xBF, 0xE2, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xB7, 0xFF, 0xD0, 0x00, 0x03, 0x8B, 0xFF, 0xC0,
-    0x00, 0x0D, 0x3B, 0xFF, 0x40, 0x00, 0x70, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x07, 0x0D, 0x00,
-    0x00, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x2F, 0x80, 0x03, 0x40, 0x38, 0x34, 0x03, 0x80, 0x18, 0x06, 0x02, 0xC0,
-    0x0D, 0x02, 0x82, 0xC0, 0x03, 0x41, 0xC1, 0xC0, 0x00, 0xFF, 0xE1, 0xD0, 0x00, 0x0F, 0xD1, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xF4, 0x30, 0x00, 0x00, 0xF4, 0x0D, 0x00, 0x00, 0xBC,
-    0x03, 0x00, 0x00, 0xBB, 0x02, 0xC0, 0x00, 0xB4, 0xFF, 0xC0, 0x00, 0x78, 0x1F, 0x80, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x03, 0xFA, 0xBC,
-    0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0F, 0x8B,
-    0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFE,
-    0x1F, 0x00, 0x60, 0xBE, 0x01, 0xF0, 0x7C, 0x3F, 0x00, 0x2E, 0x7E, 0x0F, 0xC0, 0x02, 0xFF, 0x03,
-    0xF8, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x30, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x2F, 0x81, 0xF8, 0x0F, 0xC0, 0xFC, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03,
-    0xC0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x70, 0x00, 0x42, 0xC1, 0x8B, 0xCD, 0x7C, 0x07, 0xFE, 0x00, 0x07, 0xF0, 0x01, 0xFB, 0xBD, 0x2E,
-    0x38, 0x74, 0x10, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0x80, 0x6A, 0xBA, 0x9F, 0xFF, 0xFE, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x2C,
-    0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xD0, 0x05, 0x3E, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x02, 0xD0, 0xB0, 0x00, 0xB4, 0x03,
-    0x40, 0x1E, 0x00, 0x38, 0x03, 0xC0, 0x03, 0x80, 0x78, 0x34, 0x38, 0x0F, 0x4B, 0x47, 0x40, 0xF0,
-    0xF0, 0xB4, 0x1F, 0x0A, 0x0F, 0x02, 0xF0, 0x02, 0xE0, 0x2F, 0x00, 0x7D, 0x03, 0xF0, 0x1F, 0xC0,
-    0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x08, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0xBC, 0x00, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0x06, 0xA8, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x0B, 0x90, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0xE9, 0x6F, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xAB, 0xE0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0B, 0x80, 0x04, 0x01, 0xBD, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x1E, 0xE0,
-    0x01, 0xF7, 0x40, 0x1F, 0x2D, 0x01, 0xF0, 0xF0, 0x1F, 0x03, 0xC1, 0xF5, 0x6F, 0x5F, 0xFF, 0xFF,
-    0xAA, 0xAF, 0xF9, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x15,
-    0x55, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x01, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0x00, 0x2E, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x0D, 0x06, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x65, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFE,
-    0x07, 0xD0, 0x1F, 0x80, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x2D, 0x00, 0x2D, 0x03, 0xD0, 0x03, 0xC0,
-    0x2E, 0x00, 0xF8, 0x01, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xC1, 0x5A, 0xAF, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3D,
-    0x07, 0x40, 0x03, 0xC0, 0x0F, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x74, 0x00, 0xE0, 0x02, 0xD0, 0x0F,
-    0x40, 0x07, 0xC1, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x6F, 0xFD, 0x00, 0x0B, 0xD0, 0x7D, 0x00,
-    0xBC, 0x00, 0xB8, 0x03, 0xD0, 0x02, 0xE0, 0x1F, 0x00, 0x1F, 0x40, 0x7E, 0x02, 0xFC, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xE6, 0xF0, 0x00, 0xF0, 0x0B,
-    0x80, 0x3C, 0x00, 0xB8, 0x03, 0x80, 0x0B, 0x80, 0xB4, 0x00, 0xB8, 0x0B, 0x00, 0x0F, 0x80, 0xB4,
-    0x01, 0xF4, 0x0B, 0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xB8, 0x02, 0xFA, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x29,
-    0x00, 0x7D, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x0F, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x2A, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x0F, 0xC0,
-    0x1F, 0x80, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x5A, 0xA8, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x86, 0xAA, 0x54, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1B, 0xFF, 0xD0, 0x1B, 0xFF,
-    0xE4, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x90, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x34, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x78, 0xBE, 0x40, 0x0C, 0x00, 0x0F, 0x28, 0x34,
-    0x01, 0xC0, 0x02, 0xD6, 0x03, 0x00, 0x28, 0x00, 0x3C, 0x80, 0x70, 0x03, 0x40, 0x0B, 0xCC, 0x1F,
-    0x00, 0xB0, 0x00, 0xFC, 0xFF, 0xE0, 0x3C, 0x00, 0x0F, 0xC2, 0x95, 0xBF, 0x00, 0x00, 0xFD, 0x00,
-    0x06, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x16, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B,
-    0x83, 0xD0, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01,
-    0xF0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0x40, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B,
-    0xE0, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x3C, 0x00,
-    0x2D, 0x00, 0x7C, 0x00, 0x2D, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xE0, 0x01, 0xF8, 0x03, 0xD0, 0x00, 0x7C, 0x07, 0xC0, 0x00,
-    0xBC, 0x0B, 0x80, 0x00, 0xF8, 0x0F, 0x40, 0x02, 0xF8, 0x0F, 0x95, 0x6F, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0x00, 0x1F, 0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0x00, 0x1F, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0x80,
-    0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0x80,
-    0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x7F,
-    0xC0, 0x3F, 0x56, 0xAF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7E,
-    0xAA, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0x40, 0x01,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFA, 0x50,
-    0xFC, 0x00, 0x2F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0x91, 0xFC, 0x00, 0x01, 0xF0, 0x1F, 0xE0, 0x00,
-    0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1F,
-    0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x1F,
-    0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0,
-    0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0A, 0x50, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x3E,
-    0x0F, 0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0xF0,
-    0x00, 0x3E, 0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x55, 0x64, 0x7F,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xA0, 0x00, 0x02, 0xA0, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x07, 0xEF, 0xC0, 0x3F,
-    0xBC, 0x00, 0x2F, 0x7F, 0x03, 0xF7, 0xF0, 0x00, 0xF8, 0xFD, 0x1F, 0x9F, 0x80, 0x07, 0xD3, 0xF4,
-    0xFC, 0xBD, 0x00, 0x2F, 0x0F, 0xEF, 0xD3, 0xF0, 0x00, 0xFC, 0x3F, 0xFE, 0x1F, 0xC0, 0x07, 0xF0,
-    0xBF, 0xF0, 0xFF, 0x00, 0x2F, 0x81, 0xFF, 0x43, 0xF8, 0x00, 0xFD, 0x07, 0xFC, 0x1F, 0xD0, 0x07,
-    0xF0, 0x0F, 0xC0, 0xFF, 0x40, 0x2F, 0xC0, 0x29, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03,
-    0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E,
-    0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0,
-    0x00, 0x3F, 0x1F, 0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00,
-    0x03, 0xF0, 0x2F, 0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00,
-    0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03,
-    0xE0, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xF0, 0x02,
-    0xF0, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0,
-    0x1B, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xA9, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x07, 0xF0,
-    0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x0B, 0xC0,
-    0x00, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x08,
-    0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0, 0x0B, 0xE0,
-    0x07, 0xD0, 0x0F, 0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80,
-    0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0xAA, 0x40,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x14, 0x00, 0x7F,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0x00,
-    0x1F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x0A, 0x5F, 0x40, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x03,
-    0xF0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0xBE, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0xFD,
-    0x1F, 0xC0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x2F,
-    0x40, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x0F,
-    0x80, 0x2F, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0xFF, 0x80, 0x7E, 0x00, 0x3F, 0x02, 0xFF,
-    0xC0, 0xFC, 0x00, 0x3F, 0x07, 0xFF, 0xC1, 0xF8, 0x00, 0x3F, 0x0F, 0xDF, 0xD3, 0xF0, 0x00, 0x3F,
-    0x3F, 0x8B, 0xD7, 0xE0, 0x00, 0x3F, 0xBF, 0x0B, 0xEF, 0xC0, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x40, 0x00,
-    0xF4, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x00, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x0F, 0x83,
-    0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x7E, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC,
-    0x3F, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x55, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x10,
-    0x60, 0xA0, 0xE0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0x78, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x74, 0x60, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15, 0x54,
-    0x07, 0x40, 0x03, 0xF4, 0x02, 0xD7, 0x41, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0,
-    0x3C, 0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x01, 0xE4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x15, 0x00, 0x3E, 0xBF, 0xE0, 0x0F, 0xF9, 0x6E, 0x03, 0xF4, 0x03, 0xC1, 0xF4, 0x00, 0xF0,
-    0xBC, 0x00, 0x3C, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x0F, 0x43, 0xF0, 0x1F, 0xC1, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0,
-    0x0F, 0xFF, 0x40, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0xA0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xF4, 0xF0, 0x00, 0x7F, 0xFD,
-    0xE0, 0x01, 0xF4, 0x2F, 0xD0, 0x03, 0xC0, 0x0F, 0xC0, 0x0F, 0x00, 0x0F, 0x80, 0x1E, 0x00, 0x1F,
-    0x40, 0x2D, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x3F, 0x96, 0xFE, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x07, 0xFF, 0x00, 0x0B, 0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF,
-    0xE1, 0xFE, 0xA9, 0x50, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xE0, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x01, 0x90, 0x01, 0xFE, 0x00, 0x3C, 0x00,
-    0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x0F, 0xFF, 0x81, 0xFF, 0xF4, 0x03, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0xFF, 0xFB, 0xC0, 0x0F, 0x82, 0xFE, 0x00, 0xB4,
-    0x03, 0xF4, 0x03, 0xC0, 0x0F, 0xC0, 0x1D, 0x00, 0x3F, 0x00, 0xB0, 0x01, 0xF4, 0x02, 0xC0, 0x0F,
-    0xC0, 0x0B, 0x55, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0x9F, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x40, 0x2F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0xFE, 0x47, 0xC0, 0x0F, 0x80, 0x2C, 0x02, 0xF0, 0x02, 0xC0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x03,
-    0x80, 0xBC, 0x00, 0x78, 0x0F, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0xF0, 0x2F, 0x00, 0x2F, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02,
-    0xD0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0xF1,
-    0xF0, 0x01, 0xE7, 0xC0, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xBF, 0x00,
-    0x0F, 0x6F, 0xC0, 0x1F, 0x0F, 0xE0, 0x2F, 0x07, 0xF4, 0x3E, 0x03, 0xFC, 0x00, 0x2C, 0x00, 0x3C,
-    0x00, 0xB8, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x00,
-    0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x40, 0xBF, 0xC0, 0xFF, 0xC0, 0x00, 0x18,
-    0x7F, 0x40, 0xBE, 0x00, 0x03, 0xFF, 0xFD, 0x7F, 0xF4, 0x00, 0x7F, 0x43, 0xFF, 0x47, 0x80, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x38, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0x80, 0x2F, 0x00, 0x2E, 0x00, 0xB4, 0x03,
-    0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF0, 0x0B, 0xC0, 0x0F, 0x40, 0x2E, 0x00,
-    0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x2F, 0x00, 0x3E, 0x00, 0x7D, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C, 0x02, 0xF0,
-    0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0, 0x1F, 0x00,
-    0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF,
-    0xE0, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x07, 0x41, 0xE0, 0x00, 0xB4, 0x2D,
-    0x00, 0x0F, 0x02, 0xD0, 0x01, 0xE0, 0x2F, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x05, 0x0B, 0xE0, 0x00, 0x03, 0xDF, 0xFF, 0x00, 0x00, 0xFF, 0x41,
-    0xD0, 0x00, 0x3F, 0x00, 0x38, 0x00, 0x1F, 0x40, 0x0E, 0x00, 0x0B, 0xC0, 0x03, 0x80, 0x03, 0xF0,
-    0x01, 0xD0, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x7F, 0x40, 0xB8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F,
-    0xBF, 0xFD, 0x00, 0x0F, 0x8F, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0x80, 0x0B, 0xFF, 0xAE, 0x00, 0xB8, 0x07, 0xF4,
-    0x07, 0xC0, 0x0F, 0xC0, 0x3C, 0x00, 0x7E, 0x01, 0xE0, 0x02, 0xF0, 0x0B, 0x00, 0x0F, 0xC0, 0x2C,
-    0x00, 0xBD, 0x00, 0xB4, 0x0B, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xEE, 0x00, 0x02, 0xFD,
-    0xB0, 0x00, 0x00, 0x03, 0xC1, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x01, 0xEB, 0xF0, 0x0B, 0xFF, 0xC0, 0x3F, 0x80,
-    0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01,
-    0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x40, 0x05, 0xF5, 0x43, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0,
-    0x00, 0xF4, 0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xFE, 0x40, 0x7F, 0xF8, 0x07,
-    0xFF, 0x40, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00, 0x3C, 0x0F,
-    0x00, 0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE3, 0xD0, 0x14, 0x00, 0x01, 0x43, 0xC0, 0x00, 0x78,
-    0x2D, 0x00, 0x0F, 0x01, 0xE0, 0x03, 0xD0, 0x1F, 0x00, 0xB8, 0x00, 0xF0, 0x1F, 0x00, 0x0F, 0x43,
-    0xC0, 0x00, 0xBC, 0xF4, 0x00, 0x0B, 0xEE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x05, 0x0F, 0x40, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x03, 0xD0,
-    0xF4, 0x00, 0x02, 0xE0, 0x3D, 0x0B, 0x80, 0xF0, 0x0F, 0x4B, 0xF0, 0xB8, 0x03, 0xDB, 0xFE, 0x3C,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x0B,
-    0xC3, 0xD0, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x0B, 0xE0,
-    0x2F, 0x40, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C,
-    0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F,
-    0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x06, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1C,
-    0x00, 0x2C, 0x00, 0x38, 0x00, 0x34, 0x00, 0x70, 0x00, 0xA0, 0x00, 0xD0, 0x01, 0xC0, 0x02, 0xC0,
-    0x03, 0x80, 0x03, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x34, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xF4, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0x0E, 0x60,
-    0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF4,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x07, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40,
-    0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x74, 0x00,
-    0xB0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00,
-    0x2F, 0xF4, 0x03, 0xFF, 0xD0, 0x3E, 0x70, 0x02, 0xF2, 0xC0, 0x0F, 0x0E, 0x00, 0x7C, 0x34, 0x02,
-    0xE1, 0xC0, 0x0F, 0x8E, 0x00, 0x3F, 0x34, 0x00, 0xBF, 0xE8, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xE0,
-    0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0x07, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x52, 0xD0, 0x2F, 0xFF, 0xF4, 0x03, 0xD0, 0xF0, 0x03, 0xC0, 0x2C, 0x00, 0xF0,
-    0x0F, 0x00, 0x3D, 0x1F, 0x80, 0x2F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x0F, 0x05, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x03, 0xD0, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x00, 0xFC,
-    0x1F, 0x40, 0x00, 0xBD, 0x7D, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xA8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x66, 0xFE, 0x90, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x2C,
-    0x00, 0x38, 0x00, 0x34, 0x00, 0x70, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
-    0x03, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0xB9, 0x6C, 0x00, 0x01, 0xC0, 0x04, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xAF, 0xF0, 0x01, 0xF0, 0x00, 0xF4, 0x02, 0xC0,
-    0x00, 0x74, 0x03, 0xC0, 0x00, 0xF0, 0x02, 0xFE, 0x46, 0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0x01, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x2A, 0xE9, 0x00, 0x00, 0x0F, 0x02, 0xF2, 0xF0, 0x3E, 0x3F, 0x07, 0xE1, 0x50, 0x54,
-    0x01, 0xA9, 0x00, 0xF8, 0x10, 0x2D, 0x00, 0x82, 0x80, 0x08, 0x68, 0x01, 0x42, 0xF4, 0x60, 0x24,
-    0x28, 0x00, 0x69, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x0A, 0x1C, 0x0C, 0x1C, 0x24, 0x28, 0x34, 0x74,
-    0x2F, 0xF4, 0x0A, 0x40, 0x00, 0x04, 0x00, 0x10, 0x07, 0x80, 0x1C, 0x02, 0xE0, 0x0F, 0x41, 0xF0,
-    0x07, 0xC0, 0x7C, 0x02, 0xE0, 0x0B, 0xD0, 0x3F, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xF8, 0x0B, 0xD0,
-    0x07, 0x00, 0x2C, 0x00, 0x10, 0x00, 0x40, 0xBF, 0xA9, 0x4B, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x00, 0xAA,
-    0x00, 0x3D, 0x08, 0x0E, 0x14, 0x11, 0x6F, 0x01, 0x12, 0x20, 0x81, 0x93, 0x14, 0x0D, 0x1A, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xBE,
-    0x03, 0xD0, 0x2C, 0x1E, 0x00, 0xB0, 0xF4, 0x03, 0xC3, 0xD0, 0x2E, 0x0B, 0xD7, 0xF0, 0x1F, 0xFF,
-    0x40, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B,
-    0x00, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0xFF, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x06,
-    0xA0, 0x10, 0xD0, 0x03, 0x00, 0x28, 0x03, 0xC0, 0x78, 0x03, 0xFC, 0x05, 0x50, 0x02, 0xA0, 0x00,
-    0x08, 0x00, 0x18, 0x03, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x2A, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x38,
-    0x0B, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0x80, 0x0F,
-    0x40, 0x3D, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xF0, 0x0B, 0xC0, 0x0B, 0x80, 0x3F, 0x00, 0x3D, 0x01,
-    0xF8, 0x02, 0xF0, 0x0B, 0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xDF, 0xFF, 0xF8, 0x0E, 0x2F,
-    0xE3, 0xD0, 0x30, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x90, 0x03, 0xFC,
-    0x0D, 0x00, 0xFF, 0xC1, 0xC0, 0x1F, 0xF4, 0x2C, 0x02, 0xFF, 0x03, 0x80, 0x1F, 0xF0, 0x34, 0x00,
-    0xFD, 0x07, 0x00, 0x07, 0xC0, 0xB0, 0x00, 0xFC, 0x0E, 0x00, 0x1F, 0x40, 0xD0, 0x03, 0xF0, 0x1C,
-    0x00, 0x3F, 0x02, 0xC0, 0x0B, 0xD0, 0x38, 0x00, 0xFC, 0x03, 0x40, 0x2F, 0xC0, 0x70, 0x03, 0xF4,
-    0x0B, 0x00, 0xBF, 0x00, 0xE0, 0x00, 0x05, 0x07, 0xC3, 0xF1, 0xFC, 0x00, 0x00, 0x80, 0x29, 0x00,
-    0x18, 0x07, 0x4B, 0xD0, 0x00, 0x00, 0x2C, 0x01, 0xC0, 0x24, 0x03, 0x00, 0x30, 0x0A, 0x03, 0xFC,
-    0x15, 0x40, 0x02, 0xF4, 0x09, 0x0C, 0x1C, 0x0C, 0x24, 0x0C, 0x28, 0x28, 0x1F, 0xF0, 0x06, 0x40,
-    0x10, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0xB8, 0x02, 0xD0, 0x00,
-    0x7C, 0x02, 0xE0, 0x02, 0xF4, 0x0F, 0xC0, 0x1F, 0x80, 0xBC, 0x00, 0xFC, 0x07, 0xD0, 0x02, 0xC0,
-    0x0E, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2B,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x04, 0x00, 0xD0, 0x00, 0x0A, 0x00, 0x70, 0x00, 0x0B, 0x00,
-    0x2C, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x1F, 0xFD, 0x07, 0x40,
-    0x0F, 0xFF, 0x03, 0x40, 0x40, 0x00, 0x03, 0x80, 0x70, 0x00, 0x03, 0x80, 0x7C, 0x00, 0x03, 0xC0,
-    0x7B, 0x00, 0x03, 0xC0, 0x76, 0x80, 0x02, 0xC0, 0x74, 0xD0, 0x02, 0xD0, 0x3D, 0xB9, 0x02, 0xD0,
-    0x14, 0x3F, 0x41, 0xE0, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x07, 0x80, 0x01, 0xB0, 0x00, 0x00, 0x00,
-    0x3B, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x01, 0xC0, 0x00,
-    0x34, 0x00, 0x2C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x00, 0x74, 0x00, 0x70, 0x00, 0x7F,
-    0xF4, 0x1E, 0xBF, 0x0F, 0xFF, 0x03, 0x79, 0x2C, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x3C, 0x00,
-    0x2C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x74, 0x00, 0x7C, 0x00, 0x1E,
-    0x00, 0x3F, 0x00, 0x03, 0xC0, 0x0F, 0xC0, 0x00, 0xF0, 0x03, 0xFF, 0xE0, 0x3C, 0x00, 0x3F, 0xFD,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x28, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x70, 0x02, 0xFD, 0x00, 0x0D, 0x00, 0x01, 0xC0, 0x03, 0x40,
-    0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x10, 0x2C, 0x0B, 0x00, 0x03, 0xFF, 0x82,
-    0xC0, 0x10, 0x7F, 0xD0, 0x74, 0x07, 0x00, 0x00, 0x1D, 0x01, 0xF0, 0x00, 0x03, 0x80, 0x7B, 0x00,
-    0x00, 0xF0, 0x1D, 0xA0, 0x00, 0x3C, 0x07, 0x4D, 0x00, 0x0F, 0x00, 0xF6, 0xE4, 0x02, 0xD0, 0x15,
-    0x7F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x0A, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B,
-    0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xF4, 0x07,
-    0xC0, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x00, 0xF0, 0xF4, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0xF8,
-    0x00, 0x1F, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x0B, 0xFA, 0xAB, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x41, 0xF4, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x02, 0xF8, 0xFD, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00,
-    0x00, 0x00, 0x7C, 0xF0, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x01,
-    0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B,
-    0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x02, 0xFE, 0xAA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3C,
-    0xB4, 0x00, 0x00, 0x02, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00,
-    0x7C, 0xF0, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x02, 0xFE, 0xAA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x28, 0x00, 0x00, 0x0B, 0x30, 0xD0, 0x00, 0x00, 0x34, 0xA7, 0x00,
-    0x00, 0x01, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00,
-    0x07, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xD0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x0F,
-    0xD0, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA,
-    0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x01, 0xF3,
-    0xC0, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xD0,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x87, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x07, 0xE5, 0x68, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xEA, 0xA8, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0x00,
-    0x1F, 0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0xAA,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xE2, 0xD0, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0xBD,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0x95, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xEA,
-    0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xE2,
-    0xD0, 0x00, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x07, 0xD0, 0xBC, 0x00, 0xFC, 0x0F,
-    0xC0, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x00, 0x1F,
-    0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00,
-    0x7C, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xE0, 0x03, 0xF3, 0xFF, 0xFF, 0x40, 0x0F, 0xC0, 0x7D, 0x00,
-    0x00, 0xBE, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x56, 0xAF, 0xFD,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0C, 0x00, 0x00,
-    0x00, 0x35, 0xC7, 0x00, 0x00, 0x00, 0x2C, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xF8, 0x00, 0x0F,
-    0xF4, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0xFB,
-    0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x2F, 0x41, 0xF8, 0x00, 0x0F, 0xC7,
-    0xD0, 0xBD, 0x00, 0x07, 0xE0, 0xF8, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0x1F, 0x80, 0x00, 0xFC, 0x0B,
-    0xCB, 0xD0, 0x00, 0xBF, 0x02, 0xF7, 0xF0, 0x00, 0x3F, 0x80, 0x7F, 0xF8, 0x00, 0x0F, 0xD0, 0x0F,
-    0xFD, 0x00, 0x0B, 0xF0, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B,
-    0xC0, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80,
-    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xD0, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0x90, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80,
-    0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x28, 0x00, 0x00, 0x00, 0xE3, 0x5C, 0x00, 0x00, 0x00, 0x70, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x03,
-    0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xE9, 0x6B, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0,
-    0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x82, 0xD0, 0x2E, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x0F, 0xAF, 0x02, 0x90, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x5F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xCF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x8F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x40, 0x2F, 0x80, 0x00, 0xFD,
-    0x00, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x02,
-    0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x05,
-    0x50, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x1F, 0x40, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x80,
-    0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x1E, 0x00, 0x00, 0x00, 0x70, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x40, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00,
-    0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x07, 0xF0, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x03, 0xD0, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x15, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x40, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00,
-    0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x7D, 0x00,
-    0x7E, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-    0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x4F, 0x80, 0x00,
-    0xF8, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0xBD, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0xF0, 0x3F, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xF4, 0x3F,
-    0x00, 0x3C, 0x02, 0xE0, 0x1F, 0x00, 0x3C, 0x0B, 0x80, 0x0F, 0x03, 0xD0, 0x0B, 0x80, 0xF0, 0x1F,
-    0xC0, 0x7C, 0x6F, 0x80, 0x2F, 0xFF, 0x40, 0x0F, 0xE9, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xF4, 0x1C,
-    0x00, 0x0F, 0x00, 0x34, 0x00, 0x74, 0x00, 0x90, 0x03, 0xC0, 0x7E, 0x00, 0x0F, 0x03, 0x40, 0x00,
-    0x78, 0x28, 0x00, 0x02, 0xD0, 0xD0, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x7C, 0x07, 0xD0, 0x02, 0xE0,
-    0x07, 0xC0, 0x0F, 0x40, 0x0B, 0x40, 0x7C, 0x00, 0x2D, 0x02, 0xF3, 0x5B, 0xF0, 0x0F, 0xDF, 0xFF,
-    0x40, 0x3E, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80,
-    0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F,
-    0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C,
-    0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x1E, 0x38, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE2, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1F,
-    0x00, 0x74, 0x00, 0x78, 0x02, 0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x2F, 0x40, 0x3E, 0x07, 0xFC, 0x00,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFB, 0xC0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x02, 0xE0, 0x70, 0x00,
-    0x77, 0x0A, 0x00, 0x0E, 0x1D, 0xC0, 0x00, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x89,
-    0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x7C, 0x07, 0x40,
-    0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3E, 0x07, 0xD0, 0x02,
-    0xF8, 0x3F, 0x00, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE2, 0x40, 0x02, 0xFF,
-    0xFD, 0x00, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x74, 0x00, 0x78,
-    0x02, 0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x2F, 0x40, 0x3E, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFB, 0xC0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x05, 0x14, 0x00, 0x00,
-    0xC3, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90,
-    0x02, 0xFF, 0xFD, 0x00, 0xB8, 0x0B, 0xC0, 0x1E, 0x00, 0x3C, 0x03, 0xC0, 0x07, 0xC0, 0x74, 0x00,
-    0x78, 0x0B, 0x00, 0x0F, 0x80, 0xF0, 0x02, 0xF4, 0x0F, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xEF, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1B, 0xE2, 0x0F,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x1C, 0x00, 0x2E, 0x02, 0xFE, 0x00, 0x38, 0x01, 0xE0, 0x03,
-    0xE0, 0x16, 0xE0, 0x0F, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x74, 0x00, 0x7F, 0xAA, 0x54, 0x02, 0xC0,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3E, 0x07, 0xFF, 0x40, 0x04, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x01, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x5E, 0x6F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xFF, 0x40, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3C,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0xA0, 0x03,
-    0xFF, 0xE0, 0x06, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x06, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xB9, 0x0B,
-    0x00, 0xB4, 0x00, 0xD0, 0x78, 0x05, 0xB4, 0x3F, 0xFF, 0xFE, 0x1F, 0xEA, 0x95, 0x0B, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x10, 0x1F, 0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xB9, 0x0B, 0x00, 0x2D,
-    0x00, 0x34, 0x07, 0x80, 0x5B, 0x40, 0xFF, 0xFF, 0xF8, 0x1F, 0xEA, 0x95, 0x02, 0xD0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xB5, 0xE0,
-    0x00, 0x1C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xB9,
-    0x0B, 0x00, 0x2D, 0x00, 0x34, 0x07, 0x80, 0x5B, 0x40, 0xFF, 0xFF, 0xF8, 0x1F, 0xEA, 0x95, 0x02,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0x80, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x01, 0x40, 0x54, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x1F,
-    0x40, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xE4, 0x2C, 0x00, 0x2D, 0x00, 0x34, 0x01, 0xE0,
-    0x16, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xAA, 0x54, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x2F, 0x40, 0x04, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x6F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x02, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00,
-    0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x07, 0x00, 0x00,
-    0x38, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x38, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xE2, 0xC0, 0x0E, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x1F, 0x03, 0xE0, 0xFC, 0x1F, 0x87, 0xF0, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x40, 0x00, 0x2C, 0x00,
-    0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x16, 0x41, 0xC0, 0x00, 0x1F, 0xFE, 0x3C, 0x00, 0x07, 0xD0, 0xB7, 0x40, 0x00, 0xF0, 0x03, 0xF0,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x03, 0xD0,
-    0x1F, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x0C, 0x00, 0x00, 0xDA, 0x1C, 0x00, 0x01, 0xC3, 0x74, 0x00, 0x02, 0x81,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0xFE, 0x07, 0xC0, 0x00, 0xF4, 0x03, 0xC0, 0x02, 0xF0, 0x03, 0xC0, 0x03, 0xD0, 0x07,
-    0xC0, 0x03, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F,
-    0x00, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0x80,
-    0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00, 0x1E, 0x02, 0xF0, 0x0B,
-    0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x07,
-    0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00, 0x1E, 0x02, 0xF0,
-    0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xB1, 0xE0, 0x00, 0x1C, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0,
-    0x0B, 0x80, 0x07, 0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00,
-    0x1E, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x60, 0x00, 0xB3, 0x8D, 0x00, 0x0D, 0x0F, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00,
-    0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00,
-    0xF0, 0x2D, 0x00, 0x1E, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3E, 0x07, 0xD0, 0x02, 0xF8, 0x3F, 0x00, 0x05,
-    0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0xB8, 0x00, 0x78, 0x03, 0xC0, 0x01, 0xD0,
-    0x1E, 0x00, 0x0B, 0x40, 0xB4, 0x00, 0x3C, 0x02, 0xD0, 0x01, 0xE0, 0x0B, 0xC0, 0x2F, 0x40, 0x1F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x56, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01,
-    0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xE0, 0xFF, 0x40, 0x00, 0x02, 0xE0,
-    0xB1, 0xE0, 0x00, 0x00, 0xF0, 0x78, 0x78, 0x00, 0x00, 0x78, 0x3C, 0x2D, 0x00, 0x00, 0x2D, 0x1E,
-    0x0F, 0x00, 0x00, 0x0F, 0x4F, 0x07, 0x80, 0x00, 0x02, 0xFB, 0x8B, 0xD0, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x1F, 0x00,
-    0x2E, 0x07, 0x80, 0x0F, 0x42, 0xD0, 0x03, 0xC0, 0xF0, 0x01, 0xF0, 0x3C, 0x00, 0xB8, 0x1F, 0x00,
-    0x3D, 0x07, 0x80, 0x2F, 0x02, 0xFE, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x02, 0xFE,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x1F, 0x00, 0x2E, 0x07, 0x80, 0x0F, 0x42, 0xD0, 0x03, 0xC0,
-    0xF0, 0x01, 0xF0, 0x3C, 0x00, 0xB8, 0x1F, 0x00, 0x3D, 0x07, 0x80, 0x2F, 0x02, 0xFE, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x02, 0xFE, 0x3D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x02, 0xD7, 0x40, 0x01, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x7C, 0x00,
-    0xB8, 0x1E, 0x00, 0x3D, 0x0B, 0x40, 0x0F, 0x03, 0xC0, 0x07, 0xC0, 0xF0, 0x02, 0xE0, 0x7C, 0x00,
-    0xF4, 0x1E, 0x00, 0xBC, 0x0B, 0xFB, 0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x0B, 0xF8,
-    0xF4, 0x00, 0x00, 0x05, 0x01, 0x40, 0x03, 0xF0, 0x3D, 0x00, 0x3E, 0x0B, 0xD0, 0x0B, 0xE0, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x7C, 0x00, 0xB8, 0x07, 0x80,
-    0x0F, 0x40, 0xB4, 0x00, 0xF0, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x02, 0xE0, 0x1F, 0x00, 0x3D, 0x01,
-    0xE0, 0x0B, 0xC0, 0x2F, 0xEF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0x8F,
-    0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07,
-    0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x0F, 0xBE, 0x00, 0x07, 0x42, 0xE0, 0x02, 0xC0, 0x3C, 0x00,
-    0xF0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0xB0, 0x03, 0xC0, 0xB8, 0x00,
-    0xE0, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x01,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E,
-    0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00,
-    0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01,
-    0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x05, 0x5A, 0xA0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0x80, 0xBC, 0x00,
-    0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0xC0, 0x1D, 0x00, 0x1E, 0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0,
-    0x0B, 0xD0, 0x0F, 0x81, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0xF0, 0x00, 0x7F, 0x97,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x74,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D,
-    0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x24, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xE0, 0x2F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xF0,
-    0x07, 0x40, 0x07, 0x80, 0x2C, 0x00, 0x3E, 0x00, 0xF0, 0x02, 0xF4, 0x03, 0xE0, 0x7F, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xBC, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1F, 0x3C,
-    0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x03, 0xD0,
-    0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF,
-    0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0x40, 0x00, 0xBD, 0x0F,
-    0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C,
-    0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x02, 0xFE, 0x56, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x10,
-    0x01, 0xFF, 0xFA, 0xAF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xFA, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x74, 0xB0, 0x00, 0x00, 0x0D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02,
-    0xFE, 0x56, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x10, 0x01,
-    0xFF, 0xFA, 0xAF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x07, 0x5E, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xFE, 0xA0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x56, 0x80,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x10, 0x01, 0xFF, 0xFA, 0xAF,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0xFF,
-    0xF4, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xEA, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x06, 0x00, 0x00, 0x02, 0xD3, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x01, 0x00, 0x1F, 0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x02, 0x80, 0x02, 0xD7, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFA, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x01, 0xD7, 0x80,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x00, 0x1F, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xD0,
-    0x03, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x03,
-    0xF4, 0x0B, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x56, 0xAF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x00,
-    0x3C, 0x3C, 0x00, 0x00, 0x00, 0x74, 0x38, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x0B, 0xF4, 0xF0,
-    0x50, 0x00, 0x7F, 0xFD, 0xE0, 0x00, 0x01, 0xF4, 0x2F, 0xD0, 0x00, 0x03, 0xC0, 0x0F, 0xC0, 0x00,
-    0x0F, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x1F, 0x40, 0x00, 0x2D, 0x00, 0x2F, 0x00, 0x00, 0x3D,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x96, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x00, 0x1F, 0xF0,
-    0x00, 0xBC, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C,
-    0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xE0, 0x03, 0xF3, 0xFF, 0xFF, 0x40, 0x0F, 0xC0, 0x7D, 0x00, 0x00,
-    0xBE, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x56, 0xAF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0xBF, 0x4F, 0x00, 0x00, 0x1F, 0xFF, 0x78, 0x00, 0x01, 0xF4, 0x2F, 0xD0, 0x00, 0x0F, 0x00,
-    0x3F, 0x00, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x07, 0xD0, 0x00, 0x2D, 0x00, 0x2F, 0x00,
-    0x00, 0xF4, 0x01, 0xFC, 0x00, 0x03, 0xF9, 0x6F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xAA, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x01, 0xAA,
-    0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0xB9, 0x0B, 0x00, 0x0B, 0x40, 0x0D, 0x00, 0x78, 0x05, 0xB4, 0x03,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xEA, 0x95, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x01, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2C, 0x00, 0x00, 0x78, 0x07, 0x40, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0xEA, 0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xC0, 0x00, 0xF0, 0x0F, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2E, 0x42, 0xC0,
-    0x02, 0xD0, 0x03, 0x40, 0x1E, 0x01, 0x6D, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFA, 0xA5, 0x40, 0x2D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07,
-    0xFF, 0x00, 0x0B, 0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE,
-    0xA9, 0x50, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xE0, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x0B,
-    0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE, 0xA9, 0x50, 0xB4,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x01,
-    0xBF, 0x90, 0x00, 0x1D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x0F, 0x1D, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x07, 0x5E, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0x90, 0xB0, 0x02, 0xD0, 0x03, 0x40, 0x78,
-    0x05, 0xB4, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0xA9, 0x50, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x2F, 0x40, 0x04, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x2C, 0x00, 0x00, 0x00, 0xD0,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xE4, 0x00, 0x10, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x94, 0x0F, 0xC0, 0x02, 0xFF, 0xE0, 0x3F,
-    0x00, 0x00, 0x3E, 0x41, 0xFC, 0x00, 0x01, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xB1, 0xD0, 0x00, 0x02, 0xC0, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0x3F, 0xFE, 0xF0,
-    0x00, 0xF8, 0x2F, 0xE0, 0x02, 0xD0, 0x0F, 0xD0, 0x03, 0xC0, 0x0F, 0xC0, 0x07, 0x40, 0x0F, 0xC0,
-    0x0B, 0x00, 0x1F, 0x40, 0x0B, 0x00, 0x3F, 0x00, 0x0B, 0x55, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x7C, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x10, 0x0B, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0x40, 0x01,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F,
-    0xE9, 0x40, 0xFC, 0x00, 0x2F, 0xFE, 0x03, 0xF0, 0x00, 0x03, 0xE4, 0x1F, 0xC0, 0x00, 0x1F, 0x00,
-    0x7F, 0x80, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xA0,
-    0x00, 0x74, 0x0B, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0xFF, 0xFB, 0xC0, 0x0F, 0x82,
-    0xFE, 0x00, 0xB4, 0x03, 0xF4, 0x03, 0xC0, 0x0F, 0xC0, 0x1D, 0x00, 0x3F, 0x00, 0xB0, 0x01, 0xF4,
-    0x02, 0xC0, 0x0F, 0xC0, 0x0B, 0x55, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x2F, 0x9F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x40, 0x2F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFE, 0x40, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xFA, 0x50, 0xFC, 0x00, 0x2F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0x91, 0xFC, 0x00, 0x01, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x28, 0x00, 0x3F, 0xFE, 0xF0, 0x03, 0xE0, 0xBF, 0x80, 0x2D, 0x00, 0xFD,
-    0x00, 0xF0, 0x03, 0xF0, 0x07, 0x40, 0x0F, 0xC0, 0x2C, 0x00, 0x7D, 0x00, 0xB0, 0x03, 0xF0, 0x02,
-    0xD5, 0x7F, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0B, 0xE7, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFE, 0x40, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xFA, 0x50, 0xFC, 0x00, 0x2F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0x91, 0xFC, 0x00, 0x01, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0xA0, 0x00, 0xFF, 0xFB, 0xC0, 0x0F, 0x82, 0xFE, 0x00, 0xB4, 0x03, 0xF4, 0x03, 0xC0, 0x0F, 0xC0,
-    0x1D, 0x00, 0x3F, 0x00, 0xB0, 0x01, 0xF4, 0x02, 0xC0, 0x0F, 0xC0, 0x0B, 0x55, 0xFF, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0x9F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x40, 0x2F,
-    0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x74,
-    0x00, 0x00, 0x00, 0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00,
-    0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0x1D, 0x00,
-    0x02, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x9F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xE4, 0x7C, 0x00, 0xF8, 0x02, 0xC0, 0x2F, 0x00, 0x2C, 0x03, 0xD0, 0x03,
-    0xC0, 0x3C, 0x00, 0x38, 0x0B, 0xC0, 0x07, 0x80, 0xF8, 0x00, 0xF4, 0x0F, 0x40, 0x0F, 0x02, 0xF0,
-    0x02, 0xF0, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x28, 0x00, 0x0F, 0x40, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xF8,
-    0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x5A, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x6D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x47, 0xC0,
-    0x0F, 0x80, 0x2C, 0x02, 0xF0, 0x02, 0xC0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0x80, 0xBC, 0x00,
-    0x78, 0x0F, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0xF0, 0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x0F, 0x03, 0x40, 0x0E, 0x70, 0xC0, 0x03, 0x0D, 0xA0, 0x01, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xD0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x34, 0x0E, 0x71, 0xC0, 0x70, 0xBD, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x40, 0x00,
-    0x2C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0xAA, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x38, 0x00,
-    0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00,
-    0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x39, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0B,
-    0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0x80, 0x00, 0xD0, 0x00, 0x34, 0x00, 0x03, 0x50, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0,
-    0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x60, 0x02, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xC0,
-    0x0F, 0x00, 0x38, 0x02, 0xD0, 0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x1F, 0x80, 0x0F,
-    0x80, 0x07, 0xD0, 0x07, 0xD0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x7E, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xF8,
-    0x02, 0xF4, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x07,
-    0xE0, 0x0B, 0xC0, 0x02, 0xF8, 0x03, 0xE0, 0x00, 0xFD, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0xBC, 0x00,
-    0x2F, 0xC0, 0x3F, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xBF, 0xE0,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x14, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x15, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x01, 0xD0, 0x00, 0xD0, 0x00, 0x03, 0xC0,
-    0x02, 0xC0, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x07, 0x40, 0x03, 0x80, 0x00, 0x0B, 0x00, 0x0B,
-    0x40, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0x2C, 0x00, 0x2F, 0x00,
-    0x00, 0x3C, 0x00, 0x2E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0x2D, 0x00, 0x00, 0x02, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xE2, 0xC0, 0x00, 0x00, 0xE0, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x2F, 0x40, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x3E, 0x0F, 0xC0,
-    0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x3E,
-    0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x7C, 0x00,
-    0xF1, 0xF0, 0x01, 0xE7, 0xC0, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xBF,
-    0x00, 0x0F, 0x6F, 0xC0, 0x1F, 0x0F, 0xE0, 0x2F, 0x07, 0xF4, 0x3E, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x02, 0xC7, 0x80,
-    0x38, 0xE0, 0x07, 0x7C, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3E, 0xF0, 0x03, 0x8F,
-    0x80, 0x74, 0xFD, 0x0F, 0x07, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF1, 0x55, 0x91, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x70, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02,
-    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x06, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x55, 0x64, 0x7F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0,
-    0x02, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF1, 0x00, 0xBF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x50, 0x00, 0xF4, 0x03, 0xC0, 0x07, 0xC0, 0x1D, 0x00, 0x2F,
-    0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0F, 0x03, 0x80, 0x03,
-    0xC2, 0xD0, 0x02, 0xE0, 0xF0, 0x00, 0xF0, 0x14, 0x00, 0x7C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF1, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0xF4, 0x0B, 0xC0, 0x07, 0xC0, 0x3F, 0x00, 0x3F, 0x00,
-    0x54, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x55, 0x64, 0x07, 0xFF, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x28, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x3C, 0x00, 0x01, 0xF0, 0x14, 0x0B, 0x82, 0xF0, 0x3C, 0x0F, 0x81, 0xF0, 0xBE, 0x0B, 0x80, 0x00,
-    0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC4, 0x00,
-    0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x68, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCB, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xC5, 0x56, 0x40, 0x00,
-    0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xD2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xD0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x56, 0xE4, 0x00, 0x16, 0xBF, 0xA4,
-    0x00, 0x1F, 0xE9, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x3F,
-    0xF8, 0x01, 0xF4, 0x00, 0x0F, 0xBF, 0x00, 0xBC, 0x00, 0x07, 0xDF, 0xC0, 0x3F, 0x00, 0x03, 0xF2,
-    0xF4, 0x1F, 0x80, 0x00, 0xFC, 0x7D, 0x0B, 0xC0, 0x00, 0xBE, 0x0F, 0x83, 0xF0, 0x00, 0x3F, 0x43,
-    0xF1, 0xF8, 0x00, 0x0F, 0xC0, 0xBC, 0xBD, 0x00, 0x0B, 0xF0, 0x2F, 0x7F, 0x00, 0x03, 0xF8, 0x07,
-    0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x69, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xE0, 0x7C, 0x00, 0x3D, 0x00, 0xF0,
-    0x02, 0xF0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x0F,
-    0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xBC, 0x02, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x3F,
-    0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E, 0x00, 0x03, 0xEF,
-    0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0, 0x00, 0x3F, 0x1F,
-    0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0x2F,
-    0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0x40, 0x3F,
-    0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C,
-    0x02, 0xF0, 0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0,
-    0x1F, 0x00, 0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00,
-    0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x00, 0x0B, 0xC0, 0x00,
-    0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0xBC, 0x00, 0x07,
-    0xDF, 0xC0, 0x3F, 0x00, 0x03, 0xF2, 0xF4, 0x1F, 0x80, 0x00, 0xFC, 0x7D, 0x0B, 0xC0, 0x00, 0x7E,
-    0x0F, 0x83, 0xF0, 0x00, 0x3F, 0x43, 0xF1, 0xF8, 0x00, 0x0F, 0xC0, 0xBC, 0xBD, 0x00, 0x0B, 0xF0,
-    0x2F, 0x7F, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x07, 0x07,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F,
-    0xE0, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x02, 0xF0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x00,
-    0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x0F, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xBC, 0x02, 0xF4, 0x03, 0xF0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x6A, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0x43, 0xD0, 0x0B, 0xC0, 0x2D, 0x00, 0xF4, 0x02, 0xD0, 0x1F, 0x00, 0x3D, 0x02, 0xE0, 0x07, 0xC0,
-    0x3D, 0x00, 0xBC, 0x07, 0xC0, 0x0F, 0x80, 0xFC, 0x00, 0xF8, 0x0F, 0xC0, 0x1F, 0x41, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03,
-    0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E,
-    0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0,
-    0x00, 0x3F, 0x1F, 0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00,
-    0x03, 0xF0, 0x2F, 0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00,
-    0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFE, 0x40, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03,
-    0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F,
-    0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xA0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x2F,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xF0, 0x00, 0xBF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x02, 0xE0,
-    0x0F, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x74, 0x07, 0x80, 0x02, 0xD0, 0x2D, 0x00, 0x0F,
-    0x00, 0xB4, 0x00, 0x78, 0x02, 0xF0, 0x0B, 0xD0, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0xFE,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03, 0xE0, 0x00,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x02,
-    0xE0, 0x0F, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x74, 0x07, 0x80, 0x02, 0xD0, 0x2D, 0x00,
-    0x0F, 0x00, 0xB4, 0x00, 0x78, 0x02, 0xF0, 0x0B, 0xD0, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xC0,
-    0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x0B, 0x80, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xF9, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF4, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xFA,
-    0x5A, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x06, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x05, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x1E,
-    0x00, 0x0F, 0x00, 0x07, 0x40, 0x07, 0x80, 0x02, 0xD0, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0xB4, 0x00,
-    0x78, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x0B, 0xF9, 0x54, 0x00, 0x00,
-    0x3F, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xF9,
-    0x54, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xA8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x6F, 0xFE, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xBF,
-    0x80, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0x3E, 0x03, 0x80, 0x2E, 0x00, 0xFF, 0x00, 0x1C, 0x0B, 0x80,
-    0x07, 0xC0, 0x16, 0xC0, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x1E, 0x00, 0x0B, 0xFA, 0x95, 0x42, 0xD0,
-    0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0,
-    0x0B, 0xE0, 0x07, 0xD0, 0x0F, 0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x40, 0x1E, 0xBF, 0x00, 0xBF, 0xFC, 0x03, 0xF8, 0x00,
-    0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0E,
-    0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78,
-    0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0, 0x0B, 0xE0, 0x07, 0xD0, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x1E, 0xBF, 0x00, 0x2F, 0xFF, 0x00,
-    0x3F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-    0x00, 0xE0, 0x38, 0x00, 0x00, 0x3E, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x0E, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x78, 0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0, 0x0B, 0xE0, 0x07, 0xD0, 0x0F,
-    0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0xD0, 0x01,
-    0x00, 0x04, 0x01, 0xC0, 0x74, 0x00, 0xB7, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x14, 0x00, 0x7A, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xF4, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xEA, 0xA4, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF9,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x40, 0x07, 0xFF, 0x40, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE,
-    0xA8, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0,
-    0x00, 0x01, 0xF4, 0x05, 0x01, 0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0xE2, 0xC0, 0x00, 0x00, 0x0D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFA, 0xA9, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0x40,
-    0x07, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02,
-    0xF4, 0x00, 0x01, 0xE7, 0x80, 0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x90, 0x03, 0xFA, 0xA0, 0x02, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x50, 0x1F, 0x40, 0xBF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFE, 0xAA, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x14, 0x00, 0x7F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01, 0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F,
-    0xFE, 0x40, 0x00, 0x80, 0x00, 0x01, 0x90, 0x00, 0x00, 0x08, 0x00, 0x00, 0x28, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFE, 0xAA, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x14, 0x00, 0x7F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0xD0, 0x34, 0x00, 0x7A, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01,
-    0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x05, 0xF5, 0x43, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0xF4,
-    0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xFE, 0x40, 0x7F, 0xF8, 0x07, 0xFF, 0x40,
-    0x06, 0x40, 0x00, 0x02, 0x00, 0x00, 0x90, 0x01, 0xF8, 0x00, 0x00, 0x18, 0x01, 0x80, 0x00, 0x03,
-    0xC7, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x04, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x2C, 0x3C, 0x00, 0xB8, 0x78, 0x00,
-    0xF4, 0x00, 0x05, 0xF5, 0x40, 0x3F, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xE4, 0x00,
-    0x7F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00,
-    0x5F, 0x54, 0x03, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF0, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xFE, 0x40, 0x07, 0xFF, 0x80,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x41, 0x80, 0x00, 0x00, 0x73, 0x09, 0x00, 0x00, 0x03, 0x4A,
-    0x70, 0x00, 0x00, 0x0C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0xA9, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x03, 0xF4,
-    0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x02, 0xF4, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00,
-    0x3F, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x60, 0x02, 0xCD, 0x34, 0x00, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x07, 0xC0, 0x0B, 0x81, 0xE0, 0x03, 0xD0,
-    0xB4, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x41, 0xE0, 0x0B, 0xC0,
-    0xBF, 0xBF, 0xF0, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x15,
-    0x6A, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x0A, 0x90, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x3F,
-    0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x00, 0xBC, 0x00,
-    0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00,
-    0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x6A, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x7C, 0x07, 0xC0, 0x0B, 0x80, 0x78, 0x00, 0xF4, 0x0B, 0x40, 0x0F, 0x00, 0xF0,
-    0x01, 0xF0, 0x0F, 0x00, 0x2E, 0x01, 0xF0, 0x03, 0xD0, 0x1E, 0x00, 0xBC, 0x02, 0xFE, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x3F, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x2F, 0x40,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0xFC,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E,
-    0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x0C, 0x00, 0x3C, 0x07, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0,
-    0x7C, 0x00, 0xB8, 0x07, 0x80, 0x0F, 0x40, 0xB4, 0x00, 0xF0, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x02,
-    0xE0, 0x1F, 0x00, 0x3D, 0x01, 0xE0, 0x0B, 0xC0, 0x2F, 0xEF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xF8, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x06, 0x14, 0x00,
-    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xF4, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01,
-    0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00,
-    0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0,
-    0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x31, 0x40, 0x00, 0x24,
-    0x60, 0x00, 0x09, 0x70, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00, 0x3C, 0x0F, 0x00,
-    0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE3, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0xB8,
-    0x00, 0x7C, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x05, 0x40, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4,
-    0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0x1F, 0x40, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00,
-    0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x3D, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0x90, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x07, 0x80,
-    0x0F, 0x40, 0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x1F, 0x00,
-    0x3D, 0x00, 0x1E, 0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4, 0x02, 0xF8, 0x00, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F,
-    0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F,
-    0x80, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00,
-    0x3C, 0x0F, 0x00, 0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE7, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x07,
-    0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x2F, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0xFF, 0x80, 0x7E, 0x00, 0x3F, 0x02, 0xFF, 0xC0, 0xFC, 0x00,
-    0x3F, 0x07, 0xFF, 0xC1, 0xF8, 0x00, 0x3F, 0x0F, 0xDF, 0xD3, 0xF0, 0x00, 0x3F, 0x3F, 0x8B, 0xD7,
-    0xE0, 0x00, 0x3F, 0xBF, 0x0B, 0xEF, 0xC0, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x2C, 0x78, 0x00, 0x00, 0x1C, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x50, 0xF4, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x2E,
-    0x03, 0xD0, 0xB8, 0x0F, 0x00, 0xF4, 0xBF, 0x0B, 0x80, 0x3D, 0xBF, 0xE3, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0x5E, 0x00, 0x00, 0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x4F, 0x80, 0x00,
-    0xF8, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0xBD, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0xF0, 0x3F, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xD2, 0xC0, 0x00, 0x03, 0x40,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00,
-    0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F,
-    0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x7D, 0x00, 0x2F, 0x83, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x3E,
-    0x00, 0x03, 0xE0, 0xFC, 0x00, 0x2F, 0x02, 0xF0, 0x02, 0xF4, 0x07, 0xE0, 0x1F, 0x80, 0x0F, 0xC0,
-    0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0xFD, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xFA, 0xA4, 0x00, 0x7F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x01, 0xD2, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1C, 0x07, 0x40,
-    0x00, 0x2D, 0xB0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x7E, 0xD0, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF0,
-    0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC,
-    0x00, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x0B, 0x01, 0xD0, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF0, 0x00, 0xE2, 0xD0, 0x28, 0x02, 0x40, 0x1F, 0x03, 0x0E,
-    0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x97, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x82, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x1C, 0x3C, 0x07, 0x82, 0xFF, 0xE0, 0x0B, 0xE4, 0x00, 0x1F, 0x0F, 0xC7, 0xF1, 0x54, 0x0F, 0x02,
-    0xF2, 0xF0, 0x3E, 0x3F, 0x07, 0xE1, 0x50, 0x54, 0x2E, 0x80, 0x1C, 0x0B, 0x00, 0x80, 0x0A, 0x82,
-    0x49, 0x30, 0xC2, 0xF4, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xF0, 0x3E, 0x00, 0x1F, 0x03, 0xE0, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x34, 0x07, 0x07, 0x4E, 0x00, 0xBE, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0xBE, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x0B, 0xE0, 0x03, 0xF8, 0x1F, 0xC0, 0xBD,
-    0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xF4,
-    0x00, 0xF8, 0x01, 0x40, 0xC3, 0xF0, 0x28, 0x05, 0x00, 0x20, 0x0D, 0x02, 0xF8, 0x70, 0x08, 0x00,
-    0x3E, 0xA5, 0x4A, 0xBF, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x00, 0x09, 0x0C, 0x74,
-    0x90, 0x04, 0x24, 0x20, 0x34, 0x00, 0x08, 0x07, 0x47, 0xF4, 0x06, 0xA4, 0x1B, 0xD0, 0xC0, 0x20,
-    0x00, 0x02, 0x06, 0xE4, 0x20, 0x00, 0x00, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05,
-    0x0B, 0xC3, 0xF2, 0xF8, 0x01, 0x40, 0x50, 0x3E, 0x03, 0xD1, 0xF8, 0x2F, 0x0F, 0xD0, 0xFC, 0x0A,
-    0x82, 0x49, 0x30, 0xC2, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x18, 0x07, 0x4B, 0xD0, 0x00, 0x40, 0x70, 0x1C, 0x03,
-    0x40, 0x2F, 0x40, 0x10, 0x01, 0x02, 0xC0, 0xF0, 0x78, 0x2D, 0x0F, 0x00, 0x2F, 0xFC, 0x38, 0x2C,
-    0x70, 0x38, 0x00, 0x00, 0x70, 0x0A, 0x0B, 0x1E, 0x00, 0xFD, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x03, 0xF4, 0x02, 0xD7, 0x81, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x1F, 0x03, 0x0E, 0x60,
-    0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE1, 0x55, 0x40, 0x1F, 0x03, 0x0E, 0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x40, 0x81, 0x4C, 0x00, 0xA0, 0x31, 0xC0,
-    0xD3, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x30, 0x0C, 0x30, 0x18, 0x60, 0x24, 0xBF, 0xF0, 0x0E, 0xA4,
-    0x24, 0x88, 0x31, 0x4C, 0x11, 0x04, 0x00, 0x00, 0x98, 0x07, 0x00, 0xB0, 0x32, 0x80, 0x1F, 0x03,
-    0x0E, 0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x1D, 0x1C, 0x10, 0x00, 0x00,
-    0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xF2,
-    0xF0, 0x3E, 0x3F, 0x07, 0xE1, 0x50, 0x54, 0x3F, 0xFD, 0xD1, 0xDA, 0x03, 0x00, 0x00, 0x01, 0x56,
-    0xA8, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6A, 0xB0,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0xCB, 0x41, 0xD3, 0xC0, 0xB0, 0xF0, 0x3C, 0xB8,
-    0x1E, 0x14, 0x05, 0x00, 0x00, 0x00, 0xFF, 0xD2, 0xAF, 0x40, 0x3C, 0x01, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x50, 0x1F, 0x0F, 0x03, 0x9A, 0x70, 0x70, 0xFA,
-    0x0A, 0x0F, 0xC0, 0x02, 0x40, 0x00, 0x20, 0x00, 0x0C, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x68, 0x07, 0xF4, 0xBC, 0x00, 0xF4, 0x1F, 0x80, 0x2F, 0x57, 0xD0, 0x3F, 0x00,
-    0x07, 0xFE, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x01, 0x80, 0x7C, 0x3C, 0x1E, 0x02, 0xC0, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x24, 0x0B, 0x8B, 0x01, 0xD0,
-    0x3C, 0x0F, 0x5F, 0x01, 0x90, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x05, 0x00,
-    0x20, 0xC1, 0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x02, 0xC0, 0xA4, 0x00, 0x1B, 0x40,
-    0x01, 0xAA, 0xA4, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x90, 0x00, 0x06, 0xD0, 0x20, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x57, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xAA, 0xA8, 0x00,
-    0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x1F, 0xAA, 0xA8, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xD0, 0x00, 0x38, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xEA, 0xAA, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xEA, 0xAA,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x05, 0x55, 0x5A, 0xA1, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x2F,
-    0x00, 0x7D, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0xF0, 0x0F, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x1E, 0x01,
-    0xF0, 0x01, 0xF0, 0x0B, 0x80, 0x7F, 0x80, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x07, 0xEA, 0xAA, 0x40, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFA, 0xBF, 0x00, 0x03, 0xF0,
-    0x02, 0xE0, 0x02, 0xF0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0B, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x1B, 0xE0, 0x2F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0xAA, 0x40, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x14, 0x00, 0x7F, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x07,
-    0xE0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x14, 0x01,
-    0x40, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0xF8, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0A, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x79, 0x55, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x01,
-    0xD0, 0x00, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xD5, 0x00, 0x00, 0x38, 0x00,
-    0x3F, 0xFF, 0x40, 0x03, 0x40, 0x07, 0x40, 0x3C, 0x00, 0xB0, 0x00, 0xB0, 0x01, 0xD0, 0x0E, 0x00,
-    0x0F, 0x00, 0x1D, 0x01, 0xD0, 0x01, 0xE0, 0x02, 0xD0, 0x2C, 0x00, 0x2D, 0x00, 0xBC, 0x03, 0x80,
-    0x03, 0xFA, 0xFF, 0x43, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x7E, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2C, 0x00, 0x07, 0x00, 0x00, 0x0F,
-    0x00, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x01, 0xD0, 0x00, 0x78, 0x00, 0x00, 0xB0,
-    0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xEA,
-    0xAB, 0xE0, 0x0B, 0x02, 0xC0, 0x00, 0xB4, 0x00, 0xD0, 0xF0, 0x00, 0x3C, 0x00, 0x34, 0x78, 0x00,
-    0x0F, 0x00, 0x2D, 0x2C, 0x00, 0x0B, 0x80, 0x2F, 0x0F, 0x00, 0x03, 0xFA, 0xFF, 0x83, 0x80, 0x00,
-    0xFF, 0xFF, 0x81, 0xD0, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xA5, 0x7E, 0x55, 0x50, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x2F, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x02, 0xF4, 0x00,
-    0xE0, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x7F, 0x00, 0x3C, 0x00, 0x2F, 0x80, 0x0F, 0x00, 0x0F, 0xD0,
-    0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x02, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B,
-    0xD0, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0x2F, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00,
-    0x07, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFA, 0xFE, 0x00, 0x00, 0x0B, 0xD3, 0xFC, 0x00, 0x00, 0x3F,
-    0x0F, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x3F, 0xF4, 0x00, 0x3F, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x1F, 0xC0, 0x0B, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0xF8, 0x00,
-    0xFF, 0xC0, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x3F, 0x00, 0x7E, 0xF4, 0x00, 0xF8, 0x07, 0xEB, 0xC0,
-    0x07, 0xD0, 0x3E, 0x3F, 0x00, 0x2F, 0x03, 0xF1, 0xF8, 0x00, 0xFC, 0x2F, 0x0B, 0xD0, 0x03, 0xE2,
-    0xF4, 0x3F, 0x00, 0x2F, 0x5F, 0x41, 0xFC, 0x00, 0xFD, 0xF8, 0x0F, 0xE0, 0x03, 0xFF, 0xC0, 0x3F,
-    0x40, 0x1F, 0xFC, 0x01, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x28, 0x00, 0x07, 0x80, 0xB0, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2E, 0x01, 0xF0,
-    0x00, 0x1F, 0x03, 0xD0, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0A, 0x00, 0xB4, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x2D,
-    0x01, 0xF0, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0xF4,
-    0x07, 0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0F, 0x00, 0x03, 0xD0,
-    0x1F, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x07, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3E,
-    0xF0, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x07,
-    0xC0, 0xF4, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x02, 0xF0, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x1F, 0x40, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xE0, 0x01, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xD5, 0x55, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x2F, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x7C,
-    0x00, 0x70, 0x02, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x7F, 0x00, 0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0B, 0x95, 0x7C,
-    0x00, 0xF0, 0x00, 0xD0, 0x0F, 0x00, 0x0D, 0x02, 0xE0, 0x02, 0xC0, 0x3C, 0x00, 0xB4, 0x03, 0xFF,
-    0xF8, 0x00, 0x7E, 0xAB, 0xE0, 0x0B, 0x40, 0x0B, 0x80, 0xF0, 0x00, 0x7C, 0x0F, 0x00, 0x0F, 0xC1,
-    0xE0, 0x07, 0xF4, 0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFA, 0xAA, 0x90, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x07, 0x40, 0x3C, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x1E,
-    0x00, 0xB4, 0x00, 0x2C, 0x00, 0xF0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x78, 0x02, 0xF0, 0x00, 0xB4,
-    0x03, 0xE0, 0x01, 0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x07, 0xC0, 0x1F, 0x95, 0x5F, 0xD0, 0xBF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF4, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFA, 0xAA, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFA, 0xAA, 0x80,
-    0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0xF0,
-    0x1F, 0x80, 0x00, 0x3F, 0x03, 0xFE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0xFC, 0x00, 0x00,
-    0x1F, 0x83, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x8B, 0xD0, 0x00, 0x00, 0x0B, 0xE3, 0xF2,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xEB, 0xF9, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xFF,
-    0x8F, 0xFC, 0x00, 0x07, 0xFE, 0x0F, 0xF4, 0x7F, 0xE0, 0x02, 0xFF, 0xC2, 0xFF, 0x43, 0xFF, 0x40,
-    0x00, 0x1A, 0xE4, 0x00, 0x3F, 0xFF, 0xC0, 0x05, 0x00, 0xB8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x07, 0xC0, 0x06, 0xAF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xF0, 0x20, 0x02, 0xF8, 0x1F, 0xEF, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x07, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xFD, 0x00, 0x3E, 0x00, 0x3F, 0xF0,
-    0x02, 0xF4, 0x02, 0xFF, 0xC0, 0x0F, 0xC0, 0x1F, 0xBD, 0x00, 0x3E, 0x01, 0xFA, 0xF0, 0x01, 0xF4,
-    0x0F, 0x8F, 0xC0, 0x0B, 0xC0, 0xFC, 0x7E, 0x00, 0x3F, 0x0B, 0xC2, 0xF4, 0x00, 0xF8, 0xBD, 0x0F,
-    0xC0, 0x0B, 0xD7, 0xD0, 0x7F, 0x00, 0x3F, 0x7E, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x0F, 0xD0, 0x07,
-    0xFF, 0x00, 0x7F, 0x00, 0x2F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x2A, 0x00, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xE0,
-    0x02, 0xFF, 0x00, 0x1F, 0x40, 0x1F, 0xFC, 0x00, 0xBC, 0x01, 0xFF, 0xE0, 0x03, 0xF0, 0x0F, 0xEF,
-    0x40, 0x1F, 0x80, 0xFC, 0xFC, 0x00, 0xBC, 0x0B, 0xC7, 0xF0, 0x03, 0xF0, 0xBD, 0x2F, 0x40, 0x0F,
-    0x87, 0xD0, 0xFC, 0x00, 0xBD, 0x7E, 0x07, 0xF0, 0x03, 0xF7, 0xE0, 0x2F, 0x80, 0x0F, 0xFF, 0x00,
-    0xFD, 0x00, 0x7F, 0xF0, 0x07, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xE0, 0x2F, 0x40, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x3E, 0x0F,
-    0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00,
-    0x3E, 0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x2F, 0x00,
-    0xF4, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0xF4, 0x07,
-    0xC0, 0x01, 0xF0, 0x0B, 0xC0, 0x02, 0xE0, 0x0F, 0x80, 0x03, 0xD0, 0x1F, 0x40, 0x0B, 0xC0, 0x2F,
-    0x00, 0x7F, 0x80, 0x3F, 0x00, 0xBE, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x3E, 0xE0, 0x0B, 0x7C,
-    0x01, 0xF7, 0xC0, 0x79, 0xE0, 0x0B, 0x9F, 0x03, 0xCF, 0x40, 0x3D, 0x3C, 0x3D, 0x3C, 0x00, 0xF0,
-    0xF2, 0xF1, 0xF0, 0x07, 0xC3, 0xEF, 0x0B, 0x80, 0x2E, 0x0F, 0xF8, 0x3D, 0x00, 0xF4, 0x3F, 0xC1,
-    0xF0, 0x07, 0xC0, 0xFD, 0x0B, 0xC0, 0x2F, 0x02, 0xA0, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D,
-    0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00,
-    0x07, 0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00,
-    0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03, 0xE0,
-    0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xF4, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xB4, 0x01, 0xF0, 0x00, 0xF0, 0x02, 0xE0, 0x01, 0xF0, 0x03,
-    0xD0, 0x02, 0xE0, 0x07, 0xC0, 0x03, 0xD0, 0x0B, 0xC0, 0x03, 0xC0, 0x0F, 0x80, 0x07, 0xC0, 0x0F,
-    0x40, 0x0B, 0x80, 0x1F, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xF0, 0x02, 0xF0,
-    0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0, 0x1B,
-    0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xA9, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0x00, 0x1F,
-    0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2D, 0x00,
-    0x3C, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x1F, 0x03, 0xD0, 0x00,
-    0x0F, 0x0B, 0xC0, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xF9, 0x2E, 0x02, 0xC0, 0xB0, 0x0F, 0x40, 0x34,
-    0x34, 0x03, 0xC0, 0x0D, 0x1C, 0x02, 0xF0, 0x0B, 0x0B, 0x40, 0xF8, 0x0B, 0xC1, 0xFE, 0xBF, 0xBF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x2F,
-    0x0B, 0xC0, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x2F,
-    0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xD0, 0x0B, 0x40, 0x0B, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0xF0, 0x00, 0xE0, 0x07, 0x80, 0x07, 0x40, 0x2D, 0x00, 0x2C, 0x00, 0xF0, 0x00, 0xF0,
-    0x03, 0xC0, 0x07, 0x80, 0x2E, 0x00, 0x2D, 0x00, 0xF4, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0xC0, 0x1F,
-    0x00, 0x2E, 0x00, 0xBD, 0x55, 0xF9, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0xE0, 0xB0, 0x00, 0x74, 0x3C, 0x00, 0x3C, 0x0E, 0x00, 0x0F, 0x07, 0x40, 0x07, 0x83, 0xC0, 0x03,
-    0xD0, 0xF0, 0x01, 0xF0, 0x3C, 0x01, 0xFC, 0x0F, 0x96, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x2F, 0xE3,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x19, 0x03, 0xC0, 0x0B, 0x80, 0xB4, 0x0E, 0x00, 0x3D, 0x03, 0xC0,
-    0x74, 0x00, 0xF0, 0x0F, 0x02, 0xC0, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3D, 0x02, 0xD0, 0x38, 0x00,
-    0xF0, 0x0F, 0x01, 0xD0, 0x07, 0xC0, 0x3C, 0x0B, 0x00, 0x2E, 0x01, 0xE0, 0x3C, 0x00, 0xF4, 0x0B,
-    0x00, 0xE0, 0x03, 0xC0, 0x3C, 0x07, 0x40, 0x1E, 0x00, 0xE0, 0x2C, 0x00, 0xB9, 0x5B, 0x95, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x19, 0x03, 0xC0, 0x0B, 0x80, 0xB4, 0x0E, 0x00, 0x3D, 0x03, 0xC0, 0x74, 0x00, 0xF0, 0x0F,
-    0x02, 0xC0, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3D, 0x02, 0xD0, 0x38, 0x00, 0xF0, 0x0F, 0x01, 0xD0,
-    0x07, 0x80, 0x3C, 0x0B, 0x00, 0x2D, 0x01, 0xE0, 0x3C, 0x00, 0xF0, 0x0B, 0x00, 0xE0, 0x03, 0xC0,
-    0x3C, 0x07, 0x40, 0x1E, 0x00, 0xE0, 0x2C, 0x00, 0xBA, 0x5B, 0x96, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF,
-    0xF0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD5, 0x00, 0x0B, 0xFF,
-    0xE0, 0x0F, 0x00, 0x78, 0x0F, 0x00, 0x2C, 0x1E, 0x00, 0x2C, 0x2D, 0x00, 0x3C, 0x3C, 0x01, 0xF8,
-    0x3E, 0xAF, 0xF0, 0x7F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0x80, 0x00, 0x00,
-    0xFC, 0x01, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0xB0, 0x00, 0x00, 0x1F, 0x40, 0x3C, 0x00, 0x00, 0x0B,
-    0xC0, 0x1F, 0x54, 0x00, 0x03, 0xE0, 0x0B, 0xFF, 0xE0, 0x01, 0xF4, 0x03, 0xC0, 0x1E, 0x00, 0xBC,
-    0x00, 0xF0, 0x02, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0xB0, 0x0F, 0x80, 0x2D, 0x00, 0x3C, 0x0B, 0xD0,
-    0x0F, 0x00, 0x7E, 0x03, 0xF0, 0x03, 0xEA, 0xFF, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0x00,
-    0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xD5, 0x00,
-    0x0B, 0xFF, 0xE0, 0x0F, 0x00, 0x78, 0x0F, 0x00, 0x2C, 0x1E, 0x00, 0x2C, 0x2D, 0x00, 0x3C, 0x3C,
-    0x01, 0xF8, 0x3E, 0xAF, 0xF0, 0xBF, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0xBE, 0xBF, 0xC0, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x02, 0xF0,
-    0x02, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x02,
-    0xB8, 0x00, 0x2F, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00,
-    0x00, 0xB8, 0x03, 0xFF, 0xD0, 0x00, 0xF4, 0x1F, 0x81, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x78, 0x01,
-    0xF0, 0xF4, 0x00, 0x38, 0x02, 0xD1, 0xE0, 0x00, 0x3C, 0x03, 0xC3, 0xC0, 0x00, 0x78, 0x03, 0xC7,
-    0xC0, 0x00, 0x74, 0x07, 0xDB, 0x40, 0x00, 0xB4, 0x0B, 0xFF, 0x40, 0x00, 0xF0, 0x0F, 0x4F, 0x00,
-    0x02, 0xE0, 0x0E, 0x0F, 0x80, 0x07, 0xC0, 0x1D, 0x0F, 0xD0, 0x7F, 0x80, 0x2C, 0x0F, 0xFF, 0xFF,
-    0x00, 0x3C, 0x07, 0xFF, 0xFC, 0x00, 0x38, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x74, 0x00, 0x1E, 0x00,
-    0x2C, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x03, 0x80, 0x01, 0xF4, 0x01, 0xE0, 0x00, 0x7F,
-    0x40, 0xB4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x2F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C,
-    0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xB5, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xE0, 0x3F, 0x40, 0xBE, 0x00, 0x7D,
-    0x02, 0xF0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0xD5, 0x7C, 0x03, 0xC0, 0x1C,
-    0x03, 0x80, 0x2C, 0x07, 0x40, 0x78, 0x0B, 0xFF, 0xD0, 0x0F, 0xAA, 0xF0, 0x0E, 0x00, 0x38, 0x1D,
-    0x00, 0x3C, 0x2C, 0x00, 0xB8, 0x3D, 0x5B, 0xF0, 0x7F, 0xFF, 0xE0, 0xBF, 0xFE, 0x40, 0x00, 0xAA,
-    0xAA, 0x40, 0x7F, 0xFF, 0xD0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x0E, 0x07, 0xC0,
-    0x01, 0xD0, 0xB8, 0x00, 0x3C, 0x0F, 0x40, 0x07, 0x80, 0xF0, 0x00, 0xB4, 0x1F, 0x00, 0x1F, 0x02,
-    0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xF4, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF0, 0xF0,
-    0x00, 0x1E, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0x90, 0xB0,
-    0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE, 0xA9, 0x50, 0xB4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x01, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xE0, 0x7C, 0x00, 0x07, 0xC1, 0xFC,
-    0x1F, 0x00, 0x00, 0x3D, 0x2F, 0x87, 0xD0, 0x00, 0x02, 0xF2, 0xF5, 0xF4, 0x00, 0x00, 0x1F, 0x3F,
-    0x7D, 0x00, 0x00, 0x00, 0xFB, 0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFB,
-    0xFB, 0xF4, 0x00, 0x01, 0xFE, 0x7F, 0x3F, 0xC0, 0x00, 0xBF, 0x8F, 0xF1, 0xFF, 0x00, 0x3F, 0xE1,
-    0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x04, 0x09, 0x00, 0x00, 0x90, 0x00, 0x1C, 0x00, 0xFE,
-    0x00, 0x00, 0xB4, 0x00, 0x03, 0x80, 0x00, 0x34, 0x04, 0x1F, 0x02, 0xFF, 0xD0, 0x2F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x3F, 0x02, 0xC0, 0x0F, 0xE0, 0x3C, 0x02, 0xED, 0x07, 0x80,
-    0xB6, 0xC0, 0xB4, 0x2D, 0x3C, 0x0F, 0x0B, 0x43, 0x80, 0xF2, 0xE0, 0xB4, 0x1E, 0xB8, 0x0F, 0x02,
-    0xFE, 0x00, 0xF0, 0x3F, 0x80, 0x2E, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-    0xB4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x3F, 0x02,
-    0xC0, 0x0F, 0xE0, 0x3C, 0x02, 0xED, 0x07, 0x80, 0xB6, 0xC0, 0xB4, 0x2D, 0x3C, 0x0F, 0x0B, 0x43,
-    0x80, 0xF2, 0xE0, 0xB4, 0x1E, 0xB8, 0x0F, 0x02, 0xFE, 0x00, 0xF0, 0x3F, 0x80, 0x2E, 0x03, 0xF0,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x07, 0x87, 0xC0, 0x03, 0xC7, 0xC0, 0x00,
-    0xF3, 0xC0, 0x00, 0xBB, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xDF, 0xC0, 0x02, 0xE3, 0xF8, 0x00, 0xF0, 0x7F, 0x80, 0x7C, 0x0F, 0xF4, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x3F, 0xFC, 0x00, 0x38, 0x2C, 0x00, 0x74, 0x38, 0x00, 0xB0, 0x74, 0x00, 0xE0, 0xB0, 0x01,
-    0xC0, 0xF0, 0x03, 0xC0, 0xE0, 0x03, 0x82, 0xD0, 0x0B, 0x03, 0xC0, 0x3E, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x0F, 0xD0, 0x07, 0xF0, 0x07, 0xF8,
-    0x03, 0xF8, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0xFB, 0xC1, 0xFF, 0x40, 0x7A, 0xF0, 0xF7, 0xC0, 0x2D,
-    0x7C, 0xB9, 0xF0, 0x0F, 0x1F, 0xBC, 0xFC, 0x07, 0xC3, 0xFD, 0x3E, 0x02, 0xF0, 0xFE, 0x1F, 0x40,
-    0xF8, 0x3F, 0x0F, 0xC0, 0x3D, 0x0B, 0x43, 0xF0, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x2E, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0xF4, 0x02, 0xF0,
-    0x00, 0x7C, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0x9B, 0xC0, 0x0F,
-    0x40, 0x78, 0x0F, 0x40, 0x0F, 0x03, 0xC0, 0x03, 0xC2, 0xD0, 0x00, 0xE0, 0xF0, 0x00, 0xB4, 0x3C,
-    0x00, 0x7C, 0x0F, 0x91, 0xBE, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x2F, 0xFF, 0xFE, 0x03, 0xD0, 0x02, 0xD0, 0x3C, 0x00,
-    0x3C, 0x07, 0xC0, 0x03, 0xC0, 0xB8, 0x00, 0x78, 0x0F, 0x40, 0x0B, 0x40, 0xF0, 0x00, 0xF0, 0x1F,
-    0x00, 0x1F, 0x02, 0xE0, 0x02, 0xF0, 0x3D, 0x00, 0x3E, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x05, 0x0B,
-    0xE0, 0x00, 0x03, 0xDF, 0xFF, 0x00, 0x00, 0xFF, 0x41, 0xD0, 0x00, 0x3F, 0x00, 0x38, 0x00, 0x1F,
-    0x40, 0x0E, 0x00, 0x0B, 0xC0, 0x03, 0x80, 0x03, 0xF0, 0x01, 0xD0, 0x00, 0xFC, 0x00, 0xF0, 0x00,
-    0x7F, 0x40, 0xB8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xBF, 0xFD, 0x00, 0x0F, 0x8F, 0xF8, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0,
-    0x0F, 0xFF, 0x40, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0xA0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x54, 0x38, 0x14, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C, 0x00,
-    0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F, 0x1F,
-    0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1B, 0xFF, 0xFD, 0x00, 0x2F, 0xEF, 0xEF, 0xE0, 0x2E, 0x03, 0xD0, 0x2C, 0x0E, 0x00,
-    0xF0, 0x07, 0x0B, 0x00, 0xBC, 0x02, 0xC3, 0x80, 0x3E, 0x00, 0xF0, 0xE0, 0x0F, 0x40, 0xB8, 0x3E,
-    0x07, 0xC1, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xF9, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0,
-    0x3C, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x01, 0x40, 0x05, 0x01, 0xE0, 0x03, 0xC0, 0xB4, 0x00, 0xF0, 0x3C, 0x00, 0x38,
-    0x0F, 0x00, 0x1D, 0x07, 0x80, 0x0B, 0x02, 0xD0, 0x03, 0xC0, 0xF0, 0x00, 0xE0, 0x38, 0x00, 0x74,
-    0x1D, 0x00, 0x2D, 0x0B, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x0A, 0x00, 0x14, 0x02, 0x0D, 0x01, 0xC3, 0x00, 0xB1, 0xC0, 0x38, 0xA0, 0x1D, 0x38,
-    0x0F, 0x0B, 0xAF, 0xC0, 0xFD, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x00, 0x50, 0x00,
-    0x01, 0x40, 0x2F, 0x02, 0xE0, 0x3C, 0x03, 0xE0, 0x3D, 0x07, 0x80, 0x3C, 0x03, 0xC0, 0xB4, 0x07,
-    0xC0, 0x3C, 0x0B, 0x00, 0xB8, 0x07, 0x80, 0xF0, 0x0F, 0x40, 0xB4, 0x0E, 0x00, 0xF0, 0x0F, 0x01,
-    0xD0, 0x1F, 0x00, 0xE0, 0x2C, 0x02, 0xD0, 0x1D, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x01, 0x40, 0x2F, 0x02, 0xE0, 0x3C, 0x03, 0xE0, 0x3D, 0x07,
-    0x80, 0x3C, 0x03, 0xC0, 0xB4, 0x07, 0xC0, 0x3C, 0x0B, 0x00, 0xB8, 0x07, 0x80, 0xF0, 0x0F, 0x40,
-    0xB4, 0x0E, 0x00, 0xF0, 0x0F, 0x01, 0xD0, 0x1F, 0x00, 0xE0, 0x2C, 0x02, 0xD0, 0x1D, 0x03, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x0B, 0x40, 0x78, 0x0F, 0x00, 0x2C,
-    0x0F, 0x00, 0x3C, 0x1E, 0x01, 0xF4, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x05, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0xE0, 0x3D, 0x00, 0x00, 0x74,
-    0x0F, 0x00, 0x00, 0x2C, 0x07, 0xFF, 0xE0, 0x0F, 0x02, 0xE0, 0x0F, 0x07, 0x80, 0xF4, 0x01, 0xC2,
-    0xD0, 0x3C, 0x00, 0xB0, 0xF0, 0x0F, 0x01, 0xF8, 0x3C, 0x07, 0xFF, 0xFC, 0x2E, 0x02, 0xFF, 0xF8,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0xFF, 0xD0, 0x0F, 0x00, 0x78, 0x0F, 0x00, 0x2C, 0x1E,
-    0x00, 0x3C, 0x2D, 0x01, 0xF4, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x0B, 0x40, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x15, 0x7D,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF4, 0xB5, 0x5F, 0xE0, 0xFF, 0xFF, 0x40, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0B, 0xFC, 0x00, 0x1D, 0x0F,
-    0x43, 0xC0, 0x0F, 0x0F, 0x00, 0x70, 0x03, 0x8B, 0x00, 0x0D, 0x01, 0xD3, 0x80, 0x07, 0x00, 0xB1,
-    0xC0, 0x02, 0xC0, 0x3F, 0xF0, 0x00, 0xF0, 0x0E, 0x7C, 0x00, 0x74, 0x07, 0x0F, 0x00, 0x7C, 0x02,
-    0xC3, 0xFA, 0xFD, 0x00, 0xE0, 0xBF, 0xFE, 0x00, 0x34, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1D, 0x03, 0xC0, 0x03, 0x00, 0x38, 0x00,
-    0x70, 0x0B, 0x40, 0x03, 0xEA, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0x92, 0xE0, 0x02, 0xE0, 0x3D,
-    0x00, 0x7C, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x03, 0xD0, 0x0B, 0x40, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x2E, 0x42, 0xC0, 0x2D, 0x00, 0x34, 0x1E,
-    0x01, 0x6D, 0x0F, 0xFF, 0xFF, 0x87, 0xFA, 0xA5, 0x42, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F,
-    0x40, 0x04, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x1D, 0x00, 0x78, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x06, 0x97,
-    0xE0, 0x02, 0xC0, 0x0F, 0x00, 0x70, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFE, 0xAB, 0x80, 0x2F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x0F, 0x5A, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x6D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x39, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x47, 0xC0, 0x0F, 0x80, 0x2C, 0x02, 0xF0, 0x02, 0xC0, 0x3D,
-    0x00, 0x3C, 0x03, 0xC0, 0x03, 0x80, 0xBC, 0x00, 0xB8, 0x0F, 0x80, 0x0F, 0x40, 0xF4, 0x01, 0xF0,
-    0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x07, 0xFF, 0xFD, 0x02,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x00, 0xF4, 0x2C, 0x03, 0x80, 0x0D, 0x0B, 0x00, 0x00, 0x0F, 0x55, 0x00, 0x1F,
-    0xFF, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x00, 0x50, 0x3F, 0xEF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01, 0xF4, 0x2F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0x34, 0x00, 0x2C,
-    0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0B, 0x80,
-    0x00, 0x01, 0x40, 0x14, 0x1F, 0x03, 0xE0, 0xFC, 0x1F, 0x87, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x40, 0x00, 0x2C, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0x80, 0xB0, 0x00, 0x0C, 0x02, 0x80, 0x00, 0x70, 0x0D, 0x00,
-    0x02, 0x80, 0x3F, 0xD0, 0x0C, 0x02, 0x80, 0xD0, 0x30, 0x0E, 0x02, 0x82, 0x80, 0x34, 0x0D, 0x0D,
-    0x01, 0xC0, 0xB0, 0xB0, 0x0B, 0xFF, 0x8B, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x90, 0x00, 0x70, 0x03, 0x00, 0x02, 0x80, 0x1C, 0x00, 0x0D, 0x00, 0xA0,
-    0x00, 0x3F, 0xFF, 0xFE, 0x02, 0x80, 0x0C, 0x07, 0x0D, 0x00, 0xB0, 0x0C, 0x30, 0x03, 0x80, 0xF1,
-    0xC0, 0x0F, 0xFF, 0x4A, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x0F, 0x5A, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x6D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x39, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x47, 0xC0, 0x0F, 0x80, 0x2C, 0x02, 0xF0,
-    0x02, 0xC0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0x80, 0xBC, 0x00, 0x78, 0x0F, 0x80, 0x0F, 0x40,
-    0xF4, 0x00, 0xF0, 0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x2C, 0x00, 0x78, 0x3D, 0x00, 0x2D, 0x3D, 0x00, 0x0F, 0x3D, 0x00, 0x0B, 0xBD,
-    0x00, 0x03, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3D, 0xFC, 0x00, 0x2E, 0x3F,
-    0x80, 0x0F, 0x47, 0xF8, 0x07, 0xC0, 0xFF, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x03,
-    0xF0, 0x2C, 0x00, 0xFE, 0x03, 0xC0, 0x2E, 0xD0, 0x78, 0x0B, 0x6C, 0x0B, 0x42, 0xD3, 0xC0, 0xF0,
-    0xB4, 0x38, 0x0F, 0x2E, 0x0B, 0x41, 0xEB, 0x80, 0xF0, 0x2F, 0xE0, 0x0F, 0x03, 0xF8, 0x02, 0xE0,
-    0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0D, 0x00, 0x02, 0xD0, 0x2C,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4,
-    0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80,
-    0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x06, 0x00, 0xB0, 0x03, 0x80, 0x38, 0x00, 0xD0, 0x0D, 0x00, 0x70, 0x07, 0x00, 0x2C,
-    0x02, 0xC0, 0x0E, 0x00, 0xE0, 0x03, 0x40, 0x74, 0x01, 0xC0, 0x2C, 0x00, 0xB0, 0x0F, 0x55, 0x78,
-    0x03, 0xFF, 0xFD, 0x00, 0x03, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xC0, 0x2C, 0x0F, 0x40, 0x1C, 0x1F,
-    0x00, 0x2C, 0x2F, 0x55, 0xB8, 0x2F, 0xFF, 0xF4, 0x1F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x05, 0xF5, 0x54, 0x3F, 0xFF, 0xE0, 0x2E,
-    0x00, 0x00, 0xB8, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xD5, 0xB0, 0x7C, 0x00, 0xE2, 0xE0, 0x03, 0x8F,
-    0x40, 0x2D, 0x3F, 0xAF, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40,
-    0x3F, 0x80, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x3E, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x0F, 0x03,
-    0xC0, 0x00, 0x2E, 0x07, 0xC0, 0xF0, 0x00, 0x1F, 0x02, 0xE0, 0x3C, 0x00, 0x0F, 0x40, 0xF4, 0x0F,
-    0x00, 0x0B, 0xC0, 0x3C, 0x03, 0xC0, 0x03, 0xD0, 0x2F, 0x00, 0xF4, 0x00, 0x00, 0x55, 0x55, 0x50,
-    0x2F, 0xFF, 0xFE, 0x01, 0xF0, 0x0B, 0x80, 0x07, 0x83, 0xD0, 0x00, 0x2D, 0xF0, 0x00, 0x06, 0xFE,
-    0x00, 0x02, 0xCB, 0x38, 0x00, 0xB0, 0xE1, 0xC0, 0x0D, 0x0D, 0x0C, 0x03, 0xC1, 0xC1, 0xC0, 0x74,
-    0x3C, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x02, 0xFF, 0x80, 0x1E, 0x00,
-    0x7D, 0x2D, 0x03, 0xC0, 0x0F, 0x40, 0xF0, 0xB8, 0x01, 0xF1, 0xBF, 0xFF, 0x00, 0x1B, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0x96, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0xBC,
-    0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBC,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0x2F, 0x80, 0x0B, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xB0,
-    0x03, 0xDB, 0x03, 0x80, 0x2C, 0x0E, 0x2C, 0x00, 0xF6, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x0B,
-    0x80, 0x3D, 0x00, 0x78, 0x00, 0x78, 0x03, 0xC0, 0x01, 0xE0, 0x1E, 0x00, 0x0B, 0x40, 0xB4, 0x00,
-    0x3C, 0x02, 0xD0, 0x01, 0xE0, 0x0B, 0xC0, 0x2F, 0x40, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x14, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x7D, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x47, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x3C, 0x00, 0x0E, 0x03, 0xC0, 0x02, 0xC0, 0x3C, 0x00, 0x74, 0x03, 0xC0, 0x0F, 0x00, 0x3D, 0x02,
-    0xD0, 0x03, 0xD0, 0x78, 0x00, 0x2E, 0x0F, 0x00, 0x02, 0xE3, 0xE0, 0x00, 0x2F, 0xBC, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x40, 0x03, 0xC3, 0xFF,
-    0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7E, 0xAA, 0xA4, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x0A, 0xAA, 0xBC, 0x01, 0xFF, 0xFF, 0x80, 0x2E, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFA, 0xAA, 0x90, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x38, 0x00, 0x00, 0xD0, 0x00, 0x1F, 0xFF, 0xC0, 0x3D, 0x55, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00,
-    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x85, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0xFD, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x03, 0x80,
-    0x07, 0xC0, 0x02, 0xD0, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0xF4, 0x0B, 0xF4, 0x00, 0x3D, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0xFF, 0xE0, 0x30, 0x00, 0x1C, 0x00, 0x0A, 0x00, 0x03, 0xFF, 0x41,
-    0xE0, 0x70, 0xB0, 0x0C, 0x38, 0x07, 0x0D, 0x07, 0x87, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0xD0,
-    0x2F, 0x40, 0x02, 0xF4, 0x1F, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x07, 0xF8, 0x1F, 0x80, 0x00, 0x0F,
-    0xC1, 0xFD, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x2F, 0xCF, 0xC0,
-    0x00, 0x00, 0x0B, 0xDF, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xFE,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x7F, 0xC7, 0xFD, 0x00, 0x0F,
-    0xFD, 0x2F, 0xF0, 0xFF, 0xC1, 0x0F, 0xFD, 0x0F, 0xFC, 0x1F, 0xFD, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x83, 0xC0, 0x0B, 0x4B, 0xD2, 0xD0, 0x00, 0xF2, 0xF2, 0xD0,
-    0x00, 0x2D, 0xB9, 0xE0, 0x00, 0x07, 0xFE, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0x7E, 0xFD, 0x00, 0x3F, 0x6F,
-    0x5F, 0xC0, 0x7F, 0x4F, 0xD3, 0xFA, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x1B, 0xE4, 0x00, 0x3F, 0xFF, 0xC0, 0x05, 0x00, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x0B, 0xC0, 0x0A, 0xBF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x60, 0x02, 0xF4, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x01,
-    0xBF, 0xE4, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x04, 0x09, 0x00, 0x00, 0x90, 0x00, 0x1C, 0x00, 0xFE, 0x00, 0x00, 0xB4, 0x00, 0x03, 0x80, 0x00,
-    0x34, 0x04, 0x1F, 0x02, 0xFF, 0xD0, 0x3F, 0xE4, 0x00, 0x40, 0x00, 0x1A, 0x00, 0x00, 0x18, 0x00,
-    0x07, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x0F,
-    0x42, 0xF4, 0x00, 0x01, 0xF0, 0xBD, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x03, 0xD7, 0xE0, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x0B, 0xDF, 0xF0, 0x00, 0x00,
-    0xFC, 0xBF, 0xC0, 0x00, 0x1F, 0x83, 0xFD, 0x00, 0x02, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0x01, 0xFF,
-    0xC0, 0x07, 0xE0, 0x0F, 0xFE, 0x1C, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0xE1, 0xE0, 0x01, 0xD7, 0xC0,
-    0x03, 0xCF, 0x00, 0x03, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2D,
-    0xFC, 0x00, 0x3C, 0xBE, 0x00, 0x78, 0x3F, 0x40, 0xB4, 0x2F, 0xC1, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x2C, 0x00, 0x1F, 0x40, 0x03,
-    0xC4, 0x03, 0xD0, 0x00, 0x7A, 0xE0, 0xF8, 0x00, 0x0F, 0x7E, 0x3E, 0x00, 0x00, 0xF3, 0xDB, 0xC0,
-    0x00, 0x1E, 0x7E, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xCF,
-    0xFE, 0x00, 0x00, 0xF8, 0xFB, 0xF4, 0x00, 0x1F, 0x1F, 0x6F, 0xC0, 0x02, 0xF2, 0xF0, 0xFF, 0x00,
-    0x3E, 0x2A, 0x0F, 0xF8, 0x07, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x0E, 0x00, 0xB4,
-    0x01, 0xD4, 0x2D, 0x00, 0x2E, 0xC7, 0x40, 0x03, 0xBD, 0xD0, 0x00, 0x77, 0xF4, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xE7, 0xFC, 0x00, 0x2C, 0xB7, 0xE0, 0x03, 0xCF, 0x2F, 0x40, 0x78, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xD0, 0x2F, 0x40, 0x1F, 0xFF, 0x1F, 0x80, 0x06, 0xFE, 0x9F, 0x80, 0x00, 0x3E, 0x0F,
-    0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF, 0x40, 0x00, 0xFC, 0x2F, 0xF0, 0x00,
-    0x3E, 0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x0F, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0xB4, 0x7C, 0x00, 0xF1, 0xF0, 0x01, 0xE7, 0xC0, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFD,
-    0x00, 0x0B, 0xBF, 0x00, 0x0F, 0x6F, 0xC0, 0x1F, 0x0F, 0xE0, 0x2F, 0x07, 0xF4, 0x3E, 0x03, 0xFC,
-    0x3F, 0xFF, 0xF8, 0x0B, 0xD3, 0xFF, 0xFF, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x3E,
-    0x0F, 0xC0, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFA, 0xFE, 0x00, 0x00, 0x2F, 0x4F, 0xF4, 0x00, 0x03,
-    0xF0, 0xFF, 0xC0, 0x00, 0x3E, 0x07, 0xFE, 0x00, 0x0B, 0xD0, 0x3F, 0xF4, 0x00, 0xFC, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x1E, 0x55, 0xB8, 0x78, 0x00, 0xB5, 0xF0, 0x00, 0xF3, 0xC0,
-    0x00, 0xEF, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0x7F, 0x00, 0x0F,
-    0x2F, 0x80, 0x1E, 0x0F, 0xC0, 0x2D, 0x0B, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0xBC, 0x00,
-    0x03, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x02, 0xF0,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x02, 0xF4,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x0F,
-    0xE0, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0xE0, 0x3C, 0x00, 0x74, 0x0F, 0x00, 0x2C, 0x07, 0x80, 0x0F, 0x02, 0xD0, 0x03, 0xC0,
-    0xF0, 0x02, 0xE0, 0x3E, 0xAA, 0xF4, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xC0, 0x0B, 0x81,
-    0xF0, 0x03, 0xD0, 0xBC, 0x01, 0xF1, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x03, 0xFF, 0xE0, 0x2C, 0x00, 0x79, 0x54, 0x03, 0xC0, 0x0B, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00,
-    0x0B, 0x40, 0x0F, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x0F, 0xAA, 0xBD, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x0B,
-    0x80, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0x2E, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0x55, 0x40,
-    0x07, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0xB8, 0x00, 0x7F, 0x90, 0x7C, 0x0F, 0x40, 0x0B, 0xE0, 0x02,
-    0xD0, 0xF0, 0x00, 0xFC, 0x00, 0x2D, 0x1F, 0x00, 0x0F, 0x80, 0x02, 0xC2, 0xF0, 0x01, 0xF4, 0x00,
-    0x3C, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x43, 0xD0, 0x03, 0xF0, 0x1F, 0xF0, 0x7C, 0x00, 0x3F, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3D, 0x55, 0x7C, 0x00,
-    0x01, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00, 0xF0,
-    0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0xF5,
-    0x54, 0x07, 0xC0, 0x07, 0xFF, 0xFD, 0x2E, 0x00, 0x2F, 0x90, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xB4,
-    0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x0B, 0x00, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x03,
-    0xC0, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0xFF, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xF4, 0x02, 0xF0, 0x01, 0xFA, 0xBC, 0x03,
-    0xD0, 0x07, 0x80, 0x1D, 0x0B, 0x80, 0x0F, 0x00, 0x1D, 0x0F, 0x40, 0x3C, 0x00, 0x3C, 0x1F, 0x00,
-    0x38, 0x00, 0xB8, 0x2E, 0x00, 0xB4, 0x02, 0xF0, 0x3D, 0x00, 0xF4, 0x0B, 0xD0, 0x3D, 0x00, 0xF4,
-    0x3F, 0x40, 0x3E, 0x00, 0xFE, 0xFD, 0x1D, 0x3F, 0x80, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0xF8, 0x0B,
-    0x40, 0x78, 0x1D, 0x0E, 0x00, 0xD0, 0x0C, 0x1D, 0x03, 0x80, 0x2C, 0x3C, 0x03, 0x40, 0x74, 0x38,
-    0x07, 0x01, 0xF0, 0x3C, 0x0B, 0x4B, 0xC0, 0x3E, 0x0B, 0xFF, 0x6D, 0x3F, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x9A, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x16, 0x40,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xFF, 0x40, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0xA0, 0x03, 0xFF, 0xE0,
-    0x02, 0xFF, 0x80, 0x00, 0x24, 0x00, 0x01, 0xC0, 0x00, 0xFD, 0x00, 0x05, 0x55, 0x55, 0x54, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x10, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x2A, 0xBE, 0xA8, 0x00, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x0F,
-    0x83, 0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x7E, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0xFC, 0x3F, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78,
-    0x7C, 0x00, 0xF0, 0x7C, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0x3C, 0x0F, 0x40, 0x3C, 0x2E, 0x00, 0x3D,
-    0x3C, 0x00, 0x3D, 0xB4, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x0F, 0x80,
-    0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xF0, 0x0B, 0xC0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xE0,
-    0x3F, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x03, 0xF5, 0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x68, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x7C, 0x02, 0xE0, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x3D,
-    0xB4, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x0A, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC2,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1C, 0x00, 0x74, 0x07, 0x40, 0x03, 0x81, 0xD0, 0x00,
-    0x3C, 0x78, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1F, 0x3D, 0x00, 0x07, 0xC2, 0xF0, 0x01, 0xF4, 0x1F, 0x40, 0x7D, 0x00, 0xF8, 0x50, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0xC0, 0x1A, 0xAA, 0xA8, 0x05, 0x3F, 0xFF, 0xFC, 0x0E, 0x00, 0x3D,
-    0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x38, 0x00, 0xF0,
-    0x00, 0x74, 0x00, 0xF0, 0x00, 0xB0, 0x02, 0xE0, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0xE0, 0x03, 0xC0,
-    0x01, 0xD0, 0x07, 0xC0, 0x02, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x0D, 0x00, 0xD0, 0x0C, 0x01, 0xC0, 0x1C, 0x03, 0xC0,
-    0x28, 0x03, 0x80, 0x34, 0x07, 0x00, 0x30, 0x0B, 0x00, 0x70, 0x0E, 0x00, 0xA0, 0x0F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00, 0x60, 0x06, 0x40, 0x02, 0x80,
-    0xBC, 0x00, 0x7C, 0x0F, 0x40, 0x0B, 0x80, 0xF0, 0x00, 0xF4, 0x0E, 0x00, 0x0F, 0x01, 0xD0, 0x01,
-    0xF0, 0x1C, 0x00, 0x3E, 0x01, 0xC0, 0x0B, 0xD0, 0x1F, 0xAB, 0xFC, 0x00, 0xBF, 0xEF, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x3D, 0xE0, 0x00, 0x03, 0xAD, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x01, 0x00, 0x18, 0x02, 0xC2, 0xC0, 0x3C, 0x38, 0x03, 0x83, 0x40, 0x74, 0x30, 0x0B, 0x03, 0x02,
-    0xF0, 0x2F, 0xFD, 0x00, 0x01, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x34, 0x00, 0x07, 0xB0,
-    0x00, 0x1A, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x3C, 0x0E,
-    0x00, 0x07, 0xC2, 0xD0, 0x00, 0xB8, 0x3C, 0x00, 0x0F, 0x43, 0xC0, 0x01, 0xF0, 0x78, 0x38, 0x3E,
-    0x0B, 0x87, 0x4F, 0xD0, 0xBE, 0xFB, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x1B, 0xF8, 0xF8, 0x00, 0x1C,
-    0x0F, 0x40, 0x02, 0xC2, 0xF0, 0x00, 0x38, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x08, 0x00, 0x41,
-    0xC0, 0x0C, 0x28, 0x02, 0xC3, 0x40, 0x38, 0x70, 0x47, 0x47, 0x29, 0xF0, 0x7F, 0xFF, 0x02, 0xFD,
-    0xE0, 0x03, 0x1D, 0x00, 0x63, 0xC0, 0x09, 0x3C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x85, 0x50, 0x03, 0xFF, 0xFF, 0x01, 0xFD, 0x02, 0xC0, 0xBC, 0x00, 0x74, 0x3D, 0x00, 0x1C,
-    0x0F, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC3, 0xD0, 0x01, 0xE0, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x47,
-    0xC0, 0x0F, 0x80, 0x2C, 0x02, 0xF0, 0x02, 0xC0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0x80, 0xBC,
-    0x00, 0x78, 0x0F, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0xF0, 0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF0,
-    0x24, 0x00, 0x6F, 0xE0, 0x03, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0x9F, 0x80, 0x0F, 0x00, 0xBF, 0xFE,
-    0x40, 0x74, 0x00, 0xFB, 0xFF, 0xEB, 0x40, 0x1F, 0xAF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7E, 0x55, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x06, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x02, 0xFE, 0x03, 0xD7,
-    0xD0, 0xA0, 0x2F, 0xE4, 0x0C, 0x03, 0xEF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0xF5, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFE, 0xAE, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x50,
-    0x00, 0x7F, 0x90, 0x2E, 0x02, 0xFF, 0xFE, 0x07, 0xE7, 0xF4, 0x01, 0xC0, 0x7F, 0xFE, 0x50, 0x38,
-    0x02, 0xFB, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xE0, 0x3E, 0x54, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF9,
-    0x6B, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x07, 0xFD, 0x07, 0xDB, 0x80, 0xD0, 0x7F, 0xE4, 0x1C, 0x03, 0xAF, 0xFF, 0x02, 0xFF, 0xFF, 0xC0,
-    0xE5, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xFA, 0xAD, 0x00, 0xBF, 0xFF, 0x00,
-    0x06, 0xFF, 0x40, 0x00, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D,
-    0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0xC0,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0xF0, 0x1F, 0x80, 0x00, 0x3F,
-    0x03, 0xFE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x8B, 0xD0, 0x00, 0x00, 0x0B, 0xE3, 0xF2, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xBF,
-    0xE0, 0x00, 0x00, 0x3F, 0xEB, 0xF9, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xFF, 0x8F, 0xFC, 0x00, 0x07,
-    0xFE, 0x0F, 0xF4, 0x7F, 0xE0, 0x02, 0xFF, 0xC2, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x55, 0x01, 0x40, 0x00, 0xF8,
-    0x0F, 0xD0, 0x7C, 0x00, 0x07, 0xC1, 0xFC, 0x1F, 0x00, 0x00, 0x3E, 0x2F, 0x87, 0xC0, 0x00, 0x02,
-    0xF2, 0xF1, 0xF0, 0x00, 0x00, 0x0F, 0x7F, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xFB, 0xF4, 0x00, 0x01, 0xFE, 0x7F, 0x3F, 0xC0, 0x00,
-    0xBF, 0x8F, 0xF1, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x50, 0x00,
-    0x74, 0x0F, 0x80, 0x02, 0xC0, 0xBC, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x78, 0x7C, 0x00, 0x03, 0xD3,
-    0xC0, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0xBC, 0x1F, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x3C, 0x03,
-    0xE0, 0x00, 0xF0, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x40, 0x40, 0x1C, 0x3C, 0x03,
-    0x8B, 0x00, 0x35, 0xC0, 0x07, 0x74, 0x00, 0xFD, 0x00, 0x0F, 0xE4, 0x02, 0xC2, 0xE0, 0x3C, 0x0B,
-    0x07, 0x40, 0x70, 0xB0, 0x0B, 0x00, 0x01, 0xE0, 0x01, 0xBC, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x1F, 0x00, 0xF8,
-    0x00, 0x2F, 0x00, 0xF4, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x03, 0xD0,
-    0x00, 0xF4, 0x07, 0xC0, 0x01, 0xF0, 0x0B, 0xC0, 0x02, 0xE0, 0x0F, 0x80, 0x03, 0xD0, 0x1F, 0x40,
-    0x0B, 0xC0, 0x2F, 0x90, 0x7F, 0x80, 0x3F, 0xF0, 0xBE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x3F, 0xFD, 0x00, 0x38, 0x2C, 0x00, 0x74, 0x38, 0x00, 0xB0, 0x34, 0x00, 0xE0, 0xB0, 0x01, 0xD0,
-    0xF0, 0x02, 0xC0, 0xE0, 0x03, 0x81, 0xD0, 0x0B, 0x03, 0xF4, 0x3E, 0x03, 0xF0, 0x00, 0x02, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xE0,
-    0x3C, 0x00, 0x74, 0x0F, 0x00, 0x2C, 0x07, 0x80, 0x0F, 0x02, 0xD0, 0x07, 0xC0, 0xF0, 0x02, 0xE0,
-    0x3E, 0xAA, 0xF4, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xC0, 0x0F, 0x81, 0xF0, 0x03, 0xE0,
-    0xBC, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x02, 0xF8,
-    0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xE0,
-    0x2C, 0x00, 0x74, 0x0F, 0x00, 0x2D, 0x07, 0x80, 0x0F, 0x02, 0xD0, 0x03, 0xC0, 0xF0, 0x02, 0xE0,
-    0x3E, 0xAA, 0xF4, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0,
-    0xBC, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xC0,
-    0x00, 0x09, 0x00, 0x0A, 0x07, 0xC0, 0x03, 0xC2, 0xE0, 0x01, 0xF0, 0xF0, 0x00, 0xB8, 0x3C, 0x00,
-    0x3D, 0x0E, 0x00, 0x0F, 0x07, 0x40, 0x0B, 0xC1, 0xD0, 0x07, 0xD0, 0x3E, 0xAF, 0xF0, 0x07, 0xFE,
-    0xFC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x80, 0x00, 0x08,
-    0x01, 0x47, 0x00, 0xA2, 0x80, 0x34, 0xD0, 0x1C, 0x30, 0x0F, 0x1C, 0x0B, 0x83, 0xEF, 0xD0, 0xBE,
-    0xB0, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA0, 0x00, 0x02, 0xA0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE,
-    0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x0B,
-    0xFF, 0x00, 0x07, 0xEF, 0xC0, 0x3F, 0xBC, 0x00, 0x2F, 0x7F, 0x03, 0xF7, 0xF0, 0x00, 0xF8, 0xFD,
-    0x1F, 0x9F, 0x80, 0x07, 0xD3, 0xF4, 0xFC, 0xBD, 0x00, 0x2F, 0x0F, 0xEF, 0xD3, 0xF0, 0x00, 0xFC,
-    0x3F, 0xFE, 0x1F, 0xC0, 0x07, 0xF0, 0xBF, 0xF0, 0xFF, 0x00, 0x2F, 0x81, 0xFF, 0x43, 0xF8, 0x00,
-    0xFD, 0x07, 0xFC, 0x1F, 0xD0, 0x07, 0xF0, 0x0F, 0xC0, 0xFF, 0x40, 0x2F, 0xC0, 0x29, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x03,
-    0xE0, 0x1F, 0x80, 0x2F, 0x40, 0xFF, 0x01, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x1E, 0xF0, 0xBB, 0xC0,
-    0xF3, 0xC7, 0xDE, 0x03, 0xCF, 0x7C, 0xF4, 0x1E, 0x3F, 0xE3, 0xC0, 0xB4, 0xFF, 0x2F, 0x03, 0xC2,
-    0xF4, 0xFC, 0x1F, 0x07, 0x83, 0xE0, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x01, 0x90, 0x2D, 0x03, 0xC0, 0x3C, 0x07,
-    0xC0, 0xB8, 0x0F, 0x40, 0xF0, 0x1F, 0x02, 0xE0, 0x3D, 0x03, 0xC0, 0x7C, 0x0B, 0x80, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x74, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00,
-    0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x0C, 0x00, 0x00, 0x3C, 0x07, 0x80,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0xB8, 0x0B, 0xC0, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x74, 0x00, 0x78,
-    0x00, 0x0B, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x02, 0xF4, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xEF, 0x00, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x05, 0x41, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00,
-    0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0,
-    0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F,
-    0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x7E,
-    0x0F, 0xD0, 0x00, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF8, 0x90, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0x1E, 0x00, 0x3C,
-    0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x74, 0x00, 0x78, 0x00, 0x0B, 0x00, 0x0F, 0x80, 0x00, 0xF0,
-    0x02, 0xF4, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xEF, 0x00,
-    0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x87, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x07, 0xE5, 0x68, 0x00, 0x00, 0x00, 0x7C,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xAA, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEA, 0xA8, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x1B, 0xE2, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x1C, 0x00, 0x2E, 0x02, 0xFE, 0x00,
-    0x38, 0x01, 0xE0, 0x03, 0xE0, 0x16, 0xE0, 0x0F, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x74, 0x00, 0x7F,
-    0xAA, 0x54, 0x02, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3E, 0x07,
-    0xFF, 0x40, 0x04, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x01, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFE, 0x5E, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xB0, 0x00, 0x78, 0x07,
-    0x40, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFA, 0xAA, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFA, 0xAA,
-    0x80, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x0B, 0x90, 0xB0, 0x00, 0xB4, 0x00, 0xD0, 0x07, 0x80, 0x5B, 0x40, 0x3F, 0xFF, 0xFE,
-    0x01, 0xFE, 0xA9, 0x50, 0x0B, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x10, 0x01,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x2F,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x00, 0x10, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x78,
-    0x05, 0x6A, 0xBF, 0x02, 0xFF, 0xFF, 0xF0, 0x2E, 0x50, 0x2D, 0x01, 0xC0, 0x07, 0x40, 0x0D, 0x07,
-    0xE0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0xD0, 0x14, 0x06, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x05, 0xF0,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xE9, 0x7C, 0x0D, 0x00, 0x2D, 0x03, 0x40, 0x2E, 0x00, 0x79, 0xBD, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x3E, 0x03, 0xD0,
-    0x00, 0x1F, 0x82, 0xF0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9,
-    0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x15, 0xAA, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0B,
-    0x94, 0x0B, 0x40, 0x01, 0xC0, 0x07, 0x40, 0x00, 0x34, 0x1F, 0x80, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x40,
-    0x14, 0x06, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x17, 0xC0, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFA, 0x5F, 0x00, 0xD0, 0x02, 0xD0, 0x0D, 0x00, 0xB8, 0x00, 0xF9, 0xBF, 0x00, 0x2F,
-    0xFF, 0xE0, 0x03, 0xF0, 0x7D, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x2F, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xFE, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x8B,
-    0xD0, 0x00, 0x00, 0x0B, 0xE3, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x7E, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xEB, 0xF9,
-    0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xFF, 0x8F, 0xFC, 0x00, 0x07, 0xFE, 0x0F, 0xF4, 0x7F, 0xE0, 0x02,
-    0xFF, 0xC2, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-    0x80, 0x00, 0x00, 0x1F, 0x82, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-    0xE0, 0x7C, 0x00, 0x07, 0xC1, 0xFC, 0x1F, 0x00, 0x00, 0x3D, 0x2F, 0x87, 0xC0, 0x00, 0x02, 0xF2,
-    0xF5, 0xF4, 0x00, 0x00, 0x1F, 0x3F, 0x7D, 0x00, 0x00, 0x00, 0xFB, 0xEF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xFB, 0xF4, 0x00, 0x01, 0xFE, 0x7F, 0x3F, 0xC0, 0x00, 0xBF,
-    0x8F, 0xF1, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x3D,
-    0x0B, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAE, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x50, 0x0B, 0x80, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x6A, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0xF0, 0x02, 0x00, 0x2F,
-    0x80, 0x1F, 0xEF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x3E, 0x0B, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x05, 0x40, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x10, 0x24, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x41, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x2F, 0xE4, 0x00,
-    0x00, 0x00, 0xAA, 0xA9, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xE0,
-    0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x01, 0xF0, 0x05, 0x03, 0xE0, 0x2F, 0xEF, 0xD0, 0x2F, 0xFF, 0x80, 0x07, 0xF9, 0x00, 0x00, 0xAA,
-    0xA9, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40,
-    0x00, 0xBE, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x05,
-    0x07, 0xE0, 0x3F, 0xAF, 0xC0, 0x3F, 0xFF, 0x40, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x80,
-    0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x01, 0xFC, 0x00, 0xBC, 0x00, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0x80, 0x0F,
-    0xFC, 0x00, 0xBC, 0x00, 0xBF, 0xF0, 0x03, 0xF0, 0x07, 0xEF, 0x40, 0x0F, 0x80, 0x7E, 0xBC, 0x00,
-    0x7D, 0x03, 0xE3, 0xF0, 0x02, 0xF0, 0x3F, 0x1F, 0x80, 0x0F, 0xC2, 0xF0, 0xBD, 0x00, 0x7E, 0x2F,
-    0x43, 0xF0, 0x02, 0xF5, 0xF4, 0x1F, 0xC0, 0x0F, 0xDF, 0x80, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xF4,
-    0x01, 0xFF, 0xC0, 0x1F, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x03, 0xF8, 0x00, 0x00,
-    0x05, 0x5A, 0xA4, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x0F, 0xC0, 0x2C, 0x00, 0xFE, 0x00, 0xF0, 0x0B, 0xB4, 0x07, 0x80, 0xB6,
-    0xC0, 0x2D, 0x0B, 0x4F, 0x00, 0xF0, 0xB4, 0x38, 0x03, 0xCB, 0x82, 0xD0, 0x1E, 0xB8, 0x0F, 0x00,
-    0xBF, 0x80, 0x3C, 0x03, 0xF8, 0x02, 0xE0, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x03, 0xC0,
-    0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x15, 0x01, 0x50, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03,
-    0xFD, 0x00, 0x3E, 0x00, 0x2F, 0xF0, 0x01, 0xF4, 0x02, 0xFF, 0xC0, 0x0F, 0xC0, 0x1F, 0xBE, 0x00,
-    0x3E, 0x00, 0xFA, 0xF4, 0x01, 0xF4, 0x0F, 0xCF, 0xC0, 0x0B, 0xC0, 0xFC, 0x7E, 0x00, 0x3F, 0x0B,
-    0xC2, 0xF4, 0x00, 0xF8, 0xBD, 0x0F, 0xC0, 0x0B, 0xD7, 0xE0, 0x7F, 0x00, 0x3F, 0x7E, 0x03, 0xF8,
-    0x00, 0xFF, 0xF0, 0x0F, 0xD0, 0x07, 0xFF, 0x00, 0x7F, 0x00, 0x2F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x3E, 0x0B, 0xC0, 0x02, 0xF4, 0x3F, 0x00,
-    0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x3F, 0x00, 0xB0,
-    0x03, 0xF8, 0x03, 0xC0, 0x2E, 0xD0, 0x1E, 0x02, 0xDB, 0x00, 0xB4, 0x2D, 0x3C, 0x03, 0xC2, 0xD0,
-    0xE0, 0x0F, 0x2E, 0x0B, 0x40, 0x7A, 0xE0, 0x3C, 0x02, 0xFE, 0x00, 0xF0, 0x0F, 0xE0, 0x0B, 0x80,
-    0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x54, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x07, 0xE0,
-    0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x02, 0xE0, 0x03, 0xF0, 0x3E, 0x00,
-    0x7E, 0x0B, 0xD0, 0x05, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x1F, 0x9B, 0xC0, 0x03, 0xD0, 0x1E, 0x00, 0xF4, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x02, 0xD0,
-    0x00, 0xE0, 0x3C, 0x00, 0x2D, 0x03, 0xC0, 0x07, 0xC0, 0x3E, 0x46, 0xF8, 0x02, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x07, 0xF9, 0x6F, 0xD0, 0x07, 0xE0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x2F,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xFD, 0x55, 0xAB, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x2F, 0x00, 0x00,
-    0x7D, 0x0B, 0xC0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x7F, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x03, 0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x0B,
-    0x41, 0xFF, 0xFF, 0xF4, 0x2E, 0x00, 0x0F, 0x02, 0xD0, 0x02, 0xE0, 0x2F, 0x00, 0xBC, 0x01, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x2F,
-    0x03, 0xE0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFE, 0x5B, 0xF4, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x02, 0xF0, 0x3F, 0x55, 0x6A, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFE, 0x0B, 0xC0, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x1F, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x3D, 0x07, 0xC0, 0x02, 0xF4, 0x3F, 0x00,
-    0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0xF0, 0x02, 0xE0, 0x01,
-    0xE0, 0x0F, 0x00, 0x0B, 0x40, 0x7F, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0xF0, 0x0B, 0x40, 0x0B, 0x80,
-    0x2F, 0x00, 0xBC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0xF4, 0x1F, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x15, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0xBE, 0xBF, 0xC0, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x02, 0xD0, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xB8, 0x00, 0x2F, 0x80,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x7D, 0x0F, 0xC0, 0x3F, 0x07,
-    0xF0, 0x05, 0x41, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x2D, 0x02,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x01, 0x57, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7D, 0x0B, 0x55, 0xFE, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x56, 0xA8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x3D,
-    0x00, 0xF4, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x0F,
-    0x8F, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2B, 0xFE,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x06, 0xAA, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C,
-    0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F,
-    0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x05, 0x41, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0xF4, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x0F,
-    0x8F, 0x40, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2B, 0xFE,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x02,
-    0xF0, 0x3D, 0x00, 0x03, 0xE0, 0xBD, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E,
-    0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x2F, 0x00,
-    0x0A, 0x40, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00,
-    0x2E, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x02, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x02, 0xD0, 0x00, 0x07, 0xC0,
-    0x0F, 0x00, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x3E, 0x00,
-    0x00, 0x02, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x03, 0xE0,
-    0x3D, 0x00, 0x7E, 0x0B, 0xC0, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x38, 0x0B, 0x00, 0x07, 0x40, 0xF0, 0x00, 0xF0, 0x0E, 0x00, 0x0F,
-    0x01, 0xD0, 0x01, 0xE0, 0x3C, 0x00, 0x3D, 0x03, 0xC0, 0x07, 0xC0, 0x3C, 0x01, 0xFC, 0x03, 0xE5,
-    0xBF, 0x80, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0x8F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0xB8, 0x3F, 0x03, 0xE1, 0xFC, 0x2F, 0x45,
-    0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x20, 0x0D, 0x01, 0xC0, 0x30, 0x0B, 0x01,
-    0xC0, 0x38, 0x0A, 0x01, 0xD0, 0x38, 0x0F, 0x00, 0xBA, 0xFC, 0x00, 0xFD, 0xE0, 0x00, 0x07, 0x40,
-    0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFA, 0xAA, 0x90, 0x0B, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x02, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x01,
-    0x50, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7D, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x38, 0x00,
-    0x00, 0x0F, 0xC0, 0x1D, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xC0, 0x00,
-    0x00, 0xBC, 0x01, 0xF5, 0x40, 0x00, 0x3E, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0x40, 0x3C, 0x01, 0xE0,
-    0x0B, 0xC0, 0x0F, 0x00, 0x2C, 0x03, 0xF0, 0x07, 0x80, 0x0B, 0x00, 0xF8, 0x02, 0xD0, 0x03, 0xC0,
-    0xBD, 0x00, 0xF0, 0x07, 0xE0, 0x3F, 0x00, 0x3E, 0xAF, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF, 0xF4, 0x0B,
-    0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14,
-    0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x07, 0xC0,
-    0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0x80, 0xF4, 0x00, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0xB0, 0x1F,
-    0xFF, 0x80, 0x3C, 0x0B, 0x80, 0x3C, 0x1E, 0x03, 0xD0, 0x07, 0x0B, 0x40, 0xF0, 0x02, 0xC3, 0xC0,
-    0x3C, 0x07, 0xE0, 0xF0, 0x1F, 0xFF, 0xF0, 0xB8, 0x0B, 0xFF, 0xE0, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x05, 0x40, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x07,
-    0xC0, 0x00, 0x07, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD7, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x10, 0x0B, 0xF4, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x00, 0x1C, 0x00, 0x74, 0x07, 0x40,
-    0x03, 0xC1, 0xD0, 0x00, 0x2D, 0x74, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0x3E, 0x00, 0x07, 0xC2, 0xF0, 0x01, 0xF4, 0x0F, 0x40, 0x7D,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x09, 0x00, 0x90, 0x01, 0xC0, 0x0C, 0x00, 0x2C, 0x02, 0xC0, 0x03, 0x80, 0x38, 0x00,
-    0x34, 0x03, 0x40, 0x07, 0x00, 0x70, 0x00, 0xA0, 0x0A, 0x00, 0x0D, 0x00, 0xD0, 0x01, 0xC0, 0x1C,
-    0x00, 0x2C, 0x02, 0xC0, 0x03, 0x80, 0x38, 0x00, 0x30, 0x03, 0x00, 0x0B, 0x00, 0xB0, 0x00, 0xE0,
-    0x0E, 0x00, 0x0D, 0x00, 0xD0, 0x01, 0xC0, 0x1C, 0x00, 0x28, 0x02, 0x80, 0x03, 0x40, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x03, 0xF4, 0x2F,
-    0xC0, 0xFD, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F,
-    0x02, 0xF8, 0x00, 0x7F, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x7F, 0x1F,
-    0xC0, 0x3F, 0x4F, 0xD0, 0x1F, 0xCB, 0xE0, 0x0F, 0xC3, 0xF0, 0x07, 0xE1, 0xF8, 0x03, 0xF4, 0xFC,
-    0x03, 0xF4, 0xFC, 0x0B, 0xF2, 0xF8, 0x0F, 0xD3, 0xF0, 0x1F, 0x87, 0xE0, 0x3F, 0x0F, 0xC0, 0x7E,
-    0x2F, 0x80, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x7F, 0x1F, 0xC0,
-    0x3F, 0x8F, 0xE0, 0x0F, 0xC3, 0xF0, 0x0B, 0xD2, 0xF4, 0x03, 0xF0, 0xFC, 0x02, 0xF4, 0xBD, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00, 0x0A, 0xBE, 0xAC, 0x3F, 0xFF, 0xFC, 0x00, 0x74, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x03,
-    0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x6B, 0xEA, 0x90,
-    0x2F, 0xFF, 0xFD, 0x00, 0x03, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x2E, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x2A,
-    0xB8, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x34, 0x02, 0xF8, 0x0F, 0xFC,
-    0x3F, 0x80, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x3E, 0x7E, 0xBE, 0x05, 0x3E, 0x7E, 0xBE, 0x05, 0x00,
-    0x14, 0x00, 0x50, 0xF8, 0x01, 0xF0, 0x0B, 0xC7, 0xE0, 0x0F, 0xC0, 0x3F, 0x2F, 0x80, 0x7F, 0x02,
-    0xF8, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x40, 0x03, 0x40, 0x08, 0x20, 0x03,
-    0x80, 0x02, 0x48, 0x02, 0x80, 0x01, 0x85, 0x02, 0xC0, 0x00, 0x77, 0x01, 0xC0, 0x00, 0x0F, 0x41,
-    0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x75, 0x51, 0x40, 0x00, 0x78, 0x85, 0x10, 0x00,
-    0x3C, 0x55, 0x94, 0x00, 0x3C, 0x26, 0x32, 0x00, 0x3C, 0x07, 0x8B, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0xFC, 0x0B,
-    0xF2, 0xF8, 0x0F, 0xD3, 0xF0, 0x1F, 0x87, 0xE0, 0x3F, 0x0F, 0xC0, 0x7E, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x0D, 0x02, 0x43, 0xD0, 0x78, 0x1F, 0x0F, 0x02, 0xC0, 0xB4, 0x74, 0x0E, 0x03,
-    0xC2, 0x80, 0x70, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x3C, 0x2C, 0x0D, 0x0A, 0x00,
-    0x00, 0x00, 0x0B, 0x07, 0x03, 0xC2, 0xE0, 0x74, 0x3C, 0x0E, 0x0B, 0x01, 0xC0, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x28, 0x06, 0x03, 0xC0, 0xF0, 0x2E, 0x0B, 0x02, 0xD0, 0x3C, 0x0D,
-    0x03, 0x80, 0xB0, 0x28, 0x07, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0x00,
-    0xB7, 0xC0, 0xF0, 0x7C, 0x00, 0x04, 0x00, 0xD0, 0x1E, 0x03, 0xD0, 0x7C, 0x03, 0xF0, 0x07, 0xE0,
-    0x07, 0xD0, 0x0B, 0x00, 0x08, 0x00, 0x10, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x7C,
-    0x00, 0x3D, 0x00, 0xFC, 0x02, 0xF0, 0x02, 0xD0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x3D, 0x1A, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF6, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xEB, 0xFF, 0xD0, 0x00, 0x50, 0x00, 0x1F, 0x4F, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xBD,
-    0x3F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0x57, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x78, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x07, 0xFF, 0xF4,
-    0x01, 0xF7, 0xDF, 0xC0, 0x04, 0x78, 0x3D, 0x00, 0x0B, 0x43, 0xD0, 0x00, 0xF0, 0x3C, 0x00, 0x0F,
-    0x07, 0xC0, 0x01, 0xF0, 0xF4, 0x00, 0x2E, 0x3F, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x34, 0x00, 0xC3, 0x80, 0x78, 0x2F, 0xFE, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xD5, 0x60, 0x00, 0x00, 0xB9, 0x00, 0x00,
-    0x06, 0xF8, 0x00, 0x00, 0xA2, 0x20, 0x00, 0x00, 0x14, 0x00, 0x00, 0x24, 0x00, 0xC0, 0x08, 0xC6,
-    0xB3, 0x64, 0x2F, 0x90, 0x7D, 0x00, 0x7E, 0x06, 0xED, 0x0E, 0x9B, 0x23, 0x14, 0x02, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x0A, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xC0, 0x0F, 0x41, 0xFC, 0x2E, 0x41, 0xF8, 0x01, 0x00, 0x0F, 0x41, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0x54, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x78, 0x03, 0xF0, 0x2C, 0x01, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00, 0xF4, 0x38, 0x00,
-    0x00, 0x0F, 0x0B, 0x40, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x0F, 0x82,
-    0xE0, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x02, 0xF8, 0x07, 0xC0, 0x03, 0xFD, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0,
-    0x00, 0xA4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0xF8, 0x00, 0x2F, 0x00,
-    0x3F, 0x40, 0x03, 0xE0, 0x07, 0xF4, 0x00, 0xBE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x40,
-    0xBD, 0x00, 0x00, 0xB1, 0x00, 0x0F, 0x80, 0x00, 0x38, 0x00, 0x02, 0xE0, 0x00, 0x1D, 0x00, 0x00,
-    0xF4, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xE0, 0x00, 0x3F,
-    0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3C, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x01, 0xFE, 0x00,
-    0x00, 0x0F, 0x80, 0xFD, 0x00, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00,
-    0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x02, 0x90, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02,
-    0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x00, 0x00,
-    0x00, 0x1F, 0x47, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x01, 0x51, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x40, 0x00, 0x00, 0x02, 0xE3, 0xE0, 0x00, 0x00, 0x00,
-    0xF1, 0xF8, 0x00, 0x00, 0x00, 0xB4, 0xFD, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60,
-    0x09, 0x08, 0x0C, 0x88, 0x19, 0x64, 0x24, 0x30, 0x28, 0xB0, 0x2F, 0xD0, 0x0A, 0x40, 0x00, 0x00,
-    0x0C, 0x02, 0xC0, 0x9C, 0x22, 0x8B, 0xFD, 0x57, 0x40, 0x70, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xA8,
-    0x09, 0x00, 0x0C, 0x00, 0x0F, 0xE0, 0x00, 0x30, 0x00, 0xB0, 0x3F, 0xD0, 0x19, 0x00, 0x01, 0xBC,
-    0x06, 0x00, 0x0E, 0xA0, 0x1D, 0x34, 0x28, 0x24, 0x28, 0x70, 0x1F, 0xD0, 0x01, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0xD0, 0x1C, 0x03, 0x40, 0x70, 0x0E, 0x02, 0xC0, 0x38, 0x00, 0x01, 0x68, 0x06, 0x0C,
-    0x06, 0x28, 0x03, 0xE0, 0x0C, 0x30, 0x34, 0x34, 0x38, 0x70, 0x1F, 0xD0, 0x02, 0xB4, 0x09, 0x0C,
-    0x0C, 0x0C, 0x0C, 0x2C, 0x0B, 0xF8, 0x00, 0x34, 0x15, 0xB0, 0x3F, 0x80, 0x00, 0x20, 0x69, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x03, 0xC0, 0x3D, 0x00,
-    0x7C, 0x03, 0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF0, 0x2F,
-    0x40, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x14, 0x00, 0x28, 0x30, 0x0A, 0x02, 0x41, 0xC5, 0x24,
-    0x28, 0xE3, 0x43, 0x8C, 0x70, 0x34, 0x0F, 0x07, 0x82, 0xD0, 0x3E, 0xFC, 0x03, 0xFF, 0x40, 0x1F,
-    0x80, 0x00, 0x00, 0x40, 0x7C, 0x02, 0x80, 0x34, 0x03, 0x00, 0x60, 0x0D, 0x0B, 0xFC, 0x55, 0x40,
-    0x06, 0xE0, 0x20, 0xA0, 0x02, 0x80, 0x0D, 0x00, 0xE0, 0x1E, 0x02, 0xE0, 0x1F, 0xF4, 0x55, 0x40,
-    0x02, 0x90, 0x00, 0x50, 0x01, 0x40, 0x04, 0x07, 0xD0, 0x01, 0xC0, 0x0A, 0x1F, 0xF0, 0x19, 0x00,
-    0x00, 0x10, 0x01, 0xC0, 0x1E, 0x01, 0xA4, 0x1C, 0xD0, 0xFF, 0xC0, 0x2C, 0x00, 0xE0, 0x00, 0x00,
-    0x2A, 0x80, 0x80, 0x07, 0xA0, 0x00, 0x90, 0x03, 0x42, 0xBC, 0x1F, 0x80, 0x02, 0xF8, 0x24, 0x01,
-    0xA9, 0x0F, 0x0C, 0x30, 0x30, 0xC2, 0x82, 0xFC, 0x01, 0x40, 0xBE, 0x80, 0x1C, 0x02, 0x40, 0x70,
-    0x0E, 0x01, 0xC0, 0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x50, 0x02, 0x18, 0x0C, 0x08, 0x0D, 0x34,
-    0x07, 0xD0, 0x28, 0x30, 0x70, 0xB0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xA0, 0x09, 0x28, 0x0C, 0x18,
-    0x18, 0x28, 0x18, 0x34, 0x0F, 0xF0, 0x00, 0x70, 0x3F, 0xC0, 0x15, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x0E, 0x00, 0x00, 0x00, 0x3C, 0x2C, 0x00, 0x00, 0x00, 0x74, 0x78, 0x00, 0x00,
-    0x00, 0xF0, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0x9B, 0xA0, 0x00, 0x03, 0xFE, 0x0F, 0x00, 0x00, 0x0F, 0xFC, 0x1D, 0x00, 0x00, 0x3F, 0x78, 0x3C,
-    0x00, 0x00, 0x7D, 0xB0, 0xB4, 0x00, 0x00, 0xFC, 0xE0, 0xF0, 0x00, 0x01, 0xF7, 0xC2, 0xC0, 0x00,
-    0x03, 0xF7, 0x83, 0x80, 0x00, 0x03, 0xFF, 0x0B, 0x00, 0x00, 0x07, 0xFD, 0x0E, 0x00, 0x00, 0x07,
-    0xFD, 0x2C, 0x04, 0x00, 0x07, 0xFF, 0xFE, 0xBC, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xAF, 0xFF, 0xA0, 0x00, 0x0F, 0x0F, 0x00,
-    0x00, 0x00, 0x2C, 0x1D, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x66, 0x80, 0x0F, 0xC0, 0x0F, 0xFC, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x1F, 0xD0, 0x1D, 0x00,
-    0x01, 0xFF, 0x03, 0xC1, 0x00, 0x1F, 0xFF, 0xBE, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x07, 0xE0, 0x07, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0x80,
-    0x00, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x7D, 0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x02, 0xF6, 0xF0, 0x0F, 0xC0, 0x00,
-    0xFC, 0xBD, 0x07, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xD0, 0xFC, 0x7D, 0x00, 0x07, 0xF0, 0x2F, 0x2F, 0x00, 0x02, 0xFC, 0x07, 0xDF, 0xC0, 0x00, 0xFE,
-    0x01, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x00,
-    0x2F, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x5B, 0xE5, 0x57, 0xF4, 0x00,
-    0x7C, 0x01, 0xBD, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xEA, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0E,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xBC, 0x00, 0x0B, 0xF8, 0x03,
-    0xFF, 0xF8, 0x00, 0x2E, 0xA4, 0x03, 0xFF, 0xE0, 0x00, 0x30, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x70,
-    0x00, 0x0B, 0xE6, 0xF0, 0x00, 0x78, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0xF0,
-    0x00, 0x0B, 0xE0, 0x1F, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x2F, 0x01, 0xF0, 0x00, 0x40, 0xF0, 0x3E,
-    0x02, 0xF0, 0x02, 0xFF, 0xE0, 0x3E, 0x03, 0xF0, 0x07, 0xFF, 0xD0, 0x7D, 0x03, 0xF0, 0x02, 0xFF,
-    0x40, 0x00, 0xD0, 0x00, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x34, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x1D,
-    0x00, 0x00, 0xF0, 0x01, 0xD0, 0x00, 0x0E, 0x00, 0x1D, 0x07, 0x02, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xD3, 0xF8, 0x74, 0x00, 0x2D, 0x7F, 0x8F, 0x00, 0x02, 0xCB,
-    0x7C, 0xE0, 0x00, 0x2D, 0xF3, 0xDD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xC3, 0xFC, 0x00,
-    0x02, 0xFC, 0x3F, 0x80, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x3E, 0x02,
-    0xE0, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0xAF, 0xC0,
-    0x1E, 0x01, 0xF0, 0x02, 0xE0, 0x2D, 0x02, 0xD0, 0x00, 0xF0, 0x3C, 0x03, 0xC0, 0x00, 0xE0, 0x3C,
-    0x03, 0xC1, 0x80, 0xE0, 0x78, 0x07, 0x82, 0xC1, 0xD0, 0xB0, 0x0F, 0x03, 0xC2, 0xC0, 0xF0, 0x0F,
-    0x03, 0x82, 0xC1, 0xE0, 0x1E, 0x07, 0x40, 0x02, 0xD0, 0x2D, 0x07, 0x40, 0x03, 0xC0, 0x3C, 0x07,
-    0x80, 0x07, 0xC0, 0x3C, 0x03, 0xF5, 0x6F, 0x80, 0x24, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x06,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x2A, 0xFA, 0x40, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x1C, 0x00, 0x01, 0xBC, 0xB0, 0x00, 0x2F, 0xFF, 0x80, 0x01, 0xD0, 0x7D, 0x00,
-    0x0D, 0x00, 0xF0, 0x00, 0xB0, 0x07, 0x80, 0x03, 0x80, 0x3D, 0x00, 0x0F, 0x02, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x69, 0x14, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x09, 0xBE,
-    0xA4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x7F, 0xFA, 0x90, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x02, 0xF1, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0x90, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x02, 0x9F, 0xDA, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3D, 0x00, 0x1F, 0x00, 0x02, 0xAF, 0xEA, 0xAF, 0xEA, 0x40, 0x0B, 0xC0, 0x1F, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xA9, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x6B, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xE6, 0xC0, 0x10, 0x07, 0xF4, 0x38, 0x00, 0x00, 0xFD,
-    0x03, 0x40, 0x00, 0x2F, 0x80, 0x70, 0x00, 0x03, 0xF0, 0x0B, 0x00, 0x00, 0x7E, 0x00, 0xE0, 0x00,
-    0x0B, 0xD0, 0x0E, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xA5, 0x0F, 0xC0, 0x1F, 0xFF, 0xE0, 0xFC, 0x02,
-    0xC0, 0xF9, 0x1F, 0xC0, 0x38, 0x1F, 0x01, 0xFE, 0x03, 0x47, 0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2A, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x01, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x1C, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0xF4, 0x0F, 0xDC, 0x00, 0x7C, 0xB0, 0x03, 0xC3, 0x80, 0x1F,
-    0x0D, 0x00, 0xB8, 0x70, 0x03, 0xE2, 0xC0, 0x0F, 0xCE, 0x00, 0x2F, 0xFA, 0x00, 0x3F, 0xFE, 0x00,
-    0x2F, 0xF8, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x07, 0xFF, 0xFE, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x05, 0x5B, 0x54, 0x1F,
-    0xFF, 0xF8, 0x00, 0x2D, 0x00, 0x16, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC1, 0x80, 0x00, 0xFF, 0xE0,
-    0x01, 0xFF, 0x90, 0x03, 0xFD, 0x00, 0x01, 0x9F, 0x0A, 0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFD, 0x00,
-    0x0F, 0xF4, 0x03, 0x86, 0x7C, 0x07, 0xC0, 0x1E, 0x0B, 0xC0, 0x0B, 0xFF, 0x40, 0x03, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xDF, 0x40, 0x02, 0xF3, 0x8B, 0x40,
-    0x03, 0xC3, 0x47, 0x40, 0x07, 0x87, 0x07, 0x00, 0x0B, 0x0B, 0x0B, 0x00, 0x0F, 0x0E, 0x0E, 0x00,
-    0x0E, 0x0D, 0x0D, 0x00, 0x1D, 0x1C, 0x1C, 0x00, 0x2C, 0x2C, 0x3C, 0x00, 0x3C, 0x38, 0x38, 0x00,
-    0x3C, 0x34, 0x74, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x0B,
-    0x80, 0x00, 0x7C, 0x01, 0xBD, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xA9, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x00, 0x1B, 0x83, 0x46, 0xFF, 0x83, 0xFF, 0xE4,
-    0x02, 0xF9, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x0B, 0xFB, 0xC0, 0x07, 0xDB, 0x1F, 0x02, 0xE0, 0xF0, 0xB8, 0x34, 0x0E, 0x02, 0x40, 0x01, 0xD0,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x80,
-    0xF9, 0x00, 0x70, 0x1B, 0xFE, 0x4B, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x10, 0x0F, 0x00, 0x03, 0xD0, 0xB0, 0x2C, 0x0B, 0x87, 0x4B, 0x80, 0x1F, 0x79,
-    0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00,
-    0x03, 0x80, 0x0D, 0x06, 0xF7, 0xE4, 0x0D, 0x03, 0xDB, 0xF8, 0x06, 0xFE, 0xB0, 0x7F, 0x90, 0x00,
-    0x01, 0xBF, 0x8B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x80, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0C, 0x00, 0x02, 0xFC, 0x00, 0x3F,
-    0xBC, 0x07, 0x8D, 0x78, 0xB0, 0x70, 0x70, 0x02, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x30, 0x00, 0x01,
-    0xC0, 0x00, 0x0A, 0x00, 0x00, 0x10, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x28, 0x00, 0xB0, 0x70, 0x70, 0xB4, 0xC3, 0x80, 0x3B, 0xBC, 0x00, 0x2F, 0xC0,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xE0, 0x6B, 0xFE, 0x90, 0xFE, 0x40, 0x00, 0xFF,
-    0x80, 0x00, 0xF2, 0xF8, 0x00, 0xB0, 0x2F, 0x40, 0xB0, 0x07, 0xF0, 0xB0, 0x00, 0x7D, 0x60, 0x00,
-    0x04, 0x07, 0x94, 0x00, 0x00, 0xAF, 0xFE, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0x8B, 0x00, 0x3F, 0x43, 0xC0, 0xBD, 0x00, 0xF0, 0xF8, 0x00, 0x3C, 0x10, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xD0, 0x08, 0x0F, 0x00, 0xC0, 0x74, 0x1C, 0x03, 0xC2,
-    0x80, 0x1D, 0x34, 0x00, 0xF3, 0x00, 0x07, 0xB0, 0x64, 0x3E, 0x0F, 0xFF, 0xD0, 0x05, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x2C, 0x08, 0x00, 0xE0, 0x34, 0x0B, 0x00, 0xA0, 0x38,
-    0x01, 0xC2, 0xC0, 0x03, 0x0E, 0x00, 0x0D, 0xB0, 0x00, 0x2F, 0x80, 0x00, 0x7D, 0x16, 0x00, 0xFF,
-    0xFC, 0x03, 0xE9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0xB4, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xB0, 0xA0,
-    0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x01, 0xF3, 0x0B, 0x3C, 0x01, 0xF0, 0xC3,
-    0x4B, 0x82, 0xE0, 0xA0, 0xC0, 0xF4, 0x90, 0x34, 0x70, 0x08, 0x00, 0x0C, 0x28, 0x00, 0x00, 0x07,
-    0x0D, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x30, 0xA0, 0x00, 0x00,
-    0x18, 0x34, 0x00, 0x00, 0x09, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB8, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x80, 0x00,
-    0x00, 0x28, 0x30, 0x00, 0x00, 0x07, 0x0D, 0x00, 0x00, 0x00, 0xC2, 0x80, 0x00, 0x00, 0x24, 0x70,
-    0x00, 0x00, 0x06, 0x0D, 0x00, 0x00, 0x00, 0xC3, 0x80, 0x00, 0x40, 0x30, 0x70, 0x00, 0x3C, 0x09,
-    0x0C, 0x0B, 0x03, 0xD1, 0x83, 0x47, 0xC0, 0x2E, 0x30, 0xA3, 0xC0, 0x02, 0xFD, 0x1F, 0xD0, 0x00,
-    0x1F, 0x83, 0xD0, 0x00, 0x00, 0xF0, 0xE0, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x00, 0x1D, 0x00,
-    0x2C, 0x00, 0x00, 0x03, 0xC0, 0x1D, 0x00, 0x00, 0x00, 0x74, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7C, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0x7E, 0x40, 0x0B,
-    0x4D, 0xFD, 0x0B, 0xC3, 0x0B, 0x0B, 0xF0, 0xC0, 0x07, 0xDC, 0x30, 0x00, 0x43, 0x0C, 0x00, 0x00,
-    0xC3, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x03, 0x0C, 0x00, 0x00, 0xC3, 0x00, 0x1F,
-    0x30, 0xC0, 0x02, 0xFC, 0x30, 0x00, 0x2F, 0x0C, 0x18, 0x02, 0xD3, 0x7F, 0x40, 0x3D, 0xFD, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x80, 0x01, 0x64, 0x1C,
-    0x00, 0x7F, 0xF8, 0xF0, 0x07, 0xD0, 0xB7, 0x40, 0x3C, 0x00, 0xFC, 0x02, 0xE0, 0x03, 0xD0, 0x0F,
-    0x00, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF4, 0x07, 0xC0, 0x03, 0xFE, 0xFD, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x3C, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x90, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x7E, 0x00, 0x1E, 0x3E, 0x00, 0x0F, 0xC0, 0x07,
-    0x83, 0xE0, 0x00, 0xF4, 0x01, 0xE0, 0x3D, 0x00, 0x2F, 0x00, 0xB8, 0x03, 0xD0, 0x03, 0xE0, 0x2D,
-    0x00, 0xBC, 0x00, 0x3E, 0x0B, 0x40, 0x0F, 0x80, 0x03, 0xE3, 0xD0, 0x02, 0xF4, 0x00, 0x3F, 0xF0,
-    0x00, 0xBF, 0x00, 0x03, 0xFF, 0x56, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xEB, 0xFF, 0xFF, 0x80, 0x00, 0x78, 0x1B, 0xFF, 0x80, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFA, 0xE0, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xC1, 0xF0,
-    0x00, 0x0F, 0x81, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0xBD, 0x2F, 0x40, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0x00, 0xF4, 0x00,
-    0x78, 0x03, 0xC0, 0x02, 0xD0, 0x1E, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x3C, 0x03, 0xC0, 0x02, 0xE0,
-    0x0F, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x3C, 0x02, 0xD0, 0x01, 0xE0, 0x0F, 0x00, 0x0B, 0x40, 0x3C,
-    0x00, 0x3C, 0x01, 0xE0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0x80, 0x3C, 0x00, 0x00, 0x64, 0x02, 0x80,
-    0x01, 0xE0, 0x0F, 0x00, 0x03, 0xC0, 0x2D, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x2E, 0x00, 0xF0, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0xF0, 0x0B, 0x40, 0x02, 0xD0, 0x1E, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x0F,
-    0x00, 0xF0, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0xB4, 0x07, 0xC0, 0x01, 0xE0, 0x0F, 0x00, 0x1B, 0xD5,
-    0x7E, 0x40, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x55, 0x50, 0x0B, 0xFF, 0xFD, 0x00, 0xB0, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5A,
-    0xA0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x80, 0x2E, 0x00, 0x07, 0xFF, 0xC7, 0xFF, 0x00,
-    0x3E, 0x07, 0xBD, 0x0D, 0x02, 0xD0, 0x0B, 0xC0, 0x28, 0x0E, 0x00, 0x2D, 0x00, 0x90, 0x74, 0x00,
-    0xB0, 0x03, 0x01, 0xC0, 0x03, 0xD0, 0x3C, 0x0B, 0x40, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xEF, 0xFE,
-    0x00, 0x3F, 0xFD, 0x2F, 0xD0, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x7D, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0x0F, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x01,
-    0x80, 0x7C, 0x3C, 0x1E, 0x02, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x24, 0x0B, 0x8B, 0x01, 0xD0, 0x3C, 0x0F, 0x5F, 0x01, 0x90, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xEA, 0x80, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x06, 0x96, 0xD0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x16, 0xF9,
-    0xAA, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F,
-    0xFC, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA5, 0x00, 0x00, 0x02,
-    0xBF, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x5A, 0xBC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x1B, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0x80, 0x1A, 0xFF, 0xFF, 0xE4, 0x07, 0xEA, 0x50, 0x00, 0x00,
+static const uint8_t opendyslexic_10_italicBitmaps[25588] = {
+    0x6D, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x27, 0xB9, 0x8D, 0xD8, 0x5C, 0xC6, 0x0D,
+    0x08, 0x61, 0xE1, 0x6D, 0x0D, 0xCA, 0x79, 0x53, 0xB8, 0x30, 0xE2, 0xEC, 0x1B, 0xA0, 0xA0, 0xA0,
+    0x49, 0x01, 0x4D, 0x1A, 0x28, 0x40, 0x42, 0x69, 0xEC, 0x22, 0x85, 0x8B, 0xB3, 0x6F, 0xC1, 0x12,
+    0x8D, 0x0B, 0xDC, 0xA4, 0x86, 0xD2, 0x32, 0x45, 0x52, 0x9C, 0x84, 0x05, 0xB6, 0x6F, 0x4C, 0x5A,
+    0x90, 0x96, 0x86, 0x86, 0x66, 0x41, 0x01, 0x89, 0x6E, 0x8B, 0x8B, 0xD8, 0x98, 0xF3, 0x0E, 0xDF,
+    0x9B, 0x8B, 0x7F, 0x40, 0x19, 0xCD, 0xCE, 0xED, 0xBD, 0x7D, 0xF3, 0xDE, 0x9B, 0xF7, 0x7D, 0xEF,
+    0x0D, 0x30, 0x83, 0xC8, 0xC1, 0x00, 0xEB, 0x88, 0x0A, 0xF9, 0xED, 0x23, 0x2A, 0x61, 0xEC, 0xE5,
+    0xDF, 0x0A, 0x26, 0xC7, 0x15, 0x70, 0xA4, 0x39, 0x4E, 0x11, 0x8F, 0xD1, 0x73, 0x18, 0x98, 0x62,
+    0xD2, 0xDB, 0xAA, 0x8E, 0xCC, 0x71, 0x9D, 0x6D, 0x55, 0xFC, 0x07, 0xC4, 0x76, 0x89, 0x3A, 0x06,
+    0x43, 0xAE, 0x73, 0xA8, 0xB8, 0x76, 0x54, 0xC9, 0xB5, 0xAB, 0x1D, 0x94, 0xE7, 0x98, 0x44, 0xB2,
+    0x8E, 0xA1, 0x2A, 0x3A, 0xA2, 0xFD, 0x94, 0xAB, 0x76, 0xCB, 0x5C, 0x13, 0xD7, 0x95, 0xAD, 0xF9,
+    0x3E, 0x90, 0x89, 0x8E, 0xED, 0xC9, 0x0A, 0x2C, 0x6B, 0x31, 0x70, 0xA0, 0x69, 0x1D, 0x75, 0xE2,
+    0x00, 0x35, 0x66, 0x2C, 0xFF, 0x1D, 0x6D, 0xF1, 0xBA, 0x26, 0xFE, 0xFD, 0x29, 0xE0, 0x3D, 0xC3,
+    0x6D, 0x9E, 0xE4, 0x68, 0x1E, 0x59, 0xC4, 0xBF, 0x5E, 0xA7, 0xC1, 0xF9, 0x35, 0x60, 0xF4, 0xBB,
+    0x93, 0x6F, 0xD4, 0x1C, 0x79, 0xBE, 0x7D, 0xEB, 0x0B, 0xE8, 0x6D, 0xBE, 0xB5, 0xDF, 0xF4, 0x16,
+    0x6B, 0x7E, 0xA2, 0xE9, 0xAE, 0xA4, 0xD3, 0x46, 0x5E, 0x8A, 0x96, 0xF7, 0x8F, 0x69, 0xAF, 0x4D,
+    0xF5, 0x9B, 0x6B, 0x17, 0x9E, 0xB4, 0x3C, 0x36, 0xCB, 0xB5, 0x5D, 0x5A, 0xD4, 0xF9, 0xCB, 0xAD,
+    0xC8, 0xB5, 0xA3, 0xCF, 0x9D, 0x7E, 0xEB, 0xD8, 0xC1, 0xFF, 0xC6, 0xEC, 0xFD, 0x2C, 0xC1, 0x7A,
+    0xC6, 0x37, 0xBE, 0xC5, 0xA7, 0x2D, 0x81, 0x03, 0xDF, 0x33, 0xBF, 0x43, 0x7A, 0x5A, 0x67, 0xF2,
+    0x96, 0xCE, 0x4D, 0xA9, 0x51, 0x0E, 0x7D, 0x72, 0x00, 0x5D, 0x18, 0xA6, 0x83, 0x09, 0xEA, 0xC7,
+    0x4C, 0xF7, 0x36, 0x0D, 0x30, 0x32, 0x0C, 0x68, 0x83, 0xE7, 0x40, 0x93, 0xE2, 0xA3, 0x23, 0x55,
+    0xF5, 0x7B, 0x58, 0xD8, 0x34, 0x2E, 0xF2, 0xBA, 0x56, 0x9E, 0xA7, 0xF0, 0x2E, 0xF5, 0xA7, 0xB7,
+    0x30, 0x7A, 0x3C, 0xB5, 0xD5, 0x7B, 0xA7, 0xCE, 0x3E, 0xAB, 0x8D, 0x9B, 0x00, 0xAF, 0x0A, 0x90,
+    0x4C, 0x3D, 0x0D, 0x26, 0xB9, 0xC0, 0xD9, 0x7D, 0x26, 0x20, 0x10, 0x94, 0x89, 0xD8, 0x8A, 0xD8,
+    0x08, 0x42, 0xA2, 0xDD, 0x09, 0xB3, 0x7B, 0x36, 0x97, 0xC3, 0xA4, 0x64, 0x81, 0x60, 0x87, 0xC9,
+    0xB1, 0x18, 0x24, 0x46, 0xB0, 0x12, 0x3B, 0x82, 0x6F, 0xF7, 0x4C, 0x44, 0x73, 0x94, 0x92, 0x3A,
+    0xF2, 0xA1, 0x0A, 0x73, 0x18, 0x5C, 0xAE, 0x5F, 0xB2, 0x3A, 0x9D, 0xFD, 0x30, 0x89, 0x70, 0xCD,
+    0xE4, 0x88, 0x5D, 0x52, 0x6A, 0x0D, 0x6F, 0x1F, 0x6F, 0xFF, 0xD4, 0x8F, 0x1B, 0xC4, 0x95, 0xFA,
+    0xE7, 0x70, 0x61, 0xE9, 0xDE, 0x4C, 0x81, 0x98, 0xDF, 0xAE, 0x09, 0x2D, 0xBB, 0xD0, 0xF9, 0xDD,
+    0xEF, 0xBE, 0xF2, 0x0D, 0xCD, 0xDE, 0x80, 0x2A, 0x70, 0x13, 0x7A, 0x9C, 0xB9, 0x49, 0x5C, 0xF6,
+    0xA2, 0x5A, 0x58, 0xE3, 0x1B, 0x82, 0x75, 0x75, 0x65, 0xF3, 0xE8, 0x02, 0xA3, 0x1D, 0x59, 0x84,
+    0x7B, 0xB8, 0x27, 0x8B, 0xD0, 0x8A, 0xDB, 0x38, 0x6E, 0xC8, 0x92, 0x04, 0x18, 0xF3, 0xC0, 0x3B,
+    0x41, 0xA1, 0x78, 0x8E, 0x76, 0x07, 0x81, 0xC5, 0x67, 0x4B, 0x7C, 0xA1, 0x5D, 0x9E, 0x6B, 0x0F,
+    0xCF, 0xB5, 0x97, 0x43, 0x5D, 0x04, 0x6D, 0x2B, 0xDA, 0xEE, 0x4C, 0x3B, 0xBA, 0xD0, 0xDE, 0x3F,
+    0x77, 0x30, 0xF3, 0x0C, 0xFD, 0x5D, 0xA6, 0xEC, 0x21, 0x86, 0xDA, 0xCE, 0x61, 0x49, 0x3B, 0x9D,
+    0xAF, 0x2F, 0x2E, 0x99, 0xF7, 0xDE, 0xB5, 0x55, 0x35, 0x4C, 0x5F, 0x30, 0x51, 0x15, 0x95, 0x19,
+    0x36, 0x74, 0x95, 0xBA, 0xCC, 0x8F, 0x23, 0x1E, 0xDF, 0x90, 0x54, 0x59, 0x38, 0x19, 0x52, 0xA7,
+    0x1B, 0x5C, 0x1B, 0x8A, 0x8F, 0x54, 0x2C, 0xEB, 0x50, 0xBD, 0xFC, 0x0D, 0xD5, 0x7B, 0x40, 0x7A,
+    0x3F, 0xF2, 0xDE, 0xF8, 0x1A, 0xAD, 0x5D, 0x72, 0xA8, 0x41, 0xB2, 0xD3, 0x9F, 0xC6, 0x4B, 0x8C,
+    0xC2, 0x81, 0x26, 0x52, 0x6D, 0xA4, 0x16, 0x4D, 0x95, 0x88, 0xF8, 0x33, 0x2A, 0x90, 0x50, 0x38,
+    0xF0, 0x15, 0xCB, 0xD3, 0x19, 0xEE, 0xC1, 0x2C, 0x9F, 0xBF, 0x56, 0xA5, 0xB6, 0xA6, 0xF0, 0x2B,
+    0x17, 0xF8, 0xF2, 0x4D, 0x89, 0x84, 0x25, 0x86, 0x4D, 0x04, 0x28, 0xE5, 0x70, 0x49, 0x7E, 0x45,
+    0x1D, 0xA2, 0xE7, 0x4B, 0x09, 0xB3, 0xE5, 0xA7, 0xB5, 0xA9, 0x24, 0x36, 0x35, 0xC1, 0x5C, 0xA9,
+    0xFE, 0xB6, 0x69, 0x47, 0x55, 0x55, 0xAA, 0x8F, 0x9F, 0xAC, 0x7E, 0xE8, 0xFD, 0xDE, 0x83, 0xA7,
+    0xC8, 0x24, 0x06, 0x5D, 0x21, 0xCB, 0xF1, 0xE2, 0x07, 0x56, 0xFB, 0x89, 0xA4, 0x26, 0x99, 0x9A,
+    0x23, 0x48, 0xEA, 0xC4, 0xD2, 0x9E, 0x53, 0x42, 0x41, 0x45, 0x11, 0xD5, 0x75, 0xD9, 0x6E, 0x4D,
+    0x54, 0xE8, 0x0A, 0x85, 0xF2, 0x92, 0xD7, 0xBB, 0x39, 0x46, 0x13, 0xAC, 0x9C, 0xB1, 0x12, 0xEB,
+    0x9F, 0x40, 0xCE, 0xDC, 0xC4, 0x45, 0x9A, 0x2F, 0x44, 0x95, 0x2A, 0x3B, 0xE8, 0xE8, 0x42, 0xBB,
+    0x05, 0xD4, 0xAA, 0xF1, 0xFC, 0xE6, 0x90, 0xC9, 0x3E, 0x1A, 0x39, 0xBE, 0xF3, 0x40, 0xF2, 0xC1,
+    0x5D, 0x0B, 0xE2, 0x92, 0xED, 0x64, 0x43, 0xA2, 0x49, 0x2D, 0xA3, 0x4A, 0x4A, 0xF4, 0x10, 0x4D,
+    0x20, 0xDD, 0x4C, 0x35, 0x16, 0xCB, 0xB1, 0xD5, 0xCE, 0x30, 0xAA, 0x2E, 0x63, 0x2C, 0xA3, 0xC2,
+    0xD8, 0xF8, 0xB8, 0x26, 0xED, 0x72, 0xAC, 0x9E, 0x22, 0x29, 0x36, 0x98, 0xEF, 0x7D, 0x5D, 0x48,
+    0x23, 0x4B, 0xED, 0x26, 0xF7, 0x31, 0x7F, 0x18, 0xB0, 0x2A, 0x93, 0x1A, 0xF1, 0x9F, 0x15, 0xAA,
+    0x24, 0xEF, 0x52, 0x21, 0x4F, 0xF2, 0x21, 0xF6, 0x13, 0xBA, 0x1A, 0xAA, 0x71, 0xE2, 0x06, 0x3C,
+    0x5E, 0x85, 0x51, 0x33, 0x8D, 0x7C, 0x3F, 0x3A, 0xF1, 0x14, 0x14, 0x5A, 0xCE, 0xF5, 0x1A, 0x63,
+    0x39, 0x65, 0xE2, 0xCE, 0x47, 0x2B, 0x37, 0x2E, 0x75, 0x6C, 0xB7, 0xAF, 0x33, 0xB0, 0x23, 0x01,
+    0xED, 0xBC, 0x17, 0x8D, 0x93, 0x8A, 0xDF, 0x72, 0x11, 0x13, 0x5C, 0x3E, 0x99, 0x0D, 0x70, 0xF2,
+    0x9C, 0x11, 0x7B, 0x5A, 0xC6, 0x12, 0xEB, 0x11, 0x8E, 0xEC, 0x29, 0xAD, 0xF8, 0xB0, 0xB0, 0x64,
+    0x02, 0x7C, 0xAF, 0xA8, 0x3B, 0xBB, 0xBD, 0x90, 0xC6, 0x30, 0x46, 0xFE, 0x8B, 0xBD, 0xF7, 0x81,
+    0xDB, 0x7C, 0x3D, 0x94, 0x6E, 0x22, 0x9D, 0x54, 0xD4, 0x06, 0x67, 0x2F, 0x42, 0x88, 0x53, 0xCC,
+    0xFA, 0x62, 0x96, 0x5D, 0x31, 0xE3, 0xF1, 0xDE, 0xB8, 0xD4, 0xC4, 0xD8, 0x53, 0x3B, 0xAA, 0x9E,
+    0x12, 0xBF, 0x2F, 0x7C, 0x08, 0xC5, 0x9D, 0x05, 0x41, 0xC4, 0x56, 0x2F, 0x2D, 0x39, 0x5C, 0x1C,
+    0xBC, 0x46, 0x78, 0x06, 0xB0, 0xCD, 0xE1, 0xE3, 0xE9, 0xF6, 0xDB, 0xA1, 0x66, 0xA2, 0x71, 0x90,
+    0xCB, 0xB8, 0x2A, 0x15, 0x94, 0x0A, 0x89, 0xD2, 0x9D, 0x34, 0x54, 0xDE, 0xA2, 0x94, 0x11, 0xE9,
+    0xB4, 0x7E, 0x64, 0xAF, 0xC3, 0xCC, 0x2F, 0x2A, 0x17, 0xFD, 0xA2, 0x31, 0x8F, 0x6E, 0xBE, 0xA6,
+    0x6D, 0xF2, 0x63, 0x8A, 0x87, 0x98, 0xF8, 0xB2, 0x0B, 0xF3, 0xC3, 0xFD, 0x11, 0x78, 0x37, 0xB5,
+    0x2C, 0x92, 0x50, 0x72, 0xBD, 0xE2, 0x25, 0x66, 0x45, 0x2E, 0x03, 0xC2, 0xE5, 0x43, 0xAF, 0xF8,
+    0xFA, 0x22, 0x79, 0xD2, 0x3C, 0x46, 0xA2, 0xC5, 0xA0, 0x57, 0xA8, 0x92, 0xB2, 0x94, 0x0D, 0x63,
+    0x49, 0xB6, 0xD8, 0x7D, 0xDC, 0x98, 0xC5, 0xB4, 0xC2, 0x78, 0x4D, 0xAE, 0x2A, 0x46, 0x5D, 0x4B,
+    0x55, 0xED, 0x8D, 0x08, 0x92, 0x77, 0x7C, 0xC6, 0x64, 0xCA, 0xA1, 0x21, 0x9F, 0xBE, 0x2C, 0x84,
+    0x2F, 0x69, 0xB3, 0xC3, 0x2B, 0xAB, 0x66, 0x1F, 0xD8, 0x20, 0x4B, 0x3A, 0xCC, 0x41, 0x87, 0xD5,
+    0xD8, 0xC5, 0x58, 0xB1, 0x57, 0xFB, 0x82, 0x21, 0x14, 0xBA, 0x54, 0x35, 0xCB, 0xB3, 0xCF, 0x8C,
+    0x1C, 0x30, 0x3F, 0xB5, 0xB1, 0x51, 0x6D, 0xEE, 0xAF, 0x56, 0x29, 0xAF, 0x1C, 0xDE, 0x76, 0x79,
+    0x4F, 0xE0, 0x99, 0x8E, 0xD5, 0x5A, 0x0A, 0x91, 0xC6, 0xFF, 0xF8, 0x14, 0xA6, 0x14, 0x94, 0x21,
+    0xC7, 0x82, 0xD0, 0x53, 0x58, 0x0A, 0x7A, 0x61, 0xA8, 0x6E, 0x5A, 0xC7, 0x6C, 0x06, 0x42, 0x69,
+    0xAB, 0x98, 0xB4, 0xBD, 0x8A, 0xEE, 0xA4, 0x53, 0xF0, 0xFE, 0x18, 0xB0, 0xA6, 0x48, 0xB0, 0xFF,
+    0x5F, 0x94, 0xCF, 0x19, 0xFF, 0x02, 0x5D, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xB6, 0x95,
+    0x35, 0xDA, 0x91, 0x98, 0x26, 0x34, 0xAC, 0x90, 0x5B, 0x90, 0x90, 0xE6, 0x07, 0xC2, 0x9B, 0x11,
+    0x7C, 0x00, 0xDB, 0x2C, 0x2D, 0x0D, 0x05, 0xA2, 0xA1, 0xA5, 0xD8, 0xEC, 0x33, 0x4A, 0x49, 0x41,
+    0x68, 0x68, 0xD9, 0x82, 0x86, 0x6D, 0xD2, 0x50, 0x50, 0x6C, 0xF0, 0x44, 0xF9, 0x00, 0x2C, 0xA5,
+    0xA0, 0xCC, 0x2B, 0xA0, 0x4A, 0xB1, 0x2E, 0x8C, 0xD6, 0x42, 0x7E, 0x1E, 0xCE, 0x19, 0xBF, 0x8D,
+    0x14, 0xDE, 0xD3, 0x5C, 0xD9, 0x9E, 0x99, 0x7B, 0xCF, 0x9C, 0x7B, 0xCF, 0x1D, 0x34, 0xCB, 0x63,
+    0xA0, 0x4B, 0x23, 0xAA, 0x44, 0x63, 0xD1, 0x0C, 0x38, 0x87, 0xE9, 0xAB, 0x1D, 0x6C, 0x6B, 0x03,
+    0x3C, 0xDF, 0x30, 0x97, 0x03, 0xAA, 0xC1, 0xB6, 0xB0, 0xF1, 0x23, 0xE0, 0xA2, 0xE0, 0xDB, 0x68,
+    0x22, 0xB6, 0xD1, 0x7F, 0xF6, 0x64, 0x8F, 0x94, 0xD2, 0xAE, 0x4E, 0x69, 0x81, 0x4B, 0xA9, 0xE7,
+    0x1B, 0xFD, 0x01, 0xC5, 0x99, 0x1C, 0xC6, 0x82, 0x73, 0xF8, 0x8D, 0xEF, 0xDC, 0x87, 0x86, 0x83,
+    0xDB, 0x50, 0xFD, 0xFD, 0x25, 0xB8, 0x0E, 0xD8, 0xA6, 0x16, 0x1B, 0x7E, 0x64, 0x1C, 0xD4, 0x9C,
+    0x60, 0x18, 0x60, 0xB9, 0xBA, 0xE4, 0xC4, 0x5E, 0xDE, 0x82, 0x95, 0x47, 0x1C, 0x75, 0x7B, 0xD8,
+    0x34, 0xE7, 0x65, 0x8E, 0x2B, 0x36, 0x07, 0x7F, 0x17, 0x57, 0x81, 0x6E, 0x5A, 0x8E, 0x50, 0x8C,
+    0xEB, 0xEE, 0x8A, 0xA3, 0xDE, 0x31, 0x0C, 0xB7, 0x59, 0x7A, 0x6C, 0x38, 0x5C, 0x0B, 0xF8, 0x80,
+    0xC3, 0x4F, 0xCE, 0x88, 0x76, 0x57, 0x2E, 0xA1, 0xC0, 0x36, 0xAC, 0xCB, 0xCA, 0x89, 0x33, 0x1E,
+    0xEB, 0x5E, 0x3C, 0x15, 0xA4, 0x58, 0xFD, 0x7B, 0x3A, 0xC3, 0x2D, 0x9C, 0xB6, 0x3F, 0xCC, 0x28,
+    0x86, 0x66, 0xC7, 0xC0, 0x3C, 0x6B, 0x4F, 0x50, 0x33, 0x3C, 0x0F, 0x87, 0xAF, 0x19, 0x1C, 0xF7,
+    0x80, 0xFB, 0x82, 0x76, 0xAE, 0xF3, 0x5D, 0x0B, 0xE0, 0xC4, 0x85, 0x04, 0xF4, 0x50, 0x88, 0xAE,
+    0x05, 0x69, 0x06, 0xE9, 0x9C, 0xE9, 0x9C, 0x71, 0x6C, 0x4F, 0x5E, 0x52, 0xCC, 0x86, 0x38, 0x52,
+    0x6B, 0x92, 0x0E, 0xDA, 0x63, 0x2B, 0xB0, 0x1D, 0x5C, 0xC4, 0x02, 0xDF, 0x16, 0x7B, 0x82, 0x6F,
+    0xEB, 0xBE, 0xD4, 0xEE, 0x0D, 0x9A, 0x60, 0x22, 0x1D, 0x4D, 0x74, 0xEA, 0x88, 0x2D, 0x7B, 0xDA,
+    0x73, 0x8B, 0x8B, 0x66, 0x77, 0x38, 0x98, 0x8E, 0xAC, 0x23, 0xCC, 0x3C, 0x45, 0xBF, 0x12, 0x35,
+    0xAF, 0x07, 0x3A, 0x3C, 0x56, 0x7A, 0x0C, 0xAF, 0x1F, 0x9B, 0x20, 0xB8, 0xAF, 0x1F, 0xF9, 0x95,
+    0x27, 0x6C, 0x98, 0x95, 0x4E, 0xB5, 0x10, 0x70, 0x7C, 0x0A, 0xCD, 0xBA, 0xC0, 0xA3, 0xB7, 0xB8,
+    0xE6, 0xD8, 0x90, 0x8B, 0x86, 0xC3, 0xFC, 0x11, 0x51, 0xBD, 0xEA, 0x51, 0x28, 0x39, 0xCC, 0x2F,
+    0x3C, 0x59, 0x6F, 0xE8, 0xC0, 0x26, 0x4D, 0x4C, 0x28, 0x47, 0xBA, 0x99, 0xF9, 0x75, 0x53, 0xB3,
+    0x2A, 0x02, 0x29, 0x8B, 0x9A, 0x3E, 0x6A, 0x73, 0xB4, 0x31, 0xC7, 0xDD, 0xE4, 0xB4, 0x33, 0xEB,
+    0x4A, 0x19, 0xE9, 0x3F, 0xCF, 0x38, 0x59, 0x63, 0x04, 0xAF, 0x4C, 0xCE, 0x67, 0x5F, 0x6C, 0xD3,
+    0xC2, 0x22, 0xF8, 0x54, 0x4C, 0x1F, 0x5D, 0xA2, 0xBC, 0x84, 0xEF, 0xE1, 0x23, 0x52, 0x28, 0x17,
+    0xD0, 0xB1, 0x9D, 0xE0, 0x26, 0xA8, 0xE4, 0x06, 0x93, 0x50, 0xDF, 0x44, 0x4F, 0xF6, 0xB7, 0xD5,
+    0x2D, 0x69, 0xDA, 0x37, 0x3F, 0xB5, 0xF5, 0x8B, 0x71, 0x7E, 0x0A, 0x67, 0x6F, 0x5E, 0x90, 0x42,
+    0xBF, 0x34, 0xB1, 0x1E, 0xBA, 0x21, 0xC1, 0x7D, 0x9B, 0x3E, 0x21, 0x77, 0xF5, 0xDC, 0xF4, 0xF5,
+    0x60, 0x63, 0x0A, 0x2E, 0x7E, 0x50, 0xCD, 0x20, 0xE0, 0x66, 0xC8, 0x3C, 0xBE, 0x8B, 0x62, 0x56,
+    0x51, 0x74, 0xA8, 0x14, 0x8E, 0x58, 0x9A, 0x91, 0xEC, 0x98, 0x85, 0x90, 0xAB, 0x9B, 0xE8, 0x50,
+    0xDC, 0x72, 0x1F, 0xE6, 0xA7, 0xA4, 0xD6, 0x37, 0x1F, 0x73, 0xFA, 0xD1, 0x8E, 0x1B, 0xFA, 0xF9,
+    0x82, 0x47, 0x71, 0x2E, 0x94, 0xB3, 0x79, 0xC9, 0x1C, 0x16, 0x24, 0xC6, 0x07, 0x3F, 0x32, 0x45,
+    0x96, 0xD3, 0x03, 0x31, 0xF3, 0xE7, 0x64, 0xA5, 0x36, 0x2C, 0xA1, 0xA3, 0xE1, 0x3E, 0xE6, 0xB1,
+    0x98, 0x70, 0x21, 0x46, 0x3C, 0x56, 0xD1, 0x55, 0xBD, 0x64, 0x32, 0x8A, 0xAC, 0x6B, 0x71, 0xB3,
+    0x11, 0x5B, 0x2E, 0x30, 0xAA, 0x8B, 0xD5, 0xF2, 0x63, 0xD7, 0x67, 0xCD, 0x49, 0x21, 0x83, 0x54,
+    0xC6, 0x65, 0x27, 0xAA, 0xC4, 0x43, 0x1D, 0xA4, 0xBF, 0xF4, 0x31, 0x60, 0x28, 0x25, 0xE5, 0x07,
+    0xDC, 0x6B, 0x49, 0xB5, 0x69, 0xEB, 0x78, 0xD2, 0x97, 0x5A, 0x2D, 0x51, 0x6D, 0x7F, 0x59, 0xEB,
+    0x42, 0xD5, 0xAF, 0x1A, 0xC9, 0x0A, 0x60, 0xCD, 0xB1, 0xA6, 0xA0, 0x1A, 0x84, 0x5D, 0xEB, 0xEA,
+    0x84, 0xDF, 0x0A, 0x65, 0xC0, 0x8C, 0xF5, 0x40, 0x29, 0xE5, 0xBA, 0x26, 0x26, 0x2E, 0x9F, 0x94,
+    0xA6, 0x49, 0x20, 0x27, 0x89, 0x57, 0x1D, 0xA1, 0x50, 0x93, 0x28, 0x65, 0xAA, 0xDE, 0xB6, 0x6F,
+    0xD9, 0x68, 0x7B, 0x9F, 0x55, 0xCC, 0x83, 0x4A, 0x35, 0x95, 0x10, 0xE3, 0x89, 0x8C, 0x72, 0xC7,
+    0x28, 0x0A, 0x79, 0x74, 0x45, 0x0C, 0x6C, 0x1B, 0x86, 0xBC, 0xBC, 0x4D, 0xC8, 0xEF, 0x11, 0xF4,
+    0x87, 0x1C, 0xFA, 0x7F, 0xC3, 0x48, 0xBF, 0xD6, 0xA3, 0x30, 0x13, 0x06, 0x88, 0xBF, 0x55, 0xEF,
+    0xA9, 0x87, 0x9A, 0x95, 0x5F, 0xF7, 0x96, 0xFF, 0x86, 0x51, 0x5C, 0x6C, 0x7A, 0xDF, 0x7A, 0xD5,
+    0xFD, 0xD2, 0x92, 0x98, 0x89, 0xF9, 0xBA, 0x0A, 0x12, 0x51, 0x3E, 0x25, 0x33, 0xB9, 0xB6, 0x8D,
+    0x4A, 0xDD, 0xA9, 0x11, 0x63, 0x4D, 0xEE, 0x2C, 0x49, 0x18, 0x04, 0x24, 0xB5, 0xF7, 0xB1, 0x1D,
+    0xA5, 0xC5, 0x52, 0xCA, 0xDC, 0x92, 0xA7, 0xA2, 0x5B, 0x1E, 0xAF, 0x94, 0xDE, 0x3B, 0x3B, 0x3B,
+    0xD3, 0xD4, 0x73, 0xD1, 0x1E, 0xDE, 0xE8, 0x56, 0xDA, 0xFB, 0x10, 0xFF, 0xE3, 0x72, 0x5C, 0x05,
+    0x97, 0xE5, 0xA8, 0xEE, 0xC3, 0x24, 0xE7, 0x32, 0x2F, 0xF4, 0x11, 0x5F, 0xA1, 0xFC, 0x39, 0x37,
+    0x82, 0x2C, 0x7A, 0x4F, 0xEA, 0x55, 0x70, 0x3D, 0xF5, 0xEB, 0xF9, 0xE7, 0x33, 0x3B, 0x45, 0x4F,
+    0x3F, 0x4E, 0xBA, 0x9C, 0x59, 0x01, 0x75, 0xCF, 0xCD, 0x4E, 0xDA, 0x98, 0xD5, 0x25, 0x44, 0x44,
+    0x52, 0x0F, 0x9B, 0x44, 0x2A, 0x25, 0x99, 0xA6, 0x43, 0xEA, 0xDF, 0x07, 0x8E, 0x3F, 0x0F, 0x30,
+    0xCF, 0x77, 0x14, 0xDA, 0xC4, 0x90, 0x1B, 0x62, 0xB1, 0xB1, 0x98, 0x73, 0x0F, 0x9A, 0xF1, 0x3B,
+    0xFD, 0x6F, 0x19, 0xCA, 0x87, 0x6A, 0x64, 0x8E, 0xF7, 0x6C, 0x38, 0xFE, 0xFB, 0x1D, 0x79, 0x1F,
+    0x48, 0x2C, 0x41, 0x77, 0xC4, 0xE7, 0x38, 0x8C, 0xAA, 0x54, 0x4D, 0x81, 0xB2, 0x97, 0x9D, 0x64,
+    0xCB, 0x41, 0xCD, 0x83, 0x0D, 0x21, 0x77, 0x71, 0x81, 0xB3, 0xAD, 0x53, 0x89, 0x13, 0x5A, 0x6A,
+    0x2F, 0xE0, 0xCB, 0x14, 0xD9, 0x17, 0xEB, 0xF4, 0x6C, 0x82, 0xB7, 0x2F, 0xA9, 0x3A, 0xEF, 0xBF,
+    0xFB, 0x93, 0x22, 0xE8, 0xCC, 0x0D, 0xE3, 0xEC, 0x6B, 0x96, 0xA8, 0x9F, 0xEA, 0xA4, 0x76, 0x41,
+    0xF5, 0x52, 0xCC, 0x94, 0x1D, 0x3B, 0x5D, 0x25, 0xF4, 0x65, 0x8B, 0xE3, 0xC0, 0xCE, 0x60, 0x98,
+    0x3C, 0xDD, 0x11, 0x75, 0x56, 0xC0, 0x24, 0xE3, 0x64, 0xEA, 0x57, 0xCA, 0xA0, 0x52, 0x06, 0x27,
+    0x63, 0xC4, 0xBD, 0xD9, 0xE7, 0x72, 0xE7, 0xB4, 0xA1, 0xE8, 0xF9, 0x6D, 0x91, 0xE1, 0xC1, 0xCC,
+    0x40, 0xA7, 0x86, 0x45, 0x23, 0xD3, 0xF4, 0xBA, 0x2C, 0x46, 0x92, 0xF5, 0x88, 0xED, 0xD8, 0x44,
+    0xD3, 0x37, 0x42, 0x2B, 0x4A, 0x3C, 0xAA, 0x5B, 0xC6, 0x24, 0x30, 0xB5, 0x27, 0xB6, 0x16, 0x29,
+    0x80, 0x65, 0x9E, 0x93, 0xB6, 0x5F, 0xA3, 0xF0, 0xEB, 0x2A, 0x5D, 0xB1, 0xDE, 0xF2, 0x66, 0x22,
+    0x08, 0x9B, 0xCB, 0x18, 0xB5, 0x90, 0x9B, 0x5C, 0xC6, 0xE3, 0x9D, 0x69, 0x64, 0xDC, 0x70, 0x67,
+    0xD4, 0x19, 0xB1, 0xDD, 0xDD, 0x99, 0x4E, 0x26, 0xFD, 0x73, 0x76, 0x2A, 0x3F, 0xF9, 0x8A, 0xCB,
+    0xEA, 0xC8, 0xE7, 0x12, 0x04, 0x69, 0x42, 0x37, 0x1B, 0x9B, 0x61, 0xBE, 0x35, 0xE5, 0x6C, 0x38,
+    0xDC, 0x6C, 0xAA, 0xA1, 0xB8, 0x56, 0x9E, 0x55, 0x4D, 0x1D, 0x2E, 0x54, 0x55, 0xF5, 0x83, 0x37,
+    0xB7, 0x14, 0xDA, 0xB2, 0x5B, 0xB7, 0x68, 0xB9, 0x69, 0xD7, 0x2B, 0x56, 0xCB, 0x95, 0x5E, 0xCF,
+    0x28, 0xEF, 0x9C, 0xAE, 0x25, 0xF3, 0x1F, 0x95, 0x55, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xB3,
+    0x83, 0xB3, 0x42, 0x8B, 0x3D, 0x29, 0x6C, 0x09, 0x09, 0x9C, 0xA5, 0x4C, 0x61, 0x7B, 0x9A, 0x14,
+    0x41, 0xDA, 0xF3, 0x4D, 0xE4, 0x22, 0x05, 0x8D, 0x85, 0x4C, 0x85, 0x84, 0x5C, 0x21, 0xD1, 0x90,
+    0x14, 0x29, 0xAE, 0xB8, 0xE4, 0x36, 0xE9, 0x68, 0xC0, 0x15, 0x2D, 0x16, 0x55, 0xD2, 0x80, 0x8B,
+    0x2B, 0xAE, 0xB8, 0x70, 0x63, 0x51, 0xD0, 0x6E, 0x47, 0x41, 0xC1, 0x46, 0x58, 0x02, 0x81, 0x94,
+    0x0C, 0x68, 0x91, 0x36, 0xE2, 0xBC, 0xC3, 0x9B, 0x59, 0x0B, 0x02, 0x12, 0x05, 0x7B, 0x5A, 0xDD,
+    0xDE, 0xEC, 0x9F, 0x3F, 0xFF, 0xBF, 0xF7, 0xFE, 0xBB, 0xCB, 0x87, 0xC7, 0xF5, 0x49, 0xB8, 0xA6,
+    0xD3, 0xD9, 0x68, 0xCC, 0xEB, 0xCE, 0x21, 0x86, 0x0E, 0xF0, 0x15, 0x90, 0x95, 0x40, 0x0E, 0x60,
+    0xC0, 0x7B, 0x06, 0x08, 0x2E, 0xCB, 0xFF, 0x58, 0xB6, 0x80, 0xBA, 0x58, 0x2E, 0x78, 0x37, 0x2F,
+    0x2C, 0x1B, 0x40, 0xFF, 0xBD, 0x9C, 0xD4, 0x40, 0x6A, 0x21, 0xBD, 0x81, 0xEA, 0x80, 0x8D, 0x83,
+    0xD4, 0xC8, 0x26, 0xF9, 0xF6, 0x86, 0xBD, 0xCA, 0xF7, 0x43, 0xEF, 0x9D, 0xF7, 0x9E, 0xBB, 0x80,
+    0xB1, 0x70, 0x59, 0x7C, 0x00, 0x6E, 0x7D, 0x04, 0xED, 0xAB, 0xAC, 0x9C, 0x8B, 0x5A, 0xDA, 0x02,
+    0xE3, 0xD4, 0xA4, 0xE5, 0x09, 0x5A, 0x05, 0x6D, 0xDA, 0xDC, 0x29, 0xEF, 0x31, 0xE9, 0x9C, 0xE8,
+    0xDE, 0x83, 0x38, 0x03, 0xE6, 0x4C, 0x13, 0x8B, 0x61, 0xA9, 0xA1, 0x86, 0xF9, 0x06, 0x76, 0x17,
+    0xB5, 0x7A, 0xFE, 0xA1, 0x6C, 0xE4, 0x69, 0x03, 0x37, 0x47, 0xB1, 0x8B, 0x5C, 0x95, 0x6A, 0xCF,
+    0xE5, 0xA7, 0x3C, 0x6B, 0xE8, 0x6D, 0xEA, 0x4B, 0xBC, 0x74, 0x71, 0x54, 0xA5, 0xBC, 0x59, 0x82,
+    0x27, 0x17, 0x61, 0x37, 0x5B, 0xDD, 0x01, 0x96, 0x48, 0xBA, 0x63, 0xE9, 0xEB, 0x84, 0x71, 0xF1,
+    0x5A, 0xE3, 0xBD, 0x79, 0xD1, 0x53, 0xB8, 0xEF, 0xF0, 0x66, 0x70, 0xE3, 0x30, 0x39, 0xAF, 0x45,
+    0xA3, 0x2B, 0x69, 0x95, 0x55, 0x2C, 0xE2, 0x0A, 0x72, 0xB3, 0xCD, 0xF6, 0x07, 0x98, 0x60, 0xF8,
+    0x69, 0xC7, 0x36, 0xCE, 0xA1, 0x7C, 0xC8, 0x57, 0xF4, 0x99, 0x60, 0x90, 0x7A, 0x64, 0x47, 0x27,
+    0x99, 0x59, 0x4D, 0xCB, 0x77, 0xF7, 0xBC, 0x7F, 0xD2, 0x3D, 0xDA, 0x9F, 0x46, 0x70, 0xB3, 0x4A,
+    0x08, 0x16, 0xA8, 0x7D, 0x2D, 0x16, 0x47, 0x04, 0xF4, 0x48, 0x74, 0x3C, 0x2D, 0x0B, 0x47, 0xAD,
+    0x31, 0xCB, 0x7D, 0xDF, 0x10, 0xDF, 0x71, 0xA8, 0xB1, 0x21, 0xF0, 0x89, 0xC3, 0x6E, 0xE8, 0x99,
+    0xFD, 0x23, 0x6D, 0x8E, 0xE1, 0xFF, 0xB0, 0xEA, 0x41, 0x87, 0x29, 0xDB, 0x66, 0x31, 0x9B, 0x04,
+    0xE5, 0x44, 0x34, 0x09, 0x1F, 0xB3, 0x77, 0x3C, 0x72, 0xDF, 0x12, 0x6C, 0x0B, 0xFD, 0x19, 0xF3,
+    0x36, 0x30, 0xDA, 0x4A, 0x56, 0x45, 0x90, 0x91, 0xB7, 0xDC, 0x2F, 0xD9, 0x27, 0x6B, 0x50, 0x7C,
+    0x24, 0x5D, 0x5B, 0x3D, 0x91, 0x6F, 0x76, 0xC8, 0x18, 0xD4, 0xDD, 0xB4, 0xAA, 0xDC, 0x4A, 0x5C,
+    0x62, 0x07, 0x28, 0xA4, 0x95, 0xE5, 0x1C, 0x23, 0xA2, 0x69, 0x08, 0xAD, 0x86, 0x96, 0x4E, 0x3A,
+    0x52, 0x9E, 0x59, 0x7E, 0x1D, 0xC4, 0x06, 0x05, 0x12, 0xCB, 0x8A, 0xAF, 0x31, 0x8D, 0x62, 0xE2,
+    0xA4, 0x62, 0xB5, 0x05, 0x21, 0x09, 0x2A, 0x8A, 0x4A, 0x70, 0x10, 0x3C, 0xF3, 0xE0, 0x02, 0x8F,
+    0x10, 0xCD, 0x70, 0x8C, 0x80, 0xED, 0x58, 0x01, 0x6B, 0x11, 0x14, 0xDD, 0x49, 0x44, 0x9A, 0xA0,
+    0x67, 0xB1, 0x1A, 0x51, 0x87, 0x28, 0xB1, 0x84, 0x22, 0x59, 0x6D, 0xBF, 0xF3, 0x52, 0x8C, 0xBF,
+    0x12, 0x37, 0x16, 0x31, 0xC3, 0x74, 0x8C, 0x5F, 0x9D, 0xF8, 0xD1, 0x26, 0x1E, 0x72, 0x89, 0xF4,
+    0x1C, 0xD9, 0x02, 0xEA, 0x96, 0xCD, 0x55, 0xAD, 0xD3, 0x66, 0x97, 0x4B, 0x5B, 0x0C, 0x9C, 0xC1,
+    0x09, 0x97, 0x50, 0x59, 0xA9, 0xCD, 0x4A, 0x45, 0x24, 0x77, 0x08, 0x3E, 0x55, 0x66, 0x16, 0x96,
+    0x08, 0xBD, 0x3A, 0x31, 0x5F, 0x51, 0xAD, 0xE7, 0x93, 0x06, 0x93, 0x3D, 0x7F, 0xB3, 0x54, 0x36,
+    0xB7, 0xD7, 0xD1, 0x08, 0x27, 0x4B, 0xCD, 0xC8, 0xA9, 0xE4, 0x46, 0x45, 0x16, 0xE6, 0xA0, 0x5C,
+    0x95, 0xD9, 0x89, 0xAF, 0x2A, 0x4D, 0x2E, 0xEE, 0xCA, 0x3A, 0xAD, 0x28, 0xA4, 0x37, 0x3E, 0x20,
+    0x6E, 0x0D, 0xBA, 0x94, 0xAF, 0x8B, 0xC4, 0x49, 0xE2, 0x36, 0xE6, 0x1E, 0xE2, 0xD6, 0x30, 0x19,
+    0xDA, 0xC4, 0x69, 0x33, 0x24, 0x6E, 0x35, 0x5E, 0x6B, 0x19, 0x59, 0x27, 0xB5, 0x62, 0x4D, 0x23,
+    0x85, 0xF4, 0x46, 0x8D, 0xE9, 0x36, 0x54, 0x52, 0x89, 0x5A, 0xE3, 0x31, 0xB5, 0x50, 0x2A, 0x5F,
+    0x43, 0xB3, 0xF5, 0x95, 0xAC, 0x86, 0xFC, 0xDE, 0x73, 0x4C, 0x6F, 0x54, 0x64, 0xF6, 0x3A, 0x65,
+    0xB6, 0x46, 0xD1, 0xCA, 0x52, 0x3A, 0x82, 0xB5, 0x24, 0x34, 0x13, 0x33, 0x23, 0xC3, 0x4B, 0xE4,
+    0x0B, 0x2A, 0xEE, 0x93, 0x36, 0x20, 0x1D, 0xA0, 0x8E, 0x33, 0x18, 0x35, 0x32, 0xC0, 0x8B, 0x97,
+    0x7E, 0x50, 0x66, 0xFE, 0x0B, 0xCC, 0xD2, 0x86, 0x65, 0x72, 0xC6, 0xEE, 0x89, 0x3A, 0x71, 0x19,
+    0x94, 0xDD, 0xC2, 0x63, 0x4C, 0x33, 0x17, 0x84, 0x28, 0xFD, 0x53, 0x24, 0xE7, 0x24, 0x42, 0x9E,
+    0x72, 0xD2, 0x39, 0xF9, 0x0B, 0xB2, 0x77, 0xD6, 0xEF, 0x5F, 0x5F, 0x17, 0xBF, 0xB8, 0x8C, 0xD3,
+    0x14, 0xC4, 0xC8, 0xA6, 0x77, 0xD1, 0x7F, 0x0F, 0x03, 0x47, 0x2C, 0x16, 0xF9, 0x73, 0x74, 0x0F,
+    0xC9, 0x2D, 0xE9, 0x64, 0xA7, 0x82, 0xE3, 0x7F, 0x8B, 0xFC, 0x35, 0x2B, 0x9C, 0x16, 0xEF, 0x26,
+    0xBE, 0xD2, 0x9D, 0xE9, 0xC9, 0x9F, 0x51, 0x3E, 0x2B, 0xBF, 0xEF, 0xF9, 0x25, 0xB5, 0x5C, 0x84,
+    0x14, 0x0D, 0x59, 0xED, 0xC5, 0xDD, 0x99, 0x49, 0x9B, 0x7A, 0x43, 0xA6, 0x4E, 0x49, 0xD8, 0x08,
+    0xCD, 0x36, 0x0A, 0x12, 0x26, 0x6D, 0x76, 0x9F, 0x98, 0x8F, 0x08, 0xE4, 0xB3, 0x65, 0xE6, 0x7D,
+    0x00, 0x4A, 0xFF, 0x50, 0xAD, 0x43, 0xEC, 0x59, 0x8C, 0x08, 0x20, 0x6D, 0xA3, 0xCA, 0x03, 0xCF,
+    0x39, 0x14, 0x97, 0xE6, 0xAC, 0xEC, 0x69, 0xAC, 0x3E, 0x5B, 0xF2, 0xCB, 0x60, 0x9D, 0x80, 0xD2,
+    0xA6, 0xB2, 0xAF, 0x2B, 0x0E, 0x50, 0x43, 0x8B, 0x1A, 0x64, 0xA5, 0x53, 0x6F, 0xB9, 0x99, 0xFC,
+    0x8E, 0x73, 0xEA, 0x7D, 0x17, 0x8C, 0x09, 0xAA, 0xF5, 0xA5, 0x6C, 0x87, 0x16, 0xCB, 0xAC, 0x0A,
+    0x4E, 0x37, 0xE0, 0x7C, 0x37, 0xFD, 0xA6, 0x67, 0x06, 0xF2, 0x9C, 0xD5, 0x53, 0x88, 0x29, 0xEF,
+    0x9C, 0x69, 0xEF, 0xDE, 0x63, 0x77, 0x43, 0xB6, 0xAE, 0x8D, 0xA6, 0x68, 0xC8, 0x48, 0xC1, 0x91,
+    0x9A, 0x52, 0x29, 0x7C, 0x62, 0x6B, 0x03, 0x12, 0xB2, 0x43, 0x97, 0xD2, 0xB4, 0xCC, 0xFC, 0x1E,
+    0x82, 0x8E, 0x79, 0x02, 0xE5, 0x4D, 0x8E, 0x02, 0x5E, 0xDC, 0x02, 0x4D, 0xE9, 0x93, 0xE3, 0x49,
+    0xA8, 0x92, 0x4B, 0x8F, 0x02, 0xD0, 0x39, 0xA5, 0xB4, 0x08, 0x0E, 0x79, 0x37, 0x18, 0x44, 0xA4,
+    0x92, 0xA1, 0x61, 0x82, 0x18, 0x2D, 0x49, 0xEE, 0xF0, 0xE7, 0xA3, 0x40, 0x16, 0x5D, 0x91, 0x80,
+    0x6E, 0x50, 0x21, 0x2C, 0x38, 0xCE, 0x83, 0x8E, 0x5E, 0xCC, 0x63, 0x69, 0xC1, 0x97, 0x5C, 0x38,
+    0x44, 0xB6, 0xD1, 0xB1, 0xFB, 0xA5, 0x20, 0x8C, 0xA2, 0xFF, 0xCD, 0x56, 0x16, 0x3D, 0xAD, 0x2F,
+    0xE3, 0x75, 0xCE, 0xC8, 0x75, 0x4E, 0xEF, 0x6D, 0x1C, 0xA3, 0x12, 0x36, 0x09, 0x1A, 0xE3, 0x0C,
+    0xAE, 0x61, 0x95, 0xAF, 0xAE, 0xF2, 0x05, 0x56, 0x0C, 0x74, 0xA0, 0x32, 0x0E, 0xA4, 0x0B, 0xA9,
+    0xD8, 0x1E, 0x47, 0x34, 0x3D, 0x43, 0x42, 0xA7, 0x6B, 0xC2, 0xA9, 0x3B, 0x31, 0xF7, 0x18, 0x68,
+    0x43, 0xC8, 0xA4, 0x42, 0x64, 0x9B, 0xD4, 0xAD, 0x1D, 0x7E, 0xB3, 0xFA, 0xF9, 0x7D, 0x17, 0x0F,
+    0x93, 0x4B, 0xD9, 0xD2, 0xAD, 0xF8, 0x43, 0xEC, 0xA7, 0x15, 0xA7, 0xD1, 0x06, 0x5F, 0xE9, 0x27,
+    0x92, 0x4C, 0xF3, 0x33, 0xA2, 0xD3, 0x9E, 0xE0, 0x32, 0x63, 0x0F, 0x83, 0x90, 0x56, 0xC1, 0xB2,
+    0x74, 0x23, 0x7D, 0xB5, 0x7B, 0x3B, 0xF9, 0xCD, 0xAA, 0x35, 0x8C, 0xAF, 0x25, 0x4F, 0xAC, 0xFA,
+    0x18, 0xC3, 0x6B, 0x58, 0xFC, 0x04, 0x9A, 0x1C, 0x71, 0xB3, 0xC1, 0x32, 0xFE, 0x71, 0x89, 0x45,
+    0x70, 0x5D, 0xCE, 0x44, 0x9D, 0x82, 0x7E, 0x14, 0xFD, 0x26, 0xFA, 0x78, 0x30, 0xBC, 0x60, 0x75,
+    0xC1, 0x6D, 0x82, 0xED, 0x91, 0x7B, 0x8E, 0x97, 0x77, 0xFD, 0xD4, 0xB0, 0x7C, 0x41, 0x68, 0xD2,
+    0xE7, 0x64, 0xDA, 0x73, 0x3B, 0xFF, 0xA9, 0x62, 0xBA, 0xE2, 0xED, 0x4A, 0xD3, 0x8B, 0x2B, 0x8E,
+    0xF6, 0x16, 0x9C, 0xC2, 0x20, 0x2F, 0xE9, 0xA4, 0x1C, 0x3E, 0xB5, 0xB2, 0x19, 0x8F, 0xA3, 0xC2,
+    0x08, 0x49, 0x34, 0x06, 0x2C, 0x73, 0x83, 0xC7, 0xE4, 0x6E, 0xC8, 0x8C, 0x3A, 0xE8, 0x88, 0x1C,
+    0x7F, 0x49, 0x1B, 0xF3, 0x0F, 0x11, 0x86, 0x26, 0xD0, 0x1A, 0xFF, 0xC2, 0x38, 0xE8, 0xEF, 0x77,
+    0x47, 0x41, 0xF8, 0xFD, 0xD8, 0xF6, 0x6C, 0xBC, 0xF2, 0x17, 0x1B, 0xFB, 0x17, 0x6E, 0x69, 0xFE,
+    0xC5, 0xC6, 0xFF, 0xBD, 0xFE, 0x04, 0xB5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC6,
+    0xCE, 0x3A, 0x5E, 0xFB, 0xF6, 0x40, 0xB6, 0x14, 0x45, 0x8E, 0x37, 0x85, 0x8B, 0x23, 0x38, 0x3E,
+    0x17, 0x2E, 0x22, 0x71, 0xE7, 0x5D, 0x53, 0xD0, 0x44, 0x48, 0x2E, 0x42, 0x43, 0x45, 0x19, 0x24,
+    0xA4, 0x5C, 0x61, 0xA1, 0xA0, 0x1C, 0x78, 0x09, 0x05, 0x6D, 0x24, 0xFE, 0x01, 0x77, 0x24, 0x47,
+    0x81, 0x0B, 0x17, 0x8E, 0x64, 0x72, 0x83, 0xFC, 0x0F, 0x8C, 0x44, 0x41, 0xC9, 0x22, 0x40, 0x02,
+    0x1A, 0x16, 0x58, 0xC1, 0x81, 0xF6, 0x3C, 0x7C, 0x6F, 0xEF, 0x22, 0x84, 0x25, 0x28, 0x10, 0xAC,
+    0x34, 0xB7, 0xBB, 0x33, 0x6F, 0xDE, 0xF7, 0xE3, 0xBD, 0xD9, 0x03, 0xE2, 0x1C, 0x78, 0xFC, 0x06,
+    0x94, 0x9D, 0x81, 0x49, 0x01, 0x63, 0x81, 0xD8, 0x67, 0x18, 0x7E, 0x5C, 0xA8, 0x02, 0xA5, 0xB6,
+    0xD8, 0xE3, 0x54, 0xA1, 0xCF, 0x5E, 0x2A, 0x30, 0xF4, 0x16, 0xEA, 0x0C, 0x40, 0x85, 0x19, 0x55,
+    0xA1, 0xED, 0x47, 0x9C, 0xCA, 0x71, 0xED, 0x3B, 0x20, 0xD2, 0x3F, 0x15, 0xDB, 0x49, 0xF0, 0xE5,
+    0xEE, 0x2D, 0xF5, 0x08, 0xA3, 0xE6, 0x75, 0xDC, 0xCF, 0xE6, 0x6E, 0xAB, 0x17, 0xCB, 0xD7, 0xD6,
+    0x5A, 0x78, 0x9D, 0x3B, 0xD4, 0xB7, 0xF3, 0x2B, 0x0B, 0x2B, 0x6B, 0xAD, 0xAD, 0xBD, 0x76, 0x39,
+    0x9F, 0x62, 0x06, 0xCD, 0x20, 0x5B, 0xD1, 0x79, 0xB4, 0x53, 0x04, 0xB6, 0xAF, 0xF3, 0xD0, 0x25,
+    0x48, 0xD4, 0x08, 0xA3, 0xD0, 0x05, 0x58, 0x47, 0x13, 0xE9, 0xF0, 0xD1, 0x4D, 0x3F, 0x16, 0x36,
+    0x1D, 0x04, 0x19, 0x8E, 0x80, 0xD0, 0x9F, 0x79, 0xEF, 0x30, 0x40, 0x77, 0xAE, 0xB1, 0xF4, 0xCC,
+    0x1D, 0xF5, 0xEC, 0xD5, 0x77, 0x3F, 0x58, 0x5A, 0xBC, 0x8C, 0xCB, 0xCC, 0xBE, 0x2F, 0xA4, 0x08,
+    0x32, 0x46, 0xF2, 0xC4, 0xB8, 0xF5, 0x55, 0x1C, 0x96, 0xE6, 0xD4, 0x6D, 0x84, 0x9F, 0x17, 0xB1,
+    0x4F, 0x45, 0x20, 0x33, 0x32, 0x11, 0x1A, 0x4C, 0x03, 0xE3, 0x7D, 0xA6, 0x38, 0xD7, 0xAB, 0xA7,
+    0x2E, 0xD6, 0x3B, 0xB1, 0x2C, 0xE2, 0x96, 0xF8, 0x70, 0xE1, 0xA0, 0xE9, 0x0C, 0x5A, 0xC6, 0xDE,
+    0x35, 0xD5, 0xEC, 0xAE, 0x3E, 0xC0, 0x1C, 0x2E, 0x99, 0x9C, 0xC1, 0x9B, 0xD7, 0xF2, 0x24, 0x03,
+    0x6E, 0x84, 0xCA, 0x75, 0x64, 0x67, 0x5F, 0x15, 0x3A, 0x0F, 0xB2, 0x28, 0xED, 0xF2, 0x85, 0x5E,
+    0x85, 0x36, 0xCC, 0x12, 0x74, 0xD5, 0x48, 0x17, 0xE1, 0x99, 0xB7, 0x89, 0xF7, 0xEA, 0x0B, 0x3F,
+    0x6A, 0xB4, 0xBF, 0x72, 0x9B, 0x64, 0x96, 0x09, 0xC8, 0x85, 0x07, 0x0F, 0x4C, 0xB5, 0x08, 0xFF,
+    0xA9, 0x8D, 0xCB, 0x75, 0xED, 0x4D, 0x16, 0x17, 0x5B, 0x18, 0x07, 0x08, 0xEC, 0x21, 0xAA, 0x06,
+    0xE2, 0xD4, 0x99, 0x62, 0x05, 0x89, 0xB6, 0xA1, 0xBB, 0x81, 0xCA, 0xA4, 0x6D, 0xDB, 0x33, 0x65,
+    0x88, 0x21, 0x72, 0xCC, 0x06, 0xA7, 0x3F, 0x56, 0x40, 0xF6, 0x1C, 0x2E, 0x05, 0x37, 0x1D, 0xB0,
+    0xAE, 0xEC, 0x9A, 0xC1, 0xE6, 0xBC, 0xA9, 0x96, 0x53, 0x5D, 0x5E, 0x5C, 0x58, 0x59, 0x58, 0x5B,
+    0x68, 0xB5, 0xE2, 0xE2, 0x42, 0xDA, 0x54, 0x40, 0x6E, 0x32, 0x94, 0x81, 0xC5, 0xB1, 0x76, 0xA0,
+    0xBB, 0xBA, 0x8C, 0x6C, 0x9C, 0x9D, 0xA0, 0x0A, 0x9C, 0xB6, 0x0D, 0x28, 0x71, 0x43, 0xAE, 0x3E,
+    0xC7, 0xF3, 0x1C, 0x3A, 0x63, 0x41, 0x1C, 0xE6, 0xA9, 0x32, 0xA4, 0xFB, 0x21, 0x7D, 0x22, 0xA9,
+    0x34, 0x40, 0x3C, 0x0E, 0xD2, 0xC8, 0x9B, 0x34, 0x85, 0xC9, 0x7A, 0x1C, 0x7D, 0x16, 0xE4, 0x1E,
+    0xC7, 0x9B, 0x99, 0xB6, 0x7B, 0x4E, 0xBB, 0xEE, 0x63, 0xED, 0x96, 0x92, 0x9D, 0x1C, 0x11, 0x0E,
+    0x58, 0x26, 0x75, 0xC8, 0x64, 0x2F, 0x48, 0x66, 0xBE, 0x61, 0x11, 0x70, 0xCA, 0x62, 0x8B, 0x19,
+    0x1B, 0xDC, 0x2B, 0x9D, 0x44, 0x80, 0xFD, 0x72, 0x75, 0xC8, 0x94, 0x6F, 0xAD, 0x93, 0xA5, 0x92,
+    0xEA, 0x0A, 0x1E, 0x57, 0x1D, 0x0A, 0xAE, 0xF7, 0xB1, 0x8A, 0x84, 0x00, 0x11, 0x5B, 0xCE, 0xF8,
+    0xBC, 0x83, 0x64, 0xAC, 0xEA, 0xCA, 0x4A, 0x81, 0x9B, 0x2D, 0x79, 0xCA, 0xB8, 0xAB, 0x87, 0x9E,
+    0x1E, 0x13, 0x40, 0x59, 0xB6, 0x6C, 0x83, 0xF6, 0x80, 0xA1, 0xCD, 0x75, 0xA9, 0xED, 0x7D, 0xDB,
+    0xDC, 0x77, 0x7B, 0x01, 0x70, 0x85, 0xED, 0x6B, 0xB2, 0x7B, 0x40, 0x71, 0xE5, 0x00, 0x9D, 0xE0,
+    0x65, 0x72, 0xFC, 0xE5, 0x6B, 0xED, 0x96, 0xF7, 0xD3, 0x63, 0x02, 0xCC, 0x03, 0x77, 0x99, 0x2D,
+    0x72, 0xD2, 0xCC, 0x88, 0xD8, 0xF8, 0xBB, 0x93, 0x16, 0xE2, 0xED, 0x1D, 0x76, 0xC9, 0x64, 0x3E,
+    0xCE, 0x10, 0x96, 0x30, 0xA3, 0xFA, 0x65, 0x9B, 0xD3, 0x3C, 0x1C, 0x25, 0xA7, 0x69, 0x19, 0x31,
+    0x37, 0x18, 0x4E, 0x97, 0x23, 0x5F, 0x22, 0x2E, 0x27, 0x8E, 0x8A, 0x95, 0x40, 0x97, 0x23, 0x60,
+    0x06, 0x2C, 0xE1, 0xCF, 0x2B, 0xE2, 0x4A, 0x58, 0xF0, 0x80, 0x31, 0x95, 0xF9, 0x81, 0x5B, 0x7F,
+    0x66, 0xB2, 0x82, 0xFB, 0x8E, 0x19, 0xDE, 0x27, 0x83, 0x2E, 0xDB, 0xAC, 0x8D, 0x11, 0xB3, 0xB7,
+    0x19, 0xCC, 0x76, 0xFA, 0xFD, 0x23, 0x7A, 0xE0, 0x2B, 0x0E, 0xBF, 0x53, 0x92, 0x52, 0x05, 0x3D,
+    0x1A, 0x03, 0x4F, 0x24, 0x5B, 0x4F, 0x20, 0xC8, 0x5A, 0x5A, 0xB8, 0x3E, 0xB3, 0x7F, 0x77, 0x19,
+    0xE9, 0xFE, 0xB6, 0x04, 0x78, 0x21, 0x71, 0x22, 0x65, 0x17, 0x16, 0xA7, 0xE4, 0xB7, 0x41, 0x54,
+    0x55, 0x74, 0x45, 0x3F, 0x25, 0x9E, 0x30, 0x34, 0xB0, 0x94, 0xB8, 0x4D, 0x02, 0xFA, 0x6C, 0x50,
+    0x21, 0xF2, 0xBE, 0x00, 0xD1, 0x1D, 0xC5, 0xB4, 0xD3, 0x84, 0xD0, 0xA6, 0x24, 0x07, 0x49, 0x2B,
+    0x95, 0x36, 0x85, 0xE0, 0x1F, 0x89, 0xE8, 0xB5, 0xFF, 0x17, 0xED, 0x88, 0x95, 0x0F, 0x37, 0x99,
+    0x63, 0xEB, 0x43, 0x1A, 0x67, 0x4B, 0x9C, 0xF3, 0x95, 0x47, 0x64, 0x62, 0x2C, 0xB6, 0x8B, 0xA9,
+    0xB3, 0x91, 0xD4, 0x54, 0xAC, 0x0D, 0x24, 0x5C, 0xBC, 0xD5, 0x05, 0x43, 0xC5, 0x5C, 0x7A, 0x7C,
+    0x02, 0x71, 0x17, 0x3C, 0xA4, 0x56, 0xEC, 0x4D, 0xE3, 0x14, 0x9F, 0x40, 0xFC, 0x65, 0x43, 0x84,
+    0xB9, 0xE8, 0xE8, 0x48, 0x09, 0x4F, 0xA4, 0x43, 0x98, 0x76, 0x36, 0xBD, 0xF5, 0x17, 0x53, 0x85,
+    0x94, 0xAE, 0x9E, 0x62, 0xD6, 0x32, 0x63, 0x29, 0x44, 0x47, 0x2A, 0x2F, 0xA0, 0xB5, 0x4E, 0xE3,
+    0xEA, 0x96, 0xD9, 0xC6, 0x04, 0x55, 0x84, 0x62, 0x38, 0x20, 0x55, 0x22, 0xA2, 0x86, 0xAD, 0x95,
+    0xB2, 0xD7, 0xDB, 0x59, 0x92, 0xF2, 0x87, 0x9B, 0xE7, 0xF9, 0xA3, 0xE7, 0xF8, 0xB0, 0x69, 0xA7,
+    0x06, 0xE3, 0xBC, 0xD8, 0x1A, 0x38, 0xB1, 0x13, 0xDC, 0x5A, 0xAB, 0xC0, 0x86, 0xEF, 0xB9, 0x09,
+    0xAA, 0x48, 0x15, 0x50, 0x7E, 0x9E, 0x8A, 0x1A, 0xB3, 0x56, 0x2A, 0x90, 0x54, 0x5B, 0xD6, 0x88,
+    0x22, 0xF4, 0x29, 0x20, 0xC5, 0x89, 0xB6, 0x90, 0x8D, 0x26, 0x2A, 0xBC, 0x17, 0x6D, 0x49, 0xED,
+    0x3A, 0x7E, 0xAD, 0x8D, 0x36, 0x9F, 0xD5, 0x34, 0xC2, 0xF7, 0xA5, 0xB6, 0x88, 0x83, 0x6F, 0x6E,
+    0x4B, 0x55, 0x83, 0x3A, 0xBE, 0x08, 0x25, 0xDE, 0xB8, 0x48, 0x4A, 0x1E, 0x66, 0xF5, 0xAD, 0x3D,
+    0x18, 0xCA, 0x6D, 0x9F, 0xDE, 0xA2, 0xD6, 0xFA, 0xFD, 0x43, 0x51, 0xB2, 0xCF, 0xCF, 0x39, 0xD7,
+    0x87, 0xBC, 0xB5, 0x53, 0x4E, 0x8F, 0xCF, 0x49, 0xBB, 0x33, 0x92, 0x3D, 0xF4, 0x82, 0xF9, 0x23,
+    0x29, 0x81, 0x80, 0x4B, 0x50, 0x9C, 0x4E, 0x9D, 0x78, 0x5B, 0x0C, 0xB0, 0xF5, 0xDF, 0x0F, 0x67,
+    0xF9, 0xA0, 0x7C, 0xAA, 0x48, 0x79, 0x50, 0x28, 0xEF, 0xCF, 0xA4, 0x7F, 0x1C, 0x33, 0x70, 0x71,
+    0xC8, 0xFF, 0x2F, 0x5C, 0x15, 0xEA, 0x72, 0x42, 0xCC, 0xE4, 0x83, 0x34, 0xA9, 0x1A, 0xAE, 0xCB,
+    0x8C, 0x9B, 0x66, 0x43, 0x3A, 0x05, 0x7F, 0x45, 0x18, 0x09, 0xC7, 0x91, 0x9C, 0xEA, 0xFA, 0x7B,
+    0xC0, 0xCF, 0x27, 0x5B, 0x86, 0x2F, 0xBF, 0xBD, 0x4A, 0x43, 0x48, 0x2C, 0xE6, 0x5F, 0x9D, 0xF8,
+    0x2F, 0xBB, 0x95, 0x2C, 0x48, 0xD9, 0x93, 0xC1, 0x43, 0x31, 0x2D, 0xA5, 0x7F, 0x8E, 0x25, 0xAD,
+    0x0D, 0x0B, 0xA7, 0x67, 0xD3, 0x64, 0xFF, 0x74, 0x34, 0xFF, 0x53, 0xC8, 0x7F, 0x7D, 0xFD, 0x01,
+    0xBD, 0x55, 0xBD, 0x6E, 0xD4, 0x40, 0x10, 0xFE, 0x6C, 0xEB, 0x62, 0x81, 0x91, 0xB6, 0x09, 0x05,
+    0x34, 0x6E, 0x11, 0x82, 0xB8, 0x42, 0xA2, 0xE0, 0x62, 0xF3, 0x06, 0x29, 0x02, 0x05, 0x42, 0xE2,
+    0x01, 0x68, 0x28, 0x28, 0x73, 0x9C, 0xC5, 0x0B, 0x70, 0x0D, 0xFD, 0x35, 0x48, 0x51, 0x9A, 0xE3,
+    0x01, 0x2E, 0xDC, 0x22, 0x8A, 0x14, 0x14, 0xF8, 0x11, 0x2C, 0xFE, 0x24, 0xA8, 0x56, 0x60, 0x09,
+    0x23, 0xEC, 0x2C, 0xDF, 0xAC, 0xEF, 0x2E, 0x7F, 0x10, 0x09, 0x09, 0xC5, 0xC9, 0xAD, 0xC6, 0x3B,
+    0xE3, 0x99, 0xD9, 0x6F, 0xBE, 0x99, 0x05, 0xE4, 0xF1, 0x35, 0x97, 0x86, 0xBF, 0xF7, 0x05, 0x30,
+    0x3E, 0x4F, 0xE1, 0x62, 0x06, 0x6B, 0x0D, 0x86, 0xB6, 0xC6, 0x1A, 0x5F, 0x55, 0x06, 0x84, 0x34,
+    0xF2, 0x0D, 0x5F, 0x7E, 0xDE, 0x03, 0x52, 0xAB, 0x11, 0xDB, 0x12, 0x2A, 0x07, 0x02, 0x7E, 0xE4,
+    0x89, 0x62, 0xCA, 0x5F, 0xBA, 0xB3, 0x4D, 0x85, 0xCD, 0x22, 0x6B, 0x8B, 0xC0, 0xDA, 0x8A, 0x5B,
+    0xAB, 0x5E, 0x46, 0x9B, 0x2D, 0x60, 0x57, 0x69, 0xA8, 0xD7, 0x0D, 0x0E, 0x1E, 0xEF, 0x0E, 0x5C,
+    0x9C, 0xD8, 0xEE, 0xC3, 0x2F, 0xB9, 0xD1, 0x47, 0x17, 0xC8, 0xF9, 0x52, 0xCF, 0xC7, 0xA2, 0x86,
+    0x8B, 0x14, 0x9C, 0x54, 0x7F, 0xDD, 0x81, 0x27, 0x21, 0x12, 0xC6, 0xEB, 0x62, 0x5D, 0x01, 0xB6,
+    0xDC, 0xFF, 0xE6, 0x32, 0x44, 0x58, 0x22, 0xCE, 0x68, 0x1F, 0x18, 0x49, 0x76, 0x20, 0x47, 0x60,
+    0x1A, 0xEB, 0xF0, 0x2A, 0x44, 0x1A, 0x29, 0xBC, 0x1A, 0x51, 0x89, 0x34, 0xF3, 0x1A, 0x44, 0x06,
+    0x49, 0x8E, 0x05, 0x22, 0x1E, 0xE3, 0x30, 0xA6, 0xC1, 0x9F, 0x9E, 0x27, 0x10, 0xAF, 0x74, 0x40,
+    0xB7, 0xA8, 0x41, 0xBF, 0x48, 0x20, 0x8E, 0x99, 0x26, 0x3D, 0x4B, 0x7E, 0x29, 0x4D, 0x72, 0xF1,
+    0x1D, 0x54, 0xA0, 0x73, 0xCC, 0xB0, 0xF4, 0x1E, 0x68, 0xB7, 0x43, 0xB4, 0xCB, 0x73, 0xFF, 0xC1,
+    0x63, 0x3F, 0xD4, 0x61, 0x31, 0x45, 0xA3, 0x74, 0x2F, 0xDB, 0x3C, 0x8C, 0x6E, 0xED, 0x7C, 0x4A,
+    0xD1, 0xF8, 0xA9, 0x00, 0x48, 0xA7, 0x8C, 0x20, 0xA5, 0x26, 0x16, 0xE2, 0x95, 0x21, 0x24, 0x1E,
+    0x83, 0xD3, 0x2D, 0x5A, 0xDA, 0x6B, 0xF8, 0xCD, 0xDC, 0x6F, 0xBC, 0x3F, 0x62, 0x10, 0xE2, 0xEA,
+    0xC0, 0x55, 0x88, 0x0D, 0xB3, 0x88, 0x0A, 0x3A, 0x52, 0x9A, 0x8C, 0x48, 0x05, 0xE8, 0x66, 0x68,
+    0xCB, 0xE0, 0x3B, 0x0B, 0xA0, 0x34, 0x9D, 0xBF, 0x22, 0x0F, 0x82, 0x8A, 0x21, 0x86, 0x3A, 0xBD,
+    0x3B, 0x69, 0x59, 0x3C, 0x5B, 0x86, 0x96, 0xC5, 0x65, 0x89, 0x0A, 0xBE, 0x8D, 0x0E, 0x92, 0x1B,
+    0x5C, 0xE0, 0x72, 0x63, 0x8F, 0xCB, 0xB5, 0x24, 0x5B, 0xEE, 0xAE, 0xE4, 0x18, 0x4A, 0x46, 0x89,
+    0x26, 0x06, 0xAA, 0x62, 0x84, 0xB0, 0x65, 0x20, 0xDF, 0xE6, 0x4C, 0xF8, 0x97, 0xA1, 0xE7, 0x41,
+    0x43, 0x75, 0x9A, 0xDC, 0xA6, 0x7A, 0xAF, 0xD8, 0x65, 0x79, 0xEB, 0x94, 0x21, 0x53, 0x02, 0xD3,
+    0x44, 0x6F, 0x0B, 0xCC, 0xFC, 0x1F, 0x54, 0xE7, 0x43, 0xAA, 0x0B, 0xD5, 0xB2, 0xA4, 0x81, 0x45,
+    0xD0, 0x60, 0x96, 0x2F, 0x41, 0x11, 0x1E, 0xC9, 0xB9, 0x59, 0xE4, 0xF1, 0x91, 0x9A, 0xFA, 0x64,
+    0x19, 0xC8, 0xDB, 0x0C, 0xEA, 0x23, 0xA9, 0xA0, 0x4A, 0xE2, 0xA1, 0x0A, 0x42, 0x1E, 0x0A, 0xFB,
+    0xBA, 0xB2, 0x54, 0xC2, 0xC1, 0xA9, 0x34, 0xC4, 0xBA, 0x40, 0xC9, 0xA4, 0xA8, 0x29, 0xE1, 0x57,
+    0xC4, 0x94, 0xB8, 0xA5, 0x5F, 0x1E, 0xF2, 0x1B, 0x39, 0xB0, 0x6F, 0x85, 0xB8, 0x29, 0x25, 0x78,
+    0xB3, 0xFA, 0x04, 0x7F, 0x5E, 0xCA, 0xF2, 0x58, 0x96, 0x9B, 0xB2, 0xDC, 0xC2, 0x69, 0xCF, 0x99,
+    0x24, 0xE6, 0x66, 0x80, 0x1B, 0x02, 0xF8, 0xC6, 0x86, 0xC6, 0x78, 0xC9, 0xCC, 0xC8, 0x12, 0xBC,
+    0xC4, 0x92, 0x1C, 0xE9, 0x88, 0x75, 0x49, 0x73, 0xD2, 0x2F, 0xCD, 0xC8, 0x19, 0x62, 0xAE, 0x72,
+    0xC7, 0x50, 0x19, 0x01, 0x95, 0xF0, 0xAC, 0x2F, 0xD4, 0x4D, 0xD8, 0x5E, 0xA2, 0xC9, 0x85, 0x2C,
+    0x46, 0xDA, 0xCA, 0xBE, 0x98, 0xF0, 0x1B, 0xCB, 0x69, 0xC2, 0x63, 0x34, 0xD2, 0xD4, 0x34, 0x5B,
+    0xB1, 0xE5, 0xB1, 0x83, 0xD6, 0xEC, 0x5F, 0x7C, 0xB8, 0xCF, 0xE5, 0xD1, 0xE0, 0xEC, 0x11, 0xE8,
+    0x61, 0x03, 0xDD, 0xA0, 0xF2, 0x2B, 0xF6, 0x0B, 0xDA, 0x58, 0x9F, 0x71, 0x0E, 0xE1, 0xD3, 0x62,
+    0xCD, 0xD0, 0x34, 0x29, 0xD4, 0xC4, 0x1F, 0x6D, 0x2F, 0xB6, 0x2F, 0x2F, 0x84, 0x38, 0xFB, 0x07,
+    0x41, 0xE5, 0x47, 0x85, 0xC8, 0x3E, 0xE8, 0x04, 0xF6, 0x62, 0x27, 0xB8, 0x72, 0x3A, 0x21, 0x57,
+    0x55, 0x27, 0x64, 0x6A, 0xBF, 0xF3, 0x92, 0xAB, 0x77, 0xCE, 0x88, 0x9D, 0xFE, 0xC6, 0x95, 0x29,
+    0x28, 0x94, 0x76, 0x46, 0xBE, 0x51, 0xBA, 0xDF, 0x95, 0x4B, 0x69, 0xD7, 0x47, 0x58, 0x57, 0xBA,
+    0x0B, 0xA2, 0x9E, 0xE9, 0xA8, 0x70, 0xD6, 0xB6, 0x88, 0xBA, 0xC9, 0x69, 0x3F, 0x4D, 0xE6, 0xBE,
+    0x5D, 0xD1, 0xC5, 0xC8, 0x51, 0xA0, 0x13, 0xE6, 0x3B, 0x9F, 0xE7, 0x54, 0x50, 0x0B, 0x46, 0x9C,
+    0x22, 0x44, 0x4B, 0xC1, 0x1C, 0xDF, 0xE9, 0x1D, 0x2A, 0xD7, 0x25, 0xCC, 0xEF, 0x8B, 0x6E, 0x59,
+    0x3D, 0xA4, 0x5A, 0x19, 0xE3, 0x6A, 0xC6, 0x09, 0xD7, 0xF2, 0x2F, 0x34, 0x32, 0x6D, 0x72, 0x96,
+    0xBA, 0xC5, 0x2E, 0x27, 0x0F, 0xDF, 0x62, 0x4D, 0x4E, 0x0F, 0xC8, 0x6F, 0xDF, 0x70, 0x44, 0x2A,
+    0x2D, 0x43, 0x47, 0x66, 0x90, 0x91, 0x91, 0xA4, 0x43, 0xE3, 0xB5, 0x72, 0xC3, 0xC9, 0xE5, 0x48,
+    0x1C, 0xE5, 0x2C, 0xDE, 0x02, 0x50, 0x57, 0xC3, 0x45, 0x53, 0x07, 0x82, 0xED, 0xF5, 0xBF, 0x77,
+    0xF5, 0x26, 0x7A, 0x1B, 0xEE, 0xE6, 0x71, 0x77, 0x8F, 0xDC, 0x3E, 0x21, 0x27, 0x97, 0xE4, 0x25,
+    0x6F, 0x5D, 0x26, 0x19, 0x61, 0x9D, 0x32, 0x7A, 0x60, 0xE4, 0xDA, 0x92, 0x5E, 0x9B, 0xB2, 0xB7,
+    0x02, 0xC3, 0x0F, 0x86, 0x59, 0x28, 0xB1, 0x99, 0x49, 0x29, 0xD0, 0x82, 0xE9, 0x94, 0xF8, 0xE7,
+    0xE7, 0x37, 0x9D, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x26, 0xF6, 0x4A, 0x19, 0xC8,
+    0xA4, 0x30, 0x2E, 0xC8, 0xE5, 0x96, 0x12, 0xA1, 0xD8, 0xDB, 0xA4, 0x70, 0x71, 0xF1, 0x0D, 0xFC,
+    0x01, 0x28, 0x22, 0x9A, 0x48, 0x88, 0x96, 0xCA, 0x29, 0x2C, 0x71, 0x85, 0xF1, 0x4D, 0x44, 0x81,
+    0x28, 0x90, 0xDC, 0xD0, 0xA7, 0x4E, 0x15, 0x84, 0x11, 0x46, 0x72, 0xB8, 0x91, 0xFC, 0x07, 0xB6,
+    0xA6, 0x61, 0x15, 0x85, 0x02, 0x9A, 0x8C, 0xC4, 0x16, 0x1B, 0xE5, 0xEE, 0x86, 0x6F, 0x76, 0xEF,
+    0x8C, 0x2D, 0x19, 0xC1, 0x31, 0xD2, 0xDD, 0xCC, 0xEE, 0xCE, 0xFB, 0xDE, 0x7B, 0xDF, 0xFB, 0xE6,
+    0x0D, 0xD0, 0x8E, 0xDB, 0xE9, 0x6F, 0xC6, 0x9F, 0xEE, 0xF3, 0xEF, 0xE1, 0xF5, 0xEE, 0xED, 0xFA,
+    0x63, 0xBC, 0x67, 0x0B, 0xC7, 0x0F, 0x33, 0x64, 0x41, 0x05, 0x14, 0x2E, 0xF7, 0x5C, 0x3F, 0x83,
+    0x4A, 0x4F, 0xB9, 0x33, 0x9E, 0xEB, 0x43, 0xC8, 0x20, 0x6A, 0x18, 0xAF, 0x3D, 0xBE, 0xC0, 0x90,
+    0x4F, 0x68, 0xF8, 0x94, 0x05, 0x31, 0x43, 0x1E, 0x63, 0xC0, 0x38, 0x46, 0x87, 0x18, 0xA7, 0x10,
+    0x69, 0xB1, 0x18, 0x85, 0x2A, 0x81, 0x26, 0xB7, 0xD0, 0xD5, 0x14, 0x78, 0x4B, 0x7C, 0x84, 0xF3,
+    0xF1, 0x6F, 0x6E, 0xBD, 0x49, 0x8E, 0x2E, 0xBA, 0x3D, 0xFC, 0xCF, 0x6E, 0x95, 0x05, 0x76, 0x00,
+    0xE9, 0x17, 0x39, 0x5F, 0x31, 0x18, 0x98, 0xF9, 0xD0, 0xA1, 0x19, 0x42, 0xFB, 0x53, 0x3C, 0x13,
+    0x4D, 0x56, 0xA9, 0x30, 0x84, 0x39, 0x0B, 0x18, 0x8E, 0x2D, 0x26, 0x0D, 0x01, 0x3D, 0x14, 0xA3,
+    0x36, 0x4C, 0x61, 0x4C, 0xB0, 0xA6, 0x5B, 0x4E, 0xD0, 0xBE, 0x2D, 0xAA, 0x0E, 0x67, 0x8B, 0x6F,
+    0xF9, 0xE6, 0x15, 0xB7, 0x07, 0xD4, 0x43, 0x0C, 0x64, 0x95, 0x63, 0xA0, 0x9D, 0x51, 0xA5, 0x76,
+    0x21, 0xF7, 0x07, 0x7B, 0xAE, 0x88, 0xD6, 0xFC, 0x0E, 0xE5, 0x21, 0x68, 0x53, 0x2F, 0x03, 0xD0,
+    0x2C, 0x44, 0xDD, 0xA3, 0xF1, 0x5D, 0xEC, 0xE3, 0x48, 0xF9, 0x43, 0x18, 0x86, 0x3D, 0x7A, 0x17,
+    0xB2, 0x64, 0x68, 0x0C, 0xFD, 0x20, 0x2B, 0x65, 0x95, 0x79, 0x63, 0xB5, 0x3D, 0xC0, 0x96, 0xFC,
+    0xF3, 0x41, 0x30, 0xBF, 0x46, 0xBB, 0x3B, 0x26, 0x88, 0xA0, 0xFD, 0x3D, 0x4E, 0x04, 0x5B, 0xEF,
+    0x92, 0xDE, 0xFB, 0x1A, 0x45, 0xA4, 0xC7, 0x53, 0x51, 0x29, 0x3F, 0xA0, 0xAD, 0xCD, 0xDC, 0x53,
+    0x34, 0x06, 0x85, 0x6D, 0xF2, 0x60, 0x62, 0xC4, 0x78, 0x1E, 0xC4, 0xFC, 0x93, 0x85, 0xF3, 0x1E,
+    0x43, 0xA6, 0x61, 0x68, 0xE3, 0xBF, 0x3C, 0x56, 0x40, 0xDA, 0xE9, 0x58, 0xE9, 0x73, 0x2E, 0x7B,
+    0xAD, 0xF1, 0xAD, 0xE7, 0x56, 0xC6, 0x19, 0xB6, 0x59, 0x34, 0x5A, 0x1B, 0xE4, 0xCC, 0x6D, 0x24,
+    0xBD, 0xAA, 0x92, 0xF9, 0x6E, 0x36, 0x65, 0xA5, 0x82, 0x88, 0xAF, 0x7D, 0x6B, 0x2F, 0xAB, 0x87,
+    0xF8, 0xFC, 0x3A, 0x6E, 0xDC, 0xF6, 0x28, 0x4F, 0x56, 0xF4, 0xAD, 0x7D, 0x8D, 0x5D, 0x12, 0xC4,
+    0xFA, 0xAD, 0xD9, 0xFB, 0xAB, 0xFB, 0xC6, 0x36, 0xB0, 0xB6, 0x01, 0x9C, 0x11, 0xAA, 0x3C, 0x97,
+    0x64, 0x73, 0x94, 0x10, 0x4E, 0xB4, 0xEF, 0x63, 0xA0, 0x7C, 0xE6, 0x09, 0xA0, 0x61, 0x5C, 0x90,
+    0xB5, 0x79, 0x14, 0x93, 0x7D, 0x16, 0x5F, 0x22, 0xFF, 0xAD, 0x2D, 0xFD, 0x46, 0xF2, 0x68, 0x66,
+    0x90, 0x31, 0xB2, 0x8C, 0xDB, 0x72, 0x8E, 0x1D, 0xFA, 0xAD, 0x36, 0xE9, 0x8E, 0xC2, 0x74, 0xFB,
+    0x18, 0x3F, 0xB9, 0x9F, 0xBC, 0x27, 0x7D, 0x50, 0xE6, 0x8C, 0x36, 0xDA, 0x6B, 0xC4, 0x88, 0xAF,
+    0x53, 0x14, 0x31, 0xA6, 0x38, 0xF6, 0x9A, 0x2E, 0xED, 0xD2, 0x44, 0x3B, 0x65, 0x4E, 0x18, 0x40,
+    0x04, 0x68, 0x87, 0x5D, 0x60, 0x0A, 0x39, 0x7F, 0xAC, 0x62, 0xB5, 0x1E, 0x1D, 0xCB, 0xFD, 0xB6,
+    0xC5, 0x3A, 0xB2, 0x4E, 0x73, 0x19, 0x65, 0x7D, 0x9A, 0x28, 0xB8, 0x50, 0xB5, 0x6B, 0xD4, 0x68,
+    0xC0, 0x4F, 0x1A, 0xC7, 0x28, 0x47, 0x6B, 0xC7, 0xC3, 0x38, 0xCF, 0xFF, 0xF8, 0x56, 0xDB, 0x24,
+    0x73, 0x9E, 0xA8, 0x9B, 0x79, 0x9C, 0xCA, 0x38, 0xC7, 0xAD, 0x57, 0x69, 0x6F, 0xD9, 0x56, 0x4E,
+    0xA3, 0xD5, 0xE3, 0x95, 0xC3, 0xB6, 0xE2, 0x27, 0xDA, 0x16, 0xEE, 0x66, 0xEE, 0x81, 0x8D, 0xB1,
+    0x21, 0x9C, 0x2C, 0x5B, 0xD5, 0xC9, 0x1A, 0x96, 0x78, 0x98, 0x30, 0xB0, 0xC9, 0xD1, 0x79, 0x67,
+    0x51, 0x14, 0xE3, 0x0F, 0x15, 0x7A, 0xC2, 0xAF, 0x0E, 0x21, 0x58, 0xC2, 0x82, 0x54, 0x4D, 0x73,
+    0xAB, 0xAB, 0xD9, 0xA5, 0x50, 0x6E, 0x02, 0x39, 0xA9, 0x78, 0x71, 0x27, 0x01, 0x89, 0x6A, 0x93,
+    0x54, 0x45, 0x97, 0xA8, 0x25, 0x92, 0xE1, 0x31, 0x2F, 0x48, 0xEA, 0x98, 0x47, 0x8F, 0x50, 0xD8,
+    0x7B, 0x91, 0x2C, 0x8E, 0xD3, 0xFB, 0x8E, 0xD8, 0xF5, 0xD4, 0x02, 0x2A, 0xEA, 0xE0, 0x0E, 0x8B,
+    0xA0, 0x1C, 0x6D, 0x6A, 0x52, 0x5C, 0x24, 0x86, 0x81, 0xA7, 0xC8, 0x12, 0x11, 0xCA, 0x5F, 0xCE,
+    0x5D, 0xB8, 0x44, 0xCD, 0x0E, 0x44, 0x99, 0xE6, 0x01, 0x68, 0x4F, 0x1E, 0xEF, 0xB5, 0x85, 0xF1,
+    0x49, 0x36, 0xA9, 0x79, 0x78, 0xF6, 0x27, 0x3C, 0xF7, 0x37, 0x90, 0xF2, 0x5F, 0x6E, 0xCB, 0x2E,
+    0x6E, 0xC7, 0x72, 0xBB, 0xB0, 0x1B, 0xB9, 0xAA, 0xA6, 0xF9, 0x57, 0xE1, 0xE7, 0x85, 0x03, 0x30,
+    0x1C, 0x7E, 0xE6, 0x69, 0xEF, 0x66, 0x97, 0x0E, 0x61, 0x9D, 0x40, 0x0B, 0xE0, 0x64, 0xB1, 0x05,
+    0x6C, 0x76, 0x6D, 0x32, 0xC8, 0x28, 0x7B, 0xA6, 0xC7, 0x5A, 0xB1, 0x6B, 0x6F, 0xBE, 0x4F, 0xD7,
+    0xF3, 0x01, 0xB2, 0xF2, 0x47, 0x8B, 0xD4, 0x27, 0xB7, 0xE9, 0x4B, 0x79, 0x95, 0xA4, 0x33, 0x62,
+    0xB5, 0x73, 0xDA, 0xBD, 0x2C, 0xC9, 0x3D, 0xAB, 0x91, 0x75, 0x24, 0x1C, 0xBC, 0x01, 0xFC, 0xD2,
+    0x83, 0x38, 0xDB, 0x87, 0x7C, 0x14, 0xCE, 0xF3, 0x7C, 0xE7, 0xB3, 0x84, 0x6A, 0x31, 0xA7, 0x9C,
+    0x6A, 0xE5, 0x65, 0x20, 0x4A, 0x99, 0x11, 0xC9, 0x38, 0xCD, 0xA6, 0x63, 0x7C, 0x4E, 0xE5, 0x17,
+    0xE4, 0x77, 0xC8, 0x48, 0xA8, 0xC7, 0x8C, 0x64, 0x73, 0x6A, 0x99, 0xB5, 0x17, 0xF9, 0x9A, 0x38,
+    0x4C, 0xE6, 0x8C, 0x23, 0x68, 0x97, 0xB9, 0x80, 0xFD, 0x3E, 0xF4, 0x07, 0x25, 0xC2, 0x16, 0xFA,
+    0x32, 0xE8, 0x32, 0x8F, 0x0D, 0xA8, 0x3C, 0x1E, 0x8F, 0xB4, 0xD7, 0xB7, 0xD2, 0x63, 0xC3, 0x94,
+    0x25, 0xFE, 0x69, 0xAC, 0x02, 0xF8, 0xB7, 0xF4, 0xBE, 0xA3, 0xF4, 0xA4, 0x5B, 0x1D, 0x42, 0x56,
+    0x9F, 0xE2, 0xFB, 0x6F, 0xF0, 0x26, 0x6F, 0x1B, 0xFB, 0x3F, 0xA3, 0xB8, 0xA2, 0x17, 0x2D, 0x1B,
+    0x0A, 0x3F, 0x13, 0x44, 0xBB, 0x01, 0xEB, 0x3A, 0x52, 0x5E, 0x94, 0x44, 0xB1, 0xC7, 0xBC, 0x24,
+    0x4A, 0x51, 0x69, 0x5F, 0xD8, 0x04, 0x33, 0xA4, 0x72, 0xDB, 0xDB, 0x44, 0xD8, 0xF6, 0x5C, 0x33,
+    0x12, 0xD9, 0x2C, 0x11, 0xD6, 0x3E, 0x7E, 0xF2, 0x65, 0xBA, 0xDD, 0xD2, 0x12, 0xED, 0xED, 0x51,
+    0xF0, 0x50, 0x07, 0xAC, 0x36, 0xFE, 0x02, 0xBD, 0x55, 0x21, 0x8F, 0x1B, 0x47, 0x14, 0xFE, 0x66,
+    0xB6, 0xE7, 0x05, 0xAB, 0x66, 0x4A, 0x8A, 0x7A, 0xE7, 0x25, 0x05, 0x05, 0xC9, 0x6D, 0x40, 0x40,
+    0x80, 0xCF, 0x5E, 0xE5, 0x0F, 0x24, 0x20, 0x0A, 0x28, 0x28, 0x2E, 0x0B, 0x09, 0x30, 0x70, 0xEB,
+    0xAD, 0x82, 0xAA, 0x82, 0x84, 0x95, 0x06, 0xB6, 0x21, 0x4D, 0xA5, 0x03, 0x06, 0xCE, 0x79, 0x7E,
+    0xC2, 0x4A, 0x01, 0xA1, 0x4B, 0x22, 0x45, 0x25, 0x1D, 0xB0, 0xC0, 0x4A, 0xEE, 0x76, 0xFA, 0x7D,
+    0x7B, 0xE7, 0x3B, 0x2B, 0xD1, 0xA9, 0x55, 0xA4, 0xDE, 0x58, 0x7E, 0x5A, 0xEF, 0xBC, 0x79, 0xDF,
+    0xF7, 0xBE, 0xF7, 0xE6, 0x19, 0x00, 0x0C, 0xBF, 0x48, 0x2A, 0x3D, 0x79, 0x3D, 0x36, 0x32, 0x2F,
+    0x64, 0x6E, 0xCB, 0x5C, 0x97, 0xD9, 0x93, 0x71, 0x32, 0x69, 0x49, 0xBF, 0x15, 0x1D, 0x6D, 0x3C,
+    0xA6, 0x69, 0x62, 0x49, 0xF3, 0x27, 0xCF, 0x84, 0xE9, 0x14, 0x98, 0x8E, 0x6E, 0x00, 0x37, 0x86,
+    0xF4, 0x74, 0x77, 0xD3, 0x0A, 0xF6, 0xFD, 0x2F, 0x35, 0xB0, 0x8A, 0xDC, 0x76, 0x32, 0x26, 0x0A,
+    0xA6, 0x55, 0x9C, 0x99, 0xCC, 0x48, 0x66, 0xFF, 0x3C, 0x76, 0xA6, 0xDD, 0x44, 0x24, 0x12, 0x91,
+    0x30, 0x3D, 0x13, 0xBD, 0xDB, 0x5A, 0xDA, 0xE6, 0xD9, 0x81, 0x3F, 0xFB, 0x3D, 0xC2, 0x2C, 0xC7,
+    0x7E, 0x5A, 0xB9, 0x3B, 0x75, 0xE2, 0x83, 0x09, 0x23, 0x2C, 0x72, 0x1C, 0xA4, 0x55, 0x61, 0xBB,
+    0xE8, 0x57, 0x31, 0xE4, 0x71, 0x6D, 0xBB, 0x83, 0x53, 0x5F, 0xE5, 0x27, 0xA6, 0xC0, 0x21, 0x3E,
+    0x5C, 0xFF, 0x35, 0x0E, 0xF3, 0x4F, 0x5A, 0xD8, 0xD7, 0xA5, 0xF1, 0xDF, 0xE8, 0x1C, 0x5D, 0x67,
+    0x58, 0x0C, 0x71, 0x90, 0x95, 0x2E, 0xF1, 0xA9, 0x0F, 0xB6, 0x99, 0xA1, 0x1D, 0x62, 0x99, 0xBD,
+    0x8F, 0x36, 0x46, 0x3F, 0x8F, 0x4D, 0xB6, 0x66, 0xC6, 0x3B, 0xA6, 0x4C, 0xC2, 0x01, 0xC6, 0x59,
+    0x9D, 0x35, 0xC7, 0xE7, 0xB9, 0xA4, 0x9E, 0x87, 0x09, 0x5A, 0x1E, 0x22, 0x38, 0xE4, 0xE0, 0x69,
+    0xA2, 0x9A, 0x26, 0xF3, 0xC5, 0xDF, 0xC7, 0x3A, 0x4E, 0x58, 0xAC, 0x9E, 0x94, 0x67, 0xC5, 0x60,
+    0x55, 0x4C, 0x7D, 0x26, 0xD1, 0xE5, 0x2B, 0x30, 0x99, 0x43, 0x7E, 0x66, 0x7A, 0x4A, 0x6A, 0x66,
+    0xE1, 0xB1, 0xEF, 0x2A, 0x14, 0x39, 0x90, 0xFF, 0x48, 0xAD, 0x89, 0xEF, 0xD6, 0x94, 0x9B, 0x42,
+    0x64, 0x2A, 0x0D, 0xC3, 0x15, 0x15, 0x8B, 0x03, 0xCC, 0xB9, 0xB5, 0xE2, 0xAB, 0xDF, 0x15, 0x67,
+    0xA7, 0x6F, 0x0B, 0x01, 0x12, 0x77, 0xF2, 0x14, 0xEE, 0x08, 0xE9, 0x9D, 0xC6, 0xFA, 0x11, 0x42,
+    0x8A, 0xDB, 0xC6, 0xEF, 0xA1, 0xC9, 0xF0, 0x22, 0xF1, 0x0B, 0x34, 0x6B, 0xCC, 0x5B, 0x14, 0x8D,
+    0xCA, 0x78, 0x71, 0xA4, 0xAF, 0x2E, 0xEE, 0xED, 0xC0, 0x84, 0x02, 0x49, 0x18, 0x23, 0x0D, 0x47,
+    0xFF, 0x1B, 0x59, 0x98, 0x07, 0xBF, 0xA9, 0xCB, 0x8E, 0x3F, 0xD6, 0x83, 0xA7, 0x61, 0xF5, 0x3E,
+    0x91, 0x71, 0x4B, 0x9A, 0x5C, 0xDC, 0x46, 0x6A, 0x8B, 0x05, 0x8D, 0x61, 0x61, 0x90, 0xD4, 0x63,
+    0x22, 0x78, 0x9A, 0x1C, 0x05, 0x30, 0x96, 0x59, 0x3D, 0x5F, 0x01, 0x31, 0x46, 0x24, 0x34, 0x65,
+    0x5A, 0xA3, 0x28, 0x89, 0x5F, 0x54, 0x93, 0x52, 0x1C, 0x76, 0xBE, 0x7D, 0xC6, 0xDE, 0xAE, 0x37,
+    0x30, 0x83, 0xF5, 0x53, 0xFE, 0x2C, 0xB3, 0x6A, 0x89, 0x29, 0x82, 0x6A, 0xBB, 0x87, 0x21, 0x75,
+    0x58, 0x27, 0x3E, 0xAB, 0xDD, 0x4F, 0x11, 0x13, 0x92, 0x9B, 0x77, 0x01, 0xF3, 0x5F, 0x37, 0x3D,
+    0x9D, 0x60, 0x57, 0x82, 0x3D, 0xA2, 0xD1, 0xF5, 0xC0, 0x11, 0xAE, 0x8E, 0xBD, 0xD6, 0x2D, 0x78,
+    0x84, 0x21, 0xAF, 0x72, 0x03, 0x7B, 0x72, 0x8E, 0x68, 0x8E, 0xBE, 0x46, 0x11, 0x6B, 0xDB, 0x14,
+    0xE4, 0x3F, 0x52, 0x87, 0xA7, 0x65, 0x5A, 0x5D, 0x67, 0xD0, 0x60, 0xDB, 0xA4, 0x99, 0x7B, 0xC7,
+    0x98, 0x79, 0x5C, 0x22, 0x7F, 0xD3, 0x6C, 0x18, 0x12, 0x09, 0x13, 0x96, 0x66, 0x1C, 0x4E, 0xE9,
+    0x39, 0x57, 0x22, 0x7B, 0x5C, 0x23, 0xF5, 0x6D, 0xCF, 0xCD, 0x06, 0x57, 0x99, 0x60, 0x03, 0x9D,
+    0x97, 0x3D, 0xB1, 0x09, 0x9B, 0x9B, 0xDF, 0x36, 0x2F, 0xF1, 0x52, 0xAC, 0x9E, 0xD4, 0x7D, 0x79,
+    0x35, 0x5E, 0x52, 0x25, 0xAB, 0x96, 0x7F, 0xB9, 0x99, 0x4E, 0xC0, 0xC3, 0x9F, 0x45, 0x89, 0xDA,
+    0x9A, 0x26, 0x61, 0x03, 0xCE, 0xC4, 0x88, 0xD2, 0x3A, 0xE6, 0xB4, 0xCE, 0x83, 0x08, 0x51, 0x59,
+    0xD3, 0xB1, 0x61, 0xAE, 0x9D, 0xDE, 0x73, 0xF5, 0xC9, 0x67, 0xE7, 0x29, 0x69, 0x9C, 0xED, 0x6E,
+    0xC6, 0x5C, 0xB8, 0xF4, 0xE6, 0x0C, 0x38, 0x9F, 0x52, 0x56, 0xC9, 0x76, 0x0F, 0x2A, 0x74, 0x4A,
+    0x89, 0x34, 0x1C, 0x2B, 0x6C, 0x34, 0xB3, 0x26, 0x1A, 0x7F, 0x2A, 0x77, 0x5F, 0x08, 0xC6, 0x37,
+    0x7A, 0xC8, 0x5B, 0x7C, 0x61, 0xE2, 0xBB, 0x3F, 0xA8, 0x08, 0x65, 0x8C, 0xF1, 0x84, 0x11, 0xA2,
+    0x47, 0x16, 0xDF, 0x6E, 0x4F, 0x2D, 0xCE, 0x42, 0xDF, 0xDF, 0x8B, 0x6D, 0xF0, 0xAF, 0x5A, 0x4C,
+    0x4E, 0x14, 0xB6, 0xE8, 0x07, 0x20, 0x3B, 0xDF, 0x52, 0x82, 0x45, 0x8F, 0x94, 0xBD, 0xAB, 0xC0,
+    0xBB, 0x9F, 0x75, 0xDB, 0xFC, 0xAE, 0xA9, 0x17, 0x24, 0xF7, 0x23, 0x26, 0xF4, 0xB9, 0xA9, 0xAF,
+    0x84, 0x3E, 0x29, 0x15, 0x25, 0xD2, 0xEF, 0x80, 0x7A, 0x77, 0x8B, 0xB9, 0x8B, 0x1C, 0x68, 0x60,
+    0x35, 0x45, 0xDD, 0x84, 0x7E, 0x8E, 0x8B, 0x3E, 0x61, 0x6C, 0xF7, 0x8C, 0xDB, 0xBC, 0xC3, 0xEB,
+    0x8D, 0xFF, 0x42, 0x90, 0xD4, 0xDE, 0x8A, 0xC8, 0x97, 0x57, 0xA8, 0xFD, 0x7D, 0xFD, 0x95, 0xB0,
+    0xC7, 0x2E, 0xBA, 0x7B, 0x70, 0x82, 0xD8, 0x32, 0xC2, 0x52, 0x63, 0x34, 0x17, 0x35, 0xB2, 0x56,
+    0x07, 0xFE, 0x85, 0x49, 0xB7, 0xA1, 0x7C, 0x73, 0x40, 0xAE, 0xAF, 0x48, 0xD8, 0xA9, 0xC3, 0xA7,
+    0x97, 0xCF, 0xDA, 0x87, 0xF4, 0x9F, 0x13, 0xB2, 0x78, 0xF3, 0x7D, 0xEF, 0x9B, 0x88, 0xAC, 0xC0,
+    0x88, 0x09, 0xE9, 0x83, 0x1F, 0xCE, 0x08, 0xF7, 0xCC, 0x73, 0x31, 0x8F, 0xA5, 0x21, 0xE1, 0xE7,
+    0xC1, 0xC4, 0xD8, 0x51, 0x27, 0x4E, 0x90, 0xB9, 0xC6, 0xD6, 0xAA, 0xBB, 0xF8, 0xAB, 0xDB, 0xB5,
+    0x95, 0x7D, 0x5D, 0x49, 0x02, 0x5D, 0x88, 0x4F, 0x6F, 0x98, 0x7F, 0x5B, 0xFF, 0x00, 0xB5, 0x55,
+    0xBF, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x63, 0x67, 0x25, 0x16, 0x32, 0x69, 0xA8, 0x62, 0x7B,
+    0xDB, 0x14, 0xBE, 0x6C, 0x9B, 0xC2, 0xCE, 0x0D, 0xE1, 0x0F, 0xE0, 0x0A, 0x42, 0x01, 0x12, 0x35,
+    0x12, 0x42, 0x69, 0x5C, 0xB8, 0x88, 0xB3, 0x0B, 0x7F, 0x81, 0x91, 0x30, 0x2D, 0xD7, 0xA4, 0xE0,
+    0x1A, 0x1C, 0xE9, 0x0A, 0x90, 0x82, 0x6F, 0xFE, 0x84, 0x6D, 0x10, 0xED, 0x22, 0x19, 0x21, 0x52,
+    0x8D, 0xC4, 0x16, 0x67, 0x73, 0xB7, 0xC3, 0xFB, 0x66, 0x37, 0x3F, 0xEE, 0x1C, 0x45, 0x34, 0x19,
+    0xDD, 0x8D, 0x3C, 0x37, 0xBB, 0xDF, 0xF7, 0xBE, 0xF7, 0xDE, 0xF7, 0x19, 0x08, 0xAB, 0xDA, 0x02,
+    0xA2, 0xDF, 0x4B, 0x20, 0x6E, 0x78, 0x52, 0x06, 0x6B, 0x2B, 0x6B, 0x8F, 0x81, 0x99, 0x6F, 0xA0,
+    0x3C, 0x37, 0x8D, 0xCC, 0xE1, 0x21, 0xD2, 0x4A, 0xD5, 0xD0, 0xA5, 0x36, 0x18, 0xF2, 0x84, 0x45,
+    0xEC, 0xA0, 0x9C, 0x2E, 0xA1, 0xED, 0x3E, 0xF0, 0x28, 0xE2, 0xA9, 0x49, 0x2D, 0x0A, 0x3B, 0xFC,
+    0xE4, 0xA7, 0x25, 0xBC, 0xF7, 0x75, 0xE2, 0x7D, 0x8B, 0xDC, 0xFB, 0x8A, 0xA7, 0xE3, 0x10, 0xF7,
+    0xBA, 0x6C, 0xDB, 0x1B, 0xDC, 0xF6, 0xB6, 0x64, 0xDB, 0xE3, 0x76, 0x70, 0x87, 0x9B, 0x9B, 0x22,
+    0x6D, 0xDC, 0x08, 0xC5, 0xB2, 0x46, 0xD4, 0xE4, 0x15, 0x94, 0xD5, 0x96, 0x89, 0x19, 0x7E, 0x07,
+    0x99, 0xC1, 0x00, 0x39, 0xB0, 0x8F, 0x02, 0x18, 0x7E, 0xDF, 0x82, 0x41, 0x97, 0x80, 0xF6, 0x0B,
+    0x16, 0xD0, 0xEE, 0xBD, 0x01, 0xF4, 0xD3, 0x1E, 0xB4, 0x7D, 0x01, 0xBA, 0xF0, 0xB5, 0xFA, 0xC7,
+    0x7B, 0xA3, 0xED, 0x11, 0x70, 0xF6, 0xFF, 0x41, 0x1F, 0x08, 0x4F, 0x95, 0x24, 0x65, 0xE6, 0xA1,
+    0x77, 0xCC, 0x6C, 0x99, 0xED, 0x23, 0xA6, 0xF5, 0x87, 0x1D, 0x64, 0xCD, 0x14, 0x70, 0x98, 0x23,
+    0x29, 0x93, 0xAA, 0x43, 0xDC, 0x44, 0x0B, 0xA8, 0x8B, 0x07, 0x35, 0x52, 0xA6, 0xEC, 0x00, 0xA7,
+    0x73, 0xB7, 0x42, 0x75, 0x22, 0x3F, 0x4E, 0x4E, 0x5E, 0x95, 0xE0, 0xFD, 0x11, 0x1F, 0xF5, 0x88,
+    0x88, 0x06, 0xB7, 0xFB, 0xBC, 0x02, 0x1E, 0x44, 0x0A, 0x5C, 0x7C, 0x2A, 0x28, 0x1C, 0xAF, 0x49,
+    0xC4, 0xDD, 0x2B, 0xD7, 0xED, 0x64, 0x4C, 0x48, 0xDE, 0xC4, 0x42, 0xC2, 0x50, 0xD2, 0x86, 0x35,
+    0xF4, 0x55, 0x34, 0x39, 0x59, 0xC9, 0xBC, 0x21, 0xC9, 0x81, 0x5F, 0x52, 0xA4, 0xE6, 0x3D, 0x1C,
+    0x6E, 0x4E, 0xC9, 0x5B, 0x9D, 0x3D, 0x3B, 0xC1, 0xB4, 0x8B, 0x99, 0x56, 0x11, 0x23, 0x2D, 0x48,
+    0x46, 0x8D, 0x9B, 0x17, 0x2F, 0xF0, 0x62, 0x17, 0x38, 0x4C, 0x0C, 0x59, 0x96, 0x67, 0xEA, 0x75,
+    0xEB, 0x44, 0xF7, 0x41, 0xE6, 0x1C, 0xDF, 0x6C, 0x11, 0xCB, 0xED, 0xBE, 0xBC, 0x24, 0xC8, 0x9E,
+    0xF2, 0xAB, 0x4F, 0xC6, 0x72, 0x2D, 0xAC, 0xD5, 0x50, 0x57, 0xAF, 0x9F, 0x4D, 0xA4, 0xEC, 0x46,
+    0x04, 0x30, 0x41, 0xC6, 0xB0, 0xEE, 0xC0, 0xC2, 0x69, 0xDE, 0xB0, 0xEA, 0x25, 0xAE, 0x64, 0xE4,
+    0xC7, 0x5B, 0xDC, 0xBE, 0x67, 0xE3, 0x4A, 0x99, 0x9D, 0xE8, 0x2B, 0x26, 0x98, 0x27, 0x97, 0x8F,
+    0xCD, 0x80, 0x97, 0x4D, 0xF0, 0xB8, 0xA1, 0xAA, 0xD4, 0x60, 0x8E, 0x6B, 0x6D, 0xE0, 0x63, 0xD4,
+    0x27, 0xCE, 0x25, 0xA7, 0x5D, 0x8B, 0xB7, 0xF9, 0x71, 0xA0, 0x9F, 0xAF, 0x94, 0xA1, 0x80, 0xA6,
+    0xA7, 0x37, 0xEF, 0xF1, 0x2B, 0x72, 0x12, 0xC8, 0x9F, 0xF7, 0x51, 0xB2, 0x9E, 0x7B, 0x75, 0x39,
+    0x29, 0x03, 0xFA, 0x19, 0x4D, 0xD2, 0x53, 0xBF, 0x09, 0xF1, 0x70, 0x52, 0x23, 0x9E, 0xAF, 0xA5,
+    0x31, 0xC2, 0x7E, 0x7A, 0x7C, 0x4A, 0xF2, 0x93, 0xF2, 0xB3, 0x0F, 0xBD, 0xFF, 0xA3, 0xFD, 0x71,
+    0x34, 0x0D, 0x11, 0xC9, 0x3C, 0xE3, 0x58, 0x12, 0x1F, 0xCD, 0x8E, 0x3B, 0x4E, 0x49, 0x86, 0x0D,
+    0x86, 0xF8, 0x79, 0x3D, 0xE9, 0x9F, 0x5F, 0x74, 0x8C, 0x16, 0xBE, 0x0C, 0x76, 0xA0, 0xD5, 0x03,
+    0xA1, 0xB1, 0xEB, 0xDD, 0x50, 0x10, 0x8D, 0xF0, 0xA9, 0xC5, 0xD4, 0x4A, 0x9A, 0x9E, 0x5F, 0x9C,
+    0xF7, 0x8F, 0xBE, 0x19, 0xCC, 0x60, 0x1D, 0xCC, 0x36, 0xC0, 0xCE, 0x7D, 0x97, 0x29, 0x46, 0x9D,
+    0x64, 0xB2, 0xC6, 0xEF, 0x30, 0x16, 0x6F, 0x20, 0xE2, 0xEC, 0xE2, 0x6D, 0xF2, 0xD9, 0x0D, 0xAF,
+    0xE4, 0x73, 0xBE, 0xCE, 0xE3, 0x15, 0xF7, 0xD1, 0xD3, 0xD9, 0x42, 0x0A, 0x11, 0x2B, 0xD0, 0xD2,
+    0x4C, 0xFC, 0x35, 0x2B, 0x19, 0x74, 0x8E, 0xCE, 0xCD, 0x86, 0x94, 0x22, 0x46, 0xE8, 0x0C, 0x2D,
+    0xA3, 0x27, 0x92, 0xB4, 0xD7, 0x05, 0x75, 0xB5, 0xFD, 0x4A, 0xA4, 0x6B, 0xB3, 0xA5, 0x58, 0x71,
+    0x8E, 0xFC, 0x1C, 0x37, 0x82, 0xEB, 0x82, 0x51, 0xCE, 0xA4, 0xE1, 0x84, 0xD9, 0x4C, 0x48, 0xFC,
+    0xB5, 0x3B, 0xB5, 0xDF, 0x69, 0x1B, 0xFB, 0x9A, 0xED, 0x7F, 0xF7, 0x03, 0xD6, 0xE2, 0x92, 0xB9,
+    0xCC, 0x49, 0xDF, 0xA1, 0x76, 0xB2, 0x59, 0xDC, 0xF4, 0x75, 0x4F, 0x0E, 0x1F, 0xC3, 0x93, 0x8A,
+    0xF3, 0xE3, 0xD6, 0xCB, 0x21, 0xD0, 0x8C, 0x31, 0x6C, 0x39, 0x3B, 0xF2, 0x3A, 0xAE, 0x74, 0x25,
+    0xC3, 0x2F, 0xE1, 0x88, 0x4A, 0x39, 0xFA, 0x52, 0x3E, 0x9F, 0xDE, 0x17, 0xFA, 0xDA, 0xC0, 0x14,
+    0xCE, 0xC8, 0x5D, 0xD4, 0xE0, 0x46, 0x2A, 0x81, 0x2D, 0xB9, 0x31, 0xC8, 0x5E, 0x7A, 0x4B, 0x5A,
+    0x05, 0x6E, 0x07, 0xA1, 0x59, 0x5E, 0xD7, 0x2D, 0x5F, 0xD2, 0x04, 0x99, 0x48, 0xD1, 0x1A, 0xB6,
+    0xB7, 0x8C, 0x8E, 0x05, 0xFA, 0x3E, 0x1E, 0x3E, 0x67, 0x23, 0xAD, 0xC2, 0x49, 0xFF, 0x6D, 0xD8,
+    0xFD, 0x2D, 0x0B, 0x54, 0xE7, 0x99, 0xA5, 0x2C, 0x45, 0x49, 0x8D, 0x38, 0x24, 0x2B, 0xBA, 0xD1,
+    0x8B, 0x25, 0x59, 0xEC, 0xAC, 0xED, 0x03, 0x6F, 0x61, 0x8C, 0x83, 0x94, 0x5E, 0x6C, 0x3A, 0x96,
+    0xB0, 0x52, 0x9D, 0xFF, 0xD7, 0xEA, 0x6F, 0x5A, 0x4C, 0x55, 0x23, 0xC5, 0x6D, 0x33, 0xFA, 0x69,
+    0xD4, 0xC4, 0xFC, 0x53, 0x6A, 0xCB, 0x48, 0xB3, 0xD4, 0x92, 0xFF, 0x10, 0x4A, 0x33, 0xB9, 0x55,
+    0x61, 0xEE, 0x54, 0xCF, 0x2B, 0xDB, 0x14, 0x9E, 0x05, 0xE2, 0x23, 0xBC, 0x66, 0xE6, 0x88, 0x54,
+    0x74, 0x57, 0x1D, 0x4A, 0x2A, 0x4C, 0xA7, 0x54, 0xE8, 0x37, 0xA9, 0x28, 0xA9, 0x7B, 0xA1, 0xB4,
+    0x55, 0x97, 0x23, 0x29, 0x48, 0xFE, 0xB3, 0x7C, 0x2B, 0x3A, 0x65, 0x35, 0x3B, 0x46, 0xEA, 0xD1,
+    0x52, 0x4A, 0x90, 0xE9, 0x81, 0x2F, 0xFB, 0x7C, 0x0F, 0x3B, 0xA1, 0xB3, 0x95, 0xF1, 0x10, 0x2D,
+    0x6F, 0x89, 0x50, 0xAA, 0x9E, 0x95, 0x03, 0xBA, 0xDD, 0x29, 0x27, 0x3A, 0xED, 0xE2, 0x08, 0xA7,
+    0xCA, 0xC5, 0xBF, 0x15, 0x56, 0x64, 0x92, 0xE9, 0x9C, 0xFE, 0xC5, 0xF7, 0x8E, 0x82, 0x4A, 0x61,
+    0xF4, 0x34, 0x48, 0xDA, 0xB7, 0x87, 0x77, 0x65, 0x0D, 0x19, 0x31, 0x75, 0xBD, 0xB0, 0x62, 0xD3,
+    0xE0, 0xD7, 0x4E, 0x92, 0xFF, 0x00, 0x8D, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18, 0x7D, 0xF6, 0x88,
+    0x58, 0x39, 0x2B, 0x37, 0x14, 0x89, 0x44, 0xC1, 0xC5, 0x0D, 0x45, 0x90, 0xEE, 0x70, 0x93, 0xE2,
+    0x22, 0xED, 0xAD, 0xDD, 0x51, 0x92, 0x22, 0xD7, 0x50, 0x51, 0x50, 0x21, 0x21, 0x0E, 0xE9, 0x8A,
+    0x14, 0xCB, 0xAD, 0xC5, 0x1F, 0x00, 0x0A, 0xEA, 0xA4, 0xA6, 0x4A, 0x71, 0x05, 0xC5, 0x86, 0x9D,
+    0xD0, 0x50, 0xE2, 0x9F, 0x60, 0x21, 0x24, 0x0A, 0x1A, 0x9F, 0xE4, 0xC2, 0x12, 0xDE, 0x1D, 0xDE,
+    0x1B, 0xEF, 0xED, 0x6D, 0x8E, 0x86, 0xD1, 0x7A, 0xEC, 0xF5, 0xCC, 0x7C, 0xDF, 0xFB, 0xDE, 0xF7,
+    0xBE, 0xCF, 0x40, 0xDA, 0x02, 0x45, 0x89, 0x68, 0x00, 0xD2, 0x1A, 0x98, 0x03, 0xA6, 0xC3, 0xF5,
+    0x48, 0xBA, 0x97, 0xF0, 0xFF, 0x38, 0xFB, 0xED, 0x1A, 0x97, 0xA6, 0x33, 0xCE, 0xBA, 0x03, 0x14,
+    0x78, 0x15, 0x75, 0x31, 0x1F, 0xD3, 0x53, 0x8F, 0xCC, 0xF7, 0x28, 0xBC, 0x43, 0xFE, 0x02, 0x88,
+    0x3A, 0x94, 0xB9, 0x33, 0x7E, 0x40, 0xEE, 0x6B, 0x64, 0xFD, 0x8D, 0x15, 0x4D, 0x96, 0xC6, 0x71,
+    0x78, 0xCE, 0xE9, 0x6C, 0x0F, 0x3B, 0xC3, 0x96, 0x98, 0x21, 0x03, 0x16, 0xC8, 0x81, 0x1E, 0x53,
+    0x99, 0xF9, 0x06, 0x71, 0xCB, 0x17, 0xA6, 0xC5, 0x30, 0x4E, 0x49, 0x13, 0xF7, 0xB4, 0x60, 0xBC,
+    0xF7, 0x2E, 0x4C, 0x09, 0xA7, 0x2A, 0xE5, 0x54, 0xD2, 0xEE, 0x1C, 0x99, 0xC3, 0x12, 0xB9, 0xC3,
+    0x1A, 0x45, 0x15, 0xAD, 0x80, 0xD8, 0x31, 0x28, 0x06, 0x74, 0xC0, 0xA7, 0x47, 0xC1, 0xCD, 0x31,
+    0xFF, 0x95, 0x00, 0x83, 0xDD, 0x1F, 0x97, 0x27, 0x0C, 0xF4, 0x45, 0x83, 0xA5, 0x77, 0xF6, 0xCF,
+    0x19, 0xFA, 0xD8, 0xE5, 0x38, 0x34, 0xB5, 0x71, 0x13, 0x1C, 0xA7, 0x2E, 0xA9, 0x7A, 0x74, 0xB6,
+    0xB4, 0x71, 0x1B, 0xB7, 0x85, 0x2C, 0xED, 0x95, 0x78, 0xB4, 0x85, 0x3A, 0xE8, 0xCD, 0x0E, 0x54,
+    0x21, 0x1A, 0x84, 0xA8, 0x8B, 0x7A, 0x92, 0x28, 0xA8, 0xEE, 0x7F, 0x43, 0x35, 0x15, 0x70, 0x49,
+    0x1A, 0x3E, 0xAD, 0x12, 0x72, 0xF9, 0x25, 0x5F, 0x10, 0xDC, 0x93, 0x35, 0x52, 0xF2, 0xB8, 0xFE,
+    0xD8, 0xD9, 0xEA, 0x90, 0x20, 0xDC, 0x09, 0x26, 0xC6, 0x99, 0x6A, 0x81, 0xE7, 0xB6, 0xB2, 0x65,
+    0x87, 0x36, 0x47, 0x6E, 0x5A, 0x72, 0x63, 0x4D, 0xB9, 0x7F, 0xE6, 0xCC, 0xBD, 0x97, 0xD1, 0x9B,
+    0x16, 0x6F, 0x8D, 0xAC, 0x42, 0x52, 0x8B, 0x48, 0xE2, 0x25, 0x56, 0x64, 0x25, 0x52, 0x27, 0x3A,
+    0x09, 0x9D, 0xB0, 0x45, 0xB7, 0x75, 0x64, 0x16, 0xC4, 0x8B, 0x55, 0xC8, 0x3C, 0x61, 0xA5, 0x8D,
+    0x12, 0xF9, 0x78, 0xFF, 0x6B, 0x77, 0xF6, 0x1A, 0xE5, 0x4D, 0x02, 0x0F, 0x81, 0x06, 0x49, 0xA9,
+    0x7B, 0x8B, 0xA4, 0xC2, 0x11, 0xD0, 0x21, 0x71, 0xB2, 0xF2, 0x33, 0x77, 0x3C, 0xF8, 0xA2, 0xB2,
+    0x04, 0xFC, 0x1F, 0x04, 0x64, 0x48, 0x5B, 0xE4, 0x95, 0x10, 0x88, 0x87, 0x69, 0x95, 0x5B, 0x61,
+    0x20, 0x20, 0xA1, 0x23, 0x97, 0x04, 0x81, 0x5F, 0x82, 0x44, 0x24, 0x43, 0xA2, 0x88, 0x47, 0xF1,
+    0x64, 0xBE, 0xFD, 0xE9, 0xC7, 0x11, 0x44, 0x54, 0x21, 0x55, 0x16, 0xA3, 0x5A, 0xF7, 0x89, 0xD0,
+    0x30, 0x9F, 0x27, 0x42, 0xC3, 0xA8, 0x3E, 0xE2, 0x0E, 0xD3, 0xE0, 0x42, 0x12, 0x1E, 0x60, 0x2B,
+    0x62, 0xCB, 0x64, 0x7C, 0x2A, 0x97, 0x0B, 0x39, 0x1C, 0x88, 0x86, 0xC2, 0x2E, 0x90, 0xB4, 0xE4,
+    0x7F, 0x0F, 0x71, 0x85, 0x27, 0x01, 0x9D, 0x6C, 0x2B, 0xAF, 0xD6, 0x45, 0x5B, 0xFC, 0x74, 0x76,
+    0xA8, 0xC4, 0x9C, 0xCB, 0x57, 0x4B, 0xC5, 0xC4, 0x35, 0x5D, 0x31, 0x31, 0x0B, 0xD9, 0xAE, 0xF1,
+    0x18, 0xE6, 0xA9, 0x84, 0xA0, 0xD1, 0xC9, 0x3F, 0x63, 0x78, 0x76, 0x2B, 0xF2, 0xA0, 0x61, 0x3A,
+    0x0E, 0x2A, 0x19, 0xB7, 0xF4, 0x42, 0x93, 0x23, 0xE8, 0x19, 0x79, 0x45, 0xD2, 0x09, 0x86, 0xD1,
+    0x32, 0x74, 0x7C, 0x16, 0xBB, 0x7D, 0x9C, 0xB3, 0xAC, 0x70, 0x1C, 0xD7, 0xB6, 0x9C, 0xC4, 0x6D,
+    0x5A, 0xD1, 0x8C, 0xAD, 0x92, 0x3A, 0xA9, 0x25, 0x43, 0x9E, 0x1A, 0x68, 0xEC, 0x82, 0xB4, 0xE5,
+    0xB4, 0x47, 0x85, 0xB5, 0x8C, 0xB8, 0x8F, 0x25, 0x41, 0x56, 0x1C, 0x97, 0xAC, 0xCB, 0xCA, 0xA4,
+    0x49, 0x5D, 0xDC, 0x73, 0x61, 0x45, 0xAF, 0x73, 0x15, 0x95, 0x2B, 0x98, 0x53, 0x52, 0x2D, 0xE1,
+    0x99, 0x25, 0x89, 0xF6, 0xE4, 0x7C, 0xCE, 0x2B, 0xFF, 0x7E, 0xAC, 0xBE, 0xFB, 0x82, 0x74, 0x22,
+    0x7C, 0xAF, 0xF1, 0x20, 0x88, 0x65, 0x3B, 0xDE, 0xD5, 0xF4, 0x4A, 0x14, 0xB4, 0x22, 0xBE, 0x26,
+    0x05, 0x2C, 0x1D, 0x0A, 0x91, 0xBA, 0x29, 0x8D, 0x32, 0xC2, 0x1C, 0x58, 0x19, 0x79, 0xC8, 0x1B,
+    0x39, 0xCB, 0x95, 0x1A, 0x26, 0xE3, 0xF9, 0xE6, 0x20, 0x22, 0x89, 0x52, 0x7D, 0x25, 0x62, 0x93,
+    0x80, 0x59, 0x6F, 0x4D, 0xAB, 0x04, 0xE5, 0x13, 0x96, 0x4A, 0x8A, 0xAB, 0x0F, 0x36, 0xAF, 0x59,
+    0x67, 0x88, 0xBB, 0xCD, 0x12, 0xC3, 0x10, 0xA8, 0x51, 0x30, 0x52, 0x8C, 0x24, 0x13, 0x34, 0x13,
+    0x96, 0xA5, 0x1A, 0xC9, 0xE9, 0xED, 0x65, 0x49, 0x4D, 0x5A, 0x0B, 0x62, 0x0B, 0xD1, 0xCC, 0x29,
+    0x43, 0x05, 0x9D, 0xAB, 0xDA, 0x3C, 0xB7, 0x7C, 0x58, 0x6E, 0x61, 0xA8, 0xD8, 0x42, 0xDE, 0xFF,
+    0xE0, 0x43, 0x73, 0x77, 0x07, 0x9B, 0xCC, 0x28, 0x8C, 0x23, 0x39, 0xC0, 0x58, 0xA7, 0x51, 0xBD,
+    0x09, 0x8B, 0xFA, 0xC3, 0x81, 0x22, 0xBB, 0x36, 0xD1, 0x8C, 0x27, 0x64, 0xCA, 0xAA, 0x93, 0x6E,
+    0x9B, 0x9F, 0x69, 0xF2, 0x32, 0x6A, 0xA9, 0x87, 0x05, 0xAF, 0x29, 0x91, 0x66, 0xBC, 0xD2, 0xDF,
+    0xC9, 0xE2, 0xDF, 0x54, 0x3B, 0xFB, 0x24, 0x3C, 0xCF, 0x16, 0x3C, 0x9B, 0xE9, 0xAC, 0xD7, 0x42,
+    0x4F, 0x0A, 0x3C, 0xB1, 0xF3, 0xED, 0x34, 0x59, 0x23, 0x2F, 0x7D, 0xCD, 0xDC, 0x6E, 0x12, 0xA3,
+    0x3E, 0xAA, 0x9E, 0x1D, 0xBA, 0x74, 0xBF, 0x09, 0xF1, 0x42, 0x2B, 0x77, 0x02, 0xD0, 0x87, 0x01,
+    0xF2, 0x24, 0x80, 0xBF, 0x9C, 0xE1, 0xAA, 0x8D, 0xFE, 0x72, 0xB1, 0x87, 0xA1, 0xE8, 0x56, 0x48,
+    0x97, 0xB0, 0x5F, 0xB9, 0xCC, 0x36, 0x79, 0xD2, 0x4D, 0xCD, 0x4E, 0xAA, 0xE7, 0xA1, 0x00, 0x07,
+    0xB0, 0x81, 0x91, 0x40, 0x25, 0x8C, 0x01, 0x1E, 0xC4, 0xBF, 0x55, 0xC7, 0x4D, 0x32, 0x63, 0xC1,
+    0x84, 0xEA, 0x98, 0xB6, 0xE6, 0xBB, 0xEA, 0x7C, 0x65, 0xA9, 0x5A, 0xBC, 0x0F, 0xDC, 0x0B, 0xFE,
+    0xD2, 0x5D, 0xDD, 0xAB, 0xA7, 0x6C, 0xDB, 0x4E, 0x2F, 0x59, 0x6D, 0xDA, 0x8C, 0xA9, 0x83, 0x14,
+    0x16, 0xBB, 0x9D, 0xE8, 0xEA, 0xF4, 0x07, 0xEF, 0xFB, 0xA5, 0x5F, 0x15, 0xDE, 0x8F, 0xC7, 0xD9,
+    0xAA, 0xCF, 0xC4, 0xA5, 0x28, 0xBD, 0x1E, 0xEF, 0x5D, 0x07, 0xD3, 0x89, 0xE1, 0x38, 0x2C, 0xF2,
+    0xC7, 0xEA, 0xB0, 0xD2, 0x9E, 0xD4, 0x76, 0x12, 0xB6, 0xCC, 0x4A, 0x2C, 0x1D, 0x24, 0xB3, 0x3B,
+    0x55, 0x90, 0x4E, 0x77, 0xED, 0x8F, 0x1B, 0x93, 0x6D, 0xE7, 0x9B, 0xDD, 0x42, 0x39, 0x9C, 0x7E,
+    0x3E, 0xF7, 0xEB, 0xDC, 0xFB, 0x4F, 0xBC, 0xDF, 0x71, 0x4B, 0x9A, 0x19, 0xA6, 0x48, 0x1E, 0x42,
+    0x77, 0xBC, 0x08, 0xD9, 0xA6, 0xFE, 0x1B, 0xA2, 0x98, 0xD1, 0xAB, 0xA5, 0xCD, 0x9B, 0x3F, 0xA5,
+    0x71, 0xD1, 0x15, 0xFD, 0x17, 0x63, 0x13, 0x4E, 0x1B, 0xD3, 0xB2, 0x87, 0x0D, 0x3C, 0x26, 0xA5,
+    0xBE, 0x53, 0x8E, 0x92, 0xA4, 0xB5, 0x24, 0x7C, 0x99, 0x9E, 0x82, 0x1F, 0xD3, 0x84, 0x1F, 0xD3,
+    0x9C, 0x72, 0xEA, 0xF5, 0x18, 0x50, 0x09, 0x9F, 0x64, 0xAB, 0xC7, 0xE1, 0xF4, 0x19, 0xBF, 0x1C,
+    0x0D, 0x81, 0x95, 0x3E, 0x74, 0xD6, 0x94, 0xBD, 0xBE, 0x32, 0xBF, 0xD6, 0x71, 0xC3, 0x72, 0xBC,
+    0xAF, 0x38, 0x8E, 0x42, 0x02, 0x78, 0x96, 0xED, 0x49, 0xEA, 0x9B, 0x05, 0x36, 0x18, 0x2D, 0xF9,
+    0x21, 0x1A, 0xD1, 0x51, 0xDC, 0xFA, 0x28, 0xDC, 0x1E, 0xFF, 0x02, 0xB5, 0x55, 0x3D, 0x8F, 0x1C,
+    0x45, 0x10, 0x7D, 0xDB, 0x8D, 0xAF, 0x25, 0x77, 0xD0, 0x0E, 0x4E, 0x04, 0x18, 0xBC, 0x84, 0x04,
+    0xD8, 0x93, 0x10, 0xDE, 0xDE, 0x34, 0x38, 0x24, 0x21, 0x30, 0x17, 0x38, 0x26, 0x30, 0x04, 0x40,
+    0xE0, 0x00, 0xA4, 0xE3, 0x76, 0xC0, 0x7F, 0xC0, 0x11, 0x31, 0x01, 0x48, 0x88, 0xE4, 0x08, 0x08,
+    0x08, 0xF6, 0x3C, 0x13, 0x40, 0x44, 0x32, 0x22, 0x21, 0xBC, 0x09, 0x90, 0x10, 0x11, 0x0D, 0x1A,
+    0x89, 0x39, 0x6B, 0x76, 0x9B, 0x57, 0xDD, 0xDE, 0xFB, 0xF2, 0x06, 0x60, 0x89, 0x91, 0xB6, 0xAB,
+    0x67, 0xFB, 0xA3, 0xEA, 0xD5, 0x7B, 0x55, 0x83, 0xAD, 0x0A, 0xD8, 0x05, 0xD0, 0x03, 0xB6, 0x91,
+    0x69, 0x8F, 0xDE, 0x36, 0xA6, 0x29, 0x51, 0xE2, 0x0E, 0x06, 0xC0, 0xF0, 0xDF, 0x82, 0x1B, 0x64,
+    0xDA, 0xE6, 0xE9, 0xF8, 0xF6, 0x3B, 0x26, 0xC6, 0xAE, 0x88, 0xD1, 0xC7, 0x38, 0x02, 0xAF, 0x00,
+    0x01, 0xA6, 0xC2, 0x0E, 0x26, 0x61, 0xDB, 0x7E, 0x16, 0x76, 0xDC, 0xA7, 0xE1, 0x91, 0xCD, 0xEF,
+    0xA0, 0x9D, 0xA5, 0xF5, 0x1F, 0x50, 0x04, 0x44, 0xDE, 0x76, 0xFE, 0xB1, 0xFE, 0x82, 0xA9, 0x64,
+    0xBC, 0x97, 0xCD, 0x6E, 0x36, 0xEE, 0xCD, 0x64, 0xCC, 0x4F, 0xC9, 0xE8, 0xDF, 0x92, 0x59, 0xDF,
+    0x33, 0xCF, 0xA6, 0xC8, 0xC6, 0x65, 0x63, 0x9E, 0x98, 0x90, 0xCD, 0x90, 0xCD, 0x32, 0x9B, 0x98,
+    0xCD, 0xF1, 0x8F, 0x7B, 0x74, 0x69, 0x7E, 0x21, 0x0C, 0x9A, 0x9F, 0x63, 0xEC, 0x05, 0x5E, 0x42,
+    0x23, 0x28, 0x71, 0x66, 0xBA, 0xF3, 0x6F, 0x93, 0xB3, 0xC8, 0x5F, 0x95, 0x61, 0x47, 0x86, 0xEF,
+    0x91, 0xF3, 0x27, 0x68, 0x01, 0x25, 0x07, 0x74, 0xB3, 0x8E, 0x23, 0x81, 0x70, 0x7B, 0xBF, 0xE2,
+    0xF9, 0xFA, 0x4B, 0x4C, 0x7F, 0x7F, 0x5F, 0xF6, 0xCE, 0x4E, 0x8F, 0xEE, 0x0B, 0xEE, 0xBA, 0x39,
+    0x03, 0x94, 0xC6, 0xE4, 0xF2, 0x5B, 0x19, 0xEE, 0x63, 0xD3, 0xB3, 0x10, 0x6C, 0xBB, 0xD0, 0x23,
+    0x9C, 0x47, 0xF4, 0xE4, 0x6D, 0xDE, 0xEA, 0x80, 0x72, 0x98, 0xF4, 0x70, 0xB5, 0x2C, 0x1F, 0x93,
+    0x3F, 0xFD, 0x57, 0x3F, 0xAD, 0x30, 0x7E, 0xC2, 0xE5, 0x47, 0xEE, 0x01, 0x97, 0x6F, 0xFF, 0x39,
+    0x30, 0x45, 0x8B, 0x23, 0xD8, 0x50, 0xCC, 0xA1, 0x07, 0x13, 0x2B, 0x2C, 0x11, 0x5B, 0xD4, 0x28,
+    0xB9, 0xDC, 0xD8, 0x9C, 0xA9, 0x0F, 0x19, 0x7E, 0x95, 0xE2, 0x53, 0xED, 0x65, 0xCF, 0x2F, 0xBF,
+    0x0B, 0x15, 0x97, 0x70, 0xDD, 0x3E, 0x41, 0x04, 0x15, 0x74, 0xE3, 0xFC, 0x94, 0x5B, 0x07, 0x4E,
+    0x5B, 0xD7, 0x4C, 0x19, 0xD5, 0x42, 0xF5, 0x3A, 0xB8, 0xC6, 0x25, 0x9E, 0x5E, 0xC0, 0x64, 0x14,
+    0x5A, 0x6A, 0xE8, 0x96, 0x1E, 0x54, 0xC0, 0xB4, 0xC7, 0x08, 0xBB, 0x92, 0xF0, 0xFF, 0x68, 0x0A,
+    0x4C, 0xFE, 0xE6, 0x5E, 0x8C, 0x47, 0x4C, 0x73, 0x39, 0x7D, 0x83, 0xCB, 0x0F, 0x3A, 0x1E, 0x68,
+    0xC7, 0x03, 0xE8, 0x50, 0x14, 0x5E, 0x8D, 0xF6, 0xB8, 0xC1, 0x6A, 0x42, 0x96, 0x4A, 0x5F, 0xF6,
+    0x24, 0xDA, 0x71, 0x39, 0xA8, 0xD5, 0x3A, 0xA0, 0xC4, 0xBC, 0x6B, 0xD7, 0x74, 0xAB, 0x44, 0xC3,
+    0x28, 0x2B, 0xE3, 0x3A, 0x60, 0x4B, 0x6E, 0x57, 0x86, 0x81, 0xEE, 0x48, 0xBC, 0x33, 0xEC, 0x33,
+    0xE8, 0x6A, 0x81, 0x5E, 0xC2, 0x65, 0xDC, 0x85, 0x2F, 0x75, 0xD0, 0x29, 0xE5, 0xBC, 0x47, 0xCE,
+    0x96, 0x9E, 0xCE, 0xC1, 0xD4, 0x60, 0x9A, 0x40, 0x3C, 0x87, 0x6B, 0xBC, 0xB9, 0x11, 0x42, 0x66,
+    0x89, 0xDC, 0x94, 0x96, 0x2F, 0x2E, 0xE7, 0xE6, 0x9E, 0x84, 0x50, 0x42, 0x65, 0x56, 0xB0, 0x66,
+    0xA5, 0x18, 0x58, 0x3A, 0x1B, 0x59, 0x39, 0xF8, 0xF7, 0xAC, 0x28, 0x6C, 0xC3, 0x18, 0xCF, 0x3D,
+    0x8C, 0x92, 0xEF, 0xD7, 0x9E, 0x9D, 0x15, 0x9F, 0xA8, 0xE5, 0x84, 0x64, 0xE0, 0xE3, 0x8D, 0xFA,
+    0xDA, 0x7E, 0x0F, 0x9A, 0x95, 0x30, 0xBF, 0xDD, 0xDA, 0xE6, 0x26, 0x7A, 0xD5, 0x4E, 0x31, 0x53,
+    0x9D, 0x61, 0xEE, 0x16, 0xCC, 0x63, 0x35, 0x62, 0xE0, 0xA5, 0xAF, 0x0F, 0x2A, 0xFC, 0xEF, 0x14,
+    0xC7, 0x75, 0x7D, 0x6C, 0x49, 0x7D, 0xD8, 0x15, 0x5F, 0xD5, 0x5B, 0xFF, 0x81, 0x57, 0xA9, 0xDE,
+    0x23, 0xE0, 0xB0, 0x41, 0xD1, 0x67, 0x6C, 0x57, 0xEE, 0x92, 0x38, 0x17, 0xC7, 0xA7, 0x51, 0x5B,
+    0x26, 0x1E, 0x05, 0xF3, 0x88, 0xF2, 0x21, 0x65, 0x55, 0x56, 0xBA, 0x17, 0x29, 0x1C, 0x88, 0x0A,
+    0x5C, 0x45, 0x08, 0xBA, 0x13, 0xE6, 0x7B, 0x81, 0x3D, 0x93, 0x76, 0x58, 0x48, 0xE3, 0xE4, 0x4A,
+    0x05, 0x2B, 0x44, 0x93, 0x9B, 0xF8, 0xD5, 0x21, 0xCF, 0xC4, 0x38, 0xF0, 0x32, 0x71, 0x21, 0x33,
+    0x86, 0xDE, 0xAD, 0x5D, 0x5C, 0x3D, 0x0C, 0xA8, 0x1F, 0x57, 0x97, 0x1C, 0x4F, 0xEA, 0x8A, 0x7E,
+    0x2B, 0xD5, 0x39, 0xDC, 0xC2, 0x0D, 0xB6, 0xCA, 0xFB, 0xA6, 0x52, 0xED, 0x4D, 0x12, 0xFD, 0x1D,
+    0x3E, 0x52, 0xC1, 0xB6, 0x26, 0xAE, 0x18, 0x72, 0x87, 0x27, 0x05, 0x9A, 0xFA, 0x20, 0x5E, 0x94,
+    0x46, 0xF1, 0x12, 0x87, 0x52, 0x3A, 0x9B, 0x1A, 0x36, 0xF0, 0x58, 0x48, 0x0E, 0x6B, 0x69, 0x6D,
+    0x2B, 0x5F, 0x73, 0x10, 0x81, 0x2F, 0x31, 0x19, 0x88, 0x89, 0xA1, 0x97, 0x29, 0x78, 0x6A, 0xBD,
+    0x95, 0xC6, 0xDF, 0x4B, 0x09, 0x2C, 0x04, 0xD6, 0xAE, 0xC0, 0x2A, 0x3C, 0x01, 0x17, 0x8D, 0x5E,
+    0x7D, 0x5E, 0xB7, 0x84, 0x41, 0xE7, 0xEC, 0xF6, 0x81, 0xB2, 0x10, 0x30, 0xD7, 0xE3, 0x05, 0x08,
+    0xAF, 0xB1, 0x6B, 0x85, 0x1B, 0x94, 0x60, 0x07, 0xB5, 0xDC, 0xA4, 0xA7, 0x67, 0x01, 0x68, 0x2B,
+    0xF6, 0x50, 0x7E, 0x88, 0x5A, 0xCE, 0xCC, 0xC3, 0xA7, 0xEF, 0xAC, 0xB9, 0x55, 0x45, 0x96, 0x89,
+    0x3E, 0x61, 0xC5, 0xE9, 0x81, 0x54, 0x91, 0x2F, 0xD3, 0x11, 0x1D, 0x41, 0x8C, 0x02, 0x83, 0x6D,
+    0xD6, 0xF9, 0x42, 0xEA, 0x35, 0xA9, 0x5D, 0x00, 0x4A, 0x2D, 0x52, 0x10, 0x84, 0x5E, 0xC3, 0x3D,
+    0xBE, 0x1B, 0x3D, 0x01, 0x11, 0x4C, 0x1D, 0x29, 0x2F, 0x27, 0x33, 0x7C, 0x70, 0xDA, 0x5A, 0x70,
+    0x15, 0x5B, 0xDE, 0x79, 0x51, 0xBC, 0x6D, 0xAE, 0x9C, 0x6F, 0xFD, 0xA7, 0xCF, 0x75, 0x51, 0x01,
+    0x4F, 0xDD, 0x22, 0x26, 0x41, 0xE6, 0x60, 0xBC, 0x40, 0x63, 0xE3, 0x0C, 0x82, 0x8D, 0x12, 0x39,
+    0x82, 0x80, 0x83, 0xFC, 0xEC, 0x79, 0x8E, 0x8A, 0xE5, 0x9C, 0x0A, 0x21, 0x02, 0xD1, 0x88, 0xEB,
+    0xED, 0xC9, 0x1D, 0x64, 0xC9, 0x21, 0x53, 0x24, 0x3F, 0x21, 0x95, 0xC2, 0xD2, 0x43, 0xEA, 0x39,
+    0x86, 0x5B, 0xC8, 0x94, 0x95, 0xFD, 0x54, 0x24, 0x69, 0x15, 0xD3, 0xA5, 0x5A, 0x9E, 0xB6, 0xE9,
+    0xEB, 0x57, 0x92, 0x48, 0x77, 0xB2, 0x27, 0x55, 0x43, 0x34, 0xF1, 0x9B, 0xAF, 0x45, 0x87, 0xA2,
+    0x44, 0x9D, 0x0D, 0xD1, 0xC5, 0x8B, 0xD2, 0xFF, 0x07, 0xAD, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14,
+    0x3D, 0xCF, 0xDE, 0x89, 0x03, 0x86, 0xB8, 0x59, 0x50, 0x44, 0x3E, 0x4C, 0x49, 0xB1, 0xC4, 0xCD,
+    0x16, 0x14, 0xB3, 0xE3, 0xB7, 0xA1, 0xA3, 0xDA, 0x82, 0xAD, 0xA1, 0xA6, 0x21, 0x12, 0x29, 0xA2,
+    0x68, 0x83, 0xCD, 0x2F, 0x60, 0x1A, 0xFA, 0x2D, 0x28, 0x36, 0xD4, 0x91, 0x92, 0x62, 0x15, 0x3F,
+    0x94, 0x22, 0x15, 0x92, 0x7F, 0x82, 0x15, 0x45, 0xE2, 0xA3, 0x72, 0xE1, 0x48, 0xCE, 0xCA, 0xE3,
+    0xCB, 0xB9, 0x1E, 0xCF, 0x66, 0x34, 0xA4, 0x00, 0xB1, 0x1E, 0x79, 0xD6, 0x7E, 0xF3, 0xDE, 0xB9,
+    0xE7, 0x9E, 0x7B, 0xEF, 0x59, 0x00, 0x38, 0x80, 0x29, 0xF2, 0xA2, 0x42, 0x21, 0x33, 0x3F, 0xBF,
+    0x05, 0xC1, 0xF5, 0x30, 0x0F, 0xDC, 0x87, 0xAE, 0x46, 0x26, 0xDD, 0x4D, 0x84, 0x67, 0x3F, 0xDD,
+    0x2E, 0x51, 0x03, 0x9F, 0x22, 0x06, 0xBC, 0x3A, 0xEC, 0x80, 0x58, 0x44, 0x16, 0x90, 0x45, 0x2A,
+    0xA5, 0xD7, 0xA3, 0x78, 0x89, 0xF1, 0xDA, 0xE1, 0x7D, 0x97, 0x77, 0x05, 0xF8, 0x6E, 0xB5, 0x88,
+    0x40, 0xE6, 0x08, 0xA5, 0xC1, 0x15, 0x1C, 0xE1, 0x06, 0xA6, 0xDC, 0x35, 0x1D, 0x3E, 0xF7, 0xD0,
+    0xE2, 0x51, 0xD0, 0x40, 0xA4, 0x34, 0x22, 0xF0, 0x44, 0x72, 0xBF, 0x09, 0x5D, 0x50, 0x07, 0x2E,
+    0xAC, 0x82, 0x32, 0xE2, 0x27, 0x76, 0x51, 0x99, 0xB8, 0xB8, 0x4C, 0xF3, 0xB4, 0x04, 0x76, 0x15,
+    0x75, 0x07, 0xA6, 0x5A, 0xE2, 0x9A, 0x7D, 0x7B, 0xB3, 0x40, 0xD1, 0xF9, 0x2D, 0x22, 0x8B, 0x53,
+    0xF8, 0xD5, 0xF8, 0xB7, 0x46, 0xEC, 0xF0, 0xF4, 0x22, 0x23, 0x6F, 0x5C, 0x8C, 0x80, 0x90, 0x2C,
+    0x22, 0x26, 0x19, 0xE7, 0x40, 0xCA, 0xB5, 0x07, 0xBC, 0x27, 0x13, 0x90, 0x51, 0x22, 0x48, 0x73,
+    0xEC, 0x81, 0x54, 0x18, 0x07, 0x0D, 0x45, 0xD3, 0x13, 0x41, 0x3D, 0x9C, 0xD9, 0x40, 0x6A, 0x74,
+    0x3D, 0x2A, 0x15, 0x8A, 0x28, 0xDF, 0xEB, 0x9A, 0xDD, 0xA2, 0x82, 0x9F, 0x01, 0x33, 0x06, 0xA6,
+    0xE4, 0xB8, 0x8C, 0x8B, 0x96, 0xD2, 0x60, 0xCB, 0xB8, 0xBB, 0x78, 0xEC, 0x30, 0x03, 0xAE, 0x0E,
+    0xC8, 0xDB, 0xDB, 0xB8, 0xDF, 0x51, 0x4C, 0xF4, 0x2B, 0xC6, 0x15, 0xFC, 0x12, 0xA1, 0x53, 0x66,
+    0x94, 0x33, 0xC9, 0xCF, 0x49, 0xDC, 0xE1, 0x7D, 0x03, 0x63, 0x89, 0x6B, 0xBC, 0xE5, 0xF2, 0xE4,
+    0x8F, 0x81, 0x03, 0x8A, 0xBF, 0x7E, 0x46, 0x5C, 0x6A, 0xDB, 0x70, 0x75, 0x4F, 0xCF, 0xA8, 0x02,
+    0xE9, 0x6B, 0x16, 0x4F, 0x7A, 0xFD, 0x5A, 0xF0, 0xF5, 0x5B, 0xFD, 0x91, 0x9B, 0x11, 0xB5, 0xC6,
+    0x06, 0x62, 0x0B, 0x91, 0x3A, 0x11, 0xE9, 0x02, 0xE1, 0x9E, 0x6B, 0xF2, 0xE7, 0x5A, 0x77, 0xDD,
+    0xD1, 0xDE, 0x5A, 0x6B, 0x2D, 0xBD, 0xE2, 0xD7, 0xE8, 0x4F, 0x3C, 0x07, 0x3F, 0x57, 0x74, 0x23,
+    0x56, 0x01, 0x4D, 0x33, 0x31, 0x4D, 0x22, 0x75, 0x26, 0x65, 0xD2, 0xDB, 0x95, 0xD8, 0x7A, 0x50,
+    0xEB, 0x85, 0x17, 0x7C, 0x7A, 0x1F, 0xF3, 0x35, 0x94, 0x50, 0x8E, 0x97, 0x94, 0x93, 0xB3, 0x87,
+    0x30, 0x4A, 0x2B, 0x74, 0x23, 0x67, 0x2D, 0x22, 0x7C, 0x2A, 0x4F, 0xF9, 0xDB, 0x15, 0xE9, 0x6B,
+    0x1C, 0x03, 0x12, 0xD6, 0x6C, 0xAA, 0x81, 0xB5, 0x32, 0x26, 0x80, 0x38, 0x0E, 0x47, 0xBB, 0x4E,
+    0x9B, 0xBC, 0xBC, 0x06, 0xE6, 0xF7, 0x1C, 0xE5, 0xCE, 0xB8, 0x64, 0x64, 0xEE, 0x9F, 0x1D, 0x93,
+    0xB3, 0x4E, 0x0A, 0x4B, 0x10, 0x2C, 0x96, 0x2A, 0x3C, 0xC0, 0x41, 0xCC, 0xF4, 0x1D, 0x59, 0x87,
+    0x1A, 0x0F, 0x49, 0x4F, 0x42, 0x84, 0x0B, 0xFB, 0x5F, 0xEC, 0x40, 0x2A, 0x51, 0x40, 0x6D, 0xC8,
+    0xD9, 0x8A, 0x53, 0x2C, 0x95, 0x7E, 0x71, 0xED, 0x92, 0xAC, 0x28, 0x49, 0xBE, 0x8D, 0xAC, 0x09,
+    0xC9, 0x66, 0x60, 0x94, 0x89, 0x54, 0x6C, 0x0B, 0x6E, 0x9E, 0x68, 0xF4, 0x13, 0x0C, 0x53, 0x0F,
+    0x5C, 0x57, 0x1C, 0xFB, 0x2F, 0x25, 0xCC, 0x61, 0xE6, 0x43, 0x2F, 0x7E, 0x82, 0x60, 0x6C, 0xE3,
+    0x8F, 0x3D, 0x0B, 0xEF, 0x57, 0x46, 0x8E, 0xB4, 0x82, 0x53, 0x4D, 0xEC, 0x1F, 0xAD, 0x70, 0x81,
+    0x19, 0x14, 0xFD, 0x79, 0xC1, 0xB6, 0x50, 0xEE, 0xE2, 0x7E, 0xA9, 0x60, 0x97, 0xFF, 0x5B, 0x2B,
+    0x4C, 0x0E, 0x0F, 0x0F, 0x15, 0xF6, 0x19, 0xEF, 0xCA, 0xD2, 0x2F, 0x10, 0xB8, 0xB1, 0x3F, 0xDB,
+    0x71, 0x8A, 0x95, 0xA1, 0x4E, 0xB6, 0xA6, 0xC9, 0xCA, 0x01, 0x5A, 0x6A, 0x1D, 0x71, 0x9D, 0x01,
+    0x8E, 0xEA, 0x30, 0xFE, 0xA6, 0x1B, 0x27, 0xD3, 0x3B, 0xC6, 0x72, 0x86, 0x16, 0x63, 0xEF, 0x3B,
+    0x3C, 0xA1, 0x0F, 0x4D, 0x5E, 0x7D, 0x2E, 0x1D, 0xF3, 0x9C, 0x6A, 0x1F, 0x35, 0x88, 0x34, 0xC4,
+    0x0C, 0x7E, 0x6F, 0xB3, 0x96, 0xCD, 0x72, 0x89, 0xC2, 0x01, 0x73, 0xC3, 0x90, 0x57, 0x0D, 0xC9,
+    0x3E, 0x57, 0x13, 0x21, 0x97, 0xD0, 0xBE, 0x49, 0x86, 0x44, 0x0F, 0x38, 0x0A, 0x5D, 0xCA, 0x31,
+    0xD8, 0x82, 0xF2, 0x38, 0x5A, 0x91, 0xE3, 0xEE, 0x60, 0x35, 0x55, 0xCA, 0x43, 0x6D, 0x23, 0xB1,
+    0x4B, 0xD6, 0x4A, 0xCE, 0x6B, 0x47, 0x3E, 0xCA, 0x3A, 0x1E, 0xC6, 0x85, 0x95, 0xBF, 0xA2, 0x63,
+    0xBB, 0x33, 0xC5, 0x93, 0x7B, 0x44, 0x9B, 0xBC, 0xB2, 0xA9, 0x38, 0x12, 0xE4, 0x50, 0xE8, 0x90,
+    0x5B, 0x52, 0x54, 0x70, 0x56, 0x25, 0x7D, 0x89, 0xAC, 0xA5, 0xFA, 0x78, 0xBB, 0x56, 0x1A, 0x60,
+    0x45, 0x27, 0x92, 0x8E, 0x43, 0x21, 0x4B, 0x37, 0x3C, 0xD7, 0x2A, 0xDB, 0xD0, 0xCA, 0xEB, 0x70,
+    0xAE, 0x4D, 0x98, 0x6B, 0xAC, 0xAF, 0xBE, 0xF4, 0x79, 0x72, 0x4F, 0x31, 0x52, 0x69, 0x52, 0xA9,
+    0xE9, 0x23, 0xA3, 0xE7, 0xF4, 0x1C, 0xA6, 0x9C, 0x12, 0x11, 0x73, 0x9F, 0x18, 0xDF, 0xBD, 0x43,
+    0x8C, 0x2F, 0x38, 0xF7, 0xEF, 0x45, 0x76, 0xA3, 0xB5, 0x3E, 0xCA, 0xF1, 0x90, 0x36, 0xEF, 0x37,
+    0x34, 0x51, 0xBA, 0x9B, 0x5A, 0x7E, 0xC6, 0x37, 0xD2, 0x88, 0xF4, 0x2D, 0x63, 0xF6, 0xA6, 0xA1,
+    0xC4, 0xF4, 0xC1, 0x92, 0xCF, 0x09, 0xF8, 0xDC, 0xF1, 0x8D, 0x51, 0x52, 0x1E, 0xA0, 0x5D, 0xB2,
+    0xAD, 0x9C, 0x51, 0x97, 0xF1, 0x69, 0x39, 0x4C, 0xA4, 0x5F, 0xF7, 0xB0, 0xEA, 0x6B, 0xEF, 0xB7,
+    0x5D, 0x94, 0xED, 0x9B, 0xA5, 0x08, 0x31, 0xFD, 0xF4, 0x87, 0xCA, 0x2F, 0x1F, 0xA1, 0x9E, 0xE2,
+    0x28, 0xC2, 0xAD, 0xC0, 0x45, 0xFB, 0x55, 0xE8, 0x8A, 0x82, 0x8E, 0xD5, 0x29, 0x40, 0xF1, 0x23,
+    0x69, 0x7E, 0xF0, 0x4D, 0xAE, 0x66, 0xB2, 0xC1, 0xD7, 0x9C, 0xE0, 0xDD, 0x39, 0x85, 0x4A, 0x6D,
+    0x6A, 0xD9, 0x3E, 0xA4, 0x52, 0xD1, 0xFB, 0x53, 0xCB, 0xCA, 0xE9, 0x5B, 0x50, 0xEB, 0x3F, 0x2E,
+    0x4B, 0x7F, 0x3A, 0x65, 0x1B, 0xFA, 0x35, 0xF5, 0x88, 0x73, 0xE6, 0x71, 0xAA, 0x7D, 0x53, 0xF3,
+    0x40, 0x46, 0x65, 0xA8, 0x1A, 0xFD, 0x85, 0x18, 0x8A, 0x9E, 0x49, 0x85, 0xFF, 0x77, 0xFD, 0x0D,
+    0xBD, 0x55, 0x21, 0x6F, 0x1C, 0x47, 0x14, 0xFE, 0x76, 0x46, 0xCE, 0xA8, 0xDA, 0x24, 0x53, 0x90,
+    0xB0, 0xB4, 0x5B, 0x10, 0x50, 0x10, 0x7B, 0x55, 0x66, 0xE0, 0xCB, 0xCE, 0x3F, 0xA8, 0x89, 0x69,
+    0x65, 0x6C, 0x14, 0x10, 0x60, 0x70, 0xF6, 0x4D, 0x1A, 0x58, 0x10, 0xB3, 0xF2, 0x2A, 0xA4, 0xAC,
+    0x20, 0xC0, 0xE0, 0x92, 0xDB, 0xA8, 0xA0, 0x74, 0xD4, 0x2A, 0x0A, 0xEC, 0xAA, 0x01, 0x95, 0x4A,
+    0x32, 0x60, 0xC1, 0xAA, 0xBA, 0xF3, 0xF4, 0x7B, 0xB3, 0x39, 0xD7, 0x71, 0xAD, 0x4A, 0x29, 0xE8,
+    0x58, 0xFB, 0x3C, 0x3B, 0x37, 0xF3, 0xDE, 0xFB, 0xBE, 0xF7, 0xCD, 0x5B, 0xDC, 0x3E, 0xF0, 0x65,
+    0x5A, 0xE1, 0xEF, 0xB1, 0x83, 0xA9, 0x69, 0x4B, 0x7F, 0x88, 0xBE, 0x74, 0x16, 0xB1, 0x88, 0x16,
+    0x5B, 0x45, 0xD4, 0xE1, 0x53, 0xCC, 0xD5, 0x59, 0x6A, 0xEB, 0xB4, 0x2C, 0x52, 0xF2, 0xE5, 0xD0,
+    0xAF, 0x0F, 0x04, 0x0D, 0xE8, 0xF6, 0x10, 0x28, 0x93, 0xA7, 0xE9, 0x71, 0xC5, 0x28, 0x96, 0xB0,
+    0x5D, 0xD9, 0xA1, 0x41, 0xE3, 0x38, 0x5F, 0xA2, 0xEC, 0x0C, 0xDF, 0x5C, 0xED, 0x20, 0x6F, 0xA6,
+    0xD3, 0x11, 0xB5, 0xAB, 0x3C, 0xE7, 0x73, 0xE8, 0xA8, 0x22, 0x2A, 0x67, 0x5B, 0xCE, 0xEF, 0xF3,
+    0x8D, 0x07, 0x66, 0xCE, 0xA4, 0xB4, 0x44, 0x95, 0x12, 0x4F, 0xA5, 0x04, 0xCC, 0x38, 0x39, 0x1F,
+    0xDA, 0x5D, 0xC7, 0x8E, 0xF1, 0x8A, 0x6B, 0xEF, 0x85, 0xD7, 0xAD, 0x69, 0xA7, 0x38, 0x35, 0xDE,
+    0xBA, 0x67, 0x20, 0x8E, 0x0A, 0x51, 0x75, 0x15, 0x26, 0x45, 0x57, 0xB6, 0xF5, 0xDB, 0xA5, 0x4A,
+    0xA9, 0xAD, 0xD2, 0x80, 0xC5, 0x13, 0xC7, 0xCD, 0xA7, 0x7C, 0xAE, 0xDD, 0xA2, 0xF9, 0xEC, 0x84,
+    0xE6, 0xF8, 0x2A, 0x14, 0x5C, 0x55, 0xBD, 0x1A, 0x60, 0x83, 0x0D, 0x98, 0x11, 0x8C, 0x1A, 0x04,
+    0x58, 0x28, 0x83, 0x00, 0x43, 0x31, 0x08, 0xB0, 0x40, 0x60, 0x35, 0xD3, 0xCF, 0x50, 0x4C, 0x10,
+    0x60, 0xB0, 0x02, 0x6C, 0x86, 0x2A, 0x90, 0xBA, 0x04, 0x42, 0xA1, 0x0F, 0x06, 0x87, 0x44, 0x5F,
+    0x8F, 0xBB, 0xC0, 0x17, 0x0E, 0x77, 0xF7, 0xF1, 0xD1, 0x03, 0xA0, 0x7F, 0x0F, 0xC4, 0x4B, 0xA6,
+    0xCD, 0x7A, 0x6C, 0x62, 0x87, 0x18, 0x74, 0x5B, 0x3E, 0x62, 0x39, 0x0E, 0x55, 0x24, 0x84, 0x32,
+    0x25, 0xA9, 0x46, 0xFD, 0x26, 0x00, 0xB7, 0xB0, 0x21, 0x28, 0xA6, 0xD0, 0x5D, 0xD1, 0x63, 0xC3,
+    0xA9, 0xDD, 0xCB, 0xE9, 0x1F, 0x40, 0x3D, 0xC5, 0x0B, 0xE8, 0x1E, 0x2B, 0x98, 0x98, 0xAB, 0x90,
+    0xF3, 0x57, 0x3D, 0x6C, 0xCB, 0x44, 0xAB, 0x6C, 0x5C, 0x06, 0x60, 0x04, 0x53, 0xD9, 0xE2, 0x08,
+    0xB9, 0x0E, 0x19, 0x41, 0xD5, 0x9A, 0x5E, 0x6A, 0x10, 0xC7, 0x42, 0x64, 0x08, 0x26, 0x9D, 0x5D,
+    0x0C, 0x31, 0x25, 0xBB, 0x11, 0x83, 0x39, 0xD1, 0x1D, 0x2E, 0x55, 0x42, 0x54, 0x25, 0xA5, 0x10,
+    0x59, 0x49, 0x2D, 0xA8, 0x2B, 0xDA, 0x09, 0x28, 0x2C, 0x10, 0x0A, 0xEA, 0x5C, 0xE0, 0x01, 0x59,
+    0x5A, 0x92, 0xEA, 0xBF, 0x30, 0x9D, 0x45, 0xF3, 0xE1, 0x4C, 0xDF, 0xC8, 0x7A, 0x95, 0x7C, 0x84,
+    0x1B, 0x13, 0x3E, 0x84, 0xE2, 0xDF, 0x03, 0x8C, 0x87, 0x71, 0x50, 0x3E, 0xCB, 0xA3, 0x18, 0x4F,
+    0x8A, 0x35, 0x19, 0xEB, 0xCD, 0x7B, 0x62, 0xB7, 0x8D, 0x7B, 0xE7, 0xB5, 0x92, 0xC9, 0x3C, 0xDB,
+    0x41, 0x2C, 0xBD, 0xD1, 0xEA, 0xAE, 0xE6, 0x02, 0xF5, 0x27, 0x0A, 0xF7, 0x35, 0xEF, 0x40, 0xC3,
+    0xB4, 0x93, 0x3F, 0x46, 0xA3, 0x52, 0xBB, 0x44, 0x63, 0xD2, 0xCB, 0x01, 0x8D, 0xFD, 0xF5, 0x97,
+    0x88, 0xA6, 0xF9, 0xE6, 0x35, 0xF5, 0xBE, 0x28, 0xDF, 0xB6, 0x68, 0x56, 0x86, 0xD7, 0xAB, 0x19,
+    0x0C, 0xC5, 0xDF, 0x44, 0x43, 0xD2, 0x9B, 0xA0, 0x97, 0xB4, 0x5E, 0x9F, 0x6B, 0xE8, 0x21, 0x9F,
+    0x86, 0x31, 0xEE, 0xF1, 0x32, 0xDE, 0x91, 0x34, 0x99, 0x25, 0x5F, 0x77, 0xC9, 0xE7, 0x7C, 0x02,
+    0x4C, 0xAC, 0xC3, 0x96, 0x0E, 0xA7, 0x16, 0xFD, 0xA2, 0xF4, 0x93, 0xC5, 0x9B, 0x96, 0xD4, 0x74,
+    0x5A, 0xEA, 0x99, 0x9E, 0x30, 0xE6, 0x63, 0x32, 0xDC, 0x3E, 0x7F, 0xE7, 0xEB, 0x13, 0x3E, 0x6C,
+    0x0B, 0xE5, 0x57, 0xC0, 0x83, 0x6B, 0x19, 0x6A, 0x80, 0xFD, 0xD2, 0x63, 0x10, 0x55, 0xCC, 0xF1,
+    0xBC, 0x18, 0xE4, 0xD2, 0x36, 0xB0, 0x3F, 0x32, 0xCF, 0x99, 0xC3, 0x62, 0x40, 0x41, 0x9E, 0x25,
+    0x25, 0x96, 0x8C, 0x25, 0x60, 0xC9, 0xC6, 0xE9, 0x02, 0x79, 0xB5, 0x3E, 0x17, 0xC4, 0x36, 0x9F,
+    0x17, 0x4C, 0xED, 0x67, 0x6E, 0x77, 0x0F, 0xCF, 0x35, 0x12, 0xD9, 0x7A, 0x9E, 0xF1, 0x6F, 0x2A,
+    0x33, 0x46, 0x9B, 0x98, 0x16, 0x5B, 0xAC, 0x67, 0x5D, 0x91, 0x4B, 0x12, 0x6E, 0xC5, 0x35, 0x7D,
+    0x96, 0x91, 0x0F, 0x9D, 0x51, 0x97, 0xA8, 0x3D, 0xA3, 0x32, 0x1A, 0x7F, 0x5A, 0x70, 0xE9, 0x7B,
+    0xF1, 0xB3, 0x41, 0xCC, 0x73, 0xEB, 0x75, 0x77, 0x84, 0xFA, 0xF1, 0xC5, 0x76, 0x40, 0xF8, 0x13,
+    0xF6, 0x93, 0x8E, 0x52, 0x53, 0x51, 0xF5, 0xA6, 0xAB, 0xBC, 0x15, 0xC6, 0xE9, 0x68, 0xB5, 0x82,
+    0x74, 0x0F, 0x21, 0xD7, 0xC6, 0x4C, 0x22, 0x25, 0x96, 0xA3, 0x70, 0xAA, 0x96, 0xE3, 0xEA, 0xC2,
+    0x8F, 0xBD, 0xAC, 0x5D, 0xAB, 0x88, 0x89, 0x72, 0xFC, 0xF0, 0xCF, 0x3E, 0x41, 0xDD, 0x9D, 0x41,
+    0x14, 0xE8, 0xA4, 0x5B, 0xC9, 0xFE, 0x4A, 0xD0, 0x67, 0x0A, 0x9A, 0xB0, 0x36, 0x33, 0x31, 0x8B,
+    0x76, 0x6D, 0x64, 0x5F, 0x21, 0x2D, 0x34, 0x1B, 0x25, 0x46, 0xA7, 0x57, 0x7B, 0x4E, 0xFC, 0xF4,
+    0x58, 0x24, 0x76, 0xE9, 0x26, 0xBB, 0xE4, 0xA0, 0xA3, 0x72, 0x2C, 0xB8, 0xF6, 0x97, 0x83, 0x57,
+    0x79, 0x37, 0x9D, 0x1D, 0x71, 0x13, 0x43, 0xCC, 0x33, 0x55, 0x6C, 0x4E, 0xC2, 0x16, 0xEF, 0x3E,
+    0x9A, 0x3F, 0x4E, 0xE8, 0x53, 0x8A, 0x2F, 0xBE, 0xEA, 0x4C, 0x8D, 0x78, 0x11, 0xB8, 0x28, 0x76,
+    0x2F, 0x39, 0xE3, 0xC5, 0x31, 0x12, 0x1B, 0x72, 0xA1, 0x24, 0x6B, 0xD9, 0x9A, 0xA9, 0xC8, 0xC7,
+    0xC5, 0x14, 0x62, 0x94, 0xFC, 0x9A, 0x8D, 0x16, 0x23, 0x0A, 0x1D, 0x4D, 0x29, 0xC6, 0xA6, 0xBD,
+    0x3D, 0xF1, 0x93, 0x82, 0xCA, 0x70, 0x52, 0x76, 0x29, 0x1D, 0x8B, 0x1D, 0x80, 0x57, 0x63, 0x2C,
+    0xE7, 0x45, 0x06, 0x57, 0x6C, 0x08, 0x31, 0xDF, 0x22, 0xB6, 0x27, 0xC9, 0x92, 0xF7, 0x5B, 0xEE,
+    0x9D, 0x64, 0xC9, 0xA3, 0xF6, 0xCF, 0xA7, 0xFC, 0x08, 0x44, 0xAA, 0x57, 0x58, 0xBC, 0x0E, 0x3F,
+    0x0A, 0x2A, 0x83, 0xBC, 0x8A, 0x95, 0xFF, 0xA1, 0x28, 0x1F, 0xE3, 0x0E, 0x2F, 0xFF, 0x26, 0xF5,
+    0xD0, 0xF0, 0x6D, 0xFF, 0xBF, 0x17, 0x85, 0x80, 0x8F, 0x03, 0x5B, 0xCB, 0xA6, 0x28, 0x8C, 0x4D,
+    0x27, 0xFF, 0xE7, 0xFB, 0x96, 0x7C, 0x18, 0xF8, 0xBF, 0x92, 0xF3, 0x6C, 0xB0, 0xE4, 0x86, 0x7E,
+    0xA6, 0x45, 0x2C, 0x25, 0xD5, 0xED, 0xB2, 0x08, 0x3B, 0xE3, 0x17, 0x9C, 0xCD, 0xFD, 0xB7, 0xF0,
+    0xB9, 0x72, 0x95, 0xBE, 0xB9, 0xFF, 0xD3, 0x8D, 0xEF, 0x1E, 0x89, 0x4E, 0x6F, 0x1F, 0x7C, 0x3B,
+    0x7E, 0xE7, 0x37, 0xF6, 0xBE, 0x4E, 0xE7, 0x5F, 0xFC, 0xBF, 0x00, 0x95, 0x55, 0x3D, 0x6C, 0xD6,
+    0x46, 0x18, 0x7E, 0xEC, 0x23, 0x31, 0x8D, 0x21, 0x47, 0xA5, 0x0C, 0x48, 0x84, 0x38, 0x43, 0x06,
+    0x50, 0x93, 0x38, 0x54, 0x0C, 0x19, 0x4C, 0x7C, 0xA8, 0x43, 0xFF, 0x50, 0x95, 0x21, 0x5F, 0x91,
+    0xBA, 0xD0, 0xA1, 0x43, 0xC5, 0x94, 0x21, 0x43, 0x2A, 0x85, 0x7C, 0x0E, 0x5D, 0x2A, 0x75, 0x68,
+    0xA4, 0x2E, 0x55, 0xA7, 0xB6, 0x0A, 0x12, 0x4A, 0x87, 0x66, 0x60, 0x60, 0x00, 0x72, 0x85, 0x81,
+    0xA1, 0x8B, 0x29, 0xAA, 0x2A, 0x75, 0x32, 0x15, 0x13, 0x5D, 0x0C, 0xF2, 0x60, 0x45, 0xCE, 0x77,
+    0x7D, 0x5E, 0x7F, 0xC9, 0x57, 0x50, 0xBB, 0xF4, 0x24, 0x9F, 0xEE, 0xDE, 0xBB, 0x7B, 0x7F, 0x9E,
+    0xE7, 0x7D, 0x5F, 0x03, 0xCA, 0x8C, 0x27, 0xC1, 0x75, 0x57, 0x84, 0x4F, 0x11, 0xE9, 0x87, 0xCF,
+    0x97, 0xB4, 0xFF, 0xA2, 0x5C, 0x48, 0x83, 0x27, 0x8B, 0x4B, 0xB3, 0xD9, 0x78, 0x88, 0x6C, 0xE4,
+    0xFA, 0xBB, 0x73, 0xF7, 0x2B, 0xC0, 0xCF, 0xBD, 0x72, 0x01, 0x91, 0x2A, 0x3C, 0x6E, 0x80, 0xF3,
+    0x41, 0xF0, 0x01, 0xEE, 0x61, 0x54, 0xD6, 0x33, 0xD0, 0xE0, 0x11, 0xBF, 0x58, 0xB6, 0x29, 0xE5,
+    0x8D, 0x5F, 0xA9, 0x32, 0x2C, 0x54, 0x1D, 0xD9, 0xBB, 0xAA, 0x8C, 0x4D, 0x83, 0x34, 0x8B, 0xAC,
+    0xCE, 0x83, 0xC2, 0xAF, 0x50, 0x7B, 0xE6, 0x41, 0x79, 0x66, 0x08, 0x93, 0xC7, 0xFD, 0x7A, 0xF9,
+    0x28, 0x16, 0x6E, 0xBC, 0xB7, 0x5B, 0x60, 0x05, 0xD3, 0x54, 0x83, 0xD7, 0x8E, 0xAD, 0x6C, 0x1E,
+    0x99, 0x9A, 0x3C, 0x8F, 0xA3, 0xC1, 0xDB, 0xD5, 0xF0, 0xD6, 0xA9, 0xDC, 0x4E, 0xC2, 0x1F, 0x7E,
+    0x3A, 0x09, 0x0C, 0x5D, 0xFD, 0xDA, 0xF5, 0xA8, 0x7E, 0x28, 0x7C, 0xF0, 0x82, 0x1A, 0x16, 0x17,
+    0xD4, 0xA3, 0x3A, 0xD6, 0x79, 0x73, 0xE8, 0xA0, 0xAA, 0x62, 0xDB, 0x04, 0x45, 0xEA, 0xD7, 0xBC,
+    0x94, 0x9D, 0xC5, 0xC9, 0xE0, 0xFD, 0x1C, 0x66, 0x79, 0x5C, 0x99, 0xD8, 0x9C, 0xF0, 0x7C, 0x5B,
+    0xAE, 0xCE, 0x68, 0xC4, 0xCD, 0xFC, 0xF4, 0xF2, 0x3C, 0xB0, 0x3C, 0x12, 0x4E, 0x60, 0x1F, 0xA7,
+    0xC5, 0xDF, 0xC0, 0xA8, 0xCA, 0xFF, 0x7D, 0xC3, 0x9E, 0xE1, 0x3A, 0x52, 0xA3, 0x1F, 0x3F, 0x3C,
+    0xFE, 0xC3, 0x46, 0x29, 0x07, 0xE8, 0x8A, 0x3D, 0x84, 0xEE, 0x49, 0xC7, 0xBC, 0x7A, 0x10, 0xBA,
+    0x9E, 0x73, 0xB9, 0xD9, 0xB8, 0x84, 0xEF, 0xCE, 0xD9, 0xC7, 0x2E, 0x43, 0xD4, 0xCC, 0x1D, 0x9B,
+    0x3B, 0xF9, 0xF1, 0xD4, 0x6E, 0x39, 0xBA, 0x35, 0xF5, 0xC5, 0xB9, 0x4B, 0xAF, 0x1F, 0x01, 0xBE,
+    0x09, 0xB0, 0xF3, 0x66, 0xF6, 0xF2, 0xC3, 0x93, 0xA7, 0xC7, 0x4F, 0x00, 0x39, 0x12, 0x84, 0xF0,
+    0x8A, 0x56, 0xD3, 0x3F, 0x70, 0xA7, 0xFB, 0x8F, 0xFE, 0x50, 0x80, 0xF7, 0xE1, 0xCD, 0xD0, 0xED,
+    0xE3, 0x70, 0x0C, 0x5D, 0xDD, 0x49, 0x9D, 0xBC, 0x1D, 0x55, 0xBF, 0x5C, 0x7C, 0x6C, 0x77, 0xCA,
+    0xE4, 0xF6, 0xC4, 0xD8, 0x10, 0xF7, 0xEE, 0xD7, 0x9F, 0x4C, 0xE2, 0x95, 0x1E, 0x97, 0x06, 0x47,
+    0xE1, 0x03, 0x8B, 0x91, 0x56, 0xDF, 0x2E, 0x2F, 0xEF, 0x8D, 0x68, 0xEB, 0x1B, 0x4C, 0xE2, 0x18,
+    0x3C, 0xD3, 0x57, 0x32, 0x2F, 0xD3, 0x1D, 0x99, 0x04, 0x1B, 0x82, 0xFD, 0x69, 0x50, 0xDD, 0x41,
+    0x15, 0x65, 0xF1, 0xE5, 0x3C, 0x45, 0xD0, 0x33, 0xB3, 0x72, 0x76, 0x41, 0xA6, 0xB1, 0x43, 0xC3,
+    0x41, 0xE3, 0x65, 0x6B, 0xC9, 0x84, 0x6F, 0xD3, 0xE2, 0x50, 0xD4, 0x35, 0x53, 0xE1, 0x97, 0x5E,
+    0x9E, 0xE8, 0x2B, 0xDE, 0x66, 0x58, 0x1E, 0x4A, 0x97, 0xA0, 0xB2, 0xC3, 0xB5, 0x67, 0x41, 0x5A,
+    0x7F, 0x86, 0xD8, 0x7D, 0x87, 0x39, 0x63, 0xB7, 0x70, 0xCA, 0x78, 0xDB, 0x5B, 0xF0, 0x76, 0x7B,
+    0x06, 0x9B, 0x18, 0xCE, 0x49, 0xA4, 0x2F, 0xD7, 0x8F, 0x0C, 0x22, 0x9C, 0x09, 0x1C, 0x47, 0xD9,
+    0xE9, 0x74, 0x2E, 0xE7, 0x68, 0xA3, 0x01, 0x6F, 0xC2, 0xA7, 0x59, 0xC5, 0xCF, 0x5B, 0x1C, 0x78,
+    0xE4, 0x1C, 0xE2, 0xED, 0x9B, 0xA0, 0x65, 0x65, 0x01, 0xF1, 0x59, 0x68, 0xA7, 0x34, 0xA2, 0xF4,
+    0x56, 0x5F, 0xCA, 0x14, 0xC2, 0x2A, 0x5F, 0x3B, 0x67, 0x35, 0x4F, 0x52, 0x57, 0xF7, 0x1F, 0x6B,
+    0x2F, 0xC7, 0xBC, 0x1E, 0xF8, 0xC9, 0xE3, 0xF0, 0xD9, 0x36, 0x89, 0x80, 0xA8, 0x0B, 0xB3, 0x7E,
+    0xF4, 0x94, 0x06, 0x94, 0xCE, 0xF4, 0xA5, 0xA2, 0x6E, 0x42, 0xF0, 0x72, 0xA5, 0x6A, 0xD5, 0xF5,
+    0x30, 0xD4, 0xF9, 0xE8, 0x7B, 0x3A, 0x6B, 0xE5, 0x28, 0xE2, 0xD1, 0x6D, 0xDE, 0xCA, 0xFB, 0x46,
+    0xD7, 0x3A, 0x62, 0x14, 0xBA, 0x88, 0x71, 0x0D, 0x89, 0x5F, 0xA2, 0xD4, 0x46, 0xD9, 0x04, 0x13,
+    0xE4, 0xA8, 0x0C, 0xB3, 0x6E, 0xB6, 0xE0, 0xB7, 0x85, 0xB3, 0xCC, 0x27, 0x0C, 0x31, 0x91, 0x8A,
+    0xC2, 0x7F, 0x0C, 0x42, 0x41, 0x1F, 0xCC, 0x41, 0x74, 0x01, 0x0D, 0xC5, 0x7D, 0xDE, 0xC4, 0x50,
+    0xD4, 0xE7, 0x51, 0xD1, 0xBB, 0x88, 0x3E, 0xDF, 0xED, 0x2F, 0xB5, 0x95, 0x87, 0xBB, 0x39, 0xFC,
+    0xBD, 0x5D, 0x0A, 0xFC, 0x82, 0xD6, 0x99, 0x1A, 0x4C, 0x32, 0xB1, 0xB8, 0xC6, 0x2F, 0x26, 0x0C,
+    0xDA, 0x35, 0xAD, 0x3A, 0x4F, 0x98, 0xBB, 0x87, 0x53, 0x45, 0xEC, 0x5C, 0x45, 0x4C, 0x1B, 0x9A,
+    0xAC, 0x09, 0xEE, 0xD3, 0x43, 0x0F, 0xE2, 0x5E, 0xD6, 0x3E, 0x08, 0x7B, 0xDB, 0xC6, 0x93, 0x4C,
+    0x14, 0x07, 0xC4, 0x3A, 0x0B, 0x5C, 0xF0, 0x26, 0x39, 0x91, 0x2B, 0x64, 0xA2, 0x6C, 0xD8, 0x09,
+    0xB8, 0x02, 0xB2, 0xCB, 0xC6, 0xD0, 0xAD, 0x42, 0xC2, 0xE3, 0x0B, 0x44, 0x5D, 0xE7, 0x0A, 0xB2,
+    0xBE, 0x79, 0xA0, 0x34, 0xCA, 0x82, 0x9C, 0x6E, 0x35, 0xD2, 0x28, 0x4C, 0x68, 0xE9, 0x76, 0x4D,
+    0x9C, 0x62, 0xFA, 0xCE, 0x96, 0x50, 0xB3, 0x14, 0xBB, 0x88, 0x6D, 0x48, 0xAD, 0x63, 0x9E, 0x89,
+    0xFC, 0x52, 0xDB, 0x3A, 0x28, 0xEF, 0xBD, 0x8A, 0x0C, 0x23, 0x0E, 0x18, 0x23, 0xDD, 0x6F, 0x5A,
+    0x57, 0x22, 0x83, 0xD0, 0xB6, 0x00, 0xD0, 0xFC, 0xB5, 0xD6, 0x4D, 0x22, 0x11, 0x14, 0x90, 0x0E,
+    0x40, 0xBF, 0xBB, 0x14, 0x59, 0x84, 0x83, 0xF4, 0x0D, 0x73, 0xE9, 0x4D, 0xED, 0x6B, 0xEA, 0x69,
+    0xA3, 0x92, 0x65, 0x31, 0x58, 0x4A, 0xBA, 0xC5, 0x66, 0xB0, 0xA4, 0xFE, 0x16, 0xEC, 0x83, 0x25,
+    0xA5, 0x51, 0xC1, 0xA0, 0x89, 0x74, 0x45, 0x14, 0x0C, 0x46, 0x16, 0xD1, 0x4F, 0x3F, 0xE0, 0xB3,
+    0x8E, 0x64, 0x51, 0xDB, 0x0D, 0x0B, 0x26, 0x1A, 0xFB, 0xCA, 0xB4, 0x64, 0xBF, 0xFA, 0x4D, 0x6A,
+    0x2F, 0x75, 0x46, 0x99, 0xC0, 0x24, 0xD8, 0xC1, 0x8E, 0x97, 0x8F, 0x32, 0x5B, 0x4E, 0x7B, 0xB9,
+    0x57, 0xF8, 0xF9, 0x34, 0x33, 0xED, 0x8E, 0xCA, 0xD4, 0x9E, 0x7B, 0xAB, 0xE4, 0xAD, 0x62, 0xFD,
+    0x65, 0x16, 0xA4, 0x42, 0xA6, 0x11, 0x48, 0x72, 0xF9, 0x56, 0x4A, 0xAC, 0x04, 0x35, 0x33, 0xB5,
+    0x77, 0x24, 0x3F, 0x13, 0xE8, 0x25, 0x32, 0x2A, 0x0C, 0x3E, 0xFB, 0xB1, 0x08, 0x79, 0xE3, 0x16,
+    0x72, 0xB2, 0x8E, 0xF3, 0xAB, 0x7C, 0x30, 0x33, 0xCD, 0x94, 0x8E, 0x35, 0xA8, 0xF9, 0xF3, 0x8C,
+    0xF4, 0x6E, 0xE4, 0x6C, 0x65, 0x07, 0xBD, 0x20, 0xE2, 0x23, 0x21, 0xE9, 0xFE, 0x8D, 0xF5, 0xCE,
+    0x22, 0x34, 0xA5, 0x04, 0xB1, 0x45, 0xB1, 0x6D, 0x0E, 0xEB, 0xAE, 0x4F, 0xBE, 0xAE, 0x62, 0x04,
+    0xA5, 0xB2, 0x4C, 0xDA, 0x82, 0xA1, 0xAF, 0x10, 0xCD, 0x04, 0x71, 0xA6, 0xA1, 0x73, 0x61, 0x4F,
+    0x15, 0x7E, 0xD3, 0xFF, 0x11, 0x60, 0x4E, 0x50, 0x90, 0x92, 0x9E, 0x96, 0xC2, 0xFA, 0x57, 0x4E,
+    0xD7, 0x84, 0x3D, 0xB0, 0xEB, 0x44, 0x56, 0x90, 0xAE, 0x49, 0x40, 0xF0, 0x80, 0xC6, 0x62, 0x61,
+    0x62, 0x4F, 0x32, 0x9C, 0x48, 0x22, 0x6D, 0x13, 0xC8, 0xCA, 0x4E, 0x7E, 0x20, 0x32, 0xED, 0xB1,
+    0xF7, 0x86, 0x8F, 0x09, 0x7A, 0xAA, 0x39, 0xD5, 0x11, 0xF3, 0x31, 0x4F, 0x2B, 0x12, 0xD8, 0x1D,
+    0x74, 0x9E, 0xB6, 0x6B, 0x2D, 0x0C, 0x56, 0x1C, 0x67, 0xC5, 0x85, 0x0A, 0x91, 0x65, 0x4C, 0x3D,
+    0xDE, 0xD5, 0xFC, 0xD9, 0x50, 0x6F, 0x98, 0x87, 0x6C, 0x05, 0x58, 0xE7, 0x2E, 0xF8, 0xCB, 0x06,
+    0xF9, 0x42, 0x8A, 0x58, 0x3D, 0xAF, 0xD1, 0xC4, 0x61, 0xAE, 0xFE, 0xAC, 0xB8, 0xBB, 0x72, 0xB1,
+    0xC1, 0x7E, 0xAD, 0x0B, 0xE5, 0x6C, 0x6A, 0xA2, 0xC6, 0x6B, 0xB0, 0x6B, 0x75, 0xA9, 0xF6, 0xF9,
+    0xDB, 0x3A, 0x68, 0x3E, 0x38, 0x83, 0x20, 0xDB, 0x21, 0xDF, 0xB9, 0x54, 0xCF, 0x2B, 0x63, 0x95,
+    0xCD, 0x23, 0x61, 0x9D, 0x5D, 0x60, 0xBD, 0xCD, 0xB2, 0xBC, 0x22, 0x16, 0x8B, 0xA6, 0x07, 0xFA,
+    0x2B, 0x43, 0x8E, 0x18, 0xC6, 0xBE, 0xB4, 0x53, 0xF9, 0x43, 0x1D, 0xD4, 0x2B, 0x55, 0x74, 0x33,
+    0xBC, 0xC1, 0x08, 0x19, 0x91, 0x2C, 0x81, 0x4F, 0x30, 0x42, 0x0A, 0x27, 0xC8, 0xF2, 0x0C, 0x35,
+    0x24, 0xEC, 0x7E, 0x6B, 0xD4, 0x72, 0x9B, 0x8D, 0xA6, 0x62, 0xD1, 0xB2, 0x81, 0x78, 0xEC, 0x27,
+    0x7E, 0x41, 0x4E, 0xF3, 0x88, 0x9D, 0x69, 0x96, 0xCE, 0xA4, 0xCE, 0x99, 0x54, 0xD2, 0x4F, 0x80,
+    0x4F, 0x0E, 0xDA, 0xFC, 0x0A, 0xFE, 0xD7, 0xF8, 0x1B, 0x8D, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x18,
+    0x7D, 0x9E, 0x51, 0x18, 0x89, 0x51, 0x32, 0x0D, 0x0D, 0x04, 0x62, 0x6A, 0xB8, 0x9C, 0x9B, 0x14,
+    0x14, 0x7B, 0xEB, 0x91, 0xF8, 0x0B, 0x5C, 0x95, 0x82, 0x96, 0x0E, 0x8A, 0x14, 0x87, 0xB4, 0xB9,
+    0xB5, 0x94, 0x82, 0x82, 0xE2, 0x68, 0x92, 0x16, 0x5A, 0x8E, 0x82, 0x14, 0x57, 0x04, 0xB4, 0xC7,
+    0x4E, 0x92, 0x82, 0x32, 0x6E, 0x22, 0x5A, 0x4B, 0x09, 0x55, 0x8A, 0x0C, 0xD1, 0x48, 0x71, 0x22,
+    0x9F, 0x87, 0xF7, 0x79, 0x37, 0x3A, 0xD2, 0x71, 0x3A, 0x8F, 0x6C, 0xAF, 0xE7, 0x7D, 0xDF, 0xF7,
+    0xBE, 0xF7, 0xBD, 0x01, 0xD0, 0x03, 0x58, 0xF3, 0xAA, 0x03, 0x30, 0x8F, 0x40, 0x39, 0x03, 0x9C,
+    0xF3, 0xB0, 0xB7, 0x5A, 0x98, 0x90, 0xA0, 0xDB, 0x39, 0x54, 0x74, 0x4D, 0x11, 0x55, 0xE4, 0xC7,
+    0x2B, 0xAC, 0x8F, 0xD7, 0xA8, 0x73, 0x0E, 0xBC, 0x52, 0xE9, 0x71, 0xEA, 0x02, 0xAA, 0xA3, 0x16,
+    0xB6, 0x2B, 0x72, 0xEE, 0xEC, 0xE3, 0x7D, 0xEC, 0x11, 0x8D, 0x40, 0x86, 0x80, 0xD5, 0x17, 0x40,
+    0xCE, 0xC4, 0x70, 0x70, 0xF8, 0x08, 0x0B, 0x7C, 0xA3, 0x3A, 0x1D, 0x9C, 0x5F, 0x12, 0x21, 0xF1,
+    0x7B, 0x6F, 0x73, 0x87, 0xE9, 0x6F, 0x39, 0xC2, 0xDE, 0x5E, 0x70, 0x1F, 0x3F, 0xBD, 0xA8, 0x3A,
+    0x15, 0x66, 0x38, 0xD1, 0xB9, 0xC7, 0xE1, 0x2F, 0x9D, 0xF5, 0xB6, 0x89, 0x58, 0x10, 0xE2, 0x7E,
+    0x67, 0x52, 0x95, 0xB3, 0x9E, 0xA2, 0xB7, 0xD3, 0xBE, 0x3A, 0x0F, 0xC5, 0xEB, 0xE3, 0x1F, 0x6C,
+    0x03, 0x89, 0x5B, 0x30, 0xAE, 0x95, 0x42, 0xF8, 0x4B, 0xDA, 0xA6, 0xC0, 0xDB, 0x81, 0xB7, 0x8C,
+    0x53, 0xF9, 0xE9, 0x56, 0x47, 0xD9, 0xA8, 0xF3, 0xC8, 0xEB, 0x0C, 0xC6, 0xCF, 0x98, 0x9B, 0x5C,
+    0x07, 0xB8, 0x82, 0x13, 0xEC, 0x30, 0x87, 0x19, 0x71, 0x0E, 0x58, 0xEE, 0x89, 0xEE, 0x8A, 0xA8,
+    0x5B, 0x13, 0x4C, 0x28, 0x6F, 0x7F, 0xD9, 0xAE, 0x73, 0x8E, 0x99, 0x45, 0x92, 0x14, 0x12, 0x23,
+    0x21, 0x25, 0xF1, 0x1C, 0xD5, 0xEB, 0xE3, 0xC6, 0xF1, 0x96, 0xCC, 0x29, 0x86, 0x21, 0x79, 0x4C,
+    0x2B, 0x32, 0xAD, 0xC6, 0xFA, 0xE9, 0xED, 0x44, 0x07, 0x3F, 0xAF, 0xF2, 0x40, 0x3A, 0x22, 0xF3,
+    0xE7, 0x83, 0x6D, 0xAB, 0x58, 0x36, 0xA8, 0xF5, 0xC8, 0x84, 0x74, 0xAC, 0x03, 0x53, 0x2B, 0x6F,
+    0x0D, 0xB5, 0xE4, 0x5B, 0x7F, 0xCF, 0xEA, 0xEC, 0x93, 0x17, 0x49, 0x2A, 0x5C, 0x1E, 0x72, 0x55,
+    0xD3, 0x1E, 0xB8, 0x3C, 0x25, 0x4F, 0x1C, 0x08, 0x9C, 0x90, 0x67, 0x49, 0xB0, 0x94, 0x33, 0xBD,
+    0xCB, 0xEB, 0x35, 0xDF, 0xD5, 0xCF, 0x5E, 0x65, 0x8F, 0xB2, 0xCF, 0x47, 0x03, 0xCC, 0xE8, 0xD2,
+    0xB2, 0x53, 0xF9, 0x41, 0xFE, 0x9C, 0xEF, 0x3E, 0x78, 0xCA, 0xD4, 0xC2, 0x05, 0xDC, 0x03, 0x8B,
+    0x95, 0x12, 0x4C, 0x78, 0xE7, 0xD7, 0xA0, 0x05, 0x7B, 0xC5, 0x67, 0xC6, 0x69, 0x49, 0xE2, 0xC7,
+    0xAA, 0x2F, 0x9F, 0x0F, 0x96, 0x88, 0xEB, 0xB4, 0x69, 0xCF, 0xBB, 0x2C, 0x04, 0x37, 0x61, 0x44,
+    0x04, 0x75, 0xE3, 0x82, 0x3E, 0x23, 0xC7, 0x75, 0x54, 0x49, 0xE5, 0xE0, 0x42, 0x79, 0x8A, 0x79,
+    0xF1, 0x3A, 0x16, 0xC9, 0x1D, 0x05, 0x1B, 0x86, 0x43, 0xD4, 0xF6, 0x41, 0x42, 0x4F, 0x69, 0xD8,
+    0xBF, 0x5A, 0xF6, 0xFA, 0x50, 0xF7, 0xC8, 0xD1, 0xB5, 0x26, 0x63, 0x89, 0x2A, 0x6A, 0xB2, 0xE0,
+    0xDD, 0xB6, 0xF1, 0x40, 0xA7, 0x99, 0x7E, 0x38, 0x90, 0x4A, 0xD8, 0x2F, 0x9B, 0x70, 0xFE, 0xA7,
+    0x5B, 0x7C, 0xC2, 0x0E, 0x72, 0xFB, 0x80, 0xAA, 0xD5, 0x2C, 0x03, 0xA5, 0x2F, 0x07, 0xAC, 0x8A,
+    0xDC, 0xE9, 0xE8, 0x9E, 0xFB, 0xB2, 0x19, 0xF8, 0x64, 0xFF, 0x8C, 0x3A, 0x9E, 0x56, 0xDE, 0x7D,
+    0xD7, 0x0E, 0x38, 0x3D, 0x34, 0x51, 0xBF, 0xEC, 0xAA, 0xC6, 0x65, 0x9C, 0x61, 0x19, 0x99, 0x73,
+    0xA6, 0xBA, 0x5D, 0xC2, 0x48, 0xC0, 0xAE, 0xF2, 0x85, 0xD0, 0xBE, 0xE2, 0x35, 0xA7, 0x74, 0x4B,
+    0x5E, 0xF6, 0x51, 0x80, 0x7E, 0xC6, 0xC2, 0x45, 0x53, 0xC2, 0x69, 0x2D, 0x73, 0x30, 0x08, 0xDB,
+    0xF2, 0x43, 0x0F, 0x95, 0xB2, 0x34, 0x25, 0x62, 0x6E, 0x46, 0xAA, 0x28, 0xB7, 0x2C, 0x59, 0x34,
+    0x45, 0xF9, 0x08, 0x49, 0xAE, 0x59, 0xA1, 0xE4, 0x6C, 0x54, 0xD4, 0xDC, 0x9C, 0xD2, 0x59, 0xE8,
+    0x0E, 0x2B, 0xA6, 0x9E, 0x4C, 0x28, 0xA2, 0x0D, 0xAA, 0x73, 0x8D, 0x6E, 0x4B, 0x6F, 0x43, 0x85,
+    0x65, 0x53, 0xE3, 0x0F, 0x12, 0xB9, 0xD1, 0x2E, 0x54, 0x5F, 0x9C, 0xC1, 0xB5, 0xAC, 0x39, 0x63,
+    0xDE, 0xD9, 0x45, 0xF1, 0x32, 0x7C, 0xDB, 0xD9, 0x1F, 0xF5, 0x23, 0xBF, 0x37, 0xDB, 0x9B, 0x21,
+    0xBE, 0xF8, 0x27, 0x9A, 0x87, 0xCF, 0x6D, 0xB3, 0xEB, 0xFA, 0x3D, 0xA4, 0xFA, 0x7E, 0x34, 0xE1,
+    0x8C, 0x30, 0xEA, 0xA7, 0xB9, 0xCC, 0x6D, 0x62, 0x0C, 0x51, 0xFB, 0x05, 0xE0, 0x3D, 0x51, 0xDD,
+    0x82, 0x59, 0xB0, 0x8D, 0x95, 0x0C, 0xF5, 0x1C, 0x45, 0x62, 0x1C, 0xB6, 0x6B, 0x25, 0x82, 0x1F,
+    0x58, 0x39, 0x17, 0xD3, 0xA9, 0x9E, 0xF1, 0x28, 0x96, 0x1C, 0xA6, 0xC5, 0x70, 0x69, 0xA8, 0x20,
+    0xF6, 0xA3, 0x65, 0x6F, 0xCA, 0x40, 0x2F, 0xA8, 0x02, 0x99, 0xAA, 0x1B, 0x66, 0x46, 0x89, 0x8D,
+    0x62, 0x0F, 0x99, 0x3D, 0x19, 0x3D, 0x5D, 0x62, 0xE4, 0x66, 0x92, 0x5A, 0x70, 0x2E, 0x65, 0xC8,
+    0xA8, 0x55, 0xD7, 0x30, 0xB0, 0x6E, 0x25, 0x8D, 0xC4, 0x10, 0x8C, 0xD6, 0xCB, 0x2F, 0x73, 0x99,
+    0x36, 0x71, 0x86, 0xA0, 0xC7, 0x3B, 0xEB, 0x16, 0x32, 0x36, 0xD4, 0x2B, 0xD5, 0xAB, 0xE5, 0x0E,
+    0x97, 0x73, 0xF3, 0x9F, 0x36, 0x73, 0x88, 0x28, 0x35, 0x5E, 0x89, 0x43, 0xC8, 0xB1, 0x23, 0x87,
+    0x51, 0x4D, 0xA3, 0xA7, 0x3A, 0x13, 0x04, 0x9D, 0xA6, 0xD1, 0x18, 0x1A, 0x87, 0x6D, 0x4A, 0x56,
+    0x5A, 0xB1, 0xD0, 0x39, 0xEB, 0xDC, 0x93, 0x38, 0x36, 0x3F, 0x15, 0x50, 0x0F, 0xD1, 0xE6, 0x82,
+    0xE3, 0x36, 0xE7, 0x2C, 0xCB, 0x97, 0x26, 0x5C, 0x6E, 0x95, 0x44, 0xCB, 0xEC, 0xEB, 0xF2, 0xE7,
+    0x8D, 0x15, 0x30, 0xA7, 0xC9, 0x0B, 0x94, 0xF8, 0x9E, 0x54, 0xB8, 0x94, 0x2A, 0xF9, 0xF2, 0x5C,
+    0x8F, 0xC0, 0xD7, 0xBD, 0xA4, 0xC4, 0xEC, 0xFF, 0xFE, 0x6A, 0x7A, 0xAF, 0xD3, 0xF6, 0x63, 0xFA,
+    0xDD, 0xC6, 0x3E, 0x6E, 0x6E, 0xA1, 0xC4, 0x4F, 0x84, 0x35, 0x6A, 0xC7, 0x17, 0x28, 0xF3, 0x71,
+    0xA4, 0xAB, 0x91, 0xA5, 0x29, 0xA4, 0x4C, 0xE4, 0x7A, 0xDC, 0x14, 0x7A, 0x61, 0x7F, 0x7F, 0x5F,
+    0x78, 0x7E, 0x28, 0x4C, 0x78, 0xB1, 0x08, 0x31, 0x27, 0x25, 0x58, 0xFD, 0x16, 0xEF, 0xAD, 0xF4,
+    0xD2, 0x16, 0x5B, 0xEC, 0xA0, 0x22, 0x04, 0x79, 0x9F, 0x22, 0x17, 0xC3, 0x9B, 0x24, 0x0F, 0x70,
+    0x95, 0xC5, 0x2E, 0x48, 0x42, 0xC2, 0x2E, 0x19, 0x2B, 0xA9, 0x06, 0xC7, 0x3E, 0xB8, 0x23, 0xCF,
+    0xF8, 0xE4, 0x85, 0x09, 0x9B, 0x61, 0x93, 0xBC, 0xEC, 0x14, 0x84, 0x65, 0x83, 0x4F, 0xD9, 0xD1,
+    0xBA, 0x9F, 0x6E, 0xCF, 0xB9, 0x7F, 0xB5, 0xAB, 0xC2, 0x5D, 0xE7, 0xAF, 0x5D, 0xD3, 0xE1, 0xE2,
+    0x87, 0x2A, 0x5A, 0xEB, 0x7B, 0x7B, 0x7F, 0x5C, 0xAF, 0x5B, 0x9A, 0x7C, 0x3B, 0x59, 0x8F, 0xF4,
+    0x56, 0x2C, 0x95, 0x01, 0xB7, 0x99, 0x72, 0xBF, 0x11, 0x0F, 0x56, 0x8D, 0xB8, 0xC3, 0xE4, 0x87,
+    0x95, 0xC8, 0xD1, 0x4C, 0x62, 0xE8, 0x65, 0xA9, 0x64, 0x31, 0xCF, 0xE4, 0xAB, 0xC9, 0xAE, 0x2B,
+    0x59, 0xAC, 0xD4, 0x2C, 0xC9, 0x6D, 0xE7, 0xFD, 0xA5, 0x78, 0x76, 0x1C, 0x65, 0x61, 0x1F, 0x6C,
+    0xE4, 0xB0, 0x4F, 0xF3, 0xC0, 0xA5, 0xDC, 0x78, 0x7C, 0xD1, 0xA1, 0xE5, 0x21, 0xC0, 0x6A, 0x39,
+    0x12, 0xE8, 0x4C, 0x63, 0xFC, 0xD5, 0xC9, 0xA7, 0xA3, 0x0E, 0xA6, 0xD9, 0x25, 0x0F, 0x69, 0xBA,
+    0x0D, 0x25, 0x76, 0x71, 0xBA, 0xFF, 0x8A, 0x6A, 0xE8, 0xD9, 0x01, 0x69, 0xEA, 0xF9, 0x39, 0x40,
+    0x98, 0x16, 0xDD, 0x5D, 0xDC, 0x20, 0xCA, 0x25, 0x38, 0xE3, 0xCD, 0x2D, 0x2A, 0x2B, 0x16, 0x71,
+    0x56, 0x0C, 0xEE, 0xCE, 0xC8, 0x22, 0x7D, 0xF5, 0x24, 0x4C, 0x27, 0xC8, 0xBD, 0xE9, 0x2C, 0x91,
+    0x5E, 0xCB, 0xAE, 0xF8, 0xBE, 0x0E, 0xB6, 0x39, 0xB9, 0x84, 0x3D, 0x1D, 0x6E, 0x20, 0x3A, 0xC5,
+    0x98, 0x07, 0x0E, 0x7B, 0xAA, 0xFD, 0x8C, 0x4F, 0x05, 0x4F, 0x87, 0x99, 0x65, 0x03, 0xBA, 0x19,
+    0x92, 0xA5, 0x97, 0x85, 0x99, 0xF1, 0x57, 0xD0, 0xED, 0xE0, 0xB7, 0xEB, 0xB7, 0xC5, 0xE9, 0x33,
+    0x7D, 0x28, 0x9F, 0xE1, 0x7F, 0x62, 0x35, 0xC4, 0xBA, 0x2A, 0x58, 0xF1, 0x2D, 0xAC, 0xDF, 0xAF,
+    0xDF, 0x49, 0x82, 0x95, 0x5C, 0x9E, 0xEA, 0x62, 0x9D, 0x9B, 0x53, 0xE5, 0xCD, 0x29, 0x24, 0x53,
+    0x1A, 0xE9, 0xB1, 0x52, 0xA4, 0xA2, 0x69, 0xF1, 0xFF, 0x31, 0xF9, 0xED, 0x78, 0xAA, 0x39, 0xEC,
+    0x5C, 0xC1, 0x0E, 0xB5, 0x32, 0x2B, 0xFA, 0xF9, 0xAF, 0x71, 0x99, 0xDB, 0x3C, 0xBE, 0xD9, 0xF3,
+    0x2F, 0x95, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0x3B, 0x63, 0x67, 0x45, 0x56, 0xF1, 0xA4,
+    0x08, 0x15, 0x39, 0xEF, 0x3F, 0x70, 0xF6, 0x36, 0x29, 0xAE, 0xD8, 0xF3, 0x0E, 0xF1, 0x1F, 0x40,
+    0x8A, 0xA4, 0x8A, 0x04, 0x7F, 0x01, 0x4A, 0x0A, 0x17, 0x06, 0x9D, 0x73, 0x03, 0x4D, 0x84, 0x28,
+    0x12, 0x68, 0x69, 0xD2, 0x50, 0xC4, 0x4D, 0x8C, 0x74, 0x41, 0x87, 0x30, 0xBE, 0x49, 0x5C, 0xD0,
+    0x2E, 0x8A, 0x52, 0x51, 0x30, 0x11, 0x54, 0x91, 0x50, 0x86, 0x70, 0x88, 0x4D, 0x7C, 0x77, 0xC3,
+    0x9B, 0xB5, 0x93, 0xD0, 0x66, 0xD6, 0xB2, 0xF6, 0x76, 0xE6, 0xFB, 0x31, 0xDF, 0xF7, 0xDE, 0xFB,
+    0x80, 0xB8, 0x96, 0x80, 0xB4, 0x56, 0x80, 0xF0, 0xD2, 0x00, 0xB3, 0xA4, 0x06, 0x36, 0xB0, 0x07,
+    0xE4, 0xBA, 0x04, 0x32, 0x9B, 0x5F, 0x86, 0x74, 0x59, 0x70, 0xC9, 0x54, 0xDA, 0x55, 0xEC, 0xC3,
+    0x0B, 0x5B, 0x61, 0x1B, 0x7B, 0xCA, 0xAC, 0xA1, 0xCC, 0x68, 0x78, 0x43, 0x7A, 0xF9, 0x34, 0x24,
+    0x33, 0x11, 0x82, 0x9E, 0x20, 0x2C, 0x50, 0x19, 0x1C, 0xAF, 0xB3, 0x80, 0x07, 0x1C, 0xE8, 0x52,
+    0x58, 0x48, 0x8B, 0xF4, 0x31, 0xE8, 0x49, 0x61, 0x5B, 0xA1, 0xBB, 0x8A, 0x2E, 0x1D, 0x94, 0x49,
+    0xB3, 0x71, 0xCF, 0x4F, 0x42, 0x4D, 0xBB, 0x76, 0x4D, 0x18, 0xFE, 0x60, 0x62, 0xD1, 0xC7, 0x0E,
+    0x94, 0x16, 0x5E, 0xD4, 0xC8, 0xE3, 0x77, 0x3A, 0x8A, 0x2F, 0xC3, 0xE0, 0xE9, 0x22, 0x9E, 0x95,
+    0x3C, 0x88, 0x81, 0x18, 0xA3, 0x30, 0x55, 0x08, 0x5E, 0x86, 0x30, 0x47, 0xCE, 0x14, 0x70, 0x6D,
+    0xA1, 0x4F, 0xE2, 0x9F, 0xE3, 0x83, 0xB1, 0x0C, 0x35, 0xA6, 0xF9, 0x67, 0x1E, 0xBE, 0xC4, 0x76,
+    0xE2, 0xA7, 0xE8, 0x89, 0x5F, 0x1C, 0x4A, 0x79, 0x68, 0xB1, 0x2D, 0x7F, 0xB6, 0xD8, 0x4A, 0x7F,
+    0xD5, 0x18, 0x65, 0xB4, 0xF4, 0xEA, 0x03, 0x08, 0xB7, 0xA2, 0x4C, 0x6A, 0x3B, 0xAA, 0x1E, 0x9A,
+    0xAE, 0x0A, 0x01, 0x65, 0x1A, 0x66, 0xE8, 0x61, 0x72, 0xFB, 0xC4, 0x29, 0x4E, 0x07, 0x83, 0x82,
+    0x3E, 0xD7, 0xB1, 0x05, 0x5E, 0x02, 0x8A, 0x8F, 0xB4, 0xD2, 0x24, 0xD3, 0xC4, 0x61, 0xA8, 0x47,
+    0x50, 0x34, 0x00, 0x2D, 0x93, 0x10, 0x4C, 0xD2, 0xA4, 0x0E, 0x8D, 0x98, 0xB2, 0x70, 0x33, 0x54,
+    0x7C, 0x0A, 0x53, 0x58, 0xE5, 0xF8, 0x4C, 0xE5, 0xF4, 0xD8, 0xDF, 0xB5, 0x2F, 0xA2, 0xBB, 0xCC,
+    0xEC, 0x27, 0x4E, 0xDA, 0x12, 0x83, 0x54, 0xA7, 0x66, 0x0F, 0x8D, 0x42, 0xA1, 0x9B, 0xDC, 0xC7,
+    0x14, 0x86, 0x0B, 0x9F, 0x2C, 0x3E, 0x3C, 0xAE, 0x28, 0xF3, 0x14, 0xA1, 0xE1, 0x1E, 0xFB, 0x05,
+    0x46, 0x06, 0xEE, 0x07, 0xC3, 0xCB, 0xDB, 0xDC, 0x55, 0xFA, 0x00, 0x3B, 0xC2, 0x27, 0x53, 0x65,
+    0x32, 0x5B, 0xE0, 0x80, 0xC5, 0x72, 0xB1, 0x1F, 0x98, 0x18, 0xE6, 0xE2, 0xC4, 0xE3, 0x81, 0xB4,
+    0xE7, 0xA5, 0xE9, 0xA6, 0x7A, 0x3B, 0x0B, 0xB5, 0xDA, 0xF5, 0x2B, 0xE8, 0x75, 0x50, 0x76, 0x31,
+    0xEE, 0x5F, 0xF5, 0x3C, 0x3B, 0x61, 0xE1, 0x76, 0x77, 0xF5, 0x30, 0xD4, 0xEB, 0xF4, 0xAC, 0x63,
+    0xC3, 0x62, 0x8C, 0x59, 0xC4, 0x03, 0xD1, 0x40, 0x2C, 0x40, 0x1E, 0xFF, 0x86, 0xD8, 0x35, 0x98,
+    0xCC, 0xB0, 0x92, 0xDA, 0xA4, 0x1E, 0xA3, 0x54, 0x4C, 0xD9, 0x63, 0x94, 0x23, 0x17, 0x2E, 0xB5,
+    0x7D, 0x10, 0x2A, 0x21, 0x84, 0x5B, 0x6C, 0x8B, 0xC7, 0x6A, 0xAC, 0x0E, 0xA0, 0x91, 0x06, 0x64,
+    0xB7, 0xF7, 0x32, 0x7D, 0x26, 0x35, 0x57, 0x37, 0x43, 0x78, 0xB2, 0xB8, 0x7B, 0x69, 0x04, 0xF6,
+    0x19, 0x59, 0x9D, 0xB0, 0x54, 0xB6, 0x20, 0xC6, 0xDE, 0x54, 0xB9, 0x51, 0x6E, 0x80, 0xF4, 0xC1,
+    0x8C, 0x3D, 0xEF, 0x17, 0x37, 0x09, 0xA0, 0xE7, 0xFF, 0xB0, 0x5E, 0x79, 0xB5, 0xC3, 0xBD, 0xA3,
+    0x67, 0xEC, 0x30, 0xAF, 0xC0, 0xD7, 0x61, 0xC3, 0x7F, 0x45, 0xB0, 0xF1, 0x77, 0x20, 0x28, 0x8E,
+    0x8E, 0xA6, 0x48, 0x16, 0xC3, 0xCA, 0x62, 0x72, 0xEB, 0xAF, 0x80, 0xEA, 0x49, 0x50, 0x34, 0x9B,
+    0xE8, 0xA5, 0x77, 0x80, 0xDB, 0x38, 0x0F, 0x56, 0x63, 0x04, 0xE2, 0xFC, 0xC2, 0x52, 0x2E, 0x42,
+    0x5D, 0xFC, 0xD1, 0xC6, 0xEA, 0xA0, 0x12, 0x6C, 0x4A, 0x29, 0xFE, 0x4C, 0xCD, 0xF7, 0x76, 0xB4,
+    0x56, 0xAA, 0x6C, 0xD3, 0x3C, 0x77, 0xA3, 0xD5, 0xB1, 0x12, 0x0B, 0xF8, 0xCA, 0xAC, 0x13, 0xE2,
+    0x75, 0x7B, 0xF4, 0x93, 0x11, 0xC4, 0x1C, 0x58, 0x7E, 0x4B, 0x3B, 0x95, 0xDA, 0xF4, 0xA6, 0x8D,
+    0x68, 0xFB, 0xDB, 0xE2, 0x47, 0x0B, 0xE6, 0x97, 0x3B, 0xA8, 0x19, 0xE4, 0x6F, 0x56, 0xFC, 0xDE,
+    0xC0, 0x0F, 0xCD, 0x20, 0x26, 0xBA, 0x7C, 0x19, 0x15, 0xD1, 0xD6, 0xC5, 0x56, 0x0F, 0x7B, 0x5B,
+    0x70, 0x7B, 0x89, 0xF5, 0xD2, 0x3A, 0xF9, 0x79, 0x9D, 0x49, 0xBB, 0x21, 0x5F, 0x11, 0x8B, 0xED,
+    0xCF, 0xAC, 0xAA, 0x53, 0x9F, 0x36, 0xB2, 0x11, 0x0B, 0x06, 0x3B, 0x7A, 0x10, 0xF4, 0xA7, 0xFE,
+    0x5F, 0xBB, 0x36, 0xF8, 0xC1, 0xAB, 0x7C, 0x7F, 0x96, 0x1E, 0xCE, 0x37, 0x84, 0x5F, 0xE4, 0xBA,
+    0xA9, 0x94, 0xED, 0x67, 0x9B, 0xBE, 0x40, 0xC2, 0xC6, 0x95, 0x44, 0xCC, 0x3A, 0x52, 0x4B, 0x66,
+    0x11, 0x6C, 0x98, 0xB2, 0xBF, 0x03, 0x34, 0x84, 0x65, 0x1F, 0xCA, 0x14, 0x6C, 0x02, 0xE1, 0xE6,
+    0xD3, 0x10, 0x22, 0x62, 0x77, 0x5A, 0xC4, 0xDE, 0x80, 0xB2, 0x6D, 0xC8, 0xAC, 0x41, 0xFE, 0x0D,
+    0x0D, 0xB7, 0x95, 0x56, 0x84, 0xFB, 0xC3, 0x1A, 0x8E, 0x2D, 0x27, 0x5E, 0xD5, 0x57, 0x07, 0x22,
+    0x82, 0x34, 0xE0, 0xD4, 0xFC, 0x38, 0xBB, 0x2B, 0x57, 0x74, 0x11, 0x16, 0xB2, 0x16, 0x75, 0x49,
+    0xFA, 0x58, 0x69, 0xC7, 0x64, 0xBC, 0xCE, 0x34, 0x29, 0xD8, 0x42, 0x44, 0xF8, 0x3E, 0x36, 0xE8,
+    0xA3, 0xC6, 0x72, 0xE6, 0x58, 0x02, 0x36, 0x2E, 0xBC, 0x5F, 0x33, 0x58, 0x8F, 0x30, 0x5B, 0x21,
+    0xCE, 0xA4, 0x91, 0x9E, 0xA2, 0x31, 0x23, 0xEB, 0x87, 0x7A, 0x8C, 0x8A, 0x84, 0xCA, 0x27, 0x73,
+    0xA8, 0x5B, 0x0D, 0x73, 0x47, 0x8B, 0x42, 0x44, 0xF6, 0xEC, 0xA3, 0x05, 0xD0, 0x9B, 0x75, 0xAD,
+    0x56, 0x41, 0xCF, 0x22, 0x52, 0x4B, 0x24, 0x54, 0x0A, 0xC3, 0xDB, 0xD2, 0x8D, 0x58, 0xDC, 0x91,
+    0x24, 0x40, 0x38, 0xA9, 0xDF, 0x30, 0xCC, 0x2F, 0xF7, 0xCE, 0x91, 0xBE, 0x51, 0x55, 0x3C, 0x48,
+    0x5B, 0xA6, 0xC2, 0x3F, 0xFA, 0xA6, 0xA5, 0x32, 0xF1, 0x63, 0x49, 0x9C, 0x8C, 0x58, 0x1C, 0xBE,
+    0x71, 0xA7, 0xCF, 0xAD, 0x75, 0x6E, 0x14, 0x84, 0x63, 0x7E, 0x03, 0xB1, 0x73, 0x50, 0x84, 0x5E,
+    0x46, 0x07, 0xBC, 0x42, 0x5B, 0xA3, 0x22, 0xB2, 0x8C, 0xCE, 0xB9, 0x35, 0xE1, 0xA7, 0xBB, 0x6D,
+    0x28, 0x4A, 0xE8, 0x7B, 0x14, 0xA6, 0xE2, 0xD9, 0x33, 0xB7, 0x2E, 0xEB, 0xEE, 0x0A, 0x7C, 0x9A,
+    0x61, 0x5F, 0x1C, 0x9A, 0x0D, 0x78, 0xA7, 0xF4, 0x78, 0x83, 0x10, 0x67, 0xCD, 0x17, 0x24, 0xC0,
+    0x82, 0x27, 0x5F, 0xB4, 0x22, 0x17, 0xB3, 0xA0, 0xE8, 0x02, 0xC9, 0xB4, 0x55, 0xB1, 0x96, 0xF8,
+    0x67, 0xA3, 0x3C, 0x44, 0x81, 0xC8, 0x36, 0x99, 0x23, 0xFD, 0x12, 0x43, 0xF8, 0x89, 0xDA, 0xCD,
+    0x34, 0x76, 0x78, 0xD5, 0x43, 0x87, 0xFD, 0xB4, 0x26, 0x2C, 0x6C, 0xA2, 0x97, 0xE3, 0xD9, 0x51,
+    0x14, 0xBC, 0x9E, 0x42, 0x27, 0x35, 0x99, 0xA8, 0xA5, 0xF5, 0x70, 0x3D, 0x6C, 0x75, 0xB0, 0x46,
+    0xA6, 0x3C, 0x62, 0x9B, 0x41, 0x15, 0x8F, 0xF9, 0x9D, 0xC6, 0x39, 0x71, 0x26, 0x39, 0xC4, 0x77,
+    0xB6, 0x77, 0xA7, 0xD3, 0x53, 0xD9, 0x3D, 0x3B, 0x77, 0xAC, 0x4D, 0x14, 0x36, 0x5C, 0x42, 0xA2,
+    0x0B, 0xE1, 0x4A, 0xE9, 0xFA, 0xA9, 0x29, 0xE9, 0x33, 0xB5, 0x65, 0x86, 0x31, 0xD9, 0xAE, 0xF4,
+    0x88, 0x97, 0x51, 0x49, 0x9D, 0xC3, 0x75, 0x45, 0xDD, 0x91, 0x96, 0x2A, 0xDC, 0x50, 0x88, 0xA8,
+    0xA3, 0x6F, 0x69, 0x15, 0xA2, 0x95, 0x3F, 0x69, 0x65, 0xEC, 0x2F, 0x22, 0xA9, 0x97, 0x51, 0xB9,
+    0x38, 0x0D, 0xE4, 0xF1, 0xE4, 0xA0, 0x42, 0xEA, 0x38, 0x36, 0x14, 0xCA, 0xD5, 0x64, 0x5A, 0x04,
+    0x5F, 0x85, 0x28, 0xF3, 0x89, 0xC6, 0x32, 0x1B, 0x1D, 0x21, 0x06, 0x47, 0xFB, 0x2D, 0x26, 0xDD,
+    0x4D, 0x39, 0x63, 0x84, 0x53, 0xA9, 0x99, 0x26, 0x0F, 0x09, 0xC1, 0x3D, 0x06, 0x6C, 0xA2, 0x8C,
+    0xAF, 0x53, 0x39, 0xB3, 0x93, 0xE1, 0xA0, 0xDF, 0x4C, 0x25, 0xD2, 0x8A, 0xEE, 0x5F, 0x4D, 0xA5,
+    0x72, 0x2D, 0x99, 0x56, 0xAF, 0xDC, 0x47, 0xA9, 0x8B, 0x91, 0xC7, 0x6D, 0xA5, 0xD6, 0xF0, 0xEE,
+    0x4E, 0x94, 0x3D, 0xC2, 0x22, 0x99, 0xDE, 0xFF, 0xC8, 0xF1, 0xAE, 0x45, 0xF3, 0x1A, 0x7B, 0xBD,
+    0x6C, 0x86, 0x8E, 0xDA, 0xB4, 0x4A, 0xE1, 0xBA, 0xFC, 0x12, 0x67, 0x92, 0x47, 0x26, 0x65, 0x51,
+    0x39, 0x2E, 0x89, 0xFB, 0x95, 0x01, 0xE7, 0x8C, 0xE2, 0xBC, 0x3A, 0x7C, 0x39, 0x07, 0x95, 0x16,
+    0x17, 0xD2, 0x17, 0xFF, 0xC3, 0x2D, 0x41, 0xC3, 0x5A, 0x48, 0x12, 0xE0, 0x7A, 0xA6, 0xE5, 0x53,
+    0x4F, 0x49, 0x43, 0xF6, 0xB5, 0x13, 0xBC, 0x12, 0x45, 0x9B, 0xA9, 0x49, 0x26, 0x81, 0xC4, 0xB4,
+    0x69, 0xA4, 0xF5, 0x09, 0x28, 0x4E, 0x56, 0x42, 0xD0, 0xCC, 0xB0, 0x7E, 0xD1, 0xAE, 0xE1, 0xC2,
+    0x6A, 0xF2, 0x31, 0xE1, 0x74, 0xF3, 0xE5, 0xB7, 0x17, 0xEB, 0x96, 0x22, 0x85, 0x5E, 0x22, 0x9D,
+    0x31, 0x09, 0xE6, 0xD4, 0xEB, 0xB1, 0xF8, 0x7A, 0xFD, 0x07, 0x9D, 0x55, 0x31, 0x6F, 0x1C, 0x55,
+    0x10, 0xFE, 0x76, 0x5F, 0x92, 0x15, 0xDE, 0x3B, 0x3F, 0x8A, 0x14, 0x88, 0xD8, 0x59, 0x7E, 0xC0,
+    0xF9, 0x36, 0x85, 0x0B, 0x23, 0xDD, 0x66, 0x37, 0x69, 0x22, 0x41, 0x81, 0x8B, 0x5C, 0x43, 0x03,
+    0x05, 0x15, 0x02, 0xC5, 0x85, 0x8B, 0x2B, 0x42, 0xEE, 0x89, 0x08, 0xA5, 0xA0, 0x48, 0x2A, 0x68,
+    0x53, 0xA4, 0x00, 0x53, 0x70, 0x85, 0x0B, 0x23, 0x19, 0xEE, 0x59, 0x14, 0x14, 0x14, 0xAC, 0x88,
+    0xA8, 0x28, 0xF2, 0x00, 0x77, 0x14, 0x6C, 0xA2, 0x03, 0x1D, 0xD1, 0xDE, 0x3D, 0xBE, 0xD9, 0xB5,
+    0x09, 0x42, 0xA2, 0x61, 0x6D, 0xCD, 0xED, 0xED, 0xCD, 0xBC, 0xF9, 0xE6, 0xFB, 0x66, 0x66, 0x01,
+    0x40, 0xD9, 0x75, 0x8C, 0x42, 0x0B, 0xB9, 0x0A, 0x9C, 0xFB, 0xD8, 0x85, 0x56, 0x63, 0x07, 0x13,
+    0xED, 0x7D, 0xE0, 0x7D, 0x95, 0x89, 0x07, 0x70, 0x99, 0x1F, 0xCB, 0xCF, 0x4C, 0xEA, 0x2B, 0x8C,
+    0x17, 0x8D, 0x2F, 0x94, 0x01, 0xF6, 0x01, 0xFD, 0xBA, 0x89, 0xFC, 0x1C, 0xEF, 0xB6, 0x7E, 0x2F,
+    0x2F, 0x11, 0xFB, 0x1A, 0xCB, 0x6B, 0x56, 0x9B, 0x5E, 0x58, 0x85, 0x36, 0xC3, 0x40, 0x59, 0x65,
+    0x0E, 0x71, 0xA0, 0x8D, 0x2E, 0x66, 0x41, 0x95, 0x22, 0x55, 0x95, 0xAA, 0xA0, 0x3C, 0x90, 0x57,
+    0x08, 0xE7, 0x38, 0xBD, 0x22, 0xFE, 0x17, 0x72, 0x8A, 0x6A, 0xD0, 0xAC, 0xEC, 0x3D, 0x88, 0xFC,
+    0x22, 0x74, 0xC0, 0x0C, 0x18, 0x00, 0x29, 0x73, 0xF1, 0x37, 0x87, 0x80, 0xDF, 0x0F, 0x19, 0xDC,
+    0x7C, 0x07, 0x2E, 0x38, 0xCC, 0x7A, 0xCA, 0x74, 0x63, 0x7E, 0x1F, 0x22, 0xF1, 0xE8, 0x89, 0xFB,
+    0x76, 0xFE, 0x5B, 0x95, 0x78, 0x17, 0x2D, 0x0B, 0x39, 0x2B, 0xF9, 0x13, 0xCB, 0x4F, 0x58, 0x24,
+    0x31, 0xCB, 0x01, 0xBE, 0xC0, 0x8D, 0x8A, 0xE7, 0x9C, 0x0D, 0x66, 0xAC, 0x68, 0xEC, 0xCB, 0x94,
+    0x6E, 0xBA, 0x88, 0x2D, 0x71, 0x5D, 0x6F, 0xB0, 0x04, 0xA0, 0x77, 0x85, 0x4D, 0x1E, 0xA6, 0x19,
+    0x15, 0x96, 0x04, 0x31, 0x20, 0x84, 0xD8, 0x20, 0x28, 0xCE, 0x27, 0xCA, 0xD5, 0xC9, 0x9D, 0xEA,
+    0x2B, 0x9C, 0xF8, 0x4A, 0x4A, 0x56, 0x54, 0x9C, 0x7C, 0x1A, 0x6C, 0x08, 0x68, 0x96, 0x41, 0xCC,
+    0x07, 0x4D, 0x69, 0x4C, 0xCD, 0x84, 0xAC, 0xF5, 0xFA, 0x69, 0xB5, 0x42, 0x79, 0x05, 0x8C, 0x20,
+    0xCE, 0xBA, 0xA1, 0x33, 0x28, 0x81, 0x49, 0x53, 0xEB, 0x3A, 0x10, 0x37, 0x84, 0x06, 0x4E, 0xBC,
+    0x82, 0x1A, 0xBA, 0x46, 0x7C, 0x42, 0xD5, 0xB8, 0x46, 0x68, 0x26, 0xE8, 0x84, 0x06, 0x3B, 0x5D,
+    0xDE, 0xE6, 0x25, 0x6F, 0xCB, 0x4B, 0xAB, 0xE1, 0xFB, 0x66, 0xB3, 0xDB, 0x0D, 0xEC, 0x64, 0x12,
+    0xFB, 0x0F, 0x8B, 0x7C, 0x7E, 0x82, 0x0D, 0x1D, 0xDC, 0xC3, 0x8E, 0xA2, 0xE3, 0x1A, 0xBA, 0xB8,
+    0x8F, 0xDC, 0x2F, 0x43, 0xD3, 0x89, 0xBA, 0x98, 0x74, 0x2E, 0x29, 0xF3, 0xD8, 0x6A, 0xFF, 0x0A,
+    0xC6, 0xC7, 0xFF, 0x47, 0xD2, 0x51, 0x23, 0x29, 0xFE, 0x96, 0xB4, 0x49, 0xC8, 0x88, 0xB2, 0xA9,
+    0x6C, 0xFF, 0xB4, 0xD2, 0xFB, 0x3D, 0x8C, 0x32, 0x6C, 0x64, 0xD0, 0x19, 0xE2, 0x2F, 0xA1, 0x16,
+    0x08, 0x96, 0x80, 0xB7, 0xC8, 0x6A, 0xF4, 0x73, 0xA3, 0xAF, 0xCD, 0x23, 0x4B, 0x45, 0xC8, 0x31,
+    0x35, 0x00, 0xDE, 0x63, 0xC8, 0xF3, 0x27, 0xA1, 0x41, 0xA9, 0xAA, 0x1E, 0x96, 0xCA, 0xF6, 0xCB,
+    0x51, 0xFC, 0x4E, 0x7C, 0xF5, 0xA1, 0xAD, 0xF6, 0xB7, 0x74, 0x3F, 0xBE, 0xF2, 0xAB, 0xA9, 0x52,
+    0xA7, 0xD5, 0x3C, 0x74, 0x39, 0xB2, 0x53, 0x42, 0x49, 0x46, 0x49, 0x05, 0xD8, 0xA3, 0x18, 0x1B,
+    0xFC, 0xFB, 0xAA, 0x48, 0xEC, 0x3E, 0xFF, 0x6E, 0xCA, 0x9D, 0x2A, 0x91, 0x51, 0x94, 0xBE, 0x36,
+    0x48, 0x13, 0xF6, 0xC7, 0x2D, 0x08, 0xC3, 0xD0, 0x24, 0x2D, 0x66, 0x78, 0xEC, 0xDA, 0xE6, 0x4A,
+    0x29, 0x8A, 0x6F, 0x18, 0xC7, 0x94, 0x8F, 0x3E, 0x15, 0x48, 0xE6, 0x1C, 0x26, 0xCA, 0x6C, 0xA1,
+    0xEC, 0x62, 0x27, 0x42, 0x2F, 0xB4, 0xAB, 0x70, 0xAA, 0xD8, 0x0D, 0x6C, 0x8F, 0x43, 0x33, 0x1C,
+    0x29, 0xBF, 0x90, 0x4E, 0x00, 0xA3, 0x77, 0x4E, 0x13, 0x27, 0x7E, 0x9E, 0xFA, 0x19, 0x0B, 0x6C,
+    0x9B, 0x3B, 0x2A, 0xC9, 0x68, 0xA5, 0x6D, 0x4F, 0x17, 0x6B, 0x09, 0x7A, 0xE9, 0xF0, 0x80, 0xBF,
+    0x26, 0xBE, 0x8A, 0x7D, 0x83, 0xDA, 0x21, 0x92, 0x0E, 0x3A, 0xFB, 0xFB, 0xF5, 0xDC, 0xBB, 0xBE,
+    0x74, 0x90, 0xF2, 0x4E, 0xFF, 0x30, 0xB9, 0x89, 0x9F, 0x9D, 0xBA, 0x5B, 0x6C, 0xE4, 0x9F, 0x57,
+    0xDE, 0xDF, 0xA6, 0x24, 0x43, 0x02, 0xF4, 0xDE, 0x83, 0xA3, 0xEA, 0x8D, 0xAA, 0x91, 0x5B, 0xE4,
+    0x45, 0x6E, 0x10, 0xB9, 0x9C, 0x00, 0x0E, 0x39, 0x20, 0xD0, 0x64, 0x9A, 0x4E, 0xF7, 0x38, 0xC1,
+    0x19, 0x79, 0xCA, 0x34, 0xD3, 0xF7, 0x23, 0x4B, 0x48, 0xA1, 0x1B, 0x90, 0xEE, 0x99, 0x46, 0x6C,
+    0x45, 0xCE, 0x32, 0x95, 0x31, 0x1B, 0x0E, 0xB7, 0x53, 0xBF, 0x0C, 0xAA, 0xD8, 0x44, 0xB7, 0x4B,
+    0x6C, 0x54, 0x38, 0xB7, 0x44, 0xF8, 0xED, 0x16, 0x26, 0x3F, 0xD9, 0x6E, 0xB7, 0xA3, 0x8E, 0x8E,
+    0xEC, 0xEE, 0x60, 0xBD, 0x55, 0x66, 0x1B, 0xDB, 0xA1, 0x37, 0x17, 0xF1, 0xDE, 0x86, 0xB2, 0xBA,
+    0xA8, 0x0E, 0x82, 0xC7, 0x53, 0x8F, 0x0B, 0x04, 0x82, 0xE9, 0x47, 0x0B, 0x24, 0x46, 0x39, 0x4E,
+    0x5A, 0xCA, 0x41, 0x0D, 0x2B, 0x92, 0x7C, 0x99, 0x43, 0xAB, 0x1C, 0xC7, 0xE1, 0x30, 0xAC, 0xA0,
+    0x4D, 0x6A, 0xE2, 0x19, 0xB7, 0xCB, 0x42, 0xA0, 0x1B, 0x70, 0x00, 0x5B, 0x7E, 0x31, 0x26, 0xB5,
+    0x3F, 0x2A, 0xD3, 0x5B, 0xED, 0xE1, 0x0F, 0x5F, 0xD2, 0x83, 0x03, 0x97, 0x71, 0x46, 0x46, 0xCA,
+    0x06, 0xEE, 0x22, 0xE2, 0x62, 0x1F, 0x83, 0xB0, 0x0C, 0x5C, 0x6C, 0xD3, 0x82, 0xA4, 0xB2, 0x97,
+    0xA9, 0x9F, 0xFB, 0xA7, 0xCA, 0xC1, 0x5B, 0x62, 0xD3, 0x5A, 0xAC, 0x9F, 0x9D, 0xE7, 0xE8, 0xF9,
+    0x92, 0x1D, 0x95, 0x94, 0xB2, 0xC2, 0xF2, 0x66, 0x91, 0xD5, 0x62, 0x65, 0x89, 0xE4, 0x32, 0x94,
+    0xB4, 0xBA, 0x14, 0x4B, 0xAD, 0x69, 0x85, 0xB4, 0x1C, 0xB2, 0xE2, 0xF2, 0xAB, 0x72, 0x48, 0x7E,
+    0x4D, 0xFA, 0x3A, 0xBF, 0xEB, 0x1A, 0x1E, 0x6D, 0x63, 0x8B, 0xC6, 0x3E, 0xCB, 0x93, 0x3E, 0xDB,
+    0x61, 0xD8, 0x18, 0x60, 0x55, 0xD9, 0xD0, 0x0E, 0xB0, 0x4B, 0x5E, 0x90, 0x85, 0xA5, 0x2A, 0x47,
+    0xEC, 0x33, 0x84, 0xBF, 0x90, 0x0E, 0xB2, 0xC1, 0xE8, 0xB4, 0x99, 0x68, 0xD9, 0x76, 0xEA, 0x6B,
+    0xEF, 0xB0, 0xDB, 0x2C, 0x19, 0x34, 0x53, 0xCF, 0xDB, 0x9C, 0xCA, 0xDE, 0xDA, 0x7B, 0xD0, 0x2C,
+    0x0E, 0x82, 0x0C, 0x98, 0x9F, 0x9C, 0xC9, 0xDE, 0x02, 0xBB, 0x56, 0x56, 0x09, 0x25, 0x6B, 0xDB,
+    0x33, 0x21, 0xE4, 0xB4, 0xC0, 0x09, 0xE8, 0xD3, 0x6B, 0x5D, 0xE6, 0x76, 0x65, 0xEF, 0x90, 0xF4,
+    0x99, 0x7E, 0x1B, 0x34, 0x68, 0x63, 0xA4, 0xC3, 0x4D, 0x53, 0x3A, 0x95, 0x68, 0x6B, 0x97, 0x48,
+    0x5F, 0x07, 0x4F, 0xF7, 0xEE, 0x71, 0xB5, 0xC9, 0x28, 0x49, 0x3E, 0x76, 0x15, 0x3C, 0x9F, 0xCE,
+    0xDB, 0x74, 0xE2, 0xC5, 0xD0, 0xC8, 0xB5, 0xD9, 0xEA, 0x36, 0x56, 0xAE, 0xD8, 0x97, 0x5B, 0x32,
+    0xEF, 0x89, 0xB7, 0xD9, 0xF0, 0xB4, 0x71, 0x65, 0x05, 0xB6, 0x44, 0x79, 0x43, 0x7D, 0x4B, 0x39,
+    0x42, 0xD6, 0xB8, 0x54, 0x23, 0x48, 0x90, 0x48, 0xE4, 0x07, 0x5C, 0xF5, 0x9E, 0xDD, 0xB9, 0x60,
+    0x61, 0x87, 0x7C, 0x7C, 0x99, 0x1C, 0xC8, 0xAA, 0x8D, 0x6C, 0x58, 0x86, 0x8E, 0x28, 0x66, 0xF1,
+    0x0C, 0x99, 0x54, 0x8D, 0xB7, 0x0B, 0xEF, 0x2E, 0x61, 0x0D, 0x2B, 0x8C, 0xB8, 0xE2, 0x76, 0x26,
+    0x9D, 0xAD, 0xA8, 0x1B, 0xDD, 0x61, 0x2E, 0x6D, 0xF3, 0x32, 0x2D, 0xC2, 0x59, 0x52, 0x11, 0x57,
+    0x1E, 0xCD, 0xC9, 0x87, 0x3E, 0x5A, 0xD0, 0x06, 0xF3, 0xA9, 0xF0, 0x93, 0xA7, 0xDF, 0x09, 0x5B,
+    0x8F, 0x1E, 0x09, 0x1C, 0x2F, 0x5D, 0x46, 0x50, 0x62, 0x23, 0x2F, 0xE7, 0x2A, 0xDF, 0xA8, 0x20,
+    0x2D, 0x28, 0x96, 0xF0, 0xA2, 0xE5, 0x92, 0xBA, 0xC6, 0xB5, 0xE7, 0x9B, 0x29, 0xAE, 0xC7, 0xDF,
+    0xB0, 0x41, 0x17, 0x69, 0xE5, 0x8F, 0xF4, 0x42, 0xD7, 0xC9, 0xA2, 0x7D, 0x49, 0x4E, 0x1A, 0xBB,
+    0xD9, 0xD8, 0x4E, 0x4B, 0xC3, 0x20, 0xB9, 0x6D, 0xE3, 0x57, 0xBF, 0x2F, 0xF1, 0xE4, 0x09, 0xA7,
+    0xE6, 0x0B, 0xF2, 0xB0, 0x74, 0xED, 0x1E, 0x4A, 0x67, 0x6D, 0xAB, 0x70, 0x92, 0x91, 0xDF, 0x5A,
+    0x20, 0xBF, 0xF1, 0x86, 0x1D, 0xBF, 0xF6, 0xF0, 0xA9, 0xB4, 0x90, 0x1C, 0xF7, 0x12, 0x2E, 0x1C,
+    0xF3, 0x47, 0x7B, 0x56, 0xC8, 0xB9, 0xC8, 0xD4, 0x05, 0x85, 0x5A, 0x99, 0x5A, 0x25, 0x98, 0x0E,
+    0xDA, 0x17, 0x83, 0xA5, 0xFE, 0x6F, 0x86, 0x7C, 0x53, 0xD5, 0x9A, 0x9A, 0x4C, 0x8F, 0x9B, 0x05,
+    0x4B, 0x14, 0x67, 0x18, 0x3F, 0x2D, 0xCE, 0x3C, 0x07, 0xEE, 0xF7, 0x35, 0x2C, 0x65, 0xE3, 0x72,
+    0x81, 0x6F, 0x9E, 0x49, 0x42, 0x5F, 0xE6, 0xC7, 0x7C, 0x99, 0xBF, 0x08, 0xBC, 0xC0, 0x26, 0x8B,
+    0x4B, 0xFC, 0xC7, 0xF5, 0x17, 0x4D, 0x55, 0x31, 0x8F, 0xD4, 0x46, 0x18, 0x7D, 0xE3, 0x11, 0x38,
+    0xC1, 0xE4, 0x86, 0x02, 0xA5, 0x88, 0xEE, 0xCE, 0x0D, 0x45, 0x84, 0xF6, 0xCE, 0x29, 0x28, 0x28,
+    0xBC, 0xF6, 0x28, 0x29, 0x53, 0x84, 0xE2, 0xAE, 0x4F, 0x49, 0x13, 0x41, 0x71, 0x52, 0x36, 0xD1,
+    0x72, 0x6B, 0xC4, 0x1F, 0xB8, 0x9A, 0x26, 0x94, 0x88, 0x28, 0x0A, 0xC5, 0x45, 0xB9, 0x62, 0x8F,
+    0x9D, 0x90, 0x48, 0x29, 0xCF, 0x52, 0x22, 0x51, 0x50, 0x60, 0x8A, 0x88, 0x22, 0x05, 0x43, 0x30,
+    0xCA, 0x8A, 0x78, 0x77, 0xF2, 0x3E, 0x2F, 0x48, 0xAC, 0x6F, 0xAC, 0x9B, 0xB1, 0x67, 0xBE, 0xF7,
+    0xBD, 0xF7, 0xBE, 0xCF, 0x88, 0x5D, 0x09, 0xCC, 0x8D, 0x83, 0xF9, 0xB4, 0x85, 0xF2, 0xC7, 0x40,
+    0x91, 0x56, 0xD0, 0x8F, 0x1A, 0xE0, 0xB8, 0x03, 0x4C, 0x00, 0x10, 0x1C, 0x90, 0xB5, 0x80, 0x0E,
+    0x15, 0x30, 0x59, 0x00, 0xC9, 0x13, 0x0F, 0x74, 0x33, 0x87, 0xF4, 0xD6, 0x02, 0x51, 0x5B, 0x7A,
+    0x94, 0x2A, 0xB8, 0xB8, 0x31, 0xCB, 0x75, 0xBE, 0x1E, 0xF1, 0x75, 0x5C, 0xE6, 0x50, 0x90, 0x9F,
+    0x3F, 0xC2, 0xD3, 0x46, 0x3D, 0x72, 0xFA, 0x04, 0x7A, 0x8A, 0xC4, 0xC3, 0x34, 0x48, 0x3D, 0xB6,
+    0x3A, 0xE4, 0x0F, 0x30, 0x2A, 0xED, 0x61, 0xF6, 0x0B, 0xF0, 0x3E, 0x70, 0xB6, 0x7F, 0x5B, 0x35,
+    0x18, 0x63, 0x80, 0xD4, 0xEA, 0xDF, 0x74, 0x8D, 0x6F, 0x9B, 0x39, 0xCC, 0x7E, 0x01, 0xBC, 0x7C,
+    0xEC, 0xB0, 0xB9, 0xEF, 0x09, 0x81, 0xA0, 0x4A, 0x02, 0x4A, 0x4E, 0x96, 0xC4, 0xFD, 0x5F, 0x8B,
+    0x34, 0xBD, 0xE6, 0xA2, 0x7F, 0x7C, 0x40, 0x71, 0xD1, 0xCC, 0xE3, 0x1A, 0x93, 0x9A, 0x87, 0xD8,
+    0x35, 0x1C, 0xAA, 0x3F, 0xB7, 0xB0, 0xFD, 0xBB, 0xD5, 0xC7, 0x35, 0xBE, 0x6E, 0xFB, 0x44, 0x9E,
+    0x75, 0x18, 0xFC, 0xDC, 0xE8, 0x93, 0xCC, 0x8E, 0xC0, 0x2C, 0x74, 0x9D, 0xD9, 0x34, 0xA4, 0xD5,
+    0xE9, 0xE5, 0x77, 0x15, 0x0A, 0x52, 0x90, 0x1A, 0x39, 0xD7, 0x41, 0xFF, 0x5D, 0x43, 0x05, 0x9E,
+    0x13, 0xC8, 0x02, 0x93, 0x43, 0xDA, 0x33, 0x21, 0x0F, 0xE6, 0x4C, 0x37, 0x58, 0x74, 0x99, 0x47,
+    0x11, 0x2F, 0x91, 0xD9, 0x50, 0x1B, 0x27, 0x8F, 0x4F, 0xF3, 0x0D, 0xC4, 0xC1, 0x9B, 0xE0, 0x91,
+    0x03, 0x23, 0xE0, 0x70, 0x8C, 0x17, 0x5E, 0x3D, 0x73, 0x51, 0x80, 0xEE, 0x10, 0x2F, 0x90, 0xCC,
+    0x60, 0xAE, 0xB9, 0xD4, 0x34, 0x59, 0xDC, 0x16, 0xBA, 0x2B, 0xC3, 0x3C, 0xF9, 0x23, 0x04, 0x35,
+    0x87, 0xF6, 0xFB, 0xE8, 0x01, 0xC4, 0xBF, 0x32, 0xD8, 0x54, 0x82, 0xFD, 0x68, 0x57, 0x08, 0xCA,
+    0xB9, 0xD0, 0x4E, 0x5E, 0x26, 0x7E, 0x05, 0x01, 0xAF, 0x99, 0x77, 0xF6, 0x45, 0xCB, 0x4D, 0x9C,
+    0x09, 0x86, 0xA4, 0x2E, 0x5B, 0x74, 0x4A, 0x9E, 0x61, 0xD2, 0x6D, 0xEE, 0x1E, 0x8D, 0xF0, 0x93,
+    0xC7, 0x4B, 0x87, 0xE7, 0x88, 0x3A, 0xE8, 0x39, 0xE2, 0x0E, 0xC9, 0x04, 0x26, 0xAB, 0x36, 0x8D,
+    0xDB, 0x22, 0xFF, 0xA7, 0x80, 0xF3, 0x98, 0x42, 0x37, 0xBA, 0x81, 0xB1, 0xC6, 0x92, 0xF0, 0x31,
+    0x22, 0xAF, 0xA9, 0x4C, 0x45, 0x10, 0xFB, 0xBC, 0xA2, 0x36, 0x22, 0x65, 0x8E, 0xB3, 0x12, 0x93,
+    0x10, 0xE6, 0x51, 0x08, 0x4C, 0x94, 0x37, 0x72, 0x1F, 0x3A, 0xD5, 0x51, 0x43, 0xAA, 0x58, 0xDA,
+    0xD2, 0x2A, 0x99, 0x25, 0x9E, 0x44, 0x21, 0xB6, 0xBC, 0x0D, 0x44, 0xC4, 0x2B, 0x72, 0xDB, 0x43,
+    0x93, 0x63, 0xCF, 0x60, 0x10, 0x57, 0x26, 0xAA, 0xB5, 0xF3, 0x51, 0x53, 0xDC, 0x6B, 0xB3, 0xD0,
+    0xF1, 0x1C, 0xED, 0x92, 0x9B, 0x5E, 0xD7, 0x53, 0xF5, 0x82, 0x8E, 0x62, 0x9A, 0xE7, 0xF0, 0xE6,
+    0x37, 0x64, 0xDA, 0xC1, 0x29, 0x8F, 0x84, 0xB1, 0x12, 0x09, 0x0F, 0x19, 0x64, 0x81, 0x83, 0xEA,
+    0xCA, 0xC8, 0x38, 0xE1, 0x20, 0x4D, 0x1C, 0xCC, 0x01, 0x71, 0x43, 0x21, 0xB8, 0x56, 0xF5, 0x6B,
+    0x44, 0xE9, 0x85, 0xB4, 0x20, 0x8C, 0xA4, 0x21, 0x2C, 0x57, 0x6B, 0xE2, 0x5F, 0xBA, 0x45, 0xD6,
+    0x1C, 0x66, 0x5C, 0x9B, 0x09, 0x37, 0x32, 0xD2, 0x5A, 0x7C, 0x57, 0xEB, 0xD0, 0x0C, 0xF0, 0xCD,
+    0x0E, 0xA1, 0x89, 0x7C, 0x44, 0x60, 0x0D, 0xCD, 0x1B, 0x91, 0xA3, 0x7B, 0xC7, 0x88, 0xE4, 0xB4,
+    0x92, 0xE6, 0xE3, 0xE3, 0x8A, 0x74, 0xB5, 0x48, 0xAA, 0x54, 0x08, 0x97, 0xE3, 0x89, 0x95, 0x47,
+    0x78, 0x2E, 0xD3, 0x03, 0x04, 0x4D, 0xF8, 0x04, 0xB2, 0x0D, 0x29, 0xA4, 0x9A, 0x44, 0xD2, 0x10,
+    0xE5, 0xAE, 0x8D, 0x1D, 0x31, 0xD9, 0x23, 0x4C, 0x0E, 0xC6, 0xC6, 0x26, 0x4D, 0x54, 0xCB, 0x5B,
+    0x5B, 0x29, 0x49, 0x8F, 0x1E, 0x7A, 0xD5, 0x22, 0x2F, 0x98, 0x95, 0xF9, 0xAC, 0xD6, 0x3E, 0xF5,
+    0x63, 0x16, 0x54, 0xBB, 0x62, 0x84, 0x6C, 0x59, 0x0C, 0x77, 0xC7, 0x3C, 0x55, 0x68, 0xA9, 0x18,
+    0x7E, 0xC8, 0x8B, 0xE1, 0x38, 0x73, 0x31, 0x3D, 0xC0, 0x8B, 0x78, 0x5E, 0xED, 0xC4, 0x2E, 0x0E,
+    0x8B, 0x6D, 0x64, 0x07, 0x63, 0x21, 0xEB, 0x90, 0x50, 0xA3, 0x1A, 0x9B, 0x48, 0xE4, 0x69, 0x2E,
+    0x33, 0xD6, 0x1D, 0xE8, 0xA5, 0x69, 0xDC, 0xBC, 0x61, 0xFB, 0xBC, 0x54, 0xEB, 0x42, 0x82, 0x08,
+    0x71, 0xA5, 0xED, 0x19, 0xCD, 0xDA, 0xC8, 0xAB, 0xD7, 0x53, 0x5D, 0xC7, 0xD5, 0x46, 0x52, 0x19,
+    0x6C, 0x18, 0x9B, 0x23, 0x4F, 0x59, 0xD1, 0x47, 0xDB, 0x38, 0x8C, 0xFC, 0x10, 0x6D, 0x52, 0xF3,
+    0x56, 0xDA, 0x02, 0xCB, 0xC5, 0x46, 0x59, 0x91, 0xE2, 0x8C, 0x04, 0x2F, 0xC4, 0x1F, 0x07, 0x6A,
+    0x76, 0xF0, 0xE6, 0x70, 0x12, 0x81, 0x89, 0x93, 0xE0, 0x42, 0xDA, 0x3C, 0xB1, 0xA3, 0x8D, 0x35,
+    0xD4, 0x67, 0x37, 0x74, 0x35, 0xC8, 0xB5, 0xDD, 0xBB, 0x1C, 0x2B, 0x9F, 0x27, 0x9F, 0xBB, 0x22,
+    0x09, 0x5F, 0xD1, 0x54, 0x0B, 0x92, 0xF8, 0x16, 0x96, 0xFC, 0xAE, 0xCD, 0x85, 0x5C, 0x87, 0xEC,
+    0xAF, 0xAB, 0xD2, 0x30, 0x44, 0x3B, 0x48, 0xD1, 0xB2, 0x33, 0x70, 0x42, 0x81, 0x71, 0x43, 0x70,
+    0x3B, 0xAC, 0x8C, 0x20, 0xBA, 0x2A, 0xA9, 0x93, 0x74, 0x79, 0xDB, 0x2B, 0x11, 0xDD, 0x88, 0x28,
+    0x13, 0x69, 0x17, 0x33, 0x69, 0x5B, 0x1F, 0x4A, 0x72, 0x17, 0x38, 0x1E, 0xBC, 0x1B, 0x84, 0x9E,
+    0xB6, 0x9D, 0x20, 0xCD, 0xD1, 0x93, 0x2B, 0x54, 0x76, 0x88, 0x96, 0x77, 0x68, 0x86, 0x88, 0xDB,
+    0x2E, 0x40, 0x39, 0x46, 0x3D, 0xB5, 0xBB, 0xBB, 0x43, 0x8C, 0x4B, 0x96, 0x42, 0x77, 0x8E, 0x94,
+    0x53, 0x33, 0x0E, 0x9E, 0x98, 0xAE, 0xEC, 0x29, 0xDB, 0x7A, 0x3C, 0xD3, 0x15, 0x1C, 0xD6, 0x34,
+    0x44, 0x77, 0xC1, 0x19, 0x73, 0x24, 0x52, 0xBC, 0x92, 0xC0, 0x75, 0x8E, 0xFB, 0xAB, 0xD8, 0x2C,
+    0x84, 0x8B, 0x0F, 0xEE, 0x4A, 0x9F, 0xDC, 0x13, 0x31, 0xF9, 0xC7, 0xD6, 0x47, 0xC1, 0x34, 0xDB,
+    0x80, 0x13, 0x28, 0xCC, 0x4D, 0x55, 0xAB, 0x9A, 0x40, 0xCB, 0x36, 0x78, 0xCB, 0x63, 0x9A, 0xB8,
+    0xA4, 0x4E, 0xAB, 0x7D, 0x94, 0x3C, 0xB9, 0x2B, 0xA1, 0xFF, 0xA5, 0x0F, 0x09, 0x53, 0x1A, 0x50,
+    0xE9, 0x7A, 0x7E, 0x24, 0x1C, 0x0B, 0x41, 0xFE, 0x95, 0xA8, 0x5C, 0x8D, 0xA4, 0x00, 0x46, 0x18,
+    0x8D, 0xE1, 0xC7, 0x51, 0x93, 0xC7, 0x2E, 0xA7, 0xA0, 0xDB, 0x18, 0xE6, 0x18, 0x1E, 0x82, 0x7D,
+    0x2C, 0x73, 0xB2, 0x21, 0xEB, 0x13, 0x61, 0x1E, 0xC7, 0x7D, 0x66, 0x05, 0x33, 0xEC, 0x8C, 0x8B,
+    0x3C, 0x2D, 0x56, 0xC7, 0xB5, 0xA9, 0xE2, 0x86, 0xE1, 0xF8, 0x79, 0xD0, 0xAF, 0xD8, 0x02, 0x59,
+    0x60, 0xD2, 0x6F, 0x14, 0x43, 0x97, 0x2C, 0xAC, 0x92, 0x73, 0xB6, 0x9A, 0xBE, 0x9E, 0x12, 0xA6,
+    0x69, 0xA4, 0x65, 0x8A, 0x98, 0x57, 0x79, 0x49, 0xAD, 0x30, 0x2E, 0x72, 0x26, 0xC6, 0xC8, 0xC8,
+    0x37, 0x21, 0xB1, 0x25, 0x38, 0x0A, 0x01, 0xCB, 0xF0, 0x21, 0x54, 0xA5, 0xD8, 0xFC, 0x5D, 0x2A,
+    0xE5, 0x77, 0xC6, 0xE2, 0x0C, 0x3B, 0x93, 0x00, 0x1A, 0xCA, 0x8D, 0x1D, 0xA9, 0xA2, 0x50, 0xC2,
+    0x7E, 0xD1, 0x4B, 0xF0, 0xA4, 0x97, 0x5D, 0x4C, 0x20, 0xE9, 0xC3, 0xD4, 0x6F, 0xBD, 0x4C, 0x5D,
+    0x79, 0x7B, 0x2C, 0xBC, 0x3F, 0x95, 0x7E, 0xDA, 0x94, 0x24, 0xB4, 0x91, 0x8F, 0x8F, 0x57, 0x4B,
+    0x01, 0x58, 0x3E, 0x94, 0x0D, 0xE8, 0x2D, 0x77, 0x49, 0x6E, 0xEF, 0xAD, 0xAA, 0x0D, 0xEB, 0xD8,
+    0x8B, 0xAD, 0xBE, 0x59, 0x23, 0x1F, 0x81, 0xAF, 0x8A, 0xD4, 0x22, 0x27, 0x9D, 0x9C, 0x0E, 0x11,
+    0x4B, 0xA5, 0xA6, 0xF6, 0x06, 0xE6, 0x57, 0xFA, 0x6F, 0x16, 0xDC, 0x47, 0xF7, 0xEE, 0x9E, 0x62,
+    0x5F, 0x58, 0x23, 0xC0, 0x0D, 0xBA, 0x68, 0xC0, 0x7C, 0x73, 0x1C, 0x51, 0x56, 0x4F, 0x5D, 0x3D,
+    0xEE, 0x33, 0x73, 0x36, 0x3A, 0x34, 0xDA, 0xA9, 0x3A, 0x76, 0x91, 0xA3, 0xCD, 0xA5, 0x01, 0xF6,
+    0x83, 0xFB, 0x8F, 0xD0, 0x17, 0x88, 0x18, 0x00, 0x52, 0x38, 0x65, 0xF8, 0x80, 0x35, 0xA2, 0xDC,
+    0xBA, 0x76, 0x1F, 0xEB, 0xEA, 0x52, 0x8C, 0x4F, 0x12, 0x5C, 0x5F, 0xC3, 0x1D, 0x13, 0xBA, 0x54,
+    0x36, 0xAC, 0xEC, 0xF2, 0xE5, 0x69, 0x1B, 0x55, 0x53, 0x48, 0x1F, 0xA9, 0x3C, 0xDA, 0x35, 0x18,
+    0x55, 0x2B, 0xBF, 0x8E, 0x42, 0x89, 0x3F, 0xBE, 0xEF, 0x30, 0x7B, 0x5E, 0xF5, 0xE7, 0xB2, 0x83,
+    0xD1, 0xD7, 0x6C, 0x45, 0xE2, 0x2C, 0x0C, 0x1B, 0xE8, 0x1F, 0xA4, 0x1A, 0xA5, 0x23, 0xAD, 0xBE,
+    0xCE, 0xFF, 0x03, 0xC5, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x43, 0x3C, 0x09, 0x1B,
+    0x32, 0x14, 0x20, 0x21, 0x38, 0xBC, 0x4D, 0x8A, 0x44, 0x72, 0xBC, 0x29, 0x82, 0x74, 0x48, 0xE7,
+    0xDB, 0x45, 0x29, 0x5C, 0xE2, 0x22, 0xF9, 0x05, 0x94, 0x14, 0xA4, 0xB8, 0xC2, 0xC5, 0x91, 0x5B,
+    0xCB, 0x42, 0x29, 0x52, 0xC4, 0xFF, 0x20, 0x11, 0x65, 0x24, 0xC8, 0x15, 0x29, 0x2C, 0xE5, 0xF0,
+    0x4D, 0x2E, 0x05, 0x25, 0x23, 0xA5, 0xA0, 0x40, 0x42, 0x8B, 0xE2, 0x88, 0x22, 0x85, 0x27, 0x61,
+    0x11, 0x97, 0xF8, 0xEE, 0x86, 0xF7, 0xAD, 0x9D, 0x06, 0xA5, 0x80, 0x8A, 0x2D, 0xC6, 0xE7, 0xD9,
+    0x99, 0xEF, 0x7B, 0xDF, 0x7B, 0xEF, 0xFB, 0xF6, 0x83, 0x78, 0x62, 0x3B, 0x6D, 0xB5, 0x5D, 0xF4,
+    0x2E, 0x26, 0x2A, 0xF6, 0xD9, 0x1C, 0x91, 0xC5, 0x0A, 0x54, 0x89, 0x4B, 0xD0, 0x43, 0x7C, 0x08,
+    0x38, 0x00, 0x09, 0x62, 0xE7, 0xD1, 0x39, 0x03, 0x3D, 0x71, 0xD8, 0xED, 0xC0, 0x5C, 0xB6, 0x91,
+    0xDF, 0x6C, 0x77, 0x93, 0x1B, 0x9F, 0xBB, 0xBD, 0xC3, 0x99, 0x0A, 0xC1, 0x7E, 0x34, 0x9D, 0xA2,
+    0x65, 0x8A, 0x78, 0xE2, 0xD1, 0xCE, 0x01, 0x55, 0xE1, 0x24, 0x3E, 0xB3, 0xA7, 0xCF, 0xC5, 0x8F,
+    0x8A, 0xF6, 0xB5, 0xF5, 0xF5, 0xF3, 0x7E, 0x10, 0xE2, 0x79, 0xA5, 0x3E, 0xC6, 0x17, 0xF6, 0x54,
+    0x07, 0x38, 0x07, 0x18, 0x40, 0x97, 0x0C, 0x0C, 0x78, 0x80, 0x5B, 0x19, 0xB7, 0xBE, 0xD9, 0x60,
+    0xAC, 0x68, 0x1E, 0xDB, 0x11, 0x7A, 0x6B, 0x8C, 0x07, 0x93, 0x94, 0xEA, 0x91, 0x8B, 0xAA, 0x1A,
+    0xD3, 0x3E, 0xD6, 0x20, 0xC0, 0x70, 0xBF, 0xB9, 0x8B, 0x0A, 0x04, 0x0A, 0x65, 0x81, 0x4F, 0x17,
+    0x48, 0xC2, 0x0C, 0x8B, 0x75, 0x6B, 0xCA, 0x95, 0xD8, 0xC7, 0x76, 0x0D, 0x1D, 0x65, 0x55, 0x39,
+    0xC2, 0xA6, 0x29, 0x4D, 0x51, 0xC3, 0x67, 0xC8, 0x94, 0x57, 0xFE, 0x2C, 0xBE, 0xAA, 0x94, 0xCD,
+    0x83, 0xCD, 0x6F, 0x97, 0x06, 0xE3, 0x45, 0xD1, 0xC3, 0x61, 0x78, 0x56, 0xA4, 0xF7, 0xC2, 0x94,
+    0x79, 0x43, 0x71, 0xFD, 0x2A, 0x6B, 0x65, 0x40, 0xCC, 0xA4, 0x68, 0x26, 0xC0, 0xD8, 0x2D, 0x15,
+    0x7C, 0x55, 0x23, 0x0B, 0x01, 0x18, 0x04, 0xA2, 0x7D, 0x1F, 0xF2, 0xBC, 0x13, 0x2F, 0xD4, 0xCF,
+    0xEE, 0x4E, 0xB6, 0x7F, 0x5A, 0x1D, 0x84, 0x88, 0x04, 0xFC, 0xD9, 0x14, 0x61, 0x0A, 0xA8, 0xC5,
+    0xF7, 0x3C, 0x58, 0xC4, 0xA1, 0xD8, 0xC0, 0x60, 0x67, 0x35, 0x0E, 0x0B, 0xFD, 0x7B, 0x1D, 0xD9,
+    0xC1, 0x62, 0xA3, 0x1D, 0x1F, 0x86, 0x03, 0xBC, 0xE2, 0xE1, 0x71, 0x08, 0x55, 0xF7, 0x0A, 0x90,
+    0x16, 0x24, 0x81, 0x31, 0xA3, 0x39, 0x43, 0xE6, 0x2F, 0xBF, 0xB4, 0x09, 0x5F, 0x60, 0xCC, 0x7C,
+    0x4B, 0x61, 0xFF, 0xA8, 0xDA, 0x46, 0x80, 0x77, 0x9B, 0x9C, 0x2D, 0x3D, 0xD7, 0xBF, 0x94, 0x6E,
+    0xB0, 0xDF, 0x52, 0xF7, 0x42, 0xCC, 0x30, 0x4F, 0x81, 0x36, 0x83, 0xF0, 0xE0, 0xAB, 0xEF, 0x78,
+    0x8B, 0x97, 0x0A, 0x9C, 0xE2, 0x7F, 0x3C, 0x9B, 0x96, 0xDA, 0xC5, 0x9E, 0x85, 0x74, 0x99, 0x24,
+    0xB1, 0xCA, 0x63, 0x8A, 0xAF, 0xC9, 0xB1, 0xB1, 0xBA, 0x8A, 0xA7, 0x98, 0x63, 0x80, 0xCC, 0x36,
+    0x25, 0x1E, 0x3F, 0x67, 0x70, 0x51, 0xFE, 0xF8, 0x65, 0x59, 0x93, 0x20, 0x2C, 0x20, 0x73, 0x78,
+    0xE3, 0x93, 0xB8, 0xCC, 0xA7, 0x25, 0x72, 0xB5, 0x60, 0x5C, 0xE5, 0x73, 0x4B, 0xBE, 0xD2, 0xED,
+    0x59, 0x2E, 0xCC, 0xE5, 0x37, 0x79, 0x29, 0x79, 0xF2, 0xA2, 0x96, 0x8A, 0x06, 0xD7, 0xB9, 0x12,
+    0xA9, 0xD4, 0x61, 0x82, 0x97, 0xBB, 0x61, 0xD6, 0x44, 0x0E, 0x55, 0x93, 0x86, 0xA4, 0x82, 0xFC,
+    0xCA, 0x5E, 0x18, 0x8F, 0xB9, 0x97, 0x3F, 0x7B, 0xC9, 0x22, 0xD2, 0x69, 0xB8, 0x35, 0x83, 0x5E,
+    0x98, 0x7A, 0x50, 0xC5, 0x61, 0x12, 0x2E, 0x73, 0xEF, 0xF8, 0x19, 0x0A, 0x29, 0x49, 0x31, 0x94,
+    0xF0, 0x72, 0x2D, 0x5A, 0xBC, 0x01, 0xE0, 0x09, 0x5C, 0x8D, 0x0A, 0x4C, 0x8D, 0xEB, 0x43, 0x3F,
+    0x9C, 0x91, 0xA0, 0x6E, 0x76, 0xC3, 0x22, 0x7E, 0xF1, 0x9C, 0x10, 0xCC, 0xA0, 0x2F, 0xD9, 0x24,
+    0xB3, 0x16, 0x3D, 0x31, 0x98, 0x36, 0x80, 0xAC, 0x40, 0xE4, 0xAE, 0x3A, 0x3C, 0xAC, 0x19, 0x75,
+    0x90, 0x5B, 0x8C, 0x6F, 0x3D, 0x0F, 0xC8, 0x7F, 0x0B, 0x86, 0xC5, 0xBC, 0x85, 0x0D, 0xF4, 0x4C,
+    0x29, 0xD6, 0x34, 0xF4, 0xC8, 0x66, 0x1F, 0xEA, 0xB1, 0x85, 0xA1, 0x27, 0x1F, 0x38, 0x6A, 0x2E,
+    0x97, 0x4B, 0x8C, 0x52, 0xA7, 0x2A, 0x63, 0x53, 0x1A, 0x74, 0x44, 0x0F, 0x56, 0xF0, 0x42, 0x3E,
+    0xC4, 0xB9, 0xDA, 0x93, 0x08, 0x9E, 0x22, 0x82, 0xB3, 0xCC, 0x57, 0x14, 0xAD, 0x8E, 0xBA, 0x89,
+    0x4F, 0xAC, 0xEE, 0x51, 0x0C, 0xB3, 0x1F, 0x4F, 0xAA, 0x4E, 0xA2, 0x8B, 0x6B, 0xC3, 0x04, 0x51,
+    0x15, 0x8D, 0xB0, 0xDA, 0xD4, 0xA1, 0xC3, 0xBC, 0xB1, 0xB6, 0xA1, 0x97, 0x53, 0x2A, 0x98, 0xA1,
+    0x46, 0x37, 0xF2, 0xE8, 0x33, 0xF4, 0x48, 0x39, 0xD4, 0x9A, 0x8D, 0x98, 0xD8, 0xB8, 0x32, 0xA5,
+    0x72, 0x92, 0x2A, 0xDB, 0x19, 0x94, 0xB9, 0xDF, 0xC3, 0x80, 0x85, 0x19, 0x26, 0x16, 0x49, 0x44,
+    0x03, 0x7A, 0xED, 0xC4, 0x15, 0xE4, 0x73, 0xB4, 0x57, 0xD0, 0x6B, 0x63, 0x78, 0x09, 0xD5, 0x30,
+    0x72, 0x6C, 0x95, 0x4A, 0x6D, 0xB9, 0x44, 0xD5, 0x5D, 0x0A, 0xC9, 0x56, 0xD4, 0xF6, 0x88, 0x3D,
+    0xBC, 0x27, 0x4E, 0xEE, 0x8B, 0xB5, 0x46, 0xD2, 0x98, 0x53, 0xDA, 0x28, 0xAA, 0x69, 0x20, 0x5A,
+    0x6A, 0x44, 0xC5, 0xE9, 0xAB, 0x66, 0x69, 0xBC, 0x64, 0x9C, 0x34, 0x8F, 0x6D, 0x16, 0xCD, 0xA5,
+    0x4C, 0xA4, 0x97, 0x8C, 0xA3, 0xC5, 0x52, 0x72, 0x48, 0x9F, 0x21, 0x94, 0x79, 0x19, 0x35, 0x1A,
+    0x8E, 0x45, 0x32, 0xE1, 0x3E, 0x17, 0xCB, 0x8F, 0x85, 0xFA, 0xA3, 0x86, 0x42, 0x0F, 0x55, 0x87,
+    0x0C, 0x63, 0x45, 0x97, 0x26, 0x76, 0xDA, 0xFA, 0xB8, 0xEA, 0xDE, 0xAD, 0xB3, 0x30, 0xA3, 0x2A,
+    0xCA, 0x9A, 0x2D, 0xAF, 0xAA, 0x51, 0x44, 0xC5, 0x89, 0x64, 0x5C, 0x60, 0x5C, 0xE0, 0xDF, 0x43,
+    0xAD, 0xFE, 0x03, 0xD4, 0x05, 0x08, 0x55, 0xB0, 0x71, 0x8F, 0x4F, 0xF3, 0x4B, 0x7C, 0x16, 0x8B,
+    0xA1, 0xB5, 0x6F, 0xDC, 0xFF, 0x1A, 0xEF, 0x8A, 0xE0, 0xBD, 0xD0, 0xE0, 0x55, 0xFF, 0xC0, 0x9B,
+    0x10, 0xAF, 0x1B, 0x51, 0x2A, 0xD1, 0x3E, 0x15, 0xC7, 0x0A, 0xB9, 0xA7, 0xF0, 0xB6, 0xB6, 0x6A,
+    0x52, 0x45, 0xDE, 0xCB, 0x1C, 0x5D, 0x3B, 0x03, 0xA3, 0x8B, 0xE4, 0xA1, 0xD3, 0xAE, 0x7B, 0xCF,
+    0xEB, 0x05, 0xF3, 0xAC, 0x1E, 0xCD, 0x10, 0x0B, 0xB9, 0x7A, 0xBF, 0x99, 0x29, 0x72, 0xBB, 0x99,
+    0x05, 0x27, 0xA3, 0x75, 0x7C, 0x5B, 0x5E, 0x72, 0xAD, 0x8B, 0xA6, 0x95, 0x6C, 0x1F, 0xB8, 0xBD,
+    0x21, 0x5F, 0xAF, 0xF2, 0xBC, 0x42, 0xDC, 0x08, 0xB7, 0x74, 0x07, 0xF1, 0x1D, 0xE4, 0x0E, 0xF4,
+    0x2E, 0x27, 0xD0, 0x82, 0x1D, 0x04, 0x43, 0xD7, 0x4C, 0x41, 0xA3, 0x07, 0x9F, 0x04, 0xE8, 0x03,
+    0x9B, 0x93, 0xA6, 0x81, 0xFA, 0x8B, 0x03, 0x61, 0x9E, 0xDE, 0x2E, 0xF5, 0xE3, 0x7A, 0xF6, 0x03,
+    0x32, 0x73, 0xF0, 0x98, 0x4C, 0xE5, 0x8B, 0xD4, 0x6A, 0x3F, 0xF6, 0x01, 0xD9, 0x56, 0xB8, 0xCC,
+    0x29, 0xA1, 0x67, 0xA9, 0xD3, 0xDE, 0xD8, 0x50, 0x64, 0xF6, 0xBC, 0x9A, 0x81, 0xC2, 0xA5, 0x4D,
+    0x17, 0x37, 0x44, 0x20, 0x2F, 0x5E, 0xB3, 0x73, 0x4C, 0x8A, 0xD8, 0xED, 0x88, 0x29, 0x02, 0x66,
+    0x2B, 0xA4, 0x65, 0x56, 0x84, 0x68, 0xA6, 0x66, 0xC6, 0x2F, 0xFB, 0x07, 0xF6, 0x8F, 0x1F, 0x7F,
+    0x55, 0x3F, 0xF5, 0xEB, 0xE5, 0xFC, 0x89, 0xBD, 0x1F, 0x32, 0x35, 0xA9, 0x67, 0xA9, 0xDE, 0xAE,
+    0x88, 0xA7, 0x68, 0xAA, 0xC4, 0xEE, 0xD1, 0x3C, 0xBF, 0x80, 0x68, 0xE7, 0x82, 0xB2, 0x1D, 0x6D,
+    0x77, 0x4D, 0xE1, 0xD3, 0xB8, 0x5A, 0x53, 0xB6, 0x9F, 0x94, 0xF5, 0xEB, 0xEE, 0x56, 0x68, 0x09,
+    0x1F, 0x3D, 0x19, 0x1D, 0x32, 0x46, 0xF6, 0xDE, 0x30, 0x01, 0xC4, 0x58, 0xB1, 0x20, 0x53, 0xB2,
+    0x98, 0x91, 0x8C, 0x44, 0x72, 0x89, 0xCE, 0x9A, 0xE4, 0xE1, 0x12, 0x79, 0xF9, 0x9C, 0xB8, 0xAE,
+    0x4C, 0xFC, 0xAE, 0xA4, 0xCF, 0xC4, 0x5A, 0x5C, 0xC6, 0x77, 0xC7, 0x32, 0x1E, 0x02, 0x9A, 0x4F,
+    0x02, 0xA7, 0x73, 0x56, 0xB0, 0x93, 0xB2, 0x92, 0xC5, 0x66, 0xE5, 0x31, 0x80, 0xE2, 0x34, 0x23,
+    0xC9, 0xD7, 0x4B, 0xF2, 0x27, 0xF5, 0x3F, 0x72, 0x2F, 0x4D, 0x77, 0xF8, 0x86, 0xCE, 0xD9, 0x65,
+    0xEF, 0x2F, 0x53, 0x23, 0x65, 0xA9, 0x7D, 0x0F, 0x9B, 0xD4, 0xD1, 0x94, 0xF0, 0x24, 0xC8, 0x6C,
+    0x05, 0x49, 0xE2, 0xD9, 0xE1, 0x07, 0x4C, 0xFE, 0xB4, 0xC2, 0xFF, 0xF3, 0xFC, 0x0D, 0xB5, 0x55,
+    0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xBB, 0xC3, 0x65, 0x8B, 0x91, 0x35, 0x29, 0x62, 0x90, 0x48,
+    0xF0, 0x36, 0x94, 0xF8, 0xB6, 0xA1, 0x48, 0x71, 0xB9, 0x59, 0x13, 0x89, 0x16, 0x17, 0xA6, 0x01,
+    0x09, 0x5A, 0x64, 0x8A, 0x34, 0x29, 0x0C, 0xB2, 0xEF, 0x96, 0x50, 0xA4, 0xA0, 0x88, 0x0B, 0x3A,
+    0x5A, 0x0A, 0x62, 0x24, 0x92, 0xC2, 0x42, 0x29, 0x6C, 0xDF, 0xC4, 0x2D, 0x05, 0x2B, 0x51, 0x50,
+    0x50, 0xB0, 0x90, 0xA4, 0x08, 0x14, 0x1E, 0xA2, 0x8D, 0x58, 0xC7, 0xEB, 0x1B, 0xDE, 0xDF, 0x8B,
+    0xC1, 0x41, 0xA1, 0xE4, 0x24, 0xCF, 0x78, 0x67, 0xFE, 0xFC, 0x79, 0xFF, 0xFD, 0xF7, 0xFF, 0x00,
+    0xAA, 0x5C, 0x07, 0xB4, 0x6B, 0x01, 0x73, 0xB7, 0x01, 0x7A, 0x4B, 0x2B, 0x38, 0xFD, 0xE3, 0x12,
+    0x62, 0x6E, 0x42, 0xC9, 0x60, 0x76, 0x38, 0xA4, 0x03, 0x0E, 0x83, 0x4B, 0x1C, 0xEE, 0x70, 0x88,
+    0x3C, 0x07, 0x55, 0x0E, 0xC5, 0x09, 0x87, 0x14, 0x19, 0x30, 0x94, 0x61, 0xB2, 0x35, 0x01, 0x42,
+    0x08, 0x50, 0x1C, 0xF2, 0xA4, 0x44, 0x96, 0x1B, 0x87, 0xAC, 0xB0, 0x39, 0x07, 0x20, 0x53, 0x15,
+    0x54, 0xB5, 0x01, 0x8C, 0x4C, 0x89, 0x5E, 0x7E, 0xEA, 0xD6, 0x33, 0xCD, 0x26, 0xE2, 0x70, 0x4C,
+    0xF7, 0xDA, 0x61, 0x01, 0x03, 0x28, 0x97, 0x38, 0x5C, 0xC5, 0x1A, 0x34, 0x4C, 0x01, 0x1F, 0xD7,
+    0x30, 0x9F, 0x04, 0xF1, 0xED, 0x91, 0x84, 0x03, 0xDE, 0xF9, 0xA0, 0x9A, 0x9D, 0xEC, 0x89, 0x17,
+    0x1D, 0x82, 0x40, 0x4D, 0x43, 0x10, 0xEC, 0xB6, 0xE9, 0x76, 0xFE, 0xAC, 0x65, 0x54, 0x3F, 0x78,
+    0x99, 0xF4, 0xF5, 0xCE, 0x3E, 0x4D, 0x1E, 0x7C, 0xC0, 0x69, 0x3D, 0xE9, 0xEC, 0xBD, 0x16, 0x7B,
+    0x55, 0x12, 0x23, 0x2D, 0x8A, 0x6E, 0xCA, 0xB6, 0x26, 0x32, 0x8D, 0x43, 0x90, 0x89, 0x61, 0xFC,
+    0xF6, 0x15, 0x94, 0xE7, 0xF7, 0x31, 0xB8, 0x3F, 0xE1, 0x94, 0xE5, 0x5C, 0x3E, 0x3E, 0x4D, 0xD8,
+    0x39, 0xE0, 0xFC, 0xAF, 0xE6, 0x98, 0x11, 0x84, 0xFA, 0x02, 0xFA, 0xF1, 0x14, 0x17, 0xA3, 0x4A,
+    0x55, 0x2F, 0x56, 0x46, 0x20, 0x15, 0x57, 0x31, 0xDE, 0x5A, 0x89, 0x1D, 0x83, 0x87, 0xE9, 0x78,
+    0x18, 0x26, 0x21, 0x7F, 0x41, 0x7C, 0x1F, 0xF9, 0x28, 0x1C, 0xF1, 0xA6, 0x68, 0xFA, 0xDE, 0x95,
+    0x19, 0x68, 0x5C, 0xC0, 0x6D, 0xAC, 0x25, 0xBC, 0x82, 0xE8, 0xF7, 0x9E, 0x49, 0xCB, 0x38, 0xF8,
+    0xF8, 0xC9, 0x56, 0x61, 0x24, 0x13, 0x4C, 0x90, 0x78, 0xCB, 0x19, 0x6C, 0xF0, 0x11, 0x57, 0x75,
+    0xDE, 0xAD, 0x82, 0xC1, 0x26, 0xC2, 0x34, 0xE3, 0x23, 0x57, 0x4C, 0x43, 0x31, 0x3B, 0x7C, 0x11,
+    0x0E, 0x7E, 0x01, 0x11, 0xF9, 0x8B, 0x9E, 0xC1, 0x0E, 0xF0, 0xE4, 0xD8, 0x43, 0x6F, 0xDE, 0xC6,
+    0x36, 0xCA, 0xA4, 0x78, 0x37, 0xB7, 0x61, 0x1A, 0x4D, 0x6F, 0x2E, 0x8B, 0x4B, 0xC9, 0xF8, 0x2E,
+    0xCE, 0x46, 0xC4, 0x18, 0x87, 0x29, 0xA2, 0xC9, 0x26, 0x8D, 0xEF, 0xD3, 0x7D, 0x45, 0xD7, 0x5C,
+    0x6F, 0x84, 0x37, 0x60, 0xAD, 0xB7, 0x3A, 0x61, 0xF0, 0xBE, 0xBF, 0xBC, 0x18, 0xB9, 0x24, 0x9F,
+    0x4B, 0x2A, 0x58, 0xE2, 0x5F, 0xE6, 0xE9, 0x55, 0x86, 0x32, 0x25, 0xF6, 0xF2, 0xDC, 0x99, 0x56,
+    0xA4, 0xC2, 0xCC, 0xA2, 0xE7, 0x49, 0x94, 0x7D, 0xB8, 0x3E, 0x87, 0x45, 0x95, 0xF7, 0xF1, 0xD1,
+    0x2E, 0x92, 0xE6, 0x84, 0xCA, 0x1E, 0xE9, 0x51, 0x25, 0xD2, 0x6B, 0x1E, 0xA6, 0x6C, 0xF1, 0xDC,
+    0x5F, 0x7A, 0x28, 0x11, 0x56, 0x30, 0x8C, 0x32, 0x42, 0x5A, 0xCC, 0xD8, 0xA0, 0x58, 0xE6, 0xB7,
+    0x5A, 0x6E, 0x04, 0xE8, 0xCF, 0x75, 0x2E, 0x40, 0xF0, 0x3A, 0x37, 0x55, 0xC8, 0xBB, 0x14, 0x01,
+    0x2F, 0x6F, 0xF2, 0x48, 0xC5, 0x60, 0xF2, 0x0E, 0x0C, 0x15, 0x26, 0x9C, 0xBD, 0xE4, 0x88, 0xC6,
+    0x3C, 0x79, 0x1F, 0x65, 0x5C, 0xCE, 0xE1, 0x0E, 0x0E, 0x27, 0x5D, 0x7C, 0x7E, 0x03, 0x7B, 0x94,
+    0xA9, 0xD4, 0x83, 0xF0, 0x8C, 0xF4, 0x0D, 0x11, 0x52, 0x5C, 0x5B, 0x59, 0x9A, 0x8F, 0x96, 0xFF,
+    0x85, 0x49, 0x97, 0x99, 0xE7, 0x65, 0x56, 0x4D, 0xA9, 0x16, 0xE5, 0xAD, 0x54, 0x57, 0xFA, 0x69,
+    0x2B, 0xD6, 0xAD, 0xFD, 0x8C, 0x7E, 0xF4, 0xBD, 0x47, 0x22, 0x48, 0x3B, 0x1E, 0x89, 0x9B, 0x59,
+    0x62, 0x4C, 0xE8, 0xC4, 0xD9, 0x89, 0xB1, 0x8B, 0xA8, 0x93, 0xB2, 0xA8, 0x76, 0x26, 0xE8, 0x30,
+    0x99, 0x70, 0xCD, 0xFE, 0x7E, 0xC8, 0x10, 0xD2, 0x26, 0xDC, 0x68, 0x91, 0x4C, 0x4D, 0x3D, 0xAE,
+    0xE2, 0xB0, 0x1F, 0x2E, 0x4B, 0x58, 0x89, 0x13, 0xE2, 0x5A, 0x96, 0x08, 0x19, 0xA3, 0xFB, 0x68,
+    0x65, 0xFE, 0x39, 0x7C, 0x35, 0xA6, 0x5A, 0x47, 0x72, 0xB7, 0x25, 0xFB, 0x97, 0xB2, 0xEB, 0x0E,
+    0xF1, 0xA3, 0xC7, 0xB4, 0x4D, 0x2D, 0x2B, 0x11, 0x47, 0x07, 0xB9, 0x5C, 0x2A, 0x81, 0x8E, 0x9B,
+    0x0E, 0x85, 0x7B, 0x0A, 0x42, 0x1D, 0x1D, 0xD5, 0x88, 0xA6, 0x63, 0x4B, 0xD9, 0xDF, 0xF8, 0x23,
+    0xC0, 0xFE, 0x12, 0x0C, 0x8F, 0xF5, 0x98, 0xD6, 0x4B, 0xDA, 0xC5, 0xDE, 0xC2, 0xEC, 0x9F, 0xA4,
+    0x0D, 0xD1, 0x37, 0x39, 0xA5, 0xE8, 0xB0, 0x2C, 0x72, 0x58, 0x90, 0x3E, 0xD1, 0xF1, 0xBB, 0xDA,
+    0x32, 0x94, 0x42, 0xFA, 0x04, 0xFF, 0xB8, 0xBA, 0x28, 0xCD, 0x23, 0x66, 0x11, 0xA4, 0x07, 0x2D,
+    0x8B, 0x89, 0x9E, 0xEB, 0x13, 0xFE, 0x8A, 0x1A, 0x43, 0xBA, 0x25, 0xBF, 0xA7, 0x3A, 0x83, 0xE6,
+    0xF6, 0xD9, 0x57, 0xF9, 0x0F, 0x75, 0x97, 0x90, 0x2F, 0xB2, 0x11, 0x13, 0xAA, 0xA2, 0xCB, 0x39,
+    0x60, 0x89, 0xB2, 0x25, 0x0B, 0xD9, 0x7D, 0x1A, 0x6C, 0xDD, 0x8C, 0x04, 0x34, 0xAF, 0xDE, 0x01,
+    0xE5, 0xC7, 0x22, 0x25, 0xCF, 0x57, 0xCA, 0xAE, 0x22, 0xA8, 0x79, 0xDF, 0x53, 0x55, 0x76, 0x50,
+    0x66, 0xA1, 0x48, 0x0E, 0x67, 0xC6, 0x53, 0xA0, 0x2F, 0x30, 0x67, 0xC6, 0x2C, 0xB5, 0x5B, 0x25,
+    0xCD, 0x9E, 0x1A, 0x27, 0x95, 0xBD, 0xE5, 0x2C, 0x5B, 0xD8, 0xA1, 0x24, 0x7B, 0xB5, 0x80, 0x88,
+    0xA6, 0x43, 0x14, 0x6F, 0x8A, 0x16, 0xF2, 0xA8, 0xE5, 0x3D, 0x86, 0x2A, 0x41, 0xC8, 0x4D, 0x61,
+    0xE4, 0x6B, 0xE2, 0x95, 0x4F, 0x0E, 0xF8, 0x35, 0xDA, 0xC1, 0x86, 0xBA, 0xE7, 0xC9, 0x50, 0x5A,
+    0x98, 0x7D, 0xBF, 0x8B, 0x51, 0x76, 0xD9, 0xC7, 0x8F, 0xEB, 0xD4, 0x99, 0x9F, 0x8B, 0x29, 0x6C,
+    0xAB, 0xEA, 0x28, 0xB8, 0xD4, 0x69, 0xD6, 0x28, 0x6C, 0xA9, 0xA4, 0x05, 0xBF, 0xF3, 0xA5, 0xD4,
+    0xC8, 0xA9, 0x9C, 0x25, 0xEC, 0x9C, 0xAF, 0x61, 0xCA, 0x1E, 0xB5, 0x9D, 0x14, 0xDF, 0xBA, 0x45,
+    0xFD, 0x16, 0xFC, 0xF6, 0x45, 0xF5, 0xDD, 0xB5, 0x72, 0xE1, 0x8E, 0xC1, 0xA4, 0x18, 0xA8, 0x26,
+    0xAE, 0x8C, 0x13, 0x69, 0x0E, 0x59, 0x52, 0x51, 0xCD, 0xF6, 0xDB, 0x15, 0x8C, 0x48, 0xB3, 0x27,
+    0x1E, 0x36, 0x18, 0x5A, 0xEC, 0x61, 0xD9, 0xD7, 0xD4, 0xB1, 0xF4, 0x67, 0x1F, 0xD5, 0x71, 0x70,
+    0xC6, 0xA5, 0x7B, 0xFC, 0x7A, 0x52, 0x47, 0xB5, 0xF9, 0xDE, 0xF1, 0x15, 0x18, 0xC1, 0xEA, 0xFD,
+    0x1A, 0xCD, 0xAE, 0x71, 0xFA, 0xC7, 0x6A, 0x0C, 0x3B, 0x22, 0xA2, 0xE0, 0x4D, 0x99, 0x04, 0x8C,
+    0x79, 0x8A, 0xAF, 0x00, 0x63, 0xAC, 0xFE, 0x2B, 0x45, 0xAF, 0xC0, 0xE2, 0xB6, 0x6A, 0x94, 0xEB,
+    0x97, 0x0B, 0xF1, 0x4F, 0xD8, 0x5E, 0x1C, 0xA8, 0xFD, 0xB2, 0x32, 0x7D, 0x9D, 0x7F, 0x5C, 0x0D,
+    0xD8, 0x0A, 0xBD, 0xA9, 0x74, 0x61, 0xBB, 0x4E, 0x62, 0x98, 0xB0, 0xD9, 0xBB, 0xA3, 0xBC, 0x54,
+    0xC1, 0xCA, 0x7C, 0x7E, 0x5A, 0xA6, 0xB1, 0x14, 0x80, 0x16, 0xA2, 0xCD, 0x7D, 0xED, 0x25, 0xD9,
+    0xEC, 0xB9, 0x6C, 0x05, 0x45, 0x22, 0xCF, 0x06, 0xA9, 0xE6, 0xCB, 0x54, 0x4B, 0x4F, 0xDA, 0x91,
+    0xD6, 0xD7, 0xBD, 0x3E, 0x14, 0x3E, 0x77, 0x2A, 0x96, 0x25, 0x5A, 0x79, 0xB3, 0xEC, 0xC3, 0x0F,
+    0x79, 0x26, 0x30, 0xB9, 0xB1, 0x3C, 0x43, 0x94, 0x24, 0xD3, 0x1C, 0x4D, 0x9A, 0x7F, 0x5A, 0x47,
+    0x4C, 0x47, 0x43, 0x8C, 0x74, 0xD9, 0x5B, 0xFE, 0x3B, 0x84, 0xAC, 0x42, 0xFA, 0x85, 0x53, 0xE5,
+    0x02, 0xDD, 0x7B, 0x03, 0x43, 0x89, 0x55, 0x03, 0xF6, 0x26, 0xBE, 0x41, 0xC3, 0x37, 0x1B, 0x7A,
+    0x62, 0x1B, 0x77, 0x9D, 0x98, 0x3A, 0xA9, 0xB3, 0x09, 0x26, 0xF4, 0x9B, 0x1C, 0x5E, 0x29, 0x89,
+    0xAC, 0xE5, 0xF5, 0x19, 0x79, 0xD6, 0xEE, 0xF8, 0xED, 0xAF, 0x3D, 0xDF, 0x8D, 0x86, 0x99, 0xD8,
+    0xA0, 0xE0, 0x6D, 0xDC, 0x60, 0x9C, 0x73, 0xA1, 0x30, 0xD2, 0xE2, 0xA5, 0xE2, 0xF5, 0xF4, 0xE9,
+    0x8D, 0xE7, 0x1B, 0x06, 0x4A, 0xE0, 0x86, 0x02, 0x5C, 0x33, 0xD0, 0x4B, 0x6C, 0x41, 0x7D, 0xB9,
+    0x38, 0xAE, 0x32, 0xEC, 0x88, 0xD8, 0xD8, 0xA8, 0x04, 0xD7, 0xFF, 0xF0, 0xFB, 0x0B, 0xAD, 0x55,
+    0x3D, 0x73, 0x1C, 0x45, 0x10, 0x7D, 0xB3, 0x83, 0xB4, 0x46, 0x83, 0x35, 0x04, 0x22, 0xC2, 0xB0,
+    0x84, 0x14, 0x48, 0x5A, 0x07, 0x0E, 0x14, 0xDC, 0x69, 0xC7, 0x50, 0x14, 0x01, 0x01, 0x17, 0x20,
+    0x08, 0xF8, 0x07, 0x10, 0x98, 0x40, 0x01, 0x81, 0x3E, 0x36, 0x23, 0x20, 0x90, 0x7E, 0x82, 0x03,
+    0x02, 0x70, 0x51, 0x85, 0x03, 0x02, 0x15, 0x25, 0xE9, 0xC6, 0x76, 0x48, 0xB2, 0x05, 0x01, 0x01,
+    0x01, 0xAB, 0x2A, 0x48, 0x48, 0x18, 0xA8, 0xA5, 0xD8, 0xA2, 0xEE, 0x6E, 0x78, 0xBD, 0x77, 0x42,
+    0x92, 0x65, 0xE3, 0x84, 0xBD, 0xBB, 0xB9, 0xD9, 0xD9, 0x9E, 0xD7, 0xAF, 0xBB, 0x5F, 0xCF, 0x02,
+    0x4B, 0xCA, 0x21, 0xD7, 0x35, 0xEC, 0xBD, 0x06, 0xA6, 0x1E, 0xE3, 0xD1, 0xD7, 0xAD, 0x9F, 0xA1,
+    0x62, 0x2C, 0xD5, 0xE4, 0xFD, 0x46, 0xB5, 0x28, 0xD0, 0xC2, 0xF8, 0x43, 0x24, 0xA1, 0xD8, 0xF8,
+    0x60, 0x94, 0xC5, 0x38, 0x31, 0x1E, 0xD9, 0x6B, 0x01, 0xD6, 0x1F, 0x23, 0xAB, 0xB8, 0x50, 0xEB,
+    0x18, 0x03, 0x76, 0x63, 0x8D, 0x24, 0x96, 0x33, 0x8C, 0x39, 0x0C, 0xD0, 0x4F, 0x7D, 0xD2, 0x14,
+    0x74, 0x36, 0x7A, 0xD8, 0xC3, 0xF3, 0x2D, 0x4D, 0x5B, 0xAC, 0x23, 0x24, 0xB5, 0xAA, 0x2D, 0x8C,
+    0xDB, 0x8D, 0xE3, 0xA4, 0x46, 0x30, 0xCE, 0x94, 0x39, 0x0E, 0x09, 0x56, 0x21, 0x4E, 0x80, 0xA1,
+    0xE0, 0x35, 0x19, 0xC8, 0x3A, 0x40, 0x87, 0x1D, 0xE0, 0xB9, 0xB9, 0xC1, 0x39, 0xA0, 0x61, 0x05,
+    0x1C, 0x0F, 0x3D, 0xFA, 0xD8, 0x86, 0x75, 0x49, 0x48, 0x2A, 0x64, 0xB2, 0x1E, 0xF8, 0xE3, 0x64,
+    0x97, 0xBC, 0x8C, 0xE0, 0x40, 0xD3, 0x10, 0x5B, 0xC9, 0x01, 0xF2, 0xB2, 0x20, 0x5B, 0x32, 0x1E,
+    0x83, 0xD4, 0x1D, 0x6E, 0x4D, 0xDC, 0x0C, 0x8B, 0x6E, 0xB6, 0xAD, 0x2F, 0xD2, 0x30, 0x77, 0xF3,
+    0x9D, 0xD9, 0x52, 0x3E, 0xC6, 0x0A, 0x69, 0xA1, 0x07, 0x52, 0x54, 0xEF, 0x55, 0x09, 0xF1, 0xB0,
+    0x05, 0x6C, 0x9B, 0x8D, 0x89, 0x26, 0x42, 0xDE, 0x4E, 0xED, 0xD4, 0xBB, 0x9F, 0xC3, 0xC6, 0x8B,
+    0x61, 0x7E, 0x4C, 0x52, 0x3D, 0x1A, 0xF7, 0xD1, 0x60, 0x55, 0x05, 0x64, 0xA4, 0x60, 0xDF, 0xF2,
+    0xB0, 0x7B, 0x8E, 0xB6, 0x04, 0x64, 0xFA, 0x53, 0x6E, 0xD1, 0x0D, 0x7F, 0x84, 0xB5, 0x64, 0xB8,
+    0x5B, 0xE2, 0x55, 0xB2, 0x2D, 0x9A, 0x6E, 0x3A, 0xBD, 0x12, 0xF2, 0x9F, 0xBF, 0xB3, 0x71, 0xA9,
+    0x4A, 0x81, 0xE8, 0x5F, 0xF3, 0xB3, 0x25, 0x33, 0x62, 0x33, 0xDB, 0x58, 0xB5, 0x25, 0x72, 0xC6,
+    0x9D, 0x31, 0x51, 0x96, 0xD8, 0x96, 0xFC, 0x0C, 0xB1, 0x0D, 0x63, 0xB0, 0x9E, 0xF1, 0x94, 0xAC,
+    0x2C, 0xB1, 0xF9, 0x68, 0xC8, 0xA5, 0x2F, 0x04, 0x47, 0xB3, 0xB6, 0xC6, 0xB7, 0xB0, 0xF7, 0x5B,
+    0xCC, 0xDD, 0x1C, 0x9C, 0xE3, 0xBF, 0x42, 0x0F, 0xF2, 0x39, 0xE3, 0x9F, 0x99, 0x19, 0xFF, 0xDF,
+    0xFE, 0x9B, 0x7F, 0x7B, 0xCA, 0x7F, 0xB0, 0x44, 0xDD, 0xF4, 0xA1, 0xEB, 0xA3, 0x47, 0xEA, 0xED,
+    0xFF, 0x8A, 0x41, 0x39, 0x0A, 0xBB, 0xE9, 0x92, 0x9D, 0x63, 0xC1, 0xCD, 0x97, 0x17, 0xDD, 0xA4,
+    0x25, 0x75, 0x21, 0xB5, 0xD0, 0x95, 0x75, 0x5D, 0x30, 0x8A, 0xA4, 0x60, 0x19, 0x0D, 0x5A, 0xD2,
+    0x97, 0x72, 0x74, 0x52, 0x92, 0x78, 0x50, 0xB8, 0x69, 0x40, 0x10, 0xBE, 0x0C, 0x23, 0x11, 0x37,
+    0x12, 0x52, 0xDA, 0x55, 0x3B, 0xA9, 0xB8, 0x7F, 0x9D, 0xEA, 0xD2, 0x41, 0x35, 0x78, 0xDC, 0x25,
+    0x91, 0x25, 0x15, 0xDD, 0xA6, 0xDE, 0xD2, 0x01, 0xC9, 0x75, 0xC1, 0xE1, 0x60, 0x9D, 0x08, 0xBF,
+    0x13, 0x3D, 0xFD, 0xA9, 0x9C, 0xC6, 0x87, 0xA2, 0x16, 0xEF, 0x82, 0x2C, 0xF8, 0x12, 0x22, 0x8E,
+    0x45, 0xBE, 0x34, 0xCA, 0x3A, 0x62, 0x7C, 0x9E, 0x7C, 0x36, 0xED, 0x2A, 0xE5, 0x74, 0xDD, 0xC7,
+    0x8E, 0xF1, 0xB6, 0x3A, 0xAF, 0xB6, 0x4D, 0xAC, 0x19, 0xA4, 0x2E, 0x20, 0x2C, 0xC2, 0xAA, 0x4A,
+    0xD5, 0x3D, 0xF4, 0xB5, 0x4F, 0x7D, 0x4F, 0x8D, 0xF4, 0x2F, 0xC3, 0x32, 0x8F, 0x0D, 0x86, 0x7B,
+    0x4C, 0x13, 0x21, 0x57, 0xA7, 0xBD, 0xB0, 0x4D, 0x62, 0x07, 0x85, 0x3E, 0x19, 0xE5, 0x6F, 0x0C,
+    0xA6, 0x6A, 0x57, 0xEE, 0xA5, 0xAB, 0xCA, 0x5F, 0x37, 0xCA, 0xAF, 0x2D, 0xA8, 0x6A, 0xCD, 0xE2,
+    0x9B, 0x11, 0xC6, 0x35, 0x51, 0xB1, 0xDC, 0xF5, 0x53, 0x11, 0x47, 0xEA, 0xEF, 0x3B, 0xFB, 0x86,
+    0xB4, 0xFB, 0x53, 0x28, 0x49, 0xDF, 0xBA, 0x34, 0x0E, 0xA3, 0x91, 0xC2, 0x70, 0x4A, 0x52, 0x29,
+    0xE9, 0xE6, 0xAE, 0x9B, 0x6A, 0xE1, 0x78, 0x9B, 0xFF, 0xBC, 0xBD, 0x32, 0x2B, 0x45, 0xAC, 0xD8,
+    0x4C, 0x67, 0xB0, 0x69, 0x49, 0x99, 0xF1, 0x9F, 0x9C, 0x12, 0x37, 0x35, 0xEA, 0xF2, 0x94, 0xBD,
+    0x2E, 0x92, 0x92, 0x93, 0x43, 0x0D, 0x2E, 0x6B, 0x1F, 0x4E, 0x22, 0x08, 0xE2, 0x73, 0x4D, 0x52,
+    0xF6, 0x02, 0x7D, 0xD4, 0x86, 0xB6, 0x8D, 0xE6, 0xDE, 0x43, 0xF5, 0xA7, 0x23, 0xB1, 0xE1, 0x04,
+    0x99, 0xEB, 0xA9, 0x9A, 0xC9, 0xC2, 0xB2, 0x0E, 0x69, 0x69, 0xD0, 0x26, 0x95, 0xF6, 0x47, 0x08,
+    0x69, 0x5D, 0x60, 0xFD, 0xAB, 0x90, 0x79, 0x66, 0xC6, 0x04, 0xCB, 0x13, 0x6C, 0xD6, 0xC8, 0xCC,
+    0xC2, 0x12, 0x35, 0x41, 0xF9, 0xF1, 0x28, 0x40, 0xF1, 0x66, 0xB8, 0xE0, 0x75, 0x0E, 0x58, 0x22,
+    0x39, 0xCB, 0x23, 0x41, 0x97, 0x0D, 0x94, 0x84, 0x72, 0x37, 0x8B, 0x65, 0xCF, 0x94, 0xBD, 0x17,
+    0x75, 0x95, 0x1A, 0x17, 0x92, 0x07, 0xBE, 0x97, 0xD6, 0x21, 0x8B, 0xE1, 0xC0, 0xC4, 0x7A, 0x65,
+    0xD6, 0xC2, 0x0E, 0x73, 0x4E, 0x82, 0xA5, 0xBA, 0x65, 0x48, 0x7D, 0xCA, 0x12, 0xB4, 0x32, 0xE4,
+    0x32, 0xA4, 0x3F, 0x88, 0x04, 0xA2, 0x0C, 0xB9, 0x0C, 0x22, 0x77, 0x18, 0x49, 0x9E, 0x91, 0x03,
+    0xD5, 0xFC, 0x25, 0xC9, 0x0E, 0x13, 0x19, 0x72, 0xCF, 0x81, 0x2D, 0x67, 0x1A, 0xC4, 0x67, 0x39,
+    0xE4, 0xE3, 0x2E, 0xA9, 0x22, 0x9A, 0x28, 0x47, 0xDC, 0xBC, 0x3B, 0xCB, 0x91, 0xC1, 0x35, 0x6C,
+    0xA6, 0x4E, 0xDF, 0xAB, 0xB0, 0xB2, 0x09, 0xC5, 0xFD, 0x6C, 0x2D, 0x25, 0xBD, 0xC9, 0x03, 0x7C,
+    0x1D, 0xE9, 0x7D, 0x0A, 0xD8, 0xBA, 0x6D, 0xC8, 0x61, 0xC4, 0x1A, 0x2E, 0x75, 0xFE, 0x26, 0x51,
+    0x70, 0x4E, 0xFF, 0x49, 0x28, 0xC6, 0x11, 0x4F, 0xCC, 0xB6, 0x73, 0x13, 0x27, 0xC3, 0xD8, 0xF9,
+    0x12, 0x69, 0xF2, 0xFA, 0x51, 0x86, 0x70, 0xE9, 0xFE, 0x69, 0xEC, 0x2B, 0xFF, 0x0C, 0x96, 0x13,
+    0xAF, 0xCB, 0x35, 0xDC, 0xD0, 0x2E, 0xC5, 0x47, 0xB8, 0xBD, 0x80, 0xAB, 0xA8, 0x94, 0xBF, 0x76,
+    0xBA, 0x7E, 0x5D, 0xC3, 0xE0, 0x2E, 0xEA, 0xC5, 0xD3, 0xF5, 0x97, 0x93, 0x52, 0xBB, 0x1B, 0x1D,
+    0x1A, 0xCF, 0xE7, 0x78, 0xF2, 0x2F, 0xB6, 0xB4, 0x05, 0x6F, 0x3E, 0x8D, 0x33, 0xE7, 0xBB, 0x18,
+    0x53, 0xD8, 0xAC, 0xA2, 0xAD, 0x74, 0x93, 0xFB, 0x31, 0xCB, 0xC9, 0xB0, 0x64, 0x3A, 0xE2, 0x94,
+    0x6D, 0x74, 0xCE, 0x60, 0x37, 0xF3, 0xC5, 0xDB, 0x55, 0xF6, 0x6D, 0x6D, 0x1F, 0x84, 0xF4, 0xA4,
+    0xD5, 0xCD, 0x88, 0x5F, 0xF3, 0x47, 0x6B, 0xBF, 0x0F, 0xD9, 0x27, 0x75, 0x61, 0xFD, 0x4E, 0x5E,
+    0x9E, 0xDF, 0x49, 0xF3, 0x3D, 0xB1, 0x35, 0xDF, 0x35, 0x3A, 0x8C, 0x92, 0xE6, 0x88, 0x07, 0x24,
+    0xAB, 0x2D, 0x82, 0x35, 0xD2, 0xC8, 0x58, 0x04, 0x28, 0xB7, 0x65, 0x2C, 0x1C, 0x7F, 0xC9, 0x96,
+    0x60, 0xEB, 0x31, 0x06, 0x91, 0x62, 0x4D, 0x3D, 0x20, 0xF1, 0x8F, 0x33, 0x67, 0x2D, 0xF0, 0xD4,
+    0x2C, 0x98, 0x65, 0x39, 0x75, 0x21, 0xD2, 0xA5, 0x99, 0x6C, 0xA7, 0x1D, 0xF7, 0x8B, 0xE1, 0x87,
+    0xBF, 0xEE, 0xE7, 0x7C, 0xB1, 0x10, 0x41, 0x90, 0xCD, 0xF4, 0x55, 0x46, 0x0C, 0x45, 0xFB, 0xD5,
+    0x5A, 0xF1, 0x5D, 0xF0, 0xCA, 0x01, 0xB7, 0xE1, 0xA1, 0x6D, 0xF2, 0xF8, 0x0A, 0x9E, 0x70, 0xFD,
+    0x03, 0x6D, 0x55, 0x3D, 0x68, 0x1C, 0x47, 0x14, 0xFE, 0x66, 0x56, 0xD6, 0x4A, 0xDA, 0x93, 0xC6,
+    0x85, 0x0D, 0x72, 0xB0, 0xB4, 0x22, 0x11, 0xE1, 0x08, 0xB2, 0x4E, 0x84, 0x2B, 0x54, 0xDC, 0x79,
+    0x57, 0x56, 0x91, 0x74, 0x91, 0x21, 0xC6, 0xAD, 0x0B, 0x13, 0x9C, 0x2A, 0x57, 0x28, 0xE4, 0x0A,
+    0x59, 0x5A, 0x1C, 0x4C, 0x02, 0x4E, 0xA1, 0x22, 0x9D, 0x53, 0x1C, 0xC1, 0x85, 0x53, 0xE5, 0x42,
+    0x04, 0x49, 0x40, 0x96, 0xC7, 0x32, 0x49, 0xDA, 0x85, 0x90, 0xDA, 0x0B, 0x26, 0x55, 0x08, 0x6C,
+    0xC2, 0x11, 0x9F, 0x61, 0xEF, 0x26, 0xDF, 0xDB, 0x93, 0x62, 0xE5, 0x67, 0x98, 0x79, 0xBB, 0xCC,
+    0xBC, 0x79, 0xF3, 0xDE, 0xFB, 0xBE, 0x37, 0x83, 0xD0, 0xA5, 0x9E, 0x1B, 0x60, 0xC7, 0x59, 0xE3,
+    0x0A, 0xE5, 0x9C, 0x8D, 0x5C, 0xE1, 0x3B, 0x97, 0x38, 0xD7, 0x0F, 0x9D, 0xBB, 0xE4, 0x5C, 0x2F,
+    0x72, 0x2E, 0x70, 0x2E, 0x07, 0xEA, 0xBA, 0x6F, 0x8A, 0x28, 0x49, 0x01, 0x9C, 0xBA, 0xB8, 0x7D,
+    0x50, 0x0E, 0x9C, 0xC1, 0x46, 0x5F, 0xE5, 0xC1, 0x8F, 0x99, 0xB1, 0x51, 0x2D, 0xD9, 0xD1, 0x7D,
+    0x34, 0x1B, 0x54, 0xF0, 0x70, 0x2A, 0xF6, 0xE2, 0x89, 0x05, 0x2F, 0xD1, 0x6F, 0xEA, 0x44, 0xDD,
+    0xD6, 0x16, 0x1F, 0x28, 0x0B, 0xB3, 0x26, 0xBB, 0x65, 0x64, 0x1C, 0xB4, 0x89, 0x2E, 0xC7, 0x1E,
+    0xC7, 0xFB, 0x97, 0x63, 0xB4, 0x6F, 0x9F, 0x46, 0xE3, 0xCA, 0xA7, 0x68, 0xBC, 0xFA, 0x3A, 0x1A,
+    0xFE, 0x1D, 0x8C, 0x41, 0x2C, 0xF5, 0x6A, 0x76, 0xE0, 0x67, 0x91, 0xEA, 0xF3, 0xB7, 0x08, 0xFE,
+    0xE8, 0x9B, 0x9F, 0xF2, 0xF0, 0xA3, 0x2C, 0x32, 0x76, 0xBB, 0x96, 0x88, 0x42, 0x67, 0x5A, 0xAF,
+    0xA7, 0xED, 0xD0, 0x68, 0xBB, 0xB7, 0x39, 0xE3, 0x1D, 0x26, 0xAD, 0x69, 0x94, 0xAD, 0xDA, 0x58,
+    0x9A, 0x9E, 0xE2, 0x37, 0xF0, 0xBD, 0xC3, 0x6C, 0xB3, 0x31, 0x13, 0x28, 0x9B, 0x8E, 0x56, 0x3A,
+    0xD5, 0x71, 0xCF, 0xE6, 0xCB, 0x81, 0x4E, 0x1B, 0xD3, 0x5E, 0xD2, 0xAD, 0xFA, 0x18, 0x2D, 0x9C,
+    0xC6, 0x16, 0xBE, 0xB1, 0xF9, 0x16, 0x0F, 0x4E, 0xE7, 0xBD, 0x74, 0xCB, 0xCB, 0xFD, 0xCC, 0x4F,
+    0x03, 0x4C, 0x70, 0x65, 0x15, 0x06, 0x3A, 0xA3, 0x42, 0x13, 0x85, 0xCE, 0x75, 0x8A, 0xF2, 0xEC,
+    0x53, 0x1C, 0xE3, 0xBB, 0x68, 0xBE, 0x04, 0x18, 0xAB, 0xFF, 0xEC, 0x01, 0x51, 0x6C, 0x1C, 0x27,
+    0x77, 0xE0, 0x4B, 0x74, 0x43, 0x1C, 0x50, 0xAA, 0xC2, 0x48, 0xB8, 0xDE, 0xF3, 0x81, 0xC8, 0x5F,
+    0x5D, 0x8A, 0x0D, 0x84, 0x6F, 0x15, 0x08, 0x2C, 0x1E, 0x44, 0x29, 0x22, 0xA8, 0xAB, 0xCE, 0xAA,
+    0x02, 0x78, 0xE8, 0xC4, 0xAA, 0x79, 0x2E, 0x16, 0xE0, 0xD6, 0x87, 0x94, 0x61, 0xCF, 0xE7, 0x82,
+    0x76, 0x30, 0xFC, 0x44, 0x39, 0x1E, 0xF6, 0xE0, 0x3B, 0x76, 0xB1, 0xCE, 0x9D, 0xD2, 0x98, 0x99,
+    0x91, 0xF7, 0x4C, 0xB2, 0x01, 0xDA, 0xA0, 0x77, 0xFC, 0x6E, 0x89, 0xBF, 0x26, 0x3E, 0xF9, 0xCD,
+    0x61, 0x92, 0x51, 0x56, 0xC3, 0x04, 0x03, 0xF8, 0x3D, 0x44, 0x56, 0xF2, 0x01, 0xCC, 0x03, 0xFE,
+    0x73, 0x9A, 0xED, 0xA9, 0x67, 0x4F, 0xEC, 0x58, 0xBB, 0x89, 0x60, 0x3D, 0x45, 0xDE, 0x80, 0xF1,
+    0xAD, 0xCA, 0x7B, 0x58, 0x8E, 0xE0, 0x3D, 0xB1, 0xD8, 0xC9, 0x11, 0xD0, 0x0D, 0x86, 0x41, 0x3B,
+    0x8A, 0xD1, 0xD6, 0x18, 0x4F, 0x56, 0x9E, 0x3E, 0x45, 0xCF, 0xB9, 0x54, 0xB3, 0xF0, 0xE8, 0x4E,
+    0x94, 0x20, 0x90, 0x8F, 0xEB, 0x91, 0x51, 0x5C, 0xAD, 0xE3, 0x71, 0xD2, 0xAE, 0x0D, 0xB1, 0x3D,
+    0x02, 0x40, 0x51, 0xF9, 0xE7, 0x6B, 0xC0, 0x77, 0xCC, 0x1E, 0xD5, 0x3E, 0x5F, 0x00, 0x79, 0x84,
+    0x45, 0xD8, 0x89, 0x1F, 0xBE, 0xBE, 0x5E, 0xDB, 0xBD, 0x89, 0xED, 0xF1, 0xDF, 0x66, 0xEE, 0xBE,
+    0x72, 0x46, 0x33, 0xF5, 0x47, 0x4D, 0x4B, 0xEA, 0xB8, 0x4D, 0xCB, 0xB0, 0xA3, 0xA1, 0x64, 0x1C,
+    0x93, 0xE9, 0x98, 0x50, 0x27, 0x49, 0xB5, 0x09, 0x49, 0x07, 0xD0, 0x38, 0x1A, 0xC7, 0x6D, 0xFC,
+    0x3E, 0xA6, 0xEE, 0x81, 0xD4, 0xAF, 0x91, 0xF6, 0x6B, 0xC5, 0xF2, 0x5A, 0x5F, 0x91, 0x9A, 0x08,
+    0x79, 0x44, 0x0A, 0x9F, 0x56, 0x7B, 0x50, 0xB9, 0x64, 0x10, 0xF4, 0xAE, 0x59, 0xFE, 0xD4, 0xCA,
+    0x1F, 0xCA, 0x8B, 0x02, 0x2E, 0x61, 0x55, 0x0E, 0x7A, 0x28, 0xB9, 0x50, 0x83, 0x12, 0x88, 0x07,
+    0x4C, 0x6A, 0x2C, 0x3F, 0x44, 0xD5, 0x58, 0x49, 0x8B, 0x9F, 0xE2, 0x1F, 0x2D, 0x2C, 0x37, 0x73,
+    0x8D, 0x7A, 0x3E, 0x21, 0x49, 0xA1, 0xDE, 0x86, 0xDA, 0x38, 0xF6, 0x69, 0x18, 0x13, 0x66, 0xDA,
+    0x6A, 0x7B, 0xF9, 0x12, 0xDD, 0x59, 0x17, 0x37, 0x56, 0xA9, 0x1F, 0x70, 0x3E, 0x13, 0x6F, 0xB8,
+    0xDF, 0xDC, 0xA2, 0xD9, 0xAC, 0x09, 0xDD, 0xF7, 0xAD, 0x37, 0xC0, 0x3E, 0xCF, 0x33, 0x89, 0x9F,
+    0xD1, 0xD9, 0x07, 0xF4, 0xCD, 0x58, 0x9E, 0x7A, 0x6F, 0x04, 0x30, 0xB0, 0x41, 0x5E, 0xD4, 0xC8,
+    0x47, 0x2F, 0x23, 0xCE, 0x07, 0x70, 0x2F, 0x1C, 0x09, 0x84, 0x87, 0xA1, 0x63, 0xC6, 0x4C, 0x4C,
+    0xB7, 0xBF, 0x12, 0x34, 0x57, 0x85, 0x25, 0x73, 0x12, 0x79, 0x49, 0x1D, 0xCF, 0x32, 0x5C, 0x95,
+    0x49, 0x3C, 0x3D, 0x11, 0x0D, 0x3C, 0x64, 0xF4, 0x6A, 0x28, 0xC8, 0x0F, 0x24, 0x4D, 0x9C, 0xD3,
+    0x39, 0x59, 0x84, 0x7E, 0xC0, 0x30, 0x6F, 0xEA, 0x5D, 0x46, 0x30, 0xB2, 0x4E, 0x24, 0x83, 0x54,
+    0x52, 0x99, 0x33, 0x54, 0x5D, 0x48, 0x1D, 0x38, 0xFC, 0xB7, 0x09, 0x80, 0x23, 0xF4, 0x4A, 0xC8,
+    0xD0, 0x12, 0xB1, 0x2A, 0x62, 0x49, 0xC4, 0x0C, 0x47, 0x33, 0x10, 0x3F, 0xDF, 0xE0, 0x21, 0xE6,
+    0xB1, 0x40, 0x7D, 0xF9, 0x85, 0xB6, 0xA0, 0x3B, 0x82, 0xF4, 0x82, 0x88, 0x79, 0x11, 0x46, 0x84,
+    0x2F, 0x15, 0xE4, 0x3D, 0x8A, 0x79, 0xC0, 0x53, 0xA1, 0xC4, 0xEF, 0x52, 0x1C, 0x7B, 0x83, 0x63,
+    0xED, 0xE6, 0x11, 0x10, 0x12, 0xBA, 0x68, 0x8B, 0x13, 0x9E, 0x98, 0xD5, 0xD9, 0xDF, 0xB6, 0x3B,
+    0xA3, 0x6A, 0x2A, 0x9D, 0xBC, 0x36, 0x39, 0x51, 0xF9, 0xF8, 0xDC, 0xF5, 0xC5, 0x95, 0x6A, 0xB7,
+    0x96, 0x4E, 0x71, 0x4B, 0x45, 0xDB, 0xCF, 0x5E, 0xBE, 0x33, 0xB8, 0x1A, 0xB7, 0xC4, 0x39, 0xEF,
+    0xFE, 0x24, 0x2A, 0x60, 0x75, 0xAF, 0xA0, 0x1B, 0xA5, 0xE7, 0xA0, 0xF6, 0xC7, 0x31, 0xD3, 0x99,
+    0xAB, 0x57, 0x17, 0xAB, 0xAD, 0x30, 0x55, 0x3C, 0x60, 0x88, 0xF4, 0xBC, 0x17, 0xB7, 0x66, 0xB4,
+    0x5D, 0x85, 0xBA, 0x31, 0x5E, 0x19, 0xAF, 0x7A, 0x59, 0x65, 0xA5, 0x5E, 0x5F, 0xE5, 0xBA, 0xDE,
+    0x9B, 0xAC, 0xB0, 0x2D, 0xB1, 0x54, 0xEA, 0x67, 0xBB, 0xAC, 0x99, 0x85, 0x77, 0x11, 0xB8, 0x1E,
+    0x86, 0xBE, 0x35, 0x71, 0x43, 0xE7, 0x9E, 0x6D, 0x62, 0xCB, 0xB3, 0x26, 0xD9, 0x47, 0xCF, 0xD8,
+    0x10, 0x7D, 0x9D, 0xD7, 0xE2, 0xC8, 0xCB, 0x89, 0xF2, 0x19, 0x54, 0x57, 0xA6, 0xF4, 0xDA, 0xF7,
+    0x8B, 0xD5, 0xA7, 0xEB, 0x9F, 0xB4, 0xEA, 0xC6, 0xBF, 0x95, 0x5E, 0x2C, 0x3C, 0x17, 0x0B, 0x22,
+    0xF1, 0x96, 0x4E, 0xEA, 0x1E, 0xAE, 0x4D, 0x07, 0xC5, 0x95, 0x78, 0x3C, 0x5B, 0xE8, 0xE8, 0x64,
+    0x1A, 0xD9, 0xBC, 0xCE, 0xC2, 0xDE, 0x95, 0x98, 0x40, 0x6D, 0xA8, 0x78, 0xCC, 0x4F, 0x95, 0x9D,
+    0x0A, 0xF3, 0x73, 0x0C, 0x54, 0xD9, 0x79, 0x75, 0xEF, 0x7C, 0xEA, 0xEC, 0x92, 0xD4, 0xD0, 0x6B,
+    0x49, 0xE2, 0x77, 0xB0, 0xEB, 0x5D, 0xDA, 0x0F, 0x13, 0xDD, 0x5F, 0x54, 0x5F, 0x98, 0xCA, 0xCA,
+    0xCA, 0xE1, 0xAD, 0x42, 0xC5, 0x07, 0xC9, 0x79, 0xCD, 0x40, 0x94, 0x5D, 0xF5, 0x25, 0x75, 0x1B,
+    0x7A, 0xB6, 0x32, 0x31, 0x5D, 0xF7, 0xD3, 0xEA, 0x4A, 0xAB, 0x2B, 0x37, 0xB1, 0xEA, 0x4C, 0x56,
+    0x2B, 0xB3, 0xB3, 0xD5, 0xD9, 0xBA, 0xC9, 0xD1, 0x8A, 0xEC, 0x59, 0x2A, 0xCD, 0x95, 0xF5, 0x97,
+    0x0B, 0x9D, 0x82, 0x44, 0x00, 0x6A, 0x1C, 0x4D, 0x90, 0x5A, 0x9C, 0x93, 0xE9, 0x58, 0xA6, 0x4D,
+    0x09, 0xE1, 0x5C, 0x89, 0xE6, 0x85, 0x52, 0x6B, 0xD4, 0x9B, 0x65, 0xE7, 0xCC, 0x72, 0x89, 0x5A,
+    0x09, 0x1C, 0x2F, 0x13, 0x99, 0xE1, 0x16, 0x6E, 0xA7, 0x1D, 0xE1, 0x42, 0xE3, 0x78, 0x8A, 0xE6,
+    0x38, 0xCB, 0x0B, 0x50, 0x16, 0xF2, 0xB2, 0xEF, 0x95, 0x47, 0xB6, 0x4F, 0x58, 0x1D, 0xF5, 0xAD,
+    0xB2, 0x7F, 0x5B, 0xD6, 0x78, 0xEF, 0x04, 0x31, 0xE7, 0x84, 0x7A, 0x0D, 0x21, 0xE1, 0xA6, 0xDC,
+    0x1D, 0x79, 0x2E, 0xD7, 0x6F, 0x2E, 0x05, 0x23, 0x4C, 0xBE, 0xDB, 0x81, 0x37, 0x14, 0x8F, 0x0B,
+    0x7A, 0x1B, 0xB5, 0x69, 0xE7, 0x66, 0x97, 0x27, 0x14, 0xAC, 0x50, 0xF5, 0xEC, 0x90, 0x21, 0x3D,
+    0xFB, 0x30, 0x81, 0xE7, 0x48, 0x0E, 0x7F, 0x30, 0x23, 0x62, 0x69, 0x8C, 0xD7, 0xEA, 0x70, 0x9F,
+    0xC2, 0xF1, 0x05, 0xE3, 0x7B, 0x2A, 0x82, 0xF7, 0xE8, 0x97, 0xAE, 0x03, 0x23, 0x94, 0x5D, 0x9A,
+    0x13, 0xE2, 0x0B, 0x3B, 0xBB, 0x9B, 0xFF, 0xAA, 0x91, 0xF7, 0xE8, 0x1A, 0x5F, 0x66, 0xD4, 0x7E,
+    0xB9, 0x21, 0x24, 0xE3, 0x03, 0x88, 0xF2, 0xF6, 0x95, 0xEB, 0x9B, 0xF5, 0xC5, 0x9F, 0x9B, 0x78,
+    0x27, 0x31, 0x96, 0x6F, 0x43, 0xC1, 0x18, 0xC2, 0x74, 0x8E, 0xD7, 0x92, 0xF7, 0x88, 0xAE, 0x1E,
+    0xE4, 0x7C, 0xCB, 0x87, 0x30, 0x8E, 0x8F, 0xCD, 0x8E, 0x93, 0xA7, 0x65, 0x98, 0xFC, 0x4F, 0x11,
+    0xE2, 0x2F, 0x4D, 0x55, 0x3D, 0x6C, 0x14, 0x47, 0x14, 0xFE, 0x76, 0x06, 0x7B, 0x80, 0xE5, 0x6E,
+    0x5D, 0x44, 0x56, 0x12, 0x6C, 0x6F, 0x43, 0x81, 0x90, 0xED, 0xA3, 0xB8, 0xC2, 0x52, 0x0E, 0xDF,
+    0x46, 0x48, 0xA1, 0xA0, 0x49, 0x11, 0x2B, 0x05, 0x4D, 0x8A, 0x34, 0x88, 0x22, 0x57, 0x50, 0x10,
+    0xC9, 0xC7, 0xAD, 0x40, 0x0A, 0x05, 0x8A, 0x72, 0x45, 0x7A, 0x5C, 0x90, 0x02, 0xA5, 0xF0, 0x15,
+    0x14, 0x14, 0x86, 0x1B, 0x70, 0x19, 0x29, 0xDA, 0x88, 0x2E, 0x24, 0x62, 0x15, 0x11, 0x94, 0xD0,
+    0x64, 0x12, 0x5F, 0x92, 0x33, 0xD9, 0xBB, 0xCD, 0xF7, 0xE6, 0xCE, 0x16, 0xA7, 0x9B, 0xD1, 0xFC,
+    0xBD, 0xBF, 0xEF, 0x7B, 0xEF, 0x2D, 0x70, 0xF0, 0x0B, 0xFA, 0x09, 0x4C, 0x39, 0x84, 0xC9, 0x0D,
+    0x54, 0xC6, 0x03, 0xC7, 0xD1, 0xE0, 0x68, 0x96, 0x0E, 0x35, 0x5E, 0xA0, 0xC7, 0xCD, 0x32, 0x47,
+    0x59, 0x66, 0xFE, 0x10, 0x03, 0x6E, 0x36, 0x29, 0x39, 0x02, 0xCC, 0x3E, 0xA0, 0x4A, 0xBE, 0x2A,
+    0xCB, 0x92, 0x27, 0x1F, 0xA2, 0x86, 0xA0, 0x40, 0x94, 0xA2, 0x84, 0xE1, 0xEB, 0x4C, 0x39, 0xC4,
+    0x43, 0x0C, 0x11, 0x8D, 0xD1, 0x86, 0xFE, 0xC3, 0xD6, 0xA0, 0xFE, 0x71, 0x91, 0x45, 0xF1, 0xD0,
+    0x64, 0x86, 0x32, 0xE5, 0x53, 0x99, 0x5C, 0x94, 0x15, 0x6D, 0x18, 0x57, 0xE3, 0x75, 0x61, 0x9E,
+    0x5B, 0x8C, 0x83, 0x32, 0x47, 0x27, 0x69, 0x0E, 0x50, 0xB3, 0x11, 0xF5, 0x39, 0x35, 0xA6, 0xCD,
+    0x90, 0x87, 0xDE, 0x8B, 0x48, 0xCC, 0x38, 0xB8, 0x88, 0xB2, 0xF9, 0xA5, 0x5F, 0x3F, 0x1E, 0x60,
+    0x33, 0x78, 0xC8, 0xEB, 0x32, 0xF5, 0xD7, 0xF1, 0xAB, 0x04, 0x4A, 0xC2, 0x68, 0x72, 0x18, 0xCA,
+    0xE0, 0x11, 0x47, 0xC4, 0xE0, 0xE8, 0x1B, 0xA8, 0x12, 0xD0, 0x43, 0x89, 0xBD, 0x29, 0x77, 0xE8,
+    0xC8, 0x21, 0xB6, 0x96, 0x64, 0xCE, 0xAA, 0x32, 0x5B, 0x99, 0x03, 0xBB, 0xCA, 0x59, 0xD9, 0x1D,
+    0x84, 0x43, 0xCD, 0x08, 0x57, 0xEF, 0x6A, 0xDA, 0x3F, 0x4B, 0xB0, 0x2C, 0x5A, 0x08, 0x5F, 0x3A,
+    0x5C, 0x43, 0x94, 0x38, 0x34, 0x13, 0x99, 0xC3, 0x3C, 0x16, 0xE4, 0x5C, 0x8D, 0x7E, 0x25, 0x6E,
+    0x5D, 0x39, 0x55, 0xE6, 0xEB, 0xDA, 0x99, 0x32, 0x6B, 0x6B, 0xAE, 0x13, 0x64, 0xD0, 0xE9, 0x22,
+    0x50, 0x0F, 0x32, 0x84, 0xE0, 0xC2, 0x71, 0x51, 0xC5, 0xA2, 0x51, 0x36, 0x66, 0x14, 0xBB, 0x1C,
+    0x83, 0xE0, 0xE9, 0xF0, 0x2A, 0x56, 0x3A, 0x5F, 0x41, 0x7D, 0xB7, 0x99, 0x63, 0x65, 0xEF, 0x67,
+    0xA8, 0x71, 0xD3, 0xA2, 0xB6, 0x5B, 0x10, 0x96, 0x66, 0x8A, 0xDA, 0x79, 0xC7, 0xB8, 0x6A, 0xC0,
+    0xBA, 0xA2, 0xE3, 0x97, 0x13, 0xE1, 0x64, 0x8C, 0x23, 0x18, 0x6F, 0xDB, 0xA5, 0xC0, 0xA9, 0x7C,
+    0x85, 0xFC, 0xB9, 0x86, 0xB6, 0xC8, 0x1B, 0xFA, 0x71, 0x9A, 0x5F, 0x33, 0x37, 0x1E, 0x67, 0xBD,
+    0x48, 0x3F, 0xB1, 0x2E, 0xD2, 0x37, 0x1E, 0xE7, 0x4B, 0x26, 0x51, 0xD9, 0x8A, 0x49, 0xB4, 0x6D,
+    0x98, 0xD4, 0xD8, 0x86, 0xFE, 0xFB, 0xB3, 0xF4, 0x14, 0x01, 0xA3, 0x9E, 0xD9, 0xBE, 0x84, 0xCA,
+    0xC5, 0x02, 0x70, 0xE6, 0x75, 0x82, 0x72, 0x24, 0xCB, 0x60, 0xA7, 0xC7, 0x0C, 0x48, 0x83, 0xAC,
+    0x8D, 0x0A, 0x83, 0xEB, 0x99, 0x54, 0xA7, 0xE7, 0x10, 0x11, 0xDA, 0x26, 0x31, 0xE8, 0x90, 0xF0,
+    0xCB, 0x6F, 0x81, 0xDE, 0x53, 0x47, 0x31, 0xCD, 0x26, 0x62, 0xA9, 0xB8, 0x09, 0xE9, 0x5F, 0x4C,
+    0x75, 0xEB, 0x42, 0x5A, 0x81, 0x63, 0x8F, 0xEE, 0x02, 0xF7, 0x81, 0x79, 0x61, 0xF5, 0x75, 0x17,
+    0x01, 0xAF, 0x25, 0x04, 0x21, 0x49, 0x0D, 0x25, 0x83, 0x68, 0x4F, 0x74, 0xBC, 0xEB, 0x69, 0xC1,
+    0xCC, 0xC6, 0xC6, 0x46, 0x38, 0x45, 0x25, 0x27, 0xBC, 0x64, 0x91, 0x9C, 0xA9, 0x3F, 0xB9, 0x20,
+    0xBD, 0x41, 0xBF, 0x0B, 0x4D, 0xE3, 0xEA, 0xCE, 0x8F, 0x24, 0x92, 0xEE, 0x87, 0x94, 0x8E, 0x29,
+    0x3D, 0xD3, 0x11, 0x76, 0xD3, 0x09, 0xD5, 0xDA, 0x4D, 0xE9, 0x9E, 0xA4, 0x8D, 0x96, 0x38, 0x09,
+    0x92, 0x13, 0x87, 0xC9, 0xE6, 0x39, 0xC4, 0x50, 0xDB, 0xAF, 0xB6, 0x5F, 0x25, 0xA1, 0x8D, 0xAD,
+    0x5C, 0x4F, 0x73, 0x0B, 0x9D, 0x7B, 0xA2, 0x45, 0x04, 0x99, 0xA7, 0xD3, 0xFC, 0x51, 0xDE, 0xAF,
+    0x91, 0x8F, 0x10, 0xD3, 0x14, 0x42, 0x94, 0x4F, 0x83, 0x9E, 0x13, 0x23, 0xB2, 0x90, 0x83, 0x0A,
+    0xC7, 0x15, 0xEA, 0xE9, 0x90, 0x9A, 0xDA, 0x4B, 0x3B, 0x67, 0x06, 0x6B, 0x94, 0xD4, 0x09, 0x1D,
+    0x6B, 0xD1, 0x29, 0xBE, 0xBB, 0xCE, 0x77, 0xA1, 0x24, 0x5A, 0x81, 0xF2, 0x9B, 0x88, 0xF4, 0xE7,
+    0x85, 0xB2, 0xFB, 0xB1, 0x5D, 0x8B, 0x83, 0xB1, 0xBE, 0x90, 0x33, 0xA9, 0x47, 0x52, 0x4E, 0x56,
+    0x0B, 0xAC, 0xB3, 0xE5, 0x6F, 0x92, 0x96, 0xF0, 0xD4, 0x20, 0x48, 0x7D, 0xC5, 0xEE, 0x8B, 0x75,
+    0xC1, 0x0C, 0x67, 0xBE, 0xF5, 0x21, 0x4A, 0xB0, 0x13, 0x90, 0x7C, 0xD2, 0x0B, 0x76, 0x25, 0x49,
+    0x92, 0x40, 0xDF, 0xF8, 0xF5, 0x79, 0x50, 0xF8, 0xAA, 0xCB, 0x9B, 0x5E, 0xA0, 0xCC, 0xA8, 0x90,
+    0x66, 0x58, 0x37, 0xC6, 0x17, 0x70, 0x28, 0xB6, 0xA5, 0xA0, 0xBB, 0x6F, 0xCA, 0x69, 0x9F, 0x0C,
+    0x23, 0xF4, 0x07, 0xD1, 0x4F, 0xD8, 0xEC, 0xE9, 0xDD, 0x34, 0xAE, 0xE0, 0x41, 0x4B, 0xFF, 0x62,
+    0xA3, 0xEF, 0x51, 0x7B, 0x8D, 0x26, 0x23, 0x1D, 0xA2, 0x3E, 0x79, 0x2C, 0x8A, 0xEC, 0xA1, 0xA8,
+    0x80, 0x8D, 0x89, 0x1F, 0xE7, 0xC4, 0x75, 0x77, 0x00, 0xAB, 0xEC, 0xD4, 0xE1, 0xEE, 0xBA, 0xEC,
+    0x06, 0x07, 0xBB, 0xCE, 0x01, 0xE2, 0x87, 0x3B, 0x04, 0x1B, 0x1B, 0x86, 0x80, 0x12, 0x34, 0x83,
+    0x99, 0x4B, 0x1F, 0xC5, 0x54, 0xB8, 0x82, 0xF9, 0x21, 0x3A, 0x16, 0xFD, 0xCC, 0xAB, 0x75, 0x32,
+    0x53, 0x87, 0xF6, 0x7F, 0xF9, 0xBD, 0xE3, 0x59, 0x61, 0x25, 0xA0, 0xCC, 0x83, 0xB2, 0xAB, 0x47,
+    0x08, 0xEE, 0x1C, 0xA7, 0x7F, 0x09, 0xF3, 0x25, 0x1A, 0xE8, 0x2F, 0x36, 0x8D, 0x5D, 0x0A, 0x6D,
+    0x58, 0x26, 0x7A, 0x7F, 0xEA, 0x6D, 0x4B, 0xFA, 0xC0, 0x84, 0x47, 0xC9, 0x29, 0xC9, 0xF0, 0xF2,
+    0x79, 0xA2, 0xF6, 0x6E, 0x27, 0x7A, 0xF7, 0x42, 0x62, 0x6E, 0x19, 0x84, 0x61, 0x88, 0xA8, 0x5A,
+    0x45, 0xB5, 0x52, 0xC1, 0xE2, 0xC2, 0x02, 0x96, 0x97, 0x1B, 0x68, 0xAC, 0xAD, 0xA1, 0x51, 0xBF,
+    0x2A, 0x00, 0x8F, 0x93, 0x49, 0xA2, 0x49, 0x83, 0x62, 0x8B, 0x6C, 0x40, 0xE7, 0x74, 0x2C, 0x4A,
+    0xC2, 0x54, 0x3A, 0x94, 0x12, 0xE4, 0x3D, 0xC4, 0xCD, 0xF2, 0xDE, 0x1B, 0xE1, 0x77, 0x28, 0xA2,
+    0x7C, 0x0D, 0x49, 0xE2, 0xFA, 0xAE, 0xA5, 0x8A, 0xC3, 0x04, 0x3B, 0xE5, 0xA9, 0x67, 0xE4, 0x91,
+    0xC4, 0x73, 0xF2, 0xE6, 0x07, 0xE5, 0xCD, 0xF2, 0x85, 0xA2, 0xCB, 0x6D, 0x88, 0x7A, 0xA9, 0x31,
+    0x96, 0xBC, 0x4F, 0x42, 0x4C, 0x3A, 0x75, 0xCC, 0x76, 0xF4, 0x9F, 0x35, 0xCF, 0x62, 0x95, 0xBB,
+    0x07, 0xF5, 0xAA, 0x4A, 0xD8, 0x6A, 0xE4, 0x5C, 0x9E, 0xD5, 0x05, 0xC1, 0x49, 0x4F, 0x3F, 0x26,
+    0x3D, 0xCE, 0xF7, 0x7A, 0x9D, 0xEE, 0xA3, 0x75, 0x72, 0x7C, 0x91, 0xD9, 0x96, 0x63, 0x76, 0xE4,
+    0xD3, 0xBF, 0xE6, 0x35, 0xB3, 0x29, 0x06, 0x93, 0x0C, 0x67, 0x06, 0x63, 0x4D, 0xFA, 0x21, 0xA4,
+    0x7B, 0x11, 0xA2, 0xB9, 0x08, 0x3A, 0xEB, 0x2D, 0x87, 0xB7, 0x2E, 0xA6, 0xF1, 0xE7, 0xFC, 0x54,
+    0x14, 0x13, 0xAA, 0xB2, 0xA9, 0x1F, 0xAC, 0x83, 0x13, 0x50, 0xA9, 0x80, 0xDA, 0x12, 0x0B, 0x95,
+    0xD9, 0x7F, 0x5F, 0x54, 0xF4, 0xB3, 0xE1, 0xEC, 0xB8, 0xD7, 0x61, 0x07, 0xE8, 0xDF, 0x96, 0x54,
+    0x7E, 0x20, 0x4D, 0x77, 0x55, 0x3E, 0x26, 0x61, 0x02, 0x1E, 0x74, 0xBD, 0x50, 0x81, 0xE6, 0x8E,
+    0xF9, 0xF2, 0x5A, 0xAF, 0xD5, 0xA2, 0x3C, 0xF5, 0x9C, 0x15, 0x3F, 0x8F, 0x7B, 0x2F, 0xB6, 0x64,
+    0xA9, 0xBD, 0xF6, 0xD3, 0xE0, 0x83, 0xFB, 0xBB, 0xE9, 0x7B, 0x3B, 0x52, 0x8E, 0x0B, 0xDE, 0xE8,
+    0x7C, 0x7E, 0x65, 0xDC, 0x25, 0x09, 0x4C, 0xE8, 0xBF, 0x86, 0xE8, 0xD5, 0x92, 0x9E, 0x71, 0x3D,
+    0xB4, 0x3F, 0xC1, 0x11, 0xF3, 0x35, 0xB0, 0xCD, 0x9B, 0x90, 0xD8, 0x14, 0x88, 0x6F, 0xA3, 0x79,
+    0xDE, 0x3E, 0x84, 0x1B, 0xA2, 0x31, 0x27, 0xAA, 0xA5, 0xF9, 0x35, 0x10, 0x64, 0x47, 0x23, 0xD8,
+    0xAB, 0x0B, 0xFA, 0x49, 0xBA, 0x58, 0xC7, 0x1E, 0x4C, 0xEF, 0xD3, 0xF5, 0xA8, 0xCC, 0x66, 0x76,
+    0x0E, 0xCA, 0x60, 0xF9, 0x28, 0xF2, 0x7A, 0x88, 0xAD, 0xB5, 0xE0, 0x89, 0xD5, 0x55, 0x54, 0x7A,
+    0xD2, 0x6E, 0xDA, 0xF3, 0xEC, 0x5D, 0xFA, 0x77, 0x0F, 0x94, 0x40, 0xAC, 0xD3, 0x49, 0x3B, 0x58,
+    0xF4, 0x1F, 0xD1, 0xD2, 0xDD, 0x9F, 0xA6, 0x3B, 0x99, 0x2F, 0x7C, 0x01, 0x6C, 0x4E, 0xAB, 0xF9,
+    0x88, 0x68, 0x7D, 0x5F, 0xD8, 0x60, 0xD2, 0x0D, 0xF9, 0x64, 0x14, 0xDB, 0x60, 0x2F, 0x6C, 0x04,
+    0x6E, 0xF7, 0xE2, 0x8D, 0x7C, 0xCB, 0x0E, 0xBA, 0xF5, 0xD6, 0x51, 0x9C, 0x38, 0x4D, 0xCA, 0x18,
+    0xAF, 0xBA, 0xC9, 0x97, 0x3F, 0x50, 0xFF, 0x59, 0xBE, 0x7E, 0x9B, 0x3C, 0x1E, 0x3B, 0xE1, 0x2B,
+    0x23, 0x99, 0x58, 0x14, 0xCB, 0x81, 0xFF, 0x7E, 0xD7, 0x26, 0x65, 0xBF, 0x22, 0xF8, 0x76, 0x7C,
+    0x4B, 0x8B, 0xA7, 0x46, 0x7B, 0x87, 0x75, 0xF9, 0x3F, 0x4D, 0x53, 0x31, 0x6C, 0x1C, 0x45, 0x14,
+    0x7D, 0xB3, 0x43, 0xBC, 0x42, 0x73, 0x66, 0xD3, 0x38, 0x8A, 0x7C, 0x89, 0x97, 0x22, 0x85, 0x11,
+    0xF8, 0xEE, 0xCA, 0x14, 0x6B, 0xDF, 0x48, 0x14, 0xA9, 0x90, 0x5C, 0x70, 0x14, 0x6E, 0xA0, 0x70,
+    0x8F, 0x0B, 0x17, 0x87, 0x64, 0x7C, 0x8B, 0x5C, 0xA6, 0xB9, 0x8A, 0x1A, 0x09, 0xD1, 0xA4, 0x89,
+    0x0B, 0x4B, 0xA4, 0xB0, 0x75, 0x93, 0xA4, 0xA0, 0x9D, 0x28, 0x4A, 0x47, 0xB1, 0x12, 0xAE, 0x42,
+    0xC1, 0x0A, 0x6D, 0x61, 0xCC, 0xDE, 0x0D, 0xEF, 0xEF, 0x9D, 0x7D, 0xAC, 0xF4, 0x9F, 0xFE, 0xCC,
+    0xFC, 0xF9, 0xF3, 0xDE, 0xFF, 0x7F, 0x31, 0xCE, 0x81, 0xCD, 0x1E, 0x10, 0xAF, 0x02, 0x78, 0xC5,
+    0xC5, 0xA3, 0x03, 0x60, 0x45, 0x16, 0xAF, 0x73, 0xD8, 0xDE, 0x01, 0xB2, 0x0F, 0x5B, 0x46, 0xBF,
+    0x39, 0x79, 0xE2, 0x3A, 0xBD, 0x9F, 0x5D, 0x34, 0x4D, 0x3D, 0xD2, 0x13, 0x0F, 0x94, 0x05, 0xD0,
+    0xBA, 0x0B, 0xF9, 0x14, 0x2D, 0x47, 0x09, 0x9C, 0xE2, 0x31, 0xF0, 0x10, 0x9F, 0x01, 0xDA, 0x3D,
+    0xE4, 0xE6, 0x61, 0x12, 0xF8, 0x19, 0x4B, 0xB7, 0xAC, 0x18, 0x57, 0x19, 0x2E, 0x0B, 0x1C, 0x41,
+    0x17, 0x88, 0x1D, 0x01, 0x07, 0x20, 0x7C, 0x00, 0xC9, 0x73, 0x1F, 0x48, 0x3C, 0x92, 0x63, 0x6B,
+    0xBE, 0x98, 0x9A, 0xD7, 0xC6, 0x94, 0x2E, 0xFE, 0xBD, 0x87, 0xCF, 0x5B, 0x24, 0x02, 0xF4, 0x1C,
+    0x5A, 0x3D, 0xE8, 0x66, 0x91, 0xF6, 0x5C, 0x54, 0xF7, 0xD0, 0x6D, 0xDD, 0x8F, 0xDE, 0x8E, 0xEC,
+    0xF6, 0x14, 0x9A, 0xB9, 0xBF, 0x59, 0xF0, 0x48, 0x1C, 0x20, 0x0F, 0x3E, 0x80, 0xD0, 0x81, 0xCE,
+    0xD5, 0xFE, 0x03, 0x8C, 0xAE, 0xCA, 0xD8, 0xFF, 0x6A, 0x33, 0xD4, 0x51, 0xA1, 0x7D, 0x82, 0x04,
+    0x19, 0x86, 0xA8, 0x48, 0x61, 0x36, 0x45, 0x1C, 0x3C, 0xE2, 0x2B, 0xDC, 0x7E, 0x93, 0xCB, 0x8C,
+    0x10, 0x02, 0xD0, 0x1F, 0x77, 0x49, 0xA8, 0x40, 0xF3, 0xC2, 0xA8, 0xC0, 0x31, 0x36, 0x76, 0xF8,
+    0x40, 0x7C, 0x52, 0xA0, 0x52, 0xC5, 0x36, 0xBA, 0x78, 0xA1, 0xBD, 0x2E, 0xB6, 0x70, 0x8E, 0x1D,
+    0x63, 0x93, 0x5C, 0xFF, 0xE1, 0xA3, 0x0A, 0xFD, 0x12, 0x13, 0xE8, 0xF0, 0xD5, 0xC4, 0xA3, 0x1F,
+    0xC2, 0x15, 0x5D, 0xE6, 0x52, 0x7F, 0x86, 0x90, 0x63, 0xD8, 0x26, 0xA8, 0xE5, 0x53, 0x30, 0x64,
+    0xCB, 0x82, 0xA2, 0xCF, 0x2A, 0x5C, 0x17, 0x88, 0xFE, 0x2E, 0x11, 0xBF, 0x2C, 0x91, 0xFC, 0xC0,
+    0x34, 0xB8, 0x62, 0xDE, 0x5A, 0x55, 0xA8, 0x75, 0x89, 0x73, 0xEA, 0xBA, 0xE8, 0x5A, 0x1C, 0x33,
+    0xE5, 0x6C, 0x14, 0xC2, 0x54, 0x0D, 0x06, 0x5F, 0x76, 0x43, 0xA0, 0x98, 0x0A, 0x43, 0xED, 0x22,
+    0xBF, 0x41, 0x55, 0x67, 0xC8, 0xE8, 0x16, 0x14, 0x68, 0x87, 0xC8, 0x22, 0xAF, 0xE8, 0x1A, 0xCA,
+    0xCE, 0x54, 0x81, 0x32, 0xB1, 0x71, 0x4E, 0x65, 0xFB, 0x51, 0x2E, 0xDB, 0xDA, 0x6D, 0xF1, 0xC2,
+    0x10, 0x1D, 0xF6, 0xED, 0x48, 0x3B, 0x94, 0xC6, 0x4A, 0x0E, 0x09, 0x49, 0xB8, 0xC5, 0xCB, 0x38,
+    0x8B, 0x9D, 0x44, 0xB6, 0xDF, 0x1D, 0x5B, 0x96, 0xC3, 0x62, 0x6D, 0xB0, 0x6B, 0xC2, 0x74, 0x5E,
+    0x55, 0x40, 0x26, 0x84, 0x93, 0x12, 0xD1, 0x6D, 0x35, 0x3B, 0x8A, 0x3A, 0xCE, 0xC0, 0xCA, 0x22,
+    0x1D, 0xEC, 0x52, 0x34, 0xD5, 0x97, 0xA2, 0xF1, 0xCE, 0xDE, 0x4F, 0x93, 0xE0, 0xE6, 0x7A, 0xD7,
+    0x06, 0x84, 0x94, 0x45, 0x20, 0x43, 0x91, 0x4F, 0x87, 0x4C, 0x04, 0xBC, 0xF4, 0xAF, 0x89, 0xAF,
+    0x04, 0xCE, 0x05, 0xBE, 0x17, 0xD8, 0x11, 0xE8, 0xD2, 0xEE, 0xA6, 0x72, 0x4D, 0xFA, 0xAB, 0xFF,
+    0x65, 0xB9, 0xD0, 0x64, 0xEF, 0x4A, 0x74, 0x5C, 0x37, 0xC9, 0x3F, 0xCD, 0x3B, 0x6C, 0xE6, 0x6F,
+    0x01, 0x3B, 0xF1, 0xC5, 0x6A, 0xE4, 0x8D, 0xDB, 0xFC, 0x08, 0x5B, 0x18, 0x1F, 0xE2, 0x54, 0x2B,
+    0xA7, 0x7D, 0x66, 0xEC, 0x28, 0xF8, 0x34, 0xFC, 0x35, 0x43, 0x7F, 0xCA, 0xC6, 0xAE, 0xDB, 0x45,
+    0x13, 0x9A, 0x86, 0xE8, 0x20, 0x5E, 0x25, 0x83, 0xB8, 0x8D, 0x1B, 0x6A, 0x68, 0x08, 0x6D, 0xE0,
+    0x86, 0x20, 0x27, 0x17, 0x0B, 0xEA, 0xF3, 0xA3, 0x0E, 0x6E, 0x04, 0xFC, 0xEF, 0x48, 0x2D, 0x8F,
+    0xE2, 0xE6, 0x48, 0x86, 0xEB, 0xE3, 0x3E, 0x61, 0xC4, 0xE1, 0xE7, 0x4B, 0x75, 0x53, 0x84, 0xA6,
+    0x36, 0x0D, 0x81, 0x4F, 0xA8, 0x74, 0xAA, 0xEA, 0xE5, 0x58, 0xAC, 0xE4, 0x89, 0x4B, 0x5D, 0xBF,
+    0xB9, 0x1C, 0xD7, 0x2A, 0x3F, 0xCA, 0x36, 0x22, 0x27, 0x33, 0x32, 0xFF, 0x46, 0xF6, 0x91, 0x79,
+    0xAA, 0x7C, 0x96, 0x7C, 0xAD, 0xC6, 0xA6, 0xBC, 0xD9, 0xD5, 0x62, 0x76, 0x6E, 0xD2, 0x95, 0x88,
+    0xD7, 0xD5, 0xFB, 0x9C, 0xBF, 0x5C, 0xB9, 0xF2, 0xA3, 0xB0, 0x2F, 0xE6, 0xAC, 0xEF, 0xFD, 0xF3,
+    0x4C, 0x06, 0xD3, 0x4B, 0xB3, 0xF0, 0x82, 0x36, 0x5C, 0xB0, 0xCF, 0x96, 0x04, 0xA4, 0x24, 0x11,
+    0x63, 0xA3, 0xD9, 0xC2, 0x82, 0x18, 0x13, 0x4F, 0xE4, 0x81, 0x19, 0xA1, 0x1D, 0x2E, 0x65, 0x8B,
+    0x67, 0xF8, 0x56, 0x98, 0xAF, 0xCC, 0x3B, 0xDC, 0xFF, 0x85, 0xBB, 0x93, 0x70, 0xCD, 0x88, 0xBD,
+    0x73, 0xFE, 0xD8, 0x0B, 0xF5, 0xE6, 0x16, 0xD2, 0x25, 0x90, 0x53, 0xBB, 0x86, 0x9A, 0xCC, 0x6C,
+    0x3B, 0x54, 0x2C, 0xCB, 0x18, 0xF8, 0xEE, 0x96, 0xC1, 0x9D, 0xE7, 0xF9, 0x7A, 0x08, 0x97, 0xF1,
+    0xFB, 0x5D, 0xE0, 0x3F,
+};
+
+static const uint32_t opendyslexic_10_italicBlockOffsets[24] = {
+    0, 1222, 2391, 3654, 4784, 5618, 6583, 7454,
+    8406, 9499, 10441, 11392, 12379, 13641, 14881, 16186,
+    17445, 18739, 19950, 21166, 22257, 23554, 24841, 25588,
+};
+
+static const uint16_t opendyslexic_10_italicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_10_italicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_10_italicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
@@ -2894,695 +1783,695 @@ static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
     { 17, 18, 21, 0, 18, 77, 1780 }, // A
     { 16, 18, 17, 0, 18, 72, 1857 }, // B
     { 18, 20, 18, 1, 19, 90, 1929 }, // C
-    { 19, 18, 20, 0, 18, 86, 2019 }, // D
-    { 17, 18, 16, 0, 18, 77, 2105 }, // E
-    { 16, 18, 15, 0, 18, 72, 2182 }, // F
-    { 18, 19, 21, 1, 19, 86, 2254 }, // G
-    { 20, 18, 19, 0, 18, 90, 2340 }, // H
-    { 9, 18, 9, 0, 18, 41, 2430 }, // I
-    { 15, 24, 13, -1, 19, 90, 2471 }, // J
-    { 17, 18, 18, 0, 18, 77, 2561 }, // K
-    { 13, 18, 16, 0, 18, 59, 2638 }, // L
-    { 23, 18, 23, 0, 18, 104, 2697 }, // M
-    { 21, 18, 20, 0, 18, 95, 2801 }, // N
-    { 21, 19, 21, 1, 18, 100, 2896 }, // O
-    { 17, 18, 17, 0, 18, 77, 2996 }, // P
-    { 20, 21, 22, 1, 18, 105, 3073 }, // Q
-    { 16, 18, 17, 0, 18, 72, 3178 }, // R
-    { 18, 19, 20, 1, 18, 86, 3250 }, // S
-    { 17, 18, 20, 4, 18, 77, 3336 }, // T
-    { 19, 19, 19, 1, 18, 91, 3413 }, // U
-    { 17, 18, 21, 5, 18, 77, 3504 }, // V
-    { 24, 18, 27, 4, 18, 108, 3581 }, // W
-    { 21, 18, 21, 0, 18, 95, 3689 }, // X
-    { 15, 18, 19, 5, 18, 68, 3784 }, // Y
-    { 21, 18, 21, 0, 18, 95, 3852 }, // Z
-    { 16, 29, 10, -1, 22, 116, 3947 }, // [
-    { 4, 20, 10, 5, 16, 20, 4063 }, // <backslash>
-    { 15, 29, 10, -5, 22, 109, 4083 }, // ]
-    { 9, 5, 12, 4, 19, 12, 4192 }, // ^
-    { 15, 3, 17, 0, -2, 12, 4204 }, // _
-    { 6, 4, 9, 5, 16, 6, 4216 }, // `
-    { 14, 13, 16, 0, 13, 46, 4222 }, // a
-    { 13, 19, 17, 2, 18, 62, 4268 }, // b
-    { 11, 14, 14, 1, 13, 39, 4330 }, // c
-    { 16, 19, 16, 1, 18, 76, 4369 }, // d
-    { 13, 13, 16, 1, 13, 43, 4445 }, // e
-    { 10, 17, 12, 2, 17, 43, 4488 }, // f
-    { 15, 17, 15, 0, 12, 64, 4531 }, // g
-    { 14, 18, 16, 0, 18, 63, 4595 }, // h
-    { 9, 18, 8, 0, 18, 41, 4658 }, // i
-    { 13, 24, 13, 2, 18, 78, 4699 }, // j
-    { 12, 17, 16, 0, 17, 51, 4777 }, // k
-    { 8, 17, 10, 1, 17, 34, 4828 }, // l
-    { 22, 12, 23, 0, 12, 66, 4862 }, // m
-    { 14, 12, 16, 0, 12, 42, 4928 }, // n
-    { 14, 12, 16, 1, 12, 42, 4970 }, // o
-    { 17, 18, 17, -1, 12, 77, 5012 }, // p
-    { 15, 18, 18, 1, 13, 68, 5089 }, // q
-    { 11, 12, 12, 0, 12, 33, 5157 }, // r
-    { 12, 12, 15, 1, 12, 36, 5190 }, // s
-    { 10, 16, 14, 3, 16, 40, 5226 }, // t
-    { 13, 12, 15, 1, 12, 39, 5266 }, // u
-    { 14, 12, 17, 3, 12, 42, 5305 }, // v
-    { 17, 12, 20, 3, 12, 51, 5347 }, // w
-    { 16, 12, 17, 0, 12, 48, 5398 }, // x
-    { 16, 18, 16, 0, 12, 72, 5446 }, // y
-    { 15, 12, 16, 0, 12, 45, 5518 }, // z
-    { 13, 20, 12, 2, 16, 65, 5563 }, // {
-    { 8, 18, 5, 0, 15, 36, 5628 }, // |
-    { 12, 20, 13, 0, 16, 60, 5664 }, // }
-    { 9, 5, 12, 4, 16, 12, 5724 }, // ~
-    { 0, 0, 18, 0, 0, 0, 5736 }, //  
-    { 8, 22, 9, 2, 16, 44, 5736 }, // ¡
-    { 11, 19, 14, 1, 16, 53, 5780 }, // ¢
-    { 17, 20, 14, 0, 20, 85, 5833 }, // £
-    { 13, 11, 14, 2, 13, 36, 5918 }, // ¤
-    { 16, 18, 16, 3, 16, 72, 5954 }, // ¥
-    { 8, 18, 5, 0, 15, 36, 6026 }, // ¦
-    { 16, 18, 17, 1, 16, 72, 6062 }, // §
-    { 10, 4, 11, 4, 16, 10, 6134 }, // ¨
-    { 10, 8, 11, 5, 19, 20, 6144 }, // ©
-    { 8, 8, 9, 3, 16, 16, 6164 }, // ª
-    { 14, 10, 17, 2, 10, 35, 6180 }, // «
-    { 10, 6, 13, 3, 7, 15, 6215 }, // ¬
-    { 10, 3, 11, 3, 8, 8, 6230 }, // ­
-    { 10, 8, 11, 5, 22, 20, 6238 }, // ®
-    { 8, 3, 11, 5, 15, 6, 6258 }, // ¯
-    { 11, 10, 11, 3, 17, 28, 6264 }, // °
-    { 13, 13, 15, 0, 12, 43, 6292 }, // ±
-    { 7, 8, 6, 2, 17, 14, 6335 }, // ²
-    { 8, 8, 7, 2, 17, 16, 6349 }, // ³
-    { 6, 5, 6, 4, 17, 8, 6365 }, // ´
-    { 15, 14, 15, -1, 12, 53, 6373 }, // µ
-    { 14, 17, 13, 1, 15, 60, 6426 }, // ¶
-    { 5, 4, 5, 2, 9, 5, 6486 }, // ·
-    { 6, 6, 7, 0, 1, 9, 6491 }, // ¸
-    { 6, 9, 6, 2, 18, 14, 6500 }, // ¹
-    { 8, 7, 9, 3, 15, 14, 6514 }, // º
-    { 15, 10, 13, -3, 10, 38, 6528 }, // »
-    { 17, 20, 23, 5, 19, 85, 6566 }, // ¼
-    { 18, 20, 23, 5, 18, 90, 6651 }, // ½
-    { 18, 19, 23, 4, 18, 86, 6741 }, // ¾
-    { 14, 23, 12, -2, 12, 81, 6827 }, // ¿
-    { 17, 24, 21, 0, 24, 102, 6908 }, // À
-    { 19, 27, 21, 0, 27, 129, 7010 }, // Á
-    { 19, 23, 21, 0, 23, 110, 7139 }, // Â
-    { 19, 24, 21, 0, 24, 114, 7249 }, // Ã
-    { 20, 24, 21, 0, 24, 120, 7363 }, // Ä
-    { 18, 25, 21, 0, 25, 113, 7483 }, // Å
-    { 28, 19, 30, 0, 18, 133, 7596 }, // Æ
-    { 18, 24, 18, 1, 19, 108, 7729 }, // Ç
-    { 17, 23, 16, 0, 23, 98, 7837 }, // È
-    { 17, 27, 16, 0, 27, 115, 7935 }, // É
-    { 17, 23, 16, 0, 23, 98, 8050 }, // Ê
-    { 18, 24, 16, 0, 24, 108, 8148 }, // Ë
-    { 11, 25, 9, 0, 25, 69, 8256 }, // Ì
-    { 13, 29, 9, 0, 29, 95, 8325 }, // Í
-    { 13, 25, 9, 0, 25, 82, 8420 }, // Î
-    { 14, 25, 9, 0, 25, 88, 8502 }, // Ï
-    { 19, 18, 20, 0, 18, 86, 8590 }, // Ð
-    { 21, 23, 20, 0, 23, 121, 8676 }, // Ñ
-    { 21, 25, 21, 1, 24, 132, 8797 }, // Ò
-    { 21, 29, 21, 1, 28, 153, 8929 }, // Ó
-    { 21, 24, 21, 1, 23, 126, 9082 }, // Ô
-    { 21, 25, 21, 1, 24, 132, 9208 }, // Õ
-    { 21, 25, 21, 1, 24, 132, 9340 }, // Ö
-    { 10, 6, 12, 2, 8, 15, 9472 }, // ×
-    { 37, 34, 21, -8, 26, 315, 9487 }, // Ø
-    { 19, 25, 19, 1, 24, 119, 9802 }, // Ù
-    { 19, 28, 19, 1, 27, 133, 9921 }, // Ú
-    { 19, 25, 19, 1, 24, 119, 10054 }, // Û
-    { 19, 25, 19, 1, 24, 119, 10173 }, // Ü
-    { 15, 28, 19, 5, 28, 105, 10292 }, // Ý
-    { 13, 17, 12, 1, 17, 56, 10397 }, // Þ
-    { 15, 17, 14, 1, 17, 64, 10453 }, // ß
-    { 14, 17, 16, 0, 17, 60, 10517 }, // à
-    { 14, 21, 16, 0, 21, 74, 10577 }, // á
-    { 15, 17, 16, 0, 17, 64, 10651 }, // â
-    { 14, 17, 16, 0, 17, 60, 10715 }, // ã
-    { 15, 17, 16, 0, 17, 64, 10775 }, // ä
-    { 14, 18, 16, 0, 18, 63, 10839 }, // å
-    { 23, 13, 26, 0, 13, 75, 10902 }, // æ
-    { 11, 18, 14, 1, 13, 50, 10977 }, // ç
-    { 13, 19, 16, 1, 19, 62, 11027 }, // è
-    { 14, 23, 16, 1, 23, 81, 11089 }, // é
-    { 14, 19, 16, 1, 19, 67, 11170 }, // ê
-    { 15, 20, 16, 1, 20, 75, 11237 }, // ë
-    { 9, 18, 8, 0, 18, 41, 11312 }, // ì
-    { 11, 21, 8, 0, 21, 58, 11353 }, // í
-    { 11, 17, 8, 0, 17, 47, 11411 }, // î
-    { 11, 18, 8, 0, 18, 50, 11458 }, // ï
-    { 18, 17, 17, 2, 17, 77, 11508 }, // ð
-    { 16, 18, 16, 0, 18, 72, 11585 }, // ñ
-    { 14, 19, 16, 1, 19, 67, 11657 }, // ò
-    { 14, 23, 16, 1, 23, 81, 11724 }, // ó
-    { 14, 19, 16, 1, 19, 67, 11805 }, // ô
-    { 14, 19, 16, 1, 19, 67, 11872 }, // õ
-    { 15, 19, 16, 1, 19, 72, 11939 }, // ö
-    { 14, 13, 16, 3, 13, 46, 12011 }, // ÷
-    { 21, 33, 16, -3, 22, 174, 12057 }, // ø
-    { 13, 18, 15, 1, 18, 59, 12231 }, // ù
-    { 13, 22, 15, 1, 22, 72, 12290 }, // ú
-    { 13, 17, 15, 1, 17, 56, 12362 }, // û
-    { 14, 18, 15, 1, 18, 63, 12418 }, // ü
-    { 16, 29, 16, 0, 23, 116, 12481 }, // ý
-    { 13, 21, 12, 0, 17, 69, 12597 }, // þ
-    { 16, 26, 16, 0, 20, 104, 12666 }, // ÿ
-    { 20, 23, 21, 0, 23, 115, 12770 }, // Ā
-    { 15, 16, 16, 0, 16, 60, 12885 }, // ā
-    { 20, 26, 21, 0, 26, 130, 12945 }, // Ă
-    { 15, 19, 16, 0, 19, 72, 13075 }, // ă
-    { 17, 23, 21, 0, 18, 98, 13147 }, // Ą
-    { 14, 17, 16, 0, 13, 60, 13245 }, // ą
-    { 18, 29, 18, 1, 28, 131, 13305 }, // Ć
-    { 13, 21, 14, 1, 20, 69, 13436 }, // ć
-    { 18, 27, 18, 1, 26, 122, 13505 }, // Ĉ
-    { 14, 19, 14, 1, 18, 67, 13627 }, // ĉ
-    { 18, 27, 18, 1, 26, 122, 13694 }, // Ċ
-    { 11, 20, 14, 1, 19, 55, 13816 }, // ċ
-    { 18, 28, 18, 1, 27, 126, 13871 }, // Č
-    { 13, 21, 14, 1, 20, 69, 13997 }, // č
-    { 19, 26, 20, 0, 26, 124, 14066 }, // Ď
-    { 20, 19, 16, 1, 18, 95, 14190 }, // ď
-    { 19, 18, 20, 0, 18, 86, 14285 }, // Đ
-    { 19, 19, 16, 1, 18, 91, 14371 }, // đ
-    { 18, 23, 16, 0, 23, 104, 14462 }, // Ē
-    { 15, 19, 16, 1, 19, 72, 14566 }, // ē
-    { 18, 26, 16, 0, 26, 117, 14638 }, // Ĕ
-    { 15, 22, 16, 1, 22, 83, 14755 }, // ĕ
-    { 17, 25, 16, 0, 25, 107, 14838 }, // Ė
-    { 13, 21, 16, 1, 21, 69, 14945 }, // ė
-    { 17, 23, 16, 0, 18, 98, 15014 }, // Ę
-    { 13, 19, 16, 1, 13, 62, 15112 }, // ę
-    { 17, 25, 16, 0, 25, 107, 15174 }, // Ě
-    { 14, 22, 16, 1, 22, 77, 15281 }, // ě
-    { 19, 24, 21, 1, 24, 114, 15358 }, // Ĝ
-    { 16, 23, 15, 0, 18, 92, 15472 }, // ĝ
-    { 19, 26, 21, 1, 26, 124, 15564 }, // Ğ
-    { 15, 25, 15, 0, 20, 94, 15688 }, // ğ
-    { 18, 25, 21, 1, 25, 113, 15782 }, // Ġ
-    { 15, 24, 15, 0, 19, 90, 15895 }, // ġ
-    { 18, 28, 21, 1, 19, 126, 15985 }, // Ģ
-    { 15, 25, 15, 0, 20, 94, 16111 }, // ģ
-    { 20, 24, 19, 0, 24, 120, 16205 }, // Ĥ
-    { 14, 23, 16, 0, 23, 81, 16325 }, // ĥ
-    { 20, 18, 19, 0, 18, 90, 16406 }, // Ħ
-    { 14, 18, 16, 0, 18, 63, 16496 }, // ħ
-    { 13, 26, 9, 0, 26, 85, 16559 }, // Ĩ
-    { 11, 18, 8, 0, 18, 50, 16644 }, // ĩ
-    { 14, 24, 9, 0, 24, 84, 16694 }, // Ī
-    { 11, 17, 8, 0, 17, 47, 16778 }, // ī
-    { 10, 23, 13, 2, 18, 58, 16825 }, // Į
-    { 10, 24, 8, -1, 19, 60, 16883 }, // į
-    { 11, 26, 9, 0, 26, 72, 16943 }, // İ
-    { 7, 12, 8, 0, 12, 21, 17015 }, // ı
-    { 17, 23, 19, 0, 18, 98, 17036 }, // Ĳ
-    { 20, 24, 8, 0, 18, 120, 17134 }, // ĳ
-    { 18, 29, 13, -1, 24, 131, 17254 }, // Ĵ
-    { 17, 24, 13, 2, 18, 102, 17385 }, // ĵ
-    { 17, 25, 18, 0, 18, 107, 17487 }, // Ķ
-    { 12, 26, 16, 0, 17, 78, 17594 }, // ķ
-    { 10, 12, 12, 0, 12, 30, 17672 }, // ĸ
-    { 13, 25, 16, 0, 25, 82, 17702 }, // Ĺ
-    { 12, 25, 10, 1, 25, 75, 17784 }, // ĺ
-    { 13, 27, 16, 0, 18, 88, 17859 }, // Ļ
-    { 9, 25, 10, 0, 17, 57, 17947 }, // ļ
-    { 15, 18, 16, 0, 18, 68, 18004 }, // Ľ
-    { 13, 18, 10, 1, 18, 59, 18072 }, // ľ
-    { 15, 18, 16, 0, 18, 68, 18131 }, // Ŀ
-    { 11, 17, 10, 1, 17, 47, 18199 }, // ŀ
-    { 29, 27, 16, -10, 22, 196, 18246 }, // Ł
-    { 20, 17, 10, -7, 17, 85, 18442 }, // ł
-    { 21, 25, 20, 0, 25, 132, 18527 }, // Ń
-    { 15, 20, 16, 0, 20, 75, 18659 }, // ń
-    { 21, 25, 20, 0, 18, 132, 18734 }, // Ņ
-    { 14, 19, 16, 0, 12, 67, 18866 }, // ņ
-    { 21, 25, 20, 0, 25, 132, 18933 }, // Ň
-    { 15, 20, 16, 0, 20, 75, 19065 }, // ň
-    { 14, 22, 14, -2, 22, 77, 19140 }, // ŉ
-    { 21, 23, 20, 0, 18, 121, 19217 }, // Ŋ
-    { 14, 16, 16, 0, 12, 56, 19338 }, // ŋ
-    { 21, 24, 21, 1, 23, 126, 19394 }, // Ō
-    { 15, 18, 16, 1, 18, 68, 19520 }, // ō
-    { 21, 27, 21, 1, 26, 142, 19588 }, // Ŏ
-    { 15, 22, 16, 1, 22, 83, 19730 }, // ŏ
-    { 21, 26, 21, 1, 25, 137, 19813 }, // Ő
-    { 17, 20, 16, 1, 20, 85, 19950 }, // ő
-    { 28, 19, 25, 1, 19, 133, 20035 }, // Œ
-    { 22, 13, 22, 1, 13, 72, 20168 }, // œ
-    { 16, 25, 17, 0, 25, 100, 20240 }, // Ŕ
-    { 11, 18, 12, 0, 18, 50, 20340 }, // ŕ
-    { 16, 28, 17, 0, 18, 112, 20390 }, // Ŗ
-    { 12, 23, 12, -1, 12, 69, 20502 }, // ŗ
-    { 16, 25, 17, 0, 25, 100, 20571 }, // Ř
-    { 12, 18, 12, 0, 18, 54, 20671 }, // ř
-    { 18, 28, 20, 1, 27, 126, 20725 }, // Ś
-    { 12, 20, 15, 1, 20, 60, 20851 }, // ś
-    { 19, 26, 20, 1, 25, 124, 20911 }, // Ŝ
-    { 13, 18, 15, 1, 18, 59, 21035 }, // ŝ
-    { 18, 23, 20, 1, 18, 104, 21094 }, // Ş
-    { 12, 18, 15, 1, 12, 54, 21198 }, // ş
-    { 18, 27, 20, 1, 26, 122, 21252 }, // Š
-    { 12, 20, 15, 1, 20, 60, 21374 }, // š
-    { 17, 22, 20, 4, 18, 94, 21434 }, // Ţ
-    { 10, 20, 14, 3, 16, 50, 21528 }, // ţ
-    { 17, 24, 20, 4, 24, 102, 21578 }, // Ť
-    { 12, 18, 14, 3, 18, 54, 21680 }, // ť
-    { 17, 18, 20, 4, 18, 77, 21734 }, // Ŧ
-    { 12, 16, 14, 1, 16, 48, 21811 }, // ŧ
-    { 19, 26, 19, 1, 25, 124, 21859 }, // Ũ
-    { 13, 19, 15, 1, 19, 62, 21983 }, // ũ
-    { 19, 24, 19, 1, 23, 114, 22045 }, // Ū
-    { 14, 17, 15, 1, 17, 60, 22159 }, // ū
-    { 19, 28, 19, 1, 27, 133, 22219 }, // Ŭ
-    { 14, 20, 15, 1, 20, 70, 22352 }, // ŭ
-    { 19, 27, 19, 1, 26, 129, 22422 }, // Ů
-    { 13, 20, 15, 1, 20, 65, 22551 }, // ů
-    { 20, 26, 19, 1, 25, 130, 22616 }, // Ű
-    { 16, 19, 15, 1, 19, 76, 22746 }, // ű
-    { 19, 23, 19, 1, 18, 110, 22822 }, // Ų
-    { 13, 17, 15, 1, 12, 56, 22932 }, // ų
-    { 24, 23, 27, 4, 23, 138, 22988 }, // Ŵ
-    { 17, 18, 20, 3, 18, 77, 23126 }, // ŵ
-    { 15, 24, 19, 5, 24, 90, 23203 }, // Ŷ
-    { 16, 25, 16, 0, 19, 100, 23293 }, // ŷ
-    { 15, 25, 19, 5, 25, 94, 23393 }, // Ÿ
-    { 21, 25, 21, 0, 25, 132, 23487 }, // Ź
-    { 15, 20, 16, 0, 20, 75, 23619 }, // ź
-    { 21, 24, 21, 0, 24, 126, 23694 }, // Ż
-    { 15, 19, 16, 0, 19, 72, 23820 }, // ż
-    { 21, 25, 21, 0, 25, 132, 23892 }, // Ž
-    { 15, 20, 16, 0, 20, 75, 24024 }, // ž
-    { 11, 17, 11, 3, 17, 47, 24099 }, // ſ
-    { 6, 4, 0, 5, 16, 6, 24146 }, // ̀
-    { 6, 5, 0, 4, 17, 8, 24152 }, // ́
-    { 10, 5, 0, -1, 1, 13, 24160 }, // ̂
-    { 9, 5, 0, 4, 16, 12, 24173 }, // ̃
-    { 10, 3, 0, 4, 14, 8, 24185 }, // ̄
-    { 14, 3, 0, 6, 18, 11, 24193 }, // ̅
-    { 10, 5, 0, 4, 16, 13, 24204 }, // ̆
-    { 5, 4, 0, 4, 16, 5, 24217 }, // ̇
-    { 10, 4, 0, 4, 16, 10, 24222 }, // ̈
-    { 6, 4, 0, 3, 13, 6, 24232 }, // ̉
-    { 6, 5, 0, 4, 16, 8, 24238 }, // ̊
-    { 15, 4, 0, 4, 16, 15, 24246 }, // ̋
-    { 9, 5, 0, 4, 16, 12, 24261 }, // ̌
-    { 15, 4, 0, -7, 17, 15, 24273 }, // ̏
-    { 7, 6, 0, 3, 16, 11, 24288 }, // ̒
-    { 7, 6, 0, 3, 15, 11, 24299 }, // ̓
-    { 8, 6, 0, -4, 15, 12, 24310 }, // ̔
-    { 5, 5, 0, 0, -1, 7, 24322 }, // ̘
-    { 5, 5, 0, 1, -1, 7, 24329 }, // ̙
-    { 9, 5, 0, 5, 17, 12, 24336 }, // ̚
-    { 4, 5, 0, 4, 14, 5, 24348 }, // ̛
-    { 4, 5, 0, 0, -1, 5, 24353 }, // ̜
-    { 5, 4, 0, 2, 3, 5, 24358 }, // ̝
-    { 5, 4, 0, 0, -1, 5, 24363 }, // ̞
-    { 5, 5, 0, 0, -2, 7, 24368 }, // ̟
-    { 10, 3, 0, 0, -3, 8, 24375 }, // ̠
-    { 5, 4, 0, 0, 1, 5, 24383 }, // ̣
-    { 11, 4, 0, -1, 0, 11, 24388 }, // ̤
-    { 6, 5, 0, 4, 16, 8, 24399 }, // ̥
-    { 7, 6, 0, 0, 3, 11, 24407 }, // ̦
-    { 6, 6, 0, 0, 1, 9, 24418 }, // ̧
-    { 6, 6, 0, 0, 1, 9, 24427 }, // ̨
-    { 5, 6, 0, -1, -1, 8, 24436 }, // ̩
-    { 8, 4, 0, 0, -1, 8, 24444 }, // ̪
-    { 9, 5, 0, 0, 0, 12, 24452 }, // ̬
-    { 9, 5, 0, -1, -1, 12, 24464 }, // ̭
-    { 9, 5, 0, 4, 16, 12, 24476 }, // ̰
-    { 8, 3, 0, 5, 15, 6, 24488 }, // ̱
-    { 9, 3, 0, 0, -1, 7, 24494 }, // ̲
-    { 9, 5, 0, 4, 16, 12, 24501 }, // ̴
-    { 10, 3, 0, 3, 8, 8, 24513 }, // ̵
-    { 3, 5, 0, 2, -1, 4, 24521 }, // ̹
-    { 7, 4, 0, -1, -1, 7, 24525 }, // ̺
-    { 8, 5, 0, 0, 0, 10, 24532 }, // ̻
-    { 8, 4, 0, 0, 0, 8, 24542 }, // ̼
-    { 6, 5, 0, 4, 16, 8, 24550 }, // ̽
-    { 9, 5, 0, 4, 16, 12, 24558 }, // ͂
-    { 4, 4, 0, 4, 17, 4, 24570 }, // ̓
-    { 10, 10, 0, 4, 22, 25, 24574 }, // ̈́
-    { 7, 4, 0, 5, 16, 7, 24599 }, // ͆
-    { 12, 8, 0, -1, 0, 24, 24606 }, // ͇
-    { 9, 6, 0, 0, 0, 14, 24630 }, // ͈
-    { 7, 6, 0, 0, -1, 11, 24644 }, // ͉
-    { 10, 13, 0, 4, 20, 33, 24655 }, // ͊
-    { 20, 10, 0, 7, 19, 50, 24688 }, // ͋
-    { 15, 11, 0, 4, 11, 42, 24738 }, // ͌
-    { 11, 7, 0, 1, 0, 20, 24780 }, // ͍
-    { 3, 3, 0, 3, 2, 3, 24800 }, // ͎
-    { 17, 4, 0, 1, 0, 17, 24803 }, // ͜
-    { 18, 4, 0, 4, 16, 18, 24820 }, // ͡
-    { 21, 5, 0, 0, -1, 27, 24838 }, // ͢
-    { 15, 21, 13, 1, 21, 79, 24865 }, // Ѐ
-    { 15, 20, 13, 1, 20, 75, 24944 }, // Ё
-    { 15, 17, 21, 7, 17, 64, 25019 }, // Ђ
-    { 15, 24, 14, 1, 24, 90, 25083 }, // Ѓ
-    { 17, 17, 19, 1, 16, 73, 25173 }, // Є
-    { 18, 19, 20, 1, 18, 86, 25246 }, // Ѕ
-    { 9, 18, 9, 0, 18, 41, 25332 }, // І
-    { 13, 26, 9, 0, 26, 85, 25373 }, // Ї
-    { 15, 24, 13, -1, 19, 90, 25458 }, // Ј
-    { 22, 16, 24, 2, 15, 88, 25548 }, // Љ
-    { 21, 17, 23, 2, 16, 90, 25636 }, // Њ
-    { 17, 18, 20, 4, 18, 77, 25726 }, // Ћ
-    { 19, 25, 18, 0, 25, 119, 25803 }, // Ќ
-    { 19, 23, 20, 1, 23, 110, 25922 }, // Ѝ
-    { 16, 25, 14, -1, 24, 100, 26032 }, // Ў
-    { 16, 19, 15, 1, 15, 76, 26132 }, // Џ
-    { 17, 18, 21, 0, 18, 77, 26208 }, // А
-    { 15, 16, 14, 2, 15, 60, 26285 }, // Б
-    { 14, 16, 14, 1, 15, 56, 26345 }, // В
-    { 15, 15, 14, 1, 15, 57, 26401 }, // Г
-    { 16, 18, 17, 2, 15, 72, 26458 }, // Д
-    { 15, 15, 13, 1, 15, 57, 26530 }, // Е
-    { 26, 18, 27, 0, 18, 117, 26587 }, // Ж
-    { 13, 17, 15, 1, 16, 56, 26704 }, // З
-    { 19, 18, 20, 1, 18, 86, 26760 }, // И
-    { 19, 24, 20, 1, 24, 114, 26846 }, // Й
-    { 17, 18, 18, 0, 18, 77, 26960 }, // К
-    { 16, 16, 16, 2, 15, 64, 27037 }, // Л
-    { 19, 15, 18, 1, 15, 72, 27101 }, // М
-    { 20, 18, 19, 0, 18, 90, 27173 }, // Н
-    { 21, 19, 21, 1, 18, 100, 27263 }, // О
-    { 16, 16, 14, 1, 16, 64, 27363 }, // П
-    { 17, 18, 17, 0, 18, 77, 27427 }, // Р
-    { 18, 20, 18, 1, 19, 90, 27504 }, // С
-    { 17, 18, 20, 4, 18, 77, 27594 }, // Т
-    { 16, 18, 14, -1, 17, 72, 27671 }, // У
-    { 17, 16, 18, 4, 16, 68, 27743 }, // Ф
-    { 21, 18, 21, 0, 18, 95, 27811 }, // Х
-    { 15, 19, 15, 1, 16, 72, 27906 }, // Ц
-    { 13, 16, 14, 3, 16, 52, 27978 }, // Ч
-    { 19, 16, 17, 1, 16, 76, 28030 }, // Ш
-    { 19, 20, 19, 1, 16, 95, 28106 }, // Щ
-    { 12, 17, 14, 2, 16, 51, 28201 }, // Ъ
-    { 21, 18, 23, 2, 17, 95, 28252 }, // Ы
-    { 12, 17, 14, 2, 16, 51, 28347 }, // Ь
-    { 18, 17, 19, 1, 16, 77, 28398 }, // Э
-    { 20, 17, 21, 2, 16, 85, 28475 }, // Ю
-    { 17, 18, 17, 0, 18, 77, 28560 }, // Я
-    { 14, 13, 16, 0, 13, 46, 28637 }, // а
-    { 15, 16, 15, 2, 16, 60, 28683 }, // б
-    { 12, 13, 13, 0, 13, 39, 28743 }, // в
-    { 13, 12, 12, 1, 12, 39, 28782 }, // г
-    { 14, 14, 16, 2, 12, 49, 28821 }, // д
-    { 13, 13, 16, 1, 13, 43, 28870 }, // е
-    { 22, 15, 22, 0, 15, 83, 28913 }, // ж
-    { 10, 11, 9, 0, 11, 28, 28996 }, // з
-    { 14, 12, 14, 1, 12, 42, 29024 }, // и
-    { 14, 16, 14, 1, 16, 56, 29066 }, // й
-    { 13, 13, 14, 0, 13, 43, 29122 }, // к
-    { 12, 12, 11, 0, 11, 36, 29165 }, // л
-    { 17, 14, 17, 0, 14, 60, 29201 }, // м
-    { 17, 13, 17, 0, 13, 56, 29261 }, // н
-    { 13, 14, 17, 2, 13, 46, 29317 }, // о
-    { 14, 12, 14, 1, 12, 42, 29363 }, // п
-    { 17, 18, 17, -1, 12, 77, 29405 }, // р
-    { 11, 14, 14, 1, 13, 39, 29482 }, // с
-    { 12, 12, 14, 4, 12, 36, 29521 }, // т
-    { 16, 18, 16, 0, 12, 72, 29557 }, // у
-    { 17, 17, 18, 2, 12, 73, 29629 }, // ф
-    { 15, 12, 15, 1, 12, 45, 29702 }, // х
-    { 13, 15, 15, 2, 12, 49, 29747 }, // ц
-    { 9, 11, 9, 2, 11, 25, 29796 }, // ч
-    { 18, 12, 17, 1, 12, 54, 29821 }, // ш
-    { 18, 16, 19, 1, 12, 72, 29875 }, // щ
-    { 12, 12, 16, 4, 11, 36, 29947 }, // ъ
-    { 17, 13, 17, 2, 12, 56, 29983 }, // ы
-    { 12, 13, 13, 1, 12, 39, 30039 }, // ь
-    { 12, 13, 13, 2, 12, 39, 30078 }, // э
-    { 17, 14, 17, 1, 13, 60, 30117 }, // ю
-    { 14, 12, 13, 1, 12, 42, 30177 }, // я
-    { 13, 20, 16, 1, 20, 65, 30219 }, // ѐ
-    { 14, 17, 14, 2, 16, 60, 30284 }, // ё
-    { 14, 22, 16, 0, 18, 77, 30344 }, // ђ
-    { 13, 18, 12, 1, 18, 59, 30421 }, // ѓ
-    { 12, 12, 13, 0, 11, 36, 30480 }, // є
-    { 12, 12, 15, 1, 12, 36, 30516 }, // ѕ
-    { 9, 18, 8, 0, 18, 41, 30552 }, // і
-    { 11, 18, 8, 0, 18, 50, 30593 }, // ї
-    { 13, 24, 13, 2, 18, 78, 30643 }, // ј
-    { 15, 12, 17, 1, 11, 45, 30721 }, // љ
-    { 15, 12, 16, 1, 11, 45, 30766 }, // њ
-    { 14, 18, 16, 0, 18, 63, 30811 }, // ћ
-    { 13, 19, 14, 0, 19, 62, 30874 }, // ќ
-    { 14, 17, 14, 1, 17, 60, 30936 }, // ѝ
-    { 16, 27, 16, 0, 21, 108, 30996 }, // ў
-    { 13, 14, 11, 0, 11, 46, 31104 }, // џ
-    { 12, 17, 17, 5, 16, 51, 31150 }, // Ѣ
-    { 11, 16, 15, 4, 15, 44, 31201 }, // ѣ
-    { 21, 15, 21, 2, 15, 79, 31245 }, // Ѫ
-    { 14, 12, 15, 1, 11, 42, 31324 }, // ѫ
-    { 18, 19, 20, 2, 19, 86, 31366 }, // Ѳ
-    { 15, 15, 16, 1, 15, 57, 31452 }, // ѳ
-    { 24, 22, 21, 5, 22, 132, 31509 }, // Ѵ
-    { 14, 14, 17, 3, 14, 49, 31641 }, // ѵ
-    { 9, 6, 0, 5, 19, 14, 31690 }, // ҆
-    { 16, 17, 14, 1, 17, 68, 31704 }, // Ґ
-    { 14, 15, 12, 1, 15, 53, 31772 }, // ґ
-    { 15, 15, 14, 1, 15, 57, 31825 }, // Ғ
-    { 11, 11, 9, 0, 11, 31, 31882 }, // ғ
-    { 17, 17, 14, 1, 17, 73, 31913 }, // Ҕ
-    { 9, 11, 9, 0, 11, 25, 31986 }, // ҕ
-    { 25, 21, 27, -1, 18, 132, 32011 }, // Җ
-    { 17, 15, 18, -1, 13, 64, 32143 }, // җ
-    { 13, 19, 15, 2, 16, 62, 32207 }, // Ҙ
-    { 10, 16, 9, 0, 11, 40, 32269 }, // ҙ
-    { 18, 21, 18, -1, 18, 95, 32309 }, // Қ
-    { 12, 15, 13, -1, 13, 45, 32404 }, // қ
-    { 18, 16, 20, 2, 16, 72, 32449 }, // Ҝ
-    { 14, 11, 15, 1, 11, 39, 32521 }, // ҝ
-    { 17, 18, 18, 0, 18, 77, 32560 }, // Ҟ
-    { 12, 17, 16, 0, 17, 51, 32637 }, // ҟ
-    { 18, 18, 18, -1, 18, 81, 32688 }, // Ҡ
-    { 12, 13, 13, -1, 13, 39, 32769 }, // ҡ
-    { 19, 21, 19, -1, 18, 100, 32808 }, // Ң
-    { 13, 15, 13, -1, 13, 49, 32908 }, // ң
-    { 27, 19, 19, 0, 19, 129, 32957 }, // Ҥ
-    { 18, 12, 13, 0, 12, 54, 33086 }, // ҥ
-    { 22, 17, 25, 2, 17, 94, 33140 }, // Ҧ
-    { 19, 20, 22, 2, 14, 95, 33234 }, // ҧ
-    { 20, 18, 25, 3, 17, 90, 33329 }, // Ҩ
-    { 16, 15, 19, 2, 14, 60, 33419 }, // ҩ
-    { 18, 23, 18, 1, 19, 104, 33479 }, // Ҫ
-    { 11, 16, 14, 1, 13, 44, 33583 }, // ҫ
-    { 16, 21, 20, 3, 18, 84, 33627 }, // Ҭ
-    { 12, 14, 13, 1, 12, 42, 33711 }, // ҭ
-    { 15, 18, 19, 5, 18, 68, 33753 }, // Ү
-    { 12, 15, 14, 4, 11, 45, 33821 }, // ү
-    { 16, 18, 19, 4, 18, 72, 33866 }, // Ұ
-    { 16, 16, 14, 0, 11, 64, 33938 }, // ұ
-    { 21, 21, 21, -1, 18, 111, 34002 }, // Ҳ
-    { 14, 15, 14, -1, 13, 53, 34113 }, // ҳ
-    { 16, 19, 22, 5, 15, 76, 34166 }, // Ҵ
-    { 12, 14, 16, 3, 11, 42, 34242 }, // ҵ
-    { 14, 20, 17, 3, 15, 70, 34284 }, // Ҷ
-    { 10, 15, 12, 2, 11, 38, 34354 }, // ҷ
-    { 14, 15, 15, 4, 15, 53, 34392 }, // Ҹ
-    { 10, 11, 10, 2, 11, 28, 34445 }, // ҹ
-    { 13, 17, 16, 2, 17, 56, 34473 }, // Һ
-    { 14, 18, 16, 0, 18, 63, 34529 }, // һ
-    { 18, 16, 20, 1, 15, 72, 34592 }, // Ҽ
-    { 13, 12, 15, 0, 12, 39, 34664 }, // ҽ
-    { 17, 18, 23, 4, 15, 77, 34703 }, // Ҿ
-    { 13, 14, 16, 2, 12, 46, 34780 }, // ҿ
-    { 9, 18, 9, 0, 18, 41, 34826 }, // Ӏ
-    { 26, 26, 27, 0, 26, 169, 34867 }, // Ӂ
-    { 22, 23, 22, 0, 23, 127, 35036 }, // ӂ
-    { 15, 21, 16, 2, 16, 79, 35163 }, // Ӄ
-    { 10, 15, 11, 1, 11, 38, 35242 }, // ӄ
-    { 16, 19, 16, 2, 15, 76, 35280 }, // Ӆ
-    { 12, 14, 11, 0, 11, 42, 35356 }, // ӆ
-    { 20, 23, 19, 0, 18, 115, 35398 }, // Ӈ
-    { 13, 17, 13, 0, 13, 56, 35513 }, // ӈ
-    { 20, 24, 19, 0, 18, 120, 35569 }, // Ӊ
-    { 13, 17, 13, 0, 13, 56, 35689 }, // ӊ
-    { 13, 19, 14, 3, 15, 62, 35745 }, // Ӌ
-    { 9, 14, 10, 2, 11, 32, 35807 }, // ӌ
-    { 23, 24, 26, 0, 18, 138, 35839 }, // Ӎ
-    { 15, 17, 18, 0, 13, 64, 35977 }, // ӎ
-    { 6, 15, 6, 2, 15, 23, 36041 }, // ӏ
-    { 20, 26, 21, 0, 26, 130, 36064 }, // Ӑ
-    { 18, 20, 16, 0, 20, 90, 36194 }, // ӑ
-    { 20, 24, 21, 0, 24, 120, 36284 }, // Ӓ
-    { 18, 18, 16, 0, 18, 81, 36404 }, // ӓ
-    { 28, 19, 30, 0, 18, 133, 36485 }, // Ӕ
-    { 23, 13, 26, 0, 13, 75, 36618 }, // ӕ
-    { 15, 23, 13, 1, 23, 87, 36693 }, // Ӗ
-    { 15, 21, 16, 1, 21, 79, 36780 }, // ӗ
-    { 14, 13, 16, 1, 12, 46, 36859 }, // Ә
-    { 13, 14, 17, 7, 13, 46, 36905 }, // ә
-    { 17, 22, 16, 1, 21, 94, 36951 }, // Ӛ
-    { 14, 15, 17, 6, 13, 53, 37045 }, // ӛ
-    { 26, 24, 27, 0, 24, 156, 37098 }, // Ӝ
-    { 22, 21, 22, 0, 21, 116, 37254 }, // ӝ
-    { 15, 23, 15, 1, 22, 87, 37370 }, // Ӟ
-    { 15, 17, 9, 0, 17, 64, 37457 }, // ӟ
-    { 12, 15, 12, 2, 15, 45, 37521 }, // Ӡ
-    { 12, 15, 12, 1, 11, 45, 37566 }, // ӡ
-    { 19, 21, 20, 1, 21, 100, 37611 }, // Ӣ
-    { 15, 16, 14, 1, 16, 60, 37711 }, // ӣ
-    { 19, 22, 20, 1, 22, 105, 37771 }, // Ӥ
-    { 15, 17, 14, 1, 17, 64, 37876 }, // ӥ
-    { 21, 25, 21, 1, 24, 132, 37940 }, // Ӧ
-    { 14, 19, 17, 2, 18, 67, 38072 }, // ӧ
-    { 17, 16, 21, 2, 15, 68, 38139 }, // Ө
-    { 14, 12, 16, 1, 12, 42, 38207 }, // ө
-    { 17, 25, 21, 2, 24, 107, 38249 }, // Ӫ
-    { 15, 20, 16, 1, 20, 75, 38356 }, // ӫ
-    { 18, 23, 19, 1, 22, 104, 38431 }, // Ӭ
-    { 13, 18, 13, 2, 17, 59, 38535 }, // ӭ
-    { 16, 22, 14, -1, 21, 88, 38594 }, // Ӯ
-    { 16, 25, 16, 0, 19, 100, 38682 }, // ӯ
-    { 16, 23, 14, -1, 22, 92, 38782 }, // Ӱ
-    { 16, 26, 16, 0, 20, 104, 38874 }, // ӱ
-    { 18, 24, 14, -1, 23, 108, 38978 }, // Ӳ
-    { 19, 26, 16, 0, 20, 124, 39086 }, // ӳ
-    { 14, 22, 14, 3, 22, 77, 39210 }, // Ӵ
-    { 11, 17, 9, 2, 17, 47, 39287 }, // ӵ
-    { 15, 18, 14, 1, 15, 68, 39334 }, // Ӷ
-    { 11, 13, 9, 0, 11, 36, 39402 }, // ӷ
-    { 21, 24, 23, 2, 23, 126, 39438 }, // Ӹ
-    { 17, 20, 17, 2, 19, 85, 39564 }, // ӹ
-    { 21, 22, 21, 0, 18, 116, 39649 }, // Ӽ
-    { 14, 15, 14, 0, 13, 53, 39765 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 39818 }, //  
-    { 0, 0, 28, 0, 0, 0, 39818 }, //  
-    { 0, 0, 17, 0, 0, 0, 39818 }, //  
-    { 0, 0, 28, 0, 0, 0, 39818 }, //  
-    { 0, 0, 14, 0, 0, 0, 39818 }, //  
-    { 0, 0, 12, 0, 0, 0, 39818 }, //  
-    { 0, 0, 10, 0, 0, 0, 39818 }, //  
-    { 0, 0, 14, 0, 0, 0, 39818 }, //  
-    { 0, 0, 5, 0, 0, 0, 39818 }, //  
-    { 0, 0, 11, 0, 0, 0, 39818 }, //  
-    { 0, 0, 10, 0, 0, 0, 39818 }, //  
-    { 0, 0, 7, 0, 0, 0, 39818 }, // ​
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‏
-    { 10, 3, 11, 3, 8, 8, 39818 }, // ‐
-    { 10, 3, 11, 3, 8, 8, 39826 }, // ‑
-    { 16, 3, 16, 3, 8, 12, 39834 }, // ‒
-    { 14, 3, 17, 3, 8, 11, 39846 }, // –
-    { 21, 3, 23, 3, 8, 16, 39857 }, // —
-    { 21, 3, 23, 3, 8, 16, 39873 }, // ―
-    { 14, 18, 11, 0, 15, 63, 39889 }, // ‖
-    { 17, 8, 16, 0, -1, 34, 39952 }, // ‗
-    { 7, 6, 7, 4, 18, 11, 39986 }, // ‘
-    { 7, 6, 7, 4, 18, 11, 39997 }, // ’
-    { 7, 6, 7, 0, 3, 11, 40008 }, // ‚
-    { 7, 6, 7, 4, 18, 11, 40019 }, // ‛
-    { 12, 6, 12, 4, 18, 18, 40030 }, // “
-    { 12, 6, 12, 4, 18, 18, 40048 }, // ”
-    { 7, 6, 7, 0, 3, 11, 40066 }, // „
-    { 12, 6, 12, 4, 18, 18, 40077 }, // ‟
-    { 12, 27, 12, 3, 21, 81, 40095 }, // †
-    { 14, 27, 13, 1, 21, 95, 40176 }, // ‡
-    { 14, 12, 11, 0, 14, 42, 40271 }, // •
-    { 7, 7, 8, 2, 9, 13, 40313 }, // ‣
-    { 4, 4, 5, 1, 4, 4, 40326 }, // ․
-    { 4, 4, 5, 1, 4, 4, 40330 }, // ‥
-    { 19, 4, 20, 1, 4, 19, 40334 }, // …
-    { 4, 3, 5, 1, 8, 3, 40353 }, // ‧
-    { 0, 0, 26, 0, 0, 0, 40356 }, //  
-    { 17, 18, 23, 5, 16, 77, 40356 }, // ‰
-    { 7, 6, 7, 4, 18, 11, 40433 }, // ′
-    { 12, 6, 12, 4, 18, 18, 40444 }, // ″
-    { 15, 7, 18, -2, 18, 27, 40462 }, // ‴
-    { 4, 7, 7, 5, 18, 7, 40489 }, // ‵
-    { 9, 7, 11, 4, 18, 16, 40496 }, // ‶
-    { 15, 7, 18, 5, 18, 27, 40512 }, // ‷
-    { 9, 4, 12, 5, 17, 9, 40539 }, // ‸
-    { 7, 10, 9, 3, 11, 18, 40548 }, // ‹
-    { 8, 10, 9, -2, 11, 20, 40566 }, // ›
-    { 27, 21, 28, 1, 19, 142, 40586 }, // ※
-    { 11, 21, 7, 0, 21, 58, 40728 }, // ‼
-    { 14, 26, 16, 4, 25, 91, 40786 }, // ‽
-    { 11, 3, 11, 5, 17, 9, 40877 }, // ‾
-    { 10, 4, 13, 4, 14, 10, 40886 }, // ‿
-    { 15, 14, 17, 3, 19, 53, 40896 }, // ⁂
-    { 17, 17, 23, 5, 16, 73, 40949 }, // ⁄
-    { 25, 24, 26, 5, 24, 150, 41022 }, // ⁇
-    { 18, 23, 21, 5, 23, 104, 41172 }, // ⁈
-    { 21, 25, 17, 0, 23, 132, 41276 }, // ⁉
-    { 21, 33, 15, -1, 23, 174, 41408 }, // ⁒
-    { 0, 0, 100, 0, 0, 0, 41582 }, //  
-    { 8, 8, 7, 2, 17, 16, 41582 }, // ⁰
-    { 6, 9, 7, 3, 18, 14, 41598 }, // ⁴
-    { 8, 9, 7, 2, 18, 18, 41612 }, // ⁵
-    { 8, 8, 7, 2, 17, 16, 41630 }, // ⁶
-    { 6, 9, 7, 4, 18, 14, 41646 }, // ⁷
-    { 8, 8, 7, 2, 17, 16, 41660 }, // ⁸
-    { 8, 8, 7, 2, 17, 16, 41676 }, // ⁹
-    { 14, 12, 16, 0, 12, 42, 41692 }, // ⁿ
-    { 10, 11, 9, 1, 11, 28, 41734 }, // ₀
-    { 6, 9, 6, -1, 5, 14, 41762 }, // ₁
-    { 7, 9, 7, -1, 5, 16, 41776 }, // ₂
-    { 7, 9, 7, -1, 5, 16, 41792 }, // ₃
-    { 7, 8, 7, -1, 5, 14, 41808 }, // ₄
-    { 7, 8, 6, -1, 5, 14, 41822 }, // ₅
-    { 7, 8, 7, -1, 4, 14, 41836 }, // ₆
-    { 6, 9, 7, 1, 5, 14, 41850 }, // ₇
-    { 8, 9, 7, -1, 5, 18, 41864 }, // ₈
-    { 8, 9, 7, -1, 5, 18, 41882 }, // ₉
-    { 12, 29, 9, 2, 21, 87, 41900 }, // ₍
-    { 12, 29, 9, -5, 21, 87, 41987 }, // ₎
-    { 20, 28, 18, 0, 23, 140, 42074 }, // ₡
-    { 18, 20, 18, 1, 19, 90, 42214 }, // ₢
-    { 17, 20, 14, 0, 20, 85, 42304 }, // ₤
-    { 21, 18, 20, 0, 18, 95, 42389 }, // ₦
-    { 18, 18, 17, 0, 18, 81, 42484 }, // ₧
-    { 24, 18, 24, 0, 18, 108, 42565 }, // ₨
-    { 18, 18, 16, -1, 18, 81, 42673 }, // ₩
-    { 20, 16, 22, 3, 16, 80, 42754 }, // ₪
-    { 15, 17, 14, 2, 17, 64, 42834 }, // ₫
-    { 16, 19, 17, 2, 16, 76, 42898 }, // €
-    { 17, 18, 20, 4, 18, 77, 42974 }, // ₮
-    { 21, 18, 13, 0, 18, 95, 43051 }, // ₱
-    { 18, 25, 21, 1, 22, 113, 43146 }, // ₲
-    { 23, 19, 19, 2, 18, 110, 43259 }, // ₴
-    { 11, 16, 14, 1, 15, 44, 43369 }, // ₵
-    { 19, 19, 20, 4, 19, 91, 43413 }, // ₸
-    { 12, 17, 13, 3, 16, 51, 43504 }, // ₹
-    { 13, 15, 14, 2, 14, 49, 43555 }, // ₺
-    { 16, 16, 13, 1, 16, 64, 43604 }, // ₼
-    { 19, 18, 17, -2, 18, 86, 43668 }, // ₽
-    { 13, 13, 16, -2, 10, 43, 43754 }, // ←
-    { 14, 13, 16, 3, 13, 46, 43797 }, // ↑
-    { 13, 13, 16, 5, 10, 43, 43843 }, // →
-    { 14, 13, 16, 6, 13, 46, 43886 }, // ↓
-    { 22, 11, 19, -1, 10, 61, 43932 }, // ↔
-    { 11, 22, 14, 3, 20, 61, 43993 }, // ↕
-    { 12, 9, 13, -2, 9, 27, 44054 }, // ↖
-    { 13, 9, 13, 3, 9, 30, 44081 }, // ↗
-    { 10, 13, 13, 5, 12, 33, 44111 }, // ↘
-    { 11, 13, 13, -2, 12, 36, 44144 }, // ↙
-    { 16, 13, 18, 0, 12, 52, 44180 }, // ⇐
-    { 17, 15, 19, 3, 15, 64, 44232 }, // ⇑
-    { 16, 13, 18, 2, 12, 52, 44296 }, // ⇒
-    { 17, 16, 19, 7, 15, 68, 44348 }, // ⇓
-    { 21, 13, 20, 0, 12, 69, 44416 }, // ⇔
-    { 13, 20, 16, 5, 13, 65, 44485 }, // ⇕
-    { 15, 17, 14, 2, 17, 64, 44550 }, // ∂
-    { 22, 20, 21, 0, 19, 110, 44614 }, // ∅
-    { 16, 16, 18, 1, 16, 64, 44724 }, // ∆
-    { 15, 15, 15, 3, 15, 57, 44788 }, // ∏
-    { 15, 15, 15, 7, 15, 57, 44845 }, // ∐
-    { 14, 16, 12, 1, 15, 56, 44902 }, // ∑
-    { 11, 3, 13, 2, 7, 9, 44958 }, // −
-    { 21, 18, 19, 2, 17, 95, 44967 }, // √
-    { 19, 11, 19, 2, 13, 53, 45062 }, // ∞
-    { 22, 24, 18, 0, 19, 132, 45115 }, // ∫
-    { 8, 13, 6, 0, 13, 26, 45247 }, // ∶
-    { 15, 11, 16, 4, 11, 42, 45273 }, // ≈
-    { 17, 18, 23, 5, 16, 77, 45315 }, // ≠
-    { 18, 16, 18, -1, 15, 72, 45392 }, // ≤
-    { 18, 16, 18, 1, 15, 72, 45464 }, // ≥
+    { 19, 18, 20, 0, 18, 86, 2048 }, // D
+    { 17, 18, 16, 0, 18, 77, 2134 }, // E
+    { 16, 18, 15, 0, 18, 72, 2211 }, // F
+    { 18, 19, 21, 1, 19, 86, 2283 }, // G
+    { 20, 18, 19, 0, 18, 90, 2369 }, // H
+    { 9, 18, 9, 0, 18, 41, 2459 }, // I
+    { 15, 24, 13, -1, 19, 90, 2500 }, // J
+    { 17, 18, 18, 0, 18, 77, 2590 }, // K
+    { 13, 18, 16, 0, 18, 59, 2667 }, // L
+    { 23, 18, 23, 0, 18, 104, 2726 }, // M
+    { 21, 18, 20, 0, 18, 95, 2830 }, // N
+    { 21, 19, 21, 1, 18, 100, 2925 }, // O
+    { 17, 18, 17, 0, 18, 77, 3025 }, // P
+    { 20, 21, 22, 1, 18, 105, 3102 }, // Q
+    { 16, 18, 17, 0, 18, 72, 3207 }, // R
+    { 18, 19, 20, 1, 18, 86, 3279 }, // S
+    { 17, 18, 20, 4, 18, 77, 3365 }, // T
+    { 19, 19, 19, 1, 18, 91, 3442 }, // U
+    { 17, 18, 21, 5, 18, 77, 3533 }, // V
+    { 24, 18, 27, 4, 18, 108, 3610 }, // W
+    { 21, 18, 21, 0, 18, 95, 3718 }, // X
+    { 15, 18, 19, 5, 18, 68, 3813 }, // Y
+    { 21, 18, 21, 0, 18, 95, 3881 }, // Z
+    { 16, 29, 10, -1, 22, 116, 3976 }, // [
+    { 4, 20, 10, 5, 16, 20, 4096 }, // <backslash>
+    { 15, 29, 10, -5, 22, 109, 4116 }, // ]
+    { 9, 5, 12, 4, 19, 12, 4225 }, // ^
+    { 15, 3, 17, 0, -2, 12, 4237 }, // _
+    { 6, 4, 9, 5, 16, 6, 4249 }, // `
+    { 14, 13, 16, 0, 13, 46, 4255 }, // a
+    { 13, 19, 17, 2, 18, 62, 4301 }, // b
+    { 11, 14, 14, 1, 13, 39, 4363 }, // c
+    { 16, 19, 16, 1, 18, 76, 4402 }, // d
+    { 13, 13, 16, 1, 13, 43, 4478 }, // e
+    { 10, 17, 12, 2, 17, 43, 4521 }, // f
+    { 15, 17, 15, 0, 12, 64, 4564 }, // g
+    { 14, 18, 16, 0, 18, 63, 4628 }, // h
+    { 9, 18, 8, 0, 18, 41, 4691 }, // i
+    { 13, 24, 13, 2, 18, 78, 4732 }, // j
+    { 12, 17, 16, 0, 17, 51, 4810 }, // k
+    { 8, 17, 10, 1, 17, 34, 4861 }, // l
+    { 22, 12, 23, 0, 12, 66, 4895 }, // m
+    { 14, 12, 16, 0, 12, 42, 4961 }, // n
+    { 14, 12, 16, 1, 12, 42, 5003 }, // o
+    { 17, 18, 17, -1, 12, 77, 5045 }, // p
+    { 15, 18, 18, 1, 13, 68, 5122 }, // q
+    { 11, 12, 12, 0, 12, 33, 5190 }, // r
+    { 12, 12, 15, 1, 12, 36, 5223 }, // s
+    { 10, 16, 14, 3, 16, 40, 5259 }, // t
+    { 13, 12, 15, 1, 12, 39, 5299 }, // u
+    { 14, 12, 17, 3, 12, 42, 5338 }, // v
+    { 17, 12, 20, 3, 12, 51, 5380 }, // w
+    { 16, 12, 17, 0, 12, 48, 5431 }, // x
+    { 16, 18, 16, 0, 12, 72, 5479 }, // y
+    { 15, 12, 16, 0, 12, 45, 5551 }, // z
+    { 13, 20, 12, 2, 16, 65, 5596 }, // {
+    { 8, 18, 5, 0, 15, 36, 5661 }, // |
+    { 12, 20, 13, 0, 16, 60, 5697 }, // }
+    { 9, 5, 12, 4, 16, 12, 5757 }, // ~
+    { 0, 0, 18, 0, 0, 0, 5769 }, //  
+    { 8, 22, 9, 2, 16, 44, 5769 }, // ¡
+    { 11, 19, 14, 1, 16, 53, 5813 }, // ¢
+    { 17, 20, 14, 0, 20, 85, 5866 }, // £
+    { 13, 11, 14, 2, 13, 36, 5951 }, // ¤
+    { 16, 18, 16, 3, 16, 72, 5987 }, // ¥
+    { 8, 18, 5, 0, 15, 36, 6059 }, // ¦
+    { 16, 18, 17, 1, 16, 72, 6144 }, // §
+    { 10, 4, 11, 4, 16, 10, 6216 }, // ¨
+    { 10, 8, 11, 5, 19, 20, 6226 }, // ©
+    { 8, 8, 9, 3, 16, 16, 6246 }, // ª
+    { 14, 10, 17, 2, 10, 35, 6262 }, // «
+    { 10, 6, 13, 3, 7, 15, 6297 }, // ¬
+    { 10, 3, 11, 3, 8, 8, 6312 }, // ­
+    { 10, 8, 11, 5, 22, 20, 6320 }, // ®
+    { 8, 3, 11, 5, 15, 6, 6340 }, // ¯
+    { 11, 10, 11, 3, 17, 28, 6346 }, // °
+    { 13, 13, 15, 0, 12, 43, 6374 }, // ±
+    { 7, 8, 6, 2, 17, 14, 6417 }, // ²
+    { 8, 8, 7, 2, 17, 16, 6431 }, // ³
+    { 6, 5, 6, 4, 17, 8, 6447 }, // ´
+    { 15, 14, 15, -1, 12, 53, 6455 }, // µ
+    { 14, 17, 13, 1, 15, 60, 6508 }, // ¶
+    { 5, 4, 5, 2, 9, 5, 6568 }, // ·
+    { 6, 6, 7, 0, 1, 9, 6573 }, // ¸
+    { 6, 9, 6, 2, 18, 14, 6582 }, // ¹
+    { 8, 7, 9, 3, 15, 14, 6596 }, // º
+    { 15, 10, 13, -3, 10, 38, 6610 }, // »
+    { 17, 20, 23, 5, 19, 85, 6648 }, // ¼
+    { 18, 20, 23, 5, 18, 90, 6733 }, // ½
+    { 18, 19, 23, 4, 18, 86, 6823 }, // ¾
+    { 14, 23, 12, -2, 12, 81, 6909 }, // ¿
+    { 17, 24, 21, 0, 24, 102, 6990 }, // À
+    { 19, 27, 21, 0, 27, 129, 7092 }, // Á
+    { 19, 23, 21, 0, 23, 110, 7221 }, // Â
+    { 19, 24, 21, 0, 24, 114, 7331 }, // Ã
+    { 20, 24, 21, 0, 24, 120, 7445 }, // Ä
+    { 18, 25, 21, 0, 25, 113, 7565 }, // Å
+    { 28, 19, 30, 0, 18, 133, 7678 }, // Æ
+    { 18, 24, 18, 1, 19, 108, 7811 }, // Ç
+    { 17, 23, 16, 0, 23, 98, 7919 }, // È
+    { 17, 27, 16, 0, 27, 115, 8017 }, // É
+    { 17, 23, 16, 0, 23, 98, 8192 }, // Ê
+    { 18, 24, 16, 0, 24, 108, 8290 }, // Ë
+    { 11, 25, 9, 0, 25, 69, 8398 }, // Ì
+    { 13, 29, 9, 0, 29, 95, 8467 }, // Í
+    { 13, 25, 9, 0, 25, 82, 8562 }, // Î
+    { 14, 25, 9, 0, 25, 88, 8644 }, // Ï
+    { 19, 18, 20, 0, 18, 86, 8732 }, // Ð
+    { 21, 23, 20, 0, 23, 121, 8818 }, // Ñ
+    { 21, 25, 21, 1, 24, 132, 8939 }, // Ò
+    { 21, 29, 21, 1, 28, 153, 9071 }, // Ó
+    { 21, 24, 21, 1, 23, 126, 9224 }, // Ô
+    { 21, 25, 21, 1, 24, 132, 9350 }, // Õ
+    { 21, 25, 21, 1, 24, 132, 9482 }, // Ö
+    { 10, 6, 12, 2, 8, 15, 9614 }, // ×
+    { 37, 34, 21, -8, 26, 315, 9629 }, // Ø
+    { 19, 25, 19, 1, 24, 119, 9944 }, // Ù
+    { 19, 28, 19, 1, 27, 133, 10063 }, // Ú
+    { 19, 25, 19, 1, 24, 119, 10240 }, // Û
+    { 19, 25, 19, 1, 24, 119, 10359 }, // Ü
+    { 15, 28, 19, 5, 28, 105, 10478 }, // Ý
+    { 13, 17, 12, 1, 17, 56, 10583 }, // Þ
+    { 15, 17, 14, 1, 17, 64, 10639 }, // ß
+    { 14, 17, 16, 0, 17, 60, 10703 }, // à
+    { 14, 21, 16, 0, 21, 74, 10763 }, // á
+    { 15, 17, 16, 0, 17, 64, 10837 }, // â
+    { 14, 17, 16, 0, 17, 60, 10901 }, // ã
+    { 15, 17, 16, 0, 17, 64, 10961 }, // ä
+    { 14, 18, 16, 0, 18, 63, 11025 }, // å
+    { 23, 13, 26, 0, 13, 75, 11088 }, // æ
+    { 11, 18, 14, 1, 13, 50, 11163 }, // ç
+    { 13, 19, 16, 1, 19, 62, 11213 }, // è
+    { 14, 23, 16, 1, 23, 81, 11275 }, // é
+    { 14, 19, 16, 1, 19, 67, 11356 }, // ê
+    { 15, 20, 16, 1, 20, 75, 11423 }, // ë
+    { 9, 18, 8, 0, 18, 41, 11498 }, // ì
+    { 11, 21, 8, 0, 21, 58, 11539 }, // í
+    { 11, 17, 8, 0, 17, 47, 11597 }, // î
+    { 11, 18, 8, 0, 18, 50, 11644 }, // ï
+    { 18, 17, 17, 2, 17, 77, 11694 }, // ð
+    { 16, 18, 16, 0, 18, 72, 11771 }, // ñ
+    { 14, 19, 16, 1, 19, 67, 11843 }, // ò
+    { 14, 23, 16, 1, 23, 81, 11910 }, // ó
+    { 14, 19, 16, 1, 19, 67, 11991 }, // ô
+    { 14, 19, 16, 1, 19, 67, 12058 }, // õ
+    { 15, 19, 16, 1, 19, 72, 12125 }, // ö
+    { 14, 13, 16, 3, 13, 46, 12197 }, // ÷
+    { 21, 33, 16, -3, 22, 174, 12288 }, // ø
+    { 13, 18, 15, 1, 18, 59, 12462 }, // ù
+    { 13, 22, 15, 1, 22, 72, 12521 }, // ú
+    { 13, 17, 15, 1, 17, 56, 12593 }, // û
+    { 14, 18, 15, 1, 18, 63, 12649 }, // ü
+    { 16, 29, 16, 0, 23, 116, 12712 }, // ý
+    { 13, 21, 12, 0, 17, 69, 12828 }, // þ
+    { 16, 26, 16, 0, 20, 104, 12897 }, // ÿ
+    { 20, 23, 21, 0, 23, 115, 13001 }, // Ā
+    { 15, 16, 16, 0, 16, 60, 13116 }, // ā
+    { 20, 26, 21, 0, 26, 130, 13176 }, // Ă
+    { 15, 19, 16, 0, 19, 72, 13306 }, // ă
+    { 17, 23, 21, 0, 18, 98, 13378 }, // Ą
+    { 14, 17, 16, 0, 13, 60, 13476 }, // ą
+    { 18, 29, 18, 1, 28, 131, 13536 }, // Ć
+    { 13, 21, 14, 1, 20, 69, 13667 }, // ć
+    { 18, 27, 18, 1, 26, 122, 13736 }, // Ĉ
+    { 14, 19, 14, 1, 18, 67, 13858 }, // ĉ
+    { 18, 27, 18, 1, 26, 122, 13925 }, // Ċ
+    { 11, 20, 14, 1, 19, 55, 14047 }, // ċ
+    { 18, 28, 18, 1, 27, 126, 14102 }, // Č
+    { 13, 21, 14, 1, 20, 69, 14228 }, // č
+    { 19, 26, 20, 0, 26, 124, 14336 }, // Ď
+    { 20, 19, 16, 1, 18, 95, 14460 }, // ď
+    { 19, 18, 20, 0, 18, 86, 14555 }, // Đ
+    { 19, 19, 16, 1, 18, 91, 14641 }, // đ
+    { 18, 23, 16, 0, 23, 104, 14732 }, // Ē
+    { 15, 19, 16, 1, 19, 72, 14836 }, // ē
+    { 18, 26, 16, 0, 26, 117, 14908 }, // Ĕ
+    { 15, 22, 16, 1, 22, 83, 15025 }, // ĕ
+    { 17, 25, 16, 0, 25, 107, 15108 }, // Ė
+    { 13, 21, 16, 1, 21, 69, 15215 }, // ė
+    { 17, 23, 16, 0, 18, 98, 15284 }, // Ę
+    { 13, 19, 16, 1, 13, 62, 15382 }, // ę
+    { 17, 25, 16, 0, 25, 107, 15444 }, // Ě
+    { 14, 22, 16, 1, 22, 77, 15551 }, // ě
+    { 19, 24, 21, 1, 24, 114, 15628 }, // Ĝ
+    { 16, 23, 15, 0, 18, 92, 15742 }, // ĝ
+    { 19, 26, 21, 1, 26, 124, 15834 }, // Ğ
+    { 15, 25, 15, 0, 20, 94, 15958 }, // ğ
+    { 18, 25, 21, 1, 25, 113, 16052 }, // Ġ
+    { 15, 24, 15, 0, 19, 90, 16165 }, // ġ
+    { 18, 28, 21, 1, 19, 126, 16255 }, // Ģ
+    { 15, 25, 15, 0, 20, 94, 16384 }, // ģ
+    { 20, 24, 19, 0, 24, 120, 16478 }, // Ĥ
+    { 14, 23, 16, 0, 23, 81, 16598 }, // ĥ
+    { 20, 18, 19, 0, 18, 90, 16679 }, // Ħ
+    { 14, 18, 16, 0, 18, 63, 16769 }, // ħ
+    { 13, 26, 9, 0, 26, 85, 16832 }, // Ĩ
+    { 11, 18, 8, 0, 18, 50, 16917 }, // ĩ
+    { 14, 24, 9, 0, 24, 84, 16967 }, // Ī
+    { 11, 17, 8, 0, 17, 47, 17051 }, // ī
+    { 10, 23, 13, 2, 18, 58, 17098 }, // Į
+    { 10, 24, 8, -1, 19, 60, 17156 }, // į
+    { 11, 26, 9, 0, 26, 72, 17216 }, // İ
+    { 7, 12, 8, 0, 12, 21, 17288 }, // ı
+    { 17, 23, 19, 0, 18, 98, 17309 }, // Ĳ
+    { 20, 24, 8, 0, 18, 120, 17407 }, // ĳ
+    { 18, 29, 13, -1, 24, 131, 17527 }, // Ĵ
+    { 17, 24, 13, 2, 18, 102, 17658 }, // ĵ
+    { 17, 25, 18, 0, 18, 107, 17760 }, // Ķ
+    { 12, 26, 16, 0, 17, 78, 17867 }, // ķ
+    { 10, 12, 12, 0, 12, 30, 17945 }, // ĸ
+    { 13, 25, 16, 0, 25, 82, 17975 }, // Ĺ
+    { 12, 25, 10, 1, 25, 75, 18057 }, // ĺ
+    { 13, 27, 16, 0, 18, 88, 18132 }, // Ļ
+    { 9, 25, 10, 0, 17, 57, 18220 }, // ļ
+    { 15, 18, 16, 0, 18, 68, 18277 }, // Ľ
+    { 13, 18, 10, 1, 18, 59, 18345 }, // ľ
+    { 15, 18, 16, 0, 18, 68, 18432 }, // Ŀ
+    { 11, 17, 10, 1, 17, 47, 18500 }, // ŀ
+    { 29, 27, 16, -10, 22, 196, 18547 }, // Ł
+    { 20, 17, 10, -7, 17, 85, 18743 }, // ł
+    { 21, 25, 20, 0, 25, 132, 18828 }, // Ń
+    { 15, 20, 16, 0, 20, 75, 18960 }, // ń
+    { 21, 25, 20, 0, 18, 132, 19035 }, // Ņ
+    { 14, 19, 16, 0, 12, 67, 19167 }, // ņ
+    { 21, 25, 20, 0, 25, 132, 19234 }, // Ň
+    { 15, 20, 16, 0, 20, 75, 19366 }, // ň
+    { 14, 22, 14, -2, 22, 77, 19441 }, // ŉ
+    { 21, 23, 20, 0, 18, 121, 19518 }, // Ŋ
+    { 14, 16, 16, 0, 12, 56, 19639 }, // ŋ
+    { 21, 24, 21, 1, 23, 126, 19695 }, // Ō
+    { 15, 18, 16, 1, 18, 68, 19821 }, // ō
+    { 21, 27, 21, 1, 26, 142, 19889 }, // Ŏ
+    { 15, 22, 16, 1, 22, 83, 20031 }, // ŏ
+    { 21, 26, 21, 1, 25, 137, 20114 }, // Ő
+    { 17, 20, 16, 1, 20, 85, 20251 }, // ő
+    { 28, 19, 25, 1, 19, 133, 20336 }, // Œ
+    { 22, 13, 22, 1, 13, 72, 20480 }, // œ
+    { 16, 25, 17, 0, 25, 100, 20552 }, // Ŕ
+    { 11, 18, 12, 0, 18, 50, 20652 }, // ŕ
+    { 16, 28, 17, 0, 18, 112, 20702 }, // Ŗ
+    { 12, 23, 12, -1, 12, 69, 20814 }, // ŗ
+    { 16, 25, 17, 0, 25, 100, 20883 }, // Ř
+    { 12, 18, 12, 0, 18, 54, 20983 }, // ř
+    { 18, 28, 20, 1, 27, 126, 21037 }, // Ś
+    { 12, 20, 15, 1, 20, 60, 21163 }, // ś
+    { 19, 26, 20, 1, 25, 124, 21223 }, // Ŝ
+    { 13, 18, 15, 1, 18, 59, 21347 }, // ŝ
+    { 18, 23, 20, 1, 18, 104, 21406 }, // Ş
+    { 12, 18, 15, 1, 12, 54, 21510 }, // ş
+    { 18, 27, 20, 1, 26, 122, 21564 }, // Š
+    { 12, 20, 15, 1, 20, 60, 21686 }, // š
+    { 17, 22, 20, 4, 18, 94, 21746 }, // Ţ
+    { 10, 20, 14, 3, 16, 50, 21840 }, // ţ
+    { 17, 24, 20, 4, 24, 102, 21890 }, // Ť
+    { 12, 18, 14, 3, 18, 54, 21992 }, // ť
+    { 17, 18, 20, 4, 18, 77, 22046 }, // Ŧ
+    { 12, 16, 14, 1, 16, 48, 22123 }, // ŧ
+    { 19, 26, 19, 1, 25, 124, 22171 }, // Ũ
+    { 13, 19, 15, 1, 19, 62, 22295 }, // ũ
+    { 19, 24, 19, 1, 23, 114, 22357 }, // Ū
+    { 14, 17, 15, 1, 17, 60, 22528 }, // ū
+    { 19, 28, 19, 1, 27, 133, 22588 }, // Ŭ
+    { 14, 20, 15, 1, 20, 70, 22721 }, // ŭ
+    { 19, 27, 19, 1, 26, 129, 22791 }, // Ů
+    { 13, 20, 15, 1, 20, 65, 22920 }, // ů
+    { 20, 26, 19, 1, 25, 130, 22985 }, // Ű
+    { 16, 19, 15, 1, 19, 76, 23115 }, // ű
+    { 19, 23, 19, 1, 18, 110, 23191 }, // Ų
+    { 13, 17, 15, 1, 12, 56, 23301 }, // ų
+    { 24, 23, 27, 4, 23, 138, 23357 }, // Ŵ
+    { 17, 18, 20, 3, 18, 77, 23495 }, // ŵ
+    { 15, 24, 19, 5, 24, 90, 23572 }, // Ŷ
+    { 16, 25, 16, 0, 19, 100, 23662 }, // ŷ
+    { 15, 25, 19, 5, 25, 94, 23762 }, // Ÿ
+    { 21, 25, 21, 0, 25, 132, 23856 }, // Ź
+    { 15, 20, 16, 0, 20, 75, 23988 }, // ź
+    { 21, 24, 21, 0, 24, 126, 24063 }, // Ż
+    { 15, 19, 16, 0, 19, 72, 24189 }, // ż
+    { 21, 25, 21, 0, 25, 132, 24261 }, // Ž
+    { 15, 20, 16, 0, 20, 75, 24393 }, // ž
+    { 11, 17, 11, 3, 17, 47, 24468 }, // ſ
+    { 6, 4, 0, 5, 16, 6, 24515 }, // ̀
+    { 6, 5, 0, 4, 17, 8, 24521 }, // ́
+    { 10, 5, 0, -1, 1, 13, 24529 }, // ̂
+    { 9, 5, 0, 4, 16, 12, 24542 }, // ̃
+    { 10, 3, 0, 4, 14, 8, 24554 }, // ̄
+    { 14, 3, 0, 6, 18, 11, 24562 }, // ̅
+    { 10, 5, 0, 4, 16, 13, 24576 }, // ̆
+    { 5, 4, 0, 4, 16, 5, 24589 }, // ̇
+    { 10, 4, 0, 4, 16, 10, 24594 }, // ̈
+    { 6, 4, 0, 3, 13, 6, 24604 }, // ̉
+    { 6, 5, 0, 4, 16, 8, 24610 }, // ̊
+    { 15, 4, 0, 4, 16, 15, 24618 }, // ̋
+    { 9, 5, 0, 4, 16, 12, 24633 }, // ̌
+    { 15, 4, 0, -7, 17, 15, 24645 }, // ̏
+    { 7, 6, 0, 3, 16, 11, 24660 }, // ̒
+    { 7, 6, 0, 3, 15, 11, 24671 }, // ̓
+    { 8, 6, 0, -4, 15, 12, 24682 }, // ̔
+    { 5, 5, 0, 0, -1, 7, 24694 }, // ̘
+    { 5, 5, 0, 1, -1, 7, 24701 }, // ̙
+    { 9, 5, 0, 5, 17, 12, 24708 }, // ̚
+    { 4, 5, 0, 4, 14, 5, 24720 }, // ̛
+    { 4, 5, 0, 0, -1, 5, 24725 }, // ̜
+    { 5, 4, 0, 2, 3, 5, 24730 }, // ̝
+    { 5, 4, 0, 0, -1, 5, 24735 }, // ̞
+    { 5, 5, 0, 0, -2, 7, 24740 }, // ̟
+    { 10, 3, 0, 0, -3, 8, 24747 }, // ̠
+    { 5, 4, 0, 0, 1, 5, 24755 }, // ̣
+    { 11, 4, 0, -1, 0, 11, 24760 }, // ̤
+    { 6, 5, 0, 4, 16, 8, 24771 }, // ̥
+    { 7, 6, 0, 0, 3, 11, 24779 }, // ̦
+    { 6, 6, 0, 0, 1, 9, 24790 }, // ̧
+    { 6, 6, 0, 0, 1, 9, 24799 }, // ̨
+    { 5, 6, 0, -1, -1, 8, 24808 }, // ̩
+    { 8, 4, 0, 0, -1, 8, 24816 }, // ̪
+    { 9, 5, 0, 0, 0, 12, 24824 }, // ̬
+    { 9, 5, 0, -1, -1, 12, 24836 }, // ̭
+    { 9, 5, 0, 4, 16, 12, 24848 }, // ̰
+    { 8, 3, 0, 5, 15, 6, 24860 }, // ̱
+    { 9, 3, 0, 0, -1, 7, 24866 }, // ̲
+    { 9, 5, 0, 4, 16, 12, 24873 }, // ̴
+    { 10, 3, 0, 3, 8, 8, 24885 }, // ̵
+    { 3, 5, 0, 2, -1, 4, 24893 }, // ̹
+    { 7, 4, 0, -1, -1, 7, 24897 }, // ̺
+    { 8, 5, 0, 0, 0, 10, 24904 }, // ̻
+    { 8, 4, 0, 0, 0, 8, 24914 }, // ̼
+    { 6, 5, 0, 4, 16, 8, 24922 }, // ̽
+    { 9, 5, 0, 4, 16, 12, 24930 }, // ͂
+    { 4, 4, 0, 4, 17, 4, 24942 }, // ̓
+    { 10, 10, 0, 4, 22, 25, 24946 }, // ̈́
+    { 7, 4, 0, 5, 16, 7, 24971 }, // ͆
+    { 12, 8, 0, -1, 0, 24, 24978 }, // ͇
+    { 9, 6, 0, 0, 0, 14, 25002 }, // ͈
+    { 7, 6, 0, 0, -1, 11, 25016 }, // ͉
+    { 10, 13, 0, 4, 20, 33, 25027 }, // ͊
+    { 20, 10, 0, 7, 19, 50, 25060 }, // ͋
+    { 15, 11, 0, 4, 11, 42, 25110 }, // ͌
+    { 11, 7, 0, 1, 0, 20, 25152 }, // ͍
+    { 3, 3, 0, 3, 2, 3, 25172 }, // ͎
+    { 17, 4, 0, 1, 0, 17, 25175 }, // ͜
+    { 18, 4, 0, 4, 16, 18, 25192 }, // ͡
+    { 21, 5, 0, 0, -1, 27, 25210 }, // ͢
+    { 15, 21, 13, 1, 21, 79, 25237 }, // Ѐ
+    { 15, 20, 13, 1, 20, 75, 25316 }, // Ё
+    { 15, 17, 21, 7, 17, 64, 25391 }, // Ђ
+    { 15, 24, 14, 1, 24, 90, 25455 }, // Ѓ
+    { 17, 17, 19, 1, 16, 73, 25545 }, // Є
+    { 18, 19, 20, 1, 18, 86, 25618 }, // Ѕ
+    { 9, 18, 9, 0, 18, 41, 25704 }, // І
+    { 13, 26, 9, 0, 26, 85, 25745 }, // Ї
+    { 15, 24, 13, -1, 19, 90, 25830 }, // Ј
+    { 22, 16, 24, 2, 15, 88, 25920 }, // Љ
+    { 21, 17, 23, 2, 16, 90, 26008 }, // Њ
+    { 17, 18, 20, 4, 18, 77, 26098 }, // Ћ
+    { 19, 25, 18, 0, 25, 119, 26175 }, // Ќ
+    { 19, 23, 20, 1, 23, 110, 26294 }, // Ѝ
+    { 16, 25, 14, -1, 24, 100, 26404 }, // Ў
+    { 16, 19, 15, 1, 15, 76, 26504 }, // Џ
+    { 17, 18, 21, 0, 18, 77, 26624 }, // А
+    { 15, 16, 14, 2, 15, 60, 26701 }, // Б
+    { 14, 16, 14, 1, 15, 56, 26761 }, // В
+    { 15, 15, 14, 1, 15, 57, 26817 }, // Г
+    { 16, 18, 17, 2, 15, 72, 26874 }, // Д
+    { 15, 15, 13, 1, 15, 57, 26946 }, // Е
+    { 26, 18, 27, 0, 18, 117, 27003 }, // Ж
+    { 13, 17, 15, 1, 16, 56, 27120 }, // З
+    { 19, 18, 20, 1, 18, 86, 27176 }, // И
+    { 19, 24, 20, 1, 24, 114, 27262 }, // Й
+    { 17, 18, 18, 0, 18, 77, 27376 }, // К
+    { 16, 16, 16, 2, 15, 64, 27453 }, // Л
+    { 19, 15, 18, 1, 15, 72, 27517 }, // М
+    { 20, 18, 19, 0, 18, 90, 27589 }, // Н
+    { 21, 19, 21, 1, 18, 100, 27679 }, // О
+    { 16, 16, 14, 1, 16, 64, 27779 }, // П
+    { 17, 18, 17, 0, 18, 77, 27843 }, // Р
+    { 18, 20, 18, 1, 19, 90, 27920 }, // С
+    { 17, 18, 20, 4, 18, 77, 28010 }, // Т
+    { 16, 18, 14, -1, 17, 72, 28087 }, // У
+    { 17, 16, 18, 4, 16, 68, 28159 }, // Ф
+    { 21, 18, 21, 0, 18, 95, 28227 }, // Х
+    { 15, 19, 15, 1, 16, 72, 28322 }, // Ц
+    { 13, 16, 14, 3, 16, 52, 28394 }, // Ч
+    { 19, 16, 17, 1, 16, 76, 28446 }, // Ш
+    { 19, 20, 19, 1, 16, 95, 28522 }, // Щ
+    { 12, 17, 14, 2, 16, 51, 28617 }, // Ъ
+    { 21, 18, 23, 2, 17, 95, 28672 }, // Ы
+    { 12, 17, 14, 2, 16, 51, 28767 }, // Ь
+    { 18, 17, 19, 1, 16, 77, 28818 }, // Э
+    { 20, 17, 21, 2, 16, 85, 28895 }, // Ю
+    { 17, 18, 17, 0, 18, 77, 28980 }, // Я
+    { 14, 13, 16, 0, 13, 46, 29057 }, // а
+    { 15, 16, 15, 2, 16, 60, 29103 }, // б
+    { 12, 13, 13, 0, 13, 39, 29163 }, // в
+    { 13, 12, 12, 1, 12, 39, 29202 }, // г
+    { 14, 14, 16, 2, 12, 49, 29241 }, // д
+    { 13, 13, 16, 1, 13, 43, 29290 }, // е
+    { 22, 15, 22, 0, 15, 83, 29333 }, // ж
+    { 10, 11, 9, 0, 11, 28, 29416 }, // з
+    { 14, 12, 14, 1, 12, 42, 29444 }, // и
+    { 14, 16, 14, 1, 16, 56, 29486 }, // й
+    { 13, 13, 14, 0, 13, 43, 29542 }, // к
+    { 12, 12, 11, 0, 11, 36, 29585 }, // л
+    { 17, 14, 17, 0, 14, 60, 29621 }, // м
+    { 17, 13, 17, 0, 13, 56, 29681 }, // н
+    { 13, 14, 17, 2, 13, 46, 29737 }, // о
+    { 14, 12, 14, 1, 12, 42, 29783 }, // п
+    { 17, 18, 17, -1, 12, 77, 29825 }, // р
+    { 11, 14, 14, 1, 13, 39, 29902 }, // с
+    { 12, 12, 14, 4, 12, 36, 29941 }, // т
+    { 16, 18, 16, 0, 12, 72, 29977 }, // у
+    { 17, 17, 18, 2, 12, 73, 30049 }, // ф
+    { 15, 12, 15, 1, 12, 45, 30122 }, // х
+    { 13, 15, 15, 2, 12, 49, 30167 }, // ц
+    { 9, 11, 9, 2, 11, 25, 30216 }, // ч
+    { 18, 12, 17, 1, 12, 54, 30241 }, // ш
+    { 18, 16, 19, 1, 12, 72, 30295 }, // щ
+    { 12, 12, 16, 4, 11, 36, 30367 }, // ъ
+    { 17, 13, 17, 2, 12, 56, 30403 }, // ы
+    { 12, 13, 13, 1, 12, 39, 30459 }, // ь
+    { 12, 13, 13, 2, 12, 39, 30498 }, // э
+    { 17, 14, 17, 1, 13, 60, 30537 }, // ю
+    { 14, 12, 13, 1, 12, 42, 30597 }, // я
+    { 13, 20, 16, 1, 20, 65, 30639 }, // ѐ
+    { 14, 17, 14, 2, 16, 60, 30720 }, // ё
+    { 14, 22, 16, 0, 18, 77, 30780 }, // ђ
+    { 13, 18, 12, 1, 18, 59, 30857 }, // ѓ
+    { 12, 12, 13, 0, 11, 36, 30916 }, // є
+    { 12, 12, 15, 1, 12, 36, 30952 }, // ѕ
+    { 9, 18, 8, 0, 18, 41, 30988 }, // і
+    { 11, 18, 8, 0, 18, 50, 31029 }, // ї
+    { 13, 24, 13, 2, 18, 78, 31079 }, // ј
+    { 15, 12, 17, 1, 11, 45, 31157 }, // љ
+    { 15, 12, 16, 1, 11, 45, 31202 }, // њ
+    { 14, 18, 16, 0, 18, 63, 31247 }, // ћ
+    { 13, 19, 14, 0, 19, 62, 31310 }, // ќ
+    { 14, 17, 14, 1, 17, 60, 31372 }, // ѝ
+    { 16, 27, 16, 0, 21, 108, 31432 }, // ў
+    { 13, 14, 11, 0, 11, 46, 31540 }, // џ
+    { 12, 17, 17, 5, 16, 51, 31586 }, // Ѣ
+    { 11, 16, 15, 4, 15, 44, 31637 }, // ѣ
+    { 21, 15, 21, 2, 15, 79, 31681 }, // Ѫ
+    { 14, 12, 15, 1, 11, 42, 31760 }, // ѫ
+    { 18, 19, 20, 2, 19, 86, 31802 }, // Ѳ
+    { 15, 15, 16, 1, 15, 57, 31888 }, // ѳ
+    { 24, 22, 21, 5, 22, 132, 31945 }, // Ѵ
+    { 14, 14, 17, 3, 14, 49, 32077 }, // ѵ
+    { 9, 6, 0, 5, 19, 14, 32126 }, // ҆
+    { 16, 17, 14, 1, 17, 68, 32140 }, // Ґ
+    { 14, 15, 12, 1, 15, 53, 32208 }, // ґ
+    { 15, 15, 14, 1, 15, 57, 32261 }, // Ғ
+    { 11, 11, 9, 0, 11, 31, 32318 }, // ғ
+    { 17, 17, 14, 1, 17, 73, 32349 }, // Ҕ
+    { 9, 11, 9, 0, 11, 25, 32422 }, // ҕ
+    { 25, 21, 27, -1, 18, 132, 32447 }, // Җ
+    { 17, 15, 18, -1, 13, 64, 32579 }, // җ
+    { 13, 19, 15, 2, 16, 62, 32643 }, // Ҙ
+    { 10, 16, 9, 0, 11, 40, 32705 }, // ҙ
+    { 18, 21, 18, -1, 18, 95, 32768 }, // Қ
+    { 12, 15, 13, -1, 13, 45, 32863 }, // қ
+    { 18, 16, 20, 2, 16, 72, 32908 }, // Ҝ
+    { 14, 11, 15, 1, 11, 39, 32980 }, // ҝ
+    { 17, 18, 18, 0, 18, 77, 33019 }, // Ҟ
+    { 12, 17, 16, 0, 17, 51, 33096 }, // ҟ
+    { 18, 18, 18, -1, 18, 81, 33147 }, // Ҡ
+    { 12, 13, 13, -1, 13, 39, 33228 }, // ҡ
+    { 19, 21, 19, -1, 18, 100, 33267 }, // Ң
+    { 13, 15, 13, -1, 13, 49, 33367 }, // ң
+    { 27, 19, 19, 0, 19, 129, 33416 }, // Ҥ
+    { 18, 12, 13, 0, 12, 54, 33545 }, // ҥ
+    { 22, 17, 25, 2, 17, 94, 33599 }, // Ҧ
+    { 19, 20, 22, 2, 14, 95, 33693 }, // ҧ
+    { 20, 18, 25, 3, 17, 90, 33788 }, // Ҩ
+    { 16, 15, 19, 2, 14, 60, 33878 }, // ҩ
+    { 18, 23, 18, 1, 19, 104, 33938 }, // Ҫ
+    { 11, 16, 14, 1, 13, 44, 34042 }, // ҫ
+    { 16, 21, 20, 3, 18, 84, 34086 }, // Ҭ
+    { 12, 14, 13, 1, 12, 42, 34170 }, // ҭ
+    { 15, 18, 19, 5, 18, 68, 34212 }, // Ү
+    { 12, 15, 14, 4, 11, 45, 34280 }, // ү
+    { 16, 18, 19, 4, 18, 72, 34325 }, // Ұ
+    { 16, 16, 14, 0, 11, 64, 34397 }, // ұ
+    { 21, 21, 21, -1, 18, 111, 34461 }, // Ҳ
+    { 14, 15, 14, -1, 13, 53, 34572 }, // ҳ
+    { 16, 19, 22, 5, 15, 76, 34625 }, // Ҵ
+    { 12, 14, 16, 3, 11, 42, 34701 }, // ҵ
+    { 14, 20, 17, 3, 15, 70, 34743 }, // Ҷ
+    { 10, 15, 12, 2, 11, 38, 34816 }, // ҷ
+    { 14, 15, 15, 4, 15, 53, 34854 }, // Ҹ
+    { 10, 11, 10, 2, 11, 28, 34907 }, // ҹ
+    { 13, 17, 16, 2, 17, 56, 34935 }, // Һ
+    { 14, 18, 16, 0, 18, 63, 34991 }, // һ
+    { 18, 16, 20, 1, 15, 72, 35054 }, // Ҽ
+    { 13, 12, 15, 0, 12, 39, 35126 }, // ҽ
+    { 17, 18, 23, 4, 15, 77, 35165 }, // Ҿ
+    { 13, 14, 16, 2, 12, 46, 35242 }, // ҿ
+    { 9, 18, 9, 0, 18, 41, 35288 }, // Ӏ
+    { 26, 26, 27, 0, 26, 169, 35329 }, // Ӂ
+    { 22, 23, 22, 0, 23, 127, 35498 }, // ӂ
+    { 15, 21, 16, 2, 16, 79, 35625 }, // Ӄ
+    { 10, 15, 11, 1, 11, 38, 35704 }, // ӄ
+    { 16, 19, 16, 2, 15, 76, 35742 }, // Ӆ
+    { 12, 14, 11, 0, 11, 42, 35818 }, // ӆ
+    { 20, 23, 19, 0, 18, 115, 35860 }, // Ӈ
+    { 13, 17, 13, 0, 13, 56, 35975 }, // ӈ
+    { 20, 24, 19, 0, 18, 120, 36031 }, // Ӊ
+    { 13, 17, 13, 0, 13, 56, 36151 }, // ӊ
+    { 13, 19, 14, 3, 15, 62, 36207 }, // Ӌ
+    { 9, 14, 10, 2, 11, 32, 36269 }, // ӌ
+    { 23, 24, 26, 0, 18, 138, 36301 }, // Ӎ
+    { 15, 17, 18, 0, 13, 64, 36439 }, // ӎ
+    { 6, 15, 6, 2, 15, 23, 36503 }, // ӏ
+    { 20, 26, 21, 0, 26, 130, 36526 }, // Ӑ
+    { 18, 20, 16, 0, 20, 90, 36656 }, // ӑ
+    { 20, 24, 21, 0, 24, 120, 36864 }, // Ӓ
+    { 18, 18, 16, 0, 18, 81, 36984 }, // ӓ
+    { 28, 19, 30, 0, 18, 133, 37065 }, // Ӕ
+    { 23, 13, 26, 0, 13, 75, 37198 }, // ӕ
+    { 15, 23, 13, 1, 23, 87, 37273 }, // Ӗ
+    { 15, 21, 16, 1, 21, 79, 37360 }, // ӗ
+    { 14, 13, 16, 1, 12, 46, 37439 }, // Ә
+    { 13, 14, 17, 7, 13, 46, 37485 }, // ә
+    { 17, 22, 16, 1, 21, 94, 37531 }, // Ӛ
+    { 14, 15, 17, 6, 13, 53, 37625 }, // ӛ
+    { 26, 24, 27, 0, 24, 156, 37678 }, // Ӝ
+    { 22, 21, 22, 0, 21, 116, 37834 }, // ӝ
+    { 15, 23, 15, 1, 22, 87, 37950 }, // Ӟ
+    { 15, 17, 9, 0, 17, 64, 38037 }, // ӟ
+    { 12, 15, 12, 2, 15, 45, 38101 }, // Ӡ
+    { 12, 15, 12, 1, 11, 45, 38146 }, // ӡ
+    { 19, 21, 20, 1, 21, 100, 38191 }, // Ӣ
+    { 15, 16, 14, 1, 16, 60, 38291 }, // ӣ
+    { 19, 22, 20, 1, 22, 105, 38351 }, // Ӥ
+    { 15, 17, 14, 1, 17, 64, 38456 }, // ӥ
+    { 21, 25, 21, 1, 24, 132, 38520 }, // Ӧ
+    { 14, 19, 17, 2, 18, 67, 38652 }, // ӧ
+    { 17, 16, 21, 2, 15, 68, 38719 }, // Ө
+    { 14, 12, 16, 1, 12, 42, 38787 }, // ө
+    { 17, 25, 21, 2, 24, 107, 38912 }, // Ӫ
+    { 15, 20, 16, 1, 20, 75, 39019 }, // ӫ
+    { 18, 23, 19, 1, 22, 104, 39094 }, // Ӭ
+    { 13, 18, 13, 2, 17, 59, 39198 }, // ӭ
+    { 16, 22, 14, -1, 21, 88, 39257 }, // Ӯ
+    { 16, 25, 16, 0, 19, 100, 39345 }, // ӯ
+    { 16, 23, 14, -1, 22, 92, 39445 }, // Ӱ
+    { 16, 26, 16, 0, 20, 104, 39537 }, // ӱ
+    { 18, 24, 14, -1, 23, 108, 39641 }, // Ӳ
+    { 19, 26, 16, 0, 20, 124, 39749 }, // ӳ
+    { 14, 22, 14, 3, 22, 77, 39873 }, // Ӵ
+    { 11, 17, 9, 2, 17, 47, 39950 }, // ӵ
+    { 15, 18, 14, 1, 15, 68, 39997 }, // Ӷ
+    { 11, 13, 9, 0, 11, 36, 40065 }, // ӷ
+    { 21, 24, 23, 2, 23, 126, 40101 }, // Ӹ
+    { 17, 20, 17, 2, 19, 85, 40227 }, // ӹ
+    { 21, 22, 21, 0, 18, 116, 40312 }, // Ӽ
+    { 14, 15, 14, 0, 13, 53, 40428 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 40481 }, //  
+    { 0, 0, 28, 0, 0, 0, 40481 }, //  
+    { 0, 0, 17, 0, 0, 0, 40481 }, //  
+    { 0, 0, 28, 0, 0, 0, 40481 }, //  
+    { 0, 0, 14, 0, 0, 0, 40481 }, //  
+    { 0, 0, 12, 0, 0, 0, 40481 }, //  
+    { 0, 0, 10, 0, 0, 0, 40481 }, //  
+    { 0, 0, 14, 0, 0, 0, 40481 }, //  
+    { 0, 0, 5, 0, 0, 0, 40481 }, //  
+    { 0, 0, 11, 0, 0, 0, 40481 }, //  
+    { 0, 0, 10, 0, 0, 0, 40481 }, //  
+    { 0, 0, 7, 0, 0, 0, 40481 }, // ​
+    { 0, 0, 0, 0, 0, 0, 40481 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 40481 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 40481 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 40481 }, // ‏
+    { 10, 3, 11, 3, 8, 8, 40481 }, // ‐
+    { 10, 3, 11, 3, 8, 8, 40489 }, // ‑
+    { 16, 3, 16, 3, 8, 12, 40497 }, // ‒
+    { 14, 3, 17, 3, 8, 11, 40509 }, // –
+    { 21, 3, 23, 3, 8, 16, 40520 }, // —
+    { 21, 3, 23, 3, 8, 16, 40536 }, // ―
+    { 14, 18, 11, 0, 15, 63, 40552 }, // ‖
+    { 17, 8, 16, 0, -1, 34, 40615 }, // ‗
+    { 7, 6, 7, 4, 18, 11, 40649 }, // ‘
+    { 7, 6, 7, 4, 18, 11, 40660 }, // ’
+    { 7, 6, 7, 0, 3, 11, 40671 }, // ‚
+    { 7, 6, 7, 4, 18, 11, 40682 }, // ‛
+    { 12, 6, 12, 4, 18, 18, 40693 }, // “
+    { 12, 6, 12, 4, 18, 18, 40711 }, // ”
+    { 7, 6, 7, 0, 3, 11, 40729 }, // „
+    { 12, 6, 12, 4, 18, 18, 40740 }, // ‟
+    { 12, 27, 12, 3, 21, 81, 40758 }, // †
+    { 14, 27, 13, 1, 21, 95, 40839 }, // ‡
+    { 14, 12, 11, 0, 14, 42, 40960 }, // •
+    { 7, 7, 8, 2, 9, 13, 41002 }, // ‣
+    { 4, 4, 5, 1, 4, 4, 41015 }, // ․
+    { 4, 4, 5, 1, 4, 4, 41019 }, // ‥
+    { 19, 4, 20, 1, 4, 19, 41023 }, // …
+    { 4, 3, 5, 1, 8, 3, 41042 }, // ‧
+    { 0, 0, 26, 0, 0, 0, 41045 }, //  
+    { 17, 18, 23, 5, 16, 77, 41045 }, // ‰
+    { 7, 6, 7, 4, 18, 11, 41122 }, // ′
+    { 12, 6, 12, 4, 18, 18, 41133 }, // ″
+    { 15, 7, 18, -2, 18, 27, 41151 }, // ‴
+    { 4, 7, 7, 5, 18, 7, 41178 }, // ‵
+    { 9, 7, 11, 4, 18, 16, 41185 }, // ‶
+    { 15, 7, 18, 5, 18, 27, 41201 }, // ‷
+    { 9, 4, 12, 5, 17, 9, 41228 }, // ‸
+    { 7, 10, 9, 3, 11, 18, 41237 }, // ‹
+    { 8, 10, 9, -2, 11, 20, 41255 }, // ›
+    { 27, 21, 28, 1, 19, 142, 41275 }, // ※
+    { 11, 21, 7, 0, 21, 58, 41417 }, // ‼
+    { 14, 26, 16, 4, 25, 91, 41475 }, // ‽
+    { 11, 3, 11, 5, 17, 9, 41566 }, // ‾
+    { 10, 4, 13, 4, 14, 10, 41575 }, // ‿
+    { 15, 14, 17, 3, 19, 53, 41585 }, // ⁂
+    { 17, 17, 23, 5, 16, 73, 41638 }, // ⁄
+    { 25, 24, 26, 5, 24, 150, 41711 }, // ⁇
+    { 18, 23, 21, 5, 23, 104, 41861 }, // ⁈
+    { 21, 25, 17, 0, 23, 132, 41965 }, // ⁉
+    { 21, 33, 15, -1, 23, 174, 42097 }, // ⁒
+    { 0, 0, 100, 0, 0, 0, 42271 }, //  
+    { 8, 8, 7, 2, 17, 16, 42271 }, // ⁰
+    { 6, 9, 7, 3, 18, 14, 42287 }, // ⁴
+    { 8, 9, 7, 2, 18, 18, 42301 }, // ⁵
+    { 8, 8, 7, 2, 17, 16, 42319 }, // ⁶
+    { 6, 9, 7, 4, 18, 14, 42335 }, // ⁷
+    { 8, 8, 7, 2, 17, 16, 42349 }, // ⁸
+    { 8, 8, 7, 2, 17, 16, 42365 }, // ⁹
+    { 14, 12, 16, 0, 12, 42, 42381 }, // ⁿ
+    { 10, 11, 9, 1, 11, 28, 42423 }, // ₀
+    { 6, 9, 6, -1, 5, 14, 42451 }, // ₁
+    { 7, 9, 7, -1, 5, 16, 42465 }, // ₂
+    { 7, 9, 7, -1, 5, 16, 42481 }, // ₃
+    { 7, 8, 7, -1, 5, 14, 42497 }, // ₄
+    { 7, 8, 6, -1, 5, 14, 42511 }, // ₅
+    { 7, 8, 7, -1, 4, 14, 42525 }, // ₆
+    { 6, 9, 7, 1, 5, 14, 42539 }, // ₇
+    { 8, 9, 7, -1, 5, 18, 42553 }, // ₈
+    { 8, 9, 7, -1, 5, 18, 42571 }, // ₉
+    { 12, 29, 9, 2, 21, 87, 42589 }, // ₍
+    { 12, 29, 9, -5, 21, 87, 42676 }, // ₎
+    { 20, 28, 18, 0, 23, 140, 42763 }, // ₡
+    { 18, 20, 18, 1, 19, 90, 42903 }, // ₢
+    { 17, 20, 14, 0, 20, 85, 43008 }, // ₤
+    { 21, 18, 20, 0, 18, 95, 43093 }, // ₦
+    { 18, 18, 17, 0, 18, 81, 43188 }, // ₧
+    { 24, 18, 24, 0, 18, 108, 43269 }, // ₨
+    { 18, 18, 16, -1, 18, 81, 43377 }, // ₩
+    { 20, 16, 22, 3, 16, 80, 43458 }, // ₪
+    { 15, 17, 14, 2, 17, 64, 43538 }, // ₫
+    { 16, 19, 17, 2, 16, 76, 43602 }, // €
+    { 17, 18, 20, 4, 18, 77, 43678 }, // ₮
+    { 21, 18, 13, 0, 18, 95, 43755 }, // ₱
+    { 18, 25, 21, 1, 22, 113, 43850 }, // ₲
+    { 23, 19, 19, 2, 18, 110, 43963 }, // ₴
+    { 11, 16, 14, 1, 15, 44, 44073 }, // ₵
+    { 19, 19, 20, 4, 19, 91, 44117 }, // ₸
+    { 12, 17, 13, 3, 16, 51, 44208 }, // ₹
+    { 13, 15, 14, 2, 14, 49, 44259 }, // ₺
+    { 16, 16, 13, 1, 16, 64, 44308 }, // ₼
+    { 19, 18, 17, -2, 18, 86, 44372 }, // ₽
+    { 13, 13, 16, -2, 10, 43, 44458 }, // ←
+    { 14, 13, 16, 3, 13, 46, 44501 }, // ↑
+    { 13, 13, 16, 5, 10, 43, 44547 }, // →
+    { 14, 13, 16, 6, 13, 46, 44590 }, // ↓
+    { 22, 11, 19, -1, 10, 61, 44636 }, // ↔
+    { 11, 22, 14, 3, 20, 61, 44697 }, // ↕
+    { 12, 9, 13, -2, 9, 27, 44758 }, // ↖
+    { 13, 9, 13, 3, 9, 30, 44785 }, // ↗
+    { 10, 13, 13, 5, 12, 33, 44815 }, // ↘
+    { 11, 13, 13, -2, 12, 36, 44848 }, // ↙
+    { 16, 13, 18, 0, 12, 52, 44884 }, // ⇐
+    { 17, 15, 19, 3, 15, 64, 44936 }, // ⇑
+    { 16, 13, 18, 2, 12, 52, 45000 }, // ⇒
+    { 17, 16, 19, 7, 15, 68, 45056 }, // ⇓
+    { 21, 13, 20, 0, 12, 69, 45124 }, // ⇔
+    { 13, 20, 16, 5, 13, 65, 45193 }, // ⇕
+    { 15, 17, 14, 2, 17, 64, 45258 }, // ∂
+    { 22, 20, 21, 0, 19, 110, 45322 }, // ∅
+    { 16, 16, 18, 1, 16, 64, 45432 }, // ∆
+    { 15, 15, 15, 3, 15, 57, 45496 }, // ∏
+    { 15, 15, 15, 7, 15, 57, 45553 }, // ∐
+    { 14, 16, 12, 1, 15, 56, 45610 }, // ∑
+    { 11, 3, 13, 2, 7, 9, 45666 }, // −
+    { 21, 18, 19, 2, 17, 95, 45675 }, // √
+    { 19, 11, 19, 2, 13, 53, 45770 }, // ∞
+    { 22, 24, 18, 0, 19, 132, 45823 }, // ∫
+    { 8, 13, 6, 0, 13, 26, 45955 }, // ∶
+    { 15, 11, 16, 4, 11, 42, 45981 }, // ≈
+    { 17, 18, 23, 5, 16, 77, 46023 }, // ≠
+    { 18, 16, 18, -1, 15, 72, 46100 }, // ≤
+    { 18, 16, 18, 1, 15, 72, 46172 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_italicIntervals[] = {
@@ -3653,4 +2542,9 @@ static const EpdFontData opendyslexic_10_italic = {
     28,
     -11,
     true,
+    opendyslexic_10_italicBlockOffsets,
+    opendyslexic_10_italicDirectGlyphs,
+    opendyslexic_10_italicGlyphPages,
+    35,
+    opendyslexic_10_italicPageGlyphs,
 };
@@ -2,2391 +2,1523 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_regular
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_regularBitmaps[38045] = {
-    0x00, 0x40, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x0B,
-    0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0F, 0xC0, 0x04, 0x00, 0x01, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0,
-    0x2F, 0x87, 0xF0, 0xFD, 0x1F, 0xC3, 0xF4, 0x7F, 0x0F, 0xC1, 0xF4, 0x3F, 0x07, 0xE0, 0xFC, 0x2F,
-    0x80, 0x00, 0x03, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x3C,
-    0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0xB8, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x00, 0x02,
-    0xC3, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x6D, 0x50, 0x02,
-    0xFA, 0xC3, 0x40, 0x00, 0xFC, 0x70, 0xD0, 0x00, 0x3F, 0x1C, 0x34, 0x00, 0x0B, 0xFB, 0x0D, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0xFF, 0xF4, 0x00, 0x07, 0x0F,
-    0xFF, 0x40, 0x01, 0xC3, 0x7F, 0xE0, 0x00, 0x70, 0xEF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x1C, 0x34, 0x00, 0x00,
-    0x07, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x34, 0x0B,
-    0xE0, 0x0B, 0x02, 0x82, 0x80, 0xD0, 0x30, 0x0C, 0x3C, 0x03, 0x00, 0xC7, 0x00, 0x30, 0x1C, 0xE0,
-    0x02, 0xFF, 0xAC, 0x00, 0x0B, 0xE7, 0x80, 0x00, 0x00, 0xF7, 0xF4, 0x00, 0x1E, 0xC1, 0xC0, 0x03,
-    0xE8, 0x0A, 0x00, 0xB2, 0x40, 0xA0, 0x1E, 0x28, 0x0E, 0x03, 0xC0, 0xFF, 0xC0, 0x78, 0x07, 0xF0,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xAB, 0xF0, 0x00,
-    0x2E, 0x00, 0xB4, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x0F, 0xCB, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0x87, 0xC0, 0x19,
-    0x3F, 0x01, 0xF4, 0x3D, 0x7F, 0x00, 0x3D, 0xBC, 0x7F, 0x00, 0x0F, 0xF8, 0x3F, 0x80, 0x1F, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x18, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x8F, 0xD3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0xA0, 0x07, 0x40, 0x3C, 0x01, 0xD0, 0x0F,
-    0x00, 0x38, 0x02, 0xD0, 0x0F, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-    0x0F, 0x00, 0x3C, 0x00, 0xB4, 0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xE0,
-    0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3D, 0x00, 0xBC, 0x28, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xD0,
-    0x03, 0xC0, 0x0B, 0x40, 0x0E, 0x00, 0x3C, 0x00, 0xB4, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C,
-    0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x80, 0x2D, 0x00, 0xF0, 0x07, 0xC0,
-    0x2E, 0x00, 0xF4, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x10, 0x00, 0x01, 0xC0, 0x01,
-    0x03, 0x03, 0x0F, 0x8C, 0xB8, 0x07, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0xBB, 0xBE, 0x0F, 0x4D, 0x2C,
-    0x00, 0x34, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x24, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E,
-    0x00, 0x2A, 0xBE, 0xA1, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0xE0, 0x00, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xF0, 0x14, 0x7C, 0xBC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x03, 0x82, 0xC0, 0x0E,
-    0x00, 0xB0, 0x2C, 0x00, 0x34, 0x3C, 0x00, 0x38, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C,
-    0x3C, 0x7C, 0x28, 0x3C, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xBC, 0x3F, 0x01, 0xFC, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xF0,
-    0x01, 0x8F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00,
-    0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF,
-    0xFD, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x0B, 0xFE, 0x00,
-    0xA9, 0x6F, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x1A, 0xBC,
-    0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x14, 0x02,
-    0xF4, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x0F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x7B, 0x80, 0x00, 0xF3, 0x80, 0x03, 0xD3, 0xC0, 0x0B, 0x83,
-    0xC0, 0x1F, 0x03, 0xC0, 0x3E, 0x17, 0xD4, 0x7F, 0xFF, 0xFC, 0x3A, 0xAF, 0xF8, 0x00, 0x07, 0xD0,
-    0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xE0, 0x15, 0x55, 0x40, 0xFF, 0xFF, 0x43, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xEA, 0x40, 0x0F, 0xFF, 0xE0, 0x10,
-    0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x29, 0x07, 0xF0, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFC, 0x0B, 0xFE, 0x40, 0x00, 0x1A, 0xA0, 0x01, 0xFF, 0xF0, 0x0B, 0x80, 0x00, 0x0E, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x3C, 0x59, 0x00, 0x3F, 0xFF, 0xD0, 0x7F, 0x81, 0xF0, 0x7E, 0x00, 0x7C,
-    0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x2F, 0x00, 0xBC, 0x0F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD1, 0x5A, 0xAF, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0x01, 0xBF, 0x40, 0x0B, 0x41, 0xF0, 0x0E, 0x00, 0x74, 0x1D, 0x00, 0x38, 0x2D, 0x00, 0x38,
-    0x1E, 0x00, 0xB8, 0x0F, 0x81, 0xF0, 0x03, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x1F, 0x41, 0xF8, 0x3D,
-    0x00, 0x3C, 0x7C, 0x00, 0x3D, 0x3D, 0x00, 0x3D, 0x3F, 0x41, 0xFC, 0x1F, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x01, 0xFE, 0x40, 0x0F, 0x9B, 0xD0, 0x2D, 0x01, 0xF0, 0x3C, 0x00, 0xF4, 0x38, 0x00, 0xBC,
-    0x78, 0x00, 0x7C, 0x38, 0x00, 0x7C, 0x3C, 0x00, 0x7C, 0x2F, 0x01, 0xFC, 0x0F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x0F, 0xAB, 0xF4, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF,
-    0x80, 0x0A, 0x07, 0xD2, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x81, 0xF4, 0xBE,
-    0x3F, 0x80, 0x1A, 0x0F, 0xC3, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF4,
-    0xFC, 0x3F, 0x1F, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xF4,
-    0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F,
-    0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0x00, 0x00,
-    0x00, 0x2C, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x2A, 0xA5, 0x50, 0x14, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x6F, 0xFC, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFE, 0x40, 0x07, 0xFE, 0x40, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x2F, 0xFF, 0xE0, 0x3D, 0x02, 0xF4, 0x10, 0x00, 0xBC,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0xF9, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x07, 0x41,
-    0xFB, 0x01, 0xC0, 0x3C, 0x0C, 0x2C, 0x03, 0x00, 0xF0, 0x50, 0x70, 0x0C, 0x07, 0xC2, 0x41, 0xC0,
-    0x30, 0x2F, 0x0A, 0x0B, 0x02, 0xC0, 0xBC, 0x1F, 0xFD, 0x2D, 0x01, 0xF8, 0x1A, 0x6F, 0xE0, 0x03,
-    0xF0, 0x00, 0x14, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x01, 0x90, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2E,
-    0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00,
-    0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F, 0x00,
-    0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x3F, 0xFA,
-    0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3D, 0x00, 0x7D, 0x03, 0xD0, 0x01, 0xE0, 0x3D, 0x00, 0x0F, 0x03,
-    0xD0, 0x01, 0xE0, 0x3D, 0x00, 0x7D, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xF8, 0x03, 0xD0, 0x02,
-    0xF4, 0x3D, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x7C, 0x3D, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0xFD, 0x3E,
-    0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xAA, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x3F, 0xFA, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0xF4, 0x01, 0xFF, 0x40, 0x3D, 0x00, 0x07, 0xF0, 0x0F, 0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0xF4, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00, 0x1F, 0x83, 0xD0, 0x00,
-    0x07, 0xE0, 0xF4, 0x00, 0x02, 0xF8, 0x3D, 0x00, 0x02, 0xFD, 0x0F, 0x95, 0xAB, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD, 0x5A, 0x40, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA,
-    0x90, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x0A, 0xBF, 0xFC, 0x3F, 0xFF,
-    0xE1, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFA, 0xA9, 0x0B, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xE0, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x90, 0xFC, 0x00, 0x2F, 0xFE,
-    0x3F, 0x00, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0B, 0x41, 0xFE, 0x00, 0x03, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xBF, 0xF9, 0x00, 0x05, 0x00,
-    0x00, 0x50, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40,
-    0x01, 0xFD, 0x3F, 0x80, 0x01, 0xFD, 0x2A, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC,
-    0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00,
-    0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x3F, 0xFD, 0x0F, 0xFF, 0x03, 0xFF,
-    0x00, 0xA5, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0x80, 0x03, 0xE0,
-    0xFC, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x2F, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F,
-    0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0A, 0x90, 0x00,
-    0x0A, 0x90, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0xFF, 0x40, 0x02, 0xFE, 0x07, 0xFE, 0x00, 0x0F, 0xF8,
-    0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0xC1, 0xFB, 0xF0, 0x0F, 0xFF, 0x07, 0xCF,
-    0xD0, 0xBD, 0xFC, 0x2F, 0x2F, 0xC3, 0xF3, 0xF0, 0xBC, 0x7F, 0x1F, 0x8F, 0xC2, 0xF0, 0xFE, 0xFD,
-    0x3F, 0x0B, 0xD1, 0xFF, 0xF0, 0xFD, 0x3F, 0x43, 0xFF, 0x83, 0xF4, 0xFD, 0x0B, 0xFC, 0x1F, 0xD3,
-    0xF4, 0x1F, 0xF0, 0x7F, 0x8F, 0xE0, 0x3F, 0x41, 0xFE, 0x3F, 0x80, 0x68, 0x0B, 0xF8, 0xFE, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F,
-    0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F,
-    0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F,
-    0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F,
-    0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00,
-    0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80,
-    0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x07,
-    0xFF, 0xFF, 0x01, 0xF0, 0x07, 0xF0, 0x7C, 0x00, 0x3C, 0x2F, 0x00, 0x0F, 0x4B, 0xC0, 0x03, 0xC2,
-    0xF0, 0x07, 0xF0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x0F, 0xEA, 0x50, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x7F, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,
-    0x07, 0xCF, 0xC0, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x60, 0x3E, 0x1F, 0xD0,
-    0x3F, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xAA,
-    0x40, 0x0F, 0xFE, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x0E, 0x00, 0xBC, 0x00, 0xE0, 0x03, 0xD0, 0x0E,
-    0x00, 0x2E, 0x01, 0xE0, 0x01, 0xE0, 0x1E, 0x00, 0x3E, 0x01, 0xE0, 0x1F, 0xD0, 0x1F, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x40, 0x3E, 0x03, 0xF4,
-    0x02, 0xF0, 0x3F, 0x40, 0x3F, 0x43, 0xF4, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x03, 0xFC,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x50, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2A, 0x00, 0x01, 0xA8, 0xFD, 0x00, 0x0B,
-    0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xE3,
-    0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x06, 0x82, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x01, 0xF8, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFD,
-    0x0B, 0xF0, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x2F, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xF4, 0x0B, 0xFC, 0x03, 0xF0,
-    0x03, 0xE0, 0x3F, 0xF4, 0x1F, 0x80, 0x0F, 0xC2, 0xFF, 0xF0, 0xBD, 0x00, 0x3F, 0x0F, 0xDB, 0xD3,
-    0xF0, 0x00, 0xBD, 0xBF, 0x1F, 0xCF, 0xC0, 0x01, 0xFB, 0xF8, 0x3F, 0xBE, 0x00, 0x03, 0xFF, 0xC0,
-    0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x1A, 0x01, 0xF0,
-    0x00, 0x0F, 0x40, 0x3E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xD0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0x6F,
-    0xC0, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F,
-    0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0x40, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00,
-    0x7F, 0xF4, 0x7F, 0xF0, 0x15, 0x50, 0x10, 0x00, 0x20, 0x00, 0x70, 0x00, 0x34, 0x00, 0x3C, 0x00,
-    0x2C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0B, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x02, 0xD0, 0x01, 0xE0,
-    0x00, 0xF0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x7F, 0xF0,
-    0x7F, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0xB8,
-    0x00, 0xB8, 0x00, 0xB8, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0x3C, 0x2F, 0xFC, 0x1F, 0xFC, 0x05, 0x54, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3F, 0x40, 0x3C,
-    0x74, 0x38, 0x03, 0x40, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x7C, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B,
-    0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00,
-    0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0xA8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x19, 0x00, 0x7E, 0xFF, 0xD0, 0x7F, 0xE5, 0xF4, 0x3F, 0x00, 0x3C, 0x3E, 0x00, 0x2D, 0x3E, 0x00,
-    0x1E, 0x3D, 0x00, 0x1E, 0x3E, 0x00, 0x3D, 0x3F, 0x41, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03, 0xE0, 0x00,
-    0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0xDA, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0xF8, 0xF0,
-    0x0B, 0xFF, 0xBC, 0x0B, 0x81, 0xFF, 0x03, 0xC0, 0x0F, 0xC1, 0xD0, 0x03, 0xF0, 0xB0, 0x00, 0xBC,
-    0x2D, 0x00, 0x3F, 0x0B, 0x80, 0x0F, 0xC1, 0xFD, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0x00, 0x2F, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x64,
-    0x1F, 0xE0, 0xF0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x0F, 0xFF, 0xEF, 0xFF, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x02, 0xF8, 0x74, 0x7F,
-    0xFF, 0xE3, 0xD1, 0xFF, 0x5D, 0x00, 0xFD, 0xB0, 0x02, 0xF7, 0xC0, 0x07, 0xDB, 0x00, 0x1F, 0x6C,
-    0x00, 0xBD, 0x79, 0x5B, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0xBE, 0x3C, 0x00, 0x02, 0xF0,
-    0x40, 0x2F, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x1B, 0xF9, 0x00, 0x2D, 0x00, 0x00, 0xB0, 0x00,
-    0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xCF, 0xF4, 0x0F, 0xFF,
-    0xF8, 0x3F, 0x92, 0xF0, 0xF8, 0x02, 0xD7, 0xC0, 0x07, 0x5F, 0x00, 0x1E, 0x7C, 0x00, 0x7A, 0xF0,
-    0x01, 0xEB, 0xC0, 0x07, 0xAF, 0x00, 0x2F, 0xBC, 0x00, 0xBF, 0xF0, 0x03, 0xF0, 0x7C, 0xBC, 0xFD,
-    0x54, 0x00, 0x00, 0x10, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78, 0x7C, 0x7C, 0xBC, 0xBC, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xB8, 0x01, 0xF4, 0x3F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07,
-    0xC2, 0xD0, 0x1F, 0x2F, 0x00, 0x79, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xF0, 0x02, 0xE3, 0xF0, 0x0B, 0xC7, 0xF0, 0x2F, 0x0B, 0xF4, 0xFC, 0x0F, 0xF4, 0x0E, 0x00,
-    0x3C, 0x01, 0xE0, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xD4, 0x0F, 0xFC, 0x3F, 0xF0, 0x18, 0x2F, 0x80, 0xBE,
-    0x00, 0xBB, 0xFF, 0xCF, 0xFF, 0x02, 0xFC, 0x0F, 0xF8, 0x2D, 0x0F, 0xC0, 0x1F, 0x80, 0x38, 0x3E,
-    0x00, 0x3D, 0x00, 0xF0, 0xF4, 0x00, 0xF0, 0x03, 0xC3, 0xD0, 0x03, 0xC0, 0x0F, 0x1F, 0x00, 0x1F,
-    0x00, 0x3C, 0x7C, 0x00, 0xB8, 0x01, 0xF2, 0xF0, 0x03, 0xE0, 0x07, 0xCB, 0xC0, 0x0F, 0x40, 0x1F,
-    0x3F, 0x00, 0x3D, 0x00, 0xBC, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C,
-    0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03,
-    0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78,
-    0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x04, 0x1B, 0x90, 0x07, 0xAF, 0xFE,
-    0x01, 0xFF, 0x02, 0xC0, 0x3F, 0x00, 0x38, 0x0F, 0x80, 0x0F, 0x03, 0xD0, 0x02, 0xC0, 0xF8, 0x00,
-    0xB0, 0x3F, 0x00, 0x3C, 0x0F, 0xE0, 0x1F, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF,
-    0x80, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD2, 0x80, 0x0F, 0xEF, 0x7C, 0x03,
-    0xD0, 0x3F, 0xC0, 0x78, 0x00, 0xFC, 0x0B, 0x40, 0x0F, 0xC0, 0xB0, 0x00, 0xFC, 0x0F, 0x00, 0x0F,
-    0x80, 0xB0, 0x01, 0xF8, 0x07, 0xC0, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x00, 0xFF, 0xFB, 0x40, 0x02,
-    0xFD, 0x74, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x04, 0x3D, 0xFD, 0x3F, 0xFD, 0x3F, 0x40, 0x3E, 0x00, 0x3E, 0x00,
-    0x3D, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x81, 0xFA,
-    0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00, 0x7E,
-    0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x74, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x17, 0xD5, 0x2F, 0xFF, 0xE0, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xF0,
-    0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xFF, 0x80, 0xBF, 0xF4, 0x1F, 0xFE, 0xF0, 0x00,
-    0xF2, 0xD0, 0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80,
-    0x0F, 0x5F, 0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x50,
-    0x00, 0x01, 0x1E, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xE0, 0xB8, 0x00, 0xF4, 0x0F, 0x00, 0x7C, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x0F, 0x00, 0x0B, 0xCB, 0x40, 0x01, 0xFB, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x14, 0xBC, 0x00, 0x00, 0x3C, 0x7C, 0x00,
-    0x00, 0x7C, 0x3D, 0x00, 0x00, 0xB8, 0x3E, 0x07, 0xC0, 0xF4, 0x2F, 0x0F, 0xE0, 0xF0, 0x1F, 0x3F,
-    0xF5, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xC0, 0x03, 0xF8,
-    0x3F, 0xC0, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0x40, 0x3E, 0x01, 0xF0, 0x2F, 0x00, 0x3F, 0x1F, 0x00,
-    0x03, 0xEF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFF, 0x40,
-    0x03, 0xF3, 0xF0, 0x03, 0xF0, 0x7E, 0x02, 0xF4, 0x0B, 0xD1, 0xF8, 0x00, 0xFC, 0xB4, 0x00, 0x3C,
-    0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03,
-    0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x2A, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x2F,
-    0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFE, 0xAA, 0x4B, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0x05, 0x40, 0x0B, 0xFC, 0x01, 0xF4, 0x00, 0x2E, 0x00, 0x02, 0xE0,
-    0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1B, 0xC0, 0x07, 0xE0, 0x00, 0x7F, 0x40, 0x00,
-    0xBC, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x24, 0xE3, 0x8E, 0x38, 0xD3, 0x4D, 0x34, 0xD3, 0x4D, 0x34,
-    0xC3, 0x1C, 0x71, 0xC0, 0x15, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x7D, 0x40, 0x01, 0xFC, 0x00, 0x2F, 0xC0,
-    0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x01, 0xFF,
-    0x80, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x3F, 0xC2, 0xF8, 0x1F, 0x80, 0x00, 0x01, 0x80, 0xFC, 0x0B, 0xC0, 0xBC, 0x0B,
-    0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x04, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x06, 0xFE, 0x02, 0xFF, 0xF0,
-    0x3E, 0xB0, 0x0B, 0xCB, 0x00, 0xB4, 0xB0, 0x0F, 0x4B, 0x00, 0xF4, 0xB0, 0x0B, 0x8B, 0x00, 0xBD,
-    0xB0, 0x03, 0xFF, 0xA0, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x0B,
-    0xD0, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x14, 0xB0, 0x1F, 0xFF, 0xF4,
-    0x0B, 0x82, 0xE0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x82, 0xF0, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFC, 0x2C, 0x14, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x42, 0xE0, 0x00, 0xB8, 0x0F,
-    0x80, 0x2F, 0x00, 0x7E, 0x0B, 0xC0, 0x02, 0xF6, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0xFF, 0xFA, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x05, 0x7F, 0xA8, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xE3, 0x8E, 0x38, 0xD2, 0x40, 0x00, 0x02, 0x4D,
-    0x34, 0xC3, 0x1C, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0x90, 0x74, 0x03, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x1F, 0x40, 0x3C,
-    0x2C, 0x00, 0x2C, 0x2E, 0x00, 0x3C, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xF8, 0x04, 0x02, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x2A, 0xE9, 0x00, 0x7C, 0x0B,
-    0x8B, 0xC0, 0xFC, 0xFD, 0x0F, 0xC5, 0x40, 0x54, 0x06, 0xA4, 0x05, 0x65, 0x82, 0x20, 0x15, 0x54,
-    0x01, 0x16, 0x01, 0x48, 0xB8, 0x80, 0x80, 0x90, 0x0A, 0x80, 0x00, 0x00, 0x3E, 0x43, 0x0E, 0x18,
-    0x18, 0x50, 0x61, 0x83, 0xC3, 0xFF, 0x02, 0x84, 0x00, 0x20, 0x04, 0x02, 0xC0, 0xE0, 0x3D, 0x1F,
-    0x07, 0xC1, 0xF0, 0x3C, 0x1E, 0x00, 0xF8, 0x7D, 0x00, 0xFC, 0xBD, 0x00, 0xF8, 0xBD, 0x00, 0xE0,
-    0x70, 0x00, 0x00, 0x40, 0x7F, 0xA9, 0x41, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x06, 0xA4, 0x05,
-    0x51, 0x82, 0x22, 0x15, 0x4F, 0xC1, 0x23, 0x21, 0x48, 0xC9, 0x80, 0xD1, 0xD0, 0x06, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0xAF, 0x07, 0xC0, 0x78,
-    0xB4, 0x03, 0xCF, 0x00, 0x3C, 0xB8, 0x07, 0xC7, 0xE6, 0xF8, 0x2F, 0xFF, 0x00, 0x7F, 0x80, 0x00,
-    0x24, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xE0, 0x00,
-    0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFF, 0xFE, 0x05, 0x00, 0x00,
-    0x1A, 0x01, 0x1C, 0x00, 0xC0, 0x1C, 0x07, 0x42, 0xD0, 0x3F, 0xD1, 0x54, 0x1A, 0x40, 0x05, 0x00,
-    0x50, 0xB8, 0x00, 0x90, 0x06, 0x2A, 0xE3, 0xF8, 0x00, 0x0D, 0x1C, 0x3C, 0x74, 0x3C, 0x00, 0x3C,
-    0x7D, 0x00, 0x3C, 0x7D, 0x00, 0x3C, 0x7D, 0x00, 0x3C, 0x7E, 0x00, 0x3C, 0x7E, 0x00, 0x3C, 0x7E,
-    0x00, 0x3D, 0x7F, 0x00, 0xBD, 0xBF, 0xEB, 0xFD, 0xBF, 0xFF, 0xFD, 0xBB, 0xFF, 0xFD, 0xB2, 0xFE,
-    0x3D, 0xB0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x90, 0xA0, 0x7F, 0x83, 0xC3, 0xFE, 0x0B, 0x1F,
-    0xF4, 0x2C, 0x7F, 0xD0, 0xB0, 0xFF, 0x42, 0xC1, 0xFD, 0x0B, 0x01, 0xF0, 0x2C, 0x0B, 0xC0, 0xB0,
-    0x2F, 0x02, 0xC0, 0xFC, 0x0B, 0x03, 0xF0, 0x2C, 0x1F, 0xC0, 0xB0, 0xBF, 0x02, 0xC2, 0xF8, 0x0B,
-    0x0F, 0xE0, 0x1C, 0x3F, 0x80, 0x70, 0x14, 0x7C, 0xBC, 0xFD, 0x10, 0x08, 0x03, 0x80, 0x08, 0x03,
-    0x1F, 0x40, 0x00, 0x01, 0xD0, 0x19, 0x00, 0x90, 0x09, 0x00, 0x90, 0x0D, 0x03, 0xFC, 0x15, 0x40,
-    0x1F, 0x80, 0xC2, 0x86, 0x03, 0x28, 0x0C, 0x70, 0x70, 0xFF, 0x40, 0x64, 0x00, 0x40, 0x10, 0x01,
-    0xD0, 0xB0, 0x02, 0xE0, 0xF4, 0x02, 0xE0, 0xB4, 0x01, 0xE0, 0xF4, 0x0F, 0xC7, 0xD0, 0xFC, 0xBD,
-    0x0F, 0xC7, 0xD0, 0x38, 0x0D, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0xD0, 0x00,
-    0x70, 0x00, 0x2C, 0x00, 0x07, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x1C,
-    0x00, 0x07, 0xFF, 0x43, 0x80, 0x00, 0x7F, 0xF4, 0xB0, 0x01, 0x00, 0x00, 0x1D, 0x00, 0xE0, 0x00,
-    0x03, 0xC0, 0x2E, 0x00, 0x00, 0xB4, 0x07, 0xB0, 0x00, 0x0E, 0x00, 0xD7, 0x00, 0x02, 0xC0, 0x3C,
-    0x70, 0x00, 0x78, 0x07, 0xAF, 0x90, 0x0F, 0x00, 0x55, 0xBD, 0x02, 0xD0, 0x00, 0x0B, 0x00, 0x28,
-    0x00, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x70,
-    0x00, 0x70, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0x70, 0x00, 0x34, 0x00, 0x07, 0x00,
-    0x0B, 0x00, 0x00, 0x70, 0x01, 0xD0, 0x00, 0x7F, 0xF4, 0x38, 0xBF, 0x47, 0xFF, 0x47, 0x29, 0x2D,
-    0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x0A, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0xF0,
-    0x00, 0x2C, 0x00, 0x1D, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0xB4, 0x00, 0xFC, 0x00,
-    0x0F, 0x00, 0x1F, 0xFF, 0x03, 0xD0, 0x02, 0xFF, 0xF0, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x0D, 0x00,
-    0x0B, 0xF4, 0x00, 0xB0, 0x00, 0x01, 0xD0, 0x03, 0x40, 0x00, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x03,
-    0x41, 0xC0, 0x00, 0x10, 0x2C, 0x0E, 0x00, 0x00, 0xFF, 0xE0, 0xB0, 0x01, 0x02, 0xFE, 0x07, 0x40,
-    0x38, 0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x02, 0xD0, 0x1E, 0xC0, 0x00, 0x0E, 0x00, 0xD7, 0x00,
-    0x00, 0xB0, 0x0F, 0x1C, 0x00, 0x07, 0x80, 0x7A, 0xF9, 0x00, 0x3C, 0x01, 0x56, 0xF4, 0x02, 0xD0,
-    0x00, 0x0B, 0x00, 0x0A, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x2F, 0x80, 0x7C, 0x0B, 0xFF, 0xF8, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00,
-    0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x0F,
-    0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x01,
-    0xF1, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xFE, 0xAA, 0xBE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xE0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x74, 0x78, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83,
-    0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0x41, 0x40, 0x00, 0x07, 0x70, 0x90, 0x00, 0x02, 0x87, 0x70, 0x00, 0x00, 0xD0,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00,
-    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C,
-    0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA,
-    0xAF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x0F, 0x42, 0xF0, 0x00,
-    0x07, 0xE0, 0xFD, 0x00, 0x01, 0x54, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF,
-    0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F,
-    0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00,
-    0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F,
-    0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA,
-    0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD1, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xC1, 0xFD, 0x5A, 0x00, 0x00, 0x0F, 0x40, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0xAA, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xA4, 0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0x40,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xAA, 0xF0, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x42, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF4, 0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x56, 0x90, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFE, 0xAA, 0xA4, 0x3F,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF4,
-    0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x56, 0x90,
-    0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xFE, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0x00, 0x04, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xB8, 0x00, 0x07, 0x43, 0x80, 0x02, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x0B, 0xC0,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xD5, 0xA4, 0x02, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3F, 0xAA, 0xA9, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x01,
-    0x40, 0x14, 0x00, 0xF4, 0x1F, 0x00, 0x7E, 0x0B, 0xC0, 0x2F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xD5, 0xA4, 0x02, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3F, 0xAA, 0xA9, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0xB4,
-    0x00, 0xB8, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x03, 0xF0, 0x0F, 0xC0, 0x3F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC,
-    0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0xD0, 0xB0, 0x38, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x3F, 0x0F, 0xC3, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2,
-    0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFE, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x7F, 0x00, 0x74, 0xE0, 0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x1F, 0x03, 0xE0, 0xBC, 0x0F, 0x83, 0xF0,
-    0x3F, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFF,
-    0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x01, 0xFF,
-    0x40, 0x03, 0xD0, 0x00, 0x7F, 0x00, 0x0F, 0x40, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00,
-    0xF4, 0x00, 0x02, 0xF0, 0xFF, 0xFF, 0xC0, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x3D, 0x00,
-    0x00, 0x7E, 0x00, 0xF4, 0x00, 0x02, 0xF8, 0x03, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0x95, 0xAF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x82, 0x40, 0x00, 0x28, 0xE3, 0x40,
-    0x00, 0x34, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0F, 0xD0, 0x00, 0x3D,
-    0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC,
-    0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0xC0, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC,
-    0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC,
-    0x3F, 0x80, 0x7F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC,
-    0xF8, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0, 0x00,
-    0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF, 0x40,
-    0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8B,
-    0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x24,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
-    0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0x81, 0xF8, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x7D,
-    0x3F, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00,
-    0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE2, 0xF8, 0x00, 0x03, 0xF4, 0x7F, 0xE9,
-    0x6B, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0x80, 0x00, 0x07, 0x34, 0x60,
-    0x00, 0x01, 0xC3, 0x74, 0x00, 0x00, 0x50, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0,
-    0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF,
-    0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F,
-    0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x03, 0xC0, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x54, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0,
-    0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00,
-    0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00,
-    0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x0B, 0x40, 0x7E, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0x9F,
-    0x42, 0xA0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x07,
-    0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x83,
-    0xE0, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x7D, 0x03, 0xE0, 0x00, 0x00,
-    0xF4, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x0F, 0x82, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x7E, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x6F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0x1A, 0x8F, 0xD0, 0x00, 0xBF, 0x3F, 0x40, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3,
-    0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE3, 0xF0,
-    0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD2, 0xF4, 0x00,
-    0x2F, 0x4B, 0xF0, 0x01, 0xFD, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x53, 0xF4, 0x00,
-    0x2F, 0xCF, 0xD0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x0B, 0xD2, 0xFC, 0x00, 0x7F, 0x47, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0E, 0x1E, 0x00,
-    0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x6A, 0x3F,
-    0x40, 0x02, 0xFC, 0xFD, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00,
-    0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xBD, 0x2F, 0xC0, 0x07, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0x15,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x1A, 0x8F, 0xD0, 0x00,
-    0xBF, 0x3F, 0x40, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7E,
-    0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E, 0x2F,
-    0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x2F, 0x4B, 0xF0, 0x01, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00,
-    0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xE8, 0x00, 0xFF, 0xF8, 0x0F, 0x07, 0xF0,
-    0xF0, 0x0B, 0xCF, 0x00, 0x2D, 0xF0, 0x00, 0xDF, 0x00, 0x2D, 0xF0, 0x0F, 0xCF, 0x4B, 0xF0, 0xFF,
-    0xF8, 0x0F, 0xF8, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x1D, 0x00, 0x70, 0x2C, 0x00, 0x30, 0x3C, 0x03, 0xE0, 0x3C, 0x0E,
-    0x00, 0x3C, 0x0C, 0x00, 0x3C, 0x0D, 0x00, 0x3C, 0x0F, 0x40, 0x3C, 0x03, 0xE0, 0x3C, 0x00, 0xFC,
-    0x3D, 0x00, 0x2D, 0x3D, 0x00, 0x1D, 0x3D, 0xA5, 0xBD, 0x7D, 0xBF, 0xFC, 0x7D, 0x6F, 0xE0, 0x01,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C,
-    0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01,
-    0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54,
-    0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C,
-    0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE,
-    0x4F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xD7, 0x80, 0x07, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C,
-    0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x02, 0xE0, 0x20, 0x03, 0x68, 0x70, 0x07, 0x0D, 0xA0,
-    0x07, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E,
-    0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42,
-    0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x0B, 0xC0, 0xF4, 0x0F, 0xC0, 0xF8,
-    0x0F, 0xC1, 0xF8, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B,
-    0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00,
-    0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x2A, 0x00,
-    0x00, 0x82, 0x00, 0x00, 0xD2, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00,
-    0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE,
-    0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xD5, 0x2F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFE, 0x03, 0x80, 0x2E, 0x03, 0xFD, 0x00, 0x34, 0x0E, 0x00, 0x7E, 0x01, 0x5F, 0x07, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC2, 0xC0, 0x03, 0xFA, 0x95, 0x40, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xD0, 0xBF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xBF,
-    0xFF, 0xF8, 0x01, 0xBE, 0x4F, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03,
-    0xE0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0xDA, 0x01, 0xFF, 0xF8, 0x06, 0xFF, 0x80, 0x08, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x60,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x0E,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02,
-    0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5,
-    0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x01, 0xBF, 0xD0, 0x00, 0x20, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xEE, 0x00, 0x0B, 0x03, 0x80, 0x04,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41,
-    0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x05,
-    0x00, 0x50, 0x0F, 0x42, 0xF0, 0x1F, 0x43, 0xF0, 0x2F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70,
-    0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x2D, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x78,
-    0x01, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0x0D, 0x2C, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78, 0x7C, 0x7C, 0xBC, 0xBC, 0x00, 0x80,
-    0x00, 0xBC, 0x00, 0xBB, 0x80, 0xB0, 0x38, 0x10, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x80,
-    0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1F, 0x00,
-    0x07, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x05, 0x01, 0x40, 0xBC, 0x0F, 0x82, 0xF0, 0x3F, 0x0F,
-    0xD1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x64, 0x0D, 0x00, 0x0B, 0xFF, 0x4D, 0x00, 0x1F, 0x43, 0xDC, 0x00, 0x3D, 0x00, 0xFC,
-    0x00, 0x3C, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x3E, 0x00, 0xF0,
-    0x00, 0x2F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x20,
-    0x0D, 0xA1, 0x80, 0x70, 0xDA, 0x01, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x46, 0x90,
-    0x0F, 0xFF, 0xF0, 0x3F, 0x42, 0xE0, 0xF4, 0x03, 0xC7, 0xC0, 0x0F, 0x1F, 0x00, 0x3D, 0x7C, 0x00,
-    0xF6, 0xF0, 0x03, 0xDB, 0xC0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFB, 0xF0, 0x03, 0xE0, 0x0A,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78,
-    0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D,
-    0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00,
-    0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0x07, 0x40, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00,
-    0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x07, 0xD0, 0xC0, 0x0E, 0x74, 0xC0, 0x0D,
-    0x1F, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02,
-    0xFE, 0x00, 0x1F, 0x02, 0xF0, 0x1F, 0x43, 0xF0, 0x2F, 0x43, 0xF0, 0x15, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0,
-    0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D,
-    0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x56, 0xAA, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xD0,
-    0x0F, 0x47, 0xBC, 0x07, 0x82, 0xD7, 0x82, 0xD0, 0xF0, 0xF0, 0xB4, 0x78, 0x3C, 0x3D, 0x2D, 0x0F,
-    0x0B, 0x8F, 0x07, 0xC1, 0xFB, 0xC7, 0xE0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0x1F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03,
-    0xCB, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xF4, 0x2F, 0xE3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00,
-    0x1D, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x80, 0x0F,
-    0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xF4, 0x2F, 0xE3, 0xD0, 0x00, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0xB6, 0xD0, 0x0A, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03, 0xCB,
-    0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xF4, 0x2F, 0xE3, 0xD0, 0x14, 0x01, 0x40, 0xF8, 0x0F, 0x43, 0xF0, 0x7D, 0x1F, 0xC2,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0,
-    0x03, 0xCB, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xF4, 0x2F, 0xE3, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E,
-    0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7,
-    0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x10,
-    0x00, 0x07, 0x40, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xEF, 0x80, 0x38, 0x2E,
-    0x03, 0x80, 0xB8, 0x38, 0x02, 0xC3, 0x80, 0x2C, 0x38, 0x03, 0xC3, 0x80, 0x38, 0x38, 0x0F, 0x03,
-    0x87, 0xD0, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x38, 0x00, 0x00, 0x05, 0x00, 0x50, 0x0F, 0x81, 0xF0, 0x0F, 0x82, 0xF4, 0x1F, 0xC3, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C,
-    0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2,
-    0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x15, 0x6A, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x01, 0xF1, 0xF0,
-    0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x0F, 0x80,
-    0x3E, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xFE, 0xAA, 0xBE, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x02, 0xF8, 0x01, 0x5A, 0xA4, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C,
-    0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x38,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00,
-    0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0, 0x00,
-    0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80,
-    0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D,
-    0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E,
-    0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C,
-    0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03,
-    0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC,
-    0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD5, 0x00, 0x3F, 0xFF, 0xC0, 0x2E, 0x03, 0xF0, 0x0E, 0x00, 0x7C, 0x07, 0x00,
-    0x0F, 0x02, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x7D, 0x0B, 0xD0, 0xBF, 0x80, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xB8, 0x01, 0xBE, 0x5F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFF,
-    0x00, 0xFF, 0x95, 0x90, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0x0F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x0B, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0xA0, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x07, 0x43, 0x80, 0x00,
-    0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0x95, 0x90, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0x0F, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x1F, 0x00, 0x07, 0xBC, 0x01, 0xD0, 0xB0, 0x10, 0x00, 0x40, 0x00, 0x00, 0x06,
-    0xFE, 0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0B, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0xA0, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x02, 0xFF, 0xFF, 0x00, 0xFF, 0x95, 0x90, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0x0F, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0xDA, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x90, 0x09, 0x00, 0x03, 0x87, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xAA, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x34, 0x0B, 0x5D, 0x00, 0x2F, 0x80, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x0B, 0xC0,
-    0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0xA0,
-    0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0B, 0x00,
-    0x00, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0x40, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xF4, 0x01, 0xFF, 0x40, 0x3D, 0x00, 0x07, 0xF0, 0x0F,
-    0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0xBD,
-    0x0F, 0x40, 0x00, 0x1F, 0x83, 0xD0, 0x00, 0x07, 0xE0, 0xF4, 0x00, 0x02, 0xF8, 0x3D, 0x00, 0x02,
-    0xFD, 0x0F, 0x95, 0xAB, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x40,
-    0x00, 0x00, 0xB4, 0x74, 0x00, 0x00, 0x2C, 0x1D, 0x00, 0x00, 0x0B, 0x0B, 0x40, 0x00, 0x03, 0xC2,
-    0xC0, 0x0B, 0xF8, 0xF0, 0x00, 0x0B, 0xFF, 0xBC, 0x00, 0x0B, 0x81, 0xFF, 0x00, 0x03, 0xC0, 0x0F,
-    0xC0, 0x01, 0xD0, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x3F, 0x00, 0x0B, 0x80,
-    0x0F, 0xC0, 0x01, 0xFD, 0x6F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x01, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x7F, 0x00,
-    0x0F, 0x40, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0xFF, 0xFF,
-    0xC0, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x02,
-    0xF8, 0x03, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0x95, 0xAF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xBF, 0x8F, 0x00, 0x02, 0xFF, 0xEF, 0x00, 0x0B, 0x81,
-    0xFF, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x1D, 0x00, 0x3F, 0x00, 0x2C, 0x00, 0x2F, 0x00, 0x2D, 0x00,
-    0x3F, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x1F, 0xD6, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x6A, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xFF, 0xFF,
-    0xE0, 0xBF, 0xFF, 0xF4, 0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2F, 0x56, 0x90, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFE, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x2A, 0xA9, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x0B, 0x00, 0x38, 0x03, 0x80, 0x07, 0xFF, 0xC0, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD,
-    0x5A, 0x40, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xA0, 0x0E, 0x01, 0xD0, 0x07, 0xFF, 0xC0, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC,
-    0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x2F,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x43, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF,
-    0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xD0,
-    0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD, 0x5A, 0x40,
-    0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x75, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0x78,
-    0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x50, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0xFE, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x28, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xE4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x24, 0x00, 0x3C, 0x78,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x54, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xD0, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA,
-    0xAA, 0x43, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x01, 0xC0, 0x03, 0xCB, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x00, 0x74, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0xA4, 0x3F, 0x00, 0x0B, 0xFF, 0x8F, 0xC0, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x02, 0xD0, 0x7F,
-    0x80, 0x00, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xAF, 0xFE, 0x40, 0x00, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0xF0, 0x03, 0x80, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x87, 0x47, 0xFF, 0xFE, 0x3D, 0x1F, 0xF5, 0xD0, 0x0F, 0xDB,
-    0x00, 0x2F, 0x7C, 0x00, 0x7D, 0xB0, 0x01, 0xF6, 0xC0, 0x0B, 0xD7, 0x95, 0xBF, 0x0F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF0, 0x0B, 0xE3, 0xC0, 0x00, 0x2F, 0x04, 0x02, 0xF8, 0x3F, 0xFF, 0xC1, 0xFF, 0xFD,
-    0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x34, 0x00, 0x01, 0xD0, 0x2C,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFA,
-    0x43, 0xF0, 0x00, 0xBF, 0xF8, 0xFC, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x2D, 0x07, 0xF8, 0x00,
-    0x0F, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0A,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x80, 0xE0, 0x1D, 0x02, 0xFF, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x74, 0x7F, 0xFF, 0xE3, 0xD1,
-    0xFF, 0x5D, 0x00, 0xFD, 0xB0, 0x02, 0xF7, 0xC0, 0x07, 0xDB, 0x00, 0x1F, 0x6C, 0x00, 0xBD, 0x79,
-    0x5B, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0xBE, 0x3C, 0x00, 0x02, 0xF0, 0x40, 0x2F, 0x83,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xE9,
-    0x0F, 0xC0, 0x02, 0xFF, 0xE3, 0xF0, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x00, 0xB4, 0x1F, 0xE0, 0x00,
-    0x3D, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x2B,
-    0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1D, 0x1F, 0xFF, 0xF8, 0xF4, 0x7F, 0xD7, 0x40,
-    0x3F, 0x6C, 0x00, 0xBD, 0xF0, 0x01, 0xF6, 0xC0, 0x07, 0xDB, 0x00, 0x2F, 0x5E, 0x56, 0xFC, 0x3F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x2F, 0x8F, 0x00, 0x00, 0xBC, 0x10, 0x0B, 0xE0, 0xFF, 0xFF, 0x07,
-    0xFF, 0xF4, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFE, 0x90, 0xFC, 0x00, 0x2F, 0xFE, 0x3F, 0x00, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0B,
-    0x41, 0xFE, 0x00, 0x03, 0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x74, 0x7F, 0xFF, 0xE3, 0xD1, 0xFF, 0x5D, 0x00, 0xFD, 0xB0, 0x02, 0xF7,
-    0xC0, 0x07, 0xDB, 0x00, 0x1F, 0x6C, 0x00, 0xBD, 0x79, 0x5B, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0x00, 0xBE, 0x3C, 0x00, 0x02, 0xF0, 0x40, 0x2F, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x1B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2D, 0x3C,
-    0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x2F, 0x00, 0x00,
-    0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFD, 0x3F, 0x80, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x74, 0xB0, 0x00, 0x60, 0x06,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x3F, 0xD0, 0x03, 0xFF, 0xFE, 0x00, 0xFE, 0x4B, 0xC0, 0x3E,
-    0x00, 0xB4, 0x1F, 0x00, 0x1D, 0x07, 0xC0, 0x07, 0x81, 0xF0, 0x01, 0xE0, 0xBC, 0x00, 0x78, 0x2F,
-    0x00, 0x1E, 0x0B, 0xC0, 0x0B, 0xC2, 0xF0, 0x02, 0xF0, 0xFC, 0x00, 0xFC, 0x06, 0x80, 0x00, 0x29,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0x3F, 0x02, 0xF0, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xC0,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x01, 0xFC,
-    0x0F, 0xD0, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0xB5, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x15, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF3,
-    0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFE, 0x4B, 0xC0, 0x0F, 0x80, 0x2D, 0x01, 0xF0, 0x01, 0xD0,
-    0x1F, 0x00, 0x1E, 0x01, 0xF0, 0x01, 0xE0, 0x2F, 0x00, 0x1E, 0x02, 0xF0, 0x01, 0xE0, 0x2F, 0x00,
-    0x2F, 0x02, 0xF0, 0x02, 0xF0, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0x1F, 0x03, 0x35, 0xC7, 0x30, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
-    0x02, 0xF0, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF8, 0x03, 0xF8, 0x3D, 0x0D, 0xA3, 0x4C,
-    0xD0, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x03, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x05, 0x6A, 0x90, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x6A, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00,
-    0x01, 0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2A, 0x0F, 0xC2,
-    0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBD, 0x2F, 0x4B, 0xD2, 0xF4,
-    0xFE, 0x3F, 0x8F, 0xE1, 0xC0, 0xC0, 0x70, 0x0F, 0xC0, 0x10, 0x1F, 0x0B, 0xC3, 0xF4, 0x54, 0x00,
-    0x00, 0x00, 0x40, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x1E, 0x07, 0x81, 0xF0, 0x7C, 0x2F, 0x0B,
-    0xC3, 0x42, 0x80, 0xA5, 0x0B, 0xC0, 0x00, 0x14, 0x0F, 0x83, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC,
-    0x2F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE0, 0x14, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78,
-    0x7C, 0x7C, 0xBC, 0xBC, 0x2A, 0x00, 0x06, 0x83, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC,
-    0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0xF8, 0x2F, 0x00,
-    0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x3F, 0x40, 0x0F, 0x83, 0xF4, 0x00, 0xF4, 0x3F, 0x80, 0x1F, 0x43,
-    0xF8, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xAF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x52, 0xF0, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x0F,
-    0x95, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x2D, 0x38, 0x00, 0x00, 0xB4, 0xE0, 0x00, 0x02, 0xC3, 0x80, 0x00, 0x0B, 0x0E, 0x00,
-    0x00, 0x3C, 0x78, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x0F, 0x1F, 0x00, 0x00,
-    0x3C, 0xBC, 0x00, 0x00, 0xF2, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x0F, 0xC0, 0x03, 0xCB, 0x00, 0xD0, 0x1C, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F,
-    0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x02, 0xF4, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0x00,
-    0x29, 0x40, 0x00, 0x00, 0x28, 0x00, 0x01, 0xF4, 0x00, 0x1E, 0xB4, 0x01, 0xC0, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x7D, 0x00, 0x3F, 0xF0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0x80, 0x03, 0xE0,
-    0xFC, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x2F, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F,
-    0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-    0x00, 0x07, 0xC2, 0xD0, 0x1F, 0x2F, 0x00, 0x79, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xF0, 0x02, 0xE3, 0xF0, 0x0B, 0xC7, 0xF0, 0x2F, 0x0B, 0xF4, 0xFC, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x02, 0xC7, 0x80,
-    0xF3, 0xC0, 0x3A, 0xD0, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x3B, 0xD0, 0x1D, 0x7D, 0x07,
-    0x4B, 0xD1, 0xD0, 0xFD, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0x40, 0x2C, 0x00, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3C,
-    0x01, 0xE0, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xD4, 0x0F, 0xFC, 0x3F, 0xF0, 0x0A, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0E, 0x00, 0x3C, 0x01,
-    0xE0, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x03, 0xD4, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F,
-    0xD0, 0x3F, 0x01, 0xF8, 0x0B, 0xD0, 0x3F, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x74, 0x2F, 0x00, 0x74, 0x2F, 0x00, 0xB4,
-    0x2F, 0x00, 0xB4, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x15, 0x56, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x07,
-    0x43, 0xC1, 0xD0, 0xF0, 0xB4, 0x78, 0x2C, 0x1E, 0x05, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xB4, 0x00,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xF5, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x1F, 0x00, 0xFC, 0x2F, 0x00, 0xFC, 0x2F, 0x00, 0x54, 0x2F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
-    0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0x01, 0x42, 0xD0, 0xBC, 0x2D, 0x0F, 0xC3, 0xD0,
-    0xFC, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
-    0x3D, 0x40, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x0A, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x0B, 0x40, 0x00, 0x00, 0x1F, 0x1F, 0x00,
-    0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xBF, 0x15, 0x5A, 0x00, 0x1F, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x3D, 0x64, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x7E, 0x3C, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xD4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xE0, 0x00, 0x7D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00,
-    0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0x9F, 0x40,
-    0xBC, 0x1F, 0x8F, 0xC0, 0xFC, 0x1F, 0x8B, 0xD0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0,
-    0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0x80, 0x2F,
-    0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xE0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7,
-    0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D,
-    0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC,
-    0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC,
-    0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8,
-    0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C,
-    0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB,
-    0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x1C, 0x07,
-    0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00,
-    0x7D, 0x0F, 0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00,
-    0xBC, 0x0F, 0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0,
-    0xFC, 0x2F, 0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F,
-    0xF8, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x05, 0x00, 0x20,
-    0x0A, 0x0B, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00,
-    0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0,
-    0x0F, 0xBF, 0x00, 0x3E, 0x00, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x6A, 0x40, 0x2F, 0xFF, 0xD0, 0x2F, 0x81, 0xF0, 0x2F, 0x00, 0xB4, 0x3E, 0x00,
-    0x78, 0x3D, 0x00, 0x7C, 0x3D, 0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x3E, 0x00, 0xBC, 0x3E, 0x00, 0xBC,
-    0x3E, 0x00, 0xBC, 0x7E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0,
-    0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF,
-    0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83,
-    0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80,
-    0x3F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x69,
-    0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0,
-    0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x80, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00,
-    0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80,
-    0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAF, 0xF0, 0x3F,
-    0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x2C, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F,
-    0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00,
-    0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80, 0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xA0, 0x0E, 0x01, 0xD0, 0x0B, 0xFF,
-    0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4,
-    0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x06, 0x00, 0x02, 0x80, 0x02, 0xE0, 0x01, 0xF0,
-    0x00, 0xF8, 0x00, 0xBC, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x1F, 0x80, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00,
-    0x0F, 0x83, 0xE0, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xF8, 0x2F, 0x80, 0x00, 0x3F, 0x41, 0xFF, 0xA5, 0xAF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x19, 0x01, 0xF0, 0x00, 0xB8,
-    0x0B, 0xC0, 0x07, 0xE0, 0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x03, 0xD0, 0x1F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0B, 0x40, 0x03, 0xC0, 0x0B, 0x40, 0x03, 0xC0,
-    0x0F, 0x40, 0x03, 0xC0, 0x0B, 0x80, 0x07, 0xC0, 0x07, 0xD0, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x6F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x07, 0xFE, 0x55, 0x00,
-    0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xD5, 0x80, 0x3E, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFA, 0x5A, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xAA, 0xA8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFE, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
-    0xFE, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xD7, 0xD0, 0x70, 0x3D, 0x01, 0xFE, 0x00, 0x2C, 0x78, 0x00,
-    0x7C, 0x01, 0x6C, 0xB4, 0x00, 0x3F, 0xFF, 0xFE, 0xB4, 0x00, 0x3E, 0xA5, 0x50, 0xF4, 0x00, 0x3C,
-    0x00, 0x00, 0xB8, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xFC, 0x02, 0xFE, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xE0, 0x0B, 0xC0, 0x0E, 0x00,
-    0x3D, 0x00, 0xE0, 0x02, 0xE0, 0x1E, 0x00, 0x1E, 0x01, 0xE0, 0x03, 0xE0, 0x1E, 0x01, 0xFD, 0x01,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x03,
-    0xE0, 0x3F, 0x40, 0x2F, 0x03, 0xF4, 0x03, 0xF4, 0x3F, 0x40, 0x3F, 0x83, 0xF8, 0x03, 0xFC, 0x3F,
-    0x80, 0x3F, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x04, 0x3D, 0xFD, 0x3F, 0xFD, 0x3F, 0x40, 0x3E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x7E, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x0F, 0xFE, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x0E, 0x00,
-    0xBC, 0x00, 0xE0, 0x03, 0xD0, 0x0E, 0x00, 0x2E, 0x01, 0xE0, 0x01, 0xE0, 0x1E, 0x00, 0x3E, 0x01,
-    0xE0, 0x1F, 0xD0, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF4, 0x0B,
-    0xD0, 0x2F, 0x40, 0x3E, 0x03, 0xF4, 0x02, 0xF0, 0x3F, 0x40, 0x3F, 0x43, 0xF4, 0x03, 0xF8, 0x3F,
-    0x80, 0x3F, 0xC3, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x05, 0x01, 0x03, 0xDF, 0xD0, 0xFF, 0xF4,
-    0x3F, 0x40, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x02,
-    0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x2C, 0x0A, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xE0, 0x0B, 0xC0,
-    0x0E, 0x00, 0x3D, 0x00, 0xE0, 0x02, 0xE0, 0x1E, 0x00, 0x1E, 0x01, 0xE0, 0x03, 0xE0, 0x1E, 0x01,
-    0xFD, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x40, 0xBD, 0x02,
-    0xF4, 0x03, 0xE0, 0x3F, 0x40, 0x2F, 0x03, 0xF4, 0x03, 0xF4, 0x3F, 0x40, 0x3F, 0x83, 0xF8, 0x03,
-    0xFC, 0x3F, 0x80, 0x3F, 0xC0, 0x10, 0x00, 0x41, 0xD0, 0x34, 0x07, 0xAD, 0x00, 0x1F, 0x40, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x3D, 0xFD, 0x03, 0xFF, 0xD0, 0x3F, 0x40, 0x03, 0xE0,
-    0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B, 0xE0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFE, 0xAA, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x14, 0x00, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x2C,
-    0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x81,
-    0xFA, 0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00,
-    0x7E, 0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xB4, 0xB0, 0x00, 0x00, 0x60, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xEA, 0xA0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD,
-    0x01, 0x40, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x03,
-    0xED, 0x00, 0xE0, 0x74, 0x14, 0x00, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x81, 0xFA, 0xA4, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00, 0x7E, 0x04, 0x03, 0xF2,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x50,
-    0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFE, 0x90, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xFF, 0x81, 0xFA, 0xA4, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00, 0x7E, 0x04, 0x03, 0xF2,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xF4, 0x00, 0x20, 0x00, 0x0A, 0x40, 0x00, 0x03, 0x00, 0x00,
-    0x70, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x0B, 0x07, 0x40, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x50, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1C, 0x07, 0x4F,
-    0x00, 0x1F, 0xC0, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x81,
-    0xFA, 0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00,
-    0x7E, 0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x15, 0x55, 0x55, 0x54, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x17, 0xD5, 0x2F, 0xFF,
-    0xE0, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0B, 0xC0,
-    0x02, 0xFF, 0x80, 0xBF, 0xF4, 0x1F, 0xFE, 0x00, 0x39, 0x00, 0x00, 0x90, 0x00, 0x24, 0x01, 0xF8,
-    0x00, 0x60, 0x06, 0x00, 0x00, 0x2D, 0x3C, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x1D, 0x00, 0x01, 0xD0, 0x1D, 0x2D, 0x03, 0xC2, 0xD0, 0x3C, 0x00, 0x17,
-    0xD5, 0x0B, 0xFF, 0xF8, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xE0, 0x0B, 0xFF, 0x40, 0x7F, 0xF8, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x05,
-    0xF5, 0x42, 0xFF, 0xFE, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0xBF, 0xFF, 0xEB, 0xFF, 0xFE, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xF8, 0x02, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x2D, 0x05,
-    0x00, 0x01, 0xCD, 0x24, 0x00, 0x0A, 0x1D, 0xD0, 0x00, 0x28, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x6A, 0x3F, 0x40, 0x02, 0xFC, 0xFD,
-    0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xBD, 0x2F, 0xC0, 0x07, 0xF4, 0x7F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x06, 0x01, 0xCA, 0x24, 0x0A, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x40, 0x0F, 0x2E, 0x00, 0x3C,
-    0x78, 0x00, 0xF1, 0xE0, 0x03, 0xD7, 0xC0, 0x2F, 0x4F, 0xEB, 0xFD, 0x3F, 0xFF, 0xF4, 0xBF, 0xFF,
-    0xD0, 0xBF, 0x8F, 0x40, 0x00, 0x55, 0xAA, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x06, 0xA3, 0xF4, 0x00, 0x2F, 0xCF, 0xD0,
-    0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E,
-    0x2F, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x0B, 0xD2, 0xFC, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A,
-    0x81, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xCB, 0x40,
-    0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x1E, 0x00, 0x3D, 0x7C,
-    0x02, 0xF4, 0xFE, 0xBF, 0xD3, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x1C, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00,
-    0x07, 0xF3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x0B, 0xD2,
-    0xFD, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x07, 0x02, 0xC0, 0x3C, 0x03, 0xFF,
-    0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF2, 0xD0,
-    0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x5F,
-    0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0xFD,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x09, 0x30, 0x00, 0x30, 0xC0, 0x00, 0xD7, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x40,
-    0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x5F, 0x00, 0xBD, 0x3F,
-    0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x00, 0x14, 0x00, 0x05, 0x00, 0x2E,
-    0x00, 0x0F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x25, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x06, 0xA0, 0x3F, 0x40, 0x02, 0xFC,
-    0x0F, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x00,
-    0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x0B, 0xD0, 0x2F,
-    0xC0, 0x07, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0xB8, 0x0B, 0xC0, 0x03, 0xE0, 0x2E, 0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0B, 0x40, 0x0F, 0x00, 0x0B, 0x40, 0x0F,
-    0x00, 0x0B, 0x40, 0x0F, 0x00, 0x0B, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x0F,
-    0x40, 0x07, 0xC0, 0x2F, 0x40, 0x03, 0xFA, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0xBF, 0x8F, 0x40, 0x2A, 0x00, 0x01, 0xA8, 0xFD, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F,
-    0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F,
-    0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF2, 0xD0,
-    0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x5F,
-    0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x00, 0x02, 0xC0,
-    0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7D,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xF4,
-    0x0B, 0xC0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0x40, 0xBF, 0xC0, 0x3F, 0x00, 0x3E, 0x03, 0xFF, 0x41,
-    0xF8, 0x00, 0xFC, 0x2F, 0xFF, 0x0B, 0xD0, 0x03, 0xF0, 0xFD, 0xBD, 0x3F, 0x00, 0x0B, 0xDB, 0xF1,
-    0xFC, 0xFC, 0x00, 0x1F, 0xBF, 0x83, 0xFB, 0xE0, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x40, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x38, 0x74, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x14, 0xBC, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00,
-    0xB8, 0x3E, 0x07, 0xC0, 0xF4, 0x2F, 0x0F, 0xE0, 0xF0, 0x1F, 0x3F, 0xF5, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x03, 0xF0, 0x1F,
-    0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x00, 0xB0, 0x1C,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F,
-    0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xEF, 0x00, 0x07, 0x02,
-    0xC0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C,
-    0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03,
-    0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0xFC, 0x1F, 0x40, 0x01,
-    0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03,
-    0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x34, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x2F,
-    0x40, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0,
-    0x01, 0xFE, 0xAA, 0x4B, 0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFD,
-    0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x14, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0,
-    0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xAA, 0x92, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x40, 0x00, 0x30, 0x07, 0x00, 0x00, 0x07, 0x4B, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x55,
-    0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x04,
-    0x00, 0x00, 0x2C, 0x07, 0x00, 0x2D, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x02, 0xF4,
-    0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFE, 0xAA,
-    0x4B, 0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x07, 0xE0, 0x7E, 0xD3, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xE0,
-    0x07, 0x80, 0x1E, 0x00, 0x78, 0x02, 0xE0, 0x0B, 0x80, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x2F, 0x00, 0xBC, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0D, 0x1C, 0x3C, 0x74,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x3F, 0x40, 0x3C, 0x74, 0x38, 0x03, 0x40, 0x3D, 0x05, 0x73, 0x09,
-    0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x05, 0x6A, 0xA0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x56, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xA3, 0x80,
-    0x74, 0x7F, 0xFC, 0x07, 0xF8, 0x00, 0x7C, 0xBC, 0xFD, 0x54, 0x7C, 0x0B, 0x8B, 0xC0, 0xFC, 0xFD,
-    0x0F, 0xC5, 0x40, 0x54, 0x2F, 0x40, 0x70, 0x70, 0x20, 0x2A, 0x14, 0x6A, 0x18, 0xFC, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0xB4, 0x2F, 0x00, 0x0F, 0x43, 0xE0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x03, 0x43, 0xC7, 0x40, 0x3F, 0x40, 0x03, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3D, 0x00, 0x7C,
-    0x00, 0x3E, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x1F, 0x80, 0xFC,
-    0x0F, 0xC0, 0xBD, 0x3F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x2F, 0x40, 0x3F, 0x42, 0xF8, 0x1F, 0x80,
-    0xFC, 0x0F, 0xC0, 0xBD, 0x05, 0x07, 0x7F, 0x07, 0x05, 0x20, 0x70, 0x7F, 0x70, 0x20, 0x7E, 0xA5,
-    0x0A, 0xBF, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x0C, 0x0C, 0x18, 0x70, 0x00, 0x04,
-    0x86, 0x0E, 0x00, 0x00, 0x03, 0x40, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0xD0, 0x24, 0x04, 0x02, 0x02,
-    0xE4, 0x20, 0x00, 0x00, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x7C, 0xBC, 0xFD,
-    0x14, 0x05, 0x47, 0xC0, 0xFC, 0xBC, 0x0F, 0xCF, 0xD0, 0xFC, 0x2A, 0x14, 0x6A, 0x18, 0xFC, 0x00,
-    0x00, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x10, 0x08, 0x03, 0x80, 0x08, 0x03, 0x1F,
-    0x40, 0x01, 0x03, 0x03, 0x01, 0xC0, 0x3F, 0x40, 0x40, 0x14, 0xE3, 0x9E, 0x79, 0xE0, 0x7F, 0xF9,
-    0xD0, 0xE7, 0x03, 0x80, 0x00, 0x38, 0x03, 0x43, 0xC7, 0x40, 0x3F, 0x40, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0xFC, 0x00, 0xE2, 0xC0, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x3D, 0x05, 0x73,
-    0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC1, 0x55, 0x40, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x10, 0x91, 0x5C, 0x00, 0x70, 0x39, 0xC0, 0xE7, 0xFF,
-    0x80, 0x00, 0x7F, 0xF5, 0x80, 0xD6, 0x03, 0x58, 0x0D, 0x7F, 0xF4, 0x2A, 0x60, 0x88, 0x52, 0x21,
-    0x94, 0x81, 0x00, 0x0C, 0x80, 0xC0, 0xB4, 0x63, 0x00, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0,
-    0xBC, 0x00, 0x00, 0x60, 0xB2, 0x80, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0xB0, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0x8B, 0xC0, 0xFC, 0xFD, 0x0F, 0xC5, 0x40, 0x54, 0x7F,
-    0xF9, 0xD0, 0xE7, 0x03, 0x80, 0x00, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x56, 0xA9, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x38, 0x0F, 0x38, 0x0F, 0x38, 0x0F,
-    0x78, 0x0F, 0x78, 0x1F, 0x14, 0x05, 0x00, 0x01, 0xFF, 0xC6, 0xAF, 0x40, 0x3D, 0x00, 0xF4, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x2D, 0x95, 0x73, 0xC9, 0xA1, 0xDD, 0xA1,
-    0xFC, 0x02, 0x40, 0x03, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x1B, 0xE4, 0x00, 0x28, 0x3E, 0x0B, 0xC0, 0x0F, 0x6F, 0x00,
-    0x7E, 0x4B, 0xCF, 0xC7, 0x42, 0xBF, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x09, 0x3C, 0x74, 0x0E, 0x78, 0x1E, 0x1D, 0x74, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x09, 0x3C, 0x3D, 0x0D, 0x74, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x50, 0x00, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24,
-    0x10, 0x10, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0xC0, 0x79, 0x00, 0x07, 0x80, 0x00, 0x6A,
-    0xA9, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x02, 0x90, 0x00, 0x0B, 0x42, 0x40, 0x00, 0x00, 0x24, 0x40,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x55, 0x55, 0x55, 0x57, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x06, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x5F, 0xAA, 0xA8, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7F,
-    0xFF, 0xF1, 0xFA, 0xAA, 0x87, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0xF0, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD7, 0xEA, 0xAA, 0x1E, 0x00, 0x00, 0x78, 0x00,
-    0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x7E, 0xAA, 0xA1, 0xE0, 0x00, 0x07, 0x80,
-    0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFD, 0x05,
-    0x55, 0x5A, 0xA0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x15,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x3D,
-    0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xB8, 0x00,
-    0x3D, 0x03, 0xFC, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x34, 0x00, 0x02, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF3, 0xEA, 0xAA, 0x8F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0,
-    0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E,
-    0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFA,
-    0xFC, 0x00, 0x7D, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xBE, 0x2F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x50, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F,
-    0x8F, 0xE0, 0x3E, 0x03, 0xC3, 0xE0, 0x7D, 0x3F, 0x0B, 0xE1, 0x50, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01,
-    0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x3F, 0xFD,
-    0x0F, 0xFF, 0x03, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFA, 0xAB, 0xD0,
-    0x00, 0x00, 0x38, 0x00, 0x74, 0x00, 0x00, 0x0E, 0x00, 0x1D, 0x00, 0x00, 0x03, 0x80, 0x07, 0x40,
-    0x00, 0x00, 0xD0, 0x01, 0xE5, 0x40, 0x00, 0x34, 0x00, 0x7F, 0xFF, 0x40, 0x0D, 0x00, 0x1D, 0x01,
-    0xF0, 0x07, 0x40, 0x07, 0x40, 0x0F, 0x01, 0xD0, 0x01, 0xD0, 0x03, 0xC0, 0x70, 0x00, 0xB8, 0x00,
-    0xF0, 0x2C, 0x00, 0x2E, 0x00, 0x7C, 0x0F, 0x00, 0x0B, 0xEB, 0xFE, 0x0F, 0xC0, 0x02, 0xFF, 0xFF,
-    0x07, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00,
-    0xB4, 0x00, 0x1D, 0x00, 0x00, 0xB4, 0x00, 0x1D, 0x00, 0x00, 0xB4, 0x00, 0x1D, 0x00, 0x00, 0xB4,
-    0x00, 0x1D, 0x00, 0x00, 0xB4, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x1E, 0x54, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0xBE, 0xAA, 0xBE, 0x00, 0xF4, 0xB4, 0x00, 0x1E, 0x00, 0x3C, 0xB4, 0x00, 0x1E,
-    0x00, 0x2C, 0xB4, 0x00, 0x1E, 0x00, 0x2C, 0xB4, 0x00, 0x1E, 0x00, 0x7C, 0xB4, 0x00, 0x1F, 0xAB,
-    0xFC, 0xB4, 0x00, 0x1F, 0xFF, 0xF0, 0xB4, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x2A, 0x57, 0xE5, 0x54, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0xF8, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x00, 0x7E, 0x00,
-    0x3C, 0x00, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x07, 0xE0, 0x03, 0xC0, 0x00,
-    0xBF, 0x00, 0x3C, 0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0xBF, 0x00, 0x7D, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x0B, 0xC0, 0xBD, 0x00, 0x2F, 0x07,
-    0xE0, 0x00, 0xF8, 0x3F, 0x00, 0x03, 0xE2, 0xF4, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x3E, 0xBD, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x0B, 0xDF, 0xF0, 0x00, 0x2F, 0x1F, 0xF0, 0x00, 0xFC, 0x2F, 0xF0, 0x03, 0xF0,
-    0x3F, 0xF0, 0x0F, 0xC0, 0x3F, 0xF0, 0x3F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xF0, 0x3F, 0x00,
-    0x0F, 0xF4, 0x3F, 0x00, 0x1F, 0xF4, 0x3F, 0x00, 0x3F, 0xF4, 0x2F, 0x00, 0x7E, 0xF8, 0x2F, 0x00,
-    0xFC, 0xF8, 0x2F, 0x01, 0xF8, 0xF8, 0x2F, 0x43, 0xF0, 0xFC, 0x2F, 0x47, 0xE0, 0xFC, 0x1F, 0x4F,
-    0xC1, 0xFC, 0x1F, 0x8F, 0x81, 0xFC, 0x1F, 0xAF, 0x01, 0xFC, 0x1F, 0xFE, 0x01, 0xFC, 0x0F, 0xFC,
-    0x01, 0xFD, 0x0F, 0xF8, 0x01, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x34,
-    0x07, 0x40, 0x70, 0x02, 0xFF, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x2D, 0x3D, 0x00, 0x3C, 0x1F, 0x00, 0x7C, 0x0F, 0x40, 0xB8, 0x07, 0xC0,
-    0xF4, 0x03, 0xE0, 0xF0, 0x01, 0xF5, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x2B, 0xFE, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0x24, 0x00, 0x0A, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF1, 0xF0,
-    0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF1, 0xF0, 0x00, 0x3C, 0x7C,
-    0x00, 0x0F, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF1, 0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x0F, 0x1F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4,
-    0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40,
-    0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x7F, 0xFF, 0xF9, 0xF5, 0x55, 0x43, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF9, 0x50,
-    0x03, 0xFF, 0xFC, 0x0F, 0x40, 0x7C, 0x3D, 0x00, 0x38, 0xF4, 0x00, 0xF3, 0xD0, 0x03, 0xCF, 0x40,
-    0x2F, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC2, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x40, 0x7D, 0x57, 0xD0,
-    0x78, 0x00, 0xB0, 0x78, 0x00, 0x70, 0x78, 0x00, 0x70, 0x78, 0x01, 0xF0, 0x7F, 0xFF, 0x80, 0x7E,
-    0xAB, 0xE0, 0x78, 0x00, 0x7C, 0x78, 0x00, 0x3D, 0x78, 0x00, 0x3E, 0x78, 0x00, 0xBD, 0x7F, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0xFA, 0xAA, 0xA3, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x3C, 0x01, 0xF0,
-    0x00, 0xF0, 0x07, 0xC0, 0x03, 0xC0, 0x1F, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x3C, 0x01, 0xF0, 0x00,
-    0xF0, 0x07, 0xC0, 0x03, 0xC0, 0x1F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x1F, 0xD5,
-    0x5B, 0xD0, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x4B, 0x80, 0x00, 0x3C, 0x1F, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0xFA, 0xAA, 0x87, 0x80, 0x00, 0x1E, 0x00, 0x00,
-    0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x1F, 0xAA, 0xA8, 0x78, 0x00, 0x01, 0xE0, 0x00,
-    0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x40, 0x02,
-    0xF4, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x2F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x7C, 0x0F, 0xC0,
-    0x00, 0x0B, 0xC1, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x6F, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFE, 0xFF, 0x7F, 0xD0, 0x00, 0xBF, 0xDB, 0xFC, 0xBF, 0xD0, 0x0B, 0xFE, 0x2F, 0xF0, 0xFF,
-    0xD0, 0xBF, 0xF0, 0xBF, 0xD0, 0xFF, 0xC0, 0x06, 0xF9, 0x00, 0xFF, 0xFF, 0x01, 0x40, 0x2F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x6A, 0xFD, 0x01, 0xFF, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x60, 0x02, 0xF5, 0xFF, 0xFF, 0xC7, 0xFF, 0xFD,
-    0x06, 0xFF, 0x80, 0x29, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x1F, 0xF4, 0x3F, 0x00, 0x3F, 0xF4, 0x2F, 0x00, 0x7E, 0xF8, 0x2F,
-    0x00, 0xFC, 0xF8, 0x2F, 0x01, 0xF8, 0xF8, 0x2F, 0x43, 0xF0, 0xFC, 0x2F, 0x47, 0xE0, 0xFC, 0x1F,
-    0x4F, 0xC1, 0xFC, 0x1F, 0x8F, 0x81, 0xFC, 0x1F, 0xAF, 0x01, 0xFC, 0x1F, 0xFE, 0x01, 0xFC, 0x0F,
-    0xFC, 0x01, 0xFD, 0x0F, 0xF8, 0x01, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x1C, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x50, 0x3E,
-    0x00, 0x03, 0xF0, 0x3E, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x2F, 0xF4, 0x3F,
-    0x00, 0x3F, 0xF4, 0x2F, 0x00, 0x7E, 0xF8, 0x2F, 0x00, 0xFC, 0xF8, 0x2F, 0x01, 0xF4, 0xF8, 0x2F,
-    0x43, 0xF0, 0xFC, 0x2F, 0x47, 0xE0, 0xFC, 0x1F, 0x4F, 0xC1, 0xFC, 0x1F, 0x8F, 0x81, 0xFC, 0x1F,
-    0xAF, 0x01, 0xFC, 0x1F, 0xFE, 0x01, 0xFC, 0x0F, 0xFC, 0x01, 0xFD, 0x0F, 0xF8, 0x01, 0xFD, 0x0F,
-    0xF0, 0x01, 0xFD, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0x80, 0x03, 0xE0,
-    0xFC, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x2F, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F,
-    0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x07, 0xC0, 0x3D,
-    0x07, 0xC0, 0x3D, 0x07, 0xC0, 0x3D, 0x07, 0xC0, 0x3D, 0x0B, 0xC0, 0x3D, 0x0B, 0xC0, 0x3D, 0x0B,
-    0x80, 0x3D, 0x0F, 0x80, 0x3D, 0x0F, 0x80, 0x3D, 0x0F, 0x40, 0x3D, 0x0F, 0x40, 0x7D, 0xBF, 0x00,
-    0x7D, 0xFE, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC,
-    0x00, 0x7F, 0x8F, 0xB8, 0x03, 0xDE, 0x3C, 0xF0, 0x0F, 0x78, 0xF3, 0xD0, 0xB9, 0xF3, 0xCB, 0xC3,
-    0xC7, 0xCF, 0x0F, 0x2F, 0x1F, 0x3C, 0x3E, 0xF4, 0x7C, 0xF0, 0xBF, 0xC1, 0xF7, 0xC0, 0xFF, 0x0B,
-    0xDF, 0x03, 0xF4, 0x2F, 0x7C, 0x06, 0x80, 0xBD, 0xF0, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x0B, 0xC0,
-    0x05, 0x00, 0x00, 0x50, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8,
-    0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC,
-    0x3F, 0x40, 0x01, 0xFD, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F, 0x0B, 0xD0, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0B, 0xCF, 0x40,
-    0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80, 0x00, 0x3F, 0x47,
-    0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFC, 0x7C, 0x00, 0x3C, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00,
-    0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D,
-    0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0x1F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x01,
-    0xF0, 0x07, 0xF0, 0x7C, 0x00, 0x3C, 0x2F, 0x00, 0x0F, 0x4B, 0xC0, 0x03, 0xC2, 0xF0, 0x07, 0xF0,
-    0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x0F, 0xEA, 0x50, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F,
-    0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xAA, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2D, 0x3D, 0x00, 0x3C, 0x1F, 0x00, 0x7C, 0x0F, 0x40,
-    0xB8, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0xF0, 0x01, 0xF5, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x2B,
-    0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x1E, 0x03, 0xC0, 0xB8, 0x38, 0x03, 0xC0, 0x2C, 0x30, 0x03, 0xC0, 0x1D, 0x74, 0x07, 0xC0, 0x1D,
-    0x3C, 0x07, 0xC0, 0x3D, 0x3F, 0xEF, 0xFB, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x1A, 0x01, 0xF0, 0x00, 0x0F,
-    0x40, 0x3E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00,
-    0x3F, 0xC3, 0xF4, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFE,
-    0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x03, 0x80, 0x03, 0x80, 0xF0,
-    0x00, 0xE0, 0x3C, 0x00, 0x38, 0x0F, 0x00, 0x0E, 0x03, 0xC0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x3C,
-    0x00, 0x78, 0x1F, 0x00, 0x1E, 0x07, 0xC0, 0x07, 0x81, 0xF0, 0x01, 0xF0, 0x7C, 0x00, 0x7C, 0x1F,
-    0x55, 0x6F, 0x47, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x38, 0x74, 0x00, 0x3C, 0x74, 0x00, 0x3C, 0x74,
-    0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x7C, 0x78, 0x00, 0xBC, 0x3C, 0x00, 0xFC, 0x3F, 0x9B,
-    0xFC, 0x1F, 0xFF, 0xBC, 0x07, 0xF9, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0A, 0x03, 0xC7, 0xC0, 0x7C, 0x0F, 0x1F, 0x01,
-    0xF0, 0x3C, 0x7C, 0x07, 0xC0, 0xF1, 0xF0, 0x0F, 0x03, 0xC7, 0xC0, 0x3C, 0x0B, 0x1F, 0x00, 0xF0,
-    0x2C, 0x7C, 0x03, 0xC0, 0xB1, 0xF0, 0x0F, 0x02, 0xC7, 0xC0, 0x3C, 0x0B, 0x1F, 0x00, 0xF0, 0x2C,
-    0x7C, 0x03, 0x80, 0xB1, 0xF5, 0x5F, 0x56, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0xA0, 0x3C, 0x07, 0xC0, 0x7C, 0x0F, 0x01, 0xF0, 0x1F, 0x03, 0xC0,
-    0x7C, 0x07, 0xC0, 0xF0, 0x1F, 0x00, 0xF0, 0x3C, 0x07, 0xC0, 0x3C, 0x0F, 0x01, 0xF0, 0x0F, 0x02,
-    0xC0, 0x78, 0x03, 0xC0, 0xB0, 0x1E, 0x00, 0xF0, 0x2C, 0x07, 0x80, 0x3C, 0x0B, 0x01, 0xE0, 0x0F,
-    0x02, 0xC0, 0x78, 0x03, 0x80, 0xB0, 0x1F, 0x95, 0xF5, 0xBE, 0x43, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF5, 0x50, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x1D, 0x00, 0xF0, 0x00, 0xE0, 0x0F, 0x00, 0x0E, 0x00, 0xF0,
-    0x02, 0xE0, 0x0F, 0xEB, 0xFD, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x10, 0x00, 0x00, 0x03,
-    0xF2, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0x00, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x00, 0x00, 0xFC, 0xF0,
-    0x00, 0x00, 0x03, 0xF3, 0xC0, 0x00, 0x00, 0x0F, 0xCF, 0x55, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0x80,
-    0x00, 0xFC, 0xF0, 0x07, 0xC0, 0x03, 0xF3, 0xC0, 0x07, 0x40, 0x0F, 0xCF, 0x00, 0x0E, 0x00, 0x3F,
-    0x3C, 0x00, 0x38, 0x00, 0xFC, 0xF0, 0x02, 0xE0, 0x03, 0xF3, 0xFA, 0xFF, 0x40, 0x0F, 0xDF, 0xFF,
-    0xF8, 0x00, 0x3F, 0x7F, 0xFF, 0x40, 0x00, 0xFD, 0x10, 0x00, 0x0B, 0x00, 0x00, 0xB0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF5, 0x50, 0x0F, 0xFF, 0xE0, 0xF0, 0x07, 0xCF, 0x00,
-    0x1D, 0xF0, 0x00, 0xEF, 0x00, 0x0E, 0xF0, 0x02, 0xEF, 0xEB, 0xFD, 0xFF, 0xFF, 0x8F, 0xFF, 0xD0,
-    0x00, 0x6F, 0xE0, 0x00, 0x0F, 0xEA, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF0, 0x3C,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x1F, 0x90, 0x01, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x15, 0x00, 0x2F, 0x00, 0xBF, 0xF8, 0x07, 0xC0, 0xB8, 0x0B, 0xC1, 0xE0, 0x78, 0x00,
-    0xB4, 0x78, 0x3C, 0x00, 0x1F, 0x1E, 0x0F, 0x00, 0x03, 0xC7, 0x87, 0x80, 0x00, 0xF1, 0xE1, 0xE0,
-    0x00, 0x2D, 0x7D, 0xB4, 0x00, 0x0B, 0x5F, 0xFE, 0x00, 0x03, 0xC7, 0x9B, 0xC0, 0x00, 0xF1, 0xE1,
-    0xF4, 0x00, 0xBC, 0x74, 0x3F, 0x81, 0xBE, 0x1D, 0x0B, 0xFF, 0xFF, 0x07, 0x40, 0xFF, 0xFF, 0x41,
-    0xD0, 0x06, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x02, 0xF0, 0x07, 0x40, 0x3C,
-    0x00, 0x74, 0x07, 0xC0, 0x07, 0x40, 0x78, 0x00, 0x78, 0x07, 0xC0, 0x07, 0x80, 0x3F, 0x40, 0x78,
-    0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0xFC, 0x07, 0xC0,
-    0x0F, 0xC0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x00, 0xFC, 0x2F, 0xC0, 0x1F, 0xC3,
-    0xFC, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E,
-    0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42,
-    0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x04, 0x00, 0x6F, 0xF4,
-    0x03, 0xFF, 0xE0, 0x0F, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0xBF, 0xD0, 0x7F,
-    0xFF, 0xF8, 0x7F, 0x81, 0xFD, 0x7E, 0x00, 0x3E, 0x3D, 0x00, 0x3F, 0x3D, 0x00, 0x3F, 0x2F, 0x00,
-    0x7E, 0x0F, 0xFB, 0xFC, 0x07, 0xFF, 0xF4, 0x00, 0xBF, 0x80, 0x3F, 0xFD, 0x00, 0xF5, 0x6E, 0x03,
-    0x80, 0x2C, 0x0E, 0x00, 0x70, 0x38, 0x03, 0xC0, 0xFF, 0xFC, 0x03, 0xEA, 0xBC, 0x0E, 0x00, 0x3C,
-    0x38, 0x00, 0xB0, 0xE0, 0x03, 0xC3, 0xD5, 0xBF, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x2A, 0xAA,
-    0x93, 0xFF, 0xFE, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x7D, 0x00, 0x07,
-    0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2A, 0xA8, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xB0, 0x3D, 0x00, 0x0B, 0x03, 0xD0, 0x00, 0xF0, 0x3D, 0x00, 0x0F, 0x03,
-    0xD0, 0x00, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xD0, 0x03, 0xC0, 0x3D, 0x00, 0xF8, 0x03, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x2D, 0x00, 0x03, 0x81, 0xD0, 0x00, 0x74, 0x00, 0x14, 0x00,
-    0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA,
-    0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x02, 0xE0, 0x7C, 0x00, 0x3F, 0x0B,
-    0x83, 0xE0, 0x00, 0x3D, 0x2E, 0x2F, 0x00, 0x00, 0x7C, 0xF8, 0xF4, 0x00, 0x00, 0xFB, 0xEF, 0x80,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0xFD,
-    0xFF, 0x00, 0x3F, 0xCB, 0xF4, 0xFF, 0x03, 0xFD, 0x2F, 0xE1, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x64,
-    0x00, 0x0C, 0x00, 0x28, 0x0F, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x2C, 0x10, 0x7C, 0xBF, 0xF4,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBC, 0x74, 0x01, 0xFC, 0x74, 0x03, 0xEC, 0x74, 0x0F,
-    0x6C, 0x78, 0x1E, 0x2C, 0x78, 0x3C, 0x2C, 0x78, 0xF4, 0x3C, 0x79, 0xE0, 0x3C, 0x7F, 0xC0, 0x3C,
-    0x7F, 0x40, 0x3C, 0x7E, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0x9B, 0x40, 0x01, 0xFD, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBC, 0x74, 0x01, 0xFC, 0x74, 0x03, 0xEC, 0x74, 0x0F,
-    0x6C, 0x78, 0x1E, 0x2C, 0x78, 0x3C, 0x2C, 0x78, 0xF4, 0x3C, 0x79, 0xE0, 0x3C, 0x7F, 0xC0, 0x3C,
-    0x7F, 0x40, 0x3C, 0x7E, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x3D, 0x03, 0xC2, 0xE0, 0x0F, 0x1F,
-    0x00, 0x3C, 0xF4, 0x00, 0xFB, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xD0, 0x02, 0xEB,
-    0xE0, 0x0B, 0x8F, 0xE0, 0x3D, 0x0F, 0xE0, 0xF4, 0x0F, 0xF0, 0x05, 0x55, 0x03, 0xFF, 0xC0, 0xF0,
-    0x70, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x82, 0xC0, 0xE0, 0xB0, 0x34, 0x2C, 0x1D, 0x0B, 0x0B, 0x42,
-    0xC7, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0x41, 0xFC, 0x00, 0xFD,
-    0x07, 0xF4, 0x03, 0xF8, 0x2F, 0xF0, 0x2F, 0xE0, 0xBB, 0xD0, 0xFB, 0x82, 0xDF, 0x87, 0xDF, 0x0B,
-    0x6F, 0x3E, 0xBC, 0x2D, 0x3E, 0xF2, 0xF0, 0xF4, 0xBF, 0xCB, 0xC3, 0xE1, 0xFD, 0x2F, 0x0F, 0x83,
-    0xF0, 0xFC, 0x3E, 0x07, 0x83, 0xF4, 0xF8, 0x00, 0x0F, 0xD0, 0x3C, 0x00, 0x0F, 0x1F, 0x00, 0x03,
-    0xC7, 0xC0, 0x00, 0xF1, 0xF0, 0x00, 0x3C, 0x7C, 0x00, 0x1F, 0x1F, 0x00, 0x07, 0xC7, 0xC0, 0x01,
-    0xF5, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xDB, 0xD0, 0x01, 0xF6, 0xF4, 0x00,
-    0xBE, 0xBD, 0x00, 0x2F, 0x80, 0x01, 0xBE, 0x40, 0x0B, 0xDB, 0xE0, 0x1E, 0x00, 0xF0, 0x3C, 0x00,
-    0x78, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x3F, 0x55, 0xF8,
-    0x1F, 0xFF, 0xF0, 0x0B, 0xFF, 0xE0, 0x01, 0xFE, 0x40, 0x15, 0x55, 0x50, 0x7F, 0xFF, 0xFC, 0x7C,
-    0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x7C, 0x00,
-    0x3C, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x04, 0x1B, 0x90,
-    0x07, 0xAF, 0xFE, 0x01, 0xFF, 0x02, 0xC0, 0x3F, 0x00, 0x38, 0x0F, 0x80, 0x0F, 0x03, 0xD0, 0x02,
-    0xC0, 0xF8, 0x00, 0xB0, 0x3F, 0x00, 0x3C, 0x0F, 0xE0, 0x1F, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xC0, 0xF8, 0xFF, 0x80, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03,
-    0xE0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0xDA, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x14, 0x3C, 0x15, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0xB4,
-    0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1,
-    0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xEF, 0xFF,
-    0xF4, 0x2D, 0x03, 0xC0, 0x3C, 0x34, 0x03, 0xC0, 0x1C, 0x30, 0x03, 0xC0, 0x1D, 0x70, 0x07, 0xC0,
-    0x1D, 0x38, 0x07, 0xC0, 0x2D, 0x3E, 0x47, 0xD1, 0xBC, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x04, 0x03, 0xC0, 0x0F, 0x00,
-    0xB4, 0x0B, 0x40, 0x0F, 0x07, 0xC0, 0x00, 0xF3, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x00,
-    0x02, 0xFD, 0x00, 0x01, 0xF7, 0xC0, 0x01, 0xF4, 0xBC, 0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x00, 0xF8,
-    0x14, 0x00, 0x50, 0x1F, 0x00, 0x2D, 0x07, 0xC0, 0x0B, 0x40, 0xF0, 0x02, 0xD0, 0x3C, 0x00, 0x74,
-    0x0F, 0x00, 0x1D, 0x03, 0xC0, 0x07, 0x40, 0xF0, 0x01, 0xD0, 0x3C, 0x00, 0x74, 0x0F, 0x00, 0x1E,
-    0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01,
-    0x90, 0x40, 0x08, 0xD0, 0x1C, 0xD0, 0x1C, 0xD0, 0x1C, 0xD0, 0x1C, 0xE0, 0x3C, 0x7E, 0xFC, 0x2F,
-    0x9C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x2C, 0x14, 0x00, 0x00, 0x51, 0xF0, 0x1F, 0x03, 0xC7, 0xC0,
-    0x7C, 0x0F, 0x1F, 0x01, 0xF0, 0x3C, 0x7C, 0x03, 0xC0, 0xB1, 0xF0, 0x0F, 0x02, 0xC7, 0xC0, 0x3C,
-    0x0B, 0x1F, 0x00, 0xF0, 0x2C, 0x7C, 0x03, 0xC0, 0xB1, 0xF0, 0x0F, 0x02, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x14, 0x00, 0x00, 0x50, 0x7C, 0x07, 0xC0, 0xF0, 0x7C, 0x07, 0xC0, 0xF0,
-    0x7C, 0x07, 0xC0, 0xF0, 0x7C, 0x03, 0xC0, 0xB0, 0x7C, 0x03, 0xC0, 0xB0, 0x7C, 0x03, 0xC0, 0xB0,
-    0x7C, 0x03, 0xC0, 0xB0, 0x7C, 0x03, 0xC0, 0xB0, 0x7C, 0x03, 0xC0, 0xB4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x14, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x3C, 0x06, 0xD0, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0xF0,
-    0x0B, 0xC0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0x80, 0x14, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x02, 0xC3,
-    0xC0, 0x00, 0x0B, 0x0F, 0x00, 0x00, 0x2C, 0x3C, 0x00, 0x00, 0xB0, 0xFF, 0xF9, 0x02, 0xC3, 0xC0,
-    0x2D, 0x0B, 0x0F, 0x00, 0x2C, 0x3C, 0x3C, 0x00, 0xB0, 0xF0, 0xF0, 0x07, 0xC3, 0xC3, 0xFF, 0xFE,
-    0x0F, 0x4F, 0xFF, 0x90, 0x3D, 0x10, 0x00, 0x03, 0x40, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
-    0x00, 0x03, 0xFF, 0xE0, 0x38, 0x06, 0xC7, 0x80, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x2F, 0x7F, 0xFF,
-    0xD7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x07, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xF4, 0x01, 0x56, 0xE0, 0x0F, 0xFF, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xF5, 0xE4, 0x6F, 0x87, 0xFF,
-    0xFC, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x7F, 0xD0, 0x3C, 0x1D, 0x0B, 0x83, 0xC3,
-    0x80, 0x2C, 0x3C, 0x70, 0x00, 0xD3, 0xCB, 0x00, 0x0E, 0x38, 0xF0, 0x00, 0xE3, 0xFF, 0x00, 0x0E,
-    0x3D, 0xF0, 0x00, 0xD3, 0x8B, 0x80, 0x2D, 0x38, 0x7F, 0xAF, 0xC3, 0x83, 0xFF, 0xF4, 0x38, 0x07,
-    0xF9, 0x00, 0x00, 0xBF, 0xF4, 0x0D, 0x02, 0xD0, 0x70, 0x0B, 0x41, 0xC0, 0x2D, 0x03, 0xFA, 0xF4,
-    0x03, 0xFF, 0xD0, 0x3D, 0x0B, 0x41, 0xE0, 0x2D, 0x0F, 0x00, 0xB4, 0xB8, 0x02, 0xD3, 0xC0, 0x0B,
-    0x40, 0x06, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C,
-    0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x74, 0x0F, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x96, 0xE0, 0x0D,
-    0x00, 0x74, 0x2C, 0x00, 0x2C, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x78, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0xEA, 0xBC, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0x54, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x15,
-    0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x3F, 0xD0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFE,
-    0x4B, 0xC0, 0x03, 0xE0, 0x0B, 0x40, 0x1F, 0x00, 0x1D, 0x00, 0x7C, 0x00, 0x78, 0x01, 0xF0, 0x01,
-    0xE0, 0x0B, 0xC0, 0x07, 0x80, 0x2F, 0x00, 0x1E, 0x00, 0xBC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xF4,
-    0x0F, 0xC0, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0x93, 0xFF, 0xFE, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x7D, 0x00, 0x07,
-    0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xBE, 0x00, 0x2D,
-    0x0B, 0x40, 0xD0, 0x0B, 0x0B, 0x00, 0x04, 0x3D, 0x54, 0x00, 0xFF, 0xF4, 0x03, 0x80, 0x00, 0x0F,
-    0x40, 0x14, 0x2F, 0xEF, 0xF4, 0x3F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x81,
-    0xFA, 0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00,
-    0x7E, 0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x7C, 0xBC, 0xFD, 0x54, 0x00,
-    0x00, 0x10, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78, 0x7C, 0x7C, 0xBC, 0xBC, 0x05, 0x01, 0x40,
-    0xBC, 0x0F, 0x82, 0xF0, 0x3F, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x78,
-    0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xB8, 0x01, 0xF4, 0x3F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x28, 0x07, 0x00, 0x00, 0xA0, 0x1C, 0x00, 0x02, 0x40, 0x70, 0x00, 0x09, 0x01,
-    0xFF, 0x80, 0x24, 0x07, 0x03, 0x80, 0xD0, 0x1C, 0x03, 0x03, 0x40, 0x70, 0x0C, 0x0C, 0x01, 0xC0,
-    0xB0, 0x70, 0x07, 0xFF, 0x83, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07,
-    0x00, 0x30, 0x00, 0x70, 0x03, 0x40, 0x07, 0x00, 0x34, 0x00, 0x70, 0x03, 0x40, 0x07, 0xFF, 0xFF,
-    0xF4, 0x70, 0x03, 0x41, 0xC7, 0x00, 0x34, 0x0A, 0x70, 0x03, 0x40, 0xE7, 0x00, 0x3F, 0xFD, 0x70,
-    0x03, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xB5, 0x40, 0x03, 0xFF, 0xFC,
-    0x00, 0x15, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF3, 0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0xFE, 0x4B, 0xC0, 0x0F, 0x80, 0x2D, 0x01, 0xF0, 0x01, 0xD0, 0x1F, 0x00, 0x1E, 0x01, 0xF0, 0x01,
-    0xE0, 0x2F, 0x00, 0x1E, 0x02, 0xF0, 0x01, 0xE0, 0x2F, 0x00, 0x2F, 0x02, 0xF0, 0x02, 0xF0, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xD0, 0x3C, 0x1F, 0x00, 0xF0, 0xF0, 0x03, 0xCF, 0x40,
-    0x0F, 0xB8, 0x00, 0x7F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x2E, 0xFD, 0x00, 0xB8, 0xFE,
-    0x03, 0xD0, 0xFE, 0x0F, 0x41, 0xFF, 0x00, 0x03, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBC, 0x74, 0x01, 0xFC, 0x74,
-    0x03, 0xEC, 0x74, 0x0F, 0x6C, 0x78, 0x1E, 0x2C, 0x78, 0x3C, 0x2C, 0x78, 0xF4, 0x3C, 0x79, 0xE0,
-    0x3C, 0x7F, 0xC0, 0x3C, 0x7F, 0x40, 0x3C, 0x7E, 0x00, 0x3D, 0x0F, 0xA4, 0x70, 0x0D, 0x00, 0x70,
-    0x0B, 0x00, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00,
-    0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0,
-    0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01,
-    0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0xA0, 0x02, 0x7C, 0x00, 0xEF,
-    0x00, 0x3B, 0xC0, 0x0E, 0xF0, 0x03, 0xBC, 0x00, 0xEF, 0x00, 0x3B, 0xC0, 0x0E, 0xF0, 0x03, 0xBD,
-    0x55, 0xEF, 0xFF, 0xF8, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0x40, 0x00,
-    0x0B, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x0B, 0xD0, 0x2D, 0x0B, 0xC0, 0x0E, 0x0B, 0xC0, 0x0B, 0x07,
-    0xE5, 0x6F, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x5F, 0x55, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0x90, 0x03, 0xF5, 0x6E, 0x00, 0xF8, 0x01, 0xC0, 0x3D,
-    0x00, 0x34, 0x0F, 0x80, 0x1D, 0x03, 0xFA, 0xBF, 0x40, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00,
-    0x55, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xE0, 0x0F,
-    0xC0, 0x0F, 0xD0, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x02, 0xE2, 0xE2, 0xE0, 0x01, 0xE0, 0xB8, 0x2D, 0x00, 0xF0, 0x2E, 0x03,
-    0xC0, 0x3C, 0x0B, 0x80, 0xF0, 0x1E, 0x01, 0xE0, 0x2D, 0x0F, 0x40, 0xB8, 0x07, 0xC3, 0xC0, 0x2F,
-    0x00, 0xF4, 0x15, 0x55, 0x55, 0x2F, 0xFF, 0xFE, 0x0F, 0x40, 0xBC, 0x03, 0xC1, 0xF0, 0x00, 0xF7,
-    0x80, 0x01, 0xBF, 0x80, 0x07, 0x5C, 0x70, 0x0E, 0x1C, 0x38, 0x1C, 0x1C, 0x1C, 0x2C, 0x1C, 0x0D,
-    0x38, 0x1C, 0x0F, 0x01, 0x50, 0x00, 0x50, 0x0F, 0xFC, 0x00, 0xF0, 0x2F, 0x1F, 0x00, 0xF0, 0x3D,
-    0x03, 0xD1, 0xF0, 0x3D, 0x2F, 0xFF, 0xD0, 0x29, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0xAF, 0xD0, 0x0F,
-    0xC0, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBC, 0x3F,
-    0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xFC, 0x1F, 0xD0, 0x07, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x07, 0x02, 0xC2, 0xD2, 0xC0, 0xF1, 0xBF, 0xE0, 0x17, 0xFF, 0xF4, 0x03,
-    0xE0, 0x1F, 0x01, 0xE0, 0x02, 0xE0, 0xB4, 0x00, 0x3C, 0x2D, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xC2,
-    0xE0, 0x01, 0xF0, 0x7D, 0x01, 0xF8, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x42, 0x90, 0x00, 0x00, 0xBE,
-    0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF1,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x14, 0x00, 0x0F, 0x83, 0xC0, 0x01, 0xF0, 0x2D, 0x00, 0x2D,
-    0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x00, 0xB4, 0x0B, 0x40, 0x07, 0xC0, 0xF0, 0x00, 0x3C,
-    0x2F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1D, 0x7F, 0xFD, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x1D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xCF, 0xAA, 0xAA, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x2A, 0xAA, 0xF3, 0xFF, 0xFF, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xAA, 0xAA, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00,
-    0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC2, 0xC0, 0x00, 0xB0, 0x00, 0xBF, 0xFF, 0x0F, 0x95, 0x43, 0xC0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF4,
-    0x54, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xD0, 0x7E, 0x03, 0xD0, 0x03, 0xC1, 0xF0, 0x00, 0xB4, 0x7C,
-    0x00, 0x1D, 0x1F, 0x00, 0x07, 0x47, 0xC0, 0x03, 0xD1, 0xF0, 0x0F, 0xF0, 0x7C, 0x03, 0xE0, 0x00,
-    0x6A, 0x83, 0xFF, 0x4D, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xFF, 0x4F, 0x03, 0x78, 0x0B, 0xD0, 0x1F,
-    0x81, 0xEE, 0x0F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x7E, 0x00, 0x07, 0xE0, 0x3E, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0xC3, 0xE0, 0xFC, 0x00, 0x00, 0x2F, 0x4F, 0xCB, 0xD0,
-    0x00, 0x00, 0x3F, 0x3F, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFB, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0xCF, 0xF8, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x3F, 0xF1, 0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x83, 0xC1, 0xE0, 0x03, 0xD2, 0xC3, 0xC0, 0x00, 0xF3, 0xCB, 0x80, 0x00, 0xB7, 0xDF,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFB, 0xFF, 0xC0, 0x0F, 0xE7, 0xF3, 0xF0, 0x3F, 0xCB, 0xF1,
-    0xFC, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x1A, 0xF9, 0x00, 0xFF, 0xFF, 0x01, 0x40,
-    0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x6A, 0xFC, 0x01, 0xFF, 0xD0, 0x00,
-    0x07, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x60, 0x02, 0xF2, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFC, 0x0B, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x64, 0x00,
-    0x0C, 0x00, 0x28, 0x0F, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x2C, 0x10, 0x7C, 0xBF, 0xF4, 0xBF,
-    0xD0, 0x20, 0x00, 0x2A, 0x00, 0x02, 0x40, 0x07, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0xBD, 0x00, 0xF4,
-    0x0F, 0xC0, 0x0F, 0x43, 0xF0, 0x01, 0xF4, 0x7E, 0x00, 0x1F, 0x0F, 0xC0, 0x01, 0xF2, 0xF4, 0x00,
-    0x2F, 0x7F, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xBF, 0x80, 0x03, 0xE3, 0xFE, 0x00, 0x3E, 0x0F, 0xF8, 0x07,
-    0xE0, 0x7F, 0xD0, 0x7E, 0x02, 0xFF, 0x47, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xD0, 0xF0, 0x1D, 0x2D, 0x01, 0xD7, 0xC0, 0x2C,
-    0xF0, 0x02, 0xEE, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xDF, 0x80, 0x3C, 0xBE,
-    0x03, 0xC3, 0xF4, 0x3C, 0x0F, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x07, 0xD0, 0x1E, 0x00, 0x0F, 0x80, 0x1E, 0x00, 0x1F, 0x00, 0x1E, 0x7C, 0x3D, 0x00, 0x2E,
-    0xBC, 0xBC, 0x00, 0x2D, 0xBC, 0xF4, 0x00, 0x3D, 0xBE, 0xE0, 0x00, 0x3E, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x3D, 0xFF, 0xF0, 0x00, 0x3D, 0xFC, 0xFC, 0x00, 0x3D, 0xFC, 0xBF, 0x00, 0x7D,
-    0xFC, 0x3F, 0xC0, 0x7C, 0xA8, 0x0F, 0xF0, 0x7C, 0x00, 0x07, 0xFC, 0x04, 0x00, 0x10, 0x03, 0x00,
-    0x3C, 0x01, 0xC4, 0x1D, 0x00, 0x77, 0x8F, 0x00, 0x2D, 0xEB, 0x00, 0x0B, 0x7F, 0x40, 0x02, 0xFF,
-    0xC0, 0x00, 0xF7, 0xBC, 0x00, 0x3D, 0xE7, 0xD0, 0x0F, 0xB8, 0xBD, 0x03, 0xC0, 0x0F, 0xE0, 0x0B,
-    0xC0, 0x3F, 0x02, 0xFF, 0xE2, 0xF4, 0x06, 0xFE, 0x5F, 0x80, 0x03, 0xE0, 0xFC, 0x00, 0x0F, 0x8B,
-    0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0x7F, 0xC0, 0x00,
-    0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F, 0x00, 0xFF, 0xC0, 0xFC,
-    0x01, 0xFF, 0xC0, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0xB4, 0x00, 0x1F, 0x2F, 0x00, 0x01,
-    0xE7, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x2E, 0x3F, 0x00, 0x02, 0xF1, 0xFC, 0x00, 0x2F, 0x0B, 0xF4, 0x03, 0xF0, 0x3F, 0xD0, 0x7F,
-    0xFF, 0xF0, 0x0F, 0xC0, 0x7F, 0xFF, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x03,
-    0xE0, 0xFC, 0x00, 0x00, 0x03, 0xE2, 0xF4, 0x00, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0x03, 0xEB,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xF0, 0x00,
-    0x00, 0x0B, 0xC7, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x0F, 0x05,
-    0x5B, 0x4B, 0x40, 0x01, 0xD3, 0xC0, 0x00, 0xB3, 0xC0, 0x00, 0x2E, 0xE0, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3D, 0xF4, 0x00, 0x0F, 0x2F, 0x40, 0x03, 0xC3, 0xF4,
-    0x01, 0xF0, 0x7F, 0x40, 0x14, 0x00, 0x00, 0x50, 0x3D, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x01, 0xF0,
-    0x3E, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x01, 0xF4,
-    0x3E, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x02, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0x00, 0x02, 0xF8,
-    0x7F, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xB0, 0x3C, 0x00,
-    0xB0, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xB4, 0x3E, 0xAA, 0xF4,
-    0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x3C, 0x00, 0xF8, 0x3C, 0x00, 0xF8, 0x7C, 0x00, 0xFC, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFE,
-    0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x38, 0x00,
-    0xBF, 0xFC, 0xF0, 0x02, 0xE5, 0x53, 0xC0, 0x0B, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0xF0, 0x03, 0xD0, 0x03, 0xEA, 0xAF, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x78, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x00, 0x7C,
-    0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
-    0x3E, 0x15, 0x40, 0x7C, 0x00, 0x3F, 0xFF, 0xF0, 0x7C, 0x00, 0x3F, 0x80, 0xBC, 0x7C, 0x00, 0x3F,
-    0x00, 0x2E, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x7C, 0x00, 0x3D, 0x00,
-    0x0F, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0xBC, 0x00, 0x3E, 0x02, 0xFD, 0xBC, 0x00, 0x3E, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7D, 0x55, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x7C,
-    0x15, 0x00, 0x3C, 0x00, 0x7F, 0xFF, 0xE0, 0x3C, 0x00, 0x7F, 0x41, 0xF8, 0x00, 0x00, 0x7D, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x2D, 0x00, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x00, 0x7C, 0x00, 0x1D,
-    0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x02, 0xFE, 0x00, 0x0B, 0xC0,
-    0x07, 0xEB, 0xF0, 0x03, 0xD0, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x02, 0xC0, 0x03, 0xC0, 0x7C, 0x00,
-    0xF0, 0x00, 0xE0, 0x1F, 0x00, 0x38, 0x00, 0x78, 0x07, 0xC0, 0x1E, 0x00, 0x3C, 0x01, 0xF0, 0x07,
-    0xC0, 0x3F, 0x00, 0x7C, 0x00, 0xF4, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0xBF, 0x47, 0x42, 0xFD, 0x0B,
-    0xFF, 0xEF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0xE0, 0x0B, 0x40, 0x78, 0x1D, 0x02, 0xC0, 0x38, 0x03,
-    0x80, 0xF0, 0x0D, 0x00, 0xE0, 0x3C, 0x07, 0x00, 0x74, 0x0F, 0x01, 0xD0, 0x7C, 0x03, 0xD0, 0x3C,
-    0x7D, 0x00, 0xBD, 0x0F, 0xFE, 0x6C, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFB, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9,
-    0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xAA, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03, 0xE0, 0x00, 0xBC, 0x00,
-    0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x9A, 0x01,
-    0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x30, 0x00, 0x07, 0x00, 0x0F, 0x80, 0x15, 0x55, 0x55, 0x54,
-    0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x10, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0xEA,
-    0xFA, 0x90, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
-    0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x90, 0x00,
-    0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07,
-    0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3C, 0x00, 0x3C, 0x3D, 0x00,
-    0xB8, 0x1E, 0x00, 0xF4, 0x0F, 0x00, 0xF0, 0x0F, 0x42, 0xE0, 0x07, 0xC3, 0xC0, 0x03, 0xC7, 0xC0,
-    0x02, 0xDB, 0x40, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4,
-    0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x03, 0xE0, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xF4, 0x1F, 0x80,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBD, 0x7F, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x28, 0x00, 0x28, 0x3D, 0x00, 0x78, 0x2E, 0x00, 0xF4, 0x0F, 0x00, 0xF0, 0x0F, 0x42, 0xE0, 0x07,
-    0x83, 0xD0, 0x03, 0xC3, 0xC0, 0x03, 0xDB, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x29, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x0F,
-    0x80, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x3F, 0x80, 0xFE, 0x00,
-    0x2F, 0xC0, 0x1F, 0xD0, 0x1F, 0xD0, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x38,
-    0x0B, 0x00, 0xB0, 0x03, 0xC1, 0xD0, 0x01, 0xD3, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0xFF, 0x40, 0x02, 0xE7, 0xC0, 0x07, 0xC3, 0xE0, 0x0F, 0x40, 0xF4, 0x3F, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x6A, 0xAA, 0xA4, 0x04, 0x0B, 0xFF, 0xFF, 0x42, 0xC0,
-    0x00, 0x3C, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x03, 0xC0,
-    0x02, 0xC0, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x2C, 0x00,
-    0x03, 0xC0, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x02, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0xD0, 0x00, 0xD0, 0x0D, 0x00, 0x0D, 0x00, 0xD0, 0x00, 0xD0, 0x0D, 0x00, 0x0D,
-    0x00, 0xD0, 0x00, 0xD0, 0x0D, 0x00, 0x0D, 0x00, 0xD0, 0x00, 0xD0, 0x0D, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x18, 0x28, 0x00,
-    0x28, 0x07, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3D, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3D, 0x03,
-    0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3D, 0x02, 0xC0, 0x0B, 0xD0, 0x0F, 0xAB, 0xFD, 0x00, 0x7F, 0xFB,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x05, 0xB0, 0x0A, 0x0B, 0x00, 0xF0, 0xB0, 0x0F, 0x0B, 0x00, 0xF0, 0x70, 0x0F,
-    0x03, 0x42, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00,
-    0x00, 0xAE, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x0F, 0x00, 0x03,
-    0xC3, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0x1F, 0x0F, 0x00, 0x07, 0xC3, 0xC3, 0x82,
-    0xF0, 0xF4, 0xE0, 0xFC, 0x2F, 0xBE, 0xFF, 0x03, 0xFF, 0xFB, 0xC0, 0x2F, 0xE1, 0xF0, 0x00, 0xE0,
-    0x7C, 0x00, 0x38, 0x1F, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x50, 0x05, 0x28, 0x02, 0xCA,
-    0x00, 0xB2, 0x80, 0x2C, 0xE2, 0x0F, 0x2C, 0xC7, 0xC7, 0xFF, 0xF0, 0x7F, 0x7C, 0x03, 0x0F, 0x00,
-    0xC3, 0xC0, 0x30, 0xF0, 0x24, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x55, 0x40, 0x7F, 0xFF, 0xE0, 0x7F,
-    0x40, 0xB4, 0x7C, 0x00, 0x38, 0x7C, 0x00, 0x38, 0x7C, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x7C, 0x00,
-    0x3C, 0x7C, 0x00, 0x3C, 0xBC, 0x00, 0x7C, 0x2D, 0x00, 0x00, 0xB0, 0x00, 0x02, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xCF, 0xF4, 0x0F, 0xFF, 0xF8, 0x3F, 0x92, 0xF0,
-    0xF8, 0x02, 0xD7, 0xC0, 0x07, 0x5F, 0x00, 0x1E, 0x7C, 0x00, 0x7A, 0xF0, 0x01, 0xEB, 0xC0, 0x07,
-    0xAF, 0x00, 0x2F, 0xBC, 0x00, 0xBF, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x0B, 0xE0, 0x2E, 0x00, 0x01, 0xF0, 0x00, 0xB4, 0xF4, 0x3D, 0x00, 0x03, 0xCF,
-    0x83, 0xC0, 0x00, 0x7D, 0xBF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFD, 0x54,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xE4, 0x01, 0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0x81, 0xD2,
-    0x43, 0x40, 0x1C, 0xF6, 0xD5, 0x5B, 0x5F, 0xFF, 0xFF, 0xE0, 0x3D, 0x54, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7F, 0xAA, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x7E, 0x41, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0xF0,
-    0x7C, 0x2E, 0x00, 0x02, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xAA, 0x54, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAB, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2D, 0x07, 0x02, 0x07, 0x40, 0x2C, 0x39, 0xF5, 0x56, 0xC2, 0xFF, 0xFF, 0xFD, 0x01, 0xE5, 0x50,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xFA, 0xAC, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x2A, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B,
-    0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x2F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x7C, 0x0F, 0xC0, 0x00,
-    0x0B, 0xC1, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xCB, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x6F, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFE, 0xFF, 0x7F, 0xD0, 0x00, 0xBF, 0xDB, 0xFC, 0xBF, 0xD0, 0x0B, 0xFE, 0x2F, 0xF0, 0xFF, 0xD0,
-    0xBF, 0xF0, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0x80, 0x00,
-    0x00, 0xE0, 0x1D, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x50, 0x05,
-    0x00, 0x1F, 0x02, 0xE0, 0x7C, 0x00, 0x2F, 0x0B, 0x83, 0xE0, 0x00, 0x3D, 0x2E, 0x2F, 0x00, 0x00,
-    0x7C, 0xF8, 0xF4, 0x00, 0x00, 0xFB, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0xFD, 0xFF, 0x00, 0x3F, 0xCB, 0xF4, 0xFF, 0x03, 0xFD,
-    0x2F, 0xE1, 0xFF, 0x00, 0x04, 0x00, 0x50, 0x0E, 0x02, 0xF0, 0x1E, 0x07, 0xD0, 0x1E, 0x0F, 0x80,
-    0x1E, 0x1F, 0x00, 0x2E, 0x3D, 0x00, 0x2D, 0xBC, 0x00, 0x3E, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xFE, 0x40, 0x3D, 0x1B, 0xE0, 0x3D, 0x00, 0xF8, 0x3D, 0x00, 0x3D, 0x7D, 0x00, 0x2E, 0x7C, 0x00,
-    0x2F, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xE0,
-    0x00, 0x0A, 0x00, 0x04, 0x04, 0x07, 0x0F, 0x02, 0xC7, 0x40, 0xB3, 0x80, 0x2A, 0xC0, 0x0F, 0xE0,
-    0x03, 0xF9, 0x00, 0xE1, 0xF4, 0x38, 0x0B, 0x0E, 0x01, 0xD7, 0x80, 0x74, 0x00, 0x2C, 0x00, 0x6E,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0xC0, 0x3D, 0x00,
-    0x7C, 0x03, 0xD0, 0x07, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0xC0, 0x3D, 0x00, 0xBC, 0x03,
-    0xD0, 0x0B, 0x80, 0x3D, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x7E, 0x5B, 0xF0, 0x07, 0xFE, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x02, 0xF4, 0x05, 0x55, 0x00, 0xFF, 0xF0, 0x0F, 0x07, 0x00, 0xF0, 0x70, 0x0F, 0x07,
-    0x00, 0xE0, 0x70, 0x0E, 0x0B, 0x00, 0xE0, 0xB0, 0x0D, 0x0B, 0x02, 0xD0, 0xBE, 0x7C, 0x0B, 0xE0,
-    0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x0B, 0xC0, 0x00, 0x3E, 0x02,
-    0xF0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x3F,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x3F, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x07, 0xF4, 0x3F, 0x40, 0x01, 0xFF, 0x4F,
-    0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xB0, 0x3C,
-    0x00, 0xB0, 0x3C, 0x00, 0xB0, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xB4, 0x3E, 0xAA,
-    0xF4, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x3C, 0x00, 0xF8, 0x3C, 0x00, 0xFC, 0x7C, 0x00, 0xFD,
-    0x00, 0x00, 0x7C, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50,
-    0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00,
-    0xFC, 0x0B, 0xC0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x07, 0xF0,
-    0x3F, 0x40, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xB0, 0x3C, 0x00, 0xB0, 0x3C, 0x00, 0xB4, 0x3C, 0x00,
-    0xB4, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xB4, 0x3E, 0xAA, 0xF4, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF8,
-    0x3C, 0x00, 0xF8, 0x3C, 0x00, 0xF8, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0xF4, 0x28, 0x00, 0x29, 0x3D, 0x00, 0x3E, 0x3C, 0x00, 0x3E, 0x3C, 0x00,
-    0x2E, 0x3C, 0x00, 0x2E, 0x2C, 0x00, 0x2D, 0x2C, 0x00, 0x3D, 0x1D, 0x00, 0x7D, 0x0F, 0xAB, 0xFD,
-    0x03, 0xFF, 0xBD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x20, 0x05,
-    0x70, 0x0A, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x30, 0x1E, 0x3F, 0xBE, 0x0F, 0xDE, 0x00, 0x0E,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x34, 0x00, 0x34, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x0A, 0x90, 0x03,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x1F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFB, 0xF0, 0x0F, 0xFF, 0x00, 0x7C,
-    0xFD, 0x0B, 0xDF, 0xC0, 0x2F, 0x2F, 0xC3, 0xF3, 0xF0, 0x0B, 0xC7, 0xF1, 0xF8, 0xFC, 0x02, 0xF0,
-    0xFE, 0xFD, 0x3F, 0x00, 0xBD, 0x1F, 0xFF, 0x0F, 0xD0, 0x2F, 0x43, 0xFF, 0x83, 0xF4, 0x0F, 0xD0,
-    0xBF, 0xC1, 0xFD, 0x03, 0xF4, 0x1F, 0xF0, 0x7F, 0x80, 0xFE, 0x03, 0xF4, 0x1F, 0xE0, 0x3F, 0x80,
-    0x68, 0x0B, 0xF8, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x2F,
-    0x40, 0x3F, 0x03, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0xBF, 0x03, 0xEE, 0x0F, 0xB4, 0x3D, 0xF1, 0xEB,
-    0x43, 0xCF, 0x7D, 0xB4, 0x3C, 0xBF, 0xCF, 0x83, 0xC3, 0xF8, 0xF8, 0x3C, 0x2F, 0x0F, 0x83, 0xC1,
-    0xF0, 0xFC, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x03, 0xC0, 0x24, 0x7C, 0x7C, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x38, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02,
-    0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00,
-    0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2C, 0x03, 0x80, 0x38, 0x01, 0xFF, 0xF0, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC,
-    0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C,
-    0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x7C,
-    0x0B, 0x80, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x01, 0x50, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C,
-    0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0,
-    0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x00, 0xBE, 0x03, 0xC0, 0x7C, 0x07, 0xD0, 0xBC, 0x0B, 0xE0, 0xFC, 0x05, 0x50, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E,
-    0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42,
-    0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xD1, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFD, 0x5A, 0x00, 0x00, 0x0F, 0x40, 0xFF, 0xFF, 0x40,
-    0x00, 0x1F, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0xAA, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xAA, 0xA4, 0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xFC,
-    0x3F, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x2F, 0xD5, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x03, 0x80, 0x2E, 0x03, 0xFD, 0x00,
-    0x34, 0x0E, 0x00, 0x7E, 0x01, 0x5F, 0x07, 0x00, 0x0F, 0xFF, 0xFF, 0xC2, 0xC0, 0x03, 0xFA, 0x95,
-    0x40, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0xBF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xBF, 0xFF, 0xF8, 0x01, 0xBE, 0x4F, 0x6F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0x80, 0xE0, 0x1E, 0x01, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0xFA, 0xAA, 0x87, 0x80, 0x00, 0x1E,
-    0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x1F, 0xAA, 0xA8, 0x78, 0x00, 0x01,
-    0xE0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0x40, 0x0F, 0x94, 0xB0, 0x0C, 0x00, 0xA0, 0x0E, 0x01, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F,
-    0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0,
-    0x1B, 0xFA, 0x00, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x3C, 0x05, 0x5A, 0xBC, 0xBF, 0xFF, 0xFC, 0x79, 0x40, 0x38, 0x38, 0x00, 0xF0, 0x0D, 0x07,
-    0xD0, 0x07, 0xFF, 0x40, 0x00, 0x10, 0x00, 0x01, 0xA9, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x2F, 0xFF, 0xFE, 0x2F,
-    0xFA, 0xAD, 0x1C, 0x00, 0x2C, 0x0E, 0x00, 0x78, 0x03, 0x97, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x14, 0x01, 0x40, 0x3D, 0x07, 0xC0, 0x7E, 0x0B, 0xC0, 0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x3F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x05, 0x5A,
-    0xBC, 0xBF, 0xFF, 0xFC, 0x79, 0x40, 0x38, 0x38, 0x00, 0xF0, 0x0D, 0x07, 0xD0, 0x07, 0xFF, 0x40,
-    0x00, 0x10, 0x00, 0x01, 0xA9, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x2F, 0xFF, 0xFE, 0x2F, 0xFA, 0xAD, 0x1C, 0x00,
-    0x2C, 0x0E, 0x00, 0x78, 0x0B, 0x97, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0x82, 0xF4, 0x1F, 0xC3, 0xF4,
-    0x00, 0x00, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x83, 0xF0,
-    0x00, 0x00, 0x00, 0x55, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x03, 0xF0, 0x00, 0x3F, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x7E,
-    0x07, 0xC0, 0xFC, 0x00, 0x00, 0xBC, 0x1F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0xBC, 0x3F, 0x00, 0x00,
-    0x02, 0xF6, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xF7, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xCB, 0xFD, 0x00, 0xBF,
-    0xE2, 0xFF, 0x0F, 0xFD, 0x0B, 0xFF, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x00,
-    0xFC, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2E, 0x07, 0xC0,
-    0x02, 0xF0, 0xB8, 0x3E, 0x00, 0x03, 0xD2, 0xE2, 0xF0, 0x00, 0x07, 0xCF, 0x8F, 0x40, 0x00, 0x0F,
-    0xBE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xEF, 0xDF, 0xF0, 0x03, 0xFC, 0xBF, 0x4F, 0xF0, 0x3F, 0xD2, 0xFE, 0x1F, 0xF0, 0x14, 0x01,
-    0x40, 0xF8, 0x1F, 0x03, 0xE0, 0xBD, 0x1F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0x90, 0x0F, 0xFF, 0xF0, 0x14, 0x02, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x06,
-    0xAF, 0xD0, 0x1F, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x78, 0x00, 0x02, 0xE6,
-    0x00, 0x2F, 0x5F, 0xFF, 0xFC, 0x7F, 0xFF, 0xD0, 0x6F, 0xF8, 0x00, 0x3D, 0x07, 0xC7, 0xD0, 0xBC,
-    0x7E, 0x0F, 0xD5, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x06, 0x40, 0x00,
-    0x0C, 0x00, 0x02, 0x80, 0x0F, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x2C, 0x00, 0x02, 0xC0, 0x10, 0x7C,
-    0x0B, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x2A, 0xAA, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x2D, 0x00, 0x02,
-    0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xAF, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x07, 0x80, 0x00, 0x2F, 0x01, 0x80, 0xFC, 0x1F, 0xEF, 0xE0, 0x7F, 0xFF, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x3E, 0x00,
-    0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xAF, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x2F,
-    0x01, 0x80, 0xFC, 0x1F, 0xEF, 0xE0, 0x7F, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x56,
-    0xA8, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x00,
-    0x1F, 0xF4, 0x3F, 0x00, 0x3F, 0xF4, 0x2F, 0x00, 0x7E, 0xF8, 0x2F, 0x00, 0xFD, 0xF8, 0x2F, 0x01,
-    0xF8, 0xF8, 0x2F, 0x43, 0xF0, 0xFC, 0x2F, 0x47, 0xE0, 0xFC, 0x1F, 0x4B, 0xC1, 0xFC, 0x1F, 0x8F,
-    0x81, 0xFC, 0x1F, 0xAF, 0x01, 0xFC, 0x1F, 0xFE, 0x01, 0xFC, 0x0F, 0xFC, 0x01, 0xFD, 0x0F, 0xF8,
-    0x01, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x05, 0x5A, 0xA0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBC, 0x74, 0x01, 0xFC, 0x74, 0x03, 0xEC, 0x74, 0x0F,
-    0x6C, 0x78, 0x1E, 0x2C, 0x78, 0x3C, 0x2C, 0x78, 0xF4, 0x3C, 0x79, 0xE0, 0x3C, 0x7F, 0xC0, 0x3C,
-    0x7F, 0x40, 0x3C, 0x7E, 0x00, 0x3D, 0x01, 0x40, 0x14, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x0B, 0xD0,
-    0xFC, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x00,
-    0x1F, 0xF4, 0x3F, 0x00, 0x3F, 0xF4, 0x2F, 0x00, 0x7E, 0xF8, 0x2F, 0x00, 0xFC, 0xF8, 0x2F, 0x01,
-    0xF4, 0xF8, 0x2F, 0x43, 0xF0, 0xFC, 0x2F, 0x47, 0xE0, 0xFC, 0x1F, 0x4F, 0xC1, 0xFC, 0x1F, 0x8F,
-    0x81, 0xFC, 0x1F, 0xAF, 0x01, 0xFC, 0x1F, 0xFE, 0x01, 0xFC, 0x0F, 0xFC, 0x01, 0xFD, 0x0F, 0xF8,
-    0x01, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0x02, 0xF0, 0x1F, 0x42, 0xF0, 0x2F, 0x83, 0xF0, 0x15,
-    0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBC, 0x74, 0x01, 0xFC, 0x74, 0x03,
-    0xEC, 0x74, 0x0F, 0x6C, 0x78, 0x1E, 0x2C, 0x78, 0x3C, 0x2C, 0x78, 0xF4, 0x3C, 0x79, 0xE0, 0x3C,
-    0x7F, 0xC0, 0x3C, 0x7F, 0x40, 0x3C, 0x7E, 0x00, 0x3D, 0x00, 0x14, 0x01, 0x40, 0x00, 0x0F, 0x42,
-    0xF0, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x03,
-    0xF8, 0x00, 0x3F, 0x81, 0xF8, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00,
-    0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE2, 0xF8, 0x00, 0x03, 0xF4, 0x7F, 0xE9, 0x6B, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x0F, 0x42, 0xF0, 0x1F, 0x83, 0xF4, 0x15, 0x41, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xDB, 0xE0, 0x1E, 0x00, 0xF0, 0x3C,
-    0x00, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x3F, 0x55,
-    0xF8, 0x1F, 0xFF, 0xF0, 0x0B, 0xFF, 0xE0, 0x01, 0xFE, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xF4, 0x01, 0xFE, 0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xF0, 0x7D, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0B,
-    0xCB, 0xD5, 0x5A, 0xBF, 0x3F, 0xFF, 0xFF, 0xFC, 0xBC, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x0F, 0xC7,
-    0xF4, 0x01, 0xBE, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78,
-    0x00, 0x78, 0xB4, 0x00, 0x3C, 0xFF, 0xFF, 0xFC, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x01, 0x40, 0x14, 0x00, 0x0F, 0x41,
-    0xF0, 0x00, 0x7E, 0x0B, 0xC0, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xD0, 0x07, 0xF9, 0x6F, 0xE0, 0x3F, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x2F, 0x2F, 0x55, 0x6A, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00,
-    0x3F, 0x1F, 0xD0, 0x06, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x2F, 0x03, 0xD0, 0x3F, 0x07,
-    0xE0, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xFF,
-    0xFF, 0xFC, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xD0, 0x02, 0xFE, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0xFC, 0x1F, 0x40, 0x03, 0xF0, 0xBE, 0x00, 0x05,
-    0x41, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0xFE,
-    0xAF, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0xBC, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x01, 0xF1, 0xF9, 0x00, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0x82, 0xF0, 0x3F,
-    0x0F, 0xD0, 0xFC, 0x15, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x1D, 0x02,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x05, 0x5B, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0xB8, 0x00,
-    0x03, 0xD7, 0x91, 0xBE, 0x1F, 0xFF, 0xF0, 0x1B, 0xF9, 0x00, 0x01, 0x5A, 0xA4, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2D, 0x3D, 0x00, 0x3C, 0x1F,
-    0x00, 0x7C, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0xF0, 0x01, 0xF5, 0xF0, 0x00, 0xFF,
-    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x7F, 0x00, 0x2B, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x1A, 0xA9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4,
-    0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x0F, 0x40, 0xF0, 0x0F, 0x81, 0xF4, 0x1F, 0xC2, 0xF4,
-    0x05, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2D, 0x3C, 0x00, 0x3C, 0x1F,
-    0x00, 0x3C, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0xF0, 0x01, 0xF1, 0xF0, 0x00, 0xFF,
-    0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x7F, 0x00, 0x2B, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x05, 0x00, 0x50, 0x1F,
-    0x02, 0xF0, 0x2F, 0x43, 0xF0, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4,
-    0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE,
-    0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x01, 0xF0,
-    0x00, 0xB8, 0x0B, 0xC0, 0x03, 0xE0, 0x19, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x0F, 0x40, 0x0F, 0x00, 0x07, 0xC0,
-    0x1F, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0x7D,
-    0x7C, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0A, 0xFF,
-    0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x07, 0xC0,
-    0x02, 0xE0, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x0F, 0x00,
-    0x0F, 0x00, 0x0B, 0x80, 0x1E, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x3D, 0x00, 0x01, 0xF4,
-    0x7C, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x7D, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x50, 0x1F, 0x02, 0xF0, 0x2F, 0x43, 0xF0, 0x3F, 0x43, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x38, 0x74, 0x00, 0x3C, 0x74, 0x00, 0x3C,
-    0x74, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x7C, 0x78, 0x00, 0xBC, 0x3C, 0x00, 0xFC, 0x3F,
-    0x9B, 0xFC, 0x1F, 0xFF, 0xBC, 0x07, 0xF9, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x2E, 0x03, 0xD3, 0xF0, 0x7D, 0x3F, 0x0B, 0xE1, 0x50, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0xD0, 0x1C, 0x0D, 0x01, 0xC0, 0xD0, 0x1C, 0x0D, 0x01, 0xC0,
-    0xE0, 0x3C, 0x07, 0xEF, 0xC0, 0x2F, 0x9C, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x02, 0xC0, 0x3F,
-    0xFF, 0xFC, 0xFA, 0xAA, 0xA3, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00,
-    0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xB0, 0x00, 0x02, 0xC0, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFC, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0xF0,
-    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00,
-    0x0F, 0x82, 0xF0, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x00, 0x54, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0xFC, 0xB0, 0x00, 0x00, 0x03, 0xF2, 0xC0, 0x00, 0x00, 0x0F, 0xCF, 0x00, 0x00, 0x00, 0x3F, 0x3C,
-    0x00, 0x00, 0x00, 0xFC, 0xF0, 0x00, 0x00, 0x03, 0xF3, 0xD5, 0x40, 0x00, 0x0F, 0xCF, 0xFF, 0xE0,
-    0x00, 0x3F, 0x3C, 0x01, 0xF0, 0x00, 0xFC, 0xF0, 0x01, 0xD0, 0x03, 0xF3, 0xC0, 0x03, 0x80, 0x0F,
-    0xCF, 0x00, 0x0E, 0x00, 0x3F, 0x3C, 0x00, 0xB8, 0x00, 0xFC, 0xFE, 0xBF, 0xD0, 0x03, 0xF7, 0xFF,
-    0xFE, 0x00, 0x0F, 0xDF, 0xFF, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0x50, 0x14, 0x00, 0x0B, 0xC0, 0xF4,
-    0x00, 0x3F, 0x07, 0xE0, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x7C, 0x00, 0x00, 0xB1, 0xF0, 0x00, 0x02, 0xC3, 0xC0,
-    0x00, 0x0B, 0x0F, 0x00, 0x00, 0x2C, 0x3F, 0xFE, 0x40, 0xB0, 0xF0, 0x0B, 0x42, 0xC3, 0xC0, 0x0B,
-    0x0F, 0x0F, 0x00, 0x2C, 0x3C, 0x3C, 0x01, 0xF0, 0xF0, 0xFF, 0xFF, 0x83, 0xD3, 0xFF, 0xE4, 0x0F,
-    0x40, 0x0A, 0x40, 0x00, 0x1A, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFC, 0x0B, 0xF4, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x03,
-    0xC0, 0x0B, 0x00, 0xB0, 0x00, 0x3C, 0x1E, 0x00, 0x01, 0xD3, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2E, 0x7C, 0x00, 0x07, 0xC2, 0xE0,
-    0x00, 0xF4, 0x0F, 0x94, 0x3F, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x24, 0x02, 0x4E, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x0E, 0x38,
-    0x03, 0x8D, 0x00, 0xE3, 0x40, 0x34, 0xD0, 0x0D, 0x34, 0x03, 0x4D, 0x00, 0xD3, 0x40, 0x34, 0xD0,
-    0x0D, 0x34, 0x03, 0x4C, 0x00, 0xD3, 0x00, 0x31, 0xC0, 0x1C, 0x70, 0x07, 0x1C, 0x01, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x2F, 0x87, 0xF0, 0xFC, 0x3F, 0x47, 0xE0, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x2F,
-    0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0xFE, 0x2F, 0x87, 0xF0, 0xFC, 0x3F, 0x47, 0xE0, 0xFE,
-    0x3F, 0x4B, 0xE2, 0xF8, 0x7F, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xC1, 0xF8, 0xBE, 0x2F, 0x8F,
-    0xE3, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7E, 0x2F, 0x8F, 0xD3, 0xF4, 0x2F, 0x8F, 0xD3,
-    0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0xBE, 0x2F, 0xC7, 0xF1, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F,
-    0x4B, 0xD1, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x38, 0x00, 0x1A,
-    0xBE, 0xA8, 0x3F, 0xFF, 0xFC, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0,
-    0x00, 0xAB, 0xEA, 0x8B, 0xFF, 0xFF, 0x40, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xEE, 0x03, 0xFF, 0xFC, 0x1A, 0xBC, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x40, 0x7F,
-    0x47, 0xFD, 0x7F, 0x43, 0x40, 0x00, 0x00, 0x14, 0x7C, 0xBC, 0xFD, 0x14, 0x7C, 0xBC, 0xFD, 0x14,
-    0x00, 0x50, 0x01, 0x47, 0xC0, 0x0F, 0x40, 0x3D, 0xBC, 0x01, 0xF8, 0x07, 0xDF, 0xD0, 0x2F, 0x80,
-    0xBE, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x07, 0x05, 0x40, 0x03, 0x41, 0x20, 0x01, 0xC1, 0x64, 0x00,
-    0xD0, 0x56, 0x40, 0xB0, 0x0D, 0xC0, 0x74, 0x02, 0xE0, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xD1, 0x45, 0x00, 0xF2,
-    0x21, 0x20, 0xB4, 0x99, 0x58, 0x3C, 0x23, 0x26, 0x3D, 0x07, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x2F,
-    0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x2F, 0x8F, 0xE3, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x7E, 0x2F, 0x8F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xE0, 0x28, 0x0F, 0x41,
-    0xF0, 0x7C, 0x1E, 0x03, 0xC0, 0xF4, 0x3C, 0x0B, 0x41, 0xE0, 0xB0, 0x0D, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x1F, 0x02, 0xE0, 0x3C, 0x03, 0x80, 0x00, 0x28, 0x1C, 0x03, 0xC3, 0xE0, 0x1F,
-    0x0F, 0x00, 0xB4, 0x78, 0x02, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0A, 0x01,
-    0xC0, 0x7C, 0x1F, 0x03, 0xE0, 0x2D, 0x07, 0x80, 0xF0, 0x0F, 0x02, 0xC0, 0x78, 0x03, 0x80, 0xA0,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x7C, 0x00, 0x77, 0xC0, 0xB8, 0x3D, 0x00, 0x10,
-    0x01, 0xC0, 0x2E, 0x03, 0xD0, 0x3D, 0x00, 0xF4, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xE0, 0x01, 0x40,
-    0x00, 0x01, 0xC0, 0x03, 0xD0, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0x3C, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0xF8, 0x02, 0xA0, 0x03, 0xF0, 0x0F,
-    0xC0, 0xBD, 0x00, 0x0F, 0xC1, 0xFC, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x2F, 0x01,
-    0xFF, 0xF8, 0x05, 0x03, 0xF0, 0x07, 0xFE, 0x00, 0xF4, 0x3F, 0x00, 0x3F, 0xD0, 0x1F, 0x81, 0x50,
-    0x0F, 0xFF, 0x41, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0xBF, 0xD0, 0x50, 0x3F, 0xE0, 0x2F, 0xF8, 0x2F, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
-    0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0F, 0xC0, 0x04, 0x00, 0x01,
-    0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0, 0x00, 0x24, 0x00, 0x01, 0xE0, 0x00, 0x6F, 0xD0, 0x0F, 0xFF,
-    0xF0, 0xB8, 0x7F, 0xE0, 0x41, 0xE7, 0xC0, 0x0B, 0x8F, 0x80, 0x2E, 0x2E, 0x00, 0xB8, 0xF8, 0x02,
-    0xE3, 0xD0, 0x0F, 0x9F, 0x00, 0x3E, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x02, 0x8E, 0x01, 0xD1, 0xFF, 0xF0, 0x0B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x8C, 0x90, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x0C, 0xC5, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x24, 0x00, 0xC0, 0x22, 0x49, 0xDC, 0xD1, 0xFE,
-    0x02, 0xE0, 0x07, 0xD0, 0x7E, 0xD3, 0xA6, 0xC8, 0xC5, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x1B, 0x90, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF4, 0x2E, 0x02, 0xF8, 0x3D, 0x07, 0xF4, 0x10,
-    0x01, 0xF4, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xB4, 0x07,
-    0xF0, 0x3C, 0x10, 0x01, 0xF4, 0x3C, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00,
-    0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x02, 0xE0, 0x7C, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x2F,
-    0x40, 0x7C, 0x02, 0xFD, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0xFC, 0x01, 0x90, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x01, 0xF8, 0x01, 0xF0, 0x02, 0xFC, 0x02, 0xF4, 0x03, 0xFC, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x78, 0x07, 0xF0, 0x02,
-    0xC4, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xB8,
-    0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x1F, 0x00, 0x2F,
-    0x80, 0x07, 0xC0, 0x7F, 0x80, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x2F, 0x01,
-    0xF4, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x03, 0xF0, 0x19, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x1F, 0x80, 0x3D, 0x00, 0x0B, 0xE0, 0x1F, 0x80, 0x03, 0xFC, 0x0B, 0xE0, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x01,
-    0xD0, 0x0B, 0x82, 0xC0, 0x0F, 0xC3, 0xC0, 0x0F, 0xC3, 0x80, 0x05, 0x4B, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0xF0, 0x50, 0x00, 0xF1, 0xF0, 0x02, 0xE2, 0xF0, 0x03, 0xD3, 0xF4, 0x03, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x09, 0x83, 0x05, 0x32,
-    0x23, 0x23, 0x30, 0x63, 0x4E, 0x2F, 0xC0, 0xA4, 0x00, 0x00, 0x18, 0x03, 0x80, 0xD8, 0x24, 0xC3,
-    0xFE, 0x16, 0xD0, 0x1C, 0x01, 0xC0, 0x00, 0x03, 0xA8, 0x30, 0x03, 0x00, 0x3F, 0x80, 0x0A, 0x10,
-    0xA3, 0xFD, 0x1A, 0x00, 0x0B, 0xD2, 0x40, 0x3A, 0x83, 0x8A, 0x30, 0x33, 0x4B, 0x1F, 0xD0, 0x10,
-    0x00, 0x00, 0xBF, 0xC0, 0x07, 0x00, 0x28, 0x00, 0xE0, 0x03, 0x40, 0x1C, 0x00, 0xB0, 0x03, 0xC0,
-    0x0A, 0x80, 0x81, 0x82, 0x4A, 0x03, 0xF0, 0x24, 0xA0, 0xC0, 0xC3, 0x4B, 0x07, 0xF4, 0x0E, 0x80,
-    0xC2, 0x83, 0x03, 0x0D, 0x1C, 0x1F, 0xF0, 0x00, 0xC1, 0x5A, 0x0B, 0xF0, 0x24, 0x69, 0x00, 0xFF,
-    0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F,
-    0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x05, 0x40, 0x24,
-    0x30, 0x70, 0x18, 0xA2, 0x0C, 0xE3, 0x4C, 0xE2, 0x0C, 0xF0, 0x1C, 0xB0, 0x3C, 0x7E, 0xFC, 0x3F,
-    0xF4, 0x0B, 0xD0, 0x00, 0x02, 0xE0, 0x06, 0x00, 0x60, 0x0A, 0x00, 0xA0, 0x0A, 0x03, 0xFD, 0x2A,
-    0x80, 0x2F, 0x82, 0x0E, 0x00, 0x70, 0x0A, 0x01, 0xD0, 0x78, 0x2E, 0x03, 0xFF, 0x15, 0x50, 0x1A,
-    0x40, 0x09, 0x00, 0x20, 0x09, 0x0F, 0xD0, 0x0A, 0x00, 0xB3, 0xFD, 0x15, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x7C, 0x03, 0x70, 0x28, 0xC0, 0xFF, 0xC0, 0x1C, 0x00, 0x70, 0x00, 0x03, 0xA8, 0x30, 0x03,
-    0xE4, 0x00, 0xC0, 0x0D, 0x3A, 0xD3, 0xF4, 0x0B, 0xD0, 0x90, 0x03, 0xB8, 0x0E, 0x28, 0x30, 0x30,
-    0xD1, 0xC1, 0xFD, 0x00, 0x40, 0x3F, 0xA0, 0x06, 0x00, 0xA0, 0x0D, 0x00, 0xD0, 0x1C, 0x02, 0xC0,
-    0x3C, 0x00, 0x00, 0x05, 0x40, 0x62, 0x82, 0x03, 0x0A, 0x28, 0x0F, 0xC0, 0xD1, 0xC3, 0x47, 0x07,
-    0xF4, 0x00, 0x00, 0x06, 0x40, 0x92, 0x43, 0x07, 0x0C, 0x0C, 0x34, 0x70, 0x7F, 0xC0, 0x07, 0x0B,
-    0xF4, 0x05, 0x00, 0x00, 0xA0, 0x07, 0x40, 0x3C, 0x01, 0xD0, 0x0F, 0x00, 0x38, 0x02, 0xD0, 0x0F,
-    0x00, 0x38, 0x01, 0xD0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xB4,
-    0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x1F,
-    0x00, 0x3D, 0x00, 0xBC, 0x28, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xD0, 0x03, 0xC0, 0x0B, 0x40, 0x0E,
-    0x00, 0x3C, 0x00, 0xB4, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-    0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x80, 0x2D, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x07, 0xC0,
-    0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1E, 0x0E,
-    0x00, 0x00, 0xB0, 0x74, 0x00, 0x03, 0xC2, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE6, 0xE4, 0x02, 0xFF, 0x0B, 0x00, 0x1F, 0xF8, 0x3C, 0x00, 0xFD, 0xD1, 0xE0, 0x07, 0xDB,
-    0x0B, 0x40, 0x2F, 0x3C, 0x3C, 0x00, 0xFC, 0xE0, 0xF0, 0x03, 0xF7, 0x47, 0x80, 0x0F, 0xFC, 0x2C,
-    0x00, 0x3F, 0xF0, 0xF0, 0x00, 0xFF, 0xC3, 0x80, 0x02, 0xFF, 0xFF, 0xAF, 0x03, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0xBA, 0xFF, 0xF9, 0x03, 0xC2, 0xC0, 0x00, 0x0E,
-    0x0F, 0x00, 0x00, 0x74, 0x38, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x02,
-    0x59, 0x3F, 0x00, 0x3F, 0xE3, 0xF0, 0x03, 0xD0, 0x3F, 0x80, 0x38, 0x03, 0xFE, 0x03, 0x80, 0x2F,
-    0xFF, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F,
-    0xFF, 0xD0, 0x0B, 0xD0, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x50, 0x00, 0x0F, 0x40, 0x03,
-    0xF8, 0x00, 0x1F, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xFE, 0x00, 0x1F, 0x40, 0x03, 0xFF,
-    0x00, 0x2F, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x07, 0xE7, 0xD0,
-    0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x3F, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xE0, 0xBD, 0x3F, 0x00, 0x0B, 0xE0, 0x3E, 0x3F, 0x00, 0x0B, 0xE0, 0x2F, 0x7F, 0x00,
-    0x0F, 0xE0, 0x0F, 0xFE, 0x00, 0x0F, 0xE0, 0x0B, 0xFE, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x0F,
-    0xF0, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xF0, 0x07, 0xF0,
-    0x01, 0xF0, 0x00, 0xF0, 0xBF, 0xFF, 0xFF, 0xFE, 0x57, 0xF5, 0x56, 0xF9, 0x02, 0xF0, 0x06, 0xF0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFA, 0x94, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x1D, 0x00, 0x00,
-    0x00, 0x30, 0x03, 0x80, 0x00, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x01, 0xF4, 0x00, 0x2F,
-    0x81, 0xFF, 0xFC, 0x00, 0x3E, 0xA0, 0x7F, 0xFD, 0x00, 0x1C, 0x00, 0x1F, 0xFF, 0x40, 0x07, 0x00,
-    0x0B, 0xE5, 0xF0, 0x00, 0xF4, 0x02, 0xF0, 0x2E, 0x00, 0x2F, 0xD0, 0xBC, 0x07, 0xC0, 0x01, 0xFD,
-    0x2F, 0x01, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x7C, 0x00, 0x40, 0xF3, 0xF0, 0x1F, 0x40, 0x7F, 0xFC,
-    0xFC, 0x07, 0xE0, 0x3F, 0xFF, 0x3F, 0x01, 0xFC, 0x07, 0xFE, 0x00, 0x2C, 0x00, 0x00, 0x34, 0x1C,
-    0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0x00, 0xF0, 0x0F,
-    0x03, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0x0F, 0xE2, 0xD0, 0x07,
-    0x4F, 0xF2, 0xC0, 0x07, 0x9E, 0xF3, 0xC0, 0x03, 0xBD, 0xB7, 0xC0, 0x03, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x3F, 0x80, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF4, 0x2F, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x01,
-    0xF0, 0x1F, 0x00, 0xA5, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x05, 0xFF, 0xAF, 0xE0, 0x0F, 0xF8,
-    0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x0F, 0xF4, 0x00, 0x3C, 0x0F, 0xF4, 0x24, 0x2C, 0x0F, 0xF0,
-    0x3C, 0x2C, 0x0F, 0xF0, 0x3C, 0x2C, 0x0F, 0xF0, 0x3C, 0x2C, 0x0F, 0xF0, 0x3C, 0x00, 0x0F, 0xF0,
-    0x2C, 0x00, 0x0F, 0xF0, 0x1F, 0x00, 0x1F, 0xF0, 0x0B, 0xE5, 0x7F, 0x60, 0x02, 0xFF, 0xFF, 0x00,
-    0x00, 0x16, 0xBF, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x06, 0xBE, 0x90, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF3, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x38, 0x1F, 0x80, 0x0B,
-    0x00, 0xB8, 0x00, 0xE0, 0x0B, 0x80, 0x0F, 0x00, 0xB8, 0x00, 0xF4, 0x1F, 0x80, 0x07, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x69, 0x14, 0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x01, 0xFC, 0x01, 0x00, 0xBC, 0x00, 0x00,
-    0x3D, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x57, 0xEA, 0x80, 0x00, 0xF0, 0x00, 0x05, 0xBF, 0xF8, 0x03,
-    0xFF, 0xA9, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD2, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xE7, 0xE7, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x97, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7C,
-    0x01, 0xBC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBC, 0x00, 0x3D, 0x06, 0xAF, 0xEA, 0xAB, 0xFA,
-    0x00, 0xBC, 0x01, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x0F, 0xEA,
-    0x50, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0xBF, 0x97, 0x01, 0x00, 0x3F, 0x41, 0xC0, 0x00, 0x2F, 0x80, 0x70, 0x00, 0x0F, 0xD0, 0x1C, 0x00,
-    0x03, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x00, 0x3F, 0x00, 0x70, 0x00, 0x0F, 0xC0, 0x1F,
-    0xFA, 0x43, 0xF0, 0x07, 0xBF, 0xF8, 0xFC, 0x01, 0xC0, 0xBE, 0x2F, 0x80, 0x70, 0x2D, 0x07, 0xF8,
-    0x1C, 0x0F, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0E, 0xAB, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x01, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0E,
-    0x00, 0x00, 0xE0, 0x00, 0x7F, 0xE0, 0x2F, 0xFF, 0x03, 0xEB, 0x00, 0xBC, 0xB0, 0x0B, 0x4B, 0x00,
-    0xF4, 0xB0, 0x0F, 0x4B, 0x00, 0xB8, 0x70, 0x0B, 0xD7, 0x00, 0x3F, 0xFA, 0x01, 0xFF, 0xF8, 0x06,
-    0xFF, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x15, 0x55, 0x57, 0xFF, 0xFF, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x15, 0x7D, 0x53, 0xFF, 0xFF, 0x00,
-    0x78, 0x01, 0x6F, 0x40, 0x7F, 0xD0, 0x07, 0xFE, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3D,
-    0x00, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0x03, 0xC1, 0x80, 0x03, 0xEF, 0xC0, 0x0B, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x67, 0xC6, 0xC0,
-    0x03, 0xFF, 0x80, 0x1B, 0xF8, 0x00, 0x7F, 0xC0, 0x0D, 0x63, 0xC0, 0x3C, 0x03, 0xC1, 0xF4, 0x03,
-    0xFF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x7E, 0x00, 0xF5, 0xC3, 0xC0, 0x3C,
-    0x70, 0xF0, 0x1E, 0x1C, 0x2C, 0x07, 0x47, 0x07, 0x01, 0xD1, 0xC1, 0xC0, 0x74, 0x70, 0x70, 0x1D,
-    0x1C, 0x1C, 0x03, 0x43, 0x07, 0x00, 0xE0, 0xC2, 0xC0, 0x38, 0x34, 0xB0, 0x00, 0x1F, 0xFF, 0x90,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xF0, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xC0, 0x02, 0xF0, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xEA, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFA, 0xAA, 0xA8, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x1F, 0xFF, 0x40, 0x07, 0xCF, 0x2E, 0x02, 0xE0, 0xF0, 0xB8, 0x38, 0x0F, 0x01, 0x80,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0xFF, 0xFF, 0x82, 0xAA, 0xAA,
-    0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x10, 0x0F, 0x00, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
-    0x4F, 0x0F, 0x40, 0x3D, 0xF7, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0xE0, 0x03, 0x40, 0x03, 0xC0, 0x01, 0xD0, 0x0B, 0x00, 0x00,
-    0x70, 0x2D, 0x55, 0x55, 0x7C, 0x3F, 0xFF, 0xFF, 0xFE, 0x1D, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x00,
-    0xB0, 0x02, 0xC0, 0x02, 0xC0, 0x00, 0xA0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x6A, 0xD0, 0x2C, 0x28, 0x74, 0x20, 0x28, 0x14, 0x00,
-    0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x20, 0x28, 0x00, 0x3C, 0x28,
-    0x38, 0x0F, 0x68, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x14, 0x00, 0x16, 0xAF, 0xE0,
-    0xFF, 0xFA, 0x43, 0xF4, 0x00, 0x0E, 0xF4, 0x00, 0x34, 0xF4, 0x00, 0xD0, 0xF4, 0x03, 0x40, 0xF4,
-    0x1D, 0x00, 0xF4, 0x20, 0x00, 0xF4, 0x00, 0x00, 0x80, 0x1F, 0xEA, 0x50, 0x2B, 0xFF, 0xC0, 0x00,
-    0x3F, 0x00, 0x03, 0xEC, 0x00, 0x3D, 0x34, 0x03, 0xD0, 0xD0, 0x3D, 0x03, 0x43, 0xD0, 0x0E, 0x3D,
-    0x00, 0x24, 0x90, 0x00, 0x00, 0x24, 0x00, 0x00, 0xF0, 0x00, 0x40, 0xF0, 0x03, 0x41, 0xF0, 0x0D,
-    0x01, 0xE0, 0x70, 0x02, 0xE2, 0xC0, 0x02, 0xDB, 0x00, 0x03, 0xF8, 0x1A, 0xAB, 0xE0, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x03, 0xC3, 0x40, 0x2D, 0x0D, 0x02, 0xE0, 0x38,
-    0x1E, 0x00, 0xF1, 0xF0, 0x02, 0xCF, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xAA, 0x90, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x47, 0x00, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x03, 0xDD, 0x1C, 0xF0, 0x03, 0xD3, 0x47, 0x0F,
-    0x03, 0xD0, 0xD1, 0xC0, 0xF0, 0xD0, 0x34, 0x70, 0x04, 0x00, 0x0D, 0x1C, 0x00, 0x00, 0x03, 0x47,
-    0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x34, 0x70, 0x00, 0x00, 0x0D, 0x1C, 0x00, 0x00, 0x03,
-    0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00,
-    0x03, 0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x34, 0x70, 0x00, 0x00, 0x0D, 0x1C, 0x00,
-    0x00, 0x03, 0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x40, 0x34, 0x70, 0x00, 0x3C, 0x0D, 0x1C,
-    0x0B, 0x07, 0xC3, 0x47, 0x0B, 0x40, 0x7C, 0xD1, 0xCB, 0x40, 0x07, 0xF4, 0x7B, 0x40, 0x00, 0xBD,
-    0x1F, 0x40, 0x00, 0x0B, 0x47, 0x40, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x80, 0x00, 0x03, 0x80, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0xF0, 0x00, 0x1D, 0x00, 0x07,
-    0x80, 0x03, 0x80, 0x00, 0x2D, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x3C, 0x00, 0x00, 0x03, 0xC2, 0xE0,
-    0x00, 0x00, 0x78, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2E, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x01, 0xF0,
-    0x00, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xB7, 0xD0, 0x00, 0x3E, 0x1F, 0x80, 0x2F, 0xD1, 0x9F, 0x42, 0xD9, 0x18, 0x3C, 0x00,
-    0x91, 0x80, 0x00, 0x09, 0x18, 0x00, 0x00, 0x91, 0x80, 0x00, 0x09, 0x18, 0x00, 0x00, 0x91, 0x80,
-    0x02, 0xD9, 0x18, 0x7C, 0x1F, 0xD1, 0xAF, 0x40, 0x3E, 0x1F, 0x80, 0x00, 0xBB, 0xD0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x64, 0x0E, 0x0B, 0xFF, 0x4D, 0x1F, 0x43,
-    0xDC, 0x3D, 0x00, 0xFC, 0x3C, 0x00, 0xBC, 0x7C, 0x00, 0x78, 0x3C, 0x00, 0x74, 0x3E, 0x00, 0xF0,
-    0x2F, 0xEF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xE4, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xC3, 0xC0, 0x03, 0xF8, 0x03, 0xFF, 0xC0, 0x03, 0xF8,
-    0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x00,
-    0x07, 0xCF, 0x80, 0x0F, 0x80, 0x07, 0xC3, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0xBC, 0x00, 0xF4, 0x07,
-    0x80, 0x2F, 0x00, 0x3E, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0xC7, 0x80, 0x03, 0xE0, 0x02, 0xFF, 0x80,
-    0x03, 0xF4, 0x00, 0x7F, 0xE5, 0x6B, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0x5F, 0xFF, 0xFF, 0x40, 0x07, 0x40, 0x6F, 0xF9, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x01, 0xF4,
-    0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x0F, 0x80,
-    0x03, 0xF0, 0x2F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xE0, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B,
-    0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x02,
-    0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00,
-    0xB8, 0x03, 0xC0, 0x06, 0x40, 0x28, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0,
-    0x0B, 0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C,
-    0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x07, 0xF5, 0x6F,
-    0x57, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x57, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80,
-    0x00, 0x0D, 0x00, 0x00, 0x34, 0x00, 0x00, 0xC0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x3D, 0x55, 0x47, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x6A, 0x93, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x20, 0x1F, 0x40, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xB8, 0x06, 0xE0, 0x03, 0xFF, 0xD3, 0xFF, 0x02, 0xE0, 0x3E, 0xD0, 0xB0, 0xF0, 0x03,
-    0xD0, 0x0C, 0x34, 0x00, 0xF0, 0x03, 0x5D, 0x00, 0x2C, 0x00, 0xD3, 0x40, 0x0F, 0x80, 0xB0, 0xF0,
-    0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xAF, 0xFD, 0x03, 0xFF, 0xC2, 0xFD, 0x00, 0x1A, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x40, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x24, 0x2F, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0A, 0x07, 0xD2, 0xF8,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x81, 0xF4, 0xBE, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x09, 0x3C, 0x74, 0x0E, 0x78, 0x1E, 0x1D, 0x74, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x09, 0x3C, 0x3D, 0x0D, 0x74, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x1E, 0xA0, 0x3F, 0xFF, 0xFF, 0xC6, 0xA5, 0xB0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x16, 0xBD, 0xAA, 0x47, 0xFF, 0xFF, 0xF8, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0x90,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xA5, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x5A, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x90, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x07, 0xFF,
-    0xF4, 0x06, 0xFF, 0xF9, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x5A, 0xF4, 0x1A, 0xFF, 0xFF, 0xE4, 0x3E, 0xA5, 0x00, 0x00,
+static const uint8_t opendyslexic_10_regularBitmaps[21993] = {
+    0x95, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x07, 0x67, 0x25, 0x8F, 0xE3, 0x49, 0x61,
+    0x04, 0x31, 0xC1, 0xDB, 0x50, 0x84, 0xC8, 0xF6, 0xA6, 0x48, 0x61, 0xA1, 0x3D, 0xEF, 0x5A, 0xD4,
+    0x48, 0x2E, 0x48, 0x91, 0xFC, 0x04, 0x24, 0xB0, 0x8B, 0x14, 0x91, 0xB8, 0xE4, 0x36, 0x49, 0x91,
+    0x02, 0x24, 0x5B, 0x42, 0x54, 0x14, 0x84, 0x82, 0x22, 0x09, 0x52, 0x22, 0x94, 0xC2, 0x12, 0x17,
+    0xDF, 0x24, 0x57, 0xA4, 0xA0, 0x59, 0x30, 0x12, 0xED, 0x22, 0x90, 0x88, 0x68, 0x18, 0xC4, 0x4A,
+    0x9C, 0x93, 0xBD, 0x1D, 0xBE, 0xD9, 0xF3, 0x91, 0xB4, 0xAC, 0x66, 0x76, 0xC7, 0xE3, 0x37, 0x6F,
+    0xBE, 0xEF, 0xBD, 0xEF, 0xBD, 0x43, 0x96, 0x48, 0x33, 0x19, 0xDD, 0xD0, 0x74, 0x95, 0xE9, 0x73,
+    0x68, 0xF3, 0x0A, 0xC4, 0x28, 0x1E, 0xD6, 0xA9, 0x89, 0x6F, 0xDA, 0x71, 0x34, 0xAC, 0x7A, 0xFA,
+    0x51, 0x95, 0x86, 0x65, 0x1D, 0xE7, 0x90, 0x66, 0x19, 0x40, 0x12, 0x18, 0x70, 0x99, 0x70, 0x79,
+    0x59, 0x72, 0x19, 0xE6, 0x09, 0x84, 0xE3, 0x53, 0xC7, 0xFE, 0x9D, 0xA1, 0x52, 0x39, 0xA0, 0xB3,
+    0x3D, 0x1A, 0x58, 0x9D, 0x01, 0x11, 0x2A, 0x40, 0xF8, 0x65, 0xEA, 0x0D, 0xDE, 0xF5, 0x2F, 0x8B,
+    0x54, 0x58, 0xBA, 0x29, 0x63, 0x5A, 0xAD, 0x07, 0x5C, 0x86, 0xC5, 0x3A, 0xA6, 0x4F, 0x38, 0x07,
+    0x04, 0xC3, 0x0C, 0x81, 0x6B, 0x10, 0x3A, 0x97, 0x4B, 0xF7, 0xE1, 0x66, 0xF0, 0x8C, 0x1B, 0xF5,
+    0x76, 0x81, 0xF4, 0xD4, 0x39, 0xA8, 0xE7, 0xC7, 0x01, 0xFE, 0x03, 0x8A, 0x16, 0x58, 0x75, 0x15,
+    0x42, 0xED, 0x32, 0x31, 0xEC, 0x95, 0xD8, 0xFE, 0xB3, 0xE6, 0x35, 0x8D, 0xC7, 0x12, 0x71, 0x8A,
+    0x81, 0x3B, 0x04, 0x78, 0x04, 0xE1, 0xF1, 0xA9, 0x7B, 0x41, 0xD4, 0xE7, 0x54, 0xA9, 0x82, 0xEB,
+    0x79, 0x71, 0x76, 0x2E, 0x91, 0x78, 0x82, 0xB3, 0xA7, 0xCA, 0xC0, 0x7D, 0x03, 0xF5, 0x3B, 0xA1,
+    0xFF, 0x53, 0x61, 0xE9, 0x91, 0x91, 0x4F, 0x67, 0xF1, 0x6D, 0x76, 0x6B, 0xE9, 0xF4, 0xBC, 0x34,
+    0xCE, 0x5C, 0x0E, 0xAD, 0x3A, 0x3A, 0x1D, 0xF0, 0x5A, 0x7D, 0xD7, 0x62, 0x15, 0x0F, 0xD0, 0x21,
+    0xB5, 0x98, 0x44, 0xF4, 0xF7, 0x05, 0xA4, 0x23, 0x9F, 0x9A, 0xCC, 0xF9, 0x8D, 0x6F, 0x9A, 0x93,
+    0xA9, 0xA8, 0x3A, 0x3D, 0x74, 0xFA, 0x3D, 0xE8, 0x51, 0x9A, 0x47, 0x96, 0x88, 0x46, 0x84, 0xFB,
+    0xBA, 0x18, 0x94, 0xAD, 0x9F, 0x74, 0xE7, 0xC0, 0xD6, 0xA9, 0x36, 0xB8, 0x15, 0x66, 0x89, 0x28,
+    0x34, 0xD6, 0x02, 0xFF, 0x12, 0x85, 0xCA, 0x12, 0x58, 0x69, 0x34, 0x12, 0x3C, 0x08, 0x8A, 0x30,
+    0xF7, 0x8B, 0x4A, 0x94, 0xDC, 0xC9, 0x22, 0xDE, 0xD8, 0x3F, 0x8D, 0x4B, 0xB0, 0xA2, 0x90, 0x46,
+    0x65, 0xF3, 0xDE, 0x46, 0x94, 0x13, 0x9B, 0xC9, 0x19, 0x51, 0xAA, 0x7C, 0x05, 0x36, 0x34, 0xAB,
+    0xA8, 0x42, 0xB3, 0xCE, 0xB8, 0xE7, 0x38, 0x41, 0xCA, 0x42, 0x4A, 0xFD, 0xE9, 0x5E, 0xD8, 0x40,
+    0x56, 0xF8, 0x6E, 0x5F, 0xBF, 0xB7, 0x0C, 0xC6, 0xA4, 0x00, 0xDE, 0x02, 0x4A, 0xC8, 0x1C, 0xF3,
+    0x38, 0xB3, 0xFF, 0x95, 0x73, 0xA6, 0x5D, 0x62, 0xCD, 0xEF, 0xC6, 0x1E, 0xE1, 0xD5, 0x94, 0x29,
+    0x64, 0x12, 0x7A, 0xCE, 0x2E, 0x74, 0xFB, 0xE3, 0x16, 0xFA, 0x0C, 0x23, 0x0A, 0x2C, 0xB7, 0x66,
+    0x97, 0x80, 0xFB, 0x4C, 0xB4, 0xB7, 0x0F, 0x18, 0x04, 0xE3, 0x7D, 0x85, 0x19, 0x18, 0x2D, 0x0D,
+    0x2C, 0x01, 0x2B, 0x54, 0x4C, 0x3B, 0xF6, 0x5A, 0x2B, 0x0B, 0x31, 0x35, 0x0C, 0x0D, 0xA8, 0x14,
+    0xCA, 0x82, 0x86, 0xAB, 0x20, 0x33, 0x8F, 0x88, 0x97, 0xE1, 0x0E, 0xE4, 0x75, 0x33, 0x8F, 0xFB,
+    0x84, 0x98, 0x60, 0x2D, 0x69, 0x9F, 0x2E, 0xC7, 0xE9, 0x24, 0x41, 0x97, 0x01, 0x48, 0x05, 0xA5,
+    0x56, 0x69, 0x67, 0x43, 0x57, 0x88, 0xC6, 0x03, 0xEA, 0x21, 0xB2, 0x62, 0xC7, 0x7B, 0xD7, 0x93,
+    0x17, 0x73, 0x12, 0x4D, 0x5F, 0xA1, 0x1B, 0xF7, 0xDC, 0xCF, 0x6E, 0x2C, 0x6E, 0x53, 0x32, 0x72,
+    0xF7, 0x6A, 0x8B, 0xA6, 0x82, 0x2C, 0xBC, 0x71, 0x0D, 0x55, 0x60, 0xC0, 0xE3, 0x81, 0x43, 0x6C,
+    0x69, 0x70, 0xE0, 0xDC, 0x97, 0xAE, 0x51, 0x0D, 0x6E, 0x6F, 0xB5, 0x2C, 0x48, 0x74, 0x9B, 0x68,
+    0x17, 0xFB, 0x70, 0x05, 0x42, 0xEB, 0x8F, 0x11, 0xF5, 0xEA, 0x42, 0x50, 0x39, 0x37, 0x74, 0xE3,
+    0x63, 0x54, 0x83, 0x57, 0x6C, 0xE6, 0x89, 0xB0, 0x46, 0x3E, 0xCE, 0xF1, 0x77, 0x2E, 0x0F, 0x8C,
+    0xBA, 0x61, 0x22, 0x69, 0xD6, 0x5F, 0xFB, 0xA9, 0xE7, 0xEA, 0x77, 0xEE, 0x8D, 0x28, 0x6F, 0x7F,
+    0x91, 0x1F, 0xE5, 0xAB, 0xE7, 0x33, 0x56, 0x81, 0xF1, 0xB7, 0x27, 0x1E, 0xAD, 0xFC, 0x23, 0xD3,
+    0xAE, 0x3C, 0x11, 0xB4, 0xBE, 0xE9, 0xA5, 0xF3, 0x76, 0x68, 0xBD, 0xEF, 0x5A, 0x35, 0x19, 0x16,
+    0x6F, 0x09, 0x67, 0x55, 0x9B, 0x13, 0xC6, 0x3B, 0xB9, 0xC0, 0x1A, 0x2A, 0x7A, 0xD7, 0xEC, 0x55,
+    0x74, 0x13, 0x30, 0x1C, 0x49, 0x07, 0x49, 0x8C, 0xBE, 0x76, 0x55, 0xE8, 0x4A, 0xC1, 0xE2, 0xF3,
+    0xA5, 0xF8, 0xC3, 0xC5, 0x7B, 0x47, 0xAE, 0x79, 0x70, 0xDD, 0x73, 0xE5, 0xED, 0xB1, 0xE7, 0x2A,
+    0x19, 0x91, 0x1C, 0xAD, 0x06, 0x22, 0x23, 0x06, 0x99, 0xDA, 0xB0, 0xF3, 0xB8, 0xF4, 0x26, 0xD6,
+    0x56, 0xB0, 0xB6, 0x84, 0x3D, 0x7D, 0xCD, 0x4A, 0x57, 0x30, 0xAA, 0xD1, 0xC6, 0x88, 0x8E, 0xBB,
+    0xE8, 0x74, 0xD0, 0x49, 0x37, 0xEA, 0xC8, 0x55, 0x54, 0xBD, 0x68, 0x32, 0xFD, 0x45, 0xB1, 0x22,
+    0x2C, 0xE5, 0xB8, 0x86, 0xFE, 0x65, 0x74, 0xD7, 0x3C, 0x8A, 0x6E, 0x2C, 0x6A, 0xED, 0xEA, 0xC0,
+    0xF5, 0x27, 0x69, 0xD6, 0x77, 0xAB, 0xC8, 0xD9, 0xC8, 0xE5, 0xB3, 0xE1, 0x8F, 0xA3, 0xE6, 0xA8,
+    0x66, 0xAE, 0x55, 0xFB, 0x69, 0xBE, 0xA8, 0x87, 0x7F, 0x4D, 0x04, 0x04, 0xF5, 0x6B, 0x55, 0xA7,
+    0xD1, 0x0E, 0xF5, 0x87, 0x4D, 0x96, 0x0B, 0x23, 0x4D, 0x90, 0x63, 0x78, 0x06, 0x03, 0x86, 0x99,
+    0x0D, 0x43, 0x93, 0xBC, 0x72, 0xBF, 0x01, 0x5B, 0x8C, 0xF0, 0x31, 0xD6, 0x14, 0x96, 0x67, 0x3E,
+    0xF8, 0xCC, 0x35, 0xFF, 0x55, 0x61, 0x73, 0xE6, 0xEB, 0xCD, 0x05, 0xAE, 0x1E, 0x72, 0x0E, 0x98,
+    0x84, 0x98, 0x65, 0xA5, 0xC6, 0x68, 0x7D, 0x30, 0xA3, 0xD8, 0xAA, 0x31, 0x70, 0xD9, 0xA0, 0xC9,
+    0x42, 0x7A, 0x3A, 0x79, 0x74, 0xAA, 0xC9, 0x62, 0x57, 0x76, 0x82, 0xEA, 0x04, 0xFA, 0x53, 0x5D,
+    0x72, 0xF4, 0x5B, 0x3D, 0x30, 0x36, 0x06, 0xCE, 0x87, 0xE9, 0xC5, 0xD8, 0x6D, 0x8F, 0xBD, 0x0F,
+    0x8C, 0xA6, 0x3B, 0x98, 0x69, 0xEB, 0x81, 0x97, 0x1D, 0xFA, 0xC2, 0xCF, 0xA8, 0x7E, 0x2F, 0xFE,
+    0x70, 0xE3, 0xB9, 0x30, 0xC9, 0xDC, 0xB2, 0x84, 0xDD, 0xDC, 0x9E, 0x0B, 0x1F, 0x6F, 0x98, 0xB3,
+    0xF1, 0xAC, 0x0A, 0x4C, 0x3F, 0x1A, 0xAF, 0x88, 0xD1, 0xE2, 0x56, 0x49, 0xF7, 0x0B, 0x50, 0x34,
+    0x85, 0x3E, 0x14, 0xBB, 0x88, 0x26, 0xDD, 0xCB, 0x79, 0xBC, 0x4F, 0xA7, 0x7D, 0xC9, 0xFF, 0xD7,
+    0x13, 0x4C, 0xD9, 0xA0, 0x56, 0x7D, 0x0C, 0x3E, 0xE2, 0x55, 0x4F, 0x0C, 0x82, 0x92, 0x7F, 0x54,
+    0xCC, 0x20, 0x1B, 0x35, 0x13, 0x3A, 0xE2, 0xB5, 0x31, 0x94, 0x09, 0x0B, 0xF9, 0xEC, 0xCE, 0xC8,
+    0xF7, 0x5E, 0x32, 0x75, 0x45, 0x4A, 0x7C, 0xCC, 0xAE, 0x6F, 0x29, 0xAA, 0x4C, 0x9F, 0x65, 0x92,
+    0xCD, 0xB8, 0x83, 0x2B, 0xB2, 0x10, 0x65, 0x07, 0x7A, 0xF2, 0xB9, 0xE2, 0x37, 0x53, 0x37, 0x92,
+    0x45, 0x50, 0x75, 0xA0, 0x86, 0x85, 0x2F, 0xA8, 0xF0, 0xA0, 0xC0, 0x78, 0xFD, 0xFC, 0x60, 0xC8,
+    0x1E, 0xCE, 0xDE, 0x29, 0xDD, 0x44, 0xD3, 0x78, 0xA3, 0x41, 0xEC, 0xAC, 0x3E, 0xBC, 0x20, 0xC9,
+    0x9E, 0x65, 0x43, 0xC7, 0x82, 0x40, 0x88, 0x83, 0x64, 0x90, 0x1E, 0x7D, 0xF8, 0xBB, 0x40, 0xCC,
+    0xB1, 0xBB, 0x43, 0xD1, 0x3A, 0x32, 0xF2, 0x8D, 0x8E, 0x49, 0xF3, 0x91, 0x23, 0x08, 0xB6, 0x43,
+    0xCA, 0xCD, 0xB1, 0x43, 0x57, 0xC2, 0xC3, 0x09, 0xFD, 0xEF, 0xC0, 0xBE, 0x17, 0xBA, 0xA9, 0x10,
+    0x58, 0x16, 0xFD, 0x43, 0x6E, 0x44, 0x37, 0x98, 0x74, 0x92, 0x0C, 0x28, 0xBB, 0x60, 0xAC, 0x3F,
+    0xBF, 0xEB, 0x41, 0xB8, 0x9C, 0xD3, 0x10, 0x50, 0xAE, 0x7D, 0x0F, 0xC7, 0xCC, 0x79, 0x7A, 0xBF,
+    0x4E, 0xA2, 0xFD, 0xB6, 0x5F, 0x50, 0xDB, 0x01, 0xB3, 0xF0, 0xF0, 0x22, 0x53, 0x5A, 0xB0, 0x00,
+    0x3C, 0x18, 0xE2, 0xA4, 0xDE, 0xD9, 0xF1, 0x18, 0x98, 0xDD, 0x09, 0x1B, 0x4D, 0x1F, 0xB3, 0x03,
+    0xAE, 0x7E, 0xA9, 0x7C, 0xC7, 0x89, 0x18, 0x44, 0x88, 0x67, 0xB7, 0x95, 0xFF, 0xB9, 0x2A, 0xFB,
+    0x84, 0xC0, 0x40, 0x7A, 0x2E, 0x6D, 0x71, 0xE8, 0xA3, 0xE5, 0xE4, 0x39, 0xE6, 0x46, 0xE4, 0xE5,
+    0x32, 0xAF, 0x2C, 0x4D, 0xA9, 0x2A, 0x7E, 0x59, 0x39, 0x13, 0x83, 0x14, 0x6D, 0x40, 0xFC, 0xA9,
+    0x66, 0xB7, 0x46, 0xDC, 0x70, 0x23, 0xFE, 0xA4, 0x84, 0xDA, 0x20, 0xDF, 0x22, 0x6D, 0x9B, 0x3D,
+    0xA9, 0x33, 0x31, 0x59, 0x30, 0x38, 0xF4, 0x2D, 0x73, 0x93, 0x81, 0x1B, 0xBD, 0x34, 0xEB, 0xE9,
+    0x4C, 0x5F, 0x9E, 0x13, 0xD4, 0x2F, 0x66, 0x26, 0xA6, 0x73, 0x9C, 0xE6, 0x62, 0x7C, 0x46, 0x0F,
+    0x6D, 0x1D, 0xAB, 0xC7, 0xB6, 0x3F, 0x79, 0xE9, 0x83, 0x6A, 0x9C, 0xEE, 0x94, 0xF8, 0xFF, 0xCF,
+    0xBF, 0x75, 0x55, 0xBF, 0xAF, 0x15, 0x45, 0x14, 0xFE, 0x76, 0x27, 0xB2, 0x09, 0x9B, 0xBC, 0xA1,
+    0x90, 0x04, 0xC5, 0x30, 0x16, 0x16, 0x6A, 0x80, 0x6D, 0x2C, 0x5E, 0x71, 0xDF, 0x9D, 0x45, 0x0A,
+    0x0B, 0x0B, 0x29, 0xA0, 0xD1, 0x18, 0x2D, 0x2C, 0x34, 0x31, 0xC1, 0xC2, 0xE2, 0x61, 0x2E, 0xDC,
+    0x55, 0x4A, 0x0A, 0x88, 0x85, 0xFF, 0x01, 0x09, 0xB1, 0x91, 0xC2, 0x82, 0xE8, 0xBE, 0xB7, 0x03,
+    0xAF, 0xB0, 0xB0, 0x78, 0x8B, 0x3F, 0x42, 0x22, 0xCD, 0x46, 0x62, 0x4C, 0x34, 0xD1, 0x51, 0x36,
+    0x71, 0x81, 0xB9, 0xF7, 0xF8, 0xCD, 0x7D, 0x97, 0x87, 0xC6, 0xB8, 0x67, 0x4E, 0xEE, 0xDD, 0xDD,
+    0x99, 0x39, 0xE7, 0x7C, 0xDF, 0x77, 0x66, 0x01, 0xA8, 0x2E, 0x19, 0x70, 0x0E, 0xA6, 0xCA, 0xBA,
+    0xA4, 0xC7, 0x59, 0x98, 0x32, 0x6B, 0xD3, 0x1E, 0x35, 0x0A, 0xE4, 0x2E, 0xF5, 0x8B, 0x3F, 0xDA,
+    0x29, 0xAF, 0x06, 0x3B, 0xD3, 0xA2, 0x04, 0x97, 0xF9, 0xDC, 0xA2, 0x88, 0x73, 0x4C, 0xA5, 0xBA,
+    0x00, 0x7D, 0xA1, 0xC5, 0xD8, 0x02, 0xF7, 0x7B, 0x28, 0xA9, 0xA0, 0x03, 0x30, 0xED, 0x90, 0x88,
+    0x43, 0x46, 0x2F, 0xA6, 0x0E, 0xF5, 0x94, 0x1B, 0x34, 0x4E, 0x3B, 0xE1, 0x4A, 0x71, 0x81, 0xEF,
+    0xF6, 0x02, 0xE6, 0xDF, 0xA3, 0xF8, 0xCF, 0xB0, 0x3B, 0x63, 0xFF, 0xAB, 0x56, 0x64, 0x67, 0xEC,
+    0xBD, 0x84, 0xBD, 0x97, 0xAC, 0x83, 0xAD, 0xA4, 0x4C, 0xE7, 0xD9, 0x1C, 0x7A, 0x30, 0x01, 0x53,
+    0x3F, 0x1D, 0x94, 0x5C, 0x7F, 0xE0, 0xB5, 0x64, 0xDB, 0xED, 0x46, 0x28, 0x8A, 0xAD, 0xBB, 0xBE,
+    0x9E, 0x9A, 0x8B, 0x37, 0xFC, 0x7C, 0x66, 0xF3, 0x9B, 0xE2, 0x67, 0xF6, 0xB8, 0x9C, 0xEF, 0x67,
+    0x79, 0x30, 0xDF, 0xF6, 0xC6, 0x4F, 0x2F, 0x76, 0xF6, 0xD8, 0xDC, 0x56, 0x6F, 0xE7, 0xC3, 0x9C,
+    0x81, 0x3C, 0x80, 0xE7, 0xF2, 0x16, 0x6B, 0xDA, 0xE3, 0xAC, 0x26, 0x06, 0xAC, 0x60, 0xA2, 0x67,
+    0xA8, 0x75, 0x43, 0xFF, 0xAC, 0xAC, 0xCD, 0xC5, 0x2A, 0x98, 0x0B, 0x2E, 0x98, 0xF3, 0x5D, 0x28,
+    0x3E, 0xF2, 0xA1, 0xA8, 0x06, 0xFA, 0x46, 0xB0, 0x95, 0x1D, 0x16, 0xEE, 0x0C, 0x5D, 0x0F, 0x38,
+    0x38, 0x2F, 0x61, 0x25, 0x30, 0x3D, 0xEB, 0x6C, 0xA5, 0x06, 0x53, 0xC1, 0x72, 0xE3, 0xEC, 0x5B,
+    0x86, 0x18, 0x06, 0x96, 0xB2, 0x06, 0xE4, 0xDB, 0x25, 0xD2, 0xBB, 0x1D, 0x1F, 0x10, 0xA7, 0x71,
+    0xC1, 0x19, 0x2F, 0xCD, 0x3F, 0x69, 0x9C, 0x88, 0x78, 0x43, 0x4F, 0x44, 0x7A, 0xEC, 0x91, 0x4B,
+    0x88, 0x97, 0x91, 0x4B, 0x99, 0x48, 0xE2, 0x33, 0x3F, 0xC1, 0x88, 0x34, 0xBC, 0xEC, 0xD4, 0x0D,
+    0xDE, 0x34, 0x32, 0x14, 0x32, 0xE8, 0x5F, 0x4E, 0x28, 0xEE, 0x1B, 0x16, 0x20, 0x69, 0x87, 0x78,
+    0x33, 0xE3, 0x4D, 0x09, 0xDD, 0xC6, 0xB5, 0xF7, 0x48, 0x83, 0x74, 0x98, 0xA2, 0x21, 0xBD, 0x59,
+    0xC7, 0x49, 0xB5, 0xE1, 0xBB, 0x0B, 0x8E, 0xE1, 0x39, 0xB5, 0x66, 0x3E, 0x66, 0x0C, 0x64, 0xDB,
+    0xCB, 0x07, 0x61, 0x03, 0x6F, 0x8E, 0x4D, 0x6B, 0xE5, 0x38, 0x73, 0x71, 0x53, 0x7A, 0x2E, 0xD2,
+    0xA2, 0x60, 0x3D, 0x48, 0x49, 0x24, 0x8A, 0xF8, 0xE7, 0xD3, 0x52, 0xCF, 0x2B, 0x88, 0x94, 0x2B,
+    0x54, 0x46, 0xA7, 0xDA, 0x15, 0x1C, 0x4D, 0xBA, 0xA4, 0x3B, 0x84, 0x71, 0xD2, 0x99, 0xD6, 0xC8,
+    0x90, 0xCA, 0x9C, 0x6B, 0x86, 0xB4, 0xCF, 0xDB, 0xA2, 0x1C, 0xAB, 0x3E, 0xF5, 0xB6, 0xB4, 0xC7,
+    0x7B, 0x15, 0x91, 0xDA, 0x1A, 0x54, 0xC0, 0x41, 0x16, 0x67, 0x59, 0x64, 0x71, 0xFF, 0xCA, 0x22,
+    0x53, 0x45, 0x4F, 0x22, 0x07, 0x4C, 0x06, 0xF9, 0x9C, 0x95, 0x37, 0x54, 0xD1, 0x1E, 0x61, 0x2D,
+    0x49, 0xC3, 0x77, 0x19, 0xC3, 0x26, 0x52, 0x9E, 0x80, 0xB4, 0x4C, 0xCA, 0x53, 0x05, 0x7D, 0xF4,
+    0x54, 0x96, 0x20, 0xED, 0x3F, 0x75, 0xEA, 0x24, 0x1F, 0xCC, 0xA2, 0xEF, 0x53, 0xCB, 0x0D, 0x77,
+    0xBD, 0xDB, 0xF1, 0xEC, 0x7F, 0x3C, 0xF7, 0xBB, 0xFE, 0x3C, 0x92, 0x2B, 0x33, 0xE4, 0x77, 0x7B,
+    0x18, 0x42, 0x32, 0xB5, 0x48, 0x42, 0x40, 0x76, 0xC7, 0xC3, 0x5C, 0x74, 0x38, 0x47, 0xF8, 0x86,
+    0x1A, 0xEA, 0x47, 0xBF, 0x40, 0xF0, 0x6C, 0x51, 0xA6, 0x7D, 0x03, 0x73, 0x93, 0x50, 0x29, 0x91,
+    0x10, 0x91, 0xCA, 0x62, 0xC6, 0x51, 0x4A, 0xC0, 0x9E, 0x8F, 0x22, 0x9E, 0x44, 0xDB, 0x94, 0x81,
+    0xBC, 0xE4, 0x14, 0x2C, 0x39, 0xC8, 0x5B, 0x52, 0x44, 0x71, 0x94, 0xC6, 0x25, 0x83, 0xEA, 0xC9,
+    0x19, 0x37, 0x9D, 0x31, 0x72, 0xDE, 0x45, 0xDE, 0x0C, 0x29, 0x8C, 0x58, 0x17, 0x52, 0xB2, 0x5E,
+    0x6E, 0xA0, 0x85, 0xBB, 0x35, 0xDD, 0x02, 0x97, 0x18, 0x9C, 0x19, 0x7F, 0x13, 0x71, 0x2A, 0xB2,
+    0xC8, 0x6F, 0xD0, 0x55, 0x2C, 0x8D, 0x9D, 0xC8, 0x28, 0x35, 0x99, 0x0F, 0x49, 0x9F, 0x07, 0xF6,
+    0x69, 0x67, 0x7B, 0x53, 0xE9, 0x1B, 0xE2, 0x37, 0x60, 0xF5, 0x6D, 0x4A, 0x6F, 0xA3, 0x61, 0x41,
+    0xC9, 0x83, 0xC1, 0x6E, 0x32, 0x80, 0x6B, 0x18, 0x58, 0x62, 0x73, 0xDA, 0x9E, 0xCD, 0x8C, 0xC6,
+    0xE5, 0x03, 0x92, 0x79, 0x64, 0x62, 0x6F, 0x89, 0x27, 0x49, 0x84, 0x2E, 0xC7, 0xC8, 0x2B, 0xD5,
+    0x66, 0xEC, 0x5B, 0x42, 0xA8, 0xB7, 0x3C, 0x92, 0xFB, 0x8C, 0x6B, 0x29, 0x18, 0xD2, 0x07, 0xCC,
+    0x63, 0x5A, 0x4C, 0x61, 0x1A, 0xA5, 0x77, 0x9A, 0x1B, 0x6D, 0x11, 0x32, 0x37, 0x85, 0xEE, 0xB4,
+    0x67, 0x0B, 0xCD, 0x73, 0x72, 0xDB, 0x8E, 0x77, 0xE4, 0xD6, 0x6B, 0x9E, 0x21, 0x59, 0x9B, 0xB1,
+    0x74, 0xCD, 0xAA, 0xD9, 0x10, 0x81, 0x45, 0x6F, 0x6E, 0x72, 0x65, 0x2C, 0x95, 0x5B, 0xEA, 0x88,
+    0x7E, 0xB7, 0xE3, 0x7A, 0xE9, 0x66, 0xE9, 0x45, 0xC7, 0x8C, 0x45, 0x28, 0x08, 0x71, 0xB1, 0x39,
+    0x76, 0xC4, 0xA0, 0x1E, 0xFA, 0x6C, 0xE9, 0xF3, 0xA5, 0xCB, 0x3F, 0xBD, 0xA4, 0x7F, 0x7F, 0xAA,
+    0xE4, 0xF2, 0x40, 0x65, 0x88, 0xA6, 0xB7, 0x3A, 0xD0, 0x10, 0xCD, 0xEC, 0x5A, 0x81, 0xA3, 0x4B,
+    0x1B, 0x63, 0x6D, 0xD7, 0x46, 0x4B, 0x9B, 0x60, 0xDA, 0x4F, 0xFD, 0xFE, 0x13, 0xFB, 0xF0, 0x34,
+    0xDE, 0xC3, 0x0B, 0x7C, 0x72, 0x18, 0x2B, 0x5C, 0x9F, 0x23, 0xAB, 0x94, 0x4B, 0xDB, 0xA4, 0x83,
+    0x47, 0xCF, 0x69, 0x23, 0xAC, 0x72, 0x4A, 0x3C, 0x8A, 0x7C, 0xB2, 0x30, 0x3C, 0xB4, 0x7E, 0xD7,
+    0x06, 0x5C, 0x5B, 0x5A, 0xCD, 0x15, 0x0F, 0x6D, 0x54, 0x04, 0x13, 0x1E, 0x3B, 0x49, 0x50, 0x57,
+    0xA9, 0x8D, 0xD1, 0xFB, 0xAB, 0xAA, 0x64, 0xC2, 0x3F, 0xC7, 0xBA, 0x79, 0xAD, 0x73, 0xC6, 0xD9,
+    0x85, 0xAE, 0xD0, 0x9C, 0xA4, 0x3E, 0xF2, 0x2A, 0xAC, 0x60, 0xF2, 0x14, 0x46, 0x87, 0x31, 0x1A,
+    0x61, 0x6D, 0x44, 0x29, 0xBE, 0x38, 0xD7, 0x32, 0xCF, 0xE5, 0xB7, 0x64, 0xF3, 0x95, 0x2B, 0x44,
+    0xFD, 0x1F, 0x63, 0xC2, 0xF1, 0x04, 0xCE, 0xB1, 0x71, 0x7E, 0xEA, 0x2D, 0x46, 0x63, 0x1C, 0x19,
+    0xE3, 0xD0, 0x1A, 0x0E, 0xB1, 0x52, 0x7B, 0x8C, 0xB0, 0x0C, 0x46, 0x7C, 0xC6, 0x66, 0x5B, 0x5C,
+    0xA7, 0x3B, 0x23, 0x6C, 0x95, 0x1A, 0x39, 0x69, 0xA3, 0x0A, 0x98, 0x26, 0xCF, 0x2E, 0xFB, 0x43,
+    0x12, 0x7B, 0x7A, 0x31, 0x87, 0x2F, 0x52, 0xF2, 0xFE, 0x39, 0x08, 0x02, 0x11, 0x80, 0xA2, 0x76,
+    0x7C, 0x2E, 0x75, 0xFE, 0xA1, 0x28, 0xA7, 0xAF, 0x93, 0xE3, 0xAB, 0xA8, 0x8F, 0xF0, 0xC8, 0xAB,
+    0xF4, 0xF5, 0xD9, 0x69, 0x76, 0x6A, 0xE0, 0xE9, 0x85, 0xE2, 0x8E, 0x8B, 0x8B, 0x1F, 0xE7, 0x21,
+    0x52, 0xEA, 0x63, 0xED, 0x61, 0xBC, 0xB7, 0xFE, 0xD8, 0xB5, 0x46, 0xC2, 0x17, 0x97, 0x4B, 0x12,
+    0x7A, 0x0D, 0xEC, 0x0C, 0x6A, 0xBE, 0xD7, 0xD2, 0xC7, 0x76, 0x7F, 0xCB, 0x74, 0x5E, 0x55, 0x2B,
+    0x58, 0xD5, 0xF2, 0xBB, 0x68, 0xC2, 0xEA, 0x33, 0x67, 0x30, 0x49, 0x16, 0x3F, 0xE9, 0xF0, 0xFE,
+    0x54, 0xEE, 0xDC, 0x94, 0xD7, 0x31, 0xBB, 0x9A, 0xFE, 0xE5, 0xB2, 0xDB, 0x30, 0xEF, 0x62, 0xE3,
+    0xCC, 0x6B, 0x5E, 0xE4, 0x3A, 0x23, 0x6D, 0x8E, 0x90, 0xFA, 0xB2, 0x38, 0x2F, 0xC1, 0x48, 0x7B,
+    0xF0, 0x1E, 0x8E, 0x00, 0x57, 0x91, 0x3A, 0xD2, 0xC5, 0x7D, 0xC8, 0x84, 0xDA, 0x66, 0x94, 0xC1,
+    0x7E, 0xEC, 0x87, 0xF4, 0x96, 0xCB, 0xDE, 0xC0, 0xA1, 0x09, 0x3E, 0xF0, 0xC9, 0xAF, 0x2E, 0xFB,
+    0x0C, 0x45, 0x8D, 0xC6, 0x2B, 0x3F, 0xA9, 0x67, 0x24, 0x62, 0xDF, 0x6A, 0xBC, 0xD6, 0xD7, 0x27,
+    0x93, 0xBA, 0xA6, 0x16, 0xC6, 0xCC, 0x70, 0xFF, 0x02, 0xA2, 0x67, 0x77, 0x75, 0xF1, 0xC8, 0x56,
+    0x17, 0x76, 0x2D, 0xE9, 0xAD, 0x6F, 0x88, 0xD2, 0x81, 0x45, 0xA0, 0x47, 0x31, 0xB3, 0x1B, 0xAD,
+    0x29, 0x70, 0x86, 0xE7, 0x7A, 0x99, 0x0D, 0xF1, 0x5B, 0xD3, 0xF8, 0xF4, 0x8E, 0xCF, 0xBF, 0xF2,
+    0x45, 0xDE, 0x07, 0xDD, 0xAF, 0x60, 0x94, 0x74, 0x59, 0x75, 0x14, 0x9F, 0xA7, 0xAD, 0x2E, 0xD7,
+    0xD0, 0x2B, 0xFE, 0xB0, 0x68, 0xF5, 0x9D, 0x0E, 0xD6, 0x1F, 0x28, 0xAA, 0x4D, 0x7C, 0x29, 0xDB,
+    0x92, 0x06, 0x3D, 0x1C, 0xD1, 0xCE, 0x54, 0xAB, 0x51, 0xA4, 0xBE, 0xE7, 0x84, 0xAD, 0x96, 0x98,
+    0x47, 0x01, 0x8F, 0x26, 0x8C, 0xFE, 0x27, 0xFB, 0x3E, 0xFB, 0xDA, 0xE9, 0xD2, 0x58, 0x4E, 0xA8,
+    0x9F, 0x79, 0x87, 0x47, 0xB4, 0xEA, 0x8F, 0x72, 0xAF, 0x09, 0xFE, 0xF0, 0xEA, 0x96, 0xD3, 0xA7,
+    0xB1, 0x56, 0xE3, 0xBE, 0x57, 0xBF, 0x3A, 0x7E, 0xD6, 0xC6, 0x3B, 0x94, 0xE3, 0x6F, 0xB5, 0x55,
+    0x41, 0x8F, 0x14, 0x45, 0x18, 0x7D, 0xD5, 0xB5, 0xBB, 0x0D, 0xB4, 0x58, 0x1C, 0x16, 0x45, 0x58,
+    0xB7, 0x51, 0x49, 0x44, 0x32, 0xEC, 0x78, 0xE0, 0xB0, 0x87, 0x99, 0xED, 0x66, 0x39, 0x40, 0x42,
+    0x8C, 0x6B, 0x82, 0x5E, 0x8D, 0x89, 0xDE, 0xD7, 0xC8, 0x61, 0x63, 0x66, 0x77, 0x4A, 0x30, 0x5E,
+    0x48, 0xCC, 0xFC, 0x84, 0x35, 0xE1, 0xA0, 0x78, 0xD8, 0x8E, 0xD9, 0xC3, 0x26, 0xEC, 0x32, 0xB5,
+    0x6C, 0x0C, 0x31, 0x1C, 0x6C, 0x30, 0xC6, 0x83, 0x1E, 0x3A, 0xC1, 0x98, 0xA8, 0x07, 0x1A, 0x6C,
+    0xB1, 0x81, 0x9E, 0x29, 0x5F, 0xF5, 0x82, 0x72, 0xF1, 0x68, 0x4D, 0x4D, 0x4D, 0x55, 0x57, 0xD7,
+    0x57, 0xDF, 0xF7, 0xBE, 0xF7, 0xBD, 0xF1, 0x86, 0x50, 0x36, 0x6D, 0x8B, 0x7C, 0x01, 0x0B, 0xAB,
+    0x68, 0xB1, 0x17, 0x68, 0xAD, 0xA1, 0xB3, 0x28, 0xCA, 0xC8, 0xE6, 0xDC, 0xF2, 0x86, 0x18, 0x39,
+    0xD0, 0xF3, 0x57, 0x86, 0xC2, 0x7A, 0x26, 0xC2, 0xB4, 0xD2, 0x4A, 0xA6, 0x9E, 0x29, 0x91, 0x44,
+    0x68, 0xA9, 0x2C, 0xF4, 0xAD, 0x9D, 0xB5, 0xD6, 0x94, 0x56, 0xB7, 0x01, 0x15, 0xC3, 0x37, 0xF0,
+    0x72, 0xA0, 0xC2, 0x3F, 0xED, 0xC0, 0x4D, 0xAD, 0x6E, 0x77, 0x64, 0x1A, 0x99, 0x05, 0x54, 0x41,
+    0xAC, 0x4C, 0x82, 0x4A, 0x41, 0xE9, 0x44, 0x94, 0xBE, 0xE9, 0xEA, 0xC8, 0x16, 0xB0, 0x0F, 0x63,
+    0x6F, 0x70, 0x16, 0xF0, 0x63, 0xE0, 0x72, 0x8A, 0x80, 0xA7, 0xEF, 0xBB, 0xA3, 0xE3, 0x23, 0xED,
+    0x41, 0x34, 0x88, 0xE2, 0x19, 0xCC, 0xA0, 0xCD, 0xCF, 0x0C, 0x96, 0x70, 0x05, 0x7D, 0x78, 0xF6,
+    0xA3, 0x07, 0x17, 0x5B, 0x90, 0x06, 0xCD, 0x18, 0xB6, 0x27, 0xFA, 0x06, 0x4B, 0x23, 0xF2, 0xAE,
+    0x1D, 0xF6, 0xED, 0x4D, 0xFB, 0x33, 0x0F, 0x9E, 0x45, 0x0B, 0x0A, 0xCF, 0x7E, 0xDF, 0xB4, 0x99,
+    0x9B, 0xF8, 0x46, 0xE4, 0xE8, 0x20, 0x44, 0x60, 0x3C, 0xAB, 0xFB, 0x45, 0x38, 0xCC, 0x71, 0x37,
+    0x95, 0xD7, 0x63, 0x75, 0xD4, 0x45, 0x7B, 0x27, 0x93, 0xD7, 0xB4, 0x7A, 0x1B, 0x1B, 0xD1, 0x4A,
+    0x61, 0x69, 0xC1, 0xCE, 0x0E, 0xDB, 0x73, 0x10, 0x93, 0x90, 0x5B, 0x46, 0x64, 0x6B, 0x28, 0x14,
+    0x3A, 0x5E, 0x46, 0x07, 0x14, 0x82, 0xEB, 0xB1, 0x78, 0x68, 0x10, 0x65, 0x08, 0x4A, 0x78, 0x03,
+    0x9C, 0xA1, 0x93, 0xEB, 0x40, 0xAB, 0x03, 0x74, 0x08, 0xC0, 0xDA, 0x8C, 0x6F, 0x8A, 0xA6, 0xCA,
+    0xF2, 0x30, 0xFA, 0x93, 0xE8, 0xD9, 0x8C, 0xDF, 0x34, 0xA8, 0xFA, 0x46, 0x96, 0x91, 0x91, 0x79,
+    0xA8, 0x55, 0x3C, 0x23, 0xF2, 0x26, 0xA2, 0x10, 0xF2, 0x76, 0x8C, 0xAE, 0x86, 0x32, 0xF0, 0x4B,
+    0xF8, 0x36, 0x96, 0x7F, 0xE4, 0x32, 0x5F, 0xF2, 0x8A, 0xE0, 0x46, 0x89, 0x8A, 0x79, 0x68, 0xA1,
+    0x35, 0x85, 0x05, 0x85, 0x22, 0xD0, 0x85, 0x7F, 0x23, 0x97, 0x77, 0x73, 0xF1, 0x57, 0x06, 0x9B,
+    0xA2, 0xCB, 0xEB, 0x19, 0xB8, 0x76, 0xB1, 0x47, 0x10, 0x43, 0x44, 0x95, 0xF3, 0xE7, 0x08, 0xE1,
+    0xB7, 0x2E, 0x69, 0x7C, 0xEE, 0x15, 0x6E, 0x28, 0xF9, 0x92, 0x1B, 0x8C, 0x18, 0x5E, 0x3A, 0x6D,
+    0x6D, 0xD3, 0x0E, 0x30, 0x1A, 0x07, 0x95, 0x28, 0x30, 0x05, 0x2F, 0x23, 0x98, 0x32, 0x25, 0xA6,
+    0x07, 0x8C, 0x9F, 0xA1, 0x1B, 0x63, 0xDD, 0xC1, 0x59, 0x63, 0xDA, 0x71, 0x1B, 0x51, 0x0E, 0x4B,
+    0x20, 0x0F, 0xDD, 0xFA, 0x74, 0xFA, 0xBB, 0xD7, 0x8E, 0xB1, 0x6F, 0x4D, 0xBC, 0x6F, 0xF6, 0x42,
+    0x0E, 0x5C, 0x7A, 0x15, 0x50, 0xB8, 0x64, 0x17, 0x08, 0x34, 0x16, 0x63, 0x51, 0xF1, 0x12, 0xDF,
+    0x1D, 0x7C, 0x3C, 0xAC, 0x0B, 0xAB, 0xC3, 0x8C, 0xE7, 0xDB, 0xA3, 0x1F, 0xEC, 0xFC, 0xEC, 0xA7,
+    0x65, 0x42, 0x04, 0x59, 0x45, 0x57, 0xCB, 0x50, 0x43, 0xE8, 0x2A, 0x30, 0xEB, 0x81, 0xE9, 0xF8,
+    0xAE, 0xB7, 0xE4, 0xA3, 0x3E, 0x82, 0x79, 0xF8, 0xA8, 0x87, 0xB1, 0xA1, 0x67, 0xF3, 0x99, 0x24,
+    0xB8, 0x8E, 0xD5, 0x44, 0x9D, 0x46, 0x91, 0x04, 0x17, 0xB0, 0x91, 0x48, 0xBB, 0x1C, 0x5A, 0xDD,
+    0x2C, 0x91, 0xE1, 0x69, 0x3C, 0xD1, 0x9A, 0x19, 0x9A, 0x04, 0x39, 0x0D, 0xB0, 0x0A, 0x04, 0x75,
+    0xF2, 0x5D, 0x14, 0x68, 0x00, 0x82, 0x2E, 0x28, 0x87, 0x4B, 0x05, 0x72, 0x94, 0xAE, 0x91, 0x00,
+    0x20, 0x38, 0x8C, 0x02, 0x91, 0x1D, 0x9E, 0xB0, 0xD6, 0xF1, 0x74, 0x72, 0x3C, 0x09, 0x6D, 0x11,
+    0x9C, 0xCB, 0x14, 0x72, 0xD7, 0xCF, 0x31, 0x73, 0x79, 0x64, 0xAB, 0xC6, 0xF8, 0xB4, 0xE3, 0x20,
+    0xC4, 0x6C, 0x86, 0x35, 0xA5, 0x9B, 0x58, 0x22, 0x7D, 0xEE, 0x31, 0xF0, 0x21, 0x5C, 0x06, 0x68,
+    0x47, 0xF4, 0x69, 0xF8, 0x01, 0x33, 0x81, 0x9A, 0xF4, 0xFC, 0xE9, 0x5B, 0x33, 0xDA, 0xFD, 0xFC,
+    0xF1, 0xEA, 0x11, 0x80, 0x37, 0x63, 0x78, 0xDB, 0x00, 0xBA, 0x27, 0x36, 0x95, 0xBD, 0xB3, 0x12,
+    0x2E, 0x58, 0x99, 0x91, 0xCA, 0x5A, 0xD9, 0x22, 0x8C, 0x5B, 0x0D, 0x34, 0xA6, 0x58, 0x51, 0xB6,
+    0xF2, 0x58, 0x10, 0x41, 0x0E, 0xAF, 0x1C, 0xF1, 0xCA, 0xA6, 0x2D, 0xBA, 0x36, 0x3B, 0xF2, 0x2B,
+    0x3A, 0xC1, 0x05, 0x53, 0x0D, 0xD4, 0xD7, 0xF1, 0x99, 0xB1, 0x8B, 0xA3, 0xEF, 0x9D, 0x3B, 0xB8,
+    0xF7, 0x8C, 0x78, 0x46, 0x9C, 0x5A, 0xD3, 0xBA, 0xB7, 0x4B, 0x03, 0x33, 0x27, 0x9E, 0xDE, 0xB7,
+    0x6F, 0xEE, 0x9D, 0xF3, 0x5B, 0xD6, 0xFB, 0x18, 0x07, 0x47, 0x3C, 0x93, 0xB5, 0x43, 0x7F, 0x33,
+    0x6F, 0x4D, 0xA2, 0x5C, 0x44, 0xB5, 0x81, 0x72, 0x03, 0xD9, 0x3C, 0x10, 0x77, 0xBF, 0x38, 0xEE,
+    0x70, 0x08, 0x49, 0x58, 0x20, 0xAF, 0x51, 0x62, 0xFD, 0x76, 0x6D, 0x4E, 0xA3, 0x6F, 0x9C, 0x7B,
+    0x71, 0xEF, 0xEB, 0x9B, 0x2F, 0xBD, 0x70, 0xEA, 0x1B, 0x7D, 0x23, 0x1D, 0xD3, 0x0E, 0xB5, 0xDA,
+    0x5D, 0x92, 0xB4, 0xB9, 0xE2, 0x9B, 0x85, 0x55, 0xF9, 0x2D, 0x6B, 0xC5, 0xBF, 0xF6, 0x0B, 0x9D,
+    0x72, 0xC4, 0x3D, 0x04, 0x26, 0x42, 0x6A, 0x4C, 0x82, 0xE7, 0xB7, 0xA7, 0xDB, 0x69, 0x19, 0x95,
+    0x76, 0x38, 0x0A, 0xEC, 0x17, 0x13, 0x30, 0x13, 0xFE, 0x6C, 0x1A, 0xDD, 0x38, 0xB3, 0x3F, 0x1E,
+    0xC5, 0xDC, 0x1A, 0x7A, 0x63, 0x47, 0x6E, 0x95, 0xD8, 0x3D, 0xD1, 0x3A, 0x4B, 0x72, 0x2F, 0x3E,
+    0xEE, 0x4B, 0x8F, 0x7A, 0xBB, 0x8B, 0x8D, 0xFE, 0xEF, 0x83, 0xBE, 0x1D, 0x5C, 0xB6, 0x83, 0xAF,
+    0x86, 0xED, 0x04, 0x58, 0x26, 0xAE, 0xBD, 0xE5, 0xEE, 0xF9, 0xAD, 0x61, 0x10, 0x16, 0x8D, 0x6E,
+    0x9A, 0xD8, 0xD9, 0xCD, 0x41, 0x20, 0xF2, 0x46, 0x60, 0x92, 0xA6, 0x67, 0xAA, 0x40, 0xE6, 0x8D,
+    0xD0, 0x24, 0x7D, 0xEF, 0x6A, 0x19, 0xA8, 0x6C, 0x22, 0xD2, 0xF3, 0xE3, 0x9D, 0xF5, 0xC1, 0x9E,
+    0x1D, 0x52, 0xEF, 0x90, 0x61, 0x0C, 0x91, 0x3E, 0x87, 0xDE, 0x4E, 0xF4, 0x76, 0xCB, 0x6A, 0x6F,
+    0x1C, 0xEA, 0xAB, 0x9F, 0xC8, 0xC3, 0x4F, 0xCD, 0xCF, 0xDB, 0xF8, 0x5D, 0xC4, 0x7B, 0x44, 0x9A,
+    0x78, 0x59, 0xE1, 0x65, 0xAB, 0x22, 0x2B, 0xD4, 0xB5, 0xB4, 0xDA, 0xE0, 0x30, 0xBD, 0x9B, 0x1B,
+    0x75, 0x0C, 0x94, 0x0B, 0xE0, 0x65, 0x37, 0x7B, 0x95, 0x79, 0x62, 0xA6, 0x52, 0x12, 0xB3, 0xC1,
+    0x89, 0x8C, 0x39, 0xC9, 0x38, 0x99, 0x20, 0x72, 0x27, 0x34, 0xBA, 0x45, 0x22, 0x80, 0xE7, 0x5D,
+    0xFC, 0x66, 0x0A, 0x58, 0xF5, 0x13, 0xA2, 0xF0, 0x03, 0x3C, 0xD3, 0x9A, 0xC7, 0x82, 0xBF, 0xD2,
+    0x53, 0x78, 0x73, 0xC3, 0xA3, 0xA2, 0xE1, 0x30, 0x37, 0x1D, 0x39, 0xBD, 0xC4, 0x95, 0x82, 0xE3,
+    0xF9, 0x3C, 0x76, 0xD3, 0x8E, 0x67, 0x38, 0x39, 0xC6, 0x09, 0x37, 0xE7, 0x05, 0xAB, 0xBB, 0x98,
+    0xEE, 0x9F, 0xB4, 0x27, 0x5F, 0x39, 0xEA, 0xE0, 0xCD, 0x78, 0xE7, 0x2E, 0x87, 0x6C, 0xC6, 0x6C,
+    0x35, 0x78, 0x4D, 0xA0, 0x25, 0x65, 0x84, 0x44, 0xAF, 0xC8, 0xEB, 0xD0, 0x52, 0x89, 0x6D, 0x3E,
+    0x4E, 0x83, 0x75, 0xAD, 0xC5, 0xCB, 0xCE, 0x61, 0x23, 0xA8, 0x28, 0x34, 0x1D, 0x14, 0x48, 0x88,
+    0x00, 0x1D, 0x16, 0x86, 0x3C, 0x96, 0xC7, 0x0D, 0xF6, 0x34, 0x98, 0x21, 0x9B, 0x25, 0xC2, 0x1B,
+    0xFA, 0x31, 0x9F, 0xB5, 0xA8, 0x02, 0x5E, 0x3A, 0x69, 0x6A, 0x97, 0x91, 0x28, 0xC6, 0xA4, 0x3F,
+    0xBC, 0x8F, 0x96, 0x78, 0xAB, 0xA8, 0x7D, 0xDE, 0x05, 0xD0, 0x8D, 0xA8, 0xEE, 0x33, 0xAE, 0x12,
+    0x5C, 0x1B, 0x7B, 0xFC, 0x64, 0xBB, 0x5B, 0xC8, 0xC2, 0x89, 0x18, 0x39, 0xD5, 0xAE, 0x69, 0xD5,
+    0xA9, 0x47, 0xBE, 0xDE, 0xD4, 0x9D, 0xC0, 0x96, 0xA2, 0xAF, 0xDD, 0xA9, 0xC3, 0x2E, 0xEA, 0x14,
+    0xF5, 0x06, 0x30, 0xF7, 0x44, 0xF9, 0xF2, 0x20, 0x54, 0xE6, 0xE4, 0x81, 0xE0, 0x50, 0x13, 0x71,
+    0x8F, 0x8B, 0x0E, 0xAD, 0x4C, 0x51, 0x60, 0xD4, 0x6C, 0x4E, 0x39, 0xA1, 0x20, 0x65, 0x4A, 0xA3,
+    0x60, 0x55, 0xAD, 0x63, 0x11, 0xD1, 0xA5, 0x15, 0x1D, 0x5A, 0x9B, 0x07, 0xD6, 0x0E, 0x08, 0x86,
+    0xDA, 0x2C, 0x21, 0x73, 0x9E, 0xBE, 0x52, 0xD7, 0x3C, 0x43, 0xDF, 0x96, 0x01, 0x69, 0xF0, 0x1F,
+    0x8D, 0xC6, 0x11, 0x39, 0x86, 0x33, 0xCB, 0xC1, 0x06, 0xDF, 0xFC, 0x91, 0xAA, 0x74, 0x87, 0x8B,
+    0x35, 0x86, 0xD0, 0xA6, 0x44, 0x84, 0xCC, 0xBF, 0xD2, 0x4E, 0x20, 0x59, 0xF1, 0x39, 0x05, 0x73,
+    0x78, 0xE9, 0x0A, 0x69, 0x6E, 0x4D, 0xD3, 0xDA, 0x82, 0xC1, 0x46, 0x94, 0x4C, 0xB5, 0xE5, 0x6A,
+    0x94, 0xA8, 0xD3, 0xD8, 0x42, 0x5D, 0x26, 0x54, 0x1E, 0x4E, 0x0E, 0x7A, 0xF1, 0xBF, 0x37, 0x51,
+    0x0A, 0x21, 0x4B, 0x57, 0xF4, 0xA8, 0xFF, 0xD9, 0xD0, 0x5E, 0x63, 0xC4, 0x0C, 0x39, 0x38, 0x9F,
+    0xD2, 0xFA, 0x3A, 0x89, 0xC6, 0x45, 0x49, 0x1D, 0x68, 0x33, 0xB4, 0x26, 0xC2, 0x58, 0xFD, 0xF6,
+    0x65, 0xC6, 0x9A, 0xA4, 0x0A, 0x58, 0x1B, 0x57, 0x0C, 0x6C, 0x89, 0x7F, 0xA6, 0x91, 0x43, 0x13,
+    0xFF, 0x47, 0xFB, 0x1B, 0xB5, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x87, 0x64, 0x25,
+    0xB6, 0x18, 0x8A, 0xB8, 0x40, 0x48, 0x6C, 0x43, 0x91, 0x26, 0x5E, 0x8A, 0x14, 0x2E, 0x38, 0xCF,
+    0xE0, 0xFC, 0x00, 0x52, 0x38, 0x48, 0x50, 0xA5, 0x8C, 0x44, 0x61, 0x17, 0x29, 0xCF, 0xBE, 0xB5,
+    0xAF, 0xA0, 0x48, 0x61, 0x37, 0xD4, 0xA4, 0x70, 0xA4, 0x70, 0x14, 0xE7, 0x22, 0x45, 0xA4, 0x9C,
+    0xE3, 0x4D, 0xFC, 0x03, 0xD8, 0x28, 0xA2, 0x5F, 0x01, 0x0D, 0x34, 0x59, 0xC1, 0x0A, 0xAD, 0xA5,
+    0xDD, 0x1D, 0xBE, 0xB7, 0x7B, 0x3E, 0x1C, 0x5C, 0x01, 0xF2, 0x48, 0x33, 0xB7, 0xBB, 0xF7, 0xDE,
+    0xF7, 0xDE, 0xBC, 0xEF, 0x9B, 0x37, 0xD0, 0x9F, 0x5A, 0x04, 0x9B, 0xFB, 0xF0, 0xBF, 0xDE, 0x04,
+    0xB2, 0xA7, 0xF8, 0x7B, 0x44, 0x9C, 0x3A, 0x07, 0x54, 0x0D, 0xF8, 0x6F, 0x2C, 0xF0, 0x27, 0x5F,
+    0x86, 0x43, 0x60, 0x59, 0x5B, 0xE8, 0xB5, 0x02, 0x41, 0x3A, 0x84, 0xCA, 0x75, 0x82, 0xD2, 0x2F,
+    0x30, 0xC3, 0x16, 0xCC, 0x64, 0x9A, 0x44, 0xCE, 0x15, 0xA1, 0x73, 0x8D, 0x2A, 0xA0, 0x5F, 0x54,
+    0x50, 0x05, 0xBD, 0x9F, 0x63, 0x10, 0xA4, 0xBD, 0x4B, 0xDE, 0xC0, 0x5B, 0x5F, 0xBA, 0xA4, 0x28,
+    0x5E, 0x41, 0xB0, 0x13, 0xCE, 0x8F, 0x53, 0x20, 0xCC, 0xF0, 0xF6, 0x60, 0x0A, 0x50, 0x15, 0x1F,
+    0x1C, 0xE7, 0x33, 0xFE, 0x3B, 0xE0, 0x6E, 0x23, 0xC6, 0x0F, 0xC7, 0x19, 0x54, 0x36, 0xA3, 0x3B,
+    0x5F, 0x2A, 0x95, 0x63, 0xC0, 0x38, 0x31, 0x22, 0xAB, 0x7F, 0xFB, 0x3E, 0x0F, 0x9C, 0xAB, 0x7D,
+    0xE7, 0x9C, 0xAD, 0x19, 0x65, 0x1B, 0xA8, 0x0D, 0x10, 0x27, 0x82, 0xB7, 0xB4, 0xCE, 0xCC, 0x9D,
+    0x23, 0x62, 0xEC, 0x5C, 0x09, 0x18, 0xC1, 0xC6, 0xB3, 0x6E, 0xFD, 0x5D, 0x56, 0xF5, 0x4A, 0xD6,
+    0xE0, 0x45, 0xF3, 0x25, 0x0D, 0x2D, 0x21, 0xB8, 0x59, 0x59, 0x07, 0x60, 0xB6, 0x0C, 0x21, 0x6B,
+    0x3B, 0x69, 0xB8, 0x6F, 0xE7, 0x5A, 0x9A, 0x33, 0xCA, 0xE4, 0x20, 0x4C, 0x69, 0x53, 0x71, 0xBB,
+    0x8C, 0x6B, 0xAC, 0xAC, 0xE7, 0xB6, 0xF0, 0x41, 0xCB, 0x58, 0x85, 0x3E, 0xFD, 0x42, 0xF6, 0xC1,
+    0x64, 0x74, 0x0A, 0x8F, 0x91, 0x63, 0x3A, 0x73, 0xEB, 0x66, 0xFE, 0x93, 0x40, 0xB5, 0x92, 0xD4,
+    0xA4, 0x20, 0x22, 0xAB, 0x54, 0x30, 0x3F, 0x6C, 0xB8, 0x7D, 0x5C, 0x21, 0xC4, 0x01, 0xE7, 0x5D,
+    0xE0, 0x2A, 0x9D, 0x13, 0x9F, 0x45, 0x58, 0xED, 0x9D, 0xFA, 0xE1, 0xDD, 0x59, 0x73, 0x2E, 0x3F,
+    0x76, 0x25, 0x11, 0xC3, 0x04, 0x3E, 0xA9, 0x60, 0x8D, 0xE2, 0xCF, 0xF7, 0x43, 0x57, 0x2A, 0xD7,
+    0x48, 0xC6, 0xAB, 0xE2, 0x48, 0x42, 0x24, 0xF5, 0x03, 0xE3, 0x1C, 0x2B, 0x70, 0xC2, 0x10, 0xF0,
+    0x59, 0x5D, 0x7E, 0x3C, 0x04, 0x3E, 0xC1, 0x85, 0xF1, 0x3F, 0x70, 0xDF, 0xE9, 0x88, 0x0B, 0x9E,
+    0x22, 0xB8, 0x95, 0xF8, 0xB8, 0xD6, 0xC1, 0xDD, 0xB9, 0x7D, 0xEC, 0xAA, 0xD8, 0x35, 0xAC, 0xD5,
+    0x1C, 0x6A, 0x99, 0xB8, 0x3F, 0x1E, 0xF8, 0x84, 0x62, 0x81, 0xCD, 0x02, 0x8A, 0x55, 0x32, 0x93,
+    0xEF, 0xE6, 0x50, 0x2C, 0xA5, 0x67, 0xAF, 0xA1, 0x8C, 0xB0, 0x1D, 0xA6, 0xF1, 0xB8, 0x3C, 0x4B,
+    0xEE, 0x3F, 0xA3, 0xBD, 0x87, 0x27, 0xB4, 0xBE, 0xD7, 0xA3, 0x3C, 0x56, 0x85, 0x4E, 0x0D, 0x66,
+    0x7E, 0x41, 0xF0, 0xC5, 0x8F, 0x2A, 0x75, 0x66, 0x6C, 0x2B, 0x74, 0x65, 0x87, 0x2B, 0x37, 0xCE,
+    0x42, 0x3E, 0x36, 0xFA, 0xA4, 0x98, 0xC5, 0xE1, 0xCB, 0xF9, 0x62, 0x3E, 0x7B, 0x5D, 0xB6, 0x46,
+    0x54, 0x75, 0x88, 0x11, 0xEE, 0xE7, 0x9B, 0xEF, 0xCE, 0x0D, 0xFD, 0x87, 0xAC, 0x8D, 0x21, 0xCF,
+    0x9D, 0xF6, 0x63, 0x84, 0x6F, 0x3D, 0x34, 0x30, 0x56, 0x67, 0x04, 0x6F, 0x11, 0xA9, 0x7C, 0xA6,
+    0xC7, 0x85, 0xB9, 0x62, 0xD7, 0x17, 0x55, 0x67, 0xB1, 0x45, 0xB4, 0xA2, 0x92, 0x58, 0xF4, 0x46,
+    0x8F, 0xF0, 0x9F, 0x8F, 0x0D, 0x54, 0x09, 0x9D, 0x89, 0x68, 0x5A, 0x2A, 0xF0, 0x40, 0x24, 0x4D,
+    0xF1, 0x18, 0xD1, 0x69, 0xE9, 0x39, 0xAB, 0x32, 0x26, 0xC4, 0x93, 0xC8, 0x23, 0x2C, 0x68, 0x25,
+    0x3D, 0x9D, 0x4B, 0x83, 0xD7, 0x54, 0x54, 0x94, 0x0C, 0x44, 0x84, 0xFC, 0x54, 0xD1, 0x2A, 0xCE,
+    0xF4, 0x37, 0x53, 0x27, 0x8E, 0x15, 0xAB, 0xE6, 0x52, 0x25, 0x0F, 0xDA, 0x9D, 0x76, 0xF4, 0x13,
+    0x75, 0xD7, 0xE2, 0xFA, 0xCF, 0x16, 0x37, 0xCD, 0x59, 0x76, 0xD7, 0x19, 0x75, 0xA0, 0x0B, 0x6C,
+    0xE9, 0x92, 0xB3, 0xC6, 0x50, 0x37, 0x98, 0xE9, 0x63, 0xCE, 0xA9, 0x9D, 0x45, 0x7B, 0x69, 0x1D,
+    0x3D, 0xE0, 0x1C, 0xE7, 0x75, 0xBC, 0x5B, 0xD4, 0x71, 0x52, 0x71, 0x1E, 0xD5, 0x26, 0x19, 0x55,
+    0x26, 0x31, 0x95, 0x49, 0x23, 0x4E, 0x5D, 0xE1, 0x7D, 0x39, 0x67, 0x79, 0xBF, 0x59, 0xE0, 0x76,
+    0x0F, 0x7D, 0x95, 0x5A, 0x27, 0x4D, 0xEC, 0x2B, 0xBA, 0x60, 0x6F, 0x69, 0x83, 0x1C, 0xFA, 0x65,
+    0xC9, 0xA3, 0x22, 0x3A, 0x13, 0xA1, 0xFD, 0x60, 0xE1, 0xFF, 0x41, 0xF1, 0xCF, 0xC8, 0xCB, 0xAA,
+    0x10, 0xFC, 0x80, 0x16, 0xAF, 0xDC, 0xA3, 0x69, 0xC1, 0xFC, 0x6B, 0x39, 0xF2, 0x18, 0x91, 0x7D,
+    0xEF, 0xF8, 0x97, 0xF3, 0xFD, 0x43, 0x42, 0x91, 0x23, 0x4F, 0x1A, 0x4B, 0x71, 0x51, 0xE4, 0x97,
+    0x14, 0x56, 0x8E, 0x93, 0x48, 0x63, 0x65, 0x05, 0xF8, 0xC8, 0xB3, 0xFD, 0x79, 0xA2, 0x85, 0x92,
+    0x22, 0x57, 0xAA, 0x26, 0xFD, 0x66, 0x47, 0x5A, 0xE0, 0x11, 0xB0, 0x25, 0xA0, 0x7B, 0x54, 0x6B,
+    0x17, 0x45, 0x3A, 0x83, 0x84, 0xDD, 0x4B, 0xA1, 0x7E, 0xA2, 0x45, 0x39, 0xFA, 0xF5, 0xAB, 0x9A,
+    0x09, 0x3A, 0xCF, 0x09, 0x7D, 0x42, 0xF1, 0xC6, 0xE9, 0x3C, 0x4A, 0xB8, 0x93, 0x20, 0xB8, 0x79,
+    0x17, 0xDE, 0xC9, 0x7D, 0x96, 0x71, 0x78, 0x49, 0x1B, 0x5A, 0x55, 0xBC, 0x06, 0x76, 0x4A, 0x26,
+    0xFB, 0x1C, 0x58, 0x5F, 0xB2, 0x97, 0x12, 0xE5, 0xC3, 0xD0, 0x6E, 0x67, 0x1E, 0xAB, 0x92, 0xEA,
+    0x6F, 0xD7, 0x1E, 0xDE, 0x3B, 0xCF, 0xD0, 0xF2, 0xE2, 0x22, 0xE0, 0x28, 0x2F, 0x7E, 0xAA, 0xCE,
+    0xCE, 0x8D, 0x50, 0xDD, 0xDF, 0x1F, 0x75, 0x97, 0xE1, 0x14, 0x5D, 0x7F, 0x16, 0xA1, 0xB5, 0x9E,
+    0xEB, 0x18, 0x89, 0x68, 0x1C, 0xE4, 0xCA, 0xA5, 0x72, 0x9E, 0x66, 0x47, 0xD2, 0x8C, 0xF5, 0x58,
+    0xBA, 0x84, 0x2A, 0x24, 0x69, 0xBB, 0x25, 0xB2, 0x2C, 0x75, 0x2A, 0x2F, 0xBB, 0x85, 0xBC, 0xD4,
+    0xDB, 0xD2, 0xB3, 0xC3, 0x37, 0x29, 0x95, 0x8F, 0xD1, 0xE9, 0x46, 0xDD, 0xF7, 0x7C, 0x72, 0x2B,
+    0xD7, 0x19, 0x59, 0xED, 0x9B, 0xBD, 0xE9, 0x48, 0xE9, 0xAF, 0x2F, 0xAF, 0xEF, 0xFE, 0xFD, 0xA1,
+    0x09, 0xF3, 0x45, 0x46, 0xFC, 0xD4, 0x15, 0x2F, 0xE8, 0x75, 0xD8, 0x74, 0xEB, 0x0D, 0xFC, 0xFB,
+    0xF1, 0x17, 0xB5, 0x55, 0x3F, 0x6C, 0xDC, 0x54, 0x18, 0xFF, 0x3D, 0xBF, 0x1C, 0x86, 0x9A, 0xF3,
+    0xEB, 0x40, 0x25, 0x54, 0x91, 0xBA, 0x03, 0x13, 0xBA, 0xC3, 0x0C, 0x1D, 0x32, 0xF8, 0x62, 0x93,
+    0x48, 0x74, 0x88, 0x50, 0x2B, 0x11, 0xB1, 0xD2, 0x81, 0x01, 0xB1, 0xE4, 0x86, 0x0C, 0x1E, 0xEE,
+    0x72, 0x56, 0x18, 0x3B, 0xA4, 0x0B, 0x7B, 0x18, 0x3A, 0xC0, 0x42, 0x87, 0x0E, 0x11, 0x5C, 0x72,
+    0x4E, 0x97, 0x0E, 0x0C, 0x31, 0x41, 0xA8, 0x52, 0x41, 0xE2, 0x89, 0x2E, 0x4C, 0xE5, 0x09, 0x0C,
+    0xB2, 0x5A, 0x5F, 0x1E, 0xDF, 0xB3, 0x2F, 0x17, 0x2A, 0x05, 0xE9, 0x6E, 0xE0, 0xE9, 0xDE, 0xE9,
+    0xD9, 0xFE, 0x7E, 0xDF, 0xDF, 0xDF, 0xF7, 0x3D, 0xDC, 0x02, 0x90, 0xD3, 0x2E, 0x68, 0xAF, 0x63,
+    0xB2, 0xAC, 0x5D, 0x5C, 0xDE, 0xC9, 0x30, 0x0A, 0x23, 0x56, 0x96, 0xB0, 0xFF, 0x54, 0xF0, 0x8E,
+    0x52, 0x6C, 0x85, 0x60, 0x05, 0x3D, 0x3E, 0x51, 0x10, 0xB7, 0x53, 0x2C, 0xFB, 0x84, 0x1A, 0xC2,
+    0x3E, 0xCE, 0xE1, 0xAF, 0x29, 0x36, 0xF6, 0xB4, 0x56, 0xA1, 0xD6, 0xE9, 0x48, 0x8F, 0x31, 0xD0,
+    0x59, 0xAD, 0xA9, 0x0B, 0xF0, 0x04, 0x58, 0xA4, 0xA3, 0xC2, 0x39, 0x6B, 0x1D, 0xEC, 0x03, 0xC2,
+    0x1F, 0x65, 0x18, 0x90, 0xF6, 0x53, 0x63, 0x3B, 0x53, 0x63, 0xFC, 0xD7, 0xA9, 0x31, 0x96, 0xEF,
+    0xC3, 0x39, 0x2E, 0x31, 0xB8, 0xAE, 0x75, 0x29, 0xC8, 0x98, 0xAF, 0x75, 0xE4, 0xE9, 0x7C, 0xAA,
+    0x4B, 0xD0, 0x3E, 0x01, 0xDC, 0x2B, 0xC0, 0x9D, 0x57, 0x4E, 0x5F, 0x5E, 0x48, 0xF0, 0x69, 0x18,
+    0x59, 0xE5, 0x78, 0x1A, 0xC6, 0xE0, 0x2C, 0x0C, 0x63, 0x68, 0x12, 0x86, 0x31, 0xE4, 0xAD, 0x65,
+    0xD8, 0xF7, 0x53, 0x3B, 0x1F, 0x50, 0x18, 0x5A, 0x6B, 0x4B, 0xEB, 0x9C, 0x91, 0x91, 0x4A, 0x51,
+    0x21, 0xC0, 0x65, 0x1F, 0xDE, 0x83, 0x1C, 0x97, 0x1A, 0xD1, 0xFF, 0x91, 0x28, 0x48, 0x80, 0xD1,
+    0x23, 0x4F, 0xF1, 0x5F, 0x6B, 0x19, 0x18, 0x7A, 0x11, 0x72, 0x91, 0x5A, 0xCA, 0xCE, 0xEC, 0x8C,
+    0x2B, 0x91, 0xB2, 0xC2, 0x4B, 0x50, 0x86, 0xC0, 0xC1, 0x01, 0x10, 0x96, 0x80, 0x4F, 0xB5, 0x14,
+    0x94, 0x6D, 0x47, 0xD6, 0x5B, 0x4C, 0xB6, 0x37, 0xD9, 0xBE, 0xAC, 0x93, 0x45, 0xDE, 0xFD, 0x06,
+    0x5D, 0x08, 0x5B, 0x29, 0xE7, 0x08, 0x6D, 0x85, 0x5F, 0xE8, 0x4F, 0x1C, 0xAD, 0x29, 0x7A, 0x57,
+    0x98, 0xAF, 0xA7, 0x35, 0xB3, 0x74, 0x24, 0xDE, 0xCD, 0x16, 0xD1, 0x6D, 0xE1, 0x9D, 0x80, 0xCB,
+    0xC0, 0x45, 0xF0, 0x2A, 0x82, 0x26, 0x02, 0x11, 0x99, 0x47, 0x94, 0x1D, 0xB4, 0x3B, 0x58, 0xEC,
+    0xDC, 0xDD, 0xEF, 0x8F, 0xCA, 0xFE, 0x86, 0x64, 0x14, 0x43, 0x56, 0x51, 0xEA, 0x72, 0x85, 0x1F,
+    0xAD, 0x73, 0x5D, 0x3A, 0x49, 0xE9, 0xA2, 0xF7, 0x06, 0x82, 0x16, 0x82, 0x00, 0x9D, 0x00, 0x7D,
+    0x7F, 0xE5, 0x44, 0xE8, 0x13, 0x47, 0x3F, 0x65, 0x07, 0x37, 0x8C, 0x98, 0x5D, 0x79, 0xE5, 0x02,
+    0xAD, 0x17, 0x83, 0x9E, 0x11, 0x4E, 0xA8, 0x2D, 0xB0, 0x47, 0x89, 0x8D, 0xDD, 0x19, 0x51, 0x96,
+    0xBC, 0xCA, 0x3F, 0xE9, 0xDA, 0xCD, 0x5D, 0xDB, 0x4E, 0x67, 0x84, 0x38, 0x29, 0xE5, 0xBE, 0x10,
+    0x87, 0x45, 0x23, 0x5A, 0x9F, 0xD5, 0xB7, 0xB7, 0x80, 0x6D, 0xE0, 0x38, 0xC2, 0x60, 0xBE, 0x88,
+    0x1A, 0x54, 0xAA, 0x1F, 0xA9, 0x98, 0xA1, 0x3E, 0xE1, 0xC9, 0xDB, 0x7C, 0x8C, 0x6B, 0x2E, 0xB6,
+    0xD8, 0x47, 0x36, 0x88, 0xFC, 0x0F, 0x52, 0xFE, 0xEC, 0xF3, 0x48, 0x99, 0xD6, 0x0D, 0x8C, 0x5E,
+    0x27, 0x1B, 0xD1, 0x91, 0x38, 0xAB, 0xA5, 0xAF, 0x47, 0xBA, 0x20, 0x0D, 0x1B, 0xA6, 0xA5, 0xB1,
+    0x21, 0x3D, 0xCD, 0x25, 0x86, 0x70, 0x88, 0x36, 0x10, 0x11, 0xF6, 0x48, 0x16, 0xE1, 0x63, 0xA6,
+    0x8B, 0x97, 0x74, 0xF2, 0x32, 0xF0, 0x25, 0x70, 0x0B, 0xA5, 0x61, 0x44, 0x44, 0x04, 0x27, 0x7E,
+    0xFD, 0x2B, 0xF3, 0xAF, 0x4D, 0x4A, 0xDF, 0x42, 0x37, 0x6E, 0xEC, 0x8D, 0x74, 0xF9, 0xCD, 0x5D,
+    0xB2, 0x49, 0x2A, 0x28, 0xD3, 0xF0, 0x75, 0x2E, 0xA8, 0x3F, 0x46, 0x99, 0x29, 0xD9, 0x62, 0x95,
+    0xFF, 0xA5, 0xF3, 0x38, 0x3B, 0xA3, 0x92, 0xAB, 0xC6, 0xB4, 0xF5, 0x14, 0x0E, 0x4F, 0x16, 0x10,
+    0xCD, 0x85, 0x6D, 0xE0, 0xA6, 0x58, 0x51, 0xDE, 0xAA, 0xF2, 0x3F, 0xCB, 0xE7, 0xB5, 0xDB, 0xA6,
+    0x9E, 0xF2, 0x8D, 0x38, 0x8B, 0x5C, 0xF2, 0x5F, 0xF2, 0xC4, 0x45, 0xCC, 0xA4, 0x9D, 0x7A, 0x18,
+    0x5A, 0xCA, 0x69, 0xB6, 0xEA, 0x98, 0xDE, 0x5C, 0x32, 0x2B, 0x8E, 0x7B, 0xBD, 0xE1, 0x10, 0x09,
+    0x79, 0xFA, 0x6D, 0x72, 0x6F, 0xE9, 0x22, 0xAB, 0xAA, 0x44, 0x03, 0x4E, 0x12, 0xD4, 0xA5, 0x03,
+    0x93, 0x88, 0xE1, 0xC1, 0xA6, 0xF6, 0x24, 0x99, 0x06, 0x8B, 0x86, 0x62, 0x5B, 0x85, 0xE2, 0xFB,
+    0xB2, 0x76, 0x89, 0x55, 0xF4, 0x5E, 0x32, 0x9D, 0x4E, 0x20, 0x3A, 0xC6, 0x20, 0x04, 0x91, 0xCF,
+    0xAB, 0x82, 0x37, 0xDD, 0x46, 0x91, 0x33, 0x23, 0x4D, 0x43, 0xCC, 0xA1, 0xF9, 0x60, 0xB6, 0x11,
+    0xFC, 0xB8, 0x49, 0xC7, 0xF7, 0xE1, 0xAD, 0xFE, 0x8C, 0x0E, 0x55, 0x2B, 0x20, 0xF1, 0x1E, 0xA1,
+    0x03, 0x6C, 0x92, 0xFF, 0x0A, 0xFE, 0xEF, 0x92, 0x58, 0x91, 0xC2, 0xA2, 0xF9, 0x47, 0xAC, 0x6E,
+    0x7E, 0x91, 0x74, 0x1F, 0xB3, 0xC3, 0x49, 0xF7, 0xBE, 0x77, 0x47, 0xD0, 0xC0, 0x59, 0x91, 0x39,
+    0x7F, 0x98, 0x0A, 0x0F, 0x9D, 0x1E, 0xFE, 0x56, 0xFC, 0xA7, 0x54, 0x7C, 0x8D, 0xE5, 0x21, 0x9E,
+    0x2B, 0x2E, 0x2F, 0x4C, 0xFB, 0x75, 0xE1, 0x2C, 0x7D, 0xA4, 0x4A, 0xE8, 0xAC, 0xC3, 0x54, 0x8C,
+    0xF8, 0x3E, 0x02, 0xFA, 0xE5, 0x08, 0xF6, 0xD0, 0xEB, 0xB3, 0x22, 0xD4, 0x8A, 0x3E, 0x19, 0x5B,
+    0x75, 0xE5, 0x03, 0x13, 0xC8, 0xB9, 0x6B, 0x26, 0x25, 0x17, 0x4D, 0x51, 0x2C, 0x8A, 0xD5, 0x8E,
+    0x5E, 0xA7, 0xDC, 0xCE, 0x83, 0xB5, 0xB3, 0xD4, 0xDD, 0x4C, 0x9B, 0x5E, 0xB2, 0x30, 0xA7, 0x51,
+    0xCF, 0xAA, 0xF8, 0xB2, 0xAA, 0x2E, 0xB1, 0x9B, 0xF3, 0x79, 0x4B, 0x5D, 0x69, 0x0A, 0x45, 0xF3,
+    0x96, 0x4F, 0x6F, 0xB4, 0xC6, 0x87, 0x5F, 0xAD, 0xD2, 0xA5, 0x54, 0x9D, 0x49, 0x9D, 0x5F, 0x7F,
+    0x0B, 0x27, 0x25, 0xA7, 0x52, 0x9B, 0xB1, 0x7E, 0xAF, 0x4A, 0x14, 0xA5, 0xCB, 0xA9, 0x47, 0x3C,
+    0xF5, 0xDA, 0x26, 0x9C, 0xB1, 0x31, 0x29, 0xAE, 0x0F, 0xED, 0xED, 0x47, 0xDB, 0x99, 0x52, 0xF7,
+    0xE3, 0xA0, 0xD3, 0x16, 0xCE, 0x8E, 0x7D, 0xF8, 0xFC, 0xA1, 0x24, 0xA3, 0x9C, 0xEE, 0xB7, 0x50,
+    0x1A, 0x7E, 0x50, 0xFF, 0x12, 0x8A, 0xD5, 0x0C, 0xEE, 0x54, 0xA3, 0x92, 0x88, 0x63, 0x14, 0x9D,
+    0xA5, 0xAC, 0x07, 0xF4, 0x81, 0xF6, 0xE9, 0x75, 0x28, 0xDA, 0x26, 0x88, 0x3F, 0x32, 0xFE, 0x5D,
+    0x22, 0xAE, 0x20, 0x88, 0xF1, 0x97, 0x72, 0x7E, 0x78, 0xA6, 0x6F, 0xE8, 0x31, 0xD1, 0xDF, 0x7F,
+    0x62, 0x6E, 0x9E, 0x7F, 0x00, 0xB5, 0x95, 0xB1, 0x6F, 0x14, 0x47, 0x14, 0xC6, 0xBF, 0xD9, 0x91,
+    0x59, 0x85, 0x89, 0x18, 0x0A, 0x52, 0x05, 0xD8, 0x1E, 0xD9, 0xB7, 0x29, 0x52, 0x5C, 0x71, 0xE7,
+    0xDD, 0xC0, 0x1F, 0x80, 0x0B, 0x88, 0x14, 0xA4, 0x28, 0x3D, 0x45, 0x4C, 0x41, 0xE1, 0x02, 0xF0,
+    0x40, 0x0A, 0x4A, 0xBB, 0x71, 0x9F, 0xC2, 0x14, 0x71, 0x0A, 0x5C, 0x58, 0xD1, 0x29, 0xC2, 0x77,
+    0x2B, 0x5C, 0xA4, 0x48, 0xB3, 0x11, 0x4A, 0x8A, 0xA4, 0x59, 0x89, 0x3E, 0x4C, 0xD0, 0x46, 0x59,
+    0x4E, 0x77, 0xF7, 0xF2, 0xCD, 0xDA, 0x31, 0xC4, 0x41, 0x8A, 0x51, 0xC8, 0x48, 0x73, 0x7B, 0x3B,
+    0xBB, 0x33, 0xEF, 0xF7, 0xDE, 0xFB, 0xDE, 0x5B, 0x00, 0xB8, 0x01, 0xED, 0x70, 0x0E, 0xF0, 0xF8,
+    0xDB, 0xB0, 0xB0, 0x0B, 0xE8, 0xED, 0xE0, 0x79, 0xA9, 0xBF, 0x77, 0xF6, 0x3C, 0x7A, 0x2B, 0xF8,
+    0xDD, 0x9B, 0x27, 0x63, 0xB9, 0x2C, 0xD3, 0x54, 0xEA, 0xF4, 0x69, 0x89, 0x0A, 0xA6, 0xC4, 0x37,
+    0xE5, 0x49, 0x55, 0x1E, 0x73, 0xC7, 0x19, 0x95, 0x37, 0xF6, 0x92, 0xBF, 0x9D, 0x3C, 0x6E, 0x8E,
+    0x6B, 0xC3, 0x00, 0xA7, 0x80, 0x05, 0xA0, 0x87, 0xD7, 0x8E, 0x1D, 0xF4, 0x7A, 0xE8, 0x75, 0xB0,
+    0x62, 0x51, 0x1B, 0x57, 0xC7, 0x3F, 0x78, 0xFD, 0xDC, 0xAB, 0x3F, 0x2A, 0x48, 0x89, 0xD5, 0x02,
+    0x59, 0x81, 0xD4, 0x21, 0xCD, 0x91, 0x41, 0xCD, 0x90, 0x4D, 0x90, 0x55, 0xB8, 0x00, 0x9C, 0x46,
+    0x9C, 0x63, 0x05, 0xB1, 0xC3, 0xAA, 0x8B, 0x9F, 0xB9, 0x6E, 0x47, 0xBB, 0x41, 0x37, 0xDA, 0x73,
+    0xF3, 0x5D, 0xBD, 0xE7, 0xBA, 0x5D, 0xAB, 0xEF, 0x97, 0x59, 0xAD, 0x1B, 0x74, 0xA1, 0x0B, 0x5A,
+    0xE6, 0x4F, 0x17, 0x98, 0xC3, 0x92, 0xBD, 0xEB, 0xED, 0xBD, 0x3A, 0xD9, 0xAB, 0xFF, 0x3B, 0x02,
+    0xDE, 0xBB, 0xEE, 0x90, 0x48, 0x7D, 0xC4, 0x9F, 0x5B, 0x9C, 0x99, 0x63, 0x68, 0x98, 0x0E, 0xB3,
+    0x0B, 0xE8, 0x5F, 0x1C, 0xD4, 0x6F, 0xBC, 0x19, 0xF4, 0x81, 0xBE, 0x29, 0x90, 0x28, 0x0F, 0xEB,
+    0x16, 0xA1, 0x4B, 0x53, 0x44, 0x5E, 0xD5, 0x98, 0x6D, 0x0D, 0xB1, 0x2A, 0x52, 0xA4, 0x22, 0xB5,
+    0xA5, 0xB9, 0xB8, 0x82, 0xDD, 0xF3, 0x88, 0x1A, 0x75, 0x6D, 0xD3, 0x4A, 0x73, 0x70, 0xEE, 0xE8,
+    0x8A, 0x96, 0x89, 0x71, 0x93, 0x53, 0xB8, 0x75, 0x16, 0xBD, 0xF9, 0x80, 0xDC, 0xEF, 0xE1, 0x76,
+    0x7A, 0x71, 0x66, 0x65, 0x66, 0xE4, 0x57, 0x35, 0xBC, 0xDC, 0xBE, 0xF7, 0x2E, 0xB6, 0xA9, 0x07,
+    0x7A, 0xBB, 0x3A, 0x01, 0xE2, 0xE6, 0x08, 0x9D, 0x0A, 0x22, 0x99, 0x05, 0xC4, 0x02, 0xE8, 0x90,
+    0xDD, 0x7E, 0xCE, 0xB7, 0xBE, 0x2B, 0x10, 0x55, 0xBC, 0xA9, 0x53, 0xF2, 0xC7, 0x05, 0x16, 0xD1,
+    0xC0, 0xE6, 0x29, 0x4C, 0x11, 0x97, 0x7A, 0xBC, 0xD5, 0x28, 0x11, 0xC1, 0x48, 0xA4, 0xCC, 0x80,
+    0x49, 0xE2, 0x90, 0x11, 0xD3, 0x54, 0x3C, 0xE5, 0x24, 0x3E, 0x30, 0xF9, 0xB6, 0x66, 0x9C, 0x86,
+    0xF9, 0x1B, 0x70, 0xBE, 0x5D, 0x0A, 0x4D, 0xD3, 0x51, 0x30, 0xCF, 0xC3, 0x42, 0x9A, 0x80, 0x96,
+    0x25, 0xFD, 0x11, 0x99, 0x14, 0x1D, 0xED, 0x49, 0x12, 0xC3, 0x46, 0x85, 0x2E, 0x3C, 0x6A, 0xA2,
+    0x98, 0x72, 0xE4, 0x44, 0xAA, 0x54, 0x06, 0x6A, 0xF8, 0x19, 0x70, 0x36, 0xB8, 0x01, 0x35, 0x09,
+    0xFA, 0x68, 0x07, 0xEF, 0xC0, 0x82, 0x98, 0x47, 0xA8, 0xAB, 0x7F, 0x0E, 0x35, 0xAA, 0x22, 0x82,
+    0xC8, 0xC6, 0x3A, 0xD3, 0xCC, 0x5C, 0x81, 0x3B, 0x93, 0x1C, 0x11, 0x7D, 0x22, 0x98, 0x3E, 0xB8,
+    0x30, 0xF0, 0x94, 0x49, 0x24, 0xE3, 0x87, 0x56, 0xC4, 0x93, 0x9A, 0x7B, 0xFC, 0x09, 0x79, 0x71,
+    0x70, 0x48, 0x14, 0x04, 0x49, 0x09, 0x1F, 0xD6, 0xEC, 0x89, 0x99, 0x12, 0xBF, 0x48, 0x5F, 0xA9,
+    0x46, 0x9B, 0xA3, 0x86, 0x71, 0xD8, 0x85, 0x9E, 0x7E, 0x99, 0x88, 0x4B, 0xDB, 0x2C, 0xAA, 0x7D,
+    0x71, 0x9D, 0xAF, 0x10, 0x5F, 0x72, 0x70, 0x73, 0x6F, 0x99, 0x69, 0x09, 0x09, 0xE2, 0x47, 0xAA,
+    0xDC, 0x3E, 0x1D, 0xC2, 0xF7, 0xEF, 0x38, 0x4C, 0x10, 0x1E, 0x31, 0x73, 0x8C, 0xD4, 0x95, 0xFF,
+    0x21, 0x44, 0x4B, 0x34, 0xCB, 0xDA, 0x48, 0x0F, 0x33, 0xB0, 0x5C, 0x25, 0xA2, 0x2B, 0x9A, 0x34,
+    0x01, 0x87, 0x4C, 0x83, 0xD0, 0xBC, 0xB2, 0x9F, 0x95, 0x34, 0x91, 0x84, 0xB7, 0xD6, 0xDF, 0x81,
+    0xBE, 0x9F, 0xB7, 0x40, 0xDD, 0xD7, 0x35, 0x9A, 0xF7, 0x67, 0x48, 0xC5, 0xDB, 0x17, 0x9F, 0x04,
+    0xC3, 0x77, 0x48, 0x5E, 0x80, 0x06, 0x90, 0xBE, 0x04, 0xF2, 0x6D, 0xE5, 0x6A, 0x0A, 0x33, 0x95,
+    0x2D, 0x4F, 0xB5, 0x19, 0x02, 0xB1, 0x2A, 0xB1, 0x2C, 0xEB, 0xFB, 0x59, 0x73, 0x1F, 0x9A, 0x4F,
+    0x03, 0xD3, 0x1B, 0xA4, 0x2D, 0x8C, 0x9B, 0x6C, 0x82, 0xF1, 0x1A, 0x5A, 0x2B, 0x88, 0x8F, 0x70,
+    0x65, 0x63, 0x42, 0xCB, 0x0C, 0x9A, 0xE5, 0x8F, 0x5A, 0x49, 0xDE, 0x47, 0xEC, 0x79, 0xD6, 0x50,
+    0x97, 0x64, 0xAC, 0x19, 0x35, 0x36, 0x8E, 0x5D, 0x2E, 0x24, 0x5F, 0x94, 0x0C, 0x26, 0x17, 0x9A,
+    0x3E, 0xA2, 0xA9, 0xDD, 0xF8, 0x5A, 0xB8, 0x45, 0x28, 0x65, 0x29, 0x32, 0x5E, 0xED, 0x7E, 0xE4,
+    0x4C, 0xA8, 0x86, 0x92, 0x3F, 0x3B, 0x37, 0xA9, 0x61, 0x7E, 0x16, 0x0C, 0x57, 0xF4, 0xE3, 0xC2,
+    0x34, 0x1E, 0x46, 0x18, 0xBE, 0xBB, 0xC2, 0x76, 0x68, 0x0B, 0x55, 0xD2, 0xDF, 0x6D, 0xC6, 0x73,
+    0x81, 0x54, 0xC6, 0x71, 0x61, 0xBA, 0xEC, 0x59, 0x31, 0x13, 0xC4, 0xF4, 0x18, 0xE9, 0xD3, 0xA2,
+    0xA5, 0xD3, 0xB2, 0x89, 0x16, 0x8F, 0x8F, 0x24, 0x6F, 0xF9, 0xC8, 0xB5, 0x1A, 0x9C, 0x1D, 0xA2,
+    0x1F, 0x32, 0x1B, 0x08, 0x89, 0x10, 0x3F, 0xE1, 0xB6, 0xC4, 0xF5, 0x43, 0x6C, 0x03, 0x23, 0xDF,
+    0x4A, 0x4B, 0xBB, 0xF1, 0x50, 0xC2, 0xC6, 0x06, 0x81, 0x52, 0x87, 0x3F, 0xAF, 0x60, 0x1E, 0xCC,
+    0x98, 0xA7, 0x87, 0x19, 0x3E, 0x15, 0xA3, 0x35, 0x0A, 0xE2, 0x59, 0x0B, 0x69, 0xC9, 0x75, 0x8E,
+    0x73, 0x9E, 0x29, 0x0A, 0x8C, 0x1D, 0xCE, 0xE4, 0x27, 0xAE, 0xD3, 0x4E, 0x8B, 0x38, 0x5A, 0x3B,
+    0x8C, 0x21, 0x6F, 0xAF, 0x3F, 0xF8, 0xAB, 0x03, 0xA9, 0xAB, 0x17, 0x59, 0xDE, 0x23, 0x09, 0x7D,
+    0x84, 0xE9, 0x88, 0xA8, 0xBF, 0x01, 0x1D, 0xFA, 0x78, 0xDD, 0x48, 0xAD, 0x65, 0x1A, 0xC4, 0xB8,
+    0x48, 0x9F, 0x98, 0x69, 0x3E, 0x99, 0x6D, 0x6D, 0x92, 0x8F, 0x67, 0xEE, 0x31, 0xD7, 0xDC, 0x9C,
+    0x88, 0xBF, 0xF0, 0xD5, 0xD2, 0xCB, 0xEC, 0x9C, 0x21, 0x4F, 0x6E, 0x3F, 0x2A, 0xE7, 0x71, 0x63,
+    0x65, 0x6E, 0x30, 0x92, 0xC9, 0xB7, 0x0F, 0x72, 0xDF, 0x1E, 0x78, 0x27, 0xC8, 0xA4, 0xB6, 0x52,
+    0xAB, 0x51, 0xFB, 0xF9, 0x2C, 0x0C, 0xBA, 0xDA, 0xC5, 0x52, 0x60, 0xF9, 0xD5, 0xB6, 0x31, 0x77,
+    0x95, 0x2A, 0xBA, 0xC7, 0xAE, 0xC5, 0x62, 0xE9, 0x1C, 0x02, 0xED, 0x5E, 0xCB, 0x53, 0x29, 0xB9,
+    0x39, 0x88, 0xAE, 0x39, 0x04, 0x1A, 0x6F, 0xAD, 0x8B, 0x4C, 0xF6, 0x81, 0x0A, 0x1C, 0x63, 0xFC,
+    0x09, 0xAD, 0x55, 0x31, 0x6C, 0xDD, 0x44, 0x18, 0xFE, 0xEC, 0x23, 0xB1, 0x88, 0x45, 0xDC, 0x21,
+    0x9D, 0xDA, 0xC4, 0x0B, 0x03, 0x2D, 0x04, 0x77, 0x28, 0x52, 0x86, 0xA4, 0x76, 0x9B, 0x81, 0xA1,
+    0x0C, 0x11, 0x2A, 0x0C, 0x20, 0x10, 0x2B, 0x15, 0x12, 0x19, 0x82, 0xF4, 0x2A, 0x25, 0x3C, 0xD3,
+    0x0C, 0x0C, 0x0C, 0xC9, 0xD2, 0x3D, 0x12, 0x64, 0xE9, 0xD2, 0x0C, 0x41, 0xAA, 0xD0, 0x4B, 0x9E,
+    0xDB, 0x0C, 0x1D, 0xBA, 0x18, 0x18, 0x3A, 0x74, 0x31, 0xA4, 0x0B, 0x2C, 0x5C, 0xC1, 0x05, 0xB7,
+    0xF2, 0xF3, 0xDF, 0xEF, 0xEC, 0xBC, 0x97, 0x47, 0xCA, 0x14, 0xE1, 0xCB, 0xDD, 0xE5, 0xEE, 0xDD,
+    0x7F, 0xDF, 0x77, 0xFF, 0xF7, 0xFF, 0x77, 0x00, 0x4E, 0x63, 0x63, 0xDC, 0x4A, 0x1D, 0x49, 0xAC,
+    0x0A, 0xFF, 0xFA, 0x26, 0x60, 0x4B, 0xE4, 0x5D, 0x4C, 0xDF, 0xC0, 0x62, 0x6B, 0xE4, 0x76, 0x57,
+    0xCA, 0x1F, 0x36, 0x23, 0x0D, 0xDC, 0x06, 0xBE, 0x04, 0x02, 0xC9, 0x3D, 0xC9, 0xAD, 0x6E, 0x8A,
+    0x11, 0xC0, 0x49, 0x60, 0xE7, 0x40, 0x6F, 0xD8, 0xFA, 0xE4, 0x95, 0x40, 0x2A, 0x57, 0xE4, 0x52,
+    0x63, 0xF2, 0x26, 0xE0, 0xC6, 0xB0, 0x9F, 0x7C, 0x8A, 0xAE, 0x44, 0xA1, 0xA4, 0x5E, 0x02, 0x95,
+    0x01, 0x05, 0x70, 0x01, 0xF0, 0x7E, 0xBF, 0x39, 0x2F, 0xA2, 0x45, 0xCA, 0x50, 0xC4, 0x00, 0xA3,
+    0x53, 0xFF, 0xF5, 0x8E, 0x47, 0xE8, 0x3D, 0xC2, 0x5E, 0x17, 0x49, 0x3B, 0x03, 0x58, 0x22, 0xED,
+    0x7C, 0x10, 0x05, 0x84, 0x95, 0x5C, 0xE9, 0x01, 0x6C, 0x0C, 0xF5, 0xEC, 0xE6, 0x7A, 0x03, 0xEB,
+    0x89, 0x24, 0x76, 0x0C, 0x24, 0xC0, 0x17, 0x3C, 0x51, 0xFA, 0x22, 0x62, 0xAB, 0x46, 0x5C, 0x18,
+    0x20, 0x86, 0x55, 0x1F, 0xF1, 0x35, 0x60, 0xA3, 0xB6, 0x7C, 0x04, 0xAC, 0x18, 0x3B, 0x3B, 0x7A,
+    0x15, 0xB3, 0x2D, 0x28, 0xE2, 0xCC, 0xFE, 0x4F, 0x4E, 0x01, 0xC6, 0xAD, 0x44, 0xDD, 0x07, 0x4A,
+    0x60, 0xE6, 0x58, 0x7E, 0xC1, 0x22, 0xEA, 0x19, 0x5C, 0x23, 0xC6, 0xD2, 0xD8, 0xA1, 0xBD, 0xD5,
+    0xAD, 0x40, 0x52, 0xA9, 0x4B, 0x60, 0x45, 0x1D, 0x6D, 0xF6, 0xB5, 0xEF, 0x43, 0x56, 0x72, 0x82,
+    0x71, 0x19, 0x71, 0xC3, 0xEF, 0x42, 0xAE, 0x5B, 0x4B, 0xE0, 0xFE, 0x5A, 0xC0, 0x4E, 0xDB, 0x31,
+    0xB8, 0xB5, 0x54, 0xB6, 0x88, 0xC4, 0x01, 0xED, 0x71, 0xAB, 0x8A, 0x70, 0xCE, 0xAC, 0x9E, 0xD3,
+    0x2A, 0xDE, 0x6A, 0x36, 0x0F, 0xBE, 0x7E, 0x5B, 0xAA, 0x39, 0xFF, 0x49, 0xEA, 0x3D, 0x44, 0xB0,
+    0x8C, 0x95, 0x2D, 0xEB, 0xEF, 0xC4, 0x7D, 0x70, 0xA3, 0xEB, 0x49, 0xE9, 0x8B, 0x76, 0xF7, 0x13,
+    0x04, 0x2F, 0xD9, 0x45, 0x28, 0x77, 0xA4, 0x67, 0x75, 0xD7, 0x1B, 0x9B, 0x31, 0x9C, 0x87, 0xC5,
+    0xE3, 0x20, 0x24, 0x0B, 0xFB, 0x48, 0x14, 0xE0, 0x94, 0x64, 0xF4, 0x57, 0x0F, 0x5D, 0xAA, 0x15,
+    0x46, 0x44, 0x60, 0xEF, 0xA5, 0x03, 0x96, 0x7D, 0xDA, 0xEA, 0xD9, 0xBC, 0x46, 0xB7, 0xE0, 0xC4,
+    0x2E, 0x57, 0x4C, 0x3B, 0x05, 0xBC, 0x88, 0x4C, 0x33, 0x32, 0x2D, 0x48, 0xB9, 0x87, 0x31, 0x79,
+    0x64, 0xB6, 0x5B, 0x54, 0x71, 0x36, 0x69, 0x4B, 0x66, 0x1D, 0xE2, 0xD8, 0xC5, 0x52, 0x5B, 0xF6,
+    0x7F, 0x94, 0x8F, 0xD0, 0xDB, 0xB2, 0xFF, 0x49, 0x9C, 0x87, 0xF0, 0x3F, 0xC3, 0xCE, 0xB5, 0x0F,
+    0x29, 0xC6, 0x1D, 0x6A, 0xB1, 0x3B, 0x0B, 0x5B, 0x47, 0xC1, 0xAA, 0x39, 0x41, 0x7A, 0xEA, 0x29,
+    0x0D, 0x16, 0x50, 0x4B, 0x56, 0x3B, 0xCB, 0xD1, 0x47, 0xF8, 0x7E, 0x2E, 0x31, 0xF1, 0x72, 0xBB,
+    0x3A, 0xF0, 0xEA, 0x2E, 0x1A, 0xDE, 0x43, 0x9E, 0x35, 0x9C, 0xBD, 0xDF, 0xBC, 0xC4, 0x96, 0x7D,
+    0x4D, 0x74, 0xAE, 0xD8, 0xF6, 0x33, 0xCC, 0x29, 0xE3, 0xD9, 0x2E, 0x39, 0x53, 0x9D, 0x1C, 0xAF,
+    0xCB, 0x7A, 0xAD, 0xB5, 0x36, 0x96, 0xE1, 0xE1, 0xFE, 0xBB, 0x93, 0xBE, 0x14, 0x79, 0xFB, 0x41,
+    0x14, 0x92, 0xA4, 0xA6, 0x7B, 0xC9, 0x37, 0xF8, 0xF8, 0x7D, 0x86, 0x8D, 0x6E, 0x4B, 0x12, 0xAC,
+    0x31, 0x95, 0x4E, 0xB8, 0x99, 0x88, 0x23, 0xF9, 0x28, 0x05, 0x32, 0xDF, 0xA8, 0x14, 0x0C, 0x0C,
+    0x89, 0x82, 0xAC, 0x71, 0x9D, 0x9B, 0x35, 0xCA, 0x0F, 0xB9, 0xAF, 0xE6, 0x56, 0xAD, 0x97, 0x08,
+    0x2A, 0x4E, 0x04, 0xDF, 0x64, 0x70, 0x2F, 0x56, 0x50, 0x29, 0x83, 0xB1, 0x20, 0x9D, 0x8A, 0x12,
+    0x48, 0x64, 0x77, 0x9F, 0x1E, 0x39, 0xAC, 0xD9, 0xCD, 0x78, 0xC0, 0x2A, 0x0F, 0x82, 0xAD, 0x7F,
+    0xD2, 0x36, 0xEC, 0xD2, 0xE0, 0x04, 0x11, 0x41, 0x9C, 0xEC, 0x98, 0x8E, 0xE6, 0xA7, 0xB8, 0x99,
+    0x4B, 0x84, 0x69, 0x66, 0xD6, 0x27, 0xA3, 0xF5, 0x14, 0xAF, 0xA0, 0x85, 0x80, 0x79, 0x33, 0x54,
+    0xCB, 0x7E, 0x0D, 0x87, 0x6B, 0x93, 0x4C, 0x87, 0x35, 0xB2, 0xFA, 0xB5, 0x17, 0xC6, 0x4D, 0x00,
+    0x6C, 0x1B, 0xAA, 0x58, 0xDA, 0xAA, 0xF7, 0xE6, 0x80, 0x51, 0xE8, 0x36, 0xA0, 0xBA, 0x4E, 0x66,
+    0x2F, 0x4C, 0x15, 0x4F, 0x5F, 0x5D, 0x4E, 0x2E, 0x50, 0x24, 0x4C, 0x3A, 0x89, 0xF3, 0x95, 0xB6,
+    0xB2, 0x0E, 0x5A, 0x01, 0xA6, 0xDC, 0xC4, 0xBD, 0xAB, 0x6D, 0x5D, 0xA2, 0x1C, 0x8D, 0x71, 0xC6,
+    0x28, 0x15, 0x77, 0x98, 0xD2, 0x86, 0x93, 0x4B, 0xCD, 0xCC, 0xC4, 0x1E, 0x35, 0x2D, 0x59, 0x2B,
+    0x23, 0xA2, 0x32, 0x5A, 0x72, 0xA0, 0x0D, 0x1B, 0xE6, 0x92, 0x18, 0xC5, 0x93, 0x1E, 0x3D, 0x68,
+    0x68, 0xD1, 0x97, 0xED, 0xF9, 0x02, 0x7E, 0x6A, 0x78, 0x90, 0x04, 0xBE, 0x8F, 0x94, 0x94, 0x38,
+    0x49, 0x22, 0x1E, 0x47, 0x7F, 0xF5, 0xE0, 0x51, 0x47, 0x32, 0xF1, 0xE2, 0x69, 0x4B, 0x5B, 0xA9,
+    0x8F, 0x29, 0x76, 0x44, 0x9B, 0xB2, 0xEB, 0x2E, 0xB0, 0xC9, 0x25, 0xA4, 0x9E, 0x96, 0xAF, 0xDE,
+    0xBA, 0x77, 0x6E, 0x65, 0x10, 0xDE, 0x1B, 0x4A, 0x9B, 0x62, 0xBF, 0x50, 0x54, 0x5E, 0x97, 0x42,
+    0x15, 0x73, 0xAF, 0x7C, 0xFB, 0x4E, 0x5A, 0x36, 0xD1, 0xA2, 0x22, 0x15, 0xF7, 0x8B, 0x63, 0x4A,
+    0xE2, 0x24, 0x3C, 0x69, 0x32, 0x72, 0x95, 0x77, 0x67, 0x32, 0x24, 0xFE, 0x58, 0x6C, 0x82, 0xA7,
+    0x34, 0x91, 0xC3, 0xE3, 0x06, 0xE6, 0x0E, 0xB7, 0x8F, 0xFE, 0xCB, 0x78, 0xE8, 0x99, 0x58, 0xF3,
+    0x32, 0x84, 0x4C, 0x5C, 0x47, 0xCA, 0xAB, 0x9B, 0x0D, 0xCC, 0xCB, 0x40, 0x86, 0xF1, 0x41, 0x33,
+    0x05, 0x2B, 0x83, 0x0F, 0x4B, 0xD3, 0x9A, 0xA6, 0x67, 0xBD, 0xBB, 0xBA, 0x13, 0xB8, 0x07, 0xCD,
+    0x4E, 0x70, 0xF9, 0xA7, 0xBC, 0x0A, 0xD7, 0x7E, 0x49, 0x92, 0x45, 0x2F, 0x39, 0xE1, 0xBB, 0x7B,
+    0xF9, 0x15, 0x6E, 0x11, 0xCD, 0x8C, 0x33, 0x9B, 0x67, 0xA6, 0x28, 0xC9, 0x72, 0xE0, 0xEE, 0x5D,
+    0x8A, 0x37, 0x89, 0x38, 0xE1, 0xAD, 0x3E, 0x2E, 0x9B, 0xEB, 0xD7, 0xDB, 0xD3, 0xE5, 0x60, 0x8F,
+    0x4E, 0xE0, 0xFD, 0x9C, 0xF7, 0xC2, 0xB5, 0x6C, 0x62, 0xC6, 0x7C, 0xAD, 0xD6, 0xF2, 0x72, 0xA7,
+    0x73, 0x16, 0xA3, 0xAB, 0xDA, 0x44, 0x0B, 0x97, 0x9A, 0x00, 0x22, 0xEA, 0x7F, 0x74, 0xD7, 0xB5,
+    0x09, 0x32, 0x6F, 0x35, 0x47, 0x11, 0x46, 0xA6, 0xCB, 0xC3, 0xD8, 0x9F, 0x2F, 0xAC, 0xDC, 0x64,
+    0x8F, 0x75, 0x4B, 0xC3, 0xAF, 0x78, 0x27, 0xF3, 0xDC, 0x19, 0x96, 0x81, 0x77, 0x35, 0xD4, 0x1F,
+    0x29, 0xBC, 0x1B, 0x75, 0x68, 0x35, 0x57, 0xAE, 0xB9, 0xCF, 0x19, 0xC3, 0xBC, 0xC9, 0xB7, 0x33,
+    0xD8, 0x7B, 0x31, 0x5C, 0x0E, 0xF9, 0x64, 0xE0, 0x71, 0x06, 0x75, 0x2F, 0x81, 0xE7, 0x73, 0xC8,
+    0x07, 0xEC, 0x4F, 0x5D, 0xC7, 0x1E, 0x7F, 0x44, 0xAB, 0x7E, 0x96, 0x14, 0xDF, 0x02, 0xBF, 0x49,
+    0x9F, 0xF3, 0xE6, 0x96, 0xBB, 0x8F, 0xF4, 0x34, 0x7B, 0x8B, 0x71, 0x12, 0x37, 0x4D, 0x0E, 0x3F,
+    0xAA, 0x1B, 0xBE, 0xC9, 0xB5, 0xEB, 0x0E, 0x9B, 0xB0, 0x4E, 0x6A, 0x25, 0x69, 0x58, 0x72, 0x9F,
+    0x33, 0x11, 0x9E, 0x03, 0xAD, 0x55, 0x3D, 0x8C, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0xE1, 0x62, 0xE9,
+    0x2C, 0x6E, 0x52, 0x70, 0x52, 0x04, 0xC9, 0x9A, 0x82, 0x02, 0xA4, 0xCB, 0xB9, 0x49, 0x11, 0xC1,
+    0x7A, 0xC7, 0x40, 0x41, 0x41, 0x8B, 0x28, 0x52, 0xD3, 0x90, 0x06, 0x0A, 0x8A, 0x43, 0xBA, 0xBB,
+    0x35, 0xA4, 0x4C, 0x01, 0x15, 0x2D, 0x69, 0x90, 0xE8, 0x8E, 0x62, 0x8B, 0x14, 0x86, 0x1D, 0x48,
+    0x91, 0x92, 0x41, 0x44, 0xA2, 0xB5, 0x04, 0x1D, 0xCD, 0xA0, 0x18, 0xC9, 0x44, 0xBE, 0x1D, 0xBE,
+    0xE7, 0xBD, 0xE8, 0xEE, 0x16, 0x88, 0x2E, 0xE8, 0x9E, 0xDE, 0xBC, 0xF5, 0xDA, 0x9E, 0xF7, 0x7D,
+    0xEF, 0xCF, 0x83, 0x97, 0x11, 0xB5, 0x18, 0xCD, 0x22, 0x7B, 0x0D, 0x94, 0x8B, 0x88, 0x2D, 0x34,
+    0x30, 0x06, 0x3C, 0xD4, 0xA9, 0xCB, 0x0D, 0xE0, 0x3A, 0xD0, 0x20, 0xAD, 0xB0, 0x07, 0xE3, 0xE3,
+    0x85, 0xBC, 0x8F, 0xD4, 0x1A, 0xE4, 0x71, 0x8B, 0x3A, 0xAB, 0x54, 0xD3, 0x43, 0xDF, 0x76, 0x98,
+    0x18, 0xE0, 0x51, 0x0B, 0x15, 0x2A, 0xE8, 0x1E, 0x98, 0x36, 0x88, 0x82, 0x45, 0xC2, 0x95, 0x4F,
+    0x2D, 0xEA, 0xA9, 0x55, 0x7E, 0x6E, 0xB5, 0x0D, 0xDC, 0x19, 0x6C, 0x2F, 0xCF, 0x28, 0x79, 0x05,
+    0xD0, 0xA3, 0x6A, 0x01, 0xCD, 0x1B, 0xFB, 0x00, 0x9D, 0xE2, 0xD2, 0x0A, 0x8D, 0xE4, 0x07, 0x97,
+    0xE5, 0xF8, 0xD8, 0x47, 0xA1, 0x4C, 0x3A, 0xE4, 0x1E, 0x73, 0x1F, 0xFF, 0xEA, 0xD3, 0xFB, 0x3E,
+    0x4F, 0xDB, 0x5E, 0xB7, 0x38, 0x92, 0xC4, 0x23, 0xB3, 0xF8, 0x4E, 0x5C, 0xD0, 0xD9, 0x74, 0xE0,
+    0x99, 0xC6, 0xF7, 0xAB, 0x87, 0xF6, 0x55, 0xA7, 0x1B, 0xE5, 0x71, 0x88, 0xD7, 0xDC, 0x95, 0xBD,
+    0xE4, 0xED, 0x9F, 0xDC, 0xA1, 0xAA, 0x90, 0x94, 0x02, 0x30, 0xC2, 0xB1, 0xF0, 0x6F, 0x76, 0x5A,
+    0xF3, 0x7F, 0xA8, 0x59, 0xEA, 0xE6, 0x0D, 0x13, 0xC2, 0x52, 0x49, 0xBF, 0xDC, 0x42, 0x93, 0x96,
+    0x83, 0x8F, 0x0D, 0x8C, 0xA3, 0x26, 0xA9, 0xB6, 0x31, 0x8B, 0x9D, 0x2E, 0x0B, 0xB4, 0x8A, 0x3F,
+    0x63, 0x78, 0xF5, 0x40, 0xF7, 0xC6, 0xAF, 0xFF, 0x4F, 0x84, 0xC7, 0x62, 0x4A, 0x89, 0x6B, 0x3A,
+    0x64, 0xAA, 0x17, 0x7D, 0x32, 0x1C, 0x24, 0xB5, 0xDA, 0x99, 0xA8, 0x4B, 0x9D, 0xC1, 0xDA, 0x29,
+    0xE4, 0x8B, 0x19, 0x3E, 0xCA, 0x45, 0x67, 0x83, 0xAE, 0x80, 0xBF, 0x7B, 0x0C, 0x9E, 0xBC, 0xF9,
+    0xBD, 0xF3, 0xB3, 0x9D, 0xAD, 0xD1, 0x5A, 0x5A, 0xC5, 0x0E, 0x33, 0x14, 0xD0, 0xA5, 0x72, 0x68,
+    0xE5, 0x42, 0xCA, 0xF4, 0x27, 0xFB, 0x82, 0x25, 0x3F, 0x1D, 0x5B, 0x9D, 0xA1, 0xCF, 0x45, 0xDF,
+    0x79, 0x72, 0x6C, 0x1B, 0x52, 0xE0, 0x11, 0xA2, 0x06, 0xDB, 0xD1, 0x1B, 0xAE, 0xBE, 0xAA, 0xEF,
+    0xB9, 0xBE, 0x00, 0xDD, 0x0F, 0x66, 0x2C, 0xFE, 0x8B, 0x52, 0x05, 0x0C, 0xC1, 0x1C, 0xC9, 0x15,
+    0x31, 0xD7, 0xC5, 0xC8, 0x4D, 0x6E, 0xC5, 0x3A, 0x5F, 0x43, 0x26, 0x25, 0xC8, 0x88, 0x8E, 0x6C,
+    0x2C, 0xE6, 0xAE, 0x18, 0x79, 0x23, 0x77, 0x62, 0xA4, 0xE1, 0x72, 0x3C, 0x36, 0x46, 0x8C, 0x64,
+    0x36, 0x12, 0xA3, 0xC4, 0xA4, 0xF3, 0xCD, 0x1B, 0xC8, 0x24, 0xE4, 0x89, 0x98, 0x5A, 0x8C, 0x34,
+    0x57, 0xDC, 0x48, 0x73, 0xC9, 0x76, 0xCD, 0x76, 0xC5, 0xF6, 0x72, 0x62, 0x06, 0x69, 0x86, 0xA6,
+    0x11, 0x06, 0xA3, 0xE5, 0x7B, 0x57, 0xF9, 0x43, 0xB4, 0xE2, 0x3D, 0xA8, 0xC5, 0x50, 0x25, 0xF6,
+    0xFE, 0xFE, 0x18, 0x13, 0xE1, 0x47, 0x52, 0xEA, 0x01, 0x24, 0x92, 0x01, 0x6E, 0x8B, 0x4B, 0xA6,
+    0xEF, 0x9B, 0xA3, 0x38, 0x4E, 0x49, 0xA1, 0x1B, 0xEC, 0x69, 0xCF, 0xD5, 0x72, 0xF5, 0xD8, 0xD5,
+    0x87, 0xA8, 0xF5, 0x9C, 0xEB, 0xCB, 0xB2, 0xCE, 0x3E, 0xB3, 0x7D, 0x76, 0xDB, 0xF5, 0xD9, 0xAD,
+    0xA6, 0xCF, 0x3F, 0xF5, 0x7D, 0x5E, 0x75, 0x5C, 0xDF, 0xF6, 0xA6, 0x32, 0x9D, 0xA9, 0xF2, 0xCE,
+    0xD8, 0x8C, 0x4B, 0x77, 0x48, 0x06, 0x50, 0x0E, 0xEF, 0x49, 0xD7, 0x2F, 0xBD, 0x8F, 0x10, 0x54,
+    0xBB, 0xCD, 0x3E, 0xD9, 0xC5, 0x1F, 0x5E, 0xFD, 0x62, 0xF5, 0x07, 0x28, 0x6A, 0x3C, 0xF2, 0xEA,
+    0x77, 0x4B, 0x88, 0x09, 0xDF, 0x79, 0x25, 0x65, 0x01, 0xFE, 0x15, 0xFE, 0x40, 0xE0, 0x2B, 0xC2,
+    0xDB, 0xFF, 0x80, 0x37, 0xC7, 0xF0, 0xC3, 0x4C, 0x49, 0x8A, 0xDC, 0x72, 0xBC, 0x65, 0xC9, 0xC4,
+    0x9B, 0xB3, 0x91, 0xE0, 0x3C, 0xE7, 0xC3, 0x3C, 0x7B, 0xD9, 0xB9, 0x3F, 0x64, 0xBD, 0xC4, 0x65,
+    0x06, 0x95, 0xD4, 0x90, 0xBB, 0xC0, 0xE7, 0x27, 0x03, 0x3B, 0x17, 0xD2, 0x6B, 0x78, 0x71, 0x3D,
+    0x45, 0x4A, 0xC8, 0x12, 0xCF, 0x3C, 0x4D, 0xCE, 0x4A, 0xE9, 0x57, 0x36, 0x08, 0x2F, 0xBF, 0x5E,
+    0xAD, 0xE6, 0xA5, 0x9B, 0x65, 0x1E, 0x5C, 0xFE, 0x89, 0xE7, 0xA8, 0x4D, 0xB0, 0x53, 0x60, 0x97,
+    0x3A, 0x11, 0xAD, 0x97, 0xBA, 0x8F, 0xFA, 0xFC, 0xB2, 0x4E, 0x0F, 0x71, 0x70, 0x48, 0xFE, 0x3A,
+    0x13, 0x75, 0x83, 0xA8, 0xE3, 0xD7, 0x3A, 0x1E, 0xBE, 0x32, 0x9B, 0x37, 0x2B, 0x64, 0xA1, 0x3D,
+    0x66, 0xFE, 0xC2, 0xA2, 0x84, 0x09, 0x3D, 0x88, 0x60, 0x4D, 0xA5, 0xBA, 0xAC, 0x82, 0x21, 0xCB,
+    0xE4, 0x67, 0x66, 0xBF, 0x23, 0x96, 0x29, 0x38, 0x37, 0x3F, 0x96, 0x88, 0x1F, 0xB2, 0xCE, 0x1D,
+    0x3F, 0x49, 0x13, 0x16, 0xD8, 0xBC, 0xB5, 0xF8, 0x62, 0x6E, 0x43, 0x08, 0x3E, 0xE3, 0x8A, 0x02,
+    0x1D, 0x5E, 0x08, 0xCB, 0x52, 0x3D, 0x7F, 0xE0, 0xCD, 0xE2, 0xCE, 0xC9, 0xDC, 0xF0, 0x44, 0xD1,
+    0xC1, 0x15, 0x91, 0xDF, 0xC1, 0xCE, 0x0C, 0x63, 0x6A, 0x8B, 0xF1, 0x5D, 0xEC, 0xEE, 0x45, 0x9D,
+    0x09, 0x9E, 0x8F, 0x8E, 0x8E, 0x1C, 0x3C, 0x8B, 0x0F, 0x79, 0x4C, 0x71, 0x6A, 0xCC, 0x21, 0x77,
+    0x75, 0x2B, 0x29, 0x3E, 0x6F, 0xA2, 0x94, 0xCB, 0xB8, 0xB3, 0x11, 0xB9, 0x34, 0xD8, 0x68, 0xB1,
+    0x5A, 0xD0, 0x33, 0x91, 0xBE, 0x80, 0xB8, 0x8A, 0x9B, 0xC8, 0xA3, 0x63, 0x75, 0x9F, 0xC3, 0xE6,
+    0x0A, 0x5B, 0xCD, 0xCF, 0x8B, 0xEA, 0x54, 0xCF, 0x03, 0x50, 0x37, 0x42, 0x97, 0xE7, 0x56, 0xD4,
+    0x72, 0x36, 0xF4, 0x2D, 0x52, 0xEC, 0x85, 0xEF, 0x3D, 0x0E, 0x0E, 0xDB, 0x83, 0x77, 0x24, 0x0A,
+    0x21, 0xFC, 0x7A, 0xF8, 0xEA, 0x80, 0xFE, 0xB9, 0x75, 0x1A, 0x48, 0x4C, 0x18, 0x47, 0xF3, 0xDF,
+    0xF0, 0xB4, 0xF2, 0x37, 0xAD, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xB3, 0x63, 0x7B, 0xC0,
+    0x2B, 0xBC, 0x2E, 0x8C, 0x10, 0x32, 0xF6, 0x52, 0xB8, 0x48, 0x61, 0xE7, 0x1A, 0x0A, 0x90, 0xEE,
+    0x6E, 0x27, 0x50, 0x50, 0xA4, 0x48, 0x0A, 0xDC, 0x50, 0xA5, 0x25, 0x42, 0x72, 0x8A, 0x14, 0x29,
+    0x1C, 0xDF, 0x46, 0x94, 0x14, 0xB9, 0x9F, 0x10, 0x89, 0x20, 0x59, 0x96, 0x90, 0x52, 0xB8, 0x88,
+    0x44, 0xCC, 0x8E, 0xA0, 0x40, 0x02, 0xA1, 0x8C, 0x82, 0xA2, 0x94, 0xAC, 0xC0, 0x05, 0x22, 0x42,
+    0x3A, 0xC2, 0x22, 0xAD, 0xAC, 0xDB, 0x1D, 0xDE, 0xEC, 0xDA, 0x67, 0x2B, 0x11, 0x31, 0x85, 0x67,
+    0xF5, 0xCD, 0xCE, 0xEE, 0xCC, 0x7C, 0xDF, 0xFB, 0xDE, 0xF7, 0x66, 0x70, 0x0E, 0x6F, 0x8A, 0x11,
+    0xEE, 0x87, 0x46, 0xE5, 0x0B, 0x98, 0xC6, 0x0B, 0xAD, 0x93, 0x03, 0xAE, 0x82, 0xB4, 0x31, 0x54,
+    0xAA, 0xD2, 0x50, 0x4B, 0xE3, 0x2D, 0xF2, 0xEF, 0x54, 0x19, 0x65, 0xE3, 0x54, 0x3A, 0xD7, 0xAC,
+    0x69, 0xD6, 0xB6, 0x6D, 0xB1, 0xDE, 0xE0, 0x0F, 0xC7, 0x36, 0x96, 0xA5, 0xAA, 0xD7, 0x11, 0xE5,
+    0xC8, 0x80, 0xD8, 0x20, 0xE1, 0x32, 0x8D, 0x44, 0xFB, 0x41, 0x92, 0xA2, 0xCF, 0xFE, 0x71, 0xEA,
+    0x7B, 0x67, 0x7A, 0x4D, 0xEF, 0xC7, 0xE6, 0x70, 0xB6, 0x93, 0xFA, 0x95, 0xF1, 0xC1, 0xC7, 0x0C,
+    0x10, 0xD1, 0xD9, 0xCE, 0xB6, 0xF2, 0x3E, 0x2B, 0xE1, 0xFB, 0x9A, 0x51, 0x32, 0x1F, 0x1A, 0x53,
+    0x08, 0x6A, 0xE1, 0x4C, 0xE4, 0x9E, 0xD8, 0x6B, 0x3D, 0x51, 0x63, 0xF5, 0x06, 0x36, 0xC5, 0xA7,
+    0xBB, 0xF4, 0x56, 0xEF, 0xA2, 0xFF, 0xE5, 0xE5, 0x02, 0x5D, 0xE0, 0x3E, 0x6E, 0x02, 0x37, 0x85,
+    0x63, 0x64, 0x0F, 0x8B, 0x8B, 0xDD, 0x38, 0xA8, 0x91, 0xED, 0x37, 0x80, 0xDF, 0x05, 0x14, 0x5F,
+    0x23, 0x60, 0x79, 0x92, 0xBA, 0xFB, 0x9D, 0x41, 0x0B, 0xE4, 0xA1, 0x99, 0x43, 0x0F, 0x79, 0x90,
+    0x2F, 0x63, 0x59, 0xE4, 0x32, 0x5F, 0x16, 0x1E, 0x40, 0xDA, 0x71, 0x79, 0xE0, 0x5F, 0x7A, 0x2F,
+    0x28, 0x64, 0x9E, 0xE8, 0x8E, 0x2C, 0x64, 0x91, 0xE8, 0xE4, 0xB3, 0x52, 0x8E, 0x93, 0x34, 0x31,
+    0xC2, 0x48, 0xA3, 0x74, 0xD4, 0xB8, 0x5A, 0x98, 0xEA, 0x55, 0x49, 0x95, 0xE8, 0x3E, 0x13, 0xEE,
+    0xF1, 0xE9, 0x63, 0x0B, 0xDF, 0x90, 0x91, 0xA8, 0x4E, 0xC9, 0x92, 0x9E, 0xC3, 0x03, 0xE4, 0xD2,
+    0xCE, 0xE1, 0xBC, 0xC8, 0x05, 0xC3, 0xF4, 0x45, 0x1E, 0xDB, 0xD8, 0x95, 0x01, 0x93, 0xEC, 0xF0,
+    0x55, 0x84, 0xB6, 0xA3, 0xFB, 0xB2, 0x08, 0x46, 0xF4, 0xFF, 0x41, 0x21, 0x4B, 0xFA, 0xFF, 0x8E,
+    0x61, 0x9E, 0xAB, 0x15, 0xB9, 0x92, 0xCC, 0x60, 0xC0, 0x5C, 0x58, 0x09, 0x16, 0x24, 0x32, 0x98,
+    0x16, 0xF2, 0x17, 0xEB, 0x88, 0x2B, 0x4A, 0x65, 0x8E, 0x82, 0xB1, 0xA3, 0x54, 0xE5, 0x41, 0xE9,
+    0xCB, 0x71, 0xDC, 0xD4, 0x88, 0x7F, 0x2A, 0xB2, 0x1E, 0x99, 0x30, 0x87, 0xC0, 0x3C, 0x56, 0x67,
+    0x81, 0xAF, 0x53, 0x04, 0xF4, 0xF7, 0xCA, 0x59, 0x31, 0x32, 0x8F, 0x0B, 0xF6, 0x1D, 0xF5, 0x15,
+    0x62, 0x8D, 0x2B, 0xF4, 0x26, 0xB4, 0xEE, 0x55, 0xD2, 0xD9, 0x44, 0x13, 0x59, 0x9F, 0x12, 0xA3,
+    0x4F, 0x8E, 0xB6, 0x10, 0xE6, 0x13, 0x74, 0xAF, 0xD1, 0x42, 0x9A, 0x4C, 0x81, 0xC0, 0xBE, 0x28,
+    0x4F, 0xCC, 0xB8, 0x7D, 0x62, 0xAA, 0x10, 0xD6, 0x3B, 0x90, 0x05, 0x7F, 0x78, 0xDB, 0xA4, 0x45,
+    0x7E, 0x87, 0xBB, 0x4B, 0xB9, 0x39, 0x66, 0x94, 0xB1, 0xEE, 0xD8, 0xE0, 0x9C, 0xF0, 0x82, 0x19,
+    0xD8, 0x05, 0x24, 0x45, 0xDC, 0xC8, 0xC0, 0x55, 0xDE, 0x90, 0xB9, 0xFD, 0x89, 0x4F, 0x8B, 0x55,
+    0x1F, 0x70, 0xF7, 0xE8, 0x3B, 0x70, 0xB7, 0x0E, 0xEE, 0x76, 0x21, 0x8D, 0x97, 0xAE, 0x1B, 0x8A,
+    0xCC, 0x60, 0x6B, 0x4A, 0x3E, 0x73, 0x94, 0xDF, 0xA3, 0xA3, 0x6D, 0xF7, 0x68, 0x1E, 0xF4, 0x2E,
+    0x07, 0x57, 0x66, 0x4E, 0x00, 0xDC, 0xA8, 0xB9, 0xC7, 0x59, 0x64, 0x7F, 0xDC, 0xF1, 0x05, 0x42,
+    0x44, 0x53, 0x86, 0x13, 0xA5, 0x3F, 0x5D, 0x07, 0x1A, 0xBE, 0xC8, 0x58, 0x24, 0xAD, 0xCC, 0x85,
+    0x73, 0x31, 0x19, 0x57, 0x95, 0xD0, 0xD2, 0x5D, 0xA0, 0x4E, 0x0D, 0xCD, 0x7A, 0x0B, 0x1D, 0xFD,
+    0x34, 0x6D, 0x9E, 0x2E, 0xE4, 0x9F, 0xC8, 0xAF, 0x2F, 0x40, 0x9F, 0x8A, 0x6D, 0xD1, 0x0D, 0xA9,
+    0xF7, 0x82, 0x81, 0xB6, 0x11, 0x91, 0x3F, 0x92, 0x0C, 0x9E, 0x77, 0xF8, 0x83, 0x47, 0xCE, 0x86,
+    0x04, 0xED, 0x52, 0x06, 0xA6, 0x58, 0x44, 0xC6, 0x39, 0x35, 0xF6, 0x14, 0xE9, 0xCB, 0x70, 0x76,
+    0xE0, 0xDC, 0x88, 0x47, 0xA5, 0xF0, 0x46, 0x8C, 0xC3, 0x56, 0x08, 0xC1, 0x1D, 0x76, 0xAF, 0xA2,
+    0x3D, 0x2E, 0xB1, 0x7E, 0x79, 0xFC, 0x02, 0x6F, 0x63, 0x96, 0xA2, 0x04, 0xAE, 0x79, 0x39, 0x92,
+    0x99, 0x80, 0x51, 0x95, 0x6E, 0xA9, 0x0A, 0x7D, 0x42, 0xFA, 0xB9, 0x7A, 0x9E, 0x19, 0x60, 0xFA,
+    0x69, 0x9B, 0x30, 0x6F, 0xA9, 0x4B, 0xFE, 0xEA, 0xB9, 0xF7, 0xFF, 0xEA, 0xF9, 0xFA, 0xFA, 0xFA,
+    0x47, 0x74, 0x51, 0x79, 0x9B, 0x97, 0x87, 0x10, 0x26, 0x96, 0xB7, 0xA6, 0xFE, 0xC3, 0xC2, 0xD1,
+    0xB1, 0x81, 0x0A, 0xC4, 0x27, 0x87, 0x54, 0xF9, 0x6A, 0xE3, 0x3A, 0x2F, 0xA2, 0x08, 0x6F, 0x3C,
+    0xA6, 0x24, 0xFD, 0x40, 0x19, 0x66, 0xB6, 0x89, 0x18, 0xA1, 0x09, 0x5C, 0x9A, 0x15, 0x71, 0x8D,
+    0xF7, 0x80, 0x21, 0x56, 0x44, 0xD9, 0x68, 0x68, 0xAD, 0xDB, 0x3A, 0x0A, 0xCC, 0x84, 0x9E, 0xB3,
+    0x03, 0xA7, 0xB1, 0x04, 0x61, 0x97, 0xD6, 0xE4, 0xB7, 0xB6, 0x4B, 0x48, 0xA1, 0x2B, 0xC9, 0x47,
+    0xD7, 0x4B, 0x73, 0xB3, 0xED, 0x42, 0x83, 0x2C, 0x0F, 0x9D, 0x1E, 0x94, 0xA7, 0x05, 0xF5, 0x87,
+    0xDE, 0xDB, 0xE9, 0x41, 0xC1, 0xDA, 0x8F, 0x98, 0xF9, 0xF4, 0x3F, 0xEF, 0x53, 0xF5, 0x23, 0xA6,
+    0x9E, 0xB9, 0xA7, 0xAE, 0x16, 0x7E, 0xC4, 0xAB, 0xA6, 0xC3, 0x1B, 0xCF, 0x92, 0x85, 0xB5, 0x69,
+    0x88, 0x9F, 0x56, 0x30, 0xBB, 0x64, 0x71, 0x2E, 0x3E, 0xA9, 0x8E, 0xD9, 0x14, 0x57, 0x13, 0x1D,
+    0x8C, 0x2B, 0xA8, 0xBF, 0xB9, 0xE7, 0xA1, 0xC1, 0x20, 0x81, 0x28, 0xC7, 0x50, 0xBF, 0xF1, 0xF3,
+    0xB6, 0x41, 0xBF, 0x43, 0xAA, 0x1F, 0x40, 0xFE, 0xCA, 0xCF, 0x8B, 0x16, 0x7B, 0x1D, 0xA3, 0x8A,
+    0x41, 0x7B, 0x8C, 0x88, 0xB0, 0xE0, 0x2D, 0x75, 0x24, 0xB8, 0xFE, 0x8C, 0xF8, 0x61, 0x65, 0x36,
+    0x9C, 0x50, 0xDB, 0x45, 0x77, 0x17, 0xCF, 0xAC, 0xFC, 0x51, 0x47, 0xE7, 0xD1, 0xBD, 0x81, 0xBF,
+    0x72, 0xF9, 0xC4, 0x74, 0x2E, 0x3D, 0x65, 0xD6, 0x45, 0xE6, 0x6C, 0x76, 0x5B, 0x63, 0x7D, 0x07,
+    0xCA, 0x55, 0x27, 0xF1, 0x6C, 0x63, 0xE6, 0x0B, 0x6A, 0xF5, 0xA1, 0x6D, 0x70, 0x8C, 0xC7, 0x2D,
+    0x2C, 0xE2, 0xD8, 0x6A, 0x61, 0x79, 0x1C, 0xD1, 0xE7, 0x0D, 0x2C, 0x51, 0xEC, 0x21, 0x7C, 0x34,
+    0xC6, 0xE0, 0xC3, 0xF6, 0xDA, 0x19, 0x75, 0x88, 0x25, 0xF6, 0xC7, 0x9E, 0x55, 0xBD, 0x7A, 0xEB,
+    0x18, 0x98, 0x34, 0x1E, 0xC3, 0x5A, 0x03, 0x27, 0x97, 0xDF, 0xA7, 0xD1, 0x32, 0x7A, 0x9B, 0x41,
+    0x51, 0x67, 0x3F, 0x3B, 0x77, 0xD1, 0x55, 0x61, 0x59, 0xE0, 0xEC, 0xDA, 0xBF, 0xB5, 0x55, 0x4F,
+    0x68, 0x1C, 0x55, 0x18, 0xFF, 0xCD, 0xBC, 0xAC, 0xD3, 0x38, 0x69, 0x5E, 0x0E, 0x2B, 0x54, 0x88,
+    0x9D, 0x08, 0xF5, 0x12, 0x6C, 0x26, 0x07, 0x0F, 0x11, 0x36, 0xFB, 0x9E, 0xCD, 0xA1, 0x87, 0x5E,
+    0x8A, 0x24, 0xE2, 0x41, 0xB0, 0xE0, 0xAD, 0xA7, 0x05, 0x23, 0xAC, 0x90, 0x66, 0x46, 0x04, 0x11,
+    0x7A, 0x08, 0xFE, 0x39, 0x4B, 0x44, 0x84, 0xD2, 0x8B, 0x45, 0x72, 0xC8, 0x61, 0x93, 0x7D, 0x52,
+    0xA4, 0x87, 0x1E, 0x3A, 0x69, 0x41, 0x0F, 0x0A, 0x0E, 0xAD, 0xD0, 0xA3, 0xAF, 0xED, 0x14, 0xA7,
+    0xF6, 0xED, 0x3E, 0xBF, 0xB7, 0x3B, 0xAC, 0x1B, 0xF5, 0x50, 0x91, 0xCE, 0xF2, 0x7B, 0xC3, 0x3E,
+    0xF6, 0xFB, 0xBE, 0xDF, 0xF7, 0x7B, 0xBF, 0xEF, 0x2D, 0x00, 0x30, 0x39, 0x0B, 0x0E, 0x0D, 0x6E,
+    0x81, 0x30, 0xC7, 0xDF, 0x9E, 0x1E, 0xC2, 0x07, 0x05, 0xA2, 0x1B, 0x0A, 0x89, 0x80, 0x67, 0x0C,
+    0x82, 0x07, 0x1A, 0xD1, 0x96, 0xC2, 0x26, 0x7D, 0x2D, 0x0D, 0xD8, 0x6D, 0x8A, 0xBC, 0xA8, 0xD0,
+    0x8C, 0xE1, 0x15, 0x7B, 0x08, 0x6F, 0xF6, 0x90, 0x9C, 0xB6, 0xD6, 0x70, 0x6B, 0x75, 0x6C, 0xAD,
+    0x8C, 0x6C, 0x51, 0x65, 0xCA, 0x02, 0x5F, 0x35, 0x98, 0x55, 0x7E, 0x39, 0x4A, 0xAE, 0x71, 0x3F,
+    0x63, 0xD7, 0x25, 0x3F, 0x89, 0xC6, 0x2E, 0xEE, 0xE5, 0xEC, 0x5A, 0xCA, 0xDF, 0xC6, 0x9E, 0xF8,
+    0xA6, 0xB0, 0xF6, 0xA6, 0xB5, 0xA7, 0xFA, 0xCB, 0x08, 0x32, 0x60, 0x51, 0x01, 0x57, 0x81, 0xB1,
+    0xB8, 0xEA, 0x11, 0xD2, 0x33, 0xFF, 0xE4, 0x77, 0x67, 0xC4, 0x0F, 0x65, 0x67, 0xC4, 0xEF, 0x42,
+    0x2C, 0xFD, 0xA2, 0x8B, 0xE8, 0xC0, 0x5A, 0xCB, 0x88, 0x5F, 0x68, 0x6D, 0x16, 0xD8, 0xDE, 0x30,
+    0xD1, 0x36, 0x26, 0x17, 0x5D, 0x99, 0x1F, 0xA9, 0x87, 0xFF, 0x40, 0xAE, 0x8E, 0x1A, 0x16, 0x48,
+    0xBB, 0x26, 0x22, 0xBC, 0x84, 0xE7, 0x0F, 0x93, 0xBB, 0x84, 0x67, 0xB6, 0x85, 0xF4, 0x0D, 0xCF,
+    0x90, 0x30, 0xA2, 0xA4, 0x88, 0x9A, 0x76, 0x9A, 0x71, 0xE2, 0xE6, 0x36, 0x52, 0x12, 0x2F, 0x8F,
+    0x89, 0x64, 0x48, 0xEA, 0xF9, 0xB4, 0x21, 0x49, 0xBE, 0x2C, 0x56, 0x41, 0x11, 0x10, 0x3F, 0x10,
+    0x4F, 0x38, 0x01, 0x3D, 0xC2, 0x28, 0xA9, 0xA7, 0xB1, 0x1B, 0x2A, 0x96, 0x2F, 0xE0, 0xB8, 0x1C,
+    0x2F, 0xC6, 0xE9, 0x13, 0xCA, 0x31, 0xA4, 0x1C, 0xC1, 0x10, 0x32, 0x50, 0xB1, 0x64, 0x7F, 0x58,
+    0x49, 0x5D, 0x4B, 0xDF, 0x25, 0xEB, 0x6E, 0xC9, 0x79, 0x78, 0x97, 0xFE, 0x9F, 0x72, 0x8F, 0x9C,
+    0x71, 0x80, 0x59, 0x2A, 0xFE, 0x1E, 0xA1, 0xF3, 0x84, 0x92, 0xF9, 0xCA, 0x85, 0xE4, 0x54, 0x0F,
+    0x38, 0x3B, 0x4C, 0x41, 0xE7, 0xE8, 0x16, 0xF6, 0x8B, 0x5B, 0x97, 0xC2, 0x43, 0x22, 0x32, 0xE7,
+    0x47, 0x47, 0x02, 0x44, 0x83, 0x16, 0x5F, 0x5F, 0x70, 0x1B, 0xCA, 0x59, 0xA1, 0xC9, 0xB4, 0xAF,
+    0xBD, 0x22, 0x54, 0x3C, 0xE3, 0x2A, 0x92, 0x5D, 0x25, 0x68, 0xCB, 0xBE, 0x56, 0xC2, 0xC4, 0x36,
+    0xCC, 0x98, 0xEE, 0xED, 0x09, 0x84, 0x3F, 0xDD, 0xA3, 0xC6, 0xA2, 0xEE, 0x87, 0x8F, 0x73, 0x08,
+    0x62, 0x2E, 0x61, 0x75, 0x44, 0xBA, 0x5B, 0x29, 0x34, 0x42, 0x83, 0x6E, 0x8A, 0x28, 0x47, 0xE5,
+    0x82, 0x20, 0xA5, 0xD4, 0xE4, 0xB7, 0xA5, 0x75, 0x20, 0x9D, 0x1C, 0x71, 0x58, 0x05, 0xEA, 0xD4,
+    0x5E, 0x63, 0x03, 0xD8, 0x58, 0x06, 0x76, 0x9B, 0x81, 0x2A, 0x62, 0x9E, 0xEB, 0x48, 0x3C, 0xD4,
+    0xE4, 0xF2, 0x9C, 0x90, 0x85, 0xA6, 0xAB, 0x58, 0x29, 0x14, 0xD3, 0x51, 0x0A, 0x9F, 0xF2, 0x84,
+    0x94, 0xE7, 0x85, 0x2B, 0xC0, 0x15, 0xEA, 0x76, 0xEC, 0xA4, 0x9A, 0xA4, 0x54, 0x24, 0x51, 0x70,
+    0xE5, 0xEB, 0x20, 0x0B, 0x88, 0x25, 0x57, 0x5E, 0x49, 0x31, 0x86, 0x34, 0xD8, 0xDF, 0x27, 0x29,
+    0x48, 0x97, 0x98, 0xBA, 0xE3, 0x7A, 0x38, 0x8C, 0x0E, 0xBC, 0x42, 0x54, 0x21, 0x26, 0x9C, 0x20,
+    0x32, 0xF0, 0x7E, 0x03, 0xCD, 0xD4, 0x04, 0x66, 0x46, 0xF9, 0x77, 0xD0, 0x68, 0xA0, 0xB1, 0x80,
+    0x36, 0x47, 0x11, 0xA6, 0x45, 0x70, 0xA0, 0xD9, 0x7D, 0xED, 0xFD, 0x9E, 0xC3, 0x92, 0x0B, 0x15,
+    0x84, 0x42, 0x9C, 0x22, 0x96, 0xA4, 0xB8, 0xD7, 0x77, 0xB5, 0x44, 0x8E, 0x79, 0x0A, 0x3B, 0x5B,
+    0xA3, 0x13, 0xE7, 0x12, 0x26, 0xA2, 0x89, 0xA2, 0x5F, 0xE0, 0x29, 0x30, 0xC6, 0x2B, 0x18, 0xDA,
+    0x85, 0x3B, 0xA9, 0xE5, 0xE1, 0x61, 0x21, 0x0D, 0x8D, 0xEF, 0x1C, 0x9F, 0x58, 0x4B, 0x87, 0x1D,
+    0xE9, 0x61, 0xBE, 0x01, 0x8A, 0x0A, 0x65, 0x05, 0x33, 0x86, 0x9E, 0x0B, 0x5D, 0x5B, 0x23, 0x5B,
+    0x5A, 0x4D, 0x30, 0xC2, 0x3A, 0x83, 0x87, 0xAE, 0x18, 0x39, 0x6D, 0xFA, 0x70, 0x89, 0x52, 0x58,
+    0x0D, 0x67, 0x66, 0xB7, 0x94, 0xA4, 0x84, 0x5B, 0x94, 0xD7, 0xBF, 0x7C, 0xC6, 0xDA, 0x98, 0xAE,
+    0x02, 0xDF, 0xB1, 0x34, 0x95, 0x1F, 0x6B, 0x63, 0x0C, 0x29, 0xAB, 0x26, 0xD7, 0x1B, 0xCF, 0x31,
+    0x84, 0x13, 0xD2, 0x29, 0x39, 0x44, 0x56, 0x21, 0xAF, 0xA0, 0xC7, 0x40, 0xAC, 0x45, 0x6F, 0x6D,
+    0x95, 0x9A, 0xB3, 0x57, 0x2B, 0x86, 0x3D, 0xBA, 0x34, 0x68, 0x88, 0x69, 0xE4, 0xC5, 0xA8, 0x00,
+    0xB3, 0x7D, 0x4E, 0x03, 0x4F, 0x96, 0x71, 0x17, 0x00, 0xF6, 0x9D, 0x84, 0xB4, 0x68, 0x24, 0x97,
+    0x3F, 0xB5, 0xF6, 0xBA, 0xEB, 0x68, 0x31, 0x20, 0xCD, 0xCE, 0xB8, 0xDA, 0x4F, 0x5B, 0xBC, 0x09,
+    0xE0, 0xE5, 0x00, 0x27, 0x49, 0xA8, 0x81, 0xC9, 0x9E, 0x54, 0xBC, 0x20, 0xDF, 0xBC, 0xA5, 0x38,
+    0xDA, 0x5E, 0x1E, 0xA4, 0xC7, 0xD1, 0xF6, 0xF3, 0x30, 0x8D, 0xD1, 0xF1, 0x75, 0xA8, 0xE8, 0x85,
+    0x36, 0x99, 0xD5, 0x0D, 0xEE, 0xD1, 0xD9, 0xC6, 0xBA, 0x1B, 0x72, 0x6A, 0xBE, 0xB1, 0xBE, 0xC4,
+    0xE4, 0x72, 0xED, 0xDD, 0xC9, 0x2F, 0x7F, 0xDE, 0xA6, 0xE9, 0xAA, 0x9D, 0xDF, 0x1E, 0x90, 0x07,
+    0x9E, 0x7B, 0x63, 0xC5, 0x5D, 0x7F, 0x83, 0x67, 0x0A, 0x5F, 0xA5, 0xEB, 0x89, 0x09, 0x4A, 0x6C,
+    0x74, 0x7A, 0xAB, 0x1B, 0xE1, 0x45, 0x65, 0x7A, 0xFC, 0x7B, 0xB9, 0x1A, 0xCB, 0x56, 0x6B, 0x6E,
+    0xBE, 0x7E, 0xFE, 0x98, 0x19, 0x5C, 0x89, 0x3B, 0x31, 0xF8, 0x4A, 0x3E, 0xBC, 0xBA, 0x97, 0xD8,
+    0xCA, 0x35, 0x29, 0x24, 0x73, 0x26, 0x6E, 0x63, 0x99, 0x0A, 0x37, 0xA9, 0x74, 0x3C, 0x38, 0xC6,
+    0x15, 0xF2, 0xAD, 0xE1, 0x6A, 0x4F, 0x6C, 0xDD, 0xD2, 0x66, 0x33, 0x96, 0xE2, 0x54, 0xB5, 0x51,
+    0x0B, 0x92, 0xA0, 0x36, 0xD7, 0x4A, 0x5A, 0x73, 0x9B, 0x5F, 0x3F, 0xDB, 0xCD, 0x29, 0x70, 0x1A,
+    0x2C, 0x9D, 0x9A, 0x3A, 0xD6, 0xC2, 0xC4, 0x47, 0xD3, 0xEE, 0x9A, 0x3A, 0xB0, 0xA4, 0x6B, 0x76,
+    0x62, 0xC2, 0xF7, 0x7F, 0x9D, 0x73, 0x6C, 0x3F, 0xB3, 0x7D, 0xCA, 0x58, 0x27, 0x5A, 0xF5, 0xDA,
+    0x69, 0x65, 0x3A, 0xFC, 0x46, 0x66, 0x2A, 0x42, 0xF1, 0x20, 0xBB, 0x90, 0x33, 0x47, 0x58, 0x7A,
+    0x84, 0xD1, 0x44, 0x31, 0xE6, 0x29, 0x21, 0x65, 0xFD, 0xCE, 0x17, 0xEF, 0xE7, 0xC9, 0xA3, 0xEC,
+    0x2E, 0x71, 0x1B, 0x67, 0xE9, 0x65, 0x64, 0xBA, 0xDB, 0x2A, 0x73, 0xB3, 0xF1, 0x97, 0x20, 0x4E,
+    0x73, 0x35, 0x7C, 0x7D, 0xB7, 0x26, 0xC7, 0xF7, 0xE9, 0xDF, 0x21, 0xB1, 0x7A, 0xE6, 0x93, 0xB7,
+    0xD0, 0x7A, 0x55, 0xDD, 0xB5, 0x29, 0x92, 0x87, 0xE9, 0x0F, 0xEC, 0xCD, 0xA3, 0x49, 0x31, 0x7F,
+    0xEE, 0xE3, 0xD7, 0x5F, 0xFC, 0xFC, 0x03, 0x4C, 0xA5, 0x6A, 0xE7, 0x9D, 0xB1, 0x5C, 0xE7, 0xBE,
+    0x4D, 0xF1, 0xEF, 0xCF, 0x9F, 0xAD, 0x54, 0x4D, 0x8C, 0x14, 0x45, 0x14, 0xFE, 0x7A, 0x4A, 0xB6,
+    0x03, 0x1D, 0x28, 0x0E, 0x7A, 0x42, 0x68, 0x0E, 0x7B, 0x50, 0x64, 0xB7, 0x3D, 0x70, 0x58, 0x93,
+    0x9D, 0xE9, 0x0E, 0x1C, 0x3C, 0x70, 0x70, 0x0F, 0xAC, 0x24, 0x7A, 0xD0, 0x33, 0x07, 0x21, 0x71,
+    0x0F, 0x63, 0x32, 0x3B, 0xDD, 0x9E, 0x4C, 0xF4, 0xB0, 0x9B, 0x18, 0xEF, 0x12, 0x63, 0x02, 0xC3,
+    0x01, 0x0E, 0x1C, 0x38, 0x00, 0xD3, 0x40, 0x94, 0x18, 0x0F, 0x74, 0x62, 0x8C, 0x07, 0x63, 0x6C,
+    0x7F, 0x88, 0x09, 0x5E, 0x8A, 0xD0, 0x9B, 0xF4, 0x6E, 0x7A, 0xE6, 0xF1, 0x55, 0xCD, 0x2C, 0x2E,
+    0x6A, 0x8C, 0x26, 0xD6, 0x6C, 0xD5, 0x56, 0x55, 0xBF, 0xF7, 0xEA, 0xBD, 0xEF, 0x7D, 0xEF, 0x61,
+    0x01, 0x7E, 0x82, 0x2B, 0xD8, 0x07, 0x37, 0x7A, 0xC1, 0x47, 0x79, 0x33, 0xD2, 0x5F, 0x24, 0xA7,
+    0xD2, 0xCD, 0xE2, 0x37, 0x95, 0x61, 0xD7, 0x99, 0x8F, 0x65, 0x8C, 0xE9, 0x78, 0xFD, 0x62, 0x2C,
+    0x25, 0xB0, 0xA0, 0xED, 0xAF, 0xAB, 0xBB, 0xE1, 0xB3, 0xBB, 0xE0, 0xC9, 0x97, 0x97, 0x93, 0x36,
+    0x2A, 0x2F, 0xA1, 0xC0, 0x61, 0xBC, 0x8C, 0xC3, 0x73, 0x9F, 0xBC, 0xFB, 0xD5, 0xF9, 0x1F, 0xCE,
+    0x37, 0xAD, 0x44, 0xC1, 0xC7, 0x33, 0xBC, 0x0E, 0x38, 0x55, 0x01, 0x78, 0x15, 0x0E, 0xFC, 0x8A,
+    0x17, 0x3A, 0x41, 0xAE, 0xCF, 0xA2, 0x7F, 0xF2, 0xDE, 0xDD, 0xE3, 0xC3, 0xAC, 0x45, 0x83, 0xA8,
+    0x27, 0xF6, 0xC3, 0x62, 0xF7, 0xE2, 0xCA, 0xBE, 0xEE, 0xA1, 0x83, 0x2B, 0x7E, 0x33, 0xBD, 0x29,
+    0x77, 0x2F, 0xB6, 0xF7, 0xAE, 0x04, 0xD3, 0x23, 0xE6, 0x96, 0x70, 0x32, 0xB3, 0x9B, 0xD9, 0xD9,
+    0xFD, 0xFB, 0xF9, 0xEF, 0x43, 0xCE, 0xFC, 0x3D, 0xF8, 0x19, 0xCE, 0x5C, 0x04, 0xCE, 0xCA, 0x7A,
+    0x6B, 0x1D, 0xC1, 0x71, 0xBA, 0x32, 0xCB, 0xE9, 0x6D, 0xFB, 0x8D, 0x57, 0x7C, 0xE1, 0x28, 0x97,
+    0x97, 0x97, 0x4F, 0xDB, 0xE7, 0x90, 0x60, 0x06, 0xD0, 0x09, 0x34, 0x03, 0x4C, 0x9C, 0x04, 0x05,
+    0xDE, 0x1A, 0x5C, 0xE8, 0xC2, 0x2B, 0xAD, 0xB1, 0x43, 0x40, 0x2A, 0x0F, 0xB7, 0x06, 0x1F, 0xB8,
+    0x2D, 0x6F, 0x8D, 0x13, 0x90, 0x51, 0x2A, 0x15, 0x85, 0x17, 0x03, 0x98, 0x39, 0xA7, 0xE6, 0x89,
+    0x7C, 0xF7, 0x60, 0x30, 0x91, 0x71, 0x9A, 0xA1, 0x34, 0xFD, 0xC1, 0xF9, 0x6D, 0x23, 0x3D, 0x27,
+    0xE0, 0x34, 0x77, 0x2D, 0xBF, 0xF1, 0xA9, 0x16, 0x8B, 0xA5, 0xB1, 0x16, 0xE0, 0xDE, 0x77, 0xA8,
+    0xC0, 0x9A, 0x6C, 0x3F, 0xC7, 0x0B, 0xA9, 0xA1, 0xAA, 0x20, 0x27, 0x1C, 0x15, 0xDA, 0xD4, 0xD7,
+    0x50, 0x99, 0xCA, 0x51, 0x52, 0xE5, 0x1A, 0xDA, 0xAA, 0xA1, 0x4A, 0xED, 0xD0, 0x3C, 0x86, 0x56,
+    0xCE, 0xAF, 0x4F, 0x0F, 0x91, 0x47, 0x0F, 0x06, 0x6B, 0xCE, 0x76, 0x65, 0x0D, 0xD3, 0x7E, 0xDB,
+    0x6D, 0x4B, 0x84, 0x19, 0xFA, 0xF0, 0x6A, 0xF8, 0xDC, 0xE6, 0x40, 0x54, 0xC1, 0xDF, 0x6A, 0xB0,
+    0x8A, 0x1E, 0xC5, 0xAE, 0x85, 0x74, 0xE9, 0xEA, 0xC4, 0x15, 0x2D, 0x0D, 0x62, 0x31, 0xD6, 0x45,
+    0x6A, 0x41, 0x97, 0xDE, 0xCD, 0x48, 0xA4, 0x8A, 0x45, 0xF2, 0x54, 0x46, 0x88, 0xC4, 0x61, 0x8F,
+    0x03, 0xB2, 0x4E, 0xB1, 0x0A, 0xD1, 0xD6, 0x05, 0xE8, 0x62, 0x9A, 0x5B, 0x1B, 0x56, 0xC7, 0x26,
+    0x7B, 0xBC, 0x0E, 0x0C, 0x29, 0x39, 0x43, 0x0D, 0x78, 0x43, 0x7E, 0xB3, 0xD9, 0xF4, 0x24, 0x59,
+    0x82, 0x14, 0xA9, 0x88, 0x89, 0x27, 0x26, 0xAB, 0x96, 0xD0, 0x8E, 0x1D, 0x47, 0xF4, 0x1D, 0xD3,
+    0x44, 0xC1, 0x6D, 0x73, 0x7D, 0xB2, 0xE8, 0x6F, 0xAA, 0x51, 0xBC, 0x56, 0x76, 0xD4, 0x9D, 0x72,
+    0x35, 0x0E, 0x7E, 0x5A, 0x5A, 0xDE, 0x0E, 0x71, 0x4F, 0x06, 0x82, 0x90, 0x73, 0x21, 0x4A, 0xD7,
+    0xFF, 0x66, 0x19, 0x59, 0x7F, 0xB8, 0x94, 0x70, 0xA4, 0x55, 0x25, 0x83, 0xEE, 0x33, 0x7C, 0xBF,
+    0x24, 0xF7, 0x56, 0x11, 0x26, 0x7E, 0xD1, 0xAA, 0x28, 0x1A, 0x51, 0xB8, 0x65, 0xDC, 0x46, 0xE7,
+    0xCA, 0xA8, 0x3A, 0x1E, 0x69, 0x51, 0x82, 0xCF, 0xA1, 0x44, 0x98, 0x97, 0xAD, 0x4B, 0x74, 0x7B,
+    0x01, 0x2B, 0x60, 0x61, 0x1C, 0xA4, 0x9D, 0x8C, 0x45, 0x82, 0xC2, 0xBB, 0x9F, 0x10, 0xFA, 0x54,
+    0x92, 0xBD, 0x38, 0xE8, 0x19, 0x3F, 0xF1, 0x13, 0xED, 0x15, 0x5E, 0xA1, 0xF2, 0x73, 0xCC, 0x8F,
+    0x39, 0x8A, 0x79, 0xF4, 0x34, 0x82, 0xDF, 0xC7, 0x3A, 0x67, 0x68, 0x7E, 0x81, 0xE1, 0xB4, 0x72,
+    0xF6, 0xDB, 0x2A, 0xB8, 0x6A, 0x0D, 0xFD, 0x65, 0x39, 0xE4, 0x96, 0x53, 0x04, 0x4C, 0xA4, 0xB8,
+    0x39, 0xB8, 0x89, 0xCA, 0xDE, 0x2D, 0xDA, 0xE5, 0xE8, 0x93, 0xA5, 0x77, 0x15, 0xE1, 0xA5, 0x86,
+    0x8B, 0x18, 0xBB, 0x64, 0x04, 0x6F, 0xA4, 0xAC, 0xC2, 0x91, 0xD3, 0xF7, 0x4F, 0x4D, 0x50, 0x77,
+    0x44, 0x6A, 0x6F, 0x6F, 0x3A, 0xC3, 0xDC, 0x06, 0x42, 0x16, 0x67, 0x4C, 0xBA, 0x21, 0x87, 0xFA,
+    0xA4, 0x85, 0x5F, 0xEE, 0xDC, 0x0C, 0xB9, 0x09, 0x8C, 0x6F, 0x37, 0xAB, 0x96, 0x4E, 0xD8, 0x4B,
+    0xC5, 0x2B, 0x34, 0x90, 0xEF, 0x24, 0x55, 0xCB, 0xE8, 0x3C, 0xC8, 0x6F, 0x20, 0x22, 0x75, 0xEA,
+    0x18, 0xEA, 0xE7, 0x0A, 0x7A, 0x2D, 0x47, 0xE7, 0x06, 0xF9, 0x56, 0xF2, 0x0D, 0x96, 0x28, 0x29,
+    0x99, 0x1A, 0xE6, 0xD7, 0x20, 0xF8, 0xD1, 0x20, 0x0A, 0x0D, 0x9A, 0xC8, 0x28, 0x13, 0x53, 0x33,
+    0x36, 0xB1, 0xFD, 0x86, 0x29, 0xC9, 0xE7, 0x27, 0x29, 0xDC, 0x1E, 0x2F, 0x3A, 0xC6, 0x28, 0xD3,
+    0xA1, 0x8B, 0x31, 0x74, 0x15, 0x23, 0xE4, 0x8C, 0xAB, 0x08, 0xFD, 0x3A, 0x42, 0x53, 0x47, 0x5E,
+    0x5D, 0x47, 0x27, 0xC8, 0x8C, 0x57, 0xCB, 0x26, 0x7C, 0xED, 0x56, 0x13, 0xAE, 0xBD, 0xDF, 0x84,
+    0x97, 0xBD, 0x26, 0x1C, 0x7B, 0x8D, 0x6E, 0xBC, 0x91, 0xAE, 0x39, 0x8D, 0x37, 0x72, 0x1D, 0xE6,
+    0x98, 0x9F, 0x9C, 0x6B, 0xD1, 0xA5, 0x61, 0xF2, 0xC4, 0x7E, 0x17, 0x73, 0x6D, 0x2C, 0x86, 0x4C,
+    0x4A, 0x72, 0xCD, 0xCF, 0x2B, 0x55, 0x1A, 0x6F, 0xC3, 0x58, 0xB7, 0xD3, 0x12, 0x71, 0x61, 0x2B,
+    0x81, 0x54, 0x8A, 0x32, 0xA4, 0x78, 0x69, 0xCC, 0x67, 0x11, 0x67, 0x98, 0xC5, 0x9E, 0x10, 0xEA,
+    0x6E, 0x8E, 0x87, 0x06, 0x8B, 0x3D, 0xE8, 0x7F, 0x38, 0x88, 0xDC, 0x25, 0x97, 0x2D, 0x62, 0x47,
+    0x5D, 0x4D, 0x7A, 0xF9, 0xB4, 0x08, 0x6C, 0xD2, 0x63, 0x1E, 0xE6, 0x19, 0xB2, 0x7E, 0x87, 0xEC,
+    0xA7, 0x52, 0xAB, 0xE4, 0x81, 0x81, 0xA1, 0x47, 0xC0, 0x3B, 0x2C, 0x70, 0x9D, 0x58, 0x0A, 0xFA,
+    0x85, 0xDA, 0x1A, 0xD4, 0xEC, 0x11, 0x62, 0x09, 0x50, 0xC4, 0x40, 0xC3, 0x52, 0x8D, 0xE9, 0x56,
+    0x50, 0xA6, 0xB2, 0xB9, 0xB1, 0x7C, 0xC2, 0x95, 0x39, 0x2B, 0x7A, 0x73, 0x49, 0x49, 0xA3, 0x93,
+    0x5E, 0x1B, 0x0B, 0x15, 0x1E, 0x15, 0xEA, 0x5E, 0x12, 0xC5, 0x52, 0x8B, 0xDC, 0x66, 0x19, 0xA6,
+    0xE3, 0x64, 0xF5, 0x74, 0xD1, 0xC5, 0x95, 0x2E, 0xCE, 0xD9, 0x3F, 0xCF, 0xA4, 0x92, 0xF5, 0x2F,
+    0x95, 0x5D, 0xF4, 0xBA, 0x68, 0x77, 0xD1, 0xE9, 0xE2, 0x46, 0x2A, 0x0D, 0x7B, 0x57, 0x6A, 0xB9,
+    0xD3, 0x6C, 0x0D, 0x3E, 0x73, 0x66, 0xDB, 0x4F, 0x35, 0x8A, 0x49, 0x77, 0xD8, 0x6E, 0x14, 0x36,
+    0x10, 0x16, 0xB1, 0x62, 0xC3, 0xD2, 0x7C, 0x7F, 0x91, 0x91, 0x91, 0x2B, 0x2A, 0x0F, 0x79, 0xEC,
+    0xED, 0x3C, 0x92, 0x9D, 0x6C, 0xFE, 0x26, 0xFC, 0xF6, 0xCD, 0x82, 0x61, 0xFC, 0xC2, 0xC9, 0x06,
+    0x4D, 0xD0, 0x1D, 0x14, 0xAC, 0x95, 0x8D, 0x1D, 0x5D, 0xB4, 0xB4, 0x5D, 0x34, 0xFC, 0xA3, 0xCD,
+    0x86, 0x4E, 0xC0, 0x75, 0xC8, 0xA4, 0xC5, 0xC6, 0x47, 0x7E, 0x99, 0xC8, 0xB5, 0xA9, 0x9E, 0x85,
+    0xE0, 0x96, 0x21, 0xCB, 0xF4, 0xD7, 0x77, 0x68, 0x29, 0x3A, 0x9B, 0x5A, 0x54, 0xA5, 0x76, 0x36,
+    0x2D, 0x43, 0x6D, 0x73, 0x71, 0xA4, 0xB3, 0x5D, 0xAB, 0x74, 0xED, 0xCF, 0x35, 0x30, 0xBB, 0x5A,
+    0x2C, 0xD9, 0x87, 0x24, 0x65, 0x09, 0x7E, 0xDF, 0x0C, 0x8B, 0x60, 0x1C, 0x19, 0x29, 0x86, 0x66,
+    0x58, 0x48, 0x3E, 0xB3, 0x49, 0x49, 0x8F, 0xE8, 0x5B, 0x54, 0xD9, 0xD6, 0xF3, 0x33, 0x23, 0x8F,
+    0xD2, 0x0C, 0x98, 0x48, 0xD0, 0xA7, 0xF9, 0xB7, 0x5B, 0x1B, 0x36, 0xB5, 0xA3, 0x19, 0xC9, 0xFE,
+    0x47, 0x82, 0x42, 0x25, 0xCF, 0xB3, 0xB4, 0xF8, 0xA6, 0x75, 0x39, 0xCA, 0x9E, 0xEA, 0xDC, 0x44,
+    0x7F, 0x69, 0xF2, 0x4E, 0x30, 0x7D, 0x27, 0xFA, 0xD3, 0x3B, 0xD5, 0xBF, 0x7E, 0xE7, 0x3F, 0x8E,
+    0xC7, 0x8D, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x87, 0x64, 0xA5, 0x2C, 0xF2, 0xB8,
+    0x20, 0x0D, 0x89, 0x6F, 0x29, 0x51, 0x38, 0x67, 0x29, 0x52, 0xB8, 0xD8, 0xBB, 0xDD, 0x84, 0x22,
+    0x05, 0x05, 0x2E, 0x62, 0x24, 0xAA, 0x34, 0x94, 0x08, 0xA7, 0x70, 0xB1, 0x48, 0x6B, 0xEF, 0x3A,
+    0x29, 0x52, 0xA4, 0x48, 0x24, 0x04, 0x4D, 0x1A, 0x1A, 0x24, 0x94, 0xCA, 0x91, 0x52, 0x18, 0xB8,
+    0xF8, 0x26, 0x71, 0xE1, 0xC2, 0x85, 0x57, 0x42, 0x54, 0x91, 0xF0, 0x44, 0x74, 0x09, 0xC2, 0xE3,
+    0x78, 0x4D, 0x36, 0xF1, 0xDE, 0x3D, 0xDE, 0xDC, 0x39, 0x7F, 0x48, 0x08, 0xE6, 0xDE, 0xDB, 0xB9,
+    0x79, 0x3B, 0x3F, 0x6F, 0xBE, 0xF7, 0xDE, 0xB7, 0xBE, 0x8A, 0x11, 0xBA, 0x15, 0x7A, 0x41, 0x21,
+    0x74, 0x03, 0x79, 0xAD, 0x44, 0x37, 0x06, 0x9E, 0x57, 0x10, 0x54, 0x40, 0x36, 0x40, 0xAE, 0xE1,
+    0x90, 0x82, 0xC7, 0x1A, 0xE6, 0x0A, 0xBD, 0x5C, 0x09, 0xD3, 0x57, 0x52, 0x11, 0xAF, 0x24, 0xD5,
+    0xF0, 0x3B, 0x8F, 0x06, 0x56, 0x54, 0xE7, 0xA5, 0xF8, 0x63, 0x29, 0x3A, 0x72, 0x2C, 0x09, 0xCB,
+    0x62, 0x1F, 0x8B, 0x43, 0x2C, 0x02, 0x88, 0xE1, 0xD4, 0x43, 0xC8, 0xDF, 0x1B, 0xE4, 0xD7, 0x57,
+    0xC5, 0x6F, 0x91, 0x91, 0xE9, 0x5E, 0xF9, 0xE3, 0xDE, 0xE6, 0xFA, 0xC6, 0x96, 0x0C, 0x83, 0xA8,
+    0x5B, 0x65, 0xA6, 0x7F, 0xEF, 0xA9, 0x22, 0x7F, 0x5B, 0x54, 0x61, 0x76, 0xB4, 0xB8, 0x6B, 0xE0,
+    0x3E, 0x55, 0xF0, 0xD5, 0x11, 0x60, 0x36, 0x04, 0xEA, 0xD7, 0xB4, 0x79, 0xA1, 0xF1, 0xEB, 0x4A,
+    0xF4, 0xA6, 0x26, 0xCE, 0x0B, 0x1D, 0xC4, 0x85, 0x33, 0xC0, 0x89, 0x61, 0x82, 0x98, 0x1A, 0xC4,
+    0x45, 0xAC, 0xE2, 0x42, 0xD4, 0x41, 0x81, 0xD8, 0x2F, 0xE1, 0xFD, 0x62, 0x78, 0xD7, 0x9A, 0x3D,
+    0xEC, 0x00, 0xFE, 0x56, 0x02, 0x77, 0x4F, 0xB3, 0x81, 0x41, 0xE8, 0x86, 0x3C, 0xE3, 0xFC, 0xF0,
+    0xDB, 0xBE, 0x22, 0x22, 0x13, 0xB0, 0x3A, 0x44, 0x15, 0x8E, 0xD2, 0x0D, 0x1C, 0xB6, 0x9C, 0x1A,
+    0x96, 0x0C, 0x51, 0x86, 0xCE, 0x7F, 0x4A, 0x40, 0x37, 0x3C, 0x22, 0xC7, 0x78, 0x86, 0x17, 0x84,
+    0x90, 0x1F, 0x2B, 0x71, 0x9F, 0x07, 0x7D, 0xAA, 0x43, 0xAA, 0xE5, 0xA3, 0x59, 0xC1, 0x7E, 0x34,
+    0x16, 0x28, 0x48, 0x05, 0x3B, 0x18, 0xF0, 0x20, 0x81, 0x2C, 0x0F, 0x0F, 0x3B, 0x31, 0x44, 0x48,
+    0x46, 0x3E, 0xFB, 0x4C, 0xB0, 0xB3, 0x4B, 0xA3, 0x59, 0x4E, 0x05, 0x30, 0x0E, 0x76, 0x72, 0x7C,
+    0xD8, 0x15, 0x10, 0x43, 0x36, 0xD2, 0x2D, 0xC3, 0x4E, 0xFB, 0xEC, 0x73, 0x48, 0x84, 0xF9, 0x91,
+    0xCB, 0xC7, 0xE7, 0xE6, 0x2E, 0x30, 0x32, 0x03, 0xAB, 0x93, 0x82, 0xB7, 0x7D, 0x43, 0xF5, 0x58,
+    0xBD, 0x7F, 0x51, 0xDF, 0xBC, 0x52, 0x20, 0xC5, 0x74, 0x07, 0x51, 0x80, 0x4C, 0x26, 0xAB, 0x9E,
+    0xAA, 0x84, 0x36, 0xCE, 0xBE, 0x01, 0x69, 0x9B, 0x38, 0x71, 0x89, 0x40, 0x59, 0xEF, 0x18, 0xBE,
+    0x1C, 0x1F, 0x0C, 0x11, 0x57, 0xD6, 0x2D, 0xDB, 0xF8, 0xFE, 0x65, 0x4B, 0xA8, 0xD5, 0x19, 0xA1,
+    0xDA, 0x1F, 0x0A, 0x35, 0xB5, 0xE0, 0xA9, 0xA9, 0x88, 0x53, 0x27, 0xDE, 0x39, 0x68, 0x24, 0x63,
+    0xEB, 0x12, 0xE7, 0x9F, 0xA7, 0xF0, 0x4A, 0xCB, 0x97, 0x7A, 0x2C, 0xC1, 0xBB, 0x8E, 0x81, 0x4C,
+    0xBA, 0xF0, 0x0B, 0x51, 0xF2, 0xDB, 0x1E, 0xFB, 0x2D, 0xD7, 0x0D, 0x9C, 0xE7, 0xF6, 0xE2, 0x0C,
+    0x8A, 0x60, 0xF8, 0xC0, 0xB7, 0x47, 0x9F, 0x97, 0xE4, 0x16, 0xCB, 0x79, 0x85, 0x78, 0xBD, 0x62,
+    0x7F, 0x72, 0x48, 0x2D, 0x8D, 0x34, 0x18, 0xFA, 0x15, 0x42, 0x0B, 0xE9, 0x04, 0x26, 0x44, 0x21,
+    0x0A, 0x03, 0x1D, 0x61, 0x46, 0xF2, 0x40, 0x79, 0x85, 0x71, 0x78, 0x90, 0x06, 0x68, 0x79, 0xCA,
+    0x5B, 0x36, 0x0E, 0x07, 0x2A, 0x0B, 0xE6, 0xE6, 0xCF, 0x13, 0xED, 0x72, 0x42, 0x31, 0xE2, 0xEC,
+    0x48, 0x01, 0x97, 0xD1, 0xC0, 0x19, 0xCC, 0x2C, 0x20, 0x1A, 0x4B, 0x6A, 0x25, 0x4B, 0xD1, 0x8B,
+    0x38, 0x0B, 0x6F, 0x36, 0x01, 0xF5, 0xBC, 0x67, 0x19, 0xF0, 0xBA, 0xC0, 0x31, 0xC7, 0xC4, 0x86,
+    0xCA, 0x64, 0xE0, 0x98, 0x28, 0xF3, 0xD4, 0xAE, 0x91, 0x3C, 0x8C, 0xFC, 0x00, 0xA6, 0x9D, 0x09,
+    0x75, 0xDB, 0x48, 0xF7, 0xD5, 0xB0, 0xB8, 0xBD, 0x7F, 0xF1, 0xD3, 0x75, 0x0E, 0x9F, 0x1C, 0x9D,
+    0x0A, 0x04, 0xF8, 0x8E, 0x51, 0xCA, 0xA4, 0x63, 0x02, 0xA1, 0x78, 0xB5, 0xE1, 0x79, 0x6C, 0x88,
+    0xD8, 0x20, 0x5D, 0x95, 0x0A, 0xB5, 0xD2, 0xE2, 0x85, 0x5E, 0x11, 0xF9, 0x8E, 0x1E, 0x19, 0x8A,
+    0x95, 0xE0, 0x9B, 0xFD, 0xB5, 0x8F, 0x6C, 0xDA, 0xD2, 0x78, 0x8F, 0x16, 0xAB, 0x9F, 0x8C, 0x43,
+    0x3D, 0x6A, 0x3E, 0x31, 0x4C, 0x66, 0x74, 0x27, 0x1C, 0x76, 0xFB, 0xB3, 0x90, 0x1C, 0x42, 0xE3,
+    0x29, 0x89, 0x29, 0x36, 0x6A, 0x46, 0x05, 0xC6, 0xD5, 0xF2, 0xF1, 0x00, 0x1C, 0x18, 0x49, 0xE5,
+    0x24, 0x6F, 0xF0, 0x84, 0xC3, 0x22, 0x37, 0x6D, 0x45, 0x47, 0xFC, 0x68, 0x78, 0xAD, 0xD8, 0xB3,
+    0xA6, 0xAD, 0x39, 0x36, 0xC5, 0x1C, 0xBF, 0x86, 0x37, 0x60, 0x93, 0x97, 0xC8, 0x2D, 0x5E, 0xCF,
+    0xB3, 0x66, 0xD8, 0xE4, 0x6A, 0xB1, 0xF7, 0x9C, 0x12, 0xB9, 0x4D, 0x35, 0xE2, 0x9C, 0x12, 0x0C,
+    0x26, 0xE1, 0x03, 0x2B, 0xF6, 0x60, 0x63, 0x1F, 0xFB, 0xB3, 0x7C, 0xB6, 0xF1, 0xB6, 0x30, 0x65,
+    0xB0, 0x83, 0x09, 0xE3, 0xEE, 0x3C, 0x1E, 0x10, 0x5D, 0xA7, 0x12, 0xF3, 0x1A, 0xF2, 0x51, 0x0D,
+    0xFE, 0xF9, 0x8A, 0xEF, 0x3D, 0xC2, 0xDF, 0xE6, 0x86, 0x64, 0x6F, 0xB9, 0x9A, 0xB9, 0x22, 0x47,
+    0xB7, 0x0A, 0x82, 0x1B, 0x8E, 0x2D, 0x7C, 0x7B, 0xE3, 0x84, 0xF8, 0x98, 0x9C, 0xEB, 0x9D, 0xDB,
+    0x3B, 0x38, 0xCE, 0x35, 0xD2, 0xAF, 0x3D, 0xB5, 0xEA, 0xDF, 0xD3, 0x29, 0xEE, 0xA4, 0x11, 0x82,
+    0x96, 0x84, 0xD8, 0xB8, 0x5A, 0x60, 0xF7, 0xA1, 0xC6, 0xF4, 0xE2, 0x1D, 0xF8, 0x17, 0x87, 0x6C,
+    0xB8, 0xA9, 0xD8, 0xC0, 0xB4, 0xB8, 0x10, 0x2F, 0xAF, 0x4D, 0x71, 0xED, 0x78, 0xBC, 0xCF, 0xD9,
+    0xF2, 0x28, 0x67, 0xD4, 0x09, 0xE2, 0xC3, 0x2A, 0xD7, 0x78, 0x49, 0x04, 0x4E, 0x5A, 0x2F, 0x49,
+    0x91, 0x72, 0x57, 0xC4, 0x49, 0xCA, 0x9C, 0x50, 0x78, 0xC4, 0x94, 0x68, 0xB9, 0xB1, 0x61, 0xEC,
+    0x54, 0x83, 0x46, 0x2A, 0x79, 0x8F, 0xBB, 0x50, 0x05, 0xEB, 0x0D, 0x53, 0x8F, 0x4D, 0xC9, 0x0B,
+    0x82, 0x1A, 0xBF, 0x68, 0x26, 0x90, 0x9D, 0x44, 0xD4, 0x46, 0x14, 0xA1, 0x13, 0x61, 0x31, 0x3C,
+    0x37, 0x94, 0x34, 0xF4, 0xE9, 0x4F, 0x67, 0xED, 0x13, 0xE0, 0x2D, 0xCC, 0x57, 0x82, 0xB4, 0x4C,
+    0x30, 0x0D, 0x30, 0xBC, 0x69, 0xBF, 0xCC, 0xA9, 0xCE, 0x97, 0x07, 0x4B, 0xE8, 0x76, 0x2C, 0x41,
+    0xC5, 0x21, 0x96, 0xE4, 0x41, 0xE3, 0xF1, 0xA5, 0xFB, 0x45, 0x3C, 0xC0, 0xFE, 0x97, 0xA2, 0x68,
+    0x4F, 0xE0, 0x12, 0x17, 0x14, 0x35, 0xE2, 0x51, 0x6F, 0x02, 0xD1, 0x0C, 0x56, 0xB4, 0x58, 0xFF,
+    0xB5, 0x2F, 0xA9, 0xE6, 0x68, 0x9C, 0xBA, 0xF5, 0x35, 0x0D, 0x23, 0x08, 0x85, 0xD1, 0x63, 0xD1,
+    0x56, 0xD2, 0xE8, 0xB1, 0x34, 0xAA, 0xEA, 0x53, 0x3F, 0x70, 0x4D, 0x96, 0x58, 0xE9, 0xC0, 0x67,
+    0x0C, 0x4D, 0x07, 0x72, 0xDC, 0x9D, 0x16, 0xA5, 0x50, 0x1D, 0xD4, 0x42, 0x33, 0xA2, 0x9C, 0x8A,
+    0xCD, 0x34, 0xC4, 0x72, 0x89, 0x05, 0x46, 0xD3, 0xE5, 0x28, 0x9E, 0x2D, 0xDB, 0xB8, 0x94, 0x1E,
+    0x59, 0xED, 0x53, 0xF3, 0xD3, 0xF7, 0x09, 0xA7, 0xC0, 0xEA, 0x88, 0x91, 0x42, 0xAA, 0x18, 0x25,
+    0xA7, 0x3F, 0xCE, 0xB1, 0xC0, 0xD5, 0x19, 0x33, 0xEC, 0x15, 0x8D, 0xCE, 0x69, 0x26, 0xA9, 0xAC,
+    0xE6, 0x40, 0x1D, 0xEC, 0x30, 0x11, 0xD8, 0x84, 0x74, 0xC9, 0x72, 0x0E, 0xD9, 0x34, 0x22, 0xFB,
+    0x87, 0xEC, 0x1F, 0x62, 0xEE, 0x1A, 0x10, 0xE2, 0xCD, 0x8A, 0xC4, 0x20, 0x7C, 0x48, 0xB6, 0x50,
+    0x3F, 0xC7, 0xDB, 0x78, 0x5F, 0x6A, 0x3E, 0xBA, 0x8D, 0xF6, 0x64, 0xD6, 0xAF, 0x72, 0xBB, 0xFB,
+    0x02, 0x07, 0xC9, 0x69, 0x16, 0xC4, 0x1F, 0x0B, 0xF2, 0x8B, 0xB4, 0xD5, 0x4E, 0xA3, 0x76, 0x5A,
+    0x45, 0x5F, 0xE9, 0x28, 0x57, 0x51, 0x9E, 0x44, 0x4B, 0xE8, 0x58, 0xB2, 0xB9, 0x99, 0x58, 0xE8,
+    0xDF, 0xC3, 0xFF, 0x9C, 0x6F, 0x3A, 0xE2, 0xBE, 0x96, 0x01, 0xA2, 0x0A, 0x07, 0x85, 0xD7, 0x20,
+    0xD0, 0xCC, 0x23, 0xEE, 0x63, 0xED, 0x5F, 0xD7, 0x1D, 0xA9, 0x2B, 0x69, 0x8E, 0xCC, 0x09, 0x52,
+    0xE6, 0x52, 0x74, 0x72, 0xC2, 0x13, 0x97, 0x95, 0x5E, 0x39, 0xD3, 0x9E, 0xF2, 0xFD, 0x73, 0x1B,
+    0x6A, 0x65, 0x5C, 0x51, 0x4B, 0x08, 0xCE, 0x36, 0x18, 0x78, 0x95, 0xA8, 0x43, 0x13, 0xEA, 0x9F,
+    0xCB, 0x83, 0xCB, 0xDB, 0x57, 0xB7, 0xFD, 0xF9, 0x6E, 0x6F, 0xBA, 0xFB, 0xC4, 0x54, 0xFD, 0xCD,
+    0xF5, 0x87, 0x83, 0x50, 0x5E, 0x31, 0x4D, 0xD7, 0xBB, 0x52, 0xD5, 0xCC, 0xEB, 0x11, 0xF8, 0x34,
+    0xA6, 0x01, 0xEC, 0x1A, 0xFB, 0x05, 0x09, 0x02, 0x78, 0x1B, 0xCA, 0xD9, 0x67, 0x76, 0xCE, 0x89,
+    0xE6, 0x89, 0x1E, 0x94, 0xCE, 0x5F, 0x15, 0xD6, 0xEE, 0x32, 0x91, 0x3A, 0x6B, 0x89, 0xFF, 0x40,
+    0xB7, 0x6C, 0xFA, 0x73, 0xFA, 0x5A, 0xC6, 0xC9, 0x6C, 0x06, 0x65, 0xF1, 0x5C, 0x1D, 0x90, 0xF1,
+    0x49, 0x3B, 0xC3, 0xE4, 0xF8, 0xDC, 0xEC, 0x8B, 0x8F, 0xD1, 0x3F, 0x24, 0x7B, 0x29, 0x63, 0x4F,
+    0xFF, 0x06, 0x9D, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC7, 0xF1, 0x02, 0x1B, 0x7B,
+    0x82, 0x64, 0x0B, 0x21, 0xEE, 0xBC, 0x0D, 0x45, 0x88, 0xEE, 0xBC, 0x29, 0x5C, 0x9C, 0xC4, 0x5E,
+    0x76, 0x9D, 0x86, 0x82, 0x02, 0x23, 0xC5, 0x54, 0x48, 0xFC, 0x03, 0x88, 0x5C, 0x71, 0xC5, 0x21,
+    0x5D, 0x7C, 0x0B, 0x2E, 0x28, 0xD2, 0x58, 0x42, 0xA2, 0xA2, 0x48, 0x11, 0x9A, 0x34, 0x31, 0x92,
+    0x91, 0x4E, 0xE8, 0x92, 0x1B, 0xE2, 0xC2, 0x05, 0x45, 0xD6, 0x49, 0x81, 0x44, 0xB5, 0x4A, 0x82,
+    0x90, 0x10, 0x92, 0x27, 0xC9, 0x46, 0xD9, 0x44, 0x7B, 0xF7, 0x78, 0xB3, 0x76, 0x7E, 0x10, 0x51,
+    0x31, 0x33, 0x6F, 0x6E, 0x67, 0x6F, 0xF6, 0xBD, 0x37, 0xDF, 0xF7, 0xDE, 0x9B, 0x99, 0x77, 0xB6,
+    0xDC, 0xAB, 0x53, 0x41, 0x8E, 0x8E, 0xD0, 0x52, 0x89, 0x92, 0xA9, 0xA3, 0x0B, 0x6C, 0x47, 0x08,
+    0x55, 0xE6, 0xBB, 0x44, 0x67, 0x89, 0x74, 0x41, 0x49, 0x1B, 0x50, 0x31, 0x5C, 0x0D, 0xC7, 0x00,
+    0x25, 0x9E, 0xB5, 0xF3, 0x99, 0x4F, 0x32, 0xC3, 0x08, 0x5E, 0x8C, 0xDC, 0xEE, 0x18, 0xC2, 0x4B,
+    0x11, 0xFD, 0x2E, 0xA8, 0x70, 0x28, 0xA9, 0xB6, 0x0C, 0x68, 0xBA, 0x10, 0x2E, 0x22, 0xC4, 0xBF,
+    0x46, 0xFB, 0xC5, 0xD8, 0x41, 0x18, 0x22, 0x5C, 0x46, 0x4F, 0x21, 0xF7, 0x92, 0xDC, 0xDD, 0x37,
+    0xF2, 0x81, 0x11, 0x8F, 0x33, 0x50, 0x8A, 0x81, 0x46, 0xA4, 0x11, 0x24, 0x08, 0x62, 0x44, 0x10,
+    0x53, 0x44, 0x25, 0xA2, 0x0C, 0xA7, 0x58, 0xAF, 0x64, 0x5F, 0x88, 0x12, 0x75, 0x40, 0x79, 0x53,
+    0xEA, 0x70, 0x45, 0xEA, 0xDA, 0x69, 0xA9, 0xEB, 0x1D, 0x57, 0xD7, 0x5B, 0xAE, 0x6E, 0x9E, 0xF9,
+    0x60, 0x7F, 0x14, 0x10, 0x95, 0x8A, 0xC8, 0xD8, 0x7D, 0xD6, 0xF7, 0x43, 0x49, 0x0F, 0x45, 0xC4,
+    0x98, 0xC1, 0x8C, 0xD4, 0x0A, 0x3B, 0x5E, 0xAC, 0xF8, 0x9F, 0x87, 0x1A, 0x7E, 0x0A, 0x69, 0xE0,
+    0x4C, 0x20, 0x1E, 0x6B, 0x91, 0x8F, 0x50, 0x28, 0x5D, 0xA2, 0x58, 0xC0, 0x9A, 0x8F, 0xA6, 0xAB,
+    0xBD, 0xD8, 0x38, 0x69, 0x88, 0xAE, 0x42, 0x5D, 0x6A, 0x37, 0x36, 0xE2, 0x70, 0xB1, 0x24, 0xD9,
+    0x04, 0x5B, 0x02, 0x7C, 0xD6, 0x9C, 0x40, 0x6C, 0xC5, 0xAF, 0xA5, 0xB5, 0xC3, 0x9E, 0x85, 0x1B,
+    0x65, 0xF0, 0x3D, 0x6A, 0xDC, 0x1B, 0x0B, 0xC0, 0xC7, 0xC6, 0x97, 0x7B, 0xBA, 0xAF, 0x7C, 0x61,
+    0xC2, 0xBE, 0xD4, 0x3F, 0x1A, 0xE5, 0xEC, 0xE9, 0xD0, 0xF3, 0x61, 0x1A, 0x47, 0xCB, 0x5D, 0x22,
+    0x62, 0x97, 0x4B, 0xDE, 0xBC, 0xD6, 0x77, 0xB5, 0x79, 0x2E, 0x52, 0x6F, 0xFF, 0x87, 0xEC, 0x44,
+    0xBC, 0x9F, 0x65, 0xCA, 0x80, 0x9C, 0x41, 0x05, 0x68, 0x25, 0x0B, 0x0C, 0x92, 0x2A, 0x2A, 0x8F,
+    0x18, 0x27, 0x50, 0x81, 0x70, 0x36, 0x55, 0x08, 0xED, 0x71, 0x8D, 0xA7, 0x23, 0x4A, 0x15, 0x25,
+    0x6C, 0xE3, 0x4D, 0x3E, 0xED, 0xAE, 0x86, 0xA7, 0x80, 0x06, 0xB3, 0xB2, 0x4D, 0x4F, 0x78, 0xD9,
+    0xE4, 0x65, 0x83, 0x39, 0xD9, 0x36, 0xC6, 0xDD, 0xDD, 0xA5, 0xA9, 0xFA, 0x88, 0xB6, 0xDA, 0x27,
+    0x20, 0x63, 0xB4, 0x20, 0x13, 0x3B, 0x51, 0xD6, 0x9A, 0xDD, 0x4B, 0x54, 0x0F, 0x8F, 0x93, 0x60,
+    0x40, 0xBF, 0x51, 0xC6, 0x26, 0xC7, 0x85, 0x1B, 0x8F, 0x80, 0x3E, 0x90, 0x8B, 0x4F, 0x32, 0x56,
+    0x8F, 0x65, 0xE0, 0xD1, 0xBD, 0xF3, 0xDF, 0x50, 0x39, 0x3B, 0x8D, 0x2B, 0xC2, 0x06, 0x69, 0x58,
+    0xF7, 0x36, 0x77, 0x93, 0x46, 0xD8, 0xC1, 0xED, 0x5F, 0x31, 0xDF, 0x32, 0xB8, 0x4B, 0x98, 0x6F,
+    0x1B, 0xDC, 0xBE, 0x98, 0x34, 0x5B, 0x83, 0xAB, 0xBB, 0x9B, 0x94, 0xB7, 0xDC, 0x27, 0xAC, 0x2C,
+    0x9F, 0x73, 0xD2, 0x8E, 0xB7, 0xAA, 0x9B, 0xF2, 0x69, 0x2E, 0x29, 0x6D, 0x7B, 0xAB, 0x59, 0x93,
+    0x99, 0x1A, 0x3A, 0xB7, 0x99, 0x86, 0xD9, 0x18, 0x0E, 0x9B, 0x64, 0x6B, 0x8B, 0x78, 0xD1, 0x16,
+    0x38, 0x1E, 0x62, 0xB5, 0x9A, 0x36, 0xD0, 0xE9, 0x1D, 0x1B, 0x8E, 0xA9, 0xFC, 0xF9, 0x87, 0x98,
+    0x83, 0x75, 0x08, 0x6C, 0x00, 0x01, 0xE5, 0x8A, 0x72, 0x31, 0x66, 0xE2, 0xA1, 0x2C, 0x6B, 0x5D,
+    0xFB, 0xC9, 0x0C, 0xDC, 0xEF, 0xB2, 0x39, 0x74, 0x1B, 0x68, 0x44, 0x54, 0xF2, 0xE8, 0x55, 0xC1,
+    0xC9, 0x48, 0x06, 0x7F, 0x8D, 0x14, 0x95, 0x82, 0xEE, 0xD9, 0x6D, 0x3B, 0x80, 0xC3, 0x28, 0x7A,
+    0xE7, 0xA0, 0xC8, 0x60, 0xD1, 0x1C, 0x82, 0xAA, 0x22, 0x8E, 0x74, 0x3E, 0xFA, 0xF4, 0x43, 0x2D,
+    0x33, 0x2F, 0xF6, 0x51, 0xE7, 0xC3, 0xF7, 0x84, 0x11, 0x99, 0xA7, 0xDD, 0x24, 0xC0, 0x12, 0x3B,
+    0x38, 0x72, 0x8C, 0x93, 0x2B, 0xED, 0x67, 0xEC, 0x1B, 0x2B, 0xC8, 0x81, 0xB7, 0xAD, 0x42, 0x86,
+    0x72, 0x9B, 0xDD, 0x10, 0xD6, 0x9B, 0x53, 0x57, 0xBE, 0xA5, 0x69, 0x68, 0x35, 0x56, 0xD3, 0x05,
+    0x1B, 0x9C, 0xD5, 0xB4, 0x01, 0x37, 0x83, 0xB8, 0x8E, 0xA6, 0x17, 0xA7, 0x9E, 0x87, 0x99, 0xF6,
+    0x39, 0x50, 0xCE, 0xF8, 0xAB, 0x78, 0x21, 0x38, 0xC8, 0x23, 0xD2, 0x01, 0x13, 0xCC, 0x7A, 0xBF,
+    0x7A, 0x7A, 0xB9, 0xFA, 0x92, 0x53, 0x84, 0xB6, 0xC4, 0x58, 0x63, 0x63, 0x46, 0x3E, 0xA0, 0xE9,
+    0x98, 0x6E, 0xD1, 0xBD, 0xFE, 0x68, 0x72, 0x0E, 0x38, 0xD1, 0xB2, 0xAD, 0xD7, 0xEB, 0xF7, 0x47,
+    0xA3, 0x63, 0x22, 0x1E, 0xA9, 0xAF, 0x4D, 0xA4, 0xF6, 0x8F, 0xB2, 0x58, 0x00, 0xF3, 0x60, 0x52,
+    0x91, 0x59, 0x72, 0xF9, 0xB1, 0x07, 0x91, 0xD9, 0x4C, 0xF1, 0x2D, 0xC2, 0x36, 0xDD, 0xDB, 0x0C,
+    0xC8, 0xC6, 0x11, 0xD4, 0x27, 0xD9, 0xCB, 0x57, 0x7B, 0xAB, 0xEA, 0x43, 0x91, 0x47, 0x66, 0xCC,
+    0x39, 0xEF, 0x91, 0xC6, 0x49, 0x17, 0xB8, 0x54, 0x83, 0x13, 0x77, 0xF0, 0xBA, 0xA0, 0xE4, 0x5D,
+    0x57, 0x26, 0x69, 0x4D, 0xCA, 0xB8, 0x73, 0xFC, 0xB8, 0xD0, 0xDB, 0x1D, 0x97, 0x36, 0x13, 0xDF,
+    0x7A, 0x8F, 0x13, 0x9C, 0x32, 0x38, 0x8D, 0x8E, 0x8C, 0x5D, 0xAC, 0x54, 0x3F, 0x44, 0x79, 0x47,
+    0xAE, 0xEE, 0x61, 0xE5, 0x0D, 0x5E, 0xFD, 0x89, 0x68, 0xD2, 0x91, 0x14, 0x5B, 0x0A, 0x3C, 0xDE,
+    0xFE, 0x53, 0x2C, 0x39, 0xD1, 0x2C, 0x03, 0x1C, 0xB1, 0x78, 0x38, 0x61, 0x42, 0x0A, 0x4B, 0x80,
+    0x4A, 0x9A, 0x0C, 0x7C, 0xEA, 0x63, 0xC9, 0xE2, 0xCF, 0xD8, 0x3B, 0xD5, 0x4F, 0xC0, 0xF0, 0x9B,
+    0x88, 0x2B, 0x07, 0xEC, 0xF1, 0x5C, 0x4B, 0xAE, 0xC8, 0x0E, 0x8F, 0xED, 0x71, 0x2A, 0x73, 0xDE,
+    0x19, 0x79, 0x33, 0x56, 0x43, 0xAE, 0x33, 0x5C, 0x5B, 0xBC, 0x09, 0x96, 0x27, 0x18, 0x4E, 0x65,
+    0x3A, 0x55, 0xAB, 0x64, 0xD1, 0x10, 0x6C, 0xE8, 0x42, 0x05, 0x51, 0xD5, 0xBA, 0x18, 0x75, 0x45,
+    0xD9, 0x95, 0x7F, 0x77, 0xD5, 0xE7, 0xBD, 0xA5, 0x46, 0x2F, 0x6C, 0xF4, 0xF2, 0xF0, 0xCB, 0x2C,
+    0x1C, 0xE8, 0x70, 0x10, 0x87, 0x1B, 0x68, 0xAB, 0xCB, 0x9D, 0x39, 0x74, 0x3C, 0xA4, 0xD6, 0xE5,
+    0x21, 0x5E, 0x6E, 0xFF, 0xAF, 0xCA, 0x5D, 0x72, 0xFA, 0x38, 0xC0, 0xFB, 0x7A, 0xDE, 0xC8, 0xD1,
+    0xB3, 0x87, 0x6B, 0xEB, 0x07, 0x54, 0x48, 0x40, 0x33, 0x6E, 0xF6, 0x20, 0x4C, 0x3B, 0x69, 0x1E,
+    0xFC, 0x70, 0x34, 0x52, 0xE6, 0x20, 0xF7, 0xD2, 0xA6, 0xA7, 0xE7, 0x3D, 0xED, 0xB9, 0x7F, 0x9C,
+    0x77, 0x69, 0x2A, 0x69, 0x62, 0xCB, 0x00, 0x07, 0x0C, 0x53, 0x64, 0xAA, 0x30, 0xFF, 0x6C, 0x9D,
+    0x8B, 0x73, 0x8A, 0x8A, 0x61, 0x06, 0x72, 0x4B, 0x3E, 0xFA, 0x02, 0x85, 0xD0, 0x6D, 0xAC, 0xA8,
+    0xA4, 0x2E, 0x9F, 0x8E, 0xE3, 0x31, 0x69, 0x1B, 0xF0, 0xEB, 0x31, 0x17, 0x52, 0xF2, 0x58, 0xF4,
+    0x14, 0x7E, 0xA6, 0xB4, 0x4A, 0x51, 0xB2, 0xA8, 0x8B, 0x1C, 0xBF, 0xAC, 0x40, 0x70, 0xF9, 0x71,
+    0xEE, 0xDC, 0xC9, 0x44, 0x36, 0x6C, 0xC2, 0x2C, 0x73, 0x31, 0xF6, 0x12, 0xB3, 0x24, 0x38, 0x61,
+    0xE3, 0xA1, 0xBB, 0xAB, 0x03, 0xE4, 0x8B, 0xEB, 0xEB, 0x01, 0xD7, 0x91, 0x78, 0x24, 0x7F, 0x31,
+    0x5C, 0x33, 0xC4, 0x38, 0x71, 0x3F, 0xED, 0xCC, 0xD7, 0x5A, 0xB5, 0x5A, 0xAD, 0x51, 0x9B, 0x6B,
+    0xD5, 0x94, 0x58, 0xC3, 0x9A, 0x2A, 0x61, 0x02, 0xA6, 0xA4, 0x2D, 0xF7, 0x4D, 0x3B, 0xA0, 0xF4,
+    0x3D, 0xAE, 0xDA, 0xEE, 0xF4, 0x6A, 0xAA, 0xB4, 0x34, 0x7E, 0x8C, 0x22, 0xE0, 0x8B, 0x87, 0x99,
+    0x1C, 0x59, 0x09, 0x0E, 0xA5, 0xF4, 0x53, 0xB7, 0xB0, 0x15, 0x9E, 0xA3, 0x26, 0x15, 0xC4, 0xA0,
+    0x57, 0x39, 0x01, 0x59, 0xB8, 0xCE, 0x8D, 0x5B, 0xFA, 0xFE, 0x38, 0x7B, 0x8B, 0x53, 0x26, 0xF3,
+    0x45, 0xE6, 0x64, 0x4C, 0x40, 0x13, 0x4A, 0xC5, 0xF2, 0x46, 0x26, 0xCC, 0x05, 0xC1, 0x9F, 0x95,
+    0x60, 0x4C, 0xBC, 0xE2, 0x25, 0x92, 0xAE, 0x57, 0x17, 0x96, 0xCD, 0x4A, 0xDF, 0x66, 0x87, 0xA4,
+    0xB3, 0x5B, 0xF6, 0x25, 0x5B, 0x52, 0x7C, 0x1F, 0x80, 0x87, 0xD2, 0x36, 0x9A, 0x46, 0xF6, 0x9A,
+    0xE0, 0xEC, 0xBC, 0x06, 0x5E, 0xF1, 0x2B, 0x99, 0x0B, 0x5B, 0xFE, 0x93, 0x88, 0xEB, 0x5C, 0x29,
+    0x6D, 0x74, 0xA6, 0x63, 0xAB, 0x8E, 0x41, 0x82, 0xBC, 0x6F, 0x55, 0x71, 0xBA, 0xDA, 0x5C, 0xCD,
+    0xAD, 0x6A, 0xB2, 0x56, 0x18, 0x57, 0xE6, 0x6E, 0xFA, 0xDC, 0xF4, 0xC9, 0x05, 0xA8, 0x4D, 0x2D,
+    0x4C, 0x13, 0x4D, 0x91, 0xD9, 0x32, 0xDD, 0xB7, 0xF7, 0x12, 0x57, 0x7E, 0x84, 0x01, 0xE4, 0xDD,
+    0x0C, 0x3E, 0x97, 0x3B, 0x56, 0x62, 0xAB, 0xBA, 0xD5, 0x5D, 0x47, 0x7D, 0x30, 0xB1, 0x33, 0x77,
+    0x4B, 0xE6, 0x43, 0xA2, 0x9B, 0x57, 0xAE, 0x84, 0x96, 0x5B, 0x99, 0xDA, 0x9B, 0x98, 0x39, 0xCD,
+    0xAB, 0xC7, 0x84, 0x93, 0x57, 0x14, 0xD6, 0x5D, 0x3F, 0xC1, 0x00, 0xAF, 0xB4, 0x7F, 0x00, 0x85,
+    0x55, 0xBF, 0x8F, 0x15, 0x45, 0x1C, 0xFF, 0xEC, 0x0E, 0xB8, 0x26, 0x0B, 0xCC, 0x15, 0x92, 0x18,
+    0xC9, 0xDD, 0x52, 0x12, 0xC2, 0xDD, 0x5A, 0x52, 0xBC, 0xF7, 0x76, 0x85, 0x82, 0xC2, 0x18, 0x4C,
+    0x84, 0xC2, 0x58, 0x48, 0x61, 0x45, 0x4C, 0xB0, 0x20, 0xF1, 0x8A, 0xBD, 0xDB, 0x35, 0x94, 0x16,
+    0xD2, 0xD8, 0xF8, 0x17, 0x98, 0x6B, 0x24, 0xF1, 0x12, 0x29, 0xDE, 0xDD, 0x1B, 0x38, 0x13, 0x8A,
+    0x2B, 0x5C, 0xB5, 0xB0, 0xA0, 0x60, 0x02, 0x31, 0x24, 0x90, 0xE0, 0x00, 0x9B, 0xF8, 0x80, 0x7D,
+    0x6F, 0xFC, 0x7C, 0xF7, 0x5D, 0x0E, 0x0E, 0x4D, 0xDC, 0xCC, 0xF7, 0xF3, 0xE6, 0xCD, 0xEC, 0x7E,
+    0x7F, 0x7E, 0xE6, 0x3B, 0x80, 0x83, 0x3E, 0xBE, 0xF6, 0xD4, 0xFB, 0x1E, 0x94, 0x41, 0x07, 0x2B,
+    0x88, 0xEA, 0x19, 0xAC, 0x22, 0xB2, 0xD0, 0xDE, 0xEB, 0xB5, 0x35, 0x0D, 0xC8, 0xC8, 0x51, 0xFA,
+    0x29, 0x47, 0x52, 0xC9, 0x5C, 0x57, 0x48, 0x5E, 0x1D, 0x06, 0x40, 0xEC, 0x6F, 0x1A, 0x5C, 0xC3,
+    0xC8, 0xEB, 0x6F, 0x4F, 0x1B, 0x6A, 0xEF, 0xF1, 0x3B, 0x55, 0x23, 0xA3, 0x16, 0xEF, 0xB7, 0xF8,
+    0x86, 0x03, 0xD7, 0x44, 0x19, 0x4D, 0xA1, 0x39, 0xC7, 0x1D, 0xAB, 0xEB, 0x55, 0x55, 0xAB, 0x1B,
+    0x0E, 0xEB, 0x05, 0xE6, 0x13, 0x44, 0x67, 0x8C, 0xFA, 0xD5, 0x69, 0x57, 0x28, 0x8B, 0x8B, 0x57,
+    0xFC, 0x07, 0x38, 0x09, 0xAB, 0xFC, 0x59, 0xB5, 0x1C, 0xD7, 0xC9, 0x57, 0x8F, 0xA8, 0xCE, 0x69,
+    0x23, 0xAE, 0x0D, 0x14, 0x9D, 0x37, 0x63, 0xF1, 0x65, 0xCB, 0xB6, 0x40, 0x7A, 0x76, 0xBB, 0x06,
+    0xB2, 0x6C, 0x95, 0x6E, 0x94, 0x9E, 0x76, 0xE0, 0x7D, 0x25, 0xC8, 0x3D, 0x84, 0x9E, 0x7B, 0x48,
+    0x3C, 0x8D, 0x06, 0x5E, 0x30, 0x11, 0xE4, 0x94, 0xA8, 0x5F, 0x4C, 0x89, 0xFE, 0x97, 0xB1, 0x37,
+    0xBA, 0xCD, 0x1E, 0x7B, 0xE3, 0x6B, 0x7F, 0xB3, 0xFB, 0x14, 0x27, 0x04, 0x18, 0x0F, 0x9F, 0xA0,
+    0x5B, 0x88, 0xAE, 0xDC, 0xB0, 0xEA, 0x37, 0x06, 0xF2, 0x74, 0xBB, 0xC2, 0x4F, 0x77, 0x68, 0x6F,
+    0x42, 0x5D, 0x63, 0x46, 0xD4, 0xCC, 0xE6, 0xDE, 0xE7, 0xEA, 0x05, 0x15, 0xDD, 0x7F, 0xEA, 0xB2,
+    0xED, 0xC7, 0x62, 0xFA, 0x6D, 0x91, 0x77, 0x9E, 0x71, 0x27, 0xC8, 0x07, 0x5D, 0xF4, 0x0E, 0x91,
+    0xB9, 0xD8, 0x06, 0x74, 0x89, 0x09, 0x66, 0x1E, 0xE2, 0x1C, 0xFD, 0x0B, 0xE1, 0x13, 0xEF, 0xB7,
+    0x7D, 0x1B, 0xD3, 0x30, 0x17, 0x2B, 0xA4, 0x35, 0x3E, 0xC3, 0x01, 0x1C, 0xD3, 0x16, 0x97, 0xE9,
+    0xC7, 0x89, 0xB9, 0x62, 0xD4, 0x8C, 0xEA, 0xA3, 0x38, 0x8E, 0x30, 0x8F, 0x58, 0x20, 0x9D, 0x6F,
+    0xA0, 0xD1, 0x46, 0x9F, 0x76, 0x41, 0xB3, 0x8A, 0x44, 0x9B, 0xE0, 0x49, 0x83, 0xB4, 0x64, 0xA4,
+    0x06, 0xE9, 0x18, 0xCA, 0xD3, 0x1F, 0xF9, 0xB1, 0xC8, 0x46, 0x95, 0xBA, 0x37, 0xC5, 0x40, 0x8F,
+    0x23, 0x5B, 0xD6, 0xAB, 0xA1, 0x3F, 0x63, 0x35, 0x77, 0xF1, 0x05, 0xC3, 0xE1, 0xCF, 0x1C, 0x63,
+    0xAB, 0xDD, 0xFC, 0x62, 0xF0, 0x87, 0x39, 0xE1, 0xC2, 0x47, 0x48, 0x8D, 0x1A, 0x23, 0xB3, 0xEA,
+    0x4E, 0xD5, 0xDB, 0x54, 0x5B, 0x4D, 0x8F, 0x0E, 0x28, 0xE0, 0xA8, 0x44, 0x7F, 0x88, 0xB4, 0x58,
+    0x60, 0xDD, 0x17, 0x90, 0x60, 0xA1, 0xE8, 0x63, 0x69, 0x38, 0xC4, 0xE2, 0xB0, 0x41, 0x7F, 0xD3,
+    0x62, 0x40, 0xBB, 0x19, 0xA5, 0xCF, 0xD4, 0xF7, 0xDB, 0x96, 0x32, 0xC2, 0x4A, 0x9B, 0x99, 0xE2,
+    0x7B, 0x96, 0x12, 0x51, 0xBB, 0x0F, 0x73, 0x0A, 0xBD, 0xE0, 0xE7, 0x79, 0x7C, 0xF9, 0x0D, 0x16,
+    0x1F, 0x22, 0x2E, 0x73, 0x71, 0xF5, 0xEF, 0x21, 0xFA, 0xF7, 0x6B, 0x7D, 0x7D, 0x43, 0x19, 0x6D,
+    0x63, 0x93, 0x85, 0xFE, 0x6E, 0xF3, 0xC6, 0xF4, 0xD3, 0x4A, 0xB1, 0xA4, 0xFA, 0xEB, 0x1A, 0x83,
+    0x0C, 0x78, 0xDE, 0x30, 0x0E, 0x12, 0x8C, 0xD9, 0x2C, 0x2D, 0x24, 0x6F, 0xB1, 0x04, 0x59, 0x1A,
+    0x0C, 0x4B, 0xA3, 0xDC, 0xC8, 0x68, 0xE3, 0x4D, 0x06, 0x6F, 0x98, 0x53, 0x83, 0x0B, 0x1D, 0xBD,
+    0x32, 0xD6, 0xC1, 0x37, 0x1D, 0xDF, 0xF8, 0x2F, 0x70, 0xEB, 0x48, 0x52, 0x04, 0xF7, 0x0D, 0x92,
+    0x06, 0xC1, 0x94, 0x6C, 0x71, 0x5D, 0xA6, 0x96, 0x32, 0x84, 0xAC, 0x52, 0x1A, 0x37, 0xCA, 0x65,
+    0x35, 0x69, 0xA3, 0x0D, 0x21, 0xCD, 0xC9, 0x32, 0xF2, 0x48, 0x9C, 0x80, 0xBA, 0x4B, 0x35, 0xEA,
+    0x1E, 0x15, 0xA9, 0x87, 0x24, 0x91, 0x78, 0x82, 0x48, 0xF2, 0x17, 0x4D, 0x05, 0x7C, 0x8E, 0xCE,
+    0x1D, 0xC4, 0x77, 0xF8, 0x4A, 0x7C, 0x8B, 0x5F, 0xE8, 0x9B, 0xDC, 0x16, 0x9F, 0x08, 0x99, 0x90,
+    0x54, 0x3C, 0x27, 0x3B, 0xF4, 0xFE, 0x4F, 0xDE, 0xCF, 0x83, 0xDF, 0x0D, 0x7E, 0xA4, 0x61, 0x8B,
+    0xD8, 0x81, 0x99, 0x06, 0x15, 0xF4, 0x1B, 0xE8, 0x34, 0x67, 0xB2, 0x03, 0x57, 0xE6, 0x6F, 0x01,
+    0x1F, 0xF6, 0xE9, 0xB1, 0xC8, 0x00, 0x41, 0xB3, 0x57, 0x42, 0x16, 0xBB, 0x93, 0x71, 0xE9, 0xFD,
+    0x5E, 0x91, 0x35, 0xA8, 0x56, 0x64, 0x04, 0x45, 0x2E, 0xE2, 0xE0, 0x8E, 0xEC, 0x83, 0xF0, 0xEE,
+    0x5A, 0x37, 0xD6, 0x77, 0xC7, 0x60, 0xAD, 0xC9, 0xBC, 0x8C, 0x1E, 0xC6, 0x1C, 0x05, 0xE8, 0xE5,
+    0x01, 0xE0, 0xCD, 0x8E, 0xF3, 0x21, 0xFD, 0xF6, 0xD3, 0x54, 0x08, 0x7D, 0x57, 0x42, 0x00, 0xA7,
+    0x6D, 0xB7, 0xBA, 0x67, 0x9A, 0xC9, 0x54, 0xBD, 0x32, 0xED, 0x4E, 0x14, 0x8F, 0xFB, 0xDE, 0x69,
+    0x23, 0xDD, 0x21, 0xCB, 0x83, 0xD9, 0x94, 0xFD, 0xA0, 0x0A, 0xE8, 0xDF, 0x49, 0x8C, 0x5A, 0x17,
+    0xFE, 0xF9, 0x91, 0x89, 0x59, 0xA3, 0x45, 0x7A, 0xB8, 0x0E, 0xC7, 0x4E, 0xF0, 0xE0, 0x87, 0x5C,
+    0xFB, 0x09, 0xBF, 0x6C, 0xF8, 0xD7, 0x92, 0x17, 0x55, 0x82, 0x01, 0x8F, 0xF4, 0x04, 0x33, 0x58,
+    0x46, 0x1F, 0x28, 0x66, 0x30, 0x78, 0x0D, 0x0E, 0xE7, 0x05, 0x3F, 0x24, 0xE1, 0xB2, 0x6A, 0x48,
+    0xC0, 0x92, 0x6C, 0x68, 0x79, 0x79, 0x06, 0x64, 0x1B, 0xD2, 0x21, 0x06, 0xE1, 0x44, 0xA0, 0xE9,
+    0x42, 0x2D, 0xA5, 0x43, 0xAC, 0x9C, 0x2F, 0x44, 0x41, 0xEF, 0x5F, 0xD0, 0x7B, 0x05, 0x8A, 0xC3,
+    0x84, 0xD2, 0x5B, 0xC2, 0x7B, 0xAC, 0xDC, 0xCA, 0xEC, 0xA5, 0x45, 0x81, 0xF9, 0x5D, 0x90, 0x35,
+    0xD5, 0x0A, 0xD8, 0x4E, 0x3D, 0xF6, 0x0B, 0xA4, 0xD2, 0x1D, 0x33, 0xE9, 0x4A, 0xA9, 0x34, 0x92,
+    0x24, 0x0F, 0xA7, 0x88, 0x4D, 0xF4, 0x50, 0x02, 0x36, 0x0B, 0x70, 0xA1, 0x51, 0xA6, 0x20, 0x5B,
+    0x6D, 0xC2, 0xB4, 0x2C, 0x47, 0x5C, 0xEA, 0x05, 0x2E, 0x22, 0xAB, 0x0B, 0x34, 0x99, 0xF0, 0x68,
+    0x74, 0xE6, 0xD4, 0x24, 0xF6, 0x7F, 0x39, 0x26, 0xD4, 0x8F, 0x23, 0x42, 0x8D, 0x23, 0xCF, 0xB0,
+    0xF3, 0x24, 0xA2, 0x9C, 0x16, 0x58, 0x19, 0xA6, 0x32, 0xB3, 0x71, 0xBE, 0x3C, 0x1F, 0x9A, 0x93,
+    0xAA, 0x72, 0x07, 0x61, 0x7B, 0x11, 0x2E, 0xEB, 0xA0, 0x2E, 0x54, 0xDD, 0x5B, 0xC1, 0x86, 0x9E,
+    0x7E, 0xCE, 0x56, 0xEC, 0x31, 0x7A, 0x31, 0xC5, 0xEE, 0x73, 0x64, 0x8A, 0x94, 0xDC, 0x7F, 0xF6,
+    0xB1, 0x10, 0x72, 0x55, 0xC8, 0x4B, 0xB2, 0x75, 0xEA, 0x58, 0x5B, 0xA9, 0x6C, 0xF7, 0x53, 0x41,
+    0xC9, 0xC9, 0xF1, 0x6B, 0x8E, 0x0A, 0x62, 0xCF, 0x73, 0x42, 0x3D, 0x97, 0xD8, 0x61, 0x62, 0x46,
+    0xCA, 0x1E, 0x11, 0xD7, 0x3B, 0xEA, 0x2E, 0xD9, 0xC4, 0x33, 0xFA, 0xA1, 0x74, 0xB6, 0x46, 0xAE,
+    0x8A, 0xEB, 0xB2, 0x97, 0x7D, 0x17, 0xF8, 0x71, 0xC0, 0xE3, 0xF3, 0x2E, 0xFB, 0x8E, 0xAE, 0x0E,
+    0x9F, 0x3F, 0x7F, 0x6E, 0x44, 0x76, 0x88, 0xCC, 0x45, 0x74, 0x5E, 0x24, 0xFE, 0x0F, 0xD1, 0xAF,
+    0x4B, 0xFD, 0x52, 0xC8, 0x25, 0xC9, 0xBA, 0x48, 0xE9, 0xC7, 0x0F, 0x9E, 0x5F, 0x65, 0xE7, 0x3C,
+    0x24, 0xCC, 0x0A, 0x2C, 0xA2, 0x0A, 0x0B, 0xC2, 0x16, 0x4E, 0xE3, 0x8E, 0xB4, 0x57, 0x11, 0x40,
+    0x78, 0x32, 0x4C, 0x72, 0x69, 0x9D, 0xA1, 0x8B, 0xEA, 0xA8, 0x96, 0xEB, 0x24, 0x90, 0x5B, 0xA4,
+    0x65, 0x98, 0x9B, 0x9B, 0x0C, 0x53, 0xEE, 0x12, 0xE9, 0xE8, 0x72, 0x9C, 0xED, 0x4C, 0xF4, 0x8E,
+    0x24, 0x3B, 0x92, 0x5A, 0xA1, 0x44, 0x1F, 0xD7, 0x17, 0xA8, 0x08, 0x4E, 0x9F, 0xB2, 0xD1, 0x96,
+    0x51, 0xB7, 0x4C, 0x78, 0x3B, 0x0F, 0x78, 0xF6, 0x39, 0x36, 0xF6, 0x8C, 0xBD, 0x46, 0x49, 0x6A,
+    0x17, 0x9B, 0xB0, 0xD9, 0x31, 0xBA, 0x51, 0xD2, 0xF9, 0xC9, 0xCC, 0x30, 0xAF, 0x92, 0x90, 0xD7,
+    0x96, 0xC8, 0xAE, 0x51, 0xFD, 0xD2, 0xE8, 0x31, 0x1C, 0xEB, 0x63, 0x79, 0x69, 0xD7, 0xE8, 0x95,
+    0x5A, 0xD1, 0xEE, 0xED, 0x6A, 0x66, 0xD4, 0xFB, 0x09, 0xC7, 0x4B, 0xBB, 0xFF, 0xFB, 0xFC, 0x03,
+    0xAD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0xB9, 0x95, 0xA5, 0x9B, 0xDC, 0x4E, 0x8B,
+    0xF2, 0xE3, 0x4C, 0x91, 0xE2, 0x12, 0xED, 0xAD, 0x53, 0x50, 0x1C, 0x92, 0x7D, 0x36, 0x49, 0x41,
+    0x41, 0x91, 0x2B, 0x12, 0x9A, 0x14, 0xA1, 0x44, 0x14, 0xE1, 0x0A, 0x0A, 0x84, 0x7C, 0x59, 0x93,
+    0xFB, 0x03, 0x88, 0xF8, 0x1B, 0xA8, 0x2E, 0x08, 0x56, 0x70, 0xE5, 0xE6, 0xEC, 0xCB, 0x16, 0x27,
+    0x91, 0x22, 0x86, 0x08, 0xA5, 0x40, 0x0A, 0x4E, 0x14, 0x44, 0x11, 0x29, 0x4C, 0x84, 0x01, 0x93,
+    0xB3, 0xFD, 0x78, 0xE3, 0xBD, 0x90, 0x1F, 0x50, 0x50, 0x30, 0xFB, 0x66, 0xDE, 0xEC, 0xEC, 0xCE,
+    0xBC, 0x37, 0xDF, 0xFB, 0xDE, 0x9B, 0xC3, 0xC0, 0x09, 0x51, 0xC0, 0xC5, 0x06, 0x54, 0x24, 0x33,
+    0x95, 0xA0, 0x92, 0x19, 0xDC, 0x37, 0x73, 0x88, 0x3F, 0x34, 0x10, 0x72, 0x97, 0x15, 0x60, 0xD5,
+    0x00, 0x28, 0xE3, 0xCE, 0x5F, 0xD2, 0x30, 0x42, 0xF8, 0x96, 0x46, 0x98, 0xB4, 0xF0, 0x32, 0x37,
+    0x77, 0x73, 0xBB, 0x56, 0xBA, 0xFB, 0x2F, 0x06, 0xDC, 0x25, 0x77, 0x2B, 0xE2, 0xE1, 0x18, 0x56,
+    0x24, 0xC6, 0x62, 0x37, 0xB7, 0x6E, 0x67, 0x20, 0x60, 0x15, 0xB8, 0xCC, 0x47, 0x44, 0xF6, 0xCF,
+    0x99, 0x33, 0x2D, 0x54, 0x54, 0x86, 0xD8, 0x01, 0x04, 0x60, 0xBF, 0xB7, 0xF5, 0xD9, 0x9C, 0x24,
+    0x3A, 0x9D, 0xC1, 0xE7, 0x23, 0x44, 0x66, 0xFF, 0xB7, 0x49, 0x48, 0x54, 0x08, 0xA2, 0xB6, 0x9B,
+    0xB0, 0xC1, 0x21, 0x77, 0xFB, 0xE9, 0xC4, 0xBA, 0xCA, 0x83, 0x20, 0x9D, 0x23, 0x5F, 0xC0, 0x02,
+    0xFE, 0x45, 0x29, 0xAA, 0x41, 0xE6, 0x56, 0x47, 0xF9, 0xDF, 0xAC, 0x5E, 0x59, 0xC2, 0x92, 0x93,
+    0x89, 0xDC, 0x47, 0x20, 0x5E, 0x50, 0x76, 0x26, 0x73, 0x75, 0xAD, 0xC1, 0x68, 0x3F, 0x07, 0x5B,
+    0x67, 0xE3, 0x2F, 0xA8, 0xBB, 0x40, 0xC0, 0x97, 0x57, 0x6C, 0x8F, 0x55, 0x6F, 0x3C, 0x2F, 0xA1,
+    0xC7, 0x8A, 0x87, 0x75, 0x25, 0x4E, 0x6B, 0x8F, 0xCC, 0x72, 0x1F, 0x28, 0xCC, 0xF0, 0xC5, 0x81,
+    0xC6, 0x0A, 0x94, 0x82, 0x98, 0x66, 0xD0, 0x1A, 0xBE, 0x0F, 0x57, 0xC1, 0x99, 0x4E, 0xAF, 0xE8,
+    0xB2, 0xA8, 0xBD, 0x1D, 0x12, 0xB4, 0x9F, 0x79, 0xF7, 0x34, 0x8A, 0x18, 0x2B, 0x2E, 0xFA, 0x1C,
+    0x12, 0xBB, 0x5C, 0xEB, 0x2D, 0xD9, 0xDF, 0xE0, 0xAB, 0x64, 0x70, 0x5F, 0x0D, 0xF6, 0xF6, 0x48,
+    0x8F, 0x62, 0xA1, 0x30, 0xCD, 0x4E, 0xE9, 0xE3, 0xC0, 0x87, 0x40, 0xFC, 0x92, 0x9C, 0x8F, 0x46,
+    0x54, 0x8C, 0xA2, 0x6D, 0x3E, 0xA1, 0x13, 0xFF, 0x6F, 0x99, 0x20, 0x5E, 0x06, 0xC6, 0x60, 0x00,
+    0x55, 0x77, 0x01, 0x0D, 0x71, 0xAB, 0x54, 0x54, 0x85, 0x9F, 0xEA, 0xCA, 0xBE, 0x93, 0x39, 0x17,
+    0xB1, 0x18, 0xE3, 0x23, 0x6D, 0x3D, 0xCC, 0x9C, 0x2F, 0xE1, 0x4D, 0x90, 0x6A, 0xC1, 0xF7, 0x3A,
+    0xCC, 0x21, 0x75, 0x29, 0x81, 0x2C, 0x86, 0xB0, 0x34, 0xB6, 0xCB, 0x80, 0xB7, 0x6D, 0x66, 0xD8,
+    0x48, 0x89, 0xE8, 0x3E, 0x99, 0x30, 0x34, 0xE7, 0x18, 0x85, 0x84, 0x2F, 0x67, 0xE8, 0x22, 0x4D,
+    0x20, 0xC2, 0x07, 0x56, 0x62, 0x11, 0xE3, 0x2C, 0x0D, 0xD0, 0xCA, 0xD0, 0xA7, 0xB7, 0x06, 0xD3,
+    0x9C, 0x06, 0xF2, 0xE3, 0xEF, 0xCE, 0x44, 0x47, 0x7F, 0xFF, 0xFE, 0xC2, 0x45, 0x0E, 0x5F, 0x70,
+    0xCE, 0x78, 0xC3, 0x5C, 0xC4, 0x68, 0x2B, 0x97, 0x54, 0xC2, 0x2B, 0xD9, 0x26, 0xC7, 0xD0, 0x21,
+    0x36, 0x7E, 0xF9, 0x0D, 0x76, 0x32, 0x87, 0x8E, 0x87, 0xB0, 0xBF, 0x65, 0x5B, 0x74, 0xC5, 0x0C,
+    0xF0, 0xB6, 0xD8, 0xE2, 0xC4, 0x04, 0xDB, 0x90, 0xCF, 0x31, 0x83, 0xE2, 0x6D, 0x70, 0xDB, 0x6B,
+    0xB9, 0x21, 0x45, 0x04, 0x8F, 0x1A, 0xE0, 0x08, 0xBB, 0xDD, 0xD1, 0xB2, 0xE3, 0x27, 0xDE, 0xC1,
+    0xAC, 0xA5, 0x19, 0x96, 0x1D, 0xDB, 0x89, 0x06, 0xAF, 0xFF, 0xF6, 0xF6, 0x0D, 0xA2, 0xC6, 0xFA,
+    0x69, 0x0D, 0x8B, 0xBC, 0xCE, 0x27, 0xC8, 0x27, 0x9F, 0xF3, 0xFE, 0x0C, 0xE9, 0x03, 0x80, 0xA3,
+    0x7C, 0x08, 0x27, 0xD5, 0x54, 0xD7, 0x9E, 0xBC, 0xA1, 0x27, 0xB3, 0x41, 0xDD, 0x2E, 0x9B, 0xF0,
+    0x93, 0xE2, 0xE0, 0x24, 0x11, 0x1D, 0xEA, 0x88, 0x3F, 0x36, 0x0E, 0x90, 0xE1, 0xBE, 0x2C, 0xF1,
+    0xCF, 0x66, 0x97, 0x32, 0x0B, 0x21, 0xB4, 0x67, 0x55, 0x70, 0x8A, 0x58, 0x65, 0x90, 0xBB, 0xFA,
+    0x3A, 0x6F, 0xB9, 0x39, 0x65, 0xD7, 0xBD, 0xF7, 0x47, 0x06, 0x31, 0x83, 0x11, 0x46, 0x86, 0x96,
+    0x30, 0xBE, 0xC3, 0xA2, 0xEE, 0x5A, 0x1D, 0xC1, 0x89, 0x72, 0x33, 0x35, 0x63, 0x6A, 0x46, 0xD9,
+    0xD2, 0x28, 0x47, 0xFA, 0x43, 0x9D, 0xE6, 0xB2, 0xF5, 0x34, 0xE5, 0xA9, 0x4E, 0xF3, 0x6E, 0x2B,
+    0xB7, 0x75, 0x9B, 0x6F, 0x5D, 0x1C, 0x63, 0xB3, 0xE6, 0x04, 0xAB, 0x7D, 0xD9, 0x9B, 0x5E, 0xB4,
+    0xD6, 0x83, 0x6B, 0x33, 0xC7, 0x3C, 0xB9, 0x59, 0x20, 0x18, 0x7A, 0x4C, 0x9B, 0x8A, 0xFD, 0xDE,
+    0xFF, 0x85, 0x37, 0x72, 0xCC, 0x78, 0x63, 0x6E, 0xF0, 0xEF, 0xBC, 0x32, 0xB9, 0x44, 0x66, 0x42,
+    0x10, 0x6D, 0x43, 0x08, 0x6F, 0x96, 0x24, 0x1A, 0xEF, 0x1E, 0x61, 0x0E, 0x6B, 0x7D, 0x5B, 0x2F,
+    0x3A, 0xF9, 0xA2, 0x4A, 0x16, 0x5D, 0x0C, 0x03, 0x2C, 0x4F, 0xB0, 0x5A, 0x22, 0x2C, 0x10, 0xB6,
+    0x51, 0x70, 0xA4, 0x08, 0x50, 0x05, 0x08, 0x36, 0x30, 0x64, 0x4B, 0x2C, 0x5D, 0x21, 0x98, 0x40,
+    0x55, 0x50, 0x05, 0xE6, 0x31, 0x37, 0xE7, 0x28, 0x7B, 0x2F, 0xFA, 0x3A, 0x39, 0x99, 0xA9, 0x42,
+    0xFC, 0x89, 0x7B, 0xE5, 0x8A, 0xEC, 0x5B, 0x77, 0x92, 0x0F, 0x38, 0x58, 0x97, 0xBA, 0x4C, 0x76,
+    0x18, 0x87, 0x11, 0xE5, 0x4E, 0x16, 0x20, 0x16, 0x4F, 0x95, 0x64, 0x35, 0x61, 0x95, 0xF0, 0xE9,
+    0x22, 0x57, 0xAC, 0x4A, 0x56, 0xD1, 0xE5, 0x0B, 0xDA, 0x69, 0x5B, 0x30, 0x2A, 0x86, 0x84, 0x6E,
+    0xC2, 0x98, 0xF7, 0xCE, 0x83, 0xB4, 0x72, 0x4C, 0x3A, 0x3A, 0x28, 0xD6, 0xFB, 0x12, 0xC5, 0x78,
+    0x41, 0xDA, 0xF9, 0x4E, 0xCC, 0x14, 0xF5, 0xBB, 0x2C, 0xEE, 0x01, 0x6B, 0x9C, 0x64, 0xAB, 0xB6,
+    0x66, 0xFE, 0x4E, 0x98, 0x85, 0xEC, 0x64, 0xCD, 0x0B, 0xA1, 0x59, 0xC8, 0x6A, 0x0E, 0x59, 0xC8,
+    0x0B, 0x1C, 0xAF, 0x90, 0x41, 0xA0, 0x8C, 0xBB, 0x66, 0x20, 0x6A, 0x8E, 0x04, 0x89, 0x12, 0x6E,
+    0xD6, 0xC0, 0x29, 0xC3, 0xC8, 0xA2, 0xB3, 0x45, 0x67, 0x59, 0x32, 0xDE, 0x82, 0xCD, 0x9B, 0xD4,
+    0x9F, 0xD1, 0x01, 0x5D, 0xC6, 0x8F, 0xFD, 0x03, 0xD9, 0x9E, 0xC9, 0xEA, 0x56, 0x19, 0x92, 0x11,
+    0x1F, 0x95, 0x8F, 0x3A, 0x46, 0x63, 0x72, 0xD7, 0xA9, 0x67, 0xEC, 0xF9, 0x1F, 0x9C, 0xD2, 0xEC,
+    0x54, 0xC3, 0x28, 0x8F, 0xA2, 0x59, 0x76, 0x74, 0x75, 0x9C, 0x6B, 0x2E, 0x3C, 0x5E, 0xE0, 0x9D,
+    0xCC, 0x42, 0x98, 0x12, 0xF0, 0x82, 0x57, 0xCF, 0x39, 0x56, 0x75, 0x8E, 0x55, 0x31, 0xAA, 0xAE,
+    0x50, 0xC4, 0x5D, 0xA5, 0x29, 0x97, 0x70, 0x22, 0xC0, 0xAA, 0x6F, 0x64, 0xC8, 0x32, 0xC0, 0xF2,
+    0x00, 0xC1, 0x31, 0x6C, 0x70, 0x89, 0x14, 0xC4, 0x74, 0x0E, 0x9E, 0x93, 0xE5, 0x4E, 0x02, 0x73,
+    0x7B, 0xAC, 0xBC, 0xDA, 0x5B, 0x9F, 0x5F, 0xEF, 0x9B, 0xCF, 0xA9, 0xC5, 0x70, 0x47, 0xDD, 0xE5,
+    0x42, 0xE8, 0x21, 0xC4, 0x6B, 0xFC, 0xC1, 0xFC, 0x55, 0x16, 0x06, 0x4D, 0x54, 0xE6, 0x85, 0xE0,
+    0x08, 0x16, 0xA0, 0xC4, 0xAD, 0x31, 0xD2, 0x0E, 0x25, 0x61, 0x6D, 0xED, 0x6B, 0x45, 0x88, 0x1B,
+    0xF9, 0x63, 0xE6, 0x79, 0xD3, 0x5F, 0xB5, 0xDC, 0x7B, 0x5C, 0xD5, 0xB6, 0x6E, 0x9B, 0x10, 0xD7,
+    0x5D, 0x52, 0xB9, 0x77, 0x86, 0x36, 0x4B, 0x95, 0xA7, 0xBB, 0x8D, 0x28, 0x5D, 0x3D, 0x4A, 0x5A,
+    0x56, 0x45, 0x98, 0xBC, 0x2B, 0x2B, 0xBE, 0xBE, 0x4D, 0x78, 0x5A, 0x1E, 0x3A, 0x04, 0xCC, 0x33,
+    0x34, 0xC3, 0xA0, 0x03, 0x61, 0x86, 0x82, 0xAD, 0x2D, 0xED, 0x45, 0xA1, 0xA8, 0x19, 0xB5, 0x2C,
+    0x15, 0x8F, 0xD4, 0x76, 0xF0, 0xF8, 0xE1, 0x99, 0x5B, 0x1B, 0xDB, 0x7E, 0x7A, 0x6B, 0x73, 0x5A,
+    0x55, 0xBE, 0xA7, 0x36, 0x77, 0x35, 0x07, 0xC9, 0x6C, 0xF1, 0x66, 0x0F, 0x4D, 0xF7, 0x08, 0x1C,
+    0x8F, 0xE3, 0xD8, 0x7F, 0xD6, 0xBA, 0x58, 0x2F, 0x60, 0x9D, 0x7F, 0xE1, 0x3B, 0x8F, 0x4C, 0x1A,
+    0x55, 0x2F, 0x65, 0x5E, 0x57, 0xAD, 0x4C, 0x3E, 0x86, 0x7C, 0xD4, 0x90, 0x63, 0xAD, 0x2E, 0xB1,
+    0x13, 0x7B, 0x5C, 0xE5, 0x0B, 0xFE, 0x52, 0x9A, 0x3C, 0x74, 0x38, 0xF0, 0x8C, 0xBA, 0x8A, 0x3C,
+    0xC8, 0xCC, 0xC9, 0xC5, 0x93, 0xAD, 0xCA, 0x32, 0x15, 0xCF, 0xA4, 0xBD, 0x09, 0x3B, 0x33, 0x3B,
+    0x34, 0xF5, 0xC3, 0x78, 0x2E, 0x30, 0x10, 0xC9, 0x8A, 0xA9, 0x13, 0xA3, 0xE4, 0x99, 0x91, 0xF4,
+    0x9C, 0xA0, 0x5A, 0x26, 0x75, 0x1F, 0xF1, 0x51, 0xF8, 0x03, 0xF3, 0xC8, 0x04, 0x3E, 0x36, 0xBC,
+    0xD3, 0xAD, 0xA2, 0x56, 0xD2, 0x23, 0x6B, 0xE7, 0x2C, 0xF0, 0x17, 0xA5, 0x55, 0x31, 0x6C, 0xDD,
+    0x54, 0x14, 0x3D, 0xCF, 0xD6, 0x8F, 0x07, 0x97, 0xBC, 0x0E, 0xCD, 0xD4, 0x92, 0x37, 0x03, 0x69,
+    0xBC, 0x30, 0x74, 0xF0, 0x8F, 0x9D, 0x32, 0x30, 0x30, 0x24, 0x43, 0xCA, 0x90, 0x0E, 0xDD, 0x01,
+    0x29, 0x1D, 0x32, 0xFC, 0x4A, 0x3F, 0xFF, 0xBB, 0xED, 0xC0, 0xC0, 0x50, 0x90, 0x40, 0x5D, 0x3B,
+    0x14, 0xA9, 0x44, 0x42, 0x61, 0x60, 0x88, 0xE0, 0xF7, 0x7F, 0x87, 0x0E, 0x1D, 0x3A, 0x60, 0x2A,
+    0x55, 0x1D, 0x18, 0xB0, 0xAA, 0x0A, 0x09, 0x09, 0x91, 0x47, 0x71, 0x5B, 0x27, 0xB2, 0xFD, 0x38,
+    0xEF, 0x27, 0x4A, 0x08, 0x02, 0xD4, 0x8A, 0x17, 0xF9, 0xCA, 0xB1, 0xEE, 0xBB, 0xF7, 0xDC, 0x7B,
+    0xCF, 0xB9, 0x1F, 0x5D, 0x3F, 0x41, 0xE0, 0x6A, 0xC8, 0xAC, 0x82, 0x58, 0x9C, 0xC2, 0xE1, 0x51,
+    0x7C, 0x64, 0x0E, 0xB8, 0x15, 0xE0, 0x6C, 0xC7, 0xC0, 0x33, 0xFE, 0xD3, 0xED, 0x02, 0xB3, 0x32,
+    0x86, 0x3C, 0xAB, 0xE1, 0xA5, 0x5D, 0xB8, 0xB9, 0x4C, 0x50, 0x38, 0x1A, 0x03, 0xAC, 0x21, 0x5A,
+    0xDF, 0x48, 0x94, 0x31, 0xDA, 0x37, 0xA6, 0xB6, 0x21, 0xB7, 0x4A, 0xB8, 0x9A, 0xB7, 0x87, 0x6E,
+    0xDA, 0xF5, 0xB2, 0x81, 0x9F, 0x57, 0xAD, 0xC5, 0xA5, 0xFD, 0xE8, 0xA3, 0x25, 0xD7, 0x54, 0x7E,
+    0x52, 0x4D, 0xA2, 0x7B, 0x0A, 0xE1, 0x0C, 0xC2, 0x10, 0xED, 0x10, 0x6B, 0xC1, 0xD9, 0x46, 0x9A,
+    0xC6, 0x37, 0xBF, 0x89, 0xE1, 0x82, 0x75, 0x9B, 0xA2, 0xBF, 0x34, 0xA6, 0x04, 0x02, 0x63, 0x0A,
+    0x20, 0x2A, 0xED, 0xD7, 0x6F, 0xC7, 0xF6, 0x89, 0xB5, 0xEE, 0x0F, 0xD6, 0x7A, 0x5B, 0xF5, 0x32,
+    0x1D, 0x63, 0x63, 0x62, 0xE2, 0xB6, 0xB6, 0x0D, 0x26, 0x26, 0x2A, 0x6B, 0x9B, 0xF5, 0x9A, 0x25,
+    0x18, 0xD3, 0xD0, 0xDD, 0x18, 0xB3, 0x7E, 0xD3, 0x4F, 0xE9, 0x53, 0x12, 0xB9, 0x31, 0x55, 0x14,
+    0x5B, 0x7B, 0x50, 0x75, 0x8B, 0x99, 0x1E, 0x04, 0x25, 0x22, 0xD3, 0xB8, 0xC9, 0xAC, 0x5B, 0xE3,
+    0xCD, 0x49, 0xF4, 0xC4, 0x05, 0xCF, 0xA2, 0xF8, 0x2E, 0x75, 0x77, 0x3F, 0x8B, 0x35, 0x88, 0x23,
+    0x44, 0x1F, 0xF0, 0xB3, 0x11, 0x5F, 0x19, 0xD1, 0xE4, 0x81, 0x19, 0x99, 0x92, 0x98, 0x57, 0xC6,
+    0xC8, 0x2E, 0x3A, 0x49, 0x3E, 0x2D, 0x8C, 0x16, 0xCD, 0x41, 0xDC, 0xBE, 0x79, 0xBA, 0xBB, 0xFE,
+    0x61, 0x82, 0x69, 0xA0, 0x03, 0x91, 0xC3, 0x33, 0x46, 0xAD, 0xDF, 0xDA, 0x7B, 0x4D, 0x6C, 0xAF,
+    0xE9, 0x60, 0xCC, 0x43, 0x42, 0x97, 0x9F, 0x7E, 0x75, 0x0C, 0x37, 0x26, 0x45, 0xEA, 0x19, 0xA0,
+    0xFC, 0xCB, 0x40, 0x4E, 0xB0, 0x86, 0x58, 0xCE, 0x67, 0x33, 0xB8, 0xD8, 0x69, 0x6D, 0x8E, 0x4C,
+    0xF5, 0xCD, 0xE7, 0x04, 0x83, 0x4D, 0xA0, 0x67, 0xDB, 0x53, 0x48, 0x53, 0x88, 0x51, 0x76, 0x72,
+    0x97, 0xD8, 0xB3, 0xC8, 0x68, 0x38, 0xBC, 0xCC, 0x71, 0x85, 0xAD, 0xE5, 0x01, 0x9D, 0x2F, 0xC5,
+    0x67, 0xCE, 0x40, 0xBF, 0xE2, 0x65, 0x1E, 0xBB, 0x73, 0x1C, 0xE2, 0x0B, 0x28, 0x93, 0x2B, 0x53,
+    0x2A, 0x5B, 0xFC, 0x1C, 0x2C, 0x30, 0x15, 0x98, 0x26, 0xD8, 0xFD, 0xF2, 0x14, 0x66, 0x26, 0xD1,
+    0x71, 0xAF, 0xE7, 0x18, 0xC5, 0x36, 0xAD, 0x88, 0xDB, 0x5E, 0xDA, 0xF3, 0xD3, 0xA1, 0xCC, 0x70,
+    0xF4, 0xBC, 0x4C, 0xAE, 0xEC, 0x3F, 0x72, 0xF9, 0xD7, 0xB5, 0x34, 0x5A, 0x5E, 0x29, 0xD4, 0x1D,
+    0x36, 0x54, 0x07, 0x76, 0xA2, 0xD9, 0x80, 0x36, 0xB8, 0xCA, 0x02, 0x71, 0xAE, 0x15, 0x1F, 0x49,
+    0x1B, 0xC4, 0x03, 0xD2, 0x2B, 0x72, 0xB4, 0x4A, 0xD0, 0xF3, 0x52, 0xC6, 0x1C, 0x28, 0x9F, 0xD8,
+    0xAA, 0x41, 0xC4, 0x39, 0x3F, 0x7B, 0xAE, 0xC7, 0x73, 0x4E, 0x18, 0x64, 0x3C, 0x58, 0x69, 0x2C,
+    0x6E, 0x65, 0xEC, 0x55, 0xCB, 0x01, 0x7E, 0xA8, 0xED, 0xAB, 0xB5, 0xFE, 0xD8, 0x8E, 0xB6, 0x9F,
+    0xD7, 0xF0, 0xEB, 0xD1, 0xBD, 0x1A, 0xA3, 0x47, 0x46, 0xD6, 0xBE, 0xF1, 0x6B, 0x59, 0x51, 0x17,
+    0x36, 0x28, 0x69, 0xE2, 0x6A, 0x76, 0xB8, 0x15, 0x2F, 0xFD, 0xAD, 0x7C, 0xA1, 0x67, 0xBD, 0xD4,
+    0xD1, 0x9B, 0x73, 0x70, 0xEF, 0x3F, 0xA2, 0x1E, 0xBE, 0xBF, 0x46, 0x61, 0x0C, 0x4B, 0x9B, 0x20,
+    0x25, 0x4A, 0x9B, 0x24, 0x1A, 0x63, 0xA1, 0xB1, 0x4D, 0x22, 0x28, 0xC2, 0xDE, 0xFE, 0x49, 0xBB,
+    0xD5, 0x68, 0x41, 0x47, 0xF7, 0x1B, 0xA5, 0xD9, 0xDC, 0x52, 0xB9, 0xF9, 0x6D, 0x75, 0x67, 0x7F,
+    0xD2, 0x2B, 0x1F, 0xB3, 0x13, 0x27, 0x28, 0x28, 0x37, 0x85, 0x64, 0x4F, 0x27, 0x36, 0x32, 0xC5,
+    0x40, 0x64, 0x5B, 0xDB, 0x32, 0xC7, 0xF9, 0x19, 0xC1, 0x05, 0x53, 0xF5, 0x4D, 0x46, 0xA6, 0xB5,
+    0xBD, 0xBB, 0xD9, 0xA0, 0x27, 0x1F, 0xEC, 0x8B, 0x2A, 0xC8, 0x30, 0x11, 0xE3, 0x18, 0x9C, 0x84,
+    0xB2, 0xF5, 0x62, 0xCC, 0xC0, 0x49, 0x8F, 0x77, 0x7D, 0x13, 0xF7, 0x33, 0xBC, 0xBE, 0x9E, 0x18,
+    0x36, 0xE0, 0x34, 0x9C, 0x9C, 0x03, 0x70, 0x73, 0xF6, 0x10, 0x1B, 0x19, 0x58, 0x20, 0xD9, 0x17,
+    0x88, 0xA4, 0x52, 0xDB, 0x79, 0xDF, 0x20, 0xA0, 0xC4, 0x5F, 0xCA, 0x57, 0xBC, 0x7B, 0x8B, 0x5D,
+    0xAE, 0x0F, 0x5A, 0x62, 0x17, 0x08, 0xEF, 0xE8, 0x39, 0x78, 0x3A, 0x82, 0x2C, 0x22, 0x28, 0x3E,
+    0x51, 0x11, 0xA0, 0x57, 0x06, 0xA8, 0xCB, 0x40, 0x94, 0x65, 0xF0, 0x96, 0xAE, 0x82, 0xB7, 0xF3,
+    0x4A, 0xBD, 0xB3, 0x55, 0xA9, 0x6B, 0x97, 0x2B, 0xB5, 0x21, 0x2A, 0xD5, 0x88, 0x4A, 0x56, 0xA2,
+    0x96, 0x25, 0x1F, 0x2D, 0xEA, 0xD6, 0xF2, 0x0D, 0x65, 0xF5, 0xBE, 0x7F, 0x56, 0x31, 0x58, 0x15,
+    0xD5, 0xAA, 0xFB, 0xEB, 0xAA, 0xFC, 0xA0, 0x33, 0x3D, 0xD3, 0x09, 0x67, 0x3A, 0x45, 0x78, 0x29,
+    0x0F, 0xFB, 0x69, 0xD8, 0x8F, 0xC3, 0x1E, 0xDA, 0x22, 0x3E, 0xC1, 0x7D, 0x34, 0xA0, 0x24, 0x2B,
+    0x70, 0xCF, 0x1C, 0x5C, 0x7C, 0xED, 0x00, 0x8F, 0xFF, 0x0F, 0x78, 0x2A, 0xE2, 0x29, 0x0E, 0xF1,
+    0x2C, 0xFC, 0x3B, 0x1E, 0x49, 0xB2, 0x9D, 0xD5, 0xA4, 0xE3, 0xD4, 0xFC, 0xE2, 0x0B, 0x42, 0xB2,
+    0xC2, 0xD9, 0xDB, 0x93, 0xC4, 0xE4, 0x94, 0xD1, 0x21, 0x87, 0xC5, 0xE8, 0xB1, 0xE5, 0x42, 0xEA,
+    0x96, 0x6E, 0xE5, 0x72, 0xD5, 0x5C, 0xB6, 0x7B, 0xF2, 0x36, 0xB0, 0x46, 0xFA, 0xCA, 0x6B, 0xA4,
+    0xDB, 0x1F, 0xE4, 0xDD, 0x80, 0xD5, 0x07, 0x73, 0xF6, 0x43, 0x0A, 0xF7, 0x11, 0x3D, 0x8A, 0xFE,
+    0x2F, 0xEF, 0x57, 0xDC, 0x42, 0x46, 0xF0, 0x21, 0x9D, 0x29, 0xAD, 0x95, 0x9D, 0xBD, 0x80, 0x72,
+    0x5E, 0x33, 0x91, 0xBA, 0x5A, 0x1C, 0xA0, 0x13, 0xC3, 0xD8, 0xFF, 0x31, 0x9F, 0x86, 0x0E, 0xD1,
+    0x09, 0x11, 0x76, 0x10, 0x76, 0xED, 0x8A, 0xED, 0x46, 0xE7, 0x28, 0x42, 0x2E, 0xE8, 0x5C, 0x34,
+    0x31, 0x46, 0x39, 0xC3, 0x14, 0xA2, 0x39, 0x5F, 0x4A, 0xD2, 0x78, 0x8D, 0x69, 0x34, 0xFC, 0x7B,
+    0x0F, 0x96, 0x47, 0x11, 0x37, 0xE2, 0x00, 0xCE, 0x13, 0xEE, 0xF0, 0xBB, 0x85, 0x18, 0x32, 0xA9,
+    0x66, 0xBE, 0xC4, 0x4E, 0xC4, 0xDF, 0x5B, 0x69, 0x4E, 0x63, 0x25, 0xDD, 0x16, 0xBA, 0x83, 0xCE,
+    0xD7, 0x08, 0xE9, 0xBF, 0x89, 0x70, 0x13, 0xDD, 0x35, 0x51, 0x92, 0xE9, 0x54, 0x1C, 0x1D, 0xEC,
+    0x4C, 0x88, 0x0C, 0x5C, 0x1D, 0x47, 0xCA, 0x3F, 0x3C, 0x0E, 0x45, 0x4A, 0x2A, 0x7B, 0x3B, 0x2B,
+    0x79, 0x04, 0x7F, 0xAB, 0x80, 0xFC, 0x28, 0x45, 0x10, 0x9C, 0x7B, 0xAF, 0x62, 0x89, 0x4F, 0x2C,
+    0x98, 0x14, 0x91, 0xCA, 0x26, 0x18, 0xD3, 0xA4, 0x7D, 0x6A, 0x97, 0xCE, 0x08, 0xF6, 0x94, 0xD2,
+    0x12, 0x31, 0xF5, 0x19, 0x79, 0x79, 0xE4, 0xE9, 0x23, 0x31, 0x5F, 0x00, 0xD9, 0x1C, 0xB9, 0x5C,
+    0xA9, 0xD8, 0xD5, 0x43, 0xB4, 0xE6, 0x0F, 0x55, 0x3D, 0xC1, 0xDA, 0x9A, 0x8D, 0x44, 0xF2, 0x6F,
+    0x00, 0x49, 0x01, 0xCE, 0x62, 0xBC, 0xD5, 0xA0, 0x61, 0xA7, 0x65, 0x3B, 0x6E, 0x55, 0x28, 0x7E,
+    0xDF, 0x81, 0xBA, 0x43, 0x84, 0xEC, 0x0B, 0x97, 0xAE, 0x49, 0x3C, 0xF3, 0x78, 0x7C, 0xBF, 0xEB,
+    0x5F, 0xD1, 0x11, 0x7F, 0x48, 0xA7, 0xC4, 0xE2, 0x7E, 0x79, 0xF9, 0xAB, 0x54, 0xB2, 0xA0, 0x98,
+    0xB3, 0xD6, 0xF9, 0x24, 0x6A, 0xEC, 0xB2, 0x76, 0x1F, 0x7E, 0x32, 0xE4, 0x08, 0x4E, 0xEE, 0x40,
+    0x2C, 0xDF, 0x94, 0xE6, 0x70, 0xC1, 0x77, 0x70, 0xBA, 0x8D, 0x50, 0xA1, 0x2B, 0xE3, 0x4D, 0x2F,
+    0x2D, 0xDC, 0x5C, 0x8B, 0xA7, 0x4C, 0x9C, 0xA3, 0x9F, 0x23, 0xCA, 0xA0, 0xB8, 0x0F, 0xD8, 0x1C,
+    0x36, 0x0C, 0x6F, 0x34, 0x64, 0x30, 0xA2, 0x04, 0xFF, 0xFF, 0xFC, 0x09, 0xB5, 0x55, 0xBF, 0x6F,
+    0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC7, 0xCE, 0x22, 0x6F, 0x9C, 0xA1, 0x30, 0x05, 0xD6, 0xC9, 0x1B,
+    0xC0, 0x42, 0x11, 0x24, 0xB7, 0x42, 0x72, 0xE1, 0x62, 0xCF, 0xBB, 0x47, 0x84, 0x22, 0x14, 0x7E,
+    0x5C, 0x01, 0x88, 0x3F, 0x80, 0x82, 0x2E, 0x29, 0x22, 0x71, 0xC5, 0xC5, 0xB7, 0x81, 0x82, 0x22,
+    0x80, 0x53, 0xD0, 0x20, 0x90, 0x12, 0x09, 0x09, 0xF1, 0xA3, 0x31, 0x52, 0x0A, 0x17, 0x87, 0x3D,
+    0xCE, 0x29, 0x82, 0x8E, 0xB5, 0x4E, 0x74, 0x48, 0x19, 0x30, 0x52, 0x24, 0x0A, 0x98, 0x24, 0x2B,
+    0x79, 0x89, 0xE6, 0x6E, 0x78, 0xB3, 0x77, 0x26, 0x26, 0xA4, 0x40, 0x42, 0xCC, 0xCE, 0xDC, 0xCD,
+    0xAF, 0xFD, 0xE6, 0xCD, 0xF7, 0xBE, 0xF7, 0x16, 0x80, 0xB0, 0xC5, 0xFC, 0x17, 0x2D, 0x1C, 0x28,
+    0x57, 0x11, 0xC7, 0x88, 0xEB, 0x68, 0x0B, 0x14, 0x41, 0x56, 0xF8, 0x3B, 0x9A, 0xDF, 0xD6, 0x6C,
+    0x4F, 0xC1, 0xE6, 0xE8, 0x4A, 0x24, 0x12, 0x51, 0x86, 0x28, 0x45, 0x02, 0x36, 0x42, 0x62, 0x90,
+    0x28, 0x3C, 0x45, 0x38, 0xA9, 0x16, 0x17, 0x8A, 0xF0, 0x5A, 0x31, 0xDD, 0x9C, 0xA0, 0xB5, 0x71,
+    0x82, 0x70, 0x42, 0xC4, 0x22, 0xDD, 0xF0, 0x65, 0xC1, 0x95, 0x66, 0xB7, 0x34, 0xAC, 0x46, 0x57,
+    0x21, 0xC9, 0x11, 0x4A, 0x88, 0x0A, 0xAA, 0x8B, 0xA7, 0x09, 0xA7, 0x40, 0x92, 0x61, 0x1A, 0xAD,
+    0xD0, 0xD3, 0xD1, 0x49, 0x9D, 0x9C, 0xD4, 0xFF, 0xDD, 0x24, 0xCC, 0x61, 0x8E, 0x69, 0x6C, 0x04,
+    0x92, 0xAB, 0x47, 0x31, 0x93, 0x1E, 0x44, 0x5C, 0x40, 0x90, 0x8A, 0x54, 0xC0, 0x97, 0x21, 0x78,
+    0x5E, 0x07, 0xD3, 0x0D, 0xA0, 0x8C, 0x81, 0xF3, 0x1D, 0x20, 0x29, 0x81, 0x90, 0x9A, 0x28, 0x00,
+    0x9F, 0x0C, 0xE1, 0xD4, 0x02, 0x05, 0x67, 0xF2, 0x8C, 0xCD, 0x20, 0x86, 0xB4, 0x44, 0x43, 0x68,
+    0xB4, 0x7D, 0xE9, 0xA9, 0x08, 0x22, 0xC3, 0x03, 0xCA, 0x09, 0x88, 0xEA, 0x09, 0xB2, 0x05, 0x70,
+    0xD9, 0x80, 0xA7, 0x1A, 0x60, 0x05, 0xE1, 0x9B, 0x1E, 0x9D, 0x43, 0xF8, 0x74, 0x69, 0x84, 0x84,
+    0x2D, 0x26, 0xF8, 0x41, 0x0E, 0xC7, 0x09, 0xBA, 0x74, 0x86, 0xA5, 0x2E, 0x6D, 0x99, 0x21, 0xE4,
+    0x07, 0xB2, 0xB2, 0x84, 0xE5, 0x73, 0x88, 0xC7, 0xB5, 0xED, 0x6A, 0xA7, 0x8D, 0x5E, 0x0C, 0x93,
+    0x7C, 0x6C, 0x42, 0xDB, 0xF3, 0xFF, 0xA0, 0x63, 0xEE, 0xD5, 0x3A, 0x1F, 0xE8, 0xF3, 0x49, 0xF0,
+    0x53, 0xEB, 0xD5, 0xEA, 0xDD, 0x29, 0x64, 0x79, 0x6D, 0x96, 0xC9, 0xEA, 0x47, 0xC5, 0xFE, 0xEF,
+    0x32, 0xFA, 0x04, 0x4C, 0xA2, 0x06, 0x4F, 0x26, 0xD6, 0xDC, 0xFD, 0xF2, 0x53, 0xF2, 0x0D, 0x40,
+    0x8C, 0x14, 0x44, 0x0E, 0xB9, 0xD6, 0x75, 0x4B, 0xF8, 0x0A, 0x61, 0x86, 0x55, 0x30, 0xEA, 0x1A,
+    0x60, 0x9D, 0x76, 0x93, 0x6D, 0x54, 0xB6, 0xCC, 0x3A, 0xC6, 0x8F, 0x9E, 0x3C, 0x06, 0x87, 0xF1,
+    0x10, 0xBD, 0x4B, 0x87, 0x8B, 0xB7, 0xC9, 0xE8, 0x55, 0x77, 0xB5, 0x57, 0x1E, 0xB9, 0x9F, 0xA1,
+    0x29, 0x6A, 0xF4, 0x2E, 0xF8, 0x6D, 0xBA, 0xB5, 0xF8, 0x9E, 0x46, 0x49, 0xEC, 0xA6, 0x1C, 0xE7,
+    0x77, 0x7E, 0x48, 0x69, 0xCA, 0x92, 0x56, 0x62, 0x72, 0xA2, 0xD1, 0x2C, 0xE7, 0x77, 0x24, 0xCF,
+    0x68, 0xD7, 0x11, 0xB7, 0x6B, 0x03, 0x66, 0xB4, 0x95, 0xF3, 0x3D, 0x3B, 0x82, 0xB8, 0x41, 0x32,
+    0x48, 0x52, 0xB4, 0xE6, 0x10, 0x48, 0xD2, 0x11, 0xD9, 0x69, 0xC8, 0x55, 0xF7, 0x0A, 0x19, 0x39,
+    0x45, 0x96, 0x7C, 0xAD, 0xE1, 0xF5, 0x25, 0x02, 0xBA, 0xDA, 0xF1, 0x64, 0x94, 0xAE, 0xEB, 0xE0,
+    0xD9, 0xBE, 0x0C, 0x84, 0xC0, 0xF1, 0x98, 0x8E, 0xD0, 0xD6, 0xBE, 0x33, 0xB0, 0xBF, 0x88, 0x94,
+    0x84, 0x32, 0x4F, 0x7A, 0x70, 0xD7, 0x5E, 0x71, 0x9E, 0xE5, 0x79, 0x40, 0x60, 0x3D, 0xDF, 0x39,
+    0xA7, 0x4F, 0x96, 0xB1, 0xBB, 0xCE, 0x0B, 0x4E, 0x23, 0xE0, 0xC6, 0xC1, 0x8F, 0x2A, 0x0E, 0x68,
+    0x19, 0x5D, 0x37, 0x4E, 0xCE, 0xD0, 0xF6, 0xA4, 0xEF, 0x34, 0x24, 0xBB, 0x4E, 0x29, 0x24, 0x23,
+    0xF2, 0xB0, 0x35, 0x41, 0x81, 0xC8, 0xD2, 0x1A, 0xB7, 0xD9, 0xE4, 0xEE, 0x40, 0xCE, 0x65, 0x40,
+    0xBC, 0xC5, 0x0B, 0x60, 0x03, 0x59, 0x09, 0x6E, 0x05, 0x8E, 0x68, 0xD8, 0x14, 0xF5, 0x0E, 0xFC,
+    0x6B, 0x0A, 0x85, 0xF8, 0x30, 0x71, 0xF0, 0x5E, 0x39, 0xBE, 0x8D, 0x6F, 0x6D, 0x97, 0xA2, 0xE8,
+    0xAF, 0x7F, 0x30, 0x6B, 0xED, 0x4D, 0x6A, 0x0E, 0x95, 0x5B, 0x37, 0x6B, 0x55, 0xB5, 0x53, 0xD8,
+    0xC9, 0x8A, 0x2D, 0xEF, 0x1F, 0x2F, 0x7A, 0x2F, 0x61, 0x37, 0x5B, 0x56, 0x47, 0x96, 0xF9, 0xFB,
+    0xD8, 0x4D, 0x97, 0xF2, 0xD9, 0x25, 0xFE, 0x22, 0x06, 0xE3, 0xCE, 0x0B, 0x18, 0xE0, 0x19, 0x59,
+    0x3B, 0xEB, 0xD7, 0x58, 0x45, 0x23, 0x01, 0x0E, 0x5D, 0xDB, 0xE7, 0xF3, 0xE0, 0x78, 0x14, 0xBD,
+    0xAB, 0x4D, 0x72, 0x4A, 0x45, 0x6B, 0x03, 0x6D, 0x56, 0x93, 0x74, 0xFF, 0x7F, 0x7F, 0x7E, 0x94,
+    0x9C, 0xFE, 0xB9, 0xEC, 0x86, 0x7D, 0x1A, 0xBC, 0xBC, 0x5D, 0x6E, 0x46, 0x6B, 0xBB, 0xC5, 0x30,
+    0x21, 0x1E, 0xCD, 0x2A, 0xED, 0x2C, 0xF6, 0x77, 0x6F, 0x46, 0xDF, 0xDE, 0x32, 0xD5, 0x74, 0x74,
+    0x7A, 0xA7, 0x5C, 0x75, 0xC0, 0xE7, 0x0E, 0xD4, 0xA5, 0xFD, 0xBA, 0x8C, 0xF9, 0xCD, 0xCF, 0x49,
+    0xA2, 0xD4, 0xF9, 0xB7, 0xB5, 0x06, 0x52, 0xE2, 0xB8, 0xF0, 0x8C, 0xB4, 0xE3, 0xE6, 0xD4, 0xC1,
+    0xEE, 0x57, 0xBF, 0x5E, 0xB4, 0x36, 0x8D, 0x5D, 0x38, 0xF3, 0x4A, 0xF7, 0xE3, 0xEE, 0x6F, 0xDC,
+    0x9A, 0xF9, 0xDE, 0x7D, 0xB3, 0xC4, 0x87, 0x57, 0x21, 0xD9, 0x92, 0x58, 0xC7, 0x96, 0x95, 0x91,
+    0xD5, 0xC2, 0x0E, 0x89, 0xF6, 0x26, 0xB1, 0xBE, 0x65, 0xCB, 0xC4, 0x5A, 0xA2, 0xB9, 0x6F, 0xED,
+    0x2D, 0x4B, 0x66, 0xFA, 0x69, 0xF7, 0xD4, 0xB0, 0x7B, 0x92, 0x52, 0xCF, 0x5C, 0xA7, 0x37, 0xAC,
+    0x1A, 0x5A, 0xEC, 0x94, 0x14, 0x69, 0xA3, 0xC7, 0x4A, 0xFF, 0x46, 0x1E, 0x65, 0x9B, 0x6C, 0x8F,
+    0x48, 0xF6, 0xA7, 0x53, 0xDE, 0x3C, 0xCA, 0xB6, 0xDF, 0x40, 0xFE, 0x5A, 0xBA, 0x3E, 0x2B, 0xCF,
+    0x79, 0x6A, 0x6C, 0x3B, 0x59, 0x19, 0xD0, 0x72, 0xE6, 0xAC, 0x60, 0x3B, 0xCF, 0xE1, 0xF6, 0x63,
+    0x47, 0xAF, 0x7E, 0xF4, 0x7A, 0xFC, 0xC4, 0x93, 0x0D, 0xFF, 0xA2, 0x0B, 0xBE, 0x7B, 0xBC, 0xFF,
+    0x8D, 0x58, 0x67, 0xE4, 0x21, 0xA8, 0x63, 0xA2, 0xA9, 0x3B, 0x0B, 0x5C, 0x16, 0x71, 0xD0, 0x54,
+    0xEB, 0xB3, 0xBC, 0xCA, 0x53, 0x8B, 0xA1, 0xA7, 0x62, 0xEA, 0x1E, 0xAB, 0xF1, 0xBE, 0x0A, 0x05,
+    0xAE, 0xB6, 0xBD, 0xED, 0x49, 0xB8, 0x2C, 0xCE, 0x30, 0xD9, 0x09, 0xB9, 0x3A, 0xE1, 0x67, 0x5A,
+    0x78, 0xB2, 0xCD, 0xB3, 0x2B, 0xB5, 0x6A, 0xA1, 0x45, 0x79, 0xE4, 0x2D, 0xB9, 0xD1, 0xC0, 0xC3,
+    0x4C, 0xD6, 0x79, 0xDE, 0x40, 0xC1, 0x4A, 0x7A, 0x14, 0x4B, 0x89, 0x13, 0x9E, 0x7B, 0xCA, 0x53,
+    0x42, 0x1A, 0x21, 0x63, 0x64, 0xE3, 0x80, 0xC3, 0x9B, 0x28, 0xBD, 0x2B, 0x5C, 0x0B, 0xF9, 0x0D,
+    0xC4, 0xB6, 0xA9, 0xF2, 0x7C, 0x40, 0x01, 0x68, 0x98, 0x71, 0x31, 0xD1, 0x75, 0x81, 0x72, 0x39,
+    0x47, 0xC4, 0x6C, 0x39, 0xCD, 0xB5, 0x3F, 0x42, 0x91, 0xD0, 0x57, 0x21, 0xBC, 0xD0, 0x12, 0xB6,
+    0x69, 0x88, 0x5F, 0x17, 0x49, 0xF6, 0x32, 0xC9, 0x3B, 0x51, 0x5B, 0x14, 0xB3, 0xC6, 0xB3, 0xA0,
+    0x4A, 0x29, 0x71, 0x2B, 0x6F, 0x25, 0x2A, 0x2A, 0xE9, 0xC5, 0xAC, 0x4A, 0xCC, 0x70, 0xA1, 0x0F,
+    0xA4, 0x31, 0x97, 0xE3, 0xDA, 0xF1, 0x65, 0x27, 0x90, 0x3D, 0xAA, 0x42, 0x4E, 0x51, 0xB2, 0x8A,
+    0xFA, 0x86, 0x3E, 0x10, 0x8B, 0x60, 0x0A, 0x67, 0x72, 0x61, 0xF5, 0x46, 0x57, 0x35, 0x6F, 0xCA,
+    0x60, 0x2D, 0xAB, 0xD7, 0xB1, 0x51, 0x7A, 0xBB, 0xB9, 0xB8, 0x8C, 0x95, 0x02, 0x56, 0x52, 0x34,
+    0x47, 0x12, 0x9B, 0x2E, 0xD0, 0x28, 0x1B, 0x93, 0xC5, 0x2D, 0x77, 0x6F, 0x4A, 0xC8, 0x74, 0xC0,
+    0x10, 0x7E, 0x89, 0x50, 0x91, 0xF4, 0xF7, 0xC8, 0xEF, 0xC0, 0x59, 0xEF, 0x03, 0xB6, 0x63, 0x75,
+    0x70, 0xA9, 0x62, 0x87, 0x5C, 0xF3, 0xDE, 0x25, 0x1C, 0x52, 0x55, 0xEA, 0x3E, 0x7C, 0x1D, 0x38,
+    0x3C, 0x45, 0x07, 0xCA, 0xC7, 0x9F, 0xFF, 0x71, 0x67, 0xE4, 0x29, 0x3F, 0x5F, 0x1D, 0x7C, 0xF6,
+    0xDD, 0x75, 0x96, 0x4D, 0x74, 0xE8, 0x55, 0x4A, 0x74, 0xA1, 0x95, 0xBB, 0x2C, 0xEA, 0x74, 0x1D,
+    0xFF, 0xC3, 0xD7, 0x5E, 0xEE, 0xF4, 0xE6, 0x96, 0xDB, 0xD5, 0xF2, 0xFF, 0x52, 0xFE, 0x04, 0x65,
+    0x55, 0x3D, 0x6C, 0x14, 0x47, 0x14, 0xFE, 0x76, 0x27, 0xF6, 0x08, 0xAF, 0xB9, 0x75, 0x11, 0x10,
+    0xC1, 0x17, 0x36, 0x12, 0x2E, 0xAC, 0x08, 0xBC, 0x56, 0x42, 0x61, 0xA1, 0xB3, 0x77, 0x23, 0x0A,
+    0xA4, 0x38, 0x4A, 0x28, 0x20, 0x88, 0x54, 0x28, 0xA9, 0xA8, 0x70, 0xE1, 0x82, 0xC2, 0x70, 0x83,
+    0xE9, 0x52, 0x59, 0x51, 0x24, 0xBA, 0xC4, 0xCA, 0x8F, 0x94, 0x88, 0x02, 0x4B, 0x41, 0x8A, 0x15,
+    0x1D, 0xDC, 0x80, 0xD3, 0xA5, 0x59, 0xA0, 0x20, 0x52, 0x9A, 0x15, 0x98, 0x20, 0x41, 0x91, 0x49,
+    0xD8, 0x28, 0x67, 0x6B, 0xEF, 0x26, 0xDF, 0xEC, 0xC5, 0xD8, 0x22, 0xA3, 0xFD, 0xDE, 0xED, 0xCD,
+    0xBE, 0x99, 0x79, 0x3F, 0xDF, 0x7B, 0x03, 0xB8, 0x31, 0xBA, 0x8E, 0xD1, 0x25, 0x61, 0x4B, 0x69,
+    0x8B, 0x09, 0xBF, 0x33, 0x2D, 0x8B, 0x11, 0xAF, 0x48, 0x85, 0x81, 0xC8, 0x21, 0x34, 0x02, 0x85,
+    0x10, 0x98, 0x01, 0x1A, 0x40, 0x01, 0xCF, 0x40, 0x6A, 0x84, 0x29, 0x2E, 0x02, 0x2D, 0xC8, 0x1C,
+    0x61, 0xE6, 0xF5, 0xE0, 0x77, 0x11, 0xB8, 0x57, 0xC4, 0x40, 0xE2, 0x3E, 0xA0, 0x84, 0xCF, 0x0D,
+    0x4C, 0xB5, 0x5A, 0x61, 0xC7, 0xE0, 0x06, 0x7E, 0x8E, 0x80, 0x7B, 0x68, 0xC4, 0xA9, 0xD3, 0x3E,
+    0x59, 0x3D, 0x1C, 0xB2, 0xCB, 0xD5, 0x56, 0xE3, 0x86, 0x34, 0x0D, 0x9A, 0xC0, 0xF3, 0x3A, 0xC4,
+    0xAA, 0x3B, 0x97, 0x30, 0x0D, 0x2E, 0x5C, 0xE0, 0xCA, 0x05, 0xAE, 0x5B, 0xE0, 0x89, 0x2D, 0xBF,
+    0x20, 0xCC, 0x0B, 0x94, 0xDE, 0x12, 0x5E, 0xA9, 0x36, 0x3A, 0xE1, 0x75, 0x3C, 0xE3, 0x97, 0x7E,
+    0x21, 0x4A, 0x41, 0xF4, 0x0F, 0x3E, 0x9F, 0x03, 0xD6, 0xA6, 0xB8, 0x20, 0x8D, 0xFF, 0x33, 0xFD,
+    0xA1, 0x6D, 0xBA, 0x41, 0x73, 0xE8, 0xDC, 0x2A, 0xDD, 0x9C, 0xE6, 0x44, 0x84, 0x05, 0x44, 0x69,
+    0x84, 0x58, 0x49, 0xDD, 0x54, 0x9E, 0x89, 0x14, 0x5A, 0x92, 0x4E, 0x79, 0x05, 0x75, 0x2F, 0xD2,
+    0x9D, 0xD7, 0x80, 0x7D, 0xFD, 0x13, 0x10, 0xA9, 0x69, 0xFA, 0x1C, 0x29, 0x51, 0xD2, 0x73, 0xBB,
+    0xD3, 0x43, 0xD4, 0xAB, 0x58, 0x4D, 0x01, 0xF3, 0xC0, 0x0A, 0x90, 0xC3, 0xCB, 0x82, 0x45, 0x1D,
+    0xAE, 0xF1, 0x51, 0x03, 0xB3, 0xA9, 0x0B, 0x27, 0x9F, 0x03, 0xC0, 0xA1, 0x4A, 0xF1, 0x02, 0x70,
+    0x83, 0xEE, 0x9D, 0xC0, 0x9F, 0xC6, 0x7F, 0x68, 0xC4, 0xFD, 0x82, 0xD6, 0x30, 0xC6, 0x41, 0xA5,
+    0x18, 0x01, 0x13, 0xA0, 0x71, 0x4E, 0x71, 0x0E, 0x48, 0x81, 0x5D, 0x57, 0x06, 0xDE, 0x3A, 0x78,
+    0x70, 0xF2, 0x93, 0xF7, 0x63, 0xFD, 0x0D, 0xCD, 0x11, 0xEA, 0xD7, 0xB1, 0xB5, 0xDE, 0xDE, 0xAC,
+    0xEE, 0x69, 0x88, 0xEF, 0x26, 0x05, 0x12, 0x35, 0x34, 0xF2, 0x75, 0x77, 0x3F, 0x82, 0x7B, 0xE9,
+    0xD1, 0x2B, 0x9F, 0x4E, 0xBE, 0x3D, 0x1B, 0x65, 0x23, 0x40, 0x5B, 0x4B, 0x8C, 0x23, 0x17, 0x69,
+    0x1D, 0x2B, 0x42, 0x0F, 0xA9, 0xCB, 0x8B, 0xEF, 0x0A, 0x33, 0xB6, 0xAC, 0xD7, 0x66, 0x65, 0x51,
+    0x53, 0x77, 0xAE, 0x88, 0xDD, 0xF5, 0xC8, 0xE0, 0xF6, 0x47, 0x81, 0x19, 0x3B, 0xC7, 0x30, 0x89,
+    0x62, 0x22, 0x4C, 0x1B, 0x0B, 0x34, 0x49, 0x3C, 0xD0, 0xE1, 0x79, 0x4C, 0xB7, 0xB0, 0x69, 0xC4,
+    0x33, 0x1D, 0xB6, 0x31, 0x33, 0x90, 0x8E, 0x4D, 0xCE, 0xED, 0xFB, 0x6A, 0xF8, 0xD1, 0x7B, 0x0F,
+    0x87, 0x4D, 0x7D, 0xA5, 0x71, 0xA9, 0x4C, 0x8A, 0x20, 0x63, 0x72, 0x06, 0x71, 0x76, 0x08, 0xCB,
+    0x43, 0xA2, 0xFB, 0xA6, 0x8A, 0x17, 0x6B, 0x98, 0x1B, 0xF2, 0xB2, 0x0B, 0x13, 0xC2, 0xEE, 0x39,
+    0xB1, 0x3F, 0xDD, 0x85, 0x37, 0x76, 0x85, 0xD9, 0x10, 0x7E, 0xE8, 0xEE, 0x61, 0x80, 0x86, 0xB0,
+    0x20, 0xE6, 0xC6, 0xB5, 0xD5, 0x75, 0xFA, 0xE4, 0x8C, 0x5E, 0x87, 0xDE, 0x7D, 0xF4, 0x3E, 0x77,
+    0x59, 0x12, 0xAB, 0xB5, 0xF1, 0xC9, 0xC9, 0xBB, 0xB7, 0xBB, 0x48, 0x93, 0xE5, 0x41, 0x2C, 0xEF,
+    0x46, 0x56, 0xF7, 0x99, 0x27, 0x0C, 0xA4, 0x1F, 0x2F, 0x8A, 0xA1, 0xF1, 0x50, 0xDF, 0x5D, 0x3B,
+    0x2E, 0x0B, 0x60, 0x30, 0xFD, 0xEC, 0x98, 0x1C, 0x1E, 0x3E, 0x32, 0xD7, 0xD4, 0x32, 0x28, 0x06,
+    0x80, 0x65, 0x99, 0x36, 0xBC, 0x2C, 0xC4, 0x94, 0xEF, 0x04, 0x43, 0x9E, 0x36, 0x60, 0x84, 0x0E,
+    0x19, 0xB9, 0x1B, 0x7E, 0x26, 0x95, 0x7B, 0x29, 0xBC, 0x9C, 0x33, 0xCC, 0xF0, 0x34, 0x5A, 0xE3,
+    0x4C, 0x8F, 0xF1, 0x32, 0xA1, 0x83, 0xB4, 0xE6, 0x74, 0xBC, 0xBC, 0xAF, 0xD3, 0x5F, 0xE3, 0xE5,
+    0x81, 0x3A, 0x0C, 0x23, 0xF5, 0x04, 0x0A, 0xA9, 0x67, 0x48, 0x93, 0x3E, 0x8B, 0xC5, 0x9A, 0xC6,
+    0x81, 0x1A, 0xF3, 0x3A, 0x0F, 0x71, 0x87, 0x24, 0xB6, 0xCA, 0xB3, 0x16, 0xC9, 0xEF, 0xEB, 0xBE,
+    0x0D, 0x10, 0x91, 0xAF, 0xDD, 0xBB, 0xB9, 0xFC, 0x2D, 0x48, 0xE3, 0x46, 0x03, 0x65, 0x6E, 0xC4,
+    0x3F, 0xC7, 0x55, 0x58, 0x1E, 0x42, 0x62, 0x0C, 0xEC, 0x9A, 0xF2, 0xAD, 0xBD, 0x2E, 0xAC, 0x2D,
+    0x03, 0x6B, 0x4D, 0x64, 0xAD, 0xFE, 0xC9, 0x6E, 0xB8, 0x5D, 0x6A, 0x4C, 0xF4, 0xFC, 0x14, 0xFC,
+    0xDB, 0xD9, 0x36, 0x89, 0x46, 0x7B, 0x88, 0xAD, 0x09, 0x37, 0xCE, 0x88, 0x0E, 0x70, 0x09, 0xAE,
+    0x5C, 0x48, 0x43, 0x57, 0x60, 0xC2, 0xF8, 0x67, 0x12, 0x24, 0x8F, 0x8C, 0xC8, 0x12, 0x35, 0x25,
+    0x7A, 0x42, 0xC5, 0xB6, 0x6D, 0xAC, 0xB5, 0x6E, 0xD7, 0x98, 0xD6, 0x9C, 0xB7, 0x4B, 0x3B, 0xD8,
+    0x18, 0xE7, 0xDC, 0x28, 0x0B, 0xB2, 0xC0, 0xB1, 0x2C, 0x40, 0xC5, 0xB7, 0xC8, 0x96, 0x34, 0x5B,
+    0x7B, 0x79, 0xC5, 0xC4, 0xD0, 0x96, 0x4C, 0xB9, 0x26, 0xF9, 0x5D, 0x5D, 0xB2, 0xAA, 0x44, 0x55,
+    0x88, 0xBD, 0x63, 0xB4, 0x94, 0x4C, 0x0F, 0x53, 0x9A, 0x10, 0xA5, 0xAC, 0x23, 0x8A, 0x9E, 0x13,
+    0x96, 0x66, 0x08, 0x9B, 0x52, 0xFC, 0xA1, 0x63, 0xC8, 0x27, 0x59, 0x02, 0xF9, 0xC8, 0x24, 0x68,
+    0xD3, 0x88, 0xD2, 0x3A, 0x11, 0xE4, 0x37, 0x13, 0x96, 0xC7, 0x8C, 0x13, 0x71, 0x13, 0x61, 0x1E,
+    0xF6, 0x28, 0x02, 0x0A, 0x23, 0x9D, 0xE0, 0x3E, 0x9E, 0xDD, 0x40, 0x65, 0x84, 0x91, 0x86, 0x4D,
+    0xC1, 0x70, 0x71, 0xEF, 0xF4, 0xDF, 0x1F, 0x6E, 0xF8, 0x66, 0xD0, 0x30, 0x4E, 0x39, 0xA1, 0xC4,
+    0xE6, 0xE7, 0xAE, 0x89, 0xFC, 0x1F, 0xC5, 0x36, 0x92, 0x75, 0x38, 0x17, 0x98, 0x1E, 0xC1, 0x12,
+    0x06, 0xF4, 0xEB, 0x14, 0x93, 0x42, 0xB9, 0x3A, 0xA4, 0x7F, 0x92, 0x51, 0x8B, 0x2F, 0xD3, 0x91,
+    0x99, 0xE5, 0x66, 0x97, 0x53, 0x91, 0x4D, 0x25, 0x82, 0xC7, 0x06, 0x85, 0x6F, 0x26, 0x10, 0x67,
+    0x2D, 0xA9, 0xBD, 0x6E, 0xEC, 0xDA, 0xDA, 0x2F, 0xEC, 0x2C, 0xE9, 0x73, 0x13, 0xA5, 0xCD, 0xB2,
+    0x94, 0x79, 0x62, 0x13, 0xAF, 0xA4, 0xAD, 0xAC, 0xD1, 0x23, 0x2C, 0xE8, 0x79, 0xEE, 0xBA, 0x52,
+    0xEB, 0xC3, 0x84, 0x42, 0xE5, 0xF4, 0xB2, 0xEB, 0x10, 0x84, 0x0F, 0x33, 0xF9, 0xC1, 0x5F, 0x5A,
+    0x7E, 0xF1, 0x5C, 0x8B, 0x9B, 0x3F, 0x6A, 0x51, 0x36, 0xD9, 0x13, 0x12, 0xE5, 0x77, 0x92, 0xD4,
+    0x2F, 0x62, 0x36, 0x98, 0xA8, 0xC2, 0xB7, 0x69, 0xD5, 0x7E, 0x06, 0xEC, 0xF5, 0x3C, 0xEC, 0xA0,
+    0x08, 0x0B, 0x34, 0xFA, 0x18, 0x3B, 0x14, 0x9A, 0xC6, 0x4E, 0x30, 0x3C, 0x87, 0x88, 0x08, 0x91,
+    0x09, 0x1E, 0x37, 0xCF, 0x32, 0x0E, 0xC0, 0xDE, 0x76, 0xD5, 0x79, 0x7C, 0x8D, 0xC1, 0x5B, 0x4B,
+    0x68, 0xF7, 0x5C, 0x3F, 0x90, 0xCF, 0xC9, 0xBD, 0x0E, 0xA6, 0x22, 0x15, 0x60, 0x15, 0xE4, 0x6B,
+    0xC8, 0x9F, 0x22, 0x52, 0x92, 0x93, 0x31, 0xE3, 0x71, 0xEE, 0x55, 0xC9, 0xF0, 0x36, 0x6D, 0xBF,
+    0xFF, 0xF9, 0xD6, 0xB0, 0xC5, 0x7B, 0xA5, 0xE7, 0xBA, 0xF3, 0xB4, 0x8B, 0x3C, 0x4E, 0x3F, 0x55,
+    0x8C, 0xD8, 0x40, 0xBB, 0x23, 0xEC, 0xF7, 0x10, 0xE4, 0x5E, 0xA7, 0xE2, 0x97, 0xAB, 0x2E, 0x7E,
+    0x8D, 0xC8, 0x88, 0xB6, 0x0B, 0xE8, 0x9E, 0x53, 0xA7, 0x4E, 0x26, 0xF4, 0xD4, 0x61, 0xC4, 0xA9,
+    0x55, 0xB8, 0x07, 0x47, 0x01, 0x8C, 0x6E, 0x50, 0x99, 0x61, 0x7E, 0xF2, 0x24, 0x85, 0xE4, 0xFF,
+    0xA8, 0xE8, 0xFF, 0xBF, 0xEA, 0x42, 0x4F, 0x04, 0x66, 0x1B, 0xCD, 0x9E, 0xD3, 0xA1, 0x37, 0x0B,
+    0x5E, 0x4B, 0x3A, 0x9A, 0xD0, 0x94, 0xE9, 0xC1, 0xEB, 0x4F, 0xAF, 0x6D, 0xA2, 0xE5, 0x95, 0x20,
+    0x7D, 0x15, 0x29, 0xC4, 0x7B, 0xE4, 0xE9, 0x09, 0x77, 0x81, 0x54, 0x9C, 0x7F, 0xF9, 0xC5, 0x55,
+    0x48, 0x77, 0xEB, 0x05, 0x6C, 0x6C, 0xD8, 0xED, 0xAA, 0x92, 0xC1, 0x05, 0x67, 0xF6, 0x73, 0x75,
+    0xD3, 0x76, 0xD1, 0xBE, 0xEA, 0x21, 0x79, 0x87, 0x17, 0x8C, 0x9A, 0xA3, 0x66, 0x9D, 0x9C, 0x91,
+    0x5C, 0xCF, 0x0E, 0x99, 0xB0, 0xE1, 0x84, 0x3A, 0xDA, 0x3C, 0x66, 0x64, 0xBB, 0xC3, 0x89, 0x5B,
+    0xD4, 0x38, 0x2C, 0x3B, 0xF5, 0x30, 0xA5, 0x39, 0x39, 0x8B, 0xA7, 0xC3, 0x70, 0xF3, 0x32, 0xB3,
+    0xEB, 0xFD, 0x5A, 0xF1, 0x75, 0xD5, 0xEC, 0xD9, 0x3F, 0x37, 0x9C, 0xBF, 0xB4, 0xBD, 0x76, 0xAD,
+    0x6A, 0xF6, 0x37, 0x9D, 0xE8, 0xB8, 0xA3, 0xF3, 0xCA, 0x95, 0x2F, 0x89, 0xDE, 0x8B, 0x9A, 0xDB,
+    0x9E, 0x4A, 0x18, 0x03, 0xD8, 0xCC, 0x53, 0x5C, 0x6C, 0x2B, 0x91, 0x3A, 0x01, 0xCF, 0x39, 0xDA,
+    0x1F, 0x29, 0x6A, 0xEE, 0x92, 0x68, 0xF2, 0x78, 0xF1, 0x0C, 0xAD, 0x95, 0x60, 0x16, 0xC5, 0x4A,
+    0x38, 0x8B, 0xD5, 0xB9, 0xE0, 0x01, 0x92, 0x4D, 0xE6, 0x78, 0xD0, 0x2A, 0xBF, 0x52, 0x75, 0x29,
+    0xD8, 0x3A, 0x63, 0x2B, 0x25, 0x78, 0x91, 0x92, 0x2D, 0xE4, 0x7D, 0xC8, 0x97, 0x10, 0xEC, 0x48,
+    0xC7, 0x7F, 0xE3, 0x5F, 0x85, 0x55, 0xCF, 0x6B, 0x24, 0x45, 0x14, 0xFE, 0xBA, 0x6B, 0x93, 0x32,
+    0xB6, 0x93, 0xDE, 0xC3, 0x66, 0x09, 0xC9, 0x24, 0x3D, 0x87, 0x3D, 0x04, 0x4C, 0x32, 0x97, 0x1C,
+    0x72, 0xE8, 0x99, 0x69, 0xCD, 0x21, 0x27, 0x71, 0x41, 0x06, 0x61, 0x41, 0x3C, 0x28, 0x28, 0xEB,
+    0x21, 0x73, 0xC8, 0x21, 0x60, 0x74, 0x5A, 0xFF, 0x82, 0x2C, 0xFE, 0x01, 0xEE, 0xC1, 0x05, 0x89,
+    0x87, 0xCC, 0x41, 0x30, 0x60, 0x62, 0x2A, 0x09, 0xAC, 0x07, 0x0F, 0xE9, 0x31, 0xA7, 0x45, 0x85,
+    0x46, 0xE2, 0x65, 0x11, 0xB6, 0x84, 0x5E, 0xB6, 0x77, 0x99, 0xA4, 0xF6, 0xAB, 0xEE, 0x21, 0xAC,
+    0x08, 0x6B, 0x33, 0xD5, 0x5D, 0x3F, 0x5E, 0xBD, 0xF7, 0xBD, 0xF7, 0xBE, 0xF7, 0x66, 0xA2, 0xFD,
+    0xAE, 0x31, 0xE8, 0x41, 0xC4, 0x13, 0x9F, 0xBD, 0xC3, 0xD9, 0x86, 0xB3, 0x16, 0x75, 0x13, 0x79,
+    0x01, 0x27, 0x83, 0x54, 0x68, 0x40, 0xA6, 0xE8, 0x42, 0x6A, 0x00, 0x6E, 0x0C, 0xA1, 0x20, 0x0E,
+    0x63, 0xF1, 0x48, 0x79, 0xE7, 0xE8, 0x2A, 0x7C, 0x74, 0x5F, 0x09, 0x13, 0x4F, 0xE7, 0x9C, 0x57,
+    0x3E, 0x50, 0xA1, 0x38, 0xCC, 0xB8, 0x14, 0x19, 0xEC, 0x33, 0x09, 0x78, 0xBC, 0xA3, 0xE0, 0x5E,
+    0x40, 0x18, 0xED, 0x9A, 0xCF, 0xF1, 0xF8, 0x58, 0x85, 0x1D, 0x3D, 0x5B, 0x9D, 0x97, 0xAB, 0xD2,
+    0xE9, 0x1F, 0xAA, 0xF5, 0x4E, 0x67, 0xA6, 0x5A, 0x15, 0x2B, 0x12, 0xE9, 0x91, 0x5A, 0x5E, 0xEA,
+    0x21, 0x30, 0x5B, 0x90, 0x04, 0xE1, 0x68, 0x1A, 0xDC, 0x44, 0x88, 0x3A, 0xFC, 0xC8, 0x53, 0x42,
+    0xB9, 0xDC, 0xE8, 0x1A, 0x93, 0x07, 0x1C, 0xD2, 0x3C, 0xBC, 0x09, 0x61, 0x01, 0x0D, 0x80, 0x96,
+    0x31, 0x91, 0x6F, 0x4C, 0x52, 0x6E, 0x9C, 0x73, 0xB4, 0x22, 0xC0, 0x4F, 0x38, 0x79, 0x05, 0x16,
+    0x2E, 0xB8, 0xBF, 0x00, 0xC8, 0xB8, 0x98, 0x51, 0xFC, 0xF8, 0xD9, 0xF6, 0xB7, 0x3E, 0x8F, 0x43,
+    0x14, 0x3B, 0xF6, 0xE0, 0x1A, 0xCA, 0xC7, 0x0A, 0x24, 0x04, 0x11, 0xC9, 0x93, 0x45, 0x37, 0xD5,
+    0xBB, 0xCB, 0xBE, 0x13, 0xDB, 0x4D, 0xBF, 0x3C, 0x7B, 0xE1, 0xE3, 0x72, 0x6C, 0x00, 0x4E, 0x4A,
+    0x27, 0xA3, 0xA1, 0x2E, 0xE2, 0xFB, 0x72, 0x7B, 0x3B, 0x07, 0x66, 0x61, 0x23, 0x67, 0x45, 0xC3,
+    0x52, 0x72, 0xE4, 0x3F, 0xF7, 0x35, 0xAE, 0xFA, 0x44, 0xA7, 0x43, 0xFF, 0x6D, 0x3F, 0x6A, 0x3C,
+    0x51, 0x30, 0x1A, 0x2E, 0xAF, 0x8E, 0xF2, 0xAC, 0xC6, 0x2B, 0xA9, 0x88, 0x84, 0x72, 0x12, 0x06,
+    0xB0, 0xB3, 0xD0, 0x6E, 0x6F, 0x12, 0xF6, 0xC5, 0x0C, 0xD5, 0x71, 0xDD, 0x73, 0x15, 0x63, 0x7A,
+    0x57, 0x44, 0x43, 0xCC, 0xB4, 0xE1, 0x18, 0x78, 0xB7, 0x93, 0xF9, 0xB9, 0xF5, 0xDA, 0xDC, 0x35,
+    0xCC, 0xE1, 0xF2, 0x57, 0x9B, 0x43, 0x38, 0xB7, 0xEC, 0x7F, 0x9C, 0xBA, 0x26, 0xC6, 0xBE, 0x75,
+    0xF3, 0xFA, 0x4E, 0x6A, 0x9E, 0xAD, 0x64, 0x18, 0xCF, 0xB0, 0x94, 0x21, 0xC9, 0x44, 0x94, 0xCD,
+    0x20, 0xAB, 0x81, 0x19, 0x8B, 0x83, 0x87, 0x37, 0x5F, 0x37, 0x0A, 0x2D, 0x88, 0xBF, 0xD1, 0x58,
+    0x12, 0x49, 0xD2, 0x10, 0x2B, 0xC9, 0x78, 0x03, 0x37, 0xB6, 0x80, 0x1B, 0x16, 0x71, 0xA4, 0xC5,
+    0x1B, 0xBA, 0xE2, 0xA4, 0x1D, 0xF7, 0x4F, 0xE5, 0xFE, 0x06, 0x91, 0x4F, 0x7D, 0x97, 0x1E, 0x98,
+    0x12, 0x47, 0x2D, 0x12, 0xC7, 0xD1, 0x42, 0xC5, 0x4D, 0x97, 0x67, 0xF1, 0x8F, 0x76, 0x4F, 0x2C,
+    0x61, 0x82, 0xED, 0xAD, 0x16, 0x15, 0xDA, 0x53, 0x8E, 0x65, 0x8E, 0xEF, 0x19, 0x31, 0x66, 0x46,
+    0x30, 0xE4, 0xCC, 0xD9, 0xC0, 0x46, 0x6D, 0x91, 0x83, 0x19, 0x1F, 0xB8, 0x8C, 0x24, 0xF2, 0xA1,
+    0xDC, 0x55, 0x8E, 0x2B, 0xF6, 0x60, 0x95, 0xC2, 0x7D, 0x0D, 0x91, 0x75, 0x21, 0xFE, 0xA8, 0x6A,
+    0x71, 0xBA, 0xEA, 0x8B, 0xA4, 0xAF, 0x74, 0xB2, 0xD4, 0xB9, 0x82, 0x4A, 0x95, 0xA7, 0x94, 0x40,
+    0x9F, 0x46, 0x96, 0x3A, 0xF8, 0xF7, 0x46, 0x91, 0x54, 0x6B, 0x81, 0xC9, 0xB7, 0x44, 0x64, 0xB4,
+    0x99, 0x20, 0x4B, 0x92, 0x4D, 0x8E, 0x8C, 0x73, 0x0A, 0xF9, 0x44, 0xDF, 0x1C, 0xCA, 0x59, 0xC6,
+    0x4C, 0xBE, 0x44, 0x63, 0xC4, 0x8D, 0xB0, 0x52, 0xF5, 0xE4, 0xF1, 0xAA, 0x17, 0x6D, 0xF6, 0x7F,
+    0x89, 0x64, 0xF6, 0x69, 0x84, 0xFD, 0x20, 0x82, 0xB7, 0x4A, 0x35, 0x77, 0x86, 0xE9, 0xA8, 0x81,
+    0x55, 0x12, 0x2F, 0x58, 0x67, 0x35, 0x66, 0x48, 0x2F, 0x7A, 0xBB, 0x00, 0x63, 0x4C, 0x46, 0x23,
+    0xE2, 0x88, 0x6E, 0x6E, 0xD0, 0xDF, 0x0B, 0x3A, 0xEE, 0x29, 0xE4, 0x0E, 0x9D, 0x8B, 0x67, 0xAC,
+    0xC7, 0x54, 0x31, 0x46, 0xB6, 0x30, 0x13, 0x3F, 0x24, 0x68, 0x06, 0x71, 0xBD, 0xFF, 0xF5, 0x9B,
+    0x0F, 0x26, 0x43, 0xDC, 0x89, 0x31, 0x46, 0x58, 0x97, 0x1F, 0xF7, 0xC1, 0xE4, 0x66, 0xD0, 0xDF,
+    0x89, 0x28, 0x82, 0x1F, 0x13, 0xB8, 0xBA, 0x20, 0x3A, 0x78, 0xDF, 0xC9, 0x0B, 0x67, 0xC7, 0x87,
+    0xBF, 0x0F, 0xC7, 0x3D, 0xF3, 0x56, 0xB0, 0xF2, 0x7B, 0x03, 0x0C, 0xF4, 0xDE, 0x26, 0x36, 0x42,
+    0xAC, 0x37, 0xA1, 0xEB, 0x8F, 0x52, 0xDF, 0x28, 0xD6, 0x64, 0xF9, 0x38, 0x07, 0x67, 0x82, 0x35,
+    0x6C, 0x8E, 0x95, 0xC8, 0x85, 0xE1, 0x0B, 0x2D, 0x45, 0x45, 0x4C, 0xDF, 0x3E, 0xC4, 0x39, 0xD9,
+    0x20, 0x4F, 0x62, 0x3F, 0x96, 0xC7, 0xA9, 0x48, 0xA4, 0xDA, 0x43, 0x26, 0xE3, 0x3A, 0x9A, 0x92,
+    0x5B, 0xFE, 0xCF, 0xB1, 0xB0, 0xC4, 0x62, 0xB5, 0x77, 0xFF, 0xFA, 0x64, 0x60, 0x13, 0x4A, 0x1A,
+    0x16, 0xAF, 0xF7, 0x59, 0x93, 0x32, 0x5A, 0x7B, 0x0A, 0xE7, 0x92, 0xA4, 0x90, 0xCC, 0xBB, 0x4F,
+    0xE7, 0x03, 0xE2, 0x6D, 0xEE, 0x32, 0x09, 0xCC, 0x42, 0xDE, 0x64, 0x93, 0xA9, 0xB3, 0x72, 0xFD,
+    0x58, 0x24, 0x9E, 0xF2, 0x94, 0x4C, 0x39, 0xD3, 0x75, 0x7A, 0xD2, 0x62, 0x71, 0x33, 0x45, 0xC5,
+    0x98, 0x68, 0xB7, 0xA9, 0x31, 0xDD, 0x15, 0x6A, 0x11, 0xDA, 0x8B, 0x43, 0x37, 0xF5, 0xF1, 0xD2,
+    0xC5, 0x68, 0x34, 0xF7, 0xBF, 0x32, 0xE5, 0x42, 0x3E, 0x5E, 0x63, 0xF7, 0xCB, 0x27, 0x6C, 0x0F,
+    0x24, 0xF1, 0x52, 0x4B, 0xCD, 0x0A, 0x53, 0x0F, 0x28, 0xCC, 0x93, 0x35, 0xEC, 0x1F, 0x1A, 0x8D,
+    0xF6, 0xAA, 0x31, 0x5D, 0x4B, 0x9D, 0x91, 0xDB, 0x5F, 0x99, 0x32, 0x70, 0x23, 0x6D, 0x4B, 0x5B,
+    0xCA, 0x27, 0x65, 0x4D, 0x83, 0x2E, 0xB1, 0x57, 0x96, 0xC5, 0xCD, 0xC4, 0x42, 0xD0, 0x57, 0xC7,
+    0x36, 0xC2, 0x3D, 0x14, 0x14, 0xAB, 0x91, 0x27, 0xBE, 0xCF, 0x66, 0xF8, 0xC4, 0x36, 0x19, 0x66,
+    0xCA, 0xB3, 0xBD, 0xCA, 0xD8, 0x56, 0xB2, 0x3B, 0x9A, 0x0A, 0x73, 0x6A, 0xDC, 0xB4, 0x99, 0xF4,
+    0xB4, 0x48, 0x5E, 0x5B, 0x82, 0x16, 0xEF, 0xD1, 0xFC, 0x69, 0xE4, 0xC7, 0x3D, 0xED, 0x99, 0x41,
+    0xDD, 0xEC, 0x9C, 0x0B, 0x73, 0x74, 0x8E, 0xA9, 0xB8, 0x34, 0x6E, 0x6D, 0xB0, 0xF7, 0xB9, 0x7A,
+    0xD8, 0x7A, 0x6C, 0x0F, 0xB3, 0xC5, 0x55, 0xF0, 0xB9, 0x80, 0x63, 0x61, 0x38, 0x76, 0x32, 0x6B,
+    0x2D, 0xA4, 0x43, 0x70, 0x05, 0xDA, 0x10, 0x65, 0x5F, 0x2C, 0xEA, 0xC0, 0x8B, 0xCB, 0xB2, 0xBB,
+    0x51, 0x8F, 0x50, 0xB7, 0x3D, 0xC8, 0x9C, 0x5B, 0xC7, 0xB8, 0x3B, 0x42, 0x55, 0xAF, 0xCA, 0x5F,
+    0xF3, 0x21, 0x51, 0xDC, 0x2F, 0xB2, 0x9F, 0x5A, 0x56, 0x38, 0x48, 0xC6, 0xC2, 0xF5, 0xF1, 0x8D,
+    0xD9, 0x99, 0x75, 0x39, 0x28, 0x8F, 0x82, 0x74, 0x2C, 0x6C, 0x54, 0xD6, 0xBD, 0x72, 0x29, 0x39,
+    0x68, 0xC6, 0x16, 0x0E, 0x35, 0xF4, 0x88, 0xE0, 0x2E, 0xBB, 0xD7, 0xFD, 0x7B, 0xBD, 0x82, 0x96,
+    0x6C, 0x5D, 0xD7, 0xF7, 0xB7, 0x19, 0xCF, 0xDC, 0x4D, 0x0A, 0x28, 0x44, 0x6C, 0x9B, 0x68, 0x88,
+    0x17, 0x9E, 0x51, 0x1E, 0x75, 0x63, 0x78, 0xC4, 0x75, 0x10, 0x23, 0xC8, 0x8B, 0x15, 0xBA, 0x67,
+    0x28, 0xFE, 0x1F, 0xB0, 0xC6, 0x97, 0x73, 0xA0, 0x87, 0x0E, 0x22, 0xB8, 0x07, 0x4C, 0x1B, 0xF3,
+    0x0D, 0x70, 0x6B, 0xAF, 0x00, 0x40, 0x11, 0x61, 0x83, 0xBB, 0x46, 0xBD, 0x05, 0xCF, 0xEB, 0xBC,
+    0xE9, 0x12, 0xDD, 0xF4, 0x80, 0xAE, 0x65, 0xA3, 0xE6, 0x29, 0xFC, 0x8B, 0xA8, 0x8C, 0x55, 0xF1,
+    0xDC, 0xCA, 0xA6, 0x8C, 0x39, 0x6B, 0x52, 0xCF, 0x73,
+};
+
+static const uint32_t opendyslexic_10_regularBlockOffsets[20] = {
+    0, 1297, 2606, 3972, 4914, 5877, 6849, 7940,
+    8820, 9821, 10869, 12049, 13362, 14703, 15904, 17147,
+    18332, 19519, 20852, 21993,
+};
+
+static const uint16_t opendyslexic_10_regularDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_10_regularGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_10_regularPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
@@ -2432,689 +1564,689 @@ static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 17, 19, 24, 3, 19, 81, 1821 }, // G
     { 16, 18, 22, 3, 18, 72, 1902 }, // H
     { 5, 18, 10, 2, 18, 23, 1974 }, // I
-    { 9, 24, 16, 3, 19, 54, 1997 }, // J
-    { 15, 18, 21, 3, 18, 68, 2051 }, // K
-    { 12, 18, 19, 3, 18, 54, 2119 }, // L
-    { 19, 18, 26, 3, 18, 86, 2173 }, // M
-    { 16, 18, 22, 3, 18, 72, 2259 }, // N
-    { 17, 19, 24, 3, 18, 81, 2331 }, // O
-    { 13, 18, 19, 3, 18, 59, 2412 }, // P
-    { 17, 21, 21, 2, 18, 90, 2471 }, // Q
-    { 14, 18, 20, 3, 18, 63, 2561 }, // R
-    { 17, 19, 23, 3, 18, 81, 2624 }, // S
-    { 16, 18, 22, 3, 18, 72, 2705 }, // T
-    { 15, 19, 22, 3, 18, 72, 2777 }, // U
-    { 18, 18, 24, 3, 18, 81, 2849 }, // V
-    { 23, 18, 30, 3, 18, 104, 2930 }, // W
-    { 17, 18, 24, 3, 18, 77, 3034 }, // X
-    { 16, 18, 22, 3, 18, 72, 3111 }, // Y
-    { 17, 18, 24, 3, 18, 77, 3183 }, // Z
-    { 8, 29, 10, 1, 22, 58, 3260 }, // [
-    { 8, 20, 10, 1, 16, 40, 3318 }, // <backslash>
-    { 8, 29, 10, 1, 22, 58, 3358 }, // ]
-    { 9, 5, 12, 1, 20, 12, 3416 }, // ^
-    { 14, 3, 17, 1, -2, 11, 3428 }, // _
-    { 7, 4, 9, 1, 16, 7, 3439 }, // `
-    { 12, 13, 17, 2, 13, 39, 3446 }, // a
-    { 12, 19, 18, 3, 18, 57, 3485 }, // b
-    { 10, 14, 16, 3, 13, 35, 3542 }, // c
-    { 13, 19, 18, 2, 18, 62, 3577 }, // d
-    { 12, 13, 17, 3, 13, 39, 3639 }, // e
-    { 7, 17, 13, 3, 17, 30, 3678 }, // f
-    { 11, 17, 17, 3, 12, 47, 3708 }, // g
-    { 11, 18, 17, 3, 18, 50, 3755 }, // h
-    { 4, 18, 9, 3, 18, 18, 3805 }, // i
-    { 8, 24, 13, 3, 18, 48, 3823 }, // j
-    { 11, 17, 17, 3, 17, 47, 3871 }, // k
-    { 7, 17, 11, 2, 17, 30, 3918 }, // l
-    { 19, 12, 24, 3, 12, 57, 3948 }, // m
-    { 11, 12, 17, 3, 12, 33, 4005 }, // n
-    { 12, 12, 17, 3, 12, 36, 4038 }, // o
-    { 13, 18, 17, 2, 12, 59, 4074 }, // p
-    { 14, 18, 20, 3, 13, 63, 4133 }, // q
-    { 8, 12, 14, 3, 12, 24, 4196 }, // r
-    { 10, 12, 16, 3, 12, 30, 4220 }, // s
-    { 9, 16, 15, 3, 16, 36, 4250 }, // t
-    { 11, 12, 17, 3, 12, 33, 4286 }, // u
-    { 13, 12, 19, 3, 12, 39, 4319 }, // v
-    { 16, 12, 22, 3, 12, 48, 4358 }, // w
-    { 13, 12, 19, 3, 12, 39, 4406 }, // x
-    { 12, 18, 17, 3, 12, 54, 4445 }, // y
-    { 11, 12, 17, 3, 12, 33, 4499 }, // z
-    { 10, 20, 12, 1, 16, 50, 4532 }, // {
-    { 3, 18, 5, 1, 15, 14, 4582 }, // |
-    { 10, 20, 12, 1, 16, 50, 4596 }, // }
-    { 8, 5, 10, 1, 16, 10, 4646 }, // ~
-    { 0, 0, 18, 0, 0, 0, 4656 }, //  
-    { 6, 22, 7, 0, 16, 33, 4656 }, // ¡
-    { 10, 19, 16, 3, 16, 48, 4689 }, // ¢
-    { 14, 20, 14, 0, 20, 70, 4737 }, // £
-    { 12, 11, 14, 1, 13, 33, 4807 }, // ¤
-    { 14, 18, 16, 1, 16, 63, 4840 }, // ¥
-    { 3, 18, 5, 1, 15, 14, 4903 }, // ¦
-    { 12, 19, 17, 3, 17, 57, 4917 }, // §
-    { 10, 4, 11, 1, 16, 10, 4974 }, // ¨
-    { 9, 8, 11, 1, 19, 18, 4984 }, // ©
-    { 7, 8, 9, 2, 16, 14, 5002 }, // ª
-    { 11, 10, 13, 1, 10, 28, 5016 }, // «
-    { 11, 6, 13, 1, 7, 17, 5044 }, // ¬
-    { 10, 3, 11, 1, 8, 8, 5061 }, // ­
-    { 9, 8, 11, 1, 22, 18, 5069 }, // ®
-    { 9, 3, 11, 1, 15, 7, 5087 }, // ¯
-    { 10, 10, 11, 1, 17, 25, 5094 }, // °
-    { 11, 12, 13, 1, 11, 33, 5119 }, // ±
-    { 6, 8, 6, 0, 17, 12, 5152 }, // ²
-    { 6, 8, 7, 0, 17, 12, 5164 }, // ³
-    { 4, 5, 6, 1, 17, 5, 5176 }, // ´
-    { 12, 14, 17, 2, 12, 42, 5181 }, // µ
-    { 11, 17, 13, 1, 15, 47, 5223 }, // ¶
-    { 4, 4, 5, 1, 9, 4, 5270 }, // ·
-    { 5, 6, 7, 1, 1, 8, 5274 }, // ¸
-    { 6, 9, 6, 0, 18, 14, 5282 }, // ¹
-    { 7, 7, 9, 2, 15, 13, 5296 }, // º
-    { 11, 10, 13, 1, 10, 28, 5309 }, // »
-    { 18, 20, 23, 3, 19, 90, 5337 }, // ¼
-    { 18, 20, 23, 3, 18, 90, 5427 }, // ½
-    { 19, 19, 23, 2, 18, 91, 5517 }, // ¾
-    { 12, 23, 12, 0, 12, 69, 5608 }, // ¿
-    { 17, 24, 24, 3, 24, 102, 5677 }, // À
-    { 17, 27, 24, 3, 27, 115, 5779 }, // Á
-    { 17, 25, 24, 3, 25, 107, 5894 }, // Â
-    { 17, 24, 24, 3, 24, 102, 6001 }, // Ã
-    { 17, 24, 24, 3, 24, 102, 6103 }, // Ä
-    { 17, 25, 24, 3, 25, 107, 6205 }, // Å
-    { 24, 19, 30, 3, 18, 114, 6312 }, // Æ
-    { 14, 24, 21, 3, 19, 84, 6426 }, // Ç
-    { 13, 23, 19, 3, 23, 75, 6510 }, // È
-    { 13, 27, 19, 3, 27, 88, 6585 }, // É
-    { 13, 24, 19, 3, 24, 78, 6673 }, // Ê
-    { 13, 24, 19, 3, 24, 78, 6751 }, // Ë
-    { 7, 25, 10, 0, 25, 44, 6829 }, // Ì
-    { 5, 29, 10, 2, 29, 37, 6873 }, // Í
-    { 9, 26, 10, 0, 26, 59, 6910 }, // Î
-    { 11, 25, 10, -1, 25, 69, 6969 }, // Ï
-    { 19, 18, 23, 1, 18, 86, 7038 }, // Ð
-    { 16, 23, 22, 3, 23, 92, 7124 }, // Ñ
-    { 17, 24, 24, 3, 23, 102, 7216 }, // Ò
-    { 17, 28, 24, 3, 27, 119, 7318 }, // Ó
-    { 17, 25, 24, 3, 24, 107, 7437 }, // Ô
-    { 17, 24, 24, 3, 23, 102, 7544 }, // Õ
-    { 17, 24, 24, 3, 23, 102, 7646 }, // Ö
-    { 10, 6, 12, 1, 8, 15, 7748 }, // ×
-    { 26, 38, 25, -1, 28, 247, 7763 }, // Ø
-    { 15, 25, 22, 3, 24, 94, 8010 }, // Ù
-    { 15, 28, 22, 3, 27, 105, 8104 }, // Ú
-    { 15, 26, 22, 3, 25, 98, 8209 }, // Û
-    { 15, 25, 22, 3, 24, 94, 8307 }, // Ü
-    { 16, 28, 22, 3, 28, 112, 8401 }, // Ý
-    { 10, 17, 12, 1, 17, 43, 8513 }, // Þ
-    { 12, 17, 14, 1, 17, 51, 8556 }, // ß
-    { 12, 17, 17, 2, 17, 51, 8607 }, // à
-    { 12, 21, 17, 2, 21, 63, 8658 }, // á
-    { 12, 18, 17, 2, 18, 54, 8721 }, // â
-    { 12, 17, 17, 2, 17, 51, 8775 }, // ã
-    { 12, 17, 17, 2, 17, 51, 8826 }, // ä
-    { 12, 18, 17, 2, 18, 54, 8877 }, // å
-    { 21, 13, 26, 2, 13, 69, 8931 }, // æ
-    { 10, 18, 16, 3, 13, 45, 9000 }, // ç
-    { 12, 19, 17, 3, 19, 57, 9045 }, // è
-    { 12, 23, 17, 3, 23, 69, 9102 }, // é
-    { 12, 20, 17, 3, 20, 60, 9171 }, // ê
-    { 12, 20, 17, 3, 20, 60, 9231 }, // ë
-    { 7, 17, 9, 0, 17, 30, 9291 }, // ì
-    { 4, 21, 9, 3, 21, 21, 9321 }, // í
-    { 9, 18, 9, 0, 18, 41, 9342 }, // î
-    { 11, 18, 9, -1, 18, 50, 9383 }, // ï
-    { 16, 17, 17, 1, 17, 68, 9433 }, // ð
-    { 11, 18, 17, 3, 18, 50, 9501 }, // ñ
-    { 12, 19, 17, 3, 19, 57, 9551 }, // ò
-    { 12, 23, 17, 3, 23, 69, 9608 }, // ó
-    { 12, 20, 17, 3, 20, 60, 9677 }, // ô
-    { 12, 19, 17, 3, 19, 57, 9737 }, // õ
-    { 12, 19, 17, 3, 19, 57, 9794 }, // ö
-    { 14, 13, 16, 1, 13, 46, 9851 }, // ÷
-    { 13, 33, 17, 2, 22, 108, 9897 }, // ø
-    { 11, 18, 17, 3, 18, 50, 10005 }, // ù
-    { 11, 22, 17, 3, 22, 61, 10055 }, // ú
-    { 11, 18, 17, 3, 18, 50, 10116 }, // û
-    { 11, 18, 17, 3, 18, 50, 10166 }, // ü
-    { 12, 29, 17, 3, 23, 87, 10216 }, // ý
-    { 10, 21, 12, 1, 17, 53, 10303 }, // þ
-    { 12, 26, 17, 3, 20, 78, 10356 }, // ÿ
-    { 17, 23, 24, 3, 23, 98, 10434 }, // Ā
-    { 12, 16, 17, 2, 16, 48, 10532 }, // ā
-    { 17, 26, 24, 3, 26, 111, 10580 }, // Ă
-    { 12, 19, 17, 2, 19, 57, 10691 }, // ă
-    { 17, 23, 24, 3, 18, 98, 10748 }, // Ą
-    { 13, 17, 17, 2, 13, 56, 10846 }, // ą
-    { 14, 29, 21, 3, 28, 102, 10902 }, // Ć
-    { 10, 21, 16, 3, 20, 53, 11004 }, // ć
-    { 14, 27, 21, 3, 26, 95, 11057 }, // Ĉ
-    { 10, 19, 16, 3, 18, 48, 11152 }, // ĉ
-    { 14, 27, 21, 3, 26, 95, 11200 }, // Ċ
-    { 10, 20, 16, 3, 19, 50, 11295 }, // ċ
-    { 14, 28, 21, 3, 27, 98, 11345 }, // Č
-    { 10, 21, 16, 3, 20, 53, 11443 }, // č
-    { 17, 26, 23, 3, 26, 111, 11496 }, // Ď
-    { 17, 19, 18, 2, 18, 81, 11607 }, // ď
-    { 19, 18, 23, 1, 18, 86, 11688 }, // Đ
-    { 16, 19, 18, 2, 18, 76, 11774 }, // đ
-    { 13, 23, 19, 3, 23, 75, 11850 }, // Ē
-    { 12, 19, 17, 3, 19, 57, 11925 }, // ē
-    { 13, 26, 19, 3, 26, 85, 11982 }, // Ĕ
-    { 12, 22, 17, 3, 22, 66, 12067 }, // ĕ
-    { 13, 25, 19, 3, 25, 82, 12133 }, // Ė
-    { 12, 21, 17, 3, 21, 63, 12215 }, // ė
-    { 13, 23, 19, 3, 18, 75, 12278 }, // Ę
-    { 12, 19, 17, 3, 13, 57, 12353 }, // ę
-    { 13, 25, 19, 3, 25, 82, 12410 }, // Ě
-    { 12, 22, 17, 3, 22, 66, 12492 }, // ě
-    { 17, 24, 24, 3, 24, 102, 12558 }, // Ĝ
-    { 11, 23, 17, 3, 18, 64, 12660 }, // ĝ
-    { 17, 26, 24, 3, 26, 111, 12724 }, // Ğ
-    { 11, 25, 17, 3, 20, 69, 12835 }, // ğ
-    { 17, 25, 24, 3, 25, 107, 12904 }, // Ġ
-    { 11, 24, 17, 3, 19, 66, 13011 }, // ġ
-    { 17, 28, 24, 3, 19, 119, 13077 }, // Ģ
-    { 11, 25, 17, 3, 20, 69, 13196 }, // ģ
-    { 16, 24, 22, 3, 24, 96, 13265 }, // Ĥ
-    { 13, 23, 17, 1, 23, 75, 13361 }, // ĥ
-    { 17, 18, 22, 2, 18, 77, 13436 }, // Ħ
-    { 14, 18, 17, 0, 18, 63, 13513 }, // ħ
-    { 8, 26, 10, 0, 26, 52, 13576 }, // Ĩ
-    { 8, 18, 9, 1, 18, 36, 13628 }, // ĩ
-    { 11, 24, 10, -1, 24, 66, 13664 }, // Ī
-    { 10, 17, 9, 0, 17, 43, 13730 }, // ī
-    { 5, 23, 13, 5, 18, 29, 13773 }, // Į
-    { 5, 23, 9, 2, 18, 29, 13802 }, // į
-    { 5, 26, 10, 2, 26, 33, 13831 }, // İ
-    { 4, 12, 9, 3, 12, 12, 13864 }, // ı
-    { 14, 23, 19, 2, 18, 81, 13876 }, // Ĳ
-    { 15, 24, 9, 3, 18, 90, 13957 }, // ĳ
-    { 10, 27, 16, 3, 22, 68, 14047 }, // Ĵ
-    { 11, 23, 13, 3, 17, 64, 14115 }, // ĵ
-    { 15, 25, 21, 3, 18, 94, 14179 }, // Ķ
-    { 11, 26, 17, 3, 17, 72, 14273 }, // ķ
-    { 9, 12, 13, 2, 12, 27, 14345 }, // ĸ
-    { 12, 25, 19, 3, 25, 75, 14372 }, // Ĺ
-    { 7, 25, 11, 2, 25, 44, 14447 }, // ĺ
-    { 12, 27, 19, 3, 18, 81, 14491 }, // Ļ
-    { 7, 25, 11, 2, 17, 44, 14572 }, // ļ
-    { 12, 18, 19, 3, 18, 54, 14616 }, // Ľ
-    { 9, 18, 11, 2, 18, 41, 14670 }, // ľ
-    { 12, 18, 19, 3, 18, 54, 14711 }, // Ŀ
-    { 10, 17, 11, 2, 17, 43, 14765 }, // ŀ
-    { 20, 29, 19, -5, 23, 145, 14808 }, // Ł
-    { 14, 17, 11, -4, 17, 60, 14953 }, // ł
-    { 16, 25, 22, 3, 25, 100, 15013 }, // Ń
-    { 11, 20, 17, 3, 20, 55, 15113 }, // ń
-    { 16, 25, 22, 3, 18, 100, 15168 }, // Ņ
-    { 11, 19, 17, 3, 12, 53, 15268 }, // ņ
-    { 16, 25, 22, 3, 25, 100, 15321 }, // Ň
-    { 11, 20, 17, 3, 20, 55, 15421 }, // ň
-    { 12, 22, 14, 1, 22, 66, 15476 }, // ŉ
-    { 16, 22, 22, 3, 18, 88, 15542 }, // Ŋ
-    { 11, 16, 17, 3, 12, 44, 15630 }, // ŋ
-    { 17, 23, 24, 3, 22, 98, 15674 }, // Ō
-    { 12, 18, 17, 3, 18, 54, 15772 }, // ō
-    { 17, 27, 24, 3, 26, 115, 15826 }, // Ŏ
-    { 12, 22, 17, 3, 22, 66, 15941 }, // ŏ
-    { 18, 25, 24, 3, 24, 113, 16007 }, // Ő
-    { 16, 20, 17, 1, 20, 80, 16120 }, // ő
-    { 24, 19, 25, 3, 19, 114, 16200 }, // Œ
-    { 20, 13, 22, 3, 13, 65, 16314 }, // œ
-    { 14, 25, 20, 3, 25, 88, 16379 }, // Ŕ
-    { 8, 18, 14, 3, 18, 36, 16467 }, // ŕ
-    { 14, 28, 20, 3, 18, 98, 16503 }, // Ŗ
-    { 9, 23, 14, 2, 12, 52, 16601 }, // ŗ
-    { 14, 25, 20, 3, 25, 88, 16653 }, // Ř
-    { 10, 18, 14, 1, 18, 45, 16741 }, // ř
-    { 17, 28, 23, 3, 27, 119, 16786 }, // Ś
-    { 10, 20, 16, 3, 20, 50, 16905 }, // ś
-    { 17, 26, 23, 3, 25, 111, 16955 }, // Ŝ
-    { 10, 18, 16, 3, 18, 45, 17066 }, // ŝ
-    { 17, 23, 23, 3, 18, 98, 17111 }, // Ş
-    { 10, 18, 16, 3, 12, 45, 17209 }, // ş
-    { 17, 27, 23, 3, 26, 115, 17254 }, // Š
-    { 10, 20, 16, 3, 20, 50, 17369 }, // š
-    { 16, 22, 22, 3, 18, 88, 17419 }, // Ţ
-    { 9, 20, 15, 3, 16, 45, 17507 }, // ţ
-    { 16, 24, 22, 3, 24, 96, 17552 }, // Ť
-    { 10, 18, 15, 3, 18, 45, 17648 }, // ť
-    { 16, 18, 22, 3, 18, 72, 17693 }, // Ŧ
-    { 10, 16, 15, 2, 16, 40, 17765 }, // ŧ
-    { 15, 26, 22, 3, 25, 98, 17805 }, // Ũ
-    { 11, 19, 17, 3, 19, 53, 17903 }, // ũ
-    { 15, 24, 22, 3, 23, 90, 17956 }, // Ū
-    { 11, 17, 17, 3, 17, 47, 18046 }, // ū
-    { 15, 28, 22, 3, 27, 105, 18093 }, // Ŭ
-    { 11, 20, 17, 3, 20, 55, 18198 }, // ŭ
-    { 15, 27, 22, 3, 26, 102, 18253 }, // Ů
-    { 11, 20, 17, 3, 20, 55, 18355 }, // ů
-    { 17, 26, 22, 3, 25, 111, 18410 }, // Ű
-    { 16, 19, 17, 1, 19, 76, 18521 }, // ű
-    { 15, 23, 22, 3, 18, 87, 18597 }, // Ų
-    { 11, 17, 17, 3, 12, 47, 18684 }, // ų
-    { 23, 24, 30, 3, 24, 138, 18731 }, // Ŵ
-    { 16, 19, 22, 3, 19, 76, 18869 }, // ŵ
-    { 16, 25, 22, 3, 25, 100, 18945 }, // Ŷ
-    { 12, 26, 17, 3, 20, 78, 19045 }, // ŷ
-    { 16, 25, 22, 3, 25, 100, 19123 }, // Ÿ
-    { 17, 25, 24, 3, 25, 107, 19223 }, // Ź
-    { 11, 20, 17, 3, 20, 55, 19330 }, // ź
-    { 17, 24, 24, 3, 24, 102, 19385 }, // Ż
-    { 11, 19, 17, 3, 19, 53, 19487 }, // ż
-    { 17, 25, 24, 3, 25, 107, 19540 }, // Ž
-    { 11, 20, 17, 3, 20, 55, 19647 }, // ž
-    { 7, 17, 11, 3, 17, 30, 19702 }, // ſ
-    { 7, 4, 0, 1, 16, 7, 19732 }, // ̀
-    { 4, 5, 0, 1, 17, 5, 19739 }, // ́
-    { 9, 5, 0, 1, 1, 12, 19744 }, // ̂
-    { 8, 5, 0, 1, 16, 10, 19756 }, // ̃
-    { 11, 3, 0, 1, 14, 9, 19766 }, // ̄
-    { 14, 3, 0, 1, 18, 11, 19775 }, // ̅
-    { 9, 5, 0, 1, 16, 12, 19786 }, // ̆
-    { 4, 4, 0, 1, 16, 4, 19798 }, // ̇
-    { 10, 4, 0, 1, 16, 10, 19802 }, // ̈
-    { 5, 4, 0, 0, 13, 5, 19812 }, // ̉
-    { 5, 5, 0, 1, 16, 7, 19817 }, // ̊
-    { 15, 4, 0, 1, 16, 15, 19824 }, // ̋
-    { 9, 5, 0, 1, 16, 12, 19839 }, // ̌
-    { 15, 4, 0, -4, 17, 15, 19851 }, // ̏
-    { 6, 6, 0, 0, 16, 9, 19866 }, // ̒
-    { 5, 6, 0, 1, 15, 8, 19875 }, // ̓
-    { 6, 6, 0, 0, 15, 9, 19883 }, // ̔
-    { 4, 5, 0, 1, -1, 5, 19892 }, // ̘
-    { 4, 5, 0, 1, -1, 5, 19897 }, // ̙
-    { 9, 5, 0, 1, 17, 12, 19902 }, // ̚
-    { 4, 5, 0, 1, 13, 5, 19914 }, // ̛
-    { 3, 5, 0, 1, -1, 4, 19919 }, // ̜
-    { 5, 4, 0, 1, 3, 5, 19923 }, // ̝
-    { 5, 4, 0, 1, 0, 5, 19928 }, // ̞
-    { 5, 5, 0, 1, -2, 7, 19933 }, // ̟
-    { 10, 3, 0, 1, -3, 8, 19940 }, // ̠
-    { 4, 4, 0, 1, 1, 4, 19948 }, // ̣
-    { 10, 4, 0, 1, 0, 10, 19952 }, // ̤
-    { 5, 5, 0, 1, 16, 7, 19962 }, // ̥
-    { 5, 6, 0, 1, 3, 8, 19969 }, // ̦
-    { 5, 6, 0, 1, 1, 8, 19977 }, // ̧
-    { 5, 6, 0, 1, 1, 8, 19985 }, // ̨
-    { 3, 6, 0, 1, -1, 5, 19993 }, // ̩
-    { 7, 4, 0, 1, -1, 7, 19998 }, // ̪
-    { 9, 5, 0, 1, 0, 12, 20005 }, // ̬
-    { 9, 5, 0, 1, -1, 12, 20017 }, // ̭
-    { 8, 5, 0, 1, 16, 10, 20029 }, // ̰
-    { 9, 3, 0, 1, 15, 7, 20039 }, // ̱
-    { 9, 3, 0, 1, -1, 7, 20046 }, // ̲
-    { 8, 5, 0, 1, 16, 10, 20053 }, // ̴
-    { 10, 3, 0, 1, 8, 8, 20063 }, // ̵
-    { 3, 5, 0, 1, -1, 4, 20071 }, // ̹
-    { 7, 4, 0, 1, -1, 7, 20075 }, // ̺
-    { 7, 5, 0, 1, 0, 9, 20082 }, // ̻
-    { 7, 4, 0, 1, 0, 7, 20091 }, // ̼
-    { 5, 5, 0, 2, 16, 7, 20098 }, // ̽
-    { 8, 5, 0, 1, 16, 10, 20105 }, // ͂
-    { 3, 4, 0, 1, 17, 3, 20115 }, // ̓
-    { 10, 10, 0, 1, 22, 25, 20118 }, // ̈́
-    { 7, 4, 0, 1, 16, 7, 20143 }, // ͆
-    { 10, 8, 0, 1, 0, 20, 20150 }, // ͇
-    { 8, 6, 0, 1, 0, 12, 20170 }, // ͈
-    { 7, 6, 0, 1, -1, 11, 20182 }, // ͉
-    { 8, 12, 0, 1, 20, 24, 20193 }, // ͊
-    { 17, 9, 0, 1, 19, 39, 20217 }, // ͋
-    { 12, 11, 0, 2, 12, 33, 20256 }, // ͌
-    { 10, 5, 0, 2, -2, 13, 20289 }, // ͍
-    { 4, 3, 0, 1, 2, 3, 20302 }, // ͎
-    { 17, 4, 0, 1, 0, 17, 20305 }, // ͜
-    { 17, 4, 0, 1, 16, 17, 20322 }, // ͡
-    { 21, 5, 0, 1, -1, 27, 20339 }, // ͢
-    { 11, 21, 13, 1, 21, 58, 20366 }, // Ѐ
-    { 11, 20, 13, 1, 20, 55, 20424 }, // Ё
-    { 17, 17, 21, 2, 17, 73, 20479 }, // Ђ
-    { 11, 24, 14, 1, 24, 66, 20552 }, // Ѓ
-    { 15, 17, 19, 2, 16, 64, 20618 }, // Є
-    { 17, 19, 23, 3, 18, 81, 20682 }, // Ѕ
-    { 5, 18, 10, 2, 18, 23, 20763 }, // І
-    { 10, 25, 10, -1, 25, 63, 20786 }, // Ї
-    { 9, 24, 16, 3, 19, 54, 20849 }, // Ј
-    { 21, 16, 24, 2, 15, 84, 20903 }, // Љ
-    { 20, 16, 23, 2, 16, 80, 20987 }, // Њ
-    { 18, 18, 22, 3, 18, 81, 21067 }, // Ћ
-    { 15, 25, 21, 3, 25, 94, 21148 }, // Ќ
-    { 16, 24, 22, 3, 24, 96, 21242 }, // Ѝ
-    { 12, 25, 14, 1, 24, 75, 21338 }, // Ў
-    { 13, 19, 15, 1, 15, 62, 21413 }, // Џ
-    { 17, 18, 24, 3, 18, 77, 21475 }, // А
-    { 11, 15, 14, 1, 15, 42, 21552 }, // Б
-    { 12, 15, 14, 1, 15, 45, 21594 }, // В
-    { 11, 15, 14, 1, 15, 42, 21639 }, // Г
-    { 15, 18, 17, 1, 15, 68, 21681 }, // Д
-    { 11, 15, 13, 1, 15, 42, 21749 }, // Е
-    { 23, 18, 30, 3, 18, 104, 21791 }, // Ж
-    { 11, 16, 13, 1, 16, 44, 21895 }, // З
-    { 16, 18, 22, 3, 18, 72, 21939 }, // И
-    { 16, 26, 22, 3, 26, 104, 22011 }, // Й
-    { 15, 18, 21, 3, 18, 68, 22115 }, // К
-    { 12, 16, 16, 2, 15, 48, 22183 }, // Л
-    { 15, 15, 18, 1, 15, 57, 22231 }, // М
-    { 16, 18, 22, 3, 18, 72, 22288 }, // Н
-    { 17, 19, 24, 3, 18, 81, 22360 }, // О
-    { 12, 16, 14, 1, 16, 48, 22441 }, // П
-    { 13, 18, 19, 3, 18, 59, 22489 }, // Р
-    { 14, 20, 21, 3, 19, 70, 22548 }, // С
-    { 16, 18, 22, 3, 18, 72, 22618 }, // Т
-    { 12, 18, 14, 1, 17, 54, 22690 }, // У
-    { 16, 16, 18, 1, 16, 64, 22744 }, // Ф
-    { 17, 18, 24, 3, 18, 77, 22808 }, // Х
-    { 13, 19, 15, 1, 16, 62, 22885 }, // Ц
-    { 12, 16, 14, 1, 16, 48, 22947 }, // Ч
-    { 15, 16, 17, 1, 16, 60, 22995 }, // Ш
-    { 17, 20, 19, 1, 16, 85, 23055 }, // Щ
-    { 14, 16, 14, -2, 16, 56, 23140 }, // Ъ
-    { 19, 16, 23, 2, 16, 76, 23196 }, // Ы
-    { 10, 16, 14, 2, 16, 40, 23272 }, // Ь
-    { 15, 17, 19, 2, 16, 64, 23312 }, // Э
-    { 17, 16, 21, 2, 16, 68, 23376 }, // Ю
-    { 14, 18, 20, 3, 18, 63, 23444 }, // Я
-    { 12, 13, 17, 2, 13, 39, 23507 }, // а
-    { 12, 16, 15, 1, 16, 48, 23546 }, // б
-    { 11, 13, 15, 2, 13, 36, 23594 }, // в
-    { 10, 12, 12, 1, 12, 30, 23630 }, // г
-    { 14, 14, 16, 1, 12, 49, 23660 }, // д
-    { 12, 13, 17, 3, 13, 39, 23709 }, // е
-    { 19, 15, 25, 3, 15, 72, 23748 }, // ж
-    { 8, 11, 9, 1, 11, 22, 23820 }, // з
-    { 12, 12, 14, 1, 12, 36, 23842 }, // и
-    { 12, 16, 14, 1, 16, 48, 23878 }, // й
-    { 11, 13, 17, 3, 13, 36, 23926 }, // к
-    { 9, 12, 11, 1, 11, 27, 23962 }, // л
-    { 15, 14, 19, 2, 14, 53, 23989 }, // м
-    { 13, 13, 19, 3, 13, 43, 24042 }, // н
-    { 12, 12, 14, 1, 12, 36, 24085 }, // о
-    { 12, 12, 14, 1, 12, 36, 24121 }, // п
-    { 13, 18, 17, 2, 12, 59, 24157 }, // р
-    { 10, 14, 16, 3, 13, 35, 24216 }, // с
-    { 12, 12, 14, 1, 12, 36, 24251 }, // т
-    { 12, 18, 17, 3, 12, 54, 24287 }, // у
-    { 16, 17, 18, 1, 12, 68, 24341 }, // ф
-    { 13, 12, 15, 1, 12, 39, 24409 }, // х
-    { 13, 15, 15, 1, 12, 49, 24448 }, // ц
-    { 8, 11, 9, 1, 11, 22, 24497 }, // ч
-    { 15, 12, 17, 1, 12, 45, 24519 }, // ш
-    { 16, 16, 19, 1, 12, 64, 24564 }, // щ
-    { 13, 11, 16, 1, 11, 36, 24628 }, // ъ
-    { 15, 12, 17, 1, 12, 45, 24664 }, // ы
-    { 10, 12, 13, 1, 12, 30, 24709 }, // ь
-    { 11, 12, 13, 1, 12, 33, 24739 }, // э
-    { 14, 13, 17, 1, 13, 46, 24772 }, // ю
-    { 11, 11, 13, 1, 11, 31, 24818 }, // я
-    { 12, 20, 17, 3, 20, 60, 24849 }, // ѐ
-    { 12, 17, 14, 1, 16, 51, 24909 }, // ё
-    { 15, 21, 17, 0, 18, 79, 24960 }, // ђ
-    { 10, 18, 12, 1, 18, 45, 25039 }, // ѓ
-    { 11, 12, 13, 1, 11, 33, 25084 }, // є
-    { 10, 12, 16, 3, 12, 30, 25117 }, // ѕ
-    { 4, 18, 9, 3, 18, 18, 25147 }, // і
-    { 11, 18, 9, -1, 18, 50, 25165 }, // ї
-    { 8, 24, 13, 3, 18, 48, 25215 }, // ј
-    { 15, 12, 17, 1, 11, 45, 25263 }, // љ
-    { 14, 11, 16, 1, 11, 39, 25308 }, // њ
-    { 14, 18, 17, 0, 18, 63, 25347 }, // ћ
-    { 11, 19, 17, 3, 19, 53, 25410 }, // ќ
-    { 12, 17, 14, 1, 17, 51, 25463 }, // ѝ
-    { 12, 27, 17, 3, 21, 81, 25514 }, // ў
-    { 9, 14, 11, 1, 11, 32, 25595 }, // џ
-    { 12, 17, 17, 3, 16, 51, 25627 }, // Ѣ
-    { 13, 16, 15, 1, 15, 52, 25678 }, // ѣ
-    { 17, 15, 21, 2, 15, 64, 25730 }, // Ѫ
-    { 12, 11, 15, 1, 11, 33, 25794 }, // ѫ
-    { 16, 19, 22, 3, 19, 76, 25827 }, // Ѳ
-    { 13, 15, 17, 2, 15, 49, 25903 }, // ѳ
-    { 22, 23, 24, 3, 23, 127, 25952 }, // Ѵ
-    { 14, 15, 17, 2, 15, 53, 26079 }, // ѵ
-    { 8, 6, 0, 1, 19, 12, 26132 }, // ҆
-    { 11, 17, 14, 1, 17, 47, 26144 }, // Ґ
-    { 10, 14, 12, 1, 14, 35, 26191 }, // ґ
-    { 12, 15, 14, 0, 15, 45, 26226 }, // Ғ
-    { 9, 11, 9, 0, 11, 25, 26271 }, // ғ
-    { 13, 17, 14, 1, 17, 56, 26296 }, // Ҕ
-    { 7, 11, 9, 1, 11, 20, 26352 }, // ҕ
-    { 23, 21, 27, 2, 18, 121, 26372 }, // Җ
-    { 16, 15, 18, 1, 13, 60, 26493 }, // җ
-    { 11, 18, 15, 2, 16, 50, 26553 }, // Ҙ
-    { 8, 16, 9, 1, 11, 32, 26603 }, // ҙ
-    { 14, 21, 18, 2, 18, 74, 26635 }, // Қ
-    { 10, 15, 13, 1, 13, 38, 26709 }, // қ
-    { 16, 16, 20, 2, 16, 64, 26747 }, // Ҝ
-    { 13, 11, 15, 1, 11, 36, 26811 }, // ҝ
-    { 15, 18, 21, 3, 18, 68, 26847 }, // Ҟ
-    { 14, 17, 17, 0, 17, 60, 26915 }, // ҟ
-    { 20, 18, 21, -2, 18, 90, 26975 }, // Ҡ
-    { 13, 13, 15, -1, 13, 43, 27065 }, // ҡ
-    { 16, 21, 19, 2, 18, 84, 27108 }, // Ң
-    { 12, 15, 13, 1, 13, 45, 27192 }, // ң
-    { 22, 19, 22, 3, 19, 105, 27237 }, // Ҥ
-    { 15, 12, 15, 2, 12, 45, 27342 }, // ҥ
-    { 20, 17, 25, 2, 17, 85, 27387 }, // Ҧ
-    { 20, 20, 22, 1, 14, 100, 27472 }, // ҧ
-    { 21, 18, 25, 2, 17, 95, 27572 }, // Ҩ
-    { 17, 15, 19, 1, 14, 64, 27667 }, // ҩ
-    { 14, 23, 21, 3, 19, 81, 27731 }, // Ҫ
-    { 10, 16, 16, 3, 13, 40, 27812 }, // ҫ
-    { 16, 20, 20, 2, 18, 80, 27852 }, // Ҭ
-    { 11, 14, 13, 1, 12, 39, 27932 }, // ҭ
-    { 16, 18, 22, 3, 18, 72, 27971 }, // Ү
-    { 12, 15, 14, 1, 11, 45, 28043 }, // ү
-    { 16, 18, 22, 3, 18, 72, 28088 }, // Ұ
-    { 12, 16, 14, 1, 11, 48, 28160 }, // ұ
-    { 17, 21, 21, 2, 18, 90, 28208 }, // Ҳ
-    { 12, 15, 14, 1, 13, 45, 28298 }, // ҳ
-    { 18, 19, 22, 2, 15, 86, 28343 }, // Ҵ
-    { 14, 14, 16, 1, 11, 49, 28429 }, // ҵ
-    { 14, 20, 17, 1, 15, 70, 28478 }, // Ҷ
-    { 10, 15, 12, 1, 11, 38, 28548 }, // ҷ
-    { 13, 15, 15, 1, 15, 49, 28586 }, // Ҹ
-    { 9, 11, 10, 1, 11, 25, 28635 }, // ҹ
-    { 12, 17, 16, 2, 17, 51, 28660 }, // Һ
-    { 11, 18, 17, 3, 18, 50, 28711 }, // һ
-    { 18, 17, 20, 0, 16, 77, 28761 }, // Ҽ
-    { 13, 12, 15, 0, 12, 39, 28838 }, // ҽ
-    { 19, 19, 23, 2, 16, 91, 28877 }, // Ҿ
-    { 14, 14, 16, 1, 12, 49, 28968 }, // ҿ
-    { 5, 18, 10, 2, 18, 23, 29017 }, // Ӏ
-    { 23, 26, 30, 3, 26, 150, 29040 }, // Ӂ
-    { 19, 23, 25, 3, 23, 110, 29190 }, // ӂ
-    { 12, 21, 16, 2, 16, 63, 29300 }, // Ӄ
-    { 9, 15, 11, 1, 11, 34, 29363 }, // ӄ
-    { 14, 18, 16, 2, 15, 63, 29397 }, // Ӆ
-    { 10, 14, 11, 1, 11, 35, 29460 }, // ӆ
-    { 17, 23, 22, 3, 18, 98, 29495 }, // Ӈ
-    { 12, 17, 15, 2, 13, 51, 29593 }, // ӈ
-    { 17, 24, 22, 3, 18, 102, 29644 }, // Ӊ
-    { 12, 17, 15, 2, 13, 51, 29746 }, // ӊ
-    { 12, 19, 14, 0, 15, 57, 29797 }, // Ӌ
-    { 8, 14, 10, 1, 11, 28, 29854 }, // ӌ
-    { 21, 24, 26, 3, 18, 126, 29882 }, // Ӎ
-    { 14, 17, 18, 2, 13, 60, 30008 }, // ӎ
-    { 4, 15, 6, 1, 15, 15, 30068 }, // ӏ
-    { 17, 26, 24, 3, 26, 111, 30083 }, // Ӑ
-    { 12, 20, 17, 2, 20, 60, 30194 }, // ӑ
-    { 17, 24, 24, 3, 24, 102, 30254 }, // Ӓ
-    { 12, 18, 17, 2, 18, 54, 30356 }, // ӓ
-    { 24, 19, 30, 3, 18, 114, 30410 }, // Ӕ
-    { 21, 13, 26, 2, 13, 69, 30524 }, // ӕ
-    { 11, 23, 13, 1, 23, 64, 30593 }, // Ӗ
-    { 12, 21, 17, 3, 21, 63, 30657 }, // ӗ
-    { 12, 13, 17, 3, 12, 39, 30720 }, // Ә
-    { 12, 14, 17, 3, 13, 42, 30759 }, // ә
-    { 12, 22, 17, 3, 21, 66, 30801 }, // Ӛ
-    { 12, 15, 17, 3, 13, 45, 30867 }, // ӛ
-    { 23, 24, 27, 3, 24, 138, 30912 }, // Ӝ
-    { 19, 21, 25, 3, 21, 100, 31050 }, // ӝ
-    { 11, 22, 13, 1, 22, 61, 31150 }, // Ӟ
-    { 10, 17, 9, 1, 17, 43, 31211 }, // ӟ
-    { 11, 16, 12, 1, 15, 44, 31254 }, // Ӡ
-    { 11, 16, 12, 1, 11, 44, 31298 }, // ӡ
-    { 16, 22, 22, 3, 22, 88, 31342 }, // Ӣ
-    { 12, 16, 14, 1, 16, 48, 31430 }, // ӣ
-    { 16, 24, 22, 3, 24, 96, 31478 }, // Ӥ
-    { 12, 17, 14, 1, 17, 51, 31574 }, // ӥ
-    { 17, 25, 24, 3, 24, 107, 31625 }, // Ӧ
-    { 12, 18, 14, 1, 18, 54, 31732 }, // ӧ
-    { 15, 16, 22, 4, 15, 60, 31786 }, // Ө
-    { 12, 12, 17, 3, 12, 36, 31846 }, // ө
-    { 15, 25, 22, 4, 24, 94, 31882 }, // Ӫ
-    { 12, 20, 17, 3, 20, 60, 31976 }, // ӫ
-    { 15, 23, 19, 2, 22, 87, 32036 }, // Ӭ
-    { 11, 17, 13, 1, 17, 47, 32123 }, // ӭ
-    { 12, 22, 14, 1, 21, 66, 32170 }, // Ӯ
-    { 12, 25, 17, 3, 19, 75, 32236 }, // ӯ
-    { 12, 23, 14, 1, 22, 69, 32311 }, // Ӱ
-    { 12, 26, 17, 3, 20, 78, 32380 }, // ӱ
-    { 16, 24, 14, 0, 23, 96, 32458 }, // Ӳ
-    { 16, 26, 17, 2, 20, 104, 32554 }, // ӳ
-    { 12, 22, 14, 1, 22, 66, 32658 }, // Ӵ
-    { 10, 17, 9, -1, 17, 43, 32724 }, // ӵ
-    { 11, 18, 14, 1, 15, 50, 32767 }, // Ӷ
-    { 8, 13, 9, 1, 11, 26, 32817 }, // ӷ
-    { 19, 23, 23, 2, 23, 110, 32843 }, // Ӹ
-    { 15, 19, 17, 1, 19, 72, 32953 }, // ӹ
-    { 21, 20, 24, 3, 18, 105, 33025 }, // Ӽ
-    { 14, 15, 16, 2, 13, 53, 33130 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 33183 }, //  
-    { 0, 0, 28, 0, 0, 0, 33183 }, //  
-    { 0, 0, 17, 0, 0, 0, 33183 }, //  
-    { 0, 0, 28, 0, 0, 0, 33183 }, //  
-    { 0, 0, 14, 0, 0, 0, 33183 }, //  
-    { 0, 0, 12, 0, 0, 0, 33183 }, //  
-    { 0, 0, 10, 0, 0, 0, 33183 }, //  
-    { 0, 0, 14, 0, 0, 0, 33183 }, //  
-    { 0, 0, 5, 0, 0, 0, 33183 }, //  
-    { 0, 0, 11, 0, 0, 0, 33183 }, //  
-    { 0, 0, 10, 0, 0, 0, 33183 }, //  
-    { 0, 0, 7, 0, 0, 0, 33183 }, // ​
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‏
-    { 10, 3, 11, 1, 8, 8, 33183 }, // ‐
-    { 10, 3, 11, 1, 8, 8, 33191 }, // ‑
-    { 15, 3, 16, 1, 8, 12, 33199 }, // ‒
-    { 14, 3, 17, 1, 8, 11, 33211 }, // –
-    { 21, 3, 23, 1, 8, 16, 33222 }, // —
-    { 21, 3, 23, 1, 8, 16, 33238 }, // ―
-    { 9, 18, 11, 1, 15, 41, 33254 }, // ‖
-    { 16, 8, 16, 1, -1, 32, 33295 }, // ‗
-    { 5, 6, 7, 1, 18, 8, 33327 }, // ‘
-    { 5, 6, 7, 1, 18, 8, 33335 }, // ’
-    { 5, 6, 7, 1, 3, 8, 33343 }, // ‚
-    { 5, 6, 7, 1, 18, 8, 33351 }, // ‛
-    { 10, 6, 12, 1, 18, 15, 33359 }, // “
-    { 10, 6, 12, 1, 18, 15, 33374 }, // ”
-    { 5, 6, 7, 1, 3, 8, 33389 }, // „
-    { 10, 6, 12, 1, 18, 15, 33397 }, // ‟
-    { 12, 28, 12, 0, 22, 84, 33412 }, // †
-    { 11, 28, 13, 1, 22, 77, 33496 }, // ‡
-    { 13, 12, 11, -1, 14, 39, 33573 }, // •
-    { 6, 7, 8, 1, 9, 11, 33612 }, // ‣
-    { 4, 4, 5, 1, 4, 4, 33623 }, // ․
-    { 4, 4, 5, 1, 4, 4, 33627 }, // ‥
-    { 18, 4, 20, 1, 4, 18, 33631 }, // …
-    { 3, 3, 5, 1, 8, 3, 33649 }, // ‧
-    { 0, 0, 26, 0, 0, 0, 33652 }, //  
-    { 13, 18, 23, 5, 16, 59, 33652 }, // ‰
-    { 5, 6, 7, 1, 18, 8, 33711 }, // ′
-    { 10, 6, 12, 1, 18, 15, 33719 }, // ″
-    { 16, 7, 18, 1, 18, 28, 33734 }, // ‴
-    { 5, 6, 7, 1, 17, 8, 33762 }, // ‵
-    { 10, 6, 11, 0, 17, 15, 33770 }, // ‶
-    { 16, 7, 18, 1, 18, 28, 33785 }, // ‷
-    { 9, 4, 12, 1, 17, 9, 33813 }, // ‸
-    { 7, 10, 9, 1, 11, 18, 33822 }, // ‹
-    { 7, 10, 9, 1, 11, 18, 33840 }, // ›
-    { 22, 21, 28, 4, 19, 116, 33858 }, // ※
-    { 6, 21, 7, 0, 21, 32, 33974 }, // ‼
-    { 11, 26, 16, 2, 25, 72, 34006 }, // ‽
-    { 10, 3, 11, 1, 17, 8, 34078 }, // ‾
-    { 9, 4, 12, 1, 14, 9, 34086 }, // ‿
-    { 14, 14, 17, 1, 19, 49, 34095 }, // ⁂
-    { 13, 17, 23, 5, 16, 56, 34144 }, // ⁄
-    { 23, 24, 26, 2, 24, 138, 34200 }, // ⁇
-    { 16, 23, 21, 2, 23, 92, 34338 }, // ⁈
-    { 17, 25, 17, 0, 23, 107, 34430 }, // ⁉
-    { 12, 33, 15, 2, 23, 99, 34537 }, // ⁒
-    { 0, 0, 100, 0, 0, 0, 34636 }, //  
-    { 6, 8, 7, 0, 17, 12, 34636 }, // ⁰
-    { 6, 9, 7, 0, 18, 14, 34648 }, // ⁴
-    { 6, 9, 7, 0, 18, 14, 34662 }, // ⁵
-    { 6, 8, 7, 0, 17, 12, 34676 }, // ⁶
-    { 7, 9, 7, 0, 18, 16, 34688 }, // ⁷
-    { 7, 8, 7, 0, 17, 14, 34704 }, // ⁸
-    { 7, 8, 7, 0, 17, 14, 34718 }, // ⁹
-    { 11, 12, 17, 3, 12, 33, 34732 }, // ⁿ
-    { 8, 11, 9, 1, 11, 22, 34765 }, // ₀
-    { 6, 9, 6, 0, 5, 14, 34787 }, // ₁
-    { 6, 9, 7, 0, 5, 14, 34801 }, // ₂
-    { 6, 9, 7, 0, 5, 14, 34815 }, // ₃
-    { 7, 8, 7, 0, 5, 14, 34829 }, // ₄
-    { 6, 8, 6, 0, 5, 12, 34843 }, // ₅
-    { 7, 8, 7, 0, 4, 14, 34855 }, // ₆
-    { 6, 9, 7, 0, 5, 14, 34869 }, // ₇
-    { 7, 9, 7, 0, 5, 16, 34883 }, // ₈
-    { 7, 9, 7, 0, 5, 16, 34899 }, // ₉
-    { 7, 28, 9, 2, 21, 49, 34915 }, // ₍
-    { 7, 28, 9, 0, 21, 49, 34964 }, // ₎
-    { 15, 28, 21, 3, 23, 105, 35013 }, // ₡
-    { 14, 20, 21, 3, 19, 70, 35118 }, // ₢
-    { 14, 20, 14, 0, 20, 70, 35188 }, // ₤
-    { 20, 18, 22, 2, 18, 90, 35258 }, // ₦
-    { 16, 18, 19, 1, 18, 72, 35348 }, // ₧
-    { 21, 18, 24, 3, 18, 95, 35420 }, // ₨
-    { 16, 18, 18, 1, 18, 72, 35515 }, // ₩
-    { 16, 16, 22, 3, 16, 64, 35587 }, // ₪
-    { 14, 17, 14, 1, 17, 60, 35651 }, // ₫
-    { 13, 19, 16, 1, 16, 62, 35711 }, // €
-    { 16, 18, 22, 3, 18, 72, 35773 }, // ₮
-    { 18, 18, 13, 0, 18, 81, 35845 }, // ₱
-    { 17, 25, 24, 3, 22, 107, 35926 }, // ₲
-    { 19, 19, 19, 1, 18, 91, 36033 }, // ₴
-    { 10, 16, 16, 3, 15, 40, 36124 }, // ₵
-    { 16, 19, 22, 3, 19, 76, 36164 }, // ₸
-    { 10, 17, 13, 1, 16, 43, 36240 }, // ₹
-    { 12, 15, 14, 1, 14, 45, 36283 }, // ₺
-    { 13, 16, 13, 0, 16, 52, 36328 }, // ₼
-    { 17, 18, 19, -1, 18, 77, 36380 }, // ₽
-    { 14, 13, 16, 1, 12, 46, 36457 }, // ←
-    { 14, 13, 16, 1, 13, 46, 36503 }, // ↑
-    { 14, 13, 16, 1, 12, 46, 36549 }, // →
-    { 14, 13, 16, 1, 13, 46, 36595 }, // ↓
-    { 16, 11, 19, 1, 11, 44, 36641 }, // ↔
-    { 12, 16, 14, 1, 17, 48, 36685 }, // ↕
-    { 11, 10, 13, 1, 10, 28, 36733 }, // ↖
-    { 11, 10, 13, 1, 10, 28, 36761 }, // ↗
-    { 11, 11, 13, 1, 11, 31, 36789 }, // ↘
-    { 11, 11, 13, 1, 11, 31, 36820 }, // ↙
-    { 16, 13, 18, 1, 12, 52, 36851 }, // ⇐
-    { 17, 15, 19, 1, 15, 64, 36903 }, // ⇑
-    { 16, 13, 18, 1, 12, 52, 36967 }, // ⇒
-    { 17, 16, 19, 1, 15, 68, 37019 }, // ⇓
-    { 18, 13, 20, 1, 12, 59, 37087 }, // ⇔
-    { 14, 17, 16, 1, 11, 60, 37146 }, // ⇕
-    { 12, 17, 14, 1, 17, 51, 37206 }, // ∂
-    { 21, 20, 24, 2, 19, 105, 37257 }, // ∅
-    { 16, 16, 18, 1, 16, 64, 37362 }, // ∆
-    { 13, 15, 15, 1, 15, 49, 37426 }, // ∏
-    { 13, 15, 15, 1, 15, 49, 37475 }, // ∐
-    { 10, 16, 12, 1, 15, 40, 37524 }, // ∑
-    { 10, 3, 13, 1, 7, 8, 37564 }, // −
-    { 17, 18, 19, 1, 17, 77, 37572 }, // √
-    { 17, 11, 19, 1, 13, 47, 37649 }, // ∞
-    { 18, 24, 18, 0, 19, 108, 37696 }, // ∫
-    { 5, 13, 6, 0, 13, 17, 37804 }, // ∶
-    { 12, 11, 16, 2, 12, 33, 37821 }, // ≈
-    { 14, 18, 23, 5, 16, 63, 37854 }, // ≠
-    { 16, 16, 18, 1, 15, 64, 37917 }, // ≤
-    { 16, 16, 18, 1, 15, 64, 37981 }, // ≥
+    { 9, 24, 16, 3, 19, 54, 2048 }, // J
+    { 15, 18, 21, 3, 18, 68, 2102 }, // K
+    { 12, 18, 19, 3, 18, 54, 2170 }, // L
+    { 19, 18, 26, 3, 18, 86, 2224 }, // M
+    { 16, 18, 22, 3, 18, 72, 2310 }, // N
+    { 17, 19, 24, 3, 18, 81, 2382 }, // O
+    { 13, 18, 19, 3, 18, 59, 2463 }, // P
+    { 17, 21, 21, 2, 18, 90, 2522 }, // Q
+    { 14, 18, 20, 3, 18, 63, 2612 }, // R
+    { 17, 19, 23, 3, 18, 81, 2675 }, // S
+    { 16, 18, 22, 3, 18, 72, 2756 }, // T
+    { 15, 19, 22, 3, 18, 72, 2828 }, // U
+    { 18, 18, 24, 3, 18, 81, 2900 }, // V
+    { 23, 18, 30, 3, 18, 104, 2981 }, // W
+    { 17, 18, 24, 3, 18, 77, 3085 }, // X
+    { 16, 18, 22, 3, 18, 72, 3162 }, // Y
+    { 17, 18, 24, 3, 18, 77, 3234 }, // Z
+    { 8, 29, 10, 1, 22, 58, 3311 }, // [
+    { 8, 20, 10, 1, 16, 40, 3369 }, // <backslash>
+    { 8, 29, 10, 1, 22, 58, 3409 }, // ]
+    { 9, 5, 12, 1, 20, 12, 3467 }, // ^
+    { 14, 3, 17, 1, -2, 11, 3479 }, // _
+    { 7, 4, 9, 1, 16, 7, 3490 }, // `
+    { 12, 13, 17, 2, 13, 39, 3497 }, // a
+    { 12, 19, 18, 3, 18, 57, 3536 }, // b
+    { 10, 14, 16, 3, 13, 35, 3593 }, // c
+    { 13, 19, 18, 2, 18, 62, 3628 }, // d
+    { 12, 13, 17, 3, 13, 39, 3690 }, // e
+    { 7, 17, 13, 3, 17, 30, 3729 }, // f
+    { 11, 17, 17, 3, 12, 47, 3759 }, // g
+    { 11, 18, 17, 3, 18, 50, 3806 }, // h
+    { 4, 18, 9, 3, 18, 18, 3856 }, // i
+    { 8, 24, 13, 3, 18, 48, 3874 }, // j
+    { 11, 17, 17, 3, 17, 47, 3922 }, // k
+    { 7, 17, 11, 2, 17, 30, 3969 }, // l
+    { 19, 12, 24, 3, 12, 57, 3999 }, // m
+    { 11, 12, 17, 3, 12, 33, 4056 }, // n
+    { 12, 12, 17, 3, 12, 36, 4096 }, // o
+    { 13, 18, 17, 2, 12, 59, 4132 }, // p
+    { 14, 18, 20, 3, 13, 63, 4191 }, // q
+    { 8, 12, 14, 3, 12, 24, 4254 }, // r
+    { 10, 12, 16, 3, 12, 30, 4278 }, // s
+    { 9, 16, 15, 3, 16, 36, 4308 }, // t
+    { 11, 12, 17, 3, 12, 33, 4344 }, // u
+    { 13, 12, 19, 3, 12, 39, 4377 }, // v
+    { 16, 12, 22, 3, 12, 48, 4416 }, // w
+    { 13, 12, 19, 3, 12, 39, 4464 }, // x
+    { 12, 18, 17, 3, 12, 54, 4503 }, // y
+    { 11, 12, 17, 3, 12, 33, 4557 }, // z
+    { 10, 20, 12, 1, 16, 50, 4590 }, // {
+    { 3, 18, 5, 1, 15, 14, 4640 }, // |
+    { 10, 20, 12, 1, 16, 50, 4654 }, // }
+    { 8, 5, 10, 1, 16, 10, 4704 }, // ~
+    { 0, 0, 18, 0, 0, 0, 4714 }, //  
+    { 6, 22, 7, 0, 16, 33, 4714 }, // ¡
+    { 10, 19, 16, 3, 16, 48, 4747 }, // ¢
+    { 14, 20, 14, 0, 20, 70, 4795 }, // £
+    { 12, 11, 14, 1, 13, 33, 4865 }, // ¤
+    { 14, 18, 16, 1, 16, 63, 4898 }, // ¥
+    { 3, 18, 5, 1, 15, 14, 4961 }, // ¦
+    { 12, 19, 17, 3, 17, 57, 4975 }, // §
+    { 10, 4, 11, 1, 16, 10, 5032 }, // ¨
+    { 9, 8, 11, 1, 19, 18, 5042 }, // ©
+    { 7, 8, 9, 2, 16, 14, 5060 }, // ª
+    { 11, 10, 13, 1, 10, 28, 5074 }, // «
+    { 11, 6, 13, 1, 7, 17, 5102 }, // ¬
+    { 10, 3, 11, 1, 8, 8, 5119 }, // ­
+    { 9, 8, 11, 1, 22, 18, 5127 }, // ®
+    { 9, 3, 11, 1, 15, 7, 5145 }, // ¯
+    { 10, 10, 11, 1, 17, 25, 5152 }, // °
+    { 11, 12, 13, 1, 11, 33, 5177 }, // ±
+    { 6, 8, 6, 0, 17, 12, 5210 }, // ²
+    { 6, 8, 7, 0, 17, 12, 5222 }, // ³
+    { 4, 5, 6, 1, 17, 5, 5234 }, // ´
+    { 12, 14, 17, 2, 12, 42, 5239 }, // µ
+    { 11, 17, 13, 1, 15, 47, 5281 }, // ¶
+    { 4, 4, 5, 1, 9, 4, 5328 }, // ·
+    { 5, 6, 7, 1, 1, 8, 5332 }, // ¸
+    { 6, 9, 6, 0, 18, 14, 5340 }, // ¹
+    { 7, 7, 9, 2, 15, 13, 5354 }, // º
+    { 11, 10, 13, 1, 10, 28, 5367 }, // »
+    { 18, 20, 23, 3, 19, 90, 5395 }, // ¼
+    { 18, 20, 23, 3, 18, 90, 5485 }, // ½
+    { 19, 19, 23, 2, 18, 91, 5575 }, // ¾
+    { 12, 23, 12, 0, 12, 69, 5666 }, // ¿
+    { 17, 24, 24, 3, 24, 102, 5735 }, // À
+    { 17, 27, 24, 3, 27, 115, 5837 }, // Á
+    { 17, 25, 24, 3, 25, 107, 5952 }, // Â
+    { 17, 24, 24, 3, 24, 102, 6144 }, // Ã
+    { 17, 24, 24, 3, 24, 102, 6246 }, // Ä
+    { 17, 25, 24, 3, 25, 107, 6348 }, // Å
+    { 24, 19, 30, 3, 18, 114, 6455 }, // Æ
+    { 14, 24, 21, 3, 19, 84, 6569 }, // Ç
+    { 13, 23, 19, 3, 23, 75, 6653 }, // È
+    { 13, 27, 19, 3, 27, 88, 6728 }, // É
+    { 13, 24, 19, 3, 24, 78, 6816 }, // Ê
+    { 13, 24, 19, 3, 24, 78, 6894 }, // Ë
+    { 7, 25, 10, 0, 25, 44, 6972 }, // Ì
+    { 5, 29, 10, 2, 29, 37, 7016 }, // Í
+    { 9, 26, 10, 0, 26, 59, 7053 }, // Î
+    { 11, 25, 10, -1, 25, 69, 7112 }, // Ï
+    { 19, 18, 23, 1, 18, 86, 7181 }, // Ð
+    { 16, 23, 22, 3, 23, 92, 7267 }, // Ñ
+    { 17, 24, 24, 3, 23, 102, 7359 }, // Ò
+    { 17, 28, 24, 3, 27, 119, 7461 }, // Ó
+    { 17, 25, 24, 3, 24, 107, 7580 }, // Ô
+    { 17, 24, 24, 3, 23, 102, 7687 }, // Õ
+    { 17, 24, 24, 3, 23, 102, 7789 }, // Ö
+    { 10, 6, 12, 1, 8, 15, 7891 }, // ×
+    { 26, 38, 25, -1, 28, 247, 7906 }, // Ø
+    { 15, 25, 22, 3, 24, 94, 8192 }, // Ù
+    { 15, 28, 22, 3, 27, 105, 8286 }, // Ú
+    { 15, 26, 22, 3, 25, 98, 8391 }, // Û
+    { 15, 25, 22, 3, 24, 94, 8489 }, // Ü
+    { 16, 28, 22, 3, 28, 112, 8583 }, // Ý
+    { 10, 17, 12, 1, 17, 43, 8695 }, // Þ
+    { 12, 17, 14, 1, 17, 51, 8738 }, // ß
+    { 12, 17, 17, 2, 17, 51, 8789 }, // à
+    { 12, 21, 17, 2, 21, 63, 8840 }, // á
+    { 12, 18, 17, 2, 18, 54, 8903 }, // â
+    { 12, 17, 17, 2, 17, 51, 8957 }, // ã
+    { 12, 17, 17, 2, 17, 51, 9008 }, // ä
+    { 12, 18, 17, 2, 18, 54, 9059 }, // å
+    { 21, 13, 26, 2, 13, 69, 9113 }, // æ
+    { 10, 18, 16, 3, 13, 45, 9182 }, // ç
+    { 12, 19, 17, 3, 19, 57, 9227 }, // è
+    { 12, 23, 17, 3, 23, 69, 9284 }, // é
+    { 12, 20, 17, 3, 20, 60, 9353 }, // ê
+    { 12, 20, 17, 3, 20, 60, 9413 }, // ë
+    { 7, 17, 9, 0, 17, 30, 9473 }, // ì
+    { 4, 21, 9, 3, 21, 21, 9503 }, // í
+    { 9, 18, 9, 0, 18, 41, 9524 }, // î
+    { 11, 18, 9, -1, 18, 50, 9565 }, // ï
+    { 16, 17, 17, 1, 17, 68, 9615 }, // ð
+    { 11, 18, 17, 3, 18, 50, 9683 }, // ñ
+    { 12, 19, 17, 3, 19, 57, 9733 }, // ò
+    { 12, 23, 17, 3, 23, 69, 9790 }, // ó
+    { 12, 20, 17, 3, 20, 60, 9859 }, // ô
+    { 12, 19, 17, 3, 19, 57, 9919 }, // õ
+    { 12, 19, 17, 3, 19, 57, 9976 }, // ö
+    { 14, 13, 16, 1, 13, 46, 10033 }, // ÷
+    { 13, 33, 17, 2, 22, 108, 10079 }, // ø
+    { 11, 18, 17, 3, 18, 50, 10187 }, // ù
+    { 11, 22, 17, 3, 22, 61, 10240 }, // ú
+    { 11, 18, 17, 3, 18, 50, 10301 }, // û
+    { 11, 18, 17, 3, 18, 50, 10351 }, // ü
+    { 12, 29, 17, 3, 23, 87, 10401 }, // ý
+    { 10, 21, 12, 1, 17, 53, 10488 }, // þ
+    { 12, 26, 17, 3, 20, 78, 10541 }, // ÿ
+    { 17, 23, 24, 3, 23, 98, 10619 }, // Ā
+    { 12, 16, 17, 2, 16, 48, 10717 }, // ā
+    { 17, 26, 24, 3, 26, 111, 10765 }, // Ă
+    { 12, 19, 17, 2, 19, 57, 10876 }, // ă
+    { 17, 23, 24, 3, 18, 98, 10933 }, // Ą
+    { 13, 17, 17, 2, 13, 56, 11031 }, // ą
+    { 14, 29, 21, 3, 28, 102, 11087 }, // Ć
+    { 10, 21, 16, 3, 20, 53, 11189 }, // ć
+    { 14, 27, 21, 3, 26, 95, 11242 }, // Ĉ
+    { 10, 19, 16, 3, 18, 48, 11337 }, // ĉ
+    { 14, 27, 21, 3, 26, 95, 11385 }, // Ċ
+    { 10, 20, 16, 3, 19, 50, 11480 }, // ċ
+    { 14, 28, 21, 3, 27, 98, 11530 }, // Č
+    { 10, 21, 16, 3, 20, 53, 11628 }, // č
+    { 17, 26, 23, 3, 26, 111, 11681 }, // Ď
+    { 17, 19, 18, 2, 18, 81, 11792 }, // ď
+    { 19, 18, 23, 1, 18, 86, 11873 }, // Đ
+    { 16, 19, 18, 2, 18, 76, 11959 }, // đ
+    { 13, 23, 19, 3, 23, 75, 12035 }, // Ē
+    { 12, 19, 17, 3, 19, 57, 12110 }, // ē
+    { 13, 26, 19, 3, 26, 85, 12167 }, // Ĕ
+    { 12, 22, 17, 3, 22, 66, 12288 }, // ĕ
+    { 13, 25, 19, 3, 25, 82, 12354 }, // Ė
+    { 12, 21, 17, 3, 21, 63, 12436 }, // ė
+    { 13, 23, 19, 3, 18, 75, 12499 }, // Ę
+    { 12, 19, 17, 3, 13, 57, 12574 }, // ę
+    { 13, 25, 19, 3, 25, 82, 12631 }, // Ě
+    { 12, 22, 17, 3, 22, 66, 12713 }, // ě
+    { 17, 24, 24, 3, 24, 102, 12779 }, // Ĝ
+    { 11, 23, 17, 3, 18, 64, 12881 }, // ĝ
+    { 17, 26, 24, 3, 26, 111, 12945 }, // Ğ
+    { 11, 25, 17, 3, 20, 69, 13056 }, // ğ
+    { 17, 25, 24, 3, 25, 107, 13125 }, // Ġ
+    { 11, 24, 17, 3, 19, 66, 13232 }, // ġ
+    { 17, 28, 24, 3, 19, 119, 13298 }, // Ģ
+    { 11, 25, 17, 3, 20, 69, 13417 }, // ģ
+    { 16, 24, 22, 3, 24, 96, 13486 }, // Ĥ
+    { 13, 23, 17, 1, 23, 75, 13582 }, // ĥ
+    { 17, 18, 22, 2, 18, 77, 13657 }, // Ħ
+    { 14, 18, 17, 0, 18, 63, 13734 }, // ħ
+    { 8, 26, 10, 0, 26, 52, 13797 }, // Ĩ
+    { 8, 18, 9, 1, 18, 36, 13849 }, // ĩ
+    { 11, 24, 10, -1, 24, 66, 13885 }, // Ī
+    { 10, 17, 9, 0, 17, 43, 13951 }, // ī
+    { 5, 23, 13, 5, 18, 29, 13994 }, // Į
+    { 5, 23, 9, 2, 18, 29, 14023 }, // į
+    { 5, 26, 10, 2, 26, 33, 14052 }, // İ
+    { 4, 12, 9, 3, 12, 12, 14085 }, // ı
+    { 14, 23, 19, 2, 18, 81, 14097 }, // Ĳ
+    { 15, 24, 9, 3, 18, 90, 14178 }, // ĳ
+    { 10, 27, 16, 3, 22, 68, 14268 }, // Ĵ
+    { 11, 23, 13, 3, 17, 64, 14336 }, // ĵ
+    { 15, 25, 21, 3, 18, 94, 14400 }, // Ķ
+    { 11, 26, 17, 3, 17, 72, 14494 }, // ķ
+    { 9, 12, 13, 2, 12, 27, 14566 }, // ĸ
+    { 12, 25, 19, 3, 25, 75, 14593 }, // Ĺ
+    { 7, 25, 11, 2, 25, 44, 14668 }, // ĺ
+    { 12, 27, 19, 3, 18, 81, 14712 }, // Ļ
+    { 7, 25, 11, 2, 17, 44, 14793 }, // ļ
+    { 12, 18, 19, 3, 18, 54, 14837 }, // Ľ
+    { 9, 18, 11, 2, 18, 41, 14891 }, // ľ
+    { 12, 18, 19, 3, 18, 54, 14932 }, // Ŀ
+    { 10, 17, 11, 2, 17, 43, 14986 }, // ŀ
+    { 20, 29, 19, -5, 23, 145, 15029 }, // Ł
+    { 14, 17, 11, -4, 17, 60, 15174 }, // ł
+    { 16, 25, 22, 3, 25, 100, 15234 }, // Ń
+    { 11, 20, 17, 3, 20, 55, 15334 }, // ń
+    { 16, 25, 22, 3, 18, 100, 15389 }, // Ņ
+    { 11, 19, 17, 3, 12, 53, 15489 }, // ņ
+    { 16, 25, 22, 3, 25, 100, 15542 }, // Ň
+    { 11, 20, 17, 3, 20, 55, 15642 }, // ň
+    { 12, 22, 14, 1, 22, 66, 15697 }, // ŉ
+    { 16, 22, 22, 3, 18, 88, 15763 }, // Ŋ
+    { 11, 16, 17, 3, 12, 44, 15851 }, // ŋ
+    { 17, 23, 24, 3, 22, 98, 15895 }, // Ō
+    { 12, 18, 17, 3, 18, 54, 15993 }, // ō
+    { 17, 27, 24, 3, 26, 115, 16047 }, // Ŏ
+    { 12, 22, 17, 3, 22, 66, 16162 }, // ŏ
+    { 18, 25, 24, 3, 24, 113, 16228 }, // Ő
+    { 16, 20, 17, 1, 20, 80, 16384 }, // ő
+    { 24, 19, 25, 3, 19, 114, 16464 }, // Œ
+    { 20, 13, 22, 3, 13, 65, 16578 }, // œ
+    { 14, 25, 20, 3, 25, 88, 16643 }, // Ŕ
+    { 8, 18, 14, 3, 18, 36, 16731 }, // ŕ
+    { 14, 28, 20, 3, 18, 98, 16767 }, // Ŗ
+    { 9, 23, 14, 2, 12, 52, 16865 }, // ŗ
+    { 14, 25, 20, 3, 25, 88, 16917 }, // Ř
+    { 10, 18, 14, 1, 18, 45, 17005 }, // ř
+    { 17, 28, 23, 3, 27, 119, 17050 }, // Ś
+    { 10, 20, 16, 3, 20, 50, 17169 }, // ś
+    { 17, 26, 23, 3, 25, 111, 17219 }, // Ŝ
+    { 10, 18, 16, 3, 18, 45, 17330 }, // ŝ
+    { 17, 23, 23, 3, 18, 98, 17375 }, // Ş
+    { 10, 18, 16, 3, 12, 45, 17473 }, // ş
+    { 17, 27, 23, 3, 26, 115, 17518 }, // Š
+    { 10, 20, 16, 3, 20, 50, 17633 }, // š
+    { 16, 22, 22, 3, 18, 88, 17683 }, // Ţ
+    { 9, 20, 15, 3, 16, 45, 17771 }, // ţ
+    { 16, 24, 22, 3, 24, 96, 17816 }, // Ť
+    { 10, 18, 15, 3, 18, 45, 17912 }, // ť
+    { 16, 18, 22, 3, 18, 72, 17957 }, // Ŧ
+    { 10, 16, 15, 2, 16, 40, 18029 }, // ŧ
+    { 15, 26, 22, 3, 25, 98, 18069 }, // Ũ
+    { 11, 19, 17, 3, 19, 53, 18167 }, // ũ
+    { 15, 24, 22, 3, 23, 90, 18220 }, // Ū
+    { 11, 17, 17, 3, 17, 47, 18310 }, // ū
+    { 15, 28, 22, 3, 27, 105, 18432 }, // Ŭ
+    { 11, 20, 17, 3, 20, 55, 18537 }, // ŭ
+    { 15, 27, 22, 3, 26, 102, 18592 }, // Ů
+    { 11, 20, 17, 3, 20, 55, 18694 }, // ů
+    { 17, 26, 22, 3, 25, 111, 18749 }, // Ű
+    { 16, 19, 17, 1, 19, 76, 18860 }, // ű
+    { 15, 23, 22, 3, 18, 87, 18936 }, // Ų
+    { 11, 17, 17, 3, 12, 47, 19023 }, // ų
+    { 23, 24, 30, 3, 24, 138, 19070 }, // Ŵ
+    { 16, 19, 22, 3, 19, 76, 19208 }, // ŵ
+    { 16, 25, 22, 3, 25, 100, 19284 }, // Ŷ
+    { 12, 26, 17, 3, 20, 78, 19384 }, // ŷ
+    { 16, 25, 22, 3, 25, 100, 19462 }, // Ÿ
+    { 17, 25, 24, 3, 25, 107, 19562 }, // Ź
+    { 11, 20, 17, 3, 20, 55, 19669 }, // ź
+    { 17, 24, 24, 3, 24, 102, 19724 }, // Ż
+    { 11, 19, 17, 3, 19, 53, 19826 }, // ż
+    { 17, 25, 24, 3, 25, 107, 19879 }, // Ž
+    { 11, 20, 17, 3, 20, 55, 19986 }, // ž
+    { 7, 17, 11, 3, 17, 30, 20041 }, // ſ
+    { 7, 4, 0, 1, 16, 7, 20071 }, // ̀
+    { 4, 5, 0, 1, 17, 5, 20078 }, // ́
+    { 9, 5, 0, 1, 1, 12, 20083 }, // ̂
+    { 8, 5, 0, 1, 16, 10, 20095 }, // ̃
+    { 11, 3, 0, 1, 14, 9, 20105 }, // ̄
+    { 14, 3, 0, 1, 18, 11, 20114 }, // ̅
+    { 9, 5, 0, 1, 16, 12, 20125 }, // ̆
+    { 4, 4, 0, 1, 16, 4, 20137 }, // ̇
+    { 10, 4, 0, 1, 16, 10, 20141 }, // ̈
+    { 5, 4, 0, 0, 13, 5, 20151 }, // ̉
+    { 5, 5, 0, 1, 16, 7, 20156 }, // ̊
+    { 15, 4, 0, 1, 16, 15, 20163 }, // ̋
+    { 9, 5, 0, 1, 16, 12, 20178 }, // ̌
+    { 15, 4, 0, -4, 17, 15, 20190 }, // ̏
+    { 6, 6, 0, 0, 16, 9, 20205 }, // ̒
+    { 5, 6, 0, 1, 15, 8, 20214 }, // ̓
+    { 6, 6, 0, 0, 15, 9, 20222 }, // ̔
+    { 4, 5, 0, 1, -1, 5, 20231 }, // ̘
+    { 4, 5, 0, 1, -1, 5, 20236 }, // ̙
+    { 9, 5, 0, 1, 17, 12, 20241 }, // ̚
+    { 4, 5, 0, 1, 13, 5, 20253 }, // ̛
+    { 3, 5, 0, 1, -1, 4, 20258 }, // ̜
+    { 5, 4, 0, 1, 3, 5, 20262 }, // ̝
+    { 5, 4, 0, 1, 0, 5, 20267 }, // ̞
+    { 5, 5, 0, 1, -2, 7, 20272 }, // ̟
+    { 10, 3, 0, 1, -3, 8, 20279 }, // ̠
+    { 4, 4, 0, 1, 1, 4, 20287 }, // ̣
+    { 10, 4, 0, 1, 0, 10, 20291 }, // ̤
+    { 5, 5, 0, 1, 16, 7, 20301 }, // ̥
+    { 5, 6, 0, 1, 3, 8, 20308 }, // ̦
+    { 5, 6, 0, 1, 1, 8, 20316 }, // ̧
+    { 5, 6, 0, 1, 1, 8, 20324 }, // ̨
+    { 3, 6, 0, 1, -1, 5, 20332 }, // ̩
+    { 7, 4, 0, 1, -1, 7, 20337 }, // ̪
+    { 9, 5, 0, 1, 0, 12, 20344 }, // ̬
+    { 9, 5, 0, 1, -1, 12, 20356 }, // ̭
+    { 8, 5, 0, 1, 16, 10, 20368 }, // ̰
+    { 9, 3, 0, 1, 15, 7, 20378 }, // ̱
+    { 9, 3, 0, 1, -1, 7, 20385 }, // ̲
+    { 8, 5, 0, 1, 16, 10, 20392 }, // ̴
+    { 10, 3, 0, 1, 8, 8, 20402 }, // ̵
+    { 3, 5, 0, 1, -1, 4, 20410 }, // ̹
+    { 7, 4, 0, 1, -1, 7, 20414 }, // ̺
+    { 7, 5, 0, 1, 0, 9, 20421 }, // ̻
+    { 7, 4, 0, 1, 0, 7, 20430 }, // ̼
+    { 5, 5, 0, 2, 16, 7, 20437 }, // ̽
+    { 8, 5, 0, 1, 16, 10, 20444 }, // ͂
+    { 3, 4, 0, 1, 17, 3, 20454 }, // ̓
+    { 10, 10, 0, 1, 22, 25, 20480 }, // ̈́
+    { 7, 4, 0, 1, 16, 7, 20505 }, // ͆
+    { 10, 8, 0, 1, 0, 20, 20512 }, // ͇
+    { 8, 6, 0, 1, 0, 12, 20532 }, // ͈
+    { 7, 6, 0, 1, -1, 11, 20544 }, // ͉
+    { 8, 12, 0, 1, 20, 24, 20555 }, // ͊
+    { 17, 9, 0, 1, 19, 39, 20579 }, // ͋
+    { 12, 11, 0, 2, 12, 33, 20618 }, // ͌
+    { 10, 5, 0, 2, -2, 13, 20651 }, // ͍
+    { 4, 3, 0, 1, 2, 3, 20664 }, // ͎
+    { 17, 4, 0, 1, 0, 17, 20667 }, // ͜
+    { 17, 4, 0, 1, 16, 17, 20684 }, // ͡
+    { 21, 5, 0, 1, -1, 27, 20701 }, // ͢
+    { 11, 21, 13, 1, 21, 58, 20728 }, // Ѐ
+    { 11, 20, 13, 1, 20, 55, 20786 }, // Ё
+    { 17, 17, 21, 2, 17, 73, 20841 }, // Ђ
+    { 11, 24, 14, 1, 24, 66, 20914 }, // Ѓ
+    { 15, 17, 19, 2, 16, 64, 20980 }, // Є
+    { 17, 19, 23, 3, 18, 81, 21044 }, // Ѕ
+    { 5, 18, 10, 2, 18, 23, 21125 }, // І
+    { 10, 25, 10, -1, 25, 63, 21148 }, // Ї
+    { 9, 24, 16, 3, 19, 54, 21211 }, // Ј
+    { 21, 16, 24, 2, 15, 84, 21265 }, // Љ
+    { 20, 16, 23, 2, 16, 80, 21349 }, // Њ
+    { 18, 18, 22, 3, 18, 81, 21429 }, // Ћ
+    { 15, 25, 21, 3, 25, 94, 21510 }, // Ќ
+    { 16, 24, 22, 3, 24, 96, 21604 }, // Ѝ
+    { 12, 25, 14, 1, 24, 75, 21700 }, // Ў
+    { 13, 19, 15, 1, 15, 62, 21775 }, // Џ
+    { 17, 18, 24, 3, 18, 77, 21837 }, // А
+    { 11, 15, 14, 1, 15, 42, 21914 }, // Б
+    { 12, 15, 14, 1, 15, 45, 21956 }, // В
+    { 11, 15, 14, 1, 15, 42, 22001 }, // Г
+    { 15, 18, 17, 1, 15, 68, 22043 }, // Д
+    { 11, 15, 13, 1, 15, 42, 22111 }, // Е
+    { 23, 18, 30, 3, 18, 104, 22153 }, // Ж
+    { 11, 16, 13, 1, 16, 44, 22257 }, // З
+    { 16, 18, 22, 3, 18, 72, 22301 }, // И
+    { 16, 26, 22, 3, 26, 104, 22373 }, // Й
+    { 15, 18, 21, 3, 18, 68, 22528 }, // К
+    { 12, 16, 16, 2, 15, 48, 22596 }, // Л
+    { 15, 15, 18, 1, 15, 57, 22644 }, // М
+    { 16, 18, 22, 3, 18, 72, 22701 }, // Н
+    { 17, 19, 24, 3, 18, 81, 22773 }, // О
+    { 12, 16, 14, 1, 16, 48, 22854 }, // П
+    { 13, 18, 19, 3, 18, 59, 22902 }, // Р
+    { 14, 20, 21, 3, 19, 70, 22961 }, // С
+    { 16, 18, 22, 3, 18, 72, 23031 }, // Т
+    { 12, 18, 14, 1, 17, 54, 23103 }, // У
+    { 16, 16, 18, 1, 16, 64, 23157 }, // Ф
+    { 17, 18, 24, 3, 18, 77, 23221 }, // Х
+    { 13, 19, 15, 1, 16, 62, 23298 }, // Ц
+    { 12, 16, 14, 1, 16, 48, 23360 }, // Ч
+    { 15, 16, 17, 1, 16, 60, 23408 }, // Ш
+    { 17, 20, 19, 1, 16, 85, 23468 }, // Щ
+    { 14, 16, 14, -2, 16, 56, 23553 }, // Ъ
+    { 19, 16, 23, 2, 16, 76, 23609 }, // Ы
+    { 10, 16, 14, 2, 16, 40, 23685 }, // Ь
+    { 15, 17, 19, 2, 16, 64, 23725 }, // Э
+    { 17, 16, 21, 2, 16, 68, 23789 }, // Ю
+    { 14, 18, 20, 3, 18, 63, 23857 }, // Я
+    { 12, 13, 17, 2, 13, 39, 23920 }, // а
+    { 12, 16, 15, 1, 16, 48, 23959 }, // б
+    { 11, 13, 15, 2, 13, 36, 24007 }, // в
+    { 10, 12, 12, 1, 12, 30, 24043 }, // г
+    { 14, 14, 16, 1, 12, 49, 24073 }, // д
+    { 12, 13, 17, 3, 13, 39, 24122 }, // е
+    { 19, 15, 25, 3, 15, 72, 24161 }, // ж
+    { 8, 11, 9, 1, 11, 22, 24233 }, // з
+    { 12, 12, 14, 1, 12, 36, 24255 }, // и
+    { 12, 16, 14, 1, 16, 48, 24291 }, // й
+    { 11, 13, 17, 3, 13, 36, 24339 }, // к
+    { 9, 12, 11, 1, 11, 27, 24375 }, // л
+    { 15, 14, 19, 2, 14, 53, 24402 }, // м
+    { 13, 13, 19, 3, 13, 43, 24455 }, // н
+    { 12, 12, 14, 1, 12, 36, 24498 }, // о
+    { 12, 12, 14, 1, 12, 36, 24534 }, // п
+    { 13, 18, 17, 2, 12, 59, 24576 }, // р
+    { 10, 14, 16, 3, 13, 35, 24635 }, // с
+    { 12, 12, 14, 1, 12, 36, 24670 }, // т
+    { 12, 18, 17, 3, 12, 54, 24706 }, // у
+    { 16, 17, 18, 1, 12, 68, 24760 }, // ф
+    { 13, 12, 15, 1, 12, 39, 24828 }, // х
+    { 13, 15, 15, 1, 12, 49, 24867 }, // ц
+    { 8, 11, 9, 1, 11, 22, 24916 }, // ч
+    { 15, 12, 17, 1, 12, 45, 24938 }, // ш
+    { 16, 16, 19, 1, 12, 64, 24983 }, // щ
+    { 13, 11, 16, 1, 11, 36, 25047 }, // ъ
+    { 15, 12, 17, 1, 12, 45, 25083 }, // ы
+    { 10, 12, 13, 1, 12, 30, 25128 }, // ь
+    { 11, 12, 13, 1, 12, 33, 25158 }, // э
+    { 14, 13, 17, 1, 13, 46, 25191 }, // ю
+    { 11, 11, 13, 1, 11, 31, 25237 }, // я
+    { 12, 20, 17, 3, 20, 60, 25268 }, // ѐ
+    { 12, 17, 14, 1, 16, 51, 25328 }, // ё
+    { 15, 21, 17, 0, 18, 79, 25379 }, // ђ
+    { 10, 18, 12, 1, 18, 45, 25458 }, // ѓ
+    { 11, 12, 13, 1, 11, 33, 25503 }, // є
+    { 10, 12, 16, 3, 12, 30, 25536 }, // ѕ
+    { 4, 18, 9, 3, 18, 18, 25566 }, // і
+    { 11, 18, 9, -1, 18, 50, 25584 }, // ї
+    { 8, 24, 13, 3, 18, 48, 25634 }, // ј
+    { 15, 12, 17, 1, 11, 45, 25682 }, // љ
+    { 14, 11, 16, 1, 11, 39, 25727 }, // њ
+    { 14, 18, 17, 0, 18, 63, 25766 }, // ћ
+    { 11, 19, 17, 3, 19, 53, 25829 }, // ќ
+    { 12, 17, 14, 1, 17, 51, 25882 }, // ѝ
+    { 12, 27, 17, 3, 21, 81, 25933 }, // ў
+    { 9, 14, 11, 1, 11, 32, 26014 }, // џ
+    { 12, 17, 17, 3, 16, 51, 26046 }, // Ѣ
+    { 13, 16, 15, 1, 15, 52, 26097 }, // ѣ
+    { 17, 15, 21, 2, 15, 64, 26149 }, // Ѫ
+    { 12, 11, 15, 1, 11, 33, 26213 }, // ѫ
+    { 16, 19, 22, 3, 19, 76, 26246 }, // Ѳ
+    { 13, 15, 17, 2, 15, 49, 26322 }, // ѳ
+    { 22, 23, 24, 3, 23, 127, 26371 }, // Ѵ
+    { 14, 15, 17, 2, 15, 53, 26498 }, // ѵ
+    { 8, 6, 0, 1, 19, 12, 26551 }, // ҆
+    { 11, 17, 14, 1, 17, 47, 26563 }, // Ґ
+    { 10, 14, 12, 1, 14, 35, 26624 }, // ґ
+    { 12, 15, 14, 0, 15, 45, 26659 }, // Ғ
+    { 9, 11, 9, 0, 11, 25, 26704 }, // ғ
+    { 13, 17, 14, 1, 17, 56, 26729 }, // Ҕ
+    { 7, 11, 9, 1, 11, 20, 26785 }, // ҕ
+    { 23, 21, 27, 2, 18, 121, 26805 }, // Җ
+    { 16, 15, 18, 1, 13, 60, 26926 }, // җ
+    { 11, 18, 15, 2, 16, 50, 26986 }, // Ҙ
+    { 8, 16, 9, 1, 11, 32, 27036 }, // ҙ
+    { 14, 21, 18, 2, 18, 74, 27068 }, // Қ
+    { 10, 15, 13, 1, 13, 38, 27142 }, // қ
+    { 16, 16, 20, 2, 16, 64, 27180 }, // Ҝ
+    { 13, 11, 15, 1, 11, 36, 27244 }, // ҝ
+    { 15, 18, 21, 3, 18, 68, 27280 }, // Ҟ
+    { 14, 17, 17, 0, 17, 60, 27348 }, // ҟ
+    { 20, 18, 21, -2, 18, 90, 27408 }, // Ҡ
+    { 13, 13, 15, -1, 13, 43, 27498 }, // ҡ
+    { 16, 21, 19, 2, 18, 84, 27541 }, // Ң
+    { 12, 15, 13, 1, 13, 45, 27625 }, // ң
+    { 22, 19, 22, 3, 19, 105, 27670 }, // Ҥ
+    { 15, 12, 15, 2, 12, 45, 27775 }, // ҥ
+    { 20, 17, 25, 2, 17, 85, 27820 }, // Ҧ
+    { 20, 20, 22, 1, 14, 100, 27905 }, // ҧ
+    { 21, 18, 25, 2, 17, 95, 28005 }, // Ҩ
+    { 17, 15, 19, 1, 14, 64, 28100 }, // ҩ
+    { 14, 23, 21, 3, 19, 81, 28164 }, // Ҫ
+    { 10, 16, 16, 3, 13, 40, 28245 }, // ҫ
+    { 16, 20, 20, 2, 18, 80, 28285 }, // Ҭ
+    { 11, 14, 13, 1, 12, 39, 28365 }, // ҭ
+    { 16, 18, 22, 3, 18, 72, 28404 }, // Ү
+    { 12, 15, 14, 1, 11, 45, 28476 }, // ү
+    { 16, 18, 22, 3, 18, 72, 28521 }, // Ұ
+    { 12, 16, 14, 1, 11, 48, 28593 }, // ұ
+    { 17, 21, 21, 2, 18, 90, 28672 }, // Ҳ
+    { 12, 15, 14, 1, 13, 45, 28762 }, // ҳ
+    { 18, 19, 22, 2, 15, 86, 28807 }, // Ҵ
+    { 14, 14, 16, 1, 11, 49, 28893 }, // ҵ
+    { 14, 20, 17, 1, 15, 70, 28942 }, // Ҷ
+    { 10, 15, 12, 1, 11, 38, 29012 }, // ҷ
+    { 13, 15, 15, 1, 15, 49, 29050 }, // Ҹ
+    { 9, 11, 10, 1, 11, 25, 29099 }, // ҹ
+    { 12, 17, 16, 2, 17, 51, 29124 }, // Һ
+    { 11, 18, 17, 3, 18, 50, 29175 }, // һ
+    { 18, 17, 20, 0, 16, 77, 29225 }, // Ҽ
+    { 13, 12, 15, 0, 12, 39, 29302 }, // ҽ
+    { 19, 19, 23, 2, 16, 91, 29341 }, // Ҿ
+    { 14, 14, 16, 1, 12, 49, 29432 }, // ҿ
+    { 5, 18, 10, 2, 18, 23, 29481 }, // Ӏ
+    { 23, 26, 30, 3, 26, 150, 29504 }, // Ӂ
+    { 19, 23, 25, 3, 23, 110, 29654 }, // ӂ
+    { 12, 21, 16, 2, 16, 63, 29764 }, // Ӄ
+    { 9, 15, 11, 1, 11, 34, 29827 }, // ӄ
+    { 14, 18, 16, 2, 15, 63, 29861 }, // Ӆ
+    { 10, 14, 11, 1, 11, 35, 29924 }, // ӆ
+    { 17, 23, 22, 3, 18, 98, 29959 }, // Ӈ
+    { 12, 17, 15, 2, 13, 51, 30057 }, // ӈ
+    { 17, 24, 22, 3, 18, 102, 30108 }, // Ӊ
+    { 12, 17, 15, 2, 13, 51, 30210 }, // ӊ
+    { 12, 19, 14, 0, 15, 57, 30261 }, // Ӌ
+    { 8, 14, 10, 1, 11, 28, 30318 }, // ӌ
+    { 21, 24, 26, 3, 18, 126, 30346 }, // Ӎ
+    { 14, 17, 18, 2, 13, 60, 30472 }, // ӎ
+    { 4, 15, 6, 1, 15, 15, 30532 }, // ӏ
+    { 17, 26, 24, 3, 26, 111, 30547 }, // Ӑ
+    { 12, 20, 17, 2, 20, 60, 30658 }, // ӑ
+    { 17, 24, 24, 3, 24, 102, 30720 }, // Ӓ
+    { 12, 18, 17, 2, 18, 54, 30822 }, // ӓ
+    { 24, 19, 30, 3, 18, 114, 30876 }, // Ӕ
+    { 21, 13, 26, 2, 13, 69, 30990 }, // ӕ
+    { 11, 23, 13, 1, 23, 64, 31059 }, // Ӗ
+    { 12, 21, 17, 3, 21, 63, 31123 }, // ӗ
+    { 12, 13, 17, 3, 12, 39, 31186 }, // Ә
+    { 12, 14, 17, 3, 13, 42, 31225 }, // ә
+    { 12, 22, 17, 3, 21, 66, 31267 }, // Ӛ
+    { 12, 15, 17, 3, 13, 45, 31333 }, // ӛ
+    { 23, 24, 27, 3, 24, 138, 31378 }, // Ӝ
+    { 19, 21, 25, 3, 21, 100, 31516 }, // ӝ
+    { 11, 22, 13, 1, 22, 61, 31616 }, // Ӟ
+    { 10, 17, 9, 1, 17, 43, 31677 }, // ӟ
+    { 11, 16, 12, 1, 15, 44, 31720 }, // Ӡ
+    { 11, 16, 12, 1, 11, 44, 31764 }, // ӡ
+    { 16, 22, 22, 3, 22, 88, 31808 }, // Ӣ
+    { 12, 16, 14, 1, 16, 48, 31896 }, // ӣ
+    { 16, 24, 22, 3, 24, 96, 31944 }, // Ӥ
+    { 12, 17, 14, 1, 17, 51, 32040 }, // ӥ
+    { 17, 25, 24, 3, 24, 107, 32091 }, // Ӧ
+    { 12, 18, 14, 1, 18, 54, 32198 }, // ӧ
+    { 15, 16, 22, 4, 15, 60, 32252 }, // Ө
+    { 12, 12, 17, 3, 12, 36, 32312 }, // ө
+    { 15, 25, 22, 4, 24, 94, 32348 }, // Ӫ
+    { 12, 20, 17, 3, 20, 60, 32442 }, // ӫ
+    { 15, 23, 19, 2, 22, 87, 32502 }, // Ӭ
+    { 11, 17, 13, 1, 17, 47, 32589 }, // ӭ
+    { 12, 22, 14, 1, 21, 66, 32636 }, // Ӯ
+    { 12, 25, 17, 3, 19, 75, 32768 }, // ӯ
+    { 12, 23, 14, 1, 22, 69, 32843 }, // Ӱ
+    { 12, 26, 17, 3, 20, 78, 32912 }, // ӱ
+    { 16, 24, 14, 0, 23, 96, 32990 }, // Ӳ
+    { 16, 26, 17, 2, 20, 104, 33086 }, // ӳ
+    { 12, 22, 14, 1, 22, 66, 33190 }, // Ӵ
+    { 10, 17, 9, -1, 17, 43, 33256 }, // ӵ
+    { 11, 18, 14, 1, 15, 50, 33299 }, // Ӷ
+    { 8, 13, 9, 1, 11, 26, 33349 }, // ӷ
+    { 19, 23, 23, 2, 23, 110, 33375 }, // Ӹ
+    { 15, 19, 17, 1, 19, 72, 33485 }, // ӹ
+    { 21, 20, 24, 3, 18, 105, 33557 }, // Ӽ
+    { 14, 15, 16, 2, 13, 53, 33662 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 33715 }, //  
+    { 0, 0, 28, 0, 0, 0, 33715 }, //  
+    { 0, 0, 17, 0, 0, 0, 33715 }, //  
+    { 0, 0, 28, 0, 0, 0, 33715 }, //  
+    { 0, 0, 14, 0, 0, 0, 33715 }, //  
+    { 0, 0, 12, 0, 0, 0, 33715 }, //  
+    { 0, 0, 10, 0, 0, 0, 33715 }, //  
+    { 0, 0, 14, 0, 0, 0, 33715 }, //  
+    { 0, 0, 5, 0, 0, 0, 33715 }, //  
+    { 0, 0, 11, 0, 0, 0, 33715 }, //  
+    { 0, 0, 10, 0, 0, 0, 33715 }, //  
+    { 0, 0, 7, 0, 0, 0, 33715 }, // ​
+    { 0, 0, 0, 0, 0, 0, 33715 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 33715 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 33715 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 33715 }, // ‏
+    { 10, 3, 11, 1, 8, 8, 33715 }, // ‐
+    { 10, 3, 11, 1, 8, 8, 33723 }, // ‑
+    { 15, 3, 16, 1, 8, 12, 33731 }, // ‒
+    { 14, 3, 17, 1, 8, 11, 33743 }, // –
+    { 21, 3, 23, 1, 8, 16, 33754 }, // —
+    { 21, 3, 23, 1, 8, 16, 33770 }, // ―
+    { 9, 18, 11, 1, 15, 41, 33786 }, // ‖
+    { 16, 8, 16, 1, -1, 32, 33827 }, // ‗
+    { 5, 6, 7, 1, 18, 8, 33859 }, // ‘
+    { 5, 6, 7, 1, 18, 8, 33867 }, // ’
+    { 5, 6, 7, 1, 3, 8, 33875 }, // ‚
+    { 5, 6, 7, 1, 18, 8, 33883 }, // ‛
+    { 10, 6, 12, 1, 18, 15, 33891 }, // “
+    { 10, 6, 12, 1, 18, 15, 33906 }, // ”
+    { 5, 6, 7, 1, 3, 8, 33921 }, // „
+    { 10, 6, 12, 1, 18, 15, 33929 }, // ‟
+    { 12, 28, 12, 0, 22, 84, 33944 }, // †
+    { 11, 28, 13, 1, 22, 77, 34028 }, // ‡
+    { 13, 12, 11, -1, 14, 39, 34105 }, // •
+    { 6, 7, 8, 1, 9, 11, 34144 }, // ‣
+    { 4, 4, 5, 1, 4, 4, 34155 }, // ․
+    { 4, 4, 5, 1, 4, 4, 34159 }, // ‥
+    { 18, 4, 20, 1, 4, 18, 34163 }, // …
+    { 3, 3, 5, 1, 8, 3, 34181 }, // ‧
+    { 0, 0, 26, 0, 0, 0, 34184 }, //  
+    { 13, 18, 23, 5, 16, 59, 34184 }, // ‰
+    { 5, 6, 7, 1, 18, 8, 34243 }, // ′
+    { 10, 6, 12, 1, 18, 15, 34251 }, // ″
+    { 16, 7, 18, 1, 18, 28, 34266 }, // ‴
+    { 5, 6, 7, 1, 17, 8, 34294 }, // ‵
+    { 10, 6, 11, 0, 17, 15, 34302 }, // ‶
+    { 16, 7, 18, 1, 18, 28, 34317 }, // ‷
+    { 9, 4, 12, 1, 17, 9, 34345 }, // ‸
+    { 7, 10, 9, 1, 11, 18, 34354 }, // ‹
+    { 7, 10, 9, 1, 11, 18, 34372 }, // ›
+    { 22, 21, 28, 4, 19, 116, 34390 }, // ※
+    { 6, 21, 7, 0, 21, 32, 34506 }, // ‼
+    { 11, 26, 16, 2, 25, 72, 34538 }, // ‽
+    { 10, 3, 11, 1, 17, 8, 34610 }, // ‾
+    { 9, 4, 12, 1, 14, 9, 34618 }, // ‿
+    { 14, 14, 17, 1, 19, 49, 34627 }, // ⁂
+    { 13, 17, 23, 5, 16, 56, 34676 }, // ⁄
+    { 23, 24, 26, 2, 24, 138, 34816 }, // ⁇
+    { 16, 23, 21, 2, 23, 92, 34954 }, // ⁈
+    { 17, 25, 17, 0, 23, 107, 35046 }, // ⁉
+    { 12, 33, 15, 2, 23, 99, 35153 }, // ⁒
+    { 0, 0, 100, 0, 0, 0, 35252 }, //  
+    { 6, 8, 7, 0, 17, 12, 35252 }, // ⁰
+    { 6, 9, 7, 0, 18, 14, 35264 }, // ⁴
+    { 6, 9, 7, 0, 18, 14, 35278 }, // ⁵
+    { 6, 8, 7, 0, 17, 12, 35292 }, // ⁶
+    { 7, 9, 7, 0, 18, 16, 35304 }, // ⁷
+    { 7, 8, 7, 0, 17, 14, 35320 }, // ⁸
+    { 7, 8, 7, 0, 17, 14, 35334 }, // ⁹
+    { 11, 12, 17, 3, 12, 33, 35348 }, // ⁿ
+    { 8, 11, 9, 1, 11, 22, 35381 }, // ₀
+    { 6, 9, 6, 0, 5, 14, 35403 }, // ₁
+    { 6, 9, 7, 0, 5, 14, 35417 }, // ₂
+    { 6, 9, 7, 0, 5, 14, 35431 }, // ₃
+    { 7, 8, 7, 0, 5, 14, 35445 }, // ₄
+    { 6, 8, 6, 0, 5, 12, 35459 }, // ₅
+    { 7, 8, 7, 0, 4, 14, 35471 }, // ₆
+    { 6, 9, 7, 0, 5, 14, 35485 }, // ₇
+    { 7, 9, 7, 0, 5, 16, 35499 }, // ₈
+    { 7, 9, 7, 0, 5, 16, 35515 }, // ₉
+    { 7, 28, 9, 2, 21, 49, 35531 }, // ₍
+    { 7, 28, 9, 0, 21, 49, 35580 }, // ₎
+    { 15, 28, 21, 3, 23, 105, 35629 }, // ₡
+    { 14, 20, 21, 3, 19, 70, 35734 }, // ₢
+    { 14, 20, 14, 0, 20, 70, 35804 }, // ₤
+    { 20, 18, 22, 2, 18, 90, 35874 }, // ₦
+    { 16, 18, 19, 1, 18, 72, 35964 }, // ₧
+    { 21, 18, 24, 3, 18, 95, 36036 }, // ₨
+    { 16, 18, 18, 1, 18, 72, 36131 }, // ₩
+    { 16, 16, 22, 3, 16, 64, 36203 }, // ₪
+    { 14, 17, 14, 1, 17, 60, 36267 }, // ₫
+    { 13, 19, 16, 1, 16, 62, 36327 }, // €
+    { 16, 18, 22, 3, 18, 72, 36389 }, // ₮
+    { 18, 18, 13, 0, 18, 81, 36461 }, // ₱
+    { 17, 25, 24, 3, 22, 107, 36542 }, // ₲
+    { 19, 19, 19, 1, 18, 91, 36649 }, // ₴
+    { 10, 16, 16, 3, 15, 40, 36740 }, // ₵
+    { 16, 19, 22, 3, 19, 76, 36780 }, // ₸
+    { 10, 17, 13, 1, 16, 43, 36864 }, // ₹
+    { 12, 15, 14, 1, 14, 45, 36907 }, // ₺
+    { 13, 16, 13, 0, 16, 52, 36952 }, // ₼
+    { 17, 18, 19, -1, 18, 77, 37004 }, // ₽
+    { 14, 13, 16, 1, 12, 46, 37081 }, // ←
+    { 14, 13, 16, 1, 13, 46, 37127 }, // ↑
+    { 14, 13, 16, 1, 12, 46, 37173 }, // →
+    { 14, 13, 16, 1, 13, 46, 37219 }, // ↓
+    { 16, 11, 19, 1, 11, 44, 37265 }, // ↔
+    { 12, 16, 14, 1, 17, 48, 37309 }, // ↕
+    { 11, 10, 13, 1, 10, 28, 37357 }, // ↖
+    { 11, 10, 13, 1, 10, 28, 37385 }, // ↗
+    { 11, 11, 13, 1, 11, 31, 37413 }, // ↘
+    { 11, 11, 13, 1, 11, 31, 37444 }, // ↙
+    { 16, 13, 18, 1, 12, 52, 37475 }, // ⇐
+    { 17, 15, 19, 1, 15, 64, 37527 }, // ⇑
+    { 16, 13, 18, 1, 12, 52, 37591 }, // ⇒
+    { 17, 16, 19, 1, 15, 68, 37643 }, // ⇓
+    { 18, 13, 20, 1, 12, 59, 37711 }, // ⇔
+    { 14, 17, 16, 1, 11, 60, 37770 }, // ⇕
+    { 12, 17, 14, 1, 17, 51, 37830 }, // ∂
+    { 21, 20, 24, 2, 19, 105, 37881 }, // ∅
+    { 16, 16, 18, 1, 16, 64, 37986 }, // ∆
+    { 13, 15, 15, 1, 15, 49, 38050 }, // ∏
+    { 13, 15, 15, 1, 15, 49, 38099 }, // ∐
+    { 10, 16, 12, 1, 15, 40, 38148 }, // ∑
+    { 10, 3, 13, 1, 7, 8, 38188 }, // −
+    { 17, 18, 19, 1, 17, 77, 38196 }, // √
+    { 17, 11, 19, 1, 13, 47, 38273 }, // ∞
+    { 18, 24, 18, 0, 19, 108, 38320 }, // ∫
+    { 5, 13, 6, 0, 13, 17, 38428 }, // ∶
+    { 12, 11, 16, 2, 12, 33, 38445 }, // ≈
+    { 14, 18, 23, 5, 16, 63, 38478 }, // ≠
+    { 16, 16, 18, 1, 15, 64, 38541 }, // ≤
+    { 16, 16, 18, 1, 15, 64, 38605 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
@@ -3185,4 +2317,9 @@ static const EpdFontData opendyslexic_10_regular = {
     28,
     -11,
     true,
+    opendyslexic_10_regularBlockOffsets,
+    opendyslexic_10_regularDirectGlyphs,
+    opendyslexic_10_regularGlyphPages,
+    35,
+    opendyslexic_10_regularPageGlyphs,
 };
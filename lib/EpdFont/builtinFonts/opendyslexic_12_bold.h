@@ -2,3888 +2,2143 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_bold
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_boldBitmaps[61993] = {
-    0x00, 0x00, 0x02, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF0,
-    0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xF4, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0xBF, 0xFC,
-    0x7F, 0xF8, 0x3F, 0xFC, 0x7F, 0xF4, 0x3F, 0xF8, 0x7F, 0xF0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x7F, 0xE0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F, 0xF0, 0x7F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0,
-    0x6A, 0x90, 0x2A, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x05, 0x56, 0xFF, 0x57, 0xFE, 0x55, 0x50, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x15, 0x5F, 0xFD, 0x5F, 0xF9,
-    0x55, 0x40, 0x00, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0A,
-    0xA4, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xBF, 0x58, 0x00, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0xBF, 0xC3, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0F, 0xEF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0xBF, 0xF4, 0x07, 0x40, 0xFC, 0x0F, 0xFD, 0x03, 0xFF,
-    0xBF, 0x0B, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xE0, 0x03, 0xE0,
-    0xB8, 0x01, 0xFC, 0x00, 0x3C, 0x07, 0xC0, 0x3F, 0x40, 0x03, 0xC0, 0x3C, 0x0B, 0xF0, 0x00, 0x3D,
-    0x0B, 0xC1, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x1F, 0xFF, 0x07, 0xF0, 0x00, 0x00,
-    0x2F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0x2E, 0x0B, 0xC0, 0x00, 0x2F, 0xD3, 0xC0, 0x3C, 0x00, 0x03, 0xF8, 0x3C, 0x03,
-    0xC0, 0x00, 0xFF, 0x03, 0xE0, 0xBC, 0x00, 0x1F, 0xE0, 0x2F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x3F,
-    0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x94, 0x1F, 0xF2, 0xFD, 0x07, 0xF4, 0xBF, 0x41, 0xFD, 0x2F, 0xC3, 0xFC,
-    0x01, 0xFE, 0xFF, 0x0F, 0xF8, 0x01, 0xFF, 0xF4, 0x3F, 0xFE, 0x57, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0xB0, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x6A, 0xA6, 0xFF, 0xCB, 0xFF, 0x2F, 0xF8, 0xBF, 0xD2, 0xFF, 0x4B, 0xFD, 0x2F, 0xF4, 0xFF, 0xE0,
-    0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xF4,
-    0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE,
-    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0B,
-    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE,
-    0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x60, 0xFC, 0x1F, 0x03, 0xF6, 0xF6,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xEF, 0xAF, 0xC0, 0x78, 0xBE, 0x0D, 0x00, 0x42, 0xF8, 0x00, 0x00,
-    0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0xBF, 0xE0, 0x6A, 0x80, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x42, 0xFD, 0x3F, 0xE3, 0xFE, 0x3F, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x03, 0xF8, 0x1F, 0xD0, 0x2F, 0xC0, 0x2F, 0xC0, 0xFE, 0x00, 0x3F, 0x47, 0xF4, 0xB0, 0xFE, 0x2F,
-    0xCB, 0xF3, 0xFC, 0xFF, 0x2F, 0xCB, 0xF3, 0xFC, 0xFF, 0x2F, 0xCF, 0xF2, 0xFC, 0xFF, 0x3F, 0xC7,
-    0xE3, 0xFC, 0xFF, 0x46, 0x0F, 0xF2, 0xFF, 0x00, 0xBF, 0xCB, 0xFE, 0x07, 0xFE, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
-    0x3D, 0xFF, 0x00, 0x20, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x15, 0x00,
-    0x01, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x7E, 0x40, 0xBF, 0x86, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFE, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x03, 0x90, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0x01,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x15, 0x6F, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x01, 0xFE, 0x1E, 0x40, 0x7F, 0xE2, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFE, 0xFC, 0x00,
-    0x0F, 0xDB, 0xF0, 0x00, 0xBE, 0x2F, 0xC0, 0x07, 0xF0, 0xFF, 0x00, 0x3F, 0x43, 0xFC, 0x02, 0xF8,
-    0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD5, 0x56, 0xAF,
-    0xFE, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x06, 0x95, 0x5F, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x10, 0x00, 0x3F, 0xD3, 0xE4, 0x1F, 0xFD, 0x3F, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x05,
-    0xA5, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xCB, 0xF9, 0x00, 0xBF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0x9B, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0xFF, 0x80, 0x0F, 0xF3, 0xFD,
-    0x00, 0x3F, 0xCB, 0xF8, 0x00, 0xFF, 0x1F, 0xF4, 0x0B, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xE0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F,
-    0xE0, 0x03, 0xF4, 0x0F, 0xE0, 0x03, 0xF8, 0x0F, 0xF0, 0x07, 0xF4, 0x0B, 0xFE, 0x6F, 0xF0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x2F,
-    0xE0, 0x03, 0xFC, 0x3F, 0xD0, 0x02, 0xFD, 0x3F, 0xD0, 0x03, 0xFD, 0x3F, 0xF9, 0x5F, 0xFD, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFA, 0x00, 0x00,
-    0x6F, 0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x1F, 0xF0, 0x7E, 0x00,
-    0x1F, 0xC2, 0xF0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBE, 0x3F, 0x00, 0x02, 0xFC, 0xBC, 0x00, 0x0F,
-    0xF2, 0xFC, 0x00, 0xBF, 0xC3, 0xFF, 0xBF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x05, 0x00, 0x0B, 0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x7F, 0xF2, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x1F, 0xFC, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xF4,
-    0x0F, 0xFC, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA8, 0x03, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xFF, 0xFD,
-    0x6F, 0xFF, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xF9, 0x5F, 0xF4, 0x0F, 0x80, 0x03, 0xFC,
-    0x01, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x2E, 0xF0, 0x0F, 0x00, 0x3F, 0x03, 0xEF,
-    0xC0, 0x2D, 0x01, 0xF8, 0x1D, 0x0F, 0x40, 0xB8, 0x0B, 0xE0, 0xB0, 0x2D, 0x02, 0xE0, 0x3F, 0x43,
-    0x80, 0x74, 0x0B, 0x80, 0xFE, 0x0E, 0x01, 0xE0, 0x3D, 0x03, 0xF8, 0x2E, 0xAF, 0x82, 0xF0, 0x0F,
-    0xF0, 0x7F, 0xFF, 0x2F, 0x80, 0x3F, 0xD0, 0x7F, 0x7F, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0x03, 0xFF, 0xF9, 0x6F,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00,
-    0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00,
-    0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD,
-    0x05, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x01, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x03,
-    0xFC, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFE, 0xAA, 0xFF, 0xF0, 0xFF, 0x00, 0x07, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x8F, 0xF0, 0x00,
-    0x3F, 0xF3, 0xFE, 0x55, 0xBF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1B, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x85, 0x6F, 0xFF, 0xC3, 0xFE, 0x00, 0x07, 0xFF,
-    0x4F, 0xF8, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xF3, 0xFE,
-    0x00, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00,
-    0x0F, 0xF3, 0xFE, 0x00, 0x00, 0xFF, 0xCF, 0xF8, 0x01, 0x6F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xAA, 0x54, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x07, 0xFD, 0x55,
-    0x40, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x90, 0x15, 0xA0, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40, 0x03, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xEB, 0xFF, 0x00,
-    0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x94, 0x5B, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00,
-    0xFF, 0x47, 0xFC, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xE2,
-    0xFF, 0x00, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0xBF, 0xC0,
-    0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x00, 0xFF, 0x8B, 0xFD, 0x00, 0x07, 0xFF, 0x2F, 0xF9, 0x55, 0x6F,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x02, 0xFF, 0xCF, 0xFE, 0x00,
-    0x0B, 0xFF, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0xFF, 0x8B, 0xF8, 0xBF,
-    0x8B, 0xF8, 0xBF, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7,
-    0xFC, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xFF, 0xDF, 0xFD, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x3E, 0x47, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0x00,
-    0x03, 0xFC, 0x2F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0x80, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x01, 0xFE,
-    0x7F, 0xE0, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF,
-    0xFF, 0xC0, 0x02, 0xFF, 0x1F, 0xFF, 0xD0, 0x0B, 0xFC, 0x1F, 0xFF, 0xD0, 0x3F, 0xF0, 0x2F, 0xFF,
-    0xE0, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
-    0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x7F, 0xFF, 0x00, 0x2F, 0xFF,
-    0x47, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x47, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xD0, 0xFF, 0xFF, 0x4B, 0xFB, 0xFF, 0x2F, 0xFF, 0xF8, 0xBF, 0xAF, 0xF7, 0xFE,
-    0xFF, 0x8B, 0xF9, 0xFF, 0xFF, 0xDF, 0xF8, 0xBF, 0xCF, 0xFF, 0xFC, 0xFF, 0x8B, 0xFC, 0xBF, 0xFF,
-    0x8F, 0xF8, 0xBF, 0xC3, 0xFF, 0xF5, 0xFF, 0xCF, 0xFC, 0x3F, 0xFF, 0x1F, 0xFC, 0xFF, 0xC1, 0xFF,
-    0xE1, 0xFF, 0xCF, 0xFC, 0x0F, 0xFD, 0x2F, 0xFC, 0xFF, 0xD0, 0xBF, 0xC2, 0xFF, 0xCF, 0xFD, 0x07,
-    0xFC, 0x3F, 0xFC, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x40,
-    0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF, 0x00, 0x1F, 0xE2,
-    0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F, 0xD3, 0xFC, 0x3F,
-    0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
-    0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF,
-    0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00,
-    0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00,
-    0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x3F,
-    0x8F, 0xF0, 0x01, 0xFF, 0x3F, 0xD5, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x7F,
-    0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x50, 0x1F, 0xF0, 0x0F,
-    0xF8, 0x03, 0xF4, 0xBF, 0xC0, 0x3F, 0xFD, 0x5F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xE0, 0x0F, 0xE0, 0x02, 0xFC, 0x03, 0xF8,
-    0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x2F, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFD, 0x1F, 0xF4,
-    0x0B, 0xFD, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x7F, 0xD0, 0xBF, 0xE0, 0x1F, 0xF8, 0x2F, 0xF8, 0x07,
-    0xFF, 0x0F, 0xFE, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x03,
-    0xE0, 0x00, 0x2F, 0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF,
-    0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0,
-    0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC,
-    0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x7F,
-    0xF0, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xDB, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xF4, 0x00, 0x69, 0x00, 0x2F, 0xF0, 0x2F, 0xF8, 0x00,
-    0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x0F, 0xFD, 0x0B, 0xFF, 0xD0, 0xBF, 0xC0, 0x0B, 0xFE, 0x0F, 0xFF, 0xF0, 0xFF, 0xC0,
-    0x07, 0xFF, 0x3F, 0xFF, 0xF4, 0xFF, 0x80, 0x07, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF4,
-    0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00,
-    0xBF, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xDB, 0xFF, 0x40, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x0B, 0xFF, 0x41, 0xFF, 0xE0,
-    0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0xBF, 0xF8, 0x00, 0x2F, 0xFE, 0xBF,
-    0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00,
-    0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xD0, 0xFE, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00,
-    0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07,
-    0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0x4B, 0xFF,
-    0xF4, 0xBF, 0xFF, 0x45, 0xA5, 0x50, 0x10, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x07, 0x80, 0x00,
-    0x7C, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFD,
-    0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x01, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x0B, 0xFF, 0xF0, 0xBF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC,
-    0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xC2, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xD2, 0xFF, 0xFD, 0x2F, 0xFF, 0xD1, 0x55, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xD1, 0xFD, 0x02,
-    0xF8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x15, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0,
-    0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4,
-    0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0x50, 0x00, 0x2F, 0xAF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFD, 0x0B, 0xF0, 0x1F, 0xF4, 0x02,
-    0xF4, 0x1F, 0xF0, 0x01, 0xF8, 0x1F, 0xF0, 0x00, 0xFC, 0x0F, 0xF0, 0x01, 0xFC, 0x0F, 0xF0, 0x03,
-    0xFC, 0x0F, 0xFD, 0x5F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF4, 0x0F, 0xF5, 0x18, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x1F, 0xFE, 0xB8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xD2, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFA, 0xFF, 0xFC, 0x1F, 0xD0, 0x3F, 0xF8, 0x3F, 0x80, 0x1F, 0xF8, 0x3F, 0x40, 0x0F,
-    0xF8, 0x3F, 0x00, 0x0F, 0xF8, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x0F, 0xF4, 0x3F, 0x80, 0x2F,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC,
-    0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0xBF, 0xFC, 0x03, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD2, 0xBF, 0xEA, 0x00,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xD3, 0xF8, 0x0B, 0xFF, 0xEF, 0xE0, 0xBF, 0xFF, 0xFF, 0x83, 0xF4, 0x7F, 0xFE, 0x2F, 0x40, 0x3F,
-    0xF4, 0xFC, 0x00, 0xBF, 0xD3, 0xE0, 0x01, 0xFF, 0x4F, 0x80, 0x03, 0xFD, 0x3E, 0x00, 0x0F, 0xF4,
-    0xFC, 0x00, 0x7F, 0xD3, 0xF4, 0x07, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xF6, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0x80, 0xF4, 0x07, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF4,
-    0x01, 0xAF, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE7, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xF9, 0x0B, 0xF0, 0x1F, 0xF0, 0x03,
-    0xF4, 0x1F, 0xE0, 0x02, 0xF8, 0x2F, 0xD0, 0x02, 0xF8, 0x2F, 0xD0, 0x02, 0xF8, 0x2F, 0xD0, 0x02,
-    0xF8, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xE0, 0x03, 0xFC, 0x3F, 0xE0, 0x07,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x3F, 0xF0, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0xCB, 0xFD, 0xBF,
-    0xD5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x3F, 0x83,
-    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0x80, 0x02,
-    0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x2F, 0xFE, 0x02, 0xFF, 0xD0, 0x3F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xFD, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x1F, 0xEF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xDF, 0xFE, 0x00, 0x3F, 0xCB, 0xFF,
-    0xC0, 0x3F, 0xC2, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF, 0xFC, 0x0F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x00,
-    0x7F, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-    0xE5, 0x03, 0xFF, 0xE0, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF6, 0xFE, 0x00, 0xBE, 0x00, 0x0B, 0xFF, 0xFF, 0xD7, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x0B, 0xFF, 0x43, 0xFC, 0x0F, 0xF8, 0x03, 0xFE, 0x01, 0xFC, 0x0F, 0xF0, 0x03,
-    0xFD, 0x00, 0xFD, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x1F,
-    0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x2F, 0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFE, 0x3F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x3F, 0xE0, 0x0F, 0xF4, 0x02, 0xFF, 0x3F, 0xD0, 0x0F,
-    0xF4, 0x03, 0xFF, 0x3F, 0xD0, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4,
-    0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1,
-    0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD,
-    0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00,
-    0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x3F, 0x8F,
-    0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3, 0xFE, 0x01, 0xFF, 0x4B, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1B, 0xFD,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0xFD, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0x9B, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0x00, 0xFF, 0xC0, 0x0B, 0xC0, 0x3F, 0xE0, 0x01, 0xF4, 0x0F,
-    0xF8, 0x00, 0x7D, 0x03, 0xFE, 0x00, 0x1F, 0x80, 0xFF, 0xC0, 0x07, 0xD0, 0x3F, 0xF8, 0x07, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xC1, 0xA9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xD0, 0xBF, 0xF4, 0x02, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0x00,
-    0x1F, 0xF4, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x03, 0xE0, 0x00, 0xFF, 0x00,
-    0x3F, 0x00, 0x1F, 0xF0, 0x03, 0xF8, 0x07, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0x9B, 0xE6, 0xD0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFE, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x0F, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xA8, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC,
-    0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03, 0xFD, 0x2F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xE2, 0xFD, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x0B, 0xF4, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0xBF,
-    0x80, 0x00, 0xBF, 0xCF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x0F,
-    0xF4, 0x7F, 0x80, 0x7C, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC1, 0xFE, 0x03, 0xFD, 0x2F, 0xF4, 0xBF,
-    0x40, 0x7F, 0x9F, 0xFF, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xEF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF1, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0xBF,
-    0x87, 0xFC, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x0F, 0xFD, 0x02, 0xFF, 0x82,
-    0xFF, 0x80, 0x0F, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F,
-    0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8,
-    0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x02,
-    0xFE, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xF4,
-    0x00, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x01,
-    0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE2,
-    0xF8, 0xBE, 0x2F, 0x8B, 0xD2, 0xF4, 0xBD, 0x2F, 0x4B, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC2, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x80,
-    0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x01, 0x43, 0xFC, 0x3D, 0x7F, 0xF3, 0xDB, 0xCF, 0xFC, 0xBC, 0x7F, 0xC6,
-    0x81, 0xA0, 0x7F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x2F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x07, 0xF4, 0x07, 0xF4,
-    0x07, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x02, 0xE0, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xD8, 0x0B,
-    0xF1, 0xE0, 0x03, 0xFC, 0x78, 0x00, 0xFE, 0x1E, 0x00, 0x3F, 0x87, 0x80, 0x0F, 0xF2, 0xE0, 0x03,
-    0xFC, 0xB8, 0x00, 0xFF, 0xAE, 0x00, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF4,
-    0x01, 0xBF, 0xE4, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xAA, 0xFF, 0xAA, 0x40, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x40,
-    0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xAA, 0xAA, 0xAA, 0xA8, 0x01, 0x00, 0x02, 0x00,
-    0x2D, 0x00, 0x3E, 0x02, 0xFE, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xD2, 0xFE, 0x00, 0xFE, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xF4, 0x7F, 0xC0, 0x3F, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF0, 0x7C, 0x04, 0x1F,
-    0x00, 0x40, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0xBF,
-    0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0x50, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x2F,
-    0x2F, 0x2F, 0x2F, 0x3F, 0x3E, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x24, 0x00, 0x06, 0xA4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
-    0x40, 0xBC, 0x02, 0xF0, 0x03, 0x40, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0x85, 0xFE, 0x0B, 0xD0, 0x0B, 0xE0, 0xBF, 0x95, 0xFE, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xD0,
-    0x10, 0x00, 0xFE, 0x07, 0xE0, 0x0F, 0xE0, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x40, 0xAF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x55, 0x0B, 0xF4, 0x3F, 0xC3, 0xFE, 0x0F, 0xF4, 0xFF,
-    0x83, 0xFD, 0x3F, 0xF1, 0xFF, 0x9F, 0xFC, 0xBF, 0xE0, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xF0, 0x0F,
-    0xD1, 0xFC, 0x2F, 0x3E, 0x3D, 0x3D, 0xE0, 0x2E, 0x3C, 0xD0, 0x1E, 0x3D, 0xE0, 0x2E, 0x2F, 0x7F,
-    0x3D, 0x0F, 0xD1, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFB, 0x41, 0xEB,
-    0xD0, 0xF0, 0xB8, 0x34, 0x0E, 0x0D, 0x03, 0x83, 0x96, 0xF0, 0xBF, 0xFC, 0x0B, 0xEB, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x0C, 0x00, 0x3E, 0x07, 0xC0, 0x0F, 0xD1, 0xFC, 0x07, 0xFC, 0xBF,
-    0x41, 0xFE, 0x3F, 0xD0, 0x7F, 0x4B, 0xF0, 0x0B, 0xF4, 0xFF, 0x00, 0x7F, 0xEB, 0xFC, 0x01, 0xFF,
-    0xAF, 0xF0, 0x03, 0xFC, 0xBF, 0xC0, 0x0F, 0xC2, 0xF8, 0x00, 0x3C, 0x0B, 0x40, 0x00, 0x40, 0x10,
-    0x55, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x9B, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x7F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xBC, 0x2E, 0x93, 0x3D, 0x3D, 0xA3, 0x1E, 0x3C, 0xBF, 0x2E, 0x2E, 0xB3, 0x7E,
-    0x1F, 0xF3, 0xFC, 0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFC, 0x2F, 0xD1, 0xFD, 0x3F, 0x80, 0xBE, 0x3F, 0xC0, 0xFE, 0x2F, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x1A, 0xAF, 0xFA, 0xA0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3E, 0xF4, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0, 0x0F, 0xD0,
-    0x2F, 0xFC, 0x3F, 0xFC, 0x01, 0x40, 0x1F, 0xF4, 0x10, 0x2C, 0x00, 0x1C, 0x02, 0xBC, 0x0B, 0xF8,
-    0x00, 0x3C, 0x19, 0x7D, 0x2F, 0xFC, 0x2F, 0xF4, 0x03, 0xF0, 0x1F, 0x80, 0xFD, 0x03, 0xF0, 0x2F,
-    0x80, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xC0, 0x02, 0xFC, 0x2F, 0xC0, 0x02, 0xFC, 0x2F,
-    0xD0, 0x02, 0xFC, 0x2F, 0xD0, 0x02, 0xFC, 0x3F, 0xD0, 0x02, 0xFC, 0x3F, 0xE0, 0x03, 0xFD, 0x3F,
-    0xE0, 0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xFD, 0x0F, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0x2F, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x4F, 0xD0, 0xFF, 0xF4, 0xFD, 0x2F, 0xFF, 0x4F, 0xD3, 0xFF, 0xF0, 0xFD, 0x7F, 0xFF, 0x0F,
-    0xD7, 0xFF, 0xF0, 0xFD, 0x3F, 0xFF, 0x0F, 0xD2, 0xFF, 0xF0, 0xFD, 0x0F, 0xFF, 0x0F, 0xD0, 0x2F,
-    0xF0, 0xFD, 0x03, 0xFE, 0x0B, 0xE0, 0x3F, 0xE0, 0xBE, 0x03, 0xFE, 0x0B, 0xE0, 0x7F, 0xD0, 0xBE,
-    0x0B, 0xFD, 0x0B, 0xE0, 0xFF, 0xD0, 0xBE, 0x0F, 0xFD, 0x0B, 0xE0, 0xFF, 0xC0, 0xBE, 0x1F, 0xFC,
-    0x0B, 0xE2, 0xFF, 0xC0, 0xBE, 0x3F, 0xFC, 0x0B, 0xE1, 0x55, 0x40, 0x15, 0x2F, 0xD3, 0xFD, 0x3F,
-    0xE3, 0xFE, 0x7F, 0xF1, 0x55, 0x2E, 0x00, 0xF4, 0x03, 0xF8, 0x2F, 0xF8, 0x52, 0xF1, 0xFF, 0x8B,
-    0xFC, 0x1A, 0x40, 0x0B, 0x80, 0x7E, 0x01, 0x78, 0x00, 0xE0, 0x03, 0x80, 0x1E, 0x00, 0x78, 0x0F,
-    0xFE, 0x3F, 0xF8, 0x07, 0xF4, 0x07, 0xEF, 0x43, 0xC0, 0xF0, 0xF0, 0x3C, 0x3C, 0x0F, 0x0F, 0xEF,
-    0xC1, 0xFF, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x00, 0xA0, 0x00, 0x3D, 0x0B, 0x80, 0x03,
-    0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0xCB, 0xF4, 0x00, 0xFE, 0x2F, 0xD0, 0x0F, 0xF2,
-    0xFE, 0x03, 0xFE, 0xBF, 0xD1, 0xFF, 0xAF, 0xF0, 0x3F, 0xE7, 0xFC, 0x02, 0xF8, 0x3F, 0x00, 0x1D,
-    0x03, 0xC0, 0x00, 0x40, 0x20, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x09, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x7D, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xF0, 0x04, 0x0B,
-    0xFF, 0xF0, 0x3F, 0x80, 0xF4, 0x3F, 0xFF, 0xC2, 0xFC, 0x0F, 0xD0, 0xBF, 0xFF, 0x0F, 0xD0, 0xBF,
-    0x40, 0x00, 0x00, 0xFF, 0x07, 0xBD, 0x00, 0x00, 0x07, 0xF4, 0x3C, 0xF4, 0x00, 0x00, 0x3F, 0x83,
-    0xD3, 0xE0, 0x00, 0x02, 0xFC, 0x2E, 0x1F, 0x90, 0x00, 0x1F, 0xE1, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x03,
-    0xFD, 0x00, 0x00, 0x7F, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x9F, 0x40,
-    0x00, 0x0B, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x3F, 0x87, 0xFF, 0x83,
-    0xFF, 0xFC, 0x2F, 0xC3, 0xFF, 0xF8, 0xBF, 0xFF, 0x1F, 0xD0, 0xE4, 0x2F, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x3F,
-    0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x01, 0x54, 0x01, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0xBE, 0x00, 0x00, 0x0B, 0x80, 0x07, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xF4,
-    0x02, 0xFC, 0x00, 0x00, 0x1B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xFE, 0x00, 0x00, 0xE5,
-    0xBF, 0x07, 0xF0, 0x18, 0x03, 0xFF, 0xFC, 0x3F, 0x81, 0xF4, 0x2F, 0xFF, 0xE2, 0xFC, 0x0F, 0xD0,
-    0x6F, 0xFD, 0x1F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x0B, 0xBD, 0x00, 0x00, 0x07, 0xF4, 0x7C,
-    0xF8, 0x00, 0x00, 0x3F, 0x83, 0xC3, 0xE0, 0x00, 0x02, 0xFC, 0x3F, 0x5F, 0xE0, 0x00, 0x1F, 0xE1,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x10, 0x1F, 0xD0, 0x00, 0xF4, 0x0F, 0xF4, 0x0B, 0xFC, 0x07, 0xFF, 0xFF, 0xF8,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0,
-    0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x2E, 0x00, 0x00,
-    0x00, 0x3C, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x05, 0x50, 0x15, 0x40, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x8F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B,
-    0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF,
-    0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA,
-    0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC,
-    0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x55, 0x2A, 0xAB, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x4F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xF8, 0x07, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0x90, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x10, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAB,
-    0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0xFF, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA,
-    0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x05, 0x50,
-    0x15, 0x40, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x47, 0xFC, 0x03, 0xFD, 0x1F, 0xF0, 0x1F, 0xF8, 0xBF,
-    0xD0, 0xBF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B,
-    0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
-    0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x07, 0xD0, 0xFC, 0x1F, 0x83, 0xF4, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0x8B, 0xF8, 0xBF, 0x8B,
-    0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC,
-    0xBF, 0xCB, 0xFC, 0xBF, 0xCF, 0xFD, 0xFF, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFE, 0x0B, 0xF0, 0x3F, 0x40,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x15, 0x40, 0x55, 0x0B, 0xF4, 0x3F, 0xC3,
-    0xFD, 0x0F, 0xF4, 0xFF, 0x87, 0xFD, 0x7F, 0xE1, 0xFF, 0x9F, 0xFC, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xE1, 0x5A, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xE0, 0x05, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x07, 0xE0, 0xF0, 0x00, 0x00, 0xFF, 0x8F, 0x40, 0x00, 0x1F, 0xBE, 0xF0, 0x00, 0x02, 0xF2, 0xFF,
-    0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x40, 0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F,
-    0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF, 0x00, 0x1F, 0xE2, 0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF,
-    0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD, 0x3F, 0xFF, 0xF0, 0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD,
-    0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F, 0xD3, 0xFC, 0x3F, 0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F,
-    0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7, 0xFF, 0x07, 0xFF, 0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB,
-    0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03,
-    0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x6F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xBF,
-    0xE0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x3F,
-    0xF2, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xCF, 0xF4, 0x00, 0x00, 0x0F, 0xF7, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xCB, 0xFE, 0x00, 0x00, 0x7F, 0xF2, 0xFF, 0xF9, 0x45, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFE, 0x6F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xCF, 0xF4, 0x00, 0x00, 0x0F, 0xF7, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xCB, 0xFE, 0x00,
-    0x00, 0x7F, 0xF2, 0xFF, 0xF9, 0x45, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF,
-    0xF0, 0x03, 0xFF, 0x40, 0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F,
-    0xF4, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F,
-    0xF3, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-    0xDF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF,
-    0x2F, 0xFF, 0x94, 0x5F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x50, 0x00,
-    0x00, 0x02, 0xFD, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0x80, 0x00, 0x00, 0x7C, 0xFF, 0xD0, 0x00,
-    0x00, 0x1F, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x0B,
-    0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xFD,
-    0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xFC,
-    0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x55, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x07, 0xFC,
-    0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF4,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0B, 0xFE, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00,
-    0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0xFF, 0x94, 0x5F, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xBF, 0xE0, 0x3F,
-    0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE6, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xFA, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF,
-    0xD0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x43, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xDF, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF,
-    0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00,
-    0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF,
-    0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00,
-    0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00,
-    0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F,
-    0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0xF4, 0x7F, 0x40, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0,
-    0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFD,
-    0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00,
-    0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xC7,
-    0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x02, 0xFF, 0x0F,
-    0xF8, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x15, 0x50, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD,
-    0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF,
-    0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0,
-    0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC,
-    0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE,
-    0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x07, 0xFC, 0x03, 0xFF,
-    0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBD,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xF0, 0xBE, 0x0B, 0xFC, 0xBD, 0x01, 0xFD, 0xBD, 0x00, 0xFD, 0xBD, 0x02, 0xFD,
-    0xBD, 0x0B, 0xFC, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0xBF, 0xFE, 0x00, 0xBF, 0x90, 0x00, 0xBD,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x0F, 0xC0, 0xFE, 0x01,
-    0xBF, 0x03, 0xF4, 0x1F, 0xFC, 0x0F, 0xD0, 0xFF, 0x90, 0x3F, 0x87, 0xF0, 0x00, 0xFE, 0x1F, 0x40,
-    0x03, 0xF8, 0x7E, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x7F, 0x82, 0xFF, 0x41, 0xFE, 0x03, 0xFF, 0x47,
-    0xFC, 0x07, 0xFF, 0x1F, 0xF0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFA, 0xFF, 0xE4, 0x1F, 0xEB, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x07, 0xE0, 0x0B, 0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0x3F, 0x83, 0xE0, 0x00, 0xFE, 0x0F, 0x40, 0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00,
-    0x3F, 0xC3, 0xFE, 0xAF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x07, 0xE0, 0x0B,
-    0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0xFE, 0x0F, 0x40, 0x02, 0xFC,
-    0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0xAF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xF0,
-    0xBF, 0x40, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43,
-    0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0,
-    0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0xBD, 0x0F, 0x00, 0x07, 0xFD, 0x3C,
-    0x00, 0x2F, 0xFE, 0xF0, 0x00, 0xF8, 0xFF, 0x80, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0xFD,
-    0x07, 0xFC, 0x07, 0xE0, 0x0B, 0xF4, 0x3F, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x83, 0xE0, 0x00,
-    0xFE, 0x0F, 0x40, 0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0xAF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x00,
-    0x01, 0x50, 0x15, 0x40, 0x2F, 0xD0, 0xFF, 0x40, 0xFF, 0x83, 0xFD, 0x03, 0xFE, 0x0F, 0xF8, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F,
-    0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0,
-    0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E,
-    0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00,
-    0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0xAF, 0x90, 0x00, 0x3F, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xE0, 0x0F, 0xD0, 0x7F, 0xFE, 0x00, 0xFC, 0x07, 0xE0, 0x0B, 0xFF, 0x05,
-    0x6F, 0x83, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0x02, 0xFE, 0x95, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xFF, 0xFF, 0x90, 0x1B, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x90, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xF4, 0x0F, 0xF5, 0x18, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFE,
-    0xB8, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xE4, 0x00, 0x0F, 0x80, 0x00, 0x07,
-    0xFE, 0x00, 0x01, 0x9F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x06, 0x90, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0,
-    0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x15, 0x7F, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFA, 0x54, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xF5,
-    0x06, 0xD0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xAF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFA, 0xFF, 0x00, 0xFE, 0x00, 0xBD, 0x07, 0xF4, 0x55, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xE9, 0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xD4, 0x1B, 0x43, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0xC0, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFD, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8,
-    0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x01,
-    0x50, 0x05, 0x40, 0x1F, 0xE0, 0xBF, 0x40, 0xBF, 0x83, 0xFE, 0x03, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x55, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0B,
-    0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0,
-    0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3E, 0x0B, 0xD0, 0xFC, 0x2F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xFC,
-    0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFD, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xF4, 0xBF, 0x41, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0x82, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC,
-    0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xF1, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xF4, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0x40, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xFA,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xC0, 0x00, 0xFF, 0x4F, 0x00, 0x0B,
-    0xEF, 0xBC, 0x00, 0x2E, 0x3F, 0xF0, 0x00, 0xBC, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4, 0x00, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0x0B,
-    0xF0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0x8F, 0xF4,
-    0x02, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xF8, 0x03,
-    0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0x42, 0xFE, 0x0B, 0xF4, 0x03, 0xFC, 0x3F, 0xC0,
-    0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0xC0, 0x07,
-    0xF4, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0x42, 0xFE,
-    0x0B, 0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0x8F,
-    0xE0, 0x00, 0xFE, 0x3F, 0xC0, 0x07, 0xF4, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0x40, 0x0F, 0xF0, 0xBF, 0x40, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF,
-    0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00,
-    0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x14, 0x05, 0x00,
-    0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xF8, 0xF0, 0x00, 0xB9, 0xFF, 0xC0, 0x03, 0xE2, 0xFE, 0x00, 0x06,
-    0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3,
-    0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFD, 0x00, 0x01, 0x50, 0x15, 0x40, 0x2F, 0xD0, 0xBF, 0x40, 0xBF, 0x83,
-    0xFD, 0x03, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC, 0x7F, 0xE0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0,
-    0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0xDF, 0xFF, 0x80, 0x2F, 0xD3, 0xFF, 0xF0, 0x0F,
-    0xF1, 0xFE, 0xFD, 0x03, 0xF8, 0xFF, 0x3F, 0x80, 0xFE, 0x3F, 0x8F, 0xE0, 0x3F, 0x9F, 0xD3, 0xF8,
-    0x0F, 0xFB, 0xF1, 0xFD, 0x03, 0xFF, 0xFD, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0,
-    0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03,
-    0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0,
-    0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD,
-    0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4B, 0xE0, 0x03, 0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0xBF, 0x00,
-    0x3F, 0xD1, 0xFF, 0x43, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFD, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00,
-    0xBF, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF,
-    0x0F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47,
-    0xFD, 0x0F, 0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF4, 0x2F, 0xD0, 0x2F, 0xE0, 0xFF, 0x40, 0xFF, 0xC3,
-    0xFE, 0x03, 0xFF, 0x0F, 0xF8, 0x0F, 0xFC, 0x7F, 0xF0, 0x15, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F,
-    0xC0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0,
-    0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x1F, 0xE0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F,
-    0x40, 0x7F, 0xC0, 0x2F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x01, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xE2,
-    0xFC, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x15, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xC0, 0xBF, 0xBF, 0xF0, 0xBF, 0x0B, 0xF8, 0xBF, 0x02, 0xFD, 0xBF, 0x00, 0xFE, 0xBF, 0x00,
-    0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xFD, 0x7F, 0x02, 0xFC, 0x7F, 0x0B, 0xF8, 0x7F, 0x7F, 0xF0,
-    0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x7F, 0xE4, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00,
-    0x7F, 0xC1, 0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x0B, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFC,
-    0x00, 0x55, 0x41, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF,
-    0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x55, 0x6A, 0x80, 0x3F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xEA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD,
-    0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F,
-    0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4,
-    0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x3F, 0x40, 0xBF, 0xEF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0, 0x7E, 0x00, 0xBF, 0x43,
-    0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC3, 0xD0,
-    0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0,
-    0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x7F, 0xC0, 0x07, 0xE0, 0x0B, 0xF4, 0x03, 0xF0, 0x00, 0xFD,
-    0x00, 0xFC, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0, 0x00,
-    0xBF, 0x00, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xEA, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0x93, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFD, 0x03, 0xFD, 0x46, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0xAE, 0x00,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xD3, 0xFC,
-    0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x3F, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x01, 0x6C, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFE, 0x0B, 0xF0, 0x3F,
-    0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xD0, 0x0F, 0xF5, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x1F, 0xFE, 0xB8, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x40, 0xFF, 0x51, 0x80, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xEB, 0x80, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFE, 0x40, 0x00, 0x54, 0x00, 0x05, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0xD3, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x2A, 0x00, 0x06, 0x91, 0xFD, 0x03, 0xF8, 0x07, 0xFE,
-    0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xD0, 0x0F, 0xF5, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xB8,
-    0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x0A, 0x80, 0x02, 0xA4, 0x00,
-    0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x56,
-    0xFF, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xF4, 0xFF, 0x80, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x0B, 0xF3, 0xFE,
-    0x00, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x16,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0xFE, 0x00, 0x2F, 0xD2,
-    0xFC, 0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0xA9, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0xFC,
-    0x00, 0x1F, 0xD0, 0x3F, 0xF8, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0xF8, 0x00,
-    0x3F, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F,
-    0x80, 0x2F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xE1, 0x5A, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0,
-    0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x05, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x57, 0xFD, 0x54, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x3F,
-    0xF8, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xF8,
-    0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x05, 0x5A, 0xAF, 0x80, 0x7F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xAA, 0xA9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xEA, 0x91, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFF, 0xAB, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F,
-    0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0xFF, 0xEF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x40,
-    0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC,
-    0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF,
-    0x90, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF,
-    0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8,
-    0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x2A,
-    0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0xA4, 0x7F, 0x80,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xEA, 0xFD,
-    0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0xBF, 0x47,
-    0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xAB, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFA, 0xA4, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0xBF, 0xEA, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xA4, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x05, 0x00, 0x01, 0x50, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xC7, 0xF8, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x15, 0x7F, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xFF, 0xD3, 0xFA, 0x54, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xF5, 0x06, 0xD0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0xAF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x90, 0x15, 0xA0, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xEB, 0xFF, 0x00, 0x00, 0x7F,
-    0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x94, 0x5B, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFD, 0x1F, 0xE0, 0x07, 0xF0,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD3, 0xF8, 0x02, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xD1,
-    0xFF, 0xF8, 0x2F, 0x40, 0x3F, 0xF4, 0x3F, 0x00, 0x2F, 0xF4, 0x3E, 0x00, 0x1F, 0xF4, 0x3E, 0x00,
-    0x0F, 0xF4, 0x3E, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x1F, 0xF4, 0x3F, 0x40, 0x7F, 0xF0, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0x40, 0x7F, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x40,
-    0x56, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xA5,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xAF, 0xFC, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0xFF, 0xFE, 0x51, 0x6F,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x0B, 0xD0, 0x1F, 0xFA, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x3F, 0x80, 0xBF, 0xFE, 0xFE, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x47, 0xFF,
-    0xE2, 0xF4, 0x03, 0xFF, 0x4F, 0xC0, 0x0B, 0xFD, 0x3E, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x3F, 0xD3,
-    0xE0, 0x00, 0xFF, 0x4F, 0xC0, 0x07, 0xFD, 0x3F, 0x40, 0x7F, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x6F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0x40, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x40, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x40, 0x56, 0x80, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xA5, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF3, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xAF, 0xFC, 0x00, 0x01, 0xFF,
-    0xE7, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0xFF, 0xFE, 0x51, 0x6F, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0x80,
-    0xBF, 0xFE, 0xFE, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x47, 0xFF, 0xE2, 0xF4, 0x03, 0xFF, 0x4F, 0xC0,
-    0x0B, 0xFD, 0x3E, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x3F, 0xD3, 0xE0, 0x00, 0xFF, 0x4F, 0xC0, 0x07,
-    0xFD, 0x3F, 0x40, 0x7F, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x0F,
-    0x40, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x40, 0x1A, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x90, 0x15, 0xA0,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40, 0x03,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xEB,
-    0xFF, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0x94, 0x5B, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xFE, 0x02, 0xFF, 0xFB, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0xFD,
-    0x1F, 0xFF, 0x8B, 0xD0, 0x0F, 0xFD, 0x3F, 0x00, 0x2F, 0xF4, 0xF8, 0x00, 0x7F, 0xD3, 0xE0, 0x00,
-    0xFF, 0x4F, 0x80, 0x03, 0xFD, 0x3F, 0x00, 0x1F, 0xF4, 0xFD, 0x01, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x07, 0xFD, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x3D, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x6B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x03,
-    0xFE, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0x8B,
-    0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF4, 0x00, 0x0F, 0xF8, 0xBF, 0xD0, 0x00, 0x7F, 0xF2, 0xFF, 0x95,
-    0x56, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0xFF,
-    0xE0, 0x00, 0xBF, 0xF3, 0xFF, 0x80, 0x02, 0xFF, 0xCF, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x42, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0x80,
-    0x0B, 0xE0, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xF4, 0x00, 0xBE, 0x00, 0x2F, 0xD0, 0x02, 0xF8,
-    0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x3F,
-    0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xEA, 0xAA, 0xBF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0xE5, 0x55, 0xBF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0,
-    0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x0F, 0xFE, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF9,
-    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x90, 0xBF,
-    0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x02, 0xF8, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x02,
-    0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xF4, 0x00, 0xBE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x40,
-    0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x01, 0x40, 0x50, 0x3F, 0x87, 0xC2, 0xFF, 0x9F, 0x0F, 0xAF, 0xFC,
-    0x3E, 0x2F, 0xD0, 0x64, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF,
-    0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x1F, 0x83, 0xC3,
-    0xFE, 0x3D, 0x7E, 0xFB, 0xCB, 0xCB, 0xFC, 0x7C, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x05, 0x6A, 0xBF, 0x81, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xAA, 0xA9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x0B, 0xF8, 0x0B,
-    0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07,
-    0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0F,
-    0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0xF4, 0x2F, 0xF8, 0x06,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x15, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F,
-    0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x0B, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0x7F, 0xFC, 0x3F, 0xFC, 0x0B, 0xFC, 0x00,
-    0x10, 0x05, 0x40, 0x7F, 0x82, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0xBF, 0x82, 0xFE, 0x0B, 0xF8, 0x1F, 0xE0, 0x7F,
-    0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF,
-    0x0B, 0xFC, 0x2F, 0xF0, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x2F,
-    0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xC0,
-    0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xC0, 0x00,
-    0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x7F, 0xF0, 0x00, 0x2F, 0xF0, 0x7F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x0E, 0x40, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x06, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F,
-    0xC3, 0xFC, 0x00, 0x7F, 0x1F, 0xF0, 0x02, 0xFC, 0xBF, 0xD0, 0x0F, 0xF2, 0xFF, 0x40, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xF8,
-    0x00, 0xBF, 0x0B, 0xE0, 0x02, 0xFC, 0x2F, 0x80, 0x0B, 0xE0, 0xBE, 0x00, 0x2F, 0x83, 0xF8, 0x00,
-    0xBE, 0x0F, 0xE0, 0x02, 0xF8, 0x3F, 0x80, 0x0F, 0xD0, 0xFE, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0xFD,
-    0x0F, 0xF0, 0x03, 0xF4, 0x3F, 0xC0, 0x0F, 0xC0, 0xFF, 0x00, 0x3F, 0x03, 0xFC, 0x00, 0xFC, 0x0F,
-    0xF4, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xD1, 0xFE, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xE4, 0x7F, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x01, 0xAF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x7F, 0x40, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0x42, 0xFF, 0x80, 0x03,
-    0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0xBF, 0xD0, 0x00, 0x3F, 0xC7, 0xFE, 0x00, 0x01, 0xFF, 0x3F,
-    0xF0, 0x00, 0x07, 0xF9, 0xFF, 0x80, 0x00, 0x1F, 0xEF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0x3F, 0xFF, 0x00, 0x0B, 0xFC, 0x7F, 0xFF, 0x40, 0x2F, 0xF0, 0x7F, 0xFF, 0x40,
-    0xFF, 0xC0, 0xBF, 0xFF, 0x83, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xFD, 0x00, 0x1F, 0xCF,
-    0xF4, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xDF,
-    0xFE, 0x00, 0x3F, 0xCB, 0xFF, 0xC0, 0x3F, 0xC2, 0xFF, 0xF0, 0x3F, 0xC0, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0A, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x47, 0xE0, 0x0F, 0x4F, 0xC0, 0x1F, 0x2F, 0x80, 0x1F, 0x7F,
-    0x00, 0x2F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x3F, 0xFF, 0x00, 0x3E, 0x7F, 0xC0, 0x7E, 0x2F, 0xF0, 0x7E, 0x0F, 0xFD, 0x03, 0xE0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x2F, 0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x94, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x0F, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xAA,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x50, 0x0F, 0xFF, 0x80, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0xFF, 0xE0,
-    0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0x7F, 0x03, 0xFC, 0x02, 0xFC, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x7F, 0xC0, 0x3F, 0xC1, 0xFF, 0x00, 0xFE, 0x07, 0xFC, 0x02, 0xA4, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xEF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x0F, 0xD0, 0xFE,
-    0x0F, 0xD0, 0xFD, 0x1F, 0xC1, 0xFD, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x94, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x3F, 0xC0, 0x3F, 0xD0, 0xFF,
-    0x00, 0xFF, 0x83, 0xFC, 0x03, 0xFE, 0x0F, 0xF0, 0x1F, 0xFC, 0x7F, 0xC0, 0x15, 0x51, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC1, 0x54, 0x2F, 0xC3, 0xFC, 0x2F, 0xC3, 0xFD,
-    0x2F, 0xC3, 0xFD, 0x2F, 0xC7, 0xFE, 0x3F, 0xCB, 0xFE, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x94,
-    0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xF3, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x7E, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x4F, 0xE0, 0x00,
-    0x06, 0x90, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x01, 0xFE, 0x1F, 0xFD,
-    0x00, 0x1F, 0xE2, 0xFF, 0xF0, 0x01, 0xFE, 0x2F, 0xFF, 0x40, 0x2F, 0xE2, 0xFF, 0xFC, 0x02, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x2F, 0xD3, 0xFF, 0xFF, 0x03, 0xFD, 0x3F, 0xFF, 0xF4, 0x3F, 0xD3, 0xFF, 0x7F,
-    0xC3, 0xFD, 0x3F, 0xF3, 0xFD, 0x3F, 0xC3, 0xFF, 0x2F, 0xE3, 0xFC, 0x7F, 0xF0, 0xFF, 0x7F, 0xC7,
-    0xFF, 0x0B, 0xFF, 0xFC, 0x7F, 0xF0, 0x7F, 0xFF, 0xCB, 0xFF, 0x03, 0xFF, 0xFC, 0xBF, 0xF0, 0x1F,
-    0xFF, 0xCB, 0xFF, 0x00, 0xFF, 0xFC, 0xFF, 0xF0, 0x0B, 0xFF, 0xCF, 0xFF, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x90, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xE4, 0x7F, 0xC1, 0xFE, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0xFC, 0x2F, 0xC0, 0x03, 0xF4, 0xBF,
-    0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x7F, 0x8F, 0xF4, 0x01, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x40,
-    0x2F, 0xE3, 0xFE, 0x00, 0xBF, 0xCF, 0xF8, 0x03, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF1, 0xFF, 0x40, 0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F,
-    0xFF, 0x00, 0x1F, 0xE2, 0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02,
-    0xFD, 0x3F, 0xFF, 0xF0, 0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF,
-    0x3F, 0xD3, 0xFC, 0x3F, 0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF,
-    0xC7, 0xFF, 0x07, 0xFF, 0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0,
-    0x0F, 0xFF, 0xCF, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4,
-    0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1,
-    0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD,
-    0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00,
-    0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x54, 0x00, 0x15, 0x00,
-    0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x1F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x01, 0xFE, 0x1F, 0xFD, 0x00, 0x1F, 0xE2, 0xFF,
-    0xF0, 0x01, 0xFE, 0x2F, 0xFF, 0x40, 0x2F, 0xE2, 0xFF, 0xFC, 0x02, 0xFD, 0x3F, 0xFF, 0xD0, 0x2F,
-    0xD3, 0xFF, 0xFF, 0x03, 0xFD, 0x3F, 0xFF, 0xF4, 0x3F, 0xD3, 0xFF, 0x7F, 0xC3, 0xFD, 0x3F, 0xF3,
-    0xFD, 0x3F, 0xC3, 0xFF, 0x2F, 0xE3, 0xFC, 0x7F, 0xF0, 0xFF, 0x7F, 0xC7, 0xFF, 0x0B, 0xFF, 0xFC,
-    0x7F, 0xF0, 0x7F, 0xFF, 0xCB, 0xFF, 0x03, 0xFF, 0xFC, 0xBF, 0xF0, 0x1F, 0xFF, 0xCB, 0xFF, 0x00,
-    0xFF, 0xFC, 0xFF, 0xF0, 0x0B, 0xFF, 0xCF, 0xFF, 0x00, 0x3F, 0xF8, 0x06, 0xA0, 0x00, 0xA8, 0x02,
-    0xFD, 0x0B, 0xF4, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF9, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xF9, 0x1F, 0xF0, 0x1F, 0xE0, 0x07, 0xF0, 0x1F,
-    0xC0, 0x03, 0xF0, 0x2F, 0xC0, 0x03, 0xF4, 0x2F, 0xC0, 0x03, 0xF4, 0x2F, 0xC0, 0x07, 0xF8, 0x3F,
-    0xD0, 0x07, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x3F,
-    0xE0, 0x0F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF2, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x41, 0xFF, 0x91, 0xFF, 0x07,
-    0xF8, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xBF, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x3F, 0x4B, 0xF0,
-    0x01, 0xFE, 0x3F, 0xD0, 0x07, 0xF8, 0xFF, 0x40, 0x2F, 0xE3, 0xFD, 0x00, 0xBF, 0x8F, 0xF8, 0x02,
-    0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0x40,
-    0x00, 0xFF, 0x1F, 0xFC, 0x00, 0x1F, 0xE1, 0xFF, 0xD0, 0x01, 0xFE, 0x2F, 0xFF, 0x00, 0x1F, 0xE2,
-    0xFF, 0xF4, 0x02, 0xFE, 0x2F, 0xFF, 0xC0, 0x2F, 0xD3, 0xFF, 0xFD, 0x02, 0xFD, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xD3, 0xFF, 0xFF, 0x43, 0xFD, 0x3F, 0xF7, 0xFC, 0x3F, 0xD3, 0xFF, 0x3F, 0xD3, 0xFC, 0x3F,
-    0xF2, 0xFE, 0x3F, 0xC7, 0xFF, 0x0F, 0xF7, 0xFC, 0x7F, 0xF0, 0xBF, 0xFF, 0xC7, 0xFF, 0x07, 0xFF,
-    0xFC, 0xBF, 0xF0, 0x3F, 0xFF, 0xCB, 0xFF, 0x01, 0xFF, 0xFC, 0xBF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF,
-    0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x57, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0x0B, 0xF0, 0x00,
-    0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0x8F, 0xF4, 0x02, 0xFE,
-    0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0x7F, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x15, 0xAA, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF,
-    0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC,
-    0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAA,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC,
-    0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00,
-    0x7F, 0x4F, 0xF8, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x2F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xE6, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0B,
-    0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xC0, 0x00, 0x03,
-    0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x00, 0x1F,
-    0xF3, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x2F, 0xFF, 0x94, 0x5F, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0xBF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF4, 0x2F, 0xE0, 0xBF, 0x40, 0x3F, 0xC3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0,
-    0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x7F, 0x4F, 0xF8, 0x07,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40,
-    0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF9, 0xBF, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0xBF, 0xFE,
-    0x51, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x05, 0x40, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x02, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x03,
-    0xFE, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xD1, 0x55, 0x5A, 0xAA, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xEB, 0xF4, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x03,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xA6, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xEA, 0xAA, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x01, 0xBF, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xEA,
-    0xFC, 0x00, 0xFF, 0x42, 0xFF, 0xF0, 0x07, 0xE0, 0x2F, 0xD0, 0x0F, 0xFE, 0x15, 0x7F, 0x03, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0x80, 0x03, 0xFE, 0x55, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xB8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0x40, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xE0, 0x0F, 0xE0, 0x02,
-    0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x2F, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFD, 0x1F, 0xF4, 0x0B, 0xFD, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x7F, 0xD0, 0xBF, 0xE0, 0x1F, 0xF8,
-    0x2F, 0xF8, 0x07, 0xFF, 0x0F, 0xFE, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF, 0xF0, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x0F, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xA8, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xD0,
-    0x0F, 0xE0, 0x02, 0xF8, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F,
-    0xF0, 0x0F, 0xE0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0x47, 0xFD, 0x02, 0xFF, 0x40, 0x7F, 0xC0, 0xBF,
-    0xE0, 0x1F, 0xF4, 0x2F, 0xF8, 0x07, 0xFE, 0x0B, 0xFE, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0xF4,
-    0xFF, 0xF0, 0x1F, 0xFE, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF6, 0xF8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xA8, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x69, 0x00,
-    0x0A, 0x80, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0xBF, 0x6F, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0xFE, 0x00,
-    0x2F, 0xC0, 0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xFC, 0x03, 0xF8, 0x02, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xD1, 0xFF, 0x40, 0xBF, 0xD0, 0x1F, 0xF0, 0x2F, 0xF8, 0x07, 0xFD, 0x0B, 0xFE, 0x01, 0xFF,
-    0x82, 0xFF, 0x80, 0x7F, 0xF0, 0xFF, 0xE0, 0x1F, 0xFD, 0x3F, 0xFC, 0x07, 0xFF, 0x8F, 0xFF, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05, 0x42, 0xFC, 0x02, 0xFC, 0x0B, 0xF5, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFA, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xE0, 0x00, 0x2F,
-    0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0x80,
-    0x0F, 0xD5, 0x6C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0x00,
-    0x2F, 0xE0, 0x3E, 0x40, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0x00, 0x1A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xEB, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x0F,
-    0x80, 0x00, 0xBF, 0xE0, 0xFF, 0xF5, 0x1B, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x40, 0x00, 0x0B, 0xFE, 0x07, 0xE0,
-    0x00, 0x2F, 0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x67, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x01, 0x0F, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x55, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xAF, 0xD0, 0x00, 0xBF, 0xD0, 0x01, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3E, 0x00, 0x02,
-    0xFF, 0x83, 0xFF, 0xD4, 0x6F, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x02, 0xA4, 0x1F, 0xD0, 0x7F, 0x80, 0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF9, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x3D, 0x00, 0x00, 0x00, 0x2A, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xAF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x40, 0x3F, 0x40, 0x0F, 0xD0, 0x1F,
-    0xD0, 0x07, 0xF4, 0x06, 0xA0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x3D, 0x00, 0x00, 0x3F, 0xF3, 0xD0, 0x00, 0x07, 0xCF,
-    0xFC, 0x00, 0x00, 0xBC, 0x7F, 0xC0, 0x00, 0x02, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF,
-    0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC,
-    0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x03, 0xFD, 0x3C, 0x00, 0x2F, 0xBE, 0xF0,
-    0x00, 0xB8, 0xFF, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0,
-    0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0, 0x03,
-    0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x01, 0x56, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xEA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00,
-    0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00,
-    0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F,
-    0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0, 0x02, 0xFC,
-    0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0, 0x03, 0xFD, 0x2F,
-    0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xF8, 0x02, 0xF4, 0x00, 0x1F, 0xFA, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE,
-    0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00,
-    0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB,
-    0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF9, 0x4B, 0xD0, 0x2F, 0xC0, 0x7F, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x40,
-    0x0B, 0xF0, 0xFD, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF, 0x0F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F,
-    0xF4, 0xBF, 0x00, 0x3F, 0xD2, 0xFC, 0x00, 0xFF, 0x47, 0xFD, 0x0F, 0xFD, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0,
-    0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE,
-    0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00,
-    0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7,
-    0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x07, 0xDF, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x3F, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0xBF,
-    0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFE, 0x00, 0x3F, 0xD2, 0xF8, 0x00, 0xFF, 0x4B,
-    0xF0, 0x03, 0xFD, 0x2F, 0xC0, 0x0F, 0xF4, 0x7F, 0xD0, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xD0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x40, 0x15, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80,
-    0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x2F, 0xF8,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x2F, 0xF0, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x1F, 0xFF, 0xEB, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x01,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x1F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0x80, 0x0F, 0xF4,
-    0x00, 0x02, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x43, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xFF,
-    0xD0, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC,
-    0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC7, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0xFC,
-    0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xBF, 0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x00,
-    0x2F, 0xC3, 0xF8, 0x00, 0xFF, 0x4F, 0xE0, 0x03, 0xFD, 0x2F, 0x80, 0x0F, 0xF4, 0xBF, 0x00, 0x3F,
-    0xD2, 0xFD, 0x01, 0xFF, 0x47, 0xFF, 0xAF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFB, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF4, 0x00, 0x55, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x02, 0xFF, 0x40, 0x3F, 0xE0,
-    0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x0F, 0xFD, 0x0B, 0xFF, 0xD0, 0xBF, 0xC0, 0x0B, 0xFE,
-    0x0F, 0xFF, 0xF0, 0xFF, 0xC0, 0x07, 0xFF, 0x2F, 0xFF, 0xF4, 0xFF, 0x80, 0x07, 0xFF, 0x7F, 0xFF,
-    0xFD, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xF4, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x8B,
-    0xF4, 0x00, 0x00, 0x3F, 0xD1, 0xFE, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xF8, 0x0F,
-    0xF4, 0xBF, 0xD2, 0xFD, 0x01, 0xFE, 0x7F, 0xFC, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x87, 0xF8,
-    0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE,
-    0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F,
-    0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xD1, 0xFE, 0x00,
-    0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x2F, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFC, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x03, 0xFE, 0x2F, 0xC0, 0x00, 0x7F, 0xCF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x01, 0x5B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x1F, 0xF0,
-    0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x00, 0xBF, 0xD2, 0xFF, 0x00, 0x02, 0xFF, 0x4F, 0xFD, 0x00, 0x05,
-    0x55, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD,
-    0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x47, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAB, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0xF5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x01, 0xF8,
-    0x02, 0xFC, 0x0B, 0xF0, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x3F, 0xFD, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xF4,
-    0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x15, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0xFD, 0x03,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0x80, 0x0F, 0xF1, 0xFE, 0x03, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01,
-    0x43, 0xFC, 0x3D, 0x7F, 0xF3, 0xDB, 0xCF, 0xFC, 0xBC, 0x7F, 0xC6, 0x81, 0xA0, 0x05, 0xAA, 0xFF,
-    0x03, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xCA, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x15, 0x56, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0x95, 0x55, 0x2F, 0xE5, 0x2F,
-    0x4B, 0xF0, 0x0F, 0xC1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x01, 0xBF, 0xD0, 0x00, 0x05, 0x40,
-    0x7F, 0x82, 0xFE, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x3E, 0x0F, 0xE0, 0x38, 0x3C, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x07, 0xFF, 0x2F, 0x7C, 0xBF, 0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x05, 0x40, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xE0,
-    0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x02, 0xFC, 0x0F, 0xF1, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x03, 0xFD, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0xBF, 0xF4, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x2F, 0xF4, 0x1F, 0xF8, 0x0F, 0xFC, 0x0F, 0xFD, 0x0B, 0xFF, 0x0B, 0xFF, 0x42, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x2F, 0xF4, 0x0F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x2A, 0xA0, 0x00, 0x7F,
-    0xF8, 0x0F, 0xFE, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x1F,
-    0xFC, 0x02, 0xAA, 0x00, 0x01, 0x40, 0x7D, 0x6F, 0xDB, 0xFD, 0xBF, 0xD0, 0x7D, 0x07, 0xD0, 0x54,
-    0x0B, 0xC0, 0xBE, 0x9B, 0xFD, 0xBF, 0xDB, 0xC0, 0xBC, 0x00, 0xBF, 0xA9, 0x50, 0xBF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0xBD, 0x07, 0xD0, 0xFC, 0x3F, 0xC3, 0xF0, 0x2C, 0x00, 0x00, 0x00, 0x1F,
-    0x3F, 0xBC, 0xBE, 0x3F, 0x1F, 0x00, 0x01, 0x40, 0x3F, 0x00, 0xFC, 0x2F, 0xFE, 0xBF, 0xFA, 0xFF,
-    0xE0, 0xBF, 0xFA, 0xFF, 0xEB, 0xFF, 0x83, 0xF0, 0x0F, 0xC0, 0x15, 0x00, 0x03, 0x00, 0x30, 0x7F,
-    0xF1, 0x75, 0x03, 0x00, 0x00, 0x05, 0x6A, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF,
-    0x0A, 0xAA, 0x95, 0x54, 0x1F, 0xD0, 0xBF, 0x83, 0xFE, 0x0F, 0xFC, 0x3F, 0xF0, 0x55, 0x40, 0x3F,
-    0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x00, 0x00,
-    0x7E, 0x07, 0xFF, 0x2F, 0x7C, 0xBF, 0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0xBF, 0xE0, 0x6A, 0x80, 0x2E, 0x00, 0xF4,
-    0x03, 0xF8, 0x2F, 0xF8, 0x52, 0xF1, 0xFF, 0x8B, 0xFC, 0x1A, 0x40, 0x00, 0x50, 0x03, 0xF0, 0x0F,
-    0xE0, 0x3F, 0x80, 0x7F, 0x00, 0x7F, 0xFC, 0x3F, 0xFC, 0x0B, 0xFC, 0x00, 0x10, 0x00, 0x1F, 0xD7,
-    0xF6, 0xFD, 0xBF, 0x6F, 0xDF, 0xF7, 0xFD, 0xFF, 0x40, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x4F, 0xD1, 0xFD, 0x3F, 0x03, 0xF4, 0xFC, 0x0F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF4, 0xFF, 0xD3, 0xE3,
-    0xFF, 0xCF, 0x9F, 0x6F, 0xFD, 0x7D, 0x3F, 0xF0, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFF, 0xE1, 0xFE, 0xAA, 0xA4, 0x00, 0x55, 0xAA, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFA, 0xA9, 0x0B, 0xD0, 0xF4, 0xFF, 0xD3, 0xE3, 0xFF, 0xCF, 0x9F, 0x6F, 0xFD,
-    0x7D, 0x3F, 0xF0, 0xF4, 0x2F, 0x40, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0x0F, 0xF0, 0xBC, 0xFF, 0x3F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA,
-    0xAA, 0x2A, 0xAA, 0xA3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xE0, 0x3F, 0x3E, 0x03, 0xF3, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x2F, 0xBE, 0x1F, 0xFF, 0xEB, 0x6F, 0xBE, 0xD7, 0xCF, 0xF1, 0xF3,
-    0xFC, 0x7C, 0xF0, 0x00, 0x00, 0x2C, 0x34, 0x0F, 0xE0, 0x07, 0xC0, 0x0B, 0xD0, 0x2D, 0xF4, 0x28,
-    0x28, 0x05, 0x01, 0x43, 0xFC, 0x3D, 0x7F, 0xF3, 0xDB, 0xCF, 0xFC, 0xBC, 0x7F, 0xC6, 0x81, 0xA0,
-    0x00, 0x2D, 0x0B, 0xE2, 0xFC, 0x7F, 0x2F, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0xBF,
-    0xCB, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0x03, 0xF4,
-    0xFC, 0x0F, 0xD3, 0xF0, 0x3F, 0x40, 0x05, 0x6A, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFF, 0x0A, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x55, 0x00, 0x00, 0x00, 0x15, 0x01, 0x50, 0xFC,
-    0x0F, 0xC7, 0xF0, 0x3F, 0x1F, 0xC1, 0xFC, 0x7F, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F,
-    0xC2, 0xFC, 0x69, 0x55, 0x2F, 0xFF, 0xDB, 0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xE0,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x78, 0x00, 0xBF, 0x3F, 0xF0, 0xBF, 0xFF,
-    0xBC, 0x3F, 0xFF, 0xEF, 0x0F, 0xCF, 0xFF, 0xC3, 0xF0, 0xFF, 0xE0, 0xFC, 0x7F, 0xF0, 0x00, 0x2E,
-    0x40, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xE1, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xF5, 0xFF, 0xE7, 0xFF, 0x47, 0xFF, 0xFF, 0xFD, 0xBF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0x83, 0xFF, 0x8A, 0x4B, 0xFF, 0x90, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3F,
-    0xFC, 0x0B, 0xE2, 0xFF, 0xFC, 0x2F, 0xCF, 0xF3, 0xFC, 0xBF, 0x3F, 0x83, 0xFF, 0xF4, 0x7F, 0x03,
-    0xFF, 0xC0, 0x00, 0x01, 0xA4, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xF8, 0xBF, 0xFF, 0x4B,
-    0xF3, 0xF8, 0xBF, 0xBF, 0x8F, 0xE0, 0xBF, 0xFC, 0x06, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x43, 0x90, 0x0B, 0xF2, 0xFC, 0x00, 0x20, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x0F, 0x42, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x3C, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x40, 0x00, 0x6F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0x55, 0x5B, 0xFE,
-    0x03, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xC1, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0xA4, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x2F, 0xFA, 0xAA, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE5, 0x55,
-    0x50, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x05, 0x50, 0x15, 0x40, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x47, 0xFC,
-    0x03, 0xFD, 0x1F, 0xF0, 0x1F, 0xF8, 0xBF, 0xD0, 0xBF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xAA, 0x47, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x1B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07,
-    0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x1F,
-    0xE0, 0x3F, 0xFE, 0x00, 0x07, 0xFC, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x6A,
-    0x80, 0xA9, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xD5, 0x55, 0x51, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x01,
-    0xFE, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFA, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x10,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xE0, 0x00, 0x2F, 0xF8, 0x3F, 0xFD, 0x46, 0xFF, 0xD2, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xF8, 0xBF, 0x8B, 0xF8, 0xBF, 0x87, 0xF8,
-    0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xCB, 0xFC, 0xBF,
-    0xCB, 0xFC, 0xFF, 0xDF, 0xFD, 0xFF, 0xD0, 0x3F, 0x43, 0xF5, 0xFD, 0x1F, 0xD7, 0xF8, 0x7F, 0xAF,
-    0xF2, 0xFF, 0xBF, 0x8B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0,
-    0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFF,
-    0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x3E, 0x47, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F,
-    0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xE0, 0x03, 0xF4, 0x07, 0xFC, 0x02, 0xF8, 0x00, 0xFD, 0x00,
-    0xBF, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xD0, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xF0, 0x0F, 0xD0,
-    0x03, 0xFA, 0xAF, 0xFC, 0x1B, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xF9, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x07, 0xFC, 0x3F, 0x40, 0x03, 0xF4,
-    0x02, 0xFD, 0x3F, 0x40, 0x03, 0xF4, 0x01, 0xFD, 0x3F, 0x40, 0x03, 0xF4, 0x02, 0xFD, 0x3F, 0x40,
-    0x03, 0xFA, 0xAF, 0xFC, 0x3F, 0x40, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0x40, 0x03, 0xFF, 0xFF, 0xF0,
-    0x3F, 0x40, 0x03, 0xFF, 0xFE, 0x40, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFE, 0xAB, 0xFF, 0xAB, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFD, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xFD, 0x00,
-    0x07, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE0, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xE0,
-    0x00, 0x7F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFF,
-    0x00, 0x0F, 0xF4, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x03,
-    0xFC, 0x7F, 0xE0, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0x9F, 0xF8, 0x00, 0x01, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF3, 0xFF, 0xF0, 0x00, 0xBF, 0xC7, 0xFF,
-    0xF4, 0x02, 0xFF, 0x07, 0xFF, 0xF4, 0x0F, 0xFC, 0x0B, 0xFF, 0xF8, 0x3F, 0xF0, 0x0B, 0xFF, 0xF8,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0x3F, 0xF4, 0xFF,
-    0x40, 0x0B, 0xFF, 0x4B, 0xF4, 0x00, 0xFF, 0xF4, 0xBF, 0x40, 0x1F, 0xFF, 0x8B, 0xF4, 0x03, 0xFF,
-    0xF8, 0xBF, 0x80, 0x7F, 0xFF, 0x87, 0xF8, 0x0F, 0xFF, 0xFC, 0x7F, 0x81, 0xFE, 0xFF, 0xC7, 0xFC,
-    0x3F, 0xDF, 0xFC, 0x7F, 0xC7, 0xFC, 0xFF, 0xC7, 0xFC, 0xFF, 0x4F, 0xFC, 0x3F, 0xDF, 0xF0, 0xFF,
-    0xC3, 0xFF, 0xFE, 0x0F, 0xFD, 0x3F, 0xFF, 0xC0, 0xFF, 0xD3, 0xFF, 0xF8, 0x0F, 0xFD, 0x3F, 0xFF,
-    0x40, 0xFF, 0xE3, 0xFF, 0xF0, 0x1F, 0xFE, 0x3F, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFF,
-    0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x7F,
-    0x80, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xFE, 0x02, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x0B, 0xFC, 0x0F, 0xE0, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x2F, 0xF3, 0xFC, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xFE,
-    0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE,
-    0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE,
-    0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE,
-    0xBF, 0x40, 0x01, 0xFE, 0xBF, 0x40, 0x01, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE,
-    0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0,
-    0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0xFD, 0x02,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFC, 0x2F, 0xC0, 0x0B, 0xD1, 0xFC, 0x00,
-    0xFD, 0x1F, 0xEA, 0xBF, 0xC1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0,
-    0x0B, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x2F, 0x03, 0xF0, 0x01, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x03, 0xF5, 0x5B, 0xFC, 0x0F, 0xC0, 0x02, 0xF8,
-    0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0x55, 0x54, 0x7F, 0x80, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x2F, 0xD0, 0x00,
-    0xBF, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xF8,
-    0x02, 0xFF, 0x00, 0x2F, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x00,
-    0xBF, 0x80, 0x55, 0x00, 0x01, 0x54, 0x00, 0x00, 0x15, 0x55, 0xA4, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xE5, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xF8,
-    0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x0B, 0xFE, 0x0F, 0xFF, 0x43,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xF0, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xF5, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xF9, 0xFF, 0xCF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xCB, 0xFF, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFC, 0x2F, 0xFC, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0xBF, 0xF4, 0x2F, 0xFF, 0xF0, 0x06, 0xBF,
-    0x90, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x15, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xF4, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC8, 0x00, 0x1F, 0xF3, 0xE9, 0x6F, 0xF8, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xF9, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x03, 0xFF, 0x4F, 0xF4, 0x00, 0xBF, 0xF4, 0xBF, 0x40,
-    0x0F, 0xFF, 0x4B, 0xF4, 0x01, 0xFF, 0xF8, 0xBF, 0x40, 0x3F, 0xFF, 0x8B, 0xF8, 0x07, 0xFF, 0xF8,
-    0x7F, 0x80, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F, 0xEF, 0xFC, 0x7F, 0xC3, 0xFD, 0xFF, 0xC7, 0xFC, 0x7F,
-    0xCF, 0xFC, 0x7F, 0xCF, 0xF4, 0xFF, 0xC3, 0xFD, 0xFF, 0x0F, 0xFC, 0x3F, 0xFF, 0xE0, 0xFF, 0xD3,
-    0xFF, 0xFC, 0x0F, 0xFD, 0x3F, 0xFF, 0x80, 0xFF, 0xD3, 0xFF, 0xF4, 0x0F, 0xFE, 0x3F, 0xFF, 0x01,
-    0xFF, 0xE3, 0xFF, 0xD0, 0x1F, 0xFE, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0xFF, 0xEF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0x3F, 0xF4, 0xFF, 0x40, 0x0B, 0xFF, 0x4B, 0xF4,
-    0x00, 0xFF, 0xF4, 0xBF, 0x40, 0x1F, 0xFF, 0x8B, 0xF4, 0x03, 0xFF, 0xF8, 0xBF, 0x80, 0x7F, 0xFF,
-    0x87, 0xF8, 0x0F, 0xFF, 0xFC, 0x7F, 0x81, 0xFE, 0xFF, 0xC7, 0xFC, 0x3F, 0xDF, 0xFC, 0x7F, 0xC7,
-    0xFC, 0xFF, 0xC7, 0xFC, 0xFF, 0x4F, 0xFC, 0x3F, 0xDF, 0xF0, 0xFF, 0xC3, 0xFF, 0xFE, 0x0F, 0xFD,
-    0x3F, 0xFF, 0xC0, 0xFF, 0xD3, 0xFF, 0xF8, 0x0F, 0xFD, 0x3F, 0xFF, 0x40, 0xFF, 0xE3, 0xFF, 0xF0,
-    0x1F, 0xFE, 0x3F, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFF, 0x0B, 0xF4, 0x0F, 0xFC, 0x00,
-    0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0xF4, 0x00, 0x0F, 0xF1,
-    0xFF, 0x80, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x01, 0xFE, 0x7F, 0xE0, 0x00, 0x07, 0xFB, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x02, 0xFF, 0x1F, 0xFF, 0xD0,
-    0x0B, 0xFC, 0x1F, 0xFF, 0xD0, 0x3F, 0xF0, 0x2F, 0xFF, 0xE0, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xEB, 0xFF, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
-    0xFF, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xFE, 0x02, 0xFF, 0x07,
-    0xFE, 0x02, 0xFF, 0x2F, 0xFD, 0x02, 0xFF, 0x3F, 0xFC, 0x02, 0xFF, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF5, 0xFF, 0xC0, 0x00, 0xFF, 0xD7, 0xFF, 0x80, 0x03,
-    0xFF, 0x5F, 0xFF, 0x00, 0x2F, 0xFE, 0x7F, 0xFD, 0x00, 0xFF, 0xF9, 0xFF, 0xFC, 0x0B, 0xFF, 0xE7,
-    0xFF, 0xF0, 0x3F, 0xFF, 0x9F, 0xFF, 0xE1, 0xFF, 0xFE, 0x7F, 0xBF, 0xCF, 0xFB, 0xF9, 0xFE, 0xFF,
-    0xBF, 0xDF, 0xEB, 0xFA, 0xFF, 0xFE, 0x7F, 0xAF, 0xE3, 0xFF, 0xF5, 0xFE, 0xBF, 0x8F, 0xFF, 0xC7,
-    0xFA, 0xFE, 0x1F, 0xFE, 0x1F, 0xEB, 0xF8, 0x3F, 0xF4, 0xBF, 0xAF, 0xE0, 0xFF, 0xC2, 0xFF, 0xBF,
-    0x81, 0xA9, 0x0B, 0xFE, 0xFE, 0x00, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00, 0xBF, 0xDA, 0x90, 0x00,
-    0x01, 0xA9, 0x7F, 0xC0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x03, 0xFD,
-    0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0xFF, 0x8B, 0xFC,
-    0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x00,
-    0xFF, 0x8B, 0xFD, 0x00, 0x07, 0xFF, 0x2F, 0xF9, 0x55, 0x6F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x02, 0xFF, 0xCF, 0xFE, 0x00, 0x0B, 0xFF, 0x3F, 0xF8, 0x00, 0x2F,
-    0xFC, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8,
-    0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x0F, 0xF3,
-    0xFD, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xCF,
-    0xFC, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xBF, 0xFE, 0x51, 0x7F, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFD, 0xBF, 0x95, 0x5B, 0xF6, 0xFD, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0x7F, 0x6F, 0xD0,
-    0x01, 0xFD, 0xBF, 0x40, 0x07, 0xF6, 0xFD, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0xBF, 0x6F, 0xE0, 0x02,
-    0xFD, 0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xBF, 0xAF, 0xE0, 0x02, 0xFE,
-    0xBF, 0x80, 0x0B, 0xFA, 0xFE, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xBF, 0xAF, 0xE0, 0x02, 0xFE, 0x6A,
-    0x40, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x3F, 0x8F, 0xF0, 0x01,
-    0xFF, 0x3F, 0xD5, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA,
-    0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF,
-    0x90, 0x16, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x55, 0x55,
-    0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0,
-    0xFF, 0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x0B, 0xF4, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE,
-    0x00, 0x0F, 0xF8, 0x7F, 0x40, 0x02, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFD, 0x07, 0xE0, 0x7F, 0xC1, 0xFC, 0x2F, 0x01, 0xFF, 0x00, 0xF4, 0xF4, 0x07, 0xFC,
-    0x03, 0xE3, 0xE0, 0x1F, 0xF0, 0x1F, 0x8F, 0xE0, 0x7F, 0xC1, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x03,
-    0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0xBF, 0xE7, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xDB, 0xFF, 0x40,
-    0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x0B, 0xFF, 0x41, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0xFF, 0xF4, 0x3F,
-    0xFC, 0x00, 0x7F, 0xFC, 0xBF, 0xF8, 0x00, 0x2F, 0xFE, 0x2A, 0x00, 0x06, 0x90, 0x7F, 0x00, 0x0F,
-    0xD0, 0x7F, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x0F,
-    0xE0, 0xBF, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x0F, 0xE0, 0xBF, 0x40, 0x0F, 0xE0, 0xBF, 0x40, 0x0F,
-    0xE0, 0xBF, 0x40, 0x0F, 0xE0, 0xBF, 0x40, 0x0F, 0xE0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x40, 0x0F,
-    0xF0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x40, 0x1F, 0xF4, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x06, 0xA4, 0x05, 0x00, 0x01, 0x41, 0xF8, 0x00, 0xBD,
-    0x2F, 0x40, 0x0B, 0xD2, 0xF0, 0x00, 0xFD, 0x2F, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0xFE, 0x3E, 0x00,
-    0x0F, 0xE3, 0xE0, 0x00, 0xFE, 0x3F, 0x00, 0x2F, 0xE3, 0xF8, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFB, 0xE0, 0x1B, 0xF8, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x55, 0x00, 0x00, 0x05,
-    0x5B, 0xF4, 0x1F, 0xD0, 0xFF, 0xBF, 0x41, 0xFE, 0x0F, 0xFB, 0xF4, 0x1F, 0xE0, 0xFF, 0xBF, 0x41,
-    0xFE, 0x0F, 0xFB, 0xF4, 0x1F, 0xD0, 0xFF, 0xBF, 0x41, 0xFD, 0x0F, 0xFB, 0xF4, 0x1F, 0xD0, 0xFF,
-    0xBF, 0x41, 0xFD, 0x0F, 0xFB, 0xF4, 0x1F, 0xD0, 0xBF, 0xBF, 0x40, 0xFD, 0x0B, 0xFB, 0xF4, 0x0F,
-    0xD0, 0xBF, 0xBF, 0x40, 0xFD, 0x0B, 0xFB, 0xF4, 0x0F, 0xD0, 0xBF, 0xBF, 0x40, 0xFD, 0x0B, 0xFB,
-    0xF4, 0x0F, 0xD0, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x6A, 0x43, 0xFC,
-    0x0B, 0xF4, 0x1F, 0xE0, 0xFF, 0x02, 0xFD, 0x07, 0xF8, 0x3F, 0xC0, 0xBF, 0x41, 0xFE, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x7F, 0x43, 0xFC, 0x0B, 0xF4, 0x1F, 0xD0, 0xFF, 0x02, 0xFD, 0x07, 0xF4, 0x3F, 0xC0,
-    0xBF, 0x01, 0xFD, 0x0F, 0xF0, 0x2F, 0xC0, 0x7F, 0x43, 0xFC, 0x0B, 0xF0, 0x0F, 0xD0, 0xBF, 0x02,
-    0xFC, 0x03, 0xF4, 0x2F, 0xC0, 0xBF, 0x00, 0xFD, 0x0B, 0xF0, 0x2F, 0xC0, 0x3F, 0x42, 0xFC, 0x0B,
-    0xF0, 0x0F, 0xD0, 0xBF, 0x02, 0xFC, 0x03, 0xF4, 0x2F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15,
-    0x55, 0x55, 0x56, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xBE, 0x01, 0xFF, 0x00, 0x02,
-    0xF8, 0x01, 0xFD, 0x00, 0x0B, 0xE0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x2F, 0xD0, 0x00, 0xBF, 0xAB,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x4B, 0xFF,
-    0xF9, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0xBF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFD, 0x2F, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x8B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0xE2, 0xF8, 0x00,
-    0xFE, 0x00, 0x0F, 0xF8, 0xBE, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0x2F, 0xEA, 0xFF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF2, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0xFF, 0xFF, 0x90,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBF, 0xFF,
-    0x90, 0x2F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xE2, 0xF8, 0x07, 0xFC, 0xBE, 0x00, 0x7F, 0x6F, 0x80,
-    0x0F, 0xEB, 0xE0, 0x0B, 0xF6, 0xFE, 0xAF, 0xFD, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x40, 0x7F, 0xC0, 0x01, 0xFF, 0x03, 0xFC,
-    0x00, 0x02, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xDB, 0xFF, 0x40, 0x0B, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0B, 0xFE, 0x00,
-    0x0F, 0xC0, 0x2F, 0xFF, 0xF4, 0x03, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0xFC, 0x0F, 0xFE, 0xBF, 0xF0,
-    0x3F, 0x0B, 0xF8, 0x02, 0xFC, 0x0F, 0xC3, 0xFC, 0x00, 0x3F, 0x83, 0xF0, 0xFD, 0x00, 0x0B, 0xE0,
-    0xFF, 0xFF, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xC3,
-    0xFF, 0xFC, 0x00, 0x07, 0xF0, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x3F, 0x1F, 0xF0, 0x00, 0xFF, 0x0F,
-    0xC3, 0xFE, 0x00, 0xBF, 0x83, 0xF0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x3E,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0x80, 0x3F, 0xFF, 0xF4, 0x03, 0xE0, 0x01, 0xBF, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x07, 0xF0,
-    0x07, 0xF0, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x07,
-    0xF4, 0x0B, 0xF8, 0x01, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x47, 0xFF, 0x80, 0xBF, 0x80, 0x7F, 0xE0, 0x3F,
-    0xD0, 0x1F, 0xFC, 0x1F, 0xF4, 0x07, 0xFF, 0x0F, 0xFE, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0xBF, 0xF1,
-    0xFF, 0xE0, 0x2F, 0xFC, 0xBF, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x7F, 0xC0,
-    0x7E, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF8, 0x3E, 0x00, 0x0F, 0xE0, 0xF4,
-    0x00, 0x2F, 0xC3, 0xD0, 0x00, 0xBF, 0x0F, 0x80, 0x03, 0xFC, 0x3F, 0xEA, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x1B, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0xAA, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0x86, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF,
-    0xF4, 0xBF, 0xF4, 0x2F, 0xFC, 0xBF, 0xC0, 0x0F, 0xFC, 0x7F, 0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x07,
-    0xFC, 0x3F, 0xD0, 0x0F, 0xFC, 0x3F, 0xFE, 0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xD0, 0xFD,
-    0x17, 0xF0, 0xFC, 0x01, 0xF4, 0xFC, 0x00, 0xF4, 0xFC, 0x02, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xF0, 0xFE, 0xAB, 0xFC, 0xFC, 0x00, 0xBE, 0xFC, 0x00, 0xBE, 0xFF, 0xAF, 0xFE, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFA,
-    0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x0B, 0xF4, 0x00,
-    0x1F, 0xC2, 0xFD, 0x00, 0x0B, 0xF0, 0xBF, 0x80, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0xFF, 0x07, 0xF8,
-    0x00, 0x7F, 0x81, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x2F, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xC0,
-    0x00, 0xFF, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x00, 0xAA, 0x40, 0xAA, 0xA0, 0x2A, 0xA0, 0x00, 0x2F,
-    0xF0, 0x3F, 0xF8, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xD2,
-    0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF3,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0xFF, 0xF2,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xF4, 0x3F, 0xFC, 0x2F, 0xFF, 0xD0, 0x1B, 0xF8, 0x0F, 0xFF, 0xC1, 0x00,
-    0xB4, 0x00, 0x1E, 0x00, 0x1F, 0x42, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xCE, 0x5B,
-    0xF3, 0xFF, 0xF9, 0xFF, 0xFD, 0x2F, 0xF9, 0x00, 0xBE, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0xFF, 0xCB,
-    0xF0, 0x07, 0xFF, 0x2F, 0xC0, 0x3F, 0xFC, 0xBF, 0x03, 0xFF, 0xF2, 0xFC, 0x1F, 0xFF, 0xCB, 0xF0,
-    0xFF, 0x7F, 0x2F, 0xCB, 0xF5, 0xFC, 0xBF, 0x7F, 0xC7, 0xF2, 0xFF, 0xFC, 0x1F, 0xDB, 0xFF, 0xE0,
-    0xBF, 0x6F, 0xFF, 0x02, 0xFD, 0xBF, 0xF4, 0x0B, 0xF6, 0xFF, 0x80, 0x2F, 0xDB, 0xFC, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x3F, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xF8, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x05, 0x01, 0xF4, 0x03, 0xF4, 0x0F, 0x40,
-    0xBF, 0x40, 0xF8, 0x0F, 0xF8, 0x0F, 0x82, 0xFF, 0x80, 0xF8, 0x3F, 0xF8, 0x0F, 0x87, 0xEF, 0xC0,
-    0xFC, 0xFD, 0xFC, 0x0F, 0xDF, 0x5F, 0xC0, 0xFF, 0xF2, 0xFC, 0x0F, 0xFE, 0x2F, 0xC0, 0xBF, 0xC2,
-    0xFC, 0x0B, 0xF8, 0x2F, 0xD0, 0xBF, 0x42, 0xFD, 0x0F, 0xC1, 0xFE, 0x00, 0x7F, 0x0F, 0xF0, 0x01,
-    0xF8, 0xBF, 0x00, 0x0B, 0xE7, 0xF8, 0x00, 0x2F, 0xBF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x2F, 0xCF, 0xFE, 0x00, 0xBF, 0x0F, 0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFC, 0x03, 0xFA, 0xFC, 0x03, 0xF0, 0xBC, 0x03, 0xF0, 0xBC, 0x03, 0xF0, 0xBC, 0x03,
-    0xF0, 0xBC, 0x03, 0xE0, 0xFC, 0x03, 0xE0, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0, 0xFC, 0x0B, 0xD0,
-    0xFC, 0x3F, 0xD0, 0xFC, 0x3F, 0x80, 0xA8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x54, 0x0B, 0xF8,
-    0x00, 0x7F, 0x42, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0xD0, 0x1F, 0xF8, 0x2F, 0xFC, 0x0B, 0xFE, 0x0B,
-    0xFF, 0x03, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0xE0, 0xFE, 0xFC, 0xFF, 0xF8, 0x3F, 0x7F, 0xBF, 0xBE,
-    0x0F, 0xDF, 0xFF, 0xAF, 0xC3, 0xF5, 0xFF, 0xDB, 0xF0, 0xFD, 0x3F, 0xF3, 0xFC, 0x3F, 0x8F, 0xFC,
-    0xFF, 0x0F, 0xE1, 0xFE, 0x3F, 0xC3, 0xF8, 0x3F, 0x0F, 0xF0, 0xFF, 0x01, 0x43, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0xBF, 0x1F, 0xC0, 0x02, 0xFC, 0x7F, 0x00, 0x0B,
-    0xF1, 0xFC, 0x00, 0x2F, 0xCB, 0xF4, 0x00, 0xBF, 0x2F, 0xD0, 0x03, 0xFC, 0xBF, 0x40, 0x0F, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xF6, 0xFE,
-    0x00, 0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xD3,
-    0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0x2F, 0xD0, 0x03, 0xFC, 0xBF, 0x40, 0x0F, 0xF2, 0xFD, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0xFF,
-    0x2F, 0xD0, 0x03, 0xFC, 0xBF, 0x40, 0x0F, 0xF2, 0xFD, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0xFF, 0x2F,
-    0xD0, 0x03, 0xFC, 0xBF, 0x40, 0x0F, 0xF2, 0xFE, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0xFD, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0x9B, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0x00, 0xFF, 0xC0, 0x0B, 0xC0, 0x3F, 0xE0, 0x01, 0xF4,
-    0x0F, 0xF8, 0x00, 0x7D, 0x03, 0xFE, 0x00, 0x1F, 0x80, 0xFF, 0xC0, 0x07, 0xD0, 0x3F, 0xF8, 0x07,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xC1, 0xA9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xF4, 0x0F, 0xF5, 0x18, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0xB8, 0x03, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x01, 0xBF, 0xE4, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xD5, 0x03, 0xF4, 0x05, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F,
-    0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8,
-    0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x95, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xD0, 0xFD, 0x07, 0xFC, 0x7F, 0x00, 0xFD, 0x01, 0xFD, 0xBE, 0x00, 0xFD, 0x00,
-    0xFD, 0xFE, 0x00, 0xFD, 0x00, 0xFE, 0xFE, 0x00, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0xFD, 0x01, 0xFE,
-    0xBF, 0x40, 0xFD, 0x03, 0xFD, 0x3F, 0xE5, 0xFE, 0x5F, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x1F, 0xD0,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0xBF, 0x6F, 0xE0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x07, 0xFF, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x1F, 0xD0, 0xBF, 0x40, 0x1F, 0xD0, 0xBF, 0x40, 0x1F, 0xD0, 0xBF, 0x40, 0x1F, 0xD0, 0xBF,
-    0x40, 0x1F, 0xD0, 0xBF, 0x40, 0x1F, 0xD0, 0x7F, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xD0, 0x7F,
-    0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x24, 0x01, 0x47, 0x80, 0x7C,
-    0x74, 0x07, 0xC7, 0x40, 0x7C, 0xB0, 0x07, 0xCB, 0x00, 0xBC, 0xB8, 0x1F, 0xC7, 0xFF, 0xFC, 0x3F,
-    0xFB, 0xC0, 0x65, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0xBF, 0x40, 0x54, 0x0F,
-    0xFB, 0xF4, 0x1F, 0xE0, 0xFF, 0xBF, 0x41, 0xFE, 0x0F, 0xFB, 0xF4, 0x1F, 0xD0, 0xFF, 0xBF, 0x41,
-    0xFD, 0x0F, 0xFB, 0xF4, 0x1F, 0xD0, 0xFF, 0xBF, 0x41, 0xFD, 0x0B, 0xFB, 0xF4, 0x1F, 0xD0, 0xBF,
-    0xBF, 0x40, 0xFD, 0x0B, 0xFB, 0xF4, 0x0F, 0xD0, 0xBF, 0xBF, 0x40, 0xFD, 0x0B, 0xFB, 0xF4, 0x0F,
-    0xD0, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0x40, 0x54, 0x0F, 0xF0, 0x2F, 0xD0, 0x7F, 0x83, 0xFC, 0x0B, 0xF4,
-    0x1F, 0xE0, 0xFF, 0x02, 0xFD, 0x07, 0xF4, 0x3F, 0xC0, 0xBF, 0x41, 0xFD, 0x0F, 0xF0, 0x2F, 0xD0,
-    0x7F, 0x43, 0xFC, 0x0B, 0xF4, 0x1F, 0xD0, 0xBF, 0x02, 0xFD, 0x07, 0xF4, 0x2F, 0xC0, 0xBF, 0x40,
-    0xFD, 0x0B, 0xF0, 0x2F, 0xD0, 0x3F, 0x42, 0xFC, 0x0B, 0xF4, 0x0F, 0xD0, 0xBF, 0x02, 0xFD, 0x03,
-    0xF4, 0x2F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xFD, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x3D, 0x07, 0xF0, 0x00,
-    0xF4, 0x0B, 0xC0, 0x03, 0xD0, 0x3F, 0x00, 0x0F, 0xEB, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x40, 0x00, 0x00, 0x3F,
-    0x0F, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xD0,
-    0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0x40, 0x03, 0xF0, 0xFF, 0xFF, 0x40,
-    0x0F, 0xD3, 0xD0, 0x7F, 0x00, 0x3F, 0x4F, 0x40, 0xBC, 0x00, 0xFD, 0x3D, 0x03, 0xF0, 0x03, 0xF8,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xE3, 0xFF, 0xFD, 0x00, 0x3F, 0x8F, 0xFF, 0x90, 0x00, 0xFE, 0x28, 0x00,
-    0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF9, 0x40, 0x03, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xF8, 0x3D, 0x07, 0xF0, 0xF4, 0x0B, 0xD3, 0xE0, 0x2F, 0x4F, 0xEF, 0xFC, 0x3F,
-    0xFF, 0xE0, 0xFF, 0xFD, 0x00, 0x02, 0xBA, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3D, 0x01, 0xFD, 0x01,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xC1, 0x00, 0x03, 0xF8, 0x3D, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x00, 0x6F, 0xE8, 0x00, 0x7C, 0x01, 0xBE, 0x80, 0x7C, 0x0B, 0xFF, 0xF0, 0x7C, 0x2F,
-    0xFF, 0xF8, 0x7C, 0x3F, 0x40, 0xFC, 0x7C, 0x7E, 0x00, 0x7D, 0x7D, 0xBC, 0x00, 0x3E, 0x7F, 0xFC,
-    0x00, 0x3E, 0x7F, 0xFC, 0x00, 0x3F, 0x7F, 0xFC, 0x00, 0x3E, 0x7E, 0xFD, 0x00, 0x3E, 0x7C, 0x7F,
-    0x40, 0xFE, 0x7C, 0x7F, 0xFF, 0xFC, 0x7C, 0x3F, 0xFF, 0xF8, 0x7C, 0x0F, 0xFF, 0xF0, 0x78, 0x02,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0x00, 0xFC, 0x02, 0xF4, 0x03,
-    0xF0, 0x0B, 0xD0, 0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0x40, 0x7F, 0x00, 0xFD, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x7F, 0x47, 0xFE, 0x03, 0xFC, 0x0B, 0xF8, 0x1F,
-    0xF0, 0x2F, 0xF0, 0xBF, 0xC0, 0xBF, 0xC3, 0xFF, 0x03, 0xFF, 0x1F, 0xFC, 0x0F, 0xFC, 0x01, 0x50,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xFC, 0x03, 0xF8, 0x02, 0xF4, 0x1F, 0xD1, 0x57, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x40, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x6D, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x90, 0x02, 0xF4, 0x2F, 0x40, 0x0F, 0xE0, 0xFE, 0x00, 0x3F,
-    0xC3, 0xFC, 0x01, 0xFF, 0x1F, 0xF0, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0xFE, 0x00, 0xBD, 0x07,
-    0xF4, 0x55, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xE9,
-    0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD4, 0x1B, 0x43, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x05, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x6F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0x80, 0x0B, 0xE0, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x00, 0xBF,
-    0x40, 0x0B, 0xE0, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0xFF, 0x40,
-    0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xFF, 0xC1, 0xBF,
-    0xFC, 0x00, 0xFF, 0xC2, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xEB, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F,
-    0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0xFE, 0x03, 0xF4, 0x1F, 0x80,
-    0x0F, 0xC2, 0xF0, 0x00, 0x14, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0xD4, 0x6F, 0xD2, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xFD, 0x56, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x40, 0x10, 0x02, 0xFE, 0x03, 0xE4, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x7F,
-    0xCB, 0xFD, 0xBF, 0xD5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82,
-    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD0, 0x2F,
-    0x82, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x2F, 0xFE, 0x02,
-    0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x7C, 0x00,
-    0x00, 0x3C, 0x07, 0xFF, 0x90, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x7C, 0x07, 0xC1, 0xFC, 0x07, 0xC0,
-    0x7C, 0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0x80, 0x7D, 0x6F, 0xC1, 0xF8, 0x07, 0xFF, 0xF4,
-    0x3F, 0x80, 0x7F, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0x80, 0x00, 0xF8, 0x02, 0xD0, 0x00, 0xF8, 0x02, 0xD0, 0x00, 0xF8, 0x02,
-    0xD0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0x02,
-    0xE0, 0xBD, 0xF8, 0x02, 0xE0, 0x3E, 0xF8, 0x02, 0xE0, 0x3E, 0xF8, 0x02, 0xE6, 0xFE, 0xF8, 0x03,
-    0xFF, 0xFC, 0xF8, 0x03, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE8,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x90, 0xBF, 0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x1F,
-    0xE0, 0x02, 0xF8, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xF4, 0x00,
-    0xBE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x80, 0x1F, 0xC3, 0xFC, 0x00,
-    0x7E, 0x2F, 0xC0, 0x02, 0xF9, 0xFE, 0x00, 0x0B, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0x80, 0x0B, 0xF3, 0xFF, 0x80, 0x2F, 0xC3, 0xFF, 0xC0, 0xFF, 0x03, 0xFF, 0xD0, 0x01, 0x50, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x3F, 0xCB, 0xF0, 0x03, 0xFF, 0x2F, 0xC0, 0x1F, 0xFC, 0xBF, 0x00, 0xFF, 0xF2, 0xFC, 0x0F,
-    0xFF, 0xCB, 0xF0, 0x7F, 0xFF, 0x2F, 0xC3, 0xFD, 0xFC, 0xBF, 0x2F, 0xD7, 0xF2, 0xFD, 0xFF, 0x1F,
-    0xCB, 0xFF, 0xF0, 0x7F, 0x6F, 0xFF, 0x82, 0xFD, 0xBF, 0xFC, 0x0B, 0xF6, 0xFF, 0xD0, 0x2F, 0xDB,
-    0xFE, 0x00, 0xBF, 0x6F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x05, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x3F, 0x00, 0x3F, 0x3F, 0x00,
-    0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F,
-    0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x15, 0x00, 0x00, 0x6A,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xFA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFC, 0x02, 0xF8, 0x00, 0xBF, 0x80, 0x0F, 0xC0, 0x0B, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0xD5,
-    0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x57, 0xFD, 0x54, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xAB, 0xFD,
-    0x00, 0xBF, 0x80, 0x2F, 0x80, 0x2F, 0xE0, 0x03, 0xF0, 0x0B, 0xF8, 0x02, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x01, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xEF, 0xFB,
-    0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xCB, 0xF4, 0x00, 0x2F, 0xD0, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x03,
-    0xFC, 0x2F, 0xD0, 0x07, 0xFC, 0x0F, 0xF0, 0x7F, 0xC0, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x00, 0xFF,
-    0x40, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x07, 0xFC, 0x0B, 0xFC, 0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF4,
-    0x0A, 0xAA, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F,
-    0xE0, 0x00, 0xFE, 0x2F, 0xD0, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x02, 0xF7, 0xF7, 0xF0, 0x01, 0xF8, 0xFC, 0xBD, 0x00, 0xBC, 0x3F, 0x0F, 0x80, 0x3F,
-    0x0F, 0xC3, 0xF0, 0x1F, 0x83, 0xF0, 0xBD, 0x0F, 0xE0, 0xFC, 0x1F, 0xC0, 0x00, 0x2B, 0x90, 0x07,
-    0xF4, 0x01, 0xFF, 0xFC, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0xC7, 0xFC,
-    0x0B, 0xFC, 0xBF, 0xFF, 0xFC, 0x0F, 0xF8, 0x2F, 0xFF, 0xF8, 0x0F, 0xFC, 0x0B, 0xFF, 0xF0, 0x07,
-    0xFE, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x41, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00,
-    0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x0F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 0x00, 0x3F, 0xF8,
-    0x2F, 0xFF, 0x96, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xF8, 0x07, 0xFF, 0xC1, 0xFC, 0x0F,
-    0xFF, 0xF5, 0xFC, 0x0F, 0xD3, 0xFF, 0xF8, 0x0F, 0xD0, 0xBF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xF4, 0x2F, 0xE0, 0x2F, 0xD0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x07, 0xF4, 0x3F, 0x80, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF8, 0x3F,
-    0xC0, 0x07, 0xF4, 0x3F, 0xE0, 0x1F, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xA0, 0x7F,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00,
-    0x2F, 0x40, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00,
-    0x7F, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x02, 0xFC, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x0A, 0xAA, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x7F, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFD, 0x55, 0x55,
-    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFA, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF5, 0x55, 0x54,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x0F, 0xD5,
-    0x54, 0x0F, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xF8, 0x0B, 0xFC, 0x2F, 0xF0, 0x02, 0xFD, 0x2F, 0xD0,
-    0x00, 0xFE, 0x2F, 0xD0, 0x00, 0xFE, 0x2F, 0xD0, 0x00, 0xFE, 0x2F, 0xD0, 0x02, 0xFD, 0x2F, 0xD0,
-    0x3F, 0xFD, 0x2F, 0xE0, 0x3F, 0xFC, 0x2F, 0xE0, 0x3F, 0xF0, 0x1A, 0xA0, 0x2A, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0xFF, 0xF4, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xFD, 0x0B,
-    0xFF, 0xF4, 0xBD, 0x0F, 0xCB, 0xC0, 0x3C, 0xF8, 0x03, 0xCF, 0xC1, 0xBC, 0xFC, 0x3F, 0x8F, 0xC3,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x1F,
-    0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xE0,
-    0xFF, 0xFD, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xCF, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xBF, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xCF, 0xFD, 0xBF, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xD3, 0xFF, 0x4F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xE0, 0x3F, 0xF4, 0x0F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x0F, 0xFD, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xF8, 0x3F,
-    0x80, 0x07, 0xF0, 0xFF, 0xE2, 0xFC, 0x00, 0x0B, 0xE3, 0xFF, 0x4F, 0xD0, 0x00, 0x0F, 0xDB, 0xFD,
-    0xBF, 0x00, 0x00, 0x2F, 0xEF, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xCF, 0xE3, 0xFF, 0x00, 0x1F, 0xFC, 0x3F, 0x87, 0xFF, 0x02, 0xFF, 0xC0, 0xFE, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x06, 0xBF, 0x90, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x15, 0x02, 0xFD,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xF4, 0x02, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC8, 0x00, 0x1F,
-    0xF3, 0xE9, 0x6F, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xF9,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x06, 0xA0, 0x00, 0x1B, 0xF8,
-    0x0F, 0xFF, 0xC1, 0x00, 0xB4, 0x00, 0x1E, 0x00, 0x1F, 0x42, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x7E,
-    0x00, 0x0B, 0xCF, 0x9B, 0xF3, 0xFF, 0xF9, 0xFF, 0xFC, 0x2F, 0xF8, 0x02, 0xD0, 0x00, 0xFE, 0x00,
-    0x7F, 0xF0, 0x04, 0x7C, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x69, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x00,
-    0x03, 0xFC, 0x0B, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x07,
-    0xFC, 0x7F, 0xE0, 0x00, 0x07, 0xF8, 0xFF, 0xC0, 0x00, 0x0B, 0xFA, 0xFF, 0x40, 0x00, 0x0B, 0xFB,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xF7, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xFF, 0x40, 0x3F, 0xF0, 0x2F, 0xFF, 0xEA, 0x3F,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0B, 0xD0, 0xFD, 0x00, 0x2F, 0x4F, 0xE0, 0x00,
-    0xBC, 0x7F, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x0B, 0xEF, 0xF8, 0x00, 0x3F, 0x5F, 0xF8, 0x00, 0xFD, 0x2F, 0xF8, 0x03, 0xF4, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x07, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xFC, 0xBC, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0x2F, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xCB, 0xCB, 0xFF, 0x00, 0x00, 0x0F, 0xF3,
-    0xFB, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFC,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x3F, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xCA, 0x80, 0xFF, 0xFC, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x03, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x55, 0x40, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0xA8, 0x02, 0xF0, 0x00, 0xFE, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xCE,
-    0x3F, 0xC0, 0x03, 0xF7, 0xAF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F,
-    0xEF, 0xFF, 0x00, 0x07, 0xEB, 0xAF, 0xF0, 0x01, 0xFA, 0xE3, 0xFF, 0x00, 0x7E, 0x00, 0x3F, 0xF0,
-    0x2F, 0x80, 0x07, 0xFF, 0x0B, 0xE0, 0x00, 0xBF, 0xE0, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xD0,
-    0xBF, 0xE0, 0x0B, 0xFF, 0xF3, 0xFF, 0x00, 0x1B, 0xFE, 0x6F, 0xF4, 0x00, 0x0F, 0xF1, 0xFF, 0x80,
-    0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x01, 0xFE, 0x7F, 0xE0, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x02, 0xFF, 0x1F, 0xFF, 0xD0, 0x0B, 0xFC,
-    0x1F, 0xFF, 0xD0, 0x3F, 0xF0, 0x2F, 0xFF, 0xE0, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xCB, 0xF8, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xDF, 0xFE, 0x00, 0x03, 0xFC,
-    0xBF, 0xF8, 0x00, 0x3F, 0xC2, 0xFF, 0xF0, 0x03, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x01,
-    0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0x1F, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x1F, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x2F, 0xFF, 0xE0, 0x00,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0xFF, 0xFC, 0x2F, 0xC0, 0xFF, 0xFC, 0x3F, 0x40, 0x00, 0xFC, 0xBF,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFA, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x03, 0xFB, 0xFD, 0x00, 0x03, 0xF2, 0xFF, 0x40, 0x03, 0xF0, 0xFF, 0xE0, 0x03, 0xF0, 0x3F,
-    0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0,
-    0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xF5, 0x55, 0x7F, 0xF4, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x7F, 0xF0, 0x00, 0x3F, 0xF9,
-    0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xBF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E, 0x00, 0x2F, 0x47, 0xE0, 0x02, 0xF4,
-    0x7F, 0x00, 0x3F, 0x47, 0xF0, 0x03, 0xF4, 0x7F, 0x00, 0x3F, 0x47, 0xF0, 0x03, 0xF4, 0x7F, 0x00,
-    0x3F, 0x87, 0xF0, 0x03, 0xF8, 0xBF, 0xAA, 0xBF, 0x8B, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xFF, 0xF8, 0xBF, 0x00, 0x3F, 0xCB, 0xF0, 0x03, 0xFD, 0xBF, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x02, 0xE0, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x9F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F,
-    0xF9, 0x55, 0x6F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xEA, 0xBF, 0xC0, 0x00, 0x3F,
-    0x80, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x40, 0x0F, 0xFF,
-    0xD0, 0x7F, 0xDF, 0xF4, 0x00, 0xFF, 0xF0, 0x01, 0xFE, 0xFF, 0x40, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0x03, 0xFF, 0xEF, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xFC,
-    0xFF, 0x40, 0x0F, 0xFF, 0x03, 0xFF, 0x4A, 0xA4, 0x00, 0xAA, 0xA0, 0x2A, 0x40, 0x2A, 0xAA, 0xAA,
-    0xA4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x1B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0xFE, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x3F,
-    0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x2F, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xD0, 0x3F, 0xD0, 0x7F, 0x80, 0x7F,
-    0xC0, 0x3F, 0xC0, 0x07, 0xF0, 0x2F, 0xD0, 0x0F, 0xE0, 0x01, 0xFC, 0x0F, 0xF0, 0x07, 0xF4, 0x00,
-    0xFF, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x2F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x2F, 0xF5, 0x02, 0xFF, 0x00, 0xFF, 0xBF, 0xFF,
-    0xC0, 0x7F, 0xF8, 0x2F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x16, 0x90, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x54, 0x00, 0x03, 0xFF, 0xCB, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF4, 0xBE, 0x07, 0xF0, 0x3F, 0xC0, 0xFC, 0x03, 0xF0, 0x3F, 0x01, 0xF4, 0x03, 0xF0, 0x7F,
-    0x02, 0xF0, 0x03, 0xE0, 0x7E, 0x02, 0xF4, 0x0F, 0xD0, 0x7F, 0x02, 0xF4, 0x1F, 0xC0, 0x7F, 0x02,
-    0xFC, 0x7F, 0x90, 0x3F, 0x81, 0xFE, 0xFF, 0xF0, 0x3F, 0xE0, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x16, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0A, 0xBD,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF4, 0x0F, 0xF5, 0x18, 0x0B, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x2F, 0xF9, 0x74, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF4, 0x19, 0xFF, 0xE4, 0x07,
-    0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x69, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x55, 0x57, 0xFE, 0x55,
-    0x50, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xF5, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF,
-    0x40, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00,
-    0xFF, 0x80, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00,
-    0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0xFF, 0x0B, 0xF4, 0x03, 0xFC, 0x1F, 0xE0, 0x2F,
-    0xD0, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x47, 0xF8, 0x01, 0xFE, 0x2F, 0xD0, 0x03, 0xFC, 0xFF, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40,
-    0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x03, 0xFE, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0xFF,
-    0x80, 0x1F, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00,
-    0xFF, 0xEF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x55, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x1F, 0xE0, 0x07, 0xFC,
-    0x0B, 0xF4, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x07, 0xFC, 0xBF, 0x40, 0x00,
-    0xFF, 0x7F, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xCF, 0xFF, 0x00, 0x01, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x3F, 0xFD,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x03,
-    0xF0, 0x00, 0xFD, 0x2F, 0x80, 0x01, 0xFD, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0xFF, 0x3F, 0xC0, 0x0B, 0xF4, 0xBF, 0x80, 0x7F, 0x80, 0xFF, 0x03, 0xFC, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x55, 0x55, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xE0,
-    0x00, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x07,
-    0xF8, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xF4, 0x00,
-    0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xAA, 0xAA, 0xAB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFC, 0x7C, 0x07, 0xFF, 0xFF, 0x1F, 0x00, 0x03, 0xF0, 0x07,
-    0xC0, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x03, 0xF0,
-    0x07, 0xC0, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x0F, 0xD5, 0x6F, 0x50, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B,
-    0xF8, 0x2F, 0xE0, 0x02, 0xFE, 0x07, 0xF8, 0x00, 0xBF, 0x81, 0xFE, 0x00, 0x2F, 0xE0, 0x7F, 0x40,
-    0x07, 0xF8, 0x0F, 0xD0, 0x01, 0xFE, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0xFD, 0x00, 0x2F, 0xD0, 0x3F,
-    0x80, 0x0F, 0xF4, 0x0B, 0xF4, 0x1F, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xEF, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x90, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0xFE, 0xBD, 0x02, 0xF4, 0xBD, 0x02, 0xF4, 0xBD, 0x02, 0xF4, 0x7C, 0x01, 0xF4, 0x7C,
-    0x01, 0xF4, 0x7C, 0x02, 0xF4, 0x3E, 0x07, 0xF4, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x00, 0x02,
-    0xF4, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2A, 0x05, 0x00, 0x01, 0x41, 0xF8, 0x00, 0xBD,
-    0x2F, 0x40, 0x0B, 0xD2, 0xF0, 0x00, 0xFD, 0x2F, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0xFE, 0x3E, 0x3E,
-    0x0F, 0xE3, 0xE3, 0xE0, 0xFE, 0x3F, 0x3E, 0x2F, 0xE3, 0xFB, 0xE7, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFB, 0xE0, 0x1F, 0xF8, 0x7E, 0x00, 0x3E, 0x07, 0xF0, 0x03, 0xE0,
-    0x7F, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x24, 0x01, 0x47, 0x80,
-    0x7C, 0x74, 0x07, 0xC7, 0x40, 0x7C, 0xB3, 0xC7, 0xCB, 0x3C, 0xBC, 0xBB, 0xDF, 0xC7, 0xFF, 0xFC,
-    0x3F, 0xFB, 0xC0, 0x7D, 0x3C, 0x03, 0xC3, 0xC0, 0x28, 0x3C, 0x00, 0x03, 0xC0, 0x2A, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF4, 0xBF, 0xE0, 0x1F, 0xE2, 0xFF, 0x00,
-    0x2F, 0xCB, 0xF4, 0x00, 0x7F, 0x2F, 0xD0, 0x01, 0xFC, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x2F,
-    0xCB, 0xF4, 0x00, 0xBF, 0x6F, 0xE0, 0x02, 0xFD, 0xBF, 0x80, 0x0F, 0xF9, 0xAA, 0x00, 0x2A, 0x90,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE7, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xF9, 0x0B, 0xF0, 0x1F, 0xF0, 0x03, 0xF4, 0x1F, 0xE0, 0x02, 0xF8,
-    0x2F, 0xD0, 0x02, 0xF8, 0x2F, 0xD0, 0x02, 0xF8, 0x2F, 0xD0, 0x02, 0xF8, 0x3F, 0xD0, 0x03, 0xFC,
-    0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xE0, 0x03, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0xD0, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x7F, 0xC0,
-    0x03, 0xFD, 0x05, 0x5B, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xAA, 0xAF, 0xFF, 0xFF, 0xFE,
-    0xA4, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1C, 0x00, 0x00, 0x07,
-    0xFF, 0xF9, 0x46, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xD6, 0xF8, 0x3F, 0x00, 0xBE, 0x00, 0xBC, 0x3F, 0xAA, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFD, 0x50, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x06, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xF0,
-    0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xF4, 0x3F, 0xD0, 0x03, 0xFE, 0x05, 0x57, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x01, 0xAA, 0xAF, 0xFF, 0xFF, 0xFE, 0xA4, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x45, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x6F, 0x80, 0xFC, 0x02, 0xF8, 0x02,
-    0xF0, 0x3F, 0xAA, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xF5, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x01,
-    0x80, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0x8B, 0xF8, 0xBF, 0x8B, 0xF8, 0xBF, 0x87, 0xF8, 0x7F,
-    0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB,
-    0xFC, 0xFF, 0xDF, 0xFD, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0xE0,
-    0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x3F, 0xFD, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE2, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xD7, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xFC, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xE7, 0xFF, 0x3F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x2F, 0xFC, 0x7F, 0xFF, 0x80, 0x0F, 0xFF,
-    0xF0, 0xBF, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA9,
-    0x02, 0xAA, 0x80, 0x6A, 0x80, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x3F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x4B, 0xFD, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x4F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFB, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x7F,
-    0xFE, 0x00, 0x1F, 0xFF, 0xD3, 0xFF, 0xCB, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0xFF, 0xF0, 0xBF, 0xFF,
-    0x40, 0x0B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF0, 0x3F, 0xE0, 0x0F, 0xF0, 0xBF, 0xC0, 0x0F, 0xE1, 0xFF,
-    0x40, 0x0F, 0xE3, 0xFE, 0x00, 0x0F, 0xE7, 0xFC, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x7F, 0xF4, 0x3F, 0xD0, 0x0F, 0xFC, 0x3F, 0xD0, 0x03,
-    0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x3F, 0xD0, 0x02, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x6A, 0x80, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x40, 0xF8, 0x3F, 0x03, 0xE3,
-    0xF4, 0x0F, 0x9F, 0xC0, 0x3E, 0xFC, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
-    0xFF, 0x02, 0xF9, 0xFF, 0x0B, 0xD0, 0x7F, 0x2F, 0x40, 0xFC, 0xFD, 0x02, 0xF7, 0xF0, 0x0B, 0xC0,
-    0x00, 0x7F, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFA, 0xFF,
-    0xC0, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x07, 0xFC,
-    0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x07, 0xFE, 0x02, 0xFF, 0xF0, 0xBF,
-    0xF4, 0x0B, 0xFF, 0x83, 0xFF, 0xC0, 0x2F, 0xFD, 0x0F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0xAF, 0xD0, 0x0F,
-    0xC2, 0xF4, 0x03, 0xF0, 0xBD, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0x0B, 0xD0, 0x0F, 0xC2, 0xF4, 0x03,
-    0xE0, 0xFD, 0x01, 0xF8, 0x3F, 0x40, 0x7E, 0x0F, 0xD0, 0x2F, 0x43, 0xFE, 0x3F, 0xD0, 0xFF, 0x4F,
-    0xE0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x3F,
-    0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x3F, 0xE0,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0xBF,
-    0xD0, 0x00, 0x7F, 0xE0, 0xBF, 0xE5, 0x55, 0xBF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0xFF, 0xE0, 0x00, 0xBF, 0xFC, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFD, 0xFF, 0xE0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x7E,
-    0x03, 0xF0, 0x01, 0xFC, 0x0F, 0xC0, 0x07, 0xF0, 0x3F, 0x40, 0x1F, 0xC0, 0xFD, 0x00, 0x7F, 0x03,
-    0xF4, 0x01, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x3F, 0xEA, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0x80, 0x2F, 0xD0, 0xFE, 0x00, 0xBF, 0xC3, 0xF8, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x3F,
-    0xE0, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0xBF, 0xE5, 0x55, 0xBF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0xFF, 0xE0,
-    0x00, 0xBF, 0xF0, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0xFF, 0xE0, 0x00, 0xBF, 0xFA, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x7F, 0x03, 0xF0, 0x01, 0xFC,
-    0x0F, 0xD0, 0x07, 0xF0, 0x3F, 0x40, 0x1F, 0xC0, 0xFD, 0x00, 0x7F, 0x03, 0xF4, 0x01, 0xFC, 0x0F,
-    0xD0, 0x07, 0xF0, 0x3F, 0xEA, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0x80, 0x2F, 0xC0, 0xFE, 0x00, 0xBF, 0x43, 0xF8, 0x02, 0xFE, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x15, 0x40, 0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xBF, 0x9F,
-    0xE0, 0x02, 0xFE, 0x7F, 0x40, 0x0B, 0xF5, 0xFD, 0x00, 0x1F, 0xD3, 0xF4, 0x00, 0x7F, 0x4F, 0xD0,
-    0x02, 0xFD, 0x3F, 0x80, 0x0F, 0xF4, 0xBF, 0x41, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xEF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x01,
-    0x43, 0xC0, 0x3C, 0x78, 0x07, 0xC7, 0x40, 0x7C, 0x74, 0x07, 0xCB, 0x40, 0xBC, 0x7C, 0x1F, 0xC7,
-    0xFF, 0xFC, 0x2F, 0xFB, 0xC0, 0x69, 0x3C, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x15, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F,
-    0xF8, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFF,
-    0x40, 0x7F, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x7F, 0xFF, 0x80,
-    0x7F, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xD0, 0xFF, 0xFF, 0x40, 0xBF,
-    0xBF, 0xF2, 0xFF, 0xFF, 0x80, 0xBF, 0xAF, 0xF7, 0xFE, 0xFF, 0x80, 0xBF, 0x9F, 0xFF, 0xFD, 0xFF,
-    0x80, 0xBF, 0xCF, 0xFF, 0xFC, 0xFF, 0x80, 0xBF, 0xCB, 0xFF, 0xF8, 0xFF, 0x80, 0xBF, 0xC3, 0xFF,
-    0xF5, 0xFF, 0xC0, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0xE1, 0xFF, 0xC0, 0xFF,
-    0xC0, 0xFF, 0xD2, 0xFF, 0xC0, 0xFF, 0xD0, 0xBF, 0xC2, 0xFF, 0xC0, 0xFF, 0xD0, 0x7F, 0xC3, 0xFF,
-    0xC0, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xC0, 0x03,
-    0xF4, 0x0F, 0xF4, 0x01, 0xFE, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0xE0, 0x3F, 0xF8,
-    0x2F, 0xF8, 0x0F, 0xFF, 0x0F, 0xFE, 0x03, 0xFF, 0xD7, 0xFF, 0x80, 0xFE, 0xFE, 0xFB, 0xF0, 0x3F,
-    0x7F, 0xFD, 0xFC, 0x0F, 0xCF, 0xFE, 0x7F, 0x03, 0xF2, 0xFF, 0x6F, 0xC0, 0xFC, 0x3F, 0xCB, 0xF0,
-    0x3F, 0x4F, 0xF3, 0xFC, 0x0F, 0xD2, 0xF8, 0xFF, 0x03, 0xF4, 0x14, 0x3F, 0xC0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x2F, 0xCB, 0xF6, 0xFD, 0xBF, 0x6F, 0xDB, 0xF6,
-    0xFD, 0xBF, 0x5F, 0xD7, 0xF5, 0xFE, 0x7F, 0x9F, 0xE7, 0xF9, 0xFE, 0x7F, 0x8F, 0xE3, 0xF8, 0x00,
-    0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xF8, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xF4, 0x1F, 0xF0, 0x1F, 0x80, 0x2F, 0xD0,
-    0xFC, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0xFE, 0x0F, 0x80, 0x03, 0xF8, 0x3D, 0x00, 0x0B, 0xF0, 0xF4,
-    0x00, 0x2F, 0xC3, 0xE0, 0x00, 0xFF, 0x0F, 0xFA, 0xBF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x40, 0x2F, 0xE4, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x9F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF4,
-    0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F,
-    0xE0, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40,
-    0x00, 0x1F, 0xFC, 0x2F, 0xD0, 0xBF, 0x00, 0xBF, 0x43, 0xFD, 0x03, 0xFE, 0x0F, 0xF4, 0x0F, 0xF8,
-    0x7F, 0xE0, 0x7F, 0xF1, 0xFF, 0x80, 0x55, 0x45, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xF4, 0x1F, 0xF0,
-    0x1F, 0x80, 0x2F, 0xD0, 0xFC, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0xFE, 0x0F, 0x80, 0x03, 0xF8, 0x3D,
-    0x00, 0x0B, 0xF0, 0xF4, 0x00, 0x2F, 0xC3, 0xE0, 0x00, 0xFF, 0x0F, 0xFA, 0xBF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x40, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x2A, 0xAB, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xDF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x07, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x0F, 0xF0,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0x90, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0xAF, 0x90, 0x00, 0x3F, 0xFF, 0xFD, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xAF, 0xE0, 0x0F, 0xD0, 0x7F, 0xFE, 0x00, 0xFC, 0x07, 0xE0, 0x0B, 0xFF,
-    0x05, 0x6F, 0x83, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0x02, 0xFE, 0x95, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xFF, 0xFF, 0x90, 0x1B, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0x90, 0x01, 0xBF, 0xE4, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x0F, 0xFE, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0xA8,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE5, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xE0, 0x0B, 0xD0, 0x2F, 0xFA, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFA, 0xFF, 0x00, 0xFE, 0x00, 0xBD, 0x07, 0xF4, 0x55, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xE9, 0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xD4, 0x1B, 0x43, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0xC0, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x79, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x00, 0xFF, 0x42, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8,
-    0x1F, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0xFE, 0x16, 0xAB, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0x07, 0xFA,
-    0xA7, 0xFC, 0x0F, 0xC0, 0x1F, 0xD0, 0x1F, 0xEA, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x01, 0xFE,
-    0x1F, 0xE0, 0x00, 0x2F, 0xE2, 0xFE, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x79, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x00, 0xFF, 0x42, 0xFC, 0x00, 0x2F,
-    0xF0, 0x0F, 0xF8, 0x1F, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x03,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0xE0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0x16, 0xAB, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0x0B, 0xFA, 0xA7, 0xFC, 0x0F, 0xC0, 0x1F, 0xD0, 0x2F, 0xEA, 0xFE, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x1B, 0xF9, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x1F, 0xD1, 0xFD, 0x00, 0xBF, 0x8B, 0xF8, 0x02,
-    0xFE, 0x2F, 0xE0, 0x0B, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F,
-    0xFF, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0xBF, 0xFC, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC2, 0xFF,
-    0xE0, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x47, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xFD,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xF5, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xCF,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0x3F, 0xF7, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF1, 0xFF, 0xD3, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0x47, 0xFF, 0x43, 0xFF, 0xFC, 0x0F, 0xFF, 0xF4, 0x1F, 0xFE, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF5,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x0A, 0xAA, 0x02, 0xAA, 0x00, 0x02,
-    0xFF, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x07, 0xFD,
-    0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xC7, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xF9, 0xFF,
-    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFD, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x4F, 0xFF,
-    0x2F, 0xFF, 0xC0, 0xBF, 0xFF, 0x43, 0xFF, 0xC2, 0xFF, 0xFD, 0x1F, 0xC1, 0xFC, 0x0B, 0xF0, 0xBF,
-    0x03, 0xFD, 0x3F, 0xD0, 0xFF, 0x4F, 0xF4, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE,
-    0x40, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x54, 0x0B, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x7F, 0xCF, 0xA5, 0xBF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xE4, 0x00, 0x2F, 0x82, 0xF8, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x03, 0xFF, 0xF0, 0x01, 0x00, 0xB4, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF4,
-    0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0x96, 0xFC, 0x03,
-    0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xD0, 0x24, 0x0B, 0xF4, 0x3F, 0x9B, 0xFD, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x1A, 0xFF,
-    0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x7D, 0x1F, 0xF4, 0xBF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0x3F, 0xF4, 0xFF, 0x40, 0x0B,
-    0xFF, 0x4B, 0xF4, 0x00, 0xFF, 0xF4, 0xBF, 0x40, 0x1F, 0xFF, 0x8B, 0xF4, 0x03, 0xFF, 0xF8, 0xBF,
-    0x80, 0x7F, 0xFF, 0x87, 0xF8, 0x0F, 0xFF, 0xFC, 0x7F, 0x81, 0xFE, 0xFF, 0xC7, 0xFC, 0x3F, 0xDF,
-    0xFC, 0x7F, 0xC7, 0xFC, 0xFF, 0xC7, 0xFC, 0xFF, 0x4F, 0xFC, 0x3F, 0xDF, 0xF0, 0xFF, 0xC3, 0xFF,
-    0xFE, 0x0F, 0xFD, 0x3F, 0xFF, 0xC0, 0xFF, 0xD3, 0xFF, 0xF8, 0x0F, 0xFD, 0x3F, 0xFF, 0x40, 0xFF,
-    0xE3, 0xFF, 0xF0, 0x1F, 0xFE, 0x3F, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFF, 0x05, 0x6A,
-    0xBF, 0x40, 0xBF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x1E, 0xAA, 0xA5, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xF2,
-    0xFC, 0x00, 0xFF, 0xCB, 0xF0, 0x07, 0xFF, 0x2F, 0xC0, 0x3F, 0xFC, 0xBF, 0x03, 0xFF, 0xF2, 0xFC,
-    0x1F, 0xFF, 0xCB, 0xF0, 0xFF, 0x7F, 0x2F, 0xCB, 0xF5, 0xFC, 0xBF, 0x7F, 0xC7, 0xF2, 0xFF, 0xFC,
-    0x1F, 0xDB, 0xFF, 0xE0, 0xBF, 0x6F, 0xFF, 0x02, 0xFD, 0xBF, 0xF4, 0x0B, 0xF6, 0xFF, 0x80, 0x2F,
-    0xDB, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x7F, 0x47, 0xF4,
-    0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x00,
-    0x03, 0xFF, 0x4F, 0xF4, 0x00, 0xBF, 0xF4, 0xBF, 0x40, 0x0F, 0xFF, 0x4B, 0xF4, 0x01, 0xFF, 0xF8,
-    0xBF, 0x40, 0x3F, 0xFF, 0x8B, 0xF8, 0x07, 0xFF, 0xF8, 0x7F, 0x80, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F,
-    0xEF, 0xFC, 0x7F, 0xC3, 0xFD, 0xFF, 0xC7, 0xFC, 0x7F, 0xCF, 0xFC, 0x7F, 0xCF, 0xF4, 0xFF, 0xC3,
-    0xFD, 0xFF, 0x0F, 0xFC, 0x3F, 0xFF, 0xE0, 0xFF, 0xD3, 0xFF, 0xFC, 0x0F, 0xFD, 0x3F, 0xFF, 0x80,
-    0xFF, 0xD3, 0xFF, 0xF4, 0x0F, 0xFE, 0x3F, 0xFF, 0x01, 0xFF, 0xE3, 0xFF, 0xD0, 0x1F, 0xFE, 0x3F,
-    0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xF0, 0x7F, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0xBF, 0x4B, 0xF4, 0x03,
-    0xFE, 0x3F, 0xE0, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x03, 0xFC, 0xBF, 0x00, 0x3F, 0xF2, 0xFC, 0x01, 0xFF, 0xCB, 0xF0, 0x0F, 0xFF, 0x2F, 0xC0, 0xFF,
-    0xFC, 0xBF, 0x07, 0xFF, 0xF2, 0xFC, 0x3F, 0xDF, 0xCB, 0xF2, 0xFD, 0x7F, 0x2F, 0xDF, 0xF1, 0xFC,
-    0xBF, 0xFF, 0x07, 0xF6, 0xFF, 0xF8, 0x2F, 0xDB, 0xFF, 0xC0, 0xBF, 0x6F, 0xFD, 0x02, 0xFD, 0xBF,
-    0xE0, 0x0B, 0xF6, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00,
-    0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFE, 0x6F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F,
-    0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xCF, 0xF4, 0x00, 0x00, 0x0F, 0xF7, 0xFE,
-    0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xCB, 0xFE,
-    0x00, 0x00, 0x7F, 0xF2, 0xFF, 0xF9, 0x45, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC1,
-    0xFC, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x3F, 0xD3,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x0B, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0xE0,
-    0x00, 0xFE, 0x0F, 0xE0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0xFE, 0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0xF8,
-    0x07, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x7F, 0xF0,
-    0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFD, 0x00, 0x07, 0xFF, 0x3F,
-    0xF8, 0x00, 0x3F, 0xF8, 0xBF, 0xFE, 0x5B, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0xFF, 0x00, 0x1F, 0xD3, 0xF8, 0x55, 0xBF, 0x4F,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0x00, 0x1F, 0xE3, 0xFE, 0x01, 0xFF, 0x4B, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1B, 0xFD,
-    0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x7F,
-    0xF0, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x07, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFD, 0x00, 0x07, 0xFF,
-    0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0xBF, 0xFE, 0x5B, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xE0, 0xFE, 0x00, 0x7F, 0xC7,
-    0xFC, 0x01, 0xFF, 0x1F, 0xF0, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0x42, 0xFE, 0x0B,
-    0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF4, 0xFE, 0x15, 0x6F, 0xD3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x83,
-    0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF1, 0xFF, 0x00,
-    0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xD0, 0x2F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0xFE, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0xBF,
-    0xF4, 0x00, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03,
-    0xFC, 0x3F, 0xC0, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x03, 0xFF, 0xFF,
-    0x40, 0x3D, 0x01, 0xFD, 0x01, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x01,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xC1, 0x00, 0x03, 0xF8, 0x3D, 0x01, 0xFF,
-    0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF4, 0x00, 0x6F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x01, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x1F, 0xE0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0x2F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x01,
-    0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xE1, 0xFD, 0x00, 0x0B, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA0, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x07,
-    0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xFD, 0x03, 0xFC,
-    0x00, 0x7F, 0xC0, 0xFE, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x05,
-    0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x0B, 0xF4,
-    0xBF, 0x40, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x0B, 0xF0, 0x7F, 0x80, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0xFE, 0x01, 0xFF, 0x00, 0xBF,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x07, 0xFC, 0x0F, 0xE0, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x1F, 0xF3,
-    0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0xFF,
-    0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC,
-    0x1F, 0xE0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0xC0, 0x2F, 0xC0, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x01, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xE2, 0xFC, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x15, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x15, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4,
-    0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x6A,
-    0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x1F,
-    0xD0, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x47,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x00, 0x2F, 0xE0,
-    0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F,
-    0xD0, 0x00, 0x07, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x0B, 0xF0, 0x0B, 0xF4, 0xBF, 0x40,
-    0xFF, 0x4F, 0xF4, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x41, 0xF4, 0x00,
-    0xBD, 0x2F, 0x40, 0x0B, 0xD2, 0xF0, 0x00, 0xFD, 0x2F, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0xFE, 0x3E,
-    0x00, 0x0F, 0xE3, 0xE0, 0x00, 0xFE, 0x3F, 0x00, 0x2F, 0xE3, 0xF8, 0x07, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFB, 0xE0, 0x1B, 0xF8, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF4,
-    0x3F, 0x83, 0xF8, 0x7F, 0x87, 0xF8, 0xBF, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0xA0, 0x1E, 0x01, 0xF0, 0x1D, 0x01, 0xF0, 0x1D, 0x01, 0xF0, 0x2C, 0x01, 0xF0, 0x2C, 0x02,
-    0xF0, 0x2E, 0x07, 0xF0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFE, 0xF0, 0x01, 0x94, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xF5, 0x55, 0x54, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1A, 0xBE, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x15, 0x55, 0x50,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x4B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xBD, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD2,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xFF, 0xE4, 0x00,
-    0x00, 0xFF, 0x4B, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xD2, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0xBE,
-    0x01, 0xFF, 0x00, 0x03, 0xFE, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFF, 0x8B, 0xE0, 0x03, 0xF8, 0x00,
-    0x3F, 0xE2, 0xF8, 0x02, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xAB, 0xFF, 0x40, 0x03, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xCB, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0xFE, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x03, 0xFC, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00,
-    0x7F, 0xC7, 0xFC, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x18, 0x00, 0x00, 0x03, 0xF0, 0xF0,
-    0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00,
-    0x03, 0xF0, 0xF4, 0x00, 0x00, 0x0F, 0xC3, 0xFF, 0xF4, 0x00, 0x3F, 0x0F, 0xFF, 0xF4, 0x00, 0xFD,
-    0x3D, 0x07, 0xF0, 0x03, 0xF4, 0xF4, 0x0B, 0xC0, 0x0F, 0xD3, 0xD0, 0x3F, 0x00, 0x3F, 0x8F, 0xEB,
-    0xFC, 0x00, 0xFE, 0x3F, 0xFF, 0xD0, 0x03, 0xF8, 0xFF, 0xF9, 0x00, 0x0F, 0xE0, 0x2F, 0xE0, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0xC0, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x9F, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFD, 0x07, 0xFF, 0x48, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0xF8,
-    0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x02, 0xF4, 0x03, 0xF0, 0x00,
-    0x3F, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0xD8, 0x03, 0xFC,
-    0x0B, 0xFF, 0x83, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x1F, 0xC0,
-    0x3F, 0x07, 0xE0, 0x0F, 0xC1, 0xF8, 0x03, 0xF0, 0x7E, 0x00, 0xFC, 0x1F, 0x80, 0x3F, 0x07, 0xE0,
-    0x0F, 0xC2, 0xF8, 0x07, 0xF0, 0xBE, 0x01, 0xFC, 0x2F, 0x80, 0x7E, 0x0B, 0xD0, 0x1F, 0x82, 0xF4,
-    0x07, 0xE0, 0xBD, 0x01, 0xF8, 0x2F, 0x40, 0x7E, 0x0B, 0xD0, 0x1F, 0x83, 0xF4, 0x0B, 0xE0, 0xFD,
-    0x02, 0xF8, 0x3F, 0x40, 0xBD, 0x0F, 0xC0, 0x2F, 0x43, 0xF0, 0x0B, 0xD0, 0xFC, 0x02, 0xF4, 0x3F,
-    0x00, 0xBD, 0x0F, 0xC0, 0x2F, 0x42, 0xA0, 0x06, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0xBF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF,
-    0x00, 0xBF, 0xE0, 0x1F, 0xFC, 0x02, 0xAA, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x2F,
-    0xF4, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x2A, 0x90, 0x00, 0x1F, 0xFE, 0x1F,
-    0xFD, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0xBF, 0xE0, 0x6A, 0x80, 0x7F,
-    0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0xBF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x1F,
-    0xFC, 0x02, 0xAA, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0x82, 0xFF,
-    0x80, 0xBF, 0xE0, 0x7F, 0xE0, 0x0F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE0,
-    0x7F, 0xE0, 0x1F, 0xFC, 0x0F, 0xFC, 0x02, 0xAA, 0x01, 0xAA, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0x43,
-    0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0xE0, 0xBF, 0xE0, 0x2F, 0xF4, 0x2F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x07, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xD0, 0x2A, 0x90, 0x2A,
-    0xA0, 0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x3F, 0xF0,
-    0xBF, 0xE0, 0x6A, 0x80, 0x7F, 0xF8, 0x3F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0x82, 0xFF,
-    0x80, 0xBF, 0xE0, 0x7F, 0xE0, 0x0F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE0,
-    0x7F, 0xE0, 0x1F, 0xFC, 0x0F, 0xFC, 0x02, 0xAA, 0x01, 0xAA, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xF5, 0xA0, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFC, 0x15,
-    0x5B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x55, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0x50, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF9,
-    0x54, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE,
-    0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0x0F, 0xFF, 0x43, 0xFD, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x7F, 0x82, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x05, 0x40, 0x7F, 0x82, 0xFF, 0x0F,
-    0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 0x2F, 0xD0, 0x0F, 0xF0, 0x0B,
-    0xF4, 0x3F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF8, 0x3F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF8, 0x3F, 0xF0, 0x1F,
-    0xF8, 0x0F, 0xFC, 0x7F, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0xBD, 0xBD, 0xBD, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0B, 0xE0, 0x03, 0x4C, 0x00, 0x3F, 0x00, 0x1E,
-    0xB4, 0x03, 0xF4, 0x00, 0x76, 0xE0, 0x1F, 0xC0, 0x01, 0xD3, 0x40, 0xFD, 0x00, 0x03, 0xFC, 0x0B,
-    0xF0, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0x80, 0x60, 0x00, 0xFE, 0x18, 0xC6, 0x60, 0x0F, 0xF0, 0xAB,
-    0x2A, 0xC0, 0x7F, 0x82, 0xAC, 0xEB, 0x03, 0xFC, 0x0B, 0xF2, 0xFC, 0x2F, 0xD0, 0x0F, 0x43, 0xD0,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xD0, 0x3F, 0xF0, 0x0F, 0xFC,
-    0x07, 0xFE, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x2A, 0x90, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0x43, 0xFF,
-    0xC2, 0xFF, 0xC0, 0xFF, 0xD0, 0xBF, 0xE0, 0x3F, 0xF0, 0x2F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x07,
-    0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xD0, 0x2A, 0x90, 0x2A, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0xBC, 0x03, 0xFC, 0x1F, 0xD0, 0xFE,
-    0x07, 0xF4, 0x3F, 0xC2, 0xFC, 0x0F, 0xE0, 0x7F, 0x07, 0xF4, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x2E,
-    0x00, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xF0, 0x0F, 0xE0,
-    0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0xC0, 0x7F, 0x5F, 0xE0,
-    0x3F, 0xCF, 0xF0, 0x1F, 0xD3, 0xF8, 0x07, 0xF1, 0xFC, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xF4, 0x0B, 0xC0, 0x3F, 0xC3, 0xFC, 0x1F, 0xE0, 0x2F, 0xD1,
-    0xFE, 0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x03, 0xF8, 0x03, 0xF4, 0x2F, 0x81, 0xFC, 0x00, 0xF4, 0x0B,
-    0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0xF4, 0xFF, 0x82, 0xA9, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x2F, 0x00, 0xBF, 0x03, 0xFD, 0x0F, 0xF0, 0x3F, 0x80, 0x7F, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC,
-    0x03, 0xFE, 0x00, 0xFD, 0x00, 0x2C, 0x00, 0x08, 0x00, 0x00, 0xA0, 0x00, 0x7C, 0x00, 0x7F, 0x00,
-    0x2F, 0xD0, 0x0B, 0xF8, 0x01, 0xFD, 0x01, 0xFF, 0x07, 0xFD, 0x2F, 0xF4, 0x3F, 0xD0, 0x3F, 0x40,
-    0x2C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFF, 0x41, 0xFF, 0xC0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x55, 0x47, 0xFF, 0x40, 0x00, 0xBF,
-    0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x41,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xD7, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xF0, 0xBF, 0xFF, 0xFE, 0x07, 0xF4, 0x1F, 0xF0, 0x2F, 0xFF, 0xFC, 0x0B, 0xF8, 0x1F,
-    0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xF8, 0x2F, 0xF0, 0x0F, 0xFF, 0xD0, 0x0F, 0xFC, 0x3F, 0xF4, 0x2F,
-    0xFF, 0xF0, 0x0F, 0xFC, 0x15, 0x50, 0xBF, 0xFF, 0xFC, 0x05, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0x83, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xD0, 0x02, 0xF4, 0x02, 0xF8, 0x03, 0xF8,
-    0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF4, 0x07, 0xF4, 0x07, 0xF4, 0x0B, 0xF4,
-    0x0B, 0xF4, 0x0B, 0xF4, 0x0F, 0xF4, 0x02, 0xF0, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x2F, 0xFC, 0x3F, 0xFC,
-    0x3F, 0xFD, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xDF, 0xFF, 0xF4,
-    0x0E, 0x0F, 0xF3, 0xF8, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x0F, 0xE2, 0xFC,
-    0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x1F, 0xEB, 0xF8, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x1A,
-    0x94, 0x1A, 0x4B, 0xF0, 0x0F, 0xC1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x00, 0xF7, 0xDF, 0x00, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xEF, 0x40, 0x00,
-    0x06, 0x3C, 0x21, 0x00, 0x00, 0xB3, 0xD1, 0xF0, 0x81, 0x1F, 0x1F, 0x9F, 0x7C, 0x3E, 0xFB, 0xFF,
-    0xFF, 0x47, 0xFF, 0xF5, 0xBF, 0xD0, 0x07, 0xFD, 0x1F, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0x7C, 0x3D,
-    0xF7, 0xE8, 0xF0, 0x00, 0x4F, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x3F, 0xF9, 0x5F, 0xF0, 0xBF, 0xE5,
-    0x7F, 0xE0, 0x3D, 0x00, 0x1F, 0xE0, 0xF8, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x3F, 0xC0, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0E, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x3F, 0xF5, 0x6F, 0xF0, 0x00, 0x1F, 0xC1, 0xF4, 0x00, 0xBF,
-    0x40, 0x01, 0xFC, 0x08, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
-    0x80, 0x00, 0x1B, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x01, 0xFF,
-    0xE0, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x02,
-    0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x2F,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x06, 0xFE, 0x40, 0x00, 0x2D, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xEF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFD, 0x5B, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x60, 0x00, 0x0F,
-    0xE0, 0x0F, 0xD0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x07, 0xF8, 0x0B, 0xF4, 0x00, 0x07, 0xFC,
-    0x02, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xBF, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x00,
-    0x0F, 0xF0, 0x07, 0xFD, 0x00, 0x00, 0xBC, 0x01, 0xFF, 0x00, 0x00, 0x07, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x01, 0x54, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xD0, 0x00, 0x2F,
-    0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0xC0, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x55, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x2F, 0xF0, 0x0F,
-    0xD0, 0x00, 0xBF, 0xC0, 0xBF, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x01, 0xFE, 0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0xFE,
-    0x00, 0xFF, 0xD0, 0x0B, 0xF4, 0x01, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1E, 0x38, 0x2C, 0x1C, 0x3D, 0xDD, 0x3E, 0xDD, 0x3D,
-    0xDD, 0x3D, 0x3D, 0x2F, 0xFC, 0x0F, 0xF8, 0x02, 0x90, 0x00, 0x10, 0x00, 0xB4, 0x01, 0xF4, 0x03,
-    0xB8, 0x0E, 0x38, 0x2E, 0xBD, 0x3F, 0xFE, 0x00, 0x7C, 0x00, 0x7C, 0x5A, 0x92, 0xFF, 0xCB, 0x00,
-    0x2C, 0x00, 0xBF, 0x82, 0xAB, 0xC0, 0x0B, 0x58, 0x3D, 0xBF, 0xF3, 0xFF, 0x81, 0x50, 0x00, 0x06,
-    0xA0, 0xBF, 0xC7, 0x40, 0x2D, 0x90, 0xFF, 0xF3, 0xE2, 0xEF, 0x03, 0xBD, 0x1E, 0x7F, 0xF4, 0x6E,
-    0x40, 0x00, 0x03, 0xFF, 0xFA, 0xAF, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xBC, 0x03,
-    0xF0, 0x0F, 0x80, 0x69, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xD2, 0xD0, 0x78, 0xB4, 0x0B, 0xFC,
-    0x03, 0xEF, 0x43, 0xC0, 0xF0, 0xF4, 0x7C, 0x2F, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x0F, 0xF8, 0x2C, 0x1D, 0x34, 0x0F, 0x38, 0x0F, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0x0E, 0x2F, 0xFD,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xE4, 0x00, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x1F, 0xF0, 0x7F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0x0B, 0xF0,
-    0x00, 0xFD, 0x2F, 0xC0, 0x03, 0xF4, 0xBF, 0x00, 0x1F, 0xE3, 0xFD, 0x00, 0x7F, 0x8F, 0xF4, 0x02,
-    0xFE, 0x3F, 0xD0, 0x0B, 0xF8, 0xFF, 0x80, 0x2F, 0xF3, 0xFE, 0x00, 0xFF, 0xCF, 0xF8, 0x03, 0xFF,
-    0x1F, 0xC0, 0xE2, 0xCB, 0x03, 0x7D, 0xCE, 0xF7, 0x7B, 0xDD, 0xEF, 0x4B, 0xAF, 0xFD, 0x3F, 0xF0,
-    0x7F, 0x00, 0x0A, 0x00, 0xFC, 0x07, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-    0xFF, 0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0x82, 0xFF, 0xC9, 0x0B, 0x40, 0x1E, 0x00, 0xB8, 0x07,
-    0xC0, 0xBE, 0x0F, 0xE0, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x41, 0xFF, 0xC0, 0x07, 0x40,
-    0x1D, 0x1F, 0xF0, 0x6F, 0xD0, 0x07, 0x9E, 0xBE, 0xBF, 0xF6, 0xFF, 0x80, 0x00, 0xE0, 0x02, 0xF0,
-    0x07, 0xF0, 0x0D, 0xF0, 0x3C, 0xF0, 0xB9, 0xF8, 0xFF, 0xFC, 0x55, 0xF4, 0x00, 0xF0, 0x00, 0xF0,
-    0x55, 0x52, 0xFF, 0xCB, 0x00, 0x2C, 0x00, 0xFF, 0x82, 0xAB, 0xC0, 0x0B, 0x69, 0xBC, 0xFF, 0xF2,
-    0xFE, 0x00, 0x06, 0xA4, 0xBF, 0xD7, 0x40, 0x2D, 0x90, 0xFF, 0xF3, 0xE1, 0xEF, 0x03, 0xED, 0x0F,
-    0x7F, 0xF8, 0x7F, 0x80, 0xAA, 0xAB, 0xFF, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0xF4, 0x03, 0xC0, 0x2F,
-    0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xDB, 0x41, 0xD0, 0xE0, 0x78,
-    0xB8, 0x0B, 0xFC, 0x03, 0xFF, 0x43, 0xD0, 0xF0, 0xF4, 0x7C, 0x2F, 0xFF, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x3F, 0xF0, 0xB0, 0x78, 0xE0, 0x3C, 0xE0, 0x3C, 0x7F, 0xFC, 0x1F, 0xFC, 0x00,
-    0x3C, 0xBF, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00,
-    0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x00,
-    0xBC, 0x3E, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x1F, 0x4B, 0xC0,
-    0x00, 0x01, 0xF0, 0xFC, 0x00, 0x00, 0x7F, 0xDF, 0xD0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xBF, 0xC0, 0x3F, 0xFF, 0xC3, 0xE4, 0x0B,
-    0xFF, 0xFC, 0x7D, 0x00, 0xFF, 0xDF, 0x8B, 0xC0, 0x1F, 0xFC, 0xF8, 0xBC, 0x02, 0xFF, 0x9F, 0x4F,
-    0xC0, 0x3F, 0xF6, 0xF0, 0xF8, 0x03, 0xFF, 0x7F, 0x1F, 0x40, 0x3F, 0xF7, 0xE1, 0xF0, 0x03, 0xFF,
-    0xFE, 0x2F, 0x00, 0x3F, 0xFF, 0xD3, 0xF0, 0x02, 0xFF, 0xFE, 0x7F, 0xBC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x00, 0x7D, 0x3F, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x68, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFA, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0xBE, 0xBC, 0x3F, 0xF4, 0x0B, 0xFF, 0xC3, 0xFF, 0x40, 0xBF, 0xE8, 0x3F, 0xFC, 0x0B,
-    0xE0, 0x03, 0xFF, 0xD0, 0xBC, 0x00, 0x2F, 0xFF, 0xDF, 0xD6, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00,
-    0x3E, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x02, 0xAB, 0xFE, 0xA9, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x40, 0x2F, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x82, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xD0,
-    0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x2F, 0xE0,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x02, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAF, 0xFE, 0xBF, 0xEF, 0xFA, 0xA4,
-    0x00, 0x7F, 0xF0, 0xFF, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xC2, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xD5, 0xAF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x7F, 0xE0, 0x0F, 0xC0,
-    0x7F, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x5B, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x7F, 0xFB, 0xF8, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x07, 0xF0, 0x00, 0x1F, 0xFD, 0x07, 0xF8, 0x0F,
-    0xD0, 0x00, 0x0F, 0xFD, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0xBF, 0x80, 0xFF, 0x00, 0x04,
-    0x07, 0xF2, 0xFE, 0x03, 0xFC, 0x00, 0xB4, 0x2F, 0xCB, 0xF8, 0x0F, 0xF4, 0x07, 0xFF, 0xFF, 0x2F,
-    0xE0, 0x3F, 0xE0, 0x3F, 0xFF, 0xF4, 0xFF, 0xC1, 0xFF, 0x80, 0xFF, 0xFF, 0x81, 0x55, 0x01, 0x55,
-    0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
-    0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x41, 0xF0, 0x3F, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xBF, 0xFB, 0xFE, 0xA0,
-    0x0F, 0xCB, 0xFC, 0x7E, 0x00, 0x03, 0xF3, 0xFF, 0x6F, 0x40, 0x00, 0xFD, 0xFF, 0xEB, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xDB, 0xFF, 0x00, 0x00,
-    0xBF, 0xF2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x0F, 0xF4, 0x00, 0x00,
-    0xFF, 0x83, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x00, 0x3A,
-    0x94, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0x3F, 0xFF,
-    0xFF, 0x80, 0x7F, 0x3F, 0xD0, 0x1F, 0xD0, 0x7F, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x3F, 0x00, 0x03,
-    0xF0, 0x7F, 0x3E, 0x19, 0x43, 0xF0, 0x7F, 0x3E, 0x1F, 0xC3, 0xF0, 0x7F, 0x3E, 0x1F, 0xC3, 0xF0,
-    0x7F, 0x3E, 0x1F, 0xC3, 0xF0, 0x7F, 0x3E, 0x1F, 0xC2, 0xB0, 0xBF, 0x3E, 0x0F, 0xC0, 0x00, 0xBF,
-    0x3E, 0x0F, 0xE0, 0x00, 0xBF, 0x3E, 0x0F, 0xF8, 0x00, 0xFF, 0x3E, 0x07, 0xFF, 0xEF, 0xFF, 0x3E,
-    0x02, 0xFF, 0xFF, 0xFF, 0x14, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5A, 0xBE, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0xD5, 0x00, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x02, 0xF4, 0x2F, 0xF0, 0x00, 0x0F, 0x80,
-    0x3F, 0xC0, 0x00, 0x3D, 0x00, 0xFE, 0x00, 0x00, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x0F, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x1B, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xF5, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x50, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x10, 0x00,
-    0x00, 0x3F, 0xEB, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xE7, 0xFE, 0x6C,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x61, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF5, 0x6B, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFB, 0xF4, 0x5A, 0x00,
-    0xFF, 0xF0, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xC0, 0x00, 0x0B,
-    0xFD, 0x03, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFF, 0xE9, 0x4F, 0xFC, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xD0, 0x3F, 0xBF, 0xFF, 0xAF, 0xFC, 0x0F, 0xC0, 0xFF, 0xA7, 0xFF, 0xC3, 0xF0, 0x3F, 0xC0, 0xFF,
-    0xFF, 0xFD, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1D, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xC0, 0x00, 0x28,
-    0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0xFF, 0xFD, 0x80, 0xBF,
-    0x3F, 0x00, 0x3F, 0xCF, 0xC0, 0x0F, 0xE3, 0xF0, 0x03, 0xF8, 0xFC, 0x00, 0xFF, 0x3F, 0x00, 0x3F,
-    0xCF, 0xC0, 0x0F, 0xFB, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x40,
-    0x1B, 0xFE, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x6A, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x02,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x15, 0x54,
-    0x00, 0x02, 0xB8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC1, 0xD0, 0x00, 0xFF, 0xBF, 0x40,
-    0x03, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x0B, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0x1F, 0x40, 0xBF,
-    0xFF, 0xFD, 0x01, 0x4F, 0xFF, 0xF4, 0x06, 0xFF, 0xFF, 0x9A, 0x6F, 0xFF, 0x90, 0xBF, 0xBF, 0xFC,
-    0x07, 0xFA, 0xE7, 0xF0, 0xBF, 0xC0, 0x0F, 0xEF, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFF, 0xF4,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFB,
-    0xFC, 0x00, 0x3F, 0xEF, 0x6F, 0xD0, 0x03, 0xFA, 0xF8, 0xFD, 0x00, 0x7F, 0x6F, 0x8F, 0xE0, 0x07,
-    0xF2, 0xF8, 0xFE, 0x00, 0x7F, 0x1F, 0x8B, 0xE0, 0x03, 0xF1, 0xF8, 0xBE, 0x00, 0x3F, 0x1F, 0x8F,
-    0xE0, 0x03, 0xF1, 0xF8, 0xFE, 0x00, 0x3F, 0x1F, 0x8F, 0xE0, 0x03, 0xF5, 0xFC, 0xFD, 0x00, 0x3F,
-    0x9F, 0xCF, 0xD0, 0x03, 0xF9, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xF0,
-    0x01, 0xFF, 0x00, 0x03, 0xFD, 0x5A, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xEF, 0xF4, 0x07, 0xFE, 0x3F, 0x5F, 0xF8, 0x2F,
-    0xD0, 0xFD, 0x0F, 0xD0, 0x2D, 0x03, 0xF4, 0x0D, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x7F, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xC0, 0x3F,
-    0x40, 0x90, 0x2F, 0xD0, 0xFD, 0x0F, 0xD0, 0x7F, 0xD3, 0xF4, 0xFF, 0x80, 0x7F, 0xEF, 0xEF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x08, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFA, 0xAA, 0xAA, 0xFF, 0x01, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x3F,
-    0x80, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xF7, 0xDB, 0xF4, 0x2F, 0x83, 0xD1, 0xF8, 0x0A, 0x03, 0xD0, 0x60, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x03, 0xD0, 0xB0,
-    0x2F, 0xC3, 0xD2, 0xF8, 0x0F, 0xF7, 0xEF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x15, 0x80,
-    0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xA0, 0x1F, 0xFD, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xE7, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00, 0xFD, 0x07,
-    0xFD, 0x03, 0xF4, 0x07, 0xFD, 0x0F, 0xC0, 0x07, 0xFD, 0x14, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x06,
-    0x00, 0x19, 0x50, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC1, 0xBF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFC, 0xFD, 0x02, 0xFF, 0x0F,
-    0xD0, 0xBF, 0xC0, 0xBD, 0x2F, 0xF0, 0x0B, 0xEB, 0xFC, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x40, 0x80,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xE2, 0xFE, 0x00, 0xFD,
-    0x0F, 0xF8, 0x0F, 0xD0, 0x3F, 0xD0, 0xFC, 0x00, 0xFF, 0x4F, 0xC0, 0x03, 0xFE, 0xFC, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x3F, 0xDB, 0xE0, 0x0F,
-    0xF8, 0x7F, 0x02, 0xFE, 0x07, 0xF0, 0xBF, 0x80, 0x3F, 0x1F, 0xF0, 0x03, 0xFB, 0xFC, 0x00, 0x3F,
-    0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0xAA, 0xAA, 0xA8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0xAA, 0xA8, 0x07, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x8E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x8F, 0xFF, 0x00, 0x01,
-    0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x3F, 0xEF, 0x8F, 0xEF, 0xF0, 0x0F, 0xF8, 0xF8, 0xFC, 0xBF, 0xC3,
-    0xFE, 0x0F, 0x8F, 0xC2, 0xFC, 0x0F, 0x80, 0xF8, 0xFC, 0x0B, 0x40, 0x60, 0x0F, 0x8F, 0xC0, 0x10,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0,
-    0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x2A, 0xAA, 0xAA, 0xBF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x2A, 0xAA,
-    0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0,
-    0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8F,
-    0xC0, 0x00, 0x06, 0x00, 0xF8, 0xFC, 0x01, 0x00, 0xF8, 0x0F, 0x8F, 0xC0, 0xF4, 0x3F, 0xE0, 0xF8,
-    0xFC, 0x2F, 0xD0, 0xFF, 0x8F, 0x8F, 0xCB, 0xFC, 0x03, 0xFE, 0xF8, 0xFE, 0xFF, 0x00, 0x0F, 0xFF,
-    0x8F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x07,
-    0xF8, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x78, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xEA, 0xAA, 0xAF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD1, 0xFF, 0xAA,
-    0xAA, 0xAB, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00,
-    0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xF3, 0xFF, 0xD0, 0x3F, 0xFE, 0x3F, 0xFF, 0xC3, 0xFF, 0xE3, 0xEB, 0xFC,
-    0x0B, 0xBE, 0x3D, 0x1F, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x03, 0xE3,
-    0xD0, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x13, 0xE3, 0xD0, 0x50, 0x1F, 0xFE, 0x3D, 0x3F, 0x83,
-    0xFF, 0xE3, 0xEF, 0xFC, 0x1F, 0xFE, 0x3F, 0xFF, 0x40, 0x2F, 0xF7, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0xAF, 0xD1,
-    0xF8, 0x1F, 0xFF, 0xEB, 0xE1, 0xFF, 0xFF, 0xFF, 0x4F, 0xFD, 0x7F, 0xFD, 0x7F, 0xC0, 0x3F, 0xF1,
-    0xFD, 0x00, 0x7F, 0xCB, 0xF0, 0x00, 0xFF, 0x2F, 0xC0, 0x03, 0xF8, 0x7F, 0x80, 0x2F, 0xC1, 0xFF,
-    0xEB, 0xFF, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x01, 0xF4, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xAB,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF0, 0x00,
-    0x0F, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xF0, 0x01,
-    0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x3F, 0xC0,
-    0x03, 0xFD, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xD1, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFE, 0x7F,
-    0xD0, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFC,
-    0x00, 0x2F, 0xFF, 0xD0, 0x5F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xDB, 0xF8, 0x00, 0x00, 0x7F,
-    0xC7, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0x80, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x2F, 0xD0, 0x3F,
-    0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x2F,
-    0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00,
-    0x1A, 0x80, 0x2A, 0x80, 0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40,
-    0xFF, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0xFF, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x03, 0xFC, 0x00,
-    0xBF, 0x40, 0xFF, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x6A, 0x80, 0x3F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xEA, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x34, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xDF, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF8, 0x3F, 0xFC, 0x01, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0x1F, 0xC0,
-    0x03, 0xE0, 0x07, 0xDB, 0xE0, 0x00, 0xF4, 0x01, 0xF6, 0xF8, 0x00, 0x3D, 0x00, 0x7D, 0x7F, 0x00,
-    0x6F, 0xD0, 0x7F, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x16, 0x80, 0x0B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFD, 0x1C, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0x81, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x47, 0xFE, 0x1F, 0xF8, 0xBF, 0xF3, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD1, 0xFF, 0x87, 0xFE, 0x2F,
-    0xFC, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x0B, 0xE2, 0xFF, 0xFC, 0x2F, 0xCF, 0xF3,
-    0xFC, 0xBF, 0x3F, 0x83, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xA4, 0x00, 0x54, 0x00,
-    0x00, 0x0F, 0xFF, 0x02, 0xF8, 0xBF, 0xFF, 0x4B, 0xF3, 0xF8, 0xBF, 0xBF, 0x8F, 0xE0, 0xBF, 0xFC,
-    0x06, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x07, 0xFC, 0x05, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xFE, 0x94, 0x00, 0x04, 0x02, 0xFF, 0xFF, 0xFF, 0xA5, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x5A, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0xAB, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0x6B, 0xFF, 0xC0, 0x05, 0xAF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
-    0xFF, 0xE9, 0x40, 0x03, 0xE9, 0x50, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_12_boldBitmaps[31877] = {
+    0xAD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0x75, 0x67, 0x29, 0x16, 0x38, 0x05, 0xD7,
+    0x10, 0x89, 0xA5, 0xA6, 0xC0, 0xFF, 0xC0, 0x45, 0xEB, 0x24, 0x12, 0x29, 0x28, 0xA0, 0x49, 0x42,
+    0x77, 0xD4, 0xD7, 0x5C, 0x4B, 0xC3, 0xD9, 0x15, 0xF5, 0x2B, 0xA0, 0xA2, 0x49, 0x01, 0x14, 0x34,
+    0x77, 0x25, 0xC5, 0x71, 0x6B, 0x72, 0x45, 0x8A, 0x57, 0xE4, 0x89, 0x08, 0x51, 0x50, 0x60, 0x11,
+    0xFA, 0x58, 0x97, 0x55, 0xE2, 0x87, 0xD6, 0x3B, 0x7C, 0xB3, 0xFB, 0xEE, 0x07, 0x3D, 0xDE, 0x67,
+    0x7F, 0xCF, 0xBB, 0xB3, 0xB3, 0xF3, 0xE3, 0x9B, 0x31, 0x51, 0x4E, 0xAA, 0x57, 0x63, 0x1A, 0x45,
+    0x1C, 0x25, 0x46, 0x75, 0x39, 0xD4, 0x48, 0xC7, 0x74, 0x93, 0x2E, 0x2F, 0xED, 0x6A, 0x67, 0x26,
+    0x0C, 0xDF, 0x7A, 0xEB, 0x5B, 0x41, 0xBC, 0xB7, 0xA3, 0x19, 0xDB, 0xE1, 0xFA, 0xDD, 0x8E, 0x32,
+    0xF6, 0x17, 0x1F, 0x3C, 0x26, 0x32, 0x8D, 0x95, 0xAD, 0x1B, 0x68, 0x1B, 0x8E, 0x40, 0x41, 0xC0,
+    0x26, 0x60, 0x81, 0x92, 0xE5, 0xF2, 0x55, 0x84, 0x29, 0x81, 0xDB, 0x7A, 0xC8, 0x8F, 0xC2, 0x83,
+    0x4F, 0x29, 0x0F, 0xCA, 0x43, 0x30, 0x9F, 0x23, 0xA8, 0x0B, 0x28, 0x00, 0x49, 0x72, 0xD4, 0x09,
+    0x4C, 0x84, 0x61, 0x67, 0x6F, 0xDE, 0x5B, 0x3F, 0x68, 0xA8, 0xF4, 0x95, 0x83, 0x64, 0xB5, 0x81,
+    0xA9, 0x1A, 0x23, 0x68, 0x81, 0x1B, 0xDF, 0xBD, 0xFB, 0xF8, 0xD2, 0xB3, 0x72, 0x25, 0xEA, 0x45,
+    0x88, 0x7E, 0x8E, 0xE6, 0x2E, 0x88, 0x0A, 0xE8, 0x13, 0xB3, 0x9C, 0x3C, 0x3C, 0x29, 0xB6, 0x9F,
+    0x51, 0xC6, 0x9F, 0xF4, 0xB0, 0xFB, 0x6C, 0x94, 0x60, 0x78, 0x91, 0x11, 0xB7, 0x98, 0xD7, 0xD1,
+    0x10, 0xEC, 0xB7, 0xCC, 0x2B, 0xCA, 0x2C, 0xCF, 0x98, 0x78, 0xC9, 0x3D, 0xA9, 0xD1, 0xBA, 0xA2,
+    0xF1, 0xD5, 0x8C, 0xED, 0x25, 0xDF, 0x13, 0xEB, 0xCE, 0xE4, 0xD1, 0x43, 0x90, 0xBB, 0xEC, 0x48,
+    0x76, 0x92, 0x86, 0x4E, 0x2A, 0xC4, 0xA8, 0x4C, 0x1C, 0xA3, 0x43, 0xBA, 0x76, 0xBD, 0x23, 0x8F,
+    0x4A, 0x24, 0xF2, 0x89, 0xEA, 0x8E, 0x0C, 0x69, 0xA6, 0x6A, 0x50, 0xC3, 0x4F, 0x10, 0xDE, 0x2D,
+    0x7A, 0xD3, 0xA8, 0x7E, 0xB7, 0x1C, 0xE9, 0x76, 0xF9, 0x8B, 0x18, 0x39, 0x99, 0x0E, 0x02, 0xA2,
+    0xAC, 0xEE, 0x62, 0x74, 0xEB, 0x27, 0x13, 0x94, 0x3B, 0xF8, 0x42, 0xFC, 0x61, 0xD9, 0x53, 0xFD,
+    0xBC, 0xDF, 0x25, 0x35, 0xED, 0xAA, 0x9E, 0x58, 0x0D, 0x27, 0xA4, 0x87, 0x9A, 0x3B, 0x04, 0x14,
+    0x02, 0xB6, 0xC1, 0x11, 0x31, 0x46, 0x74, 0xB0, 0x10, 0x8F, 0xE0, 0xD0, 0x0C, 0x55, 0x05, 0x58,
+    0x42, 0x35, 0x61, 0xF3, 0x09, 0x20, 0xF3, 0x38, 0x58, 0x79, 0xB3, 0xC2, 0x69, 0x38, 0x41, 0xC1,
+    0x61, 0xAA, 0x61, 0x77, 0x8E, 0x20, 0x7D, 0xAD, 0xCF, 0xE7, 0xC2, 0xD9, 0x3B, 0x73, 0x7D, 0xE6,
+    0xB3, 0xC0, 0xD5, 0x94, 0xB1, 0x33, 0xE1, 0x51, 0x72, 0xB7, 0x11, 0xC7, 0x11, 0xAC, 0xE9, 0x98,
+    0x0E, 0xE0, 0xF6, 0xFE, 0x0F, 0xBC, 0xE4, 0x7A, 0xB2, 0xBF, 0xF2, 0xC7, 0x73, 0xED, 0x78, 0xA0,
+    0x62, 0x20, 0xD3, 0xE5, 0x9E, 0xF4, 0x0A, 0x94, 0x28, 0x1C, 0x99, 0x3E, 0x0B, 0x04, 0xCF, 0x80,
+    0x73, 0x42, 0xCC, 0x2B, 0x58, 0x38, 0x50, 0xDB, 0x61, 0xA9, 0x88, 0x7F, 0xD3, 0x2C, 0x04, 0x26,
+    0xD2, 0x49, 0xA6, 0xCB, 0x30, 0x81, 0x9D, 0x1E, 0xA9, 0xA6, 0x1A, 0x7A, 0xE0, 0x99, 0xE4, 0xB7,
+    0x6E, 0xC0, 0x38, 0x70, 0x2D, 0x9F, 0x61, 0x3E, 0x95, 0x4E, 0x5C, 0xAD, 0x7B, 0x9C, 0x09, 0x05,
+    0x38, 0xB6, 0x88, 0x13, 0x51, 0x1D, 0xDE, 0xCA, 0xB8, 0x66, 0x45, 0x32, 0xCE, 0x8A, 0x29, 0x13,
+    0x99, 0x15, 0x74, 0x43, 0x6B, 0xBB, 0xCA, 0x23, 0x72, 0x5F, 0x04, 0xE8, 0xCF, 0xB9, 0x89, 0xB9,
+    0xDA, 0x46, 0x9A, 0x0C, 0x35, 0x9F, 0x7B, 0xAD, 0x5E, 0xBF, 0xF6, 0x35, 0x08, 0x54, 0x83, 0x09,
+    0x05, 0x78, 0xD0, 0xB2, 0x03, 0x41, 0x26, 0xF3, 0xF2, 0xA8, 0xFF, 0xE2, 0xF4, 0x2D, 0xBA, 0x8B,
+    0x9C, 0x94, 0x8B, 0xCB, 0x1C, 0xE3, 0x3C, 0x39, 0xED, 0x0A, 0x10, 0xAE, 0x25, 0x48, 0x07, 0xE8,
+    0xFF, 0xBB, 0x96, 0xC1, 0xCB, 0xA0, 0x67, 0x30, 0xDA, 0xEB, 0xC9, 0xA0, 0xF2, 0xEC, 0xB0, 0xDF,
+    0xB5, 0xCC, 0x4F, 0x21, 0x0D, 0xE8, 0xB7, 0xEE, 0xCE, 0xE6, 0x45, 0x30, 0x6F, 0xF8, 0x42, 0x73,
+    0x9F, 0x98, 0x85, 0xC4, 0x22, 0x97, 0xB1, 0xF4, 0xA2, 0x1E, 0x89, 0x1C, 0x29, 0x97, 0x8E, 0x8E,
+    0x65, 0x68, 0x9A, 0x44, 0x44, 0x38, 0x2E, 0x41, 0xA6, 0x6C, 0x8E, 0x15, 0x4A, 0x12, 0x91, 0x28,
+    0x8D, 0xF8, 0x90, 0xBA, 0x90, 0x6E, 0x9B, 0x8D, 0x1A, 0x48, 0x23, 0x0F, 0x12, 0x53, 0x29, 0xE4,
+    0x24, 0xAD, 0x87, 0xB4, 0x20, 0xD2, 0x99, 0x48, 0xDB, 0x66, 0xB3, 0x80, 0x49, 0x44, 0x51, 0xD2,
+    0x95, 0xA4, 0x45, 0x8D, 0x01, 0xBE, 0x8D, 0x7B, 0x2B, 0x1A, 0x9C, 0x25, 0x46, 0xB5, 0x3C, 0xA8,
+    0x49, 0xAF, 0xEA, 0xBE, 0xEE, 0x11, 0xE0, 0xFB, 0xEE, 0x38, 0xD4, 0xCB, 0x57, 0x9E, 0xD3, 0xE3,
+    0xD9, 0xB9, 0x67, 0xF3, 0xF4, 0x85, 0xE7, 0x8F, 0xAA, 0x73, 0x26, 0xBB, 0x0C, 0x45, 0xD0, 0x12,
+    0xDC, 0x54, 0x56, 0x24, 0x75, 0x0B, 0xB6, 0x51, 0x3B, 0x88, 0x03, 0x25, 0x53, 0xCD, 0x64, 0x98,
+    0x6E, 0x33, 0xBD, 0xCF, 0xF1, 0xD8, 0x6B, 0xBF, 0xEC, 0xE2, 0x97, 0xCB, 0xBE, 0xAB, 0x8B, 0x76,
+    0xA4, 0x8A, 0x9B, 0x96, 0x67, 0x69, 0x03, 0x87, 0x8D, 0xFD, 0x2A, 0x7A, 0x03, 0x97, 0x05, 0xE0,
+    0x0B, 0x92, 0x2F, 0x59, 0xB7, 0xE0, 0xA2, 0xC7, 0x01, 0x4D, 0xC5, 0x2B, 0x29, 0x00, 0xD8, 0xF0,
+    0x3B, 0xF3, 0x0C, 0x33, 0xFE, 0x64, 0x0E, 0xDB, 0xBC, 0xC8, 0xD1, 0x10, 0x30, 0xA9, 0x16, 0xB1,
+    0x59, 0x21, 0x06, 0x09, 0x0A, 0x9F, 0xB1, 0x18, 0xB6, 0x52, 0xB0, 0x74, 0xE7, 0x40, 0x74, 0xA2,
+    0x6F, 0x84, 0xF7, 0x9A, 0xF6, 0x2F, 0xEC, 0x4B, 0x5A, 0x24, 0xFD, 0x99, 0x0D, 0x08, 0xD1, 0x97,
+    0x29, 0x25, 0x66, 0xC0, 0x99, 0x28, 0x6F, 0x84, 0x34, 0x80, 0x96, 0x7F, 0x8C, 0x74, 0x5A, 0xF7,
+    0xC5, 0x08, 0xEF, 0xEE, 0xF9, 0x1C, 0xCD, 0x0D, 0x84, 0x9B, 0x61, 0xFB, 0x1B, 0xDC, 0xBF, 0x3D,
+    0x3C, 0xC2, 0x46, 0xE8, 0x24, 0x18, 0x29, 0xE1, 0xD6, 0x6E, 0xC3, 0x08, 0x95, 0xDA, 0x64, 0x04,
+    0xBC, 0x8D, 0x91, 0x12, 0x92, 0xDB, 0x96, 0x17, 0xF0, 0x75, 0x05, 0x16, 0x6D, 0x7F, 0xB3, 0x97,
+    0x9C, 0x54, 0xF3, 0x4D, 0x32, 0xCF, 0xFF, 0xD6, 0xB3, 0x89, 0x0C, 0x9B, 0x60, 0x10, 0x58, 0xDC,
+    0xDD, 0x0A, 0x1D, 0xD2, 0xF5, 0x7D, 0x03, 0xDF, 0xE0, 0xB0, 0x17, 0x55, 0xA8, 0x59, 0xA1, 0x97,
+    0xA8, 0xD3, 0xCB, 0x35, 0xF8, 0x1B, 0x30, 0x1B, 0x2A, 0xFE, 0xD6, 0x9B, 0xB1, 0x9C, 0xB8, 0xAB,
+    0x5E, 0xCD, 0x64, 0x96, 0x28, 0x18, 0xED, 0x4A, 0x0F, 0x6D, 0x83, 0x24, 0xCA, 0x22, 0x51, 0xD2,
+    0x09, 0x62, 0xF3, 0xF4, 0xB0, 0xFA, 0x99, 0x34, 0xDA, 0xAC, 0xED, 0x23, 0xA5, 0x40, 0x1A, 0x69,
+    0xDB, 0x1C, 0x69, 0x83, 0xF4, 0x88, 0xFB, 0xA8, 0x36, 0xA9, 0xE5, 0x0A, 0xE6, 0xA1, 0xA8, 0xB4,
+    0xC7, 0x3C, 0x0A, 0x78, 0x42, 0x89, 0x35, 0x74, 0x6B, 0x2D, 0x9D, 0xB8, 0x57, 0xC1, 0x0E, 0xF1,
+    0x33, 0x36, 0x28, 0x87, 0x1B, 0x61, 0x29, 0x5C, 0x19, 0x0E, 0x50, 0xA3, 0x68, 0x31, 0x2D, 0x77,
+    0xC0, 0xB1, 0x72, 0xE5, 0x54, 0x0F, 0xD2, 0xC3, 0xF2, 0xD9, 0xAC, 0xD4, 0x6C, 0xD6, 0x7B, 0xB3,
+    0x4E, 0x5F, 0x1F, 0xA7, 0xA4, 0x83, 0xD7, 0xFF, 0xC4, 0x16, 0xA8, 0xD9, 0x65, 0x22, 0x3E, 0xE8,
+    0xF1, 0x90, 0xF4, 0x13, 0xF4, 0x01, 0xB4, 0xFF, 0x53, 0x83, 0xA2, 0x39, 0xA1, 0xEA, 0x1C, 0x65,
+    0x7A, 0xC6, 0x96, 0xE5, 0xEB, 0x80, 0x7B, 0xCC, 0xAD, 0x45, 0x7A, 0xC3, 0x16, 0x3A, 0x8B, 0x30,
+    0x11, 0xEE, 0x0B, 0x75, 0x6E, 0xC4, 0x0E, 0x0F, 0xE6, 0x0C, 0x68, 0xFC, 0x95, 0x6F, 0xCF, 0xA5,
+    0x5D, 0x6E, 0x3E, 0x3A, 0x28, 0x60, 0x4C, 0x6A, 0x6F, 0xA5, 0x0E, 0x03, 0xD9, 0xDE, 0x8C, 0x95,
+    0x2F, 0xF8, 0xCE, 0x95, 0x88, 0x7C, 0xA7, 0x7E, 0x54, 0x50, 0x36, 0x18, 0x87, 0xA5, 0x00, 0xCA,
+    0x71, 0xDF, 0x8E, 0xF4, 0x7F, 0x5C, 0xFF, 0x02, 0xAD, 0x55, 0x31, 0x6F, 0xE4, 0x44, 0x14, 0x1E,
+    0xAF, 0xB9, 0xAC, 0x90, 0x25, 0x86, 0xE6, 0x90, 0x10, 0x42, 0x6E, 0x68, 0x38, 0xE9, 0xCE, 0xBF,
+    0x00, 0xC6, 0xE8, 0x8A, 0x14, 0x14, 0x01, 0x89, 0xD0, 0x50, 0xF0, 0x13, 0xB6, 0xA1, 0x1F, 0x0B,
+    0x84, 0x28, 0x52, 0x64, 0x0B, 0x3A, 0x9A, 0x2B, 0x52, 0xA0, 0x50, 0x84, 0x92, 0x6E, 0x7C, 0xA4,
+    0x48, 0x91, 0x62, 0x8D, 0x22, 0x44, 0x79, 0xBE, 0xD3, 0x55, 0x50, 0xC4, 0x24, 0x46, 0xF1, 0xE6,
+    0xC6, 0xF3, 0xF8, 0xBE, 0xF1, 0x26, 0xC7, 0xF5, 0x58, 0xFB, 0x66, 0xDF, 0xBE, 0x9D, 0x99, 0xF7,
+    0xDE, 0xF7, 0xBE, 0xF7, 0xAC, 0xD4, 0xE6, 0x79, 0x0F, 0x32, 0x1F, 0xB0, 0x58, 0x2C, 0x99, 0xF4,
+    0x4A, 0x39, 0xA9, 0x54, 0x2E, 0x83, 0x4A, 0x44, 0x4A, 0xA5, 0x69, 0xD1, 0x52, 0x73, 0x09, 0x25,
+    0xEC, 0x32, 0x72, 0x07, 0xFF, 0x76, 0x54, 0xB7, 0xB8, 0xA8, 0x8C, 0x8B, 0x7A, 0x5B, 0xA9, 0xA4,
+    0x2C, 0x44, 0x94, 0x48, 0xC8, 0x44, 0xFC, 0xDD, 0x72, 0x72, 0x91, 0x7C, 0xFE, 0x63, 0x2A, 0xD2,
+    0xE3, 0x6C, 0x2B, 0xE1, 0xB0, 0x8A, 0xB6, 0x47, 0x90, 0x94, 0x6E, 0x35, 0x9C, 0xA8, 0x42, 0x1A,
+    0x3A, 0xC7, 0xEF, 0x99, 0x04, 0x45, 0x07, 0x0D, 0x8D, 0xAD, 0x82, 0xC3, 0x4A, 0xBD, 0x03, 0xDB,
+    0x02, 0x8E, 0x21, 0xEB, 0x19, 0x64, 0xDA, 0x59, 0x3C, 0xC7, 0xC6, 0x83, 0x9B, 0x34, 0x54, 0x3E,
+    0xE0, 0xAC, 0x54, 0x1A, 0x4E, 0x8A, 0xF5, 0x97, 0xBD, 0xAE, 0x52, 0x9F, 0xA8, 0x19, 0xE2, 0x4A,
+    0x18, 0xDB, 0x46, 0xA8, 0xA7, 0x1E, 0xAE, 0x70, 0xDE, 0x75, 0x6A, 0x0E, 0x37, 0xF4, 0xAF, 0x61,
+    0x7A, 0x45, 0xE0, 0xFD, 0x75, 0xF5, 0xEA, 0x73, 0xE7, 0x13, 0xD8, 0x3B, 0xF8, 0x81, 0x14, 0x10,
+    0x43, 0xE9, 0xF9, 0xCF, 0x6B, 0x5C, 0x0A, 0xC4, 0x89, 0xB8, 0x18, 0xB7, 0x94, 0x39, 0xAE, 0x6D,
+    0x55, 0x56, 0xD3, 0x65, 0x56, 0xCF, 0xDB, 0x07, 0x9D, 0x56, 0x26, 0x3D, 0xAF, 0xEF, 0x27, 0xC3,
+    0xBB, 0xBA, 0xFC, 0x25, 0x6B, 0x7F, 0xBE, 0x3F, 0x6B, 0xCD, 0xC3, 0xEA, 0xAB, 0xAC, 0x0A, 0x6F,
+    0x24, 0xED, 0x07, 0xE9, 0xF0, 0xE0, 0xE8, 0xEB, 0x4E, 0x77, 0x56, 0x8A, 0xCA, 0x34, 0xD6, 0x7A,
+    0x65, 0x6B, 0x65, 0x2B, 0xC5, 0x3B, 0x91, 0x55, 0xAD, 0xDE, 0x54, 0xA9, 0xAC, 0x17, 0x35, 0x02,
+    0x66, 0x4D, 0xB0, 0x06, 0xDA, 0x05, 0xA1, 0xAA, 0x45, 0x58, 0xDE, 0x84, 0x68, 0x6A, 0x82, 0x4A,
+    0xFC, 0x98, 0xDC, 0x06, 0xDA, 0x84, 0x58, 0x29, 0x73, 0x8E, 0xFF, 0xD2, 0x75, 0xC4, 0x76, 0xA7,
+    0x63, 0x26, 0xAE, 0x54, 0x49, 0x60, 0xE1, 0x4D, 0x83, 0x73, 0xA9, 0xE7, 0x39, 0x57, 0x23, 0x3B,
+    0x1D, 0x0E, 0xA5, 0x44, 0xED, 0x71, 0xCE, 0x60, 0xAD, 0x51, 0x3A, 0xB8, 0x43, 0xC9, 0xA5, 0x03,
+    0x36, 0xA9, 0x7C, 0x84, 0x78, 0x8A, 0x01, 0xA9, 0x27, 0x52, 0x8B, 0x3C, 0xE7, 0xA6, 0x1A, 0xA8,
+    0xFB, 0x74, 0xBC, 0x23, 0x95, 0xE0, 0x66, 0x53, 0x27, 0x1E, 0x48, 0x39, 0x00, 0x6D, 0x2B, 0xDE,
+    0x80, 0x1D, 0x2D, 0x76, 0x48, 0x8A, 0x9B, 0x3B, 0x51, 0xF3, 0x11, 0x0E, 0xDD, 0x7E, 0xA7, 0xCC,
+    0x65, 0xD8, 0x75, 0x9E, 0xD7, 0xD3, 0xD1, 0x0E, 0xE4, 0x98, 0xDB, 0x85, 0x44, 0x9B, 0x9E, 0x2D,
+    0x14, 0x1B, 0xD9, 0xB6, 0x29, 0x69, 0xC7, 0xFF, 0x0A, 0xB9, 0xF6, 0x29, 0x41, 0x66, 0x82, 0x2C,
+    0x55, 0x42, 0x8C, 0x0A, 0xA4, 0x91, 0x32, 0x59, 0x16, 0x64, 0x52, 0x3C, 0x95, 0x48, 0xA2, 0xE5,
+    0x5B, 0x8F, 0x71, 0xD2, 0x33, 0x80, 0xDA, 0x42, 0x99, 0x51, 0x21, 0x3D, 0xC1, 0x2B, 0x3A, 0x5B,
+    0x2B, 0x66, 0x48, 0xE2, 0x48, 0x13, 0x13, 0x96, 0x6F, 0x17, 0x72, 0x1C, 0xE0, 0x77, 0x67, 0x00,
+    0x9A, 0xA6, 0x55, 0x73, 0x0F, 0x27, 0xFA, 0x12, 0x00, 0x99, 0x15, 0x89, 0x03, 0x53, 0x7A, 0x6B,
+    0x92, 0xD5, 0x90, 0x2C, 0x84, 0x07, 0x07, 0x88, 0x9C, 0x71, 0xE1, 0x5D, 0x9D, 0x21, 0x6C, 0x31,
+    0x97, 0x7B, 0x3F, 0xC9, 0x3F, 0xB0, 0x9C, 0x40, 0x72, 0xB9, 0x3E, 0x40, 0x61, 0x93, 0x30, 0x35,
+    0x5D, 0x0E, 0x86, 0xBB, 0x3F, 0x47, 0x84, 0xD4, 0x93, 0x3B, 0xE8, 0x9D, 0xD2, 0xD5, 0x6A, 0x16,
+    0x26, 0x86, 0x9A, 0xEB, 0xC3, 0x03, 0x9C, 0xB9, 0x84, 0xAC, 0x20, 0x08, 0x3E, 0x30, 0x93, 0x7B,
+    0x47, 0xC4, 0xC9, 0x1B, 0xC2, 0x75, 0xF8, 0x59, 0x2C, 0x1E, 0xF6, 0x56, 0x4C, 0x83, 0x4E, 0x81,
+    0x17, 0x88, 0x24, 0xF3, 0x71, 0xB7, 0x04, 0x8B, 0x32, 0xCF, 0xB2, 0xFE, 0xF7, 0x0B, 0xE5, 0xD3,
+    0x2F, 0xBF, 0x00, 0x71, 0xA8, 0x80, 0xD2, 0x54, 0xED, 0x30, 0x95, 0x1C, 0xA0, 0xDD, 0x7D, 0xA4,
+    0x49, 0x96, 0xB9, 0x44, 0x06, 0xB2, 0x1E, 0x9C, 0x01, 0x91, 0xF5, 0x3C, 0xF7, 0x7E, 0x99, 0xA2,
+    0xD4, 0xE2, 0xA5, 0x46, 0xEC, 0xB6, 0x57, 0x56, 0xFE, 0xC2, 0x4E, 0xBB, 0x46, 0xCB, 0x82, 0x00,
+    0xF2, 0xFD, 0x17, 0x3E, 0x23, 0x10, 0xAC, 0x59, 0x64, 0x87, 0x74, 0x64, 0x10, 0x38, 0xE3, 0x80,
+    0x07, 0xC2, 0x32, 0xBF, 0x61, 0xBB, 0x6C, 0x83, 0x4F, 0x23, 0x29, 0xD7, 0xD3, 0xF4, 0x8C, 0xA6,
+    0x3D, 0x98, 0x02, 0xFA, 0x4B, 0x0F, 0x2E, 0x9A, 0x4A, 0x98, 0x46, 0x84, 0x51, 0xAC, 0x77, 0x17,
+    0x9E, 0x24, 0xBC, 0x90, 0x0D, 0x1C, 0x11, 0x73, 0xB2, 0x07, 0x00, 0x55, 0x33, 0x59, 0x05, 0xB4,
+    0x9F, 0x19, 0x54, 0xE1, 0x11, 0x83, 0xEB, 0x64, 0x6F, 0x70, 0xF8, 0x7C, 0x37, 0xD8, 0xCD, 0xC7,
+    0xDB, 0x13, 0x6F, 0x4F, 0xBD, 0x3B, 0xF5, 0xF2, 0x64, 0x24, 0x33, 0x74, 0xE4, 0x3E, 0x08, 0x84,
+    0x86, 0xF2, 0x53, 0x5F, 0x13, 0x7B, 0x04, 0x41, 0x94, 0x50, 0x63, 0xB6, 0x5F, 0x8A, 0x0E, 0xD6,
+    0xFD, 0x66, 0xA3, 0x8A, 0x1B, 0x8B, 0xCD, 0xC6, 0xB0, 0xB9, 0xA2, 0xFD, 0x70, 0x1B, 0x3D, 0x21,
+    0x9E, 0xB8, 0x4F, 0xC3, 0xAF, 0x4F, 0x8E, 0xC2, 0xC4, 0xDF, 0xAC, 0x07, 0x56, 0xA6, 0x71, 0xAD,
+    0x12, 0xE0, 0x95, 0xFA, 0xA2, 0x57, 0xFA, 0x6F, 0x5C, 0x6B, 0x57, 0x1E, 0x1C, 0xB0, 0xA0, 0xD6,
+    0x0B, 0x21, 0x47, 0x37, 0x53, 0x37, 0x65, 0x47, 0x6B, 0x06, 0x67, 0x48, 0x6B, 0xB0, 0x92, 0xEC,
+    0xAF, 0x39, 0x75, 0x31, 0x0F, 0x56, 0x04, 0x3B, 0x97, 0x26, 0xF3, 0x58, 0x0C, 0x7C, 0xB5, 0xAC,
+    0x54, 0x6B, 0xE2, 0xC8, 0x89, 0x24, 0xE0, 0x7C, 0xE2, 0x10, 0x10, 0x75, 0xFB, 0x13, 0xC0, 0xDE,
+    0x04, 0x9E, 0x4F, 0x3F, 0x6F, 0x32, 0x8C, 0x79, 0x9C, 0xCB, 0x15, 0x00, 0x7C, 0x32, 0xB1, 0x6B,
+    0xC4, 0x57, 0x8F, 0x0A, 0xA7, 0x08, 0x16, 0x31, 0x76, 0x98, 0x43, 0x5A, 0x38, 0x23, 0xA5, 0xB7,
+    0x82, 0x28, 0xB7, 0xA5, 0x4F, 0xA9, 0x56, 0x16, 0x2A, 0x1A, 0x0A, 0x6A, 0x23, 0xF2, 0xF1, 0x0B,
+    0x29, 0x64, 0x70, 0x47, 0x57, 0x41, 0xF6, 0xD6, 0xB8, 0x6B, 0x70, 0x2B, 0x94, 0x65, 0x0F, 0xC5,
+    0xDA, 0x1F, 0xDC, 0x31, 0x98, 0xBF, 0x02, 0x55, 0x73, 0x2F, 0x8F, 0xE5, 0x29, 0x54, 0x3D, 0xA2,
+    0x40, 0x8D, 0xFB, 0x55, 0x56, 0xE3, 0xDC, 0x1B, 0xA8, 0xF0, 0x46, 0x62, 0x01, 0x16, 0x94, 0x3A,
+    0xF7, 0x2A, 0x7F, 0x2A, 0x4D, 0x12, 0x0A, 0x51, 0xF9, 0x33, 0xE9, 0x67, 0x50, 0xEA, 0xE2, 0x4C,
+    0xC6, 0xD9, 0x68, 0x40, 0x6E, 0x34, 0xD7, 0xC3, 0xD1, 0x5C, 0x79, 0x28, 0xE6, 0xCC, 0x9B, 0x8B,
+    0x60, 0x4E, 0x44, 0x5F, 0x79, 0xDB, 0x39, 0x34, 0xD7, 0x5C, 0xBC, 0x03, 0xF5, 0x4E, 0x25, 0xA1,
+    0xA2, 0xC1, 0x11, 0x85, 0xE1, 0xD2, 0x31, 0x95, 0x2D, 0x59, 0xF2, 0x4D, 0x12, 0xDF, 0x6B, 0x80,
+    0x38, 0x97, 0x1F, 0x40, 0xCA, 0x11, 0x63, 0x23, 0xE3, 0x40, 0xE3, 0xE4, 0xB3, 0xE4, 0xA3, 0xF6,
+    0x8E, 0x68, 0xB1, 0xF4, 0x96, 0x8D, 0xAE, 0x2F, 0xF9, 0xBA, 0x18, 0x63, 0x29, 0x6C, 0x34, 0x12,
+    0xB6, 0x0B, 0x5E, 0xE3, 0x5D, 0xF8, 0xD4, 0xA2, 0x18, 0x78, 0xBE, 0xE1, 0xD2, 0x58, 0x72, 0x3C,
+    0x8B, 0x44, 0xB7, 0x5C, 0xF0, 0x76, 0x5C, 0xBE, 0x7C, 0x79, 0x4C, 0x23, 0xAC, 0xD7, 0xC4, 0x17,
+    0x33, 0x16, 0xAD, 0x73, 0x06, 0x5E, 0xEC, 0x77, 0x70, 0xF6, 0xFB, 0x11, 0xE7, 0xC6, 0x1F, 0x71,
+    0x36, 0xC4, 0xC6, 0xC5, 0xE8, 0x5D, 0xDE, 0xD6, 0xA7, 0x89, 0xCD, 0x87, 0x58, 0xE3, 0x68, 0x03,
+    0xB3, 0x53, 0xA9, 0xD4, 0xFF, 0xF1, 0xFC, 0x0B, 0x6D, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD,
+    0xB6, 0xA5, 0x58, 0x8A, 0x8B, 0x49, 0x13, 0x89, 0x6E, 0x7A, 0x1A, 0xF3, 0x04, 0x8C, 0x23, 0x04,
+    0x0D, 0x45, 0x56, 0x42, 0x2B, 0xCA, 0xD4, 0x20, 0xA1, 0xBC, 0x00, 0xC2, 0x86, 0xBC, 0x00, 0x05,
+    0x0F, 0x40, 0x93, 0x66, 0x29, 0xD2, 0x52, 0x31, 0x56, 0xB6, 0x48, 0x89, 0x77, 0xB7, 0xA0, 0x48,
+    0x81, 0x15, 0x45, 0x42, 0x0A, 0x45, 0xA6, 0x98, 0x20, 0x27, 0x9A, 0xF1, 0xE5, 0x1C, 0xFB, 0xCB,
+    0xFE, 0x20, 0xAC, 0xEF, 0x5E, 0xCF, 0x37, 0xE3, 0x99, 0x7B, 0xEE, 0xB9, 0x3F, 0x23, 0xF2, 0x75,
+    0x27, 0x22, 0x4E, 0xA3, 0x48, 0xA3, 0xBA, 0x88, 0x78, 0xEA, 0x5A, 0xBB, 0x3E, 0x8A, 0x0B, 0xF8,
+    0x15, 0x2A, 0xD2, 0x4F, 0x26, 0x89, 0xE8, 0xE0, 0x26, 0x29, 0x94, 0x13, 0x75, 0xAA, 0x31, 0x61,
+    0x82, 0x0D, 0xD8, 0x3B, 0xF6, 0x23, 0x16, 0x39, 0x5D, 0xA5, 0x3A, 0xCB, 0x91, 0x0D, 0x66, 0xA9,
+    0xA2, 0x1F, 0x5D, 0x7E, 0xA0, 0x2B, 0xCF, 0xD3, 0x20, 0x50, 0x3A, 0x14, 0x50, 0x49, 0x4A, 0xE8,
+    0x59, 0x38, 0xC6, 0xB6, 0x87, 0x9B, 0x96, 0x7E, 0xD3, 0x5E, 0x87, 0x4B, 0x8D, 0xA7, 0xD5, 0x97,
+    0xC4, 0x34, 0x56, 0xDC, 0xB5, 0x4A, 0xDF, 0xB9, 0xA1, 0x99, 0xCD, 0x5C, 0xA6, 0x6A, 0x11, 0x8F,
+    0x09, 0x37, 0xBA, 0xA1, 0x9D, 0x8D, 0x6A, 0xAC, 0x81, 0xB9, 0xE0, 0x57, 0x3D, 0x3E, 0xB7, 0xD9,
+    0xC6, 0x26, 0x17, 0x5A, 0xEA, 0xD0, 0x4F, 0x7E, 0xB6, 0x4B, 0xBB, 0xD4, 0x6A, 0xD6, 0x42, 0x2F,
+    0x74, 0xEC, 0x17, 0x0D, 0x56, 0xF7, 0xE3, 0x6F, 0xE3, 0x78, 0x60, 0x89, 0xB0, 0xA3, 0x63, 0xA1,
+    0xEF, 0xB2, 0x34, 0x59, 0xEE, 0x08, 0x7C, 0x84, 0x37, 0x90, 0x6A, 0x15, 0x72, 0x02, 0x7A, 0xAC,
+    0xBE, 0x25, 0x45, 0xC0, 0x85, 0x4F, 0xA7, 0x0D, 0x13, 0x91, 0x8F, 0x87, 0xE5, 0x66, 0xAD, 0x66,
+    0x69, 0x17, 0x97, 0x3F, 0xD3, 0x73, 0xFA, 0x69, 0x21, 0x11, 0x48, 0x56, 0xB9, 0xA5, 0x6B, 0xB7,
+    0x1B, 0x3B, 0xC6, 0xF3, 0x05, 0x17, 0xFF, 0xA4, 0xC2, 0xA2, 0x66, 0x0E, 0xA2, 0x98, 0x48, 0xFA,
+    0x37, 0x9B, 0xF8, 0xB4, 0xCA, 0x18, 0xFC, 0x67, 0x8A, 0x30, 0xCC, 0xC2, 0xA9, 0x59, 0x40, 0x1B,
+    0xC8, 0xA9, 0x39, 0x65, 0x39, 0xD5, 0x6F, 0x53, 0x00, 0x52, 0x13, 0xB1, 0x65, 0x90, 0x26, 0x70,
+    0x9D, 0xC5, 0xAC, 0x18, 0xF8, 0xD7, 0xF0, 0xE9, 0x6A, 0xE0, 0x47, 0xF1, 0xCF, 0x13, 0xBC, 0x3C,
+    0x0C, 0x6A, 0x0E, 0x7A, 0x0E, 0x12, 0x07, 0xCF, 0xB0, 0x94, 0x70, 0xA0, 0x3E, 0xD3, 0x77, 0x9A,
+    0xE0, 0xAE, 0x9E, 0x42, 0x16, 0xB8, 0xAC, 0x0C, 0xDF, 0xBC, 0x71, 0xC5, 0x07, 0x10, 0x0A, 0x65,
+    0xE4, 0xFD, 0xA3, 0x4C, 0xA0, 0xB0, 0xDF, 0x86, 0x36, 0x88, 0x49, 0xC0, 0x8A, 0x04, 0x60, 0xC4,
+    0xA4, 0x8D, 0xC0, 0x05, 0x54, 0xC4, 0x33, 0xF6, 0x01, 0xFC, 0xB4, 0x30, 0xA4, 0x06, 0x3B, 0xF4,
+    0xB9, 0xCA, 0x46, 0x3A, 0xFE, 0x63, 0x59, 0x98, 0x1F, 0xF8, 0x9F, 0xE8, 0x05, 0xFD, 0x57, 0xDD,
+    0x32, 0x72, 0xF3, 0x6A, 0x96, 0xF7, 0x0F, 0xBF, 0x24, 0x76, 0xCE, 0x98, 0x84, 0x13, 0xF9, 0x72,
+    0x61, 0x63, 0x62, 0x7F, 0xC5, 0x36, 0xCA, 0x57, 0x84, 0xB2, 0x20, 0x7E, 0x2E, 0xD8, 0x84, 0x0C,
+    0x70, 0x33, 0x50, 0x01, 0xC0, 0x64, 0x72, 0xA3, 0x93, 0x1F, 0x9B, 0xD5, 0x68, 0x20, 0x30, 0x64,
+    0xBC, 0x0E, 0x35, 0x22, 0x91, 0xB5, 0xAB, 0x18, 0x0A, 0x15, 0xBC, 0xFE, 0xC0, 0xAB, 0xDC, 0x1C,
+    0x67, 0x82, 0xFE, 0x80, 0x10, 0x02, 0x4D, 0x41, 0x54, 0x24, 0x81, 0xF4, 0x66, 0xF1, 0x78, 0x41,
+    0xFA, 0x45, 0xDA, 0x19, 0xD4, 0x21, 0x34, 0x26, 0xC2, 0x6B, 0x37, 0xC3, 0x6B, 0xF0, 0xA8, 0x4F,
+    0x11, 0x35, 0xFF, 0xD7, 0x4A, 0x17, 0x58, 0x23, 0x7B, 0x65, 0x01, 0x75, 0x45, 0x8F, 0xAA, 0x3D,
+    0x6B, 0xC2, 0x61, 0x61, 0xFB, 0xC4, 0xC3, 0x4C, 0x01, 0x52, 0x80, 0xE3, 0x54, 0xC7, 0x46, 0xEF,
+    0xE9, 0x6C, 0x57, 0xD1, 0xE8, 0x60, 0x24, 0x79, 0x98, 0x61, 0xE4, 0xCC, 0x82, 0x63, 0xFB, 0x53,
+    0xA0, 0x5C, 0x61, 0x0C, 0x25, 0x96, 0x10, 0x07, 0x24, 0x7A, 0x82, 0xA7, 0x48, 0x8C, 0xFE, 0x05,
+    0x48, 0xD3, 0xDF, 0x13, 0x61, 0x4F, 0xF4, 0x84, 0x56, 0x22, 0xAD, 0xC0, 0x5E, 0x4B, 0x56, 0x37,
+    0x8E, 0x6E, 0xA4, 0x8A, 0x90, 0xC4, 0x72, 0x07, 0xC4, 0x24, 0x47, 0x01, 0x19, 0xAA, 0x9A, 0x8A,
+    0x9C, 0xA4, 0xE2, 0x97, 0xAD, 0x25, 0xD4, 0xC4, 0x6B, 0xF9, 0x61, 0xAF, 0xCC, 0xB7, 0xCC, 0xA9,
+    0xC8, 0xA9, 0x79, 0x2F, 0xDD, 0x82, 0xF6, 0x6A, 0xFA, 0x62, 0x39, 0xDF, 0xEB, 0x9B, 0xE3, 0x8E,
+    0x94, 0x4E, 0x54, 0x33, 0x55, 0xD8, 0xB2, 0x9D, 0x6A, 0x31, 0x98, 0xCE, 0x50, 0xAB, 0xD8, 0xA9,
+    0xC8, 0x07, 0x35, 0x96, 0x49, 0xDA, 0x6B, 0xAA, 0x82, 0x5F, 0x07, 0xB5, 0x88, 0x1B, 0x2E, 0x55,
+    0x57, 0x47, 0x34, 0x82, 0xF7, 0xCA, 0xD3, 0x49, 0xAF, 0x9F, 0x53, 0x7D, 0xFA, 0xF8, 0xE8, 0x8E,
+    0x54, 0x22, 0x1F, 0x49, 0x3D, 0xC8, 0xB7, 0xD2, 0x4C, 0xF2, 0x9B, 0x54, 0x68, 0x60, 0x1D, 0xCE,
+    0xB3, 0x23, 0xDA, 0x45, 0x13, 0xB0, 0x89, 0x67, 0x8C, 0x25, 0xEA, 0x03, 0x79, 0x2E, 0x0D, 0x8E,
+    0xA1, 0x91, 0x76, 0x2A, 0x92, 0x98, 0x41, 0x82, 0xDC, 0x12, 0x74, 0x00, 0x46, 0x04, 0x21, 0xF2,
+    0x8A, 0x06, 0x47, 0x13, 0x07, 0xD5, 0xCB, 0x0D, 0xDB, 0xAE, 0xBB, 0x89, 0xEC, 0x12, 0x72, 0x7B,
+    0xD3, 0x17, 0xFB, 0x54, 0x73, 0x8B, 0xC6, 0x00, 0x75, 0x76, 0xFC, 0xD3, 0x96, 0xCA, 0x0E, 0xB4,
+    0xAF, 0x5B, 0x58, 0x4A, 0x70, 0xD9, 0x9E, 0xE5, 0x72, 0x91, 0xF5, 0x90, 0xE5, 0x87, 0xB2, 0xD3,
+    0x2D, 0x12, 0x1F, 0x9E, 0x9C, 0x9C, 0xFC, 0x7C, 0x17, 0x78, 0x90, 0x51, 0x03, 0x93, 0xCB, 0x4F,
+    0x87, 0x6A, 0x28, 0xD0, 0x58, 0x90, 0x3C, 0xC8, 0xD5, 0x60, 0xA6, 0x7E, 0xFC, 0x4E, 0xFC, 0x27,
+    0x41, 0xB2, 0x01, 0x5B, 0x1F, 0xC3, 0x37, 0xF4, 0xB4, 0x53, 0x54, 0xBD, 0x19, 0xAA, 0xE4, 0x5E,
+    0xD1, 0x13, 0x1D, 0x71, 0xDC, 0x3D, 0x36, 0x06, 0xFF, 0xE3, 0x0E, 0x61, 0xF8, 0x7F, 0x69, 0xBF,
+    0x3F, 0x92, 0xF6, 0x49, 0x66, 0x79, 0x0E, 0x6C, 0x76, 0x36, 0x37, 0xC1, 0xC6, 0x32, 0xDA, 0x50,
+    0x2C, 0x28, 0xF9, 0x64, 0x42, 0x01, 0xA9, 0x92, 0xC9, 0x0F, 0x98, 0x2C, 0x0B, 0x7A, 0x61, 0x40,
+    0xAA, 0x4C, 0x05, 0x4B, 0xE5, 0xEE, 0xDE, 0xEC, 0x9A, 0x15, 0xDB, 0x27, 0x64, 0x82, 0x79, 0xF3,
+    0x01, 0x78, 0x03, 0x25, 0xF4, 0x0E, 0xA7, 0x9B, 0xFD, 0x0F, 0xFA, 0x87, 0x5D, 0x7F, 0xC5, 0xAE,
+    0x01, 0x45, 0x58, 0xF8, 0x97, 0xF0, 0x26, 0x5D, 0x49, 0x79, 0x25, 0xED, 0x79, 0x2A, 0xF6, 0x7C,
+    0x4C, 0x06, 0x2D, 0xC9, 0x4E, 0x6E, 0x71, 0x03, 0xAA, 0xBD, 0x33, 0x8B, 0x93, 0x4D, 0xE2, 0x26,
+    0x43, 0xCB, 0x2E, 0xB5, 0x1C, 0xF0, 0x2C, 0x15, 0x93, 0xF6, 0x21, 0x52, 0xB3, 0x7D, 0xB9, 0x25,
+    0xA5, 0xFB, 0x1B, 0x37, 0x06, 0x5C, 0x38, 0xFB, 0x92, 0x4C, 0x90, 0xDD, 0xFB, 0x60, 0xC2, 0x3D,
+    0xEE, 0x08, 0x8B, 0x1D, 0xB7, 0xD1, 0xA3, 0x6F, 0x78, 0x8D, 0x58, 0x3A, 0x8C, 0x54, 0xBE, 0xAD,
+    0x24, 0x09, 0xFD, 0xCB, 0xA0, 0xA2, 0x79, 0xDB, 0x98, 0x09, 0xE1, 0x36, 0xD8, 0xC3, 0x14, 0x3E,
+    0xF7, 0xAF, 0xB0, 0x11, 0xF7, 0x1F, 0xF8, 0xE8, 0x71, 0x71, 0x5C, 0x1F, 0xA2, 0x1C, 0xD1, 0x08,
+    0xA5, 0xBF, 0x00, 0x90, 0xD7, 0x33, 0xAC, 0x3D, 0x8A, 0xFD, 0xDA, 0x76, 0x2E, 0x26, 0xF1, 0x17,
+    0x73, 0xA1, 0xF7, 0x87, 0x2A, 0x23, 0x40, 0xF8, 0xDB, 0x5F, 0xE0, 0xD6, 0x6A, 0xF6, 0x92, 0x0B,
+    0x6C, 0x86, 0x10, 0xB1, 0xFF, 0x6C, 0xB7, 0x2A, 0x0E, 0x18, 0x62, 0xCD, 0x12, 0xC4, 0x65, 0xA5,
+    0x9D, 0x07, 0x4B, 0x4F, 0x00, 0xB5, 0x09, 0xFB, 0xE2, 0x26, 0xF3, 0x35, 0x41, 0xB3, 0x31, 0x3B,
+    0xF4, 0x60, 0xDF, 0x22, 0x5E, 0xA1, 0x8A, 0x76, 0x2E, 0x97, 0x76, 0xBA, 0x12, 0x37, 0x21, 0x15,
+    0x28, 0x33, 0xA5, 0x46, 0xE3, 0x6C, 0x36, 0xF9, 0x17, 0x5D, 0x55, 0xB1, 0x93, 0xD7, 0x44, 0x14,
+    0x7E, 0xC9, 0x0A, 0x29, 0x32, 0xBA, 0x34, 0x56, 0xCC, 0xDC, 0x36, 0x36, 0x3A, 0xA3, 0xDB, 0x58,
+    0x72, 0xB7, 0x71, 0x28, 0x2C, 0x28, 0xB4, 0xC1, 0x7F, 0x03, 0x4B, 0x0B, 0x34, 0x11, 0xC6, 0xA1,
+    0xB0, 0xC0, 0x46, 0x1B, 0x0A, 0x28, 0x2C, 0xF0, 0x0A, 0x69, 0x28, 0x28, 0x90, 0x04, 0x6E, 0x46,
+    0x0B, 0x8A, 0x0B, 0xC7, 0x38, 0x3A, 0x63, 0x41, 0x40, 0xB4, 0xA1, 0x20, 0xC8, 0x0E, 0xB3, 0xA7,
+    0x9B, 0x7D, 0x7E, 0x6F, 0x7F, 0x3F, 0x38, 0x34, 0x79, 0xBB, 0x97, 0xE4, 0x76, 0xDF, 0xFB, 0xDE,
+    0xFB, 0xBE, 0xB7, 0x3F, 0xB7, 0x13, 0xDB, 0xDB, 0x4B, 0xFF, 0xF3, 0x49, 0xC2, 0x55, 0x06, 0x7B,
+    0x46, 0xCC, 0x9D, 0xCD, 0xB6, 0x13, 0xC5, 0x46, 0x32, 0x5D, 0x19, 0xC8, 0x0D, 0x2A, 0xD2, 0xC1,
+    0xF5, 0x56, 0xA7, 0xF0, 0x2D, 0x4F, 0x8D, 0xF2, 0xEB, 0x89, 0xD4, 0xFC, 0x7C, 0xAA, 0x66, 0xEA,
+    0x49, 0x4F, 0x36, 0x95, 0x3C, 0xBA, 0xA8, 0xB8, 0xC1, 0x1E, 0x3D, 0x63, 0x4C, 0x2F, 0x8D, 0xF1,
+    0x60, 0x98, 0x01, 0x63, 0x67, 0x21, 0xB3, 0xEB, 0xC9, 0x3C, 0x9E, 0xC8, 0xF2, 0x80, 0x41, 0x64,
+    0x17, 0x0C, 0xEC, 0x76, 0x3C, 0x62, 0x20, 0xDA, 0xBD, 0x44, 0xEE, 0x36, 0x0F, 0xEE, 0x16, 0xCF,
+    0x6E, 0xE0, 0xA8, 0x47, 0xE5, 0x8B, 0x48, 0x2D, 0x1C, 0xD4, 0x73, 0x19, 0x11, 0xD4, 0x0E, 0x7A,
+    0x06, 0x2C, 0x2C, 0xEB, 0xF4, 0xF4, 0xFC, 0xE1, 0x0F, 0xC5, 0x13, 0x47, 0xC7, 0x6B, 0xF4, 0xD5,
+    0xB3, 0x44, 0x37, 0xA8, 0x66, 0xFE, 0x85, 0x47, 0xCC, 0xCC, 0xB3, 0x5E, 0x6A, 0x3E, 0x1E, 0x75,
+    0x50, 0xA9, 0x88, 0xD8, 0xBF, 0xD0, 0x82, 0x39, 0x52, 0x32, 0x2F, 0xE6, 0x22, 0xD9, 0xB9, 0x92,
+    0x79, 0xAA, 0x43, 0x99, 0xDC, 0x7A, 0xD6, 0xBE, 0x64, 0x37, 0x6A, 0xAF, 0x30, 0x63, 0x55, 0x0E,
+    0xE0, 0xEC, 0x43, 0x62, 0x0E, 0x15, 0xB3, 0x37, 0xFB, 0x66, 0x6E, 0x3B, 0x73, 0x33, 0x92, 0xAB,
+    0x67, 0x5A, 0xEC, 0xA0, 0x7C, 0x4F, 0xE6, 0xF7, 0x85, 0xDA, 0xF3, 0x1E, 0xDB, 0xC7, 0x3A, 0x70,
+    0x67, 0x9F, 0x26, 0xE2, 0xDD, 0x80, 0xBD, 0xD6, 0x03, 0x13, 0x72, 0xE0, 0xA8, 0x96, 0x3A, 0xD8,
+    0x51, 0xCF, 0x4C, 0xE6, 0x2E, 0x92, 0x3E, 0x3F, 0x51, 0x92, 0x62, 0xCB, 0x6B, 0x2A, 0xF8, 0x04,
+    0x23, 0x71, 0xE6, 0xC9, 0x32, 0xF6, 0xF0, 0x4C, 0x47, 0x51, 0x24, 0x7A, 0x9D, 0x8A, 0x85, 0x3D,
+    0xB5, 0xCC, 0x9D, 0xE1, 0x0B, 0x00, 0xD4, 0x38, 0xE2, 0xA1, 0x1E, 0xDC, 0x54, 0x78, 0x1D, 0xE8,
+    0x53, 0x95, 0x40, 0x24, 0x0F, 0xD5, 0xE8, 0x42, 0xE5, 0xB1, 0x3B, 0x02, 0x1F, 0xD8, 0x81, 0x0B,
+    0xFC, 0x25, 0x77, 0xF3, 0xBB, 0xCC, 0x4F, 0x05, 0x92, 0x4B, 0xC9, 0x82, 0x3B, 0x24, 0x22, 0x24,
+    0xF9, 0x97, 0x58, 0xA7, 0xC3, 0x8B, 0xEB, 0xB0, 0x27, 0x00, 0x23, 0x77, 0x7A, 0xEC, 0x7D, 0xB9,
+    0x0A, 0x64, 0x3C, 0x58, 0x67, 0xDA, 0x82, 0x0F, 0x35, 0xE1, 0x01, 0x5F, 0x40, 0x42, 0x25, 0xF0,
+    0x80, 0x4F, 0x02, 0xA0, 0xCC, 0xC2, 0x6A, 0x22, 0x3A, 0x75, 0xE1, 0x4F, 0x10, 0xDE, 0x03, 0x73,
+    0xCD, 0xEB, 0x07, 0x9D, 0xA0, 0x8F, 0xB0, 0x0A, 0xA1, 0x9F, 0x05, 0x2D, 0xE9, 0xC1, 0x2E, 0x23,
+    0x38, 0x40, 0xBD, 0x30, 0x93, 0xCD, 0xCE, 0x52, 0x28, 0x07, 0x5B, 0xED, 0x28, 0xFA, 0x7D, 0x38,
+    0x0E, 0xB4, 0x7C, 0x34, 0x28, 0x01, 0x0C, 0x25, 0x41, 0xB4, 0xE4, 0xE0, 0xB3, 0x45, 0x16, 0x06,
+    0xA3, 0xE0, 0xE6, 0x48, 0x99, 0xD4, 0x43, 0x1D, 0x80, 0x67, 0x0F, 0x39, 0x03, 0xCD, 0x5C, 0x5C,
+    0xD9, 0x3F, 0x48, 0xEC, 0x2B, 0x82, 0x80, 0x0B, 0x40, 0x69, 0x1B, 0x32, 0x23, 0x10, 0xCF, 0x3D,
+    0x2F, 0x0E, 0x49, 0xDA, 0x81, 0xC0, 0x1C, 0x94, 0x05, 0x69, 0xD1, 0xEA, 0x45, 0x1A, 0x01, 0x65,
+    0x73, 0xA8, 0x2E, 0xFB, 0x42, 0x52, 0x42, 0x34, 0xFC, 0x23, 0x92, 0xDD, 0x81, 0xEC, 0xF5, 0x58,
+    0x46, 0xD7, 0xD4, 0xF3, 0x82, 0xD7, 0x40, 0x7C, 0x62, 0x52, 0xE0, 0x5D, 0x83, 0x77, 0x77, 0x87,
+    0x8F, 0xF3, 0xFB, 0xCC, 0x0B, 0xAA, 0xEF, 0x01, 0x64, 0xCA, 0xFE, 0xA5, 0xB5, 0xC8, 0x3C, 0x58,
+    0xE0, 0x16, 0x29, 0xBA, 0xAE, 0x6F, 0x6A, 0x8F, 0x08, 0xF0, 0x3F, 0xDA, 0xB1, 0x60, 0x3C, 0x62,
+    0x6F, 0x47, 0xFD, 0x2E, 0x02, 0x4B, 0x2C, 0x2B, 0x45, 0x83, 0x4A, 0x48, 0x0B, 0x45, 0xC8, 0x1B,
+    0x65, 0x6C, 0xC4, 0x07, 0x39, 0x2C, 0xC9, 0x9E, 0xB0, 0xA3, 0xED, 0x4E, 0x8B, 0x3F, 0x77, 0x33,
+    0x21, 0xBA, 0xEF, 0x9B, 0xF6, 0x22, 0xBB, 0x01, 0x71, 0x1F, 0x43, 0xA3, 0x6B, 0xFE, 0xD0, 0x6C,
+    0xC2, 0xBE, 0xE2, 0xC7, 0xE8, 0x35, 0x7E, 0x22, 0xF4, 0x04, 0x54, 0xB5, 0x8A, 0xD5, 0xBA, 0xD1,
+    0x11, 0xBA, 0xEF, 0xCC, 0x6C, 0x26, 0xEA, 0xCF, 0x45, 0x52, 0x09, 0x61, 0x4C, 0x66, 0x0C, 0x31,
+    0xB3, 0xD2, 0xE5, 0x41, 0xBE, 0x40, 0x49, 0x40, 0xB2, 0x0B, 0x91, 0xCF, 0xED, 0xA4, 0x97, 0x92,
+    0xCF, 0x40, 0x1C, 0x0B, 0x20, 0xF5, 0x95, 0x64, 0x07, 0xD5, 0xA2, 0x37, 0x6A, 0x74, 0x15, 0x3C,
+    0xB6, 0x43, 0x22, 0x1D, 0x7A, 0x50, 0x82, 0xFF, 0x3B, 0x04, 0xAD, 0x20, 0x90, 0x9C, 0x8F, 0x49,
+    0xCF, 0xDD, 0xCA, 0x59, 0xB0, 0x92, 0xDE, 0xA1, 0x53, 0x08, 0x0C, 0xA4, 0x52, 0x6F, 0x92, 0xF6,
+    0xD5, 0xC2, 0x19, 0x52, 0x40, 0xBB, 0xA0, 0x4B, 0x58, 0xF6, 0x41, 0x0C, 0xD4, 0x8F, 0x50, 0x6D,
+    0x43, 0xB5, 0xD4, 0x07, 0xA0, 0xFA, 0x09, 0xAF, 0xE0, 0x8A, 0x05, 0xDF, 0x76, 0x27, 0x22, 0x44,
+    0xAD, 0xBD, 0xCB, 0xEB, 0x49, 0x96, 0xB5, 0xE8, 0xB9, 0xA5, 0x60, 0x2A, 0x12, 0x95, 0x2B, 0x5B,
+    0xC4, 0xD0, 0xF8, 0x3D, 0x6A, 0xEF, 0x09, 0xA0, 0x90, 0x1D, 0x2A, 0xA1, 0xFE, 0x67, 0x0C, 0xC1,
+    0x83, 0x74, 0x9F, 0xC3, 0x92, 0xF9, 0xE9, 0x7E, 0xF8, 0xCC, 0x9C, 0x7B, 0x10, 0x6E, 0xD8, 0x2F,
+    0xF7, 0xFC, 0x0F, 0xF6, 0xC4, 0x5D, 0xBF, 0xB8, 0x0F, 0x76, 0xE6, 0xE8, 0xF4, 0xAD, 0x4B, 0x92,
+    0xCA, 0x43, 0xD1, 0x77, 0x2B, 0xE5, 0x69, 0xA8, 0x87, 0x75, 0x62, 0xED, 0xCA, 0x90, 0x3F, 0x7A,
+    0x92, 0x41, 0x24, 0xD9, 0x24, 0x9A, 0x95, 0x8A, 0x1C, 0x98, 0xE1, 0x95, 0x35, 0x26, 0xEB, 0xFC,
+    0x50, 0x71, 0x3C, 0x6E, 0xB6, 0x4F, 0x7F, 0xDB, 0x8D, 0xD7, 0xDB, 0x1F, 0x3F, 0xBF, 0xD4, 0x46,
+    0x97, 0x6F, 0x1B, 0x4D, 0x30, 0xFF, 0xE9, 0x51, 0xFA, 0xB8, 0x9C, 0x75, 0xBE, 0xEB, 0x7C, 0x57,
+    0x5E, 0x6E, 0xF5, 0xE2, 0x2E, 0xA7, 0xB2, 0x5B, 0xAF, 0x44, 0xE5, 0x8F, 0x21, 0x09, 0xB4, 0xFD,
+    0x20, 0x45, 0x81, 0xB4, 0x2C, 0xE3, 0x6C, 0xF8, 0xB5, 0x7E, 0x32, 0xA9, 0xF8, 0x09, 0xA5, 0x0D,
+    0x72, 0xE7, 0x3A, 0xFD, 0x17, 0x5E, 0xAE, 0x11, 0x7F, 0x0F, 0xAC, 0x52, 0xF6, 0xCE, 0xA1, 0x00,
+    0x48, 0xAC, 0xEE, 0xA8, 0x84, 0x1A, 0xAE, 0x12, 0xBD, 0x79, 0x10, 0x1B, 0x55, 0xC1, 0xF9, 0xD0,
+    0x40, 0x69, 0xA3, 0x9E, 0xCC, 0xA4, 0x11, 0x29, 0x0F, 0x50, 0x5A, 0x63, 0x31, 0x7E, 0x16, 0xE4,
+    0xF7, 0x01, 0x74, 0x72, 0x27, 0x63, 0x9B, 0xB7, 0x1B, 0x92, 0x06, 0xC2, 0x28, 0xD3, 0xEA, 0xB8,
+    0xEF, 0xF9, 0xEF, 0xA6, 0xCF, 0x0D, 0xC8, 0x61, 0x7B, 0x7B, 0xFB, 0x72, 0x41, 0x25, 0xBD, 0x4D,
+    0x5B, 0x65, 0xE2, 0x04, 0xB7, 0x01, 0xA2, 0x1D, 0xDC, 0x5E, 0xA2, 0xA4, 0xA2, 0x0A, 0xC8, 0xD2,
+    0xB7, 0x83, 0xCB, 0x07, 0xD9, 0x02, 0x9A, 0x17, 0x1C, 0x7F, 0xF3, 0xE9, 0x57, 0x0C, 0x35, 0x74,
+    0x44, 0x2A, 0x8A, 0xD3, 0x17, 0x3D, 0xD4, 0xF4, 0x23, 0x4E, 0x40, 0x1E, 0x44, 0xE7, 0xF7, 0x22,
+    0xA4, 0x07, 0xCD, 0xE6, 0x5E, 0x52, 0xA2, 0xBD, 0x4A, 0x34, 0xA7, 0xA1, 0x44, 0xF1, 0x2C, 0xC8,
+    0x1A, 0xE8, 0xF9, 0x43, 0x7C, 0x92, 0xB2, 0xBB, 0xFB, 0x38, 0x12, 0xB0, 0x34, 0x4B, 0x4D, 0xFA,
+    0x76, 0x75, 0x2A, 0xE6, 0xE3, 0x51, 0x2D, 0xEB, 0xA4, 0x8F, 0x5A, 0x5C, 0x6E, 0x6B, 0x53, 0x9E,
+    0x37, 0xB6, 0xB6, 0x36, 0xF3, 0xF5, 0x06, 0x1D, 0xFE, 0x36, 0x8B, 0x1B, 0x5E, 0x4D, 0x73, 0xBD,
+    0x9C, 0x55, 0x63, 0x47, 0xC4, 0x0E, 0x70, 0x03, 0x0D, 0xF1, 0xD0, 0x7E, 0x91, 0xEA, 0xB1, 0x9E,
+    0xFA, 0xAF, 0x53, 0x9D, 0xCF, 0x82, 0x08, 0x5C, 0x4D, 0x21, 0x0A, 0x6D, 0xC7, 0x23, 0x94, 0xAA,
+    0x49, 0x4F, 0x08, 0x8A, 0xA4, 0x9A, 0x2B, 0xF9, 0xE7, 0x93, 0x0E, 0x35, 0x27, 0x6B, 0xEF, 0x76,
+    0x92, 0xF6, 0x7C, 0x76, 0x71, 0x4F, 0xF8, 0x62, 0x84, 0xCE, 0x7B, 0xA0, 0x9D, 0xF5, 0x9D, 0x68,
+    0x11, 0x76, 0x7A, 0xE7, 0xD8, 0xB8, 0x81, 0xD9, 0xB6, 0x9B, 0xF8, 0x22, 0xB1, 0x21, 0x36, 0x2A,
+    0xFE, 0x79, 0xEF, 0xD1, 0x38, 0x5F, 0x7B, 0xF7, 0xB5, 0x57, 0xD5, 0xD9, 0x6F, 0xE6, 0x3E, 0xD6,
+    0x8F, 0x5E, 0xD2, 0xCA, 0xBF, 0xCD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0xBF, 0x25, 0xB1,
+    0x60, 0x91, 0xF6, 0x0A, 0x4E, 0x0A, 0x09, 0xC4, 0xD4, 0x08, 0x3D, 0xFF, 0x03, 0xEF, 0x6E, 0x1D,
+    0x51, 0x50, 0x50, 0x5C, 0x84, 0xF2, 0x6A, 0xFE, 0x04, 0xDA, 0x2B, 0xB8, 0xD8, 0x90, 0x82, 0x82,
+    0x02, 0x24, 0x4A, 0x8A, 0x9C, 0x44, 0x17, 0x8A, 0x2B, 0x68, 0x28, 0x8E, 0xE7, 0xE5, 0x52, 0xA4,
+    0xA0, 0xF1, 0xE5, 0x0A, 0x5A, 0x27, 0x01, 0x21, 0x41, 0x71, 0x1B, 0xD8, 0xC2, 0x44, 0x6B, 0x0F,
+    0xDF, 0xEC, 0xE3, 0x02, 0x84, 0x26, 0x5D, 0xB2, 0xD2, 0x78, 0x9F, 0xDF, 0xEC, 0xCC, 0x7C, 0xFB,
+    0xCD, 0x0F, 0x13, 0x61, 0xED, 0xBF, 0x4C, 0xDB, 0xB9, 0x33, 0xC7, 0x31, 0x8F, 0xED, 0x95, 0xC9,
+    0x76, 0xF5, 0xBB, 0x5E, 0x07, 0xA6, 0xFA, 0xB7, 0x98, 0xF1, 0x81, 0x57, 0xB1, 0x75, 0xE6, 0x68,
+    0xA0, 0x85, 0xAE, 0xA8, 0xDA, 0x58, 0x12, 0x95, 0x3C, 0x7D, 0xC9, 0xFC, 0x88, 0x79, 0xA2, 0xCD,
+    0xDA, 0x91, 0xF1, 0xA4, 0x22, 0x11, 0x13, 0x59, 0xC7, 0x67, 0x2B, 0x8A, 0xDF, 0xB6, 0xC9, 0xD9,
+    0x1B, 0x3E, 0x9C, 0x7F, 0xB1, 0xB5, 0xF5, 0xD5, 0xE5, 0x45, 0x3B, 0x9F, 0x7F, 0x73, 0xBD, 0xF8,
+    0x23, 0x6A, 0x0E, 0x19, 0x37, 0x94, 0x56, 0xCB, 0x77, 0x98, 0x97, 0xCB, 0xEA, 0x5F, 0xC7, 0x63,
+    0x79, 0x3C, 0xDA, 0x66, 0x65, 0xDD, 0x54, 0xF2, 0x88, 0x57, 0xFC, 0x09, 0x15, 0x9D, 0xBB, 0x8A,
+    0xC8, 0x0E, 0xA7, 0x88, 0x66, 0x91, 0x2E, 0x1E, 0x3C, 0xDA, 0x6F, 0x99, 0x8F, 0x10, 0x4A, 0x5E,
+    0x49, 0xFB, 0xC7, 0x5A, 0xAC, 0xF3, 0x5F, 0xB3, 0xB3, 0xCC, 0x1F, 0x0B, 0x44, 0xAC, 0xA2, 0xDF,
+    0x0E, 0xB4, 0xA0, 0xDD, 0xCC, 0x9B, 0xAE, 0x8C, 0x36, 0x66, 0x55, 0x11, 0x36, 0xDE, 0xA2, 0xD7,
+    0x66, 0x87, 0x1A, 0xD7, 0x7A, 0x75, 0xAF, 0x8C, 0x65, 0x50, 0xBE, 0x68, 0x46, 0xE5, 0xCB, 0x46,
+    0xFC, 0xCC, 0xE2, 0x63, 0xE9, 0xD6, 0x62, 0x45, 0x7A, 0x35, 0x26, 0xF1, 0x7F, 0xCB, 0x68, 0x46,
+    0x44, 0x39, 0x93, 0x29, 0x49, 0x39, 0x90, 0x45, 0x48, 0x91, 0x37, 0x21, 0x33, 0xDE, 0xE9, 0x38,
+    0x8C, 0x25, 0xEF, 0x9C, 0xB0, 0x1F, 0x6B, 0x36, 0x3F, 0x62, 0xB3, 0x6C, 0xEE, 0x62, 0x33, 0x0C,
+    0x38, 0x7E, 0x54, 0x93, 0xEE, 0x6D, 0xBF, 0x92, 0xAD, 0xEE, 0x56, 0x7A, 0xD4, 0x3D, 0x77, 0x2B,
+    0x23, 0x9B, 0x5B, 0x15, 0x51, 0xDF, 0xC7, 0x66, 0xA3, 0xBE, 0xB7, 0xAC, 0x36, 0xCB, 0x93, 0xD1,
+    0x3E, 0x98, 0xEA, 0x87, 0xCB, 0x39, 0x05, 0x35, 0x94, 0xC3, 0x7B, 0x0F, 0xF9, 0xD3, 0x78, 0xB1,
+    0xD2, 0xCD, 0xF5, 0x6C, 0x97, 0x7A, 0xD5, 0x5C, 0xA6, 0x5D, 0x33, 0xD9, 0x21, 0x0F, 0xF9, 0xE9,
+    0xDB, 0xCE, 0xFB, 0xC5, 0xC2, 0x98, 0xD3, 0xEF, 0xB9, 0x2B, 0x3A, 0x00, 0x51, 0xB4, 0x4F, 0x5B,
+    0xBA, 0x51, 0xA1, 0xA5, 0xE2, 0xC1, 0x48, 0xF5, 0x0F, 0x81, 0xA6, 0xB2, 0x33, 0xBF, 0x4F, 0x6A,
+    0x6A, 0x8F, 0x91, 0x65, 0xFB, 0x4B, 0x9C, 0x0D, 0x96, 0x5E, 0x57, 0x8E, 0xAA, 0x37, 0xE8, 0xBC,
+    0x98, 0x10, 0x4B, 0x5A, 0xD4, 0x48, 0x64, 0xBA, 0x17, 0x03, 0xD1, 0x8A, 0x54, 0x47, 0xCA, 0x93,
+    0xA9, 0xC8, 0x36, 0xB4, 0x47, 0x59, 0xA4, 0x2C, 0x40, 0x47, 0x79, 0x27, 0xBC, 0x17, 0x55, 0xEE,
+    0x5F, 0xD0, 0xEC, 0x6D, 0x13, 0x2C, 0x1F, 0x45, 0xD3, 0xB5, 0xB8, 0x5F, 0x0B, 0x17, 0x9C, 0x7F,
+    0x47, 0x94, 0x87, 0x05, 0x5C, 0xD8, 0x1B, 0x27, 0x3D, 0xF2, 0x35, 0x2F, 0x3E, 0xA7, 0xE2, 0x1E,
+    0xB3, 0x83, 0x0E, 0x09, 0xD4, 0x41, 0xDC, 0x5A, 0x94, 0x92, 0x93, 0x68, 0x35, 0xBD, 0xB4, 0x9F,
+    0xB2, 0x98, 0x40, 0x18, 0x98, 0x9D, 0x5B, 0xA3, 0x70, 0x74, 0xB3, 0x22, 0xDD, 0x0B, 0x8C, 0x1C,
+    0xF9, 0x86, 0x15, 0x74, 0x7B, 0x29, 0xFF, 0x45, 0x45, 0x38, 0x01, 0x20, 0x48, 0x38, 0x40, 0xD5,
+    0xA8, 0x08, 0x20, 0xF9, 0x84, 0x6F, 0xA0, 0x9C, 0x6E, 0xF3, 0xD0, 0x72, 0xD1, 0xFD, 0x54, 0x52,
+    0xAA, 0xD5, 0x4E, 0x8A, 0x05, 0x67, 0xD4, 0x40, 0x14, 0x53, 0xE9, 0x8E, 0x94, 0x8D, 0xC8, 0x94,
+    0xD4, 0xB0, 0xC2, 0xB3, 0xAD, 0x66, 0x0C, 0x86, 0x1A, 0x62, 0x6E, 0x00, 0xCA, 0x72, 0x2F, 0xB5,
+    0x47, 0x74, 0x69, 0x48, 0xA4, 0xE0, 0xD6, 0xD7, 0x32, 0xFA, 0x56, 0xE0, 0x90, 0x07, 0x29, 0xA4,
+    0x1B, 0xA0, 0x29, 0x22, 0xD9, 0x8A, 0xDA, 0x20, 0x60, 0x2E, 0x79, 0xD1, 0x69, 0x07, 0x2C, 0x3F,
+    0xB7, 0xB9, 0xBF, 0xA0, 0x38, 0xDA, 0x8F, 0x42, 0xC9, 0xF7, 0x41, 0xCA, 0x07, 0x63, 0xD1, 0x09,
+    0xAF, 0xAC, 0x13, 0x29, 0x1F, 0x0E, 0x42, 0xCA, 0x6D, 0x21, 0xC5, 0xBE, 0xDF, 0x3F, 0x05, 0x29,
+    0x64, 0xF0, 0xA2, 0x45, 0x10, 0x28, 0x17, 0x81, 0x87, 0xEC, 0x1A, 0xFD, 0x77, 0x5D, 0x40, 0xE5,
+    0xE1, 0xFF, 0xE2, 0x4C, 0xC2, 0x5A, 0xDA, 0x80, 0x6B, 0x7A, 0x50, 0x53, 0x25, 0x5A, 0xCB, 0x4E,
+    0x7A, 0xF6, 0x7F, 0xB2, 0x81, 0x82, 0x09, 0x26, 0x68, 0x74, 0x1E, 0x0F, 0x19, 0x73, 0x47, 0xE5,
+    0xF8, 0x8F, 0x6B, 0xD3, 0xCB, 0x53, 0x8E, 0x9E, 0x15, 0x48, 0xEA, 0xB1, 0x27, 0x21, 0xA8, 0x34,
+    0x01, 0xAC, 0x1C, 0xD6, 0x9C, 0xCE, 0x06, 0xE9, 0x44, 0xE9, 0x7B, 0x35, 0x89, 0xCE, 0xDE, 0x84,
+    0x4E, 0xC6, 0x8C, 0x70, 0x21, 0xF8, 0x7A, 0x30, 0xAE, 0x46, 0xB1, 0xB3, 0x0E, 0x76, 0x1A, 0xC3,
+    0x07, 0xAA, 0x5F, 0x0F, 0x02, 0xAC, 0x90, 0x09, 0x95, 0xA6, 0x0A, 0x7A, 0x8C, 0x7B, 0x2D, 0x13,
+    0x86, 0x40, 0x94, 0x0D, 0xA0, 0x7D, 0x86, 0x24, 0x57, 0xC2, 0x3F, 0xCD, 0xBC, 0x04, 0xDA, 0x96,
+    0x87, 0x4E, 0xB5, 0x93, 0x30, 0x94, 0x0D, 0x3D, 0xC5, 0x7A, 0x16, 0x78, 0xD7, 0xEB, 0x30, 0x8D,
+    0x28, 0x81, 0x9E, 0x4B, 0xB4, 0x2C, 0xCD, 0xAC, 0xFA, 0x1D, 0x49, 0x9B, 0xD3, 0xFD, 0x33, 0x07,
+    0x79, 0xF5, 0x15, 0xE1, 0xF0, 0x2E, 0xFC, 0x2A, 0x9E, 0xE3, 0xE7, 0x82, 0xF1, 0x33, 0xBF, 0x23,
+    0xD1, 0xB6, 0x8A, 0x27, 0xA8, 0x4D, 0x55, 0xB1, 0xAE, 0x87, 0x56, 0x2E, 0x64, 0xA4, 0x40, 0x32,
+    0x96, 0xBE, 0xB1, 0xA7, 0xD0, 0xA9, 0x3F, 0x45, 0xD7, 0xEE, 0x78, 0xE9, 0x44, 0x8C, 0x86, 0x6C,
+    0x92, 0xEA, 0xB5, 0x1D, 0xEC, 0x54, 0x14, 0xBB, 0xD6, 0x81, 0x08, 0x33, 0xDD, 0xE2, 0x0A, 0x75,
+    0x07, 0x3B, 0x41, 0xE6, 0x04, 0xE4, 0x84, 0x2F, 0x05, 0xE3, 0xEB, 0x80, 0x86, 0xE5, 0x2B, 0x00,
+    0x59, 0x0E, 0x36, 0xC0, 0xB3, 0xC3, 0x67, 0x61, 0x33, 0x8D, 0x18, 0x99, 0x01, 0x1E, 0x5F, 0xA3,
+    0x8C, 0xA5, 0x31, 0xCA, 0x00, 0x95, 0xE2, 0xCF, 0xC6, 0xE7, 0x2A, 0xD3, 0xCF, 0xE1, 0xFA, 0x0B,
+    0xCD, 0x55, 0x3D, 0x4E, 0xDC, 0x40, 0x14, 0x1E, 0xDB, 0x02, 0x4B, 0x99, 0xC2, 0x69, 0x48, 0x93,
+    0xC2, 0x7D, 0x1A, 0x1F, 0x61, 0x1C, 0x45, 0x11, 0x25, 0x14, 0xA1, 0x49, 0x93, 0x23, 0xE4, 0x06,
+    0xF1, 0x4A, 0x14, 0x14, 0x29, 0xE0, 0x06, 0x34, 0x54, 0x4B, 0xC1, 0x09, 0xC2, 0x38, 0x4A, 0x41,
+    0x41, 0x81, 0x25, 0x0E, 0xC0, 0x92, 0x54, 0xA1, 0x89, 0x21, 0x8E, 0xD6, 0xA0, 0xB1, 0x5F, 0xBE,
+    0x6F, 0xBC, 0xC0, 0x02, 0x8A, 0xD2, 0x24, 0x4A, 0x46, 0xF6, 0x7B, 0x6F, 0x3D, 0x33, 0xEF, 0xE7,
+    0x7B, 0x3F, 0xAB, 0x54, 0x3A, 0x52, 0x4A, 0x45, 0x3D, 0x88, 0xFA, 0x50, 0x83, 0xE8, 0x4D, 0x8A,
+    0x96, 0x62, 0xD4, 0x51, 0x7C, 0x94, 0xAB, 0x3B, 0x2B, 0x72, 0xA4, 0x66, 0xC2, 0xB3, 0x42, 0x51,
+    0x1A, 0x90, 0x54, 0x46, 0x54, 0xC3, 0x3D, 0xB3, 0x8D, 0x3D, 0xDD, 0x70, 0x4F, 0x34, 0xF6, 0xD2,
+    0x49, 0x31, 0x82, 0x2E, 0xDE, 0x33, 0x25, 0xEE, 0x69, 0x17, 0x60, 0x4F, 0xCE, 0xF6, 0x1A, 0xDC,
+    0x12, 0x19, 0x45, 0x20, 0x4E, 0x19, 0xD0, 0x89, 0x06, 0x11, 0x25, 0xA5, 0x32, 0x4D, 0xEA, 0x54,
+    0x28, 0xEB, 0x92, 0xAB, 0x94, 0x3A, 0xD7, 0x9E, 0xED, 0x4A, 0x4B, 0x85, 0x85, 0xD0, 0x5C, 0x28,
+    0x56, 0x04, 0x2E, 0xF2, 0xEA, 0xD9, 0x16, 0x1D, 0xC1, 0x1D, 0xEF, 0xC5, 0xC0, 0xCD, 0xC9, 0xC0,
+    0x8B, 0x95, 0x81, 0x4B, 0x22, 0x82, 0x10, 0xC3, 0x5E, 0x7B, 0x1E, 0xB9, 0x81, 0xEB, 0x36, 0x16,
+    0xF9, 0xAA, 0x54, 0x52, 0x47, 0xFE, 0x9C, 0xB9, 0xDA, 0xF5, 0x1C, 0x46, 0x3C, 0xA7, 0x37, 0x67,
+    0xE3, 0xAD, 0x40, 0xFC, 0xAA, 0xA3, 0x81, 0x37, 0xBA, 0x53, 0xFC, 0xD4, 0x24, 0xCE, 0xF3, 0x36,
+    0x6B, 0xFD, 0x51, 0x77, 0x17, 0xA7, 0x45, 0xB9, 0x54, 0x50, 0x3F, 0xC1, 0xAD, 0x8E, 0xDB, 0x65,
+    0x26, 0x57, 0x2E, 0x92, 0x6A, 0x00, 0x17, 0x77, 0x71, 0x19, 0x98, 0xF1, 0x72, 0x84, 0x30, 0x11,
+    0xF2, 0xB5, 0xE0, 0x28, 0xE0, 0x5C, 0x26, 0x5B, 0x4F, 0x3E, 0x52, 0x71, 0xC2, 0xEB, 0x70, 0xCA,
+    0x85, 0x14, 0x34, 0x4D, 0x3D, 0xF5, 0x1E, 0x32, 0x4B, 0x59, 0xC5, 0xE3, 0x10, 0x1E, 0x7B, 0x60,
+    0xF2, 0x21, 0x37, 0xE1, 0x0E, 0xA2, 0x82, 0x19, 0x7C, 0x4B, 0xDA, 0x99, 0xB9, 0x57, 0xF3, 0xEE,
+    0x01, 0xD0, 0x1F, 0xD0, 0x76, 0x80, 0x37, 0x95, 0xAB, 0x1D, 0xA4, 0x28, 0x00, 0x22, 0x71, 0xCB,
+    0x7C, 0xC1, 0xC5, 0xB3, 0x2E, 0x64, 0xA4, 0x22, 0x55, 0x26, 0x92, 0xDB, 0x12, 0xD8, 0x11, 0x2F,
+    0x62, 0x34, 0xDE, 0xC1, 0x9D, 0xEF, 0x78, 0x8F, 0xF0, 0xC2, 0xAB, 0xDE, 0xC7, 0x1E, 0xD0, 0x1A,
+    0x5C, 0x7A, 0x07, 0x6F, 0x20, 0xA6, 0xA5, 0xFA, 0xF5, 0xFA, 0xD3, 0xB6, 0x7D, 0xEA, 0x11, 0x38,
+    0x50, 0x48, 0x58, 0x5A, 0xA2, 0x92, 0x89, 0xA8, 0x4E, 0x15, 0x73, 0x36, 0xC3, 0xB1, 0x95, 0x37,
+    0x38, 0x8C, 0x4B, 0xE7, 0x22, 0xE3, 0xE5, 0x99, 0xB1, 0x99, 0x6D, 0xDD, 0xEF, 0x0D, 0xC6, 0x64,
+    0xB0, 0x0D, 0x9D, 0x19, 0x5D, 0x41, 0xE1, 0xCA, 0x78, 0xBC, 0x02, 0x2B, 0xA8, 0x4F, 0x07, 0x36,
+    0xC5, 0xFB, 0x8D, 0x59, 0x58, 0x58, 0x5D, 0xCA, 0x4D, 0x89, 0x62, 0x5D, 0x76, 0x51, 0x97, 0xD6,
+    0x69, 0x6B, 0x2B, 0xFB, 0x85, 0x09, 0x55, 0x7F, 0xD1, 0xA8, 0xA9, 0x78, 0x82, 0x4F, 0xAD, 0x82,
+    0xD5, 0xF9, 0xA6, 0xEC, 0x09, 0x10, 0x36, 0xEC, 0x08, 0x60, 0x01, 0x49, 0x98, 0x29, 0x46, 0xC1,
+    0x8D, 0x58, 0xA2, 0xE5, 0x62, 0xA7, 0xD2, 0x5A, 0xD9, 0x32, 0x14, 0xB4, 0x20, 0xCB, 0x4D, 0x2A,
+    0xD4, 0x5B, 0x5C, 0xB9, 0x74, 0xBD, 0x99, 0x47, 0x0A, 0x05, 0x63, 0xDF, 0xF3, 0x29, 0x36, 0xAE,
+    0x9F, 0x03, 0x87, 0xC7, 0x1E, 0x3A, 0x7B, 0xD4, 0xC9, 0x89, 0x9F, 0x0A, 0x01, 0xD3, 0x51, 0x12,
+    0xEE, 0x08, 0x09, 0xE8, 0x75, 0x6D, 0xF2, 0xFB, 0x29, 0x67, 0xDD, 0x21, 0x16, 0x7D, 0xCB, 0x10,
+    0x77, 0xFC, 0x90, 0x95, 0xF4, 0xEC, 0x9A, 0x21, 0xDB, 0x7A, 0x60, 0x09, 0xEC, 0xA0, 0x0B, 0xC0,
+    0x96, 0xF2, 0x35, 0xDD, 0x98, 0x4F, 0x5D, 0xD2, 0xC8, 0x46, 0x57, 0x9C, 0xCA, 0xB6, 0xB3, 0x93,
+    0xFB, 0x25, 0xC5, 0x09, 0x06, 0x2B, 0x40, 0x00, 0x86, 0x58, 0x2F, 0xD0, 0x8E, 0xC0, 0x61, 0x20,
+    0xB8, 0xFD, 0xC1, 0x7E, 0xF5, 0x96, 0x80, 0x83, 0xE6, 0x7C, 0xF1, 0x86, 0x80, 0x04, 0x8C, 0xB0,
+    0xF5, 0x8C, 0xF4, 0x6C, 0x1F, 0xE1, 0xA8, 0xE1, 0x3C, 0xCA, 0x3D, 0xAD, 0x94, 0x39, 0x7D, 0x8D,
+    0x69, 0x83, 0xB6, 0xCA, 0x1A, 0x52, 0x04, 0x06, 0x8A, 0x79, 0xE6, 0x29, 0x8E, 0x54, 0xA1, 0xA7,
+    0xD1, 0x8C, 0xF2, 0x7B, 0xEC, 0x69, 0x4A, 0xBA, 0x30, 0x9B, 0x6E, 0xAD, 0xA7, 0xF5, 0x30, 0xE9,
+    0x3C, 0x2D, 0x49, 0x7B, 0x6F, 0x0B, 0x43, 0x2C, 0x9E, 0xA0, 0x6F, 0x64, 0x13, 0x13, 0x6F, 0xBF,
+    0x56, 0xE1, 0x05, 0x9C, 0x4B, 0x75, 0xF5, 0xA0, 0x77, 0x92, 0x73, 0xB8, 0x25, 0x50, 0x9C, 0x9E,
+    0x4A, 0x15, 0xF4, 0x99, 0xA8, 0xF4, 0xB3, 0x34, 0x21, 0x84, 0x32, 0x3B, 0x46, 0x21, 0x75, 0x46,
+    0x6A, 0x73, 0x2C, 0xF2, 0xA2, 0x33, 0x53, 0x07, 0xC1, 0x1C, 0x3B, 0x73, 0xD1, 0x9B, 0x03, 0x49,
+    0xA6, 0xAE, 0xA8, 0x2D, 0x9A, 0x2E, 0x16, 0x67, 0x6B, 0x23, 0x87, 0x12, 0x50, 0x48, 0xD0, 0x4A,
+    0xCA, 0x3A, 0x4E, 0xB7, 0x11, 0x71, 0xBA, 0x19, 0xF0, 0xD5, 0xCD, 0xFF, 0xC2, 0xC2, 0xEA, 0x1D,
+    0x0F, 0x9E, 0x12, 0xA4, 0x82, 0x7E, 0x17, 0x0C, 0xA7, 0xE8, 0xDF, 0x0A, 0x31, 0xB4, 0x13, 0x14,
+    0x65, 0xE2, 0x00, 0x4E, 0x80, 0x9E, 0x80, 0x02, 0x46, 0x10, 0x3B, 0x68, 0x0D, 0x84, 0x13, 0xC9,
+    0x1C, 0x71, 0x16, 0x4D, 0x39, 0x7E, 0xBB, 0xE1, 0x23, 0xC2, 0xB5, 0x87, 0x54, 0x73, 0x21, 0x97,
+    0x2F, 0x7D, 0x93, 0x48, 0xCF, 0x51, 0x27, 0xCF, 0x65, 0x98, 0x97, 0x20, 0x81, 0x87, 0x69, 0xD1,
+    0x27, 0x66, 0x58, 0x9A, 0x65, 0x16, 0xB1, 0x00, 0x42, 0xFE, 0xF1, 0x28, 0xEF, 0xED, 0xBE, 0xFA,
+    0xFD, 0xFA, 0xC7, 0x7E, 0xFF, 0x97, 0xEB, 0x27, 0xC5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D,
+    0xF3, 0x4A, 0xB8, 0x70, 0xE1, 0x8A, 0x86, 0x66, 0x1B, 0x5A, 0xE4, 0x2F, 0x80, 0x35, 0x50, 0xD0,
+    0x82, 0x94, 0x48, 0x74, 0x7C, 0x42, 0x7E, 0x00, 0xB1, 0x47, 0x52, 0x50, 0xD0, 0xA4, 0xA0, 0xE3,
+    0x23, 0xF2, 0x05, 0xC7, 0x1A, 0x52, 0xA4, 0x48, 0x11, 0x23, 0x4A, 0x8A, 0xB8, 0x88, 0xD2, 0xA4,
+    0x88, 0x01, 0x23, 0x99, 0x68, 0xBD, 0xC3, 0x9B, 0xB5, 0x7D, 0x84, 0xD0, 0x00, 0x05, 0x8C, 0x2E,
+    0x73, 0x2F, 0x5E, 0xCF, 0xCE, 0x9B, 0xB7, 0x3B, 0x73, 0x44, 0xD1, 0xB2, 0x0A, 0x2E, 0xED, 0xC5,
+    0xF1, 0x52, 0x1C, 0x60, 0xDA, 0xD9, 0x25, 0xA5, 0x6D, 0xD2, 0xD3, 0x25, 0x5B, 0xB8, 0x13, 0x59,
+    0xE6, 0x46, 0x1C, 0xC3, 0x9D, 0x72, 0xAB, 0xB8, 0xCC, 0x42, 0xC2, 0x44, 0x5C, 0x21, 0x58, 0x77,
+    0xB6, 0x22, 0xC5, 0x45, 0x4B, 0x64, 0x8F, 0x10, 0xAB, 0xBF, 0x04, 0x22, 0xE5, 0xB9, 0xC4, 0xBA,
+    0x6D, 0x88, 0xCC, 0x71, 0x7C, 0x88, 0xD7, 0x33, 0xEF, 0x64, 0x9B, 0x82, 0x5F, 0x3D, 0xE1, 0x03,
+    0xEC, 0xC6, 0x8D, 0xB8, 0x4E, 0xC3, 0xF9, 0x44, 0x1C, 0x69, 0x71, 0xB4, 0xC5, 0x27, 0xEB, 0xF4,
+    0xE5, 0x43, 0xA2, 0x64, 0xB8, 0x05, 0xC8, 0x87, 0x20, 0xFA, 0x94, 0x6B, 0x6C, 0xA6, 0x91, 0x4B,
+    0xBD, 0xFD, 0x89, 0x27, 0x5D, 0xE3, 0x5D, 0x92, 0xF8, 0xE5, 0xB8, 0x89, 0xE6, 0xD7, 0x5C, 0xE5,
+    0x03, 0x15, 0x7D, 0xE6, 0xC1, 0x4E, 0x81, 0x93, 0x7D, 0x0F, 0x0E, 0xB9, 0x77, 0x15, 0x2D, 0xD8,
+    0x34, 0x13, 0xDB, 0xFC, 0xCB, 0x80, 0xBD, 0x06, 0x11, 0x21, 0xB2, 0xB5, 0x47, 0x20, 0x50, 0x7C,
+    0x96, 0x6D, 0xBC, 0x0B, 0x8F, 0x2C, 0x0B, 0x3B, 0xDE, 0x11, 0x57, 0x5B, 0xB8, 0x36, 0x13, 0x47,
+    0x56, 0xDC, 0xC2, 0x49, 0xCE, 0x68, 0xD7, 0xCB, 0x4D, 0xEC, 0xD5, 0x8A, 0x80, 0x1E, 0x4A, 0x2C,
+    0x18, 0x59, 0xC9, 0x7D, 0x40, 0x42, 0xD3, 0x09, 0xE5, 0x2B, 0xF6, 0x9F, 0x55, 0x85, 0xD9, 0x77,
+    0x81, 0xEC, 0x79, 0x83, 0x42, 0x80, 0x5B, 0x64, 0x6A, 0xC8, 0x70, 0xA3, 0xD8, 0x35, 0xA6, 0x73,
+    0xED, 0xFC, 0xD6, 0xE3, 0xE9, 0x3B, 0x9F, 0xB5, 0x2E, 0xE6, 0x25, 0xE1, 0x10, 0x8D, 0xAB, 0xF1,
+    0x3B, 0x11, 0x6A, 0x62, 0x8A, 0xE7, 0x20, 0x3F, 0x01, 0x3D, 0x47, 0x9B, 0x39, 0xDA, 0xD5, 0x57,
+    0xA2, 0xD7, 0x41, 0x69, 0x98, 0x4E, 0x73, 0x6F, 0x8C, 0x86, 0xD0, 0x5D, 0x54, 0x2C, 0xCA, 0x1E,
+    0xEF, 0xEB, 0xE9, 0x08, 0xF2, 0x21, 0xE1, 0x7E, 0xE4, 0xA4, 0x38, 0xBE, 0x6C, 0x9A, 0x8C, 0x63,
+    0xB8, 0xAD, 0x50, 0x72, 0xCC, 0x53, 0x99, 0x8B, 0x08, 0x78, 0x69, 0x3F, 0x4D, 0x80, 0xEB, 0x11,
+    0xDC, 0x83, 0xCE, 0x42, 0x99, 0xEF, 0x73, 0x39, 0x82, 0x97, 0xBC, 0x18, 0x97, 0x8E, 0x87, 0x64,
+    0x0C, 0xE7, 0x3E, 0x9D, 0xC0, 0x57, 0xCB, 0x13, 0x9D, 0x31, 0x85, 0x01, 0x18, 0x62, 0x71, 0x51,
+    0x62, 0xE1, 0x33, 0x33, 0x94, 0x27, 0xD5, 0xF4, 0xCE, 0xB7, 0xB1, 0xDC, 0x6E, 0x3A, 0x76, 0x6E,
+    0xE6, 0x72, 0xA7, 0xBA, 0xB3, 0x59, 0xB5, 0x7C, 0x16, 0xA0, 0x18, 0x66, 0x85, 0x67, 0xD5, 0xB8,
+    0x9D, 0x15, 0xAE, 0xAF, 0x46, 0x7F, 0x9B, 0x15, 0x9E, 0x76, 0xA1, 0x9B, 0xEB, 0x1B, 0xB6, 0x21,
+    0x9B, 0x4A, 0xA4, 0xA9, 0x63, 0xD9, 0x97, 0x34, 0xBE, 0x6C, 0x68, 0x11, 0x10, 0xAF, 0x89, 0xCF,
+    0x07, 0xCA, 0x02, 0x80, 0x5B, 0x83, 0x33, 0x4F, 0xD9, 0x80, 0x6E, 0x71, 0x1F, 0x27, 0x60, 0x01,
+    0xD2, 0x08, 0x0E, 0x01, 0x3C, 0x2E, 0xA8, 0x3B, 0x08, 0x38, 0x66, 0xCB, 0x7B, 0xBC, 0x2F, 0x32,
+    0x88, 0x28, 0xDB, 0x22, 0x43, 0x2E, 0x2A, 0x15, 0x3C, 0x17, 0x47, 0x77, 0xE4, 0xE0, 0x84, 0x87,
+    0x28, 0xA5, 0xC1, 0x5E, 0x75, 0xF4, 0x3B, 0xF6, 0x6F, 0xD8, 0xC5, 0x4C, 0x20, 0x95, 0x84, 0xE9,
+    0xAC, 0x0A, 0x24, 0xC8, 0x3A, 0x5B, 0x62, 0x14, 0x86, 0xFF, 0x44, 0x2A, 0xA4, 0x1D, 0xE9, 0xD6,
+    0x2D, 0x13, 0x46, 0xEF, 0x99, 0x96, 0x2B, 0xC5, 0xE8, 0xA7, 0xEB, 0x0F, 0x37, 0xCB, 0x5F, 0x09,
+    0x09, 0x17, 0x5C, 0xC6, 0xFC, 0x67, 0x2E, 0x11, 0x5C, 0xE6, 0xE2, 0xD6, 0x5C, 0x04, 0xC8, 0x1C,
+    0xB4, 0x07, 0x58, 0xF2, 0x68, 0x65, 0x0C, 0x8E, 0x8B, 0x91, 0x8B, 0x90, 0xEA, 0x0B, 0x19, 0x4A,
+    0x32, 0x49, 0x92, 0xA9, 0xFB, 0x66, 0x93, 0xE3, 0x4B, 0xE5, 0x0E, 0x9B, 0x72, 0xFA, 0x2F, 0x6B,
+    0xE8, 0x0F, 0x0C, 0xE3, 0x43, 0x05, 0x5C, 0x48, 0x8D, 0x82, 0x88, 0x9F, 0x73, 0x99, 0x7A, 0xDC,
+    0x4A, 0xD3, 0xA4, 0xD2, 0x70, 0xB9, 0x47, 0xA9, 0xBA, 0x07, 0x2F, 0x23, 0x73, 0xCD, 0x4A, 0x6A,
+    0xE9, 0xA4, 0x44, 0x1A, 0x4D, 0x49, 0x17, 0xC4, 0x6E, 0x89, 0x63, 0x45, 0x26, 0xC9, 0x42, 0xDA,
+    0x20, 0xF6, 0xA7, 0x96, 0x47, 0x32, 0xB5, 0x12, 0x3C, 0x5A, 0xD1, 0xF4, 0x71, 0x25, 0xB9, 0x01,
+    0xAD, 0x5B, 0x39, 0x6E, 0xDF, 0x64, 0x7E, 0xB5, 0x18, 0x56, 0x34, 0xAC, 0x92, 0x61, 0x85, 0x89,
+    0xC9, 0x9D, 0xE3, 0xDA, 0x05, 0x72, 0xBB, 0x3F, 0xDE, 0xC7, 0x87, 0x6E, 0xEC, 0x22, 0x49, 0x8B,
+    0xA0, 0x36, 0xED, 0xF3, 0xA6, 0xA8, 0xF2, 0x2A, 0x2C, 0x9C, 0xEA, 0xB4, 0xCF, 0x6B, 0xDE, 0x35,
+    0x2F, 0x5A, 0x0A, 0xBA, 0x54, 0xFD, 0x33, 0xCA, 0x1B, 0x26, 0xBB, 0xCD, 0x77, 0x83, 0xE2, 0x07,
+    0x3E, 0x65, 0xDD, 0xAA, 0x60, 0x2B, 0x75, 0xC1, 0x27, 0xFA, 0x0C, 0xBA, 0x6D, 0xE1, 0x60, 0x9D,
+    0x5C, 0x91, 0xA2, 0xC7, 0x3D, 0x02, 0xEF, 0x5E, 0xC6, 0x34, 0xFE, 0xA4, 0xB7, 0x37, 0xD6, 0x6A,
+    0xE8, 0x13, 0x94, 0xC5, 0x15, 0xD4, 0xA6, 0x21, 0xF5, 0x69, 0x93, 0x75, 0x86, 0xF2, 0xDA, 0x93,
+    0xD9, 0x69, 0x28, 0xE4, 0x65, 0xE2, 0x6F, 0x53, 0xD6, 0xE2, 0xF4, 0xF7, 0xC3, 0x1E, 0xE3, 0x67,
+    0xC7, 0xE7, 0xE3, 0x58, 0xAF, 0xD7, 0x6D, 0xFF, 0x17, 0xF6, 0x1D, 0xAD, 0x55, 0xB1, 0x6E, 0xDC,
+    0x46, 0x10, 0x7D, 0x24, 0x21, 0x11, 0xC8, 0x16, 0xDB, 0xD8, 0x80, 0x01, 0x15, 0xFC, 0x03, 0xF3,
+    0x07, 0x1C, 0x2F, 0x15, 0x95, 0x29, 0xA4, 0xC2, 0x86, 0x7F, 0x21, 0x4D, 0xA0, 0x3F, 0x08, 0x89,
+    0xDC, 0x07, 0xF8, 0x9A, 0xD4, 0xA9, 0x52, 0xAB, 0x8D, 0x01, 0xD9, 0x64, 0xA0, 0xC2, 0x65, 0x98,
+    0x38, 0xBD, 0x89, 0x58, 0x4D, 0x9C, 0x22, 0x6B, 0x84, 0x06, 0x68, 0x81, 0xDC, 0xC9, 0x1B, 0xDE,
+    0x5D, 0x74, 0x8A, 0x6D, 0x38, 0x80, 0x44, 0x2C, 0x97, 0x37, 0x77, 0xBC, 0x37, 0x33, 0x6F, 0xDE,
+    0xCC, 0x02, 0x03, 0x60, 0x1A, 0xC0, 0x01, 0x31, 0x3F, 0x5A, 0x7E, 0xFC, 0xF0, 0x95, 0x9D, 0x23,
+    0x11, 0x69, 0x72, 0x11, 0x4C, 0xE9, 0x98, 0x76, 0xA6, 0x77, 0xB0, 0xED, 0x08, 0xB7, 0xE8, 0x10,
+    0x6C, 0x11, 0x8F, 0x9F, 0xC3, 0xF8, 0x01, 0xEE, 0x2C, 0x9C, 0x88, 0x11, 0x19, 0xAD, 0x48, 0x9F,
+    0x89, 0xB4, 0xE6, 0xDD, 0x1A, 0xC0, 0x56, 0x80, 0x14, 0xB0, 0xBC, 0x45, 0x0A, 0xEB, 0xEB, 0x22,
+    0xA0, 0x2C, 0xD6, 0x3F, 0x46, 0xA1, 0x80, 0x93, 0x31, 0x16, 0xF1, 0xB6, 0x2D, 0x9B, 0x6F, 0x50,
+    0x1F, 0x78, 0x4C, 0xB6, 0x49, 0x86, 0xFB, 0xB0, 0x5D, 0x8F, 0xFC, 0xAC, 0x45, 0x6D, 0xAB, 0x64,
+    0x74, 0xAF, 0xC5, 0xD7, 0x8C, 0x43, 0x44, 0xF6, 0x45, 0x26, 0xD4, 0x4B, 0xE0, 0xA9, 0x45, 0x3A,
+    0xDD, 0x43, 0x1E, 0x3C, 0x06, 0xA9, 0xE2, 0xEE, 0xF4, 0x46, 0x82, 0x8E, 0x8E, 0x6E, 0x17, 0x79,
+    0x2B, 0x85, 0x2C, 0xA6, 0x24, 0xD8, 0xC1, 0x8E, 0x65, 0x57, 0xBE, 0x91, 0x6D, 0x7E, 0xAE, 0x15,
+    0xB4, 0x69, 0x81, 0xBA, 0x41, 0xF2, 0x92, 0x94, 0xDC, 0x25, 0xFF, 0xFD, 0x6C, 0xE2, 0xAB, 0x9B,
+    0x41, 0xFF, 0x37, 0xFD, 0x93, 0x25, 0x41, 0x26, 0x09, 0x20, 0x07, 0x72, 0xD2, 0x11, 0x29, 0x40,
+    0x89, 0x90, 0x9D, 0xE3, 0x85, 0x67, 0x21, 0xC4, 0x93, 0x0D, 0x66, 0x4E, 0x4C, 0x1A, 0x87, 0x45,
+    0x1C, 0xBE, 0x43, 0x42, 0x60, 0x16, 0x86, 0xBC, 0x78, 0x06, 0xF6, 0x5A, 0x64, 0xB9, 0x47, 0x72,
+    0x64, 0xE5, 0x82, 0xFF, 0xC8, 0x74, 0x1F, 0xE9, 0x27, 0xAA, 0xCF, 0x67, 0x3F, 0x46, 0xE1, 0xDB,
+    0x4C, 0x7A, 0xFB, 0xF6, 0x8E, 0xF1, 0x48, 0x46, 0x20, 0xF0, 0x9F, 0x15, 0xEC, 0xCA, 0x90, 0x0A,
+    0x59, 0xF8, 0x91, 0x95, 0xA8, 0x9C, 0xF4, 0x91, 0x9C, 0xAB, 0x16, 0xD2, 0x80, 0xE8, 0xFB, 0x06,
+    0xA5, 0x47, 0xE6, 0xB1, 0xBB, 0x84, 0x21, 0x01, 0x86, 0x0A, 0x4C, 0xF9, 0x7E, 0x3A, 0x11, 0xF4,
+    0xC1, 0x87, 0x54, 0x18, 0x93, 0x94, 0x52, 0x9A, 0x24, 0xD4, 0x8D, 0xAB, 0xF2, 0xFD, 0xE9, 0x76,
+    0xA9, 0x65, 0x63, 0x02, 0x3D, 0x43, 0x7A, 0x71, 0xF1, 0x80, 0xCC, 0xD0, 0xB1, 0x52, 0xFB, 0x76,
+    0xB7, 0x5D, 0x13, 0x12, 0x31, 0x64, 0x9C, 0xAC, 0x65, 0x98, 0xF0, 0xF7, 0x9C, 0xC9, 0xD1, 0x8B,
+    0xD1, 0x57, 0x0B, 0x7C, 0xFA, 0xA2, 0x1A, 0x88, 0x01, 0x7B, 0x21, 0x4C, 0xEB, 0x69, 0xDA, 0x3F,
+    0x1C, 0x49, 0xA6, 0x57, 0x87, 0x4A, 0xD9, 0x1F, 0x47, 0x9A, 0xA9, 0x4A, 0x3B, 0x96, 0xDF, 0xF6,
+    0x0E, 0xE8, 0x30, 0x65, 0x38, 0xBC, 0x9B, 0x58, 0xE9, 0x99, 0x1D, 0xB6, 0x04, 0x68, 0x90, 0xF1,
+    0xAB, 0x29, 0x6F, 0xF2, 0x26, 0xFB, 0x58, 0x97, 0xE5, 0xE7, 0x48, 0xC9, 0xAC, 0xFB, 0x73, 0x4C,
+    0x86, 0xB8, 0xCF, 0x7E, 0x79, 0xA4, 0x85, 0x3D, 0x53, 0x2F, 0x84, 0x75, 0x3F, 0x14, 0x4A, 0x6B,
+    0x42, 0x72, 0x8C, 0x1C, 0x7D, 0xBD, 0xD1, 0x2A, 0x6F, 0x7C, 0x26, 0xCB, 0xE8, 0x68, 0xA7, 0xC8,
+    0xBA, 0xBA, 0xA8, 0x17, 0x21, 0x11, 0x95, 0xAB, 0xF3, 0xEE, 0xAA, 0x5C, 0x6F, 0xC8, 0xD1, 0x43,
+    0x2D, 0xA9, 0xED, 0xE1, 0x3A, 0x5C, 0xC2, 0x3F, 0x53, 0x36, 0xD7, 0x1B, 0x4B, 0x10, 0xD6, 0x1B,
+    0x15, 0xB6, 0xDE, 0x58, 0xDD, 0xFB, 0xA6, 0x1D, 0xF3, 0x45, 0x7F, 0x19, 0xC3, 0xB7, 0x83, 0xAE,
+    0xC5, 0xE0, 0x74, 0x8D, 0xEE, 0x8C, 0x6B, 0x52, 0x69, 0xC4, 0x74, 0xAC, 0xBA, 0x90, 0x26, 0xED,
+    0xEB, 0xFD, 0x31, 0x9A, 0xB6, 0x05, 0x40, 0x89, 0xE4, 0xD5, 0xF6, 0x83, 0xE4, 0x27, 0x5B, 0x8F,
+    0x66, 0x56, 0xDC, 0xE6, 0xD1, 0xAA, 0x97, 0x19, 0x79, 0x2C, 0x9F, 0xEB, 0xBA, 0x44, 0x7A, 0xB6,
+    0xB5, 0xC2, 0xD5, 0x25, 0xDB, 0x6B, 0xA3, 0x10, 0xBA, 0xC3, 0xDC, 0x11, 0xA8, 0x15, 0x25, 0xE6,
+    0x46, 0x45, 0x87, 0xAD, 0x2D, 0x52, 0x55, 0xC9, 0x9B, 0x91, 0xAC, 0x85, 0x81, 0xE1, 0x0B, 0x3B,
+    0xA8, 0x2B, 0xC9, 0x54, 0x43, 0x89, 0x97, 0x1C, 0x79, 0xAB, 0x8D, 0x66, 0x07, 0x77, 0x41, 0xF2,
+    0x28, 0xA3, 0x4A, 0xFB, 0x4E, 0x91, 0x34, 0xC9, 0xE3, 0x4E, 0x9B, 0xF6, 0xA0, 0x81, 0x1C, 0xC2,
+    0xFC, 0x75, 0x8A, 0xBB, 0x74, 0x77, 0x9A, 0xFF, 0x57, 0xA2, 0x8E, 0xC5, 0x23, 0xB6, 0xAA, 0x2C,
+    0x7B, 0x97, 0xF9, 0xB2, 0xCA, 0x7E, 0x62, 0x25, 0xD9, 0x77, 0xD4, 0x56, 0xD2, 0xD7, 0xC8, 0x5E,
+    0x4D, 0x28, 0x1F, 0xF7, 0x71, 0x70, 0xAD, 0xE1, 0x3C, 0xCC, 0xFF, 0x0E, 0x90, 0x9F, 0x87, 0x44,
+    0x36, 0x1D, 0x66, 0x54, 0xFB, 0x57, 0x3B, 0x8C, 0x26, 0xE7, 0x8C, 0xC6, 0x03, 0xF9, 0x22, 0x98,
+    0x9E, 0x43, 0x85, 0xDC, 0xB3, 0x80, 0xAF, 0x98, 0xC2, 0x63, 0x96, 0x52, 0x4D, 0xA9, 0xCA, 0x5F,
+    0xA9, 0x10, 0xA6, 0x3A, 0xB0, 0xE9, 0x1A, 0x43, 0xFD, 0xEC, 0xCE, 0xEC, 0xFC, 0xDF, 0x23, 0xE4,
+    0x7A, 0x5E, 0x3E, 0x75, 0x84, 0xA0, 0x66, 0xB1, 0xC5, 0xCF, 0xF3, 0xB2, 0xCF, 0xD9, 0x09, 0xAC,
+    0x39, 0xCA, 0x43, 0x85, 0xAD, 0x92, 0x41, 0xBD, 0xA8, 0x39, 0xA4, 0x93, 0x36, 0x2F, 0x27, 0x46,
+    0x55, 0xEB, 0x0C, 0x63, 0x15, 0x8E, 0xC9, 0xCB, 0xAD, 0x1D, 0xEA, 0xE5, 0x1E, 0xB2, 0xC1, 0xE3,
+    0x09, 0xC7, 0xCB, 0xEF, 0x01, 0xBB, 0xFB, 0xCB, 0x4B, 0xA5, 0xF6, 0x30, 0xF3, 0xCB, 0x63, 0x32,
+    0x99, 0x21, 0x6F, 0xAD, 0x17, 0x64, 0x2F, 0x36, 0x41, 0x13, 0x5D, 0xCD, 0x10, 0xC9, 0x97, 0xAB,
+    0x23, 0xA4, 0xCB, 0xE7, 0x2C, 0x3D, 0xF6, 0xA6, 0xF5, 0x29, 0xA2, 0x6D, 0x39, 0xAD, 0xDA, 0xF2,
+    0xBD, 0x53, 0xE4, 0x5A, 0x71, 0x5F, 0xF7, 0xFA, 0x07, 0xC5, 0x55, 0x31, 0x8E, 0xDD, 0x36, 0x10,
+    0x1D, 0x89, 0x58, 0xFF, 0x42, 0x05, 0xD3, 0x38, 0x4D, 0x0A, 0x1D, 0x41, 0x37, 0x08, 0xB5, 0x30,
+    0x10, 0x17, 0x2E, 0xEC, 0xC2, 0x1F, 0xC8, 0x19, 0xD2, 0xEC, 0x0D, 0x4C, 0x01, 0x39, 0x80, 0x17,
+    0xF0, 0x01, 0xDC, 0x24, 0x8D, 0x8B, 0xE4, 0x06, 0x26, 0x0D, 0x5F, 0x40, 0x8E, 0x0F, 0x10, 0x21,
+    0xD8, 0x6A, 0x1B, 0xD3, 0x80, 0x0A, 0xAD, 0x43, 0x69, 0xF2, 0x1E, 0xFF, 0x5F, 0xC7, 0x06, 0xEC,
+    0xC0, 0x46, 0x0C, 0x98, 0x10, 0xF5, 0xF5, 0x49, 0xCE, 0xCC, 0x9B, 0x99, 0x37, 0x43, 0xA9, 0xEE,
+    0x8B, 0x48, 0x3B, 0xE1, 0xE5, 0xA3, 0x48, 0xAD, 0xF8, 0xB0, 0x19, 0x2F, 0x37, 0xCB, 0xF5, 0xD8,
+    0xF7, 0x56, 0x55, 0x63, 0xC0, 0xEB, 0x36, 0xE6, 0x76, 0x58, 0xFD, 0x04, 0x41, 0x39, 0xC7, 0x46,
+    0xC2, 0x51, 0xAE, 0x53, 0xCC, 0xF5, 0x10, 0xC1, 0xE9, 0x06, 0x8B, 0x66, 0x39, 0x6E, 0x04, 0x6E,
+    0x0C, 0x90, 0x1E, 0x45, 0x76, 0xDC, 0xC0, 0x62, 0x87, 0xD3, 0x5E, 0x23, 0x66, 0x16, 0xF7, 0xA7,
+    0x0E, 0xDD, 0x4B, 0x4D, 0xF6, 0xF5, 0xB6, 0x9A, 0x45, 0xDD, 0xB0, 0xB9, 0x87, 0x93, 0x7B, 0xFC,
+    0x72, 0xB1, 0x7F, 0xBF, 0x5E, 0x8D, 0xAE, 0xDA, 0x03, 0x59, 0x04, 0xC4, 0xA9, 0x56, 0x4D, 0xD2,
+    0x61, 0xEE, 0x74, 0x94, 0x7A, 0x85, 0x5E, 0x3D, 0xC2, 0xEB, 0x80, 0xD3, 0x1E, 0x75, 0x57, 0x44,
+    0xA2, 0x40, 0xE2, 0xB0, 0xD1, 0xC2, 0x68, 0x83, 0x5F, 0x03, 0x00, 0x82, 0x35, 0x39, 0xB9, 0x87,
+    0xC5, 0x74, 0x98, 0x16, 0xAE, 0xD8, 0x45, 0xDE, 0x19, 0x0E, 0xD0, 0xB3, 0x74, 0xCF, 0x93, 0x04,
+    0x3B, 0xD6, 0xD9, 0xF5, 0x4D, 0x5A, 0xF1, 0x77, 0x11, 0xBD, 0x33, 0x99, 0xB5, 0x8B, 0x76, 0x0E,
+    0xE2, 0x5E, 0xE8, 0x2D, 0x06, 0x6A, 0x05, 0xA4, 0xB9, 0x03, 0x2C, 0xA7, 0x70, 0xE0, 0xA8, 0xC6,
+    0x00, 0x48, 0x87, 0x5F, 0xE0, 0x68, 0x26, 0xEA, 0xFB, 0xC8, 0xF8, 0x5F, 0x86, 0x8A, 0x91, 0x88,
+    0x9C, 0x44, 0x44, 0x23, 0xD6, 0xAB, 0x8B, 0x5D, 0x64, 0xD8, 0xDF, 0x8E, 0x6B, 0xCD, 0xF1, 0x5F,
+    0xCD, 0x33, 0xFE, 0x52, 0xF3, 0x50, 0x34, 0xFF, 0x91, 0x45, 0x6F, 0xAF, 0x76, 0x6D, 0xA1, 0x19,
+    0x5A, 0x47, 0x44, 0x78, 0x60, 0xE6, 0xC3, 0x24, 0xBB, 0xB9, 0x1B, 0xBB, 0x49, 0x7B, 0x7D, 0xBE,
+    0x19, 0xB5, 0x8B, 0xCD, 0x3E, 0xDD, 0xBC, 0xB7, 0xEF, 0xBF, 0x90, 0xF6, 0x43, 0x48, 0x5A, 0xD2,
+    0x21, 0x1E, 0xE9, 0xB0, 0xC8, 0x67, 0x0C, 0x95, 0x3A, 0x83, 0x94, 0x8A, 0x44, 0xFB, 0xDE, 0x47,
+    0x06, 0xCA, 0xA6, 0x4A, 0xA1, 0xC4, 0xFD, 0x95, 0x65, 0x97, 0x41, 0x08, 0x18, 0x93, 0x16, 0xA1,
+    0x31, 0x20, 0x8A, 0xF8, 0xE5, 0x40, 0xDB, 0xC2, 0x5F, 0x0F, 0xB3, 0x6E, 0x94, 0x9B, 0x21, 0x89,
+    0xD5, 0x19, 0x07, 0xB0, 0xC1, 0xE9, 0x2E, 0x44, 0x9E, 0x16, 0xA2, 0x1E, 0x9F, 0x73, 0x09, 0x40,
+    0x8B, 0x92, 0x08, 0x29, 0x34, 0x4B, 0xA8, 0xD7, 0x20, 0x5B, 0x90, 0xA7, 0x9E, 0xCF, 0xEA, 0xEB,
+    0xEC, 0x9B, 0xC5, 0xFB, 0xE4, 0x75, 0xF4, 0x2A, 0xFE, 0x42, 0xBC, 0xBC, 0xFF, 0x20, 0x58, 0xBA,
+    0x5B, 0xC4, 0x3F, 0xDB, 0x40, 0xB3, 0x10, 0x9B, 0xEC, 0x92, 0xD1, 0xBB, 0x59, 0xF6, 0xA7, 0xFB,
+    0x8F, 0x7B, 0x06, 0xB6, 0x06, 0x08, 0xB9, 0xA8, 0x20, 0x6D, 0x9B, 0x9A, 0x64, 0x56, 0x3A, 0x19,
+    0x37, 0x50, 0x34, 0x48, 0xA5, 0xD8, 0x77, 0x8A, 0xF4, 0xD0, 0x2B, 0x82, 0x6E, 0x41, 0x73, 0x43,
+    0xAF, 0x42, 0x3C, 0xD4, 0x29, 0xD8, 0x7C, 0x72, 0x96, 0xB1, 0xB6, 0x32, 0x06, 0x50, 0x88, 0x69,
+    0xAF, 0xA8, 0xFA, 0xE4, 0x09, 0xCA, 0x01, 0xC5, 0x43, 0x57, 0x51, 0x4A, 0x72, 0xE3, 0xC9, 0xAF,
+    0xF7, 0xFF, 0x0B, 0x07, 0x14, 0x97, 0x26, 0x80, 0x38, 0x41, 0x05, 0x4B, 0xA9, 0x52, 0x66, 0xC9,
+    0xBD, 0x62, 0x25, 0x5D, 0x71, 0x2F, 0xDC, 0x65, 0xFD, 0xA4, 0xD0, 0xA3, 0xDC, 0x80, 0x1A, 0x61,
+    0x85, 0x9C, 0xC9, 0x94, 0x0B, 0x11, 0xB5, 0x65, 0x37, 0xD8, 0xAC, 0xD0, 0x4D, 0x16, 0x9A, 0xD4,
+    0x68, 0x4A, 0x63, 0x61, 0x8B, 0x49, 0x96, 0x18, 0x4F, 0xC9, 0xDD, 0x05, 0xBD, 0xA4, 0xC2, 0xC7,
+    0xFE, 0xA7, 0x01, 0x87, 0x00, 0x70, 0xB3, 0x7A, 0xF9, 0xCB, 0x07, 0x30, 0x55, 0x5B, 0x0F, 0x35,
+    0x99, 0xF5, 0x6F, 0x47, 0x1F, 0x1F, 0x48, 0xB8, 0x95, 0x64, 0xB5, 0xD1, 0x2C, 0xDF, 0x8B, 0x9D,
+    0x66, 0x10, 0x70, 0x04, 0x01, 0x07, 0x93, 0xDD, 0xA5, 0x26, 0x76, 0x0B, 0xD8, 0x39, 0x45, 0xE1,
+    0x30, 0x93, 0x47, 0x0D, 0x6B, 0x9D, 0xE9, 0x0B, 0xB8, 0x21, 0xEC, 0x22, 0x88, 0x23, 0xFB, 0x47,
+    0xF3, 0xE6, 0x43, 0x21, 0x60, 0x17, 0x81, 0x4B, 0x64, 0x6B, 0xA3, 0x85, 0x75, 0xEC, 0x79, 0x2D,
+    0x65, 0xCD, 0x56, 0x7A, 0xE0, 0x63, 0xEC, 0x35, 0x33, 0xF7, 0xB4, 0x99, 0x19, 0x7E, 0x50, 0xAB,
+    0xE4, 0x0B, 0xE1, 0x83, 0x5C, 0x93, 0x2B, 0x12, 0xF1, 0xF2, 0xF7, 0x19, 0x52, 0xB0, 0x49, 0xEF,
+    0x73, 0x09, 0xC4, 0xD4, 0xE0, 0xA5, 0x02, 0xA7, 0xDD, 0xDC, 0x66, 0x24, 0xE5, 0x67, 0x84, 0xB7,
+    0x3D, 0xD8, 0x1B, 0x5C, 0x1F, 0x5E, 0x41, 0xB2, 0x34, 0x3A, 0xA9, 0xDE, 0x62, 0xFF, 0x02, 0x21,
+    0xF8, 0x0A, 0x49, 0x3D, 0x34, 0xFC, 0x63, 0x79, 0xBB, 0x1F, 0xF9, 0x59, 0x56, 0x5B, 0xC6, 0x5D,
+    0xCE, 0xDE, 0x69, 0x57, 0xED, 0x05, 0x79, 0x89, 0xAE, 0x02, 0xAF, 0xE9, 0xDB, 0x6E, 0x6A, 0x66,
+    0x03, 0xE7, 0xD0, 0x68, 0xDC, 0x40, 0xEF, 0x6C, 0x5F, 0x2F, 0x06, 0xEE, 0x09, 0xCB, 0x83, 0xFE,
+    0x35, 0x0C, 0x27, 0xCC, 0xF6, 0x88, 0x2E, 0xD6, 0x1F, 0xB1, 0xC0, 0xA9, 0x96, 0x13, 0x85, 0x5C,
+    0xAE, 0x97, 0x1D, 0xAD, 0x79, 0x3A, 0xFB, 0xCD, 0xD1, 0x0E, 0x91, 0xB4, 0xF0, 0xDB, 0x70, 0xD1,
+    0x5F, 0x03, 0x7C, 0x6F, 0xDC, 0xD0, 0x2B, 0x08, 0xEA, 0x64, 0x18, 0x39, 0xBA, 0xD8, 0xE9, 0x9B,
+    0x6C, 0x60, 0xA3, 0x84, 0x8D, 0x8D, 0xA4, 0x22, 0x0B, 0x4A, 0x13, 0x2E, 0x57, 0xCC, 0x7C, 0xFD,
+    0x91, 0xF9, 0x81, 0x73, 0x9D, 0x9E, 0x7F, 0xFB, 0x8C, 0xE9, 0x2E, 0x77, 0xAA, 0xD7, 0x92, 0x32,
+    0x8D, 0x05, 0xF1, 0x77, 0x2C, 0x3E, 0x34, 0xEF, 0x6A, 0x2E, 0x17, 0xC4, 0x83, 0xC3, 0x85, 0xC9,
+    0xE6, 0x34, 0x34, 0x3A, 0x83, 0x91, 0x66, 0xFD, 0x81, 0x34, 0xD5, 0x72, 0x61, 0xDA, 0xA9, 0x10,
+    0x51, 0x0B, 0x13, 0x77, 0xFA, 0x1B, 0xF0, 0x4C, 0x16, 0xB0, 0xCE, 0xAE, 0x3E, 0xA3, 0x5F, 0xFE,
+    0x03, 0xBD, 0x55, 0xB1, 0x4E, 0xDC, 0x40, 0x10, 0x1D, 0xEF, 0x0A, 0x4E, 0xC2, 0x85, 0x2B, 0x10,
+    0x12, 0x85, 0x7B, 0x1A, 0x7F, 0x41, 0xB2, 0xEE, 0x52, 0x42, 0x24, 0x08, 0x12, 0x4D, 0x7E, 0x20,
+    0x11, 0x9F, 0x60, 0xFF, 0x41, 0x0E, 0xE5, 0x17, 0x48, 0x81, 0x29, 0xAE, 0x4D, 0x11, 0xC9, 0x8E,
+    0x52, 0xA4, 0xE4, 0x92, 0x14, 0x69, 0x1D, 0x85, 0x0A, 0x0A, 0x1C, 0x61, 0x14, 0x73, 0xAC, 0x3D,
+    0x79, 0xB3, 0xBE, 0xE3, 0x14, 0x42, 0xD2, 0x24, 0xC4, 0x92, 0xDF, 0xAD, 0xC7, 0x3B, 0xB3, 0xEF,
+    0xCD, 0x8C, 0xE7, 0x88, 0x1E, 0x10, 0x51, 0x50, 0x11, 0x29, 0x2E, 0x88, 0x72, 0x26, 0x32, 0x9F,
+    0x2C, 0x05, 0xA5, 0x0F, 0xD3, 0xAF, 0xD7, 0x1E, 0x0F, 0x29, 0xE1, 0x8E, 0x0C, 0xF3, 0x38, 0x60,
+    0xB6, 0x8A, 0x79, 0x54, 0x98, 0x96, 0xC8, 0x87, 0x23, 0x49, 0x84, 0xB0, 0x91, 0x50, 0x29, 0xC2,
+    0xD4, 0x44, 0x9A, 0xE3, 0xD9, 0x02, 0xAF, 0x64, 0x9F, 0xE2, 0x2B, 0xEF, 0x59, 0xC8, 0xCC, 0x05,
+    0x6E, 0x3B, 0x90, 0x45, 0x84, 0x05, 0x0E, 0xE6, 0xC2, 0xCB, 0xB1, 0xC0, 0xE5, 0xC1, 0xC1, 0x14,
+    0x14, 0x30, 0xDC, 0x2C, 0x75, 0x7E, 0x65, 0xE2, 0xB0, 0x98, 0x12, 0x40, 0x68, 0xC5, 0x2D, 0x38,
+    0x8C, 0x83, 0xCB, 0x55, 0x65, 0xDD, 0x46, 0x8D, 0x23, 0x4D, 0x4A, 0x7A, 0xFA, 0xD4, 0x81, 0x44,
+    0xF7, 0x9A, 0x98, 0x4B, 0xCD, 0x1C, 0x2F, 0x82, 0x31, 0x2D, 0xC3, 0xD3, 0xAF, 0x85, 0x21, 0x88,
+    0x05, 0xCD, 0x8C, 0xAA, 0xBD, 0x2D, 0x6F, 0x91, 0xAF, 0x68, 0xD0, 0x3B, 0xB6, 0xD4, 0x73, 0x9B,
+    0x58, 0xCD, 0x63, 0x24, 0x06, 0xE9, 0x08, 0xB0, 0xDF, 0x93, 0x08, 0x51, 0xF3, 0x93, 0x34, 0x59,
+    0x58, 0x59, 0x60, 0x5F, 0xC4, 0xC3, 0x95, 0xB7, 0x22, 0x2D, 0x10, 0xF7, 0xA4, 0x4F, 0x11, 0x17,
+    0xBE, 0x68, 0x5C, 0xC3, 0x82, 0x22, 0x08, 0xAB, 0x1D, 0x49, 0x44, 0x4A, 0x2A, 0x5A, 0xDE, 0x72,
+    0x27, 0xE7, 0x25, 0x64, 0x79, 0xE0, 0xCB, 0x8F, 0xD3, 0xBC, 0x97, 0x5F, 0x3A, 0x61, 0xDC, 0x3F,
+    0x34, 0x38, 0xF9, 0x2C, 0x35, 0xDC, 0x88, 0xA6, 0xB5, 0x2E, 0xA6, 0x2D, 0x5A, 0x20, 0xBF, 0x1A,
+    0x54, 0x14, 0xA1, 0x5C, 0xC8, 0x87, 0x50, 0x83, 0x26, 0x57, 0xB6, 0x87, 0x77, 0x95, 0xEE, 0x3F,
+    0x88, 0x5B, 0xA7, 0xC5, 0xFD, 0x56, 0x37, 0x83, 0xAE, 0xA3, 0x50, 0xD4, 0x95, 0xE4, 0xC1, 0x75,
+    0x29, 0xA6, 0xBF, 0x28, 0xDE, 0x52, 0xAA, 0x0E, 0x90, 0x8B, 0x24, 0xA5, 0xE0, 0x1A, 0x5B, 0x83,
+    0x9B, 0x0A, 0xBA, 0x96, 0x58, 0xBD, 0x2D, 0x12, 0xCC, 0x86, 0xD2, 0x9D, 0x8D, 0x28, 0x6C, 0xB5,
+    0x23, 0xDB, 0x3C, 0x61, 0x6B, 0x4A, 0x4A, 0x6A, 0xF8, 0x9A, 0xAF, 0x38, 0x21, 0x39, 0x96, 0xC4,
+    0xC2, 0xA4, 0x2D, 0x4C, 0xFE, 0x05, 0x4C, 0x66, 0x66, 0x0A, 0x60, 0x5A, 0xE1, 0x0B, 0x38, 0xF2,
+    0x0B, 0x09, 0x81, 0x58, 0x5C, 0xC9, 0x93, 0xC4, 0x2A, 0x11, 0xFE, 0xC4, 0xB5, 0xA8, 0x75, 0x90,
+    0x08, 0xA0, 0x5C, 0xAA, 0x07, 0x16, 0xE8, 0x28, 0xFA, 0x68, 0x3B, 0x94, 0xD2, 0x1E, 0x0E, 0x24,
+    0x31, 0xC1, 0x04, 0x10, 0x8E, 0x4D, 0x03, 0x99, 0xF8, 0x38, 0x4C, 0x0C, 0xF6, 0x86, 0x7A, 0xA8,
+    0xA7, 0x90, 0x22, 0xE9, 0x91, 0x90, 0x0E, 0x04, 0x7C, 0x01, 0x2D, 0x40, 0x7B, 0x25, 0xCE, 0x31,
+    0xDC, 0x49, 0x15, 0x9C, 0x41, 0xE8, 0xC4, 0x0E, 0xC7, 0x64, 0xBE, 0xEC, 0x72, 0x45, 0xE0, 0x1C,
+    0xD5, 0x82, 0x12, 0x52, 0x24, 0xF5, 0x28, 0x5F, 0xA8, 0x72, 0xA8, 0xA7, 0x28, 0xF6, 0x81, 0xC3,
+    0x50, 0x70, 0x01, 0xB4, 0x24, 0x4E, 0xE3, 0xB0, 0x72, 0x58, 0x3A, 0x2C, 0x04, 0x3B, 0x77, 0xD6,
+    0x70, 0xAE, 0x95, 0xC8, 0xC9, 0x99, 0x83, 0xB7, 0xD3, 0x6E, 0x89, 0x56, 0xF2, 0x6E, 0x4C, 0x7F,
+    0xAD, 0x75, 0x61, 0x77, 0x94, 0x26, 0x2E, 0xD7, 0x6D, 0x98, 0x1D, 0x6E, 0xDE, 0xD1, 0xC5, 0xD9,
+    0x88, 0x3F, 0x83, 0x23, 0x46, 0x88, 0x4D, 0xF8, 0x74, 0x1F, 0x34, 0x07, 0xF0, 0x0D, 0xE1, 0x8B,
+    0x16, 0x51, 0x7C, 0x54, 0x23, 0xE2, 0x18, 0xF1, 0xE3, 0x9C, 0x5B, 0x85, 0x82, 0xF8, 0x78, 0x1B,
+    0xE1, 0x2D, 0x9F, 0x66, 0x2F, 0xE1, 0x77, 0x8C, 0x1B, 0xBA, 0x5A, 0xFC, 0x5C, 0x3B, 0xD9, 0xB8,
+    0xD6, 0x99, 0xD1, 0x2D, 0xAD, 0xB4, 0xF1, 0xF2, 0x36, 0xFD, 0xE9, 0x8A, 0x4E, 0xA0, 0x13, 0x69,
+    0x3B, 0xB3, 0xBA, 0x51, 0x75, 0xF8, 0x61, 0xA7, 0xC2, 0xDC, 0x7A, 0x87, 0x38, 0x1B, 0xD2, 0x29,
+    0xAF, 0x62, 0x02, 0x1D, 0xED, 0xA6, 0xE1, 0xE6, 0x73, 0xC8, 0xAB, 0xC1, 0x72, 0x8C, 0x9B, 0x96,
+    0x5C, 0x22, 0x91, 0x0F, 0x43, 0x7C, 0xDE, 0x28, 0x29, 0x07, 0x12, 0xEC, 0xE5, 0xE9, 0xAD, 0xF8,
+    0x2A, 0xCB, 0xF9, 0xA9, 0x53, 0xC6, 0xDF, 0x98, 0xB3, 0x47, 0x73, 0x65, 0x1E, 0x22, 0xFB, 0xDD,
+    0x68, 0xAE, 0x8C, 0x6B, 0xDF, 0xF6, 0xCA, 0x10, 0x45, 0x73, 0x96, 0x6D, 0xF4, 0xCA, 0x2C, 0x7E,
+    0xBE, 0xE3, 0x3E, 0x77, 0x85, 0x14, 0xCE, 0x85, 0x81, 0x87, 0x45, 0x91, 0x30, 0x62, 0x90, 0x90,
+    0x7C, 0x78, 0x1F, 0xEA, 0x16, 0xD0, 0xA1, 0x79, 0xEC, 0xBE, 0x5F, 0xF9, 0x3A, 0x4D, 0xD5, 0x8F,
+    0xA3, 0xFB, 0x55, 0x27, 0x7F, 0x5B, 0x18, 0x1A, 0x9E, 0x94, 0xD9, 0xF6, 0x03, 0x6B, 0x3B, 0xBE,
+    0x07, 0x75, 0xEB, 0x47, 0x7C, 0x89, 0x8D, 0xEF, 0x5D, 0xDF, 0x4D, 0x0E, 0xA6, 0x84, 0x67, 0x7D,
+    0x97, 0x9F, 0xF6, 0x84, 0x67, 0x7D, 0x57, 0x90, 0xEA, 0xFA, 0xBE, 0x33, 0x93, 0xEC, 0x00, 0x3E,
+    0x17, 0xD3, 0xBE, 0x83, 0xEE, 0x4E, 0x06, 0x92, 0x92, 0x39, 0x86, 0xE4, 0xBC, 0xE9, 0xFF, 0x74,
+    0xB5, 0x1B, 0x1B, 0xFF, 0xA4, 0xC1, 0x48, 0xA1, 0xA3, 0x30, 0x94, 0x34, 0x12, 0x13, 0x91, 0x1B,
+    0xEC, 0xAE, 0x0C, 0xF9, 0x6F, 0x3B, 0xFA, 0x07, 0xCD, 0x55, 0xBD, 0x8E, 0xD5, 0x46, 0x14, 0x3E,
+    0xB6, 0x05, 0xB7, 0x70, 0xE1, 0x6A, 0x1B, 0x52, 0xB8, 0x4E, 0x1A, 0x3F, 0x01, 0x8C, 0x49, 0xB3,
+    0x25, 0x20, 0xED, 0x92, 0x22, 0x8F, 0x90, 0x82, 0x17, 0x40, 0xB2, 0x7B, 0x1A, 0x0A, 0xE8, 0x29,
+    0xA0, 0x81, 0x82, 0x37, 0xC8, 0x8C, 0x42, 0x41, 0x91, 0x02, 0xA3, 0x2D, 0x69, 0x2C, 0x94, 0x08,
+    0x44, 0x9A, 0x01, 0x8C, 0xE4, 0xBD, 0x8C, 0xE7, 0xE3, 0x3B, 0xE3, 0xBB, 0x80, 0x96, 0x88, 0x14,
+    0x48, 0x11, 0x73, 0x35, 0x73, 0x47, 0xE3, 0xF1, 0x9C, 0xF3, 0xFD, 0x9C, 0xB1, 0x88, 0xC8, 0xEF,
+    0x62, 0x5A, 0xBB, 0x3F, 0x89, 0x45, 0x2B, 0x76, 0x12, 0xB1, 0xBD, 0x48, 0x90, 0x7F, 0x69, 0x3F,
+    0x3D, 0xC0, 0x3B, 0x00, 0x8F, 0xD9, 0x6B, 0x6C, 0xEF, 0x76, 0xBD, 0x64, 0x51, 0x64, 0x33, 0x8B,
+    0xD4, 0x23, 0x5F, 0x7B, 0xB5, 0xE4, 0xC0, 0x54, 0x02, 0x43, 0x03, 0xB4, 0xD6, 0x49, 0xCE, 0xA7,
+    0x25, 0x9F, 0x9A, 0xED, 0xFD, 0xBB, 0x7C, 0xE7, 0x2D, 0xFB, 0x13, 0xF6, 0x0E, 0x88, 0xFC, 0x0B,
+    0x67, 0x24, 0xBB, 0x6C, 0x7A, 0xFE, 0x1E, 0xCF, 0x62, 0xD0, 0x8B, 0xD1, 0xAD, 0x8C, 0x7D, 0x5D,
+    0xBE, 0xD2, 0xF2, 0xD8, 0x4A, 0x07, 0x57, 0x44, 0xEB, 0x4C, 0xDF, 0x5C, 0x5C, 0xF6, 0x3A, 0x06,
+    0x0C, 0x86, 0x81, 0x79, 0xE4, 0xD1, 0xF6, 0x40, 0x2A, 0xA6, 0x62, 0x06, 0xA6, 0xF3, 0xEE, 0xEC,
+    0xC0, 0xA5, 0x8B, 0xC0, 0x92, 0x01, 0x5E, 0x1E, 0x1E, 0xF3, 0xED, 0xBA, 0xE5, 0x50, 0x79, 0x1D,
+    0xA2, 0x0E, 0x5C, 0x97, 0xEA, 0x35, 0x38, 0x8C, 0xA5, 0x97, 0xFF, 0x6A, 0x67, 0x11, 0x7B, 0x21,
+    0x36, 0x4D, 0x17, 0x51, 0x07, 0xB8, 0x06, 0x37, 0xF7, 0xEE, 0xA4, 0xC3, 0x36, 0xD0, 0xF4, 0xA0,
+    0x11, 0xE0, 0x38, 0x98, 0x14, 0x26, 0xC8, 0x8F, 0x6D, 0x01, 0x46, 0x0A, 0x70, 0xA4, 0xA7, 0x9B,
+    0x98, 0xFD, 0x3F, 0xDC, 0xD9, 0x1D, 0x63, 0x64, 0x26, 0x06, 0xB7, 0x7E, 0x0D, 0x44, 0x00, 0x88,
+    0x0E, 0xAE, 0x82, 0xE6, 0x6A, 0x09, 0x47, 0x32, 0x1B, 0xDB, 0x1D, 0x66, 0xBF, 0x63, 0x99, 0x61,
+    0x3A, 0xF4, 0xD9, 0x52, 0x8F, 0x1B, 0x9F, 0xCF, 0x5F, 0xE4, 0xD7, 0x1D, 0xCD, 0x39, 0xDE, 0xCF,
+    0x3C, 0x6E, 0xAE, 0x9E, 0x62, 0x6E, 0x5A, 0x33, 0x19, 0x69, 0xA6, 0x0B, 0x52, 0xB3, 0x57, 0xA9,
+    0x1B, 0xCE, 0x4D, 0xDB, 0x79, 0xA2, 0xF0, 0x8C, 0xE5, 0xB9, 0xD7, 0xE7, 0x1A, 0xB2, 0x7B, 0xE6,
+    0x57, 0x66, 0xEA, 0xB1, 0x6A, 0x3B, 0xCD, 0xC3, 0xD5, 0x54, 0xB1, 0xC1, 0x22, 0xE7, 0x98, 0xE9,
+    0xDA, 0x36, 0x93, 0xB2, 0xA4, 0x04, 0x10, 0x3C, 0x2D, 0x52, 0xF0, 0xA9, 0x48, 0x33, 0x7F, 0x95,
+    0xB5, 0x1F, 0xB0, 0x15, 0x45, 0x34, 0x2A, 0xC2, 0x39, 0xC1, 0x14, 0x42, 0xBB, 0xDA, 0xAB, 0xDE,
+    0x52, 0xAB, 0xD3, 0x4A, 0x3D, 0xA6, 0x50, 0xFE, 0x3E, 0x52, 0x77, 0x4F, 0xA9, 0x33, 0xF4, 0x8C,
+    0x94, 0x58, 0x30, 0x50, 0xC2, 0x87, 0x41, 0x32, 0xBC, 0x50, 0x9F, 0x38, 0xC4, 0x2B, 0xD7, 0x14,
+    0x02, 0x42, 0x91, 0x8E, 0x4B, 0x4A, 0x10, 0x06, 0x06, 0x6A, 0x74, 0xBC, 0x86, 0x2D, 0x7D, 0x39,
+    0xD4, 0x5B, 0xA4, 0x44, 0x2D, 0x4F, 0x6D, 0xFE, 0x3A, 0x9D, 0xD8, 0x66, 0x31, 0xBD, 0x8D, 0x51,
+    0xE9, 0x32, 0xFB, 0x78, 0x3E, 0x15, 0xB8, 0xE4, 0xCA, 0x45, 0xD9, 0xA2, 0xC0, 0x47, 0x4C, 0xF7,
+    0x92, 0xE3, 0x16, 0x92, 0xC5, 0xE4, 0x1D, 0x0F, 0x67, 0x80, 0xA0, 0x5C, 0x65, 0xB8, 0xC6, 0x24,
+    0xA1, 0x9A, 0x28, 0x55, 0x0C, 0x9E, 0xAD, 0xBE, 0x6F, 0x57, 0xA6, 0x1A, 0x85, 0x50, 0x4D, 0x0A,
+    0x69, 0x49, 0x90, 0x7A, 0xD5, 0x46, 0xDD, 0xB0, 0x77, 0xF0, 0xDD, 0x31, 0x95, 0x1D, 0xAC, 0xB2,
+    0x77, 0x8E, 0xEF, 0xAC, 0xE7, 0x9B, 0xF9, 0xFF, 0x62, 0x2A, 0x35, 0x13, 0x4E, 0xCA, 0xB1, 0xF8,
+    0x54, 0x3C, 0x5D, 0x22, 0x72, 0x5A, 0x2B, 0x68, 0x57, 0x5B, 0xD9, 0x61, 0x2B, 0xDF, 0x65, 0x8D,
+    0x9E, 0x39, 0x5C, 0x51, 0x70, 0xB7, 0x42, 0xD0, 0x8C, 0x79, 0x70, 0x4E, 0x01, 0xAA, 0x65, 0xA7,
+    0xFC, 0xDA, 0xEA, 0x29, 0x6A, 0x81, 0x32, 0xBD, 0x71, 0xA9, 0x71, 0x63, 0xA8, 0x16, 0xAD, 0xCF,
+    0x99, 0x85, 0xAB, 0x1C, 0xF6, 0xC5, 0xA2, 0xE5, 0xC9, 0xEB, 0xEA, 0x0F, 0x46, 0xA0, 0x5E, 0x1A,
+    0x54, 0x2B, 0x94, 0xE4, 0x5A, 0xB2, 0x13, 0xB4, 0x38, 0xCF, 0x67, 0x9A, 0x45, 0xD8, 0xA4, 0x5B,
+    0x76, 0x91, 0xDF, 0x92, 0xB9, 0x92, 0x46, 0x83, 0xE2, 0x71, 0xCA, 0xA2, 0xD3, 0xF2, 0x74, 0x52,
+    0xCC, 0x74, 0xA2, 0x69, 0x6B, 0x77, 0x4A, 0xCC, 0x40, 0x5F, 0xD6, 0x9E, 0x0E, 0xA5, 0xE6, 0xE6,
+    0x29, 0x71, 0x62, 0x9F, 0x4B, 0xB1, 0xE1, 0xD2, 0xCC, 0x5B, 0xDB, 0x3C, 0xD7, 0xA5, 0x1B, 0x69,
+    0x69, 0xD2, 0xA5, 0x41, 0xBA, 0x37, 0xB8, 0x7D, 0x15, 0x7F, 0x2A, 0xFA, 0xE4, 0x25, 0xEC, 0x6E,
+    0xF3, 0x74, 0x9D, 0x83, 0x7E, 0x69, 0x02, 0xB1, 0xDB, 0xB7, 0xE8, 0x73, 0x3C, 0x89, 0xF4, 0x21,
+    0x49, 0x4D, 0x1C, 0xAB, 0x63, 0x75, 0xB0, 0xBA, 0x32, 0x71, 0x88, 0x62, 0xBF, 0x90, 0x4C, 0x57,
+    0x8A, 0x70, 0x72, 0x31, 0xEB, 0x17, 0x40, 0x92, 0x1B, 0xD4, 0x86, 0xD5, 0x8B, 0xA8, 0x60, 0xD0,
+    0x66, 0x4A, 0xFF, 0x26, 0xFE, 0x1C, 0xA4, 0xF6, 0x05, 0x05, 0xEA, 0xCB, 0x31, 0x5F, 0xA4, 0xE9,
+    0xCB, 0x89, 0xDF, 0xAF, 0x66, 0xE0, 0x6D, 0x88, 0xB6, 0xF2, 0x2C, 0x38, 0xE3, 0x2A, 0xCE, 0xC5,
+    0x8C, 0xC4, 0x49, 0xE9, 0x3D, 0x85, 0xB5, 0x2E, 0x61, 0x56, 0x8F, 0x9B, 0xE1, 0xF4, 0x34, 0xC3,
+    0xAB, 0xFB, 0x76, 0x56, 0x9F, 0xE0, 0x91, 0x0E, 0x21, 0x4D, 0x9D, 0xA2, 0x1E, 0x59, 0x0D, 0x74,
+    0x8C, 0xFD, 0xFB, 0xD0, 0xFA, 0x55, 0x7F, 0x8B, 0xF5, 0xDE, 0xDC, 0x59, 0xE1, 0x64, 0x4A, 0xEC,
+    0xBE, 0x4A, 0xB8, 0x3F, 0x9B, 0xAE, 0xF7, 0x80, 0xA2, 0xFF, 0x85, 0xD5, 0xA6, 0x97, 0x29, 0x6D,
+    0xF5, 0xF2, 0x04, 0xDC, 0xB1, 0xBA, 0x43, 0xCB, 0x90, 0x5F, 0x43, 0x97, 0xE1, 0xA6, 0x55, 0x5D,
+    0x16, 0x0A, 0x4C, 0x24, 0xB6, 0xFD, 0x1C, 0x9C, 0x19, 0x48, 0x4E, 0x02, 0x17, 0x13, 0x38, 0x1A,
+    0xC0, 0xF8, 0x72, 0x05, 0x27, 0xDF, 0xDA, 0x3E, 0x00, 0xAD, 0x55, 0x31, 0x8E, 0xDD, 0x36, 0x10,
+    0x1D, 0x49, 0x58, 0x0B, 0x88, 0x80, 0x30, 0x8D, 0x8B, 0x54, 0x3C, 0x02, 0x4F, 0x90, 0x25, 0x11,
+    0x17, 0x29, 0xED, 0x22, 0xBE, 0x41, 0xAA, 0x9C, 0x21, 0x58, 0xCA, 0xBB, 0x45, 0x5A, 0x17, 0xEE,
+    0xD3, 0xA4, 0xB1, 0x1B, 0xDF, 0x60, 0x45, 0xEF, 0x16, 0x29, 0xB6, 0x88, 0x02, 0x1F, 0xC0, 0x2A,
+    0xD2, 0x9B, 0x08, 0x04, 0x58, 0x81, 0x29, 0x4D, 0xDE, 0x48, 0xFA, 0x7F, 0xA5, 0xBF, 0x2E, 0x23,
+    0x52, 0xC3, 0x4F, 0x7D, 0x8A, 0x7C, 0x6F, 0xE6, 0xCD, 0x28, 0x73, 0xCF, 0xEC, 0xAF, 0x37, 0xFC,
+    0x9B, 0x7A, 0x9B, 0xCE, 0x4D, 0xFB, 0xD3, 0xB7, 0xB4, 0xBF, 0xB8, 0xCE, 0x27, 0xAA, 0x06, 0x32,
+    0x1D, 0x35, 0x75, 0x36, 0x51, 0x39, 0x90, 0xEE, 0xC8, 0x1F, 0x7E, 0x46, 0xF2, 0x21, 0x63, 0x2A,
+    0x13, 0x99, 0x48, 0x4D, 0xC8, 0x99, 0xD4, 0x48, 0xB6, 0x27, 0x6E, 0xF5, 0xD5, 0xED, 0xF4, 0xDD,
+    0xC5, 0xE7, 0xBB, 0xBB, 0xF4, 0x8B, 0x71, 0xF7, 0xFB, 0x99, 0x3A, 0x1F, 0x0E, 0xA6, 0x18, 0xC8,
+    0xAE, 0x26, 0x91, 0x0D, 0x8B, 0x19, 0xE9, 0xEC, 0xE7, 0xE6, 0x05, 0x73, 0xB2, 0xCC, 0xEF, 0xDF,
+    0xBC, 0xFE, 0x91, 0xBE, 0x78, 0xD9, 0x8E, 0x80, 0x4B, 0x50, 0xAD, 0x03, 0xF0, 0x08, 0xB0, 0x93,
+    0x81, 0x49, 0x20, 0xAE, 0x03, 0xC0, 0x09, 0x4A, 0x19, 0x80, 0xB0, 0x60, 0x27, 0x03, 0x51, 0xE6,
+    0x0C, 0x33, 0x31, 0x4F, 0x15, 0x0E, 0x7D, 0xEC, 0x1E, 0x9E, 0x65, 0x6A, 0xA2, 0x6B, 0x22, 0x40,
+    0xA6, 0xAA, 0x5B, 0xA6, 0xD8, 0x1E, 0xB8, 0x49, 0x61, 0x6A, 0x31, 0xC5, 0x8E, 0x00, 0x4F, 0x2A,
+    0x62, 0x1A, 0x30, 0x75, 0xA4, 0x86, 0x6A, 0x6D, 0xE5, 0xB6, 0xA5, 0xA5, 0x55, 0x73, 0x53, 0xE3,
+    0xDC, 0x5A, 0xE3, 0x2C, 0x90, 0x98, 0xE1, 0x51, 0x2F, 0x5B, 0xA8, 0xA8, 0xA3, 0xE9, 0x4D, 0xFF,
+    0x78, 0x65, 0x5E, 0x75, 0x87, 0xA6, 0x0E, 0x2D, 0xAE, 0xAD, 0xAF, 0xA2, 0xEE, 0x6C, 0xED, 0xC9,
+    0x27, 0x8B, 0xFD, 0xE8, 0x9B, 0x33, 0xE7, 0x2F, 0x59, 0x25, 0x1B, 0x39, 0x1C, 0xC0, 0xAB, 0xC1,
+    0x74, 0xCD, 0xE5, 0x54, 0x0D, 0xBA, 0xF3, 0x2F, 0xA6, 0x72, 0x1E, 0xB8, 0x4C, 0x3A, 0xFA, 0x1B,
+    0xAE, 0x92, 0x89, 0xFC, 0x9E, 0x9F, 0x8E, 0xE6, 0x72, 0x90, 0x7E, 0x35, 0x58, 0xE9, 0xC9, 0xDE,
+    0xA2, 0x8F, 0x3E, 0x50, 0x31, 0xDA, 0xD5, 0x94, 0xB3, 0x49, 0x07, 0x53, 0xED, 0x8D, 0x1A, 0x36,
+    0xA6, 0x25, 0xD5, 0xEF, 0x8C, 0x8E, 0x88, 0xD6, 0xBD, 0x31, 0xD1, 0xC7, 0xD5, 0x74, 0x30, 0x78,
+    0x42, 0x8B, 0xF1, 0x2D, 0x7D, 0xED, 0x18, 0xEB, 0x19, 0xF0, 0x67, 0x83, 0xC0, 0x20, 0x48, 0x2C,
+    0x01, 0x63, 0xF8, 0xF7, 0x51, 0xF3, 0x72, 0x23, 0x4C, 0xD2, 0xB7, 0x89, 0xBC, 0x8E, 0x79, 0x6A,
+    0x5A, 0xF5, 0x0F, 0x16, 0x9E, 0x3D, 0xDF, 0x45, 0xED, 0x66, 0xA0, 0xA6, 0xEA, 0xF2, 0x64, 0xEA,
+    0xAA, 0xBB, 0x26, 0x90, 0xA3, 0x6B, 0xD5, 0xE5, 0x83, 0xAD, 0x55, 0x3B, 0x91, 0x7D, 0x32, 0xD0,
+    0xA8, 0x62, 0xD1, 0xDB, 0xA0, 0x02, 0x93, 0x45, 0xF8, 0x92, 0xEA, 0xCB, 0x25, 0x80, 0x1A, 0x07,
+    0xFA, 0x01, 0x42, 0x01, 0x81, 0x69, 0x2B, 0x3A, 0x9A, 0xA5, 0x46, 0x5A, 0x24, 0xC7, 0x60, 0xF2,
+    0xD7, 0x44, 0xB2, 0xFB, 0x83, 0x94, 0xC1, 0xD2, 0x16, 0xCB, 0x10, 0x4F, 0x24, 0xC6, 0x2C, 0x3F,
+    0xE4, 0xC6, 0x2C, 0x3E, 0xF8, 0x0B, 0x5A, 0x99, 0x36, 0xAB, 0x14, 0x56, 0x41, 0xF4, 0xCB, 0x2A,
+    0xBF, 0x59, 0x95, 0x1F, 0x57, 0x75, 0xC5, 0xDF, 0xBE, 0xCF, 0xA0, 0x4E, 0xF2, 0xF0, 0x85, 0xA8,
+    0x55, 0xC1, 0x31, 0xD9, 0xDB, 0x2D, 0xB6, 0xBC, 0x9F, 0xDF, 0x06, 0xF4, 0x92, 0x53, 0x36, 0xA9,
+    0xE8, 0x9D, 0x09, 0x7B, 0x5C, 0x22, 0x60, 0xA8, 0xB5, 0x58, 0x07, 0xBC, 0x60, 0xDD, 0x32, 0x00,
+    0x41, 0x3C, 0x1D, 0x3C, 0x50, 0x44, 0x51, 0x7A, 0x2E, 0x4C, 0x47, 0xE4, 0x4B, 0x58, 0xF2, 0xE5,
+    0x70, 0x35, 0x98, 0xE4, 0x22, 0xB4, 0x4A, 0x70, 0x18, 0xF9, 0x4B, 0x66, 0xA5, 0xF0, 0x30, 0x83,
+    0xCC, 0xC0, 0x2E, 0x7B, 0xFE, 0x30, 0x9D, 0x5A, 0x1B, 0x89, 0xBF, 0x67, 0x24, 0xBD, 0x4A, 0x10,
+    0x7C, 0xD3, 0x92, 0xFD, 0x63, 0x02, 0x7F, 0x3C, 0x2E, 0xFF, 0x05, 0x61, 0xFD, 0x11, 0xEC, 0x1B,
+    0xBC, 0x9D, 0x33, 0x76, 0x56, 0x2C, 0x98, 0x10, 0x5E, 0x92, 0x59, 0x21, 0x46, 0x8B, 0x22, 0xC4,
+    0x15, 0x78, 0x87, 0xE1, 0x2B, 0xCF, 0x0E, 0x7A, 0x62, 0xC7, 0xA1, 0xE1, 0x2B, 0xC6, 0xAB, 0xB5,
+    0x64, 0xA2, 0x24, 0xE7, 0xF1, 0x6E, 0xEF, 0x6F, 0x0D, 0x90, 0xFA, 0x76, 0x24, 0xFD, 0x67, 0x8F,
+    0xA3, 0xC0, 0x6D, 0x16, 0x1A, 0x09, 0x47, 0x8C, 0xA2, 0x37, 0x00, 0x62, 0x54, 0xA5, 0x0F, 0x90,
+    0xC9, 0x1D, 0x07, 0x7B, 0xC3, 0xD1, 0x06, 0xD1, 0xDF, 0xFE, 0xCA, 0x58, 0x0A, 0x4C, 0xBB, 0xB0,
+    0xC6, 0x9D, 0x01, 0xBA, 0x14, 0x95, 0x82, 0x17, 0x97, 0x7C, 0xF5, 0x7A, 0x49, 0xC0, 0x1F, 0x3A,
+    0xF5, 0x34, 0x68, 0x53, 0x6B, 0x2F, 0x47, 0xC0, 0x33, 0xE0, 0x29, 0x1D, 0x3F, 0x98, 0xCE, 0x7D,
+    0xB8, 0x30, 0xF1, 0x42, 0x8D, 0x85, 0x54, 0x16, 0x90, 0x4C, 0x4B, 0x91, 0xB1, 0xF7, 0x75, 0x48,
+    0x04, 0x22, 0x42, 0x39, 0x2D, 0x32, 0xCB, 0x54, 0xC7, 0x39, 0xEE, 0xA2, 0x9E, 0x72, 0x9D, 0x42,
+    0x6A, 0x52, 0xE3, 0x44, 0x43, 0xE6, 0x33, 0x8F, 0xCC, 0xFC, 0x09, 0xF7, 0x07, 0xDC, 0xF0, 0x19,
+    0x48, 0xD2, 0x39, 0x4E, 0x52, 0xA1, 0xEC, 0x8A, 0x7E, 0x57, 0x52, 0x9D, 0x6A, 0xCB, 0x98, 0x41,
+    0x64, 0x64, 0x42, 0x85, 0xB4, 0xA2, 0x06, 0x07, 0xA9, 0x0E, 0x7A, 0x81, 0x23, 0xEA, 0xC3, 0x8F,
+    0x57, 0x0A, 0x3E, 0x8E, 0x9C, 0xD4, 0x1C, 0x8D, 0x7A, 0x09, 0x33, 0xF8, 0x90, 0x96, 0xFA, 0x38,
+    0xD2, 0xCC, 0x3F, 0x13, 0x9F, 0xBC, 0x79, 0x79, 0xE2, 0x31, 0x91, 0xB9, 0x14, 0xC7, 0x19, 0xBF,
+    0xF0, 0x10, 0x02, 0x42, 0xE4, 0xF8, 0xE0, 0x98, 0x2E, 0x92, 0x08, 0x7A, 0x7D, 0x90, 0xEF, 0xF2,
+    0x67, 0x62, 0x7E, 0x02, 0x2A, 0x2D, 0xEE, 0x1E, 0xA5, 0x61, 0x44, 0x2A, 0xB0, 0x03, 0x13, 0xEB,
+    0x90, 0xBD, 0x9E, 0x60, 0x1A, 0x11, 0xEE, 0x6C, 0x58, 0x82, 0x3F, 0x9D, 0x98, 0x67, 0x8A, 0x6B,
+    0xC0, 0xE7, 0x5D, 0x76, 0x20, 0x58, 0xDC, 0xE1, 0xD3, 0xC5, 0x41, 0x0D, 0x39, 0x3B, 0x1B, 0x21,
+    0xE3, 0xA6, 0x5B, 0xFC, 0xEE, 0x36, 0x7E, 0xD7, 0x28, 0x16, 0xBE, 0x48, 0x79, 0x52, 0xB1, 0x8A,
+    0x3E, 0xD8, 0x77, 0x4C, 0x53, 0x99, 0xF2, 0xDF, 0xD7, 0x30, 0x1C, 0xFD, 0x2E, 0x61, 0xF8, 0xB8,
+    0xF3, 0xBB, 0xE0, 0x9D, 0xBF, 0x23, 0xD7, 0xF3, 0xE7, 0x63, 0x42, 0x15, 0x52, 0xED, 0xA8, 0xDF,
+    0x8D, 0xD0, 0x23, 0xBA, 0xD9, 0x74, 0x78, 0x03, 0x09, 0xFA, 0x85, 0xFE, 0x8A, 0xEC, 0x24, 0xAA,
+    0xB1, 0x4C, 0xFF, 0xDB, 0xF5, 0x1F, 0xBD, 0x55, 0x3D, 0x6F, 0x25, 0x35, 0x14, 0xBD, 0x33, 0x96,
+    0x32, 0xC5, 0x14, 0x53, 0xA5, 0x76, 0x8B, 0xD2, 0xF8, 0x27, 0xF8, 0x21, 0x4A, 0x8A, 0xCD, 0x4A,
+    0x41, 0x94, 0x34, 0xF4, 0xFB, 0x0B, 0xD8, 0x79, 0xD2, 0xFE, 0x80, 0x7D, 0x48, 0xDB, 0xD1, 0xA4,
+    0x41, 0x42, 0xEF, 0x4F, 0x78, 0xA2, 0x57, 0xA4, 0x48, 0x91, 0x81, 0x94, 0x14, 0x3B, 0x6C, 0x22,
+    0x5A, 0x4C, 0x32, 0x52, 0x66, 0x85, 0xED, 0xCB, 0xB9, 0xF6, 0x23, 0x44, 0x4B, 0x68, 0x10, 0x60,
+    0x79, 0x3C, 0xFE, 0xB8, 0x63, 0xDF, 0x73, 0xEE, 0xF1, 0x1D, 0x3B, 0x12, 0xF1, 0x8A, 0x54, 0x20,
+    0xEA, 0x7C, 0x3B, 0xDB, 0xC1, 0x8E, 0x4C, 0xFC, 0x2A, 0xA8, 0xD4, 0x79, 0x1D, 0xFA, 0xE1, 0xF0,
+    0x39, 0x13, 0x35, 0x58, 0xD5, 0x9E, 0xA8, 0x1F, 0xA8, 0xC6, 0xB0, 0xC5, 0xD0, 0x60, 0xE8, 0x7E,
+    0xE1, 0x7B, 0x66, 0x7E, 0x8B, 0xA7, 0x67, 0x8E, 0x78, 0xCD, 0xDD, 0x48, 0xA8, 0x7A, 0xC8, 0xF5,
+    0xEC, 0xC4, 0xEC, 0x82, 0xD9, 0x45, 0xA9, 0xE7, 0xC9, 0x5E, 0x24, 0xBB, 0xA6, 0x27, 0xEA, 0x1B,
+    0xB2, 0x89, 0x2C, 0x4B, 0x2D, 0xE5, 0xCB, 0xDC, 0xDA, 0x41, 0xDA, 0x2A, 0xE6, 0x41, 0x37, 0xE5,
+    0x97, 0xCB, 0x6D, 0xB3, 0x3C, 0x32, 0xA8, 0xB3, 0x01, 0x3F, 0x83, 0x3F, 0xA4, 0x62, 0xDE, 0xA2,
+    0xFB, 0x2D, 0x1B, 0x58, 0xCE, 0x06, 0x9C, 0x0D, 0x14, 0xFB, 0xBC, 0x54, 0xCE, 0xB0, 0xD9, 0xA0,
+    0x2A, 0x06, 0x4D, 0x39, 0x42, 0x67, 0x03, 0x2A, 0x73, 0x6D, 0xB1, 0xEB, 0xC3, 0xA3, 0x6F, 0xF5,
+    0x7E, 0x3F, 0x76, 0x3C, 0xC2, 0x00, 0x65, 0x45, 0xC0, 0x8D, 0xFD, 0x55, 0x12, 0xEC, 0x64, 0xEE,
+    0xF0, 0x1A, 0x85, 0x4E, 0x39, 0x29, 0x94, 0x1D, 0xF2, 0x37, 0x2A, 0xE5, 0x81, 0xF1, 0xE5, 0xD8,
+    0x62, 0xB0, 0xC9, 0x73, 0xC7, 0x7B, 0xD0, 0xC2, 0x1B, 0x1C, 0xC3, 0x52, 0x25, 0x5F, 0x36, 0x62,
+    0xAA, 0x87, 0x3D, 0xE6, 0x5A, 0xA6, 0x5A, 0x99, 0x32, 0x32, 0xC5, 0x2F, 0x11, 0x31, 0x06, 0x86,
+    0x2E, 0xED, 0x51, 0x38, 0x74, 0x0C, 0x66, 0x5A, 0x7E, 0x36, 0xD1, 0xC1, 0x06, 0xB4, 0x12, 0xA5,
+    0x63, 0x71, 0x7D, 0x12, 0xD0, 0x03, 0x15, 0x76, 0x35, 0xB6, 0x57, 0xB2, 0xCD, 0xCB, 0xFD, 0x81,
+    0x55, 0xA0, 0xA7, 0x0B, 0xEB, 0x99, 0xBA, 0x5F, 0x79, 0xA8, 0x92, 0x8E, 0xA4, 0xDF, 0xB1, 0xAF,
+    0x92, 0xE1, 0x95, 0x79, 0xC7, 0xA1, 0x8E, 0x96, 0x47, 0x73, 0xC5, 0xAC, 0xD0, 0x99, 0xED, 0x15,
+    0xF7, 0xBB, 0x68, 0xEF, 0xA2, 0xDD, 0xB1, 0xB9, 0x0E, 0xBD, 0xE7, 0xFE, 0x9C, 0x5B, 0x46, 0xA7,
+    0xE7, 0x0B, 0x56, 0x1C, 0x9C, 0xD7, 0xE8, 0x10, 0x07, 0xF6, 0x2D, 0x5F, 0x72, 0xA6, 0xFE, 0xAB,
+    0xE2, 0x85, 0x86, 0x97, 0x71, 0x0F, 0xF5, 0x2F, 0x25, 0xB8, 0x8D, 0x62, 0x9E, 0x34, 0x18, 0xED,
+    0x6F, 0xFA, 0xB3, 0x44, 0x3D, 0xEC, 0x82, 0x19, 0xD4, 0xEC, 0xA8, 0xFB, 0x21, 0x50, 0xFF, 0x7A,
+    0xAE, 0x92, 0x1D, 0xDB, 0x05, 0x5E, 0x5D, 0x27, 0x72, 0x97, 0x8B, 0x62, 0x3B, 0x65, 0xD6, 0xE1,
+    0xF7, 0x0A, 0x00, 0x02, 0xE9, 0x9F, 0x78, 0x14, 0xBF, 0x05, 0xC0, 0x5C, 0xA3, 0x33, 0xC0, 0xEF,
+    0x28, 0x00, 0x3C, 0xFC, 0xE6, 0x4F, 0xA2, 0xBD, 0x0F, 0xE8, 0xD8, 0xAB, 0x60, 0x6F, 0x93, 0x3D,
+    0xE7, 0xEE, 0x1E, 0x7E, 0x3B, 0x3E, 0xE7, 0x46, 0xFC, 0xB6, 0xF0, 0xBB, 0x92, 0x4E, 0x27, 0x7E,
+    0x3B, 0x00, 0x50, 0xBC, 0xA6, 0x07, 0x75, 0x88, 0x28, 0x5A, 0x89, 0xAB, 0x1B, 0x4B, 0xB4, 0x73,
+    0x20, 0xCC, 0x2C, 0xA4, 0x63, 0xF6, 0xE8, 0xB4, 0xE0, 0xB0, 0xE6, 0x06, 0x92, 0x59, 0x1A, 0x08,
+    0x44, 0xBF, 0xD7, 0xBE, 0x5F, 0xEB, 0xB3, 0x40, 0x16, 0xB1, 0x8C, 0x05, 0x8B, 0xBE, 0x8E, 0x82,
+    0xA5, 0x2E, 0x58, 0xD6, 0xE6, 0x2E, 0x11, 0x0B, 0x96, 0x12, 0x05, 0x8F, 0x0B, 0x37, 0xE4, 0x63,
+    0x64, 0x63, 0x74, 0x1B, 0x7E, 0xE8, 0xD6, 0x5B, 0x58, 0x9C, 0xD0, 0x21, 0x84, 0xA1, 0x47, 0x32,
+    0x3F, 0x62, 0xD6, 0x81, 0xCE, 0x5A, 0xE4, 0x95, 0xEF, 0xCB, 0x47, 0xFF, 0x7F, 0x6C, 0x0F, 0x4E,
+    0xE9, 0xBB, 0x3A, 0xB6, 0x33, 0x39, 0x37, 0x40, 0x90, 0x25, 0x57, 0x28, 0x78, 0x46, 0xA7, 0x4F,
+    0xBA, 0xD2, 0x5D, 0xBC, 0x87, 0x3C, 0x79, 0x2D, 0x61, 0x16, 0x7A, 0xF4, 0xD4, 0x78, 0x3D, 0x28,
+    0x2F, 0xDC, 0x94, 0xA7, 0x59, 0xEC, 0x28, 0x4F, 0x5B, 0x9E, 0xA9, 0x0D, 0x12, 0xE5, 0x12, 0xE9,
+    0xA3, 0x92, 0xB8, 0x90, 0x08, 0x14, 0x80, 0xDB, 0xE9, 0x8F, 0x7B, 0xF6, 0x41, 0x51, 0xB7, 0x69,
+    0x25, 0x87, 0xE0, 0xB2, 0x7E, 0xCC, 0x5F, 0x73, 0xB3, 0x54, 0x41, 0xCE, 0x28, 0x3A, 0xB2, 0x9F,
+    0x7A, 0xD1, 0x51, 0x93, 0x75, 0x14, 0xC9, 0xBD, 0x5E, 0xEA, 0xAC, 0x23, 0x5E, 0x5B, 0xFF, 0x9F,
+    0x6B, 0x49, 0x2E, 0xC3, 0xE7, 0xE8, 0x74, 0xC8, 0x1E, 0x35, 0x4B, 0x68, 0xD3, 0xEA, 0xC1, 0xED,
+    0x7F, 0xAE, 0x1C, 0x70, 0x53, 0xF5, 0x13, 0xF8, 0x5F, 0x23, 0x36, 0x54, 0x9D, 0x10, 0x1D, 0x6E,
+    0xA3, 0x24, 0x88, 0x7C, 0x14, 0x44, 0xD5, 0x6C, 0xBF, 0x3D, 0xF9, 0x1B, 0x71, 0x1C, 0xF0, 0x46,
+    0x52, 0x1D, 0x2C, 0xD1, 0x00, 0x36, 0x7F, 0xC3, 0x43, 0x17, 0xC9, 0x2C, 0x88, 0xA4, 0x62, 0x21,
+    0xB8, 0xFF, 0x3E, 0x1F, 0x81, 0x00, 0x57, 0x60, 0x0A, 0xE3, 0x4B, 0xC9, 0x44, 0x77, 0x31, 0xE7,
+    0x5F, 0x80, 0xE2, 0x3E, 0x4F, 0xCA, 0x4F, 0xE2, 0x56, 0xB6, 0x09, 0x2E, 0x3D, 0xEF, 0x59, 0x4B,
+    0xC2, 0x7C, 0x25, 0xCD, 0x28, 0x49, 0xD3, 0x4B, 0x02, 0xF5, 0x92, 0x3F, 0x3D, 0x55, 0x8E, 0x37,
+    0x7F, 0x3A, 0x70, 0xB8, 0x85, 0xA2, 0x38, 0x62, 0x7D, 0x39, 0xDA, 0x7E, 0x76, 0xFC, 0xA1, 0x7F,
+    0xB8, 0x6D, 0x86, 0x3D, 0xC8, 0xF2, 0xDD, 0x6C, 0x26, 0xB7, 0xB2, 0x3B, 0xE4, 0x02, 0x24, 0x3D,
+    0xFC, 0x5C, 0xD4, 0x92, 0xA8, 0xBB, 0x96, 0xE1, 0xD2, 0x44, 0x80, 0x05, 0xEB, 0xBC, 0x76, 0x00,
+    0xE1, 0x70, 0x5B, 0x5E, 0xCC, 0xFB, 0x0D, 0xF4, 0x68, 0xD6, 0x40, 0xC2, 0xF2, 0xE3, 0x93, 0x3B,
+    0xAC, 0x59, 0x56, 0xDC, 0x13, 0xFA, 0xAC, 0xDC, 0x0D, 0xB2, 0x13, 0x92, 0x90, 0x34, 0x8C, 0xE6,
+    0x67, 0x09, 0xDB, 0xAA, 0x4D, 0xF2, 0x13, 0xE4, 0x41, 0xB0, 0xCD, 0xC8, 0xEF, 0x8A, 0x25, 0xAF,
+    0x67, 0x16, 0x34, 0x62, 0x00, 0x49, 0xCA, 0x0D, 0xCC, 0x2C, 0xD8, 0xB7, 0x79, 0x32, 0xDF, 0x03,
+    0x27, 0xDB, 0x18, 0x7E, 0xF3, 0x05, 0x34, 0x81, 0x32, 0x49, 0x33, 0x0B, 0x2B, 0xA1, 0xE6, 0xC2,
+    0x34, 0x1A, 0x7A, 0xC1, 0x37, 0x8F, 0x3C, 0xB0, 0x6B, 0xBB, 0x02, 0x80, 0x0A, 0xE6, 0x22, 0x8F,
+    0xCA, 0x6D, 0xFE, 0x5D, 0x2E, 0x88, 0x7E, 0x07, 0xBD, 0x55, 0xBB, 0x8E, 0xDE, 0x44, 0x14, 0x3E,
+    0xB6, 0xB5, 0x6B, 0x29, 0x2E, 0x26, 0x4D, 0x9A, 0x6C, 0xE1, 0x07, 0xA0, 0xF0, 0x1B, 0xC4, 0xA3,
+    0x8D, 0x04, 0x05, 0x05, 0x41, 0x62, 0x29, 0x78, 0x01, 0x84, 0x14, 0x69, 0xDF, 0x20, 0x1E, 0xF1,
+    0x02, 0xA4, 0x4F, 0x93, 0x2A, 0x82, 0x34, 0xB4, 0x14, 0x88, 0xB1, 0x94, 0x17, 0xF0, 0x12, 0xD1,
+    0xBB, 0x48, 0x15, 0x9A, 0x29, 0x1C, 0x34, 0x7F, 0x64, 0xFB, 0xF0, 0x7D, 0xE3, 0xDF, 0xC9, 0x92,
+    0xAD, 0x40, 0x11, 0xBF, 0xBC, 0xBE, 0xCC, 0xED, 0x7C, 0x97, 0x73, 0xCE, 0x4A, 0xF6, 0x95, 0x9C,
+    0x3C, 0x90, 0xB6, 0x17, 0x6F, 0xCB, 0x59, 0xCC, 0x24, 0xBE, 0xCF, 0xD4, 0x9A, 0x59, 0x9A, 0x20,
+    0x37, 0x7F, 0xA7, 0xFA, 0x58, 0x24, 0x53, 0x8D, 0x22, 0xB5, 0xEA, 0x8C, 0xD7, 0x83, 0xC7, 0xAE,
+    0x45, 0x9A, 0x88, 0x8D, 0xD2, 0x86, 0x62, 0x15, 0xE9, 0x86, 0x1A, 0x7B, 0xB5, 0xC7, 0x40, 0xA6,
+    0x1C, 0x28, 0x67, 0x83, 0x0D, 0x26, 0xB4, 0x83, 0x48, 0x3B, 0xA8, 0xC3, 0xE4, 0xFD, 0x6D, 0x78,
+    0x16, 0xC4, 0xC1, 0xDE, 0x0C, 0xAB, 0xD7, 0x2F, 0x3B, 0xC5, 0xD1, 0x38, 0xBC, 0xE0, 0x7D, 0x28,
+    0x79, 0x97, 0x0A, 0xB7, 0x20, 0x7C, 0x47, 0x60, 0xCF, 0xF0, 0xDB, 0x2F, 0x7B, 0x20, 0x27, 0x36,
+    0x5B, 0x71, 0x88, 0x78, 0x97, 0xAB, 0xB4, 0xA3, 0xA8, 0xAB, 0xA3, 0x74, 0xE3, 0x4D, 0xD4, 0xB9,
+    0x5A, 0xDE, 0x70, 0x82, 0x78, 0x80, 0x06, 0xCB, 0x66, 0x94, 0x7C, 0x11, 0x0C, 0xB4, 0x7D, 0x39,
+    0x49, 0x11, 0xA5, 0x75, 0xB8, 0xF0, 0x3C, 0xBE, 0xA6, 0xD1, 0x15, 0x42, 0x48, 0xC3, 0xF0, 0xA2,
+    0x0A, 0xBC, 0x80, 0xD2, 0x03, 0x2F, 0xBF, 0xE5, 0x72, 0x4A, 0x6A, 0x5C, 0x5D, 0x7C, 0xF3, 0xDC,
+    0xD6, 0x04, 0xAA, 0xFD, 0xF6, 0x08, 0xB5, 0x3E, 0x21, 0x07, 0x68, 0xD2, 0x22, 0x54, 0x35, 0x4B,
+    0x81, 0x30, 0x9B, 0x2C, 0xA0, 0x09, 0xDD, 0x30, 0x0A, 0x65, 0x4A, 0x06, 0x07, 0x0A, 0xFD, 0x73,
+    0xA2, 0x38, 0x5E, 0x97, 0x62, 0xE1, 0xE1, 0x6A, 0xA1, 0x0F, 0x22, 0x0D, 0x69, 0x72, 0x10, 0x4A,
+    0xE4, 0x03, 0x5E, 0x7B, 0x69, 0xF8, 0xAA, 0xCF, 0xBC, 0x26, 0xF1, 0x55, 0x5F, 0x3F, 0xBF, 0xAF,
+    0x5B, 0xCC, 0x2E, 0x3D, 0xE6, 0x6A, 0xFB, 0xB4, 0xDB, 0xE7, 0x08, 0xB9, 0x38, 0xBA, 0xAB, 0xD0,
+    0xC4, 0xCC, 0x3B, 0xEC, 0x9C, 0xBC, 0x5A, 0xAE, 0x7C, 0x3D, 0x8B, 0x9E, 0x6B, 0x28, 0xC7, 0x66,
+    0x30, 0xEB, 0x9D, 0xAE, 0x98, 0x05, 0xFB, 0x22, 0x54, 0xC0, 0xDC, 0x0B, 0xC8, 0x80, 0xAD, 0xF8,
+    0x58, 0x2F, 0x84, 0x33, 0x3D, 0xD1, 0xD6, 0x60, 0x71, 0x8E, 0xD9, 0xD5, 0xFE, 0x62, 0x52, 0x08,
+    0x97, 0x22, 0x44, 0x48, 0x0B, 0x40, 0x70, 0xC1, 0x9E, 0xAD, 0x76, 0x73, 0x87, 0xF2, 0x30, 0xF2,
+    0x23, 0xFC, 0xB5, 0x18, 0xAB, 0xFB, 0xF7, 0x76, 0x34, 0xFA, 0x2A, 0x69, 0x59, 0x10, 0xDC, 0x2A,
+    0x9D, 0x6D, 0x5D, 0x35, 0x9A, 0x31, 0x9F, 0x21, 0xBE, 0xC7, 0x40, 0xDB, 0xB7, 0xAE, 0x19, 0x11,
+    0x61, 0x82, 0xED, 0x31, 0xE3, 0xAA, 0x8E, 0xFA, 0x2E, 0xF5, 0x54, 0x2D, 0x99, 0xE6, 0xEA, 0xBA,
+    0xC1, 0x8F, 0x75, 0x6C, 0x62, 0xA9, 0x06, 0x26, 0xBD, 0xD4, 0xBE, 0x8B, 0x14, 0xFE, 0x5D, 0x84,
+    0x7B, 0x22, 0xBF, 0x32, 0x7E, 0x0E, 0x43, 0x89, 0x44, 0xCC, 0x5F, 0xD1, 0xE8, 0x9C, 0xAE, 0x1F,
+    0x91, 0xE3, 0x26, 0xBC, 0xBF, 0xEA, 0x74, 0x21, 0xDB, 0x9B, 0x49, 0x5A, 0x5C, 0x71, 0x3B, 0xA2,
+    0x9B, 0x36, 0xAB, 0xE8, 0x53, 0xC6, 0x94, 0xF5, 0x4C, 0x5E, 0x58, 0x5F, 0x33, 0x95, 0x61, 0x55,
+    0x76, 0xF1, 0x41, 0x96, 0x55, 0x7A, 0x60, 0x92, 0x05, 0x61, 0xAE, 0xB6, 0xAE, 0x1E, 0x40, 0x29,
+    0x1E, 0x29, 0x35, 0xA0, 0x64, 0x82, 0x19, 0x2B, 0xE6, 0x36, 0x38, 0x20, 0x9D, 0x40, 0x89, 0x36,
+    0x86, 0x52, 0x3F, 0x5B, 0xA0, 0x5C, 0xD7, 0x83, 0xD2, 0x04, 0x4A, 0x6B, 0x05, 0x4A, 0x2F, 0xC0,
+    0x71, 0x02, 0xA5, 0xB5, 0x9D, 0x4B, 0xDD, 0xA5, 0x33, 0x2B, 0x03, 0x23, 0x21, 0x70, 0x01, 0x05,
+    0xC1, 0x06, 0xF1, 0xA3, 0x5C, 0xD8, 0x7D, 0xC1, 0xBF, 0x61, 0xF9, 0x9D, 0xDC, 0x72, 0x55, 0xA8,
+    0x07, 0xF1, 0x97, 0x03, 0xB0, 0x0F, 0x1B, 0x43, 0xC3, 0xF2, 0x79, 0xFA, 0x61, 0xF9, 0xC0, 0x55,
+    0x16, 0x0E, 0x52, 0xA2, 0x37, 0x63, 0x39, 0x81, 0xD4, 0x6F, 0x47, 0x52, 0x15, 0x48, 0x15, 0x30,
+    0x2E, 0x5F, 0xE5, 0x98, 0x79, 0x0E, 0xA4, 0x7A, 0x18, 0x37, 0x67, 0x7A, 0xA5, 0xD6, 0xA3, 0x17,
+    0x80, 0xD4, 0x42, 0x52, 0xDF, 0x83, 0x54, 0xD0, 0xB1, 0x5E, 0x48, 0xEA, 0x07, 0xD4, 0x7A, 0xEA,
+    0x30, 0x77, 0xE4, 0xE4, 0x7C, 0xCE, 0xE7, 0xEA, 0x8D, 0x22, 0x31, 0xFA, 0x94, 0xEB, 0x2C, 0xD1,
+    0x9D, 0x13, 0x49, 0x09, 0xE3, 0x22, 0xBE, 0xBE, 0x75, 0xA0, 0xC5, 0xB2, 0x35, 0x61, 0x7F, 0xA4,
+    0x92, 0x62, 0x7D, 0x08, 0xA9, 0x15, 0xA8, 0xD8, 0xDD, 0x41, 0x11, 0xBE, 0x94, 0x03, 0x33, 0x90,
+    0x29, 0xC9, 0x74, 0x34, 0xC3, 0x75, 0x62, 0xB7, 0x90, 0x88, 0x70, 0x6C, 0x62, 0xD9, 0xA1, 0xEB,
+    0xBD, 0x5D, 0xA4, 0x5A, 0xE4, 0xB6, 0xB0, 0x4D, 0xF1, 0xF4, 0x54, 0xB5, 0x90, 0x86, 0xE9, 0x0B,
+    0x6F, 0x49, 0xDF, 0x71, 0xE9, 0x70, 0xEC, 0x04, 0x97, 0xBC, 0xA5, 0xE9, 0x6A, 0x2D, 0x46, 0xD4,
+    0x57, 0xBB, 0x7C, 0xAA, 0xBF, 0xB3, 0x22, 0x58, 0x9E, 0x53, 0x47, 0x97, 0x4F, 0x75, 0xB5, 0xD7,
+    0xE0, 0x54, 0x43, 0x02, 0x93, 0xC5, 0x7F, 0x40, 0x39, 0xD3, 0xC7, 0x80, 0xE1, 0xCC, 0x1F, 0x0F,
+    0x99, 0xB9, 0xAC, 0x1B, 0xF6, 0x82, 0x02, 0xE8, 0x4A, 0x65, 0x6F, 0x64, 0xB7, 0x9D, 0x32, 0x69,
+    0xC6, 0x7B, 0x16, 0x22, 0xEA, 0xC2, 0x9E, 0x84, 0xCA, 0x93, 0xBB, 0x7B, 0x3B, 0x64, 0x8E, 0x53,
+    0x12, 0xAA, 0x07, 0x44, 0x14, 0xE7, 0x0B, 0xD8, 0x3E, 0x56, 0x37, 0x7A, 0xF8, 0x27, 0xD8, 0xC2,
+    0xEE, 0x22, 0xDC, 0x5F, 0xA2, 0xF9, 0x50, 0x35, 0x2B, 0x24, 0x51, 0x24, 0x81, 0xA8, 0x59, 0xB3,
+    0xB0, 0x00, 0x10, 0x7E, 0xEB, 0x7B, 0x58, 0x9A, 0xFA, 0x60, 0x6A, 0xC0, 0xFB, 0x74, 0x13, 0x8D,
+    0x43, 0xF2, 0xE9, 0x9B, 0x33, 0xFD, 0x9C, 0x5D, 0x86, 0x3D, 0xE7, 0x8A, 0xCD, 0x00, 0x6C, 0x0E,
+    0xD7, 0x02, 0xD6, 0x76, 0x73, 0x4A, 0x79, 0x18, 0x20, 0xA9, 0x2C, 0xD2, 0xBD, 0x6B, 0xE2, 0xFE,
+    0x80, 0x83, 0xA3, 0x2C, 0x5F, 0xF7, 0x10, 0x50, 0x0C, 0xBB, 0x0C, 0x15, 0x82, 0x66, 0x9D, 0xB2,
+    0x57, 0x39, 0xB0, 0xB7, 0xB7, 0xF3, 0xB5, 0x78, 0x65, 0x22, 0x10, 0x50, 0x5C, 0xA0, 0x0F, 0xD9,
+    0xCF, 0x87, 0x8F, 0xEA, 0xA0, 0x85, 0x83, 0xE5, 0xEE, 0xE0, 0x4B, 0x3A, 0xD8, 0xD0, 0xC1, 0xD3,
+    0x44, 0x9F, 0x0E, 0x96, 0x2C, 0x8B, 0x86, 0x32, 0x7F, 0x1B, 0x8E, 0xFD, 0xA0, 0xA2, 0x5C, 0x77,
+    0xED, 0x7F, 0x23, 0x42, 0xA5, 0xD0, 0xE0, 0xC2, 0x29, 0x50, 0x15, 0x58, 0x5C, 0x8F, 0xA9, 0xFC,
+    0x32, 0x68, 0x5A, 0xAD, 0x92, 0xFE, 0xF7, 0xFE, 0x24, 0xFF, 0xC7, 0xEF, 0x6F, 0xD5, 0x54, 0xBB,
+    0x6E, 0xD5, 0x40, 0x10, 0x3D, 0xB6, 0x21, 0x57, 0xE0, 0x62, 0x69, 0x90, 0x90, 0x28, 0xDC, 0xD3,
+    0xDC, 0x1F, 0x20, 0xD8, 0x12, 0x45, 0x8A, 0x34, 0x91, 0x50, 0xF2, 0x1B, 0xF9, 0x02, 0x64, 0x0B,
+    0x7E, 0x20, 0x9F, 0x90, 0x22, 0xFD, 0x6D, 0x53, 0x44, 0xAC, 0xA5, 0x14, 0x29, 0x28, 0x30, 0x11,
+    0x1D, 0x45, 0xAE, 0x44, 0x2A, 0x28, 0x30, 0xC2, 0x12, 0xBE, 0xC1, 0xEB, 0xE1, 0xCC, 0xDA, 0xB9,
+    0x90, 0x40, 0x0A, 0x50, 0xA4, 0x88, 0x95, 0x76, 0x3D, 0xDE, 0xC7, 0xCC, 0x9C, 0x73, 0x66, 0x37,
+    0xD8, 0xC0, 0x26, 0x26, 0x4D, 0x5C, 0x63, 0xB2, 0x10, 0x60, 0x22, 0xB5, 0x0E, 0xE0, 0x40, 0x03,
+    0x71, 0x86, 0xCB, 0x6D, 0xD6, 0x67, 0x98, 0x8A, 0x64, 0xA1, 0x48, 0x87, 0x44, 0x66, 0x15, 0x6C,
+    0x15, 0x20, 0x72, 0x5C, 0x32, 0x7A, 0x24, 0x9D, 0x73, 0xB0, 0x0D, 0x10, 0x88, 0xEC, 0x20, 0x12,
+    0x69, 0xC1, 0xAD, 0x5C, 0xB6, 0xDC, 0x8F, 0x15, 0x1D, 0xFC, 0x32, 0xEC, 0xFC, 0x09, 0x57, 0x5E,
+    0xCA, 0xBB, 0x6D, 0x47, 0x7F, 0xF2, 0x85, 0x5D, 0xD6, 0xD8, 0xE7, 0xD8, 0x96, 0xD3, 0x21, 0xD6,
+    0xDD, 0x22, 0xDC, 0x4B, 0xAA, 0xBC, 0x48, 0xBE, 0xB7, 0x0C, 0x55, 0xC0, 0xB4, 0x40, 0x52, 0x02,
+    0x0F, 0x96, 0xD9, 0x04, 0x76, 0xC1, 0x6C, 0x5A, 0xB8, 0xAD, 0x32, 0x62, 0x60, 0xC3, 0xC5, 0xB4,
+    0x62, 0x67, 0x92, 0x39, 0x0F, 0xE8, 0xA1, 0x40, 0xB2, 0x7B, 0x61, 0x1F, 0x9D, 0x9A, 0x96, 0x61,
+    0x8E, 0x19, 0x20, 0x16, 0xA9, 0x83, 0xD9, 0xC2, 0x9F, 0xDF, 0x64, 0x7B, 0xA6, 0x91, 0x4F, 0x74,
+    0xC8, 0xD9, 0x9D, 0x1A, 0x0D, 0x8C, 0xA6, 0xA8, 0xAE, 0x20, 0xE4, 0x60, 0x80, 0x77, 0x71, 0xAA,
+    0xD7, 0xA9, 0x76, 0x44, 0x1C, 0x30, 0x10, 0x26, 0x3A, 0x95, 0xE8, 0x54, 0xEE, 0xA7, 0xCA, 0x91,
+    0xCA, 0x44, 0x31, 0x1B, 0x0D, 0x67, 0xD9, 0x23, 0x9D, 0xBA, 0xB5, 0xCA, 0xE1, 0x91, 0x3A, 0xD4,
+    0x5D, 0x51, 0x3B, 0xC2, 0x21, 0x61, 0x0D, 0x02, 0x06, 0xCB, 0x33, 0x24, 0x15, 0x98, 0xA8, 0x15,
+    0x97, 0x8A, 0x14, 0xD3, 0x12, 0x94, 0x28, 0xEC, 0xBC, 0x8B, 0xE1, 0x27, 0xE2, 0x8F, 0x08, 0x52,
+    0x29, 0x8D, 0x34, 0xA1, 0xF4, 0xD8, 0xF7, 0xD9, 0x99, 0x0E, 0xE1, 0xCC, 0xBB, 0xCD, 0x8B, 0xC1,
+    0xA9, 0x99, 0x53, 0xCB, 0xB8, 0x61, 0xD8, 0x58, 0xD5, 0x8D, 0xE5, 0x5C, 0x2A, 0x73, 0x59, 0xDD,
+    0xDB, 0x4A, 0x47, 0x7A, 0x4E, 0xC2, 0xB7, 0x25, 0x2F, 0xD9, 0x95, 0x24, 0xFC, 0x9C, 0x52, 0xD9,
+    0x95, 0x84, 0xE8, 0x12, 0x09, 0x4B, 0x5E, 0x94, 0x84, 0xBC, 0x1E, 0x79, 0x21, 0x88, 0x42, 0x33,
+    0x1B, 0xB1, 0x3B, 0x84, 0x59, 0x9A, 0x99, 0x2A, 0xA9, 0x26, 0xCD, 0xCA, 0xAE, 0x12, 0xA0, 0x0C,
+    0xB0, 0x78, 0xCA, 0x50, 0xC5, 0x10, 0xA2, 0xF3, 0xDC, 0x11, 0xB9, 0x42, 0xF7, 0x44, 0x2C, 0x27,
+    0x14, 0x4B, 0x24, 0x03, 0x1B, 0x2C, 0x86, 0x8A, 0xA4, 0xB7, 0xFF, 0x24, 0x2E, 0x77, 0x94, 0xAC,
+    0x5A, 0xA1, 0x03, 0x75, 0xF7, 0x17, 0xE2, 0x6A, 0xBB, 0xC3, 0x13, 0x95, 0x17, 0x2F, 0xF1, 0x1F,
+    0xCD, 0x9E, 0xEA, 0x19, 0x56, 0x34, 0xD3, 0x25, 0xAB, 0x1F, 0x08, 0x23, 0x1D, 0xFE, 0x90, 0x96,
+    0x5E, 0x3F, 0x8A, 0xA7, 0x99, 0x33, 0xE9, 0x40, 0x21, 0xAA, 0x04, 0x01, 0x71, 0x77, 0xAC, 0x8E,
+    0xF4, 0x2B, 0x81, 0xBC, 0xE1, 0x9E, 0x83, 0xBC, 0x44, 0x58, 0xEC, 0xE0, 0xCF, 0xCD, 0x38, 0x30,
+    0x02, 0x4B, 0xE5, 0xB3, 0x43, 0xDC, 0xD3, 0xB0, 0x4B, 0xE3, 0x53, 0x87, 0xD8, 0xD9, 0x12, 0xF6,
+    0xFD, 0x68, 0xE4, 0x34, 0x26, 0xDE, 0x78, 0x4D, 0xA3, 0xA3, 0x5F, 0x7B, 0xD4, 0xB3, 0x60, 0x72,
+    0x99, 0xC9, 0x21, 0x71, 0x77, 0x2A, 0xFD, 0x0B, 0xF6, 0xDA, 0x28, 0xE3, 0x7A, 0xCB, 0x87, 0x20,
+    0xCF, 0x0D, 0x49, 0x7A, 0x8C, 0xE9, 0xAB, 0x1A, 0xFB, 0x94, 0xA4, 0x3E, 0xB8, 0x9C, 0x05, 0x21,
+    0x1C, 0xD6, 0xB0, 0xA6, 0x0C, 0xBB, 0x34, 0x8B, 0x6B, 0xC7, 0xDF, 0x86, 0xBF, 0xF3, 0xC8, 0x4D,
+    0x0B, 0xD3, 0x58, 0xA4, 0xC7, 0x1D, 0x64, 0xCD, 0x19, 0x97, 0x90, 0x7E, 0x46, 0xA9, 0x2C, 0x6B,
+    0x5A, 0x63, 0x58, 0xE5, 0x72, 0x6B, 0x57, 0xE9, 0xC9, 0x3C, 0xEB, 0x56, 0x3E, 0x16, 0xB8, 0xBA,
+    0x29, 0x52, 0x3E, 0x26, 0xE6, 0x22, 0x52, 0x6F, 0xFC, 0x8A, 0xD4, 0x2E, 0x91, 0xAA, 0xD1, 0xA9,
+    0x71, 0xC4, 0xA5, 0x8E, 0xD2, 0xC9, 0x91, 0x9C, 0x0D, 0x48, 0x15, 0xB2, 0xBE, 0x09, 0x02, 0x7D,
+    0x75, 0x7C, 0xA1, 0x8D, 0x8F, 0x4A, 0xC6, 0x59, 0x16, 0x82, 0xE3, 0x4B, 0xD1, 0xDD, 0xDF, 0xC0,
+    0x75, 0xA2, 0x0D, 0xDB, 0xB0, 0x41, 0x72, 0xA6, 0x57, 0x8A, 0x97, 0x31, 0xD6, 0x3A, 0x7B, 0xE8,
+    0x6E, 0x10, 0x6D, 0xBC, 0x58, 0xAF, 0xA6, 0x65, 0xCE, 0xDA, 0x6F, 0xC9, 0x7D, 0x89, 0xED, 0xE6,
+    0x5A, 0xB5, 0x0D, 0xEB, 0xF1, 0x89, 0x33, 0xAB, 0x03, 0x1E, 0x7D, 0x9F, 0x78, 0x4B, 0x81, 0x1B,
+    0x16, 0xD9, 0x14, 0x3E, 0xAF, 0xC9, 0x09, 0xAF, 0xEB, 0xEA, 0xF0, 0x30, 0xE9, 0x2D, 0xDF, 0xFB,
+    0xED, 0x7E, 0x29, 0x6C, 0xBE, 0x39, 0xDD, 0x08, 0xBB, 0x1A, 0x58, 0xE8, 0x09, 0xBB, 0x85, 0xAC,
+    0xD7, 0x64, 0xA1, 0x34, 0x4D, 0x5E, 0xC9, 0x5B, 0xFA, 0x7F, 0x3A, 0xD4, 0x4C, 0xAB, 0x77, 0x3E,
+    0xEE, 0xF1, 0x3F, 0xB4, 0x1F, 0xCD, 0x55, 0x31, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0xDB, 0x8A, 0x5C,
+    0xB8, 0xD8, 0x2A, 0xF5, 0x1E, 0x61, 0x4F, 0x80, 0x6C, 0x89, 0x22, 0x65, 0x52, 0xF0, 0x2B, 0x0E,
+    0xC1, 0x0D, 0xB0, 0x45, 0x43, 0xC1, 0x4D, 0xA0, 0xE0, 0x02, 0xC0, 0x1A, 0xA5, 0x48, 0x19, 0x27,
+    0x14, 0x14, 0x34, 0x5F, 0xB4, 0x14, 0x6C, 0x61, 0x24, 0x0B, 0xD6, 0x1E, 0xDE, 0x5B, 0xFF, 0x9F,
+    0x10, 0x85, 0x50, 0x45, 0x80, 0x25, 0xCF, 0x8E, 0xFD, 0xD7, 0x3B, 0x6F, 0xDE, 0xBC, 0x99, 0x2F,
+    0xD5, 0x28, 0x6E, 0x28, 0x66, 0x31, 0x63, 0xA6, 0x52, 0xCE, 0xE2, 0xFB, 0x5C, 0x9B, 0xC3, 0x46,
+    0x36, 0xF2, 0xFB, 0xAB, 0xD0, 0xA6, 0xD0, 0xBE, 0x1E, 0xA5, 0x9E, 0xE0, 0xE6, 0xDA, 0xC1, 0x75,
+    0xBF, 0xBA, 0xB9, 0x0A, 0x4E, 0x70, 0x41, 0xDC, 0x78, 0xE5, 0x5A, 0xBA, 0xD9, 0xEA, 0x86, 0xE4,
+    0x62, 0x15, 0x17, 0x32, 0xED, 0x0A, 0xB8, 0xFA, 0x45, 0x83, 0x28, 0x2E, 0x31, 0x30, 0x5B, 0xF1,
+    0xAA, 0x11, 0x81, 0x54, 0x3B, 0xA9, 0x54, 0x87, 0x7D, 0xE8, 0xEC, 0x44, 0x0E, 0x9A, 0x6C, 0x91,
+    0x32, 0x8A, 0xEF, 0x70, 0x4A, 0x8D, 0x9D, 0xBD, 0x9D, 0xA4, 0xDD, 0xDE, 0x46, 0x19, 0xC4, 0x8B,
+    0xD4, 0x52, 0x85, 0xBD, 0xDB, 0xD0, 0x1D, 0xAF, 0xDD, 0x49, 0xB4, 0x11, 0xD7, 0x99, 0x51, 0xF2,
+    0x98, 0xDC, 0x1E, 0x6E, 0xA6, 0x0F, 0xE1, 0x5A, 0xD5, 0x51, 0x88, 0xA7, 0x61, 0xF8, 0x09, 0x5F,
+    0x10, 0x89, 0x78, 0x84, 0x01, 0x18, 0x55, 0x90, 0xB5, 0xC0, 0xF1, 0x5F, 0x67, 0xA9, 0xAE, 0x1D,
+    0xDF, 0x8B, 0xFF, 0x14, 0xA5, 0x9A, 0x77, 0x4E, 0x49, 0xA7, 0xA5, 0x13, 0xE9, 0x9C, 0xE1, 0xA7,
+    0x08, 0xA4, 0x7A, 0xA6, 0xDF, 0x35, 0xE2, 0x44, 0x3D, 0xC5, 0x3D, 0x39, 0x66, 0xCD, 0xA4, 0xF3,
+    0x14, 0x34, 0x8B, 0x42, 0xD8, 0x22, 0x25, 0xB3, 0x6E, 0x43, 0xE2, 0x1B, 0x4F, 0x21, 0x65, 0xC5,
+    0x7C, 0xA2, 0xB8, 0x53, 0x64, 0x64, 0x86, 0x3C, 0x32, 0x91, 0x19, 0x8F, 0x48, 0xE5, 0x78, 0x5B,
+    0xCC, 0x4C, 0xC6, 0x4B, 0x7D, 0x39, 0x67, 0x7A, 0xA4, 0xAF, 0x67, 0x50, 0x39, 0x22, 0xCC, 0x96,
+    0xE0, 0xDD, 0x0F, 0x1C, 0x50, 0x77, 0x92, 0x21, 0x19, 0xD3, 0xC3, 0x9D, 0xD6, 0xC3, 0x9F, 0x74,
+    0x3B, 0xBE, 0x1E, 0xAC, 0x8B, 0x26, 0x9B, 0x6B, 0xCF, 0xA5, 0xD2, 0x14, 0xD5, 0x7D, 0x20, 0x26,
+    0x79, 0x47, 0xEA, 0xFE, 0x74, 0xA5, 0x3A, 0x21, 0x7B, 0x16, 0xC3, 0xC4, 0x76, 0x5D, 0x6A, 0x1E,
+    0x61, 0xA6, 0xB4, 0xD8, 0x11, 0xFA, 0xD8, 0xA0, 0xEA, 0x0E, 0x80, 0xA5, 0x0E, 0x36, 0x42, 0x1C,
+    0xF5, 0xD6, 0x44, 0xE8, 0xA9, 0x1D, 0xCC, 0x5C, 0xE9, 0xE0, 0xFB, 0x6A, 0x31, 0x1A, 0xB4, 0x2F,
+    0xD5, 0xE9, 0xA8, 0x5D, 0xA9, 0xAD, 0xCE, 0x14, 0x5C, 0x12, 0x07, 0x96, 0x8F, 0x4A, 0x49, 0x91,
+    0x3A, 0xD4, 0x4A, 0x9F, 0xE9, 0xC2, 0x3A, 0x65, 0xA8, 0x88, 0x90, 0x46, 0x00, 0x85, 0xEB, 0xB1,
+    0xE0, 0x6E, 0x27, 0x86, 0x66, 0x82, 0x90, 0x38, 0x28, 0xD4, 0x64, 0x02, 0x1F, 0x91, 0x49, 0x15,
+    0x76, 0x9C, 0xDE, 0x91, 0x0C, 0xEF, 0x1A, 0x34, 0xB4, 0x2F, 0xF0, 0x71, 0x7D, 0xB1, 0x64, 0xC1,
+    0x84, 0xBA, 0xD7, 0x72, 0x02, 0xC7, 0x60, 0x78, 0x69, 0xA3, 0x52, 0x16, 0xBE, 0x37, 0xBB, 0xE2,
+    0xA1, 0x7A, 0x2D, 0x65, 0x6B, 0xD4, 0x13, 0xE9, 0x19, 0x14, 0xE3, 0xB7, 0xE0, 0xC4, 0x06, 0x7B,
+    0x15, 0xE8, 0x0D, 0x95, 0x49, 0x58, 0xE4, 0xBF, 0x48, 0xCA, 0x7A, 0x3E, 0x41, 0x95, 0xE9, 0xDD,
+    0xDD, 0x17, 0xE4, 0x63, 0x26, 0xC8, 0xA0, 0x3D, 0xC5, 0xC9, 0x0B, 0x7A, 0xD4, 0x06, 0x03, 0xCD,
+    0x76, 0x76, 0xAC, 0x22, 0x78, 0x44, 0x1B, 0xB4, 0x9F, 0x01, 0x58, 0xCF, 0x23, 0x49, 0x19, 0xC8,
+    0x13, 0xAB, 0x07, 0xE0, 0x86, 0x95, 0x74, 0x33, 0x23, 0x12, 0x04, 0x9F, 0x12, 0x0F, 0x36, 0xEE,
+    0xD4, 0x95, 0x4A, 0x5D, 0xE9, 0x3E, 0x12, 0x95, 0xE7, 0x50, 0x39, 0x0B, 0x5E, 0x2D, 0x1A, 0xD1,
+    0x5E, 0x2C, 0x68, 0x8C, 0x6A, 0x7B, 0x27, 0x34, 0x83, 0x2E, 0x7E, 0xBF, 0x08, 0xB9, 0x29, 0xC7,
+    0x32, 0xA6, 0x56, 0x62, 0x6F, 0xD7, 0x5D, 0xB1, 0x38, 0xA8, 0xFE, 0x3C, 0x00, 0xC3, 0x04, 0x58,
+    0x91, 0x5D, 0xC4, 0xE8, 0xDD, 0x0A, 0x03, 0x93, 0x40, 0x4A, 0xB2, 0x30, 0x4B, 0xF6, 0x98, 0xE0,
+    0x91, 0x5F, 0x8D, 0x1F, 0x88, 0xB8, 0x58, 0x1A, 0x82, 0x05, 0x2B, 0x45, 0xB4, 0x9C, 0x18, 0xEC,
+    0xA8, 0x4B, 0x16, 0xFE, 0x78, 0x96, 0x83, 0xCD, 0xE1, 0xC9, 0x7F, 0xC0, 0x16, 0x99, 0x92, 0xA7,
+    0x34, 0x6F, 0x69, 0xB8, 0x23, 0xBF, 0x51, 0x45, 0x0C, 0x11, 0x8D, 0x14, 0x47, 0x2C, 0x69, 0x28,
+    0xE1, 0x98, 0xBD, 0x4A, 0xE3, 0x24, 0xA9, 0xD0, 0xF2, 0xAC, 0x16, 0x67, 0x25, 0xF5, 0x96, 0x8C,
+    0x4F, 0xC6, 0xF1, 0xAA, 0x27, 0x2E, 0xBE, 0x8A, 0x7C, 0x35, 0xF2, 0xD5, 0xB7, 0x4D, 0xC3, 0x0E,
+    0x18, 0x68, 0xB6, 0x34, 0x81, 0x66, 0xA4, 0x99, 0x56, 0x59, 0x61, 0x6F, 0x3E, 0xA6, 0xB9, 0xC7,
+    0x99, 0x77, 0x7B, 0x68, 0x2B, 0x46, 0x74, 0x42, 0x81, 0x8D, 0x0E, 0x1B, 0xFD, 0xC0, 0xD1, 0x8C,
+    0xB1, 0x85, 0xC7, 0x29, 0xCD, 0x36, 0x26, 0xC7, 0xDC, 0xAC, 0xBE, 0xEC, 0x30, 0x95, 0x42, 0xBD,
+    0xCE, 0x0F, 0xEC, 0x7F, 0xC4, 0xE4, 0x96, 0xBD, 0x29, 0xF4, 0x86, 0xF9, 0x07, 0x09, 0xB3, 0x5D,
+    0xF0, 0x1F, 0x80, 0x79, 0xCA, 0x11, 0xB3, 0xDE, 0x07, 0x8F, 0xEE, 0x31, 0xE1, 0xB5, 0x98, 0x40,
+    0xE9, 0x8F, 0xF0, 0xA5, 0xE3, 0x64, 0xAB, 0x38, 0x86, 0x53, 0xFE, 0x12, 0x6F, 0xD1, 0xFB, 0x17,
+    0x6B, 0x7D, 0xDF, 0xD7, 0x4F, 0x75, 0x55, 0x3D, 0x6F, 0xDE, 0x54, 0x14, 0x3E, 0xB6, 0x95, 0x5A,
+    0xC2, 0xC3, 0xED, 0x12, 0x09, 0xC1, 0x60, 0x86, 0x0E, 0x55, 0x69, 0x6B, 0x86, 0x0E, 0x0C, 0xA5,
+    0xD7, 0x4A, 0x87, 0x0E, 0x1D, 0xFA, 0x82, 0xF2, 0xB2, 0x30, 0xC0, 0x4A, 0x96, 0x4C, 0x48, 0x0C,
+    0x09, 0x36, 0x44, 0x2C, 0x30, 0x34, 0x4B, 0x27, 0x06, 0x2A, 0x91, 0xA5, 0x5E, 0xE0, 0x07, 0x84,
+    0x5C, 0x87, 0x4A, 0x54, 0xA2, 0x43, 0x5C, 0x55, 0xA8, 0x43, 0x06, 0xDC, 0x94, 0x0A, 0x89, 0x0E,
+    0xBD, 0x69, 0x4C, 0xEB, 0x46, 0xD7, 0x3E, 0x3C, 0xC7, 0x6F, 0x92, 0x36, 0x29, 0x5C, 0xDD, 0xE3,
+    0xFB, 0xE1, 0xFB, 0xF1, 0x9C, 0xE7, 0x7C, 0xDC, 0xB0, 0xF6, 0x5A, 0xDF, 0x45, 0x96, 0x8C, 0x29,
+    0x29, 0x61, 0xA2, 0xC8, 0x11, 0x05, 0x0D, 0x11, 0x8D, 0xE8, 0x68, 0x09, 0x98, 0x5B, 0x88, 0x13,
+    0x21, 0x4A, 0xB0, 0xC8, 0x54, 0xE4, 0x73, 0x4A, 0x51, 0x8F, 0x61, 0x8B, 0x61, 0x8D, 0x61, 0x49,
+    0x11, 0x8E, 0x89, 0xB9, 0xC8, 0x13, 0x66, 0xAB, 0x99, 0x1B, 0x2D, 0xEB, 0xC7, 0xA4, 0x3B, 0xC5,
+    0x77, 0xB8, 0x8B, 0x1B, 0xBF, 0xA3, 0xA4, 0xF4, 0xDD, 0xFE, 0x27, 0x70, 0xA4, 0xCB, 0xA0, 0x23,
+    0x5D, 0x1D, 0x7C, 0xEA, 0xA0, 0x47, 0x8F, 0xA6, 0x71, 0x64, 0x4A, 0x26, 0x27, 0x60, 0xC3, 0x55,
+    0x40, 0x60, 0xE3, 0xBC, 0x0B, 0x6C, 0x92, 0xA3, 0x1F, 0xA7, 0x84, 0x9D, 0xC4, 0x35, 0x69, 0xCE,
+    0xD5, 0x76, 0x1F, 0xB4, 0x7E, 0x2B, 0x28, 0xA7, 0xBC, 0x8B, 0xEE, 0xBD, 0x6C, 0x67, 0x73, 0xC3,
+    0xAD, 0x66, 0xBF, 0x7E, 0x79, 0x7D, 0xAA, 0x60, 0xC1, 0x9D, 0x31, 0xFF, 0x56, 0x5C, 0x9B, 0x25,
+    0x9A, 0xFE, 0x30, 0x65, 0xE0, 0x01, 0x36, 0xDE, 0x2A, 0x8A, 0x6B, 0xE3, 0xE4, 0x61, 0x72, 0xD9,
+    0xAA, 0x75, 0x40, 0x4D, 0xD8, 0x7A, 0xB8, 0x65, 0x2A, 0xCD, 0xBE, 0xEA, 0x95, 0xD3, 0x96, 0x4B,
+    0xBD, 0xD4, 0xEA, 0x9B, 0x0E, 0x35, 0xBB, 0x25, 0xF5, 0x82, 0xAA, 0xDF, 0x3D, 0x7F, 0x5E, 0xEE,
+    0xF8, 0x22, 0xE4, 0x64, 0xC1, 0x58, 0xCE, 0x57, 0x88, 0xBC, 0x11, 0xB6, 0x78, 0x2C, 0x60, 0x4C,
+    0x89, 0x56, 0xD7, 0x68, 0xE3, 0x56, 0xDA, 0x03, 0xE2, 0x40, 0x31, 0x10, 0x0A, 0x50, 0xC1, 0x2B,
+    0xB0, 0x81, 0x1E, 0xDA, 0xCD, 0x12, 0xB4, 0x8D, 0x1A, 0x52, 0x2D, 0x25, 0xD0, 0xC3, 0x4E, 0x14,
+    0x15, 0x4A, 0xA5, 0xCC, 0x5D, 0x37, 0x8D, 0xB6, 0xDA, 0x26, 0x4D, 0xDC, 0x2A, 0xA7, 0xBA, 0x88,
+    0x23, 0x9E, 0xE1, 0xD2, 0xD4, 0x49, 0xA3, 0x60, 0x04, 0x9F, 0x73, 0xAE, 0x4E, 0x5D, 0xA7, 0xAC,
+    0x55, 0x3D, 0xFA, 0x59, 0x2D, 0x93, 0xB0, 0x41, 0xEC, 0xFC, 0x82, 0xBC, 0x74, 0x71, 0x7E, 0xB3,
+    0x33, 0xD5, 0x62, 0x58, 0xCD, 0x46, 0xE5, 0xDA, 0x77, 0x9D, 0xD9, 0x2C, 0x57, 0xC9, 0xDC, 0x18,
+    0x19, 0x76, 0xA8, 0xE4, 0xED, 0x57, 0x42, 0x25, 0x95, 0xFF, 0x1C, 0x56, 0x50, 0xD4, 0x9E, 0x16,
+    0x62, 0xF5, 0xEA, 0x9A, 0x8E, 0x71, 0x82, 0x26, 0x97, 0xF4, 0x66, 0x97, 0x6B, 0xC8, 0x23, 0x5E,
+    0xB2, 0xAA, 0x9C, 0xA6, 0x80, 0xDE, 0xC9, 0xB6, 0x3F, 0x0B, 0x40, 0xF3, 0x9C, 0x29, 0x61, 0xD8,
+    0x19, 0xF0, 0xF8, 0x1A, 0x88, 0x8D, 0x2B, 0xB3, 0x34, 0xB0, 0x36, 0x4E, 0x8F, 0xB0, 0x76, 0x88,
+    0xAD, 0xB8, 0x8F, 0x3B, 0xA8, 0xE2, 0xE2, 0x56, 0x14, 0x33, 0xF5, 0x5C, 0x7E, 0x96, 0x9A, 0xA0,
+    0x4D, 0xDA, 0x0F, 0xB6, 0xF9, 0x5B, 0xF7, 0x46, 0x4A, 0xA3, 0xC0, 0xAA, 0x5A, 0xE7, 0x19, 0x65,
+    0x4E, 0x3B, 0xF8, 0xE2, 0x71, 0x8A, 0xEF, 0x3D, 0xED, 0xCC, 0xFC, 0x1F, 0xCF, 0x3A, 0x4E, 0x35,
+    0x37, 0xCC, 0x77, 0x99, 0xAF, 0xDC, 0xE9, 0x74, 0xD0, 0x38, 0x55, 0xE9, 0x3C, 0x70, 0xAA, 0x89,
+    0x6D, 0xD0, 0xC3, 0xED, 0x18, 0x6E, 0xA7, 0x71, 0x9D, 0xB2, 0x44, 0x61, 0x35, 0x61, 0x5E, 0x5A,
+    0x19, 0x6B, 0xB8, 0x06, 0xF7, 0x84, 0x75, 0xB9, 0xAC, 0x97, 0x7D, 0xF2, 0x3B, 0xAA, 0x1A, 0xBE,
+    0xFB, 0x80, 0x37, 0xBE, 0x9F, 0xEF, 0x16, 0xB5, 0x6D, 0x12, 0xE1, 0x3D, 0x64, 0xBE, 0xC8, 0x7C,
+    0xBF, 0x2F, 0x56, 0x68, 0x5C, 0x44, 0xCC, 0x37, 0x99, 0x9F, 0xF3, 0xEE, 0x8D, 0x57, 0x96, 0xC2,
+    0xA3, 0x6E, 0xC1, 0x91, 0xD0, 0x94, 0xA4, 0x95, 0x5D, 0x65, 0x7D, 0x55, 0xDC, 0x12, 0x80, 0xC4,
+    0xEB, 0x4B, 0xDE, 0x2F, 0x7F, 0x17, 0xC5, 0xA9, 0xE2, 0x07, 0x66, 0xCD, 0x3B, 0xB5, 0xBE, 0x10,
+    0xEC, 0x0C, 0x3D, 0xE6, 0x64, 0x2D, 0xE6, 0x47, 0xF3, 0x6B, 0xF7, 0x36, 0xB6, 0x77, 0xDC, 0x02,
+    0x10, 0x9E, 0x3E, 0xA7, 0xEA, 0xB0, 0x8C, 0xAA, 0x33, 0xCD, 0xC9, 0x93, 0x47, 0x5C, 0x98, 0xCE,
+    0x44, 0x5B, 0x2E, 0x4B, 0xBE, 0x1E, 0x34, 0x52, 0x39, 0x01, 0xA6, 0x06, 0xAB, 0x44, 0x1D, 0xFD,
+    0x5F, 0x11, 0x1B, 0x2C, 0xB5, 0x13, 0x03, 0x98, 0xDB, 0xA2, 0xEB, 0x84, 0x38, 0x9E, 0x10, 0x77,
+    0xD7, 0xEA, 0xF4, 0x88, 0x01, 0x27, 0xFB, 0xA6, 0xC8, 0x0C, 0xF1, 0xDD, 0x4A, 0xEC, 0x8E, 0x31,
+    0x31, 0xED, 0x8D, 0x9C, 0xBA, 0x65, 0x75, 0xBC, 0xEE, 0xB2, 0xF0, 0x89, 0x8B, 0x6F, 0xDB, 0x2C,
+    0xF9, 0xC5, 0x7D, 0x3A, 0x4E, 0x78, 0x93, 0x9F, 0x72, 0x87, 0xF8, 0x4C, 0xEA, 0x68, 0x88, 0xBB,
+    0x4F, 0x88, 0x3E, 0x27, 0x03, 0xA3, 0xF2, 0xAA, 0xE6, 0xC7, 0x6A, 0x83, 0x6F, 0x5A, 0xAE, 0x5D,
+    0x66, 0xE9, 0x6C, 0x4A, 0x2A, 0xA5, 0xB0, 0x24, 0x1F, 0x6A, 0x22, 0x69, 0x2C, 0x20, 0x59, 0x0C,
+    0x7A, 0x04, 0x98, 0xCA, 0x0F, 0xC1, 0x1E, 0x8C, 0xA2, 0xC4, 0x76, 0x5E, 0x2F, 0xDD, 0x58, 0x62,
+    0xC8, 0xBB, 0xF1, 0xDF, 0x3A, 0x4E, 0xCD, 0xFA, 0xDC, 0x92, 0xB9, 0x0F, 0xB4, 0x21, 0x38, 0xE5,
+    0x7F, 0xF8, 0x2F, 0xBE, 0xC4, 0xDC, 0x99, 0x06, 0x56, 0x5B, 0xE2, 0x6F, 0x2E, 0xF3, 0x32, 0x79,
+    0x03, 0xB4, 0xA4, 0x1C, 0x0C, 0x43, 0x43, 0xB0, 0xC2, 0x47, 0xA2, 0x2D, 0x24, 0x80, 0x8D, 0x1D,
+    0x67, 0xF4, 0x12, 0x37, 0x59, 0x00, 0x03, 0x7A, 0x2B, 0x88, 0x45, 0x52, 0xEC, 0xB7, 0x86, 0x2F,
+    0xEF, 0xB4, 0xC6, 0x5C, 0xAD, 0x8D, 0x3B, 0x96, 0x67, 0xD5, 0xC1, 0x6D, 0xE1, 0xC5, 0xE5, 0xE8,
+    0x89, 0xA3, 0xB7, 0x4E, 0x4C, 0x86, 0xAF, 0xAB, 0x99, 0xF2, 0x27, 0xE9, 0x78, 0x91, 0xA8, 0x70,
+    0x3E, 0x93, 0x6B, 0xD6, 0xFB, 0x94, 0xE6, 0x2D, 0xE8, 0x03, 0xAE, 0x63, 0xCC, 0x7F, 0xEE, 0xEF,
+    0x7D, 0x93, 0x9F, 0xE3, 0x2F, 0xA6, 0x53, 0xB5, 0x3B, 0xFE, 0xA8, 0x97, 0xF4, 0x1A, 0xB4, 0xAB,
+    0x72, 0xE8, 0xBA, 0xFC, 0x3E, 0xF1, 0x42, 0x27, 0x9F, 0xF6, 0x8C, 0x1C, 0x0D, 0xBE, 0xD3, 0x24,
+    0x43, 0x03, 0x50, 0x52, 0xD2, 0x03, 0x76, 0x88, 0xCE, 0x1D, 0xE4, 0x96, 0xC1, 0xB8, 0xF8, 0x25,
+    0xF9, 0x46, 0xC9, 0x60, 0xFC, 0x2A, 0x55, 0xD3, 0xE3, 0x95, 0x18, 0xC7, 0x40, 0x9A, 0x58, 0x32,
+    0x1D, 0x96, 0x26, 0xD5, 0x4B, 0xB2, 0x5B, 0x08, 0xBC, 0x41, 0x34, 0x0F, 0x29, 0x4C, 0xD2, 0xEF,
+    0x44, 0x1E, 0x8E, 0x47, 0x7B, 0x49, 0xBC, 0xDD, 0x13, 0x27, 0x32, 0x35, 0x9A, 0x4E, 0x75, 0xC9,
+    0xC4, 0x97, 0x5C, 0xD0, 0xC5, 0x36, 0x6E, 0x4D, 0x65, 0x1E, 0xF0, 0x61, 0x73, 0x92, 0x5F, 0x18,
+    0xFE, 0x78, 0x12, 0x24, 0xDB, 0xCC, 0xC5, 0xA5, 0x76, 0x62, 0xD2, 0x2C, 0x1F, 0xEC, 0x1B, 0xF5,
+    0x3F, 0x56, 0xB8, 0x32, 0x35, 0xDC, 0xF9, 0xB8, 0x41, 0x5E, 0x1E, 0x41, 0x86, 0x7C, 0x1F, 0x70,
+    0x51, 0x5C, 0x61, 0x89, 0x14, 0x76, 0x68, 0x9E, 0x41, 0x1E, 0xB3, 0x04, 0x1A, 0xCA, 0x71, 0xD0,
+    0x89, 0x50, 0x16, 0x42, 0x2A, 0xE1, 0x05, 0x87, 0x0F, 0x46, 0x1E, 0x1C, 0x46, 0x0B, 0x00, 0x09,
+    0xF8, 0x3D, 0x73, 0xB3, 0x4C, 0x66, 0xF0, 0x53, 0x3C, 0x48, 0xC8, 0xBC, 0xA1, 0xEC, 0xF4, 0xB8,
+    0x84, 0x5D, 0xB3, 0x32, 0x6C, 0x05, 0x0C, 0x13, 0xDA, 0xA4, 0x04, 0x1E, 0x3C, 0x82, 0x59, 0x3E,
+    0x4C, 0xEA, 0x9E, 0x42, 0x84, 0x31, 0x56, 0x06, 0x60, 0x76, 0x2E, 0x87, 0x03, 0x8A, 0xEF, 0xAA,
+    0x72, 0x88, 0xBA, 0x00, 0xDD, 0xB8, 0x3C, 0xC2, 0xB0, 0xC7, 0x43, 0x3A, 0xE0, 0x58, 0x00, 0xFD,
+    0x3E, 0x7E, 0x1F, 0x68, 0x42, 0xD1, 0x16, 0x6B, 0xB3, 0x72, 0xC0, 0x31, 0xA8, 0x87, 0x21, 0x52,
+    0xBC, 0xFF, 0xF2, 0x70, 0xEF, 0x09, 0xED, 0x26, 0x2F, 0xEA, 0xDC, 0xF2, 0xFE, 0x89, 0x89, 0x30,
+    0xC4, 0xF2, 0x62, 0x40, 0xF1, 0xA8, 0xF7, 0x58, 0xBC, 0x91, 0x67, 0x80, 0xBF, 0x87, 0x82, 0x81,
+    0x03, 0x89, 0xC3, 0xAD, 0xA5, 0xB8, 0x8A, 0x98, 0xCE, 0x09, 0x73, 0x13, 0x95, 0x43, 0x4E, 0x43,
+    0x16, 0x02, 0x3B, 0x30, 0xC8, 0x16, 0xF4, 0x73, 0x6E, 0x86, 0x15, 0x42, 0xE2, 0xDB, 0x2F, 0x3C,
+    0x93, 0xFE, 0x05, 0xAD, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD, 0xB6, 0x45, 0x3E, 0x09, 0x17,
+    0x43, 0x93, 0x06, 0x0A, 0xF7, 0x69, 0xE6, 0x0D, 0x18, 0x47, 0x91, 0xA0, 0xA0, 0x48, 0x8A, 0x6C,
+    0xC5, 0x43, 0xE4, 0x09, 0x90, 0x8D, 0x28, 0xB6, 0x48, 0xB3, 0x6F, 0x40, 0x93, 0x6A, 0x53, 0xEC,
+    0x1B, 0x30, 0x86, 0x14, 0x8B, 0xB4, 0x05, 0x86, 0x14, 0x94, 0xB1, 0x04, 0x14, 0xD0, 0x64, 0x20,
+    0x5E, 0xE1, 0x6F, 0x19, 0xCF, 0xE5, 0x9C, 0xF1, 0xB7, 0x6C, 0x40, 0x08, 0x24, 0x84, 0xF7, 0x9B,
+    0x3B, 0xE3, 0xF9, 0xF3, 0xBD, 0xE7, 0xDC, 0x7B, 0x56, 0xDE, 0xD4, 0xEF, 0xA5, 0x54, 0x9D, 0xC5,
+    0xAA, 0x0E, 0x85, 0x5E, 0xAD, 0x52, 0xAF, 0xF2, 0x96, 0xB8, 0x51, 0x44, 0x14, 0xAD, 0x4A, 0x30,
+    0xB5, 0xB6, 0x22, 0x8D, 0xEE, 0x45, 0x9C, 0x6A, 0xCF, 0xAD, 0x23, 0xE6, 0x74, 0x10, 0x79, 0x44,
+    0x93, 0x97, 0xEB, 0x54, 0x4D, 0x62, 0x17, 0xB7, 0xBE, 0xA7, 0xDF, 0x28, 0x9E, 0x06, 0x6D, 0xEE,
+    0x54, 0x93, 0xDC, 0xD2, 0x84, 0x75, 0x3E, 0xFA, 0x78, 0xF1, 0xF8, 0x1D, 0x2F, 0xDD, 0xE1, 0x17,
+    0xBB, 0xF3, 0xD8, 0x5D, 0x44, 0x7F, 0x11, 0xF5, 0xC5, 0xAA, 0xA3, 0xBB, 0x77, 0xB9, 0x36, 0xDF,
+    0x2E, 0xDD, 0xD9, 0x2F, 0x8A, 0x7D, 0x72, 0xF3, 0x98, 0x45, 0xEC, 0x24, 0xBE, 0x2F, 0x93, 0xD4,
+    0x8B, 0x34, 0x93, 0x74, 0x7D, 0x91, 0x64, 0x77, 0x3D, 0x54, 0xD9, 0x45, 0x69, 0x82, 0x74, 0x43,
+    0xA9, 0x52, 0x47, 0xB1, 0x41, 0x74, 0xAC, 0xB4, 0x35, 0xEB, 0x76, 0x96, 0xE1, 0x14, 0x70, 0x12,
+    0xBB, 0xB8, 0x4D, 0xFC, 0x80, 0x98, 0x85, 0x3B, 0xC5, 0x4D, 0x70, 0xAB, 0x97, 0x0A, 0x3B, 0xCD,
+    0x7C, 0xD8, 0x28, 0x79, 0xA3, 0x3D, 0x6C, 0x4C, 0x87, 0x2B, 0xA6, 0x77, 0xDF, 0xD7, 0xBB, 0xAA,
+    0x71, 0xA7, 0x1A, 0x80, 0x80, 0x20, 0xBC, 0xE2, 0x2C, 0x6D, 0xFE, 0x15, 0x98, 0x47, 0x87, 0x70,
+    0x61, 0x6D, 0x46, 0x66, 0x37, 0x57, 0xB8, 0xA0, 0x88, 0x92, 0x17, 0xC4, 0xC1, 0x36, 0x83, 0xE1,
+    0x42, 0xC8, 0x0B, 0x8B, 0x10, 0xCA, 0xCF, 0x80, 0x68, 0x12, 0xDB, 0x1B, 0x40, 0x5A, 0x4F, 0xD5,
+    0xBC, 0x8B, 0xE5, 0x22, 0xAB, 0x78, 0x34, 0xD7, 0x36, 0xA3, 0x6B, 0xCD, 0x68, 0x82, 0x19, 0xAB,
+    0xAB, 0xB3, 0xF8, 0xCE, 0x8C, 0x13, 0xC9, 0x44, 0x72, 0x50, 0xA9, 0x18, 0xDD, 0xD3, 0xD3, 0x9B,
+    0xC7, 0xB5, 0x9B, 0x2D, 0xC3, 0xBF, 0xDA, 0xEC, 0x2D, 0x2C, 0x88, 0xA1, 0xD5, 0xC9, 0xF5, 0x95,
+    0xEA, 0xE2, 0x5A, 0x3A, 0x40, 0x5B, 0xAE, 0xB4, 0xC5, 0xFA, 0xC7, 0x18, 0xDF, 0x87, 0xDD, 0xF6,
+    0x20, 0x7E, 0xDA, 0xD4, 0xDE, 0xD9, 0x48, 0x25, 0xD1, 0x86, 0xB6, 0x7D, 0x6D, 0x98, 0x9E, 0xEA,
+    0xD3, 0x79, 0x83, 0x57, 0xAA, 0xEC, 0xA7, 0x0B, 0x7F, 0x1D, 0xFA, 0x25, 0x7B, 0x11, 0x30, 0xC4,
+    0x09, 0x71, 0x2B, 0x60, 0xC7, 0x86, 0x66, 0xE0, 0x86, 0x28, 0xBB, 0x24, 0x66, 0x94, 0x6E, 0x02,
+    0x16, 0x18, 0x92, 0xE9, 0x89, 0xA4, 0x6B, 0x1E, 0x06, 0x10, 0x88, 0x21, 0x49, 0xFA, 0x88, 0x97,
+    0xF1, 0xC6, 0xA6, 0x87, 0x21, 0xE5, 0xBB, 0xF0, 0x1A, 0x2E, 0xE5, 0x4A, 0xB4, 0x66, 0xBB, 0x88,
+    0x1B, 0x40, 0x8C, 0x22, 0xBF, 0xAB, 0x88, 0x5B, 0x9B, 0x57, 0xF0, 0xA5, 0xFB, 0x74, 0x91, 0x22,
+    0x61, 0xBA, 0xD6, 0x95, 0xCC, 0x31, 0x1B, 0x94, 0xBE, 0xC1, 0x77, 0xC3, 0x37, 0x07, 0x53, 0xD0,
+    0x47, 0xD2, 0xCE, 0x33, 0x41, 0xFC, 0xB9, 0xCE, 0xA5, 0xEE, 0x10, 0x69, 0xAC, 0x01, 0x48, 0x80,
+    0xD9, 0x31, 0x59, 0x99, 0x59, 0xD2, 0x8D, 0xCC, 0x06, 0x3A, 0x72, 0x24, 0xFF, 0xF0, 0x98, 0x90,
+    0xEB, 0xAB, 0x54, 0x0C, 0xDC, 0xAC, 0x6D, 0xAD, 0x1F, 0x80, 0xDE, 0xD9, 0xB7, 0x8D, 0x3E, 0x9E,
+    0x2B, 0x5D, 0x7C, 0xDF, 0xE9, 0xF1, 0x62, 0x34, 0x76, 0x1F, 0x27, 0x3D, 0x8F, 0xEE, 0x05, 0x2B,
+    0x05, 0x03, 0xBD, 0x8F, 0x71, 0xD0, 0x67, 0x48, 0x84, 0xD5, 0xE9, 0xA0, 0xCF, 0x75, 0xE1, 0xA0,
+    0xD5, 0xEF, 0x34, 0x34, 0xC9, 0xAD, 0x05, 0x06, 0x43, 0xA3, 0x12, 0x91, 0x78, 0xEE, 0x37, 0x00,
+    0xC8, 0x68, 0x08, 0x6E, 0x9D, 0xFE, 0xDE, 0x91, 0x12, 0x38, 0x87, 0xAE, 0xAF, 0x22, 0x1C, 0x49,
+    0xC0, 0xD4, 0xB7, 0x6E, 0x74, 0x43, 0x1D, 0xCD, 0x24, 0x7A, 0x0C, 0x55, 0x78, 0x45, 0x4A, 0x70,
+    0xD6, 0xE3, 0x0E, 0xA3, 0xAC, 0x1B, 0x82, 0x32, 0x6F, 0xC5, 0x53, 0xF0, 0x52, 0x16, 0x3F, 0x16,
+    0x08, 0x94, 0xC9, 0x5C, 0x62, 0x91, 0x9B, 0x6E, 0x1F, 0xBE, 0xE0, 0xDB, 0x22, 0xFD, 0xE7, 0x86,
+    0x14, 0xBD, 0x6E, 0x28, 0x2E, 0x88, 0x13, 0x2E, 0x7E, 0xBD, 0xBD, 0xF1, 0x80, 0xE9, 0x34, 0x5C,
+    0x0B, 0x95, 0x78, 0xE2, 0x6A, 0xE8, 0x52, 0xA1, 0xE4, 0xC4, 0xBD, 0xC4, 0x5A, 0xB5, 0xE7, 0x9A,
+    0xBF, 0x1F, 0x88, 0xBB, 0x6F, 0xE1, 0xF6, 0x2E, 0x6B, 0x02, 0xCE, 0x55, 0x91, 0xE7, 0xFC, 0x00,
+    0xEE, 0x4C, 0x3A, 0xD5, 0x16, 0x54, 0xE3, 0x1C, 0x8B, 0x62, 0x60, 0x52, 0x26, 0xC4, 0x0D, 0xDE,
+    0x0D, 0x41, 0xB8, 0x8B, 0x20, 0xA1, 0x6F, 0x33, 0x6E, 0x1E, 0xEE, 0x9C, 0x9E, 0x7E, 0xC2, 0x62,
+    0x40, 0x25, 0xC6, 0xFC, 0xFD, 0x43, 0x57, 0x42, 0x23, 0xAD, 0xAE, 0x14, 0x54, 0x3B, 0xD8, 0x2F,
+    0x50, 0xFC, 0x76, 0xA8, 0xBF, 0x8E, 0xB2, 0x36, 0x3F, 0xF9, 0xCF, 0x51, 0x75, 0x10, 0x45, 0x48,
+    0xC8, 0x64, 0xD2, 0xC9, 0xA1, 0x74, 0x4E, 0x58, 0x4D, 0x66, 0xA8, 0x83, 0x13, 0x33, 0x40, 0xB8,
+    0xAA, 0x50, 0x44, 0x6A, 0x81, 0x53, 0xEA, 0xC3, 0x5C, 0x5D, 0x7E, 0x18, 0xCD, 0x50, 0x2E, 0x0E,
+    0x09, 0x1E, 0xC5, 0x3C, 0x83, 0xAE, 0x61, 0x35, 0xB2, 0x68, 0x94, 0x2A, 0x40, 0x9C, 0xB3, 0xEC,
+    0xFC, 0x8C, 0xD7, 0x73, 0xAA, 0xEE, 0xE5, 0xD1, 0xC3, 0xAE, 0xCF, 0xC4, 0x5C, 0x8B, 0x5D, 0x77,
+    0x23, 0x76, 0xF6, 0xCF, 0xDA, 0x67, 0xC1, 0x94, 0x1F, 0xF1, 0xDA, 0x52, 0xF4, 0xE5, 0xED, 0x27,
+    0xB8, 0x0B, 0x91, 0x6D, 0x6A, 0xB6, 0xE5, 0x3B, 0xA5, 0xCC, 0xE3, 0xAF, 0x8C, 0x48, 0x94, 0x3A,
+    0xD4, 0xC8, 0x88, 0xC1, 0x8E, 0x9C, 0x6A, 0xAB, 0x58, 0xAE, 0xC0, 0x13, 0x53, 0x8E, 0x53, 0x48,
+    0x1D, 0x64, 0x11, 0xD4, 0xD2, 0x4D, 0xF5, 0x82, 0x2F, 0xD8, 0x89, 0xD0, 0xED, 0x29, 0x06, 0xCF,
+    0x69, 0x28, 0x0B, 0x11, 0xF2, 0xDA, 0x90, 0x01, 0xDF, 0x1F, 0x49, 0xF1, 0x10, 0x39, 0x72, 0xF4,
+    0x04, 0x9F, 0x58, 0xD0, 0xE6, 0x86, 0xB2, 0x8A, 0x70, 0x70, 0xD5, 0x4D, 0xBB, 0x3A, 0xA5, 0x9A,
+    0xE6, 0xE6, 0xD8, 0xA6, 0xAC, 0xD0, 0x5B, 0xFB, 0xE1, 0xE8, 0x01, 0xE6, 0x66, 0xB7, 0xF1, 0xC0,
+    0x46, 0x5C, 0x22, 0xA2, 0x61, 0x4D, 0x80, 0xB0, 0x4A, 0x27, 0x94, 0x79, 0x9D, 0x8C, 0xDE, 0x43,
+    0xC0, 0x26, 0xDA, 0x15, 0x1A, 0x20, 0xCD, 0xE2, 0x03, 0xF5, 0xD9, 0x5E, 0xEA, 0x05, 0xB5, 0xC2,
+    0xFD, 0xAA, 0x59, 0xA4, 0xBA, 0x97, 0x59, 0xBC, 0x29, 0x67, 0xF3, 0xA1, 0x67, 0x5A, 0x95, 0x9B,
+    0xB2, 0xCB, 0x35, 0xD6, 0x46, 0x73, 0x71, 0x17, 0x87, 0xE5, 0x66, 0xEB, 0x4B, 0xDD, 0x7A, 0xCB,
+    0x9E, 0x88, 0xEE, 0xF5, 0x2B, 0xF4, 0x4E, 0x2F, 0xF0, 0x7F, 0x70, 0xAA, 0x34, 0x5A, 0x50, 0x3F,
+    0xA1, 0x60, 0xFD, 0x6C, 0x35, 0xDC, 0xF2, 0x27, 0x40, 0x97, 0xAA, 0x72, 0x1B, 0x10, 0x8A, 0xEB,
+    0xA9, 0x73, 0x00, 0x97, 0xB2, 0x12, 0x72, 0xA5, 0xD5, 0x20, 0x0A, 0x14, 0xBA, 0x2F, 0xA1, 0x38,
+    0x3F, 0x3E, 0x5A, 0x90, 0x88, 0x2E, 0x23, 0x28, 0x7E, 0x2F, 0xFF, 0xEB, 0xF3, 0x3B, 0x8D, 0x55,
+    0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x53, 0x7C, 0xC5, 0x15, 0x57, 0x41, 0x93, 0xE2, 0x7A,
+    0x9A, 0xFD, 0x0F, 0xB8, 0x33, 0x14, 0x14, 0x29, 0x02, 0x42, 0xA6, 0x49, 0x41, 0x9F, 0xC6, 0xFF,
+    0x01, 0x7B, 0x11, 0x05, 0x85, 0x0B, 0xBF, 0x86, 0x8A, 0x82, 0x26, 0x4D, 0x44, 0xE1, 0x7F, 0x80,
+    0x64, 0x2F, 0xA4, 0x70, 0x41, 0xF1, 0x8E, 0x44, 0x51, 0x24, 0x52, 0xF8, 0xC0, 0x48, 0x91, 0x70,
+    0x91, 0xC3, 0xD9, 0xA0, 0xB5, 0xDF, 0xEE, 0x0E, 0xDF, 0xAC, 0xDF, 0x4B, 0x6C, 0x7E, 0x48, 0x9C,
+    0x3D, 0xFB, 0xE6, 0x66, 0xF7, 0xCD, 0x7E, 0x33, 0xF3, 0xCD, 0x3C, 0x26, 0xA2, 0x7A, 0x26, 0x35,
+    0x33, 0x15, 0x7C, 0xD3, 0x92, 0xB1, 0xA6, 0xAB, 0xF9, 0x86, 0xCD, 0xD8, 0x99, 0xAE, 0xE5, 0x3D,
+    0x57, 0xB2, 0xD3, 0x3D, 0xF3, 0xA1, 0x6B, 0x5E, 0x7A, 0xFD, 0x28, 0xF0, 0xA1, 0xD7, 0x4B, 0xFC,
+    0x5B, 0x86, 0x5E, 0xFB, 0x96, 0x27, 0x7E, 0xC2, 0xBE, 0x0E, 0x2D, 0xF7, 0x50, 0x6C, 0x1D, 0x5B,
+    0xCE, 0xF8, 0x98, 0xC7, 0x26, 0xB6, 0x3E, 0xE3, 0xB9, 0x1E, 0xEA, 0x81, 0xF8, 0xA5, 0xA3, 0x9A,
+    0xB9, 0x23, 0x9C, 0x26, 0x32, 0x90, 0xFF, 0x7E, 0x80, 0x85, 0x88, 0x29, 0x67, 0x28, 0xAD, 0xE5,
+    0xAE, 0x02, 0x16, 0x62, 0x80, 0x6A, 0x78, 0xCF, 0x16, 0x00, 0xD5, 0x6B, 0xFE, 0xCA, 0xD5, 0xEC,
+    0xF5, 0x9D, 0x08, 0x2C, 0xED, 0x91, 0xD7, 0x87, 0x1E, 0x0A, 0xDF, 0x84, 0x3E, 0xF3, 0x23, 0x8E,
+    0x82, 0x65, 0x00, 0x16, 0x27, 0x4A, 0x07, 0x2C, 0x33, 0xB0, 0x04, 0x01, 0x35, 0x34, 0x5C, 0xD9,
+    0xDA, 0x53, 0x3B, 0x02, 0x03, 0x17, 0x88, 0xD8, 0x2B, 0x4B, 0xF5, 0x1F, 0xDC, 0x13, 0x62, 0xA2,
+    0x2C, 0xEA, 0x89, 0xCA, 0x15, 0x13, 0x29, 0xB6, 0xC0, 0x09, 0x73, 0xC1, 0x1E, 0x90, 0x78, 0x24,
+    0x40, 0xEF, 0x81, 0x0B, 0x4B, 0xC9, 0x3C, 0x50, 0x23, 0x8B, 0x5E, 0xF2, 0x90, 0x73, 0xC3, 0x63,
+    0xE5, 0xB1, 0xB4, 0xB3, 0x42, 0x2E, 0x06, 0x2C, 0x38, 0xC6, 0x6F, 0xE5, 0x04, 0xD2, 0x5D, 0x92,
+    0xEC, 0x8A, 0xBC, 0xF9, 0x8B, 0x19, 0xE7, 0x31, 0x4F, 0x52, 0x42, 0x54, 0xC8, 0xB9, 0xF5, 0x90,
+    0x29, 0x67, 0x49, 0x0B, 0x90, 0x35, 0xAF, 0x71, 0x27, 0x3F, 0xE3, 0xBE, 0xE0, 0xCF, 0x99, 0x54,
+    0xD4, 0x81, 0xF8, 0x8C, 0x7D, 0xC5, 0x2F, 0x78, 0x6E, 0xF9, 0x5B, 0xFE, 0x85, 0xA3, 0x36, 0xCB,
+    0xD5, 0x59, 0x64, 0x73, 0x74, 0x72, 0x8E, 0x97, 0x83, 0x63, 0x7E, 0x1D, 0xCD, 0x3E, 0x1F, 0x9E,
+    0xC7, 0x26, 0x36, 0x27, 0xAE, 0xB5, 0xE6, 0x60, 0xE2, 0x1F, 0xD8, 0xDC, 0xB9, 0x57, 0xC5, 0x88,
+    0x28, 0x57, 0x08, 0xCE, 0xFC, 0xBC, 0xA0, 0xEC, 0x9E, 0x1E, 0xA8, 0xFD, 0x09, 0x17, 0xF1, 0x47,
+    0x9E, 0x8A, 0xD0, 0xCC, 0x54, 0x5B, 0x31, 0xFD, 0x2A, 0xA6, 0x3D, 0x98, 0xA2, 0x82, 0xC9, 0x99,
+    0x64, 0xEA, 0x60, 0x0A, 0x48, 0x83, 0x3A, 0xDB, 0xD9, 0xF5, 0x06, 0x31, 0x9E, 0x42, 0x78, 0x29,
+    0x4B, 0x0B, 0xF1, 0xA2, 0xBC, 0xE2, 0x3E, 0xE7, 0x65, 0xA4, 0x8A, 0x5B, 0x47, 0xCA, 0x23, 0x27,
+    0x66, 0xA6, 0x2D, 0x5E, 0x90, 0x64, 0xAE, 0x97, 0xC5, 0x63, 0xF9, 0x86, 0x87, 0x3A, 0x90, 0x72,
+    0x15, 0x6E, 0xE0, 0x02, 0x88, 0xB4, 0x60, 0xA8, 0x3D, 0xEE, 0xC9, 0x10, 0x39, 0xDE, 0x97, 0x0E,
+    0xEF, 0xAF, 0x02, 0x01, 0x54, 0xCA, 0xBF, 0x4E, 0x46, 0xC0, 0x56, 0xA7, 0xE2, 0xC6, 0x9B, 0xF8,
+    0x89, 0x46, 0x05, 0xF0, 0x7C, 0x29, 0xCB, 0xA8, 0xB1, 0xCC, 0x95, 0x2C, 0xA4, 0x65, 0xC9, 0x8C,
+    0xDC, 0xB9, 0x7E, 0x72, 0xD8, 0x9F, 0x43, 0x76, 0x99, 0x83, 0xF9, 0xFA, 0xD6, 0x9F, 0x81, 0x9A,
+    0xE7, 0x96, 0xF4, 0xEE, 0x98, 0x05, 0xD3, 0x95, 0xEB, 0x57, 0xB3, 0x3B, 0xE5, 0xC1, 0xF4, 0xD5,
+    0x79, 0x24, 0x75, 0xE2, 0x08, 0x19, 0xCB, 0xE3, 0xDF, 0x5E, 0x6F, 0x77, 0x5B, 0x77, 0xC5, 0x1F,
+    0xF3, 0x54, 0x30, 0x28, 0x0F, 0x69, 0x87, 0x06, 0x0D, 0x54, 0x3F, 0x01, 0xB7, 0xF6, 0x67, 0x60,
+    0x7F, 0x7A, 0xE0, 0x70, 0xD1, 0x33, 0x08, 0xC0, 0xCD, 0x80, 0x92, 0x31, 0x2F, 0x2A, 0xC1, 0x0D,
+    0x7A, 0x9B, 0x11, 0x50, 0x3A, 0x42, 0xE8, 0x60, 0x38, 0xDC, 0x4C, 0x88, 0xBE, 0xDF, 0x80, 0xDC,
+    0xE2, 0x33, 0xA1, 0x98, 0x78, 0x0E, 0x42, 0x20, 0x10, 0xEA, 0xDC, 0x17, 0xC2, 0x40, 0x64, 0x10,
+    0xB9, 0x21, 0xA4, 0x06, 0x87, 0x15, 0x12, 0x53, 0xC0, 0x49, 0xF2, 0x70, 0xA1, 0x78, 0x51, 0x46,
+    0x21, 0xEF, 0xE2, 0xDD, 0x87, 0x52, 0x88, 0x5A, 0xBE, 0x8E, 0xBB, 0xBD, 0x04, 0x3E, 0x54, 0x92,
+    0xF3, 0xEB, 0x50, 0x76, 0xF0, 0x7C, 0x2A, 0xD9, 0x3A, 0x92, 0x45, 0x32, 0x16, 0x44, 0x41, 0x23,
+    0xC0, 0x15, 0x7A, 0x43, 0x22, 0xEB, 0x24, 0xE3, 0xD2, 0x8D, 0x57, 0x4D, 0x51, 0x4C, 0x4E, 0x4C,
+    0xD3, 0x1A, 0x47, 0x29, 0xA6, 0xC6, 0x5D, 0x30, 0x14, 0xA6, 0x01, 0x26, 0x21, 0x6C, 0x03, 0x34,
+    0xED, 0x40, 0xA6, 0x74, 0xF8, 0x40, 0x66, 0xA6, 0x66, 0xAE, 0x6C, 0x11, 0x0A, 0x4F, 0x7A, 0x88,
+    0xF0, 0xA1, 0x3B, 0x70, 0x7B, 0x48, 0x03, 0xA1, 0x92, 0x66, 0x93, 0x3E, 0x53, 0x71, 0x1D, 0x0A,
+    0xEA, 0x4F, 0xCD, 0x74, 0x71, 0x7B, 0x2D, 0xDC, 0x88, 0x92, 0x6C, 0xE9, 0x41, 0x64, 0x0D, 0x7A,
+    0xF6, 0xF1, 0x26, 0x5B, 0xA5, 0x04, 0x05, 0x0E, 0x86, 0x72, 0xD2, 0x0F, 0xBD, 0x42, 0x4F, 0x59,
+    0x5B, 0xFA, 0xE2, 0x18, 0xD7, 0x35, 0xFB, 0x30, 0x45, 0x25, 0x91, 0xB5, 0x9B, 0x44, 0x08, 0x29,
+    0x16, 0x94, 0x3A, 0x4A, 0x8A, 0x91, 0xAA, 0x91, 0x6E, 0x4B, 0x26, 0x29, 0x48, 0xCA, 0xA7, 0xC2,
+    0x18, 0xF0, 0x88, 0xB3, 0xB6, 0x65, 0x40, 0xA8, 0x18, 0x14, 0x38, 0x83, 0xC6, 0xE9, 0xC8, 0xBC,
+    0x88, 0x02, 0x23, 0x0D, 0x05, 0x1C, 0xAC, 0x64, 0x9E, 0x15, 0x12, 0x74, 0x5A, 0x2A, 0x9E, 0xD7,
+    0x1B, 0xE9, 0x88, 0x01, 0xEE, 0x0C, 0x8C, 0xEB, 0x0A, 0x8C, 0x25, 0xE4, 0x7F, 0x9B, 0xA7, 0x26,
+    0x62, 0x96, 0xA1, 0x52, 0xDA, 0x1B, 0xF4, 0x45, 0x7C, 0x8F, 0xB6, 0x16, 0x9A, 0xEA, 0x11, 0x32,
+    0x6D, 0xC4, 0x5C, 0x96, 0xEE, 0x1F, 0x32, 0xBF, 0x95, 0xC6, 0x22, 0xF2, 0x28, 0xD1, 0xAF, 0x05,
+    0x77, 0xE6, 0xC2, 0x02, 0x48, 0x09, 0xD9, 0xBA, 0x7B, 0x8D, 0xB2, 0x6D, 0x47, 0xF7, 0x55, 0x57,
+    0x3D, 0x9E, 0x29, 0x28, 0x10, 0x74, 0xA6, 0xF8, 0x3E, 0xD5, 0xC7, 0x13, 0xC5, 0x96, 0xD4, 0xB1,
+    0x2B, 0x31, 0xAE, 0x31, 0x38, 0x38, 0x56, 0xBC, 0x9A, 0xAE, 0xBB, 0x2F, 0xF0, 0x45, 0x84, 0xA0,
+    0x11, 0x8A, 0xF0, 0x54, 0x3E, 0x76, 0x88, 0xAE, 0xDD, 0xB2, 0xCD, 0xC8, 0x66, 0x3B, 0xD6, 0x2B,
+    0xDB, 0x4C, 0x1B, 0x45, 0x2C, 0xE1, 0xAA, 0x62, 0x4C, 0x17, 0xAA, 0x95, 0xAD, 0xFF, 0x55, 0x41,
+    0x0D, 0x56, 0xC2, 0xB3, 0x37, 0x4A, 0x2A, 0xA0, 0x1A, 0x6F, 0x7F, 0xE8, 0x2B, 0x71, 0x9B, 0x87,
+    0xD2, 0xB5, 0x83, 0x38, 0x9F, 0xD5, 0xA8, 0x93, 0x71, 0x14, 0x23, 0x7A, 0xCB, 0x64, 0x01, 0xC6,
+    0x41, 0x8C, 0x33, 0x5C, 0xE5, 0xBE, 0xB0, 0x6A, 0x30, 0x14, 0x2A, 0x18, 0xDB, 0x0F, 0xAE, 0x18,
+    0xE1, 0x37, 0xD5, 0x9C, 0x7F, 0xE4, 0xCD, 0x64, 0xF2, 0xEF, 0xEC, 0xEC, 0x7C, 0x26, 0x34, 0x25,
+    0xD3, 0x6D, 0xD8, 0x9C, 0x7E, 0x65, 0xE4, 0x45, 0x1A, 0x46, 0x7E, 0x99, 0x0A, 0x96, 0xE2, 0xE7,
+    0x42, 0xF7, 0x4A, 0x0E, 0x28, 0x39, 0x7A, 0x3F, 0x0D, 0x8D, 0xD8, 0xA1, 0xB0, 0x28, 0xAF, 0x92,
+    0xC9, 0xF5, 0x00, 0x14, 0xCB, 0x5D, 0x16, 0xA8, 0x9A, 0x0A, 0x54, 0xB0, 0x57, 0x23, 0x99, 0xEF,
+    0x18, 0x64, 0x46, 0xF2, 0xD3, 0xA9, 0x96, 0x7F, 0x4B, 0x9E, 0x53, 0xFB, 0x5C, 0xB4, 0x0D, 0xAE,
+    0x79, 0x3C, 0xA7, 0x66, 0xFA, 0x3E, 0x6D, 0x24, 0xDF, 0x7C, 0x63, 0x4C, 0x1B, 0x36, 0x6D, 0xDC,
+    0xBF, 0xBC, 0x81, 0x09, 0x80, 0x0D, 0x19, 0x5F, 0xB5, 0x15, 0x0E, 0x61, 0xA3, 0xC7, 0x34, 0xE6,
+    0xBD, 0xA9, 0xB4, 0x18, 0xC0, 0x8E, 0xA4, 0x81, 0x1E, 0x20, 0x9A, 0x82, 0xD5, 0xEF, 0x08, 0x40,
+    0x62, 0xC5, 0x8F, 0xE5, 0x69, 0xFA, 0x86, 0x17, 0x86, 0x97, 0x4C, 0xFF, 0xF7, 0xF9, 0x0B, 0x9D,
+    0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0x1C, 0x96, 0x70, 0xB1, 0x15, 0x02, 0x29, 0x12,
+    0x6E, 0x28, 0x10, 0x8D, 0xFF, 0x00, 0xCA, 0x9A, 0xA4, 0x48, 0x91, 0x02, 0x0A, 0x24, 0x0A, 0x8A,
+    0x54, 0x94, 0xE8, 0x1A, 0xCA, 0x10, 0x9B, 0x44, 0x82, 0x32, 0x69, 0xA8, 0x28, 0x48, 0x01, 0x12,
+    0x84, 0x22, 0x14, 0x14, 0x29, 0xC2, 0xED, 0x26, 0x5F, 0x71, 0xC5, 0x49, 0x60, 0x40, 0x88, 0xE2,
+    0x8A, 0x73, 0x20, 0x08, 0x89, 0x14, 0xD9, 0x5C, 0xF6, 0x8E, 0x4D, 0xB2, 0xBB, 0xC3, 0x1B, 0x7F,
+    0x9C, 0x20, 0x02, 0x1A, 0x2C, 0xCF, 0x5A, 0xBB, 0x5E, 0xEF, 0xBC, 0x99, 0x79, 0x6F, 0x4C, 0x44,
+    0x1D, 0x51, 0x63, 0xA9, 0xF4, 0x44, 0x5F, 0x61, 0xD2, 0x53, 0x33, 0x2D, 0x13, 0xC3, 0x97, 0x3A,
+    0xE6, 0x86, 0xF9, 0xA7, 0x50, 0xC7, 0x2D, 0x1A, 0x36, 0x47, 0x75, 0x67, 0x6E, 0x0E, 0xF3, 0xD5,
+    0x64, 0x98, 0xF1, 0x46, 0xF1, 0x03, 0x5A, 0x5F, 0x5D, 0xC6, 0x09, 0xCC, 0x23, 0x31, 0x06, 0x95,
+    0x4A, 0xEE, 0x07, 0x5B, 0x70, 0x15, 0xA9, 0xCC, 0x6A, 0x26, 0x3C, 0x89, 0x94, 0x93, 0x97, 0x53,
+    0x85, 0xA1, 0x57, 0xCC, 0x49, 0x96, 0xE0, 0x83, 0xF4, 0x2E, 0xF7, 0x0D, 0xB7, 0x58, 0x8E, 0x1A,
+    0xC3, 0xCC, 0xB2, 0x01, 0x16, 0x0A, 0x39, 0x8B, 0x36, 0xF9, 0xD2, 0xDA, 0xC5, 0xD3, 0xD4, 0x64,
+    0x52, 0xB6, 0x63, 0x5F, 0x39, 0xEC, 0xEE, 0xA3, 0xCA, 0xC6, 0xE9, 0x26, 0x94, 0x51, 0xAD, 0x22,
+    0xE9, 0x0B, 0x2E, 0x51, 0x83, 0x8F, 0xA9, 0xC0, 0x31, 0x96, 0x06, 0xC5, 0x8E, 0xD4, 0x8A, 0x23,
+    0xD5, 0x0E, 0x9B, 0xB1, 0xD8, 0xC2, 0xBF, 0x5A, 0x65, 0x32, 0x17, 0x9C, 0xE0, 0x88, 0xC0, 0xEF,
+    0x8E, 0x03, 0x8D, 0x57, 0xA3, 0xC6, 0x99, 0x73, 0x61, 0x66, 0x89, 0x21, 0x12, 0x5E, 0x88, 0x59,
+    0x35, 0xD5, 0xAE, 0x76, 0x45, 0x2C, 0x23, 0x0D, 0xC4, 0xD4, 0xDA, 0xCE, 0xD6, 0xBE, 0x09, 0x45,
+    0x92, 0x38, 0xFA, 0x76, 0x1D, 0x4B, 0x28, 0x99, 0x73, 0xC1, 0xA7, 0x78, 0x34, 0xE3, 0x30, 0xEB,
+    0xA9, 0x8D, 0xAD, 0xAF, 0x59, 0x61, 0x69, 0x85, 0xA5, 0x7B, 0x3C, 0x77, 0xD1, 0x84, 0x86, 0xE9,
+    0xE8, 0x2A, 0x72, 0x4F, 0x9A, 0x23, 0xBE, 0x72, 0x6A, 0x1A, 0xEC, 0x39, 0x32, 0x27, 0x1D, 0x25,
+    0x65, 0xAB, 0x70, 0x9C, 0xD4, 0xEC, 0xA9, 0x5B, 0x4D, 0x64, 0xD4, 0x58, 0x45, 0xFD, 0x1B, 0x3B,
+    0x64, 0xD9, 0xC2, 0xD7, 0xCB, 0x92, 0x2D, 0xB3, 0xA4, 0xE1, 0x09, 0xD8, 0x0B, 0x44, 0x4F, 0x3A,
+    0x3A, 0xC6, 0x33, 0x12, 0x64, 0x6B, 0x01, 0x9A, 0xAF, 0x50, 0x07, 0xF0, 0xDA, 0x12, 0x0D, 0xEF,
+    0x7D, 0x8C, 0xB2, 0x71, 0x0F, 0x9B, 0x61, 0xDE, 0x78, 0x00, 0xB0, 0x2A, 0x0E, 0xB6, 0x5E, 0x4C,
+    0x4F, 0x2A, 0xEA, 0x6C, 0x02, 0xE0, 0x3B, 0x14, 0x6C, 0xC2, 0x19, 0x3D, 0x75, 0x81, 0x38, 0x23,
+    0xAA, 0x29, 0x3D, 0xE3, 0x62, 0xE1, 0x23, 0xF9, 0x58, 0xBA, 0xA5, 0x14, 0x2E, 0x7F, 0x1E, 0x23,
+    0x6D, 0xE1, 0xE6, 0xAB, 0x19, 0x91, 0xA2, 0x48, 0xD8, 0x36, 0x30, 0x6F, 0x32, 0xEF, 0x32, 0x3F,
+    0x44, 0xD9, 0xCD, 0x28, 0xCE, 0x9B, 0x40, 0x25, 0xA2, 0x34, 0x96, 0x3A, 0x47, 0x4D, 0xFC, 0xFB,
+    0x24, 0xAD, 0x23, 0x47, 0x92, 0x49, 0x21, 0x90, 0x4A, 0x3C, 0xA6, 0x6E, 0xA2, 0xA1, 0xF1, 0xD4,
+    0xDE, 0x44, 0xD5, 0x9C, 0x19, 0xCB, 0x88, 0x33, 0xB8, 0x0E, 0x34, 0xBC, 0x9B, 0x49, 0x4F, 0xC3,
+    0xD8, 0xB9, 0x76, 0x61, 0xC2, 0x5D, 0xD8, 0xCF, 0x30, 0x2F, 0xFC, 0xE8, 0x2C, 0xF6, 0x38, 0xD2,
+    0xE3, 0x9A, 0x73, 0xB7, 0xA9, 0x46, 0xB9, 0xF4, 0x9D, 0x58, 0x85, 0xD2, 0xB7, 0xDF, 0xBE, 0x2E,
+    0xF9, 0x5A, 0x61, 0xDF, 0x2B, 0xC8, 0x97, 0xFE, 0xA4, 0x27, 0x80, 0xAB, 0x92, 0xD4, 0xF4, 0xD5,
+    0xB7, 0x40, 0x38, 0x2F, 0x15, 0x83, 0xD1, 0x53, 0x60, 0xD4, 0x95, 0xFE, 0xCA, 0xE5, 0x17, 0x2F,
+    0x03, 0x9E, 0x0E, 0x6D, 0x00, 0x24, 0x95, 0x15, 0x38, 0x3A, 0x7C, 0xC7, 0xA7, 0xF1, 0x68, 0xE2,
+    0xF0, 0xA3, 0x80, 0xE6, 0x8F, 0xEE, 0x4B, 0xE1, 0xDA, 0x47, 0x59, 0x1E, 0xA5, 0x54, 0x7D, 0x89,
+    0x83, 0xC5, 0xBF, 0x24, 0x5E, 0x50, 0x20, 0x4D, 0xEB, 0x47, 0x96, 0xEA, 0x62, 0x8F, 0x5B, 0x3F,
+    0xB0, 0x57, 0xBE, 0x60, 0x39, 0xFD, 0x77, 0xDE, 0xE3, 0xB1, 0x46, 0x0C, 0xFB, 0x1C, 0x1B, 0xF6,
+    0x1A, 0xDC, 0x9B, 0x8E, 0x05, 0xC5, 0x37, 0xE8, 0x4B, 0x7A, 0x8E, 0xDA, 0x13, 0x60, 0x8A, 0xA3,
+    0x73, 0xD4, 0x7C, 0xFD, 0xC6, 0x7D, 0x7E, 0xC0, 0xA9, 0x7B, 0x40, 0x5B, 0xA4, 0xF6, 0x23, 0xF1,
+    0x8E, 0xAB, 0xB9, 0xB3, 0x3A, 0x9A, 0x8A, 0xF7, 0x63, 0x8B, 0x29, 0x0F, 0xDD, 0xCE, 0x41, 0x34,
+    0xC3, 0x36, 0x4E, 0x6A, 0x77, 0x51, 0xE2, 0x4D, 0x2E, 0x93, 0xF1, 0xCD, 0x21, 0x8F, 0xDD, 0x6E,
+    0x24, 0xD3, 0xAF, 0x73, 0x5D, 0xF9, 0xDA, 0x01, 0x27, 0x00, 0x4C, 0x0A, 0x08, 0x8E, 0x05, 0x7A,
+    0xFC, 0x6A, 0xFB, 0x8D, 0xC2, 0x57, 0x5E, 0xF5, 0xA6, 0x0F, 0x2A, 0xA8, 0xF3, 0x3C, 0x06, 0x1D,
+    0xD4, 0xFB, 0x77, 0x6D, 0x4C, 0x51, 0xED, 0x9D, 0xB1, 0xF0, 0xA6, 0x72, 0x67, 0xCD, 0xCD, 0xD8,
+    0x84, 0x6E, 0x32, 0x27, 0x92, 0xBA, 0x91, 0x21, 0x29, 0x57, 0x04, 0x43, 0xCD, 0xAF, 0x81, 0x3A,
+    0x94, 0x16, 0xA9, 0xAF, 0x78, 0x22, 0x85, 0xB8, 0x75, 0x44, 0xC8, 0x09, 0x29, 0xC9, 0xD4, 0x7D,
+    0x03, 0x85, 0x29, 0x28, 0x5F, 0x71, 0x5F, 0x71, 0x94, 0xFB, 0x61, 0xAC, 0xDC, 0xF5, 0xBF, 0xEE,
+    0x39, 0xE2, 0xAE, 0x97, 0xBB, 0x99, 0xC0, 0xC7, 0xA8, 0xC7, 0x4F, 0x01, 0x69, 0xA3, 0xA7, 0xD7,
+    0x40, 0xA2, 0xE1, 0x04, 0xA3, 0xFE, 0x66, 0x6A, 0x43, 0x17, 0x9B, 0xDC, 0x70, 0xC5, 0xE7, 0xF9,
+    0x16, 0xCF, 0x39, 0x72, 0xD0, 0x83, 0xD9, 0x52, 0x7B, 0x7C, 0x75, 0x75, 0xC0, 0xBB, 0x2E, 0xE9,
+    0xFB, 0x51, 0x5F, 0x8C, 0xAC, 0x6E, 0x65, 0xBD, 0x0A, 0x5A, 0x39, 0x2E, 0x4E, 0x4A, 0x97, 0x29,
+    0xA0, 0xDF, 0x6D, 0x47, 0xA6, 0xB5, 0x65, 0x1C, 0xA8, 0xB9, 0x87, 0xE9, 0x8E, 0x27, 0xD3, 0x4D,
+    0x55, 0x34, 0xBD, 0xDA, 0xE7, 0x85, 0xB6, 0xC2, 0x5E, 0x69, 0x61, 0x87, 0xE0, 0xDA, 0x1E, 0xB8,
+    0x3F, 0xCC, 0x15, 0x90, 0xFB, 0x45, 0xFD, 0x06, 0x88, 0x93, 0x44, 0x8D, 0x23, 0xA9, 0xFD, 0x3E,
+    0x90, 0xBE, 0x38, 0x53, 0xD6, 0x63, 0x15, 0x64, 0x0A, 0x5D, 0x9F, 0x06, 0x11, 0x41, 0xA7, 0x79,
+    0xDD, 0x26, 0x20, 0xC4, 0x24, 0x82, 0x93, 0x93, 0x77, 0x60, 0x47, 0x8E, 0x12, 0x69, 0xF8, 0xFD,
+    0xAF, 0x29, 0xFC, 0xEE, 0xC0, 0xEF, 0x51, 0x63, 0x2B, 0x12, 0xB4, 0x01, 0x51, 0x8D, 0x2D, 0x7F,
+    0xE8, 0x2B, 0xEE, 0x35, 0xB1, 0x6D, 0xAC, 0x9E, 0x0B, 0xAF, 0x02, 0xBD, 0x03, 0x6C, 0xED, 0x08,
+    0xA5, 0x4F, 0x3A, 0xD4, 0x1E, 0x9E, 0x23, 0xA8, 0x97, 0x85, 0x5B, 0x0B, 0xE9, 0xF4, 0x8D, 0xCF,
+    0xA4, 0xB5, 0x52, 0x1D, 0x69, 0x11, 0x1D, 0x09, 0x3B, 0xF5, 0xFC, 0x67, 0x73, 0x3D, 0xBA, 0xD0,
+    0x3A, 0x3B, 0x61, 0xBF, 0x57, 0x07, 0xCF, 0x36, 0x6E, 0x69, 0xC8, 0x52, 0xB7, 0x51, 0x3E, 0x95,
+    0x09, 0x3E, 0x6A, 0xF3, 0x35, 0x48, 0x53, 0x7A, 0x61, 0x61, 0x6E, 0x9B, 0x45, 0xEB, 0xFC, 0x08,
+    0xF6, 0x43, 0xE5, 0x37, 0xA8, 0x9D, 0xA0, 0x8E, 0x1E, 0x40, 0xE1, 0x08, 0x64, 0x6A, 0xE7, 0x45,
+    0xF7, 0xA5, 0x74, 0x7D, 0x4C, 0xA5, 0xF9, 0x80, 0x11, 0xE5, 0x3A, 0x20, 0xB4, 0x21, 0x83, 0x4D,
+    0xDA, 0x22, 0x61, 0x53, 0xEB, 0x1A, 0x57, 0x25, 0xB8, 0x18, 0x2C, 0xBA, 0x37, 0xE8, 0x53, 0x30,
+    0xDE, 0x6B, 0x88, 0xA6, 0x16, 0xA5, 0x20, 0xE1, 0x70, 0x0C, 0xC2, 0xCA, 0xA7, 0x38, 0x62, 0x39,
+    0x19, 0xC8, 0x37, 0x36, 0x85, 0x5D, 0x49, 0x74, 0x25, 0x8A, 0xC3, 0xDA, 0xFA, 0x4F, 0x73, 0x56,
+    0x98, 0x92, 0x3F, 0x58, 0xA4, 0x25, 0x62, 0x86, 0x98, 0xA6, 0x84, 0xCE, 0x46, 0xA9, 0x48, 0x5B,
+    0x94, 0x28, 0x65, 0x0C, 0x79, 0x19, 0x0C, 0xD6, 0xB2, 0xE9, 0x53, 0x95, 0xF4, 0x2F, 0xF9, 0x8C,
+    0xB4, 0x7B, 0xF6, 0x8D, 0xFC, 0x60, 0x0A, 0xB3, 0x68, 0x75, 0x69, 0x4B, 0xCB, 0x90, 0x1F, 0x1F,
+    0xD6, 0xFF, 0x2A, 0x03, 0x31, 0xB5, 0x28, 0x17, 0xA0, 0x0B, 0x13, 0xC8, 0x6C, 0xE2, 0x3F, 0x26,
+    0x70, 0xD5, 0x02, 0x55, 0x60, 0x2E, 0xB8, 0x83, 0xFC, 0x26, 0x27, 0xEA, 0x0E, 0xB9, 0x47, 0xDF,
+    0x87, 0x66, 0xED, 0xE0, 0xB4, 0x2F, 0x97, 0x1E, 0xB1, 0x1C, 0xF1, 0x6F, 0x36, 0xF4, 0x68, 0xFE,
+    0xF4, 0x0F, 0x9B, 0xB5, 0x74, 0xAE, 0xB5, 0xC9, 0xCF, 0x10, 0xDE, 0xA4, 0x38, 0x55, 0x90, 0xAC,
+    0x3F, 0x5F, 0x9C, 0x1A, 0xCF, 0xBE, 0x5D, 0x6F, 0xF7, 0x67, 0xBF, 0xA8, 0x77, 0xE8, 0xFA, 0xB5,
+    0x76, 0x1B, 0x7B, 0x1E, 0xD9, 0x37, 0x5F, 0xA2, 0xCA, 0xD2, 0x32, 0xFC, 0xCF, 0xEB, 0x0F, 0x9D,
+    0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B, 0x15, 0x59, 0xC2, 0xC5, 0xA6, 0x80, 0x8A, 0xC2,
+    0x2D, 0xA2, 0xF1, 0x1F, 0xC8, 0xBD, 0x35, 0xA4, 0xA0, 0xBC, 0x2B, 0x72, 0xDC, 0x7F, 0x40, 0x42,
+    0xAF, 0xA5, 0xF0, 0x9D, 0xAD, 0xE4, 0x07, 0xF0, 0xFE, 0x01, 0x15, 0x15, 0x05, 0x3D, 0xBA, 0x64,
+    0xF7, 0xF2, 0x0A, 0x8A, 0x6B, 0x0C, 0x97, 0x88, 0x82, 0xC6, 0x88, 0x13, 0x0A, 0xBA, 0x22, 0xAB,
+    0x60, 0x81, 0x5F, 0xB2, 0xF6, 0xF0, 0xCD, 0xBE, 0xC7, 0x71, 0x41, 0x4A, 0x0A, 0x9E, 0x76, 0xE6,
+    0xAD, 0xC7, 0xBB, 0x33, 0xBB, 0xDF, 0x7C, 0x33, 0xB6, 0xD5, 0x3D, 0xFD, 0x6A, 0x28, 0x7A, 0xB6,
+    0x1F, 0xCD, 0x32, 0xE9, 0x30, 0x99, 0xAE, 0x27, 0xB9, 0x4C, 0xAC, 0xAD, 0x64, 0xA2, 0x6F, 0x4E,
+    0x98, 0xF9, 0x15, 0x84, 0x65, 0xF2, 0x17, 0x64, 0xB6, 0xF0, 0xE3, 0xCB, 0xAE, 0x79, 0x10, 0x72,
+    0xF1, 0x96, 0x4E, 0xD9, 0x60, 0x9C, 0xB8, 0x12, 0xE3, 0x5D, 0x31, 0x76, 0x56, 0x8C, 0xA5, 0x13,
+    0x27, 0x30, 0x9A, 0x8F, 0x61, 0xD4, 0x62, 0x54, 0x62, 0x14, 0x67, 0xA5, 0xA8, 0x73, 0x51, 0xBF,
+    0x88, 0x1A, 0x89, 0x48, 0x4D, 0x50, 0xC4, 0x15, 0x94, 0x71, 0x50, 0x85, 0x37, 0xB0, 0xF0, 0x80,
+    0x37, 0x1D, 0x91, 0x86, 0x7D, 0x0F, 0x56, 0x79, 0x84, 0x4D, 0x63, 0xCB, 0x5E, 0xE6, 0x69, 0xC8,
+    0x9D, 0xEA, 0x0C, 0xE9, 0xAB, 0x40, 0x86, 0x3B, 0xE2, 0x8D, 0xF8, 0x50, 0x1E, 0x4A, 0x9F, 0x61,
+    0x87, 0xD1, 0x98, 0x85, 0x3B, 0x62, 0x82, 0x4D, 0xAF, 0x3B, 0x31, 0xC1, 0x1E, 0x0C, 0x57, 0xCA,
+    0x33, 0x57, 0xFA, 0xA2, 0x6B, 0xC8, 0xEC, 0x57, 0xA7, 0x34, 0xED, 0x29, 0xAF, 0xC6, 0xD9, 0x3A,
+    0xFD, 0x2B, 0x4F, 0x64, 0xBE, 0xE4, 0x15, 0xCD, 0x1F, 0x10, 0x79, 0x89, 0x8E, 0x2D, 0x88, 0xBD,
+    0xA9, 0x14, 0x8F, 0x08, 0x8C, 0xB8, 0x43, 0x7E, 0xD1, 0x97, 0xFB, 0xCF, 0xE1, 0xA6, 0xC7, 0xE2,
+    0xF4, 0x3B, 0xBC, 0xE1, 0x6A, 0x2F, 0x99, 0x92, 0x18, 0xBB, 0x6C, 0x29, 0x09, 0x09, 0xB3, 0x2B,
+    0x38, 0xE0, 0xE9, 0x8C, 0xD4, 0xB8, 0x97, 0x30, 0x96, 0x74, 0x06, 0x47, 0x5F, 0x3E, 0xA3, 0x3A,
+    0x79, 0xD4, 0xD6, 0x39, 0xFB, 0xBA, 0xE4, 0xB1, 0x36, 0x55, 0xA8, 0x4F, 0xE8, 0xF8, 0xF8, 0x94,
+    0x16, 0x4D, 0x88, 0x62, 0xE4, 0xFF, 0x64, 0xA2, 0x45, 0xDD, 0x54, 0x73, 0xDD, 0x70, 0xA8, 0x0D,
+    0xD6, 0x69, 0xF6, 0x5F, 0xA4, 0xDC, 0x52, 0xC9, 0x2E, 0x63, 0x26, 0x43, 0x21, 0x1D, 0x94, 0xCF,
+    0x3B, 0xED, 0xCA, 0xCA, 0x54, 0x0D, 0x4D, 0xC4, 0xF0, 0xCE, 0xDC, 0xE7, 0xCC, 0x6D, 0xF3, 0xC9,
+    0xAC, 0x42, 0x3E, 0x16, 0xBE, 0xF4, 0xD6, 0xD9, 0x35, 0x82, 0x17, 0x41, 0x87, 0xE4, 0x80, 0x28,
+    0x07, 0xD6, 0x19, 0x8E, 0x95, 0x01, 0xDC, 0x6C, 0xA6, 0xB7, 0xFC, 0xCA, 0x4B, 0xCA, 0x70, 0x01,
+    0x73, 0x15, 0xD4, 0x98, 0x0E, 0xC5, 0x0F, 0x47, 0x1E, 0xA9, 0x5B, 0x23, 0x5B, 0xFB, 0xCC, 0x93,
+    0xF9, 0xBA, 0xA2, 0x79, 0x9B, 0xB4, 0x9C, 0x0F, 0x3E, 0xD7, 0x88, 0x5D, 0xE0, 0x82, 0x10, 0x7A,
+    0x87, 0x57, 0xE9, 0x50, 0x56, 0xBA, 0x9F, 0xC9, 0xAC, 0x81, 0x43, 0xE1, 0xF3, 0x60, 0xDD, 0x1B,
+    0x82, 0xE4, 0x1B, 0x02, 0x52, 0xA4, 0x5F, 0x32, 0xDC, 0x3D, 0xCC, 0x86, 0xC3, 0x00, 0x6A, 0x20,
+    0x33, 0x7C, 0x21, 0x81, 0x7E, 0x3F, 0x20, 0xD3, 0x46, 0x52, 0xA4, 0xFC, 0xE4, 0xFD, 0xBB, 0x88,
+    0x8B, 0xAB, 0x0F, 0x10, 0x97, 0xDA, 0x4B, 0x9C, 0xD0, 0xED, 0xC8, 0x72, 0xAB, 0xC1, 0x39, 0x1A,
+    0x8E, 0xEA, 0x99, 0xD8, 0x5A, 0x51, 0x5F, 0xE1, 0xAA, 0x06, 0x89, 0x81, 0x91, 0x1D, 0x35, 0x97,
+    0x4B, 0x28, 0xA7, 0x3B, 0x6A, 0xDA, 0xBC, 0x27, 0x5B, 0xBD, 0xA6, 0x40, 0x05, 0xBF, 0x53, 0xAD,
+    0x06, 0x8C, 0x6D, 0x11, 0x88, 0xCF, 0x2C, 0xD4, 0x63, 0x49, 0xA2, 0x62, 0x2F, 0x0A, 0x6E, 0xD3,
+    0x31, 0x9E, 0x3B, 0xEB, 0x24, 0xD5, 0x09, 0x5E, 0x49, 0x50, 0xB1, 0xE0, 0x1A, 0x13, 0x00, 0x5A,
+    0x32, 0x5F, 0x8D, 0x94, 0x02, 0x1B, 0x8B, 0x5C, 0xF5, 0x94, 0x07, 0x9C, 0x1D, 0x0F, 0x8E, 0x4A,
+    0x7F, 0xF3, 0x61, 0xB8, 0x86, 0x20, 0x9B, 0x41, 0x9F, 0x99, 0x66, 0x35, 0x14, 0xAD, 0x7E, 0xEC,
+    0xE9, 0x5D, 0xB0, 0x44, 0xF8, 0x64, 0xB6, 0x4C, 0x36, 0x4F, 0x96, 0x3F, 0x32, 0x07, 0x20, 0xEC,
+    0x1A, 0x9C, 0xC2, 0x8E, 0xFF, 0xEC, 0x4B, 0xEC, 0x06, 0x64, 0x18, 0x69, 0xFA, 0xD4, 0xA9, 0x1E,
+    0xEC, 0x06, 0x0E, 0x46, 0x08, 0x3E, 0xCB, 0x85, 0x5B, 0x2A, 0x20, 0x09, 0x57, 0xB7, 0xD3, 0x59,
+    0x5D, 0xEA, 0x11, 0xA8, 0xC2, 0x0B, 0x83, 0x1B, 0x3E, 0xF9, 0x36, 0x56, 0x89, 0x24, 0xA7, 0x39,
+    0x9F, 0xEC, 0xD3, 0x43, 0x79, 0x48, 0xC7, 0xF2, 0xBE, 0x0C, 0xF3, 0x20, 0x8E, 0x75, 0x90, 0xD1,
+    0x89, 0x21, 0x4E, 0x9B, 0xEF, 0x65, 0xFC, 0x9B, 0xB6, 0x47, 0x37, 0xC6, 0xFC, 0xFA, 0xE0, 0x9B,
+    0xA3, 0xA2, 0xA2, 0x05, 0x62, 0xC6, 0xA9, 0x1B, 0x9B, 0xE9, 0xC3, 0x56, 0xC1, 0x16, 0x55, 0xA5,
+    0x86, 0x9D, 0x92, 0xCB, 0xEE, 0x14, 0x0A, 0xDB, 0x92, 0xEE, 0xCB, 0x39, 0x45, 0xC9, 0x04, 0x15,
+    0x7B, 0x82, 0x92, 0x34, 0x18, 0xE4, 0x51, 0x75, 0xA7, 0x44, 0x77, 0xB2, 0x96, 0x94, 0xAB, 0x65,
+    0xC2, 0xAB, 0x0C, 0xC0, 0x54, 0x75, 0x76, 0x16, 0x32, 0x57, 0xE7, 0xAE, 0xCE, 0xDC, 0x69, 0xDE,
+    0x1E, 0x2F, 0xCF, 0xC6, 0x8C, 0x07, 0xD3, 0x36, 0x53, 0x6C, 0x07, 0xF1, 0x77, 0x1B, 0x32, 0x26,
+    0x2D, 0x8D, 0x69, 0x77, 0x2D, 0x01, 0xD8, 0x01, 0x98, 0x15, 0x24, 0x8C, 0x69, 0xFF, 0x10, 0xB2,
+    0xD8, 0xCA, 0x6F, 0xF3, 0x88, 0xA0, 0x90, 0x3E, 0x42, 0x1E, 0xC9, 0x86, 0x3B, 0xD1, 0x11, 0x1A,
+    0x4D, 0xB1, 0xA5, 0x95, 0x70, 0x4D, 0x6A, 0x48, 0x6D, 0x00, 0x36, 0x32, 0xD4, 0x45, 0xAA, 0x25,
+    0xBC, 0xB2, 0x52, 0x63, 0x13, 0x15, 0x3D, 0x2E, 0x2F, 0xFC, 0x4A, 0x27, 0x74, 0x85, 0x7C, 0x00,
+    0x5C, 0xA6, 0x03, 0x14, 0x42, 0x34, 0x85, 0xF2, 0x70, 0x7A, 0x4C, 0x50, 0xCA, 0x28, 0x10, 0x62,
+    0x07, 0x7E, 0x64, 0x92, 0x3F, 0x64, 0x16, 0x01, 0xC1, 0xD3, 0x2D, 0xAF, 0x68, 0xDB, 0xD2, 0x9A,
+    0xB6, 0x58, 0x07, 0x3A, 0x29, 0x5D, 0xBA, 0x99, 0x29, 0x7F, 0x0E, 0x98, 0x38, 0x76, 0x47, 0x15,
+    0x23, 0x0B, 0xF1, 0x2B, 0x30, 0xB0, 0xCD, 0xFF, 0xE0, 0xB6, 0x5C, 0xB3, 0x43, 0xC5, 0x77, 0x52,
+    0xEE, 0x5A, 0xFA, 0x1E, 0xB8, 0xA6, 0xC5, 0x65, 0xF8, 0x4F, 0xF1, 0x49, 0x66, 0xCE, 0xBD, 0xE2,
+    0xD2, 0x15, 0xC1, 0x12, 0xBF, 0x00, 0xC9, 0xCE, 0x7D, 0xC3, 0xE5, 0x7A, 0x0A, 0xB6, 0xFC, 0xE9,
+    0xC5, 0xC4, 0xC5, 0x39, 0xFB, 0x66, 0xC9, 0xF7, 0x27, 0x1B, 0xF2, 0x3F, 0xB9, 0x2B, 0x7F, 0x9E,
+    0xC9, 0x2E, 0x7D, 0x3A, 0x5D, 0x7B, 0x68, 0x70, 0x23, 0xC1, 0x42, 0xC5, 0x0A, 0x83, 0xA4, 0x73,
+    0xF5, 0xE6, 0x8E, 0x82, 0x52, 0xB5, 0x99, 0xB0, 0x81, 0xA9, 0xE8, 0xD0, 0x16, 0xBC, 0x9A, 0x00,
+    0x46, 0xE3, 0x66, 0x1C, 0xCF, 0x82, 0xAC, 0x78, 0x8F, 0x8E, 0x8A, 0xAE, 0x83, 0x43, 0x4B, 0xBA,
+    0x0B, 0xE9, 0x30, 0x02, 0xB9, 0xB4, 0x8F, 0xA2, 0x8F, 0x37, 0xB9, 0xB5, 0x0C, 0xB0, 0xC9, 0x97,
+    0x81, 0x29, 0x62, 0xA0, 0x85, 0xCD, 0x0B, 0x5A, 0x18, 0x32, 0x6F, 0x1B, 0xCC, 0xDB, 0x81, 0xA5,
+    0xBB, 0xF1, 0x1E, 0xD1, 0x67, 0xD2, 0x81, 0x7C, 0xEC, 0x12, 0x1D, 0xAE, 0x30, 0xC5, 0x49, 0xB4,
+    0x80, 0x80, 0x78, 0x25, 0x45, 0x6A, 0x5F, 0xAE, 0xD0, 0xE2, 0x60, 0x46, 0x71, 0xA3, 0x80, 0x25,
+    0xA1, 0xAD, 0x76, 0x68, 0xA3, 0x38, 0xF9, 0xD3, 0xA5, 0xF4, 0x62, 0xF9, 0xF6, 0xB0, 0x53, 0xF2,
+    0x19, 0xD3, 0xC2, 0x8B, 0x12, 0xDF, 0x8E, 0xF8, 0x3B, 0xDC, 0xD1, 0x46, 0x1C, 0xA6, 0x61, 0xEB,
+    0x14, 0x2B, 0xFA, 0xB8, 0xF4, 0x68, 0xBA, 0xB7, 0xFD, 0xDC, 0x99, 0xED, 0x3E, 0x1C, 0xE0, 0x9B,
+    0x09, 0xBE, 0xCB, 0xB6, 0xEC, 0xD1, 0xD7, 0xC7, 0x34, 0xA4, 0xE0, 0xA4, 0x10, 0xAA, 0x2D, 0xB6,
+    0x7B, 0x3C, 0x3C, 0x0F, 0xF4, 0xBF, 0x7F, 0x7F, 0x03, 0x85, 0x55, 0x3D, 0x6F, 0xE5, 0x44, 0x14,
+    0xBD, 0xF6, 0x40, 0x2C, 0xAD, 0x8B, 0xA9, 0x68, 0x58, 0x09, 0xF7, 0x0B, 0xD2, 0xFC, 0x81, 0x95,
+    0xC6, 0xF0, 0x07, 0xB2, 0x45, 0x52, 0xD3, 0x42, 0xB5, 0x7F, 0x00, 0xAD, 0x2D, 0x28, 0x28, 0x49,
+    0x45, 0x43, 0x93, 0x72, 0x49, 0x93, 0x86, 0xF2, 0x05, 0x4F, 0x94, 0x22, 0x88, 0x48, 0x3C, 0x4B,
+    0x2B, 0xAA, 0x2D, 0xB0, 0xD8, 0x0A, 0xB6, 0xC8, 0x44, 0xF1, 0xF2, 0x66, 0x93, 0xB1, 0x2F, 0xE7,
+    0xCE, 0x7B, 0xF9, 0x58, 0x09, 0x09, 0xC7, 0x73, 0x33, 0xF3, 0x3C, 0x73, 0x3F, 0xCF, 0x3D, 0x43,
+    0x24, 0x4F, 0xC5, 0x78, 0xEA, 0x06, 0x62, 0xCA, 0x64, 0x3A, 0x16, 0x22, 0x87, 0x92, 0x6B, 0x33,
+    0x53, 0xC9, 0x19, 0xF7, 0x90, 0x7A, 0x22, 0x2A, 0x67, 0x4C, 0x31, 0xC7, 0x94, 0x1A, 0x0E, 0x32,
+    0x95, 0x79, 0x73, 0x7E, 0x1D, 0x49, 0x45, 0x7B, 0x36, 0x92, 0xE9, 0x59, 0x7B, 0x62, 0x15, 0x4D,
+    0x5F, 0x44, 0xED, 0x1B, 0x67, 0x06, 0xEB, 0x98, 0xB8, 0x66, 0x35, 0x17, 0xB1, 0x88, 0x65, 0xB4,
+    0xDE, 0xF8, 0x6A, 0x7C, 0x70, 0x70, 0xF0, 0x5C, 0x89, 0x55, 0x8C, 0x5E, 0x7B, 0x3B, 0xD0, 0x6C,
+    0x7A, 0xD2, 0xE7, 0x3D, 0xE5, 0xEC, 0x09, 0x5F, 0x28, 0x5F, 0xAD, 0x7C, 0x16, 0xE2, 0x11, 0x2D,
+    0xAC, 0x6E, 0xAD, 0x3E, 0xF1, 0xD5, 0x37, 0xFE, 0x48, 0x0F, 0xB1, 0x72, 0xF4, 0xF1, 0x5E, 0x31,
+    0x66, 0x1C, 0x55, 0xC4, 0x3E, 0x15, 0xE1, 0xEC, 0x29, 0xF4, 0x76, 0x1C, 0x75, 0x30, 0x1C, 0x74,
+    0x2C, 0xD9, 0x17, 0x73, 0xC7, 0x2D, 0x59, 0xB8, 0x28, 0x01, 0x89, 0x3E, 0x76, 0x9A, 0x3F, 0xE5,
+    0x41, 0x47, 0x82, 0x03, 0xF0, 0x73, 0xB4, 0x9E, 0x2A, 0x11, 0x3A, 0xC0, 0x38, 0x84, 0x5F, 0x8B,
+    0x2A, 0xD8, 0x40, 0x16, 0x8A, 0xBE, 0xE7, 0x51, 0xF2, 0xE2, 0xB5, 0xA4, 0x42, 0x12, 0xE2, 0x92,
+    0x2A, 0xC4, 0x1D, 0x89, 0xB6, 0x78, 0x2F, 0x65, 0x2E, 0x9B, 0xB3, 0x50, 0xF0, 0x71, 0xD4, 0xFC,
+    0x26, 0xEA, 0x17, 0x30, 0xDE, 0x77, 0x23, 0x72, 0xD2, 0x67, 0x3C, 0x53, 0x21, 0x36, 0x47, 0x33,
+    0x18, 0x89, 0xCF, 0x15, 0xA3, 0x6D, 0x55, 0xB8, 0x1D, 0xB2, 0x1E, 0xAA, 0xD1, 0xAC, 0x0D, 0x20,
+    0xD5, 0xEC, 0x72, 0xD1, 0xFE, 0x74, 0xA4, 0xBB, 0x27, 0x8B, 0x22, 0x75, 0x92, 0xF0, 0x0A, 0x4F,
+    0x37, 0x22, 0xAC, 0x8C, 0xF7, 0x1B, 0x47, 0xF9, 0x4C, 0xB6, 0x27, 0x35, 0x21, 0x1E, 0x2A, 0x23,
+    0x19, 0xF1, 0x5F, 0xDE, 0x6A, 0xA4, 0x14, 0x24, 0x95, 0x13, 0x35, 0x03, 0xBC, 0x20, 0xD4, 0x4C,
+    0xA1, 0x88, 0x38, 0xC2, 0x5F, 0x43, 0x66, 0x7C, 0xC2, 0x35, 0x11, 0xBF, 0x64, 0x51, 0x28, 0x46,
+    0x11, 0x93, 0x54, 0xD4, 0x4A, 0x64, 0x64, 0x92, 0xAC, 0x58, 0x1C, 0xD1, 0xA8, 0xC5, 0x8D, 0x2C,
+    0x78, 0xB8, 0xF3, 0xEC, 0x0B, 0xD9, 0xEE, 0x50, 0xFF, 0xD1, 0x52, 0x16, 0x72, 0xE4, 0xB3, 0xAE,
+    0x9C, 0xF2, 0x14, 0xE9, 0x67, 0xD2, 0x83, 0xEE, 0xA9, 0x81, 0xEF, 0x6A, 0xC4, 0x16, 0x7B, 0x3A,
+    0x52, 0x1E, 0x79, 0xA3, 0x05, 0x69, 0x01, 0x66, 0x70, 0xB0, 0x81, 0x11, 0x85, 0x58, 0x50, 0x08,
+    0xA8, 0xCA, 0xF7, 0x09, 0x65, 0x6D, 0x1E, 0x1C, 0x44, 0xCB, 0x1E, 0xA9, 0xA0, 0x46, 0x62, 0x2F,
+    0x70, 0x20, 0x7B, 0x42, 0xF2, 0x89, 0x1A, 0xD4, 0x22, 0x02, 0xA1, 0x17, 0xA8, 0xC1, 0xE9, 0xB4,
+    0xBB, 0x5B, 0xC1, 0x99, 0x46, 0x52, 0x01, 0xC7, 0xA0, 0xAA, 0xC2, 0xD6, 0x4E, 0x02, 0x24, 0xC9,
+    0x85, 0x24, 0xE3, 0x76, 0x39, 0xAD, 0x6D, 0x74, 0x82, 0xAC, 0x9A, 0xB6, 0x7E, 0xBC, 0x09, 0x41,
+    0x0F, 0xA4, 0x90, 0xD3, 0x19, 0x4A, 0x0F, 0x99, 0x5F, 0x33, 0x5F, 0xC1, 0xB7, 0xAE, 0x25, 0x33,
+    0x50, 0x19, 0xD2, 0x51, 0x68, 0x30, 0x29, 0xB7, 0xF7, 0x16, 0xD3, 0xBA, 0x30, 0x02, 0x07, 0xF1,
+    0x68, 0x3D, 0x79, 0xB3, 0xBB, 0x93, 0xCD, 0xB4, 0xF6, 0xC2, 0xE2, 0x17, 0x81, 0x9B, 0x97, 0x49,
+    0x72, 0x44, 0x4E, 0xFF, 0xD7, 0x64, 0xA4, 0xE4, 0xD1, 0xDD, 0xE4, 0xFD, 0x27, 0x92, 0x25, 0x60,
+    0x69, 0xD2, 0xBF, 0xEF, 0x68, 0x47, 0xCC, 0x01, 0x2F, 0x26, 0x9B, 0xB7, 0x7F, 0xE7, 0x4D, 0xA0,
+    0x40, 0xAF, 0x62, 0x04, 0x19, 0x15, 0x7E, 0x4A, 0x63, 0x78, 0x77, 0x18, 0x9E, 0x6B, 0xC0, 0x6C,
+    0xC0, 0x18, 0x4D, 0x28, 0xA3, 0xF1, 0xF9, 0x84, 0x56, 0x9B, 0xEF, 0x86, 0xAC, 0xED, 0x84, 0x46,
+    0x8D, 0x18, 0xFE, 0xC3, 0xFD, 0x47, 0xB5, 0xF8, 0x51, 0xF3, 0x58, 0x3A, 0x5A, 0x10, 0x44, 0x37,
+    0x95, 0x3C, 0x1E, 0xE9, 0x33, 0xF7, 0x38, 0xA8, 0xE5, 0xF1, 0x22, 0xDA, 0xEF, 0x4E, 0x12, 0x16,
+    0xD8, 0x35, 0xEC, 0xBA, 0x81, 0x4C, 0xA8, 0x18, 0x27, 0x51, 0x50, 0x05, 0x5F, 0x10, 0x4E, 0x33,
+    0xF0, 0x54, 0x09, 0x3D, 0x4C, 0x96, 0xB7, 0x05, 0x4E, 0xBC, 0x44, 0xD5, 0x24, 0x43, 0xFF, 0xF0,
+    0xA5, 0x04, 0xAF, 0xB8, 0x9B, 0x25, 0x64, 0x12, 0xD2, 0x01, 0x0A, 0x84, 0x48, 0x04, 0x16, 0xD8,
+    0xC9, 0xDC, 0x6F, 0x38, 0x49, 0x50, 0x27, 0x1F, 0x22, 0xDD, 0xDB, 0x20, 0xED, 0x38, 0x6D, 0xFE,
+    0xCB, 0x4E, 0xCD, 0xCB, 0xA9, 0x9B, 0x64, 0xFF, 0x0B, 0xDE, 0x06, 0x44, 0x2B, 0xEE, 0xF1, 0x37,
+    0x93, 0x78, 0x34, 0x02, 0x73, 0x06, 0x0D, 0x26, 0xAC, 0xB6, 0x2E, 0xBA, 0xF2, 0x9B, 0xEA, 0xC7,
+    0xCD, 0x7F, 0x7B, 0x83, 0x06, 0x77, 0x8B, 0x6D, 0x74, 0x27, 0x7A, 0xB4, 0xF0, 0xFC, 0x67, 0xA4,
+    0xF2, 0x15, 0x6F, 0x23, 0xDB, 0x2F, 0xA7, 0x0E, 0x89, 0x3C, 0x5F, 0xAD, 0xEB, 0xDB, 0x6E, 0x48,
+    0x80, 0x92, 0x03, 0x6B, 0xDD, 0x5A, 0x90, 0x4D, 0x89, 0x20, 0xAA, 0x6B, 0xC8, 0x8C, 0x97, 0xAF,
+    0x98, 0xAA, 0x68, 0xBF, 0xE5, 0x9C, 0xDD, 0x5C, 0x26, 0xFB, 0x2A, 0x45, 0xA6, 0x25, 0x6E, 0xFA,
+    0x84, 0xB6, 0xBA, 0x3D, 0x50, 0x04, 0x8E, 0xFB, 0x0F, 0x72, 0x04, 0x60, 0x5B, 0xA9, 0x6A, 0xE9,
+    0x91, 0x6A, 0xA1, 0xC0, 0x0E, 0xE9, 0x29, 0x91, 0x4A, 0xA8, 0xB5, 0xBF, 0x50, 0x75, 0xF9, 0xD7,
+    0x53, 0x80, 0x61, 0x86, 0x75, 0x04, 0x4E, 0xDD, 0x5B, 0xF4, 0x14, 0x30, 0x09, 0xA7, 0x1C, 0x6D,
+    0xED, 0xD3, 0xC3, 0xA0, 0xF9, 0x98, 0x7E, 0xA2, 0x8F, 0xA8, 0xFA, 0x8C, 0xDB, 0xCE, 0xD3, 0x33,
+    0x2A, 0x97, 0x3F, 0x5C, 0xF2, 0x5B, 0x8E, 0x26, 0xE4, 0x28, 0x32, 0x35, 0xFE, 0xBD, 0xAF, 0x84,
+    0x04, 0xEA, 0x2F, 0x41, 0x19, 0x0A, 0x8C, 0x18, 0x01, 0x65, 0x15, 0xAB, 0xC4, 0xDB, 0x1E, 0x3D,
+    0x24, 0x54, 0x11, 0x90, 0xE1, 0xF2, 0x4A, 0x0C, 0x5F, 0xCF, 0x09, 0x8A, 0x22, 0xC2, 0xA6, 0x75,
+    0xF5, 0x3A, 0xDB, 0x82, 0x30, 0xF9, 0xAD, 0x92, 0x80, 0x8D, 0xD4, 0xC4, 0xAC, 0xF0, 0xD9, 0x5E,
+    0xB0, 0x90, 0x0E, 0xBC, 0x06, 0xBD, 0xF2, 0xDF, 0x56, 0x58, 0xED, 0x36, 0xBF, 0x77, 0xE2, 0x51,
+    0xD9, 0x4F, 0x64, 0xB6, 0x07, 0x5A, 0x34, 0xA4, 0x2E, 0xC1, 0x57, 0x7F, 0x80, 0x21, 0x10, 0x7C,
+    0xE2, 0x7C, 0x28, 0x85, 0xE2, 0x06, 0x7C, 0x01, 0x03, 0xE5, 0x39, 0x68, 0xF8, 0xF3, 0x40, 0x93,
+    0x09, 0xE0, 0x11, 0xD1, 0xF5, 0x18, 0x43, 0x9A, 0xA7, 0x2D, 0x52, 0x77, 0x0B, 0x39, 0x36, 0x20,
+    0x1A, 0x12, 0xAE, 0x43, 0x1A, 0x84, 0xF1, 0x30, 0x09, 0x08, 0x68, 0x81, 0xB0, 0x88, 0x8D, 0xDC,
+    0x58, 0xF6, 0xEC, 0x4C, 0xB8, 0xE7, 0xF2, 0x9A, 0x29, 0xDD, 0x02, 0x6D, 0x2A, 0x92, 0x4B, 0xC0,
+    0x13, 0xDE, 0x58, 0xC9, 0xA2, 0x88, 0x91, 0xA5, 0xCB, 0xAD, 0xC6, 0xA2, 0xFB, 0xB5, 0xC5, 0xC2,
+    0x08, 0x92, 0x9C, 0x96, 0xFB, 0x23, 0xAA, 0x14, 0xA9, 0xDB, 0xAD, 0x29, 0xDB, 0xDD, 0x49, 0x58,
+    0x74, 0xF4, 0x3C, 0xF7, 0xC8, 0xEA, 0x02, 0xE6, 0x2D, 0xD9, 0x5A, 0xFF, 0x66, 0x9D, 0x5A, 0x1D,
+    0x4A, 0xCB, 0x0E, 0x40, 0x08, 0xA8, 0xF8, 0x9C, 0xA9, 0x78, 0x7D, 0xE8, 0xB3, 0x2B, 0xA0, 0xE0,
+    0x99, 0x5C, 0x39, 0x6D, 0xC1, 0xE5, 0x40, 0xDD, 0x50, 0x8E, 0xC2, 0xCE, 0x3D, 0x26, 0xD2, 0x09,
+    0x0F, 0x67, 0x10, 0xBE, 0xBE, 0x80, 0x5B, 0xCD, 0x32, 0xE2, 0x36, 0x91, 0x2A, 0x88, 0xAB, 0x46,
+    0xE8, 0x57, 0xAE, 0x30, 0xB5, 0x2E, 0x42, 0x2F, 0xC0, 0x4B, 0xBE, 0xB7, 0xE9, 0x5E, 0x91, 0xF6,
+    0x00, 0x4B, 0x2E, 0xE5, 0xD6, 0x00, 0xE2, 0xCB, 0x08, 0x21, 0x89, 0x1F, 0xD8, 0x99, 0xFB, 0x3C,
+    0xFD, 0x7F, 0xCF, 0xBF, 0x95, 0x55, 0x3D, 0x8F, 0xE4, 0x44, 0x10, 0x2D, 0xBB, 0x05, 0x96, 0x98,
+    0xC0, 0x11, 0x27, 0x10, 0x81, 0x63, 0x2E, 0xA0, 0x7F, 0x42, 0x3B, 0x5B, 0x89, 0xE8, 0x02, 0x46,
+    0xFC, 0x06, 0x48, 0x48, 0x88, 0xAF, 0x87, 0x88, 0x80, 0x64, 0xFF, 0x01, 0x04, 0x17, 0xED, 0x7F,
+    0x00, 0x9B, 0x23, 0x20, 0xD8, 0xE0, 0x4C, 0x44, 0xB8, 0xE6, 0x43, 0x42, 0x22, 0xB9, 0x3E, 0xE4,
+    0x15, 0x9E, 0xBD, 0x1E, 0x17, 0xEF, 0x95, 0x67, 0x3F, 0x75, 0x09, 0x23, 0x4D, 0xB5, 0xDB, 0xD5,
+    0xAE, 0x7A, 0xF5, 0xF5, 0x5A, 0x54, 0xA4, 0x52, 0xED, 0x25, 0x6A, 0x5E, 0x1F, 0xE4, 0x20, 0x22,
+    0xF5, 0x20, 0xEB, 0x43, 0x83, 0x17, 0x45, 0x0E, 0x83, 0x34, 0xE7, 0xB3, 0x14, 0xCB, 0x22, 0xE2,
+    0x71, 0xA6, 0xD4, 0x84, 0x07, 0xE8, 0x4B, 0x9D, 0x44, 0x82, 0x0E, 0xE2, 0x54, 0x77, 0x12, 0x2E,
+    0x16, 0x71, 0xB9, 0x9B, 0x25, 0x3C, 0xD7, 0xE4, 0x72, 0xAD, 0xBD, 0xEA, 0x54, 0x67, 0xE8, 0x86,
+    0x6E, 0xAC, 0x55, 0x1D, 0x9C, 0xB9, 0xEC, 0xF1, 0x49, 0xFD, 0x8A, 0x9E, 0xE2, 0x8B, 0x0C, 0xEB,
+    0x4B, 0x1C, 0x45, 0x36, 0xAF, 0xA1, 0x83, 0x6D, 0xE8, 0xA4, 0x83, 0x29, 0x18, 0xCC, 0xC4, 0xA1,
+    0x04, 0x12, 0xF8, 0x42, 0xE8, 0xE1, 0x08, 0xB1, 0xD1, 0xF5, 0x73, 0x83, 0xD2, 0xE0, 0xCC, 0x26,
+    0x53, 0x86, 0xE4, 0x75, 0x14, 0xED, 0x21, 0x35, 0xFB, 0x5E, 0x73, 0x68, 0x25, 0x77, 0x22, 0x19,
+    0x48, 0xAF, 0x00, 0x1F, 0xA8, 0x0B, 0x1C, 0x2B, 0xEC, 0xB3, 0x16, 0x7F, 0xE2, 0x9E, 0xC4, 0xBD,
+    0x3E, 0x88, 0xFB, 0x47, 0x5B, 0x97, 0x74, 0x74, 0x29, 0xCC, 0x88, 0xD6, 0xA7, 0x37, 0x8A, 0xF1,
+    0x8E, 0x08, 0x0F, 0x45, 0x54, 0x55, 0x13, 0xD3, 0x43, 0x71, 0xB9, 0x8D, 0x53, 0x4C, 0x12, 0x4C,
+    0xEC, 0x29, 0xB4, 0xA3, 0x10, 0x06, 0x7B, 0x2B, 0x9E, 0x8A, 0x3F, 0x19, 0xCB, 0x29, 0x4A, 0x38,
+    0x49, 0xEE, 0xCE, 0xF2, 0x75, 0x72, 0x73, 0x77, 0xD6, 0x7D, 0xA3, 0x3A, 0x77, 0xAA, 0xB6, 0x48,
+    0x38, 0x4F, 0xEE, 0x80, 0x05, 0xA9, 0xFB, 0x08, 0x65, 0x18, 0x63, 0x0F, 0x7B, 0xBA, 0x57, 0xA6,
+    0x49, 0xFF, 0xCA, 0xAC, 0x87, 0x7E, 0x9B, 0xA4, 0x46, 0x3E, 0xA9, 0x1A, 0x11, 0x2C, 0x54, 0x3B,
+    0x24, 0x4A, 0x1C, 0x8B, 0x08, 0xD5, 0x0C, 0x97, 0x47, 0x55, 0x6B, 0xAA, 0x03, 0xB2, 0x0B, 0xD5,
+    0x7E, 0xFB, 0x45, 0x66, 0x11, 0x10, 0x0D, 0x54, 0xCA, 0x54, 0xD7, 0x5C, 0x58, 0x07, 0x65, 0x55,
+    0xD4, 0x54, 0x4E, 0x77, 0x25, 0x55, 0x8B, 0x6C, 0xA8, 0x9A, 0xC5, 0x53, 0x35, 0x0A, 0x22, 0x93,
+    0x80, 0x0A, 0xE5, 0x6B, 0xD1, 0xCB, 0x2A, 0xDA, 0x07, 0xC2, 0x1B, 0xE4, 0x7B, 0xE2, 0x6F, 0x02,
+    0xDA, 0xF9, 0x5B, 0x31, 0x10, 0xC7, 0x41, 0x0C, 0xC0, 0x68, 0x9E, 0x97, 0xDB, 0x8D, 0x6C, 0xB8,
+    0x49, 0xE6, 0x51, 0x0D, 0xC5, 0xCD, 0xA6, 0x5E, 0x37, 0x38, 0xD8, 0xAA, 0x9D, 0x5F, 0x37, 0xB3,
+    0xB6, 0xE8, 0xA8, 0x78, 0x31, 0x89, 0xA6, 0x62, 0xE1, 0x06, 0xCA, 0xC9, 0x50, 0x63, 0xC3, 0x48,
+    0xB8, 0x29, 0x94, 0x1A, 0xA7, 0x2F, 0x79, 0x2C, 0xE4, 0x75, 0xF3, 0xF1, 0x33, 0x39, 0xFB, 0xEE,
+    0x71, 0xFB, 0xF8, 0xEC, 0xEC, 0x99, 0x25, 0x62, 0xBA, 0x91, 0x7D, 0x33, 0xFF, 0x4F, 0x89, 0x20,
+    0x28, 0x75, 0x30, 0x09, 0x1B, 0xCD, 0xE1, 0x83, 0xCC, 0xA2, 0x94, 0x08, 0xD5, 0x8F, 0xC2, 0x02,
+    0x0D, 0x77, 0x65, 0x61, 0x32, 0x98, 0x36, 0x64, 0x93, 0x13, 0xCF, 0x87, 0x53, 0xB9, 0xF7, 0xFB,
+    0xBC, 0x85, 0x28, 0x6C, 0x66, 0x30, 0x99, 0x18, 0xD0, 0x52, 0x0F, 0x1D, 0x03, 0xBA, 0x62, 0x16,
+    0xE1, 0x6F, 0x88, 0xBB, 0xD8, 0x87, 0xBE, 0x4A, 0x7E, 0xA8, 0xC7, 0x22, 0xD7, 0xA9, 0x42, 0x8C,
+    0x2E, 0x97, 0x59, 0xE2, 0x4E, 0xA5, 0x6B, 0x03, 0x21, 0x0D, 0x3E, 0xD5, 0x53, 0x95, 0xFD, 0x25,
+    0x7A, 0x46, 0x3B, 0xED, 0xE3, 0xEC, 0x91, 0x3A, 0xEB, 0x01, 0xB5, 0xE2, 0xEB, 0xD0, 0xAC, 0x7D,
+    0x81, 0xF6, 0x5E, 0xE0, 0xF2, 0xD1, 0x69, 0x7B, 0x8D, 0x80, 0x7C, 0x81, 0x09, 0xFC, 0x04, 0xED,
+    0x71, 0xAE, 0xBB, 0xDA, 0xCE, 0x4E, 0x3F, 0x54, 0x29, 0xF4, 0x19, 0xA3, 0x55, 0x4C, 0x2E, 0xC5,
+    0x32, 0xB9, 0xF1, 0x69, 0x39, 0xD5, 0x43, 0x2C, 0xA7, 0xA6, 0x8F, 0x65, 0x8E, 0xA7, 0xE1, 0xAB,
+    0x05, 0x99, 0x1E, 0xE1, 0x85, 0x86, 0xF3, 0x86, 0x0D, 0x56, 0x98, 0xED, 0xB7, 0x9E, 0x5C, 0x5B,
+    0x7E, 0x5B, 0xF7, 0x9C, 0xFE, 0xB1, 0x64, 0x28, 0xE8, 0x0A, 0x4C, 0xF9, 0x15, 0xA8, 0x05, 0xB1,
+    0xB2, 0xE4, 0x35, 0x99, 0x84, 0x04, 0xE1, 0x67, 0x72, 0x07, 0xF0, 0x30, 0x43, 0xEB, 0x43, 0xE6,
+    0xC3, 0x40, 0x76, 0x39, 0x7D, 0xF4, 0x23, 0xED, 0x13, 0x56, 0x0F, 0x13, 0x64, 0x26, 0xED, 0x6B,
+    0x36, 0xB5, 0xF5, 0x1F, 0x0F, 0xBD, 0xF3, 0xBD, 0x05, 0x60, 0xED, 0x63, 0x3F, 0x34, 0x99, 0x67,
+    0xC0, 0x53, 0x7D, 0xF9, 0xDE, 0x06, 0x6D, 0x0F, 0x6B, 0xA8, 0x46, 0xD8, 0x49, 0x3D, 0xDA, 0x06,
+    0x4E, 0xFD, 0xFE, 0x4B, 0x58, 0x6A, 0xA3, 0x4E, 0xEF, 0xEB, 0x9F, 0xD5, 0x62, 0xB3, 0xF6, 0xD9,
+    0x3A, 0x27, 0xFF, 0x52, 0x5C, 0x50, 0x90, 0x0A, 0x0E, 0xDB, 0x4F, 0x97, 0xED, 0x13, 0x9B, 0x4A,
+    0x09, 0xAC, 0x12, 0xF1, 0x39, 0x23, 0xDC, 0x99, 0xAF, 0x46, 0x31, 0x7B, 0x36, 0xA2, 0x0F, 0x5E,
+    0x55, 0x7C, 0xD5, 0x90, 0x13, 0xE3, 0x25, 0x43, 0xCD, 0xE4, 0x42, 0x42, 0xAC, 0x99, 0xF1, 0x40,
+    0xA4, 0x99, 0xF5, 0xF8, 0x15, 0x5E, 0xB0, 0x0C, 0x05, 0xDB, 0x6A, 0x27, 0x25, 0x8C, 0xF8, 0x37,
+    0x2E, 0xE0, 0xC0, 0x65, 0xCD, 0x52, 0x0D, 0x10, 0x93, 0x31, 0x10, 0xC6, 0x19, 0x23, 0x22, 0xF1,
+    0x27, 0x05, 0x84, 0xEA, 0x20, 0x4D, 0x42, 0x5E, 0x75, 0xD7, 0x4C, 0xA0, 0x0D, 0x63, 0xB9, 0xF8,
+    0x3B, 0x69, 0x04, 0xB4, 0x8D, 0xEA, 0x18, 0xE9, 0x8B, 0xCD, 0x0C, 0xA6, 0xA8, 0x5F, 0x2F, 0x04,
+    0x1C, 0x3B, 0xE6, 0x8F, 0x5C, 0x72, 0x04, 0x9C, 0xD8, 0x8E, 0xBD, 0xD8, 0x88, 0xB2, 0x41, 0x91,
+    0xD1, 0x3F, 0x60, 0x77, 0x33, 0xB9, 0xDC, 0x8C, 0xE8, 0xEB, 0x1E, 0xAD, 0x77, 0x32, 0x17, 0x8B,
+    0x1F, 0x5C, 0xE6, 0x20, 0xCF, 0x62, 0x6C, 0x8E, 0xD3, 0xB8, 0x4B, 0x68, 0x8C, 0x17, 0x07, 0x2B,
+    0x4C, 0xE3, 0xB7, 0xDB, 0x1B, 0xB8, 0xCF, 0x09, 0x17, 0x69, 0xF4, 0x69, 0x63, 0x70, 0xE7, 0xFB,
+    0x70, 0x5F, 0x92, 0xFA, 0xED, 0x33, 0x4E, 0x38, 0x5A, 0xCB, 0x1F, 0xEB, 0xAF, 0xAB, 0xC5, 0xE2,
+    0x3E, 0xDC, 0xEE, 0x2E, 0xDC, 0x77, 0x5B, 0xD9, 0x56, 0x33, 0x26, 0x43, 0x31, 0xB2, 0x7E, 0x68,
+    0xC6, 0x2A, 0x6F, 0x6C, 0x64, 0xC4, 0xFF, 0xB2, 0x48, 0x95, 0x3B, 0x50, 0x27, 0x08, 0x96, 0xF7,
+    0x8E, 0x63, 0x39, 0x58, 0x97, 0x66, 0xE1, 0x05, 0xA5, 0x3F, 0xE3, 0xFF, 0xCA, 0x18, 0xB3, 0xB6,
+    0x0E, 0x3C, 0xE6, 0x05, 0xF3, 0x8D, 0xFA, 0x97, 0x4B, 0xA1, 0x70, 0x0C, 0xFF, 0x05, 0xC1, 0xB3,
+    0xC4, 0xDD, 0x48, 0x3A, 0x3D, 0xD8, 0x05, 0x45, 0x7E, 0xF3, 0xB4, 0xE7, 0xEC, 0x46, 0x8C, 0x6C,
+    0x85, 0x7A, 0xB9, 0xBE, 0x10, 0x37, 0x6B, 0xF5, 0xF1, 0x8D, 0x23, 0x7D, 0x94, 0xFA, 0x82, 0xB6,
+    0x7E, 0xE3, 0xDD, 0x97, 0x40, 0x12, 0xDD, 0x54, 0x61, 0x68, 0x73, 0xA1, 0x73, 0x60, 0x4B, 0xB4,
+    0xC7, 0xA9, 0xAC, 0x58, 0x99, 0x82, 0x11, 0xCA, 0x87, 0x37, 0x8C, 0xF1, 0x1F, 0x9D, 0x55, 0xBF,
+    0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x95, 0x73, 0xC5, 0x21, 0x6D, 0x43, 0x3A, 0xA4, 0x6B, 0x28,
+    0x90, 0x9B, 0xFD, 0x07, 0xCC, 0xDB, 0x43, 0x08, 0x28, 0x28, 0x92, 0xC6, 0xA2, 0xE0, 0x3F, 0x48,
+    0xE3, 0x86, 0xF2, 0xE1, 0xBB, 0x88, 0x82, 0x82, 0x26, 0xFF, 0x01, 0x0D, 0x4D, 0x4C, 0xE1, 0x82,
+    0x92, 0x98, 0x3B, 0xE1, 0xC2, 0x85, 0x0B, 0x56, 0x44, 0x40, 0xE9, 0x4B, 0x1C, 0xC9, 0xA5, 0x57,
+    0xD1, 0x21, 0xCE, 0xF1, 0xDE, 0x0D, 0xDF, 0xEC, 0x3E, 0x93, 0x08, 0x14, 0x09, 0x78, 0xDA, 0xDD,
+    0xD1, 0xCE, 0xBB, 0x9D, 0x9D, 0xEF, 0x9B, 0x1F, 0x6B, 0xEA, 0xC2, 0x59, 0xB2, 0xD4, 0x28, 0x4F,
+    0xB3, 0x69, 0xB3, 0x39, 0x50, 0xCE, 0x8E, 0x14, 0x13, 0x95, 0x23, 0x91, 0xF5, 0x71, 0x5B, 0x71,
+    0x4F, 0x6C, 0xFB, 0x72, 0xEC, 0xDA, 0xA6, 0x65, 0x15, 0x0A, 0xFC, 0x5D, 0x11, 0xD1, 0x9A, 0x6E,
+    0xEF, 0xEE, 0xD6, 0x94, 0x31, 0xF3, 0xF1, 0x58, 0x60, 0xD5, 0xAE, 0x62, 0x0E, 0xB6, 0xA6, 0x6A,
+    0xA0, 0x99, 0xA8, 0x69, 0xD5, 0x48, 0xD9, 0x42, 0xDA, 0x51, 0x31, 0xD1, 0x7F, 0x51, 0xC3, 0xD6,
+    0x8C, 0x6B, 0x99, 0x47, 0x6A, 0xB0, 0x3A, 0xB9, 0x82, 0xEB, 0xFC, 0xE0, 0xE0, 0x5B, 0x7C, 0x48,
+    0x54, 0x8C, 0xB2, 0x56, 0x4E, 0xD6, 0xA6, 0xC6, 0x92, 0xCD, 0xB7, 0x77, 0xEF, 0xE2, 0x40, 0x58,
+    0xE3, 0x68, 0x45, 0xCA, 0x17, 0x3D, 0x85, 0xCC, 0x03, 0xD9, 0x9A, 0x74, 0xFF, 0x77, 0xC5, 0x2F,
+    0x7B, 0x77, 0x95, 0x5C, 0x20, 0x36, 0x2D, 0xAC, 0x13, 0xE5, 0x62, 0xF0, 0x08, 0xD3, 0x88, 0x35,
+    0xEA, 0xDA, 0x72, 0x32, 0x43, 0xBE, 0xC0, 0xBD, 0xEE, 0xFE, 0x42, 0x66, 0x68, 0xEA, 0x62, 0xD2,
+    0x2E, 0x5B, 0xE0, 0x61, 0xD3, 0xCE, 0x64, 0x9C, 0x6D, 0xF5, 0x58, 0x8E, 0xD5, 0x2C, 0x8E, 0xD5,
+    0x26, 0x7A, 0x78, 0x09, 0x1B, 0x4A, 0xDC, 0xEB, 0x60, 0xC3, 0xB8, 0xC4, 0x60, 0xB6, 0x3C, 0x80,
+    0x8B, 0x13, 0x9C, 0x5D, 0xE0, 0x36, 0xB7, 0x44, 0x7A, 0xC0, 0x67, 0x50, 0xD0, 0x72, 0x94, 0x8F,
+    0x69, 0xAC, 0xB3, 0x38, 0xF2, 0x71, 0x55, 0x8C, 0x86, 0x47, 0x0D, 0xD4, 0xF9, 0xCD, 0xC8, 0x30,
+    0x58, 0x06, 0x5C, 0x97, 0xB1, 0xBD, 0x45, 0xD9, 0x7B, 0x13, 0x1D, 0x99, 0xBA, 0xFC, 0x59, 0x62,
+    0x46, 0xFA, 0xB1, 0xA7, 0x65, 0xB5, 0xD2, 0xE7, 0xE7, 0xC3, 0x62, 0x57, 0xE6, 0xFC, 0xFA, 0x62,
+    0x01, 0xA6, 0x27, 0xCC, 0x4B, 0xC9, 0xD7, 0x43, 0x35, 0xED, 0xD3, 0xAA, 0xF0, 0x6A, 0x68, 0x68,
+    0x55, 0x7A, 0xF8, 0x06, 0xB7, 0xFC, 0xDB, 0xD9, 0x47, 0xED, 0xFA, 0xB3, 0xE2, 0xA4, 0x5E, 0x7F,
+    0x77, 0x72, 0xBA, 0xF3, 0xE8, 0xFB, 0xB3, 0x13, 0x04, 0xED, 0xBA, 0xFF, 0x7C, 0x47, 0x1D, 0xF7,
+    0xEF, 0xEC, 0x90, 0xEA, 0xB7, 0x85, 0xD1, 0x44, 0xB3, 0x90, 0x0C, 0x8A, 0xE3, 0x56, 0x60, 0x0C,
+    0x12, 0x28, 0x64, 0x05, 0x8F, 0x25, 0xF3, 0x04, 0xE4, 0x63, 0x37, 0x54, 0x4F, 0x99, 0xCC, 0x29,
+    0xA8, 0x31, 0x2E, 0x0B, 0x5D, 0x5D, 0x3E, 0x9F, 0xE3, 0xB6, 0xDB, 0x1B, 0xF2, 0xB9, 0x6B, 0xF5,
+    0xD5, 0x01, 0x6D, 0x3F, 0x90, 0xCB, 0xF5, 0xCD, 0x1C, 0x5E, 0x99, 0x17, 0x88, 0x38, 0xF8, 0x43,
+    0xB0, 0x7D, 0x75, 0x55, 0xFA, 0xCA, 0xAB, 0xB1, 0x1A, 0xF2, 0xC9, 0xB8, 0x97, 0xD3, 0x3A, 0x15,
+    0xE2, 0x1C, 0x64, 0x16, 0xC1, 0xFA, 0x32, 0x4E, 0xFA, 0xEB, 0x97, 0xF1, 0xB3, 0x98, 0x11, 0xBC,
+    0xC4, 0x94, 0x60, 0x24, 0x2C, 0x11, 0xBB, 0xC6, 0x35, 0x7D, 0xCE, 0x40, 0xDC, 0xF4, 0x6A, 0xDE,
+    0xFA, 0x74, 0x94, 0x5C, 0x82, 0xD7, 0x36, 0x8A, 0x60, 0x92, 0xC8, 0x0E, 0x0E, 0x41, 0xD6, 0x37,
+    0x70, 0xE5, 0x2A, 0xDA, 0xD2, 0x53, 0x12, 0xC9, 0x7C, 0xC9, 0x35, 0xBD, 0x25, 0xA1, 0xBB, 0xFA,
+    0x10, 0x0A, 0x25, 0x07, 0x28, 0x66, 0x7C, 0x48, 0x17, 0x85, 0x78, 0x2D, 0x4B, 0xFE, 0x64, 0xDD,
+    0x0B, 0x59, 0x17, 0x84, 0x5F, 0x33, 0xA0, 0xD9, 0x5F, 0x27, 0x4B, 0x3F, 0xD0, 0x23, 0x7B, 0x80,
+    0x64, 0x93, 0x3B, 0x11, 0x11, 0xFC, 0xC0, 0xE5, 0x5D, 0x7C, 0x16, 0xCD, 0x73, 0x7D, 0x0B, 0x8B,
+    0x78, 0x6D, 0x65, 0x89, 0xFE, 0x67, 0xDD, 0xF0, 0x0A, 0xB0, 0x2E, 0x02, 0x03, 0x43, 0x22, 0xEC,
+    0x0D, 0x30, 0xE3, 0x2D, 0x32, 0x0E, 0x01, 0x02, 0x2D, 0xCB, 0xD6, 0x27, 0x37, 0x88, 0x36, 0xA2,
+    0x8A, 0x62, 0xFE, 0x07, 0xB0, 0x0D, 0xA2, 0x58, 0x42, 0x31, 0x19, 0xDF, 0x10, 0x44, 0xF3, 0x07,
+    0xD0, 0xE7, 0x1B, 0x44, 0x1B, 0x61, 0x93, 0xC0, 0xB5, 0x91, 0x8C, 0x6E, 0x89, 0x65, 0xA1, 0x7B,
+    0x7A, 0x8D, 0x88, 0xA0, 0x95, 0x7C, 0xAC, 0xE6, 0xBD, 0x36, 0xE4, 0x53, 0xEE, 0x23, 0x6A, 0x2D,
+    0x8E, 0xDC, 0x97, 0xC5, 0x53, 0xF9, 0x7B, 0x7D, 0x03, 0xBB, 0x71, 0x59, 0x0B, 0xE3, 0x97, 0x83,
+    0x30, 0x39, 0xDD, 0xC4, 0xAD, 0x13, 0x37, 0x55, 0x2C, 0xEA, 0x58, 0xDF, 0xEF, 0xC2, 0x9D, 0xAF,
+    0xA6, 0x0E, 0xE3, 0xCB, 0xA9, 0xD9, 0x8C, 0xD0, 0x9C, 0x84, 0xE6, 0x34, 0x74, 0xA7, 0x81, 0xCF,
+    0x66, 0x76, 0x2F, 0x89, 0x6A, 0x68, 0x3F, 0x25, 0xC2, 0x61, 0x3C, 0xAB, 0x12, 0x53, 0x40, 0x99,
+    0xD0, 0xE6, 0x4B, 0x4B, 0xFF, 0xF7, 0x57, 0xCE, 0x8A, 0x07, 0x3B, 0x82, 0x3F, 0x0D, 0x2C, 0x2D,
+    0x99, 0xC9, 0xCE, 0xC2, 0xA5, 0xF5, 0xDD, 0x28, 0xB1, 0x6A, 0x9E, 0xF2, 0xB1, 0x84, 0xA7, 0xFB,
+    0x8D, 0x8D, 0x5C, 0xCE, 0x67, 0x41, 0x0A, 0x3D, 0xE3, 0x2E, 0x92, 0x28, 0x39, 0xE3, 0x36, 0x32,
+    0x65, 0x14, 0xC8, 0x48, 0xE4, 0xB6, 0x29, 0xA8, 0x4B, 0xF2, 0x34, 0xFD, 0xDD, 0x24, 0x99, 0x52,
+    0x05, 0x46, 0x63, 0xE7, 0xC3, 0xF6, 0x82, 0x2D, 0x24, 0xB3, 0x09, 0x0D, 0xB7, 0x9A, 0x7D, 0xE7,
+    0x21, 0x99, 0xD1, 0x9F, 0xBB, 0x04, 0x35, 0x45, 0xD5, 0x97, 0x43, 0xA4, 0x21, 0x66, 0x24, 0x6C,
+    0x87, 0x64, 0x3B, 0x85, 0xDE, 0x3C, 0xFB, 0x97, 0x90, 0xF3, 0x87, 0xF9, 0x41, 0x7B, 0xAF, 0x25,
+    0xEE, 0x81, 0x7C, 0x40, 0x49, 0xD8, 0x09, 0x6F, 0x41, 0xC6, 0x1F, 0xCF, 0x82, 0xD0, 0x3C, 0xE7,
+    0x3B, 0x12, 0xEA, 0xA5, 0xF9, 0x29, 0x56, 0xC1, 0xE5, 0x75, 0x48, 0x1E, 0x47, 0xAE, 0x37, 0x38,
+    0xAA, 0x24, 0x54, 0x42, 0x99, 0xA7, 0x4C, 0x12, 0x0E, 0x7A, 0xDA, 0xF4, 0xF7, 0x84, 0xD1, 0x81,
+    0x88, 0x33, 0x6E, 0x16, 0x1C, 0x78, 0xCC, 0xA7, 0xEC, 0x0D, 0x3B, 0x80, 0xE3, 0xBA, 0x1C, 0x8C,
+    0xD7, 0xDE, 0x0E, 0xDA, 0x77, 0xBD, 0x7E, 0xC2, 0xB5, 0x3E, 0x47, 0xA3, 0xB8, 0x08, 0x54, 0x5D,
+    0x4E, 0xF8, 0xD4, 0x63, 0x3A, 0x32, 0x12, 0x0D, 0x94, 0xBE, 0x49, 0x8D, 0x7C, 0xB0, 0xAE, 0x41,
+    0x45, 0x68, 0x69, 0x16, 0xB3, 0x54, 0x86, 0x75, 0xF9, 0x82, 0xD2, 0x5F, 0xEE, 0xB5, 0xD2, 0x98,
+    0xAB, 0x10, 0x53, 0x54, 0xE1, 0xB0, 0x82, 0x17, 0x2A, 0xD2, 0x4E, 0x6F, 0x6E, 0xD5, 0x93, 0x55,
+    0xE7, 0xA3, 0xFE, 0xBA, 0x5F, 0x05, 0xE2, 0x01, 0x8F, 0x5B, 0x35, 0x21, 0x0A, 0xF9, 0x15, 0x97,
+    0xAE, 0x31, 0x75, 0x98, 0xF3, 0x3F, 0x7C, 0xD9, 0x23, 0xC1, 0x44, 0xDD, 0x67, 0x89, 0x42, 0x01,
+    0xA9, 0xA4, 0x48, 0xB4, 0x44, 0xD3, 0xBE, 0x90, 0x17, 0xB2, 0x86, 0x6A, 0x56, 0x50, 0x8D, 0x68,
+    0x72, 0xB6, 0x6F, 0xA0, 0x42, 0x8D, 0xE2, 0xB9, 0x84, 0x0A, 0x7D, 0x0D, 0x87, 0x71, 0x5C, 0x54,
+    0xC5, 0x04, 0x95, 0x01, 0x3E, 0x3C, 0x34, 0x5D, 0x5F, 0x2C, 0x39, 0x00, 0xA3, 0x9D, 0x7E, 0xC1,
+    0xBD, 0x99, 0xD1, 0x7D, 0x3A, 0x49, 0x0F, 0xA1, 0xA9, 0x14, 0x0F, 0xC1, 0x3B, 0x88, 0xC7, 0xEE,
+    0xD6, 0x43, 0x29, 0x56, 0x12, 0xA8, 0x87, 0x4E, 0xFF, 0x38, 0x2A, 0x7F, 0x44, 0xC1, 0xD4, 0xB6,
+    0x8C, 0x9B, 0x61, 0xCE, 0x26, 0x5B, 0xEF, 0x6B, 0x67, 0xDE, 0x07, 0x6C, 0xBE, 0x33, 0xD8, 0x5E,
+    0xFA, 0xAB, 0x3C, 0xA9, 0xE1, 0xF5, 0x71, 0xFE, 0x13, 0xAD, 0x55, 0xB1, 0x72, 0xDD, 0x44, 0x14,
+    0xBD, 0x92, 0x06, 0x5E, 0xA1, 0x62, 0x1B, 0x4C, 0xE3, 0x42, 0x0D, 0x15, 0x8D, 0x7E, 0x20, 0xB0,
+    0x4A, 0x3C, 0xD4, 0x2F, 0xCD, 0xAB, 0xA9, 0xA9, 0x5E, 0x43, 0x01, 0x33, 0x19, 0x56, 0x33, 0xF9,
+    0x00, 0x5E, 0x43, 0xED, 0x12, 0x70, 0x0A, 0xFF, 0x00, 0xCC, 0x0A, 0x5C, 0xB8, 0x70, 0x11, 0xE1,
+    0x64, 0x26, 0x05, 0x45, 0xC4, 0xE0, 0x0C, 0x93, 0x47, 0x11, 0x25, 0xAC, 0x83, 0xFC, 0xB2, 0xDA,
+    0xCB, 0xB9, 0x2B, 0x1B, 0x07, 0x43, 0x32, 0x29, 0xD0, 0xCC, 0x9E, 0x95, 0xB4, 0xDA, 0xBB, 0xF7,
+    0x9C, 0x73, 0x77, 0x65, 0x1A, 0xD2, 0xAD, 0xF9, 0x0F, 0xB0, 0x80, 0xEE, 0x2A, 0xB4, 0x13, 0x98,
+    0xCE, 0x3E, 0x5A, 0xD8, 0xDE, 0x32, 0xF3, 0x04, 0x7C, 0x05, 0x3A, 0xB2, 0x11, 0xBC, 0xC0, 0x18,
+    0x81, 0x88, 0x14, 0x20, 0x63, 0x7F, 0x0E, 0x33, 0x1E, 0x88, 0x72, 0xEE, 0x89, 0xD2, 0x6F, 0x29,
+    0x5E, 0x9A, 0x8A, 0xDA, 0xD3, 0x17, 0x59, 0x9F, 0x78, 0xD5, 0xCC, 0x7A, 0x5D, 0x15, 0xCD, 0x48,
+    0x26, 0x73, 0x78, 0x6C, 0xF1, 0xB8, 0xB6, 0x0D, 0x82, 0x67, 0xCC, 0x5E, 0x61, 0x0D, 0x5D, 0x97,
+    0x6D, 0x20, 0x7B, 0x30, 0xA4, 0x8C, 0x80, 0x88, 0x67, 0x7B, 0xC4, 0xAD, 0x49, 0x0D, 0x12, 0xCA,
+    0xBC, 0x82, 0x56, 0xF7, 0x5A, 0x5A, 0xFD, 0x1B, 0xD2, 0xBA, 0x84, 0x8D, 0xD0, 0x0A, 0xE7, 0xDC,
+    0x48, 0xF9, 0x0B, 0x28, 0x9D, 0xF0, 0xE9, 0x25, 0x13, 0x01, 0xDB, 0x69, 0x52, 0xE0, 0x66, 0x22,
+    0xB7, 0xF6, 0x0D, 0xB8, 0x35, 0xE0, 0xB6, 0x33, 0xA4, 0x08, 0x9D, 0x22, 0x5E, 0x8E, 0x20, 0xBA,
+    0x26, 0xC2, 0x22, 0x33, 0xDC, 0x6E, 0x55, 0xB6, 0x56, 0xCF, 0x03, 0xE9, 0xDF, 0x07, 0xB2, 0xBB,
+    0x5D, 0x1A, 0x4C, 0x95, 0x9F, 0x8E, 0x54, 0xDC, 0x73, 0x64, 0xE6, 0x6D, 0x3A, 0xEA, 0x5A, 0x39,
+    0x7B, 0x9D, 0x7F, 0x42, 0xC8, 0x1B, 0xCC, 0x63, 0xC2, 0x4F, 0x90, 0x8E, 0x6E, 0x91, 0x47, 0x45,
+    0x29, 0x62, 0xE4, 0x78, 0x2C, 0x5B, 0xC8, 0x55, 0xC5, 0xBC, 0x25, 0x4F, 0xB1, 0x46, 0x72, 0xA6,
+    0xF7, 0x92, 0x9D, 0xE6, 0xDA, 0x67, 0xB3, 0xC3, 0xEA, 0xD6, 0xA7, 0xB3, 0xA3, 0xEA, 0xBB, 0x5B,
+    0xC5, 0x21, 0xFB, 0xF2, 0x45, 0xF3, 0xC9, 0x35, 0xD2, 0x0D, 0x64, 0x06, 0xF4, 0x30, 0x0A, 0xB0,
+    0x25, 0xF3, 0x32, 0x26, 0x3D, 0xC0, 0x4A, 0x32, 0x9E, 0x14, 0x70, 0x04, 0x56, 0x86, 0xA9, 0x14,
+    0xAC, 0xB4, 0x60, 0x6D, 0x04, 0x41, 0x0F, 0xD8, 0x02, 0xAD, 0x7D, 0xC6, 0x5C, 0xDB, 0xFD, 0x3F,
+    0x03, 0x70, 0x97, 0x47, 0xE0, 0x5D, 0xF6, 0xC0, 0x23, 0x1E, 0x80, 0x07, 0x7C, 0x8A, 0x8F, 0x0F,
+    0xF8, 0x29, 0xF0, 0x07, 0xFE, 0x05, 0xD8, 0xF0, 0x31, 0x5A, 0x6B, 0x7F, 0x14, 0x34, 0x07, 0x82,
+    0x58, 0xB7, 0x91, 0x64, 0x4B, 0xFF, 0x12, 0x46, 0xE3, 0xA3, 0xF0, 0x93, 0xF2, 0x93, 0xF4, 0xD0,
+    0x5E, 0x70, 0xFA, 0x7E, 0x51, 0x95, 0x4D, 0xE6, 0x94, 0x4B, 0x02, 0x12, 0xE7, 0x9A, 0x1B, 0xDD,
+    0xE9, 0xA1, 0x1C, 0x14, 0x2B, 0xBC, 0x78, 0xC0, 0x75, 0x08, 0x2F, 0x7A, 0x6D, 0x46, 0xAF, 0xEE,
+    0x06, 0x93, 0x3D, 0xE3, 0x65, 0xE3, 0xF5, 0x51, 0xAF, 0xE7, 0x7F, 0x78, 0x75, 0x3C, 0x70, 0xE6,
+    0xDE, 0xD1, 0x88, 0x92, 0x88, 0xDD, 0xA6, 0x22, 0x2A, 0xF0, 0xA0, 0xBA, 0x49, 0xB7, 0xC4, 0x13,
+    0x97, 0x47, 0xCF, 0x47, 0xBB, 0xFC, 0x19, 0xF0, 0xF1, 0x83, 0xD3, 0x60, 0x76, 0x7F, 0x3B, 0x0B,
+    0xE6, 0xCB, 0x5F, 0x07, 0x7C, 0x57, 0xC0, 0x3A, 0xDE, 0x47, 0x7E, 0x30, 0x57, 0x26, 0x83, 0xC0,
+    0x45, 0x5E, 0x57, 0x2F, 0x59, 0x81, 0xB2, 0x10, 0x13, 0x97, 0xF4, 0x21, 0x27, 0xA2, 0xCB, 0x56,
+    0x21, 0xFD, 0x04, 0x63, 0xD9, 0x99, 0x8C, 0xD9, 0x39, 0xC6, 0x54, 0x0F, 0x3B, 0x93, 0x30, 0x1B,
+    0xC4, 0x5B, 0xCC, 0xCB, 0xBC, 0xCC, 0xB3, 0x4D, 0xD1, 0xA3, 0x24, 0xF7, 0xB8, 0x4A, 0x60, 0xFF,
+    0x40, 0x1A, 0xD8, 0xA0, 0xB0, 0x18, 0x05, 0x25, 0x45, 0x8C, 0xF2, 0xCC, 0xF8, 0x3A, 0xE4, 0x28,
+    0x07, 0xED, 0x10, 0x39, 0xEA, 0x12, 0xC8, 0xE3, 0x93, 0x3E, 0x87, 0x31, 0x0A, 0x73, 0xDE, 0x0E,
+    0xD5, 0xDF, 0x09, 0x99, 0x55, 0xCC, 0xDA, 0xB2, 0xCF, 0x5C, 0xD1, 0x17, 0xD8, 0x75, 0x28, 0x82,
+    0x9D, 0x9E, 0x82, 0xAA, 0xB3, 0xE1, 0x03, 0x54, 0xA6, 0xA3, 0xF2, 0xA0, 0x23, 0x56, 0x1B, 0xEB,
+    0x4B, 0xA9, 0x5D, 0x86, 0x49, 0xB0, 0xB9, 0x3C, 0x91, 0x5A, 0x35, 0x92, 0xAC, 0x54, 0xAF, 0x72,
+    0x42, 0x84, 0xE7, 0xEE, 0xE2, 0xF6, 0xA5, 0x2B, 0x8B, 0xFE, 0x69, 0xD1, 0x23, 0xE7, 0x68, 0x96,
+    0x98, 0x58, 0x60, 0x33, 0x43, 0x09, 0x19, 0xD3, 0xBB, 0x9D, 0x14, 0xAD, 0x8C, 0xB1, 0xD4, 0x6E,
+    0xD1, 0x99, 0x9A, 0xB2, 0x51, 0xE6, 0x69, 0x58, 0x48, 0xB9, 0x4F, 0x30, 0xC6, 0xEB, 0x7D, 0x87,
+    0x59, 0xE0, 0x20, 0x74, 0x7D, 0x64, 0xDE, 0xE5, 0xB2, 0x73, 0xC5, 0x7D, 0xED, 0x0A, 0x4F, 0x29,
+    0xDF, 0xC6, 0xDA, 0x85, 0x2F, 0x5B, 0x8B, 0xED, 0x35, 0x66, 0x41, 0x39, 0x35, 0x98, 0xCE, 0x3C,
+    0xE5, 0x7A, 0xF1, 0xD1, 0xE2, 0x7F, 0xE1, 0x8C, 0x22, 0x7B, 0xFF, 0x4E, 0xF4, 0x8B, 0xF1, 0x0A,
+    0xC9, 0xA6, 0x0C, 0xDD, 0x7B, 0x39, 0xF4, 0x98, 0xD7, 0x2B, 0xA1, 0x38, 0x69, 0x5E, 0x9C, 0xF7,
+    0xFA, 0xE1, 0xD4, 0x9B, 0xF9, 0xD4, 0xB3, 0x12, 0xAF, 0x28, 0x0D, 0x79, 0xEC, 0x33, 0x3F, 0xF5,
+    0xF9, 0x30, 0x63, 0x7E, 0x2C, 0xAE, 0x4F, 0xB5, 0xAF, 0x37, 0x77, 0x62, 0x6F, 0x78, 0x8A, 0x23,
+    0x3C, 0xD7, 0x7B, 0x2B, 0x31, 0x5D, 0x6C, 0xCE, 0xA6, 0xDE, 0xE5, 0x23, 0xC9, 0x2B, 0x07, 0xDB,
+    0x63, 0x3D, 0xC8, 0x2E, 0x89, 0xEA, 0xFC, 0xF3, 0x2A, 0x4E, 0x68, 0x7F, 0x05, 0xC5, 0x46, 0x2C,
+    0x05, 0x46, 0xBC, 0xDF, 0xA9, 0xD6, 0xA0, 0x2A, 0x66, 0x10, 0xF0, 0xAD, 0xE5, 0xED, 0x5E, 0xE6,
+    0xF4, 0x51, 0x52, 0xFF, 0xA1, 0x68, 0xC3, 0xF3, 0x2A, 0x0D, 0x5F, 0x51, 0xD6, 0xCA, 0x91, 0x42,
+    0x43, 0xDC, 0x70, 0x7A, 0xCD, 0xBC, 0xDA, 0x8E, 0x82, 0xCB, 0x76, 0x97, 0x19, 0xE2, 0x06, 0xD6,
+    0xB2, 0xAB, 0xC4, 0x9E, 0x90, 0x6A, 0x55, 0xA3, 0x02, 0x37, 0xF9, 0xE4, 0x10, 0x52, 0x3F, 0xF9,
+    0x77, 0xFD, 0x6F, 0x2D, 0xBE, 0xC1, 0xA4, 0x01, 0xCD, 0xA1, 0xF5, 0x65, 0x17, 0x4F, 0xAA, 0xCB,
+    0xB6, 0xD9, 0x93, 0xFC, 0x62, 0xD3, 0xD2, 0xBA, 0xE9, 0x60, 0x8B, 0xED, 0xD1, 0xE2, 0x26, 0xDE,
+    0x39, 0xB4, 0xE1, 0xBC, 0x79, 0x69, 0x79, 0x97, 0xB7, 0xE5, 0x06, 0x87, 0x13, 0x5C, 0xB1, 0xD0,
+    0x6A, 0xE9, 0xE8, 0x15, 0x57, 0x7E, 0x26, 0x22, 0x91, 0xC2, 0xC7, 0x81, 0xBE, 0x9F, 0xB9, 0x45,
+    0x74, 0x17, 0x14, 0xEE, 0x09, 0xE3, 0xC7, 0x37, 0xE3, 0x19, 0x8C, 0x02, 0x4A, 0xF9, 0xFE, 0xF6,
+    0x0E, 0x0E, 0x56, 0x38, 0xE2, 0xD0, 0x9A, 0xD4, 0x9E, 0x33, 0x29, 0xF1, 0x4F, 0xC0, 0x92, 0xDD,
+    0x4C, 0x24, 0x10, 0x67, 0xE4, 0xC6, 0x7D, 0x4E, 0x4B, 0xB1, 0xA8, 0x10, 0xD1, 0x0D, 0x12, 0xCD,
+    0x46, 0xD9, 0x89, 0x0F, 0x45, 0x1A, 0xB9, 0x39, 0x94, 0x1B, 0x44, 0xE6, 0x1B, 0x9E, 0xCA, 0x5E,
+    0x0D, 0xC5, 0x28, 0xA6, 0xCA, 0xF6, 0x6D, 0x29, 0xB1, 0xAB, 0xCB, 0xF4, 0xB6, 0x79, 0x25, 0xBB,
+    0x54, 0x4D, 0x15, 0xD7, 0x75, 0x71, 0xF3, 0x8A, 0xFE, 0xE1, 0x5D, 0x54, 0x1C, 0xA2, 0x1C, 0xCB,
+    0x8A, 0x9B, 0xAF, 0xF1, 0xF7, 0x2C, 0xDA, 0x62, 0x1D, 0x50, 0x62, 0x9D, 0x70, 0x7A, 0xDD, 0xF5,
+    0x17, 0xB5, 0x55, 0x3D, 0x73, 0xDD, 0x44, 0x14, 0xBD, 0x7A, 0x1A, 0xA2, 0x99, 0xA8, 0x58, 0x2A,
+    0x8A, 0x78, 0x06, 0x51, 0xD0, 0xEF, 0x4F, 0xD8, 0x07, 0x19, 0xC6, 0x45, 0x0A, 0x53, 0x90, 0x2A,
+    0xFF, 0x80, 0xC6, 0x2D, 0x14, 0xA0, 0x17, 0x9A, 0x14, 0x2E, 0x70, 0x45, 0x43, 0x4B, 0x86, 0x19,
+    0xD3, 0x52, 0x32, 0xAC, 0xE2, 0x14, 0x2E, 0x5C, 0x58, 0xE0, 0xD2, 0x85, 0x05, 0x4E, 0x45, 0x13,
+    0xF9, 0x21, 0x27, 0x32, 0xEC, 0xEE, 0xE1, 0x5C, 0xC9, 0x24, 0x4C, 0xF8, 0xC8, 0x30, 0x03, 0x3B,
+    0xD2, 0xEE, 0x3E, 0x49, 0xF7, 0xEC, 0x3D, 0xF7, 0xE3, 0x3C, 0x89, 0xA6, 0x15, 0xF3, 0x5D, 0x94,
+    0x2C, 0x55, 0x9D, 0xD8, 0x1F, 0x93, 0xE4, 0x70, 0xBD, 0xFC, 0x79, 0x58, 0x74, 0xE2, 0x80, 0xAE,
+    0x00, 0xD0, 0xD4, 0x9C, 0x74, 0x33, 0x7C, 0x28, 0xDB, 0x68, 0x44, 0xAA, 0xC0, 0x2F, 0xEA, 0x56,
+    0x24, 0x8F, 0x9E, 0x8F, 0x4F, 0x79, 0x07, 0xDD, 0x1C, 0xE8, 0xC6, 0xAD, 0x04, 0x6F, 0x07, 0xB1,
+    0xBD, 0x19, 0xAB, 0x28, 0x34, 0x5D, 0x66, 0x40, 0x2B, 0x99, 0xDF, 0x7D, 0x8E, 0xBE, 0x81, 0xDD,
+    0x1C, 0xE8, 0x0D, 0x6F, 0x3D, 0xA4, 0xCB, 0x14, 0xD5, 0x2F, 0x45, 0xD2, 0x6B, 0x5F, 0x61, 0x24,
+    0xCA, 0xF7, 0xBC, 0xCB, 0x5F, 0xBE, 0x0C, 0xA6, 0xA9, 0x5A, 0xFB, 0x53, 0x9A, 0xDC, 0xD9, 0xB8,
+    0x94, 0x7C, 0x70, 0xCB, 0x8A, 0xDE, 0xFB, 0x9D, 0x71, 0x91, 0x6C, 0x57, 0x8E, 0x7E, 0x45, 0x27,
+    0x7A, 0x37, 0x81, 0xEA, 0x0B, 0x1D, 0xFE, 0xD6, 0xA0, 0x4B, 0x9E, 0x5C, 0xA7, 0xAB, 0x19, 0xB1,
+    0x92, 0x7F, 0x3B, 0xEA, 0xCE, 0x61, 0x41, 0x3B, 0xB4, 0x3E, 0x98, 0x20, 0x19, 0xF6, 0xD1, 0xF9,
+    0x56, 0x16, 0xD8, 0xC4, 0x3D, 0x10, 0x1B, 0x55, 0xD4, 0xB0, 0x15, 0xC9, 0x5D, 0x28, 0xBA, 0x09,
+    0x38, 0xD2, 0x98, 0x98, 0x5F, 0xC1, 0xAF, 0x34, 0x7A, 0x48, 0x0A, 0x43, 0x72, 0x53, 0x70, 0x35,
+    0x0A, 0xBA, 0x32, 0x3C, 0x93, 0x6B, 0x57, 0x8F, 0xAF, 0x5E, 0xE7, 0x1A, 0xDA, 0xF9, 0x2B, 0x5D,
+    0x35, 0xD2, 0x18, 0xC9, 0x03, 0xEE, 0x29, 0xD7, 0x12, 0xE7, 0x38, 0xE6, 0x0A, 0x9E, 0x7D, 0x13,
+    0xC1, 0x60, 0xA8, 0x52, 0xA1, 0x38, 0x45, 0xF7, 0xB1, 0x82, 0x2C, 0x82, 0x6B, 0x26, 0x6C, 0x33,
+    0x63, 0x3E, 0x9C, 0x8E, 0xA8, 0x2E, 0xE6, 0x13, 0x5F, 0x3E, 0xAE, 0x7F, 0x71, 0x7D, 0x6F, 0xB1,
+    0x47, 0x6A, 0x39, 0xEE, 0x92, 0x8B, 0xEB, 0xD1, 0x31, 0x1B, 0x45, 0xB4, 0x83, 0xD7, 0xA4, 0x1C,
+    0x44, 0x4D, 0xB4, 0xB9, 0x9C, 0xCA, 0x24, 0x83, 0x7F, 0xDC, 0xCF, 0xFC, 0x86, 0xD9, 0xF1, 0x71,
+    0xA6, 0x37, 0x9D, 0x69, 0x66, 0xD2, 0xCC, 0xAA, 0x06, 0xBE, 0x22, 0x8B, 0xAB, 0x65, 0x98, 0x2C,
+    0xA0, 0xE8, 0xA8, 0x23, 0x6D, 0x6A, 0x6C, 0xC1, 0xA2, 0xF1, 0x24, 0xB4, 0x8F, 0x58, 0x3D, 0x08,
+    0x65, 0xEF, 0xF3, 0xE8, 0x5A, 0x6C, 0x0D, 0xEE, 0x38, 0xFE, 0x95, 0x97, 0x37, 0xD2, 0xB2, 0x42,
+    0x60, 0x68, 0x9A, 0xF7, 0x4A, 0xC2, 0xF1, 0x20, 0xB7, 0x14, 0xDB, 0x58, 0xB4, 0x25, 0x9A, 0x05,
+    0x68, 0x63, 0x1B, 0xC9, 0xE9, 0x0D, 0xDE, 0x90, 0xFA, 0xE8, 0xBE, 0x3F, 0x83, 0xD6, 0x51, 0x70,
+    0x08, 0x0B, 0x3C, 0x12, 0xFB, 0xC9, 0xC8, 0xB8, 0xF0, 0xAA, 0x0F, 0xF4, 0x9A, 0x21, 0x33, 0xBF,
+    0xCA, 0xD1, 0x67, 0xF2, 0xB5, 0xC8, 0x07, 0x92, 0x0D, 0xE2, 0x3B, 0xF1, 0xBD, 0x64, 0xC4, 0xF8,
+    0x26, 0xFF, 0x2C, 0xE4, 0x18, 0x0B, 0x0C, 0x0B, 0xEC, 0xCE, 0x8C, 0x6E, 0x92, 0x94, 0x66, 0x2F,
+    0x83, 0x5E, 0x8B, 0xE9, 0xCA, 0x48, 0xC8, 0xB3, 0xD2, 0x19, 0xAE, 0x92, 0x98, 0x35, 0xC9, 0xB6,
+    0x6F, 0x96, 0x83, 0xFB, 0x3C, 0x32, 0xB1, 0xB4, 0x59, 0x79, 0x75, 0xED, 0xF7, 0xE2, 0xAB, 0x34,
+    0x81, 0xF8, 0x41, 0x43, 0x96, 0xA5, 0x2B, 0x84, 0x5C, 0x67, 0x82, 0x24, 0xB9, 0xC1, 0x16, 0xC9,
+    0x15, 0x84, 0xAC, 0xDA, 0x8F, 0xAA, 0xC1, 0x23, 0xD4, 0x53, 0xD3, 0x91, 0xB6, 0xC8, 0xAB, 0xB4,
+    0xBF, 0xCD, 0xF3, 0x68, 0x4B, 0xE8, 0x86, 0x71, 0x8F, 0x2F, 0x4B, 0xEB, 0x54, 0x0D, 0x0A, 0xCF,
+    0x8D, 0x1B, 0xB0, 0x2C, 0xC1, 0xB6, 0xC0, 0xE0, 0x89, 0xB7, 0x33, 0x90, 0x9C, 0x5F, 0xD5, 0xB8,
+    0x37, 0x1A, 0x1E, 0x73, 0x37, 0xE1, 0x20, 0xB8, 0x53, 0x0D, 0x0C, 0x37, 0xD8, 0xE2, 0xBE, 0xC7,
+    0x43, 0x24, 0x43, 0x1A, 0x8D, 0x96, 0x9E, 0x6E, 0x96, 0x38, 0x43, 0x5F, 0x25, 0x17, 0x33, 0x6E,
+    0x9A, 0x0A, 0xAF, 0xBC, 0xEF, 0x97, 0x6C, 0x79, 0x7A, 0x12, 0x5E, 0xDF, 0xBB, 0xFF, 0xEE, 0x0B,
+    0x87, 0x7F, 0x2B, 0x66, 0x1D, 0x04, 0x87, 0x7D, 0x01, 0xDB, 0xB8, 0xE0, 0x73, 0xAC, 0x43, 0xC5,
+    0x9F, 0xA8, 0xED, 0xE1, 0x45, 0xF0, 0xF5, 0xC1, 0x1A, 0xA1, 0x3A, 0x61, 0x4B, 0x6D, 0x63, 0x11,
+    0xFD, 0x50, 0x3E, 0xC1, 0xCA, 0x9E, 0x84, 0x49, 0x01, 0xA4, 0xE8, 0x19, 0xC8, 0x7A, 0x73, 0x90,
+    0x92, 0xCE, 0x0A, 0x3E, 0x1D, 0xFF, 0xA9, 0x83, 0x31, 0x33, 0xB5, 0xBD, 0xC6, 0x72, 0x8B, 0x39,
+    0xA4, 0x8D, 0x21, 0xD3, 0x8C, 0x04, 0x97, 0x0E, 0x3B, 0xCC, 0xE1, 0x58, 0xAF, 0xA8, 0x4C, 0x63,
+    0xF5, 0x38, 0xD4, 0x0F, 0x23, 0x09, 0xD6, 0x47, 0xBC, 0x06, 0x70, 0x6F, 0x58, 0x1E, 0x1D, 0x09,
+    0x06, 0x25, 0xB8, 0xE2, 0x66, 0x30, 0xC9, 0x41, 0x09, 0xB6, 0x64, 0x1A, 0x32, 0xF4, 0xEA, 0x8B,
+    0xDD, 0x0F, 0x2A, 0x29, 0x2A, 0x27, 0x7F, 0x70, 0xC4, 0xAE, 0xF2, 0xE0, 0xC5, 0xAD, 0xF9, 0xD5,
+    0x21, 0x75, 0xCC, 0x36, 0x54, 0xC0, 0x82, 0x2C, 0xDD, 0xE9, 0xE1, 0x3A, 0xD6, 0xF6, 0xF4, 0x9C,
+    0x82, 0x58, 0x3C, 0xC1, 0x68, 0x4F, 0x58, 0xE6, 0xDB, 0x91, 0x2C, 0x3B, 0xB2, 0x64, 0x6E, 0xE7,
+    0x5A, 0x78, 0xC0, 0x54, 0xB3, 0xE6, 0xD9, 0x42, 0x53, 0xF7, 0xAA, 0xEB, 0xF2, 0x62, 0xE5, 0x6F,
+    0xA4, 0xA5, 0xB6, 0x56, 0x9A, 0x84, 0xA1, 0x97, 0x3A, 0x6D, 0x83, 0x99, 0x64, 0x99, 0xDA, 0x9E,
+    0x82, 0x63, 0x58, 0x46, 0xD8, 0x24, 0x8C, 0x5B, 0x33, 0x08, 0x45, 0xA0, 0x67, 0x19, 0x54, 0xF1,
+    0xDC, 0x11, 0xB1, 0xCC, 0xD3, 0xA4, 0xEA, 0x3C, 0x3F, 0x64, 0x25, 0xF8, 0x43, 0x85, 0x59, 0xE3,
+    0xF2, 0x9D, 0xA9, 0xAE, 0x98, 0x5C, 0xED, 0xC7, 0xB7, 0x74, 0x6A, 0xB4, 0x35, 0x9B, 0x4C, 0x27,
+    0xB9, 0x86, 0x74, 0xA5, 0x1A, 0xEA, 0xA1, 0x32, 0x77, 0xC7, 0x61, 0x72, 0xEC, 0x6F, 0xDA, 0x92,
+    0x2C, 0xA2, 0x2A, 0x15, 0xEB, 0x1C, 0x7D, 0x1E, 0xCB, 0xB1, 0x1C, 0xF2, 0x60, 0xFA, 0x2C, 0x9A,
+    0x4E, 0xD2, 0xB3, 0x5B, 0x7F, 0x8F, 0x45, 0x2C, 0x59, 0x2C, 0x2A, 0x19, 0xFA, 0xAD, 0xDA, 0xC8,
+    0x06, 0x6D, 0xAF, 0xB1, 0xC3, 0x32, 0x7D, 0xC0, 0xFE, 0x18, 0xD4, 0x0B, 0x46, 0x53, 0xD0, 0xD5,
+    0xBD, 0x50, 0x1A, 0xF8, 0xD7, 0xB1, 0x15, 0x54, 0x65, 0xF5, 0x8F, 0x45, 0x9D, 0xFD, 0x59, 0xA7,
+    0xA3, 0x48, 0x8D, 0x74, 0x6C, 0x85, 0xD1, 0xA7, 0x3B, 0x68, 0xF5, 0x91, 0x4A, 0xE8, 0xA8, 0x53,
+    0x53, 0x68, 0x6F, 0xA8, 0x4E, 0xB0, 0xBF, 0x1F, 0x31, 0x4F, 0xAC, 0x23, 0xB6, 0x2D, 0xDB, 0x49,
+    0xBD, 0xB3, 0xAD, 0x61, 0xA5, 0x54, 0xC7, 0xE3, 0x6D, 0xBF, 0xC5, 0x20, 0x38, 0x15, 0x09, 0xA9,
+    0xCE, 0x52, 0x86, 0x5B, 0x50, 0x69, 0x45, 0xC7, 0x60, 0xB0, 0xA1, 0xFB, 0xC9, 0x35, 0xAA, 0xC6,
+    0x2C, 0xAB, 0x53, 0x92, 0xAA, 0x73, 0xC6, 0xF9, 0x99, 0x78, 0x3C, 0x1F, 0xFF, 0x33, 0x81, 0xFF,
+    0x76, 0xFC, 0x06, 0x95, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0x3D, 0xFE, 0xAC, 0x8D, 0x0B, 0x4B,
+    0x4C, 0xF5, 0x49, 0x28, 0x08, 0xDC, 0x03, 0xC2, 0x4F, 0xB0, 0x8C, 0x81, 0x02, 0x24, 0x8A, 0xA4,
+    0xC8, 0xE6, 0x21, 0x68, 0xF6, 0x0D, 0xB0, 0x51, 0x8A, 0x14, 0x14, 0x9B, 0x82, 0x9E, 0xED, 0x79,
+    0x03, 0xA4, 0xAC, 0xCD, 0x7E, 0x45, 0x8A, 0x14, 0x58, 0xBB, 0x05, 0x94, 0x0E, 0x49, 0x81, 0x44,
+    0xC1, 0x44, 0x19, 0xD0, 0x20, 0xC6, 0xBE, 0x9C, 0x3B, 0xFE, 0x02, 0x8B, 0x84, 0x16, 0xB0, 0xFC,
+    0x3B, 0x3F, 0xF7, 0xE7, 0x9C, 0x73, 0xAF, 0xF3, 0x60, 0x3B, 0x33, 0x2D, 0x68, 0x1F, 0xC5, 0x4C,
+    0x2A, 0x57, 0xC6, 0x7E, 0xC0, 0xFE, 0x28, 0x67, 0x6C, 0x44, 0x50, 0xF3, 0x92, 0xF7, 0x97, 0xD2,
+    0xE7, 0xD1, 0x0E, 0x85, 0x5F, 0xB6, 0xC7, 0x97, 0x22, 0x72, 0x22, 0xB2, 0xF0, 0x33, 0x48, 0xD7,
+    0x5E, 0xF0, 0x33, 0x17, 0x09, 0xA5, 0xC8, 0x50, 0x4A, 0xC4, 0x0D, 0x69, 0x00, 0x7B, 0x2F, 0x00,
+    0x8B, 0x99, 0x50, 0xC4, 0x76, 0x40, 0xF5, 0x5C, 0x80, 0xFE, 0x71, 0xC4, 0xB5, 0xC7, 0x46, 0x26,
+    0xAE, 0x92, 0x00, 0x43, 0x6B, 0x90, 0xB1, 0xF6, 0x45, 0x44, 0xE5, 0xEC, 0x80, 0x9A, 0x11, 0xC2,
+    0x6A, 0x64, 0xA2, 0x93, 0x33, 0xAC, 0x88, 0x07, 0xFD, 0x8E, 0x3A, 0x44, 0x77, 0xF9, 0xDC, 0x7B,
+    0xF4, 0xCF, 0x39, 0x22, 0x3B, 0x5E, 0x0B, 0x17, 0x89, 0xD7, 0x5B, 0x57, 0xA9, 0xAD, 0x1B, 0xF2,
+    0xDB, 0xEA, 0xA2, 0x3E, 0x0F, 0x9A, 0x86, 0xDD, 0x45, 0x7D, 0x30, 0xE9, 0xE4, 0xF7, 0xEB, 0x86,
+    0xF1, 0x37, 0x87, 0xD9, 0x9C, 0x21, 0x77, 0x5C, 0xD4, 0x21, 0x23, 0x1A, 0x32, 0x54, 0xCC, 0x06,
+    0xF5, 0x37, 0xC8, 0xC3, 0x61, 0xA6, 0x29, 0x8E, 0x96, 0x5E, 0x8F, 0x7F, 0x5C, 0x4D, 0xBD, 0x25,
+    0x8B, 0x62, 0x33, 0xD0, 0x8B, 0xCF, 0x8E, 0x9A, 0x6B, 0xF2, 0x12, 0x6C, 0x62, 0x35, 0x41, 0xF2,
+    0x08, 0xDB, 0xB5, 0x43, 0x3D, 0x1A, 0x6F, 0x1C, 0x0D, 0x06, 0xD8, 0x27, 0x33, 0xCA, 0x48, 0x6C,
+    0x18, 0x28, 0x8D, 0x8D, 0xC8, 0x85, 0xFE, 0x7B, 0x42, 0x67, 0x66, 0xC5, 0x83, 0x9B, 0xDB, 0x8E,
+    0x99, 0x33, 0x4D, 0xEB, 0x98, 0x79, 0xE0, 0x02, 0x86, 0x44, 0x00, 0x60, 0xB9, 0xE8, 0x20, 0x79,
+    0xCD, 0xEE, 0x9E, 0x12, 0xB5, 0x45, 0x31, 0x19, 0x6A, 0x59, 0x4E, 0xF1, 0xAF, 0x07, 0x91, 0xEC,
+    0x0B, 0x7A, 0x1F, 0x04, 0xD5, 0x48, 0xD2, 0x5D, 0x3E, 0x33, 0xB6, 0x76, 0x58, 0x60, 0x42, 0x8F,
+    0x4C, 0x38, 0x6F, 0xC9, 0x45, 0xA1, 0xC1, 0xA8, 0xBF, 0x8A, 0xE8, 0xE7, 0x1A, 0x8C, 0x8A, 0x83,
+    0x99, 0xC0, 0x78, 0x1C, 0x1C, 0x47, 0x8E, 0xCD, 0x1A, 0x3A, 0x0D, 0xF2, 0x32, 0x09, 0x62, 0x5B,
+    0x38, 0x54, 0xE7, 0x11, 0xA5, 0xEF, 0x9B, 0x7C, 0x66, 0xE0, 0x72, 0x12, 0xFE, 0x31, 0x06, 0x3A,
+    0x2C, 0x5D, 0xDB, 0xE5, 0x91, 0xB6, 0x96, 0x4C, 0xD0, 0x33, 0x4B, 0x0A, 0x2A, 0x52, 0x32, 0x72,
+    0xDF, 0xA3, 0x7A, 0xA1, 0xE6, 0xE9, 0xB7, 0x25, 0xBD, 0x46, 0x86, 0x55, 0x1C, 0xD6, 0x53, 0x96,
+    0x0C, 0x28, 0x5B, 0xF6, 0xBC, 0xCB, 0x1A, 0xA9, 0x61, 0xA4, 0x39, 0xB9, 0x81, 0x2E, 0xDA, 0xAA,
+    0xF9, 0xBE, 0x74, 0xA8, 0x77, 0x11, 0xC6, 0x09, 0xD6, 0x38, 0x6E, 0xF9, 0xFF, 0xC4, 0x50, 0xDB,
+    0x90, 0xA1, 0xE1, 0x2F, 0x86, 0x7E, 0x88, 0x94, 0xF0, 0x9E, 0xA1, 0x8A, 0xEE, 0x12, 0x43, 0xAD,
+    0x32, 0x14, 0xFF, 0xCE, 0xD0, 0xB6, 0x57, 0x86, 0xFC, 0x9E, 0x21, 0x5E, 0xF6, 0x19, 0x27, 0x0F,
+    0x6E, 0x63, 0xDB, 0x6C, 0xC8, 0x32, 0xE5, 0x4A, 0x40, 0xD0, 0x8E, 0x99, 0x34, 0xB5, 0x43, 0x3F,
+    0x5E, 0x47, 0xD0, 0x9B, 0x1D, 0x3E, 0x01, 0x77, 0x19, 0xA7, 0x27, 0x93, 0xED, 0xBB, 0x8A, 0xE2,
+    0x50, 0x96, 0x50, 0x3B, 0x4B, 0x87, 0xF2, 0x61, 0x82, 0xA2, 0x57, 0xC8, 0x7F, 0x9E, 0x34, 0x12,
+    0x52, 0x91, 0x80, 0x5A, 0xF5, 0xC3, 0x30, 0x54, 0x1C, 0xF4, 0x44, 0xB4, 0x24, 0x31, 0xA3, 0x1E,
+    0x15, 0xBC, 0x94, 0x4A, 0x82, 0x6C, 0x55, 0x12, 0x8C, 0xA2, 0x89, 0x3B, 0x6B, 0x81, 0x8C, 0xCC,
+    0x87, 0x94, 0xD4, 0x53, 0x41, 0xF7, 0x7E, 0x23, 0x0D, 0x9F, 0x47, 0x2F, 0x67, 0xAF, 0x3D, 0x12,
+    0xA3, 0x2A, 0x0F, 0x45, 0x8B, 0xC2, 0x22, 0x6E, 0x1B, 0x85, 0x81, 0xB4, 0x22, 0x61, 0x99, 0xD4,
+    0x45, 0xBC, 0xBE, 0x75, 0x58, 0xB9, 0x4D, 0x80, 0xAE, 0x60, 0x51, 0x6C, 0x1D, 0x92, 0xCA, 0xF7,
+    0xA8, 0x26, 0x9D, 0x31, 0x65, 0xDE, 0xEE, 0xEA, 0x2A, 0x85, 0x76, 0x15, 0xDB, 0x3E, 0x4B, 0x79,
+    0xA0, 0xBB, 0x5C, 0xAB, 0x54, 0xAB, 0xDA, 0x48, 0xB0, 0x09, 0xC9, 0xC8, 0x01, 0x0E, 0xDE, 0xF3,
+    0x78, 0x58, 0x37, 0xE5, 0x85, 0xC3, 0x5C, 0xC3, 0x5C, 0x12, 0xC3, 0x77, 0x61, 0x9E, 0x4E, 0x58,
+    0x2C, 0xEA, 0xA7, 0xA1, 0x58, 0x58, 0x2B, 0x4F, 0xD8, 0x26, 0x4A, 0xF9, 0x7D, 0x7A, 0x2D, 0x7C,
+    0xAA, 0x76, 0x18, 0x17, 0x34, 0x7E, 0x0A, 0x91, 0x0F, 0xFB, 0x81, 0x67, 0x07, 0x6B, 0xEF, 0x07,
+    0x36, 0xAD, 0xB5, 0x6F, 0xBD, 0x82, 0xD3, 0x37, 0x32, 0xF7, 0x7A, 0x3A, 0xDF, 0xE6, 0xB9, 0x71,
+    0xEF, 0x14, 0xAE, 0x12, 0x67, 0x16, 0x97, 0x7D, 0xC1, 0x6D, 0xFB, 0xB3, 0x15, 0xD1, 0x2E, 0xF4,
+    0x88, 0x57, 0xF5, 0xCB, 0xD1, 0x1D, 0x6A, 0x43, 0xB5, 0x5A, 0x68, 0x11, 0xA9, 0x8B, 0x21, 0x25,
+    0x57, 0xC6, 0x95, 0x99, 0xFE, 0xCA, 0x27, 0xB3, 0xA3, 0x26, 0x54, 0xE5, 0x25, 0x93, 0xB8, 0x79,
+    0x46, 0xDA, 0x88, 0x58, 0x41, 0x10, 0x6E, 0x92, 0xC8, 0xED, 0xD1, 0x6D, 0x11, 0xF6, 0xDD, 0x5B,
+    0xD4, 0x3B, 0x10, 0xB5, 0x4D, 0x99, 0x97, 0xAF, 0x1E, 0x66, 0xD4, 0x92, 0x26, 0xE1, 0x87, 0x00,
+    0xED, 0x54, 0x9F, 0xA9, 0x00, 0x4A, 0xD7, 0x27, 0x52, 0xD6, 0xB6, 0x99, 0xD4, 0xDF, 0x7E, 0x37,
+    0xE3, 0x7F, 0x1C, 0x26, 0x55, 0x4C, 0xBE, 0xEE, 0x91, 0x8F, 0xD5, 0x8E, 0xBD, 0x70, 0x69, 0xE2,
+    0x61, 0x9A, 0xA8, 0x9B, 0x34, 0x31, 0xA6, 0x09, 0x7F, 0x75, 0x42, 0x9E, 0xE9, 0x84, 0x68, 0x79,
+    0x5E, 0x68, 0x03, 0x36, 0xFE, 0x8C, 0x2A, 0xCC, 0x97, 0x5A, 0x75, 0x2C, 0x9F, 0x4F, 0xA9, 0xB2,
+    0x82, 0x2A, 0x3C, 0xF6, 0x5F, 0xB1, 0x30, 0x44, 0x3B, 0x29, 0xE4, 0x71, 0xDA, 0xF1, 0x42, 0x96,
+    0x06, 0x55, 0xC4, 0x59, 0x39, 0x6A, 0xFC, 0x5D, 0x2A, 0x62, 0xFD, 0x43, 0x41, 0x7F, 0x51, 0xD7,
+    0x36, 0x36, 0xBD, 0xC5, 0x57, 0x19, 0x82, 0xE3, 0x3A, 0xB3, 0x63, 0xC8, 0xD6, 0xE8, 0xD0, 0xA1,
+    0x0E, 0x79, 0x1D, 0xA2, 0x8C, 0xAC, 0x6A, 0x69, 0x3E, 0x2C, 0x5C, 0xEE, 0x7D, 0x39, 0x98, 0xCB,
+    0xD1, 0xC2, 0x9E, 0xFC, 0x14, 0x29, 0x0E, 0x19, 0xF3, 0xC0, 0x5F, 0x85, 0x99, 0x6A, 0xFD, 0x71,
+    0xC1, 0x4E, 0x5A, 0x35, 0xED, 0x98, 0x2F, 0xDA, 0x69, 0x94, 0x31, 0x39, 0x27, 0xCA, 0x1B, 0xF9,
+    0x32, 0xA8, 0x82, 0x55, 0x86, 0x45, 0xAA, 0xA0, 0x52, 0xFB, 0x0E, 0x75, 0x99, 0x62, 0x88, 0xA9,
+    0xE4, 0x02, 0xFE, 0xAC, 0x31, 0xBD, 0x17, 0xE9, 0x5F, 0x65, 0x7F, 0x4D, 0x1D, 0x64, 0xA7, 0xDD,
+    0x7E, 0x2E, 0xE4, 0x23, 0xF6, 0x2B, 0x23, 0x91, 0xFB, 0x2A, 0x09, 0xAC, 0x5A, 0x9B, 0xD6, 0xB7,
+    0x49, 0xC4, 0xF5, 0x83, 0x35, 0xA5, 0xAA, 0xCB, 0xA7, 0x8D, 0x27, 0xDF, 0x76, 0x13, 0xC8, 0x29,
+    0x8D, 0xCF, 0xB3, 0x16, 0xCE, 0xBE, 0x23, 0x6B, 0xF3, 0xD1, 0xC0, 0x74, 0xC0, 0xD0, 0x85, 0x61,
+    0xDF, 0x2C, 0x42, 0xFB, 0x7D, 0x1E, 0x4B, 0xB9, 0x37, 0x43, 0x0D, 0xA6, 0x42, 0x52, 0xB3, 0xAA,
+    0xCA, 0xC8, 0xC7, 0x70, 0xE5, 0xF5, 0x0F, 0xCD, 0x55, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x1E, 0x7B,
+    0x75, 0x67, 0x84, 0x25, 0x96, 0x26, 0x12, 0x4A, 0xC1, 0x86, 0xF6, 0x14, 0x65, 0xFF, 0x81, 0xC0,
+    0x3A, 0xB9, 0x22, 0x45, 0x22, 0x71, 0xC5, 0xA5, 0xA2, 0x20, 0x75, 0x2A, 0x2A, 0xAA, 0x23, 0x76,
+    0x5E, 0xFE, 0x81, 0x2B, 0xE8, 0x79, 0x6D, 0x1E, 0x74, 0x50, 0x50, 0xE4, 0x61, 0xDF, 0x21, 0x41,
+    0x19, 0x27, 0x29, 0x28, 0x28, 0x6E, 0x05, 0x0D, 0x28, 0x05, 0x0B, 0xB7, 0x51, 0x16, 0xB1, 0xF6,
+    0x30, 0x63, 0xFB, 0xDD, 0xBB, 0x8B, 0x02, 0xA4, 0x64, 0xAD, 0x99, 0x7D, 0xB3, 0xBF, 0x66, 0x77,
+    0xE6, 0x9B, 0xEF, 0xD5, 0x88, 0xD8, 0xD5, 0x27, 0x0A, 0xA8, 0x65, 0xF4, 0xA3, 0x67, 0xEB, 0x47,
+    0x1E, 0xB9, 0xBD, 0x58, 0x2C, 0x2A, 0x80, 0xD5, 0x04, 0xB5, 0x7A, 0xD0, 0x7F, 0x0D, 0xBA, 0xE7,
+    0xE9, 0xC5, 0x62, 0xFF, 0x3F, 0x17, 0xA8, 0xC6, 0x64, 0x56, 0x1E, 0x04, 0xE1, 0xEE, 0x40, 0x54,
+    0x15, 0x1B, 0x87, 0x21, 0x73, 0xDF, 0x24, 0x51, 0x57, 0x77, 0xF2, 0x56, 0xCD, 0x7C, 0x66, 0x97,
+    0x49, 0xD0, 0x05, 0x1B, 0xF7, 0x7C, 0x6E, 0xBB, 0x34, 0x98, 0x62, 0x29, 0x1B, 0xBD, 0xED, 0xF2,
+    0x36, 0xA6, 0xDE, 0x00, 0x1B, 0x57, 0xE7, 0x9B, 0x95, 0xE1, 0x73, 0x1F, 0xB2, 0x3A, 0x66, 0x15,
+    0xE1, 0xA4, 0xC9, 0xF5, 0xE0, 0xE0, 0xBC, 0x0C, 0xB2, 0x17, 0x58, 0xD5, 0x56, 0x46, 0x81, 0x50,
+    0x5B, 0x15, 0xD3, 0x05, 0x2D, 0x12, 0xD8, 0xA0, 0xD5, 0x5E, 0xC6, 0x8C, 0x66, 0x0B, 0x6C, 0xB6,
+    0xF6, 0x41, 0xF5, 0xAA, 0x93, 0x51, 0x46, 0x15, 0x8C, 0x33, 0xAE, 0xB6, 0xB7, 0xAB, 0x97, 0xEE,
+    0x2D, 0x83, 0x89, 0xB2, 0xE7, 0x13, 0x66, 0x3C, 0x55, 0x5A, 0xDE, 0x23, 0x30, 0xC5, 0x82, 0x0D,
+    0x45, 0x46, 0xBA, 0x48, 0xD8, 0x45, 0x8E, 0xDB, 0x78, 0xC8, 0x6E, 0x6A, 0x72, 0xC4, 0xAE, 0x46,
+    0x67, 0x02, 0xAF, 0x62, 0x45, 0xC3, 0xED, 0xD6, 0xFE, 0xD6, 0xFC, 0xA5, 0x4E, 0x5F, 0xE9, 0x7C,
+    0x48, 0xE7, 0x14, 0x6C, 0xF7, 0xEF, 0x92, 0x3F, 0x9B, 0xE7, 0x88, 0x9E, 0x62, 0x12, 0x34, 0x05,
+    0xE4, 0xDC, 0x07, 0x3C, 0xF6, 0x82, 0x48, 0x16, 0xFB, 0x6A, 0x92, 0x91, 0x08, 0x12, 0x60, 0xE1,
+    0x84, 0xBF, 0xB9, 0x0E, 0xBC, 0x26, 0x84, 0xF4, 0x34, 0x1D, 0xC6, 0xA5, 0xE6, 0x05, 0xB3, 0x80,
+    0x9B, 0xD8, 0x13, 0x38, 0x22, 0x5D, 0xC4, 0x23, 0xFE, 0xBA, 0x03, 0x04, 0x34, 0xE1, 0x69, 0xB6,
+    0x1D, 0x66, 0x57, 0xA6, 0xC2, 0x96, 0x92, 0x3B, 0xA3, 0xCC, 0x49, 0xFC, 0x73, 0x17, 0x54, 0x03,
+    0x50, 0x02, 0x24, 0x71, 0x7C, 0xD0, 0x64, 0xC2, 0x03, 0x12, 0x32, 0x13, 0x32, 0xC5, 0xE4, 0x9F,
+    0x10, 0xD7, 0x02, 0x4E, 0xCA, 0x26, 0x2B, 0xE5, 0x52, 0x56, 0xE2, 0x8C, 0xF2, 0x0C, 0xD2, 0x90,
+    0xB3, 0x62, 0xB8, 0xC4, 0xB5, 0x52, 0x2B, 0xD5, 0x69, 0x56, 0x0C, 0xB3, 0x7E, 0x50, 0x7C, 0x4F,
+    0xD1, 0x03, 0x06, 0x43, 0xF7, 0xDA, 0xEE, 0xE0, 0x6B, 0x76, 0xB9, 0x51, 0x94, 0x33, 0x94, 0xD1,
+    0x38, 0x6C, 0xCE, 0xFC, 0xDC, 0xD8, 0x49, 0x76, 0x74, 0x2B, 0x5D, 0xEE, 0x8D, 0x95, 0x5E, 0x86,
+    0x49, 0x3B, 0x15, 0x64, 0x2C, 0x9D, 0x0E, 0x2A, 0x2E, 0x97, 0x4B, 0xDE, 0xCF, 0x87, 0x44, 0xF8,
+    0x04, 0x72, 0x2B, 0x6E, 0x80, 0x81, 0xB7, 0xBF, 0xA2, 0x08, 0x7C, 0x6C, 0x55, 0x93, 0x3C, 0x29,
+    0x3A, 0x10, 0x91, 0xD2, 0x93, 0x59, 0x7E, 0x2E, 0x47, 0x11, 0x34, 0x3D, 0x96, 0xA3, 0x34, 0x64,
+    0x0C, 0x4A, 0x0A, 0x99, 0x60, 0xDC, 0xEB, 0x83, 0xEA, 0x16, 0xF4, 0x6F, 0x7D, 0x77, 0x4B, 0xBA,
+    0xCF, 0xB7, 0x9A, 0x72, 0xF6, 0xC5, 0x53, 0xDA, 0xF8, 0x47, 0x24, 0xFF, 0xDB, 0x2D, 0x8E, 0x15,
+    0xC1, 0x60, 0x6F, 0x8D, 0x3B, 0x0D, 0xF6, 0x35, 0x3C, 0xDB, 0xDA, 0x1A, 0xF7, 0x4F, 0xF0, 0x1C,
+    0x5A, 0xE2, 0x65, 0xF3, 0x40, 0x44, 0xD5, 0xF6, 0x99, 0x37, 0x87, 0x51, 0xDA, 0x32, 0xF3, 0xBA,
+    0xE9, 0xA4, 0xBD, 0x04, 0x5E, 0x4E, 0xBC, 0x00, 0x21, 0x77, 0x92, 0x6E, 0xAE, 0x1B, 0x3D, 0x98,
+    0x97, 0xF2, 0xA6, 0xFC, 0xD0, 0x9A, 0x87, 0x4E, 0x3D, 0x09, 0xD9, 0xEF, 0x31, 0x75, 0x7B, 0x2B,
+    0x9C, 0xA8, 0xC4, 0xE7, 0x8D, 0xF9, 0x36, 0x2A, 0xAB, 0x1F, 0xF5, 0xD2, 0x49, 0x57, 0x8B, 0x20,
+    0xBC, 0xBE, 0x1B, 0xC1, 0xE7, 0xD5, 0xB4, 0x4A, 0x16, 0xC3, 0xDB, 0xD0, 0x81, 0xC1, 0x56, 0x79,
+    0x9C, 0xDD, 0xDF, 0xBC, 0xCF, 0xDC, 0x02, 0x1A, 0x6A, 0xD1, 0x49, 0x67, 0xAA, 0xB2, 0xE1, 0xF7,
+    0x50, 0x46, 0x3A, 0xB8, 0x08, 0xAF, 0x01, 0xCC, 0x61, 0x8F, 0x80, 0xA1, 0xDB, 0x3C, 0x24, 0x5D,
+    0x82, 0x59, 0xA7, 0xBD, 0x69, 0x4D, 0x71, 0x71, 0x04, 0x68, 0x3D, 0x9E, 0x8A, 0xC5, 0xD8, 0x55,
+    0x27, 0x5D, 0x86, 0x57, 0xE8, 0xA9, 0x4D, 0x82, 0xED, 0xCD, 0x6B, 0x34, 0x5B, 0x7B, 0xAA, 0x47,
+    0x42, 0x63, 0x07, 0x65, 0xE4, 0xB8, 0x5D, 0xA1, 0x0B, 0x80, 0xC0, 0x1F, 0x08, 0x53, 0xC0, 0x58,
+    0x2A, 0x28, 0xF4, 0x35, 0xA1, 0xD8, 0x2B, 0xA7, 0x31, 0xE6, 0x41, 0x39, 0x89, 0x4E, 0x06, 0x4D,
+    0x5D, 0x4B, 0xB9, 0xF7, 0x9A, 0xAC, 0x78, 0x6E, 0xA7, 0xC6, 0xB8, 0xB1, 0x3B, 0x6C, 0x98, 0xF8,
+    0xB0, 0xE2, 0xC3, 0x8E, 0x90, 0xCB, 0x00, 0xEF, 0x21, 0xE5, 0x12, 0x31, 0x21, 0x9E, 0x4D, 0x89,
+    0xB7, 0x6A, 0x2C, 0x72, 0xF4, 0x34, 0xDE, 0x10, 0xF0, 0x69, 0x95, 0x3B, 0xA9, 0xA7, 0x64, 0x77,
+    0xE8, 0xC4, 0xC8, 0x6D, 0xD9, 0xD8, 0xE5, 0x53, 0xD7, 0x8D, 0x61, 0x1A, 0xBB, 0xA4, 0x48, 0xDB,
+    0xD4, 0xA7, 0x81, 0xE3, 0x38, 0x7E, 0xD9, 0xF0, 0xE5, 0xC3, 0x27, 0x7D, 0xEA, 0xE0, 0xA3, 0xD3,
+    0x95, 0x2A, 0x83, 0x22, 0x08, 0xEA, 0x68, 0xA2, 0xE9, 0xCC, 0x78, 0x44, 0xCA, 0x9E, 0x28, 0x3C,
+    0x59, 0x73, 0x8A, 0x3C, 0x1C, 0xF0, 0x2D, 0xA9, 0x4C, 0x98, 0x6E, 0xAD, 0x39, 0x42, 0xFF, 0x86,
+    0x3C, 0x0E, 0x20, 0x8F, 0x23, 0xC8, 0x9F, 0x4E, 0xC9, 0xCF, 0x11, 0xD4, 0xD3, 0x40, 0x95, 0xEB,
+    0xB8, 0x7A, 0x49, 0x2A, 0x50, 0x74, 0xAC, 0xF2, 0x6B, 0xD1, 0x2C, 0xC5, 0x19, 0xBE, 0x18, 0x49,
+    0x83, 0x63, 0xE2, 0xD6, 0x52, 0xFA, 0x51, 0x6A, 0x0E, 0x12, 0x4B, 0x84, 0x12, 0xF1, 0x7B, 0x2A,
+    0x4A, 0xEA, 0x9A, 0xF3, 0x9F, 0x9E, 0xBF, 0xEE, 0xE4, 0x01, 0x55, 0x31, 0x45, 0x3A, 0xA9, 0x29,
+    0x2B, 0x29, 0xE7, 0xF2, 0xF2, 0x05, 0x80, 0xE7, 0x47, 0x4C, 0x1D, 0x76, 0xF4, 0x96, 0x51, 0x44,
+    0x01, 0x7F, 0x2B, 0x60, 0xF3, 0xF2, 0x3B, 0x00, 0x5F, 0x3E, 0x72, 0x77, 0x95, 0xFA, 0x6C, 0xEF,
+    0x3D, 0xFA, 0x37, 0xBA, 0x86, 0xCF, 0xEA, 0x36, 0xEB, 0x14, 0x3E, 0xA6, 0xB4, 0xEC, 0xBD, 0xFB,
+    0xFC, 0x17, 0x07, 0xEF, 0xC3, 0xEB, 0x23, 0x97, 0x4D, 0x05, 0x29, 0x29, 0x04, 0x39, 0xF3, 0x9C,
+    0x1B, 0xEB, 0x8E, 0xA9, 0x67, 0x28, 0x3B, 0x46, 0x11, 0x13, 0x15, 0x33, 0x1B, 0xF3, 0x10, 0xD3,
+    0x1A, 0x13, 0x68, 0xE6, 0xC7, 0x2C, 0xA5, 0xBC, 0xA8, 0x67, 0x64, 0x71, 0x79, 0xD2, 0x22, 0x43,
+    0x8B, 0x74, 0x3B, 0xD5, 0xEB, 0xFF, 0xB8, 0xFD, 0x0D, 0x75, 0x55, 0xBF, 0xAF, 0xD7, 0x54, 0x14,
+    0x3F, 0x6D, 0x85, 0xAA, 0x8D, 0xD4, 0xC5, 0x45, 0xE4, 0x75, 0xD6, 0x80, 0x5D, 0x1C, 0x18, 0xDE,
+    0xE3, 0x96, 0x30, 0x32, 0x48, 0x8C, 0x2F, 0x31, 0x3A, 0xC8, 0x28, 0x8B, 0xAC, 0x24, 0x3E, 0xD2,
+    0xCA, 0xEA, 0xE0, 0x8B, 0x7F, 0x80, 0x32, 0xB0, 0xF8, 0x18, 0x9E, 0x03, 0x03, 0x26, 0x5F, 0xB8,
+    0x05, 0x06, 0x62, 0x48, 0xA4, 0xD1, 0xA8, 0x83, 0x79, 0xA1, 0x20, 0x26, 0x2E, 0xE6, 0xDD, 0x48,
+    0x85, 0xF2, 0xD2, 0xF6, 0xF8, 0xF9, 0xDC, 0x3E, 0x91, 0x41, 0x9A, 0xF4, 0xC7, 0xE9, 0xBD, 0xE7,
+    0xD7, 0xE7, 0x9C, 0xF3, 0xB9, 0x22, 0xBB, 0x97, 0x6D, 0x24, 0xD0, 0x4A, 0x72, 0xED, 0xA4, 0xD4,
+    0x36, 0x56, 0xED, 0x12, 0x55, 0x67, 0x1E, 0x7F, 0xE8, 0xEC, 0xEF, 0x65, 0xBB, 0x22, 0x59, 0xDB,
+    0x8B, 0xA9, 0x4F, 0xE0, 0xAE, 0xA4, 0x2C, 0xB0, 0x1F, 0x3A, 0x93, 0x48, 0x30, 0x88, 0x44, 0xBD,
+    0x48, 0xDC, 0x89, 0xA4, 0xAD, 0x48, 0x5E, 0x8B, 0x18, 0x2C, 0xAB, 0x48, 0x38, 0xE2, 0x17, 0x7E,
+    0xE7, 0x4E, 0x42, 0xAD, 0x25, 0xD6, 0x42, 0xEC, 0x00, 0x27, 0xBD, 0x44, 0x10, 0x13, 0x88, 0x69,
+    0xEF, 0x57, 0xC5, 0x40, 0xD1, 0x42, 0x11, 0xFE, 0x23, 0x28, 0xC6, 0xB0, 0x9B, 0xC2, 0x6E, 0xD6,
+    0x60, 0xA9, 0x12, 0x39, 0x09, 0x57, 0xEB, 0xF2, 0xCC, 0xEB, 0x15, 0xDC, 0xAB, 0x88, 0x04, 0x5A,
+    0x11, 0xB4, 0x12, 0x18, 0x4D, 0x69, 0x14, 0x77, 0x09, 0x0B, 0xF0, 0x15, 0xC2, 0x17, 0x0D, 0xA7,
+    0xD3, 0x13, 0xA5, 0xBD, 0x13, 0x82, 0xAC, 0x90, 0xA6, 0xC8, 0xBE, 0x50, 0x15, 0x71, 0xF5, 0xE6,
+    0xEF, 0xD3, 0x4E, 0xB2, 0x6B, 0x9D, 0xD8, 0x22, 0x18, 0x9E, 0xA7, 0x2D, 0x9F, 0x4C, 0x1D, 0xC2,
+    0x68, 0x38, 0x0B, 0x79, 0x4D, 0x0F, 0xB8, 0x0D, 0x84, 0xB2, 0xA2, 0x90, 0x39, 0xC6, 0xB8, 0x7F,
+    0x22, 0x0A, 0x29, 0x7C, 0x95, 0x55, 0xA0, 0xAD, 0xC4, 0xBD, 0x64, 0x9D, 0x78, 0xA1, 0x90, 0x70,
+    0x16, 0xE2, 0x8A, 0x71, 0xC8, 0x73, 0x92, 0xFB, 0x64, 0xC2, 0xE2, 0x59, 0x09, 0x05, 0xEF, 0x22,
+    0x0B, 0x38, 0xF4, 0xC1, 0x47, 0x44, 0x71, 0x24, 0x44, 0x81, 0x36, 0x44, 0x26, 0x9B, 0xA4, 0x24,
+    0xA2, 0x2D, 0xB7, 0x1A, 0x9D, 0x55, 0xD6, 0x99, 0xCF, 0xA1, 0x0C, 0x79, 0x24, 0xDB, 0x0A, 0x25,
+    0x1D, 0x3F, 0x18, 0x44, 0x1D, 0x52, 0x31, 0x27, 0x51, 0x97, 0xB4, 0x41, 0xD0, 0x11, 0x62, 0xD0,
+    0x60, 0x64, 0x4A, 0x28, 0x60, 0xDA, 0x02, 0xDE, 0xB8, 0x4F, 0x3A, 0x89, 0x07, 0x64, 0x07, 0xAB,
+    0x56, 0xCC, 0x84, 0x35, 0x7C, 0xA5, 0x2E, 0xC6, 0xB6, 0x45, 0xC0, 0x5A, 0xF8, 0xC2, 0x14, 0xAC,
+    0x92, 0xA4, 0xF7, 0xFF, 0x3F, 0xEC, 0x68, 0x44, 0xC4, 0x68, 0x1E, 0x6C, 0xB7, 0xCE, 0x34, 0x92,
+    0x0F, 0x29, 0xB1, 0x40, 0xB0, 0x91, 0x5E, 0xD7, 0x3A, 0x40, 0x4B, 0xFD, 0x77, 0xBD, 0x40, 0x1B,
+    0xB4, 0x46, 0x3C, 0xD9, 0x41, 0x12, 0x51, 0xCA, 0x9E, 0x48, 0xDD, 0x2C, 0xAD, 0x22, 0x9E, 0xB8,
+    0x07, 0xA8, 0xB9, 0x43, 0xF4, 0xB6, 0xB6, 0x30, 0x06, 0xBC, 0xD3, 0x81, 0x5D, 0x26, 0xA5, 0xF8,
+    0x9A, 0xCC, 0x3D, 0xE7, 0xFB, 0x71, 0x96, 0x68, 0x8A, 0x2D, 0xC3, 0x34, 0x77, 0xA5, 0xDA, 0xD4,
+    0xC1, 0x84, 0x54, 0x12, 0x17, 0xB3, 0x6E, 0xC8, 0x64, 0x12, 0x6D, 0x92, 0x2E, 0x58, 0xF5, 0x55,
+    0x64, 0xA7, 0xB2, 0x5C, 0xE2, 0xF1, 0x9E, 0x25, 0x9A, 0xCA, 0xDB, 0x5D, 0x89, 0x45, 0x9E, 0xC3,
+    0xE3, 0xA6, 0x88, 0xE9, 0xBF, 0xCC, 0x44, 0xE2, 0x76, 0xE9, 0xF0, 0xC1, 0xD7, 0x56, 0xB6, 0x8E,
+    0x6C, 0xAD, 0x6C, 0xAD, 0xAC, 0x30, 0xE7, 0x70, 0x1D, 0x2B, 0x97, 0x82, 0x2E, 0xBA, 0xBC, 0xEF,
+    0xF0, 0x9B, 0x57, 0x00, 0xE6, 0x9A, 0xAC, 0xBD, 0xFF, 0x85, 0xDE, 0x92, 0x83, 0x62, 0xCF, 0x5D,
+    0xAC, 0x93, 0xF7, 0x56, 0xEC, 0x03, 0xFD, 0xF4, 0x84, 0xEC, 0x3D, 0x6F, 0x6F, 0x16, 0x87, 0xD6,
+    0xF5, 0xC1, 0xBD, 0xED, 0xE8, 0xCA, 0x52, 0xD9, 0x7D, 0xCC, 0xEE, 0xDC, 0xD9, 0xAC, 0x96, 0xA4,
+    0x8B, 0xEA, 0x4C, 0x16, 0x91, 0x4B, 0xAB, 0x53, 0x4C, 0x70, 0x0A, 0x7E, 0x68, 0xCE, 0x5C, 0x4A,
+    0x86, 0x68, 0xFB, 0x58, 0xED, 0xBA, 0xB5, 0x7C, 0x0A, 0x89, 0x50, 0x50, 0xA4, 0xFD, 0xC1, 0x03,
+    0x6F, 0xA5, 0x87, 0xD3, 0x5C, 0x63, 0x95, 0x7D, 0xF9, 0x98, 0xEF, 0x02, 0x6C, 0xF2, 0xFB, 0xA2,
+    0xDA, 0x73, 0x78, 0xB3, 0xC7, 0x99, 0x2B, 0xAB, 0xEC, 0x1A, 0x52, 0x4E, 0x9C, 0x8C, 0x68, 0xDC,
+    0xCE, 0x4A, 0xF6, 0xDB, 0x28, 0xE5, 0xE7, 0x5D, 0x38, 0x99, 0x26, 0xE9, 0xB5, 0xCA, 0x1F, 0x00,
+    0x89, 0xDB, 0x7D, 0xA4, 0x59, 0x7D, 0xEF, 0x56, 0x74, 0xF6, 0xFB, 0x47, 0x9F, 0x6C, 0x6D, 0x1F,
+    0xDF, 0x1C, 0x8D, 0x2B, 0xE5, 0x45, 0x19, 0x62, 0x17, 0xD5, 0xA9, 0x2C, 0x0B, 0x5E, 0xFA, 0x48,
+    0x81, 0xCD, 0xAB, 0xE7, 0xF4, 0xBB, 0xA4, 0x58, 0x92, 0xCB, 0x71, 0x7D, 0x35, 0x6D, 0x2D, 0xD8,
+    0x41, 0x64, 0xCF, 0x51, 0xAD, 0xE3, 0xE2, 0x40, 0xE6, 0x4E, 0x37, 0xF1, 0x97, 0x57, 0xED, 0x43,
+    0x4C, 0x70, 0x1B, 0xBA, 0xD8, 0xBD, 0xE4, 0x96, 0xDD, 0xB7, 0xBD, 0x0E, 0xAB, 0x9D, 0x38, 0x71,
+    0xAB, 0xEF, 0x78, 0x10, 0x94, 0x20, 0x9C, 0x5A, 0xE8, 0x5F, 0x93, 0xEC, 0xBD, 0x60, 0x7F, 0xF1,
+    0x10, 0xDC, 0xDD, 0x8E, 0xFE, 0x4C, 0xCB, 0xBE, 0xAC, 0x36, 0x2E, 0xAA, 0x8B, 0xAB, 0x43, 0x84,
+    0x20, 0x97, 0x21, 0x6A, 0xB3, 0x8A, 0x65, 0x89, 0x7E, 0x3D, 0xDA, 0xB4, 0x67, 0x2E, 0x03, 0x02,
+    0x3D, 0xD6, 0x10, 0x02, 0xF5, 0x10, 0xEC, 0xC1, 0x74, 0x7F, 0x73, 0xA6, 0x5D, 0x6E, 0x97, 0xCB,
+    0x21, 0x1B, 0x64, 0xD9, 0x76, 0xB6, 0xF5, 0x25, 0x41, 0xF1, 0xD9, 0xCC, 0x0D, 0x2A, 0x07, 0x46,
+    0x62, 0xE5, 0x51, 0x77, 0xBE, 0xC7, 0xF9, 0x8D, 0xFF, 0x9C, 0xD3, 0x96, 0x93, 0x39, 0xB1, 0xEC,
+    0xF8, 0x9C, 0xFF, 0x8E, 0x24, 0x8E, 0x6C, 0xDE, 0x83, 0xA9, 0x95, 0x68, 0xE2, 0x0C, 0xA2, 0x91,
+    0x01, 0x2E, 0xA8, 0xC4, 0xB2, 0x39, 0xF2, 0x82, 0xB4, 0x37, 0x91, 0xD9, 0xD0, 0x15, 0x18, 0x1D,
+    0x74, 0x18, 0xDA, 0x18, 0x0D, 0xA7, 0xEC, 0xBF, 0xD8, 0xFF, 0xF0, 0xE6, 0x20, 0x25, 0x7E, 0xCD,
+    0x72, 0xA7, 0xFF, 0xCB, 0x50, 0x40, 0xA1, 0x0D, 0x6C, 0xC3, 0x6A, 0xD9, 0x84, 0xFE, 0x0D, 0xF8,
+    0x30, 0x74, 0xCE, 0x33, 0x83, 0xEF, 0xAA, 0xEB, 0x48, 0x64, 0x71, 0x04, 0xCD, 0x7B, 0x13, 0x1E,
+    0xFB, 0x35, 0xB4, 0xDE, 0xF1, 0x5A, 0x02, 0x87, 0x26, 0x2C, 0xEF, 0x34, 0xA0, 0xE6, 0x09, 0x14,
+    0x8D, 0xF6, 0x05, 0x65, 0x81, 0xB6, 0x6C, 0x6D, 0xF4, 0xC6, 0xFD, 0x44, 0x87, 0xB3, 0xA2, 0x77,
+    0x3E, 0xAB, 0xB3, 0xA1, 0x5F, 0x84, 0xFA, 0xD5, 0xDB, 0xB5, 0x79, 0xE8, 0x50, 0xD6, 0x32, 0x2B,
+    0xCC, 0xA3, 0xBB, 0x2E, 0xD2, 0x29, 0x07, 0x51, 0xFC, 0x08, 0x27, 0x53, 0xB9, 0x48, 0x15, 0xFC,
+    0x80, 0x7B, 0x88, 0xF9, 0x91, 0x93, 0xFA, 0x50, 0xCA, 0xDA, 0x73, 0xA0, 0xC9, 0xD0, 0x89, 0xF7,
+    0x50, 0xD6, 0xB3, 0x06, 0x91, 0xDC, 0x40, 0x24, 0x1F, 0xBD, 0xFE, 0x84, 0x30, 0xF5, 0x31, 0x28,
+    0x5C, 0x5B, 0x6C, 0x1C, 0xBD, 0x46, 0xAE, 0x3B, 0xA8, 0x4A, 0xC3, 0x99, 0x9F, 0xE9, 0x3A, 0x50,
+    0x32, 0x24, 0x86, 0x04, 0xC9, 0x5C, 0x5D, 0x18, 0x9C, 0x1F, 0x37, 0xB4, 0xB0, 0x7F, 0x98, 0x21,
+    0x69, 0xB1, 0x6F, 0x81, 0xB8, 0xEF, 0xFC, 0x7C, 0x8D, 0x9E, 0x7D, 0x08, 0xE5, 0x9C, 0x81, 0xD6,
+    0x4C, 0x45, 0xF6, 0x2B, 0x95, 0x9F, 0x3A, 0x8B, 0xB0, 0x54, 0xE0, 0xEE, 0x64, 0x04, 0xDE, 0x47,
+    0x68, 0x1C, 0x54, 0x0D, 0x9D, 0x3A, 0x63, 0xDF, 0x71, 0x1C, 0x49, 0x1B, 0x06, 0x01, 0xC1, 0x5A,
+    0x1F, 0x5E, 0x9C, 0xBE, 0x9E, 0xE9, 0x83, 0xC3, 0xCF, 0xD1, 0xB5, 0x18, 0x09, 0xAB, 0x3B, 0x05,
+    0x13, 0x84, 0x07, 0x3D, 0xB7, 0xB1, 0xB1, 0x71, 0x5E, 0x76, 0xC7, 0x39, 0xF3, 0x85, 0x22, 0x8D,
+    0x96, 0x15, 0x69, 0x95, 0x47, 0x47, 0x82, 0x4A, 0xF0, 0x38, 0xD2, 0xC2, 0xAB, 0x2B, 0xA8, 0x13,
+    0x53, 0x39, 0xFA, 0x43, 0x0C, 0x21, 0x77, 0x74, 0xD6, 0x99, 0x26, 0x52, 0x7F, 0xDD, 0x9E, 0x5F,
+    0x6F, 0x6C, 0x4E, 0x76, 0x7B, 0xE7, 0x02, 0x2C, 0x69, 0x89, 0x2A, 0x81, 0xED, 0x94, 0x96, 0x62,
+    0x64, 0x44, 0x16, 0xE4, 0x84, 0x58, 0x97, 0x21, 0x35, 0x9C, 0x78, 0xA4, 0xEA, 0x54, 0x79, 0x04,
+    0x8A, 0x01, 0x37, 0xB7, 0xFF, 0x92, 0xA7, 0x62, 0x66, 0x98, 0x08, 0xDD, 0xA9, 0x67, 0xE7, 0xCC,
+    0xCD, 0x5E, 0x0C, 0x1F, 0x0E, 0x01, 0xC3, 0xB6, 0xF9, 0x69, 0x93, 0xE7, 0x26, 0xB7, 0x95, 0x44,
+    0x20, 0x26, 0x6A, 0xFC, 0x44, 0xA1, 0x94, 0x67, 0x19, 0x69, 0x9A, 0x1D, 0x3B, 0xC3, 0x87, 0x4F,
+    0x32, 0xA0, 0xB0, 0x3E, 0x3C, 0x3E, 0xF8, 0x49, 0x8F, 0x4F, 0x9D, 0x80, 0xF3, 0xF5, 0x0F, 0xAD,
+    0x55, 0x3D, 0x8F, 0xDD, 0x54, 0x10, 0x1D, 0xDB, 0x10, 0x4B, 0x3C, 0xA1, 0x9B, 0x22, 0x14, 0xB0,
+    0x02, 0xB7, 0x08, 0x09, 0x99, 0x1A, 0x89, 0xBD, 0x46, 0xFC, 0x80, 0x20, 0x91, 0xD7, 0x2C, 0x45,
+    0xA0, 0xE4, 0x43, 0x7A, 0xFF, 0x00, 0x1B, 0x51, 0x52, 0x64, 0x0B, 0x68, 0x68, 0x42, 0x07, 0x6C,
+    0x13, 0x0A, 0x0A, 0x0A, 0x88, 0xEF, 0x26, 0x65, 0x8A, 0xB5, 0x84, 0xA8, 0x28, 0xB0, 0x14, 0xA4,
+    0x00, 0x29, 0x9E, 0xD9, 0x78, 0x85, 0x37, 0xCF, 0xF6, 0x70, 0xCE, 0xF5, 0xB3, 0xB2, 0x2B, 0x42,
+    0xC7, 0x95, 0x3C, 0xEB, 0x77, 0xEF, 0x78, 0x66, 0xCE, 0x9C, 0x33, 0x77, 0xED, 0x98, 0x09, 0x96,
+    0x6A, 0x01, 0x1B, 0xA9, 0xF2, 0x97, 0x71, 0x96, 0x7B, 0x56, 0x7E, 0xE0, 0x9F, 0x3E, 0x6C, 0x78,
+    0xD4, 0x2C, 0x9C, 0xE4, 0xB5, 0x71, 0xB9, 0xC4, 0x5A, 0x59, 0xED, 0xC5, 0xBE, 0x8D, 0xAF, 0x2A,
+    0x69, 0xF1, 0x7B, 0x94, 0xA8, 0x92, 0x04, 0x7B, 0x8B, 0x5A, 0xF2, 0x4D, 0x27, 0xA6, 0x0F, 0x34,
+    0x6E, 0x24, 0x19, 0xE2, 0xCE, 0x54, 0x62, 0x86, 0xB4, 0xB6, 0x85, 0x84, 0x5D, 0x59, 0xA8, 0x3C,
+    0x11, 0x1F, 0x8F, 0x51, 0x2F, 0xDF, 0xA5, 0x77, 0x3A, 0xD3, 0xC6, 0xAA, 0x38, 0xAA, 0xAD, 0xB6,
+    0x7A, 0xA8, 0x85, 0xEA, 0xC7, 0xCB, 0x60, 0x29, 0xAB, 0xDF, 0x64, 0xBB, 0xE2, 0x1A, 0xD9, 0x83,
+    0x8E, 0x95, 0xE4, 0x22, 0x49, 0x61, 0x1C, 0xB6, 0xA2, 0x46, 0xC2, 0x56, 0x06, 0x41, 0x71, 0xF6,
+    0xF5, 0xC6, 0xA2, 0xE4, 0x79, 0xFD, 0xA9, 0xE5, 0x66, 0xFC, 0xD2, 0xDC, 0xE9, 0x3F, 0x92, 0xE8,
+    0x81, 0xAE, 0x32, 0x19, 0xF4, 0x7E, 0x25, 0x56, 0xB5, 0x11, 0xA3, 0x65, 0x2F, 0xA1, 0xFE, 0xA2,
+    0x22, 0xE5, 0x31, 0xA0, 0x26, 0x7D, 0x5E, 0x4B, 0x3C, 0x9A, 0x16, 0xC8, 0x3F, 0x41, 0x2C, 0x5B,
+    0x95, 0x80, 0xDD, 0x24, 0x4E, 0x5E, 0xFD, 0x8C, 0xC8, 0xB5, 0xA5, 0x51, 0xB1, 0x30, 0x45, 0x6E,
+    0xAB, 0xA4, 0xCA, 0x2D, 0x72, 0xC3, 0x44, 0x4D, 0xBE, 0xFB, 0xEC, 0x1B, 0x30, 0xC9, 0xED, 0xF3,
+    0xE6, 0xD6, 0xB7, 0xE5, 0x2E, 0x0A, 0x84, 0xA9, 0x69, 0x3A, 0xD1, 0xDD, 0x58, 0xD7, 0xBA, 0x1B,
+    0xA2, 0xB2, 0x4B, 0x92, 0x22, 0x98, 0xC8, 0xDE, 0x4D, 0x98, 0x4B, 0x78, 0xD8, 0xD2, 0xE0, 0xEA,
+    0xCF, 0x82, 0x7D, 0x64, 0x2F, 0x99, 0x0E, 0xB8, 0x24, 0xBD, 0x0E, 0x84, 0xF4, 0x64, 0x7F, 0xC3,
+    0x36, 0x45, 0xE1, 0x85, 0x75, 0xF2, 0x9A, 0x8C, 0x22, 0x6D, 0xD4, 0x49, 0x54, 0x23, 0xB8, 0x21,
+    0x57, 0x09, 0xBD, 0x52, 0x78, 0xC9, 0xCE, 0xDD, 0xC6, 0x37, 0xEB, 0xC9, 0xE5, 0x72, 0x29, 0xB9,
+    0x2A, 0x5A, 0x4F, 0xC4, 0xD3, 0x0A, 0xCA, 0x4E, 0x02, 0xB2, 0x64, 0x91, 0x67, 0xA1, 0xEA, 0x84,
+    0x3C, 0x27, 0x27, 0x19, 0xA8, 0xEB, 0x19, 0xA4, 0x66, 0x79, 0x88, 0xE4, 0x50, 0x13, 0x82, 0x21,
+    0x24, 0x5C, 0xE0, 0x8B, 0xA3, 0x06, 0xAD, 0x7D, 0x13, 0xCE, 0x8C, 0xA5, 0x60, 0xC2, 0x30, 0x4E,
+    0x89, 0xB3, 0x88, 0x2F, 0x0B, 0x16, 0x7E, 0x01, 0xDE, 0x58, 0xC8, 0xBC, 0x7C, 0x8B, 0x0C, 0xFC,
+    0x4A, 0x83, 0x1A, 0x74, 0xE0, 0x4B, 0x2B, 0xA6, 0xBD, 0x08, 0x2C, 0xF7, 0x1D, 0xF5, 0x05, 0x3A,
+    0x09, 0x6A, 0x2A, 0x1E, 0xE1, 0x72, 0xBC, 0x04, 0xF7, 0xC6, 0x0F, 0x19, 0xB8, 0x21, 0x62, 0x87,
+    0x98, 0x23, 0xAB, 0xCD, 0xE0, 0x09, 0xD2, 0xBD, 0xD7, 0xBB, 0xCC, 0x10, 0xB3, 0x77, 0x49, 0x3F,
+    0xCB, 0x62, 0x96, 0x29, 0x21, 0x78, 0x9A, 0x1C, 0xB9, 0x4B, 0x7B, 0x36, 0x59, 0x3D, 0x46, 0x31,
+    0x1E, 0x17, 0x1D, 0xCC, 0xC9, 0x07, 0xA3, 0xFF, 0x02, 0x9F, 0x04, 0xFE, 0x94, 0x4D, 0x72, 0x0C,
+    0x3F, 0x85, 0xA6, 0xFE, 0x43, 0xF5, 0x71, 0x4B, 0x8F, 0x26, 0x6D, 0x69, 0x17, 0xC3, 0x94, 0x69,
+    0x9A, 0x8E, 0xCA, 0xCF, 0x43, 0x47, 0x6B, 0x46, 0x79, 0xB4, 0x0C, 0x0F, 0x22, 0xFF, 0x81, 0xF7,
+    0xB7, 0xD3, 0xF8, 0xC0, 0xAC, 0xF4, 0x77, 0x82, 0xD5, 0x82, 0xA9, 0x6B, 0x9A, 0x3E, 0xD4, 0x4D,
+    0xBB, 0x27, 0xDA, 0xA0, 0xEA, 0xBC, 0xC1, 0x84, 0xA5, 0x1D, 0x3C, 0x17, 0x03, 0x05, 0xAD, 0x82,
+    0x4D, 0xE5, 0xD8, 0xD9, 0xC6, 0xE8, 0x1F, 0x97, 0x7B, 0x7C, 0xF0, 0x40, 0xC9, 0x04, 0x66, 0xAD,
+    0xD4, 0x1B, 0xBD, 0x71, 0xFA, 0x95, 0xDE, 0x6E, 0xAC, 0xC3, 0x56, 0xD9, 0x10, 0x68, 0xEF, 0x95,
+    0x4F, 0xF8, 0xEA, 0x98, 0x88, 0x94, 0x9C, 0xB2, 0x4F, 0xC5, 0x76, 0x72, 0x24, 0xF0, 0xF5, 0xBE,
+    0x47, 0xF3, 0x1C, 0x7B, 0x49, 0x69, 0x15, 0xBE, 0x6F, 0x2C, 0xF8, 0xF9, 0x78, 0x02, 0x6D, 0x3D,
+    0xB6, 0xD8, 0xFB, 0x42, 0x67, 0xD3, 0x3C, 0x0D, 0xD3, 0x44, 0xE5, 0xDE, 0x56, 0x73, 0xD3, 0xFF,
+    0x75, 0x80, 0x86, 0xBD, 0x88, 0x8C, 0x5D, 0x50, 0x66, 0xFE, 0xBC, 0xA1, 0x96, 0x27, 0xAA, 0x7D,
+    0xAA, 0x1D, 0x5F, 0xD1, 0x76, 0x3D, 0x55, 0x78, 0x8D, 0xF7, 0xA0, 0x01, 0xEC, 0x0C, 0xA8, 0x39,
+    0xD3, 0xA1, 0x28, 0xAD, 0xD8, 0x23, 0x67, 0xEE, 0x36, 0x51, 0xD7, 0x8B, 0x4E, 0x3F, 0x36, 0x2D,
+    0x98, 0x2A, 0xAC, 0x76, 0x24, 0x7A, 0x07, 0x04, 0xFD, 0x88, 0x66, 0x65, 0xEF, 0x1F, 0x1C, 0x1C,
+    0x7C, 0xE3, 0xF3, 0xCA, 0xF9, 0xF5, 0x12, 0x0E, 0xBE, 0x66, 0x1F, 0x86, 0x47, 0x06, 0x28, 0xBD,
+    0x44, 0x1E, 0x67, 0x8A, 0xB3, 0x26, 0x78, 0xAC, 0x71, 0x93, 0x01, 0x98, 0xB5, 0xEA, 0x86, 0x3A,
+    0x02, 0xEB, 0x89, 0x83, 0x66, 0xFE, 0x9E, 0x7A, 0x00, 0xAD, 0xA4, 0x5A, 0x2D, 0x88, 0xA4, 0x83,
+    0x5B, 0xC1, 0x31, 0x09, 0x07, 0x2F, 0x21, 0x4E, 0x2D, 0x87, 0xA4, 0x00, 0xD5, 0xF2, 0xCC, 0x15,
+    0x09, 0xBF, 0xA7, 0x3C, 0xD1, 0xE8, 0xC3, 0x4A, 0xB4, 0xCC, 0x22, 0x14, 0xB7, 0xD2, 0x96, 0x64,
+    0xA5, 0x9A, 0x64, 0x18, 0xA8, 0xE0, 0xB2, 0xB6, 0x17, 0x54, 0xBF, 0x58, 0xE9, 0x7E, 0x59, 0xF6,
+    0xF1, 0xC3, 0x7B, 0x4D, 0xE9, 0xCC, 0xBA, 0x87, 0x4E, 0x5D, 0x00, 0xAA, 0xE2, 0xD3, 0xB3, 0x60,
+    0xED, 0x2C, 0x38, 0x4A, 0x2D, 0xF6, 0xD2, 0x1E, 0x26, 0x4A, 0x21, 0x0A, 0x17, 0xE9, 0x06, 0x17,
+    0xF3, 0x7A, 0x55, 0x45, 0x0F, 0xBB, 0x41, 0xF2, 0xD5, 0xB5, 0x3A, 0x3E, 0xEE, 0x46, 0xC9, 0x93,
+    0x4F, 0xEB, 0xE8, 0xAF, 0xEE, 0xA6, 0xD8, 0xE4, 0x1A, 0x5F, 0xC6, 0xE9, 0xE5, 0xA4, 0x1F, 0xC4,
+    0x5E, 0x3F, 0xAA, 0xA2, 0xD3, 0x7E, 0x98, 0xE3, 0x2B, 0x95, 0x62, 0x39, 0x2D, 0x86, 0x41, 0x23,
+    0x5C, 0x27, 0xC2, 0x81, 0xC2, 0x15, 0xE2, 0x70, 0x03, 0x99, 0x06, 0xBF, 0xA3, 0x61, 0x8F, 0xB7,
+    0xB5, 0xF2, 0xFF, 0x00, 0x48, 0x37, 0x3A, 0x5D, 0x16, 0x80, 0x0B, 0xB3, 0xEF, 0x9B, 0x10, 0xFA,
+    0xE1, 0xF3, 0x62, 0x48, 0xA7, 0xA9, 0xF3, 0x32, 0xB2, 0xED, 0x3C, 0x41, 0x91, 0x67, 0x20, 0x28,
+    0xB6, 0x32, 0xD5, 0xF9, 0x01, 0xAA, 0xB2, 0x98, 0x9E, 0x7C, 0x2B, 0xB4, 0x23, 0x86, 0xD6, 0xCF,
+    0x97, 0x57, 0x4C, 0xB3, 0xF5, 0xE2, 0x9D, 0x14, 0x30, 0x4A, 0xCA, 0xE1, 0xCD, 0xCE, 0xF6, 0x27,
+    0xA8, 0xB7, 0xE7, 0x21, 0xD5, 0x98, 0xC2, 0x44, 0xC4, 0x61, 0xD7, 0xEB, 0x36, 0x1E, 0xED, 0xD5,
+    0x2E, 0xAD, 0x06, 0x53, 0xBD, 0x1C, 0xB5, 0x4F, 0x6F, 0x87, 0xD7, 0x4F, 0xEC, 0x30, 0x37, 0xF5,
+    0xFC, 0xD6, 0xB4, 0xDE, 0xC1, 0xB3, 0xCB, 0x5C, 0x38, 0x8B, 0xB8, 0x8D, 0x1B, 0x19, 0x7D, 0xC1,
+    0x4B, 0x7E, 0x0B, 0x95, 0x75, 0x04, 0x79, 0x03, 0xCF, 0xE1, 0x72, 0x99, 0x57, 0xD3, 0x3C, 0xD1,
+    0x35, 0x45, 0x21, 0x49, 0x3D, 0xDD, 0xEB, 0xF2, 0xCA, 0x1C, 0xEC, 0x3F, 0x32, 0xCD, 0x5B, 0xA1,
+    0xB3, 0xD9, 0xBE, 0x2F, 0x31, 0xFF, 0xA9, 0xC5, 0x7F, 0x9E, 0xF5, 0xBA, 0x9B, 0xC8, 0xF0, 0xFF,
+    0x91, 0x52, 0x62, 0x4F, 0x19, 0xEF, 0x05, 0xC6, 0xBA, 0x28, 0xFF, 0xC3, 0xFA, 0x07, 0xAD, 0x55,
+    0x31, 0x6F, 0x1E, 0x45, 0x10, 0x9D, 0xBB, 0x05, 0x2F, 0xCA, 0x21, 0x2D, 0x12, 0x04, 0x29, 0x11,
+    0x70, 0x7D, 0x9A, 0x6B, 0x68, 0xCD, 0x1E, 0xA2, 0x48, 0x41, 0x11, 0x17, 0x50, 0x27, 0x35, 0x0D,
+    0x2D, 0x0D, 0xDA, 0x8B, 0x5C, 0xD0, 0x71, 0x7F, 0x81, 0x82, 0xC2, 0xFA, 0x52, 0x98, 0x3F, 0x90,
+    0xEC, 0x25, 0x2E, 0x28, 0x52, 0x70, 0xA1, 0x4D, 0xC1, 0x11, 0x47, 0x42, 0x8A, 0x0B, 0x1F, 0xF8,
+    0x84, 0x57, 0x66, 0xEF, 0x86, 0x37, 0xFB, 0xF9, 0xB3, 0x23, 0x1A, 0x40, 0xB0, 0xF2, 0x8E, 0xD7,
+    0xBB, 0x7B, 0xB3, 0x6F, 0xDE, 0xCC, 0x1B, 0x53, 0x46, 0xAF, 0x11, 0xA9, 0xDE, 0x34, 0x94, 0x07,
+    0x35, 0x51, 0x1E, 0xC9, 0xD6, 0x59, 0x24, 0x3D, 0xC2, 0x90, 0x23, 0xC6, 0x18, 0xC5, 0xCC, 0xE6,
+    0x6C, 0xB5, 0x62, 0xD9, 0xF4, 0x54, 0x75, 0xE4, 0xEA, 0x74, 0x93, 0x6C, 0x63, 0x1B, 0x7C, 0x5E,
+    0x74, 0x44, 0x3B, 0xD4, 0x10, 0x65, 0x98, 0x7A, 0x24, 0xAA, 0x70, 0x91, 0x99, 0x14, 0x73, 0x6F,
+    0x4E, 0x9F, 0x4E, 0xD5, 0xEE, 0x93, 0x70, 0x45, 0xF5, 0x77, 0x70, 0x95, 0x5E, 0x9E, 0x46, 0xF5,
+    0xDF, 0x55, 0x07, 0x3F, 0x06, 0x73, 0x7A, 0x3C, 0xE6, 0xCC, 0x1D, 0x79, 0x26, 0x2A, 0x03, 0x7C,
+    0x0C, 0x44, 0x54, 0x63, 0x5E, 0x6D, 0x2C, 0x73, 0xC6, 0x1C, 0x35, 0xF3, 0x37, 0xE5, 0x8C, 0xE7,
+    0x67, 0xCA, 0x79, 0xA6, 0xE2, 0x97, 0x99, 0xEC, 0xCD, 0x99, 0x66, 0x3D, 0xAB, 0x49, 0xCF, 0xA6,
+    0xD3, 0xF3, 0x5B, 0xE9, 0xAB, 0x2D, 0xBA, 0xB6, 0x83, 0x1B, 0x1C, 0x2A, 0xE6, 0x87, 0x9E, 0x23,
+    0x30, 0xC0, 0x6D, 0xA4, 0x8A, 0xBB, 0x22, 0xCE, 0x39, 0x9B, 0xDE, 0x77, 0xF7, 0xAB, 0xB1, 0x38,
+    0x8A, 0xF4, 0xC0, 0xE2, 0x0D, 0x00, 0x7E, 0x7D, 0x8D, 0xD9, 0x37, 0xC5, 0xB3, 0x85, 0x66, 0x13,
+    0x4C, 0x6F, 0xFB, 0x48, 0x7C, 0xAB, 0x53, 0x4B, 0x24, 0xC3, 0x0D, 0xB9, 0x00, 0x10, 0x1F, 0x81,
+    0x09, 0xFC, 0xA2, 0x34, 0x14, 0x66, 0xBC, 0x4F, 0xF6, 0xE9, 0x60, 0x82, 0xCB, 0x17, 0x3D, 0xFA,
+    0xC6, 0x96, 0xA3, 0xFA, 0x03, 0xA4, 0x30, 0x5E, 0xEF, 0xF0, 0x1C, 0xDF, 0x05, 0x6A, 0x23, 0x41,
+    0x6D, 0x86, 0x96, 0x80, 0x0C, 0x22, 0xA7, 0x4A, 0x8C, 0x95, 0x13, 0xF1, 0xA7, 0x96, 0xD5, 0x6A,
+    0xAF, 0x10, 0x92, 0x2B, 0x31, 0x56, 0x0E, 0x4B, 0xD0, 0xBD, 0xA7, 0xE5, 0xCF, 0x5C, 0x0C, 0x79,
+    0xB9, 0x9C, 0x4E, 0x8C, 0xAC, 0x8A, 0xFA, 0xC2, 0xAB, 0xD0, 0x4E, 0xFA, 0x6B, 0x98, 0x2C, 0x80,
+    0x39, 0x72, 0xED, 0x20, 0x1C, 0x02, 0xB6, 0xE6, 0x96, 0x29, 0xE3, 0x00, 0x12, 0xEC, 0x71, 0x7B,
+    0x3C, 0x9A, 0x10, 0xA2, 0x3F, 0x58, 0x4C, 0xFB, 0x28, 0x9A, 0x26, 0xC4, 0xA2, 0xBE, 0x63, 0xDA,
+    0xEE, 0x0D, 0xA2, 0x10, 0xC5, 0x6D, 0x2B, 0x7E, 0xFF, 0x76, 0xB9, 0x1E, 0xA3, 0xA0, 0x9E, 0xC4,
+    0xC8, 0x49, 0xB6, 0xC8, 0x9E, 0xAF, 0x6F, 0xAC, 0x56, 0xBE, 0xB7, 0xBC, 0xE6, 0x89, 0xE5, 0x44,
+    0xCD, 0xD8, 0xDB, 0x8F, 0x17, 0x7B, 0xF0, 0x90, 0xA5, 0x88, 0x67, 0x31, 0x61, 0xE3, 0x2A, 0x8D,
+    0x7F, 0x8E, 0x62, 0x0B, 0xCB, 0x8C, 0x02, 0x96, 0x93, 0x1D, 0x42, 0xAC, 0x7A, 0x6E, 0xDB, 0xC7,
+    0x51, 0x2D, 0x61, 0x61, 0xA4, 0xAB, 0x45, 0xE4, 0x36, 0xF0, 0x80, 0x97, 0x5A, 0xA9, 0xA4, 0x20,
+    0xE8, 0xCA, 0x56, 0x58, 0xFA, 0x42, 0xF8, 0xA3, 0x57, 0x2E, 0xC2, 0x78, 0x97, 0x0C, 0x2C, 0x8A,
+    0x08, 0x84, 0x4E, 0x12, 0x8A, 0xED, 0x74, 0x90, 0x98, 0x8A, 0x89, 0xEC, 0x8B, 0xD5, 0xBE, 0xD4,
+    0x24, 0x90, 0x57, 0x6B, 0x15, 0x80, 0x72, 0xFB, 0x84, 0x57, 0xAB, 0x7B, 0x52, 0x8F, 0xCC, 0x43,
+    0x3A, 0x44, 0xB2, 0xA9, 0x1C, 0x25, 0x20, 0x9C, 0xAB, 0x51, 0x62, 0x2A, 0x6A, 0x75, 0xC9, 0x94,
+    0xE4, 0xA9, 0x92, 0x84, 0xC1, 0xBB, 0xE2, 0x49, 0x54, 0x31, 0x90, 0x3B, 0xE1, 0xDE, 0x2E, 0x96,
+    0x0F, 0xF8, 0xF0, 0x28, 0x16, 0x0F, 0xB6, 0x4B, 0x52, 0x87, 0x80, 0xF6, 0xC1, 0x36, 0x5D, 0x2E,
+    0xDE, 0x3C, 0xEC, 0x77, 0xCA, 0x65, 0xDB, 0xEE, 0xF2, 0xE1, 0x71, 0x2C, 0x71, 0xB9, 0xAE, 0x4E,
+    0xA5, 0x14, 0xC1, 0x61, 0x0E, 0x17, 0x88, 0x0B, 0x5E, 0xDF, 0xDB, 0x3C, 0x83, 0x08, 0x34, 0x88,
+    0xB5, 0xCB, 0x3A, 0x25, 0x52, 0xCE, 0x65, 0x27, 0x02, 0xDE, 0x7F, 0x12, 0x4A, 0x3E, 0xFA, 0x19,
+    0x48, 0x6F, 0xCD, 0x6E, 0x76, 0x9D, 0xFD, 0x75, 0x26, 0xF7, 0x78, 0x24, 0xAE, 0x3A, 0x15, 0x5C,
+    0x53, 0x3D, 0xE4, 0x23, 0x86, 0x4A, 0x27, 0xCC, 0x4E, 0x23, 0x67, 0xB9, 0x6F, 0xD6, 0x1E, 0x5F,
+    0x45, 0xAA, 0xFC, 0xF3, 0x6C, 0x02, 0x8D, 0x1C, 0x1C, 0x14, 0x2F, 0x1C, 0x50, 0xC9, 0xF7, 0x92,
+    0xA4, 0x6A, 0x83, 0xD7, 0x50, 0x93, 0x7E, 0x24, 0x13, 0xB0, 0x5B, 0x23, 0xAD, 0xF2, 0x79, 0x35,
+    0x66, 0xEC, 0xA1, 0x1B, 0x72, 0xDF, 0xA3, 0xE8, 0x86, 0x72, 0xB4, 0x9D, 0x9A, 0x75, 0x04, 0x3D,
+    0xA0, 0xAE, 0xB6, 0xBD, 0x5A, 0x5C, 0xAF, 0x45, 0x24, 0x13, 0xBE, 0x16, 0x1D, 0x97, 0xA2, 0xCC,
+    0xFE, 0x36, 0x77, 0x89, 0x53, 0x71, 0x85, 0x51, 0xEB, 0xC4, 0x78, 0xDA, 0x8A, 0x80, 0x2B, 0x3C,
+    0xAB, 0x71, 0x8B, 0x97, 0x5A, 0xB4, 0xFA, 0xF2, 0xF8, 0x14, 0x33, 0x97, 0xCC, 0x88, 0xCA, 0xA9,
+    0x60, 0x90, 0x67, 0x84, 0x9D, 0x12, 0x58, 0xA1, 0x4E, 0x70, 0x24, 0x40, 0x88, 0x77, 0x17, 0xC4,
+    0x91, 0x4B, 0x43, 0x22, 0x6E, 0x34, 0x92, 0xD5, 0x19, 0x38, 0xEE, 0xD1, 0x6A, 0xEC, 0x68, 0x47,
+    0xAA, 0x26, 0x37, 0x90, 0x89, 0x5E, 0xDE, 0xFB, 0x8B, 0x91, 0x57, 0xA4, 0x00, 0x04, 0xC4, 0x6F,
+    0xB2, 0x51, 0x4C, 0x66, 0xCC, 0x67, 0xB0, 0xEC, 0x6B, 0x86, 0x90, 0x6D, 0xF7, 0x2F, 0x37, 0xAE,
+    0x37, 0x37, 0x1A, 0x3D, 0x15, 0xFF, 0xC9, 0x87, 0x6C, 0x08, 0xBA, 0x0D, 0xB0, 0x71, 0x0D, 0xF2,
+    0x88, 0xF9, 0x8C, 0x79, 0x41, 0xB6, 0x74, 0x4C, 0xE9, 0x41, 0x6E, 0xA4, 0x2E, 0xCD, 0x48, 0xD2,
+    0xB9, 0xD1, 0xEE, 0x5C, 0x23, 0x3F, 0x38, 0x49, 0xBD, 0x96, 0xF7, 0x2F, 0xBE, 0xA1, 0xAB, 0x9F,
+    0x49, 0xA7, 0xFD, 0x10, 0x4B, 0xC3, 0x2F, 0xF6, 0x84, 0x50, 0x61, 0x54, 0x12, 0x85, 0xC4, 0x9E,
+    0xC1, 0x7F, 0x12, 0x79, 0xEA, 0x5E, 0x59, 0x22, 0x25, 0xB5, 0xAF, 0xB5, 0x86, 0x5D, 0x6A, 0x6C,
+    0x49, 0xC9, 0xA9, 0x3F, 0x96, 0x43, 0xEA, 0x6A, 0x74, 0xDE, 0xB2, 0xDE, 0x17, 0x34, 0x6A, 0x48,
+    0xFE, 0x7E, 0x0A, 0xD2, 0x02, 0x24, 0x63, 0x26, 0xA1, 0x76, 0xA9, 0x1D, 0x48, 0xCA, 0x48, 0xBA,
+    0xFB, 0x66, 0x5C, 0xA3, 0xEB, 0x28, 0xA9, 0x60, 0x23, 0xEE, 0x1E, 0x73, 0x97, 0x6A, 0xC3, 0x35,
+    0x6E, 0x70, 0x65, 0xA7, 0x06, 0xFD, 0x74, 0xA0, 0x29, 0xFB, 0x3D, 0xD0, 0x36, 0x7D, 0xE9, 0xE8,
+    0xF3, 0xDE, 0xDD, 0x96, 0xF3, 0x83, 0x54, 0x33, 0x52, 0xA6, 0x93, 0x86, 0x5A, 0x03, 0xBD, 0xDD,
+    0x14, 0xCF, 0xC5, 0xD7, 0x15, 0xB1, 0x4E, 0x30, 0x4B, 0x36, 0xD5, 0xFC, 0xCE, 0x39, 0x6C, 0x2D,
+    0x0D, 0xAC, 0x18, 0x37, 0x26, 0xE1, 0x37, 0xC3, 0xC6, 0x94, 0xA9, 0x0B, 0x4B, 0x8C, 0x55, 0xB7,
+    0x89, 0x76, 0x6D, 0x9A, 0x8D, 0x49, 0x61, 0x7B, 0x14, 0xE0, 0x5D, 0x16, 0xFA, 0x11, 0xAF, 0x47,
+    0x45, 0x83, 0xB3, 0x78, 0x1E, 0x5D, 0xB6, 0x11, 0x13, 0x68, 0xE0, 0x9B, 0x4B, 0x19, 0xFC, 0xC9,
+    0xE5, 0xBF, 0x03, 0x33, 0x41, 0x12, 0x5F, 0x2D, 0x55, 0x44, 0xA1, 0xEF, 0xE0, 0x46, 0x2C, 0x9E,
+    0x71, 0xAC, 0x7E, 0x38, 0x89, 0x1E, 0x9A, 0x9F, 0x9C, 0x14, 0x74, 0xF6, 0x2D, 0x7D, 0x22, 0xAE,
+    0xF2, 0xE0, 0xF9, 0xE3, 0x93, 0xE0, 0x7D, 0x3B, 0xF8, 0xB8, 0xD5, 0xB8, 0x9E, 0xFE, 0xAF, 0xF1,
+    0x27, 0x4D, 0x8F, 0xA1, 0x11, 0xC2, 0x40, 0x14, 0x44, 0x37, 0x84, 0x70, 0x02, 0x83, 0xC0, 0x45,
+    0xC4, 0x63, 0x52, 0x42, 0xAE, 0x04, 0x04, 0x8A, 0x16, 0x10, 0x34, 0xC0, 0x4C, 0x52, 0x02, 0x82,
+    0x16, 0x50, 0x08, 0x4A, 0x20, 0x74, 0x40, 0x09, 0x30, 0x83, 0xC1, 0x45, 0x20, 0x60, 0x26, 0x64,
+    0xD9, 0x7F, 0x41, 0x70, 0x33, 0xFF, 0x25, 0xF7, 0x6F, 0xEF, 0xEF, 0x1E, 0x80, 0xD1, 0x16, 0x40,
+    0xA1, 0x8A, 0x9F, 0x42, 0x56, 0x0B, 0x1F, 0xD5, 0xB8, 0x11, 0xCA, 0x45, 0x4C, 0xB2, 0xC9, 0x85,
+    0x9B, 0x8A, 0x67, 0xDF, 0xB7, 0x3D, 0xE0, 0xDA, 0xC4, 0x17, 0x6A, 0x99, 0xA0, 0xCB, 0x84, 0x16,
+    0x65, 0xA5, 0x21, 0xAD, 0xCE, 0xF3, 0xAB, 0x40, 0x1B, 0x62, 0x23, 0x67, 0x6A, 0x87, 0x35, 0x31,
+    0x6C, 0x54, 0x83, 0x70, 0x46, 0x59, 0x95, 0xBC, 0x20, 0x22, 0xBD, 0x76, 0x32, 0xCD, 0x29, 0x7D,
+    0x46, 0x05, 0x72, 0xBC, 0x9B, 0x8C, 0x6F, 0x60, 0xAD, 0xF9, 0x5E, 0x5D, 0x19, 0x20, 0xA5, 0xDD,
+    0x4C, 0xED, 0x26, 0x5C, 0x13, 0x77, 0x3B, 0x0C, 0x25, 0xE2, 0x1E, 0x16, 0xEE, 0x1A, 0x2D, 0x83,
+    0x08, 0xC9, 0xC1, 0xF7, 0x86, 0x99, 0x7D, 0x23, 0x1A, 0xF3, 0xC0, 0x13, 0xAB, 0x3F, 0x5E, 0xFE,
+    0x18, 0x52, 0x35, 0x3F, 0x87, 0x92, 0x7C, 0xD9, 0xDC, 0xBB, 0xFD, 0x55, 0x0A, 0xD3, 0xD9, 0xA3,
+    0xED, 0x2D, 0x4E, 0xEA, 0xA9, 0x66, 0xAE, 0x58, 0x27, 0x47, 0x2A, 0x73, 0x30, 0x56, 0xB8, 0x87,
+    0x8F, 0x1F, 0x73, 0x09, 0xBE,
+};
+
+static const uint32_t opendyslexic_12_boldBlockOffsets[33] = {
+    0, 1144, 2296, 3417, 4645, 5568, 6408, 7227,
+    8089, 8993, 9800, 10665, 11622, 12552, 13533, 14277,
+    15061, 16275, 17326, 18463, 19695, 20825, 21988, 23021,
+    24121, 25169, 26211, 27271, 28265, 29503, 30590, 31665,
+    31877,
+};
+
+static const uint16_t opendyslexic_12_boldDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_12_boldGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_12_boldPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
@@ -3915,703 +2170,703 @@ static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 15, 21, 18, 2, 19, 79, 1823 }, // 9
     { 7, 17, 7, 0, 17, 30, 1902 }, // :
     { 9, 21, 9, 0, 16, 48, 1932 }, // ;
-    { 20, 17, 19, -1, 17, 85, 1980 }, // <
-    { 15, 10, 15, 0, 12, 38, 2065 }, // =
-    { 19, 17, 20, 1, 17, 81, 2103 }, // >
-    { 16, 31, 17, 0, 28, 124, 2184 }, // ?
-    { 23, 24, 26, 0, 21, 138, 2308 }, // @
-    { 22, 21, 24, 1, 21, 116, 2446 }, // A
-    { 17, 21, 24, 4, 21, 90, 2562 }, // B
-    { 18, 23, 25, 3, 23, 104, 2652 }, // C
-    { 19, 21, 26, 4, 21, 100, 2756 }, // D
-    { 15, 21, 23, 4, 21, 79, 2856 }, // E
-    { 14, 22, 21, 4, 22, 77, 2935 }, // F
-    { 21, 22, 29, 4, 21, 116, 3012 }, // G
-    { 19, 21, 26, 4, 21, 100, 3128 }, // H
-    { 6, 21, 14, 4, 21, 32, 3228 }, // I
-    { 15, 27, 23, 4, 21, 102, 3260 }, // J
-    { 19, 21, 26, 4, 21, 100, 3362 }, // K
-    { 15, 21, 22, 4, 21, 79, 3462 }, // L
-    { 22, 21, 29, 4, 21, 116, 3541 }, // M
-    { 18, 21, 26, 4, 21, 95, 3657 }, // N
-    { 21, 24, 28, 4, 22, 126, 3752 }, // O
-    { 15, 22, 23, 4, 22, 83, 3878 }, // P
-    { 23, 27, 27, 2, 22, 156, 3961 }, // Q
-    { 17, 22, 24, 4, 21, 94, 4117 }, // R
-    { 19, 23, 27, 4, 21, 110, 4211 }, // S
-    { 19, 22, 26, 4, 22, 105, 4321 }, // T
-    { 18, 22, 26, 4, 21, 99, 4426 }, // U
-    { 21, 21, 28, 4, 21, 111, 4525 }, // V
-    { 28, 22, 36, 4, 22, 154, 4636 }, // W
-    { 20, 21, 28, 4, 21, 105, 4790 }, // X
-    { 19, 21, 27, 4, 21, 100, 4895 }, // Y
-    { 20, 21, 27, 4, 21, 105, 4995 }, // Z
-    { 10, 36, 12, 1, 27, 90, 5100 }, // [
-    { 10, 29, 12, 1, 22, 73, 5190 }, // <backslash>
-    { 10, 36, 12, 1, 27, 90, 5263 }, // ]
-    { 15, 7, 14, 0, 25, 27, 5353 }, // ^
-    { 19, 5, 17, -1, -1, 24, 5380 }, // _
-    { 11, 6, 11, 0, 20, 17, 5404 }, // `
-    { 15, 17, 21, 3, 16, 64, 5421 }, // a
-    { 16, 23, 22, 3, 22, 92, 5485 }, // b
-    { 13, 16, 20, 3, 16, 52, 5577 }, // c
-    { 16, 22, 22, 3, 21, 88, 5629 }, // d
-    { 15, 16, 21, 3, 15, 60, 5717 }, // e
-    { 11, 22, 17, 3, 22, 61, 5777 }, // f
-    { 15, 23, 22, 3, 15, 87, 5838 }, // g
-    { 16, 21, 22, 3, 21, 84, 5925 }, // h
-    { 6, 23, 12, 3, 23, 35, 6009 }, // i
-    { 10, 29, 16, 3, 22, 73, 6044 }, // j
-    { 16, 21, 23, 3, 21, 84, 6117 }, // k
-    { 9, 21, 15, 3, 21, 48, 6201 }, // l
-    { 24, 16, 31, 3, 16, 96, 6249 }, // m
-    { 15, 16, 22, 3, 16, 60, 6345 }, // n
-    { 15, 16, 22, 3, 15, 60, 6405 }, // o
-    { 17, 23, 23, 3, 15, 98, 6465 }, // p
-    { 18, 23, 24, 3, 16, 104, 6563 }, // q
-    { 12, 15, 18, 3, 15, 45, 6667 }, // r
-    { 15, 18, 22, 3, 16, 68, 6712 }, // s
-    { 13, 21, 20, 3, 20, 69, 6780 }, // t
-    { 15, 16, 21, 3, 15, 60, 6849 }, // u
-    { 18, 15, 25, 3, 15, 68, 6909 }, // v
-    { 21, 16, 28, 3, 15, 84, 6977 }, // w
-    { 18, 14, 25, 3, 14, 63, 7061 }, // x
-    { 17, 21, 23, 3, 14, 90, 7124 }, // y
-    { 16, 15, 22, 3, 15, 60, 7214 }, // z
-    { 12, 26, 14, 1, 20, 78, 7274 }, // {
-    { 5, 23, 10, 2, 18, 29, 7352 }, // |
-    { 12, 26, 14, 1, 20, 78, 7381 }, // }
-    { 10, 6, 12, 1, 20, 15, 7459 }, // ~
-    { 0, 0, 22, 0, 0, 0, 7474 }, //  
-    { 8, 32, 19, 5, 28, 64, 7474 }, // ¡
-    { 13, 24, 20, 3, 20, 78, 7538 }, // ¢
-    { 16, 23, 17, 1, 22, 92, 7616 }, // £
-    { 15, 15, 17, 1, 17, 57, 7708 }, // ¤
-    { 19, 22, 19, 0, 19, 105, 7765 }, // ¥
-    { 4, 22, 10, 2, 18, 22, 7870 }, // ¦
-    { 14, 23, 19, 2, 20, 81, 7892 }, // §
-    { 13, 6, 13, 0, 21, 20, 7973 }, // ¨
-    { 12, 11, 17, 2, 24, 33, 7993 }, // ©
-    { 9, 9, 16, 5, 19, 21, 8026 }, // ª
-    { 14, 14, 13, 0, 13, 49, 8047 }, // «
-    { 13, 9, 15, 1, 10, 30, 8096 }, // ¬
-    { 13, 3, 15, 1, 9, 10, 8126 }, // ­
-    { 12, 12, 17, 2, 28, 36, 8136 }, // ®
-    { 11, 4, 13, 1, 19, 11, 8172 }, // ¯
-    { 12, 11, 17, 2, 19, 33, 8183 }, // °
-    { 15, 16, 16, 0, 14, 60, 8216 }, // ±
-    { 8, 8, 8, 0, 20, 16, 8276 }, // ²
-    { 8, 10, 8, 0, 21, 20, 8292 }, // ³
-    { 7, 6, 7, 0, 19, 11, 8312 }, // ´
-    { 16, 19, 21, 2, 15, 76, 8323 }, // µ
-    { 14, 22, 19, 2, 18, 77, 8399 }, // ¶
-    { 6, 6, 7, 0, 12, 9, 8476 }, // ·
-    { 7, 8, 8, 1, 1, 14, 8485 }, // ¸
-    { 7, 9, 8, 0, 21, 16, 8499 }, // ¹
-    { 9, 8, 17, 5, 18, 18, 8515 }, // º
-    { 14, 14, 19, 2, 13, 49, 8533 }, // »
-    { 23, 23, 31, 4, 21, 133, 8582 }, // ¼
-    { 25, 23, 31, 4, 21, 144, 8715 }, // ½
-    { 23, 23, 31, 4, 21, 133, 8859 }, // ¾
-    { 16, 32, 17, 0, 18, 128, 8992 }, // ¿
-    { 22, 28, 24, 1, 28, 154, 9120 }, // À
-    { 22, 32, 24, 1, 32, 176, 9274 }, // Á
-    { 22, 30, 24, 1, 30, 165, 9450 }, // Â
-    { 22, 29, 24, 1, 29, 160, 9615 }, // Ã
-    { 22, 30, 24, 1, 30, 165, 9775 }, // Ä
-    { 22, 30, 24, 1, 30, 165, 9940 }, // Å
-    { 32, 22, 34, 1, 21, 176, 10105 }, // Æ
-    { 18, 30, 25, 3, 23, 135, 10281 }, // Ç
-    { 15, 29, 23, 4, 29, 109, 10416 }, // È
-    { 15, 33, 23, 4, 33, 124, 10525 }, // É
-    { 15, 31, 23, 4, 31, 117, 10649 }, // Ê
-    { 15, 31, 23, 4, 31, 117, 10766 }, // Ë
-    { 11, 30, 14, 0, 30, 83, 10883 }, // Ì
-    { 6, 34, 14, 4, 34, 51, 10966 }, // Í
-    { 14, 32, 14, 0, 32, 112, 11017 }, // Î
-    { 13, 32, 14, 0, 32, 104, 11129 }, // Ï
-    { 24, 21, 26, -1, 21, 126, 11233 }, // Ð
-    { 18, 29, 26, 4, 29, 131, 11359 }, // Ñ
-    { 21, 31, 28, 4, 29, 163, 11490 }, // Ò
-    { 21, 35, 28, 4, 33, 184, 11653 }, // Ó
-    { 21, 33, 28, 4, 31, 174, 11837 }, // Ô
-    { 21, 32, 28, 4, 30, 168, 12011 }, // Õ
-    { 21, 33, 28, 4, 31, 174, 12179 }, // Ö
-    { 15, 9, 15, 0, 11, 34, 12353 }, // ×
-    { 36, 50, 28, -4, 36, 450, 12387 }, // Ø
-    { 18, 31, 26, 4, 30, 140, 12837 }, // Ù
-    { 18, 35, 26, 4, 34, 158, 12977 }, // Ú
-    { 18, 33, 26, 4, 32, 149, 13135 }, // Û
-    { 18, 32, 26, 4, 31, 144, 13284 }, // Ü
-    { 19, 36, 27, 4, 36, 171, 13428 }, // Ý
-    { 12, 20, 14, 1, 20, 60, 13599 }, // Þ
-    { 15, 22, 17, 1, 20, 83, 13659 }, // ß
-    { 15, 23, 21, 3, 22, 87, 13742 }, // à
-    { 15, 27, 21, 3, 26, 102, 13829 }, // á
-    { 15, 25, 21, 3, 24, 94, 13931 }, // â
-    { 15, 23, 21, 3, 22, 87, 14025 }, // ã
-    { 15, 25, 21, 3, 24, 94, 14112 }, // ä
-    { 15, 25, 21, 3, 24, 94, 14206 }, // å
-    { 25, 17, 31, 3, 16, 107, 14300 }, // æ
-    { 13, 22, 20, 3, 16, 72, 14407 }, // ç
-    { 15, 26, 21, 3, 25, 98, 14479 }, // è
-    { 15, 31, 21, 3, 30, 117, 14577 }, // é
-    { 15, 28, 21, 3, 27, 105, 14694 }, // ê
-    { 15, 28, 21, 3, 27, 105, 14799 }, // ë
-    { 10, 22, 12, 0, 22, 55, 14904 }, // ì
-    { 6, 26, 12, 3, 26, 39, 14959 }, // í
-    { 14, 23, 12, -1, 23, 81, 14998 }, // î
-    { 12, 22, 12, 0, 22, 66, 15079 }, // ï
-    { 20, 22, 17, -1, 21, 110, 15145 }, // ð
-    { 15, 24, 22, 3, 24, 90, 15255 }, // ñ
-    { 15, 23, 22, 3, 22, 87, 15345 }, // ò
-    { 15, 27, 22, 3, 26, 102, 15432 }, // ó
-    { 15, 25, 22, 3, 24, 94, 15534 }, // ô
-    { 15, 24, 22, 3, 23, 90, 15628 }, // õ
-    { 15, 25, 22, 3, 24, 94, 15718 }, // ö
-    { 19, 18, 22, 2, 17, 86, 15812 }, // ÷
-    { 17, 44, 22, 2, 30, 187, 15898 }, // ø
-    { 15, 24, 21, 3, 23, 90, 16085 }, // ù
-    { 15, 28, 21, 3, 27, 105, 16175 }, // ú
-    { 15, 25, 21, 3, 24, 94, 16280 }, // û
-    { 15, 25, 21, 3, 24, 94, 16374 }, // ü
-    { 17, 36, 23, 3, 29, 153, 16468 }, // ý
-    { 12, 26, 14, 1, 21, 78, 16621 }, // þ
-    { 17, 33, 23, 3, 26, 141, 16699 }, // ÿ
-    { 22, 29, 24, 1, 29, 160, 16840 }, // Ā
-    { 15, 25, 21, 3, 24, 94, 17000 }, // ā
-    { 22, 30, 24, 1, 30, 165, 17094 }, // Ă
-    { 15, 25, 21, 3, 24, 94, 17259 }, // ă
-    { 22, 28, 24, 1, 21, 154, 17353 }, // Ą
-    { 17, 24, 21, 3, 16, 102, 17507 }, // ą
-    { 18, 31, 25, 3, 31, 140, 17609 }, // Ć
-    { 13, 21, 20, 3, 21, 69, 17749 }, // ć
-    { 18, 32, 25, 3, 32, 144, 17818 }, // Ĉ
-    { 14, 24, 20, 3, 24, 84, 17962 }, // ĉ
-    { 18, 31, 25, 3, 31, 140, 18046 }, // Ċ
-    { 13, 22, 20, 3, 22, 72, 18186 }, // ċ
-    { 18, 33, 25, 3, 33, 149, 18258 }, // Č
-    { 14, 24, 20, 3, 24, 84, 18407 }, // č
-    { 19, 31, 26, 4, 31, 148, 18491 }, // Ď
-    { 20, 22, 22, 3, 21, 110, 18639 }, // ď
-    { 24, 21, 26, -1, 21, 126, 18749 }, // Đ
-    { 20, 22, 22, 3, 21, 110, 18875 }, // đ
-    { 15, 30, 23, 4, 30, 113, 18985 }, // Ē
-    { 15, 28, 21, 3, 27, 105, 19098 }, // ē
-    { 15, 31, 23, 4, 31, 117, 19203 }, // Ĕ
-    { 15, 28, 21, 3, 27, 105, 19320 }, // ĕ
-    { 15, 31, 23, 4, 31, 117, 19425 }, // Ė
-    { 15, 28, 21, 3, 27, 105, 19542 }, // ė
-    { 15, 28, 23, 4, 21, 105, 19647 }, // Ę
-    { 15, 25, 21, 3, 15, 94, 19752 }, // ę
-    { 15, 33, 23, 4, 33, 124, 19846 }, // Ě
-    { 15, 30, 21, 3, 29, 113, 19970 }, // ě
-    { 21, 34, 29, 4, 33, 179, 20083 }, // Ĝ
-    { 16, 34, 22, 3, 26, 136, 20262 }, // ĝ
-    { 21, 33, 29, 4, 32, 174, 20398 }, // Ğ
-    { 15, 33, 22, 3, 25, 124, 20572 }, // ğ
-    { 21, 33, 29, 4, 32, 174, 20696 }, // Ġ
-    { 15, 33, 22, 3, 25, 124, 20870 }, // ġ
-    { 21, 38, 29, 4, 37, 200, 20994 }, // Ģ
-    { 15, 34, 22, 3, 26, 128, 21194 }, // ģ
-    { 19, 31, 26, 4, 31, 148, 21322 }, // Ĥ
-    { 19, 30, 22, 0, 30, 143, 21470 }, // ĥ
-    { 22, 21, 26, 2, 21, 116, 21613 }, // Ħ
-    { 19, 21, 22, 0, 21, 100, 21729 }, // ħ
-    { 11, 32, 14, 1, 32, 88, 21829 }, // Ĩ
-    { 10, 23, 12, 1, 23, 58, 21917 }, // ĩ
-    { 14, 31, 14, -1, 31, 109, 21975 }, // Ī
-    { 15, 23, 12, -2, 23, 87, 22084 }, // ī
-    { 8, 28, 14, 2, 21, 56, 22171 }, // Į
-    { 8, 31, 12, 2, 23, 62, 22227 }, // į
-    { 7, 32, 14, 3, 32, 56, 22289 }, // İ
-    { 6, 14, 12, 3, 14, 21, 22345 }, // ı
-    { 20, 31, 40, 9, 21, 155, 22366 }, // Ĳ
-    { 15, 30, 12, 3, 24, 113, 22521 }, // ĳ
-    { 17, 37, 23, 4, 31, 158, 22634 }, // Ĵ
-    { 14, 32, 16, 3, 25, 112, 22792 }, // ĵ
-    { 19, 34, 26, 4, 34, 162, 22904 }, // Ķ
-    { 16, 34, 23, 3, 21, 136, 23066 }, // ķ
-    { 12, 14, 16, 2, 14, 42, 23202 }, // ĸ
-    { 15, 28, 22, 4, 28, 105, 23244 }, // Ĺ
-    { 9, 32, 15, 3, 32, 72, 23349 }, // ĺ
-    { 17, 33, 22, 2, 33, 141, 23421 }, // Ļ
-    { 10, 35, 15, 2, 21, 88, 23562 }, // ļ
-    { 15, 21, 22, 4, 21, 79, 23650 }, // Ľ
-    { 12, 25, 15, 3, 25, 75, 23729 }, // ľ
-    { 15, 21, 22, 4, 21, 79, 23804 }, // Ŀ
-    { 12, 21, 15, 3, 21, 63, 23883 }, // ŀ
-    { 27, 37, 22, -7, 29, 250, 23946 }, // Ł
-    { 19, 21, 15, -5, 21, 100, 24196 }, // ł
-    { 18, 30, 26, 4, 30, 135, 24296 }, // Ń
-    { 15, 25, 22, 3, 25, 94, 24431 }, // ń
-    { 18, 31, 26, 4, 21, 140, 24525 }, // Ņ
-    { 15, 26, 22, 3, 16, 98, 24665 }, // ņ
-    { 18, 32, 26, 4, 32, 144, 24763 }, // Ň
-    { 16, 27, 22, 3, 27, 108, 24907 }, // ň
-    { 15, 26, 22, 3, 26, 98, 25015 }, // ŉ
-    { 18, 27, 26, 4, 21, 122, 25113 }, // Ŋ
-    { 15, 21, 22, 3, 16, 79, 25235 }, // ŋ
-    { 21, 32, 28, 4, 30, 168, 25314 }, // Ō
-    { 15, 25, 22, 3, 24, 94, 25482 }, // ō
-    { 21, 33, 28, 4, 31, 174, 25576 }, // Ŏ
-    { 15, 25, 22, 3, 24, 94, 25750 }, // ŏ
-    { 23, 32, 28, 4, 30, 184, 25844 }, // Ő
-    { 22, 24, 22, 1, 23, 132, 26028 }, // ő
-    { 29, 24, 30, 4, 22, 174, 26160 }, // Œ
-    { 26, 16, 27, 3, 15, 104, 26334 }, // œ
-    { 17, 30, 24, 4, 29, 128, 26438 }, // Ŕ
-    { 12, 22, 18, 3, 22, 66, 26566 }, // ŕ
-    { 17, 35, 24, 4, 34, 149, 26632 }, // Ŗ
-    { 12, 27, 18, 3, 27, 81, 26781 }, // ŗ
-    { 17, 32, 24, 4, 31, 136, 26862 }, // Ř
-    { 14, 24, 18, 1, 24, 84, 26998 }, // ř
-    { 19, 31, 27, 4, 29, 148, 27082 }, // Ś
-    { 15, 24, 22, 3, 22, 90, 27230 }, // ś
-    { 19, 32, 27, 4, 30, 152, 27320 }, // Ŝ
-    { 15, 26, 22, 3, 24, 98, 27472 }, // ŝ
-    { 19, 28, 27, 4, 21, 133, 27570 }, // Ş
-    { 15, 24, 22, 3, 16, 90, 27703 }, // ş
-    { 19, 33, 27, 4, 31, 157, 27793 }, // Š
-    { 15, 26, 22, 3, 24, 98, 27950 }, // š
-    { 19, 29, 26, 4, 22, 138, 28048 }, // Ţ
-    { 13, 26, 20, 3, 20, 85, 28186 }, // ţ
-    { 19, 32, 26, 4, 32, 152, 28271 }, // Ť
-    { 17, 24, 20, 3, 23, 102, 28423 }, // ť
-    { 19, 22, 26, 4, 22, 105, 28525 }, // Ŧ
-    { 14, 21, 20, 2, 20, 74, 28630 }, // ŧ
-    { 18, 33, 26, 4, 32, 149, 28704 }, // Ũ
-    { 15, 25, 21, 3, 24, 94, 28853 }, // ũ
-    { 18, 32, 26, 4, 31, 144, 28947 }, // Ū
-    { 15, 25, 21, 3, 24, 94, 29091 }, // ū
-    { 18, 32, 26, 4, 31, 144, 29185 }, // Ŭ
-    { 15, 25, 21, 3, 24, 94, 29329 }, // ŭ
-    { 18, 34, 26, 4, 33, 153, 29423 }, // Ů
-    { 15, 27, 21, 3, 26, 102, 29576 }, // ů
-    { 22, 31, 26, 3, 30, 171, 29678 }, // Ű
-    { 22, 24, 21, 1, 23, 132, 29849 }, // ű
-    { 18, 28, 26, 4, 21, 126, 29981 }, // Ų
-    { 15, 23, 21, 3, 15, 87, 30107 }, // ų
-    { 28, 31, 36, 4, 31, 217, 30194 }, // Ŵ
-    { 21, 27, 28, 3, 26, 142, 30411 }, // ŵ
-    { 19, 33, 27, 4, 33, 157, 30553 }, // Ŷ
-    { 17, 34, 23, 3, 27, 145, 30710 }, // ŷ
-    { 19, 33, 27, 4, 33, 157, 30855 }, // Ÿ
-    { 20, 28, 27, 4, 28, 140, 31012 }, // Ź
-    { 16, 24, 22, 3, 24, 96, 31152 }, // ź
-    { 20, 29, 27, 4, 29, 145, 31248 }, // Ż
-    { 16, 24, 22, 3, 24, 96, 31393 }, // ż
-    { 20, 31, 27, 4, 31, 155, 31489 }, // Ž
-    { 16, 26, 22, 3, 26, 104, 31644 }, // ž
-    { 10, 21, 15, 2, 21, 53, 31748 }, // ſ
-    { 11, 6, 0, 0, 20, 17, 31801 }, // ̀
-    { 7, 6, 0, 0, 19, 11, 31818 }, // ́
-    { 14, 7, 0, 0, 1, 25, 31829 }, // ̂
-    { 10, 6, 0, 1, 20, 15, 31854 }, // ̃
-    { 14, 4, 0, 1, 17, 14, 31869 }, // ̄
-    { 18, 4, 0, 0, 23, 18, 31883 }, // ̅
-    { 13, 5, 0, 0, 18, 17, 31901 }, // ̆
-    { 7, 6, 0, 3, 21, 11, 31918 }, // ̇
-    { 12, 5, 0, 0, 18, 15, 31929 }, // ̈
-    { 5, 6, 0, 5, 16, 8, 31944 }, // ̉
-    { 7, 7, 0, 1, 20, 13, 31952 }, // ̊
-    { 22, 6, 0, 0, 20, 33, 31965 }, // ̋
-    { 14, 7, 0, 0, 20, 25, 31998 }, // ̌
-    { 22, 6, 0, -6, 20, 33, 32023 }, // ̏
-    { 8, 9, 0, 0, 20, 18, 32056 }, // ̒
-    { 9, 9, 0, 0, 19, 21, 32074 }, // ̓
-    { 9, 9, 0, -1, 19, 21, 32095 }, // ̔
-    { 6, 7, 0, 1, 0, 11, 32116 }, // ̘
-    { 6, 7, 0, 1, 0, 11, 32127 }, // ̙
-    { 12, 8, 0, 1, 21, 24, 32138 }, // ̚
-    { 6, 8, 0, 0, 17, 12, 32162 }, // ̛
-    { 4, 8, 0, 1, 0, 8, 32174 }, // ̜
-    { 7, 6, 0, 1, 4, 11, 32182 }, // ̝
-    { 7, 6, 0, 1, 0, 11, 32193 }, // ̞
-    { 6, 6, 0, 1, -2, 9, 32204 }, // ̟
-    { 15, 4, 0, 0, -3, 15, 32213 }, // ̠
-    { 7, 6, 0, 0, 2, 11, 32228 }, // ̣
-    { 12, 5, 0, 0, -2, 15, 32239 }, // ̤
-    { 7, 7, 0, 1, 20, 13, 32254 }, // ̥
-    { 8, 9, 0, 0, 4, 18, 32267 }, // ̦
-    { 7, 8, 0, 1, 1, 14, 32285 }, // ̧
-    { 8, 9, 0, 1, 1, 18, 32299 }, // ̨
-    { 5, 9, 0, 1, 0, 12, 32317 }, // ̩
-    { 11, 6, 0, 0, 0, 17, 32329 }, // ̪
-    { 16, 8, 0, -1, 1, 32, 32346 }, // ̬
-    { 16, 8, 0, -1, 1, 32, 32378 }, // ̭
-    { 11, 6, 0, 1, 21, 17, 32410 }, // ̰
-    { 13, 4, 0, 1, 21, 13, 32427 }, // ̱
-    { 13, 4, 0, 0, -1, 13, 32440 }, // ̲
-    { 11, 6, 0, 1, 21, 17, 32453 }, // ̴
-    { 14, 3, 0, 0, 9, 11, 32470 }, // ̵
-    { 5, 8, 0, 1, 0, 10, 32481 }, // ̹
-    { 11, 8, 0, 0, 1, 22, 32491 }, // ̺
-    { 10, 8, 0, 0, 1, 20, 32513 }, // ̻
-    { 9, 7, 0, 1, 1, 16, 32533 }, // ̼
-    { 8, 6, 0, 2, 19, 12, 32549 }, // ̽
-    { 10, 6, 0, 1, 20, 15, 32561 }, // ͂
-    { 5, 7, 0, 6, 22, 9, 32576 }, // ̓
-    { 12, 19, 0, 1, 32, 57, 32585 }, // ̈́
-    { 11, 7, 0, 0, 21, 20, 32642 }, // ͆
-    { 15, 10, 0, 0, 0, 38, 32662 }, // ͇
-    { 11, 8, 0, 1, 1, 22, 32700 }, // ͈
-    { 9, 8, 0, 1, -1, 18, 32722 }, // ͉
-    { 13, 19, 0, 1, 26, 62, 32740 }, // ͊
-    { 22, 19, 0, 1, 29, 105, 32802 }, // ͋
-    { 15, 14, 0, 10, 14, 53, 32907 }, // ͌
-    { 13, 6, 0, 2, -3, 20, 32960 }, // ͍
-    { 5, 4, 0, 1, 3, 5, 32980 }, // ͎
-    { 22, 7, 0, 1, 1, 39, 32985 }, // ͜
-    { 22, 7, 0, 1, 20, 39, 33024 }, // ͡
-    { 27, 8, 0, 1, -1, 54, 33063 }, // ͢
-    { 16, 30, 22, 3, 30, 120, 33117 }, // Ѐ
-    { 15, 31, 23, 4, 31, 117, 33237 }, // Ё
-    { 21, 23, 17, -3, 22, 121, 33354 }, // Ђ
-    { 15, 29, 16, 1, 28, 109, 33475 }, // Ѓ
-    { 19, 22, 21, 1, 20, 105, 33584 }, // Є
-    { 19, 23, 27, 4, 21, 110, 33689 }, // Ѕ
-    { 6, 21, 14, 4, 21, 32, 33799 }, // І
-    { 11, 30, 14, 1, 30, 83, 33831 }, // Ї
-    { 15, 27, 23, 4, 21, 102, 33914 }, // Ј
-    { 25, 21, 29, 2, 19, 132, 34016 }, // Љ
-    { 24, 20, 15, -5, 19, 120, 34148 }, // Њ
-    { 22, 23, 26, 4, 23, 127, 34268 }, // Ћ
-    { 19, 28, 26, 4, 28, 133, 34395 }, // Ќ
-    { 18, 32, 26, 4, 32, 144, 34528 }, // Ѝ
-    { 17, 32, 20, 1, 29, 136, 34672 }, // Ў
-    { 16, 25, 20, 2, 19, 100, 34808 }, // Џ
-    { 22, 21, 24, 1, 21, 116, 34908 }, // А
-    { 14, 19, 16, 1, 19, 67, 35024 }, // Б
-    { 15, 20, 17, 1, 19, 75, 35091 }, // В
-    { 15, 20, 16, 1, 19, 75, 35166 }, // Г
-    { 19, 23, 21, 1, 19, 110, 35241 }, // Д
-    { 16, 21, 22, 3, 21, 84, 35351 }, // Е
-    { 31, 21, 28, -1, 21, 163, 35435 }, // Ж
-    { 13, 19, 16, 1, 18, 62, 35598 }, // З
-    { 18, 21, 26, 4, 21, 95, 35660 }, // И
-    { 18, 32, 26, 4, 32, 144, 35755 }, // Й
-    { 19, 21, 26, 4, 21, 100, 35899 }, // К
-    { 16, 21, 15, -1, 19, 84, 35999 }, // Л
-    { 19, 20, 21, 1, 19, 95, 36083 }, // М
-    { 19, 21, 26, 4, 21, 100, 36178 }, // Н
-    { 21, 24, 28, 4, 22, 126, 36278 }, // О
-    { 15, 21, 17, 1, 20, 79, 36404 }, // П
-    { 15, 22, 23, 4, 22, 83, 36483 }, // Р
-    { 18, 23, 25, 3, 23, 104, 36566 }, // С
-    { 19, 22, 26, 4, 22, 105, 36670 }, // Т
-    { 17, 22, 20, 1, 19, 94, 36775 }, // У
-    { 19, 19, 22, 1, 19, 91, 36869 }, // Ф
-    { 20, 21, 28, 4, 21, 105, 36960 }, // Х
-    { 16, 24, 18, 1, 19, 96, 37065 }, // Ц
-    { 14, 19, 17, 1, 19, 67, 37161 }, // Ч
-    { 18, 20, 20, 1, 19, 90, 37228 }, // Ш
-    { 21, 25, 23, 1, 20, 132, 37318 }, // Щ
-    { 19, 18, 16, -5, 18, 86, 37450 }, // Ъ
-    { 25, 21, 29, 1, 21, 132, 37536 }, // Ы
-    { 13, 19, 16, 1, 19, 62, 37668 }, // Ь
-    { 19, 22, 21, 1, 20, 105, 37730 }, // Э
-    { 21, 19, 23, 1, 19, 100, 37835 }, // Ю
-    { 17, 22, 24, 4, 21, 94, 37935 }, // Я
-    { 15, 17, 21, 3, 16, 64, 38029 }, // а
-    { 16, 23, 17, 1, 22, 92, 38093 }, // б
-    { 12, 15, 18, 3, 15, 45, 38185 }, // в
-    { 13, 16, 15, 1, 15, 52, 38230 }, // г
-    { 17, 19, 19, 1, 15, 81, 38282 }, // д
-    { 15, 16, 21, 3, 15, 60, 38363 }, // е
-    { 29, 18, 35, 3, 18, 131, 38423 }, // ж
-    { 9, 13, 11, 1, 13, 30, 38554 }, // з
-    { 15, 16, 17, 1, 15, 60, 38584 }, // и
-    { 14, 24, 17, 1, 24, 84, 38644 }, // й
-    { 15, 14, 20, 3, 14, 53, 38728 }, // к
-    { 12, 15, 10, -1, 13, 45, 38781 }, // л
-    { 17, 16, 21, 2, 16, 68, 38826 }, // м
-    { 15, 16, 21, 3, 16, 60, 38894 }, // н
-    { 15, 16, 22, 3, 15, 60, 38954 }, // о
-    { 15, 16, 17, 1, 15, 60, 39014 }, // п
-    { 17, 23, 23, 3, 15, 98, 39074 }, // р
-    { 13, 16, 20, 3, 16, 52, 39172 }, // с
-    { 15, 16, 17, 1, 15, 60, 39224 }, // т
-    { 17, 21, 23, 3, 14, 90, 39284 }, // у
-    { 20, 21, 22, 1, 15, 105, 39374 }, // ф
-    { 18, 16, 18, 0, 15, 72, 39479 }, // х
-    { 16, 19, 18, 1, 15, 76, 39551 }, // ц
-    { 10, 13, 11, 1, 13, 33, 39627 }, // ч
-    { 18, 16, 20, 1, 15, 72, 39660 }, // ш
-    { 21, 20, 22, 1, 15, 105, 39732 }, // щ
-    { 15, 14, 12, -4, 14, 53, 39837 }, // ъ
-    { 19, 16, 22, 0, 16, 76, 39890 }, // ы
-    { 11, 14, 12, 0, 14, 39, 39966 }, // ь
-    { 14, 14, 16, 1, 14, 49, 40005 }, // э
-    { 16, 15, 18, 1, 15, 60, 40054 }, // ю
-    { 15, 16, 21, 3, 16, 60, 40114 }, // я
-    { 15, 28, 21, 3, 27, 105, 40174 }, // ѐ
-    { 15, 27, 21, 3, 26, 102, 40279 }, // ё
-    { 20, 24, 22, 0, 21, 120, 40381 }, // ђ
-    { 13, 23, 15, 1, 22, 75, 40501 }, // ѓ
-    { 14, 16, 14, 0, 14, 56, 40576 }, // є
-    { 15, 18, 22, 3, 16, 68, 40632 }, // ѕ
-    { 6, 23, 12, 3, 23, 35, 40700 }, // і
-    { 12, 22, 12, 0, 22, 66, 40735 }, // ї
-    { 10, 29, 16, 3, 22, 73, 40801 }, // ј
-    { 18, 15, 20, 1, 13, 68, 40874 }, // љ
-    { 16, 15, 10, -3, 14, 60, 40942 }, // њ
-    { 19, 21, 22, 0, 21, 100, 41002 }, // ћ
-    { 15, 21, 20, 3, 21, 79, 41102 }, // ќ
-    { 15, 25, 17, 1, 24, 94, 41181 }, // ѝ
-    { 17, 33, 23, 3, 26, 141, 41275 }, // ў
-    { 12, 18, 15, 1, 13, 54, 41416 }, // џ
-    { 18, 21, 19, 0, 19, 95, 41470 }, // Ѣ
-    { 17, 21, 16, -1, 19, 90, 41565 }, // ѣ
-    { 23, 21, 22, -1, 20, 121, 41655 }, // Ѫ
-    { 17, 14, 15, -1, 13, 60, 41776 }, // ѫ
-    { 20, 27, 28, 4, 26, 135, 41836 }, // Ѳ
-    { 16, 22, 22, 3, 21, 88, 41971 }, // ѳ
-    { 24, 26, 28, 4, 26, 156, 42059 }, // Ѵ
-    { 18, 19, 22, 2, 19, 86, 42215 }, // ѵ
-    { 11, 9, 0, 2, 24, 25, 42301 }, // ҆
-    { 15, 23, 16, 1, 22, 87, 42326 }, // Ґ
-    { 13, 20, 15, 1, 19, 65, 42413 }, // ґ
-    { 18, 20, 16, -2, 19, 90, 42478 }, // Ғ
-    { 12, 14, 11, -1, 13, 42, 42568 }, // ғ
-    { 16, 23, 15, -1, 22, 92, 42610 }, // Ҕ
-    { 10, 15, 9, 0, 13, 38, 42702 }, // ҕ
-    { 33, 26, 37, 2, 21, 215, 42740 }, // Җ
-    { 23, 18, 25, 1, 15, 104, 42955 }, // җ
-    { 13, 23, 16, 1, 18, 75, 43059 }, // Ҙ
-    { 9, 20, 11, 1, 13, 45, 43134 }, // ҙ
-    { 20, 25, 18, 2, 21, 125, 43179 }, // Қ
-    { 15, 18, 13, 1, 15, 68, 43304 }, // қ
-    { 25, 20, 27, 1, 19, 125, 43372 }, // Ҝ
-    { 17, 15, 19, 1, 14, 64, 43497 }, // ҝ
-    { 19, 21, 26, 4, 21, 100, 43561 }, // Ҟ
-    { 18, 21, 23, 1, 21, 95, 43661 }, // ҟ
-    { 23, 21, 26, 0, 21, 121, 43756 }, // Ҡ
-    { 16, 15, 18, 0, 15, 60, 43877 }, // ҡ
-    { 20, 24, 19, 0, 21, 120, 43937 }, // Ң
-    { 14, 17, 13, 0, 15, 60, 44057 }, // ң
-    { 27, 21, 26, 4, 21, 142, 44117 }, // Ҥ
-    { 20, 15, 18, 2, 15, 75, 44259 }, // ҥ
-    { 26, 22, 32, 3, 21, 143, 44334 }, // Ҧ
-    { 24, 25, 32, 3, 17, 150, 44477 }, // ҧ
-    { 25, 21, 17, -4, 19, 132, 44627 }, // Ҩ
-    { 20, 18, 14, -3, 16, 90, 44759 }, // ҩ
-    { 18, 27, 25, 3, 23, 122, 44849 }, // Ҫ
-    { 13, 19, 20, 3, 16, 62, 44971 }, // ҫ
-    { 19, 24, 19, 1, 21, 114, 45033 }, // Ҭ
-    { 14, 18, 13, 0, 15, 63, 45147 }, // ҭ
-    { 19, 21, 27, 4, 21, 100, 45210 }, // Ү
-    { 15, 20, 19, 2, 14, 75, 45310 }, // ү
-    { 19, 21, 27, 4, 21, 100, 45385 }, // Ұ
-    { 17, 20, 19, 1, 14, 85, 45485 }, // ұ
-    { 21, 25, 20, 3, 21, 132, 45570 }, // Ҳ
-    { 15, 17, 14, 2, 15, 64, 45702 }, // ҳ
-    { 23, 24, 15, -4, 19, 138, 45766 }, // Ҵ
-    { 17, 18, 11, -3, 13, 77, 45904 }, // ҵ
-    { 17, 24, 17, 0, 18, 102, 45981 }, // Ҷ
-    { 12, 18, 12, 0, 13, 54, 46083 }, // ҷ
-    { 14, 19, 17, 1, 19, 67, 46137 }, // Ҹ
-    { 10, 13, 11, 1, 13, 33, 46204 }, // ҹ
-    { 15, 22, 17, 1, 21, 83, 46237 }, // Һ
-    { 16, 21, 22, 3, 21, 84, 46320 }, // һ
-    { 28, 21, 24, -5, 20, 147, 46404 }, // Ҽ
-    { 20, 14, 17, -4, 13, 70, 46551 }, // ҽ
-    { 28, 25, 22, -4, 20, 175, 46621 }, // Ҿ
-    { 21, 17, 16, -3, 13, 90, 46796 }, // ҿ
-    { 6, 21, 14, 4, 21, 32, 46886 }, // Ӏ
-    { 31, 34, 28, -1, 34, 264, 46918 }, // Ӂ
-    { 29, 29, 35, 3, 29, 211, 47182 }, // ӂ
-    { 16, 26, 18, 1, 19, 104, 47393 }, // Ӄ
-    { 11, 19, 12, 1, 13, 53, 47497 }, // ӄ
-    { 19, 25, 15, -1, 19, 119, 47550 }, // Ӆ
-    { 13, 17, 10, -1, 13, 56, 47669 }, // ӆ
-    { 20, 28, 26, 4, 21, 140, 47725 }, // Ӈ
-    { 15, 20, 18, 2, 15, 75, 47865 }, // ӈ
-    { 20, 29, 26, 4, 21, 145, 47940 }, // Ӊ
-    { 15, 21, 18, 2, 15, 79, 48085 }, // ӊ
-    { 15, 24, 17, 1, 18, 90, 48164 }, // Ӌ
-    { 10, 17, 15, 3, 13, 43, 48254 }, // ӌ
-    { 24, 30, 29, 4, 21, 180, 48297 }, // Ӎ
-    { 17, 21, 20, 2, 15, 90, 48477 }, // ӎ
-    { 5, 19, 15, 5, 18, 24, 48567 }, // ӏ
-    { 22, 29, 24, 1, 29, 160, 48591 }, // Ӑ
-    { 15, 24, 21, 3, 23, 90, 48751 }, // ӑ
-    { 22, 28, 24, 1, 28, 154, 48841 }, // Ӓ
-    { 15, 24, 21, 3, 23, 90, 48995 }, // ӓ
-    { 32, 22, 34, 1, 21, 176, 49085 }, // Ӕ
-    { 25, 17, 31, 3, 16, 107, 49261 }, // ӕ
-    { 16, 30, 22, 3, 30, 120, 49368 }, // Ӗ
-    { 15, 27, 21, 3, 26, 102, 49488 }, // ӗ
-    { 18, 21, 27, 5, 19, 95, 49590 }, // Ә
-    { 15, 17, 21, 4, 16, 64, 49685 }, // ә
-    { 18, 29, 27, 5, 27, 131, 49749 }, // Ӛ
-    { 15, 21, 21, 4, 16, 79, 49880 }, // ӛ
-    { 31, 32, 35, 2, 32, 248, 49959 }, // Ӝ
-    { 29, 28, 35, 3, 28, 203, 50207 }, // ӝ
-    { 13, 30, 16, 1, 29, 98, 50410 }, // Ӟ
-    { 12, 20, 11, -1, 20, 60, 50508 }, // ӟ
-    { 13, 21, 17, 2, 19, 69, 50568 }, // Ӡ
-    { 13, 20, 17, 2, 14, 65, 50637 }, // ӡ
-    { 18, 32, 26, 4, 32, 144, 50702 }, // Ӣ
-    { 15, 24, 17, 1, 23, 90, 50846 }, // ӣ
-    { 18, 31, 26, 4, 31, 140, 50936 }, // Ӥ
-    { 15, 23, 17, 1, 22, 87, 51076 }, // ӥ
-    { 21, 31, 28, 4, 29, 163, 51163 }, // Ӧ
-    { 16, 26, 22, 2, 25, 104, 51326 }, // ӧ
-    { 19, 20, 28, 4, 19, 95, 51430 }, // Ө
-    { 15, 16, 22, 3, 15, 60, 51525 }, // ө
-    { 19, 28, 28, 4, 27, 133, 51585 }, // Ӫ
-    { 15, 23, 22, 3, 22, 87, 51718 }, // ӫ
-    { 19, 32, 21, 1, 30, 152, 51805 }, // Ӭ
-    { 14, 20, 16, 1, 20, 70, 51957 }, // ӭ
-    { 17, 33, 20, 1, 30, 141, 52027 }, // Ӯ
-    { 17, 33, 23, 3, 26, 141, 52168 }, // ӯ
-    { 17, 32, 20, 1, 29, 136, 52309 }, // Ӱ
-    { 17, 32, 23, 3, 25, 136, 52445 }, // ӱ
-    { 22, 32, 20, 1, 29, 176, 52581 }, // Ӳ
-    { 22, 32, 23, 3, 25, 176, 52757 }, // ӳ
-    { 14, 25, 17, 1, 25, 88, 52933 }, // Ӵ
-    { 12, 19, 11, 0, 19, 57, 53021 }, // ӵ
-    { 15, 23, 16, 1, 19, 87, 53078 }, // Ӷ
-    { 11, 16, 11, 0, 13, 44, 53165 }, // ӷ
-    { 25, 32, 29, 1, 32, 200, 53209 }, // Ӹ
-    { 19, 26, 22, 0, 26, 124, 53409 }, // ӹ
-    { 23, 24, 28, 4, 21, 138, 53533 }, // Ӽ
-    { 17, 17, 19, 2, 15, 73, 53671 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 53744 }, //  
-    { 0, 0, 29, 0, 0, 0, 53744 }, //  
-    { 0, 0, 17, 0, 0, 0, 53744 }, //  
-    { 0, 0, 29, 0, 0, 0, 53744 }, //  
-    { 0, 0, 12, 0, 0, 0, 53744 }, //  
-    { 0, 0, 10, 0, 0, 0, 53744 }, //  
-    { 0, 0, 8, 0, 0, 0, 53744 }, //  
-    { 0, 0, 18, 0, 0, 0, 53744 }, //  
-    { 0, 0, 7, 0, 0, 0, 53744 }, //  
-    { 0, 0, 9, 0, 0, 0, 53744 }, //  
-    { 0, 0, 8, 0, 0, 0, 53744 }, //  
-    { 0, 0, 4, 0, 0, 0, 53744 }, // ​
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 53744 }, // ‏
-    { 14, 3, 14, 0, 9, 11, 53744 }, // ‐
-    { 14, 3, 14, 0, 9, 11, 53755 }, // ‑
-    { 20, 3, 14, -3, 9, 15, 53766 }, // ‒
-    { 18, 5, 20, 1, 10, 23, 53781 }, // –
-    { 26, 5, 29, 1, 10, 33, 53804 }, // —
-    { 26, 5, 29, 1, 10, 33, 53837 }, // ―
-    { 13, 23, 14, 2, 18, 75, 53870 }, // ‖
-    { 21, 8, 14, -4, -2, 42, 53945 }, // ‗
-    { 9, 9, 11, 1, 22, 21, 53987 }, // ‘
-    { 9, 9, 11, 1, 22, 21, 54008 }, // ’
-    { 8, 9, 8, 0, 4, 18, 54029 }, // ‚
-    { 9, 9, 11, 1, 22, 21, 54047 }, // ‛
-    { 17, 9, 19, 1, 22, 39, 54068 }, // “
-    { 17, 9, 19, 1, 22, 39, 54107 }, // ”
-    { 8, 9, 8, 0, 4, 18, 54146 }, // „
-    { 17, 9, 19, 1, 22, 39, 54164 }, // ‟
-    { 16, 35, 20, 2, 26, 140, 54203 }, // †
-    { 15, 35, 22, 4, 26, 132, 54343 }, // ‡
-    { 20, 19, 13, -4, 22, 95, 54475 }, // •
-    { 9, 9, 15, 3, 11, 21, 54570 }, // ‣
-    { 7, 6, 15, 4, 6, 11, 54591 }, // ․
-    { 7, 6, 15, 4, 6, 11, 54602 }, // ‥
-    { 24, 6, 24, 0, 6, 36, 54613 }, // …
-    { 4, 3, 14, 5, 9, 3, 54649 }, // ‧
-    { 0, 0, 28, 0, 0, 0, 54652 }, //  
-    { 19, 22, 28, 5, 20, 105, 54652 }, // ‰
-    { 9, 9, 14, 4, 22, 21, 54757 }, // ′
-    { 17, 9, 20, 4, 22, 39, 54778 }, // ″
-    { 20, 8, 10, 1, 21, 40, 54817 }, // ‴
-    { 7, 8, 10, 2, 21, 14, 54857 }, // ‵
-    { 12, 8, 10, 0, 21, 24, 54871 }, // ‶
-    { 20, 8, 10, -5, 21, 40, 54895 }, // ‷
-    { 14, 6, 16, 1, 21, 21, 54935 }, // ‸
-    { 8, 14, 10, 1, 14, 28, 54956 }, // ‹
-    { 8, 14, 10, 1, 14, 28, 54984 }, // ›
-    { 28, 32, 34, 4, 25, 224, 55012 }, // ※
-    { 8, 32, 15, 3, 28, 64, 55236 }, // ‼
-    { 16, 40, 22, 2, 34, 160, 55300 }, // ‽
-    { 14, 3, 14, 0, 21, 11, 55460 }, // ‾
-    { 13, 5, 14, 0, 17, 17, 55471 }, // ‿
-    { 18, 17, 16, -1, 23, 77, 55488 }, // ⁂
-    { 17, 22, 31, 7, 20, 94, 55565 }, // ⁄
-    { 31, 31, 38, 3, 28, 241, 55659 }, // ⁇
-    { 26, 32, 30, 2, 28, 208, 55900 }, // ⁈
-    { 21, 32, 19, -1, 28, 168, 56108 }, // ⁉
-    { 19, 44, 23, 2, 30, 209, 56276 }, // ⁒
-    { 0, 0, 117, 0, 0, 0, 56485 }, //  
-    { 8, 10, 8, 0, 21, 20, 56485 }, // ⁰
-    { 8, 9, 9, 0, 21, 18, 56505 }, // ⁴
-    { 7, 11, 9, 1, 22, 20, 56523 }, // ⁵
-    { 7, 10, 9, 1, 21, 18, 56543 }, // ⁶
-    { 7, 11, 9, 1, 22, 20, 56561 }, // ⁷
-    { 9, 11, 9, 0, 21, 25, 56581 }, // ⁸
-    { 8, 11, 9, 0, 21, 22, 56606 }, // ⁹
-    { 15, 16, 22, 3, 16, 60, 56628 }, // ⁿ
-    { 7, 10, 9, 1, 6, 18, 56688 }, // ₀
-    { 7, 11, 8, 1, 6, 20, 56706 }, // ₁
-    { 7, 11, 9, 1, 6, 20, 56726 }, // ₂
-    { 7, 10, 9, 1, 6, 18, 56746 }, // ₃
-    { 8, 10, 9, 1, 6, 20, 56764 }, // ₄
-    { 7, 10, 8, 1, 6, 18, 56784 }, // ₅
-    { 7, 10, 9, 1, 6, 18, 56802 }, // ₆
-    { 7, 11, 9, 1, 6, 20, 56820 }, // ₇
-    { 9, 11, 9, 0, 6, 25, 56840 }, // ₈
-    { 8, 11, 9, 1, 6, 22, 56865 }, // ₉
-    { 11, 35, 12, 1, 26, 97, 56887 }, // ₍
-    { 11, 35, 11, -1, 26, 97, 56984 }, // ₎
-    { 18, 33, 25, 3, 28, 149, 57081 }, // ₡
-    { 18, 23, 25, 3, 23, 104, 57230 }, // ₢
-    { 17, 23, 17, 0, 22, 98, 57334 }, // ₤
-    { 27, 21, 26, -1, 21, 142, 57432 }, // ₦
-    { 22, 22, 23, 0, 22, 121, 57574 }, // ₧
-    { 27, 23, 33, 3, 21, 156, 57695 }, // ₨
-    { 21, 22, 21, 0, 22, 116, 57851 }, // ₩
-    { 20, 19, 27, 3, 19, 95, 57967 }, // ₪
-    { 19, 22, 13, -2, 21, 105, 58062 }, // ₫
-    { 18, 24, 19, 0, 20, 108, 58167 }, // €
-    { 19, 22, 26, 4, 22, 105, 58275 }, // ₮
-    { 25, 22, 16, -1, 22, 138, 58380 }, // ₱
-    { 21, 33, 29, 4, 28, 174, 58518 }, // ₲
-    { 25, 21, 26, 5, 19, 132, 58692 }, // ₴
-    { 13, 20, 15, 3, 18, 65, 58824 }, // ₵
-    { 20, 23, 26, 3, 23, 115, 58889 }, // ₸
-    { 13, 21, 17, 2, 20, 69, 59004 }, // ₹
-    { 15, 19, 17, 1, 17, 72, 59073 }, // ₺
-    { 18, 21, 20, 1, 20, 95, 59145 }, // ₼
-    { 21, 22, 23, -2, 22, 116, 59240 }, // ₽
-    { 17, 18, 18, 0, 15, 77, 59356 }, // ←
-    { 19, 18, 19, 0, 17, 86, 59433 }, // ↑
-    { 17, 18, 19, 1, 15, 77, 59519 }, // →
-    { 19, 17, 19, 0, 16, 81, 59596 }, // ↓
-    { 21, 15, 26, 2, 14, 79, 59677 }, // ↔
-    { 16, 20, 20, 2, 22, 80, 59756 }, // ↕
-    { 15, 14, 20, 2, 13, 53, 59836 }, // ↖
-    { 14, 14, 16, 1, 13, 49, 59889 }, // ↗
-    { 14, 14, 16, 1, 14, 49, 59938 }, // ↘
-    { 14, 14, 16, 1, 14, 49, 59987 }, // ↙
-    { 20, 18, 24, 2, 16, 90, 60036 }, // ⇐
-    { 22, 20, 27, 2, 19, 110, 60126 }, // ⇑
-    { 20, 18, 24, 2, 16, 90, 60236 }, // ⇒
-    { 22, 20, 27, 2, 18, 110, 60326 }, // ⇓
-    { 23, 18, 27, 2, 16, 104, 60436 }, // ⇔
-    { 18, 22, 22, 2, 13, 99, 60540 }, // ⇕
-    { 15, 22, 17, 1, 21, 83, 60639 }, // ∂
-    { 26, 26, 28, 1, 23, 169, 60722 }, // ∅
-    { 20, 20, 22, 1, 19, 100, 60891 }, // ∆
-    { 17, 20, 18, 1, 19, 85, 60991 }, // ∏
-    { 17, 19, 18, 1, 18, 81, 61076 }, // ∐
-    { 13, 20, 15, 1, 19, 65, 61157 }, // ∑
-    { 15, 4, 15, 0, 9, 15, 61222 }, // −
-    { 22, 23, 24, 1, 21, 127, 61237 }, // √
-    { 21, 14, 23, 1, 16, 74, 61364 }, // ∞
-    { 20, 27, 21, 1, 20, 135, 61438 }, // ∫
-    { 7, 17, 8, 1, 17, 30, 61573 }, // ∶
-    { 15, 14, 36, 10, 14, 53, 61603 }, // ≈
-    { 19, 22, 31, 6, 20, 105, 61656 }, // ≠
-    { 21, 21, 20, -1, 18, 111, 61761 }, // ≤
-    { 22, 22, 22, 0, 19, 121, 61872 }, // ≥
+    { 20, 17, 19, -1, 17, 85, 2048 }, // <
+    { 15, 10, 15, 0, 12, 38, 2133 }, // =
+    { 19, 17, 20, 1, 17, 81, 2171 }, // >
+    { 16, 31, 17, 0, 28, 124, 2252 }, // ?
+    { 23, 24, 26, 0, 21, 138, 2376 }, // @
+    { 22, 21, 24, 1, 21, 116, 2514 }, // A
+    { 17, 21, 24, 4, 21, 90, 2630 }, // B
+    { 18, 23, 25, 3, 23, 104, 2720 }, // C
+    { 19, 21, 26, 4, 21, 100, 2824 }, // D
+    { 15, 21, 23, 4, 21, 79, 2924 }, // E
+    { 14, 22, 21, 4, 22, 77, 3003 }, // F
+    { 21, 22, 29, 4, 21, 116, 3080 }, // G
+    { 19, 21, 26, 4, 21, 100, 3196 }, // H
+    { 6, 21, 14, 4, 21, 32, 3296 }, // I
+    { 15, 27, 23, 4, 21, 102, 3328 }, // J
+    { 19, 21, 26, 4, 21, 100, 3430 }, // K
+    { 15, 21, 22, 4, 21, 79, 3530 }, // L
+    { 22, 21, 29, 4, 21, 116, 3609 }, // M
+    { 18, 21, 26, 4, 21, 95, 3725 }, // N
+    { 21, 24, 28, 4, 22, 126, 3820 }, // O
+    { 15, 22, 23, 4, 22, 83, 3946 }, // P
+    { 23, 27, 27, 2, 22, 156, 4096 }, // Q
+    { 17, 22, 24, 4, 21, 94, 4252 }, // R
+    { 19, 23, 27, 4, 21, 110, 4346 }, // S
+    { 19, 22, 26, 4, 22, 105, 4456 }, // T
+    { 18, 22, 26, 4, 21, 99, 4561 }, // U
+    { 21, 21, 28, 4, 21, 111, 4660 }, // V
+    { 28, 22, 36, 4, 22, 154, 4771 }, // W
+    { 20, 21, 28, 4, 21, 105, 4925 }, // X
+    { 19, 21, 27, 4, 21, 100, 5030 }, // Y
+    { 20, 21, 27, 4, 21, 105, 5130 }, // Z
+    { 10, 36, 12, 1, 27, 90, 5235 }, // [
+    { 10, 29, 12, 1, 22, 73, 5325 }, // <backslash>
+    { 10, 36, 12, 1, 27, 90, 5398 }, // ]
+    { 15, 7, 14, 0, 25, 27, 5488 }, // ^
+    { 19, 5, 17, -1, -1, 24, 5515 }, // _
+    { 11, 6, 11, 0, 20, 17, 5539 }, // `
+    { 15, 17, 21, 3, 16, 64, 5556 }, // a
+    { 16, 23, 22, 3, 22, 92, 5620 }, // b
+    { 13, 16, 20, 3, 16, 52, 5712 }, // c
+    { 16, 22, 22, 3, 21, 88, 5764 }, // d
+    { 15, 16, 21, 3, 15, 60, 5852 }, // e
+    { 11, 22, 17, 3, 22, 61, 5912 }, // f
+    { 15, 23, 22, 3, 15, 87, 5973 }, // g
+    { 16, 21, 22, 3, 21, 84, 6060 }, // h
+    { 6, 23, 12, 3, 23, 35, 6144 }, // i
+    { 10, 29, 16, 3, 22, 73, 6179 }, // j
+    { 16, 21, 23, 3, 21, 84, 6252 }, // k
+    { 9, 21, 15, 3, 21, 48, 6336 }, // l
+    { 24, 16, 31, 3, 16, 96, 6384 }, // m
+    { 15, 16, 22, 3, 16, 60, 6480 }, // n
+    { 15, 16, 22, 3, 15, 60, 6540 }, // o
+    { 17, 23, 23, 3, 15, 98, 6600 }, // p
+    { 18, 23, 24, 3, 16, 104, 6698 }, // q
+    { 12, 15, 18, 3, 15, 45, 6802 }, // r
+    { 15, 18, 22, 3, 16, 68, 6847 }, // s
+    { 13, 21, 20, 3, 20, 69, 6915 }, // t
+    { 15, 16, 21, 3, 15, 60, 6984 }, // u
+    { 18, 15, 25, 3, 15, 68, 7044 }, // v
+    { 21, 16, 28, 3, 15, 84, 7112 }, // w
+    { 18, 14, 25, 3, 14, 63, 7196 }, // x
+    { 17, 21, 23, 3, 14, 90, 7259 }, // y
+    { 16, 15, 22, 3, 15, 60, 7349 }, // z
+    { 12, 26, 14, 1, 20, 78, 7409 }, // {
+    { 5, 23, 10, 2, 18, 29, 7487 }, // |
+    { 12, 26, 14, 1, 20, 78, 7516 }, // }
+    { 10, 6, 12, 1, 20, 15, 7594 }, // ~
+    { 0, 0, 22, 0, 0, 0, 7609 }, //  
+    { 8, 32, 19, 5, 28, 64, 7609 }, // ¡
+    { 13, 24, 20, 3, 20, 78, 7673 }, // ¢
+    { 16, 23, 17, 1, 22, 92, 7751 }, // £
+    { 15, 15, 17, 1, 17, 57, 7843 }, // ¤
+    { 19, 22, 19, 0, 19, 105, 7900 }, // ¥
+    { 4, 22, 10, 2, 18, 22, 8005 }, // ¦
+    { 14, 23, 19, 2, 20, 81, 8027 }, // §
+    { 13, 6, 13, 0, 21, 20, 8108 }, // ¨
+    { 12, 11, 17, 2, 24, 33, 8128 }, // ©
+    { 9, 9, 16, 5, 19, 21, 8161 }, // ª
+    { 14, 14, 13, 0, 13, 49, 8192 }, // «
+    { 13, 9, 15, 1, 10, 30, 8241 }, // ¬
+    { 13, 3, 15, 1, 9, 10, 8271 }, // ­
+    { 12, 12, 17, 2, 28, 36, 8281 }, // ®
+    { 11, 4, 13, 1, 19, 11, 8317 }, // ¯
+    { 12, 11, 17, 2, 19, 33, 8328 }, // °
+    { 15, 16, 16, 0, 14, 60, 8361 }, // ±
+    { 8, 8, 8, 0, 20, 16, 8421 }, // ²
+    { 8, 10, 8, 0, 21, 20, 8437 }, // ³
+    { 7, 6, 7, 0, 19, 11, 8457 }, // ´
+    { 16, 19, 21, 2, 15, 76, 8468 }, // µ
+    { 14, 22, 19, 2, 18, 77, 8544 }, // ¶
+    { 6, 6, 7, 0, 12, 9, 8621 }, // ·
+    { 7, 8, 8, 1, 1, 14, 8630 }, // ¸
+    { 7, 9, 8, 0, 21, 16, 8644 }, // ¹
+    { 9, 8, 17, 5, 18, 18, 8660 }, // º
+    { 14, 14, 19, 2, 13, 49, 8678 }, // »
+    { 23, 23, 31, 4, 21, 133, 8727 }, // ¼
+    { 25, 23, 31, 4, 21, 144, 8860 }, // ½
+    { 23, 23, 31, 4, 21, 133, 9004 }, // ¾
+    { 16, 32, 17, 0, 18, 128, 9137 }, // ¿
+    { 22, 28, 24, 1, 28, 154, 9265 }, // À
+    { 22, 32, 24, 1, 32, 176, 9419 }, // Á
+    { 22, 30, 24, 1, 30, 165, 9595 }, // Â
+    { 22, 29, 24, 1, 29, 160, 9760 }, // Ã
+    { 22, 30, 24, 1, 30, 165, 9920 }, // Ä
+    { 22, 30, 24, 1, 30, 165, 10240 }, // Å
+    { 32, 22, 34, 1, 21, 176, 10405 }, // Æ
+    { 18, 30, 25, 3, 23, 135, 10581 }, // Ç
+    { 15, 29, 23, 4, 29, 109, 10716 }, // È
+    { 15, 33, 23, 4, 33, 124, 10825 }, // É
+    { 15, 31, 23, 4, 31, 117, 10949 }, // Ê
+    { 15, 31, 23, 4, 31, 117, 11066 }, // Ë
+    { 11, 30, 14, 0, 30, 83, 11183 }, // Ì
+    { 6, 34, 14, 4, 34, 51, 11266 }, // Í
+    { 14, 32, 14, 0, 32, 112, 11317 }, // Î
+    { 13, 32, 14, 0, 32, 104, 11429 }, // Ï
+    { 24, 21, 26, -1, 21, 126, 11533 }, // Ð
+    { 18, 29, 26, 4, 29, 131, 11659 }, // Ñ
+    { 21, 31, 28, 4, 29, 163, 11790 }, // Ò
+    { 21, 35, 28, 4, 33, 184, 11953 }, // Ó
+    { 21, 33, 28, 4, 31, 174, 12288 }, // Ô
+    { 21, 32, 28, 4, 30, 168, 12462 }, // Õ
+    { 21, 33, 28, 4, 31, 174, 12630 }, // Ö
+    { 15, 9, 15, 0, 11, 34, 12804 }, // ×
+    { 36, 50, 28, -4, 36, 450, 12838 }, // Ø
+    { 18, 31, 26, 4, 30, 140, 13288 }, // Ù
+    { 18, 35, 26, 4, 34, 158, 13428 }, // Ú
+    { 18, 33, 26, 4, 32, 149, 13586 }, // Û
+    { 18, 32, 26, 4, 31, 144, 13735 }, // Ü
+    { 19, 36, 27, 4, 36, 171, 13879 }, // Ý
+    { 12, 20, 14, 1, 20, 60, 14050 }, // Þ
+    { 15, 22, 17, 1, 20, 83, 14110 }, // ß
+    { 15, 23, 21, 3, 22, 87, 14193 }, // à
+    { 15, 27, 21, 3, 26, 102, 14336 }, // á
+    { 15, 25, 21, 3, 24, 94, 14438 }, // â
+    { 15, 23, 21, 3, 22, 87, 14532 }, // ã
+    { 15, 25, 21, 3, 24, 94, 14619 }, // ä
+    { 15, 25, 21, 3, 24, 94, 14713 }, // å
+    { 25, 17, 31, 3, 16, 107, 14807 }, // æ
+    { 13, 22, 20, 3, 16, 72, 14914 }, // ç
+    { 15, 26, 21, 3, 25, 98, 14986 }, // è
+    { 15, 31, 21, 3, 30, 117, 15084 }, // é
+    { 15, 28, 21, 3, 27, 105, 15201 }, // ê
+    { 15, 28, 21, 3, 27, 105, 15306 }, // ë
+    { 10, 22, 12, 0, 22, 55, 15411 }, // ì
+    { 6, 26, 12, 3, 26, 39, 15466 }, // í
+    { 14, 23, 12, -1, 23, 81, 15505 }, // î
+    { 12, 22, 12, 0, 22, 66, 15586 }, // ï
+    { 20, 22, 17, -1, 21, 110, 15652 }, // ð
+    { 15, 24, 22, 3, 24, 90, 15762 }, // ñ
+    { 15, 23, 22, 3, 22, 87, 15852 }, // ò
+    { 15, 27, 22, 3, 26, 102, 15939 }, // ó
+    { 15, 25, 22, 3, 24, 94, 16041 }, // ô
+    { 15, 24, 22, 3, 23, 90, 16135 }, // õ
+    { 15, 25, 22, 3, 24, 94, 16225 }, // ö
+    { 19, 18, 22, 2, 17, 86, 16384 }, // ÷
+    { 17, 44, 22, 2, 30, 187, 16470 }, // ø
+    { 15, 24, 21, 3, 23, 90, 16657 }, // ù
+    { 15, 28, 21, 3, 27, 105, 16747 }, // ú
+    { 15, 25, 21, 3, 24, 94, 16852 }, // û
+    { 15, 25, 21, 3, 24, 94, 16946 }, // ü
+    { 17, 36, 23, 3, 29, 153, 17040 }, // ý
+    { 12, 26, 14, 1, 21, 78, 17193 }, // þ
+    { 17, 33, 23, 3, 26, 141, 17271 }, // ÿ
+    { 22, 29, 24, 1, 29, 160, 17412 }, // Ā
+    { 15, 25, 21, 3, 24, 94, 17572 }, // ā
+    { 22, 30, 24, 1, 30, 165, 17666 }, // Ă
+    { 15, 25, 21, 3, 24, 94, 17831 }, // ă
+    { 22, 28, 24, 1, 21, 154, 17925 }, // Ą
+    { 17, 24, 21, 3, 16, 102, 18079 }, // ą
+    { 18, 31, 25, 3, 31, 140, 18181 }, // Ć
+    { 13, 21, 20, 3, 21, 69, 18321 }, // ć
+    { 18, 32, 25, 3, 32, 144, 18432 }, // Ĉ
+    { 14, 24, 20, 3, 24, 84, 18576 }, // ĉ
+    { 18, 31, 25, 3, 31, 140, 18660 }, // Ċ
+    { 13, 22, 20, 3, 22, 72, 18800 }, // ċ
+    { 18, 33, 25, 3, 33, 149, 18872 }, // Č
+    { 14, 24, 20, 3, 24, 84, 19021 }, // č
+    { 19, 31, 26, 4, 31, 148, 19105 }, // Ď
+    { 20, 22, 22, 3, 21, 110, 19253 }, // ď
+    { 24, 21, 26, -1, 21, 126, 19363 }, // Đ
+    { 20, 22, 22, 3, 21, 110, 19489 }, // đ
+    { 15, 30, 23, 4, 30, 113, 19599 }, // Ē
+    { 15, 28, 21, 3, 27, 105, 19712 }, // ē
+    { 15, 31, 23, 4, 31, 117, 19817 }, // Ĕ
+    { 15, 28, 21, 3, 27, 105, 19934 }, // ĕ
+    { 15, 31, 23, 4, 31, 117, 20039 }, // Ė
+    { 15, 28, 21, 3, 27, 105, 20156 }, // ė
+    { 15, 28, 23, 4, 21, 105, 20261 }, // Ę
+    { 15, 25, 21, 3, 15, 94, 20366 }, // ę
+    { 15, 33, 23, 4, 33, 124, 20480 }, // Ě
+    { 15, 30, 21, 3, 29, 113, 20604 }, // ě
+    { 21, 34, 29, 4, 33, 179, 20717 }, // Ĝ
+    { 16, 34, 22, 3, 26, 136, 20896 }, // ĝ
+    { 21, 33, 29, 4, 32, 174, 21032 }, // Ğ
+    { 15, 33, 22, 3, 25, 124, 21206 }, // ğ
+    { 21, 33, 29, 4, 32, 174, 21330 }, // Ġ
+    { 15, 33, 22, 3, 25, 124, 21504 }, // ġ
+    { 21, 38, 29, 4, 37, 200, 21628 }, // Ģ
+    { 15, 34, 22, 3, 26, 128, 21828 }, // ģ
+    { 19, 31, 26, 4, 31, 148, 21956 }, // Ĥ
+    { 19, 30, 22, 0, 30, 143, 22104 }, // ĥ
+    { 22, 21, 26, 2, 21, 116, 22247 }, // Ħ
+    { 19, 21, 22, 0, 21, 100, 22363 }, // ħ
+    { 11, 32, 14, 1, 32, 88, 22528 }, // Ĩ
+    { 10, 23, 12, 1, 23, 58, 22616 }, // ĩ
+    { 14, 31, 14, -1, 31, 109, 22674 }, // Ī
+    { 15, 23, 12, -2, 23, 87, 22783 }, // ī
+    { 8, 28, 14, 2, 21, 56, 22870 }, // Į
+    { 8, 31, 12, 2, 23, 62, 22926 }, // į
+    { 7, 32, 14, 3, 32, 56, 22988 }, // İ
+    { 6, 14, 12, 3, 14, 21, 23044 }, // ı
+    { 20, 31, 40, 9, 21, 155, 23065 }, // Ĳ
+    { 15, 30, 12, 3, 24, 113, 23220 }, // ĳ
+    { 17, 37, 23, 4, 31, 158, 23333 }, // Ĵ
+    { 14, 32, 16, 3, 25, 112, 23491 }, // ĵ
+    { 19, 34, 26, 4, 34, 162, 23603 }, // Ķ
+    { 16, 34, 23, 3, 21, 136, 23765 }, // ķ
+    { 12, 14, 16, 2, 14, 42, 23901 }, // ĸ
+    { 15, 28, 22, 4, 28, 105, 23943 }, // Ĺ
+    { 9, 32, 15, 3, 32, 72, 24048 }, // ĺ
+    { 17, 33, 22, 2, 33, 141, 24120 }, // Ļ
+    { 10, 35, 15, 2, 21, 88, 24261 }, // ļ
+    { 15, 21, 22, 4, 21, 79, 24349 }, // Ľ
+    { 12, 25, 15, 3, 25, 75, 24428 }, // ľ
+    { 15, 21, 22, 4, 21, 79, 24576 }, // Ŀ
+    { 12, 21, 15, 3, 21, 63, 24655 }, // ŀ
+    { 27, 37, 22, -7, 29, 250, 24718 }, // Ł
+    { 19, 21, 15, -5, 21, 100, 24968 }, // ł
+    { 18, 30, 26, 4, 30, 135, 25068 }, // Ń
+    { 15, 25, 22, 3, 25, 94, 25203 }, // ń
+    { 18, 31, 26, 4, 21, 140, 25297 }, // Ņ
+    { 15, 26, 22, 3, 16, 98, 25437 }, // ņ
+    { 18, 32, 26, 4, 32, 144, 25535 }, // Ň
+    { 16, 27, 22, 3, 27, 108, 25679 }, // ň
+    { 15, 26, 22, 3, 26, 98, 25787 }, // ŉ
+    { 18, 27, 26, 4, 21, 122, 25885 }, // Ŋ
+    { 15, 21, 22, 3, 16, 79, 26007 }, // ŋ
+    { 21, 32, 28, 4, 30, 168, 26086 }, // Ō
+    { 15, 25, 22, 3, 24, 94, 26254 }, // ō
+    { 21, 33, 28, 4, 31, 174, 26348 }, // Ŏ
+    { 15, 25, 22, 3, 24, 94, 26522 }, // ŏ
+    { 23, 32, 28, 4, 30, 184, 26624 }, // Ő
+    { 22, 24, 22, 1, 23, 132, 26808 }, // ő
+    { 29, 24, 30, 4, 22, 174, 26940 }, // Œ
+    { 26, 16, 27, 3, 15, 104, 27114 }, // œ
+    { 17, 30, 24, 4, 29, 128, 27218 }, // Ŕ
+    { 12, 22, 18, 3, 22, 66, 27346 }, // ŕ
+    { 17, 35, 24, 4, 34, 149, 27412 }, // Ŗ
+    { 12, 27, 18, 3, 27, 81, 27561 }, // ŗ
+    { 17, 32, 24, 4, 31, 136, 27642 }, // Ř
+    { 14, 24, 18, 1, 24, 84, 27778 }, // ř
+    { 19, 31, 27, 4, 29, 148, 27862 }, // Ś
+    { 15, 24, 22, 3, 22, 90, 28010 }, // ś
+    { 19, 32, 27, 4, 30, 152, 28100 }, // Ŝ
+    { 15, 26, 22, 3, 24, 98, 28252 }, // ŝ
+    { 19, 28, 27, 4, 21, 133, 28350 }, // Ş
+    { 15, 24, 22, 3, 16, 90, 28483 }, // ş
+    { 19, 33, 27, 4, 31, 157, 28672 }, // Š
+    { 15, 26, 22, 3, 24, 98, 28829 }, // š
+    { 19, 29, 26, 4, 22, 138, 28927 }, // Ţ
+    { 13, 26, 20, 3, 20, 85, 29065 }, // ţ
+    { 19, 32, 26, 4, 32, 152, 29150 }, // Ť
+    { 17, 24, 20, 3, 23, 102, 29302 }, // ť
+    { 19, 22, 26, 4, 22, 105, 29404 }, // Ŧ
+    { 14, 21, 20, 2, 20, 74, 29509 }, // ŧ
+    { 18, 33, 26, 4, 32, 149, 29583 }, // Ũ
+    { 15, 25, 21, 3, 24, 94, 29732 }, // ũ
+    { 18, 32, 26, 4, 31, 144, 29826 }, // Ū
+    { 15, 25, 21, 3, 24, 94, 29970 }, // ū
+    { 18, 32, 26, 4, 31, 144, 30064 }, // Ŭ
+    { 15, 25, 21, 3, 24, 94, 30208 }, // ŭ
+    { 18, 34, 26, 4, 33, 153, 30302 }, // Ů
+    { 15, 27, 21, 3, 26, 102, 30455 }, // ů
+    { 22, 31, 26, 3, 30, 171, 30720 }, // Ű
+    { 22, 24, 21, 1, 23, 132, 30891 }, // ű
+    { 18, 28, 26, 4, 21, 126, 31023 }, // Ų
+    { 15, 23, 21, 3, 15, 87, 31149 }, // ų
+    { 28, 31, 36, 4, 31, 217, 31236 }, // Ŵ
+    { 21, 27, 28, 3, 26, 142, 31453 }, // ŵ
+    { 19, 33, 27, 4, 33, 157, 31595 }, // Ŷ
+    { 17, 34, 23, 3, 27, 145, 31752 }, // ŷ
+    { 19, 33, 27, 4, 33, 157, 31897 }, // Ÿ
+    { 20, 28, 27, 4, 28, 140, 32054 }, // Ź
+    { 16, 24, 22, 3, 24, 96, 32194 }, // ź
+    { 20, 29, 27, 4, 29, 145, 32290 }, // Ż
+    { 16, 24, 22, 3, 24, 96, 32435 }, // ż
+    { 20, 31, 27, 4, 31, 155, 32531 }, // Ž
+    { 16, 26, 22, 3, 26, 104, 32768 }, // ž
+    { 10, 21, 15, 2, 21, 53, 32872 }, // ſ
+    { 11, 6, 0, 0, 20, 17, 32925 }, // ̀
+    { 7, 6, 0, 0, 19, 11, 32942 }, // ́
+    { 14, 7, 0, 0, 1, 25, 32953 }, // ̂
+    { 10, 6, 0, 1, 20, 15, 32978 }, // ̃
+    { 14, 4, 0, 1, 17, 14, 32993 }, // ̄
+    { 18, 4, 0, 0, 23, 18, 33007 }, // ̅
+    { 13, 5, 0, 0, 18, 17, 33025 }, // ̆
+    { 7, 6, 0, 3, 21, 11, 33042 }, // ̇
+    { 12, 5, 0, 0, 18, 15, 33053 }, // ̈
+    { 5, 6, 0, 5, 16, 8, 33068 }, // ̉
+    { 7, 7, 0, 1, 20, 13, 33076 }, // ̊
+    { 22, 6, 0, 0, 20, 33, 33089 }, // ̋
+    { 14, 7, 0, 0, 20, 25, 33122 }, // ̌
+    { 22, 6, 0, -6, 20, 33, 33147 }, // ̏
+    { 8, 9, 0, 0, 20, 18, 33180 }, // ̒
+    { 9, 9, 0, 0, 19, 21, 33198 }, // ̓
+    { 9, 9, 0, -1, 19, 21, 33219 }, // ̔
+    { 6, 7, 0, 1, 0, 11, 33240 }, // ̘
+    { 6, 7, 0, 1, 0, 11, 33251 }, // ̙
+    { 12, 8, 0, 1, 21, 24, 33262 }, // ̚
+    { 6, 8, 0, 0, 17, 12, 33286 }, // ̛
+    { 4, 8, 0, 1, 0, 8, 33298 }, // ̜
+    { 7, 6, 0, 1, 4, 11, 33306 }, // ̝
+    { 7, 6, 0, 1, 0, 11, 33317 }, // ̞
+    { 6, 6, 0, 1, -2, 9, 33328 }, // ̟
+    { 15, 4, 0, 0, -3, 15, 33337 }, // ̠
+    { 7, 6, 0, 0, 2, 11, 33352 }, // ̣
+    { 12, 5, 0, 0, -2, 15, 33363 }, // ̤
+    { 7, 7, 0, 1, 20, 13, 33378 }, // ̥
+    { 8, 9, 0, 0, 4, 18, 33391 }, // ̦
+    { 7, 8, 0, 1, 1, 14, 33409 }, // ̧
+    { 8, 9, 0, 1, 1, 18, 33423 }, // ̨
+    { 5, 9, 0, 1, 0, 12, 33441 }, // ̩
+    { 11, 6, 0, 0, 0, 17, 33453 }, // ̪
+    { 16, 8, 0, -1, 1, 32, 33470 }, // ̬
+    { 16, 8, 0, -1, 1, 32, 33502 }, // ̭
+    { 11, 6, 0, 1, 21, 17, 33534 }, // ̰
+    { 13, 4, 0, 1, 21, 13, 33551 }, // ̱
+    { 13, 4, 0, 0, -1, 13, 33564 }, // ̲
+    { 11, 6, 0, 1, 21, 17, 33577 }, // ̴
+    { 14, 3, 0, 0, 9, 11, 33594 }, // ̵
+    { 5, 8, 0, 1, 0, 10, 33605 }, // ̹
+    { 11, 8, 0, 0, 1, 22, 33615 }, // ̺
+    { 10, 8, 0, 0, 1, 20, 33637 }, // ̻
+    { 9, 7, 0, 1, 1, 16, 33657 }, // ̼
+    { 8, 6, 0, 2, 19, 12, 33673 }, // ̽
+    { 10, 6, 0, 1, 20, 15, 33685 }, // ͂
+    { 5, 7, 0, 6, 22, 9, 33700 }, // ̓
+    { 12, 19, 0, 1, 32, 57, 33709 }, // ̈́
+    { 11, 7, 0, 0, 21, 20, 33766 }, // ͆
+    { 15, 10, 0, 0, 0, 38, 33786 }, // ͇
+    { 11, 8, 0, 1, 1, 22, 33824 }, // ͈
+    { 9, 8, 0, 1, -1, 18, 33846 }, // ͉
+    { 13, 19, 0, 1, 26, 62, 33864 }, // ͊
+    { 22, 19, 0, 1, 29, 105, 33926 }, // ͋
+    { 15, 14, 0, 10, 14, 53, 34031 }, // ͌
+    { 13, 6, 0, 2, -3, 20, 34084 }, // ͍
+    { 5, 4, 0, 1, 3, 5, 34104 }, // ͎
+    { 22, 7, 0, 1, 1, 39, 34109 }, // ͜
+    { 22, 7, 0, 1, 20, 39, 34148 }, // ͡
+    { 27, 8, 0, 1, -1, 54, 34187 }, // ͢
+    { 16, 30, 22, 3, 30, 120, 34241 }, // Ѐ
+    { 15, 31, 23, 4, 31, 117, 34361 }, // Ё
+    { 21, 23, 17, -3, 22, 121, 34478 }, // Ђ
+    { 15, 29, 16, 1, 28, 109, 34599 }, // Ѓ
+    { 19, 22, 21, 1, 20, 105, 34708 }, // Є
+    { 19, 23, 27, 4, 21, 110, 34816 }, // Ѕ
+    { 6, 21, 14, 4, 21, 32, 34926 }, // І
+    { 11, 30, 14, 1, 30, 83, 34958 }, // Ї
+    { 15, 27, 23, 4, 21, 102, 35041 }, // Ј
+    { 25, 21, 29, 2, 19, 132, 35143 }, // Љ
+    { 24, 20, 15, -5, 19, 120, 35275 }, // Њ
+    { 22, 23, 26, 4, 23, 127, 35395 }, // Ћ
+    { 19, 28, 26, 4, 28, 133, 35522 }, // Ќ
+    { 18, 32, 26, 4, 32, 144, 35655 }, // Ѝ
+    { 17, 32, 20, 1, 29, 136, 35799 }, // Ў
+    { 16, 25, 20, 2, 19, 100, 35935 }, // Џ
+    { 22, 21, 24, 1, 21, 116, 36035 }, // А
+    { 14, 19, 16, 1, 19, 67, 36151 }, // Б
+    { 15, 20, 17, 1, 19, 75, 36218 }, // В
+    { 15, 20, 16, 1, 19, 75, 36293 }, // Г
+    { 19, 23, 21, 1, 19, 110, 36368 }, // Д
+    { 16, 21, 22, 3, 21, 84, 36478 }, // Е
+    { 31, 21, 28, -1, 21, 163, 36562 }, // Ж
+    { 13, 19, 16, 1, 18, 62, 36725 }, // З
+    { 18, 21, 26, 4, 21, 95, 36864 }, // И
+    { 18, 32, 26, 4, 32, 144, 36959 }, // Й
+    { 19, 21, 26, 4, 21, 100, 37103 }, // К
+    { 16, 21, 15, -1, 19, 84, 37203 }, // Л
+    { 19, 20, 21, 1, 19, 95, 37287 }, // М
+    { 19, 21, 26, 4, 21, 100, 37382 }, // Н
+    { 21, 24, 28, 4, 22, 126, 37482 }, // О
+    { 15, 21, 17, 1, 20, 79, 37608 }, // П
+    { 15, 22, 23, 4, 22, 83, 37687 }, // Р
+    { 18, 23, 25, 3, 23, 104, 37770 }, // С
+    { 19, 22, 26, 4, 22, 105, 37874 }, // Т
+    { 17, 22, 20, 1, 19, 94, 37979 }, // У
+    { 19, 19, 22, 1, 19, 91, 38073 }, // Ф
+    { 20, 21, 28, 4, 21, 105, 38164 }, // Х
+    { 16, 24, 18, 1, 19, 96, 38269 }, // Ц
+    { 14, 19, 17, 1, 19, 67, 38365 }, // Ч
+    { 18, 20, 20, 1, 19, 90, 38432 }, // Ш
+    { 21, 25, 23, 1, 20, 132, 38522 }, // Щ
+    { 19, 18, 16, -5, 18, 86, 38654 }, // Ъ
+    { 25, 21, 29, 1, 21, 132, 38740 }, // Ы
+    { 13, 19, 16, 1, 19, 62, 38912 }, // Ь
+    { 19, 22, 21, 1, 20, 105, 38974 }, // Э
+    { 21, 19, 23, 1, 19, 100, 39079 }, // Ю
+    { 17, 22, 24, 4, 21, 94, 39179 }, // Я
+    { 15, 17, 21, 3, 16, 64, 39273 }, // а
+    { 16, 23, 17, 1, 22, 92, 39337 }, // б
+    { 12, 15, 18, 3, 15, 45, 39429 }, // в
+    { 13, 16, 15, 1, 15, 52, 39474 }, // г
+    { 17, 19, 19, 1, 15, 81, 39526 }, // д
+    { 15, 16, 21, 3, 15, 60, 39607 }, // е
+    { 29, 18, 35, 3, 18, 131, 39667 }, // ж
+    { 9, 13, 11, 1, 13, 30, 39798 }, // з
+    { 15, 16, 17, 1, 15, 60, 39828 }, // и
+    { 14, 24, 17, 1, 24, 84, 39888 }, // й
+    { 15, 14, 20, 3, 14, 53, 39972 }, // к
+    { 12, 15, 10, -1, 13, 45, 40025 }, // л
+    { 17, 16, 21, 2, 16, 68, 40070 }, // м
+    { 15, 16, 21, 3, 16, 60, 40138 }, // н
+    { 15, 16, 22, 3, 15, 60, 40198 }, // о
+    { 15, 16, 17, 1, 15, 60, 40258 }, // п
+    { 17, 23, 23, 3, 15, 98, 40318 }, // р
+    { 13, 16, 20, 3, 16, 52, 40416 }, // с
+    { 15, 16, 17, 1, 15, 60, 40468 }, // т
+    { 17, 21, 23, 3, 14, 90, 40528 }, // у
+    { 20, 21, 22, 1, 15, 105, 40618 }, // ф
+    { 18, 16, 18, 0, 15, 72, 40723 }, // х
+    { 16, 19, 18, 1, 15, 76, 40795 }, // ц
+    { 10, 13, 11, 1, 13, 33, 40871 }, // ч
+    { 18, 16, 20, 1, 15, 72, 40960 }, // ш
+    { 21, 20, 22, 1, 15, 105, 41032 }, // щ
+    { 15, 14, 12, -4, 14, 53, 41137 }, // ъ
+    { 19, 16, 22, 0, 16, 76, 41190 }, // ы
+    { 11, 14, 12, 0, 14, 39, 41266 }, // ь
+    { 14, 14, 16, 1, 14, 49, 41305 }, // э
+    { 16, 15, 18, 1, 15, 60, 41354 }, // ю
+    { 15, 16, 21, 3, 16, 60, 41414 }, // я
+    { 15, 28, 21, 3, 27, 105, 41474 }, // ѐ
+    { 15, 27, 21, 3, 26, 102, 41579 }, // ё
+    { 20, 24, 22, 0, 21, 120, 41681 }, // ђ
+    { 13, 23, 15, 1, 22, 75, 41801 }, // ѓ
+    { 14, 16, 14, 0, 14, 56, 41876 }, // є
+    { 15, 18, 22, 3, 16, 68, 41932 }, // ѕ
+    { 6, 23, 12, 3, 23, 35, 42000 }, // і
+    { 12, 22, 12, 0, 22, 66, 42035 }, // ї
+    { 10, 29, 16, 3, 22, 73, 42101 }, // ј
+    { 18, 15, 20, 1, 13, 68, 42174 }, // љ
+    { 16, 15, 10, -3, 14, 60, 42242 }, // њ
+    { 19, 21, 22, 0, 21, 100, 42302 }, // ћ
+    { 15, 21, 20, 3, 21, 79, 42402 }, // ќ
+    { 15, 25, 17, 1, 24, 94, 42481 }, // ѝ
+    { 17, 33, 23, 3, 26, 141, 42575 }, // ў
+    { 12, 18, 15, 1, 13, 54, 42716 }, // џ
+    { 18, 21, 19, 0, 19, 95, 42770 }, // Ѣ
+    { 17, 21, 16, -1, 19, 90, 42865 }, // ѣ
+    { 23, 21, 22, -1, 20, 121, 43008 }, // Ѫ
+    { 17, 14, 15, -1, 13, 60, 43129 }, // ѫ
+    { 20, 27, 28, 4, 26, 135, 43189 }, // Ѳ
+    { 16, 22, 22, 3, 21, 88, 43324 }, // ѳ
+    { 24, 26, 28, 4, 26, 156, 43412 }, // Ѵ
+    { 18, 19, 22, 2, 19, 86, 43568 }, // ѵ
+    { 11, 9, 0, 2, 24, 25, 43654 }, // ҆
+    { 15, 23, 16, 1, 22, 87, 43679 }, // Ґ
+    { 13, 20, 15, 1, 19, 65, 43766 }, // ґ
+    { 18, 20, 16, -2, 19, 90, 43831 }, // Ғ
+    { 12, 14, 11, -1, 13, 42, 43921 }, // ғ
+    { 16, 23, 15, -1, 22, 92, 43963 }, // Ҕ
+    { 10, 15, 9, 0, 13, 38, 44055 }, // ҕ
+    { 33, 26, 37, 2, 21, 215, 44093 }, // Җ
+    { 23, 18, 25, 1, 15, 104, 44308 }, // җ
+    { 13, 23, 16, 1, 18, 75, 44412 }, // Ҙ
+    { 9, 20, 11, 1, 13, 45, 44487 }, // ҙ
+    { 20, 25, 18, 2, 21, 125, 44532 }, // Қ
+    { 15, 18, 13, 1, 15, 68, 44657 }, // қ
+    { 25, 20, 27, 1, 19, 125, 44725 }, // Ҝ
+    { 17, 15, 19, 1, 14, 64, 44850 }, // ҝ
+    { 19, 21, 26, 4, 21, 100, 44914 }, // Ҟ
+    { 18, 21, 23, 1, 21, 95, 45056 }, // ҟ
+    { 23, 21, 26, 0, 21, 121, 45151 }, // Ҡ
+    { 16, 15, 18, 0, 15, 60, 45272 }, // ҡ
+    { 20, 24, 19, 0, 21, 120, 45332 }, // Ң
+    { 14, 17, 13, 0, 15, 60, 45452 }, // ң
+    { 27, 21, 26, 4, 21, 142, 45512 }, // Ҥ
+    { 20, 15, 18, 2, 15, 75, 45654 }, // ҥ
+    { 26, 22, 32, 3, 21, 143, 45729 }, // Ҧ
+    { 24, 25, 32, 3, 17, 150, 45872 }, // ҧ
+    { 25, 21, 17, -4, 19, 132, 46022 }, // Ҩ
+    { 20, 18, 14, -3, 16, 90, 46154 }, // ҩ
+    { 18, 27, 25, 3, 23, 122, 46244 }, // Ҫ
+    { 13, 19, 20, 3, 16, 62, 46366 }, // ҫ
+    { 19, 24, 19, 1, 21, 114, 46428 }, // Ҭ
+    { 14, 18, 13, 0, 15, 63, 46542 }, // ҭ
+    { 19, 21, 27, 4, 21, 100, 46605 }, // Ү
+    { 15, 20, 19, 2, 14, 75, 46705 }, // ү
+    { 19, 21, 27, 4, 21, 100, 46780 }, // Ұ
+    { 17, 20, 19, 1, 14, 85, 46880 }, // ұ
+    { 21, 25, 20, 3, 21, 132, 46965 }, // Ҳ
+    { 15, 17, 14, 2, 15, 64, 47104 }, // ҳ
+    { 23, 24, 15, -4, 19, 138, 47168 }, // Ҵ
+    { 17, 18, 11, -3, 13, 77, 47306 }, // ҵ
+    { 17, 24, 17, 0, 18, 102, 47383 }, // Ҷ
+    { 12, 18, 12, 0, 13, 54, 47485 }, // ҷ
+    { 14, 19, 17, 1, 19, 67, 47539 }, // Ҹ
+    { 10, 13, 11, 1, 13, 33, 47606 }, // ҹ
+    { 15, 22, 17, 1, 21, 83, 47639 }, // Һ
+    { 16, 21, 22, 3, 21, 84, 47722 }, // һ
+    { 28, 21, 24, -5, 20, 147, 47806 }, // Ҽ
+    { 20, 14, 17, -4, 13, 70, 47953 }, // ҽ
+    { 28, 25, 22, -4, 20, 175, 48023 }, // Ҿ
+    { 21, 17, 16, -3, 13, 90, 48198 }, // ҿ
+    { 6, 21, 14, 4, 21, 32, 48288 }, // Ӏ
+    { 31, 34, 28, -1, 34, 264, 48320 }, // Ӂ
+    { 29, 29, 35, 3, 29, 211, 48584 }, // ӂ
+    { 16, 26, 18, 1, 19, 104, 48795 }, // Ӄ
+    { 11, 19, 12, 1, 13, 53, 48899 }, // ӄ
+    { 19, 25, 15, -1, 19, 119, 48952 }, // Ӆ
+    { 13, 17, 10, -1, 13, 56, 49071 }, // ӆ
+    { 20, 28, 26, 4, 21, 140, 49152 }, // Ӈ
+    { 15, 20, 18, 2, 15, 75, 49292 }, // ӈ
+    { 20, 29, 26, 4, 21, 145, 49367 }, // Ӊ
+    { 15, 21, 18, 2, 15, 79, 49512 }, // ӊ
+    { 15, 24, 17, 1, 18, 90, 49591 }, // Ӌ
+    { 10, 17, 15, 3, 13, 43, 49681 }, // ӌ
+    { 24, 30, 29, 4, 21, 180, 49724 }, // Ӎ
+    { 17, 21, 20, 2, 15, 90, 49904 }, // ӎ
+    { 5, 19, 15, 5, 18, 24, 49994 }, // ӏ
+    { 22, 29, 24, 1, 29, 160, 50018 }, // Ӑ
+    { 15, 24, 21, 3, 23, 90, 50178 }, // ӑ
+    { 22, 28, 24, 1, 28, 154, 50268 }, // Ӓ
+    { 15, 24, 21, 3, 23, 90, 50422 }, // ӓ
+    { 32, 22, 34, 1, 21, 176, 50512 }, // Ӕ
+    { 25, 17, 31, 3, 16, 107, 50688 }, // ӕ
+    { 16, 30, 22, 3, 30, 120, 50795 }, // Ӗ
+    { 15, 27, 21, 3, 26, 102, 50915 }, // ӗ
+    { 18, 21, 27, 5, 19, 95, 51017 }, // Ә
+    { 15, 17, 21, 4, 16, 64, 51112 }, // ә
+    { 18, 29, 27, 5, 27, 131, 51200 }, // Ӛ
+    { 15, 21, 21, 4, 16, 79, 51331 }, // ӛ
+    { 31, 32, 35, 2, 32, 248, 51410 }, // Ӝ
+    { 29, 28, 35, 3, 28, 203, 51658 }, // ӝ
+    { 13, 30, 16, 1, 29, 98, 51861 }, // Ӟ
+    { 12, 20, 11, -1, 20, 60, 51959 }, // ӟ
+    { 13, 21, 17, 2, 19, 69, 52019 }, // Ӡ
+    { 13, 20, 17, 2, 14, 65, 52088 }, // ӡ
+    { 18, 32, 26, 4, 32, 144, 52153 }, // Ӣ
+    { 15, 24, 17, 1, 23, 90, 52297 }, // ӣ
+    { 18, 31, 26, 4, 31, 140, 52387 }, // Ӥ
+    { 15, 23, 17, 1, 22, 87, 52527 }, // ӥ
+    { 21, 31, 28, 4, 29, 163, 52614 }, // Ӧ
+    { 16, 26, 22, 2, 25, 104, 52777 }, // ӧ
+    { 19, 20, 28, 4, 19, 95, 52881 }, // Ө
+    { 15, 16, 22, 3, 15, 60, 52976 }, // ө
+    { 19, 28, 28, 4, 27, 133, 53036 }, // Ӫ
+    { 15, 23, 22, 3, 22, 87, 53248 }, // ӫ
+    { 19, 32, 21, 1, 30, 152, 53335 }, // Ӭ
+    { 14, 20, 16, 1, 20, 70, 53487 }, // ӭ
+    { 17, 33, 20, 1, 30, 141, 53557 }, // Ӯ
+    { 17, 33, 23, 3, 26, 141, 53698 }, // ӯ
+    { 17, 32, 20, 1, 29, 136, 53839 }, // Ӱ
+    { 17, 32, 23, 3, 25, 136, 53975 }, // ӱ
+    { 22, 32, 20, 1, 29, 176, 54111 }, // Ӳ
+    { 22, 32, 23, 3, 25, 176, 54287 }, // ӳ
+    { 14, 25, 17, 1, 25, 88, 54463 }, // Ӵ
+    { 12, 19, 11, 0, 19, 57, 54551 }, // ӵ
+    { 15, 23, 16, 1, 19, 87, 54608 }, // Ӷ
+    { 11, 16, 11, 0, 13, 44, 54695 }, // ӷ
+    { 25, 32, 29, 1, 32, 200, 54739 }, // Ӹ
+    { 19, 26, 22, 0, 26, 124, 54939 }, // ӹ
+    { 23, 24, 28, 4, 21, 138, 55063 }, // Ӽ
+    { 17, 17, 19, 2, 15, 73, 55201 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 55274 }, //  
+    { 0, 0, 29, 0, 0, 0, 55274 }, //  
+    { 0, 0, 17, 0, 0, 0, 55274 }, //  
+    { 0, 0, 29, 0, 0, 0, 55274 }, //  
+    { 0, 0, 12, 0, 0, 0, 55274 }, //  
+    { 0, 0, 10, 0, 0, 0, 55274 }, //  
+    { 0, 0, 8, 0, 0, 0, 55274 }, //  
+    { 0, 0, 18, 0, 0, 0, 55274 }, //  
+    { 0, 0, 7, 0, 0, 0, 55274 }, //  
+    { 0, 0, 9, 0, 0, 0, 55274 }, //  
+    { 0, 0, 8, 0, 0, 0, 55274 }, //  
+    { 0, 0, 4, 0, 0, 0, 55274 }, // ​
+    { 0, 0, 0, 0, 0, 0, 55274 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 55274 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 55274 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 55274 }, // ‏
+    { 14, 3, 14, 0, 9, 11, 55274 }, // ‐
+    { 14, 3, 14, 0, 9, 11, 55285 }, // ‑
+    { 20, 3, 14, -3, 9, 15, 55296 }, // ‒
+    { 18, 5, 20, 1, 10, 23, 55311 }, // –
+    { 26, 5, 29, 1, 10, 33, 55334 }, // —
+    { 26, 5, 29, 1, 10, 33, 55367 }, // ―
+    { 13, 23, 14, 2, 18, 75, 55400 }, // ‖
+    { 21, 8, 14, -4, -2, 42, 55475 }, // ‗
+    { 9, 9, 11, 1, 22, 21, 55517 }, // ‘
+    { 9, 9, 11, 1, 22, 21, 55538 }, // ’
+    { 8, 9, 8, 0, 4, 18, 55559 }, // ‚
+    { 9, 9, 11, 1, 22, 21, 55577 }, // ‛
+    { 17, 9, 19, 1, 22, 39, 55598 }, // “
+    { 17, 9, 19, 1, 22, 39, 55637 }, // ”
+    { 8, 9, 8, 0, 4, 18, 55676 }, // „
+    { 17, 9, 19, 1, 22, 39, 55694 }, // ‟
+    { 16, 35, 20, 2, 26, 140, 55733 }, // †
+    { 15, 35, 22, 4, 26, 132, 55873 }, // ‡
+    { 20, 19, 13, -4, 22, 95, 56005 }, // •
+    { 9, 9, 15, 3, 11, 21, 56100 }, // ‣
+    { 7, 6, 15, 4, 6, 11, 56121 }, // ․
+    { 7, 6, 15, 4, 6, 11, 56132 }, // ‥
+    { 24, 6, 24, 0, 6, 36, 56143 }, // …
+    { 4, 3, 14, 5, 9, 3, 56179 }, // ‧
+    { 0, 0, 28, 0, 0, 0, 56182 }, //  
+    { 19, 22, 28, 5, 20, 105, 56182 }, // ‰
+    { 9, 9, 14, 4, 22, 21, 56287 }, // ′
+    { 17, 9, 20, 4, 22, 39, 56308 }, // ″
+    { 20, 8, 10, 1, 21, 40, 56347 }, // ‴
+    { 7, 8, 10, 2, 21, 14, 56387 }, // ‵
+    { 12, 8, 10, 0, 21, 24, 56401 }, // ‶
+    { 20, 8, 10, -5, 21, 40, 56425 }, // ‷
+    { 14, 6, 16, 1, 21, 21, 56465 }, // ‸
+    { 8, 14, 10, 1, 14, 28, 56486 }, // ‹
+    { 8, 14, 10, 1, 14, 28, 56514 }, // ›
+    { 28, 32, 34, 4, 25, 224, 56542 }, // ※
+    { 8, 32, 15, 3, 28, 64, 56766 }, // ‼
+    { 16, 40, 22, 2, 34, 160, 56830 }, // ‽
+    { 14, 3, 14, 0, 21, 11, 56990 }, // ‾
+    { 13, 5, 14, 0, 17, 17, 57001 }, // ‿
+    { 18, 17, 16, -1, 23, 77, 57018 }, // ⁂
+    { 17, 22, 31, 7, 20, 94, 57095 }, // ⁄
+    { 31, 31, 38, 3, 28, 241, 57344 }, // ⁇
+    { 26, 32, 30, 2, 28, 208, 57585 }, // ⁈
+    { 21, 32, 19, -1, 28, 168, 57793 }, // ⁉
+    { 19, 44, 23, 2, 30, 209, 57961 }, // ⁒
+    { 0, 0, 117, 0, 0, 0, 58170 }, //  
+    { 8, 10, 8, 0, 21, 20, 58170 }, // ⁰
+    { 8, 9, 9, 0, 21, 18, 58190 }, // ⁴
+    { 7, 11, 9, 1, 22, 20, 58208 }, // ⁵
+    { 7, 10, 9, 1, 21, 18, 58228 }, // ⁶
+    { 7, 11, 9, 1, 22, 20, 58246 }, // ⁷
+    { 9, 11, 9, 0, 21, 25, 58266 }, // ⁸
+    { 8, 11, 9, 0, 21, 22, 58291 }, // ⁹
+    { 15, 16, 22, 3, 16, 60, 58313 }, // ⁿ
+    { 7, 10, 9, 1, 6, 18, 58373 }, // ₀
+    { 7, 11, 8, 1, 6, 20, 58391 }, // ₁
+    { 7, 11, 9, 1, 6, 20, 58411 }, // ₂
+    { 7, 10, 9, 1, 6, 18, 58431 }, // ₃
+    { 8, 10, 9, 1, 6, 20, 58449 }, // ₄
+    { 7, 10, 8, 1, 6, 18, 58469 }, // ₅
+    { 7, 10, 9, 1, 6, 18, 58487 }, // ₆
+    { 7, 11, 9, 1, 6, 20, 58505 }, // ₇
+    { 9, 11, 9, 0, 6, 25, 58525 }, // ₈
+    { 8, 11, 9, 1, 6, 22, 58550 }, // ₉
+    { 11, 35, 12, 1, 26, 97, 58572 }, // ₍
+    { 11, 35, 11, -1, 26, 97, 58669 }, // ₎
+    { 18, 33, 25, 3, 28, 149, 58766 }, // ₡
+    { 18, 23, 25, 3, 23, 104, 58915 }, // ₢
+    { 17, 23, 17, 0, 22, 98, 59019 }, // ₤
+    { 27, 21, 26, -1, 21, 142, 59117 }, // ₦
+    { 22, 22, 23, 0, 22, 121, 59259 }, // ₧
+    { 27, 23, 33, 3, 21, 156, 59392 }, // ₨
+    { 21, 22, 21, 0, 22, 116, 59548 }, // ₩
+    { 20, 19, 27, 3, 19, 95, 59664 }, // ₪
+    { 19, 22, 13, -2, 21, 105, 59759 }, // ₫
+    { 18, 24, 19, 0, 20, 108, 59864 }, // €
+    { 19, 22, 26, 4, 22, 105, 59972 }, // ₮
+    { 25, 22, 16, -1, 22, 138, 60077 }, // ₱
+    { 21, 33, 29, 4, 28, 174, 60215 }, // ₲
+    { 25, 21, 26, 5, 19, 132, 60389 }, // ₴
+    { 13, 20, 15, 3, 18, 65, 60521 }, // ₵
+    { 20, 23, 26, 3, 23, 115, 60586 }, // ₸
+    { 13, 21, 17, 2, 20, 69, 60701 }, // ₹
+    { 15, 19, 17, 1, 17, 72, 60770 }, // ₺
+    { 18, 21, 20, 1, 20, 95, 60842 }, // ₼
+    { 21, 22, 23, -2, 22, 116, 60937 }, // ₽
+    { 17, 18, 18, 0, 15, 77, 61053 }, // ←
+    { 19, 18, 19, 0, 17, 86, 61130 }, // ↑
+    { 17, 18, 19, 1, 15, 77, 61216 }, // →
+    { 19, 17, 19, 0, 16, 81, 61293 }, // ↓
+    { 21, 15, 26, 2, 14, 79, 61440 }, // ↔
+    { 16, 20, 20, 2, 22, 80, 61519 }, // ↕
+    { 15, 14, 20, 2, 13, 53, 61599 }, // ↖
+    { 14, 14, 16, 1, 13, 49, 61652 }, // ↗
+    { 14, 14, 16, 1, 14, 49, 61701 }, // ↘
+    { 14, 14, 16, 1, 14, 49, 61750 }, // ↙
+    { 20, 18, 24, 2, 16, 90, 61799 }, // ⇐
+    { 22, 20, 27, 2, 19, 110, 61889 }, // ⇑
+    { 20, 18, 24, 2, 16, 90, 61999 }, // ⇒
+    { 22, 20, 27, 2, 18, 110, 62089 }, // ⇓
+    { 23, 18, 27, 2, 16, 104, 62199 }, // ⇔
+    { 18, 22, 22, 2, 13, 99, 62303 }, // ⇕
+    { 15, 22, 17, 1, 21, 83, 62402 }, // ∂
+    { 26, 26, 28, 1, 23, 169, 62485 }, // ∅
+    { 20, 20, 22, 1, 19, 100, 62654 }, // ∆
+    { 17, 20, 18, 1, 19, 85, 62754 }, // ∏
+    { 17, 19, 18, 1, 18, 81, 62839 }, // ∐
+    { 13, 20, 15, 1, 19, 65, 62920 }, // ∑
+    { 15, 4, 15, 0, 9, 15, 62985 }, // −
+    { 22, 23, 24, 1, 21, 127, 63000 }, // √
+    { 21, 14, 23, 1, 16, 74, 63127 }, // ∞
+    { 20, 27, 21, 1, 20, 135, 63201 }, // ∫
+    { 7, 17, 8, 1, 17, 30, 63336 }, // ∶
+    { 15, 14, 36, 10, 14, 53, 63366 }, // ≈
+    { 19, 22, 31, 6, 20, 105, 63488 }, // ≠
+    { 21, 21, 20, -1, 18, 111, 63593 }, // ≤
+    { 22, 22, 22, 0, 19, 121, 63704 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
@@ -4682,4 +2937,9 @@ static const EpdFontData opendyslexic_12_bold = {
     33,
     -13,
     true,
+    opendyslexic_12_boldBlockOffsets,
+    opendyslexic_12_boldDirectGlyphs,
+    opendyslexic_12_boldGlyphPages,
+    35,
+    opendyslexic_12_boldPageGlyphs,
 };
@@ -2,4709 +2,2449 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_bolditalic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_bolditalic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_12_bolditalic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_bolditalicBitmaps[75122] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x7F, 0xF8, 0x3F, 0xFC, 0x0F, 0xFD, 0x0F, 0xFE, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0xBF, 0xD0, 0x7F,
-    0xE0, 0x1F, 0xF8, 0x0F, 0xF8, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x2F, 0xF8,
-    0x2F, 0xF8, 0x06, 0xA9, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x55, 0xBF,
-    0xD5, 0xFF, 0x95, 0x54, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x55, 0x7F, 0xF5, 0xBF, 0xE5,
-    0x55, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA8, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xD3, 0xF9, 0x00, 0x00, 0x2F,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xF8, 0x00, 0x00,
-    0x1F, 0xFE, 0x4F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x28, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xFF, 0x40,
-    0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xFF,
-    0xF0, 0x00, 0xFD, 0x00, 0x0F, 0x43, 0xD0, 0x0B, 0xE0, 0x00, 0xB8, 0x0F, 0x40, 0xBF, 0x00, 0x03,
-    0xC0, 0x3C, 0x07, 0xF0, 0x00, 0x0F, 0x42, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x47, 0xF4, 0x00,
-    0x00, 0xBF, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xBE, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC6,
-    0xF8, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xC7, 0xC0, 0xF0, 0x00, 0x02, 0xFD,
-    0x3D, 0x03, 0xC0, 0x00, 0x1F, 0xD0, 0xF0, 0x1F, 0x00, 0x01, 0xFE, 0x07, 0xC1, 0xF8, 0x00, 0x0F,
-    0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x07, 0xF4, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0x3F, 0x80, 0x00, 0x3F, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0xA4, 0x1F,
-    0xF5, 0xFD, 0x03, 0xF4, 0xFF, 0x41, 0xFD, 0x2F, 0xC7, 0xFC, 0x02, 0xFE, 0xFE, 0x1F, 0xF0, 0x02,
-    0xFF, 0xF0, 0xBF, 0xF5, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFF, 0xD7, 0x40, 0x02, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xA4, 0x3F, 0xF8, 0x3F, 0xF4, 0x3F, 0xF4, 0x2F, 0xF4, 0x1F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFD, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1B,
-    0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x20, 0x7F, 0x0B, 0x43,
-    0xF5, 0xF9, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xE1, 0xFE, 0xFD, 0xFE, 0x03, 0xD3, 0xF0, 0xA0, 0x04, 0x1F, 0xC0,
-    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFE, 0x00, 0x2A, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x01, 0x54, 0x1F, 0xE0, 0xFF, 0x47, 0xFD, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFD, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x01, 0xFD, 0x00,
-    0x3F, 0x00, 0x0F, 0xF1, 0xD0, 0xFC, 0x00, 0x7F, 0x9F, 0xC7, 0xF0, 0x02, 0xFC, 0xBF, 0x2F, 0xC0,
-    0x0F, 0xF3, 0xFC, 0xFF, 0x00, 0x7F, 0x8F, 0xE7, 0xF8, 0x02, 0xFD, 0x3F, 0x2F, 0xD0, 0x0F, 0xF4,
-    0x61, 0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x7F, 0xF8,
-    0x00, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x3D, 0xFE, 0x00, 0x05, 0x1F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F,
-    0x40, 0xBF, 0x80, 0x0A, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x03, 0x90, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x01, 0x55, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0x40, 0x1F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFB, 0xF4, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x1F, 0x8B, 0xF0,
-    0x00, 0x7F, 0x0F, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x2F, 0xD0, 0x1F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x5A, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0A,
-    0x95, 0x6F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x40, 0x00, 0xFF, 0x80,
-    0x3D, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x50, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xE4, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xF9, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xD7, 0xFE, 0x00, 0xBF, 0xD0, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0xFF, 0x00,
-    0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0xBF, 0xC0, 0x01, 0xFE, 0x00,
-    0xFD, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0xC0, 0x07,
-    0xFD, 0x6F, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x2F, 0xE0,
-    0x02, 0xFE, 0x02, 0xFF, 0x96, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2B, 0xE4, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x07, 0xFE, 0x00, 0x3F, 0xFB, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x01, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xFE, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xA0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0B,
-    0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A,
-    0x90, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFE, 0xAA, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x90, 0x7F, 0x80, 0x0B, 0x80,
-    0x02, 0xFC, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x6F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x3F, 0x0B, 0xEE, 0x00, 0x3C, 0x00, 0x0F, 0xE2, 0xFF, 0xE0, 0x03, 0xC0, 0x01, 0xFC,
-    0x78, 0x3D, 0x00, 0x7C, 0x00, 0x3F, 0x4F, 0x02, 0xC0, 0x0B, 0x80, 0x07, 0xF0, 0xD0, 0x3C, 0x00,
-    0xF4, 0x00, 0xBF, 0x1C, 0x03, 0xC0, 0x2F, 0x00, 0x0B, 0xF2, 0xEA, 0xFC, 0x0B, 0xD0, 0x00, 0xFF,
-    0x1F, 0xFF, 0x87, 0xF8, 0x00, 0x0F, 0xF0, 0xBF, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x68, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFE,
-    0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x5F, 0xF0, 0x00, 0x2F, 0xE0, 0x01, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xAA,
-    0xFF, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x01,
-    0xFF, 0x40, 0x2F, 0xF5, 0x5B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x56, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x01, 0x6F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xAA, 0x54, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x55, 0x54, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xD4, 0x01, 0x64, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xA5, 0x00,
-    0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x7F,
-    0xFF, 0xE0, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0xD4,
-    0x16, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07,
-    0xE8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x40, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF8, 0x00,
-    0x2B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0x91, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x02, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF0,
-    0x00, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF3, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x6F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF,
-    0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x02,
-    0xFE, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x0F, 0xF7, 0xFF, 0x7F, 0xDF, 0xF4, 0x00, 0x3F, 0xCF, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0x5F, 0xF8,
-    0x00, 0x3F, 0xE2, 0xFF, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x4B, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFC,
-    0x1F, 0xFF, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0xFF, 0x83,
-    0xFF, 0x40, 0x0B, 0xFE, 0x03, 0xFC, 0x2F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00,
-    0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07,
-    0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF,
-    0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD,
-    0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00,
-    0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x7F, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0xE5, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xE4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x07, 0xFF,
-    0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x02,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x04, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xD2,
-    0xFF, 0x00, 0x0F, 0xFE, 0x57, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFC,
-    0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00,
-    0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF,
-    0x80, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF,
-    0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x7F,
-    0xD1, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF4,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0xFF, 0xD2, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF9, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF4, 0x00,
-    0x69, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xF4, 0x07, 0xFF,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x3F, 0xFF, 0x43,
-    0xFF, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0xF8, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0xFF, 0x8F, 0xFC,
-    0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00,
-    0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4,
-    0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x55, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x16,
-    0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xD0, 0x2D, 0x03, 0xE0, 0x7E, 0x07, 0xF0,
-    0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x43, 0xF4, 0x3F, 0x43, 0xF8, 0x3F, 0x83, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xD3, 0xFC, 0x3F, 0x43, 0xE0, 0x3C, 0x03, 0x40, 0x10, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0x82,
-    0xFC, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0xAA, 0xAA, 0xAA, 0x90, 0x15, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07,
-    0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02,
-    0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x15,
-    0x00, 0x03, 0xFB, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0x41,
-    0xF8, 0x0F, 0xFC, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0xFC, 0x0F, 0xF0, 0x00, 0xFC, 0x1F, 0xE0, 0x02,
-    0xF8, 0x2F, 0xD0, 0x07, 0xF4, 0x2F, 0xF5, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x90, 0x50, 0x3F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xEB, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x00, 0x1F,
-    0xD0, 0x0B, 0xFC, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0xFF, 0x80, 0x01, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xC0, 0x1F, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x03, 0xFC, 0x01, 0xF4, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE, 0xA5, 0x50, 0x0B,
-    0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xF5, 0xB0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xD0,
-    0x0A, 0xFF, 0xA8, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xFD, 0x00,
-    0x01, 0xFF, 0xFE, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x3F,
-    0x40, 0x3F, 0xF4, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00,
-    0x3F, 0xD0, 0x01, 0xF4, 0x00, 0x7F, 0xC0, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xF8, 0x07, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0A, 0x40, 0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFD, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x42, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F,
-    0x40, 0x7F, 0xC0, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4,
-    0x02, 0xFE, 0x02, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x6B, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0x87, 0xF8, 0x00, 0x7F, 0x2F, 0xE0, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x0F, 0xF7, 0xFF, 0x80, 0x1F, 0xF3, 0xFF, 0xE0, 0x2F, 0xE1, 0xFF, 0xF4, 0x3F,
-    0xD0, 0xBF, 0xFD, 0x00, 0x01, 0xE8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00,
-    0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE5, 0x00, 0x1F, 0xFF, 0x40, 0x2F,
-    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xF4,
-    0x0B, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xF8, 0x2F, 0xFE, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x1F, 0xC0, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x1F, 0xE0, 0x0B, 0xF8, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x2F,
-    0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0xD0,
-    0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x01, 0xFE, 0x07,
-    0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xD6, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0xBC, 0x00, 0x02,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0x40, 0x00,
-    0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xF4, 0x6A, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0xFD, 0x00, 0x1F, 0xFF, 0xEF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x07, 0xFF, 0x40, 0x3F, 0x40, 0x3F, 0xF0, 0x07, 0xE0, 0x02, 0xFE, 0x00, 0xBC, 0x00, 0x3F, 0xD0,
-    0x0F, 0x80, 0x03, 0xFC, 0x01, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0x40, 0x0F, 0xF4, 0x02, 0xF8, 0x07,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x6F, 0xAF, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xA9, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0A, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x95, 0xB4,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC,
-    0x03, 0xD0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x40,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xE0, 0x00,
-    0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03,
-    0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F, 0x40, 0x3F,
-    0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xFC, 0x00,
-    0x07, 0xF8, 0x3F, 0xC0, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x07, 0xF8, 0x01,
-    0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x0F, 0xF9, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x7F, 0x9F, 0xE0, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x02, 0xF0,
-    0x0F, 0xF0, 0x7F, 0x81, 0xFD, 0x0B, 0xF4, 0x1F, 0xE1, 0xFF, 0x87, 0xFC, 0x07, 0xF8, 0xFF, 0xF3,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFC, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0B, 0xFD, 0x00,
-    0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00,
-    0x00, 0x2F, 0xF3, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05,
-    0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xFA, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF0, 0xBF, 0xC7, 0xC3, 0xEF,
-    0xFE, 0x2F, 0x1F, 0xF0, 0x7C, 0x2F, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x02, 0xFF,
-    0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x50, 0x3F,
-    0xCF, 0x40, 0x07, 0xF4, 0xF0, 0x00, 0xFF, 0x0F, 0x00, 0x0F, 0xE1, 0xE0, 0x01, 0xFD, 0x2E, 0x00,
-    0x1F, 0xD3, 0xD0, 0x02, 0xFE, 0x3D, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xFF, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x94, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0A, 0xAA, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0x00, 0x0B, 0xFF, 0xD7, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0x40, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xC0, 0x42, 0xF0, 0x00, 0x40, 0x00, 0x10,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x3D, 0x00,
-    0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3F, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xD0, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x90, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x46, 0xFF,
-    0x00, 0x0B, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0xAA, 0xBF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x54, 0x05, 0x50, 0x7F, 0x82,
-    0xFD, 0x0F, 0xF8, 0x3F, 0xD1, 0xFF, 0x47, 0xFC, 0x2F, 0xF4, 0xFF, 0xC3, 0xFF, 0x1F, 0xFC, 0x00,
-    0x2F, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x7E, 0x47, 0xD0, 0x3F, 0xF8, 0x7C, 0x2F, 0xD0, 0x1F, 0x0F,
-    0xF0, 0x07, 0x83, 0xFC, 0x03, 0xD0, 0xF7, 0xF2, 0xF0, 0x2F, 0x47, 0xF0, 0x03, 0xFF, 0xF4, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xAC, 0x03, 0xEF, 0xC0, 0xB0, 0x78, 0x0D, 0x07, 0x41,
-    0xC0, 0x74, 0x2D, 0x6F, 0x01, 0xFF, 0xF0, 0x0B, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x1C, 0x00, 0x03, 0xD0, 0x0B, 0x80, 0x01, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x42, 0xFE,
-    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0xF0,
-    0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0x40, 0x7F, 0x00,
-    0x00, 0xF0, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x08, 0x00, 0x09, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xF9,
-    0x2F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x2F,
-    0xF9, 0xF4, 0x1F, 0xC3, 0x1E, 0x0F, 0xB2, 0x4B, 0x83, 0xEF, 0xC3, 0xE0, 0xFE, 0x72, 0xF0, 0x3F,
-    0x5F, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xD9, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xF4, 0x3F, 0x41, 0xFC, 0x03, 0xF4, 0x1F, 0xC0, 0xBF, 0x02,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x1A, 0xAF, 0xFA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x03, 0xEB, 0x40, 0x00, 0xE0, 0x00, 0xF0, 0x01, 0xF4, 0x07,
-    0xF4, 0x03, 0xFF, 0x42, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x2F, 0xF4, 0x01, 0x03, 0x80, 0x00, 0x38,
-    0x00, 0xAF, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x00, 0x96, 0xF0, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x00,
-    0xFC, 0x02, 0xF4, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00,
-    0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x7F,
-    0x80, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x01, 0xFF, 0xD0,
-    0xBF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xC7, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC7, 0xF0, 0x00,
-    0x2F, 0xFF, 0x2F, 0xC0, 0x02, 0xFF, 0xF4, 0xFE, 0x00, 0x1F, 0xFF, 0xC3, 0xF4, 0x00, 0xFF, 0xFE,
-    0x1F, 0xC0, 0x03, 0xFF, 0xF4, 0x7F, 0x00, 0x0F, 0xFF, 0xC2, 0xF8, 0x00, 0x2F, 0xFE, 0x0F, 0xD0,
-    0x00, 0x3F, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0xC1, 0xFC, 0x00, 0x03, 0xFE, 0x0B, 0xE0, 0x00, 0x1F,
-    0xF4, 0x3F, 0x40, 0x00, 0xFF, 0xC0, 0xFC, 0x00, 0x03, 0xFE, 0x07, 0xF0, 0x00, 0x2F, 0xF4, 0x2F,
-    0x80, 0x00, 0xFF, 0xC0, 0xFD, 0x00, 0x0B, 0xFE, 0x03, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xC0, 0x02,
-    0xFF, 0xC0, 0xBE, 0x00, 0x0F, 0xFE, 0x03, 0xF4, 0x00, 0x7F, 0xF4, 0x0F, 0xC0, 0x01, 0x55, 0x40,
-    0x15, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC1, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0x55, 0x40, 0x02, 0xE0,
-    0x03, 0xC0, 0x0B, 0xE0, 0x0F, 0xF8, 0x14, 0xBC, 0x2F, 0xF8, 0x3F, 0xF0, 0x2A, 0x40, 0x01, 0xF0,
-    0x0F, 0xC0, 0x5E, 0x00, 0x74, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x1F, 0xFD, 0xBF, 0xF0, 0x02, 0xF8,
-    0x03, 0xEB, 0xC2, 0xE0, 0xF0, 0xF0, 0x3C, 0x78, 0x1E, 0x1F, 0xAF, 0x43, 0xFF, 0x80, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x09, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x0B, 0xF8, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x7F, 0x40,
-    0x01, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x0F, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0x03,
-    0xFD, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x19, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x07, 0xF4, 0x1F, 0x03, 0xFF, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x7F, 0xFF, 0x40,
-    0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7B, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x1E, 0x7C,
-    0x00, 0x00, 0x00, 0xFF, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xF0, 0xFD, 0x00, 0x00, 0x0B,
-    0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x01, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF0,
-    0xBF, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F, 0xD1, 0xFF, 0xFC, 0x7F, 0xFF, 0x40, 0x3F, 0x43, 0x90, 0x7D,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xE0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xBF, 0x00,
-    0x00, 0xE5, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x07, 0xF4, 0x1F, 0x03, 0xFF, 0xFC,
-    0x00, 0xFD, 0x07, 0xF0, 0x2F, 0xFE, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7B,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x8B, 0xC0, 0x00, 0x00,
-    0x2F, 0xC1, 0xF1, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x15, 0x7F, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x10, 0x00, 0x7F, 0x00, 0x03, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF1, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x0F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x0F,
-    0xFE, 0xAA, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xDB,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x00, 0x7F,
-    0x81, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD1, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xC0, 0x00, 0x00, 0x07, 0xCF, 0xFD,
-    0x00, 0x00, 0x00, 0x3E, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xFA, 0xAB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
-    0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x03,
-    0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xDB, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80,
-    0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x00,
-    0x2E, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xAB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xA0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x16, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x02,
-    0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAA, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xD0, 0x00, 0x03,
-    0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xA0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x2B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x02, 0xFD, 0x1F, 0xE0, 0x07, 0xF0, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x00, 0xFF,
-    0x43, 0xFC, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF1, 0xFF, 0x80,
-    0x05, 0x55, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x15, 0xBF, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0x83, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF0, 0x05, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3E, 0x00, 0x00,
-    0x00, 0x02, 0xFB, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF,
-    0xC0, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xFB, 0xFC,
-    0x0F, 0xF4, 0x00, 0x07, 0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE2, 0xFE, 0x00, 0x00,
-    0xFF, 0xC7, 0xFC, 0xFF, 0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x3F, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xC0, 0xBF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x9B, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xFE, 0x41, 0x6F, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x9B, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0x00, 0x3F, 0xFE, 0x41, 0x6F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x78, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x2E, 0x00,
-    0x00, 0x00, 0x02, 0xF3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2E,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B,
-    0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8,
-    0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xBF,
-    0xE0, 0x03, 0xFF, 0xE4, 0x16, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x3F, 0xEF, 0xF0,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xBF, 0xE0, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x07, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x5B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD6, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF,
-    0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0,
-    0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F,
-    0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x05, 0x54, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00,
-    0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFC, 0x0F, 0xF0, 0x02,
-    0xF4, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0xBF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xE9, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x03, 0xF8, 0x0B, 0xFC, 0x00, 0x7F,
-    0x03, 0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xA0, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD2, 0xF4, 0x00,
-    0x02, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00, 0x7F, 0x40,
-    0x7F, 0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFD, 0x46, 0xFE, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0,
-    0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x1F, 0xF4, 0x03, 0xF8, 0x02, 0xFC, 0x01, 0xFC,
-    0x00, 0xBF, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x03, 0xF8, 0x0B,
-    0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x1F, 0xD1, 0xFE, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFE, 0x07, 0xFD, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x40, 0x0B,
-    0xF0, 0x0F, 0xC0, 0x02, 0xF8, 0x07, 0xD0, 0x00, 0xFE, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0xFC, 0x00,
-    0x3F, 0xC0, 0x3F, 0xEA, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x07, 0x80, 0x00, 0x3F, 0xF2,
-    0xE0, 0x00, 0x1F, 0xBF, 0xF4, 0x00, 0x0F, 0x87, 0xF8, 0x00, 0x01, 0x90, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xD0, 0x0F, 0xE0, 0x0B, 0xF0, 0x07, 0xF0, 0x02, 0xFC, 0x02,
-    0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x7D, 0x00, 0x0F, 0xE0, 0x2F, 0x00, 0x03, 0xF4,
-    0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xFE, 0xAF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x50, 0x00,
-    0x0B, 0xF8, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x03, 0xF8, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x2F,
-    0xC0, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x01,
-    0xF4, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xAB,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8,
-    0x02, 0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40,
-    0x03, 0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xEB, 0xFC, 0x00, 0xFE, 0x07, 0xFF, 0xF0, 0x0B, 0xC0, 0x3F,
-    0x80, 0x2F, 0xFC, 0x05, 0xBD, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xBD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD1, 0xF4, 0x00, 0x3F, 0xFA, 0xA5, 0x40, 0x2F,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x10, 0x3F, 0xEA, 0xFF, 0xFF,
-    0x90, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x90, 0x50, 0x3F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x04, 0x7C, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0x40, 0x2F, 0xC0, 0x5B, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xEA, 0x55, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x7D, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0xFF,
-    0x00, 0x7D, 0x00, 0x2F, 0xC0, 0x5B, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xEA, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00,
-    0x03, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x2F, 0xC0, 0x5B,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
-    0xEA, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x54, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00, 0x00, 0xFF,
-    0x43, 0xFC, 0x00, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x7D, 0x00, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40,
-    0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF1, 0xFE, 0x02, 0xFC, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x02, 0xF4,
-    0x2F, 0x41, 0xFD, 0x1F, 0xD0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xFC, 0x2F, 0xF2, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x10, 0x0F, 0xD0, 0x00,
-    0x00, 0x7F, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xEB,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x3C,
-    0x00, 0x00, 0x07, 0xFC, 0x3C, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0x0F, 0xF4, 0x00,
-    0x00, 0x1F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x00, 0xBF, 0x80, 0x1F,
-    0x80, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x7F, 0x40,
-    0x03, 0xFC, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x0F,
-    0xF4, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0x3F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0xFE,
-    0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x07, 0xF8, 0x1F, 0xD0, 0x03, 0xFC, 0x07, 0xFC, 0x07, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xF8, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0x2F, 0xC0, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x07, 0xF8, 0x1F, 0xD0, 0x03, 0xFC, 0x07, 0xFC,
-    0x07, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0x87, 0xF8, 0x00, 0x3F, 0x80,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x01, 0xFE,
-    0x07, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x78, 0x00, 0x00, 0xFF, 0xCB, 0xC0, 0x00, 0x1F, 0x3F, 0xF4,
-    0x00, 0x03, 0xF1, 0xFF, 0x00, 0x00, 0x19, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x0F, 0xF8, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x50, 0x00,
-    0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0B,
-    0xF0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x01,
-    0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x5F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x6F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x7F, 0x80, 0x00, 0x00,
-    0x07, 0xFB, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F,
-    0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F,
-    0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F,
-    0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F,
-    0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFE, 0x2F, 0xD0, 0x03,
-    0xF8, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F,
-    0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F,
-    0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xD0,
-    0x00, 0xBF, 0x43, 0xFD, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF1,
-    0xFF, 0xC0, 0x01, 0x55, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x1F,
-    0xD0, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC,
-    0x00, 0xBF, 0x80, 0x2F, 0x80, 0x0F, 0xF4, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0x40, 0x3F, 0xF0,
-    0x03, 0xFD, 0x0B, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0xC0, 0x7F, 0x40, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0x00,
-    0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x16,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x47, 0xFC, 0x00,
-    0x1F, 0xC0, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xE1, 0xFF, 0x00, 0x07, 0xFB, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x83, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x00,
-    0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xAA, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x06, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC7,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xAA, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x07,
-    0xFD, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x02, 0xF4, 0x00, 0xBF, 0x00,
-    0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x7D, 0x00, 0x0F, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03,
-    0xF8, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0,
-    0x02, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xF6,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-    0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x50, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xF0, 0x02,
-    0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40, 0x03, 0xF8, 0x2F, 0x00, 0x03,
-    0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xE0, 0x03, 0xFE, 0x41, 0x40, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x10, 0x00,
-    0x7F, 0xEB, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xBF, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x90, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
-    0x90, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x10, 0x00, 0x1F, 0xFA,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x55, 0xBD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x90,
-    0x01, 0xA4, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x02, 0xFE, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x90, 0x50, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x10, 0x00,
-    0x00, 0x1F, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0xA9, 0x00, 0x00, 0x01, 0xFD, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x56, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFD, 0x01, 0x6F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x9A,
-    0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEB, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xD0,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x15, 0xBF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x01,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x02,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x83, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x05, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x5B, 0xF9,
-    0x50, 0x00, 0x01, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xAF, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x80, 0x00, 0x07,
-    0xF4, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x1F,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x56, 0xAB, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xEA, 0xA9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x02, 0xFC,
-    0x05, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF9, 0x01, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xF4,
-    0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x01, 0xF4, 0x00, 0x02, 0xFC, 0x05, 0xBE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFE, 0xA5, 0x50, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE4, 0x07, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xD0, 0x02, 0xFC, 0x05,
-    0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFE, 0xA5, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x1F,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x03, 0xFC, 0x01, 0xF4, 0x02, 0xFC,
-    0x05, 0xBE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFE, 0xA5, 0x50, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0xAF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x7F, 0x80, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0x40, 0x00, 0x2F, 0xC0, 0x5B,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xEA, 0x55, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x7D, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD4, 0x01, 0x64, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0A, 0x50,
-    0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xFF, 0xD4, 0x16, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0x40, 0x00, 0x01,
-    0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0x0B, 0xFF, 0x80, 0x00,
-    0x0F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0x80,
-    0x00, 0x0F, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0x0B, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x29, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF5, 0x00, 0x59, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x29, 0x40,
-    0x00, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00,
-    0x0B, 0xF4, 0x00, 0x03, 0xFF, 0xF5, 0x05, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x83, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xEF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xD0,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xBE, 0x01, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x90, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF5, 0x00, 0x59,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x29, 0x40, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0x42, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x03,
-    0xFF, 0xF5, 0x05, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0xBF, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x7E, 0x00,
-    0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xF4, 0x00, 0x7F,
-    0xC0, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xF8, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0A, 0x40,
-    0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xD4, 0x01, 0x64, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0A, 0x50, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x0B,
-    0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0x7F,
-    0xF4, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xD4, 0x16, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x0B, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00,
-    0x7E, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFD, 0x00, 0x07,
-    0xD0, 0x01, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xBE, 0x01, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0x90, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F,
-    0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x02,
-    0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x2F, 0xC0, 0x0B, 0xFC,
-    0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F, 0x80,
-    0x3F, 0xC0, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x0F, 0xF8, 0x00,
-    0xFF, 0x01, 0xFF, 0x40, 0x2F, 0xE0, 0x2F, 0xF4, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x06,
-    0xB0, 0x05, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFE, 0xAA, 0xAB, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x55, 0x57, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x40, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC1,
-    0x40, 0x00, 0x6B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF5, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0x42, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0xFC, 0x01, 0xFE,
-    0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x7F, 0xC0, 0x07, 0xF0,
-    0x0B, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4, 0x02, 0xFE, 0x02, 0xFF, 0x40,
-    0x3F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x6B, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x0F, 0x00,
-    0x00, 0x3F, 0x87, 0xC0, 0x00, 0x3F, 0xF6, 0xF0, 0x00, 0x1F, 0x2F, 0xF4, 0x00, 0x0B, 0xC3, 0xFC,
-    0x00, 0x00, 0xA0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0x40,
-    0x3F, 0xE3, 0xD0, 0x2F, 0xBE, 0xF0, 0x0F, 0x4F, 0xF8, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x6A, 0x80, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFA, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0x2A, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x80, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xF2, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2B, 0xF4, 0x00,
-    0x00, 0x00, 0xB9, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07,
-    0xF0, 0x0B, 0xE0, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0xC0, 0x6F,
-    0x80, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0xAA, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xFD,
-    0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06, 0xBF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x40,
-    0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB9, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x6F, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0x91, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x0B,
-    0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xCF, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0xBF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0xF0, 0x00, 0x03,
-    0xFE, 0x0F, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFB, 0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xF7,
-    0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xFE, 0x00, 0x2F, 0xE1, 0xFF, 0xF4, 0x03, 0xFD, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1,
-    0xFC, 0x00, 0x7C, 0x7F, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xF7, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80,
-    0x03, 0xF3, 0xFD, 0x00, 0x3F, 0x2F, 0xF4, 0x0B, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFB, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0x40, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x01, 0xFF, 0x00, 0xFE, 0x00,
-    0x0B, 0xF8, 0x07, 0xF4, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x0B, 0xF8,
-    0x06, 0xA4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xE8, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00,
-    0x3F, 0x43, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x50, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x01, 0xFF, 0x01, 0xFF, 0x40,
-    0x0B, 0xF8, 0x0F, 0xFD, 0x00, 0x3F, 0xD0, 0x15, 0x50, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x2F, 0xC3, 0xFD, 0x00, 0x3F,
-    0x87, 0xFC, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0xBF, 0x1F, 0xFC, 0x00, 0xFF, 0x15, 0x54, 0x00, 0xFD,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD1, 0xAF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFA, 0x40, 0x05, 0xAF, 0xFF, 0xFE, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xAF,
-    0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xC0,
-    0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x03, 0xFE, 0xFF,
-    0x03, 0xFD, 0x00, 0x01, 0xFF, 0x6F, 0xD1, 0xFF, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0xBF, 0x80, 0x00,
-    0x3F, 0xF1, 0xFF, 0x3F, 0xD0, 0x00, 0x1F, 0xFC, 0x7F, 0xDF, 0xF0, 0x00, 0x0F, 0xFE, 0x0F, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xF0, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xD1, 0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00,
-    0x3F, 0xC0, 0x0B, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02,
-    0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07, 0xFD,
-    0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x40,
-    0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x0F,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x01,
-    0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x2F,
-    0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0xD0,
-    0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F,
-    0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0B,
-    0xFF, 0xD0, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x0F,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x3F, 0xD0, 0x00, 0x07,
-    0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0xCF,
-    0xF4, 0x00, 0x01, 0xFF, 0xC7, 0xFD, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0x43, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x02, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0xC0,
-    0xBF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9B, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xD0,
-    0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0xE0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x2F,
-    0xE0, 0x00, 0x0F, 0xFB, 0xFC, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0xBF, 0x47, 0xFC, 0x00, 0x03, 0xFF,
-    0x2F, 0xE2, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x40, 0x00, 0x7F, 0xF1, 0xFF, 0x7F, 0xC0,
-    0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x03,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00,
-    0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x05, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80, 0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00,
-    0x2F, 0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07,
-    0xF8, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F,
-    0xD0, 0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1E, 0xAA, 0xA5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00,
-    0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x6A, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0A, 0xAA, 0x95,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x0F, 0xF4, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x01, 0xFD,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE9, 0xBF,
-    0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x01, 0xFF,
-    0x80, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF,
-    0x40, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0xE4, 0x16,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F,
-    0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xF0,
-    0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE9, 0xBF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0x90, 0x5B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x01, 0x50, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xC0,
-    0x00, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x40,
-    0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x15, 0x55, 0xAA, 0xA0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFA, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0xBD, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE5, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x0B, 0xF9, 0x00, 0x00,
-    0x3F, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFA, 0xFD, 0x00, 0x3F, 0xE0, 0x7F,
-    0xFE, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0xBF, 0xD0, 0x5B, 0xF0, 0x0F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xE0,
-    0x01, 0xFF, 0xEA, 0x55, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xE0,
-    0x00, 0x04, 0x07, 0xFF, 0xFF, 0xFF, 0xF5, 0x06, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE2, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF8,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFC,
-    0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00,
-    0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0xFF,
-    0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0,
-    0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xEA, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x02, 0xFC,
-    0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0xFF, 0x80, 0x0B, 0xFE, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x1F, 0xFD, 0x03, 0xFF,
-    0xC0, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7,
-    0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xA9, 0x00, 0x3F, 0xE0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0A, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x02, 0xA0, 0x00,
-    0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0,
-    0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4,
-    0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0xC0, 0x00,
-    0xBF, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x01, 0x40, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xF6, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xA4, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2A, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xEB,
-    0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x95, 0xB4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xD0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x3F,
-    0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF9, 0x07, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xD1, 0xFE, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE5, 0x6D, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x03, 0xD0, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x9F, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F,
-    0x95, 0xB4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFC, 0x03, 0xD0, 0x1F, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xE4, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x10, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xF4,
-    0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x90, 0x7F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0xA9, 0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x95, 0xB4, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xD0, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xAF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x64, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x0A, 0xA0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE7, 0xD0, 0x00, 0x00,
-    0x00, 0xF9, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00,
-    0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0x00, 0x00, 0x7F, 0xC3,
-    0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0x1F, 0xF4, 0x00, 0x07, 0xC2, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x2F, 0xC0, 0xBE, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x07, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x03,
-    0xF0, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x2F, 0xE0, 0x2F, 0x80, 0x0F, 0xF4,
-    0x0F, 0xD0, 0x07, 0xFC, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0xFF, 0x42, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x06, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0,
-    0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x6F,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x1F, 0xD0, 0x0F,
-    0xD0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0xBF,
-    0x80, 0x2F, 0x80, 0x0F, 0xF4, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0x40, 0x3F, 0xF0, 0x03, 0xFD,
-    0x0B, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00,
-    0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00,
-    0xBE, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0x80, 0x0F, 0xF4,
-    0x00, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x2F, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD0,
-    0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xE0, 0x00, 0xFE, 0x0F, 0xD0, 0x01,
-    0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B,
-    0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x40, 0x1F, 0xF0, 0x3F, 0x40, 0x3F, 0xF0, 0x3F, 0xD0, 0xBF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0x80, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x05, 0x40, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xBE,
-    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x0B, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xE0, 0x00,
-    0xFE, 0x0B, 0xE0, 0x01, 0xFD, 0x0F, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03,
-    0xF8, 0x1F, 0xC0, 0x0B, 0xF8, 0x2F, 0x80, 0x0F, 0xF4, 0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0x40, 0x2F,
-    0xF0, 0x3F, 0x80, 0x7F, 0xE0, 0x3F, 0xFA, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x06, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x0A, 0x90, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x02,
-    0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x0F, 0xFF,
-    0x01, 0xFF, 0x80, 0x03, 0xFF, 0x43, 0xFF, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0xBF, 0xFF, 0x87,
-    0xFE, 0x00, 0x03, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0xC0, 0x00, 0x3F, 0xF7, 0xFF, 0xFF, 0xDF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xBF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00,
-    0x02, 0xFD, 0x1F, 0xE0, 0x2F, 0x00, 0xFF, 0x07, 0xF8, 0x1F, 0xD0, 0xBF, 0x41, 0xFE, 0x1F, 0xF8,
-    0x7F, 0xC0, 0x7F, 0x8F, 0xFF, 0x3F, 0xD0, 0x1F, 0xFF, 0xFF, 0xEF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xBF, 0xFE,
-    0x00, 0x07, 0xFF, 0x8F, 0xFF, 0x00, 0x01, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0x47, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B, 0xFC,
-    0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00,
-    0x00, 0x2F, 0xF3, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05,
-    0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00,
-    0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF0, 0x00, 0x15, 0x54, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5,
-    0x55, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xA0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x55, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0x40, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xF1,
-    0xFE, 0x02, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF0, 0xBF, 0xC7, 0xC3, 0xEF,
-    0xFE, 0x2F, 0x1F, 0xF0, 0x7C, 0x2F, 0x40, 0x01, 0x6A, 0xBF, 0xD0, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
-    0xFF, 0xE2, 0xAA, 0xA5, 0x54, 0x00, 0x00, 0x05, 0x55, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xE6, 0xAA, 0xAA, 0x55, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE2, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xF8, 0x0B, 0xFF, 0xF4, 0x00, 0x6A, 0x90, 0x00, 0x01, 0x50, 0x3F, 0xC0, 0xFF,
-    0x0B, 0xFC, 0x3F, 0xF2, 0xFF, 0x80, 0x03, 0xF0, 0x7F, 0x02, 0xFC, 0x2F, 0xC0, 0xFF, 0x0F, 0xF0,
-    0xBF, 0xCB, 0xFC, 0x3F, 0xE3, 0xFE, 0x00, 0x3E, 0x1F, 0xD0, 0xB4, 0xF8, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x82, 0xFF, 0x4F, 0x7D, 0x7F, 0xF0, 0xFF, 0x80, 0xA4, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x54, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02,
-    0xF8, 0x0F, 0xE1, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFD,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x03,
-    0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x2A, 0x90, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x1A, 0xA0, 0x01, 0x50,
-    0x0F, 0xC2, 0xBF, 0x2F, 0xF4, 0xFF, 0xC0, 0x3F, 0x00, 0xF8, 0x00, 0x14, 0x01, 0xF4, 0x03, 0xFA,
-    0x0F, 0xFD, 0x1F, 0xF8, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0xA9, 0x50, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x07, 0xD0, 0x2F, 0x01, 0xFC, 0x3F, 0xD0, 0xFE, 0x03, 0xE0, 0x04, 0x00, 0x00, 0x00,
-    0x2D, 0x0F, 0xD2, 0xF4, 0x2F, 0x42, 0xF4, 0x0B, 0x00, 0x00, 0x05, 0x00, 0x2F, 0x06, 0xBC, 0x1F,
-    0xF4, 0x7F, 0xFC, 0x6F, 0xF0, 0x01, 0x80, 0x64, 0x01, 0xFF, 0x97, 0xFF, 0xC2, 0xFF, 0x0B, 0xC4,
-    0x1F, 0x00, 0x00, 0x00, 0x03, 0x40, 0x70, 0xBF, 0xE1, 0xE4, 0x0D, 0x00, 0x00, 0x05, 0x6A, 0xBF,
-    0xC1, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xD6, 0xAA, 0xA5, 0x54, 0x0B, 0xF0, 0x3F, 0xC2, 0xFF,
-    0x0F, 0xFC, 0xBF, 0xE1, 0x55, 0x40, 0x0B, 0xF0, 0xBF, 0x0F, 0xE0, 0xFE, 0x2F, 0xE2, 0xFE, 0x3F,
-    0xD3, 0xFD, 0x7F, 0xD7, 0xFC, 0x00, 0x00, 0x2F, 0x82, 0xFF, 0x4F, 0x7D, 0x7F, 0xF0, 0xFF, 0x80,
-    0xA4, 0x00, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x1A, 0xA0, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x0B,
-    0xE0, 0x0F, 0xF8, 0x14, 0xBC, 0x2F, 0xF8, 0x3F, 0xF0, 0x2A, 0x40, 0x00, 0x14, 0x01, 0xFD, 0x0B,
-    0xF8, 0x1F, 0xD0, 0x3F, 0x40, 0x3F, 0xFC, 0x3F, 0xFC, 0x0B, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x03,
-    0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0x47, 0xF4, 0x7F, 0x07, 0xF0, 0xBE, 0x0B,
-    0xF0, 0x3F, 0xC0, 0x02, 0xFC, 0x0F, 0xF0, 0x2F, 0xE0, 0x07, 0xFE, 0xFF, 0x40, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFE, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x7C, 0x1F, 0xF8, 0x7D, 0x3F, 0xFC, 0xBC, 0x7D, 0x7F, 0xF8, 0xBC, 0x3F, 0xF0,
-    0x7C, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF1, 0xFE, 0xAA, 0xA4,
-    0x00, 0x15, 0x6A, 0x90, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFA, 0xA9, 0x02, 0xF8,
-    0x2F, 0x02, 0xFF, 0x4B, 0xC0, 0xFF, 0xF3, 0xE0, 0xBC, 0xBF, 0xF4, 0x3F, 0x0F, 0xFC, 0x0B, 0xC1,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8,
-    0x03, 0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x3F, 0x40, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x1F, 0xD0, 0x3F, 0xC0, 0xFE, 0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x6A, 0xAA, 0xA8, 0x02, 0xAA, 0xAA, 0x01, 0xFF, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xE0, 0x3F, 0x02, 0xF0, 0x0F, 0x80, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFB, 0xE0, 0x2F, 0xFF, 0xD0, 0xF3, 0xFF, 0x47, 0x8F, 0x7C, 0x3D, 0x7C,
-    0xF0, 0xF2, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x07, 0x4E, 0x00, 0xFE, 0x00, 0x2E, 0x00, 0x1F, 0xC0,
-    0x2D, 0xF4, 0x19, 0x19, 0x00, 0x0B, 0xD1, 0xF0, 0xBF, 0xC7, 0xC3, 0xEF, 0xFE, 0x2F, 0x1F, 0xF0,
-    0x7C, 0x2F, 0x40, 0x00, 0x01, 0xE0, 0x1F, 0xC2, 0xFC, 0x2F, 0xC3, 0xF4, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFF, 0x00, 0xBF, 0x8F,
-    0xF8, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xFC, 0x2F, 0x82, 0xFC, 0x3F, 0x43, 0xF8, 0x3F, 0x03, 0xF4, 0x00, 0x56, 0xAB, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x0A, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x15,
-    0x40, 0x00, 0x00, 0x01, 0x50, 0x15, 0x01, 0xFC, 0x0F, 0xC0, 0xBE, 0x0B, 0xF0, 0x3F, 0x43, 0xF8,
-    0x1F, 0xC0, 0xFD, 0x0B, 0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0x81, 0xFD, 0x1F, 0xD0, 0x0A, 0x55, 0x41,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xD3, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1F, 0xFD, 0xBC, 0x00, 0x07, 0xFF, 0x8B, 0xD0, 0x00, 0xFF, 0xF8, 0xFC, 0x00, 0x2F, 0xAF, 0xFF,
-    0x80, 0x03, 0xFB, 0xFF, 0xF0, 0x00, 0x3F, 0xF3, 0xFD, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFC, 0x02, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0F, 0xF0,
-    0x2F, 0xEB, 0xF1, 0xFD, 0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0B, 0xF0, 0x1F,
-    0xEB, 0xF1, 0xFE, 0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x2F, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x04, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x0B, 0xC0, 0xB0,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x2F, 0x40, 0x00, 0x00,
-    0x1F, 0xE0, 0xFE, 0x40, 0x00, 0x6F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0xFF, 0xFF,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xF9, 0x55, 0x5B, 0xFF, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x3E, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xD0,
-    0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
-    0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA,
-    0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xD5, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x03, 0xFD, 0x00, 0x00,
-    0x7F, 0xC0, 0x03, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x1F, 0xFF,
-    0x40, 0x00, 0x3F, 0xC0, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x06, 0xB8, 0x0A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xD5,
-    0x55, 0x50, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x41, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x0B, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x0B, 0xFE,
-    0x00, 0xFF, 0xE4, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x07,
-    0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0,
-    0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x40, 0x00,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x2B, 0xF4, 0x00,
-    0x00, 0x07, 0xF0, 0x7F, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFE, 0x1F, 0xE0, 0x00, 0xFF, 0x8F,
-    0xF8, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0x91, 0xBF, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xFF, 0xF9,
-    0x00, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xE0, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
-    0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xEA, 0xFF, 0xF0,
-    0x07, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0xF8,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x7F, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x0B, 0xF0, 0x00,
-    0x7F, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x0B, 0xE0, 0x0B, 0xF8, 0x0F, 0xD0, 0x00, 0xFF, 0xAB, 0xFF,
-    0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7E,
-    0xAB, 0xFF, 0xAB, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x47,
-    0xFC, 0x00, 0x7F, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xF8,
-    0x00, 0xFF, 0xC0, 0x03, 0xF4, 0x01, 0xFF, 0x80, 0x07, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF0, 0x03,
-    0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xE0, 0x0B, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x6E,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xDB, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x41, 0xFF, 0xFE, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0xFF,
-    0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xE0, 0x00,
-    0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xE0, 0x3F, 0xFF, 0xF0,
-    0x00, 0xBF, 0x42, 0xFE, 0xFF, 0x80, 0x03, 0xFC, 0x2F, 0xEB, 0xFD, 0x00, 0x1F, 0xF1, 0xFF, 0x3F,
-    0xF0, 0x00, 0xBF, 0x8F, 0xF1, 0xFF, 0xC0, 0x03, 0xFD, 0xFF, 0x4F, 0xFE, 0x00, 0x0F, 0xFF, 0xF8,
-    0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x0F, 0xFF,
-    0xC0, 0x7F, 0xF4, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0xBF, 0x40, 0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x40, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x6F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0xBF, 0x40, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x01, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xEF, 0xC0, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x2F,
-    0xD1, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F,
-    0xE0, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F,
-    0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2A, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x07, 0xFA, 0xBF, 0xF0, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x03, 0xE0, 0x00,
-    0xFC, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0x55, 0x6F, 0x80, 0x03, 0xF0, 0x00, 0x7D,
-    0x00, 0x7E, 0x00, 0x07, 0xE0, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x7F, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xF5, 0x55, 0x54, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1A,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xD0,
-    0x00, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x15, 0x40, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x05, 0x55, 0x5A, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA,
-    0xAC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF5, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xFF,
-    0xFF, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFE,
-    0x0F, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFE, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF1, 0xFF, 0xF5, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xEB, 0xFF, 0xDF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xEB, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x3F, 0xF4, 0xFF, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0xFF, 0xC1, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x07, 0xFE, 0x03, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xD0, 0x2F, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1A, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x24, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x10, 0x00,
-    0x7F, 0xD0, 0x3E, 0x5B, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xF8, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x2F,
-    0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x1F, 0xFF, 0x80, 0x03, 0xFC, 0x00,
-    0xFF, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xC0, 0x02, 0xFD,
-    0x0B, 0xFB, 0xFE, 0x00, 0x0F, 0xF0, 0xBF, 0xAF, 0xF4, 0x00, 0x7F, 0xC7, 0xFC, 0xFF, 0xC0, 0x02,
-    0xFE, 0x3F, 0xC7, 0xFF, 0x00, 0x0F, 0xF7, 0xFD, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFE, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x01, 0xFF,
-    0xD0, 0x01, 0xFF, 0xF4, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0x00,
-    0x0B, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0xFF,
-    0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xE0, 0x3F, 0xFF, 0xF0, 0x00,
-    0xBF, 0x42, 0xFE, 0xFF, 0x80, 0x03, 0xFC, 0x2F, 0xEB, 0xFD, 0x00, 0x1F, 0xF1, 0xFF, 0x3F, 0xF0,
-    0x00, 0xBF, 0x8F, 0xF1, 0xFF, 0xC0, 0x03, 0xFD, 0xFF, 0x4F, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x3F,
-    0xF0, 0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x02, 0xFD, 0x07, 0xFE, 0x00,
-    0x00, 0x0F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFE, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x02,
-    0xFE, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0x80, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00,
-    0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00,
-    0x0F, 0xF8, 0x0B, 0xFC, 0x00, 0x06, 0xFF, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x1F, 0xF4, 0x00,
-    0x2F, 0xFD, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x0B, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xE0, 0x02, 0xFE, 0xFF, 0x3F, 0xEF, 0xD0, 0x03, 0xFD, 0xFF, 0xBF, 0xBF, 0xC0, 0x07, 0xFC, 0xFF,
-    0xFF, 0x3F, 0xC0, 0x0B, 0xF8, 0xFF, 0xFD, 0x7F, 0x80, 0x0F, 0xF4, 0xFF, 0xF8, 0xBF, 0x40, 0x0F,
-    0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x1F, 0xF0, 0xFF, 0xD1, 0xFF, 0x00, 0x2F, 0xE0, 0xFF, 0xC2, 0xFE,
-    0x00, 0x3F, 0xD0, 0xAA, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x6A, 0x40, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD,
-    0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xA6, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x5B, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0x95, 0x5B, 0xF4, 0x00, 0xFF, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF4,
-    0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x6A, 0x40, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x01, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x0F, 0xF4,
-    0x00, 0x3F, 0xE5, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE5, 0x5B, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x00,
-    0x3F, 0x80, 0x01, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x00, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x03, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF6, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x3F, 0xC0, 0xBC, 0x3F, 0x02,
-    0xFE, 0x00, 0xF5, 0xF0, 0x0F, 0xF4, 0x0B, 0xCB, 0xC0, 0x3F, 0xC0, 0x3F, 0x2F, 0x42, 0xFF, 0x07,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x0A, 0x80, 0x01, 0xA4, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xD0,
-    0x02, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x01, 0xFC,
-    0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x3F,
-    0x80, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x00, 0x00, 0x50, 0x00, 0x14, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x01, 0xFC, 0x07, 0xD0, 0x02,
-    0xF8, 0x0F, 0xC0, 0x03, 0xF4, 0x0F, 0x40, 0x07, 0xF0, 0x2F, 0x00, 0x0B, 0xF0, 0x3E, 0x00, 0x0F,
-    0xE0, 0x3D, 0x00, 0x3F, 0xD0, 0x7E, 0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x01, 0x54, 0x00, 0xFF, 0x02, 0xFD, 0x0F, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0x40, 0x1F,
-    0xE0, 0x3F, 0x82, 0xFC, 0x00, 0xBF, 0x41, 0xFD, 0x0F, 0xF0, 0x03, 0xFC, 0x0B, 0xF0, 0x3F, 0x80,
-    0x0F, 0xF0, 0x3F, 0xC1, 0xFD, 0x00, 0x7F, 0x80, 0xFE, 0x0B, 0xF0, 0x02, 0xFD, 0x07, 0xF4, 0x3F,
-    0x80, 0x0F, 0xF0, 0x2F, 0xC0, 0xFD, 0x00, 0x7F, 0x80, 0xFF, 0x07, 0xF0, 0x02, 0xFD, 0x03, 0xF8,
-    0x2F, 0xC0, 0x0F, 0xF0, 0x1F, 0xC0, 0xFE, 0x00, 0x3F, 0xC0, 0xBF, 0x03, 0xF4, 0x01, 0xFE, 0x03,
-    0xF8, 0x1F, 0xC0, 0x0B, 0xF4, 0x0F, 0xD0, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xA8, 0x0F, 0xE0, 0x03, 0xFC, 0x0F, 0xF0,
-    0x7F, 0x40, 0x1F, 0xF0, 0x3F, 0xC2, 0xFC, 0x00, 0xBF, 0x41, 0xFE, 0x0F, 0xF0, 0x03, 0xFC, 0x0B,
-    0xF4, 0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0xC1, 0xFD, 0x00, 0x7F, 0x80, 0xFE, 0x0B, 0xF0, 0x02, 0xFC,
-    0x07, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x2F, 0xC0, 0xFE, 0x00, 0x3F, 0x80, 0xFF, 0x07, 0xF4, 0x01,
-    0xFD, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xF0, 0x1F, 0xD0, 0xBF, 0x00, 0x3F, 0x80, 0xBF, 0x03, 0xF8,
-    0x00, 0xFD, 0x03, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x0F, 0xD0, 0x7F, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x55, 0x55, 0x55, 0x56, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xE0, 0x0F, 0xF0, 0x03,
-    0xF4, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x3F, 0xEA, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x06, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xF0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFE, 0x80, 0x00,
-    0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF8, 0x00,
-    0xBE, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x0B, 0xFC, 0x00, 0xBF, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x03, 0xFE, 0xAF, 0xFD, 0x00, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xF4, 0x02, 0xFF,
-    0xFF, 0x90, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x02, 0xF8, 0x03, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x3F, 0x00,
-    0x3F, 0xC1, 0xFC, 0x02, 0xFE, 0x0F, 0xFA, 0xBF, 0xF4, 0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xF9, 0x07, 0xFF, 0x80, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0x7F, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xBD, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFC, 0x1F, 0xFE, 0xAF, 0xE0, 0x00, 0xFC, 0x3F, 0xE0, 0x0B, 0xF0, 0x01, 0xF8, 0x7F, 0x80, 0x03,
-    0xF0, 0x02, 0xF4, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xFC,
-    0x00, 0x07, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xD0, 0x0F,
-    0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0x0F, 0x8B, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0x4B, 0xFC, 0x02, 0xFF,
-    0x00, 0x2F, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x3E, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7C, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00,
-    0x1F, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x7F, 0xF8, 0x00, 0x0F,
-    0xF4, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x02, 0xFF,
-    0x80, 0x7F, 0xF0, 0x01, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xBF, 0xFC,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFE, 0x07, 0xFD, 0x03, 0xF8, 0x02,
-    0xFC, 0x07, 0xF0, 0x02, 0xFC, 0x0B, 0xD0, 0x02, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x40, 0x03,
-    0xF8, 0x2F, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x1B, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x6A, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFE,
-    0x07, 0xFF, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xFA, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xD1, 0x7F, 0x00, 0x7F, 0x00, 0xBC, 0x02,
-    0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0F, 0xEA,
-    0xAF, 0xC0, 0x3F, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0xFD, 0x0B, 0xFA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x4F, 0xF4,
-    0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x7F, 0x07, 0xF8, 0x00, 0x03,
-    0xFC, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x0F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x03, 0xFC, 0x01, 0xF4, 0x02, 0xFC, 0x05, 0xBE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE, 0xA5, 0x50, 0x0B, 0xF0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x01, 0xAA, 0x80, 0xAA,
-    0x40, 0x2A, 0x80, 0x6A, 0x90, 0x0F, 0xFD, 0x0B, 0xF8, 0x03, 0xFC, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x7F, 0x80, 0xBF, 0x43, 0xFE, 0x00, 0x01, 0xFF, 0x87, 0xFC, 0x0F, 0xF0, 0xFF, 0x80, 0x00, 0x0B,
-    0xFC, 0x7F, 0xC1, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF3, 0xFC, 0x3F, 0xCF, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xBF, 0xC7, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x2F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC2, 0xFF,
-    0xD2, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x2F, 0xFC, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x03,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xF8, 0x01, 0x40, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x05, 0xF4, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0,
-    0x0E, 0x5F, 0xE0, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x2F, 0xF9, 0x00, 0x00, 0xFD, 0x00, 0x1F,
-    0xE0, 0x0F, 0xC0, 0x07, 0xFD, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0x2F, 0x80, 0x7F, 0xFC, 0x03, 0xF8,
-    0x0F, 0xFF, 0x80, 0x7F, 0x43, 0xFF, 0xF8, 0x0B, 0xF0, 0xFF, 0x7F, 0x40, 0xFF, 0x3F, 0xD7, 0xF0,
-    0x0F, 0xEF, 0xF4, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xE0, 0x2F, 0xFF, 0x81, 0xFD, 0x03, 0xFF, 0xE0,
-    0x3F, 0xC0, 0x3F, 0xFC, 0x03, 0xFC, 0x07, 0xFF, 0x00, 0x7F, 0x80, 0xBF, 0xC0, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x05, 0x40, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x7F,
-    0x80, 0x01, 0xF4, 0x1F, 0xF4, 0x00, 0x2F, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0xFF, 0xF0, 0x00, 0x3E,
-    0x2F, 0xFE, 0x00, 0x0B, 0xCB, 0xDF, 0xD0, 0x00, 0xFD, 0xF5, 0xFC, 0x00, 0x0F, 0xFE, 0x3F, 0x80,
-    0x01, 0xFF, 0xC3, 0xF4, 0x00, 0x2F, 0xF0, 0xBF, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x7F, 0x81,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x40, 0x03, 0xF4, 0xBF, 0x40, 0x01, 0xFC, 0xBF, 0x40,
-    0x00, 0xFD, 0x7F, 0x40, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0x6F, 0xFC, 0x00, 0x2F, 0xC3, 0xFF, 0xC0, 0x0F, 0xE0, 0x7F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFA, 0xBE, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x3F,
-    0x0F, 0xC0, 0x02, 0xF4, 0x3E, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x3E, 0x0F, 0xC0, 0x02, 0xF4, 0x3F,
-    0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x7E, 0x0B, 0xD0, 0x0B, 0xF4, 0x3F, 0x00, 0x3F, 0xC1, 0xFC, 0x01,
-    0xA8, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x50, 0x01, 0xFE, 0x00,
-    0x1F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xF0,
-    0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x3F, 0xFD, 0x2F, 0xFD, 0x00, 0xFB, 0xF9, 0xFF, 0xF0, 0x0B, 0xEF,
-    0xEF, 0xEF, 0xC0, 0x3F, 0x7F, 0xFE, 0xBF, 0x00, 0xFC, 0xFF, 0xF3, 0xF8, 0x07, 0xF2, 0xFF, 0x9F,
-    0xD0, 0x3F, 0xCB, 0xFC, 0xBF, 0x00, 0xFE, 0x1F, 0xD3, 0xFC, 0x07, 0xF4, 0x7F, 0x1F, 0xE0, 0x2F,
-    0xC0, 0x50, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F,
-    0x80, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xD0, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFE, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0xBF, 0x00,
-    0x0B, 0xF0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x01, 0xFE, 0x07, 0xF4, 0x00, 0xFF, 0x01, 0xFF,
-    0x01, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x7F,
-    0x80, 0x07, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x01, 0xFE,
-    0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xD6, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x1F, 0xF8, 0x00,
-    0xBC, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0xF8, 0x00, 0x03, 0xFD, 0x00,
-    0x1F, 0x40, 0x00, 0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x6A, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x90,
-    0x50, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x1F, 0xFA, 0xF8, 0x00, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x54, 0x1F, 0xC0, 0x14, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x1F,
-    0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xF3, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xA5,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x0F, 0xC0,
-    0x7F, 0x40, 0xFF, 0x01, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0x3F, 0x80, 0x3F, 0x83, 0xF8, 0x03, 0xF4,
-    0x03, 0xF8, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0x43, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0x40, 0xFE,
-    0x03, 0xFF, 0x03, 0xFD, 0x5F, 0xE6, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x47, 0xFE, 0x00, 0x03, 0xFF,
-    0x40, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x07, 0xF4,
-    0x03, 0xFC, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x03, 0xF8, 0x01,
-    0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x01, 0x00, 0x14, 0x2D, 0x02, 0xD0, 0xF0, 0x0F, 0x07, 0x40, 0x7C, 0x3C,
-    0x02, 0xE0, 0xE0, 0x1F, 0x47, 0xC1, 0xFC, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x19, 0x2E, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x01, 0x54, 0x0F, 0xE0, 0x0F, 0xF0,
-    0x3F, 0xC1, 0xFD, 0x01, 0xFE, 0x03, 0xFC, 0x2F, 0xC0, 0x2F, 0xD0, 0x7F, 0x43, 0xFC, 0x03, 0xFC,
-    0x0B, 0xF0, 0x3F, 0x80, 0x3F, 0xC0, 0xFF, 0x07, 0xF4, 0x07, 0xF8, 0x0F, 0xE0, 0xBF, 0x00, 0xBF,
-    0x41, 0xFD, 0x0B, 0xF0, 0x0F, 0xF0, 0x1F, 0xC0, 0xFE, 0x00, 0xFF, 0x02, 0xFC, 0x0F, 0xD0, 0x1F,
-    0xE0, 0x3F, 0x81, 0xFC, 0x02, 0xFC, 0x03, 0xF4, 0x2F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0x01, 0x54, 0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC1, 0xFD, 0x01, 0xFE, 0x03, 0xFC, 0x2F,
-    0xC0, 0x2F, 0xD0, 0x7F, 0x43, 0xFC, 0x03, 0xFC, 0x0B, 0xF0, 0x3F, 0x80, 0x3F, 0xC0, 0xFF, 0x07,
-    0xF4, 0x07, 0xF8, 0x0F, 0xE0, 0xBF, 0x00, 0xBF, 0x41, 0xFD, 0x0B, 0xF0, 0x0F, 0xF0, 0x1F, 0xC0,
-    0xFE, 0x00, 0xFF, 0x02, 0xFC, 0x0F, 0xD0, 0x1F, 0xE0, 0x3F, 0x81, 0xFC, 0x02, 0xFC, 0x03, 0xF4,
-    0x2F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xFF,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x01, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xE0, 0x3E,
-    0x03, 0xF4, 0x0F, 0xEF, 0xFC, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0x40, 0x00, 0x03, 0xF4, 0x01,
-    0xE0, 0x00, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x40, 0x1F,
-    0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xF0, 0x01, 0xF8, 0x00, 0xFF,
-    0xFF, 0x00, 0xBD, 0x00, 0x7C, 0x0B, 0xD0, 0x3F, 0x40, 0x3E, 0x01, 0xF4, 0x0F, 0xC0, 0x0F, 0x40,
-    0xFC, 0x0B, 0xF0, 0x07, 0xEB, 0xFE, 0x03, 0xFC, 0x02, 0xFF, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0xFE,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xA0, 0x00, 0x07, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x50, 0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x1F,
-    0x01, 0xF8, 0xBC, 0x03, 0xE3, 0xE0, 0x3F, 0x4F, 0xEF, 0xFC, 0x7F, 0xFF, 0xD3, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xE4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3E, 0x40, 0xFD, 0x00, 0x40,
-    0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x03, 0x80, 0x6F, 0xF4, 0x0F, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x1B, 0xF8, 0x00, 0x1F, 0x03, 0xFF, 0xF8, 0x00, 0xBC, 0x3F, 0xFF, 0xF4, 0x03,
-    0xE2, 0xFD, 0x03, 0xD0, 0x0F, 0x0F, 0xC0, 0x0F, 0x80, 0x7D, 0xBD, 0x00, 0x3E, 0x02, 0xFF, 0xF0,
-    0x00, 0xF4, 0x0F, 0xFF, 0x40, 0x07, 0xC0, 0x3F, 0xFC, 0x00, 0x3F, 0x01, 0xF7, 0xF0, 0x01, 0xF8,
-    0x0B, 0x4F, 0xE0, 0x2F, 0xC0, 0x3C, 0x3F, 0xFF, 0xFE, 0x00, 0xF0, 0xBF, 0xFF, 0xF0, 0x07, 0x80,
-    0xFF, 0xFF, 0x00, 0x2D, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0x80, 0x3F, 0x01, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x2F, 0x42, 0xF4,
-    0x02, 0xF4, 0x1F, 0xD0, 0x2F, 0x80, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x0F, 0xE0, 0xBF, 0xC1, 0xFD, 0x03, 0xFC, 0x3F, 0xD0, 0x3F, 0xD3, 0xFD, 0x03, 0xFD, 0x7F, 0xE0,
-    0x3F, 0xEB, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xD0, 0x02, 0xFC, 0x05,
-    0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFE, 0xA5, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x1F,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0xBF, 0x8B, 0xF8, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xEF, 0xF0, 0x00, 0x0F, 0xF0, 0x07, 0xD0, 0x00, 0xBF, 0x01, 0x6F, 0x80, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xA9,
-    0x54, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x1F, 0x40,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0x40, 0x00, 0x6B, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF5, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xDB, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x42,
-    0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0xFC, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F,
-    0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x7F, 0xC0, 0x07, 0xF4, 0x0B, 0xF8, 0x00, 0xBF,
-    0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4, 0x02, 0xFE, 0x02, 0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xF0,
-    0x17, 0xFD, 0x00, 0x6B, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0x41, 0xFC,
-    0x01, 0xFC, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x14, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE4, 0x5F, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x95, 0xB4,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC,
-    0x03, 0xD0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x40,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFD, 0x00, 0x03,
-    0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0x6F, 0x80, 0x00, 0x02, 0xF4, 0x2F, 0x41, 0xFD, 0x1F, 0xD0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xFC,
-    0x2F, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x7C, 0x07, 0x80, 0x00, 0x0B, 0x80, 0xFF, 0xF4,
-    0x00, 0xF0, 0x0F, 0xFF, 0xD0, 0x1F, 0x01, 0xF0, 0x3E, 0x02, 0xE0, 0x2E, 0x03, 0xE0, 0x3D, 0x03,
-    0xD0, 0x7E, 0x07, 0xC0, 0x3E, 0x6F, 0xC2, 0xF8, 0x07, 0xFF, 0xF8, 0x7F, 0x00, 0xBF, 0xFD, 0x07,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x28, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x0B, 0x40, 0x00,
-    0x3E, 0x00, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x0B, 0x80, 0x2E,
-    0x07, 0xD0, 0xF4, 0x03, 0xD0, 0x3D, 0x1F, 0x00, 0x3C, 0x0B, 0xC2, 0xF0, 0x07, 0xDB, 0xFC, 0x3E,
-    0x00, 0xFF, 0xFF, 0x43, 0xD0, 0x0F, 0xFF, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xC1, 0x40, 0x00, 0x6B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xF5, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x42, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0xFC, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F,
-    0x40, 0x7F, 0xC0, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4,
-    0x02, 0xFE, 0x02, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x6B, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x0B, 0xF4, 0x00, 0x0F, 0xD2, 0xFD, 0x00, 0x01, 0xFC, 0xBF, 0x40, 0x00, 0x3F, 0x5F,
-    0xD0, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xDB, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFC, 0x00, 0x3F, 0x81, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x7F,
-    0xD0, 0x1F, 0xC0, 0x1F, 0xFC, 0x02, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0x80, 0xFF, 0xF8, 0x07, 0xF4,
-    0x3F, 0xFF, 0x80, 0xBF, 0x0F, 0xF7, 0xF4, 0x0F, 0xF3, 0xFD, 0x7F, 0x00, 0xFE, 0xFF, 0x4F, 0xF0,
-    0x1F, 0xFF, 0xE0, 0xFE, 0x02, 0xFF, 0xF8, 0x1F, 0xD0, 0x3F, 0xFE, 0x03, 0xFC, 0x03, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x7F, 0xF0, 0x07, 0xF8, 0x0B, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x1F,
-    0xD0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0x3F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x05, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0xF8, 0x02, 0xF4, 0x01, 0xF4, 0x03, 0xF0,
-    0x02, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x03, 0xE0, 0x0B, 0xD0, 0x07, 0xD0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x1F, 0x80, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFD, 0x02, 0xF8, 0x0F, 0xF4, 0x01, 0xF8, 0x0F, 0xF0, 0x02, 0xF4, 0x0F, 0xF5,
-    0x5B, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x80, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x40, 0x17, 0xFD, 0x55, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xAF, 0xF0, 0x0F, 0xF4, 0x03, 0xF4, 0x0F, 0xF0,
-    0x03, 0xF0, 0x1F, 0xE0, 0x0B, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC7, 0xF8, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x2F,
-    0xD1, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0x03, 0xF8, 0x0F, 0xE0,
-    0x00, 0x0F, 0xF4, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0xBF, 0xC0, 0xFF, 0x01, 0xFF, 0x00, 0x07, 0xFD,
-    0x03, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xF4, 0x1F, 0xE0, 0x00, 0x0F, 0xF2, 0xFD, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xFD, 0xF8, 0x00, 0x0B, 0xD3,
-    0xE2, 0xF0, 0x00, 0x7F, 0x1F, 0x4B, 0xC0, 0x03, 0xF0, 0xBC, 0x2F, 0x00, 0x2F, 0xC3, 0xF0, 0xBD,
-    0x01, 0xFD, 0x2F, 0x82, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0,
-    0x03, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFE,
-    0x47, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x96, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x03,
-    0xFC, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0x82, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x9B, 0xF4, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00,
-    0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFC,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xD2, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xD0, 0x00, 0x3F, 0xF0,
-    0xBE, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x0B,
-    0xF0, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x07,
-    0xF6, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x1A, 0xAB, 0xF8, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x55, 0x50, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xF5, 0x55, 0x54, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x02, 0xF5, 0x55,
-    0x40, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0x7F, 0x40, 0x0F, 0xF4, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0xF4, 0x00,
-    0xBF, 0xC0, 0xFF, 0xD0, 0x00, 0xAF, 0x80, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC1, 0xF4, 0x0B, 0xC0, 0x3D, 0x03, 0xE0, 0x0F, 0x00, 0xF4, 0x1F,
-    0xC0, 0x7C, 0x3F, 0xC0, 0x2F, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0x43, 0xFF, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFF, 0xD1, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0x7F, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xF8, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xEB, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xEB, 0xFF, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x3F, 0xF8, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xFE,
-    0x40, 0x02, 0xFF, 0xFD, 0x07, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x2F, 0xFC, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0xFF, 0xF0, 0xFE, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0xBF, 0x00, 0x00, 0x3F, 0x4F, 0xFC,
-    0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xFE, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0xFF, 0x7F, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xF4, 0x00, 0x01, 0xFF, 0x8F, 0xE3, 0xFF, 0x00,
-    0x02, 0xFF, 0x87, 0xF4, 0xBF, 0xF4, 0x03, 0xFF, 0x82, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x1A, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x24, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x1F, 0xD0, 0x10, 0x00, 0x7F, 0xD0, 0x3E, 0x5B, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x01,
-    0xFF, 0xF8, 0x01, 0x40, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x05, 0xF4, 0x00, 0xFF, 0xD0, 0x01, 0xFF,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x0E, 0x5F, 0xE0, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0x40,
-    0x2F, 0xFF, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0xC0, 0x01, 0xAB, 0xC0, 0x02,
-    0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x0B, 0xFE,
-    0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0x47, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x1F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x43, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFC, 0x0B, 0xFF, 0xF8, 0xA8, 0x3F, 0xF0, 0x0F, 0xFF, 0xF7, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x2F, 0x07, 0xF0, 0x00, 0xFC, 0x3F, 0x40, 0x07, 0xD3, 0xF4,
-    0x00, 0x2F, 0x3F, 0x80, 0x00, 0xFA, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0B, 0xEF,
-    0xF8, 0x00, 0x3F, 0x2F, 0xF4, 0x01, 0xFC, 0x3F, 0xF4, 0x0F, 0xE0, 0xBF, 0xFB, 0xC0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFD,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xAF, 0x02, 0xFF,
-    0x80, 0x00, 0x02, 0xFD, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF3, 0xF2, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0x8F, 0xEF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0xFD, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xC7, 0xF3, 0xFF, 0xF0, 0x00, 0x03, 0xFE,
-    0x1A, 0x43, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x05, 0x50, 0x00, 0x00, 0x15, 0x55, 0x40,
-    0x00, 0x1A, 0x00, 0x06, 0xA0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x03, 0xF4, 0x00, 0x2F,
-    0x10, 0x3F, 0x40, 0x00, 0xFB, 0xC3, 0xF8, 0x00, 0x07, 0xDF, 0x3F, 0x80, 0x00, 0x2F, 0xBF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xEF, 0xFF, 0x80, 0x00, 0x2F, 0x3E, 0xFF, 0x40, 0x00,
-    0xFC, 0xF2, 0xFF, 0x00, 0x07, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0x0B, 0xFD, 0x00, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x02, 0xFE, 0x07, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07,
-    0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFD, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x87, 0xF8,
-    0x00, 0x3F, 0x2F, 0xE0, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFB, 0xFF, 0x80, 0x1F, 0xF3, 0xFF, 0xE0, 0x2F, 0xE1, 0xFF, 0xF4, 0x3F, 0xD0, 0xBF, 0xFD,
-    0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xE0, 0x3F, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF3,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x07,
-    0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC2, 0xFC, 0x1F, 0xFF, 0x8B,
-    0xF0, 0x00, 0x2F, 0x1F, 0xC0, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x7D, 0xFD, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xEF, 0xF4, 0x00, 0x1F, 0xCF, 0xFC, 0x00, 0x2F, 0x87, 0xFF,
-    0x00, 0x3F, 0x43, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x55, 0x6F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xFD,
-    0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFD, 0x50, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0xBF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x02, 0xF8, 0x02, 0xF8, 0x00, 0xFD,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x1F, 0xC0, 0x0F, 0xE0, 0x0B, 0xFA, 0xAB,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xC0,
-    0x1F, 0xE0, 0x0F, 0xE0, 0x0B, 0xFA, 0x47, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0x80, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x55, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFA, 0xAF, 0xF0, 0x00, 0x00, 0x1F,
-    0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xFF,
-    0x40, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xF8, 0x07, 0xFC, 0x00, 0x7F, 0xF8, 0x00,
-    0x3F, 0x80, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0x03, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0xBF,
-    0x00, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x01, 0xFF, 0xD0, 0x7F, 0xFD, 0x02,
-    0xFE, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x80, 0x3F, 0xE0, 0x03, 0xFF, 0xC0, 0xBF, 0xE0, 0x02, 0xA8,
-    0x00, 0x2A, 0xBC, 0x0A, 0x90, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFD,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x80, 0x00,
-    0x07, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xFF, 0xFE, 0x40, 0x3F, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF9, 0x5F, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x40,
-    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x02,
-    0xFE, 0x02, 0xBF, 0xE0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0x40,
-    0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x86, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xE6,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xE0, 0x2F, 0xC0, 0x1F, 0xF4, 0x0B, 0xF4, 0x01, 0xFC,
-    0x03, 0xFE, 0x01, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0xC0, 0x2F, 0xC0, 0x03, 0xF4, 0x0B, 0xF4, 0x03,
-    0xF8, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xF8,
-    0x01, 0xFF, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x1F, 0xF0, 0x0F, 0xFA, 0xFF, 0xFD, 0x01, 0xFF, 0x40,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0x5F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B,
-    0xFE, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x15, 0x00, 0x00, 0xBF, 0xF9, 0xFF, 0xF0, 0x00, 0xBF, 0xEB, 0xFF, 0xFF, 0x00,
-    0x7F, 0x81, 0xFD, 0x0F, 0xC0, 0x3F, 0x80, 0xFC, 0x02, 0xF0, 0x1F, 0xC0, 0xBC, 0x00, 0xF8, 0x0F,
-    0xD0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0x80, 0xBF, 0x01, 0xFC, 0x0B, 0xD0, 0xBF, 0x00, 0x7F,
-    0x02, 0xF4, 0xBF, 0x90, 0x2F, 0xC0, 0xBF, 0xFF, 0xF8, 0x07, 0xFC, 0x2F, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x16,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0x90, 0x50, 0x3F, 0xC0, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02,
-    0xFF, 0x02, 0x00, 0x1F, 0xFE, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x9F, 0xFF,
-    0x80, 0x2F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x55, 0x56, 0xFE, 0x55, 0x54, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x45, 0x00, 0x00, 0x03, 0xFF, 0x2F, 0x80, 0x00,
-    0x07, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xDA, 0x00, 0x00, 0xBF, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x0B,
-    0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x3F,
-    0xC0, 0x2F, 0xD0, 0xBF, 0x40, 0x2F, 0xD0, 0xFF, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x1F, 0xE7, 0xF8,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x2F,
-    0xF0, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x00,
-    0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xFB, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x01, 0x54, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00,
-    0x2F, 0xD0, 0xBF, 0x40, 0x00, 0x2F, 0xE1, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x1F,
-    0xEB, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xDB, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x0F, 0xEF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F,
-    0xDB, 0xF4, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x2F, 0xE0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x55,
-    0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0x0B, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0xC0,
-    0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x6A, 0xAA, 0xAA, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x05, 0x55, 0x54, 0x00,
-    0x2F, 0xFF, 0xFC, 0x7C, 0x3F, 0xFF, 0xF8, 0xF8, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0xBC, 0x01, 0xF0,
-    0x00, 0xFC, 0x02, 0xF0, 0x01, 0xF8, 0x03, 0xE0, 0x02, 0xF4, 0x03, 0xD0, 0x03, 0xF0, 0x07, 0xC0,
-    0x03, 0xF0, 0x0B, 0xC0, 0x07, 0xE5, 0x5F, 0x90, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE9, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x07, 0xFC, 0x1F, 0xE0, 0x02, 0xFE, 0x0B, 0xF0, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0x3F, 0xC0, 0xFE, 0x00, 0x1F, 0xE0, 0x3F, 0x00, 0x0F, 0xF4, 0x0F, 0xC0, 0x07, 0xFC, 0x03, 0xF8,
-    0x1B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xEF, 0xF0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x7E, 0x2F, 0x40, 0xBD, 0x3F, 0x00, 0xFC, 0x3E, 0x00, 0xFC, 0x7C, 0x01,
-    0xF8, 0x7C, 0x03, 0xF0, 0x7C, 0x0B, 0xF0, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0A, 0x40, 0x00, 0x50, 0x00, 0x14, 0x03, 0xF0, 0x00, 0xFC,
-    0x03, 0xF0, 0x01, 0xFC, 0x07, 0xD0, 0x02, 0xF8, 0x0F, 0xC0, 0x03, 0xF4, 0x0F, 0x40, 0x07, 0xF0,
-    0x2F, 0x3F, 0x0B, 0xF0, 0x3E, 0x3F, 0x0F, 0xE0, 0x3D, 0x7E, 0x3F, 0xD0, 0x7E, 0xBE, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x3F, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x07, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x01, 0x40, 0x14, 0x2D, 0x02, 0xD0, 0xF0, 0x0F, 0x47, 0x40, 0x7C, 0x2C,
-    0xE2, 0xF0, 0xE7, 0x9F, 0x83, 0xEE, 0xFD, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x3F, 0x6E, 0x00,
-    0xB0, 0xF4, 0x02, 0x83, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0xBF, 0x01,
-    0xFF, 0x00, 0x1F, 0xC0, 0xBF, 0x40, 0x0B, 0xE0, 0x3F, 0xC0, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0xFD,
-    0x0B, 0xF4, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x0B,
-    0xF8, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x42, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0xFC,
-    0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x7F, 0xC0,
-    0x07, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF4, 0x02, 0xFE, 0x02,
-    0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x6B, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xA4, 0x3F, 0xF8, 0x07, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0x06,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xEA, 0x94, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x2F, 0xFF, 0x94, 0x5B, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3A, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xC0,
-    0x00, 0xFF, 0xFF, 0x03, 0xFE, 0x40, 0xFF, 0x5B, 0xD0, 0xBF, 0xFF, 0xFE, 0x00, 0xB8, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFA, 0x55, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x06, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x06, 0xFF,
-    0xD0, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xE4, 0x3F, 0xFD, 0x06, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xAA, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x41, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF0,
-    0x6F, 0xFE, 0x90, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3A, 0x00, 0x00, 0x6F, 0xE0, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0x03, 0xFE, 0x40, 0xFF, 0x5B,
-    0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0xBC, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xE9, 0x54, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x07, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xC2, 0xFF, 0x90, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE8, 0x00, 0x07,
-    0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0,
-    0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x40, 0x00,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x2B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x03, 0xFF,
-    0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFF, 0xD0, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF8,
-    0x3F, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xF8, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xC7, 0xFF, 0xD7, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xFF, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xAF, 0xFA, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xFF, 0xD3, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x43, 0xFF, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF4, 0x1F, 0xF8, 0x0F, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x0A, 0xA4, 0x02, 0xA8, 0x06, 0xA9,
-    0x00, 0xFF, 0xD0, 0xBF, 0x80, 0x3F, 0xC1, 0xFF, 0x80, 0x03, 0xFF, 0x07, 0xF8, 0x0B, 0xF4, 0x3F,
-    0xE0, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x1F, 0xD3,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xC3, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x7F,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xF2, 0xFF, 0xE7, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x2F, 0xFD, 0x2F, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0x02, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xF8, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xF4, 0x2F, 0xF0, 0x00, 0x0B, 0xF0, 0x7F, 0xD0,
-    0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xE3, 0xFD, 0x00, 0x00, 0x2F, 0xDF, 0xF8, 0x00, 0x00,
-    0x3F, 0xEF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFD, 0xBF,
-    0xFC, 0x00, 0x07, 0xFC, 0x07, 0xFF, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00,
-    0x6A, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x40, 0x03, 0xD1, 0xF8, 0x00, 0x7C, 0x7F, 0x00, 0x0F, 0xCF,
-    0xC0, 0x00, 0xFB, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0xFC, 0x7F, 0x80, 0x1F, 0x80, 0xFC, 0x02, 0xF4, 0x0B, 0xC0, 0x3F, 0x00, 0xFC,
-    0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x41,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0,
-    0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x80, 0x00, 0x0F, 0xF4,
-    0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x03, 0xFC,
-    0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x0B, 0xFC, 0x00, 0x06, 0xFF,
-    0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x2F, 0xFD, 0x02, 0xFF, 0xF8, 0x03, 0xFF,
-    0x40, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFA, 0xFD, 0x00, 0x0F, 0xC2, 0xF0, 0x00,
-    0x7E, 0x0F, 0xC0, 0x02, 0xF4, 0x3E, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x7E, 0x0F, 0xC0, 0x02, 0xF4,
-    0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x0B, 0xF4, 0x3F, 0xF0, 0x7F, 0xC1, 0xFF,
-    0x81, 0xA8, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x69,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x03,
-    0xF4, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x07, 0xF0, 0x07, 0xFE, 0xAB, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0,
-    0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0xD5, 0x55, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00,
-    0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x3F,
-    0xF8, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x0F, 0xD0, 0x0B, 0xD0,
-    0x03, 0xF0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x3F,
-    0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x07, 0xFE, 0xAB, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xF8,
-    0x03, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x07, 0xFC,
-    0x1F, 0xE0, 0x02, 0xFD, 0x0B, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x1F,
-    0xE0, 0x3F, 0x00, 0x0F, 0xF4, 0x0F, 0xC0, 0x07, 0xFC, 0x07, 0xF4, 0x1B, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xEF, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x2D, 0x02, 0xE0,
-    0xF0, 0x0F, 0x47, 0x80, 0x7C, 0x2C, 0x02, 0xF0, 0xF0, 0x1F, 0x83, 0xC1, 0xFD, 0x0F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xC0, 0x19, 0x6E, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x7E,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x3F,
-    0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x0F, 0xF7, 0xFF,
-    0x7F, 0xDF, 0xF0, 0x00, 0x3F, 0xCF, 0xFF, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF,
-    0x00, 0x0F, 0xFC, 0xBF, 0xFF, 0x5F, 0xF8, 0x00, 0x3F, 0xE2, 0xFF, 0xFC, 0xBF, 0xD0, 0x01, 0xFF,
-    0x4B, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xF0,
-    0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0xFF, 0x83, 0xFF, 0x40, 0x0B, 0xFE, 0x03, 0xFC, 0x2F, 0xFC, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xFC,
-    0x02, 0xFE, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x0B, 0xFF, 0x4B, 0xFF,
-    0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0xFF, 0xFB, 0xFB, 0xE0, 0x07, 0xEB, 0xFF, 0xBF, 0x40, 0x2F,
-    0x6F, 0xFD, 0xFC, 0x00, 0xFC, 0x7F, 0xEB, 0xF0, 0x07, 0xF1, 0xFF, 0x3F, 0x80, 0x2F, 0xC7, 0xF4,
-    0xFE, 0x00, 0xFE, 0x0F, 0xCB, 0xF4, 0x03, 0xF4, 0x14, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x7F, 0x40,
-    0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xEF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xBE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x02, 0xFC, 0x00,
-    0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00, 0x2F,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xEA, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD1,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03,
-    0xFE, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x07,
-    0xFF, 0x1F, 0xF8, 0x00, 0x05, 0x55, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x07, 0xF0, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x1F,
-    0x40, 0x03, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xEA,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xAB, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFA, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFA,
-    0xAA, 0xA0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xD0, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFC, 0x00, 0xFE, 0x07, 0xFF, 0xF0, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0xFC, 0x05, 0xBD, 0x07,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xBD, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x0F, 0xC0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD1, 0xF4, 0x00, 0x3F, 0xFA, 0xA5, 0x40, 0x2F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x10, 0x3F, 0xEA, 0xFF, 0xFF, 0x90, 0x1F, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0x80, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xBF, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x6A, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEA,
-    0xAC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7E,
-    0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFE, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xD0, 0x00, 0x0B, 0xF0, 0x16, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFA, 0x95, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x90, 0x1F, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAF, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0x90, 0x1B, 0xFF, 0xE0, 0x04, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFE, 0x95, 0x4B, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x1F,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF8, 0x0E, 0x40, 0x1F, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x2B, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xA9, 0x6F, 0xC0, 0x3E, 0x00, 0xBF, 0x40, 0x2F, 0xEB, 0xFE, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-    0xC0, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF1, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0x90, 0x1B, 0xFF, 0xE0, 0x04, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFE, 0x95, 0x4B, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x00, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x40, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xAF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xA9, 0x6F, 0xC0, 0x03, 0xE0, 0x0B, 0xF4, 0x00,
-    0x2F, 0xEB, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0xBF,
-    0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0x3F,
-    0xD7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x2F, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xFE, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xC3, 0xFF, 0xF4, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0xC7, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0xF7, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x8B, 0xFE, 0x3F, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0xFF, 0xC0,
-    0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xF4, 0x07, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x80, 0xAA, 0x40, 0x2A, 0x80, 0x6A, 0x90, 0x0F, 0xFD, 0x0B, 0xF8, 0x03, 0xFC,
-    0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x7F, 0x80, 0xBF, 0x43, 0xFE, 0x00, 0x01, 0xFF, 0x87, 0xFC, 0x0F,
-    0xF0, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x7F, 0xC1, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF3, 0xFC,
-    0x3F, 0xCF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC7, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x2F, 0xFE, 0x7F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xC2, 0xFF, 0xD2, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x2F, 0xFC, 0x0F, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00,
-    0x0F, 0xE0, 0xFE, 0x00, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x07, 0xFC, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x24, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x10, 0x00, 0x7F, 0xD0, 0x03, 0xE5, 0xBF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x00, 0xFD, 0x0F, 0xD0, 0x00,
-    0xBF, 0x4B, 0xF4, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x2F, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x17, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0E, 0x5F, 0xE0, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x01, 0x40, 0x7F, 0x80, 0x0B, 0xE6, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x1F, 0xD0, 0x02, 0xE0, 0xBF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xA5, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
-    0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xFC,
-    0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF,
-    0xFC, 0x00, 0x1F, 0xE0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0x42, 0xFE, 0xFF, 0x80, 0x03, 0xFC, 0x2F,
-    0xEB, 0xFD, 0x00, 0x1F, 0xF1, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0x8F, 0xF1, 0xFF, 0xC0, 0x03, 0xFD,
-    0xFF, 0x4F, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0x82, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xC0,
-    0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x56, 0xAB,
-    0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xAA, 0xA5, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0xFC, 0x00, 0x7F, 0xD0, 0x01, 0xFC,
-    0x01, 0xFF, 0xC0, 0x02, 0xF8, 0x07, 0xFF, 0xC0, 0x03, 0xF8, 0x0F, 0xFF, 0x80, 0x07, 0xF4, 0x3F,
-    0xFF, 0x80, 0x0B, 0xF0, 0xFF, 0x7F, 0x40, 0x0F, 0xF3, 0xFD, 0x7F, 0x00, 0x0F, 0xEF, 0xF4, 0xFF,
-    0x00, 0x1F, 0xFF, 0xE0, 0xFE, 0x00, 0x2F, 0xFF, 0x81, 0xFD, 0x00, 0x3F, 0xFE, 0x03, 0xFC, 0x00,
-    0x3F, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0xF0, 0x07, 0xF8, 0x00, 0xBF, 0xC0, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD1, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xF2, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x03, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xC0, 0x01, 0xFF,
-    0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0xD0, 0x00,
-    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xD0, 0xBF, 0xBF, 0xE0,
-    0x00, 0xFF, 0x0B, 0xFA, 0xFF, 0x40, 0x07, 0xFC, 0x7F, 0xCF, 0xFC, 0x00, 0x2F, 0xE3, 0xFC, 0x7F,
-    0xF0, 0x00, 0xFF, 0x7F, 0xD3, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x2F, 0xFF, 0xE0,
-    0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x1F, 0xFF,
-    0x40, 0xBF, 0xF0, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x1F, 0xD1, 0xFD, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x3F,
-    0xC3, 0xFC, 0x00, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x7F, 0xD0, 0x1F, 0xC0, 0x1F, 0xFC, 0x02, 0xF8, 0x07,
-    0xFF, 0xC0, 0x3F, 0x80, 0xFF, 0xF8, 0x07, 0xF4, 0x3F, 0xFF, 0x80, 0xBF, 0x0F, 0xF7, 0xF4, 0x0F,
-    0xF3, 0xFD, 0x7F, 0x00, 0xFE, 0xFF, 0x4F, 0xF0, 0x1F, 0xFF, 0xE0, 0xFE, 0x02, 0xFF, 0xF8, 0x1F,
-    0xD0, 0x3F, 0xFE, 0x03, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0x7F, 0xF0, 0x07, 0xF8, 0x0B, 0xFC,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xBF,
-    0x80, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x9B, 0xFF, 0x40, 0x00, 0x3F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xFE, 0x41, 0x6F, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00,
-    0x1F, 0xD1, 0xFD, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x0B, 0xF8, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x80,
-    0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x01, 0xFE, 0x01,
-    0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFE, 0x5B, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFE, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0xBF, 0x45, 0x5F, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x3F,
-    0xFE, 0x5B, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0xC2, 0xFC,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x2F, 0xD0, 0x0B, 0xF0, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0xBF, 0x45, 0x5F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xE0, 0x03, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC2, 0xFC, 0x00, 0xFE, 0x0F, 0xE0, 0x07, 0xF8, 0xBF, 0x80, 0x3F, 0xD3, 0xFD, 0x01, 0xFF,
-    0x5F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xE4, 0x0F,
-    0xD0, 0x04, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x38, 0x06, 0xFF, 0x40, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xD0,
-    0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xD0,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xDB,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x56, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xF8, 0x00, 0x02,
-    0xFE, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x1F, 0xD1, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x03,
-    0xF8, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0x00, 0x00, 0x2F, 0xE0, 0xBF, 0x40, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x6F, 0xC0,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00,
-    0x00, 0x2F, 0xE3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x0F,
-    0xF4, 0x00, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0x40, 0x00, 0x0F,
-    0xF4, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0xCF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x16, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x80, 0x00, 0x6A, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x1F,
-    0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x05, 0x50, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x5B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x7F,
-    0xC7, 0xFC, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x54, 0x03, 0xF0,
-    0x00, 0xFC, 0x03, 0xE0, 0x01, 0xFC, 0x0B, 0xD0, 0x02, 0xF8, 0x0F, 0xC0, 0x03, 0xF4, 0x0F, 0x40,
-    0x07, 0xF0, 0x2F, 0x00, 0x0B, 0xF0, 0x3E, 0x00, 0x0F, 0xE0, 0x3D, 0x00, 0x3F, 0xD0, 0x7E, 0x01,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFE,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x2F, 0x41, 0xFD, 0x1F, 0xD0, 0xBF, 0x4F, 0xF4,
-    0x3F, 0xC3, 0xFC, 0x2F, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x74, 0x06, 0x40, 0x3C, 0x03, 0xD0,
-    0x0F, 0x00, 0xF0, 0x07, 0x40, 0x7C, 0x03, 0xC0, 0x3E, 0x00, 0xE0, 0x1F, 0x40, 0x7C, 0x1F, 0xC0,
-    0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x19, 0x2D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xF5, 0x55, 0x54, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF2, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xFF, 0xA0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0x80, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0xC0,
-    0x03, 0xF0, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0xAB,
-    0xFF, 0x40, 0x3F, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x24, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0xFF,
-    0x00, 0xBD, 0x00, 0x07, 0xC0, 0xBD, 0x03, 0xF4, 0x00, 0x3E, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0xF4,
-    0x0F, 0xC0, 0xBF, 0x00, 0x07, 0xEB, 0xFE, 0x03, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xE0, 0x00,
-    0xFF, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xE7, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x2F, 0xFE,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x02, 0xFD, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x7F, 0xF0, 0x02, 0xFE, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x02,
-    0xF8, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xFC,
-    0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x02, 0xF4,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x01, 0xFC, 0x00,
-    0x0F, 0xC0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x03, 0xF4, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x0F,
-    0xC0, 0x2F, 0x40, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x7F, 0x00, 0x03, 0xF4, 0x0B, 0xD0,
-    0x00, 0x2A, 0x00, 0xA8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xF4, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07,
-    0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x2A, 0xA0, 0x00, 0xFF, 0xF0,
-    0x07, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x0F, 0xFC, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x2A, 0xA0, 0x00, 0x7F,
-    0xF4, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x2A, 0xA0, 0x7F, 0xF4, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0xBF,
-    0xF0, 0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x03, 0xFF, 0x00,
-    0x0B, 0xFD, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0x2A,
-    0xA0, 0x2A, 0xA0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x2F, 0xFC, 0x1F,
-    0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x02,
-    0xFF, 0x81, 0xFF, 0xC0, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x6A, 0x90, 0x6A, 0x90, 0x00, 0x00, 0x7F,
-    0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFE, 0x00, 0x2A, 0xA0, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0xBF, 0xF0,
-    0x01, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0B,
-    0xFD, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0x2A, 0xA0,
-    0x2A, 0xA0, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE5, 0x80, 0xBF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x55, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x05, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFA, 0x94, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD,
-    0x55, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xF4, 0x1F, 0xFF, 0xC2, 0xFF,
-    0xF0, 0x2F, 0xE4, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x0F, 0xF0, 0xBF, 0x83, 0xFE,
-    0x2F, 0xF4, 0xFF, 0xD0, 0x01, 0x54, 0x0F, 0xF0, 0xBF, 0x83, 0xFE, 0x2F, 0xF4, 0xFF, 0xD0, 0x01,
-    0x54, 0x00, 0x54, 0x00, 0x55, 0x07, 0xF8, 0x02, 0xFD, 0x01, 0xFE, 0x0F, 0xF4, 0x03, 0xFC, 0x03,
-    0xFE, 0x1F, 0xF4, 0x0B, 0xFC, 0x07, 0xFD, 0x3F, 0xF0, 0x0F, 0xFC, 0x0B, 0xFD, 0x7F, 0xF0, 0x1F,
-    0xFC, 0x0F, 0xFC, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x34, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xF7,
-    0x40, 0xFD, 0x00, 0x00, 0x0E, 0xDC, 0x0F, 0xE0, 0x00, 0x00, 0x38, 0xF0, 0xBE, 0x00, 0x00, 0x00,
-    0xFF, 0x4B, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x06,
-    0x02, 0x80, 0x00, 0x1F, 0xD0, 0x95, 0x36, 0x40, 0x01, 0xFE, 0x07, 0xA9, 0xB9, 0x00, 0x1F, 0xE0,
-    0x2A, 0xDA, 0xB0, 0x00, 0xFF, 0x00, 0xBF, 0x2F, 0xC0, 0x0F, 0xF0, 0x01, 0xF0, 0x7C, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF,
-    0xF0, 0xFF, 0xF0, 0x07, 0xFF, 0x43, 0xFF, 0x40, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x02, 0xFF, 0x81, 0xFF, 0x80, 0x1F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x6A, 0x90, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0F,
-    0xC0, 0xBC, 0x2F, 0xC0, 0xFD, 0x0F, 0xE3, 0xF4, 0x1F, 0xC0, 0xFD, 0x3F, 0x02, 0xF4, 0x1F, 0x8B,
-    0xD0, 0x3F, 0x03, 0xF0, 0x78, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xBF, 0x07, 0xF0, 0x3F, 0x41, 0xF8, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x07, 0xF1,
-    0xFC, 0x0F, 0xD3, 0xF8, 0x2F, 0x87, 0xF0, 0x3F, 0x0F, 0xC0, 0x7C, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xD0, 0x2F, 0x03, 0xF4, 0x3F, 0x81, 0xFC, 0x0B, 0xF0, 0x7F,
-    0x03, 0xF8, 0x0F, 0xC0, 0xFD, 0x07, 0xF0, 0x2F, 0x41, 0xF8, 0x0F, 0xC0, 0x3D, 0x02, 0xD0, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xC0, 0xAA, 0x81, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x07, 0xC0, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x0B, 0xF8, 0x00,
-    0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xE0, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00,
-    0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0x80,
-    0x00, 0x3C, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x4B, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x55, 0x5F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF7, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xFF, 0xF4, 0x01,
-    0xFF, 0x00, 0x01, 0xFF, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC7, 0xFF, 0xF4, 0x00,
-    0x3F, 0xE0, 0x00, 0x7F, 0xF7, 0xFF, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x15, 0x6F, 0xFF, 0xFF, 0xC0,
-    0x05, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEB, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD1, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xEF, 0xF0, 0x00, 0x1F, 0xFF, 0xC3, 0xF8, 0x00, 0x0A, 0x3F,
-    0x83, 0xF8, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x07,
-    0xF4, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x7F, 0xC0,
-    0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE2,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x11, 0xE1, 0x40, 0x00, 0x0B, 0xAE, 0xB8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFB, 0xE0, 0x00, 0x00, 0x8F, 0x4A,
-    0x80, 0x00, 0x78, 0xF4, 0xB8, 0x50, 0x8B, 0x5F, 0xEF, 0xBD, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF,
-    0xE0, 0xBF, 0xC0, 0x0B, 0xFD, 0x2F, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0xF8, 0xB7, 0xCB, 0x63, 0xC1,
-    0x00, 0x3C, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE4, 0x2F, 0xD0,
-    0xFF, 0xD4, 0x7F, 0x80, 0x03, 0xD0, 0x00, 0xFE, 0x0B, 0x80, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x0F,
-    0xE0, 0x10, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0xFF,
-    0xE4, 0x3F, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x01, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF5, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xEF,
-    0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC4, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x55, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xF1, 0xC0, 0xB0, 0x34, 0x3D,
-    0xDD, 0x1E, 0xFB, 0x0B, 0x7B, 0xC2, 0xD2, 0xE0, 0xBF, 0xF0, 0x1F, 0xF4, 0x01, 0xA0, 0x00, 0x00,
-    0x08, 0x00, 0x3C, 0x00, 0xFC, 0x03, 0xB8, 0x0D, 0x74, 0x3D, 0xF8, 0xFF, 0xFC, 0x02, 0xE0, 0x03,
-    0xD0, 0x01, 0xAA, 0x40, 0xFF, 0xD0, 0x70, 0x00, 0x2C, 0x00, 0x0F, 0xF8, 0x03, 0xAF, 0x40, 0x01,
-    0xE0, 0x91, 0xF4, 0x3F, 0xFC, 0x1F, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x2A, 0x80, 0x7F, 0xE0, 0x78,
-    0x00, 0x3D, 0x90, 0x1F, 0xFD, 0x0B, 0xC7, 0xC3, 0xC0, 0xE0, 0xF0, 0xB4, 0x3F, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x6A, 0xBC, 0x00, 0x78, 0x00, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0x0B,
-    0xC0, 0x0F, 0x80, 0x3F, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x78, 0x74, 0x2C, 0x2C,
-    0x07, 0xFD, 0x02, 0xEF, 0x43, 0xC0, 0xE0, 0xF0, 0xB8, 0x3F, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0xFF, 0x80, 0xF0, 0xB0, 0x70, 0x1C, 0x2C, 0x0F, 0x0B, 0xFF, 0xC0, 0xBF, 0xE0,
-    0x00, 0xF0, 0x7F, 0xF8, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9,
-    0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x7F, 0x80,
-    0x0B, 0xF8, 0x01, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0F,
-    0xF4, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x7E, 0x00, 0x2D, 0x38, 0x07, 0x83, 0x80, 0xB7, 0x38, 0x0F, 0xB7, 0x81, 0xE6, 0xB4,
-    0x1E, 0x1F, 0x02, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x68, 0x0F, 0xE0, 0x3F, 0x40,
-    0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3C, 0x00, 0xF0, 0x7F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x7F, 0xF4, 0x06, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x01,
-    0xFE, 0x00, 0x3F, 0xFD, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3F, 0xF4, 0x01,
-    0x03, 0x80, 0x00, 0x74, 0x02, 0xFD, 0x00, 0x2B, 0xE0, 0x00, 0x1E, 0x02, 0xEB, 0xE0, 0x3F, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x02, 0x40, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0x7C, 0x03, 0x9E, 0x03, 0xDB,
-    0x83, 0xFF, 0xF4, 0x56, 0xF8, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x01, 0x55, 0x40, 0xFF, 0xD0, 0x74,
-    0x00, 0x2C, 0x00, 0x0F, 0xF8, 0x02, 0xAF, 0x40, 0x01, 0xE0, 0xA6, 0xF0, 0x3F, 0xF8, 0x0F, 0xF4,
-    0x00, 0x00, 0x2A, 0x80, 0x1F, 0xFC, 0x07, 0x80, 0x00, 0xF6, 0x40, 0x1F, 0xFE, 0x02, 0xF0, 0xF0,
-    0x3D, 0x0F, 0x03, 0xC2, 0xE0, 0x2F, 0xFC, 0x00, 0xFE, 0x00, 0x2A, 0xA9, 0x7F, 0xFD, 0x00, 0x3C,
-    0x00, 0xB4, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x2E, 0x7C, 0x03, 0x83, 0xC0, 0x78, 0x78, 0x02, 0xFF, 0x00, 0x7F, 0xF0, 0x1E,
-    0x0B, 0x03, 0xD1, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1F,
-    0xF4, 0x07, 0x43, 0x80, 0xE0, 0x3C, 0x0D, 0x0B, 0x80, 0xFF, 0xF4, 0x07, 0xFF, 0x00, 0x01, 0xE0,
-    0x3F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0xB8, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00,
-    0x1B, 0xF9, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xC7, 0xD0, 0x00, 0x07, 0xFF, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0xF7, 0xF1, 0xF4,
-    0x00, 0x02, 0xFF, 0x9F, 0x4F, 0xC0, 0x00, 0x0F, 0xFD, 0xBC, 0x3D, 0x00, 0x00, 0x7F, 0xF3, 0xE2,
-    0xF0, 0x00, 0x02, 0xFF, 0xAF, 0x0F, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0xFF,
-    0xC3, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0xAD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xD2, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xE0,
-    0x00, 0x00, 0x00, 0x29, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFB, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x0B, 0xEF, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0xF8,
-    0x00, 0xBF, 0xF0, 0x0F, 0xFA, 0x80, 0x0F, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0x00,
-    0x00, 0x0F, 0xFF, 0xD7, 0xF6, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xFF, 0xAA, 0x80, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x94, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0A, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x2F,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2A, 0xAF, 0xFE,
-    0xBF, 0xEF, 0xFA, 0xA4, 0x00, 0x07, 0xFF, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x00,
-    0x2F, 0xE5, 0xAF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0xFD, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x96, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xFE, 0x6F,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x07, 0xF4, 0x0F, 0xC0,
-    0x00, 0x00, 0xBF, 0xC0, 0xBF, 0x41, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x2F, 0xD0, 0x00,
-    0x00, 0x0F, 0xD0, 0xFF, 0x03, 0xFD, 0x00, 0x07, 0x42, 0xFD, 0x1F, 0xF0, 0x3F, 0xD0, 0x01, 0xFF,
-    0xFF, 0xC2, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xE0, 0x7F, 0xE0, 0x03, 0xFF, 0xFE,
-    0x01, 0x54, 0x01, 0x54, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00,
-    0x0B, 0xD0, 0x00, 0x2F, 0x41, 0xF0, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xFF, 0xBF, 0xEA, 0x40, 0x3F, 0x4F, 0xF4, 0xFC, 0x00, 0x00,
-    0xFD, 0xBF, 0xE7, 0xE0, 0x00, 0x03, 0xF7, 0xFF, 0xAF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x8F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x83,
-    0xFD, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3A, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0x01, 0xF8, 0x01, 0xFC, 0x00,
-    0x2F, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF1, 0x94, 0x3F, 0x07, 0xF0, 0x07,
-    0xE2, 0xF8, 0x3E, 0x0B, 0xE0, 0x0B, 0xD3, 0xF4, 0x7D, 0x0F, 0xD0, 0x0F, 0xC3, 0xF0, 0xBD, 0x0F,
-    0xC0, 0x0F, 0x87, 0xF0, 0xAC, 0x2F, 0xC0, 0x1F, 0x47, 0xF0, 0x00, 0x3F, 0x80, 0x2F, 0x0B, 0xF0,
-    0x00, 0x7F, 0x00, 0x3F, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3E, 0x07, 0xFF, 0xAF, 0xFE, 0x00, 0x7D,
-    0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x14, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x56,
-    0xF9, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xD0,
-    0x0F, 0xE0, 0x00, 0x00, 0xBC, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x54, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xAA,
-    0x80, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x04, 0x00,
-    0x00, 0x03, 0xFE, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x7F,
-    0xF2, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x93, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x06, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xF9, 0x6B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFA, 0x40, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x1A, 0x40, 0x0F, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0x00, 0x00,
-    0x03, 0xFF, 0x42, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFF, 0xFA, 0x40, 0xBF, 0xD0, 0x2F,
-    0xFF, 0xFF, 0x82, 0xFF, 0x40, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x03, 0xFB, 0xFF, 0xF4, 0x3F, 0xF4,
-    0x0F, 0xC1, 0xFF, 0x90, 0xFF, 0xF0, 0x7E, 0x0F, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFD, 0x50, 0x3F, 0xDF, 0xC0, 0x07, 0xF5, 0xF8, 0x00, 0xFF, 0x2F, 0x40, 0x0F,
-    0xE3, 0xF0, 0x01, 0xFD, 0x3F, 0x00, 0x2F, 0xD7, 0xE0, 0x02, 0xFF, 0xBE, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x01, 0x55, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xB4,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x90, 0x0F, 0xFF, 0xF4, 0x40,
-    0x0F, 0xFF, 0x5B, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x11, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF9, 0xA9,
-    0x3F, 0xFE, 0x41, 0xFD, 0x7F, 0xFC, 0x0B, 0xF8, 0xA5, 0xF8, 0x7F, 0xF0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x02, 0xFE, 0xFC,
-    0x7F, 0x00, 0x03, 0xFC, 0xFC, 0x7F, 0x00, 0x03, 0xF5, 0xF8, 0xBE, 0x00, 0x07, 0xF2, 0xF4, 0xFD,
-    0x00, 0x0B, 0xE3, 0xF0, 0xFC, 0x00, 0x0F, 0xD3, 0xF1, 0xFC, 0x00, 0x0F, 0xC7, 0xF2, 0xF8, 0x00,
-    0x1F, 0xCB, 0xE3, 0xF4, 0x00, 0x2F, 0xCF, 0xD7, 0xF0, 0x00, 0x3F, 0xCF, 0xCB, 0xF0, 0x00, 0x3F,
-    0x9F, 0xCF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE5, 0xAF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x1B, 0xE0, 0x3F, 0x81, 0xBF,
-    0xF8, 0x1F, 0xEF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0x90,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFE, 0xFF, 0x03,
-    0xFF, 0x2F, 0x8F, 0xFC, 0x7F, 0x83, 0xF4, 0x3F, 0x42, 0xC0, 0x3F, 0x00, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xE4, 0x00, 0xFD, 0x00, 0x7F, 0xFE, 0x47, 0xF0,
-    0x07, 0xFF, 0xFF, 0xBF, 0xC0, 0x06, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00,
-    0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x3E, 0x03, 0xF4, 0x1E, 0x07, 0xFD, 0x2F, 0x83, 0xFC, 0x1F,
-    0xF9, 0xFC, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x01, 0xBF, 0x90, 0x1F, 0x80, 0x03, 0xF1, 0xBF, 0xFF, 0xFE, 0x4B, 0xD0, 0x07, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0x00, 0x1B, 0xFF, 0xF8, 0x3F, 0xF9, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0x81, 0xFE, 0x7D, 0xBF, 0x4F, 0xC2, 0xF0, 0xBC, 0x18, 0x0F, 0xC0, 0x40, 0x00, 0x3E,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2D, 0x0F, 0xC0, 0xD0, 0xFE, 0x2F, 0x0F, 0xD0, 0xBF,
-    0xBE, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x16, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0x94, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFE, 0x2F, 0xFE, 0x00, 0x3F, 0x80, 0xBF, 0xF8, 0x0F, 0xE0, 0x07, 0xFF, 0xC3,
-    0xF8, 0x00, 0x1F, 0xE0, 0xF9, 0x00, 0x00, 0xA0, 0x02, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x6B, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xD3, 0xF8, 0x0B, 0xFF, 0x40, 0xFE, 0x1F, 0xFE,
-    0x00, 0x3F, 0x83, 0xFC, 0x00, 0x0F, 0xE0, 0x34, 0x00, 0x02, 0xF4, 0x02, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0xA4, 0x0B, 0xF0, 0x0F, 0xC0, 0x3F, 0x41, 0xF8,
-    0x02, 0xFC, 0x2F, 0x40, 0x0F, 0xD3, 0xF0, 0x00, 0xBF, 0x3F, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x2F,
-    0xFD, 0x01, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x01,
-    0x6B, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0x41, 0xA0, 0x0B, 0xF0, 0x3F, 0x00, 0xFD, 0x02, 0xF0, 0x1F, 0xC0, 0x1F, 0x43, 0xF8, 0x00,
-    0xF8, 0x7F, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0xBE, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-    0x04, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0x94, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0xAA, 0xA0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0xAA, 0xAA, 0xA8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x1F,
-    0xF3, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xD7, 0xFF, 0x40, 0x00, 0xBF,
-    0xFC, 0xBF, 0xFD, 0x00, 0x3F, 0xEF, 0x8F, 0xEF, 0xF0, 0x1F, 0xF5, 0xF4, 0xFC, 0xFF, 0xC3, 0xFD,
-    0x2F, 0x1F, 0x83, 0xFC, 0x3F, 0x03, 0xF2, 0xF4, 0x1E, 0x00, 0x80, 0x3E, 0x3F, 0x00, 0x40, 0x00,
-    0x07, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x5F, 0x80, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x6A, 0xAA, 0xAA, 0xBF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1,
-    0xAA, 0xAA, 0xAA, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x00, 0x00,
-    0x03, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0x5F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x18, 0x07, 0xD3, 0xE0, 0x04, 0x03, 0xE0, 0x3E, 0x3F, 0x02,
-    0xE0, 0x7F, 0xC3, 0xF2, 0xF4, 0x7F, 0x81, 0xFF, 0x5F, 0x1F, 0x8F, 0xF4, 0x07, 0xFE, 0xF4, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD7,
-    0xFD, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F,
-    0xFA, 0xAA, 0xAA, 0xAA, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00,
-    0xBF, 0x7F, 0xFF, 0xD0, 0x1F, 0xF3, 0xEB, 0xF8, 0x0B, 0xFF, 0x3E, 0x0A, 0x02, 0xFF, 0xF3, 0xE0,
-    0x00, 0x3F, 0xFF, 0x3E, 0x00, 0x00, 0x76, 0xF3, 0xE0, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x02,
-    0xF3, 0xE0, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0x2F, 0x3E, 0x00,
-    0x00, 0xBA, 0xF3, 0xE0, 0x00, 0x3F, 0xFF, 0x3E, 0x00, 0x02, 0xFF, 0xF3, 0xE0, 0x00, 0x07, 0xFF,
-    0x3E, 0x1F, 0x00, 0x1F, 0xF3, 0xFF, 0xFC, 0x00, 0x7F, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE4,
-    0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xBF, 0x47, 0xF0, 0x00, 0x2F, 0xFF, 0xDB, 0xE0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x97, 0xFF, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x0B,
-    0xF4, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x1F, 0xF0,
-    0x0B, 0xF8, 0x00, 0x1F, 0xFE, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0xBF,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x0F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x0B, 0xF8, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0xBF, 0x83, 0xFD, 0x00, 0x0B, 0xFC, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0xBF, 0x80, 0x7F, 0xC0, 0x01, 0xFF, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0xBF, 0xC0, 0x0F,
-    0xF8, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xD4, 0x5B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0x81,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00,
-    0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x2F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x03, 0xFF, 0x00,
-    0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x2F,
-    0xD0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00,
-    0x3F, 0x80, 0xBF, 0x00, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x7F, 0x40, 0x01, 0xFE, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x80,
-    0x00, 0xFE, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0x00, 0x1A, 0x80, 0x2A, 0x80, 0x00, 0x3F,
-    0xC0, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x02, 0xFD, 0x03, 0xFC,
-    0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00,
-    0x00, 0x7F, 0x40, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x6A, 0x80, 0xFF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xEA, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x69, 0x00, 0x00, 0x7F, 0xFE, 0x1F,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x07,
-    0xFF, 0x43, 0xF0, 0x2F, 0xC0, 0x03, 0xE0, 0x0B, 0xC0, 0xFC, 0x00, 0x0F, 0x00, 0x2F, 0x07, 0xF0,
-    0x00, 0xB8, 0x00, 0xFC, 0x2F, 0xC0, 0x1B, 0xF4, 0x1F, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0xFF, 0xF8,
-    0x00, 0x01, 0x69, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFD, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0F, 0xF0,
-    0x2F, 0xEB, 0xF1, 0xFD, 0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x68, 0x00, 0xBF, 0xFD, 0x0B, 0xF0, 0x1F,
-    0xEB, 0xF1, 0xFE, 0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x2F, 0x80, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00,
-    0x00, 0xFF, 0xA5, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x05, 0x6B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x56, 0xBC, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF4,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xE4,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFD, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xA9, 0x40, 0x00, 0x7A, 0x94, 0x00, 0x00,
-    0x00, 0x00,
+static const uint8_t opendyslexic_12_bolditalicBitmaps[36771] = {
+    0x85, 0x55, 0xBF, 0x8E, 0xDF, 0x44, 0x10, 0x9E, 0xF5, 0xE6, 0xCE, 0x52, 0x5C, 0x6C, 0x45, 0x95,
+    0xC2, 0x14, 0x14, 0x28, 0x45, 0xFC, 0x02, 0x9C, 0xEC, 0xE4, 0x8A, 0x94, 0xA1, 0xC8, 0x35, 0x74,
+    0x79, 0x00, 0x74, 0x2F, 0x80, 0x58, 0x77, 0x29, 0x52, 0x40, 0x93, 0x9A, 0x2B, 0xAE, 0x00, 0x9E,
+    0x00, 0x9A, 0xF3, 0xD2, 0x70, 0xAD, 0xA5, 0x08, 0xA5, 0x75, 0x24, 0x50, 0xDA, 0x8D, 0xE2, 0x93,
+    0x1C, 0xB0, 0x3D, 0xF9, 0x66, 0xD6, 0x3F, 0xDD, 0x2F, 0xBA, 0x93, 0x70, 0xE1, 0xF5, 0xCE, 0xCE,
+    0x9F, 0x6F, 0x67, 0xBE, 0x19, 0x13, 0xC9, 0xF3, 0x05, 0x91, 0x0D, 0x44, 0xDF, 0x13, 0x15, 0x03,
+    0xD1, 0x4C, 0x54, 0x06, 0xB2, 0x13, 0x51, 0xDD, 0x50, 0x11, 0x89, 0x98, 0xC8, 0x0D, 0x94, 0x41,
+    0x5E, 0x07, 0xCA, 0x21, 0xEF, 0x1A, 0x72, 0x90, 0x7B, 0x22, 0xD3, 0x13, 0xDD, 0xA1, 0x9B, 0x4F,
+    0x15, 0xC9, 0xC2, 0xAC, 0x1B, 0xC8, 0xAD, 0x94, 0x71, 0x4F, 0xF5, 0x42, 0x39, 0x07, 0xF2, 0x53,
+    0x3D, 0xBB, 0xC5, 0xAD, 0x96, 0x1F, 0x71, 0xDB, 0xF5, 0x7E, 0x28, 0x27, 0x37, 0x59, 0x86, 0x2E,
+    0x07, 0xEE, 0xAB, 0xA9, 0x9A, 0x0E, 0x7F, 0xC9, 0x7E, 0x15, 0x0F, 0x65, 0x40, 0x74, 0x3C, 0xAB,
+    0x99, 0x65, 0xC9, 0x23, 0x20, 0x90, 0x20, 0xF0, 0x49, 0x9C, 0xA9, 0xB8, 0x50, 0x71, 0xC6, 0xFA,
+    0x50, 0xA9, 0x4B, 0xA4, 0xB4, 0x6D, 0xCD, 0x49, 0xF7, 0x17, 0xBF, 0x7C, 0x8A, 0xF3, 0xC5, 0xAA,
+    0xB6, 0x8B, 0x55, 0x2F, 0x6B, 0xD7, 0xB2, 0x2C, 0x76, 0x96, 0xCB, 0x90, 0x57, 0xED, 0x60, 0x75,
+    0x59, 0xA8, 0xDA, 0x9C, 0x9C, 0xF8, 0xAB, 0xEE, 0x9F, 0x13, 0x9C, 0xF3, 0x43, 0xD5, 0x2E, 0x66,
+    0x37, 0x29, 0x82, 0x58, 0x8B, 0x13, 0x83, 0x1B, 0xC8, 0xF6, 0xF0, 0xE7, 0xC3, 0xF3, 0x4F, 0xEF,
+    0x9E, 0xF0, 0x2A, 0xDA, 0x4A, 0xB0, 0x9A, 0x05, 0xAF, 0x7B, 0xC0, 0x83, 0x94, 0xF0, 0xAC, 0xF1,
+    0x7A, 0x7C, 0xBE, 0xFA, 0x80, 0xF3, 0xD1, 0x21, 0xEF, 0xDC, 0x20, 0x93, 0x76, 0xC9, 0xE0, 0xBE,
+    0x5C, 0x9F, 0xC0, 0x79, 0xCD, 0xE2, 0xBA, 0x63, 0x6E, 0xF4, 0xDD, 0x6E, 0xE6, 0xD0, 0x14, 0xB9,
+    0x85, 0x93, 0x2F, 0x71, 0xD7, 0x98, 0x71, 0xD3, 0x71, 0x0B, 0x65, 0x9E, 0x15, 0x7C, 0x80, 0x16,
+    0x8F, 0x64, 0x3A, 0x56, 0xA0, 0xE2, 0x1A, 0xBE, 0xE4, 0x95, 0x72, 0x58, 0x0C, 0x9F, 0xE0, 0xFC,
+    0xFA, 0x5A, 0x69, 0x96, 0x33, 0xD7, 0x1B, 0x5C, 0x7B, 0x21, 0x77, 0xDC, 0x63, 0xF7, 0x9B, 0x6B,
+    0x3A, 0xB0, 0xE2, 0xAB, 0x3C, 0x92, 0x7B, 0x14, 0xBD, 0x80, 0x7A, 0x3C, 0x02, 0xCE, 0x24, 0x65,
+    0xB9, 0x38, 0x4E, 0xA9, 0xF8, 0x13, 0x4B, 0x36, 0x77, 0xF0, 0x5E, 0x5D, 0x86, 0x88, 0x3C, 0x1F,
+    0x81, 0x47, 0x65, 0x1F, 0x4B, 0x32, 0x6B, 0xFE, 0xC7, 0x84, 0x84, 0x97, 0x28, 0x3A, 0x4B, 0xF5,
+    0x41, 0x98, 0xAA, 0x25, 0xD6, 0xE2, 0x91, 0xB9, 0x68, 0x24, 0x0F, 0x60, 0xD3, 0x58, 0xB6, 0x80,
+    0x08, 0xFD, 0x48, 0xDF, 0x51, 0x11, 0x2C, 0xB4, 0x9A, 0x1A, 0xA2, 0x62, 0x96, 0xAB, 0x4B, 0x72,
+    0x24, 0x2B, 0x2C, 0xF9, 0x5E, 0xE8, 0xBC, 0xBC, 0x5A, 0xEC, 0xC8, 0x0F, 0x97, 0xEA, 0x72, 0xCE,
+    0xD6, 0xB5, 0x44, 0x06, 0x62, 0x77, 0x75, 0xCA, 0x46, 0x0A, 0x27, 0x29, 0x18, 0x73, 0xE6, 0xD7,
+    0x4D, 0xC6, 0xBB, 0x8A, 0xDC, 0x3F, 0xAF, 0xA7, 0x7A, 0xAC, 0xC7, 0x6A, 0x2C, 0x67, 0x07, 0xE2,
+    0x15, 0x2B, 0x84, 0x0F, 0x10, 0xBB, 0xC0, 0x55, 0xB2, 0x55, 0xA9, 0x00, 0xF7, 0x51, 0xB8, 0x20,
+    0xE9, 0xC5, 0x49, 0x39, 0x6C, 0x9B, 0x6E, 0x7F, 0xE3, 0x5B, 0xD2, 0x56, 0x20, 0xB1, 0x29, 0xFB,
+    0x4D, 0x0A, 0xA0, 0xDA, 0x0F, 0xAA, 0xAB, 0xC7, 0xAC, 0x2C, 0xBB, 0xF1, 0x31, 0x6E, 0xCE, 0x0B,
+    0x55, 0xC6, 0xAD, 0x72, 0x35, 0x17, 0x3F, 0x72, 0x2E, 0x00, 0xC8, 0x08, 0x4B, 0xDA, 0x9D, 0x4E,
+    0xBB, 0x67, 0x25, 0x7E, 0x8C, 0x04, 0xAE, 0xFA, 0x3D, 0x38, 0x6E, 0x07, 0xA7, 0x82, 0x3F, 0xE9,
+    0x56, 0x0D, 0xA5, 0xD8, 0x76, 0x1B, 0x39, 0xC9, 0xC7, 0xCD, 0xB8, 0xDE, 0x6C, 0xD2, 0x4D, 0xB5,
+    0x95, 0xD2, 0x05, 0x25, 0xA0, 0x5D, 0xB7, 0x58, 0x3E, 0x68, 0xF3, 0x92, 0x70, 0xDD, 0x0A, 0x71,
+    0x21, 0x33, 0x67, 0xCA, 0x93, 0xCF, 0x7D, 0x71, 0x7C, 0xF5, 0x61, 0x46, 0x7F, 0x44, 0x8F, 0x62,
+    0x38, 0x34, 0x18, 0x98, 0x0C, 0x36, 0xBF, 0x59, 0x97, 0xD5, 0xBE, 0x8A, 0x67, 0x77, 0x30, 0x36,
+    0xE8, 0xF7, 0x3D, 0x86, 0xA1, 0x9A, 0x32, 0x4A, 0xE8, 0x02, 0x9F, 0xA3, 0x60, 0x93, 0x46, 0x7D,
+    0x02, 0xBA, 0x82, 0xB3, 0x83, 0x8C, 0x0F, 0x69, 0x62, 0x69, 0x60, 0x70, 0x4A, 0x29, 0xEA, 0xA7,
+    0x8C, 0x03, 0x26, 0x46, 0x2D, 0xDC, 0x76, 0x33, 0x71, 0x8F, 0x8A, 0xDD, 0x3F, 0x93, 0x86, 0x78,
+    0x0D, 0x33, 0xF4, 0x42, 0x30, 0x4F, 0xCB, 0x81, 0x1F, 0x2F, 0xF5, 0x3B, 0x0E, 0x29, 0x88, 0x49,
+    0x4B, 0x9E, 0xB6, 0x89, 0xCF, 0x3B, 0xAA, 0xE7, 0x31, 0xE1, 0x98, 0xE8, 0xBA, 0x0B, 0x52, 0xD2,
+    0x24, 0xC7, 0x69, 0x49, 0x63, 0x46, 0x73, 0x25, 0xF6, 0x7D, 0x5A, 0x92, 0xA1, 0x24, 0xEF, 0x7F,
+    0xED, 0xDB, 0x7D, 0xFB, 0xF2, 0x56, 0xFB, 0x64, 0x98, 0x2D, 0xB7, 0xD9, 0xFB, 0x64, 0x5F, 0x6F,
+    0xF6, 0xC3, 0xBE, 0x7D, 0x71, 0xAB, 0x3D, 0x6F, 0x4B, 0x02, 0xEE, 0xC3, 0xBE, 0x7D, 0xB5, 0xD9,
+    0xA7, 0xA5, 0x48, 0x42, 0xDB, 0xEC, 0x67, 0x8A, 0xB6, 0xAA, 0xA2, 0xD9, 0x91, 0x58, 0x0C, 0xEA,
+    0x05, 0xD9, 0xAA, 0x82, 0x0B, 0x18, 0x54, 0x35, 0xB9, 0x77, 0xFD, 0x4C, 0xFE, 0xA7, 0xCB, 0x88,
+    0xBE, 0x86, 0xF0, 0xFD, 0xCC, 0xE4, 0x7F, 0x78, 0x3B, 0x65, 0x4B, 0x5D, 0xF5, 0x6E, 0x7C, 0x86,
+    0x5E, 0xEE, 0xC1, 0x0D, 0x4C, 0x6B, 0x1D, 0x98, 0x60, 0x01, 0x3C, 0x54, 0x32, 0x9D, 0xBC, 0x74,
+    0x6A, 0x27, 0x63, 0xCA, 0x6B, 0xF0, 0x53, 0x88, 0x26, 0xB4, 0x2E, 0xDA, 0x31, 0xD2, 0xD1, 0x4A,
+    0x07, 0x48, 0xCD, 0x8D, 0x7F, 0x88, 0x61, 0x85, 0x2C, 0x4C, 0xF3, 0xBD, 0x4D, 0xCC, 0x78, 0x8E,
+    0x3E, 0x66, 0x9D, 0x74, 0x07, 0x3A, 0x25, 0x5A, 0x9D, 0x87, 0x56, 0x46, 0x9B, 0x6F, 0xBA, 0xF6,
+    0xEE, 0x75, 0xEF, 0x09, 0x73, 0xC5, 0x83, 0x46, 0x2C, 0x85, 0x4B, 0xD8, 0x14, 0x98, 0xAE, 0x39,
+    0x74, 0x33, 0x70, 0x14, 0x78, 0x1A, 0xF9, 0x2B, 0x44, 0xC5, 0x0A, 0x37, 0xB1, 0x60, 0x46, 0xFA,
+    0x0F, 0xF0, 0x63, 0x22, 0xE1, 0x20, 0x90, 0x37, 0xF6, 0x47, 0x99, 0xBC, 0x4A, 0x54, 0x33, 0x6D,
+    0x84, 0x40, 0x47, 0x16, 0x62, 0x2F, 0x30, 0x2A, 0x99, 0xA9, 0x27, 0x42, 0xB7, 0x14, 0x38, 0xE4,
+    0x0D, 0x62, 0xC1, 0x61, 0xB3, 0x79, 0x5E, 0x64, 0xA4, 0x37, 0xD4, 0xAD, 0x9A, 0xE6, 0x6F, 0xD3,
+    0xC4, 0x97, 0x0E, 0x17, 0x48, 0xC8, 0x81, 0xF9, 0x6F, 0xA4, 0xFC, 0x6D, 0xA4, 0xF2, 0x45, 0x24,
+    0xEF, 0xA2, 0x99, 0xDD, 0x90, 0xE3, 0x4F, 0x04, 0xEB, 0x05, 0x90, 0x66, 0x18, 0xCF, 0x9F, 0x7D,
+    0xC3, 0x7F, 0x6B, 0x45, 0xE5, 0x3A, 0x32, 0x13, 0xEC, 0x7A, 0x5D, 0x2C, 0x0C, 0x35, 0xF4, 0x03,
+    0xD2, 0x2B, 0xA1, 0xEA, 0x0D, 0xAA, 0x54, 0x58, 0xFA, 0xCB, 0xF0, 0xBF, 0x72, 0xCD, 0x51, 0x6E,
+    0xD7, 0xDC, 0x7D, 0x79, 0xBA, 0x75, 0x38, 0xFC, 0x34, 0xC4, 0xED, 0x91, 0xE1, 0x20, 0x28, 0xA5,
+    0x4C, 0x9B, 0x9B, 0x81, 0xEE, 0xAD, 0xED, 0xCE, 0xF5, 0x47, 0x8D, 0x55, 0xBD, 0xAE, 0xDD, 0x44,
+    0x10, 0x9E, 0xB5, 0x45, 0x56, 0xBA, 0x5B, 0x2C, 0x05, 0xA1, 0xB9, 0x48, 0x7E, 0x80, 0x14, 0x7E,
+    0x81, 0x20, 0x5B, 0xE2, 0x01, 0x48, 0x91, 0xD0, 0xA4, 0xA0, 0x49, 0x41, 0x68, 0x4E, 0x4B, 0x81,
+    0xE4, 0xED, 0xD2, 0xDE, 0x8A, 0x3A, 0x45, 0x68, 0x4E, 0x93, 0x17, 0x40, 0xD8, 0x12, 0x2F, 0x60,
+    0xA4, 0x20, 0x0A, 0x1A, 0x0B, 0x05, 0x29, 0xBA, 0x05, 0x58, 0x91, 0x41, 0x3E, 0xBA, 0xB6, 0x87,
+    0xEF, 0x1B, 0xE7, 0x46, 0x37, 0xA9, 0xB2, 0xE7, 0x9C, 0x3D, 0xBB, 0xEB, 0xD9, 0x99, 0x6F, 0xBE,
+    0xF9, 0xB1, 0x88, 0x7B, 0x7C, 0x4F, 0x32, 0xDD, 0xC4, 0xA9, 0x0E, 0xD2, 0xEA, 0x2A, 0xC5, 0x4B,
+    0x91, 0x7C, 0x12, 0x91, 0x9F, 0xF1, 0x8B, 0x7F, 0x9C, 0xF0, 0x54, 0x27, 0xA9, 0x54, 0x3B, 0xAF,
+    0xBF, 0x6F, 0xD2, 0xF6, 0x71, 0x8C, 0xB3, 0x28, 0x3E, 0x71, 0x88, 0x63, 0xB6, 0x62, 0xD1, 0x76,
+    0x91, 0x32, 0x0A, 0x35, 0xB9, 0x6A, 0x92, 0xB0, 0x25, 0xE1, 0x50, 0xD5, 0x5F, 0x70, 0x58, 0xF2,
+    0xA1, 0x6B, 0x3A, 0x71, 0x2B, 0x34, 0x8E, 0x22, 0x6D, 0x92, 0x7C, 0x11, 0x29, 0xB1, 0xD4, 0x5A,
+    0x22, 0x96, 0xCD, 0x80, 0x9B, 0x22, 0xC5, 0x8C, 0x93, 0x5E, 0x3C, 0x96, 0xD5, 0x04, 0xC3, 0x9D,
+    0xC4, 0x8D, 0x8A, 0x4A, 0x9C, 0x97, 0x50, 0x12, 0xB6, 0xB6, 0x73, 0x9B, 0xAC, 0x52, 0xA5, 0xD8,
+    0xF9, 0xC9, 0x2D, 0xD2, 0xD4, 0x4D, 0xE7, 0xD7, 0xC3, 0x84, 0xC7, 0x90, 0x6C, 0x70, 0xB1, 0xD5,
+    0x45, 0xAA, 0xA1, 0x1C, 0x22, 0x00, 0x39, 0x80, 0x1C, 0xCB, 0x21, 0xDB, 0x32, 0xFD, 0x41, 0x7B,
+    0xE0, 0x58, 0xE0, 0xA6, 0x4A, 0x80, 0x33, 0x72, 0xA6, 0x04, 0x79, 0x07, 0xDE, 0x06, 0xA5, 0x59,
+    0x4C, 0x71, 0x02, 0xBA, 0x56, 0x62, 0x97, 0x8F, 0x52, 0x49, 0x91, 0x64, 0x91, 0x9F, 0x24, 0x8C,
+    0xDC, 0x75, 0xB1, 0xF7, 0x9B, 0x54, 0x57, 0x00, 0xD1, 0xF0, 0x76, 0x0B, 0x35, 0x72, 0xB8, 0x9A,
+    0x09, 0xAE, 0x73, 0x92, 0x6D, 0x52, 0x6C, 0x3A, 0xF2, 0xB8, 0xCE, 0xE9, 0xEE, 0x99, 0x1A, 0x70,
+    0x8E, 0x02, 0xC7, 0x5D, 0xBE, 0xD1, 0x09, 0xED, 0x03, 0x1C, 0x7E, 0x67, 0x00, 0x0D, 0xF0, 0x8E,
+    0x99, 0x26, 0xB8, 0xDA, 0x4C, 0x76, 0x06, 0x6D, 0x90, 0xF7, 0xAB, 0x44, 0x84, 0x03, 0x4F, 0x17,
+    0x79, 0x6F, 0x1C, 0x9F, 0x8A, 0x0E, 0x4E, 0x3B, 0xDC, 0x02, 0x6D, 0x61, 0x97, 0x9A, 0xC8, 0xE2,
+    0xF5, 0xC8, 0x68, 0x26, 0x70, 0xDF, 0xE0, 0xB6, 0x23, 0x5A, 0x4F, 0x48, 0x05, 0x7D, 0x6D, 0x10,
+    0x6A, 0x4C, 0x3D, 0xA2, 0x01, 0x57, 0x18, 0xE0, 0x0B, 0x0B, 0xD6, 0x4B, 0x71, 0x2D, 0x79, 0x90,
+    0x83, 0x12, 0x66, 0x49, 0x31, 0x39, 0x37, 0xEB, 0xB7, 0x38, 0x7D, 0x42, 0x72, 0x21, 0xBD, 0x78,
+    0xFC, 0x3E, 0xBA, 0xF7, 0xC6, 0xD4, 0xED, 0x6F, 0x2F, 0x10, 0xFE, 0xA1, 0xC0, 0xAF, 0xDA, 0x8E,
+    0x17, 0xFB, 0xE1, 0x19, 0xA7, 0x7C, 0x36, 0x0F, 0x0D, 0x05, 0xD9, 0xCE, 0x8C, 0x14, 0x83, 0xB0,
+    0x63, 0x30, 0x5C, 0x38, 0x48, 0x34, 0xDC, 0xD3, 0xEC, 0x8C, 0xD8, 0x68, 0x0A, 0xC4, 0x92, 0xEB,
+    0x89, 0x12, 0x54, 0xF8, 0xE8, 0x86, 0xEF, 0xE1, 0xC4, 0x1B, 0x0B, 0x83, 0x38, 0xE2, 0x69, 0x93,
+    0x42, 0xCA, 0x16, 0xF9, 0x18, 0x61, 0x80, 0x01, 0x62, 0xAD, 0x60, 0xC9, 0x4F, 0x46, 0x2D, 0x7C,
+    0x80, 0x15, 0x10, 0x2C, 0xE7, 0xBA, 0x3B, 0x9B, 0xD1, 0x6C, 0x85, 0xC4, 0xCB, 0x09, 0xA5, 0x21,
+    0x05, 0xE4, 0x67, 0xAB, 0xE9, 0xDD, 0xFB, 0xE3, 0xB6, 0xEC, 0xF9, 0xEA, 0x4C, 0x13, 0x2F, 0x71,
+    0xD1, 0x0E, 0xEF, 0x08, 0x1D, 0x4E, 0x9C, 0x5B, 0xA5, 0xC5, 0xE6, 0x74, 0x80, 0xC6, 0x02, 0xD9,
+    0x08, 0xAB, 0x38, 0x98, 0x2C, 0xE5, 0x7D, 0x92, 0x2A, 0xFC, 0x2D, 0x77, 0x25, 0xFE, 0xA9, 0x43,
+    0xDE, 0xB9, 0xE5, 0xBB, 0xCF, 0xE5, 0x7B, 0xA9, 0xBE, 0xCC, 0xBA, 0x90, 0xFC, 0xD8, 0xDF, 0x85,
+    0x58, 0xFB, 0x59, 0xDE, 0x95, 0x12, 0x5E, 0x5F, 0x2E, 0xA1, 0x17, 0x2D, 0xF4, 0x09, 0x92, 0x71,
+    0x6C, 0xDB, 0xCD, 0x0A, 0xA4, 0xAD, 0xCD, 0x05, 0xD3, 0x2F, 0xDF, 0x10, 0x05, 0x33, 0x10, 0xEE,
+    0x28, 0x4F, 0x4B, 0xDB, 0xE0, 0x6F, 0xBE, 0x01, 0xCA, 0xEF, 0xCC, 0x33, 0xC3, 0x4B, 0x0A, 0x79,
+    0x93, 0xD9, 0xE5, 0xFF, 0xC1, 0xD2, 0xFF, 0xB7, 0x72, 0x5F, 0x00, 0x6D, 0xF9, 0xEB, 0x46, 0xF9,
+    0x02, 0x5E, 0xB1, 0x5E, 0x50, 0x3B, 0x48, 0x58, 0xBF, 0x90, 0x3D, 0xBD, 0x7C, 0x3E, 0xB2, 0xF2,
+    0xB5, 0x46, 0xC0, 0xAD, 0xC0, 0x11, 0x1B, 0xEE, 0x67, 0x4F, 0x64, 0x1D, 0xEB, 0x73, 0x41, 0xDE,
+    0x21, 0x13, 0x11, 0x0E, 0x70, 0x98, 0x1B, 0x24, 0x83, 0xD7, 0x74, 0x5F, 0x8F, 0x60, 0x1F, 0xFE,
+    0x83, 0xC1, 0x86, 0xF5, 0x5E, 0x25, 0x94, 0x2E, 0x18, 0x57, 0x76, 0x1A, 0x68, 0xE9, 0x11, 0x46,
+    0xF4, 0x9B, 0xB0, 0x1D, 0xB5, 0xCB, 0x21, 0x06, 0xFD, 0x82, 0xFF, 0xA6, 0x73, 0x5A, 0x97, 0xFF,
+    0x3E, 0x54, 0x36, 0x15, 0x1D, 0xE9, 0xEC, 0xC4, 0xAA, 0x9D, 0xC5, 0x72, 0xB3, 0xB2, 0x64, 0xBD,
+    0x1E, 0xB7, 0x98, 0x23, 0x81, 0x0A, 0xCD, 0xB4, 0xDB, 0x4D, 0xEB, 0xD5, 0x04, 0x76, 0x6A, 0x32,
+    0x45, 0xB7, 0xDB, 0x51, 0xF6, 0x30, 0x23, 0xFA, 0x64, 0x84, 0xE1, 0xB7, 0x1E, 0xF3, 0x26, 0x96,
+    0xD1, 0x96, 0x6A, 0x52, 0xFA, 0xD7, 0x43, 0x43, 0xB8, 0x52, 0xAB, 0xE9, 0x82, 0x5A, 0x62, 0x48,
+    0xE4, 0xDB, 0xDA, 0x10, 0x15, 0x07, 0x43, 0x11, 0xD9, 0xF1, 0x38, 0xE3, 0x69, 0x61, 0x6E, 0x95,
+    0xE3, 0x57, 0xD0, 0x53, 0x71, 0x21, 0x55, 0x4F, 0x9F, 0xD0, 0xF6, 0x90, 0x09, 0xAD, 0xCD, 0xB8,
+    0x19, 0x46, 0x72, 0x8C, 0xBE, 0xA9, 0xCC, 0x4D, 0x26, 0x61, 0x43, 0xE7, 0xC1, 0xA0, 0x5F, 0xDD,
+    0x41, 0x6B, 0x5A, 0x55, 0x53, 0xB9, 0xDA, 0x3C, 0x5F, 0x2B, 0x66, 0x14, 0xE8, 0xFC, 0x33, 0xBA,
+    0x71, 0x7C, 0x0E, 0x68, 0x15, 0x43, 0xE2, 0x0D, 0x82, 0xEA, 0x31, 0x59, 0xA6, 0xEE, 0xA9, 0x6A,
+    0x59, 0x4F, 0x2E, 0x99, 0x32, 0x97, 0x9B, 0xC1, 0xED, 0x29, 0xB5, 0x18, 0xDA, 0x24, 0x99, 0x49,
+    0x55, 0x37, 0xA5, 0xD0, 0x52, 0x68, 0xCF, 0xA2, 0x37, 0x9A, 0x51, 0xF6, 0x05, 0xDD, 0xE3, 0x4F,
+    0xC5, 0x47, 0x18, 0xCA, 0x08, 0xCB, 0x98, 0xF6, 0x7A, 0xBC, 0x6F, 0x29, 0xBE, 0x9B, 0x65, 0xF6,
+    0xEC, 0xD4, 0x54, 0x94, 0xB6, 0xA9, 0x35, 0x64, 0x0F, 0xEE, 0xEF, 0x85, 0x68, 0xC0, 0xAC, 0xE8,
+    0xCC, 0xA2, 0x67, 0x38, 0x2C, 0xAB, 0x23, 0x53, 0xB5, 0xB0, 0x46, 0x3A, 0x5D, 0x07, 0x47, 0xD8,
+    0x0F, 0x9E, 0x51, 0x05, 0x5C, 0x27, 0x96, 0xE4, 0x8C, 0x91, 0x42, 0x5F, 0xB8, 0x47, 0x62, 0xA5,
+    0x16, 0x76, 0x17, 0xC6, 0xB7, 0x51, 0xB5, 0x00, 0xF3, 0xE0, 0x47, 0xD8, 0x4A, 0x5E, 0x57, 0xB6,
+    0x45, 0x9D, 0x71, 0x80, 0x56, 0x63, 0x2F, 0x95, 0x2F, 0x20, 0x57, 0xF6, 0x51, 0x5F, 0x7C, 0xAA,
+    0xC6, 0xE7, 0x62, 0xBE, 0x59, 0xD3, 0xC6, 0x93, 0xC6, 0xC2, 0x7B, 0x8E, 0xC6, 0x63, 0x10, 0xD1,
+    0x83, 0x81, 0x11, 0x8B, 0x60, 0x33, 0x50, 0x62, 0x8B, 0x78, 0x62, 0x8B, 0xFA, 0xC0, 0x16, 0x8A,
+    0x51, 0xE8, 0x7B, 0xA8, 0x91, 0xD5, 0xD8, 0xB6, 0x3D, 0xB7, 0x7C, 0x39, 0xF4, 0x4E, 0x7F, 0x7B,
+    0xC0, 0xF6, 0xCC, 0x1C, 0xCA, 0xAD, 0x6C, 0xF6, 0x99, 0x75, 0xA4, 0x75, 0xDC, 0x83, 0xCC, 0x1C,
+    0x63, 0xE7, 0x46, 0xE3, 0x47, 0x91, 0x16, 0x78, 0xAB, 0xCD, 0x56, 0xAD, 0xFE, 0x15, 0x6D, 0x05,
+    0xBE, 0x8F, 0xC8, 0x6E, 0xC1, 0x3A, 0x02, 0x70, 0xBC, 0x84, 0xF8, 0x6D, 0x12, 0x1B, 0x82, 0x92,
+    0x50, 0x84, 0x11, 0x8C, 0x02, 0x1D, 0xA1, 0xD9, 0x17, 0x3C, 0xE2, 0x35, 0x73, 0x67, 0x92, 0x0F,
+    0x1C, 0xFF, 0x03, 0xB5, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x5D, 0xDB, 0x20, 0x17, 0x2E, 0xB6,
+    0xA7, 0xF1, 0x27, 0xF8, 0x13, 0xF6, 0x4A, 0x29, 0x52, 0xA4, 0x46, 0x14, 0x14, 0xA9, 0x11, 0x45,
+    0x3E, 0x61, 0x2D, 0xE5, 0x03, 0x78, 0xFC, 0x04, 0x6D, 0x3E, 0x61, 0x4D, 0x95, 0x82, 0x22, 0x26,
+    0x7C, 0x00, 0x56, 0x14, 0x44, 0x41, 0x81, 0x23, 0x2C, 0xE1, 0x88, 0xF5, 0x1E, 0xCE, 0x19, 0xDF,
+    0x7B, 0x49, 0xA0, 0xC6, 0x7A, 0x6F, 0xB4, 0x5E, 0xEF, 0xCE, 0x9C, 0x39, 0x73, 0x66, 0xAE, 0x73,
+    0xCE, 0x0D, 0x2B, 0x8D, 0xC3, 0x48, 0xD3, 0x66, 0x2D, 0xC3, 0xB9, 0x71, 0xA1, 0xE9, 0xCE, 0x8D,
+    0x85, 0xA6, 0xFA, 0xEF, 0x86, 0xFB, 0x67, 0x63, 0xBE, 0x6F, 0xF8, 0xFD, 0xBE, 0x51, 0x7F, 0xB0,
+    0x11, 0x27, 0x9A, 0x86, 0x1B, 0xCD, 0xB7, 0x69, 0x63, 0x50, 0x80, 0x1B, 0xC0, 0xC1, 0xA0, 0x00,
+    0xDD, 0x05, 0x2D, 0xDD, 0xD7, 0x16, 0xE4, 0xF6, 0xC4, 0x29, 0x2D, 0xAE, 0x3E, 0xDA, 0x42, 0x27,
+    0x6B, 0x24, 0xAA, 0xF8, 0x5C, 0x0E, 0x0E, 0x01, 0xF4, 0x7F, 0xC8, 0x79, 0x7A, 0x46, 0x5F, 0x4D,
+    0xD1, 0xAD, 0x1E, 0x8A, 0x03, 0xE5, 0xD1, 0xD8, 0x72, 0x50, 0x04, 0x87, 0xA2, 0xBC, 0xCC, 0x0E,
+    0x16, 0xE2, 0x8C, 0x99, 0x41, 0xDC, 0xE1, 0x9D, 0x2C, 0x9E, 0xD3, 0x76, 0x47, 0xCB, 0x4B, 0x61,
+    0xF5, 0xBA, 0x5A, 0x95, 0x6B, 0xFE, 0x81, 0x1E, 0x7A, 0x06, 0xEB, 0x14, 0x25, 0x5F, 0x33, 0x4C,
+    0xE3, 0x99, 0x9E, 0x7D, 0xD8, 0x85, 0xE7, 0xF6, 0x61, 0x3A, 0x99, 0xB1, 0x0F, 0x05, 0x78, 0x04,
+    0xE0, 0x7B, 0xFE, 0xAF, 0x09, 0xD8, 0x83, 0xC5, 0x6D, 0x08, 0x6F, 0xD8, 0x9D, 0x2F, 0xBC, 0x31,
+    0xBB, 0x98, 0x9D, 0x07, 0x59, 0x5A, 0x5D, 0xD2, 0x6A, 0x6A, 0x49, 0x44, 0xC4, 0x25, 0xE0, 0x52,
+    0xE3, 0xA8, 0xA1, 0xBD, 0xBD, 0xE7, 0xD7, 0x88, 0x85, 0x79, 0xD5, 0x05, 0x3F, 0xD0, 0x87, 0xFF,
+    0x13, 0xF1, 0xE7, 0xCD, 0x85, 0x57, 0x28, 0x69, 0xAA, 0x11, 0x40, 0x22, 0x7C, 0x4E, 0x78, 0x4A,
+    0xF8, 0x6F, 0x90, 0xD3, 0x5C, 0xE1, 0x09, 0x7E, 0xD2, 0x5E, 0x8F, 0x3E, 0x33, 0xA5, 0xB8, 0x62,
+    0xA9, 0x30, 0x31, 0xCD, 0x4B, 0x57, 0x9A, 0x3C, 0x70, 0x8F, 0xE9, 0x60, 0x3D, 0x39, 0x86, 0x61,
+    0x66, 0xA2, 0x84, 0xD5, 0x2F, 0xC2, 0xE3, 0x57, 0xF2, 0x35, 0x31, 0xDD, 0x1A, 0x5B, 0x5D, 0x8C,
+    0x41, 0x1E, 0x8A, 0x98, 0x74, 0x08, 0xEB, 0xC0, 0x43, 0x7F, 0x65, 0xBF, 0xB9, 0xF6, 0x48, 0x8F,
+    0x33, 0x33, 0x1A, 0xDE, 0xE8, 0xD0, 0xCB, 0x4C, 0xC2, 0xE2, 0x3B, 0xB0, 0xCE, 0x81, 0xC9, 0xF2,
+    0xD0, 0xE1, 0xB1, 0xB9, 0x0E, 0x0D, 0x74, 0x68, 0x4A, 0x4A, 0x79, 0xE9, 0x79, 0x28, 0x6D, 0x74,
+    0xEF, 0x42, 0x76, 0x2A, 0x3B, 0xA9, 0x4B, 0xBB, 0x55, 0x88, 0x7C, 0xF0, 0xB4, 0x0A, 0xE5, 0xF1,
+    0x1D, 0x5F, 0xC8, 0x51, 0xBF, 0x93, 0x47, 0xA9, 0x48, 0x0A, 0x88, 0xB3, 0xD4, 0xE3, 0x37, 0xE9,
+    0x90, 0x94, 0x8B, 0x6C, 0x52, 0xB5, 0x48, 0x25, 0x22, 0xBC, 0x5F, 0xA5, 0x44, 0xBF, 0xD7, 0xA6,
+    0x10, 0xC9, 0x99, 0xC7, 0x29, 0x94, 0x1A, 0xA3, 0xC7, 0xC3, 0x97, 0xE0, 0x6D, 0x95, 0xC2, 0xC9,
+    0x6E, 0x92, 0x1F, 0x0B, 0xDD, 0x98, 0xA5, 0xF4, 0xB8, 0x43, 0x1C, 0x78, 0x70, 0x1F, 0x3F, 0xF1,
+    0x14, 0xA6, 0xC2, 0xEA, 0x6A, 0xBB, 0x55, 0x87, 0x64, 0x10, 0x46, 0x12, 0xE2, 0x59, 0xAA, 0x91,
+    0x2C, 0x84, 0x5F, 0x5E, 0xA8, 0x4E, 0xC4, 0xCD, 0x14, 0x54, 0x4C, 0x1D, 0xB7, 0x34, 0x22, 0xDE,
+    0x5E, 0x9B, 0xCB, 0x3A, 0x40, 0x39, 0xF0, 0xB3, 0xF4, 0x6D, 0xC2, 0x94, 0x9E, 0x45, 0xBA, 0x53,
+    0xA6, 0xE7, 0xF3, 0xD9, 0x83, 0x75, 0xD1, 0x29, 0x61, 0x49, 0x53, 0x2E, 0x27, 0xDA, 0x31, 0x92,
+    0x6E, 0x5C, 0x9A, 0x62, 0x1D, 0xA4, 0xB2, 0x9B, 0xCA, 0x78, 0x90, 0x1D, 0x4B, 0x26, 0x28, 0x3F,
+    0x31, 0x91, 0x46, 0xD6, 0x8E, 0x2B, 0xB5, 0xB1, 0xDF, 0x74, 0x48, 0x9F, 0xC7, 0x4F, 0x78, 0x2F,
+    0xAC, 0xDD, 0x6B, 0x82, 0x2E, 0x5F, 0x48, 0x48, 0x30, 0xB7, 0x11, 0xE2, 0x9C, 0xD0, 0x99, 0x65,
+    0x65, 0x56, 0xB4, 0x08, 0x10, 0xF5, 0x2A, 0x98, 0xDE, 0x34, 0x52, 0x5B, 0xEF, 0x90, 0x86, 0xF9,
+    0xCE, 0x0B, 0xCA, 0x45, 0x89, 0xAE, 0x42, 0x49, 0x16, 0xD7, 0x8A, 0xFD, 0x23, 0xE3, 0x97, 0x9A,
+    0x66, 0x6E, 0x76, 0x37, 0x4C, 0x2D, 0xA9, 0x99, 0x98, 0x7D, 0x50, 0x10, 0x73, 0x68, 0x0D, 0x70,
+    0x72, 0x34, 0x43, 0x89, 0x30, 0x21, 0x9A, 0x91, 0x25, 0x66, 0x8D, 0xA8, 0xF7, 0xB1, 0x3F, 0x28,
+    0x94, 0x21, 0xD3, 0x84, 0xDC, 0x1A, 0x49, 0x7A, 0xEA, 0xF4, 0xDE, 0x94, 0x61, 0x58, 0xA5, 0xD0,
+    0xDF, 0xD6, 0x93, 0xCC, 0xA6, 0xDC, 0x87, 0x8E, 0x4D, 0x97, 0xE1, 0xB8, 0xB7, 0xBA, 0xB1, 0xE7,
+    0x4D, 0x53, 0x51, 0x4B, 0xF7, 0xCC, 0xE6, 0x9B, 0x25, 0xE4, 0xB3, 0xDB, 0xA4, 0x2B, 0xBC, 0xA5,
+    0x1A, 0x45, 0xC5, 0x68, 0x46, 0x92, 0xB8, 0xF0, 0x1C, 0x8B, 0xF6, 0xE9, 0xE7, 0x7C, 0xF4, 0x5E,
+    0x88, 0x1E, 0x87, 0x4C, 0x16, 0x5B, 0x6C, 0x09, 0x8B, 0x7B, 0xDC, 0x46, 0xA5, 0x0D, 0x3F, 0xAB,
+    0x2E, 0x95, 0x70, 0x2D, 0xB6, 0x4D, 0x4F, 0x1B, 0x90, 0x71, 0xBE, 0x0E, 0x05, 0x2B, 0x78, 0x25,
+    0x04, 0x56, 0x7F, 0xD5, 0xF0, 0x34, 0x9D, 0x81, 0x67, 0x47, 0xAA, 0x51, 0x77, 0x2D, 0x78, 0x9B,
+    0x0B, 0x6A, 0x83, 0x0B, 0x0E, 0x3F, 0x2E, 0x44, 0xDF, 0x22, 0x0F, 0xFA, 0xA3, 0xF2, 0x26, 0x36,
+    0x40, 0xA5, 0x22, 0xCA, 0xD9, 0xA9, 0x08, 0x02, 0xE2, 0x82, 0x88, 0xDA, 0x43, 0x90, 0xBC, 0xFD,
+    0x69, 0xCC, 0xE0, 0x77, 0x2A, 0xDB, 0x9B, 0xEE, 0xFD, 0xBD, 0xDA, 0x93, 0xC8, 0x84, 0x09, 0x6D,
+    0xFF, 0x97, 0xDE, 0xD5, 0x53, 0x4F, 0x89, 0x3F, 0xBD, 0x64, 0x62, 0xF1, 0x47, 0x82, 0x0D, 0x0B,
+    0x47, 0xDD, 0xB0, 0x32, 0xC7, 0x7E, 0x6B, 0x34, 0x54, 0x08, 0xC0, 0x1F, 0x92, 0x53, 0xE1, 0x4B,
+    0xAB, 0x3A, 0x3E, 0x52, 0x6D, 0x5F, 0xAB, 0xA5, 0xDF, 0xDF, 0x6A, 0xD4, 0x28, 0x22, 0xAB, 0x6E,
+    0x83, 0x3E, 0x2B, 0xCF, 0xE3, 0x26, 0xA4, 0x04, 0x9B, 0xC4, 0x1F, 0x8C, 0x79, 0x23, 0x86, 0x2C,
+    0x5A, 0x2F, 0xD4, 0xA8, 0xED, 0x35, 0x2C, 0xC3, 0x66, 0x04, 0x5F, 0x3B, 0x66, 0xE4, 0xCC, 0xFA,
+    0x8A, 0x61, 0x1B, 0x5C, 0xFA, 0x85, 0xD5, 0x0F, 0x1C, 0x22, 0x84, 0xC2, 0x57, 0xAC, 0x1C, 0x13,
+    0x61, 0x0B, 0xC4, 0xC1, 0xB8, 0x1D, 0xF6, 0xB8, 0x68, 0xB0, 0xE3, 0x1B, 0x8D, 0x9D, 0x88, 0x83,
+    0xEE, 0x02, 0x8A, 0xF5, 0x2F, 0xF0, 0xEA, 0x6C, 0xCC, 0xED, 0x6C, 0xAB, 0xD2, 0x89, 0x01, 0x4E,
+    0x36, 0x81, 0xEA, 0xB0, 0x69, 0xFE, 0x3A, 0x0E, 0xAA, 0x68, 0x90, 0x39, 0x8E, 0xC7, 0xAB, 0xC0,
+    0xC8, 0x01, 0x19, 0x50, 0x8D, 0xD3, 0xD4, 0xEA, 0xE7, 0xA3, 0xD8, 0xAF, 0x21, 0x67, 0xEB, 0x2C,
+    0xC8, 0x2F, 0x4C, 0x01, 0x67, 0x9F, 0x58, 0xF7, 0xF2, 0xB6, 0xCD, 0xB6, 0x60, 0x04, 0xDF, 0xFC,
+    0xE4, 0x73, 0xA6, 0xCC, 0x76, 0xF8, 0xD4, 0x80, 0x09, 0x12, 0xBF, 0xEA, 0x40, 0xC8, 0xC1, 0x34,
+    0xCB, 0xEE, 0xD0, 0xBC, 0xEC, 0xD5, 0xE8, 0x9B, 0x14, 0x3B, 0x14, 0xBA, 0x1B, 0xDD, 0xFF, 0xF2,
+    0xFC, 0x0D, 0xA5, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x1D, 0xDB, 0x02, 0x8B, 0xB8, 0x30, 0x4D,
+    0x68, 0x52, 0x6C, 0x8F, 0x14, 0xED, 0x0F, 0x20, 0xAD, 0xE1, 0xFD, 0x40, 0x8A, 0xE4, 0x27, 0xA0,
+    0xE0, 0x0F, 0x62, 0x0B, 0x0A, 0xDA, 0xD7, 0xE4, 0x13, 0x22, 0xA1, 0x57, 0xA5, 0x45, 0x82, 0x78,
+    0x25, 0x7E, 0x60, 0xA5, 0x94, 0x14, 0x18, 0xE9, 0x21, 0x21, 0x68, 0x2C, 0xE1, 0xA7, 0x2C, 0x64,
+    0xED, 0xE5, 0x9C, 0xF1, 0xF5, 0xBD, 0x84, 0x94, 0xF8, 0x5D, 0x6F, 0x62, 0xEF, 0xCC, 0xD9, 0x39,
+    0x33, 0x67, 0xC6, 0xBD, 0x97, 0x26, 0xB9, 0x20, 0x66, 0x76, 0x93, 0xB8, 0x60, 0x67, 0xC9, 0x83,
+    0x9D, 0xCB, 0x2C, 0x66, 0x69, 0x92, 0xB4, 0xD1, 0x2C, 0xD2, 0x26, 0x6C, 0x35, 0x6B, 0x86, 0x65,
+    0xCE, 0x22, 0x75, 0x5E, 0x45, 0xAA, 0x1C, 0xB9, 0xCC, 0x22, 0x25, 0xDE, 0x63, 0x19, 0xF8, 0xD8,
+    0x71, 0x57, 0x04, 0x76, 0x58, 0xDA, 0x0D, 0x8B, 0x81, 0xAD, 0xD8, 0x24, 0xBC, 0x32, 0xAE, 0x20,
+    0x2D, 0x56, 0x3C, 0x8F, 0xF8, 0xC7, 0xC3, 0x3A, 0x13, 0xE8, 0xE3, 0x4C, 0x60, 0x58, 0x13, 0x0B,
+    0x2F, 0x27, 0x21, 0x64, 0x54, 0x27, 0xA2, 0x48, 0x4F, 0x68, 0xB1, 0x70, 0x07, 0x6E, 0x5E, 0xD4,
+    0x88, 0xA0, 0xC5, 0xEE, 0x37, 0xAA, 0x9F, 0xCB, 0x77, 0x4F, 0x3A, 0xC5, 0x5F, 0x8F, 0xC3, 0x8C,
+    0x3E, 0x94, 0x7C, 0x00, 0x3B, 0xAC, 0x9B, 0x1C, 0xA0, 0x05, 0x01, 0x4A, 0x2E, 0x15, 0x91, 0x6A,
+    0x82, 0x36, 0x33, 0xF1, 0x75, 0x61, 0x08, 0x56, 0x51, 0x75, 0x19, 0x18, 0x84, 0xBA, 0x72, 0x21,
+    0x4A, 0x41, 0x66, 0x25, 0x5D, 0xAB, 0xF8, 0xB6, 0x3F, 0x5D, 0x4D, 0x78, 0xCB, 0xBF, 0x67, 0xF8,
+    0xE3, 0xD9, 0xFF, 0xE2, 0x7A, 0xF1, 0x57, 0x57, 0x26, 0x54, 0x17, 0xC3, 0x1C, 0x28, 0xDF, 0x8F,
+    0x9E, 0x75, 0x1A, 0xF3, 0x07, 0x12, 0x1E, 0x56, 0xD3, 0xD3, 0x7A, 0xEE, 0xF7, 0xDF, 0xD5, 0xE2,
+    0xAE, 0xA2, 0xFB, 0x3A, 0xB9, 0x1F, 0xF5, 0xF7, 0x2A, 0xB9, 0xAB, 0xE9, 0x93, 0xAA, 0xFB, 0x50,
+    0xC9, 0xED, 0xBC, 0x34, 0x51, 0x17, 0x26, 0x1A, 0xC4, 0x76, 0x1C, 0x5D, 0x9F, 0x37, 0xF7, 0x08,
+    0x0F, 0x5E, 0x1A, 0xD2, 0x4E, 0x24, 0x1C, 0x9B, 0xE3, 0xC1, 0xF7, 0xB2, 0xA9, 0x04, 0x35, 0x2D,
+    0x97, 0xCD, 0xF8, 0xEE, 0x26, 0xE9, 0x16, 0x89, 0xE5, 0x8A, 0x27, 0x66, 0x8E, 0xB5, 0x1A, 0x59,
+    0xCF, 0x27, 0xCF, 0x79, 0x66, 0x81, 0x38, 0x5A, 0xDC, 0x63, 0x54, 0x23, 0xF7, 0x55, 0x02, 0xCE,
+    0xAA, 0x94, 0x55, 0x24, 0xAF, 0x58, 0x3C, 0xD6, 0x31, 0x7E, 0x7E, 0x73, 0x73, 0x73, 0x7D, 0x5F,
+    0xAA, 0x95, 0xF6, 0x7D, 0x28, 0xF2, 0x9E, 0x18, 0x91, 0xF7, 0x57, 0xE6, 0x6A, 0x83, 0xF9, 0x2A,
+    0x5B, 0xBD, 0x56, 0xB1, 0x4C, 0xF5, 0x5C, 0xA6, 0x26, 0x94, 0xA9, 0xF5, 0x65, 0x34, 0x5D, 0x15,
+    0xAD, 0x54, 0x8B, 0x43, 0x69, 0xDD, 0xEF, 0x79, 0x86, 0x0E, 0x66, 0x8B, 0x1B, 0x4A, 0x99, 0x54,
+    0xB8, 0xF7, 0x79, 0x54, 0xB7, 0x07, 0xBB, 0xED, 0xE5, 0x61, 0xCC, 0x4C, 0x53, 0x19, 0x71, 0xE0,
+    0x9B, 0xEC, 0x2B, 0xD8, 0x43, 0xAC, 0x4B, 0x93, 0x3F, 0x8D, 0x6D, 0x92, 0x84, 0x08, 0x12, 0x84,
+    0x92, 0xCC, 0x54, 0x46, 0x1B, 0xEA, 0xC5, 0xDE, 0xF5, 0xC4, 0x9D, 0x70, 0x7B, 0x60, 0xEF, 0x22,
+    0x7D, 0x7C, 0x8A, 0xEF, 0xC1, 0x8A, 0x7A, 0xC2, 0x7D, 0x93, 0x7C, 0xFD, 0x08, 0x09, 0x65, 0xEA,
+    0x47, 0x4D, 0x3E, 0xF3, 0x66, 0x83, 0x94, 0x5B, 0x21, 0xE6, 0xEF, 0x08, 0xD1, 0x06, 0x1C, 0x82,
+    0xF6, 0x19, 0xCE, 0x52, 0xD1, 0x2C, 0x1A, 0x7F, 0xE8, 0x52, 0x73, 0xCC, 0xC0, 0xCC, 0x92, 0x99,
+    0x4B, 0x58, 0xF2, 0x48, 0x71, 0x7F, 0x20, 0xB7, 0x2E, 0xB8, 0x88, 0xDC, 0xA3, 0x6F, 0x1B, 0x10,
+    0x03, 0x63, 0xF4, 0x32, 0x88, 0xE0, 0xC4, 0x5E, 0xD0, 0xD8, 0xD6, 0x9B, 0xC4, 0x8E, 0xDB, 0xB4,
+    0x3B, 0xBA, 0xDD, 0x11, 0xCF, 0xC0, 0xB5, 0xB7, 0x5A, 0x8A, 0x71, 0x80, 0x68, 0x12, 0xEE, 0xD1,
+    0x57, 0xA9, 0x58, 0xCA, 0xF4, 0xDE, 0x4B, 0x9A, 0x0E, 0xE3, 0xCE, 0x2C, 0x9A, 0xED, 0xF9, 0x23,
+    0x16, 0xB8, 0x64, 0x7D, 0xC6, 0xDB, 0x3A, 0xA0, 0x2E, 0x73, 0xC5, 0x7E, 0x76, 0x40, 0x2D, 0xC6,
+    0xDB, 0x9D, 0x6F, 0xBB, 0x02, 0xD6, 0x0B, 0x5E, 0x43, 0x08, 0x0C, 0xD6, 0x75, 0xD2, 0xDF, 0xBD,
+    0x68, 0x98, 0x80, 0x1C, 0xEE, 0xE5, 0x6F, 0xC9, 0x99, 0x52, 0x62, 0x2E, 0x38, 0x0B, 0x06, 0x55,
+    0x00, 0x08, 0x21, 0xCA, 0x0A, 0xE1, 0x61, 0x1E, 0xD5, 0x3A, 0x33, 0xEC, 0xB4, 0xA2, 0x51, 0x37,
+    0x0D, 0x1B, 0xD3, 0x68, 0x82, 0x48, 0x5C, 0xE7, 0x16, 0x79, 0x2A, 0x6E, 0x96, 0xEF, 0x05, 0x73,
+    0x09, 0x2F, 0x02, 0x24, 0xD4, 0x7B, 0x2C, 0x19, 0xC5, 0xAE, 0xF3, 0xC0, 0x76, 0xE7, 0x64, 0xC8,
+    0xE4, 0xB9, 0x71, 0x78, 0x20, 0xDC, 0xE6, 0xCD, 0xB9, 0xD5, 0x90, 0xC8, 0x7B, 0x5D, 0xAF, 0x93,
+    0xC8, 0x0B, 0x8B, 0x85, 0xE8, 0xB1, 0xF9, 0x40, 0xA7, 0x8B, 0x0A, 0x80, 0xF9, 0x56, 0x53, 0xD7,
+    0x9D, 0x3A, 0x93, 0x6F, 0xDB, 0x9F, 0x18, 0x0C, 0x35, 0x9A, 0x29, 0x88, 0xCF, 0x92, 0x8C, 0xBE,
+    0xF5, 0x54, 0x01, 0xB6, 0x8D, 0xB7, 0xA1, 0x8C, 0x20, 0xE5, 0xBA, 0xDE, 0xD7, 0x73, 0x13, 0x51,
+    0xE1, 0x3C, 0xB4, 0xB3, 0x59, 0xCA, 0xAD, 0xCC, 0x1D, 0x4A, 0x33, 0xD7, 0xAB, 0x7C, 0xA1, 0x9A,
+    0x78, 0xCC, 0x04, 0x42, 0xC6, 0x1C, 0xB0, 0xC8, 0x51, 0x92, 0xF3, 0xF5, 0x9D, 0x8A, 0x2F, 0x51,
+    0x7E, 0x65, 0x64, 0x01, 0xAB, 0x99, 0xE7, 0x37, 0x13, 0xC5, 0x82, 0x64, 0xA2, 0x8F, 0x9D, 0xFE,
+    0x46, 0x2F, 0x5F, 0xAA, 0x48, 0x7E, 0xD8, 0xF5, 0x5A, 0x1E, 0x73, 0xEC, 0x3F, 0x57, 0xEB, 0x77,
+    0x36, 0x94, 0x11, 0xC9, 0xB0, 0xCD, 0x5F, 0xFE, 0x4B, 0xE2, 0x9C, 0xE2, 0xCB, 0xCE, 0x11, 0x87,
+    0x68, 0xCB, 0x1F, 0xE6, 0x50, 0x88, 0x61, 0x49, 0x58, 0x0F, 0x98, 0xF6, 0xD3, 0x81, 0x79, 0x1C,
+    0x77, 0xF2, 0xA5, 0x20, 0xDA, 0x93, 0x2F, 0xE7, 0x8C, 0xFB, 0x26, 0x4A, 0x6F, 0x27, 0x19, 0x51,
+    0xD6, 0xCC, 0x8C, 0x2D, 0x18, 0x47, 0x41, 0x3F, 0x16, 0x1C, 0xDA, 0xFC, 0x86, 0xB4, 0xAF, 0xF3,
+    0x60, 0xFE, 0xCC, 0x93, 0xFD, 0x25, 0x2F, 0x2E, 0x8C, 0x30, 0xFA, 0x8D, 0x70, 0x40, 0x03, 0x18,
+    0xB0, 0xDA, 0x9D, 0xE9, 0xA0, 0xC2, 0x51, 0x61, 0x6C, 0x9A, 0x92, 0x44, 0xAB, 0x7A, 0xB7, 0xC2,
+    0xEF, 0x57, 0x04, 0xD8, 0xD9, 0x8C, 0x7A, 0x9C, 0xF9, 0xDA, 0x9F, 0x97, 0x86, 0x52, 0xCA, 0x29,
+    0x47, 0xFD, 0xBA, 0xE0, 0x74, 0x17, 0xED, 0x06, 0xD0, 0x3C, 0xB8, 0xC9, 0xF8, 0x26, 0x15, 0x19,
+    0xA5, 0x71, 0xA1, 0x41, 0xB1, 0xF0, 0x5F, 0xE7, 0xCD, 0xD4, 0xC4, 0x02, 0xC3, 0xA3, 0x73, 0xBE,
+    0x5D, 0xF4, 0x5D, 0xEF, 0xCD, 0xDC, 0x46, 0x08, 0x71, 0x1C, 0xB0, 0x3D, 0x57, 0x2B, 0x9A, 0x69,
+    0x1C, 0xF4, 0xDD, 0xCA, 0xCC, 0x6B, 0xAF, 0xFC, 0x05, 0x7A, 0x14, 0x4F, 0xC5, 0x23, 0xFA, 0xA5,
+    0x1F, 0x80, 0x82, 0x0E, 0x16, 0x3B, 0x98, 0xC0, 0x09, 0x84, 0x71, 0xEB, 0x7C, 0x33, 0xD7, 0x7C,
+    0xA7, 0xCE, 0x10, 0x02, 0xCF, 0xC3, 0x27, 0x16, 0x23, 0x2A, 0x13, 0xA7, 0x18, 0xAF, 0xE1, 0xBE,
+    0x31, 0xCE, 0x50, 0x6D, 0x75, 0x22, 0x3A, 0x98, 0x5A, 0x3F, 0x82, 0xA1, 0x1B, 0xAA, 0xD4, 0x4E,
+    0xC5, 0x06, 0xBA, 0xB9, 0xC0, 0x9F, 0xEF, 0x61, 0xC5, 0x91, 0xC5, 0x51, 0x04, 0xCA, 0xD3, 0xFE,
+    0xD1, 0xFD, 0xBF, 0xD7, 0x3F, 0x75, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0xBA, 0x33,
+    0xC4, 0x42, 0x4B, 0x43, 0x81, 0x40, 0xD9, 0x5F, 0x00, 0xFB, 0x0B, 0xC2, 0x9A, 0x20, 0x71, 0x05,
+    0xCD, 0x15, 0xFC, 0x8A, 0x6B, 0xAE, 0xA1, 0xA0, 0xB8, 0xC4, 0x86, 0x14, 0x69, 0xAF, 0x80, 0x9A,
+    0x94, 0x70, 0x42, 0x22, 0x05, 0x25, 0x8A, 0x2D, 0x5D, 0x91, 0x92, 0x3D, 0x22, 0x41, 0xEB, 0x08,
+    0x24, 0x3A, 0x6E, 0x45, 0x2C, 0xC5, 0x01, 0xDB, 0xC3, 0x7B, 0xEB, 0xEF, 0xE0, 0x04, 0xC2, 0xFA,
+    0x3E, 0xDB, 0xBB, 0xDE, 0x9D, 0x79, 0x33, 0xF3, 0xDE, 0xAC, 0x88, 0xEC, 0x1D, 0x8A, 0x54, 0xCF,
+    0xB5, 0x17, 0x51, 0x55, 0x11, 0xA3, 0x3F, 0x8E, 0x78, 0x1D, 0x4C, 0x2B, 0x76, 0x92, 0xEF, 0x24,
+    0x57, 0x31, 0xBD, 0xF8, 0x41, 0x26, 0x29, 0x16, 0xB1, 0xB5, 0x34, 0xA1, 0x88, 0x62, 0xD6, 0x6C,
+    0x4D, 0x1B, 0x7A, 0x71, 0xAA, 0xA3, 0x14, 0xAA, 0x18, 0x77, 0xAA, 0xB5, 0x98, 0xF1, 0xA8, 0x96,
+    0x0C, 0x96, 0x84, 0xBB, 0x44, 0xCA, 0x99, 0xAF, 0xDA, 0xE2, 0x66, 0x23, 0x6E, 0xC5, 0x2A, 0xFF,
+    0xBA, 0xDE, 0x18, 0x60, 0x58, 0x2F, 0xFB, 0x52, 0x75, 0x96, 0xA5, 0xD4, 0xDA, 0xD7, 0x3E, 0x96,
+    0x43, 0xBE, 0xC2, 0xBD, 0x0F, 0xA6, 0x2D, 0xE6, 0x6C, 0x94, 0xA6, 0x75, 0xB5, 0x19, 0xF3, 0xA9,
+    0x54, 0x7A, 0x1C, 0x32, 0xD5, 0x05, 0x58, 0xE1, 0xBF, 0xC1, 0x26, 0x79, 0x74, 0xFC, 0x4D, 0x0D,
+    0x10, 0xB0, 0xEF, 0x61, 0xBE, 0xD2, 0x00, 0x8F, 0xA7, 0x22, 0x37, 0xEB, 0x9D, 0x0B, 0xF3, 0x2B,
+    0x2C, 0x68, 0xC8, 0x01, 0xD0, 0xE8, 0x57, 0x04, 0x46, 0x84, 0x15, 0xD7, 0xF7, 0xC2, 0x50, 0x2A,
+    0x04, 0xED, 0x43, 0x9A, 0x35, 0xB0, 0xE7, 0x23, 0x02, 0xEF, 0xE5, 0xC6, 0xA3, 0xDD, 0xFE, 0x5C,
+    0x7F, 0x01, 0xC4, 0x59, 0xFC, 0xE7, 0xDF, 0xCA, 0x5D, 0x8C, 0xEF, 0xE0, 0xDF, 0xD4, 0x9B, 0x37,
+    0xA3, 0xDC, 0x07, 0x53, 0xD5, 0x84, 0xFF, 0x5C, 0x04, 0x3B, 0x01, 0x58, 0xF4, 0x40, 0xD9, 0xC0,
+    0xDF, 0x3E, 0xB6, 0xFE, 0x7D, 0xBD, 0x8E, 0x6D, 0xC9, 0xA7, 0x19, 0xA4, 0x8C, 0xC4, 0x8E, 0x65,
+    0xF8, 0xF5, 0xBB, 0xA9, 0x51, 0x72, 0x78, 0x87, 0x51, 0x5F, 0x8B, 0xC3, 0x94, 0xC6, 0x02, 0x5E,
+    0x51, 0x17, 0xAF, 0x3D, 0xD6, 0x77, 0xD5, 0x20, 0xAB, 0x09, 0xD9, 0x62, 0x42, 0x3E, 0x9B, 0xBE,
+    0x98, 0x6D, 0x5F, 0x4C, 0xAE, 0xAF, 0x26, 0xD7, 0x9A, 0xD1, 0xD7, 0x36, 0x32, 0x73, 0x3E, 0x74,
+    0x03, 0x4C, 0x86, 0x64, 0x16, 0x7F, 0xA4, 0xAB, 0xDD, 0xA7, 0xC9, 0x56, 0xDC, 0x93, 0x59, 0xCA,
+    0x09, 0xBE, 0x34, 0x5F, 0xC4, 0x05, 0x3B, 0x94, 0x13, 0x22, 0x46, 0x85, 0x23, 0xE7, 0x3E, 0x98,
+    0xC4, 0xBC, 0x50, 0x96, 0xB1, 0x97, 0x12, 0x45, 0x05, 0x3C, 0x94, 0x8F, 0xB9, 0x6C, 0x66, 0xBE,
+    0xA0, 0x84, 0x0D, 0xFF, 0x5F, 0xA0, 0xAC, 0xFE, 0x31, 0x82, 0x75, 0x17, 0x6B, 0x1E, 0x4D, 0x6C,
+    0x3E, 0x59, 0xAA, 0xD1, 0x3E, 0xD5, 0xFB, 0x73, 0x39, 0xE9, 0xB3, 0x05, 0xA5, 0x59, 0x15, 0x7B,
+    0x11, 0xBB, 0x25, 0x43, 0x50, 0x56, 0x0D, 0x99, 0xFE, 0xA9, 0x83, 0x34, 0x13, 0xF2, 0x64, 0x67,
+    0x37, 0x81, 0x15, 0x1B, 0x2F, 0x64, 0x63, 0x08, 0x78, 0xA3, 0x35, 0xBC, 0xB9, 0xA8, 0x64, 0x08,
+    0xD9, 0xD3, 0xF1, 0x66, 0x78, 0x2B, 0x34, 0x55, 0x20, 0xF0, 0x6D, 0xE6, 0x4D, 0x59, 0x6B, 0x94,
+    0xA8, 0xD4, 0x6A, 0x91, 0x72, 0xCD, 0xB4, 0xAF, 0x56, 0xF1, 0x63, 0x4A, 0x2C, 0x83, 0x91, 0x8E,
+    0x5C, 0x45, 0xBC, 0x5D, 0x8B, 0x24, 0xDA, 0x68, 0x03, 0xC6, 0x98, 0x16, 0xBD, 0x8F, 0x45, 0xEE,
+    0xD9, 0xC4, 0x68, 0xE8, 0x9E, 0xA4, 0x45, 0x6A, 0x85, 0x94, 0x41, 0x35, 0x33, 0xAA, 0x80, 0x46,
+    0xB0, 0x88, 0xD4, 0x75, 0xD8, 0xB2, 0xD7, 0x8D, 0x84, 0x31, 0xED, 0x9C, 0x67, 0x7C, 0x93, 0x6E,
+    0x48, 0xC0, 0x0B, 0x52, 0x1F, 0x31, 0x86, 0x8D, 0xF9, 0xE2, 0x46, 0xE2, 0x94, 0x44, 0x1F, 0xE0,
+    0xDA, 0x2D, 0x04, 0x46, 0x78, 0x02, 0x7A, 0x9B, 0xF6, 0xFF, 0xF1, 0x25, 0x79, 0x3B, 0x31, 0x41,
+    0x28, 0xAE, 0x26, 0x97, 0xBC, 0xF6, 0xF1, 0x46, 0xE2, 0x56, 0x48, 0x11, 0x35, 0x42, 0x56, 0x32,
+    0x2F, 0x09, 0x8F, 0x85, 0x1D, 0x33, 0x6E, 0x62, 0xEA, 0xF0, 0xC1, 0xAD, 0x5B, 0x6E, 0x0A, 0x6E,
+    0x67, 0x64, 0x45, 0xB2, 0x4D, 0x8F, 0xBB, 0x1D, 0x9C, 0x2C, 0x61, 0x2A, 0x23, 0x6A, 0xD2, 0x34,
+    0xD7, 0x2B, 0x31, 0xE4, 0x53, 0x92, 0xB4, 0x64, 0x78, 0x86, 0xED, 0x59, 0xA5, 0xE7, 0x2C, 0xE0,
+    0x97, 0x17, 0x01, 0x49, 0x06, 0x32, 0x30, 0x3D, 0x5D, 0x7A, 0x46, 0x71, 0xAD, 0x2C, 0x92, 0x3F,
+    0xB8, 0x2A, 0x9A, 0x0E, 0xC9, 0x74, 0x4E, 0xF3, 0xD5, 0xBC, 0x91, 0x9F, 0x08, 0xE9, 0x97, 0x68,
+    0x5D, 0xD8, 0xF4, 0x4F, 0xD7, 0x1E, 0xDF, 0x1D, 0x91, 0x63, 0x0D, 0x30, 0x82, 0x7B, 0x09, 0x2F,
+    0x83, 0xA9, 0xB6, 0x2D, 0x15, 0xCC, 0x99, 0xD4, 0x4C, 0xB0, 0x7A, 0xA7, 0x97, 0xEA, 0x22, 0x76,
+    0x8F, 0xCF, 0x2F, 0x57, 0x67, 0xE3, 0x09, 0x40, 0x58, 0xC5, 0xAA, 0x9E, 0x34, 0x40, 0x54, 0x7E,
+    0xA2, 0x4C, 0x13, 0x31, 0xFE, 0x7B, 0xE5, 0xAD, 0x94, 0x81, 0x56, 0xE1, 0x84, 0x59, 0x6C, 0x36,
+    0x2D, 0x61, 0x0C, 0xFF, 0x4B, 0x1A, 0xDB, 0x9E, 0xE2, 0xDF, 0x8D, 0x11, 0xB1, 0x45, 0xFE, 0xAF,
+    0x9B, 0x88, 0x69, 0x2A, 0x07, 0xFE, 0x5B, 0xE8, 0x4F, 0xEC, 0x34, 0xB1, 0x04, 0x59, 0x74, 0x3A,
+    0xF4, 0xDF, 0xD7, 0xE5, 0x18, 0x45, 0x8D, 0x98, 0xA7, 0x43, 0xB6, 0xBC, 0x2D, 0xF6, 0x49, 0xC8,
+    0xD7, 0x5B, 0x80, 0x37, 0x41, 0xA7, 0x01, 0x64, 0x07, 0xCC, 0x56, 0xCC, 0x66, 0xE4, 0x26, 0xAA,
+    0x72, 0x7A, 0xDD, 0x70, 0xD6, 0x31, 0x2F, 0x4A, 0xEE, 0x22, 0x64, 0x1F, 0x00, 0x84, 0x44, 0x2C,
+    0x48, 0x28, 0xC3, 0x1E, 0xF9, 0x0E, 0x57, 0xA5, 0xA9, 0x98, 0x08, 0xC6, 0xD6, 0x88, 0xE5, 0x47,
+    0x7A, 0xD6, 0x4A, 0x31, 0xB2, 0x89, 0x86, 0x8D, 0x64, 0xD9, 0x46, 0x4C, 0xFD, 0x8C, 0x4C, 0x1A,
+    0xD1, 0xD9, 0x34, 0xDE, 0x38, 0x3B, 0x3B, 0x6B, 0x77, 0xC9, 0xAB, 0x73, 0xE0, 0xF8, 0x69, 0xA8,
+    0x68, 0x81, 0xCD, 0xD9, 0xFF, 0x40, 0xC5, 0xFB, 0xDA, 0x40, 0x0D, 0xC5, 0x02, 0x66, 0x6B, 0x02,
+    0xAC, 0x50, 0xAB, 0xB2, 0x5D, 0xC4, 0xB2, 0xBF, 0x1D, 0xA5, 0x96, 0x57, 0x13, 0xE9, 0x9A, 0x1E,
+    0x35, 0xC5, 0x22, 0x3F, 0x54, 0xAC, 0xF1, 0x7B, 0xF0, 0x67, 0x97, 0xED, 0x8C, 0x88, 0x57, 0xE2,
+    0x49, 0xBA, 0xD9, 0x24, 0x63, 0xB7, 0x4F, 0xC8, 0xA5, 0xA3, 0x1A, 0x90, 0xAA, 0x43, 0x36, 0x48,
+    0x7E, 0x32, 0x73, 0xCD, 0x46, 0x92, 0xF8, 0x4A, 0x66, 0xA7, 0x43, 0x66, 0x77, 0x32, 0x50, 0x18,
+    0xD2, 0xF5, 0xFF, 0x24, 0xE7, 0x01, 0xD2, 0x5D, 0xF6, 0x38, 0x6A, 0x4C, 0x9D, 0x81, 0x71, 0x52,
+    0x5C, 0xCF, 0xDD, 0x43, 0x14, 0xAA, 0x08, 0x72, 0x22, 0x15, 0x57, 0xD8, 0x3A, 0x8F, 0x48, 0x56,
+    0x9E, 0x48, 0x7D, 0x44, 0xB1, 0x02, 0x76, 0x9E, 0x0E, 0xA0, 0x70, 0x22, 0x38, 0x39, 0x4E, 0xC9,
+    0x73, 0x0A, 0xFB, 0x14, 0x20, 0x01, 0xCA, 0x52, 0x6A, 0xFA, 0xBE, 0x92, 0xE3, 0x38, 0x57, 0x04,
+    0xDB, 0xF5, 0xAC, 0x6B, 0x0B, 0x1E, 0x3A, 0x25, 0xBF, 0xED, 0xA7, 0xA8, 0x36, 0xE1, 0xF7, 0x72,
+    0x27, 0x5B, 0x38, 0x8D, 0x14, 0x10, 0xF0, 0x31, 0x4F, 0x93, 0xEC, 0xC3, 0xBD, 0xC3, 0xE6, 0xD3,
+    0xC5, 0x4C, 0xFE, 0x42, 0x0F, 0x66, 0x37, 0xEA, 0xB9, 0x42, 0xD2, 0xD8, 0x80, 0x3E, 0x79, 0xF7,
+    0x20, 0xF8, 0xE9, 0x04, 0x2D, 0xD5, 0xC4, 0xF2, 0x1E, 0xCE, 0x80, 0xE7, 0xBF, 0x47, 0x77, 0x00,
+    0x7D, 0x8F, 0x49, 0x08, 0x80, 0xF1, 0x75, 0x71, 0xD9, 0x3F, 0xFC, 0xF8, 0x95, 0xF2, 0xDD, 0xFE,
+    0xA3, 0xB7, 0x8E, 0x71, 0x5C, 0x54, 0xBF, 0x5D, 0xE9, 0x5E, 0xDE, 0x44, 0x58, 0x55, 0x9B, 0xCD,
+    0xE8, 0xFE, 0x7A, 0x7B, 0x45, 0x8F, 0x55, 0x14, 0xD9, 0xE3, 0xD8, 0x83, 0x9E, 0x7C, 0x44, 0x7E,
+    0xF4, 0x9E, 0x42, 0x2C, 0x18, 0xB9, 0x1A, 0xA7, 0x47, 0xCC, 0x71, 0xDE, 0xC8, 0x4B, 0xF2, 0xF2,
+    0x21, 0x03, 0x7B, 0x81, 0x8C, 0xFF, 0xCC, 0xD4, 0xBF, 0x86, 0x74, 0x53, 0x55, 0x68, 0x7B, 0x14,
+    0x95, 0xD6, 0xF8, 0x10, 0x91, 0xED, 0xF3, 0x74, 0x34, 0xFF, 0xCF, 0xF5, 0x17, 0xCD, 0x54, 0x31,
+    0x8C, 0xDC, 0x44, 0x14, 0x7D, 0xE3, 0x01, 0x2C, 0xB4, 0xC5, 0x50, 0xE4, 0x0A, 0x40, 0xBA, 0xE9,
+    0x69, 0xDC, 0x52, 0x90, 0xD8, 0x90, 0x32, 0x4D, 0x8A, 0x5C, 0x0B, 0x3D, 0xCD, 0x49, 0x88, 0xE2,
+    0x24, 0x82, 0x6C, 0x44, 0x49, 0x93, 0x8A, 0x96, 0x3E, 0x14, 0x2B, 0x51, 0x51, 0x9C, 0xCE, 0x73,
+    0xB9, 0x22, 0x45, 0x0A, 0xF6, 0x4A, 0x44, 0x63, 0x09, 0xD1, 0x40, 0x91, 0x39, 0x69, 0x0A, 0x13,
+    0x6C, 0x0F, 0xEF, 0xCF, 0xEC, 0x6E, 0x72, 0x84, 0x48, 0x94, 0x8C, 0x76, 0x67, 0xED, 0xD9, 0xF9,
+    0xFF, 0xBF, 0xFF, 0xFE, 0xFB, 0x1F, 0x00, 0xDE, 0x1D, 0x51, 0xC5, 0xAE, 0xFA, 0x33, 0xD8, 0x8B,
+    0x43, 0xF3, 0xC3, 0x9D, 0xAF, 0x9F, 0x5E, 0x0C, 0xCB, 0x67, 0xBE, 0xFE, 0x24, 0x94, 0x31, 0xA0,
+    0x1D, 0x90, 0x57, 0x1D, 0x7F, 0x8D, 0xF1, 0xE7, 0xA3, 0xBB, 0xF2, 0xAC, 0xCE, 0x1A, 0xC4, 0x99,
+    0x47, 0xDE, 0x84, 0xFA, 0xC3, 0x49, 0x07, 0xEB, 0xFA, 0x22, 0xC6, 0xC1, 0xC4, 0x09, 0xFD, 0x92,
+    0xFE, 0xE6, 0xBA, 0xC7, 0xAF, 0x11, 0xF3, 0x9A, 0xAF, 0x6A, 0x02, 0xDE, 0x59, 0x3F, 0x7B, 0x80,
+    0x18, 0x63, 0x57, 0x46, 0x5A, 0x5F, 0xFF, 0x0F, 0xAB, 0x5D, 0xA0, 0xFD, 0xFA, 0xB4, 0x9F, 0xC0,
+    0x9B, 0x81, 0x71, 0xE2, 0x26, 0x1F, 0xBD, 0x31, 0xEA, 0x3F, 0x1A, 0x0C, 0xF0, 0x2A, 0x94, 0x41,
+    0xC7, 0x8F, 0x78, 0x7E, 0x03, 0x55, 0x50, 0xBA, 0xC3, 0xFB, 0x58, 0xA3, 0x1A, 0x60, 0xF0, 0xAD,
+    0xB7, 0x73, 0x11, 0x1B, 0x4C, 0x45, 0x28, 0x07, 0xE3, 0xEA, 0x8E, 0x76, 0x65, 0x40, 0x8F, 0x95,
+    0xC7, 0xC2, 0xA0, 0x6A, 0x86, 0xD9, 0x14, 0x13, 0x8C, 0xD3, 0x13, 0x2A, 0xA7, 0x47, 0xD4, 0x6E,
+    0x35, 0xA2, 0xED, 0x0C, 0x2F, 0x35, 0xD6, 0x23, 0x36, 0xB5, 0x57, 0x71, 0xD3, 0x0F, 0x9A, 0x58,
+    0x37, 0xB2, 0xB9, 0x95, 0x6C, 0x46, 0xA0, 0xDB, 0xC7, 0x0B, 0x50, 0x89, 0xCF, 0xFA, 0x05, 0xA8,
+    0xEB, 0xC7, 0x9E, 0x1C, 0x56, 0xAE, 0x88, 0x61, 0x81, 0x8D, 0x17, 0x01, 0x71, 0xB1, 0x4E, 0xC7,
+    0xD0, 0xC2, 0xC4, 0x47, 0xE4, 0x77, 0x31, 0x1B, 0xD4, 0x81, 0x26, 0xED, 0xF9, 0x04, 0xBD, 0x30,
+    0x59, 0x1B, 0x98, 0x7A, 0x74, 0xF2, 0x56, 0xD2, 0x38, 0xD0, 0x67, 0x74, 0x33, 0x56, 0x8B, 0xF6,
+    0xBC, 0x69, 0xE9, 0xCA, 0x9D, 0xC1, 0x2C, 0x9A, 0x25, 0x08, 0xC6, 0xA9, 0xA3, 0xE6, 0x80, 0x1C,
+    0x85, 0xFA, 0x3C, 0x9A, 0xA9, 0xBD, 0x3A, 0x6A, 0x8A, 0x41, 0xBB, 0xD5, 0x60, 0xC6, 0x1B, 0xA7,
+    0xD5, 0x58, 0xFB, 0xF7, 0x1A, 0xE5, 0x8D, 0xFB, 0x18, 0x9F, 0x6B, 0x67, 0x70, 0x62, 0xE7, 0xDE,
+    0x17, 0x64, 0xEA, 0xD1, 0xE0, 0xFD, 0x07, 0x27, 0x87, 0x76, 0x7D, 0x3B, 0x76, 0x6D, 0x2A, 0x89,
+    0x6E, 0xDE, 0x04, 0x6E, 0xE1, 0x3E, 0x29, 0xA7, 0xE3, 0xD5, 0x68, 0x49, 0x98, 0xAF, 0x36, 0xA4,
+    0xA1, 0x6D, 0x54, 0x24, 0x1F, 0xF5, 0xC0, 0x3C, 0xA7, 0x8A, 0xF9, 0x6B, 0xA1, 0x89, 0xA0, 0x4E,
+    0xE0, 0x51, 0xE0, 0x35, 0x06, 0x77, 0xE2, 0x81, 0x4C, 0xC9, 0x22, 0xBF, 0x24, 0xF0, 0x6D, 0x4F,
+    0x97, 0x04, 0xCF, 0x83, 0x19, 0x7A, 0x48, 0xD5, 0xFC, 0x32, 0x95, 0x92, 0x97, 0x49, 0x31, 0xF8,
+    0xE9, 0x01, 0xDB, 0xC1, 0x3A, 0x56, 0xD1, 0x95, 0xC1, 0x6A, 0x4A, 0x64, 0x2E, 0x7D, 0x4B, 0x92,
+    0xBF, 0x5A, 0x92, 0x40, 0xBE, 0x60, 0x6D, 0xF5, 0x74, 0x78, 0x5F, 0xBC, 0x96, 0x4F, 0x18, 0xA4,
+    0x3A, 0xF7, 0xB3, 0xE4, 0xDA, 0x46, 0x0F, 0x35, 0x9B, 0xC8, 0x6B, 0x6D, 0x27, 0x74, 0x13, 0x2D,
+    0xA9, 0x22, 0x4A, 0x9C, 0x01, 0x0F, 0x33, 0xF3, 0x19, 0x15, 0xFA, 0xEE, 0x05, 0x58, 0xEA, 0xBB,
+    0x2C, 0xAC, 0x8C, 0x8B, 0xF9, 0xA2, 0x20, 0xEA, 0x0C, 0x0C, 0xA7, 0x0C, 0xE0, 0x76, 0xC8, 0xD4,
+    0x48, 0x26, 0x54, 0x82, 0xE6, 0x7B, 0xCF, 0x1F, 0x7B, 0x19, 0x27, 0xC1, 0x76, 0xFB, 0x01, 0xAF,
+    0x53, 0x2E, 0xB8, 0x49, 0x70, 0x63, 0xBA, 0x6E, 0x7C, 0x7A, 0xAA, 0x9D, 0xE0, 0xA0, 0xB1, 0x8A,
+    0x1D, 0x0A, 0x29, 0x98, 0x60, 0x65, 0xF5, 0x07, 0x39, 0xAF, 0xF9, 0x43, 0xB0, 0x3D, 0x85, 0x79,
+    0x94, 0x01, 0x1E, 0x27, 0x5D, 0x9B, 0x28, 0x38, 0x55, 0x73, 0x53, 0xF0, 0x41, 0x6F, 0x84, 0x36,
+    0x75, 0x2A, 0xF0, 0xC4, 0x5E, 0x94, 0x30, 0x24, 0x74, 0x55, 0xA2, 0x4D, 0x79, 0x01, 0xF7, 0x5B,
+    0x2F, 0xB4, 0xD1, 0xF1, 0x73, 0xDA, 0xAA, 0x05, 0xFF, 0x4A, 0xDB, 0x37, 0x89, 0xB6, 0xAB, 0xE9,
+    0x25, 0xDA, 0x0E, 0x58, 0x77, 0xC2, 0xD2, 0xFF, 0xA4, 0x8D, 0x31, 0x59, 0x3B, 0x49, 0x01, 0xA5,
+    0x74, 0x5F, 0xE5, 0x85, 0x44, 0xE9, 0xC5, 0x7B, 0x78, 0x69, 0x49, 0xCF, 0x1F, 0x33, 0xC2, 0x6A,
+    0xDE, 0xDA, 0x41, 0xEC, 0xD2, 0x1B, 0x63, 0x51, 0xEF, 0x24, 0x82, 0xF8, 0x29, 0x69, 0x39, 0x41,
+    0xE2, 0x23, 0x11, 0x95, 0xE8, 0x97, 0x9A, 0x41, 0x32, 0x79, 0x0B, 0x2D, 0xB4, 0xC3, 0xA2, 0x22,
+    0xC5, 0xCD, 0x01, 0xC0, 0xAD, 0x83, 0xEA, 0x37, 0xCF, 0x03, 0x25, 0x93, 0xE4, 0x21, 0xA3, 0x62,
+    0x5B, 0xC8, 0x7E, 0xD0, 0x5C, 0xC7, 0xD3, 0x4A, 0xB1, 0x8D, 0x08, 0xB1, 0x48, 0xB4, 0xB6, 0xD3,
+    0x8E, 0xE1, 0x62, 0x91, 0xC7, 0xF6, 0x98, 0x3E, 0xCD, 0x15, 0x63, 0x17, 0xB3, 0xD4, 0xAA, 0x15,
+    0xCA, 0x8C, 0x67, 0x6B, 0x6B, 0x06, 0xE7, 0xBB, 0x63, 0x2D, 0xCD, 0xF2, 0x30, 0x42, 0x9A, 0x9B,
+    0x0D, 0xC6, 0xBD, 0x91, 0xEE, 0x1E, 0xE5, 0x9D, 0xBD, 0xC2, 0xAE, 0x98, 0x0C, 0x3D, 0xC5, 0x0B,
+    0x0A, 0xCA, 0x26, 0x24, 0x2A, 0x21, 0x31, 0x09, 0x60, 0x3A, 0xC8, 0xF3, 0xAA, 0xC5, 0x7F, 0x5A,
+    0x6A, 0xC1, 0x0E, 0x32, 0x7A, 0xA1, 0xA3, 0x4C, 0xC0, 0x6B, 0x49, 0x35, 0x63, 0xB6, 0xBF, 0x24,
+    0xF2, 0xEC, 0x26, 0x95, 0xB0, 0xDB, 0x82, 0xD6, 0x93, 0xF0, 0x50, 0x0F, 0x84, 0x4E, 0xE0, 0xA4,
+    0x27, 0xA1, 0x96, 0x19, 0x3A, 0xCB, 0x68, 0xCC, 0xB3, 0x31, 0x0E, 0x19, 0xB6, 0x1D, 0x99, 0x0F,
+    0x87, 0x88, 0x80, 0x67, 0xEE, 0xAD, 0xC4, 0xA9, 0xB0, 0x67, 0x74, 0x95, 0xF6, 0x56, 0x5A, 0x44,
+    0x8F, 0x52, 0xEA, 0xBA, 0xAB, 0xBA, 0xEB, 0x30, 0xCB, 0x04, 0xB0, 0x1E, 0xF6, 0xCC, 0xDA, 0x64,
+    0x13, 0xD3, 0x7C, 0xFE, 0xCB, 0xEF, 0xA8, 0xD5, 0x93, 0x4C, 0x93, 0xEA, 0x72, 0x91, 0xC4, 0xC4,
+    0x26, 0x71, 0x4B, 0x51, 0xB4, 0x4E, 0xEA, 0x46, 0x9B, 0xFA, 0xD9, 0xF7, 0xD3, 0x96, 0x5C, 0x2B,
+    0x43, 0x14, 0x09, 0xA0, 0x50, 0xBC, 0x20, 0xB1, 0xAB, 0xE5, 0x92, 0xAF, 0x03, 0xD3, 0x72, 0x3B,
+    0x89, 0xC1, 0x5E, 0x4A, 0xE4, 0x28, 0x33, 0xA0, 0xFC, 0x49, 0x94, 0x73, 0x2B, 0xC9, 0xF2, 0xC7,
+    0x0A, 0xFF, 0x13, 0x98, 0xAF, 0xDF, 0x3D, 0x48, 0xE1, 0x2B, 0xF1, 0x3E, 0x9B, 0xD4, 0x41, 0x77,
+    0x24, 0x2A, 0x85, 0x22, 0x51, 0xAF, 0x72, 0x32, 0xAF, 0x28, 0x7F, 0xEA, 0x9A, 0x6D, 0xFD, 0xB3,
+    0x66, 0xB3, 0x00, 0x50, 0x3D, 0x75, 0x7B, 0x05, 0x24, 0xD9, 0x6E, 0x25, 0x50, 0xCA, 0x7C, 0xDE,
+    0x6A, 0x20, 0x2B, 0x37, 0x8B, 0x00, 0xF1, 0xF7, 0xB5, 0xDF, 0xAA, 0x20, 0x8B, 0x37, 0xCB, 0x20,
+    0xED, 0x23, 0xB2, 0x0E, 0x92, 0x7E, 0xDD, 0x5E, 0x08, 0xAF, 0x58, 0x7F, 0x03, 0xD5, 0x55, 0x3B,
+    0x8E, 0xD4, 0x40, 0x10, 0x6D, 0xDB, 0x1A, 0x2C, 0x31, 0x41, 0x47, 0x4B, 0xDA, 0x39, 0x48, 0xCC,
+    0x11, 0x6C, 0x89, 0x03, 0x40, 0xB0, 0xDC, 0x01, 0x22, 0x2E, 0x80, 0xF0, 0xA0, 0xBD, 0x08, 0x21,
+    0xF2, 0x06, 0x7B, 0x04, 0x1B, 0x11, 0x90, 0xFA, 0x08, 0x0E, 0x08, 0x80, 0xC8, 0x2B, 0x59, 0x62,
+    0x58, 0x6C, 0x17, 0xEF, 0xBD, 0x36, 0xA3, 0x5D, 0x21, 0x04, 0x11, 0x9F, 0x96, 0xBA, 0xDD, 0x9F,
+    0xEA, 0xAA, 0x57, 0xAF, 0xAA, 0xCB, 0xCE, 0x39, 0xB7, 0x2B, 0x31, 0xF8, 0x09, 0x43, 0xF2, 0xB9,
+    0xC5, 0x78, 0xFF, 0x39, 0x86, 0xD4, 0x38, 0x0D, 0x23, 0x06, 0xF7, 0xC4, 0xDD, 0x6C, 0xD5, 0x9E,
+    0x17, 0x0E, 0x47, 0xA9, 0x8A, 0x77, 0x3D, 0xA7, 0xE9, 0xC2, 0x69, 0xF5, 0xAC, 0xC3, 0xFA, 0x72,
+    0xC6, 0x7A, 0x0E, 0x3D, 0xD6, 0x2F, 0x17, 0xAC, 0x87, 0x30, 0xB8, 0x6C, 0x49, 0x0C, 0xEB, 0xD6,
+    0x0F, 0xCE, 0x2F, 0xB5, 0xB9, 0xCC, 0xCC, 0x46, 0x57, 0x61, 0x2C, 0x3D, 0x86, 0x03, 0xD7, 0xB6,
+    0xAF, 0x7A, 0xC0, 0x21, 0x20, 0x7B, 0x6B, 0xA5, 0x0B, 0x54, 0xE9, 0x36, 0xF5, 0xB9, 0x0D, 0x9C,
+    0x34, 0x14, 0xC6, 0x77, 0x8B, 0xAF, 0x4E, 0x70, 0xBB, 0x26, 0xA0, 0x3C, 0x2E, 0x9D, 0x2B, 0xA2,
+    0xA0, 0xCB, 0x66, 0xDB, 0xC7, 0x8D, 0x77, 0xB3, 0xBE, 0xE9, 0xBC, 0x33, 0x6D, 0x85, 0xBE, 0x31,
+    0x6E, 0x25, 0x06, 0x83, 0x14, 0xF6, 0x83, 0xB7, 0x2B, 0x9E, 0x58, 0x59, 0x75, 0x14, 0xF5, 0xCB,
+    0xB9, 0xAC, 0xD0, 0x9C, 0x2E, 0xD3, 0xDC, 0x55, 0xFD, 0x4A, 0xE6, 0xD0, 0x5A, 0x41, 0x47, 0x83,
+    0xF6, 0x01, 0x16, 0x61, 0x3B, 0xB3, 0x32, 0x35, 0xAA, 0xDB, 0x8D, 0xCE, 0x4B, 0xE4, 0x87, 0x76,
+    0xCB, 0xBE, 0x48, 0x53, 0xCF, 0xDB, 0x13, 0xCC, 0x53, 0xAA, 0xB2, 0xAF, 0xBC, 0x00, 0xEB, 0x99,
+    0xEE, 0x34, 0xC3, 0xF7, 0x70, 0xA4, 0x02, 0x5B, 0x8C, 0x72, 0xCE, 0x1D, 0x8F, 0x34, 0x8D, 0xB0,
+    0xAD, 0xBB, 0xD3, 0x39, 0x23, 0x44, 0xBF, 0xEA, 0x12, 0x10, 0x7A, 0x19, 0x40, 0x27, 0x62, 0x2B,
+    0xB2, 0x72, 0x61, 0x91, 0x1F, 0x3B, 0xDE, 0x4B, 0x3C, 0x7D, 0x2B, 0x38, 0xDD, 0x6A, 0xF7, 0xA9,
+    0xE0, 0xE5, 0x07, 0x49, 0xF4, 0xD2, 0x4F, 0xD3, 0xD9, 0xC2, 0x69, 0xF2, 0xE8, 0x47, 0x4F, 0xD2,
+    0xFA, 0x02, 0xE6, 0x0A, 0x46, 0x2F, 0x37, 0x83, 0x98, 0x82, 0xE0, 0xA5, 0xDC, 0x8E, 0x5A, 0x32,
+    0x29, 0xAF, 0x3E, 0x2D, 0xF2, 0xBA, 0xA3, 0xD4, 0x44, 0xD4, 0x50, 0x9E, 0x4A, 0xAA, 0xB8, 0x2E,
+    0x05, 0x76, 0xBD, 0x18, 0x15, 0x8B, 0x81, 0xD3, 0x48, 0x68, 0xA1, 0x5D, 0xC9, 0x2B, 0x14, 0xF4,
+    0x26, 0x39, 0x1C, 0xD7, 0xBE, 0x73, 0xBF, 0xD9, 0xFE, 0x12, 0x6A, 0xB6, 0x17, 0x42, 0x3E, 0xCA,
+    0x52, 0xAF, 0x24, 0x6D, 0x99, 0x76, 0x4D, 0xE9, 0xD2, 0x43, 0x8C, 0xCC, 0xB1, 0xDD, 0xAD, 0xD7,
+    0x20, 0x96, 0x8C, 0x27, 0xDE, 0x82, 0x5D, 0xBD, 0x86, 0x7A, 0x1E, 0x05, 0x42, 0x4D, 0x15, 0x95,
+    0x82, 0x5E, 0xE7, 0xCB, 0x45, 0xCF, 0x1C, 0x9D, 0x85, 0xAF, 0x25, 0x88, 0xC3, 0x1A, 0xE3, 0xEC,
+    0xBA, 0x54, 0x5D, 0xAF, 0xF8, 0x04, 0x35, 0x89, 0x69, 0xCA, 0x69, 0x66, 0xF1, 0x01, 0x24, 0xA7,
+    0x1B, 0x44, 0xB9, 0x78, 0x03, 0x2B, 0xF9, 0x44, 0x16, 0xEC, 0x0C, 0xF7, 0xC3, 0xA1, 0xE9, 0x20,
+    0xF2, 0x70, 0xFE, 0x87, 0xF8, 0xDC, 0x94, 0xD1, 0x2B, 0xF6, 0x6A, 0xED, 0x37, 0x5B, 0xE0, 0x2B,
+    0x6D, 0x45, 0x93, 0x07, 0xE1, 0x45, 0x2B, 0x30, 0x5B, 0x12, 0xD3, 0x89, 0xC7, 0x6C, 0x62, 0x09,
+    0x00, 0x6F, 0x65, 0x9C, 0x02, 0x6F, 0xD3, 0x8A, 0x30, 0xCA, 0x57, 0x7C, 0xDB, 0xF1, 0x05, 0xA2,
+    0x10, 0xF1, 0x0D, 0xDE, 0x8E, 0xFE, 0xB3, 0x2C, 0x42, 0x49, 0x06, 0xF1, 0x2D, 0x14, 0x85, 0xF6,
+    0x97, 0xF9, 0x96, 0x7F, 0x20, 0x9D, 0xD1, 0x36, 0x55, 0x93, 0x19, 0x5A, 0x23, 0x2D, 0xC4, 0x02,
+    0x68, 0xEA, 0x2C, 0xA8, 0x00, 0x43, 0x6C, 0x84, 0x4A, 0x56, 0x88, 0x86, 0x94, 0xF0, 0xBA, 0x5F,
+    0x7B, 0xA0, 0x0B, 0xE8, 0xF7, 0xC6, 0x55, 0xBF, 0x6F, 0xA3, 0xBE, 0x82, 0xB5, 0x12, 0xE5, 0x07,
+    0xD5, 0x36, 0x1F, 0xD2, 0xE9, 0x8F, 0x61, 0xC8, 0xC7, 0x5D, 0xEB, 0xEC, 0xC1, 0x04, 0x85, 0x4D,
+    0x9B, 0x19, 0xCE, 0x8B, 0x4B, 0xDB, 0x6F, 0x1E, 0x9F, 0x9C, 0xFE, 0x84, 0x0C, 0x92, 0x2B, 0x24,
+    0x8E, 0x65, 0x89, 0x50, 0x94, 0x27, 0xC4, 0x92, 0x92, 0x64, 0x02, 0xC9, 0xA6, 0xF5, 0x17, 0xA3,
+    0xD7, 0x62, 0x6B, 0xD6, 0x2B, 0x53, 0x98, 0x28, 0xCA, 0x13, 0xAA, 0x51, 0x89, 0x64, 0xCE, 0x13,
+    0x92, 0x4A, 0x65, 0xE4, 0x05, 0xD9, 0xF2, 0xDE, 0x29, 0x7D, 0x7A, 0xB7, 0x26, 0x4D, 0xD0, 0x62,
+    0x3B, 0x9D, 0x34, 0x13, 0x9D, 0x4A, 0xAD, 0xA4, 0x59, 0x64, 0x10, 0xC2, 0x0E, 0x2B, 0x50, 0x9B,
+    0x4E, 0x81, 0x59, 0x6C, 0x5B, 0xE6, 0x66, 0x71, 0xC6, 0x64, 0x06, 0x39, 0x2C, 0xA3, 0x03, 0xE5,
+    0x76, 0x74, 0x71, 0xD3, 0xCC, 0xFA, 0x0D, 0xC4, 0x57, 0x03, 0x07, 0xF4, 0xB3, 0xD2, 0x0F, 0x61,
+    0x2F, 0x43, 0x25, 0x33, 0xF7, 0xA3, 0xFB, 0x9F, 0xDA, 0x37, 0xD5, 0x54, 0x31, 0x6E, 0xD5, 0x40,
+    0x10, 0x1D, 0xDB, 0x12, 0x2E, 0x5C, 0x6C, 0x45, 0x5A, 0xDF, 0x20, 0x3E, 0x01, 0xAC, 0xA9, 0xB8,
+    0x40, 0xA8, 0x72, 0x88, 0xB4, 0x74, 0xB6, 0xC4, 0x01, 0xA0, 0xA7, 0xA7, 0xA5, 0xA1, 0x44, 0xB2,
+    0x3B, 0x0A, 0x1A, 0x57, 0xD4, 0xAB, 0x28, 0x0D, 0x55, 0x8C, 0xB0, 0x84, 0xA3, 0xD8, 0x7E, 0xBC,
+    0x59, 0x7F, 0xFB, 0xAF, 0xBE, 0x12, 0x09, 0x51, 0xC1, 0xEA, 0x67, 0x62, 0x7B, 0x67, 0x67, 0xDF,
+    0x9B, 0x79, 0x33, 0x22, 0x92, 0xB8, 0x4F, 0x42, 0xBB, 0x3C, 0xA7, 0x8D, 0xEF, 0x6F, 0x69, 0x65,
+    0x44, 0x4D, 0xFB, 0xCC, 0xA8, 0x7D, 0x70, 0x41, 0xC4, 0x3A, 0xB1, 0xAD, 0x14, 0xA3, 0xE4, 0x4E,
+    0x0C, 0xC4, 0xF4, 0x92, 0xA2, 0x4D, 0x26, 0x89, 0x31, 0xC4, 0x0B, 0x3D, 0x16, 0x75, 0xAA, 0xD0,
+    0xAA, 0x13, 0xFA, 0x82, 0x4E, 0xF7, 0x93, 0x19, 0x24, 0x9D, 0x9B, 0x97, 0x93, 0x24, 0x28, 0xAE,
+    0xD5, 0xE9, 0xCB, 0x84, 0x52, 0xAA, 0x1F, 0xA8, 0x5A, 0xB1, 0xA3, 0x05, 0x9D, 0x66, 0x83, 0x41,
+    0x32, 0x24, 0x50, 0xA7, 0xB6, 0x59, 0x24, 0x82, 0xCB, 0xE9, 0xD4, 0x0C, 0x0C, 0x2F, 0x76, 0x12,
+    0x3A, 0x1D, 0x10, 0x70, 0xF1, 0x56, 0xAE, 0x68, 0x7D, 0x29, 0xFC, 0x8B, 0xBC, 0x3A, 0x05, 0xFB,
+    0xC4, 0x1F, 0xC9, 0xC1, 0x28, 0x84, 0x82, 0x91, 0xD8, 0x97, 0xF7, 0x7C, 0xB1, 0xA3, 0x54, 0x4E,
+    0x19, 0x64, 0x93, 0xE4, 0x23, 0xA3, 0x94, 0x66, 0xE2, 0x5E, 0x97, 0xCE, 0x0C, 0x3C, 0xC4, 0x0C,
+    0x9A, 0xCC, 0xC2, 0x4C, 0x30, 0x3C, 0xF1, 0xF1, 0x4F, 0x2F, 0xB0, 0x8E, 0xDE, 0xDC, 0x4E, 0x08,
+    0x9F, 0xEE, 0xC4, 0x94, 0x2D, 0x8C, 0xF7, 0xE2, 0x8A, 0xA7, 0xC1, 0xD5, 0x26, 0x6A, 0x3B, 0x69,
+    0x68, 0x35, 0x31, 0x6A, 0xC5, 0x7F, 0x21, 0x8E, 0xA5, 0x0C, 0x71, 0xA5, 0x9D, 0xDA, 0xA4, 0x3F,
+    0xDA, 0x78, 0xF4, 0x74, 0x26, 0xF9, 0xD3, 0xF5, 0x8F, 0x52, 0xFB, 0xEC, 0xAD, 0xF5, 0xF2, 0x29,
+    0x3C, 0x9B, 0x82, 0xD1, 0x08, 0xF4, 0x7A, 0xD6, 0xA2, 0xB9, 0xCC, 0x9D, 0xF0, 0x88, 0x1A, 0x65,
+    0x9E, 0xFA, 0x58, 0x19, 0xA0, 0x00, 0xF0, 0x81, 0x2F, 0x66, 0x51, 0xF8, 0x84, 0x41, 0xC8, 0x29,
+    0xBF, 0x56, 0x5D, 0x02, 0x85, 0x48, 0x42, 0xCA, 0xA0, 0x61, 0x50, 0x94, 0x54, 0x22, 0x19, 0xE4,
+    0x64, 0x90, 0xF7, 0x9E, 0xC1, 0x78, 0x24, 0x48, 0x77, 0xDB, 0xF3, 0x74, 0x6D, 0xF0, 0xEE, 0x12,
+    0x9D, 0x67, 0xD0, 0x2B, 0x68, 0xAA, 0x8C, 0x09, 0x63, 0xC6, 0x12, 0xAC, 0x79, 0xD3, 0x2F, 0xC4,
+    0x81, 0x77, 0x21, 0x2C, 0x4F, 0x2A, 0x1D, 0x5E, 0x6B, 0x85, 0x70, 0xAE, 0x15, 0xFA, 0xA9, 0xA9,
+    0x96, 0x51, 0x6F, 0x96, 0x73, 0xD3, 0xFE, 0x1F, 0x3C, 0x9E, 0x96, 0x17, 0x5A, 0x03, 0xD7, 0x94,
+    0x7A, 0x29, 0x3B, 0x52, 0xD2, 0x49, 0x2B, 0x9E, 0x40, 0x65, 0x11, 0xE1, 0x2B, 0x1E, 0x96, 0xD7,
+    0xD5, 0xE2, 0xBB, 0x4B, 0x23, 0xC6, 0x0C, 0xAF, 0x30, 0xBE, 0x37, 0x03, 0x6D, 0x9D, 0x2A, 0x95,
+    0x9A, 0xC0, 0x23, 0xDA, 0x7C, 0x50, 0xB1, 0x10, 0x68, 0xD5, 0x29, 0x0F, 0xAF, 0xA5, 0xCE, 0x8C,
+    0xCA, 0x23, 0x9D, 0xF4, 0x2E, 0xCF, 0x63, 0x09, 0x68, 0xA2, 0xD5, 0x8B, 0x1B, 0x97, 0xE0, 0xE6,
+    0x8C, 0xD1, 0x95, 0xC7, 0xA4, 0xD0, 0x31, 0x6B, 0xDA, 0x34, 0x6F, 0x38, 0x64, 0x0F, 0xAA, 0x98,
+    0x2B, 0xDC, 0x9C, 0xCC, 0x9F, 0x37, 0x74, 0xBF, 0xED, 0xA9, 0xFC, 0x5A, 0xB3, 0xCA, 0xFF, 0x8C,
+    0x86, 0x36, 0x45, 0xE3, 0x8A, 0xC9, 0x8E, 0x81, 0xE7, 0x59, 0x30, 0xC3, 0xAA, 0xFE, 0xF8, 0x9C,
+    0x07, 0x4D, 0x96, 0x84, 0xF4, 0x11, 0xD4, 0xD4, 0x06, 0x07, 0xCC, 0x1C, 0x1E, 0x08, 0xD4, 0x8E,
+    0x2E, 0x38, 0x30, 0x3C, 0x76, 0xA0, 0xDE, 0x15, 0x72, 0x87, 0x4D, 0xFD, 0xD1, 0x5A, 0xB2, 0x75,
+    0x35, 0x9E, 0xF0, 0x21, 0xCC, 0xF2, 0x71, 0x87, 0x41, 0xE9, 0x60, 0xC3, 0xCA, 0x94, 0x17, 0xFB,
+    0x46, 0xE5, 0x32, 0x6C, 0x57, 0x18, 0xA6, 0x78, 0xC3, 0x41, 0x4D, 0x55, 0xBF, 0xB6, 0x8D, 0xA2,
+    0xCF, 0x67, 0x7B, 0xD8, 0x48, 0x96, 0x54, 0xF3, 0x76, 0x38, 0xDD, 0xC2, 0x55, 0x87, 0x50, 0xD9,
+    0x64, 0x27, 0xB3, 0x01, 0x69, 0xDE, 0x42, 0x36, 0x7A, 0x4C, 0x7F, 0xBB, 0xE7, 0x80, 0x32, 0xC8,
+    0x36, 0x84, 0x06, 0xCB, 0xE5, 0xCE, 0x7B, 0xAD, 0xDE, 0x7E, 0x02, 0x7B, 0x72, 0xB0, 0x8E, 0x88,
+    0x15, 0x48, 0xC0, 0x35, 0x03, 0x76, 0xE4, 0x31, 0xBE, 0xE1, 0x6E, 0x2F, 0x50, 0x90, 0xBE, 0x7C,
+    0x09, 0x26, 0x25, 0x8E, 0x55, 0x8C, 0x10, 0x0C, 0x8F, 0x2A, 0xA8, 0x62, 0x8E, 0xF0, 0x40, 0x1B,
+    0x1C, 0x08, 0xAA, 0x58, 0x05, 0x42, 0xCA, 0x03, 0x69, 0x44, 0x27, 0x7D, 0x7C, 0xE1, 0xB1, 0xAD,
+    0x10, 0x1A, 0xEF, 0x67, 0xFD, 0xB5, 0x66, 0x7C, 0x7C, 0x18, 0x73, 0xD2, 0x51, 0x55, 0x54, 0x1F,
+    0x1F, 0x98, 0x35, 0x9D, 0xC1, 0xBD, 0x3E, 0x34, 0x4E, 0x1F, 0x74, 0x70, 0x3A, 0x55, 0x97, 0xFE,
+    0x6A, 0x5A, 0xD6, 0x89, 0xCD, 0xC3, 0xD6, 0x88, 0x51, 0xB2, 0x39, 0x28, 0x42, 0x76, 0x10, 0x1F,
+    0xD8, 0x32, 0x1C, 0xD3, 0x1C, 0x00, 0xC6, 0xFF, 0x38, 0xC4, 0x0D, 0x6E, 0xD9, 0x24, 0xC6, 0xB7,
+    0xBC, 0xF1, 0x03, 0x57, 0x6D, 0xEB, 0xF3, 0xE8, 0x55, 0x34, 0xCA, 0xDF, 0xAE, 0xDF, 0xD5, 0x54,
+    0x31, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0x7B, 0x49, 0x5C, 0xB8, 0x58, 0x1A, 0x28, 0x48, 0xB1, 0x47,
+    0xD8, 0x13, 0xA0, 0x35, 0x0D, 0x0D, 0x4D, 0x8A, 0xA4, 0xA2, 0xA5, 0xE7, 0x02, 0x04, 0x1B, 0x51,
+    0xD0, 0xE6, 0x08, 0x14, 0xA1, 0xA2, 0xE0, 0x04, 0xC1, 0x2B, 0x4E, 0xE0, 0x70, 0x02, 0xB7, 0x40,
+    0xC1, 0x0A, 0xB9, 0xB0, 0x60, 0xED, 0xE5, 0xBD, 0x75, 0x80, 0x20, 0x40, 0x28, 0x12, 0x12, 0x60,
+    0x79, 0xE7, 0xEF, 0xB7, 0xD7, 0x33, 0xF3, 0xDE, 0x9B, 0x19, 0x11, 0x11, 0xDD, 0xC1, 0x88, 0xA3,
+    0x91, 0x53, 0x9A, 0x22, 0xD2, 0xAA, 0x20, 0x97, 0xBE, 0x6C, 0x14, 0x13, 0xC5, 0xCD, 0xDC, 0xB8,
+    0xC0, 0x4D, 0x1B, 0xB8, 0xE9, 0x47, 0x6E, 0xD2, 0xC0, 0x4D, 0xF2, 0xF9, 0xEE, 0x60, 0x8B, 0xD4,
+    0x14, 0xA9, 0x2B, 0x93, 0x94, 0xA9, 0x51, 0xAB, 0xA8, 0x24, 0x6A, 0x11, 0x6C, 0xAA, 0x28, 0xD5,
+    0x22, 0x75, 0x14, 0x9D, 0x6F, 0x3B, 0x8B, 0x4E, 0xEF, 0xD3, 0x04, 0x9B, 0x52, 0xC8, 0x76, 0xC8,
+    0xD6, 0x4B, 0x0D, 0x8B, 0x84, 0x53, 0x9A, 0x7F, 0x9E, 0x50, 0x39, 0x65, 0x28, 0x19, 0x50, 0x9D,
+    0x1A, 0xA6, 0x98, 0x46, 0xD8, 0xF6, 0x31, 0x1F, 0x2D, 0xD2, 0x36, 0xFF, 0x38, 0x8A, 0xB5, 0xC2,
+    0xB3, 0x72, 0xD5, 0xC0, 0xA1, 0x16, 0xDA, 0x6A, 0xB1, 0x10, 0x46, 0x47, 0xE4, 0x23, 0x3B, 0x07,
+    0xD7, 0xF6, 0xFF, 0x1F, 0x2D, 0x2C, 0xCD, 0x43, 0x1A, 0x72, 0xAF, 0xA8, 0x4C, 0x7D, 0xC9, 0x1A,
+    0x6B, 0x11, 0x25, 0xBA, 0x41, 0x4C, 0x70, 0xA3, 0xB8, 0x01, 0x4C, 0xA4, 0xCE, 0x06, 0x24, 0x6D,
+    0x26, 0x66, 0x38, 0x9B, 0x89, 0xCC, 0x8C, 0x52, 0x2F, 0x5B, 0x3E, 0xA0, 0x2B, 0x2D, 0x88, 0xC5,
+    0x94, 0x14, 0xD2, 0x05, 0x38, 0x4F, 0xD3, 0xF1, 0x6F, 0xC3, 0xB7, 0xB9, 0x2E, 0xD8, 0x04, 0x2B,
+    0x8C, 0x59, 0x36, 0xDE, 0x70, 0xDD, 0xC0, 0x5B, 0xDB, 0x6C, 0x6D, 0xE1, 0xF0, 0xDB, 0xE2, 0x55,
+    0x22, 0x51, 0x69, 0x2C, 0xA2, 0x0E, 0xE5, 0xA4, 0x26, 0x15, 0x2A, 0x2C, 0x1D, 0xAA, 0xB1, 0x1F,
+    0x10, 0xAB, 0xD3, 0x08, 0xA5, 0x51, 0x5D, 0xE6, 0xCD, 0x85, 0x4F, 0xB1, 0x5E, 0x7E, 0x4D, 0xFF,
+    0xFA, 0x89, 0xE4, 0x13, 0x55, 0xF6, 0x74, 0x0B, 0x6C, 0x7A, 0xED, 0xD5, 0x8C, 0xD4, 0x5B, 0x95,
+    0x7C, 0x1D, 0xD2, 0x53, 0x59, 0x8D, 0x17, 0xF3, 0x7A, 0x92, 0x32, 0xC2, 0x85, 0x7B, 0x05, 0x21,
+    0x66, 0x0D, 0xE5, 0x9A, 0x76, 0xD0, 0x53, 0x91, 0x24, 0x89, 0x0E, 0x66, 0xB9, 0xBD, 0x96, 0x64,
+    0xDC, 0x81, 0x6A, 0xB8, 0x5A, 0xA5, 0xC7, 0xDA, 0x39, 0xC8, 0xAD, 0x8B, 0x7A, 0x28, 0x89, 0x82,
+    0xE8, 0x40, 0x84, 0x98, 0xEF, 0xC5, 0xD8, 0x5D, 0xD8, 0x01, 0xFC, 0x62, 0x41, 0x69, 0x2D, 0x6A,
+    0x2E, 0x63, 0x15, 0xCA, 0x58, 0x0F, 0x65, 0xD4, 0xBE, 0x9C, 0x4D, 0xA3, 0x66, 0x0B, 0x69, 0x1C,
+    0xC2, 0xB8, 0xB7, 0x29, 0x20, 0x42, 0xB0, 0x58, 0x10, 0x78, 0xCC, 0xAC, 0xC1, 0x21, 0x1C, 0x6B,
+    0xBF, 0xAD, 0x1A, 0x01, 0xAA, 0xDF, 0x49, 0xC8, 0x90, 0xA4, 0x07, 0x6B, 0x50, 0x50, 0x88, 0x31,
+    0x31, 0x61, 0x7A, 0xCC, 0x1A, 0xEB, 0x1D, 0x7C, 0x30, 0x68, 0xED, 0x65, 0xC1, 0xC0, 0x01, 0xC0,
+    0xE7, 0x19, 0x57, 0xC0, 0xE9, 0x28, 0xC4, 0x56, 0xAF, 0x5F, 0x1C, 0x51, 0x17, 0x87, 0xA8, 0x2E,
+    0x63, 0x40, 0x11, 0x9C, 0xAD, 0xA2, 0x87, 0x0B, 0xF1, 0x8B, 0xBE, 0x81, 0xB6, 0xCC, 0x14, 0xF5,
+    0x09, 0x74, 0x02, 0x9C, 0xD2, 0x22, 0x8A, 0x6D, 0xEA, 0x40, 0x78, 0xD5, 0x20, 0x6B, 0x89, 0x26,
+    0x68, 0xD0, 0x11, 0x9E, 0xF8, 0x80, 0x2B, 0x92, 0x4A, 0x41, 0xC8, 0xEE, 0x1C, 0xA0, 0xAD, 0x3A,
+    0x71, 0x1F, 0x20, 0x63, 0x8F, 0x62, 0x7A, 0x32, 0x4B, 0x71, 0x7C, 0xEF, 0x1B, 0x98, 0x7A, 0xDA,
+    0xF8, 0x03, 0x29, 0x8D, 0x1E, 0x21, 0xCA, 0x58, 0x07, 0x12, 0x88, 0x39, 0xD3, 0x23, 0x41, 0xDB,
+    0x1D, 0x89, 0x1E, 0xC9, 0x20, 0x74, 0x8D, 0x6A, 0x7D, 0x01, 0x40, 0x10, 0x8A, 0x14, 0x2A, 0xF6,
+    0x85, 0xCD, 0x6A, 0x1C, 0x42, 0xA5, 0x7A, 0xB6, 0x03, 0x2A, 0x38, 0xA1, 0x5F, 0xEE, 0xC4, 0xAD,
+    0x9D, 0xDB, 0x0F, 0x2C, 0xCE, 0x1F, 0xAF, 0xFB, 0xC3, 0x46, 0x60, 0x16, 0x8D, 0x0C, 0x8A, 0xEB,
+    0xAC, 0xCF, 0x14, 0x52, 0x37, 0x21, 0x87, 0x05, 0x1F, 0x92, 0x44, 0xA1, 0x74, 0x99, 0x45, 0x45,
+    0x5C, 0x99, 0x46, 0xAA, 0x77, 0x81, 0xC7, 0x3C, 0x14, 0xD1, 0xCA, 0x62, 0x1E, 0x6C, 0xD5, 0x0E,
+    0x8F, 0xB2, 0xDB, 0xFD, 0xE1, 0x3A, 0x39, 0x4F, 0xBD, 0xE8, 0x3B, 0x92, 0xB5, 0xA5, 0x92, 0xDE,
+    0x45, 0x78, 0x83, 0xB8, 0x1E, 0x08, 0xE2, 0xCE, 0x29, 0x5C, 0x72, 0x7E, 0x9C, 0xF2, 0xC4, 0x02,
+    0xBF, 0xF8, 0x73, 0x06, 0x20, 0x1F, 0x9F, 0x35, 0x36, 0xCF, 0x6C, 0x56, 0x84, 0x97, 0xAB, 0x88,
+    0x90, 0x8E, 0x0D, 0xF1, 0x6C, 0x61, 0xE8, 0x2D, 0x5B, 0xC6, 0xAA, 0xD2, 0xF1, 0x16, 0x6B, 0x6F,
+    0x11, 0x93, 0x42, 0x85, 0xA4, 0xD3, 0xF1, 0x3E, 0xEA, 0xA4, 0x02, 0xAA, 0x1E, 0x40, 0x47, 0x29,
+    0x00, 0xC6, 0x0C, 0x98, 0xA2, 0x85, 0x98, 0x8F, 0x33, 0x3E, 0x1D, 0xD0, 0x35, 0xB2, 0x87, 0x3C,
+    0x6F, 0x4A, 0x3E, 0x86, 0x20, 0x57, 0x1E, 0x40, 0x09, 0x2F, 0x98, 0x28, 0xE5, 0x09, 0xBD, 0xE5,
+    0x99, 0x10, 0x38, 0xCE, 0x58, 0x12, 0xAC, 0xB1, 0xC3, 0x5F, 0xD4, 0xF7, 0x1E, 0x34, 0x75, 0xF8,
+    0xD4, 0x7D, 0x62, 0x55, 0x99, 0xC6, 0xFA, 0xBB, 0x23, 0x78, 0x98, 0x81, 0x77, 0x65, 0xCE, 0x8F,
+    0xD2, 0xDB, 0x43, 0x26, 0x22, 0x96, 0x3A, 0xAE, 0xCD, 0x51, 0x71, 0x5E, 0x70, 0x54, 0x68, 0x94,
+    0xBD, 0xB5, 0x91, 0xBF, 0x77, 0x7D, 0x06, 0xB5, 0x54, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0x7B,
+    0x95, 0x73, 0xE1, 0x62, 0x69, 0x22, 0x81, 0x28, 0xF6, 0x1F, 0xE0, 0x96, 0x22, 0xD2, 0x1A, 0xA5,
+    0xA4, 0x49, 0x11, 0x2A, 0x0A, 0x7E, 0x42, 0x5A, 0x9A, 0x60, 0x53, 0xD1, 0xD2, 0x53, 0xF3, 0x23,
+    0x90, 0x10, 0xEB, 0x8E, 0x82, 0xC6, 0xE2, 0x17, 0x58, 0x94, 0x50, 0xC4, 0x41, 0x2E, 0x1C, 0x65,
+    0xED, 0xE1, 0xCD, 0xEC, 0x9D, 0x08, 0x10, 0x04, 0xE2, 0x63, 0x75, 0x3E, 0xFB, 0x7C, 0xB3, 0xF3,
+    0xDE, 0xBC, 0x37, 0xB3, 0x44, 0x69, 0xBD, 0xC6, 0xE5, 0x5A, 0x22, 0x33, 0xE2, 0x61, 0xC1, 0x55,
+    0x75, 0xF4, 0xDB, 0xEB, 0xF6, 0x4C, 0x64, 0x79, 0x24, 0xC3, 0xA1, 0x23, 0xA6, 0x53, 0x6C, 0x7E,
+    0x38, 0x18, 0xE6, 0x95, 0x02, 0xF3, 0x60, 0xF1, 0x90, 0xF1, 0xC7, 0x07, 0x9A, 0x32, 0xD7, 0xDC,
+    0x17, 0xD9, 0x94, 0x31, 0x33, 0x36, 0x61, 0x97, 0x47, 0x1C, 0x9D, 0x5C, 0xEC, 0x58, 0xD8, 0x01,
+    0x2C, 0x18, 0x54, 0x02, 0x83, 0xD2, 0x87, 0x85, 0xCC, 0x94, 0xCF, 0xFF, 0x1D, 0x79, 0xBF, 0x3E,
+    0x06, 0xE2, 0x21, 0x62, 0xF8, 0x30, 0x52, 0xC6, 0x65, 0x44, 0x4E, 0x1B, 0xA9, 0xE0, 0x6A, 0xFE,
+    0x45, 0xF5, 0x59, 0x68, 0x13, 0x09, 0xF2, 0x97, 0x91, 0x94, 0x45, 0x1E, 0xF7, 0xDE, 0x90, 0xD2,
+    0x28, 0xE5, 0x4B, 0x78, 0x90, 0x5B, 0x5F, 0x1E, 0x25, 0x55, 0xAB, 0x7E, 0xCB, 0x84, 0x9C, 0xB0,
+    0x50, 0x2A, 0x08, 0x1E, 0x12, 0x97, 0x72, 0x22, 0xAB, 0x1F, 0x37, 0x53, 0x76, 0x94, 0x20, 0xEE,
+    0xD4, 0xF0, 0x04, 0xD6, 0xB8, 0x8E, 0x90, 0x17, 0xFF, 0x76, 0xD4, 0x10, 0x54, 0x81, 0x56, 0x4D,
+    0x9D, 0x47, 0xB2, 0xA8, 0xA5, 0xCB, 0x99, 0x36, 0x3B, 0xAE, 0xB6, 0x95, 0x98, 0xB2, 0xA7, 0x62,
+    0x4C, 0x96, 0xFE, 0xB8, 0x5E, 0x81, 0x6F, 0x2D, 0x51, 0x08, 0x11, 0x81, 0x51, 0xBA, 0x27, 0x41,
+    0x28, 0x07, 0x32, 0x80, 0xC6, 0xEF, 0x80, 0x57, 0x9D, 0x24, 0x87, 0x1A, 0xD9, 0x1B, 0xEC, 0x39,
+    0x25, 0xF9, 0x95, 0x71, 0x0F, 0xE9, 0x5A, 0x7B, 0xBE, 0xE6, 0x31, 0x8B, 0xBB, 0x7C, 0xE5, 0x73,
+    0xCD, 0x81, 0x84, 0xF2, 0xAE, 0x6A, 0x85, 0xA7, 0x64, 0x44, 0x7A, 0x90, 0x16, 0xAA, 0x92, 0x12,
+    0x02, 0x98, 0xA8, 0x69, 0x91, 0x93, 0x4E, 0x5A, 0xCA, 0xA7, 0xEA, 0xDE, 0xE2, 0x7A, 0xB6, 0xA3,
+    0x7F, 0x1B, 0xAB, 0xCF, 0xFC, 0x97, 0x0C, 0x77, 0xEB, 0x89, 0x7C, 0x19, 0xCD, 0x56, 0x2D, 0xFA,
+    0x0C, 0x36, 0x60, 0x2D, 0x36, 0xC1, 0xFF, 0x1A, 0xC6, 0x32, 0x08, 0xDC, 0xB0, 0xF0, 0xA2, 0x89,
+    0x48, 0x5B, 0xF2, 0x3A, 0xEB, 0x5F, 0x48, 0xBF, 0x94, 0x2C, 0x79, 0xE1, 0x01, 0x9A, 0x46, 0xF3,
+    0x0B, 0x96, 0xEF, 0x9C, 0x6C, 0xFE, 0xC4, 0x92, 0x98, 0x67, 0xD9, 0x22, 0x6D, 0x5A, 0xCA, 0x23,
+    0x15, 0xEB, 0xB6, 0x19, 0xA6, 0x03, 0xFC, 0x88, 0x07, 0xD2, 0x11, 0xC8, 0xEF, 0x90, 0x83, 0x5C,
+    0x31, 0x5C, 0xEB, 0x80, 0x7B, 0x81, 0x9D, 0x15, 0xB3, 0xF2, 0xAA, 0xA9, 0x99, 0x9A, 0x96, 0x42,
+    0x8B, 0x29, 0x64, 0xC8, 0x07, 0x44, 0xDF, 0xC2, 0xDA, 0xA6, 0x86, 0x5E, 0x81, 0x8A, 0x19, 0x6F,
+    0xCB, 0x39, 0x43, 0xE7, 0x4E, 0x39, 0x9A, 0x69, 0x34, 0x0B, 0x55, 0x63, 0x81, 0xA0, 0x51, 0x84,
+    0x14, 0x4D, 0x85, 0x29, 0x15, 0x52, 0x6C, 0x40, 0x51, 0xD9, 0xF1, 0x57, 0xA0, 0xCD, 0x0A, 0x19,
+    0x41, 0x13, 0xED, 0x56, 0xDB, 0xD9, 0x8D, 0x48, 0x11, 0x21, 0x60, 0x40, 0xFA, 0xAA, 0x43, 0x7B,
+    0x8E, 0xBE, 0x2D, 0x66, 0xD7, 0x9B, 0x58, 0xC4, 0x82, 0x65, 0x3C, 0x6A, 0x10, 0x6A, 0xAD, 0x68,
+    0x21, 0x25, 0x96, 0xA9, 0x36, 0x57, 0xAB, 0xBB, 0xD2, 0x55, 0xE2, 0x80, 0x1A, 0xFB, 0xD3, 0xF5,
+    0x2F, 0x20, 0x73, 0x01, 0x10, 0x0B, 0x03, 0x1E, 0x1A, 0x28, 0xE4, 0x9F, 0xCD, 0x10, 0x05, 0xAD,
+    0xF5, 0x75, 0xF4, 0x9E, 0xC3, 0x8B, 0x55, 0xCC, 0xEC, 0xCD, 0x5A, 0x44, 0x88, 0x12, 0x68, 0x05,
+    0x42, 0xA0, 0x12, 0x08, 0x26, 0xDA, 0x21, 0x5B, 0x8B, 0x89, 0x80, 0x90, 0x71, 0xD7, 0x20, 0x0A,
+    0x08, 0x72, 0x3E, 0xC8, 0xEC, 0x0F, 0x94, 0x8B, 0x7F, 0xB4, 0x27, 0xF6, 0xCD, 0x8F, 0x01, 0xF5,
+    0xAE, 0x23, 0xE7, 0x27, 0x32, 0xE7, 0x00, 0xBD, 0xB5, 0xA9, 0xE9, 0x1B, 0x1C, 0xE5, 0xD5, 0xF0,
+    0x42, 0x52, 0x8E, 0x02, 0xF9, 0xB6, 0x1C, 0xCB, 0x51, 0x11, 0xED, 0x28, 0x48, 0xE2, 0x19, 0x9A,
+    0xC4, 0x45, 0x2D, 0x48, 0xA0, 0x48, 0xBA, 0x4C, 0x18, 0x6E, 0x45, 0x7C, 0x80, 0x89, 0x2E, 0x66,
+    0x1C, 0x00, 0xBE, 0xE7, 0x3A, 0xE3, 0xFB, 0x18, 0xDD, 0xE8, 0x41, 0xE6, 0x9C, 0xBB, 0x6B, 0x04,
+    0x54, 0x48, 0x51, 0x90, 0xF8, 0xA9, 0x1A, 0x1F, 0x15, 0x53, 0x35, 0xC4, 0x3C, 0x31, 0x89, 0x88,
+    0x0A, 0x2A, 0x2A, 0x4A, 0xE4, 0x24, 0xAD, 0xD4, 0x2A, 0xAA, 0x6E, 0xA6, 0xA0, 0xAD, 0xB7, 0x57,
+    0x6F, 0x95, 0x2C, 0xB4, 0x4F, 0x54, 0xD7, 0x6E, 0xC7, 0x49, 0xD7, 0xFE, 0x71, 0x0E, 0xCE, 0x23,
+    0xBA, 0x91, 0xDF, 0xB3, 0x0E, 0x88, 0xEE, 0x3B, 0xDA, 0xB6, 0x55, 0x2E, 0x9B, 0xAD, 0x34, 0x7A,
+    0xA3, 0xC7, 0x73, 0xFD, 0x1D, 0xDB, 0x9B, 0x49, 0xA6, 0x74, 0xFC, 0x6C, 0x1B, 0xC3, 0xA6, 0xAE,
+    0x77, 0xA9, 0x32, 0x9F, 0xB6, 0x84, 0x14, 0xAF, 0x23, 0x89, 0x63, 0x32, 0xC5, 0x4F, 0xD7, 0xC5,
+    0xB7, 0x57, 0xE2, 0x4F, 0xD6, 0x34, 0xCE, 0x7A, 0xB3, 0x89, 0x9D, 0x3F, 0x53, 0xF7, 0xF8, 0x91,
+    0x4A, 0xB7, 0xFA, 0x33, 0xA1, 0x19, 0x9B, 0x13, 0xDC, 0xCC, 0xCC, 0x42, 0xDA, 0x5C, 0x2C, 0x98,
+    0x28, 0x2A, 0x2E, 0xA3, 0x96, 0xCE, 0x97, 0xE9, 0xC6, 0x0B, 0xED, 0x26, 0x18, 0x75, 0xB1, 0x92,
+    0x55, 0xAD, 0x70, 0xB0, 0x69, 0x01, 0x66, 0x4B, 0x2B, 0x55, 0x63, 0x53, 0x35, 0x55, 0x62, 0xE7,
+    0x13, 0xBB, 0x90, 0xAA, 0x49, 0xA7, 0x95, 0x49, 0xD5, 0x14, 0xF1, 0x6A, 0x19, 0x55, 0x8A, 0xB8,
+    0x9B, 0xEA, 0xDD, 0xE9, 0x25, 0x46, 0xE0, 0x80, 0x4F, 0x5B, 0x04, 0xB3, 0xF9, 0xE6, 0x68, 0x80,
+    0x72, 0x01, 0xA3, 0xB5, 0xDA, 0x3E, 0x5B, 0x6C, 0x9F, 0x47, 0xDB, 0x99, 0xE8, 0x3A, 0x33, 0x57,
+    0x5D, 0x39, 0x57, 0xAD, 0x9D, 0x7C, 0xED, 0x46, 0x5F, 0xFB, 0xD1, 0xF7, 0x61, 0x80, 0xD1, 0x3D,
+    0xAE, 0x4E, 0x2E, 0xD8, 0xD6, 0x6E, 0x56, 0xFA, 0x83, 0xF5, 0x05, 0xC5, 0x54, 0x3D, 0x6E, 0xDE,
+    0x46, 0x10, 0x1D, 0x72, 0x21, 0xB1, 0x60, 0xB1, 0x69, 0xEC, 0x46, 0x05, 0x8F, 0xC0, 0x1B, 0x78,
+    0x69, 0xB8, 0x48, 0x91, 0xC6, 0x85, 0xDD, 0xC4, 0x87, 0xC8, 0x09, 0x04, 0x7E, 0x86, 0x0F, 0x90,
+    0x4B, 0x28, 0x45, 0xD4, 0xF8, 0x06, 0xDE, 0xED, 0x5C, 0x86, 0xB9, 0x01, 0x03, 0xC4, 0x8D, 0x5C,
+    0x98, 0x06, 0x88, 0x80, 0x82, 0x48, 0x8E, 0xDF, 0x1B, 0xF2, 0x93, 0x90, 0xD8, 0x72, 0x1A, 0x03,
+    0x26, 0xBE, 0x6F, 0xC1, 0x9F, 0xDD, 0x99, 0xF7, 0xDE, 0xBC, 0x19, 0x11, 0xBB, 0xCE, 0xF1, 0x9F,
+    0x44, 0xDC, 0x20, 0x52, 0x76, 0x22, 0x75, 0x92, 0x7B, 0xAE, 0x62, 0x90, 0x58, 0xF6, 0xB2, 0xFA,
+    0x2E, 0x5B, 0x7C, 0x97, 0xCF, 0x3E, 0xB9, 0xB9, 0x4A, 0x6E, 0xAA, 0x53, 0x39, 0xD5, 0x07, 0x3F,
+    0x86, 0xA6, 0x1A, 0x42, 0x13, 0x86, 0xD0, 0xC5, 0x3E, 0xA8, 0x76, 0xF8, 0x27, 0xFE, 0x6B, 0xD5,
+    0xC3, 0xE9, 0x8A, 0x00, 0x25, 0x42, 0x7B, 0xA4, 0xA9, 0x67, 0x91, 0x56, 0x1B, 0x59, 0xEB, 0xCE,
+    0x4D, 0xF9, 0xF4, 0xCD, 0xE2, 0x17, 0x53, 0xD5, 0x49, 0x7C, 0xB2, 0x88, 0x1F, 0xDB, 0x94, 0xAB,
+    0x9F, 0x25, 0x7C, 0xD4, 0x94, 0x3D, 0x7F, 0xF0, 0xEC, 0xDF, 0x44, 0x5A, 0x29, 0x07, 0x26, 0x92,
+    0x45, 0xAA, 0x8E, 0x99, 0x04, 0x3B, 0x13, 0x53, 0xE1, 0x36, 0x1E, 0x98, 0xCB, 0x8D, 0x99, 0x0A,
+    0x93, 0xB9, 0xA5, 0x5C, 0x85, 0xD9, 0x9C, 0xEA, 0xCC, 0x1B, 0x04, 0xD6, 0x49, 0x2C, 0x1F, 0xAF,
+    0x47, 0x5C, 0x02, 0x97, 0xBA, 0xC1, 0x52, 0x1D, 0xB0, 0xF8, 0x7B, 0x25, 0xFC, 0xFA, 0xA5, 0xE2,
+    0x08, 0x04, 0x20, 0xFC, 0x08, 0x74, 0xF9, 0x2A, 0x11, 0x60, 0x53, 0xDB, 0xE0, 0x39, 0x24, 0x71,
+    0x2B, 0xE8, 0x49, 0xFC, 0xA3, 0x47, 0x1A, 0x85, 0x8C, 0x4E, 0x29, 0x1D, 0x50, 0x21, 0xF7, 0x42,
+    0xFA, 0xBA, 0x05, 0xC1, 0x15, 0x09, 0x23, 0x02, 0xC6, 0x43, 0xC5, 0x91, 0xA0, 0x38, 0xE2, 0x79,
+    0xA4, 0xE0, 0x5D, 0xAE, 0xFC, 0x2A, 0x6E, 0x14, 0xC9, 0x78, 0x38, 0x92, 0x01, 0x5E, 0xF9, 0xBF,
+    0xB9, 0xA1, 0xC3, 0x77, 0x90, 0x03, 0x63, 0x09, 0x3F, 0xCE, 0x52, 0x25, 0xAA, 0xE5, 0x51, 0x28,
+    0x37, 0x64, 0x0B, 0xF5, 0x81, 0x6A, 0x21, 0xA9, 0xF8, 0xBF, 0x54, 0x8A, 0x1B, 0x6D, 0x20, 0x47,
+    0x23, 0x3C, 0x11, 0xAE, 0x81, 0x0B, 0xD9, 0x4A, 0x42, 0x63, 0x5C, 0x4A, 0x04, 0xEC, 0x47, 0x47,
+    0xB9, 0xA9, 0x42, 0xF2, 0xF8, 0x0A, 0x50, 0x51, 0x1F, 0xA6, 0xF9, 0x09, 0xBB, 0xC2, 0xA0, 0x49,
+    0xB2, 0xE7, 0x27, 0xCF, 0xFE, 0x5F, 0x1E, 0x48, 0x60, 0x0A, 0x21, 0x5E, 0x00, 0x9E, 0x5D, 0x9F,
+    0x6A, 0x60, 0x52, 0x7D, 0x82, 0x58, 0x7E, 0x62, 0x3A, 0x13, 0xA8, 0x30, 0x59, 0x02, 0x99, 0x3A,
+    0x12, 0xDF, 0x14, 0xCA, 0x94, 0x50, 0x68, 0x41, 0x1E, 0xDE, 0x25, 0x3A, 0x89, 0x23, 0x37, 0xAD,
+    0xB6, 0x3F, 0xED, 0x1A, 0x49, 0xEC, 0xF7, 0xAC, 0x27, 0x97, 0xE0, 0x07, 0xF5, 0x28, 0x64, 0xC9,
+    0xD2, 0xCB, 0xE9, 0xE5, 0x6F, 0x5F, 0x45, 0x5B, 0x98, 0xA3, 0x9D, 0x25, 0xC8, 0x2D, 0x63, 0x66,
+    0x10, 0xB6, 0x52, 0x49, 0x8C, 0xE6, 0xC1, 0x5F, 0x3A, 0x26, 0x7C, 0x3B, 0x12, 0xDB, 0x9F, 0xDC,
+    0x5B, 0xF5, 0x2D, 0x8B, 0x30, 0x54, 0x03, 0x99, 0x14, 0xD8, 0x8B, 0xBF, 0x12, 0xDA, 0x25, 0x60,
+    0xC2, 0x7E, 0x3A, 0x22, 0x90, 0xEA, 0xC2, 0xE2, 0xC0, 0xF2, 0xB6, 0xF6, 0xD2, 0xF6, 0x42, 0xA3,
+    0x0F, 0xD8, 0x21, 0x61, 0xDC, 0x29, 0x9E, 0xFC, 0x7C, 0xB1, 0x41, 0x8E, 0xD8, 0x58, 0xE8, 0xD5,
+    0xEF, 0xF7, 0x82, 0x3D, 0x1B, 0x09, 0x12, 0x71, 0x6A, 0xD6, 0x71, 0x2D, 0xD0, 0x3C, 0x3D, 0x2A,
+    0xD8, 0x42, 0xE5, 0x7C, 0x84, 0xBE, 0x3E, 0xA1, 0x41, 0xCF, 0xF1, 0x32, 0x1F, 0xD0, 0x0F, 0x6C,
+    0x49, 0x09, 0x57, 0xA0, 0xA3, 0x5B, 0x27, 0x28, 0x81, 0x4D, 0x47, 0x4B, 0x1D, 0xAF, 0xD9, 0x7C,
+    0xE5, 0xD5, 0xDE, 0xAA, 0x91, 0x2F, 0xCC, 0xAC, 0x72, 0x7A, 0x71, 0x1F, 0x90, 0xD6, 0x22, 0xF8,
+    0xE9, 0x4E, 0x35, 0x69, 0x4D, 0x2F, 0x6F, 0x0F, 0xF9, 0x3A, 0xDF, 0xC9, 0xE6, 0x3F, 0xB2, 0x9A,
+    0xF9, 0x42, 0x43, 0x49, 0xFB, 0x72, 0x95, 0xA3, 0x6E, 0x6E, 0xCD, 0xE8, 0xFF, 0x36, 0xB1, 0xC6,
+    0x7E, 0xBD, 0x34, 0xF9, 0x28, 0x1C, 0xE6, 0x0D, 0xF9, 0x01, 0x12, 0x70, 0xB8, 0x4D, 0xBF, 0x4D,
+    0x39, 0xFC, 0x44, 0x93, 0xC3, 0xC7, 0x6A, 0xB6, 0x49, 0x38, 0x43, 0xC3, 0xD7, 0xF3, 0x8E, 0x3B,
+    0x32, 0xF9, 0xD9, 0xF2, 0x65, 0xC8, 0xA7, 0x7C, 0x5F, 0xD3, 0x39, 0x91, 0x55, 0xA1, 0x78, 0x36,
+    0x42, 0x8A, 0x01, 0x4B, 0xC9, 0xB9, 0x62, 0xEA, 0x55, 0x0D, 0xCC, 0x5A, 0xB3, 0xDF, 0x02, 0xBD,
+    0x67, 0xF2, 0x05, 0x46, 0xAF, 0xB9, 0x78, 0x8A, 0x7F, 0xD4, 0x6F, 0xB3, 0x8E, 0x3D, 0x70, 0x48,
+    0x42, 0xB5, 0x74, 0xDB, 0xE2, 0x1F, 0xE8, 0xCD, 0x7F, 0x98, 0x52, 0xE9, 0x78, 0x33, 0x4D, 0x61,
+    0x3D, 0xA5, 0x24, 0x1D, 0x7A, 0x08, 0xB0, 0x39, 0x46, 0xAF, 0x5E, 0x5B, 0x06, 0x6D, 0x0A, 0x23,
+    0x6F, 0x74, 0xF9, 0x3C, 0x15, 0xEC, 0xEC, 0x84, 0xA0, 0x7E, 0xBE, 0xF5, 0x8A, 0x89, 0x58, 0xD0,
+    0x87, 0xF2, 0xE6, 0xA9, 0xE9, 0xCD, 0x41, 0xD6, 0x9A, 0x63, 0xE3, 0x7F, 0xD8, 0x92, 0x2C, 0xB9,
+    0x82, 0x2A, 0x99, 0x92, 0x68, 0x69, 0x93, 0x3A, 0x9F, 0xC8, 0x92, 0x24, 0xC9, 0x91, 0x14, 0xC9,
+    0x90, 0x04, 0xC1, 0x6F, 0xC8, 0xF5, 0x57, 0x84, 0x0B, 0xDD, 0x16, 0x70, 0xDE, 0x1B, 0x82, 0x7D,
+    0xD6, 0x32, 0x79, 0x73, 0xD7, 0x3A, 0x9D, 0x6C, 0x1B, 0xF6, 0x99, 0x5A, 0xF2, 0xB3, 0x99, 0xE9,
+    0x73, 0xF1, 0xF5, 0xDA, 0x1A, 0xB2, 0x17, 0x9B, 0xCC, 0xEC, 0x8C, 0x84, 0x2A, 0xDF, 0x8C, 0x1B,
+    0x01, 0x67, 0xDC, 0x22, 0x59, 0xB0, 0xC2, 0xBB, 0xC2, 0x61, 0xB8, 0x9D, 0x93, 0xD6, 0xE0, 0x7E,
+    0x1B, 0x99, 0xB6, 0x4B, 0xDF, 0xBD, 0xE8, 0xC4, 0xFA, 0xAB, 0xDC, 0x63, 0x21, 0xAC, 0x33, 0xA7,
+    0x78, 0xEB, 0x7B, 0xEB, 0x10, 0xC0, 0x81, 0x54, 0xFE, 0x60, 0x28, 0x09, 0xAF, 0xDD, 0xFB, 0x68,
+    0xB1, 0x99, 0xD3, 0x6A, 0xEF, 0xD6, 0xC7, 0x0D, 0x46, 0x55, 0xB6, 0x6C, 0xA3, 0x10, 0x93, 0xD5,
+    0x6E, 0x71, 0xAA, 0xEE, 0x7F, 0x90, 0xF6, 0x7D, 0xCF, 0xD9, 0x9A, 0x31, 0x43, 0x9C, 0xE4, 0x7B,
+    0x5E, 0x9F, 0x00, 0xCD, 0x94, 0x31, 0x6E, 0xD4, 0x50, 0x10, 0x86, 0xC7, 0x6B, 0x05, 0x4B, 0x71,
+    0xB1, 0x34, 0xA9, 0x28, 0x7C, 0x04, 0x9F, 0x00, 0x79, 0x6F, 0xC0, 0x16, 0x49, 0x9A, 0x1C, 0x81,
+    0x22, 0x27, 0x40, 0x5E, 0x89, 0x03, 0xB0, 0x35, 0x15, 0x45, 0x90, 0x48, 0x52, 0x70, 0x02, 0xB0,
+    0x7B, 0x1A, 0x1F, 0x61, 0x8B, 0x50, 0x00, 0xCD, 0x93, 0x70, 0xE1, 0x4D, 0x6C, 0x0F, 0xF3, 0xFF,
+    0xE3, 0x6C, 0x22, 0x14, 0x22, 0x0A, 0x0A, 0x5E, 0x31, 0xDA, 0x7D, 0x7E, 0x6F, 0xE6, 0x7F, 0xDF,
+    0xFB, 0xE7, 0x89, 0x48, 0xB6, 0x10, 0x1B, 0x79, 0x8D, 0x58, 0xB6, 0x88, 0x3A, 0x5A, 0x88, 0xFB,
+    0xD2, 0xA6, 0xD2, 0x90, 0x04, 0xF9, 0xF3, 0x38, 0xD5, 0xB5, 0xAD, 0x51, 0xDD, 0x88, 0x14, 0xAA,
+    0xB5, 0x44, 0x8A, 0x98, 0xA8, 0x56, 0x0B, 0x99, 0x2B, 0x12, 0x17, 0x3D, 0xD6, 0x55, 0x4C, 0xA2,
+    0xA8, 0x31, 0xD3, 0x15, 0xB2, 0x2B, 0x26, 0x12, 0xC6, 0x14, 0xE5, 0x6C, 0xF9, 0xFD, 0xF8, 0xF5,
+    0xA4, 0xB1, 0xA8, 0xDA, 0x20, 0xBB, 0xA7, 0xB4, 0x18, 0x5B, 0xB4, 0xDD, 0x1E, 0x73, 0x65, 0x01,
+    0x66, 0x68, 0x90, 0xDD, 0xFE, 0xE5, 0x03, 0x92, 0x76, 0x22, 0x63, 0x1A, 0xA4, 0x58, 0x65, 0xCD,
+    0x9D, 0xD4, 0x67, 0xF6, 0x29, 0xD3, 0x60, 0x9F, 0xAD, 0x9C, 0xAE, 0x97, 0x52, 0x98, 0x9A, 0x04,
+    0xE7, 0xAD, 0x50, 0xD1, 0x4E, 0x10, 0x0D, 0xE0, 0x60, 0x5B, 0x66, 0x63, 0x64, 0x6B, 0xAF, 0x3B,
+    0x54, 0x6A, 0x50, 0x1A, 0x67, 0x5C, 0x31, 0xCB, 0x01, 0xE5, 0x39, 0x25, 0x62, 0x0B, 0xBB, 0xC3,
+    0x54, 0x0F, 0x81, 0x7A, 0xA2, 0xDB, 0x09, 0x90, 0x69, 0xEF, 0x27, 0x3E, 0xA5, 0xDE, 0xB4, 0x8E,
+    0x27, 0x26, 0x12, 0xEE, 0x9C, 0xF7, 0x3B, 0x38, 0x45, 0xD8, 0xB1, 0xA9, 0x36, 0x3B, 0x28, 0x1A,
+    0x76, 0x64, 0x2C, 0xCB, 0x30, 0x81, 0x29, 0x91, 0xD6, 0xB9, 0x18, 0xAF, 0x6E, 0x87, 0x65, 0xD6,
+    0xE3, 0x0A, 0xAD, 0x76, 0xEF, 0xA9, 0x33, 0xFB, 0x74, 0x70, 0x48, 0x4D, 0x51, 0xD5, 0x90, 0x44,
+    0x69, 0xAA, 0x0C, 0x04, 0x56, 0x81, 0x83, 0x11, 0x23, 0x06, 0x40, 0x03, 0x85, 0x7C, 0xF3, 0x94,
+    0x10, 0xE6, 0x56, 0x8B, 0x0C, 0xAA, 0x0E, 0xBB, 0x97, 0x64, 0x50, 0x4A, 0x69, 0x55, 0xD2, 0x56,
+    0x77, 0x7E, 0x91, 0xF9, 0xC0, 0xE4, 0x8C, 0xF2, 0x5C, 0x1E, 0x1B, 0x51, 0x35, 0x2E, 0x6E, 0x7D,
+    0x63, 0xAA, 0x03, 0x6E, 0x46, 0x21, 0x52, 0xC7, 0x41, 0x26, 0xE3, 0xF8, 0xA1, 0x53, 0x46, 0x07,
+    0xEC, 0x70, 0xDC, 0x45, 0x52, 0x92, 0x76, 0xDE, 0xDD, 0x99, 0xC6, 0x59, 0x9A, 0x98, 0xA3, 0x4F,
+    0x74, 0xA3, 0x65, 0x71, 0x44, 0x80, 0x1E, 0x38, 0xD5, 0x61, 0x15, 0xD5, 0x4E, 0x94, 0xF6, 0xD7,
+    0xD1, 0x99, 0x1D, 0xDE, 0x8E, 0x3D, 0x1B, 0xCD, 0xB2, 0x02, 0x11, 0x8E, 0x9F, 0xFD, 0xB0, 0xFF,
+    0x9B, 0xEA, 0xC6, 0x2D, 0x44, 0x72, 0xF4, 0x10, 0xD8, 0xB9, 0x89, 0xD2, 0x30, 0xB9, 0x88, 0xFC,
+    0x08, 0x90, 0x04, 0xDD, 0x47, 0x60, 0xE8, 0x10, 0x27, 0x8A, 0xB3, 0x77, 0x72, 0x0E, 0x58, 0x6E,
+    0xC0, 0x0A, 0xC5, 0x0A, 0xA7, 0xC8, 0xCF, 0xE9, 0x86, 0x8B, 0x16, 0x0F, 0xC1, 0xB3, 0x43, 0xAD,
+    0x89, 0x6D, 0x64, 0x34, 0x28, 0x06, 0xCF, 0x04, 0xE5, 0xE1, 0xD8, 0xB4, 0x15, 0xF8, 0x21, 0x45,
+    0x03, 0x93, 0x5A, 0x03, 0xA7, 0xAD, 0x54, 0x8C, 0xA0, 0x11, 0x22, 0x13, 0x30, 0x0F, 0x33, 0x85,
+    0xB4, 0xD8, 0xB6, 0x97, 0x75, 0x3C, 0x18, 0x9E, 0x3A, 0x19, 0xA2, 0x53, 0x5D, 0x80, 0x96, 0x32,
+    0xE5, 0xC0, 0xD8, 0xDD, 0x26, 0x26, 0x4B, 0xC3, 0x77, 0xE6, 0x02, 0x48, 0x5B, 0x8A, 0x37, 0x10,
+    0x9D, 0x7D, 0xE1, 0xB9, 0x7F, 0x42, 0x75, 0xBC, 0x1D, 0x68, 0x3C, 0xEB, 0xA7, 0xAC, 0xD5, 0x62,
+    0x85, 0x2D, 0x6F, 0x57, 0xFE, 0x30, 0x48, 0xF1, 0x83, 0x77, 0xD0, 0x14, 0x1D, 0x08, 0xC1, 0x95,
+    0xE9, 0x06, 0x42, 0x62, 0x93, 0xB6, 0x92, 0xA8, 0x67, 0x3B, 0x96, 0xEC, 0xA7, 0xBC, 0xCE, 0x7A,
+    0xD2, 0x02, 0x10, 0xD6, 0x9E, 0x72, 0x24, 0xBC, 0x47, 0xC9, 0xAF, 0xC4, 0xED, 0xA0, 0x57, 0xBE,
+    0xC0, 0x5F, 0x1F, 0x95, 0x49, 0x6F, 0xDA, 0x1F, 0x54, 0xD6, 0x13, 0xA3, 0xAD, 0x58, 0xE0, 0xC4,
+    0x06, 0xC3, 0x19, 0x18, 0x9B, 0x59, 0x6F, 0x6B, 0xAC, 0x64, 0x0A, 0xBF, 0x15, 0xAF, 0x51, 0xC3,
+    0xAE, 0x0A, 0x0C, 0x09, 0x2D, 0xEF, 0xED, 0xC7, 0x5E, 0xE5, 0xCD, 0xA5, 0xEC, 0x2B, 0x2B, 0xAF,
+    0xA4, 0x5C, 0x32, 0xBA, 0xB1, 0x0C, 0xCF, 0x37, 0xB9, 0x4F, 0x63, 0x60, 0xC7, 0xC2, 0x3E, 0xCC,
+    0x3C, 0xF5, 0xE2, 0xDE, 0xC9, 0x76, 0x69, 0x7C, 0x5F, 0x04, 0x4E, 0xDC, 0x3E, 0x92, 0xA2, 0x1F,
+    0xF1, 0x96, 0x0D, 0xB1, 0xA5, 0x4B, 0x5A, 0x40, 0x70, 0x14, 0xF3, 0x06, 0x77, 0x92, 0xD5, 0x30,
+    0x55, 0x56, 0x03, 0x91, 0x93, 0xC8, 0x98, 0x6B, 0x0E, 0xDD, 0x53, 0xB7, 0x4C, 0x20, 0xAA, 0xB5,
+    0xFB, 0xF2, 0xF8, 0x72, 0x43, 0x47, 0xD7, 0xA4, 0x61, 0xE9, 0xBE, 0x9F, 0x1F, 0x3E, 0xDA, 0x7F,
+    0xB2, 0x7F, 0x51, 0x29, 0xD5, 0xB4, 0xEC, 0x0E, 0xBC, 0x1D, 0xD7, 0x1F, 0x84, 0x77, 0x20, 0x91,
+    0x37, 0x1E, 0x7D, 0x58, 0x34, 0x9C, 0xB8, 0xEC, 0x78, 0xAE, 0x86, 0x5B, 0xC8, 0xBC, 0xF3, 0x97,
+    0x45, 0xC0, 0x74, 0x7A, 0x7B, 0x25, 0x19, 0x2F, 0x2E, 0xB8, 0xA2, 0xA7, 0x8E, 0x30, 0x3D, 0xDA,
+    0x39, 0x35, 0x29, 0xA7, 0xA7, 0xF1, 0x52, 0x61, 0x3B, 0x0B, 0xEC, 0xC6, 0xBD, 0xA3, 0xA5, 0xFC,
+    0xCD, 0x88, 0xAA, 0x15, 0x00, 0xC0, 0x46, 0x37, 0x28, 0x21, 0xAF, 0xEC, 0x3A, 0xF7, 0x3E, 0x7B,
+    0x92, 0x14, 0x81, 0x4D, 0x91, 0x8D, 0xEF, 0x97, 0xDE, 0xBE, 0xDE, 0x84, 0xDB, 0xA8, 0x05, 0xC2,
+    0xE0, 0xEC, 0x62, 0xDE, 0xC3, 0xE9, 0x96, 0x0E, 0x0A, 0x33, 0x20, 0x1D, 0x01, 0x2E, 0xA7, 0xDB,
+    0x0A, 0x7C, 0x9C, 0x5E, 0x95, 0xFF, 0x11, 0xDC, 0x3F, 0x1F, 0xBF, 0x00, 0xD5, 0x55, 0x31, 0x6E,
+    0xD5, 0x40, 0x10, 0x1D, 0xAF, 0x95, 0x58, 0x62, 0x0B, 0x57, 0xD0, 0xA4, 0xD8, 0x3A, 0x95, 0x8F,
+    0xB0, 0x3E, 0x42, 0x0A, 0x52, 0x20, 0x5A, 0x2A, 0x9A, 0x9C, 0x20, 0x7C, 0x4B, 0x5C, 0x20, 0x47,
+    0x48, 0x01, 0x12, 0xFA, 0x0D, 0x37, 0x88, 0x2D, 0x4E, 0xE0, 0x22, 0x07, 0xB0, 0x50, 0x1A, 0xD2,
+    0xE0, 0xC2, 0x91, 0x0C, 0xB1, 0x3D, 0xCC, 0x9B, 0xDD, 0x6F, 0x48, 0xA4, 0x90, 0x74, 0x88, 0x95,
+    0xB2, 0x72, 0xEC, 0xD9, 0x99, 0xF7, 0xDE, 0xBC, 0xD9, 0x4F, 0xA4, 0x2B, 0x6F, 0x5C, 0x43, 0x19,
+    0x73, 0x47, 0xC4, 0xDC, 0x13, 0x39, 0x3C, 0xD1, 0xDB, 0x92, 0x1E, 0x5B, 0x49, 0x5D, 0x11, 0xA5,
+    0x3C, 0x61, 0xAB, 0x1B, 0x4A, 0xA7, 0x64, 0x20, 0x33, 0xED, 0x5D, 0x20, 0x0F, 0x57, 0x54, 0x23,
+    0xA5, 0x67, 0x1E, 0xC9, 0x2D, 0x1F, 0x8F, 0xC8, 0x4A, 0x6A, 0x32, 0x33, 0x0E, 0xD6, 0x57, 0x59,
+    0x2B, 0x65, 0xA4, 0x58, 0xCA, 0x38, 0xEE, 0x79, 0x41, 0xB6, 0xAB, 0x90, 0xF6, 0x18, 0x5B, 0x01,
+    0x0C, 0xA9, 0x46, 0x6F, 0x5A, 0x80, 0x9C, 0x50, 0x90, 0x9B, 0x07, 0xA0, 0x98, 0xED, 0x67, 0xF9,
+    0x26, 0xC5, 0x06, 0x30, 0x59, 0x80, 0x60, 0x5B, 0x51, 0xDE, 0xEB, 0xA1, 0xFB, 0xF9, 0xAE, 0xE5,
+    0xBB, 0x65, 0x6E, 0x11, 0x25, 0x69, 0x73, 0x80, 0x35, 0x1A, 0xE5, 0xFF, 0x8C, 0xDA, 0x9E, 0xE3,
+    0x13, 0x2B, 0x9B, 0x1E, 0x70, 0x59, 0xA2, 0xF0, 0xE8, 0xF5, 0x2D, 0xC2, 0x05, 0x4E, 0x06, 0x60,
+    0xC2, 0x9E, 0xF2, 0x51, 0x60, 0x48, 0x26, 0x7A, 0x7E, 0xF4, 0xA8, 0x68, 0x38, 0xEF, 0x6F, 0x27,
+    0x01, 0x98, 0xB5, 0xAA, 0x98, 0xA4, 0xEC, 0x2C, 0x80, 0x4B, 0xEA, 0x0E, 0x72, 0x19, 0xA4, 0x2D,
+    0x5A, 0xA4, 0x3C, 0x73, 0xA5, 0x6A, 0x85, 0xAA, 0x29, 0x34, 0xDD, 0xE7, 0xB3, 0x7F, 0xC2, 0x38,
+    0x1D, 0x11, 0xB6, 0x60, 0x73, 0x15, 0x44, 0xD7, 0x76, 0xB8, 0x49, 0xAB, 0x95, 0x77, 0x18, 0xC2,
+    0x15, 0x30, 0x05, 0x3C, 0xA1, 0x04, 0xE1, 0x08, 0x18, 0x02, 0x7E, 0x00, 0x3F, 0xB8, 0x41, 0xCD,
+    0x00, 0x2F, 0x80, 0x9E, 0x3A, 0x01, 0x46, 0x58, 0x7D, 0x60, 0xA4, 0x46, 0x36, 0x84, 0xBF, 0xB4,
+    0x8F, 0xDD, 0xF7, 0x38, 0x37, 0xDD, 0xD3, 0x34, 0xEB, 0x0D, 0xC4, 0x9F, 0x1D, 0xC8, 0x30, 0x03,
+    0x8A, 0xD7, 0x18, 0xD7, 0x07, 0x83, 0x3F, 0xE6, 0xE4, 0x20, 0xA6, 0x40, 0x90, 0xB3, 0x41, 0xCD,
+    0x9C, 0x7F, 0x7E, 0xA2, 0x20, 0x67, 0xCC, 0xA2, 0x7A, 0x92, 0x6F, 0x57, 0x41, 0xC5, 0xE0, 0x33,
+    0x45, 0x45, 0x09, 0x36, 0x8F, 0x92, 0xA6, 0xAA, 0x50, 0xD0, 0x34, 0x5B, 0xB6, 0x5B, 0x8A, 0xA2,
+    0x86, 0x5D, 0x55, 0xA5, 0x42, 0xF7, 0x9D, 0x91, 0x5E, 0xD2, 0x5E, 0x49, 0x45, 0x53, 0x08, 0x84,
+    0x79, 0x53, 0xE1, 0xBD, 0x50, 0xC8, 0xF4, 0x53, 0xAD, 0x00, 0xE8, 0x89, 0xEB, 0x00, 0x1D, 0xF2,
+    0xAA, 0xD3, 0x2D, 0xE6, 0xAA, 0x71, 0xC8, 0xFB, 0xBA, 0x43, 0xED, 0x91, 0xD4, 0x60, 0x20, 0x59,
+    0x25, 0x7C, 0x7D, 0x1C, 0x73, 0xC3, 0x63, 0x64, 0x97, 0xF2, 0x54, 0xF4, 0x8D, 0x98, 0x9A, 0x60,
+    0x33, 0x3A, 0x58, 0x62, 0x53, 0x83, 0xDE, 0xB9, 0x0A, 0x90, 0xC2, 0xE2, 0xE0, 0xAE, 0xC0, 0xBE,
+    0x82, 0x65, 0x3A, 0x98, 0xF1, 0xA9, 0x08, 0xA5, 0xBD, 0xFC, 0x81, 0xD4, 0x56, 0x95, 0x56, 0x94,
+    0x93, 0x1B, 0xD5, 0xDD, 0xF1, 0x65, 0xF2, 0x46, 0xD2, 0xAB, 0xC0, 0x75, 0x68, 0x9C, 0x16, 0x36,
+    0xA1, 0xA2, 0xEF, 0x43, 0x79, 0x7A, 0x26, 0xF3, 0xB5, 0xE9, 0xE4, 0x6C, 0x69, 0x67, 0x39, 0x35,
+    0x12, 0x37, 0xF2, 0x4F, 0x95, 0x0B, 0x94, 0xCD, 0x40, 0x02, 0xDC, 0x0E, 0xC2, 0xF7, 0xF2, 0x05,
+    0x03, 0x65, 0xBC, 0x64, 0x76, 0x9A, 0x77, 0x5A, 0x0D, 0x68, 0x4F, 0x30, 0x44, 0xEB, 0x52, 0xFC,
+    0x56, 0xF7, 0xCD, 0x48, 0xF1, 0x56, 0x23, 0xFF, 0x45, 0x72, 0x0A, 0xB7, 0x8B, 0x07, 0xD9, 0xD8,
+    0xD1, 0x97, 0x42, 0x63, 0x99, 0x28, 0xDC, 0x67, 0xB4, 0x58, 0x41, 0x9B, 0xB7, 0x00, 0xF3, 0x0E,
+    0x90, 0x8D, 0xCC, 0xAD, 0xBC, 0xA8, 0x60, 0x87, 0x53, 0x38, 0x49, 0xEE, 0x48, 0x11, 0xD8, 0xCA,
+    0x90, 0x2B, 0xA2, 0x5E, 0x01, 0x35, 0x30, 0x10, 0xEE, 0x40, 0x8C, 0xB3, 0xC0, 0xAE, 0x9B, 0x75,
+    0xD2, 0x60, 0xC1, 0xC3, 0x04, 0x86, 0x50, 0xA3, 0x59, 0x0D, 0xF6, 0x0A, 0xEF, 0x84, 0xEF, 0xDE,
+    0xD1, 0xAE, 0x2A, 0x9A, 0xD5, 0x96, 0x89, 0x92, 0x15, 0xF1, 0x34, 0x0B, 0x6D, 0xCB, 0x27, 0x75,
+    0xE7, 0x84, 0xBF, 0x91, 0xE2, 0x1A, 0x61, 0xC0, 0x9D, 0x5E, 0x3A, 0x15, 0x37, 0xF4, 0x4A, 0x0A,
+    0xCF, 0xB4, 0x0E, 0x7E, 0x6C, 0x0F, 0xD5, 0xD1, 0x17, 0x14, 0xDF, 0x1D, 0x96, 0xBB, 0xFE, 0x18,
+    0x2E, 0x33, 0xA9, 0x2F, 0xEF, 0xD0, 0x26, 0x3F, 0x08, 0xA8, 0x36, 0x36, 0x28, 0xE5, 0x9B, 0x3D,
+    0x61, 0x69, 0x79, 0x1D, 0x8D, 0x69, 0xED, 0x90, 0x53, 0x2D, 0xE4, 0x9A, 0xFB, 0x11, 0x86, 0xB3,
+    0x37, 0x22, 0x4A, 0xBE, 0x04, 0xE2, 0x8B, 0x3A, 0x1C, 0x25, 0x8B, 0xBF, 0x98, 0xAE, 0x7E, 0x3F,
+    0x20, 0xCF, 0xF7, 0x26, 0xBA, 0x3A, 0xEF, 0x6A, 0x89, 0x9E, 0x49, 0xEA, 0x67, 0x1D, 0xA0, 0x16,
+    0x7A, 0x5F, 0x8F, 0x98, 0xE7, 0xAC, 0xC5, 0x85, 0xE9, 0x4A, 0xD0, 0xB9, 0x48, 0x24, 0xB5, 0xD1,
+    0x23, 0xD9, 0xEE, 0xAA, 0x0C, 0x88, 0x84, 0x94, 0xBD, 0x9D, 0x7E, 0xCF, 0x81, 0x44, 0x98, 0x33,
+    0x37, 0x68, 0x44, 0x03, 0xD1, 0xF5, 0x67, 0x10, 0x8F, 0xFB, 0xDA, 0xC3, 0xFF, 0x60, 0xFD, 0x02,
+    0x95, 0x55, 0xBF, 0x8E, 0xDF, 0x44, 0x10, 0x1E, 0xDB, 0xDC, 0x59, 0x3A, 0x17, 0xDB, 0x00, 0x0D,
+    0x85, 0x1B, 0x1A, 0x82, 0xC4, 0x3E, 0xC2, 0xAE, 0xF2, 0x02, 0xA4, 0xC8, 0x4F, 0x88, 0x3E, 0x15,
+    0x29, 0xF2, 0x02, 0xE8, 0x6C, 0x89, 0x82, 0x36, 0x8F, 0x90, 0x82, 0x06, 0x68, 0x78, 0x00, 0x74,
+    0x36, 0xE2, 0x05, 0x8C, 0x14, 0x2A, 0x1A, 0x4B, 0x34, 0xD0, 0x39, 0xC8, 0x87, 0x0C, 0xD8, 0x1E,
+    0xBE, 0x6F, 0xF6, 0xF7, 0x4B, 0xB8, 0xD3, 0x11, 0x81, 0x8B, 0x91, 0xBD, 0x5E, 0xCF, 0xCC, 0xF7,
+    0x67, 0xC7, 0x22, 0x22, 0xC5, 0x8A, 0x20, 0xF5, 0xC8, 0xA8, 0x2D, 0x42, 0xB9, 0xF1, 0x36, 0xCC,
+    0x8C, 0x87, 0x28, 0xAF, 0xBF, 0x9E, 0xE8, 0xAF, 0x22, 0x5E, 0x75, 0x91, 0x52, 0x55, 0x47, 0x69,
+    0x10, 0x63, 0xA9, 0xD7, 0xF2, 0xB1, 0x04, 0xE6, 0xC9, 0xB5, 0x47, 0x74, 0x56, 0xA3, 0x63, 0x8D,
+    0x42, 0x25, 0x2D, 0xBC, 0x17, 0xA5, 0x19, 0x33, 0xD5, 0xFB, 0xDC, 0xBF, 0x63, 0xA1, 0xD6, 0x05,
+    0x45, 0x33, 0x1D, 0x90, 0xA6, 0x9A, 0x0B, 0xBD, 0x3E, 0xEB, 0xFA, 0x0A, 0xE9, 0x54, 0x1C, 0xC2,
+    0xCA, 0x2A, 0x78, 0x53, 0xAB, 0xEE, 0x22, 0xE7, 0xFA, 0x47, 0xAA, 0xFF, 0x90, 0x35, 0x58, 0xA8,
+    0x60, 0xA8, 0xD6, 0x53, 0xB1, 0x7A, 0xBD, 0xBB, 0x5F, 0x3F, 0x6E, 0x28, 0xB1, 0xAF, 0x6C, 0x77,
+    0x15, 0x37, 0x76, 0x8B, 0x84, 0x88, 0xB2, 0x97, 0x12, 0x26, 0xF9, 0x56, 0xC2, 0x28, 0x58, 0x18,
+    0xB2, 0x59, 0x9A, 0x1E, 0x41, 0xFB, 0x7C, 0x29, 0xB5, 0xCD, 0xD9, 0x44, 0xC6, 0x20, 0x56, 0xBD,
+    0x51, 0x14, 0xAB, 0xFE, 0x62, 0x89, 0x62, 0x61, 0xC5, 0x49, 0x2E, 0x62, 0x33, 0xB0, 0xCF, 0x9E,
+    0x6D, 0x82, 0x3D, 0x24, 0x97, 0x77, 0x74, 0xB8, 0x51, 0x3A, 0xF1, 0x6A, 0x8D, 0xA1, 0x18, 0xAE,
+    0x26, 0x91, 0xDE, 0x1B, 0x4F, 0xED, 0x2B, 0x72, 0x6C, 0xE3, 0xD9, 0x43, 0xF9, 0x6F, 0x57, 0xD6,
+    0xE9, 0x17, 0x47, 0x0D, 0xD8, 0x63, 0x52, 0x62, 0x06, 0x51, 0xCF, 0xB3, 0x47, 0x49, 0x04, 0xE9,
+    0xA6, 0x3B, 0x0B, 0x21, 0x5E, 0x3C, 0x90, 0x72, 0xC7, 0xDE, 0xB9, 0xDA, 0x28, 0x40, 0x92, 0x81,
+    0x0D, 0x34, 0xB3, 0x03, 0xD2, 0x2E, 0x3A, 0x7D, 0xFE, 0xB6, 0x4A, 0xD2, 0xA1, 0xB0, 0x48, 0x36,
+    0x8C, 0x04, 0x94, 0x7A, 0x29, 0xC4, 0xD9, 0x81, 0xCE, 0x61, 0xEE, 0xA4, 0xB8, 0x41, 0x37, 0x94,
+    0x66, 0xA4, 0x7A, 0x39, 0x09, 0x53, 0xED, 0x37, 0xBB, 0xEF, 0x3E, 0x9B, 0x93, 0x20, 0x89, 0xDF,
+    0xBD, 0x42, 0x8E, 0x8D, 0x9F, 0x9B, 0x22, 0x5E, 0xDC, 0x22, 0xAE, 0x85, 0xB8, 0xE5, 0x90, 0x41,
+    0x03, 0x4A, 0x22, 0x57, 0x19, 0x7C, 0x00, 0xBC, 0x53, 0x12, 0x31, 0x69, 0x02, 0x5F, 0xC0, 0xAB,
+    0x5D, 0x67, 0x76, 0x1B, 0x93, 0x28, 0xF9, 0xD3, 0x7A, 0xE6, 0x6B, 0xEC, 0xE9, 0x18, 0x4C, 0x95,
+    0x73, 0x9D, 0xFF, 0x59, 0xBF, 0x32, 0x8D, 0xDC, 0xF4, 0x4A, 0xA1, 0xC6, 0x18, 0xDA, 0xB9, 0x54,
+    0xCC, 0xD9, 0x76, 0x07, 0xE3, 0x68, 0x27, 0xDF, 0xA5, 0x5C, 0x79, 0x53, 0x59, 0x44, 0x97, 0x78,
+    0x74, 0x33, 0x1F, 0xEB, 0x89, 0x8F, 0x68, 0x1E, 0xC5, 0xE1, 0x27, 0x3F, 0x09, 0xAC, 0x81, 0xC7,
+    0x6E, 0xE0, 0x23, 0xFA, 0xEF, 0x00, 0xE5, 0xC7, 0x03, 0xBC, 0x45, 0x3A, 0x7B, 0x23, 0xB5, 0x4D,
+    0x91, 0xCA, 0x69, 0x74, 0xC9, 0xF4, 0xC8, 0xAD, 0xF4, 0x31, 0x74, 0xF0, 0xC8, 0xBA, 0x49, 0x58,
+    0x78, 0x23, 0xF2, 0xE9, 0xB1, 0x61, 0x63, 0xBA, 0x01, 0x6C, 0xF7, 0x62, 0x97, 0x7C, 0xC9, 0x6F,
+    0x5B, 0x9E, 0x34, 0x64, 0x5C, 0x0C, 0x2D, 0xA1, 0x10, 0xDA, 0x89, 0x9C, 0x0D, 0xCD, 0xD4, 0xA9,
+    0xEC, 0x0A, 0x85, 0x7C, 0x8F, 0xBE, 0x57, 0x41, 0xD1, 0xDE, 0x8D, 0xD9, 0x8A, 0x03, 0xE5, 0xDB,
+    0xD0, 0x17, 0x33, 0x30, 0x35, 0xD2, 0xB5, 0xD5, 0x04, 0x40, 0x9A, 0x69, 0xF4, 0xA3, 0x9F, 0x8B,
+    0x0D, 0xB6, 0x69, 0x86, 0xF3, 0x6F, 0xCE, 0xE2, 0x89, 0x89, 0x8C, 0x07, 0x23, 0x0A, 0xB8, 0x0F,
+    0xC3, 0x11, 0x32, 0xA8, 0x80, 0xDC, 0x7E, 0xFF, 0xEA, 0x6B, 0x6D, 0x0D, 0xCF, 0x64, 0xD8, 0x16,
+    0xC3, 0xBC, 0x71, 0x07, 0x2C, 0x81, 0x1D, 0xB0, 0x5D, 0xA9, 0x87, 0x8F, 0x92, 0xAB, 0x80, 0x47,
+    0xED, 0x90, 0x07, 0xF3, 0x71, 0x6D, 0x5B, 0xDD, 0xD1, 0x7A, 0x11, 0x70, 0x33, 0xEE, 0x18, 0x69,
+    0xE7, 0x66, 0x7E, 0x49, 0x87, 0xD0, 0x51, 0xF5, 0x77, 0x51, 0x1E, 0xF3, 0x44, 0x03, 0x94, 0xE8,
+    0x75, 0x4C, 0xAB, 0xEE, 0xA7, 0x8D, 0x89, 0x17, 0x26, 0xEC, 0x4B, 0xBD, 0xBF, 0xA2, 0x47, 0x40,
+    0x9C, 0x64, 0xCD, 0x60, 0xFA, 0xDE, 0x0F, 0xF9, 0x82, 0xF1, 0x17, 0x62, 0xD3, 0x97, 0x53, 0xB5,
+    0x48, 0x87, 0x01, 0xE8, 0xA6, 0x7A, 0xCE, 0xF7, 0x5C, 0x63, 0x18, 0xC2, 0x84, 0x51, 0xF8, 0xD8,
+    0x46, 0xCC, 0x9B, 0x0E, 0x2C, 0x7E, 0x0E, 0x7C, 0xBF, 0xA3, 0x71, 0x0F, 0x99, 0xBF, 0x47, 0xE5,
+    0x67, 0xEF, 0xFE, 0xCB, 0x89, 0xAC, 0x9F, 0x09, 0xED, 0x40, 0x6A, 0x8C, 0x18, 0x09, 0x10, 0x0A,
+    0xB6, 0x10, 0xD4, 0x48, 0xD3, 0x8A, 0xC7, 0xCF, 0x16, 0x21, 0x46, 0x35, 0xA7, 0x21, 0x4C, 0x16,
+    0xC9, 0x21, 0x19, 0x24, 0x7F, 0x96, 0xC2, 0x0E, 0xAA, 0xE9, 0x8C, 0x45, 0x8F, 0xCF, 0x2F, 0xCC,
+    0x90, 0x97, 0x55, 0x0C, 0x3F, 0x0F, 0xFE, 0x6A, 0x72, 0x1F, 0x2E, 0xC5, 0x0F, 0xCB, 0xCD, 0xF2,
+    0x1F, 0xC0, 0x11, 0x83, 0x14, 0x93, 0x89, 0x7F, 0x85, 0x7C, 0x78, 0xEE, 0xA5, 0xC4, 0x79, 0x58,
+    0x8C, 0x96, 0x26, 0x8A, 0xEF, 0xE9, 0x20, 0x54, 0xCD, 0x91, 0xFF, 0x09, 0xFD, 0x2E, 0x6F, 0x7D,
+    0x02, 0xE2, 0x28, 0x8D, 0xEA, 0x50, 0xEA, 0x9F, 0x5F, 0xBE, 0x6E, 0xE4, 0x94, 0xBF, 0xD0, 0x4C,
+    0x7D, 0x02, 0x64, 0x08, 0xE9, 0x47, 0x03, 0xE0, 0xC7, 0x23, 0x44, 0xC2, 0xB3, 0x7F, 0x4B, 0xD3,
+    0x26, 0x8C, 0x06, 0xBA, 0x36, 0xDF, 0x4A, 0x02, 0x69, 0x33, 0x9B, 0x69, 0x6C, 0x32, 0x10, 0x25,
+    0xE7, 0x84, 0x4D, 0xA8, 0xF7, 0x4F, 0x87, 0xF4, 0x5E, 0xB7, 0x43, 0xD3, 0x17, 0xF0, 0xC0, 0xBD,
+    0xC3, 0xED, 0x89, 0x58, 0x3D, 0x85, 0x93, 0x85, 0xE0, 0x88, 0xD4, 0xB7, 0x66, 0xF2, 0x20, 0x84,
+    0x4A, 0xDC, 0x70, 0x3A, 0x8F, 0x2F, 0xB0, 0xB2, 0x0F, 0xF4, 0xC3, 0xDF, 0x43, 0x02, 0x7B, 0xD9,
+    0x1A, 0xBB, 0x5D, 0x6B, 0x44, 0xAB, 0xF5, 0x45, 0xB5, 0xFC, 0x70, 0xDA, 0x5B, 0x2E, 0x9C, 0x7E,
+    0xC4, 0x45, 0x58, 0xF0, 0x6B, 0x81, 0xD7, 0xB0, 0x37, 0x3F, 0x43, 0xA7, 0x8E, 0x03, 0xAB, 0xA5,
+    0x22, 0xC5, 0x6F, 0x51, 0x58, 0x9D, 0x5A, 0x81, 0xD8, 0x39, 0x9D, 0xB2, 0x34, 0x99, 0x1F, 0x58,
+    0x46, 0x12, 0xC4, 0xD2, 0x81, 0xB9, 0xFA, 0xDB, 0x00, 0xA0, 0x0E, 0xBF, 0x67, 0xCF, 0x40, 0x40,
+    0x3C, 0x50, 0x0E, 0xE6, 0x34, 0x08, 0xFC, 0xBD, 0xD4, 0xC8, 0xD0, 0x25, 0x2E, 0xC9, 0x32, 0x1C,
+    0xC2, 0x4E, 0xEB, 0x04, 0x0E, 0x42, 0xDB, 0x2F, 0x45, 0x27, 0x43, 0x23, 0x6F, 0xC8, 0xFF, 0xB9,
+    0xFE, 0x06, 0x8D, 0x55, 0x31, 0x6E, 0x9D, 0x40, 0x10, 0x1D, 0x40, 0x32, 0x52, 0x28, 0xB6, 0x4A,
+    0x4D, 0x9F, 0x14, 0x7B, 0x84, 0x45, 0xCA, 0x15, 0x7C, 0x8F, 0x5C, 0x20, 0x12, 0x5C, 0x21, 0x37,
+    0x48, 0x91, 0xC2, 0x72, 0x93, 0xDA, 0x52, 0x14, 0xB0, 0x9B, 0x94, 0xE6, 0x08, 0x58, 0x4A, 0x24,
+    0x97, 0x48, 0x46, 0x32, 0x91, 0x81, 0xCD, 0x7B, 0x33, 0x7C, 0xCB, 0xB1, 0xBF, 0xA5, 0xF0, 0xFF,
+    0x20, 0x60, 0x66, 0x67, 0xDE, 0xBC, 0x99, 0xD9, 0x15, 0x49, 0x4E, 0x45, 0xB2, 0x45, 0xA4, 0x80,
+    0xB8, 0x59, 0xA4, 0x84, 0x84, 0x49, 0x8E, 0x5D, 0xF9, 0x2D, 0x84, 0xA6, 0x30, 0x71, 0x30, 0x71,
+    0x23, 0xCC, 0x21, 0x7E, 0x80, 0xF4, 0x58, 0xD6, 0x99, 0xD4, 0x8D, 0x48, 0x5B, 0x89, 0x44, 0x91,
+    0x04, 0x92, 0x42, 0xB2, 0x0D, 0xB2, 0xDA, 0x72, 0xB7, 0x0B, 0x23, 0x79, 0xC8, 0x7B, 0x46, 0xBB,
+    0x90, 0x55, 0x96, 0x64, 0x49, 0xE7, 0x6C, 0xCA, 0xC6, 0x7C, 0x2C, 0x06, 0x37, 0x94, 0xBD, 0xEF,
+    0x02, 0x7E, 0x6D, 0xF7, 0xB1, 0x11, 0xF7, 0x4B, 0xE4, 0xBC, 0xA2, 0x8B, 0xBA, 0xA3, 0x63, 0x3F,
+    0xF2, 0x01, 0x80, 0x11, 0x3C, 0x5F, 0x09, 0x07, 0x61, 0x98, 0x47, 0x6C, 0xA8, 0x0E, 0x3D, 0x51,
+    0xC0, 0x08, 0xB8, 0x60, 0x04, 0xA4, 0x58, 0x0A, 0x35, 0xF0, 0xA4, 0x80, 0x12, 0xE1, 0xA3, 0x92,
+    0x30, 0xD0, 0x0E, 0x19, 0xE0, 0x8F, 0xF4, 0xF1, 0x07, 0x4C, 0xFC, 0x93, 0x58, 0x25, 0x70, 0xD3,
+    0x76, 0xD2, 0xF6, 0x6A, 0x34, 0xD2, 0x3F, 0x20, 0x03, 0xFD, 0x49, 0xAB, 0xB9, 0xE0, 0x82, 0x03,
+    0x51, 0x4F, 0x52, 0x54, 0x2D, 0x58, 0xC8, 0x62, 0x9C, 0x98, 0x70, 0x5C, 0xF8, 0x39, 0x02, 0xA9,
+    0x84, 0x48, 0x53, 0xAF, 0xF7, 0xE4, 0xDB, 0xFC, 0x84, 0xCA, 0x04, 0xEA, 0x85, 0x98, 0x12, 0xF5,
+    0x0A, 0x64, 0x74, 0x3F, 0x2B, 0x2F, 0x22, 0x6F, 0x4F, 0x9F, 0x53, 0x7F, 0x01, 0xBA, 0x3A, 0x50,
+    0x24, 0xA1, 0xC1, 0x3A, 0x09, 0x15, 0xD6, 0x49, 0x2D, 0x29, 0x7C, 0xFE, 0x90, 0x0C, 0x71, 0x91,
+    0xDD, 0x48, 0x97, 0xF9, 0x48, 0x97, 0xC5, 0xC0, 0x8F, 0x6E, 0xE0, 0xC7, 0xB2, 0xE7, 0x47, 0xDF,
+    0xF1, 0x23, 0xAA, 0xE3, 0x3A, 0xDE, 0xE1, 0x0C, 0xE9, 0xC1, 0x19, 0xA8, 0xAD, 0x2D, 0x11, 0xDE,
+    0xBC, 0xA6, 0x16, 0x14, 0x44, 0xAD, 0x78, 0xDB, 0xE1, 0x65, 0x1F, 0xB8, 0x86, 0xF7, 0xD4, 0x68,
+    0x30, 0x33, 0x17, 0x11, 0x1D, 0x69, 0xB0, 0x0D, 0xA4, 0x15, 0xDF, 0xC8, 0xF1, 0xCB, 0xD3, 0xEC,
+    0xC0, 0x20, 0x0A, 0x28, 0xB2, 0xA7, 0xBC, 0xD3, 0xF9, 0xAF, 0x9E, 0xCE, 0xB4, 0x31, 0x45, 0xEB,
+    0x2A, 0xD6, 0x6E, 0xD6, 0x51, 0xA2, 0x45, 0x16, 0x6B, 0xA9, 0x47, 0xBD, 0x9B, 0x9E, 0xEA, 0x87,
+    0xA7, 0x7A, 0x04, 0xCB, 0x3E, 0xB7, 0xD4, 0xB7, 0x31, 0x2A, 0xE4, 0xD8, 0x6B, 0xBD, 0x66, 0xAD,
+    0xD4, 0xAA, 0x35, 0x5A, 0x8F, 0x60, 0x36, 0x1E, 0x9A, 0x43, 0xAE, 0x81, 0x9E, 0xC2, 0x15, 0x2C,
+    0x7D, 0x53, 0x0C, 0xAF, 0xE4, 0xF9, 0x4E, 0xC1, 0x32, 0x3F, 0x35, 0x61, 0x85, 0x58, 0x17, 0x61,
+    0xB9, 0xE8, 0xA3, 0xFA, 0x4F, 0xB5, 0x1B, 0x0E, 0x49, 0xD5, 0xCB, 0xA1, 0x3E, 0x8E, 0xE8, 0xF3,
+    0xED, 0x48, 0x5D, 0x34, 0x6D, 0x1D, 0xDE, 0x24, 0x76, 0x8F, 0xD4, 0xD5, 0x1A, 0xC2, 0xEA, 0x3B,
+    0x3F, 0xEA, 0x92, 0xD3, 0x63, 0xB8, 0x93, 0x98, 0x82, 0xC8, 0x62, 0xD2, 0x5D, 0xE0, 0x12, 0x86,
+    0xC9, 0xA6, 0xE3, 0x3A, 0x69, 0xD2, 0xD7, 0x78, 0x4C, 0x57, 0x0C, 0x85, 0xB8, 0x07, 0x32, 0x55,
+    0xC7, 0x81, 0x9E, 0x0D, 0xD4, 0xA0, 0xCC, 0x6A, 0x28, 0x46, 0x29, 0xF5, 0xDE, 0x72, 0x26, 0x6C,
+    0x32, 0xCA, 0x3B, 0xF6, 0x48, 0xFC, 0x89, 0x7B, 0xB6, 0xB1, 0x5F, 0xFC, 0x54, 0x62, 0x51, 0xEC,
+    0x82, 0x2E, 0x75, 0xF0, 0x9A, 0x12, 0x2F, 0x9A, 0xD2, 0x08, 0x69, 0x0F, 0xF9, 0x33, 0x94, 0x67,
+    0xF9, 0x66, 0xCC, 0x74, 0x8D, 0x81, 0x2F, 0x1E, 0xE0, 0x9B, 0x15, 0x2B, 0xD1, 0x35, 0x29, 0xCB,
+    0x18, 0x10, 0x38, 0xE7, 0xE4, 0xB5, 0x70, 0xEC, 0xEE, 0x63, 0x93, 0xC4, 0xB0, 0x89, 0xBF, 0x89,
+    0x53, 0xB6, 0x16, 0xB1, 0x3F, 0xB2, 0x97, 0xB1, 0xDF, 0x38, 0xB6, 0x6E, 0xDD, 0x9B, 0xC3, 0x4F,
+    0xFC, 0x7A, 0x78, 0x41, 0x80, 0xF4, 0x7C, 0xB7, 0xCD, 0x6E, 0x16, 0xF9, 0x54, 0x8B, 0xBB, 0xEE,
+    0xE4, 0x1E, 0xB0, 0x31, 0x6A, 0x58, 0x0C, 0x56, 0x49, 0x2F, 0xB0, 0x97, 0xB1, 0xC9, 0xEE, 0x56,
+    0x09, 0x7E, 0x2A, 0x7A, 0xED, 0x32, 0x78, 0x4D, 0xB9, 0x15, 0x90, 0x00, 0x66, 0xF4, 0xB4, 0x54,
+    0x98, 0x71, 0xDD, 0x08, 0x75, 0xDE, 0x38, 0x00, 0x9C, 0x18, 0x6E, 0xA4, 0x6C, 0x53, 0x1D, 0x29,
+    0x02, 0x53, 0xC5, 0x60, 0x95, 0x57, 0x45, 0xDC, 0x3B, 0x5C, 0x15, 0x0F, 0x71, 0x45, 0xF3, 0xC6,
+    0x1C, 0x72, 0x05, 0x19, 0xA2, 0xF2, 0xAB, 0xD7, 0x77, 0x84, 0x9D, 0x0C, 0x02, 0x09, 0x7D, 0x65,
+    0x0E, 0x93, 0x5B, 0x92, 0x69, 0x34, 0x17, 0xA3, 0xB1, 0xAC, 0xE6, 0x9D, 0xD1, 0xCF, 0xFE, 0xAB,
+    0x77, 0x8C, 0x9B, 0x75, 0x26, 0x4B, 0xC3, 0x25, 0xF9, 0x61, 0x09, 0xE5, 0xB7, 0x55, 0xC0, 0x47,
+    0x2B, 0x00, 0x9A, 0x65, 0xC7, 0xCF, 0x53, 0x80, 0xA3, 0x5A, 0x4C, 0x76, 0xB8, 0xF0, 0x18, 0xD0,
+    0x11, 0xE2, 0xC8, 0xAA, 0x62, 0xA7, 0xC1, 0x14, 0x9D, 0xCD, 0xAA, 0x2A, 0xB6, 0x18, 0x3F, 0x20,
+    0xA1, 0x4B, 0xC8, 0x88, 0x41, 0x9D, 0x83, 0x6D, 0xA5, 0xCF, 0xF7, 0x11, 0x36, 0xE5, 0x66, 0x6D,
+    0xCD, 0xBD, 0x5A, 0x8B, 0xC6, 0xC6, 0xC4, 0x5E, 0xAD, 0x13, 0xF0, 0xE6, 0xCC, 0xE8, 0xFE, 0x62,
+    0x19, 0xAD, 0x86, 0xFA, 0xE5, 0x63, 0x3E, 0x1A, 0xDA, 0xCD, 0x1E, 0xFD, 0xFE, 0x38, 0xD9, 0x23,
+    0x4F, 0xAE, 0x3F, 0x95, 0x26, 0xD9, 0x62, 0x97, 0xD6, 0x4D, 0xEE, 0xE5, 0xAC, 0x9F, 0x69, 0x1B,
+    0xB0, 0x77, 0xD8, 0x36, 0x40, 0x52, 0xF0, 0x98, 0x1A, 0xB5, 0x4D, 0x08, 0xD4, 0x78, 0xD1, 0x29,
+    0x66, 0x28, 0xCD, 0xB9, 0xC0, 0x31, 0x87, 0xB7, 0xB2, 0xC3, 0xDB, 0x06, 0x3A, 0x10, 0x31, 0xE0,
+    0xBC, 0xDB, 0xDF, 0x4E, 0xBE, 0x2A, 0x53, 0x66, 0xB9, 0xEC, 0x5B, 0x99, 0xBD, 0x81, 0x9F, 0x0A,
+    0x9C, 0x2C, 0x09, 0x09, 0x2A, 0x70, 0x6B, 0x8E, 0x33, 0xF4, 0x7F, 0xD7, 0x5F, 0x9D, 0x55, 0xBB,
+    0xAE, 0xD4, 0x30, 0x10, 0x9D, 0x6C, 0x84, 0x52, 0xA4, 0x70, 0x75, 0x1B, 0x0A, 0xDC, 0xD3, 0xE4,
+    0x13, 0x1C, 0x89, 0x82, 0x12, 0x0A, 0x3E, 0x82, 0x8E, 0x4F, 0x48, 0x3A, 0x5A, 0x7A, 0x1A, 0x0A,
+    0x2A, 0x9A, 0xFB, 0x07, 0x24, 0x12, 0x05, 0x05, 0x05, 0x7B, 0xBF, 0x80, 0x08, 0x09, 0x89, 0x8E,
+    0x20, 0x22, 0x14, 0x20, 0xCE, 0x70, 0x66, 0xC6, 0xDE, 0x0B, 0x57, 0xBC, 0x84, 0xA5, 0x5D, 0xAF,
+    0xB3, 0x63, 0xFB, 0x9C, 0x33, 0x73, 0x26, 0x44, 0x74, 0x78, 0x4A, 0x44, 0x6E, 0xC4, 0xD7, 0x80,
+    0x4F, 0xB9, 0x50, 0xF1, 0xDE, 0x8F, 0xE4, 0x26, 0x26, 0x0A, 0xB7, 0x56, 0x3A, 0x6C, 0xF2, 0xF7,
+    0x84, 0xAF, 0xD0, 0xD2, 0x95, 0x55, 0xA1, 0xAB, 0x59, 0x56, 0x7D, 0x5A, 0xD5, 0xA7, 0x55, 0x3C,
+    0xAD, 0xE4, 0xEC, 0xFD, 0x2E, 0x51, 0xC5, 0x47, 0xA2, 0x06, 0xE7, 0x12, 0x4B, 0x28, 0x15, 0xBB,
+    0x6C, 0x5F, 0x52, 0x48, 0xC1, 0xC4, 0x54, 0x2F, 0xD5, 0x86, 0x55, 0x98, 0x0A, 0x2E, 0xB8, 0xAD,
+    0x57, 0x17, 0x29, 0x1C, 0xCF, 0xEE, 0x16, 0xB2, 0xA9, 0x5E, 0x25, 0xF2, 0xA8, 0x91, 0x58, 0xC9,
+    0x11, 0x61, 0xCA, 0xAB, 0x9D, 0xB9, 0x0D, 0xCC, 0x5B, 0xC1, 0xCC, 0x73, 0x8D, 0xAF, 0x1E, 0x2B,
+    0x40, 0x28, 0xB0, 0xA9, 0x5C, 0x95, 0x97, 0xA2, 0x11, 0xEC, 0xEE, 0x22, 0x52, 0xF3, 0x02, 0x27,
+    0x3F, 0xC4, 0x5D, 0x77, 0x36, 0x1A, 0xFC, 0x46, 0x7C, 0x76, 0x8F, 0xA2, 0x71, 0x10, 0x8E, 0xB2,
+    0xA5, 0xCA, 0x5B, 0xE4, 0xF3, 0x8E, 0xC8, 0x73, 0xAB, 0xE8, 0x83, 0x5C, 0x78, 0x75, 0xA8, 0x30,
+    0x3A, 0x4E, 0xFF, 0x2A, 0x6F, 0xCA, 0x0A, 0xC9, 0x28, 0x2F, 0x83, 0x5A, 0x9D, 0xAA, 0x55, 0xF8,
+    0xE8, 0x83, 0x3B, 0x4B, 0x0A, 0xFE, 0x14, 0xED, 0x07, 0x98, 0x58, 0x10, 0x2E, 0x4D, 0x41, 0x25,
+    0xAF, 0x69, 0x7F, 0xB7, 0xA7, 0x1F, 0x35, 0xF7, 0xF9, 0xC8, 0x29, 0xFD, 0xF0, 0x39, 0xA8, 0x3C,
+    0x41, 0xC9, 0x07, 0x50, 0x97, 0x11, 0x38, 0x1E, 0xAF, 0x9E, 0xC9, 0x39, 0x3C, 0xF0, 0x37, 0x8E,
+    0x16, 0x84, 0x31, 0x6A, 0x50, 0xC7, 0x96, 0x33, 0x7E, 0x25, 0xDA, 0x4A, 0xD0, 0x8C, 0x1F, 0x4B,
+    0x4E, 0x84, 0x4A, 0x90, 0xF1, 0xD2, 0x90, 0xAF, 0x6B, 0x96, 0x0C, 0xF3, 0x4B, 0x0E, 0x9A, 0xE8,
+    0x97, 0xE3, 0x86, 0xD1, 0x30, 0x5A, 0xA5, 0x6D, 0x6B, 0xC6, 0x7F, 0x7B, 0xE6, 0xC7, 0x1F, 0x84,
+    0x2F, 0x8D, 0x8E, 0xBF, 0x38, 0xEF, 0x55, 0xC3, 0xAF, 0xED, 0xB5, 0x73, 0xDE, 0x1F, 0x01, 0x1D,
+    0x9F, 0x0B, 0xAC, 0x33, 0x2D, 0xF3, 0x53, 0x2E, 0x24, 0xB1, 0xA2, 0x4B, 0x34, 0x06, 0xF3, 0x4F,
+    0xDA, 0xD4, 0x3A, 0x57, 0xCA, 0xA6, 0x9C, 0x2F, 0x6F, 0x3C, 0xAC, 0xF4, 0xE7, 0x81, 0xD4, 0xBB,
+    0x55, 0xF2, 0x5E, 0xEF, 0xC8, 0x31, 0xE4, 0x1B, 0x71, 0x5D, 0x81, 0xD3, 0x81, 0x71, 0x88, 0x34,
+    0xF4, 0xD0, 0xB8, 0x47, 0x90, 0xE7, 0x59, 0x82, 0x78, 0x43, 0x6D, 0x97, 0x3B, 0x97, 0x11, 0x41,
+    0x0F, 0x2E, 0x58, 0x64, 0x5E, 0x25, 0xE8, 0x23, 0xA3, 0x3E, 0xFC, 0xD6, 0xBD, 0x99, 0xC9, 0xED,
+    0x8E, 0xE5, 0xA4, 0x5B, 0x48, 0xCD, 0x81, 0x47, 0x49, 0x16, 0xCF, 0x0D, 0x52, 0xD1, 0xAD, 0xE2,
+    0xAB, 0x26, 0xCA, 0xF1, 0x8E, 0x29, 0x18, 0xB6, 0x52, 0x74, 0x6E, 0x32, 0x56, 0x55, 0x28, 0xFE,
+    0x16, 0x6E, 0xF1, 0x05, 0x97, 0xD5, 0x92, 0x6A, 0x98, 0xA6, 0x2D, 0xF8, 0x62, 0x87, 0xD9, 0xE0,
+    0x9C, 0x30, 0xD6, 0x13, 0x7C, 0x1C, 0xFA, 0x7A, 0x96, 0x69, 0xC4, 0xB4, 0xCB, 0xB4, 0xC2, 0x73,
+    0xE1, 0x98, 0x27, 0x78, 0xAE, 0x0D, 0x73, 0x2E, 0x03, 0x56, 0x57, 0x82, 0x5B, 0xB3, 0x92, 0x9F,
+    0x04, 0x11, 0x18, 0x56, 0x2A, 0xC0, 0x81, 0x97, 0x03, 0x12, 0xC7, 0xBB, 0x04, 0x75, 0x3C, 0x4A,
+    0x10, 0x38, 0x20, 0xE8, 0xDB, 0x86, 0x36, 0x50, 0xC5, 0xE1, 0xF6, 0x06, 0x86, 0xCD, 0x5B, 0x09,
+    0x7A, 0xB9, 0xA1, 0x9C, 0xBA, 0x8F, 0xDC, 0x01, 0xD4, 0x1A, 0x50, 0xDC, 0x2E, 0x3A, 0xD4, 0x5B,
+    0xCD, 0x25, 0x4B, 0xD0, 0x38, 0xEC, 0xD0, 0x6A, 0x12, 0x4F, 0x0E, 0x4B, 0x25, 0xC8, 0xB7, 0x4B,
+    0x07, 0xE0, 0x74, 0xCD, 0x53, 0xA3, 0x98, 0x5C, 0xBC, 0x34, 0x43, 0xAA, 0x51, 0x4B, 0xB0, 0xB9,
+    0x62, 0xD0, 0x5D, 0x37, 0x9F, 0xFC, 0xAC, 0x46, 0x03, 0x81, 0x4B, 0x29, 0xF0, 0x6E, 0xE9, 0x7A,
+    0x15, 0x83, 0xA9, 0xE9, 0xFD, 0xB1, 0x5C, 0xE1, 0xF4, 0xAE, 0x15, 0x2D, 0x2A, 0x79, 0x36, 0xF4,
+    0x7E, 0x76, 0xA0, 0xA5, 0x52, 0x34, 0x73, 0x15, 0x71, 0xCF, 0x30, 0x26, 0x67, 0x8D, 0x06, 0xA4,
+    0xDE, 0xD3, 0x95, 0xE2, 0x4C, 0xC5, 0x21, 0x77, 0xA2, 0xE9, 0x50, 0xF1, 0xCC, 0x2C, 0x73, 0x46,
+    0xD7, 0xB4, 0xB9, 0x56, 0x92, 0x2C, 0xF7, 0x39, 0x9A, 0x0B, 0xAD, 0x0B, 0xA8, 0x31, 0x9C, 0x51,
+    0xBB, 0xFF, 0x97, 0xBA, 0xD3, 0x56, 0x83, 0x1D, 0xD8, 0x6A, 0xF2, 0x5B, 0xE5, 0x89, 0xED, 0x21,
+    0x76, 0xCD, 0x47, 0xE9, 0xA1, 0xA6, 0xBF, 0x95, 0x1E, 0x5C, 0x21, 0x29, 0x09, 0x1F, 0x66, 0x14,
+    0x9A, 0x25, 0x20, 0xD5, 0x9E, 0xDB, 0xBA, 0xD7, 0x78, 0x17, 0xF0, 0xCB, 0x28, 0x19, 0xD5, 0x0C,
+    0x58, 0xF1, 0xD1, 0x30, 0x07, 0x90, 0x71, 0x7C, 0x40, 0x3D, 0xA6, 0x14, 0x58, 0xF5, 0xE1, 0x32,
+    0xA7, 0xC6, 0xBC, 0xDE, 0x1F, 0x9E, 0x88, 0x09, 0xC4, 0x69, 0xE1, 0xC3, 0x74, 0xF2, 0x97, 0x09,
+    0x63, 0xBD, 0xFF, 0xD1, 0x5F, 0x98, 0xF8, 0xC7, 0xA2, 0xC5, 0x20, 0x5D, 0x47, 0xF3, 0x40, 0x3E,
+    0x82, 0x8F, 0xE8, 0xDD, 0x8B, 0x77, 0x9F, 0xE3, 0xC1, 0x51, 0xBC, 0x3E, 0x60, 0x96, 0x07, 0xB8,
+    0xCB, 0x4F, 0xC2, 0x55, 0x32, 0x42, 0xA5, 0x9A, 0xCC, 0xCF, 0xA5, 0xE0, 0x1D, 0xFD, 0x42, 0x39,
+    0x2D, 0x37, 0x53, 0xBB, 0xCC, 0x7D, 0xB7, 0x49, 0xBD, 0xD9, 0xA7, 0xD9, 0x25, 0x6B, 0xBB, 0x8D,
+    0xFE, 0x63, 0x68, 0xE9, 0x50, 0xC6, 0xAD, 0x49, 0xB4, 0x82, 0x33, 0xF0, 0x64, 0xB6, 0xB2, 0xEE,
+    0xF3, 0x5C, 0x37, 0x44, 0x7D, 0x59, 0x26, 0x1A, 0xDA, 0x39, 0xF4, 0x9D, 0x99, 0xB8, 0xE8, 0x06,
+    0xAD, 0x03, 0x23, 0xA4, 0x6F, 0x3B, 0x83, 0xAE, 0xAC, 0xB4, 0x0F, 0xD7, 0xFF, 0x05, 0xD5, 0xC6,
+    0x77, 0xBD, 0x95, 0x3D, 0x8E, 0xD4, 0x40, 0x10, 0x85, 0xAB, 0x6D, 0x76, 0x2D, 0xE1, 0xA0, 0xA3,
+    0x25, 0x41, 0xC2, 0x47, 0xF0, 0x11, 0x7A, 0x32, 0x52, 0x02, 0x88, 0xB8, 0x01, 0xC9, 0x1E, 0xC1,
+    0xE6, 0x06, 0x9B, 0x90, 0x93, 0x80, 0x60, 0x92, 0x3D, 0x01, 0xB2, 0x33, 0x52, 0x1F, 0xC1, 0x42,
+    0x10, 0x40, 0x64, 0x90, 0x91, 0xBC, 0x8B, 0xED, 0xE2, 0xBD, 0x6A, 0xAF, 0x76, 0x40, 0x03, 0x22,
+    0xA2, 0x83, 0x9E, 0x19, 0xBB, 0xBA, 0xFA, 0xD5, 0x57, 0x3F, 0x23, 0x82, 0xA5, 0x22, 0xA1, 0x97,
+    0xD0, 0x4A, 0x39, 0x49, 0xD1, 0x8B, 0x57, 0xF1, 0x83, 0x64, 0xDA, 0xA6, 0xB3, 0x24, 0x3A, 0x26,
+    0x2B, 0x2C, 0x56, 0x1A, 0x55, 0xDA, 0xD2, 0x48, 0x87, 0x12, 0x46, 0x3F, 0x66, 0x3F, 0x4A, 0xB6,
+    0x34, 0x0F, 0x67, 0x49, 0xB5, 0xFC, 0x40, 0xA3, 0xF7, 0xB3, 0xEE, 0xA4, 0xFA, 0xAA, 0x55, 0x2B,
+    0x61, 0x0A, 0x0A, 0xA3, 0xC5, 0xEB, 0x28, 0xB9, 0xA6, 0x4A, 0xA3, 0xB6, 0x59, 0xC5, 0x69, 0x5F,
+    0xC0, 0xA8, 0x19, 0xE1, 0x5E, 0xC2, 0x2C, 0x30, 0xC2, 0xAA, 0x46, 0x6C, 0x27, 0xD5, 0x8C, 0x3D,
+    0xC3, 0x55, 0x02, 0x63, 0x35, 0x61, 0xFC, 0x7E, 0xB0, 0xDC, 0x55, 0x53, 0xE3, 0x7E, 0xE5, 0xFB,
+    0x11, 0xA7, 0xAA, 0x3A, 0x9F, 0xDC, 0x04, 0x69, 0x65, 0x5D, 0x74, 0xE9, 0x94, 0xCC, 0x52, 0xED,
+    0x42, 0x9B, 0x0F, 0x19, 0x9F, 0x35, 0x75, 0x31, 0x78, 0xA8, 0x77, 0x2A, 0xA1, 0x2B, 0x87, 0x6C,
+    0x49, 0xF1, 0xAC, 0x15, 0xF1, 0xB8, 0x26, 0x40, 0x43, 0xA6, 0x03, 0x6E, 0xC0, 0x0F, 0xF7, 0xC8,
+    0x9C, 0x9F, 0xED, 0x17, 0xE1, 0x1B, 0xBC, 0xE2, 0x1D, 0x10, 0xF6, 0x60, 0xFF, 0xEA, 0x91, 0xFC,
+    0x79, 0xB9, 0x66, 0x32, 0xC1, 0xDA, 0x09, 0x62, 0xA4, 0x56, 0xAF, 0xAF, 0xF1, 0xC3, 0xAF, 0x52,
+    0x4C, 0x92, 0xAF, 0x80, 0x27, 0x19, 0x9E, 0x56, 0x1D, 0x6E, 0x16, 0x3F, 0x3A, 0x78, 0x4E, 0x17,
+    0xD3, 0xA0, 0x3B, 0x00, 0x97, 0xAA, 0x2D, 0x20, 0xA1, 0x18, 0x72, 0x88, 0xF0, 0x13, 0xAC, 0xF9,
+    0x5A, 0x6B, 0x44, 0x27, 0x61, 0xC0, 0xE9, 0xDA, 0xEB, 0xC5, 0x53, 0xC5, 0x69, 0xAC, 0x41, 0xB8,
+    0x8F, 0x54, 0xA6, 0x13, 0xE3, 0xC7, 0x4E, 0xB1, 0x23, 0x75, 0xE8, 0xC5, 0x6F, 0xCA, 0x9E, 0x35,
+    0x1D, 0x5F, 0xD6, 0x09, 0x65, 0xDD, 0xDD, 0xBF, 0x38, 0x1A, 0xC6, 0xE9, 0x8A, 0x48, 0x61, 0x24,
+    0x05, 0x63, 0xD6, 0xE7, 0x48, 0xFB, 0x08, 0x84, 0xA1, 0xCE, 0x07, 0x7C, 0x94, 0xAD, 0xEF, 0x41,
+    0x31, 0xD4, 0xD9, 0xE4, 0x16, 0x14, 0x47, 0x36, 0x67, 0x4A, 0xCB, 0xD1, 0x1C, 0xE3, 0xDC, 0x1C,
+    0x0F, 0x4B, 0xD3, 0x1F, 0xF8, 0xF4, 0x6D, 0xD1, 0x1A, 0x13, 0x3E, 0xA4, 0x6A, 0xC4, 0x17, 0x73,
+    0xFC, 0x6C, 0x77, 0x9C, 0xE2, 0x39, 0x73, 0xEC, 0x2C, 0x10, 0xA8, 0xB5, 0xE8, 0x3F, 0x37, 0x23,
+    0xF6, 0x3A, 0x23, 0xC1, 0x1A, 0xBC, 0x1C, 0x35, 0x8E, 0x82, 0x8A, 0x01, 0x9F, 0xAA, 0x23, 0xBE,
+    0x12, 0x9E, 0x43, 0xE7, 0x27, 0xE2, 0xCB, 0xA0, 0x24, 0x9B, 0x0D, 0xDF, 0x7A, 0x40, 0x57, 0x5B,
+    0x66, 0xBA, 0xE9, 0x53, 0xFD, 0x78, 0x0F, 0xDE, 0x89, 0x6F, 0xA6, 0x76, 0x5D, 0x98, 0x2D, 0xA6,
+    0x4B, 0xB7, 0xA4, 0x29, 0x13, 0x7F, 0xAE, 0x1F, 0x7F, 0x97, 0x36, 0x3B, 0x8B, 0x71, 0xDA, 0x22,
+    0x41, 0xF9, 0x03, 0xDA, 0x9B, 0x23, 0x75, 0x70, 0x41, 0x2F, 0x13, 0x2D, 0xE0, 0x89, 0x20, 0x99,
+    0x66, 0x49, 0x27, 0x6C, 0xF9, 0x80, 0xCD, 0x48, 0xFA, 0xDE, 0xA1, 0x30, 0x3A, 0x34, 0x55, 0x31,
+    0x14, 0x73, 0x44, 0xE9, 0x09, 0x0A, 0x1B, 0x22, 0xB3, 0x5A, 0xDF, 0x58, 0x9E, 0x89, 0x3C, 0x86,
+    0xDF, 0x55, 0x62, 0x68, 0x12, 0xCB, 0xC4, 0x42, 0x6F, 0x3A, 0x96, 0xD1, 0xDF, 0x0A, 0x32, 0xA6,
+    0x13, 0x96, 0x96, 0x84, 0x48, 0x73, 0xAB, 0x49, 0x36, 0x38, 0x8B, 0xAD, 0xEA, 0xD1, 0xB9, 0xB2,
+    0x01, 0xDD, 0xCA, 0x72, 0x2B, 0x3F, 0x20, 0xE4, 0x8D, 0xDB, 0xC5, 0xB1, 0x32, 0xE3, 0xC7, 0xC8,
+    0x6F, 0x2C, 0xCC, 0x88, 0x55, 0x62, 0x71, 0x52, 0x3D, 0xF5, 0xDB, 0xC7, 0xEE, 0x86, 0xEC, 0x56,
+    0x9F, 0x24, 0x0C, 0xCD, 0x72, 0x5F, 0xAF, 0x0E, 0x75, 0x3E, 0x66, 0xCB, 0x21, 0x9E, 0x80, 0xCC,
+    0x5A, 0x78, 0xE8, 0x65, 0x86, 0x95, 0xAD, 0x47, 0x83, 0xBA, 0xB0, 0xB6, 0xEC, 0x6F, 0x5A, 0x2D,
+    0xF4, 0x55, 0x1B, 0x01, 0x03, 0x69, 0x42, 0x2D, 0x84, 0x0C, 0xD8, 0x98, 0x4D, 0xC6, 0x18, 0x43,
+    0x00, 0xF3, 0xCB, 0xA9, 0x83, 0xAC, 0xCC, 0x92, 0x6B, 0x98, 0x99, 0xFB, 0x1B, 0x4F, 0x04, 0xB1,
+    0x11, 0x3B, 0x7B, 0xB2, 0x7F, 0xC9, 0xCC, 0xDD, 0xEA, 0x8F, 0xA5, 0x7D, 0x7D, 0x1E, 0xE3, 0x02,
+    0x38, 0x96, 0x07, 0x23, 0x66, 0xD1, 0x59, 0x47, 0x37, 0x0C, 0x0A, 0x24, 0x52, 0x82, 0x26, 0x3F,
+    0x4F, 0x13, 0x23, 0xBB, 0xBE, 0xB3, 0x61, 0x9A, 0x30, 0xBB, 0x4E, 0x25, 0x26, 0x37, 0xB7, 0x91,
+    0x83, 0x83, 0x18, 0x9C, 0xCE, 0x88, 0x18, 0x31, 0x1B, 0x74, 0x3B, 0x8E, 0x41, 0xDA, 0x7D, 0xBA,
+    0xB4, 0x37, 0xAC, 0x50, 0xDD, 0xBF, 0x35, 0x76, 0x26, 0x25, 0x89, 0x5F, 0x06, 0x83, 0xAA, 0xB1,
+    0x56, 0x34, 0x62, 0x46, 0xE7, 0x6F, 0xA0, 0x0F, 0x68, 0xE5, 0x57, 0x74, 0xF2, 0x0D, 0xEF, 0x11,
+    0xBC, 0x5E, 0x2F, 0x04, 0xB6, 0xCA, 0x44, 0x62, 0xDD, 0xD3, 0x01, 0xC8, 0xE8, 0xA3, 0xB1, 0x48,
+    0x09, 0x0D, 0x57, 0x80, 0x9A, 0x7E, 0x79, 0x42, 0x6C, 0x9C, 0x26, 0xE0, 0xD6, 0xCB, 0x1D, 0x9E,
+    0xFD, 0x7E, 0xDA, 0xFB, 0xC8, 0xC5, 0x44, 0xC1, 0x93, 0x7E, 0xA0, 0x90, 0x72, 0x72, 0xCD, 0x6D,
+    0x42, 0xD3, 0xDE, 0xFA, 0x9E, 0x50, 0x59, 0x76, 0x15, 0x9F, 0x2D, 0xBF, 0xA4, 0x50, 0x31, 0x68,
+    0x92, 0x2D, 0x02, 0xCC, 0xAE, 0x01, 0x6D, 0x95, 0x73, 0xB3, 0xF4, 0x79, 0x0C, 0x6E, 0x0C, 0x9B,
+    0x0C, 0x73, 0xA5, 0x05, 0xE0, 0xC0, 0x1C, 0x37, 0x36, 0x90, 0xAC, 0x99, 0x90, 0xB3, 0x44, 0x3B,
+    0x4E, 0x7C, 0xB4, 0x35, 0xB7, 0x1A, 0x83, 0x15, 0x93, 0x71, 0xC1, 0x68, 0x28, 0x30, 0xD2, 0xDB,
+    0x72, 0xC6, 0x16, 0x66, 0xFE, 0x9F, 0xDC, 0xAE, 0x12, 0x71, 0x8C, 0x51, 0x15, 0xE0, 0xE6, 0xB1,
+    0xAB, 0xD2, 0xAB, 0x05, 0xBD, 0x31, 0xC2, 0x3B, 0x46, 0xEA, 0x97, 0x1D, 0xAB, 0x19, 0x95, 0xC4,
+    0x0A, 0xF2, 0xEC, 0xEE, 0x5A, 0x92, 0xC5, 0xCA, 0x9C, 0x4F, 0x6D, 0x62, 0xB3, 0xB6, 0x30, 0x87,
+    0x2F, 0xEB, 0x5B, 0xC7, 0x96, 0xAB, 0xC0, 0xBF, 0xAB, 0x8A, 0xC5, 0xD0, 0x6C, 0xB9, 0x8C, 0x95,
+    0x60, 0xF5, 0xCB, 0x53, 0x72, 0x72, 0x64, 0xE0, 0xFE, 0x7F, 0x0A, 0xFF, 0xB0, 0x7E, 0x02, 0xBD,
+    0x55, 0x21, 0xB2, 0xDC, 0x56, 0x10, 0x6C, 0xE9, 0x39, 0x51, 0xD5, 0x17, 0x78, 0x21, 0x21, 0x36,
+    0x10, 0x37, 0xD1, 0x11, 0xA4, 0x23, 0x04, 0xC4, 0x37, 0x08, 0x09, 0x48, 0xFD, 0x0B, 0x24, 0x91,
+    0x8E, 0xF0, 0x89, 0xB1, 0x0D, 0x4C, 0x8C, 0x4C, 0x02, 0x5D, 0x96, 0x8E, 0xA0, 0x9C, 0xC0, 0x02,
+    0x4E, 0x05, 0x84, 0x08, 0xA8, 0x52, 0xFA, 0x29, 0xAD, 0x26, 0xDD, 0xF3, 0x76, 0xEB, 0xEF, 0x4F,
+    0x19, 0x05, 0xF8, 0x81, 0x59, 0xED, 0x2B, 0xCD, 0xF4, 0x4C, 0x4F, 0xCF, 0x08, 0xE0, 0xC9, 0x6C,
+    0x46, 0x69, 0x40, 0xB3, 0x02, 0x36, 0xA2, 0x3C, 0x01, 0xDD, 0x8C, 0xC0, 0x9B, 0x7A, 0x03, 0x5E,
+    0xB4, 0xB8, 0x9C, 0xF8, 0xE7, 0x8A, 0xCE, 0xA6, 0xDC, 0xAC, 0x8D, 0xF6, 0x16, 0xCD, 0x4C, 0x57,
+    0xA0, 0x5C, 0xE8, 0x3A, 0x22, 0x3B, 0xF8, 0xC8, 0x08, 0xCD, 0xE4, 0xB7, 0x71, 0xE7, 0xE3, 0x82,
+    0x9C, 0x01, 0x6F, 0x3E, 0xC8, 0xF9, 0x69, 0x9B, 0xBF, 0xE6, 0x55, 0xDF, 0x31, 0x5E, 0xF3, 0x91,
+    0x3E, 0xE8, 0x0E, 0xDD, 0x0F, 0x93, 0xEC, 0xC9, 0x13, 0xB9, 0xC3, 0x67, 0x4E, 0xB4, 0x4F, 0x7A,
+    0xCD, 0x18, 0x30, 0x98, 0x31, 0xA3, 0x38, 0x16, 0x74, 0x1F, 0x50, 0x8D, 0x08, 0x1B, 0x7F, 0x11,
+    0x27, 0xFE, 0xEA, 0x62, 0x42, 0xD8, 0x73, 0x81, 0x9B, 0xAD, 0x72, 0xB1, 0x56, 0x2E, 0xAB, 0x5F,
+    0xC8, 0x65, 0x65, 0x9E, 0xAC, 0x8B, 0xD7, 0x71, 0x0F, 0x44, 0x1F, 0xE6, 0xB8, 0xF1, 0xA2, 0x1D,
+    0x66, 0x54, 0xA7, 0xC0, 0x54, 0x87, 0x25, 0x1A, 0x2F, 0xC6, 0x6E, 0xBF, 0xA0, 0x7F, 0x8B, 0xAC,
+    0xCD, 0xF7, 0x7C, 0x43, 0xFC, 0x9B, 0x0E, 0x0D, 0x5D, 0x33, 0xBE, 0x87, 0xA8, 0x02, 0x7E, 0xBE,
+    0x4E, 0xF3, 0x60, 0x61, 0x15, 0xB1, 0xC4, 0x0E, 0x9A, 0xE3, 0x0D, 0x04, 0x80, 0x6E, 0x4C, 0x04,
+    0x81, 0x59, 0xA1, 0x9A, 0x81, 0x5C, 0x95, 0x92, 0x23, 0x14, 0x82, 0xF0, 0x50, 0x7C, 0x10, 0x4D,
+    0x78, 0xBE, 0x5D, 0xC7, 0x6B, 0x64, 0x6A, 0x91, 0xCF, 0x3A, 0x55, 0xB4, 0xCC, 0xFC, 0x88, 0x99,
+    0x7C, 0xB8, 0x67, 0x74, 0xB3, 0x49, 0xF5, 0xCD, 0x34, 0x7F, 0x2D, 0x28, 0x84, 0xEA, 0xD0, 0xEA,
+    0x42, 0x4A, 0x00, 0xB5, 0x40, 0x0B, 0xD3, 0xAD, 0x89, 0xC7, 0x28, 0x1F, 0xB6, 0x52, 0x29, 0xDC,
+    0x5A, 0xAF, 0x6B, 0xE5, 0xC8, 0x4C, 0x56, 0x94, 0x07, 0xEC, 0x53, 0x65, 0xAD, 0xF1, 0xF4, 0x6E,
+    0x6A, 0x53, 0x49, 0xB7, 0xDE, 0x06, 0xE0, 0x3D, 0x23, 0x93, 0xD1, 0xB0, 0x88, 0x77, 0x86, 0xEE,
+    0x1F, 0xD2, 0xE1, 0x1B, 0x15, 0x63, 0x36, 0x2F, 0x7F, 0xC3, 0xAF, 0xFC, 0xFF, 0x8B, 0xE0, 0xD5,
+    0xED, 0x43, 0x88, 0x92, 0x05, 0x7D, 0x4A, 0x16, 0x59, 0xEE, 0x61, 0xAA, 0x36, 0xF5, 0xA4, 0x61,
+    0xDE, 0x1D, 0xA3, 0x7F, 0x7D, 0x0E, 0xAE, 0x5C, 0xDD, 0x7A, 0xEE, 0x65, 0xAA, 0x80, 0xE0, 0x6C,
+    0xF4, 0xA0, 0x48, 0xFD, 0x15, 0xDC, 0xC3, 0xB9, 0x91, 0x77, 0xEE, 0x8D, 0x66, 0xC0, 0x9E, 0x0D,
+    0xFC, 0x87, 0x95, 0x55, 0x4E, 0xA7, 0x57, 0xE7, 0x5C, 0xA3, 0x5A, 0x5C, 0x6F, 0xAB, 0x73, 0xA3,
+    0xFB, 0xE0, 0xAA, 0x48, 0x0A, 0xC9, 0xFC, 0x19, 0xCF, 0x4C, 0x14, 0x4B, 0x0A, 0xB2, 0x08, 0x93,
+    0x66, 0xA0, 0xB9, 0x2F, 0x6C, 0xE2, 0x6B, 0x24, 0x90, 0xF1, 0xF9, 0x06, 0x95, 0x75, 0xD2, 0xBB,
+    0xF7, 0x0F, 0x39, 0xBC, 0x97, 0x83, 0x60, 0x9A, 0x93, 0x72, 0xA1, 0xA9, 0x7E, 0x3F, 0xA4, 0xEB,
+    0xEE, 0x2A, 0xD1, 0xD2, 0xEE, 0x04, 0x34, 0x22, 0xFE, 0xF1, 0x13, 0x9C, 0x23, 0x51, 0x89, 0x62,
+    0x75, 0x99, 0xF7, 0x89, 0x26, 0x36, 0x4A, 0xE8, 0x43, 0xAF, 0x38, 0x10, 0x53, 0x42, 0x1D, 0x83,
+    0xE0, 0x2B, 0x35, 0xEE, 0x8A, 0xAC, 0x2F, 0x25, 0x81, 0x4E, 0x12, 0xC8, 0x06, 0x01, 0x17, 0x9A,
+    0xD7, 0xA0, 0x68, 0xD9, 0x2B, 0x77, 0xD3, 0xFF, 0x46, 0xAC, 0xDD, 0xB4, 0xFF, 0x53, 0x09, 0xAC,
+    0x6A, 0x21, 0xC2, 0xFC, 0x8C, 0x20, 0x81, 0xAE, 0xE5, 0x98, 0xA4, 0x5E, 0x91, 0x97, 0x6F, 0x56,
+    0xDF, 0x23, 0xE8, 0x08, 0xF3, 0xA3, 0x07, 0xCF, 0xBE, 0xC3, 0xF7, 0x84, 0xD8, 0x35, 0xF3, 0xB0,
+    0x5B, 0x87, 0xF7, 0x3A, 0x2B, 0xEF, 0xB2, 0x4F, 0x26, 0x8A, 0xCF, 0xE9, 0xE4, 0x4C, 0x17, 0x6A,
+    0xE9, 0x19, 0xE2, 0xF3, 0x2C, 0x15, 0x67, 0x0C, 0x71, 0x7B, 0x50, 0x49, 0xB2, 0x4E, 0x1A, 0x2B,
+    0xD9, 0xBC, 0x3F, 0x6A, 0x4B, 0x12, 0xCB, 0x99, 0xB7, 0x6C, 0x48, 0x7E, 0x8E, 0xAE, 0x7D, 0xE9,
+    0xD4, 0x05, 0xBB, 0xEB, 0x4E, 0x7A, 0xDD, 0xB6, 0xB3, 0x5C, 0xD2, 0x00, 0x91, 0x3E, 0xED, 0x37,
+    0x6E, 0xC1, 0xB7, 0xC8, 0x4E, 0xEA, 0xF9, 0x30, 0x8C, 0x89, 0x93, 0x04, 0x5D, 0x8A, 0xC4, 0xBC,
+    0x7D, 0x94, 0xAF, 0x18, 0x17, 0x93, 0x4E, 0xA5, 0x73, 0xE9, 0x64, 0x3A, 0x9B, 0x67, 0x57, 0x35,
+    0xC0, 0x09, 0x75, 0x46, 0x49, 0x69, 0xD2, 0x8C, 0xAF, 0x3C, 0xCD, 0x17, 0x34, 0x60, 0x57, 0xA2,
+    0xF9, 0xEA, 0x05, 0x8F, 0x52, 0x3A, 0x94, 0xDD, 0x49, 0x66, 0x57, 0x7F, 0x77, 0xE4, 0xC7, 0xA5,
+    0xB5, 0x3E, 0x30, 0xE5, 0x7E, 0xC9, 0x2C, 0xAA, 0xE6, 0x5A, 0x10, 0xCD, 0x72, 0xE9, 0xB6, 0x1A,
+    0x02, 0x15, 0xE0, 0x4B, 0x2C, 0x33, 0x97, 0x6B, 0x9B, 0x78, 0x48, 0xC6, 0xC7, 0x37, 0xF3, 0x79,
+    0x5A, 0x2E, 0xE1, 0x9E, 0x68, 0x67, 0x3E, 0xD5, 0x53, 0xBD, 0x9E, 0x17, 0x61, 0x3A, 0xDC, 0xFD,
+    0xD9, 0xEE, 0x1F, 0x12, 0xF5, 0xB5, 0xF3, 0x79, 0x64, 0x6A, 0xAA, 0x42, 0x63, 0xD5, 0xF4, 0x3E,
+    0x25, 0x43, 0x12, 0x06, 0x53, 0xAC, 0xB5, 0xC9, 0xA9, 0x30, 0x1B, 0x8B, 0xF4, 0x53, 0x32, 0x81,
+    0xC3, 0xC3, 0xE6, 0xEF, 0x5A, 0x74, 0x4B, 0x62, 0xC3, 0x4F, 0xD8, 0x72, 0x86, 0x30, 0xAD, 0x5F,
+    0x5F, 0x26, 0xF5, 0x7E, 0xD1, 0x89, 0x94, 0xF6, 0xF8, 0x7C, 0x59, 0x76, 0x74, 0x3E, 0x5C, 0xBE,
+    0x7F, 0xAA, 0xDF, 0x77, 0xC8, 0x0F, 0x61, 0x45, 0xB1, 0xF0, 0xB3, 0x11, 0x97, 0x9B, 0xD7, 0x69,
+    0xE9, 0xEB, 0x1B, 0x50, 0xF8, 0xE6, 0x90, 0x69, 0x5C, 0x8B, 0x1E, 0xC0, 0xC7, 0x5C, 0xDE, 0xB9,
+    0x7B, 0x2B, 0x9F, 0xA0, 0x7C, 0xFC, 0xA3, 0x13, 0x25, 0x8B, 0xFF, 0x98, 0x47, 0xE7, 0x5F, 0xD5,
+    0x95, 0x3D, 0x6E, 0xD5, 0x40, 0x14, 0x85, 0x8F, 0x6D, 0x3D, 0x5C, 0xB8, 0x98, 0x8A, 0x02, 0x1A,
+    0xB7, 0x74, 0x5E, 0x01, 0x1A, 0x8B, 0x15, 0xA4, 0x00, 0x16, 0x41, 0x93, 0x15, 0x44, 0xF6, 0x52,
+    0x28, 0xB2, 0x0C, 0x84, 0x2D, 0xD8, 0x80, 0x97, 0xE0, 0x8E, 0x32, 0x2E, 0x5C, 0x18, 0x64, 0xFB,
+    0x72, 0xCE, 0xF5, 0x0B, 0x45, 0x12, 0x11, 0x9A, 0x48, 0x64, 0xF4, 0x74, 0x73, 0x35, 0x19, 0xDF,
+    0x9F, 0x6F, 0xCE, 0xCC, 0x9C, 0x3E, 0x70, 0x54, 0x66, 0xB6, 0x47, 0x9A, 0x4D, 0x66, 0x6D, 0x64,
+    0x90, 0xED, 0x00, 0xB2, 0x8D, 0x26, 0x5F, 0x69, 0x0A, 0x99, 0xB0, 0x00, 0x5C, 0x3C, 0x21, 0x9E,
+    0xCD, 0x00, 0xC4, 0x91, 0xFF, 0x68, 0xE8, 0xC0, 0xFA, 0xB3, 0x49, 0xAC, 0x05, 0x52, 0xAB, 0xF9,
+    0xBD, 0xE1, 0x6C, 0x0A, 0x99, 0x63, 0xBC, 0x62, 0xC8, 0x89, 0x1F, 0x72, 0xE5, 0xEE, 0x6E, 0x6E,
+    0xD6, 0x33, 0x58, 0xA6, 0xB4, 0xB1, 0x4F, 0x99, 0x3E, 0xD0, 0xF5, 0xF0, 0x5A, 0x30, 0x33, 0x29,
+    0xD7, 0x9A, 0x31, 0xD2, 0x8A, 0xE0, 0x99, 0x95, 0xEA, 0xE4, 0xD1, 0xE2, 0x77, 0xF9, 0xDD, 0x0F,
+    0x55, 0xF0, 0xD3, 0xB3, 0x4F, 0xCA, 0x8C, 0xCF, 0x6F, 0xF0, 0xC8, 0xA8, 0x56, 0x94, 0x4C, 0xB8,
+    0xC8, 0x89, 0x93, 0x9C, 0x66, 0x92, 0xD3, 0x8D, 0x72, 0x98, 0x9C, 0x0E, 0x03, 0xEA, 0xD7, 0xD2,
+    0x26, 0x56, 0xB3, 0xB1, 0xD4, 0xD4, 0x19, 0xE1, 0xB0, 0x2B, 0xD2, 0xA1, 0x43, 0x3C, 0xF9, 0x26,
+    0x3E, 0xC1, 0x7F, 0xD5, 0xC2, 0x12, 0x6F, 0x6C, 0xA6, 0x15, 0x24, 0xD9, 0xC1, 0x6D, 0x4F, 0x06,
+    0xEC, 0x81, 0x74, 0x6C, 0xB9, 0x5B, 0xCA, 0x55, 0x20, 0x43, 0x36, 0x12, 0xF9, 0x45, 0x59, 0xCE,
+    0xC8, 0xBF, 0xCD, 0xF7, 0xCA, 0x4D, 0x18, 0xBB, 0xFF, 0x8A, 0x30, 0xC6, 0x3A, 0x9F, 0xC3, 0x90,
+    0xAE, 0x19, 0x8B, 0xE4, 0x64, 0x6C, 0x3B, 0x54, 0x63, 0xD5, 0x06, 0x4E, 0xE6, 0x6B, 0x36, 0xB3,
+    0x30, 0x7B, 0x67, 0xAD, 0xF0, 0x31, 0xED, 0xE4, 0x54, 0x3B, 0xDB, 0xF1, 0x62, 0x3F, 0xC7, 0xF9,
+    0x78, 0xAD, 0xDD, 0x51, 0x11, 0xB9, 0xDB, 0x60, 0xBF, 0xAE, 0xF1, 0x2F, 0xE3, 0x3F, 0x02, 0x06,
+    0xD4, 0xB8, 0xB4, 0x0D, 0xA5, 0xD9, 0xC8, 0x0E, 0x77, 0xBC, 0xAC, 0x1F, 0xAA, 0xB8, 0x41, 0x31,
+    0x15, 0x23, 0x55, 0xC4, 0x95, 0x83, 0x98, 0x41, 0x0A, 0x2B, 0xFB, 0x6C, 0xA1, 0xDB, 0xB5, 0x82,
+    0x96, 0xCD, 0x89, 0x21, 0xD6, 0x71, 0xCA, 0xB6, 0x62, 0x77, 0x4D, 0x1F, 0x3A, 0x64, 0x7E, 0x87,
+    0x74, 0x8B, 0x6D, 0xC5, 0x17, 0xC9, 0xFB, 0x46, 0xE7, 0xC0, 0x4C, 0xDB, 0xD3, 0x48, 0xFE, 0x28,
+    0xB6, 0x67, 0x85, 0x8D, 0xDB, 0xCD, 0xFE, 0x59, 0xFB, 0xAE, 0x36, 0x26, 0xAE, 0x52, 0x7F, 0x9F,
+    0xEE, 0xD2, 0x2B, 0x7B, 0x02, 0x92, 0xD8, 0xB2, 0x19, 0x4D, 0xED, 0xE4, 0x22, 0xC2, 0xE4, 0x72,
+    0x2B, 0xA6, 0x74, 0x87, 0xD0, 0x91, 0x6A, 0xD3, 0xBB, 0xE0, 0xC2, 0xCC, 0x72, 0xFC, 0xC0, 0x9A,
+    0x1F, 0x53, 0x02, 0x64, 0x11, 0xE3, 0x1F, 0x78, 0xA9, 0xCB, 0xD9, 0xEF, 0x10, 0x84, 0x2B, 0x4F,
+    0x70, 0xF8, 0x5E, 0x61, 0x3E, 0xE2, 0xB9, 0xE9, 0xAF, 0xE0, 0xD6, 0x57, 0xBC, 0xC4, 0xDE, 0xB2,
+    0xB1, 0x2F, 0xFC, 0xDB, 0xE9, 0x42, 0xE3, 0xDC, 0xEB, 0x7B, 0x45, 0xF3, 0x7E, 0xEB, 0x24, 0xC1,
+    0x30, 0x24, 0x9B, 0x38, 0x86, 0x3E, 0x5B, 0x25, 0xC0, 0xAA, 0x2F, 0x16, 0x41, 0x8C, 0x75, 0x39,
+    0x49, 0x7E, 0x71, 0xE8, 0x46, 0x11, 0x8C, 0xC7, 0x65, 0xD8, 0xF3, 0x9E, 0x6D, 0x0F, 0x7C, 0x19,
+    0x61, 0xCE, 0x1E, 0xBE, 0xAB, 0x55, 0xBF, 0xA0, 0xB1, 0x6B, 0xD6, 0x97, 0xBC, 0xC7, 0xE9, 0xE2,
+    0xAF, 0xC8, 0x58, 0x17, 0xD1, 0x64, 0xC2, 0xD0, 0x7B, 0xBF, 0x8C, 0x78, 0x40, 0x4B, 0xAD, 0x4D,
+    0x34, 0x47, 0x12, 0xBB, 0xC7, 0xE3, 0xEF, 0xE0, 0x26, 0x3A, 0xF9, 0xEE, 0xFD, 0x55, 0xF3, 0xED,
+    0xDC, 0x81, 0x0E, 0x25, 0xEF, 0x27, 0xCE, 0x75, 0x4E, 0x99, 0x44, 0xF5, 0xED, 0x41, 0x4F, 0xDB,
+    0x6F, 0x7E, 0x4D, 0xF3, 0x58, 0x4A, 0x02, 0x64, 0x79, 0x06, 0xA8, 0x7B, 0xE6, 0xFE, 0x16, 0x27,
+    0x17, 0x38, 0xD5, 0x89, 0x6F, 0x47, 0xC3, 0xBD, 0x52, 0xE8, 0x66, 0xE0, 0x69, 0x2A, 0xE7, 0x07,
+    0x19, 0xC2, 0xE5, 0x08, 0x61, 0x04, 0x85, 0xC7, 0x17, 0x41, 0x24, 0xE1, 0x8A, 0x84, 0x60, 0x22,
+    0x5D, 0xC0, 0x9B, 0x5F, 0x3C, 0xE1, 0xA2, 0x84, 0x90, 0xAA, 0x92, 0xCD, 0x8B, 0xEB, 0x0F, 0x5D,
+    0xEA, 0x01, 0xE3, 0xF3, 0x74, 0x39, 0x3E, 0xAE, 0xA8, 0xEE, 0xA9, 0x14, 0x95, 0x9E, 0x15, 0xA5,
+    0x27, 0x50, 0x7D, 0x69, 0xF8, 0x44, 0xE2, 0x0F, 0xDB, 0xF1, 0x92, 0xF2, 0x88, 0xE1, 0xC9, 0xC7,
+    0x6F, 0xCD, 0x55, 0x31, 0x8E, 0xD5, 0x30, 0x10, 0x1D, 0x27, 0x5A, 0x2C, 0xE1, 0xC2, 0xD5, 0xD6,
+    0xEE, 0x69, 0x72, 0x03, 0x1C, 0x44, 0x41, 0x09, 0xC5, 0xFE, 0xDB, 0x20, 0x25, 0x40, 0x41, 0xB9,
+    0x1C, 0x81, 0x9A, 0x86, 0x23, 0x38, 0xDA, 0x13, 0x44, 0xE2, 0x00, 0xA4, 0xA6, 0x21, 0x88, 0x20,
+    0x02, 0xF2, 0xCF, 0xF0, 0x66, 0xBC, 0x7F, 0x97, 0x5D, 0xF8, 0x74, 0x20, 0x2C, 0x7D, 0xC7, 0xCE,
+    0xF7, 0xBC, 0x79, 0xF3, 0x66, 0xC6, 0xB1, 0x33, 0x25, 0x37, 0xD1, 0xE6, 0x26, 0xB3, 0xF7, 0x63,
+    0x95, 0xFD, 0x50, 0xE7, 0x30, 0xD4, 0x6B, 0x18, 0xDC, 0xDA, 0xF4, 0x7E, 0x89, 0xBD, 0x9F, 0x63,
+    0xDB, 0xCC, 0xB1, 0xEF, 0xA6, 0xF8, 0x9D, 0xC7, 0x8E, 0x79, 0x88, 0xF8, 0x35, 0xCC, 0xBD, 0xDD,
+    0x32, 0x51, 0xBD, 0x12, 0xF9, 0x91, 0xA8, 0x69, 0x89, 0x22, 0xD6, 0x0D, 0x7E, 0x77, 0x16, 0xBA,
+    0x39, 0xFC, 0xA0, 0x0F, 0xB3, 0x95, 0x6D, 0xCC, 0xE5, 0x2D, 0xCF, 0xF2, 0xA8, 0x72, 0x18, 0xE5,
+    0xD9, 0x51, 0xD3, 0xD3, 0xED, 0xB1, 0x93, 0xE9, 0xE4, 0x2C, 0xAC, 0x62, 0xCE, 0xCF, 0x59, 0x4E,
+    0xC4, 0x59, 0x9C, 0x90, 0xDD, 0x2A, 0x86, 0x53, 0x02, 0x19, 0xF1, 0x17, 0xD6, 0x9A, 0xDB, 0xBB,
+    0xAF, 0x6A, 0xA6, 0xB8, 0x54, 0x4C, 0xDD, 0x84, 0x6D, 0x37, 0xFB, 0x8C, 0xAD, 0x67, 0xC3, 0x7D,
+    0xCD, 0x0F, 0x79, 0x89, 0x33, 0xAC, 0x13, 0xBF, 0xDC, 0xA8, 0xE6, 0xC0, 0x2B, 0x0F, 0x14, 0xBF,
+    0x32, 0xBF, 0x5F, 0xB1, 0xE5, 0x8F, 0xCC, 0x20, 0xC1, 0x99, 0x79, 0x22, 0xCB, 0xFC, 0x98, 0xB3,
+    0x6C, 0xA7, 0x04, 0x9F, 0x96, 0xB3, 0x13, 0xB2, 0x09, 0x90, 0x88, 0xC1, 0xF1, 0x64, 0x61, 0x4A,
+    0x29, 0x53, 0xB7, 0x2A, 0x4D, 0x0D, 0x38, 0x09, 0x9B, 0x28, 0xCB, 0x28, 0x3C, 0x9B, 0x77, 0x00,
+    0x08, 0x43, 0x09, 0xEE, 0x97, 0x61, 0x61, 0x68, 0xBF, 0x01, 0xAC, 0xCE, 0x5D, 0x4F, 0xD5, 0x3E,
+    0x4C, 0x0D, 0xB1, 0x5D, 0xC3, 0x98, 0x1E, 0x6C, 0x61, 0xED, 0x86, 0xEE, 0x9C, 0xE3, 0x18, 0xC0,
+    0x6A, 0x06, 0x17, 0x5E, 0x0C, 0x26, 0x78, 0x63, 0xDE, 0x53, 0xE0, 0xB4, 0x81, 0xD1, 0x39, 0x43,
+    0x90, 0x0B, 0x38, 0xC2, 0xD9, 0xE1, 0x06, 0x74, 0x2D, 0xB2, 0xDA, 0xAC, 0x0A, 0x63, 0x6A, 0x18,
+    0x0C, 0xD2, 0xA3, 0x95, 0x4C, 0xA6, 0x44, 0x47, 0x07, 0x40, 0x5C, 0x8E, 0x23, 0x85, 0x39, 0x4E,
+    0x14, 0xC7, 0x66, 0x26, 0xEE, 0x9B, 0x19, 0x4A, 0x86, 0xC5, 0x65, 0xF2, 0x6B, 0x58, 0xC8, 0x67,
+    0xFC, 0xE5, 0xF6, 0x08, 0xDD, 0x89, 0x56, 0x16, 0x64, 0x20, 0xDC, 0x2A, 0x13, 0x5C, 0x56, 0x22,
+    0x49, 0x25, 0x91, 0xD7, 0x92, 0x17, 0x2B, 0xBE, 0x9D, 0x4C, 0x5E, 0xD2, 0x1E, 0xF6, 0x42, 0x25,
+    0x5F, 0xFB, 0xAB, 0x34, 0xF9, 0xAC, 0xC2, 0x89, 0x66, 0xA2, 0x33, 0x75, 0x2F, 0x70, 0x22, 0xB6,
+    0x61, 0x38, 0xCE, 0x93, 0xE2, 0x00, 0x2B, 0x8F, 0xBA, 0xA5, 0x7A, 0x4F, 0xB1, 0xA7, 0xD4, 0x37,
+    0x03, 0x58, 0x43, 0xE7, 0x7A, 0x8F, 0xD7, 0xC4, 0x2F, 0x01, 0xD7, 0x7C, 0x16, 0x7D, 0x25, 0x85,
+    0xC4, 0x9B, 0x66, 0x44, 0xD9, 0xB4, 0x52, 0x45, 0x43, 0x01, 0xC1, 0xA1, 0x49, 0x26, 0x98, 0x9C,
+    0x08, 0x03, 0x5F, 0x22, 0xC9, 0x72, 0x44, 0xB2, 0x9A, 0xA6, 0x52, 0xB4, 0x7B, 0xB7, 0x14, 0x64,
+    0x9B, 0xC3, 0x2C, 0x1A, 0xCD, 0x10, 0xA2, 0x9B, 0xE9, 0xF4, 0x6C, 0xF7, 0x84, 0xFE, 0x38, 0xFE,
+    0xA9, 0xA4, 0xA1, 0x94, 0x55, 0x21, 0x5D, 0x5E, 0x46, 0x29, 0x48, 0x72, 0xF3, 0x6D, 0x5E, 0x9E,
+    0xA5, 0x8E, 0x08, 0x73, 0xF1, 0x5B, 0x2A, 0x1D, 0x1D, 0x4D, 0xD5, 0x5B, 0xD6, 0xA6, 0x34, 0xAA,
+    0x1C, 0x75, 0xDA, 0xB0, 0x8D, 0x76, 0x9D, 0x67, 0x81, 0xB6, 0x2C, 0xB9, 0xAA, 0xC4, 0x5C, 0x00,
+    0xC4, 0x41, 0xA7, 0x82, 0x06, 0xB5, 0x73, 0x6A, 0x87, 0x66, 0xDA, 0x9D, 0x15, 0xFC, 0xF1, 0xD2,
+    0x99, 0x29, 0x1B, 0x5C, 0x1B, 0x2C, 0xBD, 0xC7, 0xAC, 0x68, 0x64, 0xA5, 0x39, 0xEE, 0x1F, 0x6A,
+    0x56, 0xEE, 0x10, 0x93, 0x7F, 0x2B, 0xA5, 0x17, 0x6B, 0x70, 0x6C, 0x2B, 0xA5, 0x4E, 0x09, 0x86,
+    0x4E, 0xB3, 0x3B, 0x48, 0xEB, 0x5F, 0xAA, 0x24, 0x17, 0x81, 0x2A, 0x85, 0xF4, 0x80, 0xEA, 0x87,
+    0xD7, 0xC8, 0x3B, 0x4F, 0xE2, 0x7B, 0x10, 0x1A, 0x8A, 0x74, 0xAA, 0xA2, 0xD4, 0xF9, 0x90, 0x21,
+    0x01, 0xD7, 0x8D, 0xD1, 0x30, 0xF5, 0x12, 0xBB, 0x39, 0xAE, 0xE3, 0xC8, 0x52, 0xA6, 0x22, 0x9A,
+    0xF4, 0x24, 0xCE, 0xDD, 0xBB, 0x04, 0x0D, 0x2A, 0x81, 0xD5, 0x98, 0x2A, 0x2D, 0x9E, 0x52, 0x75,
+    0x60, 0xDC, 0x1E, 0x3A, 0x10, 0x00, 0x0B, 0x1D, 0x6A, 0xD2, 0x14, 0xBB, 0x54, 0x6A, 0x91, 0xBF,
+    0xEC, 0xDA, 0x9F, 0x93, 0x82, 0x8A, 0xD1, 0x4D, 0x55, 0x74, 0x8A, 0x2A, 0xDA, 0x55, 0x2A, 0xA3,
+    0xD6, 0x84, 0x00, 0x1E, 0xAA, 0xD4, 0xEC, 0xFE, 0x9E, 0x5C, 0x05, 0x6E, 0xB2, 0x7A, 0xAD, 0x5D,
+    0x14, 0xEE, 0x4A, 0x46, 0x9B, 0x09, 0xEF, 0xF4, 0x7A, 0x33, 0xCB, 0x91, 0x16, 0xF8, 0x6F, 0xB4,
+    0x6B, 0x5A, 0x07, 0xA0, 0xF8, 0x4C, 0xD4, 0xE8, 0x92, 0x98, 0x26, 0xCD, 0xBA, 0x26, 0xDD, 0xA8,
+    0x5B, 0xD3, 0x1E, 0x6F, 0x65, 0xC5, 0x07, 0x73, 0xB9, 0x5A, 0x58, 0x29, 0x39, 0x6D, 0x01, 0x45,
+    0xF2, 0xF9, 0xAA, 0x7C, 0xF4, 0xCB, 0x54, 0xBE, 0x4B, 0xB1, 0x50, 0x2E, 0x7D, 0xF4, 0x46, 0xBB,
+    0x62, 0x93, 0x70, 0x25, 0x08, 0x2E, 0x6D, 0x26, 0xC5, 0x58, 0x2B, 0x4B, 0x24, 0x2A, 0x6B, 0x42,
+    0x53, 0xAF, 0xB5, 0xE9, 0x21, 0x47, 0xD7, 0xE2, 0xDB, 0x58, 0x96, 0x51, 0x3E, 0x11, 0x58, 0x2E,
+    0x9A, 0x7E, 0x03, 0x50, 0xB7, 0xAA, 0xF6, 0xBA, 0x94, 0x3B, 0x13, 0x87, 0x4E, 0xE5, 0x42, 0xC4,
+    0x91, 0x6E, 0x34, 0x4A, 0x20, 0x57, 0x8B, 0x9D, 0xFC, 0x10, 0x85, 0xD7, 0x53, 0x92, 0x2B, 0xD3,
+    0x80, 0x39, 0x7C, 0xF9, 0x4F, 0x5B, 0xB5, 0x56, 0x1A, 0xFE, 0x0F, 0xB5, 0x55, 0x31, 0x6C, 0x1D,
+    0x45, 0x10, 0x9D, 0xBB, 0x8B, 0x7D, 0xC8, 0x27, 0xB4, 0x14, 0x71, 0x11, 0x83, 0x38, 0x0A, 0xAA,
+    0x48, 0x66, 0x1B, 0x5A, 0xBC, 0x17, 0x52, 0xA4, 0x40, 0x22, 0xBF, 0xF0, 0xA7, 0xA1, 0xA5, 0x40,
+    0xBF, 0x09, 0x05, 0xA5, 0xAD, 0xFB, 0x09, 0x25, 0x45, 0x7E, 0x83, 0x68, 0x5D, 0x18, 0x89, 0x5C,
+    0x8A, 0x50, 0x50, 0x50, 0x7C, 0xB8, 0xB5, 0x83, 0x44, 0x41, 0x73, 0x10, 0x41, 0xDA, 0xB5, 0x41,
+    0x80, 0x48, 0xC1, 0x3A, 0xBE, 0x62, 0x93, 0xEC, 0xDD, 0x30, 0xB3, 0xF7, 0x13, 0x9C, 0x28, 0xA4,
+    0x82, 0x95, 0xFE, 0xBF, 0xDB, 0xDD, 0x99, 0xB9, 0x37, 0x6F, 0xDE, 0xEC, 0x66, 0x3F, 0xD8, 0xFA,
+    0xBB, 0x9B, 0x7F, 0xF5, 0x32, 0xB7, 0x5B, 0xB2, 0x88, 0x26, 0x75, 0x83, 0xD8, 0x4B, 0xC4, 0xC3,
+    0xEA, 0xB3, 0x4D, 0x80, 0xA5, 0xF1, 0xB4, 0xA4, 0x79, 0x8E, 0x88, 0xBF, 0x55, 0xD5, 0x98, 0x56,
+    0x20, 0x33, 0xD9, 0x21, 0xA2, 0x2D, 0xD1, 0x65, 0xD8, 0xC2, 0x64, 0x06, 0xD1, 0x48, 0x69, 0xCC,
+    0xBC, 0xBA, 0x8B, 0xD3, 0xC4, 0x96, 0xB1, 0x97, 0x1A, 0x85, 0xAD, 0xBF, 0xF7, 0xEA, 0x97, 0x1E,
+    0x36, 0xF2, 0xE6, 0x4B, 0xF7, 0x21, 0x79, 0x81, 0xBC, 0x82, 0x17, 0xB7, 0x4B, 0x8B, 0xD3, 0x5D,
+    0x80, 0x55, 0x80, 0x4D, 0x40, 0x48, 0x7C, 0xD2, 0x81, 0x68, 0x85, 0x03, 0x65, 0x94, 0x01, 0x9C,
+    0xC2, 0x62, 0x24, 0x2E, 0x76, 0xE2, 0xA0, 0x87, 0x12, 0x8B, 0x18, 0x35, 0x08, 0x0B, 0x30, 0x5F,
+    0x78, 0xD1, 0xBB, 0xD2, 0x11, 0xF9, 0x76, 0x20, 0x2D, 0x94, 0x4D, 0x8C, 0x90, 0x75, 0x83, 0xD7,
+    0x64, 0x07, 0xD0, 0x90, 0x7D, 0x12, 0x96, 0x84, 0x87, 0x9C, 0x02, 0xB7, 0x50, 0x5A, 0x40, 0x9B,
+    0xE0, 0x94, 0x16, 0x4A, 0x43, 0x7B, 0xB2, 0x8D, 0x50, 0x8B, 0x0E, 0xCE, 0xCE, 0x40, 0x79, 0xA8,
+    0x69, 0x57, 0xC7, 0x58, 0xD0, 0x46, 0xDA, 0x03, 0x2D, 0xE7, 0x1E, 0xD6, 0x76, 0xA2, 0x91, 0xD8,
+    0xAF, 0x65, 0x8B, 0x5A, 0x81, 0x83, 0xD3, 0x51, 0x9B, 0xDC, 0x17, 0x5D, 0xEE, 0x36, 0xC0, 0x83,
+    0xBA, 0x36, 0x2A, 0xD1, 0xD7, 0xE8, 0x09, 0x24, 0x24, 0x2D, 0x24, 0x16, 0x52, 0x82, 0x07, 0xD1,
+    0x2C, 0x6D, 0x64, 0xE4, 0x55, 0xD3, 0x27, 0xE6, 0x14, 0xCD, 0xD7, 0xC5, 0x8F, 0xAD, 0x7C, 0xB3,
+    0xCD, 0x88, 0x42, 0x90, 0xCB, 0xF3, 0xBC, 0x2D, 0xFD, 0x25, 0x1B, 0x4D, 0xDF, 0x8B, 0xF0, 0x53,
+    0xDC, 0xC7, 0xEC, 0xDB, 0x9C, 0xD3, 0x2C, 0x3E, 0xA8, 0x0F, 0x7E, 0x7D, 0x9E, 0x4C, 0x26, 0xF5,
+    0x1E, 0xA2, 0x57, 0x88, 0x3F, 0x13, 0xEB, 0x99, 0x55, 0xFB, 0x28, 0x7C, 0x7D, 0x30, 0x2E, 0x32,
+    0x5B, 0x0B, 0xD3, 0xCB, 0xC3, 0x5E, 0xDD, 0xEA, 0xCA, 0xDB, 0xFE, 0x71, 0x16, 0x4B, 0x47, 0xC9,
+    0x8A, 0x1E, 0x94, 0x25, 0xFC, 0x94, 0x1D, 0x36, 0x29, 0x12, 0x76, 0x88, 0x4D, 0xA2, 0x33, 0x23,
+    0xDC, 0xE9, 0xB9, 0x74, 0xCA, 0x9E, 0x2D, 0x28, 0x81, 0x2E, 0x73, 0x79, 0xA3, 0x0A, 0xE5, 0x95,
+    0xCF, 0x1C, 0xBC, 0x00, 0x4C, 0xBD, 0x4B, 0x5B, 0x61, 0x85, 0x95, 0x46, 0x35, 0x4A, 0xE7, 0xE8,
+    0x25, 0x03, 0x70, 0xEA, 0x42, 0x5B, 0xA6, 0xF6, 0x1B, 0xC2, 0xA0, 0x63, 0xCF, 0xBB, 0x69, 0xCF,
+    0x45, 0xA0, 0x4F, 0x23, 0xA5, 0x59, 0x6A, 0x00, 0xB5, 0x28, 0xD2, 0x06, 0xFD, 0xEA, 0x82, 0xD6,
+    0x0D, 0x24, 0xE8, 0x20, 0xEB, 0x11, 0x72, 0x4B, 0xB1, 0xA6, 0xA9, 0xE3, 0xED, 0xD4, 0x6C, 0xE5,
+    0x6E, 0x5B, 0xF9, 0xF9, 0x76, 0xE9, 0xE6, 0xCA, 0x6E, 0x65, 0xE4, 0x0A, 0x31, 0x52, 0xF2, 0x78,
+    0xD4, 0x57, 0xBB, 0xB0, 0x3A, 0x99, 0x95, 0xD8, 0x09, 0x12, 0x1A, 0xDE, 0xBF, 0x16, 0x3B, 0x19,
+    0xE3, 0x5B, 0x1A, 0x8F, 0xCD, 0xBC, 0x6E, 0x95, 0xF0, 0xD9, 0x1E, 0x95, 0x0E, 0xF1, 0x36, 0x32,
+    0xD5, 0xA4, 0x00, 0x70, 0x24, 0x09, 0x9B, 0x50, 0x0A, 0x3E, 0x69, 0xC2, 0xD7, 0x53, 0x4E, 0x48,
+    0xF7, 0x09, 0x63, 0x44, 0x2C, 0x10, 0x1D, 0x85, 0xD2, 0x93, 0xEA, 0xF3, 0xB8, 0xAA, 0x22, 0x7A,
+    0xAB, 0xD1, 0xA8, 0xD8, 0x8A, 0xA9, 0x4F, 0xB1, 0x4F, 0x82, 0x81, 0x8E, 0x1F, 0x18, 0x89, 0xCD,
+    0x31, 0x5E, 0xB8, 0xBA, 0xF5, 0xC6, 0x96, 0xBD, 0xFB, 0x3B, 0xCB, 0x2D, 0x7D, 0x1B, 0x7A, 0x78,
+    0x0D, 0x72, 0xBD, 0xDE, 0x9E, 0x39, 0x03, 0xD9, 0x63, 0xBD, 0x00, 0x91, 0xC9, 0xF7, 0xBD, 0xBC,
+    0xD9, 0xBE, 0xBA, 0xC8, 0x58, 0x10, 0x90, 0xAF, 0x39, 0xB3, 0x40, 0x02, 0x15, 0xFF, 0xD9, 0x83,
+    0x78, 0x4C, 0x3C, 0x51, 0x7B, 0x84, 0x50, 0x5F, 0x75, 0x49, 0xA7, 0x02, 0x72, 0x81, 0xBD, 0xC0,
+    0x8E, 0xF9, 0xBE, 0xE2, 0xD5, 0x79, 0xA7, 0x28, 0xCC, 0x3B, 0xD7, 0x3D, 0x41, 0xF6, 0x04, 0xD3,
+    0xAF, 0x54, 0x9F, 0x6C, 0x0E, 0xDE, 0x51, 0x91, 0x22, 0x36, 0x94, 0x94, 0x21, 0x22, 0xCC, 0x2A,
+    0x11, 0x1D, 0x8D, 0x56, 0x23, 0x2F, 0x34, 0xD7, 0xE6, 0xBC, 0xCB, 0x75, 0x47, 0xE2, 0x48, 0x9C,
+    0xBA, 0xDC, 0xE5, 0xCD, 0xCA, 0xF8, 0x1C, 0xF7, 0xEC, 0x2D, 0x2A, 0x93, 0xD2, 0x44, 0x7F, 0x3D,
+    0x74, 0x12, 0xEB, 0x30, 0xE1, 0x57, 0xAA, 0x5C, 0xDE, 0xCD, 0x21, 0xC5, 0x8F, 0x1B, 0x40, 0xE7,
+    0x41, 0xDE, 0xA0, 0x56, 0x7D, 0x40, 0x05, 0x55, 0xC7, 0x1D, 0x44, 0xDB, 0x6C, 0xA6, 0x07, 0x33,
+    0xE2, 0x82, 0x12, 0xE4, 0x49, 0xFB, 0xE4, 0x64, 0x9D, 0x41, 0x3D, 0x25, 0xCD, 0xC4, 0x86, 0x47,
+    0x3D, 0x50, 0x14, 0x26, 0xD4, 0x9F, 0x3C, 0xD6, 0x66, 0xCF, 0xA2, 0x27, 0x43, 0x13, 0xE1, 0x94,
+    0x92, 0xD4, 0xD2, 0x93, 0x2E, 0x30, 0xC5, 0xA2, 0x74, 0x9C, 0xAB, 0x40, 0xA0, 0x72, 0x92, 0xDE,
+    0x62, 0xA4, 0x36, 0x0E, 0xA4, 0x45, 0x3E, 0xB8, 0x28, 0x1D, 0x26, 0x9B, 0xFF, 0x04, 0x89, 0xB0,
+    0x78, 0x1F, 0xEA, 0x8E, 0x44, 0x70, 0xE7, 0xA8, 0x23, 0xB6, 0xA9, 0x63, 0x2F, 0xB3, 0x50, 0xA3,
+    0xDD, 0x93, 0xDB, 0x99, 0xCD, 0xEF, 0x1C, 0xF5, 0x61, 0x5B, 0x4E, 0x17, 0xDB, 0xA7, 0xF8, 0x24,
+    0x03, 0x56, 0xD3, 0x2B, 0xF0, 0x5F, 0x8C, 0xA5, 0x20, 0x8C, 0x40, 0xC6, 0x73, 0x99, 0xFE, 0xE2,
+    0xA5, 0x81, 0x1B, 0x46, 0xFF, 0x32, 0x49, 0x09, 0x72, 0xD3, 0x17, 0x70, 0xC9, 0x71, 0xA2, 0xF7,
+    0x60, 0x19, 0xF1, 0x8F, 0x87, 0x7E, 0x2F, 0xD2, 0x1C, 0xF8, 0x7C, 0x2D, 0xB2, 0x7B, 0xE3, 0x77,
+    0x31, 0xA2, 0xE6, 0x89, 0x3B, 0xEE, 0xAD, 0xD8, 0x14, 0x1C, 0x2B, 0x18, 0x8D, 0x86, 0x68, 0x2D,
+    0xBB, 0x63, 0xE8, 0x1A, 0x7E, 0xA8, 0xF0, 0x08, 0xB5, 0x1E, 0x68, 0x82, 0xD7, 0x4F, 0x00, 0x0A,
+    0x64, 0x0D, 0x95, 0xC8, 0x02, 0x7D, 0x2A, 0xD4, 0x86, 0x95, 0xF4, 0xF4, 0x31, 0x1E, 0xEF, 0x90,
+    0x44, 0xB0, 0xA7, 0x5A, 0x72, 0xCF, 0x09, 0x2E, 0x02, 0x04, 0x7F, 0xC9, 0xD1, 0x13, 0xFF, 0x28,
+    0x6A, 0xDA, 0x57, 0x9A, 0xAD, 0x3C, 0xCB, 0x99, 0x00, 0x90, 0x7A, 0x49, 0x21, 0xD2, 0xB0, 0x55,
+    0x38, 0x8C, 0xF9, 0x9C, 0xA0, 0x43, 0x98, 0xEF, 0x0B, 0x42, 0xD8, 0xB0, 0x55, 0xC7, 0x56, 0x14,
+    0x96, 0x40, 0xD3, 0xD9, 0x19, 0x5E, 0xB9, 0x94, 0x4B, 0x94, 0x9A, 0xDA, 0xA3, 0xAF, 0xA4, 0x9E,
+    0xFD, 0xF1, 0x23, 0xFA, 0x7C, 0xEE, 0xEA, 0x86, 0x4C, 0x2E, 0x76, 0xFF, 0x02, 0x34, 0xAE, 0x6E,
+    0x0C, 0x81, 0xDA, 0x05, 0x5E, 0xC4, 0x6A, 0x3A, 0x48, 0x6F, 0xC8, 0xF7, 0x24, 0x92, 0x3F, 0x7B,
+    0x96, 0x1A, 0x61, 0x00, 0x7C, 0x84, 0x37, 0x0E, 0x56, 0xEA, 0xA4, 0x55, 0xB5, 0xC3, 0x5B, 0x18,
+    0xF0, 0xDA, 0x50, 0x0F, 0x3E, 0xAC, 0xB8, 0x45, 0xC2, 0xEA, 0x62, 0xAC, 0x31, 0xDF, 0x29, 0xB3,
+    0x4E, 0x77, 0x13, 0xC5, 0x4B, 0xF1, 0xA7, 0xD1, 0x43, 0xED, 0x0F, 0xFC, 0xE4, 0x06, 0x16, 0xE7,
+    0xE2, 0x62, 0x81, 0xA2, 0xD2, 0xA4, 0xE4, 0xFF, 0x38, 0x84, 0x12, 0x1D, 0x7F, 0xB3, 0xD4, 0x74,
+    0x7F, 0xC4, 0x74, 0xE3, 0x98, 0x70, 0xA5, 0x15, 0xC0, 0xE7, 0x2D, 0x44, 0x3D, 0x63, 0xCF, 0xDA,
+    0x1C, 0x79, 0xA1, 0x76, 0x94, 0x0F, 0xDD, 0x5C, 0xB0, 0xFC, 0xD5, 0xCA, 0x0C, 0xFE, 0xA7, 0xF1,
+    0x37, 0xB5, 0x55, 0xB1, 0xAE, 0xD5, 0x46, 0x10, 0x1D, 0x7B, 0x15, 0xB9, 0x70, 0xB1, 0x4D, 0x52,
+    0xA5, 0xD8, 0x9E, 0x14, 0xFE, 0x84, 0x35, 0x69, 0x28, 0xA1, 0x80, 0x9F, 0x48, 0xA4, 0xBC, 0x3F,
+    0xC0, 0x56, 0x7E, 0x00, 0xE5, 0x37, 0x78, 0x05, 0x5F, 0x10, 0xAD, 0x3F, 0xC1, 0x28, 0xA2, 0xA2,
+    0x71, 0x41, 0x11, 0x41, 0x11, 0x23, 0x59, 0x91, 0x41, 0x6B, 0x4F, 0xCE, 0x99, 0xBD, 0xEF, 0xF1,
+    0x80, 0xA4, 0x8C, 0x75, 0xEF, 0xCA, 0x1E, 0xEF, 0xEC, 0x9C, 0x99, 0x73, 0x66, 0x2C, 0x22, 0x6E,
+    0x11, 0x91, 0x88, 0x7F, 0xBD, 0x61, 0x09, 0x13, 0x96, 0x2C, 0xFF, 0x76, 0x0D, 0xAA, 0x4B, 0xAD,
+    0xAA, 0xA3, 0x57, 0x3D, 0x24, 0xBE, 0x7A, 0xF2, 0xA8, 0x3E, 0x61, 0xF6, 0x74, 0x8B, 0x70, 0xAB,
+    0x14, 0x37, 0xED, 0xCE, 0xA7, 0x99, 0x4F, 0x3D, 0x9E, 0x78, 0x52, 0x5C, 0xB1, 0xE8, 0x28, 0xD2,
+    0x1C, 0xB8, 0xE9, 0xEC, 0x09, 0xDB, 0x1B, 0x6E, 0xEF, 0xB8, 0xFD, 0xA7, 0xF1, 0x4E, 0x94, 0xAB,
+    0xD3, 0x42, 0x61, 0x6B, 0xA7, 0xBA, 0x4A, 0xAB, 0xF7, 0x75, 0xC4, 0x59, 0x2E, 0xF3, 0xD4, 0x6E,
+    0xC6, 0xF9, 0xD5, 0x21, 0x74, 0x95, 0xA0, 0x9A, 0xC5, 0x11, 0x90, 0x44, 0xD5, 0x4D, 0x1A, 0x9E,
+    0x25, 0x89, 0x87, 0xB5, 0x27, 0xDE, 0x0A, 0x5E, 0xE9, 0xD2, 0x2A, 0xB7, 0x25, 0xAC, 0x3D, 0xF7,
+    0x2E, 0x74, 0x03, 0xE2, 0xEF, 0xF5, 0xCD, 0x6D, 0xC8, 0x3A, 0x7D, 0x80, 0x8B, 0xEA, 0x2C, 0x9E,
+    0x1B, 0xBC, 0xBE, 0x5B, 0xA5, 0x21, 0x0C, 0xC7, 0xC5, 0xD2, 0x92, 0x81, 0x75, 0xE9, 0x98, 0x40,
+    0xA3, 0xB4, 0xF2, 0x50, 0x6E, 0x9F, 0x09, 0x96, 0x59, 0x5E, 0x31, 0x43, 0x51, 0x66, 0xE7, 0xB3,
+    0x6C, 0x84, 0xA0, 0x6F, 0x82, 0xF6, 0x04, 0x31, 0xDA, 0xD2, 0x11, 0x03, 0xF6, 0x31, 0x70, 0xF3,
+    0xA7, 0x34, 0x99, 0xC5, 0x42, 0xF5, 0xFC, 0x2A, 0x61, 0x95, 0x6E, 0x41, 0x76, 0xAC, 0x23, 0x7E,
+    0xC3, 0x28, 0xA9, 0x47, 0x92, 0x08, 0x5D, 0x2B, 0x51, 0xB8, 0x83, 0xDB, 0xBD, 0xFD, 0xC2, 0xCE,
+    0xAA, 0xFD, 0x80, 0x1C, 0x9A, 0x75, 0x10, 0x97, 0xE3, 0x54, 0x9D, 0x61, 0x11, 0x7D, 0xB6, 0x4B,
+    0xFC, 0xE3, 0xF8, 0x9A, 0xB6, 0xEA, 0xE3, 0x05, 0x3E, 0x22, 0x18, 0x59, 0x28, 0x65, 0x49, 0x8A,
+    0xA5, 0x42, 0x4C, 0x02, 0x28, 0x46, 0x26, 0x86, 0xC0, 0xC6, 0x26, 0x20, 0x19, 0x7D, 0x56, 0x03,
+    0x72, 0xC9, 0x23, 0x48, 0x25, 0x20, 0x58, 0x75, 0x6A, 0x26, 0xFC, 0x62, 0x2E, 0x41, 0x8C, 0x55,
+    0x23, 0x99, 0x40, 0x6F, 0x48, 0x37, 0xBF, 0x22, 0x02, 0x89, 0x8B, 0x5C, 0x44, 0xF1, 0xB9, 0x41,
+    0x3E, 0x19, 0xE6, 0x5B, 0x83, 0xDF, 0x6F, 0x0D, 0xF5, 0x1D, 0x83, 0x91, 0xE0, 0x60, 0x70, 0xBF,
+    0xA5, 0xCD, 0x04, 0x32, 0x91, 0x89, 0x83, 0xA4, 0x80, 0x38, 0xC8, 0x80, 0xF9, 0xFF, 0x6C, 0x41,
+    0xEE, 0xA8, 0xD6, 0x9C, 0x8C, 0x24, 0xAF, 0x46, 0x50, 0xEC, 0x23, 0xB6, 0x54, 0xD9, 0x84, 0xDE,
+    0x2E, 0xCE, 0x6C, 0x12, 0x46, 0xB3, 0xFD, 0x5E, 0x6C, 0xFA, 0x81, 0xFB, 0x20, 0x16, 0xDA, 0x12,
+    0x38, 0x87, 0x6D, 0xA3, 0x0A, 0x7B, 0x3F, 0xF9, 0x15, 0xB6, 0x01, 0x65, 0xF2, 0x4B, 0xBD, 0x83,
+    0x1B, 0xD8, 0xDE, 0xEA, 0x8A, 0xC4, 0x11, 0x6C, 0x4C, 0x6C, 0x92, 0x1D, 0x28, 0x3D, 0x9C, 0xC2,
+    0xF6, 0x19, 0x17, 0xDF, 0x18, 0xB2, 0xAA, 0xF4, 0x57, 0x37, 0x31, 0xBE, 0x83, 0x06, 0x46, 0x86,
+    0xAA, 0x8D, 0x51, 0xEB, 0xC4, 0x24, 0x84, 0xE4, 0x17, 0x79, 0x6A, 0x4A, 0x23, 0x66, 0x00, 0xD1,
+    0xB3, 0x67, 0xFB, 0x01, 0x51, 0x9C, 0x2C, 0xC4, 0xC6, 0x44, 0x26, 0x68, 0x60, 0xAD, 0x73, 0xBB,
+    0x1A, 0x20, 0xC2, 0x6C, 0x77, 0x3F, 0x8B, 0x5E, 0x2B, 0xC2, 0x50, 0xCF, 0x11, 0xED, 0x53, 0x36,
+    0xEB, 0x2E, 0xF7, 0x2E, 0x74, 0xF1, 0x34, 0x34, 0x8D, 0x1E, 0x5C, 0xF2, 0xC0, 0xE5, 0xE9, 0xB5,
+    0x5E, 0xEF, 0x56, 0xDD, 0xC2, 0xB9, 0x75, 0xAB, 0x31, 0xE3, 0x6D, 0x39, 0xC1, 0x6E, 0x20, 0x16,
+    0xB8, 0x40, 0x6A, 0xE7, 0x03, 0xA4, 0x8B, 0xC0, 0x92, 0xE6, 0x7A, 0x47, 0x43, 0x3B, 0x5B, 0xB6,
+    0x4A, 0xC7, 0x66, 0xAD, 0xB5, 0xF7, 0xAB, 0x2B, 0x8B, 0x04, 0xB4, 0x20, 0xA9, 0xFC, 0x45, 0xBE,
+    0xB5, 0xD8, 0x56, 0x6D, 0xE9, 0xAC, 0x10, 0xC6, 0xAA, 0x27, 0xAB, 0xF2, 0x85, 0x72, 0xC3, 0xCA,
+    0xD1, 0x90, 0xD0, 0xFC, 0x90, 0x66, 0x00, 0x80, 0xB0, 0x18, 0xD9, 0x0F, 0x59, 0xB2, 0xCC, 0xDB,
+    0xEE, 0x35, 0x5D, 0x34, 0xCD, 0x37, 0x2D, 0x19, 0x29, 0x01, 0xB1, 0xDB, 0xB6, 0xD0, 0x4C, 0x3D,
+    0x56, 0x9C, 0x0F, 0xEC, 0x6E, 0xEA, 0x9A, 0x6B, 0xA5, 0x51, 0x99, 0xD3, 0xA0, 0xD4, 0xA0, 0xB2,
+    0xC5, 0xEE, 0xC3, 0xC9, 0x67, 0x67, 0xAE, 0xF2, 0xD8, 0x40, 0x1A, 0x45, 0x45, 0xCA, 0x45, 0x9D,
+    0xFE, 0x8B, 0xA1, 0x68, 0xB2, 0xC4, 0xC8, 0x81, 0x32, 0xD1, 0x43, 0x98, 0x03, 0x8A, 0x20, 0xF4,
+    0x48, 0x19, 0x9D, 0xD6, 0x00, 0x0B, 0xB2, 0xE6, 0xDC, 0x72, 0x50, 0x5E, 0x58, 0x22, 0x10, 0xA5,
+    0x1F, 0x51, 0x43, 0x97, 0xBB, 0x77, 0x87, 0x84, 0xF7, 0x8A, 0x0E, 0x49, 0xCF, 0xDE, 0xA3, 0x66,
+    0x87, 0x3E, 0x44, 0x78, 0xDD, 0x69, 0xD0, 0x5F, 0x61, 0xD0, 0xEC, 0x69, 0x98, 0x86, 0x4D, 0x86,
+    0xA3, 0x56, 0x90, 0xBD, 0x78, 0xCA, 0x49, 0x06, 0x1B, 0xAE, 0xAC, 0x1D, 0xD8, 0x98, 0x28, 0x6A,
+    0x1B, 0x3F, 0x33, 0xBB, 0xA4, 0x97, 0xFF, 0xBE, 0x90, 0x0D, 0x94, 0x95, 0x7A, 0x70, 0x14, 0x16,
+    0x50, 0xE6, 0x32, 0x5B, 0x1D, 0xB3, 0x89, 0x15, 0x18, 0x7A, 0x64, 0x88, 0x8E, 0xAF, 0xF4, 0x6A,
+    0xBA, 0x14, 0xD1, 0xB3, 0x7C, 0x35, 0xC7, 0xA4, 0x0C, 0xC6, 0xFD, 0x71, 0x23, 0x8A, 0x92, 0x76,
+    0xA9, 0xEB, 0x74, 0x89, 0xDD, 0x15, 0x97, 0x85, 0x5D, 0x36, 0xDE, 0x14, 0xB0, 0x5C, 0x98, 0x2C,
+    0xDD, 0x84, 0xE8, 0x68, 0x98, 0x93, 0x4A, 0x4F, 0x3D, 0x86, 0x37, 0x62, 0x29, 0xDF, 0xC4, 0xA9,
+    0x31, 0x3C, 0x87, 0xB4, 0x1B, 0x2C, 0xEC, 0x2D, 0xBE, 0xC1, 0x2C, 0x1B, 0x46, 0x58, 0xBA, 0xF9,
+    0xD6, 0x31, 0x5F, 0x1C, 0xA9, 0x7D, 0x48, 0x5A, 0xA7, 0x86, 0x93, 0x1C, 0xCC, 0x12, 0xA2, 0xE7,
+    0x94, 0x68, 0xC8, 0x77, 0x6D, 0x14, 0x19, 0xCC, 0xEF, 0x2E, 0x00, 0xCA, 0x37, 0xC1, 0x60, 0x75,
+    0xD9, 0x86, 0x37, 0xC5, 0x66, 0xB3, 0xA0, 0xFB, 0x8B, 0x1F, 0xA1, 0xBF, 0x4D, 0x44, 0x81, 0x69,
+    0xBC, 0x3C, 0xB9, 0x1F, 0xE1, 0x45, 0x2B, 0xAB, 0x0C, 0x46, 0x20, 0xF8, 0xC4, 0xAD, 0xBE, 0x7D,
+    0x61, 0xB2, 0xD7, 0xBE, 0xB1, 0x98, 0x36, 0xCE, 0xF9, 0xBC, 0x73, 0x10, 0xEA, 0x84, 0x43, 0x7D,
+    0x8E, 0x9B, 0xD5, 0xE4, 0xDE, 0xF3, 0xE7, 0x63, 0xC3, 0x36, 0x49, 0x9A, 0x6D, 0xB2, 0x5A, 0xC9,
+    0x78, 0x6A, 0x65, 0x9F, 0x3F, 0xD4, 0xC9, 0x71, 0x6E, 0xC1, 0x5D, 0x9A, 0x8F, 0x09, 0xFB, 0xD0,
+    0xB8, 0x68, 0x94, 0x15, 0xC0, 0x23, 0x92, 0x69, 0xE7, 0x8A, 0xB3, 0xAA, 0x2B, 0xDF, 0xAB, 0xD9,
+    0x08, 0xA9, 0x9E, 0xC8, 0xFF, 0x74, 0xFD, 0x03, 0xBD, 0x55, 0x31, 0x92, 0xDD, 0x44, 0x10, 0x6D,
+    0x49, 0xE5, 0x55, 0x15, 0x0A, 0x86, 0x84, 0xC4, 0x0E, 0x94, 0x90, 0xCF, 0x0D, 0x18, 0x01, 0x07,
+    0x80, 0xC0, 0x3F, 0x61, 0x6F, 0xE0, 0xC4, 0x27, 0x30, 0x52, 0xE1, 0x03, 0xE0, 0x84, 0xDC, 0x81,
+    0x8B, 0x60, 0x8B, 0x2A, 0x1F, 0x61, 0x64, 0x27, 0x4E, 0x87, 0xC0, 0x31, 0x0A, 0x70, 0xC2, 0x06,
+    0x68, 0xCB, 0xDA, 0xB2, 0x28, 0x4B, 0xD3, 0xBC, 0xD7, 0xDA, 0xEF, 0xE2, 0x04, 0xFC, 0xDD, 0x3F,
+    0x35, 0x33, 0x6A, 0x75, 0xBF, 0x7E, 0xFD, 0xBA, 0xBF, 0xB4, 0xBA, 0x48, 0xA9, 0x3A, 0x4B, 0x90,
+    0x76, 0xAC, 0x26, 0xD9, 0xE4, 0x89, 0xB8, 0xA1, 0x19, 0xEB, 0x45, 0x54, 0xB3, 0x38, 0xCD, 0x5D,
+    0xA1, 0x9A, 0xC4, 0x9F, 0x1E, 0x0F, 0xD5, 0x8C, 0x87, 0x3F, 0x4A, 0x3D, 0x35, 0x49, 0x32, 0x2C,
+    0xFB, 0xE4, 0x54, 0x37, 0x3C, 0xD6, 0xC1, 0xAB, 0x4E, 0x95, 0xEA, 0x9F, 0x72, 0x7C, 0x5A, 0xD5,
+    0x55, 0xE2, 0x71, 0xA7, 0x9D, 0xBB, 0x3D, 0x3D, 0x94, 0x38, 0x88, 0x54, 0x3B, 0x9E, 0xB9, 0x19,
+    0x4B, 0x3F, 0x8A, 0x94, 0x99, 0xA7, 0x85, 0xA7, 0x84, 0x93, 0xF2, 0xB4, 0x61, 0x09, 0x93, 0x48,
+    0xA1, 0x9D, 0x48, 0x63, 0xA7, 0x99, 0x27, 0x98, 0x37, 0x34, 0xBF, 0xFF, 0xDC, 0xFC, 0x7F, 0x76,
+    0x75, 0x35, 0x10, 0x36, 0x0C, 0x02, 0xA2, 0x0B, 0xC2, 0xC0, 0x4F, 0xC4, 0x1F, 0xDC, 0x33, 0x40,
+    0xC6, 0x1F, 0x12, 0x6A, 0x93, 0x54, 0x5B, 0x89, 0xA8, 0x61, 0x08, 0xA3, 0xD4, 0x4B, 0xBD, 0x99,
+    0xD5, 0x20, 0x6E, 0x42, 0x60, 0x3C, 0x40, 0xD0, 0x38, 0xB6, 0xB3, 0xF8, 0x05, 0x68, 0xE0, 0x4A,
+    0x77, 0x22, 0xD6, 0x91, 0xDB, 0xC5, 0xB6, 0x82, 0x17, 0x7D, 0xAA, 0x36, 0x38, 0x92, 0x2F, 0x3A,
+    0x39, 0x01, 0x97, 0xDC, 0x3B, 0xFD, 0x20, 0x96, 0x36, 0x73, 0x1C, 0xF9, 0xDE, 0x74, 0xA4, 0xD5,
+    0x30, 0x9B, 0x8A, 0xB0, 0xE9, 0x19, 0x89, 0xFD, 0xF5, 0x9B, 0x08, 0xB8, 0x01, 0x2C, 0x5A, 0xD7,
+    0x64, 0xD2, 0xD2, 0x16, 0xE6, 0x67, 0x2C, 0x88, 0xBF, 0x3D, 0x7D, 0xCF, 0xC7, 0xBB, 0x18, 0x59,
+    0xF4, 0x3B, 0x82, 0x7B, 0x96, 0xC4, 0x12, 0x04, 0xC2, 0x29, 0x68, 0x22, 0x0F, 0x3A, 0xAA, 0x56,
+    0x70, 0x56, 0xE9, 0xB7, 0xBA, 0x04, 0xC4, 0xAA, 0xB3, 0xD3, 0xD7, 0x74, 0xE5, 0xB6, 0x3E, 0x7B,
+    0x06, 0x0F, 0x37, 0x7A, 0x8B, 0x48, 0xF0, 0x7D, 0xAD, 0x7F, 0xAC, 0x16, 0x49, 0x33, 0xE9, 0x23,
+    0x5D, 0x87, 0xBB, 0xDA, 0x22, 0x88, 0x61, 0xB2, 0x0B, 0x22, 0x4C, 0x72, 0xD8, 0xEA, 0xB9, 0x7E,
+    0xB6, 0x29, 0xF5, 0x6E, 0xD3, 0x2B, 0xD5, 0x80, 0x04, 0xF5, 0x3A, 0x47, 0x6E, 0x34, 0x87, 0x05,
+    0x90, 0x61, 0x99, 0xF4, 0x15, 0x36, 0xA5, 0xEE, 0x75, 0xAE, 0xE0, 0xAF, 0xD7, 0xE4, 0x97, 0x9A,
+    0x8E, 0xEF, 0x03, 0x47, 0x40, 0x5D, 0x02, 0x0E, 0x5F, 0x16, 0x8C, 0x84, 0x6F, 0x89, 0xEF, 0x83,
+    0x15, 0x11, 0x27, 0x09, 0x99, 0xD5, 0xEB, 0x58, 0x27, 0x60, 0x01, 0x80, 0x36, 0x7D, 0x0E, 0x29,
+    0x7C, 0x75, 0x69, 0xF4, 0x0F, 0x3D, 0x02, 0x46, 0xC8, 0xE8, 0x81, 0xA5, 0xF3, 0x89, 0xD7, 0x76,
+    0xA2, 0x40, 0x62, 0x57, 0x69, 0x87, 0x0B, 0xBF, 0x49, 0x3B, 0x97, 0xE0, 0x2A, 0x0E, 0xAD, 0x0E,
+    0xB8, 0x00, 0x14, 0x28, 0x00, 0x17, 0xFD, 0x80, 0x2C, 0xCB, 0xBD, 0xF9, 0x08, 0x11, 0xCF, 0xF1,
+    0xE5, 0x22, 0xFD, 0x9B, 0x0D, 0x17, 0x39, 0xBC, 0x51, 0x71, 0x1F, 0xF6, 0xB0, 0x22, 0xF6, 0x84,
+    0x0B, 0xCD, 0x0D, 0x2E, 0x74, 0xB6, 0x8B, 0x42, 0x53, 0xA1, 0x0B, 0x2E, 0x1A, 0x1D, 0xC2, 0x26,
+    0x01, 0xE2, 0x9E, 0xE4, 0xFC, 0x71, 0x09, 0x72, 0x62, 0x51, 0x58, 0x12, 0xEA, 0x0D, 0x74, 0xB1,
+    0x8A, 0x8F, 0x9E, 0x9D, 0x2D, 0x8C, 0xAA, 0x7A, 0x15, 0x87, 0x04, 0x93, 0x80, 0x53, 0x3A, 0x12,
+    0x88, 0x2E, 0x02, 0xE9, 0x54, 0xC3, 0x97, 0x32, 0xE3, 0x6A, 0x23, 0x51, 0x2D, 0xAA, 0x0A, 0xDC,
+    0xDF, 0x64, 0xE2, 0xF6, 0xD7, 0xBB, 0xB4, 0x37, 0x8A, 0x22, 0xC7, 0x9F, 0x6F, 0x74, 0xAC, 0x76,
+    0xFD, 0x8E, 0xCD, 0xB7, 0xF2, 0x42, 0x7F, 0xC2, 0x85, 0x6E, 0x8E, 0x17, 0x63, 0x8F, 0x44, 0xF6,
+    0x92, 0xB8, 0x27, 0x47, 0xDC, 0xD2, 0xAF, 0x26, 0xA4, 0x38, 0x41, 0xCE, 0x75, 0xA6, 0xFE, 0x7B,
+    0x28, 0xA5, 0x7F, 0x4A, 0x99, 0xEC, 0x14, 0x8D, 0x7B, 0x6F, 0x80, 0x1F, 0x03, 0x70, 0x95, 0x8D,
+    0x6E, 0x5D, 0x0D, 0x3B, 0x1B, 0xD2, 0xB6, 0xDE, 0xE4, 0x60, 0xF5, 0xAD, 0x6D, 0xF5, 0xAC, 0xAC,
+    0x50, 0x92, 0x00, 0x6F, 0x4D, 0x76, 0xC3, 0x55, 0x9F, 0x62, 0x6D, 0xF6, 0x1A, 0x2F, 0x05, 0x70,
+    0xCC, 0x57, 0x03, 0xA5, 0x54, 0xB3, 0xDB, 0xD9, 0x0A, 0x9D, 0xB8, 0x1C, 0xA9, 0xD3, 0xAF, 0x11,
+    0xB2, 0x9D, 0x3D, 0x30, 0x65, 0xF6, 0x7C, 0x48, 0xEC, 0xBE, 0x8D, 0xFD, 0x1C, 0x07, 0xC4, 0x75,
+    0x0B, 0xBA, 0xA5, 0x00, 0xDB, 0x08, 0x35, 0xC1, 0x0A, 0x84, 0xEC, 0x4C, 0x02, 0xFD, 0xE0, 0x56,
+    0x58, 0x5D, 0xA8, 0xE8, 0x50, 0xE8, 0xDC, 0x2E, 0xE2, 0x91, 0x2C, 0x60, 0x76, 0xCC, 0xE4, 0x6E,
+    0xB6, 0xAC, 0x52, 0xEF, 0x2C, 0xBC, 0x63, 0x81, 0xEE, 0xFE, 0xC1, 0x02, 0x38, 0x46, 0x51, 0xD8,
+    0xC0, 0xB3, 0xB0, 0xA8, 0x73, 0xA1, 0xB9, 0xD5, 0xA9, 0xCC, 0x1A, 0xFE, 0x4E, 0x20, 0x34, 0xC6,
+    0x11, 0xC9, 0x68, 0x18, 0x9B, 0x55, 0xF7, 0x7E, 0x70, 0x8B, 0xAE, 0xB1, 0x73, 0xB3, 0xCE, 0x0A,
+    0xA8, 0xFA, 0xBB, 0x02, 0x8A, 0xBE, 0xC6, 0x10, 0x48, 0x57, 0x00, 0x03, 0x24, 0x10, 0x53, 0x1C,
+    0x39, 0x83, 0x1E, 0x75, 0x72, 0xF1, 0xC2, 0x86, 0x17, 0x5A, 0x17, 0xC5, 0xC4, 0xA6, 0xB1, 0x15,
+    0x65, 0xC6, 0x11, 0x83, 0xA4, 0xA1, 0x0A, 0x79, 0x04, 0x4A, 0x60, 0x86, 0x3E, 0xFD, 0xCC, 0xA1,
+    0xC6, 0xEA, 0x25, 0x1E, 0x41, 0x52, 0x84, 0xB2, 0xDE, 0x9E, 0x58, 0x38, 0xB6, 0x9F, 0x8D, 0x96,
+    0xE1, 0x58, 0xD9, 0x8F, 0x18, 0x92, 0xD6, 0x6A, 0x6E, 0xA7, 0x62, 0x5A, 0x78, 0xCD, 0xA6, 0xED,
+    0x5D, 0xA0, 0x4B, 0x4F, 0xE1, 0x17, 0x71, 0x3D, 0x7A, 0x37, 0xB1, 0x0B, 0x59, 0x26, 0xA7, 0xBF,
+    0xE2, 0x00, 0x43, 0x30, 0x82, 0xE1, 0x08, 0x9E, 0x58, 0xFF, 0x3E, 0x71, 0x42, 0xB8, 0x85, 0x13,
+    0x14, 0x18, 0x91, 0x02, 0x66, 0x0D, 0x47, 0x6A, 0xCF, 0x39, 0x07, 0x9C, 0xAC, 0x82, 0x5B, 0x4B,
+    0xD3, 0x87, 0xD8, 0xEC, 0x24, 0xCE, 0x52, 0x07, 0xA7, 0xCF, 0x2E, 0x35, 0x19, 0xA6, 0x99, 0x93,
+    0x00, 0x6C, 0x62, 0x30, 0xA0, 0xB4, 0x95, 0xAD, 0xAC, 0xF5, 0x42, 0x1C, 0xFA, 0x49, 0xEF, 0x72,
+    0x9E, 0x1E, 0xDB, 0x31, 0xAB, 0x02, 0xED, 0xFA, 0x5F, 0x2E, 0x51, 0x86, 0xAE, 0x81, 0x0F, 0x88,
+    0x11, 0x35, 0x76, 0xA8, 0x01, 0x7A, 0x1B, 0xD1, 0xFC, 0x08, 0x52, 0x03, 0xCA, 0x80, 0xEE, 0x6C,
+    0x50, 0xB1, 0xCE, 0xD1, 0xD2, 0xD1, 0xB2, 0xA5, 0x65, 0xA0, 0x65, 0x48, 0xC6, 0x3F, 0xBB, 0x66,
+    0x34, 0xF6, 0x49, 0xFE, 0xF1, 0xE9, 0xD9, 0x8D, 0xE1, 0x6E, 0x9C, 0xCE, 0x98, 0xE7, 0xC5, 0xCE,
+    0x32, 0x85, 0x81, 0xA1, 0x26, 0x61, 0x51, 0x25, 0xBC, 0x7B, 0xB9, 0xF1, 0x71, 0xB6, 0x39, 0x67,
+    0x13, 0xCC, 0x66, 0x20, 0xDF, 0xC6, 0xCF, 0x93, 0xA7, 0x8E, 0x9C, 0x51, 0x99, 0x6D, 0xC0, 0xB1,
+    0x83, 0x4D, 0xFF, 0x6C, 0x1B, 0xF1, 0x7C, 0xE2, 0xF2, 0x7F, 0xD3, 0xBB, 0xD0, 0x7F, 0x8C, 0xF1,
+    0x89, 0x3C, 0x6C, 0x72, 0xCC, 0xE7, 0x5E, 0x3F, 0x2E, 0x88, 0xD2, 0xB1, 0x85, 0xF8, 0x72, 0x9C,
+    0xCF, 0xBF, 0x5E, 0xA5, 0x8D, 0x2B, 0x93, 0x6B, 0xAD, 0xC7, 0xF4, 0xB6, 0x51, 0x6B, 0xF3, 0xC1,
+    0xAC, 0xF4, 0xDD, 0x65, 0x22, 0xBF, 0x2C, 0xF5, 0xE1, 0x0B, 0x6E, 0x2B, 0xFB, 0x39, 0x71, 0x46,
+    0xB4, 0x3F, 0xE6, 0xCA, 0xFF, 0xF1, 0xF9, 0x17, 0xAD, 0x55, 0x31, 0x8E, 0xDD, 0x36, 0x10, 0x1D,
+    0x89, 0xF0, 0x12, 0x08, 0x0B, 0x36, 0x71, 0xE5, 0x00, 0x3A, 0x82, 0x4E, 0x60, 0x53, 0x9B, 0x36,
+    0x45, 0x52, 0x24, 0x39, 0x44, 0xCE, 0x10, 0x58, 0x4A, 0xDA, 0x34, 0x3E, 0x82, 0x0B, 0x17, 0xE9,
+    0xF6, 0x02, 0x1B, 0x8B, 0x4E, 0xCA, 0x34, 0xF2, 0x0D, 0x54, 0x04, 0x08, 0xE0, 0x8A, 0x85, 0x12,
+    0x70, 0x17, 0x14, 0x99, 0xF7, 0x28, 0xFD, 0xDD, 0xB8, 0xB7, 0x3E, 0xFE, 0x08, 0xA2, 0xA8, 0x99,
+    0x37, 0x6F, 0xDE, 0x0C, 0x9F, 0x7C, 0x87, 0xAB, 0x2F, 0xA5, 0x64, 0x07, 0xB3, 0xD3, 0xA4, 0x91,
+    0x46, 0xDA, 0x2C, 0x22, 0x6A, 0x87, 0xD1, 0x09, 0xC6, 0xD0, 0xD8, 0x48, 0xB3, 0xC1, 0xF4, 0x01,
+    0xC6, 0x55, 0xB3, 0xC2, 0x8C, 0x0B, 0xCC, 0xEC, 0x61, 0x0A, 0x4C, 0x53, 0x26, 0x91, 0xB6, 0x0C,
+    0xF8, 0xBE, 0xC8, 0x69, 0x0C, 0x8D, 0x38, 0x2F, 0xB3, 0x98, 0x4D, 0xDC, 0xD4, 0x64, 0xE9, 0x3D,
+    0x9E, 0xBB, 0x05, 0x0E, 0x6D, 0x10, 0x95, 0x35, 0xFC, 0xCE, 0x7F, 0x20, 0x4C, 0xF7, 0x6F, 0xE2,
+    0x47, 0x8C, 0x5F, 0xF8, 0x55, 0x4F, 0x4F, 0xBA, 0x54, 0xEF, 0xCB, 0x25, 0xA2, 0x0D, 0x17, 0x3C,
+    0x5D, 0xE2, 0xDB, 0x9D, 0x11, 0xEB, 0x27, 0x34, 0x8E, 0x2F, 0x9E, 0x0C, 0x72, 0xB9, 0x5A, 0xE4,
+    0x26, 0xC8, 0x2B, 0xEB, 0xE8, 0xFC, 0xAD, 0x43, 0x6E, 0xFF, 0x04, 0xBB, 0x99, 0x3F, 0xBD, 0xF3,
+    0xAE, 0xFF, 0xB2, 0xE8, 0x38, 0x23, 0xE7, 0xF7, 0xA4, 0x41, 0xC1, 0xAC, 0xD8, 0x9E, 0xCF, 0xF4,
+    0x98, 0x8A, 0xDE, 0x2F, 0xC9, 0x12, 0x84, 0x66, 0x80, 0x9E, 0x24, 0x20, 0x51, 0xAC, 0x2F, 0x84,
+    0x41, 0x52, 0x66, 0xCF, 0x8D, 0x3A, 0x37, 0xC4, 0xEB, 0x02, 0x39, 0x69, 0xCB, 0x4D, 0xA5, 0xAC,
+    0x82, 0x42, 0x36, 0x53, 0x65, 0x62, 0x95, 0x0B, 0x44, 0x00, 0x9F, 0xAA, 0x1F, 0xB2, 0x0B, 0x80,
+    0x4B, 0xDD, 0x7C, 0x90, 0x56, 0x6A, 0xC0, 0xBF, 0xB9, 0xC1, 0x25, 0x97, 0xF8, 0xA2, 0xC5, 0x06,
+    0x55, 0x7C, 0x87, 0x0D, 0xF3, 0x26, 0xD8, 0xD0, 0x67, 0xB8, 0xC3, 0x86, 0xCF, 0xA6, 0xE6, 0x0D,
+    0x98, 0xB5, 0x8B, 0x8A, 0x32, 0xE2, 0xD6, 0x26, 0x3E, 0xAD, 0x2A, 0x89, 0x1B, 0xEC, 0xDA, 0x24,
+    0x19, 0x07, 0x1B, 0xB0, 0xE8, 0x26, 0x1B, 0x9A, 0x1D, 0x37, 0x53, 0x6F, 0x1E, 0x4F, 0x19, 0x37,
+    0xB3, 0x1D, 0xB7, 0x08, 0xE8, 0x94, 0xC0, 0x40, 0x05, 0x68, 0x32, 0x41, 0x69, 0x10, 0x0D, 0xC1,
+    0xF6, 0x44, 0xC7, 0xA7, 0xAB, 0x37, 0x22, 0xDF, 0xC8, 0xE7, 0x2A, 0x48, 0x52, 0xA1, 0x49, 0x7A,
+    0x69, 0xA3, 0xF5, 0x6A, 0xB3, 0x83, 0x0E, 0xBD, 0x98, 0xF0, 0x02, 0x91, 0x9F, 0x83, 0x97, 0x97,
+    0x4D, 0xF1, 0xE0, 0xDC, 0xC3, 0xE3, 0x04, 0x3F, 0x83, 0xCE, 0x8E, 0x79, 0xE3, 0xFF, 0x12, 0x7F,
+    0x72, 0x8A, 0xA4, 0x80, 0x4D, 0x9E, 0x0E, 0xD2, 0x7C, 0x2B, 0xA5, 0xDD, 0x89, 0xD8, 0x86, 0x71,
+    0xE8, 0x56, 0xF7, 0x33, 0x32, 0xB8, 0xDE, 0x6D, 0x50, 0xC9, 0x04, 0xA2, 0x76, 0xEF, 0x50, 0xC0,
+    0x29, 0x9B, 0xD0, 0xEE, 0x7A, 0xE3, 0x42, 0xEF, 0xB9, 0x50, 0x34, 0x16, 0x54, 0xEC, 0x91, 0x49,
+    0xE7, 0x99, 0xC3, 0xAC, 0x90, 0x8B, 0x8A, 0x1D, 0x72, 0xB2, 0xCB, 0x2C, 0xCC, 0x26, 0x82, 0xF8,
+    0x52, 0x16, 0xE6, 0x53, 0xA4, 0xAF, 0xE2, 0x3E, 0xAF, 0x72, 0xFD, 0xEB, 0x43, 0xC8, 0xE0, 0x7E,
+    0x67, 0xC8, 0x5C, 0x43, 0x6E, 0x1F, 0x87, 0x4C, 0x08, 0xE9, 0x19, 0x12, 0x11, 0x10, 0x72, 0x6B,
+    0x6A, 0x48, 0x13, 0x3A, 0x46, 0x98, 0x66, 0xB0, 0xB3, 0xC3, 0xCB, 0xA2, 0x83, 0x5D, 0xC6, 0x1A,
+    0xA1, 0x4C, 0x34, 0x85, 0x62, 0x2A, 0x5B, 0x5D, 0xF0, 0xE8, 0xB3, 0xEF, 0x99, 0xF3, 0xA1, 0x5C,
+    0x99, 0x59, 0x77, 0x75, 0x41, 0xE2, 0x50, 0xCB, 0x0E, 0xB8, 0x0C, 0x75, 0x2C, 0x3D, 0x77, 0x41,
+    0x69, 0x20, 0x58, 0x9A, 0x58, 0x35, 0x3D, 0x61, 0x4B, 0xC2, 0x96, 0xE2, 0xCD, 0x0A, 0x84, 0x1B,
+    0x68, 0x4B, 0xA8, 0xC5, 0x08, 0x3F, 0xEE, 0x43, 0x59, 0xA0, 0x99, 0x55, 0x1F, 0xC2, 0x7D, 0xF5,
+    0x20, 0x7A, 0x31, 0x7F, 0x1D, 0xCE, 0xD7, 0x23, 0xD9, 0xE1, 0x6A, 0xAA, 0x21, 0x59, 0x81, 0x2E,
+    0x48, 0xAC, 0x28, 0xF4, 0x52, 0xBB, 0xDC, 0x1D, 0xC0, 0x88, 0x67, 0x9C, 0x34, 0xE2, 0xB6, 0xBB,
+    0xF4, 0x53, 0x5D, 0xAB, 0xC1, 0x3D, 0x52, 0xF1, 0x90, 0x7B, 0x45, 0x10, 0xE5, 0x2D, 0x62, 0xBB,
+    0xA5, 0xC2, 0x28, 0x80, 0x6A, 0x83, 0xA1, 0xE0, 0x80, 0x25, 0xA8, 0x7C, 0xB3, 0xA3, 0x69, 0x2A,
+    0x20, 0xB6, 0x1C, 0x18, 0xDB, 0x2A, 0xAA, 0xDA, 0xBF, 0xD2, 0xCE, 0x27, 0x36, 0xB6, 0x38, 0x70,
+    0x75, 0x68, 0x95, 0xDB, 0x23, 0x53, 0x66, 0xFC, 0x96, 0xC2, 0xBF, 0xAF, 0x2D, 0x00, 0xE5, 0xB4,
+    0xF1, 0x60, 0xD5, 0x89, 0x7B, 0x97, 0xDA, 0x6C, 0xEF, 0xE7, 0x0D, 0xF5, 0xFC, 0x09, 0x15, 0x35,
+    0x25, 0x3F, 0x36, 0x37, 0xAE, 0x67, 0xC7, 0x88, 0x60, 0x8C, 0x99, 0xD6, 0xDC, 0xB1, 0xB1, 0xE6,
+    0x01, 0xA3, 0x07, 0x63, 0x45, 0x53, 0xF8, 0x27, 0xEF, 0x98, 0x40, 0xBA, 0x6A, 0xBA, 0xA7, 0x30,
+    0xA8, 0x8C, 0x45, 0x4E, 0x59, 0x63, 0xC6, 0x35, 0x65, 0x6D, 0xE6, 0x53, 0x29, 0x1D, 0x6B, 0x47,
+    0x18, 0xF0, 0x54, 0x55, 0xD4, 0xB0, 0x33, 0x18, 0xE0, 0x95, 0x7C, 0x7C, 0x3D, 0x95, 0x67, 0x77,
+    0xE0, 0xAD, 0xE1, 0xCE, 0xDF, 0x34, 0x3D, 0xA6, 0x2E, 0xDF, 0xAC, 0x92, 0xDC, 0x8A, 0x3E, 0x8B,
+    0xE3, 0xA4, 0x42, 0xBB, 0x15, 0x24, 0xA9, 0x50, 0x5E, 0xDA, 0x24, 0x1A, 0xE5, 0x8A, 0x62, 0x16,
+    0x83, 0x10, 0x16, 0xE5, 0x43, 0x2B, 0x7B, 0xFB, 0x0B, 0xC2, 0x4D, 0xDD, 0x57, 0xA9, 0x85, 0x4C,
+    0x0D, 0x47, 0xD0, 0x0B, 0x4D, 0xB1, 0x3E, 0x57, 0x04, 0xF2, 0x63, 0x43, 0xC7, 0xB7, 0xD2, 0xDF,
+    0x3D, 0x06, 0x6E, 0xE6, 0x72, 0xA6, 0x6D, 0x38, 0x2E, 0xD0, 0x0B, 0x91, 0x54, 0xEE, 0x82, 0x56,
+    0x1F, 0x45, 0x8E, 0x11, 0x0B, 0x25, 0x4B, 0xB7, 0x41, 0xA3, 0x8A, 0x43, 0x90, 0xFC, 0x0C, 0x24,
+    0xD8, 0xD3, 0x04, 0x0C, 0xAE, 0x91, 0xD3, 0x0B, 0x43, 0xCD, 0x24, 0x55, 0x48, 0x58, 0xF1, 0x6D,
+    0x99, 0xC6, 0xD0, 0x94, 0x05, 0x23, 0xAA, 0x04, 0x9B, 0x65, 0xC6, 0x2C, 0xF8, 0x3F, 0xDD, 0x57,
+    0x3B, 0xE9, 0xC3, 0x3A, 0xFC, 0x65, 0x8D, 0x5E, 0x40, 0x83, 0xA0, 0x49, 0x0C, 0xC6, 0x8E, 0xF5,
+    0x6D, 0xEC, 0x06, 0x74, 0x87, 0xA8, 0xCD, 0x81, 0x72, 0x88, 0x33, 0xA0, 0x66, 0x01, 0x6C, 0x07,
+    0x5B, 0x05, 0x3A, 0x3D, 0xFA, 0xF9, 0x82, 0xBE, 0x36, 0x56, 0x6F, 0xE5, 0x84, 0xAE, 0x88, 0x06,
+    0x71, 0x79, 0x3F, 0x06, 0xED, 0x79, 0x02, 0xFD, 0x30, 0x30, 0xC5, 0x8D, 0x2F, 0x77, 0x1A, 0x54,
+    0x26, 0x6B, 0x30, 0xB4, 0x91, 0x26, 0x38, 0xA4, 0x10, 0xA1, 0xB2, 0xC5, 0xA2, 0xCA, 0xF7, 0x73,
+    0x64, 0xDD, 0xC2, 0x91, 0xE0, 0x71, 0x86, 0xCC, 0xAF, 0x69, 0x32, 0x52, 0x83, 0x2C, 0xDF, 0x8F,
+    0x20, 0xE6, 0xB6, 0xDD, 0x54, 0xB0, 0xBE, 0xC7, 0xAC, 0x8B, 0x64, 0xD5, 0x7E, 0xB8, 0xF1, 0x4E,
+    0xFA, 0xEB, 0x24, 0xBB, 0xB9, 0xAF, 0x78, 0xD1, 0xBE, 0x51, 0x57, 0x8D, 0x31, 0x1E, 0x16, 0x3C,
+    0xBD, 0x42, 0xF8, 0xC7, 0x89, 0x48, 0xB5, 0x8C, 0x40, 0xD8, 0xAF, 0xC7, 0x71, 0xA8, 0xEB, 0xE9,
+    0x73, 0x9E, 0x0F, 0x6C, 0xB7, 0x0E, 0x8B, 0x66, 0x7F, 0x48, 0x94, 0xED, 0xDD, 0x1C, 0x09, 0xF2,
+    0x5C, 0xF9, 0x7A, 0x43, 0x81, 0x20, 0x44, 0xBB, 0xE2, 0x9B, 0x51, 0xA3, 0x32, 0x09, 0xB3, 0x15,
+    0x4F, 0x83, 0x14, 0xF4, 0xA7, 0x8D, 0xA8, 0xD8, 0xEC, 0xC7, 0x89, 0xC3, 0x6B, 0xBD, 0xCC, 0x91,
+    0xC8, 0xD4, 0x3D, 0x74, 0x9C, 0xF1, 0x33, 0x41, 0x3E, 0xCD, 0xF5, 0x1F, 0xAD, 0x55, 0xBD, 0x8E,
+    0xD6, 0x46, 0x14, 0xBD, 0xE3, 0xD1, 0xE2, 0xC2, 0x52, 0xA6, 0x81, 0x22, 0xA2, 0x98, 0x3E, 0x11,
+    0xCC, 0x0B, 0xAC, 0xBE, 0x99, 0x68, 0x0B, 0x4A, 0xB6, 0xA0, 0xA7, 0xA7, 0xE1, 0x05, 0x08, 0x36,
+    0xA2, 0xA0, 0xDD, 0x37, 0x48, 0x1A, 0xA4, 0x84, 0x67, 0x58, 0x98, 0x59, 0x28, 0x52, 0x50, 0xC4,
+    0x0A, 0x52, 0x28, 0xB1, 0x12, 0x94, 0x26, 0xC5, 0x8E, 0xC2, 0x44, 0x18, 0x18, 0xFB, 0xE6, 0x5C,
+    0xEF, 0x12, 0x48, 0x9F, 0x59, 0xF9, 0xB3, 0xD7, 0x77, 0xE6, 0xFE, 0x9C, 0x7B, 0xCE, 0x35, 0xA9,
+    0x38, 0x90, 0xE6, 0x8A, 0x2B, 0x26, 0x5D, 0x55, 0x69, 0xEA, 0xDE, 0x13, 0x62, 0xE6, 0x21, 0x32,
+    0x4F, 0x9E, 0x79, 0xB6, 0xEB, 0xC3, 0xC3, 0x2E, 0x13, 0x35, 0x0B, 0x11, 0xC5, 0xD7, 0xED, 0x68,
+    0x99, 0xB3, 0x66, 0x1C, 0xF1, 0xBC, 0x92, 0x8A, 0xAF, 0x49, 0x3D, 0x1A, 0x1E, 0x85, 0xAF, 0x86,
+    0x5B, 0x47, 0x66, 0xE9, 0x66, 0x5D, 0xED, 0x4C, 0x3E, 0xF7, 0x43, 0x3C, 0x80, 0x95, 0x1F, 0x54,
+    0x93, 0x79, 0xA0, 0xAE, 0xF6, 0x27, 0x8B, 0x9F, 0x88, 0xFC, 0x9B, 0xEA, 0x7F, 0x9E, 0x09, 0x96,
+    0xF8, 0xD3, 0x87, 0x15, 0x1E, 0x3B, 0xAE, 0x11, 0x1B, 0x60, 0xE1, 0x57, 0x8C, 0x0D, 0xB0, 0x20,
+    0x28, 0xEE, 0x64, 0xF0, 0x20, 0x77, 0x7D, 0xFE, 0x42, 0x0C, 0xDB, 0x8E, 0x28, 0x0F, 0x83, 0x9C,
+    0x70, 0x6B, 0x0F, 0x1F, 0x96, 0x9F, 0xF2, 0x2F, 0xD8, 0xD2, 0x71, 0x76, 0xD5, 0xF0, 0xD4, 0x72,
+    0xD5, 0x3C, 0xF4, 0xD8, 0x72, 0x7B, 0x54, 0x3C, 0xAB, 0xB0, 0x4F, 0xB4, 0x4F, 0x7B, 0x85, 0x18,
+    0xFF, 0x8E, 0xA4, 0x33, 0x35, 0xF9, 0x8B, 0x9B, 0x93, 0xE3, 0xE4, 0x79, 0x70, 0xEF, 0x88, 0x16,
+    0xB2, 0x93, 0x49, 0xED, 0xA2, 0xAA, 0xE2, 0xE4, 0x86, 0xBE, 0xEA, 0xD9, 0xC0, 0xC1, 0x01, 0xCF,
+    0x5D, 0xE6, 0x3E, 0xB0, 0x7F, 0x99, 0xCD, 0x69, 0x61, 0xC5, 0xAB, 0xC1, 0xA9, 0x7B, 0x8B, 0x06,
+    0x32, 0xC9, 0x57, 0x5D, 0x5B, 0x26, 0x14, 0x9A, 0xBA, 0x42, 0x9F, 0xD6, 0xA2, 0x16, 0x49, 0x3D,
+    0x21, 0xCD, 0x82, 0xDC, 0x81, 0xDA, 0x85, 0x1F, 0xCF, 0x2C, 0x6D, 0xDA, 0x0B, 0x54, 0x9B, 0x4A,
+    0x66, 0xE8, 0x07, 0x55, 0x6C, 0x21, 0xA7, 0x19, 0xE9, 0x70, 0xA6, 0x9D, 0x5B, 0xA9, 0x7B, 0xFE,
+    0x6A, 0xA4, 0xE5, 0x6F, 0x98, 0x57, 0x3F, 0x28, 0x7E, 0x06, 0x73, 0x8E, 0xA4, 0x17, 0x93, 0xA9,
+    0xBF, 0x27, 0x50, 0xB5, 0x39, 0x06, 0x5D, 0x62, 0x50, 0x35, 0x06, 0x5A, 0xFA, 0x40, 0x1E, 0x77,
+    0xC7, 0x01, 0xE1, 0x02, 0x8A, 0x0F, 0x88, 0x96, 0x80, 0x52, 0x25, 0x92, 0xF0, 0xFD, 0xED, 0x4A,
+    0xEE, 0x19, 0x27, 0x33, 0xF5, 0x55, 0xC0, 0x84, 0x17, 0x4E, 0xCD, 0xFB, 0x27, 0x64, 0x9E, 0x16,
+    0xF2, 0x26, 0x35, 0x65, 0x47, 0xE6, 0xA4, 0xD0, 0x4E, 0x1E, 0x3D, 0x1E, 0x67, 0xBA, 0xDB, 0x8D,
+    0x1D, 0x1E, 0xFD, 0x49, 0x55, 0x3F, 0x5C, 0x38, 0x3A, 0x4B, 0xFA, 0x12, 0xA9, 0x43, 0xB5, 0x02,
+    0xA0, 0xAE, 0x12, 0x07, 0x9F, 0x3B, 0xC1, 0xA8, 0xCF, 0x1D, 0x03, 0x62, 0xBF, 0xB8, 0x85, 0x3E,
+    0xBC, 0xE3, 0xDC, 0x9D, 0x9E, 0x9E, 0x26, 0xDF, 0xAF, 0x91, 0x2A, 0xBF, 0x99, 0xDB, 0xBF, 0xF8,
+    0xBB, 0xD1, 0x3F, 0xAF, 0x91, 0x56, 0xFB, 0xA2, 0xB6, 0xA5, 0xB7, 0x93, 0x4B, 0x87, 0xC8, 0x6F,
+    0x5B, 0x36, 0x01, 0x01, 0x37, 0x68, 0xB0, 0x24, 0xB4, 0x85, 0x7A, 0x02, 0xB9, 0x22, 0xA1, 0xC8,
+    0x95, 0xCC, 0x04, 0xEC, 0xDC, 0x08, 0xBB, 0x4F, 0xD2, 0xF5, 0xD4, 0x4A, 0xA3, 0x3B, 0xFC, 0x84,
+    0x8D, 0x0C, 0x36, 0x37, 0x4C, 0x6E, 0xD2, 0x2B, 0xF9, 0x51, 0x03, 0x58, 0x15, 0x8F, 0x50, 0xF3,
+    0x4A, 0xD8, 0x36, 0xEA, 0xB5, 0xAD, 0x78, 0x87, 0x98, 0xE4, 0x52, 0x84, 0x53, 0x3F, 0xE8, 0x0A,
+    0x87, 0x2B, 0x62, 0xA0, 0x73, 0x92, 0x34, 0x76, 0xC1, 0xCD, 0x04, 0xCF, 0x19, 0xDC, 0x99, 0xA8,
+    0x11, 0x12, 0x09, 0xA7, 0xF0, 0x76, 0x11, 0x76, 0x25, 0x07, 0x09, 0x68, 0x44, 0x47, 0x7F, 0xDA,
+    0x82, 0xAE, 0x32, 0xFE, 0x4C, 0x36, 0x59, 0xAD, 0x80, 0xC0, 0x8D, 0x6E, 0xDC, 0xCC, 0x7D, 0xF2,
+    0xA9, 0x9B, 0x5B, 0xC1, 0x23, 0x0E, 0x48, 0xFC, 0x7C, 0xED, 0x1D, 0x82, 0xCD, 0x6F, 0x81, 0x3C,
+    0x6D, 0xC4, 0x35, 0xFC, 0x2B, 0x68, 0x01, 0xE7, 0x03, 0x41, 0x11, 0xC7, 0x88, 0x46, 0x26, 0x11,
+    0x34, 0x30, 0xA3, 0xA7, 0x64, 0x03, 0xF5, 0x23, 0x98, 0x68, 0xC4, 0xB3, 0x1C, 0x48, 0xE8, 0xE4,
+    0x46, 0x18, 0xD4, 0x23, 0x0C, 0x47, 0x57, 0xCB, 0xAD, 0x80, 0x76, 0x8A, 0x6B, 0x51, 0x0E, 0x21,
+    0x20, 0xD6, 0xA6, 0x15, 0x2B, 0x41, 0xF5, 0x4A, 0xFF, 0x5D, 0x97, 0xE1, 0x96, 0x73, 0x0B, 0x07,
+    0x7C, 0x74, 0xE8, 0x13, 0xA1, 0x72, 0xE0, 0x01, 0x54, 0x09, 0xB0, 0x22, 0x7D, 0x6A, 0x56, 0x45,
+    0xF6, 0xFD, 0x8C, 0x70, 0x23, 0x20, 0x03, 0x65, 0x06, 0x08, 0x7C, 0xC5, 0x55, 0x81, 0x4D, 0xBD,
+    0x61, 0xD3, 0x45, 0x60, 0x87, 0x68, 0x72, 0x21, 0x0C, 0xD8, 0x45, 0x12, 0x1E, 0x97, 0x24, 0x29,
+    0x88, 0xCB, 0x25, 0x79, 0x74, 0xF5, 0x3C, 0x26, 0xF6, 0x0A, 0x44, 0x24, 0x44, 0x95, 0x43, 0x71,
+    0x80, 0x07, 0x9B, 0xED, 0x78, 0x46, 0x5C, 0xE2, 0x07, 0x48, 0xC2, 0xBD, 0x81, 0x7E, 0x5B, 0x21,
+    0x26, 0x49, 0x75, 0x00, 0x7F, 0x13, 0x7E, 0x10, 0x4D, 0xA7, 0x33, 0x27, 0xD8, 0x24, 0x35, 0x3A,
+    0x1C, 0xD9, 0x8B, 0x45, 0xD0, 0x9B, 0x69, 0x9B, 0x4B, 0xD8, 0x22, 0xE2, 0x8F, 0xD3, 0x59, 0xBC,
+    0x46, 0xEE, 0x97, 0xE2, 0x43, 0x02, 0x9B, 0xA1, 0x2D, 0x60, 0x86, 0x8A, 0x17, 0x93, 0xA0, 0x52,
+    0x05, 0xD9, 0xBA, 0xE4, 0x07, 0x7F, 0x7F, 0xD6, 0x45, 0xCF, 0x1E, 0xD4, 0xEA, 0x0F, 0x72, 0x87,
+    0xF6, 0xF9, 0xB0, 0x6A, 0xD6, 0xCB, 0xCD, 0x3F, 0x78, 0x74, 0xDB, 0x30, 0x61, 0x39, 0xAB, 0xE2,
+    0x59, 0x32, 0x61, 0x93, 0x96, 0x38, 0x8F, 0xDB, 0xD8, 0xD9, 0x86, 0xD0, 0xF2, 0x09, 0x56, 0x00,
+    0x07, 0x95, 0x56, 0x81, 0x21, 0x06, 0xFC, 0xD8, 0x89, 0x05, 0x08, 0xDE, 0x26, 0x51, 0xA0, 0x4D,
+    0x7D, 0x48, 0x75, 0xAB, 0x66, 0x44, 0x86, 0x92, 0x74, 0x23, 0x0D, 0x6C, 0xB8, 0xCF, 0x30, 0x5C,
+    0x5B, 0xC5, 0xCA, 0x60, 0x74, 0x70, 0xF3, 0xB9, 0x4F, 0xD0, 0x38, 0x99, 0x8C, 0x79, 0x0B, 0x2A,
+    0x0F, 0x6E, 0x6C, 0x0B, 0xFC, 0x47, 0xE0, 0x80, 0x77, 0x33, 0x18, 0xDC, 0x93, 0x19, 0xBB, 0xAC,
+    0xEA, 0x46, 0x66, 0x33, 0xEA, 0x59, 0x09, 0x29, 0x25, 0xF7, 0x46, 0x0A, 0x46, 0xC7, 0x96, 0x4D,
+    0x1F, 0x48, 0x7C, 0x3E, 0x6B, 0x10, 0xB2, 0x22, 0x45, 0x17, 0xAF, 0x34, 0x63, 0x36, 0x6D, 0xB8,
+    0xB3, 0xDF, 0x4C, 0x93, 0xBD, 0x76, 0x52, 0xAD, 0x6C, 0x4E, 0x5F, 0x5E, 0x25, 0x02, 0xB5, 0x40,
+    0x31, 0xEC, 0x55, 0x37, 0xCC, 0x04, 0x48, 0x4E, 0x16, 0xB5, 0xEA, 0xEA, 0x92, 0x1B, 0xFB, 0x03,
+    0x90, 0x5A, 0xF4, 0xE2, 0x13, 0xB7, 0xA5, 0x9D, 0xCD, 0x14, 0x29, 0x7E, 0xB3, 0x08, 0x70, 0x36,
+    0x81, 0x4B, 0x4D, 0x35, 0xA3, 0x9D, 0xFC, 0x3D, 0x4C, 0x2E, 0x5D, 0x00, 0xB0, 0x20, 0x28, 0xD1,
+    0x39, 0xF4, 0x92, 0x8C, 0xC8, 0x73, 0xFD, 0x9F, 0xFC, 0xF2, 0x7D, 0xF9, 0x29, 0xE2, 0x97, 0xC5,
+    0xAF, 0xE0, 0x29, 0xD0, 0x0B, 0xD4, 0xC2, 0x7B, 0x23, 0x83, 0x16, 0x42, 0x02, 0x81, 0x0C, 0xAA,
+    0xD7, 0x30, 0xA3, 0x71, 0x77, 0x48, 0x0A, 0x33, 0x98, 0x01, 0x90, 0x71, 0xB6, 0xC3, 0xB1, 0x9E,
+    0x76, 0xBA, 0x98, 0xD3, 0xDA, 0xC9, 0x87, 0xE0, 0x23, 0xE4, 0x74, 0x55, 0x1A, 0xDD, 0x4D, 0x0A,
+    0x73, 0xB2, 0x28, 0x34, 0xB9, 0x02, 0x13, 0xBA, 0x8B, 0x2F, 0x03, 0xB9, 0x60, 0x71, 0x3E, 0x75,
+    0xF0, 0x88, 0x2F, 0x5B, 0x56, 0x42, 0x10, 0x7A, 0x4C, 0x77, 0xBA, 0xD1, 0x87, 0x9D, 0x2A, 0x26,
+    0x99, 0x80, 0x42, 0xDA, 0x3F, 0x51, 0x18, 0xF0, 0x47, 0x53, 0x50, 0x70, 0x1F, 0xB6, 0x59, 0x46,
+    0xF4, 0x3D, 0xE6, 0x3A, 0x7D, 0x04, 0xD8, 0x1E, 0x92, 0xB4, 0x66, 0xB1, 0x6A, 0x3E, 0xD6, 0xBF,
+    0x4F, 0xFE, 0xFA, 0x29, 0xA4, 0xF5, 0xE2, 0x3C, 0x87, 0xAF, 0x5F, 0x83, 0xF4, 0x0B, 0xED, 0xC2,
+    0x42, 0x81, 0x84, 0xDE, 0x59, 0xA2, 0x8A, 0x12, 0x9D, 0x70, 0xC6, 0xA0, 0x1A, 0xD6, 0xC3, 0xED,
+    0x62, 0x36, 0x68, 0x31, 0xFE, 0x3F, 0x23, 0x21, 0x6A, 0xBD, 0x3C, 0x93, 0x95, 0x72, 0x8E, 0x3D,
+    0x17, 0xFD, 0xDB, 0xA2, 0x47, 0x83, 0xC4, 0x86, 0x6F, 0x1F, 0xD3, 0xAE, 0xC1, 0x40, 0xC3, 0xA9,
+    0xD0, 0xE2, 0xA3, 0x44, 0x5E, 0xBD, 0x45, 0x05, 0xDD, 0x75, 0xCC, 0xDC, 0x7D, 0xF9, 0x42, 0xE7,
+    0x08, 0x85, 0x0C, 0x08, 0x72, 0xE5, 0x5F, 0x11, 0x7D, 0xB6, 0xFE, 0x01, 0xAD, 0x55, 0xBF, 0x93,
+    0xDD, 0x34, 0x10, 0x5E, 0x4B, 0x93, 0xB8, 0x70, 0x21, 0x0A, 0x98, 0x0C, 0x95, 0x5A, 0x86, 0xE2,
+    0xFC, 0x0F, 0x24, 0x27, 0x27, 0x94, 0x14, 0xA4, 0x08, 0x15, 0x45, 0x7A, 0x52, 0x5C, 0x4B, 0x11,
+    0x62, 0x43, 0x43, 0x41, 0x73, 0x0D, 0xFF, 0x01, 0x14, 0x49, 0x43, 0x43, 0xC3, 0xCC, 0xE5, 0xEC,
+    0x84, 0x22, 0xAD, 0x20, 0xE5, 0x35, 0x1A, 0x26, 0x1D, 0x45, 0x34, 0x41, 0x19, 0xCC, 0x9C, 0xEC,
+    0xE5, 0x5B, 0xF9, 0x5D, 0x72, 0x21, 0x19, 0xA0, 0x40, 0x7E, 0xF2, 0x7B, 0x4F, 0x3F, 0x76, 0xBF,
+    0xFD, 0xF6, 0xD3, 0x8A, 0xC6, 0x95, 0x7A, 0x8E, 0x66, 0x70, 0x55, 0xD2, 0xB1, 0xED, 0xDA, 0x6B,
+    0x49, 0x25, 0xEB, 0xDB, 0x81, 0x79, 0xD6, 0xCC, 0x93, 0xE3, 0x6C, 0xC2, 0xF8, 0x60, 0xD1, 0xD9,
+    0x79, 0xF7, 0x78, 0xD1, 0x4B, 0x1F, 0xDC, 0x6F, 0xAB, 0x5E, 0x89, 0xDE, 0x21, 0x22, 0xB5, 0xE0,
+    0x65, 0x12, 0x5E, 0xCE, 0x13, 0x55, 0x3C, 0xD0, 0xBF, 0xB4, 0x6A, 0xC4, 0x12, 0x66, 0xAC, 0x3F,
+    0xCD, 0x64, 0x62, 0xED, 0x55, 0xBE, 0x70, 0x4C, 0x8E, 0x39, 0x34, 0xCC, 0x2B, 0x66, 0x38, 0xD8,
+    0xF5, 0xBB, 0xEB, 0x2A, 0x63, 0x6D, 0x0B, 0x93, 0x8A, 0x0F, 0x6D, 0x67, 0x99, 0xA3, 0x4C, 0x11,
+    0x00, 0x05, 0xBA, 0xC8, 0x87, 0x98, 0xEC, 0xEB, 0x48, 0x2A, 0xB7, 0x13, 0x8C, 0xC0, 0xDA, 0xF8,
+    0xF5, 0x4C, 0x7A, 0x75, 0xE1, 0x9F, 0x9D, 0x1F, 0x60, 0xDE, 0xC0, 0x14, 0xF1, 0xD3, 0x58, 0x9C,
+    0xD3, 0x58, 0x1D, 0x0C, 0x5A, 0x1C, 0xB7, 0x08, 0xB7, 0x78, 0xAF, 0xF9, 0xEE, 0x0D, 0x82, 0x59,
+    0xD8, 0xEC, 0x76, 0xEE, 0x6B, 0x66, 0x60, 0x15, 0x0C, 0x78, 0x0D, 0x3B, 0xFF, 0x04, 0x06, 0xC8,
+    0x3E, 0xE8, 0xE8, 0xD6, 0x36, 0x39, 0x10, 0x3F, 0xEF, 0xB6, 0x51, 0x73, 0xB2, 0x60, 0x23, 0xEC,
+    0x21, 0xAC, 0xA9, 0xE6, 0x6B, 0x99, 0xC6, 0xC9, 0x4C, 0x26, 0x52, 0xAE, 0x56, 0xB2, 0x53, 0xEB,
+    0xD5, 0xAC, 0x33, 0xB9, 0xAE, 0x9F, 0xEA, 0xD4, 0xCC, 0x34, 0x12, 0x0F, 0x26, 0xDA, 0xA4, 0x56,
+    0xC5, 0x9D, 0x0B, 0x2E, 0x5E, 0x5A, 0xE8, 0x56, 0xC3, 0x08, 0x9E, 0xC1, 0xAE, 0xC5, 0x0F, 0x05,
+    0x17, 0x70, 0xDB, 0x9D, 0x8F, 0x45, 0x08, 0x3A, 0x42, 0xBF, 0x23, 0x5C, 0x08, 0xFF, 0xDB, 0xAC,
+    0x16, 0xAC, 0x42, 0x55, 0x0F, 0xDF, 0x6D, 0xD8, 0x92, 0x03, 0x6F, 0xC8, 0x8D, 0x84, 0x34, 0x6C,
+    0x89, 0xB2, 0x18, 0x6C, 0xB2, 0xAC, 0xC6, 0xA0, 0x24, 0xAD, 0xC7, 0x60, 0x9B, 0xCE, 0xDB, 0x57,
+    0x18, 0xB6, 0x08, 0xB9, 0xBF, 0x9A, 0xAB, 0x4C, 0x47, 0x3A, 0xD2, 0xDB, 0xE0, 0x81, 0x1A, 0x70,
+    0x65, 0xC0, 0x4E, 0xE9, 0x4F, 0x6E, 0x46, 0x44, 0x1E, 0x4C, 0x09, 0x93, 0x91, 0xDB, 0x74, 0x7E,
+    0xFF, 0x13, 0xEC, 0x47, 0x98, 0xDF, 0xFC, 0x50, 0x30, 0x7E, 0x2E, 0x38, 0x81, 0xD1, 0xAD, 0x92,
+    0x03, 0x0F, 0x3C, 0xC8, 0x03, 0xA2, 0x07, 0x0E, 0xED, 0xED, 0x2C, 0xF4, 0x8A, 0x0A, 0x00, 0xBB,
+    0xBB, 0x88, 0xAD, 0x5B, 0xBB, 0x21, 0x02, 0xD3, 0x8B, 0x60, 0x35, 0x99, 0x6C, 0x7E, 0x69, 0xFE,
+    0x47, 0xA2, 0x45, 0x48, 0x00, 0x36, 0x85, 0xD4, 0x27, 0x02, 0x40, 0x28, 0xA2, 0x09, 0x64, 0x02,
+    0x59, 0x2F, 0x19, 0x74, 0xE5, 0x33, 0x4E, 0x74, 0x30, 0x90, 0x4A, 0xED, 0xD5, 0xC5, 0x7A, 0x36,
+    0xD1, 0x3D, 0xCA, 0xED, 0x33, 0xA6, 0x57, 0x2C, 0x81, 0x3B, 0xC4, 0x23, 0x82, 0x9A, 0x8B, 0x59,
+    0x07, 0x86, 0x26, 0xB1, 0xA5, 0x67, 0xAA, 0xF0, 0x7F, 0x24, 0xB1, 0x84, 0x04, 0x02, 0x47, 0x75,
+    0x5C, 0x76, 0xDD, 0xA7, 0xB2, 0x52, 0x74, 0xAA, 0xF3, 0xEB, 0x4A, 0x13, 0x7A, 0x60, 0x82, 0xDC,
+    0xB0, 0x65, 0x46, 0x32, 0x74, 0xBC, 0x6D, 0x01, 0xE2, 0xE2, 0x07, 0x98, 0xC5, 0xA5, 0xB8, 0x21,
+    0xE3, 0x5F, 0x2E, 0x47, 0x9A, 0x2D, 0xF0, 0xB5, 0xE0, 0xC9, 0x61, 0x69, 0x7F, 0xA6, 0x69, 0x11,
+    0xAE, 0x12, 0x45, 0x38, 0x3D, 0x91, 0x9E, 0x2E, 0x13, 0xDD, 0xAE, 0x07, 0x6A, 0x06, 0x4E, 0x84,
+    0x2C, 0x78, 0x5B, 0xC5, 0x7D, 0x15, 0xF6, 0x74, 0xB8, 0xA2, 0xFD, 0x9D, 0x7A, 0xDA, 0x3F, 0x78,
+    0x38, 0xD7, 0x3C, 0xF7, 0x34, 0x2E, 0xF5, 0xE1, 0x0B, 0x58, 0x6F, 0x89, 0x9D, 0xEE, 0x3D, 0xA2,
+    0x08, 0x1B, 0x96, 0x3E, 0x23, 0x15, 0x9A, 0x8E, 0xF6, 0x29, 0x89, 0x6E, 0xFE, 0x14, 0xCD, 0xE4,
+    0x66, 0xD8, 0xAB, 0x7D, 0xD2, 0xFE, 0x8A, 0xA5, 0xCB, 0xCD, 0xC3, 0x58, 0x9F, 0xE4, 0x7D, 0xE8,
+    0xE9, 0x03, 0x6F, 0x78, 0xB8, 0xBD, 0x19, 0xF9, 0x5F, 0x84, 0x1F, 0x5F, 0x13, 0xBE, 0x77, 0xB1,
+    0x86, 0xF0, 0x91, 0x73, 0x91, 0x71, 0xD8, 0x49, 0xBC, 0xED, 0x36, 0x96, 0x84, 0xB9, 0x17, 0xAD,
+    0x6F, 0x12, 0x99, 0x5F, 0x16, 0x50, 0x89, 0x33, 0xEA, 0x6E, 0x7A, 0xD2, 0xA7, 0x20, 0x73, 0x5C,
+    0x84, 0xA4, 0x0E, 0x08, 0xFC, 0x46, 0x5D, 0x5D, 0x8E, 0x3A, 0x23, 0xD2, 0x13, 0x46, 0xA6, 0x30,
+    0xE4, 0xBE, 0x90, 0xA1, 0x52, 0xB9, 0x4A, 0xD6, 0xAC, 0xFC, 0x83, 0x42, 0xB0, 0xE7, 0x0D, 0xE5,
+    0xC2, 0x78, 0xC0, 0xCE, 0x38, 0x1B, 0x76, 0xB2, 0x59, 0x81, 0xCE, 0xC9, 0x0D, 0x3C, 0xD7, 0xC9,
+    0xF1, 0x30, 0x9A, 0x3F, 0x92, 0xF9, 0x7D, 0xE9, 0x69, 0xE5, 0x8F, 0xA2, 0xE5, 0x80, 0x08, 0x66,
+    0xEB, 0xDD, 0xAA, 0xB3, 0xC6, 0xAA, 0xA9, 0x8F, 0xF5, 0x0C, 0xAD, 0x8C, 0xDD, 0xDF, 0x44, 0x21,
+    0x39, 0xEE, 0x59, 0xA8, 0x92, 0x6A, 0x82, 0x33, 0x20, 0x3F, 0xE9, 0xD3, 0x8E, 0xFE, 0x43, 0x83,
+    0x02, 0x01, 0x12, 0x27, 0x30, 0xCA, 0x89, 0x80, 0x52, 0x9A, 0x59, 0xD4, 0x67, 0xA3, 0x95, 0x70,
+    0x7D, 0x39, 0xC9, 0x5F, 0x25, 0x09, 0x45, 0x54, 0x54, 0x4B, 0xC9, 0x00, 0x1D, 0xC2, 0xA3, 0x2B,
+    0xC1, 0x95, 0xC3, 0x59, 0xF1, 0x74, 0x16, 0x3B, 0x49, 0x75, 0xD8, 0x02, 0xBF, 0x50, 0xE6, 0x24,
+    0x95, 0xD0, 0x41, 0xE1, 0xA5, 0x14, 0xF2, 0x71, 0x93, 0xDE, 0x11, 0x9E, 0x8C, 0x14, 0xCE, 0x34,
+    0xAB, 0x24, 0x97, 0x84, 0x8A, 0x1A, 0x4F, 0x1D, 0x74, 0x68, 0x7C, 0xED, 0xCD, 0xB4, 0x3D, 0x28,
+    0xD3, 0x03, 0xAA, 0x68, 0x87, 0xDC, 0x4B, 0xFE, 0x21, 0xCF, 0x5D, 0x85, 0x82, 0xD6, 0xE9, 0x3A,
+    0xFA, 0xDE, 0x50, 0x82, 0x90, 0x53, 0x8E, 0xEE, 0xA5, 0x40, 0x89, 0x6A, 0xAA, 0xB3, 0x63, 0xC4,
+    0x77, 0x45, 0x85, 0x1E, 0x95, 0x24, 0x36, 0x8B, 0x9A, 0x4D, 0xAA, 0x66, 0x13, 0x55, 0x32, 0xCF,
+    0x3F, 0x89, 0x72, 0x01, 0xD8, 0x5D, 0xA5, 0xC1, 0x3D, 0x31, 0x28, 0x88, 0xB5, 0xB4, 0x77, 0xBB,
+    0xED, 0xD0, 0x48, 0x65, 0x19, 0x37, 0x6D, 0xC2, 0xF6, 0x20, 0x55, 0xE4, 0xD2, 0xF2, 0x71, 0x09,
+    0x14, 0x36, 0xA5, 0x82, 0xE3, 0x7E, 0xF9, 0x3E, 0x9A, 0xA4, 0x93, 0x01, 0x76, 0x1B, 0x9A, 0x08,
+    0xAC, 0xD2, 0x3D, 0xFA, 0x64, 0xCB, 0x9A, 0xE5, 0x15, 0xBE, 0xB1, 0x47, 0x10, 0x3A, 0xF9, 0x12,
+    0x72, 0xA4, 0xB0, 0x96, 0xB1, 0x80, 0x22, 0x48, 0x4E, 0xC4, 0xB6, 0x6A, 0xA1, 0xD3, 0x66, 0x27,
+    0x21, 0xB6, 0xA7, 0xA5, 0x40, 0x3B, 0x4E, 0xDB, 0xE6, 0x72, 0x85, 0x94, 0x2F, 0x20, 0x16, 0x8D,
+    0xF5, 0x8F, 0xE6, 0x51, 0xB8, 0x6F, 0x7F, 0x5E, 0x4A, 0xC2, 0x50, 0x00, 0x2A, 0xD6, 0x33, 0xEA,
+    0x95, 0xC1, 0x85, 0x8B, 0x28, 0xC6, 0x89, 0x51, 0xA5, 0x6B, 0x5C, 0xB5, 0x35, 0xA4, 0x1A, 0x5D,
+    0x80, 0x3C, 0x2B, 0xB1, 0x89, 0xFE, 0xFE, 0xBD, 0x7B, 0xDF, 0x0A, 0x08, 0x29, 0xB4, 0x2C, 0x1B,
+    0xB0, 0xEB, 0x99, 0x5C, 0x0F, 0x4F, 0x91, 0xFD, 0x3E, 0x4B, 0xAA, 0xF1, 0x5A, 0x97, 0x99, 0x9A,
+    0xC7, 0xBF, 0xA2, 0x6A, 0xDB, 0x0F, 0x27, 0x1D, 0x8F, 0x5A, 0x6A, 0x7F, 0x8A, 0xF7, 0xAB, 0xA5,
+    0xFD, 0x32, 0x95, 0xB3, 0xFF, 0x86, 0xF6, 0x17, 0x9D, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14, 0xBD,
+    0xB6, 0x09, 0x96, 0xB0, 0xC4, 0xA4, 0x20, 0xCD, 0x6E, 0xE1, 0x86, 0x16, 0xE6, 0x05, 0x42, 0xC6,
+    0x68, 0x8B, 0x94, 0x49, 0xC1, 0x56, 0x29, 0xD2, 0xD3, 0xF0, 0x02, 0x48, 0xB6, 0xD2, 0x50, 0x50,
+    0x84, 0x8A, 0x86, 0x26, 0x65, 0x50, 0x8A, 0x3C, 0x01, 0xF1, 0x20, 0x0A, 0x5A, 0x43, 0x44, 0x1D,
+    0x8B, 0x2D, 0x28, 0x52, 0xAC, 0x49, 0x1C, 0x30, 0x64, 0xEC, 0xCB, 0x39, 0xD7, 0xDF, 0x87, 0x22,
+    0x4A, 0xBC, 0xFB, 0xCD, 0xF8, 0xE7, 0xFA, 0xFE, 0x9C, 0x73, 0xEE, 0xB5, 0x88, 0x9C, 0x3C, 0x28,
+    0x16, 0x91, 0x4C, 0x53, 0xB1, 0x8A, 0x14, 0xBA, 0x95, 0x49, 0xC4, 0xA9, 0x3A, 0xDC, 0xAC, 0x67,
+    0xD5, 0x59, 0x24, 0x4C, 0xAD, 0x8E, 0xD8, 0x46, 0xAF, 0x51, 0xC4, 0x6F, 0x37, 0x61, 0x28, 0x2D,
+    0x9F, 0xC0, 0x5E, 0x79, 0x01, 0x7B, 0xC5, 0x16, 0xD6, 0x52, 0x1B, 0x91, 0x7E, 0x14, 0xED, 0x44,
+    0x60, 0x8C, 0x2D, 0xC7, 0x03, 0x6C, 0xC5, 0xBE, 0x95, 0x2B, 0x22, 0x35, 0x52, 0x25, 0xBB, 0xE1,
+    0x92, 0x94, 0xDC, 0x56, 0xA9, 0x57, 0x3A, 0xF9, 0x5A, 0xF7, 0xD8, 0x74, 0x5D, 0x61, 0x43, 0xD0,
+    0x12, 0x1B, 0x82, 0xE6, 0x7B, 0x00, 0xE9, 0x75, 0xE1, 0x76, 0xBA, 0x35, 0xF2, 0xEF, 0x91, 0x3D,
+    0x11, 0xBC, 0xD6, 0xA6, 0x3A, 0x4A, 0xAD, 0x17, 0xF0, 0x9C, 0x5A, 0x84, 0x08, 0xF7, 0xF0, 0x7A,
+    0xA9, 0xDF, 0xCC, 0x7C, 0xB7, 0xE3, 0x9B, 0x08, 0x51, 0x2F, 0xF5, 0x24, 0xA8, 0xB3, 0x87, 0x7D,
+    0x57, 0x4D, 0x82, 0x7F, 0x9C, 0x6E, 0xE2, 0x26, 0x71, 0x63, 0xB6, 0x49, 0xB6, 0x4A, 0x80, 0x97,
+    0xA9, 0x4E, 0x48, 0x53, 0xE1, 0xC5, 0x59, 0x12, 0xCA, 0xBC, 0x00, 0x0D, 0x82, 0x55, 0xDB, 0x31,
+    0xEC, 0x5B, 0xB6, 0xB6, 0x23, 0x57, 0xC3, 0x42, 0x74, 0x69, 0x91, 0xAA, 0x26, 0xC4, 0x90, 0x3E,
+    0x12, 0xC7, 0x76, 0x60, 0xB5, 0x61, 0x94, 0x30, 0x88, 0x47, 0x8C, 0x05, 0x19, 0xB0, 0x72, 0x14,
+    0x0E, 0x78, 0x50, 0x37, 0xB0, 0xA5, 0x47, 0x97, 0x88, 0x43, 0xA1, 0x67, 0x84, 0x4F, 0x7F, 0x66,
+    0xC5, 0xE1, 0x2F, 0x1D, 0xE4, 0x10, 0x1F, 0x28, 0x4F, 0x56, 0x3C, 0xC3, 0x78, 0x26, 0x03, 0x78,
+    0x88, 0x7B, 0x6E, 0x39, 0xE1, 0x81, 0xD8, 0x83, 0x37, 0x40, 0x91, 0x8C, 0x56, 0xFA, 0xE5, 0x80,
+    0x08, 0x4F, 0xA4, 0x1A, 0xAB, 0x11, 0x37, 0x7A, 0x09, 0xA8, 0x1A, 0x45, 0xB7, 0x28, 0xB4, 0x9C,
+    0x42, 0x27, 0xED, 0xAD, 0x49, 0xCA, 0x3F, 0x36, 0xD2, 0x19, 0x81, 0x16, 0xC9, 0xDE, 0x18, 0x8F,
+    0x09, 0xCC, 0x62, 0x24, 0xE1, 0x78, 0x48, 0x6F, 0x79, 0x3A, 0x79, 0xB4, 0x04, 0x9D, 0x83, 0x1A,
+    0x6E, 0x6E, 0x14, 0x37, 0xF0, 0xE1, 0x7B, 0x5C, 0xB6, 0x3D, 0x62, 0x4D, 0xA4, 0xBC, 0x82, 0xA4,
+    0x40, 0x12, 0xC3, 0x2F, 0xE7, 0xB7, 0xA5, 0xEF, 0x98, 0x08, 0x53, 0xA3, 0xB3, 0x8C, 0x4B, 0x4E,
+    0x73, 0xCA, 0x8D, 0x7A, 0x10, 0xAA, 0xC1, 0xB4, 0x20, 0x04, 0x88, 0xAA, 0x63, 0x31, 0x2C, 0x38,
+    0x70, 0x69, 0xAD, 0x74, 0xC2, 0xFC, 0x69, 0xF7, 0x9F, 0xF2, 0x3C, 0xD2, 0x84, 0x78, 0xC9, 0x14,
+    0x80, 0x9A, 0x48, 0x99, 0xF8, 0xF1, 0xE0, 0x1A, 0x44, 0x0A, 0x39, 0xB0, 0x04, 0xDC, 0x2C, 0x26,
+    0x3C, 0xF3, 0x6B, 0x55, 0x85, 0xF1, 0x10, 0xBD, 0x1F, 0x8E, 0x3E, 0x6B, 0x26, 0xDE, 0x03, 0xF1,
+    0x82, 0x1E, 0xEB, 0x57, 0xE7, 0x9F, 0xD8, 0xBB, 0x7B, 0x5F, 0xA0, 0x1E, 0x2A, 0x33, 0xF6, 0x0C,
+    0x42, 0x77, 0xD2, 0x9A, 0x2E, 0x8F, 0xA9, 0xD3, 0x9F, 0x45, 0xD8, 0xAF, 0x26, 0x5E, 0xE1, 0xE5,
+    0x8A, 0x21, 0xAE, 0xDD, 0x36, 0x79, 0x68, 0xAC, 0x35, 0xE5, 0xAF, 0xCE, 0x9B, 0x00, 0x03, 0x34,
+    0x1A, 0x6E, 0x54, 0x08, 0x4E, 0xCD, 0x47, 0x2B, 0x08, 0x84, 0x14, 0xF0, 0xDC, 0x0A, 0x01, 0x3E,
+    0x1C, 0x9E, 0x90, 0x86, 0xC3, 0x32, 0x5B, 0x55, 0xB4, 0xA3, 0x80, 0x99, 0xFC, 0x11, 0xD7, 0x03,
+    0xB8, 0xE0, 0xA6, 0xA0, 0x2D, 0xF3, 0x05, 0x9F, 0x1F, 0x2B, 0xC1, 0x6D, 0x1B, 0xE4, 0x8B, 0x05,
+    0xBC, 0x4B, 0x8D, 0xDE, 0x14, 0x3F, 0xE4, 0x14, 0x7A, 0x8F, 0x47, 0x11, 0x3E, 0xFB, 0x08, 0xA9,
+    0x3D, 0xEE, 0xBE, 0xDD, 0x03, 0x06, 0xA6, 0x39, 0x39, 0xA4, 0x32, 0x48, 0x46, 0x25, 0x93, 0xCC,
+    0xE8, 0xBE, 0x9F, 0xAB, 0xF8, 0x51, 0x31, 0x3A, 0x99, 0xEB, 0xF8, 0x79, 0x88, 0xDE, 0x7D, 0xB5,
+    0x9B, 0xF7, 0x63, 0xD0, 0x91, 0x5A, 0xD1, 0xA8, 0x9A, 0x03, 0x00, 0xAA, 0x38, 0x41, 0xE6, 0x52,
+    0x6E, 0x4E, 0x7F, 0x22, 0x06, 0x0E, 0x0D, 0xB9, 0xA3, 0xF2, 0xBB, 0x2E, 0x94, 0x96, 0xB4, 0xCF,
+    0xF5, 0x59, 0xDA, 0x31, 0xD1, 0x3E, 0xCA, 0xDE, 0xDF, 0x44, 0xCA, 0xFA, 0xDD, 0x08, 0x01, 0xD8,
+    0xDB, 0x11, 0x00, 0xEB, 0x31, 0xDA, 0x76, 0x07, 0x9A, 0x4C, 0x4E, 0x7C, 0xC7, 0x4E, 0x5A, 0xDD,
+    0xA7, 0x43, 0xA5, 0xCF, 0x35, 0xF0, 0x44, 0xD7, 0xB0, 0xB0, 0x27, 0x6A, 0x1D, 0xF0, 0xB7, 0x35,
+    0xB9, 0x62, 0x30, 0xC1, 0x1C, 0x96, 0x83, 0x4F, 0xC5, 0x1E, 0x89, 0x31, 0x8E, 0xD4, 0x87, 0xA3,
+    0xAA, 0x96, 0xC3, 0x49, 0x35, 0xBC, 0xD1, 0x4A, 0x6E, 0xD4, 0x69, 0x83, 0xFE, 0xC3, 0x8C, 0x61,
+    0x11, 0x6E, 0x25, 0xF0, 0xE3, 0x7E, 0xDB, 0xB0, 0x66, 0xAB, 0xB6, 0x0D, 0x11, 0x33, 0xDE, 0x6D,
+    0xCD, 0xF6, 0x24, 0x5B, 0x2B, 0x73, 0x9F, 0x56, 0x7B, 0x96, 0xAA, 0x97, 0x33, 0x9E, 0xDE, 0xBF,
+    0x50, 0x24, 0xFE, 0xC5, 0xDC, 0xCF, 0x85, 0xDE, 0x4B, 0x6E, 0x2F, 0xD1, 0xD9, 0x5A, 0x5A, 0x75,
+    0x19, 0x22, 0x9F, 0xC0, 0x47, 0x20, 0xD9, 0x60, 0xF2, 0x7D, 0x53, 0x3A, 0x7E, 0x39, 0x7E, 0xA7,
+    0x0B, 0xE0, 0x18, 0xAD, 0x47, 0x03, 0x9D, 0x62, 0xE4, 0x59, 0x11, 0xF5, 0x70, 0x15, 0xB3, 0xE6,
+    0xC6, 0x1D, 0x8D, 0xCC, 0xA5, 0x05, 0x72, 0x0C, 0x7D, 0xCA, 0xF1, 0x8B, 0x0C, 0xA8, 0xA9, 0x92,
+    0x82, 0xA4, 0x0C, 0x3F, 0xC3, 0x48, 0x5A, 0xB2, 0xE6, 0xBA, 0xC8, 0x75, 0xB9, 0x32, 0x8B, 0xE2,
+    0x72, 0x90, 0x62, 0x92, 0x7C, 0x7A, 0xF7, 0x2E, 0x07, 0x3C, 0xFC, 0x7A, 0x40, 0xF7, 0x01, 0x6A,
+    0x68, 0xC0, 0x69, 0xF6, 0x28, 0x82, 0x54, 0x6B, 0xA8, 0xBE, 0xA3, 0xE5, 0xCA, 0x79, 0x55, 0x4F,
+    0x9C, 0x7B, 0xFD, 0x4D, 0xCE, 0x8A, 0x44, 0xAD, 0xD7, 0x17, 0x86, 0x3B, 0x7B, 0xB5, 0xD8, 0xD4,
+    0x58, 0x9B, 0xAD, 0xF4, 0x86, 0x94, 0x2E, 0x76, 0xC3, 0xE6, 0xC0, 0x66, 0x1C, 0x5B, 0x7F, 0xDA,
+    0x6A, 0xA3, 0xB5, 0x4A, 0x5C, 0xC3, 0xAF, 0xCA, 0xB1, 0x7B, 0x06, 0xF3, 0x2A, 0x55, 0xBA, 0x3C,
+    0x0C, 0x93, 0xD3, 0x3F, 0xAD, 0x11, 0x6A, 0x83, 0xE6, 0x3B, 0x2E, 0x85, 0xDD, 0x78, 0xA7, 0x13,
+    0x8F, 0x92, 0x52, 0x68, 0xCA, 0xA7, 0xB3, 0x78, 0x34, 0xC4, 0xDF, 0xFC, 0x96, 0x44, 0x09, 0x9C,
+    0xAC, 0x83, 0x8D, 0xE9, 0x40, 0x6F, 0x49, 0xAA, 0x4B, 0x08, 0xD8, 0xCF, 0x19, 0xE8, 0x73, 0x63,
+    0xFF, 0x1A, 0x88, 0x7D, 0x08, 0x07, 0xF0, 0x92, 0x77, 0xD6, 0x74, 0xDE, 0xC6, 0x19, 0x67, 0x02,
+    0xBC, 0xF8, 0x99, 0xDF, 0x00, 0xCA, 0x18, 0xDD, 0xE2, 0x39, 0x0E, 0x1F, 0xE7, 0x44, 0x71, 0x4D,
+    0x1E, 0x45, 0xB8, 0x97, 0x2F, 0x6C, 0x32, 0xDE, 0xBF, 0x4C, 0xBB, 0xFC, 0xA2, 0xD1, 0xBE, 0x7F,
+    0x0E, 0x59, 0x42, 0xBE, 0xB5, 0x2C, 0xD6, 0xCD, 0x2B, 0xCB, 0x6F, 0x7F, 0x7C, 0xC9, 0x7E, 0xDC,
+    0x4E, 0xCE, 0xB0, 0xA1, 0x05, 0x2B, 0x50, 0x87, 0xA1, 0xE1, 0x74, 0x28, 0x88, 0xA1, 0xC6, 0x2B,
+    0x20, 0xE4, 0xDA, 0x79, 0x23, 0x27, 0xF2, 0xF6, 0x03, 0x41, 0x96, 0x52, 0x46, 0x70, 0xE5, 0xAF,
+    0x86, 0x46, 0x5E, 0xFF, 0xB0, 0x48, 0xF9, 0x8C, 0x19, 0xF5, 0xC9, 0x46, 0x87, 0x94, 0x97, 0x48,
+    0xC4, 0xDF, 0x40, 0x6A, 0xE9, 0x05, 0x7A, 0x7B, 0x84, 0x8F, 0xC0, 0xF1, 0x92, 0xF6, 0x89, 0xF3,
+    0xFF, 0x8E, 0x7F, 0x00, 0xA5, 0x55, 0x3D, 0xAF, 0xDD, 0x44, 0x10, 0x1D, 0xDB, 0x12, 0x96, 0x70,
+    0xB1, 0x15, 0x34, 0x29, 0xB6, 0x4F, 0xB3, 0x7F, 0x00, 0x69, 0x8D, 0x10, 0xA2, 0x4D, 0x91, 0x47,
+    0xFB, 0x7A, 0x9A, 0xFC, 0x01, 0xC0, 0x46, 0x91, 0x48, 0x41, 0xF3, 0xFE, 0x01, 0x94, 0x28, 0x14,
+    0xF9, 0x03, 0x51, 0xD6, 0x82, 0x1F, 0x80, 0x6B, 0x68, 0x8C, 0x90, 0xA0, 0xA0, 0x60, 0xA3, 0xB8,
+    0xF0, 0x7B, 0x6F, 0xED, 0xE1, 0x9C, 0xF1, 0x8B, 0x88, 0xA8, 0x22, 0x71, 0xAF, 0xEE, 0x5C, 0x7B,
+    0xAF, 0xE7, 0xE3, 0x9C, 0x39, 0x33, 0x57, 0x64, 0x98, 0xD2, 0x22, 0xF5, 0xD1, 0x1E, 0x22, 0x49,
+    0x87, 0x2C, 0x95, 0xFE, 0xAA, 0x22, 0xCD, 0x1E, 0xB3, 0x88, 0x7B, 0x85, 0x4B, 0x49, 0xCF, 0x56,
+    0x1C, 0x1C, 0xDA, 0x8B, 0x78, 0xDD, 0x70, 0xA0, 0x3A, 0xE2, 0xC0, 0x2E, 0x83, 0x4E, 0x3C, 0x80,
+    0xB3, 0xB4, 0x66, 0x83, 0xEE, 0xF6, 0x04, 0x6C, 0x5B, 0xB4, 0x88, 0xC4, 0x97, 0xB4, 0xFA, 0x18,
+    0xB6, 0xDB, 0x5B, 0x38, 0xC5, 0xEC, 0xE8, 0x5A, 0xED, 0x48, 0xA5, 0x99, 0x9F, 0x5A, 0x75, 0x91,
+    0x8E, 0xF9, 0x16, 0x7C, 0x66, 0x04, 0x41, 0xD0, 0xF8, 0x04, 0x8F, 0x86, 0x45, 0x52, 0x1A, 0x45,
+    0xF9, 0xEC, 0x2A, 0xB5, 0xCE, 0x48, 0x9B, 0x91, 0x09, 0xB1, 0x90, 0xCD, 0xDD, 0xEA, 0xE8, 0x5F,
+    0xE9, 0x12, 0x7E, 0xD3, 0x35, 0xCE, 0x69, 0xEF, 0x54, 0x01, 0x26, 0xEA, 0x0E, 0x30, 0x08, 0x0B,
+    0x30, 0x32, 0x3C, 0x7E, 0x4B, 0x30, 0xE5, 0xFF, 0x80, 0x71, 0xFA, 0x63, 0xF1, 0xFA, 0x4D, 0x96,
+    0xE0, 0x27, 0x89, 0xB1, 0x97, 0x2F, 0xE0, 0xC1, 0xE8, 0xC0, 0x55, 0x21, 0x68, 0xC3, 0x22, 0x90,
+    0xA7, 0xC3, 0xBD, 0xFB, 0x7B, 0x15, 0xFF, 0x73, 0x91, 0xF0, 0x44, 0x25, 0x7E, 0x84, 0x1F, 0xBB,
+    0x4D, 0x9A, 0x22, 0x6E, 0x45, 0x0A, 0x71, 0x59, 0xDC, 0x26, 0x3E, 0xF3, 0x16, 0x35, 0xE3, 0x22,
+    0x2E, 0x12, 0xB2, 0x0C, 0x33, 0x6F, 0xD3, 0x24, 0xC3, 0x22, 0x70, 0x49, 0x73, 0x85, 0x68, 0x3A,
+    0xD5, 0xDA, 0x23, 0x7C, 0xA3, 0x78, 0x8D, 0x66, 0xFB, 0x96, 0x16, 0xF5, 0xBC, 0xB6, 0x87, 0xF8,
+    0xFD, 0xE2, 0xD1, 0x2E, 0x01, 0x51, 0x77, 0x89, 0x9B, 0x84, 0xFD, 0xC1, 0x80, 0xD8, 0x9A, 0x53,
+    0xA6, 0x05, 0x3C, 0xE9, 0x16, 0x5A, 0xF2, 0x0E, 0x4B, 0x06, 0xF8, 0xFA, 0x52, 0xA2, 0x84, 0xDE,
+    0x4D, 0x6E, 0x6A, 0x97, 0x26, 0xD7, 0x5B, 0xBD, 0xC9, 0x8E, 0xF7, 0x20, 0xB1, 0x0F, 0x93, 0x9F,
+    0xDC, 0xD2, 0xDD, 0xFC, 0xB0, 0x22, 0x67, 0xA9, 0x98, 0x2A, 0xA1, 0x80, 0x38, 0xF9, 0x85, 0xC7,
+    0x9F, 0xE0, 0x98, 0xB1, 0x18, 0xFB, 0x73, 0x92, 0x8F, 0xBE, 0xA1, 0x31, 0x10, 0x1A, 0x12, 0x92,
+    0xB8, 0x22, 0xAC, 0x15, 0xF5, 0x8F, 0x3C, 0x13, 0x62, 0xED, 0x48, 0x7F, 0x05, 0x96, 0xD8, 0x0C,
+    0x43, 0x8E, 0x2E, 0xA1, 0x4D, 0x70, 0x65, 0x31, 0x27, 0x7C, 0x54, 0xBA, 0xF3, 0x8C, 0x2D, 0x21,
+    0x07, 0xF8, 0x06, 0xB8, 0x4B, 0xBA, 0x32, 0x83, 0x35, 0x0F, 0x19, 0xAC, 0xAB, 0x27, 0x27, 0x74,
+    0xC5, 0x37, 0x63, 0x9D, 0x94, 0xD0, 0x75, 0x96, 0xC4, 0x58, 0x1E, 0x6C, 0x1F, 0xE6, 0x3A, 0x55,
+    0x56, 0x2F, 0xC9, 0x29, 0x86, 0x3D, 0x42, 0x1A, 0x85, 0xF8, 0x11, 0xEA, 0x05, 0xBE, 0xC5, 0x80,
+    0x8B, 0x14, 0xDC, 0x49, 0x55, 0x70, 0x27, 0xA0, 0x03, 0xCF, 0x36, 0x2B, 0xEE, 0xA0, 0x15, 0x8A,
+    0xA2, 0xB3, 0xC4, 0xCE, 0xB2, 0xB9, 0x9B, 0x67, 0x48, 0xE1, 0x67, 0xB4, 0x13, 0x5A, 0xA6, 0xAA,
+    0xE3, 0x14, 0xE6, 0xBB, 0x2A, 0x16, 0x93, 0x94, 0xE9, 0xCB, 0x9F, 0xB7, 0xAC, 0x9E, 0x42, 0x8B,
+    0x68, 0x28, 0x40, 0x40, 0x0D, 0x91, 0x85, 0x0C, 0x23, 0x35, 0x23, 0xDD, 0x2A, 0x03, 0x11, 0x28,
+    0x52, 0x30, 0x44, 0xA6, 0x37, 0xFA, 0xCE, 0x60, 0x68, 0xEC, 0x42, 0xEF, 0x0C, 0x96, 0xA3, 0xF6,
+    0x6C, 0x42, 0x03, 0x41, 0x6C, 0x90, 0xD2, 0x00, 0x71, 0x8E, 0x69, 0x84, 0x4F, 0xB3, 0x82, 0x61,
+    0xB4, 0x3A, 0x21, 0x04, 0x20, 0xFB, 0xEC, 0x31, 0x75, 0xF3, 0xB0, 0xD7, 0x07, 0x00, 0x77, 0xF0,
+    0x59, 0x1A, 0xCE, 0x4D, 0xFD, 0xBD, 0xDC, 0x7F, 0xFE, 0xEE, 0x95, 0xC8, 0xFD, 0xA7, 0x4F, 0xBF,
+    0xE3, 0x32, 0xA0, 0x3A, 0xCE, 0x02, 0x0F, 0xB2, 0x56, 0xEF, 0xA4, 0xBD, 0x29, 0x26, 0xE8, 0x52,
+    0xA3, 0xB4, 0x76, 0x6B, 0x30, 0x47, 0xDD, 0x4A, 0x79, 0xBB, 0xDC, 0xC2, 0xFA, 0xDC, 0x01, 0x57,
+    0x58, 0x9C, 0x1E, 0x3D, 0xF4, 0xA0, 0x3A, 0x03, 0xB8, 0x05, 0x8A, 0xD7, 0x97, 0x00, 0x11, 0xE7,
+    0x06, 0x24, 0x0D, 0x13, 0x6D, 0xEA, 0x69, 0x55, 0xDA, 0x95, 0x16, 0xB0, 0xEA, 0xA3, 0xC6, 0x2A,
+    0x6A, 0x30, 0x57, 0x4C, 0xD0, 0x21, 0x74, 0x5B, 0xDC, 0x26, 0xFF, 0x79, 0x3D, 0x32, 0x85, 0x26,
+    0xEB, 0x54, 0xD4, 0xAF, 0x51, 0x98, 0xD3, 0x5B, 0x10, 0xD2, 0xE8, 0x1F, 0xEC, 0x83, 0x2E, 0x71,
+    0x81, 0x40, 0xD7, 0x0E, 0xAD, 0x69, 0x8E, 0x0A, 0x10, 0xA7, 0x61, 0x0A, 0x53, 0x83, 0x03, 0xA4,
+    0x53, 0xBC, 0x87, 0x3E, 0xA2, 0x31, 0x5D, 0x76, 0x1B, 0x38, 0x54, 0x20, 0xF0, 0xD9, 0xDD, 0xE8,
+    0x5E, 0x69, 0x0F, 0xC8, 0x8B, 0x3B, 0x2E, 0x29, 0x14, 0xAA, 0x45, 0xB3, 0x4D, 0xD3, 0x66, 0x6D,
+    0x42, 0x91, 0xF7, 0x8E, 0x0F, 0xFF, 0x2D, 0x83, 0x2B, 0x4A, 0x86, 0xFC, 0x1E, 0x4A, 0xB9, 0x26,
+    0xB7, 0x7F, 0xC1, 0x69, 0xF8, 0x6A, 0x77, 0x53, 0x1C, 0x4B, 0x9D, 0xFD, 0xF4, 0x5C, 0x36, 0x37,
+    0x47, 0x29, 0x4D, 0xF6, 0x63, 0xAA, 0x4A, 0x37, 0x27, 0x19, 0xEA, 0x35, 0x5D, 0x85, 0x29, 0x29,
+    0xDA, 0x13, 0xEE, 0x72, 0x90, 0x1D, 0xC5, 0x34, 0x83, 0x2F, 0xA9, 0x1E, 0xBE, 0x01, 0xF3, 0x1D,
+    0xBD, 0x36, 0x4D, 0x2D, 0x94, 0xB2, 0xAD, 0x4A, 0x8E, 0x90, 0xDE, 0xAE, 0x80, 0x6B, 0x0B, 0xEB,
+    0xCC, 0x4F, 0x41, 0x9C, 0xB3, 0x63, 0x83, 0xB3, 0xDA, 0xEA, 0x32, 0x82, 0xEC, 0xA7, 0x53, 0xF1,
+    0xE7, 0xE5, 0xFC, 0xFE, 0x2C, 0x26, 0x34, 0x67, 0xB1, 0x12, 0xD9, 0x3A, 0x07, 0x31, 0x98, 0x74,
+    0x71, 0xD0, 0xDB, 0xA6, 0x12, 0xF9, 0xCC, 0x86, 0xED, 0x9C, 0xB4, 0xFE, 0x75, 0x45, 0xF7, 0x76,
+    0x10, 0x91, 0xB9, 0x18, 0xF5, 0xEA, 0x41, 0x9C, 0xAC, 0x6F, 0xC9, 0x76, 0x36, 0x56, 0xB9, 0x40,
+    0xDE, 0xB5, 0xD6, 0xE2, 0x0F, 0xB4, 0x40, 0x67, 0xA4, 0x90, 0x6F, 0x75, 0xC4, 0xD6, 0x61, 0xC0,
+    0xFB, 0x3D, 0x57, 0x29, 0x30, 0x72, 0x3A, 0x77, 0x9A, 0xC2, 0xB1, 0x2C, 0x17, 0x9F, 0x1E, 0x17,
+    0x0F, 0xB9, 0x20, 0x4C, 0xF3, 0x72, 0x6E, 0x01, 0xEB, 0xB8, 0x23, 0x10, 0xCF, 0x2A, 0x02, 0x4D,
+    0x5C, 0xCE, 0x25, 0x20, 0x5C, 0x81, 0x36, 0xFD, 0xA7, 0xA9, 0x4F, 0x2A, 0x3E, 0xA6, 0x09, 0xD0,
+    0xA3, 0x46, 0xDB, 0x16, 0x34, 0x2F, 0xC4, 0xC6, 0x96, 0xBD, 0xCB, 0x40, 0xF6, 0x13, 0x07, 0xAE,
+    0x45, 0x98, 0xD0, 0x73, 0x8E, 0xA5, 0xE5, 0x64, 0x8E, 0xF6, 0x44, 0xC3, 0x51, 0x9D, 0xCC, 0xA3,
+    0x41, 0x5A, 0xFF, 0x0B, 0xB2, 0x7C, 0x00, 0x46, 0x71, 0xDC, 0xF5, 0xDC, 0x50, 0x5D, 0x89, 0x33,
+    0x8A, 0x41, 0x11, 0x71, 0x46, 0x39, 0x80, 0x85, 0x7F, 0x2C, 0x6C, 0x28, 0x94, 0xEB, 0x36, 0x2C,
+    0x2A, 0x57, 0xF0, 0x53, 0xB7, 0x73, 0x95, 0x73, 0xC5, 0xB4, 0x9C, 0x65, 0xFB, 0x77, 0xE4, 0x7F,
+    0x95, 0xD4, 0x6F, 0x14, 0xDA, 0xDF, 0x75, 0xE7, 0x1C, 0x64, 0xDB, 0x00, 0x04, 0x7F, 0xB7, 0x76,
+    0xB8, 0x00, 0x9A, 0x12, 0xA7, 0x6E, 0xE5, 0x2A, 0x8D, 0x1C, 0x9D, 0x39, 0xF5, 0x61, 0x56, 0x09,
+    0xBF, 0x17, 0xF1, 0x7F, 0x52, 0x88, 0xD8, 0x8C, 0xA6, 0xF8, 0xD1, 0x7A, 0xEB, 0xF6, 0xB3, 0xFD,
+    0xE4, 0x8C, 0x6C, 0x91, 0x2C, 0x72, 0x15, 0x67, 0x79, 0xCB, 0xD7, 0x3F, 0xA5, 0x55, 0x31, 0x8F,
+    0xDD, 0x44, 0x10, 0x1E, 0x7B, 0x95, 0xB3, 0x14, 0x17, 0xDB, 0x84, 0xEA, 0x90, 0xDC, 0x22, 0x05,
+    0x70, 0x8F, 0x44, 0x76, 0x81, 0x82, 0x36, 0xC5, 0x5D, 0x95, 0x22, 0xD4, 0x20, 0x91, 0x3F, 0x70,
+    0x3C, 0x5B, 0xCA, 0x1F, 0xB8, 0x22, 0x3D, 0x14, 0x54, 0x47, 0x11, 0xCA, 0x14, 0x04, 0xAF, 0x48,
+    0x41, 0x6B, 0x89, 0x82, 0xE2, 0x1A, 0x03, 0x41, 0x10, 0x90, 0xC8, 0x46, 0x72, 0xB1, 0xB9, 0xDB,
+    0xE7, 0xE1, 0x9B, 0xB1, 0xC9, 0xD1, 0x67, 0xE5, 0x37, 0xF6, 0xDB, 0x9D, 0x9D, 0x9D, 0xF9, 0xE6,
+    0x9B, 0xD9, 0x82, 0x89, 0xDA, 0x68, 0xF6, 0x54, 0x30, 0xD9, 0x44, 0x76, 0xC6, 0x3F, 0xE2, 0x9E,
+    0x86, 0xD1, 0x66, 0xCC, 0xF5, 0x43, 0x20, 0xC3, 0xF5, 0x9E, 0xC8, 0xE6, 0x6E, 0x84, 0xEA, 0xE5,
+    0x42, 0x44, 0x1D, 0x47, 0xC2, 0x22, 0xB6, 0x1A, 0x66, 0xC6, 0x16, 0xC8, 0x40, 0x10, 0xB2, 0x38,
+    0x40, 0x0D, 0xF3, 0x10, 0xD4, 0x64, 0x91, 0x43, 0xD4, 0x89, 0x5E, 0x26, 0xF6, 0xAF, 0x26, 0xE8,
+    0x0D, 0x5F, 0x1C, 0x91, 0x0B, 0x26, 0x43, 0xD8, 0x08, 0xD1, 0x4C, 0xD4, 0x8E, 0x2E, 0x40, 0x0C,
+    0x9E, 0xDA, 0x5F, 0x60, 0xAB, 0xF9, 0x0D, 0x06, 0x9A, 0xBF, 0x67, 0x08, 0x39, 0xD1, 0xE2, 0x10,
+    0x88, 0x5E, 0x04, 0x91, 0xC3, 0x79, 0xBE, 0x83, 0xD8, 0x0E, 0x6E, 0xC4, 0x6A, 0x2B, 0xC2, 0x4D,
+    0x22, 0xC4, 0x8D, 0x12, 0xF3, 0x5D, 0x90, 0x25, 0x59, 0xE5, 0xBE, 0x86, 0xBD, 0x3A, 0x97, 0xE2,
+    0x5C, 0x37, 0x89, 0x35, 0xC3, 0x9D, 0x6E, 0x63, 0x71, 0x0C, 0x11, 0x79, 0x12, 0xE3, 0xA3, 0x7A,
+    0x39, 0x8B, 0xAC, 0x35, 0x90, 0x92, 0x93, 0x4E, 0xC9, 0x96, 0x4D, 0xB9, 0xE2, 0x15, 0x84, 0x73,
+    0x35, 0x36, 0x77, 0x50, 0x68, 0x16, 0xC3, 0x02, 0x57, 0x68, 0xA1, 0xC0, 0xB1, 0x80, 0x82, 0xCB,
+    0xEA, 0x2B, 0xC6, 0x4E, 0x65, 0xAD, 0xA6, 0x49, 0x71, 0xA1, 0xEB, 0x02, 0x89, 0x23, 0x1B, 0xCC,
+    0x6C, 0x22, 0xB5, 0x3D, 0x66, 0xB3, 0xC3, 0xF9, 0xCF, 0xA1, 0x34, 0xC0, 0x5E, 0x25, 0x70, 0x02,
+    0x10, 0x12, 0xB7, 0x4B, 0x9E, 0xC4, 0x01, 0x1C, 0x7F, 0x3E, 0x53, 0x9D, 0xBA, 0x50, 0x2C, 0x80,
+    0xAE, 0x0B, 0x2D, 0xA6, 0x0B, 0x89, 0xE1, 0x5D, 0x89, 0xC0, 0xD3, 0xB5, 0xE3, 0xE3, 0xDB, 0x38,
+    0x93, 0x97, 0xE6, 0x09, 0x70, 0xA9, 0x5F, 0x40, 0x3C, 0x49, 0xC0, 0x94, 0xF6, 0x04, 0x94, 0x3B,
+    0xC2, 0xA6, 0x16, 0x7B, 0xC9, 0x4E, 0x34, 0x78, 0x23, 0xB8, 0x17, 0x59, 0x56, 0x16, 0xAA, 0x12,
+    0x39, 0x5F, 0xEE, 0xA9, 0x41, 0x2A, 0xA9, 0x96, 0x15, 0x93, 0x00, 0x3C, 0x12, 0x5C, 0x43, 0x64,
+    0x49, 0xB5, 0x62, 0xCD, 0xFD, 0xA7, 0x67, 0x67, 0x9A, 0x65, 0xAB, 0x99, 0x95, 0x60, 0x8A, 0x45,
+    0xF1, 0xF1, 0xD7, 0x8E, 0x8F, 0x80, 0x4F, 0x3E, 0x71, 0x9C, 0x12, 0x7D, 0x41, 0x33, 0x7D, 0x07,
+    0xDF, 0x72, 0x19, 0x8B, 0x64, 0xA6, 0x72, 0x36, 0xA3, 0x89, 0x55, 0x30, 0xB1, 0x0E, 0xD5, 0xEF,
+    0x77, 0x4F, 0x61, 0x75, 0x86, 0xA3, 0xD1, 0x2A, 0x92, 0x06, 0x71, 0x54, 0x30, 0x5A, 0x07, 0xDA,
+    0x46, 0xF9, 0x0C, 0x49, 0x64, 0x6F, 0xA3, 0x0B, 0x55, 0x6E, 0xA6, 0x72, 0x81, 0x4F, 0x43, 0x29,
+    0x74, 0x59, 0xA8, 0x99, 0x80, 0xDB, 0x6C, 0xB1, 0x60, 0xD2, 0xA1, 0x7A, 0xE5, 0x41, 0xC2, 0x50,
+    0xF2, 0x73, 0x98, 0x42, 0x20, 0x54, 0x4A, 0x8E, 0x04, 0x79, 0x07, 0x90, 0x9B, 0x97, 0x92, 0x48,
+    0x0F, 0x0C, 0x83, 0x24, 0x06, 0x87, 0x41, 0xA3, 0x10, 0x8D, 0x41, 0x4F, 0x6A, 0xFD, 0xAE, 0xF5,
+    0x8F, 0x1D, 0xE5, 0x5B, 0x94, 0x4F, 0x8A, 0x74, 0x62, 0xE2, 0x49, 0x1D, 0x3B, 0x9E, 0x5A, 0x30,
+    0xC1, 0x06, 0x79, 0x9A, 0x1E, 0x4A, 0x04, 0xAC, 0x41, 0xAB, 0x5A, 0x67, 0xAE, 0x7B, 0xBA, 0x4D,
+    0x37, 0x00, 0x60, 0x36, 0xB1, 0xC8, 0xD5, 0x58, 0x26, 0xC9, 0xA3, 0xF5, 0x55, 0x6C, 0x5D, 0x1D,
+    0x6F, 0x39, 0x3B, 0xBD, 0xBF, 0x73, 0xE3, 0xEE, 0x7B, 0x0E, 0xE0, 0x68, 0x00, 0x59, 0x7B, 0x38,
+    0xE8, 0xAB, 0xC5, 0x91, 0x89, 0xF8, 0x4D, 0x3B, 0x44, 0xBB, 0x5F, 0xA9, 0x80, 0x04, 0x14, 0xFE,
+    0xC6, 0x3B, 0xE5, 0x18, 0xED, 0xC7, 0xFE, 0xE4, 0xED, 0x5F, 0xE3, 0x1F, 0x5F, 0xDE, 0xFF, 0x67,
+    0x6F, 0x39, 0x3A, 0x6C, 0xFC, 0x9C, 0xBE, 0x9D, 0xCB, 0xFB, 0xF0, 0x00, 0x7C, 0x39, 0x85, 0xE7,
+    0xB3, 0xEA, 0xAF, 0x9E, 0x0B, 0x37, 0x90, 0x47, 0xAA, 0xE7, 0x2D, 0x0D, 0xCA, 0x45, 0xD0, 0x13,
+    0x47, 0x8D, 0x80, 0x35, 0x19, 0xF6, 0x03, 0x0A, 0xBB, 0x09, 0x83, 0xAF, 0x27, 0xC9, 0x27, 0x6A,
+    0x6C, 0x0F, 0xED, 0x41, 0xAB, 0x0E, 0x15, 0x1F, 0xBB, 0x50, 0xA7, 0x76, 0x32, 0x0B, 0x6A, 0x51,
+    0x86, 0xA4, 0xB1, 0x09, 0x2B, 0x40, 0x60, 0x03, 0xB0, 0x8C, 0xDB, 0xAC, 0x3D, 0x97, 0x1E, 0x81,
+    0x3A, 0x40, 0x28, 0xC1, 0xF0, 0x87, 0x99, 0x86, 0x60, 0xA5, 0x70, 0x33, 0x96, 0x9B, 0xD0, 0x02,
+    0x00, 0x31, 0xEA, 0xBB, 0x50, 0xC5, 0x3A, 0xC1, 0x3D, 0xEE, 0x6D, 0x6C, 0xE6, 0x72, 0x29, 0xD9,
+    0xBB, 0xD1, 0xC5, 0x6A, 0x4F, 0x9F, 0xD1, 0xD1, 0x7F, 0xB9, 0xDD, 0x79, 0x29, 0x17, 0x28, 0x23,
+    0x27, 0x3C, 0xA2, 0xB3, 0xC0, 0xDB, 0xD9, 0xF1, 0xD7, 0x2E, 0x55, 0x79, 0xED, 0x26, 0xA8, 0x52,
+    0xE6, 0x8B, 0x21, 0xD3, 0x81, 0x50, 0x4E, 0x1A, 0xD0, 0xD5, 0x4B, 0xBA, 0x02, 0xF3, 0x5F, 0x0F,
+    0xB6, 0x7A, 0xBF, 0x7A, 0xC1, 0xEB, 0x4F, 0xA4, 0x40, 0x1F, 0xDC, 0x99, 0x54, 0x45, 0x2A, 0xD9,
+    0xAA, 0x39, 0xA9, 0x57, 0x79, 0x15, 0xBC, 0x16, 0xF9, 0x21, 0x9F, 0xD2, 0x7B, 0x44, 0xF7, 0x46,
+    0x2B, 0x8D, 0xCB, 0x2C, 0x9E, 0xEF, 0x8C, 0x03, 0xDA, 0xC8, 0xA3, 0x42, 0x69, 0x5E, 0x0C, 0xA2,
+    0xDD, 0x08, 0x33, 0xED, 0xC5, 0xF1, 0x0A, 0x3B, 0xE0, 0xF5, 0x07, 0xDA, 0x77, 0x7A, 0xB1, 0x26,
+    0x45, 0x2A, 0x5C, 0x3A, 0x80, 0xA5, 0x6D, 0xD8, 0xAF, 0xE4, 0xEF, 0x88, 0x6E, 0x8A, 0xAD, 0x8B,
+    0xB4, 0x51, 0xC4, 0x32, 0x39, 0x7E, 0xEA, 0xF6, 0x07, 0xB9, 0xD2, 0x56, 0xE9, 0x84, 0xA7, 0xFC,
+    0x0D, 0x8A, 0xF9, 0x50, 0x0E, 0x4A, 0x42, 0x4C, 0x6D, 0x5F, 0x12, 0xAE, 0x78, 0x06, 0x79, 0xE6,
+    0xB7, 0xF6, 0xB5, 0x35, 0xB5, 0xB5, 0x13, 0xBC, 0x29, 0xCE, 0xBF, 0xFC, 0x40, 0xF3, 0x2E, 0x45,
+    0xB8, 0xEE, 0x14, 0x35, 0x35, 0xAC, 0x81, 0xC2, 0x9C, 0x89, 0xF7, 0x96, 0xD3, 0x8D, 0x23, 0x18,
+    0x8F, 0xD7, 0x97, 0xDB, 0x1C, 0xD4, 0xE2, 0x92, 0xB8, 0x27, 0x7C, 0x0E, 0x6B, 0xDC, 0x13, 0x08,
+    0x8A, 0x3A, 0x1D, 0x24, 0x6E, 0xEA, 0x5E, 0xC5, 0x5D, 0x3F, 0x3B, 0xBA, 0x8A, 0xBB, 0x12, 0x54,
+    0xB1, 0x82, 0x20, 0xB4, 0x0D, 0xCD, 0x64, 0x7E, 0x40, 0xDC, 0xDA, 0x78, 0xE8, 0x91, 0x88, 0xB7,
+    0x56, 0x47, 0xFF, 0xA4, 0x2A, 0xA3, 0x3D, 0xC9, 0x45, 0x62, 0xB5, 0xEB, 0xB6, 0xD2, 0xD5, 0x85,
+    0xA9, 0x78, 0x3A, 0xDC, 0x2B, 0x1E, 0x24, 0x05, 0x25, 0xD1, 0x83, 0xCD, 0x42, 0x40, 0x0A, 0xEA,
+    0x56, 0x9F, 0x26, 0x49, 0xFE, 0x6E, 0xCE, 0xF4, 0xFF, 0x51, 0x8D, 0xD5, 0xB4, 0xA6, 0xF6, 0x52,
+    0xD3, 0x26, 0x0E, 0x6E, 0x91, 0x29, 0x04, 0xDA, 0x75, 0x9E, 0xD2, 0xEB, 0x8E, 0x92, 0x7B, 0x80,
+    0xAF, 0xCD, 0xDB, 0x70, 0x86, 0x33, 0x64, 0x51, 0x7F, 0xA3, 0xA0, 0xDB, 0x24, 0xA7, 0xF7, 0x1F,
+    0xB9, 0x17, 0x9C, 0xB4, 0xEB, 0xF1, 0x8F, 0xFC, 0xF3, 0xA2, 0xD7, 0xC5, 0x43, 0xEE, 0x26, 0xBD,
+    0xDB, 0xF8, 0x92, 0xD7, 0xCB, 0x42, 0x5B, 0xD9, 0x4A, 0xBD, 0x15, 0xF7, 0x6D, 0x02, 0x90, 0xAD,
+    0xFE, 0x1B, 0xDE, 0xFC, 0xEF, 0xB6, 0x8F, 0x7A, 0xE5, 0xB3, 0x12, 0x53, 0x6F, 0x99, 0x96, 0x1F,
+    0x5E, 0x68, 0x22, 0x39, 0xF1, 0x4F, 0x92, 0xD8, 0x8E, 0x3F, 0xE2, 0x0A, 0x1F, 0x35, 0xCF, 0x4D,
+    0xB2, 0x72, 0xAF, 0xA0, 0xAA, 0xC7, 0x66, 0x33, 0xFC, 0x9A, 0xE3, 0x5F, 0xBD, 0x55, 0xB1, 0x8E,
+    0xDE, 0x44, 0x10, 0x1E, 0xDB, 0xE2, 0x56, 0x3A, 0x17, 0xDB, 0x5C, 0x0A, 0xA0, 0xF0, 0x0B, 0x80,
+    0xF6, 0x0D, 0x58, 0x53, 0x51, 0xD0, 0x86, 0x9A, 0x1A, 0x0A, 0xF2, 0x02, 0x51, 0x6C, 0x94, 0x17,
+    0xC8, 0x43, 0xA4, 0x38, 0x44, 0x91, 0x37, 0x88, 0xF7, 0xA0, 0x48, 0x91, 0x22, 0x8E, 0x22, 0xEA,
+    0x58, 0x80, 0x84, 0x92, 0x14, 0xB7, 0x80, 0x95, 0x58, 0xDC, 0xDA, 0xC3, 0xF7, 0xAD, 0x7D, 0x0A,
+    0x42, 0xA2, 0x40, 0x42, 0xF8, 0xEE, 0xF6, 0xBC, 0xF3, 0xCF, 0xBF, 0x33, 0xDF, 0xF7, 0xCD, 0xCC,
+    0x8A, 0xFC, 0xE5, 0x29, 0x96, 0x32, 0xE5, 0x17, 0xA7, 0xDA, 0xE6, 0x17, 0xD5, 0x29, 0xFF, 0xAF,
+    0x75, 0xD9, 0x5D, 0x4E, 0xEF, 0xCB, 0xBF, 0x78, 0xDE, 0x3B, 0x3F, 0xBD, 0x5F, 0x9E, 0x9F, 0x7C,
+    0x23, 0x3A, 0x0E, 0xBD, 0xBF, 0xD0, 0xBE, 0x52, 0xB3, 0xD4, 0xB3, 0x9F, 0xA4, 0x59, 0xBA, 0xA0,
+    0x16, 0x87, 0x0E, 0x8F, 0x52, 0xF3, 0x6C, 0x13, 0xA9, 0xD4, 0x7F, 0x9F, 0xB4, 0x17, 0x69, 0xAE,
+    0x52, 0x37, 0x30, 0xEA, 0xA0, 0x8F, 0x73, 0xD4, 0x4A, 0x57, 0xDD, 0x78, 0x5A, 0xA3, 0x4A, 0x07,
+    0x66, 0xA5, 0x91, 0xFF, 0xFD, 0x61, 0xE0, 0x07, 0x5B, 0xCE, 0x12, 0xCF, 0xC2, 0x6F, 0xFC, 0xA6,
+    0xBF, 0x20, 0xF3, 0x42, 0x93, 0x5B, 0x1D, 0x5C, 0x06, 0x2D, 0x35, 0xC0, 0xA5, 0xD3, 0xE0, 0x17,
+    0x93, 0x5D, 0x52, 0x9D, 0xA4, 0x9A, 0x5D, 0x94, 0x3A, 0x76, 0xA3, 0xD8, 0x08, 0xC0, 0xF6, 0xA7,
+    0x15, 0xD0, 0x9F, 0xE3, 0x53, 0x7F, 0x89, 0x04, 0x3A, 0x9E, 0x3D, 0x28, 0xE3, 0x81, 0x95, 0x42,
+    0xB7, 0x56, 0x4A, 0x06, 0xAE, 0xD6, 0x21, 0x89, 0x49, 0x46, 0xC5, 0xCE, 0x05, 0x96, 0x28, 0x2A,
+    0x8E, 0x8B, 0x9F, 0xB0, 0xF5, 0x63, 0xB5, 0xC9, 0x97, 0xBD, 0x21, 0x91, 0xB7, 0x16, 0xE6, 0x84,
+    0x54, 0xAD, 0x06, 0x2E, 0x30, 0xD9, 0x9F, 0xAF, 0xB9, 0x39, 0x7B, 0xA7, 0xAD, 0x9E, 0x2E, 0x72,
+    0xBB, 0x13, 0xFB, 0x24, 0xC8, 0x55, 0x94, 0x06, 0x09, 0x21, 0x0B, 0x90, 0x53, 0x23, 0xF7, 0xD4,
+    0xF5, 0x4D, 0x9F, 0xCA, 0xB9, 0x0E, 0x5E, 0x92, 0x89, 0x4D, 0x10, 0x33, 0x8B, 0x01, 0xCA, 0xA1,
+    0x97, 0xFA, 0xDE, 0x71, 0x06, 0x08, 0x80, 0x3D, 0x63, 0x1E, 0x28, 0x99, 0xDD, 0x06, 0x44, 0xD3,
+    0x8F, 0x11, 0xA9, 0x89, 0x6E, 0x92, 0x72, 0xAB, 0x00, 0xC9, 0x8F, 0x1E, 0x5E, 0x04, 0x8C, 0x2F,
+    0x03, 0x94, 0x9D, 0x91, 0x73, 0xA1, 0x48, 0x56, 0xDC, 0x04, 0xAF, 0x2A, 0xD1, 0xAB, 0x0B, 0x5D,
+    0x10, 0xBB, 0xC0, 0xEB, 0x44, 0x45, 0xB7, 0x42, 0x23, 0xB2, 0x76, 0x6B, 0xA9, 0x0B, 0xB2, 0xF2,
+    0xCC, 0x5D, 0x86, 0x91, 0x08, 0x52, 0xD6, 0x84, 0xF5, 0xD1, 0x51, 0x85, 0xD3, 0x73, 0x1A, 0x81,
+    0x12, 0xE4, 0x96, 0x7F, 0xAC, 0x62, 0xBF, 0x8B, 0x72, 0xC7, 0x86, 0x72, 0xFE, 0x08, 0xAF, 0xF3,
+    0xFE, 0xEA, 0xC5, 0x5E, 0x2C, 0x78, 0x1D, 0xA1, 0x7D, 0xEC, 0x2E, 0xF4, 0xEB, 0x73, 0xF2, 0x63,
+    0x71, 0xDC, 0x80, 0xB3, 0x66, 0xFC, 0xAD, 0xC8, 0x15, 0x39, 0x0A, 0xC8, 0xA3, 0x30, 0x38, 0x66,
+    0xE1, 0xD6, 0xCE, 0xDC, 0x36, 0x91, 0x5B, 0x0F, 0x8A, 0x66, 0xD2, 0x03, 0xB2, 0x21, 0x19, 0xB6,
+    0xC8, 0x07, 0x5B, 0x50, 0x30, 0x8C, 0x85, 0xFE, 0xF0, 0x19, 0xE2, 0xB3, 0x00, 0x42, 0xF5, 0x76,
+    0xED, 0x0D, 0xD7, 0xD6, 0x72, 0x15, 0xBB, 0x82, 0x59, 0xD2, 0x6C, 0xB5, 0x75, 0x38, 0x55, 0x7B,
+    0xBF, 0xA0, 0xD4, 0x89, 0xC4, 0x10, 0x1F, 0xBE, 0x9D, 0xA1, 0x6D, 0xD9, 0x90, 0x32, 0xAC, 0x99,
+    0x6D, 0xF1, 0x05, 0x5C, 0xBC, 0x34, 0xBD, 0x0D, 0xF5, 0x58, 0x4F, 0x55, 0xAC, 0xE6, 0x22, 0x49,
+    0x92, 0x87, 0xD2, 0x89, 0x6F, 0x5D, 0x6F, 0x47, 0x3B, 0x9A, 0x68, 0xB6, 0x6F, 0x53, 0xC9, 0x3A,
+    0x64, 0x40, 0x0A, 0xD3, 0x8C, 0x36, 0xD6, 0xB1, 0x5A, 0x2B, 0x98, 0x79, 0x00, 0x4A, 0x80, 0xB5,
+    0xD0, 0xE1, 0x48, 0x77, 0x74, 0xD3, 0x5B, 0xD8, 0xEB, 0xFF, 0x01, 0x7B, 0x13, 0xC2, 0x5E, 0x85,
+    0xB0, 0xB7, 0x3E, 0xA3, 0x6C, 0x73, 0xDB, 0xC8, 0xB5, 0xAE, 0xE8, 0xCB, 0x5C, 0x57, 0xB9, 0xBD,
+    0x72, 0x17, 0x32, 0x0E, 0xA9, 0xC9, 0x14, 0xB8, 0x16, 0x24, 0x8C, 0xF5, 0x08, 0x0A, 0xE2, 0x41,
+    0xC1, 0x00, 0x0A, 0x7C, 0xDF, 0x04, 0x98, 0x49, 0xC1, 0x82, 0x5C, 0xD6, 0x4C, 0x41, 0x87, 0x64,
+    0x5C, 0xB0, 0xD1, 0x46, 0xB3, 0x80, 0x02, 0x92, 0x4A, 0x0A, 0x2C, 0x0E, 0xAD, 0xE3, 0xA1, 0x3A,
+    0x43, 0xDE, 0x3C, 0xA8, 0x78, 0x81, 0x3A, 0x65, 0x37, 0x75, 0xC1, 0xA4, 0x66, 0x2A, 0x57, 0x38,
+    0x29, 0x1C, 0x7C, 0x58, 0xA5, 0x99, 0x3C, 0x8B, 0x16, 0x1F, 0x98, 0xF9, 0xFD, 0x9D, 0x60, 0x4C,
+    0x28, 0xC0, 0xBE, 0xC4, 0x41, 0x06, 0x19, 0x97, 0x2B, 0x13, 0x65, 0x04, 0x0E, 0x90, 0x71, 0x07,
+    0x40, 0x40, 0xF5, 0xB6, 0x47, 0x92, 0x74, 0x3D, 0xE2, 0xDA, 0xB3, 0x0F, 0xCB, 0x29, 0xDA, 0x4F,
+    0xFA, 0xDB, 0x1F, 0x94, 0x31, 0x36, 0x77, 0x2F, 0x56, 0xD4, 0xAE, 0xD3, 0xF0, 0xEE, 0x57, 0x22,
+    0x2B, 0x7D, 0xD1, 0x69, 0x77, 0xA4, 0x9C, 0xC5, 0x06, 0xB9, 0xC1, 0x6A, 0xE8, 0xA9, 0x16, 0xA8,
+    0x2B, 0x74, 0x94, 0x8E, 0xB5, 0x03, 0x32, 0xA0, 0x01, 0xDF, 0x82, 0x41, 0xA3, 0x76, 0x54, 0xBB,
+    0x2D, 0x15, 0x9D, 0x42, 0xDB, 0xD2, 0xE4, 0x56, 0x98, 0x20, 0x42, 0xB9, 0x61, 0x82, 0x41, 0xD2,
+    0x37, 0xDA, 0x3D, 0x8F, 0xE2, 0x9F, 0xE8, 0x36, 0x20, 0x67, 0xAF, 0xBF, 0x03, 0x66, 0x1A, 0xF4,
+    0x73, 0x68, 0xFB, 0xA3, 0x26, 0x8A, 0xF8, 0xA9, 0x3E, 0xA3, 0xAD, 0x51, 0xA8, 0x84, 0x06, 0x89,
+    0x8A, 0x49, 0x12, 0xF4, 0xAE, 0xB6, 0xF5, 0x56, 0x25, 0x68, 0xE6, 0xE7, 0xBD, 0x76, 0x88, 0x70,
+    0x47, 0xA2, 0x6C, 0xC5, 0xBD, 0x6C, 0x51, 0x4E, 0x73, 0x86, 0xB6, 0x0F, 0xC7, 0x5D, 0xC7, 0x43,
+    0xBC, 0x6A, 0x77, 0xB8, 0x71, 0x33, 0x73, 0x63, 0x22, 0x07, 0x54, 0xA8, 0xA9, 0x86, 0x8F, 0xA8,
+    0x2A, 0x04, 0x19, 0x6B, 0x44, 0x17, 0xBF, 0xE2, 0x5C, 0xBD, 0xBA, 0x9A, 0xCC, 0x2B, 0x1D, 0x5A,
+    0x77, 0x6B, 0x85, 0xB8, 0xDD, 0xAB, 0x68, 0x7E, 0x55, 0xDF, 0xBB, 0x47, 0xF3, 0x26, 0x9B, 0x7D,
+    0x3C, 0x57, 0xF3, 0x19, 0x15, 0x14, 0x37, 0x1E, 0x6C, 0x67, 0x66, 0x49, 0x79, 0x91, 0x9B, 0x65,
+    0xA2, 0xC2, 0x90, 0xA3, 0x6B, 0xA9, 0x1D, 0xF6, 0x05, 0x0A, 0x6E, 0xCC, 0x1A, 0xC2, 0x3A, 0xB4,
+    0x79, 0x52, 0x52, 0x5A, 0x18, 0x68, 0xDD, 0xD3, 0x45, 0xED, 0x30, 0xF7, 0x07, 0xCB, 0x3E, 0xC8,
+    0x73, 0xEE, 0xB9, 0xE6, 0x0A, 0xBD, 0xF7, 0x0F, 0xD7, 0x8A, 0xD9, 0xDB, 0x67, 0xC7, 0xEB, 0xD2,
+    0xCE, 0x44, 0x90, 0x63, 0x52, 0xC3, 0x74, 0xC9, 0x8D, 0x79, 0xBD, 0x66, 0x13, 0xEB, 0x41, 0xDC,
+    0xD3, 0xDC, 0xD5, 0x4B, 0x43, 0x5A, 0xF2, 0xE8, 0x43, 0x0F, 0x35, 0x2C, 0x9F, 0x94, 0xA1, 0xE8,
+    0xCB, 0x07, 0x71, 0xBF, 0x50, 0x5A, 0x0E, 0x54, 0xF6, 0x7D, 0x6E, 0xA4, 0x6C, 0x5A, 0xF2, 0xE0,
+    0x45, 0x04, 0xFC, 0xDA, 0xAC, 0x46, 0xB1, 0x87, 0xE3, 0xF3, 0x10, 0x3F, 0xC8, 0x98, 0x13, 0x94,
+    0x73, 0xD8, 0x51, 0x19, 0xDC, 0x78, 0x7F, 0x7F, 0x4E, 0xD6, 0x7C, 0xAF, 0x6E, 0x87, 0xEF, 0x66,
+    0x50, 0x6C, 0xBC, 0x6E, 0x4D, 0xC4, 0x52, 0x8F, 0x58, 0x30, 0x28, 0x17, 0x69, 0xDA, 0x0A, 0xCD,
+    0x49, 0x66, 0x3D, 0x6F, 0x16, 0xFF, 0x12, 0xB2, 0x7B, 0xDE, 0x3A, 0x8E, 0x8B, 0xE5, 0x7D, 0x5C,
+    0xEE, 0xB8, 0xFF, 0x9B, 0xE7, 0x4F, 0xBD, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0x7E, 0x66,
+    0xE3, 0xC2, 0x12, 0x93, 0x06, 0x1A, 0x0A, 0x37, 0x54, 0x50, 0xF8, 0x0F, 0x18, 0x8B, 0x94, 0xB4,
+    0xD9, 0x9F, 0x48, 0x93, 0x2F, 0x00, 0x9B, 0x8A, 0x82, 0x82, 0x6D, 0xD2, 0xD3, 0x50, 0xF0, 0x82,
+    0xB4, 0x5F, 0x10, 0xD9, 0x49, 0x8A, 0x2D, 0x28, 0x78, 0x81, 0x82, 0x12, 0x23, 0x41, 0x93, 0x14,
+    0x38, 0xC2, 0x02, 0x6B, 0x77, 0x66, 0x2E, 0xE7, 0x5C, 0x7B, 0x97, 0x24, 0xC0, 0x4A, 0x50, 0x30,
+    0x92, 0xCF, 0xB3, 0x67, 0xEE, 0xCC, 0xBD, 0xF7, 0xDC, 0x33, 0xF7, 0x89, 0x48, 0xF5, 0x30, 0x88,
+    0x48, 0xFD, 0x88, 0xE8, 0x1F, 0x13, 0xFB, 0xAF, 0x89, 0xFA, 0xD9, 0x22, 0x2F, 0x8F, 0xC2, 0x26,
+    0x9C, 0x61, 0x4D, 0x13, 0x69, 0x0D, 0x95, 0xB8, 0x4B, 0xC4, 0xE2, 0xB7, 0x48, 0x93, 0xE7, 0xC4,
+    0xFA, 0x49, 0xA2, 0xC9, 0xC7, 0x44, 0xCD, 0x54, 0x24, 0x4F, 0xC4, 0x22, 0x08, 0xD0, 0xA5, 0x3D,
+    0xD0, 0xAB, 0x6A, 0x23, 0xAD, 0x21, 0x40, 0xBB, 0xDC, 0xB0, 0xC0, 0x16, 0x1D, 0x5C, 0x20, 0xFA,
+    0x59, 0x32, 0x1D, 0x70, 0xCE, 0xFB, 0xFC, 0xBC, 0x15, 0xF0, 0x55, 0x06, 0xC9, 0x15, 0xAB, 0x85,
+    0x56, 0x8B, 0x1C, 0x1D, 0xBF, 0x71, 0xFB, 0x95, 0x38, 0xE5, 0x86, 0xB9, 0x57, 0x9C, 0xD2, 0x2B,
+    0x5E, 0x53, 0x11, 0x25, 0x5F, 0x76, 0xD8, 0x30, 0x01, 0xCA, 0x03, 0xC0, 0x0D, 0xBB, 0x45, 0xAA,
+    0x26, 0x5F, 0xA4, 0x96, 0x7C, 0x16, 0x2F, 0x6E, 0x12, 0xFF, 0x54, 0x27, 0x46, 0x34, 0x61, 0x2B,
+    0xC0, 0xA9, 0x8E, 0xB2, 0xD3, 0x6E, 0x3D, 0xF2, 0x68, 0x7F, 0x1F, 0x73, 0x24, 0xC7, 0x82, 0x15,
+    0x29, 0xF1, 0xBB, 0x72, 0xA0, 0xBA, 0xA7, 0x51, 0xB1, 0x7E, 0x32, 0x29, 0x33, 0x94, 0x3C, 0x6E,
+    0x9B, 0xFD, 0x59, 0xB4, 0xDF, 0x5D, 0xC4, 0xC1, 0x9C, 0xAA, 0x46, 0x8B, 0x0B, 0xA9, 0xE4, 0x6A,
+    0xC6, 0x6E, 0x72, 0x7A, 0xCE, 0x15, 0x6D, 0xDA, 0x83, 0x91, 0x9C, 0xEE, 0x9B, 0x17, 0xBA, 0xB3,
+    0xCD, 0x74, 0x77, 0xBE, 0xFF, 0xDC, 0xDC, 0x61, 0x0C, 0x62, 0x4C, 0x29, 0x39, 0xB4, 0xA0, 0x49,
+    0x49, 0xB3, 0x53, 0x8B, 0x7E, 0x66, 0xEC, 0xE4, 0xEC, 0xD5, 0x71, 0xF7, 0x90, 0xF5, 0x1D, 0xB3,
+    0xC3, 0x3E, 0x1E, 0xF8, 0x2C, 0x80, 0x1B, 0x9D, 0xCA, 0xC1, 0x77, 0x75, 0x38, 0x7A, 0x00, 0x7A,
+    0x30, 0x79, 0x78, 0x40, 0x8B, 0x08, 0x86, 0xF0, 0xF1, 0x04, 0xDC, 0x9C, 0x7F, 0xD1, 0x80, 0x24,
+    0x24, 0x97, 0x4F, 0xA8, 0x87, 0xDC, 0x04, 0x4F, 0x7A, 0x52, 0xAD, 0xFE, 0xA7, 0x7A, 0x8D, 0xC2,
+    0x70, 0x04, 0x5B, 0x85, 0x9E, 0xD0, 0xD3, 0x87, 0xF2, 0x11, 0x83, 0xFF, 0x25, 0x1A, 0x41, 0xE1,
+    0x8A, 0x95, 0x32, 0x35, 0xF2, 0x8F, 0xE3, 0xE8, 0xF8, 0x0E, 0x69, 0x64, 0xDD, 0x4A, 0x23, 0x17,
+    0x69, 0x2C, 0x24, 0xC7, 0x04, 0x67, 0xBC, 0xF8, 0xE1, 0x4F, 0x6C, 0x9F, 0x7E, 0x65, 0x04, 0x99,
+    0x58, 0x69, 0x98, 0xA9, 0xCE, 0x14, 0xE2, 0x4A, 0xBE, 0x29, 0xD6, 0x4A, 0x52, 0xC6, 0xE3, 0xDB,
+    0x76, 0x58, 0xBC, 0xC4, 0xCA, 0x8E, 0xF7, 0x2F, 0xA0, 0x20, 0x60, 0x84, 0x5C, 0x5F, 0xA0, 0x40,
+    0x85, 0x91, 0x67, 0x50, 0x5C, 0x17, 0xEF, 0xA5, 0xDA, 0xE8, 0xD0, 0x31, 0x3D, 0x97, 0xA8, 0xEC,
+    0xA9, 0x38, 0x48, 0x39, 0xBD, 0xB9, 0xB0, 0x44, 0x49, 0xC8, 0x62, 0x47, 0x7E, 0x46, 0x69, 0xCF,
+    0xEF, 0x35, 0x52, 0x33, 0xF6, 0x72, 0xA6, 0x1C, 0xC0, 0xA2, 0x89, 0x7F, 0x60, 0x54, 0xD3, 0x96,
+    0xC4, 0x8D, 0x95, 0x40, 0x1B, 0xA7, 0xF0, 0x5E, 0xAC, 0xB5, 0x45, 0x5D, 0xC4, 0x14, 0x67, 0x97,
+    0xA5, 0x3E, 0x79, 0x4B, 0xC7, 0xD7, 0x10, 0x2E, 0xEF, 0x62, 0x6E, 0x09, 0x6B, 0x63, 0xBA, 0xE0,
+    0xF2, 0x84, 0xF4, 0x74, 0x2E, 0x68, 0x9E, 0xA5, 0x7B, 0x1F, 0x44, 0xC8, 0x1B, 0x37, 0xCA, 0x2D,
+    0x95, 0x92, 0xA2, 0xC4, 0xF4, 0xC9, 0x4E, 0xFF, 0xD3, 0xCB, 0xE2, 0x48, 0xF4, 0x75, 0x00, 0xF3,
+    0x33, 0x79, 0x7F, 0xBD, 0xA9, 0x58, 0x72, 0x3C, 0xBB, 0xF0, 0x2E, 0xBE, 0x79, 0x31, 0xF0, 0x8C,
+    0xFE, 0xCB, 0xBB, 0xC3, 0x7B, 0xD2, 0x37, 0xF5, 0x33, 0x1C, 0x09, 0xBE, 0xB3, 0x2B, 0x86, 0x82,
+    0xE3, 0x35, 0x2D, 0xA7, 0xAD, 0x8D, 0x54, 0xCF, 0x49, 0x46, 0xF8, 0x3B, 0x1D, 0xFE, 0xFF, 0xC9,
+    0x31, 0x3B, 0x9C, 0x1E, 0x29, 0xAC, 0x99, 0xBE, 0xBA, 0x35, 0x3F, 0x93, 0xD2, 0x2E, 0xEC, 0x4E,
+    0x31, 0xC3, 0x0C, 0xAD, 0x64, 0x4C, 0x31, 0x1F, 0x51, 0x23, 0xE6, 0x28, 0xBC, 0xEE, 0x19, 0x9E,
+    0x72, 0xEA, 0xF1, 0xE1, 0x46, 0xA9, 0x7E, 0x4C, 0x08, 0xCB, 0x1F, 0xC4, 0x7F, 0x1F, 0x5F, 0xC8,
+    0x9C, 0x65, 0xA5, 0x89, 0x5C, 0xF5, 0x51, 0x96, 0xB8, 0x5E, 0x7B, 0x81, 0x5B, 0x2E, 0x1B, 0xC9,
+    0xBF, 0x1F, 0x55, 0x28, 0x75, 0x71, 0x91, 0x37, 0xBD, 0xD6, 0x01, 0x54, 0x49, 0x3F, 0x6A, 0x2A,
+    0xE9, 0x5B, 0x1F, 0xEB, 0xDC, 0x8E, 0xC2, 0x76, 0xA8, 0x67, 0xC9, 0xA4, 0xEE, 0x93, 0xB7, 0x8E,
+    0x12, 0xF5, 0x77, 0xB5, 0x50, 0x2E, 0xD6, 0x16, 0x63, 0xDC, 0xDA, 0x79, 0x6A, 0xD7, 0x44, 0x8C,
+    0x77, 0xAB, 0x5D, 0x61, 0xC2, 0xB3, 0x96, 0xA9, 0x87, 0x6D, 0x62, 0x7D, 0xE9, 0xB7, 0x3E, 0xE2,
+    0xD6, 0x9E, 0x03, 0x1E, 0xA2, 0xFE, 0xC0, 0x97, 0x5A, 0x3F, 0x4D, 0x1E, 0x29, 0xE5, 0x10, 0xC6,
+    0xC4, 0x97, 0x5E, 0x3B, 0x1D, 0x7A, 0x6D, 0x20, 0x09, 0x94, 0x63, 0x3B, 0x78, 0xFB, 0x6F, 0x21,
+    0xC3, 0xEB, 0x95, 0xBD, 0x22, 0xA6, 0x5C, 0xFA, 0x95, 0x8F, 0xBF, 0xFE, 0xCB, 0x5C, 0x37, 0xB2,
+    0x7D, 0xB7, 0x6F, 0xDE, 0xE9, 0xEE, 0x9C, 0xB8, 0x58, 0x2E, 0x79, 0x40, 0xFB, 0xF7, 0x53, 0xDB,
+    0xF5, 0xB7, 0x12, 0x22, 0xFB, 0x24, 0xB8, 0x09, 0x81, 0x94, 0xA1, 0x7D, 0x18, 0x3D, 0x38, 0xF1,
+    0xBF, 0x06, 0xFF, 0x8D, 0x75, 0x85, 0xFE, 0xEC, 0xC2, 0xB8, 0xD1, 0xD0, 0x5B, 0x15, 0x3C, 0x72,
+    0x18, 0xAD, 0xFD, 0x6E, 0x89, 0xBB, 0x8D, 0x9A, 0x7C, 0x9B, 0xC8, 0xAC, 0x9B, 0x6D, 0xF9, 0x73,
+    0x8B, 0xD7, 0x3A, 0xB5, 0xA6, 0xAD, 0x47, 0xFA, 0x2D, 0x4C, 0x4A, 0x34, 0xBE, 0xE0, 0x74, 0x44,
+    0xCF, 0xCF, 0xB5, 0x6B, 0x69, 0x92, 0xA0, 0x0C, 0x37, 0x26, 0x36, 0x79, 0x28, 0xE3, 0xBB, 0x88,
+    0xDE, 0xD3, 0x0E, 0xD7, 0xA5, 0x72, 0xBA, 0xF0, 0xDC, 0x99, 0x4E, 0x07, 0x79, 0x3B, 0x23, 0x2F,
+    0xCE, 0xC4, 0x88, 0x35, 0xEB, 0xD2, 0x23, 0x96, 0x98, 0x07, 0xB9, 0x5C, 0x97, 0x51, 0x93, 0x2C,
+    0xCA, 0x4D, 0x69, 0x0F, 0xF9, 0xCF, 0x7D, 0x60, 0xE7, 0x42, 0xBF, 0x85, 0x4D, 0x8F, 0x90, 0xB2,
+    0x7E, 0xF9, 0x0F, 0xDA, 0xFA, 0x03, 0xC5, 0x55, 0xB1, 0x8E, 0xE6, 0x34, 0x10, 0x9E, 0xC4, 0xA7,
+    0x8D, 0x44, 0xA4, 0x73, 0x89, 0xC4, 0x15, 0xEE, 0x69, 0xD2, 0xD2, 0x39, 0x87, 0x44, 0x45, 0x71,
+    0x14, 0x40, 0x43, 0xB1, 0x8F, 0x70, 0x8F, 0xE0, 0x1C, 0x2F, 0xC0, 0xF6, 0x57, 0x5F, 0x73, 0xBC,
+    0x03, 0xB6, 0xA0, 0xA0, 0xB8, 0x82, 0xA0, 0x7B, 0x01, 0x4B, 0x9C, 0x68, 0x28, 0xC8, 0x41, 0x24,
+    0x72, 0xC8, 0xF1, 0xF0, 0xCD, 0xE4, 0xDF, 0xFF, 0x76, 0xD1, 0x0A, 0x51, 0x81, 0xFF, 0x75, 0x56,
+    0x19, 0xDB, 0x33, 0xDF, 0x7C, 0xF3, 0x8D, 0x43, 0xED, 0x3A, 0x8C, 0xB4, 0xDB, 0x99, 0xE2, 0xC7,
+    0x2B, 0xF9, 0xEF, 0x0A, 0x0D, 0xBF, 0x31, 0x5D, 0x8F, 0x26, 0x8E, 0xD4, 0xF0, 0x46, 0xF4, 0x89,
+    0xC5, 0x9B, 0x49, 0x44, 0xEF, 0xCE, 0x44, 0x8C, 0x19, 0x56, 0x18, 0x3C, 0x66, 0x9F, 0xE8, 0xFE,
+    0x65, 0xA6, 0x9E, 0x17, 0x32, 0xB2, 0x33, 0xBE, 0x3A, 0x9D, 0x8D, 0x5C, 0x88, 0x4F, 0x93, 0x7A,
+    0xAC, 0xF8, 0x05, 0xBE, 0x26, 0xEA, 0x77, 0xA2, 0x01, 0xA7, 0x3D, 0xFE, 0x7B, 0x1E, 0xE1, 0x0A,
+    0x6E, 0x07, 0x4C, 0x9F, 0x9A, 0x31, 0x4C, 0xFD, 0xCF, 0x3C, 0x06, 0x66, 0x2C, 0xED, 0xE4, 0x78,
+    0xD5, 0x23, 0x3A, 0x3C, 0x57, 0x9D, 0x01, 0x93, 0x5A, 0x1C, 0x76, 0xAB, 0x42, 0xE9, 0xF0, 0x6A,
+    0xE5, 0x15, 0x1B, 0xDF, 0x63, 0xF8, 0xB1, 0xF9, 0x98, 0x6E, 0x6E, 0x73, 0x4C, 0x8E, 0x39, 0x0D,
+    0xF0, 0x67, 0xE1, 0xAF, 0x01, 0x48, 0xBA, 0x77, 0xCE, 0x8E, 0x2E, 0x9E, 0xCB, 0xFE, 0x88, 0x55,
+    0xEA, 0x14, 0xE6, 0xFB, 0xCF, 0x3E, 0x1B, 0xE9, 0xE6, 0x50, 0x2A, 0xBA, 0x8D, 0xEC, 0x46, 0xC3,
+    0x2C, 0xD1, 0x18, 0x99, 0x52, 0x57, 0x28, 0x82, 0xA8, 0xDC, 0x71, 0x26, 0x41, 0x3A, 0x9A, 0x62,
+    0x70, 0xDC, 0x65, 0x8F, 0x00, 0xF1, 0xC3, 0xCA, 0x93, 0x29, 0xC3, 0x2F, 0xC0, 0xFF, 0x9A, 0x91,
+    0x74, 0xFC, 0xEA, 0x35, 0x27, 0xB3, 0xF3, 0xA3, 0x0A, 0x10, 0x9B, 0x18, 0xF8, 0x4B, 0x18, 0xB8,
+    0x58, 0x31, 0x24, 0x30, 0x19, 0xF6, 0x96, 0x53, 0xCB, 0xD9, 0x0A, 0x4C, 0x0A, 0xE0, 0x8A, 0x3E,
+    0xFF, 0x7A, 0xA3, 0x56, 0x30, 0x29, 0xB0, 0x77, 0x9E, 0x3F, 0xFB, 0x94, 0xEE, 0x1A, 0x88, 0x91,
+    0xA9, 0x50, 0x98, 0x9B, 0xD2, 0xC0, 0xC5, 0xD6, 0xC1, 0xF1, 0x66, 0x79, 0xEA, 0x56, 0xCF, 0x53,
+    0xBF, 0x70, 0x18, 0xED, 0xEF, 0x7B, 0x20, 0xFB, 0xEB, 0xCA, 0x20, 0x28, 0x57, 0x1A, 0xF8, 0xC9,
+    0x4E, 0xBE, 0x9A, 0x42, 0xBE, 0xE0, 0x11, 0x16, 0x24, 0x17, 0x53, 0xBF, 0x5E, 0x3B, 0x54, 0x39,
+    0x90, 0xFD, 0x71, 0x97, 0x0A, 0x42, 0x11, 0x64, 0x8A, 0x97, 0xFA, 0xBC, 0x15, 0x85, 0xBC, 0x52,
+    0x53, 0xC9, 0x54, 0xC2, 0x31, 0x8F, 0x3F, 0x40, 0x4F, 0x0D, 0xC3, 0x35, 0xCA, 0x2C, 0x6A, 0xF1,
+    0xC9, 0x2A, 0x53, 0xE0, 0xB5, 0x03, 0x18, 0x30, 0x35, 0xC7, 0x08, 0xA6, 0xFA, 0x3F, 0x79, 0xEC,
+    0x4A, 0xF8, 0x01, 0x86, 0x9F, 0x4A, 0x58, 0x88, 0xC3, 0x4B, 0x30, 0xC5, 0xD5, 0xC2, 0xC0, 0x39,
+    0xC2, 0xC0, 0x46, 0x0C, 0x8B, 0x93, 0xD2, 0x8F, 0x30, 0xC4, 0xCD, 0x08, 0x53, 0xC9, 0x55, 0x89,
+    0x5C, 0x51, 0x55, 0x07, 0x64, 0x66, 0xF7, 0xB3, 0x4A, 0xB5, 0x2F, 0x31, 0x9D, 0xA9, 0xB0, 0x33,
+    0x40, 0x09, 0x15, 0x2E, 0xB9, 0xA2, 0x4C, 0xF8, 0x89, 0x37, 0x25, 0x22, 0xDA, 0x3F, 0x56, 0xE5,
+    0xA1, 0xF2, 0xA3, 0x45, 0x68, 0x68, 0x79, 0x73, 0xB3, 0xB0, 0x00, 0xDF, 0x3E, 0x09, 0x09, 0x3D,
+    0x4A, 0x7A, 0x2E, 0x7D, 0xE8, 0x16, 0x49, 0x14, 0x11, 0xE0, 0x76, 0x91, 0xCC, 0xFB, 0x2D, 0x42,
+    0x86, 0x1A, 0xF8, 0xF6, 0xB8, 0x80, 0x04, 0x44, 0x7B, 0x22, 0x64, 0xC8, 0x4C, 0x64, 0x5E, 0x9F,
+    0xE2, 0xC5, 0x6F, 0x14, 0x32, 0x0D, 0x1B, 0x30, 0x92, 0xDB, 0xA0, 0xBC, 0x11, 0x59, 0x92, 0x9F,
+    0x3B, 0x10, 0x6B, 0xD7, 0x96, 0xC5, 0x19, 0x41, 0xB1, 0xE0, 0x4D, 0xF4, 0x1F, 0xD2, 0x80, 0x90,
+    0x3E, 0x63, 0x37, 0x96, 0x8D, 0x48, 0x1A, 0x9D, 0x93, 0xA8, 0x87, 0xE6, 0xEB, 0xC3, 0xC7, 0x38,
+    0xCD, 0x18, 0xA0, 0x02, 0x63, 0x16, 0xC5, 0x22, 0xAC, 0xD5, 0x27, 0xA9, 0x05, 0x38, 0xEA, 0x0D,
+    0xE5, 0x4A, 0x3F, 0x2B, 0x53, 0x52, 0xBC, 0xF0, 0x7D, 0x39, 0xE1, 0xBF, 0x73, 0x34, 0xF1, 0x4A,
+    0x9C, 0x4C, 0x68, 0xAC, 0x1D, 0x3A, 0x77, 0x0B, 0x80, 0x45, 0xF2, 0x50, 0x4F, 0x8F, 0x02, 0x10,
+    0x34, 0xBA, 0xD8, 0xDC, 0xD4, 0x06, 0xB2, 0x49, 0x6E, 0x71, 0xD0, 0x19, 0x2B, 0x9C, 0xAC, 0x9D,
+    0x6D, 0xA4, 0x1B, 0xFB, 0x7A, 0x50, 0x81, 0x10, 0xAD, 0x62, 0xF2, 0xF2, 0x14, 0xB0, 0x09, 0x6D,
+    0xDE, 0xF2, 0xD4, 0x0A, 0x74, 0x49, 0xC9, 0x4A, 0x81, 0x70, 0x13, 0x68, 0x22, 0xD2, 0x9B, 0x38,
+    0x2E, 0xD9, 0x80, 0x91, 0x11, 0xF9, 0xA2, 0x8F, 0x9D, 0x64, 0xFC, 0x85, 0xF4, 0x11, 0xCC, 0x38,
+    0x78, 0x04, 0x11, 0x4F, 0xFD, 0x71, 0x93, 0xF0, 0x11, 0xE6, 0xEA, 0x04, 0x5D, 0x00, 0x60, 0x7D,
+    0x36, 0xB5, 0x2B, 0xED, 0xAE, 0x80, 0x87, 0x14, 0x3F, 0xBA, 0x5C, 0x80, 0xA1, 0x00, 0x66, 0x85,
+    0xC0, 0xB9, 0xC1, 0x2F, 0xE1, 0x56, 0x99, 0x05, 0x37, 0x76, 0x2F, 0x40, 0x98, 0xE1, 0x44, 0x38,
+    0x69, 0xB7, 0x61, 0x92, 0x0B, 0xA3, 0x9E, 0x15, 0xAF, 0x55, 0x46, 0xEF, 0xDE, 0xC5, 0xD6, 0x7F,
+    0x9F, 0x24, 0x15, 0x9B, 0x68, 0xF8, 0xB6, 0x1C, 0xC5, 0x8C, 0x2F, 0xE0, 0x7F, 0xE3, 0x1B, 0xC5,
+    0x7C, 0xF0, 0x86, 0xE4, 0x5E, 0x51, 0x12, 0x88, 0x9F, 0xA0, 0x0F, 0xE7, 0x7E, 0x31, 0xE8, 0x6A,
+    0x12, 0x16, 0x44, 0x24, 0x22, 0x91, 0xEC, 0xB2, 0x29, 0x4A, 0x03, 0xF0, 0xAC, 0x24, 0x90, 0xAC,
+    0x22, 0x97, 0x4C, 0x62, 0xBE, 0xA5, 0x1C, 0x1D, 0x12, 0x51, 0xC7, 0x71, 0x01, 0xE8, 0x8D, 0xFE,
+    0xE2, 0x64, 0xFA, 0x07, 0x35, 0xFD, 0x9B, 0xF1, 0x78, 0xBF, 0xEE, 0x33, 0x3E, 0x39, 0x1C, 0xA4,
+    0x24, 0xEA, 0xF9, 0x4D, 0x77, 0xE4, 0x86, 0x52, 0xDA, 0x63, 0x31, 0x8C, 0xDA, 0x21, 0x7A, 0xA7,
+    0x9B, 0x72, 0xEB, 0x16, 0xD2, 0xC6, 0x3B, 0x4C, 0xC2, 0xE1, 0x74, 0xFA, 0x4E, 0xF0, 0x7A, 0xEB,
+    0xFA, 0xD6, 0x00, 0xEA, 0x1E, 0xB4, 0x3F, 0xD0, 0xD8, 0x8D, 0x56, 0xE6, 0xE4, 0xE0, 0xD8, 0xDE,
+    0x68, 0x99, 0x34, 0xCE, 0xD9, 0x55, 0xD0, 0xD6, 0x3A, 0x3E, 0x66, 0x57, 0x7F, 0xCF, 0x42, 0x08,
+    0xC2, 0x8D, 0xD4, 0x81, 0x0B, 0xFF, 0x72, 0x6F, 0xF8, 0x52, 0xDD, 0xB4, 0xDF, 0x8C, 0xD8, 0x3C,
+    0x9B, 0x57, 0x76, 0xBE, 0x47, 0x76, 0x3A, 0xBE, 0x91, 0xD0, 0x03, 0x2F, 0xAD, 0x46, 0x94, 0xF6,
+    0x5F, 0x3E, 0xB8, 0xE0, 0x11, 0x61, 0x71, 0xB5, 0x8F, 0x2D, 0xCF, 0xF4, 0x7F, 0x8E, 0xBF, 0x00,
+    0x95, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x1D, 0x7B, 0x15, 0x2C, 0xE1, 0x62, 0xAB, 0x20, 0x41,
+    0xE3, 0x86, 0x86, 0x48, 0x68, 0x7F, 0x20, 0xBC, 0x5D, 0xE0, 0x03, 0x78, 0xC5, 0x7B, 0x34, 0xFC,
+    0x01, 0x0D, 0x0D, 0x65, 0x14, 0xDF, 0x8E, 0x12, 0x3E, 0x21, 0x2D, 0xA2, 0x48, 0x43, 0x1B, 0x79,
+    0x05, 0x05, 0x05, 0xC5, 0x33, 0x35, 0x8D, 0x25, 0x90, 0x52, 0xD0, 0x58, 0x91, 0x11, 0x46, 0x5A,
+    0x7B, 0x73, 0xCE, 0xAC, 0xEF, 0x23, 0x4D, 0x48, 0x62, 0x5D, 0xEF, 0x95, 0xED, 0x9D, 0x99, 0x33,
+    0x67, 0xCE, 0xCC, 0x8A, 0xE8, 0xF5, 0x76, 0xCE, 0x27, 0xB1, 0x39, 0xCF, 0xD2, 0xE6, 0x9C, 0xA4,
+    0xBA, 0x0E, 0xF2, 0xCA, 0x2B, 0x4B, 0x9D, 0xC4, 0x8D, 0xB2, 0x4B, 0xB3, 0xCA, 0xC0, 0xE7, 0x3E,
+    0x88, 0x1F, 0x7D, 0x14, 0xBB, 0x76, 0xA3, 0xD4, 0xD9, 0xCE, 0x22, 0xFD, 0xEF, 0x58, 0x6C, 0x5E,
+    0x45, 0x0C, 0xFC, 0x8A, 0x0C, 0x1B, 0x96, 0x2E, 0x0B, 0x9F, 0x19, 0x03, 0x61, 0x45, 0x60, 0x82,
+    0x65, 0xC2, 0xD2, 0xCF, 0xFC, 0xBA, 0x08, 0x60, 0xA8, 0xC9, 0xCA, 0x2D, 0xFC, 0x70, 0xF7, 0x1C,
+    0xB5, 0xFA, 0xFC, 0x3B, 0x78, 0xC9, 0x3B, 0xF7, 0xE1, 0x8B, 0xC9, 0xF9, 0x7B, 0x79, 0x93, 0x0B,
+    0xB1, 0xB2, 0x18, 0x00, 0x8F, 0xC0, 0x6A, 0x56, 0xA9, 0x77, 0x62, 0xEF, 0x66, 0x20, 0x96, 0xFC,
+    0x29, 0x20, 0xDA, 0x15, 0x69, 0xC8, 0x70, 0x83, 0xA8, 0x8D, 0x42, 0xF6, 0xC4, 0x68, 0x40, 0x8D,
+    0x88, 0x23, 0xFA, 0x2A, 0x13, 0x2E, 0x93, 0xA3, 0x31, 0x73, 0xC2, 0xF3, 0x9D, 0x61, 0xE1, 0xA6,
+    0x5D, 0xF7, 0x47, 0x9A, 0x12, 0xF5, 0x30, 0x95, 0xA0, 0xEE, 0x13, 0x7C, 0xED, 0x7E, 0xDB, 0x68,
+    0x86, 0xDC, 0x4D, 0xEA, 0x23, 0xF8, 0x71, 0xF3, 0xFF, 0xE0, 0x04, 0xC4, 0x76, 0x96, 0x21, 0x00,
+    0x62, 0x37, 0xE1, 0xC1, 0xA4, 0x0A, 0xE6, 0x39, 0xC0, 0xDC, 0x4D, 0x43, 0x90, 0x26, 0x79, 0xC0,
+    0xCA, 0x5F, 0x45, 0x06, 0x9C, 0xC8, 0x31, 0xBC, 0xD5, 0xA4, 0x4E, 0x7A, 0xA2, 0xB6, 0x5C, 0xCC,
+    0x5E, 0x0A, 0x75, 0x10, 0xAD, 0xC8, 0xFB, 0x8C, 0x4C, 0x5D, 0x31, 0x99, 0x88, 0x99, 0x15, 0xB8,
+    0x3A, 0x82, 0x2E, 0x1E, 0x4E, 0x12, 0xB8, 0x11, 0xAD, 0xDE, 0xF0, 0x2B, 0xBC, 0xB8, 0x3F, 0xF6,
+    0xD7, 0xD0, 0x02, 0x20, 0xFA, 0x08, 0x41, 0xD8, 0x05, 0x82, 0x28, 0xA4, 0xF6, 0x11, 0x4C, 0xDA,
+    0x05, 0x8C, 0x9B, 0x9D, 0xF4, 0x2A, 0xA7, 0x1D, 0x71, 0x1E, 0x85, 0x4D, 0x67, 0x4A, 0x9B, 0x7C,
+    0x8B, 0x73, 0x38, 0x1D, 0x8C, 0xBE, 0x43, 0x9C, 0xFF, 0xA5, 0xA6, 0x84, 0xD6, 0x0A, 0x56, 0xD5,
+    0x70, 0x75, 0x04, 0x35, 0x1B, 0x43, 0xDA, 0x95, 0xFA, 0xC1, 0xEF, 0xD8, 0xF0, 0xF2, 0xEB, 0xDE,
+    0x49, 0xBE, 0x84, 0xDF, 0x51, 0x94, 0x48, 0x00, 0x46, 0xED, 0xC1, 0x31, 0x9C, 0x30, 0x61, 0x55,
+    0xAE, 0xB4, 0x89, 0x8A, 0x6C, 0xD2, 0xA0, 0x14, 0xEE, 0x72, 0x16, 0x6F, 0xA1, 0xB7, 0x52, 0x29,
+    0x08, 0xE1, 0x1D, 0xFA, 0x2D, 0xC8, 0x0B, 0xD9, 0x5D, 0x92, 0x43, 0xC2, 0x85, 0xE4, 0x22, 0x1F,
+    0xF1, 0xAB, 0xBC, 0xA0, 0x62, 0x84, 0x02, 0xC7, 0x05, 0x3A, 0x5C, 0xD0, 0xD2, 0xCF, 0x82, 0xEA,
+    0xDC, 0xB9, 0x94, 0xBB, 0xE1, 0x75, 0xA5, 0x8C, 0xEC, 0x89, 0x59, 0x69, 0xA7, 0x33, 0x0A, 0xC2,
+    0x4D, 0x50, 0x0D, 0x20, 0x52, 0x2C, 0x85, 0x7B, 0x04, 0xF8, 0x86, 0x68, 0xDA, 0xA4, 0xF8, 0x7A,
+    0x55, 0x6F, 0x29, 0x00, 0xB0, 0x89, 0xA6, 0x35, 0xDE, 0x22, 0x3F, 0x72, 0x81, 0x1F, 0x51, 0x1B,
+    0xAE, 0x5F, 0x68, 0xA7, 0x6A, 0x29, 0x0E, 0x22, 0xA4, 0x57, 0x5F, 0xED, 0x21, 0x0C, 0x1B, 0x93,
+    0x74, 0x3F, 0x41, 0x00, 0x3F, 0x27, 0xE9, 0x7F, 0x49, 0x92, 0x6F, 0x74, 0x53, 0x75, 0x29, 0x57,
+    0x66, 0x96, 0x64, 0xA6, 0x2A, 0xB5, 0x63, 0xBD, 0xDA, 0x68, 0x16, 0x1B, 0x9A, 0xD9, 0x41, 0xD9,
+    0x17, 0x62, 0xA7, 0x8F, 0x50, 0x86, 0x87, 0xD0, 0x64, 0x9F, 0x73, 0xF4, 0x18, 0x40, 0x2E, 0xE7,
+    0xD0, 0xEC, 0x9E, 0xB1, 0x70, 0x3F, 0xC4, 0xCD, 0x24, 0xE0, 0xAA, 0x4A, 0x52, 0x2F, 0xEE, 0xE3,
+    0xAD, 0x1B, 0x87, 0xCF, 0x16, 0x04, 0x71, 0xCF, 0x14, 0xE4, 0xD7, 0x6F, 0x85, 0xFB, 0x66, 0xB4,
+    0x32, 0x37, 0xE1, 0x81, 0x89, 0x17, 0x32, 0x75, 0xE1, 0x41, 0x17, 0x21, 0x30, 0x66, 0xF7, 0xEE,
+    0x87, 0xC0, 0x15, 0xC4, 0xA0, 0xD1, 0x74, 0xA6, 0xE0, 0xD5, 0x80, 0x81, 0x81, 0x79, 0x91, 0x83,
+    0xFD, 0xFB, 0xFA, 0x4A, 0x85, 0x66, 0xB6, 0x73, 0x27, 0xA3, 0x21, 0x4B, 0x37, 0x5B, 0xED, 0xA0,
+    0x91, 0xAC, 0x9C, 0xBB, 0x88, 0x93, 0xA9, 0x22, 0x07, 0x4A, 0x87, 0x9F, 0x0F, 0x09, 0xB4, 0x2C,
+    0xEC, 0x7B, 0xF4, 0x60, 0x66, 0x25, 0x01, 0xCB, 0x07, 0xCA, 0xC7, 0xF5, 0x75, 0xB0, 0xE0, 0x09,
+    0x69, 0xB9, 0xA0, 0x1F, 0x91, 0x4F, 0x03, 0x27, 0x4F, 0x74, 0x57, 0xC5, 0x9E, 0x42, 0xF5, 0x57,
+    0x1D, 0x46, 0x0D, 0x9E, 0x1A, 0x38, 0xFA, 0xF1, 0x96, 0x49, 0xEA, 0x9F, 0x45, 0x44, 0x7D, 0xB5,
+    0x7C, 0xEE, 0x59, 0xE9, 0xE2, 0x6F, 0xD7, 0x37, 0x1A, 0x74, 0x52, 0xFF, 0x5B, 0x5C, 0x16, 0x33,
+    0x3F, 0x56, 0x8F, 0xB4, 0xBA, 0x56, 0xA5, 0x2D, 0x17, 0x5A, 0xE4, 0x8A, 0xD9, 0x82, 0x90, 0xA8,
+    0x6A, 0x22, 0xED, 0xDD, 0x54, 0xE9, 0x9C, 0x0E, 0xED, 0x54, 0xDE, 0xE5, 0x47, 0x64, 0x88, 0x47,
+    0x43, 0x1F, 0x1B, 0xFC, 0x81, 0x25, 0x77, 0xF2, 0x11, 0x3C, 0x6D, 0xD2, 0x23, 0x03, 0x33, 0x9B,
+    0x04, 0xAE, 0x5C, 0x74, 0x13, 0xD8, 0xCA, 0x3F, 0xE4, 0xE0, 0xC9, 0xF2, 0x0A, 0xC6, 0xC0, 0xFA,
+    0xC9, 0x6E, 0xE0, 0xFD, 0x4F, 0x65, 0x0D, 0xD7, 0xE3, 0xA8, 0x58, 0xC8, 0x49, 0x19, 0x33, 0x3A,
+    0x0F, 0xA5, 0xE7, 0x9C, 0x31, 0xBB, 0x9F, 0x5E, 0x99, 0x93, 0x26, 0x03, 0x68, 0xEF, 0xC3, 0x4B,
+    0xA8, 0x26, 0xCA, 0x03, 0x55, 0x06, 0xB9, 0xF7, 0x91, 0x4E, 0xA8, 0x66, 0xBE, 0x68, 0x23, 0x49,
+    0x87, 0xB6, 0xBB, 0x13, 0x70, 0x83, 0xF5, 0x26, 0x3E, 0x31, 0x8B, 0x5C, 0x54, 0x0B, 0xF2, 0xC4,
+    0x3D, 0x48, 0xF3, 0xD7, 0xCE, 0x23, 0x20, 0xCF, 0x16, 0x13, 0x63, 0xE7, 0xB9, 0xA5, 0x22, 0x63,
+    0x61, 0x75, 0x36, 0x80, 0x33, 0xEA, 0x60, 0x88, 0x0D, 0xCA, 0xDB, 0xEC, 0x5A, 0x7C, 0x3F, 0x17,
+    0x55, 0x3C, 0x26, 0x04, 0x9B, 0x4B, 0x4D, 0xB4, 0xB7, 0x5B, 0xED, 0x8C, 0xA3, 0xC5, 0x1B, 0x7D,
+    0x55, 0x1D, 0x6D, 0xA2, 0x9D, 0x85, 0x73, 0x55, 0x3B, 0x47, 0xE7, 0x46, 0x7E, 0xCA, 0x0D, 0x3E,
+    0x79, 0x1E, 0x35, 0x99, 0xAD, 0x67, 0x32, 0x34, 0x3B, 0x09, 0x0E, 0x10, 0xEC, 0x73, 0x3B, 0xDC,
+    0x2D, 0xC5, 0x56, 0x51, 0x0D, 0xB7, 0x03, 0xAD, 0x3B, 0x21, 0x4D, 0xCF, 0xBE, 0xD8, 0x90, 0x5E,
+    0x95, 0x50, 0x2D, 0xF3, 0x8F, 0x9E, 0xAE, 0xD8, 0xE8, 0x54, 0xB6, 0x7A, 0x50, 0x11, 0xCA, 0x76,
+    0x74, 0xAA, 0xBF, 0x99, 0xA5, 0xDE, 0xD0, 0xCC, 0x6E, 0xEC, 0x59, 0xB9, 0xAC, 0x52, 0xA6, 0xCB,
+    0xCB, 0xE2, 0xF4, 0x39, 0x95, 0x55, 0x3D, 0x8C, 0x1D, 0x35, 0x10, 0x9E, 0x5D, 0x93, 0x18, 0xB1,
+    0x02, 0x57, 0x69, 0x68, 0xB6, 0x3F, 0x09, 0xDC, 0x44, 0x88, 0x02, 0xE4, 0x8D, 0x52, 0x50, 0xA4,
+    0x49, 0x71, 0x57, 0xD3, 0xD3, 0xD0, 0x52, 0x1C, 0xD9, 0x3D, 0xA5, 0xA0, 0xA0, 0xA1, 0x80, 0x3E,
+    0x25, 0x5C, 0x45, 0x09, 0x12, 0xC9, 0x1A, 0x28, 0x28, 0x68, 0x36, 0x4A, 0x11, 0x09, 0x51, 0x3C,
+    0xF1, 0x23, 0x0A, 0x0A, 0x8C, 0x64, 0xE9, 0x2C, 0x64, 0xAF, 0xF9, 0xC6, 0xBB, 0xEF, 0xDD, 0x7B,
+    0x49, 0x40, 0x60, 0xE9, 0x79, 0xE6, 0x79, 0x66, 0x3C, 0x7F, 0xDF, 0x78, 0x4D, 0xCE, 0x8F, 0x73,
+    0x8E, 0x63, 0xCE, 0xD6, 0x5C, 0xB2, 0x2A, 0x63, 0x7D, 0xCF, 0xDB, 0x23, 0xDE, 0x1C, 0xF1, 0xE2,
+    0xC3, 0xA8, 0xB1, 0x79, 0xC3, 0x67, 0x47, 0xE7, 0xE7, 0xE7, 0xF7, 0x88, 0x76, 0xA2, 0x55, 0x08,
+    0x62, 0x0A, 0xF1, 0xAC, 0xF0, 0x1F, 0x55, 0xEA, 0x20, 0x37, 0x64, 0xE8, 0x3E, 0x09, 0xA7, 0x2C,
+    0xDD, 0xA9, 0x22, 0xA9, 0x49, 0x0F, 0x14, 0x85, 0xA3, 0x76, 0x30, 0x54, 0xFB, 0x22, 0x4E, 0x24,
+    0x59, 0xFC, 0x80, 0xC5, 0x56, 0x77, 0x3B, 0xB1, 0xF0, 0xCD, 0x2A, 0xDE, 0x40, 0x7C, 0xBF, 0x0A,
+    0x45, 0x5C, 0xB1, 0x58, 0x0F, 0x3D, 0x8B, 0x27, 0x3A, 0xA2, 0x4F, 0x89, 0x24, 0x3B, 0x0D, 0xC5,
+    0xF7, 0xD7, 0xBC, 0xCD, 0xB4, 0xB7, 0x4A, 0x44, 0x7B, 0x1A, 0x53, 0xEF, 0x29, 0x6F, 0xAA, 0x6C,
+    0x45, 0x26, 0x39, 0x53, 0x93, 0x48, 0x45, 0xD2, 0x81, 0x8E, 0xEE, 0x51, 0x76, 0x32, 0x77, 0x3A,
+    0x52, 0xB6, 0x10, 0x18, 0x57, 0xE7, 0x01, 0xA2, 0x77, 0x3E, 0x22, 0xEA, 0x43, 0x8D, 0xE2, 0x2D,
+    0x67, 0x1D, 0xCE, 0xF2, 0xD4, 0xCC, 0x6C, 0xF0, 0x8F, 0x57, 0xF5, 0xBE, 0x0F, 0x10, 0x8D, 0x0E,
+    0x42, 0x16, 0xC3, 0x4C, 0xCE, 0xD0, 0x6A, 0x12, 0x0C, 0x55, 0x2C, 0x6A, 0x6D, 0x84, 0x62, 0xF1,
+    0xCA, 0x7E, 0x6F, 0xE6, 0x41, 0xC7, 0x96, 0x7D, 0x8F, 0x53, 0x51, 0x35, 0xCE, 0xF8, 0x3A, 0x9F,
+    0xC1, 0x6F, 0x2C, 0x51, 0xFC, 0x5B, 0x1C, 0xE3, 0xFF, 0x70, 0x47, 0x2F, 0x0F, 0x44, 0xA8, 0x90,
+    0xF0, 0x44, 0xAD, 0x25, 0x1A, 0x17, 0x56, 0xAD, 0x6C, 0x00, 0xFB, 0xEB, 0x00, 0xB0, 0xBC, 0x85,
+    0x3A, 0xA2, 0x60, 0xE1, 0x64, 0xEC, 0xA8, 0x8E, 0x38, 0xDD, 0x10, 0x99, 0x8E, 0xD0, 0x24, 0x6A,
+    0xDC, 0x21, 0x8B, 0x0B, 0x13, 0xBA, 0xC0, 0xAC, 0xDD, 0xB1, 0x1A, 0xEC, 0x1D, 0xD4, 0x1F, 0x77,
+    0xD7, 0x60, 0x25, 0xD8, 0xE7, 0xE8, 0x60, 0xB1, 0x4B, 0xBE, 0xB9, 0x5C, 0xC0, 0x31, 0x50, 0x8F,
+    0x1F, 0x7A, 0x5E, 0xEE, 0xD8, 0x89, 0xAF, 0xF4, 0xE8, 0x07, 0xB0, 0xC5, 0x9D, 0x04, 0x98, 0xFF,
+    0xFA, 0x78, 0x11, 0xB7, 0xCF, 0xB4, 0x6E, 0x01, 0x6A, 0xE8, 0x11, 0xF0, 0x88, 0xA2, 0xA6, 0x93,
+    0x27, 0xC4, 0x6A, 0xFF, 0x72, 0x62, 0x6B, 0x09, 0x31, 0x5D, 0xC7, 0x4F, 0x5C, 0x06, 0x66, 0x78,
+    0x34, 0x2A, 0x76, 0x57, 0xE0, 0x0D, 0x53, 0xD4, 0x81, 0x6A, 0xB0, 0x9B, 0x72, 0xD0, 0x11, 0xEA,
+    0x93, 0x48, 0x94, 0x11, 0xD2, 0x45, 0x8F, 0x91, 0x55, 0x70, 0x18, 0xD8, 0x9A, 0x41, 0xC1, 0x7A,
+    0xAC, 0x9C, 0xD8, 0x3A, 0x3B, 0xB6, 0x5E, 0x07, 0x90, 0xAD, 0x73, 0x64, 0xEB, 0xCC, 0xE1, 0xD0,
+    0xFB, 0xD4, 0x20, 0x39, 0xDF, 0xE6, 0x6F, 0xB2, 0xD3, 0xBF, 0xD4, 0xE5, 0xAC, 0x3A, 0x56, 0x6E,
+    0xBC, 0x3B, 0x6B, 0x9F, 0xA7, 0x03, 0x96, 0x8E, 0xE9, 0x44, 0x86, 0x3A, 0x55, 0xB3, 0xF2, 0x22,
+    0x8A, 0xB9, 0xF5, 0x4D, 0x94, 0xC9, 0x38, 0x15, 0x9B, 0xD4, 0xBB, 0x16, 0xAD, 0x36, 0xC6, 0x94,
+    0x24, 0x6E, 0xD3, 0x52, 0x24, 0xDC, 0x87, 0x3C, 0xAF, 0x5B, 0x64, 0x5C, 0x5D, 0x74, 0xC8, 0xFD,
+    0xA5, 0x1F, 0xB9, 0x0A, 0xAF, 0xBB, 0x07, 0x3C, 0x1C, 0xB7, 0xD0, 0xA9, 0xDA, 0x73, 0x69, 0x4A,
+    0xD3, 0x4A, 0x5F, 0x17, 0x14, 0x2C, 0x95, 0x23, 0xC1, 0x45, 0x2A, 0xCD, 0x44, 0xB5, 0xAF, 0xD6,
+    0x03, 0xB5, 0xD3, 0x27, 0xAF, 0x75, 0xD5, 0x2C, 0x3F, 0xFB, 0x92, 0xDA, 0xCD, 0xD1, 0x0F, 0x9F,
+    0x13, 0xF2, 0xD1, 0x56, 0xB9, 0xCA, 0x9D, 0x32, 0x80, 0xCA, 0xC8, 0x95, 0x39, 0x0A, 0x7B, 0x73,
+    0xD4, 0x2E, 0x73, 0xB4, 0x85, 0x7A, 0x57, 0xE0, 0xF8, 0x14, 0xD4, 0x87, 0xF6, 0x12, 0xEA, 0x5C,
+    0x03, 0xAF, 0xEC, 0x57, 0xDA, 0x26, 0xF5, 0xB3, 0x6F, 0x6D, 0x32, 0xB5, 0x6F, 0x3F, 0x9C, 0x8C,
+    0x70, 0xEF, 0x89, 0xE9, 0xD5, 0xC5, 0x8F, 0xD8, 0x8C, 0xD2, 0x99, 0x1B, 0xA1, 0xE1, 0x40, 0xE9,
+    0x0B, 0x2D, 0xFF, 0x8C, 0xEA, 0x51, 0xD0, 0x1F, 0x38, 0xA3, 0xEC, 0xA9, 0xDA, 0x76, 0xF3, 0x54,
+    0x4E, 0x5A, 0x78, 0x73, 0x16, 0x1B, 0xD7, 0x8B, 0xA0, 0x6C, 0x92, 0x4E, 0xDF, 0x00, 0x7D, 0xB3,
+    0x9E, 0x56, 0x9D, 0x9A, 0xE1, 0x3A, 0xA1, 0x9F, 0x16, 0xBD, 0xB2, 0x2A, 0x64, 0x7B, 0x7E, 0x76,
+    0xCE, 0x75, 0xA0, 0x17, 0x49, 0x5A, 0x11, 0xAA, 0x99, 0xC6, 0xCE, 0x0C, 0x4D, 0xA0, 0x7E, 0xAA,
+    0x33, 0x29, 0x8F, 0x57, 0xA9, 0xDA, 0xD0, 0xF3, 0xAC, 0x31, 0x71, 0x81, 0x81, 0x2F, 0x09, 0x80,
+    0x24, 0xAA, 0x12, 0x17, 0x8C, 0x53, 0x66, 0x2D, 0x3C, 0x75, 0x6F, 0x10, 0x0D, 0x2B, 0xA8, 0xEC,
+    0x42, 0xDB, 0xCD, 0x8A, 0xFE, 0xB0, 0x50, 0x99, 0x8A, 0x34, 0x88, 0x7C, 0x0B, 0x5C, 0x93, 0xE9,
+    0xE4, 0xED, 0x54, 0x6A, 0x48, 0x9A, 0xA9, 0x9E, 0xA9, 0xE7, 0x16, 0x20, 0xB8, 0xB1, 0xB4, 0x22,
+    0xA7, 0x5C, 0x68, 0xCB, 0x58, 0x83, 0xF9, 0x05, 0x28, 0x7C, 0x8A, 0xD4, 0x67, 0x5F, 0x65, 0xC0,
+    0x56, 0x65, 0x4F, 0x23, 0x10, 0xF9, 0x1D, 0xA8, 0xD9, 0x50, 0x7F, 0x81, 0xF7, 0x10, 0xCD, 0xB8,
+    0xF6, 0x2E, 0xF0, 0x77, 0xE5, 0x98, 0x5D, 0x14, 0xC3, 0x15, 0xDA, 0x4C, 0x7F, 0x2F, 0x38, 0x6C,
+    0xF3, 0xC3, 0x5C, 0x3C, 0xE6, 0xC9, 0xA0, 0x12, 0xA0, 0x18, 0x3B, 0xCF, 0xD3, 0xC0, 0xF0, 0x5E,
+    0x28, 0x64, 0xFB, 0x13, 0x5C, 0xDD, 0x5E, 0x1B, 0x11, 0xD7, 0xFF, 0x79, 0x15, 0x8C, 0x6B, 0xB2,
+    0x66, 0xF9, 0xC4, 0xB0, 0xFF, 0xDD, 0xBA, 0x8A, 0xDF, 0x2B, 0xCB, 0xF4, 0xC9, 0xCB, 0xD7, 0xA3,
+    0x79, 0x82, 0x05, 0x5A, 0xE7, 0x43, 0x76, 0x7D, 0xA4, 0xD4, 0xD3, 0x0F, 0xC9, 0x5A, 0xC8, 0x58,
+    0xFC, 0x55, 0x65, 0x6A, 0x89, 0xAB, 0x56, 0x97, 0x79, 0x1D, 0x76, 0x1A, 0xCC, 0x55, 0x05, 0xC9,
+    0x9C, 0xAF, 0x70, 0x5B, 0xD0, 0xB3, 0x17, 0x74, 0xBE, 0xE3, 0x01, 0x9E, 0x90, 0xE3, 0x1F, 0xF8,
+    0xFE, 0xE4, 0x6F, 0x03, 0xBD, 0x60, 0xEE, 0x22, 0xEE, 0xFE, 0x26, 0xB6, 0x91, 0x47, 0x22, 0x4B,
+    0xC4, 0x30, 0x43, 0xBB, 0x4A, 0x18, 0xA1, 0x3A, 0xF6, 0x96, 0xC4, 0x5C, 0xCC, 0x38, 0x3E, 0xAE,
+    0x95, 0x60, 0x6F, 0x62, 0xDE, 0xB6, 0x55, 0xC5, 0xED, 0xA6, 0x07, 0x7A, 0xF6, 0xC2, 0xEB, 0x8A,
+    0x38, 0x3B, 0x36, 0x2D, 0x1B, 0x15, 0x0C, 0x50, 0x49, 0x01, 0x51, 0x2C, 0x08, 0x40, 0x62, 0xF3,
+    0xF2, 0x2E, 0xFD, 0x86, 0x07, 0x85, 0xBF, 0xE4, 0xE5, 0xA1, 0x6C, 0x7E, 0xC2, 0xC3, 0x82, 0xB6,
+    0xB3, 0xEB, 0x6B, 0xDD, 0xC1, 0xB5, 0x7F, 0x03, 0x7D, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0x9E,
+    0xBB, 0x25, 0x39, 0xC4, 0x2A, 0x5A, 0x23, 0x91, 0xCA, 0xC8, 0xDB, 0x50, 0x19, 0x93, 0x6B, 0x28,
+    0x5C, 0xD8, 0xEC, 0x49, 0xE9, 0xA8, 0x5C, 0xC4, 0xB4, 0x14, 0x34, 0x88, 0x2A, 0x85, 0x8B, 0x27,
+    0x11, 0x71, 0x0B, 0x2E, 0x53, 0x24, 0xFC, 0x03, 0x88, 0x0A, 0x29, 0x29, 0xC0, 0x85, 0x25, 0xBF,
+    0x02, 0x73, 0x87, 0x41, 0x4A, 0x41, 0x73, 0xFC, 0xE8, 0x10, 0xD2, 0x22, 0x45, 0x34, 0x14, 0xDE,
+    0x48, 0x07, 0x3A, 0x94, 0xBB, 0x5B, 0x66, 0x66, 0xEF, 0x3D, 0x3F, 0xA3, 0x90, 0x27, 0xBD, 0xBD,
+    0xDD, 0xDB, 0x9D, 0xFD, 0x66, 0xE6, 0xFB, 0x66, 0x0E, 0xE0, 0x25, 0x00, 0x78, 0xF9, 0xF7, 0x02,
+    0xE4, 0x97, 0x73, 0x80, 0x30, 0x02, 0xA4, 0xA1, 0x00, 0xA8, 0x70, 0x92, 0x3F, 0x75, 0x00, 0xF7,
+    0xDE, 0xB6, 0x30, 0x6B, 0xE7, 0x7B, 0x77, 0xDF, 0x3D, 0x3F, 0x35, 0x21, 0x84, 0x4F, 0x82, 0xAB,
+    0x6A, 0x39, 0xE4, 0xE1, 0x6E, 0x08, 0x63, 0x77, 0xF2, 0xC3, 0x7B, 0xDF, 0xC2, 0x0E, 0x6C, 0x43,
+    0x02, 0x8B, 0xDF, 0x1E, 0x0D, 0xAA, 0xA6, 0xB1, 0xE7, 0x69, 0x43, 0xE3, 0x40, 0x83, 0x74, 0x34,
+    0x56, 0x34, 0x64, 0x9E, 0xC6, 0x92, 0x06, 0xD1, 0xD2, 0x68, 0x0A, 0x9A, 0x76, 0x3C, 0x25, 0xE3,
+    0x94, 0x8D, 0x73, 0x9E, 0xB2, 0xB1, 0xA6, 0x7B, 0x92, 0x91, 0xAF, 0x64, 0xE3, 0xB0, 0x32, 0x2D,
+    0xE0, 0xD2, 0xEF, 0xEA, 0x58, 0x40, 0x86, 0x56, 0x59, 0x08, 0xA0, 0xC2, 0x00, 0x22, 0x84, 0x4E,
+    0x86, 0xE0, 0xA1, 0x7A, 0x9C, 0x37, 0xE1, 0x97, 0xD2, 0x8A, 0x06, 0x46, 0x69, 0x11, 0x63, 0x0D,
+    0x94, 0x5B, 0x03, 0x4D, 0x30, 0xE3, 0x04, 0x4A, 0x40, 0xE4, 0x02, 0x2D, 0xD8, 0x21, 0x5A, 0x90,
+    0xD3, 0x0A, 0x1D, 0xD5, 0x88, 0x97, 0xE1, 0x49, 0xD9, 0xD3, 0xED, 0x35, 0xAC, 0x23, 0x74, 0x16,
+    0x1C, 0xA2, 0xA0, 0x55, 0x68, 0x21, 0xC1, 0x39, 0x28, 0xB4, 0xCA, 0xF1, 0x60, 0x82, 0x9B, 0x82,
+    0xDC, 0xA4, 0x45, 0x89, 0x1B, 0xB4, 0x90, 0x14, 0x4D, 0x65, 0x11, 0x0F, 0x9D, 0xBE, 0x02, 0xF1,
+    0xFF, 0xFF, 0xBF, 0xEB, 0x78, 0xEA, 0x3A, 0xA5, 0x06, 0x01, 0x25, 0x65, 0xAA, 0xAA, 0x63, 0xE8,
+    0x17, 0x20, 0x36, 0x82, 0x18, 0xDC, 0x2D, 0xFD, 0xAA, 0xED, 0x3A, 0x1E, 0x49, 0xD1, 0x02, 0x7D,
+    0x4A, 0x5C, 0x12, 0x88, 0xDC, 0x53, 0x08, 0x8F, 0x31, 0x1E, 0x03, 0xAA, 0xC0, 0xBC, 0xEB, 0x3A,
+    0x21, 0x6A, 0x94, 0x63, 0x02, 0x98, 0x08, 0x7C, 0xD5, 0xC7, 0xBC, 0xD2, 0x9D, 0x59, 0xC7, 0xC4,
+    0x20, 0x38, 0x31, 0x81, 0x29, 0xA5, 0x7C, 0xE7, 0x23, 0xBD, 0x27, 0x89, 0x10, 0x33, 0x66, 0x60,
+    0x7F, 0x34, 0xBE, 0x29, 0x2D, 0xE7, 0x45, 0x36, 0xD1, 0xA1, 0x23, 0xF6, 0x0D, 0x5E, 0x58, 0xF2,
+    0xF3, 0xDA, 0xF3, 0x02, 0xDD, 0x47, 0x98, 0x91, 0xEF, 0x48, 0xD1, 0xCA, 0xA0, 0x4B, 0x98, 0x52,
+    0x15, 0x63, 0xA2, 0x9C, 0x99, 0x9E, 0x6F, 0xD5, 0x4C, 0x3B, 0xE6, 0xBB, 0xBE, 0x30, 0x4D, 0x0A,
+    0x8A, 0x14, 0xC4, 0x59, 0x20, 0x3C, 0x24, 0x9B, 0xC8, 0x90, 0xE1, 0x2F, 0x22, 0x4B, 0x9D, 0x17,
+    0xA4, 0x35, 0xF5, 0x3D, 0xEB, 0x0C, 0xA3, 0xC8, 0xF0, 0x61, 0xD0, 0x51, 0xA2, 0xA4, 0xE0, 0x78,
+    0xAA, 0xC8, 0xF9, 0xC8, 0x4C, 0x27, 0x43, 0xA4, 0xAD, 0xA7, 0x30, 0xF1, 0x91, 0x22, 0xA9, 0x18,
+    0xAE, 0x20, 0x3C, 0xD5, 0x92, 0xA8, 0x40, 0x78, 0xC9, 0xE2, 0x74, 0x8A, 0x1F, 0x6B, 0x9A, 0x55,
+    0x0B, 0xE6, 0xFE, 0xF3, 0x83, 0x4C, 0x02, 0xC5, 0x88, 0xEE, 0xB1, 0x88, 0xB3, 0x20, 0x06, 0x8E,
+    0x83, 0xAF, 0xD4, 0x23, 0xDF, 0x65, 0xA6, 0xC7, 0xF0, 0x0C, 0xEB, 0x18, 0x6F, 0xD6, 0xC0, 0x45,
+    0xF9, 0x4C, 0xA5, 0x33, 0xD5, 0xCA, 0x54, 0x64, 0x53, 0x81, 0xE1, 0x2D, 0xD3, 0x03, 0x53, 0x72,
+    0x65, 0x8F, 0x25, 0x8E, 0x41, 0x11, 0xD5, 0xE8, 0x08, 0xDB, 0x87, 0x9A, 0xE5, 0x5D, 0x3A, 0xB6,
+    0x37, 0xDD, 0x7F, 0xEC, 0xCB, 0x48, 0x9A, 0x89, 0xC0, 0x3A, 0x02, 0xC7, 0x7A, 0x5B, 0xE2, 0x77,
+    0x97, 0xF0, 0xC7, 0xC9, 0x3E, 0xE7, 0xB3, 0xE5, 0x3D, 0x3E, 0x64, 0x1E, 0xF1, 0xAE, 0xFE, 0x39,
+    0xD6, 0xEB, 0x13, 0x26, 0x4E, 0xB6, 0xFB, 0x7B, 0x93, 0xA8, 0x97, 0x05, 0x3E, 0x55, 0xF4, 0xF2,
+    0x81, 0x4A, 0x58, 0xC5, 0x77, 0xAB, 0xF8, 0xB2, 0xBB, 0x14, 0x7F, 0xDC, 0x83, 0xE8, 0x22, 0x2C,
+    0x9A, 0xC1, 0x29, 0x3C, 0xA9, 0x8F, 0xDE, 0xDC, 0xFD, 0x6D, 0xE3, 0xA9, 0xFC, 0xF0, 0xEC, 0x27,
+    0x57, 0x79, 0xDD, 0x26, 0x9F, 0x03, 0xBC, 0x88, 0x0D, 0xAB, 0x17, 0xF3, 0x6B, 0x07, 0xBB, 0x5D,
+    0xE8, 0x53, 0x27, 0x9A, 0xE4, 0x61, 0x11, 0x9A, 0xDB, 0xB0, 0x85, 0x25, 0x25, 0xBE, 0x2A, 0x12,
+    0xF7, 0x69, 0x6B, 0x7A, 0xDD, 0x27, 0xB7, 0x00, 0x36, 0x6D, 0xE9, 0x66, 0xB0, 0x7B, 0x5F, 0x0F,
+    0xF2, 0xD1, 0x77, 0xB5, 0xF3, 0xC7, 0xA6, 0x4F, 0x39, 0x65, 0xC3, 0x07, 0x5F, 0xC3, 0x0C, 0x7C,
+    0xEA, 0x45, 0x23, 0x6B, 0x65, 0x0D, 0x6C, 0xB2, 0xC7, 0xF5, 0xEC, 0x60, 0x6B, 0x2B, 0x1B, 0xD2,
+    0xF3, 0x9B, 0x78, 0x78, 0x6E, 0xFA, 0x8C, 0xDD, 0x5C, 0x83, 0x60, 0xFD, 0xD1, 0xED, 0x57, 0xB7,
+    0x94, 0x0C, 0x75, 0xE5, 0xC0, 0x97, 0x5D, 0xDE, 0x2E, 0x79, 0xFD, 0x07, 0x7B, 0x41, 0x8E, 0x7D,
+    0x0A, 0x65, 0xDB, 0x42, 0xD9, 0x96, 0x56, 0x76, 0x49, 0x87, 0x39, 0xC8, 0xAD, 0x6E, 0x44, 0x87,
+    0xA9, 0x2D, 0x0B, 0x53, 0x4B, 0x9F, 0xD1, 0xBB, 0xCA, 0x6A, 0xAF, 0xDA, 0x74, 0x44, 0x06, 0x4D,
+    0x93, 0xFB, 0x6C, 0xC0, 0x8A, 0xC0, 0x7E, 0xF0, 0x11, 0xBC, 0xB1, 0x9D, 0x1D, 0xDA, 0x93, 0x6D,
+    0x75, 0xF2, 0xF1, 0x1F, 0xC7, 0x1B, 0x3A, 0x0D, 0x4E, 0xF7, 0xF0, 0x0D, 0xC0, 0xFB, 0xCA, 0x99,
+    0x62, 0x27, 0xF1, 0xD2, 0xEE, 0x20, 0xEA, 0x48, 0xBD, 0x29, 0x79, 0x80, 0x20, 0x57, 0x33, 0x6C,
+    0xEA, 0xA0, 0x20, 0x73, 0x69, 0x87, 0x6A, 0x34, 0x83, 0x8C, 0xE5, 0x74, 0x0B, 0x9B, 0x48, 0x22,
+    0x2C, 0x1C, 0x20, 0x23, 0xAF, 0x3B, 0xD8, 0x48, 0xFF, 0x74, 0x18, 0x04, 0x35, 0xC6, 0x42, 0xD4,
+    0xC2, 0x8B, 0x3B, 0xE2, 0x33, 0xF1, 0xEB, 0x61, 0x68, 0xDF, 0xE9, 0x60, 0x0E, 0x6F, 0x41, 0xB2,
+    0x8F, 0x89, 0x3B, 0xE0, 0xC4, 0xA5, 0x94, 0xB8, 0x2F, 0xBC, 0xE9, 0xA8, 0x62, 0x37, 0xAD, 0xEE,
+    0x11, 0xE1, 0xEF, 0x42, 0x8F, 0xA9, 0xF7, 0xBB, 0x4A, 0x9C, 0xB9, 0xBC, 0x47, 0x75, 0x6C, 0x3E,
+    0x28, 0x07, 0x4C, 0xFE, 0x31, 0x78, 0xE1, 0xB2, 0x5A, 0xD5, 0xBA, 0x30, 0x51, 0x68, 0x37, 0xEE,
+    0x88, 0xC3, 0x7A, 0x36, 0x4B, 0x03, 0x16, 0xFB, 0x86, 0x14, 0x3F, 0x7A, 0x33, 0x42, 0x60, 0xFA,
+    0x5F, 0x01, 0xDD, 0x66, 0x37, 0xAD, 0xDB, 0xB9, 0x26, 0x6D, 0x68, 0xB3, 0x80, 0x8D, 0xCC, 0xF4,
+    0x62, 0x12, 0x1A, 0xDC, 0x28, 0x62, 0x53, 0x4C, 0xC7, 0xA9, 0xA7, 0x52, 0xC5, 0xB3, 0xA8, 0xA8,
+    0xE3, 0x90, 0x64, 0x78, 0x51, 0xAD, 0x2E, 0x48, 0x56, 0x54, 0xFC, 0xAC, 0x56, 0x52, 0x35, 0xBF,
+    0xA5, 0x2A, 0x61, 0xB6, 0xE8, 0x2C, 0x6F, 0x87, 0x85, 0xDA, 0x2E, 0x4F, 0xDA, 0xE9, 0x72, 0x56,
+    0x20, 0xF5, 0xE2, 0x8C, 0xCD, 0x9B, 0xD8, 0xDC, 0xD9, 0x01, 0xFE, 0x18, 0xAE, 0xDB, 0xC5, 0x19,
+    0xBB, 0x62, 0x45, 0xF7, 0x70, 0xF9, 0xE7, 0xCD, 0x8A, 0x3B, 0x6A, 0xE1, 0x0E, 0x35, 0x59, 0xAE,
+    0xA9, 0xB0, 0xF0, 0x6D, 0xB1, 0xE0, 0xF6, 0xDB, 0x4E, 0xC6, 0x66, 0xB2, 0x89, 0x91, 0x4E, 0x35,
+    0x42, 0x01, 0x12, 0x20, 0x27, 0x87, 0xB0, 0xCA, 0x3A, 0x7E, 0x20, 0xE8, 0x43, 0xC1, 0xBD, 0xA6,
+    0x78, 0x46, 0x53, 0xFA, 0x17, 0x5D, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0xBD, 0xB6, 0x21, 0x96,
+    0x70, 0xF1, 0x1A, 0xAA, 0x50, 0xB8, 0x86, 0xC6, 0x3D, 0x12, 0x79, 0x4E, 0x9A, 0x94, 0xD9, 0x62,
+    0x97, 0x82, 0x7F, 0x00, 0x14, 0xFB, 0x07, 0x58, 0x3C, 0x22, 0x05, 0x25, 0x91, 0x88, 0x68, 0xD3,
+    0xA4, 0x5A, 0x81, 0x86, 0x92, 0x62, 0x17, 0x1B, 0x52, 0xD0, 0x5A, 0x50, 0xA4, 0xC4, 0x0A, 0x20,
+    0x24, 0x9A, 0xBC, 0x10, 0x43, 0xBC, 0x89, 0xED, 0xCB, 0x39, 0xF7, 0xED, 0x6C, 0x36, 0x3C, 0x8D,
+    0xEE, 0x8C, 0x9F, 0xEF, 0xC7, 0xB9, 0xE7, 0x7E, 0x8C, 0x88, 0x24, 0xE1, 0x3B, 0x11, 0x71, 0x3F,
+    0xF5, 0x90, 0x47, 0x15, 0x44, 0x16, 0x46, 0xC8, 0xF2, 0x66, 0x07, 0x79, 0xF2, 0x1E, 0xC4, 0x5B,
+    0x67, 0x93, 0x48, 0xAE, 0x3A, 0x88, 0xA8, 0x6A, 0x2D, 0xA5, 0xEA, 0x2C, 0x89, 0xF2, 0xC2, 0x69,
+    0x98, 0x78, 0x0B, 0xEB, 0x5C, 0x4F, 0xBD, 0x88, 0x7F, 0xF6, 0x64, 0x94, 0x54, 0xEF, 0xDD, 0xEA,
+    0xC4, 0x2D, 0xB4, 0x6E, 0x9E, 0x3E, 0x0A, 0xB8, 0xD8, 0xBA, 0x0D, 0x94, 0xA7, 0x13, 0x68, 0xE8,
+    0x03, 0x73, 0x54, 0x7D, 0x23, 0x19, 0x7C, 0x8C, 0x52, 0x40, 0x76, 0x74, 0xAA, 0x7C, 0xA9, 0x93,
+    0x49, 0xA8, 0xB4, 0x8C, 0x95, 0xFD, 0x1C, 0x80, 0xA0, 0x82, 0xB5, 0x08, 0xAD, 0xA5, 0xA0, 0xB5,
+    0xBC, 0x7D, 0x55, 0x2E, 0x9D, 0x2B, 0x7A, 0x26, 0x74, 0x33, 0xD0, 0xE3, 0x62, 0xD0, 0x3A, 0x69,
+    0xF4, 0xC5, 0x84, 0x90, 0x30, 0xCC, 0x94, 0xA9, 0x34, 0x74, 0xE4, 0x16, 0x88, 0xC4, 0x9E, 0xFD,
+    0x58, 0x3C, 0xDE, 0x64, 0x2A, 0x08, 0xD8, 0x06, 0xF7, 0x7C, 0xE3, 0xD6, 0x64, 0x06, 0xAE, 0x80,
+    0x24, 0x9C, 0x3E, 0xFC, 0xB7, 0x67, 0xAE, 0x0B, 0x7E, 0x46, 0x5F, 0xC8, 0x98, 0x68, 0x37, 0xC4,
+    0x09, 0x84, 0x15, 0xB1, 0x5D, 0x3A, 0x49, 0xDB, 0x13, 0x76, 0x88, 0x34, 0xF9, 0xBE, 0xEC, 0x04,
+    0xCE, 0x98, 0x42, 0x47, 0x33, 0xBA, 0x81, 0xD5, 0x6C, 0xEC, 0x4A, 0x44, 0x09, 0x47, 0x41, 0x3E,
+    0xD2, 0xE3, 0x8D, 0x64, 0xC6, 0x37, 0x1C, 0xA4, 0x4A, 0x4F, 0x23, 0x01, 0xE8, 0x5D, 0x06, 0x1D,
+    0x53, 0x18, 0x87, 0x37, 0x8E, 0x8F, 0x8F, 0x37, 0x31, 0x8E, 0xA3, 0xF5, 0x2A, 0xD9, 0x4C, 0xE5,
+    0x4D, 0xB2, 0x0A, 0x11, 0x8B, 0x32, 0xBD, 0x59, 0x7C, 0x47, 0x60, 0x75, 0x35, 0xD0, 0xC1, 0x40,
+    0xD5, 0x5C, 0xE7, 0xA8, 0xAA, 0xA9, 0xA9, 0xB6, 0x1D, 0x60, 0xAB, 0x9D, 0x10, 0xBF, 0xC6, 0x77,
+    0xB6, 0x6B, 0xFB, 0xF8, 0xF9, 0x7D, 0xA8, 0x96, 0xCF, 0x66, 0x42, 0xBB, 0xAD, 0xA6, 0xDA, 0x5B,
+    0x86, 0x6D, 0xF0, 0x24, 0xCB, 0xCF, 0x05, 0x2B, 0x52, 0xAE, 0x09, 0xEA, 0x05, 0xA6, 0xEB, 0xC6,
+    0x54, 0x3B, 0xB7, 0x5E, 0xA2, 0x40, 0x23, 0xD7, 0x1A, 0x13, 0x84, 0x42, 0x3E, 0xA6, 0x8B, 0x55,
+    0x57, 0x17, 0xD2, 0x08, 0x06, 0xCA, 0x01, 0x37, 0x52, 0xFD, 0xB1, 0x9D, 0x77, 0xA5, 0x6E, 0x4C,
+    0x9F, 0x3C, 0xB1, 0x27, 0x56, 0x73, 0x73, 0x27, 0x32, 0x61, 0x99, 0xE2, 0xE4, 0x26, 0x8B, 0xC5,
+    0xF2, 0x27, 0x85, 0x52, 0x9A, 0xAC, 0x26, 0x4A, 0x6F, 0x12, 0x61, 0x22, 0x43, 0xE7, 0x75, 0x71,
+    0x6A, 0x2A, 0x49, 0x28, 0x3A, 0x53, 0x95, 0x4F, 0xCC, 0xDF, 0x10, 0x1F, 0x8F, 0x84, 0xFD, 0xBB,
+    0x29, 0xBA, 0xA6, 0x96, 0x66, 0x11, 0x42, 0x70, 0x5F, 0x75, 0x0E, 0xE1, 0x93, 0x10, 0xF3, 0x28,
+    0xC9, 0x24, 0x52, 0x1D, 0x81, 0xE1, 0xB0, 0x63, 0x58, 0xBF, 0x81, 0xC7, 0x66, 0xCC, 0x47, 0x07,
+    0x17, 0x6D, 0xD7, 0x5E, 0x27, 0x9E, 0xD9, 0x85, 0x0A, 0x75, 0x73, 0xBD, 0x66, 0x8B, 0xE4, 0x37,
+    0x96, 0x32, 0xF8, 0x1E, 0xF6, 0x3F, 0x2A, 0x90, 0x7B, 0x1D, 0xFD, 0xD0, 0x0C, 0x99, 0xAE, 0xC9,
+    0x7E, 0xB2, 0x7F, 0x9E, 0x85, 0x9D, 0x14, 0x8E, 0xBD, 0x14, 0x83, 0x24, 0x93, 0x54, 0xB5, 0x14,
+    0xBD, 0x9C, 0xF2, 0x82, 0xD7, 0x13, 0x9F, 0xF0, 0xA9, 0xAE, 0xA3, 0x0F, 0x73, 0xA3, 0xCE, 0x5B,
+    0xB5, 0xB6, 0xAA, 0xED, 0x5F, 0xB5, 0xBF, 0x35, 0x02, 0xC5, 0xD2, 0xFE, 0x89, 0x4E, 0x7F, 0xA6,
+    0xDB, 0x9A, 0x8D, 0x42, 0x2A, 0x57, 0x9B, 0xCD, 0xA7, 0x9C, 0x17, 0xFD, 0x62, 0x66, 0x9B, 0x7B,
+    0xB0, 0xEA, 0x03, 0x49, 0xD1, 0xDB, 0x40, 0x9A, 0xCD, 0x6C, 0x07, 0x17, 0x3C, 0x59, 0x7A, 0x77,
+    0x9F, 0x28, 0x1A, 0xDA, 0x80, 0xF9, 0x19, 0x64, 0x90, 0x79, 0xC8, 0xDA, 0x27, 0x13, 0x86, 0xA0,
+    0x4A, 0x47, 0x74, 0x69, 0x95, 0x85, 0xEC, 0xC9, 0x5D, 0x9F, 0x87, 0xFC, 0xD1, 0x74, 0xAD, 0x18,
+    0x8A, 0x5F, 0xC6, 0x23, 0xD7, 0xBB, 0x07, 0xE1, 0xD4, 0x75, 0xEE, 0xF3, 0xF0, 0x75, 0xD5, 0x95,
+    0x37, 0x03, 0x58, 0xA9, 0x8A, 0x20, 0x8D, 0xF8, 0x62, 0x4A, 0x54, 0xAE, 0xE5, 0xBA, 0x5D, 0xE5,
+    0x28, 0x65, 0x7B, 0xBF, 0x29, 0x87, 0xB1, 0x06, 0x1F, 0x98, 0x14, 0x8B, 0x69, 0x63, 0xFC, 0xFE,
+    0x59, 0x4D, 0x76, 0x17, 0x6B, 0x93, 0xCE, 0xCA, 0x81, 0xE7, 0x7B, 0xF8, 0x55, 0x5A, 0xD7, 0x90,
+    0xFF, 0xC4, 0xF0, 0x7A, 0x76, 0x76, 0xD6, 0x3B, 0x00, 0x3D, 0x49, 0xA0, 0x5F, 0x74, 0x6C, 0xF1,
+    0xF6, 0x42, 0x8B, 0x1C, 0x33, 0x87, 0xC3, 0x1D, 0xB3, 0x07, 0x07, 0x07, 0x7B, 0x9C, 0xCD, 0xD5,
+    0x86, 0xB5, 0x97, 0x57, 0x97, 0x84, 0x6D, 0x16, 0xCE, 0x38, 0x7E, 0x65, 0xB6, 0x79, 0x58, 0x13,
+    0x37, 0xED, 0xB3, 0xE6, 0x73, 0x6C, 0xDA, 0x48, 0x68, 0xC3, 0x26, 0x6A, 0x63, 0x3F, 0xF5, 0xBC,
+    0xEB, 0xE9, 0xB5, 0x07, 0x67, 0x7B, 0xE7, 0xBD, 0x99, 0xAA, 0xCD, 0x2B, 0x3C, 0x25, 0xF4, 0x64,
+    0x3D, 0x04, 0x1D, 0x20, 0x4D, 0x30, 0xAB, 0xAF, 0x03, 0xC8, 0x01, 0x2C, 0x74, 0xF5, 0xBB, 0x12,
+    0xCE, 0x0D, 0x85, 0xA4, 0xEB, 0x6B, 0xEC, 0xEB, 0x13, 0x66, 0x30, 0x32, 0x63, 0x2E, 0x47, 0x74,
+    0x7C, 0x4E, 0x74, 0x05, 0x9D, 0xB8, 0xE6, 0x6F, 0x4E, 0x1C, 0x99, 0x69, 0x90, 0xE3, 0x95, 0xB8,
+    0x16, 0x87, 0xF8, 0x84, 0xE4, 0x01, 0xED, 0x4B, 0x22, 0xC8, 0xD4, 0xDA, 0x5E, 0xFE, 0x3F, 0x81,
+    0x9C, 0x38, 0xDB, 0x6F, 0xF6, 0x95, 0xAC, 0x57, 0x60, 0x61, 0x3D, 0x84, 0x47, 0xDF, 0x65, 0x53,
+    0x6C, 0x2B, 0x84, 0x2B, 0xCE, 0x3E, 0x56, 0xD9, 0xCD, 0x61, 0xDC, 0x99, 0xB4, 0x9D, 0xE3, 0xDD,
+    0x66, 0x37, 0x8A, 0x52, 0xC4, 0x02, 0xFA, 0x21, 0xC6, 0xD8, 0xBC, 0x9C, 0x46, 0x61, 0x97, 0xED,
+    0xF6, 0x69, 0x64, 0xF3, 0x62, 0x20, 0x2F, 0x8E, 0xB3, 0x97, 0xDE, 0x14, 0xED, 0x55, 0x61, 0x75,
+    0xF1, 0xA4, 0xF8, 0xAA, 0x3E, 0xAF, 0x19, 0x73, 0xB5, 0xF8, 0x93, 0xFD, 0x09, 0x70, 0x80, 0xC6,
+    0xAB, 0xB5, 0xD3, 0x5B, 0xAC, 0x75, 0x68, 0x98, 0xE9, 0x8D, 0x89, 0x43, 0xEF, 0x7A, 0xEE, 0x25,
+    0x6F, 0xA9, 0x03, 0x53, 0x39, 0xE5, 0x30, 0x6F, 0x7B, 0xF0, 0xFC, 0x99, 0xD6, 0x70, 0xE2, 0x96,
+    0xEC, 0x05, 0x86, 0x6E, 0x74, 0x3F, 0xE8, 0x1D, 0x0D, 0x9F, 0x3A, 0x6E, 0xCF, 0x55, 0x3B, 0xDB,
+    0x40, 0xB6, 0xC8, 0x67, 0x0B, 0x30, 0x50, 0xAE, 0xF6, 0xAF, 0x41, 0x0C, 0x96, 0x5D, 0x66, 0x89,
+    0x94, 0x06, 0xF5, 0x43, 0x83, 0x7D, 0xB8, 0x5A, 0xA2, 0x3E, 0x36, 0x71, 0x1E, 0x39, 0x95, 0xDF,
+    0xAB, 0x31, 0x8E, 0x70, 0xCC, 0x3F, 0x36, 0x0A, 0x0A, 0xDF, 0xCB, 0x39, 0xAD, 0x73, 0x66, 0x5F,
+    0x4B, 0x1A, 0xD7, 0xEB, 0x8E, 0x84, 0x2A, 0xEE, 0x5C, 0x17, 0x77, 0x6E, 0x11, 0x55, 0x31, 0x70,
+    0xF2, 0x2D, 0x9D, 0x0C, 0xF9, 0x62, 0x3B, 0xCB, 0x82, 0xA4, 0xF6, 0xA7, 0x28, 0xB1, 0x8D, 0x71,
+    0xB6, 0x7A, 0xFF, 0x55, 0x3E, 0x37, 0xE7, 0x0B, 0x04, 0xEB, 0x98, 0xFD, 0x93, 0x63, 0xC1, 0xE8,
+    0xB2, 0xE7, 0x7F, 0xED, 0xF2, 0x7F, 0x26, 0xD1, 0xAA, 0x76, 0xBF, 0x85, 0x64, 0xF1, 0x52, 0x3D,
+    0x1C, 0x52, 0xFD, 0x1E, 0x1A, 0x13, 0x9B, 0x18, 0xE8, 0x6C, 0x47, 0xC2, 0x2C, 0x1F, 0x5E, 0x3A,
+    0xFB, 0x0F, 0x65, 0x55, 0x3D, 0x6F, 0xE5, 0x44, 0x14, 0x1D, 0xDB, 0xD1, 0x1A, 0xB0, 0xD0, 0x88,
+    0x02, 0xB4, 0x62, 0xA5, 0x35, 0x25, 0x05, 0xE0, 0x66, 0xEB, 0x37, 0x0E, 0x14, 0x5B, 0x50, 0x40,
+    0x43, 0x45, 0xB1, 0xD4, 0x6C, 0x41, 0x47, 0x17, 0xEC, 0x28, 0x3F, 0x20, 0x29, 0x22, 0x51, 0x92,
+    0x62, 0x91, 0xD8, 0xD7, 0x6C, 0x03, 0x0D, 0x0A, 0x19, 0x43, 0x0A, 0x8A, 0x14, 0xB1, 0x94, 0x22,
+    0x05, 0x8D, 0x51, 0x42, 0x45, 0x11, 0x6F, 0xE2, 0x95, 0x1C, 0xD6, 0x9E, 0xCB, 0x39, 0xE3, 0xF7,
+    0xF2, 0xA1, 0xB5, 0x34, 0xF7, 0x3D, 0x8F, 0x67, 0xEE, 0x9C, 0x7B, 0xEE, 0xB9, 0x77, 0xD4, 0x1C,
+    0xCF, 0xD3, 0x48, 0xF0, 0x0C, 0xEA, 0x95, 0xE7, 0x5D, 0x7E, 0x54, 0x06, 0x1F, 0x47, 0x6F, 0x07,
+    0x55, 0x4C, 0x0B, 0xA3, 0x91, 0x9F, 0x23, 0xBF, 0x25, 0xF1, 0x56, 0xF7, 0xDE, 0x76, 0xB4, 0x59,
+    0x4B, 0x6B, 0xBC, 0x2D, 0x6A, 0x5A, 0x5B, 0xD1, 0x0A, 0x6D, 0x20, 0x25, 0xB7, 0x4A, 0xEE, 0x2D,
+    0xA7, 0x63, 0x6F, 0x43, 0x78, 0x06, 0x0E, 0x17, 0xF1, 0x80, 0x90, 0x3E, 0x07, 0xA5, 0x45, 0x7A,
+    0x8C, 0x2E, 0x15, 0x69, 0x55, 0xD1, 0x02, 0x43, 0x85, 0x01, 0xA7, 0x0E, 0x2E, 0xE1, 0x21, 0xB7,
+    0xF0, 0x55, 0x94, 0x93, 0x7F, 0x99, 0x46, 0x80, 0x11, 0xF1, 0xF7, 0x0B, 0x9C, 0x10, 0x03, 0x43,
+    0x82, 0xA1, 0xFF, 0xFE, 0x59, 0xA5, 0xF0, 0x91, 0x49, 0x8B, 0x73, 0xB6, 0xB4, 0x74, 0xB9, 0x96,
+    0x2F, 0x2B, 0xF8, 0x2D, 0xDF, 0x12, 0xC9, 0x33, 0xB9, 0x7C, 0x6A, 0xDC, 0xEA, 0x58, 0x0C, 0x49,
+    0xFF, 0x63, 0x5F, 0x70, 0x4D, 0x15, 0x21, 0xE6, 0x48, 0x6A, 0x15, 0x3E, 0x59, 0xB2, 0x91, 0x30,
+    0x14, 0x5D, 0x2D, 0x4D, 0x56, 0x33, 0x00, 0x00, 0x85, 0x17, 0x45, 0x7A, 0x00, 0xC3, 0xC1, 0xC8,
+    0x58, 0xA8, 0xD0, 0x0D, 0x05, 0xE8, 0xA1, 0x79, 0xD1, 0xEF, 0xA9, 0xF8, 0xBC, 0x1B, 0x55, 0x72,
+    0xD2, 0x22, 0xA2, 0xA3, 0xE7, 0x30, 0x7F, 0x9E, 0xF7, 0x2A, 0x3D, 0x38, 0xE9, 0x54, 0x76, 0x78,
+    0x8C, 0xA8, 0x0E, 0x0F, 0x60, 0x7E, 0x38, 0x6C, 0x54, 0x80, 0x90, 0xAE, 0xD9, 0x2F, 0xA4, 0x51,
+    0x0B, 0xC7, 0x64, 0x02, 0x61, 0xC4, 0x5D, 0x30, 0x7A, 0xDA, 0x0D, 0x62, 0x16, 0xA5, 0x1B, 0x46,
+    0x4F, 0xCE, 0xCD, 0x3F, 0xCF, 0x3C, 0x5B, 0xE2, 0xC0, 0x26, 0x1E, 0xB0, 0x40, 0xCB, 0x74, 0x81,
+    0xAA, 0x4C, 0xE4, 0x74, 0x99, 0x96, 0xAB, 0x79, 0xA4, 0x01, 0xF3, 0x3E, 0x25, 0xDE, 0x90, 0x5F,
+    0x2E, 0x9A, 0xF2, 0xE8, 0x3C, 0x82, 0x10, 0x68, 0x02, 0x4E, 0x30, 0xDD, 0x7B, 0x5C, 0x43, 0x40,
+    0xF9, 0xBD, 0xC6, 0xAC, 0xDB, 0x3E, 0x3D, 0x13, 0x87, 0x23, 0x4F, 0xB5, 0xB8, 0x3C, 0x91, 0x2D,
+    0xB8, 0x01, 0x9C, 0x84, 0x1B, 0x2D, 0xA1, 0x72, 0xCB, 0x77, 0xCC, 0xEE, 0x2D, 0x45, 0x05, 0x0C,
+    0xC9, 0x67, 0x6D, 0x24, 0xAE, 0x8E, 0xA0, 0xEB, 0x58, 0x1C, 0x52, 0x9F, 0x6D, 0x0E, 0xC5, 0x46,
+    0x67, 0x3E, 0xAE, 0x8C, 0xAA, 0x7D, 0xE2, 0xFC, 0x89, 0xBA, 0xF6, 0x4A, 0x00, 0xCB, 0x00, 0x19,
+    0x11, 0x8B, 0xB9, 0x72, 0xF6, 0x1E, 0xA7, 0xCB, 0x05, 0x3C, 0xBF, 0x23, 0x2B, 0xE3, 0x53, 0xBC,
+    0x15, 0xEE, 0x61, 0x0B, 0x1E, 0x6C, 0x75, 0x87, 0xCA, 0x55, 0xDF, 0x90, 0xBB, 0x7B, 0x8C, 0x92,
+    0x31, 0xA6, 0xF0, 0x96, 0x90, 0x53, 0x0A, 0x31, 0x26, 0x9E, 0xF7, 0x17, 0xFE, 0xDE, 0xA6, 0x24,
+    0x3B, 0xEF, 0x06, 0x48, 0x87, 0x65, 0xA2, 0xE9, 0x3D, 0xC1, 0xBA, 0x1C, 0xD1, 0xCF, 0xA2, 0xEE,
+    0x7E, 0x3C, 0x66, 0x1B, 0x43, 0x7A, 0x39, 0x48, 0x69, 0xBC, 0x2E, 0xA9, 0x01, 0x92, 0x1A, 0x42,
+    0x2D, 0x48, 0x11, 0x56, 0xBF, 0xBE, 0x70, 0x78, 0x07, 0xE3, 0x2B, 0x78, 0x81, 0x3B, 0x4C, 0x67,
+    0x78, 0xDB, 0x55, 0x6A, 0x6D, 0x8A, 0x61, 0x08, 0xEC, 0x56, 0x5A, 0x46, 0xCF, 0xAD, 0xB8, 0x4F,
+    0xC1, 0x80, 0xBC, 0x84, 0x2F, 0x2D, 0x97, 0xC0, 0xD9, 0x9B, 0x4B, 0x62, 0x18, 0xD3, 0xD6, 0x57,
+    0x97, 0x67, 0x32, 0x6B, 0x14, 0x2B, 0x06, 0x90, 0x19, 0xFE, 0x6F, 0x4A, 0xBD, 0x89, 0x9F, 0x07,
+    0xB7, 0xA9, 0x05, 0xD6, 0xAC, 0x42, 0xFE, 0x2B, 0xD4, 0x46, 0x09, 0x5E, 0xD7, 0xDD, 0x9A, 0xFD,
+    0xEC, 0x8F, 0x76, 0xF7, 0xAE, 0xAE, 0x72, 0x35, 0xC3, 0x02, 0x60, 0x48, 0xB0, 0x68, 0xF1, 0x37,
+    0xAE, 0x27, 0x64, 0x66, 0x82, 0xC5, 0xA9, 0xA8, 0x51, 0x1F, 0xEA, 0xAA, 0x76, 0x99, 0xAE, 0xED,
+    0x9E, 0x20, 0x32, 0x96, 0x5C, 0xAE, 0xD2, 0x6E, 0x5A, 0xB9, 0xC2, 0x90, 0xB6, 0xD4, 0x3B, 0xD2,
+    0x53, 0x64, 0x90, 0xD8, 0xB6, 0xAF, 0x44, 0x54, 0x13, 0x0A, 0x01, 0xC7, 0xBA, 0xCC, 0x41, 0x99,
+    0xB6, 0xD7, 0x4D, 0x2C, 0xFB, 0x50, 0x78, 0x83, 0x38, 0x76, 0xC2, 0x6D, 0x52, 0xED, 0x72, 0x0A,
+    0xB9, 0x51, 0x8F, 0x49, 0x16, 0x4B, 0xD8, 0x4A, 0x05, 0x07, 0xC8, 0xD2, 0x51, 0x9F, 0x48, 0xEE,
+    0x52, 0xEC, 0xDC, 0x80, 0x84, 0x9B, 0x07, 0x2A, 0xEC, 0x42, 0x35, 0xF1, 0x55, 0x91, 0xFB, 0x27,
+    0x49, 0xAB, 0x2B, 0xB3, 0xDA, 0x87, 0x43, 0x96, 0xEB, 0xA3, 0x56, 0x59, 0xA3, 0xA2, 0x97, 0x0D,
+    0xE8, 0x09, 0xA0, 0x5B, 0x23, 0x03, 0xA0, 0x94, 0x56, 0xBA, 0xE0, 0x31, 0x53, 0xFA, 0x39, 0xC6,
+    0x6B, 0xC8, 0x04, 0x98, 0x33, 0xAB, 0x3B, 0x49, 0x6B, 0xD4, 0x18, 0xB6, 0x69, 0x95, 0x7E, 0xD2,
+    0xAB, 0xBE, 0x50, 0x1A, 0x25, 0xB6, 0x37, 0x80, 0x21, 0xB0, 0xD8, 0xAE, 0x10, 0x72, 0x26, 0x23,
+    0x50, 0x34, 0xDA, 0x6D, 0xFB, 0xAD, 0xFE, 0x21, 0xEB, 0x3E, 0xF9, 0xBE, 0x09, 0x79, 0x3D, 0xB0,
+    0x85, 0x28, 0xFD, 0xDF, 0x7C, 0xBE, 0xC3, 0x92, 0x69, 0x59, 0x3D, 0x1D, 0x45, 0xAC, 0x0A, 0xCC,
+    0xFD, 0xC4, 0xBA, 0x1B, 0x42, 0xDF, 0x24, 0x6D, 0xBD, 0xAC, 0x33, 0xBF, 0x25, 0xAC, 0xAF, 0xD3,
+    0x43, 0xF2, 0xD4, 0x2F, 0x9C, 0x30, 0x14, 0x42, 0x7A, 0x01, 0xEF, 0xB1, 0x33, 0x0D, 0x64, 0x73,
+    0x0C, 0x8E, 0xED, 0x60, 0xD1, 0x63, 0xCF, 0x36, 0xCF, 0xDA, 0xF4, 0x45, 0x37, 0xC8, 0xFE, 0x98,
+    0xA5, 0x1B, 0x83, 0x89, 0xCE, 0xBB, 0xFB, 0xAA, 0x9C, 0x19, 0xB4, 0x85, 0xF8, 0x88, 0x52, 0xDD,
+    0xA5, 0x7A, 0xF4, 0x01, 0x65, 0xD9, 0xFB, 0xAA, 0x78, 0x04, 0x18, 0xE1, 0x39, 0x41, 0x1A, 0x26,
+    0x32, 0x3A, 0x6A, 0x27, 0x31, 0xF8, 0xF2, 0x6D, 0x96, 0xA1, 0x28, 0xEB, 0xAB, 0x7A, 0xF1, 0xFE,
+    0xF5, 0x7C, 0x6E, 0x4B, 0x1F, 0x89, 0x9E, 0xDA, 0x01, 0x36, 0xFF, 0x8E, 0x56, 0x6F, 0x1B, 0xBE,
+    0xD6, 0xE6, 0x66, 0x5B, 0xF0, 0x9D, 0x9B, 0xB5, 0xA7, 0xA2, 0x6A, 0x19, 0xCA, 0x1A, 0xEB, 0x3A,
+    0x3A, 0x69, 0x97, 0x87, 0x4E, 0xE7, 0x7B, 0x28, 0x13, 0xAA, 0x09, 0x20, 0xB1, 0xDE, 0x05, 0xEC,
+    0x95, 0xA8, 0x99, 0x99, 0xB0, 0x29, 0xF6, 0xCF, 0xBB, 0x62, 0x5D, 0x1E, 0xA5, 0x9B, 0x5D, 0xEC,
+    0x3A, 0xF4, 0x25, 0x2D, 0x9B, 0x38, 0x22, 0x1B, 0xD8, 0x2E, 0xEC, 0x31, 0x54, 0x1E, 0x38, 0xF6,
+    0xB5, 0xE8, 0x82, 0x30, 0xF5, 0x07, 0x37, 0xB5, 0x9D, 0x2B, 0x0D, 0xFB, 0x91, 0x0F, 0x06, 0xCC,
+    0x52, 0x19, 0xD6, 0xA7, 0x06, 0x1D, 0x81, 0xA1, 0x65, 0x15, 0xB3, 0x33, 0x1F, 0x99, 0x85, 0x45,
+    0x82, 0x44, 0x0E, 0xD8, 0x2D, 0xE2, 0x81, 0x39, 0x9A, 0x4B, 0xE9, 0xA7, 0x6A, 0xBF, 0xA0, 0x55,
+    0xC9, 0xA8, 0xF4, 0xC0, 0x4C, 0x85, 0xE2, 0xC9, 0x61, 0x80, 0x48, 0x56, 0x7B, 0xBB, 0x4F, 0x19,
+    0x56, 0x08, 0xAF, 0x00, 0xF6, 0x4F, 0x5B, 0x48, 0x9D, 0x5E, 0xFC, 0x0B, 0xB5, 0xCE, 0xDE, 0x08,
+    0x05, 0x18, 0x8D, 0xA0, 0x90, 0xBE, 0x25, 0xD8, 0x0C, 0x7F, 0xC2, 0x57, 0xFE, 0xFC, 0xBA, 0x58,
+    0xE3, 0x17, 0xC7, 0x32, 0x4B, 0x91, 0x73, 0xDE, 0xA0, 0xD6, 0xA3, 0x38, 0x55, 0xBE, 0x67, 0x1A,
+    0x12, 0xD5, 0x5C, 0x07, 0xEA, 0xEF, 0x98, 0xD4, 0xB7, 0xB9, 0xE1, 0x2A, 0x79, 0x5E, 0x8C, 0xFD,
+    0x24, 0xC6, 0xD0, 0x3E, 0xE4, 0x35, 0xF6, 0x57, 0x83, 0x0A, 0x92, 0x2A, 0x94, 0xEF, 0x71, 0x53,
+    0x21, 0xEC, 0x3C, 0xE9, 0x02, 0x5C, 0x08, 0x6D, 0x00, 0x5A, 0x1B, 0x08, 0x37, 0x6D, 0x13, 0x14,
+    0xA0, 0x03, 0xB5, 0x6C, 0xB0, 0x38, 0x0B, 0x12, 0xE3, 0x8D, 0x86, 0x60, 0x9B, 0x9B, 0xC4, 0xFE,
+    0x0F, 0x65, 0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0x6B, 0x13, 0x59, 0xC2, 0x85, 0xAB, 0x48,
+    0x11, 0x29, 0xDC, 0x23, 0x21, 0x7F, 0x82, 0x2D, 0xF1, 0x0D, 0xD0, 0xD0, 0x52, 0x10, 0x28, 0xD2,
+    0xD3, 0x9C, 0x03, 0x3F, 0x90, 0x82, 0x0F, 0xA0, 0x80, 0x22, 0x0D, 0x69, 0x29, 0x10, 0xEB, 0x4F,
+    0x70, 0x81, 0x44, 0x89, 0x0B, 0x1A, 0xA0, 0x59, 0xA4, 0x93, 0xB0, 0xD0, 0xDA, 0xC3, 0x9B, 0xD9,
+    0x5C, 0x72, 0x11, 0x27, 0xDD, 0xAC, 0xBD, 0xB3, 0x33, 0xEF, 0xCD, 0x9B, 0x59, 0x03, 0x37, 0xBF,
+    0xBB, 0xFC, 0x3B, 0x3F, 0x7B, 0x2E, 0x1B, 0x91, 0x19, 0x28, 0x45, 0xA4, 0x07, 0xE4, 0xAF, 0x5F,
+    0x80, 0x6A, 0x85, 0x44, 0xC0, 0x4F, 0x95, 0x04, 0x14, 0x2B, 0xBC, 0x1F, 0xD1, 0x86, 0x72, 0x96,
+    0xCE, 0x49, 0xE7, 0x5F, 0x2F, 0x28, 0x63, 0x39, 0x57, 0x5B, 0xB4, 0x93, 0xEF, 0x37, 0x83, 0x93,
+    0x32, 0x3A, 0xE1, 0x9E, 0x1F, 0xAA, 0x19, 0xCD, 0x9F, 0x88, 0x76, 0x84, 0xC8, 0x90, 0x0B, 0x72,
+    0xA6, 0x69, 0x66, 0x54, 0xF2, 0xE5, 0x89, 0x30, 0x05, 0x31, 0x84, 0x18, 0xFC, 0x6D, 0x51, 0x88,
+    0x21, 0x7A, 0x51, 0x78, 0x45, 0x97, 0x0E, 0xCD, 0x99, 0x97, 0x73, 0xE0, 0xE8, 0x9A, 0xE6, 0x61,
+    0x47, 0x23, 0x03, 0x90, 0xA9, 0x29, 0x98, 0x83, 0xB9, 0x26, 0x30, 0x53, 0x20, 0xBD, 0x6F, 0x01,
+    0x4E, 0xAA, 0x80, 0x7C, 0x21, 0x97, 0x2A, 0x2A, 0x78, 0xA8, 0x22, 0x36, 0x23, 0x8D, 0xF4, 0x65,
+    0x24, 0x81, 0x72, 0x29, 0x17, 0x56, 0x50, 0xCF, 0x0C, 0x36, 0x78, 0x56, 0x2B, 0xAB, 0x82, 0x2E,
+    0xFA, 0x16, 0x0D, 0xA5, 0xE2, 0x53, 0x50, 0xC7, 0x2B, 0xDD, 0x87, 0x07, 0x89, 0xC7, 0x9C, 0xB4,
+    0xA7, 0x66, 0xC4, 0xA6, 0x13, 0x64, 0x31, 0x8F, 0xA8, 0x42, 0x3D, 0xA1, 0xED, 0x3D, 0xDC, 0x62,
+    0x6F, 0x15, 0xDF, 0x86, 0x4D, 0xE7, 0xD6, 0x2C, 0xA2, 0xDC, 0x92, 0x46, 0x3B, 0xB4, 0x3D, 0x56,
+    0x47, 0xBC, 0x6D, 0x19, 0x70, 0xAF, 0xBF, 0xDF, 0xEB, 0x16, 0xAB, 0x1A, 0xDA, 0x01, 0xF5, 0x48,
+    0x53, 0x4D, 0xF5, 0x98, 0x22, 0xCB, 0xC0, 0x80, 0x62, 0xE6, 0xB9, 0x3C, 0x16, 0xDB, 0x04, 0x97,
+    0x69, 0x5E, 0x68, 0x3A, 0x08, 0xB3, 0x18, 0x0F, 0x83, 0x57, 0xD4, 0x4E, 0xC1, 0xFA, 0x5C, 0x39,
+    0x67, 0xCA, 0xD2, 0x69, 0x1D, 0xC6, 0x3E, 0x57, 0xCE, 0x64, 0x3F, 0x94, 0x5A, 0xCF, 0x86, 0x3A,
+    0xE5, 0xEA, 0x60, 0x7E, 0xA6, 0xD0, 0x37, 0xA6, 0x42, 0x43, 0xD1, 0x60, 0xDB, 0x94, 0x90, 0x80,
+    0xB6, 0x9B, 0x31, 0xB5, 0x53, 0x61, 0xA9, 0xCC, 0x98, 0x6B, 0x34, 0x85, 0x19, 0x2A, 0x9B, 0x87,
+    0xC3, 0xE7, 0x3D, 0xF3, 0x36, 0x22, 0x5F, 0xE5, 0xE7, 0x05, 0x54, 0x7B, 0xF6, 0x47, 0xB1, 0x7A,
+    0x8D, 0x5B, 0x69, 0xB1, 0x18, 0x7C, 0x22, 0xB1, 0x31, 0xDB, 0xEA, 0x36, 0xEB, 0x35, 0x51, 0x27,
+    0xEC, 0x58, 0xB0, 0x50, 0x23, 0x6A, 0x6A, 0x67, 0x29, 0x40, 0xF4, 0x11, 0x96, 0x2D, 0x28, 0x67,
+    0xCE, 0x98, 0x06, 0x34, 0xDA, 0x58, 0x82, 0x59, 0x40, 0x6A, 0x4F, 0x6B, 0x01, 0xA5, 0xEC, 0x4D,
+    0x2F, 0xDC, 0x53, 0x9C, 0x10, 0x74, 0xAD, 0x57, 0x36, 0x6F, 0xA5, 0x10, 0xDA, 0xD1, 0x58, 0x2C,
+    0x85, 0x3C, 0x0C, 0xCD, 0x90, 0x4F, 0xE5, 0xC0, 0x0E, 0xA1, 0x29, 0x02, 0x3E, 0x22, 0x36, 0xC3,
+    0xF1, 0xB6, 0x1E, 0xF5, 0x84, 0xA8, 0x6A, 0x32, 0xE7, 0x36, 0x7A, 0xB9, 0x04, 0xC2, 0xB8, 0x13,
+    0x7C, 0xEE, 0x52, 0xD2, 0x0F, 0xB6, 0x7A, 0x03, 0x6D, 0x94, 0x19, 0xCA, 0xF9, 0x68, 0xC7, 0x75,
+    0x57, 0x56, 0x2A, 0x82, 0x6D, 0xB9, 0xA9, 0xCE, 0x2D, 0xFB, 0x7E, 0x63, 0x0E, 0x8F, 0xFF, 0xFC,
+    0xED, 0x2D, 0xFF, 0x5E, 0x7C, 0x66, 0xFE, 0x73, 0xED, 0x95, 0xD3, 0x9B, 0x61, 0xFD, 0xD0, 0x7D,
+    0xD1, 0xDE, 0xB0, 0x40, 0xDD, 0xC2, 0xF1, 0xBC, 0x2F, 0x40, 0x33, 0xB1, 0xC9, 0x1C, 0x74, 0xCE,
+    0xC1, 0xD0, 0xC6, 0x7D, 0x0F, 0x27, 0xA0, 0x9A, 0x9D, 0xF4, 0xED, 0xB6, 0x10, 0x98, 0x9A, 0x4A,
+    0x41, 0xBA, 0x67, 0xF0, 0x4B, 0x15, 0x9A, 0x5F, 0xBF, 0x39, 0x65, 0x2D, 0x83, 0xCE, 0xD4, 0xE7,
+    0xDE, 0xED, 0xBB, 0xCB, 0x50, 0xFF, 0xFA, 0xBD, 0x9A, 0xBB, 0xE9, 0xF7, 0xDD, 0x6F, 0xD5, 0xD6,
+    0xAA, 0x88, 0x33, 0xAC, 0xDA, 0x4A, 0x31, 0xDA, 0x3A, 0x4F, 0x1C, 0x82, 0x03, 0x68, 0x0B, 0x56,
+    0xBB, 0xC8, 0xB3, 0x75, 0x63, 0x72, 0xA9, 0xC8, 0xD4, 0xFB, 0x76, 0x78, 0x64, 0x17, 0x7F, 0xB1,
+    0xCB, 0x36, 0xDB, 0x37, 0x60, 0x4A, 0x53, 0xE9, 0xAC, 0xBF, 0x75, 0xB8, 0x56, 0x3A, 0xA9, 0xE2,
+    0x6F, 0x15, 0x85, 0x07, 0x37, 0xB3, 0xD3, 0x24, 0x71, 0x56, 0xFB, 0x76, 0x4D, 0x3A, 0x2D, 0x2B,
+    0xAE, 0x3E, 0x09, 0xB4, 0x9D, 0xD9, 0xF3, 0xA4, 0x22, 0x97, 0x63, 0xD9, 0x2D, 0xD1, 0x62, 0x2D,
+    0xC5, 0x69, 0x6A, 0xE9, 0x29, 0x11, 0xDF, 0xC3, 0x19, 0xB3, 0x1F, 0xDD, 0x15, 0xA9, 0x83, 0x17,
+    0xA9, 0x09, 0x78, 0xFC, 0x09, 0x48, 0xA3, 0x91, 0xA4, 0xB7, 0x91, 0x70, 0x69, 0x34, 0xBD, 0xBD,
+    0xA4, 0xD6, 0x38, 0xBB, 0x1A, 0x4C, 0xBD, 0xB5, 0xDB, 0x18, 0x77, 0xA7, 0x9C, 0xD7, 0x9D, 0x53,
+    0x2D, 0xB7, 0xB1, 0xCB, 0xEA, 0x65, 0xED, 0x14, 0x4B, 0xC9, 0x89, 0x95, 0xFE, 0x1D, 0xB8, 0xC3,
+    0xF5, 0xE0, 0x72, 0x81, 0xBB, 0xD4, 0x33, 0x95, 0x5D, 0x6B, 0x1E, 0xBF, 0xE8, 0xF0, 0xF2, 0x8D,
+    0x22, 0xFD, 0x03,
+};
+
+static const uint32_t opendyslexic_12_bolditalicBlockOffsets[39] = {
+    0, 1034, 2115, 3122, 4165, 5325, 6333, 7050,
+    7790, 8583, 9467, 10355, 11180, 11952, 12930, 13805,
+    14673, 15599, 16463, 17121, 17947, 19073, 20056, 21144,
+    22220, 23436, 24520, 25620, 26700, 27804, 28854, 29782,
+    30720, 31700, 32696, 33765, 34866, 36017, 36771,
+};
+
+static const uint16_t opendyslexic_12_bolditalicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_12_bolditalicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_12_bolditalicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
@@ -4730,709 +2470,709 @@ static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 18, 20, 19, 1, 19, 90, 1782 }, // 3
     { 16, 20, 20, 2, 19, 80, 1872 }, // 4
     { 17, 21, 19, 1, 20, 90, 1952 }, // 5
-    { 18, 20, 20, 1, 19, 90, 2042 }, // 6
-    { 15, 20, 19, 5, 20, 75, 2132 }, // 7
-    { 18, 20, 20, 1, 19, 90, 2207 }, // 8
-    { 19, 21, 20, 1, 19, 100, 2297 }, // 9
-    { 11, 17, 7, 0, 17, 47, 2397 }, // :
-    { 12, 21, 9, -1, 16, 63, 2444 }, // ;
-    { 21, 17, 19, -2, 17, 90, 2507 }, // <
-    { 16, 10, 15, 1, 12, 40, 2597 }, // =
-    { 21, 17, 20, 1, 17, 90, 2637 }, // >
-    { 18, 31, 17, 4, 28, 140, 2727 }, // ?
-    { 26, 24, 26, 1, 22, 156, 2867 }, // @
-    { 22, 21, 28, 1, 21, 116, 3023 }, // A
-    { 21, 21, 23, 1, 21, 111, 3139 }, // B
-    { 22, 23, 24, 2, 23, 127, 3250 }, // C
-    { 24, 21, 26, 1, 21, 126, 3377 }, // D
-    { 22, 21, 22, 1, 21, 116, 3503 }, // E
-    { 20, 22, 21, 1, 22, 110, 3619 }, // F
-    { 23, 22, 28, 2, 21, 127, 3729 }, // G
-    { 24, 21, 26, 1, 21, 126, 3856 }, // H
-    { 12, 23, 13, 1, 22, 69, 3982 }, // I
-    { 23, 27, 22, 0, 21, 156, 4051 }, // J
-    { 23, 21, 26, 1, 21, 121, 4207 }, // K
-    { 17, 21, 22, 1, 21, 90, 4328 }, // L
-    { 27, 21, 29, 1, 21, 142, 4418 }, // M
-    { 25, 21, 25, 1, 21, 132, 4560 }, // N
-    { 25, 24, 28, 2, 22, 150, 4692 }, // O
-    { 21, 22, 22, 1, 22, 116, 4842 }, // P
-    { 25, 27, 29, 2, 22, 169, 4958 }, // Q
-    { 20, 22, 24, 1, 21, 110, 5127 }, // R
-    { 21, 22, 26, 2, 21, 116, 5237 }, // S
-    { 20, 22, 26, 6, 22, 110, 5353 }, // T
-    { 24, 23, 25, 2, 21, 138, 5463 }, // U
-    { 21, 21, 28, 7, 21, 111, 5601 }, // V
-    { 30, 22, 35, 6, 22, 165, 5712 }, // W
-    { 26, 21, 27, 1, 21, 137, 5877 }, // X
-    { 20, 21, 26, 7, 21, 105, 6014 }, // Y
-    { 26, 21, 27, 1, 21, 137, 6119 }, // Z
-    { 20, 36, 12, -2, 27, 180, 6256 }, // [
-    { 6, 29, 12, 5, 22, 44, 6436 }, // <backslash>
-    { 19, 36, 12, -6, 27, 171, 6480 }, // ]
-    { 15, 7, 14, 3, 24, 27, 6651 }, // ^
-    { 19, 5, 17, -2, -1, 24, 6678 }, // _
-    { 10, 6, 11, 5, 20, 15, 6702 }, // `
-    { 16, 17, 21, 2, 16, 68, 6717 }, // a
-    { 16, 23, 22, 3, 22, 92, 6785 }, // b
-    { 14, 16, 20, 2, 16, 56, 6877 }, // c
-    { 21, 22, 22, 2, 21, 116, 6933 }, // d
-    { 17, 16, 21, 2, 15, 68, 7049 }, // e
-    { 14, 22, 17, 3, 22, 77, 7117 }, // f
-    { 20, 23, 21, 0, 15, 115, 7194 }, // g
-    { 18, 22, 22, 1, 21, 99, 7309 }, // h
-    { 12, 25, 11, 1, 24, 75, 7408 }, // i
-    { 16, 29, 16, 2, 22, 116, 7483 }, // j
-    { 16, 21, 22, 1, 21, 84, 7599 }, // k
-    { 12, 22, 15, 1, 22, 66, 7683 }, // l
-    { 27, 16, 31, 1, 16, 108, 7749 }, // m
-    { 18, 16, 22, 1, 16, 72, 7857 }, // n
-    { 17, 16, 21, 2, 15, 68, 7929 }, // o
-    { 22, 23, 23, -1, 15, 127, 7997 }, // p
-    { 18, 23, 24, 2, 16, 104, 8124 }, // q
-    { 15, 16, 18, 1, 15, 60, 8228 }, // r
-    { 16, 18, 21, 2, 16, 72, 8288 }, // s
-    { 13, 20, 20, 4, 20, 65, 8360 }, // t
-    { 16, 16, 21, 3, 15, 64, 8425 }, // u
-    { 18, 15, 24, 5, 15, 68, 8489 }, // v
-    { 21, 16, 28, 5, 15, 84, 8557 }, // w
-    { 21, 14, 24, 1, 14, 74, 8641 }, // x
-    { 21, 21, 23, 1, 14, 111, 8715 }, // y
-    { 19, 15, 22, 1, 15, 72, 8826 }, // z
-    { 17, 26, 18, 2, 20, 111, 8898 }, // {
-    { 11, 23, 10, 1, 18, 64, 9009 }, // |
-    { 16, 26, 17, -1, 20, 104, 9073 }, // }
-    { 11, 5, 12, 5, 19, 14, 9177 }, // ~
-    { 0, 0, 22, 0, 0, 0, 9191 }, //  
-    { 13, 32, 13, 3, 28, 104, 9191 }, // ¡
-    { 14, 24, 20, 2, 20, 84, 9295 }, // ¢
-    { 19, 23, 17, 1, 22, 110, 9379 }, // £
-    { 17, 15, 17, 2, 17, 64, 9489 }, // ¤
-    { 22, 22, 19, 2, 19, 121, 9553 }, // ¥
-    { 10, 22, 10, 1, 18, 55, 9674 }, // ¦
-    { 19, 22, 19, 1, 20, 105, 9729 }, // §
-    { 14, 6, 13, 4, 21, 21, 9834 }, // ¨
-    { 13, 11, 17, 7, 24, 36, 9855 }, // ©
-    { 10, 9, 16, 7, 19, 23, 9891 }, // ª
-    { 18, 14, 21, 2, 13, 63, 9914 }, // «
-    { 14, 9, 15, 2, 10, 32, 9977 }, // ¬
-    { 15, 3, 15, 2, 9, 12, 10009 }, // ­
-    { 13, 12, 17, 8, 28, 39, 10021 }, // ®
-    { 11, 4, 13, 5, 19, 11, 10060 }, // ¯
-    { 14, 11, 17, 5, 19, 39, 10071 }, // °
-    { 19, 18, 20, 0, 14, 86, 10110 }, // ±
-    { 9, 8, 8, 9, 20, 18, 10196 }, // ²
-    { 10, 10, 8, 8, 21, 25, 10214 }, // ³
-    { 8, 6, 7, 4, 19, 12, 10239 }, // ´
-    { 20, 19, 21, -1, 15, 95, 10251 }, // µ
-    { 19, 22, 19, 2, 18, 105, 10346 }, // ¶
-    { 7, 6, 7, 2, 12, 11, 10451 }, // ·
-    { 8, 8, 8, -1, 1, 16, 10462 }, // ¸
-    { 7, 9, 8, 9, 21, 16, 10478 }, // ¹
-    { 9, 8, 17, 8, 18, 18, 10494 }, // º
-    { 18, 14, 19, -4, 13, 63, 10512 }, // »
-    { 26, 23, 32, 2, 21, 150, 10575 }, // ¼
-    { 28, 23, 32, 2, 21, 161, 10725 }, // ½
-    { 26, 23, 32, 2, 21, 150, 10886 }, // ¾
-    { 19, 31, 17, -2, 18, 148, 11036 }, // ¿
-    { 22, 28, 28, 1, 28, 154, 11184 }, // À
-    { 23, 32, 28, 1, 32, 184, 11338 }, // Á
-    { 23, 29, 28, 1, 29, 167, 11522 }, // Â
-    { 23, 29, 28, 1, 29, 167, 11689 }, // Ã
-    { 25, 30, 28, 1, 30, 188, 11856 }, // Ä
-    { 22, 30, 28, 1, 30, 165, 12044 }, // Å
-    { 35, 22, 34, 1, 21, 193, 12209 }, // Æ
-    { 22, 30, 24, 2, 23, 165, 12402 }, // Ç
-    { 22, 29, 22, 1, 29, 160, 12567 }, // È
-    { 22, 33, 22, 1, 33, 182, 12727 }, // É
-    { 22, 30, 22, 1, 30, 165, 12909 }, // Ê
-    { 22, 31, 22, 1, 31, 171, 13074 }, // Ë
-    { 15, 32, 13, 1, 31, 120, 13245 }, // Ì
-    { 16, 36, 13, 1, 35, 144, 13365 }, // Í
-    { 16, 33, 13, 1, 32, 132, 13509 }, // Î
-    { 18, 33, 13, 1, 32, 149, 13641 }, // Ï
-    { 25, 21, 26, 0, 21, 132, 13790 }, // Ð
-    { 25, 29, 25, 1, 29, 182, 13922 }, // Ñ
-    { 25, 31, 28, 2, 29, 194, 14104 }, // Ò
-    { 25, 35, 28, 2, 33, 219, 14298 }, // Ó
-    { 25, 32, 28, 2, 30, 200, 14517 }, // Ô
-    { 25, 32, 28, 2, 30, 200, 14717 }, // Õ
-    { 25, 33, 28, 2, 31, 207, 14917 }, // Ö
-    { 16, 9, 15, 0, 11, 36, 15124 }, // ×
-    { 50, 46, 28, -10, 34, 575, 15160 }, // Ø
-    { 24, 32, 25, 2, 30, 192, 15735 }, // Ù
-    { 24, 36, 25, 2, 34, 216, 15927 }, // Ú
-    { 24, 33, 25, 2, 31, 198, 16143 }, // Û
-    { 24, 33, 25, 2, 31, 198, 16341 }, // Ü
-    { 20, 36, 26, 7, 36, 180, 16539 }, // Ý
-    { 16, 21, 14, 1, 20, 84, 16719 }, // Þ
-    { 18, 22, 17, 1, 20, 99, 16803 }, // ß
-    { 16, 24, 21, 2, 23, 96, 16902 }, // à
-    { 17, 28, 21, 2, 27, 119, 16998 }, // á
-    { 17, 25, 21, 2, 24, 107, 17117 }, // â
-    { 17, 23, 21, 2, 22, 98, 17224 }, // ã
-    { 19, 26, 21, 2, 25, 124, 17322 }, // ä
-    { 16, 26, 21, 2, 25, 104, 17446 }, // å
-    { 26, 17, 31, 2, 16, 111, 17550 }, // æ
-    { 14, 23, 20, 2, 16, 81, 17661 }, // ç
-    { 17, 26, 21, 2, 25, 111, 17742 }, // è
-    { 18, 31, 21, 2, 30, 140, 17853 }, // é
-    { 18, 27, 21, 2, 26, 122, 17993 }, // ê
-    { 20, 28, 21, 2, 27, 140, 18115 }, // ë
-    { 11, 23, 11, 1, 22, 64, 18255 }, // ì
-    { 13, 28, 11, 1, 27, 91, 18319 }, // í
-    { 14, 24, 11, -1, 23, 84, 18410 }, // î
-    { 13, 24, 11, 1, 23, 78, 18494 }, // ï
-    { 23, 22, 17, 0, 21, 127, 18572 }, // ð
-    { 20, 24, 22, 1, 24, 120, 18699 }, // ñ
-    { 17, 23, 21, 2, 22, 98, 18819 }, // ò
-    { 17, 27, 21, 2, 26, 115, 18917 }, // ó
-    { 17, 24, 21, 2, 23, 102, 19032 }, // ô
-    { 18, 24, 21, 2, 23, 108, 19134 }, // õ
-    { 19, 25, 21, 2, 24, 119, 19242 }, // ö
-    { 19, 18, 22, 4, 17, 86, 19361 }, // ÷
-    { 28, 44, 21, -3, 30, 308, 19447 }, // ø
-    { 16, 24, 21, 3, 23, 96, 19755 }, // ù
-    { 16, 28, 21, 3, 27, 112, 19851 }, // ú
-    { 16, 24, 21, 3, 23, 96, 19963 }, // û
-    { 18, 25, 21, 3, 24, 113, 20059 }, // ü
-    { 21, 36, 23, 1, 29, 189, 20172 }, // ý
-    { 17, 26, 14, 0, 21, 111, 20361 }, // þ
-    { 22, 33, 23, 1, 26, 182, 20472 }, // ÿ
-    { 25, 29, 28, 1, 29, 182, 20654 }, // Ā
-    { 19, 25, 21, 2, 24, 119, 20836 }, // ā
-    { 26, 30, 28, 1, 30, 195, 20955 }, // Ă
-    { 20, 25, 21, 2, 24, 125, 21150 }, // ă
-    { 22, 28, 28, 1, 21, 154, 21275 }, // Ą
-    { 16, 24, 21, 2, 16, 96, 21429 }, // ą
-    { 22, 31, 24, 2, 31, 171, 21525 }, // Ć
-    { 15, 21, 20, 2, 21, 79, 21696 }, // ć
-    { 24, 32, 24, 2, 32, 192, 21775 }, // Ĉ
-    { 18, 24, 20, 2, 24, 108, 21967 }, // ĉ
-    { 22, 31, 24, 2, 31, 171, 22075 }, // Ċ
-    { 16, 22, 20, 2, 22, 88, 22246 }, // ċ
-    { 25, 33, 24, 2, 33, 207, 22334 }, // Č
-    { 20, 24, 20, 2, 24, 120, 22541 }, // č
-    { 24, 31, 26, 1, 31, 186, 22661 }, // Ď
-    { 25, 22, 22, 2, 21, 138, 22847 }, // ď
-    { 25, 21, 26, 0, 21, 132, 22985 }, // Đ
-    { 24, 22, 22, 2, 21, 132, 23117 }, // đ
-    { 23, 30, 22, 1, 30, 173, 23249 }, // Ē
-    { 20, 28, 21, 2, 27, 140, 23422 }, // ē
-    { 23, 30, 22, 1, 30, 173, 23562 }, // Ĕ
-    { 21, 28, 21, 2, 27, 147, 23735 }, // ĕ
-    { 22, 31, 22, 1, 31, 171, 23882 }, // Ė
-    { 18, 28, 21, 2, 27, 126, 24053 }, // ė
-    { 22, 28, 22, 1, 21, 154, 24179 }, // Ę
-    { 17, 25, 21, 2, 15, 107, 24333 }, // ę
-    { 24, 33, 22, 1, 33, 198, 24440 }, // Ě
-    { 21, 30, 21, 2, 29, 158, 24638 }, // ě
-    { 26, 34, 28, 2, 33, 221, 24796 }, // Ĝ
-    { 23, 34, 21, 0, 26, 196, 25017 }, // ĝ
-    { 27, 33, 28, 2, 32, 223, 25213 }, // Ğ
-    { 23, 32, 21, 0, 24, 184, 25436 }, // ğ
-    { 23, 33, 28, 2, 32, 190, 25620 }, // Ġ
-    { 20, 33, 21, 0, 25, 165, 25810 }, // ġ
-    { 24, 38, 28, 2, 37, 228, 25975 }, // Ģ
-    { 21, 34, 21, 0, 26, 179, 26203 }, // ģ
-    { 24, 31, 26, 1, 31, 186, 26382 }, // Ĥ
-    { 18, 31, 22, 1, 30, 140, 26568 }, // ĥ
-    { 25, 21, 26, 1, 21, 132, 26708 }, // Ħ
-    { 18, 22, 22, 1, 21, 99, 26840 }, // ħ
-    { 17, 34, 13, 1, 33, 145, 26939 }, // Ĩ
-    { 13, 25, 11, 1, 24, 82, 27084 }, // ĩ
-    { 18, 33, 13, 1, 32, 149, 27166 }, // Ī
-    { 14, 25, 11, 1, 24, 88, 27315 }, // ī
-    { 14, 29, 13, -1, 22, 102, 27403 }, // Į
-    { 15, 32, 11, -2, 24, 120, 27505 }, // į
-    { 16, 34, 13, 1, 33, 136, 27625 }, // İ
-    { 8, 16, 11, 1, 15, 32, 27761 }, // ı
-    { 25, 33, 40, 7, 22, 207, 27793 }, // Ĳ
-    { 24, 30, 11, 1, 23, 180, 28000 }, // ĳ
-    { 26, 37, 22, 0, 31, 241, 28180 }, // Ĵ
-    { 21, 32, 16, 2, 25, 168, 28421 }, // ĵ
-    { 23, 34, 26, 1, 34, 196, 28589 }, // Ķ
-    { 18, 34, 22, -1, 21, 153, 28785 }, // ķ
-    { 14, 14, 16, -2, 14, 49, 28938 }, // ĸ
-    { 17, 28, 22, 1, 28, 119, 28987 }, // Ĺ
-    { 16, 33, 15, 1, 33, 132, 29106 }, // ĺ
-    { 17, 34, 22, 1, 21, 145, 29238 }, // Ļ
-    { 15, 36, 15, -2, 22, 135, 29383 }, // ļ
-    { 19, 21, 22, 1, 21, 100, 29518 }, // Ľ
-    { 19, 26, 15, 1, 26, 124, 29618 }, // ľ
-    { 19, 21, 22, 1, 21, 100, 29742 }, // Ŀ
-    { 16, 22, 15, 1, 22, 88, 29842 }, // ŀ
-    { 38, 35, 22, -12, 28, 333, 29930 }, // Ł
-    { 27, 22, 15, -9, 22, 149, 30263 }, // ł
-    { 25, 30, 25, 1, 30, 188, 30412 }, // Ń
-    { 19, 25, 22, 1, 25, 119, 30600 }, // ń
-    { 25, 31, 25, 1, 21, 194, 30719 }, // Ņ
-    { 18, 26, 22, 1, 16, 117, 30913 }, // ņ
-    { 26, 32, 25, 1, 32, 208, 31030 }, // Ň
-    { 23, 27, 22, 1, 27, 156, 31238 }, // ň
-    { 33, 26, 22, -14, 26, 215, 31394 }, // ŉ
-    { 25, 27, 25, 1, 21, 169, 31609 }, // Ŋ
-    { 18, 21, 22, 1, 16, 95, 31778 }, // ŋ
-    { 25, 32, 28, 2, 30, 200, 31873 }, // Ō
-    { 19, 25, 21, 2, 24, 119, 32073 }, // ō
-    { 25, 33, 28, 2, 31, 207, 32192 }, // Ŏ
-    { 20, 25, 21, 2, 24, 125, 32399 }, // ŏ
-    { 28, 32, 28, 2, 30, 224, 32524 }, // Ő
-    { 23, 24, 21, 2, 23, 138, 32748 }, // ő
-    { 35, 24, 30, 2, 22, 210, 32886 }, // Œ
-    { 27, 16, 27, 2, 15, 108, 33096 }, // œ
-    { 20, 30, 24, 1, 29, 150, 33204 }, // Ŕ
-    { 15, 23, 18, 1, 22, 87, 33354 }, // ŕ
-    { 20, 35, 24, 1, 34, 175, 33441 }, // Ŗ
-    { 15, 28, 18, 1, 27, 105, 33616 }, // ŗ
-    { 23, 32, 24, 1, 31, 184, 33721 }, // Ř
-    { 18, 25, 18, 1, 24, 113, 33905 }, // ř
-    { 21, 30, 26, 2, 29, 158, 34018 }, // Ś
-    { 16, 24, 21, 2, 22, 96, 34176 }, // ś
-    { 23, 31, 26, 2, 30, 179, 34272 }, // Ŝ
-    { 19, 26, 21, 2, 24, 124, 34451 }, // ŝ
-    { 21, 28, 26, 2, 21, 147, 34575 }, // Ş
-    { 16, 24, 21, 2, 16, 96, 34722 }, // ş
-    { 24, 32, 26, 2, 31, 192, 34818 }, // Š
-    { 20, 26, 21, 2, 24, 130, 35010 }, // š
-    { 20, 29, 26, 6, 22, 145, 35140 }, // Ţ
-    { 14, 26, 20, 3, 20, 91, 35285 }, // ţ
-    { 20, 32, 26, 6, 32, 160, 35376 }, // Ť
-    { 20, 23, 20, 4, 23, 115, 35536 }, // ť
-    { 20, 22, 26, 6, 22, 110, 35651 }, // Ŧ
-    { 15, 20, 20, 2, 20, 75, 35761 }, // ŧ
-    { 24, 34, 25, 2, 32, 204, 35836 }, // Ũ
-    { 17, 25, 21, 3, 24, 107, 36040 }, // ũ
-    { 24, 33, 25, 2, 31, 198, 36147 }, // Ū
-    { 18, 25, 21, 3, 24, 113, 36345 }, // ū
-    { 24, 33, 25, 2, 31, 198, 36458 }, // Ŭ
-    { 19, 25, 21, 3, 24, 119, 36656 }, // ŭ
-    { 24, 35, 25, 2, 33, 210, 36775 }, // Ů
-    { 16, 27, 21, 3, 26, 108, 36985 }, // ů
-    { 27, 32, 25, 2, 30, 216, 37093 }, // Ű
-    { 22, 24, 21, 3, 23, 132, 37309 }, // ű
-    { 24, 28, 25, 2, 21, 168, 37441 }, // Ų
-    { 16, 23, 21, 3, 15, 92, 37609 }, // ų
-    { 30, 31, 35, 6, 31, 233, 37701 }, // Ŵ
-    { 21, 26, 28, 5, 25, 137, 37934 }, // ŵ
-    { 20, 33, 26, 7, 33, 165, 38071 }, // Ŷ
-    { 21, 33, 23, 1, 26, 174, 38236 }, // ŷ
-    { 20, 33, 26, 7, 33, 165, 38410 }, // Ÿ
-    { 26, 28, 27, 1, 28, 182, 38575 }, // Ź
-    { 19, 24, 22, 1, 24, 114, 38757 }, // ź
-    { 26, 29, 27, 1, 29, 189, 38871 }, // Ż
-    { 19, 24, 22, 1, 24, 114, 39060 }, // ż
-    { 26, 31, 27, 1, 31, 202, 39174 }, // Ž
-    { 23, 26, 22, 1, 26, 150, 39376 }, // ž
-    { 15, 21, 15, 2, 21, 79, 39526 }, // ſ
-    { 10, 6, 0, 5, 20, 15, 39605 }, // ̀
-    { 8, 6, 0, 4, 19, 12, 39620 }, // ́
-    { 14, 7, 0, -1, 1, 25, 39632 }, // ̂
-    { 11, 5, 0, 5, 19, 14, 39657 }, // ̃
-    { 14, 4, 0, 5, 17, 14, 39671 }, // ̄
-    { 18, 4, 0, 6, 23, 18, 39685 }, // ̅
-    { 13, 6, 0, 5, 18, 20, 39703 }, // ̆
-    { 7, 6, 0, 5, 21, 11, 39723 }, // ̇
-    { 13, 5, 0, 3, 18, 17, 39734 }, // ̈
-    { 5, 6, 0, 9, 16, 8, 39751 }, // ̉
-    { 7, 7, 0, 5, 20, 13, 39759 }, // ̊
-    { 20, 6, 0, 5, 20, 30, 39772 }, // ̋
-    { 14, 7, 0, 5, 20, 25, 39802 }, // ̌
-    { 21, 6, 0, -9, 20, 32, 39827 }, // ̏
-    { 11, 9, 0, 3, 20, 25, 39859 }, // ̒
-    { 11, 9, 0, 3, 19, 25, 39884 }, // ̓
-    { 11, 9, 0, -6, 19, 25, 39909 }, // ̔
-    { 7, 7, 0, 0, 0, 13, 39934 }, // ̘
-    { 7, 7, 0, 1, 0, 13, 39947 }, // ̙
-    { 12, 8, 0, 6, 21, 24, 39960 }, // ̚
-    { 7, 8, 0, 3, 17, 14, 39984 }, // ̛
-    { 6, 8, 0, -1, 0, 12, 39998 }, // ̜
-    { 7, 7, 0, 2, 5, 13, 40010 }, // ̝
-    { 7, 7, 0, -1, 0, 13, 40023 }, // ̞
-    { 6, 6, 0, 0, -2, 9, 40036 }, // ̟
-    { 14, 4, 0, -1, -3, 14, 40045 }, // ̠
-    { 7, 6, 0, -3, 2, 11, 40059 }, // ̣
-    { 12, 5, 0, -2, -2, 15, 40070 }, // ̤
-    { 7, 7, 0, 5, 20, 13, 40085 }, // ̥
-    { 11, 9, 0, -1, 4, 25, 40098 }, // ̦
-    { 8, 8, 0, -1, 1, 16, 40123 }, // ̧
-    { 8, 9, 0, 0, 1, 18, 40139 }, // ̨
-    { 8, 9, 0, -2, 0, 18, 40157 }, // ̩
-    { 12, 6, 0, -1, 0, 18, 40175 }, // ̪
-    { 16, 8, 0, -1, 1, 32, 40193 }, // ̬
-    { 16, 8, 0, -1, 1, 32, 40225 }, // ̭
-    { 12, 6, 0, 6, 21, 18, 40257 }, // ̰
-    { 13, 4, 0, 6, 21, 13, 40275 }, // ̱
-    { 14, 4, 0, -2, -1, 14, 40288 }, // ̲
-    { 13, 6, 0, 6, 21, 20, 40302 }, // ̴
-    { 14, 3, 0, 2, 9, 11, 40322 }, // ̵
-    { 7, 9, 0, 1, 0, 16, 40333 }, // ̹
-    { 14, 8, 0, -4, 1, 28, 40349 }, // ̺
-    { 13, 8, 0, -2, 1, 26, 40377 }, // ̻
-    { 11, 7, 0, -1, 1, 20, 40403 }, // ̼
-    { 9, 6, 0, 5, 19, 14, 40423 }, // ̽
-    { 11, 5, 0, 5, 19, 14, 40437 }, // ͂
-    { 6, 7, 0, 10, 22, 11, 40451 }, // ̓
-    { 15, 19, 0, 4, 32, 72, 40462 }, // ̈́
-    { 12, 7, 0, 4, 21, 21, 40534 }, // ͆
-    { 16, 10, 0, -2, 0, 40, 40555 }, // ͇
-    { 13, 8, 0, -1, 1, 26, 40595 }, // ͈
-    { 10, 8, 0, -1, -1, 20, 40621 }, // ͉
-    { 18, 21, 0, 4, 27, 95, 40641 }, // ͊
-    { 26, 20, 0, 8, 30, 130, 40736 }, // ͋
-    { 18, 14, 0, 13, 14, 63, 40866 }, // ͌
-    { 13, 28, 0, 1, 9, 91, 40929 }, // ͍
-    { 5, 4, 0, 12, 3, 5, 41020 }, // ͎
-    { 22, 7, 0, 0, 1, 39, 41025 }, // ͜
-    { 22, 6, 0, 4, 20, 33, 41064 }, // ͡
-    { 27, 8, 0, -1, -1, 54, 41097 }, // ͢
-    { 22, 30, 22, 1, 30, 165, 41151 }, // Ѐ
-    { 22, 31, 22, 1, 31, 171, 41316 }, // Ё
-    { 23, 23, 17, 3, 22, 133, 41487 }, // Ђ
-    { 19, 29, 16, 1, 28, 138, 41620 }, // Ѓ
-    { 22, 22, 21, 1, 20, 121, 41758 }, // Є
-    { 21, 22, 26, 2, 21, 116, 41879 }, // Ѕ
-    { 12, 23, 13, 1, 22, 69, 41995 }, // І
-    { 17, 32, 13, 1, 31, 136, 42064 }, // Ї
-    { 23, 27, 22, 0, 21, 156, 42200 }, // Ј
-    { 27, 21, 29, 2, 19, 142, 42356 }, // Љ
-    { 26, 21, 15, -5, 20, 137, 42498 }, // Њ
-    { 20, 24, 26, 6, 23, 120, 42635 }, // Ћ
-    { 23, 28, 26, 1, 28, 161, 42755 }, // Ќ
-    { 23, 28, 24, 1, 28, 161, 42916 }, // Ѝ
-    { 21, 32, 20, 0, 29, 168, 43077 }, // Ў
-    { 21, 25, 20, 2, 19, 132, 43245 }, // Џ
-    { 22, 21, 28, 1, 21, 116, 43377 }, // А
-    { 18, 20, 16, 2, 19, 90, 43493 }, // Б
-    { 18, 19, 17, 1, 18, 86, 43583 }, // В
-    { 19, 20, 16, 1, 19, 95, 43669 }, // Г
-    { 22, 23, 21, 1, 19, 127, 43764 }, // Д
-    { 21, 21, 22, 1, 21, 111, 43891 }, // Е
-    { 35, 21, 37, 1, 21, 184, 44002 }, // Ж
-    { 16, 20, 16, 2, 18, 80, 44186 }, // З
-    { 23, 21, 24, 1, 21, 121, 44266 }, // И
-    { 23, 28, 24, 1, 28, 161, 44387 }, // Й
-    { 23, 21, 26, 1, 21, 121, 44548 }, // К
-    { 22, 21, 15, -1, 19, 116, 44669 }, // Л
-    { 24, 20, 21, 1, 19, 120, 44785 }, // М
-    { 24, 21, 26, 1, 21, 126, 44905 }, // Н
-    { 25, 24, 28, 2, 22, 150, 45031 }, // О
-    { 20, 21, 17, 1, 20, 105, 45181 }, // П
-    { 21, 22, 22, 1, 22, 116, 45286 }, // Р
-    { 22, 23, 24, 2, 23, 127, 45402 }, // С
-    { 20, 22, 26, 6, 22, 110, 45529 }, // Т
-    { 21, 22, 20, 0, 19, 116, 45639 }, // У
-    { 19, 19, 22, 5, 19, 91, 45755 }, // Ф
-    { 26, 21, 27, 1, 21, 137, 45846 }, // Х
-    { 19, 24, 18, 1, 19, 114, 45983 }, // Ц
-    { 16, 19, 17, 4, 19, 76, 46097 }, // Ч
-    { 23, 20, 20, 1, 19, 115, 46173 }, // Ш
-    { 23, 25, 23, 1, 20, 144, 46288 }, // Щ
-    { 17, 19, 16, -1, 18, 81, 46432 }, // Ъ
-    { 27, 23, 29, 1, 22, 156, 46513 }, // Ы
-    { 15, 20, 16, 1, 19, 75, 46669 }, // Ь
-    { 23, 22, 24, 1, 20, 127, 46744 }, // Э
-    { 24, 21, 23, 2, 20, 126, 46871 }, // Ю
-    { 21, 22, 22, 1, 21, 116, 46997 }, // Я
-    { 16, 17, 21, 2, 16, 68, 47113 }, // а
-    { 20, 23, 17, 2, 22, 115, 47181 }, // б
-    { 15, 15, 18, -1, 15, 57, 47296 }, // в
-    { 17, 16, 15, 1, 15, 68, 47353 }, // г
-    { 19, 19, 19, 1, 15, 91, 47421 }, // д
-    { 17, 16, 21, 2, 15, 68, 47512 }, // е
-    { 34, 18, 37, 1, 18, 153, 47580 }, // ж
-    { 12, 13, 11, -2, 13, 39, 47733 }, // з
-    { 18, 16, 17, 1, 15, 72, 47772 }, // и
-    { 18, 21, 16, 0, 21, 95, 47844 }, // й
-    { 17, 14, 20, -1, 14, 60, 47939 }, // к
-    { 15, 15, 10, -3, 13, 57, 47999 }, // л
-    { 19, 16, 21, -1, 16, 76, 48056 }, // м
-    { 20, 16, 21, -1, 16, 80, 48132 }, // н
-    { 17, 16, 21, 2, 15, 68, 48212 }, // о
-    { 18, 16, 17, 1, 15, 72, 48280 }, // п
-    { 22, 23, 23, -1, 15, 127, 48352 }, // р
-    { 14, 16, 20, 2, 16, 56, 48479 }, // с
-    { 16, 16, 17, 4, 15, 64, 48535 }, // т
-    { 21, 21, 23, 1, 14, 111, 48599 }, // у
-    { 22, 21, 22, 2, 15, 116, 48710 }, // ф
-    { 21, 16, 18, 0, 15, 84, 48826 }, // х
-    { 18, 19, 18, 1, 15, 86, 48910 }, // ц
-    { 11, 13, 11, 0, 13, 36, 48996 }, // ч
-    { 22, 16, 20, 1, 15, 88, 49032 }, // ш
-    { 22, 20, 22, 1, 15, 110, 49120 }, // щ
-    { 13, 15, 12, -3, 14, 49, 49230 }, // ъ
-    { 21, 17, 22, -2, 16, 90, 49279 }, // ы
-    { 11, 15, 12, -1, 14, 42, 49369 }, // ь
-    { 15, 15, 16, 2, 14, 57, 49411 }, // э
-    { 19, 17, 18, 0, 16, 81, 49468 }, // ю
-    { 14, 16, 21, 2, 16, 56, 49549 }, // я
-    { 18, 28, 21, 2, 27, 126, 49605 }, // ѐ
-    { 19, 27, 21, 2, 26, 129, 49731 }, // ё
-    { 18, 27, 22, 1, 21, 122, 49860 }, // ђ
-    { 17, 23, 15, 1, 22, 98, 49982 }, // ѓ
-    { 16, 16, 14, -2, 14, 64, 50080 }, // є
-    { 16, 18, 21, 2, 16, 72, 50144 }, // ѕ
-    { 12, 25, 11, 1, 24, 75, 50216 }, // і
-    { 13, 24, 11, 1, 23, 78, 50291 }, // ї
-    { 16, 29, 16, 2, 22, 116, 50369 }, // ј
-    { 18, 15, 20, -1, 13, 68, 50485 }, // љ
-    { 18, 15, 10, -6, 14, 68, 50553 }, // њ
-    { 18, 22, 22, 1, 21, 99, 50621 }, // ћ
-    { 18, 21, 20, -1, 21, 95, 50720 }, // ќ
-    { 18, 25, 17, 1, 24, 113, 50815 }, // ѝ
-    { 23, 33, 23, 1, 26, 190, 50928 }, // ў
-    { 16, 18, 15, -1, 13, 72, 51118 }, // џ
-    { 16, 21, 19, 4, 19, 84, 51190 }, // Ѣ
-    { 16, 21, 16, 3, 19, 84, 51274 }, // ѣ
-    { 27, 22, 22, -1, 20, 149, 51358 }, // Ѫ
-    { 19, 15, 15, -3, 13, 72, 51507 }, // ѫ
-    { 28, 27, 28, 2, 26, 189, 51579 }, // Ѳ
-    { 22, 22, 21, 2, 21, 121, 51768 }, // ѳ
-    { 25, 25, 28, 7, 25, 157, 51889 }, // Ѵ
-    { 18, 18, 22, 5, 18, 81, 52046 }, // ѵ
-    { 12, 9, 0, 7, 24, 27, 52127 }, // ҆
-    { 20, 23, 16, 1, 22, 115, 52154 }, // Ґ
-    { 18, 20, 15, 1, 19, 90, 52269 }, // ґ
-    { 19, 20, 16, 1, 19, 95, 52359 }, // Ғ
-    { 14, 14, 11, -2, 13, 49, 52454 }, // ғ
-    { 20, 23, 15, 0, 22, 115, 52503 }, // Ҕ
-    { 13, 15, 9, -3, 13, 49, 52618 }, // ҕ
-    { 35, 26, 38, 1, 21, 228, 52667 }, // Җ
-    { 25, 18, 25, -2, 15, 113, 52895 }, // җ
-    { 16, 23, 16, 2, 18, 92, 53008 }, // Ҙ
-    { 12, 19, 11, -2, 13, 57, 53100 }, // ҙ
-    { 23, 25, 18, 0, 21, 144, 53157 }, // Қ
-    { 15, 18, 13, -2, 15, 68, 53301 }, // қ
-    { 27, 20, 27, 1, 19, 135, 53369 }, // Ҝ
-    { 19, 14, 19, 0, 13, 67, 53504 }, // ҝ
-    { 23, 21, 26, 1, 21, 121, 53571 }, // Ҟ
-    { 16, 21, 22, 1, 21, 84, 53692 }, // ҟ
-    { 23, 21, 26, 1, 21, 121, 53776 }, // Ҡ
-    { 16, 15, 18, -2, 15, 60, 53897 }, // ҡ
-    { 24, 25, 19, -2, 21, 150, 53957 }, // Ң
-    { 17, 17, 13, -4, 15, 73, 54107 }, // ң
-    { 34, 21, 26, 1, 21, 179, 54180 }, // Ҥ
-    { 24, 15, 18, -2, 15, 90, 54359 }, // ҥ
-    { 30, 22, 32, 2, 21, 165, 54449 }, // Ҧ
-    { 24, 25, 32, 4, 17, 150, 54614 }, // ҧ
-    { 26, 21, 17, -3, 19, 137, 54764 }, // Ҩ
-    { 21, 18, 25, 1, 16, 95, 54901 }, // ҩ
-    { 22, 27, 24, 2, 23, 149, 54996 }, // Ҫ
-    { 14, 19, 20, 2, 16, 67, 55145 }, // ҫ
-    { 20, 24, 19, 3, 21, 120, 55212 }, // Ҭ
-    { 15, 17, 13, -1, 15, 64, 55332 }, // ҭ
-    { 20, 21, 26, 7, 21, 105, 55396 }, // Ү
-    { 16, 20, 19, 5, 14, 80, 55501 }, // ү
-    { 23, 21, 26, 4, 21, 121, 55581 }, // Ұ
-    { 20, 20, 19, 1, 14, 100, 55702 }, // ұ
-    { 26, 25, 20, 1, 21, 163, 55802 }, // Ҳ
-    { 18, 18, 20, 1, 15, 81, 55965 }, // ҳ
-    { 21, 24, 15, 0, 19, 126, 56046 }, // Ҵ
-    { 16, 18, 22, 3, 13, 72, 56172 }, // ҵ
-    { 17, 25, 17, 3, 19, 107, 56244 }, // Ҷ
-    { 12, 19, 12, 0, 14, 57, 56351 }, // ҷ
-    { 16, 19, 17, 4, 19, 76, 56408 }, // Ҹ
-    { 11, 13, 11, 0, 13, 36, 56484 }, // ҹ
-    { 17, 23, 17, 1, 21, 98, 56520 }, // Һ
-    { 18, 22, 22, 1, 21, 99, 56618 }, // һ
-    { 28, 20, 35, 5, 19, 140, 56717 }, // Ҽ
-    { 21, 14, 17, 1, 13, 74, 56857 }, // ҽ
-    { 29, 24, 22, 6, 19, 174, 56931 }, // Ҿ
-    { 21, 17, 16, 2, 13, 90, 57105 }, // ҿ
-    { 12, 23, 13, 1, 22, 69, 57195 }, // Ӏ
-    { 35, 34, 37, 1, 34, 298, 57264 }, // Ӂ
-    { 34, 29, 37, 1, 29, 247, 57562 }, // ӂ
-    { 20, 26, 18, 1, 19, 130, 57809 }, // Ӄ
-    { 14, 19, 12, -2, 13, 67, 57939 }, // ӄ
-    { 22, 25, 15, -1, 19, 138, 58006 }, // Ӆ
-    { 15, 17, 10, -1, 13, 64, 58144 }, // ӆ
-    { 24, 27, 26, 1, 21, 162, 58208 }, // Ӈ
-    { 17, 20, 18, -2, 15, 85, 58370 }, // ӈ
-    { 24, 29, 26, 1, 21, 174, 58455 }, // Ӊ
-    { 17, 21, 18, 0, 15, 90, 58629 }, // ӊ
-    { 17, 25, 17, 4, 19, 107, 58719 }, // Ӌ
-    { 11, 17, 15, 2, 13, 47, 58826 }, // ӌ
-    { 27, 30, 29, 1, 21, 203, 58873 }, // Ӎ
-    { 19, 21, 20, 0, 15, 100, 59076 }, // ӎ
-    { 10, 19, 15, 5, 18, 48, 59176 }, // ӏ
-    { 26, 29, 28, 1, 29, 189, 59224 }, // Ӑ
-    { 20, 25, 21, 2, 24, 125, 59413 }, // ӑ
-    { 24, 28, 28, 1, 28, 168, 59538 }, // Ӓ
-    { 20, 25, 21, 2, 24, 125, 59706 }, // ӓ
-    { 35, 22, 34, 1, 21, 193, 59831 }, // Ӕ
-    { 26, 17, 31, 2, 16, 111, 60024 }, // ӕ
-    { 24, 30, 22, 1, 30, 180, 60135 }, // Ӗ
-    { 21, 27, 21, 2, 26, 142, 60315 }, // ӗ
-    { 21, 21, 27, 8, 19, 111, 60457 }, // Ә
-    { 16, 17, 21, 8, 16, 68, 60568 }, // ә
-    { 21, 29, 27, 8, 27, 153, 60636 }, // Ӛ
-    { 18, 21, 21, 6, 16, 95, 60789 }, // ӛ
-    { 35, 32, 35, 4, 32, 280, 60884 }, // Ӝ
-    { 34, 28, 37, 1, 28, 238, 61164 }, // ӝ
-    { 18, 31, 16, 2, 29, 140, 61402 }, // Ӟ
-    { 17, 20, 11, -2, 20, 85, 61542 }, // ӟ
-    { 16, 20, 17, 3, 19, 80, 61627 }, // Ӡ
-    { 16, 20, 17, 1, 14, 80, 61707 }, // ӡ
-    { 23, 28, 23, 1, 28, 161, 61787 }, // Ӣ
-    { 20, 24, 17, 1, 23, 120, 61948 }, // ӣ
-    { 23, 27, 24, 1, 27, 156, 62068 }, // Ӥ
-    { 18, 23, 17, 1, 22, 104, 62224 }, // ӥ
-    { 25, 31, 28, 2, 29, 194, 62328 }, // Ӧ
-    { 18, 26, 21, 2, 25, 117, 62522 }, // ӧ
-    { 23, 20, 28, 3, 19, 115, 62639 }, // Ө
-    { 17, 16, 21, 2, 15, 68, 62754 }, // ө
-    { 23, 28, 28, 3, 27, 161, 62822 }, // Ӫ
-    { 18, 23, 21, 2, 22, 104, 62983 }, // ӫ
-    { 38, 32, 24, 1, 30, 304, 63087 }, // Ӭ
-    { 15, 21, 16, 2, 20, 79, 63391 }, // ӭ
-    { 21, 33, 20, 0, 30, 174, 63470 }, // Ӯ
-    { 22, 33, 23, 1, 26, 182, 63644 }, // ӯ
-    { 21, 32, 20, 0, 29, 168, 63826 }, // Ӱ
-    { 21, 32, 23, 1, 25, 168, 63994 }, // ӱ
-    { 24, 32, 20, 0, 29, 192, 64162 }, // Ӳ
-    { 26, 32, 23, 1, 25, 208, 64354 }, // ӳ
-    { 16, 25, 17, 4, 25, 100, 64562 }, // Ӵ
-    { 13, 19, 11, 0, 19, 62, 64662 }, // ӵ
-    { 19, 23, 16, 1, 19, 110, 64724 }, // Ӷ
-    { 14, 16, 11, -2, 13, 56, 64834 }, // ӷ
-    { 27, 34, 29, 1, 33, 230, 64890 }, // Ӹ
-    { 23, 27, 22, -2, 26, 156, 65120 }, // ӹ
-    { 26, 24, 27, 1, 21, 156, 65276 }, // Ӽ
-    { 19, 17, 19, -2, 15, 81, 65432 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 65513 }, //  
-    { 0, 0, 29, 0, 0, 0, 65513 }, //  
-    { 0, 0, 17, 0, 0, 0, 65513 }, //  
-    { 0, 0, 29, 0, 0, 0, 65513 }, //  
-    { 0, 0, 12, 0, 0, 0, 65513 }, //  
-    { 0, 0, 10, 0, 0, 0, 65513 }, //  
-    { 0, 0, 8, 0, 0, 0, 65513 }, //  
-    { 0, 0, 18, 0, 0, 0, 65513 }, //  
-    { 0, 0, 7, 0, 0, 0, 65513 }, //  
-    { 0, 0, 9, 0, 0, 0, 65513 }, //  
-    { 0, 0, 8, 0, 0, 0, 65513 }, //  
-    { 0, 0, 4, 0, 0, 0, 65513 }, // ​
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 65513 }, // ‏
-    { 14, 3, 14, 2, 9, 11, 65513 }, // ‐
-    { 14, 3, 14, 2, 9, 11, 65524 }, // ‑
-    { 21, 3, 14, -1, 9, 16, 65535 }, // ‒
-    { 20, 5, 20, 2, 10, 25, 65551 }, // –
-    { 28, 5, 29, 2, 10, 35, 65576 }, // —
-    { 28, 5, 29, 2, 10, 35, 65611 }, // ―
-    { 18, 23, 14, 1, 18, 104, 65646 }, // ‖
-    { 23, 8, 14, -5, -2, 46, 65750 }, // ‗
-    { 11, 9, 11, 5, 22, 25, 65796 }, // ‘
-    { 11, 9, 11, 5, 22, 25, 65821 }, // ’
-    { 11, 9, 8, -2, 4, 25, 65846 }, // ‚
-    { 11, 9, 11, 5, 22, 25, 65871 }, // ‛
-    { 19, 9, 19, 5, 22, 43, 65896 }, // “
-    { 19, 9, 19, 5, 22, 43, 65939 }, // ”
-    { 11, 9, 8, -2, 4, 25, 65982 }, // „
-    { 19, 9, 19, 5, 22, 43, 66007 }, // ‟
-    { 15, 35, 20, 6, 26, 132, 66050 }, // †
-    { 18, 35, 22, 5, 26, 158, 66182 }, // ‡
-    { 23, 19, 13, -3, 22, 110, 66340 }, // •
-    { 10, 9, 15, 4, 11, 23, 66450 }, // ‣
-    { 7, 6, 15, 4, 6, 11, 66473 }, // ․
-    { 7, 6, 15, 4, 6, 11, 66484 }, // ‥
-    { 24, 6, 24, 0, 6, 36, 66495 }, // …
-    { 4, 3, 14, 5, 9, 3, 66531 }, // ‧
-    { 0, 0, 28, 0, 0, 0, 66534 }, //  
-    { 23, 22, 28, 3, 20, 127, 66534 }, // ‰
-    { 11, 9, 14, 8, 22, 25, 66661 }, // ′
-    { 19, 9, 20, 8, 22, 43, 66686 }, // ″
-    { 18, 8, 10, -2, 21, 36, 66729 }, // ‴
-    { 6, 8, 10, 7, 21, 12, 66765 }, // ‵
-    { 11, 8, 10, 5, 21, 22, 66777 }, // ‶
-    { 19, 8, 10, 0, 21, 38, 66799 }, // ‷
-    { 15, 6, 16, 5, 21, 23, 66837 }, // ‸
-    { 10, 14, 10, 3, 14, 35, 66860 }, // ‹
-    { 11, 14, 10, -3, 14, 39, 66895 }, // ›
-    { 33, 32, 34, 2, 25, 264, 66934 }, // ※
-    { 15, 32, 15, 2, 28, 120, 67198 }, // ‼
-    { 20, 40, 22, 4, 34, 200, 67318 }, // ‽
-    { 14, 3, 14, 5, 21, 11, 67518 }, // ‾
-    { 13, 6, 19, 5, 17, 20, 67529 }, // ‿
-    { 18, 17, 16, 2, 23, 77, 67549 }, // ⁂
-    { 23, 22, 32, 5, 20, 127, 67626 }, // ⁄
-    { 34, 31, 38, 6, 28, 264, 67753 }, // ⁇
-    { 29, 32, 30, 5, 28, 232, 68017 }, // ⁈
-    { 28, 32, 19, -2, 28, 224, 68249 }, // ⁉
-    { 29, 44, 23, -2, 30, 319, 68473 }, // ⁒
-    { 0, 0, 117, 0, 0, 0, 68792 }, //  
-    { 9, 10, 8, 9, 21, 23, 68792 }, // ⁰
-    { 8, 9, 9, 10, 21, 18, 68815 }, // ⁴
-    { 9, 11, 9, 9, 22, 25, 68833 }, // ⁵
-    { 9, 10, 9, 9, 21, 23, 68858 }, // ⁶
-    { 8, 11, 9, 11, 22, 22, 68881 }, // ⁷
-    { 9, 11, 9, 9, 21, 25, 68903 }, // ⁸
-    { 9, 11, 9, 9, 21, 25, 68928 }, // ⁹
-    { 18, 16, 22, 1, 16, 72, 68953 }, // ⁿ
-    { 10, 10, 9, -8, 6, 25, 69025 }, // ₀
-    { 7, 11, 8, -8, 6, 20, 69050 }, // ₁
-    { 10, 11, 9, -8, 6, 28, 69070 }, // ₂
-    { 10, 10, 9, -8, 6, 25, 69098 }, // ₃
-    { 9, 10, 9, -8, 6, 23, 69123 }, // ₄
-    { 9, 10, 8, -8, 6, 23, 69146 }, // ₅
-    { 10, 10, 9, -8, 6, 25, 69169 }, // ₆
-    { 8, 11, 9, -6, 6, 22, 69194 }, // ₇
-    { 10, 11, 9, -8, 6, 28, 69216 }, // ₈
-    { 10, 11, 9, -8, 6, 28, 69244 }, // ₉
-    { 18, 35, 12, 1, 26, 158, 69272 }, // ₍
-    { 17, 35, 11, -8, 26, 149, 69430 }, // ₎
-    { 23, 33, 24, 3, 28, 190, 69579 }, // ₡
-    { 22, 23, 24, 2, 23, 127, 69769 }, // ₢
-    { 19, 23, 17, 1, 22, 110, 69896 }, // ₤
-    { 29, 21, 25, -1, 21, 153, 70006 }, // ₦
-    { 24, 22, 22, 1, 22, 132, 70159 }, // ₧
-    { 30, 23, 33, -1, 21, 173, 70291 }, // ₨
-    { 23, 22, 21, -2, 22, 127, 70464 }, // ₩
-    { 24, 19, 27, 4, 19, 114, 70591 }, // ₪
-    { 22, 22, 13, -2, 21, 121, 70705 }, // ₫
-    { 20, 24, 21, 2, 21, 120, 70826 }, // €
-    { 20, 22, 26, 6, 22, 110, 70946 }, // ₮
-    { 27, 22, 16, 0, 22, 149, 71056 }, // ₱
-    { 23, 33, 28, 2, 28, 190, 71205 }, // ₲
-    { 29, 21, 26, 7, 19, 153, 71395 }, // ₴
-    { 14, 21, 15, 2, 18, 74, 71548 }, // ₵
-    { 24, 23, 26, 6, 23, 138, 71622 }, // ₸
-    { 16, 21, 17, 4, 20, 84, 71760 }, // ₹
-    { 16, 19, 17, 2, 17, 76, 71844 }, // ₺
-    { 20, 21, 20, 3, 19, 105, 71920 }, // ₼
-    { 25, 22, 22, -3, 22, 138, 72025 }, // ₽
-    { 17, 18, 18, -4, 13, 77, 72163 }, // ←
-    { 18, 18, 19, 3, 17, 81, 72240 }, // ↑
-    { 18, 18, 19, 5, 13, 81, 72321 }, // →
-    { 18, 18, 19, 7, 16, 81, 72402 }, // ↓
-    { 28, 15, 26, -1, 12, 105, 72483 }, // ↔
-    { 15, 28, 20, 4, 27, 105, 72588 }, // ↕
-    { 17, 12, 20, -2, 11, 51, 72693 }, // ↖
-    { 17, 12, 16, 3, 11, 51, 72744 }, // ↗
-    { 14, 17, 16, 5, 15, 60, 72795 }, // ↘
-    { 14, 17, 16, -3, 15, 60, 72855 }, // ↙
-    { 20, 18, 24, 1, 16, 90, 72915 }, // ⇐
-    { 22, 20, 27, 5, 19, 110, 73005 }, // ⇑
-    { 21, 18, 24, 3, 16, 95, 73115 }, // ⇒
-    { 22, 20, 27, 10, 18, 110, 73210 }, // ⇓
-    { 26, 18, 27, 1, 16, 117, 73320 }, // ⇔
-    { 18, 25, 22, 6, 14, 113, 73437 }, // ⇕
-    { 20, 22, 17, 1, 21, 110, 73550 }, // ∂
-    { 27, 26, 28, 0, 24, 176, 73660 }, // ∅
-    { 20, 20, 22, 1, 19, 100, 73836 }, // ∆
-    { 19, 20, 18, 3, 19, 95, 73936 }, // ∏
-    { 20, 19, 18, 7, 18, 95, 74031 }, // ∐
-    { 18, 20, 15, 1, 19, 90, 74126 }, // ∑
-    { 14, 4, 15, 2, 9, 14, 74216 }, // −
-    { 25, 23, 24, 3, 21, 144, 74230 }, // √
-    { 23, 14, 23, 2, 16, 81, 74374 }, // ∞
-    { 26, 27, 21, 0, 20, 176, 74455 }, // ∫
-    { 10, 17, 8, 1, 17, 43, 74631 }, // ∶
-    { 18, 14, 36, 13, 14, 63, 74674 }, // ≈
-    { 23, 22, 32, 5, 20, 127, 74737 }, // ≠
-    { 24, 21, 20, -3, 18, 126, 74864 }, // ≤
-    { 24, 22, 22, 0, 19, 132, 74990 }, // ≥
+    { 18, 20, 20, 1, 19, 90, 2048 }, // 6
+    { 15, 20, 19, 5, 20, 75, 2138 }, // 7
+    { 18, 20, 20, 1, 19, 90, 2213 }, // 8
+    { 19, 21, 20, 1, 19, 100, 2303 }, // 9
+    { 11, 17, 7, 0, 17, 47, 2403 }, // :
+    { 12, 21, 9, -1, 16, 63, 2450 }, // ;
+    { 21, 17, 19, -2, 17, 90, 2513 }, // <
+    { 16, 10, 15, 1, 12, 40, 2603 }, // =
+    { 21, 17, 20, 1, 17, 90, 2643 }, // >
+    { 18, 31, 17, 4, 28, 140, 2733 }, // ?
+    { 26, 24, 26, 1, 22, 156, 2873 }, // @
+    { 22, 21, 28, 1, 21, 116, 3029 }, // A
+    { 21, 21, 23, 1, 21, 111, 3145 }, // B
+    { 22, 23, 24, 2, 23, 127, 3256 }, // C
+    { 24, 21, 26, 1, 21, 126, 3383 }, // D
+    { 22, 21, 22, 1, 21, 116, 3509 }, // E
+    { 20, 22, 21, 1, 22, 110, 3625 }, // F
+    { 23, 22, 28, 2, 21, 127, 3735 }, // G
+    { 24, 21, 26, 1, 21, 126, 3862 }, // H
+    { 12, 23, 13, 1, 22, 69, 3988 }, // I
+    { 23, 27, 22, 0, 21, 156, 4096 }, // J
+    { 23, 21, 26, 1, 21, 121, 4252 }, // K
+    { 17, 21, 22, 1, 21, 90, 4373 }, // L
+    { 27, 21, 29, 1, 21, 142, 4463 }, // M
+    { 25, 21, 25, 1, 21, 132, 4605 }, // N
+    { 25, 24, 28, 2, 22, 150, 4737 }, // O
+    { 21, 22, 22, 1, 22, 116, 4887 }, // P
+    { 25, 27, 29, 2, 22, 169, 5003 }, // Q
+    { 20, 22, 24, 1, 21, 110, 5172 }, // R
+    { 21, 22, 26, 2, 21, 116, 5282 }, // S
+    { 20, 22, 26, 6, 22, 110, 5398 }, // T
+    { 24, 23, 25, 2, 21, 138, 5508 }, // U
+    { 21, 21, 28, 7, 21, 111, 5646 }, // V
+    { 30, 22, 35, 6, 22, 165, 5757 }, // W
+    { 26, 21, 27, 1, 21, 137, 5922 }, // X
+    { 20, 21, 26, 7, 21, 105, 6144 }, // Y
+    { 26, 21, 27, 1, 21, 137, 6249 }, // Z
+    { 20, 36, 12, -2, 27, 180, 6386 }, // [
+    { 6, 29, 12, 5, 22, 44, 6566 }, // <backslash>
+    { 19, 36, 12, -6, 27, 171, 6610 }, // ]
+    { 15, 7, 14, 3, 24, 27, 6781 }, // ^
+    { 19, 5, 17, -2, -1, 24, 6808 }, // _
+    { 10, 6, 11, 5, 20, 15, 6832 }, // `
+    { 16, 17, 21, 2, 16, 68, 6847 }, // a
+    { 16, 23, 22, 3, 22, 92, 6915 }, // b
+    { 14, 16, 20, 2, 16, 56, 7007 }, // c
+    { 21, 22, 22, 2, 21, 116, 7063 }, // d
+    { 17, 16, 21, 2, 15, 68, 7179 }, // e
+    { 14, 22, 17, 3, 22, 77, 7247 }, // f
+    { 20, 23, 21, 0, 15, 115, 7324 }, // g
+    { 18, 22, 22, 1, 21, 99, 7439 }, // h
+    { 12, 25, 11, 1, 24, 75, 7538 }, // i
+    { 16, 29, 16, 2, 22, 116, 7613 }, // j
+    { 16, 21, 22, 1, 21, 84, 7729 }, // k
+    { 12, 22, 15, 1, 22, 66, 7813 }, // l
+    { 27, 16, 31, 1, 16, 108, 7879 }, // m
+    { 18, 16, 22, 1, 16, 72, 7987 }, // n
+    { 17, 16, 21, 2, 15, 68, 8059 }, // o
+    { 22, 23, 23, -1, 15, 127, 8192 }, // p
+    { 18, 23, 24, 2, 16, 104, 8319 }, // q
+    { 15, 16, 18, 1, 15, 60, 8423 }, // r
+    { 16, 18, 21, 2, 16, 72, 8483 }, // s
+    { 13, 20, 20, 4, 20, 65, 8555 }, // t
+    { 16, 16, 21, 3, 15, 64, 8620 }, // u
+    { 18, 15, 24, 5, 15, 68, 8684 }, // v
+    { 21, 16, 28, 5, 15, 84, 8752 }, // w
+    { 21, 14, 24, 1, 14, 74, 8836 }, // x
+    { 21, 21, 23, 1, 14, 111, 8910 }, // y
+    { 19, 15, 22, 1, 15, 72, 9021 }, // z
+    { 17, 26, 18, 2, 20, 111, 9093 }, // {
+    { 11, 23, 10, 1, 18, 64, 9204 }, // |
+    { 16, 26, 17, -1, 20, 104, 9268 }, // }
+    { 11, 5, 12, 5, 19, 14, 9372 }, // ~
+    { 0, 0, 22, 0, 0, 0, 9386 }, //  
+    { 13, 32, 13, 3, 28, 104, 9386 }, // ¡
+    { 14, 24, 20, 2, 20, 84, 9490 }, // ¢
+    { 19, 23, 17, 1, 22, 110, 9574 }, // £
+    { 17, 15, 17, 2, 17, 64, 9684 }, // ¤
+    { 22, 22, 19, 2, 19, 121, 9748 }, // ¥
+    { 10, 22, 10, 1, 18, 55, 9869 }, // ¦
+    { 19, 22, 19, 1, 20, 105, 9924 }, // §
+    { 14, 6, 13, 4, 21, 21, 10029 }, // ¨
+    { 13, 11, 17, 7, 24, 36, 10050 }, // ©
+    { 10, 9, 16, 7, 19, 23, 10086 }, // ª
+    { 18, 14, 21, 2, 13, 63, 10109 }, // «
+    { 14, 9, 15, 2, 10, 32, 10172 }, // ¬
+    { 15, 3, 15, 2, 9, 12, 10204 }, // ­
+    { 13, 12, 17, 8, 28, 39, 10240 }, // ®
+    { 11, 4, 13, 5, 19, 11, 10279 }, // ¯
+    { 14, 11, 17, 5, 19, 39, 10290 }, // °
+    { 19, 18, 20, 0, 14, 86, 10329 }, // ±
+    { 9, 8, 8, 9, 20, 18, 10415 }, // ²
+    { 10, 10, 8, 8, 21, 25, 10433 }, // ³
+    { 8, 6, 7, 4, 19, 12, 10458 }, // ´
+    { 20, 19, 21, -1, 15, 95, 10470 }, // µ
+    { 19, 22, 19, 2, 18, 105, 10565 }, // ¶
+    { 7, 6, 7, 2, 12, 11, 10670 }, // ·
+    { 8, 8, 8, -1, 1, 16, 10681 }, // ¸
+    { 7, 9, 8, 9, 21, 16, 10697 }, // ¹
+    { 9, 8, 17, 8, 18, 18, 10713 }, // º
+    { 18, 14, 19, -4, 13, 63, 10731 }, // »
+    { 26, 23, 32, 2, 21, 150, 10794 }, // ¼
+    { 28, 23, 32, 2, 21, 161, 10944 }, // ½
+    { 26, 23, 32, 2, 21, 150, 11105 }, // ¾
+    { 19, 31, 17, -2, 18, 148, 11255 }, // ¿
+    { 22, 28, 28, 1, 28, 154, 11403 }, // À
+    { 23, 32, 28, 1, 32, 184, 11557 }, // Á
+    { 23, 29, 28, 1, 29, 167, 11741 }, // Â
+    { 23, 29, 28, 1, 29, 167, 11908 }, // Ã
+    { 25, 30, 28, 1, 30, 188, 12075 }, // Ä
+    { 22, 30, 28, 1, 30, 165, 12288 }, // Å
+    { 35, 22, 34, 1, 21, 193, 12453 }, // Æ
+    { 22, 30, 24, 2, 23, 165, 12646 }, // Ç
+    { 22, 29, 22, 1, 29, 160, 12811 }, // È
+    { 22, 33, 22, 1, 33, 182, 12971 }, // É
+    { 22, 30, 22, 1, 30, 165, 13153 }, // Ê
+    { 22, 31, 22, 1, 31, 171, 13318 }, // Ë
+    { 15, 32, 13, 1, 31, 120, 13489 }, // Ì
+    { 16, 36, 13, 1, 35, 144, 13609 }, // Í
+    { 16, 33, 13, 1, 32, 132, 13753 }, // Î
+    { 18, 33, 13, 1, 32, 149, 13885 }, // Ï
+    { 25, 21, 26, 0, 21, 132, 14034 }, // Ð
+    { 25, 29, 25, 1, 29, 182, 14336 }, // Ñ
+    { 25, 31, 28, 2, 29, 194, 14518 }, // Ò
+    { 25, 35, 28, 2, 33, 219, 14712 }, // Ó
+    { 25, 32, 28, 2, 30, 200, 14931 }, // Ô
+    { 25, 32, 28, 2, 30, 200, 15131 }, // Õ
+    { 25, 33, 28, 2, 31, 207, 15331 }, // Ö
+    { 16, 9, 15, 0, 11, 36, 15538 }, // ×
+    { 50, 46, 28, -10, 34, 575, 15574 }, // Ø
+    { 24, 32, 25, 2, 30, 192, 16149 }, // Ù
+    { 24, 36, 25, 2, 34, 216, 16384 }, // Ú
+    { 24, 33, 25, 2, 31, 198, 16600 }, // Û
+    { 24, 33, 25, 2, 31, 198, 16798 }, // Ü
+    { 20, 36, 26, 7, 36, 180, 16996 }, // Ý
+    { 16, 21, 14, 1, 20, 84, 17176 }, // Þ
+    { 18, 22, 17, 1, 20, 99, 17260 }, // ß
+    { 16, 24, 21, 2, 23, 96, 17359 }, // à
+    { 17, 28, 21, 2, 27, 119, 17455 }, // á
+    { 17, 25, 21, 2, 24, 107, 17574 }, // â
+    { 17, 23, 21, 2, 22, 98, 17681 }, // ã
+    { 19, 26, 21, 2, 25, 124, 17779 }, // ä
+    { 16, 26, 21, 2, 25, 104, 17903 }, // å
+    { 26, 17, 31, 2, 16, 111, 18007 }, // æ
+    { 14, 23, 20, 2, 16, 81, 18118 }, // ç
+    { 17, 26, 21, 2, 25, 111, 18199 }, // è
+    { 18, 31, 21, 2, 30, 140, 18432 }, // é
+    { 18, 27, 21, 2, 26, 122, 18572 }, // ê
+    { 20, 28, 21, 2, 27, 140, 18694 }, // ë
+    { 11, 23, 11, 1, 22, 64, 18834 }, // ì
+    { 13, 28, 11, 1, 27, 91, 18898 }, // í
+    { 14, 24, 11, -1, 23, 84, 18989 }, // î
+    { 13, 24, 11, 1, 23, 78, 19073 }, // ï
+    { 23, 22, 17, 0, 21, 127, 19151 }, // ð
+    { 20, 24, 22, 1, 24, 120, 19278 }, // ñ
+    { 17, 23, 21, 2, 22, 98, 19398 }, // ò
+    { 17, 27, 21, 2, 26, 115, 19496 }, // ó
+    { 17, 24, 21, 2, 23, 102, 19611 }, // ô
+    { 18, 24, 21, 2, 23, 108, 19713 }, // õ
+    { 19, 25, 21, 2, 24, 119, 19821 }, // ö
+    { 19, 18, 22, 4, 17, 86, 19940 }, // ÷
+    { 28, 44, 21, -3, 30, 308, 20026 }, // ø
+    { 16, 24, 21, 3, 23, 96, 20334 }, // ù
+    { 16, 28, 21, 3, 27, 112, 20480 }, // ú
+    { 16, 24, 21, 3, 23, 96, 20592 }, // û
+    { 18, 25, 21, 3, 24, 113, 20688 }, // ü
+    { 21, 36, 23, 1, 29, 189, 20801 }, // ý
+    { 17, 26, 14, 0, 21, 111, 20990 }, // þ
+    { 22, 33, 23, 1, 26, 182, 21101 }, // ÿ
+    { 25, 29, 28, 1, 29, 182, 21283 }, // Ā
+    { 19, 25, 21, 2, 24, 119, 21465 }, // ā
+    { 26, 30, 28, 1, 30, 195, 21584 }, // Ă
+    { 20, 25, 21, 2, 24, 125, 21779 }, // ă
+    { 22, 28, 28, 1, 21, 154, 21904 }, // Ą
+    { 16, 24, 21, 2, 16, 96, 22058 }, // ą
+    { 22, 31, 24, 2, 31, 171, 22154 }, // Ć
+    { 15, 21, 20, 2, 21, 79, 22325 }, // ć
+    { 24, 32, 24, 2, 32, 192, 22528 }, // Ĉ
+    { 18, 24, 20, 2, 24, 108, 22720 }, // ĉ
+    { 22, 31, 24, 2, 31, 171, 22828 }, // Ċ
+    { 16, 22, 20, 2, 22, 88, 22999 }, // ċ
+    { 25, 33, 24, 2, 33, 207, 23087 }, // Č
+    { 20, 24, 20, 2, 24, 120, 23294 }, // č
+    { 24, 31, 26, 1, 31, 186, 23414 }, // Ď
+    { 25, 22, 22, 2, 21, 138, 23600 }, // ď
+    { 25, 21, 26, 0, 21, 132, 23738 }, // Đ
+    { 24, 22, 22, 2, 21, 132, 23870 }, // đ
+    { 23, 30, 22, 1, 30, 173, 24002 }, // Ē
+    { 20, 28, 21, 2, 27, 140, 24175 }, // ē
+    { 23, 30, 22, 1, 30, 173, 24315 }, // Ĕ
+    { 21, 28, 21, 2, 27, 147, 24576 }, // ĕ
+    { 22, 31, 22, 1, 31, 171, 24723 }, // Ė
+    { 18, 28, 21, 2, 27, 126, 24894 }, // ė
+    { 22, 28, 22, 1, 21, 154, 25020 }, // Ę
+    { 17, 25, 21, 2, 15, 107, 25174 }, // ę
+    { 24, 33, 22, 1, 33, 198, 25281 }, // Ě
+    { 21, 30, 21, 2, 29, 158, 25479 }, // ě
+    { 26, 34, 28, 2, 33, 221, 25637 }, // Ĝ
+    { 23, 34, 21, 0, 26, 196, 25858 }, // ĝ
+    { 27, 33, 28, 2, 32, 223, 26054 }, // Ğ
+    { 23, 32, 21, 0, 24, 184, 26277 }, // ğ
+    { 23, 33, 28, 2, 32, 190, 26624 }, // Ġ
+    { 20, 33, 21, 0, 25, 165, 26814 }, // ġ
+    { 24, 38, 28, 2, 37, 228, 26979 }, // Ģ
+    { 21, 34, 21, 0, 26, 179, 27207 }, // ģ
+    { 24, 31, 26, 1, 31, 186, 27386 }, // Ĥ
+    { 18, 31, 22, 1, 30, 140, 27572 }, // ĥ
+    { 25, 21, 26, 1, 21, 132, 27712 }, // Ħ
+    { 18, 22, 22, 1, 21, 99, 27844 }, // ħ
+    { 17, 34, 13, 1, 33, 145, 27943 }, // Ĩ
+    { 13, 25, 11, 1, 24, 82, 28088 }, // ĩ
+    { 18, 33, 13, 1, 32, 149, 28170 }, // Ī
+    { 14, 25, 11, 1, 24, 88, 28319 }, // ī
+    { 14, 29, 13, -1, 22, 102, 28407 }, // Į
+    { 15, 32, 11, -2, 24, 120, 28509 }, // į
+    { 16, 34, 13, 1, 33, 136, 28672 }, // İ
+    { 8, 16, 11, 1, 15, 32, 28808 }, // ı
+    { 25, 33, 40, 7, 22, 207, 28840 }, // Ĳ
+    { 24, 30, 11, 1, 23, 180, 29047 }, // ĳ
+    { 26, 37, 22, 0, 31, 241, 29227 }, // Ĵ
+    { 21, 32, 16, 2, 25, 168, 29468 }, // ĵ
+    { 23, 34, 26, 1, 34, 196, 29636 }, // Ķ
+    { 18, 34, 22, -1, 21, 153, 29832 }, // ķ
+    { 14, 14, 16, -2, 14, 49, 29985 }, // ĸ
+    { 17, 28, 22, 1, 28, 119, 30034 }, // Ĺ
+    { 16, 33, 15, 1, 33, 132, 30153 }, // ĺ
+    { 17, 34, 22, 1, 21, 145, 30285 }, // Ļ
+    { 15, 36, 15, -2, 22, 135, 30430 }, // ļ
+    { 19, 21, 22, 1, 21, 100, 30565 }, // Ľ
+    { 19, 26, 15, 1, 26, 124, 30720 }, // ľ
+    { 19, 21, 22, 1, 21, 100, 30844 }, // Ŀ
+    { 16, 22, 15, 1, 22, 88, 30944 }, // ŀ
+    { 38, 35, 22, -12, 28, 333, 31032 }, // Ł
+    { 27, 22, 15, -9, 22, 149, 31365 }, // ł
+    { 25, 30, 25, 1, 30, 188, 31514 }, // Ń
+    { 19, 25, 22, 1, 25, 119, 31702 }, // ń
+    { 25, 31, 25, 1, 21, 194, 31821 }, // Ņ
+    { 18, 26, 22, 1, 16, 117, 32015 }, // ņ
+    { 26, 32, 25, 1, 32, 208, 32132 }, // Ň
+    { 23, 27, 22, 1, 27, 156, 32340 }, // ň
+    { 33, 26, 22, -14, 26, 215, 32496 }, // ŉ
+    { 25, 27, 25, 1, 21, 169, 32768 }, // Ŋ
+    { 18, 21, 22, 1, 16, 95, 32937 }, // ŋ
+    { 25, 32, 28, 2, 30, 200, 33032 }, // Ō
+    { 19, 25, 21, 2, 24, 119, 33232 }, // ō
+    { 25, 33, 28, 2, 31, 207, 33351 }, // Ŏ
+    { 20, 25, 21, 2, 24, 125, 33558 }, // ŏ
+    { 28, 32, 28, 2, 30, 224, 33683 }, // Ő
+    { 23, 24, 21, 2, 23, 138, 33907 }, // ő
+    { 35, 24, 30, 2, 22, 210, 34045 }, // Œ
+    { 27, 16, 27, 2, 15, 108, 34255 }, // œ
+    { 20, 30, 24, 1, 29, 150, 34363 }, // Ŕ
+    { 15, 23, 18, 1, 22, 87, 34513 }, // ŕ
+    { 20, 35, 24, 1, 34, 175, 34600 }, // Ŗ
+    { 15, 28, 18, 1, 27, 105, 34816 }, // ŗ
+    { 23, 32, 24, 1, 31, 184, 34921 }, // Ř
+    { 18, 25, 18, 1, 24, 113, 35105 }, // ř
+    { 21, 30, 26, 2, 29, 158, 35218 }, // Ś
+    { 16, 24, 21, 2, 22, 96, 35376 }, // ś
+    { 23, 31, 26, 2, 30, 179, 35472 }, // Ŝ
+    { 19, 26, 21, 2, 24, 124, 35651 }, // ŝ
+    { 21, 28, 26, 2, 21, 147, 35775 }, // Ş
+    { 16, 24, 21, 2, 16, 96, 35922 }, // ş
+    { 24, 32, 26, 2, 31, 192, 36018 }, // Š
+    { 20, 26, 21, 2, 24, 130, 36210 }, // š
+    { 20, 29, 26, 6, 22, 145, 36340 }, // Ţ
+    { 14, 26, 20, 3, 20, 91, 36485 }, // ţ
+    { 20, 32, 26, 6, 32, 160, 36576 }, // Ť
+    { 20, 23, 20, 4, 23, 115, 36736 }, // ť
+    { 20, 22, 26, 6, 22, 110, 36864 }, // Ŧ
+    { 15, 20, 20, 2, 20, 75, 36974 }, // ŧ
+    { 24, 34, 25, 2, 32, 204, 37049 }, // Ũ
+    { 17, 25, 21, 3, 24, 107, 37253 }, // ũ
+    { 24, 33, 25, 2, 31, 198, 37360 }, // Ū
+    { 18, 25, 21, 3, 24, 113, 37558 }, // ū
+    { 24, 33, 25, 2, 31, 198, 37671 }, // Ŭ
+    { 19, 25, 21, 3, 24, 119, 37869 }, // ŭ
+    { 24, 35, 25, 2, 33, 210, 37988 }, // Ů
+    { 16, 27, 21, 3, 26, 108, 38198 }, // ů
+    { 27, 32, 25, 2, 30, 216, 38306 }, // Ű
+    { 22, 24, 21, 3, 23, 132, 38522 }, // ű
+    { 24, 28, 25, 2, 21, 168, 38654 }, // Ų
+    { 16, 23, 21, 3, 15, 92, 38912 }, // ų
+    { 30, 31, 35, 6, 31, 233, 39004 }, // Ŵ
+    { 21, 26, 28, 5, 25, 137, 39237 }, // ŵ
+    { 20, 33, 26, 7, 33, 165, 39374 }, // Ŷ
+    { 21, 33, 23, 1, 26, 174, 39539 }, // ŷ
+    { 20, 33, 26, 7, 33, 165, 39713 }, // Ÿ
+    { 26, 28, 27, 1, 28, 182, 39878 }, // Ź
+    { 19, 24, 22, 1, 24, 114, 40060 }, // ź
+    { 26, 29, 27, 1, 29, 189, 40174 }, // Ż
+    { 19, 24, 22, 1, 24, 114, 40363 }, // ż
+    { 26, 31, 27, 1, 31, 202, 40477 }, // Ž
+    { 23, 26, 22, 1, 26, 150, 40679 }, // ž
+    { 15, 21, 15, 2, 21, 79, 40829 }, // ſ
+    { 10, 6, 0, 5, 20, 15, 40908 }, // ̀
+    { 8, 6, 0, 4, 19, 12, 40923 }, // ́
+    { 14, 7, 0, -1, 1, 25, 40935 }, // ̂
+    { 11, 5, 0, 5, 19, 14, 40960 }, // ̃
+    { 14, 4, 0, 5, 17, 14, 40974 }, // ̄
+    { 18, 4, 0, 6, 23, 18, 40988 }, // ̅
+    { 13, 6, 0, 5, 18, 20, 41006 }, // ̆
+    { 7, 6, 0, 5, 21, 11, 41026 }, // ̇
+    { 13, 5, 0, 3, 18, 17, 41037 }, // ̈
+    { 5, 6, 0, 9, 16, 8, 41054 }, // ̉
+    { 7, 7, 0, 5, 20, 13, 41062 }, // ̊
+    { 20, 6, 0, 5, 20, 30, 41075 }, // ̋
+    { 14, 7, 0, 5, 20, 25, 41105 }, // ̌
+    { 21, 6, 0, -9, 20, 32, 41130 }, // ̏
+    { 11, 9, 0, 3, 20, 25, 41162 }, // ̒
+    { 11, 9, 0, 3, 19, 25, 41187 }, // ̓
+    { 11, 9, 0, -6, 19, 25, 41212 }, // ̔
+    { 7, 7, 0, 0, 0, 13, 41237 }, // ̘
+    { 7, 7, 0, 1, 0, 13, 41250 }, // ̙
+    { 12, 8, 0, 6, 21, 24, 41263 }, // ̚
+    { 7, 8, 0, 3, 17, 14, 41287 }, // ̛
+    { 6, 8, 0, -1, 0, 12, 41301 }, // ̜
+    { 7, 7, 0, 2, 5, 13, 41313 }, // ̝
+    { 7, 7, 0, -1, 0, 13, 41326 }, // ̞
+    { 6, 6, 0, 0, -2, 9, 41339 }, // ̟
+    { 14, 4, 0, -1, -3, 14, 41348 }, // ̠
+    { 7, 6, 0, -3, 2, 11, 41362 }, // ̣
+    { 12, 5, 0, -2, -2, 15, 41373 }, // ̤
+    { 7, 7, 0, 5, 20, 13, 41388 }, // ̥
+    { 11, 9, 0, -1, 4, 25, 41401 }, // ̦
+    { 8, 8, 0, -1, 1, 16, 41426 }, // ̧
+    { 8, 9, 0, 0, 1, 18, 41442 }, // ̨
+    { 8, 9, 0, -2, 0, 18, 41460 }, // ̩
+    { 12, 6, 0, -1, 0, 18, 41478 }, // ̪
+    { 16, 8, 0, -1, 1, 32, 41496 }, // ̬
+    { 16, 8, 0, -1, 1, 32, 41528 }, // ̭
+    { 12, 6, 0, 6, 21, 18, 41560 }, // ̰
+    { 13, 4, 0, 6, 21, 13, 41578 }, // ̱
+    { 14, 4, 0, -2, -1, 14, 41591 }, // ̲
+    { 13, 6, 0, 6, 21, 20, 41605 }, // ̴
+    { 14, 3, 0, 2, 9, 11, 41625 }, // ̵
+    { 7, 9, 0, 1, 0, 16, 41636 }, // ̹
+    { 14, 8, 0, -4, 1, 28, 41652 }, // ̺
+    { 13, 8, 0, -2, 1, 26, 41680 }, // ̻
+    { 11, 7, 0, -1, 1, 20, 41706 }, // ̼
+    { 9, 6, 0, 5, 19, 14, 41726 }, // ̽
+    { 11, 5, 0, 5, 19, 14, 41740 }, // ͂
+    { 6, 7, 0, 10, 22, 11, 41754 }, // ̓
+    { 15, 19, 0, 4, 32, 72, 41765 }, // ̈́
+    { 12, 7, 0, 4, 21, 21, 41837 }, // ͆
+    { 16, 10, 0, -2, 0, 40, 41858 }, // ͇
+    { 13, 8, 0, -1, 1, 26, 41898 }, // ͈
+    { 10, 8, 0, -1, -1, 20, 41924 }, // ͉
+    { 18, 21, 0, 4, 27, 95, 41944 }, // ͊
+    { 26, 20, 0, 8, 30, 130, 42039 }, // ͋
+    { 18, 14, 0, 13, 14, 63, 42169 }, // ͌
+    { 13, 28, 0, 1, 9, 91, 42232 }, // ͍
+    { 5, 4, 0, 12, 3, 5, 42323 }, // ͎
+    { 22, 7, 0, 0, 1, 39, 42328 }, // ͜
+    { 22, 6, 0, 4, 20, 33, 42367 }, // ͡
+    { 27, 8, 0, -1, -1, 54, 42400 }, // ͢
+    { 22, 30, 22, 1, 30, 165, 42454 }, // Ѐ
+    { 22, 31, 22, 1, 31, 171, 42619 }, // Ё
+    { 23, 23, 17, 3, 22, 133, 42790 }, // Ђ
+    { 19, 29, 16, 1, 28, 138, 43008 }, // Ѓ
+    { 22, 22, 21, 1, 20, 121, 43146 }, // Є
+    { 21, 22, 26, 2, 21, 116, 43267 }, // Ѕ
+    { 12, 23, 13, 1, 22, 69, 43383 }, // І
+    { 17, 32, 13, 1, 31, 136, 43452 }, // Ї
+    { 23, 27, 22, 0, 21, 156, 43588 }, // Ј
+    { 27, 21, 29, 2, 19, 142, 43744 }, // Љ
+    { 26, 21, 15, -5, 20, 137, 43886 }, // Њ
+    { 20, 24, 26, 6, 23, 120, 44023 }, // Ћ
+    { 23, 28, 26, 1, 28, 161, 44143 }, // Ќ
+    { 23, 28, 24, 1, 28, 161, 44304 }, // Ѝ
+    { 21, 32, 20, 0, 29, 168, 44465 }, // Ў
+    { 21, 25, 20, 2, 19, 132, 44633 }, // Џ
+    { 22, 21, 28, 1, 21, 116, 44765 }, // А
+    { 18, 20, 16, 2, 19, 90, 44881 }, // Б
+    { 18, 19, 17, 1, 18, 86, 45056 }, // В
+    { 19, 20, 16, 1, 19, 95, 45142 }, // Г
+    { 22, 23, 21, 1, 19, 127, 45237 }, // Д
+    { 21, 21, 22, 1, 21, 111, 45364 }, // Е
+    { 35, 21, 37, 1, 21, 184, 45475 }, // Ж
+    { 16, 20, 16, 2, 18, 80, 45659 }, // З
+    { 23, 21, 24, 1, 21, 121, 45739 }, // И
+    { 23, 28, 24, 1, 28, 161, 45860 }, // Й
+    { 23, 21, 26, 1, 21, 121, 46021 }, // К
+    { 22, 21, 15, -1, 19, 116, 46142 }, // Л
+    { 24, 20, 21, 1, 19, 120, 46258 }, // М
+    { 24, 21, 26, 1, 21, 126, 46378 }, // Н
+    { 25, 24, 28, 2, 22, 150, 46504 }, // О
+    { 20, 21, 17, 1, 20, 105, 46654 }, // П
+    { 21, 22, 22, 1, 22, 116, 46759 }, // Р
+    { 22, 23, 24, 2, 23, 127, 46875 }, // С
+    { 20, 22, 26, 6, 22, 110, 47104 }, // Т
+    { 21, 22, 20, 0, 19, 116, 47214 }, // У
+    { 19, 19, 22, 5, 19, 91, 47330 }, // Ф
+    { 26, 21, 27, 1, 21, 137, 47421 }, // Х
+    { 19, 24, 18, 1, 19, 114, 47558 }, // Ц
+    { 16, 19, 17, 4, 19, 76, 47672 }, // Ч
+    { 23, 20, 20, 1, 19, 115, 47748 }, // Ш
+    { 23, 25, 23, 1, 20, 144, 47863 }, // Щ
+    { 17, 19, 16, -1, 18, 81, 48007 }, // Ъ
+    { 27, 23, 29, 1, 22, 156, 48088 }, // Ы
+    { 15, 20, 16, 1, 19, 75, 48244 }, // Ь
+    { 23, 22, 24, 1, 20, 127, 48319 }, // Э
+    { 24, 21, 23, 2, 20, 126, 48446 }, // Ю
+    { 21, 22, 22, 1, 21, 116, 48572 }, // Я
+    { 16, 17, 21, 2, 16, 68, 48688 }, // а
+    { 20, 23, 17, 2, 22, 115, 48756 }, // б
+    { 15, 15, 18, -1, 15, 57, 48871 }, // в
+    { 17, 16, 15, 1, 15, 68, 48928 }, // г
+    { 19, 19, 19, 1, 15, 91, 48996 }, // д
+    { 17, 16, 21, 2, 15, 68, 49152 }, // е
+    { 34, 18, 37, 1, 18, 153, 49220 }, // ж
+    { 12, 13, 11, -2, 13, 39, 49373 }, // з
+    { 18, 16, 17, 1, 15, 72, 49412 }, // и
+    { 18, 21, 16, 0, 21, 95, 49484 }, // й
+    { 17, 14, 20, -1, 14, 60, 49579 }, // к
+    { 15, 15, 10, -3, 13, 57, 49639 }, // л
+    { 19, 16, 21, -1, 16, 76, 49696 }, // м
+    { 20, 16, 21, -1, 16, 80, 49772 }, // н
+    { 17, 16, 21, 2, 15, 68, 49852 }, // о
+    { 18, 16, 17, 1, 15, 72, 49920 }, // п
+    { 22, 23, 23, -1, 15, 127, 49992 }, // р
+    { 14, 16, 20, 2, 16, 56, 50119 }, // с
+    { 16, 16, 17, 4, 15, 64, 50175 }, // т
+    { 21, 21, 23, 1, 14, 111, 50239 }, // у
+    { 22, 21, 22, 2, 15, 116, 50350 }, // ф
+    { 21, 16, 18, 0, 15, 84, 50466 }, // х
+    { 18, 19, 18, 1, 15, 86, 50550 }, // ц
+    { 11, 13, 11, 0, 13, 36, 50636 }, // ч
+    { 22, 16, 20, 1, 15, 88, 50672 }, // ш
+    { 22, 20, 22, 1, 15, 110, 50760 }, // щ
+    { 13, 15, 12, -3, 14, 49, 50870 }, // ъ
+    { 21, 17, 22, -2, 16, 90, 50919 }, // ы
+    { 11, 15, 12, -1, 14, 42, 51009 }, // ь
+    { 15, 15, 16, 2, 14, 57, 51051 }, // э
+    { 19, 17, 18, 0, 16, 81, 51108 }, // ю
+    { 14, 16, 21, 2, 16, 56, 51200 }, // я
+    { 18, 28, 21, 2, 27, 126, 51256 }, // ѐ
+    { 19, 27, 21, 2, 26, 129, 51382 }, // ё
+    { 18, 27, 22, 1, 21, 122, 51511 }, // ђ
+    { 17, 23, 15, 1, 22, 98, 51633 }, // ѓ
+    { 16, 16, 14, -2, 14, 64, 51731 }, // є
+    { 16, 18, 21, 2, 16, 72, 51795 }, // ѕ
+    { 12, 25, 11, 1, 24, 75, 51867 }, // і
+    { 13, 24, 11, 1, 23, 78, 51942 }, // ї
+    { 16, 29, 16, 2, 22, 116, 52020 }, // ј
+    { 18, 15, 20, -1, 13, 68, 52136 }, // љ
+    { 18, 15, 10, -6, 14, 68, 52204 }, // њ
+    { 18, 22, 22, 1, 21, 99, 52272 }, // ћ
+    { 18, 21, 20, -1, 21, 95, 52371 }, // ќ
+    { 18, 25, 17, 1, 24, 113, 52466 }, // ѝ
+    { 23, 33, 23, 1, 26, 190, 52579 }, // ў
+    { 16, 18, 15, -1, 13, 72, 52769 }, // џ
+    { 16, 21, 19, 4, 19, 84, 52841 }, // Ѣ
+    { 16, 21, 16, 3, 19, 84, 52925 }, // ѣ
+    { 27, 22, 22, -1, 20, 149, 53009 }, // Ѫ
+    { 19, 15, 15, -3, 13, 72, 53158 }, // ѫ
+    { 28, 27, 28, 2, 26, 189, 53248 }, // Ѳ
+    { 22, 22, 21, 2, 21, 121, 53437 }, // ѳ
+    { 25, 25, 28, 7, 25, 157, 53558 }, // Ѵ
+    { 18, 18, 22, 5, 18, 81, 53715 }, // ѵ
+    { 12, 9, 0, 7, 24, 27, 53796 }, // ҆
+    { 20, 23, 16, 1, 22, 115, 53823 }, // Ґ
+    { 18, 20, 15, 1, 19, 90, 53938 }, // ґ
+    { 19, 20, 16, 1, 19, 95, 54028 }, // Ғ
+    { 14, 14, 11, -2, 13, 49, 54123 }, // ғ
+    { 20, 23, 15, 0, 22, 115, 54172 }, // Ҕ
+    { 13, 15, 9, -3, 13, 49, 54287 }, // ҕ
+    { 35, 26, 38, 1, 21, 228, 54336 }, // Җ
+    { 25, 18, 25, -2, 15, 113, 54564 }, // җ
+    { 16, 23, 16, 2, 18, 92, 54677 }, // Ҙ
+    { 12, 19, 11, -2, 13, 57, 54769 }, // ҙ
+    { 23, 25, 18, 0, 21, 144, 54826 }, // Қ
+    { 15, 18, 13, -2, 15, 68, 54970 }, // қ
+    { 27, 20, 27, 1, 19, 135, 55038 }, // Ҝ
+    { 19, 14, 19, 0, 13, 67, 55173 }, // ҝ
+    { 23, 21, 26, 1, 21, 121, 55296 }, // Ҟ
+    { 16, 21, 22, 1, 21, 84, 55417 }, // ҟ
+    { 23, 21, 26, 1, 21, 121, 55501 }, // Ҡ
+    { 16, 15, 18, -2, 15, 60, 55622 }, // ҡ
+    { 24, 25, 19, -2, 21, 150, 55682 }, // Ң
+    { 17, 17, 13, -4, 15, 73, 55832 }, // ң
+    { 34, 21, 26, 1, 21, 179, 55905 }, // Ҥ
+    { 24, 15, 18, -2, 15, 90, 56084 }, // ҥ
+    { 30, 22, 32, 2, 21, 165, 56174 }, // Ҧ
+    { 24, 25, 32, 4, 17, 150, 56339 }, // ҧ
+    { 26, 21, 17, -3, 19, 137, 56489 }, // Ҩ
+    { 21, 18, 25, 1, 16, 95, 56626 }, // ҩ
+    { 22, 27, 24, 2, 23, 149, 56721 }, // Ҫ
+    { 14, 19, 20, 2, 16, 67, 56870 }, // ҫ
+    { 20, 24, 19, 3, 21, 120, 56937 }, // Ҭ
+    { 15, 17, 13, -1, 15, 64, 57057 }, // ҭ
+    { 20, 21, 26, 7, 21, 105, 57121 }, // Ү
+    { 16, 20, 19, 5, 14, 80, 57226 }, // ү
+    { 23, 21, 26, 4, 21, 121, 57344 }, // Ұ
+    { 20, 20, 19, 1, 14, 100, 57465 }, // ұ
+    { 26, 25, 20, 1, 21, 163, 57565 }, // Ҳ
+    { 18, 18, 20, 1, 15, 81, 57728 }, // ҳ
+    { 21, 24, 15, 0, 19, 126, 57809 }, // Ҵ
+    { 16, 18, 22, 3, 13, 72, 57935 }, // ҵ
+    { 17, 25, 17, 3, 19, 107, 58007 }, // Ҷ
+    { 12, 19, 12, 0, 14, 57, 58114 }, // ҷ
+    { 16, 19, 17, 4, 19, 76, 58171 }, // Ҹ
+    { 11, 13, 11, 0, 13, 36, 58247 }, // ҹ
+    { 17, 23, 17, 1, 21, 98, 58283 }, // Һ
+    { 18, 22, 22, 1, 21, 99, 58381 }, // һ
+    { 28, 20, 35, 5, 19, 140, 58480 }, // Ҽ
+    { 21, 14, 17, 1, 13, 74, 58620 }, // ҽ
+    { 29, 24, 22, 6, 19, 174, 58694 }, // Ҿ
+    { 21, 17, 16, 2, 13, 90, 58868 }, // ҿ
+    { 12, 23, 13, 1, 22, 69, 58958 }, // Ӏ
+    { 35, 34, 37, 1, 34, 298, 59027 }, // Ӂ
+    { 34, 29, 37, 1, 29, 247, 59392 }, // ӂ
+    { 20, 26, 18, 1, 19, 130, 59639 }, // Ӄ
+    { 14, 19, 12, -2, 13, 67, 59769 }, // ӄ
+    { 22, 25, 15, -1, 19, 138, 59836 }, // Ӆ
+    { 15, 17, 10, -1, 13, 64, 59974 }, // ӆ
+    { 24, 27, 26, 1, 21, 162, 60038 }, // Ӈ
+    { 17, 20, 18, -2, 15, 85, 60200 }, // ӈ
+    { 24, 29, 26, 1, 21, 174, 60285 }, // Ӊ
+    { 17, 21, 18, 0, 15, 90, 60459 }, // ӊ
+    { 17, 25, 17, 4, 19, 107, 60549 }, // Ӌ
+    { 11, 17, 15, 2, 13, 47, 60656 }, // ӌ
+    { 27, 30, 29, 1, 21, 203, 60703 }, // Ӎ
+    { 19, 21, 20, 0, 15, 100, 60906 }, // ӎ
+    { 10, 19, 15, 5, 18, 48, 61006 }, // ӏ
+    { 26, 29, 28, 1, 29, 189, 61054 }, // Ӑ
+    { 20, 25, 21, 2, 24, 125, 61243 }, // ӑ
+    { 24, 28, 28, 1, 28, 168, 61440 }, // Ӓ
+    { 20, 25, 21, 2, 24, 125, 61608 }, // ӓ
+    { 35, 22, 34, 1, 21, 193, 61733 }, // Ӕ
+    { 26, 17, 31, 2, 16, 111, 61926 }, // ӕ
+    { 24, 30, 22, 1, 30, 180, 62037 }, // Ӗ
+    { 21, 27, 21, 2, 26, 142, 62217 }, // ӗ
+    { 21, 21, 27, 8, 19, 111, 62359 }, // Ә
+    { 16, 17, 21, 8, 16, 68, 62470 }, // ә
+    { 21, 29, 27, 8, 27, 153, 62538 }, // Ӛ
+    { 18, 21, 21, 6, 16, 95, 62691 }, // ӛ
+    { 35, 32, 35, 4, 32, 280, 62786 }, // Ӝ
+    { 34, 28, 37, 1, 28, 238, 63066 }, // ӝ
+    { 18, 31, 16, 2, 29, 140, 63304 }, // Ӟ
+    { 17, 20, 11, -2, 20, 85, 63488 }, // ӟ
+    { 16, 20, 17, 3, 19, 80, 63573 }, // Ӡ
+    { 16, 20, 17, 1, 14, 80, 63653 }, // ӡ
+    { 23, 28, 23, 1, 28, 161, 63733 }, // Ӣ
+    { 20, 24, 17, 1, 23, 120, 63894 }, // ӣ
+    { 23, 27, 24, 1, 27, 156, 64014 }, // Ӥ
+    { 18, 23, 17, 1, 22, 104, 64170 }, // ӥ
+    { 25, 31, 28, 2, 29, 194, 64274 }, // Ӧ
+    { 18, 26, 21, 2, 25, 117, 64468 }, // ӧ
+    { 23, 20, 28, 3, 19, 115, 64585 }, // Ө
+    { 17, 16, 21, 2, 15, 68, 64700 }, // ө
+    { 23, 28, 28, 3, 27, 161, 64768 }, // Ӫ
+    { 18, 23, 21, 2, 22, 104, 64929 }, // ӫ
+    { 38, 32, 24, 1, 30, 304, 65033 }, // Ӭ
+    { 15, 21, 16, 2, 20, 79, 65337 }, // ӭ
+    { 21, 33, 20, 0, 30, 174, 65536 }, // Ӯ
+    { 22, 33, 23, 1, 26, 182, 65710 }, // ӯ
+    { 21, 32, 20, 0, 29, 168, 65892 }, // Ӱ
+    { 21, 32, 23, 1, 25, 168, 66060 }, // ӱ
+    { 24, 32, 20, 0, 29, 192, 66228 }, // Ӳ
+    { 26, 32, 23, 1, 25, 208, 66420 }, // ӳ
+    { 16, 25, 17, 4, 25, 100, 66628 }, // Ӵ
+    { 13, 19, 11, 0, 19, 62, 66728 }, // ӵ
+    { 19, 23, 16, 1, 19, 110, 66790 }, // Ӷ
+    { 14, 16, 11, -2, 13, 56, 66900 }, // ӷ
+    { 27, 34, 29, 1, 33, 230, 66956 }, // Ӹ
+    { 23, 27, 22, -2, 26, 156, 67186 }, // ӹ
+    { 26, 24, 27, 1, 21, 156, 67342 }, // Ӽ
+    { 19, 17, 19, -2, 15, 81, 67498 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 67579 }, //  
+    { 0, 0, 29, 0, 0, 0, 67579 }, //  
+    { 0, 0, 17, 0, 0, 0, 67579 }, //  
+    { 0, 0, 29, 0, 0, 0, 67579 }, //  
+    { 0, 0, 12, 0, 0, 0, 67579 }, //  
+    { 0, 0, 10, 0, 0, 0, 67579 }, //  
+    { 0, 0, 8, 0, 0, 0, 67579 }, //  
+    { 0, 0, 18, 0, 0, 0, 67579 }, //  
+    { 0, 0, 7, 0, 0, 0, 67579 }, //  
+    { 0, 0, 9, 0, 0, 0, 67579 }, //  
+    { 0, 0, 8, 0, 0, 0, 67579 }, //  
+    { 0, 0, 4, 0, 0, 0, 67579 }, // ​
+    { 0, 0, 0, 0, 0, 0, 67579 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 67579 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 67579 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 67579 }, // ‏
+    { 14, 3, 14, 2, 9, 11, 67584 }, // ‐
+    { 14, 3, 14, 2, 9, 11, 67595 }, // ‑
+    { 21, 3, 14, -1, 9, 16, 67606 }, // ‒
+    { 20, 5, 20, 2, 10, 25, 67622 }, // –
+    { 28, 5, 29, 2, 10, 35, 67647 }, // —
+    { 28, 5, 29, 2, 10, 35, 67682 }, // ―
+    { 18, 23, 14, 1, 18, 104, 67717 }, // ‖
+    { 23, 8, 14, -5, -2, 46, 67821 }, // ‗
+    { 11, 9, 11, 5, 22, 25, 67867 }, // ‘
+    { 11, 9, 11, 5, 22, 25, 67892 }, // ’
+    { 11, 9, 8, -2, 4, 25, 67917 }, // ‚
+    { 11, 9, 11, 5, 22, 25, 67942 }, // ‛
+    { 19, 9, 19, 5, 22, 43, 67967 }, // “
+    { 19, 9, 19, 5, 22, 43, 68010 }, // ”
+    { 11, 9, 8, -2, 4, 25, 68053 }, // „
+    { 19, 9, 19, 5, 22, 43, 68078 }, // ‟
+    { 15, 35, 20, 6, 26, 132, 68121 }, // †
+    { 18, 35, 22, 5, 26, 158, 68253 }, // ‡
+    { 23, 19, 13, -3, 22, 110, 68411 }, // •
+    { 10, 9, 15, 4, 11, 23, 68521 }, // ‣
+    { 7, 6, 15, 4, 6, 11, 68544 }, // ․
+    { 7, 6, 15, 4, 6, 11, 68555 }, // ‥
+    { 24, 6, 24, 0, 6, 36, 68566 }, // …
+    { 4, 3, 14, 5, 9, 3, 68602 }, // ‧
+    { 0, 0, 28, 0, 0, 0, 68605 }, //  
+    { 23, 22, 28, 3, 20, 127, 68605 }, // ‰
+    { 11, 9, 14, 8, 22, 25, 68732 }, // ′
+    { 19, 9, 20, 8, 22, 43, 68757 }, // ″
+    { 18, 8, 10, -2, 21, 36, 68800 }, // ‴
+    { 6, 8, 10, 7, 21, 12, 68836 }, // ‵
+    { 11, 8, 10, 5, 21, 22, 68848 }, // ‶
+    { 19, 8, 10, 0, 21, 38, 68870 }, // ‷
+    { 15, 6, 16, 5, 21, 23, 68908 }, // ‸
+    { 10, 14, 10, 3, 14, 35, 68931 }, // ‹
+    { 11, 14, 10, -3, 14, 39, 68966 }, // ›
+    { 33, 32, 34, 2, 25, 264, 69005 }, // ※
+    { 15, 32, 15, 2, 28, 120, 69269 }, // ‼
+    { 20, 40, 22, 4, 34, 200, 69389 }, // ‽
+    { 14, 3, 14, 5, 21, 11, 69589 }, // ‾
+    { 13, 6, 19, 5, 17, 20, 69600 }, // ‿
+    { 18, 17, 16, 2, 23, 77, 69632 }, // ⁂
+    { 23, 22, 32, 5, 20, 127, 69709 }, // ⁄
+    { 34, 31, 38, 6, 28, 264, 69836 }, // ⁇
+    { 29, 32, 30, 5, 28, 232, 70100 }, // ⁈
+    { 28, 32, 19, -2, 28, 224, 70332 }, // ⁉
+    { 29, 44, 23, -2, 30, 319, 70556 }, // ⁒
+    { 0, 0, 117, 0, 0, 0, 70875 }, //  
+    { 9, 10, 8, 9, 21, 23, 70875 }, // ⁰
+    { 8, 9, 9, 10, 21, 18, 70898 }, // ⁴
+    { 9, 11, 9, 9, 22, 25, 70916 }, // ⁵
+    { 9, 10, 9, 9, 21, 23, 70941 }, // ⁶
+    { 8, 11, 9, 11, 22, 22, 70964 }, // ⁷
+    { 9, 11, 9, 9, 21, 25, 70986 }, // ⁸
+    { 9, 11, 9, 9, 21, 25, 71011 }, // ⁹
+    { 18, 16, 22, 1, 16, 72, 71036 }, // ⁿ
+    { 10, 10, 9, -8, 6, 25, 71108 }, // ₀
+    { 7, 11, 8, -8, 6, 20, 71133 }, // ₁
+    { 10, 11, 9, -8, 6, 28, 71153 }, // ₂
+    { 10, 10, 9, -8, 6, 25, 71181 }, // ₃
+    { 9, 10, 9, -8, 6, 23, 71206 }, // ₄
+    { 9, 10, 8, -8, 6, 23, 71229 }, // ₅
+    { 10, 10, 9, -8, 6, 25, 71252 }, // ₆
+    { 8, 11, 9, -6, 6, 22, 71277 }, // ₇
+    { 10, 11, 9, -8, 6, 28, 71299 }, // ₈
+    { 10, 11, 9, -8, 6, 28, 71327 }, // ₉
+    { 18, 35, 12, 1, 26, 158, 71355 }, // ₍
+    { 17, 35, 11, -8, 26, 149, 71513 }, // ₎
+    { 23, 33, 24, 3, 28, 190, 71680 }, // ₡
+    { 22, 23, 24, 2, 23, 127, 71870 }, // ₢
+    { 19, 23, 17, 1, 22, 110, 71997 }, // ₤
+    { 29, 21, 25, -1, 21, 153, 72107 }, // ₦
+    { 24, 22, 22, 1, 22, 132, 72260 }, // ₧
+    { 30, 23, 33, -1, 21, 173, 72392 }, // ₨
+    { 23, 22, 21, -2, 22, 127, 72565 }, // ₩
+    { 24, 19, 27, 4, 19, 114, 72692 }, // ₪
+    { 22, 22, 13, -2, 21, 121, 72806 }, // ₫
+    { 20, 24, 21, 2, 21, 120, 72927 }, // €
+    { 20, 22, 26, 6, 22, 110, 73047 }, // ₮
+    { 27, 22, 16, 0, 22, 149, 73157 }, // ₱
+    { 23, 33, 28, 2, 28, 190, 73306 }, // ₲
+    { 29, 21, 26, 7, 19, 153, 73496 }, // ₴
+    { 14, 21, 15, 2, 18, 74, 73649 }, // ₵
+    { 24, 23, 26, 6, 23, 138, 73728 }, // ₸
+    { 16, 21, 17, 4, 20, 84, 73866 }, // ₹
+    { 16, 19, 17, 2, 17, 76, 73950 }, // ₺
+    { 20, 21, 20, 3, 19, 105, 74026 }, // ₼
+    { 25, 22, 22, -3, 22, 138, 74131 }, // ₽
+    { 17, 18, 18, -4, 13, 77, 74269 }, // ←
+    { 18, 18, 19, 3, 17, 81, 74346 }, // ↑
+    { 18, 18, 19, 5, 13, 81, 74427 }, // →
+    { 18, 18, 19, 7, 16, 81, 74508 }, // ↓
+    { 28, 15, 26, -1, 12, 105, 74589 }, // ↔
+    { 15, 28, 20, 4, 27, 105, 74694 }, // ↕
+    { 17, 12, 20, -2, 11, 51, 74799 }, // ↖
+    { 17, 12, 16, 3, 11, 51, 74850 }, // ↗
+    { 14, 17, 16, 5, 15, 60, 74901 }, // ↘
+    { 14, 17, 16, -3, 15, 60, 74961 }, // ↙
+    { 20, 18, 24, 1, 16, 90, 75021 }, // ⇐
+    { 22, 20, 27, 5, 19, 110, 75111 }, // ⇑
+    { 21, 18, 24, 3, 16, 95, 75221 }, // ⇒
+    { 22, 20, 27, 10, 18, 110, 75316 }, // ⇓
+    { 26, 18, 27, 1, 16, 117, 75426 }, // ⇔
+    { 18, 25, 22, 6, 14, 113, 75543 }, // ⇕
+    { 20, 22, 17, 1, 21, 110, 75656 }, // ∂
+    { 27, 26, 28, 0, 24, 176, 75776 }, // ∅
+    { 20, 20, 22, 1, 19, 100, 75952 }, // ∆
+    { 19, 20, 18, 3, 19, 95, 76052 }, // ∏
+    { 20, 19, 18, 7, 18, 95, 76147 }, // ∐
+    { 18, 20, 15, 1, 19, 90, 76242 }, // ∑
+    { 14, 4, 15, 2, 9, 14, 76332 }, // −
+    { 25, 23, 24, 3, 21, 144, 76346 }, // √
+    { 23, 14, 23, 2, 16, 81, 76490 }, // ∞
+    { 26, 27, 21, 0, 20, 176, 76571 }, // ∫
+    { 10, 17, 8, 1, 17, 43, 76747 }, // ∶
+    { 18, 14, 36, 13, 14, 63, 76790 }, // ≈
+    { 23, 22, 32, 5, 20, 127, 76853 }, // ≠
+    { 24, 21, 20, -3, 18, 126, 76980 }, // ≤
+    { 24, 22, 22, 0, 19, 132, 77106 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
@@ -5503,4 +3243,9 @@ static const EpdFontData opendyslexic_12_bolditalic = {
     33,
     -13,
     true,
+    opendyslexic_12_bolditalicBlockOffsets,
+    opendyslexic_12_bolditalicDirectGlyphs,
+    opendyslexic_12_bolditalicGlyphPages,
+    35,
+    opendyslexic_12_bolditalicPageGlyphs,
 };
@@ -2,3981 +2,2190 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_italic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_italicBitmaps[63484] = {
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x83, 0xFC, 0x1F, 0xE0,
-    0xBF, 0x43, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xF4, 0x2F, 0xC0, 0xFE, 0x07, 0xF4, 0x3F, 0xC0, 0xFE,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xBF, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0x4F, 0x05, 0x00, 0x00, 0x7F, 0xB8, 0x38, 0x00, 0x00, 0x03, 0xF9, 0xD1, 0xD0, 0x00,
-    0x00, 0x0F, 0xCB, 0x0B, 0x00, 0x00, 0x00, 0x7F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFB,
-    0xFF, 0xF8, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0xF4, 0x00, 0x00, 0x0E, 0x0E, 0xFF, 0xF0, 0x00, 0x00,
-    0x74, 0x77, 0xFF, 0xC0, 0x00, 0x02, 0xC2, 0xEF, 0xFF, 0x00, 0x3F, 0xAF, 0xAF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80,
-    0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xBE, 0x00, 0x01, 0xE0, 0x03, 0xD7, 0xC0, 0x03,
-    0x80, 0x0E, 0x00, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0xC0, 0x3C, 0x00, 0x2C, 0x01, 0xC0, 0xB4, 0x00,
-    0x28, 0x03, 0x82, 0xE0, 0x00, 0x3D, 0x1B, 0x47, 0x80, 0x00, 0x1F, 0xFE, 0x1F, 0x00, 0x00, 0x0B,
-    0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x38, 0x00, 0x00, 0x0F,
-    0xC0, 0x2C, 0x00, 0x00, 0x2F, 0x80, 0x28, 0x00, 0x00, 0xBF, 0x40, 0x34, 0x00, 0x01, 0xF3, 0x91,
-    0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xC0, 0x00, 0x0F, 0x40, 0xBE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0xBD,
-    0x00, 0x10, 0x1F, 0xE0, 0x2F, 0x40, 0xBD, 0x3F, 0xC0, 0x0F, 0xC1, 0xFC, 0x7F, 0x80, 0x03, 0xF7,
-    0xF4, 0xBF, 0x40, 0x00, 0xFF, 0xD0, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xF9, 0x6F, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFB, 0xC0, 0x0F, 0xFF, 0xFF, 0x82, 0x40, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x1F, 0xC0, 0x3F, 0x40, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB0, 0x04, 0x38, 0x3C, 0x2D, 0x2F, 0xCE, 0x7D,
-    0x00, 0xBF, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0xD0, 0x7E, 0x38, 0xBD, 0x1D, 0x0D, 0x06,
-    0x00, 0x0B, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF0, 0x00, 0x78,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x55,
-    0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0x1A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF2, 0xF8, 0xFE, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xF4, 0x1E, 0x00, 0x00, 0xF0, 0x02, 0xC0,
-    0x00, 0xF4, 0x00, 0x78, 0x00, 0xBC, 0x00, 0x1E, 0x00, 0x3D, 0x04, 0x07, 0x80, 0x2F, 0x0B, 0x82,
-    0xE0, 0x0F, 0x83, 0xE0, 0xF4, 0x07, 0xD0, 0xF4, 0x3C, 0x02, 0xF0, 0x3C, 0x2F, 0x00, 0xFC, 0x08,
-    0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0xFF,
-    0xAF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3D,
-    0xF8, 0x00, 0x04, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x15, 0xFE, 0x94, 0x1F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0x90, 0x7F, 0x00,
-    0x01, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF9, 0x69, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x0B, 0xFA, 0xFD,
-    0x00, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xAF, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x0B,
-    0xCF, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0xBC, 0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x0B, 0xC0, 0x7D, 0x02,
-    0xF9, 0x5F, 0xE5, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xAB, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x01, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x1F, 0xC0, 0x08, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x9B, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0x40, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF0, 0x03,
-    0xD0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x3F, 0x95, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD6,
-    0xAF, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0xF9, 0x1F, 0x00,
-    0x01, 0xF0, 0x01, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0F,
-    0x80, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0xFD, 0x6F, 0xD0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x2F, 0xD0, 0x7E, 0x00, 0x2F, 0x80, 0x0B, 0xC0, 0x0F, 0x80, 0x01, 0xF4, 0x0B, 0xD0,
-    0x00, 0x7D, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x2F, 0xFA, 0xBF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xEF, 0xE0,
-    0x00, 0xBC, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0xF8, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0x80, 0x00, 0xF8, 0x0F, 0x40, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0xF0,
-    0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x47, 0xC0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x25, 0x55, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3F, 0x00, 0x2F,
-    0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
-    0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xFF, 0xFD, 0x07, 0xFF, 0xFA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xF4, 0x01,
-    0xBF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x01,
-    0xFD, 0x5B, 0xF8, 0x01, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x38, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x3E, 0x0B, 0xDC, 0x00, 0x38, 0x00,
-    0x2F, 0x0E, 0x1E, 0x00, 0x0E, 0x00, 0x0F, 0x4D, 0x03, 0x40, 0x03, 0x40, 0x0F, 0xC6, 0x00, 0xD0,
-    0x01, 0xC0, 0x03, 0xE2, 0x40, 0xB0, 0x00, 0xE0, 0x01, 0xF8, 0xE1, 0xBC, 0x00, 0xF0, 0x00, 0xBE,
-    0x3F, 0xFF, 0x01, 0xF4, 0x00, 0x2F, 0xC3, 0xF6, 0x9B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0x90,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00,
-    0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57,
-    0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0xAA, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xF8, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x00, 0x7F,
-    0x40, 0xBC, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04,
-    0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3E,
-    0x00, 0x1B, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xD0,
-    0x1F, 0x95, 0x5A, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFE, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF9,
-    0x00, 0x05, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0xFF, 0x4B, 0xF0, 0x00, 0x0A, 0xFF, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xA0, 0xBF, 0x00, 0x00, 0x07,
-    0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xEA, 0xAF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFA, 0xAA,
-    0xAF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x04, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xC1, 0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF4,
-    0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3,
-    0xFF, 0x40, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF,
-    0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xC0,
-    0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xEF, 0xF0,
-    0x02, 0xFF, 0xF4, 0x00, 0xBD, 0xFF, 0x40, 0x7F, 0x7F, 0x00, 0x0F, 0xCF, 0xF4, 0x0F, 0xEB, 0xF0,
-    0x00, 0xFC, 0xBF, 0x82, 0xFC, 0xFF, 0x00, 0x2F, 0xC7, 0xF8, 0x7F, 0x4F, 0xE0, 0x03, 0xF8, 0x7F,
-    0xCF, 0xE2, 0xFD, 0x00, 0x3F, 0x43, 0xFE, 0xFC, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xFF, 0x43, 0xFC,
-    0x00, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0xC0, 0x0F, 0xF0, 0x3F, 0xFC, 0x0F, 0xF8, 0x01, 0xFE, 0x02,
-    0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x2F, 0xF0, 0x2F, 0xF0, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD, 0x00,
-    0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00,
-    0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1,
-    0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0,
-    0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00,
-    0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00,
-    0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xD5, 0x5F, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0xFD, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x02,
-    0xF4, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0xD0, 0x3F, 0x80, 0x0B,
-    0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x0F,
-    0x00, 0x07, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07,
-    0xF0, 0x00, 0x7C, 0x00, 0xBF, 0x40, 0x03, 0xFA, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0,
-    0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFE,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE,
-    0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x01, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F,
-    0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFE,
-    0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF4,
-    0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x3F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00,
-    0xBF, 0x8F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F,
-    0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F,
-    0xFC, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0x80, 0xFF, 0xFD, 0x03,
-    0xF4, 0x00, 0x3F, 0x82, 0xFD, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x87, 0xFC, 0xFF, 0x0F, 0xD0, 0x00,
-    0x3F, 0x8F, 0xF0, 0xFF, 0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0xD0, 0xBF, 0x7F, 0x40, 0x00, 0x3F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x7F,
-    0xC0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD3, 0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xAA, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x30, 0x70,
-    0xB0, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0xB8, 0xB8, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E,
-    0x3E, 0x3C, 0x34, 0x20, 0x00, 0x15, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x03, 0x80, 0x00, 0x7E, 0x00, 0x0F, 0xB8, 0x03, 0xD0, 0xF0, 0xB0, 0x01, 0xD0,
-    0x05, 0x55, 0x55, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00,
-    0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B,
-    0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7,
-    0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0B, 0xC2, 0xF9, 0x00, 0x3F, 0xBF, 0xFD, 0x00, 0xFF, 0xE5, 0xBD, 0x07, 0xFC,
-    0x00, 0xB8, 0x2F, 0xC0, 0x01, 0xF0, 0xFE, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0xF8, 0x7E, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0xFE, 0x0B, 0xFE, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFD, 0x04, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x69, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x00, 0x1F, 0xFF, 0xEF, 0x80, 0x00, 0x7E, 0x02,
-    0xFF, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0xFD,
-    0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0x40, 0x02, 0xF8, 0x00, 0x1F, 0x40, 0x07, 0xF4, 0x00,
-    0x1F, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0,
-    0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x2F, 0xFF, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x80,
-    0x00, 0xBF, 0xFD, 0xBC, 0x00, 0x2F, 0xAB, 0xFF, 0x80, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0xF4, 0x00,
-    0xFF, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x00, 0xFD, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x03,
-    0x80, 0x03, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF9, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x18, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0,
-    0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40,
-    0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C,
-    0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0xBD, 0x00,
-    0xF4, 0xBD, 0x00, 0xBC, 0xBD, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0xFB, 0xF8, 0x00, 0x7D, 0xBF, 0x40, 0x3F, 0x0F, 0xF0, 0x0F, 0xC2, 0xFF, 0x07,
-    0xE0, 0x3F, 0xE2, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03,
-    0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0xA4, 0x07, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0x2D, 0x2F, 0xE0, 0x0B,
-    0xF4, 0x00, 0x0F, 0x7F, 0xFF, 0x0F, 0xFF, 0x40, 0x07, 0xFE, 0x5F, 0xDF, 0xEB, 0xE0, 0x03, 0xFC,
-    0x00, 0xFF, 0x40, 0x78, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x1E, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B,
-    0x80, 0x3F, 0x00, 0x07, 0xD0, 0x03, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xF0, 0x0F, 0xC0, 0x01,
-    0xF4, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x3E, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x40, 0x0B, 0xD0,
-    0x01, 0xFC, 0x00, 0x00, 0x74, 0xAF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01,
-    0xFC, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B,
-    0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F,
-    0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xBF, 0x80, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D,
-    0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x01,
-    0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x40, 0xAE, 0x40, 0x00, 0x02, 0xE7, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xD1, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x78, 0x00, 0x03, 0xF4, 0x00, 0x78,
-    0x00, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x0B, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00,
-    0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0xFE, 0x6F, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x01, 0xF4, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x05,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0xBC, 0x00, 0x2F, 0xEF, 0xCF, 0x80, 0x0B, 0xD0,
-    0x1F, 0xF0, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x0B, 0xC0, 0x01, 0xFC, 0x00,
-    0xF4, 0x00, 0x2F, 0x80, 0x0F, 0x00, 0x03, 0xF4, 0x01, 0xF0, 0x00, 0xBF, 0x00, 0x1F, 0x00, 0x2F,
-    0xE0, 0x00, 0xFE, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xB8, 0x00, 0x00,
-    0xBF, 0x8B, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x6D, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x2B, 0x00, 0x1F, 0xBF, 0xC0, 0x0B, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xA0, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x7E, 0x00, 0x7E, 0xAB, 0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x6B, 0xFA, 0x97, 0xFF, 0xFF, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD5, 0x00, 0xBF, 0xFD,
-    0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x1F, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00,
-    0xBC, 0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC, 0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x29, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x03, 0xD0,
-    0x1F, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x2F, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0F, 0xC0, 0xF8, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x00,
-    0x01, 0xF8, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0xE0, 0x0F,
-    0xC0, 0x3E, 0x03, 0xF4, 0x1F, 0x40, 0x7E, 0x0F, 0xF8, 0x3F, 0x00, 0x7E, 0x3F, 0xFC, 0xBD, 0x00,
-    0x7E, 0xFF, 0xFE, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x07, 0xE0, 0x7D, 0x00, 0x00, 0x3F, 0x2F, 0x40,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x7F, 0x40, 0xFE, 0x00, 0x1F, 0xD0, 0x0B, 0xF0, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x07, 0xD0,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0xBD, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x5F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1A,
-    0xA0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00,
-    0x74, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x40,
-    0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07,
-    0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02,
-    0xA9, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x1A, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x00,
-    0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2C, 0x00, 0x01,
-    0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFB, 0xC0, 0x02, 0xF4, 0xF0, 0x00, 0xF8, 0x38, 0x00, 0x7C,
-    0x2C, 0x00, 0x3E, 0x0F, 0x00, 0x0F, 0x43, 0x80, 0x07, 0xD1, 0xD0, 0x01, 0xF8, 0xF0, 0x00, 0x7F,
-    0xB8, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x41, 0xF4, 0x00, 0x1F,
-    0xC0, 0x00, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x5B, 0xD5, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0x94, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x02, 0xC0,
-    0x2F, 0xFF, 0xBF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0xF8, 0x0B, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x3D,
-    0x00, 0xBC, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x7F, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xF8, 0x1F, 0x9F, 0xEB, 0xE0, 0x24, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xF4, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x80,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x00, 0xE0,
-    0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00,
-    0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F,
-    0xAB, 0xC0, 0x00, 0x01, 0xD0, 0x02, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3E,
-    0x40, 0x1B, 0xD0, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x01,
-    0xF0, 0x00, 0xBF, 0xF5, 0x6F, 0x80, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x19, 0x55, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x2F, 0x80, 0xBE, 0x3F, 0x80, 0xFD, 0x7F, 0x42, 0xFD,
-    0x00, 0x1A, 0x00, 0x0A, 0x42, 0x40, 0xAB, 0x02, 0x07, 0xC0, 0x05, 0x39, 0x00, 0x14, 0xB0, 0x00,
-    0x82, 0xD0, 0x02, 0x09, 0xF4, 0x30, 0x18, 0x0B, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x80, 0x74, 0xF0, 0x30, 0x1C, 0x18, 0x0A, 0x09, 0x03, 0x83, 0x43, 0xD0, 0xFF, 0xF4, 0x0F, 0xDC,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x01, 0xD0, 0x01, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x07, 0xD0,
-    0x07, 0xE0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x0B, 0x80, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0D, 0x00, 0x1D, 0x00,
-    0x01, 0x00, 0x01, 0x00, 0x3F, 0xA9, 0x50, 0x0F, 0xFF, 0xFF, 0xC1, 0x55, 0x6B, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x1A, 0x00, 0x0B, 0x42, 0x40, 0xBA, 0x02,
-    0x06, 0x82, 0x05, 0x32, 0x10, 0x14, 0x9F, 0x80, 0xC2, 0x93, 0x07, 0x0B, 0x1C, 0x30, 0x1C, 0x0B,
-    0x00, 0x1B, 0x90, 0x00, 0x01, 0x55, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0x80, 0xF4, 0x0F, 0x40, 0x1F, 0x0B, 0xC0, 0x07, 0xC3,
-    0xE0, 0x02, 0xE0, 0xF8, 0x01, 0xF4, 0x3F, 0x42, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00,
-    0x06, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x55, 0xBD, 0x54, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x6A, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x41, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xBF,
-    0xE0, 0x2A, 0xA4, 0x00, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x05, 0x00, 0x1C, 0x03, 0xF0, 0x00, 0x38,
-    0x00, 0x28, 0x00, 0x74, 0x7F, 0xF0, 0x6E, 0x40, 0x00, 0xE0, 0x3C, 0x0B, 0x41, 0xE0, 0x3C, 0x00,
-    0x00, 0x0F, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x2F, 0x00,
-    0x1F, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1D, 0xFF, 0xFF, 0xFC, 0x02, 0xC7, 0xFF, 0xDF, 0x80, 0x38,
-    0x05, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x41, 0xD0, 0x00, 0xFF, 0xC0, 0xB0, 0x00, 0xBF, 0xF0, 0x3C, 0x00, 0x3F,
-    0xF4, 0x0E, 0x00, 0x2F, 0xFC, 0x07, 0x40, 0x0B, 0xFF, 0x02, 0xC0, 0x02, 0xFF, 0x40, 0xF0, 0x00,
-    0x3F, 0xC0, 0x38, 0x00, 0x07, 0xF0, 0x1D, 0x00, 0x02, 0xF4, 0x0B, 0x00, 0x00, 0xFC, 0x03, 0xC0,
-    0x00, 0xBF, 0x00, 0xE0, 0x00, 0x3F, 0x40, 0x74, 0x00, 0x2F, 0xC0, 0x2D, 0x00, 0x0F, 0xF0, 0x0F,
-    0x00, 0x07, 0xF4, 0x03, 0xC0, 0x03, 0xFC, 0x01, 0xE0, 0x01, 0xFE, 0x00, 0xB4, 0x00, 0xFF, 0x40,
-    0x3C, 0x00, 0x7F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0xD1, 0xFC, 0x3F, 0xC0, 0x02,
-    0x00, 0x20, 0x01, 0xE4, 0x00, 0x24, 0x00, 0x90, 0x5F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0xC0, 0x1C, 0x02, 0x80, 0x34, 0x07, 0x00, 0xB0, 0xBF, 0xEA, 0xA8, 0x01, 0xFC, 0x02, 0xD2, 0xC0,
-    0xC0, 0x30, 0xA0, 0x0C, 0x34, 0x07, 0x0E, 0x07, 0x42, 0xFF, 0x80, 0x2F, 0x40, 0x40, 0x00, 0x40,
-    0x00, 0x1D, 0x00, 0x1D, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x00, 0xF8,
-    0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xF4, 0x02,
-    0xFC, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x09, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0xB0,
-    0x00, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x01, 0xE0, 0x00, 0x1D, 0x00, 0x02, 0xD0, 0x00,
-    0x78, 0x00, 0x17, 0xD4, 0x00, 0xF0, 0x00, 0x7F, 0xFE, 0x03, 0xC0, 0x00, 0xBF, 0xFD, 0x0F, 0x00,
-    0x74, 0x00, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x00, 0xB4, 0x07, 0xF0, 0x00, 0x01, 0xE0, 0x1E, 0xA0,
-    0x00, 0x07, 0xC0, 0x78, 0xE0, 0x00, 0x1F, 0x01, 0xE1, 0xD0, 0x00, 0x3C, 0x07, 0xC2, 0xD4, 0x00,
-    0xF4, 0x0B, 0xFF, 0xF8, 0x03, 0xE0, 0x06, 0xAB, 0xD0, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x2F, 0x00,
-    0x00, 0x0F, 0x40, 0x14, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x04, 0x00, 0x03, 0x80, 0x00, 0x02, 0xC0, 0x00, 0x74,
-    0x00, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x0E,
-    0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x38, 0x00, 0x01, 0x7D, 0x40, 0x0F, 0x05, 0x00, 0x7F,
-    0xFE, 0x03, 0xDF, 0xFE, 0x0B, 0xFF, 0xD0, 0xF2, 0x90, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x03, 0x40,
-    0x00, 0x0B, 0x80, 0x00, 0x74, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xD0,
-    0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0xF4, 0x00, 0xBF, 0x40,
-    0x00, 0x3E, 0x00, 0x2F, 0xE5, 0x40, 0x0B, 0x80, 0x03, 0xFF, 0xF8, 0x02, 0xF0, 0x00, 0x7F, 0xFF,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00,
-    0x0E, 0x00, 0x15, 0xB0, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0x00, 0x0B,
-    0x00, 0x00, 0x02, 0xC0, 0x07, 0x40, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x00, 0xB4, 0x03, 0x80,
-    0x00, 0xFF, 0xFC, 0x03, 0xC0, 0x00, 0xBF, 0xF8, 0x03, 0xC0, 0x1D, 0x01, 0x50, 0x03, 0xD0, 0x1F,
-    0x00, 0x00, 0x02, 0xD0, 0x1F, 0xC0, 0x00, 0x02, 0xE0, 0x1E, 0xA0, 0x00, 0x01, 0xF0, 0x1E, 0x38,
-    0x00, 0x01, 0xF0, 0x1E, 0x1D, 0x00, 0x00, 0xF0, 0x1F, 0x0B, 0x50, 0x00, 0xF4, 0x0B, 0xFF, 0xF8,
-    0x00, 0xF8, 0x01, 0xAA, 0xF4, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x14, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x02, 0x40, 0x1F, 0xE0, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55,
-    0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x55, 0x55, 0xFE, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0xB0, 0x00, 0x00, 0x02, 0x80, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00,
-    0x1F, 0x47, 0xD0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x07,
-    0xD0, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0C, 0x00, 0x00, 0x00, 0x75, 0xC1, 0xC0, 0x00, 0x00,
-    0x0F, 0x0B, 0xB8, 0x00, 0x00, 0x00, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x55, 0x55, 0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x03,
-    0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00,
-    0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xD5, 0x55,
-    0x5F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0x45, 0x00, 0x00,
-    0x00, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01,
-    0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD7,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00,
-    0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xAA, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xE5, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xAA, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x07,
-    0x41, 0xE0, 0x00, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00,
-    0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2E, 0xB4, 0x00, 0x07, 0x81, 0xE0, 0x00, 0xD0, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x2F, 0x80, 0x3F, 0x80, 0xFE,
-    0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x06, 0xFF, 0x40, 0x00,
-    0x7D, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x82, 0xAF, 0xEA, 0x90, 0x00,
-    0xFE, 0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x0B, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xE5,
-    0x55, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xC0, 0x00, 0x00, 0x00, 0xB7, 0x82, 0x80, 0x00, 0x00, 0x00,
-    0xE1, 0xC7, 0x40, 0x00, 0x00, 0x01, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F,
-    0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F,
-    0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF8, 0x00, 0x0F,
-    0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0,
-    0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55,
-    0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00,
-    0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x03, 0x00, 0x00, 0x00, 0x02, 0xD7, 0x4B,
-    0x00, 0x00, 0x00, 0x03, 0x82, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F,
-    0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F,
-    0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x3E,
-    0x2E, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x01, 0xFD, 0xFC, 0x02, 0xF8,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x5B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x56, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x54, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x54, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x40,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x7F,
-    0x40, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00,
-    0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x55, 0x40, 0x07,
-    0xF8, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
-    0x03, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40,
-    0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0x54, 0x00, 0x1F, 0xE0, 0x00, 0x0F,
-    0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00,
-    0xBF, 0x07, 0xF0, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0xFD, 0x7F, 0xC0, 0x00, 0xF4, 0x07, 0xF0, 0x01, 0xF0, 0x01, 0xF4, 0x02,
-    0xF0, 0x00, 0xB4, 0x03, 0xE0, 0x00, 0xB4, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xC0, 0x0B, 0xD0, 0x0B,
-    0xC0, 0x7F, 0x80, 0x0F, 0xDB, 0xFD, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x00,
-    0x34, 0x00, 0x0F, 0x00, 0x03, 0x40, 0x01, 0xE0, 0x01, 0xB4, 0x00, 0x3D, 0x01, 0xF9, 0x00, 0x03,
-    0xC0, 0x78, 0x00, 0x00, 0x7C, 0x0B, 0x00, 0x00, 0x0B, 0x80, 0xE0, 0x00, 0x00, 0xF4, 0x0F, 0x00,
-    0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0,
-    0x00, 0x3C, 0x00, 0xBD, 0x00, 0x03, 0xC0, 0x0F, 0xC4, 0x00, 0xFC, 0x00, 0xFC, 0xFF, 0xFF, 0x40,
-    0x2F, 0x8F, 0xFF, 0xD0, 0x03, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00,
-    0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03,
-    0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00,
-    0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03,
-    0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x02, 0x80, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE2, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0,
-    0x03, 0xC0, 0x00, 0xFC, 0x01, 0xE0, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x7C, 0x00, 0x0B, 0xFE, 0x1F, 0x00, 0x00, 0x00,
-    0xF8, 0x0E, 0x00, 0x03, 0xDD, 0x0D, 0x00, 0x07, 0x0B, 0x2C, 0x00, 0x0F, 0x03, 0xF4, 0x00, 0x04,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E,
-    0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00,
-    0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x2F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xB0,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0xBF, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x40, 0x03,
-    0xE0, 0x07, 0xC0, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x78, 0x00,
-    0x2F, 0xC0, 0x2F, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xDF, 0x00, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x28, 0x30,
-    0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x2C, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4,
-    0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0, 0x2F, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0, 0x02, 0xFF, 0x87, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F, 0xE2, 0xDF, 0xFB, 0xE0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x03, 0x40, 0x07, 0xE0, 0x2F, 0xF4, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0xFE, 0x00, 0x07,
-    0xC0, 0x3D, 0x00, 0x0F, 0xEA, 0xFF, 0xFC, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00,
-    0x1F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x56, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x87, 0xC7, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFD, 0x04, 0x02,
-    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x70, 0x00,
-    0x0B, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00,
-    0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x03,
-    0xF4, 0x03, 0x80, 0x02, 0xE0, 0x00, 0xB0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0xFA, 0xBF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0x40, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xBD, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x03, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x0F, 0xD0, 0x0E,
-    0x00, 0x0B, 0x80, 0x02, 0xC0, 0x0B, 0x80, 0x01, 0xF0, 0x03, 0xEA, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x01, 0xFC,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0x80, 0x00, 0xB8, 0x00, 0x2C, 0x00, 0x2E,
-    0x00, 0x07, 0xC0, 0x03, 0xEA, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0x95, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0x56, 0xD0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0x90, 0x00,
-    0x01, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0xB8, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xEF, 0x00, 0x0B, 0x42, 0xD0, 0x1C, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0xFC, 0x07,
-    0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x06, 0xAB, 0xEA, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0x00,
-    0x00, 0x07, 0xFF, 0xF1, 0xE0, 0x00, 0x02, 0xF8, 0x0B, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xD0,
-    0x00, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0xD5, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0xC0, 0x00, 0x07, 0xAC, 0x2C, 0x00, 0x00, 0xE0, 0xEB, 0x40, 0x00, 0x1D, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4A, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xF9, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFD, 0x57, 0xF0, 0x01,
-    0xF4, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x3F, 0xFB, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFD,
-    0x57, 0xF0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x7F, 0x00,
-    0x3F, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07,
-    0x82, 0xD0, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0,
-    0x07, 0xD0, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x07,
-    0xC0, 0x3D, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x01, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0xEF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xA0, 0x00, 0x0F, 0x38, 0x34, 0x00, 0x07, 0x07, 0xBC,
-    0x00, 0x02, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFD,
-    0x57, 0xF0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x7F, 0x00,
-    0x3F, 0xFB, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0xBF, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x03, 0xD0,
-    0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0xFC, 0x01, 0xF0, 0x00,
-    0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1B, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x5F, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x2E, 0x3C, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x3D, 0x00, 0x00,
-    0x07, 0xC0, 0xF4, 0x3C, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0xFC,
-    0x00, 0x00, 0x1F, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0x1F, 0x4F, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x3E, 0x07, 0xC0, 0x00, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0xF8,
-    0x1F, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x0B, 0xE0, 0x3F,
-    0x00, 0xBF, 0x80, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0x7E, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3F, 0x03, 0xD0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xFC, 0x0F, 0x80, 0x0B,
-    0xE0, 0x3F, 0x00, 0xBF, 0x80, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0x7E, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFB, 0xC0, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x0F, 0x81, 0xF0, 0x00, 0x3D, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00, 0x0F, 0xC0, 0xF4, 0x00,
-    0x3E, 0x07, 0xC0, 0x01, 0xF4, 0x1F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x02, 0xF8,
-    0x0F, 0xC0, 0x2F, 0xE0, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xDF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x2F, 0x40, 0xFD, 0x00,
-    0x3F, 0x41, 0xFC, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F,
-    0x80, 0x03, 0xF0, 0x0F, 0x40, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x7E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x40,
-    0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x07,
-    0xE2, 0xF4, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0x0B, 0xE0, 0x00,
-    0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x74, 0x02, 0xE0,
-    0x02, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x01, 0xF4, 0x01, 0xF0, 0x1F, 0x80, 0x0B, 0x82, 0xF8,
-    0x00, 0x3E, 0xBF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00,
-    0x1F, 0x40, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0,
-    0x00, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x7E,
-    0x00, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x55,
-    0x57, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2,
-    0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00,
-    0x0F, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0xFC, 0x01, 0xE0,
-    0x00, 0xBF, 0x00, 0xBC, 0x00, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0x7C, 0x00, 0x0B, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x50, 0x00, 0x00,
-    0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x55, 0x55,
-    0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x03, 0x80, 0x00, 0xBD, 0x5B, 0xC0,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xE0,
-    0x2F, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xF0,
-    0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x1E, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x0F, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF7, 0xC0, 0x00, 0xBF, 0xE1, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01,
-    0xF4, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0xF8,
-    0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B, 0xF0,
-    0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7, 0xC0,
-    0x02, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xFA, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xB8, 0x00, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00,
-    0x00, 0xD0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x03, 0xC1, 0xE0, 0x00, 0x03, 0x80, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x40, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFE, 0x96, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B,
-    0xFF, 0xE0, 0x0F, 0xF4, 0x10, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF,
-    0x41, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x07, 0x40, 0x00, 0x00, 0x0B,
-    0x47, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x01, 0xBF, 0xD0, 0x00,
-    0x7D, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x1F, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF8,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x0B, 0xFD, 0x01, 0xF9, 0x55, 0xAF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xB4, 0x00, 0x00, 0x69, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x50, 0x00, 0x1F, 0xFF,
-    0xEF, 0x80, 0x00, 0x00, 0x7E, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x06, 0xFF, 0x40, 0x00, 0x7D,
-    0x00, 0x00, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x82, 0xAF, 0xEA, 0x90, 0x00, 0xFE,
-    0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x0B, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xE5, 0x55,
-    0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0A,
-    0xAF, 0xEA, 0x40, 0x00, 0x06, 0x90, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xEF, 0x80, 0x00, 0x01, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xEA,
-    0x90, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x38, 0x00, 0x0B, 0x80, 0x02,
-    0xC0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x3E, 0xAF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xF9,
-    0x54, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x95, 0x6D, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x00, 0x1F,
-    0x96, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xEA, 0x90, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x95, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x1D,
-    0x00, 0x1C, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFB, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0x80, 0x00, 0xB8, 0x00, 0x2C, 0x00, 0x2E, 0x00, 0x07,
-    0xC0, 0x03, 0xEA, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0x95, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40,
-    0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFA, 0xA4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8,
-    0x00, 0x2C, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9,
-    0x56, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x80,
-    0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xEA, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0xB4, 0x07, 0x40, 0x00, 0x0B, 0x4F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFB,
-    0xF0, 0x00, 0x0F, 0xD0, 0x0E, 0x00, 0x0B, 0x80, 0x02, 0xC0, 0x0B, 0x80, 0x01, 0xF0, 0x03, 0xEA,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00,
-    0x00, 0x00, 0xB0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFE, 0x40, 0x01, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x69,
-    0x40, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x2F, 0xC0, 0x00, 0x2B, 0xFF, 0x42, 0xFC, 0x00, 0x00,
-    0x0F, 0xA0, 0x2F, 0xC0, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xAA,
-    0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x07, 0x41, 0xE0, 0x00, 0x00, 0x34, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xA0, 0x00,
-    0x0B, 0xFF, 0xDB, 0xC0, 0x00, 0xBE, 0xAF, 0xFE, 0x00, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x3D, 0x00,
-    0x3F, 0xC0, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0xC0,
-    0x00, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x06, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x00, 0x02, 0xE0, 0x0B, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFE, 0x40, 0x01, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x69,
-    0x40, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x2F, 0xC0, 0x00, 0x2B, 0xFF, 0x42, 0xFC, 0x00, 0x00,
-    0x0F, 0xA0, 0x2F, 0xC0, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xAA,
-    0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0E,
-    0x00, 0x2C, 0x00, 0x00, 0xF9, 0x5F, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x28, 0x00, 0x0B, 0xFF, 0xDB, 0xC0, 0x02, 0xFA, 0xBF, 0xF8, 0x00,
-    0x7C, 0x01, 0xFF, 0x40, 0x0F, 0x40, 0x0F, 0xF0, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x3C, 0x00, 0x0F,
-    0xD0, 0x03, 0xC0, 0x01, 0xFC, 0x00, 0x38, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x9B, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF9, 0x00, 0x05, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0x4B, 0xF0,
-    0x00, 0x0A, 0xFF, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xA0, 0xBF, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0xF0,
-    0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xEA, 0xAF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x80, 0x00, 0xBF, 0xFD, 0xBC, 0x00, 0x2F, 0xAB, 0xFF, 0x80,
-    0x07, 0xC0, 0x1F, 0xF4, 0x00, 0xF4, 0x00, 0xFF, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x00,
-    0xFD, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x03, 0x80, 0x03, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF9, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x18, 0x07, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xF9, 0x00, 0x05, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0x4B, 0xF0, 0x00, 0x0A, 0xFF, 0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xA0,
-    0xBF, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xEA, 0xAF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x28, 0x00, 0x0B, 0xFF, 0xDB, 0xC0, 0x02, 0xFA, 0xBF, 0xF8, 0x00, 0x7C, 0x01, 0xFF, 0x40, 0x0F,
-    0x40, 0x0F, 0xF0, 0x01, 0xE0, 0x00, 0xFE, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x03, 0xC0, 0x01, 0xFC,
-    0x00, 0x38, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x9B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x81,
-    0xF0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xAA, 0xAA, 0xFF, 0x80, 0x0B,
-    0xF4, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xEE, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x2C, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC,
-    0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4,
-    0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0,
-    0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xF5, 0x55, 0x56,
-    0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xAA, 0xAA, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x81, 0x54, 0x00, 0x6F, 0xFF,
-    0xF4, 0x00, 0xBF, 0xA5, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19,
-    0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x00,
-    0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x0F,
-    0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0x00, 0x3C, 0xA0, 0xD0,
-    0x07, 0x43, 0xAC, 0x00, 0xB0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0D, 0x07, 0x4E, 0x2C, 0x0F, 0x07, 0xF4, 0x0A, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4,
-    0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7A, 0x40, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x01, 0xF0, 0x0B,
-    0x80, 0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3F, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x01,
-    0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00,
-    0xBE, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0xF8,
-    0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x01,
-    0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x07, 0xF0,
-    0x00, 0x2F, 0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x1F, 0xC0, 0x00,
-    0xBF, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xD0, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x0A, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x07, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x00, 0x07, 0x41, 0xE0, 0x00,
-    0x00, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xC1,
-    0xE0, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x03,
-    0xF0, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xC1,
-    0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B,
-    0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x40, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xC0,
-    0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0xBD, 0x00, 0xF4, 0xBD, 0x00, 0xBC, 0xBD, 0x00,
-    0x3E, 0xBD, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFB, 0xF8, 0x00,
-    0x7D, 0xBF, 0x40, 0x3F, 0x0F, 0xF0, 0x0F, 0xC2, 0xFF, 0x07, 0xE0, 0x3F, 0xE2, 0xF4, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0xB4, 0x3D, 0x00, 0xF0, 0xF4,
-    0x01, 0xE2, 0xE0, 0x02, 0xDB, 0x80, 0x03, 0xDF, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x3D, 0xBE, 0x00, 0x3C, 0x3F, 0x40, 0x78, 0x3F, 0xC0, 0xF4, 0x1F,
-    0xE0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xA4, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x90, 0x07, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0x40, 0x05, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0xBD, 0x00, 0x3C,
-    0x00, 0xFC, 0x00, 0xB8, 0x01, 0xFC, 0x00, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x0F, 0x00,
-    0x03, 0xE0, 0x7C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0xBC, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x0B,
-    0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x02, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0B, 0xD0, 0x0F, 0x80,
-    0xFC, 0x00, 0xF4, 0x2F, 0xC0, 0x2F, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0xA4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFB, 0xFE, 0x50, 0x01, 0x6B, 0xFF, 0xD4, 0x00, 0x02,
-    0xFF, 0x94, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02,
-    0xA4, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xFE, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0xBF,
-    0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0x01, 0xFD, 0x2F, 0x80, 0xBE, 0x00,
-    0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2,
-    0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0,
-    0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4A, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0x91, 0xF4, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xD0,
-    0x07, 0xD0, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x1F,
-    0x80, 0x2F, 0x80, 0x0B, 0xE0, 0x0F, 0xD0, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xFC, 0x02, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE,
-    0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00,
-    0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3,
-    0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0,
-    0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xAF, 0x80,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8,
-    0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
-    0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0,
-    0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00,
-    0x02, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2,
-    0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0,
-    0x07, 0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x01,
-    0x40, 0x00, 0x78, 0x07, 0x80, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4A, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0x91, 0xF4, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xD0,
-    0x07, 0xD0, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x1F,
-    0x80, 0x2F, 0x80, 0x0B, 0xE0, 0x0F, 0xD0, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0xFC, 0x02, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x86, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xF9, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x0B, 0x80, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x3F,
-    0x40, 0x3F, 0x40, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0xBF, 0x00, 0x02,
-    0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xD2, 0xFC,
-    0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x0F, 0xF0, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xF0, 0x07,
-    0xFB, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0xAF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x91, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x02,
-    0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F,
-    0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x2F, 0x80, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xD0, 0x7F,
-    0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF,
-    0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xBF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0,
-    0x01, 0xF4, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00,
-    0x07, 0xC0, 0x0F, 0x40, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00,
-    0xFF, 0xEF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x07, 0x40, 0x00, 0x00,
-    0x03, 0xE5, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x40, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x02, 0xE0, 0x0B, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x01, 0xF4, 0x00, 0x7C, 0x00,
-    0x3E, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00,
-    0xFC, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x15, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x54, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x55, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x01,
-    0xF0, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xFE, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xD1, 0xAA, 0xAB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0x56, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x6F, 0xFF, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x0A,
-    0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x1F, 0xD0, 0x3C, 0x00, 0x2F, 0xD5, 0x7F, 0xF4,
-    0x00, 0x74, 0x01, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x6B, 0xFF, 0x80,
-    0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xE0, 0x00, 0x1F, 0xA9, 0x54, 0x00, 0x0F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xF5, 0x57, 0x80, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xF0, 0x00,
-    0xFC, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x1F, 0x00,
-    0x03, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x2F, 0xD0, 0x00, 0xFE, 0xAF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF8,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x1F,
-    0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0xBF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0xAC, 0x00, 0x7E, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0x07, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00,
-    0x07, 0xF0, 0x00, 0x7C, 0x00, 0xBF, 0x40, 0x03, 0xFA, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x7F,
-    0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x0F,
-    0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC2, 0xB0, 0x00, 0x1F, 0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0x00, 0x00, 0x03,
-    0xD1, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0x07, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07, 0xF0,
-    0x00, 0x7C, 0x00, 0xBF, 0x40, 0x03, 0xFA, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x0F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x78, 0x1E, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAC, 0x00, 0x7E, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFA, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0xA0, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xE4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x90,
-    0x01, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x17, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x04, 0x00, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x0D, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xEA,
-    0xBF, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0xBF, 0xFF, 0x40,
-    0x0B, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0xAB,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x90, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0xF8, 0x01, 0xFA, 0xAF, 0xD0, 0x2F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF4, 0x01,
-    0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE,
-    0xFE, 0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x6B, 0xFA, 0x97, 0xFF, 0xFF, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xD5, 0x00, 0xBF, 0xFD, 0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x01, 0xE4, 0x00, 0x00, 0x24, 0x00,
-    0x01, 0xD0, 0x01, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0,
-    0xF0, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x3E, 0x0F, 0x40, 0x07, 0xD0, 0x50, 0x00, 0xBC,
-    0x00, 0x01, 0xAF, 0xEA, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF5, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE,
-    0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x06, 0xAF, 0xFA, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x6B, 0xFA, 0x90,
-    0x7F, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x0A, 0xAF, 0xEA, 0x4B, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD5, 0x00,
-    0x0B, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0x2D, 0x74, 0xB0, 0x00, 0x00, 0x00, 0xE0, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x05, 0x54, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00,
-    0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0xD0, 0x01, 0xD3, 0x8B, 0x00, 0x0F, 0x07, 0xF4, 0x00, 0x28, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x1F,
-    0x00, 0x03, 0xD0, 0xBC, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0, 0x7C, 0x00,
-    0x1F, 0x41, 0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC, 0x02, 0xFE,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD, 0xF8, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF8,
-    0x00, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F,
-    0x80, 0x03, 0xF0, 0x0F, 0x40, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xD0, 0x1F, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x7E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3E, 0x56, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x05, 0x40, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x0B,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0x80, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00,
-    0x2F, 0x56, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x07,
-    0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F, 0x80, 0x03, 0xF0, 0x0F, 0x40, 0x03, 0xE0, 0x1F,
-    0x00, 0x07, 0xD0, 0x1F, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0x7E, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x20, 0x00, 0x00, 0x00, 0x01, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x03, 0xAD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x05,
-    0x40, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFA, 0xBF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x02, 0x83, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x3A, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xF0,
-    0x3D, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0xC0, 0xF8,
-    0x00, 0xBE, 0x03, 0xF0, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x0F,
-    0xFF, 0xAB, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x50, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x01,
-    0xF8, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
-    0x03, 0xD0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x03, 0xE0,
-    0x00, 0x7C, 0x00, 0x1F, 0x40, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x3E,
-    0x00, 0x2F, 0x80, 0x00, 0xFC, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFD, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x01, 0xFD,
-    0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0B,
-    0xE0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x2F, 0xE0, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0xF8, 0x1F, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x40, 0x03, 0xE0,
-    0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x80, 0xFC,
-    0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFD,
-    0xF8, 0x00, 0x15, 0x0E, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x02, 0xF8,
-    0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0xFD,
-    0x00, 0x2F, 0xC0, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0x80, 0xFF, 0xFD, 0x03, 0xF4, 0x00, 0x3F,
-    0x82, 0xFD, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x87, 0xFC, 0xFF, 0x0F, 0xD0, 0x00, 0x3F, 0x8F, 0xF0,
-    0xFF, 0x2F, 0xC0, 0x00, 0x3F, 0xBF, 0xD0, 0xBF, 0x7F, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0xBF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x3E, 0x01, 0xF0, 0x0F,
-    0xC0, 0x3E, 0x07, 0xF4, 0x2F, 0x40, 0x7E, 0x1F, 0xFC, 0x3F, 0x00, 0x7E, 0x7F, 0xFD, 0xBD, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x00, 0x1C, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x3F, 0x40, 0x00, 0x1F, 0x82, 0xF8, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00,
-    0x00, 0xB0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0xF4, 0x00,
-    0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x1F, 0x82, 0xF8, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x7F, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6A, 0xAA, 0xAF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x55, 0x57, 0xF8, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xAA, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x5F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6A, 0xAA, 0xAF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0A, 0x00,
-    0x00, 0xF0, 0x1E, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x55, 0x57, 0xF8, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xE0, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0x69, 0x00, 0xE0, 0x3C, 0x0B, 0x41, 0xE0,
-    0x3C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0xE0, 0x03, 0x80, 0xF0, 0x28, 0x00, 0x70,
-    0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
-    0x02, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0xFF, 0xFF, 0xD1, 0xFA, 0xAA, 0xAA, 0x50, 0x38, 0x00, 0x28, 0xF0, 0x01, 0xD3, 0xE5, 0x7E, 0x07,
-    0xFF, 0xE0, 0x07, 0xF9, 0x00, 0x00, 0x03, 0xE2, 0xF8, 0xFD, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x3E, 0x2F, 0x80, 0xBE, 0x3F, 0x80, 0xFD, 0x7F, 0x42, 0xFD, 0x2F, 0x81, 0x0E, 0x02, 0xD0,
-    0xF0, 0x08, 0x00, 0x07, 0xE0, 0x70, 0xC3, 0x43, 0x0E, 0xB8, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x0F,
-    0x81, 0xF8, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x0F, 0xC1, 0xA4, 0x00, 0x0A, 0x40, 0x70, 0x00, 0xA0,
-    0xB4, 0x1E, 0x00, 0xFB, 0xD0, 0x00, 0xFC, 0x00, 0x02, 0xC0, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x1A, 0x80, 0x00, 0x68, 0x55, 0x40, 0x3F,
-    0xC0, 0x2F, 0xD0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x03,
-    0xFC, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x7F, 0x40, 0xBF, 0x80, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xD0, 0x1C, 0x3F, 0xC1, 0x78, 0x03,
-    0x40, 0x00, 0xA0, 0x1C, 0x03, 0xF8, 0xF4, 0x2C, 0x00, 0x00, 0x2F, 0xAA, 0x50, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x01, 0x80, 0xB0, 0x34, 0x78,
-    0x38, 0x00, 0x00, 0x0A, 0x24, 0x30, 0x38, 0x00, 0x04, 0x00, 0xD0, 0x9D, 0x0B, 0xF8, 0x06, 0xC0,
-    0xA4, 0x07, 0xFC, 0x0E, 0x80, 0xD0, 0x04, 0x00, 0x02, 0x00, 0x30, 0x2F, 0x80, 0x90, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xE3, 0xF9,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0xFD, 0x03, 0xF0, 0x7F, 0x02, 0xFC,
-    0x3F, 0xC0, 0xFF, 0x00, 0x07, 0xE0, 0x70, 0xC3, 0x43, 0x0E, 0xB8, 0x0F, 0x80, 0x00, 0x55, 0x03,
-    0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xBF, 0x40, 0x02, 0x00, 0x20,
-    0x01, 0xE4, 0x00, 0x24, 0x00, 0x90, 0x5F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x40, 0xB4, 0x07,
-    0x00, 0x38, 0x00, 0xBF, 0x00, 0x18, 0x00, 0x02, 0x80, 0x7C, 0x0B, 0x80, 0xF4, 0x1F, 0x03, 0xE0,
-    0x3D, 0x00, 0x1F, 0xFF, 0x8B, 0x96, 0xD3, 0x80, 0xB0, 0xD0, 0x28, 0x70, 0x00, 0x90, 0xB0, 0x2D,
-    0x00, 0xFB, 0xC0, 0x01, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00, 0xFB,
-    0xC0, 0x0B, 0x42, 0xC0, 0x70, 0x01, 0xD0, 0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03,
-    0xF8, 0x00, 0x05, 0x00, 0x01, 0x55, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xF0, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00,
-    0x05, 0x00, 0x1A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x70, 0x0C, 0x09, 0x1C,
-    0x00, 0x38, 0x07, 0x02, 0xC0, 0x74, 0x1E, 0x5B, 0x80, 0xFF, 0xFC, 0x0F, 0xFF, 0x86, 0x00, 0xD2,
-    0x40, 0x30, 0xC0, 0x1C, 0x30, 0x0A, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x85, 0x03, 0x0D, 0x52,
-    0x46, 0x24, 0xC2, 0x0C, 0x20, 0x83, 0x00, 0x0A, 0x20, 0x0F, 0x00, 0x34, 0x03, 0xB0, 0x30, 0xD0,
-    0x0F, 0x80, 0xA3, 0xDD, 0x0D, 0x74, 0xB2, 0xCB, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x14, 0x0B, 0x80,
-    0x70, 0xB4, 0x10, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x2F, 0x80, 0xBE, 0x3F,
-    0x80, 0xFD, 0x7F, 0x42, 0xFD, 0x15, 0x55, 0x0F, 0xFF, 0xC7, 0x40, 0xE2, 0xC0, 0x34, 0x50, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFD, 0x07, 0xFF, 0xFA, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0xB8, 0x3C, 0x03, 0xD1, 0xF0, 0x1F, 0x0F, 0x80, 0xB8, 0x3D, 0x03, 0xD2, 0xF0,
-    0x1F, 0x06, 0x40, 0x68, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xFE, 0x00, 0x3D, 0x00, 0x7C, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00,
-    0x01, 0x80, 0x0F, 0x83, 0xA0, 0x3D, 0xDD, 0xD0, 0x74, 0xBA, 0xC0, 0xB0, 0x3F, 0x80, 0x50, 0x95,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0xFC, 0x01, 0xFE, 0x5F, 0xD0, 0x02, 0xF4, 0x07, 0xF4,
-    0x02, 0xF4, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0x05, 0x54, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x38, 0x03, 0xF0, 0xB4, 0x0F, 0x40,
-    0xBC, 0x03, 0xE7, 0xE0, 0x06, 0x40, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x02, 0x40, 0x1F, 0x9F, 0x40, 0x7C, 0x03, 0xD0, 0x3D, 0x1F, 0x40, 0xBC,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x04,
-    0x18, 0x2D, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0xC1, 0xC0,
-    0x00, 0x00, 0x07, 0xC0, 0x0E, 0x40, 0x00, 0x6F, 0x40, 0x00, 0x6B, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xE4, 0x00, 0x01, 0xE4, 0x00, 0x06, 0xF4, 0x01, 0x80, 0x00, 0x00, 0x02, 0xC0, 0xC0,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x28, 0x01, 0x90, 0x00, 0x07, 0x80, 0x3D, 0x00, 0x00, 0xB4, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0xAF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE6, 0xBA, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF9, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xF0, 0x02, 0xF0, 0x00, 0x0F,
-    0x00, 0x3E, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x0F, 0xC0,
-    0x06, 0xFC, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x01, 0xF8, 0x00, 0x1F,
-    0x80, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x15, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFA, 0xAA, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0x0F, 0xFF, 0xEF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x10, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x40, 0x00, 0x1F, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40,
-    0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0x01, 0xF4, 0x02, 0xF8, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x7F, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x04, 0x1F, 0xF0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xE5,
-    0x55, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0x40, 0x01,
-    0xFA, 0xAF, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x0F,
-    0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x01, 0xE0,
-    0x00, 0x3E, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0xF8, 0x16, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xD0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE8, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0xAB, 0xF0, 0x02, 0xD0, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x3C,
-    0x00, 0x00, 0xF4, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0xB8, 0x00, 0x02, 0xF0,
-    0x00, 0x7C, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0xF0, 0x00, 0x03, 0xD0, 0x5F, 0xF0, 0x1F,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x3D, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x15, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xF1, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xF9, 0x07, 0xE0, 0x00, 0x2F, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0xC0, 0x02, 0xD0, 0x00,
-    0x3F, 0x80, 0x03, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xC0, 0x00, 0xBF, 0x00, 0x0B, 0xC0, 0x00, 0xFF,
-    0x00, 0x0F, 0x80, 0x01, 0xFE, 0x00, 0x1F, 0x40, 0x02, 0xFD, 0x00, 0x2F, 0x40, 0x03, 0xFC, 0x00,
-    0x3F, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x07,
-    0xF0, 0x2F, 0xC0, 0x00, 0x00, 0xBD, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00,
-    0x02, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0xC0,
-    0x00, 0xBF, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x50, 0x00, 0xFC,
-    0x00, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xD0, 0x02, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0x40, 0x02, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0x00, 0x1F, 0xFF, 0x40, 0x0F,
-    0xE0, 0x03, 0xF7, 0xF0, 0x00, 0xFC, 0x00, 0xFD, 0xBF, 0x00, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x02,
-    0xF8, 0x0B, 0xF1, 0xFD, 0x00, 0x3F, 0x41, 0xFC, 0x2F, 0xC0, 0x07, 0xF0, 0x7F, 0x03, 0xFC, 0x00,
-    0xBF, 0x0F, 0xD0, 0x7F, 0x80, 0x0F, 0xE3, 0xF8, 0x0B, 0xF4, 0x00, 0xFD, 0xBE, 0x00, 0xFF, 0x00,
-    0x1F, 0xEF, 0xC0, 0x1F, 0xE0, 0x02, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xC0,
-    0x07, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0x50, 0x00, 0x03, 0x40, 0x07, 0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x3E,
-    0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00,
-    0xBD, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x0F, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14,
-    0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0xF4,
-    0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x2F,
-    0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x1F, 0x95, 0x55, 0xBD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x47,
-    0xD0, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,
-    0x03, 0xFC, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x07, 0xFA, 0xAA, 0xA0,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x03, 0xFA, 0xAF, 0xC0, 0x00,
-    0x7D, 0x00, 0x1E, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x01,
-    0xF0, 0x00, 0xF4, 0x00, 0xBD, 0x00, 0x1F, 0xAA, 0xBF, 0xC0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x0B, 0xEA, 0xAF, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x2C, 0x00, 0x7C,
-    0x00, 0x0F, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x7F, 0x40, 0xFE, 0xAB, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x01, 0xF0,
-    0x01, 0xF0, 0x00, 0x02, 0xE0, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x03, 0xC0, 0x03,
-    0xE0, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x0F, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x2F, 0xFA, 0xAA, 0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x14, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x3F, 0xF0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x07, 0xFF, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x03,
-    0xF4, 0xBF, 0xC7, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xCB, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0xFF, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xFB, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFD, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x2F, 0xF8, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xC3, 0xFF, 0x4B, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x7F, 0xF4, 0x3F, 0xFC, 0x00, 0x7F, 0xFC,
-    0x0B, 0xFF, 0x42, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x2A, 0x51, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x03, 0xE0, 0x10, 0x00, 0x1F, 0xC0, 0x3E, 0x55, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x01, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x2F, 0x80, 0x00, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0x00, 0x0B, 0xFF,
-    0x80, 0x0B, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x3F, 0x7F, 0x00, 0x0F, 0xC0, 0x0F, 0xDB,
-    0xF0, 0x01, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0x2F, 0x80, 0xBF, 0x1F, 0xD0, 0x03, 0xF4, 0x1F, 0xC2,
-    0xFC, 0x00, 0x7F, 0x07, 0xF0, 0x3F, 0xC0, 0x0B, 0xF0, 0xFD, 0x07, 0xF8, 0x00, 0xFE, 0x3F, 0x80,
-    0xBF, 0x40, 0x0F, 0xDB, 0xE0, 0x0F, 0xF0, 0x01, 0xFE, 0xFC, 0x01, 0xFE, 0x00, 0x2F, 0xFF, 0x00,
-    0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0x00,
-    0x0F, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x06, 0xA0, 0x00, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x02, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xBF, 0xF8,
-    0x00, 0xBE, 0x00, 0x1F, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xF7, 0xF0, 0x00, 0xFC, 0x00, 0xFD, 0xBF,
-    0x00, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x02, 0xF8, 0x0B, 0xE1, 0xFD, 0x00, 0x3F, 0x42, 0xFC, 0x2F,
-    0xC0, 0x07, 0xF0, 0x7F, 0x03, 0xFC, 0x00, 0xBF, 0x0F, 0xD0, 0x7F, 0x40, 0x0F, 0xE3, 0xF4, 0x0B,
-    0xF0, 0x00, 0xFD, 0xBE, 0x00, 0xFF, 0x00, 0x1F, 0xEF, 0xC0, 0x1F, 0xE0, 0x03, 0xFF, 0xF0, 0x03,
-    0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xC1, 0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF4,
-    0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3,
-    0xFF, 0x40, 0x00, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF,
-    0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x54, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0xBC, 0x00,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x02, 0xF4,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x02, 0xF4,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x02, 0xF4, 0x02, 0xF8, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0xFF, 0xC0, 0x0F,
-    0xD0, 0x07, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFD, 0x00,
-    0x0B, 0xFC, 0x00, 0x3E, 0xF4, 0x00, 0x7E, 0xE0, 0x00, 0xF7, 0xE0, 0x03, 0xDF, 0x40, 0x07, 0xCF,
-    0xC0, 0x3E, 0x7C, 0x00, 0x2F, 0x3F, 0x02, 0xF2, 0xF0, 0x00, 0xF8, 0xBC, 0x1F, 0x4F, 0x80, 0x07,
-    0xD2, 0xF0, 0xFC, 0x3E, 0x00, 0x2F, 0x0B, 0xDB, 0xC1, 0xF4, 0x00, 0xFC, 0x1F, 0xFE, 0x0F, 0xC0,
-    0x03, 0xE0, 0x7F, 0xF0, 0x3F, 0x00, 0x1F, 0x41, 0xFF, 0x41, 0xF8, 0x00, 0xBC, 0x07, 0xFC, 0x0B,
-    0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8,
-    0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFA, 0xAA, 0xAF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F,
-    0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00,
-    0x3E, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x3F, 0x00,
-    0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x01, 0xF4, 0x00, 0xFC,
-    0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x0B,
-    0xD0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xD5, 0x5F, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xF4,
-    0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xE9, 0x6F, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x07, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x0F, 0x80,
-    0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x03,
-    0xF1, 0xF8, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x07, 0xF9, 0xBE, 0x5B, 0xE0,
-    0x0F, 0x40, 0x7D, 0x00, 0xB0, 0x3C, 0x00, 0xFC, 0x00, 0xB4, 0x74, 0x00, 0xFC, 0x00, 0xB0, 0xB0,
-    0x01, 0xF8, 0x00, 0xF0, 0xB4, 0x02, 0xF4, 0x03, 0xF0, 0xBE, 0x43, 0xF5, 0x6F, 0xD0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBE, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F,
-    0xD0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x1F, 0x00,
-    0x02, 0xD0, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0xB8, 0x00,
-    0x7C, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x03,
-    0xE0, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x7C,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x01, 0x40, 0x00, 0x14,
-    0x0F, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x3D, 0x0F, 0x00, 0x01, 0xF0, 0x7C,
-    0x00, 0x0B, 0xC2, 0xE0, 0x00, 0x3E, 0x0F, 0x40, 0x01, 0xF4, 0x3C, 0x00, 0x0F, 0xC0, 0xF0, 0x00,
-    0xBF, 0x07, 0xE0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xF4, 0xFC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x29, 0x02, 0xF0, 0x0B,
-    0xC0, 0x1F, 0x40, 0xF8, 0x03, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0x7D,
-    0x00, 0xF4, 0x0B, 0xC0, 0x2F, 0x00, 0x7C, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0xF0, 0x03, 0xD0,
-    0x0F, 0x80, 0x3C, 0x01, 0xF0, 0x03, 0xD0, 0x1E, 0x00, 0xBC, 0x01, 0xF0, 0x0B, 0x40, 0x3E, 0x00,
-    0xBC, 0x03, 0xC0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x78, 0x02, 0xF0, 0x03,
-    0xC0, 0x2D, 0x00, 0xF8, 0x01, 0xE0, 0x0F, 0x00, 0x3F, 0xAA, 0xFE, 0xAB, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x29, 0x02, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0xF8, 0x03, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0xF8, 0x03,
-    0xE0, 0x1F, 0x00, 0x7D, 0x00, 0xF4, 0x0B, 0xC0, 0x2F, 0x00, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x2F,
-    0x00, 0xF0, 0x03, 0xD0, 0x0F, 0x80, 0x7C, 0x01, 0xF0, 0x03, 0xD0, 0x2E, 0x00, 0xBC, 0x01, 0xF0,
-    0x0F, 0x40, 0x3D, 0x00, 0xB8, 0x03, 0xC0, 0x0F, 0x00, 0x2D, 0x00, 0xF0, 0x07, 0xC0, 0x0F, 0x00,
-    0x78, 0x02, 0xE0, 0x03, 0xC0, 0x2D, 0x00, 0xF4, 0x01, 0xE0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x2A, 0xAD, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFF, 0xF9,
-    0x00, 0x3F, 0xAB, 0xF8, 0x03, 0xC0, 0x03, 0xD0, 0x7C, 0x00, 0x1E, 0x0B, 0x80, 0x01, 0xE0, 0xF4,
-    0x00, 0x2E, 0x1F, 0x00, 0x0B, 0xC2, 0xF0, 0x1B, 0xFC, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xD0,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xF9, 0x00, 0x02,
-    0xF8, 0x00, 0x3F, 0xAB, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x7C,
-    0x00, 0x1E, 0x00, 0xBF, 0x00, 0x0B, 0x80, 0x01, 0xE0, 0x0F, 0xE0, 0x00, 0xF4, 0x00, 0x2E, 0x00,
-    0xFD, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x2F, 0xC0, 0x02, 0xF0, 0x1B, 0xFC, 0x03, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x3F, 0xAB, 0xF8, 0x03, 0xC0, 0x03, 0xD0,
-    0x7C, 0x00, 0x1E, 0x0B, 0x80, 0x01, 0xE0, 0xF4, 0x00, 0x2E, 0x0F, 0x00, 0x0B, 0xC2, 0xF0, 0x1B,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x14, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xAA, 0xAA, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x07, 0xFD, 0x00, 0x07, 0xF8, 0x02, 0xFF, 0xFE, 0xBF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x6F, 0xF4, 0x00, 0x0B, 0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x01, 0xF4, 0x00,
-    0xF8, 0x0F, 0x80, 0x02, 0xF0, 0x07, 0xD0, 0xFC, 0x00, 0x07, 0xC0, 0x2F, 0x07, 0xC0, 0x00, 0x1F,
-    0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7C, 0x03, 0xD1, 0xF0, 0x00, 0x02, 0xF0, 0x1F, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0xBF, 0xBD, 0x00, 0x00, 0x3D, 0x03, 0xFF, 0xF4, 0x00, 0x02, 0xF0, 0x0F, 0x4B, 0xC0,
-    0x00, 0x0F, 0x80, 0x7C, 0x2F, 0x80, 0x00, 0xFC, 0x02, 0xE0, 0xBF, 0x40, 0x1F, 0xE0, 0x0F, 0x42,
-    0xFF, 0xEF, 0xFF, 0x00, 0x3C, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x0B,
-    0x40, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x78, 0x00,
-    0x03, 0xD0, 0x00, 0xB4, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x0F,
-    0xC0, 0x01, 0xF0, 0x00, 0x1F, 0xE0, 0x02, 0xE0, 0x00, 0x0F, 0xFE, 0xAB, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x40, 0x3F,
-    0x80, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0xFF, 0x00,
-    0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0x3F,
-    0xE0, 0x03, 0xFC, 0x00, 0xBF, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x2C, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xD0, 0x00,
-    0xF8, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x1E, 0x00, 0x0B,
-    0xF0, 0x2F, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xF7,
-    0xC0, 0x02, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x2F, 0x01, 0x40, 0x00, 0x0F, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0x80, 0xFF, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0xFC,
-    0x03, 0xE0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xAA,
-    0xBC, 0x00, 0xF0, 0x01, 0xD0, 0x1E, 0x00, 0x1D, 0x02, 0xD0, 0x07, 0xC0, 0x3F, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFD, 0x00, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x03, 0xC0, 0xF0, 0x00, 0x7C, 0x1E, 0x00, 0x0F,
-    0xC2, 0xD0, 0x07, 0xF4, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x1E, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x03, 0xC0, 0x7D, 0x00, 0x02, 0xE0, 0x2F,
-    0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x3E, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x95, 0x5F, 0xD4, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x07, 0xC0, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x0B, 0xC0, 0x14, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C,
-    0x02, 0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0xF0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0xFF, 0x41, 0xF8,
-    0x00, 0x00, 0x3F, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x1F, 0xE1, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x9F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE3, 0xFE, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x1F, 0xF4, 0xBF, 0xE0, 0x00, 0xBF,
-    0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x50, 0x1D, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x78, 0x00, 0x3F, 0xD0, 0x00, 0x16, 0xE0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x0E, 0xAF, 0xD0, 0x2F, 0xFF, 0x80, 0x1F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x07, 0xF0, 0x0F, 0x40, 0x03, 0xF8, 0x03, 0xC0, 0x03,
-    0xED, 0x01, 0xF0, 0x03, 0xDF, 0x00, 0xB8, 0x03, 0xE3, 0xC0, 0x3D, 0x02, 0xE1, 0xE0, 0x0F, 0x02,
-    0xE0, 0xB4, 0x07, 0xC1, 0xF0, 0x3C, 0x02, 0xF1, 0xF0, 0x1F, 0x00, 0xF9, 0xF0, 0x0B, 0xC0, 0x3D,
-    0xF4, 0x03, 0xE0, 0x1F, 0xF4, 0x01, 0xF4, 0x0B, 0xF8, 0x00, 0xBC, 0x03, 0xF8, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x90, 0x18, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x07, 0xF0, 0x0F, 0x40, 0x03, 0xF8, 0x03, 0xC0,
-    0x03, 0xED, 0x01, 0xF0, 0x03, 0xDF, 0x00, 0xB8, 0x03, 0xE3, 0xC0, 0x3D, 0x02, 0xE1, 0xE0, 0x0F,
-    0x02, 0xE0, 0xB4, 0x07, 0xC1, 0xF0, 0x3C, 0x02, 0xF1, 0xF0, 0x1F, 0x00, 0xF9, 0xF0, 0x0B, 0xC0,
-    0x3D, 0xF4, 0x03, 0xE0, 0x1F, 0xF4, 0x01, 0xF4, 0x0B, 0xF8, 0x00, 0xBC, 0x03, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0x06, 0x40, 0x64, 0x00, 0x0F, 0x02, 0xF0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x3D, 0x2F,
-    0x40, 0x00, 0x7C, 0xBD, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x0F, 0x8F, 0xF0,
-    0x00, 0x2F, 0x0B, 0xFC, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x7D, 0x01, 0xFF, 0x40, 0x00, 0x1A, 0xAA,
-    0x40, 0x0F, 0xFF, 0xD0, 0x03, 0xC0, 0xB0, 0x01, 0xE0, 0x3C, 0x00, 0xB4, 0x1E, 0x00, 0x3C, 0x0B,
-    0x40, 0x1E, 0x03, 0xC0, 0x0B, 0x41, 0xF0, 0x03, 0xC0, 0xB8, 0x01, 0xE0, 0x3D, 0x00, 0xF0, 0x0F,
-    0x00, 0xBC, 0x07, 0x80, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xBD,
-    0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00,
-    0xFF, 0xD0, 0x1F, 0xF8, 0x01, 0xFB, 0xD0, 0x3E, 0xF4, 0x02, 0xEB, 0xE0, 0xBD, 0xF4, 0x03, 0xD7,
-    0xE1, 0xF6, 0xF0, 0x03, 0xD7, 0xF3, 0xF3, 0xF0, 0x0B, 0xC3, 0xFB, 0xC7, 0xE0, 0x0F, 0xC3, 0xFF,
-    0x4B, 0xE0, 0x0F, 0x83, 0xFF, 0x0F, 0xD0, 0x2F, 0x42, 0xFC, 0x1F, 0xC0, 0x3F, 0x02, 0xF8, 0x2F,
-    0xC0, 0x3F, 0x01, 0xA0, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x3D,
-    0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x01, 0xF8,
-    0x00, 0x0B, 0xE0, 0x03, 0xFA, 0xAA, 0xAF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0xBF, 0xBF, 0x40, 0x2F, 0x40, 0x3C, 0x0B, 0xC0, 0x02, 0xD0, 0xF4, 0x00, 0x2E,
-    0x2F, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x3D, 0x3C, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0xFC, 0x7E, 0x00,
-    0x7F, 0x43, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA9, 0x02, 0xFF, 0xFF, 0xFE, 0x03, 0xE0, 0x00, 0x3D, 0x03,
-    0xD0, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0xF4, 0x0F,
-    0x40, 0x02, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x07, 0xD0, 0x7D,
-    0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x40, 0xAE, 0x40,
-    0x00, 0x02, 0xE7, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD1, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x78, 0x00,
-    0x03, 0xF4, 0x00, 0x78, 0x00, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x0B, 0xD0, 0x00, 0xB8, 0x00, 0x0F,
-    0xC0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x2F, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0xFE,
-    0x6F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x01, 0xF4, 0xBF, 0xF0,
-    0x00, 0x03, 0xF0, 0x05, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF8, 0x03, 0xFD,
-    0x04, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xEB, 0xEA, 0xFA, 0xFD, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x3F,
-    0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x7F, 0x55,
-    0xF4, 0x0F, 0x40, 0x3F, 0x00, 0x38, 0x1D, 0x00, 0x7E, 0x00, 0x3C, 0x3C, 0x00, 0xBC, 0x00, 0x78,
-    0x38, 0x00, 0xFC, 0x00, 0xB8, 0x78, 0x01, 0xF8, 0x01, 0xF0, 0x7D, 0x02, 0xF4, 0x0B, 0xF0, 0x7F,
-    0xEB, 0xFE, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x01, 0x90, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00,
-    0x7C, 0x0B, 0xC0, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0x3F,
-    0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x40,
-    0x01, 0xA0, 0x00, 0x28, 0x02, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0xF4,
-    0x07, 0xC0, 0x00, 0xF0, 0x0B, 0xC0, 0x01, 0xF0, 0x0B, 0x80, 0x02, 0xE0, 0x0F, 0x40, 0x02, 0xD0,
-    0x0F, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x03, 0xC0, 0x2D, 0x00, 0x07, 0x80, 0x3E, 0x6A, 0xAF, 0xE4,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xC1, 0xC0, 0x0B,
-    0x0B, 0x00, 0x38, 0x38, 0x01, 0xD0, 0xD0, 0x0B, 0x07, 0x00, 0x3C, 0x1E, 0x07, 0xE0, 0x3F, 0xFF,
-    0x40, 0x7F, 0x6C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x2E, 0x02, 0xF0, 0x07, 0xC0, 0x3D, 0x03, 0xF0, 0x0B, 0xC0, 0x3C, 0x03, 0xE0, 0x0F, 0x80, 0x7C,
-    0x07, 0xC0, 0x0F, 0x40, 0xB8, 0x0B, 0xC0, 0x1F, 0x00, 0xF4, 0x0F, 0x80, 0x2F, 0x00, 0xF0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF0, 0x1F, 0x00, 0x3C, 0x01, 0xE0, 0x2F, 0x00, 0x7C, 0x02, 0xD0, 0x3E, 0x00,
-    0x78, 0x03, 0xC0, 0x3E, 0x55, 0xF9, 0x5B, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x2E, 0x02, 0xF0, 0x07, 0xC0, 0x3D, 0x03, 0xF0, 0x0B, 0xC0,
-    0x3C, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x07, 0xC0, 0x0F, 0x40, 0xB8, 0x0B, 0xC0, 0x1F, 0x00, 0xF4,
-    0x0F, 0x80, 0x2F, 0x00, 0xF0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x1F, 0x00, 0x3C, 0x01, 0xE0, 0x2F,
-    0x00, 0x7C, 0x02, 0xD0, 0x3E, 0x00, 0x78, 0x03, 0xC0, 0x3E, 0x55, 0xF9, 0x5B, 0xE8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x56, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3E, 0x54, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0xBC, 0x00, 0xB8, 0x0F, 0x80, 0x03,
-    0xC0, 0xF4, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x81, 0xF5, 0x6B, 0xF0, 0x2F, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x09, 0x02, 0xF0, 0x00, 0x00, 0x2D,
-    0x03, 0xF0, 0x00, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0x78, 0x07,
-    0xD5, 0x00, 0x00, 0xF4, 0x0B, 0xFF, 0xFD, 0x00, 0xF0, 0x0F, 0x80, 0x0B, 0x01, 0xF0, 0x0F, 0x40,
-    0x03, 0x82, 0xE0, 0x1F, 0x00, 0x07, 0x83, 0xD0, 0x2F, 0x00, 0x1F, 0x47, 0xC0, 0x3F, 0x56, 0xFF,
-    0x0B, 0xC0, 0x3F, 0xFF, 0xFC, 0x0F, 0x80, 0x3F, 0xFF, 0x90, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x3C, 0x07, 0xC0, 0x01,
-    0xD0, 0xB8, 0x00, 0x3D, 0x0F, 0x40, 0x0B, 0xC1, 0xF9, 0x6B, 0xF8, 0x2F, 0xFF, 0xFE, 0x03, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3D, 0x40,
-    0xBC, 0x00, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x07, 0xEA, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7F, 0x03, 0x00, 0x0B, 0xF4, 0x1F,
-    0xEB, 0xFF, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x2F, 0xFC, 0x00, 0x2E, 0x03, 0xE0, 0x7C, 0x00, 0xF4, 0x3C,
-    0x00, 0x74, 0x03, 0xC2, 0xD0, 0x01, 0xE0, 0x1E, 0x1E, 0x00, 0x07, 0x80, 0xB4, 0xB0, 0x00, 0x1D,
-    0x03, 0xC3, 0xC0, 0x00, 0xB0, 0x0F, 0xFE, 0x00, 0x03, 0xC0, 0x7E, 0xF4, 0x00, 0x2E, 0x02, 0xC3,
-    0xE0, 0x01, 0xF0, 0x0F, 0x0F, 0xD0, 0x2F, 0x80, 0x38, 0x2F, 0xFF, 0xFC, 0x01, 0xD0, 0x3F, 0xFF,
-    0xC0, 0x0B, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x2C, 0x00, 0xB8, 0x00, 0x0E, 0x00, 0x3D,
-    0x00, 0x03, 0x40, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x0B, 0xE0, 0x7C, 0x00, 0x0B, 0xD0, 0x2E, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x03, 0xE0,
-    0x03, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xB8, 0x00, 0x2C, 0x02,
-    0xE0, 0x00, 0x7C, 0x03, 0xEA, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
-    0x2D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x40, 0x00, 0x78, 0x0B, 0xE0, 0x01, 0xC0, 0x01, 0xF0, 0x03, 0x40, 0x00, 0xF0, 0x0F,
-    0xFE, 0xAA, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0B, 0x81, 0x54, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0xBF, 0xA5, 0x40, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07,
-    0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x01, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F,
-    0x40, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0xAF, 0xD0, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xE5, 0x7C, 0x00, 0xF0, 0x01, 0xD0, 0x2C, 0x00,
-    0x0A, 0x07, 0x80, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x02, 0xF9, 0x57, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xD0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0xAB, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8,
-    0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0xFC, 0x07, 0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0xC1, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xD5, 0x6C,
-    0x00, 0x00, 0x38, 0x02, 0xC0, 0x00, 0x03, 0x40, 0x38, 0x00, 0x00, 0x70, 0x03, 0x40, 0x00, 0x0A,
-    0x00, 0x7F, 0xF4, 0x00, 0xD0, 0x0B, 0x01, 0xD0, 0x1C, 0x00, 0xE0, 0x0A, 0x02, 0x80, 0x0D, 0x00,
-    0xA0, 0x34, 0x01, 0xD0, 0x1D, 0x07, 0x00, 0x2D, 0x1B, 0xC2, 0xE0, 0x03, 0xFF, 0xF4, 0x7C, 0x00,
-    0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x28, 0x00,
-    0x02, 0xC0, 0x03, 0x80, 0x00, 0x38, 0x00, 0x34, 0x00, 0x03, 0x40, 0x07, 0x00, 0x00, 0x70, 0x00,
-    0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xF5, 0x56, 0xD0, 0x7C, 0x0D, 0x00, 0x2C, 0x01, 0xC1,
-    0xC0, 0x03, 0xC0, 0x1C, 0x2C, 0x00, 0x38, 0x03, 0xC3, 0x80, 0x07, 0x85, 0xF4, 0x34, 0x00, 0xBF,
-    0xFF, 0x07, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0B, 0x81, 0x54, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0xBF, 0xA5, 0x40, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07,
-    0xE0, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F,
-    0x40, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x54, 0x00,
-    0x0F, 0x01, 0xF4, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x3D, 0x1F, 0x40, 0x00, 0x7C, 0x7D, 0x00, 0x00,
-    0xB9, 0xF4, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x2F, 0x0B, 0xFC, 0x00, 0x3F,
-    0x03, 0xFE, 0x00, 0x7D, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x7F, 0x00, 0xF4, 0x00, 0x3F, 0x80, 0x3C, 0x00,
-    0x3E, 0xD0, 0x1F, 0x00, 0x3D, 0xF0, 0x0B, 0x80, 0x3E, 0x3C, 0x03, 0xD0, 0x2E, 0x1E, 0x00, 0xF0,
-    0x2E, 0x0B, 0x40, 0x7C, 0x1F, 0x03, 0xC0, 0x2F, 0x1F, 0x01, 0xF0, 0x0F, 0x9F, 0x00, 0xBC, 0x03,
-    0xDF, 0x40, 0x3E, 0x01, 0xFF, 0x40, 0x1F, 0x40, 0xBF, 0x80, 0x0B, 0xC0, 0x3F, 0x80, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0xE0, 0x00, 0xD0, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x74, 0x03, 0xC0, 0x03,
-    0xC0, 0x0E, 0x00, 0x0F, 0x00, 0x74, 0x00, 0x78, 0x02, 0xC0, 0x02, 0xD0, 0x0F, 0x00, 0x0F, 0x00,
-    0x78, 0x00, 0x38, 0x02, 0xD0, 0x01, 0xD0, 0x0F, 0x00, 0x0B, 0x00, 0x3C, 0x00, 0x3C, 0x01, 0xE0,
-    0x00, 0xE0, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0A, 0xBE, 0xAA, 0x87,
-    0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF4, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3F, 0x95, 0x40, 0x0F, 0xFF, 0xFC, 0x07, 0xF4, 0x03, 0xC2, 0xF4, 0x00, 0x74, 0xFC, 0x00, 0x1D,
-    0x3F, 0x00, 0x0B, 0x0F, 0xC0, 0x0B, 0xC7, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0x00, 0x2B, 0xFA, 0xA9, 0x0F, 0xFF, 0xFF, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0xF9, 0x50, 0x03, 0xFF, 0xFF, 0x40, 0xFD, 0x00, 0xB0, 0x7E, 0x00, 0x0E, 0x2F, 0x00,
-    0x03, 0x8F, 0xC0, 0x02, 0xD3, 0xF4, 0x17, 0xF0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFE, 0x00, 0x15, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD5, 0x55, 0xBF, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x01,
-    0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0xF4, 0x00,
-    0x00, 0x7C, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0xBC,
-    0x02, 0xE0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x0B,
-    0xD0, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x00, 0xF7, 0x80, 0x00,
-    0x01, 0xBF, 0xE0, 0x00, 0x02, 0xD7, 0x8F, 0x00, 0x02, 0xC1, 0xD1, 0xD0, 0x01, 0xE0, 0xB0, 0x38,
-    0x00, 0xF0, 0x3C, 0x0E, 0x00, 0x74, 0x0E, 0x03, 0x80, 0x3C, 0x0B, 0x40, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xE0, 0x00, 0xBF, 0xFD, 0x00, 0x3D, 0x00, 0x1F, 0xC1,
-    0xF0, 0x0B, 0xC0, 0x03, 0xF0, 0x0B, 0xC2, 0xF4, 0x00, 0x7E, 0x1B, 0xFF, 0xFE, 0x00, 0x0B, 0xEF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xD0, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0xE9, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x03, 0xC0, 0x03, 0xE7, 0xC0, 0x78, 0x00, 0xB8, 0x1E, 0x0F, 0x00, 0x0F,
-    0x1B, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x01, 0xF4, 0x00, 0x7C,
-    0x00, 0x3E, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0x40,
-    0x00, 0xFC, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xEF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x05, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x58,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x0F, 0xD0, 0xF0,
-    0x00, 0x0F, 0x80, 0x3C, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xF0, 0x00,
-    0xF8, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x7D, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07,
-    0x80, 0x00, 0x2D, 0x0F, 0xFF, 0xF0, 0x15, 0x57, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xEA, 0xAA, 0x90, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xD0, 0x0E, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x2E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFA, 0xAA, 0xAA, 0x90, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xAB, 0x90, 0x00, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x05, 0xFD, 0x00, 0x02, 0xF4, 0x03,
-    0xFE, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x03, 0xFF, 0xD0, 0x1C, 0x00,
-    0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1D, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xE0, 0x78, 0x0E, 0x00,
-    0xA0, 0x70, 0x02, 0x82, 0xC0, 0x0D, 0x0E, 0x02, 0xF0, 0x78, 0x2E, 0x00, 0x00, 0x03, 0xF4, 0x03,
-    0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xF4, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x03, 0xFF,
-    0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x03, 0xFD, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xF8, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xCF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x1F, 0xFC,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xD2, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x3F, 0xF8, 0x3F,
-    0xFD, 0x28, 0x3F, 0xFD, 0x07, 0xFF, 0x81, 0xFF, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x19, 0x01, 0xA8, 0x06, 0x40, 0x07, 0xC0,
-    0xFE, 0x07, 0xC0, 0x00, 0xF8, 0x3F, 0x47, 0xC0, 0x00, 0x1F, 0x0F, 0xC3, 0xD0, 0x00, 0x03, 0xD3,
-    0xE3, 0xD0, 0x00, 0x00, 0xBD, 0xF7, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFE, 0xFE, 0xFD, 0x00, 0x00, 0xFE, 0x7F, 0x3F, 0xC0, 0x01, 0xFF, 0x2F, 0xC7,
-    0xFC, 0x01, 0xFF, 0x0F, 0xF0, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x2A, 0x51, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x03, 0xE0, 0x10, 0x00, 0x0F, 0xC0, 0x3D, 0x41, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x50, 0x1D, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x78, 0x00, 0x3F, 0xD0, 0x00, 0x16, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0xF0, 0x0E, 0xAF, 0xD0, 0x2F, 0xFF, 0x80, 0x2F, 0xF9, 0x00, 0x08, 0x00, 0x00,
-    0x1E, 0x40, 0x00, 0x00, 0x90, 0x00, 0x01, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0x80, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x00, 0x01,
-    0xF8, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xCB,
-    0xFE, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x3F, 0xFC, 0x00, 0x02, 0xFC, 0x07,
-    0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x7F, 0x00, 0x1F, 0xFF, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x28, 0x06,
-    0x80, 0x03, 0xC1, 0xF0, 0x00, 0xB8, 0x3D, 0x00, 0x0F, 0x0F, 0x40, 0x01, 0xF3, 0xE0, 0x00, 0x2E,
-    0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xBF, 0x00, 0x03, 0xE3, 0xF8, 0x00, 0x3D, 0x2F, 0xD0, 0x07, 0xC0, 0xFF, 0x00, 0xF8, 0x0B,
-    0xF8, 0x60, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7C, 0x00, 0x0B, 0xD0, 0x00,
-    0x0F, 0x9A, 0x01, 0xF8, 0x00, 0x00, 0xF7, 0xF0, 0x7E, 0x00, 0x00, 0x2F, 0x3F, 0x0F, 0xC0, 0x00,
-    0x03, 0xE3, 0xE3, 0xF0, 0x00, 0x00, 0x7D, 0x7D, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xF1, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0x2F, 0xBF, 0xC0, 0x00, 0x07, 0xE3, 0xF5, 0xFF, 0x00, 0x00, 0xFD, 0x3F, 0x4F, 0xF8,
-    0x00, 0x0F, 0xC3, 0xF0, 0xBF, 0xD0, 0x01, 0xF8, 0x15, 0x03, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x18, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x40, 0x0F, 0x40, 0x02,
-    0xDF, 0x0F, 0x40, 0x00, 0xF7, 0x8F, 0x40, 0x00, 0x76, 0xEB, 0x40, 0x00, 0x3D, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0x9F, 0xF4, 0x00, 0x03, 0xCB, 0xEF, 0x40, 0x01, 0xF3, 0xE3, 0xF0,
-    0x00, 0xB8, 0xF4, 0xFF, 0x00, 0x3C, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF8, 0x00,
-    0x7F, 0xFF, 0x0B, 0xF0, 0x00, 0xBF, 0xFF, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F,
-    0xC1, 0xFD, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x3F,
-    0x80, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x0B, 0xF7, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x40, 0x00, 0x1F, 0xC2, 0xFF, 0xC0, 0x00, 0x2F,
-    0xC0, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xBF, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x2F,
-    0x00, 0x7C, 0x3F, 0x00, 0x2F, 0x3F, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xF0, 0x00, 0x3E, 0xFE, 0x00, 0x1F, 0x6F, 0xD0, 0x0F, 0xC3, 0xFC, 0x03, 0xF0, 0xBF,
-    0xC1, 0xF8, 0x0F, 0xF8, 0xBD, 0x02, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0x83, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xF0, 0x2A, 0xAA, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x40, 0x00,
-    0x01, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x0B, 0xFF, 0x40,
-    0x00, 0x7F, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x6A, 0xAA, 0x01, 0xA2,
-    0xFF, 0xFC, 0x1F, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x3C, 0xF8, 0x00, 0x02,
-    0xEB, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x7D, 0xFC, 0x00, 0x02, 0xE3, 0xF8, 0x00, 0x0F, 0x47, 0xF4, 0x00, 0x7C, 0x0F, 0xF0,
-    0x02, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x51, 0xFF, 0x00,
-    0x00, 0xBF, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xA0, 0x00, 0x28, 0x00, 0xF0, 0x00, 0x3C, 0x01, 0xF0, 0x00,
-    0x78, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0xF4, 0x03, 0xC0, 0x01, 0xF0, 0x0B, 0xC0, 0x02,
-    0xF0, 0x0F, 0x80, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x3F,
-    0x1C, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x07, 0xE0, 0x00, 0x02, 0xFE, 0xAA, 0xA8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xD5, 0x55, 0xBE,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x9A, 0xE4, 0x00, 0x1F, 0x40, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBC, 0x00, 0x0B, 0xFD, 0x41, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xF0, 0x0F,
-    0x80, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x7D, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x2F,
-    0x80, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x06, 0xF8, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0xFF, 0xC0, 0x3F, 0x00,
-    0x03, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xFA, 0xFF, 0x40, 0x3F, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x0B, 0xF4, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xF4, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x6E, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0xF8, 0x03,
-    0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0x3C, 0x0F, 0x80, 0x07, 0xC0, 0x00,
-    0xB4, 0x1F, 0x40, 0x0B, 0x80, 0x01, 0xF0, 0x2F, 0x00, 0x0F, 0x00, 0x07, 0xE0, 0x3E, 0x00, 0x1F,
-    0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x2F, 0x02, 0xFD, 0x00, 0x3F,
-    0x00, 0x2F, 0xAF, 0xF4, 0x28, 0x3F, 0xD0, 0x2F, 0xFF, 0xE6, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFE, 0xBF, 0xFD, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE8,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x05, 0x40, 0x00, 0xF4, 0x00, 0xBF, 0xF0, 0x02, 0xE0, 0x03, 0xD0,
-    0x78, 0x03, 0xC0, 0x0F, 0x00, 0x38, 0x0B, 0x80, 0x2C, 0x00, 0x38, 0x0F, 0x00, 0x38, 0x00, 0xB0,
-    0x1F, 0x00, 0xB4, 0x02, 0xE0, 0x2E, 0x00, 0xF0, 0x0B, 0xC0, 0x2E, 0x00, 0xF4, 0x3F, 0x00, 0x2F,
-    0x00, 0xFA, 0xFD, 0x18, 0x2F, 0xC0, 0xFF, 0xFE, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x94, 0x17, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x26, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF,
-    0xF8, 0x03, 0xFD, 0x04, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xBF, 0xEA, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xBF,
-    0x07, 0xF0, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x0F, 0x87, 0xC0, 0x01, 0xF0, 0x7D, 0x00, 0x3E, 0x07, 0xD0, 0x0B, 0xC0, 0x3D, 0x01, 0xF4, 0x03,
-    0xE0, 0x3E, 0x00, 0x3E, 0x0B, 0xC0, 0x03, 0xE0, 0xF4, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF7, 0xC0,
-    0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x02, 0xF4, 0x3F, 0x40, 0x00, 0x1F, 0x80, 0xBE, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0xBF,
-    0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xAF, 0xFA, 0x90, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x02, 0xA0, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0xF8, 0x00,
-    0x07, 0xD0, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0xF8,
-    0x1F, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0x3F, 0x7D, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xAA, 0xFF, 0xAA, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x02,
-    0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF8, 0x00, 0x02, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x09, 0x00, 0x01, 0x80, 0x00, 0xF0,
-    0x00, 0xB4, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x03, 0xD2, 0xE0, 0x00,
-    0x00, 0x2E, 0xBC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x02,
-    0xF8, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0xC0, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x03, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0xA2, 0xFF, 0xFF, 0xFD, 0x07, 0xC0,
-    0x03, 0xF0, 0x00, 0x2E, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xC0, 0x02, 0xF0,
-    0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x0F,
-    0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x07,
-    0xC0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xFD, 0x55, 0x5B, 0x94, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x15, 0x55, 0x40, 0x07, 0xFF, 0xFD, 0x0D, 0x00, 0xF0, 0x01, 0xC0, 0x0F,
-    0x00, 0x2C, 0x01, 0xE0, 0x03, 0x80, 0x2D, 0x00, 0x34, 0x03, 0xC0, 0x0B, 0x00, 0x38, 0x00, 0xE0,
-    0x07, 0x40, 0x0D, 0x00, 0xB0, 0x01, 0xC0, 0x0F, 0x55, 0x6D, 0x41, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x69, 0x07, 0xD0, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xF8,
-    0x0F, 0x40, 0x00, 0xF4, 0x0F, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x03, 0xF0, 0x2D, 0x00, 0x07, 0xE0,
-    0x2D, 0x00, 0x0F, 0xD0, 0x2E, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xAF, 0x40,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0xF3, 0xD0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x0F, 0x00, 0x3D, 0x0F, 0x00, 0x3C, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x74, 0x2C,
-    0x00, 0xF0, 0x28, 0x01, 0xF0, 0x2D, 0x5B, 0xE0, 0x0F, 0xFB, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x09, 0xF0, 0x00, 0x00, 0xE0,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x3E, 0x0F,
-    0x40, 0x00, 0x7D, 0x1F, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x01, 0xF4, 0x7C,
-    0x00, 0x03, 0xF0, 0x7C, 0x0E, 0x07, 0xF0, 0xBC, 0x1D, 0x0F, 0xE0, 0xBD, 0x3D, 0xBF, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xEF, 0xC0, 0x0B, 0xFE, 0x1F, 0x80, 0x00, 0xF0, 0x3F, 0x40, 0x00,
-    0xF0, 0x3F, 0x00, 0x01, 0xE0, 0x7F, 0x00, 0x02, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x0E, 0x0B, 0x00, 0x1D, 0x0E, 0x00, 0x2C, 0x1D, 0x00, 0x3C, 0x2C, 0x10,
-    0xB4, 0x3C, 0x70, 0xF0, 0x3C, 0xB7, 0xF0, 0x3F, 0xFF, 0xE0, 0x0B, 0xF6, 0xD0, 0x01, 0xC3, 0xC0,
-    0x02, 0x87, 0xC0, 0x02, 0x4B, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFD, 0xAB, 0x90, 0x00, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x7C, 0x02, 0xF8, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x3C, 0x07, 0xC0, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0xB8, 0x0F, 0x80, 0x00, 0xF4, 0x1F, 0x40,
-    0x01, 0xF4, 0x2F, 0x40, 0x02, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x19, 0x40, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0x40, 0xFC, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x78, 0x07, 0xE0,
-    0x00, 0xB8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x40,
-    0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x0F, 0xC0, 0x50, 0x00,
-    0x07, 0xF9, 0x00, 0xBC, 0x00, 0xBF, 0xFF, 0xC0, 0xBD, 0x03, 0xFE, 0x42, 0xF0, 0x7F, 0xEF, 0xD0,
-    0x00, 0xB8, 0x1B, 0xFF, 0xF9, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xFA, 0xBC, 0x01, 0xF9, 0xBF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0xA9, 0x54, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x40, 0x06, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x0F, 0x00, 0xFF, 0xF0, 0xF8, 0x7E, 0x02, 0xC7, 0xFF, 0x90, 0x0D, 0x07, 0xFF, 0xF9, 0xE0, 0xBE,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x91, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x2F, 0xD0, 0x06, 0x00, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x40, 0x50, 0x00,
-    0x0B, 0xF9, 0x00, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0xFC, 0x07, 0xFE, 0x42, 0xF0, 0x7F, 0xEF, 0xD0,
-    0x00, 0xB4, 0x1F, 0xFF, 0xF9, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xF9, 0xBC, 0x02, 0xF5, 0xBF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xAA, 0x54, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x06, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03,
-    0xC0, 0x2F, 0xFC, 0x0F, 0x87, 0xE4, 0x2C, 0x0F, 0xFE, 0x40, 0x34, 0x03, 0xFF, 0xF9, 0xE0, 0x1F,
-    0xBF, 0xFF, 0x80, 0xFF, 0xFF, 0xF9, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x60, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x01,
-    0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B,
-    0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x03,
-    0xFF, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x07, 0xFD,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xFC, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xF3, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xDF,
-    0xF9, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4,
-    0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x43, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0xBF, 0xF4, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0x80, 0xBE, 0x00, 0x00, 0x3F, 0x03,
-    0xFD, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x7F, 0x47, 0xE0,
-    0x00, 0x00, 0x03, 0xF2, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xDB, 0xE7, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xBF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF9,
-    0xFE, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x8F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x7F, 0xD2, 0xFF,
-    0x80, 0x02, 0xFF, 0x83, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x40, 0x00, 0x7C, 0x0B, 0xD0, 0x00, 0x0F, 0x81, 0xF4, 0x00,
-    0x00, 0xF4, 0x7E, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0x7D, 0xFC,
-    0x00, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02,
-    0xF4, 0x6F, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00, 0xB0, 0x7C,
-    0x00, 0xE0, 0xF0, 0x00, 0xD3, 0xC0, 0x02, 0xCB, 0x40, 0x03, 0xED, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF9, 0x00, 0x0F, 0x0B, 0xD0, 0x1E, 0x00, 0xF0, 0x2D, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x7C, 0x00,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x54, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0xBC,
-    0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x02,
-    0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x02,
-    0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xD0, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xAA, 0x40, 0x0B, 0xFF, 0xE0, 0x03, 0xC0, 0xB0, 0x01, 0xF0, 0x3C, 0x00, 0xB4, 0x1E, 0x00,
-    0x3C, 0x0B, 0x40, 0x1E, 0x03, 0xC0, 0x0B, 0x40, 0xF0, 0x03, 0xC0, 0xB8, 0x01, 0xE0, 0x3D, 0x00,
-    0xF4, 0x0F, 0x00, 0xBC, 0x07, 0xF8, 0xBD, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFA, 0xAA, 0xAF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x64, 0x00, 0x28, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C,
-    0x01, 0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0xF0, 0x07, 0xC0, 0x02, 0xF0,
-    0x0B, 0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x2F, 0xC0, 0xBD, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0x7F, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFA, 0xAA, 0xAF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x29, 0x00,
-    0xF4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03,
-    0xD0, 0x00, 0xF4, 0x07, 0xC0, 0x01, 0xF0, 0x0B, 0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x3E, 0x00, 0x1F, 0x80, 0x7E,
-    0x00, 0x2F, 0x40, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x69, 0x07,
-    0xD0, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0xF4, 0x0F,
-    0x00, 0x01, 0xF0, 0x1E, 0x00, 0x03, 0xF0, 0x2D, 0x00, 0x07, 0xE0, 0x2D, 0x00, 0x0F, 0xD0, 0x2E,
-    0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xAF, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x0B, 0x2C, 0x00, 0xE3, 0x80,
-    0x1D, 0x34, 0x02, 0xC7, 0x00, 0x3C, 0xB0, 0x0B, 0x8F, 0x02, 0xF4, 0xBF, 0xFF, 0x02, 0xF9, 0xF0,
-    0x00, 0x1E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xC0,
-    0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xEF, 0xF0,
-    0x02, 0xFF, 0xF4, 0x00, 0xBD, 0xFF, 0x40, 0x7F, 0x7F, 0x00, 0x0F, 0xCF, 0xF4, 0x0F, 0xEB, 0xF0,
-    0x00, 0xFC, 0xBF, 0x82, 0xFC, 0xFF, 0x00, 0x2F, 0xC7, 0xF8, 0x7F, 0x4F, 0xE0, 0x03, 0xF8, 0x7F,
-    0xCF, 0xE2, 0xFD, 0x00, 0x3F, 0x43, 0xFE, 0xFC, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xFF, 0x43, 0xFC,
-    0x00, 0xFF, 0x03, 0xFF, 0xF0, 0xBF, 0xC0, 0x0F, 0xF0, 0x3F, 0xFC, 0x0F, 0xF8, 0x01, 0xFE, 0x02,
-    0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x2F, 0xF0, 0x2F, 0xF0, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
-    0x40, 0x07, 0xF0, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF,
-    0x40, 0xBF, 0xC0, 0x3E, 0xF4, 0x1F, 0xB8, 0x03, 0xDF, 0x83, 0xDF, 0x40, 0x7C, 0xF8, 0xBD, 0xF0,
-    0x0B, 0x8F, 0xDF, 0x2F, 0x00, 0xF4, 0xFF, 0xE3, 0xF0, 0x1F, 0x0B, 0xFC, 0x7E, 0x02, 0xF0, 0xBF,
-    0x4B, 0xD0, 0x3E, 0x07, 0xE0, 0xFD, 0x07, 0xE0, 0x7C, 0x1F, 0xC0, 0xBD, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x14, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4,
-    0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40,
-    0x1F, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xA0,
-    0x00, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF9, 0x5F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x01, 0xF4,
-    0x7D, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x01, 0xF4,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x55, 0x57, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x95, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2C,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0xF8, 0x00,
-    0x03, 0xD0, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x0F,
-    0x00, 0x03, 0xF0, 0x00, 0x1E, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF7, 0xC0, 0x00, 0x02, 0xFF, 0x87,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x03,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x55, 0x55, 0x7F,
-    0x80, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x02, 0xFC,
-    0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xB0, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0xD1, 0xFF, 0x00, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x03, 0xE0,
-    0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x78, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0x00, 0x00, 0x02, 0xFF, 0x87, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xEA, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F, 0xE2, 0xDF, 0xFB, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x03, 0x40, 0x07, 0xE0, 0x2F, 0xF4, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0xFE, 0x00, 0x07, 0xC0,
-    0x3D, 0x00, 0x0F, 0xEA, 0xFF, 0xFC, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x1F,
-    0x95, 0x40, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x56, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x87, 0xC7, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x03, 0x80, 0x00, 0x0B, 0xD5, 0xBC, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x40, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x38, 0x00, 0x0B, 0x80, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x7C,
-    0x00, 0x3E, 0xAF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xF9, 0x54, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6D, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0x95, 0x6F, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x15, 0x6A, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFE, 0x97, 0xC0, 0x38, 0x00, 0x0F, 0x40, 0x38, 0x00, 0x3E, 0x00, 0x1D, 0x02,
-    0xF8, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x02, 0x95, 0x6F, 0xF8, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x55, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xEB, 0xE0, 0x2D, 0x40, 0x03, 0xC0, 0x1C, 0x00, 0x0F, 0x40, 0x0E, 0x00,
-    0xBD, 0x00, 0x07, 0xEF, 0xF4, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x3F, 0xC0,
-    0xFE, 0x00, 0x01, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x39, 0x56, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0x56, 0xAF, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x97,
-    0xC0, 0x00, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0x80, 0x03, 0xE0, 0x00, 0x07, 0x40, 0xBE, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xA5, 0x5B, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x15, 0x7D,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xAF, 0x80, 0x2D, 0x40, 0x03, 0xC0, 0x07, 0x00, 0x03,
-    0xC0, 0x00, 0xD0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xBF, 0xF8, 0x00, 0x3F, 0x80,
-    0xFE, 0x00, 0x1F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x3F, 0xF0,
-    0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x07, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x7F,
-    0x00, 0x00, 0x00, 0xBF, 0x07, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0xBF, 0xC7, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xCB, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xFF, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFD, 0xFF, 0x9F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x2F, 0xF8, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x4B, 0xFF,
-    0x40, 0x00, 0xFF, 0xF0, 0x7F, 0xF4, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x0B, 0xFF, 0x42, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x2F, 0xF0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0xFF, 0x41, 0xF8, 0x00, 0x00, 0x3F, 0x03, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x1F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF2, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x9F, 0xF0, 0x00, 0x00, 0x7F, 0xE3, 0xFE,
-    0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x1F, 0xF4, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0x00,
-    0xFF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x02, 0xA5, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x01,
-    0x00, 0x01, 0xFC, 0x00, 0x3E, 0x55, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0xBC, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x05, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x16, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0xAF, 0xD0, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x47, 0xFC, 0x0B, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x04, 0x01, 0xFC, 0x00, 0xBD, 0x6F,
-    0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x6A, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0xE0, 0x01, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xC0, 0x03,
-    0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xE0, 0x01, 0xFF, 0xF4, 0x00,
-    0xFD, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xC0, 0x0F, 0xDB, 0xF0, 0x01, 0xFC, 0x03, 0xF8, 0xFE, 0x00,
-    0x2F, 0x80, 0xBE, 0x1F, 0xD0, 0x03, 0xF4, 0x2F, 0xC2, 0xFC, 0x00, 0x7F, 0x07, 0xF0, 0x3F, 0xC0,
-    0x0B, 0xF0, 0xFD, 0x07, 0xF4, 0x00, 0xFE, 0x3F, 0x40, 0xBF, 0x00, 0x0F, 0xDB, 0xE0, 0x0F, 0xF0,
-    0x01, 0xFE, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xC0, 0x03, 0xFC,
-    0x00, 0x7F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x03, 0xF8,
-    0x00, 0xF0, 0x00, 0xFB, 0x40, 0x1F, 0x00, 0x3D, 0xF0, 0x02, 0xE0, 0x0F, 0x8F, 0x00, 0x3D, 0x02,
-    0xE1, 0xE0, 0x03, 0xC0, 0xB8, 0x2D, 0x00, 0x7C, 0x1F, 0x03, 0xC0, 0x0B, 0xC7, 0xC0, 0x7C, 0x00,
-    0xF9, 0xF0, 0x0B, 0xC0, 0x0F, 0x7D, 0x00, 0xF8, 0x01, 0xFF, 0x40, 0x1F, 0x40, 0x2F, 0xE0, 0x02,
-    0xF0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x07,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xD0, 0x03, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x00,
-    0x03, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xD0,
-    0x07, 0xF7, 0xF0, 0x00, 0xFC, 0x00, 0xFD, 0xBF, 0x00, 0x1F, 0xC0, 0x3F, 0x4F, 0xE0, 0x03, 0xF8,
-    0x0B, 0xE1, 0xFD, 0x00, 0x3F, 0x42, 0xFC, 0x2F, 0xC0, 0x07, 0xF0, 0x7F, 0x03, 0xF8, 0x00, 0xBF,
-    0x0F, 0xC0, 0x7F, 0x40, 0x0F, 0xE3, 0xF4, 0x0F, 0xF0, 0x00, 0xFD, 0xBE, 0x00, 0xFF, 0x00, 0x1F,
-    0xEF, 0xC0, 0x1F, 0xE0, 0x03, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xC0, 0x07,
-    0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xD0,
-    0x00, 0x2F, 0x40, 0xFD, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x01, 0xFC, 0x00,
-    0xF4, 0x00, 0x3F, 0x80, 0x0F, 0x00, 0x0F, 0xB4, 0x01, 0xF0, 0x03, 0xDF, 0x00, 0x2E, 0x00, 0xF8,
-    0xF0, 0x03, 0xD0, 0x2E, 0x1E, 0x00, 0x3C, 0x0B, 0x82, 0xD0, 0x07, 0xC1, 0xF0, 0x3C, 0x00, 0xB8,
-    0x7C, 0x07, 0xC0, 0x0F, 0x9F, 0x00, 0xBC, 0x00, 0xF7, 0xD0, 0x0F, 0x80, 0x1F, 0xF4, 0x01, 0xF4,
-    0x02, 0xFE, 0x00, 0x2F, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0,
-    0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x56, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00,
-    0x1F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0,
-    0x00, 0x03, 0xFD, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x7F,
-    0x82, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF9, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x02, 0xF4, 0x03, 0xC0, 0x0B, 0xC0, 0x02, 0xD0, 0x0F, 0x40,
-    0x02, 0xE0, 0x2F, 0x00, 0x02, 0xE0, 0x3D, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x07, 0xC0, 0x7C, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x0B, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0x07, 0xE0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xAA, 0xBF, 0x00, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xAE, 0x90, 0x00, 0x00, 0x00, 0x02,
-    0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x03,
-    0xD0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0x57, 0xF0,
-    0x1F, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x01, 0xFC, 0x00, 0xFF, 0xEF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0x7E, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0xAA, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x0F, 0xF4, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x06, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x3F, 0x40,
-    0xFC, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xF5, 0x5F, 0xC0, 0x01, 0xF4,
-    0x00, 0x7C, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0x95, 0x55, 0xFC, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x1F, 0x40, 0x07, 0xF0, 0x00, 0xFF, 0xEF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x0F, 0xC0,
-    0x00, 0x01, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00,
-    0x7C, 0x00, 0x00, 0xBD, 0x00, 0x14, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x01, 0xAA, 0xAA, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFD,
-    0x00, 0x07, 0xF8, 0x02, 0xFF, 0xFE, 0xBF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F,
-    0xC0, 0xFE, 0x00, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x01, 0xBF, 0xFE, 0x00, 0x0F, 0x50, 0x2F, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFA, 0xBF, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0xC0, 0x02, 0xFD, 0x07, 0xFA, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x03,
-    0xE0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0x07, 0xD0, 0x7E, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0xBD,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00,
-    0x3F, 0x80, 0xFD, 0x00, 0x01, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x28, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x0B,
-    0xC0, 0x3F, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x3F,
-    0x80, 0xFD, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00,
-    0x7D, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0x0B, 0xD0, 0xFC, 0x00,
-    0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF8,
-    0x00, 0x0F, 0xC0, 0x01, 0xE8, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00,
-    0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x7E, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x01, 0x90, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFD, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x1F, 0x80, 0xBE, 0x00,
-    0x3F, 0x80, 0xFD, 0x00, 0x7F, 0x42, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x24, 0x07, 0xC0, 0x00, 0x78, 0x0B, 0x80, 0x00, 0xF4, 0x0F,
-    0x40, 0x00, 0xF0, 0x0F, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x02, 0xF0, 0x2E, 0x00, 0x03, 0xE0, 0x3D,
-    0x00, 0x07, 0xD0, 0x3C, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x2F, 0xC0, 0x7E, 0x01, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x03, 0xF4, 0x0F, 0xC0, 0x7F, 0x02, 0xFC, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xD0,
-    0x07, 0x00, 0x1C, 0x00, 0xB0, 0x02, 0xC0, 0x0E, 0x00, 0x38, 0x01, 0xD0, 0x03, 0x40, 0x2C, 0x00,
-    0x70, 0x07, 0xC0, 0x07, 0x81, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x00, 0x3F, 0xFF, 0xD0, 0x0E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x2F, 0x80, 0x03, 0xFA, 0xBF, 0x80, 0x03, 0xF4,
-    0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x0B, 0xF0, 0x00, 0xB8, 0x00,
-    0x1E, 0x00, 0xFE, 0x00, 0x0F, 0x40, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0xF0, 0x00, 0xBC, 0x02, 0xFC,
-    0x00, 0x2F, 0x01, 0xBF, 0xC0, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0x02,
-    0xF8, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x09, 0x02, 0xF0, 0x00, 0x00, 0x2D, 0x03, 0xF0, 0x00, 0x00, 0x3C, 0x03, 0xE0,
-    0x00, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0x78, 0x07, 0xD5, 0x00, 0x00, 0xF4, 0x0B, 0xFF, 0xFD,
-    0x00, 0xF0, 0x0F, 0x80, 0x0B, 0x01, 0xF0, 0x0F, 0x40, 0x03, 0x82, 0xE0, 0x1F, 0x00, 0x07, 0x83,
-    0xD0, 0x2F, 0x00, 0x1F, 0x47, 0xC0, 0x3F, 0x56, 0xFF, 0x0B, 0xC0, 0x3F, 0xFF, 0xFC, 0x0F, 0x80,
-    0x3F, 0xFF, 0x90, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF6, 0x80, 0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x01,
-    0xE0, 0x07, 0xC0, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xEB, 0xC0, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xF0, 0x0B,
-    0xE0, 0x07, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x1A, 0xAA, 0xAA,
-    0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x1A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x02, 0xC0, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x1D, 0x00, 0x74, 0x00, 0x0F, 0x00,
-    0x2C, 0x00, 0x03, 0x80, 0x0F, 0x00, 0x01, 0xD0, 0x03, 0x80, 0x00, 0xB0, 0x01, 0xD0, 0x00, 0x3C,
-    0x00, 0xB0, 0x00, 0x1D, 0x00, 0x38, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x0B, 0x00, 0x00,
-    0xE0, 0x03, 0xC0, 0x00, 0x74, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0xB0, 0x00, 0x0E, 0x00, 0x3C, 0x00,
-    0x07, 0x40, 0x0E, 0x00, 0x02, 0xC0, 0x07, 0x40, 0x00, 0xF0, 0x02, 0xC0, 0x00, 0x74, 0x00, 0xE0,
-    0x00, 0x2C, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x2C, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0xAA, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xAA, 0xA9, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xFC,
-    0x01, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x80,
-    0xBF, 0x00, 0x00, 0x55, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0,
-    0xBF, 0x40, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xFC, 0x01, 0xFD,
-    0xBF, 0x8B, 0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xD2, 0xFD, 0x00, 0xFE, 0x0F, 0xE0, 0x07, 0xF0,
-    0xBF, 0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x1F, 0xD0, 0x03, 0xFD, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC,
-    0x0B, 0xF4, 0xBF, 0x00, 0xFF, 0x0F, 0xE0, 0x1F, 0xC1, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0xBF, 0x0B,
-    0xF0, 0x00, 0x00, 0x55, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0,
-    0xBF, 0x40, 0x7F, 0xC7, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xE1, 0xFE, 0x00, 0xFF, 0x0F, 0xF0,
-    0x03, 0xF4, 0x7F, 0x40, 0x2F, 0xC2, 0xFC, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x60, 0x02, 0xF8, 0x0F, 0xFC, 0x7F, 0xF6, 0xFD, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8,
-    0xFE, 0xBF, 0x40, 0x00, 0x03, 0xF2, 0xF8, 0xFE, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x2F, 0x80, 0x0F, 0xD0, 0x0B, 0xE3, 0xF8, 0x01, 0xFD, 0x00, 0xFE,
-    0xBF, 0x40, 0x2F, 0xC0, 0x1F, 0xD0, 0x68, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x09, 0x80, 0x00, 0x34, 0x00, 0x20, 0x40, 0x00, 0xE0, 0x00, 0x31, 0x80,
-    0x03, 0xC0, 0x00, 0x64, 0xC0, 0x0F, 0x00, 0x00, 0x91, 0x80, 0x2C, 0x00, 0x00, 0xBB, 0x40, 0xB4,
-    0x00, 0x00, 0x3D, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x51, 0x22, 0x00, 0x00, 0xF0,
-    0xA1, 0x96, 0x00, 0x03, 0xD0, 0x88, 0xC6, 0x00, 0x0F, 0x81, 0xDC, 0xDC, 0x00, 0x2E, 0x00, 0xF0,
-    0xB4, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F,
-    0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0xBF, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x0B, 0xF4,
-    0xBF, 0x00, 0xFF, 0x0F, 0xE0, 0x1F, 0xC1, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0xBF, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x03, 0x40, 0x34, 0x0F, 0x80, 0x7C, 0x07, 0xD1, 0xF0, 0x0F,
-    0x80, 0xBC, 0x2E, 0x00, 0xF0, 0x0F, 0x43, 0xC0, 0x1E, 0x00, 0xF0, 0x34, 0x02, 0x80, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0xD0, 0xB8, 0x0F, 0x02, 0xD0, 0x28, 0x00, 0x00, 0x00,
-    0x70, 0x1D, 0x03, 0xE0, 0xF8, 0x0B, 0xC1, 0xF0, 0x0F, 0x03, 0xD0, 0x2D, 0x07, 0x80, 0x28, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1D, 0x00, 0xB0, 0x3D, 0x03, 0xE0, 0x1F, 0x02, 0xE0,
-    0x1F, 0x00, 0xF4, 0x0F, 0x00, 0xF0, 0x07, 0xC0, 0xB4, 0x07, 0x80, 0x3C, 0x03, 0x80, 0x28, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xF4, 0x00, 0x7C, 0xF4, 0x0B, 0xC1, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x01, 0xFC,
-    0x00, 0xFD, 0x00, 0xBE, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x87,
-    0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x3F, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x1F, 0xFC, 0x00, 0x00,
-    0xFD, 0x00, 0x02, 0xFD, 0x7F, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0x4F,
-    0x4B, 0xE0, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,
-    0x3D, 0x07, 0xD0, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x0B, 0xC2, 0xF4, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x00, 0xFA, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF0, 0x24, 0x00, 0x14, 0xE0, 0x00, 0xD3, 0xE4, 0x6F, 0x07, 0xFF, 0xF0, 0x07, 0xF9, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x4C, 0xB0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7B, 0x7C, 0x00, 0x00, 0x08, 0x30, 0x40, 0x00,
-    0x00, 0x06, 0x01, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x47, 0x09, 0xC3, 0x2C, 0x2E, 0xAB, 0x4B,
-    0xFD, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x07, 0xF9, 0x1E, 0xDF, 0x03, 0x9C, 0xB2, 0x0C, 0x10, 0x01,
-    0x80, 0x01, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFE, 0x00, 0x2F, 0x80, 0x7F, 0x83, 0xF4, 0x0B, 0xF4, 0x01, 0x80, 0x00, 0xFC, 0x18, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xE5,
-    0x7F, 0xD0, 0x0B, 0x02, 0xC0, 0x02, 0xF8, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00, 0x00,
-    0xFC, 0x1F, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x00, 0xBE,
-    0x01, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00,
-    0x1F, 0x80, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xFC,
-    0x00, 0x0B, 0xD0, 0x01, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x5F, 0xF0, 0x00, 0x00, 0x01, 0x28, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0x48, 0x09, 0x05, 0x0C, 0x09,
-    0x18, 0xC9, 0x34, 0x8C, 0x34, 0x2C, 0x38, 0xB4, 0x3F, 0xF0, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x28,
-    0x00, 0xB8, 0x02, 0xE4, 0x0B, 0x30, 0x2C, 0x70, 0x3F, 0xFC, 0x00, 0xE0, 0x00, 0xD0, 0x02, 0xD0,
-    0x03, 0xFE, 0x05, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x1F, 0xE0, 0x00, 0x2C, 0x00, 0x2C, 0x10, 0x78,
-    0x7F, 0xF0, 0x6F, 0x80, 0x00, 0xBF, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0x7B, 0xD0, 0x3D, 0x1C, 0x0D,
-    0x03, 0x03, 0x47, 0x80, 0xBF, 0xC0, 0x06, 0x40, 0x00, 0x7F, 0xF8, 0x00, 0xD0, 0x0B, 0x00, 0x34,
-    0x02, 0xC0, 0x0E, 0x00, 0xB0, 0x07, 0xC0, 0x3D, 0x00, 0xA0, 0x00, 0x00, 0x64, 0x00, 0xD1, 0x80,
-    0xA0, 0x60, 0x28, 0x74, 0x03, 0xF0, 0x07, 0x4B, 0x03, 0x41, 0xC1, 0xC0, 0xB0, 0x78, 0xB4, 0x0B,
-    0xF4, 0x00, 0x01, 0xFC, 0x02, 0x82, 0x80, 0xC0, 0x70, 0x70, 0x28, 0x1D, 0x6E, 0x02, 0xFF, 0x00,
-    0x01, 0xC0, 0xEB, 0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x74, 0xAF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0xFF, 0x91, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0xF4, 0x07,
-    0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x07, 0xE0, 0x2F,
-    0x80, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x1F, 0xC0, 0x00,
-    0x2A, 0x80, 0x00, 0xE0, 0x30, 0x03, 0xC0, 0x30, 0x07, 0x00, 0x34, 0x0F, 0x1C, 0x34, 0x0E, 0x3C,
-    0x70, 0x2D, 0x38, 0xB0, 0x2C, 0x10, 0xE0, 0x3C, 0x03, 0xD0, 0x3E, 0x1F, 0xC0, 0x3F, 0xFF, 0x40,
-    0x2F, 0xFD, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x50, 0x3E, 0x00, 0xD0, 0x0C, 0x02, 0xC0, 0x38, 0x03,
-    0x40, 0x70, 0x7F, 0xEF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x50, 0xA0, 0x00, 0x28, 0x00, 0x0D,
-    0x00, 0x1E, 0x00, 0x2E, 0x00, 0x7D, 0x00, 0x7F, 0xF4, 0x3F, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x01,
-    0x80, 0x00, 0x90, 0x0F, 0xE0, 0x00, 0x24, 0x00, 0x0B, 0x00, 0x03, 0x81, 0xFF, 0xC0, 0x7F, 0x80,
-    0x00, 0x00, 0x04, 0x00, 0x2C, 0x00, 0xB8, 0x02, 0xE4, 0x0B, 0x30, 0x2C, 0x74, 0x3F, 0xFC, 0x00,
-    0xE0, 0x00, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x0C, 0x00, 0x0C, 0x00, 0x1F, 0xE0, 0x00,
-    0x34, 0x00, 0x34, 0x10, 0xB0, 0x7F, 0xE0, 0x6E, 0x40, 0x00, 0xBF, 0x00, 0xD0, 0x00, 0xD0, 0x00,
-    0x7B, 0xD0, 0x3D, 0x1C, 0x0E, 0x03, 0x03, 0x02, 0xC0, 0xFB, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x03, 0x00, 0x38, 0x01, 0xC0, 0x0F, 0x00, 0x74, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x01,
-    0x40, 0x00, 0x00, 0x64, 0x00, 0xD1, 0xC0, 0xA0, 0x70, 0x28, 0x34, 0x03, 0xF4, 0x07, 0x4B, 0x03,
-    0x40, 0xC1, 0xC0, 0x70, 0x79, 0x78, 0x0B, 0xF4, 0x00, 0x01, 0xFC, 0x02, 0x82, 0x80, 0xC0, 0x70,
-    0x60, 0x28, 0x1D, 0x1E, 0x02, 0xFF, 0x00, 0x01, 0xC0, 0xEB, 0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8,
-    0x3D, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0xF4, 0x00, 0x00, 0x0F,
-    0xF7, 0xC1, 0xF0, 0x00, 0x00, 0x1F, 0xCF, 0x03, 0xC0, 0x00, 0x00, 0x3F, 0x5E, 0x0B, 0x80, 0x00,
-    0x00, 0xBF, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0xFD, 0xB8, 0x2E, 0x00, 0x00, 0x01, 0xFD, 0xF0, 0x3C,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0xB4, 0x00, 0x00, 0x02, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x83, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xD6, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xDB, 0xFF, 0xFE, 0x40, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x76, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x10, 0x00, 0xBF, 0x00,
-    0x0F, 0x00, 0x00, 0x0F, 0xF8, 0x02, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x3D, 0x04, 0x00, 0x0F, 0xFF,
-    0xFB, 0xEF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x46, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0xBE, 0xAA, 0xA8, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x5B, 0xD5, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0x94, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0, 0x0B, 0xF0, 0x00,
-    0x0B, 0xF3, 0xF4, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0xFE, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x3F, 0x80,
-    0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xE0, 0x3F, 0x4B, 0xF0, 0x00, 0x0B, 0xF4, 0x0F, 0xE3, 0xF4, 0x00, 0x03, 0xFC, 0x02, 0xF9, 0xFC,
-    0x00, 0x01, 0xFF, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xD0,
-    0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFD, 0x56, 0xFF,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xAF, 0xFA, 0xAA, 0xBF, 0x90, 0x01, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x57, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x0B, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0xFA, 0xBF, 0xC0, 0x00, 0x3F, 0xFC, 0x02,
-    0xFF, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xD0, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0xD0, 0x00, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x0F, 0x00, 0x00,
-    0xBF, 0x80, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xF4,
-    0x1F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x2F, 0x80, 0x3F, 0x00, 0x03, 0xEB, 0xF4, 0x3F, 0x40,
-    0x3F, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0x00, 0x7F, 0x00, 0x2F, 0xFF, 0xD0, 0x7F, 0x00, 0xBF, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x80, 0x0B, 0x40,
-    0x00, 0x02, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00,
-    0x00, 0x2D, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x05, 0x7D, 0x6F, 0xE5, 0xF5, 0x00, 0x0F, 0x0F, 0xF8, 0x7C, 0x00, 0x03, 0xC7, 0xEE,
-    0x2D, 0x00, 0x00, 0xF3, 0xF7, 0xCF, 0x00, 0x00, 0x3D, 0xF5, 0xF7, 0xC0, 0x00, 0x0F, 0xFC, 0x7E,
-    0xE0, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFE,
-    0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x3A, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x3C, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0xB8,
-    0x01, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x01, 0xF0, 0x03, 0xD0, 0x24, 0x0F,
-    0x02, 0xF0, 0x07, 0xC0, 0xB8, 0x1E, 0x03, 0xE0, 0x0B, 0xC0, 0xF4, 0x2D, 0x03, 0xD0, 0x0F, 0x80,
-    0xF0, 0x3D, 0x07, 0xC0, 0x0F, 0x40, 0xF0, 0x28, 0x0B, 0xC0, 0x1F, 0x01, 0xE0, 0x00, 0x0F, 0x80,
-    0x2E, 0x01, 0xE0, 0x00, 0x1F, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0xF8, 0x00,
-    0xBE, 0x00, 0x7C, 0x00, 0xBF, 0xEB, 0xFD, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xF0, 0xE0, 0x00, 0x03, 0xFF, 0xED, 0x00, 0x00, 0xF4, 0x3F, 0xC0, 0x00, 0x3C, 0x01, 0xF8,
-    0x00, 0x0B, 0x00, 0x1F, 0x40, 0x00, 0xE0, 0x02, 0xF0, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x02, 0xF0,
-    0x1F, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x7C, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0x50, 0x50, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFE, 0xFE, 0xAF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x10, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0x9F,
-    0xD2, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x18, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xD5, 0x5B, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBD, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x40, 0x00, 0x00, 0x0A,
-    0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF9, 0xE0, 0x05, 0x00, 0x3F, 0xE0,
-    0x74, 0x00, 0x00, 0x3F, 0xD0, 0x2C, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x03,
-    0x80, 0x00, 0x03, 0xF4, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0xB0, 0x00, 0x00, 0xFE, 0x00, 0x2C,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0xA5, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xFF, 0x4B, 0xF0, 0x01, 0xEA,
-    0xFF, 0xD2, 0xFC, 0x00, 0xB0, 0x0F, 0xA0, 0xFF, 0x00, 0x3C, 0x07, 0xC0, 0x3F, 0xF0, 0x0E, 0x03,
-    0xF0, 0x0B, 0xFF, 0xEB, 0xEF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x10, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x01, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x06, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x0F, 0xEF, 0x00, 0x0B, 0xE3, 0xC0, 0x03, 0xE0, 0xE0, 0x01,
-    0xF0, 0x70, 0x00, 0xF8, 0x2C, 0x00, 0x3D, 0x0E, 0x00, 0x1F, 0x47, 0x40, 0x07, 0xE2, 0xC0, 0x01,
-    0xFE, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xA5, 0x5F, 0xD1, 0x55, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA8, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x0A, 0xAB, 0xEA, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x19, 0x00, 0x03, 0xEB, 0xF0, 0x00, 0x1F, 0xFE, 0x40,
-    0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x4F, 0x87, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x07,
-    0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0x4F, 0xBD, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0xC0, 0x0B, 0xC6,
-    0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x01, 0xBE, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xEE, 0x3F,
-    0x00, 0x02, 0xF5, 0xE0, 0xF0, 0x00, 0x3E, 0x1D, 0x0F, 0x00, 0x07, 0xC2, 0xC0, 0xF0, 0x00, 0xB4,
-    0x3C, 0x0E, 0x00, 0x0F, 0x03, 0x81, 0xD0, 0x00, 0xF0, 0x74, 0x2C, 0x00, 0x1D, 0x0B, 0x03, 0xC0,
-    0x02, 0xC0, 0xF0, 0x38, 0x00, 0x3C, 0x0E, 0x0B, 0x40, 0x03, 0xC1, 0xD0, 0xF0, 0x00, 0x78, 0x2C,
-    0x1F, 0x00, 0x07, 0x83, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xD5, 0x5F, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xAB, 0xFA, 0xA9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x01, 0xD0, 0x01, 0xBE, 0x03, 0xC1, 0xBF,
-    0xF9, 0x0F, 0xBF, 0xFE, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xF6, 0xD7, 0xE0, 0x0F, 0x83, 0xC1, 0xF4, 0x7D, 0x03, 0xC0,
-    0x7C, 0x70, 0x07, 0x80, 0x10, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x40, 0x00, 0x1E, 0x00, 0xBE, 0x40, 0x0B, 0x40, 0x6F, 0xFE, 0x43, 0xC0, 0x01, 0xBF, 0xFE,
-    0xE0, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x30, 0x07, 0x80,
-    0x10, 0x7D, 0x03, 0xC0, 0x7C, 0x0F, 0x82, 0xC1, 0xF8, 0x02, 0xF5, 0xD3, 0xE0, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x1B, 0xDF, 0x90, 0x0F, 0x00, 0x1C,
-    0x2F, 0xF9, 0x1B, 0xFE, 0x0D, 0x00, 0xFF, 0xF9, 0x00, 0x01, 0xBF, 0xFC, 0x0F, 0xE4, 0x00, 0x00,
-    0x00, 0x06, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xFF, 0xC0, 0x02, 0xD7, 0x1F, 0x01, 0xF0, 0xB0, 0xB8, 0x38, 0x0E, 0x02, 0x80, 0x00, 0xD0,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0xE0, 0x00, 0x3C, 0x0F, 0x03, 0x80, 0xF4,
-    0xB0, 0xF4, 0x01, 0xE7, 0x6E, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x6B, 0x00, 0x16, 0xFF, 0xFC, 0x07, 0xFF, 0x94, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3E,
-    0xF8, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x03, 0xC0, 0x7F, 0x40, 0x0F, 0x00, 0x2F, 0xD0, 0x3C, 0x00,
-    0x0B, 0xE0, 0xF0, 0x00, 0x07, 0xD1, 0x40, 0x00, 0x00, 0x00, 0x03, 0xA4, 0x00, 0x00, 0x0F, 0xFF,
-    0xE5, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x2F, 0xC3,
-    0xC0, 0x07, 0xF4, 0x0F, 0x01, 0xFE, 0x00, 0x3C, 0x3F, 0x80, 0x00, 0xF1, 0xF0, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x40, 0x2C, 0x03, 0xC0, 0x3C, 0x02, 0xD0, 0x38, 0x00, 0xF0, 0x74, 0x00, 0xF4, 0xB0, 0x00,
-    0x7C, 0xF0, 0x00, 0x3D, 0xE0, 0x00, 0x1F, 0xD0, 0xBA, 0x5F, 0xC0, 0xFF, 0xFF, 0xC0, 0x05, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0,
-    0x74, 0x02, 0xE0, 0x38, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x2C, 0x0F, 0x00, 0x0D, 0x1E, 0x00, 0x0E,
-    0x3C, 0x00, 0x0B, 0x78, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF5, 0xAE, 0x03, 0xFF, 0xFF, 0x02, 0xFE,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x74, 0x34, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00,
-    0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0xE0, 0xBB, 0xC0, 0x00, 0xF8, 0xD0, 0xE3, 0xE0, 0x07, 0xE1,
-    0xC0, 0xD1, 0xF4, 0x1F, 0x42, 0xC1, 0xC0, 0xBC, 0x3C, 0x03, 0x82, 0xC0, 0x38, 0x10, 0x03, 0x43,
-    0x80, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x00, 0x0B, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x0F, 0x00,
-    0x00, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x1D, 0x00, 0x00, 0x00, 0x28, 0x2C, 0x00, 0x00,
-    0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x70, 0x34, 0x00, 0x00,
-    0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x1C, 0x00, 0x00, 0x00,
-    0x0C, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x07,
-    0x07, 0x00, 0x00, 0x74, 0x03, 0x03, 0x80, 0x30, 0x7E, 0x03, 0x43, 0xC0, 0xBC, 0x0F, 0x82, 0x82,
-    0xC1, 0xF4, 0x02, 0xF1, 0xC1, 0xD3, 0xE0, 0x00, 0xBD, 0xD0, 0xEB, 0xC0, 0x00, 0x1F, 0xE0, 0xBF,
-    0x00, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x34, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2E, 0xFD, 0x00, 0x00, 0x7C, 0xBF, 0xD0, 0x01, 0xF0, 0xA7, 0xFC, 0x07, 0xF0, 0xA0,
-    0x70, 0x1F, 0xF0, 0xA0, 0x00, 0x7E, 0x70, 0xA0, 0x00, 0x28, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0,
-    0x00, 0x00, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x00, 0x70, 0xA0,
-    0x00, 0x00, 0x70, 0xA0, 0x00, 0x28, 0x70, 0xA0, 0x00, 0x7E, 0x70, 0xA0, 0x00, 0x1F, 0xF0, 0xA0,
-    0x00, 0x07, 0xF0, 0xA0, 0x70, 0x01, 0xF0, 0xA7, 0xFC, 0x00, 0x7C, 0xBF, 0xD0, 0x00, 0x2E, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x0B, 0xF8, 0x0F, 0x00, 0x01, 0xFF, 0xFC, 0x78, 0x00, 0x2F, 0x80, 0xBB, 0xC0, 0x01, 0xF8, 0x00,
-    0xFF, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x3D, 0x00,
-    0x0B, 0xC0, 0x02, 0xE0, 0x00, 0x2F, 0xD5, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xA0, 0x3C, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x07, 0xFF, 0x56,
-    0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xD0, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xCB, 0xE0, 0x00, 0x3F, 0x40, 0x02,
-    0xE0, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0x3D, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x01, 0xF8, 0x07, 0xC0, 0x01, 0xF8, 0x00, 0x2F, 0x81, 0xF0,
-    0x00, 0x3F, 0x40, 0x02, 0xF8, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x02, 0xFF, 0xD5, 0x5B, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x6F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xC0, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xE0,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x2F, 0x80, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xE5,
-    0x55, 0x57, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x01,
-    0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x7C,
-    0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0xF4,
-    0x01, 0xF0, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-    0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x14, 0x00,
-    0x28, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00,
-    0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-    0xBC, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x2F, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x7C, 0x00,
-    0xF8, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F,
-    0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFE, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x20, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x06, 0xF8, 0x00,
-    0x0F, 0xFF, 0xE1, 0xFF, 0xE0, 0x03, 0xF9, 0x5F, 0x7E, 0x5F, 0x00, 0xBC, 0x00, 0x7F, 0x40, 0x34,
-    0x0F, 0x00, 0x03, 0xD0, 0x03, 0x41, 0xE0, 0x00, 0x7C, 0x00, 0x34, 0x2C, 0x00, 0x0B, 0x80, 0x07,
-    0x03, 0xC0, 0x01, 0xFC, 0x01, 0xE0, 0x3E, 0x45, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x7F, 0xFF,
-    0x80, 0x0F, 0xFF, 0xD3, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x0F, 0xF0,
-    0x0B, 0xF8, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x38, 0x03, 0xF0, 0xB4, 0x0F, 0x40, 0xBC, 0x03, 0xE7, 0xE0, 0x06, 0x40, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0x40, 0x1F,
-    0x9F, 0x40, 0x7C, 0x03, 0xD0, 0x3D, 0x1F, 0x40, 0xBC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xEF, 0x40, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x50,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x1A, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0x5A, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00,
-    0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0xAB, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFE, 0xA5, 0x00, 0x3E, 0xA5, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_12_italicBitmaps[32629] = {
+    0x75, 0x55, 0xBF, 0x73, 0xDC, 0x44, 0x14, 0xFE, 0x56, 0x72, 0x22, 0xCF, 0x2C, 0x58, 0x34, 0x99,
+    0x61, 0x62, 0x62, 0x55, 0xCC, 0xA4, 0x70, 0xAC, 0x86, 0xC2, 0xC5, 0xD9, 0xDA, 0x19, 0x8A, 0x94,
+    0x34, 0xB8, 0x86, 0x96, 0xCA, 0x8D, 0x67, 0x70, 0x61, 0x5B, 0x1A, 0xFB, 0x1F, 0x30, 0x33, 0x50,
+    0xD1, 0x52, 0x85, 0xC2, 0x29, 0x52, 0xB8, 0x38, 0x47, 0x0B, 0x2E, 0x28, 0x98, 0x01, 0xD1, 0x90,
+    0x56, 0x45, 0xA8, 0x23, 0x40, 0x0C, 0xBA, 0x44, 0xA7, 0xE5, 0x7B, 0x2B, 0xE3, 0x1C, 0xE3, 0xA0,
+    0xB9, 0xDB, 0xBD, 0xDB, 0x7D, 0x3F, 0xBF, 0xF7, 0xBD, 0x27, 0xE0, 0x16, 0x30, 0x01, 0x0E, 0x80,
+    0x73, 0xA0, 0x85, 0x6A, 0x10, 0x34, 0x08, 0x6B, 0x44, 0x15, 0xB4, 0x45, 0x6C, 0x91, 0x14, 0x48,
+    0x0D, 0x32, 0xE0, 0x08, 0xB8, 0x00, 0x7A, 0xFF, 0xF1, 0x4F, 0x5C, 0x23, 0xA9, 0x91, 0x55, 0xC8,
+    0x2B, 0x94, 0x16, 0xE5, 0x49, 0x9F, 0xD4, 0xE5, 0x87, 0x7D, 0x5A, 0xB9, 0xA8, 0x4D, 0xED, 0x10,
+    0xB5, 0x99, 0x1D, 0x74, 0x43, 0xC1, 0x46, 0xD5, 0x5C, 0x55, 0x13, 0x56, 0xDC, 0x82, 0x3A, 0xB4,
+    0xDC, 0x42, 0xAB, 0x0B, 0x6E, 0xDA, 0xC6, 0x46, 0x4C, 0x15, 0x09, 0x57, 0x27, 0x4F, 0x1F, 0xFA,
+    0xAD, 0x05, 0x0E, 0x31, 0x15, 0x37, 0x53, 0x74, 0xB2, 0x75, 0x4A, 0x4C, 0x05, 0x6D, 0x28, 0x5B,
+    0xD8, 0x44, 0x62, 0x2B, 0xAA, 0x19, 0x23, 0x32, 0xAF, 0x80, 0x5C, 0xD6, 0x01, 0x48, 0x8B, 0x4C,
+    0xE4, 0x33, 0x09, 0x18, 0xC8, 0x25, 0x68, 0x60, 0xEE, 0xA3, 0x56, 0x7D, 0xD0, 0xE1, 0xE6, 0xD3,
+    0x78, 0x93, 0x97, 0x12, 0x4F, 0x52, 0x7E, 0x43, 0xB3, 0xCE, 0xF1, 0xA4, 0x74, 0xCE, 0x42, 0xBB,
+    0x8F, 0x08, 0x50, 0x7E, 0xBE, 0x49, 0x81, 0xD9, 0x2F, 0xF4, 0x19, 0xFF, 0xA8, 0xC5, 0xEA, 0x64,
+    0x22, 0xF1, 0xFE, 0xC5, 0xBC, 0x02, 0xE7, 0x2A, 0xBF, 0x32, 0x62, 0xBC, 0x72, 0x9D, 0x58, 0x92,
+    0xDF, 0x2B, 0x2B, 0x62, 0x64, 0xEF, 0x73, 0x1A, 0x09, 0xBE, 0x7F, 0xE1, 0x90, 0x9D, 0x9D, 0xB9,
+    0xD6, 0xE7, 0x56, 0x48, 0xC0, 0x5D, 0xE8, 0xA3, 0x55, 0xA5, 0x1B, 0xCC, 0x75, 0x08, 0x27, 0x12,
+    0xC2, 0xF2, 0xBB, 0x8B, 0xB1, 0xAD, 0xCB, 0xB2, 0x87, 0xA7, 0x50, 0x75, 0xF8, 0xCC, 0x86, 0xC5,
+    0x0A, 0x6C, 0x8C, 0xF7, 0x60, 0x27, 0x58, 0x57, 0xF6, 0x09, 0xEE, 0x87, 0xC7, 0x35, 0xB6, 0x56,
+    0x1F, 0x16, 0x48, 0x06, 0x42, 0xA8, 0xDB, 0x43, 0x91, 0x17, 0xCF, 0x61, 0xC3, 0x98, 0x63, 0xBB,
+    0x2E, 0x80, 0xDC, 0x67, 0x36, 0xE6, 0x03, 0xA8, 0x3F, 0xBF, 0x68, 0x10, 0x5D, 0x32, 0xA2, 0xD8,
+    0x3C, 0x05, 0xB6, 0x16, 0xDC, 0xEC, 0x9E, 0x52, 0x58, 0x82, 0xCF, 0xCC, 0x81, 0x40, 0xCE, 0xBB,
+    0x8E, 0x05, 0x20, 0xEA, 0xC4, 0xED, 0x22, 0xA6, 0xBD, 0xAC, 0x64, 0x70, 0xF1, 0x5C, 0x92, 0x6F,
+    0x24, 0x5F, 0xCA, 0xEA, 0xEE, 0x02, 0xEF, 0x24, 0x75, 0x6A, 0x2E, 0x32, 0x1B, 0x7F, 0xD7, 0xE7,
+    0x45, 0xF8, 0x77, 0x5B, 0x1A, 0xB8, 0xAA, 0xB4, 0xCA, 0x15, 0xF9, 0x6C, 0xD7, 0x19, 0xA6, 0xFA,
+    0xCA, 0xC6, 0xCE, 0x1D, 0x1B, 0x55, 0x3E, 0xBF, 0xF2, 0x75, 0xC7, 0xB8, 0xB0, 0xD7, 0x4D, 0x62,
+    0x33, 0xE3, 0xE4, 0x7F, 0x58, 0x88, 0x33, 0x6C, 0x10, 0x78, 0x2B, 0x1C, 0xC4, 0xB6, 0xF0, 0x82,
+    0x98, 0xF8, 0x5F, 0x72, 0xC6, 0x5B, 0x26, 0x47, 0x56, 0x0A, 0x55, 0xF5, 0x78, 0x40, 0xDE, 0x08,
+    0x23, 0x52, 0x61, 0x94, 0xCF, 0x45, 0xD8, 0x25, 0x9B, 0xF5, 0x52, 0xB2, 0x2D, 0x1C, 0xD6, 0x42,
+    0x08, 0x84, 0xA3, 0x02, 0x3E, 0xF5, 0x22, 0xA2, 0x17, 0x17, 0xFE, 0x5E, 0x2C, 0x69, 0xFB, 0xFA,
+    0xE7, 0x78, 0xCA, 0x4E, 0x10, 0x37, 0xE2, 0x2D, 0x1A, 0x2F, 0x45, 0x45, 0x98, 0x7A, 0x75, 0x71,
+    0x3E, 0x6A, 0x1D, 0x8C, 0xF7, 0x37, 0x36, 0xB9, 0x9B, 0x4A, 0x11, 0xC6, 0x0C, 0x0A, 0xA8, 0x53,
+    0xC9, 0x37, 0x60, 0x4C, 0x8F, 0x97, 0x36, 0x27, 0x0F, 0xD2, 0x9F, 0x0E, 0x51, 0xB6, 0x88, 0x1A,
+    0x24, 0xAE, 0x3A, 0xDA, 0xBC, 0xB8, 0xF7, 0xF6, 0x6D, 0x90, 0x5D, 0x01, 0xBD, 0xAB, 0xCA, 0x3B,
+    0x61, 0x94, 0x6B, 0xB4, 0x63, 0x88, 0xE0, 0x33, 0x21, 0xE5, 0x3E, 0xF0, 0x80, 0x06, 0xBD, 0x07,
+    0x11, 0xD9, 0x09, 0xE7, 0x84, 0xB2, 0x8D, 0x9B, 0xA4, 0xCA, 0x6C, 0x69, 0xEE, 0x3E, 0x7A, 0x44,
+    0xC9, 0x1F, 0x44, 0x32, 0xFC, 0xA3, 0x1B, 0x4A, 0xE3, 0xF1, 0x0E, 0xFC, 0xAA, 0xFD, 0x1F, 0xDF,
+    0x7B, 0x3E, 0x82, 0x31, 0x8B, 0xEB, 0x75, 0xDF, 0xAF, 0x13, 0xBF, 0x6E, 0x8C, 0xED, 0x3D, 0xAA,
+    0x15, 0xAF, 0xD5, 0x7C, 0xFF, 0x7A, 0x80, 0xE0, 0xEB, 0x04, 0x9F, 0xE5, 0x1B, 0xD5, 0x62, 0xAF,
+    0x16, 0x8D, 0x6A, 0xF5, 0x0D, 0x35, 0xDF, 0xD8, 0x57, 0x04, 0xF4, 0xDD, 0x8A, 0xC4, 0xBC, 0x59,
+    0x2D, 0x18, 0xD5, 0xBA, 0x05, 0xB5, 0xC3, 0x05, 0xB5, 0x35, 0xBF, 0xBE, 0xF5, 0xDF, 0x7E, 0xDE,
+    0x65, 0x9C, 0x2D, 0x6F, 0x9A, 0xC0, 0xD2, 0xDF, 0x3E, 0xD5, 0xD6, 0xB0, 0xB5, 0x14, 0x15, 0xA9,
+    0x3E, 0xAE, 0xE3, 0x93, 0xBA, 0x8D, 0xAA, 0x76, 0x12, 0x34, 0x93, 0x14, 0xFD, 0x72, 0xCC, 0x61,
+    0xA1, 0xAB, 0xD8, 0x86, 0x4D, 0xD8, 0x46, 0x1D, 0xDC, 0x59, 0xCF, 0x71, 0x32, 0x67, 0xDB, 0x73,
+    0x90, 0xC8, 0x57, 0xFF, 0x3B, 0x2F, 0x52, 0x2B, 0xBC, 0xDF, 0xEA, 0xB0, 0x34, 0xF1, 0x14, 0x60,
+    0xA4, 0x84, 0x43, 0x92, 0x9A, 0x7A, 0x9A, 0x32, 0x7E, 0x96, 0x9B, 0x04, 0x53, 0x1D, 0xEE, 0x0C,
+    0x5F, 0x26, 0xCE, 0x69, 0xE7, 0x2E, 0x9D, 0xAB, 0xD9, 0xE2, 0xB5, 0x8C, 0xB6, 0x0A, 0xC9, 0x69,
+    0x0E, 0x65, 0x94, 0x20, 0x20, 0xE4, 0xF1, 0x80, 0x48, 0x16, 0xBA, 0x96, 0xC9, 0x24, 0x8D, 0xC5,
+    0xD3, 0x54, 0x18, 0x26, 0xBD, 0x35, 0xC8, 0x1C, 0x32, 0x6C, 0x34, 0x82, 0x91, 0xCF, 0x3E, 0x63,
+    0x77, 0xBA, 0x4A, 0x71, 0x3C, 0xCA, 0xB8, 0xE3, 0xD1, 0x6D, 0x57, 0x40, 0xBF, 0x9C, 0x43, 0x8D,
+    0xB5, 0xD9, 0xE3, 0xF7, 0xDE, 0x15, 0xFA, 0x11, 0x41, 0x5C, 0x65, 0x8F, 0x53, 0x22, 0x72, 0xC5,
+    0x95, 0x6D, 0x41, 0x56, 0x10, 0x15, 0xF7, 0x3C, 0xC8, 0xCF, 0xE6, 0x34, 0x34, 0x90, 0x78, 0x32,
+    0x83, 0x9E, 0x2F, 0x4C, 0x1B, 0x66, 0x21, 0x43, 0x92, 0xDC, 0x49, 0x1B, 0xE8, 0x9F, 0x11, 0xFC,
+    0xDE, 0x60, 0xBA, 0x81, 0x34, 0xAC, 0xB4, 0x3D, 0x0C, 0x66, 0x9F, 0xFC, 0x96, 0x79, 0x2E, 0xF6,
+    0x5E, 0x2A, 0x33, 0xC2, 0x5E, 0x94, 0xB4, 0xCF, 0xED, 0xEE, 0xB7, 0x12, 0x5D, 0xEF, 0xE9, 0x20,
+    0x7C, 0x7A, 0x32, 0xB2, 0x4B, 0xD5, 0xE3, 0xBC, 0xE0, 0xC4, 0x33, 0xCA, 0x48, 0x37, 0x08, 0x91,
+    0x64, 0x80, 0x6B, 0x7E, 0x13, 0xBB, 0x8C, 0xBC, 0x48, 0x39, 0xC0, 0x05, 0xF8, 0x9C, 0xA3, 0x33,
+    0xF5, 0x13, 0x71, 0x95, 0xB3, 0x21, 0x67, 0xA6, 0x47, 0x66, 0xAC, 0xB8, 0x90, 0x65, 0x1B, 0x63,
+    0xFB, 0xE9, 0xAF, 0x67, 0x62, 0x8D, 0x78, 0x98, 0x9E, 0xCE, 0x63, 0x93, 0xD1, 0x24, 0x33, 0x94,
+    0x37, 0xCC, 0xD4, 0x0F, 0xAE, 0xEC, 0x2B, 0xC7, 0x22, 0x3A, 0x01, 0x9E, 0xE2, 0xB3, 0x91, 0x62,
+    0xCE, 0xFD, 0x7A, 0x26, 0xA3, 0xB1, 0xF5, 0xBC, 0xDD, 0x1E, 0xEB, 0x68, 0x25, 0x0A, 0xD6, 0x4D,
+    0xD2, 0x21, 0x50, 0x83, 0x2F, 0x43, 0xC6, 0xF7, 0x5E, 0x25, 0x39, 0xB1, 0xFE, 0xA1, 0x7F, 0xDF,
+    0xB1, 0x88, 0x6A, 0x96, 0xB0, 0x68, 0xCC, 0xA6, 0x65, 0x86, 0x07, 0x54, 0x4E, 0x88, 0x6A, 0x64,
+    0x69, 0x61, 0x4E, 0xC6, 0x09, 0xDC, 0x9A, 0xE5, 0x4E, 0xAB, 0x23, 0x4E, 0x5C, 0xBE, 0xD7, 0x0A,
+    0xD5, 0xD2, 0xF2, 0x21, 0x4D, 0x67, 0xB4, 0x9A, 0x15, 0xE9, 0xCB, 0xD2, 0x32, 0xE8, 0x02, 0xAB,
+    0x83, 0xF0, 0x9A, 0xB5, 0x4D, 0x5F, 0xD4, 0x98, 0x06, 0x2D, 0x89, 0xD0, 0xB1, 0x88, 0x1D, 0x69,
+    0xDF, 0xB1, 0xDD, 0xBA, 0x98, 0x1C, 0x89, 0x8B, 0xB0, 0xD1, 0x55, 0xD2, 0xF0, 0x55, 0x54, 0x2B,
+    0x21, 0xCF, 0xAD, 0x87, 0x76, 0x6C, 0xC6, 0xD4, 0xBC, 0xBF, 0x33, 0x78, 0x98, 0x4B, 0xE6, 0x52,
+    0xD2, 0x0C, 0xED, 0xA7, 0x36, 0x6E, 0x74, 0xA7, 0x76, 0x16, 0xBB, 0xE0, 0xE3, 0xEB, 0x73, 0xFC,
+    0xFF, 0xF3, 0x0F, 0x8D, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x64, 0xD7, 0xD2, 0x5A,
+    0xCA, 0x54, 0x54, 0x2B, 0xE1, 0x0F, 0xA0, 0x98, 0x96, 0x86, 0x1D, 0x4B, 0x29, 0x28, 0x10, 0x5A,
+    0x8A, 0x3C, 0x21, 0xC1, 0x1F, 0xD0, 0xE4, 0x13, 0x6C, 0xF1, 0x05, 0x69, 0xA8, 0x68, 0x52, 0x40,
+    0x41, 0x9A, 0xE5, 0x03, 0x76, 0x9F, 0x67, 0x85, 0x44, 0x0A, 0x8A, 0x58, 0xD4, 0x14, 0x66, 0x83,
+    0x84, 0x92, 0x14, 0x4C, 0x61, 0xC0, 0x1B, 0xFC, 0x3C, 0x9C, 0x33, 0xF3, 0xDE, 0xDB, 0x17, 0x2A,
+    0x56, 0xDA, 0x2B, 0xBF, 0x19, 0xCF, 0x3D, 0xF7, 0xDC, 0x73, 0xE6, 0x5A, 0xCA, 0x5E, 0x36, 0x62,
+    0x9C, 0x9A, 0xE5, 0x9D, 0x5A, 0x0E, 0xFF, 0x56, 0x62, 0x7B, 0xAC, 0x76, 0xA2, 0x87, 0x6C, 0x16,
+    0xDB, 0x1E, 0x3F, 0xD9, 0xED, 0x64, 0x3D, 0x42, 0xD3, 0x8A, 0x54, 0xB3, 0x48, 0x11, 0x6A, 0xC9,
+    0x02, 0x56, 0x9A, 0x49, 0x44, 0x2F, 0xD8, 0xB1, 0xDC, 0xEE, 0x6E, 0x11, 0x1E, 0x85, 0xDF, 0x44,
+    0x8E, 0x43, 0x78, 0x2C, 0x72, 0x1A, 0x3C, 0x57, 0xB9, 0x75, 0xDC, 0x32, 0xC9, 0x7B, 0x61, 0x53,
+    0x84, 0x37, 0x8F, 0xEF, 0xF0, 0x4E, 0x2E, 0x82, 0x0A, 0xF1, 0xAD, 0x03, 0x94, 0x72, 0x64, 0xD8,
+    0x48, 0xC2, 0x49, 0x40, 0xD2, 0x70, 0xD1, 0x00, 0x5B, 0x2A, 0xCF, 0xCC, 0x2D, 0x80, 0xC6, 0xAC,
+    0x03, 0x98, 0x05, 0x54, 0x46, 0xB8, 0x93, 0x3B, 0x2E, 0xC7, 0x4B, 0x2D, 0x4D, 0xF0, 0xD9, 0xE6,
+    0xF3, 0x09, 0x29, 0x79, 0xEA, 0x72, 0xFB, 0xCF, 0x67, 0x14, 0xAD, 0x90, 0xA4, 0x18, 0x90, 0xCC,
+    0x21, 0xB5, 0x48, 0x8E, 0x65, 0x83, 0x25, 0xA4, 0x45, 0x67, 0x04, 0xDC, 0xE3, 0x92, 0x1A, 0xD3,
+    0x9B, 0xD9, 0x41, 0x97, 0xB4, 0x4B, 0xA7, 0x6C, 0x9B, 0xFA, 0xC1, 0xBF, 0x2F, 0x18, 0xCA, 0xC0,
+    0xDC, 0x66, 0x28, 0xB9, 0x59, 0xCB, 0xFB, 0x22, 0x67, 0xC0, 0x88, 0x51, 0x7A, 0x39, 0x2B, 0x7F,
+    0xC1, 0x92, 0xB9, 0xFF, 0xAE, 0xDC, 0x17, 0xFD, 0xB1, 0xAA, 0x55, 0xAD, 0x7F, 0x94, 0x3E, 0x73,
+    0xEA, 0xA6, 0xFE, 0x5E, 0x86, 0x6C, 0xFA, 0xF5, 0x52, 0xBC, 0xAC, 0x6D, 0xC8, 0x46, 0x31, 0x3F,
+    0xFC, 0xF5, 0xF5, 0x28, 0xA5, 0x97, 0x82, 0xC4, 0x22, 0x80, 0x1D, 0xE5, 0x21, 0xDB, 0x11, 0xD8,
+    0xEB, 0x26, 0xB0, 0xCC, 0x3C, 0x04, 0xD4, 0x2F, 0x47, 0xDF, 0xA5, 0xDA, 0x2A, 0x96, 0x62, 0x1D,
+    0xFB, 0xED, 0xD8, 0x33, 0x04, 0xF5, 0x1A, 0xA1, 0xFC, 0x89, 0xF5, 0x7E, 0x88, 0x16, 0x9E, 0x15,
+    0x08, 0x97, 0x20, 0x9D, 0x8D, 0x6A, 0x00, 0x2D, 0x10, 0x2B, 0x1D, 0x42, 0xD5, 0x22, 0x58, 0xF2,
+    0xEC, 0x02, 0x5A, 0x1A, 0x10, 0x14, 0x43, 0xF9, 0xE7, 0xEA, 0xD3, 0x09, 0x4C, 0xD5, 0x04, 0xAA,
+    0x6A, 0xEE, 0x90, 0x70, 0x4E, 0x74, 0x9B, 0x30, 0x12, 0x7E, 0x42, 0x2F, 0xF2, 0x11, 0xFC, 0xD4,
+    0x80, 0xAA, 0x75, 0x0B, 0xE2, 0x1F, 0xC4, 0x44, 0xD9, 0xF2, 0x34, 0xA0, 0x1D, 0xD0, 0xCD, 0x32,
+    0x4C, 0x52, 0xF5, 0xC0, 0xD6, 0xAD, 0x41, 0x85, 0x14, 0x60, 0x06, 0x7E, 0x39, 0x54, 0x90, 0xA8,
+    0xBE, 0x84, 0x9F, 0x88, 0x36, 0x68, 0x04, 0x32, 0xF3, 0xF8, 0x75, 0x7B, 0xD7, 0xED, 0xAC, 0x9B,
+    0x22, 0x55, 0xC7, 0x00, 0x35, 0xA2, 0x17, 0xA2, 0xD9, 0x34, 0x5D, 0x93, 0x2A, 0x6A, 0xA2, 0x2E,
+    0x5C, 0xCC, 0xE3, 0x6F, 0xCB, 0x96, 0x14, 0xD1, 0x55, 0x5D, 0xDC, 0x9A, 0x18, 0x71, 0xF4, 0x9E,
+    0xE8, 0xF0, 0xF2, 0x91, 0x93, 0xC0, 0xE2, 0x51, 0x20, 0xEC, 0x65, 0x69, 0x3F, 0x92, 0x8E, 0x30,
+    0x7B, 0x6B, 0x1E, 0xAD, 0xA2, 0xF3, 0xD8, 0x62, 0xC3, 0xC8, 0x1A, 0x5B, 0x50, 0x3D, 0xDD, 0x08,
+    0xA9, 0x78, 0xD2, 0x68, 0xE8, 0x05, 0x35, 0x66, 0x13, 0xCD, 0x60, 0x6A, 0x34, 0x8A, 0x5E, 0xB1,
+    0xAD, 0xA5, 0x71, 0x68, 0xAE, 0x46, 0xAE, 0x58, 0x27, 0xDE, 0xCA, 0x16, 0x1E, 0xE8, 0xFA, 0xEA,
+    0xAB, 0xCF, 0xC2, 0x0C, 0x1C, 0xC0, 0x01, 0x38, 0x38, 0xA6, 0xF5, 0xA4, 0x8D, 0xFE, 0x85, 0x65,
+    0x8F, 0x1E, 0x21, 0xF9, 0x12, 0x6E, 0xCB, 0x37, 0x62, 0x64, 0xEB, 0x5B, 0x45, 0xC1, 0xEF, 0x7E,
+    0xB1, 0xA2, 0x2A, 0xC0, 0xAE, 0x1D, 0x72, 0x10, 0x3A, 0x99, 0xE0, 0x4A, 0x92, 0x69, 0xA3, 0x53,
+    0x65, 0xBD, 0x5A, 0xD5, 0x44, 0x41, 0x7E, 0xF8, 0x93, 0x0D, 0x26, 0xBC, 0x93, 0x9D, 0x92, 0x4B,
+    0x12, 0x6A, 0xF3, 0x49, 0x3A, 0x9D, 0xF3, 0x9A, 0xD9, 0x1D, 0x56, 0x17, 0xEB, 0x42, 0x6B, 0x58,
+    0x8F, 0x69, 0xD3, 0x85, 0x88, 0xDB, 0xB1, 0xBB, 0xCB, 0xB6, 0xED, 0xBC, 0x2E, 0xD1, 0x7B, 0x8A,
+    0x8D, 0x6E, 0xD0, 0xB9, 0x72, 0x7B, 0xA5, 0x79, 0x71, 0x0A, 0xE6, 0x37, 0xA4, 0x68, 0x6F, 0xE5,
+    0x28, 0x89, 0x17, 0x43, 0x35, 0xEC, 0x65, 0x1C, 0xF7, 0xDA, 0x2D, 0x49, 0xC0, 0xEC, 0x5B, 0x5E,
+    0xB2, 0x26, 0x7C, 0xE4, 0xE5, 0x24, 0xFC, 0x8C, 0x1D, 0xFD, 0x04, 0x52, 0x16, 0xCE, 0x92, 0x69,
+    0x19, 0x5E, 0x5D, 0x4C, 0xD4, 0x6C, 0x89, 0x5D, 0xAC, 0x93, 0x38, 0xA7, 0x07, 0xBE, 0xB1, 0x91,
+    0x7D, 0xD4, 0x08, 0x42, 0xE4, 0x93, 0x40, 0x1E, 0x1D, 0x07, 0x81, 0x65, 0xE9, 0x28, 0xD8, 0x38,
+    0xCC, 0x38, 0xA2, 0xD9, 0x1A, 0xE8, 0x58, 0x00, 0x1C, 0xAA, 0x0E, 0x24, 0xA2, 0x62, 0xEA, 0x8A,
+    0x97, 0x80, 0x77, 0x22, 0xC9, 0x14, 0xA4, 0x7A, 0xF3, 0xF4, 0x62, 0x92, 0xAE, 0x4E, 0x33, 0x12,
+    0xAF, 0xA2, 0xF6, 0x02, 0x3D, 0x75, 0xB8, 0xF4, 0xF9, 0x92, 0x86, 0x87, 0xEE, 0x63, 0x6E, 0x20,
+    0x22, 0x2F, 0x94, 0x85, 0xCF, 0x85, 0xB9, 0xD3, 0xC2, 0xC8, 0x05, 0x0F, 0xD4, 0xAA, 0xCF, 0x37,
+    0x00, 0xC2, 0xE9, 0x2E, 0x8E, 0x10, 0x0E, 0x94, 0xC8, 0xDF, 0xEE, 0x9A, 0x4C, 0xE3, 0x6A, 0x36,
+    0x68, 0xB3, 0xDB, 0x9E, 0xB6, 0xCE, 0x8E, 0xAD, 0x5F, 0xEF, 0x1C, 0x1F, 0x67, 0x8E, 0xFB, 0xAF,
+    0x32, 0xEB, 0xAD, 0xFC, 0x31, 0x27, 0x04, 0xB9, 0xC7, 0xA1, 0xC9, 0xE1, 0x51, 0xC5, 0x9B, 0xE4,
+    0xE3, 0x44, 0x11, 0x89, 0xA3, 0x23, 0x1F, 0xC1, 0x06, 0x4D, 0x05, 0x19, 0x8F, 0x4C, 0x65, 0x8F,
+    0xEB, 0xA4, 0xAF, 0x01, 0x5B, 0x3D, 0xC3, 0x3B, 0xE6, 0x1C, 0x45, 0xD8, 0x38, 0xEC, 0x28, 0x4D,
+    0x9C, 0x71, 0x3C, 0x9F, 0xF1, 0x6A, 0x28, 0x3E, 0x29, 0xAE, 0x95, 0x7F, 0x63, 0x57, 0xBF, 0xC0,
+    0x85, 0xAA, 0xAE, 0x01, 0x61, 0x1C, 0xB6, 0x6D, 0xDB, 0x91, 0xB0, 0xE5, 0xF7, 0xC4, 0xA4, 0x39,
+    0x16, 0x3D, 0x76, 0x95, 0xFC, 0x79, 0xF8, 0xE8, 0xDE, 0x7A, 0x5C, 0x27, 0x3A, 0xFA, 0xED, 0xC7,
+    0x26, 0x5A, 0x3E, 0x9C, 0xC3, 0xC7, 0xB0, 0xF1, 0x4D, 0xBC, 0xBD, 0x3B, 0x1B, 0xF7, 0x82, 0x7E,
+    0xF2, 0x93, 0x81, 0x27, 0x20, 0xEB, 0x99, 0x5F, 0xA5, 0x3C, 0x38, 0x52, 0xC5, 0x37, 0xCA, 0xD2,
+    0xFE, 0xAD, 0xFA, 0x03, 0xDE, 0x1F, 0xE5, 0x2A, 0xD4, 0x0D, 0xAE, 0xEE, 0xF3, 0x51, 0xBF, 0xC6,
+    0x35, 0xEE, 0xBE, 0x9C, 0x83, 0x98, 0x67, 0x53, 0x73, 0x3E, 0xA8, 0xA9, 0x79, 0x7E, 0x03, 0x59,
+    0x1E, 0x2C, 0x33, 0xA4, 0xF1, 0x36, 0x3C, 0x98, 0x05, 0x9F, 0x27, 0xDF, 0x39, 0xED, 0xED, 0xAC,
+    0xA7, 0x6C, 0xC9, 0x43, 0x1B, 0x6A, 0xDB, 0x1B, 0x6F, 0xBC, 0x9A, 0x33, 0x0C, 0x2E, 0x8A, 0x2F,
+    0x8D, 0x2F, 0xA1, 0x4D, 0xB9, 0xEC, 0x67, 0xD6, 0x43, 0xCA, 0x82, 0xA6, 0x62, 0x32, 0x40, 0x61,
+    0xD4, 0xAF, 0x37, 0xE4, 0x86, 0x08, 0x37, 0x54, 0x0B, 0x85, 0x63, 0x45, 0x4E, 0x6C, 0x43, 0xED,
+    0x3A, 0x5B, 0x43, 0xD7, 0xC5, 0xB6, 0x60, 0xB8, 0x31, 0x6D, 0x07, 0xD5, 0x2A, 0x87, 0x13, 0x73,
+    0x75, 0x3D, 0x4B, 0x31, 0x69, 0xD8, 0xBF, 0x1C, 0xF5, 0x0B, 0xA4, 0xF1, 0xE5, 0xEF, 0x98, 0xD7,
+    0xBE, 0xF8, 0xC7, 0xC3, 0x72, 0x8A, 0x2D, 0xEE, 0x15, 0xBA, 0xDD, 0x38, 0xC6, 0x0E, 0x6C, 0x5B,
+    0xF9, 0x3F, 0x7F, 0xFF, 0x02, 0x8D, 0x55, 0xB1, 0x6E, 0xDD, 0x46, 0x10, 0x1C, 0x92, 0x90, 0x59,
+    0xB0, 0x38, 0x37, 0xA9, 0x02, 0x84, 0xF9, 0x80, 0x00, 0x4C, 0xE1, 0x32, 0xD1, 0xF1, 0x13, 0x5C,
+    0x58, 0x69, 0x53, 0xA7, 0xCB, 0x07, 0x58, 0x22, 0x91, 0xC6, 0xA5, 0xF3, 0x1D, 0x6E, 0xAC, 0xC2,
+    0xC5, 0x2B, 0x2C, 0x91, 0x48, 0x7E, 0x80, 0x40, 0x90, 0x9E, 0x4D, 0xEA, 0x5C, 0xC1, 0x20, 0x94,
+    0x41, 0xF2, 0x32, 0xB3, 0x7C, 0xB4, 0x9D, 0xCA, 0x26, 0x84, 0xE5, 0xD3, 0xBD, 0xBB, 0xDD, 0xD9,
+    0x99, 0xD9, 0x7B, 0xC0, 0xA3, 0x38, 0x02, 0xE8, 0xE2, 0x06, 0xE4, 0xF1, 0x87, 0xD8, 0xA2, 0x9C,
+    0xE0, 0x7B, 0x34, 0xFC, 0x30, 0x20, 0x02, 0x6E, 0x4C, 0x17, 0xC5, 0x6C, 0x02, 0x8A, 0x31, 0x0F,
+    0x8C, 0x83, 0x1B, 0xB8, 0xD2, 0xBB, 0x5E, 0xB1, 0x6C, 0x81, 0xB2, 0xAD, 0x18, 0x7D, 0xAD, 0xD8,
+    0xA1, 0x1A, 0x90, 0xAD, 0xA8, 0xD6, 0xAB, 0x6E, 0x41, 0x19, 0x63, 0x9C, 0xE0, 0x18, 0x47, 0x14,
+    0x8C, 0x2D, 0xD2, 0x18, 0x57, 0x16, 0xAC, 0xE2, 0xAF, 0x38, 0x9E, 0x4C, 0xC5, 0xF9, 0xED, 0x00,
+    0xF7, 0xE7, 0x8F, 0x01, 0xAE, 0x4D, 0x26, 0x94, 0x35, 0x88, 0x03, 0x69, 0xC0, 0x25, 0xB2, 0x80,
+    0x6B, 0x65, 0xB5, 0xF3, 0x91, 0x9B, 0x93, 0xC8, 0xD3, 0xD9, 0xAC, 0xA3, 0x44, 0x05, 0x81, 0x82,
+    0xB3, 0xA0, 0x5E, 0x88, 0x1B, 0xDA, 0x0E, 0xF5, 0x01, 0x34, 0x0A, 0x5D, 0x8B, 0x0F, 0x4F, 0x12,
+    0x1F, 0xB4, 0x4D, 0xD9, 0x10, 0x5B, 0xC1, 0x9D, 0x95, 0xA3, 0x18, 0x91, 0x4E, 0xA8, 0x7A, 0x24,
+    0x33, 0x1A, 0x6E, 0x98, 0x41, 0xA0, 0xC9, 0x9C, 0x2C, 0x8A, 0x29, 0xAB, 0xA5, 0x13, 0x91, 0x10,
+    0xCD, 0x1E, 0xF3, 0x51, 0x54, 0xF0, 0x10, 0x49, 0x28, 0x02, 0x06, 0xDF, 0x16, 0x53, 0x16, 0xA3,
+    0xB5, 0xB9, 0x92, 0x4B, 0x35, 0x9E, 0x59, 0xE3, 0x3B, 0x70, 0x7C, 0x19, 0xA3, 0xA0, 0xA4, 0x46,
+    0x38, 0xA2, 0x90, 0x83, 0x14, 0xF1, 0xF9, 0xE2, 0x19, 0x4B, 0x5C, 0x09, 0xBF, 0x56, 0xBB, 0x38,
+    0x23, 0xEB, 0x59, 0xC4, 0x21, 0x1F, 0x70, 0x82, 0xAB, 0xB3, 0x01, 0xCF, 0xF5, 0x5F, 0xE0, 0xAB,
+    0xAB, 0xB3, 0x77, 0xDD, 0x2C, 0x4A, 0x6B, 0x34, 0x31, 0xA8, 0x04, 0x77, 0x8E, 0xEC, 0xBC, 0x21,
+    0x90, 0x6C, 0x21, 0x69, 0x6E, 0x24, 0xE6, 0xA6, 0x76, 0x21, 0x5D, 0x49, 0x81, 0x0B, 0x49, 0x24,
+    0x09, 0xC5, 0x92, 0x6E, 0xF0, 0x22, 0x29, 0xE9, 0xB6, 0x5A, 0x32, 0x58, 0x29, 0x2A, 0x5C, 0x3D,
+    0xE0, 0xF1, 0xCE, 0x26, 0x6E, 0x14, 0xA4, 0x2B, 0x60, 0xC0, 0xDC, 0x83, 0x81, 0x14, 0xFA, 0xD4,
+    0xD0, 0x3F, 0xB2, 0x4E, 0x92, 0x66, 0xD3, 0x7A, 0x13, 0x4C, 0xBC, 0x5A, 0x5B, 0x26, 0xD4, 0x64,
+    0x94, 0xB2, 0x52, 0x46, 0x31, 0x30, 0x73, 0x3F, 0x95, 0x6A, 0x18, 0x6A, 0x26, 0x78, 0x38, 0xB8,
+    0x97, 0x21, 0x16, 0xED, 0x5A, 0xFC, 0xB6, 0xBD, 0x9E, 0xCF, 0x75, 0x54, 0x3C, 0x9D, 0x0E, 0x3D,
+    0xC5, 0xEF, 0x59, 0x54, 0x51, 0x25, 0xB7, 0xA1, 0x14, 0xA8, 0x4A, 0xC1, 0x4B, 0xCA, 0xC6, 0x8A,
+    0x1A, 0x8F, 0xEA, 0x48, 0x70, 0x52, 0xD9, 0x2A, 0x5B, 0x8E, 0x80, 0x8B, 0x1A, 0xC9, 0x53, 0xF9,
+    0xD8, 0x0F, 0xFA, 0x2A, 0xCA, 0x21, 0xA2, 0x47, 0xC6, 0x4E, 0x56, 0x9D, 0x2E, 0xF6, 0x85, 0x5E,
+    0x65, 0x98, 0xA1, 0x51, 0x4D, 0x9A, 0xBD, 0xB4, 0x85, 0x7B, 0x19, 0x9A, 0x70, 0x48, 0x25, 0x09,
+    0x29, 0x44, 0x2F, 0x17, 0xF8, 0x35, 0xFF, 0x1C, 0x6D, 0x32, 0xC2, 0x6F, 0xAF, 0xA3, 0x69, 0x3B,
+    0x9B, 0xCE, 0xBD, 0x34, 0x5F, 0x0F, 0x8A, 0x3E, 0x7A, 0xC4, 0x67, 0xF9, 0x7B, 0xD0, 0x87, 0x55,
+    0x33, 0xE4, 0x6B, 0x16, 0x62, 0x53, 0xD9, 0x44, 0xD2, 0x09, 0x80, 0x7E, 0x96, 0x4E, 0x7C, 0x13,
+    0x61, 0x54, 0x7E, 0x76, 0xD7, 0x69, 0xA5, 0xEA, 0xFD, 0x80, 0x62, 0x2A, 0x69, 0xCC, 0x55, 0xFE,
+    0xEE, 0x5E, 0x4E, 0x62, 0x70, 0xD1, 0xA8, 0xCA, 0x9B, 0x9A, 0x1B, 0x52, 0x6C, 0xB4, 0xD6, 0x92,
+    0xA2, 0x7F, 0x2F, 0xDF, 0x7D, 0xB9, 0xAB, 0x68, 0xAF, 0x6C, 0xB6, 0x57, 0x1E, 0xEC, 0xE5, 0x46,
+    0x7B, 0x95, 0x7D, 0xD5, 0xD3, 0xD5, 0x9C, 0xDA, 0x3E, 0x97, 0xE1, 0xAB, 0xDE, 0x2D, 0x74, 0x3C,
+    0x6B, 0x2E, 0x84, 0x50, 0xB5, 0x71, 0x65, 0xF7, 0xFE, 0x97, 0x75, 0x23, 0x4D, 0xFE, 0xC5, 0x12,
+    0x89, 0xD8, 0xBF, 0x0C, 0x91, 0x1A, 0xF8, 0x6E, 0xE8, 0x08, 0xD1, 0xC7, 0xBE, 0x63, 0x6D, 0x1F,
+    0xD1, 0x11, 0x8C, 0x5F, 0xD1, 0x10, 0x98, 0x67, 0x2A, 0x82, 0xA4, 0xD1, 0xE4, 0xB5, 0x86, 0x67,
+    0x86, 0x0F, 0x73, 0xCE, 0x95, 0x6B, 0xE9, 0xCC, 0xF9, 0xA6, 0xEE, 0x1A, 0xA0, 0x15, 0xBA, 0x3F,
+    0xEE, 0xCD, 0x78, 0x5E, 0x93, 0xC6, 0x52, 0x12, 0xBE, 0xFC, 0xDB, 0x90, 0x46, 0xE3, 0x4F, 0xC2,
+    0xA2, 0x30, 0x83, 0x96, 0x26, 0xAD, 0x0A, 0x9D, 0xBB, 0xCF, 0x67, 0x6B, 0x3F, 0x68, 0xC0, 0x9B,
+    0x9E, 0xB3, 0x4E, 0xB3, 0xB3, 0x64, 0xCE, 0x0E, 0x82, 0xAE, 0x32, 0xFE, 0x11, 0x84, 0xD3, 0x58,
+    0xA0, 0xF8, 0x83, 0xA5, 0x67, 0x5E, 0x52, 0x8D, 0x89, 0x5A, 0xF6, 0x6C, 0x70, 0x35, 0xDA, 0xD9,
+    0x54, 0x47, 0xF1, 0xF3, 0x7F, 0xD4, 0x08, 0xE5, 0xCB, 0x38, 0x53, 0xF0, 0x8B, 0x5C, 0x4F, 0x5E,
+    0xC9, 0xBF, 0x54, 0xD9, 0xEF, 0x13, 0xC3, 0xA1, 0xD5, 0x4A, 0xB7, 0x80, 0x8A, 0x37, 0x36, 0xCF,
+    0x32, 0x82, 0xB1, 0x21, 0xF9, 0x0B, 0xF3, 0x43, 0xF2, 0xEA, 0x55, 0xA7, 0x66, 0x6C, 0x2B, 0xF6,
+    0xE1, 0xDB, 0x87, 0x06, 0xDD, 0x7E, 0x07, 0x8C, 0xD6, 0xC7, 0xF0, 0x3E, 0xA6, 0xA6, 0xE0, 0xAE,
+    0x63, 0x6E, 0x36, 0x2A, 0xCE, 0xB1, 0x36, 0x3A, 0xF6, 0xA8, 0xC1, 0x92, 0xE3, 0x62, 0x9B, 0x28,
+    0x06, 0x2B, 0x6D, 0xF4, 0xE0, 0xEA, 0x29, 0xAB, 0x6D, 0x4A, 0x31, 0x88, 0x6B, 0x9E, 0xEC, 0xCF,
+    0xB3, 0xEC, 0x34, 0xC3, 0xAA, 0xED, 0x55, 0x41, 0x85, 0xEF, 0x0E, 0xB3, 0xE8, 0x68, 0x59, 0x9F,
+    0xE7, 0xEE, 0x52, 0xA5, 0x85, 0xE5, 0xED, 0xF9, 0x90, 0xC4, 0x42, 0x75, 0x8C, 0xE5, 0xFF, 0x72,
+    0x96, 0x9F, 0xC8, 0x49, 0xBC, 0x3B, 0x93, 0x52, 0xEA, 0xF1, 0xB7, 0x3F, 0xDF, 0xDE, 0xDE, 0xBE,
+    0x79, 0x73, 0x3A, 0x9D, 0x9E, 0xEB, 0xB9, 0xBE, 0xBE, 0xB9, 0xFC, 0xEE, 0xC9, 0xD7, 0x76, 0xF9,
+    0x19, 0xDC, 0xCA, 0xA6, 0x38, 0x9C, 0xC1, 0x58, 0x06, 0x4B, 0x75, 0x7D, 0x24, 0xF7, 0xC7, 0x2D,
+    0x21, 0x58, 0x06, 0xC0, 0x90, 0x5C, 0x1E, 0xD8, 0x04, 0xD2, 0xD0, 0xDA, 0xB1, 0xB7, 0x47, 0x23,
+    0x97, 0x9F, 0x91, 0x36, 0xF9, 0x38, 0x6D, 0x21, 0xFE, 0xBD, 0xB1, 0x18, 0xB2, 0x96, 0xDE, 0x74,
+    0xA7, 0x6C, 0x08, 0xB7, 0xC9, 0x70, 0x71, 0x75, 0x55, 0xA7, 0x76, 0x77, 0xC5, 0xF3, 0x90, 0x7F,
+    0xCF, 0x34, 0x77, 0xF8, 0xC9, 0xB8, 0x4F, 0xB7, 0x6F, 0x6C, 0x38, 0x6F, 0xE8, 0x95, 0x09, 0x33,
+    0x2F, 0xED, 0x39, 0xEF, 0x31, 0x39, 0x24, 0xC1, 0x11, 0xE0, 0x57, 0xBC, 0x6F, 0x2A, 0xF8, 0x91,
+    0x97, 0xDF, 0xC8, 0x5B, 0x70, 0x70, 0xF1, 0xDF, 0x3E, 0x8D, 0x2F, 0x7A, 0x3C, 0xDB, 0x2F, 0x3B,
+    0xFD, 0x78, 0xDE, 0xED, 0x9D, 0x08, 0xDF, 0xCD, 0xDE, 0x6B, 0xF1, 0xDB, 0x03, 0xE7, 0x6D, 0x45,
+    0xFC, 0xEB, 0x8E, 0x9E, 0x3E, 0x55, 0x7D, 0x12, 0x36, 0xE4, 0xBC, 0x4D, 0x2A, 0x6E, 0x9A, 0x6F,
+    0xF8, 0x3D, 0x2F, 0x90, 0x62, 0xEB, 0x02, 0xD3, 0xDA, 0xEF, 0x41, 0x43, 0x0B, 0x5F, 0xE0, 0x73,
+    0x9F, 0xFF, 0x00, 0x85, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x49, 0xE2, 0x62, 0x84,
+    0xA6, 0x42, 0x0A, 0x91, 0x38, 0xB7, 0xFC, 0x48, 0x70, 0x9B, 0xE2, 0xB2, 0x1E, 0xFE, 0x03, 0x1A,
+    0x68, 0xAF, 0x46, 0x08, 0x5D, 0x73, 0xC5, 0x15, 0x97, 0xDD, 0xE9, 0x69, 0xA0, 0x40, 0xB4, 0x91,
+    0xA0, 0x00, 0x45, 0x22, 0x08, 0x51, 0x5C, 0xB1, 0x8B, 0x47, 0xB4, 0x29, 0x30, 0x8A, 0x28, 0x11,
+    0x16, 0x42, 0x42, 0x22, 0xC5, 0x8D, 0x84, 0x41, 0x3E, 0xE2, 0xF5, 0xF0, 0xBD, 0xF1, 0xEE, 0x45,
+    0xD0, 0x60, 0xAD, 0x67, 0xED, 0xD1, 0xBC, 0xF7, 0xBE, 0xF7, 0xBD, 0xEF, 0x3D, 0x03, 0x40, 0xD6,
+    0x74, 0x79, 0x1C, 0xD4, 0xF6, 0x5A, 0x3E, 0x00, 0xFC, 0x9D, 0x01, 0x0B, 0xC0, 0x58, 0xA8, 0x16,
+    0x19, 0xDF, 0x57, 0x0E, 0x26, 0x86, 0x2C, 0x46, 0xE8, 0xE8, 0x30, 0x5F, 0x87, 0xB2, 0xAC, 0x65,
+    0xE9, 0x65, 0x09, 0xBC, 0x73, 0x59, 0x54, 0x07, 0xBC, 0xAB, 0x3C, 0x54, 0x7C, 0xEC, 0x51, 0xC6,
+    0x0B, 0x87, 0x65, 0x1E, 0x91, 0xF5, 0x88, 0xE2, 0x6D, 0x42, 0xE1, 0xB1, 0xA5, 0xEB, 0x6C, 0xE4,
+    0xC2, 0x70, 0xA5, 0x2D, 0x7A, 0x94, 0x6D, 0x15, 0x78, 0x36, 0x06, 0x86, 0xE1, 0xA2, 0x62, 0xA4,
+    0x93, 0xE6, 0x49, 0xBB, 0x0B, 0x85, 0xC6, 0x41, 0x3F, 0x0B, 0xA8, 0xED, 0x5D, 0x9C, 0xE3, 0x76,
+    0xDE, 0xE1, 0x4C, 0xFD, 0x1E, 0x47, 0x1D, 0xE3, 0x68, 0x3E, 0xB6, 0x30, 0x3C, 0x51, 0x5A, 0xDE,
+    0x9E, 0x98, 0x2F, 0xDF, 0x69, 0xB9, 0xEF, 0x73, 0xDE, 0x38, 0xBE, 0x14, 0x5B, 0x80, 0x8F, 0x73,
+    0x52, 0x77, 0x20, 0x87, 0x57, 0xD1, 0x55, 0xB1, 0x95, 0xAD, 0x7B, 0x34, 0xE2, 0x96, 0x17, 0xD0,
+    0x44, 0x88, 0x0D, 0x50, 0xA7, 0x77, 0xDD, 0x41, 0xF1, 0x7D, 0x4C, 0xC1, 0x73, 0x87, 0x66, 0xBB,
+    0x46, 0xF5, 0x30, 0xBA, 0xC2, 0x97, 0x3D, 0x24, 0x95, 0x03, 0x98, 0x4E, 0x49, 0x26, 0x87, 0x0C,
+    0xAB, 0x9C, 0x1A, 0x70, 0x96, 0x45, 0xAB, 0x04, 0x7D, 0x1D, 0x27, 0x90, 0xAA, 0x16, 0xC5, 0xA5,
+    0xD0, 0x53, 0x92, 0xB0, 0x22, 0xE0, 0x66, 0x31, 0x49, 0x5E, 0x9E, 0xD1, 0x03, 0x6E, 0x44, 0x06,
+    0xCF, 0xDE, 0x12, 0xEF, 0xE4, 0x04, 0x74, 0x04, 0xED, 0x12, 0xE1, 0x29, 0x99, 0x37, 0x90, 0xA0,
+    0xE1, 0xF0, 0x25, 0x8B, 0x6F, 0x79, 0x3C, 0xC6, 0x81, 0xCE, 0xC7, 0x7C, 0x64, 0xDE, 0x01, 0xA7,
+    0x45, 0x87, 0x73, 0xED, 0xD1, 0x13, 0x67, 0x28, 0x5D, 0x1E, 0x2A, 0xAB, 0xBA, 0x1A, 0x45, 0xB7,
+    0x82, 0x69, 0x1B, 0x41, 0x6F, 0x3C, 0xD9, 0xAD, 0x5D, 0x31, 0xE0, 0xF9, 0xF5, 0x8D, 0x78, 0x0E,
+    0xC4, 0x9D, 0xB7, 0xC4, 0xCC, 0x22, 0x9C, 0x4B, 0x11, 0x02, 0x2A, 0xD0, 0xE5, 0x12, 0x3A, 0x71,
+    0xCD, 0xE4, 0xB1, 0xE2, 0x3D, 0x11, 0xDD, 0x84, 0x7F, 0x5D, 0x3C, 0x0A, 0x12, 0x9F, 0xF0, 0x16,
+    0xFF, 0xC1, 0x7B, 0xB0, 0xC7, 0x8B, 0xC4, 0x32, 0x63, 0x25, 0x3D, 0xEC, 0x4D, 0xE4, 0x38, 0x6B,
+    0x73, 0x23, 0x5A, 0x54, 0xF4, 0x5A, 0xFF, 0xBA, 0x73, 0x49, 0x17, 0xC2, 0x7B, 0x48, 0x32, 0x9A,
+    0xF5, 0xA6, 0xA5, 0x14, 0x1B, 0xF4, 0x1B, 0xAC, 0x37, 0x58, 0x6C, 0x60, 0x46, 0x14, 0x5B, 0xF2,
+    0xE6, 0xF1, 0x6C, 0xC0, 0xFD, 0xC6, 0xD6, 0x26, 0x98, 0xEF, 0x62, 0xD1, 0xD5, 0xBF, 0xF4, 0x7A,
+    0x3B, 0x0B, 0x70, 0x9F, 0x45, 0xCB, 0xD0, 0xC6, 0xB1, 0x38, 0xA5, 0x78, 0xBD, 0x27, 0x51, 0x29,
+    0x31, 0xC7, 0xB2, 0xA6, 0x14, 0xEB, 0xCF, 0x8A, 0x68, 0x1B, 0xD6, 0xF4, 0x4E, 0xD5, 0xE9, 0x1E,
+    0x66, 0x15, 0x4D, 0xB4, 0xC5, 0x74, 0xF4, 0xF3, 0xD3, 0x4E, 0x8D, 0x88, 0xF6, 0x54, 0x28, 0xB3,
+    0x07, 0x94, 0x80, 0xF1, 0xDA, 0x91, 0xCE, 0x56, 0xB5, 0xA5, 0xA3, 0x61, 0x20, 0x9B, 0x3D, 0xD6,
+    0x7C, 0x5A, 0xA3, 0xA6, 0x60, 0x17, 0xAC, 0xE8, 0x88, 0xCA, 0xEA, 0x96, 0x7C, 0x7B, 0x15, 0xE4,
+    0x89, 0xB6, 0x38, 0x79, 0x44, 0x99, 0x48, 0xB1, 0x3E, 0xEA, 0xF9, 0x3A, 0xE4, 0x3D, 0x06, 0xDA,
+    0xF4, 0x45, 0x9B, 0xF5, 0xDA, 0xE7, 0x41, 0x8E, 0x96, 0xBE, 0xE8, 0x2A, 0xA7, 0xBB, 0xDA, 0x9A,
+    0x64, 0xDC, 0x08, 0x2D, 0x39, 0xC5, 0x5D, 0xC4, 0x11, 0xFA, 0xCF, 0x23, 0xCF, 0xC3, 0x41, 0xC0,
+    0x33, 0x23, 0x63, 0x07, 0xA6, 0x70, 0x8F, 0xD0, 0x4B, 0x4A, 0xB3, 0xE8, 0xE8, 0x33, 0x5E, 0x6C,
+    0x29, 0x2E, 0xA1, 0x83, 0xA9, 0x57, 0x89, 0x45, 0xFB, 0xA5, 0x45, 0xFE, 0x1B, 0xBB, 0x45, 0xC5,
+    0x1F, 0x7A, 0xA8, 0x2D, 0x4E, 0x45, 0xB7, 0xA7, 0x14, 0x03, 0x17, 0xD6, 0xF4, 0x5C, 0xE4, 0xD0,
+    0x8B, 0x20, 0xC8, 0x51, 0x47, 0xD7, 0xF5, 0x74, 0x2C, 0x12, 0x64, 0x29, 0x26, 0x7A, 0xC9, 0xFA,
+    0x86, 0xDD, 0x16, 0xAE, 0x43, 0x0C, 0x92, 0xF0, 0xE7, 0x2E, 0x22, 0x13, 0x3B, 0x35, 0xEC, 0xAF,
+    0x6B, 0xBC, 0x8F, 0x7B, 0x36, 0xC1, 0xC5, 0xF7, 0x4E, 0xB7, 0x65, 0x60, 0xAB, 0x47, 0x92, 0x6C,
+    0x5A, 0x2D, 0x5A, 0x23, 0xC7, 0xCE, 0x30, 0x32, 0xA3, 0x30, 0x27, 0x46, 0xC2, 0xF4, 0x68, 0x2B,
+    0xBD, 0xEC, 0x09, 0xF8, 0x9C, 0x2D, 0xF4, 0x81, 0xDD, 0x8D, 0x88, 0xF2, 0x7D, 0xA4, 0x72, 0xA2,
+    0x66, 0x29, 0xF4, 0x87, 0xFB, 0x59, 0xF2, 0x3A, 0xCA, 0xC6, 0xEB, 0x18, 0x98, 0x81, 0x70, 0x39,
+    0xF7, 0x21, 0x91, 0x30, 0x05, 0xE6, 0x23, 0x5B, 0x91, 0xCA, 0xF4, 0xE2, 0x99, 0x9A, 0x8A, 0x0F,
+    0xC8, 0xB4, 0x15, 0xC9, 0x1E, 0xCE, 0x6E, 0xD9, 0x7E, 0xE4, 0x90, 0x54, 0x88, 0xE7, 0x8A, 0xCA,
+    0x5C, 0x62, 0xF9, 0xB0, 0x97, 0x39, 0xB0, 0x62, 0x96, 0xC7, 0xBB, 0x99, 0x75, 0x5B, 0x84, 0xC1,
+    0x41, 0xB1, 0xC6, 0x7B, 0x7F, 0x7F, 0x42, 0x0A, 0xD6, 0xA2, 0x8B, 0xF4, 0x2E, 0xFF, 0x8E, 0x51,
+    0xF9, 0x6F, 0x7E, 0x64, 0xB3, 0xAB, 0x48, 0xE3, 0x56, 0xFA, 0x72, 0xA0, 0x9A, 0x5A, 0xA6, 0x4D,
+    0xCB, 0xD1, 0xB0, 0xCF, 0xCE, 0x50, 0xBE, 0x49, 0x25, 0x68, 0x56, 0x73, 0xC1, 0x48, 0x63, 0x3E,
+    0xB1, 0xA9, 0x7B, 0xC9, 0xB4, 0xE6, 0x74, 0x5C, 0x6D, 0x07, 0xBC, 0xC8, 0x48, 0xAF, 0x00, 0xAF,
+    0xB2, 0x21, 0xD6, 0x0B, 0xAA, 0x5B, 0xA4, 0x59, 0x52, 0x88, 0xA5, 0xAB, 0x48, 0x30, 0x35, 0xEA,
+    0x07, 0xE8, 0x27, 0x01, 0xFA, 0xA9, 0x4F, 0x98, 0x0B, 0x66, 0xA6, 0xD9, 0x16, 0x9A, 0x49, 0xBE,
+    0x46, 0xDB, 0xCF, 0x99, 0x79, 0x36, 0xB0, 0x1D, 0x24, 0x02, 0x65, 0xB8, 0x40, 0x67, 0xFC, 0x42,
+    0xF5, 0xA5, 0x5D, 0x9A, 0xA1, 0xC6, 0xB2, 0x1E, 0x37, 0x58, 0xC6, 0x69, 0x94, 0x2A, 0xF6, 0x8C,
+    0xC8, 0xE2, 0xAF, 0x82, 0xCC, 0x15, 0x4F, 0x21, 0xAD, 0x52, 0xFB, 0x1A, 0x0A, 0x09, 0x23, 0x55,
+    0x5B, 0x74, 0xF7, 0xC9, 0x64, 0x25, 0xC4, 0x90, 0xAC, 0xB2, 0x9F, 0x5B, 0x1B, 0x35, 0x29, 0xA3,
+    0xFA, 0xA1, 0xFE, 0x22, 0x6F, 0x5B, 0xD2, 0xBC, 0xB2, 0x13, 0x67, 0xB0, 0x0E, 0x1C, 0xC5, 0xB5,
+    0x63, 0x59, 0x59, 0xDD, 0x41, 0xC6, 0xB3, 0x68, 0xBE, 0x68, 0xE9, 0xCC, 0xB0, 0x23, 0x50, 0xA7,
+    0x11, 0x49, 0x91, 0x64, 0x03, 0x0B, 0xA4, 0xFE, 0xD8, 0x79, 0x41, 0x25, 0x63, 0x72, 0xC5, 0x00,
+    0x19, 0x53, 0x41, 0x21, 0x51, 0x6A, 0xD6, 0x41, 0xC9, 0x76, 0xC3, 0x6D, 0xCE, 0x43, 0x66, 0xC9,
+    0x87, 0xAA, 0xBF, 0xD2, 0x13, 0x19, 0xE3, 0x5E, 0xF4, 0xD9, 0xDB, 0x47, 0x2C, 0xA9, 0xE1, 0x5D,
+    0xB6, 0xB3, 0xF6, 0x2A, 0x11, 0x07, 0x0B, 0xB6, 0xA2, 0xE7, 0xC6, 0xA6, 0xC2, 0x73, 0x00, 0xB2,
+    0x39, 0x59, 0xB1, 0x2A, 0x7D, 0x18, 0x70, 0xEB, 0x01, 0x6D, 0x9D, 0x88, 0x94, 0x5D, 0x96, 0x54,
+    0x4B, 0xA6, 0xF6, 0x8F, 0x4B, 0x61, 0x8E, 0x50, 0xF8, 0x5D, 0x68, 0x67, 0x20, 0xF2, 0x6D, 0x60,
+    0x35, 0xB2, 0xE7, 0x67, 0xE5, 0x51, 0xFB, 0x79, 0x14, 0xB1, 0x03, 0xD0, 0xF8, 0x2B, 0x60, 0x87,
+    0x50, 0x0E, 0x27, 0x32, 0xD6, 0x3A, 0xBC, 0x8C, 0xDC, 0xCB, 0xB0, 0xB4, 0xF8, 0x6A, 0xBF, 0x41,
+    0x49, 0xDC, 0xDD, 0x6F, 0x64, 0xAD, 0x48, 0x8A, 0xA6, 0xF9, 0x17, 0x84, 0x1B, 0xB0, 0x07, 0x54,
+    0x25, 0x04, 0x02, 0x44, 0x62, 0x8C, 0x73, 0x54, 0xE2, 0xE5, 0xFC, 0x96, 0x2F, 0x59, 0x2D, 0x55,
+    0x9D, 0xF7, 0x5D, 0x3A, 0x5F, 0xA7, 0xF6, 0xBB, 0x35, 0x26, 0x29, 0xEC, 0xB4, 0x6A, 0xDC, 0xA7,
+    0x3F, 0xBD, 0x70, 0xF2, 0xF5, 0x63, 0x2A, 0xFB, 0xBA, 0x7C, 0xC0, 0xCC, 0x40, 0x22, 0x4C, 0xC0,
+    0x76, 0x47, 0x9F, 0x74, 0x5D, 0xE5, 0x68, 0x5D, 0xCF, 0xF3, 0x9B, 0x1E, 0xD7, 0x12, 0x67, 0xB8,
+    0x9A, 0x87, 0x32, 0x03, 0x09, 0xEE, 0x26, 0xFE, 0xE7, 0xFA, 0x07, 0x85, 0x55, 0x31, 0x6F, 0xD5,
+    0x56, 0x18, 0x3D, 0xF7, 0xDE, 0x26, 0x16, 0xB8, 0xC4, 0x0C, 0x41, 0xA5, 0x90, 0xE0, 0x0E, 0x0C,
+    0x55, 0x05, 0x75, 0x54, 0x31, 0xA4, 0xD2, 0xCB, 0xF3, 0x4D, 0x18, 0xBA, 0x66, 0xE8, 0x53, 0x87,
+    0x0E, 0x74, 0x6E, 0x25, 0x60, 0xC8, 0xC0, 0x40, 0x78, 0x2E, 0xFC, 0x01, 0xA4, 0x76, 0x87, 0x81,
+    0xA1, 0x0D, 0x4B, 0x86, 0x0C, 0xA8, 0xA2, 0xF8, 0x96, 0x0E, 0x0C, 0x5D, 0x4C, 0x0B, 0x5B, 0x25,
+    0x8C, 0x44, 0x97, 0x52, 0xB5, 0x56, 0x65, 0x24, 0x4B, 0xF5, 0xCB, 0xED, 0xF9, 0xEE, 0x0B, 0x28,
+    0xA8, 0x43, 0xED, 0xF8, 0xC6, 0xEF, 0xDA, 0xF7, 0x7E, 0xE7, 0x9C, 0xEF, 0xFB, 0x8E, 0x81, 0x59,
+    0xC0, 0x38, 0xA0, 0x06, 0x36, 0x80, 0x53, 0x50, 0x65, 0xAD, 0x7D, 0x67, 0xFE, 0x71, 0xBA, 0x6D,
+    0xD0, 0x2D, 0xE3, 0xF2, 0x29, 0x0C, 0x13, 0x24, 0x67, 0x8B, 0xE8, 0x61, 0xA5, 0xBA, 0x06, 0xE3,
+    0x3B, 0x48, 0x7C, 0xA3, 0xBC, 0x47, 0xEC, 0x0B, 0x59, 0xB5, 0x0D, 0xCC, 0xE3, 0xB5, 0xE3, 0xC2,
+    0x33, 0x20, 0xF5, 0x1D, 0xCC, 0xEE, 0x6A, 0x8B, 0xD4, 0xA1, 0xC0, 0x5D, 0xCE, 0xEA, 0x8A, 0x43,
+    0x6C, 0x39, 0x9C, 0x96, 0x97, 0xEE, 0xF0, 0x52, 0x5C, 0x8E, 0xA8, 0xE0, 0x90, 0xF2, 0x4A, 0xBC,
+    0x77, 0x18, 0xFB, 0x5D, 0xE0, 0xD3, 0xC7, 0xEB, 0x40, 0x2E, 0x6B, 0x3A, 0x0E, 0x39, 0xD1, 0xA5,
+    0xBC, 0x51, 0x7E, 0xEB, 0x6B, 0x06, 0xF5, 0xDE, 0xE6, 0x1C, 0x42, 0x24, 0xE5, 0xB4, 0xCB, 0x7C,
+    0x69, 0xC7, 0x8C, 0xD6, 0xC5, 0x45, 0xEC, 0x52, 0xAC, 0xE0, 0xAE, 0x6A, 0x4C, 0x1D, 0xD5, 0x63,
+    0x64, 0xBE, 0x37, 0xDE, 0x77, 0xE9, 0x8D, 0xE7, 0xF5, 0x49, 0x1C, 0x9A, 0x62, 0xE3, 0x3E, 0xAD,
+    0x22, 0xAA, 0xC2, 0x34, 0xAA, 0x43, 0x54, 0x67, 0x05, 0x92, 0x5F, 0x3A, 0xC1, 0x4B, 0x18, 0xB9,
+    0x84, 0x2B, 0x79, 0xA3, 0x7B, 0x48, 0xA4, 0x02, 0xB9, 0xC0, 0x51, 0xBD, 0xA0, 0x13, 0xAC, 0x82,
+    0x49, 0xF9, 0x06, 0x46, 0xA0, 0x66, 0xA5, 0x90, 0x91, 0x67, 0x51, 0x23, 0xCF, 0x8A, 0x7D, 0x12,
+    0x0C, 0x60, 0x0A, 0xEA, 0x99, 0x88, 0xAE, 0x8B, 0xD0, 0x0E, 0x87, 0x5F, 0x3D, 0xB2, 0x9C, 0xA0,
+    0xE0, 0xCB, 0x88, 0x2C, 0xB5, 0x4B, 0xA0, 0x2A, 0xAA, 0x2E, 0x19, 0x98, 0x86, 0xCE, 0x6E, 0x3B,
+    0x4E, 0xE9, 0x02, 0x73, 0x32, 0x73, 0x46, 0x02, 0xB6, 0x1C, 0xC6, 0xFE, 0x3A, 0x22, 0xEF, 0x6B,
+    0x0C, 0xED, 0xF1, 0x4A, 0xD7, 0x48, 0x2C, 0xF7, 0x5E, 0xC1, 0x10, 0xAA, 0x41, 0xF9, 0xE2, 0x42,
+    0x81, 0xD2, 0x13, 0x49, 0x44, 0x58, 0x30, 0xC2, 0x22, 0x69, 0xF0, 0xF6, 0xC8, 0x5B, 0xE6, 0xA9,
+    0x23, 0x37, 0x32, 0xC9, 0xB8, 0xC1, 0xAB, 0x23, 0x71, 0xC3, 0xAC, 0xB8, 0x97, 0x17, 0x93, 0xF1,
+    0xDA, 0x04, 0xC7, 0x70, 0x70, 0xCD, 0xDE, 0xD6, 0x91, 0x9B, 0xF9, 0x10, 0xF3, 0xDB, 0xB8, 0x5A,
+    0xE9, 0x03, 0xED, 0xD2, 0xD1, 0x18, 0xC7, 0xC3, 0x82, 0x2B, 0xC5, 0x46, 0xB3, 0xB4, 0x70, 0xF4,
+    0xE0, 0x01, 0x73, 0xED, 0x6C, 0xE5, 0xDB, 0xE4, 0xD7, 0x40, 0xC1, 0xAA, 0x4A, 0x55, 0xA6, 0xD6,
+    0x4D, 0x54, 0x45, 0x75, 0xEC, 0x62, 0x97, 0x14, 0x71, 0x61, 0x5A, 0xC3, 0xFA, 0x40, 0x89, 0xB8,
+    0xA1, 0x5A, 0x3D, 0xCF, 0x43, 0xE4, 0xAA, 0x78, 0xE6, 0xDF, 0xAE, 0x33, 0xBB, 0x3F, 0x8C, 0xBE,
+    0xA0, 0x88, 0x64, 0x73, 0x99, 0x34, 0x05, 0x04, 0xB7, 0x3A, 0xB6, 0xB5, 0xC5, 0x27, 0x0F, 0x3C,
+    0x45, 0x3D, 0x86, 0x78, 0xCD, 0x7E, 0xA7, 0x67, 0xAF, 0xCE, 0x7C, 0x70, 0x78, 0xFE, 0x46, 0x71,
+    0xFF, 0xAB, 0x28, 0x5E, 0x58, 0x5A, 0x08, 0x38, 0xD4, 0xE8, 0x9A, 0xD0, 0x0B, 0x47, 0x2C, 0x84,
+    0x5C, 0x5A, 0xB4, 0x89, 0x4D, 0x63, 0x17, 0xFD, 0x58, 0xEB, 0xBA, 0x53, 0x6D, 0xBE, 0xD6, 0xC7,
+    0x7C, 0x85, 0x6C, 0x67, 0x6F, 0xF1, 0xA5, 0x19, 0x21, 0xC9, 0xEB, 0xFD, 0x90, 0x0B, 0x8C, 0xBE,
+    0xFF, 0x58, 0x7B, 0xD9, 0x41, 0x12, 0xC5, 0x8B, 0x02, 0xEE, 0x49, 0x3E, 0x3D, 0x46, 0x9F, 0x8B,
+    0x48, 0x38, 0xC2, 0x84, 0xAA, 0x09, 0x56, 0x1D, 0x2E, 0x32, 0x3F, 0x03, 0xE2, 0xEC, 0x50, 0xD6,
+    0xEF, 0xDD, 0x12, 0x49, 0x67, 0x78, 0x2E, 0x90, 0xDF, 0x32, 0xDE, 0xC5, 0xC6, 0xB8, 0x39, 0x6F,
+    0x51, 0x0F, 0xE2, 0xD5, 0x7A, 0x20, 0x71, 0x4C, 0xCD, 0x2C, 0xAC, 0x90, 0x53, 0xEC, 0x8C, 0x10,
+    0x5F, 0x01, 0xE5, 0x70, 0xCC, 0x5B, 0xCF, 0xB9, 0xD4, 0x99, 0x86, 0xEB, 0xEF, 0xB1, 0x8E, 0xB3,
+    0x9A, 0x45, 0x35, 0x01, 0xAB, 0xD7, 0x2D, 0x12, 0x8E, 0x7E, 0xE0, 0x9F, 0x14, 0xCB, 0x33, 0x56,
+    0x2A, 0x01, 0xF8, 0x6C, 0x5F, 0x03, 0xAD, 0x56, 0xF0, 0x6E, 0x1B, 0x65, 0x33, 0x40, 0xDE, 0xCE,
+    0x21, 0xEB, 0x23, 0x1B, 0x7B, 0xED, 0xB4, 0xB7, 0x0D, 0xB7, 0x61, 0xE9, 0x34, 0x2C, 0xAA, 0x36,
+    0x66, 0xF5, 0x91, 0x45, 0xC9, 0x1A, 0xCB, 0xED, 0x06, 0x32, 0x77, 0x9A, 0x69, 0x4F, 0x10, 0xB5,
+    0xC6, 0x99, 0x5E, 0xD5, 0x6A, 0x17, 0x3B, 0xF0, 0x76, 0x80, 0xB1, 0x13, 0x29, 0xB0, 0x99, 0x3C,
+    0xEC, 0x73, 0xA7, 0xF1, 0x8E, 0x7A, 0x86, 0x93, 0xB8, 0x7E, 0x2E, 0x96, 0x8A, 0x5E, 0x81, 0x5B,
+    0xD0, 0xC5, 0x99, 0x08, 0xDB, 0xE5, 0xEF, 0xDF, 0xA8, 0x5E, 0xFF, 0xEC, 0xDC, 0xD2, 0xCD, 0x37,
+    0xCF, 0x44, 0x73, 0xD1, 0x9A, 0x2F, 0x32, 0x6B, 0x43, 0xB9, 0xB2, 0x60, 0xA9, 0x32, 0x32, 0x9B,
+    0x5A, 0x2A, 0xD2, 0x05, 0x76, 0xA6, 0x89, 0x48, 0xCB, 0xB4, 0xBA, 0x27, 0x39, 0xC9, 0xF5, 0x02,
+    0x4F, 0xC9, 0xF5, 0xF4, 0xD8, 0x94, 0xC2, 0xFD, 0x43, 0xEE, 0x4E, 0x01, 0x07, 0xA8, 0x1A, 0xFF,
+    0x36, 0x44, 0xFB, 0x6D, 0xE9, 0x86, 0x86, 0x46, 0xA0, 0x42, 0x67, 0x54, 0xB8, 0x84, 0xB7, 0x1E,
+    0x71, 0x62, 0xBC, 0x2B, 0x54, 0x26, 0x89, 0xBC, 0x75, 0x9A, 0x72, 0x62, 0x87, 0x5D, 0xA5, 0xEA,
+    0x13, 0x37, 0x11, 0xB9, 0x4B, 0x35, 0x52, 0xF5, 0xB4, 0xC2, 0x20, 0xBA, 0xFF, 0x08, 0x6D, 0x4C,
+    0x7B, 0xAA, 0x67, 0x6F, 0x57, 0x71, 0x81, 0xB8, 0x90, 0x3A, 0xB2, 0xF3, 0x32, 0xE0, 0xBC, 0x44,
+    0x4B, 0xDD, 0x5E, 0xCC, 0x37, 0xA4, 0x03, 0x19, 0x6A, 0x43, 0x1C, 0x2A, 0x0E, 0x53, 0x8D, 0x08,
+    0x3D, 0x27, 0xAE, 0xC3, 0xB0, 0xCB, 0x50, 0x9B, 0x36, 0x99, 0x91, 0xB8, 0x4F, 0x76, 0x63, 0x5F,
+    0xFD, 0x7D, 0x7D, 0x47, 0x9C, 0xC9, 0x58, 0x6E, 0xCA, 0x45, 0x7C, 0x29, 0x91, 0x42, 0x35, 0x95,
+    0xB4, 0x68, 0x27, 0xD5, 0x72, 0x4F, 0x6A, 0x97, 0x3D, 0x3F, 0x44, 0xF6, 0x9B, 0x65, 0xB5, 0xFB,
+    0x4E, 0x13, 0xB6, 0xB7, 0xFB, 0xDD, 0x2F, 0x97, 0x5E, 0x9D, 0x8F, 0xC2, 0xBD, 0x13, 0xCF, 0xB9,
+    0xC8, 0x80, 0x47, 0xA4, 0xCD, 0xD3, 0x5A, 0x50, 0xA4, 0x32, 0x68, 0x27, 0x09, 0x6F, 0xC4, 0xF8,
+    0x76, 0x08, 0xD2, 0x87, 0x24, 0x76, 0xC6, 0x2D, 0xAA, 0x75, 0x53, 0xA5, 0xE2, 0x94, 0x64, 0xA1,
+    0x85, 0xBA, 0x6A, 0x4E, 0x2C, 0xCB, 0xB0, 0xC8, 0xD7, 0xD3, 0x78, 0x3D, 0x70, 0x47, 0xA7, 0xB6,
+    0x5A, 0xB1, 0xCF, 0x3B, 0x62, 0xAB, 0x2B, 0x98, 0x92, 0x87, 0xDA, 0x33, 0x2A, 0xB1, 0x4C, 0xDD,
+    0xEC, 0x83, 0xB4, 0x3E, 0xF5, 0xAE, 0xA4, 0x9A, 0x8A, 0x93, 0xB9, 0x60, 0x55, 0xCA, 0x93, 0xE8,
+    0x84, 0x3F, 0x39, 0x4D, 0x62, 0x64, 0xC8, 0x1C, 0xB3, 0xB9, 0xC4, 0x6B, 0x8B, 0xD0, 0x9E, 0xC1,
+    0xEC, 0xE4, 0xCA, 0xAC, 0xB6, 0x69, 0x9D, 0x3A, 0xD6, 0x2E, 0x97, 0xB5, 0x2F, 0xF7, 0xBD, 0x8C,
+    0xBD, 0xE7, 0xD3, 0x46, 0xD6, 0xDB, 0xF8, 0xCF, 0x21, 0x3B, 0x05, 0xFB, 0x46, 0xE9, 0xC4, 0x38,
+    0xC5, 0x9C, 0x9E, 0x73, 0x88, 0x7F, 0x92, 0x30, 0x1F, 0x31, 0xF4, 0x30, 0xE2, 0x70, 0x37, 0xAA,
+    0x69, 0x72, 0x0C, 0xCF, 0x46, 0x69, 0xA4, 0x87, 0x9A, 0xE0, 0xCF, 0xDC, 0x9C, 0x43, 0xE9, 0x7D,
+    0x4B, 0x17, 0xF3, 0xAD, 0x91, 0x21, 0x7E, 0x31, 0xFA, 0xA4, 0x23, 0x0D, 0xD3, 0x91, 0x83, 0xE9,
+    0x4B, 0x6E, 0x18, 0x7C, 0xC1, 0x48, 0xA4, 0xD0, 0xD1, 0xE1, 0x33, 0xA3, 0x82, 0x00, 0x0D, 0xFE,
+    0xFF, 0xB8, 0x82, 0x97, 0x10, 0x33, 0x79, 0x3D, 0x0D, 0x56, 0xFF, 0x17, 0xF6, 0x30, 0x9A, 0xA7,
+    0xA4, 0x6B, 0x9A, 0x4D, 0x31, 0x61, 0x21, 0xD3, 0x13, 0x29, 0x55, 0xEF, 0x64, 0x5D, 0x2E, 0xEC,
+    0x49, 0x3D, 0xB3, 0x44, 0xC9, 0xFF, 0xBD, 0x7C, 0xC0, 0xBC, 0xA5, 0x49, 0xFB, 0x4A, 0xB0, 0x76,
+    0x7A, 0x32, 0x1A, 0xED, 0x4A, 0x4A, 0xF2, 0x62, 0x57, 0x0C, 0xF9, 0x15, 0xD8, 0xE0, 0xEC, 0xA1,
+    0xFB, 0xA2, 0x3F, 0x03, 0x6C, 0x4A, 0xA7, 0x8B, 0x60, 0x02, 0xE1, 0xA3, 0x26, 0xFE, 0x8D, 0xF0,
+    0x81, 0x13, 0xD9, 0x30, 0x16, 0x60, 0x43, 0xF9, 0x84, 0x66, 0x92, 0x96, 0xA0, 0x5B, 0xF2, 0x65,
+    0x2B, 0xC9, 0x22, 0xFA, 0xA8, 0x4A, 0x8A, 0xA9, 0x70, 0xCC, 0x7A, 0x2F, 0x8B, 0x73, 0xF9, 0x28,
+    0x11, 0x90, 0x28, 0xC7, 0xFA, 0xA4, 0xE1, 0xC8, 0xF7, 0xD2, 0x66, 0x8F, 0x47, 0xE7, 0xEA, 0x20,
+    0x9D, 0x94, 0x83, 0x8F, 0x9B, 0xC0, 0xFB, 0x5F, 0xC5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x9D,
+    0xB5, 0x11, 0x16, 0x31, 0x92, 0x7F, 0xC2, 0xF1, 0x0B, 0x62, 0x0A, 0x0A, 0x0A, 0x14, 0x1B, 0x24,
+    0x44, 0x4B, 0x81, 0x45, 0xC9, 0x3F, 0x80, 0x8A, 0x8E, 0xC4, 0x0E, 0xBF, 0x20, 0x0D, 0x3D, 0x25,
+    0xA2, 0x81, 0x82, 0x02, 0x89, 0x4B, 0x6C, 0x6A, 0x1A, 0x37, 0x88, 0x12, 0xA7, 0x48, 0x11, 0x68,
+    0x5C, 0x18, 0xC9, 0x48, 0x3E, 0x2F, 0xEF, 0xCD, 0xDA, 0x17, 0x12, 0x20, 0x15, 0x82, 0xD5, 0x69,
+    0x3F, 0x7C, 0xDE, 0x99, 0x37, 0x6F, 0xDE, 0x8C, 0x45, 0xDC, 0xF0, 0xFA, 0xCB, 0x98, 0x1F, 0xBF,
+    0xAF, 0x44, 0xA2, 0xF0, 0x2D, 0xB6, 0xF5, 0x96, 0xFC, 0x66, 0x2C, 0x0A, 0x4C, 0xFE, 0xC0, 0x6D,
+    0x59, 0xF1, 0xCC, 0xAD, 0xFF, 0x95, 0xDB, 0xE5, 0x92, 0xE7, 0x3B, 0x35, 0xCE, 0xCD, 0x36, 0xCF,
+    0x41, 0x83, 0x73, 0x0A, 0x33, 0x7E, 0xEB, 0xB7, 0x38, 0x4B, 0xC2, 0xFB, 0xD8, 0xE2, 0x87, 0x6D,
+    0x69, 0x6D, 0x27, 0x0B, 0x6B, 0x6D, 0xEA, 0x5B, 0x6E, 0xCB, 0x2C, 0xCB, 0x8B, 0x45, 0x25, 0x7E,
+    0xEF, 0xF7, 0x22, 0x49, 0x55, 0xCE, 0x8E, 0xF6, 0xBD, 0x96, 0x36, 0x22, 0x38, 0x59, 0xF0, 0xA9,
+    0x58, 0xBE, 0xF0, 0xA7, 0xA1, 0x08, 0xC5, 0x72, 0x0A, 0xF5, 0x7A, 0xDE, 0xAE, 0x21, 0xC6, 0x31,
+    0x26, 0xD3, 0x11, 0x5D, 0xB4, 0xDB, 0xCD, 0x18, 0x83, 0x3A, 0xC2, 0x9D, 0x84, 0x98, 0xE0, 0x69,
+    0x98, 0x40, 0x62, 0x03, 0x8F, 0x21, 0xF1, 0x49, 0x6E, 0xED, 0x4A, 0x1C, 0xCA, 0xF8, 0x63, 0xF6,
+    0xA0, 0x31, 0x78, 0x29, 0x29, 0xA2, 0x86, 0x7E, 0xD6, 0x30, 0x85, 0xAC, 0xF9, 0xB7, 0x31, 0x6D,
+    0x5C, 0xC2, 0x14, 0x90, 0x0E, 0xAF, 0x39, 0x0F, 0x65, 0x52, 0x4D, 0x34, 0x1A, 0x5B, 0x4D, 0x10,
+    0xC3, 0x0F, 0xD5, 0x44, 0xE2, 0x56, 0x50, 0x3B, 0x7C, 0xA6, 0xF3, 0x1B, 0x47, 0x61, 0x58, 0x61,
+    0x52, 0x70, 0x09, 0x39, 0x24, 0x81, 0x86, 0xA0, 0x14, 0x59, 0xF8, 0x2D, 0xBB, 0xDF, 0x2B, 0x7D,
+    0x49, 0x01, 0x44, 0x27, 0xB0, 0x66, 0x8F, 0x78, 0x89, 0xFE, 0x22, 0xAC, 0xB5, 0x5B, 0xBF, 0xEC,
+    0x91, 0x24, 0x7D, 0x8A, 0xF5, 0x73, 0xAB, 0x6B, 0xF0, 0xC9, 0x91, 0xEB, 0x1F, 0xAE, 0xDC, 0xDA,
+    0xE6, 0x4E, 0x20, 0x6D, 0x6C, 0x47, 0xAE, 0x5D, 0x48, 0x4A, 0xC4, 0xF4, 0x9E, 0x33, 0x38, 0x88,
+    0x7B, 0x71, 0x20, 0x81, 0x18, 0x2B, 0x64, 0x49, 0xF5, 0x21, 0xA1, 0x5A, 0x04, 0x79, 0xC3, 0xB4,
+    0xDA, 0x2C, 0x43, 0xD4, 0xD6, 0x2A, 0x14, 0x44, 0x8F, 0x6D, 0x2B, 0x71, 0x45, 0x2C, 0x83, 0x2C,
+    0x6A, 0x65, 0xFB, 0x57, 0xAE, 0x4C, 0x09, 0x44, 0xEA, 0xCC, 0x63, 0x06, 0x44, 0xE1, 0x27, 0x1A,
+    0x43, 0xBB, 0x56, 0xA3, 0x82, 0x8C, 0xF8, 0xD0, 0xD3, 0x73, 0x92, 0x32, 0x96, 0xD6, 0x01, 0xE1,
+    0x5F, 0x1A, 0x15, 0xAE, 0x5E, 0x80, 0xB7, 0xE3, 0x47, 0x95, 0xC0, 0x55, 0x3F, 0xA5, 0x57, 0x61,
+    0x18, 0xF5, 0x0D, 0x0F, 0x24, 0xE5, 0x8A, 0x32, 0xB2, 0xA7, 0xF1, 0x2B, 0x86, 0xAB, 0xC4, 0xF1,
+    0x50, 0x0D, 0xAB, 0xBE, 0x36, 0x68, 0x7E, 0xC1, 0x29, 0xD6, 0xA9, 0x38, 0x83, 0x19, 0x76, 0x46,
+    0x86, 0xD5, 0x22, 0xEC, 0x97, 0x29, 0x05, 0x4C, 0x35, 0x21, 0xAB, 0xCA, 0xE4, 0x7C, 0x4A, 0x00,
+    0xC1, 0x30, 0x1D, 0x21, 0x7D, 0x93, 0x3E, 0x43, 0x98, 0xA1, 0x06, 0xE8, 0x38, 0xC5, 0xE9, 0x28,
+    0xBB, 0xE7, 0x20, 0x92, 0xB6, 0x80, 0x30, 0xE3, 0x89, 0x52, 0x79, 0xCD, 0x20, 0xE9, 0xFB, 0x06,
+    0x91, 0xF2, 0xDA, 0xA6, 0x9C, 0x3B, 0xFE, 0x09, 0x2E, 0xAF, 0x9E, 0x0D, 0xBD, 0xC3, 0x2E, 0xB8,
+    0x89, 0x22, 0xB8, 0x26, 0xCF, 0x1D, 0x00, 0x88, 0xB6, 0xF0, 0x35, 0xDD, 0x94, 0xDF, 0x52, 0x05,
+    0xC6, 0xB7, 0x19, 0xC4, 0xC9, 0x89, 0x4A, 0xCB, 0x91, 0x6B, 0xCD, 0xBA, 0x5A, 0xDA, 0x51, 0xE9,
+    0xAD, 0x01, 0xF2, 0xF4, 0x1D, 0x6A, 0x52, 0xE5, 0x10, 0x04, 0xD3, 0x57, 0x9D, 0xD2, 0x4F, 0x54,
+    0xED, 0x30, 0x31, 0xFB, 0x4C, 0x19, 0x14, 0x9A, 0xDF, 0x1A, 0xCE, 0x92, 0x11, 0x52, 0x02, 0x4A,
+    0x86, 0x82, 0x89, 0x65, 0x0E, 0x4F, 0x5B, 0xDF, 0x72, 0x0E, 0x14, 0xF1, 0x35, 0x8E, 0x0E, 0x85,
+    0xA3, 0x08, 0xD9, 0x37, 0x1C, 0x1F, 0x8A, 0x47, 0xA7, 0xF8, 0x59, 0x76, 0xD7, 0x11, 0x92, 0x38,
+    0x82, 0xAD, 0xD6, 0x68, 0xAB, 0x49, 0x41, 0x80, 0x50, 0xA3, 0x79, 0x71, 0x0A, 0x00, 0xF4, 0x8A,
+    0x5A, 0x41, 0x01, 0x40, 0x3F, 0x10, 0x6C, 0xA2, 0x32, 0x3E, 0xA0, 0x57, 0x74, 0x18, 0xAF, 0x17,
+    0xBF, 0xE3, 0x0F, 0xF7, 0x50, 0x49, 0xE8, 0x36, 0xA8, 0x90, 0xB8, 0x66, 0xDD, 0xE4, 0x95, 0x94,
+    0x24, 0xCC, 0x00, 0xC0, 0x75, 0x98, 0x71, 0x8D, 0xE6, 0xC9, 0xF9, 0xA9, 0x5F, 0xB1, 0x7D, 0x6A,
+    0x75, 0xC0, 0x1B, 0xCC, 0xD2, 0x1D, 0x0B, 0xE4, 0x40, 0xE1, 0x9B, 0x9F, 0x9E, 0xA7, 0xFA, 0x1C,
+    0x65, 0x03, 0x9F, 0x06, 0xD7, 0xE0, 0x94, 0x45, 0x06, 0xAF, 0x21, 0x65, 0x10, 0xA4, 0x6A, 0x6C,
+    0xF3, 0x8D, 0x04, 0xBB, 0x8D, 0xD4, 0xA6, 0xF8, 0xEB, 0x1E, 0x94, 0x79, 0xBF, 0x0D, 0xDA, 0xB8,
+    0x48, 0x8A, 0xD1, 0x8C, 0x61, 0x77, 0x36, 0x18, 0x58, 0xA0, 0x3D, 0x76, 0x18, 0xD6, 0xDE, 0xCA,
+    0x09, 0x87, 0x8D, 0xE7, 0xE0, 0xF4, 0xB6, 0x73, 0x5D, 0x21, 0x77, 0x7D, 0x81, 0x2D, 0x3B, 0x4F,
+    0xC5, 0x5B, 0xB9, 0xDE, 0x01, 0x7F, 0xDE, 0xA8, 0x2D, 0x06, 0x99, 0x63, 0x8B, 0x1C, 0x27, 0x85,
+    0x6A, 0xB3, 0x2F, 0x90, 0xB4, 0x8B, 0x68, 0x0F, 0xDB, 0x6C, 0xF3, 0x28, 0x0E, 0xA3, 0x5F, 0x04,
+    0x58, 0xDC, 0xA2, 0x4D, 0xC3, 0x38, 0x9E, 0xBE, 0x82, 0x6E, 0xC6, 0x98, 0x9A, 0xEE, 0x5C, 0x0F,
+    0xA3, 0x26, 0x4A, 0x0D, 0x7C, 0xA0, 0x78, 0xCA, 0x3A, 0x38, 0xCA, 0x4A, 0xAD, 0x0C, 0x57, 0x28,
+    0xEE, 0x6B, 0x47, 0xC5, 0xE1, 0x93, 0x82, 0x07, 0xC7, 0xF2, 0x7F, 0xC7, 0x0F, 0xCD, 0x55, 0xB1,
+    0x8E, 0xD4, 0x30, 0x14, 0x1C, 0x27, 0x88, 0x14, 0x91, 0x48, 0x43, 0x87, 0xC0, 0x7F, 0xB0, 0x6E,
+    0x29, 0x10, 0x4E, 0x47, 0x41, 0x43, 0x71, 0x5C, 0xC3, 0xAF, 0xC0, 0x25, 0xBA, 0x2F, 0xE0, 0x3F,
+    0x68, 0x91, 0xA8, 0x38, 0xFB, 0x2A, 0xDA, 0x88, 0x86, 0x36, 0x88, 0x82, 0xD6, 0x45, 0x8A, 0x95,
+    0xCE, 0x89, 0x19, 0x7B, 0x7D, 0x9B, 0xE5, 0xB8, 0x13, 0x34, 0x48, 0xFB, 0x8A, 0xD1, 0x93, 0x63,
+    0xBF, 0xCC, 0x8C, 0x5F, 0x5E, 0x00, 0x6C, 0x84, 0x05, 0xF0, 0xE9, 0xBC, 0x27, 0x7E, 0xFF, 0xD2,
+    0x02, 0xC2, 0x06, 0xC4, 0x78, 0x88, 0x1C, 0xE2, 0x04, 0xF0, 0x28, 0x3D, 0xC4, 0x16, 0x15, 0x93,
+    0x09, 0xCD, 0x8C, 0xD2, 0x45, 0xAC, 0x47, 0xA8, 0x05, 0xCD, 0x00, 0x1D, 0xD0, 0x58, 0xE8, 0x0E,
+    0xCA, 0xC2, 0xE8, 0x56, 0xB7, 0x58, 0x74, 0xDF, 0x01, 0xB3, 0xEA, 0x0D, 0x0A, 0x2F, 0x2D, 0x4F,
+    0x78, 0x79, 0xE9, 0x51, 0x6D, 0x9B, 0xAF, 0x1E, 0xF5, 0xD4, 0xFC, 0xD8, 0xA2, 0x71, 0xF5, 0x4F,
+    0x07, 0xE9, 0xAA, 0x2B, 0x07, 0x35, 0x96, 0x61, 0x84, 0x1E, 0xCA, 0x60, 0xD1, 0xD9, 0x88, 0xC6,
+    0x16, 0x21, 0x92, 0x42, 0x9B, 0x58, 0x4C, 0x09, 0xDF, 0x25, 0x54, 0x69, 0x5D, 0xB4, 0xF8, 0x3D,
+    0xEE, 0xB3, 0x02, 0x60, 0xC2, 0x02, 0x54, 0xE1, 0x94, 0x87, 0xE5, 0x04, 0xCD, 0x72, 0x4C, 0x06,
+    0x50, 0x54, 0x33, 0x16, 0x3E, 0x22, 0x15, 0x90, 0x79, 0xE5, 0x88, 0x03, 0xB9, 0x93, 0x39, 0xB9,
+    0x13, 0x25, 0xCB, 0xCA, 0x3E, 0x16, 0xD7, 0x6D, 0x44, 0x03, 0x35, 0xA0, 0x9C, 0xA1, 0xE6, 0xD7,
+    0xC6, 0x43, 0x86, 0x10, 0x28, 0x9D, 0x38, 0xA2, 0x26, 0xF6, 0x28, 0x42, 0x98, 0x23, 0x9B, 0xF0,
+    0xFE, 0x90, 0xC5, 0x83, 0x84, 0xCF, 0x12, 0x7E, 0x4C, 0x3C, 0x5D, 0xC4, 0xD2, 0xE2, 0xDF, 0xE2,
+    0x28, 0x54, 0x3C, 0x4D, 0xF8, 0x39, 0xE1, 0x55, 0x74, 0xBB, 0xBC, 0x8C, 0x2A, 0x6A, 0x3C, 0x3E,
+    0x32, 0xB7, 0x53, 0x5C, 0x94, 0x84, 0xE2, 0xDB, 0xCB, 0xC8, 0xF3, 0xDC, 0xC7, 0xBC, 0x7D, 0x75,
+    0x84, 0xAE, 0x16, 0x53, 0xAC, 0x55, 0xBA, 0x88, 0xB5, 0x53, 0xB1, 0xAE, 0xD3, 0xFD, 0x71, 0xF6,
+    0x80, 0x18, 0x9F, 0xE0, 0xF9, 0x26, 0x9E, 0x01, 0x49, 0x84, 0x41, 0xCC, 0xBE, 0xD8, 0xCA, 0x83,
+    0x1E, 0xBE, 0x77, 0x20, 0x6B, 0x9F, 0xD6, 0xC3, 0x3E, 0x55, 0xEB, 0xD7, 0x79, 0xB1, 0x6E, 0xDD,
+    0xAE, 0x5B, 0xC7, 0x75, 0x6B, 0x7F, 0xDB, 0x56, 0x9F, 0x93, 0x47, 0xE1, 0x85, 0xCB, 0x4B, 0xE4,
+    0x9A, 0x19, 0xC8, 0xF9, 0x4D, 0xC8, 0xCF, 0xBB, 0xA1, 0xC8, 0xA9, 0x58, 0x28, 0x67, 0xF7, 0x5A,
+    0x4E, 0x2B, 0xB5, 0x9B, 0x1E, 0x74, 0x1A, 0x26, 0xBF, 0xA1, 0x19, 0x0A, 0x9F, 0x53, 0x69, 0x79,
+    0x03, 0xBB, 0xBD, 0xB4, 0xC8, 0xEA, 0x5D, 0x05, 0x4D, 0xA7, 0x72, 0x7A, 0x46, 0x02, 0x67, 0x99,
+    0x14, 0x4B, 0xCC, 0x39, 0xD5, 0xF6, 0x9A, 0x98, 0xE1, 0xC8, 0xCB, 0xCA, 0xCD, 0x7C, 0x1A, 0x32,
+    0xC7, 0x8E, 0x1C, 0xB3, 0x09, 0x3A, 0x59, 0x9B, 0x82, 0xD9, 0xB2, 0x6A, 0xC8, 0xA7, 0xEA, 0xC9,
+    0x2C, 0xD9, 0x24, 0xB5, 0xFA, 0x66, 0xF6, 0xBE, 0x15, 0xF3, 0x6A, 0xD6, 0xEA, 0x9B, 0x5A, 0x7D,
+    0x33, 0x7B, 0xDF, 0x8A, 0xE5, 0xB6, 0xAD, 0x9B, 0xF6, 0x8E, 0x11, 0x93, 0xD6, 0xCB, 0xF4, 0xCE,
+    0x6A, 0x5C, 0x2F, 0xE3, 0xC6, 0x40, 0x15, 0xFC, 0x86, 0x4E, 0x20, 0xC7, 0x28, 0x93, 0xAC, 0xB4,
+    0xA5, 0xA9, 0x6C, 0xBE, 0x66, 0x44, 0x35, 0xA1, 0x6B, 0x39, 0xEA, 0x8B, 0xDD, 0x82, 0x43, 0xB9,
+    0x05, 0x1B, 0x59, 0x5A, 0xE1, 0x63, 0xAF, 0x55, 0x69, 0x81, 0x46, 0xB3, 0x25, 0xA9, 0xA1, 0x8B,
+    0x3F, 0x0B, 0xDE, 0x3C, 0xBB, 0x87, 0x0B, 0x26, 0xEE, 0x60, 0x5B, 0x91, 0x67, 0x13, 0x3E, 0xF0,
+    0x3E, 0x75, 0xF2, 0x86, 0xB6, 0x38, 0x08, 0x62, 0x0B, 0x61, 0xC2, 0xF8, 0xE7, 0x40, 0x4D, 0xFE,
+    0xD6, 0x89, 0xE1, 0xDB, 0x95, 0xFE, 0xDF, 0x22, 0xFE, 0xBB, 0x6E, 0x6A, 0x10, 0x77, 0x6B, 0x68,
+    0xFF, 0x97, 0x86, 0x23, 0x8D, 0x5F, 0x9D, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0x84,
+    0x9D, 0xC2, 0x62, 0xE7, 0x03, 0x02, 0xB8, 0xA5, 0x58, 0xC5, 0x29, 0x28, 0x52, 0x64, 0xD7, 0x86,
+    0x2F, 0xA0, 0x48, 0xD2, 0xF0, 0x07, 0x48, 0x28, 0x14, 0x29, 0x52, 0xAC, 0xE2, 0xA1, 0xA2, 0x84,
+    0x26, 0xFD, 0xF6, 0x34, 0x29, 0xB6, 0xD8, 0x82, 0xC5, 0x83, 0x84, 0x44, 0x6B, 0x89, 0x12, 0xA1,
+    0x58, 0x91, 0x68, 0x52, 0xC0, 0x14, 0x46, 0xF8, 0x11, 0xBF, 0x77, 0x39, 0x77, 0xEC, 0x84, 0x95,
+    0x16, 0xB4, 0x62, 0x47, 0xCF, 0x4F, 0xBB, 0xE3, 0x99, 0x7B, 0xCF, 0x39, 0xF7, 0xDC, 0xFB, 0x00,
+    0xDC, 0x01, 0x57, 0x36, 0xE9, 0xB7, 0x3B, 0xD3, 0xEF, 0x78, 0x97, 0x5F, 0x05, 0xDE, 0xC5, 0xBA,
+    0xEE, 0xF3, 0xD3, 0xD8, 0x09, 0x66, 0x8B, 0xAA, 0x87, 0x8B, 0x10, 0xA0, 0xF5, 0x66, 0x42, 0xBE,
+    0x45, 0xD9, 0xA3, 0x88, 0xE8, 0x80, 0x3A, 0x98, 0x19, 0xD8, 0xC2, 0xF5, 0xB0, 0x11, 0x2D, 0x50,
+    0x85, 0x9C, 0x1B, 0x3B, 0x14, 0x03, 0xCC, 0x88, 0xBA, 0x41, 0x19, 0xC0, 0x8D, 0xEF, 0xF4, 0x35,
+    0x37, 0xAA, 0xA0, 0x1F, 0x69, 0xF2, 0x1D, 0x8C, 0xBC, 0x94, 0x08, 0x27, 0x22, 0x1E, 0xB5, 0x08,
+    0x0F, 0xB5, 0x22, 0x3D, 0xF0, 0x50, 0x26, 0xBC, 0x59, 0xD9, 0x58, 0x04, 0x02, 0x0C, 0x35, 0xFF,
+    0x6E, 0x35, 0xB2, 0x99, 0x89, 0xE4, 0xD2, 0xCA, 0xEE, 0xE9, 0xA7, 0x1C, 0xE0, 0x46, 0x74, 0xCD,
+    0x82, 0x2A, 0xDB, 0xC1, 0x0D, 0x28, 0x46, 0xB4, 0xCD, 0x8A, 0x4A, 0x94, 0xC5, 0x6B, 0x54, 0x19,
+    0x37, 0x3A, 0x65, 0x41, 0x46, 0x95, 0x57, 0x02, 0x5B, 0xA6, 0x80, 0x89, 0xC8, 0x27, 0x05, 0xCD,
+    0x8D, 0x4E, 0x4F, 0x90, 0x7E, 0x31, 0x11, 0xE6, 0x37, 0x12, 0x14, 0xE6, 0x8E, 0x61, 0x84, 0xB8,
+    0x33, 0x7E, 0x37, 0xC8, 0x3A, 0x19, 0x2E, 0xC0, 0x58, 0x14, 0x24, 0x9C, 0x61, 0xFD, 0xC7, 0x35,
+    0xB8, 0x62, 0x91, 0x58, 0xF1, 0xD3, 0xC8, 0x42, 0x10, 0x43, 0x4B, 0x4C, 0x2E, 0x94, 0x81, 0x10,
+    0xB7, 0x94, 0xD0, 0x45, 0x4A, 0xD5, 0x51, 0x37, 0xFB, 0x07, 0xA1, 0xD5, 0x94, 0xC9, 0x30, 0x31,
+    0x6A, 0x02, 0xCF, 0x99, 0x5B, 0xE9, 0x42, 0x69, 0x91, 0x2E, 0x14, 0x23, 0x91, 0x71, 0xB7, 0xE2,
+    0x11, 0x23, 0x2A, 0x57, 0x42, 0x56, 0xF2, 0x39, 0xE2, 0x73, 0xA8, 0x3B, 0x27, 0x24, 0x44, 0x02,
+    0xDB, 0x36, 0x60, 0xB4, 0x31, 0x8B, 0xD9, 0x98, 0x47, 0x9C, 0x9A, 0x81, 0x4F, 0x9F, 0x47, 0x1B,
+    0x8A, 0xBE, 0x08, 0xAD, 0x77, 0x3F, 0xB3, 0x9E, 0xE4, 0x55, 0x6E, 0x18, 0x6D, 0xBD, 0x7E, 0xCC,
+    0xE7, 0xDB, 0x45, 0x6A, 0xE6, 0xB0, 0xD4, 0x22, 0x1F, 0x9D, 0x6E, 0x7D, 0x00, 0x07, 0xD3, 0x64,
+    0x43, 0x76, 0x8A, 0xC3, 0x6C, 0x03, 0x13, 0x1E, 0xF3, 0x30, 0x35, 0x28, 0x3C, 0xD3, 0xEB, 0x91,
+    0x92, 0x87, 0x18, 0x3B, 0x92, 0xA9, 0x0B, 0x76, 0xA0, 0x2C, 0xE7, 0x3C, 0xE5, 0x7E, 0xA0, 0x2B,
+    0x66, 0x4A, 0x58, 0x7D, 0x25, 0xBD, 0x19, 0xBB, 0x61, 0x09, 0x6C, 0x14, 0xB3, 0x52, 0x6A, 0xD7,
+    0x4C, 0x5C, 0xF9, 0xEE, 0x00, 0x25, 0xED, 0xF1, 0x84, 0x5C, 0x47, 0x4C, 0xA6, 0xC7, 0x64, 0x83,
+    0x86, 0xCE, 0x22, 0x53, 0xC7, 0xF7, 0x58, 0xC3, 0x0A, 0xF5, 0x50, 0x89, 0x0C, 0x25, 0x0D, 0xE4,
+    0xE4, 0xCF, 0x90, 0xCB, 0x97, 0x61, 0xAD, 0xC0, 0xE9, 0x52, 0x0D, 0x13, 0xFE, 0xB3, 0x18, 0xD7,
+    0x8E, 0xBF, 0xAF, 0xD5, 0x66, 0x6C, 0xFB, 0x9B, 0xC6, 0xA7, 0x6F, 0xBC, 0x5D, 0x22, 0x56, 0x2F,
+    0x02, 0xBD, 0x1C, 0x53, 0xC4, 0x43, 0xCA, 0x77, 0x08, 0xE7, 0x4B, 0x98, 0x5E, 0x43, 0x12, 0xC8,
+    0x4C, 0x40, 0x1D, 0x55, 0x11, 0xAF, 0x31, 0xAD, 0xC8, 0x48, 0x4B, 0x1D, 0xA3, 0xD8, 0x69, 0xAD,
+    0xA6, 0x7D, 0x98, 0x5F, 0xDE, 0x86, 0x2D, 0x0E, 0xE0, 0xE8, 0x83, 0x1B, 0xF8, 0x78, 0x01, 0x29,
+    0xD7, 0x15, 0x41, 0x9B, 0xDC, 0xD2, 0xDC, 0xEA, 0xFB, 0x0F, 0x67, 0x76, 0x82, 0xFC, 0x43, 0xBD,
+    0x98, 0x9F, 0xA5, 0xA8, 0xA5, 0xEF, 0xA8, 0x8E, 0xF3, 0xAE, 0x31, 0x83, 0x86, 0x25, 0xC8, 0x63,
+    0x68, 0xC5, 0x1E, 0xF3, 0xBC, 0xC6, 0x2D, 0x44, 0x26, 0x3A, 0x7E, 0x4B, 0x17, 0x3E, 0xC7, 0x1A,
+    0x58, 0x1B, 0xF3, 0xFD, 0xDB, 0xC0, 0x6D, 0x7D, 0x86, 0xC5, 0x85, 0x6F, 0x5D, 0x90, 0xF5, 0xFA,
+    0x88, 0x6F, 0x8E, 0xAA, 0xE1, 0xF3, 0x57, 0xB4, 0x20, 0x5B, 0xCD, 0x34, 0x76, 0xA8, 0x46, 0x16,
+    0x73, 0x64, 0x4F, 0xD8, 0x40, 0x31, 0x5F, 0xCA, 0xCC, 0x50, 0x6C, 0x40, 0x8A, 0x5E, 0x3E, 0x6D,
+    0xD4, 0x81, 0x31, 0x95, 0xB9, 0x53, 0xF1, 0x51, 0x4F, 0x9A, 0x5D, 0x64, 0xF3, 0x20, 0xF0, 0xBE,
+    0x4E, 0x16, 0x11, 0x8E, 0x16, 0xCF, 0xF0, 0x3F, 0xCA, 0xD7, 0x8B, 0x24, 0xDD, 0x90, 0xCB, 0x64,
+    0xB6, 0x37, 0xD8, 0xEB, 0x98, 0x92, 0xBD, 0x8F, 0x92, 0x41, 0xA8, 0x94, 0xCE, 0xC4, 0x96, 0x03,
+    0x41, 0x22, 0x19, 0x13, 0x81, 0x87, 0x07, 0x3E, 0xE5, 0x25, 0x5E, 0xFD, 0x5C, 0xE7, 0x49, 0x96,
+    0x4A, 0x72, 0xB6, 0x76, 0x46, 0xC9, 0xB7, 0x7B, 0x27, 0x97, 0x6D, 0xD5, 0x79, 0x14, 0xAF, 0xA8,
+    0x61, 0x73, 0x87, 0x47, 0x0F, 0xF2, 0x01, 0xC7, 0x86, 0xB8, 0x29, 0xE4, 0xEC, 0x12, 0x64, 0xDE,
+    0xD4, 0x1E, 0x56, 0x5F, 0x6E, 0x1E, 0xF4, 0xDC, 0x27, 0x7D, 0xB6, 0xD5, 0xC3, 0x8D, 0x5E, 0xB6,
+    0xDA, 0x0B, 0x7E, 0xB1, 0x6D, 0xCE, 0x99, 0x98, 0xC5, 0xAB, 0xE6, 0x08, 0xD3, 0xE5, 0xBB, 0x99,
+    0xD3, 0xCD, 0x78, 0xE6, 0x7A, 0xA6, 0xF9, 0xF0, 0x57, 0x27, 0xE8, 0x18, 0xF4, 0x88, 0xA3, 0x5C,
+    0x13, 0x5A, 0x8D, 0x94, 0x06, 0xC6, 0xAF, 0x9F, 0x34, 0x9A, 0x91, 0x6F, 0x23, 0xF6, 0x92, 0x26,
+    0x3A, 0xF6, 0x39, 0xF2, 0x50, 0x9C, 0xF3, 0xDC, 0x17, 0x1C, 0xDE, 0xCD, 0xDE, 0xC5, 0x16, 0x41,
+    0x22, 0xE3, 0xFA, 0x7D, 0x36, 0x76, 0x1E, 0x0A, 0x4F, 0x23, 0x93, 0x8D, 0xAA, 0x8C, 0xCD, 0xBD,
+    0xA5, 0xD3, 0x94, 0x8E, 0x55, 0x9C, 0xF2, 0xF4, 0x33, 0xB0, 0xAC, 0x48, 0x7C, 0x6E, 0xEE, 0x5E,
+    0x77, 0x9D, 0x0B, 0x47, 0xCC, 0xCE, 0x86, 0xA9, 0xFD, 0x16, 0x76, 0xE2, 0x6F, 0xCA, 0xE5, 0xA5,
+    0x53, 0x4C, 0x13, 0x29, 0x0D, 0x95, 0x0D, 0xB7, 0x58, 0x71, 0xCD, 0x94, 0x78, 0xA8, 0x70, 0x88,
+    0x6B, 0xAA, 0x44, 0x44, 0xA5, 0xE3, 0xAB, 0x79, 0xC9, 0xA5, 0x4C, 0x38, 0x34, 0x38, 0xAD, 0xD3,
+    0x74, 0x5F, 0xA0, 0xF7, 0xBC, 0x71, 0x17, 0xB4, 0x5B, 0x63, 0x02, 0x65, 0x3C, 0x63, 0x37, 0x96,
+    0xF4, 0xAE, 0x89, 0xAC, 0xF3, 0xF9, 0x3A, 0xB4, 0x4F, 0xD5, 0x3C, 0xD4, 0xFA, 0x5F, 0x27, 0xC4,
+    0x69, 0xCA, 0x19, 0xF5, 0x08, 0x83, 0xF1, 0x14, 0xBD, 0x57, 0x78, 0x3D, 0x5B, 0xA6, 0xF9, 0xC8,
+    0x09, 0xFE, 0x04, 0x29, 0xD4, 0x89, 0x7A, 0xC7, 0xFC, 0x8E, 0xE2, 0xA3, 0xFE, 0x1D, 0x3C, 0xFA,
+    0x7F, 0x77, 0x89, 0x34, 0xBA, 0x30, 0xDB, 0xD8, 0x99, 0xA9, 0xFE, 0x7E, 0x77, 0x21, 0xFF, 0xA3,
+    0x04, 0x91, 0xF5, 0xB3, 0x3E, 0x79, 0x21, 0x26, 0xBB, 0xDE, 0x5A, 0xEC, 0xCA, 0x39, 0x1C, 0xD3,
+    0xC4, 0x64, 0x98, 0xEA, 0xCA, 0x1F, 0x9B, 0x37, 0xEB, 0x6F, 0xAD, 0x55, 0xB1, 0x8E, 0xDD, 0x44,
+    0x14, 0x3D, 0x63, 0xB3, 0x8C, 0x14, 0x4B, 0xCC, 0x07, 0x44, 0x30, 0x1F, 0x40, 0x88, 0x1B, 0x0A,
+    0x8A, 0x7D, 0x1E, 0x13, 0xBA, 0x34, 0xD0, 0xA0, 0x94, 0xE1, 0x23, 0x52, 0x50, 0xBC, 0xDD, 0x35,
+    0xF9, 0x82, 0x7C, 0x42, 0x4A, 0xA4, 0x20, 0x85, 0x22, 0x45, 0x8A, 0x07, 0x1E, 0x6A, 0x8A, 0xB8,
+    0x08, 0x35, 0x16, 0xA2, 0x4A, 0x8A, 0x18, 0x70, 0x24, 0x47, 0xF1, 0xDB, 0xE1, 0xDC, 0xEB, 0xF7,
+    0x36, 0x1B, 0x45, 0x2B, 0x22, 0x60, 0xF4, 0x66, 0x34, 0xCF, 0x9E, 0xB9, 0xF7, 0xDC, 0x73, 0xCF,
+    0xBD, 0x06, 0xE0, 0x6B, 0x00, 0xD9, 0x16, 0xB2, 0xF6, 0xB2, 0x7E, 0xC0, 0x99, 0xA7, 0x34, 0x00,
+    0x27, 0xE9, 0x14, 0x78, 0xF7, 0xDE, 0x93, 0x86, 0x4F, 0x1E, 0x00, 0xC5, 0xE4, 0x00, 0x9B, 0xFE,
+    0xE8, 0x91, 0x4D, 0xC5, 0x06, 0x38, 0x46, 0x88, 0x70, 0x4D, 0x36, 0xC2, 0x8C, 0x28, 0xC1, 0x5F,
+    0xDE, 0x21, 0x1B, 0xF0, 0x90, 0xDB, 0x5F, 0x5A, 0xDE, 0x49, 0xA9, 0xE3, 0xAD, 0x34, 0x72, 0x7B,
+    0x79, 0x12, 0xD3, 0x28, 0xEB, 0x08, 0xFB, 0xDD, 0x15, 0xA0, 0x7F, 0x5A, 0xE3, 0x7D, 0xAB, 0xFE,
+    0x5E, 0x0D, 0x7B, 0x9D, 0xA7, 0x5A, 0x7A, 0x76, 0x2F, 0x7C, 0x6D, 0x66, 0x4C, 0x3C, 0xEF, 0x9A,
+    0x7C, 0xC0, 0x88, 0x23, 0xE2, 0x2C, 0x22, 0x8D, 0xCF, 0x08, 0xF0, 0xD1, 0xF6, 0xD9, 0x84, 0x1F,
+    0x11, 0x6A, 0xD7, 0x59, 0x79, 0xD6, 0xF2, 0xD9, 0xCE, 0x48, 0x25, 0xF0, 0xC5, 0xF0, 0x09, 0xE7,
+    0xC1, 0x1D, 0xBC, 0x39, 0xEE, 0xF7, 0x30, 0x29, 0x31, 0xE6, 0x1B, 0x03, 0x81, 0xAF, 0xE9, 0xC6,
+    0xD5, 0x6B, 0x62, 0xAF, 0x60, 0x06, 0x57, 0x63, 0xB6, 0x11, 0x47, 0x66, 0xE2, 0xFD, 0xF0, 0x32,
+    0xD5, 0x2E, 0xA5, 0x1A, 0x32, 0x8B, 0x17, 0x7A, 0xB9, 0x10, 0x9C, 0xA4, 0x2C, 0xA7, 0x3F, 0x86,
+    0xBB, 0xE3, 0xEC, 0x9F, 0xC6, 0x7F, 0x71, 0x49, 0xB6, 0xE0, 0xE8, 0xAD, 0x98, 0xE9, 0xF9, 0x76,
+    0x87, 0xBC, 0xBE, 0xF4, 0xBA, 0xF1, 0xAC, 0x6D, 0x98, 0x96, 0x19, 0xC5, 0xF3, 0x9B, 0xD1, 0x76,
+    0x66, 0x60, 0xF4, 0x2B, 0x43, 0x12, 0xEB, 0x09, 0x36, 0xAE, 0x90, 0x0F, 0x9E, 0x09, 0xB2, 0x3D,
+    0x09, 0x4D, 0xCF, 0xB6, 0x08, 0x69, 0xCB, 0xF4, 0x32, 0xDF, 0xE5, 0xEF, 0x7B, 0x03, 0x3E, 0xDE,
+    0x85, 0xFB, 0xE4, 0x63, 0x58, 0xBB, 0x41, 0x16, 0x7F, 0xF8, 0x9F, 0xF1, 0x4F, 0x4C, 0x73, 0xD9,
+    0xD0, 0xE9, 0xE4, 0x3A, 0xB4, 0xD7, 0xE6, 0x8B, 0x38, 0xFA, 0x90, 0xC9, 0xF7, 0x4C, 0xBE, 0x84,
+    0xA1, 0x4E, 0x2A, 0x3A, 0xA0, 0xE1, 0x15, 0x24, 0x0E, 0xF1, 0xC2, 0xA0, 0x7C, 0xED, 0x1B, 0x66,
+    0x5C, 0x02, 0x51, 0x37, 0x41, 0x24, 0xD6, 0xEE, 0xB3, 0xCC, 0x6B, 0x0C, 0x97, 0x34, 0x71, 0xBA,
+    0xE1, 0xBC, 0xF1, 0x77, 0x2E, 0xA7, 0x34, 0x53, 0xCF, 0xDF, 0x9E, 0x3D, 0x39, 0xE2, 0x24, 0x0B,
+    0x64, 0x05, 0xF9, 0x1E, 0x93, 0xD1, 0xF5, 0x23, 0x5D, 0xBF, 0xD6, 0x55, 0x8D, 0x18, 0xCD, 0x71,
+    0xAE, 0x0A, 0x2B, 0xA4, 0x18, 0xE0, 0xCE, 0x1D, 0x3C, 0xD4, 0x75, 0xD4, 0x83, 0x83, 0xA6, 0xA3,
+    0xC3, 0x12, 0x09, 0x91, 0xDD, 0x9C, 0x05, 0xD5, 0xD5, 0x43, 0xD1, 0xE4, 0x7A, 0x45, 0x64, 0x71,
+    0xE4, 0xDE, 0x7D, 0x33, 0xAC, 0xB9, 0x7E, 0xD6, 0xF1, 0xAD, 0x2F, 0x7E, 0xE2, 0x5D, 0xFF, 0xB9,
+    0x62, 0xD6, 0x8A, 0xD1, 0xC0, 0x96, 0x1C, 0x21, 0x4B, 0x12, 0x9B, 0x08, 0x8D, 0xAE, 0x15, 0x80,
+    0xD6, 0x2B, 0x8B, 0x60, 0x1F, 0x03, 0x09, 0x56, 0x11, 0x28, 0x52, 0x15, 0xFE, 0xEE, 0xA0, 0x53,
+    0xA4, 0x2B, 0x3D, 0xF2, 0xD5, 0x79, 0x2E, 0x0E, 0x76, 0x55, 0x12, 0xF6, 0x45, 0x72, 0xF6, 0x66,
+    0x40, 0x45, 0xC2, 0xC7, 0x92, 0x16, 0x26, 0x04, 0x7A, 0x9D, 0x3C, 0x6C, 0xB7, 0x46, 0x29, 0x85,
+    0xE7, 0x9A, 0xA2, 0x0F, 0x68, 0x9B, 0x94, 0xB6, 0xD2, 0x1E, 0x88, 0x32, 0xFA, 0x74, 0x8C, 0x03,
+    0xC5, 0x83, 0xEF, 0xE9, 0xB6, 0x56, 0xD6, 0x84, 0xA7, 0xEA, 0xA2, 0x24, 0xFF, 0x6B, 0x0F, 0x59,
+    0x5C, 0xAA, 0xE0, 0x65, 0x44, 0x71, 0xAD, 0xC3, 0x2D, 0xF4, 0x0B, 0xF7, 0xA4, 0x12, 0x2B, 0xE9,
+    0x0C, 0x15, 0x5F, 0x8F, 0x62, 0xDD, 0x8C, 0x9E, 0xD6, 0x37, 0xB4, 0xCE, 0x26, 0xE1, 0x62, 0xD9,
+    0x07, 0xF2, 0xC9, 0xEC, 0x8B, 0x49, 0x9B, 0x7E, 0x6D, 0xCC, 0x17, 0x4A, 0xCE, 0x11, 0x9B, 0x0B,
+    0xAB, 0xE1, 0x53, 0x36, 0x8F, 0xFC, 0x35, 0x4D, 0x12, 0xFF, 0x24, 0x18, 0xC5, 0xA8, 0x74, 0x1F,
+    0x57, 0xE7, 0xBD, 0x80, 0x14, 0xAB, 0x25, 0x9D, 0x54, 0x54, 0xB3, 0xA0, 0x14, 0xB3, 0x9C, 0x90,
+    0x29, 0x30, 0xD5, 0x2E, 0x47, 0xBF, 0xD7, 0xC7, 0x03, 0x69, 0x15, 0xCD, 0x99, 0x42, 0xDE, 0x62,
+    0x8C, 0x74, 0x21, 0xD5, 0x0B, 0x6D, 0x75, 0xD4, 0x7A, 0x4D, 0x26, 0x09, 0x6E, 0xB6, 0x6C, 0xAC,
+    0x23, 0xF3, 0x65, 0x7F, 0xA3, 0x56, 0xDC, 0x23, 0xF2, 0x10, 0x44, 0x1D, 0x2D, 0x93, 0x6E, 0x44,
+    0x2C, 0x56, 0x22, 0xF0, 0xA2, 0x92, 0x84, 0x45, 0xFA, 0x19, 0x1F, 0xE7, 0x49, 0x4B, 0x8A, 0xEF,
+    0x55, 0x92, 0xAF, 0xC6, 0x6A, 0x51, 0x36, 0xA3, 0xC4, 0x55, 0x6E, 0x4F, 0xE5, 0x68, 0x47, 0x25,
+    0xF6, 0x78, 0x68, 0x63, 0xDE, 0x15, 0x8D, 0xC3, 0x7B, 0x2C, 0xC0, 0x5B, 0x59, 0x9F, 0xB1, 0xF0,
+    0x3C, 0x0E, 0xCD, 0x68, 0x06, 0xDF, 0x14, 0xB7, 0x27, 0x54, 0x2D, 0x6B, 0xBB, 0x87, 0x7D, 0xBC,
+    0x5C, 0x1D, 0x97, 0x7C, 0x7B, 0x6E, 0xD9, 0xF6, 0xCD, 0xA2, 0x85, 0x52, 0x30, 0x07, 0xA9, 0x2C,
+    0xA5, 0x36, 0xE5, 0xD3, 0xC5, 0x21, 0xAF, 0x44, 0xB9, 0x52, 0xE9, 0x10, 0x4D, 0x2C, 0x31, 0x3B,
+    0xF2, 0x4B, 0xA2, 0xA9, 0xEE, 0x42, 0x2A, 0x44, 0x83, 0xCE, 0xFF, 0x1A, 0xA0, 0x28, 0x19, 0x59,
+    0xDC, 0x45, 0x6D, 0x24, 0x58, 0x23, 0x44, 0x68, 0x06, 0xB5, 0xE2, 0x25, 0xD2, 0x90, 0xC8, 0xFA,
+    0xC9, 0x16, 0x6F, 0xC4, 0xCD, 0x71, 0xE9, 0x7E, 0xD2, 0xCF, 0xDB, 0x85, 0x6D, 0xDB, 0x28, 0xD8,
+    0x20, 0x25, 0x24, 0x1D, 0x97, 0x4E, 0x64, 0x5B, 0x6D, 0xE4, 0xFF, 0xCF, 0xE2, 0x79, 0x94, 0xAA,
+    0xAB, 0xAC, 0x7C, 0xDA, 0xE2, 0xB1, 0xFC, 0x97, 0xA2, 0x0B, 0x52, 0x4D, 0x4C, 0xDE, 0x20, 0xF7,
+    0x83, 0xFC, 0xE7, 0xB6, 0x48, 0x94, 0x08, 0xFB, 0x26, 0xBF, 0x80, 0x41, 0xB6, 0xC5, 0xF3, 0x2F,
+    0x6F, 0x4C, 0x42, 0x4B, 0x68, 0x42, 0x43, 0xCC, 0xC5, 0xB0, 0x73, 0xC4, 0xA0, 0xEE, 0xA5, 0x68,
+    0xF4, 0xA3, 0x7B, 0x7E, 0x94, 0x7F, 0x46, 0x7E, 0x84, 0x07, 0x1C, 0x67, 0x33, 0x89, 0xAA, 0x38,
+    0x5D, 0xE3, 0xC9, 0x95, 0x63, 0xA7, 0x21, 0xED, 0x33, 0x1B, 0x53, 0x8B, 0x0D, 0x52, 0x53, 0x32,
+    0x20, 0x2B, 0x7E, 0x52, 0x5A, 0xA3, 0x38, 0xF5, 0x6F, 0x2B, 0xB8, 0xBF, 0x01, 0xCD, 0x55, 0xB1,
+    0x92, 0xDC, 0x44, 0x14, 0x6C, 0x69, 0x5C, 0xA7, 0x02, 0x15, 0xD6, 0x05, 0x64, 0x2E, 0xA3, 0x1F,
+    0x80, 0xD2, 0x0F, 0xDC, 0x9D, 0x96, 0xE8, 0xD2, 0x0B, 0xD8, 0x22, 0xF0, 0x17, 0x38, 0x22, 0x21,
+    0x20, 0xB0, 0x6F, 0x05, 0x5F, 0x70, 0x11, 0x29, 0x9F, 0x70, 0x04, 0x0E, 0x08, 0xCE, 0xA5, 0x71,
+    0x7C, 0x89, 0xAA, 0xF8, 0x01, 0x11, 0x10, 0x18, 0x02, 0x14, 0xC8, 0x65, 0x99, 0xDA, 0xDD, 0x47,
+    0xF7, 0xD3, 0xDE, 0xDE, 0xB9, 0x0C, 0x05, 0x01, 0x81, 0x55, 0xBB, 0xAF, 0x66, 0x46, 0x3B, 0xF3,
+    0xBA, 0xFB, 0xF5, 0xBC, 0x05, 0x70, 0x81, 0x33, 0xE0, 0x3E, 0x3E, 0x02, 0x30, 0x66, 0x11, 0xC8,
+    0x6D, 0xE0, 0xB0, 0x9A, 0x18, 0x70, 0x88, 0x7F, 0x7C, 0xCA, 0x86, 0x21, 0xAC, 0x35, 0x6C, 0xA3,
+    0xE6, 0x1A, 0x86, 0xDF, 0x35, 0xBC, 0xBA, 0xD2, 0xFC, 0xB4, 0xE3, 0xBC, 0x7F, 0xAA, 0x79, 0xD6,
+    0x73, 0xBE, 0x38, 0xE1, 0x7C, 0x08, 0x3C, 0xFC, 0x0A, 0xB5, 0xF6, 0x73, 0xC8, 0x0F, 0x87, 0xAD,
+    0xD9, 0x88, 0xD2, 0xCC, 0x16, 0xC1, 0x34, 0x6C, 0x97, 0xCB, 0x55, 0x53, 0x46, 0x84, 0x29, 0x10,
+    0x45, 0x1D, 0xDB, 0x39, 0x51, 0x8E, 0x0C, 0x21, 0x86, 0x06, 0xCF, 0x1F, 0x45, 0x14, 0xC6, 0x4C,
+    0xED, 0xE2, 0x6D, 0x4C, 0xE9, 0xF6, 0x53, 0x64, 0x66, 0xC8, 0xFA, 0x2A, 0x86, 0x2E, 0xF4, 0xA1,
+    0xC3, 0x94, 0x0C, 0x38, 0xC6, 0x80, 0x12, 0x47, 0x28, 0xE2, 0x27, 0xC8, 0x87, 0x3C, 0x16, 0x53,
+    0x6A, 0xB6, 0xC5, 0x8A, 0x09, 0x0B, 0x7B, 0x1D, 0xD1, 0xFE, 0x32, 0xEC, 0x19, 0xD5, 0x71, 0x47,
+    0x28, 0x51, 0x02, 0xE7, 0x93, 0x5F, 0xC7, 0x1D, 0x9D, 0x93, 0xAC, 0x9B, 0xD9, 0x24, 0x63, 0xE8,
+    0x67, 0x32, 0x79, 0x64, 0x70, 0x2E, 0xB5, 0xD8, 0x88, 0x4A, 0x22, 0x12, 0xCE, 0x24, 0x7F, 0xB5,
+    0xFC, 0x72, 0x72, 0x22, 0x75, 0x43, 0x0A, 0x3B, 0x1E, 0xC8, 0x04, 0xFB, 0x33, 0xA5, 0xFC, 0x5A,
+    0xE1, 0x47, 0x85, 0x95, 0xD6, 0x0E, 0x6E, 0x69, 0x94, 0xB6, 0xC6, 0x79, 0xBA, 0xC6, 0x88, 0x49,
+    0x2C, 0x58, 0x98, 0xB1, 0x40, 0x32, 0x14, 0x4C, 0x22, 0x12, 0x15, 0xEA, 0xBE, 0x32, 0xEB, 0xA9,
+    0x5A, 0x27, 0x0E, 0xA9, 0xFD, 0x40, 0x90, 0xDF, 0x70, 0x33, 0xA5, 0xC6, 0x9F, 0x2A, 0xE0, 0x5E,
+    0x95, 0x87, 0x0A, 0x41, 0xE4, 0xE0, 0x3C, 0x3D, 0xB3, 0x2A, 0xFD, 0xEF, 0x4F, 0xD2, 0xB2, 0x00,
+    0x14, 0x2B, 0x2A, 0x8C, 0x80, 0x75, 0x92, 0x48, 0xA1, 0x18, 0xF6, 0xE5, 0x5F, 0x29, 0x14, 0x5A,
+    0x4C, 0x7D, 0x5E, 0x8B, 0x4A, 0xE6, 0xA9, 0x5A, 0x7F, 0xE5, 0x56, 0xE2, 0xD6, 0x7B, 0xAC, 0xDA,
+    0xCB, 0xAF, 0x22, 0x28, 0xCD, 0x44, 0x9B, 0x51, 0x7E, 0xD4, 0x46, 0xB7, 0x49, 0x30, 0x4F, 0x73,
+    0x71, 0x9B, 0x99, 0xCA, 0x04, 0x42, 0x3C, 0xE2, 0xBA, 0xCC, 0xF3, 0x0E, 0xB2, 0x07, 0x5B, 0x6E,
+    0x98, 0x88, 0x65, 0x91, 0xF2, 0xF8, 0x82, 0xEC, 0x9E, 0xC8, 0x6E, 0x1C, 0x32, 0xFB, 0x31, 0x91,
+    0x73, 0x35, 0xD3, 0x1B, 0x9E, 0x5F, 0xF2, 0x9B, 0x5B, 0xB3, 0xDB, 0xE9, 0xEA, 0x63, 0xA3, 0x50,
+    0xFD, 0xA4, 0xF9, 0xB7, 0x92, 0xAC, 0x4B, 0x9A, 0xF7, 0x4E, 0x04, 0x15, 0x2E, 0xE7, 0x91, 0x19,
+    0xC1, 0x86, 0x17, 0x34, 0x5C, 0x93, 0xBF, 0x25, 0x00, 0x2A, 0x92, 0xA2, 0x02, 0xA8, 0x9A, 0x59,
+    0x02, 0x15, 0x55, 0x1A, 0xD0, 0x35, 0x2E, 0x82, 0x5B, 0x5A, 0x2A, 0x40, 0x67, 0x4B, 0x06, 0xB4,
+    0xD3, 0xFE, 0x84, 0xE0, 0xE8, 0xCE, 0x1D, 0x9D, 0x36, 0x25, 0x9B, 0xFF, 0x62, 0x09, 0x3C, 0x90,
+    0x92, 0x15, 0xED, 0xC9, 0x40, 0xF0, 0x85, 0x76, 0x05, 0xDF, 0x6A, 0xB8, 0xB9, 0x40, 0x33, 0xF1,
+    0x59, 0x63, 0xCD, 0xC3, 0xB8, 0xD7, 0x28, 0xF7, 0x57, 0x5E, 0x0D, 0x6D, 0x5D, 0xC0, 0xB6, 0xDF,
+    0xAF, 0xA9, 0x89, 0x71, 0xC9, 0x1B, 0x41, 0xB0, 0x19, 0xAC, 0xD0, 0x56, 0xF6, 0xE6, 0x6E, 0x6A,
+    0x22, 0x4E, 0x98, 0x97, 0xCC, 0x57, 0x77, 0xAA, 0x75, 0x60, 0x4D, 0x6E, 0x7D, 0x31, 0x1E, 0xE6,
+    0xBD, 0xD8, 0xF3, 0xC2, 0x63, 0x72, 0xFA, 0xB4, 0x82, 0xEE, 0x2A, 0x7F, 0x5E, 0x5B, 0xCC, 0x88,
+    0xB8, 0xDA, 0xEE, 0x76, 0xE0, 0x03, 0xC6, 0xA3, 0x4C, 0x87, 0xBC, 0xEE, 0xF6, 0x78, 0x8F, 0xF0,
+    0x3E, 0xDF, 0x89, 0x7B, 0xF8, 0x18, 0x05, 0x9B, 0x45, 0xB8, 0x6E, 0xE6, 0x52, 0x8D, 0xEF, 0x36,
+    0x68, 0x4A, 0xE1, 0xA6, 0xB0, 0xCF, 0xA1, 0x6B, 0x21, 0x2F, 0xC8, 0x13, 0xF2, 0x86, 0xEE, 0x85,
+    0xBE, 0xB2, 0x44, 0xD9, 0xCF, 0x17, 0x43, 0x9A, 0xDC, 0x75, 0x84, 0xD8, 0x75, 0xBA, 0x1F, 0xF9,
+    0xA9, 0xAA, 0x56, 0xBB, 0x2B, 0xFC, 0xF5, 0x87, 0x7F, 0xA7, 0xC4, 0xF2, 0x0B, 0x59, 0x8C, 0x9D,
+    0x14, 0xDE, 0x4F, 0x05, 0x7C, 0x62, 0xCE, 0xA4, 0xED, 0xF0, 0x54, 0x6E, 0x28, 0xA2, 0x28, 0xAF,
+    0xC5, 0x9E, 0x59, 0xC3, 0x94, 0x12, 0x71, 0xDD, 0xB0, 0xE1, 0xB3, 0xB1, 0x0F, 0x5A, 0x3D, 0x97,
+    0x26, 0x72, 0xB8, 0xE9, 0x57, 0x65, 0xCF, 0x0D, 0xF9, 0x26, 0x79, 0xB3, 0xBC, 0xB4, 0x48, 0x6F,
+    0xD9, 0x20, 0x2B, 0xAC, 0x75, 0xAC, 0xA9, 0xAD, 0x53, 0x1A, 0xB3, 0x97, 0xBB, 0xDC, 0x73, 0xAD,
+    0xAE, 0x3C, 0x8E, 0xDE, 0xD1, 0x06, 0x2D, 0xA5, 0xC3, 0x13, 0xD5, 0xA0, 0x7F, 0x06, 0x3C, 0x0E,
+    0x91, 0x7F, 0x30, 0x76, 0x1D, 0xCF, 0x88, 0xF1, 0x0F, 0xB2, 0x3E, 0x4F, 0xA9, 0x68, 0x32, 0xCA,
+    0xA6, 0x6C, 0xA9, 0x5B, 0x97, 0x66, 0x23, 0x51, 0xE4, 0xA9, 0xC2, 0xFB, 0x48, 0xB9, 0xC8, 0x88,
+    0xB1, 0xEC, 0xAA, 0xE1, 0xC6, 0x81, 0x85, 0x47, 0x02, 0x91, 0x16, 0xED, 0xCF, 0xDD, 0xAD, 0x50,
+    0xCB, 0xB3, 0x1B, 0xF6, 0xF2, 0x6D, 0xE3, 0xBE, 0x6D, 0x28, 0xF5, 0x01, 0x71, 0x3A, 0xFD, 0xD4,
+    0xDD, 0x4A, 0x4E, 0x74, 0xFF, 0x89, 0xDC, 0x90, 0x88, 0xFF, 0x77, 0x97, 0xBF, 0x5D, 0x60, 0x4B,
+    0x7A, 0x4D, 0x18, 0xC5, 0xAE, 0xEC, 0x24, 0x40, 0xAB, 0xFF, 0xC1, 0x6C, 0x2D, 0x19, 0xDA, 0x2E,
+    0xFB, 0x75, 0xD9, 0x1A, 0x5C, 0x01, 0xF9, 0x62, 0xFE, 0x5B, 0x54, 0x1B, 0xB3, 0x0D, 0xEE, 0x48,
+    0xF0, 0x7F, 0x3C, 0x7F, 0x01, 0xC5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x9D, 0xB5, 0xA5, 0x58,
+    0xC2, 0x52, 0x96, 0x02, 0x0A, 0xBE, 0xE4, 0x16, 0x89, 0x80, 0x1B, 0x8A, 0x14, 0x21, 0x36, 0xFC,
+    0x01, 0x28, 0x72, 0xB4, 0xD4, 0x14, 0x28, 0x2D, 0x45, 0xC4, 0xF9, 0x27, 0xA4, 0x09, 0x0D, 0xCD,
+    0x15, 0x54, 0x34, 0xA1, 0x48, 0x11, 0x09, 0x88, 0xFD, 0x13, 0x4E, 0xA2, 0xA4, 0x71, 0x41, 0x95,
+    0x06, 0x0B, 0xB9, 0xC8, 0x85, 0xCB, 0x0D, 0xEF, 0x8D, 0xE3, 0xE3, 0x2B, 0x57, 0x21, 0xC8, 0x5A,
+    0xB7, 0x67, 0xEF, 0xAE, 0x67, 0xE6, 0xBD, 0x79, 0x33, 0x16, 0x11, 0x59, 0xC3, 0x4F, 0x82, 0x86,
+    0xB3, 0xCF, 0x31, 0xA9, 0x9E, 0x88, 0x84, 0xAA, 0x58, 0xB9, 0xB0, 0x7B, 0x98, 0xCB, 0xD2, 0x36,
+    0x4F, 0xE8, 0x57, 0x3C, 0x27, 0xFA, 0xA5, 0x10, 0x77, 0x14, 0x4F, 0x71, 0x9B, 0x7B, 0x2C, 0xB4,
+    0x92, 0x15, 0x12, 0x55, 0x82, 0x37, 0xEE, 0x49, 0x64, 0x0B, 0x29, 0x16, 0xC6, 0x0E, 0x0B, 0xC9,
+    0x38, 0xC5, 0xC2, 0x50, 0xB5, 0xA2, 0x4D, 0x35, 0xCB, 0x47, 0x98, 0xCB, 0x8F, 0x63, 0xF9, 0x75,
+    0x5C, 0x2D, 0x4F, 0x78, 0xF0, 0x44, 0xCE, 0x1A, 0x31, 0xDF, 0xF2, 0x0C, 0x27, 0xD1, 0xC3, 0x6D,
+    0x49, 0xB9, 0x96, 0x71, 0x5A, 0xE7, 0xF4, 0x9E, 0xD3, 0x54, 0xCC, 0x78, 0x2D, 0x4E, 0x75, 0x2C,
+    0x01, 0x3D, 0x86, 0xC4, 0x13, 0xD5, 0x7C, 0x9F, 0xDE, 0x7C, 0xD5, 0x4F, 0xE9, 0xCE, 0xE0, 0x91,
+    0x64, 0x34, 0x67, 0xD3, 0x90, 0x53, 0x69, 0x60, 0xE7, 0xA1, 0x84, 0xB4, 0xB2, 0x60, 0x94, 0x05,
+    0x7E, 0x25, 0x22, 0xC8, 0x57, 0x25, 0x2E, 0x82, 0x2A, 0xA8, 0x65, 0x4B, 0xD6, 0x77, 0xB5, 0x42,
+    0x98, 0x53, 0x99, 0x6C, 0xC0, 0x0B, 0x4E, 0xB9, 0x16, 0x53, 0x42, 0x77, 0xBA, 0xF3, 0x8C, 0x08,
+    0x2A, 0x49, 0xB1, 0x2D, 0x9B, 0x13, 0xDA, 0xB8, 0x8E, 0x4B, 0x6E, 0x93, 0xF7, 0xE4, 0x25, 0x0E,
+    0x7A, 0x7A, 0x0B, 0x66, 0x72, 0xCE, 0xE8, 0x0B, 0xC9, 0xE5, 0x06, 0x22, 0x73, 0x4D, 0x5C, 0xC0,
+    0x23, 0x5E, 0xCE, 0x88, 0xE2, 0xE2, 0x22, 0x26, 0x24, 0x46, 0x32, 0xE3, 0x6F, 0x8D, 0x84, 0x6D,
+    0x58, 0xC8, 0xBE, 0xAC, 0xC8, 0x1D, 0x28, 0x21, 0x3C, 0x04, 0x4E, 0x58, 0xAC, 0xFC, 0x0E, 0xB4,
+    0x44, 0xBB, 0x09, 0xFE, 0x1D, 0x63, 0xF4, 0x93, 0xC7, 0x63, 0x6C, 0x4D, 0xBB, 0x10, 0x97, 0x74,
+    0x7B, 0x6E, 0x89, 0x30, 0x2C, 0xE4, 0xD4, 0x28, 0x3B, 0xD3, 0x5B, 0x4A, 0x84, 0x94, 0x51, 0xA4,
+    0xC7, 0xAF, 0x3B, 0x1E, 0x68, 0x34, 0x24, 0xC8, 0x1F, 0x4F, 0xAA, 0x05, 0x88, 0x82, 0x90, 0x4A,
+    0x60, 0x32, 0x93, 0x09, 0x12, 0x26, 0x1F, 0x7A, 0x07, 0x46, 0xC2, 0xC1, 0x60, 0x90, 0x87, 0x34,
+    0xE5, 0x99, 0x33, 0x72, 0x80, 0x88, 0xA8, 0x52, 0x1B, 0xCC, 0x1D, 0xCF, 0x52, 0xCD, 0xBE, 0x59,
+    0xA8, 0x02, 0x22, 0xA7, 0x08, 0x00, 0x9C, 0x1A, 0x20, 0x6E, 0x4A, 0x80, 0xB0, 0xFD, 0x29, 0x6A,
+    0x0A, 0x80, 0xA0, 0x99, 0x7F, 0xC3, 0xDC, 0xA5, 0xFF, 0xFF, 0x80, 0x09, 0xB8, 0xB9, 0x42, 0x5B,
+    0x54, 0x40, 0x48, 0x83, 0x6E, 0xF4, 0xB7, 0xC1, 0x2F, 0x63, 0xF3, 0x79, 0x67, 0x92, 0xF6, 0x59,
+    0xE5, 0x72, 0x65, 0xCE, 0x4A, 0x03, 0x1D, 0x48, 0xB3, 0x87, 0x75, 0xED, 0x3B, 0x4A, 0xB0, 0x80,
+    0x3F, 0x40, 0x0B, 0x19, 0xAF, 0x89, 0x7A, 0x9E, 0x7E, 0x5F, 0xFC, 0x2C, 0x06, 0xAF, 0x33, 0x76,
+    0x85, 0xB6, 0xD3, 0x8B, 0x81, 0x7D, 0x41, 0x93, 0x6D, 0x0F, 0x9D, 0x75, 0x10, 0x4C, 0x06, 0x83,
+    0x0E, 0x3A, 0x05, 0xED, 0x08, 0x3D, 0xEE, 0x9A, 0x8D, 0xC3, 0x25, 0x7B, 0x51, 0x2E, 0xF1, 0xC3,
+    0xBC, 0x13, 0x55, 0x62, 0xAB, 0x0B, 0x06, 0x0B, 0x90, 0xB4, 0xF8, 0xF1, 0xB2, 0x15, 0x76, 0x5C,
+    0xB8, 0x86, 0xBC, 0x90, 0x4D, 0xAB, 0xEB, 0xB5, 0x53, 0x62, 0xA8, 0x0B, 0x2B, 0x6B, 0x24, 0xB1,
+    0x0B, 0xED, 0xDA, 0x8C, 0x6D, 0x53, 0x88, 0xBE, 0x0B, 0x51, 0xFC, 0x3E, 0x9F, 0x2B, 0x9E, 0x7C,
+    0xEB, 0x7E, 0xEB, 0x25, 0x97, 0x68, 0x47, 0x35, 0xE7, 0xFB, 0xAD, 0xF8, 0x59, 0xEE, 0xF2, 0xD0,
+    0x3A, 0x9F, 0xD2, 0x4A, 0x52, 0xF7, 0xD9, 0x42, 0x82, 0x58, 0x64, 0xA6, 0x40, 0x6B, 0x0E, 0x7E,
+    0x2C, 0x4F, 0x73, 0x54, 0x52, 0xA4, 0x2D, 0xEA, 0xE4, 0x96, 0x3E, 0xC0, 0x29, 0x3F, 0xC2, 0x2D,
+    0x02, 0x55, 0xB2, 0x91, 0xEA, 0x9B, 0xB2, 0x26, 0x05, 0x33, 0x32, 0x82, 0x5E, 0x90, 0x59, 0xC3,
+    0xDD, 0xD4, 0xCF, 0x06, 0x70, 0xDE, 0x09, 0xDE, 0xE1, 0x2E, 0xBA, 0x0F, 0x47, 0x77, 0x65, 0xF4,
+    0x73, 0x85, 0x55, 0x23, 0xB4, 0x9B, 0x4F, 0x95, 0x1C, 0xEC, 0xCE, 0x50, 0xC9, 0x49, 0x8B, 0x96,
+    0x9E, 0x55, 0xAE, 0x86, 0x77, 0x8F, 0x22, 0x07, 0x01, 0xD0, 0x04, 0x9F, 0x6C, 0xCF, 0x13, 0x79,
+    0xD6, 0xA7, 0x48, 0x86, 0xAF, 0xFA, 0xFC, 0x80, 0x9F, 0x25, 0x07, 0xE5, 0x66, 0xC8, 0x89, 0xEB,
+    0x2A, 0x9D, 0x5D, 0x7F, 0xA3, 0x2B, 0x2E, 0x76, 0x19, 0xC8, 0x12, 0xC2, 0x0C, 0xEA, 0x38, 0x97,
+    0xAE, 0xD1, 0xC8, 0x90, 0x39, 0x5D, 0xD0, 0x6A, 0xCE, 0x8B, 0xAF, 0x1A, 0xD7, 0x32, 0x03, 0x9D,
+    0x3C, 0x41, 0xC1, 0x30, 0x4C, 0xF3, 0xF5, 0x67, 0x1B, 0x6C, 0x6E, 0x1A, 0x6D, 0xC1, 0x71, 0x79,
+    0x24, 0x5B, 0x4E, 0x73, 0x8F, 0x2F, 0xA3, 0xB1, 0xB6, 0x86, 0x10, 0xC2, 0x0A, 0x11, 0xAC, 0xE2,
+    0x2B, 0x69, 0xA4, 0xC1, 0x01, 0xCB, 0xBA, 0xEE, 0xCA, 0xDA, 0x38, 0x73, 0x24, 0x67, 0x08, 0x62,
+    0x86, 0xB5, 0x51, 0x16, 0x51, 0xBC, 0x9B, 0xE0, 0x4F, 0x2E, 0xCB, 0xBF, 0x1F, 0xDF, 0x01, 0xC5,
+    0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x9E, 0xF5, 0x8A, 0x5B, 0xE9, 0xAC, 0xC8, 0x15, 0x12, 0x08,
+    0x29, 0x6E, 0x29, 0x02, 0x6E, 0x28, 0x52, 0xBC, 0x93, 0x57, 0x4A, 0x89, 0x84, 0x28, 0x80, 0xBF,
+    0x11, 0x0A, 0x8A, 0x13, 0x3A, 0xCE, 0xCE, 0xAF, 0x48, 0x41, 0x73, 0x4D, 0x9A, 0x0B, 0x12, 0x14,
+    0x14, 0x29, 0xC2, 0xF3, 0x8A, 0x5F, 0x60, 0xA5, 0xA5, 0x71, 0x4D, 0x81, 0xB6, 0x30, 0xD2, 0xBB,
+    0xC8, 0x7E, 0xCB, 0xF7, 0x8D, 0xFD, 0x94, 0x3B, 0xE5, 0x35, 0x28, 0x45, 0x56, 0xEF, 0x8D, 0xAC,
+    0xD9, 0xF5, 0xCC, 0xF7, 0x7D, 0x33, 0xB3, 0x16, 0x59, 0xD7, 0x4B, 0x9A, 0x9A, 0xA6, 0x0A, 0x30,
+    0x45, 0x94, 0xB7, 0x97, 0xF1, 0x22, 0x2E, 0xA5, 0x5E, 0xAA, 0x94, 0x46, 0xA9, 0x6F, 0xE4, 0x03,
+    0xA9, 0x7B, 0xBE, 0x46, 0x53, 0x0E, 0x87, 0xD7, 0xEC, 0x08, 0x93, 0x4D, 0x7C, 0x63, 0xAF, 0x51,
+    0xBD, 0x79, 0x26, 0x65, 0x90, 0x26, 0x7D, 0x19, 0xE5, 0x34, 0xBD, 0xC2, 0x4E, 0x71, 0xD5, 0x21,
+    0x54, 0xA8, 0xA3, 0xD8, 0x98, 0xA7, 0xBF, 0x7F, 0xDD, 0x99, 0x94, 0xD2, 0x5E, 0x6A, 0x58, 0x6F,
+    0x61, 0x5A, 0xF9, 0x24, 0xDD, 0x68, 0xCE, 0x1D, 0x11, 0xB5, 0x6B, 0xD0, 0xCE, 0x1F, 0x41, 0x25,
+    0x5D, 0xD6, 0x4A, 0x37, 0xBF, 0x94, 0xEA, 0x79, 0x6A, 0x5D, 0x28, 0x47, 0x19, 0x25, 0xC9, 0x7D,
+    0x29, 0x06, 0x1B, 0x64, 0x96, 0x0D, 0x52, 0xDB, 0xD6, 0xEE, 0xE4, 0xC2, 0x68, 0xEC, 0x88, 0x2C,
+    0x7B, 0x31, 0xA4, 0xE1, 0x6E, 0xC8, 0xBA, 0x44, 0x74, 0x17, 0xE5, 0x23, 0xB7, 0x17, 0x6C, 0x13,
+    0x66, 0x94, 0x93, 0x84, 0xBC, 0xE6, 0xEB, 0xF7, 0x47, 0xFB, 0xD8, 0x4A, 0x72, 0x90, 0xA0, 0x66,
+    0x89, 0xCA, 0xFE, 0x90, 0xD9, 0x31, 0xB3, 0xDD, 0xDD, 0x96, 0xA4, 0x5D, 0xB6, 0xCC, 0x7E, 0x2D,
+    0xE8, 0x22, 0xDF, 0xE1, 0xAD, 0xC3, 0xCA, 0xE3, 0xA7, 0x92, 0xA7, 0xBF, 0x42, 0xF6, 0xBA, 0x5B,
+    0xF4, 0x29, 0x7C, 0x11, 0xCD, 0x00, 0xFC, 0x1B, 0x29, 0x7A, 0x1B, 0xCC, 0x24, 0x0F, 0xA5, 0x5E,
+    0x44, 0x05, 0x48, 0xEA, 0x33, 0x48, 0x99, 0x66, 0x91, 0xE6, 0x67, 0x04, 0x35, 0x4C, 0xD9, 0x88,
+    0x69, 0x9B, 0x01, 0xDB, 0x13, 0x45, 0x12, 0x79, 0x0C, 0x16, 0xF2, 0xE1, 0x22, 0x1C, 0xB5, 0x41,
+    0x20, 0xDA, 0x4B, 0x3E, 0xDB, 0x27, 0x84, 0xFB, 0x50, 0xBE, 0xBF, 0xC3, 0xCB, 0xC2, 0x39, 0x49,
+    0x11, 0xF8, 0x70, 0xC9, 0x6A, 0x67, 0x00, 0x3B, 0xAF, 0x8E, 0x06, 0x90, 0x03, 0x55, 0xDD, 0xA2,
+    0xA0, 0xA4, 0x51, 0x7B, 0x38, 0x00, 0x0C, 0x6C, 0xC0, 0xD0, 0x4E, 0xAA, 0xDE, 0x40, 0x21, 0x93,
+    0xCF, 0x61, 0x16, 0x47, 0x34, 0xE9, 0xFA, 0x3A, 0xB5, 0xF9, 0x28, 0x76, 0xA6, 0x5C, 0x38, 0x0A,
+    0x6C, 0x4D, 0x70, 0x93, 0x64, 0x7B, 0xA9, 0x06, 0x29, 0x88, 0x7D, 0x58, 0x38, 0xD8, 0x7F, 0x80,
+    0xF2, 0x51, 0x90, 0x07, 0xF2, 0xC3, 0x02, 0x08, 0x88, 0xD1, 0x3B, 0x92, 0x53, 0x45, 0xE8, 0x5D,
+    0xC0, 0xF7, 0x39, 0xFE, 0x67, 0xF8, 0x6F, 0x3E, 0xF6, 0xB2, 0x45, 0x87, 0xA4, 0x84, 0xE2, 0xF9,
+    0x09, 0xC8, 0x2E, 0x80, 0xF2, 0xDC, 0x0D, 0xF2, 0x22, 0x0F, 0x32, 0x02, 0x74, 0x2C, 0xDB, 0x2C,
+    0x56, 0xDE, 0x0E, 0xB5, 0xB8, 0xA1, 0x01, 0xFD, 0x8E, 0x54, 0xB0, 0x99, 0x45, 0x0E, 0x58, 0xA1,
+    0xE0, 0x2F, 0x25, 0x1F, 0x24, 0x53, 0x36, 0xD8, 0x9C, 0x28, 0x23, 0x7A, 0x30, 0x9B, 0x94, 0xC7,
+    0x8E, 0x3C, 0x52, 0x9F, 0xFF, 0xFB, 0xED, 0x77, 0x33, 0xAB, 0x47, 0xF0, 0xD7, 0xD7, 0x5D, 0x0B,
+    0x7D, 0xA1, 0x7D, 0x45, 0x7A, 0xC2, 0x13, 0xC1, 0x6A, 0xFB, 0x80, 0x0D, 0x78, 0x26, 0x0F, 0x9E,
+    0x90, 0xC3, 0x24, 0x29, 0xA3, 0xE4, 0x3B, 0xF6, 0x40, 0x3D, 0xDC, 0x22, 0xF3, 0xE4, 0x1B, 0xD4,
+    0x66, 0x94, 0xEE, 0x99, 0x7F, 0x67, 0x32, 0x5C, 0x53, 0x2E, 0x9B, 0xAB, 0xDE, 0x3D, 0xFA, 0x45,
+    0x7E, 0x2B, 0x8F, 0x8C, 0x25, 0xAA, 0x4E, 0x9E, 0x40, 0x9F, 0xED, 0x38, 0x0B, 0x5A, 0x65, 0x14,
+    0x13, 0xB4, 0x49, 0xB7, 0x7C, 0xE3, 0x1F, 0x17, 0x7F, 0xD4, 0xB1, 0x41, 0x7B, 0x66, 0xB3, 0x36,
+    0xB8, 0x9B, 0x96, 0x36, 0xD6, 0xA1, 0xBA, 0xE7, 0xBE, 0x7A, 0x50, 0xB8, 0xF1, 0x54, 0x6E, 0x65,
+    0xFA, 0x5D, 0x24, 0xF2, 0x87, 0x2E, 0x03, 0x47, 0x50, 0x74, 0x81, 0x15, 0x43, 0xC1, 0x4A, 0xE4,
+    0xD5, 0xCB, 0x0C, 0xDD, 0xF4, 0xC7, 0x3A, 0xC3, 0xCF, 0x53, 0x5F, 0xA0, 0x43, 0xE4, 0x28, 0x52,
+    0x02, 0x60, 0x8F, 0x11, 0x1C, 0x20, 0x11, 0x20, 0xAA, 0xA1, 0xF7, 0xCE, 0xAD, 0xC7, 0x79, 0x19,
+    0x23, 0x40, 0xE7, 0x24, 0x71, 0xDE, 0x38, 0x4C, 0x18, 0x48, 0x4B, 0x42, 0xF1, 0x00, 0xD7, 0x64,
+    0x29, 0xFD, 0x99, 0xF6, 0x57, 0x6F, 0x32, 0x9C, 0x78, 0xAD, 0x00, 0x4E, 0x9C, 0x8B, 0x7C, 0xA6,
+    0xFD, 0x04, 0xAC, 0x19, 0x92, 0x21, 0xDC, 0x85, 0x82, 0x85, 0xA8, 0x4E, 0x1B, 0x42, 0x28, 0x1B,
+    0xB0, 0x40, 0x1D, 0x24, 0x83, 0x68, 0xC8, 0x0E, 0x58, 0x00, 0x89, 0x23, 0x40, 0x01, 0x78, 0xB5,
+    0xE2, 0xED, 0xA8, 0x97, 0x99, 0x79, 0x16, 0xF9, 0xA1, 0x16, 0x4A, 0x5E, 0x8C, 0x92, 0x0B, 0xDA,
+    0x98, 0x03, 0xF6, 0xA3, 0xD7, 0x9B, 0x4D, 0x4B, 0xC5, 0x98, 0xC0, 0xEB, 0x76, 0x77, 0x88, 0xE7,
+    0x9E, 0x48, 0xF0, 0xBB, 0xAF, 0xA8, 0x36, 0x8A, 0xE5, 0x05, 0x41, 0x99, 0xC8, 0x66, 0x65, 0x72,
+    0xB4, 0x56, 0xCF, 0x23, 0xD8, 0xFC, 0x42, 0xCB, 0x72, 0xB2, 0xC6, 0xFC, 0x89, 0x7A, 0x18, 0xCD,
+    0xFD, 0xB6, 0x9E, 0x90, 0xA8, 0xBA, 0x8B, 0x76, 0xBB, 0xA2, 0x58, 0x69, 0x8D, 0x4A, 0x2B, 0x72,
+    0xA4, 0xA1, 0x61, 0xD5, 0x33, 0x72, 0x13, 0x16, 0x01, 0xB3, 0xBE, 0x90, 0x8D, 0x19, 0x72, 0xBF,
+    0x31, 0x31, 0x6F, 0xCF, 0x60, 0x42, 0x6D, 0x76, 0x80, 0x81, 0xC8, 0x88, 0xA0, 0xB7, 0x41, 0x15,
+    0x40, 0xA7, 0x6A, 0x11, 0xA4, 0xF6, 0x39, 0xC7, 0x0A, 0x81, 0x1A, 0x2A, 0xB4, 0x65, 0x62, 0x5C,
+    0x01, 0x2D, 0x4E, 0xD6, 0x1E, 0xD9, 0x1A, 0x26, 0xDB, 0xD2, 0xCC, 0xC8, 0x09, 0x6F, 0x1E, 0xE1,
+    0xC5, 0xB7, 0x61, 0x44, 0x66, 0xBC, 0x5F, 0xF5, 0x50, 0xB7, 0x0E, 0x00, 0xDD, 0x84, 0x92, 0x08,
+    0xEA, 0x76, 0xBD, 0x65, 0x9F, 0xE2, 0xC2, 0x30, 0xBC, 0xEB, 0x32, 0x7E, 0x0C, 0x6C, 0xE2, 0x1C,
+    0xBD, 0x56, 0x82, 0x3A, 0x00, 0x20, 0xE5, 0x7A, 0xAB, 0x3D, 0x8C, 0x6F, 0x80, 0x51, 0x19, 0x8E,
+    0x7D, 0x35, 0xD1, 0xA6, 0xA7, 0x9E, 0xE5, 0xDF, 0x50, 0x47, 0x28, 0x7B, 0xCE, 0x8B, 0x25, 0xEB,
+    0x39, 0x81, 0x8B, 0xE3, 0x42, 0x1D, 0x83, 0x3A, 0x3C, 0xDB, 0x64, 0x71, 0x44, 0x75, 0x68, 0xDF,
+    0xA0, 0x8F, 0x9D, 0xDE, 0x8A, 0x67, 0x1A, 0x52, 0xB3, 0xE4, 0x5A, 0x08, 0xB6, 0xB7, 0x79, 0x4C,
+    0x47, 0xA1, 0xCD, 0xDD, 0x0D, 0xF2, 0xBF, 0xD6, 0x7F, 0xB5, 0x55, 0xBB, 0x6E, 0xD4, 0x40, 0x14,
+    0xBD, 0xB6, 0x03, 0x96, 0xB0, 0x14, 0xE7, 0x0B, 0xE2, 0x1F, 0x00, 0xDC, 0x52, 0x64, 0x33, 0xE6,
+    0x0B, 0x92, 0x02, 0x7E, 0x02, 0x5A, 0x8A, 0x14, 0x0B, 0xF6, 0x27, 0x50, 0xF0, 0x09, 0x29, 0xF8,
+    0x80, 0x14, 0x29, 0xD6, 0xB1, 0x97, 0x86, 0x92, 0x15, 0xA2, 0xA3, 0x60, 0xB5, 0x41, 0x42, 0x54,
+    0xB8, 0xB0, 0xC4, 0x4A, 0xF1, 0xEE, 0x70, 0xCE, 0xCC, 0x78, 0x1F, 0x79, 0x48, 0x50, 0x30, 0x92,
+    0xAF, 0x47, 0x9E, 0x3B, 0x77, 0xCE, 0x39, 0xF7, 0xCE, 0xB5, 0x88, 0x3C, 0x12, 0x8C, 0xB8, 0x86,
+    0x89, 0x4A, 0x98, 0xF0, 0xE9, 0x54, 0x24, 0xC8, 0x1E, 0x48, 0x3F, 0xDE, 0xD3, 0x54, 0x34, 0xAA,
+    0xA0, 0xE7, 0x84, 0x4E, 0x0D, 0x8C, 0x3F, 0xE7, 0xC7, 0x05, 0x4D, 0x4E, 0x93, 0xD6, 0xDB, 0xCB,
+    0xDD, 0x6A, 0x59, 0xD1, 0x24, 0x66, 0x19, 0xC1, 0x25, 0xE0, 0xB2, 0x67, 0x96, 0x2F, 0xAE, 0x2D,
+    0x63, 0xF7, 0x4E, 0x82, 0xE5, 0x40, 0x23, 0xB8, 0xA7, 0xE9, 0x53, 0xD1, 0xA8, 0x96, 0x5B, 0x7A,
+    0x48, 0xAF, 0x68, 0x08, 0xD6, 0xD3, 0x19, 0x7C, 0xC7, 0x08, 0xBA, 0x2B, 0x0F, 0x65, 0x63, 0x78,
+    0x06, 0x81, 0x39, 0xCC, 0x00, 0x32, 0xF4, 0x0C, 0xFC, 0x8C, 0x86, 0x2E, 0xFB, 0x34, 0x03, 0x9A,
+    0x03, 0x9A, 0x21, 0xCD, 0x19, 0x4D, 0xB3, 0xB5, 0xDF, 0x6C, 0x25, 0xB8, 0xFB, 0x3C, 0x2B, 0x5D,
+    0x12, 0xCC, 0xF7, 0xD5, 0x39, 0x7E, 0x1B, 0x74, 0xE0, 0x13, 0x35, 0xE0, 0x0C, 0xFE, 0xD1, 0x04,
+    0x4A, 0xC4, 0x63, 0x90, 0x4E, 0x3E, 0x02, 0x71, 0x7A, 0x84, 0x08, 0x8A, 0xB2, 0xE5, 0xDC, 0x67,
+    0xE8, 0xE8, 0x86, 0xB0, 0xA9, 0xB1, 0x36, 0x3C, 0xF1, 0x2D, 0xFA, 0x8D, 0xD5, 0xF8, 0x12, 0xF1,
+    0x93, 0xB1, 0xAE, 0xA1, 0x23, 0x96, 0x55, 0x51, 0xB5, 0x90, 0x55, 0x75, 0x90, 0x3E, 0xD5, 0x3D,
+    0xAB, 0xE7, 0x24, 0xC4, 0x28, 0x21, 0xB5, 0x8F, 0x9A, 0x5E, 0x51, 0x23, 0x7D, 0x4E, 0x6A, 0x2F,
+    0xC4, 0x32, 0x0D, 0xA6, 0x86, 0xC3, 0x48, 0xE4, 0xD0, 0x90, 0x8E, 0x6A, 0x7C, 0x2A, 0xA5, 0x2D,
+    0x65, 0x54, 0xCA, 0x61, 0x29, 0x71, 0x27, 0xE1, 0x02, 0xC7, 0xD7, 0x72, 0x35, 0x97, 0xD7, 0x55,
+    0xA6, 0xE2, 0x26, 0xFE, 0xA0, 0xC3, 0xA9, 0x9A, 0xB5, 0xD1, 0x42, 0xB6, 0x46, 0x5E, 0x8B, 0xAA,
+    0x79, 0x0E, 0xD2, 0x1A, 0xCC, 0x4D, 0x5E, 0x97, 0x76, 0x65, 0x6F, 0x47, 0xCE, 0x06, 0xD2, 0xB4,
+    0xDE, 0x6C, 0xEA, 0x7F, 0x2D, 0x82, 0x6F, 0x12, 0x76, 0x04, 0x15, 0x37, 0x92, 0x74, 0x32, 0xB8,
+    0x90, 0x03, 0x95, 0x9D, 0xA8, 0xBA, 0x4D, 0x00, 0x31, 0x04, 0xB8, 0x27, 0x00, 0x0F, 0xA0, 0x8F,
+    0x9D, 0xBC, 0x1B, 0xD9, 0x3A, 0x86, 0x60, 0x50, 0xA9, 0xB3, 0xB5, 0xC1, 0x69, 0x79, 0x73, 0x5A,
+    0x9B, 0x72, 0xE1, 0x34, 0x76, 0xD3, 0xD6, 0x4E, 0x73, 0xEA, 0xA8, 0xF5, 0x91, 0xD6, 0x5D, 0xAE,
+    0xF5, 0x0C, 0x53, 0x1C, 0xE6, 0x63, 0xE1, 0xC4, 0xA4, 0x9A, 0x15, 0x30, 0x92, 0x6B, 0xE3, 0x1C,
+    0x4B, 0x85, 0xC1, 0x91, 0x5A, 0x8F, 0xA1, 0x8D, 0x85, 0x90, 0x89, 0x50, 0x3D, 0x96, 0x06, 0x73,
+    0xDF, 0x59, 0xC7, 0xD6, 0x3A, 0xC2, 0x5F, 0x9D, 0x4A, 0x88, 0x03, 0xAA, 0xD6, 0x45, 0xBA, 0x1B,
+    0xED, 0x35, 0xE0, 0xED, 0xDF, 0x01, 0x5F, 0x0F, 0x6D, 0xF3, 0x0C, 0xF1, 0x29, 0x38, 0xB3, 0xAD,
+    0x32, 0x9B, 0x7E, 0x37, 0x90, 0xD4, 0x01, 0x39, 0xF4, 0x6F, 0x00, 0xDD, 0x7E, 0xD7, 0xC8, 0x3E,
+    0xA0, 0x63, 0x1D, 0x77, 0x6C, 0xF9, 0x16, 0xB8, 0xD3, 0xC5, 0x66, 0x7C, 0x84, 0x47, 0xF4, 0x05,
+    0x63, 0xE7, 0xD9, 0x46, 0xE4, 0x10, 0xFC, 0xA3, 0x89, 0x05, 0x49, 0x52, 0x69, 0x76, 0x0F, 0x11,
+    0xF6, 0x01, 0x78, 0x00, 0x56, 0x07, 0x10, 0xE5, 0x1C, 0xF7, 0xB7, 0x65, 0x07, 0x20, 0x17, 0xB2,
+    0x8C, 0xA6, 0xF6, 0xFA, 0x9A, 0x2D, 0x78, 0x94, 0xD6, 0x2D, 0x9E, 0x06, 0xC4, 0xA6, 0x95, 0xD6,
+    0xBC, 0x85, 0x7B, 0xC8, 0xCA, 0x44, 0x46, 0x31, 0xE4, 0x1D, 0x4A, 0x82, 0xDB, 0xC5, 0xE9, 0xC4,
+    0x08, 0x2E, 0x73, 0xB9, 0x6D, 0xDA, 0xD9, 0x54, 0x24, 0x99, 0xC9, 0xA0, 0x49, 0xFD, 0x4F, 0xC8,
+    0xD6, 0x8A, 0x6F, 0x02, 0xB2, 0x6E, 0xBC, 0xB9, 0xF5, 0x33, 0x5D, 0x84, 0x58, 0xA3, 0x49, 0x54,
+    0x07, 0x4D, 0xD0, 0x78, 0x73, 0x54, 0x6A, 0x09, 0x92, 0xCA, 0x5D, 0x60, 0x22, 0x34, 0xAD, 0xA7,
+    0x73, 0x8D, 0x07, 0x6A, 0x1A, 0xB8, 0x61, 0x63, 0xF3, 0x90, 0xE1, 0xA9, 0x89, 0x37, 0x05, 0x76,
+    0x2B, 0xC4, 0xC8, 0x5C, 0x1E, 0x96, 0x89, 0x72, 0x85, 0x14, 0x4D, 0xE2, 0x02, 0xD4, 0xD3, 0x3A,
+    0x0D, 0xBA, 0x7F, 0x29, 0x93, 0x8D, 0xD1, 0x17, 0x63, 0xBA, 0x4E, 0xA3, 0x6D, 0x26, 0x8D, 0x2B,
+    0xA8, 0x91, 0xEB, 0x2D, 0xCE, 0x41, 0x39, 0x87, 0x70, 0xE6, 0xAE, 0x4D, 0x39, 0xB4, 0xEF, 0xF8,
+    0x97, 0xAD, 0x17, 0xCF, 0xA8, 0xC1, 0x88, 0xEE, 0xB4, 0xA0, 0xCF, 0x72, 0xEE, 0x0A, 0x8A, 0xDC,
+    0x8D, 0xE7, 0x62, 0x7D, 0xA9, 0xED, 0x61, 0x73, 0x97, 0x71, 0xDD, 0x87, 0x72, 0x67, 0xBC, 0xC9,
+    0x9D, 0xC3, 0x27, 0xAD, 0x17, 0xA6, 0xA7, 0x53, 0x1D, 0xF6, 0xED, 0x44, 0xB3, 0x39, 0x4B, 0xEE,
+    0xDB, 0x7A, 0x4D, 0x5C, 0xA4, 0xD0, 0x6D, 0xF4, 0xFA, 0x32, 0xCA, 0xFB, 0x0B, 0xE2, 0x30, 0x78,
+    0x37, 0x84, 0xB0, 0xBC, 0x06, 0xAB, 0x86, 0x6D, 0x5B, 0xF4, 0xE6, 0x87, 0xF8, 0xAE, 0x0F, 0xC8,
+    0xBC, 0x7F, 0xB5, 0x3C, 0xF6, 0x5E, 0xEA, 0x2F, 0x28, 0x86, 0x77, 0x87, 0xC6, 0xA3, 0x5D, 0x07,
+    0x35, 0xFF, 0x14, 0x94, 0xFC, 0x8A, 0x5A, 0x5F, 0xF8, 0xBB, 0xC6, 0xDA, 0x9F, 0xC5, 0x89, 0xF4,
+    0xFD, 0xDE, 0xFE, 0x26, 0x6E, 0x1D, 0xCF, 0xC4, 0x3F, 0x65, 0x7E, 0x71, 0x3D, 0x50, 0xEF, 0x51,
+    0xC7, 0x8A, 0x8F, 0x17, 0xA4, 0x1B, 0x2F, 0xA9, 0x2B, 0x7E, 0x09, 0xA8, 0x7B, 0xA5, 0x29, 0x84,
+    0xCA, 0x25, 0x2D, 0xA4, 0x52, 0x19, 0x4A, 0x6B, 0xA9, 0x8A, 0x1C, 0x7A, 0xA7, 0xC5, 0x05, 0x5A,
+    0x66, 0x52, 0xA3, 0xD9, 0x76, 0xC9, 0x18, 0x5D, 0x77, 0x1E, 0x7F, 0x46, 0x97, 0x6C, 0xE3, 0x4B,
+    0x84, 0x69, 0xA2, 0x1F, 0xE8, 0x95, 0x4D, 0x78, 0xD5, 0x48, 0x3A, 0x0D, 0xD8, 0xF6, 0x27, 0x6C,
+    0xC9, 0x79, 0x4D, 0x5B, 0xD5, 0xBE, 0x2E, 0xE4, 0xFF, 0x8E, 0x3F, 0xCD, 0x54, 0xBD, 0x8E, 0xD4,
+    0x30, 0x18, 0x9C, 0xD8, 0x40, 0x10, 0x2E, 0x4C, 0x71, 0xD4, 0xEE, 0x01, 0x29, 0x4F, 0x00, 0x71,
+    0x4D, 0x45, 0x71, 0x47, 0x4B, 0x4F, 0x4D, 0x41, 0x01, 0xC4, 0x15, 0x0D, 0x0D, 0x3C, 0x06, 0x15,
+    0x0D, 0x05, 0x05, 0x52, 0xCC, 0x1B, 0x44, 0x3C, 0x41, 0x24, 0x84, 0x28, 0x49, 0x11, 0xA4, 0x1C,
+    0xE7, 0xAC, 0x99, 0xCF, 0x8B, 0x38, 0x90, 0x96, 0x2D, 0x00, 0xE9, 0xCE, 0xAB, 0xFD, 0xF2, 0xE3,
+    0xC4, 0x33, 0xDF, 0xCC, 0xC4, 0x00, 0x0C, 0x80, 0xDA, 0x03, 0x3A, 0x6E, 0xFF, 0x6A, 0xC4, 0xCE,
+    0x51, 0xDF, 0x59, 0xA0, 0x72, 0x8E, 0xC8, 0x2F, 0x67, 0x74, 0xB8, 0x8D, 0xC6, 0xDB, 0x60, 0xA3,
+    0x1E, 0xEA, 0xA1, 0x9A, 0xD5, 0x84, 0x77, 0x48, 0x68, 0x39, 0xE1, 0x42, 0x13, 0xCC, 0x68, 0x07,
+    0x3D, 0xD7, 0x13, 0x92, 0x4A, 0xBC, 0xF5, 0x63, 0x54, 0x87, 0xE0, 0x33, 0x3A, 0xA1, 0x5A, 0x50,
+    0xF3, 0x64, 0x86, 0x5D, 0xA1, 0x27, 0xA9, 0x66, 0x84, 0xDB, 0xC0, 0x0E, 0x68, 0x33, 0x6C, 0x44,
+    0xDB, 0xA1, 0x89, 0xE8, 0x5B, 0xDF, 0x7A, 0x6C, 0xDA, 0xC0, 0x15, 0xD6, 0x26, 0xF4, 0x50, 0xC9,
+    0x45, 0xBE, 0x91, 0xDC, 0xFB, 0x84, 0x7A, 0xB1, 0x1F, 0x12, 0xCC, 0x6C, 0x3F, 0x72, 0x99, 0xC9,
+    0x7C, 0x9E, 0xE0, 0xA6, 0xFA, 0x64, 0x42, 0x33, 0xEA, 0x3C, 0xA2, 0x1D, 0x34, 0x99, 0x76, 0x51,
+    0x6A, 0x1F, 0x55, 0x0E, 0xBF, 0x72, 0x60, 0x2F, 0x8B, 0x54, 0x3B, 0x95, 0x5A, 0xFA, 0x25, 0x1C,
+    0x07, 0xE1, 0x38, 0x72, 0x79, 0xF2, 0x55, 0xA9, 0x0F, 0x5F, 0x07, 0xF4, 0x79, 0x92, 0xA6, 0xAB,
+    0x84, 0x45, 0xCD, 0x58, 0xC8, 0x78, 0x96, 0x9E, 0x4D, 0x54, 0x13, 0xFB, 0x9F, 0x5C, 0xAC, 0x47,
+    0x69, 0xB9, 0xF5, 0x76, 0xE8, 0xC8, 0xBE, 0x87, 0x2B, 0x8B, 0xE1, 0x88, 0x70, 0x1B, 0x48, 0xC3,
+    0xD0, 0x04, 0x34, 0x84, 0x63, 0x87, 0x68, 0x39, 0x7B, 0xDD, 0x9F, 0x0A, 0xAB, 0xE2, 0x15, 0x39,
+    0x4C, 0x6F, 0xA4, 0x76, 0x43, 0x61, 0x53, 0x26, 0x2E, 0xEF, 0xF4, 0xE1, 0x6C, 0x55, 0xAC, 0x7C,
+    0xE5, 0xF1, 0xA8, 0x0E, 0x30, 0xCF, 0xFD, 0x56, 0x29, 0x27, 0x9C, 0xFE, 0x73, 0x5E, 0x0E, 0xC4,
+    0x17, 0xC9, 0xA2, 0x38, 0xF4, 0x54, 0x40, 0xE4, 0xE2, 0x2E, 0xF6, 0x0F, 0xFD, 0x8C, 0x2A, 0x8B,
+    0x59, 0xF6, 0xD8, 0x79, 0xAC, 0x78, 0x4B, 0x48, 0x13, 0x28, 0xCD, 0x42, 0x74, 0xEB, 0xCD, 0x40,
+    0xF7, 0x04, 0x53, 0x4C, 0x53, 0x0B, 0xD7, 0x6D, 0x09, 0x4C, 0xFD, 0x56, 0xFC, 0xB4, 0xEC, 0xCC,
+    0x43, 0xAA, 0x4B, 0xF8, 0xEA, 0x4D, 0x49, 0x41, 0x12, 0x19, 0xB2, 0x68, 0xD0, 0x1C, 0xCB, 0x8D,
+    0x83, 0xBF, 0x8F, 0xA4, 0xE4, 0xBB, 0x25, 0x40, 0xEF, 0xB9, 0x22, 0xD7, 0x5B, 0x7E, 0x53, 0xAE,
+    0xF8, 0xC4, 0x89, 0x6F, 0x61, 0x97, 0xAE, 0x97, 0xB2, 0x7C, 0x22, 0x7D, 0x26, 0xA9, 0x3A, 0xDF,
+    0x23, 0x4D, 0x37, 0x4B, 0x88, 0x3B, 0x9E, 0x0C, 0x12, 0x01, 0x3B, 0xD2, 0x35, 0x56, 0x6A, 0x45,
+    0x8D, 0xE8, 0x22, 0xCC, 0x20, 0x41, 0xB7, 0x51, 0x3C, 0xB4, 0xD1, 0x71, 0x55, 0x71, 0x59, 0xBE,
+    0x2F, 0xA9, 0x64, 0x33, 0x40, 0xAF, 0x68, 0xD6, 0xA3, 0x3E, 0xC1, 0xE5, 0x9C, 0xA9, 0x0E, 0xEB,
+    0x08, 0xC3, 0x1A, 0x84, 0xCD, 0x2A, 0x3D, 0xE7, 0x17, 0xA7, 0xA1, 0x7F, 0xD0, 0x13, 0x90, 0xB7,
+    0x2B, 0xBF, 0xD3, 0xFA, 0x1B, 0xEC, 0xC7, 0x51, 0x13, 0xF3, 0xF5, 0x7E, 0xAC, 0x66, 0x3C, 0xA6,
+    0xE1, 0x0C, 0x5A, 0xC4, 0x2D, 0x7A, 0x5F, 0x47, 0xEB, 0x91, 0x2A, 0x6A, 0xEF, 0x5D, 0x20, 0xBB,
+    0xFC, 0x65, 0x15, 0x38, 0x4F, 0x1B, 0x49, 0xB2, 0x2F, 0x20, 0x3A, 0xA8, 0x20, 0xDB, 0x5F, 0xD9,
+    0x08, 0x3F, 0x49, 0xE2, 0xAA, 0x5C, 0x24, 0xEA, 0xC2, 0x9E, 0xC0, 0x9D, 0x07, 0x61, 0x02, 0x3C,
+    0x6E, 0xF2, 0xA7, 0x46, 0x23, 0xD6, 0x92, 0x50, 0x47, 0x34, 0x5C, 0xFD, 0x23, 0xE9, 0x7F, 0x95,
+    0x8A, 0x0E, 0x5C, 0x63, 0x23, 0x91, 0x6F, 0x72, 0x9F, 0x62, 0xFA, 0x50, 0xBE, 0x0C, 0xD2, 0xB8,
+    0x70, 0x5E, 0x45, 0xDA, 0x8E, 0x45, 0x48, 0x27, 0xAE, 0xC8, 0xAF, 0x86, 0x00, 0x87, 0xB8, 0xE8,
+    0xF7, 0xED, 0x26, 0xA2, 0x13, 0x23, 0x47, 0x0E, 0xFD, 0x11, 0x09, 0x3E, 0x91, 0x8D, 0x4E, 0xA4,
+    0x92, 0x23, 0x11, 0x03, 0xFB, 0xE7, 0x45, 0x8B, 0xA2, 0x16, 0x37, 0x13, 0xEE, 0x20, 0x76, 0x43,
+    0x99, 0x74, 0x16, 0xAD, 0x8A, 0x60, 0x6A, 0xE3, 0x71, 0xBE, 0xC7, 0x77, 0xCD, 0x54, 0xBB, 0x6E,
+    0xD4, 0x40, 0x14, 0x3D, 0xB6, 0x51, 0x0C, 0xB1, 0x60, 0x68, 0x10, 0x48, 0x28, 0xF1, 0x17, 0xC0,
+    0xB6, 0x14, 0x91, 0x76, 0x3E, 0x81, 0x82, 0x40, 0x4B, 0x4F, 0x11, 0x8A, 0x14, 0x14, 0x51, 0x6C,
+    0xFE, 0x20, 0x9F, 0x90, 0x82, 0x02, 0x12, 0xA4, 0xA4, 0xA0, 0x48, 0x43, 0x6C, 0xF1, 0x05, 0x4E,
+    0x41, 0xEF, 0x22, 0x0D, 0x34, 0xB8, 0x30, 0x62, 0x13, 0x79, 0x3D, 0x9C, 0x33, 0x5E, 0xB2, 0x89,
+    0x14, 0x9A, 0x08, 0x01, 0x23, 0xC5, 0x77, 0xD6, 0xB9, 0xBE, 0xF7, 0x9C, 0x73, 0x1F, 0xC0, 0x82,
+    0x3B, 0xDA, 0xD9, 0xED, 0x81, 0xC2, 0xF1, 0x4C, 0x11, 0xBB, 0xA7, 0xB4, 0x13, 0xA4, 0x2D, 0xC6,
+    0x15, 0x80, 0x71, 0x89, 0x54, 0xD6, 0x01, 0xA6, 0x06, 0x82, 0x29, 0x90, 0xD2, 0x46, 0x13, 0x60,
+    0x44, 0x1B, 0x37, 0xF0, 0x7E, 0x09, 0xEF, 0x19, 0x3F, 0x33, 0xA5, 0x22, 0xB5, 0xDE, 0x3A, 0xD7,
+    0x20, 0xCD, 0x11, 0xB8, 0x9C, 0xBE, 0x39, 0x42, 0x86, 0xC0, 0xA8, 0x44, 0xD4, 0xCB, 0xB6, 0x48,
+    0x3B, 0x59, 0x26, 0x3B, 0x59, 0x7D, 0x8C, 0x54, 0xD9, 0x5D, 0x87, 0x64, 0x66, 0xC3, 0x99, 0xC5,
+    0x9A, 0x2B, 0x04, 0x47, 0x27, 0x78, 0x03, 0x2C, 0xF6, 0x28, 0x3A, 0x86, 0x74, 0x69, 0xB5, 0x82,
+    0xD1, 0xE7, 0xAC, 0xC5, 0x7A, 0xD0, 0x22, 0xB3, 0x41, 0x6D, 0x72, 0x4C, 0x5F, 0xB8, 0x7C, 0x03,
+    0x91, 0x73, 0x7D, 0x54, 0x23, 0x7D, 0xF7, 0x04, 0xC6, 0x42, 0x49, 0xF8, 0x4E, 0xD0, 0x27, 0xC8,
+    0x88, 0x34, 0x62, 0xC0, 0xEF, 0xCF, 0x72, 0xE3, 0x68, 0xA7, 0x30, 0xAE, 0xCD, 0x08, 0x37, 0x99,
+    0x62, 0x74, 0xE2, 0x93, 0x84, 0x04, 0x8E, 0x25, 0xDD, 0xC8, 0x0C, 0x46, 0x97, 0x03, 0x9C, 0x3B,
+    0xAB, 0x56, 0x21, 0xA6, 0x42, 0xDE, 0xCB, 0xA7, 0x43, 0x54, 0x12, 0xC1, 0x43, 0x44, 0x15, 0xC8,
+    0x49, 0xBF, 0x3A, 0x9A, 0x51, 0x85, 0x7E, 0xAF, 0x17, 0x96, 0x8A, 0xDC, 0x3A, 0x89, 0x41, 0xCF,
+    0x09, 0x65, 0x4B, 0xCB, 0xA8, 0xA1, 0x9A, 0xA6, 0xE4, 0x3D, 0xA3, 0xB6, 0x51, 0x87, 0xC2, 0x9A,
+    0x86, 0x26, 0x2B, 0xD3, 0x86, 0x22, 0x15, 0xB9, 0x11, 0xE8, 0x5B, 0x3E, 0x7B, 0x62, 0x11, 0x53,
+    0xB2, 0xF2, 0x57, 0xFA, 0xE6, 0x3D, 0x36, 0x1D, 0x73, 0x97, 0xA6, 0x95, 0xF6, 0x61, 0x0B, 0x31,
+    0xCC, 0x08, 0xC7, 0xC2, 0x54, 0x7A, 0x15, 0x49, 0x1E, 0x16, 0x21, 0x97, 0x62, 0xAB, 0xE2, 0x40,
+    0x7E, 0xAC, 0xC9, 0x84, 0x51, 0x98, 0xD9, 0x20, 0xAE, 0xC8, 0xC8, 0x58, 0xE2, 0xDD, 0xD0, 0xAF,
+    0x86, 0xA6, 0xB0, 0xD1, 0x69, 0xC1, 0xE2, 0x39, 0x67, 0x59, 0xC5, 0x46, 0xB0, 0xE9, 0x59, 0xB3,
+    0xE0, 0x99, 0x80, 0x76, 0x18, 0xF3, 0x17, 0x79, 0x65, 0x04, 0x1A, 0x4E, 0xD9, 0x13, 0xA6, 0x61,
+    0x8E, 0xAC, 0x4C, 0xBA, 0xB0, 0xC7, 0xB8, 0xC1, 0x65, 0xE7, 0x8E, 0x1D, 0xBA, 0x06, 0xF1, 0x64,
+    0x68, 0x23, 0x80, 0xAA, 0x21, 0x91, 0x77, 0xC6, 0xFF, 0x05, 0x6F, 0xE5, 0x15, 0x7D, 0xDA, 0x47,
+    0x5A, 0x94, 0xC4, 0x87, 0x48, 0xAD, 0x45, 0xB7, 0x8F, 0x7C, 0xDB, 0xCC, 0xAF, 0xED, 0x70, 0x65,
+    0xA4, 0xB8, 0x1B, 0x7A, 0xEE, 0xF2, 0x43, 0x5C, 0x30, 0x8D, 0x8F, 0x4D, 0xC0, 0xBE, 0x69, 0xFB,
+    0x59, 0xBA, 0x99, 0x43, 0x19, 0x33, 0xDC, 0x11, 0x5F, 0xF8, 0x0E, 0x8C, 0xD5, 0xD5, 0x8B, 0xE7,
+    0x23, 0xFC, 0x2D, 0xB5, 0x22, 0xBB, 0x88, 0x57, 0xCB, 0xEA, 0x39, 0xD5, 0x6E, 0x09, 0x57, 0xAB,
+    0x2D, 0xCF, 0x4D, 0xAF, 0xA0, 0xEF, 0x8D, 0x0F, 0x7A, 0x2C, 0xCF, 0x7F, 0xFF, 0xFE, 0x04, 0x45,
+    0x6F, 0x35, 0x5E, 0x9E, 0x26, 0x83, 0xB1, 0xEF, 0x6F, 0xFB, 0x71, 0x06, 0x36, 0xF5, 0x30, 0xFE,
+    0xFB, 0xCE, 0x5F, 0xFD, 0x48, 0x14, 0x9A, 0x5F, 0x7E, 0xC0, 0xF7, 0x0B, 0x4E, 0xF7, 0x20, 0x93,
+    0x7E, 0xC8, 0x24, 0x6D, 0xE4, 0x54, 0xE6, 0xA2, 0x85, 0x65, 0x9B, 0xFB, 0x69, 0xAE, 0x34, 0xC2,
+    0x13, 0xCD, 0x6F, 0x4F, 0x75, 0x1C, 0x93, 0x15, 0xEE, 0xE4, 0x5C, 0x99, 0xCA, 0x01, 0x27, 0x3F,
+    0xE6, 0x74, 0x5E, 0x9C, 0x2D, 0x7F, 0x92, 0x3E, 0x0F, 0x39, 0x5F, 0xE4, 0x2C, 0x1F, 0xB1, 0xD1,
+    0xDE, 0x49, 0x29, 0x56, 0xA2, 0x6E, 0x3A, 0xD4, 0x20, 0x07, 0xA7, 0x7B, 0x15, 0x73, 0x71, 0x0D,
+    0xB4, 0xA4, 0xE3, 0x3F, 0x8B, 0xBC, 0x26, 0x87, 0x7A, 0xA4, 0x07, 0x5E, 0x86, 0x7D, 0x3E, 0xB7,
+    0x83, 0xEA, 0x42, 0xF0, 0xFB, 0xEE, 0xD8, 0xEF, 0x1C, 0xAB, 0x45, 0x43, 0x89, 0xDD, 0x56, 0xC0,
+    0xDE, 0xD4, 0xA7, 0x71, 0x3D, 0xA7, 0xED, 0x15, 0x70, 0x5B, 0x02, 0xE3, 0x57, 0xCF, 0x48, 0x03,
+    0xCC, 0x4D, 0xA4, 0xFB, 0x5D, 0x27, 0xC7, 0x58, 0x50, 0x30, 0x6E, 0xBD, 0x8B, 0xBD, 0xC6, 0xAA,
+    0x34, 0xA1, 0x5F, 0x9F, 0xDA, 0xA2, 0xB9, 0x64, 0xA8, 0x63, 0x3E, 0x8E, 0x95, 0x66, 0xEB, 0x2C,
+    0xFB, 0xFA, 0x30, 0x03, 0xE1, 0x37, 0x0E, 0xF5, 0xEB, 0x9A, 0xE5, 0xBB, 0x37, 0x97, 0xC5, 0x6D,
+    0x33, 0x4D, 0xA5, 0x8E, 0xF7, 0x8B, 0x47, 0x7F, 0x22, 0xC6, 0x05, 0x37, 0xF0, 0xE6, 0x02, 0xE5,
+    0x32, 0x8D, 0xBF, 0x16, 0x96, 0xD1, 0x29, 0xEC, 0x94, 0x5C, 0xEA, 0x7F, 0x50, 0x4E, 0x05, 0xF8,
+    0x22, 0x7F, 0xAF, 0xF7, 0xB2, 0xDC, 0x71, 0xC3, 0x53, 0x10, 0xCF, 0x60, 0xE3, 0xAC, 0x0A, 0x62,
+    0x54, 0x38, 0x9B, 0xB0, 0x00, 0x2B, 0x03, 0x21, 0xA1, 0x8A, 0x9D, 0xD0, 0x96, 0x03, 0x9F, 0x4D,
+    0x6C, 0xEE, 0xB6, 0x8C, 0x5F, 0x8A, 0xCE, 0x1A, 0xB1, 0x84, 0x0C, 0x77, 0x9D, 0xCE, 0x3B, 0xB3,
+    0xE6, 0x7E, 0xC9, 0x6C, 0x16, 0xC1, 0xE3, 0x79, 0x01, 0x1F, 0xF9, 0x82, 0x36, 0x12, 0x3E, 0xF6,
+    0xA4, 0xC6, 0xBE, 0xA7, 0xF3, 0xFF, 0xB4, 0xDD, 0x9F, 0x53, 0x95, 0xE6, 0x01, 0xF0, 0xA3, 0x04,
+    0x17, 0xC2, 0x65, 0xB3, 0x79, 0xC5, 0x76, 0xFF, 0x53, 0xE7, 0x27, 0xCD, 0x55, 0x3D, 0x6F, 0xD4,
+    0x40, 0x14, 0x9C, 0xB5, 0x49, 0x4E, 0xC2, 0x48, 0xAE, 0x52, 0x11, 0x64, 0x0A, 0x0A, 0x0A, 0x22,
+    0xB7, 0x08, 0x41, 0xBC, 0xD0, 0xD2, 0xA4, 0x88, 0xD2, 0xF0, 0x13, 0x68, 0xA9, 0x10, 0xE1, 0x8C,
+    0x28, 0x69, 0xD2, 0xF1, 0x17, 0x90, 0x10, 0xBA, 0xFC, 0x80, 0x83, 0x33, 0xFF, 0xC0, 0x52, 0x44,
+    0xEF, 0x82, 0x2A, 0x95, 0x8B, 0x43, 0x58, 0xC1, 0x77, 0x8F, 0x99, 0x75, 0x20, 0x09, 0x1F, 0x42,
+    0x08, 0x81, 0x58, 0xF9, 0x9E, 0x73, 0xBB, 0xB7, 0xBB, 0x33, 0xF3, 0xDE, 0x9B, 0x64, 0x66, 0xD6,
+    0xE7, 0x0A, 0xC5, 0x72, 0x39, 0xE9, 0x80, 0x1E, 0x1C, 0x7C, 0x23, 0x9A, 0x33, 0xC4, 0x21, 0xB4,
+    0x0C, 0x23, 0x85, 0xB4, 0x51, 0xA8, 0x19, 0xB2, 0x8A, 0x21, 0x57, 0x28, 0x4A, 0x86, 0xB1, 0x67,
+    0x98, 0x69, 0xAB, 0xF1, 0xE3, 0x96, 0xDA, 0xBF, 0xD0, 0xD6, 0xFE, 0x4B, 0xC0, 0x65, 0x85, 0x87,
+    0x0A, 0x4E, 0x3B, 0xEE, 0xE9, 0x0F, 0xDD, 0xA3, 0x71, 0x0D, 0x71, 0x83, 0xCC, 0x63, 0x8A, 0xFB,
+    0x47, 0xCF, 0xCD, 0xFC, 0x54, 0x77, 0x86, 0xEF, 0x7A, 0x97, 0x78, 0xAD, 0x77, 0xFA, 0x0E, 0xB3,
+    0x45, 0x6C, 0xF3, 0xC4, 0x6A, 0xF7, 0x1E, 0xB8, 0x02, 0x57, 0xBB, 0x05, 0x1C, 0x6F, 0x4E, 0x70,
+    0x89, 0xB7, 0x54, 0x42, 0xF8, 0x49, 0x67, 0xBF, 0xD1, 0x99, 0xD7, 0xF1, 0xED, 0xC8, 0xFE, 0x19,
+    0x57, 0x38, 0x6E, 0xDE, 0x10, 0x26, 0xEC, 0x3F, 0xC2, 0x66, 0xEA, 0x47, 0xF5, 0x16, 0xC9, 0xB8,
+    0xC9, 0xA1, 0x1F, 0xDB, 0x1C, 0xF9, 0x70, 0xCF, 0x2E, 0x91, 0x57, 0x01, 0x05, 0x29, 0x0A, 0x42,
+    0xC1, 0xF9, 0x0F, 0x9E, 0x2C, 0x91, 0x5A, 0xAD, 0xD7, 0x2F, 0x21, 0xB7, 0x5F, 0x21, 0xF3, 0xC2,
+    0xD5, 0xC9, 0x51, 0xC9, 0x9D, 0x56, 0x69, 0x5B, 0xF9, 0xBB, 0x90, 0x43, 0x1A, 0xB0, 0x09, 0xE9,
+    0x4E, 0x58, 0xF7, 0x8F, 0xF6, 0x04, 0x75, 0x2A, 0x54, 0xE7, 0x27, 0x87, 0x77, 0xCD, 0x0E, 0xCC,
+    0x5A, 0x5D, 0xFD, 0x3A, 0x00, 0x65, 0x36, 0x98, 0x08, 0xA6, 0x23, 0xE0, 0x3C, 0x1E, 0x71, 0xB7,
+    0xCE, 0xB8, 0xF1, 0x60, 0x9F, 0xB1, 0xD1, 0x7D, 0xB1, 0xDF, 0xC2, 0xF7, 0x63, 0x65, 0x0B, 0x2B,
+    0xDB, 0x18, 0x97, 0x28, 0x6A, 0xC1, 0x30, 0xA4, 0x2D, 0x46, 0x9D, 0xA0, 0xE6, 0x4A, 0x29, 0x91,
+    0x26, 0xAD, 0x60, 0x15, 0x95, 0x12, 0xC0, 0x89, 0xB1, 0x52, 0x12, 0xF5, 0x62, 0xC4, 0xB4, 0x30,
+    0xBD, 0x85, 0x67, 0xB6, 0x5C, 0x8F, 0xB4, 0x42, 0xD2, 0x70, 0x99, 0x13, 0x5C, 0xE6, 0x93, 0x52,
+    0xDD, 0x06, 0xC5, 0x72, 0x42, 0xA2, 0x94, 0xAD, 0x43, 0x6C, 0x12, 0x64, 0x64, 0xC6, 0x63, 0x56,
+    0x83, 0x2C, 0xA7, 0x46, 0x5E, 0xD5, 0xEE, 0xE0, 0x19, 0xD2, 0xD1, 0x1C, 0x57, 0x55, 0x48, 0x27,
+    0x44, 0x2A, 0x74, 0x19, 0xE2, 0x7A, 0x8A, 0x9C, 0x95, 0xD9, 0xA7, 0x3E, 0x6E, 0x1E, 0x21, 0xBB,
+    0xDD, 0x62, 0x9A, 0x54, 0x71, 0xBB, 0x89, 0xBC, 0xEC, 0xA3, 0x25, 0x8F, 0x9E, 0x4B, 0xEE, 0xC2,
+    0x0C, 0xE3, 0x45, 0x87, 0xB5, 0x53, 0x07, 0x24, 0x26, 0xA5, 0xCD, 0x5E, 0xE0, 0x27, 0x83, 0x7C,
+    0xE3, 0x05, 0xF9, 0x8A, 0x3B, 0x7F, 0x5A, 0x54, 0x71, 0x07, 0x72, 0xCF, 0x6A, 0x71, 0x9F, 0x85,
+    0x09, 0xE6, 0x65, 0x29, 0xBE, 0xE4, 0x5E, 0x08, 0xAB, 0x0B, 0x13, 0xE4, 0x4B, 0xEE, 0x85, 0x57,
+    0x59, 0xF6, 0xAA, 0x75, 0x2E, 0x73, 0x82, 0xD2, 0xF0, 0x31, 0x1F, 0x2D, 0x49, 0xF9, 0x90, 0x99,
+    0x22, 0x32, 0xB2, 0x25, 0x36, 0xFE, 0x68, 0x6C, 0xAC, 0x27, 0xC6, 0xEE, 0x14, 0x80, 0x73, 0xC8,
+    0xB9, 0x34, 0x3B, 0x8B, 0x50, 0xBC, 0x47, 0x15, 0xE6, 0x49, 0x15, 0xB5, 0x69, 0x19, 0xB7, 0x22,
+    0x9E, 0x61, 0x54, 0x67, 0x2C, 0x89, 0x9C, 0x6A, 0x8B, 0x79, 0x81, 0x59, 0xC9, 0x63, 0xBD, 0x68,
+    0xEB, 0x93, 0xD9, 0x63, 0xB8, 0x90, 0xE6, 0xB8, 0x8C, 0xA8, 0x6F, 0xAA, 0x6E, 0xC4, 0xE6, 0x8E,
+    0xFA, 0x67, 0xAC, 0x52, 0xC3, 0x78, 0xEF, 0x67, 0x2A, 0x60, 0xCD, 0x63, 0xC5, 0xAB, 0x20, 0xCD,
+    0x27, 0xF3, 0xE3, 0x9C, 0x67, 0x2D, 0x69, 0xB2, 0x66, 0x99, 0x95, 0xE3, 0x9C, 0x0F, 0x12, 0x95,
+    0x43, 0xCE, 0xC9, 0x9B, 0x12, 0x29, 0xE7, 0x65, 0x44, 0x42, 0x0B, 0xD5, 0xC8, 0xB1, 0x44, 0xA5,
+    0x24, 0x5A, 0x68, 0x99, 0x4F, 0xC1, 0x16, 0x2A, 0x61, 0x47, 0xB3, 0x3E, 0x14, 0x41, 0x13, 0x14,
+    0x09, 0x2D, 0xC5, 0xD6, 0xB9, 0x68, 0x4B, 0x9C, 0x94, 0xFD, 0x3A, 0x6E, 0xD2, 0x2F, 0xF2, 0x1D,
+    0xA9, 0x56, 0x0D, 0xAD, 0x71, 0x76, 0xFC, 0x99, 0x2E, 0x88, 0xDA, 0xE0, 0x48, 0xB2, 0x40, 0xF7,
+    0x56, 0x25, 0x18, 0xBF, 0x0A, 0x45, 0x52, 0xFF, 0xD7, 0xBA, 0xC8, 0x09, 0xA2, 0xA7, 0xC0, 0x85,
+    0x0B, 0xC0, 0x8D, 0x26, 0xF8, 0xD5, 0xD9, 0x91, 0x42, 0x6D, 0x91, 0xDE, 0x61, 0x5B, 0x48, 0x94,
+    0x5B, 0x48, 0x9F, 0xB4, 0xD8, 0x1D, 0x51, 0x23, 0x69, 0xD2, 0xE1, 0x4D, 0xDC, 0x26, 0x1D, 0x4F,
+    0xAF, 0x25, 0x07, 0x0B, 0xD1, 0xD9, 0xC7, 0x06, 0xDB, 0xC1, 0x1F, 0x49, 0x2F, 0xB8, 0x1F, 0xCF,
+    0xCC, 0xBD, 0x0B, 0xAE, 0xC2, 0xC2, 0x86, 0x67, 0x59, 0xFE, 0xC8, 0x30, 0xBC, 0x94, 0xCC, 0x9A,
+    0xD0, 0xDE, 0xA1, 0x65, 0x8A, 0xC0, 0x9E, 0x8E, 0xC1, 0x86, 0xA1, 0xBB, 0x51, 0x8C, 0xD0, 0x33,
+    0x83, 0x1E, 0x41, 0x26, 0x49, 0xC2, 0xC9, 0xA1, 0x69, 0x06, 0x41, 0x06, 0x9D, 0xE8, 0x97, 0xFC,
+    0x3A, 0x74, 0xCD, 0xA0, 0xC8, 0x60, 0x1A, 0xA9, 0xBD, 0x64, 0xF2, 0x87, 0xB6, 0x19, 0x24, 0x19,
+    0x5C, 0xC3, 0xCD, 0xAC, 0x39, 0xC9, 0x0B, 0xB0, 0xE5, 0xE6, 0x48, 0xCB, 0xAC, 0x74, 0x1D, 0x8F,
+    0xC9, 0xAA, 0x73, 0x42, 0xFD, 0x7D, 0xB5, 0x40, 0xF6, 0x41, 0xFB, 0xCC, 0xF5, 0xAF, 0x8D, 0xBE,
+    0xC4, 0x82, 0x01, 0x2D, 0xC4, 0x3B, 0x8A, 0x05, 0x99, 0x08, 0x54, 0x33, 0xE8, 0x43, 0xBF, 0x52,
+    0xF9, 0xE0, 0xDB, 0xD2, 0x29, 0x58, 0xC9, 0x19, 0x2F, 0xF9, 0x9B, 0xE3, 0x33, 0xCD, 0x55, 0x31,
+    0x8F, 0xDD, 0x44, 0x10, 0xFE, 0x6C, 0x2B, 0xB7, 0x28, 0x56, 0x6E, 0x2B, 0x1A, 0x44, 0xE2, 0x86,
+    0x22, 0x45, 0xD0, 0x36, 0x14, 0x14, 0xC7, 0x5B, 0x27, 0xFC, 0x81, 0x34, 0x27, 0xCA, 0x34, 0x14,
+    0x40, 0x75, 0x05, 0x25, 0x77, 0x76, 0xD2, 0x50, 0xF2, 0x17, 0x22, 0x41, 0xF5, 0x9A, 0x44, 0x28,
+    0x05, 0xC5, 0xDD, 0x79, 0x0F, 0xCA, 0x34, 0x46, 0xD4, 0x48, 0x16, 0x12, 0x35, 0x96, 0x70, 0xE1,
+    0x10, 0xFB, 0x2D, 0xDF, 0x8C, 0xAD, 0x3B, 0x50, 0x22, 0x2A, 0x90, 0xD8, 0x7B, 0xEF, 0x9B, 0x77,
+    0xBB, 0xDE, 0xD9, 0x99, 0x6F, 0x66, 0x3F, 0xE3, 0x5A, 0x89, 0xE4, 0x3E, 0xAA, 0x1A, 0xBE, 0x4D,
+    0x67, 0x20, 0xC2, 0xF6, 0xC8, 0x26, 0xF8, 0x1A, 0x45, 0x9B, 0x70, 0xA2, 0x41, 0xBE, 0x4C, 0x04,
+    0xD8, 0x0E, 0x3B, 0xA0, 0x82, 0xE9, 0x91, 0x4E, 0x28, 0x74, 0xE2, 0x1C, 0xF0, 0x65, 0x36, 0x20,
+    0x99, 0x60, 0x03, 0xF2, 0x8E, 0xCB, 0x9C, 0xE0, 0x32, 0x3F, 0x76, 0x80, 0xEB, 0xE0, 0x77, 0x4F,
+    0x22, 0xFD, 0xC6, 0x38, 0x22, 0x23, 0x06, 0x98, 0x18, 0xE9, 0x77, 0x2F, 0xC6, 0x1A, 0x1C, 0x9D,
+    0xC0, 0xBE, 0x00, 0x8E, 0x14, 0x77, 0x8A, 0x1F, 0xF3, 0x9B, 0x05, 0x8C, 0x05, 0xB2, 0xF6, 0x14,
+    0x2E, 0xEB, 0x30, 0xD9, 0x32, 0xEB, 0xBE, 0x40, 0x71, 0xB7, 0xC7, 0x69, 0x1E, 0xB2, 0x7E, 0x03,
+    0x57, 0x4F, 0xE9, 0x8E, 0x3E, 0x07, 0x4B, 0xB7, 0x3E, 0x46, 0x54, 0xF3, 0x88, 0x37, 0xE9, 0x2B,
+    0x69, 0x81, 0x1B, 0x74, 0xF0, 0x94, 0x3F, 0xE7, 0xD5, 0x19, 0xEE, 0xA8, 0x5F, 0xF8, 0xC5, 0xBC,
+    0x0C, 0x82, 0x69, 0xFB, 0x4C, 0x8C, 0x29, 0x97, 0x00, 0x64, 0x58, 0x5D, 0x38, 0x2F, 0xD4, 0x4C,
+    0x6A, 0xB2, 0x51, 0x8D, 0xE9, 0xD5, 0xD8, 0x4E, 0x4D, 0x11, 0x5C, 0x48, 0x47, 0xE6, 0xEA, 0x82,
+    0x19, 0x99, 0xB5, 0x0B, 0x76, 0xC2, 0x4C, 0xE3, 0x27, 0xA6, 0xEE, 0xEA, 0x38, 0x93, 0x15, 0xFF,
+    0x68, 0xDE, 0x91, 0x3E, 0xFF, 0xE5, 0x14, 0x6D, 0x0B, 0xFF, 0x55, 0x1F, 0x5D, 0x80, 0x6F, 0xDA,
+    0xA6, 0x2A, 0xE1, 0x63, 0x68, 0x48, 0x8C, 0x8F, 0x68, 0x18, 0xA3, 0x9F, 0x51, 0x4D, 0x34, 0x74,
+    0x35, 0xD0, 0xF4, 0xF2, 0x41, 0xC5, 0x3D, 0xAD, 0xC4, 0xF1, 0x9E, 0xC0, 0x19, 0xBF, 0x89, 0x90,
+    0x96, 0x5D, 0x74, 0x42, 0xD9, 0x1D, 0x5C, 0x0D, 0xC9, 0x6A, 0x22, 0xA4, 0xC3, 0x86, 0xEB, 0xE4,
+    0x06, 0x79, 0xBB, 0x49, 0x7A, 0x1B, 0x36, 0x66, 0x70, 0xE5, 0x49, 0xC1, 0xB5, 0x93, 0x6A, 0x3E,
+    0x43, 0x25, 0x65, 0x20, 0xF4, 0xA8, 0x5E, 0x44, 0x16, 0xAB, 0x67, 0x3D, 0xAA, 0xD0, 0xD4, 0x4C,
+    0xA0, 0x12, 0x3F, 0xBD, 0x66, 0x46, 0x17, 0xBF, 0xC9, 0x3F, 0xEF, 0x02, 0x6F, 0xE3, 0x9D, 0xCB,
+    0x43, 0x32, 0xAE, 0x9E, 0xF9, 0x12, 0xC5, 0xA3, 0x71, 0x21, 0x63, 0x62, 0xD5, 0x7D, 0x69, 0x5B,
+    0xF6, 0x41, 0x64, 0xD2, 0x79, 0x4F, 0x1F, 0xD5, 0x83, 0x96, 0x75, 0x1E, 0x35, 0x31, 0xFE, 0xA0,
+    0x2F, 0xC7, 0x84, 0x12, 0xA9, 0xAA, 0x13, 0xC7, 0x4C, 0x12, 0x3C, 0x4F, 0x9A, 0x03, 0x69, 0x84,
+    0xE6, 0x0A, 0xB3, 0x14, 0x3D, 0x93, 0x8E, 0x70, 0xA5, 0x94, 0x47, 0x9E, 0x30, 0x7C, 0xFE, 0x69,
+    0x12, 0xF0, 0xF7, 0xF1, 0x01, 0xD2, 0x1E, 0x23, 0x6C, 0x49, 0x73, 0x0A, 0xD3, 0x9A, 0x16, 0xB6,
+    0x66, 0xEA, 0x3E, 0xA1, 0xC7, 0x33, 0x96, 0x2F, 0x19, 0xC9, 0x54, 0xF6, 0x3B, 0xDD, 0xDA, 0x48,
+    0x5F, 0x4E, 0x4E, 0x24, 0x93, 0xE4, 0x4E, 0x8A, 0x38, 0xC8, 0x91, 0x97, 0x81, 0x70, 0x3A, 0xF2,
+    0x6C, 0x13, 0xDB, 0x25, 0xCE, 0xBF, 0x8E, 0xE3, 0x74, 0x80, 0x6D, 0x3D, 0x5B, 0x5B, 0x4A, 0x18,
+    0x22, 0x5E, 0x19, 0xFF, 0x39, 0x21, 0xC0, 0xCD, 0xA5, 0x29, 0x17, 0x14, 0x66, 0x90, 0xEB, 0xB5,
+    0x31, 0x01, 0xFF, 0x30, 0xBC, 0x5E, 0x34, 0x5E, 0x0B, 0xD6, 0x38, 0x8D, 0x52, 0x6E, 0x7C, 0xB6,
+    0x7D, 0x32, 0xE9, 0x76, 0x45, 0xAB, 0x58, 0x28, 0xBA, 0x51, 0xB7, 0x28, 0x56, 0xC3, 0x15, 0x36,
+    0xD2, 0x0C, 0x90, 0xBD, 0xA4, 0x4E, 0xAE, 0x69, 0xBA, 0xA2, 0xB4, 0x64, 0xB6, 0x62, 0x94, 0x6B,
+    0x1C, 0xF5, 0x20, 0xB6, 0x55, 0x9C, 0xF4, 0xE8, 0xDD, 0x65, 0xE8, 0xFB, 0x6B, 0xF0, 0x12, 0xF4,
+    0xEB, 0x42, 0xA6, 0x83, 0x90, 0x48, 0x7C, 0x87, 0x1F, 0x8D, 0x72, 0xD1, 0x96, 0x02, 0x51, 0x60,
+    0x44, 0x75, 0x44, 0x5F, 0xA8, 0x42, 0x8C, 0xB0, 0x5D, 0x6A, 0x26, 0x77, 0x9C, 0x49, 0xB5, 0xB9,
+    0x74, 0xF1, 0xD5, 0xD0, 0x2C, 0x96, 0xFE, 0xD5, 0xC7, 0xB8, 0xA9, 0x7B, 0x3D, 0x2F, 0x12, 0xE8,
+    0xC2, 0x4E, 0x8D, 0x5C, 0x39, 0x4A, 0xB6, 0xDB, 0x25, 0x4F, 0xA7, 0xE8, 0x15, 0x2B, 0xC5, 0x46,
+    0x9D, 0x68, 0xCE, 0x89, 0x66, 0xBB, 0x60, 0x1A, 0x55, 0x13, 0x14, 0x8D, 0x6A, 0x58, 0xBE, 0xA2,
+    0x94, 0xC7, 0xAE, 0x28, 0x24, 0x2C, 0xEC, 0x24, 0x51, 0x0B, 0x10, 0xE3, 0x1A, 0xB4, 0x34, 0x4D,
+    0x32, 0xAD, 0x42, 0x57, 0xD5, 0xAF, 0x06, 0xC9, 0xCD, 0xA2, 0x91, 0x21, 0x39, 0x7C, 0xD0, 0x5D,
+    0x71, 0x20, 0xB7, 0x52, 0xFA, 0x85, 0xC2, 0x0C, 0xAA, 0x07, 0x9A, 0x52, 0xC4, 0x5A, 0x52, 0x52,
+    0xCE, 0x4B, 0x17, 0x97, 0x48, 0xF9, 0x27, 0xAA, 0x6A, 0x34, 0x8C, 0x42, 0x7E, 0x27, 0x4B, 0x39,
+    0x36, 0x8A, 0x7B, 0xFF, 0xDF, 0x8E, 0xD9, 0xC3, 0x75, 0x6A, 0xCE, 0x2D, 0x1E, 0x75, 0xBC, 0x32,
+    0x74, 0x80, 0x7F, 0xB9, 0x63, 0x5C, 0x2D, 0x19, 0x64, 0x5D, 0x49, 0x01, 0x01, 0xC9, 0x49, 0x3B,
+    0xD1, 0x13, 0xED, 0xCC, 0x53, 0x6E, 0x26, 0xB5, 0xF4, 0xE5, 0x96, 0x1A, 0x91, 0x2F, 0x4A, 0x8B,
+    0xCE, 0x8B, 0xA6, 0xA8, 0x30, 0x51, 0xD2, 0xF9, 0xFC, 0x31, 0xA5, 0xF8, 0x53, 0x74, 0x07, 0xF9,
+    0xDD, 0xEE, 0x40, 0x5E, 0x60, 0x79, 0x8B, 0x93, 0x2E, 0xAB, 0xFB, 0xDB, 0x38, 0xB2, 0xF5, 0xD7,
+    0x3F, 0xDF, 0xF8, 0xFC, 0xDB, 0xE7, 0x8C, 0xEB, 0x9A, 0xB0, 0x40, 0x2A, 0xBF, 0x8F, 0xBB, 0xC7,
+    0x6B, 0xEC, 0x69, 0x13, 0xE3, 0x8F, 0x7F, 0x6C, 0xB7, 0xF7, 0xDF, 0xC7, 0xED, 0x3E, 0xF9, 0xE9,
+    0xD7, 0x13, 0x13, 0x3B, 0xF3, 0x82, 0xC7, 0xFD, 0x32, 0xCE, 0x8D, 0x16, 0x2C, 0x6C, 0x5C, 0x7D,
+    0xEE, 0xEB, 0xB9, 0xBA, 0x37, 0xBB, 0x87, 0xFB, 0x69, 0xDB, 0xBF, 0x01, 0xD3, 0x1D, 0xFD, 0xF0,
+    0xE1, 0xFE, 0x77, 0xB6, 0xA6, 0xBE, 0xD9, 0x87, 0x14, 0xBE, 0x0B, 0xBE, 0x59, 0x2F, 0xBE, 0xC1,
+    0xF5, 0xF2, 0x08, 0x8F, 0x9F, 0xDD, 0xC2, 0xCB, 0x96, 0x17, 0x20, 0x0D, 0x8C, 0x77, 0xD1, 0xC5,
+    0x60, 0xF8, 0xCE, 0xC5, 0x5B, 0x35, 0x3E, 0x39, 0x2C, 0x7D, 0x70, 0xD4, 0x22, 0xD3, 0x67, 0xF2,
+    0x6A, 0x02, 0x5F, 0x96, 0x93, 0x19, 0xF2, 0x9E, 0xA2, 0x16, 0xAA, 0x72, 0x09, 0xE9, 0x4F, 0xAD,
+    0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC7, 0xBE, 0x25, 0x5E, 0x27, 0x93, 0x22, 0x46,
+    0x11, 0x58, 0x59, 0x17, 0x46, 0x8A, 0x04, 0xC9, 0x5D, 0xE1, 0xC2, 0xC5, 0xDD, 0xED, 0x2A, 0x91,
+    0xA8, 0x2D, 0x84, 0x2B, 0x0A, 0xB7, 0x48, 0x08, 0xC5, 0x85, 0x0B, 0x17, 0x4E, 0x6E, 0x24, 0x0B,
+    0x1A, 0x1A, 0x37, 0xD0, 0x21, 0x2C, 0x91, 0x86, 0xA3, 0xB0, 0x85, 0x5C, 0x9C, 0x22, 0xCB, 0x37,
+    0x81, 0x22, 0x45, 0x9A, 0x21, 0xD4, 0x91, 0x56, 0x10, 0x7E, 0x3A, 0xB6, 0xD8, 0xE2, 0x6C, 0x76,
+    0x6F, 0x78, 0x6F, 0xD6, 0x3E, 0xC7, 0x04, 0x51, 0x31, 0x92, 0xC7, 0x73, 0xEF, 0xF7, 0x9B, 0xEF,
+    0xBD, 0x37, 0x3B, 0xD4, 0x89, 0x89, 0xAD, 0xCA, 0xC2, 0x5C, 0x96, 0xA2, 0x82, 0x9D, 0x4F, 0x1E,
+    0x6F, 0xCA, 0x14, 0xBB, 0xF3, 0x72, 0x54, 0xBC, 0x03, 0x34, 0xFB, 0x2B, 0xCE, 0x59, 0x28, 0x60,
+    0x0B, 0x41, 0x86, 0x28, 0x15, 0x7A, 0x7F, 0x69, 0x73, 0x19, 0x98, 0x59, 0x6C, 0x2D, 0x63, 0x0A,
+    0xF6, 0xCB, 0x68, 0xD4, 0x30, 0x0F, 0xC3, 0xF2, 0x8A, 0xB6, 0x53, 0x08, 0xD0, 0x6A, 0xEA, 0x9D,
+    0xD7, 0x40, 0xEB, 0x4D, 0x37, 0x4E, 0xDC, 0x37, 0x74, 0x50, 0x4F, 0x7F, 0x39, 0xAE, 0x58, 0x02,
+    0x51, 0x44, 0xB6, 0x92, 0x79, 0x2F, 0x28, 0x13, 0xE3, 0x10, 0x66, 0xEB, 0x3F, 0xDC, 0xBD, 0x32,
+    0x50, 0x1A, 0xAB, 0xB2, 0x92, 0x65, 0x54, 0xA8, 0x3C, 0xB6, 0x89, 0x19, 0xA6, 0x01, 0x16, 0xC4,
+    0x0B, 0x2C, 0x62, 0x67, 0x2D, 0xCA, 0xC8, 0x2B, 0x4C, 0x0F, 0x42, 0x2C, 0x63, 0x88, 0xEB, 0x08,
+    0xF4, 0x56, 0xA4, 0x8B, 0x58, 0x66, 0x1D, 0xC4, 0xEE, 0xB3, 0x2F, 0x7E, 0xD2, 0xFB, 0xF6, 0xE6,
+    0x3A, 0x76, 0xF6, 0x6F, 0xE1, 0x2F, 0x23, 0x4A, 0x48, 0x03, 0xA9, 0x11, 0x6B, 0xFA, 0x15, 0xDD,
+    0x31, 0xEB, 0xC2, 0x2A, 0xFD, 0xF5, 0xF3, 0xCB, 0x1B, 0xDF, 0x3D, 0x95, 0x23, 0x4C, 0x43, 0xAC,
+    0x6E, 0xBB, 0x92, 0xE2, 0x4D, 0xF7, 0xF3, 0xA1, 0x33, 0x0C, 0xEC, 0x65, 0xED, 0x1B, 0xFD, 0xBE,
+    0x72, 0xEE, 0x89, 0x73, 0xF9, 0xFA, 0xEC, 0xA5, 0x79, 0x2C, 0x87, 0x81, 0xD9, 0xB8, 0xF1, 0x81,
+    0x76, 0xA5, 0x72, 0x9F, 0xE2, 0x59, 0xDA, 0x32, 0xF3, 0xAD, 0x99, 0xD8, 0xA5, 0x40, 0xF4, 0x89,
+    0xBC, 0xFC, 0xDE, 0xBB, 0x8B, 0xDF, 0xCF, 0x2E, 0x6C, 0x63, 0x66, 0x41, 0x61, 0x49, 0xEE, 0xB7,
+    0x2E, 0x26, 0xBA, 0x16, 0xE9, 0xF5, 0x83, 0xAB, 0x94, 0x80, 0xE8, 0xDB, 0x04, 0x72, 0x48, 0x8B,
+    0x48, 0x7B, 0x06, 0xA0, 0x4C, 0xB7, 0xA9, 0x8F, 0x12, 0x5D, 0xF5, 0xEE, 0x54, 0x73, 0xAB, 0xCA,
+    0x3D, 0x49, 0x7F, 0x36, 0x4B, 0x2B, 0x53, 0x5E, 0xF7, 0xB6, 0xAB, 0x42, 0x77, 0xB2, 0x83, 0xC9,
+    0x9A, 0xD9, 0x73, 0x92, 0x00, 0x79, 0xBF, 0x74, 0xD0, 0x96, 0x3F, 0xE6, 0xB1, 0xD2, 0x83, 0x8E,
+    0x7C, 0x96, 0xC7, 0x8D, 0xF4, 0x43, 0x92, 0x26, 0x2E, 0x19, 0xA3, 0x43, 0x95, 0x39, 0x64, 0x1B,
+    0x8A, 0x72, 0x0D, 0x68, 0x01, 0x06, 0x42, 0xAB, 0xED, 0xDD, 0xCE, 0x73, 0xBB, 0xF1, 0xC8, 0xEC,
+    0x27, 0x7A, 0xE5, 0x73, 0x08, 0xA2, 0x06, 0xB8, 0x04, 0x22, 0xB1, 0x5E, 0x84, 0x89, 0xB9, 0xB5,
+    0x35, 0x28, 0x5F, 0x2F, 0x8D, 0x52, 0x8C, 0xD7, 0x6C, 0x50, 0x84, 0x45, 0x50, 0x44, 0x99, 0xB2,
+    0x18, 0x3A, 0x4D, 0xE5, 0x99, 0x7E, 0x9F, 0xA8, 0x62, 0xBB, 0x66, 0xCA, 0xFB, 0xDC, 0x39, 0xC0,
+    0xA8, 0xC2, 0xB2, 0xCC, 0x0F, 0x54, 0x7A, 0x28, 0x7F, 0xCF, 0x1A, 0x69, 0x34, 0x3A, 0x57, 0x35,
+    0x6D, 0x90, 0xC6, 0x5F, 0xA5, 0x5B, 0xD2, 0x76, 0xE2, 0xF4, 0x10, 0xD4, 0x42, 0x10, 0x2B, 0xAC,
+    0x78, 0x0B, 0x38, 0x00, 0xAE, 0x9E, 0x9A, 0x11, 0xE6, 0x8F, 0x69, 0xBF, 0x7E, 0x6B, 0xB6, 0xFE,
+    0xCD, 0xFF, 0xC4, 0x63, 0xC2, 0x13, 0x9A, 0x2B, 0x29, 0xEE, 0xA5, 0xF8, 0xC8, 0x3D, 0x24, 0xD1,
+    0x3D, 0xF7, 0x02, 0xD4, 0x13, 0x8D, 0x42, 0x10, 0x90, 0xC0, 0x30, 0xDE, 0xF9, 0xF3, 0x5C, 0xF0,
+    0xB8, 0x70, 0x9F, 0xC8, 0xA2, 0x95, 0xF7, 0x69, 0xED, 0x65, 0xFE, 0x92, 0xE9, 0xC4, 0xE4, 0x06,
+    0x6F, 0x4C, 0x93, 0x64, 0x3E, 0x23, 0x83, 0x0B, 0x4B, 0x38, 0x6A, 0x8D, 0xA6, 0x73, 0x46, 0xB2,
+    0x5F, 0x87, 0x99, 0x31, 0xA7, 0xF6, 0x8A, 0x63, 0xB0, 0x3A, 0x76, 0x4E, 0x07, 0xAF, 0xAA, 0xB5,
+    0x57, 0x57, 0xAC, 0xB6, 0x01, 0xDB, 0x25, 0xCE, 0x77, 0xD7, 0x4D, 0xB1, 0x83, 0x50, 0x93, 0xED,
+    0x81, 0xFC, 0x47, 0x32, 0xB2, 0x34, 0xDE, 0xB2, 0x7B, 0x56, 0x87, 0xAD, 0x33, 0x48, 0x05, 0x47,
+    0x24, 0x35, 0xE1, 0x19, 0xE1, 0xF6, 0x2B, 0xEA, 0x51, 0xAD, 0xB6, 0x82, 0x13, 0x7A, 0xB8, 0xCE,
+    0xB7, 0x34, 0x31, 0xB0, 0x47, 0x27, 0xCA, 0xDC, 0xD7, 0xE7, 0xA8, 0x38, 0x58, 0x4C, 0x7F, 0x01,
+    0xDF, 0x98, 0x73, 0x85, 0xBF, 0x3D, 0x02, 0xD5, 0xB4, 0x84, 0x3A, 0x0E, 0x33, 0xD0, 0x85, 0x11,
+    0xA7, 0xC8, 0x49, 0xAD, 0x48, 0x2D, 0x72, 0xCA, 0x75, 0x9B, 0xBC, 0x43, 0xAB, 0x4C, 0xA3, 0x44,
+    0x19, 0x38, 0x1A, 0xA5, 0xC4, 0x33, 0x28, 0x38, 0xF9, 0x26, 0xC7, 0x3D, 0x83, 0x74, 0x88, 0xFF,
+    0x5A, 0x54, 0x05, 0xC6, 0x99, 0xFB, 0xCC, 0x09, 0xFB, 0x30, 0x6F, 0x0F, 0xF8, 0x1A, 0xEC, 0xCC,
+    0x90, 0x63, 0x0A, 0x19, 0xF0, 0x7D, 0x38, 0x83, 0xAF, 0x49, 0x8F, 0xD5, 0x7C, 0x18, 0xB3, 0x9A,
+    0xEC, 0x02, 0xB6, 0x4B, 0x6A, 0xF2, 0xA2, 0x71, 0xCA, 0x61, 0x33, 0x84, 0x85, 0x18, 0xF1, 0x88,
+    0xDF, 0xE7, 0x1B, 0x75, 0x39, 0xD4, 0x9C, 0xE0, 0x8B, 0x06, 0x27, 0xFD, 0x5D, 0xF8, 0x69, 0x09,
+    0xD9, 0xCC, 0xD3, 0xA5, 0xCE, 0xB7, 0x1C, 0xCD, 0x5C, 0xB9, 0x3F, 0x5D, 0x46, 0xB0, 0x9C, 0x89,
+    0x68, 0x4B, 0x25, 0x93, 0x48, 0x9D, 0x35, 0x19, 0x38, 0x31, 0xA4, 0x24, 0x54, 0x98, 0x82, 0x49,
+    0x72, 0xD4, 0xC2, 0xC7, 0xD4, 0xA6, 0xD2, 0xF7, 0xF4, 0x83, 0xC9, 0x98, 0x78, 0xF0, 0x44, 0x20,
+    0xEF, 0x34, 0x1E, 0x60, 0x07, 0x92, 0x37, 0x1C, 0x9F, 0x45, 0x8F, 0xB1, 0xA3, 0xC7, 0xB7, 0x90,
+    0xFC, 0x58, 0x60, 0x58, 0x50, 0x73, 0xC6, 0x8E, 0x8B, 0xE5, 0x2C, 0xA7, 0x1D, 0x91, 0xBD, 0x1B,
+    0xA3, 0x47, 0x5B, 0x4A, 0x01, 0x8E, 0x27, 0x9C, 0x29, 0x4B, 0x2F, 0x58, 0xD3, 0x10, 0x27, 0x49,
+    0x4A, 0x7C, 0xF4, 0x10, 0x71, 0x89, 0xE2, 0x53, 0x41, 0xC1, 0x82, 0x9C, 0xA8, 0x89, 0x6D, 0x50,
+    0x11, 0x29, 0x61, 0x89, 0x21, 0x25, 0xEC, 0x8A, 0x22, 0x18, 0x29, 0xAB, 0x6C, 0x0F, 0xC3, 0xBB,
+    0xE5, 0xBF, 0x95, 0x82, 0xE8, 0xA5, 0xB8, 0x9E, 0xD8, 0x26, 0x39, 0x54, 0x35, 0xD9, 0xCC, 0xFE,
+    0xD1, 0xC5, 0x63, 0xC1, 0x10, 0x7C, 0x15, 0x98, 0x77, 0x45, 0x05, 0xEB, 0x11, 0x1B, 0x95, 0xE7,
+    0x0E, 0x3D, 0x83, 0x60, 0x7C, 0xDA, 0xBD, 0xE6, 0xAC, 0x32, 0xBA, 0xF6, 0xA2, 0x97, 0xB9, 0xB6,
+    0xE7, 0xE0, 0x17, 0xEB, 0x1A, 0x32, 0x11, 0x47, 0xA8, 0x23, 0x7B, 0xE6, 0x9A, 0xE6, 0xD4, 0x89,
+    0xBB, 0xE2, 0x5C, 0x7D, 0x16, 0x93, 0x52, 0x4E, 0xC5, 0x24, 0x25, 0x86, 0x88, 0x35, 0x4A, 0xCA,
+    0xAF, 0x5F, 0x52, 0x4C, 0x46, 0xBC, 0xC7, 0x75, 0x41, 0xF0, 0xEB, 0xAA, 0x9F, 0x04, 0x04, 0x1C,
+    0xB6, 0xED, 0xBB, 0x52, 0x64, 0xF5, 0x98, 0xC0, 0x8F, 0x68, 0xDB, 0x8F, 0x2D, 0xC9, 0x12, 0x2A,
+    0x0B, 0x7D, 0xB3, 0x4E, 0xF6, 0x2C, 0xC9, 0x22, 0x1D, 0x1A, 0x92, 0x75, 0xC8, 0x21, 0xA2, 0xC6,
+    0x27, 0x09, 0xC9, 0x8C, 0xC8, 0x49, 0xD6, 0xA5, 0x91, 0xA1, 0x30, 0xA3, 0xD7, 0x4B, 0x9E, 0x00,
+    0xEA, 0x20, 0x6A, 0xC0, 0x26, 0xA1, 0x18, 0x73, 0xD7, 0xE9, 0x09, 0x9B, 0xD3, 0x75, 0xA3, 0xE4,
+    0xFC, 0xA9, 0xE1, 0xF9, 0x1C, 0xF8, 0x71, 0xE0, 0x5C, 0x6D, 0x7E, 0xE8, 0xF9, 0x59, 0xE0, 0x89,
+    0x1B, 0x78, 0x14, 0xAA, 0x7E, 0x2A, 0xF8, 0x4D, 0xFA, 0x83, 0x87, 0x7E, 0xFC, 0x6D, 0x4E, 0x80,
+    0x95, 0x0E, 0x75, 0x9B, 0x87, 0xB3, 0xED, 0x8D, 0xA5, 0x19, 0xF0, 0x80, 0x6E, 0x51, 0x8C, 0x2E,
+    0xF5, 0x35, 0x7F, 0x2C, 0xD6, 0xF2, 0x98, 0x6F, 0x5A, 0x51, 0x0C, 0xEA, 0x56, 0x7E, 0x42, 0x5E,
+    0x86, 0xF0, 0x7F, 0xAF, 0xBF, 0x01, 0xB5, 0x55, 0xBD, 0x72, 0xDE, 0x44, 0x14, 0xBD, 0xAB, 0x25,
+    0x51, 0xA1, 0x62, 0x29, 0x9C, 0x82, 0x61, 0x06, 0xF5, 0x0C, 0x33, 0x7A, 0x82, 0x7C, 0x2B, 0xD2,
+    0x50, 0x50, 0x10, 0x66, 0xF0, 0xF0, 0x32, 0xB1, 0xB5, 0x6F, 0x80, 0x1B, 0x6A, 0x52, 0x50, 0x99,
+    0x22, 0x0D, 0x85, 0x0B, 0xDB, 0xDA, 0x40, 0x41, 0x91, 0x46, 0x7D, 0x0A, 0xC4, 0x98, 0x0A, 0x0A,
+    0xAF, 0x07, 0x31, 0x11, 0x46, 0xD2, 0x72, 0xCE, 0x4A, 0x76, 0x08, 0x86, 0x92, 0xF5, 0x7C, 0xD7,
+    0xDA, 0xD5, 0x6A, 0xEF, 0x39, 0xE7, 0xFE, 0xAC, 0x89, 0x31, 0x4E, 0x15, 0x8D, 0x85, 0x19, 0x1F,
+    0xC8, 0x2C, 0x18, 0x13, 0x7E, 0x6A, 0x84, 0xC9, 0x06, 0x18, 0x1D, 0x60, 0xF2, 0xAB, 0xAF, 0x45,
+    0x8A, 0x18, 0x9D, 0x98, 0x18, 0x3B, 0x31, 0x7F, 0xE4, 0xBD, 0x54, 0xBD, 0xEE, 0xC5, 0xFA, 0xAC,
+    0x13, 0xEB, 0x74, 0x27, 0x4D, 0xAD, 0xBD, 0xB4, 0x52, 0x78, 0x89, 0x62, 0x9C, 0x5A, 0xA4, 0xAC,
+    0xB3, 0x59, 0xAA, 0x5A, 0x4F, 0x62, 0x05, 0xA6, 0xE1, 0xD1, 0x82, 0x3D, 0x18, 0xDF, 0xD2, 0x94,
+    0xAF, 0xE7, 0x27, 0x72, 0x67, 0x64, 0x03, 0xBE, 0xC1, 0x97, 0x2D, 0x9C, 0x87, 0x0A, 0xBB, 0xCE,
+    0x72, 0x00, 0x31, 0xCF, 0x81, 0x50, 0x4D, 0x4D, 0x2D, 0x52, 0x7D, 0xD2, 0xE3, 0xF3, 0xDF, 0x88,
+    0xB3, 0x59, 0x60, 0x4C, 0xE4, 0x51, 0x91, 0x68, 0x4B, 0xCE, 0x75, 0x7A, 0xB4, 0x5C, 0x2D, 0x5E,
+    0x71, 0x61, 0xB1, 0xA0, 0x53, 0x3E, 0xC7, 0x42, 0x36, 0x19, 0x2C, 0x58, 0xD7, 0x0E, 0x38, 0x5B,
+    0x47, 0xC2, 0xAE, 0x22, 0x9D, 0xAA, 0x23, 0x5A, 0xE3, 0x68, 0x0F, 0x13, 0x8A, 0xF1, 0x0D, 0x50,
+    0xA6, 0x93, 0x7B, 0x8F, 0xA1, 0x0F, 0xD9, 0x79, 0xB1, 0x1D, 0x5E, 0x1B, 0xD0, 0xAB, 0xB3, 0xE8,
+    0x81, 0xAE, 0x1D, 0x71, 0x50, 0x19, 0x6B, 0xD3, 0xEB, 0x57, 0x01, 0xBB, 0x66, 0xCC, 0xBC, 0xFD,
+    0xA2, 0xCF, 0xC6, 0xE2, 0x6A, 0x16, 0xFB, 0xE1, 0x54, 0x61, 0x57, 0x03, 0x5A, 0xAD, 0xE9, 0x1A,
+    0x67, 0x2E, 0xC6, 0x62, 0x90, 0xF9, 0x1C, 0x72, 0x95, 0x97, 0xBE, 0xEC, 0xB3, 0x18, 0x34, 0x76,
+    0xE1, 0x38, 0x9F, 0xC7, 0xBA, 0xC0, 0xAE, 0x5E, 0x22, 0x91, 0x1C, 0xC9, 0x63, 0xD1, 0x75, 0x5E,
+    0x8B, 0xA9, 0x9F, 0x6C, 0x84, 0x2C, 0x61, 0xBD, 0x75, 0x47, 0xB3, 0x53, 0xC9, 0xBD, 0x0A, 0xB2,
+    0x13, 0xDD, 0xE1, 0x9F, 0x71, 0x20, 0x52, 0x61, 0x51, 0xCE, 0x10, 0x28, 0x35, 0x56, 0xD0, 0xE4,
+    0x0A, 0x1F, 0x9A, 0x1F, 0x71, 0x42, 0x45, 0x45, 0x1A, 0x2A, 0x44, 0x1F, 0x94, 0x5A, 0x0C, 0xF4,
+    0xA4, 0xDC, 0x02, 0x58, 0xA2, 0xB0, 0xAC, 0xE3, 0x44, 0x59, 0xA1, 0x75, 0xD3, 0xDF, 0xFA, 0xB8,
+    0x27, 0xB2, 0x87, 0x53, 0xE5, 0x09, 0x62, 0x03, 0x8E, 0x3B, 0x91, 0x51, 0x0E, 0x44, 0x0D, 0xF0,
+    0x93, 0x05, 0x3C, 0xC3, 0xD5, 0xB0, 0xFA, 0xCF, 0x3D, 0x16, 0x0A, 0x8F, 0x05, 0xE3, 0x72, 0xE4,
+    0x4C, 0x8D, 0xD4, 0x28, 0xC5, 0x78, 0x7C, 0x0D, 0x60, 0x3B, 0x29, 0xBF, 0xDC, 0x3F, 0x83, 0xEE,
+    0x70, 0x62, 0x69, 0x24, 0x27, 0xD9, 0xA2, 0x26, 0x12, 0xB9, 0x31, 0xEF, 0xAC, 0x4E, 0x4B, 0xBE,
+    0xB2, 0x8C, 0x6F, 0xEB, 0x89, 0x0D, 0x46, 0xFF, 0xCA, 0xC0, 0xBE, 0x80, 0x29, 0x3F, 0xEA, 0x44,
+    0x76, 0xF0, 0x20, 0xA7, 0xC8, 0x4A, 0x35, 0xC0, 0xA1, 0x0E, 0x3A, 0xB9, 0x0E, 0xF8, 0x12, 0xC6,
+    0x32, 0x89, 0xDB, 0x18, 0x07, 0x85, 0x2C, 0x1F, 0x34, 0x4D, 0xF1, 0xFB, 0xFE, 0xE7, 0x23, 0x62,
+    0xA8, 0x47, 0x0B, 0xA2, 0x53, 0x9B, 0x34, 0x68, 0x22, 0xE2, 0x78, 0x7D, 0xFC, 0x94, 0x9A, 0x11,
+    0x28, 0xB9, 0xE1, 0x7C, 0x40, 0xCA, 0xD6, 0x5C, 0x3A, 0x12, 0x7D, 0xFD, 0xCC, 0x83, 0xEF, 0x7B,
+    0xCC, 0x73, 0xC6, 0xD8, 0x30, 0xD7, 0x03, 0x28, 0x9F, 0x49, 0x79, 0xDC, 0xFA, 0x0C, 0x47, 0x63,
+    0xDF, 0x0C, 0xED, 0x96, 0x1B, 0xC5, 0xCA, 0xF8, 0xB3, 0x14, 0xBF, 0x3C, 0x73, 0xC0, 0xC5, 0x8D,
+    0x1F, 0x40, 0x3A, 0x03, 0x0D, 0x72, 0x4F, 0x45, 0x00, 0xC6, 0x29, 0x96, 0xD4, 0x09, 0x96, 0x1E,
+    0x42, 0x38, 0x54, 0xC5, 0x88, 0xB3, 0xCF, 0xB1, 0xBB, 0xA9, 0x97, 0x6F, 0xA2, 0x07, 0xA8, 0x0E,
+    0x2A, 0x79, 0x13, 0x97, 0xFA, 0x6F, 0xB1, 0x06, 0x09, 0xD6, 0x62, 0x58, 0x91, 0x31, 0xDF, 0xFB,
+    0x2D, 0x69, 0x8B, 0x6E, 0xAB, 0x61, 0xD0, 0x5B, 0x13, 0xD8, 0xD6, 0x5B, 0x19, 0xB3, 0x06, 0x0B,
+    0x3E, 0x10, 0x5C, 0x89, 0x7D, 0xD9, 0x74, 0x23, 0xEC, 0x36, 0x2C, 0x23, 0xD1, 0xD0, 0x9C, 0x90,
+    0xFC, 0x80, 0x3F, 0x15, 0x40, 0x30, 0xEB, 0xE1, 0x48, 0x77, 0x38, 0x45, 0x33, 0xA2, 0x85, 0x67,
+    0x44, 0x1D, 0x80, 0x1A, 0x0A, 0x55, 0x32, 0x42, 0x3B, 0x14, 0xBB, 0x4C, 0xAB, 0xD8, 0x56, 0xAA,
+    0xEB, 0xE3, 0x78, 0x04, 0xEC, 0x89, 0x40, 0x74, 0x07, 0x48, 0x39, 0xE8, 0x86, 0x4D, 0x7B, 0x4C,
+    0xA0, 0x34, 0x14, 0xC3, 0x4E, 0x6A, 0x09, 0xFA, 0x43, 0xB6, 0x19, 0x9F, 0xB2, 0x18, 0xE2, 0xD7,
+    0x89, 0xE2, 0x04, 0xF1, 0xA2, 0xCB, 0xEE, 0xBE, 0x76, 0xE9, 0xF5, 0xCC, 0xD7, 0x5D, 0xB6, 0xA5,
+    0x90, 0x97, 0x54, 0xCD, 0x35, 0x02, 0x6A, 0x9D, 0x0D, 0xE0, 0x99, 0x4D, 0x79, 0x24, 0x43, 0xD3,
+    0x37, 0x1D, 0xA9, 0xB7, 0xF9, 0x44, 0xD2, 0x7A, 0x68, 0x7F, 0x60, 0x67, 0xB3, 0x2F, 0x06, 0xEA,
+    0xA0, 0xE6, 0x68, 0x79, 0x9E, 0xB9, 0x8C, 0x29, 0xCD, 0x13, 0x7B, 0xF6, 0x8F, 0xB8, 0x29, 0x92,
+    0x56, 0xCD, 0x3A, 0xCD, 0x53, 0xAA, 0x12, 0x7A, 0x5A, 0x6E, 0x2F, 0xFF, 0x64, 0x7D, 0x54, 0x73,
+    0xFC, 0x2A, 0xD5, 0x4A, 0x35, 0x62, 0x59, 0xC7, 0xEF, 0xE3, 0xC7, 0x58, 0x8E, 0xA1, 0x19, 0x50,
+    0xCF, 0xCD, 0x54, 0xC4, 0x47, 0xA9, 0x19, 0x61, 0xDC, 0x47, 0x0E, 0x55, 0x71, 0x94, 0xF7, 0x3F,
+    0x9D, 0x36, 0x52, 0xFC, 0x1D, 0xAC, 0x11, 0x43, 0x0F, 0xA9, 0x50, 0x77, 0x76, 0xD9, 0xA2, 0x48,
+    0xE2, 0xFC, 0xE9, 0xFE, 0x6D, 0x04, 0x73, 0xB7, 0x1F, 0x1D, 0x68, 0x26, 0x7C, 0xEF, 0xA6, 0xCE,
+    0x70, 0x3B, 0xD0, 0x14, 0xF7, 0x53, 0x1C, 0x7A, 0x35, 0x09, 0xBA, 0x48, 0xE5, 0x04, 0xAA, 0x0E,
+    0x52, 0xB1, 0xED, 0x16, 0xD1, 0x15, 0x41, 0x21, 0x2F, 0x17, 0xB1, 0x0D, 0x76, 0x99, 0x97, 0x41,
+    0x4D, 0x7A, 0x5C, 0xB0, 0xAB, 0x2D, 0x3B, 0x3D, 0x94, 0xDF, 0x61, 0x57, 0x1E, 0xAC, 0x2F, 0xC2,
+    0x9C, 0x8F, 0x68, 0x93, 0xAE, 0xAD, 0xCD, 0xCB, 0xDE, 0x04, 0xB5, 0x4C, 0x68, 0x74, 0xE8, 0x8C,
+    0xB6, 0x43, 0x93, 0x64, 0x7D, 0x0C, 0xA8, 0xBF, 0x62, 0x11, 0x33, 0xA6, 0x46, 0x80, 0x56, 0x80,
+    0x8C, 0xEE, 0x65, 0x6D, 0x4C, 0xC0, 0xC5, 0x42, 0x49, 0xC0, 0xD4, 0x6D, 0xA6, 0xEE, 0x6D, 0x6D,
+    0xF3, 0xFE, 0xD3, 0x7F, 0x69, 0x9B, 0xFA, 0xA6, 0x6D, 0x9E, 0xA7, 0xB6, 0xD9, 0xE5, 0xFF, 0x6C,
+    0x9B, 0x3F, 0xA1, 0x21, 0x3E, 0x7A, 0xA3, 0x6D, 0xD6, 0xE6, 0x62, 0x40, 0x64, 0x5F, 0xB7, 0x4D,
+    0xFD, 0x1F, 0x6D, 0x33, 0xDD, 0x1F, 0x9A, 0x59, 0x90, 0xAE, 0x8F, 0x82, 0x09, 0x90, 0x6E, 0x8F,
+    0x92, 0xB1, 0x4F, 0x97, 0x87, 0x65, 0xD8, 0xD3, 0xDD, 0x91, 0x62, 0xCA, 0x10, 0x29, 0x46, 0x35,
+    0xDD, 0x1C, 0xA9, 0xF9, 0xA5, 0x8B, 0xC3, 0x5C, 0x80, 0x58, 0xBA, 0x37, 0x2A, 0x8F, 0xD7, 0xE9,
+    0xDA, 0x68, 0xE8, 0x71, 0xBB, 0x35, 0x1E, 0xEC, 0x7F, 0xC6, 0x64, 0x09, 0x4C, 0x11, 0x87, 0x0A,
+    0x3C, 0xA5, 0xEF, 0x40, 0xA1, 0x59, 0x13, 0x07, 0xB7, 0x33, 0x8F, 0xD9, 0x21, 0x66, 0xB8, 0x55,
+    0xB7, 0x59, 0xC3, 0xD9, 0xB8, 0xCE, 0x0E, 0x53, 0xE1, 0x60, 0x86, 0x4A, 0xEF, 0xF2, 0x29, 0x95,
+    0xF4, 0xFF, 0x3E, 0xFE, 0x02, 0x8D, 0x55, 0x3D, 0x8F, 0x1C, 0x45, 0x10, 0x7D, 0x33, 0x8D, 0x3C,
+    0xC1, 0x04, 0x9D, 0x38, 0xB3, 0x74, 0x1D, 0x83, 0x64, 0xCF, 0x1F, 0xD8, 0xBB, 0x19, 0x43, 0x48,
+    0x40, 0x04, 0x09, 0x01, 0x3F, 0xE1, 0x12, 0x82, 0x0B, 0xF6, 0x6E, 0x47, 0x22, 0x20, 0xF5, 0x8F,
+    0x20, 0x3A, 0x0B, 0x71, 0x81, 0x83, 0x0B, 0x96, 0xDB, 0x86, 0x3F, 0xC0, 0x80, 0x44, 0xE4, 0xC0,
+    0x9D, 0x12, 0xB9, 0x41, 0x83, 0x18, 0xA3, 0xD9, 0x6D, 0xDE, 0xEB, 0xDB, 0xB5, 0x7D, 0x08, 0x10,
+    0xA3, 0x55, 0xED, 0x6E, 0x7F, 0xD4, 0xAB, 0x7A, 0xF5, 0xAA, 0x06, 0xC8, 0x4F, 0xEB, 0xE1, 0x86,
+    0x22, 0x01, 0x09, 0xF5, 0x16, 0xF5, 0x8C, 0x93, 0x11, 0x17, 0x01, 0x7F, 0x04, 0xF3, 0xA2, 0xAB,
+    0x7E, 0xF0, 0x27, 0x4B, 0x34, 0x6D, 0xF9, 0x5B, 0xC4, 0xB4, 0x76, 0x1F, 0xF5, 0xD5, 0x4F, 0x71,
+    0x3E, 0x41, 0x53, 0x3F, 0xFF, 0x6E, 0xC4, 0xEC, 0x76, 0xD6, 0x9B, 0xB0, 0x8A, 0x2D, 0xDC, 0xE3,
+    0xF4, 0x78, 0xC2, 0xBA, 0x9A, 0xEB, 0xC1, 0x44, 0xEB, 0xB9, 0xD0, 0x03, 0x33, 0xBE, 0x05, 0xEA,
+    0x60, 0x22, 0x31, 0x3A, 0xEC, 0x9F, 0x16, 0xB0, 0x9E, 0x5B, 0x58, 0xA1, 0x0A, 0x28, 0x27, 0x34,
+    0x1D, 0xEC, 0xA0, 0x85, 0x16, 0x55, 0x44, 0x31, 0xA3, 0xF1, 0xB0, 0x01, 0x3B, 0x5D, 0x32, 0xA3,
+    0x16, 0x9C, 0x47, 0x1D, 0x19, 0x1D, 0x23, 0x35, 0x29, 0xA5, 0x1D, 0x1C, 0xED, 0x88, 0x0D, 0x6D,
+    0x5E, 0x48, 0x70, 0x7F, 0x5E, 0x7E, 0x33, 0x61, 0xD3, 0xA1, 0x1D, 0xCC, 0xAC, 0x44, 0x6C, 0x44,
+    0x35, 0x63, 0xE5, 0xD1, 0x84, 0x92, 0x9E, 0x12, 0xA3, 0xC1, 0xBD, 0x14, 0x68, 0x37, 0xBC, 0x8F,
+    0x2A, 0x7D, 0xC2, 0x25, 0x37, 0x2A, 0xF7, 0x15, 0x7F, 0x0C, 0xF2, 0x6E, 0x43, 0x39, 0xCB, 0x12,
+    0x94, 0x51, 0x33, 0x16, 0xD4, 0x03, 0x23, 0x63, 0xB8, 0x0C, 0x98, 0x56, 0x29, 0xB9, 0xBE, 0xE9,
+    0x15, 0x98, 0xEC, 0x06, 0xCD, 0x00, 0xB3, 0x45, 0xB3, 0xFD, 0x78, 0x33, 0xEF, 0x63, 0xB2, 0xB4,
+    0x01, 0x35, 0x6D, 0x8F, 0x32, 0xA5, 0x2D, 0x01, 0x9B, 0xF4, 0x04, 0x77, 0x9E, 0x36, 0x25, 0xD2,
+    0xCD, 0xA8, 0xE9, 0x76, 0x8D, 0x13, 0x98, 0x50, 0xF0, 0x62, 0x57, 0x7B, 0x2C, 0xC9, 0x41, 0x49,
+    0xA2, 0x61, 0xFB, 0x6A, 0xC0, 0x39, 0x1A, 0xFD, 0x9B, 0x21, 0x92, 0x79, 0xAE, 0xE9, 0x78, 0x6E,
+    0x46, 0xED, 0x49, 0xA8, 0x08, 0x2E, 0x26, 0xF2, 0x2B, 0xBE, 0xC5, 0x29, 0x8C, 0xF2, 0x22, 0xF0,
+    0x00, 0xFB, 0xF3, 0x67, 0x91, 0x1E, 0x78, 0xD8, 0x75, 0x18, 0x6F, 0x5D, 0x12, 0x25, 0xCA, 0x21,
+    0x13, 0x55, 0x68, 0x22, 0x91, 0x21, 0x3C, 0x81, 0x99, 0x74, 0x95, 0x09, 0x8B, 0x7B, 0x88, 0x36,
+    0x31, 0x40, 0x43, 0x4A, 0xA0, 0xE3, 0x59, 0x1E, 0x10, 0x93, 0x4C, 0xB8, 0x7F, 0x2B, 0x8B, 0x62,
+    0xC3, 0xAB, 0x4C, 0xD1, 0xCB, 0xD0, 0x41, 0xCA, 0x67, 0x87, 0x83, 0x13, 0x95, 0x41, 0x35, 0xD6,
+    0x7F, 0x2D, 0x96, 0xF9, 0x7F, 0x96, 0x41, 0x46, 0x22, 0x7B, 0xDA, 0x12, 0xBC, 0xAE, 0xBE, 0x43,
+    0xE6, 0x7E, 0x39, 0xF5, 0x8A, 0x6E, 0xCA, 0xF4, 0x75, 0xA2, 0x29, 0x22, 0xF3, 0x24, 0x84, 0x03,
+    0x87, 0xA2, 0x79, 0x6E, 0x64, 0xDA, 0xDD, 0x8E, 0x35, 0x47, 0xF6, 0x2B, 0x37, 0xE5, 0x78, 0x48,
+    0x45, 0x82, 0xDB, 0xE7, 0x13, 0x0E, 0xF8, 0x4E, 0x09, 0x34, 0x32, 0xAD, 0xB2, 0x58, 0x75, 0x87,
+    0x10, 0x92, 0x72, 0xD9, 0xE9, 0xFE, 0xF6, 0x10, 0xF6, 0x6D, 0xEC, 0xF9, 0x59, 0xA3, 0xF2, 0x45,
+    0xA6, 0x6F, 0x28, 0x44, 0xAA, 0xED, 0x59, 0x94, 0x35, 0x70, 0xCE, 0x8A, 0x14, 0x13, 0x79, 0x37,
+    0xBF, 0x12, 0xDB, 0xBE, 0xA0, 0xE3, 0x46, 0x4E, 0x56, 0x42, 0x95, 0xDA, 0xB2, 0x8F, 0x0C, 0x2F,
+    0x94, 0x9A, 0x61, 0x15, 0x5C, 0x36, 0x49, 0x0A, 0x63, 0x72, 0x58, 0x85, 0xBB, 0xA2, 0x38, 0x4D,
+    0xBB, 0xAE, 0x7A, 0x75, 0xF3, 0x69, 0xB0, 0xDD, 0x39, 0xAE, 0x16, 0x4C, 0xEB, 0xD9, 0xE7, 0x34,
+    0x57, 0x57, 0xAC, 0x72, 0x7C, 0x56, 0x8E, 0x26, 0xDE, 0x7C, 0xF0, 0xFB, 0xE9, 0xB0, 0x52, 0xF9,
+    0x5A, 0x95, 0xEF, 0x9E, 0x84, 0x26, 0x09, 0x21, 0xF7, 0x9A, 0xDA, 0x68, 0xCF, 0x6F, 0xFB, 0x9A,
+    0xDE, 0xDD, 0x1B, 0xFF, 0xE2, 0xE4, 0x5C, 0x1C, 0x51, 0x16, 0xF4, 0xCB, 0xD6, 0xC3, 0x36, 0x5F,
+    0xBC, 0xC1, 0x85, 0xEE, 0x14, 0x8A, 0xB7, 0xFD, 0x52, 0xE1, 0xBB, 0x97, 0x72, 0x6A, 0x53, 0x2E,
+    0x90, 0x48, 0x41, 0x9D, 0xCB, 0xE4, 0x6E, 0x4B, 0x2A, 0x5B, 0x48, 0x6C, 0xA8, 0x26, 0x9D, 0x71,
+    0x51, 0xBA, 0x58, 0x79, 0x4A, 0x84, 0x43, 0x84, 0x0A, 0x60, 0xE3, 0x35, 0x51, 0xCD, 0xC5, 0xCF,
+    0x8A, 0x72, 0x3C, 0xB0, 0x19, 0x71, 0x04, 0x87, 0x72, 0x28, 0x03, 0x16, 0x38, 0x26, 0xB1, 0xC6,
+    0xE3, 0x9A, 0x9A, 0xB7, 0x1D, 0xC5, 0x1A, 0xA9, 0xD4, 0x86, 0xDB, 0x26, 0x50, 0xAD, 0xC7, 0x24,
+    0x9C, 0xDB, 0x9A, 0x0A, 0xDC, 0xEE, 0x6B, 0xCF, 0xA0, 0x27, 0x6D, 0x33, 0xF1, 0x52, 0x5D, 0x4F,
+    0x06, 0x32, 0xBF, 0x4C, 0xB7, 0x54, 0xC8, 0x27, 0x6A, 0xEF, 0x1E, 0x45, 0x87, 0xFB, 0x16, 0x45,
+    0xBC, 0x46, 0xFD, 0xC5, 0x80, 0x63, 0xFD, 0x5C, 0xA2, 0xFE, 0x9E, 0xCD, 0x63, 0xD9, 0x3B, 0x0B,
+    0xB2, 0x15, 0xB1, 0xA9, 0x82, 0x9B, 0xD8, 0xA6, 0x03, 0x45, 0x84, 0x66, 0xA4, 0x1B, 0x96, 0x32,
+    0xB3, 0x37, 0xDF, 0xB2, 0xE4, 0x0E, 0x2A, 0x77, 0xDD, 0xBB, 0x65, 0xAC, 0xBD, 0xEB, 0x26, 0xC3,
+    0xAF, 0x63, 0x4C, 0x26, 0x38, 0x72, 0x38, 0xD6, 0xBE, 0xC1, 0xD2, 0x04, 0xCB, 0xAF, 0x68, 0x06,
+    0xDB, 0x2F, 0x0A, 0x7E, 0x1D, 0x61, 0x5D, 0xC4, 0xBA, 0x3B, 0xC1, 0xDA, 0x78, 0xDB, 0x1D, 0x23,
+    0x56, 0xDE, 0xE2, 0xAC, 0x8C, 0xC6, 0x3F, 0xC4, 0x54, 0x04, 0x8B, 0xF6, 0x72, 0xF7, 0xD4, 0x4B,
+    0xBD, 0xC1, 0xE6, 0x49, 0xF1, 0xFF, 0x30, 0xFA, 0x3D, 0xC6, 0x52, 0x18, 0x8F, 0x84, 0x21, 0xE7,
+    0xD7, 0xC4, 0xC0, 0xC3, 0x03, 0x46, 0x10, 0xC6, 0x98, 0x31, 0xD4, 0x17, 0xC2, 0x48, 0xC2, 0x90,
+    0xCC, 0x38, 0x2D, 0x54, 0xFC, 0xDC, 0x81, 0xB9, 0xED, 0x46, 0xBC, 0xF7, 0x35, 0xC7, 0x5F, 0xC4,
+    0x8A, 0x95, 0x65, 0x01, 0x70, 0xC6, 0x33, 0x9D, 0xD6, 0x49, 0x3E, 0x1B, 0xED, 0x15, 0xDA, 0xA7,
+    0x93, 0x21, 0xF7, 0x4B, 0x1C, 0xD5, 0x7D, 0x11, 0x46, 0x3C, 0x72, 0xA4, 0x30, 0x3E, 0x98, 0xE9,
+    0x9C, 0xC3, 0x96, 0x0A, 0x1C, 0x5E, 0x8B, 0xCA, 0xF9, 0x72, 0xC8, 0xAD, 0xBD, 0xC8, 0xDA, 0x93,
+    0x3B, 0x32, 0x78, 0x96, 0x1B, 0xBF, 0xEE, 0x35, 0x45, 0xE5, 0x97, 0xC4, 0xBA, 0xDB, 0xC3, 0xF4,
+    0xCE, 0x81, 0x4F, 0x80, 0x7C, 0xD8, 0x68, 0x74, 0x11, 0x86, 0x5A, 0x15, 0x92, 0xD5, 0xE1, 0x47,
+    0x54, 0xA5, 0x65, 0xD0, 0x8D, 0x2F, 0x09, 0xC9, 0x26, 0x22, 0x2A, 0x27, 0xB4, 0x80, 0xD9, 0x43,
+    0xC2, 0x4E, 0xDD, 0x5B, 0x5D, 0x23, 0xF8, 0xC5, 0x9B, 0x3C, 0xFA, 0xFF, 0xCC, 0xC3, 0xFE, 0x73,
+    0x1E, 0xF5, 0xAE, 0xD3, 0x4C, 0xA6, 0xC4, 0x2F, 0x34, 0x1B, 0xD6, 0xC8, 0x51, 0x71, 0xB4, 0xDE,
+    0xDF, 0x6B, 0x41, 0xAD, 0x7E, 0x79, 0xA9, 0x11, 0xA7, 0x79, 0xAE, 0x80, 0x24, 0x3D, 0xED, 0x54,
+    0x43, 0xEE, 0xAC, 0x6A, 0xCB, 0x56, 0x28, 0xD3, 0x8E, 0x6F, 0x81, 0x8D, 0xCE, 0x48, 0xA6, 0xFB,
+    0xE9, 0xFF, 0x20, 0x7D, 0x75, 0xB7, 0xCF, 0x47, 0x9C, 0x8E, 0xCC, 0xCF, 0x12, 0xAF, 0xC5, 0x56,
+    0xBA, 0xB6, 0x7D, 0x19, 0xAB, 0x81, 0x2D, 0xE9, 0x9B, 0x8A, 0x6F, 0x62, 0xF0, 0xF5, 0xCA, 0xD2,
+    0xFF, 0x18, 0x59, 0x30, 0xC7, 0xEA, 0xD9, 0x7E, 0xC3, 0xB7, 0xE8, 0xB1, 0xA1, 0x64, 0xCA, 0x68,
+    0x3F, 0xD4, 0xC2, 0x92, 0x6F, 0x9F, 0xB9, 0x0C, 0x9B, 0xCE, 0x05, 0xFB, 0x7E, 0x7A, 0x99, 0xB0,
+    0x60, 0x42, 0xB1, 0x08, 0x15, 0x43, 0xAB, 0xBB, 0xF2, 0xEF, 0xEF, 0x9B, 0x7F, 0x7D, 0xFE, 0x02,
+    0xAD, 0x55, 0x31, 0x8C, 0xDC, 0x44, 0x14, 0x7D, 0xE3, 0x21, 0xB1, 0x90, 0x11, 0xD3, 0x20, 0x84,
+    0x22, 0x65, 0xDD, 0x52, 0x24, 0x71, 0x43, 0x71, 0xC5, 0xEE, 0xDA, 0x81, 0x92, 0x86, 0x22, 0x49,
+    0x43, 0x41, 0x43, 0x05, 0x48, 0x69, 0xAF, 0xD8, 0x3B, 0x1B, 0x51, 0x50, 0x92, 0x26, 0x35, 0x69,
+    0xB9, 0x48, 0x5C, 0x8A, 0x14, 0x5B, 0xEC, 0xC9, 0x13, 0x52, 0xA4, 0x1D, 0x10, 0x52, 0x4A, 0x1C,
+    0x05, 0x09, 0x94, 0x08, 0x65, 0x20, 0x06, 0x7C, 0x89, 0xD7, 0xC3, 0xFB, 0x76, 0x80, 0x48, 0x94,
+    0xC1, 0x77, 0x33, 0xAB, 0xF3, 0xCD, 0x9F, 0xFF, 0xFE, 0xFB, 0xEF, 0xFD, 0x05, 0x70, 0xE2, 0x02,
+    0x90, 0x84, 0x1E, 0x28, 0xB9, 0xA9, 0x0E, 0xBB, 0xD0, 0x0E, 0x37, 0x91, 0x58, 0x78, 0x98, 0x4A,
+    0x36, 0xAB, 0x3C, 0xD2, 0x26, 0x6A, 0x60, 0x86, 0xEB, 0x0E, 0x71, 0x08, 0x16, 0x91, 0x6C, 0x46,
+    0xB6, 0xBC, 0xC8, 0x2B, 0xF4, 0xFC, 0x60, 0x68, 0x09, 0xDD, 0x22, 0x20, 0xF1, 0xDC, 0x8C, 0x57,
+    0x03, 0xB2, 0x26, 0xDA, 0x22, 0x6F, 0x74, 0x8F, 0xDA, 0xC5, 0x4C, 0x21, 0x4F, 0x34, 0x9C, 0x41,
+    0xCA, 0x54, 0xFB, 0x51, 0x8F, 0x16, 0x1D, 0x93, 0x75, 0xB1, 0x45, 0x6B, 0xA0, 0xBC, 0x81, 0xF6,
+    0x33, 0x86, 0x67, 0x8C, 0xC9, 0x42, 0x68, 0xD2, 0x10, 0x9C, 0x09, 0x7F, 0xDA, 0x28, 0x7C, 0x6E,
+    0xA7, 0x60, 0x9C, 0xA8, 0x90, 0x31, 0x6B, 0x19, 0x1A, 0x94, 0x05, 0xB0, 0xCF, 0x57, 0x4B, 0xAE,
+    0x4C, 0x15, 0x30, 0x97, 0x43, 0xA5, 0x43, 0xE8, 0x54, 0xA8, 0x02, 0x6A, 0x18, 0x97, 0x17, 0xBA,
+    0x35, 0x16, 0xBD, 0xE6, 0x59, 0x42, 0x2C, 0x8B, 0xFC, 0x6A, 0x5D, 0x25, 0x02, 0xBA, 0x0E, 0x15,
+    0x4E, 0x0E, 0x8C, 0xAB, 0x07, 0x98, 0x83, 0x0D, 0xBC, 0x72, 0x33, 0x9C, 0x8E, 0x5C, 0x6C, 0xF3,
+    0xD0, 0xE8, 0xB0, 0xC5, 0x1A, 0x6B, 0x53, 0x68, 0xEB, 0xB1, 0x9A, 0xC1, 0x7C, 0xE3, 0xE2, 0x36,
+    0x0F, 0x81, 0x77, 0x5B, 0xC9, 0x8B, 0x9C, 0x07, 0x84, 0x2C, 0x29, 0xA8, 0x03, 0x54, 0xCB, 0xA2,
+    0xB8, 0xB4, 0x9F, 0x56, 0xCC, 0x23, 0x89, 0x03, 0x01, 0x00, 0x29, 0x71, 0x67, 0x5C, 0xE4, 0x48,
+    0xB2, 0x85, 0x82, 0xC1, 0x16, 0x33, 0x1E, 0x33, 0x45, 0x07, 0x6D, 0xF7, 0x10, 0x35, 0x19, 0xE0,
+    0x09, 0x73, 0x45, 0x98, 0x0B, 0xDE, 0xB5, 0xC4, 0x06, 0x39, 0x7F, 0xCA, 0xAB, 0x1F, 0x7C, 0x5F,
+    0x86, 0xB0, 0x25, 0x09, 0x81, 0x04, 0x99, 0xF3, 0x9E, 0x3D, 0x79, 0x0D, 0x2C, 0x94, 0x17, 0x55,
+    0x48, 0x9E, 0x7A, 0x92, 0xBE, 0x43, 0xA4, 0x67, 0xD8, 0x99, 0x95, 0x7E, 0x10, 0x7A, 0x96, 0xD6,
+    0x9B, 0xAB, 0x24, 0x82, 0x27, 0xD2, 0x62, 0x4A, 0x6E, 0x8E, 0x2F, 0x39, 0x29, 0x79, 0x6C, 0xD8,
+    0xE5, 0x63, 0xFC, 0xFD, 0x24, 0x2E, 0xF7, 0x69, 0x85, 0xB4, 0x0A, 0xE7, 0x59, 0x42, 0xAE, 0x7B,
+    0xFE, 0x81, 0xA3, 0xF4, 0x1E, 0xFF, 0x40, 0x5F, 0x4A, 0xA4, 0xFE, 0xAD, 0x93, 0x02, 0xE3, 0x47,
+    0x8F, 0x84, 0x7B, 0x13, 0xC6, 0xF6, 0x09, 0xF7, 0x7C, 0x82, 0x70, 0xF7, 0xEC, 0x9D, 0x0A, 0xE3,
+    0x07, 0xFB, 0xC5, 0x58, 0x3D, 0x94, 0x5F, 0x92, 0x82, 0xF2, 0xFE, 0x90, 0x7B, 0xC4, 0x43, 0xDA,
+    0xD6, 0x0D, 0xEA, 0x26, 0xD8, 0x29, 0x0C, 0x79, 0x8B, 0xF7, 0x4E, 0x03, 0x2F, 0x03, 0xAF, 0x80,
+    0x42, 0xCB, 0x1D, 0x5E, 0x27, 0x59, 0x37, 0xC6, 0x5F, 0xFF, 0xEA, 0xA1, 0xCB, 0x42, 0x95, 0x3E,
+    0xC3, 0x78, 0x0E, 0xB1, 0x67, 0x0B, 0x3A, 0x6D, 0xF5, 0x2F, 0xCA, 0xEB, 0x1F, 0xB0, 0xD6, 0xF7,
+    0xED, 0x22, 0xBA, 0xD7, 0x98, 0xA8, 0xB9, 0x19, 0xDF, 0xF2, 0xF3, 0xE8, 0x57, 0x9F, 0xE2, 0xD8,
+    0x27, 0x76, 0xD1, 0xEA, 0x26, 0x6D, 0x55, 0x9B, 0x74, 0xD8, 0xE8, 0x8E, 0xCC, 0x01, 0x57, 0xDE,
+    0x20, 0x20, 0x62, 0x54, 0xDD, 0x3F, 0x05, 0xBF, 0xD0, 0x85, 0x27, 0x8B, 0x0F, 0x61, 0x22, 0x8F,
+    0x8C, 0x7D, 0x5D, 0x64, 0x05, 0x56, 0x47, 0xC0, 0x13, 0xB6, 0x3C, 0x38, 0x3A, 0xA1, 0x80, 0x0E,
+    0xE4, 0x89, 0x92, 0x32, 0x8F, 0x1C, 0xCC, 0x17, 0x72, 0x8C, 0x86, 0xD0, 0x03, 0xF6, 0x14, 0xFF,
+    0x79, 0xEA, 0xA0, 0x30, 0xC1, 0x69, 0x7B, 0x43, 0x35, 0x73, 0xDC, 0x9C, 0x61, 0x9E, 0x14, 0x33,
+    0x6D, 0x93, 0xF3, 0x5E, 0xDB, 0xB5, 0x6A, 0x16, 0xEC, 0x3D, 0x36, 0x71, 0xB5, 0xA1, 0x0F, 0x46,
+    0x82, 0x2B, 0x1C, 0x21, 0xB7, 0x8A, 0x72, 0xB5, 0x62, 0x1B, 0xCB, 0xAB, 0x82, 0x4B, 0x3B, 0xF5,
+    0xD4, 0x2D, 0xDB, 0xE8, 0x61, 0x73, 0xD4, 0xEA, 0xBB, 0xF7, 0xFE, 0xF0, 0xFA, 0xEE, 0xE3, 0xC7,
+    0x3E, 0xB9, 0xFD, 0xF4, 0x4E, 0x63, 0x6E, 0x87, 0x77, 0x1B, 0xF3, 0x59, 0x30, 0x2E, 0x7B, 0xBB,
+    0x4F, 0x6D, 0x1E, 0x75, 0x99, 0xCD, 0xD5, 0xB5, 0xBC, 0x2A, 0xD9, 0x06, 0x42, 0x2A, 0xB0, 0x40,
+    0x8A, 0x51, 0x53, 0x14, 0xEC, 0x52, 0x14, 0xBB, 0x27, 0x72, 0xED, 0x45, 0xAB, 0xB2, 0x91, 0xA3,
+    0xA4, 0xD1, 0x4F, 0x0E, 0x0E, 0x1D, 0x05, 0x1E, 0x6C, 0x2C, 0x1B, 0x9D, 0x1D, 0x2A, 0x6A, 0xB2,
+    0x2C, 0xA8, 0x84, 0x5A, 0xD4, 0x3B, 0x88, 0xC3, 0xB7, 0x23, 0x44, 0x55, 0x5F, 0x41, 0x5D, 0x17,
+    0x59, 0x31, 0x4F, 0x6C, 0xE4, 0x5A, 0x9C, 0xCB, 0x10, 0xDD, 0x27, 0x2F, 0x73, 0xC4, 0x77, 0xE8,
+    0xB6, 0x7D, 0x94, 0xEF, 0x84, 0xE0, 0xF3, 0xD0, 0x53, 0x19, 0x74, 0x7B, 0x31, 0x06, 0x1D, 0x1C,
+    0x7C, 0x45, 0x09, 0x0E, 0xA2, 0x71, 0x56, 0xBA, 0xA2, 0xA0, 0x37, 0x9C, 0x30, 0x1D, 0x07, 0x4C,
+    0x6B, 0x8A, 0x88, 0x8E, 0xD7, 0x3E, 0x87, 0x6E, 0x96, 0x88, 0xDD, 0x1E, 0x75, 0xBE, 0xE1, 0xD4,
+    0xE9, 0x21, 0x9A, 0x2C, 0xBE, 0x2E, 0x10, 0xFD, 0x44, 0xDB, 0xE9, 0xF0, 0x6D, 0x0B, 0xBD, 0x95,
+    0xF9, 0xD4, 0x72, 0xA3, 0xCB, 0x76, 0xC5, 0x66, 0x6B, 0x9E, 0xE4, 0x1C, 0x19, 0x87, 0x54, 0xD6,
+    0xF0, 0xFE, 0x7C, 0xB8, 0x2C, 0xF3, 0x81, 0xCC, 0x0F, 0xF4, 0xA9, 0x6A, 0x6B, 0xCF, 0xBB, 0x4F,
+    0x4C, 0xB6, 0x94, 0xB3, 0x93, 0x2F, 0x58, 0x8E, 0x6C, 0x78, 0xFE, 0x51, 0x75, 0x13, 0x85, 0x4E,
+    0x6F, 0x5F, 0x8A, 0xBA, 0xD1, 0xD8, 0xAB, 0x71, 0xB6, 0x90, 0x41, 0x22, 0x16, 0x25, 0x09, 0x9D,
+    0xC1, 0x4B, 0x55, 0x49, 0x10, 0x3F, 0x33, 0xC9, 0xC3, 0x07, 0x4F, 0xB6, 0x54, 0x96, 0x9C, 0xC0,
+    0x9C, 0x39, 0xAC, 0x90, 0x2C, 0x63, 0x53, 0x86, 0x42, 0x36, 0xCD, 0x83, 0xFD, 0x69, 0x1C, 0x08,
+    0x79, 0x0B, 0x50, 0x44, 0x1D, 0xA4, 0x62, 0x76, 0x24, 0x76, 0x31, 0xF5, 0x52, 0x11, 0x44, 0x2E,
+    0xC7, 0x8F, 0x08, 0x4E, 0x75, 0x54, 0x96, 0x7E, 0xEC, 0xC5, 0x5C, 0x04, 0x98, 0x89, 0xB3, 0x4A,
+    0x27, 0x26, 0x13, 0x2B, 0xB6, 0x02, 0x59, 0xAC, 0x29, 0xAF, 0x6B, 0x37, 0xF9, 0x30, 0xA6, 0x08,
+    0x91, 0xB5, 0xFF, 0x96, 0x91, 0x30, 0xF0, 0x54, 0x18, 0x0A, 0x02, 0xE5, 0x30, 0x3B, 0x2E, 0x2F,
+    0x92, 0xE1, 0x1C, 0x3B, 0xA7, 0x09, 0x64, 0x3E, 0x67, 0xDA, 0xDD, 0x1D, 0x62, 0x5C, 0xEF, 0xAA,
+    0x4E, 0xF9, 0xBD, 0xA8, 0x4D, 0x7C, 0xF9, 0x70, 0x08, 0x2E, 0x97, 0x8E, 0x73, 0xD4, 0x0C, 0x38,
+    0x19, 0x64, 0xC6, 0x8D, 0x44, 0x4D, 0x6C, 0x55, 0xFF, 0x65, 0xEB, 0x14, 0xD4, 0x15, 0x48, 0x09,
+    0xA6, 0x62, 0x91, 0x2B, 0x76, 0x52, 0x7F, 0x47, 0xCC, 0xD9, 0x46, 0x66, 0x03, 0xA6, 0xD1, 0xA7,
+    0x65, 0x46, 0x0C, 0x7C, 0x9B, 0x93, 0xEF, 0xD4, 0x6E, 0x69, 0xBF, 0xD8, 0xAB, 0xF1, 0x9B, 0xE2,
+    0x1A, 0xDE, 0x24, 0x01, 0x32, 0xF0, 0xD6, 0x24, 0xAE, 0x25, 0x6B, 0x74, 0x9D, 0xF2, 0x49, 0x15,
+    0x35, 0xA4, 0xC6, 0xF1, 0x6B, 0xC0, 0xA6, 0x5C, 0x67, 0x11, 0x57, 0xCB, 0x8F, 0x0E, 0x7F, 0x24,
+    0x36, 0x5F, 0x8E, 0xA8, 0x84, 0xDF, 0xC4, 0x8E, 0x3D, 0x99, 0x9E, 0xB7, 0xD4, 0x2D, 0x9B, 0x24,
+    0xD8, 0xD9, 0x51, 0xCE, 0x25, 0x31, 0xE6, 0xB3, 0xB8, 0xC9, 0x43, 0x51, 0x7E, 0xC2, 0x71, 0xC2,
+    0x60, 0x9C, 0x1D, 0xFB, 0x70, 0x2E, 0xF2, 0xB1, 0x5D, 0x68, 0xE6, 0x98, 0xEB, 0xC6, 0x54, 0x14,
+    0x9F, 0x29, 0xD6, 0x09, 0x53, 0xB4, 0x02, 0x9F, 0x43, 0x81, 0x26, 0x4C, 0x31, 0x57, 0x9C, 0xC4,
+    0xAB, 0xC8, 0x2D, 0xB1, 0xAB, 0xED, 0xF2, 0xE2, 0xF1, 0xFB, 0xB6, 0x16, 0x4E, 0xB8, 0x42, 0xF1,
+    0x02, 0xB7, 0xFC, 0x2C, 0xB7, 0x74, 0x72, 0x0B, 0xA9, 0x18, 0xF5, 0x30, 0xAA, 0xE1, 0x39, 0x6E,
+    0xC9, 0x10, 0x2D, 0xC8, 0x76, 0x5F, 0xF2, 0x93, 0x66, 0x58, 0xE8, 0xF2, 0x02, 0xFB, 0xBA, 0x25,
+    0xC1, 0x6B, 0x53, 0x69, 0xDB, 0x62, 0x6E, 0x60, 0x3E, 0xFD, 0xFD, 0x63, 0x9F, 0x85, 0xAD, 0x9E,
+    0x86, 0xEF, 0xFF, 0xF3, 0xFC, 0x05, 0xC5, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0x86,
+    0x64, 0x85, 0x47, 0xF1, 0x50, 0x80, 0x10, 0x22, 0xF1, 0x36, 0x14, 0x48, 0xD8, 0xDE, 0x26, 0x85,
+    0x8B, 0x3B, 0xEF, 0x48, 0x14, 0xB4, 0x29, 0x92, 0xF0, 0x1F, 0x00, 0x29, 0x14, 0x2E, 0x5C, 0x5C,
+    0x7C, 0x0B, 0x08, 0xA5, 0x8C, 0x9B, 0xD4, 0xA4, 0xA1, 0xC0, 0x14, 0xB8, 0x48, 0x61, 0xA4, 0x23,
+    0x37, 0x4E, 0x0A, 0xDA, 0x41, 0x28, 0xA2, 0x64, 0x40, 0xD0, 0x84, 0x82, 0x2D, 0x16, 0x71, 0x26,
+    0xEB, 0x1B, 0xBE, 0xB7, 0x67, 0x27, 0x8E, 0x04, 0x15, 0x05, 0xB3, 0x9A, 0xD5, 0xDE, 0xDC, 0xBE,
+    0xF7, 0xBE, 0xF7, 0xBD, 0xEF, 0xBD, 0xC5, 0x5D, 0xE0, 0x45, 0xD5, 0x00, 0x6B, 0x9A, 0xB7, 0x81,
+    0x8E, 0x72, 0x0B, 0xC0, 0x76, 0xFE, 0x08, 0x68, 0x4D, 0x3A, 0x46, 0x63, 0x6B, 0x93, 0x35, 0xD6,
+    0xE9, 0x8F, 0x63, 0x81, 0xFC, 0x93, 0x50, 0xA2, 0x78, 0xC7, 0x57, 0xD7, 0x93, 0xF1, 0x55, 0xEA,
+    0x6C, 0x5D, 0xA5, 0x5D, 0xEB, 0xD0, 0xAF, 0x0D, 0x20, 0xAF, 0x81, 0x7B, 0x80, 0x05, 0x32, 0xBA,
+    0x2B, 0xAF, 0x41, 0xA7, 0x84, 0x01, 0x06, 0xB9, 0xCF, 0xC2, 0x01, 0x86, 0xD6, 0x99, 0xC3, 0xA3,
+    0xF7, 0x67, 0x65, 0x9A, 0xEB, 0x34, 0x5F, 0x58, 0x9D, 0x73, 0x38, 0x9F, 0x66, 0x18, 0xBA, 0x09,
+    0x1C, 0xBA, 0x85, 0x5D, 0xEE, 0x41, 0xB3, 0xFC, 0x31, 0x7F, 0xE6, 0xC4, 0x32, 0xD6, 0x30, 0x6D,
+    0xF1, 0x5B, 0x72, 0xE3, 0xD4, 0xA2, 0x3C, 0x5A, 0x04, 0xC3, 0x15, 0xBC, 0xC4, 0x17, 0xCB, 0x0E,
+    0xEB, 0x3A, 0x8E, 0xD0, 0x0E, 0xB0, 0xA5, 0x1F, 0x84, 0x2C, 0xAE, 0xAC, 0x10, 0xC4, 0xBD, 0x7D,
+    0x5C, 0xD2, 0x0F, 0x3D, 0xF6, 0xED, 0x1C, 0xDA, 0xEF, 0xB4, 0x58, 0x57, 0x0F, 0x23, 0x93, 0xB0,
+    0xA1, 0xAC, 0x37, 0xCA, 0xD4, 0x65, 0xA1, 0x4A, 0xDE, 0xA0, 0xFC, 0x05, 0x67, 0x56, 0x91, 0x3C,
+    0xD6, 0x18, 0x7E, 0x15, 0x07, 0x58, 0xC6, 0x10, 0xDA, 0x31, 0x8D, 0x48, 0x2C, 0x65, 0x8A, 0xC8,
+    0x19, 0xDA, 0x30, 0x8E, 0x09, 0xEB, 0xC4, 0x44, 0x36, 0xA2, 0xF6, 0xBA, 0xC9, 0x1A, 0x52, 0x77,
+    0x40, 0xDB, 0x37, 0xB9, 0x4B, 0x26, 0x64, 0x08, 0x57, 0xB7, 0xF8, 0xC7, 0x35, 0xAD, 0x61, 0x9E,
+    0x34, 0xA8, 0xDC, 0x06, 0x4D, 0x56, 0x55, 0xC4, 0x48, 0x3F, 0x4E, 0x9D, 0x49, 0x64, 0xF1, 0x8E,
+    0x13, 0xCA, 0x50, 0xD0, 0x43, 0xE1, 0x49, 0xDF, 0xD1, 0xF5, 0xC0, 0x73, 0xAF, 0xB8, 0x71, 0x83,
+    0x09, 0x9F, 0xC3, 0x0B, 0x58, 0x23, 0xA4, 0x21, 0xB9, 0x3C, 0x5D, 0xE7, 0x93, 0xC3, 0xB6, 0x89,
+    0x99, 0xCF, 0x1A, 0xED, 0x58, 0xA5, 0xF9, 0x5E, 0x53, 0xA4, 0xD4, 0x54, 0x29, 0xC5, 0x21, 0xFF,
+    0xBE, 0xC9, 0x7D, 0x5F, 0xA2, 0xEE, 0x2A, 0x8C, 0xC9, 0x66, 0x95, 0xE6, 0x30, 0x4C, 0x02, 0x2F,
+    0xF3, 0x50, 0x2A, 0xAC, 0x19, 0xC8, 0x7C, 0x74, 0x15, 0x37, 0x78, 0x38, 0xFD, 0xDC, 0x61, 0x9D,
+    0xE7, 0x62, 0x38, 0x78, 0xCD, 0xE1, 0x7E, 0x6A, 0x58, 0x81, 0x59, 0x96, 0x5C, 0xA7, 0x3A, 0xE2,
+    0x6C, 0xA8, 0x87, 0x88, 0x03, 0xE3, 0xD1, 0x5A, 0xC6, 0x2B, 0x6A, 0xD5, 0x94, 0xA4, 0xA0, 0x22,
+    0x15, 0x63, 0xD8, 0x30, 0xC5, 0x57, 0x01, 0x8A, 0x2C, 0xE9, 0x14, 0x40, 0xA3, 0x13, 0x84, 0xF1,
+    0x24, 0x08, 0x7F, 0xAF, 0x88, 0xE3, 0x67, 0x54, 0x54, 0xD4, 0xD5, 0x38, 0x75, 0x52, 0x6F, 0xCC,
+    0x58, 0x73, 0xC2, 0x52, 0xDC, 0x22, 0x41, 0xD9, 0x8C, 0xD5, 0x33, 0x69, 0xC3, 0x82, 0x8F, 0x92,
+    0xBB, 0xAA, 0x25, 0xE7, 0x39, 0xD4, 0xAF, 0x23, 0x34, 0x59, 0x58, 0xC5, 0x92, 0x68, 0x6D, 0x3A,
+    0x87, 0x4D, 0x31, 0xE3, 0xFB, 0x84, 0xAF, 0x8E, 0xDE, 0x6D, 0x4B, 0xA6, 0xDA, 0x33, 0x17, 0xFB,
+    0x40, 0x2A, 0xDD, 0xC5, 0x34, 0x39, 0x71, 0x26, 0xE1, 0xC5, 0x3F, 0xE3, 0xE5, 0x84, 0xA8, 0x92,
+    0x38, 0xA6, 0x8B, 0x1D, 0xEC, 0x7C, 0xD9, 0x0A, 0xDB, 0x63, 0x82, 0xBA, 0x91, 0x78, 0xC2, 0x14,
+    0x3B, 0xC6, 0xCB, 0x67, 0x67, 0x8A, 0x77, 0x4F, 0x0A, 0xD4, 0x30, 0x0F, 0x15, 0xE8, 0x89, 0xA2,
+    0x38, 0x80, 0x75, 0x14, 0x4B, 0x29, 0x80, 0x77, 0x7A, 0xB4, 0x8C, 0xD6, 0x58, 0xDF, 0xE5, 0xCD,
+    0x54, 0xCF, 0xAA, 0xC3, 0xF9, 0x19, 0xE3, 0xAD, 0x3E, 0xBA, 0xED, 0xDB, 0x83, 0xF6, 0x02, 0x63,
+    0xD4, 0x23, 0x66, 0xE7, 0xD0, 0x95, 0xB4, 0x5F, 0x27, 0x40, 0x7A, 0x09, 0x09, 0x3D, 0xDC, 0x63,
+    0x6E, 0xFA, 0xC8, 0xE6, 0xCF, 0x8B, 0x48, 0xDA, 0x43, 0xC5, 0x45, 0x05, 0x73, 0x21, 0xB7, 0xEE,
+    0xBD, 0xF4, 0xF2, 0x59, 0x39, 0xAD, 0x20, 0x7A, 0xFF, 0xD2, 0x88, 0x12, 0xEA, 0xD4, 0x44, 0x5E,
+    0x27, 0x9B, 0xA2, 0x9B, 0x92, 0x5E, 0xAB, 0x53, 0xF1, 0x5B, 0x16, 0x4D, 0x3D, 0xFA, 0x80, 0xFD,
+    0xAB, 0x3C, 0x45, 0xCF, 0x2E, 0xFE, 0x90, 0x82, 0x5A, 0xC2, 0xB8, 0x45, 0x30, 0x59, 0xB8, 0x88,
+    0xB8, 0xA4, 0xEA, 0x0B, 0xB8, 0x7B, 0x39, 0x0B, 0x97, 0x72, 0xAC, 0xBD, 0xFE, 0x20, 0xEA, 0xD4,
+    0x8E, 0x50, 0x1D, 0x3D, 0x43, 0x75, 0x81, 0x0D, 0xA0, 0xBC, 0xAE, 0x39, 0x02, 0x2E, 0xD3, 0x45,
+    0x4E, 0x17, 0xD8, 0xA7, 0xDC, 0xA8, 0xB9, 0x3F, 0xAE, 0x87, 0xD1, 0x05, 0xAC, 0x66, 0x87, 0x5E,
+    0xFB, 0x8B, 0xAB, 0xD8, 0xD0, 0x0F, 0xEB, 0xFC, 0xD3, 0xF6, 0x32, 0xAB, 0x92, 0x33, 0xF2, 0x89,
+    0x54, 0xFE, 0x93, 0x1E, 0x71, 0x56, 0x8F, 0x71, 0xA1, 0x47, 0x9E, 0xF6, 0xF3, 0x48, 0xF2, 0x57,
+    0x27, 0x54, 0xD9, 0x67, 0x78, 0xCF, 0xE1, 0x2A, 0x2C, 0x55, 0x57, 0x72, 0xBC, 0x0C, 0xD9, 0x75,
+    0x23, 0x76, 0xCB, 0xD7, 0x14, 0xE0, 0x13, 0x91, 0xB1, 0xA3, 0x8C, 0x17, 0x1A, 0x31, 0xBF, 0x07,
+    0xD8, 0xDB, 0x2C, 0xB2, 0xA1, 0x1E, 0xF4, 0x1C, 0x37, 0x7B, 0x6D, 0x0B, 0x28, 0x51, 0x68, 0xDF,
+    0x5E, 0xE7, 0x77, 0x9F, 0x2B, 0x0F, 0x79, 0x1E, 0xA3, 0xA5, 0x78, 0x06, 0xD8, 0x0C, 0x05, 0x86,
+    0x8D, 0xA9, 0x37, 0x39, 0x4F, 0xD7, 0x57, 0xD0, 0xAC, 0x1B, 0x37, 0x2A, 0xB4, 0x2F, 0x0B, 0xCE,
+    0xA1, 0xCF, 0x30, 0xD1, 0x3F, 0xBA, 0x4D, 0xBA, 0x2B, 0xDC, 0xB4, 0xE6, 0x24, 0xAD, 0x45, 0xF6,
+    0x78, 0x43, 0x9A, 0x33, 0x22, 0x90, 0x8F, 0x82, 0x64, 0x30, 0x69, 0x58, 0xA9, 0x7F, 0x86, 0x7F,
+    0x5D, 0xAC, 0xFD, 0x04, 0x9B, 0x42, 0xE0, 0x84, 0x5A, 0xCC, 0x5A, 0x26, 0xA5, 0x23, 0xB3, 0xB7,
+    0x9E, 0x29, 0x95, 0x6F, 0xD3, 0xC3, 0x8E, 0x88, 0xAA, 0xA3, 0xBE, 0xA4, 0x39, 0xE9, 0x54, 0xE6,
+    0x8C, 0x4C, 0xA8, 0x31, 0x29, 0xC9, 0x8E, 0xC5, 0x85, 0x84, 0x96, 0xE3, 0xB2, 0x95, 0xCE, 0xAC,
+    0xD9, 0xC1, 0x7C, 0x30, 0xC7, 0x4F, 0x63, 0xEC, 0x73, 0xB4, 0xB2, 0x7A, 0xCB, 0x64, 0x70, 0x0B,
+    0xDB, 0xCA, 0xAB, 0x60, 0xF9, 0xB8, 0x4D, 0xBD, 0x84, 0x8C, 0x8F, 0x46, 0x06, 0x3C, 0x5B, 0x30,
+    0xB2, 0xDE, 0x8E, 0xDF, 0x84, 0x45, 0xE3, 0x33, 0xE8, 0xC5, 0x7E, 0x4A, 0xF3, 0x33, 0x82, 0xA5,
+    0xFB, 0x7B, 0xB7, 0x52, 0xFA, 0x39, 0xA5, 0x56, 0x3F, 0x95, 0x7F, 0x75, 0xC7, 0xD9, 0xD4, 0xE5,
+    0xAD, 0x7E, 0xD0, 0x62, 0xAB, 0xC3, 0xA5, 0x0A, 0xC6, 0x7A, 0xF3, 0x6D, 0x4A, 0x3F, 0xF5, 0x53,
+    0x6C, 0xA6, 0xD3, 0x62, 0x8E, 0x6E, 0x9F, 0xE9, 0x94, 0xB7, 0xFE, 0xFA, 0xC2, 0xB2, 0xC1, 0x99,
+    0x9A, 0xF0, 0x73, 0x74, 0x85, 0x5F, 0x17, 0x77, 0x8C, 0xFD, 0x1D, 0x2C, 0xB3, 0x0F, 0x6F, 0x7B,
+    0xF5, 0x7D, 0xFB, 0x6A, 0x43, 0x9D, 0x70, 0xBC, 0x58, 0x4A, 0xEF, 0x95, 0xAB, 0x92, 0x34, 0x97,
+    0xCB, 0xE4, 0xEE, 0x31, 0x7D, 0x74, 0x6D, 0x1A, 0x25, 0xDF, 0x2A, 0x4A, 0x63, 0x55, 0x41, 0x46,
+    0x4B, 0xE5, 0x65, 0x64, 0xF7, 0xE3, 0x65, 0xDC, 0xDF, 0x4D, 0xAF, 0xCA, 0x71, 0x92, 0xF6, 0xFF,
+    0xA6, 0x14, 0x25, 0x4D, 0xAC, 0x27, 0x96, 0x91, 0x96, 0xC1, 0xBA, 0x99, 0xB1, 0xA6, 0xA4, 0x7A,
+    0xC2, 0x52, 0x17, 0x6E, 0x53, 0xE6, 0x80, 0x2F, 0x1C, 0xC1, 0x07, 0x5E, 0x7C, 0xF7, 0xBD, 0xBD,
+    0xBD, 0x9A, 0x43, 0x28, 0xE6, 0xBC, 0x30, 0xA1, 0xBE, 0xEC, 0x2D, 0x86, 0xF9, 0x93, 0xAC, 0x32,
+    0xB4, 0xFA, 0xE1, 0x36, 0xD4, 0xE1, 0x77, 0xFC, 0x4C, 0xED, 0x6F, 0xA0, 0x19, 0x2C, 0x63, 0x6B,
+    0x59, 0xD7, 0x03, 0xE3, 0x1A, 0xFC, 0x5F, 0xEB, 0x6F, 0x7D, 0x55, 0x31, 0x6F, 0xE4, 0x44, 0x18,
+    0x7D, 0xF6, 0x90, 0x18, 0x64, 0xC8, 0x50, 0x70, 0x08, 0x08, 0xC4, 0xED, 0xE9, 0x24, 0xE2, 0x86,
+    0xF2, 0x36, 0x63, 0x44, 0x41, 0x79, 0x50, 0x9C, 0xA0, 0x83, 0x82, 0x3E, 0x14, 0x08, 0xA5, 0x48,
+    0x6E, 0x0D, 0x14, 0x57, 0xB2, 0x35, 0x0D, 0x94, 0x28, 0x14, 0x50, 0x50, 0xA4, 0x60, 0xB1, 0x73,
+    0x5B, 0x5C, 0x91, 0x02, 0x0B, 0x7E, 0x00, 0x96, 0xB6, 0x40, 0x40, 0x91, 0x41, 0xF8, 0x14, 0xC3,
+    0xD9, 0x1E, 0xDE, 0x37, 0x76, 0xA2, 0x43, 0x42, 0x38, 0xD9, 0xB5, 0x3D, 0x63, 0x7F, 0xDF, 0xFB,
+    0xDE, 0x7B, 0xDF, 0xB7, 0x40, 0x91, 0x85, 0x35, 0x8A, 0x1E, 0x33, 0x24, 0xA7, 0x36, 0x2E, 0x95,
+    0x8D, 0xEF, 0x35, 0xB8, 0xB3, 0xED, 0x06, 0xC4, 0xE7, 0xCE, 0x65, 0x88, 0x9D, 0x6B, 0x10, 0x0E,
+    0x48, 0x4B, 0x14, 0x40, 0x07, 0x5D, 0x21, 0xAE, 0xC2, 0x16, 0x58, 0xC2, 0x80, 0x97, 0x91, 0x95,
+    0xD5, 0xEF, 0x01, 0x5D, 0x72, 0x8B, 0x1B, 0x1D, 0x60, 0x32, 0x5E, 0x6A, 0x0B, 0x97, 0x45, 0x3D,
+    0xB4, 0x73, 0x2E, 0xC7, 0xDC, 0x39, 0x0B, 0xE5, 0x1C, 0x77, 0x63, 0xD7, 0x03, 0x78, 0xE1, 0x57,
+    0x7E, 0x21, 0xAE, 0x55, 0xA9, 0x7E, 0x29, 0x0F, 0x70, 0xB2, 0xA3, 0xA1, 0xB7, 0x5D, 0xC5, 0x07,
+    0x2D, 0xE2, 0x07, 0xEF, 0x94, 0x41, 0x83, 0x43, 0xEC, 0x41, 0x55, 0x51, 0x49, 0x6C, 0x2D, 0xA2,
+    0x52, 0x67, 0xE8, 0x02, 0x8B, 0x24, 0x4B, 0x72, 0x26, 0x75, 0xE7, 0x3E, 0x74, 0x06, 0xC3, 0x97,
+    0x50, 0x2C, 0xF0, 0x9F, 0xC7, 0xB8, 0x1E, 0x4A, 0x5A, 0x30, 0x7D, 0xB7, 0x91, 0x01, 0x91, 0xEB,
+    0x14, 0x41, 0x47, 0xC3, 0xDB, 0x82, 0x55, 0xB5, 0x82, 0xD7, 0x9F, 0x08, 0x3A, 0x90, 0x95, 0x06,
+    0x10, 0x84, 0x03, 0xE0, 0x78, 0x32, 0x04, 0xCF, 0x13, 0xCB, 0xE1, 0x15, 0x54, 0x07, 0x53, 0x4A,
+    0x60, 0x24, 0x4C, 0x4B, 0x56, 0xB8, 0xCE, 0x32, 0xAC, 0x3F, 0x85, 0x7D, 0xDC, 0xFA, 0xAC, 0xAF,
+    0xF9, 0x7C, 0xC9, 0x5A, 0xC2, 0x30, 0x9F, 0x84, 0x41, 0x20, 0x60, 0x79, 0xCC, 0xC9, 0x86, 0x6C,
+    0xBA, 0x72, 0xDC, 0xAC, 0x3C, 0x50, 0x67, 0x1F, 0x85, 0x1D, 0xAF, 0x4A, 0xA2, 0xB1, 0xD0, 0xF9,
+    0x4D, 0x5F, 0xB8, 0xAA, 0xF8, 0x67, 0xD1, 0xB2, 0xFC, 0x3D, 0x72, 0xA1, 0xF3, 0x0E, 0xCA, 0x1E,
+    0x91, 0x78, 0x4A, 0x60, 0x44, 0x06, 0xC6, 0x0C, 0x25, 0x60, 0xC1, 0x68, 0xE9, 0x18, 0xCA, 0x22,
+    0xCA, 0xF1, 0xB2, 0x76, 0xF6, 0xDA, 0x5B, 0x25, 0x76, 0x80, 0x6F, 0xA7, 0xD8, 0xCF, 0x08, 0x96,
+    0x5A, 0x2A, 0xCA, 0xBC, 0x1E, 0x5A, 0x94, 0xF9, 0x4E, 0xE8, 0x91, 0xF7, 0xB4, 0x80, 0xBB, 0x23,
+    0xB5, 0x34, 0x72, 0x27, 0x18, 0xA5, 0x7A, 0x11, 0x5C, 0xF8, 0x81, 0x88, 0xEE, 0x59, 0x62, 0xCD,
+    0x23, 0x39, 0x08, 0xFA, 0xAB, 0xBB, 0x72, 0x4C, 0x41, 0xA5, 0xA0, 0x78, 0x4D, 0xB8, 0xCE, 0xB5,
+    0xAC, 0xB8, 0xF3, 0xAF, 0x49, 0xEC, 0xA8, 0x9A, 0x42, 0x77, 0x53, 0xAC, 0x24, 0x17, 0x17, 0x8D,
+    0xAC, 0xFB, 0xB8, 0xC5, 0x14, 0x76, 0x3A, 0xE8, 0x1E, 0x0F, 0x31, 0xB4, 0xD3, 0x0B, 0xAA, 0x9E,
+    0x10, 0x1A, 0xAE, 0x46, 0xB2, 0xBD, 0xFF, 0xDB, 0xF1, 0xC2, 0x03, 0x34, 0xD9, 0x54, 0xC5, 0xFC,
+    0x12, 0xD1, 0x20, 0x19, 0x24, 0x65, 0x77, 0x05, 0xEF, 0xF6, 0x6D, 0xB1, 0xCC, 0x16, 0xA1, 0x64,
+    0x02, 0x92, 0x1C, 0x30, 0x47, 0xBE, 0xEB, 0x51, 0xF3, 0x9E, 0x98, 0xC9, 0x30, 0x2D, 0x37, 0x2A,
+    0xE7, 0xE4, 0x01, 0x32, 0xFB, 0xF7, 0xF1, 0xF1, 0x82, 0x86, 0x14, 0xC9, 0x71, 0x49, 0x93, 0x12,
+    0x3E, 0x02, 0xCF, 0xF6, 0xF2, 0xAB, 0x85, 0x00, 0x22, 0x13, 0x49, 0x43, 0xD2, 0xE2, 0x9A, 0x31,
+    0x88, 0x84, 0x51, 0x1B, 0xC4, 0x39, 0x5F, 0xE4, 0xB3, 0xA9, 0x68, 0xC2, 0x17, 0x3B, 0x92, 0xB0,
+    0xD1, 0x93, 0x05, 0x45, 0x74, 0x5D, 0x20, 0xC0, 0x8B, 0x46, 0xB9, 0xEA, 0x45, 0xD9, 0x57, 0x39,
+    0x5E, 0xE2, 0x7D, 0xAB, 0xEA, 0x83, 0x2D, 0x7C, 0xF1, 0x7E, 0xF8, 0x71, 0xF9, 0xD4, 0x56, 0x68,
+    0x0F, 0x76, 0x85, 0x20, 0xE5, 0x72, 0x76, 0x61, 0x5A, 0x9A, 0x86, 0xFE, 0x0F, 0x7A, 0xE5, 0x84,
+    0x79, 0x6D, 0x4D, 0x2D, 0x75, 0xCF, 0x55, 0x2F, 0xFA, 0xA8, 0x76, 0xBE, 0x92, 0x88, 0xE9, 0xFD,
+    0x56, 0x6A, 0xC7, 0x50, 0xEC, 0x4B, 0xD5, 0xF1, 0xC3, 0x87, 0x1E, 0xA7, 0xB9, 0xEC, 0x84, 0xD1,
+    0x8B, 0xE9, 0x68, 0x3B, 0x3D, 0xDE, 0x8E, 0xED, 0xE9, 0x29, 0xF7, 0x24, 0xBA, 0x41, 0xAC, 0x9A,
+    0x74, 0xEE, 0x87, 0x5E, 0x2C, 0xC6, 0x0B, 0x4B, 0x97, 0xFD, 0xE8, 0xEE, 0x72, 0xD9, 0x35, 0xA6,
+    0x35, 0xFD, 0x75, 0xD3, 0x47, 0xEE, 0x23, 0x77, 0x31, 0xC9, 0xF5, 0xC1, 0xE4, 0xDE, 0x49, 0xBA,
+    0xC9, 0xD2, 0x8F, 0x01, 0xCF, 0x07, 0x5F, 0x6E, 0x66, 0x51, 0x39, 0xB0, 0x97, 0x5B, 0xF3, 0x7A,
+    0x89, 0x44, 0xAF, 0x2A, 0xA8, 0x9F, 0xD6, 0x04, 0xBC, 0xBC, 0xA8, 0x05, 0x40, 0x2D, 0x5D, 0x6A,
+    0x3D, 0x15, 0xF2, 0xE5, 0x3C, 0x0C, 0x2E, 0x0E, 0x03, 0x73, 0x0F, 0x73, 0x53, 0x06, 0x2E, 0xBD,
+    0xDF, 0x05, 0x4E, 0x5B, 0xE7, 0x8D, 0xFC, 0xA4, 0xD7, 0xE7, 0x91, 0x96, 0xD9, 0x74, 0x0B, 0x96,
+    0xD3, 0xE2, 0xC6, 0x9B, 0x52, 0xC3, 0x6C, 0xFA, 0x1C, 0x8D, 0x4E, 0x23, 0x5F, 0x29, 0x41, 0x1B,
+    0xA1, 0x44, 0xCC, 0x16, 0xD6, 0xE3, 0x47, 0xD5, 0x4F, 0xD3, 0xE3, 0xB3, 0x57, 0x8B, 0x92, 0x66,
+    0xF2, 0x3E, 0xDD, 0x96, 0x92, 0x6F, 0xF2, 0xB1, 0x03, 0x7E, 0xDE, 0x1B, 0x43, 0x9B, 0x06, 0x6F,
+    0x50, 0x94, 0x27, 0x7C, 0xD6, 0x03, 0x98, 0x0A, 0xCF, 0xF2, 0xDD, 0x6F, 0xFC, 0xBF, 0xDD, 0xFA,
+    0xBA, 0x62, 0xE8, 0xF4, 0x2F, 0x3C, 0x0E, 0xEC, 0x90, 0xC5, 0x05, 0x02, 0x0E, 0xB1, 0x6C, 0x6C,
+    0xB3, 0x56, 0x7C, 0xB7, 0x14, 0x5B, 0x1B, 0xD1, 0x2A, 0xC9, 0x85, 0xC8, 0x6A, 0x10, 0x97, 0x0E,
+    0xB2, 0x2D, 0x78, 0x7A, 0x6F, 0xF8, 0xC2, 0xAB, 0xE1, 0xB5, 0xF0, 0x4A, 0x94, 0xC2, 0x47, 0xE3,
+    0x59, 0x10, 0x29, 0xE6, 0xA4, 0x26, 0x3D, 0x1B, 0xA4, 0x07, 0x39, 0x30, 0x22, 0x6B, 0x3A, 0x5A,
+    0x3A, 0x22, 0xD6, 0x9E, 0x4A, 0xD0, 0xEE, 0x89, 0x8B, 0x44, 0xC1, 0xB0, 0xBC, 0xE2, 0xFD, 0x15,
+    0x5C, 0xDF, 0xCC, 0xD5, 0xA9, 0xC5, 0xC9, 0x0C, 0x5A, 0x67, 0xC1, 0x9F, 0x35, 0x76, 0xE9, 0x49,
+    0x46, 0x9B, 0xD3, 0x9F, 0xB4, 0x08, 0x53, 0x24, 0x05, 0xD4, 0xBA, 0xC5, 0x2C, 0xE5, 0x90, 0x75,
+    0x68, 0xE3, 0xF6, 0x5D, 0x5F, 0x25, 0xA6, 0x36, 0x16, 0x06, 0x3B, 0xE9, 0x09, 0xFA, 0xEB, 0x50,
+    0x78, 0xD3, 0x9F, 0x89, 0x5B, 0x2F, 0x2C, 0xBB, 0x2F, 0x35, 0xB4, 0xB9, 0x5A, 0xAF, 0x99, 0xEB,
+    0xE8, 0x48, 0x86, 0xFA, 0xD9, 0x28, 0x59, 0x25, 0x93, 0x8D, 0x55, 0x86, 0x7F, 0x88, 0x9A, 0x26,
+    0x2D, 0x4A, 0x44, 0xEB, 0x07, 0xDC, 0xEB, 0xCD, 0x2D, 0x0E, 0xAE, 0x95, 0x2D, 0xAA, 0xA0, 0xBD,
+    0x46, 0x18, 0x8C, 0xC9, 0x22, 0xF0, 0x1C, 0x36, 0xC0, 0xC9, 0xCF, 0x66, 0xD4, 0x59, 0xF8, 0x33,
+    0x5B, 0xF0, 0xE2, 0xD3, 0x0C, 0x1F, 0xFE, 0x9E, 0x61, 0x46, 0x4B, 0x6A, 0x62, 0x8C, 0x3F, 0x6F,
+    0xA0, 0xCE, 0xCE, 0x59, 0x00, 0x73, 0x9D, 0x34, 0x8E, 0xE2, 0x24, 0x56, 0x66, 0x88, 0x92, 0xC1,
+    0xC2, 0x26, 0x2F, 0x5C, 0x2A, 0x0D, 0xC7, 0x96, 0xD7, 0xA7, 0xC2, 0xF1, 0x8A, 0xAC, 0xA5, 0xB7,
+    0x6A, 0x19, 0x8C, 0x94, 0x72, 0x2E, 0x14, 0x7B, 0x5B, 0x0B, 0x9E, 0x40, 0x2C, 0xA5, 0xE4, 0x4A,
+    0xF9, 0x5F, 0xA2, 0x0B, 0x61, 0x74, 0xCD, 0x4C, 0xC9, 0x3D, 0x27, 0x9D, 0xC5, 0x6D, 0x93, 0x17,
+    0x42, 0x28, 0xB1, 0x15, 0xA3, 0x20, 0xCC, 0x65, 0xA5, 0x8D, 0x8D, 0xB3, 0x89, 0x8C, 0xCB, 0x9C,
+    0x13, 0xD9, 0x2F, 0xB5, 0x29, 0x0E, 0x0D, 0x89, 0x80, 0x2E, 0x84, 0xD7, 0x90, 0x61, 0x18, 0x79,
+    0x6F, 0x40, 0xB2, 0x5F, 0xE9, 0x15, 0x7F, 0x63, 0x8A, 0xD3, 0x56, 0xB7, 0x4B, 0xAE, 0xD3, 0x5C,
+    0x99, 0xF9, 0x84, 0x5D, 0x15, 0xDB, 0x1B, 0xC7, 0x85, 0x78, 0x22, 0xAE, 0x64, 0x44, 0x75, 0x32,
+    0x9A, 0x3C, 0xE0, 0xB0, 0x11, 0x9C, 0x1E, 0x71, 0x24, 0x18, 0x47, 0xC8, 0xDE, 0x0B, 0x1E, 0x33,
+    0xB3, 0x63, 0x02, 0x8D, 0x62, 0x5E, 0x4F, 0xA8, 0x83, 0x2E, 0xED, 0x30, 0xC2, 0x56, 0x6D, 0xCC,
+    0x05, 0x8F, 0x3B, 0xB6, 0xE1, 0xBF, 0x7F, 0x4D, 0xFE, 0xE7, 0xF8, 0x07, 0xAD, 0x55, 0xB1, 0x6E,
+    0xE4, 0x54, 0x14, 0x3D, 0x7E, 0x26, 0x58, 0xC8, 0x48, 0xAF, 0x64, 0x05, 0x48, 0xEE, 0x50, 0x0A,
+    0x88, 0x1B, 0x8A, 0x2D, 0xB2, 0x63, 0x53, 0x51, 0x02, 0x05, 0x15, 0x3F, 0x80, 0x52, 0x50, 0x51,
+    0xA4, 0xC8, 0xEC, 0xB8, 0xA3, 0xDD, 0x82, 0x8A, 0x6A, 0x45, 0xB5, 0x9A, 0x26, 0x5B, 0xA4, 0xDC,
+    0x8D, 0x9F, 0x44, 0xB9, 0x8D, 0xB5, 0x88, 0xDE, 0x12, 0x08, 0x21, 0x28, 0xB0, 0x84, 0x57, 0x58,
+    0x91, 0x67, 0x1E, 0xE7, 0x5C, 0x4F, 0x82, 0xE8, 0x71, 0xC6, 0xCF, 0xD2, 0xB5, 0xDF, 0xBD, 0xE7,
+    0xDC, 0x73, 0xDE, 0xCD, 0xD9, 0x36, 0xF9, 0x3E, 0xCE, 0x05, 0x5C, 0x3F, 0xC2, 0x7F, 0x52, 0xE3,
+    0x74, 0x82, 0xFB, 0xA3, 0x81, 0x9F, 0x81, 0x4D, 0x80, 0xDB, 0x03, 0x7E, 0x07, 0xAC, 0x67, 0xB8,
+    0x9F, 0x27, 0xF8, 0x8F, 0x47, 0x5C, 0xF8, 0xC1, 0x0D, 0xE5, 0x80, 0xC3, 0x55, 0xD6, 0xC8, 0x3B,
+    0xF0, 0xEB, 0x0A, 0xE9, 0x80, 0x64, 0x46, 0xD1, 0x20, 0xEF, 0xC1, 0x3D, 0x55, 0xCD, 0x00, 0xDF,
+    0x14, 0x01, 0xF9, 0x80, 0x96, 0x81, 0x26, 0x9D, 0xC0, 0x37, 0xBE, 0x43, 0x66, 0x81, 0x32, 0xA4,
+    0x91, 0x17, 0x3C, 0x97, 0x09, 0x1B, 0xAE, 0x9D, 0x5B, 0x02, 0x37, 0xDB, 0xCB, 0x19, 0x9B, 0x06,
+    0x65, 0xEF, 0x98, 0x29, 0xD6, 0x7E, 0x40, 0x3A, 0xA3, 0x0A, 0x28, 0x86, 0xCF, 0x22, 0xD0, 0xFE,
+    0x10, 0x54, 0xDB, 0x1B, 0x82, 0x73, 0x2D, 0xAE, 0xC3, 0x63, 0x1C, 0x63, 0xC0, 0x69, 0x32, 0xE0,
+    0xDC, 0xF5, 0x18, 0xD3, 0x8E, 0x77, 0x48, 0x86, 0x3C, 0xB8, 0xC1, 0x37, 0x69, 0xCF, 0x22, 0x5D,
+    0x11, 0x63, 0x28, 0x79, 0x57, 0x44, 0xF9, 0x10, 0x45, 0xFD, 0x9C, 0xF0, 0x99, 0xF6, 0x5D, 0x26,
+    0x38, 0xE6, 0xFD, 0xE1, 0x2D, 0x29, 0x92, 0x11, 0xA8, 0xDE, 0x78, 0x11, 0x4F, 0xD6, 0xB3, 0x13,
+    0xDB, 0x27, 0x22, 0x4B, 0xF0, 0x58, 0xE8, 0x42, 0x2C, 0x48, 0x58, 0x3C, 0x44, 0x19, 0xD8, 0x8B,
+    0x34, 0x90, 0x8E, 0x4B, 0x78, 0x21, 0x4E, 0xF8, 0x10, 0x72, 0x88, 0xEB, 0x5E, 0x61, 0x3E, 0x47,
+    0x3E, 0x5B, 0x3E, 0x0F, 0xE1, 0xA8, 0x30, 0x39, 0x4F, 0x0A, 0xD7, 0xA8, 0x58, 0x83, 0x74, 0xB5,
+    0x11, 0x64, 0x9E, 0x29, 0x19, 0xC5, 0x28, 0x59, 0x43, 0x82, 0xC4, 0x46, 0x10, 0xBF, 0x46, 0x19,
+    0x83, 0xE7, 0xF6, 0x99, 0xAC, 0x2F, 0xB8, 0x1F, 0x79, 0x83, 0x94, 0xC4, 0x81, 0x07, 0xEA, 0x4C,
+    0x46, 0xEE, 0xC0, 0xB3, 0x3B, 0x2A, 0x88, 0x91, 0xAD, 0x14, 0x7B, 0x0A, 0x25, 0x7C, 0x2B, 0x49,
+    0x95, 0x75, 0x8E, 0x1B, 0x9E, 0x1B, 0x9D, 0x3B, 0xF2, 0x31, 0x72, 0x67, 0xB2, 0xC0, 0xCB, 0x7F,
+    0xFA, 0xFC, 0x1A, 0xFA, 0xD8, 0x09, 0xDC, 0x68, 0xFC, 0xB3, 0x0E, 0x1B, 0xD1, 0x86, 0x9B, 0xAD,
+    0x19, 0x9E, 0xD9, 0x59, 0xB9, 0xFA, 0xEE, 0x17, 0xF6, 0x94, 0xFB, 0x66, 0x96, 0xCD, 0x77, 0x1F,
+    0x4D, 0xD4, 0xBF, 0xB2, 0xEE, 0x53, 0xF4, 0x2C, 0xAC, 0xD5, 0xAF, 0xC2, 0x0D, 0x28, 0x1B, 0x9A,
+    0x28, 0x30, 0xE6, 0x7A, 0x33, 0x4D, 0x91, 0x4C, 0xEC, 0xD5, 0xEB, 0x13, 0x7D, 0x74, 0x0D, 0x89,
+    0x93, 0x8E, 0x32, 0xCA, 0xD9, 0x76, 0x5B, 0x0B, 0x75, 0xAC, 0x55, 0xB7, 0x20, 0xF7, 0x41, 0x30,
+    0xB9, 0x61, 0x65, 0xE5, 0xD6, 0x06, 0xE4, 0x19, 0x21, 0x06, 0x09, 0xC2, 0x8C, 0xDC, 0xE4, 0x9B,
+    0x84, 0x7C, 0x0A, 0xB3, 0x5E, 0x89, 0xF4, 0x26, 0xD6, 0x15, 0x32, 0xD2, 0x5F, 0x21, 0x1F, 0xB9,
+    0x5F, 0xF0, 0x47, 0x7D, 0xA5, 0xB5, 0x50, 0x5E, 0x7E, 0xC5, 0xFE, 0x89, 0x1F, 0xD7, 0xB5, 0x32,
+    0x32, 0xA5, 0x88, 0xCF, 0x89, 0xDA, 0xFF, 0x24, 0xF9, 0xF4, 0xAE, 0x2F, 0xEF, 0x48, 0xFA, 0x44,
+    0xEF, 0x90, 0xDB, 0x2A, 0x41, 0xA0, 0x56, 0x7C, 0xD5, 0x10, 0x41, 0x16, 0x55, 0xA1, 0xAA, 0x27,
+    0x62, 0x9B, 0x70, 0x4A, 0xDF, 0xF5, 0x38, 0xF5, 0x4D, 0x16, 0x70, 0x55, 0xD4, 0x79, 0x93, 0x0C,
+    0x25, 0x65, 0xC9, 0x88, 0xA4, 0x20, 0xDB, 0x15, 0xEB, 0x6E, 0xF8, 0x57, 0xD2, 0xDF, 0x15, 0xCA,
+    0xCB, 0xF1, 0xB8, 0xEA, 0xCA, 0xF8, 0xEB, 0x5C, 0xCA, 0x0D, 0xB3, 0x0E, 0x44, 0xEC, 0x5D, 0xDC,
+    0xB7, 0x94, 0xEC, 0xA8, 0xB6, 0xEA, 0x5F, 0xCA, 0x70, 0x66, 0xAB, 0xDF, 0xB8, 0x3C, 0x54, 0x78,
+    0x44, 0x3B, 0xB8, 0x3E, 0xED, 0xCE, 0x53, 0x1A, 0xE1, 0x7E, 0xDE, 0xBC, 0x8F, 0xFB, 0x7C, 0xE2,
+    0x69, 0x81, 0x2B, 0xD7, 0x9F, 0x80, 0xD6, 0x3F, 0xC1, 0xC8, 0xEC, 0xB8, 0xD9, 0xDD, 0x2B, 0x43,
+    0xDC, 0x5B, 0xDE, 0x29, 0xB3, 0x96, 0x9E, 0xD5, 0xFF, 0x0A, 0x9E, 0xB4, 0xEC, 0x9C, 0x93, 0xDC,
+    0xCE, 0xAC, 0x19, 0x45, 0x54, 0x26, 0x94, 0xFB, 0x16, 0x2B, 0x1A, 0x4D, 0x2C, 0xEE, 0x37, 0xD5,
+    0xCD, 0xE9, 0x52, 0x54, 0x96, 0xB5, 0x57, 0xF2, 0xB4, 0x75, 0x8E, 0x7E, 0xFB, 0xF6, 0xAD, 0x00,
+    0x3B, 0xD4, 0xB9, 0x15, 0x33, 0x47, 0x25, 0xE6, 0x73, 0x56, 0x78, 0xC4, 0x4F, 0xDE, 0x33, 0x0F,
+    0xBF, 0xA9, 0xE5, 0x8B, 0xE6, 0x36, 0xB1, 0x41, 0x21, 0xED, 0x29, 0xDD, 0xBD, 0x26, 0xBB, 0xF1,
+    0x77, 0x21, 0x69, 0xE0, 0x6B, 0x09, 0x43, 0x9B, 0x68, 0x26, 0xF8, 0x38, 0x30, 0x15, 0x33, 0xD3,
+    0xEE, 0xCC, 0x17, 0x74, 0xB8, 0x8E, 0xCC, 0xB5, 0xF1, 0x95, 0xFA, 0xF6, 0x22, 0xB6, 0xBF, 0xEF,
+    0xA5, 0xA2, 0x79, 0xC5, 0xC4, 0x06, 0xE4, 0xE1, 0x54, 0x08, 0x7D, 0x38, 0x00, 0x96, 0xC5, 0x96,
+    0xB2, 0x9B, 0x5B, 0x8E, 0xF2, 0x31, 0x36, 0xF5, 0x81, 0xA1, 0x71, 0x67, 0x3D, 0x42, 0xAE, 0x97,
+    0x29, 0x68, 0x4E, 0x41, 0xAA, 0x7C, 0x47, 0xCB, 0x39, 0xB9, 0xE4, 0x50, 0x49, 0x83, 0xC5, 0x39,
+    0x86, 0x3E, 0x58, 0x90, 0x06, 0xF3, 0xD2, 0xA4, 0x73, 0x28, 0x77, 0xB1, 0x22, 0x1D, 0xA1, 0x13,
+    0x97, 0x91, 0x5F, 0x6D, 0xA3, 0x23, 0xFF, 0x91, 0x33, 0x62, 0xE2, 0x41, 0xD8, 0x30, 0xEE, 0x43,
+    0x11, 0x88, 0x6D, 0xC7, 0xF9, 0xE1, 0x07, 0xCE, 0x92, 0x96, 0x5D, 0xCD, 0x5E, 0x69, 0x82, 0x8A,
+    0xA2, 0xCE, 0x62, 0x35, 0x1F, 0x50, 0x14, 0xFD, 0x01, 0x9C, 0x06, 0x4A, 0x2E, 0x06, 0x8A, 0x6A,
+    0x1A, 0xA7, 0x72, 0xEB, 0x46, 0x04, 0x2E, 0xE0, 0xBF, 0xE1, 0xD9, 0x5F, 0x63, 0x95, 0x75, 0x79,
+    0x78, 0x90, 0x8C, 0x29, 0x3D, 0xB7, 0xCA, 0x43, 0xCA, 0x09, 0x5F, 0xF1, 0x70, 0xFD, 0xCD, 0x49,
+    0xC2, 0x21, 0xCF, 0xEF, 0x8B, 0xCE, 0x92, 0x55, 0x8D, 0x35, 0x8A, 0x6D, 0xD0, 0x14, 0x23, 0x5C,
+    0x37, 0x52, 0xDC, 0xA2, 0xB9, 0x26, 0x68, 0x83, 0xC7, 0xB7, 0x9C, 0xDA, 0x3D, 0xDB, 0x53, 0x05,
+    0xB6, 0xAE, 0xE5, 0x54, 0x4B, 0x76, 0xEC, 0x53, 0x1A, 0x75, 0xE2, 0x24, 0xB9, 0x00, 0x96, 0x52,
+    0x5A, 0x87, 0xDF, 0x5D, 0xDE, 0x3C, 0x5A, 0x10, 0x6A, 0x5A, 0x2D, 0xC6, 0x68, 0xC3, 0x01, 0x62,
+    0x21, 0xD0, 0x78, 0x1B, 0xEE, 0x31, 0x81, 0x72, 0x5A, 0x8C, 0x6C, 0x94, 0x70, 0xB2, 0x73, 0x6C,
+    0xD7, 0x4A, 0x40, 0xA6, 0x42, 0xE7, 0x5B, 0xA9, 0x5F, 0x28, 0xF5, 0x5A, 0xDB, 0xC5, 0x3B, 0xDA,
+    0xEC, 0x9C, 0x35, 0x38, 0x07, 0xB7, 0x8D, 0x9C, 0x0E, 0xA6, 0x68, 0x71, 0xAB, 0xE8, 0x7F, 0x2E,
+    0xCA, 0xCF, 0xF1, 0xB6, 0xFC, 0x34, 0x63, 0x82, 0x3C, 0xA0, 0xB5, 0x08, 0x5A, 0xD3, 0x71, 0xD9,
+    0x66, 0x76, 0xF0, 0x7F, 0xCA, 0x06, 0xA9, 0xD9, 0xDE, 0x4A, 0xF1, 0x2B, 0x33, 0xB6, 0x37, 0xA7,
+    0x7B, 0xF5, 0x58, 0xB6, 0xD3, 0xFA, 0xD7, 0xCE, 0xAC, 0xC1, 0x71, 0x4C, 0x62, 0xB2, 0x88, 0x1F,
+    0xED, 0x9F, 0xE4, 0xA8, 0x09, 0xED, 0xA7, 0xC3, 0xCF, 0x45, 0x73, 0x09, 0x92, 0xC5, 0xD6, 0x4F,
+    0x6D, 0x3D, 0x05, 0xDE, 0x40, 0xD2, 0xD0, 0x2C, 0x57, 0xC8, 0x6B, 0x9A, 0xE5, 0x42, 0x13, 0xFB,
+    0x25, 0xEB, 0x9D, 0x3C, 0xD3, 0x60, 0x39, 0xB8, 0xD3, 0xF4, 0x6D, 0xB9, 0xB1, 0x94, 0x22, 0x2F,
+    0x47, 0x4E, 0x5E, 0x86, 0xAF, 0x29, 0x41, 0xD9, 0xE4, 0xBD, 0xF0, 0xDE, 0x13, 0xDA, 0x1A, 0xFF,
+    0xCB, 0xF5, 0x0F, 0xBD, 0x55, 0xBF, 0x6F, 0x1D, 0x45, 0x10, 0xFE, 0xEE, 0x36, 0xE4, 0x40, 0xA7,
+    0x78, 0xD3, 0xA4, 0x08, 0x21, 0xBE, 0x94, 0x29, 0x6C, 0x5F, 0x93, 0x22, 0xC5, 0xB3, 0x6F, 0x81,
+    0x82, 0x22, 0x05, 0x29, 0xEC, 0x2A, 0x0D, 0x05, 0x0D, 0x05, 0x82, 0x82, 0x22, 0xC5, 0xB3, 0xEF,
+    0x10, 0x45, 0xCA, 0x18, 0x89, 0xBF, 0x00, 0xD1, 0x10, 0x8A, 0xB8, 0xB0, 0x84, 0x8B, 0x67, 0xDF,
+    0x22, 0x0A, 0x0A, 0x9A, 0x13, 0x94, 0x14, 0x39, 0x89, 0x48, 0x54, 0x28, 0xAB, 0xE4, 0x88, 0xEE,
+    0x85, 0x7B, 0x6F, 0xF9, 0x66, 0xCF, 0x46, 0x11, 0x12, 0xA2, 0x63, 0xA5, 0xB9, 0xF7, 0xF6, 0xD7,
+    0xCC, 0x37, 0x33, 0xDF, 0xCC, 0x96, 0xDE, 0x9B, 0x2F, 0xBD, 0x5F, 0x24, 0x56, 0x39, 0x6C, 0x40,
+    0x57, 0xE8, 0xB0, 0x0B, 0x65, 0x63, 0x87, 0x0C, 0xDA, 0xE2, 0x08, 0x5B, 0x50, 0x4D, 0xD4, 0x41,
+    0x23, 0xB5, 0x98, 0x72, 0x16, 0xB7, 0x3C, 0xA2, 0x4D, 0x62, 0x31, 0x41, 0x8E, 0xC8, 0x61, 0xB1,
+    0x73, 0xE7, 0x0B, 0xE5, 0xBD, 0xEF, 0x72, 0x7E, 0x2C, 0x65, 0x09, 0x8E, 0x8E, 0xC2, 0x33, 0xE0,
+    0x19, 0x8E, 0x9E, 0x12, 0x19, 0x5C, 0xDA, 0x31, 0x89, 0x5F, 0x5C, 0x80, 0x8B, 0xAC, 0xC6, 0x5A,
+    0xD4, 0xAA, 0x6A, 0x1D, 0x37, 0x94, 0x4D, 0x71, 0x13, 0x6D, 0x62, 0x2E, 0xE0, 0x80, 0xEB, 0x3B,
+    0x1F, 0xBE, 0xE9, 0xFD, 0x40, 0x5D, 0x15, 0x70, 0x08, 0xDA, 0x05, 0x1C, 0xC6, 0xEB, 0x1F, 0x24,
+    0x0D, 0x8E, 0x09, 0x63, 0x20, 0xCC, 0x5E, 0x1B, 0x74, 0x9A, 0xF6, 0x57, 0xA1, 0xDC, 0x3A, 0x92,
+    0x76, 0x1D, 0xBA, 0xD9, 0x40, 0x69, 0x33, 0xDE, 0x4C, 0xFC, 0x43, 0x33, 0x5A, 0x2E, 0x28, 0x5B,
+    0x94, 0x5D, 0xCA, 0x94, 0x72, 0x44, 0x79, 0xDE, 0x02, 0xCF, 0x9A, 0x11, 0x1E, 0xB5, 0x89, 0xD3,
+    0x61, 0x9C, 0xD3, 0xD8, 0xD4, 0x98, 0xAC, 0xE0, 0xE6, 0x1B, 0xF8, 0x64, 0x0D, 0xEE, 0x7A, 0xE4,
+    0xD6, 0xEF, 0xB4, 0xFA, 0x4F, 0xCB, 0x78, 0x40, 0x55, 0x48, 0x0C, 0x52, 0x9E, 0x3E, 0xC0, 0x6B,
+    0x04, 0xD4, 0x22, 0x6A, 0x30, 0xFA, 0x98, 0xA7, 0x15, 0xB6, 0x08, 0x67, 0x37, 0x03, 0x66, 0x34,
+    0xDA, 0x6F, 0x22, 0xEA, 0xA6, 0x84, 0x35, 0x5D, 0x49, 0xDC, 0xEC, 0xAA, 0x6E, 0x8F, 0x37, 0xEB,
+    0xA6, 0x64, 0x6C, 0x0A, 0xFF, 0xC4, 0xA6, 0xCB, 0xAC, 0x82, 0x2B, 0x0C, 0x05, 0x51, 0x5B, 0x22,
+    0x6E, 0x24, 0x5C, 0x8B, 0xA0, 0x0A, 0x2B, 0x29, 0xAE, 0xAE, 0x60, 0xED, 0x2A, 0x26, 0x6B, 0x17,
+    0x0F, 0x27, 0x1F, 0xBB, 0xC9, 0xB7, 0xAE, 0xF0, 0x6D, 0xFA, 0xBC, 0x89, 0xBE, 0xB7, 0xF1, 0x3D,
+    0x1B, 0xDF, 0xAA, 0x24, 0x0C, 0xA0, 0xBD, 0x00, 0x9A, 0x36, 0x99, 0xA5, 0xD1, 0x51, 0x71, 0x72,
+    0x93, 0x32, 0x13, 0x6D, 0xDF, 0xEC, 0x83, 0x31, 0x8C, 0xBC, 0x99, 0xC6, 0x3D, 0x26, 0xCC, 0xEC,
+    0x44, 0x35, 0x98, 0x10, 0xEA, 0x54, 0x52, 0x2A, 0x49, 0xCE, 0x4C, 0xD4, 0xE5, 0x26, 0x26, 0x08,
+    0xEE, 0x72, 0x53, 0x5C, 0x1C, 0xF5, 0x9A, 0x31, 0xE6, 0x1B, 0xA7, 0xFA, 0x26, 0x97, 0x0D, 0x4E,
+    0xBC, 0xA3, 0xBE, 0x9E, 0xFA, 0x86, 0x78, 0xC0, 0x94, 0x37, 0xEE, 0x26, 0x2D, 0x8E, 0x18, 0xBB,
+    0x8E, 0xFA, 0x5C, 0x56, 0xC5, 0x2E, 0x37, 0xAA, 0x2D, 0x98, 0x85, 0x92, 0x59, 0xA8, 0x49, 0x9C,
+    0xDB, 0x48, 0xE6, 0xC4, 0x52, 0x7B, 0x7B, 0xAC, 0x96, 0x6F, 0xB9, 0xF2, 0x49, 0x83, 0xA3, 0x2B,
+    0x7E, 0xCE, 0x1C, 0x78, 0xFF, 0x62, 0x16, 0xCD, 0x6B, 0x3F, 0x08, 0x67, 0x86, 0xC4, 0x2F, 0xBF,
+    0xDE, 0xD6, 0xC2, 0x93, 0xF1, 0x23, 0x31, 0xD5, 0x92, 0x6F, 0xBD, 0x34, 0xE7, 0xAB, 0x94, 0x47,
+    0x8C, 0x9C, 0x03, 0xC2, 0xE7, 0x8A, 0x6F, 0x71, 0x3A, 0xB6, 0x35, 0xBC, 0xEB, 0xF7, 0xE2, 0x1F,
+    0xFC, 0xFE, 0x85, 0xC4, 0xCF, 0xDB, 0x13, 0xBF, 0xD4, 0xDE, 0x7F, 0xDE, 0x06, 0xE4, 0x64, 0x2F,
+    0xF2, 0xE6, 0x3C, 0x2F, 0xB5, 0xE4, 0x1B, 0xD2, 0xA5, 0xB9, 0x8D, 0x74, 0x8E, 0x81, 0x78, 0xAA,
+    0x21, 0x39, 0xC5, 0x73, 0x98, 0x11, 0xCF, 0x5D, 0x9E, 0x99, 0xCF, 0xE2, 0x3F, 0xCE, 0xF0, 0xD0,
+    0xE2, 0x83, 0x97, 0xF0, 0x64, 0xE1, 0x9F, 0x18, 0xD5, 0x0B, 0x9C, 0x37, 0xFF, 0xC4, 0x93, 0xF9,
+    0xC7, 0xDC, 0x5A, 0x15, 0x3C, 0x6B, 0xF2, 0x99, 0xE0, 0x6F, 0x78, 0xCA, 0xE6, 0x83, 0xBE, 0xF7,
+    0x78, 0x8D, 0x7E, 0xDC, 0x50, 0xC4, 0x97, 0xD1, 0x34, 0x4D, 0x09, 0xE7, 0x36, 0xC6, 0x34, 0xC5,
+    0x0B, 0xBC, 0x47, 0x5D, 0x96, 0x21, 0x40, 0xEC, 0xF7, 0x81, 0x1B, 0x5C, 0xB7, 0xE3, 0x75, 0xDD,
+    0x44, 0x03, 0x72, 0xCB, 0xEC, 0x15, 0x86, 0xE1, 0x2E, 0x91, 0xB6, 0x44, 0x9F, 0x9D, 0x2E, 0x74,
+    0xB2, 0xE0, 0xB0, 0x44, 0xD6, 0x50, 0x49, 0x61, 0x13, 0x3A, 0x16, 0x38, 0xFC, 0x2A, 0xCE, 0x85,
+    0x52, 0xB1, 0x71, 0xD0, 0x93, 0x05, 0xBA, 0x13, 0x6B, 0xA8, 0x48, 0x24, 0xDE, 0x84, 0xDF, 0x08,
+    0xFF, 0x3E, 0x4A, 0x14, 0x9D, 0xEA, 0xA1, 0x7A, 0xE5, 0x51, 0x33, 0x88, 0xB6, 0x74, 0x39, 0x75,
+    0x2D, 0x93, 0x45, 0xC2, 0x98, 0xA6, 0xAE, 0xFC, 0x4E, 0xA8, 0x5A, 0xDC, 0x1A, 0x4A, 0xEA, 0x52,
+    0x43, 0xFD, 0xAE, 0xC4, 0x26, 0x7B, 0xF4, 0x4C, 0x0A, 0x1C, 0xCB, 0xD1, 0x50, 0x42, 0xA7, 0xE4,
+    0xB7, 0xF0, 0xA1, 0x70, 0xD5, 0xA9, 0x79, 0x3F, 0x4E, 0xCB, 0x71, 0x37, 0x1B, 0xFB, 0x44, 0xBA,
+    0xF4, 0x35, 0x5B, 0x45, 0xEC, 0x1F, 0xCD, 0x65, 0xD9, 0x3F, 0xF5, 0xF7, 0xB9, 0x5C, 0x0C, 0x45,
+    0xC7, 0x65, 0xED, 0x13, 0xFF, 0xB6, 0x04, 0xC8, 0xD6, 0x6C, 0x2E, 0x72, 0xF9, 0x1A, 0x2E, 0x8A,
+    0x03, 0x4D, 0xF0, 0x2F, 0xB1, 0x1B, 0x21, 0x56, 0x23, 0x29, 0xB2, 0xC5, 0x7F, 0x3A, 0x27, 0x23,
+    0x37, 0xBE, 0x3A, 0xA1, 0x05, 0xB5, 0x20, 0x85, 0xD9, 0x49, 0xDC, 0x1E, 0xEF, 0xF4, 0xE5, 0x3B,
+    0x9C, 0xA8, 0xA7, 0xC3, 0x9E, 0x40, 0xFA, 0xE5, 0xB7, 0xE0, 0x54, 0x7D, 0x32, 0x3A, 0x11, 0xB4,
+    0xD7, 0xCB, 0xD1, 0x95, 0x7E, 0x74, 0xA1, 0x1B, 0xDD, 0x14, 0x87, 0xEA, 0x5A, 0x4E, 0xE8, 0xF9,
+    0xB2, 0xB4, 0x88, 0xFC, 0xFD, 0x9E, 0x6E, 0x64, 0x7D, 0xF9, 0x93, 0xAF, 0x62, 0xFF, 0x99, 0x57,
+    0xFE, 0xCC, 0xEE, 0x26, 0xF3, 0xA7, 0x2C, 0xEB, 0x7E, 0x9A, 0x36, 0xD0, 0x9F, 0x52, 0x41, 0x47,
+    0x63, 0x39, 0x6B, 0x51, 0xFD, 0x4A, 0x35, 0xBB, 0x03, 0x0D, 0x3F, 0x91, 0x28, 0x35, 0x12, 0x9B,
+    0x0E, 0x71, 0xF7, 0x91, 0x63, 0xF7, 0xCA, 0xAB, 0x44, 0x32, 0x4F, 0x0E, 0x5B, 0x12, 0x72, 0x16,
+    0xF5, 0xE4, 0x65, 0x61, 0x22, 0x81, 0x51, 0x48, 0x27, 0xA0, 0xE9, 0x2B, 0x83, 0x60, 0x11, 0x24,
+    0xE4, 0xC0, 0x2B, 0x92, 0xE2, 0x6B, 0x97, 0x71, 0x30, 0x45, 0xEB, 0xF0, 0xB3, 0x8D, 0x7F, 0x34,
+    0xEA, 0x77, 0x24, 0x9D, 0xD0, 0x5F, 0xA7, 0xCD, 0x2A, 0xD8, 0x2B, 0xDD, 0x04, 0x6E, 0x8A, 0x50,
+    0xF6, 0xE4, 0x37, 0x1D, 0xFB, 0x8A, 0x77, 0x2E, 0xED, 0x6C, 0xD3, 0x3D, 0x7A, 0xA4, 0xA5, 0xF3,
+    0xEE, 0x91, 0xA0, 0x71, 0x47, 0xE6, 0x69, 0x4B, 0x84, 0x5B, 0x6C, 0x9F, 0x67, 0x33, 0xCB, 0xD9,
+    0x1E, 0x67, 0x71, 0x77, 0x36, 0x2B, 0x5F, 0x9A, 0xED, 0x41, 0x1A, 0x4A, 0xEC, 0x1B, 0x6F, 0x99,
+    0xBC, 0x81, 0x64, 0x12, 0xA0, 0x4C, 0x56, 0xB4, 0x38, 0x2B, 0xA4, 0xFA, 0x34, 0x20, 0xAF, 0x3F,
+    0x60, 0x39, 0xB5, 0xCA, 0x1E, 0x44, 0xC4, 0x73, 0xB8, 0x8A, 0x49, 0x6A, 0x56, 0xF9, 0x14, 0x18,
+    0xA7, 0xEC, 0x51, 0xD4, 0x6E, 0x4A, 0x73, 0x9F, 0x25, 0xFD, 0x31, 0x1B, 0x8E, 0xF4, 0xB6, 0x6C,
+    0xEC, 0x4C, 0x61, 0x14, 0xA1, 0x38, 0x07, 0x21, 0x2B, 0x83, 0xC3, 0x92, 0xC8, 0x8D, 0x34, 0x8E,
+    0x41, 0x76, 0xC8, 0xD2, 0x50, 0x39, 0x62, 0x4B, 0x88, 0x24, 0xC5, 0x12, 0x49, 0xE5, 0x48, 0xC1,
+    0x78, 0xC1, 0xA2, 0xC2, 0x0B, 0x95, 0xC9, 0x83, 0xC5, 0x76, 0x40, 0x32, 0xCA, 0x82, 0x47, 0xF6,
+    0xE2, 0xC1, 0xC3, 0x1E, 0xB5, 0x41, 0xD1, 0x28, 0x6A, 0xF2, 0xD2, 0x85, 0x92, 0x25, 0xDF, 0x13,
+    0xE4, 0x43, 0x4C, 0x4D, 0x23, 0x0D, 0x42, 0x05, 0xE9, 0x21, 0xB0, 0x2E, 0x24, 0x5F, 0x16, 0x54,
+    0xA0, 0x43, 0xB4, 0xCD, 0xCF, 0xFB, 0xB8, 0xCE, 0xC0, 0x32, 0xBE, 0x98, 0xF2, 0x65, 0x3C, 0x92,
+    0xB7, 0x92, 0x51, 0x76, 0x09, 0xDF, 0xD3, 0x94, 0x2F, 0x2C, 0x63, 0xDB, 0x52, 0x9A, 0x5C, 0x1E,
+    0x03, 0x82, 0xDA, 0x42, 0x56, 0xED, 0x12, 0xED, 0x71, 0x88, 0x11, 0x41, 0x46, 0x65, 0x15, 0x72,
+    0xC9, 0x6C, 0xFD, 0x3F, 0xE3, 0x2F, 0x7D, 0x55, 0x3D, 0x70, 0xDD, 0x44, 0x10, 0xFE, 0xA4, 0x2B,
+    0x54, 0xDC, 0x8C, 0x45, 0x41, 0xAA, 0xC4, 0x51, 0xCD, 0x8C, 0x1D, 0x35, 0x14, 0x66, 0x26, 0x7E,
+    0xBA, 0x99, 0x14, 0x14, 0x14, 0x34, 0x3C, 0x53, 0xD2, 0xD0, 0xC0, 0x0C, 0x63, 0x4A, 0x0A, 0x63,
+    0x69, 0x42, 0x41, 0x19, 0x1A, 0x0F, 0x2D, 0x05, 0x0D, 0x34, 0x4E, 0xE9, 0xC2, 0x8E, 0xAE, 0x73,
+    0x41, 0x11, 0x51, 0x30, 0x94, 0x4F, 0x24, 0x5D, 0x5C, 0xE4, 0x0A, 0x31, 0xC8, 0xA0, 0xA7, 0xE3,
+    0xDB, 0x93, 0x6C, 0xC2, 0xE4, 0x47, 0xEF, 0xE9, 0x74, 0x27, 0xE9, 0x76, 0xBF, 0xFD, 0xF6, 0xDB,
+    0x15, 0x10, 0x8E, 0x02, 0x48, 0x2D, 0x06, 0xA0, 0x44, 0xD2, 0x22, 0xEE, 0x91, 0x1B, 0xA4, 0x8D,
+    0xDC, 0x28, 0x90, 0x38, 0x44, 0x03, 0x72, 0x8B, 0xB4, 0xC5, 0xC8, 0x1B, 0x46, 0x75, 0x72, 0x23,
+    0xB3, 0xD0, 0x0E, 0x9E, 0x37, 0xAC, 0xF2, 0xDE, 0x8F, 0xC8, 0x38, 0x76, 0xA8, 0x39, 0x86, 0x1B,
+    0x1E, 0xD9, 0xDF, 0x3F, 0x1F, 0xF7, 0xA8, 0x0D, 0x8A, 0x46, 0xD1, 0x92, 0x47, 0xEA, 0x90, 0x0C,
+    0x28, 0x2D, 0xF2, 0x36, 0xA6, 0x25, 0x5F, 0x89, 0x6B, 0x2F, 0x43, 0xD2, 0xCB, 0x48, 0x1F, 0x3C,
+    0x46, 0x19, 0x68, 0x5A, 0x60, 0xC9, 0x1B, 0xB2, 0x17, 0x9F, 0xE2, 0x1D, 0x74, 0xB8, 0x0B, 0x87,
+    0x83, 0xC8, 0xE1, 0x24, 0x6E, 0xD1, 0xA9, 0x06, 0x5D, 0x62, 0x23, 0xA7, 0xAD, 0x72, 0xA9, 0xF7,
+    0x2D, 0xCF, 0x86, 0x18, 0x6C, 0x61, 0x32, 0xBB, 0x40, 0x56, 0x1D, 0x32, 0x88, 0x33, 0x89, 0x0C,
+    0x29, 0xCD, 0xE4, 0xBC, 0x2E, 0x78, 0x9E, 0xF2, 0x24, 0x7E, 0x83, 0xCF, 0x92, 0x06, 0x67, 0x9A,
+    0x41, 0xF3, 0x69, 0x9F, 0x1A, 0x74, 0x29, 0x22, 0x77, 0x1B, 0xCA, 0x6D, 0x93, 0x82, 0x6D, 0x46,
+    0x7F, 0x87, 0x48, 0xC5, 0x5E, 0xE2, 0x8F, 0xCD, 0xB4, 0xBF, 0x98, 0x6D, 0xEC, 0xF2, 0x3C, 0xB8,
+    0xB6, 0xC5, 0x6D, 0x00, 0x01, 0x41, 0x11, 0x7E, 0xCC, 0x57, 0x11, 0x59, 0xBD, 0x85, 0xA7, 0xD5,
+    0xE6, 0xBB, 0xF1, 0x39, 0xEE, 0x3E, 0xD4, 0x0F, 0xE2, 0xAE, 0xF6, 0xF1, 0xA5, 0xC3, 0x6D, 0x68,
+    0xE1, 0x74, 0x03, 0x51, 0x83, 0x5B, 0xB8, 0x3A, 0xCA, 0x06, 0xF1, 0x1A, 0x7A, 0x1D, 0x66, 0xBE,
+    0x45, 0x3A, 0x20, 0x1D, 0x11, 0x7B, 0x1B, 0x7B, 0x87, 0xB2, 0x47, 0x41, 0xE2, 0x7C, 0xA5, 0x9E,
+    0xBB, 0x98, 0xF4, 0x9E, 0x79, 0x53, 0x96, 0x48, 0x1F, 0x77, 0xE9, 0x85, 0xC3, 0x50, 0xDF, 0x1F,
+    0x3C, 0xF2, 0xF3, 0xBE, 0xFC, 0xB0, 0x55, 0x7D, 0xF9, 0xF8, 0xC9, 0x1A, 0xC5, 0xBD, 0x71, 0x28,
+    0x6C, 0xE2, 0x0A, 0x7F, 0x6F, 0x80, 0x57, 0xDE, 0xD5, 0x36, 0x75, 0xC5, 0x90, 0xF6, 0xD1, 0x18,
+    0xFB, 0xCA, 0x9B, 0xA2, 0xC9, 0x5D, 0xEE, 0xD4, 0x10, 0x0D, 0xCA, 0x4B, 0x26, 0x50, 0x3A, 0x4D,
+    0xEE, 0x75, 0x20, 0x7D, 0xA2, 0x9A, 0xF7, 0x42, 0x62, 0xD2, 0x90, 0x02, 0xAC, 0xF1, 0x5F, 0x6A,
+    0x92, 0x0E, 0x57, 0x29, 0xBB, 0x41, 0x0E, 0xA9, 0x8C, 0x33, 0x2E, 0x32, 0xBA, 0xA0, 0x45, 0x6F,
+    0x6A, 0xBB, 0xE8, 0xB2, 0x13, 0xB5, 0xFA, 0x66, 0x65, 0x0E, 0xFA, 0x33, 0xA7, 0x1F, 0xAC, 0x72,
+    0x74, 0xFE, 0xA9, 0xCB, 0xF4, 0x70, 0x18, 0xBB, 0xFA, 0x83, 0x66, 0x91, 0xB4, 0xEB, 0xA4, 0x3D,
+    0xC8, 0xEC, 0x19, 0x62, 0x71, 0xA5, 0xDC, 0xCC, 0xA4, 0x64, 0x48, 0x68, 0xC4, 0x1D, 0xE0, 0x6D,
+    0xF2, 0x3A, 0xA0, 0x8F, 0xBA, 0xD8, 0x29, 0xA7, 0x5A, 0xD5, 0x24, 0x56, 0xDB, 0xB4, 0x4A, 0x4D,
+    0xC6, 0x24, 0x2C, 0x48, 0xBE, 0x6C, 0x40, 0x8B, 0x1F, 0xB8, 0x0D, 0x9B, 0x9C, 0x5E, 0x7E, 0xC2,
+    0xDD, 0x09, 0x99, 0x03, 0xB2, 0x16, 0xAF, 0x3B, 0xA2, 0x20, 0xB1, 0x42, 0xE2, 0xD0, 0xE2, 0x3B,
+    0xF2, 0x32, 0x5D, 0x48, 0x0E, 0xF5, 0x2F, 0x9C, 0x46, 0xDD, 0xD7, 0xB2, 0xA6, 0x2A, 0xA0, 0xED,
+    0xA1, 0xAC, 0x55, 0x2B, 0x29, 0x2F, 0x64, 0x4D, 0xA0, 0xDC, 0x5F, 0xC8, 0x9A, 0x53, 0x4D, 0x75,
+    0x9B, 0x28, 0xC8, 0xBD, 0x90, 0xA9, 0xFE, 0x73, 0xF9, 0x71, 0x1F, 0x49, 0xB1, 0x54, 0x54, 0xAC,
+    0x1A, 0x44, 0xBC, 0xE2, 0x68, 0x83, 0x3F, 0xFE, 0xB7, 0x08, 0xF4, 0x48, 0x48, 0x16, 0x88, 0xD1,
+    0xF8, 0x6A, 0x78, 0xF1, 0xC8, 0xD7, 0x32, 0x4F, 0x23, 0x87, 0x42, 0x4D, 0x87, 0x1E, 0x14, 0x78,
+    0x8F, 0xC4, 0x72, 0x2E, 0xD2, 0xE4, 0xA0, 0x82, 0x84, 0x1C, 0x69, 0x28, 0x5A, 0xE4, 0x94, 0xBC,
+    0xD4, 0x5C, 0x43, 0x75, 0xFC, 0x65, 0xA9, 0x97, 0x6F, 0x43, 0x8A, 0x06, 0x41, 0x9D, 0xD9, 0x47,
+    0x24, 0xB7, 0x67, 0xC1, 0xA2, 0xBC, 0xBF, 0x7E, 0x2D, 0x25, 0xD9, 0x75, 0x79, 0xA1, 0x96, 0xCD,
+    0x59, 0xC8, 0xC9, 0x85, 0x4C, 0x4F, 0x85, 0x97, 0xEC, 0x7D, 0x92, 0xA1, 0x5A, 0xE1, 0xE5, 0x34,
+    0x11, 0xB3, 0x66, 0x21, 0x39, 0x93, 0xAC, 0x9D, 0x0A, 0x19, 0x59, 0xC5, 0x29, 0xFF, 0x9C, 0xD6,
+    0x42, 0x86, 0x74, 0x00, 0xA3, 0xA6, 0x36, 0xB0, 0x5C, 0x96, 0x15, 0x5B, 0x84, 0xEA, 0x55, 0x2F,
+    0x64, 0xD4, 0xB3, 0x23, 0x6D, 0x0B, 0x31, 0xC1, 0x27, 0x71, 0xA0, 0xC9, 0xAB, 0xFE, 0x25, 0x58,
+    0xBA, 0x7F, 0x38, 0x53, 0x91, 0xFD, 0x4A, 0xA9, 0xA5, 0x86, 0xEA, 0x48, 0x0D, 0xE3, 0x0A, 0x5C,
+    0x90, 0x15, 0x0A, 0x20, 0x38, 0xFD, 0x4A, 0x64, 0x19, 0xC8, 0x60, 0x46, 0x7A, 0x66, 0xD4, 0x33,
+    0xD6, 0xC2, 0xAF, 0x70, 0xCD, 0xC6, 0x0B, 0xB1, 0x4A, 0x5F, 0x12, 0xA5, 0x79, 0xA1, 0x2C, 0x5C,
+    0x9F, 0x7D, 0x27, 0xCE, 0xFC, 0xF4, 0xA2, 0x5E, 0x4D, 0x72, 0x4F, 0x7E, 0x9F, 0x00, 0xA9, 0x3F,
+    0x26, 0xDE, 0x94, 0x2B, 0xA7, 0xFC, 0xB8, 0xDC, 0x4B, 0xEA, 0xE2, 0x8E, 0xBE, 0x8C, 0xC8, 0x29,
+    0x9E, 0x0C, 0x0E, 0x73, 0x85, 0x0C, 0xA1, 0x3D, 0x48, 0xBD, 0x64, 0xC1, 0x62, 0x3D, 0xF7, 0xB0,
+    0xD2, 0xFB, 0x61, 0xBE, 0xFA, 0xE5, 0x12, 0x41, 0x31, 0xB2, 0x93, 0x02, 0xE1, 0xD4, 0x85, 0xC6,
+    0x2A, 0xAF, 0x64, 0x4D, 0xD0, 0xD5, 0xFF, 0x51, 0xDF, 0x64, 0xC1, 0xE5, 0x4F, 0x56, 0xFF, 0x84,
+    0x4C, 0x3B, 0x65, 0x92, 0x36, 0x97, 0x2E, 0xD8, 0xB1, 0x49, 0x26, 0x76, 0x17, 0xE9, 0x33, 0x3F,
+    0x90, 0x14, 0xB1, 0xE7, 0x90, 0x1D, 0x99, 0x49, 0x23, 0x88, 0x5A, 0x7A, 0x97, 0x96, 0x55, 0xF4,
+    0x42, 0x85, 0xF7, 0x97, 0x7B, 0xD2, 0xC9, 0xC4, 0x8B, 0xF7, 0xC4, 0x51, 0x91, 0x9E, 0x73, 0x2F,
+    0xD1, 0x3F, 0xC4, 0x97, 0x6C, 0x5B, 0xAA, 0x82, 0xFE, 0xED, 0x54, 0x38, 0x21, 0x72, 0xDD, 0xBD,
+    0x24, 0x13, 0x81, 0xCB, 0x04, 0x43, 0xA4, 0xC5, 0x4C, 0xCC, 0x35, 0x1B, 0xBB, 0xAB, 0x15, 0xE3,
+    0x10, 0xF2, 0x7B, 0xE8, 0x6A, 0xEE, 0x8E, 0xA1, 0x96, 0xB5, 0x9D, 0xFB, 0x25, 0x24, 0x31, 0x89,
+    0xC8, 0x22, 0x17, 0x53, 0x73, 0x94, 0x15, 0x0C, 0xCB, 0x77, 0x8B, 0xEF, 0x72, 0x5B, 0x2A, 0xB5,
+    0x51, 0x8A, 0xEB, 0xB7, 0x5E, 0x29, 0xD5, 0x9A, 0x96, 0xEB, 0x5A, 0xBE, 0x3E, 0x3B, 0xF4, 0x12,
+    0x5B, 0xF6, 0xDB, 0x03, 0x2C, 0x8E, 0xBD, 0xD5, 0x12, 0xD5, 0xE5, 0x47, 0xD2, 0x0B, 0xA4, 0x66,
+    0x05, 0xAE, 0xB8, 0xF5, 0x47, 0x5F, 0x08, 0x9D, 0x94, 0x87, 0xB0, 0xBF, 0x7F, 0x89, 0x30, 0x50,
+    0x9B, 0x15, 0xCF, 0x56, 0x1D, 0xED, 0x13, 0xA0, 0xEA, 0xA6, 0xFE, 0x4D, 0x31, 0xDD, 0xF8, 0x9C,
+    0x1D, 0xD3, 0x37, 0xC5, 0xF8, 0xBD, 0xDD, 0x61, 0x4C, 0x3B, 0x84, 0xBD, 0xC9, 0xAF, 0xA0, 0x16,
+    0xA9, 0xFC, 0x34, 0x43, 0xC8, 0x47, 0x09, 0xB2, 0x21, 0x9F, 0x2E, 0x3E, 0xDA, 0x27, 0xB3, 0x52,
+    0xF1, 0xF2, 0x89, 0xC4, 0x09, 0xB0, 0xEC, 0x18, 0x1A, 0x25, 0x72, 0xD1, 0x6E, 0x1B, 0x65, 0x6F,
+    0xD1, 0xC6, 0x06, 0x7B, 0x63, 0xF2, 0x9C, 0x9F, 0x9A, 0xDA, 0xBC, 0x18, 0xC8, 0xC0, 0x04, 0x25,
+    0x2E, 0xAF, 0x98, 0x7F, 0xDA, 0x1B, 0x93, 0x0E, 0x6F, 0x3A, 0x6E, 0x8E, 0x26, 0x80, 0x16, 0x89,
+    0x54, 0x78, 0x6F, 0xCF, 0x5F, 0x77, 0x64, 0xD9, 0xC7, 0x0F, 0x4E, 0xB4, 0x77, 0x2C, 0xCF, 0xD8,
+    0x88, 0x08, 0x9D, 0x4D, 0x71, 0x17, 0xAA, 0x92, 0x4A, 0x31, 0x8F, 0x30, 0xA1, 0x8F, 0x7F, 0x7C,
+    0xA3, 0x83, 0x7F, 0x01, 0xA5, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x40, 0x2C, 0x34,
+    0x12, 0x53, 0x41, 0xC1, 0x4A, 0xCC, 0x0F, 0x40, 0x89, 0xFF, 0xC0, 0x6E, 0xEC, 0xA4, 0xA1, 0xA0,
+    0xA0, 0x5A, 0x28, 0x28, 0x68, 0x11, 0x4D, 0x5A, 0x8A, 0xDD, 0xD8, 0xCA, 0x1F, 0x20, 0x0D, 0xF5,
+    0x56, 0x69, 0xB6, 0x20, 0x14, 0x14, 0x2B, 0x94, 0xEC, 0x4C, 0xA0, 0x48, 0x41, 0xE3, 0x3E, 0x05,
+    0x13, 0x85, 0xFE, 0x8D, 0x90, 0x51, 0xBC, 0xCA, 0xD8, 0xC3, 0x39, 0x7E, 0x49, 0x96, 0x5D, 0x44,
+    0x28, 0x18, 0xE9, 0xF9, 0x3D, 0xCF, 0xCC, 0xFD, 0x3A, 0xF7, 0xDC, 0xF3, 0x44, 0xB0, 0xCA, 0x1C,
+    0xA4, 0xCA, 0xB9, 0x2D, 0x73, 0x8E, 0x72, 0xEF, 0x8B, 0x05, 0x5B, 0xD6, 0x8B, 0xA8, 0x88, 0x1F,
+    0x27, 0x22, 0xEF, 0x1D, 0xE2, 0x20, 0x8B, 0xCB, 0xF7, 0xFB, 0xAB, 0xAD, 0xF2, 0x95, 0x28, 0x2F,
+    0x83, 0x1E, 0x24, 0xBB, 0x28, 0x9D, 0x9B, 0xA4, 0xE9, 0x17, 0xB1, 0xC1, 0xB5, 0x72, 0xBE, 0x8A,
+    0x09, 0xE7, 0x58, 0x4D, 0x9B, 0xF8, 0x55, 0x8D, 0xF4, 0x27, 0x92, 0x55, 0x92, 0x7F, 0x5B, 0x55,
+    0x54, 0xB9, 0x6D, 0x7A, 0x78, 0x6B, 0xA2, 0x8E, 0x52, 0xA6, 0x2A, 0x97, 0xB8, 0x6D, 0x42, 0x37,
+    0x74, 0x38, 0x76, 0x55, 0xB2, 0x70, 0xA9, 0x46, 0xF7, 0x78, 0xA4, 0xE3, 0x5F, 0x47, 0xA6, 0x59,
+    0xCC, 0x19, 0x26, 0xB8, 0xB5, 0x41, 0x09, 0x58, 0x5D, 0x5E, 0x03, 0x28, 0xA4, 0xBB, 0x86, 0xDF,
+    0xEE, 0x9A, 0xED, 0x2B, 0x4A, 0xE4, 0x69, 0x81, 0x62, 0xB8, 0xED, 0x36, 0x2F, 0x32, 0x72, 0xAE,
+    0xE7, 0x7C, 0xC4, 0x38, 0xB9, 0x9E, 0xB0, 0xAD, 0xF2, 0x2F, 0xF9, 0x13, 0x6C, 0xE7, 0xD8, 0x8D,
+    0x4D, 0x92, 0x2E, 0xE9, 0x7C, 0x33, 0xC7, 0x7F, 0x14, 0x66, 0x86, 0x66, 0x0D, 0x77, 0x83, 0x0E,
+    0xCB, 0x64, 0xA2, 0xBC, 0x69, 0xE9, 0xA1, 0x8E, 0xB6, 0x17, 0xDB, 0xE7, 0x1B, 0x13, 0x92, 0x52,
+    0x89, 0x68, 0x3C, 0xB4, 0x81, 0xC6, 0xA9, 0x33, 0x84, 0xFA, 0x8F, 0x89, 0x2F, 0xD5, 0x66, 0xE3,
+    0xD7, 0x7C, 0xD7, 0x2A, 0xEA, 0xBC, 0x05, 0x6D, 0x91, 0xD7, 0x7B, 0xC5, 0xB6, 0x84, 0x3A, 0x67,
+    0x38, 0x52, 0x4B, 0x77, 0x84, 0xC0, 0xDD, 0xB3, 0xA5, 0x89, 0x52, 0x2D, 0x76, 0x74, 0x41, 0x5C,
+    0xC8, 0x9E, 0x66, 0x65, 0x84, 0xDB, 0xA6, 0x48, 0xA2, 0x63, 0xE3, 0x81, 0xFB, 0x74, 0x29, 0xA5,
+    0x5B, 0x67, 0xF4, 0x32, 0x49, 0x79, 0x6F, 0xED, 0xCC, 0x1E, 0x41, 0x63, 0x61, 0x87, 0x0C, 0xE5,
+    0xD9, 0x0D, 0xB0, 0x82, 0xC9, 0xAE, 0xC1, 0x1F, 0xB2, 0x4A, 0x62, 0x76, 0x8D, 0xF7, 0x42, 0x21,
+    0x70, 0x7C, 0x7D, 0x3F, 0xF7, 0x8A, 0x84, 0x21, 0xE6, 0x85, 0xBB, 0x18, 0xC0, 0xB6, 0x0F, 0xD0,
+    0x2A, 0x38, 0xEA, 0xD0, 0x43, 0xC3, 0x14, 0x2E, 0xAC, 0x06, 0x2D, 0x7C, 0xBB, 0x60, 0xBC, 0x77,
+    0xF8, 0xCA, 0xD3, 0x6F, 0xE0, 0x78, 0xC6, 0xF7, 0xFB, 0x0C, 0xA3, 0xB9, 0xFB, 0x03, 0x53, 0x11,
+    0x79, 0xF7, 0xFE, 0xB0, 0x4D, 0xC5, 0x9E, 0xAD, 0x68, 0xE4, 0x60, 0x88, 0x08, 0xB2, 0x45, 0x12,
+    0x72, 0x4A, 0x8E, 0x91, 0xAD, 0x0A, 0x2E, 0x3B, 0x7C, 0x76, 0xFC, 0x5A, 0x8D, 0x0A, 0x6B, 0x2D,
+    0xC6, 0xDB, 0x8F, 0xD1, 0xC2, 0x0C, 0x26, 0x0C, 0xD2, 0x05, 0x12, 0x64, 0x04, 0x99, 0x11, 0xD9,
+    0xA2, 0xA2, 0x69, 0x35, 0x46, 0xA9, 0x74, 0x53, 0xC1, 0xB8, 0x86, 0x47, 0x7A, 0x15, 0x6C, 0x81,
+    0xE4, 0x52, 0xCB, 0x5B, 0x78, 0x7D, 0x78, 0x6B, 0x20, 0x83, 0x0C, 0x6A, 0xD5, 0xCB, 0x79, 0x11,
+    0xC7, 0xE4, 0x45, 0xFD, 0x92, 0x69, 0xB0, 0x5B, 0xF9, 0x8F, 0x12, 0xBE, 0x26, 0x80, 0x36, 0xC0,
+    0x10, 0x05, 0xD5, 0xBD, 0x64, 0x8F, 0xDC, 0xC8, 0x25, 0xD1, 0xB9, 0xD7, 0xA1, 0xC8, 0x23, 0x6E,
+    0x75, 0x1D, 0x6E, 0x99, 0x27, 0xB1, 0x48, 0x6A, 0x5A, 0x70, 0xEB, 0xD4, 0x0E, 0x6A, 0xAC, 0x7F,
+    0xC6, 0xAD, 0x0A, 0x68, 0xE9, 0x38, 0x23, 0x9D, 0xA5, 0x69, 0x9D, 0x98, 0x27, 0xC1, 0xC4, 0x62,
+    0x49, 0xC5, 0x82, 0x1A, 0xA4, 0x19, 0x14, 0xDC, 0x25, 0x56, 0xEA, 0x3C, 0x92, 0x31, 0xAF, 0x60,
+    0xFF, 0xC0, 0xCD, 0x64, 0xFD, 0x70, 0x11, 0xE7, 0x13, 0x20, 0x63, 0x5A, 0x34, 0x3F, 0xCA, 0x8B,
+    0xD6, 0xCA, 0x5E, 0x2C, 0x83, 0xF9, 0x56, 0xF6, 0xCA, 0xA7, 0x41, 0xF9, 0x93, 0xAB, 0x72, 0x60,
+    0x95, 0xD7, 0x8F, 0xFD, 0x81, 0x9C, 0x45, 0xED, 0xCD, 0xA1, 0x4C, 0x45, 0x6E, 0x6D, 0x5B, 0x87,
+    0x32, 0xC2, 0x84, 0x04, 0xD7, 0x9E, 0xCF, 0x44, 0x84, 0x6A, 0x4F, 0xD0, 0x27, 0x1B, 0x5E, 0xBA,
+    0xFE, 0x6A, 0x25, 0xE5, 0x20, 0x3A, 0x48, 0x92, 0x12, 0x02, 0xD0, 0x4B, 0x87, 0x12, 0xC4, 0x24,
+    0x58, 0x22, 0x49, 0xD8, 0x80, 0x13, 0xA7, 0x00, 0xA8, 0x35, 0x43, 0xF5, 0x3C, 0xE2, 0xD6, 0xEC,
+    0x90, 0x4E, 0xF3, 0x69, 0x50, 0x93, 0x7E, 0x3A, 0x4B, 0x73, 0x33, 0xD5, 0xB8, 0xD5, 0x21, 0x94,
+    0x33, 0xBE, 0x6B, 0xCD, 0xB3, 0x11, 0x63, 0x34, 0x9F, 0x4A, 0x16, 0xBB, 0xF1, 0x36, 0xA8, 0x1C,
+    0x81, 0x1F, 0x70, 0x6B, 0x7C, 0x95, 0x5B, 0x9D, 0x40, 0x6D, 0xC9, 0x9C, 0xF5, 0xA9, 0x1A, 0xA4,
+    0x6E, 0x51, 0x2E, 0x45, 0xC5, 0x5D, 0x56, 0x14, 0xDD, 0x03, 0x78, 0xE0, 0xDD, 0x1B, 0x31, 0x3F,
+    0x16, 0x51, 0xFD, 0x06, 0xCE, 0x4E, 0x51, 0x0D, 0xD7, 0x3E, 0x94, 0x5D, 0x7D, 0x67, 0xA8, 0x1E,
+    0xC5, 0x5D, 0x39, 0x39, 0xA8, 0xBC, 0x39, 0x92, 0x07, 0xF2, 0x7C, 0x30, 0xBD, 0x1D, 0x8B, 0x11,
+    0xF9, 0xD7, 0x30, 0x51, 0xE7, 0x63, 0xAC, 0xA2, 0xE9, 0x39, 0x05, 0xE8, 0x1F, 0x24, 0x08, 0x2C,
+    0xB9, 0xAC, 0x70, 0xAF, 0xD7, 0x95, 0xAD, 0x98, 0x90, 0x93, 0x55, 0xFE, 0x0C, 0x19, 0x5A, 0x44,
+    0x07, 0xF1, 0xF1, 0x03, 0x12, 0x49, 0xEB, 0xAD, 0x8C, 0x91, 0xA0, 0x3A, 0x10, 0x4A, 0x3D, 0x00,
+    0x37, 0xB6, 0xDF, 0xAF, 0x04, 0x45, 0x04, 0xDB, 0x33, 0x4E, 0xD3, 0xF2, 0xE9, 0xA4, 0x1E, 0x56,
+    0xE6, 0xCC, 0xFB, 0x2E, 0x89, 0x85, 0x58, 0x8D, 0x14, 0x30, 0x44, 0x01, 0x8F, 0xE1, 0x1E, 0xF4,
+    0x9D, 0x57, 0x09, 0xB8, 0x7B, 0x21, 0x0D, 0x83, 0x56, 0x59, 0x7F, 0xBA, 0x8A, 0x71, 0x77, 0x67,
+    0xBE, 0x70, 0xB6, 0x83, 0xC9, 0x71, 0xAE, 0x2D, 0x47, 0xB4, 0xDB, 0x97, 0x83, 0x69, 0xCB, 0x50,
+    0x63, 0x9E, 0xF7, 0x30, 0x44, 0xBB, 0x52, 0xA1, 0xFF, 0xC6, 0xDF, 0x96, 0xAE, 0x6D, 0xD6, 0x39,
+    0x61, 0x4C, 0x0C, 0xFF, 0xF2, 0xAA, 0xD8, 0x1D, 0xFE, 0xEA, 0x38, 0x80, 0x8E, 0xE1, 0x5D, 0x0F,
+    0x71, 0xEE, 0x28, 0x09, 0x9C, 0x3B, 0xE6, 0x5D, 0x05, 0x14, 0x52, 0x4E, 0x50, 0xD7, 0x3C, 0x23,
+    0xB9, 0x63, 0xC7, 0x21, 0x40, 0xA3, 0x5B, 0xD0, 0x83, 0x04, 0x61, 0x1B, 0xED, 0x44, 0xEB, 0xB5,
+    0x9C, 0x44, 0x9E, 0xA6, 0xAD, 0xFA, 0x48, 0xF1, 0x3D, 0xAB, 0x28, 0x1D, 0xBC, 0x60, 0x4F, 0xFF,
+    0xF9, 0xA5, 0xAF, 0x06, 0x34, 0x6D, 0x90, 0xBD, 0x22, 0x42, 0x44, 0xE0, 0xD2, 0x5F, 0xDF, 0xFF,
+    0x3C, 0x62, 0x58, 0x47, 0x1C, 0x24, 0xC9, 0x1B, 0x50, 0x22, 0x93, 0xEA, 0x88, 0x51, 0xFF, 0xFE,
+    0x37, 0x59, 0x06, 0x29, 0x64, 0x26, 0xC6, 0x0D, 0x35, 0xB9, 0xF6, 0x59, 0xFE, 0x73, 0x51, 0x03,
+    0x0B, 0x02, 0x8B, 0xAC, 0x17, 0x72, 0xB8, 0xF6, 0x08, 0x51, 0x72, 0x3C, 0xE5, 0x36, 0x25, 0xC1,
+    0xF6, 0x0D, 0x7B, 0xB6, 0xF6, 0x40, 0xE7, 0xE5, 0x38, 0xAD, 0x22, 0xC3, 0xE3, 0xA6, 0x45, 0x79,
+    0xB5, 0x37, 0x23, 0x44, 0x85, 0x7F, 0x8E, 0x54, 0x41, 0x3C, 0x0C, 0x1F, 0xA8, 0x14, 0x8C, 0xB8,
+    0xF2, 0x13, 0x01, 0x2C, 0x46, 0xED, 0xD7, 0x3F, 0x41, 0x30, 0xC9, 0xBF, 0xE9, 0xEF, 0xEF, 0x23,
+    0x0A, 0x1C, 0x05, 0x06, 0x10, 0x14, 0xA3, 0x1C, 0x08, 0x9B, 0x53, 0x79, 0x68, 0x18, 0x31, 0x30,
+    0xDF, 0xED, 0x27, 0x00, 0x62, 0x30, 0x9D, 0x20, 0x10, 0x41, 0x40, 0xA4, 0x76, 0x15, 0x35, 0x71,
+    0x77, 0xE5, 0x7F, 0xAC, 0xBF, 0x00, 0x85, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x9D, 0x25, 0x61,
+    0x2F, 0x02, 0x02, 0x5A, 0x17, 0x09, 0x10, 0x24, 0xB1, 0xB7, 0x49, 0xE1, 0x22, 0x32, 0xDB, 0x14,
+    0x27, 0x93, 0x49, 0xE3, 0xD6, 0x8D, 0xF2, 0x1D, 0x2E, 0x5D, 0x38, 0x47, 0x26, 0x29, 0x5C, 0xA4,
+    0xD1, 0x27, 0xB8, 0x48, 0x75, 0x4D, 0x5C, 0xA6, 0x90, 0xC4, 0x05, 0x5C, 0xB8, 0x65, 0x93, 0x3A,
+    0x74, 0x67, 0x20, 0x0D, 0x81, 0x1C, 0x62, 0x42, 0x26, 0xB9, 0x7E, 0x6F, 0xEE, 0x74, 0x39, 0x29,
+    0x10, 0xBC, 0x07, 0xDD, 0x9D, 0x78, 0xC3, 0x99, 0x37, 0x6F, 0xDE, 0x3C, 0x8A, 0xE8, 0xB1, 0x5D,
+    0x5E, 0x4A, 0xBA, 0x76, 0x41, 0xCC, 0x64, 0x7B, 0x91, 0x26, 0x1D, 0xE5, 0x7F, 0x27, 0x9B, 0x4B,
+    0x91, 0x22, 0x0E, 0x22, 0x4B, 0x29, 0x6A, 0x39, 0x95, 0xB4, 0x97, 0x67, 0x22, 0x67, 0xF2, 0xA9,
+    0x88, 0xAF, 0x11, 0x90, 0x76, 0x62, 0x56, 0xAB, 0xB5, 0x48, 0x8C, 0x13, 0x23, 0x23, 0xEF, 0x72,
+    0xFC, 0xC5, 0xB6, 0xFC, 0xB9, 0xB7, 0x93, 0xD8, 0x21, 0x89, 0x73, 0x33, 0x4A, 0xC3, 0x18, 0x1F,
+    0xE3, 0x2C, 0x89, 0x46, 0x7F, 0x19, 0x7F, 0xDB, 0xAF, 0x35, 0x22, 0xB8, 0xF7, 0x21, 0x0F, 0xB3,
+    0xCC, 0x76, 0xB8, 0xBC, 0x6A, 0x1E, 0x8B, 0x69, 0x66, 0x71, 0x8F, 0x73, 0xB9, 0x23, 0x05, 0x2E,
+    0xA0, 0xBC, 0xE9, 0x51, 0x29, 0x98, 0x8B, 0x06, 0x5F, 0x51, 0xDA, 0x87, 0x90, 0x4C, 0xF6, 0x22,
+    0xB6, 0x1E, 0x59, 0x15, 0xF1, 0xEE, 0x24, 0xBF, 0xC7, 0x1A, 0xB1, 0xF3, 0xB5, 0xB6, 0x90, 0xF4,
+    0x96, 0x64, 0x01, 0xB9, 0x3C, 0x3B, 0x38, 0x92, 0x1C, 0xE5, 0x65, 0x90, 0xA4, 0xC7, 0x45, 0xDB,
+    0x2E, 0xD1, 0xC2, 0x2B, 0x50, 0x52, 0xB0, 0xC5, 0x09, 0xB4, 0x24, 0xB1, 0x43, 0x43, 0xEC, 0xCD,
+    0x11, 0x58, 0x11, 0xF0, 0xC6, 0x9C, 0x19, 0x82, 0xA4, 0x41, 0x41, 0x3F, 0xB0, 0x79, 0x44, 0x47,
+    0xE0, 0xB1, 0xD7, 0xCA, 0x99, 0x06, 0xB7, 0xBB, 0x78, 0x51, 0xCB, 0x0D, 0xE7, 0x08, 0x85, 0x51,
+    0xDD, 0x95, 0xF8, 0x38, 0x45, 0x7D, 0x50, 0xE7, 0x6A, 0xF4, 0x5A, 0xB0, 0xBB, 0x33, 0x4E, 0x68,
+    0x38, 0x03, 0x97, 0xFF, 0xA0, 0x9A, 0x8B, 0xA8, 0x96, 0x73, 0x52, 0x15, 0xF8, 0x35, 0x84, 0x64,
+    0xD7, 0x5B, 0x48, 0x3A, 0xC0, 0x06, 0x97, 0xD9, 0xAF, 0x8D, 0xF8, 0x92, 0xAF, 0xF7, 0xE9, 0xED,
+    0x24, 0xE3, 0xCC, 0x8B, 0x7A, 0xC2, 0xC8, 0x15, 0xFA, 0xFE, 0xB9, 0x5D, 0xCA, 0x7D, 0xF0, 0x90,
+    0x70, 0xC0, 0xAE, 0x04, 0x1C, 0x0E, 0x3B, 0x6D, 0x41, 0x13, 0x90, 0xF8, 0xEF, 0x90, 0xA9, 0x00,
+    0x12, 0x19, 0x41, 0x4E, 0xF2, 0x1E, 0x37, 0x67, 0x6C, 0xD7, 0xB3, 0x64, 0x01, 0x72, 0x84, 0x48,
+    0x52, 0x92, 0x93, 0x23, 0x28, 0x99, 0x08, 0xB0, 0xDB, 0x20, 0x49, 0x89, 0xC4, 0x0F, 0xD7, 0xCA,
+    0x11, 0x0E, 0x24, 0x58, 0x5F, 0xC2, 0x59, 0xDF, 0x44, 0x0E, 0x20, 0xE4, 0x54, 0xD4, 0x1A, 0x1F,
+    0x98, 0xCE, 0x8F, 0x78, 0xC9, 0x00, 0x19, 0xA6, 0xBD, 0x2F, 0x25, 0x6B, 0x01, 0xC0, 0xFF, 0x8A,
+    0x02, 0x05, 0xB5, 0x41, 0xF6, 0x93, 0x08, 0x00, 0x96, 0x00, 0x3C, 0x5B, 0xAC, 0xCA, 0x2D, 0x31,
+    0x64, 0x28, 0x9B, 0xC8, 0x20, 0x70, 0x55, 0x13, 0x03, 0xFF, 0x53, 0x0A, 0x14, 0xE5, 0x4A, 0x83,
+    0x11, 0xD4, 0x7C, 0x0B, 0xE6, 0xAD, 0x1C, 0xDC, 0x30, 0xAD, 0x9C, 0xB1, 0x36, 0x80, 0x1F, 0x20,
+    0x82, 0x16, 0x1F, 0xE2, 0x05, 0x5C, 0x39, 0xA5, 0x48, 0xDD, 0x2F, 0x49, 0x92, 0x7B, 0x8D, 0x1A,
+    0xE9, 0x3B, 0x55, 0x07, 0x1B, 0x57, 0x9A, 0x52, 0x95, 0x85, 0x2E, 0x48, 0x51, 0x6F, 0x89, 0x92,
+    0xBC, 0xDD, 0x32, 0xE5, 0x62, 0xBF, 0xA5, 0xCA, 0xC4, 0xFD, 0xD2, 0x9F, 0x8B, 0x39, 0x01, 0xA2,
+    0xCD, 0xEA, 0x61, 0x7A, 0x50, 0x78, 0x27, 0x1F, 0x3D, 0xAA, 0x28, 0x55, 0xF6, 0x86, 0x35, 0xB3,
+    0xA6, 0x94, 0x54, 0x54, 0x32, 0x72, 0x33, 0x95, 0x38, 0x59, 0xE6, 0xE5, 0x56, 0x57, 0x52, 0x90,
+    0x31, 0xE5, 0x4E, 0x3C, 0x67, 0xA1, 0xD2, 0x12, 0xAF, 0x4B, 0x3C, 0xEE, 0x80, 0x53, 0x5D, 0x29,
+    0xED, 0x40, 0x19, 0x54, 0x3E, 0x77, 0xC7, 0x85, 0x87, 0xF0, 0x84, 0x73, 0x1D, 0x68, 0xF5, 0xFD,
+    0xFE, 0x2F, 0x92, 0xD4, 0xF2, 0x35, 0x38, 0x7B, 0x9A, 0x61, 0x8C, 0xD0, 0x56, 0xEF, 0x40, 0xA2,
+    0x07, 0xC4, 0x07, 0xC0, 0x78, 0x04, 0xC1, 0x2F, 0x70, 0xF3, 0x33, 0x10, 0xB2, 0x44, 0xEF, 0xF0,
+    0x90, 0x32, 0x87, 0x8F, 0x64, 0x13, 0xC1, 0x82, 0x5C, 0xB8, 0x0D, 0xB7, 0x53, 0xFF, 0xCC, 0x46,
+    0x46, 0xBE, 0x3C, 0xA5, 0x73, 0x55, 0xC9, 0xE8, 0x7A, 0x5D, 0xC6, 0xDD, 0xB9, 0x23, 0xAD, 0x95,
+    0xAF, 0xE4, 0x65, 0x12, 0x0E, 0xE4, 0x5B, 0xD3, 0xA6, 0xE5, 0x37, 0xF2, 0xC4, 0x06, 0xFB, 0xD3,
+    0x80, 0xF5, 0x2C, 0xCD, 0xF4, 0x12, 0x30, 0x91, 0x05, 0x0C, 0x1E, 0x5E, 0xDE, 0x11, 0x51, 0xCB,
+    0xC5, 0xD8, 0x27, 0xCA, 0xC2, 0xC6, 0xD2, 0x68, 0x77, 0xE4, 0x68, 0x5B, 0xD8, 0x53, 0xD2, 0xBA,
+    0xF8, 0xA4, 0x4B, 0x55, 0x75, 0xB9, 0xFC, 0xF3, 0x96, 0x24, 0x55, 0x7C, 0xC1, 0x2B, 0x8E, 0x49,
+    0x99, 0xE2, 0xEE, 0x0E, 0xD4, 0x67, 0xC7, 0xA8, 0xDE, 0x1E, 0x40, 0x96, 0xB5, 0x24, 0x08, 0xEE,
+    0xD5, 0xC5, 0x1E, 0x08, 0xF7, 0x2C, 0x0D, 0x14, 0x14, 0xCB, 0x30, 0x39, 0x0A, 0x3D, 0xB9, 0x3A,
+    0xC9, 0x42, 0x11, 0xD0, 0x18, 0x49, 0xBF, 0x6E, 0x98, 0xEB, 0xAA, 0xFA, 0x23, 0xF3, 0x87, 0x80,
+    0x0F, 0x55, 0x62, 0x29, 0x7D, 0x61, 0x2D, 0x0B, 0xCD, 0x64, 0xB9, 0x19, 0xBD, 0xFC, 0x81, 0x7F,
+    0xCE, 0x59, 0x5B, 0x5C, 0x4B, 0x2C, 0x66, 0x94, 0x3C, 0x9E, 0x48, 0x5E, 0xA7, 0x17, 0x4D, 0xAD,
+    0xC1, 0x47, 0x1A, 0x6C, 0xBA, 0x8C, 0xC1, 0xF7, 0xD0, 0x24, 0xAC, 0xA9, 0xD3, 0xE0, 0xD3, 0x04,
+    0xC1, 0xA6, 0x09, 0x45, 0x48, 0xC1, 0x99, 0x25, 0xAD, 0x13, 0x1C, 0xD0, 0xE2, 0xDD, 0x5D, 0x5F,
+    0xE1, 0x82, 0x4B, 0x52, 0x91, 0xB8, 0x19, 0x59, 0xCD, 0x7C, 0xC3, 0x8E, 0xBF, 0x10, 0xF9, 0x84,
+    0xE4, 0x1F, 0x92, 0xD9, 0x05, 0xD9, 0x5F, 0x60, 0xE7, 0xE5, 0xA9, 0xFD, 0x13, 0x2B, 0x96, 0x21,
+    0x71, 0xEF, 0xEA, 0xCC, 0xF4, 0xAE, 0x4C, 0x7F, 0xEE, 0xBC, 0xD8, 0x5F, 0xDA, 0x5C, 0xFC, 0xA3,
+    0x50, 0xFC, 0x10, 0xE1, 0x4C, 0x71, 0x84, 0xA6, 0xE3, 0x89, 0x2B, 0xAF, 0x38, 0x46, 0xCF, 0xF9,
+    0x25, 0x6B, 0x55, 0xCB, 0x00, 0x97, 0x21, 0xBD, 0xE4, 0xEF, 0x5C, 0xE7, 0x56, 0x18, 0xB5, 0x83,
+    0x47, 0x1C, 0x96, 0xFF, 0x8B, 0x33, 0x56, 0x53, 0x15, 0xA7, 0x92, 0xCD, 0x54, 0x61, 0x1B, 0xBB,
+    0xAA, 0x46, 0x5D, 0x04, 0xCE, 0xD8, 0x0E, 0x51, 0x1D, 0x85, 0x66, 0x5F, 0x85, 0x2A, 0x70, 0x3F,
+    0x8A, 0x56, 0x2C, 0xD8, 0xE8, 0xB9, 0x30, 0xFE, 0xDF, 0x1A, 0x86, 0xEC, 0x74, 0x7F, 0x74, 0x95,
+    0xE1, 0x8F, 0x4C, 0x9D, 0xEC, 0x9E, 0x05, 0xF7, 0xE5, 0x36, 0xB4, 0x61, 0x6B, 0xD3, 0x61, 0x0C,
+    0x0B, 0xFC, 0x65, 0xCF, 0x91, 0xE5, 0x5D, 0xD8, 0x3A, 0x53, 0xBB, 0x31, 0x72, 0x3E, 0x3B, 0xEC,
+    0xDF, 0x78, 0x08, 0xBD, 0x21, 0x70, 0x4C, 0xA1, 0xCF, 0x3A, 0xDB, 0xAB, 0x25, 0x50, 0x5D, 0x76,
+    0xB3, 0xFB, 0x5F, 0xAC, 0x56, 0x90, 0xEC, 0x6B, 0x4C, 0xE0, 0xCA, 0xB7, 0xD5, 0x0B, 0x88, 0x39,
+    0x3E, 0x8F, 0x7C, 0xBA, 0xDE, 0x3A, 0x3E, 0x2E, 0x31, 0xA2, 0x38, 0x62, 0x9F, 0xE2, 0x15, 0x7A,
+    0x3E, 0x00, 0x9D, 0x54, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xB3, 0x83, 0xBD, 0x89, 0x06, 0x32,
+    0x29, 0x52, 0x20, 0x24, 0x7B, 0x11, 0xA2, 0x70, 0xE1, 0x78, 0x83, 0xE4, 0xC2, 0x85, 0x9D, 0x59,
+    0x91, 0x82, 0x22, 0x48, 0x98, 0xC2, 0x3D, 0x05, 0x05, 0x54, 0x50, 0x50, 0x20, 0x61, 0xB8, 0x41,
+    0x14, 0x20, 0x51, 0x20, 0x1A, 0x2A, 0x0A, 0x28, 0x31, 0x05, 0x16, 0x72, 0x11, 0x09, 0xC7, 0xBB,
+    0x8E, 0x25, 0xD2, 0x2E, 0xD0, 0x46, 0x62, 0x11, 0xD0, 0x2F, 0xD1, 0x0A, 0x6D, 0xA2, 0xDD, 0x5B,
+    0xDE, 0x9F, 0xBD, 0x5C, 0x6C, 0x42, 0x1A, 0xE6, 0xEE, 0xF6, 0xEE, 0xE6, 0xCF, 0x7F, 0xFF, 0xFF,
+    0xF7, 0xDF, 0x9F, 0x85, 0x9D, 0x9D, 0x9D, 0x6D, 0xE8, 0x41, 0x56, 0xE7, 0xC2, 0x97, 0x47, 0x58,
+    0x0B, 0x8F, 0xB5, 0x8C, 0xAB, 0x8E, 0x0A, 0x6C, 0xA0, 0xC6, 0x12, 0xDE, 0x81, 0xC5, 0x2A, 0xB4,
+    0xB7, 0x50, 0xA5, 0xF6, 0xD8, 0x57, 0x25, 0x36, 0xB1, 0x4F, 0xC3, 0x06, 0x0C, 0x9F, 0xBA, 0x30,
+    0x40, 0xA5, 0x0B, 0x9E, 0xAB, 0x82, 0xE1, 0x02, 0x9F, 0x71, 0x76, 0x01, 0x51, 0x11, 0x67, 0x01,
+    0x46, 0x0C, 0xAB, 0x33, 0x18, 0x44, 0x7B, 0x5C, 0x91, 0x84, 0x2B, 0xE4, 0x51, 0x3E, 0x8C, 0xB8,
+    0x48, 0xC3, 0x37, 0x21, 0xA1, 0x17, 0x83, 0x39, 0xF7, 0xAE, 0x48, 0x4A, 0x5B, 0xC5, 0xB5, 0xEE,
+    0x54, 0x0F, 0xE8, 0x5E, 0x77, 0xA6, 0xB1, 0x75, 0x52, 0x38, 0x9F, 0x03, 0x3B, 0xF3, 0xFF, 0xA5,
+    0x2B, 0xF2, 0xEC, 0xEC, 0xE9, 0xFC, 0xD3, 0x46, 0x77, 0xDC, 0xF8, 0xB9, 0xC7, 0x54, 0xF6, 0x72,
+    0xB8, 0x93, 0x56, 0xF5, 0x49, 0xA9, 0x7B, 0x57, 0xBA, 0xDB, 0xF4, 0xCB, 0x31, 0xD8, 0x2A, 0x39,
+    0xEE, 0x74, 0x4B, 0x34, 0x53, 0x3F, 0x82, 0x37, 0xB9, 0xDD, 0x06, 0x84, 0xDF, 0xA6, 0x3C, 0x58,
+    0xEB, 0x66, 0x92, 0xA5, 0xB7, 0x3A, 0x01, 0x0B, 0xB9, 0x1E, 0x80, 0xD5, 0x90, 0x24, 0x60, 0x8D,
+    0x89, 0xB1, 0x88, 0x4D, 0x20, 0x2E, 0x80, 0x1B, 0xDC, 0xCF, 0x64, 0x3F, 0x19, 0x86, 0x13, 0x12,
+    0x8B, 0x2D, 0x9A, 0xB9, 0xBF, 0x0B, 0x18, 0xD2, 0xDB, 0x04, 0x37, 0x45, 0x8C, 0xCB, 0xE3, 0xBE,
+    0xB8, 0xF9, 0xD3, 0x70, 0xCB, 0x64, 0x88, 0x70, 0x24, 0x4A, 0xD1, 0x7C, 0xEE, 0x01, 0x37, 0x72,
+    0xC8, 0x64, 0xE3, 0xA9, 0x04, 0x21, 0xAA, 0x40, 0x8B, 0xBF, 0x60, 0x4B, 0x5C, 0x01, 0x67, 0x44,
+    0x12, 0xD8, 0x23, 0xAA, 0xC6, 0xAC, 0x24, 0x84, 0xA4, 0x25, 0xB1, 0xED, 0x43, 0x77, 0xC7, 0xC4,
+    0x72, 0x7E, 0x82, 0xFB, 0xBB, 0x63, 0x39, 0x12, 0x5C, 0x3E, 0x92, 0x9C, 0x92, 0xAE, 0xD0, 0x0D,
+    0xA7, 0x15, 0xA1, 0xD8, 0x12, 0x06, 0xA8, 0x31, 0xA1, 0xA7, 0x1B, 0xA6, 0x52, 0xA2, 0x37, 0xEC,
+    0x20, 0x23, 0x36, 0x91, 0xD4, 0xCA, 0xA6, 0x11, 0x76, 0x28, 0xA8, 0xA6, 0x3A, 0x1D, 0x86, 0xD6,
+    0x0E, 0xC3, 0x94, 0x07, 0x06, 0x06, 0x7E, 0x2D, 0x6A, 0x6D, 0x37, 0xF9, 0xBB, 0x97, 0x1A, 0xA0,
+    0xEF, 0xB6, 0xD3, 0x3C, 0x7B, 0xF0, 0x15, 0x56, 0x87, 0x0F, 0xE0, 0x52, 0x6F, 0x4B, 0xF3, 0x3B,
+    0xDB, 0x04, 0xEE, 0xA7, 0xEC, 0xE6, 0x1B, 0x87, 0x87, 0xF3, 0xF0, 0x4B, 0x38, 0xEF, 0xB1, 0x8E,
+    0x67, 0x33, 0x8A, 0xE9, 0x05, 0xCF, 0xC2, 0x5E, 0x2F, 0x58, 0xCD, 0xE7, 0x9E, 0x4C, 0xFD, 0x90,
+    0x31, 0xFF, 0x2D, 0x49, 0x3C, 0xF0, 0x14, 0xAA, 0x0C, 0xA5, 0x09, 0x25, 0x81, 0xCE, 0x40, 0x40,
+    0x20, 0x0E, 0xBB, 0xAF, 0x3E, 0xC7, 0x3A, 0xBF, 0xFE, 0x82, 0xFC, 0x7C, 0xF2, 0x23, 0xEC, 0x87,
+    0x77, 0xEE, 0x90, 0xCC, 0xFA, 0x00, 0x97, 0xC6, 0x30, 0x67, 0x45, 0xF6, 0x78, 0xB5, 0xC8, 0xFA,
+    0x4A, 0x67, 0xEB, 0xD6, 0xEF, 0xC6, 0x3F, 0xD5, 0xD6, 0x1F, 0x12, 0xC4, 0x5E, 0x2B, 0x96, 0x51,
+    0xAF, 0x47, 0x7E, 0x69, 0xD6, 0x34, 0x5D, 0xDE, 0xB0, 0x51, 0xB9, 0xC2, 0x9F, 0x6F, 0x2F, 0xE9,
+    0xAA, 0x35, 0xC7, 0xB5, 0xD5, 0xE5, 0xE5, 0xD8, 0xAF, 0x98, 0x91, 0xD1, 0x62, 0x09, 0xFB, 0x5B,
+    0xBA, 0x4A, 0xA2, 0x2A, 0x41, 0x63, 0x51, 0xC7, 0xC5, 0x41, 0xEC, 0x37, 0xB5, 0x5F, 0x51, 0xE3,
+    0x58, 0xAC, 0x22, 0x6A, 0xB0, 0xDB, 0x98, 0xE3, 0x66, 0x46, 0x42, 0xA9, 0xEA, 0xA8, 0x8A, 0x4B,
+    0x53, 0xE8, 0x1A, 0x39, 0xA8, 0xC5, 0x8E, 0xBC, 0x44, 0x34, 0x3C, 0x25, 0x2D, 0x4F, 0x32, 0xB4,
+    0x30, 0x45, 0xD4, 0xAA, 0x0E, 0x3D, 0x8E, 0xC8, 0x43, 0x84, 0x33, 0xCB, 0x0A, 0x0B, 0xAE, 0x40,
+    0xFA, 0x31, 0x2B, 0x48, 0x4A, 0xB8, 0xEF, 0xD8, 0x64, 0x4B, 0xA8, 0xA9, 0x64, 0xDB, 0x20, 0x6E,
+    0x85, 0x81, 0x4E, 0x4C, 0xE4, 0x6D, 0x8A, 0xB1, 0x3B, 0x83, 0xEE, 0x83, 0x77, 0xFE, 0x59, 0xA8,
+    0xFB, 0xAA, 0x1B, 0x44, 0x1A, 0x38, 0x72, 0xF4, 0x7A, 0x1F, 0xE8, 0x13, 0x0A, 0x89, 0x92, 0xEB,
+    0x27, 0x1D, 0x18, 0x18, 0x11, 0xA5, 0x41, 0x0C, 0xB0, 0xFB, 0xC1, 0x6D, 0x72, 0x37, 0x5C, 0x2C,
+    0x11, 0xE7, 0x3D, 0x74, 0x82, 0xB0, 0x82, 0xE3, 0x5A, 0xB8, 0x46, 0x54, 0x55, 0x22, 0xE5, 0x69,
+    0x33, 0x64, 0x8A, 0x8E, 0x70, 0x9D, 0xDC, 0x49, 0x23, 0x7D, 0x33, 0x9A, 0x6D, 0x7D, 0xA6, 0x88,
+    0x85, 0xD0, 0xDB, 0xDD, 0xA0, 0xF9, 0x06, 0xAA, 0x46, 0x54, 0x43, 0x57, 0x88, 0x4B, 0x96, 0x0E,
+    0x5B, 0x20, 0xF1, 0x48, 0x33, 0x38, 0x50, 0x51, 0xB8, 0x29, 0xCA, 0x92, 0xF7, 0x08, 0x44, 0x8A,
+    0x2A, 0xB8, 0x12, 0x93, 0x12, 0x79, 0x31, 0xDB, 0x14, 0x45, 0xCA, 0x98, 0x2C, 0xDE, 0x27, 0x25,
+    0x43, 0x03, 0x0A, 0x37, 0x33, 0xAF, 0x5C, 0x27, 0x60, 0xD1, 0x11, 0x9A, 0x38, 0x2D, 0x69, 0xDB,
+    0x22, 0x7C, 0x72, 0xAD, 0x86, 0xB9, 0xD5, 0x40, 0xFF, 0x45, 0x9A, 0xEE, 0x13, 0x34, 0xEF, 0x42,
+    0xBE, 0xB0, 0xED, 0x98, 0x6C, 0x24, 0x81, 0x84, 0x2B, 0x27, 0x62, 0x2B, 0x42, 0xAA, 0x61, 0x05,
+    0x83, 0x70, 0x9C, 0x93, 0x09, 0xC6, 0x47, 0xC2, 0xCA, 0x8D, 0x6C, 0x3E, 0xB3, 0xB7, 0x67, 0xC3,
+    0x4D, 0x51, 0x3F, 0x8F, 0x4B, 0x15, 0x7E, 0xF9, 0xE3, 0xAD, 0x78, 0xA8, 0xE3, 0x7B, 0xB4, 0x3C,
+    0x81, 0x71, 0x06, 0xF5, 0xCB, 0xFB, 0x40, 0x2A, 0x02, 0x20, 0xD7, 0x78, 0x8F, 0x75, 0x9F, 0xBB,
+    0xC2, 0x94, 0x17, 0x15, 0x70, 0x85, 0xAF, 0x97, 0xCE, 0x9F, 0xAC, 0xAE, 0x7D, 0x7B, 0xBD, 0x67,
+    0xCD, 0x49, 0x16, 0xDF, 0x5B, 0xFE, 0x55, 0x7F, 0xF9, 0xFD, 0x93, 0x17, 0x95, 0x57, 0x1E, 0x17,
+    0xE7, 0x93, 0xC3, 0xB5, 0x21, 0x0F, 0x99, 0x10, 0xA9, 0x15, 0x66, 0x54, 0xD7, 0x6C, 0xF2, 0xFF,
+    0x6B, 0x72, 0x84, 0x73, 0x3D, 0x9F, 0x9C, 0x35, 0xCC, 0xEE, 0x19, 0x25, 0xFB, 0x72, 0xA3, 0x84,
+    0xEB, 0x04, 0x57, 0x4F, 0x37, 0x46, 0xE5, 0x2D, 0x19, 0xCC, 0x78, 0x05, 0xD4, 0x96, 0xAD, 0x4C,
+    0xFD, 0xE4, 0xA3, 0xC6, 0x34, 0x4C, 0xA4, 0x7B, 0x5A, 0x9A, 0x22, 0xBD, 0x09, 0xAD, 0xE8, 0xC6,
+    0x9F, 0x64, 0x55, 0x91, 0x38, 0x2A, 0x1C, 0xE9, 0x08, 0x15, 0x57, 0xF3, 0x43, 0x9A, 0xBB, 0x2E,
+    0x83, 0x5C, 0xFB, 0x14, 0xA3, 0x22, 0xAA, 0x50, 0x46, 0xAD, 0x58, 0x1A, 0xD9, 0x44, 0x35, 0x1D,
+    0x59, 0x4D, 0x79, 0xDC, 0x79, 0xE8, 0x76, 0xEE, 0x82, 0xC9, 0xD8, 0x8C, 0xC5, 0x6D, 0xE0, 0x4D,
+    0x3C, 0xB2, 0xBA, 0x71, 0x0A, 0x52, 0x8F, 0x48, 0x7C, 0xDA, 0x99, 0x4F, 0x06, 0xD3, 0xFC, 0xFB,
+    0x68, 0x24, 0xBA, 0x35, 0xBC, 0x4D, 0x61, 0xFE, 0x9C, 0x94, 0x26, 0xE2, 0x60, 0x09, 0x19, 0x4E,
+    0x68, 0xB1, 0xC7, 0x0C, 0xA1, 0xAB, 0x43, 0xC9, 0x5F, 0x48, 0xE8, 0xE4, 0x6E, 0xB9, 0x49, 0x01,
+    0xE2, 0x88, 0x5A, 0xC4, 0x91, 0xA2, 0x32, 0x07, 0x1C, 0x22, 0x9E, 0x52, 0x0C, 0x7C, 0x24, 0x9E,
+    0xD9, 0x9A, 0x92, 0x22, 0xE0, 0xE4, 0xBA, 0x8C, 0x73, 0x42, 0x7D, 0x1C, 0x81, 0x37, 0x49, 0x9A,
+    0xA9, 0xED, 0x53, 0x41, 0x99, 0xBA, 0xF5, 0x5A, 0xCE, 0xD2, 0x9F, 0x25, 0x0D, 0xE2, 0x38, 0xA9,
+    0xF0, 0x3F, 0xD7, 0x3F, 0x65, 0x55, 0xBD, 0x6F, 0x1C, 0x45, 0x14, 0x7F, 0xBB, 0x63, 0xB3, 0xB2,
+    0xD6, 0xF1, 0xBA, 0x41, 0x02, 0x29, 0xF1, 0x36, 0x14, 0x27, 0x64, 0x7B, 0x5D, 0x5C, 0xE1, 0xE2,
+    0xEC, 0x59, 0x84, 0x04, 0x48, 0x29, 0x70, 0x05, 0x05, 0x12, 0xB8, 0xA0, 0x8E, 0xAF, 0xB0, 0x90,
+    0x11, 0x0E, 0xBB, 0x84, 0x96, 0xC2, 0x48, 0xFC, 0x01, 0x2E, 0x91, 0x9B, 0xB8, 0x70, 0xE1, 0x22,
+    0xC9, 0x8D, 0xD3, 0x20, 0xAA, 0x0C, 0x05, 0x34, 0x14, 0xAC, 0x44, 0xA8, 0x22, 0x91, 0x91, 0xB2,
+    0x91, 0x37, 0xF1, 0xAD, 0x87, 0xDF, 0x7B, 0x6B, 0xCB, 0x17, 0x32, 0x27, 0xBD, 0xD9, 0x9B, 0xF7,
+    0x31, 0xEF, 0xF3, 0x37, 0x44, 0x97, 0x2B, 0x3E, 0x17, 0xEA, 0x5B, 0x50, 0xF5, 0xE2, 0x0B, 0x47,
+    0x14, 0xF4, 0x28, 0x2B, 0x89, 0xF0, 0xD5, 0x10, 0x2D, 0x13, 0x25, 0x25, 0x29, 0x4B, 0x41, 0x4D,
+    0x34, 0x20, 0xCA, 0x20, 0x6B, 0x48, 0x55, 0xC2, 0x1C, 0x83, 0x99, 0x93, 0xCE, 0x29, 0x74, 0x94,
+    0xE0, 0x48, 0x53, 0x8C, 0x53, 0x55, 0xC5, 0x6C, 0xEC, 0x7E, 0xE0, 0x41, 0x13, 0x93, 0x19, 0x6C,
+    0x8D, 0x02, 0x83, 0xB2, 0x1C, 0xB2, 0xA4, 0x5C, 0x04, 0xDB, 0x10, 0x7E, 0xC0, 0x17, 0x57, 0xE2,
+    0xC5, 0xDB, 0x74, 0xB5, 0x54, 0x1D, 0xB0, 0xF0, 0x88, 0x0D, 0x53, 0xE2, 0x22, 0x5C, 0x1C, 0x7A,
+    0x62, 0x63, 0xDA, 0xD1, 0xFF, 0x56, 0x20, 0x34, 0xCA, 0x45, 0x8F, 0x2F, 0xA2, 0xD0, 0xCA, 0x51,
+    0x27, 0x59, 0x0B, 0xDD, 0x11, 0x3A, 0x10, 0xBA, 0xC0, 0x4A, 0x75, 0xC2, 0x9F, 0x6D, 0x8C, 0x28,
+    0xA9, 0x78, 0x9F, 0xD5, 0xF4, 0x43, 0x51, 0x0B, 0x26, 0xD5, 0x76, 0x85, 0xAE, 0x09, 0xCD, 0x84,
+    0x26, 0x72, 0x8F, 0xA8, 0x5D, 0xDC, 0xA6, 0xAA, 0x09, 0xB5, 0xE6, 0xBE, 0xA8, 0x69, 0x51, 0x93,
+    0xB0, 0xB3, 0xC4, 0x5D, 0xA9, 0x89, 0x42, 0x24, 0xF7, 0x28, 0x37, 0xA9, 0x26, 0xF4, 0x9E, 0xD0,
+    0xF5, 0xD7, 0x6E, 0x9B, 0x9B, 0x88, 0x93, 0x68, 0x23, 0xFC, 0x68, 0x66, 0x7A, 0x76, 0xE6, 0xAD,
+    0x5F, 0xFB, 0x3F, 0xF4, 0x17, 0x57, 0x8F, 0xB4, 0x4B, 0x4B, 0x9A, 0xA2, 0x1E, 0x1D, 0x87, 0x8F,
+    0xE3, 0x95, 0xC5, 0xA1, 0x1E, 0x53, 0x45, 0x36, 0xB4, 0xEA, 0x7C, 0x9A, 0x66, 0x68, 0x96, 0xD2,
+    0x8A, 0x16, 0x69, 0x71, 0x7E, 0xA7, 0x70, 0x5B, 0x25, 0x12, 0x6A, 0xF1, 0xFB, 0xC6, 0xAE, 0x5D,
+    0xBF, 0xA6, 0xD4, 0x87, 0xE5, 0xC8, 0xBC, 0x91, 0x53, 0xD1, 0x90, 0x8D, 0xA9, 0x1F, 0x9A, 0x39,
+    0x3A, 0x8C, 0xCC, 0x1A, 0xED, 0x13, 0x7D, 0x49, 0xBF, 0x95, 0xFB, 0x9B, 0xBD, 0x6D, 0x94, 0xE9,
+    0xA6, 0x7A, 0xEF, 0xC4, 0x1C, 0xEE, 0x1C, 0xC5, 0x35, 0x05, 0xE3, 0xF0, 0x4E, 0x69, 0x86, 0xC3,
+    0xDE, 0x8D, 0x5B, 0x28, 0x46, 0x60, 0x9E, 0x58, 0x8D, 0x48, 0xB6, 0xEF, 0xC2, 0xAC, 0x77, 0xE4,
+    0x7F, 0xAC, 0x83, 0x31, 0x35, 0x61, 0x8D, 0x42, 0x3B, 0xAA, 0x23, 0x1B, 0xD4, 0xB1, 0x09, 0x5D,
+    0x62, 0x94, 0x4B, 0x4D, 0x54, 0x65, 0x65, 0x5C, 0xE9, 0x3C, 0xB1, 0x05, 0xDA, 0x61, 0x44, 0xA9,
+    0xA1, 0x77, 0x4B, 0xAA, 0x56, 0x94, 0x59, 0x89, 0xA8, 0x9F, 0x5C, 0xEF, 0xCF, 0x0D, 0x86, 0x4B,
+    0xAB, 0x87, 0x8B, 0xF3, 0xD5, 0x40, 0xD9, 0xF5, 0xD4, 0x68, 0x9F, 0x67, 0x2D, 0xC5, 0x8F, 0x11,
+    0xED, 0x3A, 0xD9, 0xD9, 0xD0, 0xAC, 0xAA, 0x7C, 0x58, 0x3C, 0x45, 0x9F, 0x06, 0x23, 0xDA, 0xD8,
+    0x47, 0xB4, 0xD7, 0x50, 0xC6, 0x65, 0xBA, 0x4D, 0x45, 0x8D, 0x80, 0xC3, 0x86, 0x82, 0x92, 0xF6,
+    0xD0, 0x7F, 0xEF, 0x50, 0x4C, 0xEA, 0x3B, 0x6F, 0x0A, 0x14, 0x68, 0x0A, 0x81, 0x77, 0x49, 0xD9,
+    0x96, 0xA4, 0x54, 0xDC, 0x17, 0xD1, 0x78, 0xB6, 0x4B, 0x4A, 0x9F, 0xFA, 0xF3, 0x87, 0x45, 0x75,
+    0x2B, 0x9F, 0x48, 0xCA, 0x9C, 0x52, 0xA1, 0x39, 0xB3, 0x29, 0xE4, 0x02, 0x6F, 0x15, 0xAD, 0x06,
+    0x26, 0xA1, 0x6D, 0x65, 0x16, 0xC8, 0x05, 0xB9, 0xA4, 0xC5, 0xEC, 0x0F, 0x7B, 0x7D, 0x55, 0x23,
+    0x2D, 0xF9, 0x89, 0x19, 0x7E, 0xBD, 0x73, 0x95, 0x96, 0xCD, 0xDE, 0x8D, 0x85, 0x89, 0xB4, 0x90,
+    0x2A, 0x2F, 0x87, 0x27, 0x32, 0xD2, 0x4E, 0xEB, 0x5D, 0xFD, 0x9D, 0x7C, 0xF1, 0x19, 0xB8, 0x69,
+    0xD7, 0x3E, 0x83, 0x8E, 0xD5, 0x48, 0xC1, 0xB9, 0x25, 0x50, 0xFD, 0xB0, 0x92, 0xC6, 0xC3, 0xD8,
+    0xC9, 0x66, 0x44, 0x8A, 0xB7, 0x89, 0x43, 0x99, 0x37, 0xE9, 0x24, 0x6E, 0x97, 0x4D, 0x11, 0x61,
+    0x3D, 0x8C, 0x2B, 0xF3, 0xD9, 0x52, 0x6C, 0xAE, 0x3E, 0xBB, 0x53, 0x0C, 0xAA, 0xF4, 0x55, 0xD3,
+    0x79, 0xB1, 0xD6, 0xA9, 0xA4, 0xDD, 0xC0, 0x30, 0xE3, 0xB8, 0xD3, 0xDA, 0xED, 0xF8, 0xAF, 0x6D,
+    0xCC, 0xBB, 0xC7, 0x53, 0xDD, 0x45, 0x50, 0x52, 0xB0, 0x27, 0x13, 0xB6, 0x20, 0x33, 0xC7, 0x23,
+    0x16, 0x56, 0xC7, 0x32, 0x1D, 0xDC, 0xDB, 0xF1, 0x1D, 0x1E, 0x8F, 0xC4, 0x33, 0xE5, 0x36, 0x01,
+    0xCC, 0x78, 0x78, 0xAF, 0x1B, 0x1E, 0x2A, 0xEF, 0x60, 0x4F, 0x79, 0x8B, 0xEC, 0x24, 0xA7, 0x27,
+    0x60, 0xA6, 0x8F, 0x38, 0x42, 0xFD, 0x39, 0xBB, 0x3A, 0x1A, 0xF0, 0x88, 0xB6, 0xC7, 0xC8, 0x60,
+    0xD0, 0xB2, 0xDD, 0xD0, 0xDB, 0x23, 0xA6, 0x2C, 0xA8, 0xFC, 0xF7, 0x96, 0xE9, 0xD9, 0x1F, 0x0E,
+    0xD4, 0xC3, 0x7C, 0xE8, 0xC5, 0x30, 0xA8, 0x41, 0xF1, 0x98, 0xAA, 0x3F, 0xFD, 0x79, 0x7E, 0xE9,
+    0x80, 0xCC, 0xEA, 0xB2, 0xCC, 0xAD, 0xD8, 0xA5, 0xA3, 0xA5, 0x57, 0x40, 0x64, 0xD4, 0xB0, 0x69,
+    0x68, 0x81, 0xA0, 0xA6, 0x9E, 0x63, 0x2A, 0xB8, 0x8E, 0x29, 0xAB, 0x0B, 0x74, 0xA1, 0x51, 0xF8,
+    0x3F, 0x1B, 0x42, 0xC3, 0x7D, 0xE5, 0x00, 0x4E, 0xB1, 0x27, 0x00, 0x59, 0x3B, 0x0F, 0x16, 0x8C,
+    0x26, 0x0D, 0x67, 0xD2, 0x57, 0x6B, 0x53, 0x08, 0xF8, 0xEC, 0xA9, 0x61, 0x67, 0x1A, 0x0E, 0xD8,
+    0x03, 0x21, 0x3D, 0x82, 0x67, 0xBF, 0xE4, 0x9A, 0x3D, 0x7A, 0x7D, 0x6D, 0xA1, 0xDB, 0x53, 0xC8,
+    0xAB, 0xF3, 0x0F, 0x6A, 0xBE, 0xA5, 0x14, 0x3C, 0x10, 0x2C, 0x8B, 0x19, 0x06, 0x1E, 0x1C, 0xFC,
+    0x4C, 0x11, 0x47, 0x9A, 0xB1, 0xBD, 0x88, 0x23, 0x49, 0x25, 0xB5, 0x70, 0xBA, 0xF0, 0x18, 0x8D,
+    0xCF, 0x7E, 0xDF, 0x90, 0x7E, 0x60, 0xEF, 0xF0, 0x01, 0x3F, 0xD3, 0x86, 0x1B, 0xF9, 0xE0, 0xA7,
+    0xCE, 0x07, 0x2D, 0xB7, 0x5F, 0xAC, 0x37, 0x73, 0xAE, 0x20, 0xB0, 0x29, 0xAA, 0x30, 0x13, 0x00,
+    0x5C, 0xA4, 0x31, 0x67, 0x34, 0x47, 0x12, 0x01, 0xCA, 0x00, 0x05, 0xCD, 0x4E, 0x8B, 0xD0, 0x5F,
+    0x26, 0x76, 0x14, 0x3F, 0xAB, 0x59, 0xA8, 0x39, 0xC7, 0x94, 0x07, 0xAD, 0x2E, 0x31, 0xC4, 0x9E,
+    0xD7, 0xC7, 0x42, 0x4D, 0x5A, 0xE9, 0x9B, 0x10, 0xAA, 0x93, 0xBF, 0x21, 0x34, 0x0E, 0x5F, 0x40,
+    0xC8, 0x53, 0x81, 0x8C, 0x8D, 0xCA, 0xC4, 0x97, 0xA4, 0xAD, 0x82, 0x9B, 0x29, 0x60, 0x02, 0x42,
+    0x63, 0xCA, 0xD8, 0x43, 0xC5, 0x4E, 0x07, 0x9C, 0x6E, 0x6A, 0x3F, 0xF1, 0x3C, 0x16, 0xB1, 0xA5,
+    0x34, 0x07, 0x76, 0xB0, 0xC5, 0x87, 0x77, 0x5F, 0x1E, 0x8C, 0xF6, 0xF0, 0x0C, 0x14, 0x8C, 0x2F,
+    0x50, 0x86, 0xFB, 0x25, 0xEE, 0x6C, 0x2F, 0x1E, 0x0C, 0xC5, 0x08, 0x0D, 0x5F, 0x2E, 0xEB, 0xA2,
+    0x25, 0x21, 0x92, 0x2D, 0xE6, 0x28, 0xE6, 0xC8, 0xF3, 0x03, 0x0F, 0x3A, 0x2C, 0x95, 0x57, 0x0E,
+    0x16, 0x04, 0x7E, 0x97, 0x3E, 0x15, 0xD8, 0x5E, 0xED, 0x5E, 0x89, 0x7E, 0xB7, 0x0D, 0xBB, 0xED,
+    0x30, 0x94, 0xCD, 0xC1, 0x1D, 0x3C, 0x66, 0x2F, 0x47, 0xB8, 0x7B, 0x1C, 0x72, 0xD2, 0x8F, 0xE0,
+    0x33, 0xEC, 0x5A, 0x6C, 0x2D, 0x6F, 0x51, 0xAD, 0x79, 0x08, 0x62, 0x9B, 0x48, 0x9C, 0x06, 0xF5,
+    0xC8, 0x9C, 0x6C, 0x54, 0xA7, 0x86, 0x67, 0xB2, 0xCE, 0x4A, 0x4D, 0xEA, 0x49, 0xAD, 0x73, 0x8D,
+    0x4A, 0x39, 0x4D, 0x05, 0xCA, 0x07, 0x10, 0x1C, 0xA1, 0x24, 0x6C, 0x0F, 0x6D, 0x83, 0x3E, 0x8C,
+    0x4A, 0x54, 0x18, 0x90, 0x2D, 0xF0, 0xE0, 0xF8, 0xB5, 0x42, 0xBB, 0x2F, 0x81, 0xE7, 0x12, 0x0E,
+    0xDB, 0x8F, 0x51, 0x72, 0xDF, 0x4E, 0xDF, 0xDE, 0xFA, 0xE7, 0x39, 0x25, 0x49, 0xB3, 0x4B, 0xEA,
+    0x97, 0x7F, 0xA1, 0xF6, 0xEC, 0xF4, 0x11, 0xE6, 0xF7, 0xF9, 0x29, 0x4A, 0x34, 0xFE, 0xB6, 0x42,
+    0xE3, 0x20, 0xBF, 0xE4, 0x39, 0x72, 0x5D, 0x22, 0xD8, 0xC4, 0xA2, 0x84, 0x11, 0xFC, 0xA1, 0xA0,
+    0xE9, 0x1E, 0xA9, 0x57, 0xD6, 0x7F, 0x85, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x17,
+    0x67, 0x91, 0x57, 0xB9, 0x71, 0x85, 0x40, 0x76, 0x7C, 0x14, 0x14, 0x08, 0x9D, 0x39, 0x0A, 0x8A,
+    0x13, 0x3A, 0x7B, 0x57, 0xA2, 0xA0, 0xA0, 0x88, 0x0B, 0xDC, 0x90, 0xC2, 0x3D, 0x48, 0xD8, 0x85,
+    0x8B, 0x14, 0x67, 0x6E, 0x49, 0x0A, 0x5A, 0x17, 0xF4, 0xA4, 0x20, 0x12, 0x38, 0x12, 0xB8, 0x48,
+    0x61, 0x21, 0xE2, 0x1B, 0x83, 0x44, 0xBD, 0x09, 0x42, 0x29, 0x59, 0xF1, 0x23, 0x44, 0x2C, 0xC8,
+    0x20, 0xAD, 0xD1, 0x19, 0xCE, 0x3B, 0x7C, 0x6F, 0x76, 0xCF, 0x76, 0x0A, 0xC4, 0x48, 0xFB, 0xE6,
+    0x76, 0x76, 0xDE, 0x7B, 0xDF, 0x7B, 0xEF, 0x7B, 0xEF, 0xF0, 0xDA, 0x5B, 0xE0, 0x1A, 0xBA, 0x82,
+    0x72, 0xE4, 0x26, 0xE8, 0xA3, 0xC2, 0x10, 0x03, 0x8C, 0xD1, 0xC6, 0xBE, 0xB2, 0xD0, 0x28, 0xC3,
+    0x02, 0x5A, 0xD9, 0x30, 0x7F, 0x41, 0x07, 0x36, 0x32, 0xFB, 0x8B, 0x61, 0x11, 0x9B, 0x72, 0x29,
+    0xCC, 0x75, 0x66, 0x97, 0x23, 0xA3, 0x53, 0xFB, 0x62, 0x6C, 0xDA, 0x8A, 0x97, 0xB2, 0x97, 0x29,
+    0xDB, 0x58, 0xA6, 0x5A, 0x97, 0x86, 0xC6, 0x38, 0xA0, 0xA1, 0xD1, 0xD1, 0x29, 0xE6, 0xD0, 0xA6,
+    0x69, 0xAE, 0xB7, 0xBD, 0x7C, 0x8A, 0x4F, 0x60, 0x28, 0xFA, 0x40, 0xE8, 0x1C, 0x90, 0x88, 0x7B,
+    0x0D, 0x44, 0xB6, 0xE0, 0xC1, 0xEF, 0x40, 0x99, 0x18, 0xF4, 0xD5, 0x18, 0x31, 0xDA, 0x29, 0x8A,
+    0xC0, 0x62, 0x11, 0x2B, 0x08, 0x6C, 0x3B, 0xAF, 0x0D, 0x39, 0x67, 0x78, 0x6F, 0x00, 0x28, 0x88,
+    0xB2, 0x2B, 0x22, 0xE7, 0x4E, 0x31, 0x5D, 0x6B, 0x3E, 0x94, 0x14, 0xDA, 0x5F, 0x5D, 0x5D, 0x45,
+    0x6C, 0xE5, 0x1A, 0x1F, 0x55, 0xD2, 0xB1, 0x73, 0x62, 0x85, 0xDF, 0x95, 0x1C, 0xC7, 0xC4, 0x11,
+    0x0B, 0x06, 0x27, 0xB7, 0xC3, 0x9C, 0x47, 0x74, 0x09, 0xDC, 0x13, 0x8C, 0x63, 0xB9, 0x50, 0xD1,
+    0x9E, 0xF7, 0xDA, 0x15, 0x94, 0xF3, 0x2E, 0xAD, 0xBD, 0xD0, 0x84, 0x9B, 0x74, 0x45, 0x24, 0x55,
+    0xF5, 0x05, 0x6F, 0xFA, 0xD0, 0xC6, 0xDE, 0xCB, 0x1C, 0x2D, 0xFD, 0x53, 0x48, 0x70, 0xB4, 0xB7,
+    0x71, 0x22, 0x3F, 0xE4, 0xED, 0xE3, 0x07, 0xA9, 0xE8, 0x51, 0x24, 0x44, 0x1B, 0xB9, 0xAC, 0x79,
+    0x7B, 0x76, 0x24, 0xAA, 0x4E, 0x54, 0x2B, 0x71, 0x2B, 0xA1, 0x84, 0x93, 0xA9, 0xA0, 0xB2, 0x1C,
+    0xC4, 0x82, 0x1B, 0xFA, 0xFB, 0x6B, 0x44, 0xAD, 0x33, 0x46, 0xA2, 0x9D, 0x38, 0x67, 0x5C, 0x4C,
+    0x8F, 0x80, 0x71, 0x25, 0x41, 0x6F, 0xE4, 0x12, 0x89, 0x58, 0xF6, 0x19, 0xF1, 0xC1, 0x22, 0x1C,
+    0x7B, 0x33, 0xA5, 0xC8, 0x48, 0x82, 0x86, 0xAE, 0x65, 0xE1, 0x03, 0x91, 0x98, 0x91, 0xD4, 0xD2,
+    0x78, 0x36, 0x78, 0x39, 0xCA, 0x9A, 0x7C, 0x2A, 0xAF, 0xED, 0xCF, 0xBC, 0xC2, 0x96, 0x88, 0x25,
+    0xE2, 0x9E, 0x15, 0xEB, 0x5D, 0x71, 0x9C, 0x9C, 0x14, 0x33, 0x48, 0x8A, 0x2D, 0xB1, 0xD3, 0xA1,
+    0xC9, 0x42, 0x8B, 0x8F, 0x30, 0xA3, 0x53, 0x95, 0x23, 0x98, 0x60, 0x0F, 0xE4, 0x15, 0xBF, 0x24,
+    0xA9, 0xBE, 0x8D, 0xB6, 0x61, 0xD5, 0xDF, 0xB4, 0xEA, 0x91, 0x7B, 0xC0, 0x2F, 0xFA, 0x96, 0x43,
+    0x3F, 0x32, 0x89, 0x6D, 0x85, 0x36, 0x76, 0x47, 0x8F, 0xC7, 0x8A, 0x01, 0x54, 0x52, 0x56, 0x97,
+    0x86, 0x3E, 0x96, 0x79, 0xF7, 0x9B, 0x20, 0x4F, 0xA7, 0xB4, 0x81, 0x3D, 0xAB, 0x35, 0xBF, 0xFD,
+    0x8C, 0x9A, 0x04, 0xCD, 0x26, 0xA8, 0xE7, 0xD4, 0xC8, 0xD4, 0x45, 0xAA, 0x37, 0xDD, 0x6C, 0x75,
+    0x44, 0x49, 0x5A, 0x57, 0x4F, 0x92, 0x27, 0xDB, 0x18, 0x2F, 0xED, 0x72, 0xDD, 0x9A, 0x9A, 0x7C,
+    0xC7, 0xBF, 0x89, 0x6B, 0x32, 0xCB, 0x67, 0xD9, 0x19, 0x5D, 0xD3, 0xAB, 0x5D, 0x41, 0x65, 0xB5,
+    0xB6, 0x30, 0x96, 0x9B, 0x95, 0x42, 0x8A, 0x0D, 0x28, 0x6F, 0x51, 0x10, 0xB9, 0x1D, 0x3C, 0xB1,
+    0x88, 0x5C, 0x70, 0x5B, 0x5C, 0x72, 0x59, 0x4C, 0x93, 0x8F, 0x11, 0xFF, 0x64, 0xC2, 0xA2, 0x50,
+    0x76, 0x13, 0xE3, 0x0E, 0x96, 0x5B, 0x68, 0xBF, 0x91, 0x46, 0x3F, 0x1A, 0x55, 0x59, 0x22, 0x32,
+    0x11, 0xCD, 0x74, 0xAB, 0x26, 0xE3, 0xF0, 0x28, 0xD4, 0x1A, 0xD7, 0x45, 0x93, 0x9E, 0x7D, 0x64,
+    0x39, 0xBF, 0x05, 0xB7, 0xD7, 0xEF, 0xAF, 0x35, 0x04, 0x87, 0xF2, 0xA5, 0xD6, 0x75, 0x31, 0x31,
+    0xE5, 0x70, 0x73, 0x30, 0xF4, 0x07, 0x93, 0xF3, 0xD2, 0x0F, 0xD3, 0xF3, 0x03, 0x7B, 0x76, 0x10,
+    0x5E, 0x38, 0xC0, 0xEE, 0xEE, 0xA7, 0x91, 0x04, 0xBB, 0xC8, 0xDF, 0xAC, 0x1F, 0x0B, 0x39, 0x7B,
+    0xE7, 0x51, 0x3A, 0x12, 0x72, 0x95, 0x3E, 0xBF, 0xC3, 0x31, 0x59, 0x96, 0x31, 0x17, 0x54, 0x5D,
+    0xE1, 0x85, 0xAF, 0x68, 0xC0, 0xD6, 0x29, 0x1F, 0xD6, 0xB6, 0x1A, 0x4B, 0xBE, 0xB9, 0xC8, 0x0B,
+    0x0C, 0x9E, 0x43, 0x78, 0x44, 0xCE, 0x56, 0x69, 0x5C, 0xA5, 0x18, 0x5A, 0xA8, 0xAB, 0x1F, 0x1A,
+    0x24, 0x95, 0x74, 0x84, 0x62, 0xF8, 0x57, 0xEF, 0x61, 0xA0, 0xAC, 0x36, 0xF1, 0xB7, 0x63, 0xA6,
+    0x83, 0xC4, 0x49, 0x2F, 0x04, 0x3E, 0x9D, 0x1B, 0x20, 0xB9, 0xA0, 0x0E, 0x24, 0xED, 0xA7, 0x32,
+    0xBF, 0x38, 0xA9, 0xFE, 0x60, 0x2B, 0x1C, 0x17, 0x16, 0x2B, 0x57, 0x34, 0xA2, 0xAF, 0x8D, 0xC5,
+    0xDD, 0x7E, 0x0B, 0x3A, 0xFC, 0x20, 0x87, 0xDD, 0xEA, 0xE0, 0x4A, 0x1C, 0x9A, 0xC0, 0xD8, 0x1E,
+    0xFA, 0xAD, 0x38, 0x0D, 0x0F, 0x73, 0x8B, 0xEB, 0x9D, 0x36, 0xA2, 0x9B, 0x87, 0x85, 0x6F, 0xB1,
+    0xEA, 0x42, 0x8B, 0xAD, 0x4F, 0x5B, 0x4C, 0x46, 0x41, 0x89, 0xBA, 0xC5, 0x18, 0x9C, 0xC4, 0xB5,
+    0x8D, 0x6E, 0x8E, 0x35, 0xA1, 0x65, 0xE0, 0x69, 0x2A, 0x72, 0x87, 0xFA, 0xE7, 0x2D, 0x36, 0x7B,
+    0xE7, 0xEF, 0xCF, 0x64, 0x58, 0x08, 0x19, 0x92, 0x9A, 0x12, 0x6D, 0x9F, 0xED, 0xEE, 0x7F, 0xB4,
+    0x58, 0x20, 0xAE, 0x19, 0xE3, 0x62, 0x13, 0x19, 0x13, 0xA2, 0x72, 0x75, 0x10, 0x1E, 0x8E, 0x4E,
+    0xF4, 0xA8, 0x22, 0x15, 0x52, 0x4F, 0x59, 0xC9, 0xA8, 0x20, 0x80, 0x50, 0xB1, 0x2B, 0x8E, 0xA6,
+    0x39, 0x79, 0x9E, 0x59, 0x98, 0x08, 0x7C, 0x49, 0x44, 0x16, 0xFC, 0xF5, 0xB0, 0xD0, 0x37, 0x0F,
+    0xCB, 0xED, 0xD0, 0x0C, 0x36, 0xA3, 0x6C, 0xCE, 0xDB, 0x96, 0xBC, 0xCB, 0x23, 0x3E, 0x96, 0x1A,
+    0x3F, 0x3D, 0xD1, 0x95, 0x2C, 0x0A, 0xBA, 0xBB, 0xFE, 0x30, 0xE5, 0x85, 0x83, 0x34, 0x4E, 0x37,
+    0xAA, 0xD7, 0x8D, 0x1A, 0x55, 0x05, 0xD4, 0xA8, 0xAC, 0x19, 0x22, 0x9E, 0xA5, 0x9B, 0xDE, 0x6F,
+    0x38, 0xD6, 0x50, 0xBC, 0xDF, 0x3C, 0x4B, 0x8D, 0xED, 0xA9, 0x1F, 0xFA, 0x7C, 0x85, 0xBE, 0x05,
+    0x83, 0xBE, 0x71, 0x38, 0x0E, 0x8E, 0xBF, 0x2B, 0x98, 0x8C, 0xCC, 0x63, 0x14, 0xAC, 0x82, 0xF9,
+    0xE9, 0xDA, 0xFD, 0x9E, 0xAF, 0x65, 0x24, 0xE9, 0x4B, 0x3D, 0xA6, 0x98, 0xD4, 0x9F, 0xFF, 0x61,
+    0x47, 0x63, 0xA1, 0x7B, 0x32, 0x5F, 0x5D, 0x86, 0x3B, 0x21, 0x8C, 0x89, 0x96, 0x3E, 0xBF, 0x34,
+    0xF1, 0xC3, 0x39, 0xCA, 0xFD, 0xB6, 0x0D, 0xCD, 0x2D, 0x32, 0xDE, 0x63, 0xFF, 0x89, 0x96, 0xEB,
+    0x78, 0xDA, 0x45, 0xCE, 0x04, 0x0F, 0xDB, 0xCA, 0xEE, 0xED, 0xF7, 0x5A, 0x41, 0x06, 0xE6, 0x7F,
+    0xA1, 0x66, 0x50, 0xCF, 0x3B, 0xC3, 0x66, 0x3D, 0xDC, 0x36, 0xEB, 0xB7, 0x5E, 0xFD, 0x6D, 0x81,
+    0x67, 0x05, 0xFA, 0x3A, 0xCC, 0xCA, 0xBD, 0x52, 0xFD, 0xFA, 0x1E, 0x8B, 0x9B, 0xF9, 0xBF, 0x10,
+    0xEA, 0xE2, 0x5D, 0x3C, 0xE3, 0x26, 0x91, 0xFB, 0x08, 0x9A, 0x79, 0x59, 0x61, 0x22, 0xAC, 0x34,
+    0xEA, 0x30, 0xD5, 0xAC, 0x6E, 0x1F, 0x31, 0xD9, 0x17, 0xDD, 0xF7, 0x3D, 0xF4, 0x89, 0x8C, 0x87,
+    0x5F, 0x80, 0x6B, 0x0C, 0x38, 0x62, 0xC0, 0x6C, 0xED, 0xEE, 0x37, 0x26, 0x2A, 0x35, 0x47, 0x7C,
+    0x3F, 0xC9, 0xF0, 0xA7, 0x15, 0xE0, 0x98, 0x69, 0xC0, 0x2E, 0xF9, 0xB4, 0xC5, 0x69, 0x27, 0x34,
+    0xFD, 0x20, 0xEF, 0x91, 0xB1, 0x28, 0xF7, 0x30, 0xB0, 0x58, 0xE6, 0x3F, 0x6A, 0xFE, 0xE5, 0xBA,
+    0xE1, 0x0C, 0x9A, 0x39, 0x9B, 0xC8, 0x78, 0x15, 0xD8, 0xA7, 0xEF, 0xAD, 0xA0, 0xE8, 0x51, 0x21,
+    0xCA, 0x3A, 0x1A, 0x97, 0x17, 0xD1, 0x22, 0x82, 0xEB, 0x32, 0xE1, 0xC3, 0xE3, 0xCF, 0x39, 0xBE,
+    0x82, 0x6A, 0x15, 0xFF, 0xB7, 0xFE, 0x05, 0x75, 0x55, 0x3D, 0x73, 0xDC, 0x54, 0x14, 0xBD, 0x4F,
+    0x8F, 0x58, 0x33, 0x16, 0xC9, 0x73, 0x01, 0x0D, 0x31, 0x28, 0x05, 0x85, 0x0B, 0x8F, 0x95, 0x62,
+    0x8B, 0x2D, 0xD6, 0x96, 0x20, 0x43, 0x4F, 0x41, 0x60, 0x06, 0x8A, 0xE4, 0x1F, 0xC4, 0x85, 0x8B,
+    0x14, 0x9B, 0x5D, 0xE1, 0x3F, 0x40, 0x8A, 0xF4, 0xB8, 0x20, 0xC3, 0x00, 0x2D, 0x05, 0x33, 0xD9,
+    0x58, 0xCF, 0x35, 0x8D, 0x98, 0x4C, 0x7A, 0x65, 0x80, 0xA1, 0xA0, 0xB0, 0x98, 0x51, 0xA1, 0xCC,
+    0x68, 0xF7, 0x71, 0xCE, 0xD3, 0xCA, 0x76, 0x8A, 0x68, 0x46, 0xD7, 0xAB, 0xF7, 0x71, 0xEE, 0xB9,
+    0xE7, 0x7E, 0x58, 0x72, 0x11, 0xD1, 0x34, 0x09, 0x5E, 0xA9, 0xF1, 0x86, 0xFC, 0x9A, 0xE0, 0x0D,
+    0x9C, 0x73, 0x5D, 0xCC, 0xE5, 0x05, 0xCD, 0x8C, 0x66, 0x8E, 0x35, 0x49, 0x33, 0xFC, 0x4A, 0x65,
+    0x30, 0x63, 0x19, 0x9E, 0x77, 0x68, 0x8E, 0x46, 0x22, 0xAA, 0x06, 0x40, 0x54, 0xCF, 0x71, 0xA2,
+    0x7A, 0x66, 0xA5, 0x2D, 0xFF, 0xAC, 0xC2, 0x57, 0xF6, 0x8F, 0x26, 0xFE, 0xF4, 0xCC, 0x2E, 0x26,
+    0xFA, 0xD8, 0x8E, 0xB7, 0xF4, 0x1D, 0xF8, 0x09, 0x35, 0xA0, 0xA2, 0x10, 0xB7, 0xAE, 0x1B, 0x98,
+    0x77, 0x6F, 0xC0, 0x6C, 0x7F, 0x08, 0xB3, 0xB3, 0x0B, 0x33, 0x22, 0xF2, 0xED, 0x91, 0x87, 0xDE,
+    0xC2, 0xAB, 0x4A, 0x98, 0xC8, 0xC2, 0xF0, 0xB0, 0x7C, 0x44, 0x33, 0xD1, 0x64, 0xC9, 0x5F, 0xBF,
+    0x91, 0x32, 0x03, 0x98, 0x19, 0x2C, 0xF1, 0xE8, 0x92, 0xC7, 0xCB, 0x81, 0x7F, 0xB9, 0x26, 0x79,
+    0xFF, 0x3E, 0xCC, 0xE1, 0x68, 0xC0, 0x1F, 0xD3, 0xD3, 0xEE, 0x36, 0xBD, 0x5F, 0x27, 0x0F, 0x52,
+    0xD8, 0x8C, 0xA8, 0x03, 0x68, 0x1D, 0x69, 0x9D, 0xDF, 0x9E, 0xE9, 0x3B, 0x76, 0x61, 0x8E, 0x8F,
+    0xCF, 0x9A, 0xE0, 0xBF, 0xB3, 0x17, 0x95, 0x3C, 0x2F, 0xFF, 0xB5, 0x12, 0x57, 0x05, 0x84, 0xAB,
+    0xA7, 0x14, 0x8D, 0x58, 0x1F, 0xDF, 0x5A, 0xC3, 0x23, 0x2A, 0xE5, 0x35, 0x01, 0xDB, 0xC4, 0xD3,
+    0x32, 0x9E, 0x30, 0x65, 0x55, 0x95, 0x26, 0xFB, 0x09, 0x95, 0x75, 0xEE, 0x8C, 0x64, 0xA5, 0xF1,
+    0xE4, 0xD2, 0xB0, 0xF2, 0x12, 0x53, 0xDF, 0xA5, 0xE8, 0xC6, 0x93, 0x87, 0xBA, 0x1D, 0x9D, 0x78,
+    0xFE, 0x63, 0xD9, 0xBE, 0xD0, 0x59, 0x13, 0x11, 0xF1, 0xEC, 0xE1, 0xD0, 0xB4, 0x28, 0x55, 0xFD,
+    0x63, 0x17, 0xD6, 0x27, 0x87, 0x71, 0x7D, 0x22, 0xB3, 0xC3, 0x13, 0xD9, 0xC1, 0x2B, 0x6F, 0x79,
+    0xB9, 0xC7, 0x33, 0x3C, 0xCB, 0x3B, 0xBC, 0x4B, 0x0C, 0xD9, 0xEB, 0x7A, 0xCC, 0xC0, 0x7B, 0x88,
+    0x99, 0xE2, 0x82, 0x66, 0x8F, 0x9F, 0x0F, 0xA9, 0x6D, 0x39, 0x08, 0x3F, 0xE9, 0x73, 0x11, 0xB5,
+    0x46, 0x94, 0xEB, 0x1E, 0x4A, 0x92, 0x3F, 0xB3, 0xAA, 0x15, 0x27, 0x26, 0x0F, 0x1A, 0x79, 0x84,
+    0x14, 0x21, 0x0F, 0xFB, 0xFC, 0x53, 0x49, 0xF2, 0x12, 0x3A, 0xA5, 0x0E, 0x01, 0x15, 0x0E, 0x70,
+    0x0F, 0x2A, 0xB9, 0x7C, 0x36, 0xDC, 0x09, 0xCB, 0xC4, 0xB9, 0xF3, 0x4C, 0x42, 0xF7, 0x25, 0x72,
+    0xA6, 0x5C, 0xA6, 0xC1, 0x63, 0x9E, 0xCB, 0xBC, 0x14, 0x53, 0x4B, 0xB2, 0x92, 0xA0, 0x93, 0xE8,
+    0xF7, 0x0A, 0x35, 0x17, 0x54, 0xA7, 0x60, 0x2C, 0x2D, 0x32, 0xBA, 0x04, 0x7A, 0x27, 0xC6, 0xC6,
+    0x99, 0x81, 0xE3, 0x90, 0xCE, 0x93, 0x6F, 0x6B, 0x9E, 0x69, 0x17, 0x28, 0x3B, 0x5E, 0xD3, 0x4B,
+    0xD4, 0xEF, 0xCB, 0x6F, 0x1C, 0x32, 0x05, 0x49, 0x1B, 0x20, 0x3B, 0xB7, 0x22, 0x13, 0xE7, 0x72,
+    0x31, 0x0F, 0x58, 0x20, 0xDA, 0x26, 0xEE, 0xB1, 0xC8, 0x2D, 0x79, 0xE3, 0x99, 0xD3, 0x38, 0x8A,
+    0x4C, 0xBE, 0xD1, 0x39, 0xD2, 0x16, 0x7F, 0x07, 0x93, 0x1A, 0xA4, 0xEE, 0x39, 0x8C, 0x6A, 0x21,
+    0x93, 0xAE, 0xA3, 0x0A, 0x72, 0xD1, 0x57, 0x0E, 0x52, 0x73, 0x66, 0x89, 0x79, 0xD3, 0xAD, 0xE8,
+    0x16, 0xAB, 0xBA, 0x8B, 0xFF, 0xBE, 0xFB, 0x55, 0x97, 0xB0, 0x38, 0xE9, 0xB3, 0x0D, 0x61, 0x6C,
+    0xC1, 0x52, 0x6D, 0xA5, 0x11, 0x93, 0xC5, 0xE8, 0x11, 0xA8, 0x94, 0xC8, 0x81, 0xE8, 0x4A, 0x97,
+    0x08, 0x68, 0x2A, 0xA1, 0x45, 0x71, 0x2F, 0x70, 0xC0, 0xE4, 0xD0, 0xB9, 0x51, 0xB5, 0xC4, 0x90,
+    0x3F, 0xA8, 0xB1, 0x7D, 0x80, 0x6D, 0x5D, 0x62, 0x7B, 0x8A, 0xED, 0xC8, 0x9A, 0x4C, 0xDE, 0x93,
+    0x1D, 0xDE, 0xB4, 0x1E, 0xC2, 0x63, 0x11, 0xD4, 0xA3, 0x63, 0x3F, 0xC7, 0xC1, 0x05, 0x6E, 0x84,
+    0x16, 0xBB, 0xFB, 0xD8, 0xD7, 0xA0, 0x9B, 0xA1, 0x1E, 0x5B, 0xA0, 0xFA, 0xFB, 0x04, 0x22, 0x22,
+    0xFB, 0xA7, 0x4C, 0x29, 0x0E, 0x84, 0xCA, 0x90, 0x8C, 0xD2, 0xB7, 0xD9, 0x64, 0x98, 0x0B, 0x47,
+    0x6C, 0x22, 0x6A, 0xC2, 0xCC, 0x6D, 0xAF, 0x3F, 0x58, 0x06, 0xF1, 0xBA, 0x38, 0xF6, 0xF1, 0x3E,
+    0xA2, 0x70, 0x3F, 0xFF, 0x24, 0x88, 0x37, 0x43, 0xF7, 0xD9, 0x41, 0xCC, 0xCD, 0x62, 0x95, 0x52,
+    0x76, 0xF1, 0xE3, 0xC4, 0xF7, 0xA3, 0xFB, 0x81, 0xF7, 0x59, 0x59, 0x60, 0xC6, 0x67, 0xEA, 0x6D,
+    0x2B, 0x43, 0xFB, 0x4A, 0xE8, 0x3B, 0xD5, 0x78, 0x90, 0x24, 0xBB, 0xC8, 0x89, 0x6F, 0x67, 0x96,
+    0x83, 0xF8, 0x9E, 0x40, 0xE2, 0x0C, 0x29, 0x2D, 0x62, 0x1E, 0x3C, 0x4D, 0x73, 0x3F, 0x9D, 0x7C,
+    0x2F, 0x79, 0x87, 0xA9, 0x3F, 0x98, 0x34, 0xFE, 0xEA, 0xCD, 0x66, 0x03, 0xAA, 0xBA, 0x57, 0xAE,
+    0xD2, 0xAF, 0xEF, 0xCD, 0xEE, 0x41, 0x9A, 0x79, 0x36, 0x32, 0x88, 0x5F, 0x7F, 0x52, 0x81, 0xC0,
+    0x68, 0x57, 0xA2, 0x3C, 0xD4, 0x56, 0x75, 0xAA, 0x3A, 0xF8, 0xAC, 0x70, 0x1D, 0x1A, 0x74, 0xEE,
+    0x72, 0xE3, 0x5E, 0x38, 0x54, 0x70, 0x15, 0xFD, 0xD5, 0x47, 0x90, 0xF8, 0xE2, 0x0D, 0xFB, 0xF0,
+    0x66, 0x7D, 0x27, 0xF6, 0xF5, 0x9C, 0xC8, 0x65, 0x10, 0xFD, 0x84, 0x1A, 0xA2, 0x53, 0x3E, 0xA4,
+    0x75, 0x34, 0x5E, 0xA7, 0x21, 0xCC, 0xB5, 0x08, 0xFD, 0x70, 0x1A, 0x80, 0xE2, 0x7E, 0xCD, 0x73,
+    0x5F, 0x0B, 0xF1, 0x26, 0xF8, 0x1A, 0xE8, 0x94, 0x66, 0x27, 0xAA, 0xBD, 0xA2, 0x8E, 0xB1, 0xA7,
+    0xFD, 0x14, 0x9C, 0xF7, 0xEC, 0x92, 0xF6, 0x6A, 0x4D, 0xA7, 0x92, 0x58, 0x53, 0x47, 0xAD, 0xBA,
+    0x7B, 0x75, 0xF5, 0x8B, 0x8B, 0xF5, 0xFE, 0x3B, 0x5A, 0xCA, 0x58, 0xD7, 0xBF, 0x9A, 0x6C, 0xA1,
+    0xFF, 0xA9, 0x36, 0xB2, 0xE8, 0x0A, 0x44, 0x52, 0x06, 0x59, 0xFC, 0x7D, 0x36, 0xD5, 0xE5, 0x7E,
+    0x9C, 0x2D, 0x84, 0xD3, 0x55, 0x7D, 0x7E, 0xB9, 0xED, 0x27, 0xD3, 0xD1, 0x30, 0x64, 0x7D, 0xD9,
+    0x6C, 0xF2, 0x6B, 0xD7, 0x33, 0xEA, 0x58, 0x16, 0x4B, 0x29, 0xCE, 0x19, 0xDB, 0x8D, 0x61, 0x80,
+    0xF0, 0x7F, 0x4D, 0x80, 0x86, 0xB0, 0x11, 0x3B, 0xA3, 0x1F, 0x33, 0x8B, 0x41, 0xB0, 0xD0, 0x0E,
+    0xFA, 0x1C, 0x5C, 0x65, 0xBC, 0x35, 0x1C, 0x0A, 0x98, 0xE8, 0x68, 0x35, 0x04, 0x5A, 0x54, 0x5C,
+    0xE2, 0xF0, 0x62, 0xCF, 0x72, 0x76, 0xE0, 0xB6, 0x63, 0xD6, 0x6E, 0xBA, 0xD7, 0x5E, 0xA2, 0x55,
+    0xC6, 0x71, 0x43, 0x8D, 0x95, 0xD7, 0x5B, 0x49, 0x40, 0xFE, 0xCA, 0xAD, 0x9E, 0x88, 0x7C, 0x50,
+    0x78, 0x09, 0xD5, 0xD7, 0x28, 0x96, 0xEC, 0x22, 0x0B, 0x3D, 0x96, 0x9F, 0x02, 0xC8, 0xF9, 0xA5,
+    0x8D, 0x7A, 0x4B, 0xB5, 0x55, 0x61, 0xE9, 0x02, 0xD3, 0xA5, 0x80, 0xB7, 0xDE, 0x0B, 0x47, 0x9D,
+    0xC4, 0x8F, 0xBD, 0x8F, 0xF5, 0xF3, 0xBE, 0xC8, 0xB5, 0x5F, 0x5C, 0x8D, 0x11, 0xB4, 0x7A, 0x2A,
+    0x07, 0x4F, 0xB9, 0xF4, 0x3F,
+};
+
+static const uint32_t opendyslexic_12_italicBlockOffsets[33] = {
+    0, 1139, 2229, 3267, 4459, 5720, 6541, 7110,
+    8106, 9053, 9909, 10687, 11641, 12523, 13148, 13963,
+    14797, 15743, 16886, 17957, 19056, 20262, 21417, 22588,
+    23699, 24886, 26020, 27126, 28162, 29268, 30438, 31591,
+    32629,
+};
+
+static const uint16_t opendyslexic_12_italicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_12_italicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_12_italicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
@@ -4007,704 +2216,704 @@ static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 17, 19, 17, 2, 19, 81, 1831 }, // 8
     { 16, 19, 17, 3, 19, 76, 1912 }, // 9
     { 9, 15, 7, 1, 15, 34, 1988 }, // :
-    { 10, 18, 8, 0, 14, 45, 2022 }, // ;
-    { 19, 15, 20, -1, 16, 72, 2067 }, // <
-    { 14, 9, 15, 2, 11, 32, 2139 }, // =
-    { 19, 15, 20, 2, 16, 72, 2171 }, // >
-    { 16, 28, 14, 4, 28, 112, 2243 }, // ?
-    { 25, 21, 30, 3, 20, 132, 2355 }, // @
-    { 20, 21, 25, 1, 21, 105, 2487 }, // A
-    { 19, 22, 21, 1, 22, 105, 2592 }, // B
-    { 22, 23, 22, 1, 22, 127, 2697 }, // C
-    { 22, 22, 24, 1, 22, 121, 2824 }, // D
-    { 19, 22, 20, 1, 22, 105, 2945 }, // E
-    { 18, 22, 18, 1, 22, 99, 3050 }, // F
-    { 21, 22, 25, 2, 22, 116, 3149 }, // G
-    { 23, 22, 23, 1, 22, 127, 3265 }, // H
-    { 10, 21, 10, 1, 21, 53, 3392 }, // I
-    { 18, 28, 15, -1, 22, 126, 3445 }, // J
-    { 20, 21, 22, 1, 21, 105, 3571 }, // K
-    { 15, 22, 19, 1, 22, 83, 3676 }, // L
-    { 26, 22, 27, 1, 22, 143, 3759 }, // M
-    { 24, 22, 23, 1, 22, 132, 3902 }, // N
-    { 24, 22, 25, 2, 21, 132, 4034 }, // O
-    { 20, 21, 20, 1, 21, 105, 4166 }, // P
-    { 24, 26, 26, 1, 22, 156, 4271 }, // Q
-    { 19, 22, 21, 1, 22, 105, 4427 }, // R
-    { 22, 23, 25, 1, 22, 127, 4532 }, // S
-    { 20, 21, 23, 5, 21, 105, 4659 }, // T
-    { 23, 23, 23, 1, 22, 133, 4764 }, // U
-    { 21, 22, 25, 6, 22, 116, 4897 }, // V
-    { 28, 21, 32, 5, 21, 147, 5013 }, // W
-    { 24, 22, 25, 1, 22, 132, 5160 }, // X
-    { 18, 21, 23, 6, 21, 95, 5292 }, // Y
-    { 25, 21, 25, 1, 21, 132, 5387 }, // Z
-    { 18, 35, 12, -1, 27, 158, 5519 }, // [
-    { 4, 24, 12, 6, 19, 24, 5677 }, // <backslash>
-    { 18, 35, 12, -6, 27, 158, 5701 }, // ]
-    { 10, 5, 14, 5, 23, 13, 5859 }, // ^
-    { 18, 4, 20, 0, -2, 18, 5872 }, // _
-    { 7, 4, 10, 6, 19, 7, 5890 }, // `
-    { 16, 15, 19, 1, 15, 60, 5897 }, // a
-    { 15, 23, 20, 3, 22, 87, 5957 }, // b
-    { 13, 16, 17, 1, 15, 52, 6044 }, // c
-    { 20, 22, 19, 1, 21, 110, 6096 }, // d
-    { 16, 15, 19, 1, 15, 60, 6206 }, // e
-    { 13, 20, 14, 2, 20, 65, 6266 }, // f
-    { 18, 21, 18, 0, 14, 95, 6331 }, // g
-    { 16, 21, 19, 1, 21, 84, 6426 }, // h
-    { 10, 22, 9, 1, 22, 55, 6510 }, // i
-    { 16, 28, 16, 2, 21, 112, 6565 }, // j
-    { 13, 20, 19, 1, 20, 65, 6677 }, // k
-    { 10, 21, 12, 1, 21, 53, 6742 }, // l
-    { 25, 14, 28, 1, 14, 88, 6795 }, // m
-    { 16, 14, 19, 1, 14, 56, 6883 }, // n
-    { 17, 14, 19, 1, 14, 60, 6939 }, // o
-    { 20, 21, 20, -1, 14, 105, 6999 }, // p
-    { 18, 21, 22, 1, 15, 95, 7104 }, // q
-    { 13, 14, 15, 1, 14, 46, 7199 }, // r
-    { 15, 14, 18, 1, 14, 53, 7245 }, // s
-    { 11, 19, 16, 4, 19, 53, 7298 }, // t
-    { 15, 15, 18, 2, 14, 57, 7351 }, // u
-    { 16, 14, 21, 4, 14, 56, 7408 }, // v
-    { 20, 14, 24, 4, 14, 70, 7464 }, // w
-    { 18, 14, 21, 1, 14, 63, 7534 }, // x
-    { 19, 21, 19, 0, 14, 100, 7597 }, // y
-    { 17, 14, 19, 1, 14, 60, 7697 }, // z
-    { 15, 24, 14, 3, 19, 90, 7757 }, // {
-    { 10, 22, 6, 0, 18, 55, 7847 }, // |
-    { 14, 24, 16, 0, 19, 84, 7902 }, // }
-    { 10, 5, 15, 5, 19, 13, 7986 }, // ~
-    { 0, 0, 21, 0, 0, 0, 7999 }, //  
-    { 10, 25, 11, 2, 19, 63, 7999 }, // ¡
-    { 13, 22, 17, 1, 19, 72, 8062 }, // ¢
-    { 19, 24, 17, 1, 24, 114, 8134 }, // £
-    { 15, 14, 17, 3, 16, 53, 8248 }, // ¤
-    { 19, 21, 19, 3, 18, 100, 8301 }, // ¥
-    { 10, 22, 6, 0, 18, 55, 8401 }, // ¦
-    { 19, 22, 21, 1, 19, 105, 8456 }, // §
-    { 12, 5, 13, 5, 20, 15, 8561 }, // ¨
-    { 11, 10, 13, 6, 23, 28, 8576 }, // ©
-    { 9, 9, 10, 4, 19, 21, 8604 }, // ª
-    { 17, 12, 20, 2, 12, 51, 8625 }, // «
-    { 13, 8, 15, 3, 9, 26, 8676 }, // ¬
-    { 13, 3, 14, 3, 9, 10, 8702 }, // ­
-    { 11, 10, 13, 7, 27, 28, 8712 }, // ®
-    { 10, 3, 13, 6, 18, 8, 8740 }, // ¯
-    { 13, 12, 13, 4, 20, 39, 8748 }, // °
-    { 16, 15, 18, 0, 14, 60, 8787 }, // ±
-    { 9, 9, 7, 2, 20, 21, 8847 }, // ²
-    { 8, 10, 8, 3, 20, 20, 8868 }, // ³
-    { 6, 5, 7, 5, 19, 8, 8888 }, // ´
-    { 18, 17, 18, -1, 14, 77, 8896 }, // µ
-    { 17, 21, 15, 1, 18, 90, 8973 }, // ¶
-    { 6, 5, 7, 2, 11, 8, 9063 }, // ·
-    { 7, 7, 8, 0, 1, 13, 9071 }, // ¸
-    { 6, 10, 7, 3, 21, 15, 9084 }, // ¹
-    { 9, 8, 11, 4, 18, 18, 9099 }, // º
-    { 17, 12, 16, -3, 12, 51, 9117 }, // »
-    { 20, 24, 28, 6, 22, 120, 9168 }, // ¼
-    { 22, 23, 28, 6, 21, 127, 9288 }, // ½
-    { 21, 24, 28, 5, 22, 126, 9415 }, // ¾
-    { 16, 28, 14, -2, 15, 112, 9541 }, // ¿
-    { 20, 28, 25, 1, 28, 140, 9653 }, // À
-    { 21, 33, 25, 1, 33, 174, 9793 }, // Á
-    { 21, 27, 25, 1, 27, 142, 9967 }, // Â
-    { 22, 29, 25, 1, 29, 160, 10109 }, // Ã
-    { 23, 29, 25, 1, 29, 167, 10269 }, // Ä
-    { 20, 30, 25, 1, 30, 150, 10436 }, // Å
-    { 33, 23, 36, 1, 22, 190, 10586 }, // Æ
-    { 22, 28, 22, 1, 22, 154, 10776 }, // Ç
-    { 19, 28, 20, 1, 28, 133, 10930 }, // È
-    { 19, 32, 20, 1, 32, 152, 11063 }, // É
-    { 19, 27, 20, 1, 27, 129, 11215 }, // Ê
-    { 20, 29, 20, 1, 29, 145, 11344 }, // Ë
-    { 12, 29, 10, 1, 29, 87, 11489 }, // Ì
-    { 14, 34, 10, 1, 34, 119, 11576 }, // Í
-    { 14, 28, 10, 1, 28, 98, 11695 }, // Î
-    { 15, 30, 10, 1, 30, 113, 11793 }, // Ï
-    { 23, 22, 24, 0, 22, 127, 11906 }, // Ð
-    { 24, 27, 23, 1, 27, 162, 12033 }, // Ñ
-    { 24, 29, 25, 2, 28, 174, 12195 }, // Ò
-    { 24, 33, 25, 2, 32, 198, 12369 }, // Ó
-    { 24, 28, 25, 2, 27, 168, 12567 }, // Ô
-    { 24, 29, 25, 2, 28, 174, 12735 }, // Õ
-    { 24, 29, 25, 2, 28, 174, 12909 }, // Ö
-    { 13, 7, 15, 2, 10, 23, 13083 }, // ×
-    { 44, 41, 25, -9, 31, 451, 13106 }, // Ø
-    { 23, 30, 23, 1, 29, 173, 13557 }, // Ù
-    { 23, 34, 23, 1, 33, 196, 13730 }, // Ú
-    { 23, 29, 23, 1, 28, 167, 13926 }, // Û
-    { 23, 30, 23, 1, 29, 173, 14093 }, // Ü
-    { 18, 33, 23, 6, 33, 149, 14266 }, // Ý
-    { 16, 20, 14, 1, 20, 80, 14415 }, // Þ
-    { 18, 20, 17, 1, 20, 90, 14495 }, // ß
-    { 16, 20, 19, 1, 20, 80, 14585 }, // à
-    { 16, 24, 19, 1, 24, 96, 14665 }, // á
-    { 17, 20, 19, 1, 20, 85, 14761 }, // â
-    { 16, 20, 19, 1, 20, 80, 14846 }, // ã
-    { 17, 21, 19, 1, 21, 90, 14926 }, // ä
-    { 16, 22, 19, 1, 22, 88, 15016 }, // å
-    { 26, 15, 31, 1, 15, 98, 15104 }, // æ
-    { 13, 21, 17, 1, 15, 69, 15202 }, // ç
-    { 16, 23, 19, 1, 23, 92, 15271 }, // è
-    { 17, 27, 19, 1, 27, 115, 15363 }, // é
-    { 17, 22, 19, 1, 22, 94, 15478 }, // ê
-    { 18, 24, 19, 1, 24, 108, 15572 }, // ë
-    { 9, 21, 9, 1, 21, 48, 15680 }, // ì
-    { 12, 25, 9, 1, 25, 75, 15728 }, // í
-    { 12, 20, 9, 1, 20, 60, 15803 }, // î
-    { 13, 22, 9, 1, 22, 72, 15863 }, // ï
-    { 22, 20, 21, 2, 20, 110, 15935 }, // ð
-    { 18, 21, 19, 1, 21, 95, 16045 }, // ñ
-    { 17, 23, 19, 1, 23, 98, 16140 }, // ò
-    { 17, 27, 19, 1, 27, 115, 16238 }, // ó
-    { 17, 22, 19, 1, 22, 94, 16353 }, // ô
-    { 17, 23, 19, 1, 23, 98, 16447 }, // õ
-    { 18, 23, 19, 1, 23, 104, 16545 }, // ö
-    { 16, 16, 19, 4, 16, 64, 16649 }, // ÷
-    { 24, 39, 19, -3, 26, 234, 16713 }, // ø
-    { 15, 22, 18, 2, 21, 83, 16947 }, // ù
-    { 15, 26, 18, 2, 25, 98, 17030 }, // ú
-    { 15, 21, 18, 2, 20, 79, 17128 }, // û
-    { 16, 22, 18, 2, 21, 88, 17207 }, // ü
-    { 19, 34, 19, 0, 27, 162, 17295 }, // ý
-    { 15, 26, 14, 1, 21, 98, 17457 }, // þ
-    { 20, 30, 19, 0, 23, 150, 17555 }, // ÿ
-    { 22, 28, 25, 1, 28, 154, 17705 }, // Ā
-    { 17, 20, 19, 1, 20, 85, 17859 }, // ā
-    { 22, 31, 25, 1, 31, 171, 17944 }, // Ă
-    { 17, 22, 19, 1, 22, 94, 18115 }, // ă
-    { 20, 27, 25, 1, 21, 135, 18209 }, // Ą
-    { 16, 20, 19, 1, 15, 80, 18344 }, // ą
-    { 22, 33, 22, 1, 32, 182, 18424 }, // Ć
-    { 15, 24, 17, 1, 23, 90, 18606 }, // ć
-    { 22, 31, 22, 1, 30, 171, 18696 }, // Ĉ
-    { 17, 22, 17, 1, 21, 94, 18867 }, // ĉ
-    { 22, 32, 22, 1, 31, 176, 18961 }, // Ċ
-    { 13, 23, 17, 1, 22, 75, 19137 }, // ċ
-    { 22, 33, 22, 1, 32, 182, 19212 }, // Č
-    { 16, 24, 17, 1, 23, 96, 19394 }, // č
-    { 22, 31, 24, 1, 31, 171, 19490 }, // Ď
-    { 24, 22, 19, 1, 21, 132, 19661 }, // ď
-    { 23, 22, 24, 0, 22, 127, 19793 }, // Đ
-    { 23, 22, 19, 1, 21, 127, 19920 }, // đ
-    { 20, 28, 20, 1, 28, 140, 20047 }, // Ē
-    { 18, 23, 19, 1, 23, 104, 20187 }, // ē
-    { 20, 30, 20, 1, 30, 150, 20291 }, // Ĕ
-    { 18, 26, 19, 1, 26, 117, 20441 }, // ĕ
-    { 19, 30, 20, 1, 30, 143, 20558 }, // Ė
-    { 16, 25, 19, 1, 25, 100, 20701 }, // ė
-    { 19, 27, 20, 1, 22, 129, 20801 }, // Ę
-    { 16, 21, 19, 1, 15, 84, 20930 }, // ę
-    { 19, 31, 20, 1, 31, 148, 21014 }, // Ě
-    { 17, 26, 19, 1, 26, 111, 21162 }, // ě
-    { 22, 29, 25, 2, 29, 160, 21273 }, // Ĝ
-    { 19, 28, 18, 0, 21, 133, 21433 }, // ĝ
-    { 22, 31, 25, 2, 31, 171, 21566 }, // Ğ
-    { 18, 30, 18, 0, 23, 135, 21737 }, // ğ
-    { 21, 30, 25, 2, 30, 158, 21872 }, // Ġ
-    { 18, 29, 18, 0, 22, 131, 22030 }, // ġ
-    { 21, 34, 25, 2, 22, 179, 22161 }, // Ģ
-    { 18, 30, 18, 0, 23, 135, 22340 }, // ģ
-    { 23, 28, 23, 1, 28, 161, 22475 }, // Ĥ
-    { 16, 27, 19, 1, 27, 108, 22636 }, // ĥ
-    { 23, 21, 23, 1, 21, 121, 22744 }, // Ħ
-    { 16, 21, 19, 1, 21, 84, 22865 }, // ħ
-    { 14, 31, 10, 1, 31, 109, 22949 }, // Ĩ
-    { 12, 22, 9, 1, 22, 66, 23058 }, // ĩ
-    { 15, 29, 10, 1, 29, 109, 23124 }, // Ī
-    { 13, 20, 9, 1, 20, 65, 23233 }, // ī
-    { 12, 27, 15, 3, 21, 81, 23298 }, // Į
-    { 12, 27, 9, -1, 22, 81, 23379 }, // į
-    { 12, 31, 10, 1, 31, 93, 23460 }, // İ
-    { 7, 15, 9, 1, 15, 27, 23553 }, // ı
-    { 20, 27, 23, 1, 21, 135, 23580 }, // Ĳ
-    { 23, 29, 9, 1, 22, 167, 23715 }, // ĳ
-    { 21, 34, 15, -1, 28, 179, 23882 }, // Ĵ
-    { 20, 28, 16, 2, 21, 140, 24061 }, // ĵ
-    { 20, 30, 22, 1, 21, 150, 24201 }, // Ķ
-    { 13, 32, 19, 1, 20, 104, 24351 }, // ķ
-    { 12, 14, 14, 0, 14, 42, 24455 }, // ĸ
-    { 15, 30, 19, 1, 30, 113, 24497 }, // Ĺ
-    { 14, 29, 12, 1, 29, 102, 24610 }, // ĺ
-    { 15, 33, 19, 1, 22, 124, 24712 }, // Ļ
-    { 11, 32, 12, 0, 21, 88, 24836 }, // ļ
-    { 16, 22, 19, 1, 22, 88, 24924 }, // Ľ
-    { 15, 22, 12, 1, 22, 83, 25012 }, // ľ
-    { 17, 22, 19, 1, 22, 94, 25095 }, // Ŀ
-    { 14, 21, 12, 1, 21, 74, 25189 }, // ŀ
-    { 34, 32, 19, -12, 26, 272, 25263 }, // Ł
-    { 23, 21, 12, -8, 21, 121, 25535 }, // ł
-    { 24, 30, 23, 1, 30, 180, 25656 }, // Ń
-    { 17, 24, 19, 1, 24, 102, 25836 }, // ń
-    { 24, 31, 23, 1, 22, 186, 25938 }, // Ņ
-    { 16, 23, 19, 1, 14, 92, 26124 }, // ņ
-    { 24, 30, 23, 1, 30, 180, 26216 }, // Ň
-    { 17, 24, 19, 1, 24, 102, 26396 }, // ň
-    { 18, 26, 17, -3, 26, 117, 26498 }, // ŉ
-    { 24, 28, 23, 1, 22, 168, 26615 }, // Ŋ
-    { 16, 19, 19, 1, 14, 76, 26783 }, // ŋ
-    { 24, 28, 25, 2, 27, 168, 26859 }, // Ō
-    { 18, 21, 19, 1, 21, 95, 27027 }, // ō
-    { 24, 31, 25, 2, 30, 186, 27122 }, // Ŏ
-    { 18, 25, 19, 1, 25, 113, 27308 }, // ŏ
-    { 24, 30, 25, 2, 29, 180, 27421 }, // Ő
-    { 21, 24, 19, 1, 24, 126, 27601 }, // ő
-    { 32, 21, 30, 2, 21, 168, 27727 }, // Œ
-    { 27, 15, 27, 1, 15, 102, 27895 }, // œ
-    { 19, 29, 21, 1, 29, 138, 27997 }, // Ŕ
-    { 13, 21, 15, 1, 21, 69, 28135 }, // ŕ
-    { 19, 34, 21, 1, 22, 162, 28204 }, // Ŗ
-    { 15, 27, 15, -1, 14, 102, 28366 }, // ŗ
-    { 19, 30, 21, 1, 30, 143, 28468 }, // Ř
-    { 13, 21, 15, 1, 21, 69, 28611 }, // ř
-    { 22, 33, 25, 1, 32, 182, 28680 }, // Ś
-    { 15, 23, 18, 1, 23, 87, 28862 }, // ś
-    { 22, 30, 25, 1, 29, 165, 28949 }, // Ŝ
-    { 16, 21, 18, 1, 21, 84, 29114 }, // ŝ
-    { 22, 28, 25, 1, 22, 154, 29198 }, // Ş
-    { 15, 21, 18, 1, 14, 79, 29352 }, // ş
-    { 22, 33, 25, 1, 32, 182, 29431 }, // Š
-    { 15, 23, 18, 1, 23, 87, 29613 }, // š
-    { 20, 26, 23, 5, 21, 130, 29700 }, // Ţ
-    { 11, 24, 16, 4, 19, 66, 29830 }, // ţ
-    { 20, 29, 23, 5, 29, 145, 29896 }, // Ť
-    { 14, 21, 16, 4, 21, 74, 30041 }, // ť
-    { 20, 21, 23, 5, 21, 105, 30115 }, // Ŧ
-    { 13, 19, 16, 2, 19, 62, 30220 }, // ŧ
-    { 23, 31, 23, 1, 30, 179, 30282 }, // Ũ
-    { 15, 23, 18, 2, 22, 87, 30461 }, // ũ
-    { 23, 29, 23, 1, 28, 167, 30548 }, // Ū
-    { 16, 21, 18, 2, 20, 84, 30715 }, // ū
-    { 23, 32, 23, 1, 31, 184, 30799 }, // Ŭ
-    { 16, 24, 18, 2, 23, 96, 30983 }, // ŭ
-    { 23, 32, 23, 1, 31, 184, 31079 }, // Ů
-    { 15, 24, 18, 2, 23, 90, 31263 }, // ů
-    { 24, 31, 23, 1, 30, 186, 31353 }, // Ű
-    { 19, 23, 18, 2, 22, 110, 31539 }, // ű
-    { 23, 27, 23, 1, 22, 156, 31649 }, // Ų
-    { 15, 20, 18, 2, 14, 75, 31805 }, // ų
-    { 28, 27, 32, 5, 27, 189, 31880 }, // Ŵ
-    { 20, 21, 24, 4, 21, 105, 32069 }, // ŵ
-    { 18, 28, 23, 6, 28, 126, 32174 }, // Ŷ
-    { 19, 29, 19, 0, 22, 138, 32300 }, // ŷ
-    { 18, 30, 23, 6, 30, 135, 32438 }, // Ÿ
-    { 25, 30, 25, 1, 30, 188, 32573 }, // Ź
-    { 17, 23, 19, 1, 23, 98, 32761 }, // ź
-    { 25, 29, 25, 1, 29, 182, 32859 }, // Ż
-    { 17, 22, 19, 1, 22, 94, 33041 }, // ż
-    { 25, 30, 25, 1, 30, 188, 33135 }, // Ž
-    { 17, 23, 19, 1, 23, 98, 33323 }, // ž
-    { 14, 20, 13, 3, 20, 70, 33421 }, // ſ
-    { 7, 4, 0, 6, 19, 7, 33491 }, // ̀
-    { 6, 5, 0, 5, 19, 8, 33498 }, // ́
-    { 11, 5, 0, -1, 0, 14, 33506 }, // ̂
-    { 10, 5, 0, 5, 19, 13, 33520 }, // ̃
-    { 13, 4, 0, 4, 17, 13, 33533 }, // ̄
-    { 17, 3, 0, 7, 22, 13, 33546 }, // ̅
-    { 11, 5, 0, 5, 18, 14, 33559 }, // ̆
-    { 5, 5, 0, 5, 20, 7, 33573 }, // ̇
-    { 12, 5, 0, 5, 20, 15, 33580 }, // ̈
-    { 6, 5, 0, 4, 16, 8, 33595 }, // ̉
-    { 7, 5, 0, 5, 19, 9, 33603 }, // ̊
-    { 17, 4, 0, 5, 19, 17, 33612 }, // ̋
-    { 11, 5, 0, 5, 19, 14, 33629 }, // ̌
-    { 18, 4, 0, -8, 20, 18, 33643 }, // ̏
-    { 8, 8, 0, 4, 19, 16, 33661 }, // ̒
-    { 8, 7, 0, 4, 18, 14, 33677 }, // ̓
-    { 8, 7, 0, -4, 18, 14, 33691 }, // ̔
-    { 6, 6, 0, 0, -1, 9, 33705 }, // ̘
-    { 5, 6, 0, 2, -1, 8, 33714 }, // ̙
-    { 11, 6, 0, 6, 20, 17, 33722 }, // ̚
-    { 5, 6, 0, 4, 16, 8, 33739 }, // ̛
-    { 4, 5, 0, 0, -2, 5, 33747 }, // ̜
-    { 6, 5, 0, 3, 4, 8, 33752 }, // ̝
-    { 6, 5, 0, 0, -1, 8, 33760 }, // ̞
-    { 6, 5, 0, 0, -2, 8, 33768 }, // ̟
-    { 12, 4, 0, 0, -3, 12, 33776 }, // ̠
-    { 5, 5, 0, 0, 1, 7, 33788 }, // ̣
-    { 13, 5, 0, -1, 0, 17, 33795 }, // ̤
-    { 7, 5, 0, 5, 19, 9, 33812 }, // ̥
-    { 8, 8, 0, 0, 4, 16, 33821 }, // ̦
-    { 7, 7, 0, 0, 1, 13, 33837 }, // ̧
-    { 7, 7, 0, 0, 1, 13, 33850 }, // ̨
-    { 6, 7, 0, -1, -1, 11, 33863 }, // ̩
-    { 9, 4, 0, 0, -1, 9, 33874 }, // ̪
-    { 11, 5, 0, 0, 0, 14, 33883 }, // ̬
-    { 11, 5, 0, -1, -1, 14, 33897 }, // ̭
-    { 10, 5, 0, 5, 19, 13, 33911 }, // ̰
-    { 10, 3, 0, 6, 18, 8, 33924 }, // ̱
-    { 11, 3, 0, 0, -2, 9, 33932 }, // ̲
-    { 10, 5, 0, 5, 19, 13, 33941 }, // ̴
-    { 13, 3, 0, 3, 9, 10, 33954 }, // ̵
-    { 4, 5, 0, 2, -2, 5, 33964 }, // ̹
-    { 10, 4, 0, -2, -1, 10, 33969 }, // ̺
-    { 9, 7, 0, 0, 0, 16, 33979 }, // ̻
-    { 9, 5, 0, 0, 0, 12, 33995 }, // ̼
-    { 7, 5, 0, 5, 19, 9, 34007 }, // ̽
-    { 10, 5, 0, 5, 19, 13, 34016 }, // ͂
-    { 5, 5, 0, 5, 21, 7, 34029 }, // ̓
-    { 12, 11, 0, 5, 26, 33, 34036 }, // ̈́
-    { 9, 5, 0, 6, 20, 12, 34069 }, // ͆
-    { 14, 9, 0, -1, 0, 32, 34081 }, // ͇
-    { 11, 7, 0, 0, 0, 20, 34113 }, // ͈
-    { 8, 7, 0, 0, -1, 14, 34133 }, // ͉
-    { 12, 15, 0, 5, 24, 45, 34147 }, // ͊
-    { 24, 11, 0, 8, 22, 66, 34192 }, // ͋
-    { 18, 12, 0, 5, 13, 54, 34258 }, // ͌
-    { 12, 8, 0, 2, 0, 24, 34312 }, // ͍
-    { 4, 4, 0, 3, 3, 4, 34336 }, // ͎
-    { 21, 5, 0, 1, 0, 27, 34340 }, // ͜
-    { 21, 5, 0, 5, 19, 27, 34367 }, // ͡
-    { 25, 6, 0, 0, -2, 38, 34394 }, // ͢
-    { 18, 25, 16, 1, 25, 113, 34432 }, // Ѐ
-    { 18, 24, 16, 1, 24, 108, 34545 }, // Ё
-    { 18, 21, 26, 8, 21, 95, 34653 }, // Ђ
-    { 18, 29, 16, 1, 29, 131, 34748 }, // Ѓ
-    { 20, 20, 23, 1, 19, 100, 34879 }, // Є
-    { 22, 23, 25, 1, 22, 127, 34979 }, // Ѕ
-    { 10, 21, 10, 1, 21, 53, 35106 }, // І
-    { 15, 30, 10, 1, 30, 113, 35159 }, // Ї
-    { 18, 28, 15, -1, 22, 126, 35272 }, // Ј
-    { 27, 19, 29, 2, 18, 129, 35398 }, // Љ
-    { 26, 20, 28, 2, 19, 130, 35527 }, // Њ
-    { 20, 22, 23, 5, 22, 110, 35657 }, // Ћ
-    { 22, 29, 22, 1, 29, 160, 35767 }, // Ќ
-    { 22, 27, 23, 2, 27, 149, 35927 }, // Ѝ
-    { 19, 30, 17, -1, 28, 143, 36076 }, // Ў
-    { 20, 23, 18, 1, 18, 115, 36219 }, // Џ
-    { 20, 21, 25, 1, 21, 105, 36334 }, // А
-    { 18, 19, 16, 2, 18, 86, 36439 }, // Б
-    { 17, 19, 17, 1, 18, 81, 36525 }, // В
-    { 18, 19, 16, 1, 19, 86, 36606 }, // Г
-    { 20, 22, 21, 2, 19, 110, 36692 }, // Д
-    { 18, 19, 16, 1, 19, 86, 36802 }, // Е
-    { 30, 21, 32, 1, 21, 158, 36888 }, // Ж
-    { 16, 21, 18, 1, 20, 84, 37046 }, // З
-    { 22, 22, 23, 2, 22, 121, 37130 }, // И
-    { 22, 29, 23, 2, 29, 160, 37251 }, // Й
-    { 20, 21, 22, 1, 21, 105, 37411 }, // К
-    { 19, 20, 19, 2, 19, 95, 37516 }, // Л
-    { 23, 19, 21, 1, 19, 110, 37611 }, // М
-    { 23, 22, 23, 1, 22, 127, 37721 }, // Н
-    { 24, 22, 25, 2, 21, 132, 37848 }, // О
-    { 19, 19, 17, 1, 19, 91, 37980 }, // П
-    { 20, 21, 20, 1, 21, 105, 38071 }, // Р
-    { 22, 23, 22, 1, 22, 127, 38176 }, // С
-    { 20, 21, 23, 5, 21, 105, 38303 }, // Т
-    { 19, 22, 17, -1, 20, 105, 38408 }, // У
-    { 20, 19, 22, 5, 19, 95, 38513 }, // Ф
-    { 24, 22, 25, 1, 22, 132, 38608 }, // Х
-    { 18, 23, 18, 1, 19, 104, 38740 }, // Ц
-    { 15, 19, 17, 4, 19, 72, 38844 }, // Ч
-    { 21, 19, 20, 2, 19, 100, 38916 }, // Ш
-    { 21, 23, 23, 2, 19, 121, 39016 }, // Щ
-    { 14, 20, 17, 2, 19, 70, 39137 }, // Ъ
-    { 26, 20, 27, 2, 19, 130, 39207 }, // Ы
-    { 14, 20, 17, 2, 19, 70, 39337 }, // Ь
-    { 21, 20, 23, 1, 19, 105, 39407 }, // Э
-    { 23, 20, 25, 3, 19, 115, 39512 }, // Ю
-    { 20, 22, 21, 1, 22, 110, 39627 }, // Я
-    { 16, 15, 19, 1, 15, 60, 39737 }, // а
-    { 17, 20, 18, 3, 20, 85, 39797 }, // б
-    { 14, 15, 16, 0, 15, 53, 39882 }, // в
-    { 16, 14, 15, 1, 14, 56, 39935 }, // г
-    { 17, 17, 19, 2, 14, 73, 39991 }, // д
-    { 16, 15, 19, 1, 15, 60, 40064 }, // е
-    { 27, 18, 27, 0, 18, 122, 40124 }, // ж
-    { 12, 14, 11, 0, 14, 42, 40246 }, // з
-    { 17, 15, 17, 1, 15, 64, 40288 }, // и
-    { 17, 19, 17, 1, 19, 81, 40352 }, // й
-    { 16, 15, 17, 0, 15, 60, 40433 }, // к
-    { 13, 14, 13, 1, 13, 46, 40493 }, // л
-    { 20, 16, 21, 0, 16, 80, 40539 }, // м
-    { 20, 16, 20, 0, 16, 80, 40619 }, // н
-    { 14, 16, 20, 3, 15, 56, 40699 }, // о
-    { 16, 14, 17, 2, 14, 56, 40755 }, // п
-    { 20, 21, 20, -1, 14, 105, 40811 }, // р
-    { 13, 16, 17, 1, 15, 52, 40916 }, // с
-    { 14, 14, 17, 5, 14, 49, 40968 }, // т
-    { 19, 21, 19, 0, 14, 100, 41017 }, // у
-    { 20, 20, 22, 3, 14, 100, 41117 }, // ф
-    { 18, 14, 18, 1, 14, 63, 41217 }, // х
-    { 16, 18, 18, 2, 14, 72, 41280 }, // ц
-    { 11, 13, 11, 2, 13, 36, 41352 }, // ч
-    { 20, 14, 20, 2, 14, 70, 41388 }, // ш
-    { 20, 19, 22, 2, 14, 95, 41458 }, // щ
-    { 14, 15, 19, 5, 14, 53, 41553 }, // ъ
-    { 20, 15, 20, 2, 14, 75, 41606 }, // ы
-    { 14, 15, 15, 1, 14, 53, 41681 }, // ь
-    { 15, 15, 16, 2, 14, 57, 41734 }, // э
-    { 19, 16, 20, 2, 15, 76, 41791 }, // ю
-    { 17, 15, 16, 1, 15, 64, 41867 }, // я
-    { 16, 24, 19, 1, 24, 96, 41931 }, // ѐ
-    { 16, 20, 17, 3, 19, 80, 42027 }, // ё
-    { 16, 25, 19, 1, 21, 100, 42107 }, // ђ
-    { 16, 21, 15, 1, 21, 84, 42207 }, // ѓ
-    { 14, 14, 16, 0, 13, 49, 42291 }, // є
-    { 15, 14, 18, 1, 14, 53, 42340 }, // ѕ
-    { 10, 22, 9, 1, 22, 55, 42393 }, // і
-    { 13, 22, 9, 1, 22, 72, 42448 }, // ї
-    { 16, 28, 16, 2, 21, 112, 42520 }, // ј
-    { 18, 14, 20, 1, 13, 63, 42632 }, // љ
-    { 18, 15, 19, 1, 14, 68, 42695 }, // њ
-    { 16, 21, 19, 1, 21, 84, 42763 }, // ћ
-    { 16, 22, 17, 0, 22, 88, 42847 }, // ќ
-    { 17, 21, 17, 1, 21, 90, 42935 }, // ѝ
-    { 19, 32, 19, 0, 25, 152, 43025 }, // ў
-    { 15, 17, 13, 0, 13, 64, 43177 }, // џ
-    { 13, 19, 21, 7, 18, 62, 43241 }, // Ѣ
-    { 13, 19, 18, 5, 18, 62, 43303 }, // ѣ
-    { 25, 18, 25, 2, 18, 113, 43365 }, // Ѫ
-    { 17, 14, 18, 1, 13, 60, 43478 }, // ѫ
-    { 22, 23, 24, 2, 22, 127, 43538 }, // Ѳ
-    { 18, 17, 19, 1, 17, 77, 43665 }, // ѳ
-    { 29, 27, 25, 6, 27, 196, 43742 }, // Ѵ
-    { 17, 17, 20, 4, 17, 73, 43938 }, // ѵ
-    { 11, 8, 0, 6, 23, 22, 44011 }, // ҆
-    { 19, 21, 16, 1, 21, 100, 44033 }, // Ґ
-    { 17, 17, 15, 1, 17, 73, 44133 }, // ґ
-    { 18, 19, 16, 1, 19, 86, 44206 }, // Ғ
-    { 13, 13, 11, 0, 13, 43, 44292 }, // ғ
-    { 21, 20, 17, 1, 20, 105, 44335 }, // Ҕ
-    { 11, 13, 11, 0, 13, 36, 44440 }, // ҕ
-    { 30, 25, 32, -1, 21, 188, 44476 }, // Җ
-    { 21, 18, 22, -2, 15, 95, 44664 }, // җ
-    { 16, 23, 18, 2, 20, 92, 44759 }, // Ҙ
-    { 12, 20, 11, 0, 14, 60, 44851 }, // ҙ
-    { 21, 24, 22, -1, 21, 126, 44911 }, // Қ
-    { 14, 17, 15, -1, 15, 60, 45037 }, // қ
-    { 22, 19, 24, 2, 19, 105, 45097 }, // Ҝ
-    { 17, 13, 18, 1, 13, 56, 45202 }, // ҝ
-    { 20, 21, 22, 1, 21, 105, 45258 }, // Ҟ
-    { 13, 21, 19, 1, 21, 69, 45363 }, // ҟ
-    { 22, 21, 22, -1, 21, 116, 45432 }, // Ҡ
-    { 15, 15, 15, -1, 15, 57, 45548 }, // ҡ
-    { 23, 25, 23, -1, 22, 144, 45605 }, // Ң
-    { 16, 17, 16, -1, 15, 68, 45749 }, // ң
-    { 31, 22, 23, 1, 22, 171, 45817 }, // Ҥ
-    { 22, 15, 16, 0, 15, 83, 45988 }, // ҥ
-    { 27, 21, 29, 2, 21, 142, 46071 }, // Ҧ
-    { 24, 23, 27, 2, 16, 138, 46213 }, // ҧ
-    { 24, 22, 30, 4, 21, 132, 46351 }, // Ҩ
-    { 20, 17, 23, 2, 16, 85, 46483 }, // ҩ
-    { 22, 26, 22, 1, 22, 143, 46568 }, // Ҫ
-    { 13, 19, 17, 1, 15, 62, 46711 }, // ҫ
-    { 19, 24, 23, 4, 21, 114, 46773 }, // Ҭ
-    { 13, 17, 16, 2, 15, 56, 46887 }, // ҭ
-    { 18, 21, 23, 6, 21, 95, 46943 }, // Ү
-    { 14, 18, 17, 5, 13, 63, 47038 }, // ү
-    { 19, 21, 23, 5, 21, 100, 47101 }, // Ұ
-    { 19, 19, 17, 0, 13, 91, 47201 }, // ұ
-    { 25, 25, 25, -1, 22, 157, 47292 }, // Ҳ
-    { 18, 17, 17, -2, 15, 77, 47449 }, // ҳ
-    { 19, 23, 27, 7, 18, 110, 47526 }, // Ҵ
-    { 14, 17, 19, 4, 13, 60, 47636 }, // ҵ
-    { 16, 24, 21, 4, 18, 96, 47696 }, // Ҷ
-    { 12, 17, 15, 2, 13, 51, 47792 }, // ҷ
-    { 16, 19, 18, 5, 19, 76, 47843 }, // Ҹ
-    { 12, 13, 12, 2, 13, 39, 47919 }, // ҹ
-    { 16, 21, 19, 2, 21, 84, 47958 }, // Һ
-    { 16, 21, 19, 1, 21, 84, 48042 }, // һ
-    { 20, 19, 24, 2, 18, 95, 48126 }, // Ҽ
-    { 14, 14, 17, 1, 14, 49, 48221 }, // ҽ
-    { 20, 22, 27, 5, 18, 110, 48270 }, // Ҿ
-    { 15, 17, 20, 3, 14, 64, 48380 }, // ҿ
-    { 10, 21, 10, 1, 21, 53, 48444 }, // Ӏ
-    { 30, 30, 32, 1, 30, 225, 48497 }, // Ӂ
-    { 27, 27, 27, 0, 27, 183, 48722 }, // ӂ
-    { 18, 25, 20, 2, 19, 113, 48905 }, // Ӄ
-    { 12, 17, 13, 1, 13, 51, 49018 }, // ӄ
-    { 19, 24, 19, 2, 19, 114, 49069 }, // Ӆ
-    { 13, 16, 13, 1, 13, 52, 49183 }, // ӆ
-    { 23, 28, 23, 1, 22, 161, 49235 }, // Ӈ
-    { 16, 20, 16, 0, 15, 80, 49396 }, // ӈ
-    { 23, 29, 23, 1, 22, 167, 49476 }, // Ӊ
-    { 16, 20, 16, 0, 15, 80, 49643 }, // ӊ
-    { 16, 23, 17, 3, 18, 92, 49723 }, // Ӌ
-    { 10, 16, 13, 3, 13, 40, 49815 }, // ӌ
-    { 26, 29, 31, 1, 22, 189, 49855 }, // Ӎ
-    { 18, 20, 21, 0, 15, 90, 50044 }, // ӎ
-    { 8, 18, 7, 2, 18, 36, 50134 }, // ӏ
-    { 22, 30, 25, 1, 30, 165, 50170 }, // Ӑ
-    { 20, 23, 19, 1, 23, 115, 50335 }, // ӑ
-    { 22, 29, 25, 1, 29, 160, 50450 }, // Ӓ
-    { 21, 21, 19, 1, 21, 111, 50610 }, // ӓ
-    { 33, 23, 36, 1, 22, 190, 50721 }, // Ӕ
-    { 26, 15, 31, 1, 15, 98, 50911 }, // ӕ
-    { 19, 26, 16, 1, 26, 124, 51009 }, // Ӗ
-    { 18, 25, 19, 1, 25, 113, 51133 }, // ӗ
-    { 16, 15, 19, 2, 14, 60, 51246 }, // Ә
-    { 16, 17, 21, 8, 16, 68, 51306 }, // ә
-    { 19, 26, 19, 2, 25, 124, 51374 }, // Ӛ
-    { 17, 18, 21, 7, 16, 77, 51498 }, // ӛ
-    { 30, 29, 33, 1, 29, 218, 51575 }, // Ӝ
-    { 27, 26, 27, 0, 26, 176, 51793 }, // ӝ
-    { 18, 27, 18, 1, 26, 122, 51969 }, // Ӟ
-    { 18, 21, 11, 0, 21, 95, 52091 }, // ӟ
-    { 14, 18, 15, 3, 18, 63, 52186 }, // Ӡ
-    { 15, 18, 15, 1, 13, 68, 52249 }, // ӡ
-    { 22, 26, 23, 2, 26, 143, 52317 }, // Ӣ
-    { 18, 20, 17, 1, 20, 90, 52460 }, // ӣ
-    { 22, 27, 23, 2, 27, 149, 52550 }, // Ӥ
-    { 18, 21, 17, 1, 21, 95, 52699 }, // ӥ
-    { 24, 30, 25, 2, 29, 180, 52794 }, // Ӧ
-    { 16, 23, 20, 3, 22, 92, 52974 }, // ӧ
-    { 21, 19, 25, 2, 18, 100, 53066 }, // Ө
-    { 17, 14, 19, 1, 14, 60, 53166 }, // ө
-    { 21, 30, 25, 2, 29, 158, 53226 }, // Ӫ
-    { 18, 23, 19, 1, 23, 104, 53384 }, // ӫ
-    { 21, 28, 23, 1, 27, 147, 53488 }, // Ӭ
-    { 15, 22, 16, 2, 21, 83, 53635 }, // ӭ
-    { 19, 28, 17, -1, 26, 133, 53718 }, // Ӯ
-    { 19, 29, 19, 0, 22, 138, 53851 }, // ӯ
-    { 19, 29, 17, -1, 27, 138, 53989 }, // Ӱ
-    { 19, 31, 19, 0, 24, 148, 54127 }, // ӱ
-    { 21, 29, 17, -1, 27, 153, 54275 }, // Ӳ
-    { 22, 31, 19, 0, 24, 171, 54428 }, // ӳ
-    { 16, 26, 17, 4, 26, 104, 54599 }, // Ӵ
-    { 14, 21, 11, 2, 21, 74, 54703 }, // ӵ
-    { 18, 23, 16, 1, 19, 104, 54777 }, // Ӷ
-    { 13, 16, 11, 0, 13, 52, 54881 }, // ӷ
-    { 26, 29, 27, 2, 28, 189, 54933 }, // Ӹ
-    { 20, 24, 20, 2, 23, 120, 55122 }, // ӹ
-    { 24, 26, 25, 1, 22, 156, 55242 }, // Ӽ
-    { 17, 18, 17, 0, 15, 77, 55398 }, // ӽ
-    { 0, 0, 21, 0, 0, 0, 55475 }, //  
-    { 0, 0, 33, 0, 0, 0, 55475 }, //  
-    { 0, 0, 21, 0, 0, 0, 55475 }, //  
-    { 0, 0, 33, 0, 0, 0, 55475 }, //  
-    { 0, 0, 16, 0, 0, 0, 55475 }, //  
-    { 0, 0, 14, 0, 0, 0, 55475 }, //  
-    { 0, 0, 12, 0, 0, 0, 55475 }, //  
-    { 0, 0, 17, 0, 0, 0, 55475 }, //  
-    { 0, 0, 7, 0, 0, 0, 55475 }, //  
-    { 0, 0, 13, 0, 0, 0, 55475 }, //  
-    { 0, 0, 12, 0, 0, 0, 55475 }, //  
-    { 0, 0, 8, 0, 0, 0, 55475 }, // ​
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 55475 }, // ‏
-    { 13, 3, 14, 3, 9, 10, 55475 }, // ‐
-    { 13, 3, 14, 3, 9, 10, 55485 }, // ‑
-    { 19, 3, 19, 4, 9, 15, 55495 }, // ‒
-    { 18, 4, 20, 3, 9, 18, 55510 }, // –
-    { 26, 4, 28, 3, 9, 26, 55528 }, // —
-    { 26, 4, 28, 3, 9, 26, 55554 }, // ―
-    { 17, 22, 14, 0, 18, 94, 55580 }, // ‖
-    { 21, 8, 20, 0, -2, 42, 55674 }, // ‗
-    { 8, 7, 8, 5, 21, 14, 55716 }, // ‘
-    { 8, 8, 8, 5, 22, 16, 55730 }, // ’
-    { 8, 8, 8, 0, 4, 16, 55746 }, // ‚
-    { 8, 7, 8, 5, 21, 14, 55762 }, // ‛
-    { 14, 7, 14, 5, 21, 25, 55776 }, // “
-    { 14, 7, 14, 5, 21, 25, 55801 }, // ”
-    { 8, 8, 8, 0, 4, 16, 55826 }, // „
-    { 14, 8, 14, 5, 21, 28, 55842 }, // ‟
-    { 14, 32, 15, 4, 25, 112, 55870 }, // †
-    { 16, 32, 15, 2, 25, 128, 55982 }, // ‡
-    { 17, 15, 13, 0, 18, 64, 56110 }, // •
-    { 7, 8, 10, 3, 11, 14, 56174 }, // ‣
-    { 5, 5, 7, 1, 5, 7, 56188 }, // ․
-    { 5, 5, 7, 1, 5, 7, 56195 }, // ‥
-    { 22, 5, 24, 1, 5, 28, 56202 }, // …
-    { 4, 3, 6, 2, 9, 3, 56230 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 56233 }, //  
-    { 20, 22, 28, 6, 20, 110, 56233 }, // ‰
-    { 8, 8, 8, 5, 22, 16, 56343 }, // ′
-    { 14, 7, 14, 5, 21, 25, 56359 }, // ″
-    { 18, 8, 21, -3, 21, 36, 56384 }, // ‴
-    { 5, 7, 8, 6, 21, 9, 56420 }, // ‵
-    { 11, 7, 13, 5, 21, 20, 56429 }, // ‶
-    { 18, 8, 21, 6, 21, 36, 56449 }, // ‷
-    { 11, 5, 14, 6, 20, 14, 56485 }, // ‸
-    { 9, 12, 10, 3, 13, 27, 56499 }, // ‹
-    { 9, 12, 10, -2, 13, 27, 56526 }, // ›
-    { 32, 26, 33, 1, 23, 208, 56553 }, // ※
-    { 12, 25, 8, 1, 25, 75, 56761 }, // ‼
-    { 17, 31, 19, 5, 30, 132, 56836 }, // ‽
-    { 13, 3, 14, 6, 21, 10, 56968 }, // ‾
-    { 11, 5, 16, 5, 17, 14, 56978 }, // ‿
-    { 18, 16, 20, 4, 22, 72, 56992 }, // ⁂
-    { 20, 20, 28, 6, 19, 100, 57064 }, // ⁄
-    { 30, 28, 32, 6, 28, 210, 57164 }, // ⁇
-    { 21, 28, 25, 6, 28, 147, 57374 }, // ⁈
-    { 26, 30, 20, 0, 28, 195, 57521 }, // ⁉
-    { 25, 39, 19, -1, 27, 244, 57716 }, // ⁒
-    { 0, 0, 121, 0, 0, 0, 57960 }, //  
-    { 8, 10, 8, 3, 21, 20, 57960 }, // ⁰
-    { 8, 10, 8, 3, 21, 20, 57980 }, // ⁴
-    { 8, 10, 8, 3, 21, 20, 58000 }, // ⁵
-    { 9, 9, 8, 3, 20, 21, 58020 }, // ⁶
-    { 7, 10, 8, 5, 21, 18, 58041 }, // ⁷
-    { 9, 10, 8, 3, 21, 23, 58059 }, // ⁸
-    { 9, 9, 8, 3, 20, 21, 58082 }, // ⁹
-    { 16, 14, 19, 1, 14, 56, 58103 }, // ⁿ
-    { 12, 13, 11, 1, 13, 39, 58159 }, // ₀
-    { 6, 10, 8, -1, 6, 15, 58198 }, // ₁
-    { 9, 10, 8, -1, 6, 23, 58213 }, // ₂
-    { 9, 9, 8, -1, 5, 21, 58236 }, // ₃
-    { 8, 10, 8, -1, 6, 20, 58257 }, // ₄
-    { 8, 10, 8, -1, 6, 20, 58277 }, // ₅
-    { 9, 9, 8, -1, 5, 21, 58297 }, // ₆
-    { 7, 11, 8, 1, 6, 20, 58318 }, // ₇
-    { 9, 10, 8, -1, 6, 23, 58338 }, // ₈
-    { 9, 9, 8, -1, 5, 21, 58361 }, // ₉
-    { 14, 34, 11, 3, 25, 119, 58382 }, // ₍
-    { 14, 34, 11, -6, 25, 119, 58501 }, // ₎
-    { 24, 31, 22, 0, 26, 186, 58620 }, // ₡
-    { 22, 23, 22, 1, 22, 127, 58806 }, // ₢
-    { 19, 24, 17, 1, 24, 114, 58933 }, // ₤
-    { 25, 22, 23, 0, 22, 138, 59047 }, // ₦
-    { 21, 21, 20, 1, 21, 111, 59185 }, // ₧
-    { 28, 21, 28, 0, 21, 147, 59296 }, // ₨
-    { 21, 21, 19, -1, 21, 111, 59443 }, // ₩
-    { 24, 19, 27, 4, 19, 114, 59554 }, // ₪
-    { 18, 20, 17, 2, 20, 90, 59668 }, // ₫
-    { 19, 23, 21, 2, 20, 110, 59758 }, // €
-    { 20, 21, 23, 5, 21, 105, 59868 }, // ₮
-    { 24, 21, 16, 1, 21, 126, 59973 }, // ₱
-    { 21, 30, 25, 2, 26, 158, 60099 }, // ₲
-    { 28, 23, 23, 2, 22, 161, 60257 }, // ₴
-    { 13, 20, 17, 1, 18, 65, 60418 }, // ₵
-    { 23, 22, 23, 5, 22, 127, 60483 }, // ₸
-    { 15, 20, 15, 3, 19, 75, 60610 }, // ₹
-    { 15, 17, 17, 2, 16, 64, 60685 }, // ₺
-    { 18, 20, 16, 2, 20, 90, 60749 }, // ₼
-    { 24, 21, 20, -3, 21, 126, 60839 }, // ₽
-    { 16, 16, 19, -3, 12, 64, 60965 }, // ←
-    { 16, 15, 19, 4, 15, 60, 61029 }, // ↑
-    { 16, 16, 19, 6, 12, 64, 61089 }, // →
-    { 16, 15, 19, 8, 15, 60, 61153 }, // ↓
-    { 27, 13, 22, -2, 11, 88, 61213 }, // ↔
-    { 14, 26, 16, 3, 24, 91, 61301 }, // ↕
-    { 15, 11, 16, -3, 11, 42, 61392 }, // ↖
-    { 15, 11, 16, 4, 11, 42, 61434 }, // ↗
-    { 12, 16, 16, 6, 14, 48, 61476 }, // ↘
-    { 12, 16, 16, -2, 14, 48, 61524 }, // ↙
-    { 19, 16, 21, 0, 15, 76, 61572 }, // ⇐
-    { 20, 18, 23, 4, 18, 90, 61648 }, // ⇑
-    { 19, 16, 21, 3, 15, 76, 61738 }, // ⇒
-    { 20, 19, 23, 9, 18, 95, 61814 }, // ⇓
-    { 25, 16, 24, 0, 15, 100, 61909 }, // ⇔
-    { 16, 24, 19, 6, 15, 96, 62009 }, // ⇕
-    { 19, 20, 17, 2, 20, 95, 62105 }, // ∂
-    { 26, 23, 25, 0, 22, 150, 62200 }, // ∅
-    { 20, 19, 22, 1, 19, 95, 62350 }, // ∆
-    { 18, 18, 18, 4, 18, 81, 62445 }, // ∏
-    { 18, 18, 18, 8, 18, 81, 62526 }, // ∐
-    { 17, 19, 15, 1, 18, 81, 62607 }, // ∑
-    { 12, 4, 15, 3, 9, 12, 62688 }, // −
-    { 24, 21, 23, 3, 20, 126, 62700 }, // √
-    { 22, 12, 23, 3, 15, 66, 62826 }, // ∞
-    { 27, 28, 21, 0, 22, 189, 62892 }, // ∫
-    { 9, 15, 7, 1, 15, 34, 63081 }, // ∶
-    { 18, 12, 19, 5, 13, 54, 63115 }, // ≈
-    { 20, 22, 28, 6, 20, 110, 63169 }, // ≠
-    { 21, 19, 22, -1, 18, 100, 63279 }, // ≤
-    { 22, 19, 22, 1, 18, 105, 63379 }, // ≥
+    { 10, 18, 8, 0, 14, 45, 2048 }, // ;
+    { 19, 15, 20, -1, 16, 72, 2093 }, // <
+    { 14, 9, 15, 2, 11, 32, 2165 }, // =
+    { 19, 15, 20, 2, 16, 72, 2197 }, // >
+    { 16, 28, 14, 4, 28, 112, 2269 }, // ?
+    { 25, 21, 30, 3, 20, 132, 2381 }, // @
+    { 20, 21, 25, 1, 21, 105, 2513 }, // A
+    { 19, 22, 21, 1, 22, 105, 2618 }, // B
+    { 22, 23, 22, 1, 22, 127, 2723 }, // C
+    { 22, 22, 24, 1, 22, 121, 2850 }, // D
+    { 19, 22, 20, 1, 22, 105, 2971 }, // E
+    { 18, 22, 18, 1, 22, 99, 3076 }, // F
+    { 21, 22, 25, 2, 22, 116, 3175 }, // G
+    { 23, 22, 23, 1, 22, 127, 3291 }, // H
+    { 10, 21, 10, 1, 21, 53, 3418 }, // I
+    { 18, 28, 15, -1, 22, 126, 3471 }, // J
+    { 20, 21, 22, 1, 21, 105, 3597 }, // K
+    { 15, 22, 19, 1, 22, 83, 3702 }, // L
+    { 26, 22, 27, 1, 22, 143, 3785 }, // M
+    { 24, 22, 23, 1, 22, 132, 3928 }, // N
+    { 24, 22, 25, 2, 21, 132, 4096 }, // O
+    { 20, 21, 20, 1, 21, 105, 4228 }, // P
+    { 24, 26, 26, 1, 22, 156, 4333 }, // Q
+    { 19, 22, 21, 1, 22, 105, 4489 }, // R
+    { 22, 23, 25, 1, 22, 127, 4594 }, // S
+    { 20, 21, 23, 5, 21, 105, 4721 }, // T
+    { 23, 23, 23, 1, 22, 133, 4826 }, // U
+    { 21, 22, 25, 6, 22, 116, 4959 }, // V
+    { 28, 21, 32, 5, 21, 147, 5075 }, // W
+    { 24, 22, 25, 1, 22, 132, 5222 }, // X
+    { 18, 21, 23, 6, 21, 95, 5354 }, // Y
+    { 25, 21, 25, 1, 21, 132, 5449 }, // Z
+    { 18, 35, 12, -1, 27, 158, 5581 }, // [
+    { 4, 24, 12, 6, 19, 24, 5739 }, // <backslash>
+    { 18, 35, 12, -6, 27, 158, 5763 }, // ]
+    { 10, 5, 14, 5, 23, 13, 5921 }, // ^
+    { 18, 4, 20, 0, -2, 18, 5934 }, // _
+    { 7, 4, 10, 6, 19, 7, 5952 }, // `
+    { 16, 15, 19, 1, 15, 60, 5959 }, // a
+    { 15, 23, 20, 3, 22, 87, 6019 }, // b
+    { 13, 16, 17, 1, 15, 52, 6144 }, // c
+    { 20, 22, 19, 1, 21, 110, 6196 }, // d
+    { 16, 15, 19, 1, 15, 60, 6306 }, // e
+    { 13, 20, 14, 2, 20, 65, 6366 }, // f
+    { 18, 21, 18, 0, 14, 95, 6431 }, // g
+    { 16, 21, 19, 1, 21, 84, 6526 }, // h
+    { 10, 22, 9, 1, 22, 55, 6610 }, // i
+    { 16, 28, 16, 2, 21, 112, 6665 }, // j
+    { 13, 20, 19, 1, 20, 65, 6777 }, // k
+    { 10, 21, 12, 1, 21, 53, 6842 }, // l
+    { 25, 14, 28, 1, 14, 88, 6895 }, // m
+    { 16, 14, 19, 1, 14, 56, 6983 }, // n
+    { 17, 14, 19, 1, 14, 60, 7039 }, // o
+    { 20, 21, 20, -1, 14, 105, 7099 }, // p
+    { 18, 21, 22, 1, 15, 95, 7204 }, // q
+    { 13, 14, 15, 1, 14, 46, 7299 }, // r
+    { 15, 14, 18, 1, 14, 53, 7345 }, // s
+    { 11, 19, 16, 4, 19, 53, 7398 }, // t
+    { 15, 15, 18, 2, 14, 57, 7451 }, // u
+    { 16, 14, 21, 4, 14, 56, 7508 }, // v
+    { 20, 14, 24, 4, 14, 70, 7564 }, // w
+    { 18, 14, 21, 1, 14, 63, 7634 }, // x
+    { 19, 21, 19, 0, 14, 100, 7697 }, // y
+    { 17, 14, 19, 1, 14, 60, 7797 }, // z
+    { 15, 24, 14, 3, 19, 90, 7857 }, // {
+    { 10, 22, 6, 0, 18, 55, 7947 }, // |
+    { 14, 24, 16, 0, 19, 84, 8002 }, // }
+    { 10, 5, 15, 5, 19, 13, 8086 }, // ~
+    { 0, 0, 21, 0, 0, 0, 8099 }, //  
+    { 10, 25, 11, 2, 19, 63, 8099 }, // ¡
+    { 13, 22, 17, 1, 19, 72, 8192 }, // ¢
+    { 19, 24, 17, 1, 24, 114, 8264 }, // £
+    { 15, 14, 17, 3, 16, 53, 8378 }, // ¤
+    { 19, 21, 19, 3, 18, 100, 8431 }, // ¥
+    { 10, 22, 6, 0, 18, 55, 8531 }, // ¦
+    { 19, 22, 21, 1, 19, 105, 8586 }, // §
+    { 12, 5, 13, 5, 20, 15, 8691 }, // ¨
+    { 11, 10, 13, 6, 23, 28, 8706 }, // ©
+    { 9, 9, 10, 4, 19, 21, 8734 }, // ª
+    { 17, 12, 20, 2, 12, 51, 8755 }, // «
+    { 13, 8, 15, 3, 9, 26, 8806 }, // ¬
+    { 13, 3, 14, 3, 9, 10, 8832 }, // ­
+    { 11, 10, 13, 7, 27, 28, 8842 }, // ®
+    { 10, 3, 13, 6, 18, 8, 8870 }, // ¯
+    { 13, 12, 13, 4, 20, 39, 8878 }, // °
+    { 16, 15, 18, 0, 14, 60, 8917 }, // ±
+    { 9, 9, 7, 2, 20, 21, 8977 }, // ²
+    { 8, 10, 8, 3, 20, 20, 8998 }, // ³
+    { 6, 5, 7, 5, 19, 8, 9018 }, // ´
+    { 18, 17, 18, -1, 14, 77, 9026 }, // µ
+    { 17, 21, 15, 1, 18, 90, 9103 }, // ¶
+    { 6, 5, 7, 2, 11, 8, 9193 }, // ·
+    { 7, 7, 8, 0, 1, 13, 9201 }, // ¸
+    { 6, 10, 7, 3, 21, 15, 9214 }, // ¹
+    { 9, 8, 11, 4, 18, 18, 9229 }, // º
+    { 17, 12, 16, -3, 12, 51, 9247 }, // »
+    { 20, 24, 28, 6, 22, 120, 9298 }, // ¼
+    { 22, 23, 28, 6, 21, 127, 9418 }, // ½
+    { 21, 24, 28, 5, 22, 126, 9545 }, // ¾
+    { 16, 28, 14, -2, 15, 112, 9671 }, // ¿
+    { 20, 28, 25, 1, 28, 140, 9783 }, // À
+    { 21, 33, 25, 1, 33, 174, 9923 }, // Á
+    { 21, 27, 25, 1, 27, 142, 10097 }, // Â
+    { 22, 29, 25, 1, 29, 160, 10240 }, // Ã
+    { 23, 29, 25, 1, 29, 167, 10400 }, // Ä
+    { 20, 30, 25, 1, 30, 150, 10567 }, // Å
+    { 33, 23, 36, 1, 22, 190, 10717 }, // Æ
+    { 22, 28, 22, 1, 22, 154, 10907 }, // Ç
+    { 19, 28, 20, 1, 28, 133, 11061 }, // È
+    { 19, 32, 20, 1, 32, 152, 11194 }, // É
+    { 19, 27, 20, 1, 27, 129, 11346 }, // Ê
+    { 20, 29, 20, 1, 29, 145, 11475 }, // Ë
+    { 12, 29, 10, 1, 29, 87, 11620 }, // Ì
+    { 14, 34, 10, 1, 34, 119, 11707 }, // Í
+    { 14, 28, 10, 1, 28, 98, 11826 }, // Î
+    { 15, 30, 10, 1, 30, 113, 11924 }, // Ï
+    { 23, 22, 24, 0, 22, 127, 12037 }, // Ð
+    { 24, 27, 23, 1, 27, 162, 12288 }, // Ñ
+    { 24, 29, 25, 2, 28, 174, 12450 }, // Ò
+    { 24, 33, 25, 2, 32, 198, 12624 }, // Ó
+    { 24, 28, 25, 2, 27, 168, 12822 }, // Ô
+    { 24, 29, 25, 2, 28, 174, 12990 }, // Õ
+    { 24, 29, 25, 2, 28, 174, 13164 }, // Ö
+    { 13, 7, 15, 2, 10, 23, 13338 }, // ×
+    { 44, 41, 25, -9, 31, 451, 13361 }, // Ø
+    { 23, 30, 23, 1, 29, 173, 13812 }, // Ù
+    { 23, 34, 23, 1, 33, 196, 13985 }, // Ú
+    { 23, 29, 23, 1, 28, 167, 14336 }, // Û
+    { 23, 30, 23, 1, 29, 173, 14503 }, // Ü
+    { 18, 33, 23, 6, 33, 149, 14676 }, // Ý
+    { 16, 20, 14, 1, 20, 80, 14825 }, // Þ
+    { 18, 20, 17, 1, 20, 90, 14905 }, // ß
+    { 16, 20, 19, 1, 20, 80, 14995 }, // à
+    { 16, 24, 19, 1, 24, 96, 15075 }, // á
+    { 17, 20, 19, 1, 20, 85, 15171 }, // â
+    { 16, 20, 19, 1, 20, 80, 15256 }, // ã
+    { 17, 21, 19, 1, 21, 90, 15336 }, // ä
+    { 16, 22, 19, 1, 22, 88, 15426 }, // å
+    { 26, 15, 31, 1, 15, 98, 15514 }, // æ
+    { 13, 21, 17, 1, 15, 69, 15612 }, // ç
+    { 16, 23, 19, 1, 23, 92, 15681 }, // è
+    { 17, 27, 19, 1, 27, 115, 15773 }, // é
+    { 17, 22, 19, 1, 22, 94, 15888 }, // ê
+    { 18, 24, 19, 1, 24, 108, 15982 }, // ë
+    { 9, 21, 9, 1, 21, 48, 16090 }, // ì
+    { 12, 25, 9, 1, 25, 75, 16138 }, // í
+    { 12, 20, 9, 1, 20, 60, 16213 }, // î
+    { 13, 22, 9, 1, 22, 72, 16273 }, // ï
+    { 22, 20, 21, 2, 20, 110, 16384 }, // ð
+    { 18, 21, 19, 1, 21, 95, 16494 }, // ñ
+    { 17, 23, 19, 1, 23, 98, 16589 }, // ò
+    { 17, 27, 19, 1, 27, 115, 16687 }, // ó
+    { 17, 22, 19, 1, 22, 94, 16802 }, // ô
+    { 17, 23, 19, 1, 23, 98, 16896 }, // õ
+    { 18, 23, 19, 1, 23, 104, 16994 }, // ö
+    { 16, 16, 19, 4, 16, 64, 17098 }, // ÷
+    { 24, 39, 19, -3, 26, 234, 17162 }, // ø
+    { 15, 22, 18, 2, 21, 83, 17396 }, // ù
+    { 15, 26, 18, 2, 25, 98, 17479 }, // ú
+    { 15, 21, 18, 2, 20, 79, 17577 }, // û
+    { 16, 22, 18, 2, 21, 88, 17656 }, // ü
+    { 19, 34, 19, 0, 27, 162, 17744 }, // ý
+    { 15, 26, 14, 1, 21, 98, 17906 }, // þ
+    { 20, 30, 19, 0, 23, 150, 18004 }, // ÿ
+    { 22, 28, 25, 1, 28, 154, 18154 }, // Ā
+    { 17, 20, 19, 1, 20, 85, 18308 }, // ā
+    { 22, 31, 25, 1, 31, 171, 18432 }, // Ă
+    { 17, 22, 19, 1, 22, 94, 18603 }, // ă
+    { 20, 27, 25, 1, 21, 135, 18697 }, // Ą
+    { 16, 20, 19, 1, 15, 80, 18832 }, // ą
+    { 22, 33, 22, 1, 32, 182, 18912 }, // Ć
+    { 15, 24, 17, 1, 23, 90, 19094 }, // ć
+    { 22, 31, 22, 1, 30, 171, 19184 }, // Ĉ
+    { 17, 22, 17, 1, 21, 94, 19355 }, // ĉ
+    { 22, 32, 22, 1, 31, 176, 19449 }, // Ċ
+    { 13, 23, 17, 1, 22, 75, 19625 }, // ċ
+    { 22, 33, 22, 1, 32, 182, 19700 }, // Č
+    { 16, 24, 17, 1, 23, 96, 19882 }, // č
+    { 22, 31, 24, 1, 31, 171, 19978 }, // Ď
+    { 24, 22, 19, 1, 21, 132, 20149 }, // ď
+    { 23, 22, 24, 0, 22, 127, 20281 }, // Đ
+    { 23, 22, 19, 1, 21, 127, 20480 }, // đ
+    { 20, 28, 20, 1, 28, 140, 20607 }, // Ē
+    { 18, 23, 19, 1, 23, 104, 20747 }, // ē
+    { 20, 30, 20, 1, 30, 150, 20851 }, // Ĕ
+    { 18, 26, 19, 1, 26, 117, 21001 }, // ĕ
+    { 19, 30, 20, 1, 30, 143, 21118 }, // Ė
+    { 16, 25, 19, 1, 25, 100, 21261 }, // ė
+    { 19, 27, 20, 1, 22, 129, 21361 }, // Ę
+    { 16, 21, 19, 1, 15, 84, 21490 }, // ę
+    { 19, 31, 20, 1, 31, 148, 21574 }, // Ě
+    { 17, 26, 19, 1, 26, 111, 21722 }, // ě
+    { 22, 29, 25, 2, 29, 160, 21833 }, // Ĝ
+    { 19, 28, 18, 0, 21, 133, 21993 }, // ĝ
+    { 22, 31, 25, 2, 31, 171, 22126 }, // Ğ
+    { 18, 30, 18, 0, 23, 135, 22297 }, // ğ
+    { 21, 30, 25, 2, 30, 158, 22528 }, // Ġ
+    { 18, 29, 18, 0, 22, 131, 22686 }, // ġ
+    { 21, 34, 25, 2, 22, 179, 22817 }, // Ģ
+    { 18, 30, 18, 0, 23, 135, 22996 }, // ģ
+    { 23, 28, 23, 1, 28, 161, 23131 }, // Ĥ
+    { 16, 27, 19, 1, 27, 108, 23292 }, // ĥ
+    { 23, 21, 23, 1, 21, 121, 23400 }, // Ħ
+    { 16, 21, 19, 1, 21, 84, 23521 }, // ħ
+    { 14, 31, 10, 1, 31, 109, 23605 }, // Ĩ
+    { 12, 22, 9, 1, 22, 66, 23714 }, // ĩ
+    { 15, 29, 10, 1, 29, 109, 23780 }, // Ī
+    { 13, 20, 9, 1, 20, 65, 23889 }, // ī
+    { 12, 27, 15, 3, 21, 81, 23954 }, // Į
+    { 12, 27, 9, -1, 22, 81, 24035 }, // į
+    { 12, 31, 10, 1, 31, 93, 24116 }, // İ
+    { 7, 15, 9, 1, 15, 27, 24209 }, // ı
+    { 20, 27, 23, 1, 21, 135, 24236 }, // Ĳ
+    { 23, 29, 9, 1, 22, 167, 24371 }, // ĳ
+    { 21, 34, 15, -1, 28, 179, 24576 }, // Ĵ
+    { 20, 28, 16, 2, 21, 140, 24755 }, // ĵ
+    { 20, 30, 22, 1, 21, 150, 24895 }, // Ķ
+    { 13, 32, 19, 1, 20, 104, 25045 }, // ķ
+    { 12, 14, 14, 0, 14, 42, 25149 }, // ĸ
+    { 15, 30, 19, 1, 30, 113, 25191 }, // Ĺ
+    { 14, 29, 12, 1, 29, 102, 25304 }, // ĺ
+    { 15, 33, 19, 1, 22, 124, 25406 }, // Ļ
+    { 11, 32, 12, 0, 21, 88, 25530 }, // ļ
+    { 16, 22, 19, 1, 22, 88, 25618 }, // Ľ
+    { 15, 22, 12, 1, 22, 83, 25706 }, // ľ
+    { 17, 22, 19, 1, 22, 94, 25789 }, // Ŀ
+    { 14, 21, 12, 1, 21, 74, 25883 }, // ŀ
+    { 34, 32, 19, -12, 26, 272, 25957 }, // Ł
+    { 23, 21, 12, -8, 21, 121, 26229 }, // ł
+    { 24, 30, 23, 1, 30, 180, 26350 }, // Ń
+    { 17, 24, 19, 1, 24, 102, 26624 }, // ń
+    { 24, 31, 23, 1, 22, 186, 26726 }, // Ņ
+    { 16, 23, 19, 1, 14, 92, 26912 }, // ņ
+    { 24, 30, 23, 1, 30, 180, 27004 }, // Ň
+    { 17, 24, 19, 1, 24, 102, 27184 }, // ň
+    { 18, 26, 17, -3, 26, 117, 27286 }, // ŉ
+    { 24, 28, 23, 1, 22, 168, 27403 }, // Ŋ
+    { 16, 19, 19, 1, 14, 76, 27571 }, // ŋ
+    { 24, 28, 25, 2, 27, 168, 27647 }, // Ō
+    { 18, 21, 19, 1, 21, 95, 27815 }, // ō
+    { 24, 31, 25, 2, 30, 186, 27910 }, // Ŏ
+    { 18, 25, 19, 1, 25, 113, 28096 }, // ŏ
+    { 24, 30, 25, 2, 29, 180, 28209 }, // Ő
+    { 21, 24, 19, 1, 24, 126, 28389 }, // ő
+    { 32, 21, 30, 2, 21, 168, 28672 }, // Œ
+    { 27, 15, 27, 1, 15, 102, 28840 }, // œ
+    { 19, 29, 21, 1, 29, 138, 28942 }, // Ŕ
+    { 13, 21, 15, 1, 21, 69, 29080 }, // ŕ
+    { 19, 34, 21, 1, 22, 162, 29149 }, // Ŗ
+    { 15, 27, 15, -1, 14, 102, 29311 }, // ŗ
+    { 19, 30, 21, 1, 30, 143, 29413 }, // Ř
+    { 13, 21, 15, 1, 21, 69, 29556 }, // ř
+    { 22, 33, 25, 1, 32, 182, 29625 }, // Ś
+    { 15, 23, 18, 1, 23, 87, 29807 }, // ś
+    { 22, 30, 25, 1, 29, 165, 29894 }, // Ŝ
+    { 16, 21, 18, 1, 21, 84, 30059 }, // ŝ
+    { 22, 28, 25, 1, 22, 154, 30143 }, // Ş
+    { 15, 21, 18, 1, 14, 79, 30297 }, // ş
+    { 22, 33, 25, 1, 32, 182, 30376 }, // Š
+    { 15, 23, 18, 1, 23, 87, 30558 }, // š
+    { 20, 26, 23, 5, 21, 130, 30720 }, // Ţ
+    { 11, 24, 16, 4, 19, 66, 30850 }, // ţ
+    { 20, 29, 23, 5, 29, 145, 30916 }, // Ť
+    { 14, 21, 16, 4, 21, 74, 31061 }, // ť
+    { 20, 21, 23, 5, 21, 105, 31135 }, // Ŧ
+    { 13, 19, 16, 2, 19, 62, 31240 }, // ŧ
+    { 23, 31, 23, 1, 30, 179, 31302 }, // Ũ
+    { 15, 23, 18, 2, 22, 87, 31481 }, // ũ
+    { 23, 29, 23, 1, 28, 167, 31568 }, // Ū
+    { 16, 21, 18, 2, 20, 84, 31735 }, // ū
+    { 23, 32, 23, 1, 31, 184, 31819 }, // Ŭ
+    { 16, 24, 18, 2, 23, 96, 32003 }, // ŭ
+    { 23, 32, 23, 1, 31, 184, 32099 }, // Ů
+    { 15, 24, 18, 2, 23, 90, 32283 }, // ů
+    { 24, 31, 23, 1, 30, 186, 32373 }, // Ű
+    { 19, 23, 18, 2, 22, 110, 32559 }, // ű
+    { 23, 27, 23, 1, 22, 156, 32768 }, // Ų
+    { 15, 20, 18, 2, 14, 75, 32924 }, // ų
+    { 28, 27, 32, 5, 27, 189, 32999 }, // Ŵ
+    { 20, 21, 24, 4, 21, 105, 33188 }, // ŵ
+    { 18, 28, 23, 6, 28, 126, 33293 }, // Ŷ
+    { 19, 29, 19, 0, 22, 138, 33419 }, // ŷ
+    { 18, 30, 23, 6, 30, 135, 33557 }, // Ÿ
+    { 25, 30, 25, 1, 30, 188, 33692 }, // Ź
+    { 17, 23, 19, 1, 23, 98, 33880 }, // ź
+    { 25, 29, 25, 1, 29, 182, 33978 }, // Ż
+    { 17, 22, 19, 1, 22, 94, 34160 }, // ż
+    { 25, 30, 25, 1, 30, 188, 34254 }, // Ž
+    { 17, 23, 19, 1, 23, 98, 34442 }, // ž
+    { 14, 20, 13, 3, 20, 70, 34540 }, // ſ
+    { 7, 4, 0, 6, 19, 7, 34610 }, // ̀
+    { 6, 5, 0, 5, 19, 8, 34617 }, // ́
+    { 11, 5, 0, -1, 0, 14, 34625 }, // ̂
+    { 10, 5, 0, 5, 19, 13, 34639 }, // ̃
+    { 13, 4, 0, 4, 17, 13, 34652 }, // ̄
+    { 17, 3, 0, 7, 22, 13, 34665 }, // ̅
+    { 11, 5, 0, 5, 18, 14, 34678 }, // ̆
+    { 5, 5, 0, 5, 20, 7, 34692 }, // ̇
+    { 12, 5, 0, 5, 20, 15, 34699 }, // ̈
+    { 6, 5, 0, 4, 16, 8, 34714 }, // ̉
+    { 7, 5, 0, 5, 19, 9, 34722 }, // ̊
+    { 17, 4, 0, 5, 19, 17, 34731 }, // ̋
+    { 11, 5, 0, 5, 19, 14, 34748 }, // ̌
+    { 18, 4, 0, -8, 20, 18, 34762 }, // ̏
+    { 8, 8, 0, 4, 19, 16, 34780 }, // ̒
+    { 8, 7, 0, 4, 18, 14, 34796 }, // ̓
+    { 8, 7, 0, -4, 18, 14, 34816 }, // ̔
+    { 6, 6, 0, 0, -1, 9, 34830 }, // ̘
+    { 5, 6, 0, 2, -1, 8, 34839 }, // ̙
+    { 11, 6, 0, 6, 20, 17, 34847 }, // ̚
+    { 5, 6, 0, 4, 16, 8, 34864 }, // ̛
+    { 4, 5, 0, 0, -2, 5, 34872 }, // ̜
+    { 6, 5, 0, 3, 4, 8, 34877 }, // ̝
+    { 6, 5, 0, 0, -1, 8, 34885 }, // ̞
+    { 6, 5, 0, 0, -2, 8, 34893 }, // ̟
+    { 12, 4, 0, 0, -3, 12, 34901 }, // ̠
+    { 5, 5, 0, 0, 1, 7, 34913 }, // ̣
+    { 13, 5, 0, -1, 0, 17, 34920 }, // ̤
+    { 7, 5, 0, 5, 19, 9, 34937 }, // ̥
+    { 8, 8, 0, 0, 4, 16, 34946 }, // ̦
+    { 7, 7, 0, 0, 1, 13, 34962 }, // ̧
+    { 7, 7, 0, 0, 1, 13, 34975 }, // ̨
+    { 6, 7, 0, -1, -1, 11, 34988 }, // ̩
+    { 9, 4, 0, 0, -1, 9, 34999 }, // ̪
+    { 11, 5, 0, 0, 0, 14, 35008 }, // ̬
+    { 11, 5, 0, -1, -1, 14, 35022 }, // ̭
+    { 10, 5, 0, 5, 19, 13, 35036 }, // ̰
+    { 10, 3, 0, 6, 18, 8, 35049 }, // ̱
+    { 11, 3, 0, 0, -2, 9, 35057 }, // ̲
+    { 10, 5, 0, 5, 19, 13, 35066 }, // ̴
+    { 13, 3, 0, 3, 9, 10, 35079 }, // ̵
+    { 4, 5, 0, 2, -2, 5, 35089 }, // ̹
+    { 10, 4, 0, -2, -1, 10, 35094 }, // ̺
+    { 9, 7, 0, 0, 0, 16, 35104 }, // ̻
+    { 9, 5, 0, 0, 0, 12, 35120 }, // ̼
+    { 7, 5, 0, 5, 19, 9, 35132 }, // ̽
+    { 10, 5, 0, 5, 19, 13, 35141 }, // ͂
+    { 5, 5, 0, 5, 21, 7, 35154 }, // ̓
+    { 12, 11, 0, 5, 26, 33, 35161 }, // ̈́
+    { 9, 5, 0, 6, 20, 12, 35194 }, // ͆
+    { 14, 9, 0, -1, 0, 32, 35206 }, // ͇
+    { 11, 7, 0, 0, 0, 20, 35238 }, // ͈
+    { 8, 7, 0, 0, -1, 14, 35258 }, // ͉
+    { 12, 15, 0, 5, 24, 45, 35272 }, // ͊
+    { 24, 11, 0, 8, 22, 66, 35317 }, // ͋
+    { 18, 12, 0, 5, 13, 54, 35383 }, // ͌
+    { 12, 8, 0, 2, 0, 24, 35437 }, // ͍
+    { 4, 4, 0, 3, 3, 4, 35461 }, // ͎
+    { 21, 5, 0, 1, 0, 27, 35465 }, // ͜
+    { 21, 5, 0, 5, 19, 27, 35492 }, // ͡
+    { 25, 6, 0, 0, -2, 38, 35519 }, // ͢
+    { 18, 25, 16, 1, 25, 113, 35557 }, // Ѐ
+    { 18, 24, 16, 1, 24, 108, 35670 }, // Ё
+    { 18, 21, 26, 8, 21, 95, 35778 }, // Ђ
+    { 18, 29, 16, 1, 29, 131, 35873 }, // Ѓ
+    { 20, 20, 23, 1, 19, 100, 36004 }, // Є
+    { 22, 23, 25, 1, 22, 127, 36104 }, // Ѕ
+    { 10, 21, 10, 1, 21, 53, 36231 }, // І
+    { 15, 30, 10, 1, 30, 113, 36284 }, // Ї
+    { 18, 28, 15, -1, 22, 126, 36397 }, // Ј
+    { 27, 19, 29, 2, 18, 129, 36523 }, // Љ
+    { 26, 20, 28, 2, 19, 130, 36652 }, // Њ
+    { 20, 22, 23, 5, 22, 110, 36864 }, // Ћ
+    { 22, 29, 22, 1, 29, 160, 36974 }, // Ќ
+    { 22, 27, 23, 2, 27, 149, 37134 }, // Ѝ
+    { 19, 30, 17, -1, 28, 143, 37283 }, // Ў
+    { 20, 23, 18, 1, 18, 115, 37426 }, // Џ
+    { 20, 21, 25, 1, 21, 105, 37541 }, // А
+    { 18, 19, 16, 2, 18, 86, 37646 }, // Б
+    { 17, 19, 17, 1, 18, 81, 37732 }, // В
+    { 18, 19, 16, 1, 19, 86, 37813 }, // Г
+    { 20, 22, 21, 2, 19, 110, 37899 }, // Д
+    { 18, 19, 16, 1, 19, 86, 38009 }, // Е
+    { 30, 21, 32, 1, 21, 158, 38095 }, // Ж
+    { 16, 21, 18, 1, 20, 84, 38253 }, // З
+    { 22, 22, 23, 2, 22, 121, 38337 }, // И
+    { 22, 29, 23, 2, 29, 160, 38458 }, // Й
+    { 20, 21, 22, 1, 21, 105, 38618 }, // К
+    { 19, 20, 19, 2, 19, 95, 38723 }, // Л
+    { 23, 19, 21, 1, 19, 110, 38912 }, // М
+    { 23, 22, 23, 1, 22, 127, 39022 }, // Н
+    { 24, 22, 25, 2, 21, 132, 39149 }, // О
+    { 19, 19, 17, 1, 19, 91, 39281 }, // П
+    { 20, 21, 20, 1, 21, 105, 39372 }, // Р
+    { 22, 23, 22, 1, 22, 127, 39477 }, // С
+    { 20, 21, 23, 5, 21, 105, 39604 }, // Т
+    { 19, 22, 17, -1, 20, 105, 39709 }, // У
+    { 20, 19, 22, 5, 19, 95, 39814 }, // Ф
+    { 24, 22, 25, 1, 22, 132, 39909 }, // Х
+    { 18, 23, 18, 1, 19, 104, 40041 }, // Ц
+    { 15, 19, 17, 4, 19, 72, 40145 }, // Ч
+    { 21, 19, 20, 2, 19, 100, 40217 }, // Ш
+    { 21, 23, 23, 2, 19, 121, 40317 }, // Щ
+    { 14, 20, 17, 2, 19, 70, 40438 }, // Ъ
+    { 26, 20, 27, 2, 19, 130, 40508 }, // Ы
+    { 14, 20, 17, 2, 19, 70, 40638 }, // Ь
+    { 21, 20, 23, 1, 19, 105, 40708 }, // Э
+    { 23, 20, 25, 3, 19, 115, 40813 }, // Ю
+    { 20, 22, 21, 1, 22, 110, 40960 }, // Я
+    { 16, 15, 19, 1, 15, 60, 41070 }, // а
+    { 17, 20, 18, 3, 20, 85, 41130 }, // б
+    { 14, 15, 16, 0, 15, 53, 41215 }, // в
+    { 16, 14, 15, 1, 14, 56, 41268 }, // г
+    { 17, 17, 19, 2, 14, 73, 41324 }, // д
+    { 16, 15, 19, 1, 15, 60, 41397 }, // е
+    { 27, 18, 27, 0, 18, 122, 41457 }, // ж
+    { 12, 14, 11, 0, 14, 42, 41579 }, // з
+    { 17, 15, 17, 1, 15, 64, 41621 }, // и
+    { 17, 19, 17, 1, 19, 81, 41685 }, // й
+    { 16, 15, 17, 0, 15, 60, 41766 }, // к
+    { 13, 14, 13, 1, 13, 46, 41826 }, // л
+    { 20, 16, 21, 0, 16, 80, 41872 }, // м
+    { 20, 16, 20, 0, 16, 80, 41952 }, // н
+    { 14, 16, 20, 3, 15, 56, 42032 }, // о
+    { 16, 14, 17, 2, 14, 56, 42088 }, // п
+    { 20, 21, 20, -1, 14, 105, 42144 }, // р
+    { 13, 16, 17, 1, 15, 52, 42249 }, // с
+    { 14, 14, 17, 5, 14, 49, 42301 }, // т
+    { 19, 21, 19, 0, 14, 100, 42350 }, // у
+    { 20, 20, 22, 3, 14, 100, 42450 }, // ф
+    { 18, 14, 18, 1, 14, 63, 42550 }, // х
+    { 16, 18, 18, 2, 14, 72, 42613 }, // ц
+    { 11, 13, 11, 2, 13, 36, 42685 }, // ч
+    { 20, 14, 20, 2, 14, 70, 42721 }, // ш
+    { 20, 19, 22, 2, 14, 95, 42791 }, // щ
+    { 14, 15, 19, 5, 14, 53, 42886 }, // ъ
+    { 20, 15, 20, 2, 14, 75, 43008 }, // ы
+    { 14, 15, 15, 1, 14, 53, 43083 }, // ь
+    { 15, 15, 16, 2, 14, 57, 43136 }, // э
+    { 19, 16, 20, 2, 15, 76, 43193 }, // ю
+    { 17, 15, 16, 1, 15, 64, 43269 }, // я
+    { 16, 24, 19, 1, 24, 96, 43333 }, // ѐ
+    { 16, 20, 17, 3, 19, 80, 43429 }, // ё
+    { 16, 25, 19, 1, 21, 100, 43509 }, // ђ
+    { 16, 21, 15, 1, 21, 84, 43609 }, // ѓ
+    { 14, 14, 16, 0, 13, 49, 43693 }, // є
+    { 15, 14, 18, 1, 14, 53, 43742 }, // ѕ
+    { 10, 22, 9, 1, 22, 55, 43795 }, // і
+    { 13, 22, 9, 1, 22, 72, 43850 }, // ї
+    { 16, 28, 16, 2, 21, 112, 43922 }, // ј
+    { 18, 14, 20, 1, 13, 63, 44034 }, // љ
+    { 18, 15, 19, 1, 14, 68, 44097 }, // њ
+    { 16, 21, 19, 1, 21, 84, 44165 }, // ћ
+    { 16, 22, 17, 0, 22, 88, 44249 }, // ќ
+    { 17, 21, 17, 1, 21, 90, 44337 }, // ѝ
+    { 19, 32, 19, 0, 25, 152, 44427 }, // ў
+    { 15, 17, 13, 0, 13, 64, 44579 }, // џ
+    { 13, 19, 21, 7, 18, 62, 44643 }, // Ѣ
+    { 13, 19, 18, 5, 18, 62, 44705 }, // ѣ
+    { 25, 18, 25, 2, 18, 113, 44767 }, // Ѫ
+    { 17, 14, 18, 1, 13, 60, 44880 }, // ѫ
+    { 22, 23, 24, 2, 22, 127, 45056 }, // Ѳ
+    { 18, 17, 19, 1, 17, 77, 45183 }, // ѳ
+    { 29, 27, 25, 6, 27, 196, 45260 }, // Ѵ
+    { 17, 17, 20, 4, 17, 73, 45456 }, // ѵ
+    { 11, 8, 0, 6, 23, 22, 45529 }, // ҆
+    { 19, 21, 16, 1, 21, 100, 45551 }, // Ґ
+    { 17, 17, 15, 1, 17, 73, 45651 }, // ґ
+    { 18, 19, 16, 1, 19, 86, 45724 }, // Ғ
+    { 13, 13, 11, 0, 13, 43, 45810 }, // ғ
+    { 21, 20, 17, 1, 20, 105, 45853 }, // Ҕ
+    { 11, 13, 11, 0, 13, 36, 45958 }, // ҕ
+    { 30, 25, 32, -1, 21, 188, 45994 }, // Җ
+    { 21, 18, 22, -2, 15, 95, 46182 }, // җ
+    { 16, 23, 18, 2, 20, 92, 46277 }, // Ҙ
+    { 12, 20, 11, 0, 14, 60, 46369 }, // ҙ
+    { 21, 24, 22, -1, 21, 126, 46429 }, // Қ
+    { 14, 17, 15, -1, 15, 60, 46555 }, // қ
+    { 22, 19, 24, 2, 19, 105, 46615 }, // Ҝ
+    { 17, 13, 18, 1, 13, 56, 46720 }, // ҝ
+    { 20, 21, 22, 1, 21, 105, 46776 }, // Ҟ
+    { 13, 21, 19, 1, 21, 69, 46881 }, // ҟ
+    { 22, 21, 22, -1, 21, 116, 46950 }, // Ҡ
+    { 15, 15, 15, -1, 15, 57, 47104 }, // ҡ
+    { 23, 25, 23, -1, 22, 144, 47161 }, // Ң
+    { 16, 17, 16, -1, 15, 68, 47305 }, // ң
+    { 31, 22, 23, 1, 22, 171, 47373 }, // Ҥ
+    { 22, 15, 16, 0, 15, 83, 47544 }, // ҥ
+    { 27, 21, 29, 2, 21, 142, 47627 }, // Ҧ
+    { 24, 23, 27, 2, 16, 138, 47769 }, // ҧ
+    { 24, 22, 30, 4, 21, 132, 47907 }, // Ҩ
+    { 20, 17, 23, 2, 16, 85, 48039 }, // ҩ
+    { 22, 26, 22, 1, 22, 143, 48124 }, // Ҫ
+    { 13, 19, 17, 1, 15, 62, 48267 }, // ҫ
+    { 19, 24, 23, 4, 21, 114, 48329 }, // Ҭ
+    { 13, 17, 16, 2, 15, 56, 48443 }, // ҭ
+    { 18, 21, 23, 6, 21, 95, 48499 }, // Ү
+    { 14, 18, 17, 5, 13, 63, 48594 }, // ү
+    { 19, 21, 23, 5, 21, 100, 48657 }, // Ұ
+    { 19, 19, 17, 0, 13, 91, 48757 }, // ұ
+    { 25, 25, 25, -1, 22, 157, 48848 }, // Ҳ
+    { 18, 17, 17, -2, 15, 77, 49005 }, // ҳ
+    { 19, 23, 27, 7, 18, 110, 49152 }, // Ҵ
+    { 14, 17, 19, 4, 13, 60, 49262 }, // ҵ
+    { 16, 24, 21, 4, 18, 96, 49322 }, // Ҷ
+    { 12, 17, 15, 2, 13, 51, 49418 }, // ҷ
+    { 16, 19, 18, 5, 19, 76, 49469 }, // Ҹ
+    { 12, 13, 12, 2, 13, 39, 49545 }, // ҹ
+    { 16, 21, 19, 2, 21, 84, 49584 }, // Һ
+    { 16, 21, 19, 1, 21, 84, 49668 }, // һ
+    { 20, 19, 24, 2, 18, 95, 49752 }, // Ҽ
+    { 14, 14, 17, 1, 14, 49, 49847 }, // ҽ
+    { 20, 22, 27, 5, 18, 110, 49896 }, // Ҿ
+    { 15, 17, 20, 3, 14, 64, 50006 }, // ҿ
+    { 10, 21, 10, 1, 21, 53, 50070 }, // Ӏ
+    { 30, 30, 32, 1, 30, 225, 50123 }, // Ӂ
+    { 27, 27, 27, 0, 27, 183, 50348 }, // ӂ
+    { 18, 25, 20, 2, 19, 113, 50531 }, // Ӄ
+    { 12, 17, 13, 1, 13, 51, 50644 }, // ӄ
+    { 19, 24, 19, 2, 19, 114, 50695 }, // Ӆ
+    { 13, 16, 13, 1, 13, 52, 50809 }, // ӆ
+    { 23, 28, 23, 1, 22, 161, 50861 }, // Ӈ
+    { 16, 20, 16, 0, 15, 80, 51022 }, // ӈ
+    { 23, 29, 23, 1, 22, 167, 51200 }, // Ӊ
+    { 16, 20, 16, 0, 15, 80, 51367 }, // ӊ
+    { 16, 23, 17, 3, 18, 92, 51447 }, // Ӌ
+    { 10, 16, 13, 3, 13, 40, 51539 }, // ӌ
+    { 26, 29, 31, 1, 22, 189, 51579 }, // Ӎ
+    { 18, 20, 21, 0, 15, 90, 51768 }, // ӎ
+    { 8, 18, 7, 2, 18, 36, 51858 }, // ӏ
+    { 22, 30, 25, 1, 30, 165, 51894 }, // Ӑ
+    { 20, 23, 19, 1, 23, 115, 52059 }, // ӑ
+    { 22, 29, 25, 1, 29, 160, 52174 }, // Ӓ
+    { 21, 21, 19, 1, 21, 111, 52334 }, // ӓ
+    { 33, 23, 36, 1, 22, 190, 52445 }, // Ӕ
+    { 26, 15, 31, 1, 15, 98, 52635 }, // ӕ
+    { 19, 26, 16, 1, 26, 124, 52733 }, // Ӗ
+    { 18, 25, 19, 1, 25, 113, 52857 }, // ӗ
+    { 16, 15, 19, 2, 14, 60, 52970 }, // Ә
+    { 16, 17, 21, 8, 16, 68, 53030 }, // ә
+    { 19, 26, 19, 2, 25, 124, 53098 }, // Ӛ
+    { 17, 18, 21, 7, 16, 77, 53248 }, // ӛ
+    { 30, 29, 33, 1, 29, 218, 53325 }, // Ӝ
+    { 27, 26, 27, 0, 26, 176, 53543 }, // ӝ
+    { 18, 27, 18, 1, 26, 122, 53719 }, // Ӟ
+    { 18, 21, 11, 0, 21, 95, 53841 }, // ӟ
+    { 14, 18, 15, 3, 18, 63, 53936 }, // Ӡ
+    { 15, 18, 15, 1, 13, 68, 53999 }, // ӡ
+    { 22, 26, 23, 2, 26, 143, 54067 }, // Ӣ
+    { 18, 20, 17, 1, 20, 90, 54210 }, // ӣ
+    { 22, 27, 23, 2, 27, 149, 54300 }, // Ӥ
+    { 18, 21, 17, 1, 21, 95, 54449 }, // ӥ
+    { 24, 30, 25, 2, 29, 180, 54544 }, // Ӧ
+    { 16, 23, 20, 3, 22, 92, 54724 }, // ӧ
+    { 21, 19, 25, 2, 18, 100, 54816 }, // Ө
+    { 17, 14, 19, 1, 14, 60, 54916 }, // ө
+    { 21, 30, 25, 2, 29, 158, 54976 }, // Ӫ
+    { 18, 23, 19, 1, 23, 104, 55134 }, // ӫ
+    { 21, 28, 23, 1, 27, 147, 55296 }, // Ӭ
+    { 15, 22, 16, 2, 21, 83, 55443 }, // ӭ
+    { 19, 28, 17, -1, 26, 133, 55526 }, // Ӯ
+    { 19, 29, 19, 0, 22, 138, 55659 }, // ӯ
+    { 19, 29, 17, -1, 27, 138, 55797 }, // Ӱ
+    { 19, 31, 19, 0, 24, 148, 55935 }, // ӱ
+    { 21, 29, 17, -1, 27, 153, 56083 }, // Ӳ
+    { 22, 31, 19, 0, 24, 171, 56236 }, // ӳ
+    { 16, 26, 17, 4, 26, 104, 56407 }, // Ӵ
+    { 14, 21, 11, 2, 21, 74, 56511 }, // ӵ
+    { 18, 23, 16, 1, 19, 104, 56585 }, // Ӷ
+    { 13, 16, 11, 0, 13, 52, 56689 }, // ӷ
+    { 26, 29, 27, 2, 28, 189, 56741 }, // Ӹ
+    { 20, 24, 20, 2, 23, 120, 56930 }, // ӹ
+    { 24, 26, 25, 1, 22, 156, 57050 }, // Ӽ
+    { 17, 18, 17, 0, 15, 77, 57206 }, // ӽ
+    { 0, 0, 21, 0, 0, 0, 57283 }, //  
+    { 0, 0, 33, 0, 0, 0, 57283 }, //  
+    { 0, 0, 21, 0, 0, 0, 57283 }, //  
+    { 0, 0, 33, 0, 0, 0, 57283 }, //  
+    { 0, 0, 16, 0, 0, 0, 57283 }, //  
+    { 0, 0, 14, 0, 0, 0, 57283 }, //  
+    { 0, 0, 12, 0, 0, 0, 57283 }, //  
+    { 0, 0, 17, 0, 0, 0, 57283 }, //  
+    { 0, 0, 7, 0, 0, 0, 57283 }, //  
+    { 0, 0, 13, 0, 0, 0, 57283 }, //  
+    { 0, 0, 12, 0, 0, 0, 57283 }, //  
+    { 0, 0, 8, 0, 0, 0, 57283 }, // ​
+    { 0, 0, 0, 0, 0, 0, 57283 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 57283 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 57283 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 57283 }, // ‏
+    { 13, 3, 14, 3, 9, 10, 57283 }, // ‐
+    { 13, 3, 14, 3, 9, 10, 57293 }, // ‑
+    { 19, 3, 19, 4, 9, 15, 57303 }, // ‒
+    { 18, 4, 20, 3, 9, 18, 57318 }, // –
+    { 26, 4, 28, 3, 9, 26, 57344 }, // —
+    { 26, 4, 28, 3, 9, 26, 57370 }, // ―
+    { 17, 22, 14, 0, 18, 94, 57396 }, // ‖
+    { 21, 8, 20, 0, -2, 42, 57490 }, // ‗
+    { 8, 7, 8, 5, 21, 14, 57532 }, // ‘
+    { 8, 8, 8, 5, 22, 16, 57546 }, // ’
+    { 8, 8, 8, 0, 4, 16, 57562 }, // ‚
+    { 8, 7, 8, 5, 21, 14, 57578 }, // ‛
+    { 14, 7, 14, 5, 21, 25, 57592 }, // “
+    { 14, 7, 14, 5, 21, 25, 57617 }, // ”
+    { 8, 8, 8, 0, 4, 16, 57642 }, // „
+    { 14, 8, 14, 5, 21, 28, 57658 }, // ‟
+    { 14, 32, 15, 4, 25, 112, 57686 }, // †
+    { 16, 32, 15, 2, 25, 128, 57798 }, // ‡
+    { 17, 15, 13, 0, 18, 64, 57926 }, // •
+    { 7, 8, 10, 3, 11, 14, 57990 }, // ‣
+    { 5, 5, 7, 1, 5, 7, 58004 }, // ․
+    { 5, 5, 7, 1, 5, 7, 58011 }, // ‥
+    { 22, 5, 24, 1, 5, 28, 58018 }, // …
+    { 4, 3, 6, 2, 9, 3, 58046 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 58049 }, //  
+    { 20, 22, 28, 6, 20, 110, 58049 }, // ‰
+    { 8, 8, 8, 5, 22, 16, 58159 }, // ′
+    { 14, 7, 14, 5, 21, 25, 58175 }, // ″
+    { 18, 8, 21, -3, 21, 36, 58200 }, // ‴
+    { 5, 7, 8, 6, 21, 9, 58236 }, // ‵
+    { 11, 7, 13, 5, 21, 20, 58245 }, // ‶
+    { 18, 8, 21, 6, 21, 36, 58265 }, // ‷
+    { 11, 5, 14, 6, 20, 14, 58301 }, // ‸
+    { 9, 12, 10, 3, 13, 27, 58315 }, // ‹
+    { 9, 12, 10, -2, 13, 27, 58342 }, // ›
+    { 32, 26, 33, 1, 23, 208, 58369 }, // ※
+    { 12, 25, 8, 1, 25, 75, 58577 }, // ‼
+    { 17, 31, 19, 5, 30, 132, 58652 }, // ‽
+    { 13, 3, 14, 6, 21, 10, 58784 }, // ‾
+    { 11, 5, 16, 5, 17, 14, 58794 }, // ‿
+    { 18, 16, 20, 4, 22, 72, 58808 }, // ⁂
+    { 20, 20, 28, 6, 19, 100, 58880 }, // ⁄
+    { 30, 28, 32, 6, 28, 210, 58980 }, // ⁇
+    { 21, 28, 25, 6, 28, 147, 59190 }, // ⁈
+    { 26, 30, 20, 0, 28, 195, 59392 }, // ⁉
+    { 25, 39, 19, -1, 27, 244, 59587 }, // ⁒
+    { 0, 0, 121, 0, 0, 0, 59831 }, //  
+    { 8, 10, 8, 3, 21, 20, 59831 }, // ⁰
+    { 8, 10, 8, 3, 21, 20, 59851 }, // ⁴
+    { 8, 10, 8, 3, 21, 20, 59871 }, // ⁵
+    { 9, 9, 8, 3, 20, 21, 59891 }, // ⁶
+    { 7, 10, 8, 5, 21, 18, 59912 }, // ⁷
+    { 9, 10, 8, 3, 21, 23, 59930 }, // ⁸
+    { 9, 9, 8, 3, 20, 21, 59953 }, // ⁹
+    { 16, 14, 19, 1, 14, 56, 59974 }, // ⁿ
+    { 12, 13, 11, 1, 13, 39, 60030 }, // ₀
+    { 6, 10, 8, -1, 6, 15, 60069 }, // ₁
+    { 9, 10, 8, -1, 6, 23, 60084 }, // ₂
+    { 9, 9, 8, -1, 5, 21, 60107 }, // ₃
+    { 8, 10, 8, -1, 6, 20, 60128 }, // ₄
+    { 8, 10, 8, -1, 6, 20, 60148 }, // ₅
+    { 9, 9, 8, -1, 5, 21, 60168 }, // ₆
+    { 7, 11, 8, 1, 6, 20, 60189 }, // ₇
+    { 9, 10, 8, -1, 6, 23, 60209 }, // ₈
+    { 9, 9, 8, -1, 5, 21, 60232 }, // ₉
+    { 14, 34, 11, 3, 25, 119, 60253 }, // ₍
+    { 14, 34, 11, -6, 25, 119, 60372 }, // ₎
+    { 24, 31, 22, 0, 26, 186, 60491 }, // ₡
+    { 22, 23, 22, 1, 22, 127, 60677 }, // ₢
+    { 19, 24, 17, 1, 24, 114, 60804 }, // ₤
+    { 25, 22, 23, 0, 22, 138, 60918 }, // ₦
+    { 21, 21, 20, 1, 21, 111, 61056 }, // ₧
+    { 28, 21, 28, 0, 21, 147, 61167 }, // ₨
+    { 21, 21, 19, -1, 21, 111, 61314 }, // ₩
+    { 24, 19, 27, 4, 19, 114, 61440 }, // ₪
+    { 18, 20, 17, 2, 20, 90, 61554 }, // ₫
+    { 19, 23, 21, 2, 20, 110, 61644 }, // €
+    { 20, 21, 23, 5, 21, 105, 61754 }, // ₮
+    { 24, 21, 16, 1, 21, 126, 61859 }, // ₱
+    { 21, 30, 25, 2, 26, 158, 61985 }, // ₲
+    { 28, 23, 23, 2, 22, 161, 62143 }, // ₴
+    { 13, 20, 17, 1, 18, 65, 62304 }, // ₵
+    { 23, 22, 23, 5, 22, 127, 62369 }, // ₸
+    { 15, 20, 15, 3, 19, 75, 62496 }, // ₹
+    { 15, 17, 17, 2, 16, 64, 62571 }, // ₺
+    { 18, 20, 16, 2, 20, 90, 62635 }, // ₼
+    { 24, 21, 20, -3, 21, 126, 62725 }, // ₽
+    { 16, 16, 19, -3, 12, 64, 62851 }, // ←
+    { 16, 15, 19, 4, 15, 60, 62915 }, // ↑
+    { 16, 16, 19, 6, 12, 64, 62975 }, // →
+    { 16, 15, 19, 8, 15, 60, 63039 }, // ↓
+    { 27, 13, 22, -2, 11, 88, 63099 }, // ↔
+    { 14, 26, 16, 3, 24, 91, 63187 }, // ↕
+    { 15, 11, 16, -3, 11, 42, 63278 }, // ↖
+    { 15, 11, 16, 4, 11, 42, 63320 }, // ↗
+    { 12, 16, 16, 6, 14, 48, 63362 }, // ↘
+    { 12, 16, 16, -2, 14, 48, 63410 }, // ↙
+    { 19, 16, 21, 0, 15, 76, 63488 }, // ⇐
+    { 20, 18, 23, 4, 18, 90, 63564 }, // ⇑
+    { 19, 16, 21, 3, 15, 76, 63654 }, // ⇒
+    { 20, 19, 23, 9, 18, 95, 63730 }, // ⇓
+    { 25, 16, 24, 0, 15, 100, 63825 }, // ⇔
+    { 16, 24, 19, 6, 15, 96, 63925 }, // ⇕
+    { 19, 20, 17, 2, 20, 95, 64021 }, // ∂
+    { 26, 23, 25, 0, 22, 150, 64116 }, // ∅
+    { 20, 19, 22, 1, 19, 95, 64266 }, // ∆
+    { 18, 18, 18, 4, 18, 81, 64361 }, // ∏
+    { 18, 18, 18, 8, 18, 81, 64442 }, // ∐
+    { 17, 19, 15, 1, 18, 81, 64523 }, // ∑
+    { 12, 4, 15, 3, 9, 12, 64604 }, // −
+    { 24, 21, 23, 3, 20, 126, 64616 }, // √
+    { 22, 12, 23, 3, 15, 66, 64742 }, // ∞
+    { 27, 28, 21, 0, 22, 189, 64808 }, // ∫
+    { 9, 15, 7, 1, 15, 34, 64997 }, // ∶
+    { 18, 12, 19, 5, 13, 54, 65031 }, // ≈
+    { 20, 22, 28, 6, 20, 110, 65085 }, // ≠
+    { 21, 19, 22, -1, 18, 100, 65195 }, // ≤
+    { 22, 19, 22, 1, 18, 105, 65295 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
@@ -4775,4 +2984,9 @@ static const EpdFontData opendyslexic_12_italic = {
     33,
     -13,
     true,
+    opendyslexic_12_italicBlockOffsets,
+    opendyslexic_12_italicDirectGlyphs,
+    opendyslexic_12_italicGlyphPages,
+    35,
+    opendyslexic_12_italicPageGlyphs,
 };
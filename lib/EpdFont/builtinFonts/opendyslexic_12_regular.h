@@ -2,3376 +2,1889 @@
  * generated by fontconvert.py
  * name: opendyslexic_12_regular
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_regularBitmaps[53807] = {
-    0x01, 0x80, 0x3C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x40, 0x00, 0x3F, 0x83,
-    0xF8, 0x7F, 0xCB, 0xFC, 0xFF, 0xC0, 0xBF, 0x83, 0xFC, 0xBF, 0x43, 0xFC, 0xBF, 0x03, 0xFC, 0xBF,
-    0x03, 0xF8, 0xBF, 0x03, 0xF4, 0xFF, 0x03, 0xF4, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x01, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x74, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x1D, 0x10, 0x00, 0x1F,
-    0xD7, 0x47, 0x40, 0x00, 0x0B, 0xE1, 0xD1, 0xD0, 0x00, 0x02, 0xF8, 0x74, 0x74, 0x00, 0x00, 0x7F,
-    0x1D, 0x1D, 0x00, 0x00, 0x0F, 0xFF, 0x8B, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x4B, 0xFF, 0xF0, 0x00, 0x01,
-    0xD1, 0xEF, 0xFE, 0x00, 0x00, 0x74, 0x77, 0xFF, 0xC0, 0x00, 0x1D, 0x1E, 0xFF, 0xF0, 0x1F, 0xEF,
-    0xAF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0x00, 0x74,
-    0x74, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x03, 0x80, 0x1F, 0xD0, 0x02, 0xC0, 0x1E, 0x6D, 0x00, 0xE0, 0x0D, 0x01, 0xC0,
-    0xF0, 0x03, 0x00, 0x30, 0x74, 0x01, 0xC0, 0x0D, 0x3C, 0x00, 0x34, 0x03, 0x2D, 0x00, 0x0F, 0x47,
-    0xDF, 0x00, 0x01, 0xFF, 0xEF, 0x00, 0x00, 0x1F, 0xD7, 0x80, 0x00, 0x00, 0x03, 0xDF, 0xF8, 0x00,
-    0x02, 0xEE, 0x03, 0x80, 0x00, 0xF7, 0x00, 0x70, 0x00, 0xF5, 0xC0, 0x1C, 0x00, 0x7C, 0x70, 0x07,
-    0x00, 0x3D, 0x0E, 0x47, 0xC0, 0x2F, 0x02, 0xFF, 0xD0, 0x1F, 0x00, 0x2F, 0xD0, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00,
-    0x0B, 0xE0, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x14, 0x1F, 0xD0,
-    0x3F, 0x00, 0xFC, 0x3F, 0xC0, 0x0F, 0xD1, 0xFC, 0x3F, 0xC0, 0x02, 0xF7, 0xF4, 0x3F, 0xC0, 0x00,
-    0xBF, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0x57, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFE,
-    0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x20, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x6F, 0xDB, 0xF7, 0xFC, 0xFF, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x2E, 0x00, 0x3E, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0xC0,
-    0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x15, 0x74, 0x00,
-    0x3C, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF0,
-    0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF4,
-    0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x7E, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xE0, 0x10, 0x74, 0x38, 0x2D, 0x2F,
-    0xCE, 0x7D, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xFF, 0xE4, 0x1F, 0xCE, 0x2F, 0x83,
-    0x83, 0xC0, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2C, 0x00,
-    0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B, 0xF0, 0x2A, 0xAA, 0xAA, 0x0F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x1E, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x00, 0xF4, 0x00, 0xB4, 0x0F, 0x00,
-    0x03, 0xC2, 0xF0, 0x00, 0x3C, 0x2E, 0x0B, 0x03, 0xD3, 0xE0, 0xF8, 0x3D, 0x3E, 0x0F, 0x83, 0xE3,
-    0xE0, 0xF4, 0x3E, 0x3F, 0x07, 0x03, 0xE3, 0xF0, 0x00, 0x7D, 0x2F, 0x40, 0x0B, 0xD2, 0xFC, 0x01,
-    0xFC, 0x1F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0x7D, 0x00, 0x04,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00,
-    0x15, 0xFE, 0x94, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x01, 0xBF, 0x90, 0x0B,
-    0xFF, 0xFF, 0x02, 0xE4, 0x1B, 0xE0, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFA, 0xA9,
-    0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x06, 0xFF, 0x90, 0x03, 0xFA, 0xFF,
-    0x00, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0xBC, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x3F, 0xAF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x3E, 0x78,
-    0x00, 0x0F, 0xC7, 0x80, 0x02, 0xF0, 0xBC, 0x00, 0x7E, 0x0B, 0xC0, 0x0F, 0xC0, 0xBC, 0x03, 0xF5,
-    0x5F, 0xD5, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0A, 0xAB, 0xFD, 0x07, 0xFF,
-    0xFF, 0x81, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x05, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE1, 0x80, 0x07, 0xF4, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0xF4,
-    0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x03, 0xE2, 0xFE, 0x40, 0x3F, 0xFF, 0xFE, 0x03, 0xFE, 0x02, 0xF8, 0x3F, 0x80, 0x0B, 0xC3,
-    0xF0, 0x00, 0x3D, 0x2F, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x3D, 0x1F, 0x80, 0x0B, 0xD0, 0xFE, 0x56,
-    0xFC, 0x07, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE2, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0x91,
-    0xB8, 0x00, 0x78, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0xF0, 0x0F, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x1F,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0xFD, 0x5F, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0xBE, 0x02, 0xF8, 0x07, 0xE0, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x3F, 0x0F, 0xE0, 0x02, 0xFC, 0x0F, 0xFA, 0xBF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x0A, 0xFE,
-    0x80, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0xAF, 0xD0, 0x0F, 0x80, 0x3F, 0x01, 0xF0, 0x00, 0xF8,
-    0x2D, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0xBC, 0x3D, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x7D, 0x2F, 0x00,
-    0x0B, 0xE0, 0xFC, 0x01, 0xFE, 0x0B, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFD, 0x00, 0x05, 0x43, 0xD0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x65, 0x56, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xE4, 0x00, 0x3F, 0x0F, 0xD7, 0xF6, 0xFE, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0xFC, 0x7F, 0x6F, 0xDB, 0xF8, 0x0F, 0xC1, 0xFC, 0x2F, 0xC3, 0xFD, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8,
-    0x7F, 0x4B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x00,
-    0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00,
-    0x1B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xFE,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-    0xBF, 0xFC, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x6F, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x0F, 0xFF, 0xFD, 0x03, 0xF9, 0x6F, 0xF0, 0x2C, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xF9, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x02,
-    0xD0, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x01, 0xF0, 0x0F, 0xE8,
-    0x02, 0xC0, 0x3E, 0x03, 0x87, 0xC0, 0x1C, 0x03, 0xC0, 0x60, 0x2C, 0x00, 0xD0, 0xBC, 0x09, 0x02,
-    0xC0, 0x1D, 0x0B, 0xC0, 0xD0, 0x2C, 0x02, 0xC0, 0xBD, 0x0F, 0x4B, 0xC0, 0x3C, 0x0B, 0xE0, 0x7F,
-    0xFD, 0x0F, 0x40, 0x7F, 0x01, 0xF8, 0xEB, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xE0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x01, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2,
-    0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC,
-    0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x7E, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x02, 0xF0,
-    0x7E, 0x00, 0x02, 0xE0, 0x7E, 0x00, 0x03, 0xE0, 0x7F, 0xAA, 0xAF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x7E, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xBE, 0x7E, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x0B, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x1B, 0xFD,
-    0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0xD0,
-    0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x7E,
-    0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00,
-    0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x55, 0x5B, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xF8, 0x7F, 0x50, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFE, 0x40, 0x01, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01,
-    0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x6F, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01,
-    0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xF0, 0x1F, 0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00,
-    0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0xFD,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x3F, 0x43, 0xF8,
-    0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0,
-    0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xC0,
-    0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7, 0xF9,
-    0xFF, 0x7F, 0xDF, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBF,
-    0x01, 0x0B, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x01, 0x40,
-    0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x2F, 0x42,
-    0xFC, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F,
-    0x3F, 0x80, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF, 0x40,
-    0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4, 0x0B,
-    0xFF, 0x40, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x02, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFC,
-    0x07, 0xEF, 0xF0, 0x03, 0xFB, 0xF0, 0x2F, 0x7F, 0xD0, 0x1F, 0xDF, 0xC0, 0xBD, 0x7F, 0x80, 0xFF,
-    0x3F, 0x02, 0xF8, 0xFF, 0x03, 0xF5, 0xFD, 0x0B, 0xE2, 0xFE, 0x2F, 0xC7, 0xF4, 0x2F, 0x87, 0xFC,
-    0xFF, 0x1F, 0xD0, 0xFE, 0x0F, 0xFB, 0xF4, 0xBF, 0x83, 0xFC, 0x1F, 0xFF, 0xC2, 0xFE, 0x0F, 0xF0,
-    0x3F, 0xFE, 0x0B, 0xF8, 0x3F, 0xC0, 0xBF, 0xF4, 0x2F, 0xF0, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC3,
-    0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x0F, 0xF0, 0x07, 0xF0, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F,
-    0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F,
-    0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0,
-    0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8,
-    0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0,
-    0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF,
-    0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xF5, 0x56, 0xFD, 0x0B, 0xC0, 0x00, 0xFC, 0x2F, 0x00, 0x01,
-    0xF4, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF9, 0x01,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x87, 0xE0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x47, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x19, 0x03,
-    0xF0, 0x3F, 0xE0, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80,
-    0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0,
-    0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90,
-    0x04, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40,
-    0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80,
-    0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD,
-    0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00,
-    0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00,
-    0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x40, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x0B,
-    0xF4, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0xBF,
-    0x40, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x4F, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x02, 0xFC, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x07, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xD0,
-    0x1F, 0xFE, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0x0B, 0xFB, 0xF8,
-    0x2F, 0xC0, 0x02, 0xFC, 0x3F, 0xCB, 0xF0, 0xFE, 0x00, 0x07, 0xF2, 0xFE, 0x0F, 0xE3, 0xF4, 0x00,
-    0x0F, 0xEF, 0xF4, 0x3F, 0xDF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF,
-    0x40, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80,
-    0xFD, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x00,
-    0x7F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x3F, 0x00, 0x00,
-    0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF, 0x00, 0x03, 0xF0, 0x03,
-    0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0xBF,
-    0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA, 0xAF, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x41, 0xFF, 0xF0, 0x7F, 0xFC, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0x0F,
-    0xFF, 0x83, 0xFF, 0xE0, 0x10, 0x00, 0x08, 0x00, 0x03, 0x40, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x07,
-    0x80, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00,
-    0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00,
-    0x3E, 0x00, 0x0F, 0x40, 0x02, 0xC0, 0x00, 0x20, 0x00, 0x00, 0x15, 0x54, 0x0F, 0xFF, 0x03, 0xFF,
-    0xC0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0x3E, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x28, 0x00, 0x02, 0xF4, 0x00, 0x1F,
-    0xF4, 0x01, 0xE0, 0xB4, 0x2C, 0x00, 0x74, 0x05, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40,
-    0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3,
-    0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2F, 0x0B, 0xE4, 0x00, 0xBE, 0xFF, 0xFC, 0x02, 0xFF, 0xE6, 0xFC, 0x07, 0xFC,
-    0x00, 0xF8, 0x1F, 0xC0, 0x01, 0xF0, 0x7F, 0x00, 0x03, 0xE1, 0xFC, 0x00, 0x0F, 0x87, 0xF0, 0x00,
-    0x3E, 0x0F, 0xC0, 0x01, 0xF4, 0x3F, 0x80, 0x1F, 0xC0, 0xFF, 0xEB, 0xFE, 0x03, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0xA4, 0x1F, 0x00, 0x2F, 0xFD, 0x7C, 0x03, 0xFF, 0xFE, 0xF0, 0x2F, 0x41,
-    0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0x0B, 0x80, 0x02, 0xFC, 0x3D, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x1F,
-    0x83, 0xD0, 0x00, 0xBE, 0x0F, 0x80, 0x03, 0xF8, 0x3F, 0x90, 0x7F, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xBC, 0x00, 0x6F, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03,
-    0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC,
-    0x00, 0x2B, 0xFD, 0x00, 0x00, 0x6F, 0x80, 0x7F, 0xE0, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x07,
-    0xD0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x2F,
-    0x80, 0x00, 0xBF, 0x43, 0xD0, 0x3F, 0xFE, 0x7C, 0x0F, 0xEB, 0xFF, 0xC1, 0xF0, 0x0B, 0xFC, 0x3D,
-    0x00, 0x3F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x2F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x0B,
-    0xF4, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF4, 0x0D, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x1F, 0x7F, 0xFD, 0x01, 0xFF, 0xFF, 0xF4, 0x1F, 0xF0,
-    0x1F, 0x81, 0xFC, 0x00, 0x7C, 0x2F, 0x40, 0x03, 0xC2, 0xF0, 0x00, 0x3C, 0x2F, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x3D, 0x3F, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x3D, 0x3F, 0x00, 0x07, 0xE3, 0xF4, 0x00,
-    0xBE, 0x3F, 0x40, 0x0B, 0xE0, 0x2F, 0x0F, 0xD3, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xB8, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xD0, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-    0x80, 0x00, 0x78, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x07, 0xF4, 0x1F, 0xFF, 0x03,
-    0xFF, 0xC0, 0x15, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x3E,
-    0x00, 0x2F, 0x0F, 0xC0, 0x02, 0xF3, 0xF0, 0x00, 0x2F, 0xBD, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF3, 0xFC, 0x00, 0x3F, 0x1F, 0xF0,
-    0x03, 0xF0, 0xBF, 0xC0, 0x3F, 0x02, 0xFF, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x7C, 0x01, 0xF0,
-    0x0B, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x7D, 0x01, 0xF4, 0x07, 0xD0, 0x1F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xFF, 0x1F, 0xFD, 0x7F, 0xF8,
-    0x0B, 0x87, 0xF8, 0x01, 0xFE, 0x00, 0x2E, 0xBF, 0xFD, 0x2F, 0xFE, 0x00, 0xFF, 0xE6, 0xFD, 0xFA,
-    0xBD, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xB8, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xF0, 0x3F, 0x00, 0x0B,
-    0xC0, 0x03, 0xC1, 0xF8, 0x00, 0x2F, 0x00, 0x0F, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x2F, 0x40,
-    0x03, 0xE0, 0x01, 0xF0, 0xBD, 0x00, 0x0F, 0x80, 0x07, 0xC3, 0xF4, 0x00, 0x7D, 0x00, 0x2F, 0x4F,
-    0xC0, 0x02, 0xF4, 0x00, 0xBD, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xD0, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F,
-    0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F,
-    0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4,
-    0x00, 0xFD, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE4, 0x6F, 0x41, 0xF0, 0x00, 0x7C,
-    0x3E, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x2F, 0x3E, 0x00,
-    0x03, 0xE3, 0xF4, 0x00, 0xBD, 0x1F, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00,
-    0x07, 0xFE, 0x00, 0x01, 0x02, 0xB9, 0x00, 0x2E, 0x3F, 0xFE, 0x00, 0xBF, 0xF4, 0x7E, 0x01, 0xFF,
-    0x00, 0x3C, 0x07, 0xF0, 0x00, 0xB8, 0x1F, 0xC0, 0x01, 0xF0, 0x7E, 0x00, 0x07, 0xC1, 0xFC, 0x00,
-    0x1F, 0x07, 0xF0, 0x00, 0x7C, 0x1F, 0xF0, 0x03, 0xE0, 0xBF, 0xF9, 0xBF, 0x42, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xEF, 0xFF, 0xC0, 0x3E, 0x2F, 0xFC, 0x01, 0xF8, 0x01, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0xBC, 0x00, 0x3F, 0xAF, 0xAF, 0x00, 0x3F,
-    0x00, 0xFF, 0xC0, 0x1F, 0x00, 0x0F, 0xF0, 0x0F, 0x80, 0x03, 0xF8, 0x03, 0xD0, 0x00, 0xFE, 0x00,
-    0xF0, 0x00, 0x3F, 0x40, 0x3C, 0x00, 0x0F, 0xD0, 0x0F, 0x00, 0x07, 0xF4, 0x03, 0xE0, 0x03, 0xFC,
-    0x00, 0x7F, 0xAB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0xF0, 0x00, 0x06, 0xF9,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xDB, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0xD0, 0xFB,
-    0xFD, 0x0F, 0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0,
-    0x7E, 0xAB, 0xF4, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x6B, 0xFA, 0x93, 0xFF, 0xFF,
-    0xC0, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x54, 0x01, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xC0, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC,
-    0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00,
-    0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0,
-    0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x28, 0x00, 0x00, 0x29, 0x2F, 0x00, 0x00, 0x7C, 0x0F,
-    0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xF0, 0x07, 0xD0, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xD0, 0x01,
-    0xF4, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0xBD, 0x2F, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x1F, 0x80,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x3C, 0x03, 0xF0, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x0B, 0xD1, 0xFF,
-    0x47, 0xE0, 0x07, 0xE3, 0xFF, 0xCB, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xEB, 0xFF, 0x80, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00,
-    0x00, 0xBE, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xFD, 0x0F,
-    0xC0, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x01, 0xFC, 0x2F,
-    0xC0, 0x03, 0xF4, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xF4, 0x3F, 0xC0, 0x02, 0xFC, 0x3D, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3E, 0x01, 0xF4, 0x01, 0xF4, 0x03, 0xF0, 0x0B, 0xC0,
-    0x07, 0xD0, 0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x3F, 0x7F, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFD, 0x01, 0x55, 0x5F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xA8,
-    0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00,
-    0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFE, 0x90, 0x00, 0xFF, 0xE0, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-    0x2C, 0x2C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x2A, 0x90, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x05, 0xBF, 0x40, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00,
-    0xFF, 0xCB, 0xFC, 0x7F, 0xC3, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x41, 0xFC, 0x1F, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x07, 0xC0,
-    0x7C, 0x07, 0xC0, 0x3C, 0x01, 0x80, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xF0, 0x0F, 0xDF, 0x10, 0x2F, 0x4E,
-    0x00, 0x3F, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3E, 0x0E, 0x00,
-    0x3F, 0x4E, 0x00, 0x2F, 0xED, 0x00, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF9, 0x00,
-    0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xF9, 0x1B, 0xD0, 0x0F, 0x80, 0x00, 0x80,
-    0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x05, 0xBD, 0x55, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xEA, 0xA5, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x0F,
-    0xEF, 0xAF, 0xC0, 0xBF, 0xFF, 0xF4, 0x03, 0xE0, 0x3E, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x0F,
-    0x40, 0xBC, 0x01, 0xF0, 0x07, 0xF0, 0x7F, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC2, 0xFA,
-    0xFD, 0xBD, 0x0A, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0xBE, 0x2F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xEF, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x2C, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x04,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x00, 0x01, 0x90, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x0B, 0x80, 0x7C, 0x00, 0x34, 0x00, 0x20, 0x00, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0x90, 0x1F, 0x80, 0xB8,
-    0x00, 0x1F, 0x02, 0xD0, 0x00, 0x7C, 0x0B, 0xE4, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFC, 0x00, 0x01, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x65, 0x57, 0xFD,
-    0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43, 0xFC, 0x00,
-    0x69, 0x00, 0x1D, 0x0A, 0x00, 0xC7, 0x86, 0x08, 0x70, 0x0C, 0x32, 0x40, 0x24, 0xC9, 0x00, 0x53,
-    0x1D, 0x02, 0x06, 0x2F, 0x0C, 0x0A, 0x01, 0xC0, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xEC, 0x1D,
-    0x3C, 0x24, 0x0C, 0x30, 0x0C, 0x30, 0x0D, 0x34, 0x3D, 0x2F, 0xFE, 0x0B, 0xDA, 0x00, 0x05, 0x00,
-    0x40, 0x07, 0x40, 0xB0, 0x0B, 0xC0, 0xF8, 0x0B, 0xC0, 0xF8, 0x0F, 0x81, 0xF4, 0x0B, 0xC0, 0xF4,
-    0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x87, 0xF0, 0x02, 0xF8, 0x7F, 0x00, 0x2F, 0x07, 0xE0, 0x02, 0xC0,
-    0x74, 0x00, 0x10, 0x00, 0x3F, 0xA9, 0x50, 0x0F, 0xFF, 0xFF, 0xC1, 0x55, 0x6B, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x69, 0x00, 0x1D, 0x0A, 0x00, 0xCA, 0x45,
-    0x09, 0x22, 0x4C, 0x30, 0x88, 0x24, 0xC3, 0xF0, 0x53, 0x0C, 0xA2, 0x06, 0x31, 0xDC, 0x0A, 0x02,
-    0xC0, 0x06, 0xE4, 0x00, 0x00, 0x55, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x00, 0x0F, 0xFF, 0xD0, 0x2F, 0x01, 0xF0, 0x3C, 0x00, 0xB8, 0x7C, 0x00, 0x3C, 0xBC, 0x00,
-    0x7C, 0x7D, 0x00, 0xBC, 0x3F, 0x42, 0xF8, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0x01, 0xB9, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFF, 0xFF,
-    0x45, 0x57, 0xE5, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA4, 0x2F, 0xFF, 0xFF, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xD0,
-    0x41, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xE0, 0x1F, 0x01, 0xF0, 0x0F, 0xFD, 0x2A, 0xA0, 0x1F, 0xE0,
-    0x00, 0x90, 0x00, 0x80, 0x09, 0x07, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x0B, 0x2F, 0xF4, 0x6E, 0x40,
-    0x07, 0x43, 0xC1, 0xF0, 0xB4, 0x3C, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0xBD, 0x00, 0x0F, 0x82, 0xF4,
-    0x00, 0x3E, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x80, 0x03, 0xF0, 0xFE, 0x00, 0x0F, 0xC3, 0xF8, 0x00,
-    0x3F, 0x0F, 0xF0, 0x00, 0xFC, 0x3F, 0xC0, 0x03, 0xF0, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x3B, 0xFF, 0xFE, 0xF0, 0xE3, 0xFF, 0xDB, 0xC3, 0x80, 0x54, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xC0, 0xFF, 0xC0,
-    0xF0, 0xBF, 0xF0, 0x3C, 0x3F, 0xFC, 0x0F, 0x0F, 0xFE, 0x03, 0xC3, 0xFF, 0x80, 0xF0, 0x7F, 0xE0,
-    0x3C, 0x0B, 0xF8, 0x0F, 0x00, 0xBD, 0x03, 0xC0, 0x3F, 0x40, 0xF0, 0x0F, 0xD0, 0x2C, 0x03, 0xF0,
-    0x0B, 0x01, 0xFC, 0x02, 0xC0, 0xBF, 0x00, 0xB0, 0x3F, 0xC0, 0x2D, 0x0F, 0xF0, 0x0B, 0x43, 0xFC,
-    0x02, 0xD1, 0xFF, 0x00, 0xB4, 0xBF, 0x80, 0x2D, 0x2F, 0xE0, 0x0B, 0x40, 0x00, 0x0F, 0xC3, 0xF1,
-    0xFC, 0xBF, 0x40, 0x08, 0x02, 0x40, 0x3A, 0x40, 0x0C, 0x00, 0x91, 0x6C, 0x3F, 0x40, 0x00, 0x00,
-    0x7C, 0x01, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x70, 0x01, 0xC0, 0x3F, 0xF0, 0xAA, 0x80,
-    0x07, 0xF0, 0x1D, 0x1C, 0x34, 0x0D, 0x34, 0x0A, 0x34, 0x0A, 0x38, 0x0D, 0x1F, 0xFC, 0x07, 0xE0,
-    0x10, 0x04, 0x00, 0x0E, 0x01, 0xD0, 0x03, 0xF0, 0x3E, 0x00, 0x2F, 0x03, 0xE0, 0x01, 0xF4, 0x2F,
-    0x00, 0x1F, 0x03, 0xE0, 0x0F, 0xC2, 0xFC, 0x0F, 0xD2, 0xFC, 0x0F, 0xD2, 0xF8, 0x0B, 0xD0, 0xF8,
-    0x01, 0xD0, 0x38, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0D, 0x00, 0x03, 0x80, 0x00, 0x0B,
-    0x00, 0x00, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x02, 0xD0,
-    0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0xB0, 0x00, 0x01, 0xB9, 0x40, 0x78, 0x00,
-    0x02, 0xFF, 0xF4, 0x3C, 0x00, 0x40, 0xBF, 0xFD, 0x2D, 0x00, 0x34, 0x00, 0x00, 0x0F, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x2F, 0x80, 0x00, 0x07, 0xC0, 0x1D, 0xE0, 0x00, 0x03, 0xD0, 0x0E, 0x38,
-    0x00, 0x02, 0xE0, 0x0F, 0x0E, 0x00, 0x00, 0xF0, 0x0B, 0x83, 0xD0, 0x00, 0xF8, 0x03, 0xFF, 0xFE,
-    0x00, 0x7C, 0x00, 0x50, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0,
-    0x05, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x13, 0x80, 0x00, 0x01, 0x40, 0x00, 0x38, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
-    0x00, 0x38, 0x00, 0x02, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00,
-    0x00, 0x07, 0x80, 0x02, 0xD0, 0x00, 0x01, 0xB9, 0x40, 0x38, 0x05, 0x00, 0xBF, 0xFD, 0x0F, 0x1F,
-    0xFE, 0x0B, 0xFF, 0xD1, 0xE2, 0x80, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xC0,
-    0x01, 0xFE, 0x54, 0x00, 0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x2F, 0x00, 0x03, 0xFF, 0xFC, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x09, 0x00, 0x00, 0x06, 0x00, 0x02, 0xC0, 0x00,
-    0x16, 0x80, 0x00, 0x34, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x01, 0xD0, 0x00,
-    0x00, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x0B, 0x00, 0x00, 0x10, 0x1F, 0x01, 0xE0, 0x00,
-    0x07, 0xFF, 0xE0, 0x3C, 0x00, 0x40, 0xBF, 0xF8, 0x07, 0x80, 0x0D, 0x00, 0x54, 0x00, 0xF0, 0x03,
-    0xD0, 0x00, 0x00, 0x2D, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xC0, 0x1D, 0xE0, 0x00, 0x00, 0xF4, 0x03,
-    0x8E, 0x00, 0x00, 0x2E, 0x00, 0xF0, 0xE0, 0x00, 0x03, 0xC0, 0x2E, 0x0F, 0x40, 0x00, 0xB8, 0x03,
-    0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x14, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0x00, 0x05, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x18, 0x0F, 0xF4, 0x1B, 0xD0,
-    0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00,
-    0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03,
-    0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00,
-    0x1D, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0,
-    0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00,
-    0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x34, 0x00, 0x00, 0x0F, 0x38, 0x34, 0x00, 0x00, 0x0D, 0x0E, 0xB0, 0x00,
-    0x00, 0x0D, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3,
-    0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0,
-    0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0x40,
-    0xBC, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0xC1, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07,
-    0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F,
-    0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x40, 0x00, 0x00, 0x01, 0xC1, 0x80, 0x00, 0x00, 0x00, 0xEB,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F,
-    0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00,
-    0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xEA, 0xA4,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF9,
-    0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xEA,
-    0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x79,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x05, 0xB8, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0xAA, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD5, 0x55, 0x50, 0x3F, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0xAA,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xD5, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1E, 0x2E, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFA, 0xA8, 0x0B, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55,
-    0x55, 0x40, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x07, 0xF0,
-    0x07, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFA, 0xA8, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x10, 0x00,
-    0x3E, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFE,
-    0x00, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x03, 0x81, 0xD0, 0xF0, 0x78, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7,
-    0xF9, 0xFF, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0xBA, 0xE0, 0x2D,
-    0x07, 0x86, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x01, 0xFF, 0x00, 0x1F, 0x40, 0xBD, 0x2F, 0x80, 0xFD, 0x3F, 0xC0, 0xFE, 0x3F, 0xC0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x6F, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x06, 0xAF, 0xEA, 0x80, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x40,
-    0x07, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x1F, 0x80,
-    0x00, 0x02, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFD, 0x55, 0x6F, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x34,
-    0x00, 0x00, 0x2D, 0xD0, 0xD0, 0x00, 0x00, 0xD1, 0xD3, 0x40, 0x00, 0x03, 0x42, 0xFC, 0x00, 0x00,
-    0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x02, 0xFD, 0x00,
-    0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xC0, 0xFF, 0xE0, 0x00, 0x7F,
-    0x03, 0xFF, 0xC0, 0x01, 0xFC, 0x0F, 0xFF, 0x80, 0x0B, 0xF0, 0x3F, 0x7F, 0x00, 0x2F, 0x81, 0xFC,
-    0xFE, 0x00, 0xBE, 0x07, 0xF1, 0xFC, 0x02, 0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xE0, 0xBF, 0x07, 0xF0,
-    0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xFD, 0x0B, 0xF0, 0x1F, 0xC3, 0xF4, 0x2F, 0xC0, 0x3F, 0x4F, 0xD0,
-    0xFF, 0x00, 0xBF, 0x7F, 0x43, 0xFD, 0x00, 0xFE, 0xFD, 0x0F, 0xF4, 0x02, 0xFF, 0xF0, 0x3F, 0xD0,
-    0x03, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0x00, 0x0B, 0x00,
-    0xB0, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00,
-    0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x2C, 0x00, 0x00,
-    0x07, 0x78, 0x28, 0x00, 0x00, 0x0B, 0x0E, 0x38, 0x00, 0x00, 0x0E, 0x07, 0xF4, 0x00, 0x00, 0x04,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07,
-    0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0,
-    0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7D, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0xBE, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F,
-    0xD0, 0x00, 0x02, 0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xB0, 0x03, 0xE3, 0xD0, 0x00, 0xFF, 0x80,
-    0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x95, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0xFD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xE2, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x3F, 0xC0, 0x00,
-    0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F,
-    0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F,
-    0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F,
-    0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F,
-    0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE,
-    0xAB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBA, 0xE0, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00,
-    0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD, 0x3F,
-    0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F,
-    0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0xFE,
-    0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00,
-    0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3,
-    0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07,
-    0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0xBF, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03,
-    0xF8, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFE, 0x00,
-    0xBD, 0x7F, 0xD0, 0xBC, 0x07, 0xF4, 0xBC, 0x00, 0xFC, 0xBC, 0x00, 0x3D, 0xBC, 0x00, 0x1E, 0xBC,
-    0x00, 0x3D, 0xBC, 0x00, 0xFC, 0xBC, 0x0B, 0xF4, 0xBE, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xBF, 0x90,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3D, 0x02, 0xD0, 0x03, 0xD0, 0x02, 0xC0, 0x0F, 0x00, 0x03, 0x40,
-    0x3C, 0x00, 0x6D, 0x01, 0xF0, 0x0B, 0x90, 0x07, 0xC0, 0x74, 0x00, 0x1F, 0x02, 0xC0, 0x00, 0x7C,
-    0x0F, 0x00, 0x02, 0xF0, 0x2E, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x00, 0x7F, 0x40, 0xBC, 0x00,
-    0x3F, 0x42, 0xF0, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7C, 0x3F, 0x10, 0x02, 0xF0, 0xFD, 0xBF, 0xFF,
-    0x83, 0xF6, 0xFF, 0xFC, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD7,
-    0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0,
-    0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E,
-    0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B,
-    0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xBD, 0x00,
-    0x03, 0xC0, 0xB4, 0x00, 0xA0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF,
-    0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3,
-    0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0xC0, 0x03, 0x8D, 0x0C, 0x00, 0x70, 0x7B, 0xC0, 0x07, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x87, 0x00, 0x2F, 0xFF, 0xB4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E,
-    0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B,
-    0xF8, 0x3E, 0x0B, 0xC0, 0x3F, 0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x01, 0xFE, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5,
-    0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3,
-    0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x1A, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00,
-    0xA0, 0x90, 0x00, 0x0A, 0x0D, 0x00, 0x00, 0x7A, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x97, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4,
-    0x01, 0xF8, 0x2E, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC,
-    0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xF7, 0xD0, 0x1B, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x6F, 0xD7, 0x0F, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xBE, 0x41, 0xF0, 0x0B, 0xE5, 0xBF, 0xF4, 0x00, 0x34, 0x0F, 0x40, 0x1F,
-    0xE0, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0xE6, 0xAF, 0xFD, 0x3C, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x3C,
-    0x00, 0x0B, 0xE5, 0x50, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x95, 0x6C, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0x83, 0xE2, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0xBF, 0xF9, 0x00, 0x08, 0x00, 0x00,
-    0x1E, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0xB0, 0x00, 0x2F, 0xC0, 0x00, 0x15, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF,
-    0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x0B, 0x40, 0x03, 0x80, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F,
-    0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xF4, 0x07, 0xF0, 0x2F, 0x80, 0xBF, 0x03, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1,
-    0xE0, 0x00, 0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xD0, 0x14, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01,
-    0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xC0, 0x3C, 0x0B, 0x80, 0xF0, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01,
-    0xE0, 0x2E, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFB, 0xC0, 0x0E, 0x02, 0xC0, 0x90, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
-    0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x2F,
-    0x80, 0xBD, 0x3F, 0xC0, 0xFE, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1E, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0A, 0xAF, 0xAA, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xAF, 0x80, 0xF0, 0x00, 0x1F, 0xFF, 0xD3, 0xC0, 0x00, 0xFD, 0x07, 0xDE, 0x00, 0x0B,
-    0xC0, 0x03, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x1F, 0xE5, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x03, 0x40, 0x0F, 0x78,
-    0x34, 0x00, 0xD1, 0xEB, 0x00, 0x1D, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE1, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0x47, 0xF0, 0x1F, 0xC0, 0x0F,
-    0x82, 0xF4, 0x00, 0xB8, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC3, 0xF4,
-    0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD,
-    0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00,
-    0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3,
-    0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07,
-    0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0,
-    0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1E,
-    0x07, 0x80, 0x07, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00,
-    0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3,
-    0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xA0, 0x02, 0xCB, 0x0A, 0x00,
-    0x38, 0x3E, 0xD0, 0x03, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F,
-    0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02,
-    0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0xBE, 0x02, 0xF4, 0x0B, 0xF0, 0x3F,
-    0x80, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4,
-    0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00,
-    0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0B, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xEA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x6F, 0xF4, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE6, 0xFF, 0x81,
-    0xF0, 0x3D, 0x7C, 0x3E, 0x03, 0xC3, 0xD3, 0xD0, 0x7C, 0x2E, 0x3D, 0x0B, 0x82, 0xF3, 0xD0, 0xF4,
-    0x2F, 0x3E, 0x1F, 0x03, 0xE3, 0xF6, 0xE0, 0xBD, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8,
-    0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0xF8, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC,
-    0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x03, 0x80, 0xF0, 0x00, 0xD0, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D,
-    0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F,
-    0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x0F, 0xC0, 0x3E,
-    0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8,
-    0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00,
-    0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC1, 0xF0,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x3F, 0xFE, 0x00, 0x3D,
-    0x2F, 0xC0, 0x3D, 0x03, 0xF0, 0x3D, 0x00, 0xF4, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00,
-    0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0xB8, 0x3D, 0x01, 0xF0, 0x3D, 0x07, 0xD0, 0x2E, 0x6F, 0x80,
-    0x2F, 0xFD, 0x00, 0x2F, 0x90, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x7F, 0x00,
-    0x7F, 0x02, 0xFC, 0x02, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC1, 0xF0, 0x00,
-    0x2F, 0x03, 0xE0, 0x00, 0xF8, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x3F, 0x07, 0xE0, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00,
-    0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xEA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B,
-    0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C,
-    0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x2D, 0x40, 0x2C, 0x00, 0x00, 0x1C, 0x00,
-    0x2C, 0x00, 0x00, 0x0E, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E,
-    0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x01, 0xFD, 0x0E, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xE0, 0x07, 0xD5, 0xBC, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xD7, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xE5, 0xBF, 0x40, 0xF4, 0x01, 0xF8, 0x2E, 0x00, 0x0F,
-    0x83, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0,
-    0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xD0, 0x1B, 0xF8, 0x3E,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B,
-    0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF,
-    0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3,
-    0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x02, 0xE9, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0x28, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x80, 0x03,
-    0xD1, 0xE0, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF,
-    0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xA6, 0xBC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x24, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x07, 0x40, 0x74, 0x01, 0xF2, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x2F,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x03, 0x80, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x1B, 0xFD, 0x00,
-    0x7E, 0x00, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x1F, 0xD0, 0x7E,
-    0x00, 0x00, 0x0F, 0xE0, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00,
-    0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x7E, 0x00, 0x00,
-    0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0x55, 0x5B, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00,
-    0x01, 0xF0, 0x7C, 0x00, 0x0A, 0x41, 0xF0, 0x7C, 0x00, 0xBF, 0xF5, 0xF0, 0x14, 0x03, 0xFF, 0xFE,
-    0xF0, 0x00, 0x0B, 0xD0, 0x7F, 0xF0, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0x2E, 0x00, 0x0B, 0xF0,
-    0x00, 0x3D, 0x00, 0x0B, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0x3D, 0x00, 0x0B, 0xE0, 0x00,
-    0x3E, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x90, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x6F, 0xE1, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x6F, 0xF4, 0x00,
-    0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x2F,
-    0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x06, 0xAF, 0xEA, 0x80,
-    0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xD0, 0x07, 0xE0,
-    0x00, 0x00, 0x7F, 0x40, 0x1F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xF0, 0x01,
-    0xFD, 0x55, 0x6F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xAB, 0xEA, 0x80, 0x00,
-    0xA4, 0x1F, 0x00, 0x00, 0x2F, 0xFD, 0x7C, 0x00, 0x03, 0xFF, 0xFE, 0xF0, 0x00, 0x2F, 0x41, 0xFF,
-    0xC0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0B, 0x80, 0x02, 0xFC, 0x00, 0x3D, 0x00, 0x0B, 0xE0, 0x00,
-    0xF4, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x90,
-    0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xBC,
-    0x00, 0x00, 0x6F, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0xAA,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xD5, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00,
-    0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x03, 0x80, 0x03, 0x80, 0x0F, 0x00, 0x0D, 0x00, 0x1F, 0x56, 0xF0,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x74, 0x00, 0x74, 0x03, 0xD0, 0x1F,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F, 0xAF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00,
-    0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x03, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xE0, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x03, 0xF4, 0x1F, 0x00, 0xB8, 0x00, 0x38, 0x1F, 0x00,
-    0x02, 0xC2, 0xE6, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xE3, 0xE5, 0x50, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x2C, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xAA, 0x80, 0xBC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x55, 0x54, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x2D, 0x01, 0xD0, 0x00, 0xB8, 0xB4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0,
-    0x0F, 0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0,
-    0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x07,
-    0x80, 0x78, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01,
-    0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40,
-    0x00, 0x6F, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00,
-    0x02, 0xF0, 0x1F, 0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x1E, 0x07, 0x80, 0x07, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3D, 0x03, 0xFF, 0xE7, 0xC0, 0xFE, 0xBF, 0xFC, 0x1F, 0x00,
-    0xBF, 0xC3, 0xD0, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3,
-    0xC0, 0x02, 0xFC, 0x3E, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x00, 0xBF, 0x4F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xD0, 0x1F, 0xF0, 0x0F,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x40, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01, 0x80, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x6F, 0xFE,
-    0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xF0, 0x1F,
-    0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0x00, 0x07, 0x00, 0x74, 0x00, 0xB0, 0x03,
-    0xE5, 0x6E, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3D, 0x03, 0xFF, 0xE7, 0xC0, 0xFE,
-    0xBF, 0xFC, 0x1F, 0x00, 0xBF, 0xC3, 0xD0, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC,
-    0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x02, 0xFC, 0x3E, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0xBF, 0x4F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0xD0, 0x1F, 0xF0, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01, 0x80, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x6F, 0xFE, 0x3F,
-    0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xF0, 0x1F, 0xFF,
-    0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xD0, 0x3F, 0xFE, 0x7C, 0x0F, 0xEB, 0xFF, 0xC1, 0xF0, 0x0B,
-    0xFC, 0x3D, 0x00, 0x3F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C,
-    0x00, 0x2F, 0xC3, 0xE0, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0x80, 0x0B, 0xF4, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF4, 0x0D, 0x01, 0xFF, 0x00, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x40, 0x01,
-    0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xA5, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xFE, 0x3F, 0x40,
-    0x00, 0x6F, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFA, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x2F, 0xF4, 0x00,
-    0x02, 0xF0, 0x1F, 0xFF, 0xAA, 0xAF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x3D, 0x03, 0xFF, 0xE7, 0xC0, 0xFE, 0xBF, 0xFC, 0x1F, 0x00, 0xBF, 0xC3,
-    0xD0, 0x03, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x1F, 0xC3, 0xC0, 0x02,
-    0xFC, 0x3E, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00,
-    0xBF, 0x4F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xD0, 0x1F, 0xF0, 0x0F, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x1D,
-    0x02, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00,
-    0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x3F,
-    0x83, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFA, 0xAA, 0xAF, 0xFC, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xEF, 0x00, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x01, 0xF7, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x02, 0xF4, 0x00,
-    0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00,
-    0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0xBE, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x03, 0xF0,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xE5,
-    0x55, 0x57, 0xF8, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x0F, 0xFA, 0xAA, 0xAB, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6B, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x01, 0xF7, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0x01, 0xF8, 0x02, 0xFC, 0x00, 0x7C, 0x02, 0xF4, 0x00, 0x3C, 0x02, 0xF0,
-    0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0,
-    0x00, 0x3D, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0x01, 0xFC, 0x0E, 0x3C, 0xF0, 0xD3, 0x83, 0xED, 0x34, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x1C, 0x71, 0xE2, 0xCB, 0x07, 0xF8, 0x60, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01,
-    0xE0, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x04, 0x1B, 0xFF, 0xFD, 0x3F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F,
-    0x80, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F,
-    0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xD1,
-    0xFD, 0x2F, 0xD2, 0xFE, 0x2F, 0xE2, 0xFE, 0x0E, 0x03, 0x80, 0x30, 0x03, 0xE8, 0x0B, 0xC0, 0x00,
-    0x0B, 0xC0, 0xFD, 0x0F, 0xD1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x78, 0x07,
-    0x80, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0xB8, 0x0B, 0xC0, 0xBC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0,
-    0xFD, 0x0D, 0x03, 0x80, 0x30, 0x03, 0xE8, 0x0B, 0xC0, 0x00, 0x3F, 0x1F, 0xC7, 0xF2, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x47, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xE3, 0xF9, 0xFE, 0x7F, 0xDF, 0xF7,
-    0xFC, 0x0E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xB8, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F,
-    0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x01, 0xFC, 0x3F,
-    0x00, 0x02, 0xFC, 0x3F, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x02, 0xFC, 0x3F,
-    0x00, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F,
-    0x40, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF4, 0x3F, 0x80, 0x03, 0xF4, 0x7F, 0x80, 0x03, 0xF4, 0x7F,
-    0xC0, 0x03, 0xF4, 0x7F, 0xC0, 0x03, 0xF4, 0x7F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x09, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00,
-    0x3F, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x90, 0x78, 0x00,
-    0x00, 0x0B, 0xC1, 0xE0, 0x00, 0x00, 0x2E, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x1E, 0x00, 0x00, 0x02,
-    0xE0, 0x78, 0x00, 0x00, 0x0B, 0x81, 0xE0, 0x00, 0x00, 0x2D, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x2F,
-    0x00, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00,
-    0x00, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xD2, 0xD0, 0x0F, 0x00, 0x74, 0x04, 0x07, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x10, 0xBF,
-    0xC0, 0x3F, 0xFF, 0x40, 0x3F, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xE0, 0xF0, 0x02, 0xC0, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x02, 0xF4, 0x07, 0xF0,
-    0x00, 0xBD, 0x03, 0xF8, 0x00, 0x2F, 0x42, 0xFC, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0xFF,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF, 0x40, 0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0x83, 0xFF, 0x40,
-    0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4, 0x0B, 0xFF, 0x40, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0x40, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF0, 0x3E, 0x00, 0x2F, 0x0F, 0xC0, 0x02, 0xF3, 0xF0, 0x00, 0x2F, 0xBD, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF3, 0xFC, 0x00,
-    0x3F, 0x1F, 0xF0, 0x03, 0xF0, 0xBF, 0xC0, 0x3F, 0x02, 0xFF, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x01, 0x40, 0x0F, 0x07, 0xC0, 0x0F, 0x0F, 0x40, 0x0F, 0x2E,
-    0x00, 0x0E, 0x3C, 0x00, 0x1E, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xE0, 0x00,
-    0x2F, 0xF8, 0x00, 0x2D, 0xBE, 0x00, 0x3D, 0x3F, 0x80, 0x3D, 0x0F, 0xE0, 0x3D, 0x07, 0xF8, 0x02,
-    0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0xF0, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xF8,
-    0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xD0,
-    0x1F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xFF, 0x1F, 0xFD, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4,
-    0x03, 0xD0, 0x0F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xD0, 0x1F, 0x40, 0x7D, 0x01, 0xF4, 0x07, 0xFF,
-    0x1F, 0xFD, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC1, 0xFD, 0x07, 0xF0,
-    0x2F, 0xC0, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x50, 0x2F, 0x80, 0x0F, 0x02,
-    0xF8, 0x00, 0xF0, 0x2F, 0x40, 0x0F, 0x02, 0xF4, 0x01, 0xF0, 0x2F, 0x40, 0x1F, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x40, 0x00, 0x2D, 0x1F, 0x02, 0xD1, 0xF0, 0x3D, 0x2F, 0x03,
-    0xD2, 0xF0, 0x3C, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03,
-    0xD0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0,
-    0x00, 0x7D, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x01, 0xF8,
-    0x2F, 0x80, 0x2F, 0x82, 0xF8, 0x02, 0xFC, 0x2F, 0x40, 0x3F, 0xC2, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x3F, 0x0F, 0x80, 0xFC, 0x3D, 0x07,
-    0xF0, 0xF4, 0x2F, 0xD3, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFD, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x3D, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x01, 0x00, 0x03, 0xF3, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xD3, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x19, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xF8, 0x7D, 0x00, 0x2F, 0xD0, 0x7D, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1A, 0x80, 0x00,
-    0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x0F, 0xFD, 0x00, 0x07, 0xF0,
-    0x3F, 0xFC, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF,
-    0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xFE, 0x07, 0xF0, 0xFE, 0x03,
-    0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF8, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0F,
-    0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x1F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00,
-    0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC,
-    0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC,
-    0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40,
-    0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xC0, 0xBF,
-    0x40, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0xF8, 0x00,
-    0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0, 0x0B, 0xE0,
-    0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8, 0x2F, 0xC1,
-    0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0, 0x0F, 0xD3,
-    0xF4, 0x3F, 0xC0, 0x2F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF, 0xFC, 0x0F,
-    0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00,
-    0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3,
-    0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x01, 0xD0, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFE,
-    0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00,
-    0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF, 0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81,
-    0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03, 0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03,
-    0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B, 0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F, 0xDF,
-    0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00, 0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F,
-    0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x01, 0x40, 0x01, 0x40, 0x0E, 0x00, 0xB0,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00,
-    0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F,
-    0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1B, 0xE4, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xF4,
-    0x2F, 0x01, 0xFC, 0x00, 0xF8, 0x1F, 0x80, 0x0B, 0xC1, 0xF4, 0x00, 0xBC, 0x1F, 0x40, 0x0B, 0xC2,
-    0xF4, 0x00, 0xBD, 0x2F, 0x40, 0x0B, 0xD2, 0xF4, 0x00, 0xBD, 0x3F, 0x80, 0x0B, 0xD3, 0xF8, 0x00,
-    0xBE, 0x3F, 0x80, 0x0B, 0xE3, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x0F, 0xC0, 0xBF, 0x40, 0x00, 0x3F, 0x03, 0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xF0,
-    0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x02, 0xFC, 0x0F, 0xDF,
-    0xC0, 0x0B, 0xE0, 0x7F, 0x3F, 0x80, 0x2F, 0x81, 0xFC, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0xFE, 0x03,
-    0xF8, 0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0xBF, 0x03, 0xF4, 0x3F, 0x42, 0xFC, 0x07, 0xF0, 0xFD, 0x0B,
-    0xF0, 0x0F, 0xD3, 0xF4, 0x3F, 0xC0, 0x2F, 0xDF, 0xD0, 0xFF, 0x40, 0x3F, 0xBF, 0x43, 0xFD, 0x00,
-    0xBF, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x0E, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC,
-    0x00, 0xF8, 0x2F, 0x40, 0x0B, 0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC,
-    0x3F, 0x40, 0x0F, 0xC3, 0xF4, 0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40,
-    0x0F, 0xD3, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD,
-    0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03,
-    0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF,
-    0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1D, 0x00,
-    0x1D, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x95, 0xB8, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F, 0xC0,
-    0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02, 0xFD,
-    0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x50, 0x07, 0x00, 0x70, 0x00, 0xB0, 0x03, 0xC0, 0x1E, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1, 0xFF, 0xEF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x1A,
-    0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x7F, 0xF4, 0x00,
-    0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0xFC,
-    0x00, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x41, 0xFF,
-    0xE5, 0x56, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x2F, 0x00,
-    0x02, 0xF4, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x14, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xF9, 0x1B,
-    0xD0, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x3E, 0x00,
-    0x0F, 0x40, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF4,
-    0x00, 0xBD, 0x00, 0x07, 0xFF, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE1, 0xAA, 0xAB, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xF9, 0x5F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xF0, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x55,
-    0x54, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1B, 0xF9, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xE2, 0xF4,
-    0x0B, 0x40, 0x3F, 0x91, 0xBF, 0xF0, 0x00, 0xB0, 0x1F, 0x00, 0x07, 0xF0, 0x00, 0x1E, 0x0F, 0x80,
-    0x00, 0xFD, 0x6B, 0xFF, 0xC3, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x0B, 0xD5, 0x40,
-    0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xFF, 0x95, 0x78, 0x0F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03,
-    0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x3F, 0x80, 0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07,
-    0xF4, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07,
-    0xFD, 0x00, 0x3C, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0xAD, 0x0F, 0xBF, 0xD0, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80,
-    0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0,
-    0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xC2,
-    0xB4, 0x0F, 0xBF, 0xD0, 0x3F, 0xFF, 0x80, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0A,
-    0x00, 0x00, 0xF4, 0x78, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x03,
-    0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xAA, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x3F, 0x80, 0x0B, 0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x07,
-    0xF4, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x3F, 0xC0, 0x07,
-    0xFD, 0x34, 0x00, 0xA0, 0x38, 0x1E, 0x00, 0x3E, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAD, 0x03, 0xEF, 0xF4, 0x0F, 0xFF, 0xE0, 0x3F, 0xC0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00,
-    0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x1F, 0xAA,
-    0xFD, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x00,
-    0x2D, 0x01, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0x83, 0xC0, 0x07, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x41, 0xFA, 0xAF,
-    0xD1, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00, 0x3F, 0xFD,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x3A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x16,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7E, 0xAB, 0xF4, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x90, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x47, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90,
-    0x04, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40,
-    0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x05, 0x00, 0xE0, 0x0B, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x1F,
-    0xAA, 0xFD, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x6F, 0xFE, 0x40, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x05, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x1A, 0xFE, 0xA4, 0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01,
-    0xF4, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD, 0x50, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFC, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x0B, 0xF0, 0x00, 0x05, 0x40,
-    0x00, 0x34, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x1F, 0x00, 0x2C, 0x1F, 0x00, 0xBC, 0x2E, 0x00, 0xFC, 0x04, 0x00, 0xFC, 0x00, 0x1A,
-    0xFE, 0xA4, 0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-    0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD, 0x50,
-    0x01, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x02, 0xAB, 0xFA, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xBF, 0xA9, 0x0F,
-    0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x2A, 0xBF, 0xA9, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x00, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x54, 0x00, 0x7F, 0xFE,
-    0x00, 0xBF, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0D, 0x00, 0x00,
-    0x38, 0xB0, 0xD0, 0x00, 0x03, 0x43, 0xFC, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x15, 0x53, 0xFC,
-    0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00,
-    0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xC0, 0x07, 0x1E, 0x2C, 0x00, 0xB0, 0x7F, 0x40,
-    0x06, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFD,
-    0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00,
-    0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00,
-    0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA, 0xBF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x2F, 0xFF, 0xEA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC,
-    0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0xB0, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x00, 0x3E, 0x57, 0xD0, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x54, 0x3F, 0xC0, 0x00,
-    0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFD, 0x3F,
-    0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x2F,
-    0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x0D, 0x00, 0xE0, 0x01, 0xD0, 0x0B, 0x95, 0xBC, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x00,
-    0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F,
-    0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBC, 0x03, 0xFF, 0xDB,
-    0xC0, 0x01, 0x50, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x30, 0x90, 0x00, 0x00, 0x07, 0x06,
-    0x00, 0x00, 0x00, 0x3A, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x54, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8,
-    0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x01, 0xFC,
-    0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0xAB, 0xFF, 0x81, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0xD0, 0xC0, 0x00, 0x0B,
-    0xAC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF8, 0x3D, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0xFC, 0x2F, 0x40, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xBC, 0x03, 0xFF, 0xDB, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x54, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x04, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x05, 0x40, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x2F, 0xE0, 0x3F,
-    0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFE, 0xAB, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x2F, 0x40, 0x01,
-    0xF4, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x40,
-    0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xFC,
-    0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0xFF, 0xF6, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x05, 0x43, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x00, 0x2F, 0xE3, 0xF8,
-    0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F,
-    0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x01, 0xFC,
-    0x3F, 0x80, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0xEA,
-    0xBF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x3D, 0x00, 0x0F, 0x83, 0xD0,
-    0x00, 0xF8, 0x3D, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC,
-    0x3E, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF4, 0x03, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFB, 0xC0, 0x3F, 0xFD, 0xBC, 0x00, 0x15, 0x2D, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0xBF, 0x00, 0x1F, 0xE0, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x07,
-    0xFF, 0x80, 0x3F, 0x40, 0x0F, 0xE0, 0x3F, 0xFF, 0x01, 0xFC, 0x00, 0x2F, 0xC2, 0xFE, 0xFE, 0x0B,
-    0xF0, 0x00, 0xBF, 0x0F, 0xF2, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0xBF, 0x83, 0xF8, 0xFD, 0x00, 0x03,
-    0xFB, 0xFD, 0x0F, 0xF7, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x40,
-    0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0x42,
-    0xC0, 0x00, 0x00, 0x28, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x3C, 0x03, 0xF0, 0x0F,
-    0xC0, 0xBE, 0x03, 0xF0, 0x0B, 0xD1, 0xFF, 0x47, 0xE0, 0x07, 0xE3, 0xFF, 0xCB, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xEB, 0xFF, 0x80, 0x01, 0xFF, 0xC3,
-    0xFF, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBA, 0xE0, 0x00, 0x00, 0x2D,
-    0x07, 0x80, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x02, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFC, 0x00,
-    0x0F, 0xD0, 0x3F, 0x80, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F,
-    0x7D, 0x00, 0x01, 0xE0, 0x2D, 0x00, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xBC,
-    0x0F, 0x80, 0x03, 0xE0, 0x1F, 0x40, 0x1F, 0x40, 0x3F, 0x00, 0xBC, 0x00, 0x7D, 0x03, 0xF0, 0x00,
-    0xFC, 0x1F, 0x80, 0x01, 0xF8, 0xBD, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F,
-    0x40, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x80,
-    0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA, 0xAF, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0xAA,
-    0xAF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x01, 0x55, 0x5F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x1D, 0x00, 0xF0, 0x00, 0x00, 0x07,
-    0x87, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x6A, 0xAA, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0x40, 0x06, 0x00, 0x0E, 0x02,
-    0xC0, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xD0, 0x15, 0x55, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xBE, 0x00, 0xFF, 0xC0,
-    0xBC, 0x10, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x68,
-    0x07, 0x43, 0xC1, 0xF0, 0xB4, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00, 0x2E, 0xF4, 0x02,
-    0xD0, 0x74, 0x18, 0x00, 0x34, 0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC2, 0xFA, 0xAA, 0xAA, 0x50, 0x38, 0x00, 0x38, 0xF0, 0x00,
-    0xE1, 0xF5, 0x6F, 0x02, 0xFF, 0xF4, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43, 0xFC, 0x2F,
-    0x81, 0x0E, 0x00, 0xD0, 0x34, 0x01, 0x00, 0x1F, 0x83, 0x0A, 0x70, 0x63, 0xAD, 0x1F, 0x80, 0x00,
-    0x7D, 0x00, 0x03, 0xE0, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x0A, 0x40, 0x00,
-    0xA9, 0x00, 0x18, 0x00, 0x34, 0x2D, 0x07, 0x80, 0x2E, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00,
-    0x7D, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x1A,
-    0x00, 0x01, 0xA4, 0x55, 0x0B, 0xF4, 0x7F, 0x83, 0xF8, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x00, 0x1F,
-    0xF1, 0xFE, 0x2F, 0xD2, 0xFC, 0x3F, 0x83, 0xF4, 0xBF, 0x00, 0xFF, 0x4B, 0xF4, 0x7F, 0x83, 0xF8,
-    0x2F, 0xC1, 0xFC, 0x0F, 0xE0, 0x02, 0x80, 0xA3, 0xF8, 0x5E, 0x02, 0x80, 0x00, 0x34, 0x0D, 0x03,
-    0xF8, 0xE4, 0x34, 0x00, 0x00, 0x3F, 0xA9, 0x50, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x07, 0x07, 0x0A, 0x2C, 0x34, 0x00, 0x0C, 0x30, 0x30, 0x1C,
-    0x00, 0x02, 0x00, 0x0C, 0x01, 0x79, 0x0F, 0xFC, 0x3F, 0xF0, 0x6E, 0x40, 0x30, 0x00, 0x80, 0x02,
-    0x00, 0x30, 0x2B, 0x90, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xFE,
-    0xA0, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC7, 0xF2, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0xF8, 0x3F, 0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43, 0xFC, 0x1F, 0x83, 0x0A, 0x70, 0x63, 0xAD,
-    0x1F, 0x80, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B, 0xF0, 0x08, 0x02,
-    0x40, 0x3A, 0x40, 0x0C, 0x00, 0x91, 0x6C, 0x3F, 0x40, 0x00, 0x00, 0x34, 0x0D, 0x02, 0x80, 0x38,
-    0x02, 0xFD, 0x01, 0x90, 0x19, 0x2D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3F, 0xFF, 0x0F, 0x57, 0xC3,
-    0x80, 0xB0, 0xE0, 0x2C, 0x18, 0x00, 0x34, 0x2D, 0x07, 0x80, 0x2E, 0xF8, 0x00, 0x2F, 0x80, 0x00,
-    0x3C, 0x00, 0x00, 0x34, 0x00, 0x03, 0xF0, 0x00, 0x2E, 0xF0, 0x02, 0xD0, 0xF0, 0x38, 0x00, 0xB0,
-    0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00, 0x00, 0x55, 0x82,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xF0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10, 0x05, 0x00, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x34, 0x0C, 0x0C, 0x38, 0x10, 0x38, 0x0B, 0x0E, 0x02, 0xC3, 0xD5,
-    0xF0, 0xFF, 0xFC, 0x3F, 0xFE, 0x34, 0x0A, 0x30, 0x0A, 0x30, 0x0A, 0x30, 0x0A, 0x3F, 0xFE, 0x00,
-    0x00, 0x1E, 0x44, 0x09, 0x24, 0x83, 0x08, 0x30, 0xC2, 0x0C, 0x20, 0x43, 0x00, 0x18, 0x90, 0xE8,
-    0x07, 0x00, 0xEC, 0x34, 0xD0, 0x1F, 0x40, 0xC3, 0xAC, 0x0C, 0x70, 0xB1, 0xC7, 0x03, 0xF8, 0x10,
-    0x05, 0x00, 0x10, 0x3C, 0x0A, 0x1D, 0x10, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x3F,
-    0x01, 0xFC, 0x7F, 0x02, 0xFC, 0xBF, 0x43, 0xFC, 0x15, 0x55, 0x0F, 0xFF, 0xC3, 0x80, 0xB0, 0xE0,
-    0x2C, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xE0, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x02, 0xE2, 0xD0, 0x2E, 0x3D, 0x02, 0xE3, 0xD0, 0x3E, 0x3D, 0x03, 0xE3, 0xD0,
-    0x3E, 0x29, 0x02, 0x90, 0x00, 0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x01, 0xF5,
-    0x8C, 0x3A, 0xF4, 0xC7, 0x0B, 0x5C, 0x70, 0x7F, 0x80, 0x0A, 0x50, 0x00, 0xD0, 0x00, 0x0C, 0x00,
-    0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x54, 0x3F, 0x2F, 0xD6, 0xF8, 0x00,
-    0x3F, 0x7F, 0x00, 0x3F, 0x80, 0xBD, 0xBF, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x15, 0x40,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xF5, 0xF0, 0x0B, 0x4B, 0x81, 0xF0, 0x3C, 0x3D, 0x01,
-    0xFA, 0xF0, 0xA0, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x74, 0xBC, 0x3E, 0x02, 0xD3, 0xD0, 0x2F, 0x6F, 0x0A, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xC3, 0x00, 0x00, 0x41, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x08, 0x1D, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0xE0, 0x00, 0x00, 0x01, 0xD0, 0x07, 0x90, 0x00, 0x1B, 0x80, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xB9, 0x00, 0x01, 0xBC, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xD0,
-    0x90, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0x80, 0x02, 0x40, 0x18, 0x01, 0xE0, 0x0F, 0x40, 0x7C, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xAA, 0x80,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xE6, 0xB9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00,
-    0x2D, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x05, 0xFC,
-    0x00, 0x07, 0xD0, 0x0F, 0xF8, 0x00, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0x03, 0xE0, 0x2F, 0x40, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0x54, 0x3D, 0x00, 0x00, 0x00, 0x07,
-    0xEA, 0xAA, 0x90, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x3F,
-    0xFF, 0xAF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x90, 0x04, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0x40, 0x00, 0x3F, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4,
-    0xFD, 0x3F, 0x8F, 0xE7, 0xF9, 0xFF, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x3F,
-    0x00, 0xFC, 0x3F, 0x41, 0xFC, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0xBF, 0x01, 0x0B, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0xE0, 0x00, 0x3F, 0xAB, 0xFC, 0x00, 0x38, 0x00, 0x0F, 0x40,
-    0x0F, 0x80, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x07, 0x80, 0x00, 0xF4, 0x00, 0x2D, 0x01, 0xD0,
-    0x00, 0x3D, 0x00, 0x0B, 0x40, 0xB4, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x2D, 0x00, 0x03, 0xE0, 0x1B,
-    0xF0, 0x0F, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x0F, 0xE0, 0x00,
-    0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFA, 0xAF, 0xE0, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0xF4,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x3D, 0x3C, 0x00,
-    0x00, 0xF4, 0x00, 0x7D, 0x3C, 0x00, 0x00, 0xF4, 0x16, 0xFC, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3C, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x50, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x19, 0x40, 0x00, 0x00, 0x3F, 0xBF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x02, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x3E,
-    0x00, 0x00, 0x7F, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xC0, 0x01, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7C,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0xBF, 0x40, 0x07, 0xC0, 0x00, 0x2F, 0xD0, 0x02, 0xF0,
-    0x00, 0x0B, 0xF4, 0x00, 0xBC, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0xD0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x2F,
-    0x42, 0xFC, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00,
-    0x3F, 0x3F, 0x80, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF,
-    0x40, 0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4,
-    0x0B, 0xFF, 0x40, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x05, 0x40, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0xFC, 0x00, 0x03, 0xFE, 0x03, 0xF0, 0x00, 0x1F, 0xFC,
-    0x0F, 0xC0, 0x00, 0xFF, 0xF0, 0x3F, 0x40, 0x07, 0xFF, 0xC0, 0xFD, 0x00, 0x2F, 0xFF, 0x03, 0xF4,
-    0x00, 0xFD, 0xFC, 0x0F, 0xE0, 0x0B, 0xE3, 0xF0, 0x3F, 0x80, 0x3F, 0x4F, 0xC0, 0xBE, 0x02, 0xFC,
-    0x7F, 0x42, 0xFC, 0x0F, 0xD1, 0xFD, 0x0B, 0xF0, 0xBF, 0x07, 0xF4, 0x2F, 0xC3, 0xF4, 0x1F, 0xE0,
-    0x7F, 0x2F, 0xC0, 0x7F, 0x81, 0xFC, 0xFD, 0x01, 0xFE, 0x07, 0xFB, 0xF0, 0x07, 0xFC, 0x1F, 0xFF,
-    0x40, 0x1F, 0xF0, 0x7F, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x07,
-    0xFC, 0x03, 0x80, 0x03, 0x80, 0x0B, 0x00, 0x0E, 0x00, 0x1F, 0x56, 0xF0, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x50, 0xF8, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3E, 0x03, 0xF0, 0x01, 0xF4, 0x07, 0xD0,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00,
-    0x3E, 0x3E, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x3E,
-    0x3E, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x8F, 0xD5, 0x55, 0x7E, 0x3F, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x81, 0xF4,
-    0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE5,
-    0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00,
-    0x01, 0xFD, 0x3F, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xA8, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xEA,
-    0xFE, 0x02, 0xF0, 0x00, 0xF4, 0x2F, 0x00, 0x03, 0xC2, 0xF0, 0x00, 0x3C, 0x1F, 0x40, 0x03, 0xD1,
-    0xF4, 0x00, 0xBC, 0x1F, 0xAA, 0xBF, 0xC1, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFE,
-    0x40, 0x3F, 0xFF, 0xE0, 0x00, 0xFE, 0xAB, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xD0,
-    0x3D, 0x00, 0x07, 0x80, 0xF4, 0x00, 0x2D, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0xF4, 0x00, 0x7F, 0x03, 0xD0, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00,
-    0x03, 0xF0, 0xF4, 0x00, 0x1F, 0xC3, 0xFA, 0xAB, 0xFF, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD2,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x03,
-    0xD0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x3C,
-    0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x2F, 0xFA, 0xAA, 0xBF, 0xA2, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0xF8, 0x00,
-    0x00, 0x7C, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x54, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0x01, 0xFD, 0x00, 0xFD, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x07, 0xF0,
-    0x3F, 0x42, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xCF, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xCF, 0xFE,
-    0x7F, 0xF4, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0xBF, 0xF4, 0x03, 0xFF, 0xD0, 0xFF, 0xE0, 0xFF, 0xF4,
-    0x2F, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xF4, 0x06, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x01, 0x95, 0x1B,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x01,
-    0xFC, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF1, 0x00, 0x01, 0xFC, 0xF9, 0x56, 0xFE, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x54, 0x03, 0xF0,
-    0x00, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x01, 0xFF, 0xC0, 0xFC, 0x00, 0x0F,
-    0xFF, 0x03, 0xF4, 0x00, 0x7F, 0xFC, 0x0F, 0xD0, 0x02, 0xFF, 0xF0, 0x3F, 0x40, 0x0F, 0xDF, 0xC0,
-    0xFE, 0x00, 0xBE, 0x3F, 0x03, 0xF8, 0x03, 0xF4, 0xFC, 0x0B, 0xE0, 0x2F, 0xC7, 0xF4, 0x2F, 0xC0,
-    0xFD, 0x1F, 0xD0, 0xBF, 0x0B, 0xF0, 0x7F, 0x42, 0xFC, 0x3F, 0x41, 0xFE, 0x07, 0xF2, 0xFC, 0x07,
-    0xF8, 0x1F, 0xCF, 0xD0, 0x1F, 0xE0, 0x7F, 0xBF, 0x00, 0x7F, 0xC1, 0xFF, 0xF4, 0x01, 0xFF, 0x07,
-    0xFF, 0xC0, 0x07, 0xFC, 0x0F, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xD4,
-    0x02, 0x80, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x54, 0x03, 0xF0, 0x00,
-    0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x01, 0xFF, 0xC0, 0xFC, 0x00, 0x0B, 0xFF,
-    0x03, 0xF4, 0x00, 0x3F, 0xFC, 0x0F, 0xD0, 0x02, 0xFF, 0xF0, 0x3F, 0x40, 0x0F, 0xDF, 0xC0, 0xFE,
-    0x00, 0xBE, 0x3F, 0x02, 0xF8, 0x03, 0xF0, 0xFC, 0x0B, 0xE0, 0x2F, 0xC7, 0xF4, 0x2F, 0xC0, 0xFD,
-    0x1F, 0xD0, 0xBF, 0x0B, 0xF0, 0x7F, 0x42, 0xFC, 0x3F, 0x41, 0xFE, 0x07, 0xF2, 0xFC, 0x07, 0xF8,
-    0x1F, 0xCF, 0xD0, 0x1F, 0xE0, 0x7F, 0xBF, 0x00, 0x7F, 0xC1, 0xFF, 0xF4, 0x01, 0xFF, 0x07, 0xFF,
-    0xC0, 0x07, 0xFC, 0x0F, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xE0, 0x0B,
-    0xF0, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x2F, 0x42, 0xFC, 0x00, 0x0F, 0xC0,
-    0xFD, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x0F,
-    0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF, 0x40, 0x00, 0xFE, 0x3F, 0xF4,
-    0x00, 0x3F, 0x83, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4, 0x0B, 0xFF, 0x40, 0xFD, 0x00,
-    0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0x00, 0x7E, 0x00, 0xBC, 0x01, 0xF8, 0x02, 0xF0, 0x07, 0xD0, 0x0B, 0xC0, 0x2F, 0x40,
-    0x3F, 0x00, 0xBD, 0x00, 0xFC, 0x02, 0xF0, 0x03, 0xF0, 0x0B, 0xC0, 0x0F, 0xC0, 0x2F, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0xFC, 0x0B, 0xE0, 0x03, 0xF0, 0xFF, 0x40, 0x0F, 0xC7, 0xF8, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC2, 0xFF, 0x00, 0x01, 0xFF,
-    0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x2E, 0xF8, 0x00, 0x7E, 0xF0, 0xBA, 0xF0, 0x02, 0xEB, 0xC3, 0xE3,
-    0xD0, 0x0F, 0x6F, 0x0F, 0xCF, 0xC0, 0xBC, 0xBC, 0x3F, 0x1F, 0x43, 0xE2, 0xF0, 0xFC, 0x3E, 0x2F,
-    0x4B, 0xC3, 0xF0, 0xFC, 0xFC, 0x2F, 0x0F, 0xC1, 0xFF, 0xE0, 0xFC, 0x3F, 0x03, 0xFF, 0x43, 0xF0,
-    0xFC, 0x0F, 0xFC, 0x0F, 0xC3, 0xF0, 0x1F, 0xE0, 0x3F, 0x0F, 0xC0, 0x3F, 0x40, 0xFC, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x03, 0xF0,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0xFD, 0x0F, 0xD0,
-    0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x00,
-    0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0xFF, 0x00,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x1F,
-    0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02,
-    0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xE0,
-    0x00, 0x2E, 0x3E, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x3E,
-    0x3F, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x3F, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xF5,
-    0x56, 0xFD, 0x0B, 0xC0, 0x00, 0xFC, 0x2F, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0x2F, 0x4F, 0xC0, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x80,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x04, 0x0F, 0xFF,
-    0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC1, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00,
-    0xF4, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x3F, 0x07, 0xD0,
-    0x00, 0xBE, 0x3F, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7E,
-    0x5F, 0xD5, 0xBD, 0x07, 0x80, 0x2F, 0x00, 0x3C, 0x2C, 0x00, 0xBC, 0x00, 0x74, 0xF0, 0x02, 0xF0,
-    0x01, 0xE3, 0xC0, 0x0B, 0xC0, 0x07, 0x8F, 0x40, 0x2F, 0x00, 0x3E, 0x2F, 0xD4, 0xFD, 0x17, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x02,
-    0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x2F,
-    0x80, 0xFD, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xE3, 0xFC, 0x00,
-    0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x07,
-    0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0xF0, 0x3E, 0x00, 0x03,
-    0xC0, 0xF8, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7C, 0x0F, 0x80, 0x01, 0xF0, 0x3E, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7C, 0x0F, 0x80, 0x01, 0xF0, 0x3E, 0x00, 0x0B, 0xC0, 0xF8,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xBC, 0x0F, 0x80, 0x02, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x01, 0x43, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3,
-    0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x07, 0xC3, 0xD0, 0x00,
-    0x7C, 0x3D, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0xFD, 0x2F, 0x80, 0x7F, 0xD0, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFB, 0xD0, 0x1B, 0xF8, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x06, 0x40,
-    0x7C, 0x3F, 0x00, 0xFC, 0x03, 0xC3, 0xF0, 0x0F, 0xC0, 0x3C, 0x3E, 0x00, 0xBC, 0x03, 0xC3, 0xE0,
-    0x0B, 0xC0, 0x3C, 0x3E, 0x00, 0xBC, 0x03, 0xC3, 0xE0, 0x0B, 0xC0, 0x3C, 0x3E, 0x00, 0xBC, 0x03,
-    0xC3, 0xE0, 0x0B, 0xC0, 0x3C, 0x3E, 0x00, 0xBC, 0x03, 0xC3, 0xE0, 0x0B, 0x80, 0x3C, 0x3E, 0x00,
-    0xB8, 0x03, 0xC3, 0xE0, 0x07, 0x80, 0x3C, 0x3E, 0x00, 0x78, 0x03, 0xC3, 0xE0, 0x07, 0x80, 0x3C,
-    0x3F, 0xAA, 0xFE, 0xAB, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x64, 0x07, 0xC0, 0x3E, 0x00, 0xFC, 0x03, 0xC0, 0x3E, 0x00, 0xFC,
-    0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03,
-    0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0,
-    0x3D, 0x00, 0xBC, 0x03, 0xC0, 0x3D, 0x00, 0xB8, 0x03, 0xC0, 0x3D, 0x00, 0x78, 0x03, 0xC0, 0x3D,
-    0x00, 0x78, 0x03, 0xC0, 0x3D, 0x00, 0x78, 0x03, 0xC0, 0x3D, 0x00, 0x78, 0x03, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0xAA, 0xB8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xAA, 0xFD, 0x00, 0x07, 0xC0, 0x07, 0xC0,
-    0x01, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x02,
-    0xF0, 0x01, 0xF0, 0x17, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0xFF, 0x80, 0x00, 0x07, 0xF1, 0xFA, 0xAF, 0xD0, 0x00, 0x1F, 0xC7, 0xC0, 0x07, 0xC0, 0x00,
-    0x7F, 0x1F, 0x00, 0x07, 0x80, 0x01, 0xFC, 0x7C, 0x00, 0x0F, 0x00, 0x07, 0xF1, 0xF0, 0x00, 0x3C,
-    0x00, 0x1F, 0xC7, 0xC0, 0x02, 0xF0, 0x00, 0xBF, 0x1F, 0x01, 0x7F, 0xC0, 0x02, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xF5, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xDB, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xAA, 0xFD,
-    0x07, 0xC0, 0x07, 0xC1, 0xF0, 0x00, 0x78, 0x7C, 0x00, 0x0F, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x02,
-    0xF1, 0xF0, 0x17, 0xFC, 0x7F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFE, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x50, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x6A,
-    0xAA, 0xBD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xFD, 0x00, 0x07, 0xFD, 0x2F, 0xFF, 0xAF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0x80, 0x1F,
-    0xFF, 0xF4, 0x03, 0xE0, 0x1F, 0x80, 0x2F, 0x40, 0xF8, 0x0F, 0x80, 0x02, 0xF0, 0x3E, 0x07, 0xC0,
-    0x00, 0x3D, 0x0F, 0x82, 0xE0, 0x00, 0x0F, 0x83, 0xE0, 0xF4, 0x00, 0x02, 0xF0, 0xF8, 0x3D, 0x00,
-    0x00, 0xBC, 0x3E, 0x0F, 0x00, 0x00, 0x1F, 0x0F, 0xEB, 0xC0, 0x00, 0x07, 0xC3, 0xFF, 0xF4, 0x00,
-    0x02, 0xF0, 0xF9, 0x7E, 0x00, 0x00, 0xFC, 0x3D, 0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0x43, 0xFD, 0x00,
-    0x7F, 0x43, 0xD0, 0xBF, 0xFF, 0xFF, 0xC0, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x3D, 0x00, 0xFF, 0xFF,
-    0xD0, 0x0F, 0x40, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xF4, 0x02, 0xF8, 0x00, 0xB4, 0x03, 0xE0, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0xB8, 0x07,
-    0xD0, 0x00, 0xB8, 0x03, 0xE0, 0x00, 0xB8, 0x03, 0xF8, 0x00, 0xB8, 0x02, 0xFF, 0xEA, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x02, 0xFC, 0x07,
-    0xF0, 0x01, 0xFC, 0x0B, 0xE0, 0x02, 0xFC, 0x0F, 0xE0, 0x02, 0xFC, 0x0F, 0xE0, 0x02, 0xFD, 0x1F,
-    0xE0, 0x02, 0xFD, 0x2F, 0xE0, 0x02, 0xFD, 0x3F, 0xE0, 0x03, 0xFD, 0x3F, 0xF0, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F,
-    0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D,
-    0x01, 0xBF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0x80, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x50, 0x00, 0x3D, 0x7F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x42, 0xFE, 0x0F, 0xF0, 0x01,
-    0xFC, 0x3F, 0x40, 0x03, 0xF4, 0xFC, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x3F, 0x47, 0xF0, 0x01, 0xFC,
-    0x0F, 0xF5, 0x6F, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x7F,
-    0xFE, 0x40, 0x7E, 0xAB, 0xE0, 0x78, 0x00, 0xB0, 0x78, 0x00, 0x74, 0x78, 0x00, 0xF0, 0x7F, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xD0, 0x78, 0x00, 0xBC, 0x78, 0x00, 0x3D, 0x78, 0x00, 0x2E, 0x78, 0x00, 0x3E,
-    0x78, 0x00, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x02,
-    0xE0, 0x3E, 0x00, 0x00, 0xB4, 0x0F, 0xC0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0xFC, 0x00,
-    0x03, 0xC0, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x2F, 0x00, 0x6F, 0xD5, 0x5F, 0xD4, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xFF, 0x80, 0xF0, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xF0, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4, 0x00, 0x3C, 0x1E, 0x00, 0x03,
-    0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC,
-    0x00, 0x2B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0xBD, 0x00,
-    0x0F, 0xC0, 0x7D, 0x07, 0xE0, 0x00, 0x0F, 0xC1, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x47, 0xC2, 0xF4,
-    0x00, 0x00, 0x3F, 0x2F, 0x5F, 0xC0, 0x00, 0x00, 0x7E, 0xBD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0xBF, 0xD0, 0x00, 0x7F, 0xD7, 0xFD, 0xBF, 0xD0,
-    0x0B, 0xFE, 0x2F, 0xF4, 0xFF, 0xD0, 0xBF, 0xF0, 0xBF, 0xD0, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE,
-    0x01, 0x00, 0xB0, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x02, 0xC0, 0x7F, 0x80, 0x05, 0xB8, 0x00, 0x0B,
-    0x40, 0x00, 0xE0, 0x00, 0x78, 0xEA, 0xFD, 0x7F, 0xFF, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0xFD, 0x3C, 0x00, 0x1F, 0xD3, 0xC0, 0x03, 0xED, 0x3C, 0x00, 0xB9, 0xD3, 0xC0, 0x1F,
-    0x2D, 0x3C, 0x03, 0xD2, 0xD3, 0xD0, 0xBC, 0x2E, 0x3D, 0x0F, 0x02, 0xE3, 0xD3, 0xE0, 0x3E, 0x3D,
-    0x7C, 0x03, 0xE3, 0xDF, 0x40, 0x3E, 0x3F, 0xF0, 0x03, 0xE3, 0xFC, 0x00, 0x3E, 0x3F, 0x80, 0x03,
-    0xE0, 0x02, 0x80, 0x64, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0xFD, 0x3C, 0x00, 0x1F, 0xD3, 0xC0, 0x03, 0xED, 0x3C, 0x00, 0xB9,
-    0xD3, 0xC0, 0x1F, 0x2D, 0x3C, 0x03, 0xD2, 0xD3, 0xD0, 0xBC, 0x2E, 0x3D, 0x0F, 0x02, 0xE3, 0xD3,
-    0xE0, 0x3E, 0x3D, 0x7C, 0x03, 0xE3, 0xDF, 0x40, 0x3E, 0x3F, 0xF0, 0x03, 0xE3, 0xFC, 0x00, 0x3E,
-    0x3F, 0x80, 0x03, 0xE0, 0x0A, 0x00, 0x64, 0x00, 0xF4, 0x1F, 0x40, 0x0F, 0x03, 0xE0, 0x00, 0xF0,
-    0xFC, 0x00, 0x1F, 0x1F, 0x40, 0x01, 0xF3, 0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3E, 0xBF, 0x00, 0x03, 0xE3, 0xFD, 0x00, 0x3E, 0x0F,
-    0xF4, 0x03, 0xE0, 0x3F, 0xD0, 0x7D, 0x01, 0xFF, 0x80, 0x02, 0xAA, 0xA0, 0x3F, 0xFF, 0x03, 0xC0,
-    0xF0, 0x3C, 0x0F, 0x07, 0x80, 0xF0, 0x78, 0x0F, 0x07, 0x80, 0xF0, 0x74, 0x0F, 0x0B, 0x40, 0xF0,
-    0xB4, 0x0F, 0x0F, 0x40, 0xF2, 0xF0, 0x0F, 0x3E, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xBD,
-    0x0B, 0xF0, 0x00, 0x3F, 0x42, 0xFE, 0x00, 0x1F, 0xE0, 0xFF, 0xC0, 0x0F, 0xF8, 0x3F, 0xF4, 0x07,
-    0xFE, 0x0F, 0xBF, 0x02, 0xFB, 0xC3, 0xDF, 0xC0, 0xFA, 0xF0, 0xF6, 0xF8, 0x7D, 0xBC, 0x3D, 0x3F,
-    0x3F, 0x3F, 0x0F, 0x8B, 0xEF, 0x8F, 0xC3, 0xE1, 0xFF, 0xC3, 0xF0, 0xF8, 0x3F, 0xF0, 0xFD, 0x7E,
-    0x07, 0xF4, 0x3F, 0x5F, 0xC0, 0xFC, 0x0F, 0xD7, 0xF0, 0x2A, 0x07, 0xF9, 0xFC, 0x00, 0x01, 0xFE,
-    0x7C, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0xBC, 0xBC,
-    0x00, 0x02, 0xF2, 0xF0, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x3F, 0x6F, 0x40, 0x00, 0xFD, 0xBE, 0xAA,
-    0xAB, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x03,
-    0xFB, 0xF8, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x6F, 0xE0, 0x00,
-    0x2F, 0xEF, 0xD0, 0x0B, 0xC0, 0x2F, 0x01, 0xF0, 0x00, 0xBC, 0x2E, 0x00, 0x03, 0xC3, 0xD0, 0x00,
-    0x3D, 0x3D, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3D, 0x3E, 0x00, 0x03, 0xD2, 0xF8, 0x00, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x06, 0xFE, 0x00, 0x2A, 0xAA, 0xAA,
-    0x83, 0xFF, 0xFF, 0xFD, 0x3E, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x3D, 0x3E, 0x00, 0x03, 0xD3, 0xE0,
-    0x00, 0x3D, 0x3E, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x7D, 0x3E, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x7D,
-    0x3F, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x7D, 0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x7E, 0x01, 0x02,
-    0xB9, 0x00, 0x2E, 0x3F, 0xFE, 0x00, 0xBF, 0xF4, 0x7E, 0x01, 0xFF, 0x00, 0x3C, 0x07, 0xF0, 0x00,
-    0xB8, 0x1F, 0xC0, 0x01, 0xF0, 0x7E, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x1F, 0x07, 0xF0, 0x00, 0x7C,
-    0x1F, 0xF0, 0x03, 0xE0, 0xBF, 0xF9, 0xBF, 0x42, 0xFF, 0xFF, 0xFC, 0x0F, 0xEF, 0xFF, 0xC0, 0x3E,
-    0x2F, 0xFC, 0x01, 0xF8, 0x01, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0xFE, 0xAF, 0xAF, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3E, 0x01, 0xF4, 0x01,
-    0xF4, 0x03, 0xF0, 0x0B, 0xC0, 0x07, 0xD0, 0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x1F, 0x8B, 0xD0,
-    0x00, 0x3F, 0x7F, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x03,
-    0xF5, 0x7F, 0x56, 0xF8, 0x1E, 0x00, 0xBC, 0x00, 0xF4, 0xB0, 0x02, 0xF0, 0x01, 0xE3, 0xC0, 0x0B,
-    0xC0, 0x07, 0x8F, 0x00, 0x2F, 0x00, 0x1E, 0x3C, 0x00, 0xBC, 0x00, 0xF8, 0xBD, 0x02, 0xF0, 0x0B,
-    0xD1, 0xFF, 0xEF, 0xFB, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x2F, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0xBC, 0x00, 0x3C, 0x07, 0xC0, 0x00,
-    0xBC, 0x3D, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0xFD, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F,
-    0xD0, 0xBF, 0x00, 0x0F, 0xD0, 0x29, 0x00, 0x0A, 0x40, 0xF8, 0x00, 0x2E, 0x03, 0xE0, 0x00, 0xB8,
-    0x0F, 0x80, 0x02, 0xE0, 0x3E, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0x2E, 0x03, 0xE0, 0x00, 0xB8, 0x0B,
-    0x80, 0x01, 0xE0, 0x2E, 0x00, 0x07, 0x80, 0xB8, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x7C, 0x0B, 0xD6,
-    0xAA, 0xFA, 0x2F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xEB, 0x00, 0x3A,
-    0xC0, 0x0E, 0xB0, 0x03, 0xAC, 0x00, 0xEB, 0x00, 0x79, 0xE0, 0x7F, 0x3F, 0xFF, 0xC2, 0xF8, 0xF0,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0x03, 0xC3, 0xF0, 0x0F, 0xC0, 0x3C,
-    0x3E, 0x00, 0xFC, 0x03, 0xC3, 0xE0, 0x0B, 0xC0, 0x3C, 0x3E, 0x00, 0xBC, 0x03, 0xC3, 0xE0, 0x0B,
-    0xC0, 0x3C, 0x3E, 0x00, 0xBC, 0x03, 0xC3, 0xE0, 0x0B, 0x80, 0x3C, 0x3E, 0x00, 0xB8, 0x03, 0xC3,
-    0xE0, 0x07, 0x80, 0x3C, 0x3E, 0x00, 0x78, 0x03, 0xC3, 0xF5, 0x5B, 0xD5, 0x7C, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xC0,
-    0x3E, 0x00, 0xFC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E,
-    0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xC0, 0x3E, 0x00, 0xB8, 0x03, 0xC0, 0x3E, 0x00,
-    0xB8, 0x03, 0xC0, 0x3E, 0x00, 0x78, 0x03, 0xC0, 0x3E, 0x00, 0x78, 0x03, 0xC0, 0x3F, 0x55, 0xBD,
-    0x57, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x15, 0x7C, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x54, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x3C, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x3D, 0x00, 0x1E, 0x00, 0x3D, 0x00,
-    0x2E, 0x00, 0x3E, 0x56, 0xFD, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x90, 0x29, 0x00, 0x00,
-    0x02, 0x83, 0xF0, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00, 0x3C, 0x3F,
-    0x00, 0x00, 0x03, 0xC3, 0xF5, 0x40, 0x00, 0x3C, 0x2F, 0xFF, 0xF4, 0x03, 0xC2, 0xF0, 0x02, 0xE0,
-    0x3C, 0x2F, 0x00, 0x0B, 0x03, 0xC2, 0xF0, 0x00, 0xB4, 0x3C, 0x1F, 0x00, 0x0F, 0x43, 0xD1, 0xF5,
-    0x5B, 0xF0, 0x3D, 0x1F, 0xFF, 0xFD, 0x07, 0xD1, 0xFF, 0xFE, 0x00, 0x7D, 0x2C, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95, 0x40, 0x03,
-    0xFF, 0xFF, 0x40, 0xF4, 0x00, 0xB4, 0x3D, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xC3, 0xD0, 0x01, 0xF0,
-    0xF9, 0x5B, 0xFC, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x39, 0x01, 0xFC, 0x01, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00,
-    0x3F, 0xFF, 0xC0, 0x02, 0xAA, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x34, 0x00, 0x7F,
-    0x03, 0xFE, 0xFF, 0xD0, 0x3F, 0xFF, 0xF4, 0x00, 0x6F, 0xE8, 0x00, 0x10, 0x00, 0x14, 0x00, 0xB8,
-    0x03, 0xFF, 0xC0, 0xB8, 0x0F, 0x41, 0xF0, 0xB8, 0x2C, 0x00, 0x78, 0xB8, 0x38, 0x00, 0x3C, 0xB8,
-    0x74, 0x00, 0x2D, 0xB8, 0xB0, 0x00, 0x1D, 0xB8, 0xB0, 0x00, 0x1E, 0xBF, 0xF0, 0x00, 0x1E, 0xBE,
-    0xF4, 0x00, 0x2D, 0xB4, 0xBC, 0x00, 0x3D, 0x74, 0xBF, 0x41, 0xFC, 0x74, 0x3F, 0xFF, 0xF8, 0x74,
-    0x1F, 0xFF, 0xE0, 0x70, 0x02, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x3C, 0x02, 0xE0, 0x1C, 0x00,
-    0xB8, 0x0B, 0x00, 0x2E, 0x02, 0xC0, 0x0B, 0x80, 0x78, 0x02, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFE, 0x00, 0xF8, 0x0F, 0x80, 0xBC, 0x03, 0xE0, 0x3D, 0x00, 0xF8, 0x2F, 0x00, 0x3E, 0x0F, 0x40,
-    0x0F, 0x8B, 0xC0, 0x03, 0xE0, 0x01, 0xA0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0xB0, 0x0F,
-    0x40, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x2F, 0xAF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3D, 0x50, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xC0, 0xBF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xBF, 0xD0, 0x01, 0x40, 0x01, 0x40, 0x7C, 0x00, 0x78,
-    0x07, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xE0,
-    0x2F, 0x00, 0xB4, 0x00, 0x78, 0x0F, 0x00, 0x02, 0xC2, 0xFA, 0xAA, 0xBD, 0x3F, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFD, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x04, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xAF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xA4,
-    0x00, 0x01, 0xF7, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x1F, 0x80, 0x0B, 0xF0,
-    0x01, 0xF0, 0x02, 0xF4, 0x00, 0x3C, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x0F,
-    0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x07, 0xF0,
-    0x0F, 0xD0, 0x01, 0xFD, 0x03, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x0B, 0x95, 0xF0, 0x1E,
-    0x00, 0x3C, 0x3C, 0x00, 0x1D, 0x74, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0xB4, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7F, 0x55, 0xBF, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xD0, 0x7E, 0xAB, 0xF4, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x01, 0xBF, 0xF9,
-    0x00, 0x2F, 0x0F, 0xD3, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0x81, 0xE0, 0x78,
-    0x1E, 0x07, 0x81, 0xE0, 0xB8, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0xBD, 0x2F, 0x80, 0xBD, 0x3F, 0xC0, 0xFE, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00,
-    0x78, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x07, 0xF4, 0x1F, 0xFF, 0x03, 0xFF, 0xC0,
-    0x15, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xD5, 0x7C, 0x00, 0x00, 0xD0, 0x0B, 0x00, 0x00,
-    0x34, 0x02, 0xC0, 0x00, 0x0D, 0x00, 0xB0, 0x00, 0x03, 0x40, 0x2F, 0xFD, 0x00, 0xC0, 0x0B, 0x02,
-    0xD0, 0x30, 0x02, 0xC0, 0x2C, 0x0C, 0x00, 0xB0, 0x07, 0x07, 0x00, 0x2C, 0x01, 0xC1, 0xC0, 0x0B,
-    0x06, 0xF1, 0xF0, 0x02, 0xFF, 0xF8, 0xF4, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0xE0,
-    0x01, 0xC0, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE5, 0x56, 0xD0, 0x7C, 0xE0,
-    0x01, 0xC0, 0x0D, 0xE0, 0x01, 0xD0, 0x0D, 0xE0, 0x01, 0xD0, 0x0E, 0xE0, 0x01, 0xD1, 0x7D, 0xE0,
-    0x01, 0xFF, 0xFC, 0xE0, 0x01, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x6B, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x01, 0xF7, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0x01, 0xF8, 0x02, 0xFC, 0x00, 0x7C, 0x02, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x02,
-    0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x3D, 0x03,
-    0xF0, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40, 0x0F, 0x41, 0xF4, 0x00, 0xF0, 0x3E, 0x00, 0x0F, 0x0B,
-    0xC0, 0x01, 0xF1, 0xF4, 0x00, 0x1F, 0x3E, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3E, 0x3F, 0xD0, 0x03, 0xE0, 0xFF,
-    0x40, 0x3E, 0x07, 0xFD, 0x07, 0xD0, 0x1F, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0xFD, 0x3C, 0x00, 0x1F, 0xD3, 0xC0, 0x03, 0xED, 0x3C, 0x00, 0xB9, 0xD3, 0xC0,
-    0x1F, 0x2D, 0x3C, 0x03, 0xD2, 0xD3, 0xD0, 0xBC, 0x2E, 0x3D, 0x0F, 0x02, 0xE3, 0xD3, 0xE0, 0x3E,
-    0x3D, 0x7C, 0x03, 0xE3, 0xDF, 0x40, 0x3E, 0x3F, 0xF0, 0x03, 0xE3, 0xFC, 0x00, 0x3E, 0x3F, 0x80,
-    0x03, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x2D, 0x00, 0xB4, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x1F,
-    0x00, 0x02, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x7D, 0x00, 0xFC, 0x02, 0xF0, 0x01, 0xF4,
-    0x0F, 0xC0, 0x03, 0xF0, 0x7E, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x76, 0xD0, 0x01, 0xDB,
-    0x40, 0x07, 0x6D, 0x00, 0x1D, 0xB4, 0x00, 0x76, 0xD0, 0x01, 0xDB, 0x40, 0x07, 0x6D, 0x00, 0x1D,
-    0xB4, 0x00, 0x76, 0xD0, 0x01, 0xDB, 0x40, 0x07, 0x6F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF4, 0x01, 0xC0,
-    0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x10, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xAF, 0xEA, 0xA4,
-    0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xBF, 0x95, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x07, 0xC0, 0x1F,
-    0x40, 0x07, 0x40, 0x7D, 0x00, 0x0E, 0x01, 0xF4, 0x00, 0x3C, 0x07, 0xF0, 0x02, 0xE0, 0x0F, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x2A, 0xFA, 0xA9, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xFE, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0xF4, 0x00, 0xFC, 0x00,
-    0x3C, 0x00, 0xF8, 0x00, 0x2C, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x05, 0x55, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xD5, 0x55, 0xBF, 0xE0, 0x0F, 0xF4, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0xFD, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xD2, 0xF0, 0xFC, 0x00, 0x07, 0xC0, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x2F, 0x01,
-    0xF0, 0x00, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xBC, 0x01,
-    0xF0, 0x0F, 0x40, 0x2F, 0x00, 0x3D, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2A, 0xAA, 0xAA, 0x83,
-    0xFF, 0xFF, 0xFC, 0x2F, 0x40, 0x2F, 0x80, 0xBC, 0x07, 0xE0, 0x02, 0xF0, 0xF4, 0x00, 0x0B, 0xBD,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0xB4, 0xF2, 0xC0, 0x0E, 0x0F, 0x0F, 0x02, 0xC0, 0xF0, 0x74, 0x3C,
-    0x0F, 0x03, 0x87, 0x80, 0xF0, 0x3C, 0xB4, 0x0F, 0x02, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0x41, 0xFF,
-    0xF8, 0x00, 0xF4, 0x2F, 0x03, 0xE0, 0x0F, 0x43, 0xE0, 0x0F, 0x82, 0xF0, 0x3E, 0x0B, 0xFF, 0xFE,
-    0x07, 0xDB, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x90, 0x1F, 0xF0, 0x0F, 0xD0,
-    0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBE,
-    0x3F, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x0B, 0xE3, 0xF4, 0x00,
-    0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x1F, 0xD1, 0xFF, 0x40, 0x0B, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xBA,
-    0x00, 0x00, 0x0B, 0xE0, 0x03, 0xC2, 0xE7, 0xD0, 0x3C, 0x3C, 0x0F, 0x47, 0x87, 0xC6, 0xFF, 0xF4,
-    0x2B, 0xFF, 0xFE, 0x00, 0xFE, 0x9B, 0xF4, 0x1F, 0x40, 0x0B, 0xC3, 0xE0, 0x00, 0x3D, 0x3D, 0x00,
-    0x03, 0xE3, 0xD0, 0x00, 0x2F, 0x3D, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40, 0x0B, 0xD1,
-    0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x2F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC2, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x54, 0x00, 0x02, 0xF8,
-    0x7C, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80,
-    0x0F, 0x40, 0x1F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0xBC, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x01, 0xF6, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0xFF,
-    0xFF, 0x15, 0x57, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xD2, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x2F, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xAA, 0xAA, 0x80, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x51, 0xFF, 0xFF, 0x1D, 0x00, 0x01, 0xD0, 0x00, 0x1E, 0x00, 0x07, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xD2, 0xE0, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xE2, 0xFA, 0xAA, 0xAA, 0x4B, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x5A,
-    0xE4, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFD, 0x01, 0xFC, 0x0F, 0xD0, 0x01, 0xF4, 0x3F, 0x00, 0x02,
-    0xE0, 0xFC, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x7C, 0x3E, 0x00, 0x02, 0xF0,
-    0xFC, 0x00, 0x6F, 0x83, 0xF0, 0x0B, 0xFC, 0x0F, 0xC0, 0x2F, 0x80, 0x7F, 0xF8, 0x2F, 0xFE, 0x0B,
-    0x00, 0x02, 0xC0, 0x00, 0xB0, 0x00, 0x2C, 0x00, 0x0B, 0xFF, 0x82, 0xF0, 0x3C, 0xB0, 0x07, 0x6C,
-    0x00, 0xDB, 0x00, 0x36, 0xC0, 0xBC, 0xF0, 0x3D, 0x00, 0x00, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0xBE, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0xBE, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0xBE, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0xBE,
-    0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0xFF, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xBF, 0xF8, 0x00,
-    0x00, 0xBF, 0xF2, 0xFF, 0xCF, 0xFE, 0x00, 0x02, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0x80, 0x0B, 0xFF,
-    0x83, 0xFF, 0xC2, 0xFF, 0xE0, 0x2F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0A, 0x40, 0xA0, 0x1A, 0x00, 0x7C, 0x0F, 0x03,
-    0xD0, 0x03, 0xE0, 0xF0, 0xBC, 0x00, 0x1F, 0x0F, 0x0F, 0x40, 0x00, 0xBC, 0xF3, 0xE0, 0x00, 0x03,
-    0xEF, 0xBC, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x0B, 0xF7,
-    0xFD, 0xFE, 0x01, 0xFE, 0x3F, 0xCB, 0xF8, 0x7F, 0xC3, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x01,
-    0x95, 0x1B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4,
-    0x00, 0x01, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF1, 0x00, 0x01, 0xFC, 0xF9, 0x06, 0xFE, 0x3F, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x01, 0x00, 0xB0, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x02, 0xC0, 0x7F,
-    0x80, 0x05, 0xB8, 0x00, 0x0B, 0x40, 0x00, 0xE0, 0x00, 0x78, 0xEA, 0xFD, 0x7F, 0xFF, 0x1F, 0xFD,
-    0x02, 0x40, 0x00, 0xE9, 0x00, 0x00, 0xD0, 0x00, 0x34, 0x03, 0xF8, 0x00, 0x50, 0x00, 0x03, 0xF0,
-    0x07, 0xF0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x2F, 0xC0, 0x00, 0x7E, 0x07, 0xF4, 0x00,
-    0x0B, 0xD0, 0xFE, 0x00, 0x00, 0xBD, 0x2F, 0xC0, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0xFD, 0xFF,
-    0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xDF, 0xF8,
-    0x00, 0x02, 0xFC, 0xBF, 0xE0, 0x00, 0x2F, 0xC3, 0xFF, 0x80, 0x02, 0xFC, 0x0F, 0xFE, 0x00, 0x3F,
-    0x80, 0x7F, 0xF8, 0x03, 0xF8, 0x02, 0xFF, 0xE0, 0x3F, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x18, 0x02, 0x80, 0x3D, 0x0F, 0x80,
-    0x3C, 0x1F, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0xBC, 0x00, 0x3D, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0xBE, 0xF8, 0x00, 0xBC, 0xFE, 0x00, 0xB8, 0x3F,
-    0x80, 0xF8, 0x1F, 0xE0, 0xF8, 0x0B, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x0B,
-    0x80, 0x00, 0xFC, 0x00, 0x0B, 0x8A, 0x41, 0xF8, 0x00, 0x0F, 0x8F, 0x83, 0xF0, 0x00, 0x0F, 0x8F,
-    0x8B, 0xD0, 0x00, 0x0F, 0x9F, 0x8F, 0xC0, 0x00, 0x0F, 0x9F, 0xAF, 0x00, 0x00, 0x0F, 0x9F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0x6F, 0xBF, 0x40,
-    0x00, 0x2F, 0x6F, 0x9F, 0xE0, 0x00, 0x2F, 0x6F, 0x8B, 0xF8, 0x00, 0x2F, 0x6F, 0x83, 0xFE, 0x00,
-    0x3F, 0x6F, 0x81, 0xFF, 0x80, 0x3F, 0x15, 0x00, 0xBF, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0xF8, 0x18,
-    0x00, 0x19, 0x02, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0xB8, 0x03, 0xCF, 0x1F, 0x00, 0x3D, 0xF3, 0xD0,
-    0x03, 0xDF, 0x78, 0x00, 0x3E, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7D, 0xFF, 0x80, 0x07, 0xAF,
-    0x3F, 0x00, 0xBA, 0xF1, 0xFC, 0x0B, 0xAE, 0x0B, 0xF0, 0xB8, 0x00, 0x3F, 0xC0, 0x07, 0xD0, 0x0B,
-    0xF0, 0x2F, 0xFF, 0x87, 0xF4, 0x0F, 0xFF, 0xE3, 0xF8, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x0F, 0xD0,
-    0xFD, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x0F,
-    0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFA, 0xFF, 0x40, 0x00, 0xFE, 0x3F, 0xF4,
-    0x00, 0x3F, 0x83, 0xFF, 0x40, 0x0F, 0xE0, 0x7F, 0xF4, 0x03, 0xF4, 0x0B, 0xFF, 0x40, 0xFD, 0x00,
-    0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x2F, 0x0F,
-    0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00,
-    0x3F, 0x1F, 0xF0, 0x00, 0x0F, 0xC1, 0xFF, 0x00, 0x03, 0xF0, 0x2F, 0xF0, 0x00, 0xFC, 0x03, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0x02, 0xFF, 0xFF, 0xF4, 0x07, 0xF4, 0x06, 0xAA, 0xAF, 0xD0,
-    0x3F, 0x80, 0x00, 0x00, 0x2F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xF4, 0x00, 0x00,
-    0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0xFF, 0xF4, 0x2A, 0xAA, 0x40, 0xA0, 0x0F, 0xFF,
-    0xD0, 0xF8, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x2F, 0x00, 0x00,
-    0x03, 0xDF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x7C, 0xFF, 0x00, 0x00, 0x2F, 0x0F,
-    0xF0, 0x00, 0x0B, 0xC1, 0xFF, 0x00, 0x02, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x2F, 0x80, 0x00,
-    0x0B, 0xE0, 0xBE, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x03, 0xF8,
-    0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0B, 0xF0,
-    0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xEA, 0xAA, 0xAF, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x64, 0x00, 0x19, 0x2E, 0x00, 0x0B, 0x4B, 0x80, 0x02, 0xD2, 0xE0, 0x00, 0xF8, 0xB8, 0x00,
-    0x3E, 0x2E, 0x00, 0x0F, 0x8B, 0x80, 0x03, 0xE2, 0xF0, 0x00, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xF3, 0xF0, 0x01, 0xFC, 0xFC, 0x00, 0x3F, 0x3F, 0x00, 0x0F, 0xCF, 0xC0,
-    0x03, 0xF4, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x2F, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE3, 0xF4, 0x00, 0x00,
-    0xFE, 0xAA, 0xA9, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xD7, 0x80, 0x02, 0xFF,
-    0xFD, 0x7C, 0x00, 0x2E, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x07, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFD,
-    0x55, 0x5F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x6B, 0x90, 0x03, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0xFC, 0x00, 0x0F, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0xFD, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3D,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x3F,
-    0x00, 0x1B, 0xF0, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xF4, 0x3F, 0x00, 0x03, 0xF4, 0x03, 0xE4, 0x00,
-    0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xFB, 0xFE, 0x40, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x83, 0xF0, 0x00, 0x7F, 0x80, 0x2F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0xB4, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x3E, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x0B, 0xC0, 0x02,
-    0xE0, 0x00, 0x38, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x0B, 0x80,
-    0x3E, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x01, 0xF4,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xEB, 0xFC, 0x0A, 0x03,
-    0xFE, 0x41, 0xFF, 0xFD, 0x6F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xEB, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x54, 0x00, 0x2E, 0x00, 0x1F, 0xFE, 0x00, 0xF4, 0x01, 0xE0, 0x2D, 0x07, 0xC0, 0x0E, 0x00, 0x38,
-    0x1E, 0x00, 0x74, 0x00, 0xE0, 0x78, 0x02, 0xC0, 0x07, 0x82, 0xE0, 0x0F, 0x00, 0x3C, 0x0B, 0x80,
-    0x3C, 0x02, 0xF0, 0x1F, 0x00, 0xB8, 0x2F, 0x40, 0x7D, 0x01, 0xF7, 0xF8, 0x20, 0xFE, 0x03, 0xFF,
-    0xEB, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x5A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x04, 0x0F, 0xFF, 0xFA, 0x6B, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x0F, 0xE0, 0x10, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x1F, 0xD0,
-    0x00, 0x05, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xEF, 0xEA,
-    0xFF, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF, 0x00, 0x03, 0xF0, 0x03,
-    0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0xBF,
-    0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xD2,
-    0xF0, 0x00, 0xBC, 0x0F, 0x40, 0x0F, 0x80, 0xFC, 0x00, 0xF4, 0x07, 0xC0, 0x2F, 0x00, 0x3E, 0x03,
-    0xE0, 0x03, 0xF0, 0x7D, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0xF8, 0xF8, 0x00, 0x0B, 0xDF, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE2,
-    0xF8, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xBF, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00,
-    0x3F, 0x8F, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0xAB, 0xFE, 0xA4, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2A, 0x00, 0x02, 0x92, 0xF0, 0x00,
-    0x7C, 0x0F, 0x40, 0x0F, 0xC0, 0xFC, 0x00, 0xF4, 0x0B, 0xC0, 0x2F, 0x00, 0x3D, 0x03, 0xE0, 0x03,
-    0xF0, 0x3D, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0xF8, 0xF8, 0x00, 0x0F, 0xDF, 0x40, 0x00, 0x7F, 0xF0,
-    0x00, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x6A, 0xAF, 0xEA, 0xA0, 0x01,
-    0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x40, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xCF, 0xF4,
-    0x00, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x1F, 0xF0, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x06, 0x02, 0xD0, 0x00, 0xF0, 0x0F, 0x00, 0x3C,
-    0x00, 0x7C, 0x0B, 0x80, 0x02, 0xE1, 0xF0, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x7E, 0x1F, 0x40,
-    0x0F, 0xC0, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0xBE, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xB8,
-    0x00, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x0B,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0xB8, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00,
-    0x0B, 0x80, 0x00, 0x0F, 0xD5, 0x55, 0xB9, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x55, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0x0B, 0x00, 0x0E, 0x00, 0x2C, 0x00,
-    0x38, 0x00, 0xB0, 0x00, 0xE0, 0x02, 0xC0, 0x03, 0x80, 0x0B, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x38,
-    0x00, 0xB0, 0x00, 0xE0, 0x02, 0xC0, 0x03, 0x80, 0x0B, 0x00, 0x0F, 0x55, 0x7D, 0x40, 0x3F, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x50, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2E, 0x00, 0x03, 0xF0, 0x0B, 0x80, 0x00, 0xFC, 0x01, 0xE0, 0x00,
-    0x3F, 0x00, 0x78, 0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x07, 0xF0, 0x03, 0xD0, 0x07, 0xF8, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAF, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0B, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01, 0xE0,
-    0x74, 0x01, 0xE0, 0x74, 0x01, 0xE0, 0x74, 0x01, 0xE0, 0x34, 0x01, 0xE0, 0x38, 0x02, 0xE0, 0x2D,
-    0x5B, 0xE0, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x01,
-    0xD0, 0x00, 0x01, 0xDF, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x3D, 0xB8, 0x00, 0x03, 0xEF, 0x80,
-    0x00, 0x3E, 0xF8, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x7E, 0xFC, 0x3C, 0x07, 0xEB, 0xC3, 0xC0, 0xFE,
-    0x7F, 0x3C, 0x7F, 0xE3, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFB, 0xF0, 0x2F, 0xF8, 0x7F, 0x00, 0x3C,
-    0x07, 0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x3C, 0x07, 0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x07, 0x00, 0x0E, 0x70, 0x00, 0xE7, 0x00, 0x0E, 0x70, 0x00, 0xEB, 0x04, 0x1E, 0x74,
-    0xC2, 0xE7, 0xDD, 0x7E, 0x3F, 0xFF, 0xF0, 0xBF, 0x5F, 0x00, 0xC1, 0xF0, 0x0C, 0x1F, 0x00, 0x81,
-    0xF0, 0x04, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF5, 0xAE, 0x80, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xF8, 0x3F, 0x40, 0x03, 0xC3, 0xF0,
-    0x00, 0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x3D, 0x3E, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3E,
-    0x3F, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x69, 0x00, 0x1F, 0x7F, 0xFD, 0x01, 0xFF, 0xFF, 0xF4, 0x1F, 0xF0,
-    0x1F, 0x81, 0xFC, 0x00, 0x7C, 0x2F, 0x40, 0x03, 0xC2, 0xF0, 0x00, 0x3C, 0x2F, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x3D, 0x3F, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x3D, 0x3F, 0x00, 0x07, 0xE3, 0xF4, 0x00,
-    0xBE, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x2E,
-    0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xF4, 0xFD, 0x1F, 0x40, 0x01, 0x5F, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0xA9, 0x54, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x06, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0x41, 0xE0, 0x50,
-    0x78, 0x00, 0x74, 0xF0, 0xF0, 0x00, 0x38, 0xBF, 0xFF, 0xFF, 0xFC, 0x1B, 0xFF, 0xFF, 0xE8, 0x02,
-    0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x14, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xD0,
-    0x0B, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0x80, 0xF8, 0x0F, 0x80, 0x00, 0x0F, 0x03, 0xF4, 0xBD,
-    0x00, 0x05, 0x7E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xEA, 0x95, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00,
-    0x19, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0x41, 0xE0, 0x50, 0x7C, 0x00, 0x34,
-    0xF0, 0xB0, 0x00, 0x3C, 0xBF, 0xFF, 0xFF, 0xFC, 0x1A, 0xFF, 0xFF, 0xE9, 0x01, 0xE0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x18, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE7, 0xF9, 0xFF, 0x7F, 0xDF, 0xF0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03,
-    0xF4, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0xFE,
-    0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0x4F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xEF, 0xFE, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0x3F, 0xF9, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0xFF, 0xE2, 0xFF, 0xD0, 0x0F, 0xFF, 0x43,
-    0xFF, 0x83, 0xFF, 0xD0, 0xBF, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7D, 0x03, 0xF0, 0x00, 0x2F, 0x41, 0xF4, 0x1F, 0x80,
-    0x00, 0x3F, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x7E, 0x1F, 0x4B, 0xD0, 0x00, 0x00, 0xFC, 0xBD, 0x7E,
-    0x00, 0x00, 0x00, 0xFE, 0xFB, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFB, 0xFD, 0xFF, 0x40, 0x02, 0xFF, 0x5F, 0xF6, 0xFF, 0x40, 0x2F, 0xF8, 0xBF, 0xD3, 0xFF,
-    0x42, 0xFF, 0xC2, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xBD, 0x00, 0xBC,
-    0x07, 0xF0, 0x02, 0xE0, 0x3F, 0x40, 0x0B, 0x81, 0xF8, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0xF8, 0xBD,
-    0x00, 0x03, 0xE3, 0xF0, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x1F, 0x46, 0xFF, 0x40, 0xBD, 0x00, 0x7F, 0x02, 0xF4, 0x00, 0x7F, 0x0B,
-    0xD0, 0x00, 0xBC, 0x3F, 0x40, 0x01, 0xF4, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x01, 0x90, 0x00, 0x24, 0x0A, 0x03, 0x82, 0xD0, 0x38, 0x3C, 0x03, 0x8F, 0x40, 0x35,
-    0xE0, 0x07, 0x7C, 0x00, 0x7F, 0x40, 0x07, 0xFA, 0x40, 0xB4, 0x7E, 0x0B, 0x40, 0xB8, 0xB4, 0x03,
-    0xCF, 0x40, 0x2D, 0xF0, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x64, 0x00,
-    0x00, 0x55, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x80,
-    0x2F, 0x00, 0x01, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00,
-    0x2F, 0x40, 0x3F, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x03, 0xFF, 0xC3, 0xFD, 0x00, 0x3F,
-    0xF8, 0x7F, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA0, 0x00,
-    0xFF, 0xFC, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x01, 0xE0, 0x3C, 0x00,
-    0x78, 0x0F, 0x00, 0x1E, 0x03, 0xC0, 0x0B, 0x40, 0xF0, 0x02, 0xD0, 0x3C, 0x00, 0xF4, 0x0F, 0x00,
-    0xBC, 0x03, 0xFC, 0x3E, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x3F,
-    0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x40,
-    0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x00,
-    0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF8, 0x3F, 0xC0, 0x00, 0x1F, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x19, 0x07,
-    0x80, 0x01, 0xE0, 0x7C, 0x00, 0x2E, 0x07, 0xC0, 0x02, 0xE0, 0x7C, 0x00, 0x2E, 0x07, 0xC0, 0x02,
-    0xF0, 0xBC, 0x00, 0x2F, 0x0B, 0xC0, 0x02, 0xF0, 0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0x0B, 0xD0, 0x03, 0xF0, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x03, 0xFC, 0xBC, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xD0,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x3F,
-    0x80, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x28, 0x00, 0x19, 0x1E, 0x00, 0x07, 0x87, 0xC0, 0x02, 0xE1, 0xF0, 0x00, 0xB8,
-    0x7C, 0x00, 0x2F, 0x1F, 0x00, 0x0B, 0xCB, 0xC0, 0x02, 0xF2, 0xF0, 0x00, 0xBC, 0xBF, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF2, 0xF4, 0x00, 0xFC, 0xBC, 0x00, 0x3F, 0x2F, 0x00, 0x0F,
-    0xCB, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xB8, 0x15, 0x00, 0x01, 0x53, 0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x3F, 0x2E, 0x00, 0x03, 0xF2, 0xE0, 0x00, 0x3F, 0x1E, 0x00, 0x03, 0xF1, 0xE0, 0x00, 0x3F,
-    0x0F, 0x00, 0x07, 0xF0, 0xF4, 0x01, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFE, 0xBE, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x40, 0x0C, 0x34, 0x01, 0xD3, 0x40, 0x1D, 0x38,
-    0x01, 0xD3, 0x80, 0x1D, 0x38, 0x02, 0xD3, 0xD0, 0xBD, 0x1F, 0xFF, 0xD0, 0x7F, 0x5D, 0x00, 0x02,
-    0xD0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFC, 0x00, 0x7E, 0xFF, 0x00, 0x3F, 0xBF, 0x00, 0x2F,
-    0x7F, 0xD0, 0x1F, 0xDF, 0xC0, 0x0B, 0xD7, 0xF8, 0x0F, 0xF3, 0xF0, 0x02, 0xF8, 0xFF, 0x03, 0xF5,
-    0xFD, 0x00, 0xBE, 0x2F, 0xD2, 0xFC, 0x7F, 0x40, 0x2F, 0x87, 0xFC, 0xFF, 0x1F, 0xD0, 0x0F, 0xE0,
-    0xFF, 0xBF, 0x4B, 0xF8, 0x03, 0xFC, 0x1F, 0xFF, 0xC2, 0xFE, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0xBF,
-    0x80, 0x3F, 0xC0, 0xBF, 0xF4, 0x2F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFC, 0x0F, 0xFC, 0x03, 0xFC, 0x03,
-    0xFE, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x15, 0x00, 0x01, 0x50, 0x0F, 0xD0, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x1F, 0xF0, 0x1E, 0xFC, 0x0F, 0xBC, 0x07, 0xDF, 0x47, 0xDF,
-    0x01, 0xF3, 0xE2, 0xF3, 0xD0, 0x7C, 0xBC, 0xF9, 0xF4, 0x1F, 0x1F, 0xFC, 0x7D, 0x0B, 0xC3, 0xFF,
-    0x1F, 0x82, 0xF0, 0x7F, 0x4B, 0xE0, 0xBC, 0x0F, 0xC2, 0xF8, 0x2F, 0x02, 0xE0, 0xBF, 0x0B, 0xD0,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x15, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC0, 0x00,
-    0x1C, 0x00, 0x1C, 0x00, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x95, 0xB8, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00,
-    0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x01, 0xFD, 0x03, 0x94, 0x03, 0x40, 0x38, 0x00, 0x70, 0x03, 0xD0, 0x1F, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F,
-    0x40, 0x1F, 0x82, 0xE0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0x7D, 0x01, 0xBF, 0x83, 0xE0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x41, 0xFC, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x0B, 0xC2, 0xF0,
-    0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x01,
-    0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xE5, 0x55, 0x57, 0xF4, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x03, 0xE0, 0x1F, 0x40, 0x7F, 0x02, 0xF8, 0x0B, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF9, 0x70, 0x02, 0xFF, 0xFF, 0x40, 0xBE, 0x5B, 0xF4, 0x0F, 0x40, 0x1F, 0x82, 0xE0, 0x00,
-    0xF8, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E,
-    0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x7D, 0x01, 0xBF, 0x83,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xEA, 0xA4, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x50, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x6F, 0xD7, 0x0F, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0xBE, 0x41, 0xF0, 0x0B, 0xE5, 0xBF, 0xF4, 0x00, 0x34, 0x0F, 0x40, 0x1F, 0xE0, 0x00, 0x3C,
-    0x2E, 0x00, 0x0F, 0xE6, 0xAF, 0xFD, 0x3C, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x3C, 0x00, 0x0B, 0xE5,
-    0x50, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x95, 0x6C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0x83, 0xE2, 0xFF, 0x90, 0x0B, 0x00, 0x0B, 0x02,
-    0xC0, 0x03, 0x80, 0x3E, 0x57, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-    0xE0, 0x03, 0x94, 0x03, 0x40, 0x34, 0x00, 0x70, 0x03, 0xD0, 0x1F, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xD0, 0x0B, 0x00, 0xF4,
-    0x00, 0x3C, 0x1E, 0x00, 0x03, 0xC2, 0xFA, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE3, 0xD5, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x95, 0x6C, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x2B, 0xFD, 0x00, 0x02, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFF, 0x41, 0xE5, 0x6F, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x15, 0x6F, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xEA, 0x7D, 0x1D, 0x00, 0x03, 0xC0,
-    0xF0, 0x00, 0xB4, 0x03, 0x80, 0x7F, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1A, 0x40, 0x00, 0x06, 0xFF,
-    0x90, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x02, 0xE5, 0x6F, 0xFC, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x6F, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE,
-    0xBD, 0x2E, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0xB8, 0x07, 0x40, 0x2F, 0x00, 0x2F, 0xBF, 0xC0, 0x00,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x1F, 0x80, 0xBE,
-    0x02, 0xFC, 0x0F, 0xE0, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00,
-    0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF4, 0x1E, 0x56, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x56, 0xF3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFE, 0xA7, 0xD1,
-    0xD0, 0x00, 0x3C, 0x0F, 0x00, 0x0B, 0x40, 0x38, 0x07, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xA4,
-    0x00, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x02, 0xE5, 0x6F, 0xFC, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x6F, 0x3F, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFE, 0xBD, 0x2E, 0x00, 0x03, 0xC0, 0xE0, 0x00, 0xB8, 0x0B, 0x40, 0x2F, 0x00, 0xFF,
-    0xBF, 0xE0, 0x0F, 0xEF, 0xFF, 0x01, 0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x07, 0xF0,
-    0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFB, 0xFF, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xCF, 0xFE, 0x7F, 0xF4, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF8, 0xBF, 0xF4, 0x03, 0xFF, 0xD0, 0xFF, 0xE0, 0xFF, 0xF4, 0x2F, 0xFE, 0x03, 0xFF, 0xC0, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0xBD, 0x00, 0x0F, 0xC0, 0x7D, 0x07, 0xE0,
-    0x00, 0x0F, 0xC1, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x47, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x2F, 0x4F,
-    0xC0, 0x00, 0x00, 0x7E, 0xBD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x07, 0xFE, 0xFF, 0xBF, 0xD0, 0x00, 0x7F, 0xD7, 0xFD, 0xBF, 0xD0, 0x07, 0xFE, 0x2F, 0xF4, 0xFF,
-    0xD0, 0xBF, 0xF0, 0xBF, 0xD0, 0xFF, 0xD0, 0x1F, 0x40, 0xBC, 0x0B, 0xE0, 0x3F, 0x43, 0xF8, 0x0F,
-    0xD0, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE,
-    0x40, 0x1F, 0xFF, 0xFC, 0x06, 0x54, 0x6F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC4, 0x00, 0x07, 0xF3, 0xE5,
-    0x5B, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0xFC, 0x3F, 0x40, 0xFC, 0x3F, 0x41, 0xFD, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x10, 0x0B, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40,
-    0x00, 0x0B, 0x00, 0x07, 0xF8, 0x00, 0x01, 0x6E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0x80, 0x00,
-    0x07, 0x80, 0x3A, 0xBF, 0x40, 0x7F, 0xFF, 0x00, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF9, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xFC, 0x04, 0x00, 0xFC, 0x1F, 0x97, 0xFC, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF9, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x04, 0x00, 0xFC, 0x1F, 0x97,
-    0xFC, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x50, 0x0F, 0xC0,
-    0x00, 0x1F, 0xE0, 0x3F, 0x00, 0x00, 0xFF, 0x80, 0xFC, 0x00, 0x07, 0xFF, 0x03, 0xF0, 0x00, 0x3F,
-    0xFC, 0x0F, 0xD0, 0x01, 0xFF, 0xF0, 0x3F, 0x40, 0x0B, 0xFF, 0xC0, 0xFD, 0x00, 0x3F, 0x7F, 0x03,
-    0xF8, 0x02, 0xF8, 0xFC, 0x0F, 0xE0, 0x0F, 0xD3, 0xF0, 0x2F, 0x80, 0xBF, 0x1F, 0xD0, 0xBF, 0x03,
-    0xF4, 0x7F, 0x42, 0xFC, 0x2F, 0xC1, 0xFD, 0x0B, 0xF0, 0xFD, 0x07, 0xF8, 0x1F, 0xCB, 0xF0, 0x1F,
-    0xE0, 0x7F, 0x3F, 0x40, 0x7F, 0x81, 0xFE, 0xFC, 0x01, 0xFF, 0x07, 0xFF, 0xD0, 0x07, 0xFC, 0x1F,
-    0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xD3, 0xC0, 0x01, 0xFD, 0x3C, 0x00, 0x3E, 0xD3, 0xC0, 0x0B,
-    0x9D, 0x3C, 0x01, 0xF2, 0xD3, 0xC0, 0x3D, 0x2D, 0x3D, 0x0B, 0xC2, 0xE3, 0xD0, 0xF0, 0x2E, 0x3D,
-    0x3E, 0x03, 0xE3, 0xD7, 0xC0, 0x3E, 0x3D, 0xF4, 0x03, 0xE3, 0xFF, 0x00, 0x3E, 0x3F, 0xC0, 0x03,
-    0xE3, 0xF8, 0x00, 0x3E, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x7F, 0x02,
-    0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x05, 0x40, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0xFC,
-    0x00, 0x03, 0xFE, 0x03, 0xF0, 0x00, 0x1F, 0xFC, 0x0F, 0xC0, 0x00, 0xFF, 0xF0, 0x3F, 0x40, 0x07,
-    0xFF, 0xC0, 0xFD, 0x00, 0x2F, 0xFF, 0x03, 0xF4, 0x00, 0xFD, 0xFC, 0x0F, 0xE0, 0x0B, 0xE3, 0xF0,
-    0x3F, 0x80, 0x3F, 0x4F, 0xC0, 0xBE, 0x02, 0xFC, 0x7F, 0x42, 0xFC, 0x0F, 0xD1, 0xFD, 0x0B, 0xF0,
-    0xBF, 0x07, 0xF4, 0x2F, 0xC3, 0xF4, 0x1F, 0xE0, 0x7F, 0x2F, 0xC0, 0x7F, 0x81, 0xFC, 0xFD, 0x01,
-    0xFE, 0x07, 0xFB, 0xF0, 0x07, 0xFC, 0x1F, 0xFF, 0x40, 0x1F, 0xF0, 0x7F, 0xFC, 0x00, 0x7F, 0xC0,
-    0xFF, 0xE0, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x0B, 0xC0, 0x3F, 0x00, 0xFD, 0x03, 0xF0,
-    0x0F, 0xE0, 0x3F, 0x40, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0xFD, 0x3C, 0x00, 0x1F, 0xD3, 0xC0, 0x03, 0xED, 0x3C, 0x00, 0xB9, 0xD3,
-    0xC0, 0x1F, 0x2D, 0x3C, 0x03, 0xD2, 0xD3, 0xD0, 0xBC, 0x2E, 0x3D, 0x0F, 0x02, 0xE3, 0xD3, 0xE0,
-    0x3E, 0x3D, 0x7C, 0x03, 0xE3, 0xDF, 0x40, 0x3E, 0x3F, 0xF0, 0x03, 0xE3, 0xFC, 0x00, 0x3E, 0x3F,
-    0x80, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0x95, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x02,
-    0xFD, 0x1F, 0xFE, 0x55, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x0B, 0xE0, 0x3F, 0x40, 0xFE,
-    0x03, 0xF8, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xEF, 0xD0, 0x0B, 0xC0, 0x2F, 0x01, 0xF0, 0x00, 0xBC, 0x2E, 0x00,
-    0x03, 0xC3, 0xD0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3D, 0x3E, 0x00, 0x03, 0xD2,
-    0xF8, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x06, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0x80, 0x0B, 0xF4, 0x0F, 0xD0, 0x00, 0x2F, 0xC1, 0xF8, 0x00, 0x00, 0xFD, 0x2F, 0x40, 0x00, 0x0B,
-    0xE3, 0xF0, 0x00, 0x00, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xAA, 0xFF, 0x3F, 0x40,
-    0x00, 0x07, 0xE3, 0xF8, 0x00, 0x00, 0xBE, 0x2F, 0xC0, 0x00, 0x0F, 0xD1, 0xFF, 0x40, 0x07, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0x06, 0xBA, 0x40, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x0F, 0xE4,
-    0x6F, 0x41, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xF3,
-    0xE5, 0x55, 0x7F, 0x3E, 0x00, 0x03, 0xE3, 0xF4, 0x00, 0xBD, 0x1F, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3F,
-    0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x7F, 0x40, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0xFD, 0x00, 0x02, 0xFC,
-    0x1F, 0x80, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x0B, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFA, 0xAF, 0xF3, 0xF4, 0x00, 0x00, 0x7E, 0x3F, 0x80, 0x00, 0x0B, 0xE2,
-    0xFC, 0x00, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x0B,
-    0xC0, 0x3F, 0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFE, 0x46, 0xF4, 0x1F, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3D,
-    0x3D, 0x00, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0x3E, 0x55, 0x57, 0xF3, 0xE0, 0x00, 0x3E, 0x3F, 0x40,
-    0x0B, 0xD1, 0xFF, 0xEF, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xF8, 0x01,
-    0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x50, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x6A, 0xAA, 0xBD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xFD,
-    0x00, 0x07, 0xFD, 0x2F, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0x80, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x2F, 0xC0, 0xBF, 0x43, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0x90, 0x1F,
-    0xC0, 0x10, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xFF, 0xFC, 0x00,
-    0x2A, 0xAF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0x40, 0x07, 0xF0, 0x3F, 0xEF, 0xFD,
-    0x03, 0xFF, 0xFF, 0x40, 0x06, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x05, 0x0F, 0x80, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0x40, 0x7D, 0x00,
-    0xBC, 0x00, 0xFC, 0x03, 0xF0, 0x01, 0xF8, 0x0F, 0x80, 0x03, 0xF0, 0x7D, 0x00, 0x07, 0xE3, 0xF0,
-    0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3E, 0x01, 0xF4, 0x01, 0xF4, 0x03, 0xF0,
-    0x0B, 0xC0, 0x07, 0xD0, 0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
-    0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x1F, 0x40, 0x1F, 0x80, 0xBE, 0x00, 0xBF, 0x03, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x68, 0x3E, 0x00, 0x02, 0xF0,
-    0x7D, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x7D, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x07,
-    0xE0, 0x3E, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0xBD, 0x00, 0xBE, 0x02, 0xF4, 0x03, 0xFC, 0x0F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x1F, 0x40, 0x1F, 0x40,
-    0x3F, 0x00, 0xBC, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xFC, 0x1F, 0x80, 0x01, 0xF8, 0xBD, 0x00, 0x03,
-    0xF7, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x06, 0xA0,
-    0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x01, 0xF4,
-    0x0F, 0x80, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0xA0, 0x01,
-    0xF4, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x2F,
-    0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00,
-    0x00, 0xFD, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x3F, 0x00, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x28, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00,
-    0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x7C, 0x3D,
-    0x00, 0x07, 0xD3, 0xD0, 0x00, 0xBD, 0x3E, 0x00, 0x0F, 0xD2, 0xF8, 0x07, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xBD, 0x01, 0xBF, 0x87, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x3F,
-    0x40, 0xFC, 0x3F, 0x41, 0xFD, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x38, 0x0B, 0x00, 0x38, 0x0B, 0x00, 0x38, 0x0B, 0x00, 0x38,
-    0x0B, 0x00, 0x38, 0x0B, 0x00, 0x78, 0x07, 0x81, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0xBE, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x5F, 0xFF, 0xF7, 0x40, 0x01,
-    0xD0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBE, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x87, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x1E, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xC7, 0xEA, 0xBF, 0x40, 0x00, 0x7F, 0x1F, 0x00, 0x1F, 0x00, 0x01, 0xFC,
-    0x7C, 0x00, 0x1E, 0x00, 0x07, 0xF1, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0xC7, 0xC0, 0x00, 0xF0, 0x00,
-    0x7F, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x7C, 0x05, 0xFF, 0x00, 0x0B, 0xF5, 0xFF, 0xFF, 0xF4,
-    0x00, 0x2F, 0xD7, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x6F, 0xFF, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x7F, 0x00,
-    0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x28, 0x3F, 0x00, 0x00, 0x03, 0xC3,
-    0xF0, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00, 0x3C, 0x3F, 0x54, 0x00,
-    0x03, 0xC2, 0xFF, 0xFF, 0x40, 0x3C, 0x2F, 0x00, 0x2E, 0x03, 0xC2, 0xF0, 0x00, 0xB0, 0x3C, 0x2F,
-    0x00, 0x0B, 0x43, 0xC1, 0xF0, 0x00, 0xF4, 0x3D, 0x1F, 0x55, 0xBF, 0x03, 0xD1, 0xFF, 0xFF, 0xD0,
-    0x7D, 0x1F, 0xFF, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xF4, 0x10, 0x0F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0x40,
-    0x07, 0xC0, 0x03, 0xC0, 0x00, 0xB8, 0x02, 0xD0, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0xF0,
-    0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0F,
-    0xC0, 0xBE, 0x00, 0x0B, 0xE0, 0x0F, 0xFF, 0x07, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x2A,
-    0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x05, 0x55, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0xE1, 0xD0, 0x03, 0x87, 0x40, 0x0E, 0x1D, 0x00, 0x74, 0xB0, 0x01, 0xD2, 0xC0, 0x07, 0x4B,
-    0x00, 0x1D, 0x2C, 0x00, 0x74, 0xB0, 0x01, 0xD2, 0xC0, 0x07, 0x4B, 0x00, 0x1D, 0x2C, 0x00, 0x74,
-    0xF0, 0x02, 0xC3, 0xC0, 0x0B, 0x0F, 0x00, 0x2C, 0x3C, 0x00, 0xB0, 0xF0, 0x02, 0xC3, 0xC0, 0x0B,
-    0x0F, 0x00, 0x2C, 0x3C, 0x00, 0xB0, 0xE0, 0x03, 0xC0, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0x87, 0xF8, 0x3F, 0xC3, 0xFC, 0x2F, 0xC0, 0xFD, 0x0F, 0xF0, 0x1F, 0xF1, 0xFE, 0x2F, 0xD2, 0xFC,
-    0x3F, 0x83, 0xF4, 0xBF, 0x00, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F, 0x4B,
-    0xF0, 0xBF, 0x87, 0xF8, 0x3F, 0xC3, 0xFC, 0x2F, 0xC0, 0xFD, 0x0F, 0xF0, 0xBF, 0x8F, 0xF4, 0x7F,
-    0x87, 0xF8, 0x3F, 0xC3, 0xF8, 0x3F, 0xC3, 0xF8, 0x2F, 0xC2, 0xFC, 0x0F, 0xD1, 0xFD, 0x0F, 0xF0,
-    0xFE, 0x1F, 0xF1, 0xFF, 0x1F, 0xE2, 0xFD, 0x2F, 0xD2, 0xFC, 0x2F, 0xC2, 0xFC, 0x3F, 0x83, 0xF8,
-    0x3F, 0x47, 0xF4, 0xBF, 0x0B, 0xF0, 0x05, 0x51, 0xFE, 0x2F, 0xD2, 0xFC, 0x2F, 0xC3, 0xF8, 0x7F,
-    0x4B, 0xF0, 0x7F, 0xCB, 0xF8, 0x0F, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x0B, 0xF0, 0x1F,
-    0xD1, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x0B, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xA0, 0x03, 0xF4, 0x0F, 0xFD, 0x3F, 0xF4, 0xFE, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF, 0x40, 0x00, 0x0F, 0xC3, 0xF1, 0xFC, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x3F, 0x00, 0x1F, 0xC0,
-    0x0F, 0xC7, 0xF0, 0x02, 0xFC, 0x01, 0xFC, 0xBF, 0x40, 0x3F, 0xC0, 0x2F, 0xD0, 0x29, 0x3E, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x15, 0x00, 0x00, 0xF0, 0x20, 0x80, 0x01, 0xD0,
-    0x24, 0x80, 0x03, 0x80, 0x65, 0x80, 0x0B, 0x00, 0x30, 0xC0, 0x0E, 0x00, 0x3B, 0xC0, 0x3C, 0x00,
-    0x1F, 0x40, 0x74, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0xF0, 0x44, 0x88, 0x03, 0xE2, 0x58, 0xA4, 0x07, 0xC2, 0x0D, 0x48, 0x0F, 0x41, 0x98, 0xDC,
-    0x2F, 0x00, 0xF0, 0xB8, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFE, 0x2F, 0xD2, 0xFC, 0x3F, 0x83,
-    0xF4, 0xBF, 0x00, 0x1F, 0xF1, 0xFF, 0x1F, 0xE2, 0xFD, 0x2F, 0xD2, 0xFC, 0x2F, 0xC2, 0xFC, 0x3F,
-    0x83, 0xF8, 0x3F, 0x47, 0xF4, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x38,
-    0x02, 0x80, 0x3E, 0x02, 0xF4, 0x1F, 0x42, 0xF0, 0x0F, 0x80, 0xF8, 0x1F, 0x00, 0xB8, 0x0B, 0xC0,
-    0xF4, 0x07, 0xC0, 0x3C, 0x07, 0x80, 0x28, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x7E, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x40, 0x3E,
-    0x0F, 0xC0, 0x1F, 0x43, 0xD0, 0x0B, 0xC1, 0xF0, 0x03, 0xD0, 0xB8, 0x00, 0xB0, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x28, 0x07, 0xE0, 0x3F, 0x02, 0xF4, 0x0B, 0xC0, 0x7D, 0x03,
-    0xF0, 0x0F, 0x80, 0xBC, 0x03, 0xD0, 0x0F, 0x00, 0xF4, 0x07, 0xC0, 0x0E, 0x00, 0xB0, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00, 0x2D, 0x78, 0x03, 0xE0, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x7D, 0x01, 0xF4, 0x0B, 0xC0, 0x2F, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x08, 0x10, 0x00, 0x34, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xFD, 0x03, 0xF8, 0x0F, 0xE0, 0x2F, 0x40, 0x1D, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0xBF, 0x42, 0xFD,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0xFF, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0xF4, 0x02, 0xF4,
-    0x3F, 0x80, 0x07, 0xFF, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF4, 0x2F, 0x00, 0xFF,
-    0xE0, 0x1F, 0xFE, 0x03, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x3C, 0x07, 0xC0,
-    0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-    0x0F, 0xC0, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x40, 0x00, 0x3F, 0x83, 0xF8, 0x7F, 0xCB, 0xFC, 0xFF,
-    0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFD, 0x03, 0xE0, 0xFF, 0xF0, 0x24, 0x0F, 0x6F, 0x80, 0x00, 0xF0, 0xFC, 0x00, 0x1F, 0x0B,
-    0xC0, 0x01, 0xF0, 0xBC, 0x00, 0x1F, 0x0B, 0xC0, 0x01, 0xF0, 0xFC, 0x00, 0x2F, 0x1F, 0x40, 0x02,
-    0xF7, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2A, 0xAA,
-    0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x3D, 0x40, 0x38, 0xB0, 0x00, 0xD1, 0xE4, 0x5F,
-    0x01, 0xFF, 0xF0, 0x00, 0x65, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x07,
-    0x18, 0xA0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xAB, 0x80, 0x00,
-    0x02, 0x18, 0x10, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x90, 0x00, 0xD0, 0x00, 0x24, 0x5A, 0x24,
-    0xD2, 0xD9, 0xB0, 0xBF, 0xD0, 0x0B, 0xD0, 0x07, 0xD0, 0x07, 0xFD, 0x0F, 0xAB, 0x47, 0x64, 0xE6,
-    0x28, 0x40, 0x0A, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x6F, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x7E, 0x41, 0xFF, 0x07, 0xE4, 0x1F,
-    0xF0, 0x24, 0x00, 0x2F, 0x83, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE5, 0xBF, 0xC0, 0x1D, 0x38, 0x00, 0x3F, 0x40,
-    0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x3D, 0x00,
-    0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF8, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0x7D, 0x00, 0x00, 0xBE, 0x01, 0xF4, 0x00, 0x0B, 0xF0, 0x0B, 0xD0, 0x02, 0xFF, 0x00, 0x2F,
-    0x40, 0x2F, 0xF0, 0x00, 0xBD, 0x00, 0xBF, 0x00, 0x02, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0B,
-    0xF0, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x02, 0xF4, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0xF0,
-    0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xF5, 0x6F,
-    0xF0, 0x00, 0x4E, 0x00, 0x0F, 0xD0, 0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x3F, 0x01,
-    0xF0, 0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00,
-    0x00, 0x7D, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x07, 0xF8,
-    0x00, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xF0, 0x0B, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x2F,
-    0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x07, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xF0,
-    0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x0F,
-    0xC0, 0xB4, 0x00, 0x3F, 0x03, 0xC0, 0x01, 0xFC, 0x1F, 0x00, 0x0B, 0xF4, 0xB8, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x3D, 0x2F, 0x80, 0x02, 0xF0, 0xFE, 0x00, 0x0F,
-    0xC3, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x20, 0x82, 0x41, 0x4D, 0x06, 0x32, 0x8C, 0xC5, 0x73, 0x42, 0xCF, 0x5E, 0x1F, 0xF4,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xD0, 0x02, 0xE0, 0x07, 0xA0, 0x0D, 0x60, 0x2C, 0xB0, 0x3F, 0xFC,
-    0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0xBF, 0xD9, 0x00, 0x90, 0x0D, 0x00, 0xFF, 0x80, 0x0E, 0x00,
-    0xB4, 0x0F, 0xFF, 0xDB, 0xF4, 0x03, 0xF8, 0x0C, 0x00, 0x24, 0x00, 0x3B, 0xE0, 0x3C, 0x2C, 0x38,
-    0x0C, 0x2C, 0x2C, 0x0F, 0xF4, 0x01, 0x90, 0xFF, 0xF0, 0x01, 0xC0, 0x0B, 0x00, 0x38, 0x00, 0xE0,
-    0x07, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x0A, 0x00, 0x01, 0x90, 0x0C, 0x24, 0x28, 0x1C, 0x1D,
-    0x28, 0x07, 0xE0, 0x1D, 0x38, 0x38, 0x1C, 0x38, 0x0D, 0x3D, 0x7C, 0x0B, 0xF0, 0x0B, 0xE0, 0x28,
-    0x28, 0x30, 0x1C, 0x34, 0x0C, 0x2D, 0x6D, 0x0B, 0xFD, 0x00, 0x0C, 0x1A, 0xBC, 0x1F, 0xE0, 0x0E,
-    0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x2F, 0x40, 0x0B,
-    0x82, 0xF0, 0x00, 0xBC, 0x2F, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xC3, 0xF4,
-    0x00, 0xFC, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xF4, 0x00, 0xFD,
-    0x06, 0xA4, 0x07, 0x02, 0x83, 0x80, 0x30, 0xD0, 0x0E, 0x70, 0xD3, 0xAC, 0x34, 0xBB, 0x0D, 0x3E,
-    0xD1, 0x0F, 0x78, 0x07, 0x9F, 0x47, 0xE3, 0xFF, 0xF0, 0x7F, 0xF8, 0x06, 0xF8, 0x00, 0x04, 0x07,
-    0xD0, 0x0D, 0x00, 0xD0, 0x0D, 0x00, 0xD0, 0x0D, 0x00, 0xD0, 0xBF, 0xDF, 0xFD, 0x00, 0x01, 0xFE,
-    0x08, 0x0E, 0x00, 0x1C, 0x00, 0xB0, 0x07, 0x40, 0xB8, 0x0F, 0x80, 0xBF, 0xF3, 0xFF, 0xC0, 0x1F,
-    0xE0, 0x00, 0x18, 0x00, 0x18, 0x07, 0xE0, 0x00, 0x24, 0x00, 0x1C, 0x00, 0x2C, 0x2F, 0xF8, 0x2F,
-    0xE0, 0x00, 0x10, 0x00, 0xE0, 0x02, 0xE0, 0x07, 0x70, 0x0D, 0x70, 0x2C, 0x70, 0x3F, 0xFD, 0x00,
-    0xB0, 0x00, 0xB0, 0x00, 0xB4, 0x00, 0x00, 0xBF, 0xC3, 0x00, 0x0C, 0x00, 0x3F, 0xD0, 0x01, 0xC0,
-    0x03, 0x84, 0x1D, 0x3F, 0xF0, 0xAE, 0x00, 0x02, 0xF8, 0x0D, 0x00, 0x24, 0x00, 0x3B, 0xE0, 0x3C,
-    0x2C, 0x38, 0x0C, 0x28, 0x0C, 0x1F, 0xBC, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0x00, 0x28,
-    0x00, 0xE0, 0x03, 0x40, 0x1D, 0x00, 0xB0, 0x03, 0xC0, 0x1F, 0x00, 0x14, 0x00, 0x01, 0x90, 0x0C,
-    0x28, 0x18, 0x0C, 0x0D, 0x28, 0x07, 0xF0, 0x1D, 0x28, 0x38, 0x0C, 0x38, 0x0D, 0x2D, 0x6C, 0x0B,
-    0xF4, 0x0B, 0xE0, 0x28, 0x28, 0x30, 0x1C, 0x34, 0x0C, 0x2D, 0x2D, 0x0B, 0xFD, 0x00, 0x0C, 0x1A,
-    0xBC, 0x1F, 0xE0, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x0B,
-    0x80, 0x0F, 0x40, 0x0F, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x15, 0x74, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x0B,
-    0x80, 0x03, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x7C, 0x00, 0xBC, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF4, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00, 0x7E, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x40,
-    0x00, 0x0F, 0x03, 0xC0, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0xF4, 0x3D,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xD0,
-    0xF4, 0x00, 0xFF, 0xF0, 0x3C, 0x00, 0x7F, 0xBC, 0x1F, 0x00, 0x3F, 0x6D, 0x0B, 0x40, 0x1F, 0xCF,
-    0x03, 0xC0, 0x0B, 0xE7, 0xC1, 0xF0, 0x03, 0xF6, 0xE0, 0xB8, 0x00, 0xFC, 0xF4, 0x3D, 0x00, 0x3F,
-    0x7C, 0x0F, 0x00, 0x0F, 0xFF, 0x07, 0xC0, 0x03, 0xFF, 0x82, 0xE0, 0x00, 0xFF, 0xE0, 0xF4, 0x00,
-    0x3F, 0xFF, 0xBD, 0x6F, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xE6, 0xFF, 0xFE, 0x40, 0xF4, 0x3D, 0x00, 0x00, 0x3C, 0x0F,
-    0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x2D, 0xFC, 0x0F, 0xD0, 0x02, 0xFF, 0xC0, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xF0,
-    0x02, 0xD0, 0x00, 0xFF, 0xE0, 0x3D, 0x00, 0x0F, 0xFF, 0xFB, 0xEB, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xF9, 0x1B, 0xD0, 0x0F, 0x80, 0x00, 0x80, 0x0F,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x05, 0xBD, 0x55, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xEA, 0xA5, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0xFE,
-    0x00, 0xBE, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFC, 0x07, 0xF0, 0xFD,
-    0x00, 0x03, 0xFC, 0x03, 0xF4, 0xFD, 0x00, 0x03, 0xFD, 0x02, 0xFD, 0xFD, 0x00, 0x03, 0xFD, 0x00,
-    0xFE, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x56, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00,
-    0xBC, 0x00, 0x07, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xFF, 0xAA, 0xAF, 0xF8, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xD5, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0xB0, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x2E, 0xAF, 0xF8, 0x00, 0x1F, 0xFE, 0x0B, 0xFF, 0xFC, 0x00,
-    0x0E, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xE0, 0x00, 0x3F,
-    0x92, 0xF4, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xFE, 0x03, 0xF0, 0x07, 0xC0, 0x00,
-    0x2F, 0xF0, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0x8F, 0xC0,
-    0x1F, 0xC0, 0x0B, 0xAB, 0xE3, 0xF0, 0x07, 0xF0, 0x07, 0xFF, 0xF8, 0xFC, 0x01, 0xFC, 0x02, 0xFF,
-    0xFC, 0x3F, 0x00, 0xBF, 0x40, 0x2F, 0xF9, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,
-    0x0B, 0x40, 0xF0, 0x00, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x03, 0xC0,
-    0x1E, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x07, 0x80, 0x78, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x5F, 0x9B, 0xF9, 0x7D, 0x40, 0x2D, 0x2F, 0xF0, 0xF0, 0x00, 0xB4, 0xFB, 0xC7,
-    0xC0, 0x01, 0xE3, 0xDF, 0x5E, 0x00, 0x07, 0xEF, 0x2E, 0xB8, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00,
-    0x3F, 0xE0, 0xFF, 0x40, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x0B, 0xF0,
-    0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x3A, 0x94, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0x3F, 0x40, 0x6F, 0x80, 0x2F,
-    0x3E, 0x00, 0x07, 0xD0, 0x2F, 0x3D, 0x00, 0x02, 0xE0, 0x2F, 0x3D, 0x00, 0x01, 0xF0, 0x2F, 0x3D,
-    0x02, 0x40, 0xF0, 0x2F, 0x3D, 0x07, 0xC0, 0xF0, 0x2F, 0x3D, 0x07, 0xC0, 0xF0, 0x2F, 0x3D, 0x07,
-    0xC0, 0xF0, 0x2F, 0x3D, 0x03, 0xC0, 0xA0, 0x2F, 0x3C, 0x03, 0xC0, 0x00, 0x2F, 0x3C, 0x03, 0xC0,
-    0x00, 0x2F, 0x3C, 0x02, 0xF0, 0x00, 0x3F, 0x3C, 0x00, 0xFD, 0x00, 0x7F, 0x3C, 0x00, 0x7F, 0xFB,
-    0xFF, 0x14, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xBE, 0x2C, 0x00, 0x01, 0xFF, 0xEF, 0x00, 0x00, 0xF4, 0x7F,
-    0xC0, 0x00, 0xB0, 0x03, 0xF0, 0x00, 0x38, 0x00, 0xBC, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0x03, 0xC0,
-    0x0F, 0xC0, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF7, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00,
-    0x3F, 0x90, 0x14, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x01, 0xFB, 0xFF, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x95, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xAF, 0xEA, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x40, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0B, 0xFE,
-    0x40, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xAF, 0xC6, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x19,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x55, 0x6F, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFE, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xAF, 0x56, 0xC0, 0x0F, 0xF8, 0x0F, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0x00,
-    0x00, 0x2F, 0xC0, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x0E, 0x00, 0x00,
-    0x3F, 0x40, 0x0E, 0x00, 0x00, 0x3F, 0x40, 0x0E, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0x50, 0x00, 0x3F,
-    0x40, 0x0F, 0xFF, 0xFD, 0x3F, 0x40, 0x0E, 0xAF, 0xFE, 0x3F, 0xC0, 0x0E, 0x01, 0xFA, 0x3F, 0xD0,
-    0x0E, 0x01, 0xF0, 0x2F, 0xF4, 0x0E, 0x02, 0xF0, 0x1F, 0xFF, 0xEF, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xEE, 0x10, 0x2F, 0x4E, 0x00, 0x3F,
-    0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3D, 0x0E, 0x00, 0x3E, 0x0E, 0x00, 0x3F, 0x0F,
-    0x00, 0x2F, 0xDF, 0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xF9, 0x00, 0x0B, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xA5, 0x4F, 0xC5,
-    0x55, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x40, 0x0A, 0xAB, 0xFA, 0x83, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3D, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xF7, 0xFC, 0x00, 0x07, 0xFF, 0x90,
-    0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x01, 0x00, 0x25, 0xF1, 0xBC, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x7F, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x3C, 0x3E, 0xF0, 0x02, 0xE0, 0x07, 0xC0, 0x2F, 0x00, 0x1F,
-    0x0B, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFB, 0x5F, 0xC0, 0x0B, 0xC7, 0x47, 0xC0, 0x0F, 0x87,
-    0x43, 0xD0, 0x0F, 0x47, 0x42, 0xD0, 0x0F, 0x07, 0x42, 0xD0, 0x0F, 0x03, 0x81, 0xD0, 0x0F, 0x03,
-    0x81, 0xD0, 0x0F, 0x03, 0x81, 0xD0, 0x0F, 0x03, 0x81, 0xD0, 0x0F, 0x03, 0x82, 0xD0, 0x0F, 0x03,
-    0x82, 0xD0, 0x0F, 0x43, 0x82, 0xD0, 0x0B, 0x43, 0x82, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xD5, 0x5B, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x02, 0xFC, 0x05, 0x5F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2A, 0xAF, 0xFA, 0xA4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x01, 0xF5, 0xE3, 0xE0, 0x02, 0xF4, 0x78, 0x3F, 0x02, 0xF0, 0x1E, 0x02,
-    0xE0, 0x70, 0x07, 0x80, 0x20, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x70, 0x07, 0x80, 0x10, 0x2F, 0x01, 0xE0, 0x2E, 0x02, 0xF4, 0x78, 0x3F, 0x00, 0x1F, 0x5E,
-    0x3E, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x00, 0x01,
-    0xE0, 0x1F, 0xAA, 0xAA, 0xAA, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00,
-    0x1C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xBF, 0x80, 0x07, 0xC7, 0x2E, 0x01, 0xF0, 0x70, 0x7C, 0x28, 0x07,
-    0x01, 0xC0, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x04, 0x07, 0x00, 0x03, 0xE0, 0x70, 0x2C, 0x0B, 0x87, 0x0B, 0x40, 0x2F, 0xB3,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x5A, 0xAE, 0x07,
-    0xFF, 0xFF, 0x81, 0xFD, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x2D, 0xF8, 0x00, 0x0B, 0x0F, 0x80, 0x02,
-    0xC0, 0xF8, 0x00, 0xF0, 0x0F, 0x80, 0x3C, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0xC2, 0x40, 0x00, 0xF8,
-    0x00, 0x00, 0x08, 0x0F, 0xAA, 0x54, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x17, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xF7, 0x80, 0x03, 0xF1, 0xE0, 0x03, 0xF0, 0x38, 0x03, 0xF0, 0x0E, 0x03, 0xF0, 0x03,
-    0xC3, 0xF0, 0x00, 0xF2, 0xF0, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x10, 0x3E, 0x00, 0x0F, 0x03, 0xE0, 0x03, 0x80, 0x3D, 0x01, 0xD0, 0x07, 0xD0,
-    0x74, 0x00, 0x7C, 0x2C, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0xF0,
-    0x00, 0xF8, 0x3C, 0x00, 0xBC, 0x0B, 0x00, 0xBC, 0x01, 0xD0, 0x7C, 0x00, 0x78, 0x7D, 0x00, 0x0E,
-    0x3D, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00,
-    0x00, 0x7E, 0xC0, 0xEF, 0x00, 0x01, 0xF5, 0xC0, 0xD7, 0xD0, 0x07, 0xD1, 0xC0, 0xD1, 0xF4, 0x1F,
-    0x41, 0xC0, 0xD0, 0x7D, 0x2E, 0x01, 0xC0, 0xD0, 0x1D, 0x04, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01,
-    0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0,
-    0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0,
-    0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0,
-    0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00,
-    0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x1C,
-    0x01, 0xC0, 0xD0, 0x0C, 0x2F, 0x01, 0xC0, 0xD0, 0x3E, 0x0B, 0xC1, 0xC0, 0xD0, 0xF8, 0x02, 0xF1,
-    0xC0, 0xD3, 0xE0, 0x00, 0xFE, 0xC0, 0xDF, 0x80, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0xF4, 0x00, 0x00, 0x03, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x0B, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x0B,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0xF4, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xFE,
-    0x0E, 0xFC, 0x02, 0xFF, 0x83, 0x4B, 0xE0, 0x3C, 0xA0, 0xD0, 0xB4, 0x00, 0x28, 0x34, 0x00, 0x00,
-    0x0A, 0x0D, 0x00, 0x00, 0x02, 0x83, 0x40, 0x00, 0x00, 0xA0, 0xD0, 0x00, 0x00, 0x28, 0x34, 0x00,
-    0x00, 0x0A, 0x0D, 0x01, 0x01, 0xF6, 0x83, 0x43, 0xE0, 0x7F, 0xE0, 0xD3, 0xF4, 0x02, 0xF8, 0x3F,
-    0xE0, 0x00, 0x1F, 0x4F, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0xAF, 0x80, 0xF0, 0x1F, 0xFF, 0xD3, 0xC0, 0xFD, 0x07, 0xDE, 0x0B, 0xC0, 0x03, 0xF4,
-    0x3E, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7C, 0x0B, 0xC0, 0x03, 0xD0, 0x1F,
-    0xE5, 0x7F, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x03, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x03,
-    0xE0, 0x00, 0xBF, 0xE5, 0x7F, 0xF7, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF, 0x40,
-    0x03, 0xF0, 0x00, 0x07, 0xCB, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x3F, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x0B, 0x80, 0x03, 0xE0, 0x00,
-    0xFC, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x4F, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0xBF, 0x40, 0x01, 0xFF, 0xE5, 0x56, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x4B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00,
-    0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F,
-    0x00, 0xFD, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0xD5, 0x55, 0x5B, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x01, 0x50, 0x02, 0x80, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xE0, 0x03,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x2C,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0x82, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x80, 0x3F, 0x40, 0x00, 0x00, 0xF8, 0x2F,
-    0xC0, 0x00, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x2F, 0x80, 0x07, 0xFF, 0xF0, 0xFF, 0xF4, 0x0F, 0xD5, 0xBA, 0xF9, 0xBC, 0x2E, 0x00, 0x2F,
-    0xC0, 0x0D, 0x3C, 0x00, 0x0F, 0x80, 0x0E, 0x3C, 0x00, 0x0F, 0x40, 0x0B, 0x3C, 0x00, 0x0F, 0x40,
-    0x0B, 0x3C, 0x00, 0x0F, 0xC0, 0x1E, 0x2F, 0x51, 0xBF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFA, 0xFF, 0xFC,
-    0x07, 0xFF, 0xF0, 0xFF, 0xF4, 0x00, 0xBF, 0x80, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x00, 0x02, 0xFE, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x19, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xD7,
-    0xF6, 0xFE, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0xFC, 0x7F, 0x6F, 0xDB, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xF5, 0xF0, 0x0B, 0x4B, 0x81, 0xF0, 0x3C, 0x3D,
-    0x01, 0xFA, 0xF0, 0xA0, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x74, 0xBC, 0x3E, 0x02, 0xD3, 0xD0, 0x2F, 0x6F, 0x0A, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFB, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xF8, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x3F,
-    0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x40, 0x00, 0x16, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x15, 0xAF, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x01, 0xBF, 0xFF, 0xE4, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60,
-    0x00, 0x05, 0xAF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xA9, 0x42, 0xEA, 0x50, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_12_regularBitmaps[27832] = {
+    0x85, 0x55, 0xBF, 0x8F, 0xD4, 0x46, 0x14, 0x7E, 0x9E, 0x81, 0x73, 0x82, 0x45, 0x86, 0x22, 0x54,
+    0xC7, 0x9D, 0xA9, 0x93, 0x3B, 0x9C, 0x22, 0xC5, 0x45, 0xDA, 0x5D, 0x5B, 0xA2, 0xA0, 0xA0, 0x49,
+    0xA4, 0x40, 0x4A, 0xD2, 0xA4, 0x8C, 0x96, 0xE2, 0xA4, 0x50, 0xDC, 0x61, 0x87, 0x2B, 0x52, 0xA4,
+    0x21, 0x52, 0xFE, 0x00, 0x5A, 0x2E, 0xC5, 0x35, 0x14, 0x14, 0x4B, 0x3C, 0xE4, 0x8A, 0x14, 0x48,
+    0x64, 0x0E, 0x14, 0x51, 0x50, 0x60, 0xE0, 0x8A, 0x48, 0x91, 0x82, 0xA3, 0x98, 0xE0, 0xBB, 0xD8,
+    0x9E, 0x7C, 0x6F, 0xBC, 0xB7, 0xD1, 0x56, 0xF1, 0xCE, 0xBE, 0x79, 0x33, 0x9E, 0x7D, 0xF3, 0x7E,
+    0x7C, 0xEF, 0x5B, 0x2F, 0x1B, 0xF8, 0x7A, 0xC3, 0xD7, 0x93, 0x80, 0x47, 0xA3, 0x8E, 0x46, 0x78,
+    0xBF, 0xA1, 0x84, 0xE2, 0xAD, 0x3A, 0x7D, 0xD0, 0x58, 0x9D, 0x6F, 0x35, 0xF9, 0xF9, 0x26, 0x97,
+    0x18, 0x75, 0x2E, 0x2B, 0xCB, 0xA3, 0x26, 0x1A, 0xD0, 0x1D, 0x22, 0xF2, 0xB5, 0x4A, 0x30, 0x4D,
+    0xA8, 0x82, 0x0C, 0x32, 0x05, 0x49, 0x35, 0x95, 0x90, 0x2A, 0x0B, 0x21, 0x2C, 0x3F, 0xC6, 0xC9,
+    0x86, 0xBC, 0x4A, 0xF2, 0x9B, 0x88, 0x46, 0x90, 0xA2, 0x94, 0x05, 0xA6, 0x98, 0x86, 0x90, 0xB2,
+    0xF4, 0x8D, 0x5B, 0x6C, 0x12, 0x85, 0xEE, 0xF4, 0x0D, 0x27, 0x2B, 0x0A, 0x0A, 0xA5, 0xF1, 0xA6,
+    0xA5, 0x86, 0x6D, 0x9A, 0x7E, 0xE1, 0xB9, 0x85, 0x0E, 0x33, 0x9A, 0x7F, 0xD6, 0xD7, 0x21, 0x96,
+    0x96, 0x20, 0x16, 0xED, 0x3E, 0x51, 0x6A, 0x6D, 0xC2, 0x42, 0x53, 0xDC, 0x2D, 0x9D, 0xA2, 0xF0,
+    0xC9, 0x85, 0x84, 0x82, 0xE7, 0x7B, 0x86, 0x44, 0xCD, 0x27, 0x53, 0x3E, 0xA9, 0xEC, 0xB7, 0x09,
+    0x79, 0xD6, 0xC2, 0x97, 0x00, 0x9E, 0xC2, 0x3B, 0xDB, 0x21, 0xAC, 0x8B, 0xB6, 0x24, 0x6F, 0xEF,
+    0x15, 0xD4, 0xF5, 0xAF, 0xF0, 0xFB, 0xA5, 0x65, 0x5B, 0x86, 0xAF, 0x76, 0x6C, 0xC3, 0x01, 0xB5,
+    0x2C, 0xBA, 0x80, 0x35, 0x1A, 0x5B, 0xBE, 0xC8, 0xDB, 0x33, 0x47, 0xB7, 0x1F, 0x7B, 0x6B, 0xE6,
+    0x8D, 0x8F, 0xCC, 0xC8, 0x2C, 0x34, 0x42, 0x2F, 0x7F, 0x49, 0xC5, 0x49, 0x4F, 0x97, 0x92, 0x3E,
+    0x58, 0xF7, 0xF4, 0xC9, 0x01, 0x7D, 0x28, 0x57, 0x49, 0x5D, 0x78, 0x86, 0x8B, 0x5F, 0x21, 0xE0,
+    0x27, 0x88, 0x43, 0x3E, 0xAB, 0x49, 0xFC, 0x21, 0x33, 0x7A, 0x43, 0x57, 0xE9, 0xB5, 0x3E, 0x43,
+    0x1B, 0x57, 0x7D, 0x1A, 0xBE, 0x73, 0x41, 0x47, 0xC2, 0x9A, 0x90, 0x22, 0xA3, 0x5C, 0xB0, 0x8B,
+    0xB8, 0x4D, 0xB0, 0x87, 0x81, 0x41, 0xF4, 0x2A, 0x09, 0xF4, 0x54, 0x70, 0x32, 0x82, 0x22, 0xE7,
+    0xB7, 0x9C, 0x9C, 0x9C, 0x73, 0x0B, 0xC7, 0x49, 0x22, 0x10, 0x52, 0x65, 0x43, 0xEF, 0x86, 0x26,
+    0xA6, 0x26, 0xD6, 0x6A, 0x0F, 0x42, 0xBC, 0xA9, 0x62, 0x4D, 0x79, 0x19, 0x95, 0x94, 0xEA, 0xB0,
+    0xFB, 0xCC, 0x1A, 0x84, 0xD3, 0x55, 0xC2, 0xDA, 0xF2, 0x2C, 0xBD, 0xDF, 0x25, 0x7D, 0x00, 0x97,
+    0xC6, 0x4F, 0xDF, 0x34, 0x36, 0xFE, 0x05, 0x16, 0x56, 0x5D, 0xBD, 0x4B, 0x51, 0x48, 0x8D, 0x2A,
+    0x27, 0x8A, 0xCE, 0xA1, 0x88, 0x43, 0x6C, 0x6E, 0xCC, 0x7D, 0x06, 0xD8, 0x1B, 0xA1, 0xC0, 0x21,
+    0xBC, 0x52, 0x3A, 0xD0, 0xBE, 0x91, 0xA5, 0xA8, 0x50, 0xBB, 0x7B, 0x74, 0x7A, 0x1D, 0x6F, 0xCF,
+    0x91, 0x02, 0x4A, 0xA4, 0x96, 0xC6, 0x2B, 0x81, 0x92, 0x8A, 0xEE, 0xCE, 0x7E, 0xD6, 0x7F, 0x06,
+    0xCE, 0xE4, 0x04, 0xFB, 0x35, 0x55, 0x0C, 0x11, 0x69, 0x02, 0x8D, 0xE0, 0x92, 0x98, 0xAE, 0xD3,
+    0xA7, 0x7D, 0x5A, 0x91, 0x88, 0xE2, 0xD4, 0xFA, 0xDA, 0x6A, 0xF4, 0x70, 0x93, 0xD2, 0x0A, 0xC5,
+    0x24, 0xDF, 0xEE, 0x87, 0x0F, 0xA3, 0xAD, 0x2D, 0x9D, 0x31, 0xF4, 0xD6, 0x90, 0x1D, 0x04, 0x8E,
+    0xE0, 0x4B, 0x86, 0x29, 0xAE, 0x44, 0xC1, 0x1E, 0x33, 0x98, 0xDC, 0xE2, 0xE8, 0xCD, 0x0A, 0x1D,
+    0xFF, 0xA4, 0x8B, 0x1E, 0x35, 0xD1, 0x6E, 0x9D, 0x5E, 0x2C, 0xDF, 0xDB, 0xDE, 0xC6, 0xA9, 0x5D,
+    0x24, 0x80, 0xD4, 0xEE, 0x9F, 0x4D, 0xCE, 0x29, 0x38, 0xDB, 0x5F, 0xB6, 0x4A, 0xEE, 0xBC, 0xAF,
+    0x67, 0x2A, 0x5B, 0x58, 0x86, 0x5A, 0xF5, 0x2A, 0x80, 0x0E, 0x87, 0x49, 0x9A, 0x39, 0x95, 0x7B,
+    0x61, 0x03, 0x2A, 0x2A, 0xC1, 0x3D, 0xB2, 0xC1, 0x90, 0x9F, 0x57, 0x61, 0x7B, 0x38, 0x55, 0x61,
+    0x05, 0x4D, 0xE1, 0xC1, 0x60, 0x30, 0xAF, 0x72, 0x77, 0xCC, 0x60, 0x1E, 0x15, 0xB4, 0xEC, 0x6B,
+    0xF4, 0x1C, 0x6E, 0xBE, 0xA3, 0x48, 0xFE, 0x54, 0xD2, 0xE0, 0x5C, 0x20, 0x1F, 0x17, 0xF5, 0x70,
+    0xA4, 0xB6, 0x5E, 0x16, 0xD5, 0x28, 0xF6, 0xE5, 0xCB, 0x92, 0x36, 0xA3, 0x24, 0x78, 0xD4, 0x78,
+    0x4D, 0x78, 0x68, 0xB5, 0xB5, 0xB5, 0x6F, 0x2D, 0x60, 0x6D, 0x68, 0xCC, 0xA0, 0x20, 0xAF, 0xA5,
+    0xA0, 0x25, 0xB5, 0x49, 0xC7, 0x86, 0xCE, 0xFC, 0x6C, 0x6C, 0xCE, 0x0F, 0x94, 0xAC, 0xFB, 0x3E,
+    0xB6, 0x6D, 0x3F, 0xBC, 0xFC, 0x26, 0x20, 0x22, 0xF6, 0x17, 0x8B, 0x04, 0xE5, 0xE1, 0x30, 0x38,
+    0xB0, 0xDA, 0x9D, 0x8C, 0x31, 0x34, 0x45, 0x68, 0x33, 0x43, 0x69, 0xC1, 0xD8, 0x43, 0x3B, 0xA5,
+    0x87, 0xB7, 0x23, 0x6B, 0x1F, 0x58, 0xFB, 0x17, 0x5A, 0x7F, 0xC1, 0xDE, 0x94, 0x87, 0x96, 0x12,
+    0xE1, 0xA0, 0xC4, 0x9D, 0xE1, 0x21, 0x43, 0x77, 0x98, 0x38, 0x6C, 0x4D, 0x71, 0x8B, 0xAD, 0xD2,
+    0x85, 0x8D, 0x44, 0x80, 0x23, 0xBC, 0x3A, 0xDE, 0xE9, 0xC0, 0x03, 0xA8, 0x08, 0xE5, 0x07, 0xD3,
+    0x6E, 0xEA, 0xF3, 0x1D, 0xA3, 0x85, 0x2B, 0xF2, 0xFE, 0xC9, 0x68, 0x74, 0x8D, 0xD4, 0xCF, 0x99,
+    0x28, 0x27, 0x74, 0x9D, 0x21, 0x32, 0x91, 0xAF, 0xAF, 0xFC, 0x1A, 0x5B, 0xFB, 0xD2, 0x72, 0x7B,
+    0xB4, 0x4C, 0x16, 0xFD, 0x04, 0x37, 0x3B, 0x3A, 0xF1, 0x43, 0x8B, 0x2C, 0x7C, 0x0D, 0xFD, 0x9A,
+    0x2B, 0x5D, 0x90, 0x91, 0xC0, 0x22, 0xEF, 0x90, 0x98, 0xE6, 0x38, 0x85, 0xDA, 0x25, 0x7C, 0xE4,
+    0x8A, 0xE2, 0x3F, 0xCF, 0xFC, 0x2A, 0xB5, 0x0D, 0x98, 0x40, 0xD9, 0xCE, 0xCB, 0x6B, 0xA6, 0x86,
+    0x24, 0xB0, 0x15, 0x90, 0xCC, 0xB5, 0x43, 0xEC, 0x40, 0x2F, 0xB0, 0x4C, 0xF2, 0x45, 0x97, 0xC4,
+    0xB6, 0x93, 0x9D, 0xA8, 0xE3, 0x2C, 0xD8, 0x2D, 0x69, 0x18, 0x61, 0x0F, 0x53, 0x98, 0x05, 0xA6,
+    0xBB, 0xDC, 0xE0, 0xCA, 0x24, 0x42, 0x2E, 0xFA, 0xC4, 0x23, 0x9A, 0x17, 0x3B, 0x40, 0x21, 0xE7,
+    0x3A, 0x74, 0xD5, 0x65, 0x3A, 0x84, 0xF5, 0xEB, 0xA8, 0x6C, 0xC2, 0xFE, 0x62, 0x2D, 0xD0, 0xBD,
+    0x16, 0x61, 0x66, 0x14, 0x16, 0x1C, 0xA9, 0xEC, 0xD7, 0xE3, 0x7D, 0x0A, 0xBE, 0xBB, 0x0B, 0xE7,
+    0xEF, 0x02, 0x5A, 0x25, 0x4A, 0xAF, 0x87, 0xB0, 0x31, 0xC1, 0xAF, 0xDB, 0x2B, 0x68, 0x64, 0x6E,
+    0x81, 0x8A, 0x7E, 0x14, 0xB5, 0x5F, 0x88, 0x0A, 0x3E, 0xA0, 0xDF, 0x15, 0xDC, 0x89, 0x55, 0x21,
+    0x1A, 0x75, 0x98, 0xEB, 0x10, 0x54, 0x75, 0xA2, 0x03, 0x8E, 0xE0, 0x49, 0xBC, 0x03, 0x2E, 0x89,
+    0x11, 0x41, 0x0D, 0x0E, 0xDA, 0x35, 0x34, 0x19, 0x92, 0xFF, 0xD8, 0x00, 0x33, 0xE0, 0x8F, 0xC6,
+    0x63, 0x5E, 0x2B, 0xF8, 0xF8, 0xF1, 0xF3, 0xC6, 0x79, 0x1A, 0xE8, 0x2F, 0x2E, 0x33, 0xED, 0x25,
+    0xD8, 0x0F, 0x40, 0x76, 0xB1, 0x7A, 0xF2, 0x77, 0x77, 0xA9, 0x67, 0x08, 0xEF, 0xE3, 0x26, 0x1D,
+    0x3F, 0xAD, 0xD5, 0x7D, 0x34, 0x51, 0x7B, 0x7A, 0xCA, 0x1A, 0x73, 0x6D, 0x35, 0x63, 0x66, 0xE6,
+    0x24, 0x1C, 0xC8, 0x0D, 0x38, 0xAF, 0xFF, 0x8A, 0xE9, 0x97, 0x51, 0x03, 0x9A, 0xDA, 0x67, 0xD2,
+    0x6E, 0x99, 0xBF, 0xEC, 0x4D, 0xF8, 0xC9, 0xDC, 0xB5, 0xC8, 0x4C, 0x26, 0x98, 0xF1, 0x17, 0xAC,
+    0xDD, 0xB2, 0xDD, 0xAD, 0xFF, 0x98, 0x7E, 0xDB, 0x16, 0xB9, 0x23, 0xBA, 0xFE, 0x61, 0xFA, 0xE5,
+    0x42, 0x33, 0xFC, 0x88, 0x49, 0x61, 0x2A, 0xC6, 0x35, 0x77, 0x0D, 0x8B, 0x14, 0x15, 0xCE, 0x1B,
+    0x18, 0xEA, 0x92, 0xB1, 0x3D, 0xA0, 0x18, 0x17, 0x4B, 0xE6, 0xB9, 0x8F, 0x8E, 0x4C, 0x2C, 0x1E,
+    0xA0, 0x40, 0xAD, 0x3C, 0x18, 0x97, 0x2B, 0x0C, 0x65, 0x06, 0x39, 0xFF, 0x27, 0x6D, 0xF6, 0xD3,
+    0xC4, 0x41, 0x93, 0x01, 0x90, 0x12, 0xA3, 0x25, 0x44, 0x65, 0x5A, 0x87, 0x46, 0xAE, 0x61, 0x4C,
+    0x47, 0x93, 0x97, 0xCC, 0x7C, 0x9A, 0x6E, 0xA6, 0x09, 0xF9, 0xEC, 0xCA, 0xC2, 0x6D, 0x06, 0x31,
+    0x47, 0x28, 0x0F, 0xBC, 0x9A, 0xEB, 0x2E, 0x8C, 0xCB, 0xAF, 0xE3, 0x81, 0x35, 0xAF, 0x54, 0xBF,
+    0x09, 0x3D, 0x92, 0xDF, 0xE8, 0x33, 0x52, 0x7F, 0xBE, 0x42, 0x66, 0xF2, 0xB6, 0xD0, 0x4B, 0x81,
+    0x36, 0x2B, 0x42, 0xDF, 0x53, 0x17, 0xF5, 0x20, 0x28, 0xD2, 0x56, 0x25, 0xA9, 0x57, 0xFF, 0x6E,
+    0x80, 0x09, 0x80, 0x37, 0x72, 0xC9, 0xB5, 0xFB, 0xDE, 0x2D, 0x64, 0x0F, 0x8D, 0xC2, 0xFF, 0x5F,
+    0x15, 0x27, 0xD1, 0xC2, 0xDE, 0xC2, 0x76, 0x42, 0xFF, 0xFB, 0xFC, 0x0B, 0x85, 0x55, 0xB1, 0x6E,
+    0xDD, 0x36, 0x14, 0xBD, 0x92, 0x92, 0x6A, 0xD0, 0xC0, 0x29, 0x28, 0x8A, 0x0C, 0xFC, 0x04, 0xFE,
+    0x41, 0x28, 0xC4, 0x43, 0xC7, 0x64, 0xE8, 0x6B, 0x87, 0x7E, 0x42, 0x87, 0x7C, 0x41, 0x9F, 0x5E,
+    0xE0, 0x21, 0x63, 0xBB, 0x74, 0xCF, 0xD2, 0xC5, 0x8B, 0x7F, 0x20, 0xF6, 0x63, 0xEC, 0x21, 0xAB,
+    0x50, 0x7F, 0x80, 0xD5, 0x36, 0x45, 0x50, 0x2F, 0x61, 0x50, 0x05, 0x50, 0x12, 0x4A, 0xB7, 0xE7,
+    0x50, 0x86, 0x11, 0x77, 0xA9, 0x00, 0x5E, 0x51, 0x24, 0x45, 0xDE, 0x7B, 0xCE, 0xB9, 0x97, 0x22,
+    0x5B, 0xC1, 0xB3, 0xA7, 0xD1, 0x56, 0xA4, 0xD0, 0x20, 0x52, 0xBD, 0xE9, 0x45, 0xEA, 0x8B, 0x41,
+    0xA4, 0x39, 0x8B, 0x22, 0xE6, 0xE9, 0x28, 0x62, 0xDB, 0x24, 0xE2, 0xE5, 0x85, 0xC8, 0x03, 0xFE,
+    0x72, 0x82, 0xBE, 0x24, 0x71, 0x6D, 0x31, 0x89, 0xD9, 0x55, 0xAA, 0x1A, 0x68, 0x86, 0x06, 0x26,
+    0x9A, 0xBF, 0x36, 0xDF, 0x8D, 0x36, 0x48, 0x35, 0xB9, 0x20, 0x65, 0xF2, 0x3B, 0x29, 0x66, 0x1E,
+    0xD0, 0xE9, 0x84, 0xA6, 0xED, 0x56, 0x6C, 0xD8, 0x4A, 0x35, 0x6C, 0xA5, 0x8C, 0x68, 0x03, 0xFB,
+    0xDD, 0xD1, 0x71, 0xE8, 0x74, 0xE1, 0xFC, 0x6E, 0x2B, 0xF5, 0x88, 0x33, 0x12, 0xCF, 0xB9, 0x6E,
+    0xA7, 0x68, 0xCB, 0x56, 0x9A, 0x19, 0xF3, 0x6C, 0x09, 0x2D, 0x62, 0x7D, 0x2B, 0xF9, 0x29, 0x8E,
+    0x27, 0xB8, 0x0E, 0xDF, 0x31, 0x23, 0x1E, 0x8E, 0x1B, 0xB8, 0x5C, 0xF2, 0x50, 0x8F, 0x15, 0x35,
+    0x82, 0x90, 0x53, 0x34, 0x83, 0xB8, 0xE0, 0xF5, 0x75, 0x67, 0x91, 0x75, 0x9D, 0xE8, 0x20, 0x77,
+    0x8C, 0x7E, 0xFC, 0x21, 0x70, 0xE3, 0x1C, 0x8B, 0xCD, 0xFB, 0x70, 0xC3, 0x4E, 0x5F, 0xE7, 0x13,
+    0xEE, 0x6D, 0x72, 0x00, 0x1F, 0x68, 0xB4, 0xA7, 0x19, 0x81, 0xC3, 0xFD, 0x99, 0x60, 0x28, 0x8D,
+    0x47, 0x48, 0x62, 0x7B, 0x18, 0x83, 0x80, 0xA4, 0x41, 0x64, 0x38, 0x98, 0x66, 0xBC, 0x65, 0x0C,
+    0x8D, 0x8B, 0xDD, 0xE6, 0x7B, 0x06, 0x80, 0xBD, 0x68, 0x78, 0xF2, 0xB2, 0x6E, 0xDA, 0xE9, 0xDF,
+    0x6B, 0x4C, 0xF8, 0x3A, 0xC3, 0x68, 0xA3, 0x57, 0xCF, 0x1D, 0x3E, 0x81, 0x7C, 0x45, 0x32, 0x02,
+    0x69, 0xC0, 0x99, 0x1A, 0xE1, 0x69, 0x30, 0xAA, 0x39, 0xC4, 0x74, 0x7B, 0x76, 0xDE, 0x6C, 0x30,
+    0xBB, 0x60, 0x36, 0x21, 0x8A, 0xC8, 0x13, 0x30, 0x8A, 0xA1, 0x41, 0x75, 0xEA, 0x1E, 0x8B, 0xDD,
+    0x49, 0x3D, 0x48, 0x81, 0xE0, 0x7F, 0x84, 0x33, 0x3A, 0x83, 0xB6, 0x87, 0x70, 0xE5, 0x34, 0xE3,
+    0x05, 0x70, 0x2A, 0xCC, 0x00, 0x3D, 0x30, 0x67, 0x06, 0xD0, 0x98, 0xB1, 0x5A, 0x3F, 0x08, 0xF6,
+    0x63, 0x91, 0xFB, 0xA0, 0xA9, 0xE0, 0xB6, 0xF5, 0xD2, 0x16, 0xBB, 0x8C, 0xA2, 0x25, 0xA6, 0x9E,
+    0xE7, 0x60, 0xE5, 0x0A, 0xFC, 0x2D, 0x53, 0xFC, 0x4A, 0xA3, 0x0B, 0x3E, 0x9F, 0x2C, 0xD4, 0xC4,
+    0x47, 0x2C, 0x2E, 0xA2, 0x1B, 0xA1, 0x02, 0xAB, 0x47, 0xC7, 0x31, 0x6B, 0x87, 0xF0, 0x8F, 0xB2,
+    0x87, 0xA7, 0xF2, 0x05, 0xD1, 0xE6, 0x73, 0x82, 0xDF, 0x4B, 0x1C, 0x91, 0xE8, 0x59, 0xCC, 0x1E,
+    0xD2, 0xB9, 0x03, 0x3A, 0x99, 0x9D, 0xA5, 0x6B, 0x3D, 0x5D, 0x3C, 0xA0, 0xAB, 0xD9, 0x65, 0xAF,
+    0x39, 0x58, 0xD5, 0x43, 0x5D, 0x81, 0xD0, 0xC9, 0x5F, 0x1D, 0xED, 0xA3, 0x02, 0xD8, 0xF3, 0x04,
+    0xB1, 0x98, 0x28, 0x75, 0x82, 0x07, 0xF6, 0x1D, 0x87, 0xF0, 0x3E, 0x8F, 0xC9, 0x9B, 0x1B, 0xF3,
+    0xE8, 0x62, 0x9C, 0xFD, 0x4F, 0x6F, 0x3E, 0x68, 0x77, 0x19, 0x29, 0x20, 0xC8, 0x79, 0x0F, 0x2D,
+    0x83, 0x57, 0x71, 0xB9, 0x3B, 0x49, 0x33, 0x88, 0xDB, 0x01, 0x19, 0xE0, 0x83, 0x23, 0xE1, 0xD6,
+    0x4C, 0xDC, 0xE0, 0x10, 0xBA, 0x89, 0x74, 0x80, 0x8D, 0x7D, 0xD1, 0x24, 0xA3, 0xBD, 0x57, 0xD1,
+    0xB1, 0x52, 0x29, 0x5A, 0xE0, 0xDE, 0xC4, 0x72, 0xC4, 0x8E, 0x27, 0xF8, 0xCF, 0x3D, 0x4C, 0x58,
+    0x85, 0xFF, 0xE8, 0x57, 0xEA, 0x10, 0x01, 0x43, 0x79, 0x1B, 0xA4, 0x86, 0xC6, 0x0A, 0x05, 0xA3,
+    0xDD, 0x44, 0x82, 0x5A, 0x69, 0x80, 0x4A, 0xF9, 0x11, 0x9D, 0xC5, 0x8F, 0xE2, 0x0F, 0xB5, 0x35,
+    0x43, 0x37, 0x56, 0x63, 0xA3, 0xED, 0x8C, 0xAD, 0x7D, 0x6B, 0x98, 0xBD, 0x82, 0x6C, 0x24, 0xB7,
+    0x9F, 0xBD, 0xE0, 0x61, 0xC9, 0x57, 0x2B, 0x44, 0x10, 0x2F, 0x52, 0xEB, 0x6F, 0xBF, 0xB2, 0x76,
+    0x0A, 0x20, 0xF6, 0x0F, 0x60, 0xBA, 0x7E, 0xAD, 0xC8, 0xFB, 0x5E, 0xCA, 0x45, 0x20, 0x1E, 0x33,
+    0xD5, 0x84, 0x69, 0xB0, 0x08, 0x17, 0x6A, 0x85, 0xD7, 0x5A, 0x90, 0xA7, 0x54, 0xBF, 0x8D, 0xD5,
+    0xA7, 0xE8, 0xBA, 0xDE, 0x5E, 0x86, 0x93, 0x6E, 0xA7, 0xBE, 0x9C, 0xB4, 0x7A, 0x3F, 0x37, 0x7F,
+    0x2C, 0xEE, 0xD5, 0xE8, 0x9E, 0x25, 0xB5, 0xFD, 0x62, 0x3E, 0x8D, 0xFB, 0xC3, 0x64, 0xF5, 0x6C,
+    0x31, 0xD1, 0x2F, 0xCD, 0xE4, 0xC3, 0x7E, 0x74, 0x88, 0x58, 0x83, 0x9E, 0xA7, 0x6A, 0xA9, 0xC0,
+    0x45, 0x1D, 0x0D, 0xC9, 0x10, 0x4F, 0x20, 0x24, 0xAB, 0x15, 0x39, 0x07, 0xA6, 0xC3, 0xBE, 0x15,
+    0x5F, 0x2D, 0x24, 0x3F, 0x81, 0x07, 0x3F, 0x81, 0x09, 0xE0, 0xD2, 0x55, 0x3A, 0x94, 0xC9, 0x5C,
+    0x86, 0x66, 0xE8, 0xFC, 0xCE, 0x3D, 0x05, 0x76, 0xA7, 0x75, 0x5C, 0x50, 0x71, 0x5E, 0x26, 0x33,
+    0xEC, 0x21, 0x89, 0x87, 0xA9, 0x8E, 0x73, 0x13, 0xCD, 0xC5, 0xE8, 0x83, 0xBB, 0xEC, 0xB5, 0xF5,
+    0xFB, 0x83, 0x19, 0x0E, 0x43, 0xAB, 0x1A, 0x7D, 0x5F, 0xE2, 0xF0, 0x16, 0x8C, 0x40, 0x65, 0xAF,
+    0x73, 0xAE, 0x49, 0xA9, 0xBF, 0x68, 0x5F, 0x27, 0xB1, 0x91, 0xD2, 0x98, 0xEC, 0x75, 0xE9, 0x92,
+    0x99, 0x09, 0x75, 0x4A, 0xB3, 0xA5, 0xE9, 0x58, 0x30, 0x3D, 0x7B, 0x0F, 0xD6, 0x31, 0xE0, 0xBE,
+    0x10, 0xA7, 0xD9, 0x2E, 0x9B, 0x27, 0x29, 0x2B, 0xAD, 0xA6, 0x92, 0x4B, 0x26, 0x37, 0x95, 0xDC,
+    0xAE, 0x67, 0xF0, 0xB1, 0xB9, 0x02, 0x2E, 0xC5, 0xFB, 0x6F, 0xE7, 0x26, 0x48, 0x72, 0x48, 0xC1,
+    0x17, 0x52, 0xFF, 0x06, 0x4D, 0x3D, 0x0A, 0x25, 0x53, 0xB5, 0x87, 0x58, 0x91, 0x02, 0x3B, 0x66,
+    0x1A, 0x77, 0x86, 0xCE, 0x99, 0x7E, 0xFC, 0xEC, 0x40, 0x28, 0x70, 0x80, 0x87, 0x70, 0x31, 0x4B,
+    0xF6, 0xFA, 0x29, 0x98, 0x27, 0x35, 0x33, 0xA6, 0xFE, 0x50, 0x28, 0xAA, 0x0C, 0x94, 0x99, 0x13,
+    0xB8, 0xE0, 0xD2, 0xC0, 0x2D, 0x22, 0x5D, 0x3D, 0x41, 0x48, 0xE2, 0x9E, 0x61, 0xAB, 0xFA, 0xF7,
+    0x89, 0x5A, 0x61, 0x24, 0xDB, 0x3C, 0xF8, 0x35, 0x6B, 0x07, 0x32, 0xE8, 0x2B, 0xAC, 0x1C, 0x8C,
+    0x26, 0xA6, 0x22, 0x74, 0x45, 0x1D, 0x58, 0x1A, 0xA6, 0xFA, 0x0E, 0x61, 0x68, 0x4E, 0xF4, 0xF5,
+    0xA2, 0x60, 0x51, 0x75, 0x64, 0xAB, 0xD8, 0xB4, 0x77, 0xBF, 0xC1, 0xFF, 0x88, 0x8D, 0xE5, 0xC8,
+    0xE0, 0x4C, 0x23, 0x75, 0xB0, 0x52, 0xF5, 0x68, 0x83, 0x85, 0xE4, 0x2D, 0xAA, 0x83, 0x3B, 0xD2,
+    0xE0, 0x50, 0xE5, 0x50, 0x6E, 0xD0, 0xC0, 0x47, 0x70, 0xC1, 0xEF, 0x9A, 0xC1, 0x07, 0xD0, 0xBA,
+    0x36, 0x50, 0x55, 0x43, 0x1D, 0xCC, 0xCB, 0xDC, 0xE6, 0xB5, 0x06, 0x78, 0xFC, 0x25, 0x2C, 0x90,
+    0xA5, 0xFE, 0x7C, 0x27, 0xE3, 0x91, 0x8B, 0xDD, 0xE7, 0x26, 0x5F, 0x04, 0xF9, 0x3A, 0xE8, 0x50,
+    0xB9, 0x89, 0x06, 0x98, 0xFB, 0x32, 0xFB, 0xE8, 0xB9, 0xDE, 0xB2, 0xEA, 0xDB, 0x19, 0xF9, 0xE7,
+    0x67, 0x96, 0x98, 0xCC, 0xD3, 0xE8, 0x58, 0x24, 0x58, 0x29, 0x5A, 0x84, 0xF6, 0xFC, 0xA6, 0xEC,
+    0xEA, 0x3B, 0x46, 0xFE, 0x4A, 0x8F, 0xAF, 0x74, 0x2D, 0xA7, 0xF9, 0xCE, 0xC8, 0x07, 0x99, 0x5C,
+    0xDF, 0x6E, 0x0D, 0x11, 0x40, 0xE9, 0x88, 0x03, 0x87, 0xEA, 0x9B, 0x21, 0xDE, 0xA9, 0xF9, 0x0A,
+    0x6A, 0x08, 0x9A, 0x63, 0x75, 0x84, 0x96, 0xF3, 0xD0, 0x3D, 0x91, 0xBB, 0x07, 0x09, 0xA9, 0x05,
+    0x7D, 0xB9, 0x3F, 0x27, 0x8C, 0xB1, 0x73, 0x81, 0x3B, 0x8C, 0x1D, 0x7B, 0xD3, 0x39, 0x1F, 0xB1,
+    0x29, 0x64, 0xF0, 0xDF, 0x0E, 0xA6, 0xCE, 0xF0, 0x7B, 0x72, 0x83, 0x74, 0x2F, 0xF5, 0x6A, 0x3F,
+    0x91, 0xA4, 0x96, 0xA2, 0xAB, 0xC9, 0x5B, 0x73, 0x73, 0x2F, 0xFE, 0xEF, 0xF3, 0x2F, 0x75, 0x55,
+    0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xB6, 0x45, 0x06, 0x61, 0xC1, 0xA4, 0x60, 0xDB, 0x0C, 0x65,
+    0x24, 0x42, 0xE6, 0x0F, 0xBC, 0x7D, 0xE3, 0xC0, 0x0F, 0x48, 0x93, 0xAD, 0xF8, 0x03, 0x7C, 0x49,
+    0x4B, 0x41, 0x91, 0xE2, 0xED, 0xDA, 0x49, 0x8A, 0x94, 0x20, 0x21, 0xFE, 0x01, 0x15, 0x29, 0x42,
+    0x41, 0xB1, 0x48, 0xBB, 0x6B, 0xEF, 0x6E, 0x49, 0x63, 0x11, 0x51, 0x51, 0x30, 0x21, 0x51, 0x9A,
+    0x14, 0x19, 0xB1, 0x46, 0x72, 0x92, 0xB1, 0x2F, 0xE7, 0xDA, 0x6F, 0x37, 0xDB, 0x60, 0x3D, 0xCD,
+    0x9D, 0xF1, 0x1B, 0xDF, 0x8F, 0x33, 0xE7, 0xDC, 0x21, 0xC2, 0xA3, 0x1B, 0x22, 0x73, 0xDC, 0x13,
+    0xE5, 0xBE, 0x24, 0xCA, 0x3A, 0xDD, 0x52, 0x12, 0x33, 0xAC, 0x47, 0xC2, 0xBA, 0x2C, 0xB0, 0xB6,
+    0x4D, 0x16, 0x49, 0x7B, 0xAA, 0x29, 0xEF, 0x60, 0xB1, 0xC8, 0x62, 0x32, 0x12, 0xD5, 0x45, 0x5D,
+    0x90, 0xF1, 0xAE, 0xC1, 0xDA, 0x7A, 0xAC, 0x6F, 0x76, 0xF0, 0xC5, 0x11, 0x6E, 0x18, 0x7F, 0x53,
+    0xCD, 0x85, 0xAC, 0x1B, 0x59, 0x7B, 0x59, 0xE3, 0x6F, 0x27, 0x31, 0xD3, 0x7E, 0x98, 0x42, 0xFF,
+    0xDE, 0x8B, 0x71, 0x79, 0xC0, 0x98, 0x44, 0x83, 0x8D, 0xC8, 0xC2, 0x15, 0xF2, 0xAE, 0x18, 0x25,
+    0xB3, 0x98, 0x46, 0x2A, 0x2B, 0x15, 0x54, 0xC8, 0x98, 0x5C, 0xA5, 0x5B, 0x33, 0xD2, 0x80, 0x09,
+    0x47, 0x15, 0xA8, 0xCE, 0x5F, 0xF7, 0xB6, 0x49, 0xA3, 0xFB, 0x2D, 0x8C, 0xA4, 0xFE, 0x19, 0xF5,
+    0x13, 0x64, 0xF7, 0xA2, 0x73, 0x7F, 0x35, 0xE4, 0xB8, 0x29, 0x19, 0x01, 0x07, 0xE2, 0x9E, 0x12,
+    0x0E, 0x29, 0xE2, 0x67, 0x5C, 0x29, 0x24, 0xA4, 0x07, 0xD2, 0xC8, 0xD0, 0x05, 0xB2, 0x12, 0x76,
+    0x46, 0x20, 0xE9, 0xB2, 0x40, 0x59, 0x48, 0xFB, 0x29, 0x28, 0xD9, 0x0A, 0xB5, 0xA3, 0x7A, 0x5B,
+    0x0D, 0xEB, 0x2C, 0xD5, 0xEB, 0x20, 0x55, 0xB4, 0xD8, 0x2E, 0xF5, 0x90, 0x54, 0x96, 0x9C, 0x57,
+    0xA6, 0x19, 0x95, 0xD9, 0x27, 0x70, 0x5B, 0x1E, 0x8F, 0xF2, 0x27, 0x17, 0x29, 0x53, 0xD9, 0x28,
+    0xB8, 0x0A, 0x1A, 0x4E, 0x7B, 0x84, 0x53, 0x03, 0x6A, 0xCF, 0xFF, 0x86, 0xB3, 0x88, 0x20, 0xB6,
+    0xAA, 0x11, 0x30, 0xEB, 0x00, 0xB3, 0x6D, 0x50, 0xF9, 0x00, 0xC8, 0xF3, 0x50, 0x23, 0xB1, 0x6F,
+    0x3D, 0xA5, 0x82, 0xA1, 0xE6, 0x0A, 0x15, 0x48, 0x58, 0xC1, 0xD2, 0x49, 0xAC, 0x78, 0x71, 0x52,
+    0x62, 0x92, 0xC7, 0x75, 0x42, 0x7A, 0x02, 0x9D, 0x39, 0x26, 0x32, 0xD0, 0x34, 0x7C, 0xF1, 0xD3,
+    0x43, 0xC1, 0xD7, 0x76, 0x02, 0x3D, 0x32, 0x4F, 0xC5, 0x61, 0x2E, 0xCE, 0xAC, 0xBC, 0x17, 0xD7,
+    0xA9, 0x7C, 0x9B, 0xB3, 0xBC, 0x8A, 0xEB, 0x03, 0x4A, 0xA5, 0xC8, 0x5C, 0xB6, 0x5A, 0xD9, 0x5A,
+    0xC2, 0x55, 0x27, 0x43, 0x2F, 0x43, 0x94, 0x61, 0x48, 0xB6, 0x6E, 0x70, 0x28, 0xA3, 0xA5, 0xBC,
+    0x49, 0x03, 0xED, 0x93, 0x05, 0x6A, 0xC0, 0x2F, 0xE2, 0x70, 0x31, 0xF1, 0xD4, 0xD3, 0x92, 0x74,
+    0x95, 0xF9, 0xA4, 0xA3, 0x1D, 0x32, 0x85, 0x6A, 0x31, 0x91, 0x5D, 0xEB, 0xED, 0xEE, 0x7C, 0x3B,
+    0x6B, 0xBE, 0xC7, 0xFE, 0x32, 0xBD, 0x4D, 0x59, 0x41, 0x81, 0xAE, 0x91, 0xAA, 0x60, 0x3E, 0x9A,
+    0xCD, 0x26, 0xF6, 0xC3, 0x2C, 0x61, 0xF0, 0xFD, 0xB9, 0xD1, 0x45, 0xDA, 0xD0, 0x07, 0x44, 0x1B,
+    0xB7, 0x34, 0x67, 0xDC, 0x5C, 0x8C, 0x31, 0x47, 0x9D, 0xC3, 0xBF, 0x49, 0x68, 0x9D, 0xE2, 0x14,
+    0xFC, 0x7C, 0xEB, 0xCE, 0xF9, 0x56, 0x49, 0x21, 0x00, 0xAD, 0xAB, 0x94, 0x76, 0x64, 0xBA, 0xC4,
+    0xFF, 0x72, 0x8D, 0xBE, 0x79, 0x6B, 0x6B, 0x0B, 0xF8, 0x33, 0x9F, 0x4A, 0xE1, 0xC2, 0x91, 0x4D,
+    0xD9, 0x1F, 0xE8, 0x33, 0x99, 0x5F, 0x1A, 0xBE, 0x4E, 0x99, 0x8B, 0xC3, 0x4F, 0x3B, 0x5D, 0x98,
+    0xBB, 0x70, 0xB2, 0x20, 0x7D, 0xD2, 0xD0, 0xFE, 0x6C, 0xE2, 0x92, 0xCA, 0x13, 0x80, 0x64, 0x98,
+    0xDB, 0x9A, 0x77, 0x92, 0xFA, 0x9E, 0x50, 0x9F, 0xE4, 0x7C, 0xC2, 0xAC, 0x36, 0xF7, 0x66, 0x89,
+    0x0A, 0xC9, 0xE6, 0x4F, 0xE9, 0x90, 0x63, 0xCA, 0xCF, 0x22, 0xF8, 0xD2, 0x9B, 0x26, 0x09, 0x25,
+    0x65, 0x8F, 0xA1, 0xB8, 0xFB, 0xA8, 0x5E, 0xA3, 0x42, 0x57, 0x99, 0x86, 0x9F, 0x8F, 0x38, 0x5F,
+    0xC8, 0x80, 0x67, 0xCA, 0xBD, 0x3F, 0x73, 0xB7, 0xF6, 0x8A, 0x83, 0xF6, 0x97, 0x6D, 0x21, 0x6E,
+    0x97, 0x92, 0xA8, 0xFC, 0x96, 0xA2, 0x20, 0x82, 0x26, 0xC1, 0x4C, 0x85, 0xE2, 0xB6, 0x5F, 0xCE,
+    0xDB, 0x85, 0x4D, 0xC2, 0x16, 0x4C, 0x17, 0xF3, 0x52, 0x35, 0xF4, 0xA3, 0x21, 0x3B, 0xAC, 0x20,
+    0xD9, 0x60, 0x6F, 0x70, 0x13, 0x88, 0xF3, 0x2A, 0x8D, 0x40, 0xDF, 0x03, 0x8F, 0x7B, 0x2D, 0x1D,
+    0xA2, 0xF2, 0xDE, 0x7D, 0x57, 0x7A, 0x9C, 0x7D, 0x03, 0x3C, 0x20, 0xEB, 0x7D, 0xDA, 0x7E, 0x3C,
+    0x8B, 0x07, 0x21, 0x0C, 0xB7, 0xAA, 0xCD, 0xA9, 0xA3, 0xC5, 0x15, 0xCA, 0x8E, 0x5F, 0xF1, 0xE8,
+    0x98, 0x9F, 0xFC, 0x31, 0xA5, 0x01, 0x84, 0x21, 0x56, 0x30, 0xF4, 0x87, 0xAF, 0x72, 0x7C, 0x2C,
+    0xAD, 0xE1, 0x43, 0x28, 0x6A, 0xBB, 0x2A, 0x3D, 0x8E, 0x48, 0x52, 0x41, 0x41, 0x91, 0x59, 0xB5,
+    0xF8, 0x7C, 0x73, 0x3E, 0x9B, 0x9E, 0x76, 0xC9, 0x54, 0xCA, 0x4F, 0x13, 0x08, 0xB1, 0xFE, 0xA4,
+    0x75, 0xE3, 0x4A, 0x3F, 0xE7, 0xA3, 0x90, 0x23, 0x2B, 0x77, 0xD2, 0x24, 0x71, 0x41, 0x66, 0x36,
+    0xF6, 0xC4, 0xAB, 0x68, 0xA6, 0xBC, 0x22, 0xA0, 0xA9, 0xF2, 0x0E, 0xA7, 0x65, 0x0A, 0xB4, 0xB1,
+    0x77, 0x13, 0x86, 0x0A, 0x3C, 0x42, 0x26, 0x35, 0x78, 0xBC, 0x01, 0xAC, 0x91, 0x08, 0xF8, 0xAD,
+    0x8B, 0x73, 0x13, 0x66, 0x24, 0xC2, 0xE7, 0x64, 0xCA, 0x01, 0xC2, 0xE9, 0x4C, 0x30, 0x77, 0x22,
+    0xAD, 0x6C, 0x91, 0x1D, 0x07, 0x5A, 0x58, 0xCA, 0x1E, 0x81, 0x86, 0xEE, 0xCC, 0x28, 0xF4, 0x97,
+    0x43, 0x57, 0xE4, 0xDE, 0xEA, 0x47, 0xFF, 0x8E, 0x53, 0xF9, 0x57, 0xD4, 0x1D, 0x7F, 0x5B, 0x86,
+    0x3D, 0x9B, 0x9F, 0x84, 0xE8, 0xD0, 0x2C, 0x51, 0xCB, 0xA1, 0x34, 0x4B, 0xA6, 0xB3, 0xE7, 0xAA,
+    0x14, 0xBA, 0xB8, 0x30, 0x00, 0xF3, 0xD5, 0x7A, 0xA8, 0xE8, 0xB6, 0x24, 0xB6, 0x87, 0x7C, 0x54,
+    0x67, 0x84, 0xD0, 0x1B, 0xC5, 0x59, 0x8A, 0x06, 0x2D, 0x26, 0x5C, 0x34, 0x69, 0x58, 0x92, 0x05,
+    0xA1, 0x4F, 0xD1, 0xBB, 0x0E, 0x26, 0x39, 0xA3, 0xAD, 0xE0, 0x13, 0x08, 0x89, 0xB2, 0x53, 0xB0,
+    0xDD, 0x84, 0x2C, 0xD4, 0x8D, 0x4B, 0x39, 0x0B, 0xD2, 0x10, 0x56, 0x49, 0xC8, 0x1B, 0x4B, 0x7D,
+    0xE6, 0x75, 0xB5, 0x49, 0x5D, 0xD6, 0xEA, 0x62, 0x27, 0xE9, 0x54, 0x6B, 0x26, 0xC3, 0x66, 0x28,
+    0xFB, 0xFC, 0x7E, 0x8F, 0x4E, 0x7E, 0xBD, 0x1E, 0x20, 0x76, 0x7E, 0x36, 0xBC, 0x3A, 0x40, 0x67,
+    0x67, 0xDA, 0x83, 0x7C, 0x3A, 0x0A, 0x0E, 0xFC, 0xCC, 0x8E, 0x7A, 0xD1, 0xB7, 0x12, 0xAD, 0x2C,
+    0x00, 0x8C, 0x4F, 0xC2, 0x01, 0xB4, 0xA0, 0x4E, 0x44, 0x43, 0xF6, 0x66, 0x03, 0xD1, 0x1C, 0x4C,
+    0x82, 0xEE, 0x26, 0xB5, 0xB5, 0xEF, 0x19, 0x0F, 0x24, 0x5B, 0xD3, 0x95, 0x09, 0xC8, 0x6C, 0x8B,
+    0xFC, 0x2E, 0xE4, 0x07, 0xF5, 0x01, 0xD0, 0x7D, 0x57, 0x68, 0x7C, 0x16, 0x61, 0x1E, 0x75, 0x34,
+    0xAC, 0x0D, 0x6D, 0x7B, 0xB2, 0xEC, 0xF5, 0xD3, 0xED, 0x1B, 0x81, 0x56, 0x4B, 0x80, 0xDD, 0xD2,
+    0x72, 0x93, 0xD2, 0x53, 0xDC, 0x3B, 0x58, 0x01, 0xF3, 0x03, 0x33, 0xCA, 0x01, 0x77, 0x29, 0x0F,
+    0xA4, 0x46, 0x4A, 0xD2, 0x5F, 0xE9, 0xBA, 0x1B, 0xD1, 0xAC, 0x76, 0x91, 0xEA, 0x02, 0x17, 0xC1,
+    0x9E, 0x68, 0x66, 0x97, 0xD4, 0x51, 0x24, 0x83, 0xE5, 0x0A, 0x30, 0xF8, 0xFA, 0x65, 0xFD, 0x31,
+    0x48, 0xA1, 0x5F, 0x70, 0xB3, 0xB4, 0x31, 0xE9, 0x13, 0xCA, 0xD1, 0xD7, 0x20, 0x93, 0x33, 0xE9,
+    0x4D, 0xB7, 0x8D, 0x3C, 0xC9, 0xD4, 0x10, 0xD1, 0x96, 0x1E, 0x3E, 0x44, 0x05, 0x60, 0x29, 0xE9,
+    0x20, 0x94, 0xCF, 0x5A, 0xF4, 0xE6, 0x00, 0x1D, 0x41, 0xD7, 0xAD, 0x26, 0xD5, 0x65, 0x72, 0xF3,
+    0x95, 0x0F, 0x98, 0x84, 0xCB, 0xB8, 0x5B, 0x02, 0x5D, 0x7A, 0x29, 0x2A, 0x12, 0x0E, 0xA9, 0x3F,
+    0x2B, 0xDC, 0x07, 0x88, 0x50, 0xC2, 0xF5, 0xF5, 0x62, 0xBE, 0x57, 0xDE, 0x69, 0x5F, 0x0F, 0x9A,
+    0x3D, 0xCF, 0x97, 0xCA, 0x34, 0x20, 0x53, 0xDC, 0x09, 0xB8, 0xB4, 0xD0, 0xC7, 0x33, 0x48, 0xA1,
+    0xEE, 0xC1, 0x52, 0x39, 0xEC, 0xC5, 0x44, 0xC9, 0x14, 0xAF, 0x50, 0x5A, 0x22, 0x8D, 0x18, 0xF7,
+    0x8F, 0x6E, 0x77, 0x1F, 0xA0, 0xF9, 0x46, 0xC7, 0x63, 0x52, 0xCF, 0x12, 0xFE, 0x59, 0x7A, 0x86,
+    0x93, 0x2A, 0xBE, 0x7C, 0xF5, 0x3D, 0xF2, 0x80, 0xD2, 0x7B, 0xD1, 0x99, 0xAE, 0x20, 0x17, 0x68,
+    0x06, 0xF4, 0x33, 0xB8, 0xBD, 0x6E, 0x25, 0xDC, 0xE7, 0x42, 0xFF, 0x86, 0xFE, 0xFF, 0xF9, 0x0F,
+    0xA5, 0x55, 0x4D, 0x8B, 0x1C, 0x45, 0x18, 0x7E, 0xAA, 0x2B, 0xB3, 0x9D, 0x6C, 0xCF, 0x6E, 0x2D,
+    0xF8, 0x81, 0x90, 0x8C, 0x2D, 0xB2, 0x07, 0x5D, 0x76, 0xD3, 0xAB, 0xEC, 0x61, 0xD1, 0xD9, 0xE9,
+    0x8E, 0x21, 0x78, 0x91, 0xB0, 0x90, 0xAC, 0x39, 0x7A, 0xF2, 0x20, 0x8A, 0xD9, 0x43, 0x0E, 0x39,
+    0x4C, 0x9C, 0x36, 0x01, 0x15, 0x04, 0x59, 0xFF, 0x81, 0x88, 0x42, 0x0C, 0x82, 0x2B, 0xE4, 0xB0,
+    0x81, 0xDD, 0x9D, 0x4A, 0xE6, 0x10, 0x34, 0x97, 0x8E, 0x47, 0x15, 0x6C, 0x4C, 0xBC, 0xF8, 0x41,
+    0x4A, 0xE8, 0x43, 0x47, 0x7B, 0xA6, 0x7C, 0xAA, 0x27, 0xBB, 0xEC, 0xDD, 0x9A, 0xB7, 0xBA, 0xBA,
+    0xAA, 0xDE, 0x79, 0x3F, 0x9E, 0xF7, 0xA3, 0x57, 0xA0, 0xAE, 0x64, 0x28, 0x57, 0xEA, 0xA5, 0xEA,
+    0x40, 0x0D, 0xF2, 0x7A, 0xB9, 0x65, 0x50, 0x45, 0x5C, 0x0A, 0x59, 0x85, 0xD6, 0x6A, 0x6B, 0x2B,
+    0x65, 0xFF, 0xD5, 0xF1, 0x70, 0x1B, 0x4F, 0x00, 0xCF, 0x01, 0xCF, 0x47, 0x40, 0x57, 0x25, 0x28,
+    0x95, 0x86, 0xF1, 0x33, 0xCF, 0x48, 0x23, 0x33, 0x51, 0x04, 0x1A, 0x15, 0x4F, 0x77, 0x78, 0x1B,
+    0x77, 0x80, 0xA8, 0x02, 0x42, 0x4E, 0xE5, 0x66, 0x89, 0x39, 0x00, 0x57, 0x63, 0x3E, 0xAA, 0x28,
+    0x81, 0x28, 0xC3, 0x14, 0x5E, 0xA1, 0x74, 0x5B, 0x1A, 0xA5, 0x77, 0xA5, 0x09, 0xEE, 0xDA, 0x57,
+    0x73, 0xFF, 0x9E, 0xBD, 0x93, 0x49, 0x4B, 0x95, 0xF5, 0xC3, 0xB3, 0x7F, 0xD8, 0x54, 0xD8, 0x81,
+    0x05, 0xEC, 0x09, 0x3E, 0x76, 0x31, 0x82, 0x34, 0xA2, 0x14, 0xA5, 0x34, 0x18, 0x52, 0x77, 0x4C,
+    0x49, 0xE1, 0x68, 0xAC, 0xC1, 0x2F, 0xC6, 0x6B, 0xC4, 0x7D, 0xBF, 0x97, 0x88, 0x2A, 0xD2, 0xB2,
+    0x50, 0xB9, 0xCA, 0xFD, 0x22, 0xD6, 0x5E, 0xB5, 0x02, 0x61, 0xBA, 0x08, 0x74, 0x89, 0x8E, 0x28,
+    0x44, 0x41, 0x85, 0xDA, 0xCF, 0x62, 0xA8, 0x9B, 0x25, 0xC2, 0x8F, 0x33, 0xC4, 0x3D, 0xA0, 0xC7,
+    0x7F, 0xDB, 0x1C, 0xC2, 0x26, 0x90, 0xCE, 0x64, 0x43, 0x37, 0x68, 0xE4, 0x90, 0x37, 0x06, 0x3D,
+    0xCB, 0x0B, 0x03, 0x9F, 0x3B, 0x37, 0x68, 0x5F, 0x16, 0xDB, 0xA1, 0x58, 0x7B, 0x23, 0x83, 0xA4,
+    0xE6, 0x61, 0xCD, 0xAB, 0x72, 0xC8, 0x12, 0x82, 0x16, 0xF4, 0x52, 0x84, 0x39, 0x3C, 0x6B, 0x4D,
+    0x6C, 0xED, 0x15, 0x02, 0x88, 0x89, 0xAB, 0x88, 0x2B, 0xBC, 0x07, 0x6C, 0x13, 0x81, 0x03, 0x44,
+    0xFE, 0x02, 0x91, 0x41, 0x9C, 0x20, 0xA6, 0x2C, 0xE3, 0xB6, 0x63, 0xF2, 0x48, 0xE3, 0xED, 0x68,
+    0xC3, 0x19, 0x46, 0x26, 0x8E, 0x16, 0xC7, 0xFC, 0xA3, 0xD1, 0x7E, 0x34, 0x96, 0xE7, 0x36, 0x9C,
+    0x70, 0xEC, 0x00, 0xC4, 0x3D, 0x3E, 0x40, 0x0C, 0x45, 0x98, 0x38, 0xF4, 0x45, 0x05, 0xBF, 0x02,
+    0x31, 0xE3, 0x76, 0x4C, 0x2A, 0x75, 0x14, 0x26, 0x8D, 0x7E, 0x12, 0x58, 0xC7, 0x02, 0xC7, 0x3B,
+    0xF8, 0xBA, 0xB9, 0xFE, 0xED, 0x6D, 0x59, 0xCE, 0x34, 0x60, 0xEF, 0x54, 0xBD, 0x41, 0x49, 0xB7,
+    0x70, 0xA2, 0x0A, 0x75, 0xA5, 0xF6, 0x28, 0xD0, 0xDB, 0x24, 0x5F, 0x77, 0x7D, 0xDD, 0x16, 0x29,
+    0x1A, 0x84, 0xEA, 0x00, 0xF5, 0x8D, 0x6F, 0x8D, 0xFA, 0x65, 0x26, 0x3A, 0x8D, 0x78, 0x1A, 0x2B,
+    0x7B, 0xD4, 0x99, 0x46, 0x7C, 0x1A, 0xD1, 0x5F, 0x50, 0xB6, 0x90, 0x84, 0xA3, 0xF7, 0x10, 0x2D,
+    0x38, 0x3A, 0x84, 0xFD, 0x11, 0x95, 0x0E, 0xB1, 0x44, 0x3D, 0x3C, 0x9A, 0xD1, 0xB2, 0x94, 0xC2,
+    0x50, 0xCF, 0x04, 0x08, 0x68, 0x85, 0xD4, 0x9C, 0x19, 0xE0, 0xE5, 0x60, 0x30, 0xC9, 0x4E, 0x5E,
+    0x37, 0x1B, 0x3B, 0x6B, 0xC0, 0x25, 0xD4, 0x68, 0xBA, 0xC0, 0x9D, 0xE7, 0xBD, 0xFD, 0xFD, 0x4B,
+    0x30, 0x85, 0x8C, 0x75, 0xD0, 0x73, 0xAC, 0x63, 0x5D, 0x3D, 0xF8, 0x46, 0xF7, 0xA9, 0x3C, 0xEF,
+    0xA0, 0x2B, 0x18, 0x7E, 0x95, 0x6C, 0x0B, 0xE3, 0x9B, 0x1E, 0x43, 0x6B, 0x98, 0xE5, 0xB7, 0xFE,
+    0x19, 0xEE, 0x4C, 0xC2, 0x4B, 0x50, 0x83, 0xD6, 0x61, 0x20, 0x62, 0xFE, 0xA2, 0xC4, 0xCF, 0xA3,
+    0x14, 0xBB, 0x91, 0xA6, 0xE1, 0xD4, 0x6F, 0xA9, 0x9F, 0x81, 0x75, 0x71, 0xA2, 0x7C, 0xF2, 0x58,
+    0x46, 0x3E, 0xE4, 0x85, 0xCF, 0x03, 0xE1, 0x54, 0x31, 0x8B, 0x94, 0xB5, 0xA9, 0x7C, 0xB0, 0x7F,
+    0x80, 0x31, 0x07, 0xF6, 0xA2, 0x77, 0x6C, 0x7E, 0xDE, 0x39, 0x7D, 0x68, 0x3F, 0x7A, 0x10, 0x1B,
+    0xC4, 0xAD, 0xA2, 0x93, 0x5D, 0x2C, 0xE1, 0x19, 0x64, 0x63, 0x5F, 0x83, 0xC2, 0xF9, 0x98, 0x32,
+    0xD5, 0x74, 0xB8, 0x11, 0xA6, 0x5B, 0x08, 0xBD, 0x0C, 0xDD, 0xE0, 0x3E, 0x2B, 0x86, 0x47, 0x01,
+    0x1D, 0x13, 0x3D, 0x9A, 0x42, 0xD3, 0x98, 0x6E, 0x6F, 0x9E, 0x1B, 0xCA, 0x71, 0xB6, 0xE1, 0xBC,
+    0xDD, 0xD8, 0x43, 0x34, 0x46, 0x19, 0x8B, 0xAA, 0xE7, 0x55, 0xFD, 0x93, 0x15, 0xDE, 0x42, 0x6B,
+    0x12, 0xB7, 0x3F, 0x38, 0xBC, 0xDE, 0x7C, 0x31, 0x99, 0xFD, 0x0E, 0x67, 0x5A, 0xDE, 0x44, 0xD4,
+    0x9C, 0x14, 0x7A, 0xE2, 0x3E, 0x39, 0xFD, 0x3F, 0x5B, 0xED, 0xD9, 0xE6, 0x62, 0x73, 0x71, 0x6A,
+    0x69, 0x25, 0x1A, 0x05, 0x3F, 0x32, 0xAC, 0x89, 0x9F, 0x6C, 0xB2, 0x60, 0x48, 0xEA, 0x7D, 0xD6,
+    0x76, 0x21, 0xCB, 0x1E, 0xE2, 0x0F, 0x8D, 0xC7, 0x25, 0xF2, 0x73, 0x4F, 0x5F, 0xC0, 0x0C, 0xE2,
+    0xAF, 0x56, 0x69, 0xCC, 0xCD, 0xB5, 0xB7, 0xE9, 0x6D, 0x97, 0x7E, 0x52, 0x90, 0xAE, 0x83, 0x83,
+    0xB9, 0x6B, 0xD7, 0x78, 0x33, 0x70, 0x20, 0xD5, 0x8A, 0xBF, 0x3F, 0x75, 0xE4, 0xD9, 0xD7, 0x16,
+    0x3F, 0x9A, 0x1D, 0x98, 0x33, 0xCD, 0xCF, 0x27, 0x5E, 0xF8, 0x79, 0xD2, 0xAB, 0x15, 0xAF, 0x5D,
+    0xB6, 0xA3, 0xB1, 0xAD, 0x62, 0x97, 0xC0, 0x65, 0x91, 0x30, 0x6D, 0x6C, 0x75, 0xD1, 0xDE, 0x46,
+    0xF7, 0x12, 0xB6, 0xE3, 0x57, 0xCA, 0xC8, 0x9A, 0xC0, 0x6A, 0x71, 0xA3, 0x4E, 0x06, 0x87, 0x0B,
+    0xA5, 0xB7, 0x09, 0xBC, 0x3D, 0x75, 0xEE, 0xB7, 0x64, 0xBC, 0xA9, 0xD3, 0x64, 0x2C, 0xE4, 0xF5,
+    0x2F, 0x98, 0x12, 0x8D, 0x55, 0xC2, 0x92, 0x9D, 0xD0, 0x12, 0x4D, 0xE4, 0xA1, 0x30, 0x6A, 0x38,
+    0xF7, 0x19, 0xA3, 0xB6, 0x81, 0xF4, 0x88, 0x9F, 0x23, 0x17, 0x3A, 0x88, 0x8A, 0x77, 0x13, 0xFF,
+    0xE4, 0x4D, 0x73, 0xBD, 0xCD, 0x10, 0xCB, 0x7C, 0x07, 0xEA, 0x72, 0x81, 0x8E, 0x62, 0x17, 0x8C,
+    0x53, 0x69, 0x46, 0xEC, 0x84, 0x25, 0x62, 0x76, 0x80, 0x2A, 0xD6, 0xD2, 0xD8, 0x24, 0xA6, 0x1F,
+    0x96, 0xEE, 0x54, 0x2F, 0xDB, 0x91, 0xB9, 0x67, 0x7F, 0x1A, 0xA4, 0x67, 0x31, 0x4D, 0x75, 0xB3,
+    0x8F, 0xD4, 0xF6, 0xA5, 0xB6, 0xDA, 0xF4, 0x4D, 0x3B, 0xAE, 0x94, 0x1A, 0xC9, 0x81, 0x4D, 0x4D,
+    0x2F, 0x6F, 0x07, 0xA5, 0xC2, 0x8E, 0xD4, 0x71, 0x62, 0x54, 0x36, 0xCF, 0x8E, 0x23, 0x2A, 0x4F,
+    0xF7, 0xB1, 0x19, 0xEB, 0x05, 0x65, 0x82, 0x93, 0x95, 0x77, 0xD7, 0xE2, 0x7A, 0x3F, 0x5D, 0x88,
+    0xF2, 0x80, 0xD5, 0x38, 0xF8, 0xBB, 0xEA, 0x27, 0x87, 0xBD, 0xE4, 0xA5, 0xA4, 0x89, 0x4F, 0xDF,
+    0x61, 0x37, 0x60, 0x96, 0x2E, 0xA2, 0x76, 0x61, 0x5D, 0xE8, 0xD8, 0x5C, 0x4B, 0x7D, 0xD3, 0x3A,
+    0xB6, 0x34, 0xB5, 0x34, 0xB9, 0x34, 0xB9, 0x3C, 0x15, 0x56, 0x7E, 0x3E, 0x73, 0x08, 0xD3, 0x22,
+    0x93, 0xA6, 0x83, 0x48, 0xE6, 0xA2, 0x88, 0x10, 0xCA, 0x5C, 0xDD, 0xAA, 0xD4, 0x0F, 0xA4, 0x32,
+    0xC8, 0x4A, 0x91, 0x2D, 0xEF, 0x97, 0x17, 0xDD, 0x26, 0x78, 0x5B, 0xEE, 0x95, 0x76, 0x4F, 0x41,
+    0xA6, 0x08, 0x80, 0x1C, 0x7E, 0x82, 0x65, 0x07, 0xEA, 0xD3, 0x60, 0x6E, 0xF9, 0x29, 0x4F, 0x44,
+    0x8E, 0x4D, 0x88, 0x1B, 0xC9, 0x45, 0xD6, 0x62, 0xD1, 0x46, 0xD2, 0x1F, 0x2E, 0x30, 0x29, 0x89,
+    0xF0, 0x8A, 0xAB, 0x44, 0xD6, 0x82, 0xAF, 0x5B, 0x6C, 0x73, 0xD9, 0xF4, 0x32, 0x0B, 0x51, 0x51,
+    0x98, 0x09, 0xDC, 0x37, 0x44, 0x32, 0x8C, 0x5D, 0xAC, 0x5E, 0xAA, 0xD9, 0x5C, 0x05, 0x49, 0xDD,
+    0x70, 0x65, 0xEA, 0x0A, 0xD7, 0x35, 0x45, 0x8E, 0xC7, 0x52, 0x08, 0xA7, 0x8E, 0xF2, 0xA9, 0x9E,
+    0xFF, 0xA4, 0x04, 0xED, 0x94, 0x5E, 0x00, 0x2E, 0xBA, 0x10, 0xFA, 0x29, 0x8D, 0xA0, 0xEA, 0xE5,
+    0x06, 0xFA, 0x43, 0x15, 0x8E, 0x02, 0x7B, 0xF7, 0xD7, 0xF4, 0xBA, 0x0B, 0x30, 0x2D, 0x24, 0x46,
+    0x6D, 0x97, 0x59, 0x7C, 0xA5, 0x8A, 0xC2, 0xE5, 0x59, 0xE4, 0x72, 0x81, 0x2D, 0xED, 0x38, 0x02,
+    0x76, 0x66, 0x2D, 0x46, 0x67, 0x79, 0x1E, 0x59, 0x1D, 0xB1, 0x3D, 0x57, 0x22, 0xD9, 0xEF, 0x2B,
+    0x9E, 0x75, 0xEF, 0x33, 0x2D, 0x8C, 0x3B, 0xC1, 0x11, 0x60, 0xC2, 0x69, 0x7E, 0x32, 0xA5, 0x63,
+    0xEC, 0x7B, 0xD4, 0xEC, 0x19, 0x91, 0x39, 0xBB, 0x99, 0x4A, 0xD8, 0x24, 0x30, 0x33, 0x21, 0x61,
+    0xF0, 0x6D, 0xEE, 0xFC, 0x2F, 0xFD, 0x74, 0x0A, 0x67, 0x61, 0x5C, 0xEB, 0x59, 0xE0, 0x37, 0x68,
+    0x0C, 0x00, 0x0A, 0xF9, 0x09, 0xA8, 0xD9, 0x10, 0x0B, 0x7D, 0x9C, 0x2D, 0x6A, 0xCB, 0x21, 0x10,
+    0xE2, 0xF1, 0x30, 0x71, 0x8C, 0xC6, 0xB5, 0x79, 0x85, 0x1A, 0x82, 0xFA, 0x4B, 0xE2, 0xBE, 0x52,
+    0x59, 0xDD, 0xFC, 0xF7, 0xC6, 0xEA, 0xF8, 0x30, 0x3F, 0xB8, 0x44, 0xB9, 0x33, 0xC8, 0x63, 0xDB,
+    0xE0, 0x87, 0x82, 0x9E, 0xB1, 0xF9, 0xBB, 0x2E, 0xEE, 0xBA, 0x0D, 0x1B, 0xBB, 0xCC, 0xEB, 0x9D,
+    0x57, 0xE2, 0x29, 0x55, 0x1C, 0xCD, 0x7A, 0xB6, 0x44, 0xFF, 0x21, 0xFE, 0xC7, 0xF8, 0x0F, 0xC5,
+    0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D, 0x3D, 0x03, 0x16, 0x3A, 0x85, 0xA5, 0x41, 0xA2, 0xE1,
+    0xDC, 0x22, 0x21, 0xE2, 0x86, 0x82, 0x06, 0xD6, 0x7F, 0x40, 0x0A, 0x2C, 0x3E, 0x82, 0x22, 0x94,
+    0x50, 0x04, 0x3B, 0x20, 0xD1, 0x72, 0x1F, 0x41, 0x81, 0x68, 0x42, 0x89, 0x10, 0xE1, 0x36, 0xB9,
+    0x1F, 0xB0, 0x14, 0x51, 0x63, 0x09, 0xA1, 0xA0, 0xD0, 0xB8, 0x70, 0x71, 0x01, 0xDB, 0xCB, 0x7B,
+    0x7B, 0x97, 0xE8, 0x12, 0x12, 0x02, 0x52, 0x50, 0x76, 0xD7, 0x33, 0x96, 0x77, 0x66, 0xDE, 0xDB,
+    0xD9, 0xD9, 0xB5, 0xE8, 0x44, 0x44, 0xC2, 0x02, 0x42, 0x4D, 0x20, 0xE4, 0x86, 0xFC, 0xDE, 0x9E,
+    0x52, 0x8C, 0x28, 0x1C, 0xAC, 0x95, 0xB3, 0x22, 0xC1, 0x36, 0x5C, 0xC2, 0xAD, 0x52, 0xA4, 0xBF,
+    0x59, 0x89, 0xE8, 0xD5, 0x5A, 0x24, 0x4A, 0x1A, 0x11, 0x23, 0x1F, 0x44, 0xEE, 0xD2, 0x65, 0x1D,
+    0xEF, 0xD2, 0x48, 0x9C, 0x20, 0xB0, 0xCE, 0x03, 0xE7, 0x9C, 0xA5, 0x28, 0xFB, 0x10, 0x95, 0xFE,
+    0x9A, 0x3E, 0xA8, 0x23, 0x2B, 0xC1, 0x24, 0xB6, 0xD2, 0x6B, 0x4C, 0x2E, 0xAA, 0x45, 0xD4, 0x1C,
+    0x18, 0x7D, 0x32, 0xD2, 0x44, 0x5B, 0xA4, 0xB8, 0x23, 0x27, 0xB6, 0xA3, 0xF8, 0xFD, 0xA4, 0xF8,
+    0x42, 0x7E, 0x63, 0xF2, 0xDB, 0x24, 0xBF, 0x1C, 0x2B, 0x8C, 0xC5, 0x93, 0x5C, 0xA7, 0x97, 0xE7,
+    0x37, 0x25, 0x99, 0x93, 0xA4, 0xFD, 0x2B, 0x92, 0x57, 0x09, 0xB4, 0xE2, 0xD1, 0xF0, 0x04, 0x63,
+    0x00, 0x5D, 0x93, 0xB7, 0x67, 0x98, 0x35, 0xB6, 0xB0, 0xBA, 0x85, 0x78, 0xB7, 0x21, 0x16, 0x2E,
+    0x81, 0xCB, 0x42, 0x50, 0x9E, 0x1D, 0xA1, 0x28, 0x81, 0x6F, 0x9C, 0x83, 0x99, 0xF1, 0x62, 0xA3,
+    0xFB, 0x87, 0x7D, 0xFB, 0x2F, 0x19, 0xF2, 0x40, 0x9B, 0xC4, 0xD8, 0x60, 0x85, 0x7D, 0x4F, 0xF6,
+    0xC0, 0xCF, 0x94, 0xD5, 0x5E, 0x83, 0x05, 0x42, 0xD1, 0x1A, 0xF5, 0x19, 0x3A, 0xB7, 0xF3, 0x0A,
+    0x10, 0x84, 0x05, 0x48, 0xE6, 0x95, 0x31, 0x5E, 0xAD, 0xC4, 0x5E, 0x35, 0x11, 0x55, 0xAF, 0xD6,
+    0x0E, 0x05, 0x18, 0x54, 0x5E, 0xF5, 0x0B, 0xAF, 0xB4, 0xD5, 0xDC, 0xF8, 0x38, 0xF1, 0xCA, 0x88,
+    0x06, 0x5B, 0xE9, 0xBC, 0x52, 0x88, 0x5F, 0x4F, 0x61, 0x76, 0xD3, 0x25, 0xC0, 0x10, 0x0F, 0x13,
+    0xF0, 0x6B, 0xA2, 0xC2, 0x2B, 0xA0, 0x40, 0xB5, 0x07, 0xB2, 0xA1, 0xD6, 0x26, 0x74, 0xB5, 0x42,
+    0x92, 0x06, 0x51, 0x35, 0x82, 0xF4, 0x68, 0x63, 0x12, 0x96, 0x1D, 0x5E, 0x3E, 0xF2, 0xBC, 0xF2,
+    0x06, 0x69, 0xF6, 0x5E, 0xB8, 0xE1, 0xB4, 0x13, 0x47, 0x07, 0xB7, 0xF3, 0xD0, 0x66, 0x70, 0xF7,
+    0x49, 0x89, 0x7C, 0x1C, 0x06, 0xCC, 0xDC, 0x37, 0x44, 0x22, 0xC6, 0x13, 0x8A, 0xEB, 0x04, 0xC3,
+    0xC2, 0xCE, 0xBF, 0xF3, 0x01, 0xD4, 0x90, 0x6B, 0xC3, 0x43, 0xB8, 0xC9, 0x3C, 0x23, 0x50, 0x6F,
+    0x62, 0x64, 0x76, 0xD4, 0xBD, 0xE9, 0xC1, 0xA0, 0x6F, 0xB9, 0x50, 0x0F, 0x4E, 0x7B, 0xA6, 0xC1,
+    0x00, 0x02, 0x59, 0xA7, 0xAB, 0x3E, 0x34, 0xFB, 0x29, 0x5D, 0x02, 0x78, 0x09, 0x26, 0x63, 0x3C,
+    0xDA, 0x67, 0xFE, 0x11, 0xE6, 0x60, 0x36, 0x80, 0x19, 0x4C, 0x42, 0x7B, 0x4C, 0x5D, 0x9C, 0x36,
+    0xAE, 0xE2, 0x46, 0x61, 0xCD, 0x48, 0xD6, 0x60, 0x51, 0x54, 0x31, 0x90, 0x73, 0xE8, 0xB3, 0x86,
+    0x34, 0x55, 0x23, 0xE7, 0x9E, 0xB9, 0x1F, 0xAF, 0x09, 0x14, 0xCF, 0x85, 0x62, 0xE4, 0x19, 0x10,
+    0xD2, 0xC8, 0x7C, 0x9B, 0x43, 0xB3, 0x69, 0x9A, 0x00, 0xE4, 0xF9, 0x0C, 0x08, 0xB8, 0xDC, 0x25,
+    0x4C, 0x19, 0x58, 0x36, 0xD2, 0x86, 0x55, 0x58, 0xC7, 0xC5, 0xDC, 0xCA, 0x4E, 0x19, 0xEC, 0x32,
+    0x4E, 0x44, 0xBF, 0xE8, 0xD5, 0x72, 0x65, 0xBF, 0x88, 0x1A, 0x39, 0xAA, 0xB7, 0xB3, 0xDE, 0x49,
+    0xA7, 0x3A, 0xE5, 0xD8, 0x83, 0xD5, 0xA2, 0x7A, 0x3C, 0x77, 0xE5, 0x47, 0xE3, 0xAA, 0x31, 0x7A,
+    0x5F, 0xDC, 0xDB, 0xAA, 0x5B, 0xF3, 0x72, 0x7B, 0xD7, 0x65, 0x9F, 0x2B, 0xFF, 0x97, 0x40, 0x69,
+    0xBC, 0x2F, 0x6F, 0x86, 0x2F, 0xE4, 0xE2, 0x5C, 0xC9, 0x36, 0x64, 0x76, 0x8C, 0x28, 0x80, 0x37,
+    0x15, 0x25, 0x70, 0xA3, 0x52, 0x39, 0x89, 0x2A, 0x8A, 0x64, 0x1D, 0x57, 0x96, 0xB1, 0x1D, 0xC6,
+    0x81, 0x6D, 0xC7, 0x22, 0x32, 0xBF, 0xEA, 0x3F, 0x8D, 0x64, 0x6E, 0xE4, 0x1C, 0x19, 0x86, 0x9D,
+    0x8D, 0xF4, 0xFE, 0xB4, 0x7A, 0x86, 0x3E, 0xD3, 0x28, 0x8E, 0x8C, 0x12, 0xF7, 0xC4, 0x72, 0x2D,
+    0x61, 0xC9, 0xC3, 0x19, 0xE5, 0xA4, 0x83, 0x5B, 0x24, 0xB6, 0xFC, 0x0B, 0x9B, 0x1C, 0x9F, 0x65,
+    0x74, 0x61, 0x6D, 0x27, 0x57, 0xCC, 0x68, 0x12, 0xD6, 0x3C, 0x96, 0x51, 0xC1, 0xCF, 0x59, 0x02,
+    0x6B, 0x1C, 0x40, 0x5A, 0x57, 0xAA, 0x4D, 0x97, 0x9D, 0xE5, 0x61, 0x6E, 0x19, 0x1B, 0x1B, 0x8D,
+    0xD8, 0x9D, 0x3F, 0xEB, 0x05, 0x20, 0xBB, 0xE1, 0x49, 0xBF, 0xCE, 0x5F, 0xC5, 0x55, 0x3D, 0x6E,
+    0xD5, 0x40, 0x10, 0xFE, 0x6C, 0x87, 0x58, 0xC4, 0x52, 0x4C, 0x01, 0x2D, 0x6E, 0x29, 0x08, 0x6E,
+    0x28, 0x28, 0x08, 0x6B, 0x91, 0x03, 0x40, 0x91, 0x9C, 0x23, 0x2D, 0x4D, 0x62, 0x27, 0x17, 0x80,
+    0x86, 0x53, 0xD0, 0xA4, 0x46, 0xE6, 0xD9, 0x49, 0x2E, 0xB0, 0x28, 0x17, 0xB0, 0xF2, 0xA8, 0x68,
+    0x58, 0x24, 0x4B, 0xB8, 0x58, 0xEF, 0x30, 0x63, 0xFB, 0x25, 0x2F, 0x80, 0x22, 0x21, 0x45, 0xC9,
+    0xEA, 0xBD, 0x99, 0x59, 0xEF, 0xFC, 0xED, 0xFC, 0x2D, 0x82, 0xE6, 0x39, 0xB0, 0xA1, 0x35, 0xF0,
+    0xF5, 0x2C, 0x43, 0xF0, 0xDA, 0x02, 0x2B, 0xC8, 0x30, 0xAC, 0x1D, 0x40, 0xF9, 0x3D, 0x60, 0x63,
+    0x8B, 0xC0, 0x28, 0x83, 0xA4, 0xA6, 0x06, 0x79, 0x40, 0xB5, 0x67, 0x63, 0x2A, 0x22, 0xA3, 0x72,
+    0xA4, 0x07, 0xD6, 0x61, 0x16, 0xFE, 0xB4, 0x7E, 0x97, 0x9C, 0x76, 0x71, 0x53, 0x85, 0x46, 0x1D,
+    0xDA, 0x58, 0xF7, 0x91, 0x49, 0x4E, 0xDB, 0xB4, 0x56, 0x6F, 0x34, 0xA1, 0xCA, 0xB7, 0x7A, 0xB8,
+    0x3E, 0x6E, 0x7D, 0x32, 0x4A, 0xB3, 0x3C, 0x65, 0x11, 0x05, 0x3D, 0x58, 0x2F, 0xD6, 0xC4, 0x52,
+    0xC8, 0xF6, 0xE1, 0x75, 0x42, 0xAA, 0xC9, 0xF8, 0xB8, 0x56, 0xE9, 0x1B, 0x90, 0x13, 0xC1, 0xA7,
+    0x8F, 0xA4, 0x43, 0x8B, 0xC4, 0xC4, 0x06, 0x61, 0x97, 0xD4, 0xF0, 0xAD, 0x2A, 0x80, 0x5E, 0x31,
+    0xD7, 0x4C, 0xC0, 0xBE, 0x80, 0x7C, 0x5F, 0x54, 0x08, 0xF5, 0x6A, 0xFC, 0xC6, 0xDA, 0x9C, 0xD2,
+    0xF0, 0xFB, 0xC4, 0xED, 0xEC, 0xB2, 0xD7, 0x44, 0x5D, 0xC8, 0xC0, 0xF8, 0x0C, 0x34, 0x2A, 0xA2,
+    0x6C, 0xB4, 0x31, 0xAE, 0xA0, 0x16, 0x67, 0x58, 0x2D, 0x62, 0xD9, 0x26, 0x02, 0x9E, 0xE1, 0x9A,
+    0x75, 0xCB, 0xFE, 0xAD, 0x08, 0xD8, 0x14, 0x50, 0xF1, 0xDF, 0x9F, 0xB3, 0xBB, 0x11, 0x8E, 0xE4,
+    0xFB, 0xCA, 0x9D, 0x38, 0xE4, 0x37, 0x4F, 0x39, 0x5E, 0xEF, 0x9E, 0xB0, 0x1B, 0xEB, 0x2F, 0x80,
+    0xF5, 0xB0, 0x5D, 0x2A, 0x9F, 0xDB, 0x0E, 0x8E, 0xAC, 0xB8, 0xD8, 0xE3, 0xB4, 0xD5, 0x33, 0x20,
+    0xAD, 0x89, 0x95, 0x09, 0xB8, 0xA3, 0x6C, 0xC5, 0xD9, 0x51, 0x30, 0xD7, 0xA0, 0x02, 0x39, 0x3C,
+    0xAA, 0xC3, 0x5F, 0x26, 0x39, 0xB6, 0x57, 0xAB, 0xC7, 0x6F, 0x46, 0xAC, 0xA6, 0x6D, 0x3B, 0x49,
+    0xD6, 0x23, 0x2E, 0x47, 0x14, 0x5E, 0xCF, 0x65, 0x97, 0xB9, 0x76, 0x5D, 0x3E, 0x14, 0x2E, 0x91,
+    0x70, 0x79, 0x72, 0x4D, 0xD9, 0x1A, 0x90, 0x70, 0x13, 0x22, 0xC1, 0x9C, 0xA5, 0x5C, 0xEA, 0x27,
+    0xAD, 0x83, 0x96, 0xDB, 0x1B, 0x3D, 0xD2, 0x43, 0xEE, 0xBD, 0xC0, 0x78, 0x36, 0x34, 0xA2, 0x38,
+    0xD6, 0xA2, 0x5C, 0x71, 0x91, 0x89, 0x4D, 0x1B, 0xB4, 0x62, 0x84, 0x27, 0x40, 0x31, 0x1C, 0x9F,
+    0x5B, 0x48, 0xAC, 0xD2, 0x1F, 0x5A, 0x86, 0x03, 0xC7, 0x73, 0xA7, 0x32, 0xA2, 0x9C, 0x57, 0x2D,
+    0x36, 0x89, 0xE4, 0x73, 0xC0, 0xB8, 0x19, 0x5D, 0x91, 0x2D, 0x68, 0xD7, 0x49, 0x5D, 0x44, 0x66,
+    0xBA, 0x4C, 0x31, 0x36, 0xDC, 0xE4, 0x7D, 0xA2, 0x47, 0x3C, 0xA5, 0x6B, 0xC1, 0x95, 0x5F, 0xE5,
+    0x4A, 0x27, 0xAE, 0x7E, 0x44, 0x6B, 0xD9, 0x1F, 0xDD, 0xF8, 0x40, 0x78, 0x9B, 0x45, 0x6C, 0x86,
+    0x49, 0xF2, 0xF0, 0xF2, 0xD4, 0x7B, 0x0B, 0x6C, 0xAB, 0x1A, 0xE9, 0xBC, 0x83, 0xEF, 0xD8, 0x81,
+    0xF4, 0x8C, 0x89, 0x9E, 0x89, 0x84, 0x09, 0xEF, 0x82, 0xB0, 0x2C, 0xC8, 0xB3, 0xEB, 0x2F, 0x42,
+    0x8E, 0x52, 0x16, 0x3F, 0x71, 0x08, 0x6D, 0xE2, 0x3E, 0xD1, 0x01, 0x5F, 0xB1, 0x95, 0x22, 0x90,
+    0x9A, 0x92, 0xF4, 0x2F, 0x4A, 0x71, 0x5D, 0xD2, 0x24, 0xBE, 0xBE, 0x94, 0xBB, 0xC8, 0x1D, 0xDA,
+    0xEB, 0x86, 0x88, 0xB7, 0x7D, 0x5B, 0x8E, 0x61, 0x9A, 0x6C, 0xBE, 0x8C, 0xDA, 0xCF, 0x1C, 0xA9,
+    0x0D, 0x1E, 0x76, 0xAB, 0xB8, 0x7F, 0x79, 0xFA, 0x08, 0xB8, 0xB7, 0x65, 0x27, 0x37, 0xE6, 0x93,
+    0x1B, 0xE9, 0x15, 0x37, 0x06, 0xE2, 0x1F, 0x6E, 0x0C, 0x04, 0x1F, 0x9D, 0xB0, 0xB8, 0x4D, 0xF9,
+    0xA1, 0x38, 0xA6, 0xEF, 0x55, 0xC7, 0xF9, 0xA7, 0x4C, 0x7A, 0x24, 0x94, 0x42, 0x88, 0xC8, 0x4D,
+    0x49, 0xDB, 0xF3, 0x0D, 0xA2, 0x86, 0x05, 0x1D, 0x97, 0x57, 0x6C, 0xA6, 0x4C, 0x2F, 0x85, 0xC4,
+    0xBB, 0xD1, 0x90, 0x14, 0x37, 0x94, 0xAB, 0x45, 0x27, 0x46, 0xE7, 0x9D, 0x3C, 0x8C, 0x6C, 0xA2,
+    0xA8, 0xB8, 0x35, 0xF8, 0x0E, 0x8E, 0xFB, 0x89, 0x07, 0x49, 0x1F, 0x74, 0x5C, 0xBE, 0xDC, 0x5E,
+    0xEA, 0x7D, 0xC3, 0x73, 0x86, 0x2B, 0x97, 0x9F, 0x4A, 0x9E, 0xD7, 0x5C, 0xD1, 0x81, 0x13, 0xD9,
+    0x7A, 0xAA, 0xE7, 0x0B, 0x22, 0x97, 0x29, 0x2E, 0x84, 0xB4, 0x8F, 0x3C, 0x89, 0xE5, 0xE2, 0x57,
+    0x7D, 0x40, 0xE5, 0xF0, 0x25, 0xD7, 0x65, 0xD8, 0x96, 0xB0, 0x25, 0x36, 0x4B, 0x3C, 0x1E, 0xA0,
+    0x2D, 0xA3, 0x76, 0x56, 0x69, 0x3E, 0x65, 0x9E, 0x72, 0x49, 0xE4, 0x3F, 0xD7, 0x6F, 0xAD, 0x55,
+    0xBF, 0x6F, 0xE4, 0x44, 0x14, 0xFE, 0xEC, 0xD1, 0xC5, 0x28, 0x3E, 0x32, 0x29, 0xA0, 0xE1, 0x94,
+    0xF5, 0x1F, 0x80, 0x58, 0x37, 0x57, 0xA4, 0xD8, 0x5D, 0x1B, 0x0A, 0x68, 0xAF, 0xA2, 0xE1, 0x5F,
+    0x00, 0x5D, 0x0A, 0x8A, 0x08, 0x36, 0xAC, 0x49, 0x0A, 0x2A, 0xA4, 0x34, 0x88, 0x36, 0x05, 0x15,
+    0x12, 0xCA, 0x15, 0x57, 0x5C, 0x71, 0x89, 0x87, 0xDB, 0x92, 0xC6, 0x51, 0x04, 0x74, 0xC8, 0x10,
+    0xE5, 0x0A, 0x28, 0x18, 0xE9, 0xAC, 0x63, 0x0F, 0xEC, 0x7D, 0x7C, 0x63, 0xE7, 0xB2, 0x10, 0x71,
+    0x88, 0x5C, 0x18, 0x8D, 0xFD, 0xAC, 0xF1, 0xBC, 0xEF, 0xBD, 0xF9, 0xDE, 0x8F, 0x81, 0x07, 0x28,
+    0x29, 0x30, 0xF4, 0x0B, 0x55, 0xF8, 0x46, 0x43, 0xA5, 0x03, 0xBC, 0xE7, 0xD9, 0x70, 0x37, 0x30,
+    0xEF, 0x23, 0xF2, 0x0D, 0xC6, 0x1A, 0xBE, 0xED, 0x23, 0x34, 0x09, 0x62, 0x4C, 0xD2, 0xFB, 0x48,
+    0xDE, 0xB0, 0x88, 0x35, 0x7F, 0x24, 0xAB, 0xBE, 0x6D, 0x72, 0xD9, 0x79, 0x2C, 0xB5, 0xFE, 0x4E,
+    0x52, 0x70, 0x6C, 0xF1, 0x99, 0x11, 0xD1, 0x02, 0x5E, 0xBB, 0x80, 0xDB, 0xDF, 0x23, 0x96, 0x2A,
+    0x3C, 0xCD, 0xD3, 0xCA, 0x9B, 0xF5, 0xA1, 0x77, 0x0C, 0xEA, 0x01, 0xC2, 0x69, 0x2B, 0xF4, 0xB4,
+    0x0C, 0xEA, 0x44, 0xE4, 0x48, 0xA4, 0x09, 0xE5, 0xB7, 0xE2, 0xC6, 0x6C, 0x04, 0xAF, 0x00, 0x06,
+    0x40, 0x90, 0x01, 0x15, 0x10, 0xE1, 0x1F, 0xC6, 0xA5, 0x31, 0xDD, 0x28, 0x81, 0x24, 0x85, 0x3E,
+    0x80, 0x32, 0x77, 0xB1, 0xE7, 0x19, 0xB7, 0xB6, 0xD4, 0x6C, 0xF8, 0x22, 0xE9, 0xE1, 0x3B, 0x95,
+    0x4E, 0xA3, 0xED, 0x12, 0x33, 0xA7, 0x6E, 0x70, 0xBF, 0x13, 0xF5, 0x08, 0x93, 0x29, 0x51, 0x22,
+    0x91, 0x22, 0x97, 0x2D, 0x2F, 0xDF, 0x29, 0x9D, 0x52, 0x9C, 0x19, 0xF5, 0xE9, 0x75, 0x6C, 0x7C,
+    0x68, 0x02, 0xAF, 0xEA, 0xFC, 0xF9, 0x84, 0xFE, 0xDC, 0xFD, 0xEF, 0xFE, 0x38, 0x2E, 0x1B, 0x65,
+    0x75, 0x31, 0xF1, 0xE6, 0x61, 0xF5, 0xDC, 0xA7, 0x7A, 0x85, 0x44, 0x5F, 0x07, 0xF6, 0x76, 0xB1,
+    0xFC, 0x22, 0xF0, 0x81, 0x81, 0x57, 0x2D, 0x28, 0xFA, 0xFC, 0xD2, 0x14, 0x79, 0x5F, 0x38, 0x1F,
+    0xB4, 0x64, 0xA4, 0xE4, 0xF0, 0x75, 0x4B, 0xDD, 0x0A, 0x37, 0xC9, 0x4B, 0x89, 0x01, 0x01, 0x1E,
+    0xEE, 0x37, 0x54, 0x14, 0x99, 0x13, 0xE5, 0xF4, 0x16, 0x23, 0xC4, 0x0C, 0x70, 0x6F, 0x52, 0x42,
+    0x9A, 0x68, 0x98, 0x78, 0xF2, 0xD9, 0xBB, 0xE4, 0x4A, 0xA4, 0x26, 0x28, 0xDF, 0x24, 0xEC, 0x27,
+    0xD9, 0x75, 0xDE, 0xE4, 0x65, 0x20, 0x56, 0x97, 0xAB, 0x71, 0x8A, 0xC4, 0xED, 0xC7, 0xB0, 0x9D,
+    0xA3, 0x36, 0x24, 0x71, 0x49, 0xDC, 0x2A, 0x90, 0x1A, 0xF9, 0x13, 0xBC, 0x00, 0xF4, 0x08, 0xBC,
+    0x01, 0xDC, 0x41, 0x6C, 0xF0, 0x32, 0x14, 0xD3, 0x41, 0x67, 0xED, 0x46, 0x7C, 0x75, 0x31, 0x11,
+    0xA8, 0x1A, 0x49, 0x11, 0x14, 0x21, 0x53, 0x65, 0xD0, 0x83, 0x7A, 0xF0, 0xBB, 0xCC, 0xE9, 0xC7,
+    0xC9, 0xB7, 0x2D, 0xBC, 0x72, 0x21, 0xA7, 0x2A, 0xDD, 0x0A, 0x45, 0x4C, 0x44, 0x0B, 0xAF, 0x36,
+    0xD4, 0x62, 0x72, 0xF6, 0xF8, 0x97, 0x66, 0xC6, 0x1D, 0xF6, 0xB3, 0xC6, 0x73, 0xC1, 0x2F, 0x75,
+    0x25, 0x90, 0x14, 0xD0, 0x61, 0xAA, 0xB2, 0xB5, 0x0B, 0x98, 0xFE, 0x1C, 0x9E, 0x34, 0x2C, 0x94,
+    0x3B, 0x3A, 0x55, 0x5F, 0x93, 0xDB, 0x78, 0x5F, 0x4E, 0x48, 0xEB, 0xF0, 0x56, 0x7B, 0x54, 0x52,
+    0xA2, 0xA8, 0xAD, 0x9F, 0xBC, 0x6D, 0x72, 0x32, 0x48, 0x5C, 0x3F, 0x2F, 0x9C, 0xDE, 0xC8, 0xAB,
+    0x02, 0x1B, 0x67, 0xB9, 0xAA, 0xB5, 0x4D, 0xCC, 0xD5, 0x31, 0x5F, 0x42, 0x50, 0xE0, 0x23, 0x04,
+    0x16, 0xD7, 0x70, 0x56, 0x1F, 0x9B, 0xA4, 0x25, 0xC8, 0xBC, 0xEE, 0x23, 0xCC, 0x7C, 0x0B, 0x16,
+    0x3B, 0xE3, 0xCC, 0x6A, 0x6E, 0xE0, 0x9B, 0x41, 0x98, 0xD9, 0x78, 0x61, 0xB4, 0xEC, 0x79, 0x67,
+    0xB3, 0xEF, 0xDB, 0x58, 0xD9, 0x84, 0xD3, 0x95, 0x3C, 0xF5, 0x99, 0x1A, 0x7F, 0x98, 0x15, 0xDF,
+    0xEC, 0x7A, 0x67, 0xE4, 0xAE, 0xBB, 0x55, 0x56, 0x34, 0x69, 0xDF, 0x3C, 0xFB, 0xEC, 0x83, 0xE8,
+    0x34, 0xC1, 0xBD, 0x4C, 0x89, 0x1A, 0xAA, 0xCD, 0xDD, 0x28, 0x3B, 0x88, 0xB3, 0x83, 0xC4, 0xCC,
+    0x13, 0x23, 0x0B, 0x53, 0x2B, 0x6D, 0xC0, 0x2E, 0x4C, 0x02, 0xC4, 0xED, 0x4C, 0xCE, 0x27, 0xCD,
+    0xF7, 0x9C, 0x0B, 0xB9, 0x33, 0xDB, 0x76, 0x0E, 0x36, 0x12, 0x9E, 0x77, 0x86, 0x40, 0xA4, 0xC4,
+    0xF2, 0xFE, 0x97, 0x69, 0xBB, 0xB4, 0x9F, 0x59, 0x06, 0xF6, 0xD8, 0xA0, 0x09, 0x7E, 0x60, 0x63,
+    0xA3, 0xE9, 0x11, 0x05, 0xA3, 0x16, 0xB9, 0xA0, 0x8E, 0xDD, 0x52, 0x81, 0xE8, 0x74, 0xE2, 0x92,
+    0xDA, 0x85, 0x52, 0xC8, 0xF7, 0x0D, 0xE7, 0xDF, 0x96, 0x4A, 0xF5, 0xE6, 0x4D, 0x1C, 0xFD, 0x82,
+    0xB5, 0xA0, 0xFC, 0x4B, 0x00, 0x7E, 0x9C, 0x13, 0xAF, 0xF1, 0xE4, 0x2D, 0x1B, 0x19, 0xBD, 0x5D,
+    0xE1, 0x5E, 0x8C, 0xF0, 0x01, 0xE9, 0xA3, 0x98, 0x56, 0xA8, 0x93, 0x54, 0x53, 0x34, 0x14, 0xC7,
+    0x9D, 0xE8, 0x22, 0x0A, 0x77, 0xEE, 0xF6, 0xE0, 0xD7, 0x76, 0x2F, 0x64, 0xC9, 0xD2, 0x1C, 0xBE,
+    0xCC, 0x31, 0x7F, 0xB3, 0x8A, 0x10, 0x4C, 0x4B, 0x0C, 0x87, 0x50, 0x27, 0x05, 0xE2, 0x21, 0xFC,
+    0x47, 0x25, 0x46, 0x49, 0x1A, 0x1E, 0xC9, 0xAF, 0x35, 0xCB, 0x31, 0x8D, 0xD9, 0xBC, 0x27, 0x65,
+    0xD7, 0xDF, 0xD6, 0x16, 0x59, 0x9D, 0xE2, 0xDF, 0xC6, 0xE5, 0xE1, 0x43, 0x12, 0x49, 0x2A, 0xF8,
+    0xD9, 0x0B, 0xB2, 0x20, 0x5D, 0xB9, 0xBA, 0xBF, 0x74, 0xD2, 0xEC, 0xF9, 0xDF, 0x2C, 0x63, 0x7D,
+    0x54, 0xA8, 0xEC, 0xDE, 0x55, 0x01, 0x83, 0x32, 0x4A, 0x0F, 0xFD, 0x2A, 0xB4, 0x49, 0x26, 0xAA,
+    0xFE, 0x3F, 0x8E, 0xEC, 0x86, 0x3B, 0x33, 0x0E, 0x5D, 0x2B, 0x20, 0xAF, 0xDA, 0xFE, 0x0D, 0x71,
+    0x35, 0x6C, 0xDB, 0xA7, 0xFC, 0xBC, 0xE8, 0x20, 0x2E, 0x29, 0x7C, 0xA7, 0x92, 0xF3, 0xE9, 0xAA,
+    0x74, 0xF5, 0x3C, 0x2C, 0x8B, 0x4B, 0x4D, 0xB7, 0x55, 0x82, 0xD7, 0xCE, 0xC3, 0x15, 0x66, 0xB8,
+    0x5D, 0xB1, 0x61, 0x97, 0xFA, 0xA1, 0x7C, 0x6C, 0x87, 0xE3, 0x91, 0x9A, 0x1E, 0x17, 0xE3, 0xFE,
+    0x30, 0xDC, 0x7E, 0x54, 0x54, 0xF1, 0x28, 0x52, 0x27, 0x8F, 0xCB, 0x03, 0xB6, 0x56, 0x23, 0x52,
+    0x29, 0x56, 0xBA, 0x9E, 0x3F, 0xBD, 0x1C, 0xDD, 0x4D, 0xCB, 0x44, 0x0A, 0x8C, 0x2B, 0x27, 0xD7,
+    0xCC, 0xDC, 0x1D, 0x10, 0x77, 0xEB, 0xEB, 0x78, 0x5A, 0xDB, 0xCF, 0x1E, 0x7F, 0x02, 0xC5, 0x55,
+    0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x81, 0x45, 0xB2, 0xC8, 0x52, 0x40, 0x13, 0x3E, 0xDC,
+    0x52, 0x90, 0xB8, 0xA5, 0x38, 0x9F, 0xFD, 0x13, 0x68, 0x10, 0x05, 0x3F, 0x81, 0x22, 0x14, 0x94,
+    0x24, 0x67, 0xC8, 0x1F, 0xC8, 0x4F, 0xA0, 0xA2, 0x85, 0x22, 0x05, 0xC5, 0x91, 0xDB, 0x90, 0x3F,
+    0xE0, 0x08, 0x21, 0x0A, 0x1A, 0x17, 0x44, 0x08, 0x1A, 0xB6, 0xB0, 0xC4, 0x01, 0xF6, 0x0D, 0x6F,
+    0xED, 0x73, 0xB8, 0x02, 0x22, 0x25, 0x48, 0xC9, 0x68, 0x6F, 0x67, 0x75, 0xB7, 0xFB, 0xE6, 0xBD,
+    0xDD, 0x99, 0xB9, 0xF3, 0x00, 0xD6, 0x01, 0x6F, 0x0A, 0x28, 0x4B, 0x9F, 0xA1, 0xB3, 0xA0, 0xC0,
+    0x34, 0x81, 0xDE, 0xEC, 0xDC, 0x5E, 0x89, 0x7A, 0xD8, 0xB9, 0x18, 0xFA, 0xAD, 0xA5, 0xCB, 0xD2,
+    0x5D, 0x91, 0x5A, 0x8B, 0x18, 0x91, 0x71, 0x20, 0x1F, 0x8D, 0x77, 0x17, 0xF0, 0x0D, 0x30, 0x00,
+    0x42, 0xA2, 0x10, 0x2C, 0xC6, 0x5F, 0xED, 0x64, 0xD0, 0x34, 0xAF, 0x00, 0x52, 0x40, 0x8F, 0x11,
+    0xE4, 0x16, 0x85, 0x97, 0xCF, 0x01, 0xFF, 0x80, 0xD1, 0xF5, 0x60, 0xC3, 0x39, 0x18, 0x5D, 0x15,
+    0xD4, 0x51, 0x0B, 0x46, 0xCC, 0x5F, 0x26, 0x6D, 0xC6, 0xB8, 0x4A, 0x14, 0x33, 0x44, 0xAD, 0x6C,
+    0x64, 0x26, 0x7E, 0xA3, 0xED, 0x7F, 0xB3, 0x7B, 0xC5, 0x93, 0x14, 0xBF, 0x82, 0x56, 0x79, 0x68,
+    0x70, 0xB4, 0x55, 0x50, 0xBB, 0x16, 0x71, 0x50, 0x62, 0xAA, 0x0A, 0x55, 0x68, 0x13, 0x23, 0xCA,
+    0x6A, 0xA4, 0xAA, 0xC4, 0x46, 0x9C, 0xA1, 0xA9, 0xE1, 0x89, 0x45, 0x20, 0x39, 0x54, 0x43, 0xAE,
+    0x84, 0x4C, 0x09, 0x39, 0x23, 0x72, 0xC5, 0x5F, 0x8C, 0x27, 0x35, 0x94, 0x18, 0x44, 0xD5, 0x21,
+    0xE2, 0xA0, 0x1F, 0x09, 0xF7, 0x6E, 0x21, 0x9D, 0x21, 0x89, 0x4D, 0x12, 0xD8, 0x04, 0x55, 0x82,
+    0xC1, 0xC2, 0x78, 0x9D, 0x78, 0x36, 0x51, 0xC5, 0xEA, 0x5A, 0x1E, 0x37, 0x88, 0xB7, 0x1C, 0xE5,
+    0xD5, 0x85, 0x71, 0x83, 0x42, 0xAC, 0xCE, 0xB5, 0x19, 0x61, 0xE4, 0xD7, 0x7E, 0x13, 0xDA, 0x53,
+    0xA1, 0x4F, 0x5B, 0x9E, 0x70, 0x6F, 0x2A, 0xB3, 0x7F, 0x5C, 0xD9, 0x86, 0x9B, 0x26, 0x6E, 0x12,
+    0xA6, 0x17, 0x51, 0x48, 0xF4, 0x33, 0x33, 0x42, 0xBD, 0x2B, 0x89, 0xCB, 0xA7, 0x81, 0x7E, 0x4A,
+    0x3C, 0xC7, 0x83, 0x59, 0x32, 0x06, 0x86, 0xEE, 0xC8, 0x1B, 0x97, 0x31, 0x35, 0xE2, 0x8C, 0x19,
+    0xAE, 0xF3, 0x40, 0xF8, 0x6C, 0x6E, 0x2A, 0x43, 0x4E, 0x56, 0x1F, 0xDC, 0xBB, 0x5F, 0x45, 0x06,
+    0xC1, 0x34, 0x36, 0xF0, 0xEB, 0x34, 0x87, 0xD7, 0xB4, 0x51, 0xC4, 0x46, 0xF2, 0xB5, 0x0F, 0x7C,
+    0xA1, 0x79, 0xE4, 0x8B, 0x64, 0x3B, 0x0F, 0x2A, 0x9D, 0x45, 0xCF, 0x28, 0x79, 0xC0, 0x84, 0x30,
+    0x18, 0x77, 0x8E, 0xE9, 0x31, 0xDA, 0x13, 0x69, 0x98, 0x61, 0xC5, 0x44, 0xD6, 0xBD, 0xC9, 0x66,
+    0x89, 0x95, 0xEC, 0x36, 0x70, 0x1D, 0x9C, 0x96, 0xB0, 0x4D, 0x72, 0x42, 0x86, 0xBE, 0x63, 0x8D,
+    0x2B, 0x38, 0x5B, 0x75, 0x4B, 0x64, 0x64, 0x51, 0xAA, 0xF7, 0x63, 0xC4, 0x0C, 0x34, 0xCA, 0x17,
+    0x39, 0xAC, 0x7D, 0xE0, 0x97, 0x55, 0x78, 0x30, 0xC9, 0x2A, 0x6F, 0xBA, 0xCA, 0x1A, 0xA0, 0xBA,
+    0x01, 0xC2, 0xBD, 0xD6, 0xB1, 0x06, 0x54, 0x9D, 0x8A, 0xEC, 0x53, 0x6B, 0x28, 0xDF, 0x8B, 0x6B,
+    0xD3, 0xE1, 0x69, 0xBE, 0x89, 0xE7, 0x2A, 0x4A, 0xB9, 0x48, 0x97, 0x0E, 0xA7, 0x36, 0x35, 0xBD,
+    0xE7, 0x27, 0x7B, 0x23, 0x90, 0x26, 0x1F, 0xC8, 0xFF, 0x42, 0xD8, 0xB2, 0x95, 0xAF, 0xB2, 0xAE,
+    0x78, 0x71, 0xB3, 0x6B, 0x03, 0xC0, 0x93, 0xA3, 0x8B, 0xD8, 0x7B, 0x39, 0xA5, 0x66, 0x8A, 0x66,
+    0x3F, 0x40, 0x4A, 0x10, 0x4D, 0xAD, 0xBE, 0x63, 0x9B, 0x66, 0x5D, 0x3B, 0xC5, 0x0E, 0x3F, 0xDA,
+    0x41, 0xD5, 0xFD, 0xC2, 0xA5, 0xB7, 0xDB, 0x07, 0x26, 0xC5, 0x39, 0x2D, 0x3F, 0x1F, 0x9A, 0x11,
+    0x8F, 0xB7, 0x97, 0x10, 0xB5, 0x38, 0x0E, 0x70, 0x24, 0x9F, 0xBA, 0x10, 0x6C, 0xA8, 0x41, 0xEE,
+    0xFA, 0xA9, 0x6E, 0x8B, 0x73, 0xD1, 0x26, 0xA5, 0xE2, 0x6D, 0x95, 0x97, 0x59, 0x6F, 0xA9, 0xBB,
+    0x58, 0x57, 0xF8, 0x49, 0xBB, 0x60, 0xF4, 0xB8, 0x84, 0x96, 0x4A, 0x11, 0x6F, 0xED, 0x47, 0xBB,
+    0xFB, 0x8E, 0xBB, 0x2F, 0xC6, 0xF7, 0xBF, 0x91, 0xDA, 0x36, 0x6B, 0xFE, 0x16, 0x1E, 0x9F, 0x91,
+    0xA6, 0x8B, 0x6D, 0x17, 0x97, 0x3C, 0xD8, 0x2F, 0x97, 0x5A, 0x5E, 0xC7, 0x57, 0xB3, 0xEE, 0xD4,
+    0x94, 0x7D, 0x64, 0x7B, 0xF4, 0x33, 0x2D, 0xB3, 0x0D, 0x45, 0x3C, 0xEB, 0x5A, 0x76, 0x30, 0x9B,
+    0xE7, 0x6A, 0x4C, 0xDE, 0x81, 0xA3, 0x3C, 0xEA, 0xA1, 0x9C, 0x46, 0x6D, 0xFA, 0x45, 0x39, 0xDF,
+    0xA7, 0x79, 0x20, 0x13, 0x79, 0x31, 0x56, 0x4E, 0x0D, 0x85, 0xD4, 0xDE, 0x3C, 0x5F, 0x5D, 0x0B,
+    0x9B, 0xF5, 0x7F, 0x97, 0x8E, 0x74, 0xDA, 0x72, 0x5D, 0x2C, 0xA9, 0xE3, 0x89, 0x3A, 0x13, 0xFB,
+    0x0D, 0xBD, 0x55, 0xBB, 0x6E, 0xDC, 0x46, 0x14, 0x3D, 0xC3, 0x31, 0x44, 0x47, 0x84, 0x43, 0x17,
+    0x36, 0x90, 0x40, 0x80, 0xD8, 0xA4, 0xCA, 0x8B, 0xAD, 0x8B, 0x95, 0x48, 0x7F, 0x41, 0x54, 0x78,
+    0xDD, 0xF8, 0x13, 0x12, 0x60, 0x1B, 0x15, 0x29, 0x6C, 0x91, 0x80, 0x7F, 0x40, 0x4D, 0xFA, 0x14,
+    0x49, 0xA3, 0x14, 0x9B, 0x22, 0x85, 0x0B, 0xDB, 0xA4, 0xA5, 0x1F, 0x60, 0xE3, 0x9E, 0x86, 0x9D,
+    0x04, 0x91, 0x9B, 0x81, 0x41, 0x03, 0x2B, 0x81, 0xE4, 0xF5, 0xB9, 0xE4, 0x4A, 0xD6, 0x23, 0x48,
+    0x65, 0x87, 0xBB, 0x7B, 0x96, 0xE0, 0xCC, 0xDC, 0x7B, 0xCE, 0xBD, 0x67, 0x86, 0xF8, 0x0C, 0x5F,
+    0x00, 0x6E, 0x1D, 0xF0, 0x5E, 0xE7, 0x40, 0x58, 0x03, 0x98, 0xE0, 0x3F, 0x2F, 0x33, 0x5F, 0xC0,
+    0x88, 0x94, 0x10, 0x69, 0x91, 0x70, 0x41, 0xD8, 0x70, 0x75, 0xC7, 0x91, 0x24, 0x05, 0x7C, 0xC7,
+    0x9B, 0xA7, 0xFC, 0x85, 0x15, 0xA1, 0x3D, 0xB9, 0xE9, 0x31, 0xCE, 0x83, 0xD4, 0xB8, 0x12, 0xCA,
+    0xF1, 0xF7, 0x65, 0xC6, 0xE5, 0x56, 0x18, 0x27, 0x1A, 0xE2, 0x68, 0xC0, 0x4C, 0x5E, 0x0D, 0x19,
+    0xAE, 0xE2, 0xAA, 0x9F, 0x6E, 0x9B, 0x37, 0x15, 0xB2, 0x14, 0x31, 0x70, 0xE5, 0x4C, 0xF6, 0xA2,
+    0xF6, 0xC5, 0x85, 0xF5, 0xF5, 0x38, 0x45, 0x02, 0x6C, 0x02, 0x1B, 0xC3, 0x77, 0x73, 0xC8, 0x1E,
+    0xD7, 0x08, 0xA5, 0xF1, 0x19, 0x6F, 0x76, 0x74, 0xBA, 0xA2, 0xB6, 0x14, 0x36, 0x59, 0x57, 0x02,
+    0x0B, 0x82, 0x55, 0x82, 0xA6, 0xBC, 0x24, 0xEB, 0xE6, 0x94, 0x90, 0xC9, 0x91, 0x82, 0x54, 0x0A,
+    0x0D, 0x76, 0xB0, 0xD6, 0x11, 0x20, 0x0A, 0x49, 0x49, 0x88, 0xAA, 0x1D, 0xAD, 0x12, 0x21, 0x70,
+    0x3B, 0xAA, 0x56, 0xA1, 0x39, 0x07, 0xA1, 0x42, 0xEC, 0xB2, 0xE9, 0x3D, 0x71, 0x8C, 0x22, 0x95,
+    0x82, 0xCA, 0xED, 0xC7, 0xA0, 0x99, 0xFC, 0x33, 0x24, 0x74, 0xEF, 0x61, 0x72, 0x16, 0x8C, 0xBB,
+    0x8F, 0xD5, 0xDB, 0x84, 0xE2, 0xAD, 0xBB, 0x61, 0xA5, 0x77, 0x08, 0xAA, 0xCC, 0x21, 0x44, 0xE8,
+    0xF0, 0x2D, 0xD3, 0x52, 0x6E, 0x50, 0x13, 0xFC, 0x7A, 0xBC, 0xDB, 0xD4, 0xAE, 0x25, 0xBB, 0x59,
+    0x0D, 0x56, 0x92, 0xF3, 0x14, 0x3C, 0x5D, 0x86, 0xD9, 0x0B, 0xB7, 0x14, 0x37, 0xBD, 0x43, 0xF0,
+    0x45, 0x76, 0xA1, 0x93, 0x1A, 0x8C, 0x4C, 0xCC, 0x02, 0xB3, 0x46, 0xE3, 0x30, 0x72, 0x94, 0x6B,
+    0x18, 0x65, 0x5E, 0xF2, 0x31, 0x92, 0x9C, 0x8F, 0x51, 0xAC, 0xCC, 0x0F, 0x73, 0xD3, 0xB2, 0x39,
+    0xA9, 0xDF, 0x88, 0x74, 0x94, 0xAF, 0x8F, 0xB3, 0x94, 0xB3, 0xBD, 0xA1, 0x32, 0xB1, 0x33, 0xDD,
+    0x74, 0x26, 0x25, 0x63, 0xEB, 0xB0, 0x68, 0xF2, 0x41, 0xAA, 0x51, 0xE5, 0x4C, 0xD9, 0xEF, 0x9E,
+    0x8A, 0xB5, 0x5A, 0xF4, 0x50, 0x3D, 0xC0, 0x06, 0x59, 0x9D, 0xB9, 0xF2, 0xDB, 0x61, 0x8E, 0x5F,
+    0x22, 0x86, 0xE9, 0xEE, 0x63, 0x90, 0x1A, 0xDF, 0xA6, 0x0F, 0x1C, 0x0B, 0x1E, 0xE4, 0x5E, 0x3B,
+    0xEA, 0x6B, 0xC8, 0xCD, 0x56, 0xF4, 0x54, 0x98, 0xDB, 0xC5, 0x28, 0x34, 0x1B, 0xED, 0x27, 0x64,
+    0x28, 0x8F, 0xCF, 0xEA, 0xE4, 0xB5, 0x3A, 0x17, 0x8E, 0xB7, 0x17, 0xBA, 0x4B, 0x7E, 0x6D, 0x2C,
+    0x52, 0x17, 0xFD, 0x9E, 0xC7, 0xC9, 0x01, 0xA9, 0x24, 0xA3, 0x3F, 0xD5, 0x0F, 0xAC, 0x19, 0x1D,
+    0xD8, 0x32, 0xA4, 0xB3, 0x2C, 0x4E, 0x78, 0x61, 0xF4, 0xF9, 0x74, 0x8B, 0x25, 0xA8, 0x99, 0xF0,
+    0x80, 0xBF, 0x50, 0xC6, 0xE8, 0x5F, 0xCA, 0x82, 0xB7, 0xF9, 0xE5, 0x0D, 0x12, 0x6B, 0x27, 0x2A,
+    0xBF, 0x0A, 0x48, 0x9D, 0xBE, 0xB3, 0xFB, 0xC7, 0xD2, 0x73, 0xFD, 0xCB, 0xE7, 0x83, 0x53, 0x6D,
+    0xAD, 0xD5, 0x65, 0x11, 0x7E, 0xFA, 0x21, 0x18, 0xDC, 0xDF, 0xE2, 0xAB, 0x0E, 0x36, 0xB7, 0x79,
+    0x88, 0x6B, 0x88, 0xEE, 0xB2, 0x06, 0x92, 0x22, 0xAA, 0x2F, 0x46, 0xA5, 0xE6, 0x7D, 0x16, 0x36,
+    0x90, 0xC3, 0x9F, 0xB9, 0x25, 0xF0, 0x78, 0xC9, 0x6D, 0x49, 0x55, 0x99, 0x33, 0xDA, 0x20, 0x24,
+    0x7D, 0xCF, 0x7C, 0x39, 0xDA, 0x4D, 0xA7, 0x1C, 0xED, 0x95, 0x39, 0x89, 0x38, 0xF5, 0x23, 0x68,
+    0xF7, 0x6D, 0x6C, 0xDB, 0x2A, 0x62, 0x3E, 0x56, 0x94, 0x3D, 0xBF, 0xF1, 0x2F, 0x9B, 0xDD, 0xD3,
+    0x4E, 0x76, 0x78, 0x80, 0xDF, 0xC3, 0xD4, 0x3E, 0xAB, 0x31, 0x89, 0xE7, 0xF2, 0x92, 0xA1, 0x36,
+    0xB6, 0xC0, 0x9E, 0xE8, 0xB6, 0x63, 0x4F, 0x10, 0x1E, 0xDD, 0x2D, 0x0B, 0x69, 0xF5, 0x54, 0xF0,
+    0x8A, 0x6A, 0x2C, 0x02, 0x59, 0x3C, 0x59, 0x8E, 0xBA, 0x8F, 0xAD, 0x05, 0x63, 0xB3, 0x38, 0xC5,
+    0xF0, 0x2F, 0xAE, 0xF0, 0x61, 0x9A, 0xF2, 0x31, 0xA8, 0x32, 0x51, 0xB0, 0x3C, 0x63, 0x33, 0x26,
+    0xFC, 0x5C, 0x1D, 0x9B, 0x22, 0x90, 0xDC, 0x36, 0x11, 0x1E, 0xE1, 0x56, 0x04, 0x6F, 0xFF, 0xAF,
+    0x79, 0xA7, 0xD4, 0xFE, 0xDC, 0x3A, 0xA1, 0x16, 0xE7, 0xEC, 0xC2, 0x48, 0x2D, 0x26, 0xB5, 0x98,
+    0xA7, 0xE9, 0x2D, 0xE0, 0x53, 0xB6, 0xA7, 0x1C, 0xEE, 0x0C, 0x1F, 0x98, 0x71, 0xA3, 0xF9, 0xE9,
+    0xD7, 0xF0, 0x1F, 0x96, 0xF0, 0xDB, 0xD1, 0xE5, 0x9F, 0x5C, 0x3A, 0xBE, 0x49, 0x83, 0x81, 0x16,
+    0xB1, 0xEC, 0xE5, 0x54, 0xE3, 0xB9, 0xF3, 0x7E, 0x3F, 0x51, 0xC3, 0x34, 0xDD, 0x79, 0x35, 0x3A,
+    0xFA, 0x76, 0x7A, 0x87, 0xA3, 0x8B, 0xA5, 0x1A, 0xDD, 0x0D, 0x30, 0xFC, 0x7C, 0x63, 0x2A, 0x3C,
+    0xFA, 0x63, 0x78, 0x09, 0x04, 0x14, 0x75, 0xFD, 0x83, 0x19, 0x69, 0x38, 0xF9, 0x23, 0x2C, 0x8B,
+    0x65, 0xDE, 0xB0, 0x16, 0x7E, 0xFE, 0xE3, 0xF0, 0x86, 0x38, 0xD5, 0xB3, 0x05, 0xAC, 0x71, 0x1F,
+    0xAA, 0xAE, 0xD2, 0xEF, 0x53, 0x93, 0x0F, 0xEF, 0x99, 0x48, 0x4D, 0x90, 0xA8, 0x35, 0xB4, 0xAF,
+    0x43, 0x77, 0xCE, 0x81, 0xF9, 0x55, 0x81, 0x1E, 0x48, 0x31, 0xEB, 0x39, 0xC5, 0x1C, 0x73, 0xB2,
+    0x71, 0x71, 0xC3, 0x8A, 0x44, 0xB2, 0x37, 0x77, 0x81, 0x8C, 0xCD, 0xE5, 0x39, 0x59, 0x70, 0xF3,
+    0x63, 0x45, 0x5F, 0x0D, 0x6C, 0x9D, 0x9E, 0x8E, 0x3B, 0x35, 0xD6, 0xFD, 0xDC, 0xC7, 0xEA, 0x09,
+    0x89, 0xA0, 0xD9, 0xB0, 0xF2, 0x77, 0xD9, 0x17, 0x6D, 0x84, 0xE2, 0xA0, 0xB2, 0xED, 0x04, 0xD1,
+    0x41, 0x69, 0xC6, 0x3F, 0xAF, 0xDD, 0x44, 0xF6, 0x8C, 0x26, 0x60, 0xE9, 0xCA, 0x44, 0x16, 0x28,
+    0xBE, 0x63, 0xBE, 0x46, 0x59, 0x54, 0x91, 0x0B, 0xA5, 0x57, 0xB9, 0x6B, 0x4C, 0xA1, 0x52, 0xFE,
+    0xE7, 0xEB, 0x1D, 0xC5, 0x55, 0x31, 0x6F, 0xD4, 0x58, 0x10, 0x1E, 0xDB, 0x09, 0x3E, 0x64, 0x91,
+    0x47, 0xC3, 0x35, 0x39, 0xF2, 0x1A, 0x5A, 0x30, 0x05, 0x65, 0xC2, 0xB3, 0x94, 0xE2, 0xCA, 0x5C,
+    0x71, 0xA7, 0x6B, 0x69, 0x4F, 0x48, 0x9C, 0x90, 0x28, 0x52, 0x44, 0xB7, 0x46, 0xF9, 0x03, 0xFC,
+    0x04, 0x1A, 0x24, 0x04, 0x05, 0x14, 0x14, 0x29, 0x02, 0xFB, 0xA2, 0x2D, 0x28, 0x68, 0x9C, 0xE4,
+    0x07, 0x9C, 0xC5, 0x09, 0xC1, 0x09, 0x21, 0x9E, 0x4E, 0x96, 0x30, 0xE8, 0xD9, 0x73, 0xDF, 0x78,
+    0x93, 0x4D, 0xD6, 0x09, 0x08, 0x09, 0x04, 0xF6, 0xCC, 0xB7, 0xDA, 0xB1, 0x77, 0xDE, 0x37, 0x33,
+    0xDF, 0x7B, 0x4B, 0xF4, 0x2B, 0x11, 0xCD, 0xE1, 0x26, 0x95, 0x9D, 0x27, 0x8A, 0xD8, 0x13, 0x05,
+    0xEC, 0x10, 0x9C, 0xCD, 0xE8, 0xC8, 0x15, 0xFC, 0x42, 0x34, 0xCF, 0x9C, 0x07, 0xCC, 0x6C, 0xE3,
+    0x36, 0x0B, 0x72, 0x55, 0x21, 0xAC, 0x0B, 0x80, 0xB1, 0x02, 0xB9, 0x40, 0xD6, 0x83, 0xE0, 0x8E,
+    0x00, 0xB7, 0xF8, 0xFA, 0x67, 0x8B, 0x57, 0x82, 0x0F, 0x78, 0x39, 0x70, 0x69, 0x45, 0xA1, 0xD3,
+    0x7C, 0xEF, 0x81, 0x4B, 0x90, 0xCF, 0x45, 0x80, 0x8A, 0x86, 0xCC, 0x25, 0x9D, 0xE0, 0xF7, 0x14,
+    0xE3, 0xBE, 0x41, 0x0F, 0xA3, 0x17, 0xD7, 0x48, 0xB3, 0xA5, 0xB4, 0xE8, 0x71, 0x49, 0xAA, 0xA5,
+    0x88, 0x5F, 0xDA, 0x76, 0xE8, 0x35, 0x0D, 0x47, 0x45, 0xE4, 0x17, 0x49, 0x8F, 0x6C, 0x30, 0xFE,
+    0x08, 0xFD, 0x65, 0x1A, 0x6C, 0x31, 0x7B, 0x05, 0xA2, 0x86, 0x6B, 0x1A, 0xAE, 0x60, 0xD9, 0x4A,
+    0xC8, 0x14, 0xDA, 0x29, 0x6E, 0x51, 0x81, 0x9D, 0xC7, 0x4A, 0x52, 0xD1, 0xF8, 0x4A, 0x0F, 0x08,
+    0xE7, 0xFB, 0xF0, 0x1D, 0xCB, 0x27, 0x85, 0x77, 0x30, 0x0C, 0x6D, 0x29, 0xF4, 0x7D, 0x22, 0xC3,
+    0xE5, 0xC2, 0xB4, 0x6B, 0xEA, 0x35, 0x6F, 0xB9, 0xC4, 0x2F, 0x91, 0x99, 0xD4, 0x2D, 0x1F, 0xE9,
+    0xA8, 0x8C, 0xBD, 0x06, 0x43, 0x94, 0x8F, 0xA4, 0x79, 0x52, 0xD5, 0x48, 0x93, 0x51, 0x54, 0x9D,
+    0x0A, 0x98, 0x90, 0x5F, 0xB3, 0x0F, 0x86, 0x2D, 0xD1, 0x99, 0x6F, 0x5E, 0xD3, 0xB1, 0xD7, 0x78,
+    0x95, 0xE9, 0xA5, 0x06, 0xF2, 0x80, 0x05, 0xC0, 0x93, 0x84, 0x11, 0xBE, 0x28, 0xC8, 0xB2, 0x99,
+    0x74, 0xE4, 0x60, 0x40, 0x5F, 0x59, 0x09, 0xA1, 0x94, 0x8E, 0x45, 0x28, 0x78, 0x07, 0x38, 0x1B,
+    0x02, 0xF2, 0xE0, 0x90, 0x1A, 0x20, 0x14, 0x65, 0x1F, 0x23, 0x41, 0x84, 0x2C, 0x5E, 0x15, 0x68,
+    0x2C, 0x38, 0xAB, 0x02, 0xD4, 0xCC, 0x32, 0x42, 0x8D, 0x2A, 0x25, 0x94, 0x23, 0x04, 0xF2, 0x66,
+    0x1D, 0xDD, 0x6F, 0xB1, 0x38, 0xD7, 0x06, 0x50, 0xC2, 0x79, 0x1D, 0xDE, 0xAA, 0x0F, 0xF7, 0x1E,
+    0x78, 0x94, 0xAD, 0x1D, 0x4A, 0x1B, 0x8C, 0x3C, 0xB6, 0x1D, 0x0A, 0x8C, 0xFD, 0x40, 0x42, 0xDD,
+    0x42, 0x8F, 0xA8, 0x53, 0x40, 0xFC, 0x96, 0x68, 0x21, 0xB2, 0x74, 0x89, 0x6E, 0x13, 0x6D, 0x20,
+    0x5E, 0xF5, 0xDC, 0xED, 0xFB, 0x1F, 0xA0, 0xCC, 0x05, 0x0A, 0xAA, 0x02, 0x0E, 0x6A, 0xFC, 0x76,
+    0x2D, 0xAC, 0x68, 0x31, 0x74, 0x9D, 0x2F, 0x45, 0xD3, 0xFE, 0x17, 0xE8, 0x3F, 0x11, 0x4F, 0xD0,
+    0x4F, 0x97, 0xA0, 0x8C, 0x31, 0x74, 0x05, 0xF5, 0x60, 0x20, 0x84, 0x31, 0x46, 0x6E, 0xF4, 0x8B,
+    0xDF, 0x7E, 0xAF, 0xA5, 0xC0, 0x1A, 0xFC, 0xEF, 0xD7, 0x5D, 0x5D, 0xD3, 0xE0, 0xBB, 0x2A, 0x7A,
+    0xA0, 0x05, 0x3A, 0xF2, 0xF5, 0x98, 0xF4, 0x55, 0x9C, 0x31, 0xDC, 0xDE, 0xFE, 0x28, 0xF9, 0xF0,
+    0x33, 0xC9, 0x4B, 0x8B, 0xE6, 0x16, 0xDD, 0xEE, 0xFA, 0x9B, 0x4B, 0x6A, 0x6A, 0xC7, 0xA2, 0x7A,
+    0xCC, 0xD0, 0xCB, 0x36, 0x3A, 0x0A, 0x05, 0x74, 0x34, 0x86, 0x12, 0x02, 0xD3, 0x25, 0xF6, 0x85,
+    0x76, 0x81, 0xE8, 0x2D, 0xAA, 0x7F, 0xBA, 0xFE, 0xFC, 0x59, 0x5C, 0x5F, 0x99, 0x9D, 0x24, 0x2A,
+    0x69, 0x61, 0x1A, 0x2E, 0xA0, 0x5F, 0x94, 0xA2, 0x55, 0x64, 0x3A, 0x80, 0x60, 0x67, 0xE6, 0xB9,
+    0x31, 0xFC, 0x6F, 0x5F, 0xDA, 0x90, 0xB1, 0xF9, 0xB4, 0x65, 0x87, 0x2C, 0x17, 0x1B, 0xC0, 0xEC,
+    0x9E, 0x41, 0x6B, 0xEC, 0x87, 0x7C, 0xF7, 0x20, 0xE1, 0x39, 0xA2, 0xD5, 0x23, 0x86, 0xB6, 0x6E,
+    0x76, 0xE6, 0x0F, 0x59, 0xE8, 0xF5, 0xD6, 0x71, 0xB6, 0xDD, 0xA4, 0x3B, 0x6D, 0xFA, 0xBC, 0x9D,
+    0x8B, 0xF2, 0x8B, 0xD1, 0x2B, 0xCC, 0x3E, 0xB1, 0x8D, 0xDA, 0x6E, 0xC7, 0xE9, 0xE3, 0x7C, 0x75,
+    0xDF, 0x36, 0x12, 0xBB, 0xA9, 0xAC, 0x57, 0xB6, 0x39, 0xB5, 0xFF, 0xA6, 0xD1, 0x4F, 0xFF, 0xDB,
+    0x3B, 0x8A, 0x66, 0x7F, 0x76, 0xDE, 0xA8, 0xD1, 0x04, 0x76, 0xAB, 0xC6, 0xAC, 0xFC, 0xF3, 0xBE,
+    0x1D, 0xFC, 0xFD, 0xCE, 0xCF, 0xC5, 0x37, 0xCB, 0xD5, 0x05, 0xC0, 0x46, 0x9A, 0x74, 0x0F, 0x8B,
+    0x71, 0x2B, 0x02, 0x6F, 0x8E, 0xF5, 0xB0, 0xEF, 0xB5, 0xC9, 0x0E, 0x7B, 0x54, 0x9B, 0x5C, 0xF6,
+    0x13, 0x64, 0x28, 0x6E, 0x27, 0x0E, 0xD9, 0x24, 0x8E, 0x4E, 0x0E, 0x1C, 0x29, 0x2E, 0xE0, 0x16,
+    0x8E, 0x53, 0xA2, 0xC6, 0x6C, 0xA8, 0x3B, 0x29, 0xD4, 0x48, 0xF6, 0xB9, 0x2E, 0xBB, 0x6D, 0x84,
+    0x63, 0x62, 0x7A, 0x38, 0x0B, 0x98, 0xED, 0x2D, 0xB4, 0x2F, 0xD9, 0x2A, 0x89, 0x2E, 0xC4, 0x50,
+    0xCF, 0x06, 0x42, 0x61, 0x29, 0xA1, 0x9B, 0x08, 0x9D, 0x4F, 0x10, 0xAA, 0x90, 0x2B, 0x2A, 0xD0,
+    0x5B, 0xB5, 0x8C, 0xE5, 0x96, 0x20, 0x1F, 0x72, 0x98, 0x5B, 0x64, 0x25, 0xBD, 0x64, 0x59, 0x14,
+    0x89, 0x88, 0x80, 0xE5, 0xD1, 0x8F, 0xD2, 0x47, 0xF9, 0xF7, 0x8C, 0xF7, 0x1A, 0x4A, 0x3F, 0x10,
+    0x5D, 0xC6, 0x79, 0x9D, 0x85, 0x3B, 0x85, 0xA2, 0x1B, 0x33, 0x71, 0x45, 0xB1, 0x13, 0xD6, 0x7D,
+    0x2B, 0xC5, 0xD4, 0xC4, 0x8A, 0x69, 0xB3, 0x7B, 0x96, 0xDA, 0xD3, 0x43, 0x1C, 0x62, 0x99, 0x61,
+    0x32, 0x0D, 0x19, 0x47, 0xB3, 0xF4, 0x65, 0xD7, 0xFF, 0xBD, 0x55, 0xBD, 0x8E, 0xDC, 0x36, 0x10,
+    0xFE, 0x28, 0xC2, 0x50, 0x21, 0xE0, 0xD8, 0xC4, 0x85, 0x13, 0xC0, 0x6C, 0xDC, 0x6E, 0xD8, 0xB8,
+    0x48, 0xB1, 0x3A, 0x12, 0xCE, 0x0B, 0xB8, 0x48, 0xFA, 0x3C, 0x46, 0x8A, 0x5B, 0x4B, 0x71, 0x5E,
+    0xC8, 0x0F, 0x70, 0x77, 0xCB, 0xB3, 0x5F, 0x40, 0xF6, 0x3E, 0x80, 0x05, 0xD8, 0x7D, 0x08, 0x1C,
+    0x0B, 0xC1, 0x96, 0x96, 0x99, 0xA1, 0xB4, 0xC8, 0xAE, 0x71, 0x36, 0x1C, 0x38, 0xC8, 0x00, 0x9C,
+    0x11, 0x57, 0xE2, 0xCC, 0xC7, 0x6F, 0x7E, 0x16, 0x45, 0x8B, 0x22, 0x42, 0x24, 0x88, 0x3E, 0x14,
+    0xBE, 0xC4, 0x22, 0xCA, 0x41, 0x7A, 0x20, 0x00, 0x6B, 0xDA, 0xE0, 0xB0, 0xB9, 0x00, 0x34, 0x50,
+    0x7A, 0x08, 0xDA, 0xFC, 0x0E, 0x3C, 0x04, 0x2A, 0x72, 0xD0, 0x03, 0xE4, 0x63, 0x82, 0x4E, 0x50,
+    0xE4, 0xE9, 0x17, 0xFA, 0xA4, 0xAF, 0x42, 0x11, 0xCB, 0x80, 0x2B, 0x39, 0xC0, 0x3C, 0x19, 0xA1,
+    0xFC, 0x04, 0x19, 0x12, 0x30, 0x36, 0x80, 0xB5, 0x2D, 0xD4, 0x5F, 0x1E, 0x65, 0xEA, 0x28, 0x34,
+    0xB9, 0x6A, 0x06, 0xC0, 0x24, 0x87, 0x2A, 0x45, 0x14, 0x1F, 0xE8, 0x61, 0x6F, 0x23, 0xEC, 0x9F,
+    0xC9, 0xA9, 0xBE, 0x89, 0x32, 0x56, 0xC9, 0x4D, 0x48, 0xD1, 0x3A, 0x45, 0xAF, 0x48, 0x38, 0x02,
+    0x41, 0xA6, 0x73, 0x2D, 0x9D, 0xEB, 0x08, 0x04, 0xF9, 0x90, 0x23, 0xFD, 0xB0, 0xE7, 0x1F, 0x5D,
+    0xC6, 0x4F, 0x90, 0x18, 0x2C, 0x23, 0xFD, 0xC7, 0x14, 0xE1, 0x1C, 0x46, 0xF9, 0xE2, 0x36, 0xC0,
+    0x5C, 0xA1, 0x48, 0x2D, 0x6C, 0x80, 0x4C, 0x1E, 0x36, 0x41, 0xDE, 0x8E, 0xB0, 0x3A, 0xC8, 0xB0,
+    0xF5, 0xB6, 0x48, 0x32, 0xA8, 0x11, 0xA7, 0x42, 0x11, 0x75, 0xCF, 0xF7, 0x84, 0xF6, 0x28, 0xE8,
+    0x2D, 0x5D, 0xA3, 0xA4, 0x28, 0x42, 0x38, 0x55, 0x7A, 0xA5, 0x9C, 0xFA, 0x11, 0x67, 0x6B, 0x3C,
+    0x8C, 0xD0, 0x01, 0xBA, 0x83, 0xE9, 0x61, 0x06, 0xAC, 0xAE, 0x51, 0xDB, 0xB6, 0x56, 0x7D, 0x5D,
+    0x0E, 0x85, 0xCF, 0x84, 0x12, 0x67, 0xCC, 0xA6, 0x39, 0xF1, 0x7E, 0xCF, 0x41, 0x10, 0x0D, 0xBA,
+    0x3D, 0x36, 0x86, 0xD8, 0x65, 0xE3, 0x38, 0x4B, 0x6C, 0x24, 0x19, 0x7B, 0x6A, 0xE8, 0xEA, 0x01,
+    0xC2, 0xA6, 0x74, 0x9B, 0x52, 0x5A, 0x0C, 0x42, 0xD9, 0xAE, 0x10, 0x38, 0x50, 0x96, 0x0B, 0x11,
+    0x2A, 0x6F, 0x30, 0xC8, 0x5E, 0xB5, 0x35, 0xA2, 0xEC, 0x94, 0xDB, 0x88, 0x58, 0x76, 0x3A, 0x9B,
+    0xA4, 0x27, 0xCE, 0xC0, 0x7F, 0x19, 0xFF, 0x54, 0x88, 0x89, 0x82, 0x68, 0xB3, 0x3E, 0x67, 0x89,
+    0x0E, 0x52, 0x65, 0x20, 0x7D, 0x3D, 0x30, 0x4A, 0x68, 0x68, 0x6E, 0xA6, 0x32, 0x18, 0xBF, 0x67,
+    0xC6, 0xEF, 0xC2, 0xFA, 0xD4, 0xB4, 0x8A, 0xB0, 0x06, 0xE3, 0x54, 0x11, 0x05, 0x19, 0xFD, 0xD5,
+    0x58, 0x1D, 0x56, 0xBA, 0x78, 0x1D, 0x6A, 0x23, 0xDF, 0x84, 0xF5, 0x39, 0x64, 0x0F, 0x52, 0x1D,
+    0xEA, 0x59, 0x95, 0x1D, 0x36, 0xC7, 0x2A, 0xA1, 0x21, 0x64, 0xED, 0x1D, 0xF9, 0x12, 0x83, 0x69,
+    0xCD, 0xF3, 0xA1, 0x18, 0x8D, 0xB3, 0x2F, 0xFF, 0x2D, 0x5F, 0x17, 0x5C, 0xA3, 0x95, 0xE7, 0xAA,
+    0x18, 0x08, 0x82, 0x55, 0xED, 0x58, 0x97, 0x21, 0x9A, 0x5D, 0xC7, 0xD5, 0xBC, 0x81, 0x88, 0x1C,
+    0x5F, 0x1F, 0x1E, 0x13, 0xF4, 0x84, 0x85, 0x1C, 0xDC, 0xCB, 0x7A, 0x9D, 0x75, 0xA6, 0x87, 0xCB,
+    0x7D, 0xEE, 0xDA, 0xB9, 0xDA, 0xC4, 0xA0, 0x33, 0x67, 0x75, 0xD6, 0x97, 0x59, 0xF3, 0x87, 0xE2,
+    0x23, 0xF5, 0x2E, 0xF5, 0x81, 0xCF, 0xDA, 0x65, 0xCD, 0x67, 0x38, 0x5B, 0xC8, 0xA9, 0x47, 0x06,
+    0x7D, 0xD0, 0x55, 0xD6, 0x3A, 0x6B, 0x9B, 0xF5, 0x36, 0x47, 0xFA, 0x48, 0x37, 0xA2, 0x06, 0xE2,
+    0x9B, 0x94, 0x3B, 0xD6, 0xEA, 0x15, 0x6B, 0x23, 0x59, 0x3F, 0xCB, 0xB8, 0x72, 0x37, 0x15, 0xB3,
+    0xAF, 0x7C, 0x46, 0x75, 0xD9, 0x57, 0xEE, 0xE8, 0x47, 0x47, 0xC5, 0xA2, 0x97, 0x65, 0x96, 0x75,
+    0x7E, 0xB4, 0x18, 0x7F, 0xFD, 0x80, 0x9E, 0x87, 0xDC, 0xFC, 0x0C, 0xD3, 0x8C, 0x84, 0x73, 0x43,
+    0x63, 0x60, 0x43, 0xEF, 0x0E, 0xAB, 0xE1, 0xA1, 0x12, 0xE7, 0xC1, 0x22, 0xB9, 0x09, 0x56, 0xEC,
+    0x39, 0x2C, 0x6C, 0x64, 0x37, 0x9F, 0x8A, 0x78, 0xFA, 0x3D, 0x4D, 0x25, 0xBF, 0x75, 0xB0, 0x92,
+    0xE7, 0x94, 0x9A, 0xA8, 0x4A, 0xED, 0x48, 0xBD, 0x4E, 0x13, 0xAA, 0x91, 0xA9, 0x2F, 0x46, 0xF5,
+    0xD6, 0x57, 0x7D, 0x63, 0x5B, 0xF3, 0x07, 0x4D, 0xB1, 0x7D, 0x19, 0xF6, 0x72, 0x30, 0x37, 0xA3,
+    0xEA, 0xB7, 0x72, 0xB0, 0x4F, 0xC6, 0x32, 0x4C, 0x2A, 0xA8, 0x5D, 0xB4, 0x5E, 0xBF, 0xED, 0x92,
+    0xB3, 0xDB, 0x9F, 0x27, 0x6C, 0x47, 0x15, 0x91, 0x82, 0xED, 0x88, 0xE2, 0xE4, 0xD8, 0x2F, 0x1E,
+    0x13, 0x86, 0x19, 0xCB, 0xEA, 0x90, 0xA1, 0x53, 0x39, 0xD3, 0xBD, 0x48, 0xA9, 0xD3, 0xB1, 0x11,
+    0x23, 0x06, 0xE3, 0xAA, 0xE7, 0x01, 0x97, 0x06, 0xD5, 0x4B, 0x32, 0x34, 0x02, 0x5F, 0x45, 0x8C,
+    0x64, 0x76, 0x11, 0xD3, 0x62, 0xF2, 0xA9, 0xFB, 0xEE, 0x00, 0x7E, 0xCF, 0xE0, 0x47, 0x06, 0x3F,
+    0x7C, 0x16, 0xFC, 0xF5, 0x31, 0xF8, 0x38, 0x83, 0xAF, 0x66, 0xF0, 0xE6, 0x4B, 0xE0, 0x59, 0x7E,
+    0xC5, 0x32, 0x6C, 0x55, 0xBF, 0x4C, 0x5B, 0x91, 0x77, 0xCC, 0xAE, 0x75, 0xDF, 0x72, 0x09, 0x9E,
+    0xEB, 0x34, 0x23, 0xCA, 0x21, 0xBB, 0xE5, 0x19, 0x41, 0x77, 0xD1, 0xDD, 0x11, 0x37, 0x3F, 0x09,
+    0xDA, 0xAD, 0x39, 0x99, 0xB6, 0x5B, 0x4A, 0x02, 0xBF, 0x7D, 0x4A, 0xE0, 0xFF, 0x41, 0x85, 0x70,
+    0xC2, 0x9D, 0xE1, 0x05, 0xEA, 0x8B, 0x3C, 0xC8, 0x38, 0x8F, 0xDF, 0x7D, 0x7B, 0x1E, 0xA9, 0x8F,
+    0xA9, 0xC7, 0x79, 0x9E, 0x34, 0xF3, 0x9F, 0x8C, 0xC3, 0x9D, 0x72, 0xF6, 0xC3, 0x7B, 0xA4, 0xD4,
+    0xAB, 0x68, 0xD8, 0xB5, 0x6E, 0xAB, 0x9B, 0x88, 0x4B, 0xED, 0x2A, 0x1A, 0x3A, 0x57, 0x14, 0xE8,
+    0x0D, 0x19, 0xDB, 0x56, 0xBB, 0x01, 0xD7, 0x64, 0xDE, 0x91, 0xC1, 0x67, 0xE4, 0x6F, 0xC5, 0x55,
+    0xBF, 0x6F, 0xDF, 0x44, 0x14, 0xFF, 0xD8, 0x47, 0x62, 0xA9, 0x96, 0x72, 0x0C, 0x20, 0x24, 0x22,
+    0xE2, 0x7F, 0x00, 0x74, 0x0B, 0x03, 0x43, 0x93, 0x3B, 0xA8, 0xC4, 0xDC, 0xA1, 0x61, 0x65, 0x46,
+    0x0C, 0x61, 0xEC, 0x80, 0x62, 0xC3, 0xC2, 0x1A, 0x86, 0xEC, 0x9D, 0x83, 0x90, 0x3A, 0x30, 0x74,
+    0x28, 0xB5, 0x69, 0xFE, 0x01, 0xA3, 0x8A, 0xB9, 0x06, 0xDA, 0x89, 0xA1, 0x96, 0xF0, 0xE0, 0x88,
+    0xB3, 0x1F, 0x9F, 0x67, 0x27, 0x05, 0x25, 0x82, 0x89, 0x88, 0x17, 0xDD, 0x3B, 0xC7, 0x77, 0x7E,
+    0x9F, 0xF7, 0x79, 0xBF, 0xBE, 0x00, 0xE5, 0xF5, 0x00, 0xDB, 0xD4, 0x01, 0xDE, 0xCC, 0x40, 0xB4,
+    0x11, 0x59, 0xEF, 0x47, 0x14, 0x8D, 0xF4, 0x28, 0x8D, 0x74, 0x69, 0xB4, 0x4F, 0x9B, 0xBC, 0x2B,
+    0x7D, 0xE5, 0xBE, 0x88, 0x25, 0x1E, 0x65, 0xFD, 0x6C, 0x46, 0xF7, 0x43, 0xB4, 0x5D, 0x6D, 0x06,
+    0xFF, 0x41, 0xCC, 0xFA, 0x29, 0xEF, 0xED, 0x93, 0xC1, 0x37, 0xEE, 0x69, 0x2B, 0xC1, 0xD7, 0xB7,
+    0x26, 0xD4, 0xD1, 0x0E, 0x90, 0xDE, 0xB7, 0xA9, 0x34, 0x12, 0x8C, 0x10, 0xA5, 0x18, 0x81, 0x6D,
+    0x69, 0x00, 0x79, 0x06, 0x6C, 0x1E, 0x01, 0x5B, 0x45, 0x97, 0x88, 0xB4, 0xC5, 0x50, 0x26, 0x11,
+    0xA3, 0x0B, 0xF9, 0x97, 0x3D, 0x1E, 0x3A, 0xE4, 0x8F, 0xB9, 0xF9, 0x60, 0x4F, 0x07, 0x44, 0x6E,
+    0x4F, 0x06, 0x4C, 0xEB, 0x46, 0xE7, 0x6C, 0x8B, 0x74, 0x82, 0xA1, 0x15, 0xFF, 0x0C, 0x2F, 0xE5,
+    0x46, 0xCD, 0x23, 0x2F, 0x33, 0x2E, 0xCB, 0xA6, 0x42, 0x95, 0x22, 0x48, 0xE5, 0x58, 0xDA, 0x2C,
+    0xA2, 0xE8, 0x6D, 0x8F, 0x6C, 0x2C, 0x1A, 0xA4, 0xD1, 0x57, 0xA0, 0x65, 0xDE, 0x7A, 0xA4, 0xEA,
+    0x50, 0x55, 0x79, 0x48, 0xE5, 0xF5, 0x69, 0x6F, 0x7D, 0x17, 0x80, 0xD9, 0x2B, 0x66, 0x31, 0xEF,
+    0x1F, 0x44, 0x2B, 0x22, 0x63, 0x46, 0xD5, 0xA7, 0x54, 0x2D, 0x6A, 0x91, 0xB0, 0x62, 0xA8, 0x24,
+    0x27, 0x12, 0x78, 0xBE, 0x71, 0xD5, 0x8B, 0x99, 0xF8, 0x33, 0xE6, 0x0F, 0x87, 0x02, 0xD9, 0x69,
+    0x87, 0xDD, 0x5D, 0x98, 0x5F, 0x5B, 0xB8, 0x5D, 0xA4, 0xBF, 0x77, 0x44, 0x0A, 0xF9, 0x8F, 0xF2,
+    0x42, 0x8D, 0x07, 0x47, 0xA3, 0x65, 0x07, 0xBC, 0xC5, 0x3F, 0x6C, 0xE1, 0x6D, 0x12, 0x3E, 0x7E,
+    0x00, 0xF2, 0xED, 0x69, 0x86, 0x09, 0xFA, 0x5F, 0xF9, 0x65, 0xB7, 0x33, 0x7C, 0x86, 0xFB, 0xA6,
+    0xD9, 0x81, 0x63, 0x02, 0xD4, 0xCF, 0x57, 0x81, 0xFF, 0x80, 0x6D, 0x7A, 0x84, 0x37, 0x61, 0x3A,
+    0x38, 0x64, 0x1D, 0x3C, 0xF2, 0x0E, 0x87, 0x57, 0xCD, 0x6E, 0xCB, 0xD1, 0x4A, 0x15, 0xF5, 0xF3,
+    0x72, 0x40, 0xD9, 0x24, 0x02, 0xDF, 0xA0, 0xE8, 0x16, 0xAE, 0x96, 0x66, 0xFC, 0x2D, 0x46, 0x29,
+    0xEF, 0x22, 0x33, 0x31, 0x2E, 0x64, 0x0B, 0x06, 0xC0, 0x9E, 0xF2, 0xA5, 0x39, 0x7F, 0xA9, 0x6C,
+    0x59, 0x96, 0xA8, 0xDF, 0x97, 0xE7, 0x1F, 0x49, 0xE3, 0x49, 0xB2, 0x5B, 0xE8, 0x2A, 0xD3, 0x01,
+    0xB9, 0xAA, 0x15, 0xE8, 0x2F, 0x49, 0x7A, 0x14, 0xC1, 0x21, 0x1D, 0xB2, 0x1E, 0x3E, 0xBC, 0x86,
+    0xE4, 0x36, 0xFE, 0x49, 0x92, 0x9A, 0x80, 0x4E, 0x3A, 0x98, 0xB3, 0xED, 0x16, 0x64, 0xDF, 0x60,
+    0x84, 0x0D, 0xA6, 0xC5, 0x1E, 0x37, 0x3C, 0x04, 0x43, 0xD0, 0xEB, 0xAB, 0xCA, 0x0C, 0xF8, 0x1E,
+    0x99, 0xD4, 0x3D, 0x34, 0x0E, 0x04, 0x26, 0x6E, 0x36, 0x2F, 0x09, 0xFD, 0xF9, 0xE4, 0x9B, 0x19,
+    0x85, 0xA8, 0x54, 0xEE, 0xEC, 0x63, 0xCD, 0x83, 0x63, 0x1B, 0xB6, 0xA4, 0x42, 0xC3, 0x6C, 0xA1,
+    0x9C, 0x84, 0x18, 0x05, 0x7D, 0x64, 0xE6, 0x40, 0x66, 0x56, 0x1F, 0xB5, 0x4A, 0xA4, 0xB1, 0xDA,
+    0x5E, 0xD2, 0x1B, 0x0D, 0x87, 0xC4, 0xE5, 0x30, 0xAE, 0x87, 0xF3, 0x62, 0x00, 0x44, 0x33, 0xD3,
+    0xFA, 0x65, 0x79, 0xB6, 0x4F, 0x07, 0xD4, 0x03, 0x99, 0xF6, 0xEF, 0x24, 0x72, 0x8E, 0xB9, 0x6C,
+    0xFD, 0xFA, 0x6F, 0xA4, 0x43, 0xBF, 0x89, 0x06, 0x9D, 0xF2, 0x09, 0x63, 0x73, 0x96, 0xD2, 0x55,
+    0x27, 0xBF, 0x0C, 0x79, 0xF0, 0x5F, 0xF3, 0xEB, 0xFB, 0x64, 0xD9, 0x63, 0xC7, 0x56, 0x98, 0x3E,
+    0x95, 0x53, 0x66, 0x99, 0x9F, 0x32, 0x90, 0x3F, 0x05, 0x72, 0x35, 0x6A, 0xBC, 0x52, 0x1F, 0x8C,
+    0xE6, 0x8B, 0x80, 0x7F, 0x88, 0x1C, 0xDF, 0x25, 0x5E, 0xCD, 0xFA, 0xA8, 0xE5, 0x2B, 0xA2, 0x91,
+    0xF4, 0xF6, 0xCC, 0xB4, 0xF0, 0x6A, 0x42, 0xEF, 0x18, 0x2A, 0x8D, 0x1A, 0xF2, 0xEA, 0x65, 0x50,
+    0x37, 0xEE, 0xA8, 0x8B, 0xA3, 0xBA, 0x09, 0xCB, 0x99, 0x64, 0x79, 0xA1, 0xE0, 0x45, 0xAE, 0x8E,
+    0xE0, 0x5C, 0x45, 0xEB, 0x4E, 0xA4, 0x71, 0xB4, 0xE9, 0x64, 0x52, 0x0F, 0x02, 0x07, 0x51, 0xE3,
+    0xAB, 0xBC, 0xF3, 0x0D, 0x07, 0xD9, 0xBA, 0x38, 0x9C, 0xB2, 0x91, 0x2B, 0x9E, 0xAF, 0x09, 0x37,
+    0x91, 0x05, 0xE2, 0xEE, 0x2C, 0xA0, 0x2A, 0xFD, 0xB7, 0xB6, 0x6E, 0x65, 0x66, 0x03, 0x45, 0x8E,
+    0xC3, 0x45, 0x71, 0x2E, 0x15, 0x4D, 0x1A, 0xE1, 0x1A, 0x13, 0x35, 0x66, 0xD7, 0xE6, 0xCC, 0x65,
+    0xD9, 0x60, 0x95, 0x39, 0x06, 0xC4, 0xD1, 0x37, 0x56, 0xF9, 0xBA, 0x18, 0x94, 0x92, 0xB1, 0xAA,
+    0x19, 0xA7, 0xC7, 0xDF, 0xD1, 0x57, 0x2F, 0x95, 0x68, 0x94, 0xE9, 0xAC, 0xD7, 0x42, 0x60, 0x26,
+    0xD8, 0x0C, 0x35, 0xDB, 0x01, 0x24, 0xE1, 0xDB, 0x2B, 0x56, 0x59, 0xFB, 0x34, 0x34, 0x6B, 0x3E,
+    0x78, 0x51, 0x96, 0x1A, 0x52, 0x31, 0xD5, 0x0D, 0x60, 0xB8, 0x4B, 0x08, 0x42, 0x6A, 0x09, 0x99,
+    0x70, 0xED, 0xF1, 0x7F, 0x17, 0xF7, 0xDE, 0xDB, 0xC1, 0x9E, 0x36, 0x3C, 0xA7, 0xCA, 0x45, 0x06,
+    0xCC, 0x8B, 0xC1, 0x0A, 0xBF, 0x23, 0x9B, 0x0B, 0x62, 0xC9, 0x42, 0xCC, 0x29, 0x31, 0x26, 0x41,
+    0xDB, 0x17, 0xB9, 0x5E, 0xDE, 0x52, 0xF5, 0x8E, 0xAA, 0x9B, 0xAA, 0x1E, 0xE0, 0x5F, 0x64, 0x53,
+    0xCE, 0xCE, 0x7F, 0x20, 0x44, 0x74, 0x3C, 0x1D, 0xBD, 0xB2, 0x72, 0xD7, 0x12, 0xFD, 0xBB, 0xD2,
+    0x52, 0x84, 0xA8, 0x2E, 0x59, 0xFB, 0xEC, 0x50, 0x61, 0xCC, 0xDF, 0x58, 0xA6, 0xAF, 0xD7, 0xFB,
+    0x45, 0x54, 0x35, 0x25, 0xFC, 0xA9, 0x9C, 0x8C, 0xF6, 0x87, 0x36, 0xCF, 0xA0, 0x2D, 0xD3, 0xE9,
+    0x30, 0x09, 0x9B, 0x22, 0xF7, 0x2E, 0x86, 0x41, 0xBB, 0x54, 0xF5, 0xE7, 0x8B, 0x8F, 0xF6, 0x92,
+    0x3F, 0x6E, 0xA6, 0x37, 0xCD, 0xEE, 0x72, 0xA0, 0xE5, 0xC7, 0xD1, 0x6E, 0x09, 0x75, 0xC0, 0x42,
+    0x60, 0x62, 0xCC, 0x50, 0x9C, 0x4C, 0x1C, 0x01, 0x34, 0x5E, 0x1D, 0xCC, 0x01, 0xD7, 0x29, 0x7F,
+    0x02, 0xC5, 0x55, 0xBF, 0x6F, 0xD3, 0x40, 0x14, 0xFE, 0x1C, 0x37, 0xB1, 0x50, 0x5A, 0xDC, 0xA5,
+    0x20, 0x31, 0xE0, 0xA5, 0x03, 0x42, 0x01, 0x77, 0x60, 0x40, 0x88, 0xC6, 0x87, 0x18, 0x58, 0x2B,
+    0x51, 0x89, 0x95, 0xFF, 0xA0, 0x0B, 0x2B, 0x75, 0xAA, 0x8E, 0x2C, 0x5D, 0xD8, 0x19, 0xBA, 0x94,
+    0x0E, 0xCD, 0xC8, 0x10, 0x61, 0xB7, 0x1D, 0x58, 0x8D, 0x18, 0x59, 0x22, 0xD1, 0xA9, 0x53, 0x90,
+    0x3C, 0x98, 0xE2, 0xF8, 0xF1, 0x3D, 0x27, 0x8E, 0x9A, 0xFE, 0x18, 0x2A, 0x50, 0x39, 0xDF, 0xBD,
+    0xBB, 0xBC, 0xBB, 0x7B, 0xEF, 0xFB, 0xDE, 0xBB, 0xBB, 0x00, 0xF3, 0x60, 0xF9, 0xC4, 0x56, 0x1B,
+    0x52, 0x34, 0xDF, 0x19, 0xE0, 0x81, 0x95, 0x80, 0xFA, 0x72, 0xA6, 0x2A, 0x0D, 0xF9, 0x05, 0x04,
+    0x52, 0x00, 0x42, 0x51, 0x93, 0xAD, 0x19, 0xD8, 0x19, 0xF5, 0xF6, 0x60, 0x5A, 0x14, 0xDC, 0x0F,
+    0x51, 0x19, 0x4A, 0x0E, 0x38, 0x22, 0x1D, 0xE0, 0xB6, 0xE8, 0x5C, 0xA0, 0xEB, 0xBD, 0x5C, 0xC5,
+    0xD0, 0x32, 0x08, 0x86, 0xB6, 0x88, 0xE4, 0x2E, 0x45, 0xEA, 0x53, 0xF4, 0x03, 0x0A, 0xD3, 0x10,
+    0xF9, 0x30, 0x76, 0x79, 0x83, 0xDB, 0x63, 0x38, 0x39, 0x9C, 0xCD, 0xD8, 0x31, 0xAD, 0xB1, 0xB6,
+    0x26, 0x7D, 0x5B, 0x72, 0x9B, 0x08, 0x69, 0x73, 0x99, 0x88, 0x53, 0xFA, 0xCB, 0x88, 0x2F, 0x81,
+    0x45, 0xDB, 0xC1, 0xB3, 0x93, 0xBD, 0xAF, 0x22, 0x03, 0x91, 0xAC, 0x21, 0x47, 0xD7, 0x8A, 0x9B,
+    0xDE, 0xB0, 0xA4, 0x10, 0x9F, 0xA8, 0xB0, 0x62, 0x95, 0x2A, 0x6E, 0xA9, 0x08, 0xD9, 0xA2, 0x8C,
+    0x20, 0x40, 0xBC, 0x4F, 0x01, 0xD7, 0x94, 0x01, 0x0F, 0x0A, 0x58, 0x51, 0x5A, 0x4E, 0xBB, 0xC9,
+    0xFA, 0x6E, 0x4A, 0xE7, 0x04, 0x6B, 0x09, 0xA7, 0xB6, 0x4A, 0x6B, 0x37, 0x49, 0x74, 0x96, 0x78,
+    0xB8, 0xC4, 0xA0, 0x5E, 0x65, 0xA3, 0x85, 0x3E, 0x99, 0xBF, 0x20, 0xC4, 0x5A, 0xA1, 0xBF, 0x7B,
+    0x2A, 0x16, 0x71, 0x71, 0xB9, 0xFE, 0xD4, 0xD5, 0xF9, 0xF5, 0x9B, 0x70, 0x3D, 0xDA, 0x23, 0x31,
+    0x06, 0xC3, 0x9C, 0xC2, 0xE3, 0x17, 0x44, 0x13, 0x2F, 0x97, 0x13, 0x9A, 0xC7, 0xC8, 0xC0, 0xA5,
+    0xAB, 0x35, 0x72, 0xF6, 0x62, 0xD8, 0xA9, 0xF7, 0x71, 0xE8, 0x89, 0xD0, 0x78, 0x67, 0xAD, 0x30,
+    0x21, 0x2D, 0xFF, 0x64, 0x93, 0x2F, 0xB2, 0x77, 0x4C, 0x63, 0x81, 0x5A, 0xC8, 0x2B, 0xCC, 0xAE,
+    0x86, 0x76, 0x5A, 0xE5, 0x55, 0xD1, 0xD6, 0xD3, 0x00, 0x67, 0xA2, 0x8A, 0x26, 0x47, 0x3C, 0x55,
+    0x0C, 0x09, 0x4A, 0xC7, 0x23, 0x15, 0x5E, 0xEB, 0xFA, 0x1D, 0x1D, 0xCD, 0x2A, 0x7C, 0x06, 0x17,
+    0x9F, 0xAB, 0x48, 0x6B, 0x70, 0x73, 0xAD, 0x77, 0x8A, 0xED, 0x80, 0x81, 0x61, 0x28, 0xAA, 0x6A,
+    0x8D, 0x6A, 0x5A, 0xCA, 0xE1, 0x8A, 0x25, 0x59, 0x4D, 0x32, 0x8B, 0x6B, 0x9A, 0x4C, 0xDE, 0x3D,
+    0xAD, 0xCD, 0x01, 0xEA, 0x06, 0x8F, 0xD0, 0x65, 0xD2, 0x19, 0x0D, 0xB4, 0x07, 0x15, 0xE0, 0x37,
+    0x67, 0xD3, 0x74, 0x3D, 0x4C, 0xDD, 0xB2, 0x7A, 0x68, 0x79, 0xE8, 0x3D, 0x44, 0x3E, 0x73, 0x25,
+    0x5E, 0x57, 0x80, 0x58, 0xDB, 0x3D, 0xD9, 0x62, 0x5A, 0x25, 0x66, 0xAE, 0xE5, 0x6A, 0x10, 0xA9,
+    0xA5, 0xAE, 0x34, 0x15, 0xA0, 0x11, 0xED, 0xD0, 0x0A, 0xDA, 0x0C, 0x1D, 0xEE, 0x47, 0x3B, 0x34,
+    0xA6, 0xF6, 0xD6, 0x81, 0xB7, 0x50, 0x19, 0xAE, 0x22, 0x2C, 0x10, 0x15, 0x8C, 0x5E, 0xB9, 0xD3,
+    0xCA, 0xE7, 0x80, 0xC7, 0xDD, 0x04, 0xF6, 0x73, 0x7A, 0x5C, 0xAC, 0x9F, 0x89, 0xF1, 0x82, 0xC1,
+    0xC2, 0xCB, 0x9C, 0x97, 0x26, 0xE8, 0xC0, 0xFF, 0x96, 0xD1, 0xE1, 0x78, 0x60, 0xE9, 0xC0, 0x9B,
+    0x0C, 0x0E, 0x49, 0x3D, 0x0F, 0xCC, 0xB9, 0x01, 0xA7, 0x0E, 0xB8, 0x3D, 0xF7, 0xFB, 0x08, 0xF7,
+    0xE5, 0x38, 0xCA, 0xF4, 0x0A, 0x18, 0xB6, 0x01, 0x6F, 0xCB, 0x10, 0xCD, 0xF2, 0xF6, 0x8C, 0x4B,
+    0xB0, 0x11, 0x3B, 0x77, 0x5B, 0xE8, 0x86, 0xA6, 0x81, 0x95, 0x53, 0x18, 0x96, 0xE1, 0x6E, 0x26,
+    0xC8, 0x46, 0x5D, 0xDE, 0x86, 0x7B, 0xD8, 0x2F, 0xBB, 0x83, 0x01, 0x72, 0x9F, 0x5D, 0x6A, 0xE7,
+    0x3C, 0xFE, 0x71, 0x79, 0xBF, 0x7E, 0xC7, 0xC1, 0xB0, 0x87, 0x85, 0x72, 0xDF, 0x3C, 0xCD, 0x8B,
+    0xE1, 0x05, 0xDD, 0x3E, 0x7F, 0xC5, 0xED, 0x8A, 0xD3, 0x8F, 0x7F, 0xC0, 0xC9, 0xBB, 0x9C, 0x53,
+    0x24, 0x03, 0x5F, 0x8E, 0xFF, 0x9A, 0x4C, 0x97, 0x9F, 0x63, 0x78, 0x0E, 0xDB, 0xAF, 0xF8, 0x6A,
+    0xF3, 0xF5, 0x9E, 0x64, 0x7E, 0xAA, 0x58, 0xAB, 0xC0, 0x6A, 0x10, 0x8F, 0x58, 0x4D, 0xA5, 0xCC,
+    0x9B, 0xA2, 0x77, 0x11, 0x2B, 0x1D, 0xE8, 0x94, 0xCF, 0xED, 0x07, 0x05, 0xFF, 0x45, 0xBC, 0x62,
+    0x57, 0x36, 0xF4, 0xC1, 0xD2, 0x94, 0xE9, 0x65, 0x4B, 0xC8, 0xE6, 0xA8, 0xF4, 0x33, 0xC7, 0xAF,
+    0x6F, 0x25, 0xCD, 0xF7, 0x3D, 0x1E, 0x56, 0x92, 0xEC, 0x9C, 0x09, 0xEE, 0x84, 0xA0, 0x76, 0x63,
+    0x82, 0xDA, 0xF9, 0x63, 0x9E, 0x26, 0xD8, 0x1F, 0xBD, 0x86, 0xE4, 0xD9, 0xB3, 0xE5, 0x7B, 0x6C,
+    0x31, 0xDF, 0x96, 0x3E, 0x99, 0x4B, 0x7C, 0x07, 0x9C, 0x86, 0xFE, 0x25, 0x24, 0x63, 0xCD, 0xFF,
+    0xE2, 0x78, 0x49, 0xF9, 0x03, 0xC5, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xC6, 0x43, 0x62,
+    0x81, 0x43, 0xE6, 0x0A, 0x4E, 0x4A, 0x03, 0x6E, 0x11, 0xD2, 0xC5, 0x4D, 0x8A, 0x2B, 0xEE, 0xCE,
+    0x86, 0x14, 0xB4, 0x57, 0x90, 0x9A, 0x86, 0x02, 0xD1, 0x90, 0x22, 0x25, 0xD1, 0x59, 0xBA, 0x82,
+    0xBF, 0x41, 0x19, 0x1D, 0x91, 0x00, 0x89, 0x02, 0xA1, 0xCB, 0x7A, 0xEE, 0xB6, 0xA0, 0xA0, 0x31,
+    0xA2, 0xA4, 0x31, 0x0A, 0x15, 0x14, 0x0C, 0xC8, 0x80, 0x45, 0xBC, 0xFB, 0xF8, 0xDE, 0xEC, 0xEE,
+    0x05, 0x9C, 0x50, 0x21, 0x14, 0xDF, 0xF9, 0xCD, 0xDB, 0xF1, 0xEC, 0x7B, 0xDF, 0xF7, 0xBD, 0xF7,
+    0xBC, 0x28, 0x80, 0x17, 0xAE, 0x00, 0xAD, 0x47, 0x76, 0x1F, 0xE0, 0xA7, 0x7F, 0x5C, 0xB6, 0xC5,
+    0xB0, 0x0F, 0x77, 0xBC, 0x5A, 0xE6, 0x1D, 0xC6, 0x83, 0xD5, 0x52, 0xC0, 0x9D, 0x07, 0x2E, 0x55,
+    0x79, 0x26, 0x32, 0x3A, 0x11, 0x2F, 0x72, 0x6A, 0xE5, 0x3B, 0x6F, 0x0E, 0x81, 0x4B, 0xC0, 0x5B,
+    0x0C, 0x95, 0x04, 0x33, 0xC2, 0xF9, 0xAC, 0xC3, 0x11, 0x9E, 0x03, 0xAA, 0x49, 0x6C, 0x6C, 0xF3,
+    0x64, 0x55, 0x7A, 0x14, 0x5D, 0x59, 0xAF, 0x4D, 0xBB, 0x31, 0xF9, 0xC4, 0xF8, 0xB2, 0xFA, 0x37,
+    0xA3, 0x4F, 0x0B, 0x46, 0xF1, 0x05, 0x13, 0xF9, 0x7C, 0xF9, 0xB1, 0xD4, 0xB9, 0x88, 0x54, 0x04,
+    0x25, 0x48, 0x45, 0x16, 0x40, 0x23, 0x3F, 0xAC, 0x73, 0x12, 0xDA, 0xA1, 0xE9, 0xE1, 0xEA, 0xA2,
+    0x32, 0xBD, 0xED, 0x51, 0x54, 0x5B, 0x30, 0x78, 0x0A, 0x6B, 0xB8, 0xCA, 0x76, 0x20, 0xE9, 0x1A,
+    0x3D, 0x4A, 0xD0, 0x27, 0x97, 0xDA, 0x06, 0x50, 0x00, 0x8F, 0x53, 0x6E, 0x25, 0xE4, 0x8F, 0xAC,
+    0x75, 0x01, 0x4C, 0xE7, 0x51, 0x32, 0x1B, 0x28, 0x02, 0xCD, 0xEF, 0x21, 0x92, 0x8B, 0x04, 0x6F,
+    0x8E, 0x48, 0x96, 0xCA, 0xEA, 0xE1, 0x80, 0x64, 0xA1, 0xCE, 0xB7, 0x03, 0x8C, 0x3A, 0xF9, 0x85,
+    0x33, 0xEF, 0x61, 0x46, 0x25, 0x33, 0x71, 0xF8, 0xE8, 0x9C, 0x5F, 0x1F, 0x95, 0xD8, 0x99, 0xFC,
+    0xD8, 0x0C, 0x91, 0x17, 0xEF, 0x10, 0x69, 0x65, 0xB2, 0xA4, 0xA6, 0xA9, 0x22, 0x6E, 0x79, 0xBF,
+    0xA8, 0x4E, 0xC3, 0xDB, 0x7C, 0x84, 0xC7, 0x35, 0xE3, 0xB2, 0xA9, 0xD9, 0xC1, 0xBA, 0x66, 0x5C,
+    0x7A, 0x3B, 0xE6, 0xB1, 0x66, 0x2C, 0xDD, 0x23, 0x5F, 0x2E, 0x4E, 0xB1, 0xBD, 0xC3, 0x50, 0x0C,
+    0xD7, 0x01, 0x57, 0x19, 0xE3, 0x88, 0xEE, 0x3B, 0x5C, 0xEF, 0xAC, 0x04, 0x09, 0x71, 0x39, 0x88,
+    0x8B, 0xAD, 0xE3, 0x72, 0x03, 0x9F, 0x4E, 0x64, 0xA3, 0x2E, 0xBC, 0x66, 0xA5, 0x16, 0xDA, 0xF6,
+    0xB3, 0xB8, 0x45, 0xFC, 0x1A, 0x2D, 0xD5, 0xAF, 0x24, 0x83, 0x53, 0x9C, 0x8E, 0x05, 0x65, 0xC0,
+    0x92, 0x58, 0xF3, 0xCE, 0x8C, 0xEC, 0x11, 0xF1, 0xAE, 0xB3, 0x7D, 0x2A, 0x75, 0x59, 0xB9, 0xAE,
+    0x14, 0xEE, 0x14, 0xE7, 0xCB, 0x65, 0x16, 0xD0, 0xB8, 0x5F, 0xA9, 0x82, 0x19, 0x9B, 0xE3, 0x61,
+    0x01, 0xFB, 0x68, 0xE1, 0xFE, 0x08, 0x70, 0x12, 0x72, 0xCA, 0x5D, 0x48, 0x55, 0x2E, 0x19, 0x79,
+    0x44, 0x33, 0x50, 0xF2, 0xCE, 0x48, 0x0B, 0x2B, 0x95, 0x65, 0x11, 0x1C, 0xCB, 0xA2, 0x69, 0x77,
+    0x35, 0xF5, 0x03, 0x4D, 0xFC, 0x33, 0x4D, 0xF6, 0x06, 0xE1, 0xBD, 0x8A, 0xDB, 0xD3, 0x62, 0xBF,
+    0xC6, 0xFB, 0x5E, 0x49, 0xC3, 0x66, 0x86, 0x19, 0xF2, 0x1A, 0x49, 0xEF, 0xFC, 0x9E, 0x0D, 0xCE,
+    0xCF, 0x6C, 0xC8, 0xBE, 0x91, 0x37, 0xBB, 0xF4, 0xA1, 0x7C, 0xDD, 0x5A, 0xEA, 0xEE, 0xA3, 0x49,
+    0xE4, 0x27, 0xA9, 0x8D, 0xCC, 0xB5, 0xDE, 0xAF, 0xD3, 0xCC, 0xB0, 0xDC, 0x28, 0x10, 0x59, 0xD2,
+    0x7C, 0x49, 0x19, 0x77, 0xD2, 0x1A, 0x97, 0xF1, 0xFC, 0xA4, 0xB5, 0x28, 0xC4, 0xAC, 0xA8, 0xA9,
+    0x15, 0x0B, 0x3B, 0x64, 0x2A, 0x83, 0x92, 0x4E, 0x54, 0x06, 0x15, 0x06, 0x0D, 0xF7, 0xEC, 0xC0,
+    0x80, 0x05, 0x49, 0x42, 0x18, 0x2C, 0x63, 0x0A, 0x94, 0x0C, 0x68, 0x95, 0x14, 0xE7, 0xE5, 0xB1,
+    0x93, 0xAA, 0xD3, 0xF8, 0x48, 0x99, 0x87, 0xFD, 0x2A, 0xC7, 0x2B, 0x6C, 0x01, 0x36, 0x7D, 0x7E,
+    0x17, 0xA6, 0xDB, 0x21, 0x80, 0x6B, 0x4F, 0xB6, 0x77, 0x9E, 0xB2, 0x87, 0xD9, 0xCE, 0x5D, 0x5E,
+    0xE5, 0x55, 0xC9, 0x76, 0xBE, 0x4B, 0x60, 0x63, 0x5E, 0x9B, 0xE1, 0x01, 0x2C, 0x45, 0x4E, 0x19,
+    0xCB, 0x11, 0x44, 0xDE, 0xAF, 0x12, 0x11, 0x82, 0x25, 0x94, 0xA2, 0xE5, 0x13, 0xFE, 0x6B, 0xCB,
+    0x53, 0xFB, 0xF6, 0x6F, 0x41, 0xD3, 0x96, 0xF2, 0xCD, 0x38, 0x51, 0x2E, 0x90, 0x85, 0xE8, 0xE9,
+    0x27, 0xC6, 0xEA, 0xFF, 0xE6, 0x9E, 0x6D, 0x6A, 0x80, 0xEB, 0x6A, 0xF6, 0xD4, 0x7C, 0x80, 0xA7,
+    0x5E, 0x5A, 0xC8, 0xD1, 0xA8, 0x41, 0x34, 0xEF, 0x9D, 0x7C, 0xA2, 0x88, 0x8B, 0x5E, 0x83, 0x92,
+    0x57, 0x22, 0x35, 0xE3, 0x69, 0x5D, 0x0B, 0xDD, 0x6F, 0x82, 0x6E, 0xF9, 0x35, 0xA0, 0x22, 0xA6,
+    0xEE, 0x75, 0xAB, 0xD5, 0x2D, 0x1E, 0x2D, 0xF4, 0xE8, 0x11, 0x43, 0xF5, 0x6A, 0x06, 0x35, 0xA3,
+    0x1A, 0xD6, 0x21, 0xC4, 0x8A, 0x50, 0x74, 0x05, 0x94, 0xD5, 0x13, 0x20, 0xA5, 0x2C, 0x88, 0xA5,
+    0xDD, 0xBE, 0xC5, 0x93, 0x9C, 0x1C, 0x4E, 0x88, 0x4A, 0xC7, 0x68, 0x3A, 0xFD, 0x1D, 0x52, 0xBE,
+    0x23, 0xA2, 0x20, 0xC2, 0x53, 0x43, 0x29, 0x9B, 0x1A, 0xC7, 0xBE, 0xC6, 0x42, 0xCD, 0xF2, 0xC2,
+    0x3C, 0x23, 0x86, 0x3A, 0xF7, 0xA3, 0xCE, 0x75, 0x6C, 0xBB, 0x29, 0x88, 0x96, 0x0C, 0xCD, 0xAD,
+    0xB7, 0xC9, 0xAB, 0x8F, 0x80, 0xC9, 0xCB, 0x75, 0x4A, 0x52, 0x79, 0x1D, 0x45, 0x92, 0x09, 0xDF,
+    0x68, 0xA4, 0x76, 0xAC, 0x30, 0xB7, 0xF8, 0x87, 0x97, 0x55, 0xB4, 0xF4, 0x43, 0xC6, 0x35, 0x72,
+    0x51, 0xC4, 0x97, 0x9E, 0x1D, 0xC5, 0xA4, 0xBA, 0x8C, 0xAB, 0x89, 0xC7, 0x7E, 0x88, 0x4C, 0xD3,
+    0xFF, 0x5E, 0xC4, 0x19, 0x3B, 0xF6, 0x74, 0x6B, 0x0F, 0x39, 0x3B, 0x22, 0xE9, 0xF0, 0x05, 0x3B,
+    0xD6, 0x79, 0x9D, 0x41, 0x0E, 0xC5, 0xD4, 0xD9, 0x5F, 0xFD, 0xF0, 0xBC, 0x9B, 0xDE, 0x3C, 0x0B,
+    0x9F, 0xEF, 0x69, 0x1B, 0xF1, 0x1D, 0x73, 0xBD, 0x4F, 0xDA, 0x3B, 0xD7, 0x70, 0x23, 0xAF, 0xE6,
+    0xF7, 0xAF, 0xDC, 0xFE, 0xEC, 0x2B, 0x3B, 0x6C, 0x5D, 0x52, 0x28, 0x85, 0x8C, 0x8D, 0xDC, 0x5B,
+    0xE3, 0xA2, 0xB0, 0x72, 0xFE, 0xE7, 0xC9, 0xC9, 0xE1, 0x2E, 0x76, 0x03, 0xBE, 0xFF, 0xED, 0xFD,
+    0x44, 0x7A, 0x45, 0xE2, 0xE6, 0xBF, 0x8C, 0x4D, 0xFC, 0x3D, 0xFE, 0x0B, 0x8D, 0x55, 0xCF, 0x8F,
+    0x14, 0x45, 0x14, 0xFE, 0xBA, 0x9A, 0xA5, 0x61, 0x7A, 0xA0, 0xF7, 0x20, 0x0A, 0xAC, 0xD0, 0x1C,
+    0xBC, 0xA8, 0xCC, 0xF6, 0x1C, 0xE6, 0xB0, 0x21, 0x33, 0x5B, 0x85, 0x78, 0xE3, 0x20, 0x26, 0x10,
+    0x2F, 0xC6, 0x8B, 0x57, 0x23, 0x1C, 0xBC, 0x98, 0x80, 0xDD, 0xCB, 0x5E, 0x4D, 0x18, 0xFF, 0x03,
+    0x12, 0xBD, 0x30, 0x6A, 0xC0, 0xC4, 0x03, 0x24, 0x90, 0x19, 0x99, 0x03, 0xD7, 0x0E, 0x44, 0xAF,
+    0x76, 0x84, 0xF8, 0x2B, 0x26, 0xB6, 0xA6, 0x49, 0x1A, 0xD2, 0xDD, 0xCF, 0xF7, 0x6A, 0x86, 0x5D,
+    0x46, 0x88, 0xB1, 0xA6, 0xF6, 0xEB, 0xEA, 0x7A, 0x5D, 0xEF, 0xBD, 0xEF, 0xFD, 0xA8, 0x05, 0xA0,
+    0x51, 0x6A, 0xA7, 0x8A, 0x55, 0x35, 0x3E, 0x51, 0x45, 0x1B, 0x7B, 0x91, 0xF6, 0x1C, 0x84, 0x9B,
+    0xAD, 0x73, 0xEF, 0x7F, 0x1D, 0x26, 0xB8, 0x00, 0x37, 0xF3, 0x53, 0x7C, 0x82, 0x1A, 0x7E, 0xD6,
+    0x32, 0xB8, 0x82, 0xFD, 0xE8, 0x75, 0xBC, 0x64, 0xB5, 0x44, 0x94, 0xA0, 0x6F, 0xE5, 0x58, 0x87,
+    0x9B, 0xB3, 0x1A, 0xB7, 0xC0, 0x41, 0x38, 0x5F, 0x9C, 0xF1, 0x8B, 0x78, 0xB3, 0xD4, 0x1B, 0x55,
+    0x90, 0x21, 0xFC, 0xAB, 0x89, 0xEE, 0x56, 0x7A, 0xB3, 0x18, 0x83, 0x4E, 0xCA, 0x76, 0xF4, 0x1D,
+    0x6F, 0xAB, 0xE4, 0xF3, 0xF2, 0x3D, 0x95, 0xA0, 0xB7, 0xC7, 0x2D, 0x1F, 0xF4, 0xD8, 0x83, 0x2B,
+    0xA7, 0x88, 0x52, 0xF8, 0x06, 0xAB, 0xC0, 0x75, 0xA8, 0xCC, 0xF3, 0x5A, 0x47, 0x7B, 0x68, 0x77,
+    0xBB, 0x2F, 0x43, 0xA1, 0xED, 0x7C, 0x1C, 0x54, 0x3A, 0xFF, 0xD0, 0x74, 0x91, 0x28, 0x74, 0x5F,
+    0x1F, 0x76, 0x15, 0x78, 0xEC, 0x24, 0xDA, 0xA4, 0xE6, 0x32, 0xAF, 0x74, 0x70, 0xE7, 0xEF, 0x5A,
+    0xB6, 0x16, 0xA8, 0x3C, 0xA1, 0xB0, 0xF4, 0xB6, 0xB8, 0x10, 0x4D, 0xCB, 0xF8, 0x64, 0xBE, 0x4B,
+    0x99, 0x63, 0xA6, 0x8D, 0xCF, 0x3E, 0xD0, 0x06, 0x6C, 0x5D, 0x25, 0x6B, 0xAA, 0x76, 0x86, 0x07,
+    0x3A, 0x03, 0x19, 0x9A, 0x82, 0x77, 0xA6, 0xC9, 0xB5, 0xEC, 0xE8, 0x22, 0x43, 0xF4, 0x84, 0xDD,
+    0x6A, 0xAE, 0xD2, 0x7C, 0x0D, 0xD7, 0x42, 0x33, 0xFD, 0xAA, 0x7D, 0xEE, 0x9B, 0x3B, 0x6E, 0xB9,
+    0xBC, 0x04, 0x9C, 0xB9, 0x48, 0x0D, 0x9B, 0x5D, 0x1A, 0xE5, 0x63, 0x9A, 0xF0, 0x62, 0x41, 0xFA,
+    0xDA, 0x68, 0x14, 0x10, 0x4D, 0x89, 0xF2, 0x5E, 0xBB, 0xBD, 0xB6, 0xBC, 0xE6, 0xEF, 0x55, 0xD3,
+    0xEF, 0x73, 0xAA, 0x74, 0xD3, 0x6B, 0x75, 0xED, 0x4F, 0xF3, 0xE1, 0xC3, 0x6F, 0xEE, 0x7E, 0x65,
+    0x73, 0x57, 0xF7, 0x76, 0xFB, 0xC8, 0x09, 0xEC, 0x1F, 0xFE, 0xEA, 0xE1, 0x8F, 0x5E, 0xBA, 0xA0,
+    0x66, 0xB9, 0xDF, 0x3A, 0xB4, 0x0C, 0xCF, 0x20, 0xE0, 0x8F, 0x81, 0x01, 0x70, 0x1E, 0x78, 0x86,
+    0xED, 0xBE, 0x33, 0x01, 0x59, 0xE7, 0x5F, 0x70, 0x16, 0x83, 0x33, 0x1F, 0x23, 0xCA, 0xC6, 0x54,
+    0xC9, 0xAA, 0xA3, 0x7E, 0x4A, 0x57, 0x07, 0xEA, 0x7E, 0xBA, 0x3E, 0x70, 0x19, 0x5E, 0x55, 0x43,
+    0xD6, 0xD4, 0xB0, 0x2B, 0xDA, 0xFE, 0xEC, 0x38, 0x82, 0x9D, 0xC0, 0x84, 0x23, 0xFF, 0xF0, 0xD3,
+    0x63, 0xC5, 0x1D, 0xFF, 0xDD, 0x73, 0x71, 0xD2, 0x3A, 0x85, 0x14, 0x6D, 0x70, 0xD6, 0x8E, 0xCC,
+    0x55, 0xDE, 0x14, 0xA8, 0x66, 0xE0, 0x51, 0x72, 0x5A, 0x47, 0x3F, 0x94, 0xD0, 0x31, 0x74, 0x72,
+    0x6B, 0xCC, 0x1B, 0x25, 0x42, 0xEC, 0x33, 0x88, 0x66, 0x9E, 0xF2, 0xD8, 0x37, 0x3F, 0x17, 0x66,
+    0xCE, 0xC6, 0xC3, 0xDC, 0x3F, 0xB9, 0x91, 0xF7, 0x07, 0xCE, 0xE3, 0xFC, 0xB2, 0x33, 0x36, 0x73,
+    0x49, 0x50, 0xE3, 0xA3, 0x9B, 0xEB, 0xEA, 0x5E, 0x1A, 0x9D, 0x6D, 0x61, 0xA5, 0x98, 0x6D, 0xEE,
+    0xE0, 0x13, 0x53, 0xE0, 0x38, 0x5B, 0x5A, 0xE6, 0xD7, 0x5D, 0x87, 0xDA, 0x3B, 0xEC, 0xFE, 0x6E,
+    0x81, 0x34, 0x03, 0x9C, 0xD4, 0x1B, 0x62, 0x25, 0xC1, 0x41, 0xFA, 0x8D, 0x77, 0x56, 0xE8, 0x11,
+    0x70, 0x03, 0xCE, 0x4D, 0x58, 0x11, 0x93, 0xC3, 0x9E, 0xED, 0x30, 0x38, 0xB3, 0xC7, 0x05, 0x97,
+    0x64, 0xE4, 0x23, 0x1E, 0x57, 0xAD, 0x1D, 0x27, 0x9D, 0x7F, 0xA1, 0x78, 0xB1, 0x0E, 0x49, 0x39,
+    0x22, 0xB3, 0x7D, 0x90, 0xA8, 0xD1, 0x44, 0x97, 0x0C, 0x5C, 0x96, 0x17, 0x36, 0x0D, 0x01, 0xBF,
+    0xB0, 0x0E, 0xA2, 0x6A, 0x7D, 0xF6, 0xB2, 0x2D, 0x21, 0xBA, 0x4F, 0x54, 0xCE, 0xCE, 0x24, 0xCA,
+    0xEC, 0x77, 0xB2, 0xC0, 0x9C, 0x77, 0xD3, 0x2D, 0x6D, 0xEE, 0x4C, 0x3A, 0x78, 0xF6, 0x9C, 0x94,
+    0x4B, 0xB9, 0xA5, 0x7E, 0x26, 0x11, 0xC3, 0x5B, 0x1A, 0x2D, 0x89, 0x15, 0x76, 0x3E, 0x89, 0x89,
+    0x46, 0x09, 0x5C, 0xA9, 0x3B, 0xAB, 0xDA, 0x82, 0xB7, 0x0D, 0x99, 0xC0, 0xCF, 0x37, 0x18, 0xA4,
+    0xB9, 0xBC, 0x9A, 0xDB, 0xD3, 0xCB, 0x25, 0x57, 0x29, 0x57, 0x35, 0xC3, 0x00, 0xDE, 0x04, 0x1D,
+    0x81, 0xC1, 0x1C, 0xD2, 0x25, 0x91, 0x06, 0x25, 0xB7, 0x7A, 0xC0, 0x2A, 0x58, 0x41, 0x07, 0xD6,
+    0xC0, 0x75, 0xEB, 0xCE, 0xF3, 0x86, 0x62, 0xFA, 0x11, 0xD1, 0x5D, 0x09, 0x17, 0xBF, 0xE5, 0x36,
+    0xD7, 0xEE, 0xFC, 0x21, 0xBE, 0x9B, 0x85, 0x07, 0xFB, 0x5B, 0x6E, 0x3F, 0xC4, 0xF5, 0x95, 0x46,
+    0x78, 0x37, 0x2C, 0x76, 0x2A, 0x76, 0xCE, 0xCD, 0x38, 0xEA, 0x21, 0xDF, 0x29, 0x38, 0x3D, 0x10,
+    0xFF, 0x7F, 0x1F, 0x0D, 0x31, 0x66, 0xB1, 0x4F, 0x94, 0xD9, 0x8A, 0xB3, 0xDC, 0x62, 0xA1, 0x5B,
+    0xC3, 0xAB, 0x34, 0x5D, 0xA5, 0xDB, 0x1C, 0x8C, 0x82, 0x43, 0x47, 0x12, 0xA8, 0x09, 0xCE, 0xD2,
+    0x70, 0xE6, 0xDA, 0x4E, 0xA9, 0x04, 0x2D, 0x11, 0x93, 0xB0, 0x29, 0x1A, 0xEE, 0xB0, 0x56, 0xAD,
+    0x77, 0x4F, 0x43, 0x23, 0xCC, 0x48, 0x30, 0x96, 0x0E, 0xE1, 0x68, 0x25, 0xC0, 0x4B, 0x24, 0x32,
+    0x2D, 0xDF, 0x87, 0x52, 0xE3, 0x61, 0xED, 0x18, 0xE8, 0x5A, 0xEA, 0xA6, 0x12, 0x5B, 0x05, 0x93,
+    0xA6, 0x8C, 0x0D, 0x92, 0xE1, 0x5E, 0x7B, 0xD2, 0x68, 0xE1, 0x34, 0xAF, 0x74, 0xB0, 0x05, 0x6F,
+    0xDD, 0x2B, 0x6A, 0x7D, 0xE9, 0x97, 0x47, 0x14, 0xFF, 0x68, 0xB5, 0xA1, 0x92, 0x79, 0xBC, 0x8A,
+    0x2F, 0xD6, 0xFF, 0x8E, 0x63, 0x6C, 0x23, 0xF6, 0x5F, 0xD3, 0x3C, 0x35, 0x13, 0x99, 0x31, 0xCF,
+    0xC9, 0x7C, 0x72, 0x62, 0xC3, 0x09, 0xC6, 0x50, 0x15, 0xFC, 0x1C, 0x91, 0x5D, 0x4A, 0x1A, 0xE5,
+    0x0A, 0x6B, 0x84, 0x36, 0xDF, 0xC5, 0x7C, 0xB0, 0x96, 0x2C, 0x70, 0x6A, 0x79, 0x59, 0x09, 0xFB,
+    0x80, 0x3F, 0x74, 0x7C, 0x26, 0x94, 0x6A, 0x02, 0x15, 0x2E, 0x81, 0x59, 0x72, 0xB8, 0x84, 0x31,
+    0x73, 0x93, 0x96, 0xB4, 0xF9, 0xE7, 0x3F, 0x21, 0x90, 0x4B, 0x5D, 0x72, 0xF1, 0x48, 0x2D, 0x04,
+    0xB6, 0xDE, 0xDC, 0xC4, 0x46, 0x8E, 0x95, 0x7F, 0x59, 0x61, 0x8D, 0x05, 0x41, 0x72, 0x58, 0x04,
+    0xB9, 0x97, 0x70, 0xE5, 0x76, 0x1C, 0xA9, 0x32, 0xDF, 0x7C, 0xCB, 0x02, 0x37, 0xED, 0x70, 0x72,
+    0x57, 0x72, 0x3E, 0x2B, 0x25, 0x33, 0x61, 0xFD, 0xF2, 0x0F, 0x22, 0xA0, 0x07, 0xF3, 0x08, 0x2C,
+    0x5B, 0xEC, 0x8B, 0x95, 0xFF, 0x85, 0x12, 0xFB, 0xC6, 0x30, 0x3E, 0xBE, 0x9A, 0xD9, 0x9D, 0xB2,
+    0x2F, 0xDD, 0xD2, 0x7F, 0x0A, 0x07, 0x16, 0x2F, 0x08, 0xBE, 0x58, 0xF5, 0x85, 0x58, 0x69, 0x31,
+    0xEF, 0xDB, 0x84, 0x8B, 0x86, 0x3C, 0x94, 0x8C, 0x7A, 0x72, 0x1B, 0xE0, 0x94, 0xAD, 0x87, 0xD9,
+    0x95, 0x66, 0x6F, 0xAC, 0x60, 0xF2, 0xA4, 0x48, 0x50, 0x1D, 0x60, 0xCE, 0x7A, 0xCC, 0x79, 0x0B,
+    0xA5, 0xC8, 0xBC, 0x46, 0x15, 0x70, 0x1A, 0xB9, 0x29, 0x62, 0x69, 0x9E, 0x70, 0xE2, 0xE4, 0x92,
+    0x84, 0xF3, 0x92, 0x81, 0x10, 0x18, 0x1B, 0xDE, 0x8C, 0x52, 0xEE, 0x07, 0xBF, 0xE0, 0xB2, 0x55,
+    0xB5, 0x84, 0x7C, 0x6C, 0xA4, 0xAB, 0xAE, 0xCD, 0x58, 0xCA, 0x5D, 0x2E, 0x57, 0xBA, 0x9C, 0x5E,
+    0x18, 0x5E, 0xE6, 0xE7, 0xAA, 0x60, 0x5D, 0xB7, 0x38, 0x6D, 0xD1, 0x1B, 0x15, 0x7B, 0xC1, 0x69,
+    0xCB, 0x39, 0x19, 0x95, 0x14, 0x09, 0x27, 0x3E, 0xF8, 0x93, 0x1D, 0xE0, 0x96, 0x76, 0xA4, 0x46,
+    0x63, 0x2E, 0xD1, 0x88, 0x0C, 0x37, 0x48, 0x01, 0xF5, 0x98, 0x17, 0x8D, 0x2E, 0xA0, 0x37, 0xC9,
+    0x04, 0x59, 0x5C, 0xB8, 0x85, 0x4F, 0xA6, 0xE6, 0xCC, 0x6A, 0x13, 0xD0, 0x73, 0x1B, 0xF8, 0x1F,
+    0xAD, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x14, 0x3E, 0xF6, 0x84, 0xB8, 0xB0, 0xC4, 0x34, 0xA4, 0x42,
+    0x62, 0x5A, 0x1A, 0x32, 0x2F, 0xB0, 0x7B, 0xC7, 0x64, 0x4B, 0x8A, 0xA4, 0xD8, 0x5D, 0x9E, 0x01,
+    0x51, 0xE4, 0x05, 0x60, 0xED, 0x28, 0x0F, 0x10, 0x9A, 0xBC, 0x00, 0x15, 0xDA, 0x14, 0x34, 0x14,
+    0x08, 0xDD, 0x5D, 0xCF, 0xE6, 0x16, 0x29, 0xD7, 0x49, 0xA0, 0xC6, 0x62, 0x41, 0x91, 0x42, 0xC1,
+    0x04, 0x06, 0xC9, 0xD9, 0x8C, 0x7D, 0xF8, 0x8E, 0xEF, 0x8D, 0xB2, 0x44, 0x80, 0x10, 0x62, 0xA4,
+    0x3B, 0x7F, 0xF6, 0x3D, 0xE7, 0x3B, 0x3F, 0xDF, 0x67, 0xFA, 0x9A, 0x30, 0x92, 0x4C, 0xA3, 0x4C,
+    0x1F, 0xD1, 0x6B, 0x43, 0x7B, 0x7A, 0xA3, 0x72, 0x44, 0x75, 0x93, 0x48, 0x4D, 0x2A, 0x90, 0x49,
+    0xB8, 0xE2, 0xE0, 0xAA, 0x82, 0xFD, 0x48, 0x96, 0x55, 0xA4, 0x31, 0xE9, 0xBE, 0x3C, 0x0B, 0xAE,
+    0x71, 0xD7, 0xFD, 0x71, 0x9E, 0xEA, 0x6B, 0x49, 0x3F, 0x1C, 0xCB, 0xD0, 0x16, 0xD1, 0xAE, 0xA2,
+    0xE9, 0x6B, 0xEB, 0xEB, 0x5B, 0x69, 0xCC, 0xA6, 0xE2, 0x45, 0x28, 0x92, 0xE1, 0xCA, 0x84, 0x3A,
+    0x51, 0xED, 0xB9, 0xCF, 0x58, 0x31, 0x15, 0x49, 0x35, 0xAA, 0x29, 0xE9, 0x4D, 0x32, 0xFB, 0x01,
+    0x06, 0x2B, 0x32, 0xFD, 0x45, 0x04, 0x6F, 0x11, 0xDD, 0x18, 0xA8, 0x3C, 0x09, 0xB4, 0x50, 0x21,
+    0x8B, 0x45, 0x57, 0x7A, 0xED, 0x1D, 0x99, 0x66, 0x20, 0x57, 0x74, 0x74, 0x00, 0x70, 0x63, 0xA2,
+    0x8C, 0x7B, 0x52, 0xF8, 0x6F, 0x89, 0x30, 0x74, 0x20, 0x72, 0x9E, 0x68, 0x22, 0x2A, 0x03, 0x9E,
+    0x34, 0x39, 0x27, 0x2A, 0xD9, 0x93, 0x8D, 0x6B, 0x93, 0x57, 0x88, 0x76, 0x07, 0x52, 0x67, 0x3D,
+    0xE9, 0x3B, 0x0D, 0x2D, 0x16, 0x44, 0xC3, 0xBF, 0x3B, 0x7E, 0xB7, 0x77, 0xE0, 0x98, 0x07, 0x66,
+    0x78, 0xDB, 0x82, 0x21, 0x38, 0x52, 0x70, 0xA4, 0xB1, 0x7D, 0x57, 0x0C, 0x1F, 0xC8, 0xD4, 0xCA,
+    0x04, 0x28, 0xF0, 0x8C, 0x67, 0xEA, 0x49, 0x47, 0x54, 0x3C, 0x46, 0x48, 0xE5, 0x7D, 0xBC, 0xAE,
+    0x6F, 0x01, 0x83, 0xA9, 0x90, 0x71, 0x47, 0x4B, 0xA2, 0x85, 0xFC, 0xE5, 0x08, 0x7B, 0xD4, 0xC0,
+    0x56, 0xD9, 0x40, 0xBA, 0x51, 0xB0, 0xEE, 0x65, 0xEA, 0x4B, 0x4C, 0x41, 0xFF, 0xB4, 0xF7, 0x61,
+    0x34, 0x9E, 0xD4, 0x60, 0x3D, 0xE5, 0xC9, 0x35, 0x94, 0x8D, 0xC0, 0xB0, 0x3A, 0x3F, 0xFC, 0x02,
+    0xFF, 0x52, 0x12, 0xEA, 0x7A, 0xB1, 0x44, 0x39, 0x4F, 0x64, 0x9F, 0x4E, 0x79, 0xA0, 0x68, 0x49,
+    0xC1, 0xDD, 0x96, 0xA9, 0xD4, 0xC3, 0x48, 0x4B, 0x73, 0xD8, 0x9E, 0x00, 0xB7, 0x61, 0xCE, 0x78,
+    0xAA, 0x1C, 0xD0, 0x4F, 0xF7, 0xA2, 0xEA, 0xB2, 0xA0, 0xAB, 0xBC, 0xDB, 0xA6, 0xA2, 0x89, 0xF4,
+    0x9E, 0xEA, 0xF2, 0xA0, 0x61, 0xC0, 0xF1, 0x48, 0x91, 0x6A, 0xD5, 0xD1, 0x42, 0x57, 0xB4, 0xDC,
+    0x86, 0xF1, 0x48, 0x66, 0x75, 0x7E, 0x8F, 0x35, 0x73, 0x84, 0xEB, 0x4A, 0xA2, 0x27, 0xF1, 0xC6,
+    0xC9, 0x32, 0x3F, 0xDA, 0xF8, 0x7E, 0x85, 0x44, 0x16, 0x44, 0xE9, 0xAA, 0x3F, 0x2D, 0x0D, 0x42,
+    0x78, 0xB5, 0xF8, 0x4D, 0x75, 0x61, 0xA4, 0x43, 0xD1, 0x47, 0x52, 0xBD, 0xEA, 0x69, 0x1B, 0x09,
+    0x51, 0xDD, 0x5F, 0x6E, 0xB6, 0x60, 0x56, 0x79, 0x98, 0x97, 0x4D, 0x89, 0x0D, 0x92, 0xE5, 0xE4,
+    0x2E, 0xD8, 0xF3, 0xC3, 0xF6, 0x73, 0xA4, 0x6A, 0x42, 0x78, 0xDC, 0xC1, 0xF8, 0x27, 0xBA, 0xC1,
+    0x1B, 0xBB, 0x28, 0xB2, 0x34, 0x30, 0xF3, 0x19, 0x42, 0x07, 0x82, 0x6D, 0x1C, 0x80, 0x05, 0xE5,
+    0x10, 0x38, 0x2C, 0xE1, 0xAC, 0xFA, 0xF9, 0xF0, 0xEA, 0x09, 0xAC, 0xE0, 0xC9, 0x9D, 0xF5, 0x7F,
+    0xB2, 0x11, 0xA4, 0x68, 0x91, 0x74, 0x15, 0x8B, 0x00, 0xD8, 0xBA, 0x03, 0xFA, 0x22, 0xB8, 0x6B,
+    0xA8, 0x9E, 0xEE, 0x47, 0x8D, 0xF7, 0xF5, 0xE3, 0xC8, 0x70, 0x62, 0x4F, 0x9F, 0x20, 0x6E, 0x72,
+    0x2D, 0x37, 0x58, 0x6A, 0x9E, 0x09, 0x25, 0x91, 0xCD, 0x8B, 0xCC, 0x8A, 0x07, 0x59, 0x1C, 0xC7,
+    0xF9, 0x30, 0x2F, 0x6E, 0x5E, 0xA4, 0xD4, 0x02, 0xE8, 0x05, 0xB7, 0x11, 0x87, 0xD3, 0xA9, 0x8E,
+    0xE4, 0x92, 0x1B, 0xDA, 0xA8, 0xB8, 0xE3, 0x9E, 0xA3, 0x9D, 0x14, 0x7B, 0x8E, 0x97, 0xF9, 0xB3,
+    0x02, 0xF5, 0xBB, 0xFB, 0x36, 0x3C, 0x7D, 0xFA, 0x12, 0x70, 0x16, 0x29, 0x4B, 0x39, 0x6C, 0xB7,
+    0x68, 0x76, 0x80, 0x44, 0xB6, 0x10, 0x3A, 0xE5, 0xCF, 0x70, 0xFD, 0x7C, 0x7F, 0x5A, 0x47, 0x49,
+    0xED, 0xF3, 0x75, 0xB2, 0x01, 0x6B, 0x17, 0x19, 0x2C, 0x06, 0x50, 0xD8, 0xF5, 0x4E, 0x1A, 0x34,
+    0x21, 0x41, 0x28, 0x4F, 0x9D, 0x74, 0x97, 0x0B, 0xAB, 0xF5, 0xF7, 0x7E, 0xA2, 0x63, 0xA7, 0x06,
+    0x15, 0x53, 0xD9, 0xDB, 0x07, 0xD1, 0xFA, 0xD1, 0x74, 0x6D, 0x19, 0xC0, 0x6A, 0xF7, 0xFE, 0x54,
+    0xFC, 0x9A, 0x8A, 0xC1, 0x9C, 0x76, 0x60, 0x75, 0x4B, 0xF5, 0x09, 0xC7, 0x8C, 0xA1, 0x03, 0x45,
+    0xD2, 0x13, 0x99, 0xE0, 0x02, 0x58, 0xAD, 0xBE, 0xCD, 0x91, 0x7D, 0xB0, 0x99, 0xDE, 0xA1, 0xAF,
+    0x24, 0x46, 0x64, 0x64, 0xE6, 0xDD, 0xA5, 0x8B, 0xA4, 0xBE, 0xF2, 0xB7, 0x70, 0x4A, 0x81, 0xE3,
+    0x5E, 0x83, 0x93, 0x0F, 0x2A, 0xFC, 0x37, 0x38, 0x45, 0x5F, 0x86, 0x5C, 0xCA, 0x77, 0x84, 0xB6,
+    0xB3, 0xA8, 0x9C, 0x86, 0x6A, 0xA9, 0x80, 0x9A, 0xA4, 0x1A, 0xE8, 0x50, 0x50, 0xFD, 0x8B, 0xA7,
+    0x02, 0xA5, 0xCA, 0x18, 0xE9, 0xAB, 0x51, 0x25, 0x91, 0xA0, 0x12, 0x25, 0xC9, 0xCF, 0xB1, 0x99,
+    0x1C, 0xD0, 0xDC, 0xE6, 0x4A, 0xF7, 0x75, 0x54, 0xB1, 0xE4, 0x6A, 0x24, 0x90, 0xA0, 0xD2, 0x78,
+    0xB4, 0xB7, 0x77, 0x03, 0x05, 0xF1, 0xE8, 0x3A, 0x90, 0x78, 0x99, 0x0D, 0x79, 0x10, 0x6D, 0xB2,
+    0x50, 0xCB, 0x23, 0x4A, 0x79, 0x50, 0x41, 0x84, 0xCA, 0xA2, 0x45, 0x13, 0x25, 0x85, 0xA3, 0x9E,
+    0x75, 0xCB, 0xA1, 0x6F, 0x11, 0x0A, 0x20, 0x54, 0xFA, 0x81, 0xB4, 0xF0, 0xCB, 0xD1, 0x56, 0xE4,
+    0xEE, 0x33, 0x60, 0x94, 0x00, 0x99, 0xAE, 0x0E, 0x74, 0x10, 0xBE, 0x09, 0xF9, 0xCF, 0xAB, 0xB3,
+    0x4E, 0xDF, 0xD4, 0xA7, 0x7E, 0xB9, 0x74, 0x66, 0xE7, 0x87, 0x90, 0x16, 0xF6, 0x83, 0x55, 0x48,
+    0xC9, 0xEA, 0x13, 0xEE, 0x93, 0x53, 0xBC, 0x13, 0x92, 0x4E, 0x7A, 0x15, 0x4C, 0xEF, 0x60, 0xBE,
+    0x4A, 0x33, 0x07, 0xA5, 0x41, 0x57, 0x6B, 0x26, 0xCA, 0x38, 0xC2, 0x2E, 0x47, 0x0D, 0x90, 0x55,
+    0x3C, 0x04, 0x21, 0x75, 0x07, 0x99, 0x74, 0x3B, 0xB8, 0x92, 0x2E, 0x56, 0x51, 0xD2, 0xD0, 0x4D,
+    0x72, 0x85, 0xF8, 0x27, 0x0D, 0x29, 0x1D, 0x9C, 0x28, 0x10, 0x7E, 0x7C, 0x5B, 0xA8, 0x85, 0x2E,
+    0xE2, 0xC1, 0x3D, 0x3D, 0x6C, 0x25, 0x73, 0xF5, 0x4A, 0xF4, 0x16, 0x2A, 0x5B, 0x24, 0xF0, 0xD8,
+    0x3C, 0x93, 0x2B, 0x4F, 0x97, 0xF9, 0x47, 0x69, 0x7D, 0x06, 0xA5, 0xEF, 0x72, 0x57, 0x24, 0x54,
+    0x40, 0x5E, 0x19, 0xCC, 0x46, 0xB6, 0x68, 0x14, 0x34, 0xC7, 0x32, 0x89, 0x66, 0x53, 0x2D, 0x62,
+    0xE9, 0x64, 0xB7, 0x58, 0xDF, 0x41, 0x31, 0x27, 0xD7, 0x51, 0x3E, 0x9A, 0x69, 0xEF, 0x66, 0x9A,
+    0x3D, 0x16, 0xA2, 0x80, 0xB9, 0xD0, 0x9A, 0x5A, 0x08, 0xCF, 0xDA, 0xC7, 0x66, 0xA8, 0x35, 0x57,
+    0xA1, 0xCB, 0x57, 0x17, 0xB3, 0x3C, 0x2F, 0x64, 0x09, 0x62, 0x4D, 0xFD, 0x16, 0xC4, 0xF2, 0x3F,
+    0x2E, 0xC1, 0x80, 0x35, 0x35, 0x4F, 0xD9, 0xEF, 0xFB, 0x23, 0x18, 0x93, 0x2C, 0xB8, 0xB4, 0xA4,
+    0x02, 0x6A, 0x66, 0xAF, 0x7B, 0x00, 0x86, 0x4F, 0x38, 0x80, 0x93, 0x06, 0xE9, 0x10, 0x11, 0x93,
+    0x0F, 0xA4, 0x48, 0x97, 0x1C, 0x6B, 0xA8, 0xB0, 0x10, 0x0E, 0x79, 0x36, 0x61, 0x8E, 0x7E, 0x33,
+    0xB2, 0x2F, 0x07, 0xA4, 0x06, 0xBA, 0x0F, 0x6D, 0x44, 0x4F, 0xE3, 0x6D, 0xE4, 0x38, 0x97, 0x4F,
+    0xAB, 0x58, 0x10, 0x82, 0xD2, 0xB1, 0x88, 0x52, 0xB7, 0xF9, 0xEA, 0xCE, 0x9B, 0x89, 0xD6, 0xEF,
+    0x11, 0x74, 0xF5, 0x92, 0xE6, 0xF3, 0x8F, 0x3D, 0xD2, 0x98, 0xE6, 0xEF, 0x80, 0x99, 0xED, 0x88,
+    0xC1, 0xFA, 0x42, 0xE8, 0xFF, 0xDF, 0xF8, 0x03, 0x9D, 0x55, 0xBF, 0x8F, 0xD5, 0x46, 0x10, 0xFE,
+    0xEC, 0x15, 0xAC, 0x14, 0x2B, 0xDA, 0x26, 0x11, 0x52, 0x90, 0x70, 0x9F, 0x1F, 0xF8, 0x1F, 0x78,
+    0xCF, 0xB6, 0xA0, 0xA0, 0xA5, 0x4F, 0x71, 0x0D, 0x55, 0x14, 0x89, 0x14, 0x14, 0x2E, 0xEE, 0xCE,
+    0x56, 0x28, 0x53, 0x90, 0x26, 0x7D, 0xEA, 0xA3, 0x80, 0x82, 0xE2, 0x45, 0x7A, 0x77, 0x6F, 0xE1,
+    0x15, 0xB4, 0x16, 0x07, 0xA2, 0x48, 0x81, 0xD1, 0x75, 0x44, 0x51, 0xF6, 0x82, 0x89, 0x0C, 0xD8,
+    0xDE, 0x7C, 0xE3, 0x77, 0x90, 0x40, 0x24, 0x8A, 0x58, 0xDE, 0xF1, 0xEE, 0xD8, 0xFE, 0xE6, 0x9B,
+    0xD9, 0x99, 0xD9, 0xD2, 0x7B, 0x7F, 0xCC, 0xE1, 0xEF, 0xFB, 0x5B, 0xCF, 0x3C, 0x90, 0x81, 0x57,
+    0xCF, 0xA1, 0x1C, 0x85, 0xB1, 0x78, 0x5F, 0x15, 0x8B, 0xAA, 0xE4, 0x08, 0x44, 0xA5, 0xDF, 0xAA,
+    0x56, 0x1C, 0xE1, 0x40, 0x11, 0xB5, 0x14, 0x49, 0x2D, 0xAA, 0xFC, 0x44, 0xC5, 0xAB, 0x43, 0x74,
+    0xD7, 0x21, 0x55, 0x0D, 0x5A, 0x5D, 0x47, 0xD6, 0xD8, 0x0C, 0x71, 0xDE, 0x21, 0xD3, 0x35, 0x0E,
+    0x68, 0x60, 0xE8, 0x11, 0xFA, 0x06, 0xCA, 0x57, 0x88, 0xF8, 0x87, 0x21, 0x6C, 0x46, 0xD4, 0x91,
+    0x70, 0x0E, 0x81, 0xB7, 0xA1, 0xEF, 0x11, 0x79, 0x8B, 0xA4, 0xC5, 0x3F, 0x57, 0xE8, 0x7D, 0x87,
+    0xDD, 0xAD, 0x47, 0xFB, 0xBA, 0x4A, 0x30, 0xFB, 0x12, 0x4B, 0x5C, 0x73, 0xA1, 0x0B, 0x8E, 0x6C,
+    0x64, 0xF5, 0x8D, 0x3C, 0x41, 0x9A, 0x3C, 0x1C, 0xCE, 0xB4, 0x19, 0x9D, 0xB3, 0xA5, 0x27, 0x40,
+    0xE2, 0xC7, 0xFC, 0xC4, 0x13, 0x81, 0x31, 0xC2, 0x31, 0xA3, 0x06, 0xC3, 0x3B, 0x2A, 0x6C, 0x1C,
+    0x0F, 0x5A, 0xFA, 0xAB, 0x5C, 0xD8, 0xC9, 0x82, 0x3F, 0x57, 0xF4, 0x9A, 0x7E, 0x27, 0x95, 0xF0,
+    0x7B, 0xD0, 0xD1, 0xF7, 0xD7, 0x64, 0xA9, 0xBC, 0xFC, 0xE2, 0x25, 0x02, 0x9E, 0x50, 0x81, 0xCC,
+    0x14, 0x3D, 0x81, 0xF1, 0x04, 0x4C, 0x8E, 0x68, 0xAD, 0xBC, 0x37, 0xCA, 0x4B, 0x9F, 0x87, 0x1E,
+    0xA5, 0xD5, 0x84, 0x72, 0x86, 0xA0, 0x5D, 0xE6, 0xA0, 0xA7, 0xE8, 0xB4, 0x30, 0xAA, 0xC6, 0xCC,
+    0xE4, 0x70, 0x29, 0x94, 0xED, 0x10, 0x33, 0x4C, 0xDB, 0xA6, 0x0A, 0xB8, 0xD4, 0xEF, 0x2E, 0x23,
+    0x2E, 0x13, 0x2E, 0x97, 0xA6, 0x0A, 0x1D, 0x3D, 0xEB, 0xE9, 0xDC, 0x73, 0x8E, 0x0A, 0x98, 0x4F,
+    0x48, 0xFC, 0x01, 0xF8, 0x0C, 0x9F, 0x20, 0xB8, 0x68, 0x31, 0x9B, 0x41, 0xAD, 0xFF, 0xFD, 0xD0,
+    0xEB, 0x1A, 0xDB, 0x73, 0x44, 0x87, 0x0D, 0x86, 0xA4, 0x2A, 0x6B, 0xEF, 0x87, 0xC8, 0xBF, 0xAE,
+    0xCF, 0x76, 0x3B, 0xFC, 0x91, 0x8E, 0xF0, 0x11, 0xF1, 0x71, 0xC0, 0x47, 0x83, 0x69, 0xC7, 0x4F,
+    0xE7, 0xDB, 0x19, 0x7A, 0xB5, 0x76, 0xC6, 0xCE, 0x52, 0x2C, 0xD5, 0xBA, 0x89, 0x3E, 0x30, 0xA9,
+    0x38, 0x59, 0x70, 0xA2, 0x65, 0x52, 0x6C, 0x26, 0xD9, 0xDE, 0x78, 0x73, 0x4D, 0x8A, 0xFD, 0xB4,
+    0x11, 0x53, 0x74, 0x33, 0x5C, 0xD1, 0x36, 0x25, 0xEC, 0x1B, 0xB1, 0xFC, 0x80, 0x98, 0x6F, 0xC4,
+    0x42, 0x44, 0xF1, 0x1F, 0x21, 0xA0, 0xC3, 0x5B, 0x21, 0x7B, 0xCB, 0x34, 0x38, 0xC9, 0x57, 0x26,
+    0x9D, 0xC4, 0x64, 0x6F, 0x41, 0x8B, 0x5E, 0x76, 0x84, 0xD6, 0x03, 0x49, 0xD8, 0x6D, 0x49, 0x5A,
+    0x6C, 0x62, 0x35, 0x29, 0x4A, 0x06, 0x30, 0xDE, 0x1B, 0xA8, 0xD0, 0x96, 0x8A, 0x82, 0x5F, 0x18,
+    0x7E, 0xA1, 0xB8, 0x64, 0x42, 0xB9, 0x33, 0x3D, 0xBF, 0x18, 0x10, 0xFB, 0x91, 0x49, 0x38, 0x81,
+    0x22, 0x7A, 0x2A, 0x01, 0x4A, 0xEE, 0x57, 0x92, 0xE7, 0x82, 0x15, 0xF6, 0x82, 0xAA, 0x8F, 0xA7,
+    0x82, 0xB8, 0x3F, 0x15, 0x49, 0x3C, 0x55, 0x89, 0x60, 0xEB, 0xE3, 0x57, 0xB7, 0x6A, 0x51, 0xD3,
+    0x22, 0xD5, 0xBA, 0x0A, 0x7A, 0xB1, 0x20, 0x5F, 0xCF, 0x44, 0x1D, 0x3A, 0x82, 0x04, 0xA5, 0x0D,
+    0x07, 0xB1, 0x13, 0xBD, 0xF0, 0xCC, 0xA0, 0xEC, 0x57, 0x31, 0x25, 0x3B, 0x8B, 0x73, 0x04, 0xAE,
+    0x26, 0xA6, 0xDB, 0x13, 0x71, 0xA2, 0xC8, 0x82, 0xC8, 0x24, 0x4D, 0xCE, 0xAC, 0xAC, 0x82, 0x78,
+    0x24, 0x4C, 0xA8, 0x63, 0xD2, 0x25, 0x0A, 0xC9, 0x4E, 0x5C, 0x23, 0xE6, 0x7C, 0xE4, 0x3D, 0xC2,
+    0x2E, 0x18, 0xB0, 0xCF, 0x1D, 0x35, 0x15, 0x4C, 0x75, 0x79, 0x13, 0x26, 0xEE, 0xF9, 0x37, 0x7B,
+    0xFB, 0xF2, 0xBE, 0xC1, 0x8A, 0xDE, 0x71, 0xC7, 0xC5, 0xAD, 0x5D, 0xA9, 0x80, 0x43, 0x86, 0x63,
+    0x48, 0xFC, 0x2D, 0x7F, 0x97, 0x81, 0xED, 0x0C, 0x05, 0xA3, 0xC8, 0x10, 0x5E, 0xF5, 0x3F, 0x4E,
+    0x11, 0x60, 0x32, 0x8E, 0x44, 0x8A, 0x7D, 0xAB, 0x9A, 0xB8, 0x4A, 0xF2, 0x4E, 0x52, 0x32, 0x25,
+    0xB5, 0xB9, 0xF9, 0xBE, 0x81, 0xB9, 0xDE, 0xB4, 0x08, 0x5D, 0xC7, 0xAC, 0x5C, 0xA6, 0x86, 0xAC,
+    0xCD, 0x6F, 0x96, 0xE9, 0xE7, 0x45, 0xF9, 0x92, 0xF8, 0xFD, 0x9C, 0x55, 0xB5, 0x6B, 0x2E, 0x0E,
+    0x28, 0x2F, 0xD6, 0x2B, 0xE2, 0xB6, 0xB4, 0x50, 0xCF, 0x41, 0x61, 0xF2, 0xD3, 0x93, 0xD7, 0x9F,
+    0x5E, 0x66, 0xC4, 0x5B, 0x6A, 0x5A, 0xD6, 0xE0, 0x1D, 0x12, 0x5B, 0xB0, 0x4A, 0x16, 0xA4, 0xBC,
+    0x98, 0xE6, 0x1D, 0x16, 0xA1, 0x7F, 0xD6, 0x93, 0xB7, 0x54, 0x76, 0xCF, 0xEF, 0x7A, 0x35, 0x84,
+    0xBD, 0x76, 0x41, 0x1F, 0x35, 0x61, 0x6F, 0x36, 0x63, 0x88, 0x39, 0x12, 0x8E, 0xAC, 0x51, 0x43,
+    0xE6, 0x94, 0xF8, 0x88, 0xD3, 0xC3, 0x77, 0xEC, 0x1D, 0xF9, 0xC1, 0xD7, 0xAD, 0xC9, 0x63, 0x92,
+    0xED, 0x66, 0x30, 0x2C, 0x90, 0xE5, 0xE6, 0xD1, 0xA7, 0x28, 0x99, 0xB0, 0x8C, 0xA0, 0x27, 0xB3,
+    0x9D, 0x60, 0x75, 0xBD, 0xD9, 0x34, 0x85, 0xD3, 0xEC, 0x38, 0x9D, 0x44, 0x5D, 0x37, 0xE2, 0x3E,
+    0x3D, 0xC1, 0x14, 0xCA, 0x79, 0x39, 0xD2, 0xBA, 0x57, 0xFE, 0xC2, 0x68, 0x68, 0x3D, 0xCB, 0x55,
+    0xCB, 0x6E, 0xF5, 0xA0, 0x45, 0x76, 0x89, 0x4B, 0xF3, 0xE2, 0x6A, 0x43, 0xDF, 0xE8, 0x8B, 0x93,
+    0xDE, 0x56, 0x8E, 0xF9, 0xEE, 0xCD, 0xA6, 0xC0, 0xED, 0x02, 0xD7, 0x0A, 0xB8, 0xD2, 0xD7, 0xBC,
+    0x0B, 0x2C, 0x0B, 0xCC, 0x0B, 0x9C, 0x2F, 0x90, 0x16, 0x38, 0xE0, 0xF6, 0x95, 0x9E, 0x9B, 0x58,
+    0xB3, 0x63, 0x31, 0xE6, 0xD9, 0xD4, 0x83, 0xDF, 0xBF, 0xF3, 0x37, 0x77, 0x25, 0x37, 0xB3, 0xBB,
+    0x81, 0x26, 0xBD, 0xB0, 0x21, 0xB3, 0x3B, 0x0C, 0xEE, 0x9C, 0xED, 0xCB, 0xE4, 0x3D, 0x93, 0x98,
+    0x5F, 0xB3, 0x7C, 0x59, 0x46, 0x8E, 0x3B, 0xBB, 0xE4, 0xCF, 0x09, 0xAE, 0x3E, 0xDA, 0x7A, 0x28,
+    0x05, 0xA3, 0xA5, 0x77, 0xB0, 0xCD, 0x31, 0xF2, 0x70, 0xA7, 0xC0, 0xBE, 0x81, 0xA4, 0x21, 0xD5,
+    0x9A, 0x4D, 0x9A, 0xDD, 0x64, 0x76, 0x0E, 0xEA, 0xDE, 0xAB, 0x89, 0xC4, 0xD1, 0xA3, 0xA9, 0xC5,
+    0x48, 0x7E, 0x88, 0x39, 0xFF, 0xD3, 0xB7, 0xCC, 0x1A, 0x1B, 0x33, 0xF0, 0x5F, 0x9C, 0xB4, 0x78,
+    0xE8, 0x26, 0xCE, 0xF7, 0xD9, 0x2D, 0x77, 0x18, 0x1F, 0x73, 0xD7, 0xD1, 0x6C, 0x72, 0xE9, 0x1E,
+    0x5B, 0x52, 0x96, 0x6C, 0xB1, 0x1E, 0x76, 0xF7, 0xA5, 0x26, 0x57, 0x9B, 0x7E, 0xE9, 0xA5, 0x34,
+    0xBC, 0xD4, 0x8A, 0x9E, 0x14, 0xA5, 0x48, 0x92, 0xA9, 0x65, 0x4A, 0xA9, 0x47, 0xBF, 0xAA, 0x51,
+    0x3E, 0x1E, 0x56, 0x75, 0x34, 0x26, 0x2D, 0x37, 0xC2, 0xAD, 0x6A, 0x79, 0x1B, 0x8D, 0x01, 0x6E,
+    0xE3, 0x63, 0xA8, 0x3C, 0xB4, 0x65, 0x75, 0x6A, 0x81, 0x28, 0x47, 0x83, 0xE2, 0x19, 0x03, 0x76,
+    0x76, 0xE2, 0xA1, 0x2C, 0x06, 0xD6, 0xD4, 0xA1, 0x55, 0xBF, 0xCF, 0xF0, 0xCB, 0xA1, 0x8D, 0xBF,
+    0x9A, 0xA9, 0x07, 0x87, 0xF5, 0xF2, 0xFC, 0xDC, 0x84, 0x47, 0x87, 0x4D, 0x3A, 0xDF, 0x56, 0x47,
+    0x4F, 0xF2, 0x94, 0xA9, 0xC0, 0xDE, 0x9C, 0x66, 0x95, 0x6A, 0xC2, 0xEA, 0x0A, 0x3D, 0x26, 0x59,
+    0xF6, 0xEF, 0xFC, 0xFF, 0x41, 0x7C, 0x84, 0x2B, 0x68, 0xE3, 0xDC, 0x30, 0x3A, 0xAE, 0x47, 0x1C,
+    0xE7, 0xC1, 0xF3, 0x06, 0x89, 0x9C, 0x69, 0x39, 0xBB, 0x3D, 0x0F, 0x04, 0x8B, 0x74, 0x05, 0x75,
+    0x34, 0x20, 0x35, 0x2C, 0x97, 0xAC, 0xDE, 0x09, 0x7C, 0x15, 0xEE, 0xFD, 0x9C, 0x79, 0x65, 0xDD,
+    0xCC, 0xE8, 0xCA, 0x15, 0x22, 0xAE, 0x99, 0x28, 0x77, 0x77, 0x8C, 0xC9, 0xFF, 0x74, 0x26, 0x85,
+    0x93, 0xC3, 0x06, 0xFB, 0x3C, 0x00, 0xB3, 0x0B, 0x23, 0xE2, 0xC6, 0x5B, 0x9E, 0x19, 0xAD, 0x1E,
+    0xCD, 0x2A, 0x7C, 0xBD, 0x7E, 0x62, 0x5F, 0xB9, 0xBF, 0xBA, 0x9D, 0xE5, 0x3C, 0xCB, 0x32, 0xF3,
+    0xC3, 0x1F, 0x37, 0xD6, 0x4F, 0xFD, 0xDA, 0xF1, 0x48, 0x19, 0x76, 0x75, 0x9B, 0x6D, 0xD9, 0xDE,
+    0x3C, 0x76, 0x9F, 0xEB, 0x97, 0x3D, 0x82, 0x11, 0x1F, 0xBC, 0xFE, 0x06, 0x9D, 0x55, 0xBF, 0x6F,
+    0xDD, 0x54, 0x14, 0xFE, 0xAE, 0x0D, 0xB5, 0x54, 0xD3, 0xDE, 0x0E, 0x54, 0x62, 0xA0, 0xCF, 0x2B,
+    0x45, 0x69, 0xCC, 0xD0, 0x01, 0x90, 0xDF, 0xB3, 0x0B, 0xFF, 0x40, 0x87, 0x36, 0x0C, 0xFD, 0x0B,
+    0x10, 0x43, 0x18, 0x32, 0x3C, 0xA4, 0x97, 0x3C, 0xA3, 0x8E, 0x1D, 0x60, 0xE9, 0xDE, 0x81, 0x29,
+    0x45, 0xCA, 0x1B, 0x32, 0x3C, 0xA4, 0x97, 0xF8, 0xA6, 0x19, 0x59, 0x1C, 0xA2, 0xB2, 0x72, 0xA5,
+    0x82, 0x54, 0x89, 0x21, 0xB7, 0xC8, 0x51, 0x9D, 0xD6, 0xCF, 0x97, 0xEF, 0x3A, 0x3F, 0x4A, 0x29,
+    0x13, 0x96, 0xCF, 0xB9, 0xC7, 0x3F, 0xEE, 0xF1, 0x77, 0xCE, 0xF9, 0xCE, 0xF1, 0x08, 0xE2, 0x2F,
+    0x83, 0xF0, 0x67, 0x85, 0x38, 0x06, 0x66, 0x33, 0x78, 0xDD, 0x65, 0x89, 0x74, 0x39, 0xC3, 0x7C,
+    0x7B, 0xFD, 0xE1, 0x73, 0x6B, 0xED, 0x6F, 0x94, 0xB1, 0xB5, 0x6D, 0x0B, 0xFF, 0x65, 0x0D, 0x79,
+    0xA0, 0x91, 0x16, 0x39, 0x5A, 0x2C, 0x6B, 0xC4, 0x07, 0x65, 0xA8, 0x62, 0x61, 0x30, 0x5B, 0x84,
+    0xBF, 0x5B, 0xA2, 0xDF, 0x87, 0xBF, 0xCF, 0x65, 0x00, 0xFF, 0x97, 0x1A, 0x8D, 0xB4, 0x56, 0x15,
+    0xD6, 0x78, 0x76, 0x8E, 0x73, 0x2D, 0x3E, 0x5C, 0x5F, 0xBF, 0x6B, 0xED, 0x9C, 0xCF, 0xF6, 0x75,
+    0xF7, 0xCA, 0xAB, 0x65, 0x75, 0x80, 0xC0, 0x2D, 0x29, 0x17, 0xD3, 0x2D, 0x4F, 0x0C, 0xD6, 0x84,
+    0xF7, 0x13, 0x16, 0xD3, 0x16, 0x45, 0xB5, 0x26, 0x2C, 0x92, 0xC0, 0x60, 0x1A, 0x29, 0x61, 0xD6,
+    0x10, 0xEC, 0x34, 0x88, 0x78, 0x39, 0x8A, 0x8C, 0xAF, 0x8B, 0xA3, 0xE2, 0x33, 0x6B, 0x1B, 0x79,
+    0x60, 0xD5, 0x20, 0x6E, 0x44, 0x2D, 0x10, 0x96, 0x40, 0x9C, 0x01, 0x0D, 0xE0, 0x1B, 0x20, 0x52,
+    0x38, 0x3B, 0x0A, 0x1D, 0x58, 0x23, 0xF5, 0x25, 0x3E, 0x4E, 0x81, 0x01, 0xD0, 0xEF, 0x4E, 0x1A,
+    0x69, 0x86, 0x58, 0x43, 0xDA, 0x2A, 0xB0, 0x0D, 0x96, 0x8F, 0xF8, 0x6E, 0x6A, 0xAD, 0x69, 0x37,
+    0x36, 0x14, 0xA6, 0x80, 0xA7, 0x81, 0x30, 0xA7, 0x5B, 0xDE, 0x9F, 0x1D, 0xBB, 0x95, 0x74, 0x4B,
+    0x1F, 0xA7, 0x5F, 0x39, 0xB9, 0xEC, 0x43, 0x98, 0x11, 0x42, 0x55, 0x63, 0x20, 0x2A, 0x51, 0xF9,
+    0x26, 0x54, 0x41, 0x99, 0x42, 0xEE, 0xD4, 0x88, 0xEE, 0x31, 0xAF, 0x63, 0x60, 0xCC, 0x1D, 0x56,
+    0x43, 0xD8, 0x0C, 0x3E, 0x4D, 0xC9, 0xCD, 0x69, 0x0E, 0x6F, 0xCE, 0x27, 0x06, 0x63, 0xCB, 0x07,
+    0x06, 0xC1, 0xFC, 0x14, 0xF1, 0x10, 0x10, 0x1B, 0xF6, 0x77, 0x87, 0xA6, 0xF1, 0x0F, 0xC7, 0x4B,
+    0x75, 0x8F, 0x00, 0xAA, 0x89, 0x67, 0xC4, 0x13, 0x45, 0xDF, 0xDF, 0x11, 0x52, 0x2F, 0xE1, 0xAD,
+    0x7A, 0xCB, 0x33, 0xE1, 0x9E, 0x3D, 0x78, 0x69, 0x7D, 0xD6, 0xAB, 0x76, 0x4A, 0x79, 0x05, 0x37,
+    0x76, 0xC8, 0x5C, 0x78, 0x80, 0x73, 0xEA, 0x57, 0x54, 0xB2, 0x3C, 0x76, 0x7E, 0x1E, 0x78, 0x10,
+    0x43, 0x66, 0x03, 0x3A, 0x48, 0x02, 0x85, 0x19, 0x73, 0xF1, 0x92, 0x78, 0x2C, 0xDF, 0xAB, 0x99,
+    0x39, 0xD3, 0x81, 0x91, 0xBB, 0x06, 0xF3, 0x50, 0x87, 0x5A, 0x96, 0x05, 0xB7, 0x5E, 0xC5, 0xF9,
+    0xAC, 0xC6, 0xA2, 0xAF, 0x31, 0x95, 0xB9, 0xA7, 0x07, 0x4C, 0xCC, 0xC9, 0x65, 0x98, 0x0B, 0xBD,
+    0x88, 0x20, 0x9F, 0xA2, 0xC7, 0x84, 0x8D, 0xC2, 0x5F, 0xD7, 0x5F, 0xC4, 0xC4, 0x52, 0x58, 0xCB,
+    0xEF, 0x49, 0x22, 0x18, 0x31, 0x93, 0xE6, 0xF8, 0xD3, 0x0B, 0xF8, 0x13, 0x9F, 0xAA, 0x8B, 0x13,
+    0xFF, 0x47, 0x1A, 0xDF, 0xE8, 0x71, 0x6A, 0x1F, 0xD5, 0x06, 0x09, 0x24, 0x7C, 0xC5, 0x72, 0xF8,
+    0xBB, 0x46, 0xAA, 0x64, 0x80, 0xC6, 0xDF, 0xD5, 0xA1, 0x33, 0x66, 0xAF, 0x19, 0x39, 0x8D, 0x29,
+    0x8D, 0xC0, 0x19, 0x43, 0x7F, 0xF7, 0xF0, 0xCE, 0xE3, 0x11, 0x33, 0x64, 0x77, 0x29, 0x8D, 0xDB,
+    0xAE, 0x52, 0x6E, 0x55, 0x83, 0x63, 0x35, 0xFB, 0x0F, 0x35, 0x3D, 0x53, 0xC3, 0x13, 0x95, 0xDE,
+    0xDE, 0xFA, 0xE2, 0xA9, 0x73, 0xD2, 0x74, 0x0A, 0xC7, 0xB5, 0x05, 0x98, 0x08, 0x08, 0xA7, 0xBC,
+    0xAA, 0x43, 0x1E, 0xF3, 0x6E, 0x4A, 0xB9, 0xCC, 0x68, 0x70, 0x2A, 0xFD, 0x5B, 0x8E, 0x30, 0x1A,
+    0xAE, 0x14, 0x09, 0xAE, 0x90, 0x07, 0x3D, 0xCA, 0x22, 0x06, 0x4B, 0x73, 0xDE, 0xAF, 0x29, 0xDF,
+    0x5F, 0xA5, 0x87, 0xBB, 0x8C, 0x3E, 0x49, 0xBB, 0xF0, 0x4E, 0x8D, 0xC3, 0x0C, 0x49, 0x6C, 0x2B,
+    0xFF, 0x91, 0xF1, 0x74, 0x12, 0x23, 0xA4, 0x81, 0xCD, 0x24, 0x82, 0xFC, 0x7C, 0xEF, 0xF0, 0x8E,
+    0xE9, 0x47, 0x76, 0x1E, 0xEC, 0xD9, 0x16, 0xAB, 0x0B, 0x4C, 0xA1, 0x0B, 0x0C, 0xA8, 0x3A, 0xCE,
+    0xCA, 0xFB, 0x19, 0x8B, 0x9C, 0x55, 0xD8, 0xEC, 0x43, 0xCA, 0x8C, 0xED, 0x27, 0xCC, 0xD1, 0x1D,
+    0x62, 0x67, 0xDB, 0xF1, 0x8D, 0x5B, 0x2C, 0x5D, 0x8B, 0x4F, 0x44, 0x23, 0xBA, 0x94, 0xCB, 0xDC,
+    0x11, 0x37, 0x25, 0x27, 0xD6, 0x9B, 0x8E, 0x12, 0xA2, 0xBE, 0x8E, 0xB1, 0xDF, 0xDA, 0x32, 0xE5,
+    0xDB, 0xCB, 0x4F, 0x71, 0x09, 0xEF, 0x32, 0x1D, 0x56, 0x4D, 0xE5, 0x0D, 0x33, 0x5D, 0xC0, 0x70,
+    0xFA, 0x31, 0x92, 0xE9, 0x0A, 0xAE, 0x4D, 0x27, 0xB8, 0x42, 0xE9, 0x15, 0x06, 0xBD, 0xED, 0x0A,
+    0xD7, 0x36, 0x67, 0xE8, 0xAF, 0x14, 0x37, 0x9A, 0x15, 0x46, 0xB5, 0x12, 0x59, 0xFD, 0xB5, 0xD7,
+    0x66, 0x88, 0x6C, 0x9E, 0x78, 0xFA, 0x7D, 0x32, 0x00, 0x8B, 0x9E, 0x0A, 0xF3, 0xA1, 0xA7, 0x25,
+    0x83, 0x26, 0x80, 0x5A, 0xE6, 0x33, 0x5F, 0xF7, 0x51, 0xC7, 0x18, 0xC8, 0x4C, 0xDE, 0x53, 0xBE,
+    0x16, 0x0F, 0xD8, 0x4B, 0xEA, 0xB8, 0x45, 0xB7, 0xF1, 0xE6, 0xE1, 0xB5, 0x84, 0x3E, 0xC7, 0x2A,
+    0x26, 0x8C, 0x6A, 0x87, 0x29, 0x8D, 0x37, 0xEC, 0x13, 0xCE, 0x9F, 0xFE, 0x4D, 0xF8, 0x65, 0xD7,
+    0xAB, 0x8E, 0x9B, 0xF2, 0x68, 0x89, 0xB3, 0xA5, 0x11, 0x1D, 0xCD, 0x4B, 0x91, 0x89, 0x6C, 0x84,
+    0x61, 0xA0, 0x82, 0xFC, 0xC4, 0xCB, 0xB9, 0x36, 0xF3, 0x74, 0x8C, 0x4D, 0x0C, 0x25, 0xBC, 0x47,
+    0x2F, 0xD6, 0xB7, 0x58, 0xD4, 0x7D, 0x8E, 0x1F, 0x66, 0x8E, 0x54, 0x75, 0x8D, 0x2C, 0xE6, 0x78,
+    0xCF, 0x4D, 0x28, 0x66, 0x8C, 0x6D, 0x97, 0xE1, 0x2D, 0xB8, 0x4E, 0x77, 0xFE, 0x1D, 0x57, 0xD9,
+    0x74, 0x8A, 0x01, 0x10, 0x6B, 0x82, 0x2E, 0xF3, 0xF0, 0x77, 0x7E, 0x80, 0x78, 0x4E, 0x2A, 0x8F,
+    0x89, 0x2E, 0x32, 0x51, 0x1E, 0x1A, 0x61, 0xC8, 0x09, 0x57, 0x72, 0x49, 0x87, 0x7E, 0xC9, 0xB4,
+    0xB2, 0xE3, 0x59, 0x9C, 0x86, 0xF9, 0xE6, 0x10, 0x33, 0xB2, 0x14, 0x73, 0x36, 0x9C, 0x65, 0x7B,
+    0xD3, 0x1B, 0x5C, 0x1B, 0xA4, 0x27, 0x00, 0x43, 0xE0, 0x22, 0x70, 0xAD, 0x73, 0x3F, 0x3D, 0xC1,
+    0x1C, 0xDB, 0x96, 0x28, 0xD3, 0x6E, 0x90, 0xFC, 0xFB, 0xCC, 0x4E, 0xCF, 0xDC, 0x9D, 0xA2, 0xC8,
+    0xC3, 0xFB, 0xA6, 0x87, 0x84, 0x5C, 0x5B, 0x81, 0x9B, 0x1A, 0x85, 0x65, 0xAC, 0x8E, 0x8A, 0xE3,
+    0xDB, 0x45, 0x6A, 0xE7, 0x91, 0x6D, 0x3C, 0xD2, 0xD1, 0x8D, 0x3C, 0xD6, 0xC1, 0x3A, 0xCE, 0x24,
+    0x5D, 0x5C, 0x6E, 0xCE, 0x70, 0xA6, 0x8A, 0x82, 0x77, 0xC6, 0x6E, 0x12, 0xAC, 0x3D, 0xAC, 0xC6,
+    0x8E, 0xF2, 0xAD, 0x28, 0x8E, 0x10, 0xCB, 0xFD, 0xC3, 0xB6, 0xC3, 0xD2, 0x0B, 0xBE, 0xD5, 0x43,
+    0xA7, 0xA6, 0x71, 0xB8, 0x6B, 0x9A, 0xB4, 0x1B, 0x19, 0x51, 0xBE, 0x15, 0xE7, 0x5B, 0xA9, 0x6A,
+    0x53, 0x65, 0x5F, 0x15, 0x8C, 0x71, 0xF4, 0xDE, 0x38, 0x17, 0xBB, 0x1C, 0xC7, 0xAF, 0x87, 0x10,
+    0x94, 0xAC, 0xB8, 0xD4, 0x78, 0xB5, 0xF9, 0x03, 0xC7, 0xE8, 0xE4, 0x1F, 0x8A, 0x53, 0x68, 0x74,
+    0xA2, 0x72, 0x0E, 0x3F, 0x0E, 0xDD, 0x29, 0x61, 0x07, 0x55, 0xC4, 0xB9, 0xA6, 0x2E, 0x67, 0x9C,
+    0xD0, 0x06, 0xFE, 0x63, 0xC6, 0x59, 0x32, 0x83, 0xD7, 0x3D, 0x85, 0x0B, 0x98, 0xC0, 0xCF, 0xE2,
+    0x39, 0x54, 0xE8, 0x95, 0x1F, 0x79, 0x6A, 0xE1, 0x1D, 0x4C, 0x82, 0x00, 0x0B, 0x62, 0x47, 0x85,
+    0xE7, 0x9E, 0xF1, 0xE7, 0x53, 0xB3, 0x00, 0xD5, 0xD9, 0x07, 0xB5, 0x50, 0x6F, 0x08, 0xDB, 0x5D,
+    0xFF, 0xB1, 0x54, 0x8E, 0x68, 0x5F, 0xD0, 0xA2, 0x74, 0x72, 0x51, 0x8B, 0xBD, 0x55, 0x2D, 0x6C,
+    0x43, 0xD1, 0x5D, 0x81, 0xDC, 0x04, 0xA0, 0x9B, 0xAF, 0xF8, 0xFD, 0x8E, 0x16, 0x6E, 0x8E, 0x75,
+    0xF2, 0x65, 0xC7, 0x0A, 0x12, 0xB1, 0x12, 0x56, 0xD4, 0x5E, 0x83, 0x91, 0x23, 0x05, 0x9B, 0xCE,
+    0x49, 0xDF, 0x7F, 0x5D, 0xD6, 0x48, 0x87, 0x6D, 0x27, 0xF0, 0x49, 0x84, 0x49, 0xC7, 0x2C, 0xF7,
+    0x73, 0x49, 0xCE, 0x00, 0xDE, 0x7C, 0x3B, 0x93, 0x37, 0x2A, 0x98, 0x01, 0x64, 0xA8, 0xC4, 0xB3,
+    0x0A, 0xD1, 0xA0, 0x63, 0x4F, 0x5C, 0x71, 0xE9, 0x26, 0x8F, 0x4F, 0x08, 0x83, 0xB4, 0xF4, 0xB5,
+    0xCD, 0x06, 0xC1, 0x3C, 0x28, 0xA3, 0x1A, 0xFF, 0xF3, 0xF8, 0x1B, 0xAD, 0x55, 0xCF, 0x8F, 0xD5,
+    0x54, 0x14, 0xFE, 0xDA, 0x9B, 0xA1, 0x89, 0x55, 0xAE, 0x0B, 0x49, 0x50, 0xC1, 0xEE, 0x11, 0xE8,
+    0xC6, 0xB8, 0x6A, 0x5F, 0x8B, 0x2E, 0x5C, 0xB8, 0xD1, 0xC4, 0x89, 0x89, 0x7F, 0x82, 0xD1, 0xBC,
+    0x0D, 0x31, 0x2C, 0x66, 0x68, 0x61, 0x16, 0x24, 0xB0, 0x80, 0x0D, 0x2B, 0x17, 0xC3, 0xC2, 0x8D,
+    0xB3, 0x10, 0x16, 0xB3, 0x18, 0xC9, 0xE3, 0xB5, 0x81, 0x44, 0x17, 0x2E, 0x28, 0xF3, 0xE2, 0x8A,
+    0xC5, 0x34, 0x8C, 0x89, 0x91, 0xC4, 0x70, 0x81, 0x17, 0x2D, 0xA4, 0xED, 0xF5, 0x3B, 0x7D, 0xE8,
+    0xA0, 0x6C, 0x6D, 0xEE, 0xAF, 0xDE, 0xDB, 0x7B, 0x7E, 0x7C, 0xE7, 0x3B, 0xA7, 0x8E, 0x01, 0xBC,
+    0x0A, 0x08, 0x72, 0xE0, 0x73, 0xEC, 0x3D, 0xAA, 0x44, 0x17, 0x21, 0x98, 0x95, 0xEA, 0xF7, 0x08,
+    0xDF, 0xCF, 0xCA, 0xE0, 0x58, 0xA4, 0xB6, 0x67, 0xD5, 0xE4, 0x78, 0xAC, 0xDD, 0xDD, 0x59, 0x3D,
+    0x8A, 0x57, 0xD4, 0xEE, 0x4E, 0x3A, 0x4A, 0x8C, 0xDA, 0x6D, 0x31, 0x4A, 0x72, 0x55, 0xE3, 0x00,
+    0xA0, 0xB1, 0x1F, 0xC7, 0xB0, 0x89, 0xC4, 0x96, 0x48, 0x3A, 0x60, 0x29, 0xC5, 0x8B, 0x8F, 0x4E,
+    0xB1, 0x12, 0xC0, 0x35, 0x23, 0xE8, 0x7C, 0x15, 0xAB, 0x68, 0x5D, 0xE3, 0xCC, 0x75, 0xA9, 0xCC,
+    0x69, 0x78, 0xF7, 0xE6, 0xD0, 0x3B, 0x25, 0x02, 0x0B, 0x24, 0x0D, 0x90, 0xD1, 0x32, 0x2E, 0x55,
+    0xCB, 0x5B, 0x35, 0x50, 0xA4, 0x08, 0x5A, 0x1E, 0x96, 0xC8, 0x5A, 0x38, 0x76, 0x21, 0xFC, 0x24,
+    0xBE, 0xAA, 0x9C, 0xBB, 0xA9, 0xF7, 0x25, 0x0E, 0x6F, 0xBE, 0xB8, 0x1C, 0xDB, 0xAE, 0xB0, 0x73,
+    0xA7, 0x84, 0x07, 0x1C, 0x02, 0x5E, 0x85, 0x43, 0x39, 0x57, 0xEF, 0x7F, 0xE3, 0x59, 0x5B, 0x07,
+    0xD6, 0xE6, 0xF2, 0xEA, 0xD1, 0xF7, 0x90, 0x92, 0x8A, 0xCB, 0x70, 0xB9, 0xE5, 0xCF, 0xBD, 0x32,
+    0x48, 0xBD, 0x74, 0x15, 0xFB, 0x9D, 0x39, 0x22, 0xCF, 0xB8, 0xB5, 0xE6, 0x76, 0x62, 0x7B, 0x64,
+    0xD6, 0xB0, 0x2F, 0xF4, 0x5E, 0x61, 0x37, 0x7B, 0xFD, 0xC8, 0xD3, 0x6F, 0xE9, 0x76, 0x07, 0x5E,
+    0x01, 0xA4, 0xF7, 0xCB, 0xB4, 0xDD, 0x56, 0xE8, 0xF8, 0xD6, 0x22, 0x42, 0x83, 0xA3, 0xC3, 0xDC,
+    0x39, 0x2D, 0xF7, 0x5B, 0x14, 0xEC, 0x89, 0x9D, 0x63, 0x69, 0x39, 0xA5, 0x78, 0xDB, 0x2B, 0x0E,
+    0x36, 0x2F, 0x7E, 0x5E, 0x2E, 0x6A, 0x3D, 0x47, 0x52, 0xD3, 0xF1, 0xB0, 0xA6, 0xDB, 0x01, 0x2D,
+    0xEC, 0xC4, 0x7B, 0x7D, 0x9B, 0x83, 0x63, 0xC5, 0x60, 0x7E, 0x08, 0x7F, 0xDB, 0xB4, 0xF0, 0xCA,
+    0x89, 0x26, 0xF6, 0xA1, 0x63, 0x60, 0xFC, 0x32, 0xC6, 0xC4, 0xE5, 0x34, 0xC2, 0xC4, 0x31, 0x3A,
+    0x0D, 0x11, 0xFB, 0x95, 0x2E, 0x75, 0x79, 0x64, 0x63, 0x63, 0x8D, 0x1A, 0xC3, 0x34, 0xCC, 0x27,
+    0x5E, 0xED, 0x9A, 0x39, 0xFC, 0x1B, 0x70, 0x8A, 0x1A, 0x9B, 0x8F, 0xCA, 0xFD, 0x5A, 0xBB, 0xA5,
+    0x39, 0x19, 0x69, 0x75, 0x2E, 0x37, 0xD1, 0xA6, 0x76, 0x2B, 0xB7, 0x83, 0x3E, 0x61, 0x1B, 0xCC,
+    0x43, 0x55, 0xEB, 0xF7, 0x6B, 0x7D, 0xD6, 0x8C, 0x7C, 0xDB, 0x7B, 0x77, 0xA9, 0x53, 0x89, 0xDD,
+    0xD9, 0xA5, 0xC0, 0xE8, 0x0A, 0xC9, 0x19, 0x06, 0x85, 0x32, 0xA1, 0x67, 0xF4, 0x7E, 0x9A, 0x00,
+    0xFE, 0xEE, 0x3F, 0x0B, 0xFA, 0xDF, 0x87, 0x0C, 0xE3, 0x1D, 0x9B, 0xFA, 0xAD, 0x78, 0x97, 0x67,
+    0xD6, 0x1A, 0x57, 0xAE, 0x7B, 0x84, 0x11, 0xFB, 0xAE, 0xF3, 0xAB, 0x5A, 0xDD, 0xFC, 0xB5, 0x8A,
+    0x22, 0xFD, 0xC1, 0xB9, 0x1F, 0xEC, 0xFC, 0x6D, 0x6E, 0xF7, 0x5F, 0xCF, 0x83, 0xD4, 0xBF, 0x55,
+    0x23, 0x8E, 0xA1, 0x76, 0x2B, 0x84, 0x31, 0xDC, 0xC7, 0x35, 0xD9, 0x95, 0xFA, 0x77, 0xEC, 0x03,
+    0x91, 0x93, 0x86, 0x04, 0x34, 0xAB, 0xFF, 0x45, 0xA7, 0xD7, 0x86, 0x71, 0xB1, 0x19, 0xB6, 0x32,
+    0xFA, 0x24, 0x88, 0x20, 0x25, 0x51, 0x20, 0xC4, 0x4A, 0x28, 0xDE, 0x20, 0x64, 0x94, 0x0B, 0x38,
+    0x42, 0xA5, 0x4A, 0x9A, 0xAC, 0x68, 0x4A, 0x92, 0xC3, 0x33, 0xF0, 0xF8, 0x6D, 0x92, 0xF2, 0x5C,
+    0xB8, 0x26, 0x60, 0x87, 0x25, 0x71, 0x90, 0x0F, 0x12, 0xCA, 0xD2, 0x86, 0xF7, 0x85, 0x7E, 0x24,
+    0x20, 0x45, 0x69, 0x09, 0x79, 0x72, 0x93, 0x97, 0xE1, 0x76, 0x09, 0x29, 0x4A, 0x4A, 0x0E, 0x8A,
+    0x25, 0x2C, 0xA2, 0x7E, 0x50, 0x9C, 0xD9, 0x21, 0x8F, 0xEC, 0xC2, 0xB0, 0x6E, 0xCF, 0xE0, 0xC9,
+    0x27, 0x70, 0x9B, 0x15, 0xA8, 0x3A, 0x66, 0xE6, 0x1D, 0x87, 0x5F, 0x06, 0x4C, 0x04, 0x9D, 0x72,
+    0x2C, 0x13, 0x06, 0x74, 0xC4, 0x93, 0x09, 0x14, 0x83, 0xEB, 0xFC, 0x41, 0xAD, 0x64, 0xDC, 0xD0,
+    0x19, 0xAE, 0xC1, 0x16, 0x26, 0xA6, 0x41, 0x64, 0xED, 0x81, 0x4F, 0x87, 0xC5, 0x20, 0x91, 0x56,
+    0xC5, 0x3C, 0xD9, 0xB6, 0xB6, 0x0B, 0xAD, 0xDD, 0x36, 0x03, 0x9D, 0x5D, 0x4E, 0x0C, 0x86, 0x7A,
+    0x36, 0x2D, 0x1C, 0x7C, 0x7E, 0xCA, 0xA1, 0x9A, 0xBD, 0x49, 0x20, 0x43, 0xB0, 0x68, 0x14, 0x92,
+    0xB0, 0x0D, 0x17, 0xFF, 0xDB, 0xD2, 0xBF, 0x5B, 0x2E, 0x6D, 0xF0, 0xCD, 0xDA, 0xB2, 0xB0, 0xF6,
+    0x3D, 0x2A, 0xF2, 0xCB, 0xE1, 0x23, 0x08, 0xC8, 0x0C, 0x36, 0x85, 0x98, 0x62, 0x63, 0x23, 0xEF,
+    0x16, 0xFA, 0x09, 0xFA, 0x70, 0x87, 0xC0, 0x89, 0x4A, 0x81, 0x59, 0x5E, 0x05, 0xA7, 0xA5, 0xE5,
+    0x8F, 0xAD, 0x3D, 0x0C, 0xA7, 0xC2, 0x5B, 0xC2, 0x90, 0xCC, 0x6E, 0xD7, 0x38, 0x2E, 0x2E, 0x84,
+    0x8B, 0x41, 0x94, 0x34, 0x54, 0x72, 0xEF, 0xE9, 0xC6, 0xC6, 0x87, 0x7B, 0x4A, 0xC4, 0x39, 0x2D,
+    0xAF, 0x9F, 0xFD, 0x42, 0xF0, 0x1B, 0xC5, 0xDC, 0xD2, 0x95, 0x33, 0x4F, 0xE0, 0xD6, 0x64, 0x1A,
+    0x99, 0xA4, 0x75, 0x8E, 0x95, 0x11, 0x65, 0xB4, 0x18, 0xAF, 0x19, 0x72, 0xB1, 0x0C, 0xF3, 0xAC,
+    0x09, 0x7B, 0x1F, 0x6E, 0x89, 0x6B, 0xCC, 0x48, 0xDF, 0x9E, 0x35, 0xD1, 0x35, 0xEF, 0x0B, 0xDC,
+    0xC5, 0xBB, 0xE5, 0xC4, 0xC4, 0x62, 0xDD, 0x14, 0x19, 0xC3, 0xC7, 0xA9, 0x13, 0x5C, 0xA6, 0xEE,
+    0x40, 0x99, 0xA9, 0x50, 0xC4, 0x37, 0x53, 0xB1, 0x5A, 0x35, 0x53, 0xB2, 0x9B, 0x0C, 0xB2, 0x49,
+    0x3A, 0x84, 0xDD, 0x2E, 0x98, 0xD6, 0x2E, 0xE0, 0x68, 0x86, 0x2A, 0x27, 0x41, 0x13, 0x32, 0x98,
+    0xE7, 0x36, 0x0B, 0x3B, 0x90, 0xC6, 0x0E, 0x44, 0xF1, 0x39, 0x09, 0xD3, 0x7A, 0x5B, 0xF0, 0xB0,
+    0x78, 0x64, 0x6F, 0xF7, 0x3C, 0x9A, 0xD9, 0x1F, 0x59, 0x82, 0xEC, 0x9A, 0xBD, 0x69, 0xEB, 0xD0,
+    0x2A, 0x5B, 0x2E, 0x6E, 0x0A, 0x34, 0x2F, 0x4E, 0x48, 0x5F, 0x4A, 0xAF, 0xBC, 0x81, 0x15, 0xAD,
+    0x2A, 0x55, 0x9B, 0x09, 0x02, 0xCD, 0xE2, 0x3A, 0x61, 0xCE, 0xA8, 0x07, 0x13, 0x61, 0x65, 0xBA,
+    0xE0, 0x8E, 0xDF, 0x8B, 0x52, 0x51, 0x42, 0x85, 0xA1, 0x94, 0xB8, 0x3F, 0xBB, 0xDE, 0xE9, 0x93,
+    0x9F, 0x9A, 0xEC, 0x56, 0x3B, 0x10, 0xF8, 0x90, 0xC8, 0x1C, 0x28, 0xB0, 0xCF, 0x5E, 0x62, 0x79,
+    0x71, 0x2E, 0xBF, 0xC9, 0x7B, 0xAB, 0x43, 0xB1, 0x56, 0x95, 0x14, 0x35, 0xA7, 0x15, 0x09, 0x05,
+    0x25, 0x31, 0x5D, 0x30, 0x1A, 0x62, 0xED, 0x3E, 0xE4, 0xF6, 0x93, 0x7D, 0x3D, 0xE3, 0xCC, 0x70,
+    0x3B, 0xC5, 0x93, 0xA1, 0x12, 0x46, 0xF2, 0x1F, 0x10, 0xD7, 0x7B, 0x87, 0x10, 0xBF, 0x02, 0x95,
+    0xBA, 0x65, 0x96, 0x2F, 0x6D, 0xC1, 0x4F, 0x51, 0xE3, 0xD4, 0xFD, 0x2E, 0xB3, 0x41, 0xE7, 0xA6,
+    0xF8, 0x0D, 0xA8, 0xF0, 0x0E, 0x99, 0xF0, 0x11, 0xE3, 0x48, 0xA1, 0xA7, 0x89, 0xB7, 0x57, 0x13,
+    0xD8, 0xD3, 0x84, 0xDA, 0xAF, 0xA8, 0xE9, 0x06, 0x5F, 0xF4, 0x8C, 0xB8, 0x77, 0x04, 0x58, 0x3F,
+    0xA0, 0x7D, 0xE2, 0x84, 0x16, 0xB4, 0xC5, 0xAD, 0x80, 0x28, 0x3A, 0x82, 0x68, 0xB0, 0xD3, 0xC0,
+    0x6D, 0x99, 0x21, 0xE1, 0x2D, 0x9B, 0xBB, 0xAD, 0x66, 0xD6, 0x32, 0xCA, 0xAA, 0x71, 0x6D, 0x9D,
+    0xE4, 0x7A, 0xA8, 0x06, 0x47, 0x05, 0xF7, 0x61, 0x71, 0xD0, 0xCD, 0x63, 0x9D, 0x47, 0x01, 0xA2,
+    0x18, 0xD1, 0x04, 0xB1, 0x91, 0x5A, 0x9B, 0x95, 0x43, 0x33, 0x98, 0x36, 0x98, 0xF4, 0xD8, 0x4A,
+    0xF2, 0x26, 0xA8, 0x1B, 0x9F, 0x01, 0x7D, 0x79, 0x68, 0x8B, 0xC7, 0x2B, 0x11, 0xA6, 0xF4, 0x3B,
+    0x83, 0x9F, 0x93, 0x7E, 0xFE, 0xF9, 0x13, 0x0D, 0xF4, 0xC5, 0x35, 0xC3, 0xE1, 0x02, 0x6B, 0xCA,
+    0xFA, 0x45, 0x9A, 0xBB, 0x7E, 0x95, 0x16, 0xAE, 0xF7, 0xCF, 0x6A, 0x42, 0xC0, 0x3F, 0x02, 0x82,
+    0x31, 0xEB, 0x46, 0x38, 0x5E, 0xA7, 0x7D, 0xE3, 0x0B, 0x2C, 0x44, 0xE3, 0x35, 0x1A, 0x38, 0x3E,
+    0xC3, 0x5F, 0xCA, 0x01, 0xA6, 0xB5, 0x24, 0x55, 0x73, 0x10, 0xAF, 0xBB, 0xA5, 0xAA, 0x22, 0x6C,
+    0xA9, 0xDB, 0x01, 0xE2, 0xC7, 0x95, 0xDA, 0x39, 0x85, 0x91, 0x65, 0x2E, 0xD4, 0x58, 0xB5, 0xB9,
+    0x77, 0x35, 0xC1, 0xF5, 0x87, 0xAD, 0xFF, 0x9D, 0x6F, 0xB6, 0x9E, 0xA5, 0xEA, 0xFF, 0xF4, 0xFC,
+    0x05, 0x7D, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x6E, 0x07, 0x58, 0x89, 0x15, 0x19, 0x5A,
+    0x04, 0xCA, 0xD2, 0x12, 0x09, 0x2F, 0x65, 0x0A, 0x9F, 0xE7, 0x4C, 0x9B, 0x02, 0x8A, 0xA4, 0xA1,
+    0xA1, 0xA1, 0x22, 0x45, 0x28, 0x28, 0x52, 0xD8, 0xB9, 0x55, 0x52, 0xA4, 0xA0, 0xC0, 0xE2, 0x2F,
+    0x48, 0x41, 0xC3, 0x51, 0xB8, 0x49, 0x91, 0xC2, 0xF1, 0x2D, 0xB8, 0xA0, 0xF4, 0x12, 0x0A, 0xCA,
+    0x2C, 0x09, 0x95, 0x5D, 0x64, 0x24, 0x56, 0xCA, 0x12, 0xEF, 0xED, 0xF0, 0x7D, 0x73, 0x67, 0xCB,
+    0x04, 0x91, 0x95, 0x76, 0xF6, 0xCD, 0x7B, 0x33, 0xEF, 0x7D, 0xEF, 0xE7, 0xA6, 0x75, 0xE6, 0x8B,
+    0x70, 0xB7, 0xB5, 0xE1, 0x69, 0x07, 0xF7, 0x71, 0x0F, 0x5B, 0x2F, 0x60, 0x7C, 0x00, 0xFA, 0x29,
+    0xE0, 0x5C, 0x09, 0xFB, 0xAC, 0x42, 0x1A, 0x6A, 0x8C, 0x82, 0x07, 0xA6, 0x1D, 0x50, 0x84, 0x09,
+    0xB2, 0xD0, 0x22, 0x79, 0x41, 0x62, 0x70, 0x2D, 0xDC, 0x9D, 0x30, 0xB1, 0xCD, 0xB4, 0x35, 0x6D,
+    0x16, 0x26, 0x0B, 0x84, 0xD6, 0x4D, 0x2C, 0x45, 0x7A, 0x2C, 0x3F, 0xA6, 0x06, 0x42, 0xA8, 0xE0,
+    0xA4, 0x20, 0x27, 0x23, 0xAD, 0x80, 0x11, 0x69, 0xEC, 0xE5, 0x25, 0x0A, 0x5B, 0x21, 0x3B, 0xAC,
+    0x90, 0x9C, 0xF0, 0xD8, 0x9C, 0xAF, 0xA3, 0xC4, 0xD2, 0xBE, 0xD1, 0xF1, 0x9E, 0x84, 0xCB, 0x3D,
+    0xEC, 0x4F, 0x81, 0xA8, 0x0A, 0x8F, 0xDE, 0x04, 0xCC, 0xC3, 0x80, 0x79, 0x12, 0x42, 0x9B, 0xB6,
+    0x6F, 0xCC, 0x76, 0x6B, 0x62, 0x44, 0x41, 0xE4, 0x3C, 0x6D, 0x79, 0x3F, 0x82, 0x87, 0xFD, 0x45,
+    0x06, 0x84, 0x1F, 0x18, 0x24, 0x93, 0x0B, 0x34, 0x2F, 0x59, 0xF4, 0x02, 0x09, 0x5D, 0x40, 0x74,
+    0x84, 0xD7, 0x77, 0xB5, 0xCA, 0x17, 0x98, 0x4E, 0xAB, 0xDC, 0xE1, 0xF5, 0xC9, 0x9C, 0xAB, 0x3C,
+    0x82, 0x69, 0xB9, 0x5E, 0x9A, 0x4D, 0xEE, 0xD9, 0x50, 0xF3, 0xF6, 0xFD, 0x2D, 0x60, 0x3C, 0xE6,
+    0xB9, 0x82, 0x37, 0x1E, 0xD3, 0xA7, 0x40, 0x43, 0x8E, 0x7E, 0x59, 0x2F, 0x53, 0xF4, 0xEF, 0x84,
+    0xC4, 0x16, 0x89, 0x82, 0x9C, 0x8C, 0xE8, 0x93, 0xA6, 0x68, 0x62, 0x48, 0x6E, 0x91, 0xB7, 0x49,
+    0x15, 0x0F, 0xB3, 0x06, 0x49, 0x57, 0x94, 0xC8, 0x9A, 0x7D, 0xB2, 0x6E, 0x93, 0xB5, 0x4F, 0x96,
+    0xE9, 0x8A, 0x8A, 0xE6, 0xE7, 0x54, 0xF7, 0x33, 0x71, 0x87, 0xCC, 0xC3, 0xF4, 0x2E, 0x84, 0xE0,
+    0xF9, 0x86, 0x03, 0x2D, 0x96, 0x6F, 0xEF, 0x8E, 0x66, 0xBB, 0xF2, 0xD4, 0x1D, 0xE8, 0x94, 0x8D,
+    0xA7, 0x78, 0xB1, 0x63, 0xE0, 0x15, 0x41, 0x98, 0x4A, 0x51, 0x90, 0xC1, 0xF5, 0x2F, 0xF0, 0xCE,
+    0x1A, 0xB2, 0x2B, 0x65, 0xF2, 0xA8, 0x41, 0xF7, 0x00, 0x1B, 0x6B, 0xB0, 0xDF, 0x94, 0xE6, 0x89,
+    0x47, 0x17, 0xC2, 0x40, 0xD5, 0x87, 0x21, 0xFC, 0xE5, 0x47, 0x7D, 0xCF, 0x70, 0xC1, 0x1E, 0x56,
+    0x74, 0x15, 0x6F, 0x51, 0xC1, 0x32, 0x83, 0x48, 0x5A, 0xA5, 0x6F, 0x28, 0x26, 0xCC, 0x4A, 0x78,
+    0xCA, 0xCD, 0x30, 0xFB, 0xC1, 0x71, 0x53, 0x2B, 0x26, 0x0C, 0x0E, 0xFE, 0xBD, 0x29, 0xE3, 0xA6,
+    0x3B, 0xDB, 0x34, 0x71, 0x33, 0x70, 0x43, 0xD4, 0xDC, 0x70, 0xFD, 0xCF, 0xE6, 0x68, 0x36, 0x17,
+    0x7E, 0x96, 0x58, 0x0C, 0x62, 0xFE, 0xD2, 0x26, 0x5D, 0x6E, 0x6E, 0x32, 0x7B, 0xBF, 0x97, 0x49,
+    0x58, 0x6C, 0x61, 0x8D, 0x35, 0x94, 0x34, 0x58, 0x11, 0x1E, 0x7B, 0x28, 0x90, 0x89, 0x98, 0x87,
+    0xC0, 0x94, 0x86, 0x15, 0x51, 0x1B, 0x89, 0x1C, 0x45, 0x2B, 0x62, 0xF5, 0xD0, 0x91, 0x1E, 0xD1,
+    0x3A, 0x37, 0x8B, 0x6B, 0x9F, 0x33, 0x54, 0x1B, 0xAC, 0x1B, 0x0A, 0x4A, 0x48, 0xD0, 0xC8, 0x27,
+    0xA8, 0x17, 0x08, 0x21, 0x7A, 0xC6, 0x22, 0x1D, 0xAE, 0xEF, 0xF0, 0x08, 0x81, 0x4F, 0x28, 0xE8,
+    0x52, 0xEF, 0x04, 0xD2, 0x51, 0xB0, 0x40, 0x7A, 0xE0, 0xA5, 0xBC, 0xED, 0x75, 0x6E, 0xEC, 0xA4,
+    0xCA, 0x7E, 0x52, 0x51, 0x81, 0x89, 0x82, 0x77, 0xBD, 0x54, 0xD9, 0x56, 0xAA, 0xCC, 0x9F, 0x98,
+    0xCD, 0x66, 0xD1, 0xF8, 0x22, 0xDA, 0x6B, 0xA3, 0x6D, 0x1A, 0xEA, 0xD4, 0x2C, 0xBC, 0x39, 0x8E,
+    0xD6, 0xDA, 0x68, 0xB9, 0x11, 0x0A, 0x36, 0x09, 0xD9, 0xB7, 0xC4, 0x1E, 0x75, 0x62, 0xA7, 0x27,
+    0x03, 0x31, 0xE4, 0x21, 0xDC, 0xF1, 0x98, 0x96, 0x4C, 0xCC, 0xA8, 0xA7, 0xFF, 0x48, 0x6B, 0xDD,
+    0x65, 0x83, 0xDD, 0x67, 0xE5, 0x21, 0x61, 0xC7, 0xB6, 0x52, 0x49, 0xF6, 0x9E, 0xD8, 0xAA, 0x8A,
+    0x6D, 0xA8, 0x2F, 0xAF, 0x8E, 0x3E, 0x3D, 0x8D, 0xC4, 0x68, 0x4F, 0xAB, 0x09, 0xCB, 0x55, 0x25,
+    0x63, 0x16, 0x91, 0xCF, 0x90, 0xEF, 0xCB, 0x78, 0x1A, 0x3A, 0xE2, 0x4B, 0xEB, 0x02, 0x39, 0x4B,
+    0x2A, 0x69, 0x32, 0xC5, 0xFD, 0x32, 0xF1, 0x78, 0x5C, 0xA4, 0x78, 0x1D, 0x59, 0xB9, 0x41, 0x51,
+    0x5A, 0xD9, 0x2A, 0x65, 0x94, 0x8D, 0x1F, 0x71, 0x0C, 0x30, 0x24, 0x8E, 0xC1, 0xC9, 0x2B, 0x7B,
+    0xDC, 0xBF, 0x69, 0x86, 0xCD, 0xB0, 0xB8, 0x51, 0x4D, 0x55, 0xB9, 0x1C, 0x10, 0x5A, 0x31, 0x0D,
+    0xC7, 0x61, 0x07, 0xB8, 0x16, 0x31, 0x7C, 0xA0, 0x36, 0x54, 0x47, 0xCE, 0x77, 0x62, 0xEC, 0xAF,
+    0x32, 0xAB, 0xF9, 0x80, 0x76, 0xD4, 0x7C, 0x98, 0x56, 0x17, 0x70, 0xF9, 0x22, 0xBE, 0x46, 0x73,
+    0x33, 0xA9, 0xD2, 0xDB, 0x8D, 0xC5, 0x7A, 0x56, 0xAE, 0x27, 0x3E, 0xC7, 0x83, 0x62, 0xB2, 0x3D,
+    0x7A, 0xDE, 0xBD, 0x3F, 0x98, 0x70, 0xFC, 0x87, 0x94, 0x6E, 0xF2, 0xAD, 0xF1, 0xD9, 0xCE, 0x99,
+    0x67, 0xBB, 0x1D, 0xAB, 0x86, 0x2E, 0x29, 0xD7, 0x8E, 0x81, 0xB4, 0x0C, 0x69, 0x22, 0xE7, 0x94,
+    0xDB, 0x54, 0x2D, 0xB2, 0xAF, 0x52, 0xD0, 0x54, 0xE8, 0x4F, 0x89, 0x01, 0xCB, 0x73, 0x60, 0x71,
+    0xBE, 0x66, 0xC3, 0x8B, 0xEB, 0x82, 0xDD, 0xAB, 0x50, 0xAA, 0x58, 0x33, 0x4E, 0x0A, 0x6F, 0x30,
+    0x24, 0x48, 0x75, 0x0A, 0x0A, 0xD8, 0x7B, 0x1A, 0x28, 0x54, 0x39, 0x5A, 0xF6, 0xCB, 0xBC, 0x49,
+    0x83, 0xB7, 0xCD, 0xDB, 0x4C, 0x8B, 0x53, 0x6A, 0x95, 0x93, 0x71, 0x24, 0x68, 0x97, 0x23, 0xC0,
+    0x06, 0x6F, 0xA8, 0xA9, 0xF8, 0x1B, 0xF8, 0x08, 0xF8, 0x0A, 0x79, 0x8D, 0xD7, 0x63, 0x3B, 0xB4,
+    0xF2, 0xE2, 0xB7, 0xF0, 0xEC, 0x88, 0x29, 0x2A, 0xB0, 0x42, 0xA5, 0xA2, 0x54, 0x39, 0x60, 0x59,
+    0xBC, 0x82, 0xAF, 0x72, 0x5C, 0xA2, 0x95, 0x23, 0x2F, 0xB1, 0x22, 0x10, 0x79, 0x91, 0x2A, 0xA0,
+    0xB9, 0x26, 0xCE, 0x9C, 0x93, 0xC9, 0x0C, 0x67, 0xC3, 0x60, 0x15, 0x1E, 0xDA, 0x92, 0x33, 0x9A,
+    0x12, 0x3E, 0x72, 0xED, 0x72, 0x64, 0x9C, 0x6D, 0x38, 0xA4, 0x59, 0x3F, 0xAC, 0x18, 0x55, 0x54,
+    0x56, 0x23, 0xA1, 0x9A, 0x9D, 0x08, 0x23, 0x7B, 0xD2, 0x69, 0xD4, 0x56, 0x28, 0xCA, 0x39, 0x01,
+    0xD2, 0xF8, 0x80, 0xA2, 0xCA, 0xD9, 0x08, 0xEC, 0xF4, 0xCC, 0x6B, 0x72, 0x7D, 0xCB, 0xD1, 0xA6,
+    0x16, 0xB3, 0x1A, 0x8B, 0xEC, 0xED, 0x25, 0x00, 0xCD, 0x47, 0xD3, 0x9F, 0x27, 0xA6, 0x24, 0x32,
+    0x11, 0x2A, 0x3D, 0xDB, 0xC7, 0x56, 0x78, 0xC4, 0x56, 0xB5, 0x13, 0x5B, 0xF6, 0x68, 0xD3, 0xAA,
+    0xC0, 0x86, 0x69, 0x8C, 0xDF, 0x46, 0x7E, 0xA5, 0x42, 0x47, 0xF5, 0x8F, 0x79, 0xC9, 0x47, 0x75,
+    0x1C, 0x93, 0xAC, 0x52, 0x16, 0xD9, 0xB9, 0xCF, 0xAB, 0xD0, 0x0D, 0xFF, 0x8B, 0x8E, 0x65, 0xD2,
+    0xA9, 0x9D, 0x4A, 0xFC, 0x38, 0x7C, 0xFF, 0x2A, 0x74, 0x97, 0x90, 0x7C, 0xE7, 0xB1, 0x45, 0x74,
+    0x15, 0xD1, 0x65, 0x44, 0x37, 0x16, 0xBA, 0x31, 0xF2, 0x2C, 0xA2, 0xB3, 0xFC, 0x13, 0x2C, 0xD1,
+    0x71, 0xFC, 0x9C, 0x30, 0xC4, 0x5F, 0xEE, 0x1E, 0xDD, 0x3B, 0x07, 0xF2, 0xF4, 0x49, 0x62, 0xD3,
+    0xBB, 0xD8, 0xCB, 0x1E, 0xAC, 0x94, 0x87, 0x3A, 0x61, 0xD9, 0x43, 0x3C, 0xC6, 0x7F, 0x00, 0xDC,
+    0x5D, 0xC5, 0xEC, 0xB9, 0xD2, 0x3A, 0x57, 0x22, 0x65, 0x1C, 0xC9, 0x80, 0x15, 0x16, 0x08, 0x3D,
+    0x6D, 0x10, 0xFE, 0xF4, 0x50, 0x93, 0xE2, 0x57, 0xFD, 0x68, 0xF4, 0x83, 0xC9, 0x3D, 0xFB, 0x97,
+    0x15, 0x3C, 0xAD, 0x78, 0xC5, 0xF6, 0x42, 0x1F, 0xE2, 0x6F, 0xE7, 0xB2, 0x96, 0x0B, 0xB1, 0xCD,
+    0x4B, 0x9C, 0x7B, 0xFE, 0x01, 0xCD, 0x55, 0x31, 0x73, 0xDC, 0x44, 0x14, 0xFE, 0xA4, 0x4D, 0xA2,
+    0x01, 0x31, 0xD9, 0x86, 0xCC, 0x10, 0x98, 0x89, 0x1A, 0x97, 0xC4, 0xA2, 0x08, 0x33, 0x2E, 0xCE,
+    0xA7, 0x0D, 0xCC, 0xD0, 0x50, 0xE0, 0x82, 0xAB, 0x28, 0xDC, 0xD0, 0xD0, 0x51, 0xB8, 0x70, 0x61,
+    0x9F, 0x64, 0x52, 0x52, 0xC4, 0x4D, 0xEA, 0xD0, 0x92, 0x82, 0xB8, 0x48, 0x61, 0x66, 0xCE, 0x39,
+    0x61, 0xFF, 0x00, 0x34, 0xE3, 0xA1, 0x62, 0x98, 0x2C, 0x38, 0x33, 0x86, 0xA4, 0xC8, 0x16, 0x02,
+    0x64, 0xAC, 0xBB, 0xE5, 0xDB, 0xD5, 0x9D, 0x13, 0x0C, 0x54, 0x34, 0xAC, 0xA4, 0xF7, 0x9E, 0x76,
+    0xB4, 0xEF, 0x7D, 0xFB, 0xED, 0x7B, 0x4F, 0x0B, 0xB8, 0x14, 0x56, 0x30, 0x12, 0x3D, 0x6C, 0xC4,
+    0x45, 0xF8, 0xA3, 0x81, 0xDC, 0x04, 0xF2, 0x02, 0xC2, 0x00, 0x99, 0x82, 0x6C, 0x11, 0xFE, 0x6E,
+    0x30, 0x4C, 0x94, 0x2C, 0x5B, 0x51, 0x0B, 0xF3, 0x10, 0x69, 0x05, 0xBC, 0x04, 0x60, 0x9B, 0x4F,
+    0x66, 0x6D, 0x09, 0x61, 0x6D, 0x1B, 0x17, 0x90, 0x25, 0x76, 0x81, 0x16, 0xFF, 0xC1, 0xFC, 0x6E,
+    0xF0, 0xB5, 0x82, 0xB5, 0x76, 0x0A, 0x49, 0xA9, 0x3B, 0x93, 0x43, 0x68, 0x27, 0xFB, 0xE7, 0xCC,
+    0x40, 0x0D, 0x06, 0x8A, 0xC1, 0x63, 0x5C, 0xC6, 0x9B, 0x58, 0xC2, 0x0E, 0x74, 0x58, 0x8A, 0xE2,
+    0x6F, 0xAF, 0x72, 0xB0, 0xA9, 0x08, 0x94, 0xDE, 0x5A, 0xAE, 0xE2, 0xBE, 0x44, 0x09, 0x48, 0xE7,
+    0xE1, 0x0A, 0x82, 0x15, 0xC6, 0x6F, 0xB9, 0xD9, 0x8C, 0x10, 0x64, 0xB9, 0xC8, 0x7D, 0x13, 0x48,
+    0x1B, 0x68, 0x4E, 0xAC, 0x73, 0x42, 0x22, 0x32, 0xA2, 0x8A, 0x1A, 0xE4, 0x44, 0x12, 0xD9, 0xFB,
+    0xC5, 0x0C, 0x41, 0x33, 0x03, 0x21, 0xFF, 0x32, 0x31, 0x02, 0xE2, 0xFB, 0x34, 0x62, 0x06, 0x08,
+    0x19, 0x08, 0x23, 0x74, 0x63, 0x37, 0xD0, 0x6B, 0xF3, 0xFB, 0x46, 0xA0, 0x97, 0x42, 0x7D, 0xFD,
+    0x23, 0x1D, 0x73, 0x87, 0xA1, 0x46, 0x50, 0xCD, 0xEF, 0x47, 0xC0, 0x5D, 0x8F, 0xCC, 0x81, 0x23,
+    0x8C, 0xE5, 0x5D, 0x88, 0xEF, 0x3B, 0xF5, 0xAC, 0x40, 0xBF, 0xF1, 0x6A, 0xD8, 0xF6, 0xA2, 0xA7,
+    0x07, 0xE5, 0x34, 0xEF, 0xE5, 0x47, 0xA4, 0x27, 0xB1, 0xA7, 0x26, 0x6D, 0x72, 0xF4, 0x88, 0xB3,
+    0x3C, 0x53, 0x44, 0xCD, 0x07, 0x97, 0x3F, 0xC5, 0xB1, 0x13, 0x4F, 0x2F, 0x5C, 0x5B, 0xDB, 0x3F,
+    0xFE, 0x61, 0x98, 0x59, 0x33, 0x5E, 0xC5, 0x37, 0xE6, 0x95, 0x04, 0x5B, 0xE6, 0x02, 0x5C, 0x74,
+    0x2C, 0x76, 0x2A, 0x45, 0x77, 0xE4, 0xCF, 0xD5, 0xAF, 0x5F, 0x15, 0x64, 0x4D, 0x4C, 0xD0, 0x64,
+    0x4A, 0x1C, 0x18, 0xF4, 0x32, 0x88, 0x43, 0x8D, 0xE5, 0x3E, 0xC4, 0x91, 0x46, 0x9F, 0x6F, 0x47,
+    0xA4, 0x2D, 0xEB, 0x18, 0x43, 0x4D, 0xD4, 0xEA, 0x4C, 0x99, 0x6E, 0x0F, 0xE6, 0x13, 0x24, 0xF9,
+    0x24, 0xB0, 0xB6, 0x4E, 0x4C, 0xB2, 0xD5, 0x62, 0x23, 0x55, 0x62, 0x9F, 0x9E, 0x52, 0x7A, 0x32,
+    0x58, 0xCE, 0xE6, 0x2A, 0x3A, 0xAA, 0xF1, 0x30, 0x53, 0xB1, 0x9E, 0xD1, 0x85, 0xFC, 0xB1, 0x13,
+    0xE4, 0x07, 0x89, 0x26, 0x99, 0x91, 0xC6, 0x22, 0xF3, 0x8F, 0xEE, 0x27, 0x89, 0x0A, 0x56, 0x3F,
+    0x67, 0x5E, 0xD8, 0x36, 0x75, 0xB2, 0x12, 0xD3, 0x2F, 0x3F, 0xF4, 0x78, 0x3B, 0xE0, 0x34, 0x09,
+    0x06, 0xA1, 0x4F, 0x1B, 0x39, 0x55, 0x97, 0x14, 0xC6, 0x0C, 0xEF, 0x72, 0xD4, 0x2A, 0xC4, 0xCE,
+    0xA4, 0x7C, 0x3C, 0x8F, 0xC3, 0xA5, 0x11, 0xE7, 0xD3, 0x9B, 0x7A, 0x65, 0x1D, 0x6B, 0xC6, 0x60,
+    0x89, 0x5F, 0xB7, 0x6F, 0x58, 0xFB, 0xB3, 0xE3, 0x24, 0x70, 0x0E, 0xB9, 0x00, 0x56, 0xBD, 0xCA,
+    0x54, 0x6F, 0x90, 0xF0, 0x09, 0xC7, 0xDB, 0xF3, 0xD5, 0xB1, 0x8B, 0xC2, 0xDD, 0x31, 0x62, 0x5A,
+    0x91, 0x84, 0xA0, 0xE1, 0xA9, 0x35, 0x4C, 0x09, 0x29, 0xEA, 0x3D, 0x5C, 0x1C, 0x4A, 0x8F, 0x33,
+    0x76, 0x92, 0x4C, 0x3D, 0xB9, 0xA3, 0xDC, 0x17, 0x67, 0x40, 0x65, 0xE5, 0xE1, 0x7A, 0x99, 0x9F,
+    0xE0, 0x2A, 0x3A, 0xA4, 0x2E, 0xE9, 0x2B, 0x6F, 0x93, 0xC7, 0xD4, 0xBA, 0x60, 0x3E, 0x57, 0x99,
+    0xD1, 0x6E, 0x9C, 0x51, 0x34, 0x03, 0x5F, 0x20, 0x21, 0xF8, 0x0D, 0xDC, 0x30, 0x3B, 0xE8, 0x39,
+    0xF0, 0xAF, 0x5B, 0xFB, 0x4B, 0x30, 0x07, 0xDF, 0x78, 0xF0, 0xAF, 0x91, 0xCA, 0x96, 0xE0, 0x59,
+    0xCB, 0xCE, 0xF5, 0x5B, 0xE8, 0x1E, 0x8E, 0xE4, 0xC0, 0xB4, 0x99, 0x3C, 0x13, 0x1F, 0x1C, 0xD6,
+    0x93, 0xEC, 0xF6, 0xF1, 0x89, 0xCD, 0x1F, 0x71, 0x75, 0xB0, 0xE2, 0xBF, 0xD9, 0xE1, 0xC5, 0x17,
+    0x1D, 0x95, 0x0E, 0xBA, 0x9D, 0xB8, 0xB9, 0xD0, 0xEA, 0x39, 0x84, 0x7F, 0x1C, 0x51, 0x2D, 0xEA,
+    0x90, 0x35, 0x6D, 0x64, 0x95, 0x94, 0x90, 0x3A, 0x53, 0xA4, 0x2A, 0x29, 0x27, 0xB1, 0xCB, 0xAD,
+    0x5B, 0x35, 0x1B, 0x0B, 0x18, 0xCC, 0x95, 0xE3, 0x38, 0xBB, 0xEB, 0xFC, 0x4E, 0xED, 0x8C, 0x4B,
+    0xE3, 0x83, 0xB8, 0xBD, 0x53, 0xB5, 0x9E, 0xA7, 0x2E, 0x96, 0x67, 0xC5, 0xF5, 0x85, 0x0A, 0x73,
+    0x8E, 0x64, 0xA7, 0xEC, 0xB3, 0x29, 0x95, 0xB4, 0xD9, 0x09, 0x95, 0x35, 0xF6, 0x27, 0x5B, 0x49,
+    0xFB, 0xAE, 0xBD, 0x65, 0xAB, 0x71, 0x23, 0xAD, 0x70, 0x9F, 0x5C, 0x71, 0xFE, 0x62, 0x5E, 0x44,
+    0x81, 0x0D, 0x38, 0x62, 0x9D, 0x9B, 0xD4, 0xA7, 0xC9, 0x45, 0x85, 0x7F, 0x1B, 0x49, 0xB1, 0xC9,
+    0xC3, 0x4A, 0x6F, 0xD6, 0x49, 0x81, 0x2C, 0x72, 0x19, 0x38, 0x4C, 0xDE, 0xE7, 0xCA, 0x76, 0x6F,
+    0xE8, 0x40, 0x9F, 0x1A, 0x47, 0x85, 0x03, 0xDB, 0x61, 0x8D, 0x6C, 0xE9, 0x7D, 0xAB, 0xF9, 0x74,
+    0xEA, 0x64, 0xE8, 0x73, 0x2F, 0x3D, 0x9D, 0x58, 0x15, 0xDA, 0xD5, 0xDF, 0xAC, 0x4A, 0x9B, 0xF1,
+    0xA1, 0x7D, 0xC7, 0xEE, 0x13, 0xA4, 0x0F, 0x9D, 0x60, 0x0F, 0xA3, 0xC8, 0x84, 0xA4, 0x29, 0xDE,
+    0x6A, 0xD0, 0x67, 0x4B, 0x6A, 0xF6, 0x7C, 0x79, 0x49, 0x76, 0x13, 0xD6, 0x7D, 0x40, 0xBF, 0x11,
+    0x99, 0x4F, 0xDE, 0xB3, 0x6A, 0x0F, 0x79, 0x58, 0x23, 0x8F, 0x2B, 0x8C, 0x32, 0x15, 0xD4, 0x2D,
+    0x8B, 0xC7, 0x10, 0x27, 0xE8, 0xC3, 0x55, 0x7D, 0x30, 0x66, 0x46, 0xB4, 0xBE, 0x85, 0x07, 0xDB,
+    0x58, 0x78, 0x59, 0x7C, 0x56, 0x2D, 0xF5, 0xC4, 0x6D, 0xF5, 0xB6, 0x8E, 0x36, 0x90, 0xAB, 0xE8,
+    0x0F, 0xF5, 0x60, 0x18, 0xAB, 0xDD, 0x07, 0xE2, 0x5B, 0x75, 0xDD, 0xB0, 0xF5, 0xF7, 0xB8, 0x96,
+    0xCB, 0x3E, 0x06, 0x06, 0x83, 0x15, 0xE6, 0x88, 0xED, 0x0E, 0x21, 0x29, 0x52, 0x26, 0x2B, 0x7B,
+    0x58, 0xA2, 0x52, 0x84, 0xB5, 0x23, 0x41, 0x65, 0xEC, 0x69, 0xCE, 0xC0, 0xCC, 0xC8, 0xE0, 0x8A,
+    0xFF, 0x45, 0x63, 0x48, 0x23, 0xD6, 0xC2, 0x1E, 0x4C, 0x90, 0x35, 0x79, 0x21, 0xDC, 0xF6, 0xDC,
+    0x91, 0xC3, 0xCE, 0xF2, 0x3D, 0xF4, 0x27, 0x8A, 0xF0, 0xDE, 0x17, 0x20, 0x61, 0x3D, 0xC9, 0x4A,
+    0x29, 0x45, 0x69, 0x02, 0xDD, 0xC3, 0xBA, 0xC4, 0x35, 0x51, 0xC6, 0x8A, 0xA0, 0x7A, 0xA8, 0x25,
+    0x46, 0xA2, 0xED, 0x63, 0xEA, 0xDB, 0x09, 0x33, 0x2F, 0xEC, 0xF2, 0x2D, 0xE5, 0x1F, 0xA9, 0xF4,
+    0x22, 0x9B, 0x8B, 0xEA, 0xBC, 0x28, 0x5E, 0x14, 0xBA, 0x13, 0xEE, 0x6F, 0x72, 0x5E, 0x3C, 0xB9,
+    0x37, 0x36, 0x59, 0x89, 0xE4, 0xB9, 0x68, 0x9C, 0x68, 0xF3, 0xD2, 0x13, 0x88, 0xC8, 0x09, 0xFE,
+    0xFF, 0xBA, 0xB3, 0x15, 0x2C, 0x7D, 0x9E, 0x41, 0x07, 0x63, 0x01, 0x57, 0xA3, 0x22, 0xD0, 0x1B,
+    0x58, 0x8C, 0xCA, 0x70, 0xA6, 0xCC, 0x08, 0x69, 0x4C, 0xC5, 0x1A, 0x64, 0xC5, 0x7B, 0x55, 0x09,
+    0x4E, 0x66, 0x71, 0x29, 0x5A, 0xAA, 0xD2, 0xFD, 0xE4, 0x90, 0x96, 0x48, 0xD9, 0xC7, 0xA7, 0xF8,
+    0x9F, 0x8C, 0x3F, 0x01, 0xC5, 0x55, 0x31, 0x6F, 0x1D, 0x45, 0x10, 0x9E, 0xBB, 0x95, 0x7C, 0xC5,
+    0x21, 0x96, 0xC6, 0x05, 0x08, 0x7B, 0x5B, 0x24, 0x50, 0xAE, 0x71, 0xE1, 0xE2, 0xE1, 0xBB, 0x40,
+    0x41, 0x91, 0xC6, 0x12, 0x4A, 0x52, 0x20, 0xFE, 0x01, 0x92, 0xF3, 0x03, 0xE2, 0xDC, 0x23, 0x2E,
+    0x52, 0x92, 0x82, 0xFC, 0x03, 0x24, 0x24, 0x1A, 0x1A, 0x0A, 0x17, 0xCF, 0xEF, 0x56, 0x76, 0xE9,
+    0x22, 0x0B, 0x16, 0x4A, 0xE9, 0x23, 0x91, 0x89, 0xE4, 0x86, 0xC3, 0x3E, 0xC4, 0x19, 0xF6, 0x6E,
+    0xF8, 0x66, 0x4F, 0xB1, 0xAD, 0xE0, 0x48, 0x50, 0x20, 0xCE, 0xD2, 0x8C, 0xDF, 0xED, 0xCE, 0x7C,
+    0xDF, 0xCE, 0x7E, 0x33, 0x47, 0x84, 0x27, 0x2B, 0x48, 0xDB, 0x60, 0xF2, 0x17, 0xC6, 0xBD, 0x6C,
+    0xA6, 0x97, 0x4D, 0x3D, 0x1A, 0x66, 0xFE, 0x9B, 0x39, 0xFE, 0xA6, 0x6A, 0x72, 0x4B, 0xE6, 0x65,
+    0x53, 0x8A, 0x01, 0x96, 0xF2, 0x30, 0x49, 0x27, 0xA6, 0x15, 0x23, 0xEF, 0x52, 0x31, 0xBA, 0x86,
+    0x31, 0xEE, 0x1D, 0x7A, 0x73, 0x99, 0x92, 0x07, 0x36, 0xFE, 0xA9, 0xA1, 0xED, 0xBB, 0x94, 0x19,
+    0x4A, 0xF7, 0x6D, 0x7C, 0xD2, 0xD0, 0xAC, 0x62, 0xCE, 0x98, 0xF7, 0x99, 0x4F, 0x5A, 0xF2, 0x33,
+    0xCA, 0x33, 0xD2, 0xFB, 0x56, 0x21, 0x34, 0x47, 0xF0, 0x94, 0x94, 0xA3, 0x18, 0x3F, 0xB6, 0x17,
+    0x29, 0xFA, 0xB8, 0xA1, 0x3C, 0x27, 0x75, 0x0A, 0x77, 0x8D, 0xD4, 0x49, 0x4D, 0xF9, 0x32, 0xA9,
+    0x5F, 0xE1, 0x34, 0xF0, 0xDA, 0x68, 0x48, 0x40, 0xD4, 0x0C, 0x73, 0x90, 0x01, 0xE6, 0xDA, 0xAB,
+    0x9C, 0x23, 0x9A, 0x10, 0xC5, 0x53, 0xFC, 0x5B, 0xBC, 0xB6, 0x12, 0x1D, 0x14, 0x4B, 0xAB, 0xD1,
+    0xC1, 0x74, 0x69, 0x35, 0x3E, 0x70, 0x3B, 0x86, 0x5D, 0xF9, 0x29, 0xC5, 0x8E, 0x06, 0xE1, 0x5D,
+    0xD3, 0xEB, 0x44, 0x42, 0x5F, 0xCE, 0xD7, 0xA3, 0x9E, 0x35, 0xB1, 0x25, 0xDD, 0x51, 0xD9, 0x50,
+    0x32, 0x90, 0x19, 0x48, 0xB1, 0x4D, 0xF0, 0x8A, 0x9B, 0x88, 0x5B, 0xAA, 0x3C, 0xDD, 0x63, 0xCA,
+    0x2B, 0xCA, 0x4A, 0x67, 0x0E, 0x6D, 0xFA, 0xA4, 0xD3, 0xA7, 0x4D, 0xDC, 0xB1, 0xFA, 0xAD, 0xA7,
+    0x79, 0xF6, 0x83, 0x2F, 0x8B, 0xEC, 0x81, 0x67, 0xE3, 0x74, 0xCD, 0xD5, 0x8D, 0x4E, 0x79, 0xC3,
+    0xBB, 0x03, 0xB1, 0xE2, 0xBA, 0x9A, 0xE6, 0xB6, 0x6A, 0xB3, 0x46, 0x37, 0xDA, 0x6B, 0xAF, 0xBC,
+    0x1A, 0x14, 0x13, 0x53, 0x09, 0x34, 0xD4, 0x98, 0x72, 0x2C, 0xA0, 0x14, 0x3E, 0xF0, 0x08, 0xC5,
+    0x1E, 0x0B, 0x4D, 0x71, 0x1F, 0x5E, 0x55, 0xC1, 0xCA, 0x4E, 0xEC, 0x72, 0x34, 0x16, 0x1E, 0xE5,
+    0x5A, 0xD7, 0x2E, 0xF2, 0xAA, 0xC3, 0x3A, 0x58, 0xD9, 0xDC, 0x99, 0x66, 0xD9, 0xEB, 0x59, 0x72,
+    0xF8, 0xD1, 0x61, 0x74, 0xFA, 0xF4, 0xD4, 0xDD, 0x9D, 0x9D, 0xB5, 0xC6, 0xF8, 0xCD, 0x74, 0x8F,
+    0xCD, 0xFD, 0xA6, 0xBC, 0x51, 0xCF, 0xF4, 0x6E, 0x97, 0xC5, 0x75, 0x95, 0x3A, 0xCA, 0x24, 0x99,
+    0x00, 0xAE, 0x49, 0xCE, 0x02, 0x80, 0x78, 0x11, 0xD7, 0x8B, 0x7A, 0xAB, 0xEE, 0xD6, 0xF4, 0x56,
+    0xE3, 0x73, 0xBD, 0xDB, 0xCC, 0xB2, 0x34, 0x18, 0x4B, 0x6F, 0xE3, 0x8F, 0x96, 0xE8, 0x3D, 0xEC,
+    0x7D, 0xB4, 0x8D, 0xCD, 0x2C, 0x45, 0x9B, 0x17, 0x74, 0xF5, 0x73, 0xEF, 0x9C, 0x34, 0x63, 0x4B,
+    0x84, 0xFA, 0x91, 0x7A, 0x0E, 0xDE, 0xC9, 0x01, 0xC2, 0x90, 0x12, 0x59, 0x3E, 0x87, 0x86, 0x4C,
+    0xE1, 0x45, 0x03, 0x33, 0x21, 0x81, 0x90, 0x1D, 0xD1, 0x83, 0x87, 0xA6, 0xA3, 0x0E, 0xB2, 0x50,
+    0x10, 0xA5, 0x15, 0x53, 0xA7, 0x30, 0x8D, 0x3E, 0xBA, 0x79, 0xBB, 0x35, 0x96, 0x54, 0x07, 0xE6,
+    0xB1, 0x87, 0x8C, 0xA3, 0x5E, 0x7D, 0xA9, 0x8A, 0x55, 0xBA, 0xA3, 0x9C, 0x21, 0x0D, 0x8C, 0x12,
+    0xC9, 0xDF, 0xB8, 0x4C, 0x63, 0xA1, 0xBF, 0x13, 0x33, 0x17, 0xF3, 0x4F, 0x5A, 0x5D, 0x98, 0xFB,
+    0x35, 0x75, 0x13, 0xD2, 0x7B, 0x96, 0x66, 0xA3, 0xF3, 0x6B, 0x54, 0xEE, 0x31, 0xF7, 0x86, 0xD9,
+    0x55, 0xBC, 0x19, 0x55, 0x5B, 0xD0, 0x99, 0x94, 0x24, 0x8F, 0x60, 0xCA, 0xEB, 0x62, 0x3E, 0xF0,
+    0xFF, 0xF3, 0x09, 0x6B, 0x53, 0x94, 0x71, 0x97, 0xA2, 0x13, 0x59, 0x5D, 0xE6, 0xB2, 0x70, 0xF6,
+    0x6F, 0x8F, 0x76, 0xFE, 0x00, 0x0B, 0x99, 0x04, 0xB7, 0x93, 0x8B, 0xE4, 0xE3, 0xAF, 0x28, 0x94,
+    0x4F, 0xA4, 0x57, 0x06, 0x97, 0x8F, 0x4A, 0xDB, 0x0C, 0x1A, 0x21, 0x6F, 0xC4, 0xC5, 0xAD, 0x66,
+    0x46, 0x58, 0x13, 0x5C, 0xEA, 0x82, 0xD3, 0x36, 0xF4, 0x7E, 0x56, 0x04, 0x97, 0x93, 0xA8, 0x58,
+    0x1A, 0xAB, 0x91, 0x92, 0x30, 0x1A, 0x26, 0xC0, 0x9C, 0xDD, 0x5C, 0x07, 0x8C, 0xE0, 0x61, 0x01,
+    0x71, 0xDE, 0xB8, 0xE0, 0x80, 0x02, 0xD7, 0x5F, 0x30, 0x8B, 0xC0, 0x64, 0xE3, 0x89, 0xE6, 0x29,
+    0x8E, 0x36, 0xBF, 0xDE, 0xA4, 0x47, 0x55, 0x4B, 0x2B, 0x38, 0x5F, 0x4D, 0x93, 0x6B, 0xA4, 0x7F,
+    0xFE, 0xB6, 0x9F, 0x48, 0xC0, 0x30, 0xA1, 0xF4, 0x68, 0x1D, 0x1D, 0xAE, 0xAD, 0xF4, 0xB9, 0x0E,
+    0x4D, 0x5F, 0x02, 0x4B, 0xC6, 0xD8, 0xA3, 0xCF, 0x8C, 0x20, 0xF9, 0x94, 0x7F, 0x87, 0xC5, 0xC1,
+    0x9F, 0xF2, 0xC3, 0x94, 0xD2, 0xD8, 0xAA, 0xE9, 0xDA, 0x6D, 0x97, 0x42, 0xB6, 0x1B, 0xD3, 0x0B,
+    0x40, 0x44, 0x7C, 0xC1, 0xFC, 0x0C, 0xF7, 0x86, 0xF0, 0xF7, 0x43, 0x1F, 0xC8, 0xF0, 0x10, 0x6E,
+    0xCC, 0xE3, 0x64, 0xBA, 0xB4, 0x82, 0x03, 0x00, 0x7D, 0x8C, 0xA9, 0x45, 0x7B, 0x2B, 0xA3, 0xF6,
+    0xCC, 0x55, 0xDA, 0x0B, 0xD3, 0xB9, 0xC6, 0x9A, 0x4B, 0x5C, 0x8A, 0x24, 0x13, 0x0C, 0xB2, 0xDD,
+    0x3F, 0x42, 0xF8, 0xB3, 0x1F, 0x43, 0x4A, 0x99, 0x56, 0xB8, 0x64, 0x02, 0x67, 0xDC, 0xBF, 0x35,
+    0xB8, 0x95, 0x77, 0x7B, 0x8A, 0xF9, 0x21, 0x4A, 0xE7, 0x70, 0x8A, 0xEB, 0x47, 0x1B, 0x7E, 0x6C,
+    0x77, 0xB4, 0x28, 0x06, 0xE4, 0xE2, 0x86, 0xC4, 0xF2, 0xF1, 0xE6, 0x12, 0x29, 0xDB, 0xD0, 0x77,
+    0x6A, 0x5A, 0x22, 0xFD, 0x94, 0xDE, 0x2A, 0x68, 0x61, 0x0C, 0xC2, 0x90, 0x8D, 0x43, 0x90, 0x39,
+    0x0F, 0xA2, 0x31, 0x68, 0xD8, 0xC1, 0x38, 0xB5, 0x35, 0x6D, 0x27, 0x45, 0x46, 0x59, 0x65, 0x69,
+    0xC3, 0xBD, 0xA8, 0x79, 0x97, 0x38, 0x33, 0x9D, 0xC7, 0x1E, 0x5F, 0x05, 0xCB, 0x57, 0x8B, 0x3D,
+    0x3B, 0x03, 0x50, 0x0F, 0x84, 0x76, 0xF9, 0x96, 0x08, 0xA5, 0x1F, 0xC9, 0x67, 0x14, 0xDD, 0x3A,
+    0x95, 0x8A, 0x0C, 0x5F, 0x7F, 0xEF, 0x68, 0xA2, 0x29, 0x2D, 0x56, 0x13, 0xCC, 0xC9, 0x4E, 0x2E,
+    0xF2, 0x9F, 0x53, 0x4A, 0x41, 0x89, 0xAB, 0x5A, 0xFF, 0xC2, 0x91, 0x4F, 0x9B, 0xCC, 0x55, 0x17,
+    0xC0, 0x5E, 0x60, 0xA0, 0xB9, 0xA0, 0x40, 0x63, 0xC3, 0x4A, 0xF5, 0xE1, 0x2B, 0x7A, 0x32, 0xEA,
+    0x41, 0xAC, 0x42, 0xE7, 0xA8, 0x16, 0xDF, 0x26, 0xD5, 0x85, 0x0F, 0x5E, 0xD2, 0xE4, 0xD2, 0xC3,
+    0xBA, 0xEE, 0xA5, 0x90, 0xFA, 0xA0, 0x95, 0x23, 0x66, 0x8F, 0x9F, 0x8B, 0x50, 0xF3, 0x8A, 0x45,
+    0x0B, 0x25, 0xFB, 0xB1, 0x2D, 0xDC, 0xE8, 0xC2, 0xB7, 0x80, 0xBB, 0x51, 0x1F, 0x6D, 0xF8, 0x11,
+    0x5C, 0x7E, 0x2E, 0x68, 0xD1, 0xDA, 0x9F, 0x0C, 0x71, 0x2A, 0x7E, 0x3C, 0x40, 0x79, 0xB9, 0xCF,
+    0xBB, 0xAA, 0x55, 0xEC, 0xB8, 0xE6, 0x36, 0xC3, 0x68, 0xB7, 0x21, 0xE0, 0xBF, 0x7D, 0xFE, 0x02,
+    0x9D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0x90, 0xB3, 0x14, 0x17, 0x4E, 0x4F, 0x31,
+    0x7D, 0xA4, 0xC4, 0x3D, 0xBA, 0xF5, 0x4C, 0x88, 0x04, 0x65, 0x52, 0xE4, 0x44, 0xC1, 0x3F, 0x80,
+    0x40, 0xE2, 0xFE, 0x81, 0xDC, 0xD9, 0x81, 0x92, 0x82, 0x34, 0x88, 0x8A, 0x8E, 0x02, 0xD2, 0x5C,
+    0x0D, 0xDA, 0x3B, 0xCF, 0x25, 0x74, 0x34, 0x4E, 0xB6, 0x48, 0x19, 0x8B, 0x4D, 0x4A, 0x94, 0x11,
+    0x37, 0x12, 0x06, 0xC6, 0x7E, 0x7C, 0xCF, 0x7B, 0xC7, 0x1D, 0x51, 0x42, 0xC1, 0xE8, 0xF4, 0x76,
+    0xD7, 0xBE, 0x79, 0xEF, 0xFB, 0xBE, 0xF7, 0x8B, 0x68, 0x3E, 0x85, 0xAB, 0x60, 0x4D, 0x12, 0x89,
+    0x92, 0x98, 0x7B, 0xA2, 0x3C, 0x18, 0x47, 0x6F, 0x38, 0x59, 0xAF, 0xED, 0x21, 0xAE, 0xEC, 0x65,
+    0x3D, 0x15, 0xC7, 0xDE, 0x10, 0x95, 0xEF, 0x3F, 0x0C, 0xB8, 0x5E, 0xDE, 0xC2, 0x9D, 0xFD, 0x43,
+    0x38, 0xA1, 0x96, 0x7B, 0x58, 0x66, 0x98, 0x84, 0x83, 0x5C, 0xE2, 0x0E, 0xB6, 0x16, 0x9B, 0xB1,
+    0xD8, 0x5A, 0x6C, 0x36, 0x71, 0xDB, 0x51, 0xFD, 0x74, 0x6C, 0xBB, 0x6C, 0x2A, 0x03, 0x77, 0xAD,
+    0x6F, 0x3B, 0xEE, 0xB4, 0x5D, 0xE6, 0xBD, 0xB9, 0x39, 0x14, 0x1D, 0x67, 0xC3, 0x79, 0xE0, 0xB7,
+    0x27, 0xAB, 0x39, 0x6E, 0xDD, 0xD9, 0x75, 0x94, 0xC0, 0xE7, 0x02, 0xB8, 0x2D, 0x65, 0xF0, 0xE2,
+    0x73, 0xEE, 0x53, 0xC6, 0x7F, 0x6A, 0x00, 0xC0, 0x47, 0x09, 0x02, 0x3F, 0x51, 0x76, 0xF2, 0xE2,
+    0xC3, 0x81, 0x39, 0x1A, 0x8E, 0x29, 0x3F, 0x17, 0x07, 0x25, 0x45, 0x63, 0xA3, 0xB9, 0x31, 0xD6,
+    0x9F, 0x8D, 0xFF, 0x78, 0x2D, 0x07, 0xBA, 0x92, 0x13, 0x29, 0x2B, 0x7F, 0x39, 0x21, 0x60, 0xF2,
+    0x29, 0xEE, 0xE3, 0x67, 0x43, 0x59, 0xF3, 0x4E, 0x6B, 0x6B, 0xA6, 0xDD, 0x00, 0x46, 0xBE, 0x15,
+    0x26, 0x81, 0x94, 0x07, 0x79, 0x02, 0xED, 0x48, 0xEA, 0x0F, 0x52, 0xEC, 0x00, 0x60, 0x0E, 0xBB,
+    0xC4, 0xA3, 0xB7, 0x28, 0xEA, 0xAF, 0x63, 0xCD, 0x83, 0x66, 0x9F, 0x72, 0x33, 0x4B, 0xF1, 0x3F,
+    0x2F, 0xCE, 0x27, 0x17, 0x0D, 0x6B, 0xFE, 0xFE, 0x95, 0x1C, 0xC0, 0x55, 0x72, 0x1B, 0xCE, 0x74,
+    0x0F, 0x77, 0xDC, 0x44, 0x88, 0x8A, 0x47, 0x26, 0x16, 0x5D, 0xC2, 0xDE, 0xD8, 0x9C, 0xDD, 0x48,
+    0xA6, 0x56, 0x43, 0x3A, 0xC4, 0xA2, 0x2F, 0x56, 0xBE, 0x6C, 0x5A, 0xDD, 0xB5, 0x2A, 0xD4, 0xEF,
+    0xC6, 0xF2, 0x78, 0xCC, 0xFD, 0x98, 0x0D, 0xFA, 0x67, 0xAF, 0xFB, 0xDA, 0xD8, 0xFA, 0xDE, 0x14,
+    0x13, 0x46, 0x7E, 0xB2, 0xA8, 0x99, 0xB4, 0x37, 0x03, 0xD5, 0x8E, 0x5D, 0xC2, 0x73, 0xA0, 0xAB,
+    0x3C, 0x14, 0x7C, 0x0E, 0x87, 0x68, 0x9B, 0x8A, 0x95, 0x4B, 0xC6, 0x6D, 0xAA, 0x56, 0x2E, 0xFF,
+    0x66, 0x3B, 0xF9, 0x6D, 0xE5, 0x16, 0xD7, 0x16, 0xF9, 0xC3, 0x75, 0xE7, 0xAF, 0x2F, 0x2A, 0xB5,
+    0x7E, 0xEA, 0xAA, 0x45, 0x50, 0x6B, 0xA6, 0xCA, 0x38, 0xB5, 0x1E, 0xA8, 0x52, 0xBE, 0x68, 0x90,
+    0x98, 0x7D, 0xD0, 0x48, 0x23, 0xA5, 0xB1, 0xF0, 0xAF, 0x70, 0x01, 0x8D, 0x4B, 0x16, 0x34, 0x6A,
+    0xD0, 0x50, 0x13, 0x68, 0xE8, 0x88, 0x47, 0x42, 0x23, 0x13, 0x1A, 0x25, 0xAB, 0x40, 0x23, 0x68,
+    0xE4, 0x6B, 0x6F, 0x1A, 0x73, 0xCB, 0x1D, 0xA5, 0x11, 0x34, 0x8A, 0xC7, 0xA0, 0xD1, 0x66, 0xA1,
+    0x7C, 0x14, 0x40, 0xA3, 0x74, 0xF5, 0xBD, 0x38, 0x26, 0x53, 0xF6, 0x97, 0x17, 0x1A, 0x56, 0xFB,
+    0x3A, 0x0A, 0x8D, 0x3E, 0x61, 0xC5, 0x94, 0xC5, 0xDC, 0x19, 0x1A, 0x81, 0xA4, 0x37, 0x76, 0xCA,
+    0xC2, 0x05, 0x1D, 0x1D, 0x81, 0x8A, 0x5E, 0x39, 0xF5, 0xEB, 0x36, 0xFD, 0xB0, 0x72, 0xFA, 0xDA,
+    0xB6, 0x7A, 0xB2, 0xEA, 0x96, 0xD7, 0x17, 0x45, 0xBA, 0x5E, 0xF5, 0xD5, 0xE2, 0xAE, 0x5A, 0x3F,
+    0xB3, 0x95, 0xF1, 0x6A, 0x1D, 0xC1, 0xA8, 0x51, 0xFD, 0x69, 0xD1, 0x58, 0x54, 0xB9, 0x99, 0x4D,
+    0x83, 0x52, 0x32, 0xF7, 0xA6, 0x8B, 0x8C, 0xB6, 0xA4, 0xDC, 0x50, 0xE0, 0x94, 0xF2, 0x57, 0xA2,
+    0x2B, 0x54, 0x05, 0x6B, 0x48, 0xEE, 0xC0, 0xDF, 0x40, 0xCC, 0x11, 0x74, 0xE9, 0x48, 0xCC, 0xBE,
+    0x98, 0x7A, 0x5F, 0xBA, 0x4F, 0xBE, 0x55, 0x9B, 0x67, 0x96, 0x68, 0x32, 0x1D, 0xA5, 0xA3, 0x9E,
+    0x76, 0x76, 0x23, 0x12, 0xC0, 0x03, 0xBA, 0x46, 0x0A, 0x43, 0xBA, 0xA6, 0x65, 0xB6, 0x9B, 0x18,
+    0x67, 0x67, 0x2F, 0xF5, 0xB9, 0x50, 0x53, 0x43, 0xE1, 0xEB, 0x0B, 0xC9, 0xA2, 0xDD, 0x9E, 0xCA,
+    0x97, 0x5D, 0xEE, 0xCA, 0xC4, 0xD3, 0xF2, 0x3A, 0xA9, 0x47, 0x1D, 0x2D, 0x16, 0xA4, 0x56, 0xF8,
+    0xA8, 0x48, 0x3D, 0x19, 0x48, 0x9C, 0xBB, 0x56, 0x3C, 0x8F, 0xB4, 0x35, 0x49, 0xBD, 0x59, 0xA9,
+    0x39, 0x8B, 0x48, 0x13, 0xB5, 0x4D, 0x1E, 0x8A, 0x8E, 0xCA, 0x63, 0xD4, 0xE8, 0x58, 0xE2, 0xC5,
+    0xDA, 0x0B, 0x6C, 0x80, 0x38, 0x61, 0x7E, 0xC0, 0x80, 0x99, 0x21, 0xC3, 0x74, 0x54, 0x3A, 0x2A,
+    0x1E, 0xB3, 0xCD, 0x66, 0xA4, 0x0D, 0x88, 0xFB, 0x84, 0xE1, 0x2F, 0x93, 0xDA, 0xDD, 0xFA, 0xD1,
+    0x6E, 0x60, 0x70, 0x5F, 0x3C, 0xDF, 0xBD, 0xE1, 0xE9, 0x6E, 0x35, 0xC7, 0xAF, 0xE0, 0xE6, 0xE4,
+    0xC5, 0x4E, 0x8D, 0x5F, 0xEB, 0x40, 0x87, 0x7A, 0x62, 0xC7, 0x1C, 0x04, 0x46, 0x76, 0xAA, 0xA5,
+    0xE4, 0x4C, 0x92, 0x46, 0x45, 0x57, 0xDB, 0x64, 0xCA, 0x03, 0xFD, 0xD7, 0x69, 0x83, 0xB4, 0x5A,
+    0x40, 0x1C, 0xEE, 0xF3, 0x81, 0x5A, 0x3B, 0x42, 0x6B, 0xDD, 0x50, 0xF1, 0x24, 0x6C, 0xA4, 0xCE,
+    0xD7, 0x00, 0xC7, 0x86, 0xFF, 0x3C, 0x38, 0x09, 0xA2, 0x71, 0x43, 0xF9, 0x2F, 0xC8, 0xDF, 0xA8,
+    0x83, 0x14, 0xCA, 0xA9, 0xC2, 0xA4, 0x45, 0xE0, 0x9A, 0xC1, 0xF3, 0x93, 0x6F, 0xE9, 0xAC, 0x6A,
+    0xBA, 0xFA, 0xF5, 0xE1, 0x21, 0x58, 0x0A, 0x99, 0xA6, 0xF7, 0x82, 0xA6, 0xEC, 0x51, 0x3F, 0x4B,
+    0x2B, 0x51, 0xAA, 0x9D, 0x0F, 0x4E, 0x7A, 0x30, 0xB4, 0xF9, 0x63, 0x7E, 0x29, 0xA2, 0xD8, 0x52,
+    0xBC, 0x9E, 0xD6, 0x4E, 0xC4, 0xDC, 0xD4, 0xEE, 0x08, 0xF0, 0x30, 0x69, 0x8D, 0xE3, 0x57, 0xBD,
+    0xE6, 0xD3, 0x9C, 0x02, 0x4A, 0x87, 0x64, 0xA4, 0x43, 0x9A, 0xFB, 0xA7, 0x68, 0x6E, 0xCF, 0x63,
+    0x42, 0xC6, 0xDD, 0xC7, 0x0F, 0x0E, 0xE5, 0x7D, 0x0F, 0xBA, 0xA2, 0xD4, 0x5C, 0x92, 0x52, 0x40,
+    0xC5, 0x0A, 0xDA, 0x8D, 0x25, 0x1F, 0xF0, 0xB1, 0xD0, 0x91, 0x5C, 0x10, 0x44, 0x76, 0xB4, 0xCB,
+    0xF7, 0xCF, 0xE7, 0x46, 0xD1, 0x60, 0xCC, 0x67, 0xBE, 0x74, 0xED, 0xCD, 0x78, 0xF6, 0xF4, 0x92,
+    0x05, 0xEF, 0x5E, 0xDD, 0xD7, 0xEE, 0x8A, 0xCC, 0x4E, 0x19, 0x49, 0xB9, 0x53, 0x1C, 0xE9, 0xEA,
+    0x81, 0x93, 0x69, 0x45, 0xFA, 0x73, 0x9B, 0x79, 0xF3, 0x72, 0x54, 0xA0, 0xB2, 0x35, 0x6D, 0x0A,
+    0xEC, 0xF2, 0x01, 0x43, 0xA8, 0x78, 0x01, 0x78, 0x62, 0xE9, 0x12, 0xB0, 0x2E, 0x35, 0x30, 0x19,
+    0xD2, 0x76, 0x0F, 0x88, 0xA3, 0xF2, 0xC9, 0x50, 0x34, 0xCA, 0xEF, 0xA1, 0x56, 0x90, 0xCA, 0x67,
+    0x98, 0x59, 0x40, 0x6D, 0x24, 0x5B, 0xD8, 0x02, 0x20, 0xAF, 0xE0, 0xA2, 0x00, 0x87, 0x16, 0x61,
+    0x06, 0xA4, 0xCF, 0x51, 0x8B, 0x31, 0x81, 0x32, 0xBC, 0x38, 0x02, 0x5B, 0xFE, 0xEE, 0x35, 0x39,
+    0x5F, 0x50, 0xE2, 0xEF, 0x02, 0x2A, 0xA6, 0x4C, 0x12, 0x92, 0xA0, 0x7C, 0xEE, 0xB2, 0xCE, 0x60,
+    0x29, 0x0D, 0xA4, 0xBF, 0xE8, 0x30, 0x00, 0xD1, 0x5A, 0xF0, 0x0E, 0xA9, 0x12, 0xF8, 0x9B, 0x03,
+    0x79, 0xE9, 0x58, 0x34, 0x16, 0xDE, 0x78, 0xC0, 0xC7, 0x0B, 0x34, 0xE6, 0xE9, 0x32, 0x50, 0x58,
+    0x6C, 0xBA, 0x39, 0xA2, 0x56, 0x0D, 0xEA, 0xDF, 0x63, 0xEA, 0x32, 0xD1, 0x47, 0x15, 0xA5, 0x20,
+    0x51, 0x60, 0x48, 0xED, 0x25, 0x21, 0xF5, 0x50, 0xD2, 0x65, 0x7D, 0x45, 0x05, 0x56, 0x9F, 0xFE,
+    0xD2, 0x6D, 0x82, 0x41, 0x38, 0x24, 0x3A, 0x39, 0x63, 0x75, 0x1A, 0x0C, 0x5F, 0x6B, 0xC9, 0x16,
+    0x58, 0x79, 0xCA, 0xCF, 0x37, 0x0F, 0xE9, 0xE6, 0x90, 0x8E, 0xD2, 0xA0, 0x64, 0x46, 0xFB, 0xD7,
+    0x2D, 0x5C, 0xD5, 0x91, 0xCE, 0x1C, 0x2D, 0x21, 0xA0, 0x60, 0xC3, 0x94, 0x5C, 0xD2, 0x1E, 0x3A,
+    0x02, 0x85, 0x9D, 0x0C, 0x28, 0x8D, 0xDF, 0x01, 0x1E, 0x82, 0x15, 0x50, 0x54, 0xCB, 0x06, 0x76,
+    0x1B, 0x45, 0x65, 0x05, 0x62, 0x2D, 0x62, 0xF0, 0x21, 0xA0, 0x96, 0x05, 0xD2, 0xBD, 0xA1, 0x6B,
+    0xFE, 0x06, 0x9D, 0x55, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xBB, 0x83, 0x33, 0xC0, 0x2A, 0x9E,
+    0x14, 0xA4, 0xC3, 0xDE, 0x14, 0x14, 0x06, 0x19, 0x96, 0x22, 0x45, 0x24, 0xCE, 0xB7, 0x1B, 0x82,
+    0x04, 0x52, 0x1A, 0x90, 0xB0, 0x44, 0x47, 0x45, 0x43, 0x43, 0x0A, 0x17, 0x2E, 0x6C, 0xDF, 0x06,
+    0x0A, 0xD3, 0x25, 0x12, 0x0D, 0xA5, 0x8B, 0x54, 0xAE, 0xAE, 0x74, 0x61, 0xFB, 0xC6, 0x77, 0x45,
+    0x0A, 0x9A, 0xB5, 0x29, 0xD2, 0x20, 0xB1, 0xC4, 0x1D, 0xD5, 0x5A, 0x59, 0xC4, 0x16, 0x7B, 0x37,
+    0xBC, 0xBF, 0x77, 0xB6, 0xEF, 0x24, 0x1B, 0x09, 0x46, 0xB7, 0xFB, 0x67, 0xFE, 0xFE, 0xF9, 0xF3,
+    0xE6, 0xBF, 0xFF, 0xFF, 0x21, 0x82, 0x57, 0xA8, 0x02, 0x11, 0x3A, 0x50, 0xC5, 0x8D, 0x1D, 0x7C,
+    0x8B, 0x2B, 0x86, 0x49, 0xB1, 0x8F, 0x10, 0x2A, 0x47, 0x1B, 0x26, 0xC1, 0x26, 0x57, 0xA8, 0xB9,
+    0xCB, 0x2B, 0xF9, 0x45, 0x15, 0x9B, 0x40, 0x70, 0x5A, 0xD0, 0xEC, 0x77, 0x0B, 0x44, 0x23, 0x6E,
+    0x88, 0x2B, 0xBE, 0x7A, 0x19, 0x5F, 0x8E, 0x8F, 0xAA, 0xC5, 0x47, 0x2E, 0x2A, 0x3E, 0x21, 0x57,
+    0x91, 0xA3, 0x65, 0x8F, 0x13, 0xDF, 0x25, 0xE7, 0x87, 0xBC, 0x01, 0xEC, 0x78, 0x25, 0xC2, 0x34,
+    0x4A, 0xFC, 0x92, 0xCE, 0xE3, 0x04, 0xFF, 0x36, 0x4A, 0x68, 0xEB, 0x09, 0x70, 0xA2, 0xAA, 0xA0,
+    0x33, 0x9D, 0xC1, 0xD8, 0x88, 0xEE, 0x13, 0xBA, 0x8D, 0x35, 0x4F, 0xDB, 0x8A, 0xE8, 0x61, 0xC8,
+    0x95, 0xE7, 0x08, 0x4E, 0xB9, 0x14, 0xD0, 0x43, 0x41, 0x52, 0x08, 0x42, 0x02, 0x80, 0x40, 0x0D,
+    0x4A, 0x31, 0xB0, 0x7C, 0x68, 0xA9, 0x05, 0x57, 0x58, 0x9E, 0x9F, 0x11, 0xD8, 0x18, 0x43, 0x55,
+    0x98, 0xAC, 0xE3, 0x8D, 0x82, 0xF2, 0xF2, 0x6C, 0x2F, 0xC5, 0x52, 0x0B, 0x6A, 0x60, 0xD1, 0x9A,
+    0x11, 0x1B, 0x2B, 0xD0, 0xBF, 0x66, 0x38, 0x60, 0x94, 0x4E, 0x2A, 0x3D, 0x34, 0xCE, 0x65, 0x3D,
+    0x77, 0xE0, 0xF5, 0xB6, 0x19, 0x09, 0x06, 0x89, 0x10, 0x71, 0x40, 0xAF, 0xC4, 0x76, 0x48, 0x2F,
+    0x11, 0xEA, 0x38, 0xA9, 0xE3, 0xFB, 0xC3, 0xCE, 0xF7, 0xC3, 0xE9, 0x9B, 0x05, 0xB8, 0x37, 0xFB,
+    0x5B, 0xD7, 0x8F, 0x6B, 0x45, 0x78, 0x87, 0x2D, 0xE0, 0xE2, 0xC7, 0xD0, 0xB9, 0x3A, 0x72, 0xEE,
+    0xA4, 0x10, 0x4F, 0xF0, 0x29, 0x62, 0xDE, 0x72, 0x22, 0x08, 0x96, 0xF1, 0x9B, 0x16, 0x24, 0xAA,
+    0x1A, 0x0B, 0x89, 0x4F, 0x21, 0xC7, 0x00, 0xDD, 0xB1, 0xE0, 0xB8, 0xBD, 0xFA, 0xB5, 0xFB, 0x3B,
+    0xF1, 0x32, 0xAC, 0x63, 0x11, 0x3A, 0xF5, 0x73, 0x72, 0x1C, 0x31, 0x00, 0xF4, 0x7B, 0x08, 0xCF,
+    0xE2, 0xD1, 0x05, 0x3C, 0xC6, 0x83, 0x91, 0x34, 0xB6, 0xC3, 0x79, 0xC7, 0x17, 0x0E, 0x87, 0x4D,
+    0x44, 0xAF, 0x1F, 0xEF, 0x6D, 0xA7, 0xC2, 0xFD, 0xA2, 0x80, 0xAE, 0x37, 0xE4, 0x86, 0x67, 0xB2,
+    0x21, 0x7C, 0x2E, 0x1C, 0x74, 0x42, 0x09, 0x68, 0xA3, 0xD6, 0x67, 0x6E, 0x24, 0xEA, 0x3F, 0x7B,
+    0x89, 0xA8, 0xC3, 0x46, 0x4D, 0x34, 0xB4, 0x6E, 0x35, 0xD6, 0x85, 0xA8, 0x89, 0xA9, 0xDE, 0x98,
+    0x73, 0x08, 0xFE, 0x72, 0xAE, 0x44, 0xF4, 0xC2, 0x91, 0x58, 0xF7, 0x9D, 0xCB, 0xA1, 0x46, 0x17,
+    0xA4, 0x09, 0x6B, 0x20, 0x6D, 0x98, 0xE5, 0xED, 0x7C, 0xF8, 0x4F, 0x81, 0x25, 0x09, 0xD3, 0x80,
+    0x38, 0x5A, 0x97, 0x93, 0x2F, 0xA1, 0xFA, 0xCE, 0x25, 0xAD, 0x08, 0x1F, 0xA8, 0x7E, 0x81, 0x2E,
+    0x27, 0xC1, 0x83, 0xA3, 0x02, 0xE5, 0x4A, 0xB8, 0xDA, 0x53, 0xC7, 0xA4, 0x73, 0x33, 0x74, 0xB9,
+    0xD0, 0xD8, 0x54, 0x05, 0xE1, 0x57, 0x92, 0x7E, 0x3C, 0xCB, 0x2F, 0x11, 0x50, 0x5D, 0x23, 0xA4,
+    0x72, 0x4B, 0x28, 0x40, 0x94, 0x08, 0xC9, 0xE6, 0x48, 0x92, 0x5F, 0xBF, 0x12, 0x14, 0xCA, 0x49,
+    0x0D, 0x40, 0x72, 0x8C, 0x6F, 0x49, 0x6F, 0x4F, 0x92, 0x92, 0x7A, 0xF1, 0x68, 0x24, 0x4B, 0x11,
+    0x9D, 0x8A, 0x7D, 0xA7, 0x3F, 0x6C, 0x4C, 0x9C, 0xD0, 0x8C, 0x8E, 0x85, 0xAE, 0x11, 0x97, 0xB7,
+    0x4C, 0x45, 0xAB, 0x92, 0xE4, 0x05, 0x92, 0xAC, 0xDC, 0x27, 0x56, 0x5E, 0xEF, 0xE9, 0x18, 0xCF,
+    0x12, 0x6E, 0x24, 0xDA, 0x2A, 0x8B, 0x3D, 0x9F, 0xB5, 0xC0, 0xDA, 0xF0, 0x0A, 0x7A, 0x6C, 0x57,
+    0x93, 0x02, 0x3C, 0x40, 0x43, 0x3F, 0x22, 0x42, 0x09, 0x49, 0x9E, 0xE1, 0x9D, 0x8D, 0x3D, 0x64,
+    0x3A, 0x1A, 0xA7, 0x8B, 0xA6, 0x46, 0xC2, 0x7C, 0xCC, 0xD7, 0xEE, 0x2E, 0x53, 0x77, 0xE0, 0x5C,
+    0x31, 0x33, 0xDB, 0xFD, 0xC9, 0x39, 0x37, 0x8A, 0xF9, 0xCA, 0xE7, 0x56, 0x57, 0x89, 0xC4, 0xB9,
+    0x57, 0x7C, 0xA4, 0xD4, 0x41, 0xC5, 0xEA, 0xE7, 0x04, 0x24, 0xA3, 0x8E, 0x1B, 0x61, 0xC7, 0xA8,
+    0xAE, 0xFF, 0xC2, 0xB1, 0x86, 0x3F, 0x32, 0xB5, 0x9D, 0xCC, 0x2F, 0x60, 0xAD, 0xEB, 0x9D, 0x58,
+    0xFD, 0x10, 0x0B, 0xCB, 0x33, 0xD3, 0xC2, 0x1F, 0xD8, 0xC0, 0x60, 0xB9, 0x85, 0xEE, 0xD4, 0x34,
+    0x57, 0x56, 0xF0, 0x3C, 0x13, 0x67, 0xA7, 0xF2, 0x4A, 0x2F, 0x3C, 0xEE, 0x4E, 0x70, 0xBA, 0x27,
+    0x02, 0xB6, 0xB7, 0x5D, 0xC5, 0x83, 0x3A, 0xB2, 0xCC, 0xD0, 0xF0, 0x6C, 0x14, 0x9D, 0xD4, 0xF1,
+    0x0F, 0x65, 0x0F, 0x73, 0x5F, 0xC8, 0x34, 0x1A, 0x54, 0x9D, 0x87, 0xC5, 0x94, 0x45, 0xEF, 0x49,
+    0xD9, 0x91, 0x95, 0xFC, 0xA2, 0x7E, 0x6D, 0x8E, 0xA9, 0x1B, 0x85, 0x67, 0x2E, 0x7C, 0x39, 0x14,
+    0xF3, 0x3E, 0x37, 0x57, 0xF1, 0xA7, 0x65, 0x2F, 0x28, 0xA6, 0x1D, 0x74, 0x7E, 0xA9, 0x4C, 0xE1,
+    0x54, 0x1D, 0x5B, 0x7E, 0x08, 0x8F, 0x6B, 0x55, 0xC5, 0xA9, 0xBB, 0x28, 0x08, 0x8F, 0x11, 0x5D,
+    0xBC, 0x14, 0x12, 0xE3, 0x19, 0x61, 0x98, 0x02, 0x4D, 0x19, 0x67, 0x68, 0x56, 0xF8, 0x5F, 0x42,
+    0x51, 0xDC, 0xB9, 0xEC, 0xD6, 0x54, 0xD8, 0x46, 0xDF, 0xBA, 0x72, 0xC1, 0x03, 0x3B, 0x0C, 0xD9,
+    0xB5, 0x66, 0x81, 0x73, 0x4A, 0x48, 0x62, 0x9E, 0xAC, 0x40, 0xFA, 0xBD, 0xCA, 0x30, 0x59, 0x04,
+    0x4C, 0x5A, 0x2E, 0xDE, 0xBA, 0xEC, 0x55, 0xAC, 0xD8, 0x98, 0xC9, 0xC8, 0x0C, 0xD1, 0xDC, 0xC3,
+    0x8B, 0x70, 0x3A, 0xE4, 0xF6, 0x8A, 0xE9, 0x91, 0xF3, 0x18, 0xD6, 0x93, 0x33, 0x63, 0xE6, 0x59,
+    0xAF, 0xEE, 0xC5, 0x98, 0xAC, 0x1D, 0x55, 0x9A, 0x61, 0x5C, 0x8E, 0x94, 0x10, 0x67, 0x06, 0x67,
+    0x35, 0x2B, 0x7E, 0x22, 0xC6, 0x2D, 0x86, 0x85, 0x55, 0xC7, 0x2C, 0x26, 0xF3, 0xBC, 0xF0, 0x6B,
+    0x8F, 0xFA, 0xD8, 0x46, 0xD9, 0xBB, 0xED, 0xF6, 0xE4, 0xD8, 0xBB, 0xB7, 0x89, 0xF5, 0x4E, 0xEA,
+    0x65, 0xEF, 0xA4, 0x2A, 0xFD, 0x26, 0x0D, 0xF0, 0xA1, 0x9D, 0xC7, 0x47, 0x96, 0x5D, 0x22, 0x59,
+    0x1B, 0x87, 0x84, 0x25, 0xD0, 0xDC, 0x88, 0xF0, 0x25, 0xF2, 0x4D, 0xC7, 0xDC, 0x93, 0x4F, 0x9F,
+    0xFC, 0xA8, 0x5E, 0x7E, 0xF5, 0x4C, 0xF7, 0x6F, 0x7E, 0x66, 0xEE, 0xFF, 0xFC, 0x5B, 0x84, 0x62,
+    0x4F, 0x6E, 0x33, 0x95, 0x1D, 0x57, 0x32, 0xDE, 0x9C, 0xFA, 0x26, 0xEE, 0xF9, 0x69, 0xDB, 0x2F,
+    0xC3, 0x8F, 0xD9, 0x02, 0xAB, 0x10, 0x7B, 0x81, 0x2D, 0xB5, 0x6D, 0xE9, 0x74, 0xC9, 0x9F, 0xB4,
+    0x04, 0xCF, 0x6E, 0xF9, 0xFC, 0xB6, 0x02, 0x29, 0xA4, 0xB7, 0x75, 0xD2, 0x36, 0x36, 0x7C, 0x90,
+    0x05, 0x47, 0x85, 0xCA, 0xF6, 0xD0, 0x5D, 0x6E, 0x6C, 0x1E, 0x69, 0x2C, 0xE9, 0x3C, 0xF6, 0xCB,
+    0xC0, 0x6E, 0x4A, 0x2F, 0xDD, 0x57, 0x99, 0x01, 0xFD, 0xCC, 0xA3, 0xAB, 0xC7, 0xD7, 0x6F, 0xC1,
+    0xAF, 0xF0, 0xFE, 0xBA, 0xCA, 0xF7, 0xC7, 0x5E, 0x6F, 0x62, 0xD3, 0xA3, 0x75, 0xC4, 0x5E, 0x6E,
+    0x32, 0x36, 0xF3, 0x9A, 0x16, 0xAF, 0xDF, 0xC2, 0x5D, 0xF9, 0x37, 0x4E, 0xD9, 0xA0, 0xF7, 0xD9,
+    0xEE, 0x2A, 0x93, 0x47, 0xC9, 0x02, 0x5E, 0xC3, 0x7F, 0x1B, 0xFF, 0x00, 0xBD, 0x55, 0xBF, 0x8F,
+    0xDC, 0x44, 0x14, 0xFE, 0x6C, 0x87, 0x0C, 0x8A, 0x77, 0x6F, 0x52, 0x80, 0x74, 0x82, 0x5B, 0x26,
+    0xC5, 0x16, 0x2B, 0x74, 0x1B, 0x47, 0x28, 0xC5, 0x4A, 0xEC, 0x9D, 0x9D, 0x50, 0xA4, 0xE2, 0x47,
+    0x01, 0x0D, 0x05, 0x50, 0x04, 0x89, 0x02, 0x74, 0x27, 0x41, 0x41, 0x71, 0xC9, 0x5A, 0x09, 0x12,
+    0x0D, 0xC5, 0xFD, 0x07, 0xA4, 0x80, 0x26, 0x41, 0x70, 0x45, 0x8A, 0x48, 0xEC, 0xB1, 0x13, 0x4E,
+    0x54, 0x14, 0x71, 0x48, 0x15, 0x51, 0x60, 0x89, 0x23, 0x48, 0xA1, 0x19, 0x09, 0x03, 0x46, 0x78,
+    0x77, 0xF8, 0xC6, 0xDE, 0xBD, 0xE4, 0x22, 0x6A, 0xC6, 0xEB, 0x9D, 0xF1, 0x9B, 0x1F, 0xEF, 0xBD,
+    0xEF, 0x7D, 0xEF, 0x0D, 0x30, 0x6F, 0x52, 0x03, 0x41, 0x81, 0x0A, 0x33, 0xA8, 0x4C, 0xE9, 0x58,
+    0x63, 0x72, 0x76, 0x1A, 0x1A, 0x04, 0x15, 0xFC, 0x29, 0xA7, 0x0D, 0x26, 0x09, 0x10, 0xEB, 0x28,
+    0x07, 0x3C, 0x2B, 0x2A, 0x6E, 0x09, 0xA7, 0x16, 0x50, 0x49, 0x6C, 0x33, 0xF8, 0x25, 0x6C, 0xE1,
+    0x17, 0x71, 0x2A, 0x2C, 0xE2, 0x17, 0x2A, 0x7E, 0x04, 0x25, 0x57, 0xDB, 0x2C, 0x4E, 0x21, 0x2D,
+    0x97, 0x21, 0xB0, 0x2F, 0xBB, 0x3D, 0x36, 0x1F, 0x19, 0x20, 0xAA, 0x7C, 0xAB, 0x11, 0x5A, 0xCE,
+    0xC1, 0x8D, 0xE2, 0x12, 0x93, 0x22, 0xE2, 0xA4, 0x9A, 0x05, 0x46, 0xD8, 0x94, 0x5B, 0x13, 0x67,
+    0x94, 0x28, 0x17, 0xE6, 0xC1, 0x4B, 0x87, 0x42, 0x6F, 0x09, 0x3D, 0x0E, 0xDD, 0xAF, 0x92, 0x8B,
+    0x9F, 0xBA, 0x59, 0x21, 0x41, 0x7C, 0xB9, 0x1C, 0x7D, 0x5F, 0xF1, 0x24, 0x8F, 0x4B, 0xA9, 0x40,
+    0x52, 0x07, 0x1D, 0xB1, 0xD3, 0x20, 0xB7, 0xA6, 0x2B, 0x37, 0x52, 0x98, 0x0A, 0x2A, 0xD4, 0x9E,
+    0x19, 0x37, 0x5D, 0x85, 0x48, 0x25, 0xFE, 0x5F, 0x06, 0xD1, 0x94, 0x16, 0xA4, 0x18, 0xE5, 0x08,
+    0xA9, 0x6C, 0x42, 0xAF, 0xCC, 0x41, 0xF7, 0x4D, 0xA3, 0xFA, 0x89, 0xE6, 0xCB, 0xD6, 0x28, 0xB8,
+    0x4E, 0x15, 0xDC, 0x93, 0xE0, 0xD9, 0xAB, 0x57, 0xE9, 0xDB, 0x9E, 0xB5, 0x66, 0x2D, 0x19, 0xEC,
+    0xE0, 0xF6, 0xFE, 0x9B, 0x9E, 0x35, 0x78, 0x9B, 0x3B, 0x9C, 0xF1, 0x57, 0x68, 0xFE, 0x32, 0xFF,
+    0x26, 0x19, 0x07, 0x04, 0x2D, 0xBC, 0x96, 0xC2, 0x5F, 0x3E, 0xCE, 0x0F, 0xDA, 0xB8, 0x8D, 0x0C,
+    0xDD, 0xD7, 0xBB, 0x3F, 0xDC, 0xDD, 0x99, 0x64, 0x61, 0x26, 0x32, 0x31, 0x95, 0xD7, 0xCE, 0x9D,
+    0xBF, 0xD7, 0x4B, 0x8E, 0xE1, 0x18, 0xBC, 0xDA, 0x77, 0x9C, 0x26, 0x68, 0x0C, 0x4A, 0xA7, 0xF1,
+    0x28, 0x64, 0x37, 0x38, 0x2C, 0xE1, 0xB2, 0xAD, 0x46, 0x72, 0x72, 0xEE, 0x75, 0xDA, 0x48, 0xA8,
+    0x31, 0x7A, 0x20, 0x99, 0x37, 0xDF, 0xE6, 0xD8, 0xA8, 0x31, 0xF1, 0xAD, 0xD5, 0x17, 0xCF, 0x58,
+    0xB1, 0xAF, 0x4C, 0x17, 0xD1, 0xE5, 0x84, 0xC1, 0xAB, 0xC3, 0xCF, 0xF8, 0x84, 0x87, 0xBA, 0xB9,
+    0xD0, 0x1D, 0x52, 0xBA, 0x48, 0xC3, 0x2F, 0x18, 0x99, 0xDA, 0x1D, 0x8F, 0x72, 0xC5, 0x10, 0x52,
+    0x40, 0x5E, 0x8C, 0x32, 0x92, 0xE1, 0x51, 0xF4, 0xFE, 0xB3, 0x3B, 0x0F, 0x1C, 0x4B, 0xF0, 0x48,
+    0x5B, 0xA7, 0xCD, 0x44, 0x68, 0xD4, 0x00, 0x35, 0x39, 0x04, 0xF7, 0x43, 0x4D, 0xCC, 0x12, 0x52,
+    0x8F, 0x41, 0x96, 0xBF, 0x4C, 0x74, 0x67, 0x40, 0x8E, 0x38, 0x73, 0x9C, 0xB7, 0x63, 0x49, 0xDB,
+    0xCC, 0x9A, 0x33, 0x7C, 0x2E, 0xF2, 0x4A, 0x9A, 0x2B, 0xF5, 0x05, 0x06, 0xD1, 0x2B, 0x78, 0x5E,
+    0x98, 0xF9, 0x16, 0x51, 0x12, 0x19, 0xEC, 0x52, 0x81, 0x5F, 0xF8, 0x15, 0x64, 0x46, 0x35, 0x71,
+    0x12, 0x69, 0x4C, 0x6B, 0x91, 0xF7, 0xCA, 0x03, 0x55, 0x9C, 0x5E, 0xA7, 0x7A, 0x7A, 0x19, 0xEB,
+    0xD0, 0x78, 0x36, 0x89, 0xB5, 0x98, 0x2E, 0x70, 0xDC, 0xA6, 0xA9, 0x04, 0x53, 0xFC, 0xB1, 0x61,
+    0xF0, 0x12, 0x8F, 0x91, 0x0E, 0x29, 0xE2, 0x1E, 0x7B, 0xB4, 0xB7, 0x12, 0x1A, 0x81, 0x51, 0x0E,
+    0xB5, 0x31, 0x70, 0xC1, 0x67, 0x06, 0x19, 0xC2, 0x19, 0x27, 0xB1, 0x63, 0x73, 0xE5, 0xD9, 0x94,
+    0xDF, 0x25, 0x37, 0x50, 0x6F, 0xEC, 0x7C, 0xAD, 0xA8, 0x8B, 0x22, 0x43, 0x38, 0xA3, 0xD4, 0x61,
+    0x00, 0xBC, 0xB3, 0x30, 0x23, 0x4E, 0x55, 0xCA, 0x84, 0xBC, 0x08, 0xE1, 0x56, 0x45, 0x86, 0x80,
+    0xD0, 0xFD, 0x07, 0xED, 0x04, 0x41, 0x61, 0x70, 0xFA, 0x4D, 0xB0, 0x17, 0x4C, 0x28, 0x9A, 0xE1,
+    0x33, 0x54, 0x72, 0x9D, 0x60, 0x68, 0xAF, 0x52, 0x0C, 0xD4, 0x8D, 0x86, 0x18, 0x34, 0x16, 0xE3,
+    0x06, 0x6F, 0x37, 0xA4, 0xD9, 0xBE, 0x1B, 0x36, 0x5C, 0xF2, 0x1D, 0x65, 0x3E, 0xCE, 0xB0, 0x16,
+    0xA5, 0xBE, 0x99, 0x41, 0xEE, 0x55, 0x20, 0xA8, 0xCE, 0x2D, 0xC7, 0x08, 0x86, 0x89, 0x58, 0xD6,
+    0x43, 0x92, 0xC0, 0x51, 0x42, 0x64, 0xB5, 0x94, 0x64, 0xC6, 0x91, 0x3A, 0x49, 0x93, 0x13, 0x97,
+    0xCE, 0xBC, 0x78, 0xF4, 0xB9, 0x4F, 0xBE, 0x7B, 0xFF, 0xEC, 0xAD, 0x37, 0x54, 0x11, 0xB9, 0x50,
+    0x67, 0x7E, 0x2E, 0xAE, 0xB4, 0xDF, 0x5A, 0xDD, 0x89, 0x2B, 0xEC, 0xB8, 0x67, 0x72, 0x17, 0xDB,
+    0x6D, 0xD8, 0x74, 0x09, 0xD7, 0xA5, 0xFD, 0x91, 0x95, 0xA2, 0x85, 0x2E, 0x9E, 0xCF, 0x87, 0xAB,
+    0x83, 0xD6, 0xEA, 0xAA, 0x2C, 0xBC, 0x6D, 0x6B, 0x3C, 0x1D, 0x92, 0xED, 0xB9, 0x48, 0xFA, 0x30,
+    0x81, 0x66, 0x4A, 0x6C, 0xB7, 0xBA, 0xBD, 0x95, 0x4E, 0x4F, 0xE4, 0x9D, 0xC1, 0x60, 0x65, 0xD0,
+    0x5E, 0xDB, 0x62, 0x48, 0xF3, 0x5E, 0xEF, 0xD4, 0xCA, 0xE9, 0x56, 0xFF, 0x3D, 0x72, 0xAF, 0xF5,
+    0xD4, 0x58, 0xE5, 0x4B, 0x2A, 0x27, 0x3F, 0x32, 0x55, 0x8C, 0x18, 0xB8, 0x32, 0x4A, 0xC2, 0x4B,
+    0x06, 0xE3, 0x08, 0xE1, 0xB7, 0xEC, 0xE2, 0x44, 0xEE, 0xB1, 0xBC, 0xB1, 0xBB, 0x53, 0x60, 0x3A,
+    0xEF, 0x8E, 0x7E, 0x26, 0xFC, 0xCB, 0xE9, 0xA9, 0x6C, 0x69, 0xF3, 0xCE, 0x17, 0xA7, 0xBF, 0x6E,
+    0xAF, 0xDF, 0x96, 0x1F, 0x8A, 0x4F, 0xCF, 0xFD, 0x6C, 0xCD, 0xA8, 0x3C, 0x5A, 0xE2, 0x88, 0xC8,
+    0xDA, 0x98, 0xFF, 0x26, 0x3F, 0x4D, 0xE1, 0xCD, 0x1E, 0x5F, 0xC2, 0x0A, 0x76, 0x44, 0x72, 0x43,
+    0xA6, 0x93, 0xDF, 0xAD, 0x56, 0x39, 0x96, 0xB1, 0x4C, 0xCE, 0x76, 0x29, 0x5E, 0x8D, 0x4A, 0xD6,
+    0xC6, 0xE3, 0xC8, 0xE9, 0xEE, 0x66, 0x7B, 0x73, 0x75, 0x33, 0x9E, 0xD6, 0xEE, 0x5E, 0x27, 0xA3,
+    0xF7, 0xD0, 0x42, 0x9C, 0x79, 0x3A, 0xF8, 0xA8, 0x13, 0x9B, 0x2F, 0x59, 0x2D, 0xDB, 0x07, 0x1E,
+    0xF7, 0x5A, 0x6A, 0xCC, 0x13, 0x02, 0xAB, 0x05, 0x7A, 0xC8, 0x83, 0xA4, 0x83, 0x9D, 0x40, 0x2B,
+    0x16, 0x1D, 0xFA, 0xDC, 0x5B, 0x6E, 0xB5, 0x7B, 0xC2, 0x74, 0x7A, 0x83, 0xD6, 0xA0, 0xDD, 0x7F,
+    0x37, 0x2C, 0x0E, 0x7C, 0xEE, 0x2F, 0x7C, 0x66, 0xF0, 0x87, 0xD4, 0x61, 0xFC, 0x3C, 0xD0, 0x61,
+    0x2A, 0x13, 0x49, 0x0A, 0xAC, 0x33, 0x6A, 0x43, 0xC6, 0xF3, 0xE1, 0x67, 0x48, 0xD9, 0x3A, 0xCB,
+    0x82, 0x62, 0xAC, 0xA5, 0x0E, 0xB5, 0xC8, 0x02, 0xE3, 0xBB, 0x7A, 0xBF, 0x8B, 0x27, 0x3F, 0xE0,
+    0xEC, 0x49, 0xD2, 0x21, 0x4C, 0x03, 0x1D, 0x64, 0x0C, 0xB7, 0x21, 0x87, 0x6E, 0x1C, 0x6C, 0x6B,
+    0x9E, 0x61, 0x7D, 0xE4, 0x98, 0xF2, 0x12, 0x85, 0x6F, 0x82, 0x3C, 0xC8, 0x42, 0x2D, 0x35, 0xEB,
+    0x3F, 0xF9, 0xF9, 0x2A, 0xE3, 0xDC, 0x67, 0x41, 0x92, 0x24, 0x9E, 0xB8, 0x69, 0xC8, 0x29, 0xD2,
+    0xAD, 0x58, 0x73, 0x57, 0x00, 0x39, 0xCD, 0xAA, 0x38, 0xB1, 0xBC, 0x14, 0xB2, 0x02, 0xD6, 0x0C,
+    0x31, 0x1A, 0x2B, 0xC4, 0xEF, 0x85, 0x89, 0xBA, 0x45, 0x93, 0x7F, 0xBD, 0x69, 0x82, 0x3F, 0xB9,
+    0xBA, 0xE2, 0xEA, 0x78, 0x4B, 0xF2, 0x46, 0x10, 0x3A, 0xB0, 0x97, 0x72, 0x5E, 0x06, 0x05, 0x77,
+    0xEF, 0x6E, 0x08, 0xCB, 0x94, 0xE7, 0x6B, 0x94, 0xB5, 0x55, 0xC0, 0x81, 0x7F, 0xCF, 0xCE, 0x12,
+    0x77, 0xF6, 0x90, 0x04, 0x56, 0x4C, 0xB7, 0x90, 0xAB, 0x03, 0x9E, 0xBD, 0xB8, 0x29, 0xBE, 0x2A,
+    0x9B, 0x32, 0xC1, 0xF5, 0x88, 0xF7, 0xC9, 0x68, 0x4E, 0x79, 0xD3, 0x3A, 0x9D, 0x48, 0x59, 0x57,
+    0x53, 0x5C, 0x61, 0x97, 0x24, 0x2D, 0xDD, 0xEF, 0x57, 0x92, 0xA5, 0x41, 0xCF, 0x08, 0x8D, 0x34,
+    0x7E, 0x46, 0xB5, 0x6B, 0xB4, 0xE1, 0x9F, 0xDF, 0xF4, 0x68, 0xAE, 0x4E, 0x3B, 0xBD, 0xF4, 0x81,
+    0x07, 0x8E, 0xEC, 0xFE, 0xE1, 0xC2, 0x15, 0x95, 0x2C, 0x07, 0x36, 0x91, 0x7F, 0x3F, 0x9D, 0xB1,
+    0x48, 0xA6, 0x2E, 0xA1, 0xEA, 0x97, 0xB4, 0x8F, 0xEE, 0x5F, 0xA5, 0xF9, 0xB6, 0x7E, 0x5D, 0x86,
+    0xB9, 0x24, 0x8A, 0xB8, 0xD6, 0xBD, 0x8F, 0xED, 0xBE, 0xC6, 0xD2, 0x50, 0xAB, 0x77, 0xF7, 0x2B,
+    0x36, 0x38, 0x6F, 0xEF, 0x7F, 0x0E, 0xE7, 0xA5, 0x75, 0xDA, 0xFE, 0xBF, 0xF6, 0x2F, 0x7D, 0x55,
+    0x3D, 0x6C, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0x0B, 0x19, 0x94, 0x45, 0x37, 0x29, 0xD2, 0xF0, 0xE7,
+    0xA5, 0xA1, 0x31, 0xC1, 0x4B, 0x19, 0xA1, 0xB3, 0x77, 0x85, 0x8B, 0x74, 0x84, 0xC6, 0x69, 0x90,
+    0x62, 0x6A, 0x1A, 0xA7, 0xA0, 0x70, 0x11, 0xFB, 0x96, 0xA4, 0xA0, 0xC4, 0x42, 0x50, 0xD1, 0xA4,
+    0x80, 0x26, 0x29, 0x2E, 0x45, 0x0A, 0x0A, 0xE2, 0x1B, 0x21, 0x81, 0xDB, 0x13, 0x28, 0x75, 0x56,
+    0x32, 0x15, 0x05, 0x9E, 0x48, 0x8B, 0xB2, 0xB6, 0x77, 0x77, 0x78, 0xDF, 0xAC, 0xEF, 0xA2, 0x8B,
+    0x25, 0x46, 0x37, 0xEF, 0x66, 0xBF, 0xDD, 0xFD, 0x7E, 0xDE, 0xF7, 0x66, 0x16, 0xF0, 0x63, 0x03,
+    0xC8, 0x80, 0x49, 0x2E, 0xE8, 0x0A, 0x8F, 0x06, 0x23, 0x62, 0xE9, 0xD1, 0x7A, 0xAC, 0x31, 0x01,
+    0xDA, 0x86, 0x18, 0x34, 0x1D, 0xF6, 0x89, 0x23, 0x74, 0x08, 0xDB, 0xAC, 0xE8, 0x30, 0x71, 0x1C,
+    0x6D, 0x8F, 0x61, 0xA3, 0x6C, 0x8B, 0xA8, 0x89, 0x2A, 0x62, 0x1B, 0xB6, 0x82, 0xE8, 0x3C, 0x4E,
+    0x1A, 0xC1, 0xCC, 0x63, 0xEA, 0x51, 0x37, 0xC0, 0xC8, 0xED, 0x09, 0xB4, 0xC0, 0xCE, 0x0D, 0x97,
+    0xE3, 0x17, 0x68, 0x43, 0x50, 0xD3, 0x11, 0xBD, 0x35, 0xCB, 0xEE, 0xFE, 0xB8, 0xE6, 0x65, 0x62,
+    0xC0, 0xCB, 0x42, 0x80, 0xB9, 0xB8, 0xBF, 0xC0, 0xD8, 0x1C, 0xED, 0x1C, 0xBA, 0x19, 0x04, 0x2F,
+    0xC0, 0x2D, 0x40, 0xE2, 0x1F, 0x51, 0xAE, 0x12, 0xC3, 0x93, 0x2D, 0xB9, 0xB8, 0x15, 0x96, 0xC4,
+    0xB7, 0x71, 0x95, 0x18, 0x43, 0x13, 0x43, 0xA3, 0x0C, 0xFF, 0x1E, 0x46, 0x16, 0x49, 0xBD, 0xC2,
+    0xD0, 0x49, 0x17, 0xBB, 0x06, 0x03, 0x44, 0xC4, 0x28, 0x87, 0xE4, 0x50, 0x22, 0xFB, 0xB6, 0x42,
+    0x96, 0x6B, 0x93, 0x22, 0xEA, 0x22, 0xCB, 0x37, 0x52, 0xDB, 0x04, 0xF4, 0xBB, 0x9B, 0x61, 0x97,
+    0x9E, 0xBE, 0x31, 0x89, 0x89, 0x1F, 0x1C, 0x5A, 0x65, 0x95, 0xAB, 0x9B, 0xA0, 0x09, 0x5D, 0x93,
+    0x91, 0xDE, 0xF4, 0x58, 0x42, 0x04, 0xE5, 0x90, 0x8F, 0xE4, 0x16, 0x18, 0x86, 0x53, 0xC0, 0xC6,
+    0x39, 0x22, 0xB3, 0xC4, 0xF4, 0x70, 0x5B, 0x15, 0xDB, 0x29, 0x0B, 0xEC, 0x84, 0xC8, 0x7A, 0xF3,
+    0x87, 0xE3, 0x9D, 0xFC, 0x83, 0xD4, 0x5A, 0x3C, 0x3A, 0x3D, 0x30, 0xC1, 0xE1, 0xD3, 0x9B, 0x50,
+    0x47, 0x2B, 0x3F, 0x93, 0xB2, 0xD1, 0x14, 0x59, 0x49, 0xA6, 0xDC, 0x3A, 0x53, 0x6A, 0xB4, 0x45,
+    0x6C, 0x53, 0xA6, 0x50, 0x30, 0xF4, 0x0E, 0x6A, 0x7C, 0xF4, 0x1D, 0x0B, 0xC8, 0xA4, 0xCC, 0x8C,
+    0x64, 0xA5, 0x59, 0xBE, 0x55, 0xA4, 0x6B, 0xE4, 0x33, 0x5D, 0x45, 0x58, 0x12, 0x02, 0x9B, 0xAE,
+    0x86, 0x39, 0x41, 0x99, 0x05, 0x88, 0xCC, 0xBD, 0x74, 0x18, 0xD1, 0x51, 0x0F, 0xA1, 0x45, 0x36,
+    0x24, 0xB7, 0xA3, 0x21, 0x46, 0xA7, 0xEE, 0x32, 0x62, 0x61, 0x1E, 0x6F, 0xEE, 0x13, 0x72, 0xCE,
+    0x47, 0x9C, 0x57, 0x84, 0xCE, 0x96, 0xEC, 0x32, 0x19, 0x3C, 0x04, 0xF6, 0xAF, 0x70, 0x7D, 0x04,
+    0x54, 0x23, 0xE3, 0x19, 0xBC, 0xCA, 0xC6, 0x2D, 0x81, 0x24, 0x19, 0xB6, 0xB4, 0x8E, 0x2D, 0x52,
+    0x21, 0x51, 0xFC, 0xA4, 0xCF, 0x8D, 0xB8, 0xE1, 0xBA, 0xEB, 0xFB, 0x2A, 0x23, 0xF8, 0x22, 0xA7,
+    0x92, 0x8A, 0x98, 0xB6, 0x6C, 0xEF, 0x72, 0x58, 0x43, 0x94, 0x80, 0x35, 0xA9, 0xA3, 0x09, 0x4E,
+    0x59, 0x90, 0x66, 0x98, 0x55, 0xBE, 0xEC, 0xEA, 0xD0, 0x51, 0x95, 0xBA, 0xF0, 0xBA, 0xC5, 0x63,
+    0xBE, 0x4A, 0x1D, 0x45, 0xDD, 0xF7, 0xB9, 0xBC, 0xAB, 0x29, 0xD5, 0x0B, 0x4E, 0x1A, 0x0B, 0x91,
+    0xD0, 0x33, 0x51, 0xE5, 0x81, 0x1B, 0xFF, 0xED, 0xFA, 0xA7, 0xC1, 0x47, 0x11, 0x59, 0xBA, 0xD2,
+    0x47, 0x84, 0x8C, 0xEA, 0x89, 0xBB, 0x9C, 0x89, 0xB3, 0x23, 0x6A, 0xFC, 0x3B, 0x4D, 0x23, 0x9A,
+    0x42, 0x71, 0x30, 0xA9, 0xA4, 0x40, 0xE6, 0xF0, 0xC6, 0x44, 0xA4, 0x21, 0x3A, 0x8B, 0x45, 0x3D,
+    0x29, 0xFB, 0x26, 0xDB, 0xA5, 0x37, 0x25, 0xA2, 0x46, 0x72, 0xC0, 0x3B, 0xC9, 0xC6, 0x56, 0x09,
+    0x21, 0xCE, 0x47, 0x76, 0x25, 0x97, 0x49, 0xEE, 0x97, 0x53, 0xD2, 0x31, 0xF1, 0x1D, 0x29, 0xA5,
+    0xEA, 0x5A, 0x96, 0x84, 0xA8, 0x96, 0x8C, 0x32, 0x21, 0x34, 0xAA, 0xFC, 0x52, 0xA8, 0xE8, 0xAD,
+    0x23, 0x59, 0xAA, 0x7E, 0x29, 0x9A, 0x54, 0xCD, 0x7C, 0x79, 0x36, 0xF4, 0x79, 0xB8, 0x30, 0xE9,
+    0x84, 0x44, 0x67, 0x22, 0x37, 0xBE, 0x61, 0x74, 0x4D, 0x5B, 0x52, 0x12, 0x52, 0xA3, 0xC5, 0xB9,
+    0x87, 0x81, 0x44, 0x7C, 0x01, 0xFA, 0x53, 0x01, 0xD7, 0xF2, 0x72, 0xDC, 0x65, 0x66, 0x10, 0x9C,
+    0x64, 0xD3, 0x01, 0x45, 0x52, 0x0D, 0x42, 0x9B, 0xB8, 0xA3, 0xB1, 0xD5, 0xCC, 0xDF, 0x32, 0x69,
+    0x56, 0x28, 0x45, 0x51, 0x09, 0xC7, 0x8C, 0xF4, 0x0E, 0x16, 0x40, 0xC6, 0xFB, 0x9E, 0x75, 0x5F,
+    0x5D, 0xE4, 0xF9, 0x78, 0x05, 0x5B, 0x56, 0x6E, 0x24, 0x42, 0x18, 0x15, 0x2A, 0xB8, 0x2B, 0xC0,
+    0xE6, 0x66, 0x42, 0x4B, 0x25, 0xE0, 0xFE, 0xB8, 0x2F, 0x23, 0xF7, 0x3E, 0x96, 0x65, 0x79, 0xCF,
+    0x9B, 0xFF, 0xF4, 0x78, 0xDD, 0x79, 0x5E, 0xC8, 0x74, 0xE1, 0x59, 0xF5, 0x67, 0x80, 0xA8, 0xDF,
+    0x1F, 0x05, 0x2C, 0x95, 0x77, 0xDE, 0x9A, 0x49, 0xA8, 0xCF, 0xA6, 0xFF, 0x4D, 0x4A, 0xE5, 0xAC,
+    0xFE, 0xE7, 0x52, 0xFA, 0x09, 0xB2, 0x01, 0x56, 0x67, 0xBF, 0xB5, 0x01, 0x32, 0x8D, 0xF4, 0x29,
+    0x75, 0x52, 0x29, 0xEA, 0x71, 0x74, 0xCC, 0xAD, 0x2F, 0x8E, 0xED, 0x06, 0x47, 0x3E, 0x27, 0x77,
+    0xAE, 0x9D, 0x5F, 0x7F, 0xBA, 0xFE, 0xDB, 0xC6, 0x82, 0x76, 0xD0, 0x2B, 0xD3, 0x9B, 0x44, 0x79,
+    0x50, 0x62, 0x4A, 0xC4, 0x34, 0x9A, 0x99, 0x62, 0x7B, 0x4E, 0x28, 0xA2, 0x1D, 0x96, 0x47, 0x3A,
+    0x8D, 0xEC, 0x7C, 0x1E, 0x03, 0x2A, 0xBF, 0xF8, 0xE0, 0xE4, 0xAE, 0x68, 0x79, 0x55, 0x5E, 0xD5,
+    0x8E, 0xBC, 0xB1, 0xB2, 0xCA, 0xBB, 0x56, 0x53, 0x1F, 0x8F, 0x2B, 0x3D, 0xE5, 0x3E, 0xEF, 0x0F,
+    0x31, 0x3F, 0xB8, 0x3F, 0x7D, 0xB3, 0x87, 0x17, 0x81, 0xE7, 0x0D, 0x25, 0xBA, 0x17, 0xBA, 0x29,
+    0x0F, 0x86, 0x00, 0xEF, 0x3D, 0xE3, 0xC9, 0x29, 0xC7, 0x76, 0x0D, 0xDD, 0x62, 0xB8, 0x66, 0xC3,
+    0x52, 0xF1, 0x94, 0x4A, 0x98, 0x0D, 0x55, 0x1D, 0x74, 0x67, 0xE5, 0xC5, 0x67, 0x53, 0xE5, 0x7D,
+    0x6F, 0xC8, 0x21, 0x1B, 0x96, 0xAB, 0xD3, 0x4D, 0x13, 0x1F, 0x5C, 0x33, 0xFA, 0xEB, 0xF5, 0xA9,
+    0xBE, 0xF6, 0xF1, 0x54, 0x2B, 0xCE, 0xE8, 0xAB, 0x97, 0xE6, 0x9D, 0x7E, 0xAE, 0xDF, 0x99, 0xC6,
+    0x9C, 0x0C, 0xD7, 0xC9, 0x2E, 0x61, 0x50, 0xF5, 0xE4, 0xB3, 0x0A, 0xB1, 0x61, 0xD2, 0x84, 0x9D,
+    0x39, 0x3C, 0x26, 0x59, 0x61, 0xF3, 0xEA, 0x26, 0xBB, 0x2D, 0x4A, 0x2A, 0xB5, 0xF3, 0x9B, 0x54,
+    0xA4, 0xC2, 0xC2, 0xB0, 0x3C, 0x3E, 0xF9, 0x51, 0xC4, 0x50, 0xF7, 0x40, 0xB9, 0x62, 0x06, 0x76,
+    0x01, 0x42, 0x49, 0xBA, 0x90, 0x83, 0x12, 0xB8, 0xCD, 0x49, 0x96, 0xA2, 0xB2, 0x37, 0xC9, 0xA9,
+    0x29, 0x53, 0xD6, 0x62, 0x93, 0x7B, 0x42, 0xA9, 0x7F, 0x56, 0xCD, 0x68, 0x2B, 0xCE, 0xBE, 0x15,
+    0xE4, 0x2A, 0x60, 0x0A, 0xC1, 0xBF, 0x87, 0x65, 0x58, 0x6D, 0x67, 0xA1, 0x5D, 0x0A, 0xCB, 0x5B,
+    0xAA, 0x78, 0x97, 0x47, 0x33, 0xEF, 0x6E, 0x73, 0x2E, 0xC9, 0x6B, 0x05, 0x16, 0x0D, 0xF8, 0xFC,
+    0x65, 0xC7, 0x6C, 0x43, 0x28, 0x99, 0xD5, 0xCC, 0xBC, 0xCD, 0xBC, 0x12, 0x79, 0xFE, 0x42, 0x3E,
+    0x2A, 0xAC, 0x7B, 0x9E, 0xE8, 0x97, 0x7D, 0xF8, 0xFF, 0xF5, 0xCE, 0xF8, 0x97, 0xD2, 0xA0, 0x5C,
+    0x91, 0x84, 0x90, 0xDC, 0x5C, 0xF3, 0x19, 0x4A, 0x0F, 0xFB, 0x94, 0x5F, 0x9B, 0xD5, 0xF0, 0x3A,
+    0x3E, 0x14, 0xE5, 0x0C, 0xE5, 0x00, 0xD6, 0xA0, 0x8C, 0x22, 0x43, 0x57, 0x41, 0x99, 0x70, 0xD7,
+    0xD4, 0x42, 0x41, 0x23, 0xC2, 0xB0, 0x54, 0x08, 0xEF, 0xF1, 0xCB, 0x90, 0x33, 0xC0, 0xD2, 0xEC,
+    0x13, 0x77, 0x6E, 0xFC, 0x07, 0xA5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC7, 0xD6,
+    0xA2, 0x2C, 0xF6, 0xA6, 0xE0, 0x87, 0x90, 0x21, 0x4B, 0x19, 0x09, 0xE3, 0x6D, 0x28, 0x28, 0xCE,
+    0xB7, 0x0B, 0x14, 0x14, 0x2E, 0x62, 0x24, 0x42, 0x01, 0x0D, 0xFF, 0x81, 0x5D, 0xB8, 0xA0, 0xB0,
+    0x7D, 0xEB, 0xB8, 0xA0, 0xCD, 0x9F, 0xE0, 0x16, 0x17, 0xD8, 0x12, 0x29, 0x22, 0x74, 0x62, 0x27,
+    0x50, 0x50, 0x50, 0x64, 0x23, 0x2B, 0x4A, 0x81, 0x04, 0x5B, 0xC4, 0x05, 0x34, 0x99, 0xA0, 0x4D,
+    0xB2, 0x31, 0x7B, 0x37, 0x7C, 0x6F, 0xCE, 0x77, 0x09, 0x5D, 0xA4, 0xEC, 0xDD, 0xBC, 0xDB, 0xDD,
+    0x79, 0xF3, 0xDE, 0xF7, 0x7E, 0x7D, 0x07, 0xF0, 0xBA, 0x01, 0xA4, 0x15, 0xE2, 0xB2, 0x08, 0x7F,
+    0x5D, 0x51, 0x76, 0x73, 0xFB, 0x72, 0xA8, 0x0C, 0x36, 0x81, 0x90, 0x7B, 0xB3, 0x9F, 0xB9, 0x10,
+    0xBA, 0xDE, 0x5C, 0x8E, 0xBE, 0x8D, 0xF2, 0xF4, 0x87, 0x0A, 0x03, 0x0B, 0xD5, 0x01, 0x01, 0xA0,
+    0xBE, 0xFC, 0x3E, 0x74, 0x6E, 0x6F, 0x94, 0xA3, 0x2C, 0xF0, 0x7E, 0x8B, 0x28, 0x2E, 0x02, 0xD3,
+    0xC2, 0xC6, 0x45, 0x0F, 0x6D, 0x8C, 0xF8, 0xE7, 0x1C, 0x2D, 0xF0, 0x4A, 0x7C, 0xF8, 0xB9, 0x76,
+    0xAE, 0xC2, 0x9B, 0x0D, 0xF4, 0x08, 0xFA, 0x49, 0xA1, 0x1F, 0xD6, 0xDA, 0x7E, 0xA8, 0xED, 0xA2,
+    0xB6, 0xFA, 0x17, 0x8B, 0x7F, 0x2C, 0x5E, 0x7B, 0x57, 0xD0, 0x88, 0xBF, 0xC0, 0xE2, 0x62, 0x1F,
+    0xB1, 0xAE, 0x75, 0xB1, 0xAA, 0xAA, 0xB0, 0xDA, 0xC2, 0xF6, 0x32, 0xA2, 0xDB, 0x40, 0x69, 0x10,
+    0xD7, 0x99, 0x6B, 0x63, 0x37, 0xC2, 0xE4, 0x32, 0x40, 0x6B, 0xD1, 0xF6, 0x30, 0x8C, 0x30, 0x54,
+    0xD5, 0x36, 0xBE, 0xD9, 0xC1, 0xE2, 0x2A, 0xF4, 0x18, 0xE0, 0x37, 0x75, 0x5D, 0xE4, 0x1C, 0x30,
+    0x2F, 0xAA, 0x3D, 0x2E, 0x65, 0x29, 0xE2, 0x9C, 0xE2, 0x26, 0x57, 0xC4, 0xD3, 0x18, 0x38, 0xE7,
+    0x3E, 0xAD, 0x78, 0x93, 0x8A, 0x52, 0xE6, 0x05, 0x5F, 0xE5, 0xFE, 0xAE, 0x2F, 0x62, 0x47, 0xC4,
+    0x31, 0xA6, 0x57, 0xC1, 0x15, 0x18, 0x23, 0xC7, 0x69, 0x2D, 0x35, 0xCC, 0xC3, 0xAE, 0x79, 0x00,
+    0xF5, 0xC8, 0xDC, 0xAB, 0xC2, 0x3B, 0xE6, 0x4E, 0x93, 0x7C, 0x64, 0xAA, 0x9D, 0x15, 0x65, 0xAA,
+    0x77, 0xE6, 0x28, 0xE8, 0xF4, 0x05, 0x05, 0x20, 0xC0, 0xE2, 0x99, 0x5F, 0x01, 0x8C, 0x6D, 0x11,
+    0x43, 0xE6, 0xCE, 0xB5, 0x72, 0x27, 0x22, 0x90, 0x20, 0x52, 0x79, 0x65, 0xCF, 0x61, 0xAB, 0x46,
+    0x0E, 0x0A, 0xB0, 0x65, 0x51, 0xBA, 0x28, 0x28, 0x8B, 0x17, 0x76, 0xFC, 0x36, 0xC5, 0xAB, 0x29,
+    0x45, 0x3F, 0xBA, 0x65, 0xAA, 0x36, 0x78, 0x68, 0x4E, 0x6A, 0x8C, 0xCD, 0x9F, 0x05, 0x32, 0xC3,
+    0x3C, 0xC7, 0x86, 0xD6, 0xB5, 0x07, 0x68, 0xF2, 0xF3, 0x1C, 0xCC, 0x43, 0x51, 0x5A, 0x7E, 0x90,
+    0x88, 0x63, 0x5D, 0x09, 0xDA, 0x9B, 0x92, 0x5F, 0xE2, 0x89, 0x0A, 0xB6, 0x84, 0x1B, 0x7B, 0x54,
+    0x6D, 0xEA, 0x13, 0x2D, 0xCD, 0x62, 0x05, 0x72, 0x47, 0x7B, 0xA2, 0xD3, 0x47, 0x58, 0x09, 0x6E,
+    0x06, 0x14, 0xF1, 0x33, 0x85, 0x8D, 0x49, 0xD3, 0x61, 0xC0, 0xB5, 0xCB, 0xF3, 0xC3, 0x2C, 0xC7,
+    0x78, 0xB1, 0x0B, 0xDC, 0xFE, 0x5A, 0xDD, 0x3B, 0xA8, 0x6E, 0xE0, 0xF2, 0x07, 0xC0, 0x85, 0x05,
+    0x5A, 0xDB, 0x27, 0x96, 0x03, 0x82, 0x9A, 0xBC, 0x50, 0xEA, 0xF1, 0xFE, 0x27, 0xF5, 0xA0, 0x3E,
+    0x69, 0x82, 0x36, 0xAB, 0x91, 0x5C, 0xA1, 0x71, 0x67, 0x04, 0x3C, 0x63, 0x94, 0xC4, 0xE0, 0x12,
+    0xF5, 0xD9, 0xA2, 0xC4, 0x3B, 0xC9, 0xEC, 0xB1, 0x54, 0x11, 0xDE, 0x75, 0x0F, 0x47, 0x85, 0x4D,
+    0xDC, 0x89, 0x19, 0x85, 0x7F, 0x44, 0x46, 0x37, 0x7D, 0x02, 0x6E, 0x91, 0xE8, 0x1A, 0xDB, 0x7C,
+    0xAC, 0x92, 0xD3, 0x01, 0x5B, 0xA2, 0xE5, 0x32, 0x58, 0x6A, 0x66, 0x7D, 0xB0, 0xE4, 0xAE, 0x6B,
+    0x23, 0xED, 0x43, 0xBD, 0xF2, 0x74, 0xF0, 0xA4, 0xC6, 0xC0, 0x28, 0x57, 0x33, 0x69, 0x48, 0x2C,
+    0x12, 0x83, 0x90, 0xB1, 0xD6, 0x08, 0x5D, 0xAE, 0x2D, 0xC2, 0xDF, 0x6A, 0x74, 0x08, 0x6F, 0xD1,
+    0x0A, 0x8D, 0xB3, 0xB9, 0x8B, 0xC8, 0xC4, 0x46, 0xDB, 0xA8, 0xE0, 0xE9, 0x2E, 0x2E, 0x14, 0x37,
+    0xAE, 0x14, 0xEC, 0xD9, 0xD8, 0x71, 0x92, 0x72, 0xE5, 0x4E, 0xBF, 0xA0, 0x37, 0x69, 0xC4, 0x9A,
+    0xAF, 0xA4, 0xD2, 0x22, 0x1B, 0xC4, 0x6B, 0x5E, 0x8A, 0x73, 0x99, 0xBE, 0x67, 0x97, 0x16, 0x60,
+    0x49, 0x4D, 0x21, 0x61, 0x87, 0x0F, 0x18, 0x69, 0xC6, 0x34, 0xAB, 0x6E, 0x97, 0x49, 0xA8, 0x98,
+    0xFE, 0x2C, 0x68, 0x11, 0x34, 0x84, 0x12, 0x9B, 0xA8, 0xC6, 0x4F, 0x04, 0xC8, 0xFB, 0xAC, 0x48,
+    0x19, 0x02, 0x58, 0xE5, 0x71, 0x64, 0x11, 0x74, 0xD9, 0xDD, 0xAB, 0x5F, 0x35, 0x74, 0xE4, 0x4E,
+    0x9C, 0x9F, 0x01, 0xE7, 0x46, 0xB2, 0x38, 0x89, 0xD5, 0xCB, 0x2C, 0xB5, 0x1E, 0x14, 0x2F, 0x73,
+    0x7E, 0x8A, 0x23, 0x73, 0x63, 0xFE, 0x2C, 0xFB, 0xAA, 0x49, 0xF1, 0x8E, 0x7D, 0xC3, 0x73, 0x62,
+    0x74, 0x81, 0xA0, 0x90, 0x9B, 0x55, 0xA0, 0x91, 0x6E, 0xE4, 0x8C, 0x67, 0x87, 0x87, 0x54, 0xCE,
+    0x64, 0xFE, 0xE5, 0x0A, 0x8E, 0xDC, 0xB5, 0xC9, 0xC4, 0x48, 0x8E, 0xE4, 0xE5, 0xE0, 0x8C, 0x49,
+    0x5A, 0xC1, 0x94, 0x11, 0x42, 0x61, 0x03, 0xED, 0x15, 0x7C, 0x91, 0x87, 0x33, 0x3E, 0x48, 0xA4,
+    0x81, 0xA2, 0x6A, 0xBA, 0x2D, 0xCC, 0xE7, 0xE9, 0x45, 0x15, 0xEC, 0x4E, 0x76, 0x38, 0x0F, 0x26,
+    0xB7, 0x99, 0x7A, 0xED, 0xE4, 0xE0, 0x40, 0xB6, 0x63, 0x71, 0xA0, 0x9C, 0xEF, 0xBC, 0xB2, 0x48,
+    0x39, 0x10, 0xD6, 0x35, 0xF1, 0xDD, 0x1F, 0x9F, 0x0E, 0x57, 0x48, 0x19, 0x0B, 0x3D, 0x36, 0xC0,
+    0x22, 0x45, 0x1E, 0x4D, 0x85, 0xB9, 0x94, 0x7E, 0x56, 0xBA, 0x51, 0xEC, 0xCE, 0x5C, 0xE7, 0x95,
+    0xFD, 0x31, 0x31, 0x32, 0xA6, 0x8F, 0x60, 0x5C, 0x9F, 0x4F, 0xB9, 0x67, 0x00, 0x09, 0xF3, 0x9C,
+    0xB0, 0x3C, 0x87, 0xE9, 0xFA, 0xFF, 0x3B, 0xC9, 0x6C, 0xC7, 0x73, 0x05, 0xBA, 0x19, 0xA7, 0x78,
+    0x92, 0x08, 0xAB, 0x29, 0x67, 0x3C, 0x17, 0xA4, 0x4C, 0x0A, 0xD8, 0x19, 0x78, 0x2B, 0x6C, 0x84,
+    0x15, 0x3B, 0xA1, 0x4F, 0x06, 0x19, 0xF8, 0x5C, 0x45, 0xE3, 0x69, 0xA3, 0x65, 0xF1, 0xBD, 0xC7,
+    0xE3, 0xAB, 0x13, 0x22, 0x50, 0xEB, 0xDD, 0x60, 0xE3, 0x77, 0xEF, 0x37, 0xA9, 0xD5, 0xDE, 0x23,
+    0x1B, 0xAD, 0xED, 0xD9, 0xDE, 0xAA, 0x3A, 0xB3, 0x07, 0xAA, 0x9C, 0x72, 0x45, 0x3C, 0xC2, 0xD6,
+    0xB0, 0x1F, 0x9C, 0x54, 0xE9, 0xC6, 0x85, 0xE7, 0xE7, 0x07, 0xD8, 0xE2, 0x92, 0xB8, 0x8C, 0x2F,
+    0xA0, 0x1F, 0xC5, 0x05, 0x89, 0xAB, 0x93, 0x5A, 0x0F, 0xFE, 0xB5, 0x93, 0x22, 0x87, 0x85, 0x2F,
+    0xF1, 0x7B, 0xE4, 0x0E, 0x0E, 0xDB, 0x48, 0xC2, 0x14, 0x1A, 0x67, 0x91, 0x7D, 0x88, 0x52, 0xBB,
+    0xFE, 0x33, 0x9B, 0x6A, 0xCA, 0xD8, 0x29, 0x75, 0x96, 0xD8, 0xD8, 0x9C, 0x3F, 0xC6, 0x40, 0xE5,
+    0x92, 0xAE, 0xE3, 0xA7, 0x12, 0xC1, 0x7D, 0x29, 0x0A, 0x07, 0x88, 0x53, 0xC4, 0x67, 0x55, 0x72,
+    0xC6, 0x10, 0xC9, 0xD8, 0x60, 0x43, 0x4E, 0xCF, 0xA9, 0x75, 0x5F, 0xC1, 0xBF, 0x72, 0xBC, 0x51,
+    0x3A, 0xA9, 0xE1, 0xEB, 0x47, 0xB9, 0x9A, 0x65, 0x2F, 0x95, 0x10, 0x22, 0xF9, 0x03, 0x0A, 0x7C,
+    0x7D, 0x4B, 0x31, 0x97, 0xCA, 0x73, 0x28, 0x22, 0xE1, 0xF6, 0x86, 0xAB, 0x68, 0xF5, 0xBE, 0x92,
+    0x7F, 0xBC, 0x48, 0x1C, 0xA5, 0xD7, 0xCF, 0xD9, 0x5D, 0x10, 0x7E, 0x8D, 0xF9, 0x23, 0x57, 0x33,
+    0x96, 0xEF, 0x3E, 0xFE, 0x5B, 0x3C, 0xFD, 0x07,
+};
+
+static const uint32_t opendyslexic_12_regularBlockOffsets[28] = {
+    0, 1244, 2382, 3616, 4927, 5612, 6302, 7214,
+    7905, 8803, 9625, 10462, 11377, 12101, 13004, 14160,
+    15288, 16492, 17723, 18961, 20101, 21172, 22192, 23362,
+    24444, 25662, 26773, 27832,
+};
+
+static const uint16_t opendyslexic_12_regularDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_12_regularGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_12_regularPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
@@ -3408,698 +1921,698 @@ static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 18, 15, 20, 1, 16, 68, 1733 }, // >
     { 14, 28, 14, 0, 28, 98, 1801 }, // ?
     { 22, 21, 30, 3, 20, 116, 1899 }, // @
-    { 20, 21, 28, 4, 21, 105, 2015 }, // A
-    { 16, 22, 24, 4, 22, 88, 2120 }, // B
-    { 18, 23, 25, 3, 22, 104, 2208 }, // C
-    { 20, 22, 27, 4, 22, 110, 2312 }, // D
-    { 15, 22, 23, 4, 22, 83, 2422 }, // E
-    { 13, 22, 21, 4, 22, 72, 2505 }, // F
-    { 20, 22, 29, 4, 22, 110, 2577 }, // G
-    { 19, 22, 27, 4, 22, 105, 2687 }, // H
-    { 5, 22, 11, 3, 22, 28, 2792 }, // I
-    { 11, 28, 19, 4, 22, 77, 2820 }, // J
-    { 17, 21, 26, 4, 21, 90, 2897 }, // K
-    { 14, 22, 23, 4, 22, 77, 2987 }, // L
-    { 23, 22, 31, 4, 22, 127, 3064 }, // M
-    { 19, 22, 27, 4, 22, 105, 3191 }, // N
-    { 20, 22, 29, 4, 21, 110, 3296 }, // O
-    { 15, 21, 23, 4, 21, 79, 3406 }, // P
-    { 21, 26, 25, 2, 22, 137, 3485 }, // Q
-    { 16, 22, 24, 4, 22, 88, 3622 }, // R
-    { 20, 23, 28, 4, 22, 115, 3710 }, // S
-    { 19, 21, 27, 4, 21, 100, 3825 }, // T
-    { 18, 23, 26, 4, 22, 104, 3925 }, // U
-    { 21, 22, 29, 4, 22, 116, 4029 }, // V
-    { 27, 21, 36, 4, 21, 142, 4145 }, // W
-    { 20, 22, 28, 4, 22, 110, 4287 }, // X
-    { 18, 21, 27, 4, 21, 95, 4397 }, // Y
-    { 20, 21, 28, 4, 21, 105, 4492 }, // Z
-    { 9, 35, 12, 1, 27, 79, 4597 }, // [
-    { 9, 24, 12, 1, 19, 54, 4676 }, // <backslash>
-    { 9, 35, 12, 1, 27, 79, 4730 }, // ]
-    { 11, 5, 14, 1, 23, 14, 4809 }, // ^
-    { 17, 4, 20, 1, -2, 17, 4823 }, // _
-    { 8, 4, 10, 1, 19, 8, 4840 }, // `
-    { 14, 15, 21, 3, 15, 53, 4848 }, // a
-    { 15, 23, 21, 3, 22, 87, 4901 }, // b
-    { 12, 16, 19, 3, 15, 48, 4988 }, // c
-    { 15, 22, 21, 3, 21, 83, 5036 }, // d
-    { 14, 15, 21, 3, 15, 53, 5119 }, // e
-    { 9, 20, 16, 3, 20, 45, 5172 }, // f
-    { 14, 21, 20, 3, 14, 74, 5217 }, // g
-    { 14, 21, 21, 3, 21, 74, 5291 }, // h
-    { 5, 22, 11, 3, 22, 28, 5365 }, // i
-    { 10, 27, 16, 3, 21, 68, 5393 }, // j
-    { 14, 20, 20, 3, 20, 70, 5461 }, // k
-    { 7, 21, 14, 3, 21, 37, 5531 }, // l
-    { 23, 14, 29, 3, 14, 81, 5568 }, // m
-    { 14, 14, 20, 3, 14, 49, 5649 }, // n
-    { 14, 14, 21, 3, 14, 49, 5698 }, // o
-    { 15, 21, 20, 2, 14, 79, 5747 }, // p
-    { 17, 21, 24, 3, 15, 90, 5826 }, // q
-    { 10, 14, 16, 3, 14, 35, 5916 }, // r
-    { 13, 14, 19, 3, 14, 46, 5951 }, // s
-    { 11, 19, 18, 3, 19, 53, 5997 }, // t
-    { 14, 15, 20, 3, 14, 53, 6050 }, // u
-    { 16, 14, 23, 3, 14, 56, 6103 }, // v
-    { 20, 14, 26, 3, 14, 70, 6159 }, // w
-    { 16, 14, 22, 3, 14, 56, 6229 }, // x
-    { 15, 21, 21, 3, 14, 79, 6285 }, // y
-    { 14, 14, 20, 3, 14, 49, 6364 }, // z
-    { 12, 24, 14, 1, 19, 72, 6413 }, // {
-    { 4, 22, 6, 1, 18, 22, 6485 }, // |
-    { 12, 24, 14, 1, 19, 72, 6507 }, // }
-    { 10, 5, 12, 1, 19, 13, 6579 }, // ~
-    { 0, 0, 21, 0, 0, 0, 6592 }, //  
-    { 6, 25, 8, 1, 19, 38, 6592 }, // ¡
-    { 12, 22, 19, 3, 19, 66, 6630 }, // ¢
-    { 16, 24, 17, 1, 24, 96, 6696 }, // £
-    { 14, 14, 17, 1, 16, 49, 6792 }, // ¤
-    { 17, 21, 19, 1, 18, 90, 6841 }, // ¥
-    { 4, 22, 6, 1, 18, 22, 6931 }, // ¦
-    { 15, 23, 21, 3, 20, 87, 6953 }, // §
-    { 12, 5, 13, 1, 20, 15, 7040 }, // ¨
-    { 11, 10, 13, 1, 23, 28, 7055 }, // ©
-    { 8, 9, 10, 2, 19, 18, 7083 }, // ª
-    { 13, 12, 16, 1, 12, 39, 7101 }, // «
-    { 13, 8, 15, 1, 9, 26, 7140 }, // ¬
-    { 13, 3, 14, 1, 9, 10, 7166 }, // ­
-    { 11, 10, 13, 1, 27, 28, 7176 }, // ®
-    { 10, 3, 13, 1, 18, 8, 7204 }, // ¯
-    { 12, 12, 13, 1, 20, 36, 7212 }, // °
-    { 13, 14, 16, 1, 13, 46, 7248 }, // ±
-    { 7, 9, 7, 0, 20, 16, 7294 }, // ²
-    { 7, 10, 8, 0, 20, 18, 7310 }, // ³
-    { 5, 5, 7, 1, 19, 7, 7328 }, // ´
-    { 15, 17, 20, 2, 14, 64, 7335 }, // µ
-    { 13, 21, 15, 1, 18, 69, 7399 }, // ¶
-    { 5, 5, 7, 1, 11, 7, 7468 }, // ·
-    { 6, 7, 8, 1, 1, 11, 7475 }, // ¸
-    { 7, 10, 7, 0, 21, 18, 7486 }, // ¹
-    { 8, 8, 11, 2, 18, 16, 7504 }, // º
-    { 13, 12, 16, 1, 12, 39, 7520 }, // »
-    { 21, 24, 28, 4, 22, 126, 7559 }, // ¼
-    { 22, 23, 28, 4, 21, 127, 7685 }, // ½
-    { 22, 24, 28, 3, 22, 132, 7812 }, // ¾
-    { 14, 28, 14, 0, 15, 98, 7944 }, // ¿
-    { 20, 28, 28, 4, 28, 140, 8042 }, // À
-    { 20, 33, 28, 4, 33, 165, 8182 }, // Á
-    { 20, 29, 28, 4, 29, 145, 8347 }, // Â
-    { 20, 29, 28, 4, 29, 145, 8492 }, // Ã
-    { 20, 29, 28, 4, 29, 145, 8637 }, // Ä
-    { 20, 30, 28, 4, 30, 150, 8782 }, // Å
-    { 28, 23, 36, 4, 22, 161, 8932 }, // Æ
-    { 18, 28, 25, 3, 22, 126, 9093 }, // Ç
-    { 15, 28, 23, 4, 28, 105, 9219 }, // È
-    { 15, 32, 23, 4, 32, 120, 9324 }, // É
-    { 15, 29, 23, 4, 29, 109, 9444 }, // Ê
-    { 15, 29, 23, 4, 29, 109, 9553 }, // Ë
-    { 8, 30, 11, 0, 30, 60, 9662 }, // Ì
-    { 5, 34, 11, 3, 34, 43, 9722 }, // Í
-    { 10, 31, 11, 0, 31, 78, 9765 }, // Î
-    { 12, 30, 11, -1, 30, 90, 9843 }, // Ï
-    { 23, 22, 27, 1, 22, 127, 9933 }, // Ð
-    { 19, 27, 27, 4, 27, 129, 10060 }, // Ñ
-    { 20, 28, 29, 4, 27, 140, 10189 }, // Ò
-    { 20, 32, 29, 4, 31, 160, 10329 }, // Ó
-    { 20, 29, 29, 4, 28, 145, 10489 }, // Ô
-    { 20, 28, 29, 4, 27, 140, 10634 }, // Õ
-    { 20, 29, 29, 4, 28, 145, 10774 }, // Ö
-    { 12, 7, 15, 1, 10, 21, 10919 }, // ×
-    { 31, 45, 30, -1, 33, 349, 10940 }, // Ø
-    { 18, 30, 26, 4, 29, 135, 11289 }, // Ù
-    { 18, 34, 26, 4, 33, 153, 11424 }, // Ú
-    { 18, 31, 26, 4, 30, 140, 11577 }, // Û
-    { 18, 30, 26, 4, 29, 135, 11717 }, // Ü
-    { 18, 33, 27, 4, 33, 149, 11852 }, // Ý
-    { 12, 20, 14, 1, 20, 60, 12001 }, // Þ
-    { 15, 20, 17, 1, 20, 75, 12061 }, // ß
-    { 14, 20, 21, 3, 20, 70, 12136 }, // à
-    { 14, 24, 21, 3, 24, 84, 12206 }, // á
-    { 14, 21, 21, 3, 21, 74, 12290 }, // â
-    { 14, 20, 21, 3, 20, 70, 12364 }, // ã
-    { 14, 20, 21, 3, 20, 70, 12434 }, // ä
-    { 14, 22, 21, 3, 22, 77, 12504 }, // å
-    { 24, 15, 31, 3, 15, 90, 12581 }, // æ
-    { 12, 21, 19, 3, 15, 63, 12671 }, // ç
-    { 14, 23, 21, 3, 23, 81, 12734 }, // è
-    { 14, 27, 21, 3, 27, 95, 12815 }, // é
-    { 14, 24, 21, 3, 24, 84, 12910 }, // ê
-    { 14, 24, 21, 3, 24, 84, 12994 }, // ë
-    { 9, 21, 11, 0, 21, 48, 13078 }, // ì
-    { 6, 25, 11, 3, 25, 38, 13126 }, // í
-    { 11, 22, 11, 0, 22, 61, 13164 }, // î
-    { 12, 22, 11, -1, 22, 66, 13225 }, // ï
-    { 19, 20, 21, 1, 20, 95, 13291 }, // ð
-    { 14, 21, 20, 3, 21, 74, 13386 }, // ñ
-    { 14, 23, 21, 3, 23, 81, 13460 }, // ò
-    { 14, 27, 21, 3, 27, 95, 13541 }, // ó
-    { 14, 23, 21, 3, 23, 81, 13636 }, // ô
-    { 14, 23, 21, 3, 23, 81, 13717 }, // õ
-    { 14, 23, 21, 3, 23, 81, 13798 }, // ö
-    { 17, 16, 19, 1, 16, 68, 13879 }, // ÷
-    { 14, 39, 21, 3, 26, 137, 13947 }, // ø
-    { 14, 22, 20, 3, 21, 77, 14084 }, // ù
-    { 14, 26, 20, 3, 25, 91, 14161 }, // ú
-    { 14, 23, 20, 3, 22, 81, 14252 }, // û
-    { 14, 22, 20, 3, 21, 77, 14333 }, // ü
-    { 15, 34, 21, 3, 27, 128, 14410 }, // ý
-    { 12, 26, 14, 1, 21, 78, 14538 }, // þ
-    { 15, 30, 21, 3, 23, 113, 14616 }, // ÿ
-    { 20, 28, 28, 4, 28, 140, 14729 }, // Ā
-    { 14, 19, 21, 3, 19, 67, 14869 }, // ā
-    { 20, 31, 28, 4, 31, 155, 14936 }, // Ă
-    { 14, 22, 21, 3, 22, 77, 15091 }, // ă
-    { 20, 27, 28, 4, 21, 135, 15168 }, // Ą
-    { 14, 20, 21, 3, 15, 70, 15303 }, // ą
-    { 18, 33, 25, 3, 32, 149, 15373 }, // Ć
-    { 12, 24, 19, 3, 23, 72, 15522 }, // ć
-    { 18, 31, 25, 3, 30, 140, 15594 }, // Ĉ
-    { 12, 22, 19, 3, 21, 66, 15734 }, // ĉ
-    { 18, 32, 25, 3, 31, 144, 15800 }, // Ċ
-    { 12, 23, 19, 3, 22, 69, 15944 }, // ċ
-    { 18, 33, 25, 3, 32, 149, 16013 }, // Č
-    { 12, 24, 19, 3, 23, 72, 16162 }, // č
-    { 20, 31, 27, 4, 31, 155, 16234 }, // Ď
-    { 20, 22, 21, 3, 21, 110, 16389 }, // ď
-    { 23, 22, 27, 1, 22, 127, 16499 }, // Đ
-    { 19, 22, 21, 3, 21, 105, 16626 }, // đ
-    { 15, 28, 23, 4, 28, 105, 16731 }, // Ē
-    { 14, 23, 21, 3, 23, 81, 16836 }, // ē
-    { 15, 30, 23, 4, 30, 113, 16917 }, // Ĕ
-    { 14, 26, 21, 3, 26, 91, 17030 }, // ĕ
-    { 15, 30, 23, 4, 30, 113, 17121 }, // Ė
-    { 14, 25, 21, 3, 25, 88, 17234 }, // ė
-    { 15, 27, 23, 4, 22, 102, 17322 }, // Ę
-    { 14, 21, 21, 3, 15, 74, 17424 }, // ę
-    { 15, 31, 23, 4, 31, 117, 17498 }, // Ě
-    { 14, 26, 21, 3, 26, 91, 17615 }, // ě
-    { 20, 29, 29, 4, 29, 145, 17706 }, // Ĝ
-    { 14, 28, 20, 3, 21, 98, 17851 }, // ĝ
-    { 20, 31, 29, 4, 31, 155, 17949 }, // Ğ
-    { 14, 30, 20, 3, 23, 105, 18104 }, // ğ
-    { 20, 30, 29, 4, 30, 150, 18209 }, // Ġ
-    { 14, 29, 20, 3, 22, 102, 18359 }, // ġ
-    { 20, 33, 29, 4, 22, 165, 18461 }, // Ģ
-    { 14, 30, 20, 3, 23, 105, 18626 }, // ģ
-    { 19, 29, 27, 4, 29, 138, 18731 }, // Ĥ
-    { 16, 27, 21, 1, 27, 108, 18869 }, // ĥ
-    { 20, 21, 27, 3, 21, 105, 18977 }, // Ħ
-    { 16, 21, 21, 1, 21, 84, 19082 }, // ħ
-    { 10, 31, 11, 0, 31, 78, 19166 }, // Ĩ
-    { 10, 22, 11, 1, 22, 55, 19244 }, // ĩ
-    { 12, 29, 11, -1, 29, 87, 19299 }, // Ī
-    { 12, 20, 11, 0, 20, 60, 19386 }, // ī
-    { 6, 28, 15, 6, 22, 42, 19446 }, // Į
-    { 6, 28, 11, 2, 22, 42, 19488 }, // į
-    { 5, 31, 11, 3, 31, 39, 19530 }, // İ
-    { 5, 14, 11, 3, 14, 18, 19569 }, // ı
-    { 16, 28, 23, 3, 22, 112, 19587 }, // Ĳ
-    { 19, 29, 11, 3, 22, 138, 19699 }, // ĳ
-    { 12, 33, 19, 4, 27, 99, 19837 }, // Ĵ
-    { 13, 27, 16, 3, 21, 88, 19936 }, // ĵ
-    { 17, 30, 26, 4, 21, 128, 20024 }, // Ķ
-    { 14, 31, 20, 3, 20, 109, 20152 }, // ķ
-    { 12, 14, 16, 2, 14, 42, 20261 }, // ĸ
-    { 14, 30, 23, 4, 30, 105, 20303 }, // Ĺ
-    { 7, 29, 14, 3, 29, 51, 20408 }, // ĺ
-    { 14, 33, 23, 4, 22, 116, 20459 }, // Ļ
-    { 7, 32, 14, 3, 21, 56, 20575 }, // ļ
-    { 14, 22, 23, 4, 22, 77, 20631 }, // Ľ
-    { 10, 22, 14, 3, 22, 55, 20708 }, // ľ
-    { 14, 22, 23, 4, 22, 77, 20763 }, // Ŀ
-    { 11, 21, 14, 3, 21, 58, 20840 }, // ŀ
-    { 24, 34, 23, -6, 27, 204, 20898 }, // Ł
-    { 16, 21, 14, -5, 21, 84, 21102 }, // ł
-    { 19, 30, 27, 4, 30, 143, 21186 }, // Ń
-    { 14, 24, 20, 3, 24, 84, 21329 }, // ń
-    { 19, 31, 27, 4, 22, 148, 21413 }, // Ņ
-    { 14, 23, 20, 3, 14, 81, 21561 }, // ņ
-    { 19, 30, 27, 4, 30, 143, 21642 }, // Ň
-    { 14, 24, 20, 3, 24, 84, 21785 }, // ň
-    { 14, 26, 17, 1, 26, 91, 21869 }, // ŉ
-    { 19, 26, 27, 4, 22, 124, 21960 }, // Ŋ
-    { 14, 19, 20, 3, 14, 67, 22084 }, // ŋ
-    { 20, 28, 29, 4, 27, 140, 22151 }, // Ō
-    { 14, 21, 21, 3, 21, 74, 22291 }, // ō
-    { 20, 30, 29, 4, 29, 150, 22365 }, // Ŏ
-    { 14, 25, 21, 3, 25, 88, 22515 }, // ŏ
-    { 21, 29, 29, 4, 28, 153, 22603 }, // Ő
-    { 19, 24, 21, 2, 24, 114, 22756 }, // ő
-    { 29, 21, 30, 4, 21, 153, 22870 }, // Œ
-    { 25, 15, 27, 3, 15, 94, 23023 }, // œ
-    { 16, 29, 24, 4, 29, 116, 23117 }, // Ŕ
-    { 10, 21, 16, 3, 21, 53, 23233 }, // ŕ
-    { 16, 34, 24, 4, 22, 136, 23286 }, // Ŗ
-    { 11, 27, 16, 2, 14, 75, 23422 }, // ŗ
-    { 16, 30, 24, 4, 30, 120, 23497 }, // Ř
-    { 11, 21, 16, 2, 21, 58, 23617 }, // ř
-    { 20, 33, 28, 4, 32, 165, 23675 }, // Ś
-    { 13, 23, 19, 3, 23, 75, 23840 }, // ś
-    { 20, 31, 28, 4, 30, 155, 23915 }, // Ŝ
-    { 13, 21, 19, 3, 21, 69, 24070 }, // ŝ
-    { 20, 28, 28, 4, 22, 140, 24139 }, // Ş
-    { 13, 21, 19, 3, 14, 69, 24279 }, // ş
-    { 20, 33, 28, 4, 32, 165, 24348 }, // Š
-    { 13, 23, 19, 3, 23, 75, 24513 }, // š
-    { 19, 26, 27, 4, 21, 124, 24588 }, // Ţ
-    { 12, 24, 18, 3, 19, 72, 24712 }, // ţ
-    { 19, 29, 27, 4, 29, 138, 24784 }, // Ť
-    { 12, 21, 18, 3, 21, 63, 24922 }, // ť
-    { 19, 21, 27, 4, 21, 100, 24985 }, // Ŧ
-    { 12, 19, 18, 2, 19, 57, 25085 }, // ŧ
-    { 18, 31, 26, 4, 30, 140, 25142 }, // Ũ
-    { 14, 23, 20, 3, 22, 81, 25282 }, // ũ
-    { 18, 29, 26, 4, 28, 131, 25363 }, // Ū
-    { 14, 21, 20, 3, 20, 74, 25494 }, // ū
-    { 18, 32, 26, 4, 31, 144, 25568 }, // Ŭ
-    { 14, 24, 20, 3, 23, 84, 25712 }, // ŭ
-    { 18, 32, 26, 4, 31, 144, 25796 }, // Ů
-    { 14, 24, 20, 3, 23, 84, 25940 }, // ů
-    { 20, 31, 26, 4, 30, 155, 26024 }, // Ű
-    { 19, 23, 20, 1, 22, 110, 26179 }, // ű
-    { 18, 27, 26, 4, 22, 122, 26289 }, // Ų
-    { 14, 20, 20, 3, 14, 70, 26411 }, // ų
-    { 27, 28, 36, 4, 28, 189, 26481 }, // Ŵ
-    { 20, 22, 26, 3, 22, 110, 26670 }, // ŵ
-    { 18, 30, 27, 4, 30, 135, 26780 }, // Ŷ
-    { 15, 31, 21, 3, 24, 117, 26915 }, // ŷ
-    { 18, 30, 27, 4, 30, 135, 27032 }, // Ÿ
-    { 20, 30, 28, 4, 30, 150, 27167 }, // Ź
-    { 14, 23, 20, 3, 23, 81, 27317 }, // ź
-    { 20, 29, 28, 4, 29, 145, 27398 }, // Ż
-    { 14, 22, 20, 3, 22, 77, 27543 }, // ż
-    { 20, 30, 28, 4, 30, 150, 27620 }, // Ž
-    { 14, 23, 20, 3, 23, 81, 27770 }, // ž
-    { 9, 20, 13, 3, 20, 45, 27851 }, // ſ
-    { 8, 4, 0, 1, 19, 8, 27896 }, // ̀
-    { 5, 5, 0, 1, 19, 7, 27904 }, // ́
-    { 11, 5, 0, 1, 0, 14, 27911 }, // ̂
-    { 10, 5, 0, 1, 19, 13, 27925 }, // ̃
-    { 12, 4, 0, 2, 17, 12, 27938 }, // ̄
-    { 17, 3, 0, 1, 22, 13, 27950 }, // ̅
-    { 11, 5, 0, 1, 18, 14, 27963 }, // ̆
-    { 5, 5, 0, 1, 20, 7, 27977 }, // ̇
-    { 12, 5, 0, 1, 20, 15, 27984 }, // ̈
-    { 6, 5, 0, 0, 16, 8, 27999 }, // ̉
-    { 6, 5, 0, 1, 19, 8, 28007 }, // ̊
-    { 19, 4, 0, 1, 19, 19, 28015 }, // ̋
-    { 11, 5, 0, 1, 19, 14, 28034 }, // ̌
-    { 19, 4, 0, -5, 20, 19, 28048 }, // ̏
-    { 6, 8, 0, 1, 19, 12, 28067 }, // ̒
-    { 6, 7, 0, 1, 18, 11, 28079 }, // ̓
-    { 6, 7, 0, 1, 18, 11, 28090 }, // ̔
-    { 5, 6, 0, 1, -1, 8, 28101 }, // ̘
-    { 5, 6, 0, 1, -1, 8, 28109 }, // ̙
-    { 11, 6, 0, 1, 20, 17, 28117 }, // ̚
-    { 4, 6, 0, 1, 16, 6, 28134 }, // ̛
-    { 4, 5, 0, 1, -2, 5, 28140 }, // ̜
-    { 7, 4, 0, 1, 3, 7, 28145 }, // ̝
-    { 7, 4, 0, 1, -1, 7, 28152 }, // ̞
-    { 6, 5, 0, 1, -2, 8, 28159 }, // ̟
-    { 13, 4, 0, 1, -3, 13, 28167 }, // ̠
-    { 5, 5, 0, 1, 1, 7, 28180 }, // ̣
-    { 12, 5, 0, 1, 0, 15, 28187 }, // ̤
-    { 6, 5, 0, 1, 19, 8, 28202 }, // ̥
-    { 6, 8, 0, 1, 4, 12, 28210 }, // ̦
-    { 6, 7, 0, 1, 1, 11, 28222 }, // ̧
-    { 6, 7, 0, 1, 1, 11, 28233 }, // ̨
-    { 4, 7, 0, 1, -1, 7, 28244 }, // ̩
-    { 9, 4, 0, 1, -1, 9, 28251 }, // ̪
-    { 11, 5, 0, 1, 0, 14, 28260 }, // ̬
-    { 11, 5, 0, 1, -1, 14, 28274 }, // ̭
-    { 10, 5, 0, 1, 19, 13, 28288 }, // ̰
-    { 10, 3, 0, 1, 18, 8, 28301 }, // ̱
-    { 11, 3, 0, 1, -2, 9, 28309 }, // ̲
-    { 10, 5, 0, 1, 19, 13, 28318 }, // ̴
-    { 13, 3, 0, 1, 9, 10, 28331 }, // ̵
-    { 4, 5, 0, 1, -2, 5, 28341 }, // ̹
-    { 9, 4, 0, 1, -1, 9, 28346 }, // ̺
-    { 8, 7, 0, 1, 0, 14, 28355 }, // ̻
-    { 9, 5, 0, 1, 0, 12, 28369 }, // ̼
-    { 6, 5, 0, 2, 19, 8, 28381 }, // ̽
-    { 10, 5, 0, 1, 19, 13, 28389 }, // ͂
-    { 4, 5, 0, 1, 21, 5, 28402 }, // ̓
-    { 12, 11, 0, 1, 26, 33, 28407 }, // ̈́
-    { 9, 5, 0, 1, 20, 12, 28440 }, // ͆
-    { 13, 9, 0, 1, 0, 30, 28452 }, // ͇
-    { 10, 7, 0, 1, 0, 18, 28482 }, // ͈
-    { 8, 7, 0, 1, -1, 14, 28500 }, // ͉
-    { 10, 15, 0, 1, 24, 38, 28514 }, // ͊
-    { 20, 11, 0, 1, 22, 55, 28552 }, // ͋
-    { 15, 13, 0, 2, 14, 49, 28607 }, // ͌
-    { 13, 5, 0, 2, -3, 17, 28656 }, // ͍
-    { 4, 4, 0, 1, 3, 4, 28673 }, // ͎
-    { 21, 5, 0, 1, 0, 27, 28677 }, // ͜
-    { 21, 5, 0, 1, 19, 27, 28704 }, // ͡
-    { 25, 6, 0, 1, -2, 38, 28731 }, // ͢
-    { 13, 25, 16, 1, 25, 82, 28769 }, // Ѐ
-    { 13, 24, 16, 1, 24, 78, 28851 }, // Ё
-    { 20, 21, 26, 3, 21, 105, 28929 }, // Ђ
-    { 14, 29, 16, 1, 29, 102, 29034 }, // Ѓ
-    { 18, 20, 23, 3, 19, 90, 29136 }, // Є
-    { 20, 23, 28, 4, 22, 115, 29226 }, // Ѕ
-    { 5, 22, 11, 3, 22, 28, 29341 }, // І
-    { 12, 31, 11, -1, 31, 93, 29369 }, // Ї
-    { 11, 28, 19, 4, 22, 77, 29462 }, // Ј
-    { 25, 19, 29, 2, 18, 119, 29539 }, // Љ
-    { 24, 19, 28, 2, 19, 114, 29658 }, // Њ
-    { 21, 22, 27, 4, 22, 116, 29772 }, // Ћ
-    { 17, 29, 26, 4, 29, 124, 29888 }, // Ќ
-    { 19, 28, 27, 4, 28, 133, 30012 }, // Ѝ
-    { 15, 30, 17, 1, 28, 113, 30145 }, // Ў
-    { 15, 23, 18, 1, 18, 87, 30258 }, // Џ
-    { 20, 21, 28, 4, 21, 105, 30345 }, // А
-    { 14, 18, 16, 1, 18, 63, 30450 }, // Б
-    { 15, 18, 17, 1, 18, 68, 30513 }, // В
-    { 14, 19, 16, 1, 19, 67, 30581 }, // Г
-    { 18, 22, 21, 1, 19, 99, 30648 }, // Д
-    { 13, 19, 16, 1, 19, 62, 30747 }, // Е
-    { 27, 21, 36, 4, 21, 142, 30809 }, // Ж
-    { 13, 19, 16, 1, 19, 62, 30951 }, // З
-    { 19, 22, 27, 4, 22, 105, 31013 }, // И
-    { 19, 30, 27, 4, 30, 143, 31118 }, // Й
-    { 17, 21, 26, 4, 21, 90, 31261 }, // К
-    { 15, 20, 19, 2, 19, 75, 31351 }, // Л
-    { 19, 19, 21, 1, 19, 91, 31426 }, // М
-    { 19, 22, 27, 4, 22, 105, 31517 }, // Н
-    { 20, 22, 29, 4, 21, 110, 31622 }, // О
-    { 14, 19, 17, 1, 19, 67, 31732 }, // П
-    { 15, 21, 23, 4, 21, 79, 31799 }, // Р
-    { 18, 23, 25, 3, 22, 104, 31878 }, // С
-    { 19, 21, 27, 4, 21, 100, 31982 }, // Т
-    { 15, 22, 17, 1, 20, 83, 32082 }, // У
-    { 19, 19, 22, 1, 19, 91, 32165 }, // Ф
-    { 20, 22, 28, 4, 22, 110, 32256 }, // Х
-    { 15, 23, 18, 1, 19, 87, 32366 }, // Ц
-    { 14, 19, 17, 1, 19, 67, 32453 }, // Ч
-    { 18, 19, 20, 1, 19, 86, 32520 }, // Ш
-    { 20, 23, 23, 1, 19, 115, 32606 }, // Щ
-    { 17, 19, 17, -2, 19, 81, 32721 }, // Ъ
-    { 23, 19, 28, 2, 19, 110, 32802 }, // Ы
-    { 13, 19, 17, 2, 19, 62, 32912 }, // Ь
-    { 18, 20, 23, 2, 19, 90, 32974 }, // Э
-    { 21, 18, 25, 2, 18, 95, 33064 }, // Ю
-    { 16, 22, 24, 4, 22, 88, 33159 }, // Я
-    { 14, 15, 21, 3, 15, 53, 33247 }, // а
-    { 15, 20, 18, 1, 20, 75, 33300 }, // б
-    { 12, 15, 18, 3, 15, 45, 33375 }, // в
-    { 12, 14, 15, 1, 14, 42, 33420 }, // г
-    { 17, 17, 19, 1, 14, 73, 33462 }, // д
-    { 14, 15, 21, 3, 15, 53, 33535 }, // е
-    { 23, 18, 30, 3, 18, 104, 33588 }, // ж
-    { 9, 14, 11, 1, 14, 32, 33692 }, // з
-    { 14, 15, 17, 1, 15, 53, 33724 }, // и
-    { 14, 19, 17, 1, 19, 67, 33777 }, // й
-    { 14, 15, 20, 3, 15, 53, 33844 }, // к
-    { 10, 14, 13, 1, 13, 35, 33897 }, // л
-    { 17, 16, 23, 3, 16, 68, 33932 }, // м
-    { 15, 16, 23, 4, 16, 60, 34000 }, // н
-    { 14, 14, 17, 1, 14, 49, 34060 }, // о
-    { 14, 14, 17, 1, 14, 49, 34109 }, // п
-    { 15, 21, 20, 2, 14, 79, 34158 }, // р
-    { 12, 16, 19, 3, 15, 48, 34237 }, // с
-    { 15, 14, 17, 1, 14, 53, 34285 }, // т
-    { 15, 21, 21, 3, 14, 79, 34338 }, // у
-    { 19, 20, 22, 1, 14, 95, 34417 }, // ф
-    { 15, 14, 18, 1, 14, 53, 34512 }, // х
-    { 15, 18, 18, 1, 14, 68, 34565 }, // ц
-    { 9, 13, 11, 1, 13, 30, 34633 }, // ч
-    { 18, 14, 20, 1, 14, 63, 34663 }, // ш
-    { 20, 19, 22, 1, 14, 95, 34726 }, // щ
-    { 16, 14, 19, 1, 14, 56, 34821 }, // ъ
-    { 18, 14, 20, 1, 14, 63, 34877 }, // ы
-    { 13, 14, 15, 1, 14, 46, 34940 }, // ь
-    { 14, 14, 16, 1, 14, 49, 34986 }, // э
-    { 16, 15, 20, 2, 15, 60, 35035 }, // ю
-    { 13, 14, 16, 1, 14, 46, 35095 }, // я
-    { 14, 24, 21, 3, 24, 84, 35141 }, // ѐ
-    { 14, 20, 17, 1, 19, 70, 35225 }, // ё
-    { 17, 25, 21, 1, 21, 107, 35295 }, // ђ
-    { 12, 21, 15, 1, 21, 63, 35402 }, // ѓ
-    { 12, 14, 16, 2, 13, 42, 35465 }, // є
-    { 13, 14, 19, 3, 14, 46, 35507 }, // ѕ
-    { 5, 22, 11, 3, 22, 28, 35553 }, // і
-    { 12, 22, 11, -1, 22, 66, 35581 }, // ї
-    { 10, 27, 16, 3, 21, 68, 35647 }, // ј
-    { 17, 14, 20, 2, 13, 60, 35715 }, // љ
-    { 16, 14, 19, 2, 14, 56, 35775 }, // њ
-    { 16, 21, 21, 1, 21, 84, 35831 }, // ћ
-    { 14, 22, 20, 3, 22, 77, 35915 }, // ќ
-    { 14, 21, 17, 1, 21, 74, 35992 }, // ѝ
-    { 15, 32, 21, 3, 25, 120, 36066 }, // ў
-    { 11, 17, 13, 1, 13, 47, 36186 }, // џ
-    { 15, 19, 21, 3, 18, 72, 36233 }, // Ѣ
-    { 16, 19, 18, 1, 18, 76, 36305 }, // ѣ
-    { 21, 18, 25, 2, 18, 95, 36381 }, // Ѫ
-    { 14, 13, 18, 2, 13, 46, 36476 }, // ѫ
-    { 18, 23, 27, 4, 22, 104, 36522 }, // Ѳ
-    { 14, 17, 21, 3, 17, 60, 36626 }, // ѳ
-    { 26, 28, 29, 4, 28, 182, 36686 }, // Ѵ
-    { 16, 17, 20, 3, 17, 68, 36868 }, // ѵ
-    { 9, 8, 0, 1, 23, 18, 36936 }, // ҆
-    { 14, 21, 16, 1, 21, 74, 36954 }, // Ґ
-    { 12, 17, 15, 1, 17, 51, 37028 }, // ґ
-    { 15, 19, 16, 0, 19, 72, 37079 }, // Ғ
-    { 10, 13, 11, 0, 13, 33, 37151 }, // ғ
-    { 15, 20, 17, 1, 20, 75, 37184 }, // Ҕ
-    { 9, 13, 11, 1, 13, 30, 37259 }, // ҕ
-    { 28, 25, 32, 2, 21, 175, 37289 }, // Җ
-    { 18, 18, 22, 2, 15, 81, 37464 }, // җ
-    { 13, 22, 18, 2, 19, 72, 37545 }, // Ҙ
-    { 9, 20, 11, 1, 14, 45, 37617 }, // ҙ
-    { 18, 24, 22, 2, 21, 108, 37662 }, // Қ
-    { 12, 18, 15, 2, 15, 54, 37770 }, // қ
-    { 20, 19, 24, 2, 19, 95, 37824 }, // Ҝ
-    { 14, 13, 18, 2, 13, 46, 37919 }, // ҝ
-    { 17, 21, 26, 4, 21, 90, 37965 }, // Ҟ
-    { 17, 21, 20, 0, 21, 90, 38055 }, // ҟ
-    { 23, 21, 26, -2, 21, 121, 38145 }, // Ҡ
-    { 17, 15, 17, -2, 15, 64, 38266 }, // ҡ
-    { 19, 25, 23, 2, 22, 119, 38330 }, // Ң
-    { 13, 17, 16, 2, 15, 56, 38449 }, // ң
-    { 26, 22, 27, 4, 22, 143, 38505 }, // Ҥ
-    { 18, 15, 18, 3, 15, 68, 38648 }, // ҥ
-    { 25, 21, 29, 2, 21, 132, 38716 }, // Ҧ
-    { 23, 23, 27, 2, 16, 133, 38848 }, // ҧ
-    { 25, 22, 30, 2, 21, 138, 38981 }, // Ҩ
-    { 19, 17, 23, 2, 16, 81, 39119 }, // ҩ
-    { 18, 27, 25, 3, 22, 122, 39200 }, // Ҫ
-    { 12, 19, 19, 3, 15, 57, 39322 }, // ҫ
-    { 19, 24, 23, 2, 21, 114, 39379 }, // Ҭ
-    { 13, 17, 16, 2, 15, 56, 39493 }, // ҭ
-    { 18, 21, 27, 4, 21, 95, 39549 }, // Ү
-    { 14, 18, 17, 1, 13, 63, 39644 }, // ү
-    { 18, 21, 27, 4, 21, 95, 39707 }, // Ұ
-    { 14, 19, 17, 1, 13, 67, 39802 }, // ұ
-    { 21, 26, 25, 2, 22, 137, 39869 }, // Ҳ
-    { 14, 18, 17, 2, 15, 63, 40006 }, // ҳ
-    { 22, 23, 27, 2, 18, 127, 40069 }, // Ҵ
-    { 15, 17, 19, 2, 13, 64, 40196 }, // ҵ
-    { 17, 24, 21, 1, 18, 102, 40260 }, // Ҷ
-    { 12, 17, 15, 1, 13, 51, 40362 }, // ҷ
-    { 14, 19, 18, 2, 19, 67, 40413 }, // Ҹ
-    { 10, 13, 12, 1, 13, 33, 40480 }, // ҹ
-    { 14, 21, 19, 2, 21, 74, 40513 }, // Һ
-    { 14, 21, 21, 3, 21, 74, 40587 }, // һ
-    { 22, 20, 24, 0, 19, 110, 40661 }, // Ҽ
-    { 16, 14, 17, 0, 14, 56, 40771 }, // ҽ
-    { 23, 23, 27, 2, 19, 133, 40827 }, // Ҿ
-    { 16, 17, 20, 2, 14, 68, 40960 }, // ҿ
-    { 5, 22, 11, 3, 22, 28, 41028 }, // Ӏ
-    { 27, 30, 36, 4, 30, 203, 41056 }, // Ӂ
-    { 23, 27, 30, 3, 27, 156, 41259 }, // ӂ
-    { 15, 25, 20, 2, 19, 94, 41415 }, // Ӄ
-    { 10, 17, 13, 2, 13, 43, 41509 }, // ӄ
-    { 18, 24, 19, 2, 19, 108, 41552 }, // Ӆ
-    { 13, 16, 13, 1, 13, 52, 41660 }, // ӆ
-    { 20, 28, 27, 4, 22, 140, 41712 }, // Ӈ
-    { 14, 20, 18, 3, 15, 70, 41852 }, // ӈ
-    { 20, 29, 27, 4, 22, 145, 41922 }, // Ӊ
-    { 13, 20, 19, 3, 15, 65, 42067 }, // ӊ
-    { 14, 23, 17, 0, 18, 81, 42132 }, // Ӌ
-    { 10, 16, 13, 1, 13, 40, 42213 }, // ӌ
-    { 25, 29, 31, 4, 22, 182, 42253 }, // Ӎ
-    { 17, 20, 21, 3, 15, 85, 42435 }, // ӎ
-    { 5, 18, 7, 1, 18, 23, 42520 }, // ӏ
-    { 20, 30, 28, 4, 30, 150, 42543 }, // Ӑ
-    { 14, 23, 21, 3, 23, 81, 42693 }, // ӑ
-    { 20, 29, 28, 4, 29, 145, 42774 }, // Ӓ
-    { 14, 21, 21, 3, 21, 74, 42919 }, // ӓ
-    { 28, 23, 36, 4, 22, 161, 42993 }, // Ӕ
-    { 24, 15, 31, 3, 15, 90, 43154 }, // ӕ
-    { 13, 26, 16, 1, 26, 85, 43244 }, // Ӗ
-    { 14, 25, 21, 3, 25, 88, 43329 }, // ӗ
-    { 14, 15, 21, 3, 14, 53, 43417 }, // Ә
-    { 14, 16, 21, 4, 15, 56, 43470 }, // ә
-    { 14, 26, 21, 3, 25, 91, 43526 }, // Ӛ
-    { 14, 17, 21, 4, 15, 60, 43617 }, // ӛ
-    { 27, 29, 33, 4, 29, 196, 43677 }, // Ӝ
-    { 23, 26, 30, 3, 26, 150, 43873 }, // ӝ
-    { 13, 26, 16, 1, 26, 85, 44023 }, // Ӟ
-    { 12, 21, 11, 1, 21, 63, 44108 }, // ӟ
-    { 12, 19, 15, 2, 18, 57, 44171 }, // Ӡ
-    { 12, 19, 15, 2, 13, 57, 44228 }, // ӡ
-    { 19, 27, 27, 4, 27, 129, 44285 }, // Ӣ
-    { 14, 20, 17, 1, 20, 70, 44414 }, // ӣ
-    { 19, 28, 27, 4, 28, 133, 44484 }, // Ӥ
-    { 14, 21, 17, 1, 21, 74, 44617 }, // ӥ
-    { 20, 29, 29, 4, 28, 145, 44691 }, // Ӧ
-    { 14, 22, 17, 1, 22, 77, 44836 }, // ӧ
-    { 18, 19, 27, 4, 18, 86, 44913 }, // Ө
-    { 14, 14, 21, 3, 14, 49, 44999 }, // ө
-    { 18, 30, 27, 4, 29, 135, 45048 }, // Ӫ
-    { 14, 23, 21, 3, 23, 81, 45183 }, // ӫ
-    { 18, 28, 23, 2, 27, 126, 45264 }, // Ӭ
-    { 14, 21, 16, 1, 21, 74, 45390 }, // ӭ
-    { 15, 28, 17, 1, 26, 105, 45464 }, // Ӯ
-    { 15, 29, 21, 3, 22, 109, 45569 }, // ӯ
-    { 15, 29, 17, 1, 27, 109, 45678 }, // Ӱ
-    { 15, 31, 21, 3, 24, 117, 45787 }, // ӱ
-    { 19, 29, 17, 0, 27, 138, 45904 }, // Ӳ
-    { 19, 31, 21, 2, 24, 148, 46042 }, // ӳ
-    { 14, 26, 17, 1, 26, 91, 46190 }, // Ӵ
-    { 12, 21, 11, -1, 21, 63, 46281 }, // ӵ
-    { 14, 23, 16, 1, 19, 81, 46344 }, // Ӷ
-    { 9, 16, 11, 1, 13, 36, 46425 }, // ӷ
-    { 23, 28, 28, 2, 28, 161, 46461 }, // Ӹ
-    { 18, 23, 20, 1, 23, 104, 46622 }, // ӹ
-    { 24, 25, 28, 4, 22, 150, 46726 }, // Ӽ
-    { 17, 17, 20, 3, 15, 73, 46876 }, // ӽ
-    { 0, 0, 21, 0, 0, 0, 46949 }, //  
-    { 0, 0, 33, 0, 0, 0, 46949 }, //  
-    { 0, 0, 21, 0, 0, 0, 46949 }, //  
-    { 0, 0, 33, 0, 0, 0, 46949 }, //  
-    { 0, 0, 16, 0, 0, 0, 46949 }, //  
-    { 0, 0, 14, 0, 0, 0, 46949 }, //  
-    { 0, 0, 12, 0, 0, 0, 46949 }, //  
-    { 0, 0, 17, 0, 0, 0, 46949 }, //  
-    { 0, 0, 7, 0, 0, 0, 46949 }, //  
-    { 0, 0, 13, 0, 0, 0, 46949 }, //  
-    { 0, 0, 12, 0, 0, 0, 46949 }, //  
-    { 0, 0, 8, 0, 0, 0, 46949 }, // ​
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 46949 }, // ‏
-    { 13, 3, 14, 1, 9, 10, 46949 }, // ‐
-    { 13, 3, 14, 1, 9, 10, 46959 }, // ‑
-    { 18, 3, 19, 1, 9, 14, 46969 }, // ‒
-    { 17, 4, 20, 1, 9, 17, 46983 }, // –
-    { 26, 4, 28, 1, 9, 26, 47000 }, // —
-    { 26, 4, 28, 1, 9, 26, 47026 }, // ―
-    { 11, 22, 14, 1, 18, 61, 47052 }, // ‖
-    { 19, 8, 20, 1, -2, 38, 47113 }, // ‗
-    { 6, 7, 8, 1, 21, 11, 47151 }, // ‘
-    { 6, 7, 8, 1, 21, 11, 47162 }, // ’
-    { 6, 8, 8, 1, 4, 12, 47173 }, // ‚
-    { 6, 7, 8, 1, 21, 11, 47185 }, // ‛
-    { 12, 7, 14, 1, 21, 21, 47196 }, // “
-    { 12, 7, 14, 1, 21, 21, 47217 }, // ”
-    { 6, 8, 8, 1, 4, 12, 47238 }, // „
-    { 13, 8, 14, 1, 21, 26, 47250 }, // ‟
-    { 14, 33, 15, 0, 26, 116, 47276 }, // †
-    { 13, 33, 15, 1, 26, 108, 47392 }, // ‡
-    { 15, 15, 13, -1, 18, 57, 47500 }, // •
-    { 7, 8, 10, 1, 11, 14, 47557 }, // ‣
-    { 5, 5, 7, 1, 5, 7, 47571 }, // ․
-    { 5, 5, 7, 1, 5, 7, 47578 }, // ‥
-    { 22, 5, 24, 1, 5, 28, 47585 }, // …
-    { 4, 3, 6, 1, 9, 3, 47613 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 47616 }, //  
-    { 16, 22, 28, 6, 20, 88, 47616 }, // ‰
-    { 6, 7, 8, 1, 21, 11, 47704 }, // ′
-    { 12, 7, 14, 1, 21, 21, 47715 }, // ″
-    { 19, 8, 21, 1, 21, 38, 47736 }, // ‴
-    { 6, 7, 8, 1, 21, 11, 47774 }, // ‵
-    { 12, 7, 13, 0, 21, 21, 47785 }, // ‶
-    { 19, 8, 21, 1, 21, 38, 47806 }, // ‷
-    { 11, 5, 14, 1, 20, 14, 47844 }, // ‸
-    { 8, 12, 10, 1, 13, 24, 47858 }, // ‹
-    { 8, 12, 10, 1, 13, 24, 47882 }, // ›
-    { 26, 26, 33, 5, 23, 169, 47906 }, // ※
-    { 6, 25, 8, 1, 25, 38, 48075 }, // ‼
-    { 14, 31, 19, 2, 30, 109, 48113 }, // ‽
-    { 13, 3, 14, 1, 21, 10, 48222 }, // ‾
-    { 11, 5, 14, 1, 17, 14, 48232 }, // ‿
-    { 17, 16, 20, 1, 22, 68, 48246 }, // ⁂
-    { 15, 20, 28, 6, 19, 75, 48314 }, // ⁄
-    { 28, 28, 32, 2, 28, 196, 48389 }, // ⁇
-    { 19, 28, 25, 2, 28, 133, 48585 }, // ⁈
-    { 19, 30, 20, 1, 28, 143, 48718 }, // ⁉
-    { 15, 39, 19, 2, 27, 147, 48861 }, // ⁒
-    { 0, 0, 121, 0, 0, 0, 49008 }, //  
-    { 7, 10, 8, 0, 21, 18, 49008 }, // ⁰
-    { 8, 10, 8, 0, 21, 20, 49026 }, // ⁴
-    { 6, 10, 8, 1, 21, 15, 49046 }, // ⁵
-    { 8, 9, 8, 0, 20, 18, 49061 }, // ⁶
-    { 7, 10, 8, 1, 21, 18, 49079 }, // ⁷
-    { 8, 10, 8, 0, 21, 20, 49097 }, // ⁸
-    { 8, 9, 8, 0, 20, 18, 49117 }, // ⁹
-    { 14, 14, 20, 3, 14, 49, 49135 }, // ⁿ
-    { 9, 13, 11, 1, 13, 30, 49184 }, // ₀
-    { 6, 10, 8, 1, 6, 15, 49214 }, // ₁
-    { 7, 10, 8, 1, 6, 18, 49229 }, // ₂
-    { 8, 9, 8, 0, 5, 18, 49247 }, // ₃
-    { 8, 10, 8, 0, 6, 20, 49265 }, // ₄
-    { 7, 10, 8, 0, 6, 18, 49285 }, // ₅
-    { 8, 9, 8, 0, 5, 18, 49303 }, // ₆
-    { 7, 11, 8, 1, 6, 20, 49321 }, // ₇
-    { 8, 10, 8, 0, 6, 20, 49341 }, // ₈
-    { 8, 9, 8, 0, 5, 18, 49361 }, // ₉
-    { 8, 34, 11, 2, 25, 68, 49379 }, // ₍
-    { 8, 34, 11, 1, 25, 68, 49447 }, // ₎
-    { 17, 31, 25, 4, 26, 132, 49515 }, // ₡
-    { 18, 23, 25, 3, 22, 104, 49647 }, // ₢
-    { 16, 24, 17, 1, 24, 96, 49751 }, // ₤
-    { 24, 22, 27, 2, 22, 132, 49847 }, // ₦
-    { 20, 21, 23, 1, 21, 105, 49979 }, // ₧
-    { 25, 21, 28, 3, 21, 132, 50084 }, // ₨
-    { 19, 21, 21, 1, 21, 100, 50216 }, // ₩
-    { 20, 19, 27, 3, 19, 95, 50316 }, // ₪
-    { 17, 20, 17, 1, 20, 85, 50411 }, // ₫
-    { 15, 23, 19, 2, 20, 87, 50496 }, // €
-    { 19, 21, 27, 4, 21, 100, 50583 }, // ₮
-    { 22, 21, 16, 0, 21, 116, 50683 }, // ₱
-    { 20, 30, 29, 4, 26, 150, 50799 }, // ₲
-    { 23, 23, 23, 1, 22, 133, 50949 }, // ₴
-    { 12, 18, 19, 3, 17, 54, 51082 }, // ₵
-    { 19, 22, 27, 4, 22, 105, 51136 }, // ₸
-    { 13, 20, 15, 1, 19, 65, 51241 }, // ₹
-    { 15, 18, 17, 1, 17, 68, 51306 }, // ₺
-    { 16, 19, 16, 0, 19, 76, 51374 }, // ₼
-    { 20, 21, 23, -1, 21, 105, 51450 }, // ₽
-    { 16, 16, 19, 1, 14, 64, 51555 }, // ←
-    { 17, 15, 19, 1, 15, 64, 51619 }, // ↑
-    { 16, 16, 19, 1, 14, 64, 51683 }, // →
-    { 17, 15, 19, 1, 15, 64, 51747 }, // ↓
-    { 20, 14, 22, 1, 14, 70, 51811 }, // ↔
-    { 14, 19, 16, 1, 20, 67, 51881 }, // ↕
-    { 13, 12, 16, 1, 13, 39, 51948 }, // ↖
-    { 13, 12, 16, 1, 13, 39, 51987 }, // ↗
-    { 13, 13, 16, 1, 14, 43, 52026 }, // ↘
-    { 13, 13, 16, 1, 14, 43, 52069 }, // ↙
-    { 19, 16, 21, 1, 15, 76, 52112 }, // ⇐
-    { 20, 18, 23, 1, 18, 90, 52188 }, // ⇑
-    { 19, 16, 21, 1, 15, 76, 52278 }, // ⇒
-    { 20, 19, 23, 1, 18, 95, 52354 }, // ⇓
-    { 22, 16, 24, 1, 15, 88, 52449 }, // ⇔
-    { 17, 21, 19, 1, 14, 90, 52537 }, // ⇕
-    { 15, 20, 17, 1, 20, 75, 52627 }, // ∂
-    { 25, 23, 29, 2, 22, 144, 52702 }, // ∅
-    { 19, 19, 22, 1, 19, 91, 52846 }, // ∆
-    { 16, 18, 18, 1, 18, 72, 52937 }, // ∏
-    { 16, 18, 18, 1, 18, 72, 53009 }, // ∐
-    { 12, 19, 15, 1, 18, 57, 53081 }, // ∑
-    { 13, 4, 15, 1, 9, 13, 53138 }, // −
-    { 21, 21, 23, 1, 20, 111, 53151 }, // √
-    { 20, 12, 23, 1, 15, 60, 53262 }, // ∞
-    { 21, 28, 21, 0, 22, 147, 53322 }, // ∫
-    { 5, 15, 7, 1, 15, 19, 53469 }, // ∶
-    { 15, 13, 19, 2, 14, 49, 53488 }, // ≈
-    { 16, 22, 28, 6, 20, 88, 53537 }, // ≠
-    { 19, 19, 22, 1, 18, 91, 53625 }, // ≤
-    { 19, 19, 22, 1, 18, 91, 53716 }, // ≥
+    { 20, 21, 28, 4, 21, 105, 2048 }, // A
+    { 16, 22, 24, 4, 22, 88, 2153 }, // B
+    { 18, 23, 25, 3, 22, 104, 2241 }, // C
+    { 20, 22, 27, 4, 22, 110, 2345 }, // D
+    { 15, 22, 23, 4, 22, 83, 2455 }, // E
+    { 13, 22, 21, 4, 22, 72, 2538 }, // F
+    { 20, 22, 29, 4, 22, 110, 2610 }, // G
+    { 19, 22, 27, 4, 22, 105, 2720 }, // H
+    { 5, 22, 11, 3, 22, 28, 2825 }, // I
+    { 11, 28, 19, 4, 22, 77, 2853 }, // J
+    { 17, 21, 26, 4, 21, 90, 2930 }, // K
+    { 14, 22, 23, 4, 22, 77, 3020 }, // L
+    { 23, 22, 31, 4, 22, 127, 3097 }, // M
+    { 19, 22, 27, 4, 22, 105, 3224 }, // N
+    { 20, 22, 29, 4, 21, 110, 3329 }, // O
+    { 15, 21, 23, 4, 21, 79, 3439 }, // P
+    { 21, 26, 25, 2, 22, 137, 3518 }, // Q
+    { 16, 22, 24, 4, 22, 88, 3655 }, // R
+    { 20, 23, 28, 4, 22, 115, 3743 }, // S
+    { 19, 21, 27, 4, 21, 100, 3858 }, // T
+    { 18, 23, 26, 4, 22, 104, 3958 }, // U
+    { 21, 22, 29, 4, 22, 116, 4096 }, // V
+    { 27, 21, 36, 4, 21, 142, 4212 }, // W
+    { 20, 22, 28, 4, 22, 110, 4354 }, // X
+    { 18, 21, 27, 4, 21, 95, 4464 }, // Y
+    { 20, 21, 28, 4, 21, 105, 4559 }, // Z
+    { 9, 35, 12, 1, 27, 79, 4664 }, // [
+    { 9, 24, 12, 1, 19, 54, 4743 }, // <backslash>
+    { 9, 35, 12, 1, 27, 79, 4797 }, // ]
+    { 11, 5, 14, 1, 23, 14, 4876 }, // ^
+    { 17, 4, 20, 1, -2, 17, 4890 }, // _
+    { 8, 4, 10, 1, 19, 8, 4907 }, // `
+    { 14, 15, 21, 3, 15, 53, 4915 }, // a
+    { 15, 23, 21, 3, 22, 87, 4968 }, // b
+    { 12, 16, 19, 3, 15, 48, 5055 }, // c
+    { 15, 22, 21, 3, 21, 83, 5103 }, // d
+    { 14, 15, 21, 3, 15, 53, 5186 }, // e
+    { 9, 20, 16, 3, 20, 45, 5239 }, // f
+    { 14, 21, 20, 3, 14, 74, 5284 }, // g
+    { 14, 21, 21, 3, 21, 74, 5358 }, // h
+    { 5, 22, 11, 3, 22, 28, 5432 }, // i
+    { 10, 27, 16, 3, 21, 68, 5460 }, // j
+    { 14, 20, 20, 3, 20, 70, 5528 }, // k
+    { 7, 21, 14, 3, 21, 37, 5598 }, // l
+    { 23, 14, 29, 3, 14, 81, 5635 }, // m
+    { 14, 14, 20, 3, 14, 49, 5716 }, // n
+    { 14, 14, 21, 3, 14, 49, 5765 }, // o
+    { 15, 21, 20, 2, 14, 79, 5814 }, // p
+    { 17, 21, 24, 3, 15, 90, 5893 }, // q
+    { 10, 14, 16, 3, 14, 35, 5983 }, // r
+    { 13, 14, 19, 3, 14, 46, 6018 }, // s
+    { 11, 19, 18, 3, 19, 53, 6064 }, // t
+    { 14, 15, 20, 3, 14, 53, 6144 }, // u
+    { 16, 14, 23, 3, 14, 56, 6197 }, // v
+    { 20, 14, 26, 3, 14, 70, 6253 }, // w
+    { 16, 14, 22, 3, 14, 56, 6323 }, // x
+    { 15, 21, 21, 3, 14, 79, 6379 }, // y
+    { 14, 14, 20, 3, 14, 49, 6458 }, // z
+    { 12, 24, 14, 1, 19, 72, 6507 }, // {
+    { 4, 22, 6, 1, 18, 22, 6579 }, // |
+    { 12, 24, 14, 1, 19, 72, 6601 }, // }
+    { 10, 5, 12, 1, 19, 13, 6673 }, // ~
+    { 0, 0, 21, 0, 0, 0, 6686 }, //  
+    { 6, 25, 8, 1, 19, 38, 6686 }, // ¡
+    { 12, 22, 19, 3, 19, 66, 6724 }, // ¢
+    { 16, 24, 17, 1, 24, 96, 6790 }, // £
+    { 14, 14, 17, 1, 16, 49, 6886 }, // ¤
+    { 17, 21, 19, 1, 18, 90, 6935 }, // ¥
+    { 4, 22, 6, 1, 18, 22, 7025 }, // ¦
+    { 15, 23, 21, 3, 20, 87, 7047 }, // §
+    { 12, 5, 13, 1, 20, 15, 7134 }, // ¨
+    { 11, 10, 13, 1, 23, 28, 7149 }, // ©
+    { 8, 9, 10, 2, 19, 18, 7177 }, // ª
+    { 13, 12, 16, 1, 12, 39, 7195 }, // «
+    { 13, 8, 15, 1, 9, 26, 7234 }, // ¬
+    { 13, 3, 14, 1, 9, 10, 7260 }, // ­
+    { 11, 10, 13, 1, 27, 28, 7270 }, // ®
+    { 10, 3, 13, 1, 18, 8, 7298 }, // ¯
+    { 12, 12, 13, 1, 20, 36, 7306 }, // °
+    { 13, 14, 16, 1, 13, 46, 7342 }, // ±
+    { 7, 9, 7, 0, 20, 16, 7388 }, // ²
+    { 7, 10, 8, 0, 20, 18, 7404 }, // ³
+    { 5, 5, 7, 1, 19, 7, 7422 }, // ´
+    { 15, 17, 20, 2, 14, 64, 7429 }, // µ
+    { 13, 21, 15, 1, 18, 69, 7493 }, // ¶
+    { 5, 5, 7, 1, 11, 7, 7562 }, // ·
+    { 6, 7, 8, 1, 1, 11, 7569 }, // ¸
+    { 7, 10, 7, 0, 21, 18, 7580 }, // ¹
+    { 8, 8, 11, 2, 18, 16, 7598 }, // º
+    { 13, 12, 16, 1, 12, 39, 7614 }, // »
+    { 21, 24, 28, 4, 22, 126, 7653 }, // ¼
+    { 22, 23, 28, 4, 21, 127, 7779 }, // ½
+    { 22, 24, 28, 3, 22, 132, 7906 }, // ¾
+    { 14, 28, 14, 0, 15, 98, 8038 }, // ¿
+    { 20, 28, 28, 4, 28, 140, 8192 }, // À
+    { 20, 33, 28, 4, 33, 165, 8332 }, // Á
+    { 20, 29, 28, 4, 29, 145, 8497 }, // Â
+    { 20, 29, 28, 4, 29, 145, 8642 }, // Ã
+    { 20, 29, 28, 4, 29, 145, 8787 }, // Ä
+    { 20, 30, 28, 4, 30, 150, 8932 }, // Å
+    { 28, 23, 36, 4, 22, 161, 9082 }, // Æ
+    { 18, 28, 25, 3, 22, 126, 9243 }, // Ç
+    { 15, 28, 23, 4, 28, 105, 9369 }, // È
+    { 15, 32, 23, 4, 32, 120, 9474 }, // É
+    { 15, 29, 23, 4, 29, 109, 9594 }, // Ê
+    { 15, 29, 23, 4, 29, 109, 9703 }, // Ë
+    { 8, 30, 11, 0, 30, 60, 9812 }, // Ì
+    { 5, 34, 11, 3, 34, 43, 9872 }, // Í
+    { 10, 31, 11, 0, 31, 78, 9915 }, // Î
+    { 12, 30, 11, -1, 30, 90, 9993 }, // Ï
+    { 23, 22, 27, 1, 22, 127, 10083 }, // Ð
+    { 19, 27, 27, 4, 27, 129, 10240 }, // Ñ
+    { 20, 28, 29, 4, 27, 140, 10369 }, // Ò
+    { 20, 32, 29, 4, 31, 160, 10509 }, // Ó
+    { 20, 29, 29, 4, 28, 145, 10669 }, // Ô
+    { 20, 28, 29, 4, 27, 140, 10814 }, // Õ
+    { 20, 29, 29, 4, 28, 145, 10954 }, // Ö
+    { 12, 7, 15, 1, 10, 21, 11099 }, // ×
+    { 31, 45, 30, -1, 33, 349, 11120 }, // Ø
+    { 18, 30, 26, 4, 29, 135, 11469 }, // Ù
+    { 18, 34, 26, 4, 33, 153, 11604 }, // Ú
+    { 18, 31, 26, 4, 30, 140, 11757 }, // Û
+    { 18, 30, 26, 4, 29, 135, 11897 }, // Ü
+    { 18, 33, 27, 4, 33, 149, 12032 }, // Ý
+    { 12, 20, 14, 1, 20, 60, 12181 }, // Þ
+    { 15, 20, 17, 1, 20, 75, 12288 }, // ß
+    { 14, 20, 21, 3, 20, 70, 12363 }, // à
+    { 14, 24, 21, 3, 24, 84, 12433 }, // á
+    { 14, 21, 21, 3, 21, 74, 12517 }, // â
+    { 14, 20, 21, 3, 20, 70, 12591 }, // ã
+    { 14, 20, 21, 3, 20, 70, 12661 }, // ä
+    { 14, 22, 21, 3, 22, 77, 12731 }, // å
+    { 24, 15, 31, 3, 15, 90, 12808 }, // æ
+    { 12, 21, 19, 3, 15, 63, 12898 }, // ç
+    { 14, 23, 21, 3, 23, 81, 12961 }, // è
+    { 14, 27, 21, 3, 27, 95, 13042 }, // é
+    { 14, 24, 21, 3, 24, 84, 13137 }, // ê
+    { 14, 24, 21, 3, 24, 84, 13221 }, // ë
+    { 9, 21, 11, 0, 21, 48, 13305 }, // ì
+    { 6, 25, 11, 3, 25, 38, 13353 }, // í
+    { 11, 22, 11, 0, 22, 61, 13391 }, // î
+    { 12, 22, 11, -1, 22, 66, 13452 }, // ï
+    { 19, 20, 21, 1, 20, 95, 13518 }, // ð
+    { 14, 21, 20, 3, 21, 74, 13613 }, // ñ
+    { 14, 23, 21, 3, 23, 81, 13687 }, // ò
+    { 14, 27, 21, 3, 27, 95, 13768 }, // ó
+    { 14, 23, 21, 3, 23, 81, 13863 }, // ô
+    { 14, 23, 21, 3, 23, 81, 13944 }, // õ
+    { 14, 23, 21, 3, 23, 81, 14025 }, // ö
+    { 17, 16, 19, 1, 16, 68, 14106 }, // ÷
+    { 14, 39, 21, 3, 26, 137, 14174 }, // ø
+    { 14, 22, 20, 3, 21, 77, 14336 }, // ù
+    { 14, 26, 20, 3, 25, 91, 14413 }, // ú
+    { 14, 23, 20, 3, 22, 81, 14504 }, // û
+    { 14, 22, 20, 3, 21, 77, 14585 }, // ü
+    { 15, 34, 21, 3, 27, 128, 14662 }, // ý
+    { 12, 26, 14, 1, 21, 78, 14790 }, // þ
+    { 15, 30, 21, 3, 23, 113, 14868 }, // ÿ
+    { 20, 28, 28, 4, 28, 140, 14981 }, // Ā
+    { 14, 19, 21, 3, 19, 67, 15121 }, // ā
+    { 20, 31, 28, 4, 31, 155, 15188 }, // Ă
+    { 14, 22, 21, 3, 22, 77, 15343 }, // ă
+    { 20, 27, 28, 4, 21, 135, 15420 }, // Ą
+    { 14, 20, 21, 3, 15, 70, 15555 }, // ą
+    { 18, 33, 25, 3, 32, 149, 15625 }, // Ć
+    { 12, 24, 19, 3, 23, 72, 15774 }, // ć
+    { 18, 31, 25, 3, 30, 140, 15846 }, // Ĉ
+    { 12, 22, 19, 3, 21, 66, 15986 }, // ĉ
+    { 18, 32, 25, 3, 31, 144, 16052 }, // Ċ
+    { 12, 23, 19, 3, 22, 69, 16196 }, // ċ
+    { 18, 33, 25, 3, 32, 149, 16384 }, // Č
+    { 12, 24, 19, 3, 23, 72, 16533 }, // č
+    { 20, 31, 27, 4, 31, 155, 16605 }, // Ď
+    { 20, 22, 21, 3, 21, 110, 16760 }, // ď
+    { 23, 22, 27, 1, 22, 127, 16870 }, // Đ
+    { 19, 22, 21, 3, 21, 105, 16997 }, // đ
+    { 15, 28, 23, 4, 28, 105, 17102 }, // Ē
+    { 14, 23, 21, 3, 23, 81, 17207 }, // ē
+    { 15, 30, 23, 4, 30, 113, 17288 }, // Ĕ
+    { 14, 26, 21, 3, 26, 91, 17401 }, // ĕ
+    { 15, 30, 23, 4, 30, 113, 17492 }, // Ė
+    { 14, 25, 21, 3, 25, 88, 17605 }, // ė
+    { 15, 27, 23, 4, 22, 102, 17693 }, // Ę
+    { 14, 21, 21, 3, 15, 74, 17795 }, // ę
+    { 15, 31, 23, 4, 31, 117, 17869 }, // Ě
+    { 14, 26, 21, 3, 26, 91, 17986 }, // ě
+    { 20, 29, 29, 4, 29, 145, 18077 }, // Ĝ
+    { 14, 28, 20, 3, 21, 98, 18222 }, // ĝ
+    { 20, 31, 29, 4, 31, 155, 18432 }, // Ğ
+    { 14, 30, 20, 3, 23, 105, 18587 }, // ğ
+    { 20, 30, 29, 4, 30, 150, 18692 }, // Ġ
+    { 14, 29, 20, 3, 22, 102, 18842 }, // ġ
+    { 20, 33, 29, 4, 22, 165, 18944 }, // Ģ
+    { 14, 30, 20, 3, 23, 105, 19109 }, // ģ
+    { 19, 29, 27, 4, 29, 138, 19214 }, // Ĥ
+    { 16, 27, 21, 1, 27, 108, 19352 }, // ĥ
+    { 20, 21, 27, 3, 21, 105, 19460 }, // Ħ
+    { 16, 21, 21, 1, 21, 84, 19565 }, // ħ
+    { 10, 31, 11, 0, 31, 78, 19649 }, // Ĩ
+    { 10, 22, 11, 1, 22, 55, 19727 }, // ĩ
+    { 12, 29, 11, -1, 29, 87, 19782 }, // Ī
+    { 12, 20, 11, 0, 20, 60, 19869 }, // ī
+    { 6, 28, 15, 6, 22, 42, 19929 }, // Į
+    { 6, 28, 11, 2, 22, 42, 19971 }, // į
+    { 5, 31, 11, 3, 31, 39, 20013 }, // İ
+    { 5, 14, 11, 3, 14, 18, 20052 }, // ı
+    { 16, 28, 23, 3, 22, 112, 20070 }, // Ĳ
+    { 19, 29, 11, 3, 22, 138, 20182 }, // ĳ
+    { 12, 33, 19, 4, 27, 99, 20320 }, // Ĵ
+    { 13, 27, 16, 3, 21, 88, 20480 }, // ĵ
+    { 17, 30, 26, 4, 21, 128, 20568 }, // Ķ
+    { 14, 31, 20, 3, 20, 109, 20696 }, // ķ
+    { 12, 14, 16, 2, 14, 42, 20805 }, // ĸ
+    { 14, 30, 23, 4, 30, 105, 20847 }, // Ĺ
+    { 7, 29, 14, 3, 29, 51, 20952 }, // ĺ
+    { 14, 33, 23, 4, 22, 116, 21003 }, // Ļ
+    { 7, 32, 14, 3, 21, 56, 21119 }, // ļ
+    { 14, 22, 23, 4, 22, 77, 21175 }, // Ľ
+    { 10, 22, 14, 3, 22, 55, 21252 }, // ľ
+    { 14, 22, 23, 4, 22, 77, 21307 }, // Ŀ
+    { 11, 21, 14, 3, 21, 58, 21384 }, // ŀ
+    { 24, 34, 23, -6, 27, 204, 21442 }, // Ł
+    { 16, 21, 14, -5, 21, 84, 21646 }, // ł
+    { 19, 30, 27, 4, 30, 143, 21730 }, // Ń
+    { 14, 24, 20, 3, 24, 84, 21873 }, // ń
+    { 19, 31, 27, 4, 22, 148, 21957 }, // Ņ
+    { 14, 23, 20, 3, 14, 81, 22105 }, // ņ
+    { 19, 30, 27, 4, 30, 143, 22186 }, // Ň
+    { 14, 24, 20, 3, 24, 84, 22329 }, // ň
+    { 14, 26, 17, 1, 26, 91, 22413 }, // ŉ
+    { 19, 26, 27, 4, 22, 124, 22528 }, // Ŋ
+    { 14, 19, 20, 3, 14, 67, 22652 }, // ŋ
+    { 20, 28, 29, 4, 27, 140, 22719 }, // Ō
+    { 14, 21, 21, 3, 21, 74, 22859 }, // ō
+    { 20, 30, 29, 4, 29, 150, 22933 }, // Ŏ
+    { 14, 25, 21, 3, 25, 88, 23083 }, // ŏ
+    { 21, 29, 29, 4, 28, 153, 23171 }, // Ő
+    { 19, 24, 21, 2, 24, 114, 23324 }, // ő
+    { 29, 21, 30, 4, 21, 153, 23438 }, // Œ
+    { 25, 15, 27, 3, 15, 94, 23591 }, // œ
+    { 16, 29, 24, 4, 29, 116, 23685 }, // Ŕ
+    { 10, 21, 16, 3, 21, 53, 23801 }, // ŕ
+    { 16, 34, 24, 4, 22, 136, 23854 }, // Ŗ
+    { 11, 27, 16, 2, 14, 75, 23990 }, // ŗ
+    { 16, 30, 24, 4, 30, 120, 24065 }, // Ř
+    { 11, 21, 16, 2, 21, 58, 24185 }, // ř
+    { 20, 33, 28, 4, 32, 165, 24243 }, // Ś
+    { 13, 23, 19, 3, 23, 75, 24408 }, // ś
+    { 20, 31, 28, 4, 30, 155, 24576 }, // Ŝ
+    { 13, 21, 19, 3, 21, 69, 24731 }, // ŝ
+    { 20, 28, 28, 4, 22, 140, 24800 }, // Ş
+    { 13, 21, 19, 3, 14, 69, 24940 }, // ş
+    { 20, 33, 28, 4, 32, 165, 25009 }, // Š
+    { 13, 23, 19, 3, 23, 75, 25174 }, // š
+    { 19, 26, 27, 4, 21, 124, 25249 }, // Ţ
+    { 12, 24, 18, 3, 19, 72, 25373 }, // ţ
+    { 19, 29, 27, 4, 29, 138, 25445 }, // Ť
+    { 12, 21, 18, 3, 21, 63, 25583 }, // ť
+    { 19, 21, 27, 4, 21, 100, 25646 }, // Ŧ
+    { 12, 19, 18, 2, 19, 57, 25746 }, // ŧ
+    { 18, 31, 26, 4, 30, 140, 25803 }, // Ũ
+    { 14, 23, 20, 3, 22, 81, 25943 }, // ũ
+    { 18, 29, 26, 4, 28, 131, 26024 }, // Ū
+    { 14, 21, 20, 3, 20, 74, 26155 }, // ū
+    { 18, 32, 26, 4, 31, 144, 26229 }, // Ŭ
+    { 14, 24, 20, 3, 23, 84, 26373 }, // ŭ
+    { 18, 32, 26, 4, 31, 144, 26457 }, // Ů
+    { 14, 24, 20, 3, 23, 84, 26624 }, // ů
+    { 20, 31, 26, 4, 30, 155, 26708 }, // Ű
+    { 19, 23, 20, 1, 22, 110, 26863 }, // ű
+    { 18, 27, 26, 4, 22, 122, 26973 }, // Ų
+    { 14, 20, 20, 3, 14, 70, 27095 }, // ų
+    { 27, 28, 36, 4, 28, 189, 27165 }, // Ŵ
+    { 20, 22, 26, 3, 22, 110, 27354 }, // ŵ
+    { 18, 30, 27, 4, 30, 135, 27464 }, // Ŷ
+    { 15, 31, 21, 3, 24, 117, 27599 }, // ŷ
+    { 18, 30, 27, 4, 30, 135, 27716 }, // Ÿ
+    { 20, 30, 28, 4, 30, 150, 27851 }, // Ź
+    { 14, 23, 20, 3, 23, 81, 28001 }, // ź
+    { 20, 29, 28, 4, 29, 145, 28082 }, // Ż
+    { 14, 22, 20, 3, 22, 77, 28227 }, // ż
+    { 20, 30, 28, 4, 30, 150, 28304 }, // Ž
+    { 14, 23, 20, 3, 23, 81, 28454 }, // ž
+    { 9, 20, 13, 3, 20, 45, 28535 }, // ſ
+    { 8, 4, 0, 1, 19, 8, 28580 }, // ̀
+    { 5, 5, 0, 1, 19, 7, 28588 }, // ́
+    { 11, 5, 0, 1, 0, 14, 28595 }, // ̂
+    { 10, 5, 0, 1, 19, 13, 28609 }, // ̃
+    { 12, 4, 0, 2, 17, 12, 28622 }, // ̄
+    { 17, 3, 0, 1, 22, 13, 28634 }, // ̅
+    { 11, 5, 0, 1, 18, 14, 28647 }, // ̆
+    { 5, 5, 0, 1, 20, 7, 28661 }, // ̇
+    { 12, 5, 0, 1, 20, 15, 28672 }, // ̈
+    { 6, 5, 0, 0, 16, 8, 28687 }, // ̉
+    { 6, 5, 0, 1, 19, 8, 28695 }, // ̊
+    { 19, 4, 0, 1, 19, 19, 28703 }, // ̋
+    { 11, 5, 0, 1, 19, 14, 28722 }, // ̌
+    { 19, 4, 0, -5, 20, 19, 28736 }, // ̏
+    { 6, 8, 0, 1, 19, 12, 28755 }, // ̒
+    { 6, 7, 0, 1, 18, 11, 28767 }, // ̓
+    { 6, 7, 0, 1, 18, 11, 28778 }, // ̔
+    { 5, 6, 0, 1, -1, 8, 28789 }, // ̘
+    { 5, 6, 0, 1, -1, 8, 28797 }, // ̙
+    { 11, 6, 0, 1, 20, 17, 28805 }, // ̚
+    { 4, 6, 0, 1, 16, 6, 28822 }, // ̛
+    { 4, 5, 0, 1, -2, 5, 28828 }, // ̜
+    { 7, 4, 0, 1, 3, 7, 28833 }, // ̝
+    { 7, 4, 0, 1, -1, 7, 28840 }, // ̞
+    { 6, 5, 0, 1, -2, 8, 28847 }, // ̟
+    { 13, 4, 0, 1, -3, 13, 28855 }, // ̠
+    { 5, 5, 0, 1, 1, 7, 28868 }, // ̣
+    { 12, 5, 0, 1, 0, 15, 28875 }, // ̤
+    { 6, 5, 0, 1, 19, 8, 28890 }, // ̥
+    { 6, 8, 0, 1, 4, 12, 28898 }, // ̦
+    { 6, 7, 0, 1, 1, 11, 28910 }, // ̧
+    { 6, 7, 0, 1, 1, 11, 28921 }, // ̨
+    { 4, 7, 0, 1, -1, 7, 28932 }, // ̩
+    { 9, 4, 0, 1, -1, 9, 28939 }, // ̪
+    { 11, 5, 0, 1, 0, 14, 28948 }, // ̬
+    { 11, 5, 0, 1, -1, 14, 28962 }, // ̭
+    { 10, 5, 0, 1, 19, 13, 28976 }, // ̰
+    { 10, 3, 0, 1, 18, 8, 28989 }, // ̱
+    { 11, 3, 0, 1, -2, 9, 28997 }, // ̲
+    { 10, 5, 0, 1, 19, 13, 29006 }, // ̴
+    { 13, 3, 0, 1, 9, 10, 29019 }, // ̵
+    { 4, 5, 0, 1, -2, 5, 29029 }, // ̹
+    { 9, 4, 0, 1, -1, 9, 29034 }, // ̺
+    { 8, 7, 0, 1, 0, 14, 29043 }, // ̻
+    { 9, 5, 0, 1, 0, 12, 29057 }, // ̼
+    { 6, 5, 0, 2, 19, 8, 29069 }, // ̽
+    { 10, 5, 0, 1, 19, 13, 29077 }, // ͂
+    { 4, 5, 0, 1, 21, 5, 29090 }, // ̓
+    { 12, 11, 0, 1, 26, 33, 29095 }, // ̈́
+    { 9, 5, 0, 1, 20, 12, 29128 }, // ͆
+    { 13, 9, 0, 1, 0, 30, 29140 }, // ͇
+    { 10, 7, 0, 1, 0, 18, 29170 }, // ͈
+    { 8, 7, 0, 1, -1, 14, 29188 }, // ͉
+    { 10, 15, 0, 1, 24, 38, 29202 }, // ͊
+    { 20, 11, 0, 1, 22, 55, 29240 }, // ͋
+    { 15, 13, 0, 2, 14, 49, 29295 }, // ͌
+    { 13, 5, 0, 2, -3, 17, 29344 }, // ͍
+    { 4, 4, 0, 1, 3, 4, 29361 }, // ͎
+    { 21, 5, 0, 1, 0, 27, 29365 }, // ͜
+    { 21, 5, 0, 1, 19, 27, 29392 }, // ͡
+    { 25, 6, 0, 1, -2, 38, 29419 }, // ͢
+    { 13, 25, 16, 1, 25, 82, 29457 }, // Ѐ
+    { 13, 24, 16, 1, 24, 78, 29539 }, // Ё
+    { 20, 21, 26, 3, 21, 105, 29617 }, // Ђ
+    { 14, 29, 16, 1, 29, 102, 29722 }, // Ѓ
+    { 18, 20, 23, 3, 19, 90, 29824 }, // Є
+    { 20, 23, 28, 4, 22, 115, 29914 }, // Ѕ
+    { 5, 22, 11, 3, 22, 28, 30029 }, // І
+    { 12, 31, 11, -1, 31, 93, 30057 }, // Ї
+    { 11, 28, 19, 4, 22, 77, 30150 }, // Ј
+    { 25, 19, 29, 2, 18, 119, 30227 }, // Љ
+    { 24, 19, 28, 2, 19, 114, 30346 }, // Њ
+    { 21, 22, 27, 4, 22, 116, 30460 }, // Ћ
+    { 17, 29, 26, 4, 29, 124, 30576 }, // Ќ
+    { 19, 28, 27, 4, 28, 133, 30720 }, // Ѝ
+    { 15, 30, 17, 1, 28, 113, 30853 }, // Ў
+    { 15, 23, 18, 1, 18, 87, 30966 }, // Џ
+    { 20, 21, 28, 4, 21, 105, 31053 }, // А
+    { 14, 18, 16, 1, 18, 63, 31158 }, // Б
+    { 15, 18, 17, 1, 18, 68, 31221 }, // В
+    { 14, 19, 16, 1, 19, 67, 31289 }, // Г
+    { 18, 22, 21, 1, 19, 99, 31356 }, // Д
+    { 13, 19, 16, 1, 19, 62, 31455 }, // Е
+    { 27, 21, 36, 4, 21, 142, 31517 }, // Ж
+    { 13, 19, 16, 1, 19, 62, 31659 }, // З
+    { 19, 22, 27, 4, 22, 105, 31721 }, // И
+    { 19, 30, 27, 4, 30, 143, 31826 }, // Й
+    { 17, 21, 26, 4, 21, 90, 31969 }, // К
+    { 15, 20, 19, 2, 19, 75, 32059 }, // Л
+    { 19, 19, 21, 1, 19, 91, 32134 }, // М
+    { 19, 22, 27, 4, 22, 105, 32225 }, // Н
+    { 20, 22, 29, 4, 21, 110, 32330 }, // О
+    { 14, 19, 17, 1, 19, 67, 32440 }, // П
+    { 15, 21, 23, 4, 21, 79, 32507 }, // Р
+    { 18, 23, 25, 3, 22, 104, 32586 }, // С
+    { 19, 21, 27, 4, 21, 100, 32768 }, // Т
+    { 15, 22, 17, 1, 20, 83, 32868 }, // У
+    { 19, 19, 22, 1, 19, 91, 32951 }, // Ф
+    { 20, 22, 28, 4, 22, 110, 33042 }, // Х
+    { 15, 23, 18, 1, 19, 87, 33152 }, // Ц
+    { 14, 19, 17, 1, 19, 67, 33239 }, // Ч
+    { 18, 19, 20, 1, 19, 86, 33306 }, // Ш
+    { 20, 23, 23, 1, 19, 115, 33392 }, // Щ
+    { 17, 19, 17, -2, 19, 81, 33507 }, // Ъ
+    { 23, 19, 28, 2, 19, 110, 33588 }, // Ы
+    { 13, 19, 17, 2, 19, 62, 33698 }, // Ь
+    { 18, 20, 23, 2, 19, 90, 33760 }, // Э
+    { 21, 18, 25, 2, 18, 95, 33850 }, // Ю
+    { 16, 22, 24, 4, 22, 88, 33945 }, // Я
+    { 14, 15, 21, 3, 15, 53, 34033 }, // а
+    { 15, 20, 18, 1, 20, 75, 34086 }, // б
+    { 12, 15, 18, 3, 15, 45, 34161 }, // в
+    { 12, 14, 15, 1, 14, 42, 34206 }, // г
+    { 17, 17, 19, 1, 14, 73, 34248 }, // д
+    { 14, 15, 21, 3, 15, 53, 34321 }, // е
+    { 23, 18, 30, 3, 18, 104, 34374 }, // ж
+    { 9, 14, 11, 1, 14, 32, 34478 }, // з
+    { 14, 15, 17, 1, 15, 53, 34510 }, // и
+    { 14, 19, 17, 1, 19, 67, 34563 }, // й
+    { 14, 15, 20, 3, 15, 53, 34630 }, // к
+    { 10, 14, 13, 1, 13, 35, 34683 }, // л
+    { 17, 16, 23, 3, 16, 68, 34718 }, // м
+    { 15, 16, 23, 4, 16, 60, 34816 }, // н
+    { 14, 14, 17, 1, 14, 49, 34876 }, // о
+    { 14, 14, 17, 1, 14, 49, 34925 }, // п
+    { 15, 21, 20, 2, 14, 79, 34974 }, // р
+    { 12, 16, 19, 3, 15, 48, 35053 }, // с
+    { 15, 14, 17, 1, 14, 53, 35101 }, // т
+    { 15, 21, 21, 3, 14, 79, 35154 }, // у
+    { 19, 20, 22, 1, 14, 95, 35233 }, // ф
+    { 15, 14, 18, 1, 14, 53, 35328 }, // х
+    { 15, 18, 18, 1, 14, 68, 35381 }, // ц
+    { 9, 13, 11, 1, 13, 30, 35449 }, // ч
+    { 18, 14, 20, 1, 14, 63, 35479 }, // ш
+    { 20, 19, 22, 1, 14, 95, 35542 }, // щ
+    { 16, 14, 19, 1, 14, 56, 35637 }, // ъ
+    { 18, 14, 20, 1, 14, 63, 35693 }, // ы
+    { 13, 14, 15, 1, 14, 46, 35756 }, // ь
+    { 14, 14, 16, 1, 14, 49, 35802 }, // э
+    { 16, 15, 20, 2, 15, 60, 35851 }, // ю
+    { 13, 14, 16, 1, 14, 46, 35911 }, // я
+    { 14, 24, 21, 3, 24, 84, 35957 }, // ѐ
+    { 14, 20, 17, 1, 19, 70, 36041 }, // ё
+    { 17, 25, 21, 1, 21, 107, 36111 }, // ђ
+    { 12, 21, 15, 1, 21, 63, 36218 }, // ѓ
+    { 12, 14, 16, 2, 13, 42, 36281 }, // є
+    { 13, 14, 19, 3, 14, 46, 36323 }, // ѕ
+    { 5, 22, 11, 3, 22, 28, 36369 }, // і
+    { 12, 22, 11, -1, 22, 66, 36397 }, // ї
+    { 10, 27, 16, 3, 21, 68, 36463 }, // ј
+    { 17, 14, 20, 2, 13, 60, 36531 }, // љ
+    { 16, 14, 19, 2, 14, 56, 36591 }, // њ
+    { 16, 21, 21, 1, 21, 84, 36647 }, // ћ
+    { 14, 22, 20, 3, 22, 77, 36731 }, // ќ
+    { 14, 21, 17, 1, 21, 74, 36864 }, // ѝ
+    { 15, 32, 21, 3, 25, 120, 36938 }, // ў
+    { 11, 17, 13, 1, 13, 47, 37058 }, // џ
+    { 15, 19, 21, 3, 18, 72, 37105 }, // Ѣ
+    { 16, 19, 18, 1, 18, 76, 37177 }, // ѣ
+    { 21, 18, 25, 2, 18, 95, 37253 }, // Ѫ
+    { 14, 13, 18, 2, 13, 46, 37348 }, // ѫ
+    { 18, 23, 27, 4, 22, 104, 37394 }, // Ѳ
+    { 14, 17, 21, 3, 17, 60, 37498 }, // ѳ
+    { 26, 28, 29, 4, 28, 182, 37558 }, // Ѵ
+    { 16, 17, 20, 3, 17, 68, 37740 }, // ѵ
+    { 9, 8, 0, 1, 23, 18, 37808 }, // ҆
+    { 14, 21, 16, 1, 21, 74, 37826 }, // Ґ
+    { 12, 17, 15, 1, 17, 51, 37900 }, // ґ
+    { 15, 19, 16, 0, 19, 72, 37951 }, // Ғ
+    { 10, 13, 11, 0, 13, 33, 38023 }, // ғ
+    { 15, 20, 17, 1, 20, 75, 38056 }, // Ҕ
+    { 9, 13, 11, 1, 13, 30, 38131 }, // ҕ
+    { 28, 25, 32, 2, 21, 175, 38161 }, // Җ
+    { 18, 18, 22, 2, 15, 81, 38336 }, // җ
+    { 13, 22, 18, 2, 19, 72, 38417 }, // Ҙ
+    { 9, 20, 11, 1, 14, 45, 38489 }, // ҙ
+    { 18, 24, 22, 2, 21, 108, 38534 }, // Қ
+    { 12, 18, 15, 2, 15, 54, 38642 }, // қ
+    { 20, 19, 24, 2, 19, 95, 38696 }, // Ҝ
+    { 14, 13, 18, 2, 13, 46, 38791 }, // ҝ
+    { 17, 21, 26, 4, 21, 90, 38912 }, // Ҟ
+    { 17, 21, 20, 0, 21, 90, 39002 }, // ҟ
+    { 23, 21, 26, -2, 21, 121, 39092 }, // Ҡ
+    { 17, 15, 17, -2, 15, 64, 39213 }, // ҡ
+    { 19, 25, 23, 2, 22, 119, 39277 }, // Ң
+    { 13, 17, 16, 2, 15, 56, 39396 }, // ң
+    { 26, 22, 27, 4, 22, 143, 39452 }, // Ҥ
+    { 18, 15, 18, 3, 15, 68, 39595 }, // ҥ
+    { 25, 21, 29, 2, 21, 132, 39663 }, // Ҧ
+    { 23, 23, 27, 2, 16, 133, 39795 }, // ҧ
+    { 25, 22, 30, 2, 21, 138, 39928 }, // Ҩ
+    { 19, 17, 23, 2, 16, 81, 40066 }, // ҩ
+    { 18, 27, 25, 3, 22, 122, 40147 }, // Ҫ
+    { 12, 19, 19, 3, 15, 57, 40269 }, // ҫ
+    { 19, 24, 23, 2, 21, 114, 40326 }, // Ҭ
+    { 13, 17, 16, 2, 15, 56, 40440 }, // ҭ
+    { 18, 21, 27, 4, 21, 95, 40496 }, // Ү
+    { 14, 18, 17, 1, 13, 63, 40591 }, // ү
+    { 18, 21, 27, 4, 21, 95, 40654 }, // Ұ
+    { 14, 19, 17, 1, 13, 67, 40749 }, // ұ
+    { 21, 26, 25, 2, 22, 137, 40816 }, // Ҳ
+    { 14, 18, 17, 2, 15, 63, 40960 }, // ҳ
+    { 22, 23, 27, 2, 18, 127, 41023 }, // Ҵ
+    { 15, 17, 19, 2, 13, 64, 41150 }, // ҵ
+    { 17, 24, 21, 1, 18, 102, 41214 }, // Ҷ
+    { 12, 17, 15, 1, 13, 51, 41316 }, // ҷ
+    { 14, 19, 18, 2, 19, 67, 41367 }, // Ҹ
+    { 10, 13, 12, 1, 13, 33, 41434 }, // ҹ
+    { 14, 21, 19, 2, 21, 74, 41467 }, // Һ
+    { 14, 21, 21, 3, 21, 74, 41541 }, // һ
+    { 22, 20, 24, 0, 19, 110, 41615 }, // Ҽ
+    { 16, 14, 17, 0, 14, 56, 41725 }, // ҽ
+    { 23, 23, 27, 2, 19, 133, 41781 }, // Ҿ
+    { 16, 17, 20, 2, 14, 68, 41914 }, // ҿ
+    { 5, 22, 11, 3, 22, 28, 41982 }, // Ӏ
+    { 27, 30, 36, 4, 30, 203, 42010 }, // Ӂ
+    { 23, 27, 30, 3, 27, 156, 42213 }, // ӂ
+    { 15, 25, 20, 2, 19, 94, 42369 }, // Ӄ
+    { 10, 17, 13, 2, 13, 43, 42463 }, // ӄ
+    { 18, 24, 19, 2, 19, 108, 42506 }, // Ӆ
+    { 13, 16, 13, 1, 13, 52, 42614 }, // ӆ
+    { 20, 28, 27, 4, 22, 140, 42666 }, // Ӈ
+    { 14, 20, 18, 3, 15, 70, 42806 }, // ӈ
+    { 20, 29, 27, 4, 22, 145, 43008 }, // Ӊ
+    { 13, 20, 19, 3, 15, 65, 43153 }, // ӊ
+    { 14, 23, 17, 0, 18, 81, 43218 }, // Ӌ
+    { 10, 16, 13, 1, 13, 40, 43299 }, // ӌ
+    { 25, 29, 31, 4, 22, 182, 43339 }, // Ӎ
+    { 17, 20, 21, 3, 15, 85, 43521 }, // ӎ
+    { 5, 18, 7, 1, 18, 23, 43606 }, // ӏ
+    { 20, 30, 28, 4, 30, 150, 43629 }, // Ӑ
+    { 14, 23, 21, 3, 23, 81, 43779 }, // ӑ
+    { 20, 29, 28, 4, 29, 145, 43860 }, // Ӓ
+    { 14, 21, 21, 3, 21, 74, 44005 }, // ӓ
+    { 28, 23, 36, 4, 22, 161, 44079 }, // Ӕ
+    { 24, 15, 31, 3, 15, 90, 44240 }, // ӕ
+    { 13, 26, 16, 1, 26, 85, 44330 }, // Ӗ
+    { 14, 25, 21, 3, 25, 88, 44415 }, // ӗ
+    { 14, 15, 21, 3, 14, 53, 44503 }, // Ә
+    { 14, 16, 21, 4, 15, 56, 44556 }, // ә
+    { 14, 26, 21, 3, 25, 91, 44612 }, // Ӛ
+    { 14, 17, 21, 4, 15, 60, 44703 }, // ӛ
+    { 27, 29, 33, 4, 29, 196, 44763 }, // Ӝ
+    { 23, 26, 30, 3, 26, 150, 45056 }, // ӝ
+    { 13, 26, 16, 1, 26, 85, 45206 }, // Ӟ
+    { 12, 21, 11, 1, 21, 63, 45291 }, // ӟ
+    { 12, 19, 15, 2, 18, 57, 45354 }, // Ӡ
+    { 12, 19, 15, 2, 13, 57, 45411 }, // ӡ
+    { 19, 27, 27, 4, 27, 129, 45468 }, // Ӣ
+    { 14, 20, 17, 1, 20, 70, 45597 }, // ӣ
+    { 19, 28, 27, 4, 28, 133, 45667 }, // Ӥ
+    { 14, 21, 17, 1, 21, 74, 45800 }, // ӥ
+    { 20, 29, 29, 4, 28, 145, 45874 }, // Ӧ
+    { 14, 22, 17, 1, 22, 77, 46019 }, // ӧ
+    { 18, 19, 27, 4, 18, 86, 46096 }, // Ө
+    { 14, 14, 21, 3, 14, 49, 46182 }, // ө
+    { 18, 30, 27, 4, 29, 135, 46231 }, // Ӫ
+    { 14, 23, 21, 3, 23, 81, 46366 }, // ӫ
+    { 18, 28, 23, 2, 27, 126, 46447 }, // Ӭ
+    { 14, 21, 16, 1, 21, 74, 46573 }, // ӭ
+    { 15, 28, 17, 1, 26, 105, 46647 }, // Ӯ
+    { 15, 29, 21, 3, 22, 109, 46752 }, // ӯ
+    { 15, 29, 17, 1, 27, 109, 46861 }, // Ӱ
+    { 15, 31, 21, 3, 24, 117, 46970 }, // ӱ
+    { 19, 29, 17, 0, 27, 138, 47104 }, // Ӳ
+    { 19, 31, 21, 2, 24, 148, 47242 }, // ӳ
+    { 14, 26, 17, 1, 26, 91, 47390 }, // Ӵ
+    { 12, 21, 11, -1, 21, 63, 47481 }, // ӵ
+    { 14, 23, 16, 1, 19, 81, 47544 }, // Ӷ
+    { 9, 16, 11, 1, 13, 36, 47625 }, // ӷ
+    { 23, 28, 28, 2, 28, 161, 47661 }, // Ӹ
+    { 18, 23, 20, 1, 23, 104, 47822 }, // ӹ
+    { 24, 25, 28, 4, 22, 150, 47926 }, // Ӽ
+    { 17, 17, 20, 3, 15, 73, 48076 }, // ӽ
+    { 0, 0, 21, 0, 0, 0, 48149 }, //  
+    { 0, 0, 33, 0, 0, 0, 48149 }, //  
+    { 0, 0, 21, 0, 0, 0, 48149 }, //  
+    { 0, 0, 33, 0, 0, 0, 48149 }, //  
+    { 0, 0, 16, 0, 0, 0, 48149 }, //  
+    { 0, 0, 14, 0, 0, 0, 48149 }, //  
+    { 0, 0, 12, 0, 0, 0, 48149 }, //  
+    { 0, 0, 17, 0, 0, 0, 48149 }, //  
+    { 0, 0, 7, 0, 0, 0, 48149 }, //  
+    { 0, 0, 13, 0, 0, 0, 48149 }, //  
+    { 0, 0, 12, 0, 0, 0, 48149 }, //  
+    { 0, 0, 8, 0, 0, 0, 48149 }, // ​
+    { 0, 0, 0, 0, 0, 0, 48149 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 48149 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 48149 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 48149 }, // ‏
+    { 13, 3, 14, 1, 9, 10, 48149 }, // ‐
+    { 13, 3, 14, 1, 9, 10, 48159 }, // ‑
+    { 18, 3, 19, 1, 9, 14, 48169 }, // ‒
+    { 17, 4, 20, 1, 9, 17, 48183 }, // –
+    { 26, 4, 28, 1, 9, 26, 48200 }, // —
+    { 26, 4, 28, 1, 9, 26, 48226 }, // ―
+    { 11, 22, 14, 1, 18, 61, 48252 }, // ‖
+    { 19, 8, 20, 1, -2, 38, 48313 }, // ‗
+    { 6, 7, 8, 1, 21, 11, 48351 }, // ‘
+    { 6, 7, 8, 1, 21, 11, 48362 }, // ’
+    { 6, 8, 8, 1, 4, 12, 48373 }, // ‚
+    { 6, 7, 8, 1, 21, 11, 48385 }, // ‛
+    { 12, 7, 14, 1, 21, 21, 48396 }, // “
+    { 12, 7, 14, 1, 21, 21, 48417 }, // ”
+    { 6, 8, 8, 1, 4, 12, 48438 }, // „
+    { 13, 8, 14, 1, 21, 26, 48450 }, // ‟
+    { 14, 33, 15, 0, 26, 116, 48476 }, // †
+    { 13, 33, 15, 1, 26, 108, 48592 }, // ‡
+    { 15, 15, 13, -1, 18, 57, 48700 }, // •
+    { 7, 8, 10, 1, 11, 14, 48757 }, // ‣
+    { 5, 5, 7, 1, 5, 7, 48771 }, // ․
+    { 5, 5, 7, 1, 5, 7, 48778 }, // ‥
+    { 22, 5, 24, 1, 5, 28, 48785 }, // …
+    { 4, 3, 6, 1, 9, 3, 48813 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 48816 }, //  
+    { 16, 22, 28, 6, 20, 88, 48816 }, // ‰
+    { 6, 7, 8, 1, 21, 11, 48904 }, // ′
+    { 12, 7, 14, 1, 21, 21, 48915 }, // ″
+    { 19, 8, 21, 1, 21, 38, 48936 }, // ‴
+    { 6, 7, 8, 1, 21, 11, 48974 }, // ‵
+    { 12, 7, 13, 0, 21, 21, 48985 }, // ‶
+    { 19, 8, 21, 1, 21, 38, 49006 }, // ‷
+    { 11, 5, 14, 1, 20, 14, 49044 }, // ‸
+    { 8, 12, 10, 1, 13, 24, 49058 }, // ‹
+    { 8, 12, 10, 1, 13, 24, 49082 }, // ›
+    { 26, 26, 33, 5, 23, 169, 49152 }, // ※
+    { 6, 25, 8, 1, 25, 38, 49321 }, // ‼
+    { 14, 31, 19, 2, 30, 109, 49359 }, // ‽
+    { 13, 3, 14, 1, 21, 10, 49468 }, // ‾
+    { 11, 5, 14, 1, 17, 14, 49478 }, // ‿
+    { 17, 16, 20, 1, 22, 68, 49492 }, // ⁂
+    { 15, 20, 28, 6, 19, 75, 49560 }, // ⁄
+    { 28, 28, 32, 2, 28, 196, 49635 }, // ⁇
+    { 19, 28, 25, 2, 28, 133, 49831 }, // ⁈
+    { 19, 30, 20, 1, 28, 143, 49964 }, // ⁉
+    { 15, 39, 19, 2, 27, 147, 50107 }, // ⁒
+    { 0, 0, 121, 0, 0, 0, 50254 }, //  
+    { 7, 10, 8, 0, 21, 18, 50254 }, // ⁰
+    { 8, 10, 8, 0, 21, 20, 50272 }, // ⁴
+    { 6, 10, 8, 1, 21, 15, 50292 }, // ⁵
+    { 8, 9, 8, 0, 20, 18, 50307 }, // ⁶
+    { 7, 10, 8, 1, 21, 18, 50325 }, // ⁷
+    { 8, 10, 8, 0, 21, 20, 50343 }, // ⁸
+    { 8, 9, 8, 0, 20, 18, 50363 }, // ⁹
+    { 14, 14, 20, 3, 14, 49, 50381 }, // ⁿ
+    { 9, 13, 11, 1, 13, 30, 50430 }, // ₀
+    { 6, 10, 8, 1, 6, 15, 50460 }, // ₁
+    { 7, 10, 8, 1, 6, 18, 50475 }, // ₂
+    { 8, 9, 8, 0, 5, 18, 50493 }, // ₃
+    { 8, 10, 8, 0, 6, 20, 50511 }, // ₄
+    { 7, 10, 8, 0, 6, 18, 50531 }, // ₅
+    { 8, 9, 8, 0, 5, 18, 50549 }, // ₆
+    { 7, 11, 8, 1, 6, 20, 50567 }, // ₇
+    { 8, 10, 8, 0, 6, 20, 50587 }, // ₈
+    { 8, 9, 8, 0, 5, 18, 50607 }, // ₉
+    { 8, 34, 11, 2, 25, 68, 50625 }, // ₍
+    { 8, 34, 11, 1, 25, 68, 50693 }, // ₎
+    { 17, 31, 25, 4, 26, 132, 50761 }, // ₡
+    { 18, 23, 25, 3, 22, 104, 50893 }, // ₢
+    { 16, 24, 17, 1, 24, 96, 50997 }, // ₤
+    { 24, 22, 27, 2, 22, 132, 51200 }, // ₦
+    { 20, 21, 23, 1, 21, 105, 51332 }, // ₧
+    { 25, 21, 28, 3, 21, 132, 51437 }, // ₨
+    { 19, 21, 21, 1, 21, 100, 51569 }, // ₩
+    { 20, 19, 27, 3, 19, 95, 51669 }, // ₪
+    { 17, 20, 17, 1, 20, 85, 51764 }, // ₫
+    { 15, 23, 19, 2, 20, 87, 51849 }, // €
+    { 19, 21, 27, 4, 21, 100, 51936 }, // ₮
+    { 22, 21, 16, 0, 21, 116, 52036 }, // ₱
+    { 20, 30, 29, 4, 26, 150, 52152 }, // ₲
+    { 23, 23, 23, 1, 22, 133, 52302 }, // ₴
+    { 12, 18, 19, 3, 17, 54, 52435 }, // ₵
+    { 19, 22, 27, 4, 22, 105, 52489 }, // ₸
+    { 13, 20, 15, 1, 19, 65, 52594 }, // ₹
+    { 15, 18, 17, 1, 17, 68, 52659 }, // ₺
+    { 16, 19, 16, 0, 19, 76, 52727 }, // ₼
+    { 20, 21, 23, -1, 21, 105, 52803 }, // ₽
+    { 16, 16, 19, 1, 14, 64, 52908 }, // ←
+    { 17, 15, 19, 1, 15, 64, 52972 }, // ↑
+    { 16, 16, 19, 1, 14, 64, 53036 }, // →
+    { 17, 15, 19, 1, 15, 64, 53100 }, // ↓
+    { 20, 14, 22, 1, 14, 70, 53164 }, // ↔
+    { 14, 19, 16, 1, 20, 67, 53248 }, // ↕
+    { 13, 12, 16, 1, 13, 39, 53315 }, // ↖
+    { 13, 12, 16, 1, 13, 39, 53354 }, // ↗
+    { 13, 13, 16, 1, 14, 43, 53393 }, // ↘
+    { 13, 13, 16, 1, 14, 43, 53436 }, // ↙
+    { 19, 16, 21, 1, 15, 76, 53479 }, // ⇐
+    { 20, 18, 23, 1, 18, 90, 53555 }, // ⇑
+    { 19, 16, 21, 1, 15, 76, 53645 }, // ⇒
+    { 20, 19, 23, 1, 18, 95, 53721 }, // ⇓
+    { 22, 16, 24, 1, 15, 88, 53816 }, // ⇔
+    { 17, 21, 19, 1, 14, 90, 53904 }, // ⇕
+    { 15, 20, 17, 1, 20, 75, 53994 }, // ∂
+    { 25, 23, 29, 2, 22, 144, 54069 }, // ∅
+    { 19, 19, 22, 1, 19, 91, 54213 }, // ∆
+    { 16, 18, 18, 1, 18, 72, 54304 }, // ∏
+    { 16, 18, 18, 1, 18, 72, 54376 }, // ∐
+    { 12, 19, 15, 1, 18, 57, 54448 }, // ∑
+    { 13, 4, 15, 1, 9, 13, 54505 }, // −
+    { 21, 21, 23, 1, 20, 111, 54518 }, // √
+    { 20, 12, 23, 1, 15, 60, 54629 }, // ∞
+    { 21, 28, 21, 0, 22, 147, 54689 }, // ∫
+    { 5, 15, 7, 1, 15, 19, 54836 }, // ∶
+    { 15, 13, 19, 2, 14, 49, 54855 }, // ≈
+    { 16, 22, 28, 6, 20, 88, 54904 }, // ≠
+    { 19, 19, 22, 1, 18, 91, 54992 }, // ≤
+    { 19, 19, 22, 1, 18, 91, 55083 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
@@ -4170,4 +2683,9 @@ static const EpdFontData opendyslexic_12_regular = {
     33,
     -13,
     true,
+    opendyslexic_12_regularBlockOffsets,
+    opendyslexic_12_regularDirectGlyphs,
+    opendyslexic_12_regularGlyphPages,
+    35,
+    opendyslexic_12_regularPageGlyphs,
 };
@@ -2,5252 +2,2617 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_bold
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_boldBitmaps[83814] = {
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0xFC, 0x00,
-    0x0B, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x41, 0xFF, 0xE0, 0xBF, 0xF8, 0x2F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF,
-    0xFC, 0x7F, 0xFF, 0x40, 0x7F, 0xFD, 0x0F, 0xFF, 0xCB, 0xFF, 0xC0, 0xFF, 0xF8, 0xBF, 0xFC, 0x0F,
-    0xFF, 0x4B, 0xFF, 0x40, 0xFF, 0xF0, 0xBF, 0xF0, 0x0F, 0xFF, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0xBF,
-    0xF4, 0x0F, 0xFF, 0x0B, 0xFF, 0x40, 0xFF, 0xF0, 0xBF, 0xF4, 0x0F, 0xFF, 0x0F, 0xFF, 0x40, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x94, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0xFF, 0xF6, 0xA0, 0x00, 0x03, 0xFF, 0x8B, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x0B, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0xFD, 0x00, 0xE0, 0x0F,
-    0xE0, 0x3F, 0xFD, 0x03, 0xFF, 0x8F, 0xE0, 0x7F, 0xFD, 0x0B, 0xFF, 0xFF, 0xFB, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0xBF, 0x00, 0x0F, 0xD1, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xD0, 0x2F, 0x00, 0x3F, 0xC0,
-    0x01, 0xF0, 0x07, 0xC0, 0x1F, 0xE0, 0x00, 0x7D, 0x01, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0x80, 0xFC,
-    0x0B, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xCB, 0xD1, 0xF8, 0x00, 0x00, 0x3F, 0xD3, 0xE0, 0x2F, 0x00,
-    0x00, 0x2F, 0xF0, 0xF4, 0x07, 0xC0, 0x00, 0x0F, 0xF4, 0x3D, 0x01, 0xF4, 0x00, 0x0F, 0xFC, 0x0F,
-    0x80, 0x7C, 0x00, 0x07, 0xFC, 0x03, 0xF9, 0xBF, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0x80, 0x02,
-    0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xEF, 0xE0, 0x0B, 0xFC, 0xFF, 0xC2, 0xFF, 0x02, 0xFE, 0x3F, 0xE0, 0x1F, 0xF0,
-    0xFF, 0x9F, 0xF4, 0x01, 0xFF, 0xBF, 0xC7, 0xFF, 0x00, 0x1F, 0xFF, 0xE1, 0xFF, 0xF4, 0x02, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x70, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFD,
-    0x7F, 0xFC, 0x7F, 0xF8, 0x7F, 0xF4, 0x7F, 0xF4, 0x7F, 0xF4, 0x7F, 0xF8, 0xBF, 0xF8, 0xBF, 0xF8,
-    0x00, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00,
-    0x0A, 0xA9, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0,
-    0x00, 0xAA, 0xA0, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x01,
-    0xC0, 0x38, 0x3F, 0xC2, 0xF0, 0x3F, 0xEB, 0xF7, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xBF, 0x9F, 0xCB, 0xF0, 0x0F, 0x47, 0xF0, 0x24, 0x00, 0x41, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0xB4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x6A, 0xAF, 0xFE, 0xA9,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8, 0x0F, 0xFF, 0x40,
-    0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF,
-    0x40, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x05, 0x50, 0x7F, 0xC2, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x0F, 0xF0, 0x02, 0xFD, 0x07, 0xF8, 0x00,
-    0x7F, 0x83, 0xFD, 0x04, 0x0F, 0xF0, 0xFF, 0x4F, 0xC3, 0xFD, 0x3F, 0xC7, 0xF8, 0xBF, 0x5F, 0xF2,
-    0xFF, 0x2F, 0xE7, 0xFC, 0xBF, 0xCB, 0xFA, 0xFF, 0x2F, 0xF2, 0xFE, 0xBF, 0xC7, 0xF8, 0xFF, 0x9F,
-    0xF4, 0xBC, 0x3F, 0xE7, 0xFE, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xFE, 0x3F, 0xFC, 0x0B, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0x40, 0x01, 0xE3, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x1F, 0xFC, 0x0E, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xAA, 0xBF, 0xF0, 0x24, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0x40, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0xFF, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x0B, 0xF0,
-    0xFF, 0x00, 0x01, 0xFD, 0x0F, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xF4, 0x02,
-    0xFE, 0x5A, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC1, 0xAA, 0xAB, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xEA, 0xAA, 0xA4, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x04, 0x00, 0x07, 0xFF, 0x1F, 0x40, 0x1F, 0xFF, 0x2F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE8,
-    0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFC, 0x07, 0xFF, 0x2F, 0xFC, 0x00, 0x7F, 0xD7, 0xFE, 0x00, 0x0F,
-    0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE3, 0xFF, 0xEA,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x7F,
-    0xE0, 0x0F, 0xF0, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xFF,
-    0x80, 0x7F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x43, 0xFF, 0x00, 0x0F, 0xF8, 0x7F, 0xD0,
-    0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x0B, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xC7, 0xFF, 0x80, 0x7F, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xE5, 0xBF, 0xF0, 0x3F, 0xC0, 0x03, 0xFE, 0x0F, 0xD0, 0x00, 0x3F,
-    0xC7, 0xF0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x02, 0xFD, 0x7F, 0x00, 0x00, 0xBF, 0x9F, 0xC0, 0x00,
-    0x3F, 0xE3, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0xD5, 0xBF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xC1, 0xFE, 0x95, 0xBF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xAF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2F,
-    0xF8, 0x2F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x7F, 0xFD, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2F, 0xF8, 0x2F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x7F, 0xFD, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x0B,
-    0xFF, 0x40, 0xFF, 0xF4, 0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x90, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0,
-    0x7F, 0xF8, 0x07, 0xFF, 0x40, 0xFF, 0xF0, 0x0F, 0xFF, 0x02, 0xFF, 0xD0, 0x3F, 0xFC, 0x07, 0xFF,
-    0xC0, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x16,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x05, 0x5A, 0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1B, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFA, 0xAA, 0x94, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x6F, 0xFF, 0xFF, 0xFF, 0xE5, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0x40, 0x00, 0xFF, 0x40, 0xD0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF9, 0x01, 0xBF, 0x80, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x0B, 0xEF, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFF, 0xFC, 0x01, 0xF0,
-    0x02, 0xFC, 0x0B, 0x83, 0xF0, 0x03, 0xD0, 0x0F, 0xE0, 0x3C, 0x07, 0xC0, 0x0F, 0x40, 0x3F, 0x80,
-    0xE0, 0x0F, 0x00, 0x3D, 0x01, 0xFE, 0x07, 0x40, 0x3D, 0x01, 0xF0, 0x07, 0xF8, 0x1E, 0x01, 0xF4,
-    0x0F, 0xC0, 0x1F, 0xF0, 0x3F, 0xFF, 0xE0, 0xBE, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x9F, 0xF0, 0x00,
-    0xFF, 0x80, 0xBF, 0xAF, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD4, 0x06, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
-    0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80,
-    0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xE0, 0x01, 0xFF, 0xC0,
-    0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F,
-    0xE0, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x16, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0x00,
-    0xBF, 0xF4, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x1F,
-    0xFC, 0x7F, 0xE5, 0x55, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD4,
-    0x05, 0xB4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xC7,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x00, 0x16, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE9, 0x00, 0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD5,
-    0x56, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0A, 0xAA, 0xBF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFD, 0x54, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF,
-    0x83, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF,
-    0x50, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC2, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x0F,
-    0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x01, 0xFF, 0xD3, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x7F,
-    0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x1F, 0x90, 0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x16, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F,
-    0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x00, 0x03, 0xFE, 0x0F,
-    0xFF, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xDB,
-    0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xAF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xFF, 0xFF, 0x00,
-    0x3F, 0xF8, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x3F, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xAB, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x42,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x83, 0xFF, 0x7F, 0xF4, 0xFF, 0xEF, 0xF8,
-    0x3F, 0xF3, 0xFF, 0x9F, 0xFE, 0xFF, 0x83, 0xFF, 0x2F, 0xFF, 0xFF, 0xAF, 0xF8, 0x3F, 0xF5, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xC3, 0xFF, 0x4F, 0xFF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF4, 0xBF, 0xFF, 0xE3, 0xFF,
-    0xC3, 0xFF, 0x87, 0xFF, 0xFD, 0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0x82,
-    0xFF, 0xF8, 0x3F, 0xFC, 0x3F, 0xF8, 0x0F, 0xFF, 0x47, 0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0xF0, 0x7F,
-    0xFC, 0x3F, 0xFC, 0x0B, 0xFF, 0x07, 0xFF, 0xC3, 0xFF, 0xC0, 0x3F, 0xD0, 0xBF, 0xFC, 0x7F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6A, 0xA0, 0x00, 0x03, 0xFD,
-    0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD0, 0x00, 0x7F,
-    0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFE,
-    0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x2F, 0xFE, 0x0F,
-    0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x01, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x5F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC3,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA,
-    0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02, 0xFE, 0x07,
-    0xFD, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x7F, 0xE5, 0x5B, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x0F,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x01, 0xD0, 0x1F, 0xF8, 0x02, 0xFF,
-    0xC0, 0x0F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0xE5, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0x47, 0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF0,
-    0x3F, 0xFD, 0x00, 0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x2A,
-    0xA9, 0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xD0, 0x1B, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x3E, 0x00, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00,
-    0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0,
-    0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC2, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-    0xC0, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0x00, 0x7F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xF0, 0x0B, 0xFF,
-    0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x3F,
-    0xFC, 0x03, 0xFF, 0xF4, 0x07, 0xFF, 0x40, 0x0F, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xC0, 0x02,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F, 0xF8, 0x00,
-    0x1F, 0xFF, 0x3F, 0xFF, 0xFF, 0x5F, 0xFD, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xD0,
-    0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFD,
-    0x2F, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0x00, 0xFF,
-    0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x0B, 0xFF,
-    0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x00,
-    0x7F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xDF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A,
-    0xAA, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF5, 0x55, 0x50, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x06, 0xAA, 0xA8, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xD0, 0x00,
-    0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x40, 0x6A, 0xAA, 0x80, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0,
-    0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
-    0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xF8, 0x00,
-    0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xDF, 0xFC, 0x00,
-    0xBF, 0x80, 0xBF, 0xC0, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x55, 0x40, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07,
-    0xF4, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD,
-    0x1F, 0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02,
-    0xFF, 0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC2, 0xFD, 0x00, 0x03, 0xFD, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0x86, 0xFE, 0x02, 0xFF, 0xD0, 0x07, 0xF0, 0x2F, 0xFC, 0x00, 0x3F, 0x42, 0xFF,
-    0x80, 0x02, 0xF8, 0x1F, 0xF4, 0x00, 0x2F, 0xC1, 0xFF, 0x40, 0x03, 0xFC, 0x1F, 0xF4, 0x00, 0x7F,
-    0xC1, 0xFF, 0xD0, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x65, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0xFF, 0xE0, 0x78, 0x02, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE4, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF4, 0x2F, 0xFF, 0x83, 0xFD,
-    0x00, 0xBF, 0xF8, 0x3F, 0xC0, 0x03, 0xFF, 0x87, 0xF4, 0x00, 0x3F, 0xF8, 0xBF, 0x40, 0x02, 0xFF,
-    0x47, 0xF4, 0x00, 0x2F, 0xF4, 0x7F, 0x40, 0x03, 0xFF, 0x43, 0xFC, 0x00, 0x7F, 0xF4, 0x3F, 0xFA,
-    0xAF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xBF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA,
-    0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0xBF, 0xFC, 0x01, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00,
-    0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07,
-    0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F,
-    0xE4, 0xBF, 0x80, 0x7F, 0xFF, 0xBF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFB, 0xFF, 0xFD, 0x2F,
-    0xC0, 0x2F, 0xFF, 0x4F, 0xD0, 0x03, 0xFF, 0xD7, 0xF0, 0x00, 0x7F, 0xF5, 0xF8, 0x00, 0x0F, 0xFD,
-    0xBE, 0x00, 0x03, 0xFF, 0x6F, 0x80, 0x00, 0xFF, 0xC7, 0xF0, 0x00, 0x7F, 0xF1, 0xFE, 0x00, 0x7F,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0xE8, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x0E, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x05, 0xBF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF2, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFE, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x3F, 0xF0, 0x00, 0x3F,
-    0x43, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0xF0, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0x07, 0xF8, 0x3F, 0xF0,
-    0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC,
-    0x7F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x05, 0x50,
-    0x7F, 0xC2, 0xFF, 0x4B, 0xFE, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03,
-    0xFC, 0x0F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF4, 0xBF, 0xE2, 0xFF, 0x80, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x10, 0xFF, 0x40, 0xFF, 0xFD,
-    0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x7F, 0xFD, 0x00, 0x69, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x05, 0x54, 0x00, 0x2F, 0xD2, 0xFF, 0x40, 0x02, 0xFD, 0x7F,
-    0xE0, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xEF, 0xFF, 0x80, 0x07, 0xFD, 0x7F, 0xFF, 0x00, 0x7F,
-    0xD2, 0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0xF0, 0xBF, 0xE0, 0x3F, 0xFF, 0xD0, 0x1F, 0xF0, 0x07,
-    0xF8, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xCB, 0xFF,
-    0xF6, 0xFF, 0xFE, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xBF,
-    0x90, 0x0B, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xEB, 0xFF, 0xFE, 0xBF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xF4,
-    0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x07, 0xF8, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x1F, 0xF8,
-    0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x2F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0B,
-    0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x7F, 0xE0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00,
-    0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE,
-    0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7,
-    0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF, 0x7F, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF,
-    0xF0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE,
-    0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF,
-    0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x0F, 0xF9,
-    0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x2F, 0xE7, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xE0, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0x3F,
-    0xF8, 0x00, 0x2F, 0x80, 0xFF, 0xD0, 0x00, 0xBE, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x0F, 0xFD, 0x00,
-    0x07, 0xF0, 0x3F, 0xF8, 0x00, 0x2F, 0x80, 0xFF, 0xF4, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE,
-    0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0xAE, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x7F, 0x80, 0x01, 0xFF, 0xFF, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xF9, 0xBF, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x40, 0x3F, 0x40, 0x0B, 0xFF,
-    0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00,
-    0xBF, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x0B, 0xFE, 0x00, 0x3F,
-    0xFE, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x01, 0x00, 0x2F, 0xF9, 0xFD, 0x6F, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF5, 0xBF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0x41,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0xBF, 0xC0, 0x03, 0xF4, 0x00, 0x50, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x40, 0x02, 0xFF, 0x80,
-    0xB8, 0x00, 0xBF, 0xE0, 0x7F, 0xFA, 0xBF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x1A, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x6F, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xAA,
-    0xFF, 0xAA, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xA6,
-    0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x1F,
-    0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00,
-    0x1F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x2F, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFD, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x0B, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0x40,
-    0x00, 0x1F, 0xFC, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0x01,
-    0x40, 0x0B, 0xFC, 0x1F, 0xF4, 0x0B, 0xF0, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x0F,
-    0xFC, 0x3F, 0xFC, 0x2F, 0xF0, 0x0B, 0xFC, 0x7F, 0xFE, 0x3F, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xBF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFD, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE,
-    0x00, 0x00, 0x2A, 0x90, 0x06, 0xA8, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x0B,
-    0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xEF, 0xFE, 0x00, 0x01, 0xFF, 0xD2, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x3F, 0xFC,
-    0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0xD0, 0x00, 0x0F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80, 0x02, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x0B, 0xFD, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x7F,
-    0xC0, 0x00, 0x3F, 0xF2, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1A, 0xAA, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x55, 0x54, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x5A, 0xA0, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x02,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x4B, 0xF2, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F,
-    0x8F, 0xE3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF5, 0xFD, 0x7F, 0x5F, 0xD7, 0xF1, 0xFC, 0x7F, 0x1F,
-    0xC7, 0xF0, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x06, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBC, 0x2F, 0xF4,
-    0xBC, 0x3F, 0xFD, 0xBC, 0x7D, 0x7F, 0xFC, 0x7D, 0x2F, 0xF4, 0x3E, 0x07, 0xD0, 0x7F, 0xFF, 0x5F,
-    0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFC, 0x2F, 0xFF, 0x0B, 0xFF, 0x81, 0xFF, 0xE0, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xB0, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x01, 0xFD, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xCF, 0x80, 0x03, 0xFD, 0x3E, 0x00, 0x0F, 0xF0, 0xF8, 0x00, 0x7F, 0xC3,
-    0xE0, 0x01, 0xFF, 0x0F, 0x80, 0x07, 0xFC, 0x3E, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x3F, 0xE3, 0xE0,
-    0x00, 0xFF, 0xEF, 0xA4, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xF4, 0x1B, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xA0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x03, 0xD0, 0x01, 0xFC,
-    0x00, 0xFF, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xBF, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFE, 0xBF, 0xEF, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x15, 0x42, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x0F,
-    0xFD, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2A, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0A,
-    0xA8, 0x00, 0x00, 0x1B, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x7E, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBC, 0xBC, 0xFC, 0x40, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFD, 0x47, 0xF4, 0x02, 0xF4, 0x00,
-    0xF0, 0x03, 0xF8, 0x00, 0x50, 0x02, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x0B, 0xFD, 0x5B, 0xFC, 0x0F, 0xF0, 0x02, 0xFD, 0x0F, 0xE0, 0x02,
-    0xFD, 0x0F, 0xFF, 0xEF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x02, 0x40, 0x02,
-    0xFD, 0x0B, 0xF4, 0x07, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0xBF, 0xD0, 0xBF, 0xD2, 0xFF, 0x42, 0xFF,
-    0x4F, 0xFE, 0x0F, 0xFE, 0x3F, 0xF8, 0x3F, 0xF8, 0xFF, 0xF1, 0xFF, 0xF1, 0x55, 0x41, 0x55, 0x40,
-    0x00, 0xBF, 0x90, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFA, 0xFE, 0x02, 0xF4, 0x03, 0xF4, 0x3E, 0x3F,
-    0x4F, 0xC7, 0xCF, 0x00, 0xBC, 0x7C, 0xE0, 0x07, 0xC7, 0xDF, 0x50, 0xBC, 0x3F, 0x2F, 0x9F, 0x82,
-    0xFD, 0x07, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xB4, 0x0F, 0xFF, 0x42, 0xD0, 0xF8, 0x3C, 0x0B, 0x83, 0x80, 0x7C, 0x38, 0x07, 0xC3,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 0x68, 0x00, 0x00, 0x40, 0x01, 0x00, 0x02, 0xC0, 0x1D, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x3F, 0xC2, 0xFD, 0x01, 0xFF, 0x4B, 0xFC, 0x07, 0xFD, 0x3F, 0xF0, 0x2F,
-    0xF0, 0xFF, 0x80, 0x7F, 0xC3, 0xFD, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x7F, 0xF6, 0xFF, 0xC0, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x03, 0xFF, 0x6F, 0xFC, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x3F, 0x02, 0xF8, 0x00,
-    0x0F, 0x00, 0xB4, 0x00, 0x02, 0x00, 0x10, 0x7F, 0xA9, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x56, 0xAF, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x90, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFA, 0xFE, 0x02, 0xFF, 0xF6,
-    0xF4, 0x3E, 0x61, 0xCF, 0x87, 0xD6, 0x1C, 0xBC, 0x7C, 0xBF, 0x47, 0xC7, 0xCB, 0xB8, 0xBC, 0x3E,
-    0xB2, 0xCF, 0x82, 0xFF, 0x2F, 0xF4, 0x0F, 0xFB, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xAF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xFF, 0x83, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xE0, 0xBF, 0x87, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x3F, 0xC7, 0xFC, 0x03, 0xFC, 0x3F, 0xFA,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xAF, 0x90, 0x00,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x55, 0x60, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0xBF, 0xF4, 0xA0, 0xB8, 0x00, 0x3C,
-    0x00, 0x7C, 0x01, 0xF4, 0x0B, 0xE0, 0x3F, 0xC0, 0xBF, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x16, 0x90,
-    0x3F, 0xF8, 0x10, 0x2C, 0x00, 0x2D, 0x0B, 0xF8, 0x0F, 0xF8, 0x00, 0x7D, 0x10, 0x2E, 0x3F, 0xFD,
-    0xBF, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x03, 0xF4, 0x2F, 0xC0, 0xFE, 0x0B, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFE,
-    0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0x7F, 0xE0, 0x00, 0x7F,
-    0xC7, 0xFF, 0x00, 0x0B, 0xFC, 0x7F, 0xF0, 0x00, 0xBF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xF4,
-    0x00, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xEB, 0xF1, 0xBF,
-    0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x00, 0xFF, 0xFC, 0x3F, 0xC0, 0xFF, 0xFF, 0x0F,
-    0xF0, 0xBF, 0xFF, 0xC3, 0xFC, 0x3F, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xC3, 0xFF, 0xFE,
-    0x0F, 0xF0, 0xBF, 0xFF, 0x83, 0xFC, 0x1F, 0xFF, 0xE0, 0xFF, 0x02, 0xFF, 0xF8, 0x3F, 0xC0, 0x1F,
-    0xFD, 0x0B, 0xF0, 0x03, 0xFF, 0x42, 0xFC, 0x00, 0xFF, 0xD0, 0xBF, 0x00, 0x3F, 0xF0, 0x2F, 0xC0,
-    0x1F, 0xFC, 0x0B, 0xF0, 0x0B, 0xFF, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0xBF, 0x00, 0xFF, 0xF0, 0x2F,
-    0xC0, 0x3F, 0xFC, 0x0B, 0xF0, 0x1F, 0xFF, 0x02, 0xFD, 0x0B, 0xFF, 0x80, 0xBF, 0x43, 0xFF, 0xE0,
-    0x2F, 0xD0, 0xFF, 0xF8, 0x0B, 0xF4, 0x3F, 0xFE, 0x01, 0xFD, 0x1F, 0xFF, 0x40, 0x7F, 0x40, 0x1F,
-    0xF0, 0xBF, 0xD2, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xFF, 0xF1, 0x55, 0x40, 0x0F, 0x40, 0x1F, 0x00,
-    0x3F, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x10, 0xFC, 0x3F, 0xFC, 0x7F, 0xF4, 0xBF, 0xD0, 0x00, 0x00,
-    0x7D, 0x03, 0xF4, 0x1A, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x43, 0xFF, 0xEF,
-    0xFF, 0x95, 0x54, 0x02, 0xFD, 0x00, 0xFF, 0xF4, 0x2E, 0x07, 0xC3, 0xD0, 0x3C, 0x3D, 0x03, 0xD3,
-    0xE0, 0x7C, 0x2F, 0xFF, 0xC0, 0xFF, 0xF4, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0xA0, 0x03, 0x40, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0xBF, 0x43, 0xF8, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x1F, 0xF8, 0xBF, 0xC0, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0xFF, 0x47, 0xFC, 0x01, 0xFF, 0xCB, 0xFD,
-    0x07, 0xFF, 0x6F, 0xFC, 0x1F, 0xFD, 0xFF, 0xF0, 0x7F, 0xF6, 0xFF, 0x80, 0x3F, 0xD2, 0xFE, 0x00,
-    0x3F, 0x01, 0xF8, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x18, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x01, 0x40, 0x3F, 0xFF, 0xF0,
-    0x2F, 0xE0, 0x2F, 0x40, 0xFF, 0xFF, 0xC0, 0xFF, 0x01, 0xFD, 0x03, 0xFF, 0xFF, 0x0B, 0xF8, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xDF, 0x80, 0x00,
-    0x00, 0x2F, 0xF0, 0x3D, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x2F, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x2F, 0xF0, 0x05, 0x6B, 0xFE, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x18, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x41, 0x69, 0x00, 0x3F, 0xFF, 0xF0,
-    0x1F, 0xF1, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x03, 0xFC, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0xBF,
-    0x82, 0xE4, 0x2F, 0xC1, 0x55, 0x55, 0x0F, 0xF0, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0x55, 0x55, 0x40, 0x06, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xE5, 0x6F, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xAB, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF0,
-    0x00, 0x00, 0x50, 0x0F, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x43, 0xFC, 0x07, 0xD0, 0x1F,
-    0xFF, 0xFC, 0x3F, 0xD0, 0x3F, 0x40, 0xFF, 0xFF, 0xD1, 0xFE, 0x03, 0xFD, 0x01, 0xBF, 0xF9, 0x0F,
-    0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xF7, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0x4F,
-    0x80, 0x00, 0x00, 0x3F, 0xD0, 0xF8, 0x7E, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xC1, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x82, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFC, 0x06,
-    0xAA, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0xC0, 0x3F, 0xD0, 0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x6D,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x7D, 0x00, 0x00,
-    0x00, 0x0F, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0xBF,
-    0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x2F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0x4F, 0xFF, 0x40, 0x00, 0x01, 0x55, 0x41, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xF9, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x51, 0xAA, 0xAA, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xA5, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xFE, 0x55,
-    0x58, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x55, 0x55, 0x50, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD4, 0x05, 0xB4,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x10,
-    0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xA5, 0x54, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55,
-    0x68, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xA5, 0x54, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x68, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF9, 0x55, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xFD, 0x0B, 0xF8,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0xC1,
-    0xFF, 0xC0, 0x07, 0xFF, 0x4B, 0xFF, 0x40, 0x2F, 0xFD, 0x2F, 0xFD, 0x00, 0x55, 0x50, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5,
-    0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF4, 0x0B, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xBF, 0xD0, 0x0F, 0xF4, 0x0F, 0xF4, 0x3F, 0xC0, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x05, 0x50, 0x05, 0x50, 0x7F, 0xC0, 0xBF,
-    0xC2, 0xFF, 0x42, 0xFF, 0x4F, 0xFD, 0x0F, 0xFD, 0x3F, 0xF8, 0x3F, 0xF8, 0xFF, 0xE0, 0xFF, 0xE7,
-    0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF,
-    0x40, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC5, 0x5B, 0xFF, 0x55, 0x40, 0x02, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF0, 0x01, 0x6F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFA, 0x40,
-    0x00, 0x00, 0x00, 0x6D, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x3D, 0x00, 0x00, 0x02, 0xFF, 0xE7,
-    0xD0, 0x00, 0x00, 0x3F, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x06, 0xAA, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xF8,
-    0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0xBF, 0xFD, 0x00, 0x07, 0xFC, 0x0B, 0xFF,
-    0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFC, 0x0F,
-    0xFE, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0xDB, 0xFC, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xE0, 0xFF, 0xC1,
-    0xFF, 0xE3, 0xFF, 0x0F, 0xF8, 0x2F, 0xFE, 0x1F, 0xF9, 0xFF, 0x82, 0xFF, 0xE0, 0xFF, 0xEF, 0xF8,
-    0x2F, 0xFE, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFE, 0x02, 0xFF, 0xFF,
-    0x43, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x07, 0xFF,
-    0xF4, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x5F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x06, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x82, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x00, 0x00,
-    0x0B, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD,
-    0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0xE5, 0x16, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFE,
-    0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F,
-    0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFE, 0x1F, 0xFF, 0x05, 0x55, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x07, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xD0, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xE0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x7F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xFE, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0x3F, 0xF8,
-    0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x82, 0xFF, 0xFE, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x43, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F,
-    0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03,
-    0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF0, 0x00, 0x0F,
-    0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00,
-    0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD2, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x0F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x07, 0xF0, 0x1F, 0xFC, 0x7F, 0x00, 0x3F, 0xD7, 0xF0, 0x02, 0xFE,
-    0x7F, 0x00, 0x3F, 0xE7, 0xF0, 0x0B, 0xFD, 0x7F, 0x47, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xF8, 0x07, 0xFC,
-    0x01, 0xFF, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x07, 0xFD, 0x02, 0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xD0,
-    0x7F, 0xFC, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0xFD, 0x00, 0x03, 0xFE, 0x0F, 0xC0, 0x00,
-    0x3F, 0xE0, 0xFE, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x03, 0xFE, 0x03,
-    0xFF, 0xD0, 0x3F, 0xE0, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xC3,
-    0xFF, 0x00, 0x03, 0xFD, 0x3F, 0xFE, 0x40, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x1B, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD,
-    0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1,
-    0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8,
-    0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B,
-    0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x00,
-    0xFF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x6F,
-    0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xC0,
-    0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE, 0x1F,
-    0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x2E, 0x03,
-    0xD0, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x1F, 0xFE, 0x3E, 0x00, 0x0B, 0xCF, 0xFF, 0x40, 0x03, 0xF0,
-    0xFF, 0xC0, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F,
-    0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00,
-    0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00,
-    0x0B, 0xFC, 0x0B, 0xFC, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x3F, 0xF4, 0x3F,
-    0xF4, 0x1F, 0xFE, 0x1F, 0xFD, 0x07, 0xFF, 0x8B, 0xFF, 0x80, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0,
-    0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F,
-    0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x02, 0xFB, 0xF0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE,
-    0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03, 0xFC, 0x0F,
-    0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x01, 0xFE,
-    0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0xFF, 0xF4,
-    0x0B, 0xF4, 0x07, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x7F, 0xFE, 0xAA, 0xBF,
-    0xD0, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xE0, 0x00, 0x1F, 0xFA, 0x54, 0x00, 0x01, 0xF4, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xE5, 0x5B, 0xFF,
-    0xFE, 0x00, 0x07, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00,
-    0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x78, 0x01, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x10, 0xBC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA,
-    0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFD, 0x07, 0xFC, 0x07,
-    0xFC, 0x00, 0x3F, 0x43, 0xFE, 0xAA, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFE, 0x55, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x02, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0xBF, 0x81, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x6F, 0xFE, 0x40, 0x01, 0x54, 0x01, 0x54, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0xBF, 0xC0,
-    0x3F, 0xF4, 0x3F, 0xF4, 0x0F, 0xFE, 0x0F, 0xFE, 0x03, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xF1, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01,
-    0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x40, 0x7F, 0xD0, 0x00, 0x1F, 0xF4,
-    0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0,
-    0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0xC1, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x03, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x07, 0xFD, 0x1F, 0xF4, 0xBF, 0xE2, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xBF, 0xD0,
-    0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x54, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xD0,
-    0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0xFF, 0xC6,
-    0xAA, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x55, 0x6F, 0xE5, 0x54, 0x00, 0x6F, 0x90, 0x7F, 0x00, 0x00,
-    0x1F, 0xFF, 0xF2, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xE0, 0x7F, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF8,
-    0x00, 0x0F, 0xFD, 0x2F, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x01, 0xF5, 0xFF, 0xF0, 0x00, 0x7D, 0x2F,
-    0xF4, 0x00, 0x0F, 0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x6F, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0x80, 0x2F, 0xF0, 0xBF, 0xC0, 0x03, 0xFC,
-    0x3F, 0xE0, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03,
-    0xFD, 0x3F, 0xE0, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0,
-    0x07, 0xFE, 0x7F, 0xF0, 0x02, 0xFF, 0xDF, 0xFC, 0x00, 0xBF, 0xFB, 0xFF, 0x00, 0x2F, 0xFC, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE,
-    0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF,
-    0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x0F, 0xF9,
-    0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xAF, 0xFC, 0x0B, 0xFD, 0x01, 0xFF, 0x83, 0xFE,
-    0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x2F, 0xEB,
-    0xFC, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0xFF, 0x82, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xC0,
-    0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x02, 0xFE, 0x7F,
-    0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xF8, 0x00, 0x1F,
-    0xFF, 0x3E, 0x00, 0x0B, 0xCF, 0xFF, 0x40, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0xBC, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xAF, 0xFC, 0x0B, 0xFD, 0x01,
-    0xFF, 0x83, 0xFE, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF0,
-    0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x8F,
-    0xFC, 0x00, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFC, 0x0B,
-    0xFC, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x3F, 0xF4, 0x3F, 0xF4, 0x0F, 0xFE,
-    0x1F, 0xFD, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1B,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xF5, 0xFF, 0xFE, 0x00, 0xFF, 0x8B, 0xFF, 0xFC, 0x03, 0xFC, 0x3F, 0xEF, 0xF4, 0x1F,
-    0xF0, 0xFF, 0x3F, 0xD0, 0x7F, 0xC7, 0xFC, 0xBF, 0x82, 0xFF, 0x2F, 0xE2, 0xFE, 0x07, 0xFC, 0xFF,
-    0x4F, 0xF8, 0x1F, 0xFB, 0xFC, 0x7F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFD,
-    0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x1F, 0xF0,
-    0xFE, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x3F,
-    0xF0, 0xFF, 0x40, 0x0F, 0xFD, 0x3F, 0xF4, 0x0B, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x06,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC7,
-    0xF8, 0x00, 0x1F, 0xF0, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xBF,
-    0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x03, 0xFF, 0x4F, 0xFD, 0x02,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x01, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F,
-    0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC,
-    0x3F, 0xC0, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0x54, 0x01, 0x54, 0x02, 0xFF, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0xFF, 0xC0, 0x3F, 0xF4, 0x3F, 0xF4, 0x0F, 0xFE, 0x0F, 0xFD, 0x03, 0xFF, 0x87, 0xFF,
-    0x81, 0xFF, 0xF2, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0,
-    0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F,
-    0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF,
-    0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00,
-    0x07, 0xFC, 0x1F, 0xF8, 0x00, 0x2F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFC,
-    0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x03,
-    0xFF, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x07,
-    0xFE, 0xFF, 0xF0, 0x7F, 0xC2, 0xFF, 0x87, 0xFC, 0x0B, 0xFC, 0x7F, 0xC0, 0x2F, 0xE7, 0xFC, 0x00,
-    0xFE, 0x7F, 0xC0, 0x0F, 0xE3, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x07, 0xFC, 0x3F,
-    0xC0, 0xFF, 0x83, 0xFC, 0x7F, 0xF0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0,
-    0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0xFF, 0x80, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0xBF, 0xF0,
-    0x02, 0xFF, 0xC2, 0xFF, 0xC0, 0x0F, 0xFF, 0x4F, 0xFF, 0x00, 0x15, 0x54, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xF8, 0x00, 0x2F, 0xE0, 0x3F, 0xF0,
-    0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x00, 0xFF, 0xC0, 0xFF,
-    0x40, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xAF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xEA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x9B,
-    0xFF, 0xC0, 0x7F, 0x40, 0x3F, 0xF0, 0x3F, 0x80, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0xFF, 0x03, 0xF0,
-    0x00, 0x2F, 0xD1, 0xF8, 0x00, 0x0B, 0xF4, 0xBE, 0x00, 0x01, 0xFE, 0x1F, 0x40, 0x00, 0x7F, 0x87,
-    0xE0, 0x00, 0x2F, 0xF1, 0xFE, 0x55, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFB, 0xFD, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x0A,
-    0x94, 0x02, 0xA8, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x0A, 0xA4, 0x01, 0xA8, 0x03, 0xFD, 0x01,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x03,
-    0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8, 0x7D, 0x00,
-    0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xF9, 0xBF, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x7F, 0xC0,
-    0x0F, 0xD0, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x02, 0xFD, 0x01, 0xF8, 0x00, 0x0B, 0xF4, 0x0B, 0xE0,
-    0x00, 0x1F, 0xE0, 0x1F, 0x40, 0x00, 0x7F, 0x80, 0x7E, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0x55, 0xBF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFB, 0xFD, 0x00, 0x0B, 0xFE, 0x47, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0xAA, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x1E, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFB, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0xAA, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0xBF,
-    0x80, 0xBF, 0xC0, 0xBF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x78, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0xAA, 0xF4,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x78,
-    0x02, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x7F, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFE, 0xAA, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x40, 0x5B, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFE, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x1E,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFE,
-    0x40, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC1, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0x00, 0x07, 0xFF, 0xF4, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F,
-    0xF0, 0x00, 0x00, 0x7F, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF7,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x01, 0xFF,
-    0xE7, 0xFF, 0x00, 0x16, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xE0,
-    0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x1F, 0xE4, 0x7F, 0xCF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0x40, 0x01, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFA, 0xAF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC5, 0x5B, 0xFF,
-    0x55, 0x40, 0x02, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF0, 0x01, 0x6F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x55,
-    0x7F, 0xD5, 0x50, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE4, 0x7F, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4,
-    0x2F, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x80, 0x07, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x7F,
-    0x40, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFA, 0xAF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55, 0xA0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xAF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE, 0x40, 0x02, 0xA9,
-    0x00, 0xAA, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x55,
-    0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95, 0x40, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFE,
-    0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x55,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xF5, 0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6F, 0xFE, 0x40, 0x06, 0xAA, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xD5, 0x56, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFD, 0x0F, 0xFA, 0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x0B, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xEA, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x0F, 0xF4, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF9, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xE9, 0x55, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x55, 0x5A, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0x80, 0x00,
-    0x6A, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xE1, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4,
-    0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA, 0xAA, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0x54, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0x50, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x02, 0xFE, 0x02,
-    0xFE, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x4B,
-    0xF8, 0x01, 0xFF, 0xFE, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFE, 0xFF, 0xFF, 0x42, 0xFC,
-    0x02, 0xFF, 0xF4, 0x3F, 0x40, 0x0F, 0xFF, 0x47, 0xF0, 0x00, 0x7F, 0xF4, 0x7E, 0x00, 0x03, 0xFF,
-    0x4B, 0xE0, 0x00, 0x3F, 0xF4, 0xBE, 0x00, 0x03, 0xFF, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x7F, 0x80,
-    0x1F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xA1, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x16, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x2F, 0xF5, 0x5F, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0x50, 0x06,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x01, 0xA9, 0x40, 0x2A, 0x40, 0xBF, 0x80,
-    0x2F, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x92, 0xFE, 0x01, 0xFF, 0xFE, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xEF, 0xFF, 0xF4, 0xBF, 0x00, 0xBF, 0xFD, 0x3F, 0x40, 0x0F,
-    0xFF, 0x5F, 0xC0, 0x01, 0xFF, 0xD7, 0xE0, 0x00, 0x3F, 0xF6, 0xF8, 0x00, 0x0F, 0xFD, 0xBE, 0x00,
-    0x03, 0xFF, 0x1F, 0xC0, 0x01, 0xFF, 0xC7, 0xF8, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xA1, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x38, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFE, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x16, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB, 0xEA,
-    0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF9, 0x00,
-    0x06, 0x90, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xA5, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x1F, 0xFF, 0xFA, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF4, 0x3F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xC2, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5, 0x00, 0x6F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x92, 0xFE, 0x01, 0xFF, 0xFE, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xEF, 0xFF, 0xF4, 0xBF, 0x00, 0xBF, 0xFD, 0x3F, 0x40, 0x0F, 0xFF, 0x5F, 0xC0, 0x01,
-    0xFF, 0xD7, 0xE0, 0x00, 0x3F, 0xF6, 0xF8, 0x00, 0x0F, 0xFD, 0xBE, 0x00, 0x03, 0xFF, 0x1F, 0xC0,
-    0x01, 0xFF, 0xC7, 0xF8, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xA1, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x38, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x16, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBE, 0xA5, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x69, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x1A, 0x50, 0x00, 0x07, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xA0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xFF, 0x50, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x2F, 0xE0, 0x1F, 0xFF, 0xEF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFE, 0xFF, 0xFF, 0x4B, 0xF0, 0x0B, 0xFF, 0xD3, 0xF4, 0x00,
-    0xFF, 0xF5, 0xFC, 0x00, 0x1F, 0xFD, 0x7E, 0x00, 0x03, 0xFF, 0x6F, 0x80, 0x00, 0xFF, 0xDB, 0xE0,
-    0x00, 0x3F, 0xF1, 0xFC, 0x00, 0x1F, 0xFC, 0x7F, 0x80, 0x1F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xBA, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x03, 0x80, 0x03,
-    0xFF, 0x00, 0xFF, 0xEF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x01, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x2F,
-    0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFD,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x01, 0xFF,
-    0xD3, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x7F, 0xFD, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0x81, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xFF, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0xBF,
-    0xF4, 0x02, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x0F,
-    0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x3A, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFE, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x03,
-    0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x0B, 0x80, 0xF4, 0xFF, 0xC3,
-    0xF3, 0xFF, 0xCF, 0xDF, 0x6F, 0xFE, 0xBC, 0x3F, 0xF6, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x2F, 0xF8,
-    0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x00, 0x0B, 0x90, 0xB8, 0x2F, 0xF4, 0xBC, 0x3F, 0xFC, 0xBC, 0x7D, 0x7F, 0xFC,
-    0x7D, 0x2F, 0xF8, 0x3E, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x55, 0xA4, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x2A, 0xAA, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xAF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFE, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC,
-    0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xF4,
-    0x0B, 0xFD, 0x02, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x3F, 0xFC, 0x0F, 0xFF, 0x07, 0xF4, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x01,
-    0xFF, 0xC0, 0x01, 0x50, 0x05, 0x50, 0x1F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF4, 0x2F, 0xF8, 0x2F, 0xF8, 0x0B, 0xF8, 0x2F, 0xF0, 0x3F, 0xC0,
-    0xBF, 0x40, 0xFF, 0x00, 0xFF, 0xFD, 0xBF, 0xFE, 0x2F, 0xFE, 0x02, 0xFD, 0x05, 0x50, 0x2F, 0xF0,
-    0x3F, 0xF0, 0x3F, 0xF4, 0x3F, 0xF4, 0x7F, 0xF8, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0,
-    0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8,
-    0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x15, 0x43, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
-    0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xDB, 0xFE,
-    0xBF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xCB, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xF1, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF8,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x0F,
-    0xFD, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0,
-    0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xE4,
-    0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x2F, 0x41, 0xFF, 0x00, 0x03, 0xF8, 0x2F, 0xF4, 0x00, 0x7F, 0xC2, 0xFF,
-    0x80, 0x07, 0xFC, 0x3F, 0xF8, 0x00, 0xBF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x07, 0xF8,
-    0x0F, 0xF0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0xFF, 0x00,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0xBF, 0x01,
-    0xFF, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0xBF, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xF4, 0x00,
-    0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xE0, 0x2F, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0xBB, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x15, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0x90, 0x7F, 0xFC, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x16, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x54,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x10, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x1F,
-    0xFD, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xDF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFA, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x8B, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xF8, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x02, 0xFE, 0x05, 0x54, 0x00, 0x2F, 0xD2, 0xFF, 0x40, 0x02, 0xFD, 0x7F, 0xE0,
-    0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xEF, 0xFF, 0x80, 0x07, 0xFD, 0x7F, 0xFF, 0x00, 0x7F, 0xD2,
-    0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0xF0, 0xBF, 0xE0, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01,
-    0x50, 0x55, 0x00, 0x1F, 0x83, 0xF8, 0x00, 0xBD, 0x2F, 0xC0, 0x02, 0xF5, 0xFD, 0x00, 0x0F, 0xCF,
-    0xF0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xBF, 0xF4, 0x00,
-    0xFE, 0x3F, 0xF4, 0x03, 0xF8, 0x7F, 0xF8, 0x0F, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xF4, 0x02,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x07, 0xFF, 0xF2, 0xFF, 0xFD, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xAA, 0xAB, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x00,
-    0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0x42, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xC0, 0x2F, 0xFF, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xD0,
-    0x0F, 0xFF, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0x01, 0xFF, 0x80,
-    0x1F, 0xE0, 0x1F, 0xF8, 0x01, 0xFE, 0x01, 0xFF, 0x80, 0x2F, 0xE0, 0x1F, 0xF8, 0x02, 0xFE, 0x02,
-    0xFF, 0x80, 0x3F, 0xD0, 0x2F, 0xF8, 0x03, 0xFD, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0xC1, 0xFE, 0x0B, 0xFC, 0x2F, 0xD0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x05, 0x50, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0xFF,
-    0x80, 0x2F, 0xF4, 0x1F, 0xF8, 0x02, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0xF8, 0x1F, 0xF8, 0x03, 0xFF,
-    0xC1, 0xFF, 0x80, 0x7F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xAA,
-    0xAB, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x05, 0x50, 0x3F, 0xD0,
-    0xFF, 0x83, 0xFC, 0x1F, 0xF8, 0x3F, 0xC1, 0xFF, 0xC3, 0xFC, 0x2F, 0xFC, 0x3F, 0xC3, 0xFF, 0xC3,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0xAA, 0xBF,
-    0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x87, 0xFC,
-    0x00, 0x01, 0x6F, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x6A, 0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD,
-    0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0,
-    0xFF, 0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF,
-    0x9F, 0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03,
-    0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC6, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF4, 0x2F, 0xF8, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x3F,
-    0xC3, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0xFF, 0x4F, 0xF8, 0x00,
-    0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xF0, 0x01, 0xFF, 0x9F, 0xFC,
-    0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x2F, 0xFD, 0xFF, 0xC0, 0x0B, 0xFF, 0xBF, 0xF0, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6A, 0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F,
-    0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC,
-    0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F,
-    0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0x01, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF,
-    0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF1, 0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F,
-    0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x7F, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x06, 0xAA, 0x00, 0x00, 0x3F, 0xD0, 0x7F,
-    0xF8, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0xBF, 0xFD, 0x00, 0x07, 0xFC, 0x0B,
-    0xFF, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0x40, 0x0B, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xC0,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x0F, 0xFE, 0xFF, 0xC0, 0xFF, 0xC1, 0xFF, 0xDB, 0xFC, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xE0, 0xFF,
-    0xC1, 0xFF, 0xE3, 0xFF, 0x0F, 0xF8, 0x2F, 0xFE, 0x1F, 0xF9, 0xFF, 0x82, 0xFF, 0xE0, 0xFF, 0xEF,
-    0xF8, 0x2F, 0xFE, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFE, 0x02, 0xFF,
-    0xFF, 0x43, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x07,
-    0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x06, 0xA0, 0x00,
-    0x1A, 0x80, 0x2F, 0xD0, 0x0F, 0xF4, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC6, 0xFE, 0x80,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8,
-    0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4,
-    0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFE, 0x00,
-    0x0F, 0xF8, 0x3F, 0xF0, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x1F, 0xF8, 0x7F, 0xF0, 0x02, 0xFF, 0xC7,
-    0xFF, 0x00, 0x2F, 0xFC, 0xBF, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF1, 0xBF, 0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFE, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F,
-    0xE0, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x7F, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x6A,
-    0xA0, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0xBF, 0xFC, 0x00, 0x07, 0xFD, 0x0B,
-    0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xC0,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xDF, 0xFC, 0x0F, 0xFC, 0x1F, 0xFD, 0xBF, 0xC0, 0xFF,
-    0xC1, 0xFF, 0xE3, 0xFE, 0x0F, 0xFC, 0x1F, 0xFE, 0x3F, 0xF0, 0xFF, 0x82, 0xFF, 0xE1, 0xFF, 0x9F,
-    0xF8, 0x2F, 0xFE, 0x0F, 0xFE, 0xFF, 0x82, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFE, 0x03, 0xFF,
-    0xFF, 0x83, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x1A, 0xFA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xBF,
-    0xA0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFE,
-    0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x4F,
-    0xF4, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0xFF,
-    0x8F, 0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF, 0x7F, 0xF0, 0x02,
-    0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00,
-    0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x02, 0xAF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x01, 0xA8, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0x00,
-    0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0xFF,
-    0xF9, 0x45, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x01, 0xA8, 0x03, 0xFD, 0x00, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xEB, 0xFF, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x5F,
-    0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0xFF,
-    0x9F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x3F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF,
-    0x80, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xD0, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0,
-    0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE9, 0x54, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x9A, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x02, 0xFE, 0x40, 0x00,
-    0x7F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xF4,
-    0x07, 0xFF, 0xFD, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x0F,
-    0xFF, 0xAA, 0xBF, 0xF1, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x0F, 0xFE, 0x55, 0x00,
-    0x01, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x47, 0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00,
-    0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF,
-    0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC,
-    0x2A, 0xA9, 0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF5, 0xBF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0x41, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x47,
-    0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF8,
-    0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x2A, 0xA9, 0x00, 0xAA, 0xA8, 0x07,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD6, 0xFC,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0x04, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01,
-    0xFE, 0x00, 0x07, 0xFD, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xAF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0x47, 0xFF, 0x40, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0xFF, 0xF0, 0x3F, 0xFD, 0x00,
-    0xFF, 0xF8, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x2A, 0xA9, 0x00, 0xAA,
-    0xA8, 0x2F, 0x80, 0x00, 0xBE, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x6F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xD0,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40, 0x6C, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x07, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x3F, 0xEA,
-    0xFF, 0x00, 0x0F, 0xD0, 0x01, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF0, 0x01, 0x00, 0x0B, 0xFE, 0x02, 0xE0, 0x02, 0xFF, 0x81, 0xFF, 0xEA, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x6B, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x01,
-    0xB0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x03, 0xE0, 0x00,
-    0x02, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x16, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFE,
-    0xAF, 0xF0, 0x00, 0xFD, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x10, 0x00, 0xBF, 0xE0, 0x2E, 0x00, 0x2F, 0xF8, 0x1F, 0xFE, 0xAF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x1B, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x3E, 0x00, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFA, 0xBF, 0xC0, 0x03, 0xF4, 0x00, 0x50, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x40, 0x02, 0xFF, 0x80, 0x78, 0x00, 0xBF,
-    0xE0, 0x7F, 0xFA, 0xBF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x29, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xF4, 0x06, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x0F, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x7F, 0xFD, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x5B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x3F, 0x40, 0x05, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x04, 0x00, 0x2F,
-    0xF8, 0x0B, 0x80, 0x0B, 0xFE, 0x07, 0xFF, 0xAB, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xAF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x97, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x6F, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xAA,
-    0xFF, 0xAA, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xA6,
-    0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0x5B, 0xD0, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x01, 0x54, 0x00,
-    0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0x40, 0x2F, 0xE0, 0x01, 0xBD, 0x00, 0xBF,
-    0x80, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xAB, 0xFE, 0xAA, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x99, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x15, 0x6F, 0xFD, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x0A, 0xAF, 0xFA, 0xA8, 0x00, 0x1F, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x55, 0x7F, 0xF5, 0x54,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0x64, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x5F, 0x00,
-    0x00, 0x00, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82,
-    0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x3F, 0xF0, 0xFC, 0x00, 0x1F, 0xFF, 0x3E, 0x00, 0x0B, 0xCB,
-    0xFF, 0x80, 0x02, 0xF0, 0xFF, 0xD0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F,
-    0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xFC, 0x00,
-    0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0xFF, 0xD3, 0xFF,
-    0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x06, 0xAF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x56, 0xA4, 0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xF8, 0x2A,
-    0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07,
-    0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF0, 0xFE, 0x00,
-    0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF,
-    0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x03, 0xFF, 0x4F, 0xFD, 0x02, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x6A, 0x50, 0x0A, 0x90, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F,
-    0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFF,
-    0x95, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00,
-    0x7F, 0xC7, 0xF8, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0x0F, 0xE0,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x03, 0xFF, 0x0F,
-    0xF4, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFB,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF8, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00,
-    0x3E, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFD, 0x00,
-    0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x1F, 0xF0, 0xFE,
-    0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x3F, 0xF0,
-    0xFF, 0x40, 0x0F, 0xFD, 0x3F, 0xF4, 0x0B, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x06, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x00,
-    0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC,
-    0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF,
-    0xFE, 0xAB, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF8,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x03,
-    0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFD, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x02, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC3, 0xFF,
-    0x80, 0x00, 0x2F, 0xF8, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x2F,
-    0xFF, 0xEA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xBF, 0x40, 0x00, 0xFF,
-    0x1F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x1F, 0xF1, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01,
-    0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0xC3, 0xF8, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0x80, 0x1F, 0xFD, 0x2F,
-    0xFD, 0x5F, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE6, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xF0,
-    0x0B, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x0F, 0xFF, 0x41, 0xFF, 0xFF, 0x02, 0xFF,
-    0xC0, 0x02, 0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x3F, 0xFF, 0xFF, 0x5F, 0xFD, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0x01,
-    0x40, 0x0B, 0xFC, 0x1F, 0xF4, 0x0B, 0xF0, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF4, 0x0F,
-    0xFC, 0x3F, 0xFC, 0x2F, 0xF0, 0x0B, 0xFC, 0x7F, 0xFE, 0x3F, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xBF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFD, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE,
-    0x00, 0x00, 0x2A, 0x90, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x00,
-    0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00,
-    0x00, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x1F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0x80, 0xFF, 0xC0,
-    0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x02, 0xFF, 0x40, 0xBF, 0x80, 0x03, 0xFF, 0x03, 0xFD,
-    0x00, 0x0B, 0xFE, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF4,
-    0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x45, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00,
-    0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x03,
-    0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x1F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xAA, 0xAA, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xAA, 0xAB, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xAA, 0xAA, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xAA, 0xAB, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1A, 0xAA, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x55, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x06, 0xA0, 0x00, 0x1A, 0x80, 0x3F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x01, 0xAA, 0xAB, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF5, 0x55, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0x90, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x3F, 0xF9, 0x10, 0xFF,
-    0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
-    0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x0B, 0xFF, 0x00,
-    0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x03, 0xF4, 0x2F, 0xC0, 0xFE, 0x0B,
-    0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x3F, 0xD0, 0x03, 0xFC, 0x15, 0x00,
-    0x00, 0x54, 0x0B, 0xD0, 0xBC, 0x2F, 0xF4, 0xBC, 0x3F, 0xFD, 0xBC, 0x7D, 0x7F, 0xFC, 0x7D, 0x2F,
-    0xF4, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x0A, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFE, 0xAA, 0xA4, 0x00, 0x00, 0x15, 0x56, 0xA8, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x50, 0x0A, 0x97, 0xF8, 0x02, 0xFD, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xF0, 0xBF, 0xC3, 0xFF, 0x0F, 0xFD, 0x7F,
-    0xF5, 0xFF, 0xE1, 0x55, 0x40, 0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83,
-    0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x3E, 0x03, 0xFC, 0x01, 0xD0, 0x7C,
-    0x1F, 0x42, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x1F, 0xF0, 0x3F, 0xFC, 0x7D, 0xBC, 0x7D, 0xBD, 0x3F,
-    0xFC, 0x2F, 0xF8, 0x0B, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x0F,
-    0xF4, 0x1F, 0xF4, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x07, 0xFF, 0xD0, 0x3F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0xFF, 0xE0,
-    0x0F, 0xFF, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0x7F, 0xFD, 0x03,
-    0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD,
-    0x03, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x3F, 0xFE, 0x01, 0xFF, 0xE0, 0x0F, 0xFE, 0x00,
-    0xFF, 0xF0, 0x0B, 0xFF, 0x40, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x3F, 0x5F, 0xFD, 0x7F, 0xF5, 0xFF, 0xD0, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07,
-    0xF0, 0x1F, 0xFD, 0x7F, 0xF5, 0xFF, 0xD7, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xA9, 0x50, 0x07,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x07, 0xF0, 0xBF, 0xC3, 0xFD, 0x0B, 0xE0, 0x0D, 0x00, 0x00, 0x02, 0xE2, 0xF8,
-    0xFD, 0x7D, 0x1F, 0xE3, 0xF8, 0x3E, 0x00, 0x00, 0x02, 0xA0, 0x03, 0xF0, 0x03, 0xF0, 0x7F, 0xFF,
-    0x7F, 0xFF, 0x7F, 0xFF, 0x15, 0x55, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x17, 0xF5, 0x07, 0xF0,
-    0x07, 0xF0, 0x01, 0x00, 0x2C, 0x00, 0xB0, 0x3F, 0xFC, 0x5F, 0x50, 0x2C, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x1A, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFE, 0xAA, 0x94, 0x05, 0x50, 0x1F, 0xF4, 0x1F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x7F,
-    0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x01, 0x40, 0x1F, 0xF0, 0x3F, 0xFC, 0x7D, 0xBC, 0x7D, 0xBD,
-    0x3F, 0xFC, 0x2F, 0xF8, 0x0B, 0xE0, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0xFF, 0xF0,
-    0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x40, 0x0F,
-    0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x10, 0xFC, 0x3F, 0xFC, 0x7F, 0xF4, 0xBF,
-    0xD0, 0x00, 0x68, 0x00, 0xBF, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xFF,
-    0xF0, 0xFF, 0xFD, 0x0F, 0xFF, 0x40, 0x6F, 0xC0, 0x3F, 0xC3, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xC7,
-    0xFC, 0xBF, 0xCB, 0xFC, 0xBF, 0xCA, 0xA8, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x0F, 0xF0, 0x3F, 0xD0,
-    0x00, 0x7F, 0xD0, 0xFF, 0x80, 0x2F, 0xF4, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF9,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x1F, 0x47, 0xFF, 0x07, 0xE2, 0xFF, 0xF1, 0xF8, 0xFD, 0xFF, 0xBD, 0x3F, 0x1F, 0xFF,
-    0x4F, 0xC2, 0xFF, 0xC3, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x3F, 0xFF,
-    0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x0A, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFE, 0xAA,
-    0x94, 0x07, 0xF4, 0x1F, 0x47, 0xFF, 0x07, 0xE2, 0xFF, 0xF1, 0xF8, 0xFD, 0xFF, 0xBD, 0x3F, 0x1F,
-    0xFF, 0x4F, 0xC2, 0xFF, 0xC3, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x2E, 0x0B, 0xF2, 0xFE,
-    0x0F, 0xEF, 0xFB, 0xF6, 0xF8, 0x64, 0x00, 0x00, 0x54, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F,
-    0x40, 0xFE, 0x3F, 0x40, 0xFE, 0x3F, 0x40, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFE, 0x15, 0x55, 0x54, 0x0B, 0xEB, 0xD0, 0xFF, 0xFF, 0xC7, 0xEF, 0xFF, 0x5F, 0x2F, 0x7E, 0xBC,
-    0xBC, 0xBA, 0xE2, 0xF2, 0xEB, 0x8B, 0xCB, 0x40, 0x00, 0x00, 0x0F, 0x0F, 0x01, 0xEF, 0x00, 0x2F,
-    0x40, 0x0B, 0xD0, 0x07, 0xFC, 0x07, 0xCB, 0xC2, 0x90, 0xA4, 0x0B, 0xD0, 0xBC, 0x2F, 0xF4, 0xBC,
-    0x3F, 0xFD, 0xBC, 0x7D, 0x7F, 0xFC, 0x7D, 0x2F, 0xF4, 0x3E, 0x07, 0xD0, 0x00, 0x0B, 0x80, 0xBF,
-    0x0B, 0xF8, 0x7F, 0xC7, 0xF8, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1,
-    0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x2A, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x0F, 0xF0, 0x05, 0x5A, 0xAF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFD, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFA, 0xAA, 0x94, 0x1A, 0x40, 0x6A, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC,
-    0x0F, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xC7, 0xFC, 0x0F, 0xF1, 0xFF,
-    0x07, 0xFC, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x1A, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0x1F, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xDF, 0xD2, 0xFF, 0xFF, 0xFF, 0x4F, 0xE2, 0xFF, 0xFC, 0x3F, 0x83, 0xFF,
-    0xE0, 0xBF, 0x1F, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x02, 0xAA, 0x40, 0x3F, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFE, 0x3F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0x42, 0xFF, 0xF2, 0xF4, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0x50, 0x0F, 0xFF,
-    0xD0, 0x3F, 0xC2, 0xFF, 0xFF, 0x83, 0xFC, 0x3F, 0xD3, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F, 0xFF, 0xF8,
-    0x2F, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x01, 0x50, 0x0F, 0xFF, 0xD0, 0x3F, 0xC2, 0xFF, 0xFF, 0x43, 0xFC, 0x3F, 0xC7, 0xFD, 0x7F, 0xC7,
-    0xFC, 0x1F, 0xFF, 0xF8, 0x2F, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x80, 0x00, 0xFF, 0x4B, 0xA0, 0x01,
-    0xBC, 0x7F, 0xC0, 0x00, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x83,
-    0xF8, 0x34, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0xF8, 0x00,
-    0x00, 0x07, 0xFE, 0x01, 0xFF, 0xFF, 0xAB, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x0A, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x5A, 0xA5, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF9, 0x00, 0x01, 0xBF, 0xF4, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0x90, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0x95, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x02, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF,
-    0xC1, 0xFF, 0xC0, 0x07, 0xFF, 0x4B, 0xFF, 0x40, 0x2F, 0xFD, 0x2F, 0xFD, 0x00, 0x55, 0x50, 0x55,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF5, 0x55, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x2A, 0xAA, 0xFF, 0xEA, 0xAA, 0xA5, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x05, 0xBF, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x2F, 0xFE,
-    0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF4, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0x0B,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0x93, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x55, 0x55,
-    0x50, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x40,
-    0x06, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x1B,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x3E, 0x00, 0x00,
-    0x2F, 0xFD, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F,
-    0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x1A, 0x80, 0x6A,
-    0x0F, 0xF4, 0x3F, 0xD3, 0xFD, 0x0F, 0xF4, 0xFF, 0x83, 0xFE, 0x7F, 0xE1, 0xFF, 0xAF, 0xFC, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0x90,
-    0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x16, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xA0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x0B, 0xF9, 0x6F, 0xFF,
-    0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF8, 0x03,
-    0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xC0,
-    0x02, 0xFD, 0x01, 0xFF, 0xD0, 0x1F, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x5B, 0xFF, 0xCF, 0xF0,
-    0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x0F, 0xF0, 0x07, 0xFF,
-    0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD3, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xAA, 0x55, 0xFF, 0xE5, 0xAA, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0x40,
-    0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xE0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40,
-    0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x1F, 0xFD, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0xC0,
-    0x00, 0x07, 0xFD, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xDF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFA, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x8B, 0xFF, 0xFC, 0x00, 0x3F, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x07, 0xFF, 0xFF, 0x43, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x0A, 0xA9, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x3F,
-    0xFE, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0x00, 0x0F,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B,
-    0xFF, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x2F, 0xF0, 0x2F, 0xF7, 0xFF, 0x42, 0xFF, 0x43,
-    0xFF, 0x7F, 0xF4, 0x2F, 0xF4, 0xBF, 0xD7, 0xFF, 0x82, 0xFF, 0x4F, 0xFC, 0x7F, 0xF8, 0x1F, 0xF5,
-    0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xBF, 0xF0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xC1, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0xBF, 0xFC, 0x0F,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x01, 0xA8, 0x00, 0x2A, 0x40, 0x07, 0xFD, 0x57, 0xFD, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x0F,
-    0xF0, 0x0B, 0xFD, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF8, 0x0F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0xBF, 0xE3, 0xFE, 0x00, 0x00, 0xFF, 0xDF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0xFA, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x3F, 0xD3, 0xFE,
-    0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00,
-    0x3F, 0xD3, 0xFE, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF4,
-    0xFF, 0x80, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03,
-    0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0xFF, 0xD5, 0x55, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x3F,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF,
-    0x80, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x5F, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x80,
-    0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF4,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x1F, 0xF5, 0x40, 0x00, 0x7F, 0xFF, 0xF9, 0x01, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xF0, 0x02, 0xFC, 0x3F, 0xC0, 0x03, 0xF8, 0xFF, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x3F, 0x8F,
-    0xF0, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0xBE, 0x00, 0x1F, 0xF0, 0xBE, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x03, 0xF4, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xF0, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0x0B, 0xF8, 0xBE, 0x00, 0x02, 0xFC, 0xBE, 0x00,
-    0x00, 0xFE, 0xBE, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x03, 0xFE, 0xBF, 0x55, 0xAF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x01,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF9, 0x50, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x55, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xE0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x0F, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x0B, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x4B, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xCF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 0xFF, 0xCB, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x06, 0xBF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xEA, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xE4, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x56, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x0B, 0xFD, 0xB9, 0x01, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xAA, 0x90, 0x3F, 0xE0, 0x00, 0x1F, 0xFE, 0x03,
-    0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x7F, 0xFF, 0x03, 0xFE, 0x00, 0x0B, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF, 0xFF,
-    0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x2F, 0xF0, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0x02, 0xFF, 0x7F,
-    0xF4, 0x2F, 0xF4, 0x3F, 0xF7, 0xFF, 0x42, 0xFF, 0x4B, 0xFD, 0x7F, 0xF8, 0x2F, 0xF4, 0xFF, 0xC7,
-    0xFF, 0x81, 0xFF, 0x5F, 0xF8, 0x7F, 0xF8, 0x1F, 0xFB, 0xFF, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFC, 0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0xBF, 0xFC, 0x0F, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0xBF, 0xFC, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0A, 0xA9, 0x03, 0xFE, 0x00, 0x01, 0xFF,
-    0xE0, 0x3F, 0xE0, 0x00, 0x3F, 0xFE, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0xBF,
-    0xFF, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x2F, 0xF0, 0x2F,
-    0xF7, 0xFF, 0x42, 0xFF, 0x43, 0xFF, 0x7F, 0xF4, 0x2F, 0xF4, 0xBF, 0xD7, 0xFF, 0x82, 0xFF, 0x4F,
-    0xFC, 0x7F, 0xF8, 0x1F, 0xF5, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xBF, 0xF0, 0x7F, 0xFC, 0x1F, 0xFF,
-    0xFE, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xD0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFC, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x0F,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x7F, 0xF8, 0x00,
-    0x03, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x3F, 0xFC, 0x00,
-    0x00, 0x7F, 0xDB, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xFF, 0xAF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x83,
-    0xFF, 0xFF, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x3F, 0xF8,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xF5, 0x6F, 0xF4, 0x01, 0xFF, 0x80, 0x7F,
-    0xD0, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x1F, 0xF8, 0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x1F, 0xF4, 0x02,
-    0xFF, 0x40, 0x7F, 0xD0, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0x2F, 0xF0, 0x0B, 0xFD, 0x00, 0xFF, 0xC0,
-    0x2F, 0xF4, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x0B, 0xFD,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x1F, 0xF8, 0x03, 0xFF, 0x47, 0xFF,
-    0xE0, 0x0F, 0xFD, 0x2F, 0xFF, 0x40, 0x3F, 0xF4, 0xFF, 0xFC, 0x00, 0xFF, 0xD3, 0xFF, 0x80, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x05, 0x54, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x2F, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x40,
-    0x0B, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0xFF, 0xBF, 0xE3, 0xFF, 0xFF, 0xC3,
-    0xFD, 0xFF, 0xDF, 0xFA, 0xFF, 0x0F, 0xF6, 0xFF, 0xFF, 0xDF, 0xFC, 0x7F, 0xD7, 0xFF, 0xFF, 0x3F,
-    0xF1, 0xFF, 0x8F, 0xFF, 0xF8, 0xFF, 0xC7, 0xFE, 0x2F, 0xFF, 0xD3, 0xFF, 0x1F, 0xF8, 0x7F, 0xFF,
-    0x0F, 0xFC, 0x7F, 0xE0, 0xFF, 0xF8, 0x3F, 0xF1, 0xFF, 0x82, 0xFF, 0xD0, 0xFF, 0xC7, 0xFE, 0x07,
-    0xFF, 0x03, 0xFF, 0x1F, 0xF8, 0x05, 0x54, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF1, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC2, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x0F,
-    0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00,
-    0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x01, 0xFF, 0xD3, 0xFF, 0xD5, 0x55, 0x6F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x7F,
-    0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x94, 0x5B,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFD, 0x00, 0x0B, 0xFC, 0x7F,
-    0xD0, 0x00, 0x7F, 0xC7, 0xFD, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x0B,
-    0xFC, 0x7F, 0xD0, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0xBF, 0xC7, 0xFD,
-    0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xBF,
-    0xC7, 0xFE, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0B, 0xFC, 0x7F, 0xE0,
-    0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x0B, 0xFC,
-    0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x02,
-    0xFE, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x7F, 0xE5, 0x5B, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD4, 0x05, 0xB4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x0A,
-    0xA0, 0xFF, 0x80, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x0B,
-    0xFD, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x0F, 0xF0, 0x00, 0x7F, 0xF0,
-    0x7F, 0xC0, 0x00, 0xFF, 0xE3, 0xFE, 0x00, 0x01, 0xFF, 0xDF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xF9, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xAF, 0xFE, 0xAF, 0xF0, 0x3F, 0x40, 0xFF, 0xC0, 0x3F, 0x87, 0xD0,
-    0x0F, 0xFC, 0x01, 0xFC, 0xBC, 0x00, 0xFF, 0xC0, 0x0F, 0xCB, 0xE0, 0x0F, 0xFC, 0x01, 0xFC, 0x7F,
-    0x80, 0xFF, 0xC0, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xFF, 0xE9, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
-    0xD0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x00, 0x7F,
-    0xFD, 0x2F, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0x00,
-    0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x03,
-    0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x01, 0xFF, 0x01,
-    0xFF, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x7F, 0xD0,
-    0x01, 0xFF, 0x41, 0xFF, 0x40, 0x07, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x3F,
-    0x40, 0x03, 0xFC, 0x3F, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7E,
-    0x00, 0x03, 0xFC, 0x7D, 0x00, 0x03, 0xFC, 0xBD, 0x00, 0x03, 0xFC, 0xBD, 0x00, 0x07, 0xFC, 0xBF,
-    0x00, 0x0F, 0xFC, 0xBF, 0x80, 0x7F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFE, 0xFC, 0x03, 0xFF, 0xF1, 0xFC, 0x00, 0x15, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x7F,
-    0xD0, 0x15, 0x40, 0x7F, 0xC7, 0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC7,
-    0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC7, 0xFD, 0x03, 0xFE, 0x07, 0xFC,
-    0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC7, 0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xE0, 0x3F,
-    0xC7, 0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC7, 0xFC, 0x03, 0xFE, 0x03,
-    0xFC, 0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC7, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x2F, 0xD0,
-    0x3F, 0xC7, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC7, 0xFC, 0x02, 0xFD,
-    0x03, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x6A, 0x90,
-    0x00, 0x00, 0x6A, 0x80, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0,
-    0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0,
-    0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0,
-    0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC0,
-    0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x5A, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF9, 0x6B, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x7F, 0xE0,
-    0x00, 0x7F, 0x40, 0x0B, 0xF8, 0x00, 0x1F, 0xD0, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x80,
-    0x01, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD1, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x07, 0xFD, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xE1, 0xFE, 0x5A, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x7F, 0x40,
-    0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x1F, 0xD0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x87, 0xF4, 0x00, 0xBF,
-    0xC0, 0x00, 0xBF, 0xF1, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFC, 0x7F, 0x40, 0x7F, 0xF8, 0x00,
-    0x0B, 0xFF, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xCB, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xA0, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0x96, 0xBF,
-    0xF1, 0xFD, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0xBF, 0x9F, 0xD0, 0x02, 0xFF, 0x7F, 0x40, 0x0F, 0xF9,
-    0xFD, 0x01, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x90, 0x6F, 0xFD, 0x00, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2A,
-    0x90, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x55, 0x55, 0x5B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xFD, 0x00, 0x0B, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xBF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x02,
-    0xFF, 0x90, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0x03, 0xFF, 0x41, 0xBF, 0xD2, 0xFC, 0x2F, 0xF4, 0x00, 0xBF, 0x8B,
-    0xF0, 0xFF, 0x80, 0x00, 0xFF, 0x2F, 0xC3, 0xFC, 0x00, 0x02, 0xFC, 0xBF, 0xEF, 0xF0, 0x00, 0x07,
-    0xF6, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xDB, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x6F, 0xFF, 0xF8, 0x00,
-    0x01, 0xFE, 0xBF, 0xFF, 0xF0, 0x00, 0x07, 0xF6, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xDB, 0xE0, 0xFF,
-    0x80, 0x00, 0xFF, 0x6F, 0x83, 0xFF, 0x80, 0x0F, 0xFC, 0x7E, 0x0F, 0xFF, 0xFB, 0xFF, 0xF1, 0xF8,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x47, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x7E, 0x00, 0x7F, 0xFF, 0xFD, 0x01, 0xF4, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xAF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD5, 0x5F, 0xF0,
-    0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x03,
-    0xFD, 0x00, 0x0B, 0xF4, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF,
-    0xFA, 0xAF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xD1, 0xBF, 0xFC, 0x02, 0xFF, 0x80, 0x3F,
-    0xFC, 0x03, 0xFF, 0x40, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFF, 0x40, 0x3F, 0xFC, 0x1F, 0xFF, 0x40, 0x3F, 0xFD, 0x2F, 0xFF, 0x40, 0x3F, 0xFD, 0x3F,
-    0xFF, 0x40, 0x7F, 0xFD, 0x2A, 0xAA, 0x00, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4,
-    0x03, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F,
-    0x80, 0x00, 0xBF, 0x4B, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF,
-    0x1F, 0xE5, 0x5B, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x06, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x6F, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xE5,
-    0xBF, 0xFC, 0x7F, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xF3,
-    0xFF, 0x00, 0x07, 0xFF, 0x3F, 0xF0, 0x00, 0xBF, 0xE2, 0xFF, 0xD0, 0x2F, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFA, 0xAF, 0xF4, 0x1F, 0xC0, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0x81, 0xFC, 0x00, 0xFD, 0x07, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC1, 0xFC, 0x00, 0xBF, 0x87, 0xF0, 0x00,
-    0xBF, 0x1F, 0xC0, 0x02, 0xFC, 0x7F, 0x55, 0x6F, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xAA, 0xAA, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xE0, 0xBF, 0xC0, 0x00, 0x1F, 0xE0, 0xBF, 0xC0, 0x00, 0x2F, 0xE0, 0xBF, 0xC0, 0x00,
-    0x2F, 0xD0, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x40, 0x7F, 0xC0, 0x5B, 0xFF, 0x95,
-    0xBF, 0xE5, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x0A, 0xA0, 0x00, 0x0A, 0xA4, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA, 0xAA, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0x54, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0xAA, 0x90, 0x1A, 0xAA, 0x00, 0x6A, 0xA0, 0x00, 0x0B, 0xFF, 0x01, 0xFF, 0xF0,
-    0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0xFF,
-    0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0xFF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xCB, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xBF, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x5F, 0xFF,
-    0x5F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD2, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF4, 0x2F,
-    0xFF, 0x82, 0xFF, 0xFF, 0x80, 0x00, 0x10, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xFD, 0x09, 0x00, 0xBC,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x1A, 0xBF, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x1F,
-    0xD0, 0x00, 0x1F, 0x86, 0x40, 0xFE, 0x2F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x06, 0xFF,
-    0x90, 0x7F, 0x80, 0x01, 0xFF, 0x47, 0xF8, 0x00, 0x3F, 0xF8, 0x7F, 0x80, 0x0B, 0xFF, 0x87, 0xF8,
-    0x01, 0xFF, 0xF8, 0x7F, 0x80, 0x3F, 0xFF, 0x87, 0xF8, 0x0B, 0xFF, 0xF8, 0x7F, 0x80, 0xFF, 0xFF,
-    0x87, 0xF8, 0x3F, 0xF7, 0xF8, 0x7F, 0xCB, 0xFD, 0x7F, 0x87, 0xFC, 0xFF, 0xC7, 0xFC, 0x7F, 0xFF,
-    0xF0, 0x7F, 0xC7, 0xFF, 0xFE, 0x0B, 0xFC, 0x7F, 0xFF, 0xC0, 0xBF, 0xC7, 0xFF, 0xF0, 0x0B, 0xFC,
-    0x7F, 0xFE, 0x00, 0xBF, 0xC7, 0xFF, 0xC0, 0x0F, 0xFC, 0x7F, 0xF4, 0x00, 0xFF, 0xC6, 0xAA, 0x00,
-    0x0A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x2F, 0xE5, 0x6F, 0xF0, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x6A, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x0F, 0xD0, 0x0F, 0xF8, 0x0B, 0xD0,
-    0x1F, 0xF8, 0x0B, 0xD0, 0x3F, 0xFC, 0x0B, 0xE0, 0x3F, 0xFC, 0x0B, 0xE0, 0xBF, 0xFC, 0x07, 0xE0,
-    0xFE, 0xFC, 0x07, 0xF2, 0xFA, 0xFC, 0x07, 0xF3, 0xF2, 0xFC, 0x07, 0xFB, 0xE3, 0xFD, 0x07, 0xFF,
-    0xC3, 0xFD, 0x03, 0xFF, 0xC3, 0xFD, 0x03, 0xFF, 0x43, 0xFE, 0x03, 0xFF, 0x03, 0xFE, 0x03, 0xFD,
-    0x03, 0xFF, 0x07, 0xF4, 0x2F, 0xF0, 0x02, 0xFC, 0x0F, 0xF4, 0x00, 0xBF, 0x0F, 0xF8, 0x00, 0x3F,
-    0xCB, 0xFC, 0x00, 0x0F, 0xF3, 0xFD, 0x00, 0x03, 0xFB, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xDF, 0xFF, 0x40, 0x0F, 0xF0, 0xFF, 0xF8, 0x03, 0xFC, 0x0F,
-    0xFF, 0xC1, 0xFF, 0x01, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC,
-    0x0B, 0xF0, 0x7F, 0x02, 0xFC, 0x1F, 0xC0, 0xBF, 0x07, 0xF0, 0x2F, 0x81, 0xFC, 0x0B, 0xE0, 0xBF,
-    0x03, 0xF8, 0x2F, 0xC0, 0xFD, 0x0B, 0xF0, 0x3F, 0x42, 0xFC, 0x0F, 0xD0, 0xBF, 0x03, 0xF0, 0x2F,
-    0xC7, 0xFC, 0x0B, 0xF3, 0xFF, 0x03, 0xFC, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0x43, 0xFF, 0x40, 0x0F, 0xFD, 0x0F, 0xFF, 0x00, 0x3F,
-    0xF4, 0x3F, 0xFC, 0x02, 0xFF, 0xE0, 0xFF, 0xF8, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0x7F, 0xFE, 0x0F,
-    0xFF, 0xD3, 0xFF, 0xF8, 0x7F, 0xBF, 0xCF, 0xEF, 0xE1, 0xFD, 0xFF, 0xFF, 0x7F, 0x87, 0xF6, 0xFF,
-    0xFD, 0xFF, 0x1F, 0xD7, 0xFF, 0xE7, 0xFC, 0x7F, 0x8F, 0xFF, 0x5F, 0xF1, 0xFE, 0x2F, 0xFC, 0xBF,
-    0xC7, 0xF8, 0x3F, 0xF2, 0xFF, 0x2F, 0xF0, 0xFF, 0x4B, 0xFC, 0xBF, 0xC1, 0xFC, 0x3F, 0xF2, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x1A, 0x80, 0x00, 0x2A, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00,
-    0x7F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x0B,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xAA, 0xFF, 0xD3, 0xFF, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF,
-    0xD7, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFE, 0xBF, 0xF0, 0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0xFC,
-    0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0xBF, 0xAF, 0xF0, 0x00, 0x2F, 0xE7,
-    0xFC, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xF5, 0xFF, 0x95, 0x57, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x3F, 0xE7,
-    0xFC, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x3F,
-    0xE7, 0xFD, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x9F, 0xF4, 0x00,
-    0x3F, 0xE7, 0xFD, 0x00, 0x0F, 0xF9, 0xFF, 0x40, 0x07, 0xFF, 0x7F, 0xD0, 0x01, 0xFF, 0xDA, 0xA4,
-    0x00, 0x2A, 0xA0, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x2F, 0xE7, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xE0, 0x0F, 0xFF, 0x00, 0x0F, 0xC0,
-    0x3F, 0xF8, 0x00, 0x2F, 0x80, 0xFF, 0xD0, 0x00, 0xBE, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x0F, 0xFD,
-    0x00, 0x07, 0xF0, 0x3F, 0xF8, 0x00, 0x2F, 0x80, 0xFF, 0xF4, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0xAE, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0xFF, 0xE0, 0x78, 0x02, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFA, 0x7F, 0xDA, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x6A, 0x90, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80,
-    0x02, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFD, 0x02, 0xFE,
-    0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x7F, 0xC0, 0x00, 0x3F, 0xF2, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xD0, 0x2F, 0xF4, 0x3F,
-    0xC0, 0x1F, 0xE0, 0x0B, 0xF8, 0x7F, 0x40, 0x1F, 0xE0, 0x07, 0xFC, 0xBF, 0x40, 0x1F, 0xE0, 0x03,
-    0xFC, 0xBF, 0x40, 0x1F, 0xE0, 0x03, 0xFC, 0xBF, 0x40, 0x1F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x1F,
-    0xE0, 0x0F, 0xFC, 0x3F, 0xF4, 0x1F, 0xE0, 0x3F, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC,
-    0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xD2, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFC, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xD0, 0x1F,
-    0xFE, 0x00, 0x3F, 0xFC, 0x0A, 0xAA, 0x00, 0x06, 0xAA, 0x40, 0x7F, 0xD0, 0x02, 0xFE, 0x01, 0xFF,
-    0x00, 0x0B, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x02,
-    0xFF, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x3F, 0xC0, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x9A, 0xAB, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x28, 0x00, 0xA0, 0xF4, 0x03, 0xD3, 0xC0, 0x0F, 0x4F, 0x00, 0x3E, 0x7C, 0x00,
-    0xF9, 0xE0, 0x07, 0xE7, 0x80, 0x2F, 0x9F, 0x81, 0xFE, 0x3F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0xBF,
-    0x8F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7F, 0xD0, 0x15,
-    0x40, 0x7F, 0xC7, 0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC7, 0xFD, 0x03,
-    0xFE, 0x07, 0xFC, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC7, 0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x7F, 0xD0,
-    0x3F, 0xE0, 0x3F, 0xC7, 0xFD, 0x03, 0xFE, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC7, 0xFC,
-    0x03, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC7, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x7F,
-    0xC0, 0x2F, 0xD0, 0x3F, 0xC7, 0xFE, 0x57, 0xFE, 0x57, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xD0, 0x15, 0x40, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0,
-    0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xD0,
-    0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0, 0x3F, 0xC0,
-    0x7F, 0xC0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xE5,
-    0x7F, 0xE5, 0x7F, 0xE9, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x06, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xAB, 0xFD,
-    0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x01,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0xA0, 0x00,
-    0x00, 0x01, 0xFD, 0xB8, 0x00, 0x00, 0x00, 0x7F, 0x2E, 0x00, 0x00, 0x00, 0x1F, 0xCB, 0xC0, 0x00,
-    0x00, 0x07, 0xF3, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0xA9, 0x40,
-    0x00, 0x1F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xF7, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0xFC, 0x07, 0xF8,
-    0x00, 0x7F, 0x7F, 0x00, 0xBF, 0x00, 0x1F, 0xEF, 0xC0, 0x1F, 0xC0, 0x07, 0xFB, 0xF0, 0x1F, 0xE0,
-    0x02, 0xFE, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xBF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0x00,
-    0x0F, 0xFC, 0x10, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0xFF, 0xFF, 0xF0, 0xFE, 0xAF, 0xF4,
-    0xFC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0xFC, 0x01, 0xFC, 0xFC, 0x07, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xF4, 0x07, 0xD4, 0x6F, 0xF4,
-    0x14, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x40,
-    0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x1C, 0x00,
-    0x0F, 0xF8, 0x7F, 0xEB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xFC, 0x07, 0xFF, 0xFD, 0x03, 0xF0, 0x3F, 0xFF, 0xFC, 0x0F,
-    0x83, 0xFE, 0x5B, 0xF8, 0x3E, 0x0F, 0xE0, 0x07, 0xF0, 0xF8, 0x7F, 0x00, 0x0F, 0xD3, 0xF2, 0xF8,
-    0x00, 0x2F, 0x4F, 0xFF, 0xD0, 0x00, 0xBE, 0x3F, 0xFF, 0x40, 0x01, 0xF8, 0xFF, 0xFD, 0x00, 0x07,
-    0xE3, 0xFF, 0xF4, 0x00, 0x2F, 0x8F, 0xEF, 0xF0, 0x00, 0xFD, 0x3D, 0x2F, 0xE0, 0x0B, 0xF4, 0xF4,
-    0x7F, 0xFA, 0xFF, 0xC3, 0xD0, 0xFF, 0xFF, 0xFE, 0x0F, 0x42, 0xFF, 0xFF, 0xF0, 0x3D, 0x02, 0xFF,
-    0xFF, 0x40, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xF4, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xBE, 0x00, 0x2F,
-    0xC0, 0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x01, 0xFF, 0x95, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x07, 0xFF, 0x40, 0xFF,
-    0x40, 0x7F, 0xE0, 0x7F, 0xD0, 0x2F, 0xF8, 0x2F, 0xF4, 0x0B, 0xFE, 0x0F, 0xFD, 0x02, 0xFF, 0x87,
-    0xFF, 0x40, 0xFF, 0xF3, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x95,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xB0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x6F, 0xFE, 0x40, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x3F, 0xE0, 0xFF,
-    0x40, 0x1F, 0xF8, 0x7F, 0xE0, 0x07, 0xFF, 0x2F, 0xFC, 0x01, 0xAA, 0x86, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0x0F, 0xFA, 0xAA, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xF9, 0x54,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFB, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x03, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFD, 0x0B, 0xFF, 0xFC, 0x00, 0xBF,
-    0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xAA, 0xAA, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF8, 0x07, 0xF8, 0x0B, 0xF4, 0x3F, 0x80, 0x0B, 0xF1,
-    0xFC, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF9,
-    0x55, 0x50, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xE4, 0x02, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0xBF, 0xC0, 0x03, 0xF4,
-    0x00, 0x50, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x40, 0x02, 0xFF, 0x80, 0xB8, 0x00, 0xBF, 0xE0, 0x7F, 0xFA, 0xBF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x1A, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x7F, 0xC2, 0xFF, 0x4B, 0xFE, 0x3F, 0xF8, 0xFF, 0xF7, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF4, 0xBF, 0xE2,
-    0xFF, 0x80, 0x2F, 0xD0, 0xBF, 0x42, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x0F, 0xFC,
-    0x7F, 0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80,
-    0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
-    0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFE, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x10, 0xFF, 0x40, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xC0, 0x7F, 0xFD, 0x00, 0x69, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xFA, 0xBF, 0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00,
-    0x00, 0x0B, 0xC0, 0x2E, 0x00, 0x00, 0x0B, 0xC0, 0x2F, 0xFF, 0x80, 0x0B, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x0B, 0xC0, 0x2F, 0x57, 0xF8, 0x0F, 0xC0, 0x2F, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0x00, 0xFC, 0x0F,
-    0x80, 0x3F, 0x01, 0xFC, 0x0F, 0x80, 0x3F, 0xFF, 0xF8, 0xBF, 0x80, 0x3F, 0xFF, 0xF0, 0xBF, 0x40,
-    0x3F, 0xFF, 0x80, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0xA0, 0x00, 0x07, 0xD0, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x0F, 0x40, 0x00,
-    0x7D, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0x07, 0xFA, 0xAB, 0xF0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF4, 0x00, 0xFD, 0x6F, 0xD7, 0xD0, 0x03, 0xE0,
-    0x1F, 0x9F, 0x40, 0x0F, 0x80, 0x3F, 0x7D, 0x00, 0x3E, 0x02, 0xFD, 0xF4, 0x00, 0xFF, 0xFF, 0xE7,
-    0xD0, 0x03, 0xFF, 0xFF, 0x1F, 0x40, 0x0F, 0xFF, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x05,
-    0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3A,
-    0xAF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x90, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0x40, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0x00, 0x07,
-    0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40,
-    0x1F, 0xFC, 0x00, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x0B, 0xFC, 0x00, 0xBF, 0x03, 0xFD, 0x00, 0x2F, 0xC3, 0xFE, 0x00, 0x0F, 0xF2, 0xFF, 0x00, 0x03,
-    0xFC, 0xFF, 0x40, 0x00, 0xFE, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x0F, 0xF7, 0xFF, 0xD0, 0x03, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0x03, 0xFF, 0xF0, 0x7F, 0xC0,
-    0x7F, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0x47, 0xF8, 0x00, 0x3F, 0xF8, 0x7F, 0x80, 0x0B, 0xFF, 0x87, 0xF8, 0x01,
-    0xFF, 0xF8, 0x7F, 0x80, 0x3F, 0xFF, 0x87, 0xF8, 0x0B, 0xFF, 0xF8, 0x7F, 0x80, 0xFF, 0xFF, 0x87,
-    0xF8, 0x3F, 0xF7, 0xF8, 0x7F, 0xCB, 0xFD, 0x7F, 0x87, 0xFC, 0xFF, 0xC7, 0xFC, 0x7F, 0xFF, 0xF0,
-    0x7F, 0xC7, 0xFF, 0xFE, 0x0B, 0xFC, 0x7F, 0xFF, 0xC0, 0xBF, 0xC7, 0xFF, 0xF0, 0x0B, 0xFC, 0x7F,
-    0xFE, 0x00, 0xBF, 0xC7, 0xFF, 0xC0, 0x0F, 0xFC, 0x7F, 0xF4, 0x00, 0xFF, 0xC6, 0xAA, 0x00, 0x0A,
-    0xA8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x1A,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xF8, 0x00,
-    0x2F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x2F, 0xE0,
-    0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC,
-    0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00,
-    0x1F, 0xCF, 0xE0, 0x01, 0xFC, 0xFE, 0x00, 0x1F, 0xCF, 0xE5, 0x56, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x15, 0x7F, 0xE5, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x02, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x15, 0x7F, 0xD5, 0x50, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xF9, 0x5B, 0xFC, 0x00, 0x3F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFD,
-    0x00, 0x3F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xFA, 0xAF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x55, 0x55, 0x55, 0x95, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xEF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-    0xFF, 0xC2, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x0F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x1F, 0xF4, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x7F, 0xE0, 0x0F,
-    0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x83, 0xFF, 0xC0, 0x7F,
-    0xF0, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x0F, 0xFC,
-    0x00, 0x03, 0xFD, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xDF, 0xEB, 0xF0, 0x00, 0xFD, 0x3F, 0x4F, 0xD0, 0x07, 0xF0, 0xFD,
-    0x1F, 0xC0, 0x2F, 0x83, 0xF4, 0x3F, 0x00, 0xFD, 0x0B, 0xD0, 0xFE, 0x07, 0xF0, 0x3F, 0x42, 0xFC,
-    0x3F, 0xC0, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0x07, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xF0, 0x2F, 0xF8, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xD0, 0xBF, 0xFF, 0xFE, 0x03, 0xFF, 0x80,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xFE, 0xFF, 0xFF, 0xE4, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xEB, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x43, 0xFF, 0x40, 0x00,
-    0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xEA, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x03, 0xFC, 0x0B, 0xFF, 0xF4, 0x3F, 0xC0, 0xFF, 0xFF, 0xD3, 0xFC, 0x0F,
-    0xF2, 0xFF, 0xFF, 0xC1, 0xFE, 0x0B, 0xFF, 0xF4, 0x1F, 0xF0, 0x2F, 0xFE, 0x00, 0xFF, 0x1F, 0xFD,
-    0x40, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xAF, 0xFC, 0x02, 0xFF,
-    0x40, 0x7F, 0xE0, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF,
-    0x47, 0xFC, 0x00, 0x0B, 0xF8, 0xBF, 0xC0, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x0F, 0xF8, 0x7F, 0xD0,
-    0x00, 0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF,
-    0x00, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x2F, 0xC0,
-    0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x0B,
-    0xF8, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x02, 0xFE, 0x3F, 0xE0,
-    0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x01, 0xFF, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE,
-    0xAA, 0xAA, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x01, 0xAA, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x16, 0xFF, 0xD5, 0x55, 0x50, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFA, 0xAA, 0x80, 0xBE, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x45, 0xFF, 0x55, 0x50, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x55, 0x55, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0xBF, 0xFC, 0x07, 0xFF,
-    0x40, 0x2F, 0xF8, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00,
-    0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x16, 0xFF, 0xC2,
-    0xFF, 0x00, 0xFF, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xF0, 0x2F, 0xF4, 0x0F, 0xFF, 0x40, 0xBF, 0xE0,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0,
-    0x2F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD1, 0x00, 0x2F, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xE2, 0xFD, 0x0F, 0xDB, 0xD0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF4, 0x2F, 0xEF, 0xD1,
-    0xFF, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0xFD,
-    0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0xBF, 0xFF, 0xD0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x0B, 0xFF, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x7F, 0xFF, 0xC3, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xC7, 0xFF, 0xFC, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xFF, 0xCF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x9F,
-    0xFF, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFC, 0x1F, 0xFF, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x41, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA8, 0x00, 0x07, 0xFC, 0x1F, 0xFF, 0x43, 0xFC, 0x00, 0x2F, 0xD0, 0xFF, 0xF0, 0x7F,
-    0x80, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0xFF, 0xF2, 0xFD, 0x00, 0x00, 0x3F,
-    0xCF, 0xFF, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0xBF, 0xEB, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x7F, 0xDF, 0xFE, 0x00, 0x03,
-    0xFF, 0xC3, 0xFC, 0x3F, 0xFC, 0x00, 0xFF, 0xF4, 0x3F, 0xC1, 0xFF, 0xF0, 0x3F, 0xFE, 0x03, 0xFC,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xEA, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x56, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x54, 0x00, 0x0B, 0xFD, 0xBD, 0x01, 0xBF, 0xF2, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xFD, 0x09, 0x00, 0xBC, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x1A, 0xBF, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0x87, 0x41, 0xFE,
-    0x2F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC7, 0xFF, 0xFD, 0x01, 0xFE, 0x40, 0x03, 0xD0, 0x00, 0x2F, 0xE0,
-    0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x0B, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xFC, 0x00,
-    0x01, 0xFF, 0x42, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xC7, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0x01,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x0F, 0xD0, 0xBF, 0x40,
-    0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x0F, 0xC7, 0xF8, 0x00, 0x1F, 0xCF, 0xF0, 0x00,
-    0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x7F, 0x7F, 0xFC, 0x00, 0x7F, 0x4F, 0xFF, 0x00, 0xBF, 0x43, 0xFF, 0xD4, 0xBF, 0x41, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x06, 0xA4, 0x00, 0x00,
-    0x0A, 0xAA, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0xFC, 0x0F, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0xFC,
-    0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xF1, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF1, 0xFC, 0xFF, 0xF8,
-    0x00, 0x00, 0x2F, 0xF1, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF2, 0xFD, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xF2, 0xFC, 0xBF,
-    0xFF, 0x40, 0x00, 0x3F, 0xF2, 0xFC, 0x2F, 0xFF, 0xD0, 0x00, 0x7F, 0xF1, 0xA8, 0x0F, 0xFF, 0xF4,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xBF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0x0F, 0xC0,
-    0x00, 0xFF, 0x00, 0x0F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0x0B, 0xF8, 0x00, 0x1F, 0x9F, 0x1F,
-    0xF0, 0x00, 0x1F, 0x9F, 0x3F, 0xD0, 0x00, 0x2F, 0x9F, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xAF, 0x7F, 0xF0, 0x00,
-    0x3F, 0x6F, 0x2F, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x03, 0xFF, 0x80, 0x7F,
-    0x40, 0x01, 0xFF, 0xE0, 0x7F, 0x40, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xF2, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x7F, 0xF8, 0x00, 0x03,
-    0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x3F, 0xFC, 0x00, 0x00,
-    0x7F, 0xDB, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xAF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xFF,
-    0xFF, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x3F, 0xF8, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0xBF, 0xD5, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x55, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0xD0, 0x00, 0x02, 0xFD, 0x7F,
-    0xE0, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xBF, 0xFE,
-    0x00, 0x00, 0x7F, 0xD7, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0xBF, 0xFF, 0x00, 0x07, 0xFE, 0x0F, 0xFF,
-    0xF0, 0x02, 0xFF, 0x80, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0x05, 0x55, 0x7F, 0xF0, 0x7F, 0xF8,
-    0x00, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDB, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x83, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x80,
-    0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0x43, 0xFC, 0x0F, 0xFF,
-    0xF0, 0x7F, 0x80, 0x55, 0xBF, 0x0F, 0xF0, 0x00, 0x07, 0xF2, 0xFD, 0x00, 0x00, 0x7F, 0x3F, 0xC0,
-    0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xDF, 0xFE, 0x00, 0x02, 0xFC, 0x3F, 0xFC, 0x00, 0x2F, 0xC1,
-    0xFF, 0xF0, 0x02, 0xFC, 0x0B, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x3F,
-    0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0x00,
-    0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x3F,
-    0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xFD, 0x55, 0x57, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFC, 0x00, 0x03, 0xFF,
-    0xF8, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x3F, 0x40, 0x03, 0xF4, 0x3F, 0x40, 0x03, 0xF4, 0x3F, 0x40, 0x03,
-    0xF4, 0x3F, 0x40, 0x03, 0xF4, 0x7F, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x07, 0xF8, 0x7F, 0x80, 0x07,
-    0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xD5, 0x5B, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFF, 0xBF, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x15, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF8, 0x00,
-    0x00, 0xFF, 0xE5, 0x55, 0x55, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x55,
-    0x56, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x07,
-    0xFF, 0xFF, 0xE7, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x7F, 0x00, 0x07, 0xF9, 0x55, 0x57, 0xF4, 0x00,
-    0x7F, 0x40, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40,
-    0x0B, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFD, 0x55, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x95, 0x56, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x2F, 0xFF, 0xAF, 0xF9, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xBF, 0xFE, 0x1F,
-    0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xF9, 0xFF,
-    0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xE7, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0xDF, 0xF8,
-    0x00, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0x7F, 0xE0, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xF9, 0xFF, 0x80,
-    0x02, 0xFF, 0xF0, 0x05, 0xBF, 0xE7, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xFF, 0x5F, 0xF8, 0x00,
-    0x2F, 0xFF, 0x00, 0xFF, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xC1, 0xFF, 0x80, 0x03,
-    0xFF, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
-    0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x40, 0x07,
-    0xFF, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x01, 0x5F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFD,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x7F, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFD, 0x01, 0xFF, 0x80, 0x1F, 0xF0,
-    0x3F, 0xF4, 0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x7F, 0xD0,
-    0x07, 0xFC, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x0B, 0xF8,
-    0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x0B, 0xFC, 0x02, 0xFF,
-    0xC0, 0x7F, 0xE0, 0x07, 0xFD, 0x0B, 0xFF, 0x50, 0x7F, 0xF0, 0x07, 0xFF, 0x7F, 0xFF, 0xF0, 0x3F,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xF3,
-    0xFF, 0xFD, 0x01, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x2F, 0xC0, 0x7F, 0x07, 0xFC, 0x07,
-    0xF0, 0x02, 0xF4, 0xBF, 0x40, 0xBE, 0x00, 0x3F, 0x4B, 0xF0, 0x0F, 0xD0, 0x03, 0xF0, 0xFF, 0x00,
-    0xFD, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x0B, 0xF4,
-    0x0F, 0xF5, 0xFF, 0xF4, 0x7F, 0xC0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0x43, 0xFF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
-    0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xD4, 0x05, 0xB4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xF4, 0x78, 0x01, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x15, 0xBF, 0xF9, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x2A, 0x5B, 0xF5, 0xA9, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x0F, 0xFD,
-    0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x1F,
-    0xFC, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF4,
-    0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xDF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x1F,
-    0xF4, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x3F, 0xE0, 0x03, 0xFE, 0x07, 0xFD, 0x00, 0x2F,
-    0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xF0, 0x00,
-    0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x15, 0x6F, 0xFF, 0xFE, 0x54, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x7F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x07,
-    0xFD, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xD3,
-    0xFE, 0x00, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0x55, 0xBF, 0xFE, 0x55, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x15, 0x54, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xE0,
-    0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFE, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFD, 0xBF, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x2F,
-    0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x01, 0xFC, 0x00,
-    0x3F, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0xBF, 0x4F, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xBF, 0xF0,
-    0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x2F, 0xF0, 0x07,
-    0xFF, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x43, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x55, 0x57, 0xFD,
-    0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA8, 0x15, 0x03,
-    0xFF, 0xFF, 0xF0, 0xFC, 0x0F, 0xFF, 0xFF, 0xC3, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xBE,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F,
-    0xC0, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00,
-    0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xA9, 0x15, 0x40, 0x00, 0x55, 0x40, 0xBF,
-    0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x7F, 0xD0,
-    0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00,
-    0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x2F, 0xD0, 0x01, 0xFF,
-    0xC0, 0x1F, 0xF0, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1A, 0xA5, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x0B, 0xF0, 0xBF, 0x00, 0x7F, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0x00, 0x3F, 0x07, 0xE0, 0x03, 0xF0,
-    0x3E, 0x00, 0x3F, 0x03, 0xE0, 0x07, 0xF0, 0x3F, 0x41, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x1A, 0x9B, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF9, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03,
-    0xFC, 0x3F, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7E, 0x00, 0x03,
-    0xFC, 0x7D, 0x3F, 0x03, 0xFC, 0xBD, 0x3F, 0x03, 0xFC, 0xBD, 0x3F, 0x07, 0xFC, 0xBF, 0x3F, 0x0F,
-    0xFC, 0xBF, 0xFF, 0x7F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE,
-    0xFC, 0x03, 0xFF, 0xF1, 0xFC, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x02,
-    0xFD, 0x00, 0x3F, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x29, 0x00, 0xA4,
-    0xF4, 0x03, 0xE3, 0xC0, 0x0F, 0x8F, 0x00, 0x3E, 0x7C, 0x50, 0xF9, 0xE7, 0xC7, 0xE7, 0xDF, 0x2F,
-    0x9F, 0xFD, 0xFE, 0x3F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x7F, 0x8F, 0x80, 0x7C, 0x3F, 0x01, 0xF0,
-    0xFC, 0x01, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFE, 0xFF, 0xF0, 0x7F, 0xF4, 0x00, 0xFF, 0x07, 0xFE, 0x00, 0x0B, 0xF4, 0x7F,
-    0xD0, 0x00, 0xBF, 0x47, 0xFD, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0xBF, 0x87, 0xFD, 0x00, 0x0B,
-    0xFC, 0x7F, 0xD0, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x90,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFE, 0xFF, 0xF0, 0x2F, 0xFC,
-    0x00, 0xFF, 0x02, 0xFF, 0x00, 0x07, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x03, 0xF8,
-    0x3F, 0xF0, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0x07, 0xF8, 0x3F, 0xF0, 0x00, 0x7F, 0xC3, 0xFF, 0x00,
-    0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0xC7,
-    0xFF, 0x40, 0x1F, 0xFC, 0xBF, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x01,
-    0x55, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x5B, 0xFF, 0xFF, 0xAA, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xF8, 0x1A, 0x80, 0x0B, 0xF4, 0x03, 0xF4, 0xBF, 0x00,
-    0x3F, 0x81, 0x5B, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x1F, 0xFF, 0x95, 0xBD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xBF, 0xD0, 0xBF, 0xE0, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF0, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x55, 0x5F, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0x57, 0xFF, 0xFF,
-    0xEA, 0x55, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x1A, 0x80, 0x07, 0xF8, 0x02, 0xF8, 0xBF, 0x00, 0x3F, 0xC1, 0x57, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x01, 0x40, 0x00, 0x1F, 0xFF, 0x95, 0xBE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x2F, 0xF4, 0x2F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x56, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0,
-    0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0x4B, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xFF, 0xAF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFF, 0x01, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFF, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x8F, 0xFE,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB,
-    0xFE, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF5, 0xFF, 0xF5, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x2F, 0xFF, 0x4B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x42, 0xFF, 0xF8,
-    0x2F, 0xFF, 0xF8, 0x01, 0x54, 0x01, 0x55, 0x40, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x7F, 0xC0, 0xBF,
-    0xF0, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF8, 0x00, 0x2F, 0xF1, 0xFF, 0xC0, 0x00,
-    0xBF, 0xCF, 0xFD, 0x00, 0x02, 0xFE, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFE, 0x6F, 0xFF, 0xD0, 0x2F,
-    0xF4, 0x07, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFF, 0x82, 0xFF, 0x40, 0x03, 0xFF, 0x0F, 0xFD, 0x00,
-    0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x2F, 0xF4, 0xFF, 0xD0, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x03, 0xFF,
-    0x05, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x41, 0xA8, 0x07, 0xD0, 0xFE, 0x02, 0xF4, 0xBF,
-    0x00, 0xBD, 0x7F, 0x40, 0x2F, 0x7F, 0xC0, 0x0F, 0xEF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xF4, 0x07, 0xFA, 0xFF, 0x81, 0xFC, 0x0B, 0xF4, 0x7F, 0x00,
-    0xBF, 0x2F, 0xC0, 0x1F, 0xCB, 0xF0, 0x03, 0xF2, 0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x07,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF5, 0x6F, 0xF4, 0x00, 0x1F, 0xF8, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0xBF, 0xD0, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x07, 0xFD,
-    0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x2F, 0xF4,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x80,
-    0x7F, 0xFE, 0x00, 0xFF, 0xFE, 0x2F, 0xFF, 0x40, 0x3F, 0xFF, 0x4F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC3,
-    0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0xAA, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0xBF, 0x07, 0xF0, 0x02, 0xFC, 0x1F, 0xC0, 0x0B, 0xF0, 0x7F, 0x00, 0x2F, 0x81, 0xFC, 0x00,
-    0xBE, 0x07, 0xF0, 0x03, 0xF8, 0x1F, 0xC0, 0x0F, 0xD0, 0xBF, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0xFD,
-    0x0B, 0xF0, 0x03, 0xF4, 0x2F, 0xC0, 0xBF, 0xC0, 0xBF, 0xE3, 0xFF, 0x02, 0xFF, 0x0F, 0xA0, 0x0B,
-    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0,
-    0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x01,
-    0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x3F, 0xFD,
-    0x55, 0x56, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x3F, 0xFC,
-    0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xFC,
-    0x7F, 0xFD, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x05,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF0, 0x7F, 0x00,
-    0x07, 0xF0, 0x7F, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x07, 0xF4, 0x7F, 0x40,
-    0x0B, 0xF4, 0x7F, 0x40, 0x0B, 0xF4, 0xBF, 0x40, 0x0B, 0xF8, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xD5, 0x5F, 0xF8, 0xBF, 0x80,
-    0x0F, 0xFD, 0xBF, 0xC0, 0x0F, 0xFE, 0xBF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x2F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xC0,
-    0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x3F, 0xFD, 0x55, 0x56,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x7F, 0xFD,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x01, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x1F,
-    0xD0, 0x7F, 0x40, 0x07, 0xF4, 0x1F, 0xD0, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x7F, 0x41, 0xFD, 0x00,
-    0x2F, 0xD0, 0xBF, 0x40, 0x0B, 0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x2F, 0xF5, 0x57, 0xFE, 0x0B, 0xF8, 0x00, 0xBF, 0xC2,
-    0xFF, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x15, 0x40, 0x00, 0x55, 0x47, 0xFE, 0x00, 0x0F, 0xFC, 0x7F,
-    0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0xBF, 0xC3, 0xFD, 0x00, 0x0B,
-    0xFC, 0x3F, 0xD0, 0x00, 0xBF, 0xC3, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0xC2, 0xFD,
-    0x00, 0x0F, 0xFC, 0x2F, 0xD0, 0x00, 0xFF, 0xC1, 0xFF, 0x40, 0x7F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0x5F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x19, 0x00, 0x64, 0x2F, 0x00, 0xBC, 0x2E, 0x00, 0xBC, 0x2D, 0x00, 0xBC,
-    0x3C, 0x00, 0xBC, 0x3C, 0x00, 0xFC, 0x3C, 0x00, 0xFC, 0x3F, 0x03, 0xFC, 0x2F, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFC, 0x03, 0xFD, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0x40, 0x2F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xF7, 0xFF,
-    0x4F, 0xFE, 0xFF, 0x80, 0x3F, 0xF3, 0xFF, 0x9F, 0xFE, 0xFF, 0x80, 0x3F, 0xF2, 0xFF, 0xFF, 0xFA,
-    0xFF, 0x80, 0x3F, 0xF5, 0xFF, 0xFF, 0xF2, 0xFF, 0xC0, 0x3F, 0xF4, 0xFF, 0xFF, 0xF3, 0xFF, 0xC0,
-    0x3F, 0xF4, 0xBF, 0xFF, 0xE3, 0xFF, 0xC0, 0x3F, 0xF8, 0x7F, 0xFF, 0xD3, 0xFF, 0xC0, 0x3F, 0xF8,
-    0x3F, 0xFF, 0xC3, 0xFF, 0xC0, 0x3F, 0xF8, 0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x3F, 0xF8, 0x0F, 0xFF,
-    0x47, 0xFF, 0xC0, 0x3F, 0xFC, 0x0F, 0xFF, 0x07, 0xFF, 0xC0, 0x3F, 0xFC, 0x0B, 0xFF, 0x07, 0xFF,
-    0xC0, 0x3F, 0xFC, 0x03, 0xFD, 0x0B, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x03, 0xFF,
-    0x00, 0x2F, 0xF4, 0x1F, 0xFD, 0x00, 0xFF, 0xD0, 0x7F, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 0xF0, 0x3F,
-    0xFD, 0x07, 0xFF, 0xE0, 0xFF, 0xF4, 0x1F, 0xFF, 0xCB, 0xFF, 0xE0, 0x7F, 0xBF, 0x7F, 0xBF, 0x81,
-    0xFC, 0xFF, 0xFD, 0xFE, 0x0B, 0xF3, 0xFF, 0xF3, 0xF8, 0x2F, 0xC7, 0xFF, 0x9F, 0xE0, 0xBF, 0x0F,
-    0xFD, 0x7F, 0xC2, 0xFD, 0x3F, 0xF1, 0xFF, 0x0B, 0xF4, 0x7F, 0x8B, 0xFC, 0x2F, 0xD0, 0xFD, 0x2F,
-    0xF0, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x8F, 0xFC, 0xFF, 0xCF, 0xFC, 0xBF, 0xCB, 0xFC,
-    0xBF, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xBF, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F,
-    0xC7, 0xFC, 0x7F, 0xD7, 0xFD, 0x7F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x95, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x55, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0,
-    0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xF0, 0x2A, 0x40, 0x0A, 0xA0, 0x1F, 0xF9, 0x5B, 0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0xBF, 0xFC, 0x07, 0xF4, 0x03, 0xFF, 0x03, 0xF8,
-    0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x00, 0xBF, 0x4B,
-    0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x02, 0xFF, 0x1F, 0xE5, 0x5B, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xBF, 0xD0, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xA4, 0x0A, 0x90, 0x00, 0x00, 0x01, 0xFF, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x57,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x15, 0x50, 0x15, 0x40, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0xC1, 0xFF, 0xC0, 0x7F, 0xF0, 0x7F, 0xF0,
-    0x2F, 0xFD, 0x2F, 0xFC, 0x0F, 0xFF, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0xC0, 0xFE, 0x00, 0x1F, 0xF0, 0x3F,
-    0x40, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0xBF, 0x47, 0xE0, 0x00, 0x2F, 0xD2, 0xF8, 0x00, 0x07, 0xF8,
-    0x7D, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0xBF, 0xC7, 0xF9, 0x56, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xEF, 0xF4, 0x02, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0xAA, 0xAA, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xA5, 0x50, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xFE, 0x55, 0x58, 0x00, 0x00, 0x00, 0xBF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x50, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x9F, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0xFF, 0xF4, 0x0B, 0xF4,
-    0x07, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x7F, 0xFE, 0xAA, 0xBF, 0xD0, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xE0, 0x00, 0x1F, 0xFA, 0x54, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xE5, 0x5B, 0xFF, 0xFE, 0x00,
-    0x07, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFE, 0x40, 0x00, 0xBF, 0xE8, 0x00, 0x0A, 0xA4, 0x01, 0xA8, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x42, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xF9, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0A, 0xA0, 0x01, 0xA8, 0x03, 0xFE, 0x56, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFD, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x3F,
-    0x43, 0xFE, 0xAA, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xFE, 0x55, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x02, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xE4,
-    0x00, 0x5B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC2, 0xAA, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xFC,
-    0x00, 0x2F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x0E, 0x40, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x05, 0xBF, 0x8B, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xEA, 0xFF, 0x07, 0xF0, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x6A, 0x00, 0x00, 0x02, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xE4, 0x00, 0x5B, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC2, 0xAA, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xFF, 0xBF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x0E, 0x40, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x05, 0xBF, 0x8B, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xEA, 0xFF, 0x03,
-    0xF0, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFE, 0x40, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xFD, 0x1F,
-    0xF4, 0x02, 0xFF, 0x4B, 0xFD, 0x00, 0xBF, 0xE2, 0xFF, 0x80, 0x2A, 0xA4, 0xAA, 0x90, 0x00, 0x00,
-    0x00, 0x2A, 0x80, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x4B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0x40, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xCB, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0xFF, 0xE7, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xF7, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0xBF, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x2F, 0xFE, 0x2F, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x03, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xA9, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0xBF, 0xF0, 0x00, 0x0B, 0xFF, 0x01,
-    0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xD0, 0xFF, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0xFE, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xBF, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0x5F, 0xFF, 0x5F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD2, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xF4, 0x2F, 0xFF, 0x82, 0xFF, 0xFF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x07, 0xFD,
-    0x1F, 0xF4, 0x2F, 0xF4, 0xBF, 0xD0, 0xBF, 0xE2, 0xFF, 0x82, 0xAA, 0x4A, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xAA, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0xFF, 0xFF,
-    0x80, 0x01, 0x5A, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x40, 0x00, 0x2F, 0xF6, 0xE4, 0x06, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x1A, 0x80, 0x6A, 0x03, 0xFD,
-    0x0F, 0xF4, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x7F, 0xF1, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0x40,
-    0x2F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xAB, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xF8, 0x01, 0x90, 0x3F, 0x80, 0x2F, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1A, 0xAA, 0xBF, 0xF0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6B, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x90, 0x0F, 0xF8,
-    0x03, 0xF8, 0x2F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAA, 0xAA, 0x80,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x80, 0x0F, 0xF8, 0x02, 0xF4, 0x2F, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2A, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0A, 0xA9, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xE0,
-    0x3F, 0xE0, 0x00, 0x3F, 0xFE, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xE0, 0x00, 0xBF, 0xFF,
-    0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF,
-    0xF0, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x2F, 0xF0, 0x2F, 0xF7,
-    0xFF, 0x42, 0xFF, 0x43, 0xFF, 0x7F, 0xF4, 0x2F, 0xF4, 0xBF, 0xD7, 0xFF, 0x82, 0xFF, 0x4F, 0xFC,
-    0x7F, 0xF8, 0x1F, 0xF5, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xBF, 0xF0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFE,
-    0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xD0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFC, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x0F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xD0, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFA, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x47, 0xF8, 0x00, 0x3F, 0xF8, 0x7F,
-    0x80, 0x0B, 0xFF, 0x87, 0xF8, 0x01, 0xFF, 0xF8, 0x7F, 0x80, 0x3F, 0xFF, 0x87, 0xF8, 0x0B, 0xFF,
-    0xF8, 0x7F, 0x80, 0xFF, 0xFF, 0x87, 0xF8, 0x3F, 0xF7, 0xF8, 0x7F, 0xCB, 0xFD, 0x7F, 0x87, 0xFC,
-    0xFF, 0xC7, 0xFC, 0x7F, 0xFF, 0xF0, 0x7F, 0xC7, 0xFF, 0xFE, 0x0B, 0xFC, 0x7F, 0xFF, 0xC0, 0xBF,
-    0xC7, 0xFF, 0xF0, 0x0B, 0xFC, 0x7F, 0xFE, 0x00, 0xBF, 0xC7, 0xFF, 0xC0, 0x0F, 0xFC, 0x7F, 0xF4,
-    0x00, 0xFF, 0xC6, 0xAA, 0x00, 0x0A, 0xA8, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x4F,
-    0xFD, 0x00, 0x00, 0x2A, 0xA4, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0A, 0xA9, 0x03, 0xFE,
-    0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x3F, 0xFE, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x3F,
-    0xE0, 0x00, 0xBF, 0xFF, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0xFF, 0x03,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xFF, 0xF4,
-    0x2F, 0xF0, 0x2F, 0xF7, 0xFF, 0x42, 0xFF, 0x43, 0xFF, 0x7F, 0xF4, 0x2F, 0xF4, 0xBF, 0xD7, 0xFF,
-    0x82, 0xFF, 0x4F, 0xFC, 0x7F, 0xF8, 0x1F, 0xF5, 0xFF, 0x87, 0xFF, 0x81, 0xFF, 0xBF, 0xF0, 0x7F,
-    0xFC, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xD0, 0x7F, 0xFC, 0x1F, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0xBF, 0xFC, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFD, 0x0F, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x01, 0xA8, 0x06,
-    0xA0, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x03, 0xFE, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x07,
-    0xFF, 0x1F, 0xFC, 0x00, 0xBF, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xF4, 0x7F, 0x80, 0x03, 0xFF, 0x87, 0xF8,
-    0x00, 0xBF, 0xF8, 0x7F, 0x80, 0x1F, 0xFF, 0x87, 0xF8, 0x03, 0xFF, 0xF8, 0x7F, 0x80, 0xBF, 0xFF,
-    0x87, 0xF8, 0x0F, 0xFF, 0xF8, 0x7F, 0x83, 0xFF, 0x7F, 0x87, 0xFC, 0xBF, 0xD7, 0xF8, 0x7F, 0xCF,
-    0xFC, 0x7F, 0xC7, 0xFF, 0xFF, 0x07, 0xFC, 0x7F, 0xFF, 0xE0, 0xBF, 0xC7, 0xFF, 0xFC, 0x0B, 0xFC,
-    0x7F, 0xFF, 0x00, 0xBF, 0xC7, 0xFF, 0xE0, 0x0B, 0xFC, 0x7F, 0xFC, 0x00, 0xFF, 0xC7, 0xFF, 0x40,
-    0x0F, 0xFC, 0x6A, 0xA0, 0x00, 0xAA, 0x80, 0x00, 0x01, 0xA8, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00,
-    0x00, 0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x8B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x7F,
-    0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0,
-    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x07, 0xFE, 0x1F, 0xF8,
-    0x00, 0xBF, 0xE2, 0xFF, 0x80, 0x06, 0xA9, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0xBF, 0xF0, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0xFF, 0x80, 0x07, 0xFC,
-    0x0F, 0xF0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFF, 0x00,
-    0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x3F, 0xE1, 0xFF, 0x40, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x02, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x07,
-    0xFF, 0x82, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0x80, 0x00,
-    0x1F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xEA, 0xAA, 0x6F, 0xFE, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xE3, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFD, 0x2F, 0xFF, 0xEA, 0xBF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xFE, 0xBF, 0xF0,
-    0x2F, 0xF4, 0x07, 0xFE, 0x0F, 0xF8, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x03,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFA, 0xAF, 0xF9, 0xFF, 0x40,
-    0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x0A, 0x90, 0x2A, 0x40, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x4F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xAA, 0xA6, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFE, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD2, 0xFF, 0xFE, 0xAB, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x01, 0xA8, 0x0A, 0xA0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFF, 0x40, 0x1F, 0xF4, 0x7F, 0xD0, 0x0B, 0xFE, 0x2F, 0xF8, 0x02, 0xFF, 0x8B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xAF, 0xFC, 0x0B, 0xFD, 0x01,
-    0xFF, 0x83, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x9F, 0xFF,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFE, 0xAB, 0xFE, 0x7F, 0xD0, 0x00, 0xFF, 0x8F,
-    0xFC, 0x00, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0xD0, 0x00, 0x01, 0xFF,
-    0x87, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0xBF, 0xE0, 0x00, 0x01, 0xAA, 0x46, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x90, 0x6F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xF0,
-    0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2A, 0x90, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x55, 0x55, 0x5B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF,
-    0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x2A, 0x40, 0x1F, 0xF0, 0x7F,
-    0xC0, 0x2F, 0xF0, 0xBF, 0xC0, 0x3F, 0xF0, 0xFF, 0xC0, 0x3F, 0xF0, 0xFF, 0xC0, 0x3F, 0xF4, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x1F, 0x51, 0xBF, 0xD0, 0x14, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x03, 0xFC, 0x1C, 0x00, 0x0F, 0xF8, 0x1F, 0xFA, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x15, 0x5A, 0xAF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x80, 0x00, 0x0A, 0xA0, 0xFF, 0x80, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x03, 0xFE,
-    0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x0B, 0xFD, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x2F,
-    0xF4, 0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0xE3, 0xFE, 0x00, 0x01, 0xFF, 0xDF,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0A, 0xAA, 0xA5, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF,
-    0x4F, 0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xF8, 0x00, 0x2F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x3F,
-    0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x2F, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x02, 0xFF, 0x87,
-    0xFC, 0x00, 0x03, 0xFF, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0xA9, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x2F,
-    0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F,
-    0xF0, 0xFF, 0x80, 0x00, 0xBF, 0x82, 0xFF, 0x40, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFD, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0xF8, 0x0F, 0xF0, 0x00, 0x3F, 0xF0,
-    0xBF, 0xC0, 0x00, 0xBF, 0xF3, 0xFE, 0x00, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0xA9, 0x00, 0x01, 0xFF, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x2F,
-    0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x01, 0xFF, 0x07, 0xFE, 0x00, 0x0B, 0xF8, 0x0F,
-    0xFC, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xF4, 0x0B, 0xF8, 0x00, 0x3F, 0xF0,
-    0x3F, 0xD0, 0x00, 0xBF, 0xE1, 0xFF, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x40, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x02, 0xA8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x00,
-    0x0F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xCB, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA0, 0x1A, 0x80, 0x0F, 0xF4, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xD0, 0x0F, 0xF8, 0x3F, 0xE0,
-    0x1F, 0xF8, 0x7F, 0xE0, 0x2F, 0xFC, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x03, 0xFC,
-    0x7F, 0x00, 0x03, 0xFC, 0x7E, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x03, 0xFC, 0xBD, 0x00, 0x03, 0xFC,
-    0xBD, 0x00, 0x07, 0xFC, 0xBF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x7F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0xFC, 0x03, 0xFF, 0xF1, 0xFC, 0x00, 0x15, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x02, 0xFD, 0x1A, 0x80, 0x6A, 0x0F, 0xF0, 0x3F, 0xC3, 0xFD, 0x0F, 0xF5, 0xFF, 0x87,
-    0xFE, 0x7F, 0xE1, 0xFF, 0xAF, 0xFC, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0xA0, 0x0F, 0x40,
-    0x3D, 0x03, 0xC0, 0x0F, 0x40, 0xF0, 0x03, 0xE0, 0x7C, 0x00, 0xF8, 0x1E, 0x00, 0x7E, 0x07, 0x80,
-    0x2F, 0x81, 0xF8, 0x1F, 0xE0, 0x3F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x00, 0xBF, 0x8F, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x6A,
-    0xAA, 0xA8, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0xA4, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD1, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x1F, 0xFF, 0xFA,
-    0x00, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xF8, 0x7F, 0x96, 0xBF, 0xF0, 0x00, 0x07, 0xFE, 0x1F, 0xD0, 0x07, 0xFE, 0x00, 0x01,
-    0xFF, 0x87, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xE1, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xFC,
-    0x7F, 0x40, 0x0F, 0xF8, 0x00, 0x0B, 0xFF, 0x1F, 0xD0, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x0B, 0xFD, 0x2F, 0xF4,
-    0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xAA, 0x92, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xDA, 0x80, 0x00, 0x00, 0x07, 0xF6, 0xE0, 0x00, 0x00, 0x01, 0xFC,
-    0xB8, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xF3,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0xFE, 0xA5, 0x00, 0x00, 0x7F, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xDF,
-    0xFF, 0xFF, 0x00, 0x07, 0xF7, 0xF0, 0x1F, 0xE0, 0x01, 0xFD, 0xFC, 0x02, 0xFC, 0x00, 0x7F, 0xBF,
-    0x00, 0x7F, 0x00, 0x1F, 0xEF, 0xC0, 0x7F, 0x80, 0x0B, 0xFB, 0xFF, 0xFF, 0xD0, 0x02, 0xFE, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x2F,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xDF, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x4B, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xC2, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xF0,
-    0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xBF, 0xD0, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0xFF, 0xC1, 0xFF, 0xFC, 0x0B, 0xFC,
-    0x02, 0xFF, 0xFC, 0x7F, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x42, 0xFC, 0x01, 0xFD, 0x2F,
-    0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0xC0, 0x1F, 0xC3, 0xFC, 0x01, 0xFC, 0x3F, 0x80, 0x1F,
-    0xC3, 0xF8, 0x01, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF8,
-    0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x40, 0x2F, 0xC3, 0xF4, 0x02, 0xFC,
-    0x3F, 0x40, 0x3F, 0xC3, 0xF4, 0x03, 0xFC, 0x3F, 0x40, 0x3F, 0xC7, 0xF4, 0x03, 0xFC, 0x7F, 0x40,
-    0x3F, 0x87, 0xF4, 0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x87, 0xF0, 0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x87,
-    0xF0, 0x03, 0xF8, 0x7F, 0x00, 0x3F, 0x80, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x2F, 0xFF, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00,
-    0xBF, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x7F,
-    0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0,
-    0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0xFF, 0xF0, 0x0F,
-    0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x40, 0x3F, 0xFF,
-    0x03, 0xFF, 0xF0, 0x2F, 0xFF, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x80,
-    0x3F, 0xFC, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x3F, 0xFF, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x07, 0xFF,
-    0xD0, 0x2F, 0xFF, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x01, 0xFF, 0xD0,
-    0x0B, 0xFF, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0x03,
-    0xFF, 0xD0, 0x7F, 0xFC, 0x02, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0xE0, 0xBF, 0xFC, 0x07, 0xFF,
-    0xD0, 0xBF, 0xFC, 0x03, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0x07, 0xFF, 0x80,
-    0xBF, 0xF0, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F, 0xFE, 0x03, 0xFF,
-    0xC0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0xFF, 0xF8,
-    0x0F, 0xFF, 0x40, 0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F,
-    0xF8, 0x0F, 0xFF, 0x40, 0x3F, 0xFF, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x07, 0xFF, 0xD0, 0x2F, 0xFF,
-    0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0x00,
-    0xFF, 0xE0, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xD0, 0x3F,
-    0xFC, 0x02, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x58, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFE, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7,
-    0xFF, 0xF8, 0x7F, 0xFD, 0x07, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x7F, 0xC2,
-    0xFF, 0x4F, 0xFD, 0x3F, 0xF8, 0xFF, 0xE7, 0xFF, 0xC0, 0x05, 0x50, 0x7F, 0xC2, 0xFF, 0x4F, 0xFD,
-    0x3F, 0xF8, 0xFF, 0xE7, 0xFF, 0xC0, 0x05, 0x50, 0x00, 0x55, 0x00, 0x05, 0x50, 0x7F, 0xC0, 0x03,
-    0xFE, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x1F, 0xF8, 0x02, 0xFF, 0x4F, 0xFE, 0x00, 0x7F, 0xF0, 0x0F,
-    0xFD, 0x3F, 0xF8, 0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xE7, 0xFF,
-    0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x55, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x2C, 0xB0, 0x00, 0x7F, 0x40, 0x0D,
-    0xDD, 0x00, 0x3F, 0xC0, 0x03, 0x77, 0x40, 0x2F, 0xC0, 0x00, 0xD9, 0xD0, 0x1F, 0xE0, 0x00, 0x3C,
-    0xB4, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x05,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x28, 0x06, 0x80, 0x0B, 0xFC, 0x35, 0xC3, 0x24, 0x03, 0xFD,
-    0x0E, 0x71, 0xB7, 0x03, 0xFF, 0x07, 0xAC, 0xAE, 0xC1, 0xFF, 0x00, 0xC7, 0x2C, 0xB0, 0xFF, 0x80,
-    0x3F, 0xC7, 0xF8, 0xBF, 0xC0, 0x07, 0xD0, 0xBC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0xFF, 0xF4, 0x0F, 0xFF, 0x00,
-    0xFF, 0xE0, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xC1, 0xFF,
-    0xF8, 0x3F, 0xFF, 0x07, 0xFF, 0xD0, 0xFF, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xD0, 0x3F, 0xFC, 0x0F,
-    0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x0B, 0xFF, 0x42, 0xFF, 0xD0, 0x3F, 0xFC, 0x0F, 0xFF, 0x01,
-    0xFF, 0xE0, 0x7F, 0xFC, 0x0B, 0xFF, 0x42, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x0B, 0x80, 0x1D, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x01, 0xFF, 0x03,
-    0xFF, 0x0B, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0xBF, 0x80, 0xFF, 0x42, 0xFE, 0x03, 0xFC,
-    0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0x7F, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x7F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x7F, 0xC7, 0xFC, 0x03, 0xFD, 0x3F, 0xE0,
-    0x1F, 0xF1, 0xFF, 0x00, 0xBF, 0x8B, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x1D, 0x00, 0x2F, 0xD0,
-    0x7F, 0x80, 0xBF, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0xFF, 0xC0, 0x0F, 0xF4, 0x2F, 0xE0, 0x3F, 0xD0,
-    0x07, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0xBF, 0x01, 0xFC,
-    0x02, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xCF,
-    0xFE, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x0D, 0x00, 0x07, 0xD0, 0x02, 0xFD,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x0B,
-    0xFF, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xF8, 0x00, 0x07, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x3D, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFC, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x2F, 0xE0, 0x01, 0xF8,
-    0x00, 0x1E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x3F, 0xFD, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2A, 0xA8, 0x0F, 0xFF, 0x40, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x1F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFC, 0x2F, 0xFC,
-    0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x3F, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0x15, 0x54, 0x2F, 0xFF, 0xFF, 0xF0, 0x15, 0x54, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1F, 0x00, 0x0B, 0xF0, 0x02,
-    0xFC, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0xBF, 0xF8, 0x3F, 0xFE,
-    0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xFC, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFD, 0x03, 0xFD, 0x7F, 0xEF, 0xF0,
-    0x1E, 0x07, 0xF8, 0xFF, 0x40, 0x40, 0xBF, 0x8B, 0xF8, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0xBF,
-    0x87, 0xFC, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x0F, 0xF8, 0xBF, 0x80,
-    0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x00, 0x40, 0x00, 0x07, 0xF8, 0x01, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x42,
-    0x00, 0x00, 0x00, 0xE3, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0x7E, 0xBC, 0x00, 0x00, 0x02, 0x4F, 0x85, 0x60, 0x00, 0x01, 0xE3, 0xE0, 0xBC,
-    0x14, 0x00, 0xF8, 0x66, 0x1F, 0x2E, 0x0F, 0x6E, 0x7F, 0xFB, 0xFF, 0x4B, 0xFF, 0xFF, 0xBF, 0xFE,
-    0x00, 0x7F, 0xFE, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0x93, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xDF,
-    0x83, 0xFB, 0xDF, 0x74, 0xF4, 0x40, 0x62, 0xF0, 0x40, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xF8, 0x07, 0xFF, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x1F, 0x80, 0x00, 0xFF, 0x81, 0xF8, 0x00,
-    0x0F, 0xF8, 0x09, 0x00, 0x00, 0x7F, 0xC0, 0x90, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0xBF, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0xE0, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xF8, 0xBF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x0F,
-    0xF4, 0x02, 0xFD, 0xD0, 0x00, 0x0B, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x03,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF4, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFC, 0x00,
-    0xBF, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x02,
-    0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0C, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0x40,
-    0x00, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x02,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0x41, 0x55, 0x40, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0x40, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFD, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0x15, 0x55,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0x54,
-    0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0xFF,
-    0xD0, 0x00, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x1F,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3D, 0x78, 0x78, 0x2C, 0xB6, 0x9D, 0xB7, 0xDE, 0xF7, 0xDE,
-    0xF5, 0x2E, 0xBC, 0x3E, 0x7F, 0xFD, 0x3F, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x0F, 0x80, 0x0F, 0xE0, 0x0B, 0x78, 0x07, 0x5E, 0x03, 0xC7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFF,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x3F, 0xFC, 0x7F, 0xFC, 0x78, 0x00, 0x78, 0x00, 0x7F, 0xE0, 0xBF,
-    0xFC, 0x00, 0x3E, 0x00, 0x2E, 0x20, 0x7E, 0x7F, 0xFD, 0xBF, 0xFC, 0x6F, 0xE0, 0x07, 0xFD, 0x0B,
-    0xFF, 0x43, 0xC0, 0x01, 0xEB, 0x80, 0xBF, 0xFC, 0x3F, 0x4F, 0x8F, 0x80, 0xF2, 0xE0, 0x3C, 0x7D,
-    0x6F, 0x0F, 0xFF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0x00, 0x7C, 0x00,
-    0x2E, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0F,
-    0xE0, 0x01, 0x50, 0x00, 0x0B, 0xF4, 0x0F, 0xAF, 0x43, 0xC1, 0xE0, 0xF0, 0xB8, 0x2F, 0xFC, 0x07,
-    0xFF, 0x07, 0xC2, 0xF3, 0xE0, 0x3C, 0xBE, 0x7F, 0x1F, 0xFF, 0x81, 0xBF, 0x80, 0x0B, 0xE0, 0x0F,
-    0xFF, 0x47, 0x41, 0xE2, 0xC0, 0x3C, 0xB0, 0x0F, 0x2E, 0x0B, 0xD3, 0xFF, 0xF4, 0x2F, 0xFC, 0x10,
-    0x1F, 0x1F, 0xFF, 0x87, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xBF, 0xA0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFE, 0x00,
-    0xBF, 0xC2, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x4F, 0xF4,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0x8F,
-    0xFC, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0B, 0xFF, 0x7F, 0xF0, 0x02, 0xFF,
-    0xEF, 0xFC, 0x00, 0xBF, 0xF0, 0x0B, 0xE0, 0x0B, 0x9F, 0x03, 0xC1, 0xD2, 0xE6, 0x3C, 0xB7, 0xCF,
-    0x3D, 0xF7, 0xCF, 0xAD, 0xF2, 0xF0, 0xBC, 0xBE, 0x7F, 0x0F, 0xFF, 0x42, 0xFF, 0xC0, 0x2F, 0x80,
-    0x01, 0x40, 0x2F, 0xC0, 0x3F, 0xC0, 0x27, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x6F, 0xE8, 0xBF, 0xFD, 0xBF, 0xFD, 0x1F, 0xE0, 0x1F, 0xFF, 0x4B, 0x43, 0xF0, 0x00,
-    0x7C, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x0F, 0xD0, 0x0F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFA, 0x87, 0xFF,
-    0xF2, 0xFF, 0xFC, 0x1A, 0x90, 0x0F, 0xFF, 0x01, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x1E, 0x03, 0xFF,
-    0x00, 0xFF, 0xD0, 0x00, 0xBC, 0x14, 0x1F, 0x0F, 0xFF, 0xC7, 0xFF, 0xE1, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x07, 0xBC, 0x03, 0xCF, 0x03, 0xC3, 0xC2, 0xFB, 0xFD,
-    0xFF, 0xFF, 0x45, 0x6F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x2A, 0xA8, 0x7F, 0xFC, 0x74, 0x00, 0x74,
-    0x00, 0xBF, 0x90, 0xBF, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x60, 0x7D, 0x7F, 0xFD, 0xBF, 0xF8, 0x6F,
-    0x90, 0x02, 0xFE, 0x07, 0xFF, 0x83, 0xD0, 0x01, 0xE0, 0x00, 0xBA, 0xE4, 0x2F, 0xFF, 0x4F, 0xD2,
-    0xF3, 0xF0, 0x3C, 0xBC, 0x0F, 0x5F, 0x9B, 0xC3, 0xFF, 0xE0, 0x2F, 0xE0, 0xBF, 0xFF, 0x2F, 0xFF,
-    0xC0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x2F, 0x80, 0x05, 0x50, 0x01, 0x50, 0x07, 0xFF, 0x03, 0xD2, 0xF0, 0xF0, 0x3C,
-    0x3D, 0x2F, 0x0B, 0xFF, 0x41, 0xFF, 0xD1, 0xF0, 0x7C, 0xB8, 0x0F, 0x6F, 0xAF, 0xD3, 0xFF, 0xF0,
-    0x2F, 0xE0, 0x06, 0x90, 0x0B, 0xFF, 0x07, 0x82, 0xE2, 0xC0, 0x3C, 0xB0, 0x0F, 0x2D, 0x07, 0xD3,
-    0xFF, 0xF4, 0x3F, 0xFD, 0x00, 0x0F, 0x09, 0x4B, 0xC7, 0xFF, 0xE1, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00,
-    0x0A, 0xA9, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE0,
-    0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xD1, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF7, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xEB, 0xFD, 0x00, 0xFF, 0xFF, 0xD1, 0xF8, 0x00, 0xBF, 0xFF,
-    0xF0, 0xBE, 0x00, 0x3F, 0xFD, 0xFC, 0x3F, 0x40, 0x1F, 0xFE, 0x7F, 0x0F, 0xC0, 0x0B, 0xFF, 0x5F,
-    0x83, 0xF0, 0x03, 0xFF, 0xCB, 0xD1, 0xF8, 0x00, 0xFF, 0xF3, 0xF4, 0xBE, 0x00, 0x3F, 0xFC, 0xFC,
-    0x3F, 0x40, 0x1F, 0xFF, 0x3F, 0x0F, 0xC0, 0x03, 0xFF, 0xEF, 0x83, 0xF0, 0x00, 0xFF, 0xFF, 0xE1,
-    0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0xBE, 0x04, 0x0B, 0xFF, 0xFF, 0xBF, 0xEF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xEA, 0xAF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x6F, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xF4, 0x0F, 0xFF,
-    0x00, 0x7F, 0xFF, 0x41, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0xFF,
-    0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x7F, 0x07, 0x40, 0xBF, 0xFF, 0xEB, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0x96, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x2E, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0xFF, 0x55,
-    0x54, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x80, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x87, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0x83, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x82, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x56, 0xFF, 0x95, 0x57, 0xFF, 0x54, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF9,
-    0x56, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x07, 0xFE, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x7F, 0xAF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBC,
-    0x01, 0x40, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xFE, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x3F, 0xF0, 0x1F, 0xE0, 0x00, 0x01,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0x38, 0x03, 0xFC, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xBF,
-    0xAF, 0xFC, 0x3F, 0xF0, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x1F, 0xFC, 0x03, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x15, 0x50, 0x05, 0x54, 0x00, 0x1B,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x05, 0x40, 0x3F, 0x40, 0x00, 0xFD, 0x03, 0xF0,
-    0x1F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x1F, 0xFD, 0x3F, 0x80, 0x00, 0x2F, 0xC7, 0xFF, 0x4F,
-    0xD0, 0x00, 0x07, 0xF6, 0xFF, 0xE3, 0xF4, 0x00, 0x01, 0xFD, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFC, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFE, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x83, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFA, 0x94, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xF9, 0xFF, 0xE5, 0xBF, 0xF0, 0x0F, 0xE7,
-    0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x9F, 0xC0, 0x00, 0x3F, 0x40, 0xFE, 0x7F, 0x00, 0x00, 0xBE, 0x03,
-    0xF9, 0xFC, 0x25, 0x02, 0xF8, 0x0F, 0xE7, 0xF0, 0xFF, 0x0B, 0xE0, 0x3F, 0x9F, 0xC3, 0xFC, 0x2F,
-    0xC0, 0xFE, 0x7F, 0x0F, 0xF0, 0xBF, 0x03, 0xF9, 0xFC, 0x3F, 0xC2, 0xFC, 0x0F, 0xE7, 0xF0, 0xFF,
-    0x01, 0x60, 0x7F, 0x9F, 0xC3, 0xFC, 0x00, 0x01, 0xFE, 0x7F, 0x0B, 0xF8, 0x00, 0x07, 0xF9, 0xFC,
-    0x1F, 0xF8, 0x00, 0x3F, 0xE7, 0xF0, 0x3F, 0xFE, 0x57, 0xFF, 0x9F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16,
-    0xAF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xAB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE4, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xD7, 0xFF, 0xC0, 0x00, 0x07,
-    0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x96, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x6A, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x14, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xAA, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0A, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0x80, 0x00, 0x02, 0x47, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0xF6, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x57, 0xFE, 0x56, 0xFF, 0xF5, 0x55, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x95, 0xAF, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF7, 0xFC,
-    0x01, 0x90, 0x00, 0xFF, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0x00,
-    0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xA5, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFD, 0x03, 0xF9, 0x6F, 0xFF,
-    0xC3, 0xFF, 0xF0, 0x3F, 0x80, 0xBF, 0xD8, 0x2F, 0xFF, 0xC3, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0x9B, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x01, 0x55, 0x55, 0x55, 0x57, 0xFE, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFB,
-    0xF0, 0x00, 0xFF, 0x6F, 0xC0, 0x07, 0xFC, 0x7F, 0x00, 0x1F, 0xF1, 0xFC, 0x00, 0x7F, 0xC7, 0xF0,
-    0x01, 0xFF, 0x1F, 0xC0, 0x07, 0xFD, 0x7F, 0x00, 0x0F, 0xF9, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x05, 0x50, 0x0F, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x2A, 0xAF, 0xFE, 0xA8, 0x3F, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x10, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x06, 0xAA, 0x80, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x50, 0x00, 0x0F, 0xF1, 0xBE, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x1B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x46, 0xE0, 0x07, 0xFF,
-    0xFB, 0xFE, 0x00, 0x7A, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x5F,
-    0xD7, 0xFF, 0xFD, 0x02, 0xFD, 0x7F, 0xFF, 0x00, 0x7F, 0xC7, 0xEB, 0xF0, 0x2F, 0xF8, 0x60, 0x7F,
-    0x5F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xEF, 0xFC, 0x00, 0x1F, 0xFB,
-    0xF5, 0xFF, 0x00, 0x0B, 0xFC, 0xFD, 0x3F, 0xC0, 0x02, 0xFE, 0x3F, 0x4F, 0xF4, 0x00, 0xBF, 0x4F,
-    0xD2, 0xFD, 0x00, 0x2F, 0xD3, 0xF8, 0xBF, 0x40, 0x0B, 0xF0, 0xFE, 0x2F, 0xD0, 0x02, 0xFC, 0x3F,
-    0x8B, 0xF4, 0x00, 0xBF, 0x0F, 0xE2, 0xFD, 0x00, 0x2F, 0xC3, 0xF8, 0xBF, 0x40, 0x0B, 0xF4, 0xFE,
-    0x2F, 0xD0, 0x02, 0xFD, 0x3F, 0x8B, 0xF4, 0x00, 0xBF, 0x8F, 0xE3, 0xFD, 0x00, 0x2F, 0xF3, 0xFC,
-    0xFF, 0x40, 0x07, 0xFC, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x56, 0xFF, 0xF5, 0x55, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFA, 0xFD, 0xFF, 0xE0, 0x3F, 0xF8, 0xBF, 0x0F, 0xFE, 0x1F, 0xF4, 0x2F,
-    0xC0, 0xFF, 0x41, 0xF4, 0x0B, 0xF0, 0x0B, 0x40, 0x10, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0xC0, 0x1C, 0x03,
-    0xFC, 0x0B, 0xF0, 0x1F, 0xC1, 0xFF, 0xD2, 0xFC, 0x2F, 0xFC, 0x1F, 0xFD, 0xBF, 0x2F, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00,
-    0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0x2F, 0x5F, 0xF4, 0xFF, 0x0B, 0xD1, 0xFD, 0x1E, 0x02, 0xF4, 0x0D,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xE0, 0x2F, 0x40, 0xD0, 0xFF, 0x0B, 0xD0, 0xFD, 0x2F, 0xF2,
-    0xF5, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x5A, 0xB8, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0x50, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0xFF,
-    0xE0, 0x00, 0x3F, 0x8F, 0xFE, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x07, 0xF4, 0x0F, 0xFE, 0x01, 0xFD,
-    0x00, 0xFF, 0xE0, 0x7F, 0x40, 0x0F, 0xFE, 0x1F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x80, 0x0E, 0xA9, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFB, 0xF8, 0x00, 0x3F, 0xF4, 0xFE, 0x00, 0x3F, 0xF4, 0x3F, 0xC0, 0x3F,
-    0xF4, 0x0F, 0xF0, 0x3F, 0xF4, 0x03, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0x1F, 0xF4, 0x00, 0x2F, 0xC2,
-    0xF4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x06, 0x90, 0xFF, 0xC0, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0xC0,
-    0x3F, 0x80, 0x1F, 0xFC, 0x0F, 0xE0, 0x01, 0xFF, 0x87, 0xF4, 0x00, 0x2F, 0xFA, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x6A, 0xAA, 0xAA, 0xC0, 0x00, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x3F, 0x01, 0xA0, 0x00, 0x2F, 0xF1, 0xFD, 0x00, 0x2F, 0xF4, 0x7F, 0x40, 0x2F,
-    0xF8, 0x0F, 0xE0, 0x1F, 0xF8, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0x0F, 0xFC, 0x00, 0x2F, 0xCF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xAA, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x2F,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0x8B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0xF8, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xEF, 0x8B, 0xFB,
-    0xFE, 0x01, 0xFF, 0xC7, 0xE2, 0xF8, 0xBF, 0xE0, 0xFF, 0xD1, 0xF8, 0xBE, 0x0F, 0xFD, 0x3F, 0xD0,
-    0x7E, 0x2F, 0x80, 0xFE, 0x03, 0xD0, 0x1F, 0x8B, 0xE0, 0x0E, 0x00, 0x10, 0x07, 0xE2, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0x8B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE2,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x50, 0x07, 0xE2, 0xF8, 0x00,
-    0x00, 0x3D, 0x01, 0xF8, 0xBE, 0x00, 0xF0, 0x3F, 0xD0, 0x7E, 0x2F, 0x80, 0xFE, 0x0F, 0xFD, 0x1F,
-    0x8B, 0xE0, 0xFF, 0xD0, 0xFF, 0xD7, 0xE2, 0xF8, 0xFF, 0xD0, 0x0F, 0xFF, 0xF8, 0xBF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x8B, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xE2,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x01,
-    0xFF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xDF,
-    0xFF, 0x80, 0x2F, 0xFF, 0x5F, 0xFF, 0xF8, 0x7F, 0xFF, 0x5F, 0xFF, 0xFD, 0x3F, 0xFF, 0x5F, 0x8B,
-    0xFC, 0x0B, 0x6F, 0x5F, 0x81, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00,
-    0x00, 0x2F, 0x5F, 0x80, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x0B,
-    0x6F, 0x5F, 0x81, 0xE0, 0x3F, 0xFF, 0x5F, 0x8B, 0xFC, 0x7F, 0xFF, 0x5F, 0xFF, 0xFD, 0x2F, 0xFF,
-    0x5F, 0xFF, 0xF8, 0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x01, 0xBE, 0x41, 0xFD, 0x01, 0xFF,
-    0xFF, 0x2F, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0x81, 0xFF, 0xFC,
-    0x3F, 0xE0, 0x03, 0xFF, 0x87, 0xFD, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x01, 0xFF, 0x47, 0xFC, 0x00,
-    0x0F, 0xF0, 0x7F, 0xD0, 0x01, 0xFF, 0x03, 0xFF, 0x40, 0xBF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0xBF, 0xD0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x01,
-    0xFF, 0xC0, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0xFF,
-    0xC7, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x94,
-    0x5B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0xBF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x6F, 0xFF, 0xE9, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC7, 0xFF,
-    0xD5, 0x55, 0x5F, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xEA, 0xBF, 0xFA, 0x03,
-    0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03,
-    0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40,
-    0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x55, 0x00, 0x0F,
-    0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00,
-    0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF,
-    0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x0F,
-    0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xAA, 0xAA, 0xAA, 0xAA, 0x80, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xAA, 0xAA, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x01, 0xFF, 0xFA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x1A,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFE, 0xAA, 0x94, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x40,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x06, 0xFF, 0xD0, 0x7F,
-    0x83, 0xFC, 0x00, 0x2F, 0xC0, 0x07, 0xF1, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x7F, 0x40, 0x00,
-    0xF8, 0x00, 0x3F, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x2F, 0xC3, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xF9, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x6D, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x3F, 0xF8, 0x3F,
-    0xFC, 0x7F, 0xFC, 0xBF, 0xFC, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x3F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0xBF, 0xFC, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0x50, 0x0F, 0xFF, 0xD0, 0x3F, 0xC2, 0xFF,
-    0xFF, 0x83, 0xFC, 0x3F, 0xD3, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F, 0xFF, 0xF8, 0x2F, 0xD0, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0x50, 0x0F, 0xFF,
-    0xD0, 0x3F, 0xC2, 0xFF, 0xFF, 0x43, 0xFC, 0x3F, 0xC7, 0xFD, 0x7F, 0xC7, 0xFC, 0x1F, 0xFF, 0xF8,
-    0x2F, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0xAA, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEB, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x7A, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x29, 0x50,
-    0x00, 0x00, 0x1B, 0x00, 0x0F, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0x6B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x15, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x06, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0x5A, 0x80, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xC0, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFE, 0x95, 0x00, 0xBF, 0xE9, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_boldBitmaps[39443] = {
+    0xBD, 0x55, 0xBF, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0xE1, 0x2C, 0x61, 0x89, 0xA5, 0x80, 0xDA,
+    0x0D, 0xBD, 0x29, 0xD3, 0xA0, 0x75, 0xD2, 0x50, 0x50, 0x5C, 0x0A, 0x52, 0x43, 0x4D, 0x73, 0xFC,
+    0x01, 0x41, 0xB6, 0x94, 0x92, 0xE2, 0x52, 0xD0, 0x27, 0x05, 0x4D, 0xD2, 0xD0, 0x50, 0x82, 0xD6,
+    0xDC, 0x15, 0x57, 0x5C, 0xF3, 0x21, 0x4A, 0x1A, 0x23, 0x90, 0x52, 0x50, 0xB0, 0x44, 0x16, 0xF1,
+    0x25, 0xB6, 0x87, 0xF7, 0xC6, 0xFE, 0xEE, 0x87, 0x40, 0x94, 0xEC, 0xA7, 0xDD, 0x59, 0xEF, 0xE7,
+    0x9D, 0x79, 0x33, 0xF3, 0x66, 0x2C, 0x22, 0xEF, 0x4B, 0x29, 0x79, 0x4C, 0x66, 0x09, 0x75, 0xD5,
+    0xB9, 0x98, 0x4D, 0xA2, 0xE2, 0x6D, 0x93, 0xA8, 0x34, 0x5D, 0x19, 0x8B, 0x29, 0x55, 0x51, 0x6C,
+    0x64, 0x92, 0x42, 0xA4, 0x96, 0xEB, 0x23, 0xD3, 0x3B, 0xDA, 0x87, 0xB1, 0x52, 0xA7, 0xA7, 0xFA,
+    0xA7, 0x4E, 0x8D, 0xD6, 0xCD, 0xEC, 0xF4, 0x5C, 0x3B, 0x1D, 0xC3, 0xE4, 0xF4, 0x23, 0xAD, 0x35,
+    0x86, 0xE8, 0xB4, 0x80, 0x8E, 0x18, 0x06, 0x6E, 0xEA, 0x75, 0xE3, 0xB8, 0x11, 0x29, 0x06, 0x98,
+    0xC4, 0x70, 0x7B, 0x19, 0xF7, 0x32, 0x37, 0x49, 0x00, 0x9B, 0x1C, 0x29, 0xAB, 0xE8, 0x20, 0x73,
+    0xB5, 0x31, 0x17, 0xAB, 0x84, 0x25, 0x1B, 0x63, 0xB9, 0xCA, 0x41, 0xA4, 0xD9, 0x01, 0xB1, 0x50,
+    0x56, 0x26, 0xC3, 0x5E, 0x76, 0xDE, 0xA4, 0xDE, 0x90, 0xDB, 0xFD, 0x61, 0xBB, 0x1F, 0xAB, 0x4D,
+    0xFA, 0x55, 0xF6, 0x92, 0x6A, 0x1B, 0x76, 0xE6, 0x70, 0xAB, 0x9D, 0xC9, 0xFA, 0x86, 0xCC, 0x19,
+    0x23, 0x93, 0x89, 0xC9, 0x6D, 0xE4, 0xF1, 0x6A, 0x2D, 0xAE, 0xAD, 0x47, 0xCB, 0x57, 0xD8, 0xC2,
+    0x01, 0x00, 0x04, 0x7C, 0x49, 0x0C, 0x74, 0xA6, 0xFA, 0xD7, 0x13, 0xAC, 0x5F, 0x46, 0x2A, 0x2A,
+    0xAE, 0xAD, 0xC7, 0x91, 0xA6, 0x18, 0xAF, 0x54, 0xF5, 0x82, 0xB0, 0xCD, 0x49, 0xC2, 0xAC, 0xE5,
+    0xC0, 0x10, 0xD2, 0x07, 0x1C, 0xB9, 0xD7, 0x50, 0x27, 0xAE, 0x0F, 0xB3, 0xF4, 0xAE, 0xF7, 0x73,
+    0xA6, 0xC7, 0x7D, 0xC3, 0x38, 0xE1, 0xDC, 0xBC, 0x1A, 0x1A, 0xF3, 0x88, 0xFB, 0x05, 0x40, 0x54,
+    0x1F, 0x31, 0xDA, 0x3B, 0xF9, 0x8F, 0x15, 0x56, 0xBF, 0xB6, 0x6C, 0x5B, 0x26, 0xC0, 0x15, 0xA6,
+    0x42, 0x61, 0xB0, 0x93, 0x20, 0xEE, 0xC7, 0x51, 0x7C, 0x9B, 0xED, 0x2A, 0xD0, 0x26, 0x89, 0x79,
+    0x57, 0xF6, 0xF2, 0x45, 0x12, 0x5D, 0x14, 0xD7, 0x4E, 0x05, 0x7D, 0x5A, 0x98, 0xC8, 0x46, 0xB3,
+    0x99, 0x8E, 0xDC, 0x85, 0x4D, 0x79, 0x47, 0xD4, 0x92, 0x19, 0x8E, 0x19, 0xAB, 0xE6, 0x1C, 0x1A,
+    0xC4, 0xFF, 0xD4, 0x57, 0xCC, 0xEE, 0x90, 0x77, 0xE0, 0xC2, 0x07, 0xC9, 0x20, 0x6E, 0x72, 0xED,
+    0x03, 0xC9, 0xA7, 0xEC, 0x22, 0x48, 0xB6, 0x48, 0xD0, 0x36, 0x5D, 0x6D, 0x6A, 0x2B, 0xA1, 0x95,
+    0xEB, 0x61, 0x5E, 0x47, 0x45, 0xDD, 0x8D, 0x42, 0x59, 0xD3, 0x86, 0x5A, 0x7C, 0x8D, 0xB8, 0xBB,
+    0x4E, 0xBE, 0x97, 0x2C, 0x4A, 0xD5, 0xCA, 0x4C, 0x6F, 0xAA, 0x1D, 0x90, 0x65, 0x73, 0x35, 0x6E,
+    0x6F, 0xE6, 0x5C, 0xD2, 0x35, 0xB0, 0xB8, 0x9E, 0xE8, 0x1F, 0x7D, 0x31, 0xE9, 0x89, 0xA6, 0x8B,
+    0xEF, 0xCB, 0xA8, 0x8F, 0x87, 0x44, 0xC3, 0x99, 0x4A, 0xA9, 0xBF, 0xE8, 0x90, 0xAE, 0x7C, 0x98,
+    0x8C, 0x74, 0x3B, 0xCC, 0xD7, 0x11, 0xDB, 0xFE, 0x73, 0x64, 0x13, 0x55, 0xD1, 0x2C, 0xCD, 0xDC,
+    0x4C, 0xCD, 0xD8, 0x0C, 0xF6, 0x1B, 0x03, 0x7E, 0x22, 0xAF, 0x84, 0x70, 0x9B, 0x4E, 0x3C, 0x6C,
+    0x03, 0x4E, 0x14, 0xD0, 0x19, 0xA1, 0x80, 0x2B, 0x82, 0xD4, 0xE1, 0x0F, 0x9E, 0x0E, 0x0C, 0x2D,
+    0xEA, 0x8D, 0x7E, 0x55, 0xBD, 0x3D, 0xCF, 0xF6, 0x3F, 0x6E, 0x81, 0xEE, 0xF0, 0x9E, 0x5A, 0x2A,
+    0xBB, 0x9C, 0xF0, 0x18, 0xEF, 0x4C, 0xD0, 0x01, 0x05, 0xDB, 0x0E, 0x36, 0xA0, 0x67, 0xC1, 0xBF,
+    0x3B, 0xF1, 0x13, 0xDC, 0xAA, 0x51, 0x6F, 0xF2, 0xE6, 0xD3, 0x22, 0x9A, 0x2A, 0xDF, 0xF1, 0x2A,
+    0x35, 0x56, 0xEB, 0x41, 0x60, 0x94, 0x0D, 0x45, 0xB3, 0xEE, 0x96, 0x75, 0x17, 0xF7, 0x96, 0x01,
+    0x03, 0x39, 0x4A, 0x57, 0x4C, 0xB4, 0xB7, 0xC1, 0x80, 0xC9, 0xD5, 0x93, 0x89, 0xCF, 0x84, 0x80,
+    0x44, 0xC0, 0xB6, 0x1F, 0xA4, 0x9C, 0x88, 0x00, 0x95, 0x9E, 0x31, 0x55, 0x5D, 0x02, 0x52, 0x3E,
+    0x7B, 0x82, 0x98, 0x7E, 0xBA, 0x31, 0x47, 0x93, 0xEE, 0xB6, 0x3F, 0x89, 0xFE, 0xF7, 0x97, 0x33,
+    0xD9, 0x77, 0x97, 0x04, 0x3C, 0x20, 0x5B, 0x11, 0x4D, 0xD0, 0x5A, 0x1F, 0xB2, 0xE2, 0xC2, 0xE3,
+    0xF3, 0xE8, 0x3E, 0x8C, 0xEF, 0xC9, 0x9D, 0x99, 0xD9, 0xC4, 0xBC, 0x85, 0x79, 0xF0, 0x2D, 0x3B,
+    0xC5, 0x3F, 0x26, 0xA8, 0xBC, 0xEC, 0xE7, 0x67, 0xDF, 0x2C, 0x4F, 0xFF, 0xED, 0x1D, 0x49, 0xEE,
+    0x91, 0x35, 0x3A, 0x5A, 0xC3, 0x71, 0xA8, 0xCF, 0xBE, 0x42, 0x55, 0x74, 0x0D, 0x0F, 0xDE, 0xBD,
+    0x7F, 0xFF, 0x63, 0x5C, 0x9E, 0xF7, 0xF3, 0x8D, 0x7B, 0xCD, 0x89, 0x1E, 0x2E, 0x7E, 0xD4, 0x97,
+    0x2B, 0xBF, 0x68, 0x5C, 0x1E, 0x90, 0xFB, 0x24, 0x2C, 0xD5, 0x31, 0x46, 0xDB, 0x02, 0xAA, 0x83,
+    0x75, 0x2C, 0x11, 0xCF, 0x97, 0x9B, 0x96, 0x9C, 0x66, 0x83, 0x54, 0xD9, 0x16, 0x86, 0xD5, 0x22,
+    0xBA, 0x46, 0xC0, 0x5A, 0x9A, 0x51, 0xDF, 0x0D, 0xD6, 0xD3, 0x78, 0x9F, 0x4A, 0xFC, 0xA5, 0x92,
+    0xC0, 0x45, 0xA9, 0x09, 0xA1, 0x35, 0x4E, 0x58, 0x12, 0x2C, 0xF8, 0xDB, 0x7D, 0x2E, 0xEE, 0xA6,
+    0x12, 0xEB, 0x65, 0xBE, 0xB7, 0x7E, 0x77, 0xA9, 0xA4, 0x13, 0x23, 0xCB, 0x76, 0xFF, 0x4A, 0x09,
+    0xE1, 0xB8, 0x4B, 0x25, 0x25, 0x2F, 0x54, 0x04, 0x7C, 0x9B, 0xCB, 0xDB, 0x56, 0x4A, 0x07, 0xA8,
+    0xF7, 0x12, 0xF9, 0x43, 0x9E, 0xA4, 0x1C, 0xD0, 0x73, 0x63, 0x3A, 0xE7, 0xA3, 0x34, 0x0F, 0xE7,
+    0x5B, 0x2E, 0xEA, 0xE1, 0xE9, 0xEC, 0xCF, 0xC6, 0xF0, 0xC9, 0x0B, 0xAD, 0x9E, 0x4F, 0xE1, 0xFC,
+    0x95, 0x56, 0x2F, 0x96, 0x70, 0x36, 0xA2, 0x5A, 0xBE, 0xF3, 0xCF, 0x17, 0x29, 0x2F, 0xB4, 0x73,
+    0x8B, 0x47, 0x9D, 0x1C, 0x22, 0xA3, 0x27, 0x5B, 0x1F, 0x1D, 0x0A, 0x36, 0x3A, 0x4E, 0xC7, 0xB6,
+    0x77, 0x34, 0x98, 0xA1, 0x84, 0x85, 0x3A, 0x03, 0x1D, 0xEA, 0x1D, 0xD4, 0xC5, 0xF7, 0x23, 0xF9,
+    0x75, 0x5E, 0x3D, 0x63, 0x4C, 0x00, 0x3F, 0xBB, 0x7A, 0xA4, 0x37, 0x44, 0x5F, 0x5A, 0x7F, 0xE7,
+    0x23, 0xBF, 0x03, 0xC0, 0x38, 0x07, 0x74, 0x4E, 0x6C, 0x7F, 0xB6, 0x7E, 0x78, 0x74, 0xC1, 0xEF,
+    0x43, 0x44, 0xBF, 0x54, 0xF6, 0xC9, 0xDE, 0x3F, 0x2A, 0xA7, 0xB7, 0xD6, 0x78, 0x32, 0x44, 0x74,
+    0x9D, 0x81, 0x20, 0x77, 0xD9, 0xAC, 0x59, 0x32, 0xEC, 0x00, 0x39, 0x66, 0x61, 0x38, 0x46, 0x9B,
+    0x2C, 0xF3, 0x53, 0x82, 0x67, 0xCD, 0xB3, 0xF0, 0xF9, 0x71, 0xE8, 0x92, 0x70, 0xC1, 0x4E, 0x3C,
+    0xB0, 0x63, 0x4B, 0x78, 0x16, 0xC0, 0xD4, 0x94, 0x01, 0xF5, 0x2D, 0xBB, 0x2E, 0xA2, 0x3B, 0x5A,
+    0x84, 0x4B, 0x65, 0x25, 0x2C, 0x7C, 0x75, 0x27, 0xD6, 0xE7, 0x53, 0xE6, 0x83, 0x79, 0x2A, 0x26,
+    0x07, 0xDC, 0x44, 0xF7, 0xC3, 0xA6, 0x7D, 0x84, 0xF6, 0xA9, 0x64, 0x68, 0x8E, 0xF4, 0x37, 0xF9,
+    0x1F, 0xC7, 0xDF, 0x8D, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x1D, 0xDE, 0xC5, 0x62, 0x71, 0xC5,
+    0x36, 0x96, 0x1B, 0x01, 0xE1, 0x07, 0xB8, 0xE0, 0x0F, 0xC4, 0x21, 0x01, 0x17, 0x69, 0x55, 0x58,
+    0x29, 0xDC, 0xA4, 0x4F, 0xE3, 0x2F, 0x08, 0xC8, 0xC0, 0x1F, 0x60, 0x15, 0x51, 0xED, 0xC6, 0x4D,
+    0x2E, 0xC5, 0x35, 0x29, 0x83, 0x2C, 0x9D, 0xE6, 0x8A, 0x34, 0x2C, 0x6C, 0xB8, 0x25, 0xE0, 0x08,
+    0x71, 0xD4, 0x64, 0x0D, 0x10, 0x30, 0xE5, 0x2C, 0x39, 0x79, 0x6F, 0x48, 0x49, 0x36, 0x9C, 0x22,
+    0x14, 0x66, 0x35, 0xB7, 0xBB, 0xDC, 0x79, 0xEF, 0xCD, 0xEC, 0x50, 0xC4, 0x1E, 0x85, 0xE5, 0x41,
+    0x24, 0xA5, 0xA3, 0x70, 0x0A, 0x38, 0x1B, 0x38, 0xC9, 0x08, 0xA7, 0x78, 0x12, 0x64, 0x13, 0x14,
+    0x3F, 0x5C, 0x2F, 0x45, 0xAD, 0xA5, 0x0B, 0xAE, 0x5F, 0x4D, 0x0F, 0xF5, 0x4D, 0xA5, 0xAA, 0xBF,
+    0xC3, 0xA2, 0xC7, 0xF0, 0x7C, 0xFB, 0x93, 0x46, 0x91, 0x6C, 0x10, 0x59, 0x69, 0x8D, 0x03, 0x23,
+    0x9D, 0x66, 0x76, 0x96, 0x27, 0x57, 0xED, 0x17, 0x1B, 0xF2, 0x8B, 0xED, 0xB3, 0x1C, 0xCB, 0x05,
+    0xAD, 0x5D, 0x4C, 0x9F, 0xC1, 0xB4, 0x86, 0x05, 0x58, 0x3C, 0x14, 0x37, 0x8A, 0xAC, 0x95, 0xF6,
+    0x19, 0xE0, 0x65, 0x65, 0xA6, 0x78, 0x77, 0xC2, 0xDA, 0x08, 0x1B, 0xB8, 0x0F, 0x20, 0xEA, 0x03,
+    0x7D, 0x23, 0x72, 0xA0, 0xA3, 0x38, 0x05, 0x3C, 0xD5, 0x16, 0xD6, 0x6F, 0xF8, 0x2A, 0x62, 0x27,
+    0xE3, 0x42, 0xB1, 0xD8, 0x4F, 0xDC, 0x30, 0xA4, 0x44, 0x0B, 0xEB, 0x7D, 0x4C, 0x15, 0xE8, 0xAA,
+    0x57, 0x98, 0xBF, 0xD4, 0x72, 0x3D, 0x55, 0x9D, 0xE8, 0x13, 0x4C, 0xBC, 0xD6, 0x0B, 0xED, 0x71,
+    0x70, 0xDC, 0xC0, 0xC4, 0xC3, 0x56, 0xFA, 0x87, 0x31, 0xC0, 0xE4, 0x74, 0x65, 0xDF, 0x6E, 0x11,
+    0x51, 0x52, 0x84, 0xD8, 0xC0, 0x1C, 0x6D, 0x98, 0x05, 0xC8, 0x7B, 0x44, 0x83, 0x55, 0xD0, 0xD2,
+    0x87, 0x59, 0x53, 0xED, 0x24, 0xD1, 0x16, 0x07, 0xB5, 0x20, 0xD3, 0x80, 0x4C, 0x03, 0x89, 0x1B,
+    0x00, 0xAA, 0xCD, 0x8E, 0xA6, 0x52, 0x32, 0x55, 0xAC, 0x21, 0x9A, 0x36, 0x55, 0xE7, 0x42, 0xA2,
+    0x09, 0x80, 0x85, 0x0C, 0x8E, 0x68, 0x5D, 0x05, 0x80, 0x19, 0x29, 0x61, 0x0D, 0x14, 0x81, 0x48,
+    0xDA, 0x0C, 0x5C, 0xEE, 0x2B, 0xC2, 0x56, 0xAD, 0xF8, 0xFD, 0x08, 0x1C, 0x1E, 0x0C, 0xF6, 0xD8,
+    0x1C, 0x21, 0x8D, 0xFE, 0x46, 0x92, 0x60, 0x3C, 0xF1, 0xAD, 0x52, 0xEE, 0x22, 0x84, 0xE4, 0x23,
+    0x49, 0xF4, 0x20, 0xA5, 0x65, 0x71, 0xEE, 0x43, 0xD1, 0xAC, 0x27, 0xD7, 0x42, 0x9B, 0x20, 0xEE,
+    0x2D, 0x78, 0x8E, 0x15, 0x20, 0x3F, 0x6D, 0xA4, 0x78, 0x3D, 0x80, 0x8A, 0xBE, 0xF4, 0x13, 0xDE,
+    0xD5, 0xC7, 0xB0, 0x8E, 0x59, 0x13, 0xFF, 0xCE, 0xE4, 0xC4, 0x49, 0xFE, 0xF9, 0x74, 0xE6, 0x03,
+    0xCE, 0xE9, 0x99, 0x2A, 0x84, 0x89, 0xC9, 0x6E, 0x51, 0x29, 0x1B, 0xF2, 0x21, 0x8F, 0x05, 0xFE,
+    0xAA, 0xB1, 0x1A, 0xE5, 0x83, 0xE7, 0x93, 0x95, 0x22, 0xA0, 0xEA, 0xC8, 0xAD, 0x24, 0xD4, 0x1A,
+    0x11, 0x3E, 0x7E, 0x0E, 0xB6, 0xA7, 0x1E, 0x69, 0x68, 0x2A, 0x50, 0x2D, 0x35, 0x38, 0x85, 0x80,
+    0x05, 0xF2, 0xD6, 0x1C, 0x1E, 0xCF, 0x1B, 0xEC, 0x5F, 0x06, 0x3C, 0xB2, 0x99, 0xB8, 0x9F, 0x27,
+    0x24, 0xD0, 0x06, 0x00, 0x41, 0x13, 0xCC, 0x11, 0x25, 0x23, 0xFD, 0xD4, 0x26, 0x0B, 0x4E, 0x0A,
+    0x7F, 0x53, 0xEA, 0x4B, 0xAB, 0x49, 0xA4, 0xE6, 0x0E, 0xC6, 0x39, 0x03, 0x58, 0x49, 0x3C, 0x5F,
+    0x92, 0x23, 0xDB, 0x2A, 0xBE, 0x35, 0x1C, 0xE5, 0xAD, 0x87, 0xBB, 0x90, 0xCF, 0x45, 0xC7, 0x82,
+    0x8F, 0x27, 0xD7, 0x18, 0x93, 0xE3, 0xA3, 0x59, 0x85, 0x81, 0x35, 0xE3, 0xDF, 0x6F, 0x7F, 0xB8,
+    0x6D, 0xF3, 0xDF, 0xD9, 0x22, 0x2F, 0x03, 0x52, 0x4D, 0x65, 0x32, 0x3B, 0x37, 0x65, 0x0A, 0x89,
+    0xB1, 0xB3, 0x82, 0x1A, 0x65, 0x01, 0xC8, 0x05, 0x5B, 0x8E, 0x8C, 0x8D, 0x14, 0x1B, 0xB4, 0x47,
+    0x18, 0xCE, 0x53, 0x03, 0x89, 0x5D, 0xA7, 0x7C, 0xE3, 0xF4, 0xEA, 0xD4, 0x83, 0xF2, 0x03, 0xA5,
+    0xB6, 0x25, 0xCF, 0xAC, 0x2D, 0xB3, 0xC4, 0x91, 0xB2, 0x66, 0xF2, 0x12, 0xB9, 0x6A, 0xAD, 0x40,
+    0xA5, 0x6A, 0xE6, 0x6A, 0xB5, 0x2B, 0x67, 0x8E, 0x6F, 0xE6, 0x9A, 0x5D, 0x91, 0x34, 0x02, 0xAE,
+    0x18, 0xDA, 0x03, 0x84, 0xE3, 0xC5, 0x25, 0x3E, 0x47, 0x4D, 0x6F, 0x1C, 0x48, 0x91, 0x21, 0xBA,
+    0x94, 0xF2, 0x5F, 0x0F, 0xFA, 0xC3, 0x0C, 0x6C, 0x6E, 0x02, 0xBC, 0xD8, 0x51, 0xAC, 0xDA, 0xE5,
+    0xF0, 0xC1, 0x9C, 0xCD, 0x1F, 0xC5, 0xC4, 0x20, 0x5B, 0x80, 0xB5, 0x3E, 0x71, 0x99, 0xF8, 0x5A,
+    0x56, 0x38, 0xBE, 0x28, 0x25, 0x67, 0x86, 0x44, 0x28, 0xC9, 0x97, 0xE2, 0xBA, 0xCD, 0xDF, 0xF2,
+    0x8B, 0x54, 0x82, 0xCA, 0x0A, 0xAB, 0xB8, 0x79, 0x1C, 0xD6, 0xAD, 0xEB, 0xBE, 0x48, 0x1B, 0x57,
+    0x16, 0x75, 0xE7, 0xE4, 0x5E, 0x32, 0xA5, 0xE5, 0xBD, 0x24, 0xA4, 0xC3, 0xE7, 0x49, 0xEF, 0x9A,
+    0x0C, 0x2D, 0xA3, 0xFB, 0x15, 0x2C, 0xBD, 0x3E, 0x0D, 0xB8, 0x30, 0x7E, 0x87, 0x2B, 0x8D, 0x40,
+    0x05, 0xDA, 0x17, 0x28, 0xDD, 0x26, 0xAB, 0x72, 0xEE, 0x42, 0x2F, 0x0E, 0x78, 0x41, 0x4D, 0x53,
+    0xFB, 0xD7, 0xCC, 0x65, 0x60, 0x39, 0xB7, 0x7C, 0x24, 0x7E, 0x3A, 0xFE, 0x98, 0xD7, 0xD2, 0x1D,
+    0x67, 0x36, 0x50, 0xC2, 0xEA, 0xD4, 0xDB, 0x54, 0x41, 0x59, 0x24, 0xFB, 0x87, 0x8A, 0xBA, 0x81,
+    0x53, 0xEB, 0xB1, 0xE8, 0xA8, 0x80, 0xC9, 0xAE, 0xDF, 0x33, 0x6C, 0xD5, 0x16, 0x6C, 0xAC, 0x61,
+    0x6E, 0x15, 0x54, 0x09, 0xFD, 0x09, 0x53, 0x6B, 0x3D, 0xFB, 0x66, 0x34, 0x2D, 0xE6, 0xD4, 0x21,
+    0x0B, 0x44, 0x64, 0x57, 0x16, 0xC0, 0x1C, 0xC7, 0x3E, 0x65, 0x93, 0x98, 0xA8, 0x28, 0xC2, 0xB3,
+    0x99, 0xF8, 0xBE, 0x62, 0xAB, 0xC1, 0xCD, 0x61, 0xD5, 0x22, 0xDB, 0xBD, 0x75, 0x26, 0x0E, 0x48,
+    0x7E, 0x97, 0xB0, 0x81, 0x40, 0x09, 0x0C, 0xC5, 0xF5, 0xC0, 0x9F, 0x77, 0x50, 0x13, 0x24, 0x5A,
+    0x91, 0x26, 0x3D, 0xFB, 0x19, 0xB0, 0x8A, 0x13, 0x51, 0x60, 0x11, 0x83, 0x8B, 0xB3, 0x77, 0x7E,
+    0xE2, 0x23, 0x57, 0x6F, 0x86, 0x61, 0xDE, 0xBC, 0xBC, 0x76, 0x73, 0x53, 0x1F, 0xA1, 0x6D, 0xF3,
+    0xB4, 0x86, 0xD0, 0x23, 0x7B, 0xAC, 0xD6, 0x6B, 0xE2, 0x06, 0xA1, 0x8B, 0x1D, 0x1A, 0x72, 0x4B,
+    0x31, 0x82, 0xCC, 0xF5, 0x20, 0xA9, 0xD5, 0xAE, 0xA7, 0xA8, 0xCE, 0x04, 0xB4, 0xA5, 0x4F, 0xDD,
+    0xC1, 0xDC, 0xD6, 0xAE, 0xEB, 0x8B, 0x5B, 0x3F, 0xF3, 0x0E, 0xA0, 0x67, 0xF1, 0xDC, 0x95, 0xB9,
+    0x8C, 0x33, 0x98, 0x5A, 0xB5, 0x98, 0x9B, 0x2C, 0xC8, 0x4E, 0x79, 0x93, 0x70, 0xE1, 0x88, 0xB4,
+    0xB3, 0xD7, 0x1A, 0xBA, 0x8A, 0x0C, 0xA6, 0xE8, 0xEB, 0x01, 0xE3, 0x9E, 0x45, 0x1E, 0xD9, 0x9F,
+    0xAB, 0x57, 0xFC, 0xBC, 0x4C, 0x74, 0xF3, 0x77, 0x4A, 0xA0, 0xD7, 0xEE, 0xDA, 0xDC, 0x82, 0x6E,
+    0xCA, 0x0D, 0x89, 0xFE, 0xA9, 0xE8, 0x14, 0xA3, 0x1D, 0xB6, 0xD7, 0x2B, 0x59, 0xF4, 0x2B, 0xBD,
+    0xD2, 0x25, 0xA6, 0xBA, 0xA4, 0xE1, 0x2F, 0xB6, 0xAE, 0x9D, 0xB6, 0x9C, 0x25, 0x5C, 0x7E, 0x4A,
+    0xD0, 0x42, 0xDF, 0x9F, 0x94, 0x76, 0xEB, 0x56, 0xA4, 0x68, 0xE5, 0xC1, 0x0F, 0xAF, 0xF8, 0x97,
+    0x5F, 0x9B, 0x62, 0xD4, 0x2E, 0x92, 0x52, 0x20, 0xA3, 0x86, 0xE5, 0x6B, 0x1F, 0x16, 0x56, 0x0A,
+    0x64, 0x68, 0x88, 0xE9, 0xEC, 0xE4, 0x01, 0x99, 0x07, 0x2B, 0x5C, 0x46, 0xBE, 0xCF, 0x98, 0xEE,
+    0x3A, 0x3F, 0xF2, 0xFF, 0x9F, 0x7F, 0x01, 0xBD, 0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x5D, 0x5F,
+    0x4B, 0xB1, 0x14, 0x17, 0xEE, 0x52, 0x24, 0x85, 0x7B, 0x1A, 0xFF, 0x01, 0x6B, 0x85, 0x22, 0x25,
+    0x29, 0x80, 0x26, 0x05, 0x35, 0x34, 0xEF, 0x13, 0x6C, 0x41, 0x41, 0x9B, 0x82, 0x3E, 0x69, 0x90,
+    0xC8, 0x4D, 0xF1, 0xFE, 0x00, 0x1B, 0xDE, 0x0F, 0x58, 0x8A, 0x10, 0x05, 0xCD, 0x8D, 0x9E, 0x52,
+    0xC7, 0x22, 0x7E, 0x92, 0x89, 0xBC, 0x3E, 0x9C, 0x33, 0xEB, 0xFB, 0xEE, 0xCB, 0x23, 0x75, 0xAE,
+    0xB5, 0x73, 0x67, 0xED, 0xDD, 0xD9, 0x99, 0x33, 0x67, 0x66, 0xEF, 0xEE, 0x3B, 0x14, 0xC0, 0x69,
+    0x84, 0xAF, 0x5C, 0x31, 0x3B, 0x57, 0x4E, 0xDB, 0x18, 0x39, 0x80, 0x49, 0xA3, 0xBA, 0x39, 0xF8,
+    0x5E, 0xC3, 0x4F, 0x1F, 0x19, 0xF3, 0x87, 0xA3, 0xE1, 0x70, 0xEE, 0xFE, 0x6F, 0xBF, 0xD4, 0xD4,
+    0x81, 0xC5, 0x24, 0x7A, 0xD9, 0x45, 0x70, 0x29, 0x25, 0x06, 0x07, 0x3C, 0x75, 0xDF, 0xB9, 0x02,
+    0x2D, 0x97, 0xEE, 0x30, 0x6A, 0x87, 0x0F, 0x92, 0x29, 0x57, 0xBA, 0x68, 0x48, 0x93, 0x76, 0x9B,
+    0xDC, 0x7F, 0xEC, 0x32, 0xB4, 0x09, 0xF0, 0x9C, 0x13, 0x7A, 0xFE, 0x05, 0x97, 0x01, 0xB3, 0x5F,
+    0xDC, 0x1D, 0xE0, 0x47, 0x1C, 0x9C, 0xEB, 0x96, 0x0A, 0xB5, 0x2B, 0x16, 0xAE, 0x79, 0x7C, 0x07,
+    0xBD, 0xA2, 0xE3, 0xD9, 0x3A, 0x1A, 0x7D, 0x12, 0x27, 0x99, 0x4D, 0x5C, 0x6E, 0x1E, 0x70, 0xE3,
+    0xFB, 0xDA, 0x55, 0x0C, 0x00, 0x7F, 0xD8, 0xC6, 0x4D, 0x6D, 0xA5, 0xCE, 0x9B, 0x5A, 0x2E, 0x3C,
+    0x2E, 0xC1, 0xC5, 0x2D, 0x35, 0xF0, 0xDC, 0x04, 0xAF, 0x14, 0xD4, 0x51, 0xFD, 0xF3, 0xEB, 0xB3,
+    0xE0, 0x65, 0xFF, 0x95, 0xC4, 0x6A, 0xEA, 0xE5, 0xFF, 0xD4, 0x85, 0xC1, 0x5E, 0x72, 0x9B, 0x07,
+    0xD5, 0x14, 0xEF, 0xE8, 0x87, 0x47, 0x23, 0x54, 0x46, 0x7F, 0xE3, 0xA9, 0x6E, 0x3F, 0x93, 0x3D,
+    0xB3, 0x8F, 0xCF, 0x12, 0x1F, 0x22, 0xD3, 0x31, 0xF0, 0x62, 0xA5, 0xA2, 0x80, 0x8A, 0x70, 0x54,
+    0xF8, 0x29, 0x11, 0x8E, 0xE5, 0x51, 0x51, 0x40, 0x3B, 0x81, 0x29, 0x5C, 0x53, 0x86, 0x6B, 0x99,
+    0x4B, 0x21, 0x70, 0xC7, 0x4D, 0x69, 0xA8, 0x64, 0xD8, 0x8C, 0xE6, 0x32, 0xDA, 0x9D, 0x8C, 0x96,
+    0x4F, 0x1B, 0x21, 0x8B, 0x9E, 0x6C, 0x98, 0x95, 0x43, 0xFA, 0x8D, 0x81, 0xCA, 0xEC, 0xEE, 0x75,
+    0x96, 0x2B, 0x1D, 0xE0, 0xBA, 0x89, 0xF6, 0x0A, 0xD0, 0xE0, 0x4E, 0xA1, 0x8D, 0xE4, 0x42, 0xBA,
+    0x72, 0xEE, 0xFC, 0x6B, 0xCE, 0x33, 0x01, 0xE0, 0x9A, 0xBF, 0x79, 0x7E, 0x1E, 0x2C, 0x67, 0x62,
+    0x07, 0xD3, 0x41, 0x7F, 0x20, 0x12, 0x14, 0xB0, 0xD3, 0xE4, 0x68, 0x81, 0x49, 0xBE, 0x2B, 0x9C,
+    0x52, 0x0B, 0xA8, 0xD2, 0x25, 0x9D, 0xCE, 0x73, 0xCE, 0xB9, 0xD8, 0xCF, 0x1D, 0xFA, 0x94, 0xB9,
+    0xA7, 0x2B, 0x73, 0x81, 0x85, 0x5C, 0x69, 0x30, 0xF9, 0x59, 0x7B, 0x04, 0x80, 0x53, 0xDC, 0x27,
+    0x45, 0x3E, 0xCA, 0x6E, 0x39, 0xCB, 0xEC, 0x6D, 0xC5, 0xB0, 0xB9, 0x06, 0xA9, 0x9A, 0x3E, 0x00,
+    0xE9, 0x5A, 0xD9, 0xBF, 0xB4, 0x14, 0x2B, 0xC3, 0x27, 0x45, 0x0C, 0x1B, 0x4A, 0xC8, 0xE3, 0x44,
+    0x3E, 0x63, 0x2C, 0x69, 0xA3, 0xC2, 0x43, 0x28, 0xC3, 0xAC, 0x9E, 0x81, 0x24, 0x7C, 0x48, 0x2F,
+    0x73, 0x4D, 0x26, 0x46, 0xC7, 0x49, 0x5B, 0x69, 0x42, 0x9F, 0xF1, 0x03, 0x70, 0x68, 0x48, 0x64,
+    0x20, 0x17, 0x91, 0x9B, 0x09, 0x6F, 0x67, 0xFF, 0x0E, 0xCF, 0x56, 0x4E, 0x18, 0xED, 0xF9, 0xEC,
+    0xAF, 0x80, 0x7F, 0x48, 0xBB, 0x2F, 0x41, 0xCE, 0xF8, 0xA9, 0x23, 0x7F, 0x2E, 0xF0, 0x13, 0x1D,
+    0x20, 0x1F, 0x3D, 0xD5, 0x0B, 0x9A, 0x10, 0x25, 0x88, 0xC1, 0x23, 0x4E, 0x7A, 0x8C, 0x0D, 0xB9,
+    0x91, 0x23, 0xD3, 0xC4, 0x0F, 0xDD, 0xD2, 0x18, 0xC6, 0xB1, 0xAA, 0x86, 0xEF, 0x9F, 0xBB, 0x34,
+    0xB0, 0x92, 0x5C, 0xC3, 0x2F, 0x2E, 0x0B, 0xB9, 0xDC, 0xEB, 0x3B, 0x7A, 0xB7, 0x08, 0xF1, 0xAE,
+    0x67, 0x8A, 0xA5, 0x06, 0xA2, 0xC6, 0x94, 0x14, 0x54, 0x51, 0x53, 0x7D, 0xBB, 0x14, 0x4B, 0x19,
+    0xF8, 0xF9, 0x77, 0x5C, 0xAE, 0x54, 0x57, 0x3F, 0xF2, 0xDC, 0xD7, 0x78, 0x36, 0x57, 0x6B, 0xB1,
+    0x52, 0x3D, 0x74, 0xA0, 0x9A, 0x5A, 0x31, 0x32, 0x38, 0x4F, 0x30, 0x58, 0xA4, 0xE4, 0x02, 0x55,
+    0x02, 0x40, 0x55, 0x1C, 0x07, 0x81, 0xA1, 0x1F, 0x67, 0x6B, 0x6D, 0xC9, 0x0D, 0x02, 0x5C, 0x99,
+    0x97, 0x04, 0xE5, 0x94, 0xE1, 0x90, 0x90, 0x19, 0x55, 0x70, 0x9D, 0xDE, 0xF6, 0xDE, 0x9A, 0x4E,
+    0xA5, 0x10, 0x56, 0x51, 0x51, 0x05, 0x68, 0xA4, 0x8D, 0xD9, 0x8D, 0xE4, 0xFD, 0xD6, 0xB2, 0xFC,
+    0x97, 0x7D, 0x98, 0xEC, 0x43, 0x88, 0x1F, 0xC4, 0xBC, 0x1D, 0x77, 0x1C, 0xB8, 0x6F, 0x04, 0x7E,
+    0x7E, 0x02, 0x36, 0x09, 0x15, 0xA2, 0x75, 0x21, 0xD4, 0x9D, 0x35, 0x84, 0xE2, 0xD8, 0x92, 0x98,
+    0x8A, 0x63, 0x73, 0x78, 0xA0, 0xE6, 0x10, 0x7F, 0x77, 0xF7, 0x2F, 0x9C, 0xD8, 0xDE, 0x6A, 0x85,
+    0x28, 0x4F, 0x7E, 0x4D, 0x89, 0xB0, 0x75, 0x84, 0xA6, 0xDE, 0xAD, 0x59, 0x20, 0x7A, 0xA5, 0x98,
+    0xDF, 0xBC, 0x79, 0x42, 0x80, 0x68, 0x5F, 0x56, 0x46, 0x1D, 0xD5, 0xF2, 0x88, 0x59, 0xD1, 0xD5,
+    0xB9, 0x5A, 0x9E, 0xB5, 0x35, 0x31, 0xDF, 0xDA, 0x5C, 0x61, 0x1E, 0x9B, 0xF3, 0xE3, 0xCD, 0x57,
+    0xCA, 0xD8, 0xF5, 0x2F, 0x11, 0xEF, 0xAD, 0x87, 0xB6, 0x56, 0x2B, 0x5A, 0xD5, 0x6D, 0x7D, 0x6C,
+    0x10, 0xD5, 0x68, 0x33, 0xA7, 0x1B, 0xF6, 0xC2, 0xCA, 0x95, 0xA4, 0x57, 0x2D, 0x57, 0xD3, 0x4E,
+    0xD4, 0x6D, 0x0E, 0x11, 0xB7, 0x7E, 0x2B, 0xF4, 0x08, 0xDC, 0x56, 0xFA, 0x5B, 0x7D, 0x6C, 0xCD,
+    0x80, 0xD8, 0x0F, 0x25, 0xBD, 0xED, 0x8B, 0x2B, 0x0C, 0x19, 0xDE, 0xF0, 0x4C, 0xB7, 0xF5, 0xD1,
+    0x2A, 0x62, 0x64, 0xBD, 0x2C, 0x36, 0xF4, 0xF1, 0xD8, 0xD7, 0xED, 0xE5, 0xE6, 0x9B, 0xDA, 0x75,
+    0x66, 0xF5, 0x7C, 0xE3, 0x2F, 0x82, 0xB8, 0xE7, 0x02, 0xA6, 0x9D, 0xF6, 0x26, 0x89, 0xE0, 0x8A,
+    0xAB, 0x6F, 0x68, 0x7E, 0x74, 0x5D, 0x4B, 0xE1, 0xFB, 0x93, 0xE0, 0x25, 0xD4, 0x48, 0xA0, 0x2F,
+    0xDF, 0x9F, 0xA3, 0xD6, 0xBD, 0xA1, 0xF3, 0x97, 0x6B, 0xA1, 0xE9, 0x23, 0xD4, 0x7E, 0x51, 0x54,
+    0x8B, 0x8B, 0xE2, 0x20, 0x31, 0xF2, 0x12, 0x89, 0x62, 0x96, 0x58, 0xFC, 0x4A, 0xF1, 0xD9, 0x0B,
+    0xB7, 0xFF, 0x75, 0x43, 0x33, 0x53, 0x16, 0x12, 0xF3, 0xB4, 0xB4, 0xBB, 0x69, 0x4B, 0xFA, 0xF0,
+    0xE0, 0x78, 0xE7, 0x58, 0xA5, 0x18, 0x3C, 0xB1, 0xF7, 0xB9, 0x4A, 0x64, 0x65, 0xAC, 0xFF, 0x3A,
+    0x03, 0x7E, 0xB0, 0x3D, 0x31, 0xFA, 0x49, 0x44, 0xB1, 0xDB, 0xEB, 0xCC, 0x64, 0x2C, 0x33, 0x66,
+    0xE3, 0x73, 0x6E, 0x0B, 0x3B, 0x71, 0x59, 0x57, 0x29, 0x8C, 0x14, 0x08, 0x91, 0x68, 0xC2, 0x89,
+    0x37, 0xC9, 0x99, 0x19, 0xFC, 0xC4, 0xBF, 0xFF, 0x00, 0x9D, 0x55, 0x31, 0xCF, 0xDC, 0x44, 0x10,
+    0x9D, 0x5B, 0x4B, 0xB9, 0xC2, 0xC5, 0xD2, 0xA7, 0x30, 0x25, 0xA2, 0xF1, 0x1F, 0x08, 0xAC, 0x81,
+    0x22, 0x05, 0x0D, 0x05, 0xA9, 0x28, 0xA8, 0x68, 0xD2, 0xA4, 0xA5, 0x62, 0x2D, 0x90, 0x48, 0xC9,
+    0xDF, 0x88, 0xAE, 0xC9, 0x4F, 0x58, 0x7F, 0xA1, 0xA0, 0xB5, 0x44, 0x41, 0x19, 0x23, 0x42, 0x43,
+    0x83, 0x11, 0x1B, 0xC9, 0x17, 0x6C, 0x0F, 0xEF, 0x8D, 0x2F, 0xB9, 0x7C, 0xF7, 0x45, 0x29, 0x62,
+    0xCD, 0xAD, 0x46, 0x73, 0xEB, 0x9D, 0xF7, 0xDE, 0xCC, 0x8E, 0xA3, 0xE2, 0xF9, 0x87, 0x8B, 0xFE,
+    0x62, 0x6B, 0xC5, 0x65, 0x8E, 0x5C, 0x47, 0x11, 0xED, 0x44, 0xA4, 0x50, 0x2C, 0xE2, 0x67, 0xAE,
+    0x61, 0xE4, 0x6A, 0xE1, 0xBD, 0x85, 0x2B, 0x0B, 0x47, 0x86, 0x77, 0x6F, 0x0B, 0x97, 0xDA, 0x60,
+    0xAD, 0x17, 0x86, 0x53, 0xC6, 0xE2, 0xB4, 0x7F, 0x43, 0x38, 0xCE, 0x48, 0xF7, 0x2B, 0xDE, 0x08,
+    0x4B, 0xB8, 0x70, 0x7F, 0xA6, 0x3B, 0xDF, 0x74, 0x5B, 0xBA, 0x13, 0xCE, 0xA3, 0x5B, 0xBF, 0xD9,
+    0x9D, 0x6A, 0xEE, 0xFD, 0x1E, 0x29, 0xE3, 0x54, 0xEB, 0x5F, 0x49, 0x3F, 0x21, 0xC1, 0xEC, 0xB9,
+    0x8A, 0x71, 0xDD, 0x63, 0x59, 0xA4, 0xC6, 0xDA, 0x0A, 0xD8, 0x13, 0xDB, 0x89, 0x6E, 0xA1, 0x7E,
+    0x21, 0x8B, 0x27, 0xE4, 0xA1, 0x3D, 0x43, 0x61, 0xF4, 0x2B, 0x50, 0xCF, 0x0E, 0x21, 0x78, 0x31,
+    0x83, 0x87, 0x78, 0xC5, 0xD6, 0x0E, 0xA1, 0x9D, 0x0E, 0x48, 0x23, 0xD0, 0x0F, 0x21, 0x10, 0x02,
+    0xD3, 0x1A, 0xDB, 0xE3, 0xE4, 0x41, 0xD6, 0x6B, 0x89, 0x97, 0x0A, 0xFD, 0x03, 0x9B, 0x24, 0xAE,
+    0x0A, 0xCE, 0x40, 0x31, 0x33, 0x8D, 0xAE, 0x14, 0x41, 0xA9, 0x08, 0x42, 0x9D, 0x85, 0x06, 0x0B,
+    0x51, 0xAF, 0x8A, 0x9B, 0x10, 0x5A, 0x4D, 0x2A, 0x6E, 0xFA, 0xF0, 0x11, 0x5D, 0x77, 0xF8, 0xC9,
+    0x14, 0x17, 0x1C, 0xD9, 0x99, 0xE8, 0xD9, 0xF4, 0x05, 0xBC, 0xCA, 0xF6, 0x7A, 0x2D, 0x4E, 0x65,
+    0x6C, 0x75, 0xAB, 0x47, 0x0F, 0xBD, 0xFD, 0x28, 0x69, 0x2C, 0xB5, 0x05, 0xFC, 0x30, 0xEF, 0xC8,
+    0xBF, 0x33, 0xB7, 0xD0, 0xBC, 0xD7, 0xC6, 0xEB, 0x4E, 0xD5, 0x91, 0x4D, 0x0F, 0x2D, 0xF0, 0x5A,
+    0x9C, 0xA2, 0x52, 0xCF, 0x4A, 0x83, 0xEA, 0xD7, 0x0B, 0x0E, 0xFB, 0x5B, 0xF5, 0x3F, 0x24, 0x86,
+    0x60, 0x8F, 0x09, 0x16, 0xCA, 0xFD, 0x46, 0xB8, 0xD0, 0x71, 0x54, 0x02, 0x56, 0x85, 0xD2, 0x80,
+    0x1C, 0x14, 0x67, 0x2A, 0x61, 0xAC, 0x42, 0x71, 0x1D, 0x08, 0x56, 0xD4, 0x37, 0x6A, 0x57, 0x10,
+    0x90, 0xC7, 0x5B, 0xDC, 0xE8, 0xED, 0xC7, 0xF6, 0xA9, 0x47, 0xC7, 0x2A, 0x20, 0xDC, 0xB3, 0xD5,
+    0xD2, 0x58, 0x80, 0x6E, 0x98, 0xA0, 0xB1, 0x54, 0x0B, 0x3B, 0xAB, 0x54, 0xE8, 0x4B, 0x79, 0x46,
+    0xF6, 0x91, 0x15, 0x8B, 0x47, 0xF3, 0x4C, 0xAB, 0x9A, 0xF1, 0xDE, 0x7C, 0x13, 0xD2, 0x99, 0x90,
+    0x7B, 0x3D, 0xAB, 0x1D, 0x34, 0xB2, 0x24, 0x4B, 0x8D, 0x93, 0x15, 0x85, 0x21, 0x94, 0x52, 0x87,
+    0x52, 0xFB, 0x82, 0x6D, 0x81, 0x1A, 0xCE, 0x81, 0x7F, 0xAD, 0x56, 0xEE, 0x9C, 0x06, 0xB6, 0x31,
+    0x12, 0xF9, 0x85, 0x35, 0x8F, 0x44, 0x04, 0x3D, 0x81, 0x08, 0x70, 0xAA, 0x45, 0x70, 0x7C, 0x30,
+    0xE8, 0x31, 0x43, 0x24, 0xC1, 0x8D, 0xEA, 0xF0, 0xC2, 0xD3, 0xD5, 0x40, 0x66, 0x02, 0x26, 0x0C,
+    0xAF, 0xEC, 0xF3, 0xDA, 0xAA, 0x10, 0xAC, 0xF1, 0xD3, 0x6C, 0x05, 0x19, 0xEC, 0xDE, 0x90, 0x40,
+    0xBD, 0x95, 0x77, 0xB2, 0x0B, 0x32, 0x5A, 0xF5, 0x3A, 0xDB, 0x6D, 0x5C, 0x66, 0x23, 0x01, 0x02,
+    0xD6, 0xB8, 0x23, 0xBB, 0x55, 0xBB, 0x60, 0x4D, 0x9C, 0x18, 0x96, 0xFB, 0x87, 0x44, 0x35, 0x0A,
+    0x4B, 0x14, 0x78, 0xAE, 0xA3, 0xF6, 0x5B, 0x4E, 0x67, 0xAD, 0x55, 0x13, 0x8F, 0x33, 0xB9, 0xAC,
+    0x3E, 0xCE, 0xA0, 0xBD, 0x74, 0x7B, 0xBA, 0x2B, 0x31, 0xE9, 0xF3, 0x7B, 0x5F, 0x6C, 0x69, 0x6C,
+    0x18, 0x5C, 0xD9, 0x74, 0xB8, 0x7B, 0x39, 0x23, 0xF2, 0xAD, 0xC3, 0xA3, 0x52, 0xE7, 0xCD, 0xFC,
+    0x24, 0xB4, 0x7C, 0xDD, 0xC6, 0xB3, 0x55, 0xD7, 0xAD, 0xDE, 0x6C, 0x38, 0x5B, 0x80, 0xF5, 0x37,
+    0xAC, 0x3B, 0x59, 0xC4, 0xF5, 0x25, 0x9C, 0xB3, 0x81, 0xDA, 0x7B, 0x22, 0xEF, 0x8B, 0x7C, 0x20,
+    0x72, 0x47, 0xE4, 0x23, 0x91, 0x8F, 0x51, 0x03, 0x58, 0xC3, 0xFD, 0x75, 0x27, 0xD5, 0x60, 0xA9,
+    0x71, 0x41, 0x27, 0x29, 0x30, 0x03, 0x16, 0x90, 0x04, 0x39, 0x68, 0xD9, 0x4A, 0xC2, 0x89, 0x9D,
+    0xA5, 0x04, 0x9A, 0x6C, 0xD0, 0x67, 0x29, 0x67, 0xD9, 0x63, 0xEB, 0x28, 0x6E, 0x94, 0x1D, 0xD4,
+    0x80, 0x36, 0xCD, 0xFD, 0x43, 0x1B, 0xB5, 0xDF, 0xCC, 0x00, 0x0D, 0xD7, 0x40, 0x6F, 0x34, 0x2E,
+    0xB8, 0xBD, 0x4E, 0xFB, 0x52, 0x11, 0x93, 0xA9, 0x7C, 0x65, 0x5B, 0xD2, 0xB3, 0xE1, 0xA6, 0x6F,
+    0xE6, 0xCD, 0xE4, 0xE5, 0xC3, 0x9A, 0x02, 0x33, 0x47, 0x0A, 0x2F, 0x8F, 0xC4, 0xA7, 0xB3, 0xA4,
+    0x36, 0x75, 0xA9, 0x29, 0xB6, 0x4D, 0x56, 0xAE, 0x7F, 0xAD, 0x38, 0x5C, 0x56, 0xEB, 0x0C, 0x76,
+    0xD5, 0xBD, 0x06, 0x90, 0x3D, 0x47, 0x60, 0xC3, 0x56, 0xAD, 0x5F, 0x9D, 0x79, 0x7B, 0x62, 0xBD,
+    0xB5, 0x45, 0x45, 0x07, 0x7F, 0x4C, 0xF3, 0x3E, 0x17, 0x5A, 0x4C, 0x90, 0x85, 0x03, 0x22, 0x88,
+    0x5B, 0x2A, 0xC8, 0xF4, 0xF9, 0x20, 0xD5, 0xEF, 0x19, 0xB2, 0x7C, 0x07, 0xF1, 0xAA, 0x3F, 0xBF,
+    0xC2, 0x48, 0x45, 0x57, 0xA4, 0x53, 0x1B, 0x62, 0x92, 0xA6, 0xBE, 0x5C, 0x1B, 0x6A, 0x49, 0xFC,
+    0x72, 0x76, 0x02, 0x67, 0xD8, 0x75, 0xE7, 0x09, 0x46, 0xC7, 0x82, 0xEE, 0x04, 0x34, 0xA4, 0x42,
+    0xEB, 0xD5, 0xFA, 0xE3, 0x8A, 0x29, 0xB3, 0x1F, 0x01, 0x2A, 0x7C, 0xAA, 0xAD, 0x9B, 0x50, 0x8A,
+    0xFA, 0x0A, 0xD7, 0x6B, 0x86, 0x13, 0xAF, 0xB4, 0xAF, 0x2C, 0x4D, 0xCB, 0x66, 0x2B, 0x39, 0x23,
+    0x03, 0x39, 0x59, 0xA7, 0x7E, 0x73, 0x62, 0xF1, 0xE0, 0x88, 0xB9, 0x34, 0xED, 0xC8, 0x01, 0xFF,
+    0xA5, 0x9E, 0x65, 0x66, 0x0D, 0x88, 0x04, 0xE5, 0xA6, 0xBC, 0x2C, 0xB0, 0x7D, 0x8E, 0x74, 0xF8,
+    0xD6, 0x6D, 0xB9, 0xB3, 0xE3, 0xFC, 0x48, 0x47, 0x9B, 0x18, 0xFD, 0x0D, 0xA4, 0x17, 0x4E, 0xF5,
+    0x2C, 0x76, 0x1C, 0x1D, 0x06, 0x1A, 0x3F, 0xC0, 0xAC, 0xF5, 0x87, 0x05, 0x57, 0x35, 0x60, 0x76,
+    0x3C, 0xCC, 0x98, 0x4F, 0xA9, 0x71, 0x7A, 0x17, 0xE0, 0x73, 0xC4, 0x6C, 0xF8, 0x6C, 0xE6, 0x2C,
+    0x78, 0xF1, 0x18, 0x1F, 0x1D, 0xE5, 0x80, 0x21, 0x30, 0x38, 0xC8, 0x99, 0x5A, 0xC7, 0x7B, 0x78,
+    0xFB, 0xB8, 0x5D, 0x4B, 0xD0, 0x69, 0x42, 0xAE, 0x46, 0xE0, 0x5D, 0xFC, 0x8B, 0x83, 0x89, 0xCB,
+    0x0F, 0xF2, 0xC2, 0xFB, 0xF5, 0xE0, 0xF8, 0xA5, 0x49, 0xB9, 0xE3, 0x1B, 0x61, 0x91, 0xB2, 0x3C,
+    0xA5, 0x1F, 0x2B, 0x5E, 0x77, 0xCA, 0x71, 0x4B, 0x9F, 0xC9, 0xBB, 0x3F, 0xFF, 0x03, 0x5D, 0x55,
+    0xBD, 0x72, 0xDE, 0x44, 0x14, 0xBD, 0x92, 0xC6, 0x51, 0xA1, 0x19, 0x44, 0xED, 0x14, 0xEA, 0x69,
+    0xF6, 0x11, 0x56, 0x0C, 0x05, 0x05, 0x85, 0x53, 0x84, 0x86, 0x37, 0xA0, 0xF2, 0x23, 0xAC, 0x18,
+    0x1E, 0x00, 0x3F, 0x42, 0x2A, 0x86, 0x71, 0x01, 0x2D, 0x55, 0x56, 0xD8, 0x85, 0x8B, 0x34, 0xC2,
+    0x14, 0xB4, 0x1A, 0xC6, 0x33, 0x81, 0xA1, 0xC8, 0x26, 0x23, 0x83, 0x1C, 0x76, 0x75, 0x38, 0x77,
+    0xF5, 0xD9, 0x84, 0x7C, 0x23, 0xED, 0x5E, 0xFD, 0xED, 0x9E, 0x7B, 0xEE, 0x39, 0xF7, 0x93, 0xC7,
+    0x51, 0x7C, 0x2C, 0x10, 0x2B, 0x1E, 0x51, 0xF6, 0xC3, 0x23, 0x3D, 0x1C, 0x75, 0x92, 0x2A, 0x49,
+    0xFD, 0x70, 0x6C, 0xFF, 0x1D, 0xCD, 0xC3, 0x01, 0x11, 0x73, 0xE3, 0x07, 0x07, 0x3F, 0x3B, 0x60,
+    0xB5, 0xFF, 0x20, 0x99, 0xD1, 0xE0, 0x64, 0xAA, 0xF0, 0x6B, 0x10, 0x77, 0xBB, 0x4A, 0x9B, 0x9E,
+    0x4B, 0x85, 0xD3, 0x41, 0x70, 0xC5, 0x1B, 0xAF, 0x37, 0x71, 0xD1, 0x02, 0x68, 0x78, 0x8E, 0x3C,
+    0x43, 0x07, 0x10, 0x05, 0x20, 0x8F, 0x7E, 0x77, 0x03, 0x57, 0x9B, 0x45, 0xDA, 0xE5, 0x03, 0x69,
+    0x89, 0xCB, 0x6F, 0xF9, 0x81, 0x07, 0x06, 0x7E, 0x32, 0x1C, 0xF9, 0x4D, 0x9F, 0x89, 0x08, 0xFA,
+    0x77, 0x83, 0xA0, 0x81, 0xEC, 0x41, 0xA1, 0x41, 0xF7, 0x06, 0x67, 0xFA, 0xE5, 0xC0, 0xB5, 0x53,
+    0x89, 0x0D, 0xC1, 0x44, 0x41, 0x09, 0xA9, 0x17, 0x1B, 0xC4, 0x7E, 0x02, 0xA9, 0x56, 0x0D, 0xBE,
+    0xE6, 0x1D, 0x0D, 0xDC, 0x25, 0xA4, 0x89, 0x0C, 0x70, 0x05, 0x6E, 0xEC, 0x72, 0xD0, 0x77, 0xD1,
+    0x2F, 0x25, 0xC6, 0xA3, 0x27, 0xEE, 0x02, 0x9F, 0x6D, 0x76, 0xC5, 0xDF, 0x18, 0x25, 0xFF, 0xAA,
+    0xD8, 0x06, 0x3B, 0xE2, 0x9D, 0xC9, 0xFD, 0x84, 0x3A, 0x76, 0x8B, 0xFF, 0x0D, 0x83, 0xB4, 0x93,
+    0xD8, 0xA1, 0xD0, 0x15, 0xC5, 0x04, 0xF9, 0xDF, 0xAF, 0x20, 0x7B, 0xAB, 0x74, 0xB3, 0xB8, 0xBE,
+    0x4C, 0xD2, 0x2C, 0x62, 0x26, 0xF1, 0x52, 0x46, 0x69, 0x82, 0x98, 0x91, 0x21, 0x4B, 0xC0, 0x2C,
+    0xEC, 0x28, 0x1B, 0x21, 0x92, 0x8B, 0x0F, 0xD1, 0x23, 0x55, 0x08, 0x2D, 0x46, 0x97, 0xE4, 0xCB,
+    0xFE, 0x90, 0xB5, 0xBC, 0x97, 0x75, 0x0E, 0xBA, 0x90, 0x37, 0x10, 0x5D, 0x5F, 0xCA, 0xED, 0xE8,
+    0xA9, 0x98, 0x6B, 0x70, 0x1F, 0x37, 0x8B, 0x79, 0xC5, 0xEA, 0x92, 0x49, 0xB1, 0x4C, 0xA1, 0xC2,
+    0xA2, 0x41, 0xCF, 0x20, 0x69, 0xB0, 0xEA, 0xA3, 0x59, 0xEC, 0x2B, 0x0C, 0x75, 0x72, 0x10, 0x77,
+    0x8D, 0x58, 0x6F, 0x2D, 0x82, 0x9F, 0x2D, 0xA6, 0x2E, 0xD4, 0x2B, 0x57, 0xF5, 0xBD, 0x99, 0x9A,
+    0x85, 0x7A, 0x00, 0xD1, 0xB5, 0x81, 0x38, 0xEF, 0x03, 0x66, 0xEA, 0x46, 0xBE, 0x75, 0x08, 0xF0,
+    0x02, 0x7F, 0x61, 0xF3, 0xF7, 0x54, 0x49, 0xB3, 0xFA, 0x33, 0x26, 0xDA, 0xA8, 0x38, 0x48, 0x2E,
+    0x58, 0x0D, 0x8C, 0x2D, 0xFE, 0xE4, 0x3B, 0xA1, 0xDD, 0x84, 0xA9, 0x2D, 0x2D, 0x75, 0x37, 0xD7,
+    0x6B, 0xB7, 0x8A, 0x9B, 0xC8, 0xE2, 0x3E, 0x99, 0x45, 0xFC, 0x98, 0x27, 0x70, 0xB2, 0x3A, 0xED,
+    0x25, 0x1A, 0x74, 0x2A, 0x30, 0xB4, 0x9C, 0x4A, 0xF4, 0x3A, 0x55, 0x9C, 0x92, 0xE3, 0x44, 0xB1,
+    0xB9, 0x39, 0x4F, 0xBA, 0x75, 0xFD, 0xDA, 0x3F, 0xCB, 0x02, 0xA2, 0x32, 0x83, 0xA1, 0x14, 0x28,
+    0x58, 0x7F, 0xC1, 0xA7, 0x01, 0x43, 0x15, 0xED, 0x24, 0x38, 0x59, 0xC4, 0xFE, 0xB2, 0x91, 0x54,
+    0xDE, 0xD8, 0xEC, 0x2C, 0xF8, 0x26, 0x8A, 0x7B, 0x09, 0xE9, 0xEE, 0xB8, 0x1B, 0x1C, 0xD7, 0x27,
+    0x71, 0x3E, 0xC8, 0x63, 0xAE, 0xE7, 0x48, 0x1B, 0x17, 0xEA, 0x2D, 0x81, 0x9B, 0x85, 0x04, 0x11,
+    0xE7, 0x25, 0xCB, 0x75, 0x4B, 0x35, 0x6D, 0x8E, 0xC5, 0xFB, 0x81, 0x35, 0x7C, 0xC9, 0x1B, 0x77,
+    0xE8, 0xB9, 0x18, 0xD1, 0x9C, 0x70, 0xEF, 0x0B, 0x9E, 0xA4, 0x11, 0xA1, 0x46, 0xFE, 0x7E, 0xA1,
+    0x42, 0x27, 0x62, 0x3B, 0xEE, 0xF9, 0xF2, 0xBE, 0xE2, 0xA2, 0x18, 0xF9, 0x7C, 0x6E, 0xE7, 0x96,
+    0xE0, 0x46, 0xCB, 0xC2, 0x0F, 0x7C, 0xE9, 0x39, 0xD3, 0x2A, 0x22, 0x53, 0xA9, 0xC3, 0x7E, 0x6B,
+    0x29, 0x36, 0x56, 0x0A, 0x4B, 0xA7, 0xD6, 0xF1, 0x59, 0xDA, 0xFC, 0xB0, 0xDD, 0xB0, 0x89, 0x0D,
+    0xDF, 0x53, 0x72, 0xB4, 0x4F, 0xA3, 0x99, 0x9B, 0x2C, 0x12, 0x56, 0xA0, 0xCA, 0xBA, 0x88, 0x1C,
+    0xFC, 0x7B, 0x4A, 0x34, 0x8B, 0xE3, 0x07, 0xF0, 0x03, 0x71, 0x91, 0xBD, 0x3B, 0x8F, 0xDE, 0xB0,
+    0x2C, 0xBD, 0xED, 0x69, 0x69, 0xA7, 0x1F, 0xE6, 0xC1, 0x3F, 0x0C, 0xBC, 0xA4, 0x75, 0x07, 0x52,
+    0x68, 0x75, 0x43, 0xD2, 0xB9, 0x69, 0x35, 0x93, 0x56, 0x36, 0x09, 0x91, 0xA4, 0x42, 0xCC, 0x5D,
+    0x3A, 0x55, 0x0B, 0x42, 0x87, 0xED, 0x30, 0x94, 0xFB, 0x70, 0xC6, 0xE1, 0x66, 0xDF, 0xBB, 0xBD,
+    0xF5, 0x55, 0x36, 0xFF, 0x62, 0x91, 0x5A, 0x7C, 0xAC, 0x28, 0x29, 0x47, 0x16, 0x84, 0xEA, 0x66,
+    0xA7, 0x29, 0x78, 0xE1, 0x27, 0x31, 0xEC, 0x1D, 0xB4, 0x01, 0xF3, 0x00, 0x2D, 0x1A, 0xEF, 0xF5,
+    0x84, 0x1B, 0xE9, 0x14, 0xF2, 0x5B, 0x3F, 0x56, 0x8B, 0x3C, 0x11, 0x7D, 0x60, 0x35, 0xF3, 0x8D,
+    0xBD, 0x80, 0x9E, 0xE7, 0x1B, 0xDC, 0xD0, 0x50, 0xD1, 0x9A, 0x79, 0x5F, 0x62, 0xF8, 0x91, 0xF2,
+    0x72, 0x6F, 0xFD, 0x4A, 0xAE, 0xB5, 0xF5, 0xA4, 0x8C, 0xF8, 0x18, 0x07, 0x34, 0x42, 0x64, 0xA7,
+    0xBD, 0xB6, 0xBA, 0x6C, 0x2E, 0x7A, 0x4F, 0xDD, 0xC4, 0xF4, 0x9A, 0xFD, 0xF5, 0x70, 0x8E, 0xF3,
+    0xA1, 0x8E, 0xBB, 0xBF, 0x58, 0x67, 0xED, 0x30, 0xB4, 0x76, 0xF6, 0xB6, 0x1F, 0x99, 0xD9, 0xB7,
+    0x7D, 0x93, 0x09, 0xD1, 0xEE, 0x49, 0x7D, 0xEE, 0xCA, 0xF7, 0xBD, 0xA0, 0x9B, 0xC4, 0x5D, 0x2D,
+    0xD2, 0xB1, 0xE7, 0xD5, 0x51, 0xE9, 0x6E, 0x69, 0xFC, 0x4B, 0xFA, 0x3F, 0xE4, 0x76, 0x33, 0x96,
+    0xA0, 0x77, 0x71, 0x99, 0xC4, 0x2E, 0x98, 0x4C, 0x22, 0xA5, 0xF8, 0x94, 0xE7, 0xA4, 0x35, 0x56,
+    0xB9, 0x6A, 0xB1, 0x87, 0x2C, 0x3D, 0xDD, 0x95, 0x7A, 0x13, 0x7C, 0x05, 0xBD, 0xA2, 0x52, 0xED,
+    0xCC, 0x4A, 0x13, 0x11, 0xBD, 0xC4, 0x36, 0xB3, 0x68, 0xAF, 0x46, 0xE6, 0xF1, 0x67, 0x92, 0xC7,
+    0xCE, 0xA5, 0x36, 0xF7, 0xB3, 0xAA, 0x96, 0x30, 0x5B, 0x7A, 0x9C, 0x40, 0x55, 0x1A, 0x2E, 0x77,
+    0xCC, 0x5D, 0x1B, 0x7B, 0x3E, 0x0C, 0xC8, 0xBC, 0x64, 0xFD, 0x93, 0x7D, 0x13, 0x8A, 0xBE, 0x61,
+    0x2B, 0x6B, 0x42, 0xBB, 0xB6, 0xF4, 0x64, 0x47, 0x7B, 0xDA, 0x68, 0x42, 0x13, 0x1D, 0x45, 0x5D,
+    0xD3, 0xBD, 0x7E, 0x56, 0x60, 0x98, 0xF2, 0x38, 0x96, 0x79, 0x54, 0x09, 0x93, 0x7A, 0x3E, 0xE4,
+    0xFA, 0x48, 0x74, 0x3A, 0xFF, 0x5B, 0x3A, 0x6D, 0x38, 0x6A, 0x72, 0xF9, 0xE8, 0xEC, 0xD1, 0x77,
+    0x2A, 0x22, 0x62, 0x75, 0x33, 0xC9, 0x6B, 0x92, 0xEA, 0x14, 0x2F, 0xF8, 0xA8, 0xDB, 0xE5, 0xA1,
+    0x42, 0xD5, 0xAF, 0xA4, 0x56, 0x15, 0x67, 0x6C, 0xB9, 0x61, 0x95, 0xDA, 0x9A, 0x68, 0xC3, 0x8D,
+    0x0C, 0x5C, 0x63, 0x2A, 0x68, 0x26, 0x36, 0x1A, 0x9A, 0x6B, 0x54, 0x51, 0xAC, 0x4E, 0x35, 0xC3,
+    0x6C, 0xD8, 0x7F, 0x87, 0x72, 0xD3, 0x1D, 0x16, 0xD5, 0xEA, 0xD8, 0xA4, 0x92, 0xF2, 0x8C, 0x2C,
+    0xA8, 0x59, 0x99, 0xA3, 0x7D, 0xC3, 0x4D, 0xBC, 0xF6, 0x3D, 0x2D, 0x4F, 0x56, 0x64, 0xEE, 0x82,
+    0x8D, 0x12, 0xA1, 0x00, 0x77, 0xCB, 0x90, 0x35, 0xFD, 0x77, 0x63, 0xB0, 0xE8, 0xEE, 0x23, 0x89,
+    0xCA, 0x1D, 0x92, 0xC4, 0xEC, 0x9F, 0x0C, 0x07, 0xC9, 0xE4, 0xCA, 0x50, 0x1B, 0x51, 0x83, 0xF1,
+    0xF8, 0xDC, 0xAF, 0xFB, 0x32, 0xF9, 0x0D, 0xC5, 0x6E, 0xA3, 0xB2, 0xAC, 0xD9, 0x68, 0xE9, 0x94,
+    0x68, 0x15, 0x10, 0x3E, 0x7F, 0xAA, 0x1F, 0x4C, 0xFA, 0xFF, 0x97, 0x9D, 0xEC, 0x90, 0xE5, 0xF2,
+    0xC5, 0x33, 0xCA, 0x67, 0x54, 0x58, 0x1D, 0x51, 0x79, 0x4D, 0x58, 0x94, 0x2B, 0xB2, 0x97, 0x7D,
+    0x5C, 0x1D, 0x2E, 0xD9, 0xC9, 0x59, 0xBF, 0x92, 0x4A, 0x53, 0xE0, 0x86, 0x9B, 0x39, 0xEC, 0x96,
+    0xEF, 0x08, 0x9F, 0x5C, 0xA8, 0x73, 0xF4, 0x32, 0x6B, 0x73, 0xE2, 0x32, 0x7F, 0x10, 0x41, 0x22,
+    0x12, 0xAA, 0x90, 0x1D, 0xA5, 0xD1, 0xE2, 0xDF, 0xFF, 0xFE, 0x05, 0x85, 0x55, 0xBF, 0x73, 0xDD,
+    0x44, 0x10, 0x5E, 0x49, 0x38, 0x9A, 0x41, 0xC5, 0xB9, 0xC0, 0x0C, 0x10, 0x40, 0x3D, 0x43, 0xA2,
+    0x96, 0xC2, 0x7E, 0xA7, 0x38, 0x45, 0x8A, 0x14, 0x76, 0x91, 0x47, 0x43, 0x11, 0xE8, 0x20, 0x14,
+    0xF9, 0x07, 0x6C, 0x24, 0x9C, 0x22, 0x25, 0x6E, 0xA8, 0x49, 0x91, 0x82, 0xD0, 0x84, 0x61, 0x52,
+    0xA4, 0x78, 0x70, 0x4A, 0x5E, 0xE1, 0x22, 0x85, 0x45, 0x32, 0x43, 0x0A, 0x8A, 0x88, 0x09, 0x1D,
+    0x85, 0xCF, 0x70, 0x64, 0x94, 0x70, 0xA7, 0xE5, 0x5B, 0xBD, 0x78, 0xF2, 0x83, 0x02, 0xCD, 0x9C,
+    0x74, 0x3A, 0xED, 0xED, 0x7D, 0xBB, 0xFB, 0xED, 0xA7, 0xA5, 0xB3, 0x7F, 0x7A, 0xD6, 0xFB, 0x7F,
+    0xF5, 0x83, 0xFE, 0xEA, 0xE1, 0x78, 0x73, 0x41, 0x6F, 0xDC, 0xFB, 0x3B, 0x54, 0xE7, 0xEF, 0x1F,
+    0xFA, 0x2A, 0xDF, 0xB3, 0x17, 0x76, 0x29, 0x65, 0x4B, 0x9A, 0x9B, 0x84, 0x07, 0xA2, 0xCA, 0x52,
+    0xC2, 0x44, 0x85, 0xA5, 0xF8, 0xD9, 0x23, 0x77, 0x14, 0x71, 0x4D, 0x8A, 0x3B, 0x32, 0x8C, 0x15,
+    0x4B, 0x15, 0x8F, 0x6F, 0xDC, 0x90, 0xF2, 0xF4, 0x9F, 0xC7, 0x31, 0xE3, 0x89, 0xB9, 0x56, 0xEC,
+    0x08, 0x3E, 0xD5, 0x50, 0x12, 0xAE, 0xAC, 0x9D, 0x15, 0x6E, 0xA6, 0xC3, 0x6C, 0xBB, 0xF2, 0xDB,
+    0x85, 0x9B, 0xA4, 0x6D, 0xC5, 0xE7, 0x79, 0xCE, 0x96, 0x7D, 0xC1, 0x19, 0x7F, 0xC9, 0x9D, 0x76,
+    0xF4, 0xE2, 0x55, 0xD2, 0xF7, 0xE4, 0x23, 0x86, 0xC7, 0xC2, 0x66, 0x32, 0xA9, 0x9A, 0xDC, 0x26,
+    0xF0, 0x4D, 0xBA, 0x51, 0x8B, 0x49, 0xD1, 0x66, 0x2E, 0x0A, 0x54, 0x51, 0x4E, 0xC9, 0xB8, 0x27,
+    0xB6, 0x38, 0xAA, 0x01, 0x74, 0xCC, 0x67, 0x8B, 0xD7, 0x8B, 0x8F, 0x29, 0xE7, 0x3E, 0x62, 0xEE,
+    0x14, 0x50, 0x99, 0xFD, 0x3A, 0x09, 0x13, 0x52, 0xB6, 0xA7, 0x6A, 0xDE, 0x45, 0xAC, 0xEA, 0xD4,
+    0x4F, 0x10, 0x62, 0x4F, 0xFA, 0x21, 0x22, 0x3A, 0xB8, 0x0A, 0x43, 0x97, 0x60, 0xC4, 0xCC, 0x36,
+    0x32, 0x8F, 0x89, 0xD6, 0xE0, 0x0A, 0xD0, 0x92, 0x96, 0x48, 0x21, 0x94, 0xD7, 0x9E, 0x87, 0x18,
+    0x71, 0x4F, 0x48, 0x5E, 0x40, 0xD6, 0x10, 0x6A, 0xE1, 0x8E, 0x07, 0x80, 0x8A, 0xCB, 0xB8, 0x97,
+    0x88, 0x71, 0x36, 0x29, 0x60, 0x21, 0x5D, 0xE3, 0x66, 0xC4, 0x3C, 0x90, 0x58, 0xB2, 0x05, 0x12,
+    0x6E, 0x34, 0x6E, 0xF8, 0x28, 0x16, 0x78, 0x12, 0x02, 0x1A, 0x53, 0x8E, 0x82, 0x34, 0x70, 0x8C,
+    0xB4, 0xA5, 0x30, 0xB8, 0x92, 0xE3, 0xD6, 0x55, 0xB8, 0xFD, 0xCC, 0xB2, 0x69, 0x3C, 0xF6, 0x15,
+    0x4A, 0x81, 0x27, 0x42, 0x06, 0x0C, 0x5B, 0x71, 0x73, 0x4A, 0x8C, 0x52, 0x46, 0xE2, 0xAB, 0xC6,
+    0x34, 0x59, 0x2F, 0xC9, 0xA9, 0x75, 0x9B, 0x05, 0x54, 0x04, 0x7B, 0x1B, 0x9C, 0x37, 0xC8, 0xC1,
+    0xBD, 0x38, 0xBA, 0x3D, 0x98, 0x03, 0x9B, 0xD5, 0xB4, 0x4A, 0xCB, 0xF0, 0xB5, 0xB2, 0x89, 0xB1,
+    0x8E, 0xFA, 0xE6, 0x5E, 0x49, 0x1C, 0x84, 0x3A, 0x70, 0x1B, 0x71, 0xAB, 0x7B, 0x14, 0x79, 0x43,
+    0x10, 0xF2, 0x08, 0x08, 0xE5, 0xA4, 0x4C, 0x48, 0x22, 0x6C, 0x11, 0xCC, 0x12, 0x5F, 0xC6, 0x40,
+    0x6D, 0x98, 0x5B, 0x92, 0x23, 0x40, 0x0E, 0x04, 0x47, 0xEF, 0x5D, 0x17, 0x2B, 0x02, 0x43, 0x90,
+    0x00, 0x99, 0x5E, 0x10, 0x0F, 0x30, 0x08, 0xE2, 0x66, 0xA4, 0x9B, 0x44, 0x8E, 0x63, 0xC4, 0x20,
+    0xD0, 0xD1, 0xF4, 0xD5, 0x6F, 0x89, 0x8E, 0x6B, 0xB9, 0x26, 0x93, 0x2F, 0x04, 0x1B, 0xBD, 0xFB,
+    0xE3, 0xE2, 0x9A, 0xCD, 0x7C, 0x49, 0x99, 0x10, 0x14, 0x86, 0x52, 0x9C, 0x70, 0xC6, 0xC5, 0x8E,
+    0x6C, 0xD2, 0xD3, 0x66, 0xCC, 0xBB, 0xD8, 0xCF, 0x25, 0x86, 0x45, 0x8C, 0x7D, 0x16, 0x3E, 0xF2,
+    0xCA, 0xC6, 0x41, 0x75, 0x18, 0x7C, 0x10, 0x32, 0x66, 0x2F, 0xEB, 0x91, 0x9C, 0x5C, 0x08, 0xEA,
+    0x0A, 0x98, 0x53, 0x8F, 0x32, 0x85, 0xCC, 0xA5, 0x1E, 0x09, 0xEE, 0x01, 0xC8, 0xE6, 0xE2, 0x63,
+    0x05, 0x74, 0xB7, 0xB9, 0x35, 0xAD, 0xB9, 0xCB, 0xEB, 0xBC, 0x31, 0xA8, 0x41, 0xF7, 0xBA, 0xE7,
+    0x43, 0x3E, 0x9C, 0x9E, 0x9A, 0x96, 0x64, 0x76, 0x81, 0xBD, 0x56, 0x4F, 0x86, 0xD8, 0x25, 0x6E,
+    0xA2, 0x37, 0xF6, 0xF6, 0x69, 0xB6, 0xD5, 0xA5, 0x7B, 0x0F, 0x36, 0x67, 0xBA, 0xF8, 0x66, 0x27,
+    0xA4, 0xA8, 0x6C, 0xC0, 0x21, 0x25, 0xBD, 0x39, 0x16, 0x4A, 0xDF, 0x50, 0xBC, 0xDE, 0xF6, 0xAB,
+    0xD9, 0xA5, 0x7A, 0xEB, 0x83, 0x74, 0xCE, 0x38, 0xAC, 0xA9, 0x3E, 0x05, 0xB5, 0x23, 0x8A, 0x9B,
+    0x77, 0xC0, 0x8E, 0x6D, 0xD2, 0xB7, 0x43, 0xC4, 0x67, 0x7D, 0x1A, 0xB4, 0x2D, 0x2C, 0xD7, 0xD5,
+    0x3C, 0x90, 0xB9, 0x07, 0xAE, 0x3F, 0x42, 0xD5, 0x82, 0x41, 0x44, 0x17, 0x51, 0xCB, 0xB3, 0x9E,
+    0x34, 0x48, 0xA5, 0xE8, 0x06, 0xC5, 0xB4, 0x5C, 0x5D, 0xDB, 0x94, 0xAA, 0xFA, 0xA3, 0xB1, 0xF2,
+    0xE1, 0xF5, 0x31, 0xA2, 0x97, 0xC6, 0x98, 0xD8, 0xE9, 0x74, 0x7A, 0x0E, 0xF5, 0xF1, 0x47, 0xE3,
+    0xB9, 0x10, 0xF8, 0x91, 0x9B, 0x7C, 0xB2, 0x7F, 0xF9, 0x97, 0xB7, 0x67, 0x5B, 0xE6, 0xCC, 0xDE,
+    0x9D, 0x9B, 0xB3, 0xC9, 0x0F, 0xFB, 0x3B, 0x5C, 0x38, 0xF5, 0xCF, 0x00, 0xF7, 0x35, 0x5D, 0xDF,
+    0x1D, 0x3B, 0xEA, 0x3B, 0xBE, 0xC4, 0x48, 0x00, 0x8F, 0xEE, 0x68, 0x09, 0x09, 0x62, 0x94, 0x3D,
+    0x48, 0x3A, 0x75, 0x67, 0x2E, 0xFB, 0xC4, 0x57, 0xB5, 0xDE, 0xC3, 0x43, 0x3F, 0x11, 0x4B, 0xA7,
+    0xF8, 0xD9, 0xF6, 0x63, 0x57, 0x41, 0x11, 0xF7, 0xC2, 0x00, 0xE0, 0xE1, 0x68, 0xBC, 0xFC, 0x8D,
+    0xA2, 0x4D, 0x81, 0xFC, 0x31, 0x4A, 0xE1, 0xF4, 0x11, 0x60, 0x5C, 0xC7, 0x6B, 0xE3, 0xAE, 0xDC,
+    0x04, 0x61, 0xB7, 0x22, 0x97, 0x75, 0xBA, 0x31, 0x1E, 0x4C, 0xA7, 0xD7, 0x77, 0x75, 0xBF, 0xFC,
+    0x3E, 0x9D, 0xC8, 0x7A, 0xD5, 0xD3, 0xF6, 0xF2, 0x49, 0x1D, 0x8C, 0xAF, 0x9C, 0xF4, 0xDC, 0x4F,
+    0x89, 0x2B, 0x9A, 0x01, 0x0E, 0xD1, 0x5C, 0x1A, 0x09, 0x4D, 0xBD, 0x6E, 0xD1, 0xEE, 0x83, 0x4C,
+    0xBA, 0xA7, 0x93, 0x0A, 0x93, 0x3D, 0x44, 0xE2, 0xA1, 0x79, 0x06, 0x13, 0x25, 0x7B, 0xF9, 0x3E,
+    0xB7, 0x45, 0x90, 0x26, 0xF9, 0x15, 0x23, 0x98, 0xE7, 0x27, 0x7F, 0x1C, 0x9A, 0x76, 0xEC, 0x62,
+    0x65, 0x9F, 0x76, 0xEC, 0xE2, 0x32, 0x16, 0x12, 0xE5, 0x75, 0xC3, 0xAC, 0xAC, 0xE1, 0xB9, 0xD7,
+    0xD0, 0x34, 0x85, 0x85, 0x39, 0x0F, 0xB2, 0x70, 0x09, 0x35, 0xEF, 0x38, 0x06, 0xC7, 0x9A, 0x3C,
+    0x64, 0xA8, 0xE7, 0x3A, 0xEA, 0xD9, 0x1A, 0x42, 0xB9, 0x9B, 0xDC, 0x67, 0x36, 0xE3, 0x18, 0xF4,
+    0x6C, 0x0C, 0xFA, 0xA9, 0x68, 0x34, 0x16, 0x72, 0x06, 0x2F, 0x21, 0x54, 0xA7, 0xB9, 0x2B, 0x5A,
+    0xD0, 0xD9, 0xE9, 0x21, 0x0A, 0x39, 0x97, 0x55, 0x09, 0x5E, 0xDE, 0x05, 0x27, 0x85, 0x8F, 0xD3,
+    0x52, 0x95, 0x39, 0x69, 0x78, 0xA9, 0xFA, 0x65, 0xAF, 0x81, 0x1D, 0xE0, 0x68, 0x3B, 0x71, 0x6F,
+    0xB5, 0x59, 0x79, 0x82, 0x5C, 0xD2, 0xAA, 0xD3, 0x7C, 0xC0, 0x5F, 0x9F, 0x8B, 0xA1, 0x48, 0xEE,
+    0x64, 0x3A, 0x6F, 0x57, 0xD7, 0x92, 0x7B, 0xDD, 0x56, 0xC1, 0x8D, 0x74, 0xCF, 0xA8, 0xAE, 0x44,
+    0x57, 0x92, 0x92, 0x66, 0x09, 0x64, 0xFD, 0x34, 0xD4, 0x10, 0xA4, 0xCB, 0x7B, 0xD3, 0x24, 0x03,
+    0xF4, 0x9E, 0xCF, 0x40, 0x6F, 0xEF, 0x84, 0x14, 0xE4, 0xCB, 0x03, 0x5B, 0x90, 0xB1, 0xD6, 0x77,
+    0x07, 0xD2, 0x51, 0x4F, 0xAB, 0x51, 0x07, 0xDD, 0x80, 0xA2, 0x9D, 0x1B, 0xA3, 0xCF, 0xED, 0xF8,
+    0x10, 0x45, 0xC8, 0x5B, 0xF9, 0x77, 0xD0, 0x40, 0x6F, 0xF8, 0x51, 0xFD, 0x12, 0x3B, 0x4A, 0x1F,
+    0x24, 0x50, 0xA4, 0x4D, 0x8B, 0x01, 0x91, 0x1F, 0x53, 0x87, 0x4F, 0x52, 0xEE, 0xBC, 0x81, 0x5E,
+    0xA1, 0x1F, 0x61, 0x10, 0x95, 0xC8, 0x5B, 0xD1, 0x15, 0x25, 0xA4, 0x82, 0xA3, 0x80, 0x86, 0x45,
+    0x59, 0xE5, 0x8F, 0x00, 0x41, 0x83, 0x8E, 0x24, 0x21, 0x7D, 0x50, 0x8B, 0x3C, 0xAE, 0x4D, 0xE4,
+    0xB4, 0xE4, 0x37, 0x28, 0xAC, 0xEA, 0x8B, 0x14, 0x16, 0xD5, 0x2D, 0x34, 0x30, 0x25, 0x03, 0xFA,
+    0xBC, 0x83, 0xC1, 0xD2, 0xE7, 0x43, 0x19, 0xA1, 0x01, 0x01, 0x40, 0x7E, 0x47, 0x05, 0x8E, 0x68,
+    0x45, 0x7D, 0xE3, 0x61, 0x51, 0xAE, 0x05, 0xEC, 0xF1, 0x5C, 0xA9, 0xA5, 0xF0, 0xEB, 0xDA, 0x02,
+    0x3F, 0xC8, 0x22, 0xC8, 0x53, 0xB7, 0x90, 0x6D, 0x89, 0x65, 0xE1, 0x40, 0x5E, 0xD3, 0x9E, 0x8E,
+    0xC0, 0xCB, 0x6B, 0x01, 0x9F, 0xD0, 0xDF, 0x51, 0xB3, 0x11, 0x85, 0x39, 0xF5, 0x19, 0xBA, 0xCA,
+    0xE6, 0x87, 0x2C, 0xC8, 0x13, 0xFC, 0xD2, 0xC0, 0x5F, 0x6B, 0x76, 0x7E, 0x2F, 0x6E, 0x4D, 0xA7,
+    0xCA, 0x2E, 0xCB, 0xCE, 0x24, 0x2C, 0xFC, 0xCA, 0xC9, 0x78, 0x95, 0xE0, 0x70, 0xA2, 0xFC, 0x60,
+    0x65, 0x8A, 0xD5, 0x74, 0x90, 0x98, 0xB0, 0xB2, 0x58, 0x15, 0xA5, 0x02, 0x6D, 0x73, 0x34, 0x1E,
+    0x50, 0x42, 0x59, 0x5B, 0x09, 0x4B, 0xA3, 0x6B, 0xC0, 0xE1, 0x68, 0x3A, 0x2D, 0xE9, 0x7F, 0xAF,
+    0x7F, 0x01, 0xD5, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x2D, 0xDB, 0x62, 0x1D, 0x38, 0xE8, 0x88,
+    0xD8, 0x47, 0xF0, 0x11, 0x7A, 0x80, 0x80, 0x70, 0x17, 0x89, 0x11, 0x64, 0xE4, 0x48, 0x88, 0x0B,
+    0xC0, 0xB6, 0x97, 0x0B, 0x40, 0xC2, 0x11, 0x48, 0x96, 0x3B, 0x60, 0x2F, 0x17, 0xC0, 0xC0, 0x05,
+    0x9C, 0x6C, 0x6E, 0x60, 0xA4, 0x9D, 0xD5, 0xB6, 0x5D, 0xBC, 0x57, 0x3D, 0x7C, 0x24, 0x86, 0x80,
+    0x6C, 0x71, 0xD0, 0xAA, 0xAE, 0xEE, 0xAA, 0x7A, 0xEF, 0x75, 0x75, 0xFB, 0x40, 0x57, 0x82, 0xCF,
+    0x6B, 0x8F, 0x31, 0x3B, 0x7F, 0xDA, 0x4A, 0x0D, 0xAB, 0x16, 0x59, 0x30, 0x7F, 0x26, 0x6E, 0x12,
+    0x29, 0x26, 0x09, 0x2B, 0xA9, 0x55, 0x8A, 0x28, 0xD2, 0xCD, 0xD2, 0x0C, 0x92, 0xBD, 0x8D, 0x19,
+    0x37, 0x14, 0x1B, 0x6E, 0x38, 0x72, 0x43, 0xD7, 0x4A, 0xA1, 0x7A, 0x27, 0x96, 0x43, 0xAD, 0xD1,
+    0x0F, 0x7E, 0xA5, 0xFA, 0x71, 0x29, 0xE6, 0xAC, 0xBB, 0x74, 0x53, 0xB3, 0xC1, 0xCE, 0xEE, 0xE4,
+    0x62, 0x14, 0x29, 0xA3, 0x3B, 0x6C, 0x51, 0x6D, 0xD8, 0x1E, 0x8B, 0xE4, 0x5A, 0x9D, 0x6D, 0x51,
+    0x6B, 0x0A, 0x8A, 0x5C, 0xFA, 0x42, 0x75, 0x2B, 0x55, 0x3C, 0x38, 0xD5, 0x01, 0x1B, 0x24, 0x8F,
+    0xC8, 0x28, 0x52, 0x4D, 0x52, 0x23, 0xBE, 0xE9, 0x05, 0x25, 0xF8, 0x39, 0x02, 0xEE, 0x50, 0xB5,
+    0xC2, 0xAA, 0x04, 0x18, 0x25, 0x91, 0x20, 0x42, 0xB2, 0xFB, 0xB2, 0xEF, 0xCB, 0x50, 0xF8, 0x00,
+    0x7B, 0x32, 0x24, 0x96, 0x7A, 0xA6, 0x41, 0x8A, 0x91, 0x08, 0x60, 0x68, 0x4C, 0xF4, 0x1D, 0x96,
+    0x73, 0x6E, 0xF1, 0xCC, 0x19, 0x89, 0x19, 0xAB, 0x0E, 0x08, 0x45, 0x51, 0xBA, 0xA2, 0x41, 0x0C,
+    0x5C, 0xEA, 0x51, 0x2E, 0xE4, 0xDA, 0x86, 0xAD, 0x53, 0xD5, 0xD6, 0x2B, 0xE2, 0x3A, 0x45, 0x9D,
+    0xC7, 0xAF, 0x76, 0x45, 0x2D, 0x0E, 0x91, 0xBD, 0x4D, 0xE6, 0x34, 0x19, 0x6C, 0xB2, 0xC8, 0xFE,
+    0xCF, 0x51, 0x27, 0x29, 0x49, 0x0B, 0xD4, 0x2D, 0x50, 0x2D, 0x4B, 0xA7, 0xE9, 0x88, 0x18, 0x5E,
+    0x5F, 0x45, 0xCB, 0x4E, 0x57, 0x31, 0xFB, 0xD1, 0x64, 0xA4, 0x4B, 0x4F, 0x28, 0x4C, 0x18, 0x88,
+    0xDE, 0x4F, 0x74, 0xB9, 0x98, 0x01, 0x78, 0x35, 0x93, 0x50, 0xA1, 0xAF, 0x1F, 0xCD, 0x20, 0x4E,
+    0xB4, 0xC8, 0xA7, 0x3A, 0x21, 0x9F, 0x42, 0xF7, 0x86, 0xAE, 0x9E, 0x2C, 0x74, 0x53, 0x62, 0xCD,
+    0x2D, 0x14, 0x05, 0xE5, 0xB1, 0x43, 0xBA, 0x4D, 0xE0, 0x01, 0x59, 0xF9, 0x77, 0x86, 0xD1, 0xDB,
+    0xD8, 0x24, 0x56, 0x23, 0xC7, 0xCA, 0x50, 0xB3, 0x35, 0xFE, 0xED, 0x2B, 0x4C, 0x93, 0x6C, 0xC7,
+    0x73, 0xB2, 0xE4, 0xA6, 0x4C, 0x63, 0x2E, 0xA7, 0xCC, 0x5B, 0x2E, 0xC6, 0x73, 0xF1, 0x74, 0xE9,
+    0xA1, 0x1D, 0xC1, 0x7B, 0xBA, 0xFC, 0x18, 0x78, 0x98, 0x1B, 0x67, 0x3C, 0x73, 0xA5, 0x62, 0x12,
+    0x46, 0x88, 0xB1, 0xA2, 0x4B, 0xCF, 0x1F, 0x40, 0x8D, 0x00, 0x52, 0xA3, 0x31, 0x8C, 0x62, 0x0C,
+    0xDB, 0x8A, 0xE3, 0x54, 0x70, 0x9C, 0x33, 0xAC, 0x15, 0xDA, 0xB2, 0x95, 0x74, 0xF2, 0x08, 0x6A,
+    0xE6, 0x7A, 0xA1, 0xFE, 0xA8, 0x95, 0x6F, 0xD2, 0x81, 0xA5, 0xD1, 0x78, 0xAA, 0x81, 0x53, 0x9B,
+    0xE8, 0xED, 0xC5, 0x56, 0x6B, 0x4C, 0x6E, 0x8A, 0xFC, 0xD1, 0x76, 0xE9, 0x4E, 0x85, 0x44, 0x2A,
+    0xA6, 0xAE, 0x65, 0xF7, 0x56, 0xC6, 0xB3, 0xD0, 0xD9, 0x98, 0x77, 0x46, 0xEA, 0x25, 0x5D, 0xFE,
+    0x33, 0x13, 0x36, 0x53, 0xEA, 0x38, 0x36, 0x7C, 0x39, 0x17, 0x89, 0x14, 0x5D, 0xDA, 0xD7, 0xA0,
+    0xDE, 0x0D, 0x74, 0xF9, 0xCB, 0x35, 0x1A, 0xA1, 0x56, 0xBB, 0x2D, 0x24, 0x22, 0x46, 0x67, 0xCC,
+    0xD5, 0x78, 0x72, 0xD4, 0x15, 0x8F, 0x4D, 0xC7, 0x86, 0x9D, 0x1D, 0x1D, 0x6F, 0x91, 0xDE, 0x05,
+    0x80, 0x8C, 0xE5, 0x9F, 0x94, 0x2C, 0x1B, 0x46, 0x32, 0x6C, 0x96, 0xE7, 0xC4, 0xF6, 0xC1, 0x44,
+    0xFE, 0x62, 0xBA, 0xC7, 0xBA, 0xFF, 0xFF, 0xCE, 0xCB, 0x6D, 0x79, 0xDD, 0x0A, 0xA5, 0x3E, 0x10,
+    0x8B, 0x80, 0xC2, 0x44, 0xF9, 0x9B, 0x99, 0x1A, 0x54, 0x7A, 0x88, 0xEC, 0xD9, 0xFA, 0xD6, 0x7A,
+    0xB5, 0x9F, 0xDB, 0x75, 0x3E, 0xAF, 0x72, 0xFC, 0xED, 0x55, 0xB8, 0xB2, 0xC9, 0xA5, 0xBD, 0x0A,
+    0x7E, 0xFE, 0xB5, 0x20, 0xC7, 0x7F, 0xBB, 0x66, 0xD7, 0x99, 0x9A, 0xDC, 0xB8, 0x77, 0x7A, 0xCA,
+    0xE7, 0x57, 0x9A, 0x6F, 0x96, 0x04, 0x40, 0x2F, 0xF8, 0x10, 0x11, 0xCC, 0x95, 0x3D, 0x52, 0xF6,
+    0x64, 0xBD, 0x39, 0x32, 0xA8, 0xE9, 0x06, 0x82, 0xF1, 0xCE, 0x70, 0x17, 0x3B, 0xA3, 0xF9, 0xBA,
+    0x33, 0xFC, 0x27, 0x5D, 0xD6, 0x0F, 0xD9, 0x74, 0x67, 0xEC, 0x18, 0xA3, 0x9F, 0x0C, 0xC0, 0x4D,
+    0x06, 0x7E, 0x16, 0xC9, 0x40, 0xDB, 0x75, 0x16, 0x05, 0x3E, 0x61, 0x49, 0x0F, 0xEC, 0x2E, 0x73,
+    0xF7, 0xC3, 0x30, 0x06, 0xEB, 0xF5, 0x91, 0x11, 0xFA, 0xD9, 0x89, 0x44, 0x58, 0xC1, 0xCD, 0x76,
+    0xDD, 0xB2, 0x05, 0xAD, 0x63, 0x29, 0x2E, 0xA5, 0x88, 0xE9, 0xC9, 0x4C, 0xE5, 0xAF, 0xFF, 0xF7,
+    0x1D, 0xC5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x5D, 0xDB, 0x0A, 0x2E, 0x5C, 0x98, 0x9E, 0xC2,
+    0x3F, 0xC1, 0xBF, 0x00, 0xAD, 0x05, 0x25, 0x05, 0x57, 0xC4, 0x55, 0x0A, 0x5A, 0x84, 0x84, 0xF2,
+    0x0B, 0xD0, 0x45, 0x50, 0xF0, 0x07, 0xA0, 0xA7, 0x80, 0x26, 0x14, 0x34, 0xB4, 0xC8, 0x0E, 0x08,
+    0xD1, 0xBA, 0x40, 0xA2, 0xA0, 0xB1, 0x04, 0x28, 0x12, 0x0D, 0x8B, 0x30, 0x92, 0x83, 0x76, 0x3D,
+    0xBC, 0x37, 0xBE, 0x44, 0xC9, 0xE5, 0x10, 0x34, 0x28, 0xB6, 0x76, 0x6F, 0xD6, 0x73, 0x3B, 0xF3,
+    0xF6, 0xCD, 0xC7, 0x1A, 0x33, 0x3F, 0xBB, 0xF2, 0xD4, 0x98, 0xA5, 0x48, 0x6B, 0xAC, 0x88, 0x37,
+    0xB9, 0x88, 0xEC, 0x25, 0x98, 0x06, 0xD3, 0xC8, 0xD7, 0x17, 0x55, 0x2E, 0x9D, 0x31, 0xB1, 0x38,
+    0xFC, 0xD3, 0x7A, 0x4C, 0xA9, 0xEC, 0x61, 0x6E, 0x06, 0x4C, 0xB9, 0x70, 0xBF, 0xAA, 0x4E, 0x89,
+    0xC5, 0x2C, 0x8E, 0xFA, 0xB5, 0xA3, 0x28, 0xEF, 0xB7, 0x5E, 0x66, 0xB0, 0x28, 0x95, 0xA5, 0xDD,
+    0x58, 0x45, 0xFA, 0x19, 0xE9, 0x17, 0xF6, 0x54, 0x8C, 0x54, 0x34, 0x39, 0xCD, 0x47, 0x34, 0x6F,
+    0x4A, 0xCE, 0x09, 0x80, 0x19, 0x73, 0xF9, 0x95, 0x21, 0x0A, 0x9A, 0xB3, 0xB4, 0x9C, 0x4C, 0x2B,
+    0xF4, 0xB9, 0xFA, 0x21, 0xB0, 0x3C, 0x70, 0xE2, 0xF7, 0x4C, 0xCC, 0xA6, 0xE7, 0xCE, 0xBE, 0x84,
+    0x14, 0x4E, 0x5C, 0x89, 0xA9, 0x6D, 0x44, 0xA6, 0x58, 0x9E, 0x6D, 0x9B, 0x8C, 0x9B, 0x4B, 0x22,
+    0x6F, 0x5A, 0xFA, 0xA0, 0x81, 0x50, 0xDF, 0x26, 0x1B, 0x8E, 0xC8, 0x5A, 0x92, 0x41, 0x5A, 0xBC,
+    0xB1, 0x04, 0x44, 0x3C, 0x89, 0x1C, 0x7B, 0xB5, 0x47, 0x75, 0x5D, 0xF1, 0x40, 0xFC, 0x97, 0xE7,
+    0xA1, 0x06, 0x1E, 0xB2, 0xE7, 0xA7, 0x87, 0x9C, 0x68, 0x9C, 0x47, 0x22, 0xBA, 0x54, 0x59, 0xC4,
+    0x2A, 0x52, 0xAC, 0xCE, 0xFC, 0xE3, 0x73, 0x61, 0xC8, 0xEF, 0x91, 0x6A, 0xBF, 0x22, 0x3D, 0x61,
+    0x4C, 0x2D, 0xA6, 0x24, 0x64, 0xA3, 0xB1, 0x6D, 0xEA, 0xCD, 0xB6, 0x89, 0x16, 0x67, 0xA1, 0x46,
+    0xFB, 0xCF, 0x65, 0x28, 0x56, 0x30, 0x85, 0xA1, 0x1E, 0xB3, 0xE9, 0xF1, 0x62, 0x1D, 0xA6, 0x22,
+    0xFF, 0x59, 0x3F, 0x59, 0x87, 0xA9, 0xC8, 0xBB, 0x33, 0x30, 0xB9, 0x51, 0xBE, 0xD4, 0xF5, 0x09,
+    0x4C, 0x47, 0x98, 0x1D, 0x11, 0x3E, 0xC0, 0x98, 0xE8, 0xCC, 0xC7, 0x82, 0x8C, 0xC8, 0x3D, 0x76,
+    0x58, 0x67, 0x5D, 0x24, 0x07, 0xD2, 0xA6, 0x72, 0x43, 0xAA, 0x32, 0x94, 0xC1, 0xD4, 0x8B, 0x7A,
+    0xB1, 0x81, 0xD5, 0x0B, 0x82, 0xBA, 0xB2, 0xD9, 0x74, 0x26, 0x43, 0xB2, 0x36, 0x0E, 0x15, 0x55,
+    0x9D, 0xC3, 0xC6, 0x6A, 0x74, 0xB4, 0x4A, 0xEB, 0xF3, 0x02, 0x9B, 0x08, 0x08, 0xC0, 0xCA, 0xF5,
+    0x45, 0xC0, 0xA2, 0xA2, 0xC5, 0x72, 0x64, 0x05, 0x24, 0x2C, 0xA9, 0x9E, 0xE5, 0x8A, 0xB2, 0x64,
+    0xFD, 0x68, 0x5D, 0xFA, 0x78, 0x4C, 0x86, 0xCC, 0xE5, 0x7D, 0xD9, 0x9D, 0xE7, 0x82, 0xAC, 0x1D,
+    0xBF, 0xE5, 0xFA, 0x3B, 0xE8, 0x3B, 0xDA, 0xF9, 0xF5, 0xF3, 0xAB, 0xDB, 0x98, 0xD0, 0xAC, 0x40,
+    0x1B, 0x58, 0xE6, 0x55, 0x22, 0x4D, 0x97, 0x0F, 0xF9, 0x60, 0xDB, 0x38, 0x6C, 0x4C, 0x64, 0x32,
+    0xB4, 0x69, 0x94, 0x7F, 0x1B, 0xC3, 0xA9, 0x31, 0xCE, 0xE9, 0x78, 0x32, 0xFC, 0x99, 0xB1, 0xB5,
+    0xD8, 0x5A, 0x2C, 0xDB, 0xE6, 0xB5, 0x5C, 0x93, 0x9B, 0x21, 0x0F, 0x84, 0x8C, 0x9C, 0x3E, 0x94,
+    0x77, 0xDA, 0x47, 0x36, 0x3D, 0x50, 0x90, 0x65, 0x86, 0x90, 0x58, 0x56, 0x4B, 0xC6, 0x88, 0xAE,
+    0x41, 0x71, 0xBC, 0x61, 0x19, 0x66, 0x30, 0xE0, 0x3C, 0x06, 0xDB, 0x6C, 0x3B, 0xC4, 0x02, 0xD6,
+    0xC9, 0x37, 0xBB, 0x21, 0xE1, 0x90, 0x77, 0xC4, 0xFC, 0xB3, 0xD1, 0x06, 0x3B, 0x55, 0xDA, 0xE3,
+    0xF0, 0x77, 0xD6, 0x32, 0xFE, 0x56, 0xCC, 0x3F, 0x4B, 0x07, 0x6D, 0x15, 0xE9, 0x07, 0xA8, 0x14,
+    0x49, 0x81, 0xDD, 0xC5, 0x40, 0x95, 0xB1, 0x3D, 0x55, 0x46, 0xDE, 0xEE, 0x48, 0x5D, 0xC5, 0x82,
+    0x8C, 0x9A, 0x80, 0x46, 0x5B, 0xA6, 0xFD, 0xC1, 0x82, 0x35, 0xCC, 0x75, 0xC4, 0x62, 0xD2, 0x5D,
+    0x4B, 0x34, 0x55, 0x17, 0xED, 0x4A, 0xA7, 0xBE, 0x64, 0xF6, 0xE5, 0x67, 0x5F, 0x9D, 0xF6, 0x5B,
+    0x99, 0x61, 0x38, 0x55, 0x4D, 0x8A, 0xF0, 0x17, 0x33, 0xF0, 0x6E, 0x0A, 0x37, 0xC5, 0x78, 0x95,
+    0x89, 0x7F, 0x88, 0x1C, 0xB1, 0x3C, 0x42, 0xF2, 0x9D, 0xCE, 0x6D, 0xBA, 0xB9, 0x57, 0x25, 0xE1,
+    0xD2, 0x3E, 0xB4, 0x1D, 0x9C, 0xA6, 0x21, 0xE3, 0x59, 0xBA, 0x26, 0x98, 0xD4, 0x67, 0xB0, 0xDE,
+    0xB4, 0xC8, 0x88, 0x0C, 0x65, 0xE0, 0x55, 0xEC, 0x72, 0x56, 0x04, 0xB0, 0xA2, 0xCF, 0x40, 0x9C,
+    0x20, 0x1C, 0xC8, 0x47, 0x54, 0x6C, 0x31, 0xD9, 0x1E, 0xE2, 0x27, 0xC9, 0xC7, 0x72, 0x2A, 0x8E,
+    0xE4, 0x3E, 0xC2, 0xF5, 0x0D, 0x22, 0x6E, 0x0C, 0x88, 0xE8, 0x37, 0x16, 0xDD, 0x4E, 0xAE, 0x8B,
+    0x2B, 0xD8, 0xA0, 0x8C, 0x8A, 0xA9, 0x8A, 0x16, 0xAD, 0xCB, 0xF1, 0x6A, 0xD2, 0x4B, 0x60, 0xEE,
+    0x6F, 0x73, 0x68, 0x58, 0xC0, 0xBD, 0xF9, 0xF3, 0x55, 0x80, 0x5B, 0x0F, 0xD1, 0x20, 0x0F, 0x81,
+    0xA7, 0x25, 0x19, 0x7A, 0x2B, 0x61, 0x1E, 0x52, 0x01, 0xE1, 0xBD, 0x41, 0xDF, 0x68, 0xF8, 0xB5,
+    0xD5, 0x1C, 0x1D, 0x4A, 0x70, 0x91, 0x4D, 0xBC, 0x63, 0x22, 0x79, 0x23, 0x9A, 0xCA, 0x74, 0x97,
+    0x7B, 0xAA, 0x13, 0xB9, 0xC5, 0x7A, 0x90, 0x0F, 0xAA, 0x18, 0x54, 0x11, 0x66, 0x05, 0x53, 0x21,
+    0xC6, 0x8E, 0x1E, 0xFB, 0x9C, 0xC8, 0xA3, 0x1D, 0xF1, 0x6C, 0xE2, 0x32, 0x25, 0x1A, 0x9E, 0xAA,
+    0xD1, 0x1C, 0xC8, 0xE7, 0xE8, 0x88, 0x86, 0x33, 0x53, 0xD9, 0x5C, 0x99, 0xA3, 0xF2, 0xDF, 0x9E,
+    0xDF, 0xDD, 0x55, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x9D, 0xD8, 0xBA, 0x4B, 0xE1, 0x62, 0x2B, 0x68,
+    0xAE, 0xF0, 0x1F, 0xB0, 0x7F, 0xC0, 0x1A, 0x24, 0x6A, 0xAE, 0xE0, 0xBE, 0x67, 0xA3, 0x50, 0x50,
+    0x72, 0xD5, 0xB5, 0x34, 0x74, 0x7C, 0x84, 0x2D, 0xEE, 0x03, 0xB0, 0x74, 0x05, 0x6D, 0x0A, 0x68,
+    0xA8, 0x5C, 0x18, 0xC9, 0x48, 0x6B, 0x3F, 0x66, 0x66, 0x9D, 0x75, 0xEE, 0x12, 0x90, 0xA0, 0x83,
+    0x95, 0xF2, 0x34, 0xF1, 0xAE, 0x67, 0xE6, 0xBD, 0x37, 0x9B, 0x10, 0x91, 0x27, 0x59, 0x6E, 0x23,
+    0x58, 0x36, 0x82, 0xA6, 0x13, 0x5C, 0x0F, 0x82, 0x79, 0xA0, 0x3F, 0x5C, 0x17, 0xB8, 0x66, 0xF4,
+    0x40, 0x45, 0x54, 0x03, 0x41, 0x11, 0x0D, 0xD5, 0xE3, 0x0A, 0x03, 0xF9, 0x81, 0x0A, 0x54, 0x56,
+    0x9E, 0x76, 0x86, 0xD1, 0x8C, 0x05, 0x88, 0x32, 0xBC, 0x96, 0xE3, 0xBE, 0xE3, 0x73, 0x64, 0x82,
+    0xE3, 0x06, 0x72, 0xC8, 0x36, 0xE1, 0x33, 0xA4, 0xBB, 0xEF, 0xBA, 0x31, 0xC6, 0x8D, 0x97, 0xBA,
+    0x71, 0x2B, 0x8F, 0xEA, 0x8E, 0x73, 0x92, 0x0F, 0x0E, 0x5F, 0x1F, 0x03, 0x05, 0x64, 0x6D, 0x14,
+    0x5B, 0x2B, 0xD8, 0xE5, 0x82, 0x3D, 0x39, 0xC6, 0x81, 0xCB, 0x48, 0x4C, 0xE7, 0x98, 0xAE, 0x97,
+    0x7E, 0x57, 0xCA, 0x93, 0xA0, 0x58, 0x2B, 0xF5, 0x1A, 0x11, 0xE5, 0x0B, 0xB6, 0xF2, 0x05, 0x95,
+    0x88, 0xF2, 0x88, 0xE8, 0xD5, 0x03, 0xB6, 0xE7, 0xF8, 0x22, 0xBA, 0x71, 0x3D, 0x22, 0xA9, 0x18,
+    0xB1, 0x63, 0xAC, 0xFC, 0x44, 0xE5, 0xC4, 0x35, 0x5B, 0x61, 0x68, 0x43, 0x0E, 0xE9, 0xFD, 0xB9,
+    0x76, 0xBD, 0x93, 0xE3, 0xE5, 0x3D, 0x9E, 0xB7, 0x87, 0x3C, 0xFD, 0x01, 0xCF, 0x3B, 0xDD, 0xE8,
+    0xA4, 0x19, 0x1B, 0xDC, 0x24, 0xC5, 0x0C, 0x7E, 0xBC, 0xA8, 0xF1, 0x51, 0x79, 0xEE, 0x9C, 0x32,
+    0x54, 0xEA, 0x81, 0x04, 0x47, 0x32, 0x8C, 0x93, 0xEA, 0x3E, 0x32, 0xBF, 0x1A, 0xEF, 0x97, 0x7E,
+    0x9F, 0xE4, 0xAD, 0xA6, 0x1B, 0xB4, 0xEB, 0xA7, 0x8C, 0xC5, 0x27, 0x91, 0x3E, 0x53, 0xE9, 0x29,
+    0x14, 0xED, 0x7F, 0xE1, 0x6A, 0x11, 0x8A, 0x20, 0x0D, 0xE4, 0x6A, 0x5E, 0x2B, 0x49, 0x5D, 0xEF,
+    0xF8, 0x94, 0x99, 0x4A, 0xD6, 0x64, 0x8D, 0x37, 0xE0, 0x81, 0xBF, 0xBA, 0xBC, 0xBA, 0x3C, 0xC9,
+    0xF6, 0xDF, 0x72, 0xB5, 0x1C, 0x4C, 0x58, 0xE1, 0x6D, 0xE0, 0x1C, 0x81, 0x56, 0xE2, 0x8D, 0xD5,
+    0x84, 0x2D, 0x7F, 0x26, 0x61, 0xB1, 0xB3, 0x53, 0x89, 0xB3, 0xAB, 0xD5, 0x49, 0xB6, 0x17, 0xC9,
+    0xF1, 0x38, 0xFC, 0xB2, 0x7C, 0x8A, 0xDC, 0xB0, 0x8F, 0x6C, 0xFA, 0x25, 0x10, 0x05, 0xE3, 0x32,
+    0xD8, 0x47, 0x6B, 0x71, 0x5A, 0x57, 0x8E, 0xCD, 0x1C, 0x65, 0x3A, 0x52, 0x7A, 0xC7, 0x90, 0x8A,
+    0x20, 0xA5, 0xAE, 0xFB, 0xE3, 0x22, 0x6E, 0x29, 0x32, 0xED, 0x07, 0xEF, 0xDD, 0x5C, 0x84, 0x87,
+    0x6F, 0x2E, 0x12, 0x47, 0x6F, 0x1F, 0xC5, 0xD4, 0xF5, 0x98, 0x21, 0xBE, 0xCC, 0xC3, 0x88, 0xD8,
+    0x03, 0xB7, 0x1C, 0x2F, 0x31, 0x4F, 0x1F, 0x0F, 0x8B, 0xB6, 0xCD, 0xB6, 0xB9, 0xB8, 0x9D, 0xA3,
+    0x2A, 0x11, 0x99, 0xA2, 0x31, 0xD1, 0x17, 0xB6, 0x64, 0xCD, 0xA6, 0x55, 0xFA, 0x4A, 0xCE, 0x83,
+    0xD3, 0x2A, 0xB7, 0x8C, 0x0D, 0xE9, 0x95, 0x47, 0x83, 0xCE, 0x8C, 0xF1, 0x60, 0x3D, 0xE4, 0xF3,
+    0x41, 0xCF, 0x16, 0x35, 0x9A, 0xB1, 0x9E, 0x66, 0x15, 0x65, 0x68, 0x7C, 0xCC, 0x08, 0xDC, 0x00,
+    0xB1, 0xB4, 0x0E, 0xF2, 0xBC, 0x3D, 0x37, 0xAE, 0x46, 0x77, 0x51, 0xB8, 0x38, 0xC8, 0xF3, 0xF6,
+    0x90, 0x08, 0xF6, 0x7B, 0xFA, 0xF3, 0x80, 0xBB, 0xA4, 0xBA, 0x4D, 0xAA, 0x9B, 0xA4, 0xF5, 0x12,
+    0xAD, 0xB1, 0x4B, 0x9E, 0x74, 0xC9, 0x93, 0xA4, 0x3A, 0xC2, 0x71, 0xE4, 0xA7, 0xE4, 0xC4, 0x52,
+    0x24, 0x3D, 0x2B, 0xD3, 0xBB, 0x26, 0x5D, 0xB5, 0xB3, 0x83, 0x51, 0xF2, 0xAD, 0x6A, 0x14, 0xC5,
+    0xD5, 0x63, 0xE3, 0x7D, 0x7B, 0x4F, 0x2E, 0x96, 0x29, 0xE7, 0xFB, 0xD0, 0x90, 0x1B, 0xDD, 0x83,
+    0x50, 0x7E, 0x0D, 0x5C, 0x38, 0x0E, 0x37, 0x12, 0xCA, 0xCD, 0x97, 0xD0, 0x9E, 0x0E, 0x07, 0x2B,
+    0x67, 0xB7, 0xAC, 0xB2, 0x1F, 0x2C, 0xBE, 0xD5, 0x78, 0xA6, 0xFA, 0xCA, 0x2D, 0x82, 0x0A, 0xCC,
+    0x4E, 0xCB, 0x55, 0xB2, 0xEA, 0x89, 0xC7, 0x32, 0xA2, 0x99, 0xD2, 0x74, 0x6A, 0x99, 0xEA, 0xA6,
+    0x2C, 0x6C, 0xF3, 0x57, 0x7F, 0x87, 0xEA, 0xC3, 0x29, 0x6E, 0x77, 0xBF, 0xE0, 0xD6, 0x44, 0x6E,
+    0xF9, 0xEF, 0xB8, 0xC5, 0x70, 0x2B, 0x67, 0x07, 0x3B, 0x72, 0x81, 0x2D, 0xA6, 0x0F, 0xE8, 0x4B,
+    0xA1, 0x55, 0x29, 0xB7, 0x48, 0x53, 0xAE, 0x4C, 0x9B, 0xE9, 0x30, 0xAD, 0x81, 0xF1, 0xB8, 0xB5,
+    0x9F, 0xCD, 0x54, 0x3D, 0x6E, 0xD6, 0x40, 0x10, 0x7D, 0xB6, 0x45, 0x5C, 0xB8, 0x70, 0x1A, 0xAA,
+    0x14, 0xBE, 0x01, 0xBE, 0x01, 0x6B, 0x44, 0x91, 0x82, 0x82, 0x14, 0x09, 0x0D, 0x87, 0x48, 0x4B,
+    0x13, 0x6C, 0x41, 0x49, 0xC3, 0x0D, 0xE8, 0x73, 0x86, 0x48, 0x6B, 0x29, 0x45, 0x0A, 0x0A, 0xAC,
+    0x50, 0xD0, 0x1A, 0x09, 0x04, 0xA2, 0x61, 0x91, 0x5C, 0xEC, 0x17, 0xEC, 0x1D, 0xDE, 0x6C, 0x22,
+    0x22, 0x48, 0x14, 0x0A, 0x12, 0xC4, 0x16, 0xB3, 0xF3, 0xAD, 0xE7, 0x9B, 0x9F, 0x37, 0x6F, 0x06,
+    0x28, 0x7A, 0x00, 0x89, 0x50, 0xC0, 0x78, 0x8A, 0x52, 0x46, 0x20, 0x0F, 0xD2, 0xF1, 0xF1, 0x7E,
+    0x00, 0xDA, 0xAE, 0xF0, 0x48, 0x1A, 0xDC, 0x6A, 0x70, 0xE9, 0x69, 0x67, 0x64, 0xF2, 0x56, 0x7A,
+    0x98, 0xC5, 0xFC, 0xA6, 0x1E, 0xAA, 0x3A, 0x5F, 0x54, 0x3B, 0x55, 0x3D, 0xD2, 0xA8, 0xD6, 0x97,
+    0xAB, 0xBE, 0x56, 0xDB, 0x67, 0x32, 0xA0, 0xF5, 0xB5, 0x7C, 0xB1, 0x72, 0x4F, 0x78, 0xA6, 0x52,
+    0x25, 0x54, 0xB8, 0x9C, 0x62, 0x41, 0x4D, 0xD9, 0xA1, 0x15, 0x1A, 0x9E, 0x1E, 0x33, 0x9A, 0x11,
+    0x59, 0xC8, 0x34, 0x75, 0xD7, 0x3A, 0xE4, 0x52, 0xB0, 0x38, 0xEB, 0xAC, 0x63, 0x69, 0x0F, 0xA9,
+    0xEE, 0x6C, 0xED, 0x6C, 0xE1, 0x8A, 0xF3, 0xBF, 0x15, 0x84, 0x44, 0xDB, 0x82, 0x32, 0xFE, 0x6E,
+    0x55, 0x64, 0xF1, 0xA1, 0x8A, 0x0F, 0x82, 0xBF, 0x3E, 0xAC, 0x04, 0x72, 0xCC, 0xA0, 0xB9, 0x64,
+    0xD2, 0xC0, 0x4C, 0x04, 0x2C, 0x91, 0xBE, 0x5C, 0x50, 0x06, 0x96, 0x40, 0x18, 0xD1, 0x4E, 0x19,
+    0xBF, 0x8B, 0xAB, 0x66, 0x7E, 0x19, 0xC8, 0x90, 0x4C, 0x8E, 0x18, 0x39, 0x97, 0xD6, 0x2B, 0x63,
+    0x34, 0x57, 0xE6, 0xAD, 0xE8, 0xCB, 0x44, 0x69, 0xD5, 0x25, 0x58, 0x0C, 0x58, 0xBD, 0x83, 0x1A,
+    0x76, 0x9A, 0x71, 0xD0, 0x70, 0xD6, 0xC7, 0x67, 0xB2, 0x0C, 0x45, 0xB4, 0x33, 0xB1, 0x06, 0x99,
+    0xB5, 0xB2, 0x68, 0x4D, 0x7B, 0x17, 0x4B, 0x8D, 0x57, 0xC3, 0x7F, 0x8F, 0x04, 0x64, 0x24, 0x3E,
+    0x03, 0x71, 0xC9, 0x99, 0x45, 0x0B, 0xF3, 0xCE, 0xA5, 0x81, 0xD7, 0x27, 0x57, 0x2C, 0xED, 0x26,
+    0xB3, 0x11, 0xD7, 0xCA, 0x9C, 0x33, 0x66, 0xBB, 0x20, 0x9F, 0xCE, 0xFF, 0x7E, 0x7A, 0xC5, 0xA3,
+    0x41, 0x13, 0x4D, 0x96, 0x5E, 0x9A, 0xD2, 0xE7, 0x33, 0x69, 0x5F, 0xF6, 0xD5, 0x98, 0x2F, 0xE9,
+    0xC2, 0x6F, 0xF5, 0xD0, 0xCE, 0xE9, 0x52, 0x4E, 0x30, 0xC3, 0x42, 0x06, 0x95, 0x6C, 0xF0, 0x18,
+    0x54, 0xF1, 0x54, 0x5A, 0x47, 0x4E, 0xC9, 0x60, 0xC6, 0x8A, 0x20, 0x69, 0xBB, 0x1D, 0xEC, 0xA1,
+    0x20, 0x5B, 0x4C, 0x68, 0x5A, 0x46, 0x97, 0x99, 0x4E, 0x35, 0x0D, 0xCD, 0x43, 0x96, 0x64, 0x67,
+    0x63, 0x15, 0x63, 0x66, 0x5A, 0x5C, 0x3D, 0x69, 0x70, 0x42, 0x40, 0x34, 0xA9, 0x0C, 0xBF, 0xE2,
+    0xBF, 0xE1, 0x23, 0x7A, 0x5D, 0x25, 0x32, 0x96, 0x2B, 0x3B, 0xE7, 0x04, 0x9B, 0x2D, 0x6E, 0x7B,
+    0x36, 0xC0, 0x19, 0xA4, 0x4B, 0xD5, 0xC1, 0x3E, 0x18, 0x51, 0xBD, 0x9F, 0x90, 0xFB, 0xA7, 0x74,
+    0x50, 0x7D, 0x7C, 0x4C, 0x52, 0x31, 0x94, 0x65, 0x5C, 0x65, 0x10, 0xB9, 0x64, 0x87, 0x22, 0x34,
+    0x67, 0x0C, 0x31, 0x54, 0x2A, 0x42, 0x5B, 0xB2, 0xF2, 0x9C, 0xDE, 0xB3, 0xF9, 0x4F, 0x1C, 0xB8,
+    0xD6, 0x1C, 0x22, 0x61, 0xB5, 0x6E, 0xCE, 0x1C, 0x94, 0x16, 0xB4, 0x02, 0xA9, 0x0F, 0xA2, 0xEE,
+    0x6E, 0x03, 0xDB, 0x3F, 0xC3, 0xAE, 0x05, 0x25, 0x41, 0x6C, 0xAD, 0xCF, 0xC2, 0xAE, 0x24, 0x0B,
+    0xD9, 0x18, 0x50, 0x39, 0xD3, 0x64, 0x33, 0x1B, 0x60, 0x37, 0x47, 0xD4, 0xC7, 0x9E, 0x21, 0xF7,
+    0x90, 0x04, 0xCD, 0xE1, 0x68, 0xF5, 0x48, 0x9C, 0xC2, 0xAD, 0x73, 0x92, 0x49, 0xA4, 0xC4, 0xD7,
+    0x29, 0x95, 0x97, 0xC0, 0x9D, 0x6C, 0x80, 0x71, 0x9E, 0x34, 0xBB, 0x8B, 0xE2, 0x8D, 0x34, 0x99,
+    0x23, 0xBD, 0x0E, 0x8A, 0x1B, 0x44, 0xBB, 0x98, 0x8B, 0x39, 0x55, 0x3E, 0x48, 0x2F, 0xBD, 0x99,
+    0xCC, 0x54, 0x85, 0x6A, 0xC9, 0xE5, 0x85, 0x74, 0x17, 0x96, 0xCC, 0xB5, 0x56, 0x9A, 0x4D, 0x4A,
+    0xAC, 0x06, 0xE9, 0x77, 0x02, 0x3C, 0xB3, 0xB9, 0x75, 0x38, 0x7D, 0x88, 0x9D, 0xBF, 0xB1, 0xB0,
+    0xE7, 0x08, 0xAA, 0x5B, 0x7E, 0x7F, 0x25, 0x44, 0x5B, 0x77, 0x97, 0x74, 0x84, 0x52, 0xA6, 0x62,
+    0x52, 0x34, 0x27, 0x58, 0x05, 0x34, 0xEC, 0x5B, 0xCE, 0x91, 0xE2, 0xE5, 0x09, 0xAB, 0x1A, 0xA9,
+    0x7B, 0x5E, 0xAF, 0x09, 0xEE, 0xC9, 0x36, 0x12, 0xE2, 0xAB, 0x1B, 0x42, 0x21, 0x26, 0x57, 0x15,
+    0xE5, 0x80, 0xFC, 0x79, 0x74, 0x27, 0xA3, 0x8D, 0x97, 0x8F, 0xEB, 0x51, 0x02, 0xA7, 0x56, 0x1F,
+    0x1A, 0x05, 0xDD, 0x7E, 0x3E, 0x4D, 0x63, 0x77, 0xC5, 0xD8, 0x3E, 0xD1, 0x36, 0x32, 0xBE, 0x1D,
+    0x38, 0x8B, 0xF4, 0xA2, 0x23, 0xDF, 0xD3, 0x23, 0x89, 0x4F, 0x5C, 0x2A, 0x5D, 0x04, 0x4A, 0xC2,
+    0xF1, 0x09, 0x0D, 0x99, 0x9B, 0xB0, 0x12, 0x71, 0x89, 0xE5, 0x70, 0xEE, 0xE9, 0x28, 0x36, 0x4C,
+    0x10, 0x58, 0x3F, 0xA0, 0x89, 0x83, 0xEE, 0x38, 0x8E, 0x7F, 0xA1, 0xD3, 0x42, 0x7F, 0x28, 0xC2,
+    0x19, 0x87, 0x0B, 0x85, 0x16, 0xEB, 0x57, 0xCD, 0xCF, 0x4A, 0x01, 0x71, 0xDC, 0x65, 0xD2, 0x90,
+    0x06, 0x8E, 0x79, 0x2C, 0xE5, 0xC9, 0x7E, 0xE4, 0xCD, 0x37, 0xDD, 0xEB, 0xBA, 0x1D, 0x76, 0x57,
+    0xDB, 0x31, 0xAB, 0x24, 0x76, 0x6A, 0x41, 0xC1, 0xCE, 0x90, 0x39, 0x4C, 0x88, 0x20, 0xCE, 0x9C,
+    0x92, 0x80, 0x35, 0xF9, 0x80, 0x7F, 0x79, 0x7E, 0x00, 0xB5, 0x55, 0xBD, 0x92, 0xD4, 0x46, 0x10,
+    0x6E, 0x49, 0x18, 0x05, 0x0A, 0x26, 0x81, 0x04, 0x02, 0xE5, 0x04, 0xE8, 0x0D, 0x18, 0x19, 0x3F,
+    0x00, 0x17, 0xDC, 0xC5, 0x3C, 0xC2, 0x3D, 0x01, 0x35, 0xE2, 0x2E, 0x20, 0x70, 0x00, 0x09, 0xB1,
+    0x53, 0x7B, 0x93, 0xE3, 0x01, 0xA8, 0x1A, 0x01, 0x55, 0x10, 0x38, 0x60, 0xAA, 0x08, 0x1C, 0x38,
+    0xB0, 0x8A, 0x9F, 0x22, 0x20, 0x60, 0x8E, 0xD2, 0x61, 0x1D, 0x8C, 0xA6, 0xFD, 0xF5, 0xEC, 0xAE,
+    0x39, 0x8E, 0xE2, 0x0C, 0x2E, 0xD0, 0x6A, 0x56, 0x1A, 0x69, 0xA6, 0xFB, 0xEB, 0xEE, 0xAF, 0x3F,
+    0x11, 0x69, 0x22, 0x6A, 0x3A, 0x22, 0xE5, 0x88, 0x2A, 0x4F, 0x54, 0x4C, 0x44, 0xF9, 0x4C, 0x5F,
+    0x7B, 0x9C, 0x8E, 0x2D, 0x55, 0x1C, 0x48, 0x31, 0x3B, 0x35, 0x97, 0xA1, 0x0C, 0xA4, 0x7F, 0x8A,
+    0x0B, 0xEB, 0x99, 0x39, 0x18, 0xFC, 0x5D, 0xC5, 0xF8, 0x33, 0x6E, 0x51, 0xC6, 0x58, 0x6D, 0xE0,
+    0x4C, 0x71, 0x9B, 0xDF, 0xC7, 0x43, 0xAF, 0xB1, 0xA2, 0xC4, 0x0D, 0xE1, 0xA6, 0xCB, 0xEC, 0x21,
+    0xDE, 0x03, 0x03, 0x71, 0x4B, 0x64, 0x01, 0xC8, 0xB2, 0x0C, 0x4F, 0xF6, 0x3A, 0x93, 0x6D, 0x95,
+    0x3F, 0x4B, 0xB4, 0xF9, 0x79, 0x1C, 0x99, 0xBD, 0x45, 0x39, 0x6C, 0x15, 0xCC, 0x63, 0xC1, 0x3F,
+    0x32, 0xDC, 0x29, 0xC7, 0x8B, 0xBD, 0x00, 0xE3, 0x5C, 0x63, 0xFC, 0x81, 0xF1, 0x96, 0x6F, 0xB7,
+    0x64, 0x7A, 0xA2, 0x7A, 0x44, 0xC0, 0xEC, 0xE8, 0x8E, 0x05, 0x06, 0x40, 0xC7, 0x72, 0xE6, 0x1E,
+    0x37, 0x03, 0x6D, 0xC7, 0x36, 0xDB, 0xC4, 0x8F, 0x73, 0xB8, 0x75, 0xB6, 0xD7, 0xA3, 0x1E, 0x55,
+    0x54, 0xB1, 0xE0, 0x1B, 0x7C, 0x9D, 0xF7, 0x01, 0xE8, 0xC4, 0xE3, 0x5B, 0xE2, 0x40, 0xB6, 0xB0,
+    0xA0, 0x8C, 0xC8, 0x5D, 0x4F, 0x06, 0x4B, 0x4F, 0xAD, 0x9C, 0x5C, 0x68, 0x49, 0xF7, 0x27, 0x9D,
+    0x66, 0x79, 0x3A, 0x39, 0xED, 0x80, 0xB3, 0xF0, 0x75, 0x1F, 0x4B, 0xAF, 0xEF, 0xC5, 0x8F, 0xD0,
+    0x2E, 0x8A, 0xA0, 0xBC, 0xEE, 0xF9, 0xC8, 0xC5, 0xDC, 0xE3, 0x72, 0xAE, 0x47, 0xFB, 0x94, 0x3B,
+    0x2A, 0x10, 0x6C, 0x8E, 0x1D, 0x19, 0x20, 0x66, 0x3C, 0x63, 0x58, 0x97, 0xE1, 0x75, 0x16, 0xA9,
+    0x71, 0x9B, 0x1F, 0xD5, 0xE3, 0x37, 0x0C, 0x38, 0x26, 0x25, 0x54, 0x0A, 0x52, 0xC6, 0x93, 0x1E,
+    0x80, 0x25, 0x1F, 0x08, 0x21, 0x49, 0xA8, 0xE0, 0x25, 0x87, 0xC7, 0xC6, 0xD9, 0xCB, 0xB1, 0x9A,
+    0xF4, 0xC0, 0xBB, 0xAC, 0x82, 0xD9, 0xE7, 0x87, 0x8B, 0x73, 0xBF, 0x1E, 0x01, 0x2C, 0x96, 0x60,
+    0xE4, 0xA4, 0x8B, 0xD8, 0x36, 0xAB, 0x8B, 0x4B, 0x86, 0x91, 0x01, 0x58, 0xDF, 0x90, 0xFD, 0xE2,
+    0x0B, 0x50, 0x84, 0x67, 0xE5, 0xB2, 0x94, 0xDA, 0x49, 0x09, 0x24, 0xE3, 0x92, 0xFF, 0x4E, 0xC8,
+    0x88, 0x2D, 0x5B, 0xDB, 0x2F, 0x36, 0x69, 0xFB, 0x96, 0xC1, 0x0E, 0x7E, 0x13, 0xA4, 0xA2, 0x58,
+    0x2D, 0x0B, 0x7A, 0x58, 0x33, 0x28, 0x6F, 0x24, 0x3D, 0x51, 0x0D, 0x76, 0x22, 0xC7, 0x3D, 0x42,
+    0x01, 0x5B, 0xE0, 0xB1, 0x9C, 0xA9, 0x19, 0xA8, 0x9E, 0x73, 0x90, 0x58, 0xE8, 0x0D, 0x08, 0x62,
+    0x99, 0x84, 0xE5, 0x4B, 0x36, 0xE3, 0x49, 0x2A, 0xC1, 0x0F, 0xAD, 0xFC, 0x57, 0x6E, 0x22, 0x35,
+    0x37, 0x00, 0xF0, 0x7B, 0x9F, 0x1D, 0xE0, 0xF5, 0xB5, 0x66, 0x24, 0xB5, 0x33, 0x7D, 0x4A, 0xAB,
+    0xB0, 0xFD, 0x5C, 0x6C, 0xF5, 0xA0, 0x50, 0xA8, 0x60, 0xEE, 0x32, 0x77, 0x8D, 0xB7, 0x7D, 0x11,
+    0xF4, 0x40, 0xAC, 0x46, 0xD2, 0x4F, 0x66, 0x52, 0x23, 0x77, 0xC5, 0x2C, 0x0F, 0x6E, 0x4E, 0xA4,
+    0x9F, 0x31, 0xD5, 0x87, 0xDC, 0x97, 0xD1, 0xF8, 0x9C, 0xFF, 0x0A, 0x64, 0xDF, 0x33, 0x35, 0x41,
+    0xA5, 0x16, 0x43, 0x19, 0x2A, 0xE9, 0x75, 0xC9, 0x4C, 0xC5, 0xC7, 0x7C, 0x9D, 0x9F, 0x05, 0xF6,
+    0x28, 0xEE, 0x5A, 0x1D, 0xAD, 0x6F, 0xC6, 0x32, 0x62, 0x9B, 0x79, 0x80, 0x2E, 0x3F, 0x90, 0xD0,
+    0x91, 0x5D, 0xBB, 0xE7, 0xA9, 0x79, 0x89, 0x07, 0x87, 0xDC, 0x16, 0x51, 0xFB, 0x82, 0xAF, 0x00,
+    0x94, 0xB4, 0xF5, 0x80, 0xB8, 0x3D, 0xDA, 0x7A, 0x4C, 0x36, 0x84, 0x39, 0xB0, 0x26, 0x79, 0x86,
+    0xD6, 0xD4, 0xEB, 0xF2, 0x8B, 0xD6, 0x84, 0xFF, 0x94, 0x16, 0x24, 0xB1, 0x06, 0xEB, 0x6A, 0x91,
+    0x16, 0xDE, 0x0B, 0xD5, 0x9C, 0xF1, 0x6E, 0x44, 0xD2, 0x81, 0x61, 0x06, 0x06, 0xFE, 0x05, 0x18,
+    0x5E, 0x05, 0xAA, 0x0E, 0x13, 0x28, 0x87, 0xB0, 0x03, 0xF1, 0x13, 0x29, 0x15, 0xDA, 0x69, 0x42,
+    0xB5, 0x02, 0xDA, 0x69, 0x4E, 0x36, 0x52, 0xFB, 0x64, 0xD3, 0x8A, 0x86, 0x47, 0xE5, 0x85, 0x77,
+    0x18, 0x92, 0x73, 0x4C, 0x5E, 0x32, 0x94, 0x15, 0x31, 0xB4, 0x65, 0xEA, 0xE2, 0x57, 0xD0, 0x82,
+    0xD6, 0x0C, 0xDC, 0x95, 0x01, 0xFC, 0xE2, 0xAB, 0x9E, 0x34, 0x42, 0xAF, 0xDE, 0xA1, 0xEA, 0x31,
+    0xE1, 0x18, 0x53, 0xB6, 0xF5, 0x28, 0x9A, 0xD7, 0x80, 0x3F, 0xC2, 0xA7, 0x94, 0x3E, 0xB1, 0x01,
+    0x3A, 0xC0, 0xE2, 0xC5, 0xC2, 0x91, 0xF6, 0xA0, 0x0C, 0x5F, 0xA2, 0xEA, 0x31, 0x24, 0xD0, 0xA3,
+    0x08, 0x77, 0x2B, 0xF7, 0x7D, 0x43, 0xAE, 0x42, 0x15, 0x72, 0x2E, 0x10, 0xA1, 0xE3, 0x95, 0x92,
+    0xD5, 0x73, 0x09, 0x25, 0xEB, 0xB6, 0x36, 0xB6, 0x36, 0x8E, 0x09, 0xD7, 0xB7, 0x0E, 0x99, 0xCE,
+    0x0A, 0xC7, 0x55, 0xAA, 0xB3, 0x30, 0x6E, 0x79, 0x9B, 0xA5, 0xDB, 0x46, 0x16, 0xE4, 0xD2, 0x1A,
+    0xFF, 0x1E, 0x67, 0xE8, 0x82, 0xC4, 0x21, 0x4D, 0x06, 0xDD, 0x14, 0xBB, 0x9A, 0xDF, 0x2D, 0x16,
+    0xED, 0xEA, 0xF5, 0x17, 0x1B, 0x13, 0x91, 0xCC, 0xD6, 0xAC, 0x4B, 0xCA, 0x53, 0xCB, 0x1B, 0xDB,
+    0xAE, 0x66, 0x42, 0x40, 0xB2, 0x60, 0x63, 0x31, 0xAF, 0x67, 0xA6, 0x5B, 0x7D, 0xFB, 0x96, 0xB3,
+    0x7E, 0xA9, 0x7A, 0xE8, 0x27, 0x34, 0x03, 0x3C, 0xA4, 0x90, 0x24, 0xB6, 0x14, 0x64, 0x73, 0x00,
+    0x81, 0xE0, 0x9F, 0x39, 0xA0, 0xF7, 0x5E, 0x8F, 0x28, 0x8D, 0x76, 0xE6, 0x51, 0xB0, 0x3B, 0xDC,
+    0x3C, 0x8D, 0x65, 0xE0, 0x2B, 0x53, 0xFD, 0x3E, 0x18, 0x74, 0xC1, 0xDF, 0xDC, 0x4A, 0x10, 0x22,
+    0x1D, 0x43, 0xDA, 0x98, 0x9A, 0x62, 0x99, 0x1E, 0xE9, 0x0A, 0xDB, 0x8B, 0xF0, 0x88, 0x1B, 0xA1,
+    0xA5, 0x75, 0x47, 0x67, 0x22, 0x8B, 0x39, 0xAF, 0xA3, 0x34, 0xC3, 0x7A, 0x26, 0xF0, 0x2E, 0x49,
+    0xB0, 0x3D, 0x7D, 0xF8, 0x1A, 0xFC, 0x9F, 0xE3, 0x1F, 0xD5, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14,
+    0xBD, 0xE3, 0x91, 0x62, 0x29, 0x2E, 0x26, 0x4D, 0x2A, 0x0A, 0x3F, 0x82, 0x1F, 0x61, 0x2C, 0x28,
+    0xB6, 0xA0, 0xD8, 0x66, 0x43, 0xCB, 0x23, 0xE4, 0x09, 0x60, 0x8C, 0x28, 0xB6, 0x84, 0x02, 0xAA,
+    0xB4, 0x29, 0x02, 0x4D, 0xDE, 0x20, 0x33, 0x4A, 0x8A, 0x6D, 0x9D, 0xEC, 0x0B, 0x58, 0x02, 0x09,
+    0x09, 0x0A, 0xBC, 0xC8, 0x85, 0x57, 0x19, 0xFB, 0x72, 0xCE, 0x7C, 0xDF, 0xAE, 0x56, 0xE1, 0x57,
+    0x88, 0x02, 0xFC, 0x69, 0xEC, 0xB9, 0xF3, 0x8D, 0xE7, 0x9C, 0x7B, 0xEE, 0x8F, 0x45, 0x44, 0x2A,
+    0xC5, 0xAD, 0x5B, 0x38, 0x19, 0x30, 0xC9, 0x9C, 0x8C, 0x72, 0xF7, 0xEA, 0x46, 0xF1, 0x17, 0x8B,
+    0xB4, 0x57, 0x9B, 0xD4, 0x39, 0x0C, 0x46, 0xDB, 0x49, 0xC2, 0xAB, 0x55, 0xDA, 0x79, 0xC7, 0x82,
+    0x4F, 0x95, 0xBA, 0x59, 0xE2, 0xAB, 0x2C, 0x7E, 0xD6, 0xDE, 0x6D, 0x7E, 0x69, 0xF4, 0x43, 0x55,
+    0x7D, 0x8D, 0xB1, 0x78, 0xD5, 0xAD, 0xC1, 0xA4, 0xC7, 0x98, 0xEE, 0x69, 0x7F, 0x3C, 0xB2, 0x4D,
+    0x22, 0x6E, 0x12, 0xA9, 0x67, 0xC0, 0x01, 0x52, 0x76, 0x8C, 0x28, 0x7F, 0x7E, 0x35, 0x8B, 0xB8,
+    0x03, 0x87, 0xFE, 0xC0, 0xE1, 0xE2, 0x96, 0x03, 0x48, 0x1D, 0x39, 0x74, 0xB3, 0x8A, 0xCB, 0x7E,
+    0xB4, 0x7A, 0xBA, 0x55, 0xFA, 0x86, 0x1C, 0x02, 0x38, 0x38, 0x4C, 0xDE, 0xC7, 0x18, 0x41, 0x68,
+    0x35, 0xF1, 0xC6, 0xC1, 0x80, 0xE1, 0x61, 0xF8, 0x0D, 0x03, 0x6E, 0xFB, 0x9F, 0x36, 0xD8, 0xF8,
+    0xA5, 0x6A, 0xBB, 0x0B, 0x0D, 0xCB, 0x1E, 0x60, 0xC7, 0x03, 0xEC, 0xD5, 0x2D, 0x2C, 0xB5, 0x38,
+    0xC0, 0x36, 0xD0, 0xC2, 0xAA, 0x5B, 0x44, 0x2F, 0xB5, 0x8F, 0x4B, 0x04, 0x6C, 0x0B, 0xC8, 0x0F,
+    0x08, 0x0B, 0x63, 0x01, 0x87, 0x5D, 0x1E, 0x43, 0x69, 0x73, 0x66, 0xCE, 0x2A, 0x85, 0xF0, 0x31,
+    0x69, 0xF2, 0x8B, 0x5F, 0xDC, 0xEE, 0x36, 0xAB, 0xE7, 0xFA, 0x99, 0xFE, 0xA2, 0xD3, 0xBB, 0x6E,
+    0xFF, 0xBB, 0xD8, 0xC7, 0xCB, 0x23, 0x12, 0x86, 0xC2, 0x37, 0xD3, 0xD1, 0x2A, 0x61, 0x80, 0x88,
+    0xFF, 0xE4, 0xAA, 0x21, 0x96, 0x9E, 0x66, 0xD0, 0x6A, 0x57, 0xE9, 0x26, 0x3F, 0x8B, 0xF6, 0x7E,
+    0xAE, 0xB3, 0xC4, 0xB1, 0x9B, 0x44, 0x93, 0xF6, 0x95, 0x9E, 0x67, 0xB1, 0x0A, 0x0B, 0xD9, 0xD0,
+    0x8B, 0x53, 0xA0, 0x75, 0xF4, 0xD5, 0x33, 0x27, 0x22, 0xB1, 0x69, 0x55, 0xB4, 0x1A, 0x5A, 0x01,
+    0x56, 0x03, 0xCB, 0x73, 0x27, 0x9C, 0xC0, 0xCB, 0xC8, 0x11, 0x57, 0x5E, 0x59, 0xEF, 0x42, 0xC3,
+    0x08, 0xC3, 0xED, 0x03, 0x9B, 0x03, 0xE4, 0xC1, 0xDE, 0xA0, 0xB9, 0xDE, 0x75, 0x0E, 0x2F, 0x81,
+    0xDC, 0xE4, 0x90, 0xBA, 0x1F, 0xB2, 0xEC, 0x21, 0xB9, 0xEF, 0xF0, 0xF0, 0xA9, 0xBB, 0xCC, 0x4C,
+    0x5D, 0xFD, 0x3C, 0x87, 0xD9, 0x2B, 0xC4, 0x07, 0x61, 0x45, 0xD2, 0x20, 0x05, 0x12, 0xE4, 0x96,
+    0xDF, 0x3E, 0xC0, 0x62, 0xD0, 0xC1, 0xEE, 0x76, 0x97, 0x36, 0xB7, 0x59, 0xC2, 0x1C, 0xE7, 0x4A,
+    0x5F, 0x6A, 0x72, 0x7A, 0xAA, 0xF2, 0xF0, 0xEC, 0xE1, 0xD9, 0x7F, 0x59, 0x26, 0x79, 0x80, 0xB7,
+    0x9E, 0xEB, 0xC6, 0x77, 0x55, 0x13, 0xF7, 0x2A, 0x62, 0x1D, 0xF5, 0xC7, 0x67, 0x7F, 0x23, 0xBE,
+    0x87, 0xBA, 0x0D, 0x25, 0x39, 0x3C, 0x61, 0x81, 0x30, 0x30, 0x79, 0x78, 0x06, 0x20, 0x59, 0x2B,
+    0x46, 0x63, 0x11, 0xE9, 0x0B, 0x2E, 0xF9, 0x4B, 0x16, 0x74, 0x37, 0x73, 0xC9, 0xAD, 0xED, 0x42,
+    0xDF, 0xAD, 0x72, 0xAB, 0x70, 0x49, 0x13, 0x04, 0x80, 0xD7, 0x5C, 0xF2, 0xD7, 0x8F, 0x40, 0x9B,
+    0xC9, 0xBA, 0xD2, 0x69, 0x55, 0x6C, 0x62, 0xB3, 0x20, 0x4F, 0x38, 0xC5, 0xBB, 0xF6, 0x61, 0xA5,
+    0xE3, 0x6C, 0x4E, 0x3E, 0x3B, 0x25, 0xF0, 0x09, 0x08, 0x98, 0x02, 0x2F, 0xE6, 0x5B, 0xDD, 0x0D,
+    0xBD, 0x3A, 0x16, 0xFB, 0x37, 0x7F, 0xEC, 0x88, 0x89, 0x03, 0x05, 0x58, 0x0D, 0xCB, 0x41, 0x9F,
+    0x68, 0x0A, 0x08, 0x80, 0x1F, 0xEA, 0xEC, 0x46, 0x51, 0x3B, 0x4B, 0xF7, 0x1A, 0x24, 0x96, 0x17,
+    0x62, 0xF6, 0xB6, 0x97, 0x70, 0x3E, 0x49, 0x77, 0xB5, 0x3F, 0x8A, 0x19, 0x4D, 0x43, 0x9B, 0x1B,
+    0x84, 0x56, 0xDF, 0x6E, 0x12, 0xBF, 0xC7, 0x69, 0xF7, 0xBF, 0xAA, 0xA0, 0x9E, 0xCD, 0x86, 0xCE,
+    0x92, 0x26, 0x83, 0x45, 0x61, 0xAA, 0x22, 0xB1, 0xBC, 0xB7, 0xF7, 0xFF, 0x53, 0x59, 0xEF, 0x3F,
+    0x35, 0xCF, 0xEC, 0x66, 0x94, 0xFB, 0x06, 0x1C, 0x92, 0x8A, 0x47, 0xCD, 0xEF, 0xF9, 0x73, 0x6F,
+    0xE7, 0x7B, 0x3A, 0xD5, 0x40, 0xB2, 0xFB, 0x63, 0x35, 0x1B, 0x78, 0xA0, 0x46, 0x66, 0xDF, 0xDB,
+    0xEC, 0x92, 0xC4, 0x13, 0xA8, 0xF8, 0x66, 0x45, 0x85, 0x7E, 0x42, 0x59, 0x07, 0x89, 0x17, 0xD7,
+    0x1F, 0xE9, 0x4C, 0x16, 0x10, 0x4B, 0xC9, 0x6A, 0x0C, 0xFA, 0xF3, 0x52, 0xE9, 0x97, 0x14, 0xA0,
+    0xB4, 0xA8, 0x9A, 0xDF, 0x24, 0x10, 0x4E, 0x45, 0xA5, 0x92, 0xC7, 0xB1, 0x2C, 0xF9, 0xF2, 0x69,
+    0x6A, 0xDF, 0x96, 0x5E, 0xB5, 0x72, 0xC9, 0x6E, 0xBE, 0x14, 0x44, 0xA9, 0x06, 0x34, 0x50, 0x30,
+    0x0C, 0x23, 0x2A, 0x0B, 0x1F, 0x23, 0x2E, 0xB9, 0x6C, 0xE0, 0x51, 0x83, 0xAE, 0x3E, 0xE3, 0xBC,
+    0xAF, 0x3F, 0xDE, 0x84, 0x99, 0x82, 0xA5, 0x58, 0x0A, 0x80, 0x81, 0xDD, 0x19, 0x34, 0x65, 0x1D,
+    0x33, 0xBA, 0x35, 0xFE, 0x73, 0x7B, 0x05, 0x68, 0xC0, 0x97, 0x12, 0x59, 0xA8, 0x52, 0x5B, 0xE0,
+    0xEB, 0x12, 0x24, 0x5B, 0xEE, 0xE6, 0xF0, 0x81, 0x08, 0x7A, 0x88, 0x5B, 0x2A, 0xB1, 0x2A, 0xA1,
+    0x6C, 0xD6, 0x77, 0x53, 0xAE, 0xA4, 0x45, 0xC9, 0x39, 0x77, 0x8D, 0x22, 0x66, 0xD2, 0xD9, 0x55,
+    0xD0, 0x8C, 0x90, 0x75, 0xE2, 0xD1, 0xE1, 0x0D, 0xD3, 0x0E, 0xAD, 0xB8, 0x9D, 0x98, 0x77, 0xC3,
+    0xA7, 0x70, 0xC8, 0x30, 0xF1, 0xA8, 0xCE, 0xDC, 0xDC, 0xB0, 0x93, 0x92, 0x7A, 0xCD, 0x7E, 0x42,
+    0x02, 0x74, 0xDB, 0x32, 0x1D, 0xDA, 0xE9, 0xF8, 0xED, 0xAC, 0xD8, 0x03, 0x2C, 0x39, 0xD4, 0xA4,
+    0x63, 0x5E, 0xFC, 0x65, 0x5D, 0xFF, 0x0A, 0xD5, 0x55, 0x31, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0xFF,
+    0x05, 0x5C, 0xB8, 0x70, 0x05, 0x0D, 0x12, 0x3E, 0x82, 0x8F, 0xB0, 0xDB, 0xD1, 0xA6, 0x49, 0x95,
+    0x43, 0xA4, 0xA5, 0x5B, 0x1F, 0x81, 0x73, 0xD0, 0x70, 0x02, 0xB4, 0xA6, 0x40, 0x29, 0x71, 0x83,
+    0x28, 0x71, 0x11, 0x09, 0xD1, 0x59, 0x60, 0x89, 0x9F, 0x60, 0x7B, 0x78, 0x6F, 0xF6, 0xE7, 0x87,
+    0x08, 0xA5, 0x4F, 0x2C, 0x79, 0xFF, 0x8B, 0x77, 0x77, 0xDE, 0xCC, 0xDB, 0x37, 0x1B, 0x11, 0xF9,
+    0x20, 0x78, 0xEA, 0x1E, 0xC3, 0x6E, 0x21, 0xF4, 0x01, 0x43, 0x35, 0x11, 0xAA, 0xDC, 0xFB, 0x3C,
+    0xD3, 0xEB, 0x20, 0xA5, 0xEA, 0x22, 0x4E, 0x55, 0x7B, 0xC1, 0xB0, 0x17, 0x8F, 0x31, 0x54, 0xBA,
+    0xBD, 0x9B, 0x45, 0x57, 0x2C, 0x6A, 0x19, 0xC0, 0x29, 0x63, 0xC7, 0x3D, 0xA3, 0x2A, 0x63, 0x2B,
+    0x63, 0xD7, 0x16, 0xFB, 0x7F, 0xD8, 0x11, 0xAE, 0x06, 0xD7, 0x70, 0x16, 0x22, 0x22, 0xCE, 0x64,
+    0xD0, 0xD0, 0x12, 0x92, 0x47, 0x3B, 0x67, 0x6C, 0x35, 0xA1, 0x34, 0x84, 0x05, 0x32, 0xAF, 0x47,
+    0xE4, 0x9E, 0x8B, 0x20, 0x4C, 0xB7, 0xB9, 0xBE, 0xDC, 0x42, 0xA9, 0x9B, 0x44, 0xDD, 0x63, 0xE3,
+    0xD8, 0xCE, 0x60, 0x40, 0xEE, 0x58, 0xD7, 0x80, 0x33, 0xF5, 0xB2, 0x43, 0x02, 0x25, 0x38, 0x1B,
+    0x7C, 0xF2, 0xFB, 0x57, 0x92, 0x90, 0x80, 0xE2, 0x4D, 0xA8, 0xAE, 0xDD, 0xC2, 0x4D, 0x98, 0x68,
+    0x42, 0xED, 0xAD, 0xA4, 0x81, 0x69, 0xB2, 0x1A, 0xFF, 0x07, 0x1B, 0xEB, 0xB9, 0x9E, 0xC5, 0x61,
+    0xF1, 0xF0, 0x38, 0xE4, 0xB2, 0x87, 0xBB, 0x50, 0xBC, 0x51, 0x45, 0xCC, 0xA4, 0x6F, 0x8B, 0xA4,
+    0x2E, 0xF5, 0x29, 0x94, 0xCB, 0x6D, 0xE2, 0xE7, 0x57, 0x52, 0x60, 0x1F, 0xDE, 0x51, 0xB8, 0x35,
+    0xA1, 0x44, 0x3F, 0x64, 0xE9, 0xB8, 0x8E, 0xDA, 0x59, 0x98, 0x06, 0xB2, 0x96, 0xFC, 0x43, 0xC7,
+    0x37, 0xA8, 0x44, 0x83, 0x23, 0x3F, 0x00, 0xA6, 0xAF, 0x58, 0x8C, 0x05, 0xB5, 0xE2, 0xEA, 0x0C,
+    0x29, 0x56, 0xC3, 0x2C, 0x76, 0x88, 0x2D, 0xF2, 0xFC, 0xF4, 0xE1, 0x0B, 0xF7, 0xF4, 0x04, 0x0C,
+    0x03, 0x14, 0x09, 0x52, 0x6D, 0x34, 0x8B, 0xC5, 0xCB, 0xCC, 0x47, 0xBD, 0x1A, 0xDD, 0x53, 0x2E,
+    0x6C, 0xEB, 0xA0, 0x96, 0x5B, 0xB3, 0x58, 0x31, 0xFB, 0x8C, 0x32, 0x50, 0xAA, 0x38, 0x99, 0x52,
+    0xBB, 0x4C, 0x3B, 0xE3, 0x77, 0x32, 0x9D, 0xDA, 0xA1, 0x40, 0x60, 0x9C, 0x43, 0x87, 0xE5, 0x71,
+    0x64, 0x2D, 0xAC, 0xA8, 0xDD, 0xE4, 0xA0, 0xB3, 0x38, 0x6B, 0xCD, 0x27, 0x8F, 0xA5, 0x35, 0x49,
+    0xD0, 0xB9, 0xA5, 0x9E, 0x9B, 0xC9, 0x6D, 0x96, 0x0D, 0x74, 0x3B, 0xF4, 0x5E, 0x35, 0xDE, 0xCD,
+    0x1C, 0x8D, 0x4A, 0xB3, 0x21, 0xF7, 0x8E, 0xEA, 0xB1, 0x53, 0xE9, 0xB5, 0xD8, 0xE7, 0x37, 0x1D,
+    0xDE, 0x38, 0x64, 0xFD, 0xD8, 0xAB, 0x74, 0x1A, 0xD6, 0x0E, 0x26, 0x20, 0x9A, 0xB5, 0x38, 0x91,
+    0xA7, 0x01, 0x2A, 0xA2, 0x1B, 0x25, 0x7D, 0x54, 0x9A, 0x8B, 0x45, 0x56, 0x56, 0x43, 0x9B, 0x8D,
+    0xC7, 0x4A, 0xDD, 0x78, 0x9F, 0x7C, 0xA8, 0xEB, 0x2D, 0xE5, 0xD3, 0x4B, 0x42, 0x1D, 0x09, 0xB5,
+    0x27, 0x54, 0xF8, 0xBB, 0xD4, 0x19, 0xD4, 0xA5, 0x5E, 0x28, 0x7D, 0xCC, 0x2C, 0xE2, 0x57, 0x40,
+    0xB7, 0x11, 0xB6, 0xBF, 0x8D, 0xF0, 0x08, 0x9D, 0x41, 0x4F, 0x58, 0x72, 0x41, 0xA1, 0xDF, 0x55,
+    0x5E, 0xE8, 0x6A, 0xC1, 0x2E, 0x38, 0x2C, 0x06, 0x5F, 0x73, 0x98, 0x08, 0x17, 0xB2, 0xF1, 0xAA,
+    0xD2, 0x1F, 0x96, 0x8C, 0x1F, 0x8E, 0xF7, 0xB0, 0x5B, 0x3C, 0x0A, 0xA9, 0x27, 0x3A, 0xC1, 0x5F,
+    0x50, 0x58, 0x6D, 0x46, 0x7E, 0x86, 0x55, 0xA4, 0xFE, 0xB9, 0x49, 0x73, 0x19, 0x3F, 0xDB, 0x81,
+    0xF8, 0xC1, 0xDF, 0x9C, 0xFE, 0x08, 0xB3, 0xB5, 0x38, 0x0A, 0x9C, 0xD1, 0xC6, 0x1B, 0x0A, 0x8E,
+    0x6D, 0x06, 0x18, 0x4F, 0x52, 0xD8, 0x69, 0x28, 0x56, 0xA9, 0x56, 0x29, 0x67, 0xF1, 0x33, 0x02,
+    0x17, 0xE8, 0x48, 0x7F, 0xFD, 0x9E, 0x57, 0x01, 0x73, 0xC8, 0xBE, 0xD9, 0x59, 0x10, 0x8C, 0x64,
+    0x49, 0x96, 0x4D, 0x43, 0x69, 0x4C, 0x27, 0xDC, 0x8D, 0x85, 0x9D, 0xBA, 0x64, 0x91, 0x38, 0xC5,
+    0x1F, 0x94, 0x1A, 0x11, 0xDD, 0x3E, 0xD8, 0xA5, 0x80, 0x8E, 0x6F, 0xB2, 0xF1, 0x4D, 0x90, 0x91,
+    0x53, 0xA2, 0x9F, 0xCE, 0xF4, 0x14, 0x69, 0x78, 0xB2, 0x55, 0x4B, 0xB6, 0xE9, 0x2F, 0xE3, 0xD3,
+    0xBE, 0x34, 0xCD, 0x6C, 0x17, 0xFC, 0x19, 0xA7, 0xE2, 0x5C, 0x07, 0xE3, 0xD2, 0xCC, 0xB5, 0x64,
+    0xAE, 0xC1, 0xCE, 0x48, 0x73, 0x1A, 0x93, 0x64, 0xF5, 0x38, 0x75, 0x1D, 0x8E, 0xF2, 0xB9, 0xFC,
+    0x6F, 0x0D, 0x8C, 0x6C, 0x02, 0x93, 0x65, 0xCA, 0xB0, 0x38, 0x8D, 0x5F, 0x4E, 0xF2, 0x02, 0x88,
+    0xD7, 0xD3, 0xB6, 0x77, 0x9A, 0xC6, 0xB4, 0x43, 0x03, 0x27, 0x24, 0xD6, 0x3B, 0x18, 0x73, 0xA6,
+    0x80, 0x26, 0x1D, 0x20, 0xEC, 0x19, 0x71, 0xCB, 0x05, 0x6C, 0x8F, 0x73, 0x56, 0x6E, 0xF7, 0x8F,
+    0xFB, 0xD3, 0x41, 0x3E, 0xEB, 0xE4, 0x20, 0x0F, 0xF3, 0xF9, 0x0B, 0xCD, 0x55, 0x3B, 0x6E, 0xD4,
+    0x50, 0x14, 0xBD, 0xF6, 0x88, 0x71, 0xE1, 0xE2, 0x35, 0x84, 0x62, 0x52, 0x78, 0x09, 0x5E, 0xC2,
+    0x18, 0x28, 0x28, 0xD2, 0x4C, 0x11, 0x53, 0xB0, 0x03, 0xD2, 0x64, 0x07, 0xD8, 0x12, 0x1B, 0x48,
+    0x93, 0x3E, 0x14, 0x14, 0x31, 0x45, 0x58, 0x41, 0x6C, 0x89, 0x0D, 0xB8, 0x41, 0xB4, 0x8E, 0x04,
+    0x05, 0x34, 0x18, 0xC9, 0x44, 0x4E, 0x64, 0xFB, 0x72, 0xCE, 0xB3, 0x89, 0x48, 0xA2, 0x41, 0x53,
+    0x10, 0x14, 0x6B, 0x9E, 0xE5, 0x67, 0xDF, 0xCF, 0x39, 0xE7, 0xDE, 0xFB, 0x46, 0x44, 0x1E, 0x8A,
+    0xAF, 0xDA, 0x48, 0xAE, 0x5A, 0xCF, 0x54, 0xB5, 0x08, 0x35, 0x3B, 0x96, 0xBF, 0x5D, 0x4E, 0xF6,
+    0x4E, 0x9B, 0x80, 0xA6, 0xF0, 0x51, 0x17, 0xAB, 0xF5, 0x87, 0xC3, 0x95, 0x84, 0x35, 0x3E, 0xE6,
+    0x85, 0x88, 0xAB, 0x78, 0xF0, 0x3B, 0xDC, 0xC2, 0x9F, 0xF1, 0x91, 0xD0, 0x92, 0x91, 0xC5, 0xA8,
+    0x76, 0xB2, 0x44, 0x1E, 0xD1, 0x52, 0x64, 0x46, 0x2B, 0x43, 0xAB, 0x25, 0x1D, 0xF5, 0x4B, 0x1C,
+    0xD3, 0xAA, 0x83, 0x95, 0xD6, 0xB0, 0xD2, 0x12, 0x4B, 0x5F, 0x63, 0x0D, 0x4C, 0xD6, 0xD9, 0xD4,
+    0x7B, 0x27, 0x83, 0x4C, 0x99, 0x1B, 0xD8, 0x0C, 0xB2, 0xD9, 0xE5, 0xE4, 0x07, 0x40, 0xA5, 0xC8,
+    0xA9, 0xCD, 0x4C, 0x1F, 0xAB, 0x03, 0x30, 0xA5, 0x66, 0x27, 0x1D, 0xF3, 0x30, 0xFA, 0x27, 0xAC,
+    0x73, 0x3D, 0x8C, 0x24, 0x01, 0xFE, 0xA0, 0x21, 0xBA, 0x52, 0xDE, 0xE7, 0x13, 0x1C, 0x87, 0x29,
+    0xF1, 0x50, 0xC9, 0xFE, 0x10, 0xB9, 0xC7, 0x92, 0x89, 0xA9, 0x3D, 0x4B, 0xA5, 0x94, 0x04, 0x61,
+    0x21, 0x1E, 0x28, 0x84, 0x17, 0xF7, 0x4E, 0xB2, 0x07, 0xF0, 0xE9, 0x25, 0x97, 0xB1, 0xAE, 0x5A,
+    0xCD, 0x18, 0x69, 0x09, 0x1E, 0x4E, 0x16, 0xFD, 0x47, 0xC9, 0x64, 0x36, 0xFC, 0x09, 0xDC, 0x51,
+    0x78, 0xF8, 0xE4, 0xB2, 0xEC, 0x71, 0x8B, 0x57, 0xF7, 0x49, 0x32, 0x46, 0xB4, 0xA1, 0x09, 0x72,
+    0x09, 0x5A, 0x01, 0xB0, 0x7B, 0x9A, 0xAE, 0xC3, 0x79, 0x47, 0x92, 0xCD, 0xB3, 0x13, 0x2D, 0x93,
+    0x89, 0x79, 0x87, 0x09, 0xD5, 0x2A, 0xBC, 0x8C, 0xA3, 0x9B, 0xCC, 0xAD, 0x18, 0x1F, 0x9F, 0xA7,
+    0x37, 0x99, 0x5B, 0x31, 0xA2, 0x6B, 0xCC, 0x0B, 0xA6, 0x3B, 0x8C, 0x77, 0xAF, 0x98, 0x17, 0x64,
+    0xFE, 0x94, 0xCC, 0xF9, 0xAA, 0x65, 0x32, 0x34, 0x07, 0x88, 0xCE, 0x5A, 0xD8, 0x07, 0xB0, 0x97,
+    0x84, 0xEE, 0x6A, 0xDD, 0xA1, 0xA5, 0x6C, 0x61, 0x6D, 0xA3, 0xCB, 0x43, 0xDB, 0x45, 0x1A, 0x2D,
+    0x9B, 0xA0, 0x0E, 0x6A, 0xE9, 0xCD, 0x65, 0xA6, 0x1F, 0xE0, 0xFE, 0x03, 0xAB, 0x67, 0x9C, 0xFD,
+    0x8B, 0x5D, 0xC1, 0x80, 0xA0, 0xD2, 0x91, 0x2D, 0xB2, 0xEF, 0x4F, 0xF9, 0xEA, 0x80, 0x18, 0x39,
+    0xB8, 0x73, 0xFD, 0x3C, 0xC9, 0x46, 0x59, 0xD9, 0x07, 0x64, 0x95, 0x13, 0x2E, 0x7C, 0x82, 0x6F,
+    0x44, 0x0B, 0x08, 0x39, 0x54, 0x9A, 0x77, 0xA3, 0xA1, 0xA9, 0x24, 0x89, 0x4C, 0xE3, 0xB7, 0x62,
+    0x2E, 0x50, 0x10, 0xA3, 0xC0, 0x69, 0x58, 0x19, 0x73, 0x05, 0x78, 0x6B, 0x7D, 0x75, 0x16, 0x59,
+    0x8E, 0x9A, 0x4C, 0x62, 0xD6, 0x98, 0x06, 0x4D, 0xF3, 0xAF, 0xF1, 0x2D, 0x31, 0xAD, 0xBE, 0xF1,
+    0x8B, 0x5B, 0x62, 0x52, 0xDF, 0xFE, 0xBA, 0x98, 0x84, 0x34, 0xC4, 0xF1, 0xEA, 0x4A, 0x4C, 0x5A,
+    0xF5, 0x56, 0x4C, 0xBE, 0x3A, 0xE3, 0xAB, 0x62, 0x91, 0xCA, 0x1E, 0x66, 0x10, 0x62, 0x9D, 0x69,
+    0x04, 0x83, 0x08, 0x41, 0x27, 0x67, 0x6A, 0x3D, 0x4F, 0x37, 0x39, 0xBF, 0xFE, 0xB1, 0xE8, 0xA3,
+    0x9E, 0x61, 0xC5, 0xBB, 0x47, 0x6B, 0xF8, 0x90, 0x9B, 0x24, 0xDF, 0x1B, 0x2A, 0x59, 0x27, 0xA8,
+    0xB6, 0xD7, 0x4A, 0x8E, 0x4F, 0xBB, 0xF6, 0xB7, 0xE9, 0xB5, 0x38, 0x7D, 0x0B, 0x9F, 0xC4, 0x1E,
+    0xD7, 0xC4, 0x54, 0x08, 0xFB, 0xBE, 0xE7, 0x48, 0xF0, 0xB0, 0x54, 0x3D, 0x90, 0x97, 0x63, 0xCD,
+    0xA0, 0x32, 0x95, 0x1C, 0x8F, 0x80, 0xB1, 0xD6, 0xD8, 0xB4, 0xE3, 0x26, 0x9D, 0x36, 0x8B, 0x15,
+    0x47, 0x0F, 0x83, 0x71, 0x84, 0x8D, 0x61, 0xB7, 0x16, 0x42, 0x75, 0x3B, 0x30, 0xC1, 0xD0, 0x82,
+    0x40, 0xDE, 0x85, 0x20, 0x60, 0x3A, 0xD8, 0xAC, 0xE6, 0x76, 0x7C, 0x98, 0x3B, 0xB1, 0xD2, 0x3B,
+    0xE3, 0xC6, 0xB3, 0x1B, 0xFE, 0xCB, 0xB1, 0x89, 0xE7, 0x7A, 0xF9, 0xFB, 0xE8, 0x33, 0xE5, 0x34,
+    0x4B, 0x79, 0x4B, 0x79, 0x2B, 0xF1, 0x7B, 0x4D, 0xDD, 0xC1, 0x1D, 0x40, 0xDC, 0x6B, 0xD7, 0x30,
+    0x74, 0x87, 0x9D, 0xD6, 0xD1, 0x41, 0x53, 0xE4, 0x68, 0xCD, 0xA0, 0xFA, 0xA4, 0x73, 0xF1, 0x5F,
+    0x14, 0x19, 0x7D, 0x56, 0x4B, 0xD2, 0xBC, 0x02, 0xFA, 0x9D, 0x0A, 0x07, 0xC7, 0x29, 0x1E, 0x3C,
+    0xBC, 0xA9, 0x93, 0x34, 0xB0, 0x8D, 0x61, 0x5B, 0x8E, 0xCD, 0x54, 0x13, 0x10, 0x75, 0xA9, 0x65,
+    0xFB, 0xCD, 0x30, 0x15, 0x02, 0x2D, 0x52, 0xA1, 0xAD, 0x10, 0xB0, 0x25, 0x6C, 0x99, 0x4E, 0xEB,
+    0x56, 0x1E, 0x69, 0x2B, 0x77, 0x77, 0xFD, 0x02, 0xD5, 0x54, 0xBB, 0x6E, 0xD5, 0x40, 0x10, 0x1D,
+    0xDF, 0x55, 0xE2, 0xC2, 0x85, 0x2B, 0x28, 0x42, 0xB1, 0x7D, 0x1A, 0xB7, 0x88, 0x66, 0x8D, 0x28,
+    0x69, 0x52, 0x24, 0x75, 0x6A, 0xAA, 0xFB, 0x07, 0xD8, 0x11, 0x3F, 0x10, 0xF1, 0x05, 0x41, 0x22,
+    0x12, 0x8F, 0x22, 0x3D, 0x45, 0x6C, 0x85, 0x82, 0x82, 0xC6, 0x52, 0x84, 0x28, 0x68, 0x2C, 0xA5,
+    0xA3, 0xC1, 0x80, 0x83, 0x9C, 0x68, 0xED, 0xE1, 0xCC, 0xEC, 0x0D, 0xCA, 0x03, 0xA4, 0x50, 0x80,
+    0x60, 0xA5, 0xBB, 0x77, 0xD6, 0xFB, 0x38, 0xB3, 0xE7, 0x9C, 0x59, 0x9A, 0x3D, 0xA3, 0xD5, 0x9C,
+    0x28, 0x3B, 0xDE, 0xEC, 0x88, 0x66, 0xCC, 0x4C, 0x44, 0x29, 0x73, 0x83, 0xBF, 0x82, 0x7B, 0x92,
+    0xBF, 0x81, 0xAE, 0xDF, 0x56, 0xF6, 0x77, 0x73, 0xD9, 0xC9, 0x5E, 0x7B, 0xAE, 0xC9, 0xA2, 0x1F,
+    0xC9, 0xA0, 0xC7, 0xA1, 0xCC, 0xDB, 0xF4, 0x00, 0xE7, 0x97, 0x24, 0x60, 0x9D, 0xEC, 0x70, 0xA3,
+    0xF4, 0x06, 0x2B, 0x65, 0x30, 0x84, 0x41, 0xB9, 0x18, 0xAC, 0xAC, 0x51, 0xCC, 0x65, 0xC4, 0xBC,
+    0x83, 0x01, 0xD2, 0xBA, 0x87, 0x65, 0xCC, 0x83, 0xF3, 0xB4, 0xCC, 0xFC, 0x88, 0x5B, 0xA2, 0xCA,
+    0x67, 0x9C, 0x53, 0xEA, 0xB1, 0x66, 0x6D, 0x99, 0xEB, 0x54, 0x70, 0xBC, 0x42, 0x73, 0x1D, 0x85,
+    0x41, 0xAC, 0x03, 0x4A, 0x34, 0x03, 0x6C, 0x3C, 0xCD, 0x29, 0x7A, 0x9E, 0xAF, 0xE6, 0x55, 0x99,
+    0x35, 0xC8, 0xAE, 0x43, 0x6E, 0x3D, 0x39, 0x1E, 0x28, 0xAA, 0xDA, 0x5F, 0x5C, 0xAB, 0x7A, 0x3C,
+    0x45, 0x3C, 0xF1, 0x16, 0x8E, 0x68, 0xF9, 0x13, 0xF7, 0x15, 0x55, 0xA3, 0xCB, 0x53, 0xDE, 0x04,
+    0xC6, 0xFB, 0x96, 0xDC, 0x37, 0x64, 0x37, 0xEE, 0x23, 0x71, 0x8B, 0x0F, 0x6F, 0x86, 0x88, 0x3B,
+    0x41, 0xCE, 0xD0, 0xC9, 0xC5, 0x6B, 0xA4, 0xD3, 0xC5, 0x92, 0xCA, 0xAD, 0x27, 0x93, 0x9C, 0x86,
+    0xEB, 0xB9, 0xE6, 0x36, 0xB9, 0x2E, 0x9D, 0x78, 0x90, 0x09, 0x10, 0x3F, 0x91, 0xFC, 0x6E, 0x72,
+    0x60, 0x7B, 0x43, 0x7B, 0xAB, 0x0C, 0xCD, 0x70, 0x41, 0xA1, 0xA3, 0xBF, 0xC8, 0x0D, 0x5A, 0x1C,
+    0x58, 0xBB, 0x5E, 0x8B, 0x5E, 0x7E, 0x5C, 0x27, 0x25, 0xA3, 0xD6, 0xDE, 0x53, 0x14, 0x44, 0x71,
+    0xAA, 0x50, 0xCA, 0x27, 0xB4, 0xBC, 0x4D, 0x01, 0x3F, 0xE3, 0x80, 0xD5, 0x28, 0x96, 0xBF, 0x02,
+    0x8C, 0x41, 0xB4, 0xAB, 0xD6, 0xB0, 0x7C, 0x2A, 0x33, 0xA0, 0x10, 0xCB, 0x52, 0x11, 0xA5, 0xA6,
+    0x39, 0x14, 0xC2, 0x3D, 0x13, 0x3E, 0x10, 0x07, 0x71, 0x6D, 0xF9, 0x98, 0xE6, 0x9E, 0x58, 0x75,
+    0x88, 0x83, 0x28, 0x36, 0x88, 0x52, 0xE8, 0x80, 0x2A, 0xC9, 0x80, 0xB0, 0xF1, 0xA9, 0x24, 0x2A,
+    0xE0, 0x05, 0xA0, 0x33, 0xEC, 0x4E, 0xA7, 0x85, 0x39, 0xC4, 0x2D, 0x37, 0xD6, 0xFF, 0x01, 0x6D,
+    0x96, 0x36, 0x54, 0x8E, 0x30, 0x48, 0x83, 0x36, 0xC1, 0xCA, 0xA9, 0xB2, 0x46, 0xAC, 0x2E, 0xCA,
+    0xCE, 0xFB, 0x3A, 0xD4, 0x50, 0x12, 0x16, 0xBF, 0xD8, 0xA1, 0xDF, 0x6E, 0xFF, 0x49, 0x5D, 0x05,
+    0xA3, 0x09, 0x35, 0x05, 0xE0, 0x2D, 0x07, 0xCC, 0x48, 0xE6, 0xAB, 0x2E, 0x38, 0xC9, 0x4E, 0x81,
+    0x35, 0x73, 0xDE, 0xBB, 0xC9, 0x49, 0xD6, 0x5A, 0xFE, 0x34, 0xE0, 0x52, 0x13, 0x78, 0xE7, 0xFB,
+    0x5D, 0xC2, 0x87, 0x3D, 0xF1, 0x31, 0x8C, 0x32, 0x3E, 0xC4, 0xDA, 0x39, 0x2C, 0xF6, 0x01, 0x62,
+    0x7E, 0xC6, 0x07, 0x5F, 0x94, 0x96, 0x25, 0xA1, 0x03, 0xFC, 0x3A, 0xB8, 0xD7, 0x4B, 0x26, 0x92,
+    0x5B, 0x1D, 0xBD, 0xB2, 0xC8, 0x3D, 0x01, 0xBE, 0x19, 0x4D, 0x69, 0x98, 0x60, 0x88, 0x52, 0x26,
+    0x20, 0x77, 0x8B, 0x2D, 0x6D, 0x34, 0x0F, 0x1C, 0x68, 0x9E, 0xEA, 0x6B, 0xD7, 0x9C, 0xC9, 0x68,
+    0xD4, 0x83, 0xBC, 0xD7, 0xCB, 0x47, 0x7C, 0x4E, 0x3B, 0xAA, 0xF2, 0x9F, 0xCB, 0x21, 0xCE, 0x04,
+    0xBC, 0x10, 0xB4, 0x08, 0x4B, 0x09, 0x87, 0x45, 0x68, 0x3D, 0x68, 0x8D, 0xF8, 0xF5, 0xA5, 0x70,
+    0x74, 0x52, 0x73, 0x87, 0x22, 0xDE, 0x59, 0xF8, 0x6E, 0x63, 0x3E, 0x4A, 0xFD, 0x21, 0x44, 0x9B,
+    0x34, 0x3C, 0xBA, 0x12, 0x7A, 0x88, 0x7A, 0x84, 0x6D, 0x8E, 0x11, 0x1A, 0xFE, 0xAA, 0x45, 0x5B,
+    0x88, 0xFA, 0x1D, 0x19, 0x75, 0x9B, 0x3A, 0x2B, 0xF3, 0x6A, 0xB2, 0xF0, 0x90, 0x83, 0xDD, 0x6A,
+    0x0B, 0x02, 0x64, 0x8D, 0x01, 0xD4, 0x1A, 0x2D, 0x5D, 0xBC, 0x4A, 0xDA, 0xFF, 0xD8, 0x76, 0x3E,
+    0x54, 0xEB, 0xA8, 0x8D, 0x35, 0xD4, 0x52, 0x24, 0xFB, 0x05, 0xF6, 0x12, 0xD1, 0x4B, 0x71, 0xDD,
+    0x88, 0xD3, 0x27, 0x80, 0x00, 0x8D, 0x11, 0x52, 0x8C, 0xC7, 0xB3, 0x23, 0x97, 0x83, 0x6D, 0x33,
+    0x68, 0x28, 0xC4, 0xC7, 0x1A, 0x16, 0x35, 0xC2, 0xC4, 0x4B, 0x28, 0x95, 0x0F, 0x8E, 0xA8, 0x08,
+    0x61, 0x6E, 0x3D, 0x55, 0xFD, 0x8C, 0xEB, 0x04, 0xA4, 0xBB, 0x6E, 0xA6, 0x5C, 0x52, 0xD5, 0xE0,
+    0x4E, 0xA4, 0x3C, 0xD6, 0xC9, 0x14, 0x26, 0x84, 0x59, 0xA9, 0xA9, 0x98, 0xEF, 0xEA, 0x0B, 0xE2,
+    0xD5, 0x84, 0xAC, 0x0F, 0x08, 0xBF, 0xD5, 0xBE, 0x53, 0x36, 0x1B, 0xA9, 0xBF, 0xA2, 0x37, 0x4A,
+    0x6A, 0x78, 0x6D, 0x72, 0x65, 0xB1, 0x55, 0xF7, 0x0E, 0x5A, 0x2B, 0x53, 0x98, 0x28, 0xCF, 0x26,
+    0xC0, 0xD2, 0x60, 0x94, 0x5A, 0x29, 0xE2, 0x94, 0x6B, 0xA7, 0xB4, 0x5A, 0xE4, 0x23, 0xB5, 0x76,
+    0x99, 0xA6, 0x25, 0xF1, 0x88, 0x13, 0xC3, 0x1B, 0x7D, 0xB2, 0xEE, 0xEC, 0xFD, 0x25, 0x9A, 0xE8,
+    0xCF, 0xB4, 0xEF, 0x85, 0x55, 0x31, 0x6F, 0xDD, 0x36, 0x10, 0x3E, 0x49, 0x71, 0x35, 0x68, 0x50,
+    0x17, 0x77, 0xD5, 0x9E, 0x85, 0xFF, 0x20, 0x54, 0xE2, 0x3F, 0xF0, 0x06, 0x7B, 0xC9, 0x9F, 0xE8,
+    0x2F, 0x08, 0x28, 0xA0, 0x63, 0x17, 0x0F, 0xF9, 0x09, 0x19, 0x02, 0x2F, 0x59, 0x03, 0xC4, 0x01,
+    0xD5, 0x7A, 0xC8, 0x90, 0x21, 0x42, 0x3A, 0x74, 0xE8, 0x10, 0x01, 0xED, 0x1E, 0x16, 0x65, 0x03,
+    0x22, 0x20, 0x75, 0xF9, 0x8E, 0x7A, 0xF1, 0x7B, 0xAF, 0x76, 0x5C, 0x52, 0x24, 0xCE, 0x67, 0x1E,
+    0xEF, 0xEE, 0xBB, 0x8F, 0xF7, 0x9A, 0xC1, 0xF3, 0xD5, 0x3F, 0xFC, 0xEE, 0xC3, 0x8F, 0xCB, 0xA5,
+    0xFE, 0xE4, 0xD5, 0x40, 0x37, 0x47, 0x1B, 0x49, 0x3B, 0xE2, 0xB1, 0xE2, 0xAD, 0x68, 0xC7, 0x92,
+    0xA9, 0x89, 0xA4, 0x0E, 0xC5, 0xA9, 0xE4, 0xBE, 0x49, 0xA4, 0x02, 0xF1, 0x5C, 0xF1, 0xD0, 0x2E,
+    0xA4, 0x23, 0xB1, 0xAB, 0x78, 0x6C, 0x71, 0xE6, 0xFC, 0xA5, 0xF2, 0x97, 0x3A, 0x5E, 0x3E, 0x31,
+    0xF1, 0x89, 0x0A, 0x0F, 0x9A, 0xF9, 0xC0, 0xC7, 0x19, 0x11, 0xDF, 0xF5, 0x15, 0xBB, 0xAF, 0x2F,
+    0x79, 0xC0, 0x07, 0x9B, 0x67, 0x2D, 0x73, 0xEC, 0x98, 0x93, 0x66, 0x5E, 0xEE, 0x5F, 0x9C, 0x6D,
+    0xE8, 0xAE, 0x81, 0xD8, 0x6F, 0x5D, 0xCD, 0xFF, 0xAD, 0xB4, 0xB7, 0x16, 0xD8, 0xEC, 0x2F, 0x3E,
+    0x5C, 0x32, 0x1E, 0xBF, 0x60, 0x62, 0xE6, 0xC9, 0x30, 0x07, 0x09, 0xEC, 0xDE, 0xED, 0xE1, 0x1C,
+    0xF7, 0x30, 0x71, 0x44, 0x15, 0x5C, 0x48, 0x8E, 0xA4, 0xC7, 0x3B, 0x14, 0x85, 0x28, 0x0C, 0x14,
+    0x1D, 0x14, 0x35, 0x22, 0xC9, 0x08, 0xD8, 0x19, 0x19, 0xA0, 0x2C, 0x3C, 0x6A, 0x97, 0x05, 0x3B,
+    0x2A, 0xD7, 0xC4, 0x72, 0x5F, 0x98, 0x94, 0x6F, 0x12, 0x4E, 0xF3, 0xAC, 0x43, 0xBB, 0xA0, 0x18,
+    0xEC, 0x74, 0x6C, 0xB9, 0xF6, 0x95, 0x2F, 0x22, 0x59, 0xE0, 0x57, 0xF0, 0x58, 0x6C, 0x8E, 0x36,
+    0x9D, 0x53, 0x5E, 0x05, 0x1D, 0x74, 0x34, 0xF1, 0x1A, 0x33, 0x77, 0x73, 0x76, 0xEB, 0xC4, 0x59,
+    0x15, 0x9A, 0xA0, 0x9C, 0x1E, 0x6D, 0x8F, 0x10, 0x92, 0x5D, 0xD4, 0x52, 0xA6, 0xA3, 0x0D, 0x34,
+    0x4E, 0x7B, 0xED, 0x4D, 0xB0, 0x61, 0x3F, 0x61, 0xED, 0x76, 0x53, 0xFD, 0x77, 0xFA, 0x3C, 0xC5,
+    0x7B, 0x8E, 0x60, 0x9D, 0xC7, 0x27, 0x51, 0x5F, 0xED, 0x7D, 0x6F, 0xA2, 0xC1, 0xF7, 0xC7, 0x62,
+    0x67, 0x24, 0x4E, 0xFA, 0x93, 0x40, 0xC0, 0x6F, 0x51, 0x86, 0x9A, 0x3B, 0xB8, 0xEA, 0xA2, 0x99,
+    0x00, 0xD2, 0xDF, 0xDC, 0x03, 0x9D, 0x37, 0xB9, 0x5A, 0x9D, 0x27, 0xF0, 0x51, 0x43, 0xCD, 0x33,
+    0xD4, 0x15, 0x9F, 0x48, 0xD1, 0x52, 0x1B, 0x72, 0x38, 0xB8, 0x04, 0x70, 0x0C, 0x50, 0xD7, 0x8B,
+    0x98, 0x77, 0xC8, 0xDB, 0x38, 0xE3, 0x80, 0xF6, 0x2F, 0x3C, 0xC2, 0xBC, 0x66, 0x31, 0x17, 0xB5,
+    0x9D, 0xAC, 0xC3, 0xB9, 0x47, 0x50, 0xB7, 0xA9, 0xC1, 0x55, 0xC8, 0x21, 0x65, 0x73, 0x0F, 0xB5,
+    0xA4, 0xD7, 0x65, 0xD0, 0x70, 0xAA, 0xFC, 0xAB, 0xC6, 0x9D, 0xA0, 0x26, 0xEE, 0x44, 0xFD, 0x11,
+    0x01, 0xD8, 0x30, 0x22, 0x46, 0x86, 0x01, 0xD8, 0x8A, 0x02, 0x5A, 0x16, 0x93, 0xC7, 0x7C, 0xBE,
+    0x85, 0xE6, 0x68, 0x43, 0xEA, 0x21, 0x53, 0x15, 0x94, 0x27, 0xF3, 0x2B, 0x0F, 0x75, 0xD4, 0x81,
+    0xEC, 0x15, 0xAC, 0x68, 0x57, 0x8B, 0xBD, 0x61, 0x06, 0xA6, 0x3A, 0x80, 0x1B, 0x3B, 0x01, 0x25,
+    0xA8, 0xFD, 0x56, 0x68, 0x44, 0xB0, 0xE0, 0x50, 0xE3, 0x44, 0x28, 0x44, 0xE8, 0x56, 0x01, 0xE5,
+    0xF3, 0xC4, 0xA0, 0x43, 0x3B, 0xAB, 0x50, 0x20, 0x42, 0x52, 0x40, 0xE1, 0x55, 0xA6, 0xB2, 0xA0,
+    0x24, 0x6F, 0x02, 0x6E, 0x0B, 0xFE, 0xFA, 0x3C, 0x9B, 0x89, 0x56, 0xD2, 0x91, 0x96, 0x6A, 0x4A,
+    0x52, 0x15, 0x4B, 0x7E, 0x1E, 0x86, 0x7A, 0xAC, 0x03, 0x1D, 0x13, 0x9D, 0xDE, 0x0C, 0x51, 0x2A,
+    0x44, 0xF9, 0x16, 0xB9, 0x77, 0x7F, 0x1B, 0x85, 0xCD, 0x07, 0x5B, 0xE6, 0x72, 0xDE, 0xAA, 0x75,
+    0xEB, 0xAF, 0x37, 0xDA, 0xDF, 0xEA, 0xEB, 0x4D, 0xDE, 0xE1, 0x76, 0x4B, 0x42, 0xD3, 0xED, 0xD6,
+    0x9D, 0x03, 0x2E, 0x40, 0x8C, 0x7E, 0x84, 0xC7, 0x27, 0xE8, 0x3B, 0xD9, 0x26, 0xD9, 0x06, 0xFA,
+    0x61, 0xC7, 0xC7, 0x0A, 0x09, 0x95, 0x8B, 0xB8, 0x9F, 0xB0, 0x12, 0x96, 0x9D, 0x0A, 0xAE, 0x13,
+    0x10, 0x51, 0xD3, 0xE9, 0xAD, 0x09, 0xC9, 0x28, 0x2E, 0x32, 0xF8, 0x00, 0x04, 0x89, 0xD5, 0xA8,
+    0x6C, 0x29, 0x8E, 0x2D, 0x22, 0x55, 0x48, 0xAD, 0x91, 0x4B, 0xA5, 0x5C, 0x56, 0x60, 0x1D, 0x57,
+    0xC5, 0xE1, 0x6B, 0x86, 0x59, 0x15, 0x56, 0xD7, 0xDF, 0x23, 0x41, 0xC1, 0xBC, 0x12, 0x42, 0x08,
+    0xEE, 0x06, 0x77, 0x7D, 0xF7, 0x34, 0xBB, 0xC9, 0x9D, 0x4C, 0xAF, 0x79, 0x0B, 0x84, 0x3A, 0x65,
+    0x71, 0xFC, 0x5A, 0x85, 0x5A, 0xC0, 0x21, 0x31, 0x5C, 0xBB, 0x4E, 0x99, 0x4F, 0xDD, 0x7F, 0xFE,
+    0xCD, 0xDE, 0x87, 0x66, 0xC0, 0xBD, 0x34, 0x0A, 0xB7, 0x12, 0x17, 0x8C, 0x07, 0x20, 0x7A, 0xC6,
+    0xDF, 0xD5, 0xD2, 0xE1, 0x76, 0xF3, 0xA7, 0x50, 0x34, 0x59, 0xE4, 0x64, 0x3F, 0x20, 0xBA, 0x46,
+    0x28, 0x0B, 0x9E, 0x7A, 0xF1, 0x20, 0x2E, 0x04, 0x45, 0x88, 0x99, 0x03, 0xE2, 0xBD, 0x13, 0x36,
+    0x17, 0x99, 0xDE, 0x00, 0x7C, 0x46, 0x08, 0x02, 0xB1, 0xFA, 0x8C, 0xC3, 0x15, 0xFF, 0x8C, 0x7C,
+    0xF0, 0x8C, 0xA5, 0xF7, 0x0F, 0xB8, 0x48, 0x07, 0x90, 0xFF, 0x84, 0x07, 0xD8, 0xB4, 0x7E, 0x0B,
+    0x87, 0x34, 0xB6, 0x43, 0x41, 0x48, 0x96, 0x19, 0x29, 0xE0, 0x96, 0xCB, 0xD1, 0x29, 0xA9, 0xF7,
+    0x68, 0xF6, 0xC9, 0xCC, 0xA4, 0x3E, 0x46, 0x61, 0x9D, 0x60, 0x32, 0x42, 0xF0, 0x22, 0xC8, 0x6B,
+    0x4E, 0x22, 0x04, 0xF9, 0x17, 0xB8, 0xF8, 0x11, 0xEF, 0x26, 0x19, 0x26, 0xF3, 0x9E, 0x63, 0xBD,
+    0xB4, 0xEC, 0xEC, 0xAC, 0x33, 0xE3, 0x6E, 0x1B, 0x2B, 0xD1, 0xFB, 0x15, 0xC4, 0x8C, 0xA1, 0x40,
+    0x28, 0x4F, 0x3A, 0xC3, 0x6C, 0x82, 0x40, 0xD0, 0xE7, 0xF7, 0x4C, 0xC5, 0xE6, 0x8C, 0xBA, 0x9F,
+    0x02, 0xBD, 0x56, 0x63, 0xF9, 0x6F, 0xA2, 0xF6, 0x1D, 0x40, 0x34, 0x30, 0x08, 0xF9, 0x6C, 0x46,
+    0x4F, 0x5A, 0x86, 0x83, 0x85, 0x23, 0x05, 0x08, 0x17, 0xED, 0xAB, 0x60, 0x42, 0x3B, 0x9B, 0x95,
+    0x70, 0x2D, 0xA2, 0x28, 0x84, 0x07, 0x7A, 0x58, 0x69, 0xB3, 0xE6, 0x7B, 0xF0, 0x0B, 0x28, 0x5E,
+    0xDB, 0x78, 0x20, 0xE0, 0xB0, 0x34, 0xAA, 0x42, 0x84, 0xEE, 0x86, 0xA0, 0xC2, 0xF6, 0xCD, 0xAC,
+    0x02, 0x62, 0xD5, 0x7E, 0xFB, 0x6C, 0x76, 0xC2, 0xE7, 0x0B, 0xFB, 0x1B, 0xAF, 0x3F, 0x90, 0x7C,
+    0x2D, 0xFC, 0xCE, 0xB9, 0x15, 0xE5, 0xF1, 0x05, 0xCD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x1D,
+    0x7B, 0x15, 0xB9, 0x70, 0xE1, 0x4F, 0xF0, 0x27, 0xEC, 0x27, 0xAC, 0x05, 0x1F, 0x40, 0x1A, 0xFE,
+    0x80, 0x8A, 0x86, 0x4F, 0x58, 0x43, 0x0A, 0x4A, 0x3E, 0x21, 0x29, 0xD1, 0xA5, 0x48, 0x4B, 0xB7,
+    0x3E, 0x22, 0x51, 0x5B, 0x4A, 0x49, 0x73, 0x88, 0x82, 0x32, 0x06, 0xB9, 0x30, 0x68, 0xED, 0xE1,
+    0xCD, 0xEE, 0xDE, 0x5D, 0x72, 0xB9, 0x2B, 0x91, 0xD8, 0x62, 0xE6, 0x29, 0xD9, 0x9B, 0x99, 0xF7,
+    0x66, 0x67, 0x4C, 0x44, 0xBA, 0xA9, 0xBA, 0x72, 0x50, 0x63, 0xEE, 0x89, 0xE9, 0xD1, 0x29, 0x7C,
+    0xB6, 0x90, 0x6D, 0x75, 0x5F, 0x8E, 0xF9, 0x4C, 0xDC, 0x98, 0xAE, 0x1A, 0x94, 0xDC, 0xDA, 0x01,
+    0xDB, 0xD5, 0x03, 0x6E, 0x25, 0xC0, 0xBF, 0x78, 0x76, 0x7C, 0xC3, 0x40, 0x3D, 0x51, 0xC9, 0x1D,
+    0x42, 0x44, 0xD3, 0x8A, 0x69, 0x88, 0x2A, 0xC9, 0x10, 0x8C, 0x9E, 0x61, 0x8C, 0xDF, 0x9A, 0xA3,
+    0x47, 0x7E, 0xFB, 0xC4, 0xB4, 0xC9, 0x64, 0xA7, 0x4C, 0x7E, 0x68, 0x90, 0x57, 0x1D, 0x35, 0xAB,
+    0xEB, 0x59, 0x31, 0xF3, 0xA1, 0x29, 0xC4, 0x80, 0x53, 0x31, 0x51, 0xBD, 0x21, 0xD7, 0x80, 0x7B,
+    0x39, 0x92, 0xE9, 0xC1, 0x17, 0xA4, 0xAB, 0x01, 0xF4, 0x1F, 0x40, 0xB9, 0xE8, 0xA9, 0x1E, 0x20,
+    0x41, 0x82, 0xDC, 0x39, 0x7E, 0xC6, 0x4B, 0xC9, 0x4F, 0x88, 0xE5, 0x3C, 0x42, 0x15, 0x0D, 0xB9,
+    0xA6, 0x9C, 0x7B, 0xE8, 0x60, 0x92, 0xB7, 0x08, 0xE6, 0x13, 0xC5, 0x3D, 0x98, 0x02, 0xD5, 0x6A,
+    0xA8, 0x27, 0x62, 0x50, 0xAB, 0x37, 0xF5, 0x94, 0x2D, 0x00, 0x1A, 0x20, 0x5F, 0xC0, 0xCE, 0xF4,
+    0x7A, 0x52, 0x73, 0xA0, 0xA9, 0xC7, 0x44, 0xCB, 0x3C, 0x06, 0xAB, 0x9B, 0xD9, 0x80, 0xCF, 0x9D,
+    0x70, 0xDA, 0x01, 0x0B, 0x83, 0x0E, 0xE9, 0x4E, 0x58, 0x08, 0x9D, 0xE0, 0xD6, 0x5C, 0xF8, 0x7A,
+    0x63, 0xD7, 0x4B, 0xE9, 0x75, 0x4F, 0x60, 0x4D, 0x70, 0x6A, 0xDE, 0x5F, 0x38, 0xE6, 0x6C, 0x27,
+    0x9C, 0x0F, 0x1D, 0xA3, 0xFB, 0x23, 0x39, 0x6E, 0x45, 0x84, 0x43, 0x66, 0x67, 0xE7, 0xD5, 0x04,
+    0xA9, 0xC0, 0x63, 0x04, 0x0F, 0x7E, 0x0B, 0x1E, 0x53, 0x3D, 0x29, 0x5E, 0x73, 0x6B, 0x3D, 0xB8,
+    0xC6, 0xBE, 0xE9, 0x1D, 0x38, 0xC5, 0xEC, 0xFA, 0x14, 0x33, 0x34, 0x03, 0x0F, 0x57, 0x9A, 0x97,
+    0x48, 0xE4, 0xF3, 0xD9, 0xB9, 0xE9, 0xF9, 0x02, 0xD1, 0xC1, 0xF2, 0xD6, 0x6B, 0x6F, 0x6E, 0xE1,
+    0x8C, 0xDF, 0x73, 0x29, 0x8E, 0x72, 0xE1, 0x01, 0x24, 0x9A, 0x92, 0x27, 0xB8, 0xEE, 0xA0, 0x99,
+    0xD9, 0xA7, 0xE8, 0x91, 0x2D, 0x1C, 0x3C, 0x90, 0x70, 0x5C, 0xBA, 0x28, 0x95, 0xE2, 0xA8, 0x65,
+    0x3B, 0x4C, 0xD1, 0x87, 0xAE, 0xCA, 0x00, 0x84, 0x9F, 0x55, 0xDE, 0xF6, 0xD1, 0xC7, 0xF8, 0xD5,
+    0x1C, 0x67, 0xB0, 0xE2, 0x25, 0x79, 0x9F, 0xFC, 0x18, 0x93, 0xF1, 0x90, 0x7C, 0x9F, 0x7C, 0x9B,
+    0x7C, 0x2A, 0x26, 0x65, 0xD3, 0x29, 0x9B, 0x4E, 0xD9, 0x4C, 0xF2, 0x29, 0x4C, 0x96, 0xBC, 0x4A,
+    0xBE, 0xDC, 0x85, 0x8F, 0xDE, 0xF0, 0x9F, 0x95, 0xEB, 0xA5, 0x91, 0xF1, 0xA5, 0x70, 0xF4, 0x39,
+    0xBB, 0xE0, 0x0B, 0x8E, 0x2F, 0xA8, 0x4A, 0x2F, 0x69, 0x9B, 0xCD, 0x24, 0x29, 0x78, 0x93, 0xB2,
+    0x74, 0x29, 0x4B, 0x93, 0xB2, 0x24, 0x09, 0xB6, 0xD7, 0x63, 0xED, 0xF4, 0xEA, 0xC9, 0xE4, 0x67,
+    0xE1, 0x66, 0x2D, 0x61, 0xB2, 0xC0, 0x48, 0x0B, 0x5D, 0xE9, 0x66, 0x82, 0x2A, 0x40, 0x23, 0xF1,
+    0x95, 0x3F, 0x84, 0x5F, 0xC3, 0xFB, 0x58, 0x02, 0x8F, 0x40, 0xAA, 0x11, 0xD3, 0x89, 0xF1, 0x62,
+    0x00, 0x6B, 0x7E, 0xEF, 0x29, 0x7B, 0xD3, 0xDA, 0x6E, 0xD7, 0x1A, 0xCB, 0x3B, 0x21, 0x9C, 0xA8,
+    0x9A, 0xE6, 0x37, 0x98, 0x3A, 0x44, 0x0F, 0x1A, 0xDA, 0xC0, 0x60, 0xD8, 0x55, 0x76, 0xEA, 0x98,
+    0xFE, 0xF5, 0x15, 0xCA, 0x94, 0xDD, 0x67, 0x7B, 0xE7, 0xA9, 0x98, 0x4B, 0x28, 0x65, 0xB1, 0x1B,
+    0xA8, 0xF4, 0xD2, 0x4E, 0xD7, 0xA1, 0x10, 0x81, 0x58, 0xAD, 0x80, 0x43, 0x05, 0xC8, 0x0D, 0xE0,
+    0xBD, 0xAF, 0x7C, 0x3D, 0xE3, 0xDF, 0x6B, 0xFE, 0xBE, 0x00, 0x2E, 0x66, 0xE0, 0x77, 0xFC, 0x8D,
+    0x2F, 0x27, 0xBD, 0x54, 0x0B, 0xE0, 0xC6, 0x31, 0x20, 0x76, 0xD5, 0x05, 0x6F, 0x34, 0x8F, 0x06,
+    0xCB, 0x81, 0x9F, 0x23, 0x80, 0x40, 0xD0, 0x00, 0x54, 0x3C, 0x00, 0xEA, 0xED, 0x3E, 0x2F, 0x20,
+    0xA4, 0x02, 0xB1, 0x4C, 0xC8, 0x48, 0xD5, 0xB6, 0x49, 0x8A, 0x1D, 0x39, 0xF5, 0x97, 0xA5, 0xC1,
+    0x0A, 0xC4, 0x56, 0x67, 0xD9, 0x64, 0x3C, 0x6A, 0x0C, 0x69, 0xE9, 0xC9, 0xDC, 0x2E, 0xE0, 0xCD,
+    0x8D, 0x9A, 0x65, 0x15, 0xBE, 0x98, 0xC8, 0xDC, 0xE1, 0x0F, 0x13, 0xB7, 0x0A, 0x05, 0x66, 0x7C,
+    0xE9, 0xC9, 0xFE, 0x40, 0xCE, 0x19, 0xA4, 0xD8, 0x0D, 0x79, 0xEC, 0xFD, 0xFF, 0xA4, 0x02, 0xAD,
+    0x3E, 0x86, 0x49, 0x6A, 0xB7, 0x73, 0x10, 0x3E, 0x44, 0x14, 0x26, 0x2A, 0xCC, 0x4D, 0xAC, 0x39,
+    0x7C, 0x8F, 0x8A, 0xFD, 0xAD, 0xB3, 0x97, 0x5B, 0x15, 0x7F, 0xBA, 0x2B, 0x11, 0x45, 0xA6, 0x62,
+    0xD0, 0x58, 0x36, 0xE5, 0x42, 0xEE, 0x33, 0x8B, 0x28, 0xAD, 0xF2, 0x41, 0x94, 0x31, 0x8A, 0x32,
+    0x06, 0x51, 0x36, 0xC4, 0x1F, 0xA2, 0x28, 0xF5, 0x6F, 0x11, 0xC5, 0x42, 0x94, 0x7B, 0x4F, 0x2E,
+    0x0E, 0x89, 0x9D, 0xE3, 0xCB, 0x94, 0x2F, 0x64, 0x26, 0x35, 0xD8, 0x31, 0x8E, 0xAD, 0x54, 0x25,
+    0xE9, 0xF3, 0x30, 0x78, 0x03, 0xFD, 0xD3, 0xF3, 0x17, 0xDD, 0x55, 0xBD, 0x8E, 0xDE, 0x44, 0x14,
+    0xBD, 0xB6, 0xC5, 0x5A, 0x8A, 0x0B, 0x53, 0x51, 0xA4, 0xF1, 0x23, 0xF8, 0x0D, 0x32, 0x16, 0x11,
+    0x75, 0x2A, 0x6A, 0x7A, 0x9A, 0x3C, 0x82, 0x2D, 0x52, 0x50, 0x92, 0x37, 0xC8, 0x16, 0x29, 0x48,
+    0x9A, 0x3C, 0x82, 0x4D, 0x90, 0x48, 0x6B, 0x29, 0x25, 0x05, 0x1F, 0x5A, 0x50, 0x84, 0x28, 0x32,
+    0x48, 0x46, 0xF2, 0xAE, 0xC6, 0x3E, 0x9C, 0x73, 0xAD, 0x55, 0x22, 0xC4, 0x26, 0x4D, 0x90, 0x10,
+    0x96, 0xFC, 0xF9, 0x68, 0xC6, 0xE3, 0x39, 0x3F, 0x77, 0xEE, 0x67, 0xA6, 0x2B, 0xDF, 0x2C, 0x4C,
+    0x56, 0xAD, 0x4D, 0x34, 0x6B, 0x91, 0x38, 0x32, 0x42, 0xC3, 0x98, 0xF8, 0x5B, 0x2F, 0x7A, 0xE5,
+    0x8E, 0xBD, 0xEF, 0x2A, 0xB6, 0xB3, 0xA7, 0x66, 0x61, 0xEE, 0x57, 0x2B, 0xB7, 0x8A, 0x4B, 0xFB,
+    0x79, 0xDC, 0xAC, 0x4C, 0x15, 0xA2, 0x8D, 0x13, 0xD0, 0x55, 0xA9, 0xE6, 0xB7, 0x05, 0xE7, 0x9A,
+    0x10, 0x06, 0xC2, 0x85, 0x70, 0x27, 0xF8, 0x0E, 0x3F, 0xA6, 0x3A, 0x35, 0x7B, 0x38, 0x11, 0x5E,
+    0xA0, 0x5E, 0xDB, 0xBD, 0xB9, 0xC4, 0x57, 0x38, 0xE1, 0x35, 0x61, 0x05, 0xC1, 0x80, 0x35, 0xEC,
+    0x39, 0x70, 0x17, 0xB1, 0xC1, 0x12, 0xF8, 0x01, 0xC1, 0xD2, 0x61, 0x40, 0x81, 0x98, 0x23, 0x9E,
+    0x9D, 0xDB, 0xED, 0xA1, 0x9D, 0x49, 0x7A, 0x7C, 0xB1, 0x51, 0x01, 0x3A, 0xAB, 0x30, 0x53, 0x96,
+    0x54, 0xEC, 0xBC, 0xCF, 0x86, 0x77, 0x89, 0x68, 0x7E, 0xD8, 0x87, 0x0C, 0xE4, 0xD6, 0x00, 0x89,
+    0xAB, 0x31, 0xB7, 0x6B, 0x8E, 0x1C, 0x56, 0xC7, 0x70, 0x32, 0x14, 0x1B, 0xED, 0x08, 0xB3, 0xE1,
+    0xEE, 0x2E, 0xC0, 0x91, 0x07, 0x04, 0x6B, 0x88, 0x19, 0xBE, 0xE6, 0x9A, 0xB5, 0x27, 0x85, 0x17,
+    0xB0, 0x36, 0x8D, 0xD1, 0xCD, 0xBB, 0x75, 0x4E, 0xFF, 0xD2, 0x5B, 0xF7, 0xC6, 0x9B, 0x2C, 0x6A,
+    0xDA, 0xFB, 0x51, 0x77, 0x03, 0x87, 0xF2, 0x8F, 0xF1, 0xDC, 0x39, 0xF4, 0x40, 0x6C, 0x81, 0xAD,
+    0xDA, 0x6D, 0x7C, 0x2E, 0x0A, 0x18, 0x8A, 0xA4, 0xDD, 0xEF, 0x2D, 0x16, 0x5E, 0x8A, 0x01, 0x07,
+    0x76, 0xB1, 0xF8, 0x26, 0x59, 0xFF, 0x8A, 0x04, 0x2E, 0x31, 0x55, 0x10, 0x89, 0xD7, 0x34, 0x3A,
+    0xEA, 0x63, 0x61, 0xFE, 0xF2, 0x9C, 0xD1, 0x94, 0x18, 0x94, 0x47, 0xF2, 0x68, 0x66, 0xEB, 0x27,
+    0x06, 0xAC, 0x3C, 0x16, 0xCF, 0x63, 0x12, 0xDC, 0x3C, 0x8F, 0xE8, 0xD1, 0x74, 0x84, 0x3F, 0x29,
+    0x8F, 0x6D, 0x54, 0x34, 0x17, 0xBB, 0x47, 0x13, 0x19, 0xC2, 0xCF, 0x78, 0xC4, 0x3C, 0x18, 0x19,
+    0xF3, 0x18, 0x41, 0x58, 0x00, 0x0F, 0x70, 0x6A, 0xDF, 0xE4, 0x51, 0x3B, 0xEC, 0x05, 0x19, 0x09,
+    0x61, 0xAB, 0x5A, 0xCA, 0x20, 0x3A, 0x0E, 0x21, 0xD8, 0x80, 0x36, 0x70, 0x2D, 0x4D, 0xBA, 0x7D,
+    0xF5, 0xF0, 0x5F, 0x11, 0xDF, 0xA6, 0xC3, 0x68, 0x50, 0x7B, 0xA0, 0xE8, 0x06, 0x27, 0xCB, 0x3E,
+    0xBF, 0xDE, 0x28, 0x7F, 0x26, 0x06, 0xDA, 0x6A, 0xD2, 0x2B, 0x74, 0x82, 0x5B, 0x5E, 0x3D, 0x79,
+    0x6F, 0x99, 0xDB, 0x19, 0x7E, 0x51, 0xA1, 0xC0, 0xAB, 0x4A, 0x4C, 0xFD, 0x37, 0xF2, 0xB7, 0xEB,
+    0x77, 0x6B, 0x76, 0x16, 0xDD, 0x5C, 0x69, 0x34, 0x15, 0x90, 0xC4, 0x4F, 0xB5, 0xC1, 0x78, 0xD2,
+    0xEB, 0x4D, 0x0A, 0x51, 0x43, 0x2A, 0x05, 0xC3, 0xF7, 0x32, 0x23, 0xFC, 0xA9, 0xE9, 0x7A, 0xEB,
+    0x7D, 0xE2, 0x9E, 0x4F, 0xBC, 0xF4, 0x89, 0x08, 0xD7, 0x10, 0x76, 0x6D, 0x56, 0xE3, 0xF2, 0xB3,
+    0x11, 0xCF, 0xA1, 0x8B, 0xE7, 0x40, 0x7C, 0x2B, 0xFD, 0x26, 0x51, 0x67, 0x74, 0xCC, 0x4C, 0x72,
+    0x46, 0x61, 0xCB, 0x46, 0x3C, 0x7E, 0x8B, 0xF0, 0xC7, 0x92, 0xEA, 0x42, 0xB5, 0xAC, 0xC7, 0xD3,
+    0x1B, 0x44, 0x66, 0xE3, 0x6C, 0x25, 0xB3, 0xE7, 0xBD, 0x14, 0xF8, 0x9D, 0x55, 0xDF, 0xF5, 0x27,
+    0x0C, 0x65, 0x62, 0x6F, 0xC0, 0x17, 0xD1, 0xC2, 0xAB, 0x64, 0xD5, 0x15, 0x2C, 0xDF, 0x7B, 0x0E,
+    0x3C, 0x62, 0x0C, 0x17, 0x3C, 0x77, 0x8B, 0x58, 0xD0, 0x01, 0x15, 0x82, 0xA7, 0xA6, 0xF5, 0x9D,
+    0x35, 0xE4, 0x61, 0xB7, 0x1E, 0x67, 0xDF, 0xAA, 0x31, 0xD8, 0x11, 0x3B, 0x73, 0x90, 0x6F, 0x93,
+    0xDB, 0xAE, 0xD6, 0x52, 0xED, 0xDD, 0xFF, 0xC7, 0x69, 0x89, 0x75, 0xA9, 0x12, 0x2A, 0x99, 0x2E,
+    0xF2, 0x1F, 0x25, 0x7E, 0x78, 0xA7, 0xAF, 0x8B, 0x9A, 0x7A, 0xC6, 0x89, 0x8A, 0xD4, 0x6D, 0x4A,
+    0xD0, 0xE7, 0x49, 0x47, 0x81, 0x27, 0x81, 0x5D, 0xA7, 0xC0, 0x70, 0x53, 0xF0, 0x97, 0x7A, 0xE8,
+    0x8B, 0xCC, 0xE4, 0x38, 0x11, 0xA3, 0x3F, 0xD8, 0x2B, 0x1A, 0x75, 0x8E, 0x95, 0xA8, 0xCB, 0x7D,
+    0xE0, 0xBA, 0x8F, 0xF9, 0x09, 0x5B, 0x0B, 0x2D, 0xE9, 0xE3, 0x61, 0xF3, 0x74, 0x78, 0x6E, 0x87,
+    0xCF, 0xA5, 0x7B, 0xBB, 0x34, 0x3E, 0x35, 0x1F, 0x53, 0x9D, 0x4F, 0x31, 0x2E, 0xED, 0xC0, 0x4E,
+    0x31, 0x90, 0xE4, 0x14, 0xF0, 0xEB, 0x27, 0x14, 0xA4, 0x1D, 0xB1, 0xBA, 0xCB, 0x98, 0x73, 0x7F,
+    0xA8, 0x41, 0xE8, 0x64, 0xFA, 0x63, 0x50, 0x37, 0xD7, 0x31, 0xB5, 0xFB, 0xF8, 0xED, 0xEF, 0x12,
+    0x0E, 0xE1, 0x2A, 0x03, 0x4C, 0x87, 0x6E, 0x32, 0x25, 0xE1, 0x77, 0xC8, 0xBE, 0xBF, 0x78, 0x5B,
+    0x52, 0xB5, 0x64, 0x1E, 0xA6, 0xE1, 0xCA, 0x79, 0xCD, 0xCD, 0x4A, 0xE2, 0xA7, 0x8C, 0x1F, 0xAB,
+    0x99, 0x05, 0xA3, 0xA2, 0x7D, 0x2B, 0x5F, 0x62, 0x1E, 0x6E, 0xEF, 0x38, 0x18, 0xFF, 0x29, 0xD9,
+    0x7A, 0xCA, 0x4D, 0x13, 0xDC, 0x52, 0x7D, 0x3D, 0x78, 0x85, 0x56, 0x47, 0x99, 0x1F, 0x26, 0x36,
+    0xD7, 0x5F, 0x9F, 0xD5, 0xD9, 0xD0, 0xD9, 0x7F, 0xEE, 0xFA, 0x0B, 0xCD, 0x55, 0x31, 0x6E, 0xD5,
+    0x40, 0x10, 0x1D, 0xDB, 0x24, 0x2E, 0x5C, 0x98, 0x02, 0x68, 0x52, 0xB8, 0xA7, 0xC0, 0x47, 0x58,
+    0x87, 0x86, 0x96, 0x22, 0xE1, 0x12, 0x20, 0xFD, 0x23, 0xD8, 0x11, 0x17, 0x48, 0xCD, 0x09, 0x20,
+    0x4D, 0x38, 0x41, 0xD6, 0x47, 0xB0, 0x28, 0xA8, 0x3F, 0x02, 0x09, 0x91, 0x06, 0x23, 0x39, 0x92,
+    0x03, 0xB6, 0x87, 0xF7, 0x66, 0xFF, 0xCF, 0x8F, 0x50, 0x7A, 0xB2, 0x92, 0xC7, 0xF6, 0x7A, 0x77,
+    0xE6, 0xCD, 0xDB, 0x37, 0x63, 0x91, 0xD5, 0x22, 0x18, 0x2F, 0xA5, 0x50, 0x1B, 0x4D, 0x1C, 0xEE,
+    0xB3, 0x94, 0xE1, 0xA1, 0x8F, 0x75, 0x48, 0xED, 0x4B, 0xAE, 0x12, 0xEB, 0x37, 0x2C, 0xF6, 0xBD,
+    0x24, 0xDA, 0x0A, 0x4C, 0x25, 0x29, 0x2E, 0x29, 0x27, 0x91, 0x82, 0x7E, 0x7C, 0x27, 0x52, 0x4F,
+    0xFC, 0x22, 0x12, 0x69, 0x2F, 0x92, 0xE3, 0x25, 0xA5, 0x37, 0x87, 0x17, 0x84, 0x18, 0x84, 0x1B,
+    0xBD, 0x6A, 0x97, 0x62, 0x09, 0x63, 0x55, 0x5C, 0x92, 0xE9, 0x8F, 0x23, 0x5B, 0x52, 0xD2, 0x1D,
+    0x37, 0x7A, 0xF3, 0xB2, 0xC6, 0x12, 0x7A, 0xD1, 0xE5, 0x9D, 0xE7, 0xC6, 0x80, 0xE9, 0xF8, 0xB8,
+    0x72, 0x01, 0x9C, 0xD2, 0x55, 0x80, 0xBB, 0x99, 0x18, 0xB7, 0x0F, 0xFD, 0xF6, 0x53, 0x2B, 0x07,
+    0xE1, 0xA1, 0x92, 0xED, 0x38, 0x98, 0xED, 0x56, 0xEB, 0x10, 0x2F, 0x15, 0x6E, 0x9A, 0x11, 0xE1,
+    0xC2, 0x0D, 0x5D, 0x89, 0x6C, 0xE7, 0x64, 0xCA, 0x47, 0x26, 0xE2, 0xDE, 0x4E, 0x08, 0x7E, 0xE6,
+    0x7F, 0x29, 0xC0, 0xA8, 0x4E, 0x75, 0x6B, 0x5E, 0x57, 0xBD, 0x21, 0xF9, 0x8E, 0x8F, 0xCB, 0x31,
+    0x12, 0xAD, 0x98, 0x2F, 0xF0, 0x13, 0x30, 0xD6, 0x33, 0x56, 0xFC, 0x29, 0x04, 0x1D, 0x02, 0xD2,
+    0x19, 0x24, 0xFC, 0xE1, 0x3C, 0x62, 0x22, 0x5E, 0x1B, 0x69, 0x17, 0xF9, 0x6B, 0x6C, 0xBA, 0x20,
+    0x10, 0xC2, 0x89, 0x90, 0xB0, 0x24, 0x23, 0x4C, 0x3A, 0xC0, 0xE4, 0xBD, 0xFC, 0x3B, 0x32, 0x05,
+    0xD8, 0x9C, 0x1C, 0xE6, 0x4C, 0x38, 0xBF, 0x7A, 0xA5, 0x5C, 0xE6, 0x1B, 0x18, 0xD7, 0xEE, 0x4C,
+    0xD1, 0x4B, 0x4D, 0xA3, 0x6D, 0xF1, 0xFB, 0x5C, 0x2B, 0x1E, 0x2C, 0xE1, 0x4E, 0x37, 0x86, 0xAF,
+    0x2F, 0xB4, 0x72, 0x53, 0xA4, 0xAD, 0x9B, 0x24, 0x98, 0x35, 0x4D, 0xEF, 0xE6, 0x8D, 0x19, 0x69,
+    0x26, 0xB7, 0xC0, 0x3C, 0xFD, 0x20, 0x67, 0xEF, 0x0D, 0x40, 0x27, 0x49, 0x2F, 0xF1, 0x64, 0x80,
+    0x3D, 0x12, 0x6E, 0x39, 0x9B, 0x5F, 0x79, 0x70, 0xD3, 0x5A, 0xAA, 0x73, 0xAE, 0x87, 0xE4, 0x02,
+    0x5C, 0xBB, 0x4E, 0xF2, 0x41, 0xD2, 0x99, 0xF4, 0x50, 0x17, 0xE5, 0x08, 0xB2, 0x4C, 0x37, 0x38,
+    0x1A, 0x6A, 0x44, 0x1E, 0x1F, 0x91, 0x34, 0xCA, 0xC6, 0x91, 0x00, 0x37, 0x6D, 0x4D, 0x4D, 0x16,
+    0x3C, 0x59, 0xE0, 0xE1, 0x47, 0x24, 0x35, 0x56, 0x28, 0x2B, 0x3E, 0x6B, 0xE4, 0xCE, 0xF1, 0x5F,
+    0x99, 0x49, 0x81, 0xAF, 0x9E, 0xA1, 0xF2, 0x96, 0xC0, 0x59, 0x0F, 0xA8, 0x0F, 0xD4, 0x0A, 0x71,
+    0x63, 0xA9, 0x55, 0xCA, 0x6E, 0xB8, 0xCF, 0x13, 0xD9, 0x02, 0x55, 0xB8, 0x75, 0x6E, 0x7E, 0x40,
+    0xBA, 0xC0, 0x55, 0x32, 0xDB, 0x0D, 0x7C, 0x49, 0xDD, 0x49, 0x46, 0x82, 0xD7, 0x24, 0x8C, 0x14,
+    0x98, 0xB3, 0x8D, 0x1E, 0x8A, 0x75, 0xB4, 0x60, 0x55, 0x36, 0x62, 0x0A, 0x2B, 0x20, 0xDE, 0x66,
+    0x53, 0x7B, 0x29, 0xA9, 0x8B, 0x87, 0x7B, 0xC8, 0x50, 0xD9, 0xC8, 0x45, 0x32, 0x47, 0x2A, 0xEE,
+    0xAB, 0xD5, 0x11, 0x32, 0xD5, 0xD0, 0x23, 0xC4, 0xA1, 0x28, 0xF7, 0x76, 0x85, 0x09, 0x1A, 0x56,
+    0x10, 0x08, 0x92, 0x75, 0x44, 0xA9, 0xAC, 0xAC, 0xAE, 0xB2, 0x9E, 0x01, 0x72, 0x28, 0x28, 0x23,
+    0x8A, 0x92, 0x22, 0x4D, 0x52, 0x62, 0x22, 0x5B, 0xE8, 0xAB, 0x09, 0x62, 0xA1, 0x7E, 0x0A, 0xBD,
+    0x95, 0x77, 0x67, 0xA4, 0xD3, 0x50, 0xB7, 0x70, 0x61, 0x13, 0xDE, 0x62, 0x4D, 0x77, 0x52, 0x55,
+    0x90, 0x2A, 0x94, 0xEB, 0x42, 0x72, 0xB5, 0xB7, 0xC2, 0x6F, 0xD8, 0x98, 0xDE, 0x20, 0xC4, 0x5A,
+    0x36, 0xC0, 0xAD, 0xB3, 0xC1, 0xB3, 0xF1, 0x6D, 0x95, 0x1C, 0x29, 0x9B, 0xA3, 0xB5, 0x34, 0xDB,
+    0xD3, 0x72, 0x86, 0xB2, 0x5D, 0xF1, 0x59, 0x22, 0x6B, 0x60, 0xF0, 0xC3, 0x0D, 0xE5, 0x2C, 0x23,
+    0x25, 0x9E, 0x69, 0x93, 0x6A, 0x57, 0xB3, 0x43, 0xA4, 0xBB, 0x6E, 0x51, 0x91, 0xE7, 0xB5, 0xEC,
+    0x79, 0xEB, 0xB6, 0x1B, 0xDD, 0x70, 0x57, 0x13, 0xF0, 0x67, 0x7D, 0xE8, 0x14, 0xF1, 0x7C, 0x0B,
+    0x76, 0xA9, 0xA7, 0xC0, 0x8B, 0x36, 0x76, 0x89, 0x93, 0xED, 0xA2, 0x2A, 0xA1, 0x60, 0xA8, 0x8B,
+    0xF2, 0x9A, 0x90, 0x17, 0xAE, 0x60, 0x4C, 0x32, 0x55, 0xF7, 0x11, 0x68, 0x8B, 0xD7, 0xB1, 0x9E,
+    0xE8, 0xA5, 0x7E, 0x61, 0xB7, 0x64, 0xF0, 0x92, 0xFA, 0x78, 0x0D, 0x3F, 0x61, 0xE4, 0x26, 0x5C,
+    0x6B, 0x9B, 0x99, 0xA1, 0xF6, 0x6A, 0x8F, 0xB4, 0xFE, 0x04, 0x36, 0x43, 0x37, 0x47, 0x19, 0x8B,
+    0x1C, 0xDD, 0xC5, 0x63, 0xAD, 0xD7, 0xD6, 0xF2, 0x47, 0xE3, 0xA1, 0xE5, 0x69, 0x02, 0x84, 0x9F,
+    0xA3, 0x8F, 0xE1, 0xB8, 0xB6, 0x0C, 0x9A, 0xB0, 0xC9, 0xD3, 0xE6, 0xEF, 0x02, 0x22, 0x4E, 0x2D,
+    0xCC, 0x1C, 0x7A, 0xA9, 0xCD, 0x00, 0x05, 0x08, 0x64, 0xE4, 0x7D, 0x0D, 0x58, 0x6C, 0xB3, 0x1F,
+    0x12, 0xFE, 0x22, 0xBA, 0x72, 0x41, 0xA4, 0x43, 0x72, 0x37, 0xD9, 0x7F, 0xAC, 0x0B, 0xFF, 0x04,
+    0x6F, 0x47, 0xF7, 0x44, 0x6F, 0x52, 0x0A, 0x83, 0xB4, 0xA1, 0x93, 0x5B, 0x17, 0xAA, 0x59, 0xB6,
+    0x3F, 0x27, 0xBC, 0xFB, 0xB6, 0x6E, 0x6E, 0x49, 0x22, 0x06, 0x7C, 0x04, 0xEE, 0x92, 0xE5, 0xBC,
+    0xC7, 0x8E, 0x47, 0x76, 0x02, 0xB9, 0xB5, 0xA2, 0x53, 0x0A, 0x98, 0x71, 0xE1, 0x3C, 0x23, 0xA9,
+    0xF8, 0x97, 0x3D, 0x44, 0xBD, 0x3E, 0x43, 0x93, 0x2B, 0x96, 0xF3, 0x85, 0x10, 0x88, 0xFC, 0x39,
+    0x71, 0xEF, 0x9B, 0x38, 0xEE, 0xEB, 0xF8, 0x0B, 0xD5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x1D,
+    0xDB, 0xC0, 0x49, 0xB8, 0x30, 0x0D, 0x55, 0x0A, 0x37, 0x34, 0x34, 0xF8, 0x0B, 0x88, 0x8D, 0x28,
+    0x69, 0x28, 0x92, 0x2A, 0x05, 0x0D, 0xFD, 0xB5, 0x34, 0xC8, 0x16, 0x4D, 0xDA, 0x74, 0x88, 0x1F,
+    0x40, 0x28, 0x29, 0xF2, 0x03, 0xC0, 0x5A, 0xA4, 0x48, 0x41, 0x63, 0x89, 0x1F, 0x30, 0xD2, 0x55,
+    0x54, 0x8E, 0x64, 0x24, 0x73, 0x5A, 0x7B, 0x78, 0x6F, 0xEE, 0x88, 0x20, 0x5C, 0x00, 0x89, 0x06,
+    0x56, 0xDA, 0xD1, 0xDC, 0xC6, 0x3B, 0xF3, 0xE6, 0xCD, 0x9B, 0x8D, 0x88, 0xAD, 0x99, 0xEA, 0x81,
+    0x04, 0xAA, 0x5A, 0x49, 0xAA, 0xEA, 0x45, 0xE0, 0xB6, 0x12, 0x6B, 0xB3, 0x25, 0x92, 0x0F, 0xFC,
+    0x42, 0x6B, 0x98, 0x48, 0xE9, 0x26, 0x23, 0x6D, 0x36, 0x15, 0xB0, 0xA5, 0x7E, 0x81, 0x75, 0xAA,
+    0x8D, 0xDD, 0xE9, 0x78, 0xA2, 0xBD, 0xC8, 0x96, 0xF9, 0x32, 0x37, 0x1B, 0xDB, 0xE5, 0x58, 0x8B,
+    0x6D, 0x5C, 0x1B, 0x23, 0x6D, 0x03, 0xED, 0x73, 0x7C, 0xAD, 0xEF, 0x68, 0xC6, 0x98, 0xB6, 0x09,
+    0x10, 0x04, 0x99, 0x52, 0x0B, 0xF8, 0x5A, 0x2C, 0x1B, 0x33, 0x24, 0x96, 0xF3, 0x86, 0x9D, 0x58,
+    0xB4, 0xD5, 0x71, 0xDA, 0xCB, 0x7A, 0xC5, 0xBA, 0x20, 0xE8, 0x22, 0x59, 0xBA, 0x3A, 0xEA, 0xE5,
+    0xA1, 0x00, 0xBE, 0xE4, 0x15, 0xFE, 0x40, 0x84, 0x2C, 0x29, 0xD6, 0x09, 0x89, 0x51, 0x90, 0xA4,
+    0x5E, 0x8A, 0x50, 0xAB, 0x27, 0xE2, 0xDA, 0x72, 0xE9, 0x06, 0x80, 0xF0, 0xD8, 0x63, 0x82, 0x0D,
+    0xAC, 0x0B, 0x09, 0x5B, 0x66, 0xC1, 0x35, 0x87, 0xF0, 0xB7, 0xDF, 0x92, 0x98, 0x42, 0x42, 0xC2,
+    0x47, 0x98, 0xF5, 0x0A, 0x26, 0xC9, 0x5A, 0x90, 0x15, 0x21, 0x68, 0xA0, 0xAE, 0xA1, 0x25, 0x23,
+    0x01, 0x39, 0x90, 0x70, 0x32, 0xE8, 0x9D, 0x5C, 0xBA, 0x40, 0xF3, 0xC2, 0x68, 0x6A, 0x49, 0x3B,
+    0xAA, 0xCB, 0x59, 0x78, 0xA8, 0xFD, 0xB5, 0x5A, 0x12, 0xBB, 0x9D, 0x77, 0xDF, 0x31, 0x5E, 0x58,
+    0x89, 0x07, 0x2C, 0x59, 0x59, 0x50, 0x66, 0xFC, 0xE6, 0xD6, 0xA5, 0x94, 0xB8, 0xE5, 0x9A, 0xF9,
+    0xA0, 0x9C, 0x36, 0x34, 0x8E, 0x42, 0x6D, 0x12, 0xD6, 0x5D, 0xB8, 0x41, 0xCA, 0x91, 0x69, 0xB4,
+    0x2B, 0x69, 0xEF, 0xD3, 0xF4, 0x21, 0x0C, 0x32, 0xED, 0x59, 0xC0, 0xF3, 0x15, 0x79, 0xC9, 0xEB,
+    0xBC, 0x29, 0xEB, 0x68, 0x72, 0x35, 0x32, 0xD4, 0xC8, 0x0E, 0x0C, 0x39, 0xCA, 0x9A, 0xB5, 0x17,
+    0x8A, 0x70, 0x53, 0x11, 0x10, 0x88, 0x1E, 0xE1, 0x52, 0x71, 0x55, 0x12, 0x7C, 0x18, 0x51, 0x28,
+    0x6E, 0xC1, 0x96, 0x0D, 0xD4, 0x44, 0x0B, 0x18, 0xC6, 0x51, 0x7D, 0x45, 0xB2, 0x21, 0xAE, 0xE2,
+    0x69, 0xA6, 0x47, 0xBA, 0x8F, 0xDC, 0x27, 0x6C, 0x38, 0x45, 0x13, 0x1C, 0xAF, 0x11, 0x18, 0xB8,
+    0x33, 0x1A, 0x3D, 0x35, 0x9B, 0xD2, 0x78, 0x3B, 0xEE, 0x7E, 0x54, 0x9F, 0xBF, 0x40, 0xD1, 0xCC,
+    0x8E, 0x53, 0x3B, 0x2E, 0x3B, 0x23, 0xF8, 0x17, 0xC7, 0xB1, 0x11, 0x9A, 0x99, 0x84, 0xD9, 0x64,
+    0x52, 0xB5, 0xE9, 0x58, 0xEE, 0x5A, 0xAF, 0x2C, 0x4D, 0x62, 0x13, 0xB0, 0x9A, 0x83, 0xE7, 0x2B,
+    0x09, 0xD6, 0xE7, 0x73, 0x50, 0xF2, 0xBA, 0xA0, 0x3F, 0xF3, 0x42, 0x22, 0x9C, 0x24, 0xEC, 0x0E,
+    0x05, 0x43, 0xED, 0x4D, 0xF1, 0x4A, 0x61, 0xDD, 0xA1, 0x1E, 0x56, 0x33, 0x76, 0x8C, 0x13, 0x52,
+    0x03, 0x0B, 0x52, 0xE2, 0x67, 0x86, 0x9F, 0xE0, 0x3A, 0xD4, 0x97, 0x05, 0x45, 0x9A, 0xA1, 0x85,
+    0x0E, 0xF5, 0xAA, 0xD6, 0x33, 0x84, 0x85, 0xCC, 0x28, 0xF9, 0x70, 0xAF, 0xB1, 0x29, 0x20, 0x00,
+    0xCA, 0x70, 0x57, 0x82, 0x1D, 0xAA, 0xD0, 0xE2, 0x3C, 0xF0, 0xA6, 0xA8, 0x9A, 0xD6, 0x9F, 0x57,
+    0x19, 0x1A, 0xB4, 0xA8, 0xBD, 0x54, 0x84, 0xFF, 0x1E, 0xDF, 0x12, 0x92, 0xDF, 0x84, 0x37, 0x73,
+    0xAB, 0x86, 0x31, 0x31, 0x17, 0x45, 0xD6, 0x06, 0x6F, 0xC4, 0x55, 0x49, 0x8F, 0x81, 0xA3, 0x16,
+    0xC9, 0x2C, 0xB5, 0x0A, 0x7C, 0xD0, 0x59, 0xA6, 0xC6, 0x97, 0xD6, 0xE1, 0xD1, 0x74, 0xB8, 0xE2,
+    0x97, 0xC4, 0xAC, 0xEF, 0x13, 0x0D, 0x39, 0x26, 0xC9, 0xC8, 0xCC, 0xC4, 0xD3, 0x0B, 0xCE, 0x90,
+    0x09, 0x14, 0xD4, 0xAA, 0xA9, 0x5C, 0xFF, 0x9A, 0x14, 0x3B, 0xBE, 0x39, 0x1F, 0x77, 0xEC, 0x19,
+    0xEC, 0x19, 0x53, 0xD9, 0x35, 0x65, 0x9D, 0x1B, 0xB8, 0xFA, 0x43, 0x52, 0x6E, 0x61, 0xBA, 0xFB,
+    0x95, 0xA6, 0x6C, 0x77, 0xB6, 0x59, 0x38, 0x85, 0x85, 0xF0, 0xFE, 0xFA, 0xF1, 0xF2, 0x15, 0xAB,
+    0xC6, 0x34, 0xF9, 0x6F, 0x7B, 0xB7, 0xFC, 0xBC, 0x63, 0x65, 0xDB, 0x5E, 0x3E, 0xB6, 0x7A, 0xA9,
+    0x2D, 0xEE, 0xC4, 0x64, 0x42, 0xBA, 0x53, 0x82, 0xFA, 0xC8, 0xB0, 0xFA, 0x08, 0xEE, 0xC0, 0x1A,
+    0x93, 0x7D, 0xBE, 0x40, 0x3E, 0xAD, 0xE4, 0xB7, 0xAB, 0xF4, 0x00, 0xF2, 0x01, 0xF5, 0xE4, 0x63,
+    0x7E, 0xC1, 0x3D, 0xA1, 0xEB, 0x7F, 0x76, 0x2B, 0xBA, 0x7C, 0xEB, 0xE8, 0x66, 0x9B, 0xDD, 0x21,
+    0xE3, 0xB7, 0xCF, 0x40, 0x48, 0x39, 0x64, 0xFA, 0xC9, 0xE9, 0x3D, 0x7B, 0xB2, 0x48, 0xA5, 0x8A,
+    0x75, 0x82, 0xCF, 0xD9, 0xC8, 0xC6, 0xE3, 0xF3, 0xD2, 0xFE, 0xF3, 0xD8, 0xBA, 0x13, 0x35, 0xE8,
+    0x88, 0xC7, 0xA3, 0xB8, 0x2D, 0xF1, 0x7B, 0xAD, 0xC2, 0x0E, 0x7F, 0x7A, 0x1A, 0x37, 0x1B, 0xC1,
+    0x63, 0x40, 0x22, 0x5F, 0xE2, 0x0D, 0x4B, 0x91, 0xE7, 0x74, 0x90, 0xF4, 0x6C, 0x82, 0x5A, 0xF2,
+    0x2A, 0xD0, 0xA4, 0x95, 0xF2, 0x04, 0x54, 0x75, 0x8A, 0x09, 0xCD, 0xEB, 0x48, 0x41, 0x3C, 0x6A,
+    0x2B, 0x5C, 0x0F, 0x6A, 0xC7, 0x74, 0xFD, 0x86, 0xF2, 0xF5, 0x22, 0xA6, 0x49, 0xE6, 0xBD, 0xFC,
+    0xC7, 0xEB, 0x2B, 0xD5, 0x55, 0xBB, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0xDB, 0x52, 0x2C, 0xE1, 0xC2,
+    0x1F, 0x90, 0xC2, 0x3D, 0x8D, 0xFF, 0x80, 0x35, 0x50, 0x52, 0x40, 0x11, 0xD1, 0xA6, 0xA7, 0xE1,
+    0x0F, 0xB0, 0xC5, 0x0F, 0x40, 0x93, 0x9E, 0x82, 0x2A, 0x14, 0xF9, 0x04, 0x5B, 0x4A, 0x91, 0xD6,
+    0x40, 0x41, 0x7B, 0x25, 0x24, 0x0A, 0x28, 0x70, 0xA4, 0x2D, 0x8C, 0xB2, 0x7B, 0x87, 0x73, 0xC6,
+    0xF7, 0x26, 0x28, 0x0F, 0x25, 0x25, 0x59, 0xC9, 0xAB, 0xD9, 0x9D, 0xD5, 0xCE, 0xCC, 0x99, 0x73,
+    0xD6, 0x22, 0x22, 0x8D, 0xEC, 0x1C, 0x69, 0x10, 0x51, 0xD5, 0x95, 0x54, 0x98, 0x25, 0x55, 0x3D,
+    0xFC, 0x20, 0x77, 0x1B, 0x6D, 0x90, 0x4C, 0xBF, 0xEA, 0x20, 0x2E, 0xBA, 0x4B, 0xE6, 0x31, 0xCD,
+    0x70, 0xD5, 0xEC, 0x68, 0xCE, 0x88, 0x42, 0xB3, 0xBE, 0xDE, 0x9C, 0x6B, 0x9E, 0x7D, 0xAB, 0xA3,
+    0xB4, 0x73, 0xAD, 0x3F, 0x7B, 0x7D, 0x8C, 0xC4, 0xD4, 0x97, 0x9C, 0x99, 0xA9, 0x4E, 0x39, 0xA6,
+    0x28, 0x35, 0xE6, 0x4E, 0x5A, 0xC5, 0xC1, 0x65, 0x24, 0x2F, 0x3F, 0x66, 0xD8, 0x43, 0x09, 0x3A,
+    0xE2, 0x9B, 0x1F, 0x1E, 0xEC, 0x5D, 0x9F, 0x78, 0xE1, 0xA5, 0x3C, 0x8D, 0x92, 0x87, 0xB6, 0x49,
+    0xB4, 0x5A, 0x49, 0x7B, 0x32, 0x4B, 0x35, 0xAD, 0xB1, 0xE1, 0xBA, 0x44, 0xCB, 0x49, 0xFA, 0xE3,
+    0x20, 0xF5, 0xA4, 0x52, 0x06, 0x37, 0x66, 0xFA, 0x3C, 0xA6, 0xFA, 0x85, 0x29, 0x20, 0x56, 0x64,
+    0x1A, 0x4F, 0x18, 0xC1, 0x21, 0x42, 0xD2, 0x23, 0xF6, 0xAB, 0x17, 0x0F, 0xDE, 0x4B, 0x3E, 0x27,
+    0x6B, 0x11, 0xC7, 0x64, 0x10, 0x7F, 0x16, 0x29, 0x15, 0x6B, 0xD9, 0x5D, 0xDF, 0x43, 0x1C, 0x31,
+    0xB2, 0x20, 0xBD, 0xE8, 0x41, 0x3F, 0xC0, 0xB9, 0x02, 0xA8, 0x13, 0xFC, 0x2B, 0x49, 0x0E, 0x9B,
+    0x2B, 0xC9, 0xA7, 0x11, 0x87, 0x0D, 0xC7, 0x71, 0xC1, 0xF1, 0xF4, 0x1C, 0x47, 0x00, 0xBB, 0xC1,
+    0xB1, 0x08, 0x6E, 0xC8, 0xB4, 0xF4, 0x82, 0xDA, 0x9A, 0xDE, 0xF7, 0x08, 0x4B, 0xB6, 0x3D, 0x25,
+    0x8E, 0xFD, 0x92, 0xD3, 0x5A, 0x5E, 0x7B, 0xDE, 0x57, 0x33, 0x44, 0x19, 0xD9, 0xCE, 0xB3, 0x89,
+    0xEB, 0x9A, 0x41, 0x94, 0x66, 0x69, 0x60, 0xB6, 0x9D, 0xDC, 0x57, 0x7E, 0xA2, 0xB4, 0x2C, 0xB2,
+    0x9A, 0x41, 0xE4, 0x0F, 0xAA, 0x7D, 0xF4, 0x86, 0x3C, 0x69, 0x24, 0xE1, 0x46, 0x75, 0x43, 0x5D,
+    0xF5, 0x28, 0xEE, 0xC4, 0x03, 0x57, 0x23, 0x6C, 0xB7, 0x10, 0xF6, 0xF8, 0x9C, 0xB0, 0x43, 0xBA,
+    0x25, 0xAC, 0x9B, 0xB4, 0x29, 0xA3, 0xF3, 0x85, 0x3E, 0x43, 0xE4, 0xCF, 0xCC, 0x09, 0x7C, 0x8C,
+    0x05, 0x8C, 0x86, 0x02, 0xDF, 0xD1, 0x8B, 0xEE, 0x39, 0xC8, 0x1D, 0x57, 0x78, 0xC9, 0xA3, 0x14,
+    0x11, 0x19, 0x35, 0x19, 0xBC, 0x3A, 0x26, 0xAC, 0xCA, 0xDF, 0x8A, 0x6C, 0x6E, 0x48, 0x8A, 0x81,
+    0x06, 0x81, 0x5C, 0x5E, 0x84, 0x65, 0x31, 0x5C, 0xBB, 0x98, 0x97, 0x05, 0x31, 0x15, 0x03, 0xF5,
+    0xE6, 0x45, 0x47, 0xA4, 0x60, 0xD5, 0x28, 0x9D, 0x8B, 0xF5, 0x27, 0xF5, 0xF6, 0x4C, 0x31, 0x57,
+    0x02, 0x2D, 0x0B, 0xE8, 0x04, 0x79, 0x11, 0x1E, 0x95, 0x97, 0x13, 0xFC, 0x0B, 0xAD, 0x07, 0xEC,
+    0x43, 0xC8, 0x88, 0x2A, 0x55, 0x80, 0x93, 0xB7, 0x17, 0xDB, 0xF9, 0xC6, 0x61, 0xB4, 0xC6, 0xC5,
+    0x20, 0x36, 0x5A, 0x03, 0x50, 0x06, 0x48, 0x1C, 0x98, 0x4B, 0x42, 0xD4, 0x01, 0x60, 0x47, 0x07,
+    0x29, 0x3E, 0xF0, 0x60, 0x0D, 0x7E, 0x92, 0xE6, 0x70, 0xA0, 0x02, 0x38, 0x40, 0xF5, 0x11, 0x21,
+    0x41, 0x76, 0x91, 0xDE, 0x12, 0xAA, 0x2C, 0xED, 0xCC, 0x32, 0xE5, 0x96, 0x67, 0xEF, 0xED, 0x91,
+    0x30, 0xE2, 0xFF, 0x4F, 0x64, 0x45, 0x59, 0x60, 0xEA, 0x6C, 0x44, 0xD9, 0xB6, 0x5B, 0xD8, 0x63,
+    0x8C, 0xDE, 0xD8, 0xBC, 0x27, 0x3D, 0x5A, 0x60, 0x92, 0xFF, 0x97, 0x9A, 0xE5, 0x42, 0xCD, 0xAD,
+    0xE4, 0x2F, 0xA8, 0xE9, 0xB5, 0xAB, 0x62, 0x1D, 0xF7, 0x8D, 0x9A, 0x7C, 0x9C, 0x3D, 0x02, 0x46,
+    0x82, 0xD1, 0xED, 0xAE, 0x89, 0x01, 0xAE, 0x03, 0xD8, 0xC4, 0x15, 0xE1, 0x7F, 0x10, 0xA7, 0x95,
+    0x61, 0x22, 0x49, 0xBC, 0xAA, 0xEB, 0x2D, 0x89, 0x37, 0xC2, 0x72, 0x9B, 0x23, 0x6E, 0xA3, 0x34,
+    0xF7, 0x2B, 0x6E, 0xFC, 0xAD, 0x6D, 0xB8, 0x2E, 0x8D, 0x77, 0x78, 0x2E, 0x9C, 0x15, 0x9C, 0xEA,
+    0xBB, 0x85, 0x16, 0xFA, 0xDD, 0xAA, 0x86, 0x1C, 0xFA, 0xE5, 0x61, 0x0A, 0x95, 0xBD, 0x3F, 0xA5,
+    0x66, 0xE6, 0x00, 0x51, 0xED, 0x55, 0x82, 0x64, 0xC0, 0x4F, 0x16, 0x3A, 0x15, 0xDA, 0xE1, 0x8D,
+    0x72, 0x21, 0x21, 0xAA, 0x83, 0x99, 0x99, 0xCE, 0x39, 0x64, 0x49, 0xD8, 0x41, 0xE6, 0x94, 0xB5,
+    0x8F, 0x7C, 0x4D, 0xE7, 0x56, 0xD9, 0xA5, 0x4A, 0x21, 0xD1, 0x7D, 0x70, 0x4D, 0x7F, 0xAB, 0x9E,
+    0xA9, 0xFD, 0x89, 0x8F, 0x14, 0xF7, 0x03, 0x9E, 0x6F, 0xFC, 0x29, 0xA3, 0x3B, 0x93, 0x71, 0x05,
+    0xD4, 0xAE, 0xF9, 0xAB, 0x76, 0x8A, 0x3B, 0x75, 0xF9, 0xBF, 0xB0, 0x65, 0x20, 0x7D, 0x53, 0xB1,
+    0xF0, 0x96, 0xDA, 0x99, 0xE8, 0x58, 0x09, 0x0F, 0xDE, 0x36, 0xFE, 0x02, 0xCD, 0x55, 0xBB, 0x6E,
+    0xD5, 0x40, 0x10, 0x1D, 0x5F, 0x2B, 0xB1, 0x14, 0x17, 0x4B, 0x93, 0x26, 0x14, 0xEE, 0x69, 0xF6,
+    0x0F, 0x58, 0x4B, 0x08, 0x51, 0xA4, 0x49, 0x91, 0xCB, 0x47, 0xE4, 0x1F, 0x22, 0xBB, 0x4B, 0x41,
+    0x93, 0x8E, 0x36, 0x05, 0x45, 0x74, 0x29, 0xF8, 0x81, 0x08, 0x1B, 0xA5, 0xA0, 0x35, 0x05, 0x35,
+    0x86, 0x2F, 0x58, 0x24, 0x47, 0x32, 0x68, 0xD7, 0xC3, 0x9C, 0xF1, 0xBD, 0x04, 0x85, 0x47, 0x28,
+    0x40, 0xCA, 0x4A, 0x1E, 0xCD, 0xEE, 0x7A, 0x77, 0xCE, 0x9C, 0x79, 0x2C, 0xD1, 0x3C, 0xD2, 0x01,
+    0x32, 0x0F, 0x90, 0x05, 0x43, 0x56, 0xDC, 0x12, 0x25, 0x5C, 0x79, 0xA2, 0x2C, 0x60, 0xA3, 0xE8,
+    0x88, 0xE9, 0xCF, 0xA3, 0x92, 0x23, 0x29, 0xBB, 0x4E, 0xE4, 0xE4, 0x7A, 0x39, 0x18, 0xAD, 0x4F,
+    0xCA, 0x3C, 0x14, 0x43, 0xEE, 0xCD, 0x68, 0xC6, 0x62, 0x2C, 0x06, 0x13, 0x5C, 0xB0, 0x3E, 0x0F,
+    0xD5, 0xE4, 0x7C, 0x36, 0x31, 0x37, 0x7D, 0xCA, 0x32, 0x3A, 0x95, 0xED, 0x42, 0x65, 0x02, 0x59,
+    0x93, 0x6C, 0x72, 0x49, 0x1C, 0x9D, 0xD8, 0x6D, 0x02, 0x60, 0x39, 0x6F, 0x26, 0xA2, 0x07, 0xA7,
+    0xDB, 0xE7, 0x62, 0x2D, 0xEB, 0x61, 0xD3, 0xB5, 0x80, 0x0F, 0xB0, 0xE4, 0x58, 0xED, 0x43, 0xBA,
+    0xBE, 0x69, 0x29, 0x8D, 0x40, 0xB4, 0x55, 0xD2, 0x2E, 0xDD, 0x3E, 0x52, 0xC6, 0xB7, 0x2F, 0xD7,
+    0x17, 0xC1, 0x44, 0x22, 0xEE, 0x6C, 0xA0, 0x8C, 0xC9, 0x0D, 0xE4, 0x46, 0x6A, 0x7C, 0x02, 0x58,
+    0x9D, 0x98, 0x17, 0x5B, 0x42, 0x4A, 0xC6, 0x8F, 0x04, 0xA1, 0xE1, 0x02, 0xCC, 0x44, 0xEE, 0x61,
+    0x5D, 0xC0, 0x52, 0xC3, 0xE0, 0x50, 0xFC, 0x21, 0x12, 0x5F, 0xF4, 0x5E, 0x50, 0x9B, 0x2B, 0xC0,
+    0x62, 0x52, 0x96, 0x46, 0xC2, 0x66, 0xAF, 0xCB, 0xB5, 0x48, 0xAB, 0xBC, 0xEA, 0xC1, 0x94, 0x85,
+    0x6F, 0xB9, 0xB6, 0xFD, 0x8E, 0x2B, 0x6E, 0xE2, 0x52, 0x89, 0xC8, 0xF0, 0x53, 0xF5, 0x21, 0xC8,
+    0x8A, 0xAC, 0x35, 0x65, 0x1A, 0x6E, 0xF5, 0xAB, 0x18, 0x84, 0x07, 0xE7, 0xA9, 0xF0, 0x55, 0x4F,
+    0x4D, 0xCD, 0xAD, 0xB0, 0xC2, 0x6D, 0xE1, 0x17, 0x5C, 0x36, 0x75, 0xCA, 0x32, 0xCB, 0xA7, 0xC2,
+    0x93, 0x09, 0x4D, 0x2D, 0x40, 0x22, 0xFC, 0xF0, 0x70, 0x43, 0x80, 0x61, 0xB6, 0xC0, 0x2C, 0xC5,
+    0x2C, 0x07, 0x12, 0xEB, 0x91, 0x14, 0x32, 0xB3, 0xA0, 0x48, 0xF6, 0x52, 0x78, 0x6D, 0x78, 0xC4,
+    0x39, 0x1C, 0xE9, 0x37, 0x76, 0xAD, 0xC7, 0xBF, 0xDC, 0x8A, 0x2B, 0x62, 0x45, 0x3C, 0x34, 0xD1,
+    0x00, 0xFC, 0x50, 0x0D, 0x72, 0xE9, 0x27, 0xF9, 0x71, 0x6B, 0xF9, 0x78, 0x49, 0x7F, 0x3B, 0xEE,
+    0x6A, 0x78, 0x28, 0x9F, 0xB3, 0xB0, 0xC4, 0x21, 0x8D, 0x86, 0xD1, 0x85, 0x0A, 0x0B, 0x37, 0xC3,
+    0x53, 0x20, 0xAF, 0xBD, 0xD3, 0x1C, 0x6F, 0x20, 0x09, 0x22, 0x68, 0xD2, 0xFB, 0x64, 0xB5, 0x52,
+    0x88, 0x46, 0x11, 0xB1, 0x52, 0xAE, 0x46, 0x1B, 0x98, 0xCB, 0x11, 0x0C, 0x51, 0x3B, 0xA8, 0x93,
+    0xAA, 0x1E, 0x2A, 0xFF, 0xA0, 0xAA, 0x7F, 0x23, 0xB2, 0x84, 0xDF, 0x2F, 0x4B, 0x35, 0xF3, 0x06,
+    0x82, 0x33, 0x88, 0xA8, 0xD6, 0x43, 0x05, 0xF9, 0x59, 0x97, 0xBB, 0x19, 0xD5, 0x02, 0x0E, 0x3B,
+    0xB8, 0x02, 0xE7, 0x70, 0xB7, 0x6D, 0x7F, 0xC6, 0x3E, 0x0F, 0xB9, 0x74, 0x44, 0xA5, 0xB6, 0xA2,
+    0x84, 0x64, 0xF5, 0x72, 0x13, 0x73, 0x89, 0x81, 0x00, 0x5F, 0x17, 0x22, 0xE0, 0x20, 0x5B, 0x51,
+    0xB1, 0x99, 0x2C, 0x24, 0x7C, 0xA5, 0x70, 0x62, 0xBA, 0x71, 0xFF, 0x09, 0x90, 0xC8, 0x0F, 0x30,
+    0x48, 0xCD, 0x5C, 0xC1, 0x20, 0x0C, 0x91, 0x9D, 0x2F, 0x93, 0x43, 0xE0, 0x31, 0x59, 0x96, 0x77,
+    0x9B, 0xC1, 0x05, 0x8E, 0x3B, 0x3F, 0x27, 0x28, 0xB2, 0x51, 0xCE, 0x96, 0x73, 0x12, 0xDD, 0xC4,
+    0xFE, 0x1F, 0x18, 0x3C, 0xA2, 0x44, 0x3A, 0x21, 0x97, 0x68, 0xB9, 0x7C, 0x12, 0x37, 0xA9, 0xAD,
+    0x95, 0x8B, 0x1A, 0xA1, 0x75, 0x40, 0x29, 0x39, 0xFB, 0x05, 0x14, 0x6D, 0xB3, 0xAC, 0x8D, 0x37,
+    0xE4, 0xCA, 0xA0, 0x51, 0x62, 0xAD, 0x12, 0xBB, 0xB7, 0x7A, 0xB5, 0xE6, 0x51, 0x29, 0x1D, 0xAF,
+    0x79, 0x0C, 0xD7, 0x3C, 0xCE, 0x94, 0xF6, 0x37, 0x79, 0x54, 0x75, 0x50, 0xB5, 0xC6, 0x53, 0x12,
+    0x97, 0x87, 0xB3, 0x99, 0x39, 0x7E, 0xCA, 0xE0, 0x3B, 0xB5, 0xFE, 0x56, 0xA5, 0x2E, 0xC7, 0xED,
+    0x33, 0xDA, 0xAB, 0x5D, 0x67, 0x3C, 0xF1, 0xB3, 0x80, 0xCE, 0xB2, 0x2E, 0x35, 0xD0, 0x9B, 0xC0,
+    0x8D, 0xED, 0xFA, 0x77, 0xED, 0xE1, 0x5F, 0xB2, 0x9A, 0xF0, 0xA9, 0xE5, 0x8E, 0x79, 0x5F, 0x5E,
+    0x9E, 0x2F, 0xF7, 0xB4, 0x61, 0x0A, 0x24, 0x79, 0x67, 0x18, 0x45, 0xB1, 0x56, 0xCB, 0x2C, 0x52,
+    0x31, 0x52, 0xD5, 0x4B, 0x37, 0xCC, 0x26, 0x55, 0xD1, 0x83, 0x72, 0x86, 0x2A, 0x6F, 0x9F, 0x09,
+    0x9A, 0xD2, 0x82, 0xC1, 0xCE, 0x85, 0x64, 0xDA, 0xD7, 0xE9, 0x60, 0xDB, 0x29, 0x1F, 0xE6, 0x97,
+    0x4B, 0xEE, 0xD1, 0xAD, 0x86, 0xD1, 0x89, 0x5A, 0x33, 0x5A, 0xEF, 0xBA, 0x34, 0xC8, 0x53, 0x75,
+    0x98, 0x77, 0x17, 0x76, 0xB8, 0x70, 0xF1, 0xE2, 0xB8, 0x0A, 0xC7, 0x76, 0x78, 0x98, 0x21, 0x8E,
+    0x07, 0x3B, 0xCC, 0x83, 0x44, 0x26, 0xC0, 0xC3, 0x66, 0x5A, 0xBD, 0x20, 0xDA, 0x7D, 0x7A, 0x3E,
+    0xBF, 0x97, 0x10, 0x03, 0xC4, 0xD7, 0x99, 0x8D, 0xA3, 0x83, 0x9D, 0xE7, 0xE3, 0x22, 0x0A, 0xCD,
+    0x97, 0xB2, 0x61, 0x24, 0xDB, 0xEF, 0x4F, 0xD2, 0x90, 0x9B, 0x4B, 0x36, 0xB1, 0xBA, 0xE2, 0x8F,
+    0xD7, 0x89, 0xF9, 0x0D, 0xCD, 0x55, 0x3D, 0x6C, 0xDD, 0x54, 0x14, 0x3E, 0x7E, 0x6E, 0xE4, 0xAA,
+    0x56, 0x75, 0x59, 0x22, 0xA4, 0x30, 0x78, 0x45, 0xA8, 0xE2, 0x32, 0x30, 0xE7, 0x5A, 0x61, 0x60,
+    0xE8, 0x10, 0x0F, 0xF1, 0xD2, 0x25, 0x0C, 0x0C, 0x88, 0x85, 0x85, 0x91, 0xD4, 0x16, 0x19, 0x18,
+    0x58, 0x32, 0xB4, 0x7B, 0x06, 0x90, 0xDA, 0x97, 0xA1, 0xCC, 0xE8, 0x05, 0xBB, 0x89, 0xD4, 0x27,
+    0x91, 0xC5, 0x82, 0xA1, 0x23, 0x56, 0x10, 0x53, 0x87, 0x38, 0x91, 0x83, 0x5C, 0xB8, 0xF6, 0xC7,
+    0x39, 0xB6, 0x93, 0x26, 0x21, 0x2D, 0x2B, 0xF7, 0x3D, 0x5F, 0xDF, 0x9F, 0x73, 0xCF, 0x3D, 0xE7,
+    0x3B, 0xDF, 0x39, 0xD6, 0x45, 0xB6, 0xD2, 0xF9, 0x8D, 0x29, 0xB1, 0x09, 0x65, 0x93, 0x63, 0x3C,
+    0x9B, 0x2E, 0x3D, 0x5A, 0x76, 0xAD, 0x53, 0x7C, 0x15, 0xAC, 0x14, 0x44, 0x4E, 0x18, 0x54, 0xC6,
+    0x6E, 0xCC, 0x36, 0x76, 0x8D, 0xD5, 0x8D, 0x5F, 0x92, 0x6F, 0x69, 0x02, 0x52, 0x96, 0x5C, 0x50,
+    0x60, 0xC9, 0x03, 0x69, 0x4B, 0x3E, 0xC8, 0x34, 0xA4, 0x3A, 0x1A, 0x9B, 0x49, 0x27, 0xAD, 0xAA,
+    0x83, 0xDA, 0xED, 0xB2, 0x82, 0x80, 0x90, 0x4C, 0x4B, 0xA4, 0x6A, 0x22, 0xAF, 0x12, 0x95, 0x64,
+    0x0A, 0x99, 0xB9, 0x2C, 0x8F, 0x94, 0x4C, 0x35, 0xA8, 0x0B, 0x09, 0xC5, 0x25, 0x35, 0x59, 0xEB,
+    0xA1, 0x30, 0xAD, 0x8B, 0x5C, 0xB7, 0x84, 0x52, 0x81, 0xB2, 0xDA, 0x43, 0x6A, 0xAC, 0x87, 0x32,
+    0x91, 0x65, 0x19, 0xA5, 0x59, 0xA5, 0xE0, 0xA0, 0xD4, 0xB2, 0x90, 0x74, 0x2E, 0x4A, 0xD3, 0xF1,
+    0x94, 0x95, 0xA0, 0xF2, 0x11, 0x26, 0xCD, 0x70, 0x9C, 0x54, 0x61, 0xD6, 0xDB, 0xE4, 0x94, 0x15,
+    0x86, 0x3C, 0x23, 0xC7, 0x7A, 0x55, 0x20, 0xF3, 0xE7, 0x55, 0x90, 0x13, 0x25, 0x8F, 0x23, 0x0F,
+    0xB0, 0x09, 0xB0, 0x37, 0xDD, 0xB1, 0xEC, 0x40, 0x4E, 0xEE, 0xAB, 0x97, 0xB4, 0x20, 0x37, 0xC4,
+    0x67, 0xB2, 0xFD, 0xD6, 0x2F, 0x6F, 0x13, 0x4D, 0x0E, 0x9B, 0x76, 0x23, 0xF8, 0xBD, 0x59, 0xE6,
+    0xE1, 0xB6, 0x5B, 0xB9, 0x55, 0x02, 0xF9, 0x2D, 0xC6, 0xC3, 0xFB, 0xED, 0x53, 0xAF, 0xF2, 0x2A,
+    0x87, 0xEE, 0xD0, 0x0F, 0xC6, 0xAE, 0x47, 0x77, 0xE8, 0x13, 0xD1, 0x11, 0x2D, 0x01, 0xB5, 0x01,
+    0x1A, 0xBE, 0xC7, 0x66, 0xDD, 0xF4, 0xC1, 0x42, 0x14, 0x30, 0x4A, 0xBA, 0x31, 0x8D, 0xB1, 0x8C,
+    0xEF, 0x75, 0xB1, 0xB8, 0x1A, 0x00, 0x85, 0x1C, 0x8D, 0x42, 0x88, 0x8B, 0x6E, 0xCB, 0x82, 0x0A,
+    0x03, 0x32, 0x0C, 0x66, 0xD2, 0xBC, 0xC5, 0xBA, 0x92, 0x9A, 0x91, 0xFF, 0x8C, 0x32, 0xCA, 0xF2,
+    0x24, 0x37, 0xB9, 0x2A, 0x5D, 0x54, 0x68, 0x59, 0xEC, 0x8B, 0xDC, 0xEC, 0x5B, 0x33, 0xB7, 0xC9,
+    0xDC, 0x66, 0x07, 0x36, 0xFB, 0xF9, 0xD1, 0x7B, 0xD3, 0xA9, 0x02, 0xF6, 0xC1, 0xFB, 0xB0, 0x26,
+    0x87, 0xAA, 0x58, 0x80, 0xBB, 0x82, 0x92, 0x02, 0xA9, 0xAE, 0x5D, 0xAC, 0xB6, 0xA4, 0xFA, 0x20,
+    0x72, 0x7C, 0x08, 0x1C, 0x45, 0x09, 0x1C, 0xE9, 0x7C, 0x0C, 0x93, 0x23, 0x08, 0xB1, 0x38, 0x0B,
+    0xF1, 0x16, 0x78, 0xC6, 0xBA, 0xC8, 0xBC, 0x44, 0xAE, 0xAC, 0x0B, 0x96, 0xF5, 0x06, 0x08, 0xBD,
+    0x3A, 0xF8, 0x18, 0xDE, 0x21, 0x8E, 0x9B, 0x16, 0xBB, 0x26, 0xC0, 0xEA, 0x1E, 0xF6, 0xAB, 0x51,
+    0xCB, 0x42, 0xC8, 0xB0, 0xAC, 0x00, 0xE0, 0x8B, 0x46, 0xC0, 0x29, 0xBA, 0xC5, 0x7A, 0xF4, 0x19,
+    0x62, 0x8C, 0xD6, 0xEB, 0x15, 0x2C, 0xC6, 0xF1, 0x1A, 0x63, 0xDA, 0x9E, 0x3D, 0xF4, 0xBE, 0x7F,
+    0xD2, 0xA9, 0xA3, 0xBF, 0xFF, 0x6C, 0x3E, 0x25, 0x5A, 0x63, 0xEB, 0x4A, 0x23, 0xA0, 0x31, 0x3B,
+    0x2E, 0xB5, 0x9E, 0xAA, 0xE8, 0xC6, 0x7F, 0x78, 0xF6, 0x3F, 0x5B, 0x59, 0x8C, 0xD7, 0xFC, 0x17,
+    0x05, 0x30, 0x3F, 0xC2, 0xBA, 0xBE, 0x3F, 0x9B, 0xFD, 0x78, 0x78, 0xF2, 0xE2, 0xDB, 0x83, 0x90,
+    0x1D, 0x55, 0xCE, 0x11, 0xE9, 0xD0, 0x2F, 0x3C, 0xEB, 0x1D, 0xEC, 0x6D, 0x7D, 0xE7, 0x17, 0x33,
+    0x5D, 0xCF, 0x4C, 0x3B, 0xDB, 0x48, 0xEC, 0x86, 0xAE, 0x97, 0xBD, 0x82, 0xFC, 0x34, 0xF3, 0x9B,
+    0x64, 0xDE, 0xFC, 0xB4, 0x30, 0x38, 0xA3, 0x43, 0x72, 0x99, 0xFB, 0x99, 0x10, 0x91, 0x26, 0x03,
+    0xB5, 0xFE, 0xA3, 0x5D, 0x4B, 0x87, 0xD7, 0x44, 0x6B, 0xE1, 0xDE, 0x13, 0x81, 0xAA, 0x31, 0x42,
+    0x2C, 0x06, 0x20, 0x3E, 0xD7, 0xE2, 0x44, 0xEF, 0x5C, 0x24, 0xDD, 0x5F, 0xD3, 0x07, 0x4B, 0xE1,
+    0xE7, 0xE3, 0x29, 0xB8, 0xA3, 0x8A, 0xB9, 0x55, 0xC7, 0xF0, 0x6C, 0xF2, 0x54, 0x20, 0x71, 0x80,
+    0x6F, 0x80, 0x40, 0xB2, 0xA1, 0x62, 0xFA, 0x70, 0xB6, 0x73, 0xCE, 0x2F, 0x6D, 0x0F, 0xEA, 0xDE,
+    0xE5, 0x10, 0x17, 0x94, 0x05, 0x96, 0xAD, 0xA8, 0x13, 0xFC, 0xF6, 0x0B, 0xC3, 0xB8, 0x7A, 0xC8,
+    0xA6, 0x6C, 0xA2, 0xCC, 0x02, 0xE6, 0xC5, 0x8C, 0x05, 0x4A, 0x4E, 0x97, 0x70, 0x18, 0xB2, 0xCF,
+    0x2A, 0x25, 0xDA, 0x1D, 0x87, 0xEC, 0xF4, 0xFD, 0x5E, 0x03, 0xDD, 0x7C, 0xE5, 0xE8, 0x5A, 0xDF,
+    0xAB, 0xB2, 0x37, 0x17, 0x83, 0xEF, 0x95, 0xF4, 0x93, 0x61, 0x62, 0xEA, 0x37, 0xE2, 0xB4, 0xF4,
+    0x98, 0x26, 0x53, 0xE6, 0x4F, 0x4B, 0xBA, 0x13, 0xFA, 0x38, 0x38, 0x64, 0xA3, 0x6A, 0xDD, 0x19,
+    0x99, 0xE2, 0x39, 0x0A, 0x2D, 0xA9, 0xDD, 0x51, 0x22, 0x14, 0x3B, 0x61, 0xAB, 0x53, 0xA9, 0x50,
+    0x72, 0xD4, 0x6D, 0x7A, 0x0D, 0x49, 0x1F, 0x0B, 0xDF, 0x9E, 0x23, 0x5F, 0x3A, 0x91, 0xE2, 0x4A,
+    0xB1, 0x07, 0x6C, 0x5A, 0xF3, 0x6B, 0xCB, 0x60, 0x05, 0x68, 0x74, 0x91, 0x88, 0x3D, 0x59, 0x7A,
+    0x55, 0xE6, 0x23, 0xCE, 0xA7, 0x96, 0xF3, 0xE9, 0x5C, 0xC6, 0x19, 0x65, 0x86, 0xE6, 0x86, 0x29,
+    0xE1, 0xEE, 0xB6, 0x33, 0xE3, 0x6B, 0xD2, 0x0F, 0xC6, 0xC5, 0x1B, 0xDE, 0x66, 0xF3, 0xE1, 0xED,
+    0x4B, 0x7E, 0xCC, 0x0B, 0xE9, 0x1B, 0xC9, 0x2D, 0xA7, 0x0B, 0xD8, 0x32, 0x8F, 0x0B, 0x19, 0x76,
+    0xD0, 0x71, 0x79, 0xE5, 0xF0, 0x11, 0xDD, 0x42, 0xB7, 0xC5, 0x9B, 0xF7, 0xBE, 0x67, 0x6C, 0x65,
+    0x69, 0x8B, 0x74, 0xCF, 0x62, 0xF3, 0x92, 0x6F, 0xAC, 0xB5, 0x1C, 0xCF, 0xD6, 0xC5, 0x15, 0xEF,
+    0xA4, 0xBF, 0xFF, 0xCB, 0x0B, 0xCA, 0x6F, 0x8C, 0xEF, 0x65, 0x72, 0x62, 0x69, 0xD8, 0x0A, 0x86,
+    0x1C, 0x60, 0x38, 0xFA, 0x76, 0x3C, 0xBC, 0xDA, 0x41, 0x8C, 0xB3, 0xBD, 0x37, 0xBD, 0xB8, 0x7C,
+    0xDA, 0x48, 0x8C, 0x90, 0x53, 0x5F, 0xAD, 0x87, 0x42, 0xAD, 0xED, 0x1B, 0x63, 0xC3, 0x2A, 0xBF,
+    0xEE, 0xA3, 0xC1, 0xDD, 0x84, 0x9F, 0x92, 0xAB, 0xBD, 0x7C, 0x3A, 0x88, 0xAE, 0x0C, 0xF8, 0x66,
+    0x26, 0x69, 0x71, 0x61, 0xF0, 0xF0, 0x5F, 0x32, 0x71, 0x1C, 0xF1, 0x16, 0xBC, 0x33, 0xB3, 0x99,
+    0xA6, 0x7D, 0xCD, 0xC6, 0x5C, 0x2C, 0x9F, 0x48, 0xAD, 0x51, 0x96, 0xBF, 0x25, 0xA6, 0x32, 0x95,
+    0x83, 0xA7, 0xC8, 0x3D, 0xDC, 0x45, 0xA8, 0x5B, 0xAE, 0xFF, 0x71, 0x14, 0x47, 0xD7, 0xD8, 0xE7,
+    0x4C, 0x77, 0x50, 0x0B, 0x12, 0x79, 0x36, 0x1A, 0xD8, 0xF8, 0xDD, 0xC3, 0x68, 0xE0, 0x5F, 0x96,
+    0x8F, 0x14, 0xEC, 0x99, 0xA1, 0x4F, 0xE3, 0x6D, 0x12, 0x49, 0x29, 0x22, 0xD4, 0xD7, 0x29, 0x23,
+    0x85, 0x4E, 0x8A, 0x62, 0x6F, 0xA3, 0xB2, 0xA3, 0xA1, 0x84, 0x3F, 0xE2, 0x58, 0xA4, 0x24, 0x49,
+    0x50, 0x89, 0xC9, 0x85, 0x60, 0xBB, 0xC9, 0x4F, 0x27, 0x97, 0x59, 0xFA, 0xDF, 0xB4, 0x7F, 0x00,
+    0x8D, 0x55, 0xBD, 0x8E, 0xE4, 0x44, 0x10, 0x2E, 0x8F, 0x05, 0x96, 0x70, 0xD0, 0x19, 0xC1, 0x6D,
+    0xE0, 0x7C, 0x13, 0xBF, 0x01, 0x6D, 0xC1, 0x03, 0xDC, 0x05, 0xAC, 0x08, 0x78, 0x03, 0x92, 0x7D,
+    0x04, 0x1B, 0x08, 0x08, 0x48, 0x56, 0xE2, 0x05, 0x48, 0x90, 0x60, 0x93, 0x7B, 0x03, 0xDA, 0xC0,
+    0x03, 0x60, 0x69, 0x03, 0xC2, 0x1D, 0xB4, 0x90, 0x10, 0x39, 0x30, 0xC2, 0x77, 0xD7, 0xDD, 0xC5,
+    0xF7, 0x95, 0x3D, 0x1C, 0xB3, 0x42, 0xE2, 0xEC, 0x99, 0x9E, 0xEE, 0xAE, 0xEE, 0xFA, 0xF9, 0xEA,
+    0xAB, 0x1A, 0x11, 0x91, 0xE2, 0x99, 0x28, 0x9E, 0x24, 0x81, 0x3F, 0x63, 0xCF, 0x71, 0xB9, 0xBC,
+    0xD5, 0x3F, 0x6E, 0xBF, 0x11, 0x69, 0x67, 0x9C, 0x90, 0x3A, 0x72, 0x3C, 0x28, 0x47, 0x09, 0x23,
+    0xC7, 0x73, 0xC1, 0xF3, 0x17, 0x14, 0xA8, 0x1E, 0x21, 0xC0, 0x75, 0x08, 0xF4, 0x15, 0x16, 0x07,
+    0x1D, 0x5D, 0x82, 0x60, 0x12, 0x1D, 0x78, 0x03, 0x1F, 0x17, 0xA5, 0x8A, 0x52, 0xE2, 0x08, 0x3F,
+    0x23, 0xB5, 0xF9, 0xF9, 0xAD, 0x70, 0x84, 0xA0, 0xD4, 0x85, 0x02, 0x8D, 0x14, 0x78, 0xDC, 0xF3,
+    0x8B, 0x5B, 0xE5, 0xF4, 0x78, 0x1A, 0x85, 0x69, 0x37, 0x41, 0x3B, 0x8C, 0x97, 0x38, 0x56, 0x24,
+    0xF9, 0xEF, 0x07, 0x3E, 0x44, 0x8F, 0xE1, 0x29, 0xBE, 0x77, 0xF8, 0xAE, 0xB0, 0x2F, 0x1E, 0xDE,
+    0x51, 0x21, 0x8D, 0xD3, 0x34, 0x0C, 0x0B, 0xFD, 0x91, 0x0A, 0x1B, 0x05, 0x37, 0x7A, 0x6C, 0x34,
+    0x67, 0x1B, 0x0B, 0x36, 0x12, 0x37, 0x3A, 0x6C, 0xC0, 0x72, 0xBF, 0x6E, 0x1B, 0x78, 0x9E, 0xDC,
+    0x60, 0xE8, 0xE1, 0xB3, 0x78, 0x06, 0xEE, 0x60, 0x66, 0x28, 0x75, 0x6A, 0xB3, 0x20, 0x1A, 0xB8,
+    0x1E, 0x71, 0xE3, 0x33, 0xDC, 0xAB, 0x23, 0xED, 0x5C, 0x7E, 0x95, 0x2D, 0x0A, 0x9C, 0xEA, 0x4A,
+    0x22, 0x2C, 0x04, 0xBA, 0xAB, 0xF2, 0xD5, 0xD5, 0x33, 0xF3, 0x0C, 0x6E, 0x75, 0x3C, 0x90, 0xBB,
+    0xB7, 0xF5, 0x81, 0x39, 0xC8, 0x44, 0x52, 0x27, 0x0E, 0xB1, 0xE6, 0xD8, 0xF1, 0xF2, 0x91, 0x30,
+    0xC3, 0x89, 0x6B, 0xFD, 0xED, 0x3C, 0xE4, 0x4A, 0xF5, 0x06, 0x16, 0xE1, 0x84, 0x34, 0x6A, 0x18,
+    0xF2, 0x70, 0xAD, 0xD3, 0x05, 0x94, 0x1A, 0x8C, 0x0C, 0x68, 0x0B, 0x5E, 0x9C, 0x85, 0xD0, 0xE6,
+    0xCE, 0x42, 0xD8, 0x93, 0x37, 0xD9, 0x9D, 0x99, 0x3B, 0x8C, 0xEA, 0xC2, 0xE6, 0x30, 0xC4, 0xB1,
+    0xB6, 0xCB, 0xB5, 0x76, 0xEF, 0xE1, 0x5A, 0x3A, 0xE8, 0xB1, 0xD0, 0xA5, 0xA1, 0x53, 0x3F, 0x18,
+    0x77, 0x9C, 0xB9, 0x4A, 0x2F, 0x57, 0x29, 0xAE, 0x4D, 0xE1, 0x96, 0xB4, 0xF9, 0xF5, 0xDB, 0x3E,
+    0x7E, 0x17, 0x7B, 0x57, 0xBF, 0xBD, 0x71, 0x7B, 0x9F, 0x0C, 0x9F, 0xB8, 0xC5, 0xDF, 0x25, 0xB7,
+    0xE8, 0xE7, 0xB9, 0xFF, 0x55, 0x9F, 0xC7, 0x30, 0x3F, 0xCE, 0x6E, 0xB9, 0x51, 0xC7, 0x1B, 0x9B,
+    0xF6, 0x05, 0xA8, 0x05, 0x32, 0x92, 0xA2, 0xE1, 0xF1, 0x62, 0x91, 0x3A, 0x61, 0xD1, 0x59, 0x5E,
+    0x56, 0x71, 0x19, 0x77, 0x06, 0x41, 0x58, 0x3E, 0x22, 0x6B, 0x58, 0x30, 0xB4, 0x40, 0x72, 0x30,
+    0x45, 0x84, 0xC1, 0xE0, 0xB1, 0x49, 0xDC, 0x89, 0xD0, 0x9C, 0x26, 0xED, 0x4A, 0xBE, 0x0F, 0x1B,
+    0xA6, 0x96, 0x32, 0xBF, 0xEC, 0xA8, 0x32, 0xCD, 0x36, 0x21, 0x8D, 0x48, 0x21, 0x53, 0x5A, 0x53,
+    0x69, 0x78, 0xAD, 0xB4, 0xB9, 0xE9, 0x23, 0xD3, 0x34, 0x22, 0xBD, 0x2B, 0x99, 0x40, 0x4E, 0x4C,
+    0x25, 0x91, 0x7B, 0x37, 0x9C, 0xE8, 0xDE, 0x5B, 0x29, 0xED, 0x89, 0x64, 0x6A, 0xD5, 0xCA, 0x4C,
+    0xCD, 0xD5, 0x7E, 0xA8, 0x08, 0x49, 0x33, 0x15, 0x26, 0x04, 0x93, 0xC4, 0x4A, 0xA1, 0x31, 0x61,
+    0x67, 0xC2, 0x76, 0x84, 0x8D, 0xAF, 0x59, 0x28, 0x48, 0xEC, 0x70, 0x88, 0x2C, 0xCB, 0x45, 0x82,
+    0xD4, 0x2F, 0xAE, 0x61, 0x70, 0xC4, 0x46, 0x3F, 0x39, 0x08, 0x51, 0x10, 0x28, 0xA4, 0x76, 0x3C,
+    0x64, 0xD4, 0x23, 0x4E, 0xEB, 0x00, 0x61, 0x02, 0xD5, 0x1B, 0x23, 0xDA, 0x8C, 0x28, 0xE9, 0x67,
+    0x9B, 0x90, 0x7B, 0x5D, 0x6B, 0xA5, 0x13, 0xC7, 0x8D, 0xA9, 0x22, 0x1F, 0x9E, 0x25, 0xC5, 0x5A,
+    0x81, 0x40, 0x69, 0x0D, 0xD7, 0x3D, 0x70, 0x1F, 0xAC, 0xC6, 0xBF, 0x37, 0xD1, 0x61, 0x3D, 0x13,
+    0x8D, 0x26, 0x0A, 0xC4, 0x8B, 0x9D, 0xC7, 0x8A, 0x47, 0xB3, 0x11, 0x7C, 0xA7, 0xBC, 0xEA, 0x4F,
+    0xC8, 0x6D, 0xFA, 0x58, 0x7F, 0x46, 0x96, 0xE7, 0x83, 0xE2, 0x96, 0x1F, 0xCB, 0x64, 0x7D, 0xC3,
+    0xBD, 0x8A, 0xD4, 0xE9, 0xEF, 0x29, 0xAA, 0x4C, 0x04, 0xA0, 0xD4, 0xE8, 0x7B, 0x47, 0x46, 0x68,
+    0x86, 0x2D, 0xA7, 0x79, 0x68, 0xC7, 0x13, 0x9C, 0x88, 0xA5, 0x30, 0xB5, 0x63, 0x65, 0x3F, 0x62,
+    0xEC, 0x8D, 0xBB, 0x48, 0x6E, 0xAF, 0xF4, 0xF7, 0xDB, 0xE1, 0x54, 0x84, 0x7B, 0x7D, 0x58, 0x6A,
+    0x77, 0x26, 0x88, 0x91, 0x86, 0xB0, 0xE7, 0x4D, 0x65, 0x66, 0x01, 0x16, 0xC6, 0x78, 0x4B, 0x10,
+    0x3B, 0x85, 0x66, 0x2B, 0x9F, 0xC4, 0x18, 0x0B, 0x96, 0x6A, 0xC7, 0xCE, 0x71, 0x48, 0xD6, 0x33,
+    0x6A, 0x1C, 0x0C, 0x8B, 0xB4, 0x6C, 0x8B, 0x93, 0x84, 0x81, 0xD5, 0x44, 0x8A, 0x02, 0x5B, 0xD2,
+    0x0C, 0xB9, 0x07, 0x81, 0x50, 0x59, 0x64, 0x33, 0xCA, 0x6D, 0x2B, 0xD4, 0x7F, 0x5A, 0x9F, 0x41,
+    0x27, 0xB2, 0xD5, 0xAD, 0x15, 0xB2, 0x71, 0x25, 0x74, 0x67, 0x95, 0xD1, 0xCE, 0x35, 0xDB, 0x8B,
+    0x91, 0x7B, 0x86, 0xE2, 0x52, 0x2B, 0x78, 0xED, 0x8F, 0x58, 0x97, 0x99, 0x7D, 0xAB, 0x7F, 0x80,
+    0xF6, 0x2A, 0xC1, 0x0F, 0x09, 0xF7, 0x99, 0x15, 0x4D, 0x4A, 0x05, 0x7A, 0xEF, 0x8C, 0x64, 0xD6,
+    0x06, 0x1C, 0x83, 0xC2, 0xB4, 0x63, 0x4C, 0xC9, 0xC2, 0xB4, 0xF0, 0xAC, 0xA5, 0xB3, 0xC3, 0xB4,
+    0x2F, 0x95, 0x85, 0xF3, 0x25, 0x00, 0x44, 0xE9, 0xEA, 0x0C, 0x6C, 0xA0, 0xC8, 0xAF, 0x00, 0xE2,
+    0x03, 0x1D, 0xEC, 0x8E, 0x61, 0x65, 0xF8, 0xF5, 0xC7, 0x7F, 0x75, 0x1F, 0xFA, 0xEB, 0xB2, 0xBC,
+    0xE1, 0x53, 0x99, 0x22, 0x3F, 0xC9, 0x3B, 0xDF, 0x95, 0x99, 0x90, 0xA2, 0x53, 0xFA, 0x8C, 0x69,
+    0x05, 0x6A, 0x92, 0xA1, 0x88, 0xD5, 0x61, 0x0A, 0x82, 0x70, 0xEA, 0x39, 0x45, 0x48, 0x80, 0x15,
+    0x1E, 0xA3, 0xC5, 0xFC, 0xA5, 0xEF, 0xC3, 0xA1, 0x1E, 0x7D, 0x26, 0xFC, 0x82, 0x66, 0xFC, 0x34,
+    0xF6, 0x6B, 0xF3, 0xA7, 0x7E, 0xA1, 0x9F, 0x6A, 0x98, 0xFB, 0x88, 0x7C, 0x55, 0x6C, 0x60, 0x13,
+    0xA7, 0xE8, 0xB1, 0x23, 0x22, 0x0E, 0x11, 0xFA, 0x38, 0x45, 0x1B, 0x47, 0x5B, 0x1B, 0xD1, 0x40,
+    0x11, 0x64, 0x48, 0xC5, 0xB7, 0x72, 0xD9, 0x55, 0xE9, 0xA3, 0x44, 0x18, 0x66, 0x12, 0xAE, 0xC3,
+    0x00, 0x98, 0x2E, 0xFE, 0x27, 0x18, 0x74, 0xA0, 0x66, 0x06, 0x64, 0xE1, 0x47, 0x20, 0x96, 0xE8,
+    0xEF, 0x8C, 0x76, 0x14, 0x46, 0xFC, 0xDF, 0x65, 0x74, 0x13, 0xC7, 0x4C, 0xF5, 0xF8, 0x1F, 0x7C,
+    0x80, 0x1E, 0xBD, 0x5F, 0x08, 0xF0, 0x08, 0x9C, 0x2C, 0x37, 0x06, 0x3A, 0xFF, 0xA8, 0x68, 0x83,
+    0xFF, 0x45, 0x86, 0x62, 0xC9, 0x15, 0xBA, 0x1A, 0x40, 0x18, 0xC9, 0x39, 0xF2, 0x7B, 0x66, 0x8E,
+    0xC8, 0x36, 0x5E, 0x79, 0xF9, 0xA6, 0xF0, 0xCA, 0xDF, 0xA5, 0x55, 0x31, 0x6E, 0xDD, 0x46, 0x10,
+    0x1D, 0x92, 0xB0, 0x09, 0x84, 0xC5, 0xA6, 0x49, 0xBD, 0x47, 0xE0, 0x11, 0x96, 0x48, 0x0A, 0x17,
+    0x2E, 0x94, 0xC2, 0x3F, 0xAD, 0x8F, 0xA0, 0x23, 0xF0, 0x3B, 0x2E, 0x52, 0xA4, 0xB0, 0x9B, 0x1C,
+    0xC2, 0x69, 0x54, 0xA7, 0x11, 0x19, 0xBB, 0x50, 0xE1, 0x22, 0x04, 0x04, 0xC3, 0x45, 0x0A, 0x31,
+    0x50, 0x80, 0x04, 0xA9, 0x56, 0x0E, 0x15, 0xAD, 0xE3, 0xE5, 0x4E, 0xDE, 0xDB, 0xFF, 0x25, 0x05,
+    0x4A, 0x11, 0x04, 0x21, 0xCC, 0xF5, 0xFC, 0xE1, 0xEC, 0xEE, 0xBC, 0x37, 0x6F, 0x46, 0x6E, 0x16,
+    0xB3, 0xE8, 0x56, 0xDC, 0x69, 0x12, 0xD1, 0x83, 0x20, 0xD5, 0xEA, 0xFE, 0x9F, 0xEB, 0xCD, 0x66,
+    0x38, 0x55, 0x3C, 0x07, 0x78, 0x57, 0x87, 0x65, 0xE1, 0xAF, 0x49, 0xEC, 0x2C, 0x22, 0xFD, 0x56,
+    0xA4, 0xC0, 0x06, 0xA9, 0x03, 0x96, 0xEC, 0xFA, 0xA4, 0xC3, 0x62, 0x16, 0xA1, 0x53, 0xB9, 0x56,
+    0x3A, 0xF2, 0x3F, 0x65, 0x84, 0x0C, 0xD9, 0xE5, 0xB0, 0x1F, 0xE1, 0x1F, 0x22, 0x43, 0x03, 0x5D,
+    0xF9, 0x36, 0x29, 0xB5, 0xA1, 0x4B, 0x9F, 0x28, 0x0E, 0xE9, 0x27, 0xE7, 0x11, 0xEA, 0xE9, 0x32,
+    0xB1, 0x40, 0x6E, 0xCD, 0x8A, 0x9F, 0x38, 0xEF, 0x9B, 0xC7, 0xAB, 0x14, 0xCC, 0x62, 0x8B, 0xF3,
+    0x54, 0xBD, 0x30, 0xAD, 0x24, 0x2D, 0x5D, 0xA3, 0xE1, 0xBA, 0xD4, 0xF8, 0x66, 0x52, 0x89, 0xAB,
+    0x71, 0x3D, 0x22, 0x64, 0x58, 0x7A, 0x24, 0x60, 0x95, 0x3B, 0xFE, 0x40, 0xC4, 0xD7, 0xAA, 0xB1,
+    0x85, 0xBF, 0x1F, 0x71, 0x14, 0x52, 0xC5, 0x25, 0xF6, 0xB2, 0x93, 0x5E, 0xDF, 0xE3, 0xE4, 0x54,
+    0xE1, 0x35, 0xBE, 0x8C, 0x6E, 0xAC, 0x90, 0x9E, 0x39, 0x8F, 0xE2, 0x9E, 0xF9, 0x3A, 0xB9, 0x1D,
+    0xFA, 0x57, 0xFC, 0xAA, 0x3A, 0x3B, 0xFD, 0x55, 0x76, 0xA0, 0x56, 0x1E, 0x3B, 0x1E, 0x8B, 0xF5,
+    0xC7, 0x52, 0x2D, 0xB7, 0x6F, 0xE3, 0xE1, 0x9F, 0xF1, 0x76, 0xFB, 0x98, 0x09, 0xBE, 0x70, 0x2C,
+    0x65, 0x3C, 0x16, 0x49, 0xBB, 0xB7, 0x4A, 0xC3, 0xE6, 0x28, 0xE1, 0xDB, 0x8A, 0x37, 0xE2, 0x5D,
+    0x06, 0x22, 0xCB, 0x34, 0xA9, 0x12, 0xCE, 0xE9, 0x9E, 0xF5, 0x44, 0x8E, 0x0C, 0x60, 0x54, 0xA4,
+    0x9C, 0xB4, 0x92, 0x21, 0x13, 0xC9, 0x31, 0xEA, 0x40, 0x47, 0x0F, 0x87, 0x8D, 0x3B, 0xEA, 0x6F,
+    0x1D, 0x2B, 0x1D, 0x1D, 0x1C, 0xA0, 0xBD, 0x47, 0x69, 0x6C, 0xDA, 0x39, 0x48, 0x88, 0x22, 0xBA,
+    0x27, 0x89, 0x64, 0x74, 0x94, 0x06, 0xAB, 0x48, 0xEB, 0x49, 0xC8, 0xB0, 0xB5, 0x5E, 0xCA, 0x44,
+    0x8E, 0x9A, 0x40, 0x96, 0xDC, 0x4C, 0xB7, 0x6E, 0xED, 0x82, 0x82, 0xA1, 0x40, 0xA8, 0x73, 0x81,
+    0x63, 0xDC, 0x54, 0xE3, 0x06, 0xED, 0x6E, 0xDC, 0x76, 0x61, 0xB9, 0x74, 0xAC, 0x13, 0x8A, 0x20,
+    0x6D, 0xA8, 0x59, 0x93, 0x64, 0xB9, 0x06, 0x82, 0xD2, 0x99, 0x8B, 0x7E, 0xCA, 0x25, 0x72, 0xAF,
+    0xF3, 0x84, 0xA5, 0x5B, 0x00, 0xE4, 0x4F, 0x3C, 0xC5, 0x11, 0x62, 0xDB, 0x7D, 0x90, 0x6F, 0x73,
+    0x4D, 0x64, 0x07, 0xF8, 0x8E, 0x01, 0x52, 0x51, 0xAE, 0xF5, 0x6F, 0xC6, 0xFB, 0xCF, 0xEF, 0xC6,
+    0x5C, 0x6E, 0x36, 0x15, 0xCF, 0x01, 0x50, 0x7D, 0xC0, 0x2C, 0x68, 0x9C, 0xF0, 0x76, 0x1A, 0x53,
+    0xA1, 0xB3, 0xE1, 0x3F, 0xA4, 0xE0, 0x8D, 0x4E, 0x0E, 0x20, 0x5D, 0x84, 0x41, 0xC9, 0xB4, 0xAB,
+    0xD9, 0x29, 0xC8, 0x68, 0xA3, 0xDF, 0x93, 0xC1, 0x5A, 0x1F, 0x42, 0x02, 0x23, 0xCF, 0x3E, 0xD1,
+    0xD7, 0x59, 0xD0, 0xFA, 0x8B, 0xFE, 0x90, 0xB2, 0x14, 0xAE, 0xF4, 0x28, 0x5E, 0xD7, 0x2E, 0x37,
+    0x81, 0xCD, 0x0A, 0xA5, 0xD0, 0x33, 0xBF, 0xB9, 0x21, 0xF6, 0xF5, 0x2D, 0x33, 0xD7, 0x04, 0x7B,
+    0x6D, 0xD4, 0xD7, 0x9F, 0x6E, 0x76, 0x51, 0xE0, 0x71, 0x1F, 0x9B, 0x83, 0x1A, 0xDD, 0xF5, 0x1F,
+    0x6E, 0xB8, 0xD2, 0x33, 0xDE, 0xA1, 0x48, 0xE2, 0x35, 0x70, 0xE3, 0xDC, 0x46, 0x5F, 0xE2, 0x00,
+    0xAB, 0x6B, 0x83, 0x9C, 0x75, 0xEE, 0x35, 0x10, 0x8E, 0x86, 0xFB, 0xC3, 0x8C, 0xB0, 0x80, 0x88,
+    0x60, 0x7E, 0x1B, 0xB0, 0xA7, 0x85, 0x92, 0xDC, 0x98, 0x7B, 0xD7, 0x2E, 0x70, 0x6F, 0x8D, 0xFE,
+    0x8C, 0x13, 0x67, 0xF9, 0x62, 0xF0, 0xBB, 0xAF, 0xB9, 0x31, 0x3E, 0x46, 0xCF, 0x7D, 0x57, 0x0C,
+    0xEF, 0x94, 0x77, 0x68, 0x42, 0x19, 0x28, 0x68, 0x39, 0xD4, 0xE7, 0x2C, 0x33, 0xDB, 0x56, 0xE4,
+    0xDB, 0xE7, 0xA8, 0x9A, 0x4D, 0xD0, 0x64, 0x85, 0x96, 0x98, 0x21, 0x26, 0x98, 0x8D, 0x7A, 0xB0,
+    0xAF, 0x0A, 0xFA, 0x5B, 0x9A, 0x55, 0x36, 0x07, 0x54, 0x12, 0x04, 0xA3, 0xA6, 0xA5, 0xF6, 0x4B,
+    0xBB, 0xB8, 0x2B, 0x98, 0x0F, 0xD7, 0x3E, 0xB4, 0x0B, 0xA8, 0x7C, 0xA2, 0x8F, 0x43, 0x1F, 0xEC,
+    0x07, 0xAD, 0xC1, 0x33, 0x92, 0x8F, 0xC0, 0x91, 0xCD, 0x71, 0x40, 0x31, 0x96, 0x0C, 0x49, 0x68,
+    0xCE, 0x8D, 0x4E, 0x20, 0x65, 0x60, 0x65, 0x60, 0x4A, 0x91, 0x09, 0x1F, 0x2D, 0x67, 0x03, 0xE6,
+    0x40, 0x56, 0x02, 0x39, 0x0D, 0x24, 0x94, 0x65, 0xB9, 0xFF, 0x42, 0xFE, 0xFD, 0xD9, 0x09, 0xCF,
+    0x4D, 0xF2, 0xD1, 0x0B, 0x00, 0x28, 0x32, 0x16, 0x47, 0x58, 0x35, 0x00, 0xCC, 0xC8, 0x1D, 0x00,
+    0x0C, 0xB1, 0x94, 0x19, 0x8B, 0xA3, 0x89, 0x62, 0x94, 0x0A, 0x98, 0x4B, 0xEB, 0x5B, 0x62, 0xF9,
+    0x2C, 0xC3, 0x1A, 0xDE, 0xEA, 0x97, 0x7A, 0x10, 0x81, 0xE5, 0x52, 0xBF, 0x02, 0xAC, 0xC1, 0x13,
+    0x4B, 0xCA, 0x58, 0x26, 0x9A, 0x31, 0x63, 0xE9, 0x88, 0xC5, 0xD3, 0x4C, 0x37, 0x58, 0x32, 0x2C,
+    0x1C, 0x89, 0x1A, 0xA1, 0x27, 0x14, 0x80, 0x4A, 0x60, 0x71, 0x1E, 0x4A, 0xAC, 0x12, 0x05, 0xEA,
+    0x7E, 0xC2, 0x6F, 0x4C, 0x22, 0x76, 0xED, 0x8F, 0xE8, 0xBD, 0x66, 0x45, 0xD1, 0x90, 0x5C, 0xCC,
+    0xCA, 0xE8, 0xA8, 0x86, 0xAC, 0x55, 0x82, 0xC9, 0x5A, 0x32, 0x94, 0x48, 0x91, 0x15, 0x63, 0x35,
+    0x0F, 0x01, 0x52, 0xD2, 0x92, 0x9D, 0x52, 0x8F, 0x38, 0x3C, 0xC3, 0xA0, 0x63, 0xA5, 0x4F, 0x41,
+    0xAE, 0x83, 0x5C, 0x62, 0xA5, 0xDB, 0x5E, 0x17, 0x17, 0xF2, 0x1E, 0xB4, 0xC7, 0x42, 0x75, 0x4E,
+    0x54, 0x66, 0x67, 0xD9, 0x5E, 0xFD, 0xE5, 0x21, 0xDB, 0xBB, 0x9F, 0xEA, 0x84, 0xE6, 0xB7, 0x01,
+    0xBC, 0x0D, 0x93, 0x5D, 0x4A, 0xED, 0xFA, 0xA9, 0x41, 0xEE, 0x5D, 0xEB, 0x31, 0xA8, 0x75, 0x6C,
+    0x17, 0x56, 0x7C, 0x32, 0x11, 0x2E, 0x77, 0xED, 0xC2, 0x44, 0xD0, 0xC9, 0x42, 0x88, 0x0F, 0xD0,
+    0x6F, 0x6B, 0x8B, 0x2F, 0x0B, 0x52, 0xC7, 0x84, 0xDB, 0x56, 0x4C, 0xFE, 0xDE, 0x23, 0x02, 0xC3,
+    0x78, 0xF0, 0x60, 0xFD, 0x29, 0x90, 0xB5, 0x00, 0x3D, 0x8A, 0x46, 0xA7, 0x1D, 0x24, 0xC5, 0x14,
+    0xD1, 0x7A, 0x6B, 0xC1, 0xB9, 0xC8, 0x5C, 0x1D, 0x5B, 0xDA, 0xEB, 0x70, 0x8E, 0xA1, 0xBC, 0xEA,
+    0xD9, 0x9F, 0x6A, 0x30, 0xDB, 0xCF, 0x62, 0xFF, 0x56, 0xD5, 0x5D, 0xE8, 0x33, 0x0D, 0x7A, 0x02,
+    0xD1, 0x9E, 0xAA, 0x45, 0xC3, 0x9B, 0xD8, 0xCF, 0x18, 0x3F, 0x17, 0xA8, 0xCD, 0x04, 0x77, 0x8D,
+    0x22, 0xDA, 0x70, 0xEF, 0x11, 0xDD, 0xA0, 0xF5, 0x82, 0xBD, 0x09, 0x77, 0x9E, 0x18, 0x2D, 0xBB,
+    0xEA, 0x25, 0x12, 0x32, 0x71, 0x6F, 0x6E, 0x69, 0x86, 0xBD, 0x69, 0xA3, 0x0B, 0xE0, 0xF1, 0xD5,
+    0x1D, 0x73, 0x45, 0xEE, 0x05, 0x2E, 0x1B, 0x6F, 0xCD, 0x37, 0x9B, 0xC3, 0xFC, 0x37, 0x33, 0x8F,
+    0x70, 0x4D, 0xD9, 0x3C, 0xFF, 0x87, 0x19, 0x51, 0x89, 0x73, 0x6C, 0x73, 0x0A, 0xB3, 0xD2, 0xDF,
+    0x59, 0x71, 0xED, 0xD9, 0xD0, 0x5E, 0xFE, 0xE3, 0xF3, 0x17, 0xA5, 0x55, 0x3D, 0x8F, 0xDD, 0x54,
+    0x10, 0x1D, 0xDB, 0x8A, 0x2C, 0xAD, 0x8B, 0x5B, 0xA5, 0xA2, 0xF0, 0x4F, 0xF0, 0x4F, 0xB8, 0xA6,
+    0x4A, 0x4B, 0x41, 0x9A, 0xA4, 0x48, 0x1F, 0x8A, 0xFD, 0x05, 0x70, 0x2D, 0x9A, 0xB4, 0x29, 0x10,
+    0x2D, 0x5B, 0xD0, 0x90, 0x66, 0x1B, 0x4A, 0x22, 0x1B, 0x52, 0x6C, 0x91, 0xC6, 0x48, 0x48, 0x29,
+    0x31, 0x42, 0x28, 0x90, 0xCA, 0x8B, 0x5C, 0x78, 0x57, 0xD7, 0x1E, 0xCE, 0x19, 0xBF, 0xF7, 0xB2,
+    0xCA, 0xBE, 0x24, 0x05, 0x6F, 0x75, 0x67, 0xC7, 0x73, 0x7D, 0xE7, 0xE3, 0xCC, 0x99, 0x6B, 0x91,
+    0xD3, 0xB5, 0x16, 0x49, 0x54, 0x17, 0x91, 0x54, 0x55, 0x47, 0x93, 0x0A, 0x39, 0xE5, 0x3A, 0x24,
+    0x3A, 0x48, 0xB5, 0x48, 0x4B, 0x6B, 0xE7, 0x47, 0x11, 0x3F, 0x55, 0x51, 0xA4, 0x58, 0xDD, 0xC2,
+    0x43, 0x2F, 0x54, 0x60, 0x1A, 0xB5, 0x13, 0x71, 0x91, 0xDB, 0x99, 0x3E, 0xC2, 0xB6, 0xE8, 0x2B,
+    0xDB, 0x98, 0x6C, 0x63, 0xD9, 0x36, 0x9C, 0x32, 0xC0, 0x0B, 0x38, 0x4C, 0x74, 0x54, 0xFD, 0xE6,
+    0xA1, 0xC6, 0x8A, 0x91, 0xD6, 0x8C, 0x52, 0xEB, 0x96, 0xB2, 0x73, 0x94, 0xBD, 0x50, 0x0E, 0x52,
+    0x98, 0x2E, 0x9F, 0xE8, 0x35, 0x52, 0x3C, 0xFC, 0x72, 0x58, 0x63, 0x80, 0xB8, 0x38, 0x28, 0x8B,
+    0x14, 0x31, 0xF4, 0x12, 0xF6, 0x4A, 0xFB, 0x51, 0x65, 0x80, 0xB2, 0x1E, 0x51, 0xDC, 0x02, 0x45,
+    0x5F, 0xD1, 0x72, 0xF2, 0xEC, 0x07, 0xD4, 0xA0, 0xDA, 0x30, 0x9B, 0x9E, 0x59, 0xF6, 0x6E, 0x4A,
+    0x00, 0x03, 0xD2, 0xAB, 0xB5, 0x4E, 0xD7, 0x9C, 0x9E, 0xCA, 0x09, 0x00, 0x84, 0xBF, 0x1E, 0xEA,
+    0xCF, 0xAC, 0x85, 0x19, 0x8F, 0x2C, 0xAB, 0x41, 0x39, 0x33, 0x91, 0xAC, 0x61, 0x7A, 0x2A, 0x7E,
+    0x26, 0x2A, 0x03, 0x71, 0x20, 0x24, 0x86, 0x8E, 0x01, 0x35, 0xDE, 0x34, 0x85, 0x78, 0xA3, 0xCC,
+    0x53, 0xFD, 0x1E, 0x16, 0x40, 0xC2, 0x1C, 0xA2, 0x10, 0x98, 0x86, 0x49, 0x4C, 0xD2, 0xEA, 0x9B,
+    0xF3, 0xDA, 0x11, 0x99, 0x94, 0xE7, 0x37, 0x4F, 0x39, 0xF2, 0x14, 0x69, 0x27, 0xD9, 0xF9, 0x32,
+    0xD7, 0x47, 0xD4, 0xD9, 0xD4, 0x9E, 0xAA, 0xFE, 0x76, 0xE7, 0xC7, 0xDC, 0xB0, 0xF7, 0xF4, 0x6B,
+    0x7D, 0xAF, 0x19, 0x67, 0x66, 0xC8, 0xAD, 0xEE, 0x99, 0xD4, 0xD0, 0x86, 0x28, 0xEB, 0xA5, 0x35,
+    0xEA, 0xC2, 0x64, 0xA9, 0x7B, 0xF0, 0xE9, 0x9C, 0x15, 0xA0, 0x0E, 0x06, 0x70, 0x56, 0x03, 0x5B,
+    0xBE, 0x33, 0xE7, 0x66, 0x2E, 0xCD, 0x1C, 0x68, 0x4E, 0x3E, 0x64, 0x2E, 0x94, 0xAD, 0x06, 0xE5,
+    0xF6, 0xC5, 0xA4, 0x96, 0xEB, 0xBB, 0xE6, 0xC7, 0x8D, 0x9C, 0x9C, 0x21, 0xC3, 0xF6, 0x17, 0x95,
+    0x6C, 0xCD, 0xD0, 0xB7, 0xB1, 0x00, 0x4D, 0x3B, 0x17, 0xA1, 0x57, 0x93, 0x1B, 0xE1, 0x33, 0x74,
+    0xA2, 0x7F, 0xAE, 0xF0, 0xFB, 0xFB, 0x84, 0xDC, 0xE0, 0x3D, 0xD7, 0x95, 0xB5, 0xE3, 0x78, 0xC9,
+    0x58, 0x7E, 0x65, 0xE8, 0x69, 0x97, 0x67, 0xC6, 0xA7, 0x6A, 0x62, 0x62, 0x1D, 0xF6, 0x57, 0x62,
+    0x3F, 0xB2, 0xF8, 0x1A, 0x16, 0x1E, 0xB9, 0x3E, 0x74, 0xE6, 0x44, 0xF5, 0xCA, 0xB8, 0x19, 0x53,
+    0x3D, 0x5F, 0xCF, 0x47, 0x5F, 0x83, 0x14, 0x4F, 0x7A, 0x17, 0x93, 0xF8, 0x13, 0x7C, 0xB9, 0x97,
+    0x03, 0xD5, 0xD0, 0x68, 0x17, 0x0C, 0xAC, 0xD9, 0x1B, 0xB2, 0xC6, 0x69, 0x23, 0x2F, 0x3D, 0xFC,
+    0xC3, 0xB8, 0x2C, 0x8D, 0x93, 0x84, 0x38, 0x54, 0xCB, 0xE3, 0xEA, 0xBA, 0xA1, 0xEA, 0x22, 0x31,
+    0xAB, 0xC6, 0x14, 0x75, 0x93, 0xA4, 0x3D, 0xF3, 0x6E, 0xC7, 0x0C, 0x19, 0xFA, 0xB9, 0x50, 0x9E,
+    0x21, 0x9C, 0x85, 0x86, 0x99, 0xCD, 0x60, 0x5F, 0x52, 0xDD, 0x75, 0x9A, 0xDC, 0x08, 0x86, 0xB8,
+    0x55, 0xBD, 0xD3, 0x09, 0x0A, 0xDF, 0x19, 0x6C, 0xA8, 0x26, 0x82, 0x83, 0xE4, 0xD0, 0xFC, 0xC0,
+    0xF2, 0x97, 0x0A, 0x9E, 0x75, 0x76, 0xDA, 0x65, 0x3A, 0x16, 0x3A, 0x14, 0x1C, 0x82, 0x09, 0x8F,
+    0x89, 0x46, 0xCF, 0xAD, 0xD5, 0x03, 0x61, 0xFC, 0x65, 0x31, 0x03, 0x3F, 0x47, 0x80, 0xEE, 0xBB,
+    0x83, 0x29, 0xA7, 0xA9, 0xA4, 0x89, 0x7D, 0x48, 0x6E, 0x9A, 0x02, 0x4C, 0x09, 0x4D, 0x39, 0x4D,
+    0xE5, 0x88, 0x11, 0x0A, 0x7D, 0xE8, 0x13, 0xFD, 0x54, 0xEB, 0x7C, 0x31, 0x46, 0x3E, 0xC2, 0x5A,
+    0xC2, 0x9E, 0x73, 0x86, 0x22, 0x59, 0x40, 0xF2, 0xFA, 0x81, 0xC0, 0x80, 0x0E, 0xC5, 0x72, 0xE8,
+    0x88, 0xAF, 0xB3, 0x68, 0x4B, 0xB6, 0x15, 0xB0, 0xBE, 0xC2, 0xFA, 0x12, 0xEB, 0xB9, 0xAD, 0x3C,
+    0xB6, 0x00, 0xB0, 0x6D, 0x02, 0x39, 0x1B, 0x39, 0x51, 0xE8, 0x71, 0xCC, 0xF4, 0x32, 0xCA, 0xDD,
+    0x14, 0x35, 0xDB, 0x5A, 0x6E, 0xAE, 0xD0, 0xDF, 0xAD, 0x71, 0xA1, 0x64, 0x6B, 0x8E, 0x6B, 0xC3,
+    0x0F, 0x1F, 0x55, 0xFD, 0x05, 0xB8, 0x87, 0xD0, 0xDD, 0xBB, 0x6A, 0xBA, 0x50, 0xAD, 0xFA, 0x23,
+    0xEA, 0xA1, 0xB8, 0x5B, 0x6A, 0xF7, 0xF8, 0x29, 0x59, 0x6E, 0x31, 0xBA, 0x23, 0xB2, 0x7B, 0xBF,
+    0xF4, 0x47, 0x25, 0x82, 0xBE, 0x5F, 0x32, 0xE2, 0xB5, 0x49, 0x35, 0xB9, 0x9A, 0xB4, 0x06, 0xA8,
+    0x4D, 0x68, 0x11, 0xDF, 0xCE, 0xB6, 0x9B, 0x6D, 0x72, 0x39, 0x38, 0x72, 0xE7, 0xB3, 0xFB, 0x0F,
+    0xCE, 0xC8, 0x98, 0x68, 0xE4, 0x91, 0x6D, 0xD0, 0x40, 0x27, 0x9B, 0xE8, 0x6D, 0xB8, 0xED, 0xED,
+    0xB7, 0x46, 0xD5, 0x33, 0xBB, 0xD7, 0x1A, 0x4C, 0x19, 0xAE, 0x97, 0xFC, 0xEA, 0x0B, 0x95, 0x64,
+    0x21, 0xA3, 0x43, 0x8D, 0x06, 0x97, 0x7D, 0x0A, 0x62, 0x4C, 0xA2, 0x4D, 0xB2, 0xF0, 0xEB, 0x13,
+    0x48, 0xCC, 0x8A, 0x6F, 0x16, 0x14, 0x1B, 0x5B, 0x65, 0x3F, 0x37, 0x0C, 0xB8, 0x7D, 0x1B, 0xDA,
+    0xFE, 0x73, 0xB1, 0x09, 0xB6, 0x78, 0xC5, 0x62, 0x11, 0x53, 0xBD, 0x67, 0x17, 0x51, 0xF8, 0x35,
+    0x6E, 0x39, 0xDB, 0x66, 0xBE, 0x6D, 0x26, 0xB7, 0x36, 0xF5, 0x6F, 0xDB, 0x54, 0xFB, 0x46, 0xDD,
+    0x53, 0xBB, 0x04, 0xFE, 0x58, 0x1F, 0xF0, 0x42, 0x98, 0x43, 0x5D, 0x22, 0xD9, 0x15, 0xE9, 0xF1,
+    0x4A, 0x79, 0x82, 0x5B, 0x18, 0xC3, 0x77, 0xB9, 0x90, 0x8E, 0x55, 0x0C, 0x75, 0x60, 0x7E, 0x25,
+    0xBF, 0xA2, 0x99, 0xBE, 0xB4, 0x93, 0xFA, 0xAF, 0xFD, 0xF3, 0xB1, 0xE5, 0x9D, 0xEB, 0x2C, 0x4D,
+    0x22, 0x42, 0x14, 0x18, 0x3F, 0xDC, 0x7E, 0x04, 0x34, 0x60, 0xFF, 0x4C, 0x5C, 0xC2, 0xB7, 0x74,
+    0x1E, 0x5E, 0x23, 0xCE, 0x77, 0x40, 0x24, 0xD4, 0xEE, 0x0A, 0x70, 0xBC, 0x46, 0x3F, 0x4E, 0xB1,
+    0x8B, 0x8F, 0xCB, 0xD7, 0x07, 0x20, 0xFE, 0xD7, 0xEF, 0x3F, 0xAD, 0x55, 0xBF, 0x6F, 0x1D, 0x45,
+    0x10, 0x9E, 0xBB, 0x13, 0x3E, 0xE1, 0x2B, 0x96, 0x86, 0xC6, 0x2E, 0xAE, 0x77, 0x73, 0x7F, 0xC2,
+    0xBD, 0xC4, 0x45, 0x8A, 0x14, 0x50, 0x60, 0x21, 0xE1, 0xC2, 0x7D, 0x9A, 0xD7, 0x52, 0x79, 0x2F,
+    0x44, 0xC2, 0x05, 0x05, 0xAF, 0x20, 0x35, 0x2E, 0x52, 0xA0, 0x57, 0xE0, 0x7F, 0x00, 0xB1, 0x17,
+    0x2C, 0xE1, 0xC2, 0x05, 0x47, 0x22, 0x14, 0x89, 0x14, 0xB9, 0x10, 0x2C, 0x97, 0x5E, 0xDB, 0x97,
+    0xB0, 0xCF, 0xDE, 0xDD, 0xE1, 0x9B, 0xB3, 0x13, 0xC9, 0x28, 0x25, 0xEF, 0xE9, 0x46, 0xBB, 0x37,
+    0x7B, 0xF3, 0xE3, 0x9B, 0x6F, 0x66, 0x89, 0xBE, 0xF8, 0x94, 0x88, 0x0C, 0xF7, 0x44, 0x9A, 0xB9,
+    0xA3, 0x92, 0x99, 0x9B, 0x8C, 0x67, 0xD3, 0x40, 0xD8, 0x69, 0x5B, 0x3A, 0x4A, 0xF9, 0x36, 0x13,
+    0x29, 0xBF, 0x36, 0xC3, 0xC1, 0x16, 0xA7, 0xF3, 0x40, 0x0A, 0xC7, 0x7A, 0x82, 0x88, 0xD7, 0xCB,
+    0x8D, 0x8D, 0xCD, 0x08, 0x15, 0x69, 0x18, 0x22, 0x15, 0x75, 0xA0, 0x82, 0x9F, 0x42, 0xC3, 0xBE,
+    0x16, 0xF9, 0x8B, 0x08, 0x27, 0x47, 0x59, 0xFC, 0x70, 0x9B, 0x40, 0x58, 0x4A, 0x0C, 0xEF, 0xD2,
+    0xD5, 0xEF, 0x63, 0xF8, 0x99, 0xA5, 0x1E, 0xA1, 0xD8, 0xC2, 0xE2, 0xA0, 0xAD, 0x5A, 0x03, 0x69,
+    0x32, 0xBE, 0x65, 0x9E, 0xF8, 0x6A, 0x20, 0xF3, 0x8D, 0xE5, 0x86, 0xB8, 0xDA, 0xF7, 0x94, 0x7A,
+    0x73, 0x62, 0x29, 0x7F, 0x03, 0x3B, 0x54, 0x3E, 0x47, 0x0C, 0xA4, 0xA7, 0xEC, 0x28, 0x89, 0xF8,
+    0xF8, 0xFA, 0x75, 0xF5, 0xBC, 0x97, 0xD3, 0xD3, 0x07, 0xDC, 0x28, 0xBF, 0xAD, 0xF8, 0x92, 0x4F,
+    0x5D, 0x05, 0x9F, 0x77, 0x7A, 0xC4, 0xE3, 0xCB, 0x46, 0x92, 0xDD, 0x46, 0x28, 0x21, 0x19, 0x68,
+    0x95, 0x27, 0x44, 0xC9, 0x1E, 0xBE, 0x15, 0xBF, 0x12, 0x9F, 0x25, 0xFE, 0x63, 0xCB, 0x26, 0x4C,
+    0x85, 0x4D, 0x91, 0xC9, 0x30, 0x8A, 0x6C, 0x5C, 0x45, 0x11, 0x50, 0x38, 0xE2, 0x8B, 0x3D, 0x87,
+    0x70, 0xE1, 0xB8, 0x12, 0x21, 0x76, 0x65, 0xEB, 0x89, 0x7F, 0x37, 0x3E, 0xE5, 0xA6, 0xF6, 0x19,
+    0x4F, 0x6A, 0x9F, 0x33, 0xD5, 0xBE, 0x10, 0xA1, 0x64, 0x5B, 0x42, 0x84, 0x4A, 0x44, 0xCD, 0x13,
+    0x1D, 0xD6, 0xE6, 0xB4, 0xF6, 0xC3, 0x08, 0xC0, 0xAA, 0x23, 0x31, 0xD4, 0xA0, 0x02, 0xBD, 0x5A,
+    0x18, 0x9F, 0x0F, 0x19, 0x67, 0x8E, 0x74, 0x0B, 0xB4, 0x6D, 0x4D, 0x69, 0x28, 0x1B, 0x32, 0x77,
+    0x7B, 0x2A, 0x5F, 0x0E, 0x94, 0xBB, 0x6D, 0xC0, 0x55, 0x1E, 0x6D, 0xF2, 0xBE, 0xE0, 0x28, 0x5E,
+    0x05, 0xDB, 0x5B, 0xCC, 0xA6, 0x2B, 0xE2, 0x84, 0xDE, 0xFE, 0x3E, 0xC0, 0x93, 0xA2, 0x64, 0x4B,
+    0x8E, 0x96, 0x80, 0x7C, 0x0E, 0xD3, 0x00, 0x3E, 0x48, 0x8A, 0x8D, 0x02, 0x6C, 0xA9, 0x64, 0x5E,
+    0xA3, 0x64, 0x59, 0x98, 0x3A, 0x79, 0xEB, 0x72, 0xB1, 0x27, 0x15, 0xDA, 0xE1, 0x23, 0xE3, 0xB5,
+    0x4B, 0xF8, 0x18, 0xC9, 0xC6, 0x1A, 0xB0, 0x9C, 0x8B, 0x01, 0x2C, 0xCC, 0x5F, 0xDC, 0x55, 0x41,
+    0xFC, 0x49, 0x85, 0x5C, 0x26, 0x35, 0xC5, 0xAE, 0x01, 0x77, 0x3A, 0xB8, 0x9C, 0xC0, 0x8E, 0x78,
+    0x19, 0xF2, 0x8B, 0xBD, 0xA1, 0x6C, 0x8B, 0x5E, 0x53, 0x79, 0xDF, 0x53, 0x80, 0x65, 0x8B, 0xDC,
+    0x04, 0xF9, 0xC7, 0x00, 0x6A, 0x07, 0x86, 0xCA, 0x36, 0xF5, 0x7A, 0x63, 0x7A, 0x0A, 0x0B, 0x07,
+    0x78, 0xCA, 0xD1, 0xF5, 0x42, 0x90, 0x5C, 0x60, 0x7B, 0x8C, 0xE7, 0x45, 0x9C, 0xCF, 0x75, 0x47,
+    0x09, 0xAC, 0xE7, 0x88, 0x17, 0x6C, 0x04, 0x27, 0xB1, 0x6D, 0x11, 0x0A, 0xB6, 0xFE, 0xE6, 0x36,
+    0x60, 0x3B, 0x50, 0x32, 0x9F, 0x09, 0x07, 0x85, 0x05, 0xFF, 0x11, 0x65, 0x6F, 0xAE, 0x45, 0x35,
+    0x8A, 0x0E, 0xA2, 0x7E, 0x27, 0x4C, 0x0B, 0xC1, 0xAD, 0x6E, 0x51, 0x36, 0xDD, 0x6E, 0xF2, 0x43,
+    0x73, 0x24, 0x40, 0xB0, 0x10, 0x38, 0x8A, 0x08, 0x42, 0x20, 0x5F, 0x5A, 0x2A, 0xBC, 0x02, 0x57,
+    0xDC, 0xF2, 0x2E, 0x2D, 0x3F, 0xA2, 0xD5, 0x85, 0xD4, 0xCD, 0x4A, 0xD4, 0x93, 0x7A, 0x28, 0x2D,
+    0xF4, 0x41, 0x5D, 0xCC, 0xC7, 0xCA, 0x48, 0x66, 0x41, 0x8C, 0x4C, 0x17, 0x9F, 0x51, 0x8E, 0x68,
+    0x93, 0x11, 0x70, 0x10, 0xA9, 0x10, 0xF8, 0xF8, 0x0A, 0x12, 0x30, 0x06, 0x1C, 0x5E, 0xE2, 0xBF,
+    0x89, 0xE6, 0xB3, 0x95, 0x39, 0xDD, 0xDB, 0x45, 0xF3, 0x24, 0x6C, 0x15, 0xF2, 0xA9, 0x5D, 0xC9,
+    0x19, 0x42, 0x4F, 0xB8, 0x03, 0x38, 0x96, 0xA0, 0x51, 0x2C, 0x0A, 0x68, 0xF8, 0x15, 0x60, 0x81,
+    0xE6, 0x30, 0x8A, 0x02, 0x1A, 0x73, 0x22, 0x0A, 0x89, 0x44, 0x14, 0x44, 0x63, 0x8F, 0x8D, 0x1A,
+    0x1E, 0x15, 0xA2, 0x19, 0x15, 0xA9, 0x10, 0xF6, 0xFA, 0x44, 0x3F, 0xB6, 0xAD, 0x84, 0x43, 0x23,
+    0x01, 0x59, 0x42, 0x94, 0xF0, 0xA4, 0xAF, 0x32, 0x8E, 0x68, 0x1D, 0x0F, 0x27, 0xBC, 0x85, 0x3F,
+    0xBA, 0x90, 0x9F, 0xF0, 0x60, 0xB8, 0xAB, 0x79, 0xA8, 0xF8, 0x2B, 0x31, 0xF7, 0x11, 0xE9, 0x90,
+    0x72, 0xF8, 0x90, 0x7E, 0x22, 0x42, 0xF7, 0xB5, 0x2B, 0x86, 0xD8, 0x66, 0x30, 0x5B, 0x62, 0x9A,
+    0x7C, 0x3D, 0x89, 0x15, 0x0F, 0x52, 0xDE, 0xB8, 0xC4, 0x33, 0xDD, 0x24, 0x7C, 0x07, 0x9D, 0xE2,
+    0x74, 0x53, 0xF0, 0x0E, 0xB8, 0x85, 0x45, 0x8D, 0x45, 0x21, 0x0B, 0x50, 0xCE, 0xD5, 0xFF, 0x38,
+    0x7D, 0x18, 0xF4, 0x8E, 0xE7, 0x03, 0xAF, 0x91, 0x2F, 0x3E, 0x2B, 0xB0, 0x68, 0xCD, 0x01, 0xA6,
+    0x82, 0xD7, 0x91, 0xB0, 0x68, 0x95, 0x47, 0x91, 0xF9, 0xD7, 0x39, 0x2D, 0x8F, 0x8D, 0x53, 0xB7,
+    0xF9, 0x50, 0x1D, 0x4D, 0x6D, 0x25, 0x7D, 0x83, 0x2C, 0x32, 0x89, 0xFB, 0xDE, 0x77, 0xF4, 0xBE,
+    0x9F, 0x42, 0x8E, 0xAA, 0xCB, 0x9D, 0xEA, 0x94, 0x2B, 0xBA, 0x12, 0x0F, 0x5A, 0xB3, 0x97, 0x07,
+    0xFD, 0xD6, 0x47, 0x9F, 0x9F, 0x5D, 0xF8, 0xFC, 0xFC, 0xCC, 0xE7, 0x97, 0xAF, 0xC0, 0xD7, 0xFD,
+    0x90, 0x8D, 0xCF, 0x7A, 0x44, 0x27, 0xC6, 0x0C, 0x2B, 0x78, 0xB2, 0xA9, 0x57, 0x80, 0x41, 0x21,
+    0x8D, 0x43, 0x4F, 0xEA, 0x3C, 0x50, 0x76, 0x19, 0x05, 0x48, 0x01, 0x11, 0x1C, 0x04, 0x7A, 0x05,
+    0xFA, 0x20, 0xE5, 0xF1, 0x25, 0x68, 0xF1, 0x82, 0x27, 0xCA, 0xA2, 0x4D, 0xD0, 0xA1, 0x8F, 0x51,
+    0x55, 0x60, 0x25, 0x7D, 0x83, 0x70, 0x7D, 0x61, 0x75, 0xEA, 0xCB, 0xD6, 0xE4, 0xB6, 0xBA, 0x2F,
+    0x21, 0x64, 0xAE, 0x6A, 0x43, 0x61, 0xEB, 0xDB, 0x5E, 0x75, 0x26, 0xB3, 0xD5, 0x81, 0x2F, 0xCE,
+    0x39, 0xF3, 0x4C, 0x66, 0xCC, 0xB3, 0x07, 0x4D, 0x65, 0x70, 0xAE, 0xC3, 0x20, 0xDA, 0x8F, 0xEA,
+    0xA1, 0xC6, 0x98, 0xE9, 0x65, 0xAC, 0x3E, 0x00, 0x56, 0x51, 0x61, 0xE0, 0x3A, 0x6D, 0x7E, 0x3B,
+    0x79, 0x19, 0x98, 0xF5, 0xCE, 0x1B, 0x0E, 0x5C, 0x3E, 0xE3, 0x63, 0xAF, 0xBF, 0xE5, 0xAD, 0xD3,
+    0x58, 0x79, 0x73, 0xE0, 0xEA, 0x33, 0xAE, 0x2C, 0xDF, 0xF5, 0xE6, 0xB1, 0xC7, 0x12, 0x01, 0xB6,
+    0x2B, 0x0D, 0xAD, 0xAD, 0x7B, 0x0C, 0x94, 0x1A, 0xD3, 0x7E, 0x3F, 0x80, 0xA4, 0x37, 0x17, 0x18,
+    0x77, 0x1E, 0x9E, 0xCD, 0xD5, 0x02, 0xA4, 0xD8, 0x7F, 0x3B, 0xD3, 0x65, 0x11, 0x6A, 0x10, 0xFD,
+    0x29, 0xDA, 0x3F, 0x60, 0x2E, 0xF0, 0x33, 0x59, 0xD0, 0xAA, 0x74, 0x21, 0x98, 0xA2, 0xA5, 0x1F,
+    0xA2, 0xB1, 0xD5, 0x90, 0x47, 0xA0, 0xA5, 0x31, 0xB7, 0xD5, 0x6B, 0xA6, 0x2C, 0x6A, 0xB4, 0xDA,
+    0x9E, 0xA5, 0xEA, 0x18, 0x2F, 0x16, 0x3C, 0xC9, 0x30, 0x5C, 0x32, 0xFE, 0xE4, 0xFA, 0x92, 0x90,
+    0xF1, 0x6C, 0x31, 0x2A, 0x86, 0xD1, 0x46, 0x22, 0x77, 0x10, 0x0B, 0xF7, 0x18, 0xD6, 0x99, 0x5F,
+    0xF3, 0xC3, 0xCF, 0x03, 0xBE, 0xE7, 0x2D, 0x00, 0xFB, 0xEE, 0x7B, 0x0C, 0x08, 0xFE, 0x7E, 0xC0,
+    0x8B, 0xF0, 0xFE, 0x17, 0x39, 0xEB, 0x2E, 0xE1, 0x3F, 0x1F, 0xD1, 0x1A, 0x2E, 0x9B, 0x95, 0x09,
+    0x3C, 0x5F, 0x85, 0x37, 0x8C, 0x97, 0x50, 0x0E, 0xDA, 0x80, 0x38, 0xE0, 0x46, 0x8D, 0x49, 0xDE,
+    0xC0, 0xE3, 0xCF, 0x18, 0x00, 0x89, 0x47, 0x2A, 0xB9, 0xBD, 0x7A, 0x35, 0x24, 0x51, 0xA6, 0xDC,
+    0x50, 0x5E, 0xCF, 0x3C, 0xA9, 0x21, 0xDA, 0x33, 0xA2, 0xC6, 0xB5, 0xFD, 0xB1, 0x91, 0xE9, 0x44,
+    0x85, 0x74, 0x18, 0xAE, 0x29, 0x01, 0x55, 0xFA, 0x86, 0xAE, 0xC6, 0x13, 0x19, 0x7B, 0x83, 0x81,
+    0xD3, 0x05, 0x28, 0x02, 0xE6, 0x8F, 0x5C, 0x6D, 0x4C, 0x87, 0xC9, 0x8B, 0x83, 0x38, 0x83, 0xAC,
+    0x70, 0xAD, 0x00, 0x64, 0x6C, 0x87, 0x71, 0xAC, 0x11, 0xF7, 0x5F, 0xC2, 0x11, 0xAE, 0x01, 0xC6,
+    0x8D, 0x03, 0x2A, 0x99, 0x05, 0xFD, 0xDF, 0xBF, 0x7F, 0x01, 0x8D, 0x55, 0x31, 0x8F, 0xDC, 0x54,
+    0x10, 0x1E, 0xDB, 0xE2, 0x2C, 0xC5, 0x85, 0x29, 0x88, 0x90, 0x20, 0x92, 0x5B, 0x04, 0x12, 0xFE,
+    0x05, 0xB9, 0x67, 0xA0, 0xA4, 0xC8, 0x15, 0x44, 0x29, 0xF8, 0x07, 0x34, 0xF7, 0x07, 0x90, 0x9E,
+    0x11, 0x12, 0x94, 0xB9, 0x26, 0x0D, 0x0D, 0x69, 0xD9, 0x2B, 0x8E, 0x32, 0x05, 0x8A, 0x4D, 0x52,
+    0xA4, 0xA0, 0xC0, 0xCA, 0x21, 0x21, 0x41, 0x81, 0x05, 0x41, 0x11, 0xA2, 0x88, 0x73, 0x79, 0x4A,
+    0xBC, 0x9B, 0x67, 0x0F, 0xDF, 0xF7, 0x76, 0xEF, 0xD8, 0x04, 0x14, 0xF0, 0xEE, 0xCE, 0xCE, 0x1B,
+    0xDB, 0xF3, 0x66, 0xBE, 0xF9, 0x66, 0x9E, 0x55, 0xD5, 0x1F, 0xF1, 0x9B, 0x2C, 0x95, 0x95, 0xFD,
+    0x69, 0x92, 0xC4, 0x8B, 0x88, 0x69, 0x65, 0xAD, 0x58, 0x28, 0xE9, 0x44, 0xA5, 0x7B, 0x5E, 0x69,
+    0xA0, 0x64, 0x33, 0x95, 0x7E, 0xA3, 0x7C, 0x74, 0xC0, 0xBB, 0xB9, 0xD3, 0x56, 0xEC, 0xB7, 0x5A,
+    0xC7, 0x73, 0xA2, 0x58, 0x41, 0xD8, 0x36, 0x9B, 0xE2, 0x59, 0x72, 0x9F, 0x3B, 0x29, 0x47, 0xF8,
+    0x34, 0x27, 0x78, 0xBE, 0x51, 0x27, 0xA2, 0x78, 0x38, 0x56, 0xAC, 0x12, 0xAE, 0x32, 0xAC, 0x24,
+    0xA7, 0xAF, 0xD2, 0xD1, 0x33, 0x77, 0x0F, 0x5B, 0x38, 0xDC, 0xC7, 0xBD, 0x5C, 0xB1, 0xB3, 0x51,
+    0x6C, 0xB8, 0x7E, 0xA5, 0x96, 0xD3, 0x2B, 0x0F, 0x6A, 0x8E, 0x17, 0x64, 0x5F, 0x75, 0x94, 0x14,
+    0x09, 0x69, 0x9D, 0x53, 0xF6, 0x66, 0x28, 0xBA, 0xD2, 0x99, 0xB6, 0xE8, 0xB3, 0xD1, 0x56, 0x45,
+    0x9F, 0xFA, 0x06, 0x32, 0xD9, 0x92, 0xA9, 0xB7, 0xB8, 0x9B, 0x7B, 0xE3, 0x8A, 0xDE, 0x8C, 0x25,
+    0xDF, 0x1A, 0xD6, 0xEF, 0x26, 0x94, 0x15, 0x7D, 0xDE, 0x83, 0xEB, 0xA2, 0xE3, 0x2E, 0x45, 0xFF,
+    0xB7, 0x2C, 0xFF, 0x21, 0x43, 0x1C, 0xA3, 0x64, 0x3E, 0xD2, 0x0A, 0x40, 0x95, 0x43, 0x32, 0x4B,
+    0x42, 0x28, 0xC4, 0xDE, 0x85, 0xA7, 0x6C, 0x62, 0xD4, 0x4C, 0x46, 0x0A, 0x85, 0xBB, 0x98, 0xD9,
+    0x30, 0x41, 0x02, 0x42, 0x7C, 0x75, 0x60, 0x8A, 0x50, 0x8D, 0xC7, 0x2D, 0xE3, 0x8B, 0x59, 0xCA,
+    0x29, 0xD6, 0x0E, 0xFF, 0xC6, 0x9F, 0x5B, 0xC8, 0xCE, 0xA2, 0xB2, 0x5D, 0x3C, 0x47, 0x2A, 0xD9,
+    0x98, 0x7A, 0x6C, 0x5A, 0x0C, 0xD2, 0xD4, 0xB6, 0x8D, 0x15, 0xA6, 0xD4, 0xA3, 0x6C, 0xC5, 0x90,
+    0x0F, 0xC0, 0xDC, 0xB4, 0x30, 0x6C, 0x9B, 0x0C, 0x4C, 0x30, 0xE8, 0x17, 0x87, 0x7A, 0xCC, 0xB4,
+    0x98, 0xA1, 0x37, 0xCC, 0x35, 0x80, 0x05, 0x40, 0x89, 0x75, 0xEE, 0x36, 0x75, 0x97, 0xCB, 0xF2,
+    0x86, 0x5C, 0x77, 0xC9, 0x71, 0x9B, 0x5F, 0x92, 0xDD, 0x8F, 0x65, 0xD9, 0xA7, 0xF7, 0xEB, 0xF2,
+    0xCB, 0x4F, 0x66, 0xA3, 0x63, 0xA3, 0x7D, 0x73, 0xB5, 0x96, 0x5D, 0x11, 0x2F, 0xC9, 0x00, 0xDC,
+    0x6D, 0x77, 0xBE, 0xB2, 0x77, 0xA6, 0x64, 0x06, 0x94, 0x9D, 0xE9, 0xFF, 0x5D, 0x35, 0x54, 0x13,
+    0x60, 0x4D, 0xD5, 0x27, 0x13, 0xD5, 0xB2, 0x83, 0x1A, 0x9F, 0xA9, 0xF3, 0x95, 0xF9, 0x8A, 0x27,
+    0x1B, 0xF5, 0x0E, 0xC5, 0x33, 0x2A, 0xB7, 0x68, 0x83, 0xCB, 0x17, 0x4A, 0x73, 0x2A, 0xDB, 0x8D,
+    0xEC, 0x28, 0xCB, 0xE7, 0xE5, 0xEF, 0xF8, 0xFC, 0x11, 0xDC, 0x4F, 0x5B, 0x72, 0xBD, 0xA1, 0x0F,
+    0x45, 0xDC, 0x92, 0xC5, 0x18, 0x0A, 0xBC, 0x96, 0x8E, 0x85, 0x2A, 0x51, 0xC1, 0x9D, 0x43, 0xD4,
+    0x4A, 0xBE, 0xA1, 0x6D, 0x43, 0xBE, 0x44, 0x97, 0x2C, 0x2E, 0xEA, 0x76, 0x38, 0xC1, 0x60, 0xDA,
+    0x64, 0x48, 0x07, 0xF1, 0x91, 0x17, 0x83, 0x62, 0x00, 0xF0, 0x3A, 0xF0, 0x98, 0x94, 0x0A, 0x00,
+    0xF3, 0x55, 0x72, 0x2A, 0x7B, 0x7C, 0x5D, 0x24, 0x9A, 0x6E, 0x10, 0xFA, 0xB7, 0xB9, 0xDF, 0x77,
+    0xA4, 0xFE, 0x23, 0xB8, 0x8F, 0x7C, 0xE8, 0x43, 0xF3, 0x55, 0x25, 0xC5, 0xF7, 0xA0, 0x7F, 0xFA,
+    0x04, 0x0E, 0xA2, 0xC9, 0xA7, 0xA3, 0x58, 0x2B, 0x8D, 0x14, 0x0F, 0xDA, 0xA2, 0x4D, 0x9F, 0x0E,
+    0x45, 0x1F, 0xCF, 0x8A, 0x1E, 0x6A, 0x1A, 0xB0, 0xBF, 0x24, 0x5D, 0x73, 0xFF, 0x72, 0x08, 0x6E,
+    0xFB, 0xEB, 0xD9, 0x39, 0x15, 0x2A, 0x3E, 0x1F, 0x39, 0xF0, 0x02, 0x81, 0xF1, 0x9B, 0x7A, 0xB4,
+    0x4C, 0xA0, 0x41, 0xB5, 0xA3, 0x07, 0x11, 0xDC, 0xA4, 0x3F, 0xEC, 0xBB, 0x57, 0x04, 0x9C, 0x09,
+    0x34, 0xE7, 0x38, 0x68, 0xAA, 0x46, 0x41, 0x43, 0x76, 0x29, 0x23, 0xD6, 0x0B, 0x20, 0xB9, 0xFD,
+    0x53, 0x6F, 0x01, 0x38, 0xF4, 0x5A, 0x17, 0x35, 0xEC, 0x8F, 0xB7, 0x46, 0xF1, 0xA9, 0x4E, 0xC9,
+    0x60, 0xD4, 0xE7, 0x9F, 0xCE, 0x1F, 0x8E, 0xBB, 0x79, 0x9F, 0x0E, 0xA3, 0x95, 0xFC, 0xF8, 0x04,
+    0x51, 0x5D, 0x02, 0xE1, 0x6F, 0x1A, 0xAD, 0xA2, 0x91, 0x89, 0xFC, 0x06, 0x5F, 0xE5, 0xD5, 0x07,
+    0x83, 0x4C, 0x17, 0xCB, 0x3E, 0x73, 0xCE, 0xAE, 0xF4, 0x76, 0xA7, 0x3A, 0xE7, 0xEF, 0x22, 0x94,
+    0x8B, 0xD8, 0xAA, 0x72, 0x61, 0xB6, 0xC8, 0xF9, 0x0F, 0xD8, 0xCE, 0x75, 0xCA, 0x76, 0x74, 0xB1,
+    0x8F, 0x3D, 0xD2, 0xBE, 0x29, 0x65, 0x6B, 0xEA, 0x0C, 0xB4, 0x8E, 0xD1, 0x68, 0xD7, 0x94, 0x2D,
+    0xD3, 0x02, 0x5B, 0x87, 0xF7, 0xA6, 0x48, 0x53, 0xAD, 0xB4, 0xB2, 0xBD, 0xED, 0xCA, 0xB1, 0x74,
+    0xD9, 0x9C, 0x23, 0xF2, 0xCF, 0x61, 0x7A, 0x84, 0x61, 0xE0, 0xCF, 0x66, 0x06, 0x29, 0x1F, 0xCA,
+    0xAB, 0x67, 0xA3, 0x6C, 0x90, 0xFF, 0xBE, 0xA2, 0xE6, 0x00, 0x5D, 0xAB, 0x9C, 0x48, 0x18, 0x6E,
+    0xEF, 0xB0, 0xED, 0xF2, 0x4E, 0x17, 0x47, 0xA1, 0x95, 0x8A, 0xCD, 0x44, 0x7D, 0xAC, 0xD7, 0xAA,
+    0xD0, 0x45, 0x85, 0x23, 0x2B, 0x3A, 0xF9, 0xBA, 0x01, 0xAD, 0xD8, 0x71, 0x80, 0x57, 0xDB, 0x9C,
+    0x1C, 0xD9, 0x9F, 0xAB, 0xC4, 0x03, 0x63, 0x7D, 0x6F, 0x12, 0xD3, 0x6B, 0x55, 0x8C, 0xB6, 0x4F,
+    0xB5, 0xF4, 0xD1, 0xE2, 0xB3, 0xC5, 0x0B, 0xF6, 0x7F, 0x7D, 0x49, 0xF6, 0x0D, 0xCC, 0xB8, 0xC2,
+    0xC0, 0x1A, 0xD0, 0xFF, 0x53, 0xBE, 0x5A, 0xE8, 0x6D, 0x38, 0x7E, 0x78, 0x4A, 0xE4, 0xFD, 0x25,
+    0x40, 0x43, 0x6E, 0x11, 0x99, 0x66, 0x26, 0xC9, 0x32, 0x6E, 0xCB, 0x5E, 0x2F, 0x48, 0x6F, 0xC0,
+    0x2C, 0x3B, 0x1C, 0x69, 0xA1, 0xDB, 0xC5, 0x84, 0xB9, 0x16, 0x48, 0xF9, 0x2A, 0x2B, 0x0C, 0xD7,
+    0xAC, 0x31, 0x69, 0x9A, 0x2C, 0x38, 0x95, 0x82, 0x2F, 0x24, 0x73, 0xA2, 0x07, 0x1C, 0x51, 0x08,
+    0x9E, 0x69, 0x74, 0x18, 0xD8, 0x4F, 0x41, 0xE7, 0x12, 0x0E, 0x39, 0xAD, 0x23, 0x1C, 0x1F, 0x18,
+    0x38, 0x8E, 0xA8, 0x82, 0x37, 0x06, 0x53, 0xA8, 0x16, 0xB0, 0x75, 0x0E, 0x66, 0x4F, 0x73, 0x39,
+    0xD0, 0x0C, 0x1B, 0xAB, 0x85, 0x92, 0x62, 0x08, 0x4A, 0x31, 0x65, 0x08, 0xA9, 0x71, 0x86, 0xA3,
+    0x6F, 0xDD, 0x1B, 0xE1, 0x34, 0x58, 0x9F, 0x04, 0xF2, 0x66, 0xB5, 0x19, 0xAA, 0x64, 0x21, 0x6E,
+    0x91, 0x81, 0x50, 0xB1, 0x63, 0x16, 0x82, 0x67, 0xB4, 0x4B, 0x44, 0x73, 0x1F, 0xBF, 0x5F, 0xE6,
+    0xC5, 0x02, 0x67, 0x50, 0x84, 0xD2, 0xF2, 0xE0, 0x60, 0xDB, 0xDA, 0x01, 0xCB, 0x16, 0x0C, 0xC2,
+    0xD2, 0x3F, 0xBB, 0xC4, 0x61, 0x62, 0x9D, 0x44, 0x0B, 0xE4, 0x24, 0x2F, 0x55, 0xB0, 0x81, 0x70,
+    0x3A, 0xA6, 0x63, 0xE6, 0x40, 0xAD, 0x87, 0x88, 0xF7, 0xE7, 0x7E, 0x3D, 0x8B, 0x01, 0x59, 0xB2,
+    0xBC, 0xBC, 0xC7, 0x7E, 0x28, 0xEF, 0xC5, 0xB3, 0x0D, 0xED, 0xA2, 0x77, 0x81, 0x22, 0x88, 0x30,
+    0xC8, 0xD1, 0x72, 0x1D, 0x61, 0x06, 0x44, 0x01, 0x6F, 0x95, 0xAF, 0x9A, 0x16, 0x61, 0xEE, 0x49,
+    0x38, 0x4B, 0x6B, 0x92, 0xAB, 0x62, 0x62, 0x35, 0x9E, 0x98, 0x59, 0xBC, 0x3E, 0xC4, 0x52, 0xC5,
+    0x5A, 0xDF, 0x00, 0xC5, 0xED, 0xAA, 0x19, 0xED, 0x7A, 0x14, 0x03, 0x09, 0xB4, 0xC6, 0x6B, 0xE1,
+    0xB0, 0x41, 0x4C, 0x7B, 0xF6, 0x96, 0xBE, 0x3F, 0x9B, 0x51, 0x9F, 0xF0, 0xBC, 0xE0, 0x45, 0xC2,
+    0x98, 0x56, 0xB7, 0xFE, 0x70, 0xD4, 0xA6, 0xBE, 0x70, 0xCD, 0xAF, 0x5B, 0xA7, 0xE1, 0xFF, 0xBD,
+    0xFE, 0x02, 0xAD, 0x55, 0x3F, 0x8F, 0xDF, 0x44, 0x10, 0x1D, 0x7B, 0x15, 0x59, 0xC2, 0xC5, 0xA6,
+    0xE0, 0x9A, 0x34, 0xFE, 0x06, 0xB8, 0x47, 0x82, 0xB5, 0x42, 0x91, 0x32, 0x69, 0x0E, 0x84, 0xF8,
+    0x04, 0x54, 0xF9, 0x04, 0xA7, 0xFD, 0x49, 0x29, 0xAE, 0xA5, 0xA1, 0x86, 0x82, 0x22, 0x0A, 0x45,
+    0x6A, 0xAA, 0x5D, 0x40, 0xCA, 0x15, 0x14, 0x67, 0x09, 0x21, 0x4A, 0x5C, 0x10, 0x21, 0x48, 0x81,
+    0x13, 0x59, 0x8A, 0x39, 0xED, 0x7A, 0x78, 0x6F, 0x7D, 0x47, 0x0E, 0x45, 0x02, 0x0A, 0x56, 0xF2,
+    0xEC, 0xAC, 0xFF, 0xCC, 0x9F, 0x37, 0x6F, 0xC6, 0xFD, 0x18, 0x6E, 0x6F, 0xED, 0xEA, 0x26, 0x7D,
+    0xA0, 0x36, 0xF9, 0xE7, 0xFA, 0xE4, 0xD1, 0xAD, 0x87, 0xF2, 0x6A, 0x99, 0x24, 0xE2, 0xE2, 0x3F,
+    0x6E, 0x0D, 0x36, 0x7F, 0xB9, 0x8D, 0xD2, 0x6E, 0x22, 0x61, 0x12, 0xB1, 0xA3, 0xB8, 0x43, 0xA5,
+    0xD2, 0x26, 0xE9, 0x67, 0xF9, 0xDB, 0xAA, 0x36, 0x69, 0x56, 0xE9, 0x26, 0xF1, 0x43, 0x9D, 0xA5,
+    0x5D, 0xA4, 0x1F, 0x25, 0x48, 0x9D, 0xA4, 0x9D, 0xA5, 0x8F, 0x50, 0x61, 0xD8, 0xCE, 0x34, 0xBD,
+    0x89, 0x59, 0xA5, 0x9F, 0x6E, 0xEA, 0xA0, 0xD9, 0xE8, 0x6C, 0x35, 0xFA, 0x2C, 0x1F, 0x0F, 0xD2,
+    0xA8, 0x8A, 0xB4, 0x45, 0x5C, 0x04, 0x91, 0x26, 0xBE, 0x75, 0x29, 0xDA, 0x5D, 0xF4, 0x7A, 0xA0,
+    0x98, 0x21, 0x3E, 0x58, 0x6D, 0xEC, 0x25, 0xED, 0xE2, 0xE0, 0x2A, 0x0A, 0x5D, 0x03, 0xC4, 0x1C,
+    0x06, 0xA7, 0x87, 0xAF, 0xFE, 0x0A, 0xEB, 0x4D, 0x86, 0xB6, 0xC8, 0xE7, 0xD2, 0x8C, 0x66, 0x94,
+    0x6E, 0xB0, 0x83, 0x9C, 0xC8, 0x3B, 0xBC, 0xB5, 0x48, 0x73, 0xF1, 0xE5, 0x2C, 0x9D, 0xAA, 0x8E,
+    0x1E, 0xE2, 0xF9, 0x22, 0xF9, 0xFE, 0x8F, 0xA3, 0x99, 0xBA, 0xCF, 0x06, 0x98, 0x3B, 0x91, 0x77,
+    0xEB, 0xBC, 0x88, 0xEA, 0x2F, 0xA3, 0x51, 0xC5, 0x87, 0x3A, 0x9D, 0x14, 0x8B, 0x76, 0xA1, 0xD4,
+    0xE1, 0x4A, 0xBD, 0xA1, 0x19, 0x88, 0xC1, 0x88, 0xE0, 0x3D, 0xA8, 0x6F, 0x3F, 0x26, 0x32, 0x00,
+    0x09, 0xAB, 0x7B, 0xA1, 0x9F, 0x40, 0x55, 0x3D, 0xD0, 0x4F, 0x96, 0x5A, 0x37, 0x05, 0x1C, 0x49,
+    0x14, 0xAA, 0x34, 0x8B, 0x38, 0x20, 0x32, 0x18, 0x25, 0x22, 0x54, 0x0F, 0x50, 0x9B, 0xA2, 0xFA,
+    0x68, 0x0A, 0xCC, 0x50, 0x35, 0x36, 0x2A, 0x36, 0x89, 0xDF, 0xD5, 0xA1, 0x4B, 0x12, 0x96, 0x5A,
+    0xE3, 0x9E, 0xA0, 0x43, 0x20, 0x1D, 0x74, 0x8B, 0xF2, 0xC0, 0x60, 0xA9, 0x1F, 0x6A, 0xF1, 0xAA,
+    0x2E, 0x19, 0x56, 0x82, 0xC9, 0xD2, 0x7F, 0xBB, 0x89, 0x7D, 0x01, 0x57, 0x09, 0xB1, 0x6F, 0x88,
+    0xC8, 0xC1, 0x44, 0x87, 0xAB, 0x41, 0xE8, 0xB5, 0xE2, 0xD3, 0x50, 0x6E, 0xA2, 0x4C, 0x2F, 0x75,
+    0x34, 0xC9, 0x6D, 0xA2, 0x28, 0x8F, 0x8F, 0x5E, 0x07, 0x43, 0x83, 0x08, 0x01, 0xEE, 0x98, 0x32,
+    0xA9, 0xB0, 0x07, 0x50, 0xC9, 0xEB, 0xCB, 0x83, 0x21, 0x77, 0x90, 0xC4, 0xEA, 0x0F, 0xAD, 0x9E,
+    0xAE, 0x95, 0x42, 0x71, 0x50, 0x5A, 0x2A, 0x0A, 0xC5, 0xBD, 0x5C, 0xFD, 0x77, 0xD9, 0x9F, 0x26,
+    0x3D, 0x4B, 0x1E, 0x1E, 0xCE, 0x74, 0x6B, 0xA1, 0xC4, 0x70, 0x86, 0xE2, 0x26, 0xBF, 0x09, 0x94,
+    0x08, 0xDE, 0x02, 0xFD, 0x27, 0x8F, 0xE4, 0x8D, 0x87, 0x52, 0x21, 0xC7, 0x66, 0x45, 0x56, 0x00,
+    0x71, 0x21, 0xD6, 0xE0, 0x13, 0xA1, 0x0E, 0x88, 0x5C, 0x6E, 0x7D, 0x21, 0xFF, 0xBA, 0x1A, 0xBC,
+    0xAC, 0x77, 0x13, 0xE8, 0xDC, 0x91, 0x7A, 0x04, 0x75, 0x70, 0x33, 0xC8, 0x1D, 0xC6, 0x7E, 0x02,
+    0xAA, 0x3A, 0xD4, 0x7A, 0x9A, 0x50, 0x40, 0x9C, 0xC0, 0xC0, 0x41, 0x2C, 0x60, 0x90, 0x5E, 0x27,
+    0x56, 0x16, 0xCE, 0x03, 0x53, 0xD7, 0x92, 0x35, 0x4E, 0x2D, 0x4F, 0x7E, 0x22, 0x59, 0x87, 0x02,
+    0x98, 0xEC, 0xD5, 0x07, 0x48, 0xB6, 0x7C, 0xB2, 0x5E, 0x73, 0x6D, 0xA7, 0x2A, 0x21, 0xF0, 0xF3,
+    0xFF, 0xB0, 0x3D, 0x7D, 0x3F, 0x81, 0x2A, 0xE7, 0xAA, 0xDC, 0xA2, 0x01, 0x8D, 0x1C, 0xEA, 0xB9,
+    0x6F, 0x5C, 0x47, 0xE4, 0x9C, 0x43, 0xCA, 0x47, 0xFE, 0xE9, 0x31, 0x61, 0xD8, 0xAE, 0x89, 0xF2,
+    0xE0, 0xBA, 0x60, 0xA1, 0x9C, 0x96, 0x08, 0xC1, 0x39, 0x08, 0x90, 0x69, 0xA9, 0x37, 0x32, 0xAA,
+    0x88, 0x20, 0xFD, 0x02, 0x96, 0xF6, 0xF0, 0x55, 0x9A, 0x80, 0x02, 0x0C, 0x21, 0x4D, 0x8D, 0xEE,
+    0x49, 0x21, 0x97, 0x1B, 0xC3, 0x95, 0xDF, 0xF8, 0xBA, 0xC0, 0x80, 0x10, 0xB4, 0xCE, 0xBA, 0x8B,
+    0x23, 0xFF, 0xC3, 0xBD, 0x2B, 0xE7, 0xFA, 0xEB, 0x65, 0x4F, 0xB8, 0x52, 0xB1, 0x3F, 0x3E, 0x22,
+    0x93, 0x31, 0x17, 0xE0, 0x97, 0x02, 0xA5, 0x74, 0x17, 0x8F, 0x33, 0x9F, 0x5E, 0x8A, 0x9E, 0x2E,
+    0x2D, 0xCD, 0x98, 0xE2, 0x97, 0xDC, 0xFA, 0xF0, 0xF8, 0xF8, 0xF8, 0x53, 0x34, 0x1E, 0x17, 0xDF,
+    0xE2, 0x2B, 0xE5, 0x30, 0x37, 0x65, 0x43, 0x8B, 0xCC, 0x95, 0xB2, 0x6C, 0x93, 0x05, 0x75, 0x8D,
+    0x8E, 0xF8, 0x1C, 0xDB, 0x39, 0x0E, 0x34, 0xC3, 0x32, 0x34, 0xEC, 0x3D, 0xE6, 0x42, 0xAA, 0x74,
+    0xFB, 0xA6, 0xBF, 0x6F, 0x60, 0x50, 0x9B, 0xDC, 0x4C, 0xC2, 0x4F, 0xFA, 0x8D, 0xA2, 0x47, 0x6B,
+    0x05, 0xC9, 0x6D, 0x6A, 0x13, 0x68, 0xEE, 0xA6, 0x7E, 0xEE, 0xD0, 0x62, 0x43, 0x88, 0x7E, 0xB2,
+    0x09, 0xAD, 0x8A, 0x19, 0x35, 0xDB, 0x64, 0x30, 0x4F, 0xA1, 0xB4, 0xBA, 0xD7, 0x83, 0xD0, 0x1D,
+    0x02, 0x50, 0x33, 0x0C, 0xCD, 0x68, 0x85, 0x88, 0x36, 0x7C, 0x6E, 0x72, 0xC0, 0x1C, 0x25, 0x84,
+    0x1D, 0x52, 0xA9, 0x89, 0x40, 0xF7, 0xD3, 0x33, 0x64, 0xEE, 0xEE, 0x8E, 0xCD, 0x9C, 0xBB, 0xD8,
+    0x3F, 0x58, 0x9C, 0xE4, 0x76, 0xDC, 0x9A, 0xD9, 0xDD, 0x4E, 0x2E, 0x66, 0xF4, 0x7C, 0x75, 0xAF,
+    0x4C, 0x8D, 0x15, 0xCC, 0xEC, 0x74, 0x45, 0xF3, 0xC3, 0xA4, 0x4D, 0x08, 0x7F, 0x75, 0x73, 0xBF,
+    0xC2, 0x4B, 0x0C, 0x63, 0xA0, 0x2B, 0xB4, 0xD0, 0x6C, 0xD1, 0x9B, 0x3A, 0xD8, 0x4D, 0xF5, 0x67,
+    0x8E, 0x97, 0x55, 0x76, 0xFC, 0xEA, 0x02, 0x51, 0xA7, 0xCF, 0x08, 0x14, 0xBA, 0x67, 0xC1, 0xB4,
+    0x00, 0x6D, 0x1D, 0x9F, 0x44, 0x84, 0xD2, 0xE8, 0x7B, 0xE4, 0x76, 0xB6, 0x9C, 0x58, 0x0B, 0x19,
+    0xA2, 0x13, 0x6E, 0x1B, 0xDC, 0x8E, 0xD2, 0x67, 0x80, 0x58, 0xE9, 0xDC, 0xEB, 0x6F, 0x01, 0x59,
+    0x2A, 0xD9, 0x40, 0x94, 0x17, 0xCE, 0x2F, 0x3D, 0xEC, 0xB6, 0x29, 0xE3, 0xA5, 0x4B, 0xB9, 0x9F,
+    0x49, 0x4A, 0x02, 0x91, 0x4D, 0x6A, 0x75, 0x71, 0x51, 0xF5, 0xFB, 0x84, 0x19, 0xA3, 0x5F, 0x6F,
+    0x38, 0x76, 0x73, 0x0F, 0x0B, 0x5D, 0x1E, 0x4A, 0x7B, 0x78, 0x06, 0xAC, 0x8F, 0x01, 0xE6, 0xE0,
+    0x27, 0x37, 0x55, 0xCA, 0xFF, 0xC1, 0x02, 0x06, 0xE9, 0x1D, 0xFC, 0x23, 0x56, 0x20, 0x16, 0xD0,
+    0x81, 0x76, 0xC5, 0xDF, 0x06, 0x28, 0x33, 0x3C, 0xB8, 0xA2, 0x3B, 0xD4, 0x16, 0x8E, 0xF9, 0x79,
+    0x45, 0x3B, 0x15, 0x2B, 0x78, 0x7D, 0xDD, 0x2C, 0xB2, 0xCD, 0x7B, 0x49, 0xF6, 0xC9, 0x17, 0xF6,
+    0x93, 0xA2, 0xC4, 0x64, 0xC2, 0xCA, 0x54, 0x31, 0x44, 0x31, 0x78, 0xC5, 0x6E, 0x65, 0x90, 0xE1,
+    0x82, 0xC6, 0x3B, 0xAC, 0x26, 0x3A, 0x96, 0x50, 0x85, 0x05, 0x2F, 0x23, 0xA2, 0x99, 0x78, 0x55,
+    0x40, 0x06, 0x97, 0x29, 0x8C, 0x01, 0xE3, 0xC0, 0xF5, 0xB0, 0xB4, 0x64, 0x93, 0x5F, 0x2D, 0xC7,
+    0x80, 0x4B, 0x3D, 0x89, 0xE0, 0x36, 0x47, 0xA7, 0x9D, 0x16, 0xA7, 0x25, 0x58, 0xD9, 0x99, 0x5C,
+    0xFE, 0x66, 0x6C, 0x43, 0xC3, 0x0E, 0x94, 0x2B, 0x66, 0xD7, 0x85, 0x84, 0x04, 0xB1, 0x8C, 0xF0,
+    0x9D, 0xA0, 0x98, 0x65, 0x83, 0xFC, 0x5F, 0xEB, 0x4F, 0x7D, 0x55, 0xBD, 0x8E, 0xDD, 0x54, 0x10,
+    0x1E, 0xDB, 0x22, 0x56, 0x70, 0x71, 0x68, 0x48, 0x41, 0xE3, 0x47, 0xF0, 0x1B, 0xE4, 0x9C, 0x25,
+    0x42, 0x94, 0xA4, 0xD8, 0xCB, 0x43, 0xD0, 0xE4, 0x11, 0xCE, 0x95, 0x52, 0x50, 0xC2, 0x1B, 0x6C,
+    0x43, 0x11, 0x6D, 0xB3, 0x2F, 0x90, 0x70, 0x6E, 0xD8, 0x62, 0x0B, 0x8A, 0xF5, 0x4A, 0x44, 0x14,
+    0x29, 0x62, 0x02, 0x15, 0x14, 0xF1, 0xAE, 0x2C, 0xC5, 0xAC, 0x6C, 0x0F, 0xDF, 0x37, 0xBE, 0xBB,
+    0x09, 0x12, 0xC1, 0xF7, 0xFA, 0xD8, 0x9E, 0xF1, 0x99, 0xF9, 0xE6, 0x9B, 0x1F, 0x8B, 0xAC, 0x47,
+    0x36, 0x61, 0xA9, 0xB8, 0xB8, 0x31, 0x89, 0xF8, 0xCE, 0x07, 0x89, 0xC1, 0xEF, 0x44, 0xA5, 0xD9,
+    0x65, 0x8B, 0xD4, 0x5D, 0x3E, 0x8B, 0xEB, 0x8B, 0x49, 0xAA, 0xA1, 0x1A, 0xA5, 0x9C, 0xDC, 0x20,
+    0xC5, 0xDC, 0xF4, 0x92, 0x2F, 0xBE, 0x93, 0x4C, 0x53, 0x2B, 0xA2, 0xBA, 0x13, 0x49, 0xBA, 0x15,
+    0x89, 0x1A, 0x60, 0x43, 0x61, 0xCD, 0x2F, 0x58, 0xEA, 0x99, 0x1E, 0x0E, 0x05, 0xBB, 0xED, 0x9F,
+    0x74, 0xFF, 0xBF, 0x95, 0x50, 0x2B, 0xF2, 0x0D, 0x76, 0x35, 0x1D, 0x70, 0x8C, 0xAA, 0xBA, 0x78,
+    0x2C, 0xDF, 0xE1, 0xFC, 0x1D, 0xE7, 0x48, 0xAB, 0x70, 0x04, 0x74, 0x22, 0x05, 0x0D, 0xD3, 0x97,
+    0xEF, 0x21, 0x00, 0xE6, 0x12, 0x82, 0x8C, 0x82, 0x08, 0x41, 0xFD, 0x2F, 0xC1, 0xB0, 0x7A, 0x2F,
+    0x01, 0x28, 0x53, 0x60, 0x8C, 0xE3, 0x1E, 0x8E, 0x48, 0xFE, 0x03, 0x6E, 0xB1, 0x21, 0xEE, 0xA0,
+    0x82, 0xB3, 0x19, 0x7E, 0xDE, 0xE2, 0x7C, 0xB5, 0x1C, 0x1F, 0xC7, 0x16, 0xB2, 0xAD, 0x94, 0x40,
+    0x5F, 0x8F, 0x66, 0x97, 0xE6, 0x68, 0x96, 0xE6, 0xDF, 0x7F, 0x9C, 0xCD, 0x49, 0x76, 0xFC, 0x3D,
+    0x31, 0x29, 0x42, 0xC2, 0x32, 0xDF, 0x2E, 0x8B, 0x10, 0xF8, 0xBB, 0xE5, 0x9E, 0xBE, 0xD8, 0x3C,
+    0x8C, 0x50, 0x0C, 0xEF, 0x16, 0x03, 0xFA, 0x3F, 0x4B, 0xFB, 0xA1, 0xA5, 0xDB, 0xE7, 0xAE, 0x02,
+    0xF1, 0x20, 0xB3, 0xBA, 0x3E, 0xDE, 0xFE, 0x88, 0xA7, 0x4E, 0x1C, 0xAC, 0xC2, 0xF2, 0x17, 0xBA,
+    0x79, 0xE8, 0x10, 0x20, 0x60, 0xFE, 0xE7, 0xC5, 0x0E, 0xBC, 0xA7, 0x05, 0x81, 0x63, 0x93, 0xF6,
+    0xCD, 0xDF, 0x9B, 0x4D, 0x88, 0xE6, 0x16, 0xBA, 0x92, 0x44, 0xD5, 0xA0, 0x50, 0xA2, 0x39, 0x0C,
+    0x24, 0x32, 0x0D, 0x52, 0x33, 0x4E, 0x60, 0x9F, 0x33, 0x5D, 0xD2, 0x04, 0x6E, 0x9B, 0x11, 0x2C,
+    0xF9, 0x3E, 0xED, 0x24, 0xFE, 0x84, 0x8D, 0x5A, 0x31, 0xA7, 0x28, 0x8E, 0x1A, 0xA2, 0x7B, 0x0A,
+    0x91, 0x2E, 0xD5, 0x5C, 0xC0, 0xFC, 0xE0, 0x34, 0xA4, 0xCE, 0xEF, 0x91, 0x6F, 0x0E, 0x73, 0x1D,
+    0x2A, 0x6D, 0x9B, 0x20, 0xCF, 0x24, 0x1F, 0xA4, 0xBA, 0x90, 0x46, 0xBB, 0xA4, 0xAF, 0x67, 0xF7,
+    0xB2, 0x75, 0x27, 0x72, 0xFF, 0xA9, 0x5C, 0x0F, 0xCD, 0x9B, 0x0B, 0xF5, 0x5F, 0xDA, 0x0E, 0xED,
+    0x1D, 0x19, 0xED, 0x11, 0x71, 0x50, 0xED, 0x1A, 0xC0, 0xF3, 0xC0, 0x3D, 0x97, 0xA0, 0x16, 0x9C,
+    0x24, 0x6D, 0x95, 0x15, 0xA1, 0x95, 0x4E, 0x96, 0x63, 0x3F, 0x46, 0x3D, 0x25, 0x89, 0xB9, 0x9E,
+    0xA1, 0xDE, 0x18, 0x88, 0x43, 0x59, 0x9D, 0xB3, 0x26, 0x25, 0xBE, 0xD5, 0x6B, 0xEA, 0x84, 0xD1,
+    0x2B, 0x75, 0xE4, 0x4D, 0x57, 0x5E, 0x12, 0x6E, 0x5A, 0xD9, 0x2B, 0x47, 0x13, 0xD5, 0x37, 0x3A,
+    0x52, 0xD6, 0xDB, 0x0D, 0x2B, 0x74, 0x77, 0xA3, 0x33, 0x65, 0xA9, 0x56, 0x03, 0x24, 0x4B, 0xF7,
+    0xAF, 0x25, 0x3D, 0x42, 0x75, 0xC1, 0x58, 0xA3, 0x97, 0xF8, 0x81, 0x44, 0x07, 0x78, 0x5A, 0xA2,
+    0x40, 0x60, 0xFC, 0x00, 0xA4, 0xC0, 0x01, 0xBC, 0xD5, 0x60, 0x49, 0x3B, 0xAF, 0x63, 0xA6, 0x7D,
+    0xB1, 0xB7, 0xBB, 0xEF, 0xCB, 0xD5, 0xFF, 0x4E, 0x3E, 0x2C, 0x7A, 0x82, 0x8E, 0xAC, 0xF5, 0xC1,
+    0x24, 0x0D, 0x28, 0x88, 0x5B, 0x51, 0xA7, 0x48, 0x72, 0x39, 0xEA, 0x15, 0x39, 0x3A, 0x57, 0x34,
+    0x72, 0xB6, 0xA4, 0xBF, 0x7A, 0x2B, 0x96, 0x65, 0x85, 0x6E, 0x59, 0xB6, 0xC0, 0x9D, 0x81, 0xDF,
+    0x3F, 0x20, 0xF4, 0x8E, 0x60, 0x15, 0xA4, 0x3A, 0x8D, 0xAF, 0x16, 0xC0, 0x3C, 0x9D, 0x3C, 0x0A,
+    0x7B, 0xF0, 0xCF, 0xB5, 0xF7, 0x4B, 0x31, 0x55, 0x2B, 0xBA, 0x6A, 0x75, 0xFF, 0x54, 0xDE, 0x7B,
+    0x10, 0xB9, 0x93, 0x3A, 0x04, 0x32, 0x22, 0x84, 0xD1, 0xFD, 0x49, 0xCE, 0xD9, 0xD1, 0xE6, 0x9F,
+    0xB5, 0x04, 0xF1, 0xD6, 0xE9, 0x1F, 0xF0, 0xDF, 0xC9, 0xD7, 0xA9, 0x5F, 0xB5, 0xD6, 0x81, 0x87,
+    0x52, 0xCD, 0xCF, 0xB2, 0x74, 0x05, 0xC7, 0x3F, 0x03, 0x23, 0x00, 0xF4, 0x09, 0x50, 0x1F, 0x01,
+    0x46, 0x45, 0x2B, 0x60, 0x30, 0x05, 0xC9, 0x99, 0xD7, 0x4F, 0x24, 0xCE, 0xB9, 0xCE, 0x77, 0xE9,
+    0x1A, 0x51, 0xEE, 0x3E, 0x4B, 0x42, 0xCE, 0x3A, 0xA9, 0x5B, 0xA9, 0xBF, 0x3D, 0xC0, 0x5E, 0x94,
+    0xFF, 0x19, 0xCA, 0x73, 0x09, 0x45, 0x4B, 0x0F, 0x2C, 0x99, 0xB6, 0x52, 0x14, 0x04, 0xBB, 0x10,
+    0xF3, 0x03, 0x02, 0x37, 0xA2, 0x8A, 0x24, 0x76, 0x88, 0x2C, 0xD3, 0xCF, 0x91, 0xA0, 0x72, 0x76,
+    0x80, 0xD8, 0x0C, 0xCC, 0x5A, 0x3A, 0x83, 0xAE, 0x50, 0xE8, 0xC4, 0xCD, 0x4C, 0x9E, 0x37, 0xD6,
+    0x2C, 0xA3, 0x05, 0x73, 0x88, 0x94, 0x33, 0x0D, 0x91, 0xBA, 0xDC, 0xE8, 0xAB, 0x6C, 0xF5, 0xB6,
+    0xAA, 0xDA, 0x76, 0x4B, 0xF6, 0xCC, 0xD5, 0xF7, 0x88, 0x3B, 0xD3, 0xE7, 0x58, 0x4B, 0x05, 0xD1,
+    0xDB, 0x7A, 0xC2, 0xAE, 0x25, 0x31, 0xD3, 0x56, 0x5E, 0xCE, 0x0A, 0xDC, 0x73, 0x4E, 0x88, 0x95,
+    0x67, 0x61, 0xE2, 0x8F, 0x82, 0x6B, 0x53, 0x70, 0x17, 0x2A, 0xEE, 0x74, 0x12, 0x77, 0x36, 0x4A,
+    0x7D, 0x8E, 0xB6, 0x7A, 0x83, 0xA8, 0x90, 0x83, 0x46, 0xD7, 0x01, 0x4B, 0x98, 0x76, 0x45, 0x70,
+    0x1E, 0x10, 0x63, 0x44, 0x7B, 0x7E, 0xA5, 0x92, 0x1E, 0xE8, 0x2F, 0xE9, 0xC0, 0x90, 0xDF, 0xBF,
+    0x39, 0xEF, 0x60, 0xEA, 0x7D, 0x7C, 0x6C, 0x94, 0xA2, 0x47, 0x30, 0xC5, 0x49, 0x0A, 0x2F, 0x48,
+    0x06, 0x2E, 0x9C, 0x2A, 0x1C, 0xED, 0xB0, 0xEE, 0x06, 0xF4, 0x56, 0x40, 0x0F, 0x4F, 0x0D, 0x53,
+    0x77, 0xC9, 0x1A, 0xE0, 0x85, 0x80, 0x9B, 0xCB, 0x85, 0x54, 0x34, 0x6B, 0x9B, 0x34, 0x6B, 0x1F,
+    0xF8, 0xF5, 0xC9, 0xAF, 0xED, 0xE4, 0xAF, 0x66, 0x65, 0xF1, 0x5D, 0x61, 0xD0, 0x07, 0x5E, 0x1A,
+    0x28, 0xE3, 0xE5, 0x13, 0x07, 0x25, 0x06, 0x68, 0x01, 0x25, 0xC7, 0x35, 0xB8, 0x60, 0x19, 0x44,
+    0xF4, 0x7D, 0x47, 0x56, 0x47, 0xB9, 0x3D, 0x3E, 0x15, 0x87, 0x81, 0x12, 0x1C, 0x3F, 0x42, 0x6E,
+    0x8B, 0x8F, 0x44, 0xBD, 0xC5, 0xA7, 0xA7, 0x3E, 0xC2, 0xD0, 0xAE, 0x8F, 0x3C, 0x28, 0x38, 0x4A,
+    0xE4, 0x40, 0x65, 0x5D, 0xAC, 0xA4, 0xFD, 0x09, 0x8C, 0xFA, 0x47, 0xCD, 0x24, 0x3E, 0x38, 0x24,
+    0x3C, 0x14, 0xBA, 0x8D, 0x01, 0x51, 0xC5, 0x20, 0x69, 0xCC, 0xC1, 0xC9, 0x80, 0x64, 0x50, 0xA3,
+    0x57, 0xDA, 0x82, 0x7D, 0x7C, 0x10, 0x0A, 0x74, 0x0B, 0xB6, 0xFF, 0xC6, 0x1A, 0x58, 0x18, 0x64,
+    0x7C, 0x09, 0xC4, 0xD5, 0xCC, 0x3E, 0xE0, 0x47, 0x8A, 0xA9, 0x0D, 0xFB, 0xE4, 0x3B, 0xC6, 0x44,
+    0xD0, 0xBC, 0x1D, 0xAC, 0x69, 0x5A, 0xEB, 0x7F, 0x4E, 0x20, 0x32, 0xDD, 0x30, 0xA1, 0xB9, 0x9E,
+    0xE0, 0x65, 0x3F, 0x26, 0xDD, 0x15, 0xFA, 0x58, 0x59, 0x78, 0x68, 0x7A, 0x42, 0x41, 0x13, 0x8D,
+    0xB6, 0xC7, 0x73, 0xBC, 0xB8, 0xB5, 0x9C, 0x26, 0xAB, 0x18, 0x04, 0x9C, 0x5E, 0x84, 0x55, 0x88,
+    0x76, 0x66, 0x47, 0xAE, 0x83, 0x8A, 0x45, 0xD1, 0x74, 0x1B, 0x40, 0x1A, 0xF0, 0x99, 0xCD, 0xE7,
+    0x48, 0x5C, 0x64, 0xCB, 0xAF, 0x88, 0xCC, 0x08, 0x5B, 0xD7, 0xB0, 0xD9, 0xAC, 0xE1, 0x9C, 0xA4,
+    0x65, 0xBC, 0xA4, 0x09, 0xB7, 0xF1, 0x57, 0xBC, 0x55, 0x0F, 0x49, 0x11, 0x21, 0x36, 0xE4, 0xBA,
+    0xB5, 0x90, 0x44, 0xFE, 0x01, 0xAD, 0x55, 0x2F, 0x8F, 0xD5, 0x40, 0x10, 0x9F, 0xD7, 0xE6, 0x58,
+    0x51, 0xB1, 0xEA, 0x0C, 0xA6, 0x1E, 0xD3, 0x8F, 0xB0, 0x0D, 0x27, 0x31, 0x08, 0x1E, 0x08, 0x04,
+    0x1F, 0x01, 0x8B, 0xDB, 0x26, 0x08, 0x2C, 0x86, 0x6F, 0x80, 0x41, 0x9D, 0x41, 0xB3, 0x25, 0x7C,
+    0x81, 0x0A, 0x50, 0x08, 0x4A, 0x02, 0x21, 0x01, 0xB3, 0x81, 0x25, 0xE9, 0x23, 0x6D, 0x87, 0xDF,
+    0x4C, 0x7B, 0xF0, 0x78, 0x77, 0x5C, 0x10, 0x34, 0x6F, 0xE6, 0x37, 0xBB, 0xF3, 0xB6, 0x33, 0x3B,
+    0xFF, 0xCA, 0xCC, 0x14, 0x92, 0x65, 0x8E, 0x96, 0x89, 0x99, 0x33, 0xEE, 0x8E, 0xB6, 0x3E, 0xFA,
+    0x81, 0x28, 0x9F, 0xB1, 0x45, 0xE4, 0xDE, 0x73, 0x47, 0x64, 0x66, 0x37, 0x62, 0xE1, 0xDF, 0x72,
+    0x4D, 0x54, 0x4C, 0xDC, 0x63, 0x11, 0x58, 0xB6, 0x0A, 0x96, 0x2D, 0x9C, 0x8D, 0xE0, 0x96, 0x27,
+    0xD2, 0x45, 0xA3, 0x8B, 0x04, 0xBE, 0x61, 0x39, 0x4F, 0xA5, 0xFE, 0x0D, 0x8B, 0x19, 0x8B, 0x8A,
+    0x19, 0x06, 0x32, 0x3E, 0x95, 0x43, 0x6E, 0x08, 0xDC, 0x52, 0xCE, 0x0F, 0xE1, 0x0A, 0x16, 0x16,
+    0x6F, 0xCD, 0xB9, 0xF1, 0x38, 0xEC, 0x06, 0x39, 0xCC, 0x7C, 0x32, 0x5A, 0x8E, 0xBE, 0xD9, 0x06,
+    0x1B, 0xC9, 0x7C, 0x85, 0x05, 0xEF, 0x5A, 0x2A, 0xBE, 0xE0, 0x6C, 0x98, 0xC5, 0x4C, 0x0B, 0x8B,
+    0x49, 0x04, 0x3A, 0x13, 0x7A, 0xB1, 0xD4, 0x50, 0xF9, 0x6E, 0xA6, 0x6C, 0x84, 0xE7, 0xD5, 0x4B,
+    0x8E, 0xD9, 0x58, 0x70, 0xEB, 0x22, 0x34, 0x8D, 0x4B, 0xE0, 0xED, 0x3F, 0xF1, 0x01, 0x6E, 0xFE,
+    0x9D, 0x4F, 0xDB, 0x3B, 0xDC, 0x39, 0xC4, 0xED, 0x22, 0xEE, 0x7F, 0xF3, 0xDE, 0xCB, 0xA5, 0xF6,
+    0xF9, 0xA0, 0x7C, 0x5C, 0xB8, 0xC4, 0x2C, 0x3B, 0xC7, 0x37, 0xB7, 0x5C, 0x9D, 0xA7, 0x7D, 0xF2,
+    0xB5, 0x11, 0x1A, 0x7C, 0xB3, 0x47, 0x88, 0xE5, 0x4A, 0xA3, 0x50, 0x78, 0x73, 0x77, 0x0C, 0x6D,
+    0x21, 0xC4, 0x42, 0x12, 0xEE, 0x95, 0x8E, 0xAB, 0x24, 0xB9, 0x61, 0x3E, 0x87, 0xC8, 0x06, 0x7F,
+    0xDC, 0x6E, 0x15, 0x11, 0x4D, 0xE0, 0x46, 0xD0, 0x5D, 0x86, 0xC8, 0x2A, 0x22, 0x7B, 0x31, 0x4E,
+    0xDB, 0xDB, 0x8A, 0x1A, 0x81, 0x15, 0xFB, 0x7F, 0xC0, 0x11, 0x51, 0x5D, 0x30, 0xD7, 0xD2, 0x38,
+    0xC3, 0x69, 0x41, 0x7F, 0x86, 0x64, 0x98, 0x3F, 0x45, 0xF2, 0x3C, 0x43, 0xDC, 0x6D, 0xEF, 0x24,
+    0xF2, 0x35, 0x49, 0x74, 0xC8, 0xAC, 0x62, 0xA1, 0x62, 0xA8, 0xF1, 0x83, 0x88, 0x22, 0x45, 0x39,
+    0x04, 0x29, 0xBB, 0x7D, 0x71, 0xDA, 0x8A, 0xD8, 0x58, 0x88, 0xA3, 0x5C, 0x3C, 0xB4, 0x56, 0x23,
+    0xAF, 0xCF, 0x66, 0x75, 0xCA, 0xB0, 0x9E, 0x90, 0x0A, 0xD6, 0xE2, 0x95, 0x84, 0x8E, 0xA2, 0x7E,
+    0x72, 0x5B, 0x7C, 0x31, 0x13, 0xFE, 0x81, 0x98, 0x94, 0x09, 0xFF, 0x10, 0x75, 0x47, 0x41, 0xD5,
+    0x75, 0xB6, 0xAA, 0x8B, 0x55, 0x5D, 0xF1, 0xE9, 0x4E, 0xD5, 0x78, 0x8F, 0xAA, 0xF1, 0xA8, 0x9A,
+    0xC3, 0xAC, 0x6A, 0x58, 0x5F, 0x4E, 0xDB, 0x1D, 0x37, 0x72, 0xBA, 0xFA, 0x34, 0xEB, 0x69, 0xFF,
+    0x6E, 0x80, 0x1A, 0xEF, 0xF4, 0xBD, 0xA8, 0x8B, 0x45, 0x7D, 0x14, 0x16, 0xB5, 0xE3, 0x7B, 0xAA,
+    0x46, 0xFE, 0x7B, 0xB0, 0x9C, 0x5F, 0x72, 0x93, 0x73, 0xB2, 0x89, 0x0E, 0x1E, 0x18, 0x96, 0x26,
+    0x3C, 0x80, 0x36, 0xBF, 0x18, 0x1A, 0x01, 0x23, 0xE0, 0xBB, 0xCB, 0x01, 0xA1, 0x54, 0xE0, 0x7A,
+    0x81, 0xEE, 0xB8, 0x36, 0x3C, 0xEB, 0xED, 0xB9, 0x96, 0x9A, 0x32, 0xB3, 0x04, 0x58, 0x62, 0x91,
+    0x0B, 0x8C, 0x07, 0x60, 0x14, 0x36, 0xF7, 0x46, 0x19, 0x2D, 0xB9, 0x8C, 0x06, 0x01, 0xB8, 0x5F,
+    0xCC, 0xB9, 0x64, 0x00, 0x30, 0xD7, 0x07, 0x77, 0xD9, 0x04, 0x19, 0x31, 0x08, 0x79, 0xB3, 0xDC,
+    0xAC, 0xF1, 0x1F, 0x50, 0x3B, 0xFC, 0x08, 0x4E, 0xC0, 0x85, 0x53, 0x46, 0x30, 0xB9, 0xC1, 0x15,
+    0xFB, 0x72, 0x42, 0xC3, 0x97, 0xD1, 0xA5, 0x6C, 0x26, 0x1B, 0x5D, 0x84, 0x4D, 0x1B, 0xE1, 0xA7,
+    0x00, 0xFA, 0x03, 0x91, 0x5B, 0xC0, 0xF5, 0xD2, 0x35, 0xA8, 0x82, 0xD0, 0x15, 0x23, 0x7A, 0xDB,
+    0xF7, 0x66, 0x2A, 0xF8, 0xA6, 0x8F, 0x86, 0x3D, 0x47, 0x87, 0xB0, 0xE2, 0x9E, 0x15, 0x5F, 0x97,
+    0xEC, 0x5B, 0x49, 0x1D, 0xCF, 0x85, 0xC2, 0xA4, 0x89, 0x84, 0x9F, 0x7E, 0x29, 0x90, 0x2B, 0xBC,
+    0x3B, 0x3A, 0xE7, 0xAC, 0x4E, 0x45, 0x99, 0x90, 0x8E, 0x11, 0x0C, 0xCB, 0xDF, 0x18, 0x6E, 0x61,
+    0xB4, 0x45, 0xD7, 0x57, 0xAD, 0x37, 0xA3, 0x89, 0x59, 0x0A, 0xF5, 0x0B, 0x72, 0x37, 0xA2, 0xED,
+    0xF2, 0xC8, 0x34, 0x11, 0xA6, 0x9D, 0xED, 0xCB, 0x1E, 0x79, 0x35, 0x63, 0x91, 0xEC, 0x77, 0x4E,
+    0xBE, 0xC5, 0x85, 0x5E, 0xF1, 0x09, 0x6C, 0x56, 0x6A, 0x52, 0x58, 0x12, 0xF3, 0x1F, 0x60, 0xF5,
+    0xF1, 0x6F, 0x7B, 0xF7, 0xF9, 0xA9, 0xD6, 0x69, 0x2B, 0x9D, 0x85, 0x8B, 0x4A, 0x01, 0x8B, 0xFF,
+    0x68, 0x08, 0xFE, 0x7C, 0x5A, 0x5B, 0xE9, 0xC9, 0x6C, 0x71, 0x47, 0xEA, 0x5D, 0x13, 0x89, 0xCF,
+    0x00, 0xAD, 0x33, 0x94, 0xD6, 0x59, 0xAE, 0x4D, 0x10, 0x35, 0xCA, 0xBA, 0x3B, 0xE8, 0x6E, 0xA7,
+    0x03, 0xFE, 0xF5, 0xD1, 0x73, 0xBD, 0x7E, 0x2D, 0xBD, 0x9B, 0x72, 0x15, 0xA5, 0x43, 0x06, 0xAD,
+    0xAB, 0x26, 0x53, 0xD1, 0x68, 0xE7, 0x54, 0xCB, 0x69, 0xF9, 0x64, 0x94, 0xF2, 0x79, 0xC8, 0x7E,
+    0x25, 0xF3, 0xFE, 0x0E, 0xAF, 0x96, 0x21, 0xDF, 0xC3, 0xC5, 0x26, 0x74, 0x94, 0x43, 0x5F, 0x4A,
+    0x83, 0xB7, 0xF0, 0x8F, 0xB4, 0x68, 0xD0, 0x19, 0x84, 0xA9, 0x8D, 0xC1, 0xFE, 0x60, 0xB3, 0xDC,
+    0x36, 0xC1, 0x70, 0x3C, 0x0E, 0xE8, 0x25, 0x1D, 0xC2, 0x84, 0xE4, 0xA9, 0x51, 0xFE, 0xA2, 0x59,
+    0x39, 0x14, 0x7B, 0x54, 0x93, 0xD6, 0x88, 0x38, 0xBE, 0x8A, 0xE2, 0x4B, 0x31, 0x1F, 0x88, 0xEA,
+    0xA1, 0x3D, 0x27, 0xC6, 0x0B, 0xC2, 0xF2, 0x87, 0xF8, 0xA3, 0x16, 0x71, 0xF8, 0xF5, 0xDD, 0xCB,
+    0x45, 0x24, 0xF7, 0x87, 0x88, 0x28, 0xCD, 0x67, 0x74, 0xED, 0xEE, 0xF7, 0x67, 0x54, 0xE0, 0x05,
+    0x97, 0x91, 0xDD, 0x27, 0x5E, 0x6D, 0x95, 0x2B, 0x5D, 0xA5, 0xFF, 0xF5, 0xFC, 0x04, 0xCD, 0x54,
+    0xB1, 0x8E, 0xDC, 0x36, 0x10, 0x1D, 0x89, 0x30, 0x54, 0xA8, 0x60, 0x75, 0xCD, 0x35, 0x6A, 0x93,
+    0x4A, 0x7F, 0x60, 0x2A, 0xB9, 0xC2, 0xE5, 0xB9, 0xB8, 0x45, 0x0A, 0xFF, 0x41, 0x1A, 0xFF, 0xC0,
+    0x25, 0x54, 0x90, 0x22, 0xA5, 0xAF, 0x49, 0x95, 0x22, 0x4D, 0x02, 0x24, 0xF7, 0x0F, 0x36, 0x09,
+    0xB8, 0xD8, 0x76, 0x81, 0x7C, 0xC0, 0x2D, 0x10, 0x03, 0x2E, 0x4D, 0x1F, 0x54, 0xC8, 0x08, 0xA5,
+    0xC9, 0x9B, 0xA1, 0x0E, 0xB6, 0x13, 0x3B, 0x40, 0x52, 0x65, 0xB1, 0x1C, 0x8D, 0x48, 0x71, 0x86,
+    0xEF, 0xCD, 0xE3, 0xB8, 0x44, 0xE4, 0xA6, 0x70, 0xA4, 0x8A, 0x23, 0x1F, 0xC8, 0x2E, 0x35, 0x47,
+    0xF2, 0xC9, 0xF0, 0x60, 0x78, 0x6C, 0x99, 0xBA, 0x4C, 0xDD, 0x42, 0x7C, 0x24, 0x97, 0x1B, 0x26,
+    0xF2, 0x93, 0x9B, 0x89, 0xF8, 0x35, 0x3E, 0xAA, 0xF8, 0x66, 0x25, 0x32, 0xCC, 0x13, 0x51, 0xCB,
+    0x98, 0x20, 0xCB, 0x0B, 0x11, 0xF5, 0x8C, 0x90, 0xE4, 0x78, 0x80, 0x0D, 0x19, 0xA6, 0xC2, 0x6E,
+    0xA2, 0x86, 0x47, 0x59, 0xC4, 0x16, 0x4C, 0x23, 0x06, 0xD5, 0xFA, 0x9D, 0x95, 0x8D, 0xF8, 0x5A,
+    0xA6, 0x19, 0x5F, 0xBB, 0x23, 0xF9, 0xDF, 0x98, 0xDA, 0xDC, 0x4D, 0xC4, 0x23, 0x8F, 0xDD, 0xD4,
+    0xE6, 0x9A, 0xC9, 0x1F, 0xDC, 0xD1, 0xAC, 0xCD, 0x42, 0x7D, 0xE2, 0x58, 0xF1, 0xF9, 0x8C, 0x93,
+    0x62, 0x4F, 0x40, 0x8C, 0x46, 0xB2, 0x3A, 0x84, 0xA9, 0x65, 0xBF, 0x95, 0xBC, 0x12, 0xB9, 0x95,
+    0x90, 0xE1, 0x83, 0xCE, 0xBD, 0x1D, 0x36, 0x14, 0xDC, 0xE9, 0x1F, 0x70, 0xDB, 0xBF, 0xE3, 0xBE,
+    0x55, 0xDC, 0xAF, 0x0A, 0xEE, 0x24, 0xA0, 0x80, 0xEA, 0xE4, 0x31, 0xAF, 0x17, 0x38, 0x0A, 0x98,
+    0xA8, 0x61, 0xF8, 0xD0, 0x8A, 0x1D, 0xFE, 0x1D, 0x6E, 0x3B, 0x53, 0x37, 0xE1, 0x50, 0x21, 0xFA,
+    0x83, 0x59, 0x49, 0x80, 0x03, 0x76, 0x88, 0xCD, 0x82, 0x37, 0x3B, 0x83, 0x0D, 0x41, 0x0E, 0x6E,
+    0x10, 0x88, 0x6F, 0x12, 0xA2, 0xE0, 0x4D, 0xA1, 0x5B, 0x89, 0xD7, 0x83, 0x95, 0x5D, 0x58, 0x77,
+    0xE7, 0x92, 0xDA, 0x61, 0x64, 0x71, 0x12, 0xF5, 0x79, 0xC3, 0x2C, 0xF0, 0x0A, 0x03, 0x27, 0x17,
+    0x24, 0xE8, 0x90, 0xCE, 0x0A, 0x71, 0x80, 0x8C, 0x88, 0xB1, 0x96, 0xFF, 0x08, 0xC0, 0x05, 0xAD,
+    0x2E, 0x65, 0xC1, 0x6C, 0xD7, 0xC2, 0x9D, 0x80, 0x31, 0x5A, 0xE6, 0x8A, 0xB5, 0xB6, 0xAC, 0x90,
+    0x7C, 0x56, 0x60, 0x4C, 0x77, 0xF3, 0x66, 0x93, 0x42, 0x39, 0x95, 0x88, 0xC3, 0x2D, 0x22, 0x03,
+    0xCE, 0x00, 0x0B, 0xEC, 0x3D, 0x8F, 0x0D, 0x1F, 0x01, 0x1F, 0xFF, 0x56, 0x5E, 0x87, 0x96, 0x67,
+    0x8F, 0x8A, 0x0B, 0x0B, 0xD4, 0x0A, 0x37, 0x1F, 0xB0, 0xC2, 0xD8, 0x81, 0x7C, 0x95, 0xC9, 0x0D,
+    0x2E, 0xF6, 0xD1, 0xCC, 0x5D, 0xA4, 0x70, 0x7E, 0x54, 0xF4, 0x95, 0x66, 0xC1, 0x59, 0x9B, 0x2C,
+    0x40, 0xC7, 0x32, 0xC1, 0x82, 0x0B, 0x67, 0x0F, 0xFB, 0x05, 0xF2, 0x09, 0xD1, 0xA5, 0x2E, 0xF7,
+    0x49, 0xCA, 0x51, 0x49, 0xC8, 0x4B, 0x8C, 0x8E, 0x84, 0xAA, 0xB3, 0x8C, 0x6F, 0x79, 0xB1, 0x60,
+    0x02, 0xE7, 0x75, 0x38, 0x18, 0x6A, 0x88, 0xCD, 0x20, 0xDE, 0x94, 0xCA, 0xD8, 0xA4, 0xC2, 0x74,
+    0x00, 0x26, 0x1C, 0xFD, 0xE7, 0x25, 0xDE, 0x7D, 0xB1, 0x3C, 0x14, 0x6E, 0x84, 0x4D, 0x49, 0x2D,
+    0xF3, 0xF8, 0xAD, 0xC2, 0x1A, 0xF3, 0x7C, 0xB7, 0xA4, 0xA2, 0x10, 0xD9, 0x48, 0x34, 0xC5, 0x3E,
+    0xEB, 0xC3, 0xBD, 0xBB, 0x44, 0x74, 0x7D, 0xFD, 0xCB, 0x89, 0xE8, 0x30, 0x63, 0xDB, 0x73, 0xD4,
+    0x7A, 0xB4, 0x91, 0x9E, 0x91, 0xA3, 0x7A, 0xA6, 0x4C, 0xED, 0xD1, 0x7C, 0x7C, 0x2A, 0x6C, 0x5A,
+    0x55, 0xA9, 0x0E, 0x28, 0x93, 0x5C, 0x5C, 0x33, 0x15, 0x96, 0x91, 0x47, 0xEA, 0xFB, 0xEB, 0xC9,
+    0x40, 0xBB, 0x01, 0x9D, 0x81, 0xA3, 0x57, 0x73, 0xB8, 0x33, 0xEE, 0x00, 0x61, 0x02, 0xD6, 0x5F,
+    0x0C, 0xC7, 0xFE, 0x80, 0xDB, 0xD4, 0x81, 0x63, 0xE5, 0x30, 0x4A, 0xF0, 0x28, 0x69, 0x22, 0x9D,
+    0xFE, 0xAC, 0x7A, 0xFF, 0xA8, 0x09, 0x6A, 0x96, 0xF7, 0x8C, 0xD7, 0x43, 0xBD, 0x6F, 0xDA, 0xD4,
+    0xA6, 0x40, 0xBE, 0x4D, 0x4D, 0xF2, 0xE4, 0x1A, 0x00, 0xBA, 0x4F, 0xCE, 0x1C, 0x9B, 0xE4, 0x3E,
+    0x63, 0x64, 0x4A, 0xC8, 0x4B, 0xA7, 0x3F, 0x80, 0x78, 0x0F, 0x35, 0x94, 0x87, 0x79, 0xA3, 0xB7,
+    0x5D, 0x64, 0xEE, 0xDE, 0x2E, 0x08, 0x48, 0x93, 0x75, 0x50, 0x19, 0x1E, 0xE3, 0x6B, 0x8C, 0xAF,
+    0x9C, 0xC9, 0x4F, 0x75, 0x34, 0x39, 0x38, 0x9B, 0x03, 0xFB, 0xEC, 0x59, 0xE4, 0xCB, 0xB9, 0xE3,
+    0x35, 0x1B, 0x7E, 0x9D, 0xC9, 0x7F, 0x0E, 0x25, 0xD6, 0x32, 0x16, 0x1D, 0x54, 0xC6, 0xA7, 0xF4,
+    0xD3, 0x64, 0x7E, 0x8F, 0xF6, 0x09, 0xDD, 0xBF, 0x7C, 0xF8, 0xE6, 0xE5, 0xFE, 0xE5, 0x4D, 0xFF,
+    0xE3, 0xB2, 0x3A, 0x9E, 0x03, 0x1F, 0xFD, 0x93, 0xF1, 0xD2, 0x55, 0x29, 0x57, 0x67, 0x89, 0xAC,
+    0xF0, 0xA5, 0x3A, 0x51, 0x79, 0x28, 0x34, 0xB0, 0xFA, 0x8E, 0xB3, 0x6E, 0xE5, 0x2E, 0xCE, 0x1F,
+    0x7C, 0xD5, 0x88, 0x5A, 0x70, 0x8E, 0xA5, 0xE1, 0x95, 0x93, 0x47, 0x77, 0x6C, 0x56, 0x6A, 0x27,
+    0x14, 0x24, 0x3C, 0x58, 0xA8, 0x9D, 0x3D, 0xAA, 0xF0, 0x1D, 0x9C, 0x2C, 0x33, 0x90, 0xBC, 0xCD,
+    0x52, 0xB5, 0xFD, 0x2A, 0x4E, 0x02, 0xC9, 0x56, 0xAA, 0x2B, 0x17, 0xF4, 0xAD, 0x23, 0x34, 0xC8,
+    0xC5, 0x15, 0xA7, 0x12, 0xA7, 0xBB, 0xE5, 0xAB, 0x4A, 0xF2, 0x74, 0xC8, 0x53, 0x4B, 0x1E, 0xF4,
+    0x0F, 0xF0, 0x4A, 0x8D, 0xB4, 0x26, 0x77, 0xC6, 0x64, 0x66, 0x71, 0xBE, 0xC5, 0x8C, 0x38, 0xFE,
+    0xB9, 0x74, 0x6A, 0x38, 0xBC, 0xE7, 0x2D, 0xCF, 0x9E, 0x87, 0x2E, 0x87, 0x49, 0xDB, 0x0D, 0xA2,
+    0x7E, 0x39, 0xA8, 0x52, 0x1B, 0xDE, 0x74, 0xAC, 0x0D, 0x01, 0x89, 0x98, 0xB9, 0xBC, 0x0F, 0x3E,
+    0x59, 0x28, 0x13, 0x37, 0x60, 0x41, 0x85, 0x0C, 0xA3, 0x8B, 0x45, 0x2E, 0xBF, 0xE4, 0xCA, 0x73,
+    0x6D, 0xB7, 0x89, 0x31, 0x6C, 0x0B, 0x74, 0xEF, 0x11, 0xF3, 0xF5, 0x85, 0xF6, 0x9C, 0x58, 0xEE,
+    0x82, 0xDB, 0xDA, 0x84, 0xE5, 0xF2, 0x34, 0x92, 0xE8, 0x13, 0x6D, 0x4D, 0x2F, 0xAA, 0x67, 0x25,
+    0xB5, 0x5C, 0x37, 0xAA, 0xEF, 0xAE, 0x98, 0xD3, 0x1B, 0x57, 0x26, 0xD6, 0xED, 0x50, 0x8B, 0xEE,
+    0x7D, 0xBC, 0x5E, 0xC9, 0xA3, 0x7F, 0x21, 0x82, 0xD3, 0x6F, 0xF8, 0xD5, 0x7C, 0x3A, 0xB6, 0x93,
+    0x99, 0x02, 0xB9, 0x6F, 0x1E, 0xDD, 0xEA, 0x29, 0xF6, 0x6A, 0x1F, 0x88, 0xC1, 0x36, 0xDE, 0xD1,
+    0x56, 0x50, 0x30, 0x42, 0x95, 0x44, 0xFB, 0xFE, 0xA9, 0x26, 0x99, 0xD4, 0x1E, 0xB4, 0x1B, 0x62,
+    0xF5, 0x94, 0xAF, 0xE8, 0x7F, 0xF4, 0xFB, 0x13, 0xCD, 0x55, 0xBD, 0xAE, 0x15, 0x37, 0x10, 0x1E,
+    0xEF, 0xEA, 0x66, 0xA5, 0x6C, 0xB1, 0x55, 0x9A, 0x24, 0xD2, 0x3E, 0xC2, 0x3E, 0xC2, 0x2E, 0xB4,
+    0x14, 0x34, 0x5C, 0x6E, 0x49, 0x9F, 0x86, 0x27, 0x88, 0xF6, 0xDC, 0x34, 0x29, 0x43, 0x43, 0x4F,
+    0x09, 0x34, 0x79, 0x02, 0xB0, 0x49, 0x8A, 0x14, 0xB7, 0x60, 0x25, 0x94, 0x3A, 0x47, 0x0A, 0x12,
+    0x52, 0x1A, 0x0C, 0x5A, 0x84, 0x43, 0xEC, 0xFD, 0x98, 0x19, 0xFB, 0xDC, 0x9B, 0x8B, 0x42, 0x1A,
+    0x14, 0x29, 0xF6, 0xF1, 0x8C, 0xE5, 0x73, 0x3C, 0xFE, 0xE6, 0x9B, 0x9F, 0x43, 0x44, 0x64, 0x1E,
+    0x4E, 0x24, 0x63, 0xC0, 0x2A, 0xAA, 0x02, 0x36, 0xD1, 0x2D, 0x80, 0x9D, 0x1C, 0x6F, 0xC6, 0x2E,
+    0x76, 0x4F, 0xA3, 0xA7, 0xDE, 0xB3, 0xB6, 0xFB, 0xE3, 0x5B, 0xAB, 0x85, 0x8E, 0x30, 0x67, 0x1D,
+    0xC7, 0xA2, 0xBB, 0xAC, 0x13, 0x99, 0x13, 0xE0, 0x8F, 0x63, 0xBE, 0x5E, 0x23, 0x5B, 0xAF, 0xD4,
+    0x98, 0xE8, 0x45, 0xB5, 0x41, 0x20, 0xFA, 0x9A, 0x37, 0xC0, 0x1D, 0x13, 0x59, 0x8B, 0x49, 0xD1,
+    0x63, 0xD1, 0x7D, 0xD1, 0x4D, 0xD1, 0xFC, 0x43, 0x3C, 0xCF, 0xC0, 0xFE, 0x54, 0x0B, 0x64, 0xE9,
+    0xDF, 0xF5, 0x37, 0xD9, 0xAD, 0xE7, 0x7A, 0x27, 0x3F, 0x11, 0xBF, 0xDC, 0x35, 0xA1, 0x0A, 0x96,
+    0xC6, 0x27, 0x27, 0xAF, 0x15, 0xEA, 0x33, 0x95, 0xDF, 0x8B, 0x60, 0xB7, 0x71, 0x57, 0x20, 0xEA,
+    0x73, 0x6D, 0x24, 0x33, 0x31, 0x8A, 0xBB, 0x8F, 0x85, 0x1A, 0x41, 0xCB, 0xC8, 0xF6, 0x2A, 0xD9,
+    0xA3, 0xAF, 0x70, 0x47, 0xB0, 0xA9, 0x2F, 0xBD, 0x7A, 0xF8, 0x2D, 0x7F, 0xE5, 0x2F, 0xE6, 0xF0,
+    0xE1, 0x5C, 0x75, 0x86, 0x31, 0xCF, 0x98, 0x27, 0x5D, 0x8C, 0x3A, 0x16, 0xE0, 0xF5, 0x76, 0x13,
+    0x85, 0x2A, 0x26, 0x92, 0xB2, 0xEB, 0x21, 0x6F, 0x66, 0x41, 0x20, 0xE3, 0xB3, 0x07, 0xF4, 0xE9,
+    0xC3, 0x60, 0xDF, 0xC9, 0x87, 0x1F, 0xF0, 0x1D, 0x16, 0x81, 0x33, 0x72, 0x08, 0x97, 0x99, 0x5F,
+    0x1B, 0x52, 0x07, 0x07, 0x4F, 0xD4, 0xA1, 0xC5, 0x13, 0x09, 0x5A, 0x83, 0x6B, 0xF8, 0x19, 0x4E,
+    0x42, 0xFA, 0x0B, 0xCE, 0x14, 0x22, 0x5E, 0xE0, 0xA9, 0x26, 0x8B, 0x7D, 0x8B, 0x1F, 0xD5, 0x19,
+    0x89, 0x9E, 0xA6, 0x91, 0x84, 0xCF, 0xCB, 0x46, 0x52, 0xC2, 0xA9, 0x5F, 0x25, 0xA1, 0xC4, 0x2F,
+    0x94, 0xF7, 0xCB, 0xA6, 0x39, 0x7C, 0x75, 0x7E, 0xEB, 0x90, 0x0D, 0x95, 0x86, 0xA7, 0xA4, 0x23,
+    0x04, 0xC6, 0x88, 0xB7, 0xF8, 0x4D, 0xDE, 0x00, 0x83, 0x38, 0x63, 0x86, 0xD8, 0x6E, 0x8B, 0x9F,
+    0xD8, 0x40, 0x8F, 0xD4, 0x32, 0x66, 0xEC, 0x67, 0x04, 0x71, 0xE7, 0x40, 0x5A, 0x66, 0x6E, 0xEA,
+    0x94, 0xBA, 0x26, 0x9D, 0x64, 0x52, 0xC7, 0x02, 0xAB, 0x2A, 0x80, 0xF9, 0x85, 0xF4, 0x89, 0xDC,
+    0x76, 0xC9, 0xC0, 0xB7, 0x4C, 0x88, 0xF5, 0x3D, 0x0C, 0x83, 0xAD, 0x71, 0x0A, 0x2F, 0xB4, 0xF6,
+    0x49, 0x68, 0x14, 0xBF, 0x3C, 0xBC, 0x78, 0x51, 0xE3, 0x87, 0x6D, 0x0C, 0x7A, 0xC7, 0xBE, 0x50,
+    0x12, 0xEC, 0x5F, 0x9B, 0x96, 0x86, 0xD0, 0x14, 0x0E, 0xC4, 0x95, 0xA0, 0xE7, 0x9A, 0xA9, 0x0F,
+    0x69, 0x30, 0x14, 0xB6, 0xBA, 0x52, 0xAA, 0xCD, 0xDF, 0xC9, 0x5A, 0x0B, 0x7B, 0x39, 0x57, 0x5F,
+    0xC2, 0xB2, 0x9B, 0x3D, 0xDE, 0xF0, 0xC4, 0xC4, 0x2E, 0x0E, 0x1C, 0xC5, 0xC4, 0x96, 0xAE, 0x22,
+    0x0C, 0x08, 0xE6, 0x86, 0x39, 0x9E, 0x3A, 0xDF, 0x25, 0x9A, 0x9D, 0xF5, 0x06, 0x35, 0xA8, 0x89,
+    0x8C, 0x6B, 0x78, 0xC5, 0xB7, 0xEC, 0xD3, 0x44, 0xD5, 0x36, 0x7B, 0x79, 0x47, 0x6C, 0x05, 0xE1,
+    0xDC, 0x31, 0x8C, 0x24, 0x4F, 0x07, 0x05, 0xB6, 0x93, 0x18, 0x2E, 0xCD, 0x76, 0x1B, 0xCB, 0xB0,
+    0x36, 0x70, 0x76, 0xA9, 0xF1, 0x1D, 0xA6, 0x1A, 0x6C, 0xB2, 0x8B, 0xE3, 0x4A, 0xC3, 0xCA, 0xE0,
+    0xED, 0x33, 0xF0, 0xB5, 0xA3, 0x1B, 0x7C, 0xA4, 0x59, 0x27, 0x91, 0x9F, 0x18, 0xB6, 0x30, 0x23,
+    0x51, 0x90, 0x84, 0x33, 0x5B, 0x61, 0xF1, 0xF3, 0x2B, 0xF7, 0x9B, 0x65, 0xAB, 0x56, 0x4B, 0x8F,
+    0xE6, 0x69, 0x98, 0x5D, 0xF7, 0xD2, 0xD5, 0x7C, 0x85, 0xF3, 0x62, 0x64, 0x9B, 0x58, 0x9B, 0x77,
+    0x38, 0x8D, 0xED, 0x3A, 0x93, 0x1D, 0x5C, 0x7F, 0xE6, 0xEB, 0xD7, 0x91, 0xFB, 0x87, 0x61, 0xE0,
+    0x98, 0x0C, 0xF3, 0x32, 0xEF, 0xE8, 0x28, 0x93, 0xB6, 0x4A, 0x3A, 0x25, 0x65, 0x67, 0x52, 0x98,
+    0x34, 0xBF, 0xB9, 0xCD, 0x87, 0xA1, 0xE1, 0xC3, 0xCD, 0xE8, 0xCF, 0x67, 0x06, 0xB7, 0xF4, 0x02,
+    0x93, 0x0F, 0xDB, 0x54, 0x61, 0xAA, 0xC0, 0x27, 0x04, 0x37, 0xAC, 0x5C, 0xCF, 0xAD, 0x78, 0x51,
+    0x89, 0x3F, 0xE7, 0x87, 0xF3, 0x9E, 0x5D, 0xEB, 0x43, 0xCD, 0x77, 0x37, 0xC2, 0x36, 0x60, 0x1A,
+    0x71, 0x1D, 0xAE, 0xE3, 0xDA, 0xD8, 0xD5, 0x9A, 0xBC, 0xE2, 0x0D, 0xD7, 0x8F, 0x06, 0x48, 0xA3,
+    0xB3, 0x3B, 0xB4, 0xBD, 0x87, 0xF7, 0x24, 0x46, 0x8E, 0x73, 0x99, 0x63, 0xC8, 0xF5, 0xDE, 0xF8,
+    0x2A, 0xF6, 0xAE, 0xF5, 0x33, 0x0D, 0xA7, 0x91, 0x1E, 0x37, 0xBE, 0x0E, 0xBD, 0xEB, 0x16, 0x6E,
+    0x4F, 0x57, 0x23, 0xA5, 0xD6, 0xD7, 0xEB, 0xE0, 0xAC, 0xB3, 0xBF, 0xA3, 0x42, 0x77, 0xAF, 0x15,
+    0xB6, 0x38, 0xA8, 0x76, 0x92, 0x5E, 0xC1, 0xDB, 0x41, 0x8A, 0xC0, 0x5D, 0x92, 0xE1, 0x92, 0x34,
+    0x70, 0xE3, 0x3F, 0x4B, 0xA9, 0xF5, 0x0F, 0x65, 0x3A, 0xBE, 0x29, 0x45, 0x23, 0x44, 0xA9, 0xDC,
+    0x7F, 0x54, 0x46, 0xF6, 0x42, 0x64, 0x8D, 0x55, 0x65, 0x1C, 0xA5, 0x0A, 0xE3, 0xAC, 0x52, 0x6B,
+    0x4B, 0xE4, 0x91, 0x8D, 0x9A, 0xAB, 0xB9, 0xA9, 0x67, 0x19, 0x54, 0x0A, 0x49, 0xE3, 0xBB, 0xA9,
+    0x14, 0x26, 0x35, 0xFE, 0x7C, 0x4D, 0xCD, 0x7A, 0xB1, 0x5A, 0x5D, 0x76, 0x6A, 0x03, 0xE7, 0xF3,
+    0xE5, 0xF5, 0xEB, 0xAD, 0x60, 0x77, 0x5C, 0x3A, 0xAE, 0xDB, 0x64, 0x31, 0xBF, 0xBC, 0x46, 0x59,
+    0x29, 0xF3, 0xFF, 0xC5, 0xF4, 0x3F, 0x60, 0xC7, 0x17, 0x29, 0xBC, 0x78, 0x65, 0x47, 0x73, 0x7C,
+    0xCC, 0x32, 0x9D, 0x33, 0x45, 0xDA, 0x09, 0x68, 0xD6, 0x3E, 0x94, 0xFB, 0x9F, 0xCA, 0x4A, 0xBB,
+    0x7D, 0x5D, 0xFE, 0x31, 0xFF, 0x8B, 0xF1, 0x1E, 0x8D, 0x55, 0x3D, 0x6F, 0xE5, 0x44, 0x14, 0xBD,
+    0x7E, 0xD6, 0xC6, 0x52, 0x5C, 0xB8, 0x4A, 0x81, 0x28, 0xDC, 0x23, 0x81, 0xFF, 0x00, 0x92, 0x1D,
+    0x28, 0x52, 0x50, 0x24, 0x48, 0xBC, 0x5D, 0xA4, 0x2D, 0xB6, 0xA1, 0xDF, 0x3F, 0x00, 0x8C, 0x61,
+    0x4B, 0x8A, 0xDD, 0x86, 0x3A, 0x5B, 0x2C, 0xD2, 0x2A, 0x0D, 0x7F, 0x20, 0xD2, 0x38, 0xD9, 0x22,
+    0x45, 0x0A, 0xAC, 0x4D, 0x41, 0x41, 0xF3, 0x10, 0x5A, 0x89, 0x0E, 0x93, 0x38, 0x8A, 0xDF, 0xE2,
+    0x99, 0xCB, 0x39, 0xE3, 0x17, 0x5E, 0x76, 0x89, 0x10, 0xD6, 0xF8, 0x9D, 0xFB, 0xC6, 0xE3, 0xFB,
+    0x71, 0xE6, 0xDC, 0xB1, 0x91, 0xA4, 0xCB, 0x9B, 0x68, 0x4C, 0x7A, 0x31, 0xDB, 0x4E, 0xF2, 0xD6,
+    0x54, 0x49, 0x9F, 0xB7, 0x91, 0x5B, 0x4D, 0x14, 0xAD, 0xAD, 0xD2, 0xA1, 0x50, 0xF5, 0xA9, 0xAA,
+    0x7E, 0x8B, 0x7B, 0x61, 0x55, 0x87, 0xE2, 0xF2, 0x9E, 0x4F, 0x07, 0xB1, 0xC7, 0x2A, 0x65, 0x67,
+    0x9B, 0xCC, 0x8B, 0x88, 0x6D, 0x44, 0x8A, 0x85, 0x48, 0xDA, 0x8B, 0xC4, 0xA3, 0x48, 0xA4, 0x9C,
+    0xAC, 0x45, 0xEE, 0x54, 0x5B, 0x95, 0xCC, 0x77, 0xBC, 0x64, 0xA3, 0x59, 0x88, 0x9E, 0xD0, 0x28,
+    0x5B, 0xB1, 0x2F, 0x9C, 0xA4, 0x37, 0x8C, 0x06, 0xEE, 0x1C, 0x1E, 0x15, 0xAD, 0xE8, 0x91, 0x56,
+    0x66, 0xCC, 0x10, 0xAD, 0x41, 0xB4, 0x71, 0x46, 0x23, 0x3A, 0x78, 0x00, 0xA7, 0xA2, 0x88, 0x92,
+    0x5D, 0x1B, 0xE9, 0xB8, 0x8A, 0x4B, 0x23, 0xE6, 0x4C, 0xF9, 0x86, 0x31, 0xE0, 0x71, 0x59, 0xBF,
+    0x23, 0x5F, 0x14, 0x72, 0xF8, 0x81, 0x1C, 0xBE, 0x2F, 0x87, 0x1F, 0x72, 0x8C, 0x18, 0x65, 0x3C,
+    0x16, 0x8A, 0x10, 0x63, 0xEC, 0xBE, 0x14, 0x39, 0xA4, 0x4F, 0x0E, 0x24, 0xB0, 0x58, 0x0F, 0x91,
+    0x1C, 0x45, 0x64, 0x0A, 0xA8, 0x26, 0xA8, 0xA5, 0xD0, 0xAA, 0x40, 0x80, 0x92, 0xD0, 0x8A, 0x21,
+    0x74, 0x62, 0x09, 0xBD, 0x28, 0x61, 0x98, 0x05, 0x18, 0x63, 0xD5, 0xBA, 0x50, 0x9F, 0x00, 0x4A,
+    0xD5, 0x94, 0x70, 0xA5, 0xBB, 0x1E, 0x70, 0xA1, 0xFB, 0x84, 0x73, 0xD5, 0xD7, 0x80, 0x4B, 0xD5,
+    0x73, 0x6D, 0xCA, 0x5E, 0xF5, 0x82, 0x60, 0xF5, 0x37, 0xC0, 0x60, 0xF4, 0x8C, 0x50, 0xEA, 0x0B,
+    0x42, 0xA1, 0x8F, 0x08, 0x99, 0xEE, 0x00, 0x90, 0x75, 0x42, 0x48, 0x27, 0x88, 0x5D, 0xAA, 0x8D,
+    0x41, 0xB9, 0x29, 0xEB, 0x66, 0xC5, 0x3A, 0x81, 0x9F, 0xC0, 0x4D, 0x30, 0x4E, 0x30, 0x04, 0x30,
+    0x7D, 0x00, 0x64, 0xBE, 0x86, 0x99, 0xB2, 0x60, 0xB2, 0x87, 0xAD, 0x50, 0xD1, 0x3A, 0x71, 0xB1,
+    0x4A, 0xD1, 0xE7, 0x4E, 0xB4, 0x35, 0x63, 0xA2, 0xDB, 0xDA, 0x95, 0x2E, 0xD1, 0x85, 0xF6, 0xB9,
+    0x9E, 0xEA, 0xC2, 0x58, 0x63, 0xBF, 0x19, 0xD5, 0xF9, 0xF4, 0x42, 0x2F, 0x86, 0xE2, 0x44, 0xF7,
+    0x17, 0x36, 0x73, 0xE6, 0xD8, 0x95, 0x7F, 0x6A, 0xDA, 0x9B, 0xEF, 0xB0, 0x91, 0xAE, 0xE8, 0x20,
+    0x80, 0x90, 0x56, 0x49, 0xE7, 0x60, 0x31, 0x48, 0x43, 0xB2, 0x6E, 0xA5, 0x8D, 0xD8, 0x85, 0x7F,
+    0xFA, 0x78, 0xD4, 0x9F, 0x46, 0x7B, 0x7A, 0x63, 0x9C, 0x8C, 0x66, 0x1A, 0x3F, 0x3B, 0x73, 0x36,
+    0xD5, 0x20, 0x92, 0x0C, 0xE2, 0xA9, 0xAC, 0xEF, 0xF9, 0x2E, 0x58, 0x85, 0x67, 0xF0, 0xDB, 0xD2,
+    0x59, 0xF8, 0x8D, 0x0E, 0x2A, 0xB9, 0xFD, 0xD2, 0xF0, 0xC0, 0x74, 0x6B, 0x2E, 0x32, 0x6C, 0x26,
+    0x49, 0xEB, 0x42, 0xD1, 0x8C, 0x10, 0x29, 0xB5, 0x24, 0xFA, 0x98, 0x53, 0xE5, 0x19, 0xF9, 0x43,
+    0x01, 0x14, 0xDC, 0x90, 0x83, 0xB0, 0xC0, 0x07, 0x96, 0x06, 0xC5, 0x69, 0x93, 0x83, 0x4A, 0xDB,
+    0x72, 0xAA, 0x5C, 0xCE, 0x11, 0x3D, 0x87, 0x4A, 0x07, 0x61, 0x9B, 0x28, 0x16, 0xB1, 0x53, 0xA8,
+    0x5B, 0x1D, 0x85, 0xBF, 0xD0, 0x33, 0x96, 0xEB, 0xA2, 0x18, 0x19, 0x1E, 0x52, 0xC2, 0xC2, 0x1D,
+    0x24, 0x10, 0x69, 0xF7, 0x5E, 0xB5, 0xF9, 0x34, 0x5F, 0xDE, 0x1F, 0xF0, 0x8E, 0x43, 0x19, 0xE8,
+    0x0E, 0xDC, 0xF2, 0x70, 0xF9, 0x56, 0x01, 0xEF, 0xE2, 0x7D, 0xF4, 0x61, 0x8D, 0x30, 0x8B, 0x6C,
+    0x69, 0xD1, 0xB1, 0xB1, 0x42, 0xE0, 0xA6, 0x81, 0x64, 0xBB, 0x52, 0x66, 0x2E, 0xAF, 0xC5, 0x7E,
+    0xB2, 0x90, 0xFC, 0xD7, 0x1E, 0x34, 0x7D, 0x8D, 0xED, 0xCC, 0x5F, 0xDD, 0x87, 0x7A, 0x54, 0x3B,
+    0xF6, 0x10, 0x9B, 0x69, 0x5B, 0xD5, 0xB6, 0xA9, 0x07, 0x13, 0xB3, 0x67, 0x9B, 0x4F, 0x58, 0x6F,
+    0x42, 0x26, 0xCC, 0x91, 0xAE, 0x2B, 0x75, 0x25, 0xDB, 0x57, 0x77, 0xDD, 0xED, 0x34, 0x86, 0xFD,
+    0xC2, 0x8B, 0xCD, 0x5A, 0x37, 0x93, 0xCE, 0x8A, 0x30, 0x95, 0x29, 0x85, 0x95, 0x78, 0x3A, 0x8C,
+    0x7D, 0x19, 0xD8, 0xDC, 0xA5, 0xE4, 0x78, 0x52, 0x50, 0x04, 0x06, 0xBB, 0x94, 0xF7, 0x6C, 0xE0,
+    0x0C, 0x6D, 0x1D, 0xD8, 0xC4, 0x99, 0x30, 0xD3, 0x8A, 0x53, 0xFA, 0xEA, 0x1E, 0xB6, 0xC9, 0x90,
+    0x3A, 0x96, 0x0A, 0xEA, 0x98, 0xB5, 0xD6, 0x81, 0xD3, 0x2E, 0x70, 0xEA, 0x22, 0x3C, 0x8B, 0xB5,
+    0xB6, 0x1D, 0xC3, 0x73, 0x23, 0x0B, 0x97, 0x7B, 0xAA, 0xA0, 0xD9, 0xDA, 0xDB, 0x82, 0x97, 0x0C,
+    0x3C, 0xC2, 0x29, 0x4E, 0x90, 0xC6, 0x74, 0xA6, 0x2B, 0x5C, 0x81, 0xD2, 0x77, 0xF5, 0x4D, 0x59,
+    0x6C, 0x78, 0xF2, 0xAF, 0x0B, 0x68, 0x67, 0x88, 0xFD, 0x43, 0x8D, 0x20, 0xF1, 0xC6, 0x4B, 0xDE,
+    0x95, 0x55, 0x3C, 0x66, 0x38, 0x88, 0x76, 0x90, 0xC0, 0xCB, 0x01, 0x3C, 0x7E, 0x25, 0x91, 0x27,
+    0xB1, 0x27, 0xCB, 0xBB, 0xDA, 0x31, 0x25, 0xE6, 0xC5, 0x4C, 0x5A, 0xA3, 0x7F, 0xF4, 0x33, 0x7D,
+    0x42, 0x77, 0x77, 0x3E, 0x3D, 0x38, 0x50, 0x32, 0x59, 0x5C, 0x04, 0x0D, 0x80, 0xD2, 0x2B, 0x18,
+    0xA4, 0x42, 0xFF, 0x62, 0xEA, 0x64, 0x4C, 0xF5, 0x87, 0xBD, 0xA0, 0x34, 0x9D, 0xFA, 0x32, 0xB9,
+    0x36, 0xB2, 0xAB, 0x95, 0x51, 0x9C, 0xAF, 0x8C, 0xF2, 0xA5, 0xFA, 0xF9, 0xE7, 0x64, 0xED, 0x88,
+    0x25, 0x07, 0xF5, 0x4E, 0x06, 0x2B, 0x0B, 0x46, 0xE2, 0x57, 0x06, 0x78, 0xB3, 0xE1, 0x2D, 0xC8,
+    0xD1, 0xF8, 0xA9, 0xFD, 0x57, 0x9E, 0xED, 0xB5, 0x11, 0x04, 0x38, 0x9F, 0xEF, 0x05, 0x3D, 0xFE,
+    0x43, 0x25, 0x33, 0x4C, 0x31, 0x4D, 0xBE, 0x07, 0x72, 0x18, 0x28, 0x27, 0xA5, 0x54, 0xF2, 0x48,
+    0xBD, 0xE6, 0xAB, 0xF0, 0xFF, 0x52, 0xE2, 0xC6, 0xB4, 0x7C, 0x1F, 0xC5, 0xE6, 0xC1, 0x53, 0x0D,
+    0x49, 0xC2, 0x5D, 0x4F, 0x55, 0xF6, 0x62, 0x29, 0x4C, 0x7F, 0x60, 0x5B, 0x17, 0x76, 0x70, 0x80,
+    0x3C, 0xB9, 0x88, 0x44, 0x02, 0x4E, 0x21, 0xD2, 0xD7, 0x9F, 0x49, 0x04, 0x9D, 0xD2, 0x39, 0xA5,
+    0x0A, 0xA1, 0x50, 0xAD, 0x5E, 0x92, 0x47, 0x53, 0x66, 0xFC, 0xCA, 0xF0, 0xCD, 0x20, 0x00, 0xF5,
+    0xA0, 0x8F, 0x13, 0x15, 0xC5, 0x6B, 0x7F, 0x97, 0xCD, 0x67, 0xD1, 0x73, 0x1C, 0x51, 0xA6, 0xC9,
+    0x48, 0x37, 0x0A, 0xA0, 0xFF, 0x46, 0x56, 0xDB, 0x71, 0xCB, 0x15, 0xFD, 0xC8, 0x8F, 0x16, 0x3C,
+    0x7C, 0xC4, 0xF2, 0xF9, 0x39, 0x8B, 0x83, 0x1E, 0xBB, 0x40, 0xE9, 0x4D, 0x03, 0x3B, 0x1B, 0x1A,
+    0x71, 0x6D, 0x2C, 0xF7, 0xDE, 0x5E, 0x73, 0x39, 0x9F, 0x93, 0xC1, 0x8E, 0xCC, 0xED, 0x30, 0x4B,
+    0x1A, 0x27, 0x81, 0x34, 0x2A, 0x63, 0xF3, 0x69, 0xF4, 0x3C, 0xF6, 0x77, 0x95, 0xC5, 0xD6, 0x19,
+    0x3F, 0x5D, 0x3C, 0xA2, 0x42, 0xDF, 0xFD, 0xE7, 0xB5, 0x81, 0x15, 0xE9, 0x24, 0xFA, 0x36, 0x73,
+    0xC9, 0x88, 0xE6, 0x2C, 0x3F, 0x06, 0x8B, 0xDD, 0xB5, 0xE7, 0x07, 0xB8, 0x7F, 0xF1, 0xF3, 0xE9,
+    0xCB, 0xCA, 0x4E, 0xCA, 0xB4, 0x9A, 0x1D, 0x33, 0x13, 0x64, 0x8B, 0x03, 0x1A, 0x3C, 0xC0, 0xA8,
+    0x23, 0xBB, 0x94, 0xFF, 0x7B, 0xFD, 0x0D, 0xD5, 0x54, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0xBD, 0xB6,
+    0x43, 0x2C, 0xC5, 0x52, 0x4C, 0x45, 0xB1, 0x14, 0xEE, 0xD3, 0xF8, 0x13, 0xC6, 0x0A, 0x05, 0x12,
+    0x29, 0xE8, 0xA1, 0xA0, 0x27, 0x1F, 0x31, 0x26, 0x14, 0x5B, 0x50, 0x64, 0x3F, 0x62, 0x8B, 0xAC,
+    0xF3, 0x11, 0xF3, 0x08, 0x52, 0xB6, 0x48, 0xF3, 0x04, 0x05, 0x05, 0x8D, 0x45, 0x56, 0x8A, 0x44,
+    0xC3, 0x44, 0x32, 0x59, 0x67, 0x19, 0xFB, 0xE4, 0xDC, 0x19, 0x3F, 0x52, 0x24, 0x44, 0x0A, 0xA2,
+    0xC9, 0xBC, 0xE7, 0x79, 0xF7, 0x8D, 0x67, 0xEE, 0x3D, 0xF7, 0xDC, 0x73, 0x47, 0x44, 0x47, 0xEE,
+    0x5E, 0x8A, 0x54, 0x00, 0xBA, 0x8C, 0xD3, 0x2A, 0x0D, 0xE7, 0xA0, 0x26, 0x46, 0x35, 0x91, 0x5D,
+    0xC8, 0xD7, 0x98, 0x45, 0xF7, 0xEC, 0x38, 0xB7, 0x41, 0x0F, 0xE1, 0xD1, 0xE0, 0xB8, 0xCD, 0xE8,
+    0x86, 0x9F, 0x74, 0x0A, 0xAD, 0xCE, 0xDF, 0xE9, 0x34, 0xD5, 0x5E, 0x0A, 0x88, 0xEB, 0x05, 0x63,
+    0xB1, 0x8A, 0x09, 0xD2, 0xC2, 0x41, 0x84, 0x07, 0xF6, 0x42, 0xC7, 0xA3, 0x48, 0xE6, 0x46, 0xD9,
+    0xC6, 0xDD, 0x53, 0x29, 0x01, 0x5F, 0x28, 0x00, 0x3E, 0x5E, 0x5D, 0xDE, 0xEC, 0x4A, 0x8D, 0xD5,
+    0x30, 0x6A, 0xBE, 0x8A, 0x7C, 0xE4, 0x7E, 0xE0, 0xE2, 0x53, 0x3E, 0x33, 0x9F, 0xA5, 0xC5, 0x1F,
+    0x28, 0x3D, 0xFD, 0xA3, 0x73, 0xBB, 0x5A, 0x9D, 0x82, 0xBB, 0xAF, 0xAF, 0x5D, 0x72, 0x78, 0xD4,
+    0x7F, 0xCB, 0x63, 0x4B, 0x35, 0x89, 0x98, 0x11, 0x3D, 0xA1, 0xD4, 0x84, 0x6C, 0x9E, 0x73, 0x4F,
+    0x89, 0x26, 0xC8, 0xBB, 0xC6, 0x07, 0xC9, 0x45, 0xF1, 0x06, 0x17, 0x25, 0xB9, 0x30, 0x3B, 0x48,
+    0xED, 0xCD, 0xAE, 0x5C, 0x9A, 0x29, 0xC7, 0x9D, 0x45, 0xDC, 0xEF, 0xE8, 0x6F, 0x9D, 0x0E, 0x27,
+    0x8C, 0x73, 0xAB, 0x1F, 0x52, 0x40, 0xDD, 0x10, 0x8D, 0x32, 0x34, 0x3E, 0x31, 0x80, 0x3B, 0x1B,
+    0x45, 0xF8, 0x05, 0x89, 0x51, 0x33, 0x63, 0x94, 0xFF, 0x61, 0xB4, 0x4B, 0x06, 0x7E, 0x47, 0x12,
+    0xB2, 0xB3, 0x4C, 0x90, 0x01, 0xED, 0x5C, 0x63, 0xE7, 0x58, 0xA9, 0x1A, 0x05, 0xD3, 0xD5, 0xC8,
+    0x18, 0xC9, 0x5F, 0x88, 0xE4, 0x1A, 0xD4, 0xCC, 0x98, 0xDB, 0x9F, 0xE0, 0x3E, 0xD4, 0x83, 0x7D,
+    0x81, 0x67, 0x11, 0x54, 0x0D, 0x7B, 0x19, 0x2B, 0x20, 0x4A, 0x72, 0x34, 0x94, 0xF3, 0x08, 0x53,
+    0xD9, 0x4B, 0xB9, 0x58, 0xF2, 0x9F, 0xD2, 0x64, 0x4D, 0xB6, 0xEC, 0xB0, 0x1E, 0x8C, 0xB4, 0x3B,
+    0xC7, 0xB6, 0x94, 0x63, 0x5B, 0xD2, 0xF3, 0xC0, 0x3F, 0x86, 0x57, 0x63, 0x75, 0x57, 0xBA, 0x54,
+    0x62, 0x6D, 0xD7, 0x96, 0x4E, 0x59, 0xA5, 0x5A, 0x6B, 0xCD, 0xDA, 0x44, 0xE0, 0x98, 0x2A, 0x2D,
+    0x59, 0xE0, 0xDF, 0x9E, 0x27, 0xCF, 0xF2, 0xD3, 0x18, 0xA5, 0x19, 0x6D, 0x9F, 0x7C, 0x57, 0x29,
+    0xBE, 0xF1, 0x09, 0x6C, 0xD2, 0xA4, 0x2E, 0x4C, 0x2C, 0xD9, 0x7F, 0x1A, 0xD8, 0x37, 0xAC, 0xB9,
+    0xA7, 0x12, 0x33, 0xF8, 0x66, 0xD1, 0x32, 0x35, 0xC4, 0xD2, 0x53, 0x55, 0x7B, 0x78, 0xBE, 0xE0,
+    0x9B, 0x1A, 0xF5, 0x92, 0x0A, 0xF8, 0x34, 0xE2, 0xC2, 0x6F, 0xAB, 0xF5, 0x51, 0xBD, 0xEE, 0xCF,
+    0x25, 0x86, 0x47, 0x02, 0x2C, 0x07, 0xCE, 0x98, 0xC0, 0x22, 0xDB, 0x9B, 0x0D, 0x7A, 0xD4, 0xFB,
+    0xEB, 0x1D, 0x76, 0x23, 0x3C, 0x6A, 0xBC, 0x8B, 0xDC, 0x46, 0x06, 0x49, 0x12, 0xFE, 0x26, 0xCD,
+    0x14, 0xF5, 0x37, 0xFC, 0x4C, 0x94, 0xF8, 0xCF, 0x98, 0x1C, 0xF6, 0x24, 0xA7, 0xC5, 0x3D, 0xBA,
+    0x53, 0x45, 0xA2, 0x08, 0x2A, 0xC8, 0x76, 0x72, 0x7B, 0xEA, 0xF1, 0xDE, 0xF0, 0xC5, 0xD9, 0x3B,
+    0x52, 0x3C, 0x42, 0xCF, 0x1A, 0x8C, 0x8C, 0x30, 0x9A, 0x41, 0x79, 0x62, 0x1B, 0x89, 0x96, 0x81,
+    0x88, 0xEC, 0xBE, 0x66, 0x54, 0x83, 0x13, 0x02, 0xEB, 0xB3, 0xAF, 0x14, 0x92, 0xD3, 0xDC, 0x55,
+    0xCA, 0x9D, 0xB4, 0x2F, 0x2E, 0xAE, 0x53, 0x35, 0x00, 0x51, 0xCE, 0xEC, 0xB5, 0x47, 0xDA, 0xC6,
+    0x8E, 0x5D, 0xC1, 0xCB, 0xA1, 0x58, 0xEA, 0x89, 0x17, 0xC3, 0xF7, 0x6B, 0x3D, 0xDB, 0xE7, 0xDC,
+    0x94, 0x9A, 0x58, 0x3E, 0xE6, 0xE1, 0x89, 0x59, 0xED, 0xF3, 0xAE, 0xE5, 0x5F, 0xE6, 0xDA, 0x48,
+    0xF6, 0xD0, 0x6B, 0xCB, 0x16, 0xAA, 0x0B, 0xDB, 0x49, 0x36, 0x67, 0x27, 0xA6, 0x67, 0xFD, 0x89,
+    0x8A, 0x3C, 0x8C, 0x99, 0xBB, 0x38, 0x70, 0x35, 0x9A, 0xD4, 0xAE, 0xFE, 0x68, 0x50, 0xEA, 0xC9,
+    0x72, 0x16, 0xEF, 0x1B, 0x7A, 0xA1, 0x7B, 0x4B, 0x19, 0xBA, 0x55, 0xBB, 0x7E, 0x27, 0x77, 0x95,
+    0xC6, 0x86, 0x0B, 0x15, 0xB3, 0xA0, 0x2C, 0x4E, 0xEA, 0xB9, 0x98, 0x5B, 0xF6, 0x01, 0x66, 0x3D,
+    0xCF, 0x5F, 0x9F, 0x2B, 0xC3, 0x9F, 0xA6, 0x3A, 0x7C, 0x32, 0x0C, 0xFD, 0xC1, 0xB7, 0x89, 0x25,
+    0x30, 0x5E, 0x8B, 0x4F, 0x50, 0x9D, 0x68, 0x75, 0xA3, 0xEF, 0x97, 0xEA, 0xBB, 0xE7, 0x43, 0xA0,
+    0xAD, 0xDF, 0x7C, 0xCF, 0xD2, 0xD7, 0x73, 0x3E, 0xBD, 0xC5, 0x77, 0x7B, 0x75, 0xA0, 0xF8, 0x1A,
+    0x2F, 0x03, 0xBD, 0x35, 0xAA, 0x28, 0xF9, 0x58, 0xE3, 0x16, 0x57, 0xC3, 0x7B, 0x29, 0xB1, 0x4C,
+    0x52, 0xDA, 0xCB, 0x8D, 0x33, 0x5E, 0x71, 0x6C, 0x70, 0x33, 0x8A, 0x59, 0x69, 0x96, 0x84, 0x3C,
+    0x12, 0x14, 0x2F, 0xC0, 0x9A, 0xA6, 0xC6, 0xA6, 0x69, 0xD4, 0x64, 0xBC, 0x9C, 0x6A, 0xA0, 0x34,
+    0x7C, 0x7B, 0x89, 0xDB, 0xF8, 0x0C, 0x56, 0x45, 0xF1, 0x2B, 0x85, 0xF2, 0x65, 0xB0, 0x73, 0xF3,
+    0x17, 0x8E, 0x79, 0x81, 0x3A, 0x6F, 0x43, 0x83, 0xB5, 0xC4, 0x8F, 0xC4, 0xA8, 0x66, 0xE0, 0xBD,
+    0x4B, 0xD5, 0xB9, 0x40, 0x7F, 0x6A, 0xAE, 0xE2, 0x16, 0xDE, 0x20, 0x15, 0x25, 0x1F, 0x68, 0x46,
+    0x38, 0x03, 0x33, 0xD4, 0x86, 0x8F, 0x2D, 0x6E, 0x70, 0xF5, 0x6F, 0x0A, 0xB3, 0x7D, 0x86, 0xCF,
+    0x67, 0x36, 0x87, 0xED, 0x2B, 0x1C, 0xCF, 0x19, 0x68, 0x18, 0x1A, 0x95, 0x1A, 0xA0, 0x61, 0x2E,
+    0x67, 0xFB, 0x64, 0xB1, 0xC7, 0x01, 0xE7, 0xC1, 0xC2, 0xDB, 0x73, 0xAC, 0x15, 0x8D, 0x9D, 0x3B,
+    0x67, 0xF0, 0x60, 0x19, 0xFB, 0x9C, 0x91, 0x02, 0x0B, 0x80, 0xC7, 0x83, 0xDC, 0x78, 0x20, 0x1F,
+    0xDA, 0x78, 0x05, 0x9D, 0x55, 0xB1, 0x6E, 0xDC, 0x46, 0x10, 0x9D, 0xBB, 0x83, 0x75, 0x80, 0x58,
+    0x6C, 0x13, 0xA7, 0x48, 0x02, 0xB0, 0x57, 0xC3, 0x4F, 0x20, 0xE1, 0x00, 0x69, 0x95, 0x14, 0x6A,
+    0x94, 0x3F, 0x70, 0xE3, 0x4F, 0xE0, 0x45, 0x2A, 0x54, 0xA4, 0x88, 0xFE, 0x20, 0x2A, 0x9C, 0xC0,
+    0xBA, 0x14, 0xFA, 0x84, 0x65, 0xEC, 0x42, 0x65, 0x98, 0xA8, 0x70, 0x69, 0xC6, 0x4A, 0x10, 0xC0,
+    0x69, 0x16, 0x31, 0x85, 0xD0, 0xC2, 0x92, 0x2F, 0xEF, 0xED, 0xD9, 0x02, 0x0C, 0x27, 0x86, 0x10,
+    0x02, 0x1C, 0x3C, 0x72, 0xB9, 0x3B, 0x33, 0x6F, 0xDE, 0x0C, 0x0D, 0x8B, 0x68, 0x96, 0x87, 0xBA,
+    0xB1, 0x39, 0x32, 0xC2, 0x22, 0xF8, 0xC6, 0x16, 0xD8, 0x1D, 0xCD, 0x76, 0x1E, 0xAE, 0x8F, 0xED,
+    0x3D, 0xD7, 0x72, 0x94, 0x2D, 0x5B, 0xDB, 0x3E, 0x5D, 0x4C, 0x36, 0x43, 0x57, 0x76, 0x56, 0x4E,
+    0x84, 0x4B, 0x04, 0x42, 0x8F, 0x05, 0xCC, 0x11, 0x86, 0x39, 0x04, 0x4B, 0xC1, 0x0C, 0x98, 0xC3,
+    0x80, 0xBE, 0x08, 0xC5, 0xDF, 0xB8, 0x87, 0x4F, 0x51, 0xF7, 0x45, 0xEF, 0x9F, 0xE2, 0x00, 0xBB,
+    0xB1, 0x1E, 0xF2, 0x2B, 0x1C, 0xE1, 0x2B, 0xF8, 0x50, 0xC7, 0x1C, 0xD3, 0x12, 0x3F, 0x02, 0xAD,
+    0x60, 0xCC, 0xD0, 0x00, 0x95, 0x8F, 0x3C, 0x4F, 0x70, 0x32, 0x3F, 0x3A, 0x34, 0x19, 0x5A, 0x44,
+    0xC2, 0xD9, 0xA3, 0xAD, 0x13, 0x06, 0x82, 0x6A, 0x31, 0xB9, 0xDE, 0xCA, 0x0E, 0xAB, 0x25, 0x72,
+    0x2E, 0xFC, 0x85, 0xE6, 0xED, 0x88, 0x07, 0xCB, 0xFB, 0x7A, 0xB5, 0xC0, 0xD1, 0x60, 0x7E, 0xA8,
+    0x57, 0x39, 0xC1, 0x02, 0x04, 0x9E, 0xC0, 0x11, 0x1C, 0xA2, 0x3E, 0x8A, 0xFE, 0xE9, 0x50, 0xFF,
+    0x14, 0xEB, 0x73, 0x60, 0x19, 0x6B, 0x74, 0xFE, 0x9C, 0xEE, 0x09, 0x8C, 0xA0, 0x23, 0x88, 0x86,
+    0x73, 0x54, 0x2E, 0xDE, 0x3F, 0xB1, 0xF5, 0xCA, 0x66, 0x8F, 0xB6, 0x4F, 0x78, 0x72, 0xA2, 0x31,
+    0x85, 0x60, 0x72, 0xD1, 0x9A, 0x65, 0x53, 0x31, 0x18, 0x49, 0xFD, 0x7A, 0xFA, 0x77, 0xF6, 0x3E,
+    0x86, 0xC8, 0xAD, 0xA1, 0x1D, 0x1E, 0x4C, 0x43, 0x96, 0xF1, 0x32, 0x1B, 0x0C, 0x56, 0x0F, 0x96,
+    0xA1, 0x2A, 0xF4, 0x36, 0x38, 0x5A, 0x37, 0x66, 0xD0, 0x69, 0x87, 0xFA, 0xBC, 0x0E, 0xCA, 0xCB,
+    0xC5, 0x32, 0x18, 0x4B, 0xA5, 0x65, 0xC3, 0x53, 0xC8, 0xFF, 0x55, 0x5A, 0x18, 0x37, 0x0B, 0xBB,
+    0x69, 0xE1, 0x89, 0x5E, 0xF9, 0xC0, 0x33, 0xAD, 0x8E, 0x25, 0x7E, 0xFF, 0x10, 0x60, 0x11, 0x78,
+    0xAD, 0x92, 0x6D, 0x0B, 0xD9, 0xB0, 0x90, 0x25, 0x75, 0xB4, 0x03, 0xDD, 0x08, 0xDB, 0x16, 0xA6,
+    0x9B, 0xFA, 0x97, 0x0D, 0x6C, 0x31, 0x8A, 0x5C, 0xA6, 0xB8, 0x9C, 0x72, 0xF2, 0xF7, 0x1C, 0xAB,
+    0xAD, 0xD3, 0x8F, 0x1E, 0xBE, 0x4F, 0x21, 0x3C, 0xA2, 0xA2, 0x1A, 0x50, 0xCD, 0x80, 0x91, 0xDA,
+    0xF0, 0x21, 0x63, 0x76, 0x2B, 0x96, 0x27, 0xBA, 0x60, 0xE5, 0xCF, 0x3C, 0x73, 0xCA, 0x83, 0x15,
+    0xCF, 0x61, 0x73, 0x81, 0xF2, 0xD7, 0x54, 0x42, 0x32, 0xDC, 0x32, 0x84, 0xA8, 0x38, 0x57, 0x0C,
+    0x29, 0xA4, 0xED, 0x3A, 0x87, 0x86, 0xF9, 0xDB, 0xDD, 0xCF, 0x13, 0x75, 0x9D, 0x29, 0xE0, 0xCE,
+    0x72, 0x11, 0xA7, 0x0C, 0x24, 0x8B, 0x39, 0x82, 0x03, 0xBF, 0x3B, 0x40, 0x6B, 0x65, 0x2C, 0x23,
+    0x85, 0x79, 0x81, 0x95, 0xE5, 0x93, 0x72, 0xC3, 0xA5, 0xCC, 0x06, 0xBE, 0xC4, 0x8B, 0xF5, 0x83,
+    0x29, 0x7D, 0x70, 0xC9, 0x43, 0xEA, 0xB1, 0xC0, 0x0B, 0x2F, 0xC5, 0xD1, 0xB3, 0x93, 0xAD, 0x6A,
+    0x31, 0x23, 0x32, 0xA2, 0x29, 0x14, 0x93, 0xA3, 0x95, 0x2A, 0x27, 0x33, 0x2A, 0x82, 0x3E, 0x15,
+    0x50, 0x89, 0x15, 0xFD, 0x72, 0x72, 0x64, 0xE5, 0x49, 0x34, 0x77, 0xA5, 0xBC, 0xB4, 0xF9, 0x8C,
+    0xF7, 0x1F, 0xB8, 0x3E, 0x7B, 0xA5, 0xB4, 0x4A, 0x92, 0xBC, 0xCB, 0x17, 0x8F, 0x79, 0x77, 0xCA,
+    0x6A, 0x89, 0xB4, 0xBF, 0x67, 0x00, 0xD4, 0xCB, 0xF6, 0xF1, 0x4E, 0x45, 0xB4, 0x7C, 0xBB, 0x1D,
+    0xCB, 0x9E, 0x6B, 0x9B, 0x76, 0x7C, 0xE7, 0x9A, 0xED, 0x49, 0xD2, 0x4C, 0x9A, 0x1F, 0x40, 0x0D,
+    0xA8, 0x40, 0x95, 0x5A, 0x97, 0xA9, 0xAC, 0x86, 0x40, 0x19, 0x15, 0x23, 0x57, 0xA5, 0x81, 0x7C,
+    0x2C, 0x87, 0x94, 0xEA, 0x0D, 0x01, 0x09, 0xA2, 0x9C, 0xD6, 0xDF, 0x13, 0x36, 0x62, 0x48, 0xAD,
+    0xFB, 0x0B, 0xA6, 0x1F, 0x10, 0x45, 0xA9, 0x5A, 0x8E, 0x21, 0x2E, 0x65, 0xAD, 0xD8, 0x88, 0x93,
+    0x61, 0xCB, 0x11, 0xC5, 0x34, 0xF3, 0x32, 0x52, 0xBF, 0xB4, 0x2F, 0x59, 0x48, 0xF7, 0x52, 0xFD,
+    0xBB, 0x9A, 0x97, 0x0C, 0x72, 0x96, 0x90, 0xA7, 0xB6, 0x0E, 0x67, 0x51, 0x2A, 0x38, 0x9C, 0x38,
+    0x6B, 0x24, 0x2A, 0xE6, 0x8A, 0x6F, 0x79, 0xFA, 0x9F, 0xBC, 0x5F, 0xD1, 0xF9, 0xC4, 0xEE, 0xC1,
+    0x37, 0xD4, 0xC0, 0x85, 0xE8, 0xA7, 0x47, 0x76, 0x26, 0x62, 0x92, 0x80, 0xCE, 0xB0, 0x9A, 0xD2,
+    0x74, 0xA1, 0x6C, 0x5E, 0x37, 0x9D, 0x53, 0xB7, 0xCD, 0x70, 0x44, 0x97, 0xC5, 0xE0, 0x3B, 0x9B,
+    0xAD, 0x3F, 0x3B, 0xB5, 0x5B, 0x5C, 0xFB, 0xD2, 0x90, 0x97, 0x86, 0x58, 0xA9, 0x36, 0x69, 0x88,
+    0x83, 0xE1, 0xF8, 0xC1, 0x48, 0xF1, 0xB1, 0xC3, 0x72, 0xB5, 0xC1, 0x3D, 0xA8, 0xCD, 0x76, 0xD8,
+    0x05, 0xBE, 0xD9, 0x0C, 0x3C, 0x09, 0xA3, 0xB3, 0x24, 0xB5, 0x0D, 0xDC, 0xDB, 0xFB, 0x32, 0x25,
+    0x5B, 0xF3, 0x20, 0x73, 0x53, 0x3D, 0x52, 0x2A, 0x17, 0x49, 0x43, 0x89, 0x63, 0x15, 0x3B, 0x25,
+    0x40, 0x0A, 0xA5, 0x88, 0x46, 0x55, 0x22, 0x85, 0x1E, 0x27, 0xAF, 0xE3, 0x50, 0xDD, 0x55, 0x70,
+    0x0D, 0xDE, 0x92, 0x8D, 0x9D, 0x6E, 0x55, 0xFD, 0x4D, 0x95, 0xFD, 0x6F, 0x0A, 0xAE, 0xCA, 0xBF,
+    0xF0, 0xED, 0x07, 0x4C, 0x3C, 0x4D, 0x31, 0x53, 0xE6, 0xF3, 0x91, 0xF1, 0x6F, 0x6E, 0x61, 0xBE,
+    0xFB, 0xC4, 0xDC, 0x90, 0x5F, 0x23, 0xB0, 0x58, 0xAD, 0xF6, 0x68, 0xAF, 0xDD, 0xDD, 0x3F, 0x93,
+    0x7C, 0x47, 0x49, 0x23, 0x4A, 0xCD, 0xE1, 0xCE, 0x5E, 0x75, 0x0B, 0x82, 0xEE, 0xAF, 0x6C, 0xFB,
+    0x84, 0x52, 0xF7, 0x8F, 0x25, 0x67, 0x8E, 0x75, 0xC7, 0xEE, 0x25, 0x11, 0x2E, 0x12, 0x17, 0x3D,
+    0x23, 0xA9, 0xA5, 0x53, 0x5C, 0x4A, 0x7A, 0xCF, 0x7A, 0x89, 0xB0, 0xD9, 0xC8, 0xD1, 0x69, 0x7A,
+    0xE4, 0x9A, 0x3B, 0xA5, 0xB8, 0x51, 0xC1, 0x4C, 0x4F, 0x0B, 0x3D, 0x15, 0xBD, 0x44, 0x4B, 0xB9,
+    0xE9, 0xCB, 0x7A, 0x23, 0x27, 0xF5, 0xB5, 0xB6, 0x5C, 0x27, 0xC7, 0x77, 0xF6, 0xD5, 0xEB, 0x29,
+    0xDE, 0x21, 0xD1, 0xB5, 0xBD, 0xFE, 0x6E, 0xCF, 0x6E, 0x7F, 0xE9, 0xBF, 0xA4, 0xE1, 0xB7, 0x8C,
+    0x2C, 0x62, 0xD1, 0x71, 0x18, 0xB2, 0x45, 0x03, 0x1B, 0xCB, 0xB7, 0x05, 0x6B, 0xD7, 0xA0, 0x9A,
+    0xE3, 0x28, 0x32, 0x5E, 0x3E, 0x65, 0x72, 0xEE, 0x34, 0x7D, 0x8B, 0xCD, 0x38, 0xD1, 0x34, 0x4E,
+    0x73, 0xB3, 0xD3, 0xB8, 0xE5, 0x93, 0xBA, 0x30, 0x55, 0x97, 0xF3, 0x98, 0xEB, 0x7C, 0x42, 0x6A,
+    0xC9, 0x94, 0xA7, 0xB6, 0x0C, 0x37, 0x8E, 0x77, 0xAA, 0x53, 0x9B, 0x4D, 0x2C, 0x4F, 0x16, 0x0B,
+    0x0E, 0x33, 0x4D, 0x69, 0xB6, 0xDE, 0x9B, 0x11, 0xFD, 0xDF, 0x17, 0xC5, 0x95, 0x07, 0x31, 0x7D,
+    0xC0, 0x39, 0x31, 0xF2, 0x57, 0x99, 0xDF, 0x30, 0x3D, 0x52, 0xD4, 0x1A, 0x95, 0xFA, 0x2B, 0xFB,
+    0x97, 0xF4, 0x89, 0x67, 0x41, 0xF3, 0xB9, 0xD9, 0x44, 0x90, 0x89, 0x36, 0x27, 0x6E, 0x8B, 0xFF,
+    0xC3, 0xB4, 0xD9, 0x3F, 0x9D, 0x54, 0x3D, 0x8F, 0xDE, 0x44, 0x10, 0x1E, 0xDB, 0x0A, 0x2E, 0x5C,
+    0x98, 0xE6, 0x9A, 0x2B, 0xD8, 0x16, 0xD1, 0xF8, 0x17, 0xA0, 0xB5, 0x68, 0x28, 0x28, 0x68, 0x92,
+    0x3F, 0x71, 0xBF, 0x01, 0xB2, 0x46, 0x14, 0x57, 0x12, 0x51, 0x50, 0x5F, 0x01, 0x52, 0xB8, 0x86,
+    0x96, 0x06, 0xEC, 0xF0, 0x16, 0x29, 0x28, 0x78, 0x4F, 0x57, 0x20, 0xD1, 0xC4, 0x57, 0xA5, 0xC4,
+    0x80, 0x21, 0x0E, 0xAC, 0x3D, 0x3C, 0xCF, 0xEC, 0x7B, 0x21, 0x3A, 0x01, 0x09, 0xAC, 0x76, 0x3C,
+    0xDE, 0xDD, 0x99, 0xDD, 0xF9, 0x78, 0x66, 0xE4, 0x8D, 0xF6, 0x73, 0xC9, 0xB4, 0x5C, 0xA4, 0x8A,
+    0xCD, 0x24, 0x7E, 0xD2, 0x41, 0x74, 0xA7, 0x52, 0xE8, 0xBB, 0xAB, 0xBC, 0x68, 0x64, 0xDA, 0x8A,
+    0xBF, 0x54, 0xEA, 0x6F, 0x52, 0x2D, 0x75, 0x14, 0xBF, 0xAF, 0x63, 0xA6, 0xD2, 0xCC, 0xD5, 0x82,
+    0xBB, 0xFC, 0x5E, 0xFA, 0x2B, 0x15, 0xD1, 0x6F, 0x17, 0xC9, 0x55, 0xF7, 0xB8, 0x15, 0xAB, 0x4A,
+    0x17, 0x91, 0x1A, 0x2B, 0x69, 0xB0, 0x12, 0x8F, 0x95, 0xF4, 0x58, 0xE5, 0x5C, 0xB9, 0x85, 0x3F,
+    0x7B, 0x9C, 0x63, 0xE5, 0x75, 0x86, 0xB2, 0x76, 0xD0, 0xA3, 0xCA, 0x76, 0xF3, 0xFD, 0xB0, 0x17,
+    0x37, 0xE3, 0x31, 0xA9, 0x56, 0xCE, 0x42, 0xDB, 0x52, 0xDB, 0x4C, 0xF7, 0x98, 0x12, 0x66, 0x79,
+    0xC9, 0x71, 0x7C, 0x26, 0xF9, 0x7D, 0xBC, 0xD3, 0x49, 0x3F, 0x20, 0x0A, 0x52, 0xE3, 0x2D, 0x3F,
+    0x8A, 0xD2, 0x90, 0x16, 0x31, 0x91, 0x3A, 0x16, 0x9B, 0xD9, 0xE8, 0x07, 0x91, 0x52, 0xCB, 0x68,
+    0x56, 0x43, 0x1E, 0x8E, 0x3F, 0xE2, 0x33, 0x66, 0x2C, 0xCC, 0xD1, 0x11, 0xDF, 0x42, 0x2D, 0x70,
+    0x0E, 0x81, 0xC4, 0xA0, 0xE1, 0x54, 0x6A, 0xC9, 0xFC, 0xC4, 0x6F, 0x91, 0xFC, 0xA0, 0xCB, 0xD0,
+    0x89, 0x76, 0xCC, 0xCB, 0xA0, 0x3F, 0xD9, 0x62, 0x4D, 0x97, 0x51, 0xA5, 0xDC, 0x3A, 0xB9, 0xD6,
+    0xD1, 0x2E, 0x83, 0x58, 0x18, 0xA5, 0x1F, 0xA5, 0x41, 0x78, 0x67, 0xA9, 0x57, 0x71, 0x2B, 0x2F,
+    0xCF, 0x20, 0xD2, 0xCA, 0x7F, 0x1B, 0x96, 0x3C, 0x04, 0x3A, 0x0A, 0x1D, 0xE2, 0xB5, 0x8C, 0xB3,
+    0xD4, 0x33, 0x1D, 0xCE, 0xD4, 0x2C, 0x6C, 0x46, 0xFA, 0x53, 0xD0, 0xA0, 0x66, 0x09, 0x74, 0x88,
+    0xA9, 0x64, 0x0A, 0xCD, 0x3A, 0x6F, 0x06, 0xE7, 0x6A, 0x0E, 0x59, 0x46, 0xA1, 0x14, 0xCD, 0x5E,
+    0x73, 0x88, 0xA9, 0x91, 0x43, 0x62, 0xED, 0x09, 0x6E, 0xAD, 0x76, 0x6C, 0xD1, 0xB1, 0xFC, 0x62,
+    0x61, 0xFA, 0xDE, 0x54, 0x0E, 0x8A, 0x69, 0xBC, 0x72, 0x76, 0xDC, 0xD5, 0x33, 0x30, 0x45, 0x5A,
+    0xFC, 0xE8, 0x96, 0x30, 0x36, 0xB1, 0xB7, 0x28, 0xBE, 0x4A, 0x95, 0xB6, 0x88, 0x46, 0x92, 0x28,
+    0x80, 0xEE, 0x82, 0xDE, 0x07, 0x7D, 0x65, 0x54, 0xC6, 0x1E, 0xDE, 0xF4, 0xFB, 0x10, 0x83, 0x6A,
+    0xF4, 0x20, 0xA7, 0x5B, 0x2C, 0xF4, 0xA7, 0x28, 0x47, 0x39, 0x2C, 0xCD, 0xD7, 0x9B, 0x74, 0xDC,
+    0x9D, 0xD4, 0x93, 0xDF, 0xAD, 0xF5, 0xAF, 0x7A, 0xBA, 0x85, 0x2B, 0xFD, 0x22, 0xBD, 0xF7, 0xBA,
+    0x9C, 0xD5, 0xED, 0x9B, 0xC5, 0x50, 0xB7, 0x53, 0x31, 0xBE, 0x27, 0xCB, 0x6B, 0x72, 0xB7, 0xEC,
+    0x9A, 0x0F, 0x16, 0x37, 0x7A, 0x5D, 0x2A, 0x78, 0xD0, 0x7F, 0x84, 0xF0, 0xC1, 0x43, 0x5C, 0xEA,
+    0x11, 0x8C, 0x01, 0x6F, 0x29, 0x70, 0xA1, 0x97, 0xA0, 0x19, 0xB4, 0x01, 0x52, 0x06, 0x2D, 0x4B,
+    0x3F, 0xDD, 0xF7, 0x06, 0x2D, 0xBA, 0xCC, 0x64, 0x60, 0x23, 0x60, 0xC3, 0x45, 0x22, 0xE0, 0xF9,
+    0x8D, 0x35, 0xC1, 0x87, 0x98, 0x06, 0x28, 0x12, 0xB0, 0x4A, 0x06, 0x9E, 0xF6, 0x4B, 0xCF, 0x90,
+    0x0E, 0x0C, 0x95, 0xC8, 0xC9, 0xF9, 0xFD, 0x5E, 0x23, 0xE6, 0xD7, 0x22, 0x69, 0xEA, 0x3F, 0xCD,
+    0x81, 0xB3, 0xB4, 0x99, 0x23, 0xE0, 0xF9, 0xA7, 0xC7, 0xF7, 0x98, 0xA8, 0xAD, 0x32, 0xB8, 0xEA,
+    0x87, 0x29, 0x23, 0x93, 0x65, 0xA9, 0x8E, 0x3E, 0xE1, 0xD2, 0x45, 0xF9, 0xDF, 0xA3, 0x48, 0x15,
+    0x20, 0x09, 0x24, 0x00, 0xC6, 0x11, 0x59, 0xB5, 0xBA, 0xC1, 0x00, 0xF2, 0xB6, 0xE5, 0xB4, 0xBF,
+    0xB0, 0x17, 0xDC, 0x1C, 0xAC, 0x68, 0xD2, 0x61, 0x76, 0x38, 0x0C, 0x37, 0x0F, 0xF5, 0x77, 0x3B,
+    0x54, 0x96, 0x58, 0xB8, 0x50, 0xD6, 0x10, 0x00, 0xF2, 0x09, 0xD2, 0x55, 0x6E, 0x6E, 0x8F, 0x8E,
+    0x94, 0xE9, 0xE9, 0x4C, 0x54, 0x87, 0xAB, 0x55, 0x50, 0xC7, 0x4D, 0x0C, 0x2D, 0x12, 0x50, 0xA9,
+    0xDB, 0xBB, 0x0D, 0x6F, 0x3E, 0x54, 0xA2, 0x58, 0x7F, 0x36, 0x4D, 0x8F, 0xB8, 0x81, 0xD5, 0xDA,
+    0x10, 0x8D, 0x05, 0xCC, 0xD4, 0x82, 0xA9, 0x7C, 0xC0, 0x88, 0x4F, 0x80, 0x7E, 0xB5, 0x02, 0xCC,
+    0xA9, 0x2B, 0x9E, 0x7F, 0x7C, 0xFE, 0x82, 0x62, 0xCB, 0x6E, 0x9B, 0x3B, 0x94, 0x6A, 0x7E, 0x40,
+    0x7C, 0xCB, 0xDF, 0x90, 0xFC, 0x2C, 0x7E, 0x49, 0x37, 0x1A, 0x3A, 0xF1, 0x1D, 0x3B, 0xC9, 0x2F,
+    0x13, 0x37, 0xB7, 0xCF, 0xB0, 0xC9, 0x4A, 0x70, 0x8F, 0xD0, 0x46, 0xCA, 0x27, 0x93, 0x1B, 0xB3,
+    0x35, 0x22, 0xB9, 0xA1, 0x97, 0x20, 0xEE, 0xC7, 0x21, 0x74, 0xD5, 0x1F, 0x68, 0x9E, 0xF9, 0xA6,
+    0xE8, 0x2F, 0xB0, 0xF2, 0x1E, 0x12, 0x43, 0xDC, 0x80, 0x98, 0x11, 0x34, 0x2D, 0x74, 0x03, 0xB8,
+    0xCB, 0x8E, 0xC0, 0x4C, 0xF5, 0x93, 0x05, 0x5B, 0x51, 0x2A, 0x0C, 0xD0, 0x05, 0x93, 0x98, 0xEB,
+    0xA3, 0x2D, 0xD5, 0xDD, 0xF4, 0x57, 0xF9, 0xD6, 0xA9, 0x39, 0x1D, 0x3A, 0x95, 0xDF, 0x52, 0x57,
+    0x88, 0xA9, 0x98, 0x8D, 0xF5, 0x26, 0x81, 0xF6, 0x34, 0x5B, 0x81, 0x52, 0xB9, 0xD0, 0x27, 0x6C,
+    0x73, 0x4E, 0xDF, 0x61, 0x2A, 0x75, 0xA9, 0xF5, 0x1B, 0x48, 0x0F, 0x0E, 0xB6, 0xF7, 0x2B, 0x65,
+    0x0A, 0x48, 0x05, 0xC0, 0x9D, 0xB1, 0x4D, 0x0F, 0xA4, 0xD7, 0xE4, 0xE4, 0x3A, 0x68, 0xC0, 0x2B,
+    0x24, 0xBB, 0x0A, 0x72, 0x2D, 0x92, 0xA9, 0xC5, 0x22, 0xD9, 0x86, 0xDE, 0x9A, 0xB3, 0xF3, 0x15,
+    0xBC, 0x9D, 0x15, 0x60, 0xC5, 0x62, 0x25, 0xC0, 0x1B, 0x71, 0xF3, 0x08, 0x81, 0x9E, 0x1D, 0x9F,
+    0xE8, 0x7D, 0xA0, 0xB1, 0x8A, 0xB9, 0xC6, 0x30, 0xDA, 0x69, 0xF1, 0x34, 0x5D, 0x7D, 0x74, 0xE7,
+    0xCE, 0x6D, 0x54, 0xFA, 0x7A, 0x4D, 0x7F, 0xB3, 0xC6, 0x0E, 0x6B, 0xD3, 0xBA, 0xC1, 0xB3, 0xAF,
+    0x24, 0xA7, 0x31, 0x1E, 0xF3, 0xF3, 0x94, 0x1F, 0x2A, 0x1C, 0x4C, 0x7F, 0x36, 0x34, 0x8D, 0xEF,
+    0x0F, 0xDC, 0x25, 0x16, 0x43, 0xE2, 0xD3, 0x4D, 0x1C, 0xBC, 0xA4, 0xF8, 0xAD, 0xF6, 0xD6, 0x5B,
+    0x31, 0x5B, 0x9B, 0xC1, 0x5D, 0x82, 0xF9, 0xC1, 0xED, 0x62, 0x16, 0x7D, 0xE7, 0x76, 0x0B, 0x59,
+    0xB3, 0x5B, 0xF2, 0x9B, 0xAC, 0x6D, 0x76, 0x33, 0x99, 0xDF, 0xCD, 0x6C, 0x81, 0xFE, 0x21, 0x58,
+    0x68, 0xFD, 0xE9, 0x5C, 0x2C, 0x41, 0xFC, 0xE9, 0xF4, 0x3C, 0xEB, 0xFE, 0x0D, 0xA9, 0x7F, 0x02,
+    0x8D, 0x55, 0x31, 0x8F, 0x1D, 0x35, 0x10, 0xF6, 0xAE, 0xB9, 0xDB, 0x62, 0x15, 0x9C, 0x82, 0x2B,
+    0x93, 0x6D, 0x52, 0x44, 0xE8, 0x84, 0x2B, 0x3A, 0x90, 0x57, 0xF7, 0x07, 0x92, 0xE2, 0x9E, 0xC4,
+    0xCF, 0x80, 0x8A, 0x72, 0x57, 0xA2, 0xA0, 0xA0, 0xE1, 0x1F, 0xD0, 0x52, 0x20, 0x94, 0x02, 0x89,
+    0xE6, 0x24, 0x6F, 0x92, 0xE2, 0x4A, 0x56, 0xA2, 0xA2, 0x40, 0xDA, 0x8E, 0x12, 0x1F, 0x7A, 0x85,
+    0x91, 0xBC, 0x3B, 0x7C, 0x9F, 0x77, 0x2F, 0xEF, 0xE5, 0x94, 0x43, 0x59, 0xC9, 0xF6, 0xBC, 0xF1,
+    0x78, 0x3C, 0xFE, 0xE6, 0x9B, 0x79, 0xBB, 0x1D, 0x3F, 0x2F, 0xF8, 0x96, 0xE3, 0x59, 0x1D, 0x7D,
+    0xBB, 0x7B, 0x6C, 0x9C, 0x68, 0x09, 0x56, 0x0A, 0x09, 0x46, 0x94, 0x0F, 0x95, 0xF4, 0x2E, 0x69,
+    0x19, 0xED, 0x52, 0xC9, 0xD4, 0xCD, 0x5A, 0x06, 0x97, 0xA0, 0xF3, 0xD8, 0x2D, 0x64, 0xB2, 0x54,
+    0x18, 0x19, 0x24, 0x1A, 0x69, 0xE5, 0x48, 0xD7, 0x51, 0x71, 0xAF, 0x2B, 0x27, 0xB5, 0x8C, 0x4E,
+    0x2A, 0xC8, 0x30, 0x19, 0x1B, 0x29, 0x65, 0xE4, 0xD9, 0xB1, 0x16, 0x25, 0x13, 0xEC, 0x24, 0xC0,
+    0x87, 0xDF, 0x63, 0xAF, 0x4B, 0xA5, 0x4C, 0xBC, 0x72, 0xF2, 0x98, 0x46, 0x9F, 0xB8, 0x11, 0xF3,
+    0x6E, 0x0E, 0x83, 0x27, 0xD6, 0x7B, 0x9B, 0x05, 0x5A, 0xBB, 0x46, 0x58, 0x4B, 0xFF, 0x3F, 0x51,
+    0xBD, 0xF7, 0xE5, 0x6E, 0xBD, 0x7C, 0x05, 0xCC, 0x0D, 0x4A, 0xE9, 0xF4, 0xFE, 0x42, 0x0D, 0x34,
+    0x0B, 0x8C, 0xE0, 0x30, 0x7D, 0x83, 0x91, 0x0E, 0x36, 0x15, 0x85, 0xEE, 0x8D, 0xD0, 0x43, 0x88,
+    0xEF, 0x14, 0x3C, 0x84, 0xFA, 0x7E, 0x41, 0xEF, 0x21, 0x34, 0x2D, 0x26, 0x0A, 0x15, 0x85, 0x27,
+    0x8C, 0xB5, 0xDD, 0x92, 0x5C, 0x7C, 0x81, 0x49, 0xB6, 0x4B, 0x4D, 0xD8, 0x82, 0xBB, 0xAB, 0x28,
+    0x64, 0x8B, 0xA6, 0x21, 0x62, 0x22, 0x8C, 0xFC, 0x77, 0x8C, 0x7F, 0x45, 0xA6, 0x35, 0x8E, 0x62,
+    0xD9, 0x82, 0x6A, 0xA6, 0xF5, 0xF6, 0x72, 0xD9, 0x22, 0xB0, 0xC4, 0x57, 0x66, 0x1E, 0x79, 0x8D,
+    0x71, 0xB3, 0x78, 0x5A, 0x20, 0x1A, 0x3D, 0xF3, 0x26, 0x04, 0xE2, 0x46, 0xDC, 0x74, 0xAB, 0xE8,
+    0xA0, 0x30, 0xE3, 0x16, 0xEF, 0x39, 0x86, 0x3E, 0x0E, 0x17, 0x0C, 0x9C, 0x95, 0x86, 0x9B, 0xA8,
+    0x18, 0x47, 0x50, 0x84, 0x6E, 0x20, 0x88, 0x92, 0xE1, 0x4C, 0x59, 0xB1, 0x57, 0x54, 0x8C, 0xB4,
+    0x93, 0xBE, 0xC9, 0xBC, 0xEE, 0xB8, 0x59, 0x52, 0xC1, 0x68, 0x70, 0x86, 0x76, 0xC8, 0x3D, 0xBE,
+    0xB9, 0xE2, 0x1C, 0x2D, 0xE7, 0x89, 0x53, 0x8E, 0x53, 0x24, 0xDB, 0x25, 0x1E, 0x94, 0x7F, 0xB2,
+    0x62, 0x5C, 0x63, 0xF8, 0x88, 0xA0, 0x76, 0x20, 0x57, 0xE8, 0xE4, 0x5A, 0x62, 0x37, 0x57, 0xB3,
+    0xFA, 0x9C, 0x1B, 0x27, 0xCF, 0xBB, 0x57, 0xF2, 0x6C, 0x76, 0x51, 0xFE, 0x92, 0xE1, 0xCE, 0x0F,
+    0xB5, 0xE3, 0xF6, 0xA0, 0x11, 0xC9, 0x2B, 0x69, 0x9B, 0x58, 0xCA, 0x33, 0x88, 0xC1, 0xC0, 0xA0,
+    0x44, 0x30, 0x31, 0x57, 0x00, 0x4D, 0xC9, 0xE4, 0x61, 0xE7, 0xBD, 0x87, 0xC3, 0x92, 0xB9, 0x28,
+    0x66, 0x65, 0x99, 0x91, 0xF3, 0x17, 0xC0, 0xE6, 0xC1, 0x9F, 0xC8, 0x8B, 0xFE, 0xBA, 0xB5, 0x83,
+    0xFA, 0x63, 0x04, 0xD4, 0x9F, 0xFD, 0x82, 0x14, 0x99, 0x04, 0xC0, 0x8B, 0x85, 0x89, 0x3A, 0x29,
+    0x89, 0x61, 0x4E, 0x57, 0x86, 0x36, 0x67, 0x20, 0xA7, 0x52, 0xB9, 0x89, 0x4C, 0x40, 0x42, 0x81,
+    0xF5, 0xD3, 0xD3, 0xBE, 0x4E, 0x9F, 0xBE, 0x7E, 0xA2, 0xE7, 0x0F, 0xBF, 0xFA, 0x55, 0x4B, 0xF5,
+    0xD3, 0xCF, 0x2F, 0x45, 0x5D, 0x9F, 0xBF, 0x40, 0xFD, 0x5D, 0x47, 0x3F, 0x54, 0xE3, 0x55, 0x37,
+    0xBD, 0xE9, 0x03, 0xAC, 0x93, 0x64, 0xC0, 0xFA, 0x3D, 0x43, 0xDC, 0xEA, 0x64, 0x2D, 0xA0, 0x97,
+    0x12, 0x73, 0x9D, 0x90, 0x15, 0xB9, 0x1A, 0xB2, 0x85, 0x8B, 0xB5, 0x5C, 0xAC, 0xBF, 0x50, 0x57,
+    0x34, 0xBD, 0x38, 0x14, 0x89, 0xD2, 0x7D, 0xDD, 0x3F, 0x42, 0x48, 0x6E, 0xC0, 0xAE, 0x96, 0x3A,
+    0x99, 0xD8, 0x04, 0x37, 0xFA, 0x5E, 0x2E, 0xF0, 0x84, 0x2A, 0x9A, 0xD0, 0x0C, 0xB6, 0xEF, 0x00,
+    0xB3, 0x52, 0xCF, 0x33, 0x79, 0xBB, 0xC1, 0x4D, 0x4D, 0xA8, 0x22, 0xE0, 0xB8, 0xCA, 0x2E, 0xCA,
+    0xBD, 0x6D, 0xBB, 0xEB, 0xA4, 0x67, 0xE8, 0x6F, 0xD0, 0x38, 0xBE, 0x8B, 0x3A, 0xB9, 0xA1, 0x1E,
+    0xAE, 0x0E, 0xCD, 0xEB, 0xB4, 0x6F, 0xD4, 0x23, 0x65, 0xC7, 0xAE, 0xF7, 0xCA, 0x86, 0x6E, 0x40,
+    0x13, 0xDA, 0xDB, 0xC9, 0x8D, 0x55, 0x32, 0xFB, 0x26, 0x10, 0x2C, 0x50, 0xD0, 0x17, 0xA9, 0x8C,
+    0xEA, 0x03, 0x98, 0x3F, 0x54, 0xC5, 0xF7, 0x19, 0x6A, 0xC0, 0x06, 0xB0, 0xC0, 0x23, 0x70, 0x6A,
+    0x2C, 0xE5, 0x37, 0xB6, 0x0C, 0xD0, 0x0C, 0x06, 0x0F, 0x54, 0x35, 0x02, 0x5D, 0x3F, 0xB8, 0x60,
+    0x22, 0xD8, 0xED, 0x02, 0x12, 0x87, 0x8E, 0x60, 0x13, 0x74, 0x70, 0x83, 0xDA, 0x7A, 0x88, 0xD7,
+    0xB5, 0xE0, 0x82, 0x8E, 0xD8, 0xA5, 0x56, 0xDA, 0x8A, 0xBB, 0x36, 0x19, 0xF8, 0xE9, 0xED, 0x54,
+    0x44, 0xF5, 0x58, 0xA9, 0x3E, 0xA3, 0x1A, 0x37, 0x74, 0xB7, 0xB5, 0x49, 0x6F, 0xAF, 0x96, 0x2B,
+    0xA0, 0x75, 0x84, 0xBB, 0x94, 0xF0, 0xF1, 0x8F, 0xE8, 0x4C, 0xCA, 0x43, 0xEB, 0x50, 0x59, 0x4E,
+    0x72, 0x90, 0xCC, 0x4D, 0xC9, 0xF0, 0xD0, 0xFD, 0x6A, 0xF2, 0xB3, 0x24, 0x8F, 0xE9, 0x9F, 0xCD,
+    0x3A, 0xF7, 0x24, 0x16, 0x0C, 0x32, 0x8E, 0x2A, 0x88, 0x00, 0x1A, 0x99, 0x01, 0xD3, 0xB0, 0xA2,
+    0x36, 0x86, 0x26, 0xD9, 0x84, 0x67, 0xB6, 0x36, 0xB1, 0xEB, 0xF2, 0x25, 0xEC, 0x8B, 0xA4, 0xE0,
+    0xD9, 0x25, 0xAA, 0x21, 0x9C, 0x5D, 0x2A, 0xD6, 0x4D, 0x26, 0xE1, 0xF6, 0xE7, 0x50, 0xC9, 0x22,
+    0xF4, 0x6F, 0xC0, 0x7B, 0x96, 0xBE, 0x93, 0xD0, 0xA0, 0xDC, 0x50, 0x6F, 0x80, 0x22, 0x57, 0x66,
+    0xCB, 0x41, 0x19, 0x3A, 0xF4, 0xCF, 0x48, 0x17, 0xE1, 0xE8, 0x5F, 0xE5, 0x6C, 0x2B, 0x65, 0x3F,
+    0xAC, 0xAB, 0xDC, 0xAE, 0xE3, 0x5B, 0x6B, 0x21, 0x2B, 0x01, 0xCB, 0x6D, 0x55, 0x5F, 0xAA, 0x46,
+    0xD5, 0x01, 0x14, 0xF0, 0xE0, 0x8E, 0x09, 0x20, 0xBB, 0x40, 0x00, 0x2D, 0xF0, 0x04, 0x42, 0x1C,
+    0x6A, 0xBC, 0x01, 0xDE, 0x90, 0xDC, 0xA4, 0xCC, 0xA1, 0x63, 0xAC, 0x5F, 0xC5, 0x1E, 0xEE, 0xA3,
+    0x5B, 0x0C, 0x8A, 0xFB, 0x46, 0x12, 0xC1, 0x29, 0xB8, 0xF1, 0x94, 0x77, 0xF0, 0x4A, 0xD7, 0xDE,
+    0xE9, 0xD0, 0xA7, 0xB8, 0xB9, 0xCA, 0x24, 0xC0, 0x8B, 0xD9, 0x77, 0xF4, 0xDC, 0xFD, 0x1D, 0x1E,
+    0x57, 0x51, 0xDA, 0x16, 0x8C, 0x43, 0x93, 0x43, 0x43, 0xF4, 0xDF, 0xA6, 0x55, 0x10, 0x08, 0x26,
+    0xA2, 0xDA, 0xE4, 0x87, 0x3D, 0x5B, 0x53, 0x7E, 0x3E, 0x61, 0x62, 0x2A, 0x88, 0x57, 0xBB, 0x3E,
+    0xCD, 0xCC, 0xEA, 0x20, 0x14, 0xD4, 0x7E, 0xA2, 0xDE, 0xF9, 0xED, 0x36, 0x0E, 0x94, 0x04, 0x88,
+    0xC5, 0xA3, 0x79, 0xCA, 0xCD, 0x99, 0x14, 0x00, 0x15, 0x4E, 0x6B, 0x62, 0xC3, 0xAB, 0x0C, 0x10,
+    0x46, 0xA2, 0xE6, 0xDB, 0x71, 0xB6, 0xDB, 0x5D, 0x02, 0x80, 0x2A, 0x16, 0x4B, 0x97, 0x1B, 0x75,
+    0x42, 0xFA, 0x61, 0xD1, 0xAB, 0x93, 0xCD, 0xFB, 0x7F, 0x8D, 0x55, 0x31, 0x6F, 0xDD, 0x54, 0x14,
+    0x3E, 0xB6, 0x69, 0xAD, 0xE2, 0x4A, 0xB7, 0x43, 0xBB, 0x54, 0x82, 0xCB, 0x86, 0x40, 0x34, 0xFE,
+    0x03, 0x2F, 0xB1, 0xD3, 0x08, 0x31, 0x64, 0x48, 0x86, 0x66, 0x85, 0x8A, 0x81, 0x81, 0x81, 0xB7,
+    0x64, 0xC8, 0x90, 0xF6, 0xBA, 0x54, 0xA8, 0x63, 0x23, 0x31, 0x56, 0x15, 0x0C, 0x0C, 0x30, 0xA0,
+    0x32, 0xD1, 0x08, 0x3D, 0xF5, 0xBA, 0xE9, 0xD0, 0x81, 0x21, 0x26, 0x19, 0xD8, 0x5A, 0x43, 0x11,
+    0x20, 0x31, 0x60, 0x52, 0xA3, 0xBA, 0x8D, 0xFD, 0x0E, 0xDF, 0xB9, 0x7E, 0x09, 0x2F, 0x80, 0x44,
+    0xFD, 0xE4, 0xF3, 0x8E, 0xED, 0xCF, 0xF7, 0x9E, 0xF3, 0x9D, 0xEF, 0x1C, 0x13, 0xB9, 0xE3, 0x9C,
+    0x18, 0x75, 0x1E, 0xE6, 0xD1, 0xF7, 0x39, 0x91, 0xE5, 0x8A, 0x28, 0xE6, 0x1A, 0xD7, 0x06, 0x1E,
+    0x25, 0x9C, 0xC2, 0xE3, 0x06, 0x98, 0xCB, 0x23, 0x22, 0x7F, 0xE9, 0xA3, 0x8B, 0xE4, 0x3D, 0x2A,
+    0x47, 0xA7, 0xA9, 0x79, 0x4F, 0xCF, 0xA8, 0x0F, 0xCC, 0x3E, 0x2F, 0x32, 0xDB, 0x31, 0x99, 0xB1,
+    0xCF, 0x45, 0xC8, 0x1F, 0x33, 0x2B, 0x66, 0x7E, 0x78, 0x75, 0xFF, 0xE1, 0x6A, 0x9D, 0xBE, 0x5B,
+    0xA5, 0x03, 0xA2, 0x4D, 0x9A, 0x3E, 0x3A, 0x9C, 0x41, 0x0B, 0x13, 0xCA, 0x26, 0xAA, 0x84, 0x89,
+    0x73, 0xD9, 0x2E, 0x83, 0x61, 0x9C, 0xFE, 0x21, 0x22, 0x12, 0x84, 0x76, 0x61, 0x08, 0xC2, 0x1E,
+    0x20, 0x82, 0xB1, 0xBC, 0x2E, 0x08, 0x25, 0x88, 0x58, 0x10, 0x46, 0x10, 0x0C, 0x84, 0x77, 0x88,
+    0x88, 0x04, 0xA1, 0x05, 0x91, 0x54, 0x47, 0x42, 0x38, 0xFE, 0x19, 0xCC, 0xFB, 0x29, 0x79, 0x96,
+    0x73, 0x8A, 0xB8, 0xC5, 0x89, 0x0C, 0x2D, 0x73, 0x96, 0x30, 0x77, 0x01, 0xE2, 0x2F, 0x4C, 0x13,
+    0x72, 0xC8, 0x99, 0xA9, 0x74, 0x46, 0x7C, 0xA5, 0x21, 0xD5, 0x9C, 0x90, 0x3D, 0x36, 0xFA, 0x6D,
+    0x25, 0x9C, 0xE0, 0xA8, 0x53, 0xC0, 0xE9, 0xA6, 0x1D, 0x09, 0xC8, 0x81, 0x6D, 0xDE, 0x87, 0xE2,
+    0x49, 0x74, 0x12, 0x8E, 0x66, 0xB9, 0xA8, 0x70, 0x76, 0x72, 0x51, 0x50, 0x28, 0x7C, 0x1B, 0x30,
+    0x1D, 0xE1, 0x82, 0x2C, 0xEE, 0x46, 0x92, 0x84, 0xAD, 0xFE, 0xCB, 0x51, 0xE2, 0x48, 0x95, 0x94,
+    0xE4, 0xC8, 0xE0, 0x4F, 0x15, 0x13, 0x5A, 0x5F, 0x90, 0xE4, 0x52, 0x7A, 0xBE, 0x43, 0x35, 0x13,
+    0xC2, 0x0E, 0x1D, 0xED, 0x82, 0xCC, 0xA7, 0x9C, 0x18, 0x8E, 0x2F, 0x4E, 0x82, 0xE5, 0x03, 0x09,
+    0xEE, 0xCC, 0x05, 0x3C, 0x5A, 0x99, 0xDA, 0xE3, 0xAC, 0x70, 0x79, 0x0A, 0x29, 0x48, 0x34, 0x85,
+    0x07, 0xEE, 0x80, 0x2C, 0xB5, 0xFB, 0xD7, 0x85, 0xAD, 0x23, 0xDC, 0x37, 0x69, 0x27, 0x54, 0x78,
+    0x1D, 0xE5, 0x52, 0x31, 0x57, 0xD6, 0xB8, 0xA4, 0xB8, 0xE8, 0xD9, 0x11, 0x89, 0xA1, 0x6A, 0x8E,
+    0x35, 0x10, 0xA5, 0x26, 0x8F, 0x5D, 0xCD, 0xF1, 0x4C, 0xF2, 0x55, 0xAD, 0xA3, 0xD9, 0x43, 0xBA,
+    0xA2, 0x07, 0xC3, 0x8E, 0x5F, 0xE5, 0x48, 0x14, 0x91, 0xF6, 0x0C, 0x0B, 0x19, 0x10, 0x43, 0x20,
+    0x0B, 0x42, 0x53, 0x4A, 0x16, 0xD4, 0x40, 0xCA, 0x82, 0x27, 0x81, 0x2C, 0x5C, 0xC4, 0x51, 0xD3,
+    0x47, 0xFE, 0xDA, 0xF3, 0xF1, 0x24, 0x75, 0x04, 0xD5, 0xBE, 0x2C, 0x9A, 0x34, 0x14, 0x75, 0x7D,
+    0xF1, 0xE0, 0xA2, 0x26, 0xB9, 0xDB, 0x13, 0xFB, 0x87, 0xC2, 0x12, 0x94, 0x74, 0x6C, 0x45, 0x88,
+    0xAA, 0xDD, 0x9B, 0x7A, 0xB2, 0x21, 0x51, 0x26, 0x6A, 0x23, 0xB0, 0xD2, 0x90, 0xD7, 0x40, 0x67,
+    0xA9, 0xF0, 0xC4, 0x39, 0x2C, 0x14, 0xE6, 0x03, 0xAE, 0x6A, 0xBF, 0x2B, 0x90, 0x83, 0x68, 0x3F,
+    0x6C, 0x83, 0x69, 0xDB, 0x1E, 0xD8, 0xC8, 0x59, 0xD5, 0x88, 0xA8, 0xE2, 0x5A, 0xF8, 0xE4, 0x0A,
+    0x36, 0xE6, 0x1C, 0xB9, 0x5B, 0x16, 0x06, 0x44, 0xCA, 0xAD, 0x84, 0xE4, 0x3B, 0x4B, 0xEB, 0xCE,
+    0x9E, 0x74, 0x16, 0xE1, 0x49, 0x38, 0xDE, 0x53, 0xFA, 0x1F, 0x95, 0x80, 0x36, 0xE4, 0xAA, 0xC7,
+    0xA2, 0x57, 0xCD, 0x62, 0x63, 0x16, 0x11, 0x24, 0x1C, 0x4C, 0xD9, 0x79, 0x88, 0x40, 0x24, 0x3B,
+    0x75, 0x78, 0x6E, 0x7D, 0x91, 0x7C, 0x5F, 0xBB, 0xD0, 0x11, 0x6D, 0x05, 0xA3, 0xA4, 0x01, 0x5D,
+    0x67, 0xF6, 0x55, 0x0F, 0x8E, 0xA0, 0x24, 0x7E, 0xD4, 0x39, 0x07, 0x4A, 0xB5, 0x82, 0xE2, 0x02,
+    0xF5, 0xD7, 0x1D, 0x18, 0xF0, 0xB9, 0x04, 0xEA, 0xCC, 0x8A, 0xEB, 0x65, 0xA7, 0x94, 0x23, 0x6B,
+    0x49, 0x5E, 0x4E, 0x37, 0x7D, 0xFF, 0x4F, 0x50, 0xD9, 0xC1, 0x64, 0xE8, 0x51, 0x49, 0xE5, 0x5D,
+    0x90, 0x89, 0x00, 0xA9, 0x19, 0xE1, 0x4A, 0x28, 0x2A, 0x80, 0x42, 0x55, 0x55, 0x0D, 0x49, 0xF9,
+    0x2C, 0x2D, 0xE9, 0x66, 0x84, 0x9B, 0x1B, 0x64, 0x8A, 0xBF, 0xD7, 0x92, 0x65, 0xB5, 0x24, 0xE2,
+    0x04, 0xF0, 0x2F, 0x94, 0x72, 0x28, 0x77, 0xAD, 0xE5, 0xB9, 0x2F, 0x78, 0xF4, 0x83, 0x13, 0x5A,
+    0x39, 0xBB, 0xB6, 0xF6, 0xC6, 0xD7, 0x37, 0x6F, 0x3F, 0x78, 0xF2, 0xE0, 0xCF, 0x99, 0xD1, 0x9C,
+    0xE9, 0x92, 0x56, 0xF5, 0x93, 0xE8, 0x25, 0x52, 0x99, 0x2A, 0xA3, 0xB5, 0xF0, 0xED, 0xE0, 0xFE,
+    0x16, 0xB7, 0xA8, 0x5E, 0x4C, 0x51, 0x9E, 0xB4, 0xA6, 0x5D, 0xA3, 0x35, 0x32, 0xA5, 0x6D, 0x69,
+    0x8E, 0x66, 0x5E, 0xB9, 0x6C, 0x3A, 0xDB, 0x0E, 0xCB, 0xB0, 0x8B, 0x78, 0x21, 0xF7, 0x7E, 0xCB,
+    0x6C, 0x9B, 0x2C, 0x5D, 0xCF, 0xF6, 0xCA, 0xC1, 0xA5, 0xA1, 0xE2, 0x54, 0x98, 0x8D, 0xF9, 0x5B,
+    0x88, 0x71, 0x9D, 0x66, 0xB0, 0x60, 0x58, 0xF8, 0x35, 0xB5, 0x94, 0x90, 0xCE, 0x55, 0xE9, 0x2D,
+    0xA3, 0xCF, 0xD4, 0xAD, 0x85, 0xBB, 0x65, 0xB5, 0x19, 0xB7, 0x18, 0x66, 0x5B, 0x8F, 0xCB, 0xC1,
+    0x1D, 0xA3, 0xF9, 0x8A, 0xCD, 0xA2, 0x52, 0xF1, 0x5B, 0xF3, 0x3F, 0xE6, 0x83, 0xAF, 0xD4, 0x4C,
+    0xB4, 0xCB, 0x75, 0xDC, 0x9E, 0xD2, 0x9A, 0xAF, 0x39, 0xDE, 0xA4, 0x22, 0x7F, 0xD8, 0x4F, 0x5D,
+    0x23, 0x1B, 0xE6, 0x2A, 0xC6, 0x44, 0x44, 0x0F, 0xDB, 0x2D, 0x06, 0xF1, 0x9C, 0x05, 0x2D, 0x06,
+    0x1C, 0x2F, 0xD5, 0x94, 0xEC, 0x0A, 0x7B, 0xB8, 0x31, 0x4E, 0x4A, 0xE2, 0xEB, 0x2D, 0x99, 0x5F,
+    0x40, 0xE3, 0x53, 0x88, 0x91, 0x45, 0xD2, 0xBF, 0xA3, 0xA4, 0x55, 0x54, 0x46, 0x9F, 0x04, 0x77,
+    0x77, 0x7E, 0x1E, 0xDC, 0xDE, 0x9E, 0x7D, 0xB2, 0xFD, 0xE5, 0x5E, 0x35, 0xBA, 0x63, 0x14, 0x9F,
+    0xE7, 0x3C, 0xCE, 0xBC, 0x34, 0xCE, 0x93, 0xFC, 0xD5, 0x3C, 0x74, 0xBF, 0x08, 0xBF, 0xE1, 0xAF,
+    0xB6, 0xB3, 0x9D, 0x46, 0x93, 0x2C, 0x2E, 0x48, 0x46, 0x5A, 0x28, 0x2A, 0x54, 0xA9, 0x2B, 0xF5,
+    0xEC, 0x1A, 0xEF, 0x71, 0x7B, 0x76, 0x43, 0xB1, 0xE7, 0x95, 0x34, 0xA0, 0x97, 0x03, 0x96, 0x0A,
+    0x8E, 0x4E, 0x6B, 0xC5, 0xF7, 0xF9, 0x07, 0xEB, 0x0A, 0x41, 0x2A, 0x8F, 0xAA, 0x70, 0x14, 0x6C,
+    0x07, 0xF7, 0xB6, 0xF6, 0x3B, 0xE6, 0x37, 0x87, 0x20, 0xC4, 0xAB, 0x5F, 0xFF, 0xDC, 0xB4, 0xAB,
+    0xB4, 0x4A, 0x76, 0x03, 0x9C, 0xCE, 0xD2, 0xDC, 0xC5, 0x4B, 0xE0, 0xB4, 0x19, 0x6E, 0xF8, 0xE3,
+    0x90, 0xAF, 0x16, 0x58, 0xEE, 0x9B, 0x9F, 0x62, 0x5E, 0xDA, 0x79, 0x5C, 0x0D, 0x46, 0xEA, 0x9D,
+    0x1B, 0xF7, 0xB8, 0x8C, 0x4B, 0xCB, 0xE8, 0x29, 0xAF, 0xA2, 0x11, 0x6A, 0xA0, 0xD3, 0xA8, 0x08,
+    0x2A, 0xB0, 0x6A, 0x28, 0xCE, 0x8E, 0x2D, 0x7B, 0xCB, 0x21, 0x07, 0x3B, 0x55, 0x35, 0x98, 0x8D,
+    0x23, 0x9E, 0xE7, 0xEF, 0xAA, 0xF5, 0x4D, 0x35, 0xBC, 0xB5, 0x0B, 0x9A, 0xCA, 0xE3, 0x1B, 0x11,
+    0x87, 0x1F, 0x3A, 0x52, 0xCF, 0x85, 0x20, 0x15, 0x23, 0x53, 0x9D, 0x58, 0x44, 0x78, 0x93, 0x29,
+    0xF0, 0xCC, 0x09, 0x13, 0x32, 0x05, 0x81, 0x18, 0x52, 0x10, 0x02, 0x14, 0xE6, 0x14, 0xEE, 0x74,
+    0x8D, 0x07, 0x72, 0xB7, 0x96, 0xD6, 0x10, 0xD9, 0xE2, 0x63, 0x07, 0x75, 0xCB, 0x75, 0xE7, 0x9E,
+    0xE3, 0x2D, 0x0C, 0x6A, 0x51, 0x9E, 0x34, 0xA4, 0x7B, 0xD9, 0x93, 0xDB, 0xA5, 0x48, 0x50, 0xB4,
+    0x69, 0x26, 0x5E, 0x26, 0x1F, 0x6E, 0x48, 0x5B, 0xC6, 0x5D, 0xD2, 0x62, 0x30, 0xA5, 0xF2, 0xB5,
+    0x78, 0xF1, 0x8B, 0x7F, 0xB6, 0xF9, 0x5F, 0xCD, 0x55, 0x3D, 0x73, 0xDE, 0x44, 0x10, 0x5E, 0x49,
+    0x18, 0xCD, 0xA0, 0x42, 0x0D, 0xA1, 0x49, 0xA1, 0x8A, 0x26, 0x05, 0x6A, 0xE9, 0x4E, 0xA9, 0x28,
+    0x49, 0x61, 0x92, 0x32, 0xD4, 0x34, 0xF9, 0x05, 0x70, 0xEF, 0xE0, 0x22, 0x2D, 0x05, 0xA4, 0x35,
+    0x05, 0x85, 0xC7, 0x14, 0xFE, 0x03, 0x89, 0xEF, 0x20, 0x45, 0x0A, 0x1A, 0xA5, 0x60, 0x28, 0x28,
+    0x10, 0x83, 0x19, 0x33, 0xA4, 0xF0, 0x31, 0x11, 0x46, 0xCE, 0x9C, 0xB4, 0x3C, 0xBB, 0xA7, 0xD7,
+    0x71, 0xC2, 0x1F, 0xE0, 0xE6, 0x9D, 0x7D, 0x4E, 0x77, 0xDA, 0xD5, 0x7E, 0x3C, 0xBB, 0x6F, 0x15,
+    0xA8, 0x98, 0x89, 0x8C, 0xA7, 0x2A, 0x12, 0x71, 0x47, 0x6D, 0x3A, 0x70, 0x9E, 0xEA, 0x91, 0x72,
+    0x26, 0xB2, 0x69, 0xB7, 0xA4, 0x5D, 0xBA, 0x95, 0xF7, 0x06, 0xAA, 0x26, 0x7D, 0xC1, 0x6D, 0xC8,
+    0x0C, 0x54, 0x4F, 0x54, 0x2C, 0x7A, 0x63, 0x7B, 0x31, 0x52, 0x47, 0x79, 0xCE, 0xF1, 0xCC, 0x9E,
+    0x6C, 0x20, 0x33, 0x52, 0x13, 0xA9, 0x5E, 0xA8, 0x62, 0x2A, 0x78, 0x93, 0xB3, 0xCF, 0x78, 0xA0,
+    0xC3, 0xAF, 0x09, 0xEB, 0xE0, 0x06, 0x84, 0xAD, 0x3D, 0x51, 0x7B, 0x3F, 0x10, 0xD5, 0x4F, 0x27,
+    0xA2, 0x22, 0x3C, 0xC2, 0x61, 0x34, 0xDB, 0x1B, 0xFB, 0xCF, 0x44, 0x19, 0xB3, 0x28, 0x33, 0x7B,
+    0x11, 0x83, 0x88, 0x31, 0x67, 0x7E, 0x36, 0x13, 0x33, 0x74, 0x1C, 0x87, 0x63, 0x32, 0x73, 0x34,
+    0x5D, 0xB3, 0x40, 0xA7, 0xE2, 0xBB, 0x7B, 0xA1, 0xE0, 0x1F, 0x70, 0xC3, 0xCF, 0x47, 0xDC, 0x44,
+    0xB9, 0x61, 0x53, 0x43, 0xFB, 0x6C, 0x2F, 0x40, 0xE7, 0xD7, 0x48, 0x86, 0xC7, 0xE3, 0x37, 0x2A,
+    0x66, 0x77, 0x76, 0x13, 0xD6, 0xB8, 0x37, 0x62, 0x13, 0xCF, 0xBC, 0x90, 0x3C, 0x6F, 0x6A, 0xF9,
+    0x90, 0x6C, 0x27, 0x6A, 0xE4, 0xB0, 0x82, 0x0E, 0xE5, 0xE3, 0x67, 0xE2, 0x5B, 0xBB, 0x41, 0xE2,
+    0xEA, 0x9E, 0xA8, 0x79, 0x0C, 0xAF, 0xB3, 0x6E, 0x97, 0x2E, 0xD7, 0x3D, 0xFE, 0x03, 0x2E, 0xC3,
+    0x51, 0x7C, 0x80, 0x11, 0xB6, 0x98, 0x52, 0x77, 0xE1, 0xE4, 0x9F, 0x47, 0xF0, 0x02, 0x5A, 0x05,
+    0x43, 0x0B, 0x5E, 0x41, 0x54, 0x0C, 0x53, 0x84, 0x5B, 0x04, 0x8F, 0x8C, 0xDE, 0x23, 0x0E, 0x25,
+    0x8F, 0xD8, 0x5A, 0xBE, 0x89, 0xED, 0x2C, 0xA7, 0x16, 0x2F, 0x4C, 0x25, 0x12, 0xCB, 0xBD, 0x2D,
+    0x3B, 0xC7, 0xCF, 0x78, 0x2C, 0xC5, 0xC5, 0xCE, 0xAC, 0x69, 0x58, 0xBD, 0x9D, 0xE4, 0x93, 0xB0,
+    0xA7, 0xDB, 0x4C, 0xB7, 0x2F, 0x57, 0xE6, 0xBE, 0x40, 0x92, 0x59, 0x4A, 0x0D, 0xCD, 0x9C, 0x1F,
+    0x20, 0x95, 0x91, 0xDE, 0xEB, 0x8A, 0x89, 0xD4, 0xDF, 0xF9, 0x8A, 0xB8, 0xC6, 0x1F, 0x21, 0x22,
+    0x27, 0x6A, 0xB6, 0x23, 0xB5, 0x7A, 0x45, 0x08, 0x15, 0xAE, 0x8A, 0x56, 0x52, 0x20, 0x11, 0x35,
+    0x7C, 0x42, 0x9A, 0xAB, 0x4D, 0x23, 0xB9, 0x13, 0x31, 0x8A, 0x88, 0xEA, 0x00, 0xA8, 0x44, 0xD9,
+    0xE1, 0x26, 0x21, 0x32, 0xDB, 0x00, 0x73, 0xA8, 0x25, 0x1C, 0x57, 0x8C, 0x6A, 0xAE, 0x80, 0x13,
+    0x09, 0x79, 0x8B, 0x9D, 0x49, 0xE8, 0x5F, 0x45, 0x37, 0x00, 0xC5, 0x2D, 0xAC, 0xF9, 0x75, 0x44,
+    0x76, 0xEF, 0x2F, 0x76, 0x90, 0x2C, 0xEF, 0x71, 0xC2, 0xCF, 0xA5, 0xA8, 0xC8, 0xE4, 0x66, 0x8B,
+    0x4E, 0x0A, 0x52, 0xB3, 0xB7, 0x2B, 0x9A, 0x15, 0x9B, 0x15, 0xF1, 0x53, 0xAC, 0x04, 0x6F, 0x1C,
+    0x7E, 0xA3, 0x85, 0x12, 0x5D, 0x29, 0x6A, 0xA7, 0xD9, 0x84, 0xE3, 0xA6, 0x2F, 0x79, 0x75, 0xE3,
+    0x17, 0x95, 0x7F, 0xDF, 0xE6, 0xAF, 0xEE, 0xF0, 0xAE, 0xB4, 0x04, 0x14, 0x9B, 0x8B, 0xDB, 0x88,
+    0xB4, 0xD4, 0xC2, 0xE4, 0x29, 0x23, 0x4E, 0x38, 0x85, 0x82, 0x88, 0xAC, 0xC4, 0x57, 0xB9, 0x38,
+    0x11, 0x2E, 0x0C, 0x92, 0x2D, 0x33, 0xD1, 0x4A, 0x09, 0xF9, 0x92, 0x17, 0x50, 0xD2, 0x24, 0xD6,
+    0xBC, 0x72, 0x91, 0xA5, 0x8B, 0x3A, 0x29, 0x02, 0x97, 0x15, 0xC5, 0x3D, 0xE0, 0x8F, 0x56, 0xD5,
+    0x6B, 0x5F, 0x2B, 0x36, 0xBE, 0xEA, 0x57, 0x1C, 0xFE, 0x83, 0xE5, 0xD2, 0x35, 0xBE, 0x1E, 0x10,
+    0x8A, 0x6F, 0x7D, 0xDB, 0x93, 0x3D, 0xF2, 0xAD, 0x70, 0xF9, 0x61, 0xD6, 0xB5, 0x62, 0xEF, 0xA1,
+    0xBA, 0x4C, 0xF4, 0xA9, 0x62, 0x87, 0xB8, 0xC9, 0x2C, 0xB8, 0x6F, 0x17, 0x32, 0x01, 0x0F, 0x15,
+    0xFA, 0x28, 0x34, 0x83, 0xF8, 0x04, 0x84, 0x5F, 0xD5, 0x94, 0xB0, 0x88, 0xC0, 0x91, 0xDE, 0x57,
+    0x44, 0xC3, 0x1E, 0x09, 0x46, 0x90, 0x54, 0xEE, 0x23, 0x72, 0x29, 0xEF, 0xCF, 0x48, 0x81, 0xBF,
+    0x76, 0x6B, 0x67, 0x97, 0xAE, 0x5F, 0xD0, 0x6B, 0x0B, 0x41, 0x65, 0x68, 0x5A, 0x50, 0xDA, 0x2A,
+    0xED, 0x5A, 0x9F, 0x23, 0x13, 0x70, 0x15, 0x34, 0x05, 0x87, 0x1B, 0xC4, 0x36, 0x53, 0x39, 0xEE,
+    0x74, 0xA6, 0xA3, 0xB9, 0x08, 0x8D, 0xF8, 0x8D, 0xF5, 0xB3, 0xCA, 0xF3, 0x95, 0x0F, 0xAE, 0x99,
+    0x61, 0xA1, 0x7D, 0xC2, 0x1F, 0xF6, 0x54, 0x9E, 0xF3, 0x6F, 0x23, 0x65, 0x33, 0xCF, 0x51, 0x29,
+    0xEE, 0x24, 0x65, 0x67, 0x88, 0xA5, 0xE0, 0xE7, 0x92, 0x4A, 0x8E, 0x0E, 0x35, 0x68, 0x97, 0x66,
+    0x4E, 0xFC, 0xE9, 0x10, 0x54, 0x2F, 0x09, 0xB7, 0x41, 0xA8, 0x57, 0x47, 0x19, 0x9B, 0xC5, 0x92,
+    0x2D, 0xDB, 0x06, 0x7B, 0xF1, 0x25, 0x24, 0x6A, 0xDC, 0x6B, 0x13, 0x04, 0x5A, 0xD0, 0x4B, 0xA1,
+    0xB8, 0xE0, 0xDF, 0x5D, 0xA8, 0x4F, 0xC1, 0x6B, 0x6F, 0xF6, 0x31, 0x14, 0xBA, 0x05, 0xED, 0x7C,
+    0x5C, 0x5C, 0xC4, 0x77, 0xF3, 0xA9, 0x3E, 0x0D, 0x5C, 0x0D, 0x66, 0xFF, 0x71, 0x6C, 0x3D, 0xE6,
+    0x56, 0x70, 0x38, 0x36, 0xDF, 0x47, 0x39, 0xCE, 0x3E, 0xB6, 0x38, 0xA6, 0x6C, 0xB1, 0x98, 0xB5,
+    0xE5, 0x45, 0x44, 0xCE, 0xCC, 0x69, 0x30, 0xCB, 0x1D, 0xDE, 0x07, 0x55, 0x19, 0x46, 0xAC, 0x90,
+    0x89, 0xAE, 0x2B, 0x17, 0xE9, 0x9D, 0x23, 0xE9, 0xF5, 0x1D, 0x2D, 0xF8, 0xAC, 0xD5, 0xEE, 0x95,
+    0x50, 0x51, 0xEB, 0xE4, 0x29, 0xFB, 0x96, 0x0F, 0x94, 0x03, 0x88, 0xE5, 0x24, 0xAA, 0x9B, 0x5E,
+    0x46, 0x84, 0x84, 0xFE, 0x13, 0xB6, 0x65, 0xC0, 0xD4, 0xA6, 0x47, 0x3A, 0xE8, 0x7D, 0x89, 0x6D,
+    0x94, 0x6D, 0xD5, 0x4B, 0x8C, 0xEE, 0x81, 0x26, 0xE5, 0xD2, 0x16, 0xA8, 0x1B, 0x85, 0x75, 0x77,
+    0x7D, 0x0A, 0xDC, 0xC9, 0x58, 0xAE, 0x94, 0xD5, 0xBA, 0xBD, 0x9C, 0x38, 0x9F, 0xDC, 0x4A, 0x13,
+    0x47, 0xBF, 0xA3, 0x06, 0xAA, 0x34, 0x12, 0xBB, 0xB7, 0xE5, 0x1F, 0x41, 0x2E, 0x83, 0xA4, 0x6A,
+    0x4A, 0xA3, 0x52, 0x47, 0xCF, 0xA1, 0x93, 0x70, 0xCC, 0x56, 0xBC, 0xE5, 0xD0, 0x5D, 0xE6, 0xF2,
+    0x15, 0xA7, 0x31, 0x37, 0xD2, 0x1B, 0xCD, 0xA2, 0x1C, 0x7F, 0x71, 0x20, 0x44, 0x8F, 0x12, 0x50,
+    0x5C, 0x03, 0xB6, 0x22, 0xDE, 0x5C, 0xA7, 0x8E, 0x95, 0xC2, 0xFF, 0xA5, 0xE5, 0x7F, 0xA2, 0x52,
+    0x06, 0x12, 0x47, 0x3D, 0x46, 0x15, 0xD9, 0x77, 0xD2, 0x46, 0xAD, 0xDA, 0x12, 0x0D, 0x23, 0xA7,
+    0x9A, 0x9D, 0x5C, 0x1B, 0xBB, 0x96, 0xCE, 0x4C, 0xA7, 0x68, 0xF5, 0xEF, 0x36, 0x94, 0x7F, 0x20,
+    0x4C, 0x81, 0xDB, 0x51, 0x43, 0x0F, 0x9A, 0x94, 0x8D, 0x84, 0xD7, 0xBF, 0x7C, 0x5B, 0xC6, 0xF9,
+    0xB9, 0x1C, 0x64, 0x95, 0x36, 0x61, 0xAB, 0x35, 0x71, 0x23, 0xFD, 0x8F, 0xD6, 0xBF, 0x8D, 0x55,
+    0xBF, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0x24, 0x16, 0xB2, 0x90, 0xAF, 0x49, 0x05, 0xC2, 0xD4,
+    0xA1, 0xF0, 0x9F, 0xB0, 0x8E, 0x22, 0xD1, 0xE6, 0x8A, 0x7C, 0x20, 0xA5, 0xB9, 0xD4, 0x34, 0xD7,
+    0xD3, 0xD8, 0x3D, 0x45, 0xAE, 0xA1, 0xA2, 0x0D, 0x52, 0x74, 0xCD, 0xB5, 0x34, 0x89, 0x17, 0x5D,
+    0x41, 0x6B, 0x92, 0x22, 0x94, 0x16, 0x94, 0x29, 0x70, 0xC0, 0x27, 0x7C, 0xB9, 0xDD, 0x1D, 0xE6,
+    0xCD, 0xDA, 0x17, 0x1D, 0x17, 0x7E, 0xAC, 0xE4, 0xDD, 0x6F, 0x76, 0xD7, 0x9E, 0x99, 0x37, 0xEF,
+    0xCD, 0x47, 0xE9, 0xF1, 0x71, 0x43, 0x32, 0x98, 0x03, 0x16, 0xC3, 0x3C, 0xCB, 0x52, 0x32, 0x33,
+    0xD1, 0xEE, 0x8B, 0xF0, 0x39, 0x9F, 0xED, 0x64, 0x0F, 0xC3, 0x92, 0x19, 0xA8, 0xEF, 0xB2, 0x68,
+    0x39, 0xCA, 0x03, 0x55, 0x8E, 0x28, 0xE1, 0x6F, 0x4E, 0xE4, 0x2E, 0xB5, 0xB2, 0xD9, 0x11, 0xD5,
+    0x7A, 0x93, 0x0A, 0x59, 0x46, 0xA2, 0x34, 0x2E, 0xD4, 0x33, 0x0F, 0x84, 0xC3, 0x00, 0x67, 0xA5,
+    0xBA, 0xA2, 0x0C, 0xF7, 0xE1, 0x7A, 0xD2, 0xC5, 0x38, 0x5D, 0x4A, 0x5E, 0x0F, 0xED, 0x3B, 0x0E,
+    0xAB, 0x78, 0x78, 0x39, 0x6A, 0xBD, 0x94, 0xBA, 0x7F, 0x37, 0x6E, 0x32, 0x3F, 0x8E, 0x21, 0x59,
+    0xCA, 0x35, 0xF6, 0x04, 0x29, 0x0C, 0xC8, 0x96, 0xBD, 0x78, 0xFC, 0xD3, 0x25, 0x47, 0xC4, 0x8B,
+    0xB1, 0x08, 0x31, 0x73, 0xF0, 0x3E, 0xC0, 0x30, 0x2E, 0x1A, 0x9D, 0x91, 0x48, 0xCD, 0x92, 0x2D,
+    0xD1, 0x90, 0x54, 0xDA, 0x45, 0x70, 0xF8, 0x0E, 0x06, 0xF3, 0x64, 0x60, 0xF0, 0x5D, 0xB6, 0x62,
+    0x2C, 0xC6, 0x67, 0xE7, 0x87, 0x7C, 0x2A, 0xBB, 0x5D, 0xFF, 0x73, 0xCD, 0xA7, 0x4B, 0xE9, 0x04,
+    0x5C, 0xFE, 0x96, 0x6D, 0x19, 0x71, 0x53, 0x38, 0x6D, 0xB2, 0x82, 0x18, 0x91, 0x2D, 0x35, 0x1C,
+    0x09, 0x51, 0xF1, 0xC9, 0x67, 0x4D, 0xA1, 0xD5, 0xC2, 0x5C, 0x31, 0x92, 0x7D, 0x9D, 0x4F, 0x42,
+    0xB7, 0x16, 0x0B, 0x6B, 0xA2, 0xC5, 0x92, 0xB7, 0xDF, 0xF0, 0x82, 0x75, 0x2F, 0x5D, 0xB1, 0x2B,
+    0x7C, 0x44, 0x49, 0x02, 0x4E, 0x76, 0x3B, 0xA9, 0xE6, 0xEE, 0xFE, 0x5A, 0xCB, 0x17, 0x71, 0xF1,
+    0xAB, 0x39, 0xAC, 0x70, 0xDE, 0xDA, 0xE9, 0xB8, 0x7B, 0xF5, 0x74, 0xBB, 0x9C, 0xC8, 0x67, 0x53,
+    0x14, 0xC1, 0x53, 0x0E, 0x5C, 0x39, 0x1C, 0xA2, 0xB8, 0xC0, 0x95, 0x9B, 0x58, 0x79, 0xB7, 0x12,
+    0x01, 0xC1, 0x7E, 0xCA, 0xE7, 0xCD, 0xD5, 0x6A, 0x01, 0x52, 0x8E, 0x45, 0xA9, 0xB9, 0x91, 0x64,
+    0xE5, 0x2E, 0xA0, 0x1B, 0xEB, 0x8B, 0x89, 0xF8, 0xD0, 0xE6, 0xAE, 0xA5, 0xEA, 0xB5, 0xA3, 0xF6,
+    0xC7, 0x29, 0xE1, 0xCA, 0xE6, 0xBE, 0xA5, 0xF2, 0xDC, 0x4B, 0x9A, 0x5E, 0x2E, 0x7A, 0x42, 0xAD,
+    0x7A, 0x71, 0x71, 0x28, 0x9F, 0x2F, 0x25, 0x64, 0x14, 0xA5, 0x51, 0x77, 0xCC, 0x3A, 0x07, 0xBA,
+    0x36, 0x2A, 0x85, 0xF9, 0xFA, 0x7C, 0x63, 0xBF, 0x74, 0xC9, 0x7D, 0x61, 0x9B, 0x12, 0xE4, 0xFA,
+    0x5C, 0xFD, 0x8F, 0xB9, 0xF6, 0xFF, 0x35, 0x0B, 0x9E, 0x40, 0xDC, 0x6F, 0x0F, 0x15, 0x52, 0xCC,
+    0x4C, 0x29, 0x70, 0xB9, 0x77, 0xFB, 0x24, 0x3C, 0x31, 0x22, 0x3A, 0x23, 0x4C, 0x37, 0x10, 0x99,
+    0x60, 0x0A, 0x7B, 0x0F, 0x4E, 0x50, 0x41, 0xD1, 0x99, 0xD0, 0x04, 0x38, 0xE3, 0xE9, 0xE4, 0xB1,
+    0xFA, 0xDC, 0x3C, 0xEE, 0xE8, 0x04, 0x01, 0x43, 0x21, 0x4C, 0xFB, 0x54, 0xBE, 0x7E, 0x06, 0x1D,
+    0x8F, 0xC2, 0xA6, 0x40, 0x1F, 0x4A, 0x55, 0x73, 0xF0, 0xA3, 0xE5, 0xCF, 0xC6, 0x9C, 0x2F, 0x02,
+    0x7D, 0x85, 0x23, 0x51, 0xA0, 0x7C, 0x3D, 0x1C, 0xBC, 0x64, 0x9F, 0xFA, 0x96, 0x05, 0xEA, 0x57,
+    0x53, 0xBD, 0x3C, 0x6C, 0x0F, 0x18, 0x54, 0xB4, 0x72, 0x7B, 0x94, 0x1F, 0x52, 0xD5, 0xF6, 0x68,
+    0x83, 0xF0, 0x4B, 0xCD, 0x18, 0x8C, 0xCA, 0xE1, 0x29, 0xD1, 0xDC, 0xFB, 0x23, 0x15, 0x77, 0x83,
+    0x69, 0x56, 0x99, 0xC3, 0xB5, 0xBC, 0xD8, 0xF2, 0x6F, 0x8E, 0xAA, 0x8B, 0x33, 0xA6, 0xC2, 0x79,
+    0x63, 0xD3, 0x60, 0xEE, 0xCD, 0xD4, 0xDF, 0x7B, 0xEE, 0xA9, 0x7E, 0xB1, 0xF4, 0x4D, 0x31, 0x85,
+    0x7A, 0x48, 0x9D, 0xF9, 0x5A, 0x36, 0xCB, 0x5F, 0x64, 0xF3, 0x14, 0x9B, 0x33, 0x36, 0xBD, 0x6E,
+    0x3E, 0xFA, 0x55, 0x36, 0xFF, 0x70, 0xDC, 0xE4, 0x8E, 0x21, 0xB4, 0xDB, 0xC7, 0x8F, 0xB5, 0x1B,
+    0x28, 0xB5, 0x63, 0x77, 0xCA, 0x22, 0x63, 0xCD, 0x00, 0x54, 0x32, 0xD1, 0xEF, 0x4C, 0xB1, 0x35,
+    0x51, 0x2E, 0x08, 0x4B, 0x78, 0xED, 0x40, 0x50, 0x7A, 0xD8, 0xF5, 0x2A, 0x3D, 0x41, 0x41, 0xA5,
+    0x37, 0x51, 0x24, 0x89, 0x1A, 0x1D, 0x45, 0xE2, 0x83, 0xBD, 0x48, 0x15, 0x39, 0x6B, 0x6B, 0x1B,
+    0x55, 0xA0, 0x61, 0x33, 0x6E, 0xA1, 0x03, 0xBE, 0x6D, 0x4B, 0xB1, 0x1D, 0x45, 0x23, 0x59, 0x7B,
+    0xD3, 0x27, 0x98, 0x80, 0x4A, 0x1A, 0x36, 0xD1, 0x55, 0x10, 0x6D, 0x8B, 0xCE, 0x07, 0x85, 0x66,
+    0xBC, 0xB6, 0xD4, 0xA0, 0x8A, 0xD2, 0x49, 0x69, 0x88, 0xD2, 0x0A, 0x78, 0x90, 0x49, 0xAF, 0xFD,
+    0x71, 0xDA, 0x08, 0x98, 0x29, 0x87, 0x54, 0xFA, 0x2A, 0xF9, 0xF7, 0xD4, 0x2D, 0xD4, 0x5E, 0x2E,
+    0x4A, 0x6B, 0x8B, 0x49, 0x85, 0x24, 0x49, 0xD4, 0xE0, 0x96, 0x79, 0xE3, 0x79, 0x34, 0x4B, 0x5F,
+    0x86, 0x6A, 0xAE, 0x2D, 0xDF, 0x99, 0x8B, 0xA9, 0x68, 0xF6, 0x62, 0x07, 0xEC, 0x2F, 0x5B, 0x62,
+    0x31, 0x5D, 0xB6, 0xC5, 0xBF, 0x6D, 0x26, 0x4F, 0x60, 0xBF, 0xAF, 0xD5, 0x46, 0x44, 0x2D, 0x4E,
+    0xCC, 0xDB, 0x88, 0x82, 0xA6, 0x8C, 0x10, 0xDA, 0x01, 0x72, 0x9B, 0x31, 0x39, 0x4C, 0x1E, 0x93,
+    0xD6, 0x47, 0x33, 0xB6, 0x5B, 0xC6, 0x78, 0xAD, 0x9E, 0x63, 0x03, 0x5A, 0xA3, 0x4F, 0xAF, 0xB6,
+    0xEE, 0x7F, 0x8E, 0xE6, 0x72, 0x33, 0xB3, 0xB5, 0xFD, 0x28, 0x73, 0xC5, 0x54, 0xFD, 0xC0, 0xCF,
+    0x5D, 0xED, 0x2A, 0xDF, 0xD7, 0x5A, 0xD6, 0x05, 0x90, 0x2E, 0xA0, 0xDD, 0x0C, 0x61, 0xC0, 0x4F,
+    0x3F, 0x6D, 0x2C, 0xA5, 0x87, 0xD1, 0x99, 0xF8, 0xCC, 0x6D, 0x26, 0xEE, 0xAB, 0x11, 0xDA, 0x33,
+    0x16, 0x0D, 0x1D, 0x5C, 0x85, 0x0C, 0xC5, 0xC4, 0x66, 0x35, 0xA2, 0x75, 0xF1, 0xA2, 0x3D, 0xC4,
+    0xC7, 0xDF, 0xE0, 0x54, 0x35, 0xC5, 0x3B, 0xF1, 0x3E, 0xB5, 0x5D, 0x2A, 0x45, 0xA9, 0x87, 0x5C,
+    0x7C, 0x16, 0x36, 0x1B, 0xB7, 0xEF, 0x13, 0xE8, 0xF3, 0x6C, 0xA5, 0x90, 0xE8, 0x40, 0xDA, 0xF1,
+    0x84, 0x96, 0x9C, 0x72, 0x7D, 0x30, 0x73, 0xF1, 0x93, 0xFF, 0x38, 0x9D, 0x3F, 0x20, 0x7A, 0x8A,
+    0xF4, 0x04, 0xD7, 0x42, 0x82, 0x49, 0x11, 0xEC, 0x53, 0x4A, 0xC6, 0xBA, 0x19, 0xB8, 0x18, 0x7C,
+    0xFD, 0xFB, 0x19, 0xDF, 0x41, 0xDB, 0xAC, 0xA2, 0x8E, 0xD6, 0xBF, 0xC8, 0xB0, 0xD5, 0x43, 0xC6,
+    0x8D, 0x07, 0xDF, 0x17, 0xFA, 0x51, 0xA1, 0x2E, 0x88, 0x69, 0x58, 0x04, 0x2F, 0x1E, 0x33, 0x74,
+    0xBD, 0x00, 0xD6, 0x3E, 0x12, 0x66, 0x8F, 0x3C, 0xE6, 0x73, 0x19, 0x12, 0x69, 0x96, 0x63, 0xDB,
+    0x08, 0x13, 0xAC, 0x96, 0xA3, 0x04, 0xAC, 0x1D, 0xBD, 0x63, 0xFC, 0x05, 0xBD, 0x55, 0x3D, 0x8F,
+    0x1C, 0x45, 0x10, 0xAD, 0xD9, 0x91, 0xBC, 0xA0, 0x91, 0x3C, 0x24, 0x24, 0x10, 0x4C, 0x42, 0x64,
+    0x21, 0x35, 0x3F, 0x00, 0xD4, 0x4B, 0x44, 0x40, 0x72, 0x01, 0x8E, 0x08, 0x36, 0x27, 0xF1, 0x3F,
+    0xF0, 0x8C, 0x23, 0x07, 0x9B, 0x38, 0xF0, 0x0F, 0x70, 0x82, 0x10, 0x1B, 0x11, 0x10, 0x90, 0x70,
+    0xD3, 0x98, 0xE0, 0x42, 0x86, 0x00, 0x21, 0x91, 0x78, 0xB4, 0x09, 0x82, 0xE4, 0x06, 0x69, 0x04,
+    0xCD, 0xB9, 0x67, 0x8A, 0xF7, 0x6A, 0xF6, 0xF6, 0x2C, 0x48, 0x40, 0xB2, 0x68, 0x6D, 0xD7, 0xF6,
+    0xF6, 0xC7, 0xAB, 0xEA, 0xD7, 0xAF, 0x6A, 0x6F, 0x7F, 0x7E, 0x26, 0xB9, 0xAA, 0x0A, 0x7A, 0xE7,
+    0x55, 0x47, 0xC9, 0xEA, 0x49, 0xC4, 0x6B, 0x83, 0xDE, 0x8B, 0x7F, 0x1E, 0xC5, 0x8F, 0x33, 0xBA,
+    0x0F, 0x7E, 0x2C, 0x07, 0x3F, 0xE6, 0xC9, 0x8F, 0xD2, 0x56, 0xA3, 0xB8, 0xA7, 0xA3, 0x88, 0xBC,
+    0x85, 0x7E, 0x0B, 0xBD, 0xE8, 0xD0, 0x27, 0xB9, 0xF5, 0x48, 0x43, 0x9E, 0xCA, 0x24, 0x00, 0x0C,
+    0xBE, 0xA9, 0x52, 0xD9, 0x67, 0xFA, 0x10, 0x9B, 0xAF, 0x92, 0xAC, 0xE0, 0x05, 0xA0, 0x01, 0xFE,
+    0x86, 0x4A, 0x35, 0x16, 0xAA, 0x13, 0xE6, 0x74, 0xF3, 0xC9, 0x7E, 0x1F, 0x00, 0xF1, 0x0E, 0xBA,
+    0xCF, 0x9E, 0x88, 0xFB, 0x6D, 0x12, 0x37, 0xD6, 0x1B, 0x17, 0xCB, 0xBE, 0x8A, 0x79, 0xAA, 0x80,
+    0x06, 0x44, 0xF7, 0x5D, 0x92, 0x42, 0x93, 0x64, 0xCA, 0xF8, 0xD0, 0x4B, 0xD5, 0x74, 0x1D, 0x7A,
+    0xB8, 0xB3, 0xDF, 0x3F, 0x91, 0xA5, 0x95, 0x66, 0x6B, 0x9A, 0x7C, 0xA2, 0xAD, 0x18, 0xA8, 0xE0,
+    0x46, 0x58, 0x4B, 0x1C, 0xB6, 0x74, 0xB7, 0xC6, 0x31, 0x1D, 0x6A, 0xDA, 0x6F, 0x69, 0xB4, 0x8A,
+    0x5C, 0x73, 0x36, 0x5D, 0xD1, 0x06, 0x1B, 0x8B, 0xB3, 0x79, 0x6F, 0x20, 0xBE, 0xA3, 0xBD, 0x6F,
+    0x1E, 0xBE, 0x90, 0x17, 0xDA, 0x2B, 0x34, 0xAB, 0x03, 0x81, 0x57, 0xF1, 0x6B, 0xDA, 0xD9, 0x61,
+    0xEF, 0x4A, 0x77, 0x13, 0xED, 0x41, 0x3B, 0x04, 0x1E, 0xDB, 0x09, 0x76, 0x76, 0xDA, 0x65, 0x7A,
+    0xB9, 0x7B, 0x3E, 0x67, 0x7A, 0x71, 0x88, 0x6D, 0xAF, 0xDF, 0xC7, 0xF3, 0x72, 0xF2, 0xDD, 0x7D,
+    0xD7, 0xCC, 0x79, 0x57, 0xED, 0xFA, 0xDB, 0xF2, 0xDA, 0xFA, 0x40, 0xAF, 0x59, 0x3C, 0x37, 0x7F,
+    0x8E, 0xB1, 0x63, 0x81, 0x61, 0xFF, 0xAB, 0x85, 0x63, 0xFB, 0x92, 0x66, 0x3D, 0xDC, 0x44, 0xAE,
+    0xE1, 0x44, 0x45, 0xA6, 0x1B, 0x86, 0xA9, 0x62, 0x14, 0x64, 0x46, 0x81, 0x71, 0x32, 0x1B, 0x67,
+    0xC9, 0xA6, 0xBF, 0xA1, 0x49, 0x36, 0x1D, 0x4E, 0xF4, 0x29, 0xA1, 0x72, 0xDB, 0x96, 0x1B, 0xF6,
+    0x7A, 0x73, 0xF2, 0xF8, 0x5F, 0x82, 0x7C, 0x61, 0xE1, 0xCC, 0x16, 0xDE, 0xE3, 0xC2, 0xB0, 0x10,
+    0x51, 0x4E, 0x58, 0xD0, 0x4E, 0x7F, 0x3C, 0x44, 0xED, 0x4A, 0x50, 0x07, 0xAF, 0x46, 0x9D, 0x54,
+    0xBA, 0x33, 0x36, 0x0F, 0x0C, 0xA9, 0x8A, 0x7C, 0xCC, 0x6C, 0x76, 0xC1, 0xA0, 0xC2, 0xE9, 0x15,
+    0x44, 0x6E, 0x82, 0x92, 0x77, 0x25, 0x0F, 0x46, 0x04, 0xF5, 0xA0, 0x9B, 0x6A, 0xA0, 0x28, 0x48,
+    0x00, 0x6E, 0x51, 0x24, 0xA3, 0xC5, 0x0F, 0xE2, 0x06, 0x52, 0x63, 0x97, 0x9D, 0x16, 0x3E, 0x46,
+    0x6F, 0x5F, 0x17, 0xBC, 0x6B, 0x31, 0x99, 0x1C, 0xB4, 0x31, 0x62, 0x3A, 0x2A, 0x57, 0xA3, 0x14,
+    0x33, 0x3F, 0x50, 0x47, 0x46, 0x52, 0x17, 0xE8, 0x75, 0x2F, 0x54, 0xC0, 0xDB, 0x92, 0x37, 0xC7,
+    0x37, 0x58, 0x19, 0x00, 0x77, 0x38, 0x24, 0x15, 0x04, 0x9B, 0x20, 0xBF, 0x67, 0xDA, 0x38, 0xDD,
+    0x6A, 0xAC, 0x61, 0x26, 0xAF, 0xDB, 0x5D, 0x2A, 0xEE, 0x6D, 0x1F, 0xF4, 0xE2, 0xB6, 0xDC, 0xF7,
+    0x4F, 0x63, 0xAB, 0xB6, 0xCF, 0x4E, 0xD8, 0x59, 0x43, 0x91, 0x16, 0x78, 0x0B, 0xB2, 0xF9, 0x30,
+    0x6F, 0xCB, 0xDB, 0xAF, 0xCE, 0x98, 0x0A, 0x3D, 0x93, 0xA5, 0x01, 0x65, 0xE9, 0x28, 0x84, 0x8C,
+    0x3B, 0x2A, 0x0E, 0x26, 0x1B, 0x64, 0xE7, 0xEF, 0xF3, 0xC6, 0x2E, 0xE0, 0x6E, 0x09, 0x79, 0xA5,
+    0x4F, 0xF5, 0x81, 0x26, 0xDF, 0xE7, 0xFA, 0xD0, 0x72, 0x31, 0x64, 0xFA, 0x41, 0x92, 0x72, 0xA8,
+    0x21, 0xDC, 0x5C, 0x37, 0x2D, 0x2B, 0x45, 0x22, 0x45, 0x0D, 0x92, 0x18, 0xC4, 0x11, 0xB8, 0x26,
+    0xE6, 0xEB, 0xD7, 0x8C, 0xBF, 0x8A, 0xFE, 0xA6, 0x3E, 0x5A, 0x21, 0x6B, 0x90, 0x4B, 0x7D, 0xDB,
+    0x21, 0x34, 0xD5, 0xCB, 0x28, 0xAB, 0xA3, 0xC4, 0x5A, 0x3A, 0x6C, 0xA4, 0x9A, 0x31, 0xD3, 0xA3,
+    0x07, 0xA0, 0x08, 0x5F, 0xA1, 0x40, 0x0D, 0x2A, 0x94, 0xFB, 0x1A, 0x2A, 0xAD, 0x06, 0x36, 0x64,
+    0x57, 0x25, 0xEC, 0xD0, 0xB0, 0xD6, 0x72, 0xC2, 0xCF, 0x4C, 0x03, 0x73, 0x28, 0xD4, 0x03, 0x6A,
+    0x4E, 0x65, 0x15, 0x02, 0xEA, 0xB8, 0x50, 0xE1, 0xEA, 0x64, 0x3B, 0xC5, 0x02, 0xC3, 0x59, 0xE3,
+    0x9A, 0x3F, 0x1F, 0x7F, 0xAC, 0xC9, 0xA2, 0x20, 0xB2, 0x3D, 0xE2, 0xC8, 0x1A, 0xC2, 0x14, 0xB7,
+    0x37, 0x27, 0xE2, 0xF2, 0xA8, 0x7E, 0x68, 0x21, 0x01, 0x59, 0x25, 0xB9, 0xA7, 0xBF, 0x80, 0x54,
+    0xF9, 0x5B, 0xBB, 0x63, 0xA5, 0x86, 0x7C, 0x03, 0x8F, 0x62, 0xF3, 0x46, 0x3B, 0xEB, 0x1B, 0x10,
+    0x49, 0x69, 0x7B, 0x09, 0x46, 0x72, 0x75, 0xB8, 0xBE, 0x8B, 0x35, 0x75, 0xD5, 0x29, 0x29, 0xE0,
+    0x3D, 0x51, 0x43, 0x75, 0x83, 0x41, 0x39, 0x0B, 0x3E, 0x88, 0xBD, 0x1D, 0xC4, 0xC7, 0x1C, 0x2B,
+    0xED, 0x50, 0x4D, 0xC4, 0x45, 0xE4, 0x39, 0x6E, 0xF3, 0xC3, 0xDD, 0x2D, 0xDE, 0x98, 0x74, 0x59,
+    0xB4, 0x7F, 0x5A, 0x74, 0x3F, 0xDF, 0x88, 0x70, 0xE2, 0xE8, 0x0F, 0x9A, 0x9F, 0xF4, 0xD7, 0xF6,
+    0x0A, 0x5A, 0xD6, 0x4D, 0x19, 0x51, 0xF3, 0x7C, 0x5F, 0x8E, 0x50, 0xB2, 0xEF, 0x5E, 0xC2, 0x94,
+    0xB5, 0xEC, 0x23, 0xB9, 0x2B, 0x2F, 0x1D, 0x9A, 0x53, 0x56, 0x68, 0x4F, 0x97, 0xF9, 0x7D, 0x8F,
+    0xC6, 0xBB, 0x4D, 0xC7, 0x9B, 0x3D, 0x9B, 0xF7, 0x7B, 0x92, 0xC8, 0xEA, 0x0B, 0x6D, 0x58, 0x27,
+    0x9D, 0x6D, 0xBF, 0x54, 0x71, 0x30, 0x9E, 0x53, 0x7B, 0xE1, 0x3A, 0x8D, 0x2B, 0x56, 0xD8, 0xAB,
+    0xFD, 0x67, 0x3C, 0xBB, 0x20, 0x13, 0x8A, 0x55, 0xEA, 0xEC, 0x8D, 0x25, 0x9F, 0x23, 0xB5, 0xDB,
+    0xCE, 0xFB, 0xC7, 0x7C, 0x42, 0x2B, 0x76, 0x4C, 0x47, 0x9C, 0xC2, 0xC3, 0x83, 0xF6, 0x4F, 0x65,
+    0x81, 0x44, 0x1A, 0x5B, 0xDD, 0x2F, 0xAC, 0xEE, 0x97, 0x66, 0x2B, 0xAB, 0x76, 0x6E, 0xA9, 0xA7,
+    0xBD, 0xFD, 0xCB, 0x74, 0xA7, 0xFF, 0x93, 0xA5, 0xB6, 0x5A, 0x19, 0x80, 0x14, 0x50, 0x7C, 0x36,
+    0x39, 0xF5, 0xF0, 0xD5, 0x9A, 0xB6, 0xFD, 0x90, 0x8E, 0xEA, 0xCB, 0xC9, 0xC4, 0x62, 0x49, 0x67,
+    0xC9, 0x58, 0x9A, 0x5D, 0xD3, 0x35, 0x7C, 0xD3, 0x49, 0x76, 0xFA, 0x1F, 0xFB, 0x5F, 0xDA, 0x5F,
+    0x7D, 0x53, 0x31, 0x4E, 0xE4, 0x40, 0x10, 0x6C, 0xDB, 0xC0, 0x4A, 0x38, 0x98, 0x88, 0x88, 0xC0,
+    0x31, 0x91, 0x9F, 0x30, 0x96, 0xEE, 0x03, 0x9B, 0x5C, 0xC2, 0x13, 0x40, 0x27, 0x72, 0xA4, 0x93,
+    0x91, 0xF8, 0x00, 0x01, 0xFC, 0x80, 0x88, 0x84, 0x27, 0x78, 0x75, 0x1B, 0x6C, 0x6A, 0xE9, 0x3E,
+    0xE0, 0x80, 0x04, 0x91, 0xEC, 0x49, 0x0E, 0x8C, 0x34, 0x9E, 0xA6, 0xAA, 0x0D, 0x5E, 0x84, 0x4E,
+    0xF4, 0x4A, 0xED, 0x71, 0xBB, 0xA6, 0xA6, 0xAA, 0xA7, 0x57, 0xC4, 0xA2, 0x8C, 0xD2, 0x74, 0xE2,
+    0x75, 0xAB, 0x11, 0x19, 0xD1, 0x95, 0xCC, 0xC1, 0x8D, 0x07, 0xDA, 0xD6, 0xD7, 0x41, 0xCA, 0xD5,
+    0xE2, 0xDF, 0x28, 0x59, 0x27, 0xA1, 0xAE, 0x64, 0x10, 0x5F, 0xB4, 0xE2, 0xAB, 0x72, 0x1D, 0xA4,
+    0x56, 0x6C, 0x62, 0x0C, 0xD3, 0x8E, 0x8C, 0x39, 0xA2, 0xDC, 0x23, 0x67, 0xBA, 0xCD, 0x5F, 0x45,
+    0xF6, 0x2B, 0x79, 0x8F, 0x8B, 0x0E, 0xC9, 0x69, 0x8B, 0xAC, 0x8A, 0x6A, 0x1E, 0x7F, 0x61, 0xE9,
+    0xDB, 0x3D, 0x16, 0x08, 0x58, 0x04, 0x93, 0x43, 0x98, 0x10, 0x20, 0xD9, 0xC8, 0xA5, 0xDB, 0x32,
+    0xD7, 0x2B, 0xA4, 0xC4, 0x70, 0xF9, 0xC0, 0xEC, 0xBF, 0xC1, 0xA5, 0x5F, 0x71, 0x09, 0x71, 0xBF,
+    0x1D, 0x0E, 0xC8, 0xA1, 0x19, 0xAF, 0xAA, 0x57, 0x50, 0xA8, 0x28, 0x20, 0x77, 0xDC, 0x11, 0x09,
+    0x3E, 0xBB, 0xF9, 0x50, 0x2B, 0x65, 0xEF, 0x7B, 0x3F, 0xF8, 0x50, 0x87, 0x06, 0x3F, 0xF9, 0x14,
+    0xFF, 0xF9, 0x52, 0x76, 0xC9, 0x12, 0xD6, 0xFC, 0x1F, 0xD5, 0xEB, 0xE0, 0xFF, 0x8E, 0x7E, 0x1D,
+    0x0A, 0x74, 0xA5, 0xAD, 0x29, 0xA4, 0xB9, 0xFA, 0x8A, 0xF9, 0x11, 0xFC, 0x66, 0xAC, 0x37, 0x3B,
+    0x4C, 0xF2, 0x8E, 0x61, 0x9C, 0xCC, 0x66, 0x12, 0xD3, 0xE4, 0xE9, 0x28, 0xEF, 0x67, 0xFB, 0x9E,
+    0x1D, 0xCC, 0x03, 0x9D, 0xA8, 0xD2, 0x89, 0xF6, 0x76, 0x6D, 0x9B, 0xF8, 0x60, 0x86, 0x0A, 0x6E,
+    0xCD, 0x4C, 0x57, 0xF3, 0x82, 0xBB, 0x25, 0xA0, 0x20, 0x60, 0x6D, 0x97, 0x74, 0xF9, 0x48, 0xAA,
+    0x74, 0x47, 0xED, 0x86, 0x1D, 0x75, 0x37, 0x51, 0x23, 0x7E, 0xCE, 0xF7, 0x66, 0x8B, 0xD4, 0x9A,
+    0x7B, 0x6C, 0x9F, 0xCC, 0x54, 0xAA, 0xBA, 0xB2, 0x6E, 0x56, 0x2C, 0x8C, 0x64, 0xD0, 0x27, 0x2B,
+    0xC0, 0xC9, 0xC2, 0xBA, 0x99, 0x4C, 0x3D, 0xAD, 0x35, 0x02, 0x43, 0x89, 0x37, 0xF0, 0x69, 0x0F,
+    0x4E, 0x0E, 0x49, 0x2E, 0x8C, 0x04, 0x0F, 0x63, 0x2F, 0x82, 0x9C, 0x2C, 0x71, 0x08, 0x86, 0x24,
+    0xDE, 0x92, 0x04, 0x71, 0x6F, 0x33, 0xA5, 0xB2, 0x7F, 0x8E, 0x4C, 0xE3, 0x47, 0x8F, 0xC3, 0xE7,
+    0xBB, 0x90, 0xD4, 0x1A, 0x37, 0x4D, 0x40, 0x66, 0x88, 0x6C, 0x3A, 0xB6, 0x51, 0x33, 0x63, 0x02,
+    0xF1, 0xD2, 0xCB, 0x87, 0xB8, 0xF9, 0x85, 0x44, 0x25, 0xD7, 0xC7, 0x98, 0x60, 0x6B, 0x27, 0x26,
+    0x1E, 0x03, 0x5C, 0x39, 0x13, 0xE9, 0xEC, 0x40, 0x47, 0x57, 0xE2, 0x5E, 0x49, 0x79, 0x08, 0xAA,
+    0x53, 0x30, 0x9C, 0x42, 0xF6, 0xE1, 0xEE, 0x9F, 0xB2, 0x85, 0xB7, 0x78, 0x27, 0xCD, 0xF3, 0x72,
+    0x56, 0xF5, 0x06,
+};
+
+static const uint32_t opendyslexic_14_boldBlockOffsets[44] = {
+    0, 1011, 2071, 3033, 3998, 5147, 6402, 7105,
+    7905, 8561, 9337, 10233, 11079, 11787, 12488, 13251,
+    14184, 14953, 15739, 16568, 17363, 18076, 18852, 19888,
+    20889, 21946, 22858, 24058, 25170, 26233, 27333, 28190,
+    29128, 29992, 31063, 31923, 32964, 33920, 34921, 36055,
+    37070, 38060, 39008, 39443,
+};
+
+static const uint16_t opendyslexic_14_boldDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_14_boldGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_14_boldPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
@@ -5271,711 +2636,711 @@ static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 15, 23, 19, 2, 23, 87, 1662 }, // 1
     { 17, 22, 21, 2, 22, 94, 1749 }, // 2
     { 17, 23, 21, 2, 22, 98, 1843 }, // 3
-    { 18, 24, 22, 2, 23, 108, 1941 }, // 4
-    { 16, 24, 20, 2, 23, 96, 2049 }, // 5
-    { 17, 23, 21, 2, 22, 98, 2145 }, // 6
-    { 16, 23, 20, 2, 23, 92, 2243 }, // 7
-    { 18, 23, 22, 2, 22, 104, 2335 }, // 8
-    { 17, 24, 21, 2, 22, 102, 2439 }, // 9
-    { 8, 20, 8, 0, 20, 40, 2541 }, // :
-    { 10, 25, 10, 0, 19, 63, 2581 }, // ;
-    { 23, 19, 23, -1, 19, 110, 2644 }, // <
-    { 16, 11, 18, 1, 13, 44, 2754 }, // =
-    { 23, 19, 23, 1, 19, 110, 2798 }, // >
-    { 18, 37, 19, 1, 33, 167, 2908 }, // ?
-    { 27, 27, 30, 0, 24, 183, 3075 }, // @
-    { 25, 25, 28, 2, 25, 157, 3258 }, // A
-    { 20, 25, 28, 4, 25, 125, 3415 }, // B
-    { 22, 27, 29, 3, 27, 149, 3540 }, // C
-    { 22, 25, 31, 4, 25, 138, 3689 }, // D
-    { 19, 25, 27, 4, 25, 119, 3827 }, // E
-    { 16, 26, 25, 4, 26, 104, 3946 }, // F
-    { 26, 26, 34, 4, 25, 169, 4050 }, // G
-    { 22, 25, 31, 4, 25, 138, 4219 }, // H
-    { 8, 25, 16, 4, 25, 50, 4357 }, // I
-    { 18, 32, 26, 4, 25, 144, 4407 }, // J
-    { 22, 25, 31, 4, 25, 138, 4551 }, // K
-    { 18, 25, 26, 4, 25, 113, 4689 }, // L
-    { 26, 25, 34, 4, 25, 163, 4802 }, // M
-    { 22, 25, 30, 4, 25, 138, 4965 }, // N
-    { 25, 28, 33, 4, 26, 175, 5103 }, // O
-    { 19, 25, 27, 4, 25, 119, 5278 }, // P
-    { 27, 31, 31, 2, 26, 210, 5397 }, // Q
-    { 20, 25, 28, 4, 25, 125, 5607 }, // R
-    { 23, 27, 31, 4, 25, 156, 5732 }, // S
-    { 23, 25, 31, 4, 25, 144, 5888 }, // T
-    { 22, 26, 30, 4, 25, 143, 6032 }, // U
-    { 25, 25, 33, 4, 25, 157, 6175 }, // V
-    { 33, 25, 42, 4, 25, 207, 6332 }, // W
-    { 24, 25, 33, 4, 25, 150, 6539 }, // X
-    { 23, 25, 31, 4, 25, 144, 6689 }, // Y
-    { 23, 25, 32, 4, 25, 144, 6833 }, // Z
-    { 12, 43, 14, 1, 32, 129, 6977 }, // [
-    { 12, 33, 14, 1, 25, 99, 7106 }, // <backslash>
-    { 12, 43, 14, 1, 32, 129, 7205 }, // ]
-    { 17, 8, 16, 0, 29, 34, 7334 }, // ^
-    { 21, 6, 20, -1, -1, 32, 7368 }, // _
-    { 12, 6, 13, 0, 23, 18, 7400 }, // `
-    { 17, 19, 25, 4, 18, 81, 7418 }, // a
-    { 18, 26, 25, 4, 25, 117, 7499 }, // b
-    { 15, 18, 23, 4, 18, 68, 7616 }, // c
-    { 18, 26, 26, 4, 25, 117, 7684 }, // d
-    { 17, 18, 25, 4, 17, 77, 7801 }, // e
-    { 12, 24, 20, 4, 24, 72, 7878 }, // f
-    { 17, 26, 25, 4, 17, 111, 7950 }, // g
-    { 18, 25, 26, 4, 25, 113, 8061 }, // h
-    { 7, 27, 14, 3, 27, 48, 8174 }, // i
-    { 11, 34, 18, 4, 26, 94, 8222 }, // j
-    { 18, 25, 26, 4, 25, 113, 8316 }, // k
-    { 9, 25, 17, 4, 25, 57, 8429 }, // l
-    { 28, 18, 36, 4, 18, 126, 8486 }, // m
-    { 17, 18, 25, 4, 18, 77, 8612 }, // n
-    { 17, 19, 25, 4, 18, 81, 8689 }, // o
-    { 19, 26, 27, 4, 17, 124, 8770 }, // p
-    { 20, 26, 28, 4, 18, 130, 8894 }, // q
-    { 13, 17, 21, 4, 17, 56, 9024 }, // r
-    { 17, 20, 25, 4, 18, 85, 9080 }, // s
-    { 15, 23, 23, 4, 22, 87, 9165 }, // t
-    { 17, 18, 25, 4, 17, 77, 9252 }, // u
-    { 21, 17, 29, 4, 17, 90, 9329 }, // v
-    { 24, 18, 32, 4, 17, 108, 9419 }, // w
-    { 21, 16, 29, 4, 16, 84, 9527 }, // x
-    { 19, 25, 27, 4, 16, 119, 9611 }, // y
-    { 18, 17, 26, 4, 17, 77, 9730 }, // z
-    { 15, 30, 16, 1, 23, 113, 9807 }, // {
-    { 5, 27, 11, 3, 22, 34, 9920 }, // |
-    { 14, 30, 16, 1, 23, 105, 9954 }, // }
-    { 12, 6, 14, 1, 22, 18, 10059 }, // ~
-    { 0, 0, 25, 0, 0, 0, 10077 }, //  
-    { 9, 37, 22, 6, 32, 84, 10077 }, // ¡
-    { 15, 27, 23, 4, 22, 102, 10161 }, // ¢
-    { 19, 26, 20, 1, 25, 124, 10263 }, // £
-    { 18, 18, 20, 1, 20, 81, 10387 }, // ¤
-    { 22, 26, 22, 0, 23, 143, 10468 }, // ¥
-    { 4, 26, 11, 3, 21, 26, 10611 }, // ¦
-    { 16, 26, 22, 3, 23, 104, 10637 }, // §
-    { 15, 7, 16, 0, 24, 27, 10741 }, // ¨
-    { 14, 13, 20, 3, 28, 46, 10768 }, // ©
-    { 10, 10, 19, 6, 22, 25, 10814 }, // ª
-    { 16, 16, 16, 0, 15, 64, 10839 }, // «
-    { 16, 11, 18, 1, 11, 44, 10903 }, // ¬
-    { 16, 4, 18, 1, 11, 16, 10947 }, // ­
-    { 14, 13, 20, 3, 32, 46, 10963 }, // ®
-    { 13, 5, 15, 1, 22, 17, 11009 }, // ¯
-    { 14, 13, 20, 3, 22, 46, 11026 }, // °
-    { 16, 18, 18, 1, 16, 72, 11072 }, // ±
-    { 8, 11, 9, 1, 24, 22, 11144 }, // ²
-    { 8, 11, 10, 1, 24, 22, 11166 }, // ³
-    { 7, 7, 8, 1, 23, 13, 11188 }, // ´
-    { 18, 22, 25, 3, 17, 99, 11201 }, // µ
-    { 17, 25, 22, 2, 21, 107, 11300 }, // ¶
-    { 7, 7, 8, 0, 14, 13, 11407 }, // ·
-    { 8, 9, 10, 1, 1, 18, 11420 }, // ¸
-    { 7, 12, 9, 1, 25, 21, 11438 }, // ¹
-    { 10, 10, 19, 6, 21, 25, 11459 }, // º
-    { 16, 16, 22, 3, 15, 64, 11484 }, // »
-    { 27, 27, 36, 4, 25, 183, 11548 }, // ¼
-    { 30, 27, 36, 4, 25, 203, 11731 }, // ½
-    { 27, 26, 36, 4, 24, 176, 11934 }, // ¾
-    { 18, 37, 19, 1, 21, 167, 12110 }, // ¿
-    { 25, 33, 28, 2, 33, 207, 12277 }, // À
-    { 25, 38, 28, 2, 38, 238, 12484 }, // Á
-    { 25, 35, 28, 2, 35, 219, 12722 }, // Â
-    { 25, 34, 28, 2, 34, 213, 12941 }, // Ã
-    { 25, 35, 28, 2, 35, 219, 13154 }, // Ä
-    { 25, 35, 28, 2, 35, 219, 13373 }, // Å
-    { 36, 26, 40, 2, 25, 234, 13592 }, // Æ
-    { 22, 35, 29, 3, 27, 193, 13826 }, // Ç
-    { 19, 35, 27, 4, 35, 167, 14019 }, // È
-    { 19, 39, 27, 4, 39, 186, 14186 }, // É
-    { 19, 36, 27, 4, 36, 171, 14372 }, // Ê
-    { 19, 36, 27, 4, 36, 171, 14543 }, // Ë
-    { 13, 36, 16, 0, 36, 117, 14714 }, // Ì
-    { 8, 41, 16, 4, 41, 82, 14831 }, // Í
-    { 16, 38, 16, 0, 38, 152, 14913 }, // Î
-    { 15, 38, 16, 0, 38, 143, 15065 }, // Ï
-    { 27, 25, 31, -1, 25, 169, 15208 }, // Ð
-    { 22, 34, 30, 4, 34, 187, 15377 }, // Ñ
-    { 25, 36, 33, 4, 34, 225, 15564 }, // Ò
-    { 25, 41, 33, 4, 39, 257, 15789 }, // Ó
-    { 25, 38, 33, 4, 36, 238, 16046 }, // Ô
-    { 25, 37, 33, 4, 35, 232, 16284 }, // Õ
-    { 25, 38, 33, 4, 36, 238, 16516 }, // Ö
-    { 17, 10, 17, 0, 12, 43, 16754 }, // ×
-    { 41, 59, 33, -4, 43, 605, 16797 }, // Ø
-    { 22, 36, 30, 4, 35, 198, 17402 }, // Ù
-    { 22, 41, 30, 4, 40, 226, 17600 }, // Ú
-    { 22, 38, 30, 4, 37, 209, 17826 }, // Û
-    { 22, 38, 30, 4, 37, 209, 18035 }, // Ü
-    { 23, 42, 31, 4, 42, 242, 18244 }, // Ý
-    { 14, 24, 16, 1, 24, 84, 18486 }, // Þ
-    { 18, 26, 20, 1, 24, 117, 18570 }, // ß
-    { 17, 27, 25, 4, 26, 115, 18687 }, // à
-    { 17, 31, 25, 4, 30, 132, 18802 }, // á
-    { 17, 28, 25, 4, 27, 119, 18934 }, // â
-    { 17, 27, 25, 4, 26, 115, 19053 }, // ã
-    { 17, 28, 25, 4, 27, 119, 19168 }, // ä
-    { 17, 28, 25, 4, 27, 119, 19287 }, // å
-    { 29, 19, 37, 4, 18, 138, 19406 }, // æ
-    { 15, 25, 23, 4, 18, 94, 19544 }, // ç
-    { 17, 30, 25, 4, 29, 128, 19638 }, // è
-    { 17, 35, 25, 4, 34, 149, 19766 }, // é
-    { 17, 32, 25, 4, 31, 136, 19915 }, // ê
-    { 17, 32, 25, 4, 31, 136, 20051 }, // ë
-    { 12, 25, 14, 0, 25, 75, 20187 }, // ì
-    { 7, 30, 14, 4, 30, 53, 20262 }, // í
-    { 17, 27, 14, -1, 27, 115, 20315 }, // î
-    { 14, 25, 14, 0, 25, 88, 20430 }, // ï
-    { 23, 26, 20, -1, 24, 150, 20518 }, // ð
-    { 17, 27, 25, 4, 27, 115, 20668 }, // ñ
-    { 17, 27, 25, 4, 26, 115, 20783 }, // ò
-    { 17, 32, 25, 4, 31, 136, 20898 }, // ó
-    { 17, 29, 25, 4, 28, 124, 21034 }, // ô
-    { 17, 28, 25, 4, 27, 119, 21158 }, // õ
-    { 17, 29, 25, 4, 28, 124, 21277 }, // ö
-    { 22, 21, 26, 2, 20, 116, 21401 }, // ÷
-    { 19, 51, 25, 3, 35, 243, 21517 }, // ø
-    { 17, 27, 25, 4, 26, 115, 21760 }, // ù
-    { 17, 32, 25, 4, 31, 136, 21875 }, // ú
-    { 17, 29, 25, 4, 28, 124, 22011 }, // û
-    { 17, 29, 25, 4, 28, 124, 22135 }, // ü
-    { 19, 43, 27, 4, 34, 205, 22259 }, // ý
-    { 14, 31, 16, 1, 25, 109, 22464 }, // þ
-    { 19, 39, 27, 4, 30, 186, 22573 }, // ÿ
-    { 25, 35, 28, 2, 35, 219, 22759 }, // Ā
-    { 17, 29, 25, 4, 28, 124, 22978 }, // ā
-    { 25, 35, 28, 2, 35, 219, 23102 }, // Ă
-    { 17, 28, 25, 4, 27, 119, 23321 }, // ă
-    { 25, 33, 28, 2, 25, 207, 23440 }, // Ą
-    { 19, 27, 25, 4, 18, 129, 23647 }, // ą
-    { 22, 36, 29, 3, 36, 198, 23776 }, // Ć
-    { 15, 25, 23, 4, 25, 94, 23974 }, // ć
-    { 22, 38, 29, 3, 38, 209, 24068 }, // Ĉ
-    { 17, 27, 23, 3, 27, 115, 24277 }, // ĉ
-    { 22, 36, 29, 3, 36, 198, 24392 }, // Ċ
-    { 15, 26, 23, 4, 26, 98, 24590 }, // ċ
-    { 22, 38, 29, 3, 38, 209, 24688 }, // Č
-    { 16, 28, 23, 4, 28, 112, 24897 }, // č
-    { 22, 37, 31, 4, 37, 204, 25009 }, // Ď
-    { 23, 26, 26, 4, 25, 150, 25213 }, // ď
-    { 27, 25, 31, -1, 25, 169, 25363 }, // Đ
-    { 22, 26, 26, 4, 25, 143, 25532 }, // đ
-    { 19, 36, 27, 4, 36, 171, 25675 }, // Ē
-    { 17, 32, 25, 4, 31, 136, 25846 }, // ē
-    { 19, 36, 27, 4, 36, 171, 25982 }, // Ĕ
-    { 17, 32, 25, 4, 31, 136, 26153 }, // ĕ
-    { 19, 36, 27, 4, 36, 171, 26289 }, // Ė
-    { 17, 32, 25, 4, 31, 136, 26460 }, // ė
-    { 19, 32, 27, 4, 25, 152, 26596 }, // Ę
-    { 17, 29, 25, 4, 17, 124, 26748 }, // ę
-    { 19, 38, 27, 4, 38, 181, 26872 }, // Ě
-    { 17, 34, 25, 4, 33, 145, 27053 }, // ě
-    { 26, 40, 34, 4, 39, 260, 27198 }, // Ĝ
-    { 18, 39, 25, 4, 30, 176, 27458 }, // ĝ
-    { 26, 38, 34, 4, 37, 247, 27634 }, // Ğ
-    { 17, 37, 25, 4, 28, 158, 27881 }, // ğ
-    { 26, 39, 34, 4, 38, 254, 28039 }, // Ġ
-    { 17, 37, 25, 4, 28, 158, 28293 }, // ġ
-    { 26, 44, 34, 4, 43, 286, 28451 }, // Ģ
-    { 17, 39, 25, 4, 30, 166, 28737 }, // ģ
-    { 22, 37, 31, 4, 37, 204, 28903 }, // Ĥ
-    { 22, 35, 26, 0, 35, 193, 29107 }, // ĥ
-    { 25, 25, 31, 3, 25, 157, 29300 }, // Ħ
-    { 22, 25, 26, 0, 25, 138, 29457 }, // ħ
-    { 11, 38, 16, 2, 38, 105, 29595 }, // Ĩ
-    { 12, 27, 14, 1, 27, 81, 29700 }, // ĩ
-    { 16, 37, 16, -1, 37, 148, 29781 }, // Ī
-    { 17, 27, 14, -2, 27, 115, 29929 }, // ī
-    { 9, 32, 16, 3, 25, 72, 30044 }, // Į
-    { 8, 36, 14, 3, 27, 72, 30116 }, // į
-    { 8, 38, 16, 4, 38, 76, 30188 }, // İ
-    { 6, 17, 14, 4, 17, 26, 30264 }, // ı
-    { 23, 36, 46, 11, 25, 207, 30290 }, // Ĳ
-    { 18, 34, 14, 3, 27, 153, 30497 }, // ĳ
-    { 20, 43, 26, 4, 36, 215, 30650 }, // Ĵ
-    { 17, 37, 18, 3, 29, 158, 30865 }, // ĵ
-    { 22, 40, 31, 4, 40, 220, 31023 }, // Ķ
-    { 18, 40, 26, 4, 25, 180, 31243 }, // ķ
-    { 15, 16, 19, 2, 16, 60, 31423 }, // ĸ
-    { 18, 34, 26, 4, 34, 153, 31483 }, // Ĺ
-    { 9, 38, 17, 4, 38, 86, 31636 }, // ĺ
-    { 20, 39, 26, 2, 39, 195, 31722 }, // Ļ
-    { 11, 41, 17, 2, 25, 113, 31917 }, // ļ
-    { 18, 25, 26, 4, 25, 113, 32030 }, // Ľ
-    { 14, 30, 17, 4, 30, 105, 32143 }, // ľ
-    { 18, 25, 26, 4, 25, 113, 32248 }, // Ŀ
-    { 14, 25, 17, 4, 25, 88, 32361 }, // ŀ
-    { 32, 45, 26, -8, 35, 360, 32449 }, // Ł
-    { 22, 25, 17, -6, 25, 138, 32809 }, // ł
-    { 22, 35, 30, 4, 35, 193, 32947 }, // Ń
-    { 17, 29, 25, 4, 29, 124, 33140 }, // ń
-    { 22, 37, 30, 4, 25, 204, 33264 }, // Ņ
-    { 17, 30, 25, 4, 18, 128, 33468 }, // ņ
-    { 22, 38, 30, 4, 38, 209, 33596 }, // Ň
-    { 18, 31, 25, 4, 31, 140, 33805 }, // ň
-    { 17, 30, 25, 4, 30, 128, 33945 }, // ŉ
-    { 22, 32, 30, 4, 25, 176, 34073 }, // Ŋ
-    { 17, 24, 25, 4, 18, 102, 34249 }, // ŋ
-    { 25, 38, 33, 4, 36, 238, 34351 }, // Ō
-    { 17, 29, 25, 4, 28, 124, 34589 }, // ō
-    { 25, 38, 33, 4, 36, 238, 34713 }, // Ŏ
-    { 17, 29, 25, 4, 28, 124, 34951 }, // ŏ
-    { 27, 37, 33, 4, 35, 250, 35075 }, // Ő
-    { 25, 28, 25, 2, 27, 175, 35325 }, // ő
-    { 35, 28, 35, 4, 26, 245, 35500 }, // Œ
-    { 29, 19, 31, 4, 18, 138, 35745 }, // œ
-    { 20, 34, 28, 4, 34, 170, 35883 }, // Ŕ
-    { 13, 25, 21, 4, 25, 82, 36053 }, // ŕ
-    { 20, 40, 28, 4, 40, 200, 36135 }, // Ŗ
-    { 14, 30, 21, 3, 30, 105, 36335 }, // ŗ
-    { 20, 37, 28, 4, 37, 185, 36440 }, // Ř
-    { 17, 27, 21, 1, 27, 115, 36625 }, // ř
-    { 23, 36, 31, 4, 34, 207, 36740 }, // Ś
-    { 17, 27, 25, 4, 25, 115, 36947 }, // ś
-    { 23, 37, 31, 4, 35, 213, 37062 }, // Ŝ
-    { 17, 29, 25, 4, 27, 124, 37275 }, // ŝ
-    { 23, 33, 31, 4, 25, 190, 37399 }, // Ş
-    { 17, 26, 25, 4, 18, 111, 37589 }, // ş
-    { 23, 38, 31, 4, 36, 219, 37700 }, // Š
-    { 17, 30, 25, 4, 28, 128, 37919 }, // š
-    { 23, 33, 31, 4, 25, 190, 38047 }, // Ţ
-    { 15, 29, 23, 4, 22, 109, 38237 }, // ţ
-    { 23, 37, 31, 4, 37, 213, 38346 }, // Ť
-    { 19, 28, 23, 4, 27, 133, 38559 }, // ť
-    { 23, 25, 31, 4, 25, 144, 38692 }, // Ŧ
-    { 16, 23, 23, 3, 22, 92, 38836 }, // ŧ
-    { 22, 38, 30, 4, 37, 209, 38928 }, // Ũ
-    { 17, 29, 25, 4, 28, 124, 39137 }, // ũ
-    { 22, 38, 30, 4, 37, 209, 39261 }, // Ū
-    { 17, 28, 25, 4, 27, 119, 39470 }, // ū
-    { 22, 38, 30, 4, 37, 209, 39589 }, // Ŭ
-    { 17, 29, 25, 4, 28, 124, 39798 }, // ŭ
-    { 22, 40, 30, 4, 39, 220, 39922 }, // Ů
-    { 17, 31, 25, 4, 30, 132, 40142 }, // ů
-    { 26, 37, 30, 4, 36, 241, 40274 }, // Ű
-    { 25, 27, 25, 2, 26, 169, 40515 }, // ű
-    { 22, 32, 30, 4, 25, 176, 40684 }, // Ų
-    { 17, 26, 25, 4, 17, 111, 40860 }, // ų
-    { 33, 37, 42, 4, 37, 306, 40971 }, // Ŵ
-    { 24, 31, 32, 4, 30, 186, 41277 }, // ŵ
-    { 23, 39, 31, 4, 39, 225, 41463 }, // Ŷ
-    { 19, 40, 27, 4, 31, 190, 41688 }, // ŷ
-    { 23, 39, 31, 4, 39, 225, 41878 }, // Ÿ
-    { 23, 34, 32, 4, 34, 196, 42103 }, // Ź
-    { 18, 28, 26, 4, 28, 126, 42299 }, // ź
-    { 23, 34, 32, 4, 34, 196, 42425 }, // Ż
-    { 18, 28, 26, 4, 28, 126, 42621 }, // ż
-    { 23, 36, 32, 4, 36, 207, 42747 }, // Ž
-    { 18, 30, 26, 4, 30, 135, 42954 }, // ž
-    { 11, 24, 18, 3, 24, 66, 43089 }, // ſ
-    { 12, 6, 0, 0, 23, 18, 43155 }, // ̀
-    { 7, 7, 0, 1, 23, 13, 43173 }, // ́
-    { 16, 8, 0, 0, 1, 32, 43186 }, // ̂
-    { 12, 6, 0, 1, 22, 18, 43218 }, // ̃
-    { 16, 5, 0, 1, 21, 20, 43236 }, // ̄
-    { 21, 5, 0, 0, 27, 27, 43256 }, // ̅
-    { 14, 6, 0, 1, 21, 21, 43283 }, // ̆
-    { 7, 7, 0, 4, 24, 13, 43304 }, // ̇
-    { 14, 6, 0, 0, 21, 21, 43317 }, // ̈
-    { 6, 7, 0, 6, 19, 11, 43338 }, // ̉
-    { 8, 8, 0, 1, 23, 16, 43349 }, // ̊
-    { 25, 6, 0, 1, 23, 38, 43365 }, // ̋
-    { 16, 8, 0, 0, 23, 32, 43403 }, // ̌
-    { 25, 6, 0, -7, 23, 38, 43435 }, // ̏
-    { 10, 10, 0, 0, 23, 25, 43473 }, // ̒
-    { 10, 10, 0, 0, 22, 25, 43498 }, // ̓
-    { 10, 10, 0, -1, 22, 25, 43523 }, // ̔
-    { 7, 9, 0, 1, 0, 16, 43548 }, // ̘
-    { 7, 9, 0, 1, 0, 16, 43564 }, // ̙
-    { 14, 9, 0, 1, 24, 32, 43580 }, // ̚
-    { 7, 9, 0, 0, 20, 16, 43612 }, // ̛
-    { 5, 9, 0, 1, 0, 12, 43628 }, // ̜
-    { 8, 7, 0, 1, 4, 14, 43640 }, // ̝
-    { 8, 6, 0, 1, 0, 12, 43654 }, // ̞
-    { 7, 7, 0, 2, -2, 13, 43666 }, // ̟
-    { 16, 5, 0, 1, -3, 20, 43679 }, // ̠
-    { 8, 7, 0, 0, 3, 14, 43699 }, // ̣
-    { 14, 6, 0, 0, -2, 21, 43713 }, // ̤
-    { 8, 8, 0, 1, 23, 16, 43734 }, // ̥
-    { 10, 10, 0, 0, 5, 25, 43750 }, // ̦
-    { 8, 9, 0, 1, 1, 18, 43775 }, // ̧
-    { 9, 10, 0, 1, 1, 23, 43793 }, // ̨
-    { 6, 10, 0, 1, -1, 15, 43816 }, // ̩
-    { 13, 7, 0, 0, 0, 23, 43831 }, // ̪
-    { 18, 9, 0, -1, 1, 41, 43854 }, // ̬
-    { 18, 9, 0, -1, 1, 41, 43895 }, // ̭
-    { 13, 8, 0, 1, 25, 26, 43936 }, // ̰
-    { 15, 5, 0, 1, 24, 19, 43962 }, // ̱
-    { 16, 5, 0, 0, -1, 20, 43981 }, // ̲
-    { 13, 8, 0, 1, 25, 26, 44001 }, // ̴
-    { 16, 4, 0, 0, 11, 16, 44027 }, // ̵
-    { 5, 10, 0, 1, 0, 13, 44043 }, // ̹
-    { 13, 9, 0, 0, 1, 30, 44056 }, // ̺
-    { 12, 10, 0, 0, 1, 30, 44086 }, // ̻
-    { 11, 8, 0, 1, 1, 22, 44116 }, // ̼
-    { 9, 7, 0, 2, 22, 16, 44138 }, // ̽
-    { 12, 6, 0, 1, 22, 18, 44154 }, // ͂
-    { 6, 8, 0, 7, 26, 12, 44172 }, // ̓
-    { 14, 22, 0, 1, 37, 77, 44184 }, // ̈́
-    { 13, 7, 0, 0, 24, 23, 44261 }, // ͆
-    { 16, 11, 0, 1, 0, 44, 44284 }, // ͇
-    { 13, 9, 0, 1, 1, 30, 44328 }, // ͈
-    { 11, 9, 0, 1, -1, 25, 44358 }, // ͉
-    { 15, 23, 0, 1, 31, 87, 44383 }, // ͊
-    { 26, 22, 0, 1, 33, 143, 44470 }, // ͋
-    { 18, 17, 0, 12, 17, 77, 44613 }, // ͌
-    { 15, 7, 0, 2, -3, 27, 44690 }, // ͍
-    { 5, 5, 0, 1, 4, 7, 44717 }, // ͎
-    { 25, 8, 0, 1, 2, 50, 44724 }, // ͜
-    { 25, 8, 0, 1, 24, 50, 44774 }, // ͡
-    { 31, 9, 0, 1, -1, 70, 44824 }, // ͢
-    { 18, 36, 26, 4, 36, 162, 44894 }, // Ѐ
-    { 19, 36, 27, 4, 36, 171, 45056 }, // Ё
-    { 25, 27, 20, -4, 25, 169, 45227 }, // Ђ
-    { 17, 34, 19, 1, 33, 145, 45396 }, // Ѓ
-    { 22, 25, 24, 1, 23, 138, 45541 }, // Є
-    { 23, 27, 31, 4, 25, 156, 45679 }, // Ѕ
-    { 8, 25, 16, 4, 25, 50, 45835 }, // І
-    { 13, 36, 16, 1, 36, 117, 45885 }, // Ї
-    { 18, 32, 26, 4, 25, 144, 46002 }, // Ј
-    { 29, 24, 34, 2, 22, 174, 46146 }, // Љ
-    { 27, 24, 18, -5, 23, 162, 46320 }, // Њ
-    { 27, 27, 31, 4, 27, 183, 46482 }, // Ћ
-    { 22, 34, 31, 4, 34, 187, 46665 }, // Ќ
-    { 22, 38, 30, 4, 38, 209, 46852 }, // Ѝ
-    { 19, 37, 23, 2, 34, 176, 47061 }, // Ў
-    { 19, 28, 23, 2, 21, 133, 47237 }, // Џ
-    { 25, 25, 28, 2, 25, 157, 47370 }, // А
-    { 15, 21, 19, 2, 21, 79, 47527 }, // Б
-    { 16, 23, 20, 2, 22, 92, 47606 }, // В
-    { 17, 23, 19, 1, 22, 98, 47698 }, // Г
-    { 23, 26, 24, 1, 22, 150, 47796 }, // Д
-    { 18, 25, 26, 4, 25, 113, 47946 }, // Е
-    { 36, 25, 32, -1, 25, 225, 48059 }, // Ж
-    { 15, 22, 19, 2, 21, 83, 48284 }, // З
-    { 22, 25, 30, 4, 25, 138, 48367 }, // И
-    { 22, 38, 30, 4, 38, 209, 48505 }, // Й
-    { 22, 25, 31, 4, 25, 138, 48714 }, // К
-    { 19, 24, 18, -1, 22, 114, 48852 }, // Л
-    { 23, 23, 25, 1, 22, 133, 48966 }, // М
-    { 22, 25, 31, 4, 25, 138, 49099 }, // Н
-    { 25, 28, 33, 4, 26, 175, 49237 }, // О
-    { 18, 24, 20, 1, 23, 108, 49412 }, // П
-    { 19, 25, 27, 4, 25, 119, 49520 }, // Р
-    { 22, 27, 29, 3, 27, 149, 49639 }, // С
-    { 23, 25, 31, 4, 25, 144, 49788 }, // Т
-    { 19, 25, 23, 2, 22, 119, 49932 }, // У
-    { 22, 22, 25, 2, 22, 121, 50051 }, // Ф
-    { 24, 25, 33, 4, 25, 150, 50172 }, // Х
-    { 19, 28, 21, 1, 22, 133, 50322 }, // Ц
-    { 16, 22, 19, 2, 22, 88, 50455 }, // Ч
-    { 22, 23, 24, 1, 22, 127, 50543 }, // Ш
-    { 24, 28, 26, 1, 22, 168, 50670 }, // Щ
-    { 21, 22, 18, -5, 22, 116, 50838 }, // Ъ
-    { 29, 25, 34, 1, 25, 182, 50954 }, // Ы
-    { 15, 22, 18, 1, 22, 83, 51136 }, // Ь
-    { 22, 25, 24, 1, 23, 138, 51219 }, // Э
-    { 23, 22, 27, 2, 22, 127, 51357 }, // Ю
-    { 20, 25, 28, 4, 25, 125, 51484 }, // Я
-    { 17, 19, 25, 4, 18, 81, 51609 }, // а
-    { 18, 28, 20, 1, 26, 126, 51690 }, // б
-    { 15, 17, 21, 3, 17, 64, 51816 }, // в
-    { 15, 18, 17, 1, 17, 68, 51880 }, // г
-    { 20, 21, 22, 1, 17, 105, 51948 }, // д
-    { 17, 18, 25, 4, 17, 77, 52053 }, // е
-    { 34, 21, 41, 4, 21, 179, 52130 }, // ж
-    { 11, 16, 13, 1, 16, 44, 52309 }, // з
-    { 18, 18, 20, 1, 17, 81, 52353 }, // и
-    { 16, 28, 20, 1, 28, 112, 52434 }, // й
-    { 17, 16, 24, 3, 16, 68, 52546 }, // к
-    { 13, 17, 12, -1, 15, 56, 52614 }, // л
-    { 19, 18, 25, 3, 18, 86, 52670 }, // м
-    { 18, 18, 24, 3, 18, 81, 52756 }, // н
-    { 17, 19, 25, 4, 18, 81, 52837 }, // о
-    { 17, 18, 19, 1, 17, 77, 52918 }, // п
-    { 19, 26, 27, 4, 17, 124, 52995 }, // р
-    { 15, 18, 23, 4, 18, 68, 53119 }, // с
-    { 18, 18, 20, 1, 17, 81, 53187 }, // т
-    { 19, 25, 27, 4, 16, 119, 53268 }, // у
-    { 24, 24, 25, 1, 17, 144, 53387 }, // ф
-    { 21, 18, 21, 0, 17, 95, 53531 }, // х
-    { 19, 22, 21, 1, 17, 105, 53626 }, // ц
-    { 11, 15, 13, 1, 15, 42, 53731 }, // ч
-    { 22, 18, 24, 1, 17, 99, 53773 }, // ш
-    { 24, 23, 26, 1, 17, 138, 53872 }, // щ
-    { 17, 16, 14, -4, 16, 68, 54010 }, // ъ
-    { 21, 19, 25, 1, 19, 100, 54078 }, // ы
-    { 12, 17, 14, 1, 17, 51, 54178 }, // ь
-    { 15, 16, 19, 2, 16, 60, 54229 }, // э
-    { 19, 18, 22, 1, 18, 86, 54289 }, // ю
-    { 17, 20, 24, 3, 19, 85, 54375 }, // я
-    { 17, 32, 25, 4, 31, 136, 54460 }, // ѐ
-    { 17, 30, 25, 4, 29, 128, 54596 }, // ё
-    { 23, 29, 26, 0, 25, 167, 54724 }, // ђ
-    { 15, 26, 17, 1, 25, 98, 54891 }, // ѓ
-    { 15, 17, 17, 1, 16, 64, 54989 }, // є
-    { 17, 20, 25, 4, 18, 85, 55053 }, // ѕ
-    { 7, 27, 14, 3, 27, 48, 55138 }, // і
-    { 14, 25, 14, 0, 25, 88, 55186 }, // ї
-    { 11, 34, 18, 4, 26, 94, 55274 }, // ј
-    { 20, 17, 23, 2, 15, 85, 55368 }, // љ
-    { 19, 17, 12, -4, 16, 81, 55453 }, // њ
-    { 22, 25, 26, 0, 25, 138, 55534 }, // ћ
-    { 17, 25, 24, 3, 25, 107, 55672 }, // ќ
-    { 18, 28, 20, 1, 27, 126, 55779 }, // ѝ
-    { 19, 39, 27, 4, 30, 186, 55905 }, // ў
-    { 14, 22, 17, 2, 16, 77, 56091 }, // џ
-    { 20, 24, 22, 0, 22, 120, 56168 }, // Ѣ
-    { 20, 24, 19, -1, 22, 120, 56288 }, // ѣ
-    { 27, 23, 25, -1, 22, 156, 56408 }, // Ѫ
-    { 19, 17, 18, -1, 16, 81, 56564 }, // ѫ
-    { 23, 32, 32, 5, 31, 184, 56645 }, // Ѳ
-    { 18, 26, 25, 4, 25, 117, 56829 }, // ѳ
-    { 28, 31, 33, 4, 31, 217, 56946 }, // Ѵ
-    { 20, 21, 25, 3, 21, 105, 57163 }, // ѵ
-    { 12, 11, 0, 3, 28, 33, 57268 }, // ҆
-    { 17, 26, 19, 1, 25, 111, 57301 }, // Ґ
-    { 15, 22, 17, 1, 21, 83, 57412 }, // ґ
-    { 20, 24, 19, -2, 22, 120, 57495 }, // Ғ
-    { 14, 16, 13, -1, 15, 56, 57615 }, // ғ
-    { 19, 27, 18, -1, 25, 129, 57671 }, // Ҕ
-    { 11, 17, 11, 0, 15, 47, 57800 }, // ҕ
-    { 38, 30, 43, 3, 25, 285, 57847 }, // Җ
-    { 26, 21, 29, 2, 17, 137, 58132 }, // җ
-    { 15, 26, 19, 2, 21, 98, 58269 }, // Ҙ
-    { 11, 23, 13, 1, 16, 64, 58367 }, // ҙ
-    { 23, 30, 21, 3, 25, 173, 58431 }, // Қ
-    { 16, 20, 15, 2, 17, 80, 58604 }, // қ
-    { 28, 24, 32, 2, 22, 168, 58684 }, // Ҝ
-    { 20, 17, 22, 1, 16, 85, 58852 }, // ҝ
-    { 22, 25, 31, 4, 25, 138, 58937 }, // Ҟ
-    { 21, 25, 26, 1, 25, 132, 59075 }, // ҟ
-    { 26, 25, 31, 0, 25, 163, 59207 }, // Ҡ
-    { 18, 17, 21, 0, 17, 77, 59370 }, // ҡ
-    { 24, 29, 22, 0, 25, 174, 59447 }, // Ң
-    { 16, 20, 16, 0, 17, 80, 59621 }, // ң
-    { 32, 25, 31, 4, 25, 200, 59701 }, // Ҥ
-    { 22, 17, 21, 3, 17, 94, 59901 }, // ҥ
-    { 31, 27, 37, 3, 25, 210, 59995 }, // Ҧ
-    { 28, 29, 37, 4, 20, 203, 60205 }, // ҧ
-    { 28, 25, 20, -4, 22, 175, 60408 }, // Ҩ
-    { 22, 20, 16, -3, 18, 110, 60583 }, // ҩ
-    { 22, 31, 29, 3, 27, 171, 60693 }, // Ҫ
-    { 15, 21, 23, 4, 18, 79, 60864 }, // ҫ
-    { 22, 29, 23, 1, 25, 160, 60943 }, // Ҭ
-    { 16, 20, 16, 0, 17, 80, 61103 }, // ҭ
-    { 23, 25, 31, 4, 25, 144, 61183 }, // Ү
-    { 18, 23, 22, 2, 16, 104, 61327 }, // ү
-    { 23, 25, 31, 4, 25, 144, 61431 }, // Ұ
-    { 19, 23, 22, 1, 16, 110, 61575 }, // ұ
-    { 24, 30, 23, 4, 25, 180, 61685 }, // Ҳ
-    { 17, 20, 16, 2, 17, 85, 61865 }, // ҳ
-    { 27, 28, 18, -5, 21, 189, 61950 }, // Ҵ
-    { 19, 20, 13, -3, 15, 95, 62139 }, // ҵ
-    { 20, 29, 20, 0, 22, 145, 62234 }, // Ҷ
-    { 14, 21, 14, 0, 16, 74, 62379 }, // ҷ
-    { 16, 22, 19, 2, 22, 88, 62453 }, // Ҹ
-    { 11, 15, 13, 1, 15, 42, 62541 }, // ҹ
-    { 18, 25, 20, 1, 24, 113, 62583 }, // Һ
-    { 18, 25, 26, 4, 25, 113, 62696 }, // һ
-    { 33, 23, 28, -6, 22, 190, 62809 }, // Ҽ
-    { 23, 16, 20, -4, 15, 92, 62999 }, // ҽ
-    { 32, 28, 26, -4, 22, 224, 63091 }, // Ҿ
-    { 23, 19, 19, -3, 15, 110, 63315 }, // ҿ
-    { 8, 25, 16, 4, 25, 50, 63425 }, // Ӏ
-    { 36, 39, 32, -1, 39, 351, 63475 }, // Ӂ
-    { 34, 34, 41, 4, 34, 289, 63826 }, // ӂ
-    { 19, 31, 21, 1, 23, 148, 64115 }, // Ӄ
-    { 13, 21, 15, 1, 15, 69, 64263 }, // ӄ
-    { 21, 29, 18, -1, 22, 153, 64332 }, // Ӆ
-    { 15, 20, 12, -1, 15, 75, 64485 }, // ӆ
-    { 24, 33, 31, 4, 25, 198, 64560 }, // Ӈ
-    { 16, 22, 21, 3, 17, 88, 64758 }, // ӈ
-    { 24, 35, 31, 4, 25, 210, 64846 }, // Ӊ
-    { 17, 24, 21, 3, 17, 102, 65056 }, // ӊ
-    { 18, 28, 20, 1, 22, 126, 65158 }, // Ӌ
-    { 12, 20, 18, 3, 15, 60, 65284 }, // ӌ
-    { 28, 35, 34, 4, 25, 245, 65344 }, // Ӎ
-    { 19, 24, 23, 3, 17, 114, 65589 }, // ӎ
-    { 6, 22, 18, 6, 21, 33, 65703 }, // ӏ
-    { 25, 35, 28, 2, 35, 219, 65736 }, // Ӑ
-    { 17, 27, 25, 4, 26, 115, 65955 }, // ӑ
-    { 25, 34, 28, 2, 34, 213, 66070 }, // Ӓ
-    { 17, 28, 25, 4, 27, 119, 66283 }, // ӓ
-    { 36, 26, 40, 2, 25, 234, 66402 }, // Ӕ
-    { 29, 19, 37, 4, 18, 138, 66636 }, // ӕ
-    { 18, 35, 26, 4, 35, 158, 66774 }, // Ӗ
-    { 17, 31, 25, 4, 30, 132, 66932 }, // ӗ
-    { 22, 24, 31, 5, 22, 132, 67064 }, // Ә
-    { 17, 19, 25, 5, 18, 81, 67196 }, // ә
-    { 22, 34, 31, 5, 32, 187, 67277 }, // Ӛ
-    { 17, 24, 25, 5, 18, 102, 67464 }, // ӛ
-    { 37, 38, 41, 2, 38, 352, 67566 }, // Ӝ
-    { 34, 33, 41, 4, 33, 281, 67918 }, // ӝ
-    { 15, 35, 19, 2, 34, 132, 68199 }, // Ӟ
-    { 14, 23, 13, -1, 23, 81, 68331 }, // ӟ
-    { 16, 24, 20, 2, 22, 96, 68412 }, // Ӡ
-    { 16, 23, 20, 2, 16, 92, 68508 }, // ӡ
-    { 22, 38, 30, 4, 38, 209, 68600 }, // Ӣ
-    { 18, 28, 20, 1, 27, 126, 68809 }, // ӣ
-    { 22, 36, 30, 4, 36, 198, 68935 }, // Ӥ
-    { 18, 27, 20, 1, 26, 122, 69133 }, // ӥ
-    { 25, 37, 33, 4, 35, 232, 69255 }, // Ӧ
-    { 18, 31, 25, 3, 30, 140, 69487 }, // ӧ
-    { 22, 24, 33, 5, 23, 132, 69627 }, // Ө
-    { 17, 19, 25, 4, 18, 81, 69759 }, // ө
-    { 22, 33, 33, 5, 32, 182, 69840 }, // Ӫ
-    { 17, 28, 25, 4, 27, 119, 70022 }, // ӫ
-    { 22, 37, 24, 1, 35, 204, 70141 }, // Ӭ
-    { 16, 24, 19, 1, 24, 96, 70345 }, // ӭ
-    { 19, 37, 23, 2, 34, 176, 70441 }, // Ӯ
-    { 19, 39, 27, 4, 30, 186, 70617 }, // ӯ
-    { 19, 37, 23, 2, 34, 176, 70803 }, // Ӱ
-    { 19, 38, 27, 4, 29, 181, 70979 }, // ӱ
-    { 26, 37, 23, 1, 34, 241, 71160 }, // Ӳ
-    { 26, 38, 27, 3, 29, 247, 71401 }, // ӳ
-    { 16, 29, 19, 2, 29, 116, 71648 }, // Ӵ
-    { 13, 22, 13, 0, 22, 72, 71764 }, // ӵ
-    { 17, 27, 19, 1, 22, 115, 71836 }, // Ӷ
-    { 12, 19, 13, 1, 15, 57, 71951 }, // ӷ
-    { 29, 38, 34, 1, 38, 276, 72008 }, // Ӹ
-    { 21, 30, 25, 1, 30, 158, 72284 }, // ӹ
-    { 27, 28, 33, 4, 25, 189, 72442 }, // Ӽ
-    { 19, 19, 23, 3, 17, 91, 72631 }, // ӽ
-    { 0, 0, 19, 0, 0, 0, 72722 }, //  
-    { 0, 0, 34, 0, 0, 0, 72722 }, //  
-    { 0, 0, 19, 0, 0, 0, 72722 }, //  
-    { 0, 0, 34, 0, 0, 0, 72722 }, //  
-    { 0, 0, 14, 0, 0, 0, 72722 }, //  
-    { 0, 0, 12, 0, 0, 0, 72722 }, //  
-    { 0, 0, 10, 0, 0, 0, 72722 }, //  
-    { 0, 0, 21, 0, 0, 0, 72722 }, //  
-    { 0, 0, 8, 0, 0, 0, 72722 }, //  
-    { 0, 0, 11, 0, 0, 0, 72722 }, //  
-    { 0, 0, 9, 0, 0, 0, 72722 }, //  
-    { 0, 0, 5, 0, 0, 0, 72722 }, // ​
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‏
-    { 16, 4, 16, 0, 11, 16, 72722 }, // ‐
-    { 16, 4, 16, 0, 11, 16, 72738 }, // ‑
-    { 24, 4, 16, -4, 11, 24, 72754 }, // ‒
-    { 21, 6, 23, 1, 11, 32, 72778 }, // –
-    { 31, 6, 33, 1, 11, 47, 72810 }, // —
-    { 31, 6, 33, 1, 11, 47, 72857 }, // ―
-    { 14, 27, 16, 3, 22, 95, 72904 }, // ‖
-    { 24, 10, 16, -4, -2, 60, 72999 }, // ‗
-    { 10, 10, 13, 1, 26, 25, 73059 }, // ‘
-    { 10, 10, 13, 1, 26, 25, 73084 }, // ’
-    { 10, 10, 9, 0, 5, 25, 73109 }, // ‚
-    { 10, 10, 13, 1, 26, 25, 73134 }, // ‛
-    { 20, 10, 22, 1, 26, 50, 73159 }, // “
-    { 20, 10, 22, 1, 26, 50, 73209 }, // ”
-    { 10, 10, 9, 0, 5, 25, 73259 }, // „
-    { 20, 10, 22, 1, 26, 50, 73284 }, // ‟
-    { 18, 41, 24, 3, 31, 185, 73334 }, // †
-    { 17, 41, 25, 5, 30, 175, 73519 }, // ‡
-    { 23, 23, 15, -4, 26, 133, 73694 }, // •
-    { 10, 10, 18, 4, 13, 25, 73827 }, // ‣
-    { 7, 7, 18, 5, 7, 13, 73852 }, // ․
-    { 7, 7, 18, 5, 7, 13, 73865 }, // ‥
-    { 27, 7, 28, 0, 7, 48, 73878 }, // …
-    { 4, 4, 16, 6, 11, 4, 73926 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 73930 }, //  
-    { 21, 26, 33, 6, 23, 137, 73930 }, // ‰
-    { 10, 10, 16, 5, 26, 25, 74067 }, // ′
-    { 19, 10, 23, 5, 26, 48, 74092 }, // ″
-    { 23, 9, 12, 2, 25, 52, 74140 }, // ‴
-    { 8, 9, 12, 2, 24, 18, 74192 }, // ‵
-    { 14, 9, 12, 0, 24, 32, 74210 }, // ‶
-    { 24, 9, 12, -6, 25, 54, 74242 }, // ‷
-    { 17, 7, 19, 1, 25, 30, 74296 }, // ‸
-    { 10, 16, 12, 1, 16, 40, 74326 }, // ‹
-    { 10, 16, 12, 1, 16, 40, 74366 }, // ›
-    { 32, 38, 40, 5, 30, 304, 74406 }, // ※
-    { 9, 37, 18, 4, 32, 84, 74710 }, // ‼
-    { 18, 46, 25, 3, 39, 207, 74794 }, // ‽
-    { 16, 4, 16, 0, 24, 16, 75001 }, // ‾
-    { 14, 7, 16, 1, 20, 25, 75017 }, // ‿
-    { 21, 22, 19, -1, 28, 116, 75042 }, // ⁂
-    { 20, 25, 36, 8, 23, 125, 75158 }, // ⁄
-    { 36, 37, 44, 4, 33, 333, 75283 }, // ⁇
-    { 31, 38, 35, 2, 33, 295, 75616 }, // ⁈
-    { 24, 38, 23, -1, 33, 228, 75911 }, // ⁉
-    { 22, 51, 27, 2, 35, 281, 76139 }, // ⁒
-    { 0, 0, 136, 0, 0, 0, 76420 }, //  
-    { 8, 12, 10, 1, 24, 24, 76420 }, // ⁰
-    { 9, 11, 10, 1, 25, 25, 76444 }, // ⁴
-    { 8, 12, 10, 1, 25, 24, 76469 }, // ⁵
-    { 9, 11, 10, 1, 24, 25, 76493 }, // ⁶
-    { 9, 13, 11, 1, 25, 30, 76518 }, // ⁷
-    { 9, 11, 11, 1, 24, 25, 76548 }, // ⁸
-    { 9, 12, 11, 1, 24, 27, 76573 }, // ⁹
-    { 17, 18, 25, 4, 18, 77, 76600 }, // ⁿ
-    { 9, 12, 10, 1, 7, 27, 76677 }, // ₀
-    { 8, 12, 10, 1, 7, 24, 76704 }, // ₁
-    { 9, 12, 11, 1, 7, 27, 76728 }, // ₂
-    { 9, 12, 10, 1, 7, 27, 76755 }, // ₃
-    { 9, 12, 11, 1, 7, 27, 76782 }, // ₄
-    { 8, 12, 10, 1, 7, 24, 76809 }, // ₅
-    { 9, 12, 11, 1, 7, 27, 76833 }, // ₆
-    { 9, 12, 11, 1, 7, 27, 76860 }, // ₇
-    { 9, 12, 11, 1, 7, 27, 76887 }, // ₈
-    { 9, 13, 11, 1, 7, 30, 76914 }, // ₉
-    { 13, 40, 14, 1, 30, 130, 76944 }, // ₍
-    { 13, 40, 13, -2, 30, 130, 77074 }, // ₎
-    { 21, 39, 29, 4, 33, 205, 77204 }, // ₡
-    { 22, 27, 29, 3, 27, 149, 77409 }, // ₢
-    { 20, 27, 20, 0, 26, 135, 77558 }, // ₤
-    { 32, 25, 30, -1, 25, 200, 77693 }, // ₦
-    { 25, 25, 27, 1, 25, 157, 77893 }, // ₧
-    { 32, 27, 38, 3, 25, 216, 78050 }, // ₨
-    { 25, 26, 25, 0, 26, 163, 78266 }, // ₩
-    { 23, 23, 31, 4, 23, 133, 78429 }, // ₪
-    { 22, 25, 15, -2, 24, 138, 78562 }, // ₫
-    { 20, 28, 22, 1, 24, 140, 78700 }, // €
-    { 23, 25, 31, 4, 25, 144, 78840 }, // ₮
-    { 29, 25, 19, -1, 25, 182, 78984 }, // ₱
-    { 26, 39, 34, 4, 33, 254, 79166 }, // ₲
-    { 30, 24, 31, 5, 22, 180, 79420 }, // ₴
-    { 15, 24, 17, 4, 21, 90, 79600 }, // ₵
-    { 24, 26, 31, 3, 26, 156, 79690 }, // ₸
-    { 16, 24, 20, 2, 23, 96, 79846 }, // ₹
-    { 18, 22, 20, 1, 20, 99, 79942 }, // ₺
-    { 21, 24, 24, 1, 23, 126, 80041 }, // ₼
-    { 26, 25, 27, -3, 25, 163, 80167 }, // ₽
-    { 20, 20, 21, 0, 18, 100, 80330 }, // ←
-    { 21, 20, 22, 1, 19, 105, 80430 }, // ↑
-    { 20, 20, 22, 1, 18, 100, 80535 }, // →
-    { 21, 20, 22, 1, 19, 105, 80635 }, // ↓
-    { 24, 17, 30, 3, 16, 102, 80740 }, // ↔
-    { 17, 24, 23, 3, 26, 102, 80842 }, // ↕
-    { 17, 16, 23, 3, 15, 68, 80944 }, // ↖
-    { 17, 16, 19, 1, 15, 68, 81012 }, // ↗
-    { 17, 16, 19, 1, 16, 68, 81080 }, // ↘
-    { 17, 16, 19, 1, 16, 68, 81148 }, // ↙
-    { 23, 20, 29, 3, 19, 115, 81216 }, // ⇐
-    { 25, 24, 31, 3, 23, 150, 81331 }, // ⇑
-    { 23, 20, 29, 3, 19, 115, 81481 }, // ⇒
-    { 25, 24, 31, 3, 22, 150, 81596 }, // ⇓
-    { 26, 20, 32, 3, 19, 130, 81746 }, // ⇔
-    { 20, 25, 26, 3, 14, 125, 81876 }, // ⇕
-    { 18, 26, 20, 1, 24, 117, 82001 }, // ∂
-    { 30, 30, 33, 1, 27, 225, 82118 }, // ∅
-    { 23, 23, 25, 1, 22, 133, 82343 }, // ∆
-    { 19, 23, 22, 1, 21, 110, 82476 }, // ∏
-    { 19, 23, 22, 1, 22, 110, 82586 }, // ∐
-    { 15, 22, 17, 1, 21, 83, 82696 }, // ∑
-    { 16, 5, 18, 1, 11, 20, 82779 }, // −
-    { 24, 26, 28, 2, 24, 156, 82799 }, // √
-    { 25, 17, 27, 1, 19, 107, 82955 }, // ∞
-    { 23, 31, 25, 1, 23, 179, 83062 }, // ∫
-    { 8, 20, 9, 1, 20, 40, 83241 }, // ∶
-    { 18, 17, 42, 12, 17, 77, 83281 }, // ≈
-    { 22, 26, 36, 7, 23, 143, 83358 }, // ≠
-    { 25, 25, 23, -1, 21, 157, 83501 }, // ≤
-    { 24, 26, 25, 1, 22, 156, 83658 }, // ≥
+    { 18, 24, 22, 2, 23, 108, 2048 }, // 4
+    { 16, 24, 20, 2, 23, 96, 2156 }, // 5
+    { 17, 23, 21, 2, 22, 98, 2252 }, // 6
+    { 16, 23, 20, 2, 23, 92, 2350 }, // 7
+    { 18, 23, 22, 2, 22, 104, 2442 }, // 8
+    { 17, 24, 21, 2, 22, 102, 2546 }, // 9
+    { 8, 20, 8, 0, 20, 40, 2648 }, // :
+    { 10, 25, 10, 0, 19, 63, 2688 }, // ;
+    { 23, 19, 23, -1, 19, 110, 2751 }, // <
+    { 16, 11, 18, 1, 13, 44, 2861 }, // =
+    { 23, 19, 23, 1, 19, 110, 2905 }, // >
+    { 18, 37, 19, 1, 33, 167, 3015 }, // ?
+    { 27, 27, 30, 0, 24, 183, 3182 }, // @
+    { 25, 25, 28, 2, 25, 157, 3365 }, // A
+    { 20, 25, 28, 4, 25, 125, 3522 }, // B
+    { 22, 27, 29, 3, 27, 149, 3647 }, // C
+    { 22, 25, 31, 4, 25, 138, 3796 }, // D
+    { 19, 25, 27, 4, 25, 119, 3934 }, // E
+    { 16, 26, 25, 4, 26, 104, 4096 }, // F
+    { 26, 26, 34, 4, 25, 169, 4200 }, // G
+    { 22, 25, 31, 4, 25, 138, 4369 }, // H
+    { 8, 25, 16, 4, 25, 50, 4507 }, // I
+    { 18, 32, 26, 4, 25, 144, 4557 }, // J
+    { 22, 25, 31, 4, 25, 138, 4701 }, // K
+    { 18, 25, 26, 4, 25, 113, 4839 }, // L
+    { 26, 25, 34, 4, 25, 163, 4952 }, // M
+    { 22, 25, 30, 4, 25, 138, 5115 }, // N
+    { 25, 28, 33, 4, 26, 175, 5253 }, // O
+    { 19, 25, 27, 4, 25, 119, 5428 }, // P
+    { 27, 31, 31, 2, 26, 210, 5547 }, // Q
+    { 20, 25, 28, 4, 25, 125, 5757 }, // R
+    { 23, 27, 31, 4, 25, 156, 5882 }, // S
+    { 23, 25, 31, 4, 25, 144, 6144 }, // T
+    { 22, 26, 30, 4, 25, 143, 6288 }, // U
+    { 25, 25, 33, 4, 25, 157, 6431 }, // V
+    { 33, 25, 42, 4, 25, 207, 6588 }, // W
+    { 24, 25, 33, 4, 25, 150, 6795 }, // X
+    { 23, 25, 31, 4, 25, 144, 6945 }, // Y
+    { 23, 25, 32, 4, 25, 144, 7089 }, // Z
+    { 12, 43, 14, 1, 32, 129, 7233 }, // [
+    { 12, 33, 14, 1, 25, 99, 7362 }, // <backslash>
+    { 12, 43, 14, 1, 32, 129, 7461 }, // ]
+    { 17, 8, 16, 0, 29, 34, 7590 }, // ^
+    { 21, 6, 20, -1, -1, 32, 7624 }, // _
+    { 12, 6, 13, 0, 23, 18, 7656 }, // `
+    { 17, 19, 25, 4, 18, 81, 7674 }, // a
+    { 18, 26, 25, 4, 25, 117, 7755 }, // b
+    { 15, 18, 23, 4, 18, 68, 7872 }, // c
+    { 18, 26, 26, 4, 25, 117, 7940 }, // d
+    { 17, 18, 25, 4, 17, 77, 8057 }, // e
+    { 12, 24, 20, 4, 24, 72, 8192 }, // f
+    { 17, 26, 25, 4, 17, 111, 8264 }, // g
+    { 18, 25, 26, 4, 25, 113, 8375 }, // h
+    { 7, 27, 14, 3, 27, 48, 8488 }, // i
+    { 11, 34, 18, 4, 26, 94, 8536 }, // j
+    { 18, 25, 26, 4, 25, 113, 8630 }, // k
+    { 9, 25, 17, 4, 25, 57, 8743 }, // l
+    { 28, 18, 36, 4, 18, 126, 8800 }, // m
+    { 17, 18, 25, 4, 18, 77, 8926 }, // n
+    { 17, 19, 25, 4, 18, 81, 9003 }, // o
+    { 19, 26, 27, 4, 17, 124, 9084 }, // p
+    { 20, 26, 28, 4, 18, 130, 9208 }, // q
+    { 13, 17, 21, 4, 17, 56, 9338 }, // r
+    { 17, 20, 25, 4, 18, 85, 9394 }, // s
+    { 15, 23, 23, 4, 22, 87, 9479 }, // t
+    { 17, 18, 25, 4, 17, 77, 9566 }, // u
+    { 21, 17, 29, 4, 17, 90, 9643 }, // v
+    { 24, 18, 32, 4, 17, 108, 9733 }, // w
+    { 21, 16, 29, 4, 16, 84, 9841 }, // x
+    { 19, 25, 27, 4, 16, 119, 9925 }, // y
+    { 18, 17, 26, 4, 17, 77, 10044 }, // z
+    { 15, 30, 16, 1, 23, 113, 10121 }, // {
+    { 5, 27, 11, 3, 22, 34, 10240 }, // |
+    { 14, 30, 16, 1, 23, 105, 10274 }, // }
+    { 12, 6, 14, 1, 22, 18, 10379 }, // ~
+    { 0, 0, 25, 0, 0, 0, 10397 }, //  
+    { 9, 37, 22, 6, 32, 84, 10397 }, // ¡
+    { 15, 27, 23, 4, 22, 102, 10481 }, // ¢
+    { 19, 26, 20, 1, 25, 124, 10583 }, // £
+    { 18, 18, 20, 1, 20, 81, 10707 }, // ¤
+    { 22, 26, 22, 0, 23, 143, 10788 }, // ¥
+    { 4, 26, 11, 3, 21, 26, 10931 }, // ¦
+    { 16, 26, 22, 3, 23, 104, 10957 }, // §
+    { 15, 7, 16, 0, 24, 27, 11061 }, // ¨
+    { 14, 13, 20, 3, 28, 46, 11088 }, // ©
+    { 10, 10, 19, 6, 22, 25, 11134 }, // ª
+    { 16, 16, 16, 0, 15, 64, 11159 }, // «
+    { 16, 11, 18, 1, 11, 44, 11223 }, // ¬
+    { 16, 4, 18, 1, 11, 16, 11267 }, // ­
+    { 14, 13, 20, 3, 32, 46, 11283 }, // ®
+    { 13, 5, 15, 1, 22, 17, 11329 }, // ¯
+    { 14, 13, 20, 3, 22, 46, 11346 }, // °
+    { 16, 18, 18, 1, 16, 72, 11392 }, // ±
+    { 8, 11, 9, 1, 24, 22, 11464 }, // ²
+    { 8, 11, 10, 1, 24, 22, 11486 }, // ³
+    { 7, 7, 8, 1, 23, 13, 11508 }, // ´
+    { 18, 22, 25, 3, 17, 99, 11521 }, // µ
+    { 17, 25, 22, 2, 21, 107, 11620 }, // ¶
+    { 7, 7, 8, 0, 14, 13, 11727 }, // ·
+    { 8, 9, 10, 1, 1, 18, 11740 }, // ¸
+    { 7, 12, 9, 1, 25, 21, 11758 }, // ¹
+    { 10, 10, 19, 6, 21, 25, 11779 }, // º
+    { 16, 16, 22, 3, 15, 64, 11804 }, // »
+    { 27, 27, 36, 4, 25, 183, 11868 }, // ¼
+    { 30, 27, 36, 4, 25, 203, 12051 }, // ½
+    { 27, 26, 36, 4, 24, 176, 12288 }, // ¾
+    { 18, 37, 19, 1, 21, 167, 12464 }, // ¿
+    { 25, 33, 28, 2, 33, 207, 12631 }, // À
+    { 25, 38, 28, 2, 38, 238, 12838 }, // Á
+    { 25, 35, 28, 2, 35, 219, 13076 }, // Â
+    { 25, 34, 28, 2, 34, 213, 13295 }, // Ã
+    { 25, 35, 28, 2, 35, 219, 13508 }, // Ä
+    { 25, 35, 28, 2, 35, 219, 13727 }, // Å
+    { 36, 26, 40, 2, 25, 234, 13946 }, // Æ
+    { 22, 35, 29, 3, 27, 193, 14336 }, // Ç
+    { 19, 35, 27, 4, 35, 167, 14529 }, // È
+    { 19, 39, 27, 4, 39, 186, 14696 }, // É
+    { 19, 36, 27, 4, 36, 171, 14882 }, // Ê
+    { 19, 36, 27, 4, 36, 171, 15053 }, // Ë
+    { 13, 36, 16, 0, 36, 117, 15224 }, // Ì
+    { 8, 41, 16, 4, 41, 82, 15341 }, // Í
+    { 16, 38, 16, 0, 38, 152, 15423 }, // Î
+    { 15, 38, 16, 0, 38, 143, 15575 }, // Ï
+    { 27, 25, 31, -1, 25, 169, 15718 }, // Ð
+    { 22, 34, 30, 4, 34, 187, 15887 }, // Ñ
+    { 25, 36, 33, 4, 34, 225, 16074 }, // Ò
+    { 25, 41, 33, 4, 39, 257, 16384 }, // Ó
+    { 25, 38, 33, 4, 36, 238, 16641 }, // Ô
+    { 25, 37, 33, 4, 35, 232, 16879 }, // Õ
+    { 25, 38, 33, 4, 36, 238, 17111 }, // Ö
+    { 17, 10, 17, 0, 12, 43, 17349 }, // ×
+    { 41, 59, 33, -4, 43, 605, 17392 }, // Ø
+    { 22, 36, 30, 4, 35, 198, 17997 }, // Ù
+    { 22, 41, 30, 4, 40, 226, 18195 }, // Ú
+    { 22, 38, 30, 4, 37, 209, 18432 }, // Û
+    { 22, 38, 30, 4, 37, 209, 18641 }, // Ü
+    { 23, 42, 31, 4, 42, 242, 18850 }, // Ý
+    { 14, 24, 16, 1, 24, 84, 19092 }, // Þ
+    { 18, 26, 20, 1, 24, 117, 19176 }, // ß
+    { 17, 27, 25, 4, 26, 115, 19293 }, // à
+    { 17, 31, 25, 4, 30, 132, 19408 }, // á
+    { 17, 28, 25, 4, 27, 119, 19540 }, // â
+    { 17, 27, 25, 4, 26, 115, 19659 }, // ã
+    { 17, 28, 25, 4, 27, 119, 19774 }, // ä
+    { 17, 28, 25, 4, 27, 119, 19893 }, // å
+    { 29, 19, 37, 4, 18, 138, 20012 }, // æ
+    { 15, 25, 23, 4, 18, 94, 20150 }, // ç
+    { 17, 30, 25, 4, 29, 128, 20244 }, // è
+    { 17, 35, 25, 4, 34, 149, 20480 }, // é
+    { 17, 32, 25, 4, 31, 136, 20629 }, // ê
+    { 17, 32, 25, 4, 31, 136, 20765 }, // ë
+    { 12, 25, 14, 0, 25, 75, 20901 }, // ì
+    { 7, 30, 14, 4, 30, 53, 20976 }, // í
+    { 17, 27, 14, -1, 27, 115, 21029 }, // î
+    { 14, 25, 14, 0, 25, 88, 21144 }, // ï
+    { 23, 26, 20, -1, 24, 150, 21232 }, // ð
+    { 17, 27, 25, 4, 27, 115, 21382 }, // ñ
+    { 17, 27, 25, 4, 26, 115, 21497 }, // ò
+    { 17, 32, 25, 4, 31, 136, 21612 }, // ó
+    { 17, 29, 25, 4, 28, 124, 21748 }, // ô
+    { 17, 28, 25, 4, 27, 119, 21872 }, // õ
+    { 17, 29, 25, 4, 28, 124, 21991 }, // ö
+    { 22, 21, 26, 2, 20, 116, 22115 }, // ÷
+    { 19, 51, 25, 3, 35, 243, 22231 }, // ø
+    { 17, 27, 25, 4, 26, 115, 22528 }, // ù
+    { 17, 32, 25, 4, 31, 136, 22643 }, // ú
+    { 17, 29, 25, 4, 28, 124, 22779 }, // û
+    { 17, 29, 25, 4, 28, 124, 22903 }, // ü
+    { 19, 43, 27, 4, 34, 205, 23027 }, // ý
+    { 14, 31, 16, 1, 25, 109, 23232 }, // þ
+    { 19, 39, 27, 4, 30, 186, 23341 }, // ÿ
+    { 25, 35, 28, 2, 35, 219, 23527 }, // Ā
+    { 17, 29, 25, 4, 28, 124, 23746 }, // ā
+    { 25, 35, 28, 2, 35, 219, 23870 }, // Ă
+    { 17, 28, 25, 4, 27, 119, 24089 }, // ă
+    { 25, 33, 28, 2, 25, 207, 24208 }, // Ą
+    { 19, 27, 25, 4, 18, 129, 24415 }, // ą
+    { 22, 36, 29, 3, 36, 198, 24576 }, // Ć
+    { 15, 25, 23, 4, 25, 94, 24774 }, // ć
+    { 22, 38, 29, 3, 38, 209, 24868 }, // Ĉ
+    { 17, 27, 23, 3, 27, 115, 25077 }, // ĉ
+    { 22, 36, 29, 3, 36, 198, 25192 }, // Ċ
+    { 15, 26, 23, 4, 26, 98, 25390 }, // ċ
+    { 22, 38, 29, 3, 38, 209, 25488 }, // Č
+    { 16, 28, 23, 4, 28, 112, 25697 }, // č
+    { 22, 37, 31, 4, 37, 204, 25809 }, // Ď
+    { 23, 26, 26, 4, 25, 150, 26013 }, // ď
+    { 27, 25, 31, -1, 25, 169, 26163 }, // Đ
+    { 22, 26, 26, 4, 25, 143, 26332 }, // đ
+    { 19, 36, 27, 4, 36, 171, 26624 }, // Ē
+    { 17, 32, 25, 4, 31, 136, 26795 }, // ē
+    { 19, 36, 27, 4, 36, 171, 26931 }, // Ĕ
+    { 17, 32, 25, 4, 31, 136, 27102 }, // ĕ
+    { 19, 36, 27, 4, 36, 171, 27238 }, // Ė
+    { 17, 32, 25, 4, 31, 136, 27409 }, // ė
+    { 19, 32, 27, 4, 25, 152, 27545 }, // Ę
+    { 17, 29, 25, 4, 17, 124, 27697 }, // ę
+    { 19, 38, 27, 4, 38, 181, 27821 }, // Ě
+    { 17, 34, 25, 4, 33, 145, 28002 }, // ě
+    { 26, 40, 34, 4, 39, 260, 28147 }, // Ĝ
+    { 18, 39, 25, 4, 30, 176, 28407 }, // ĝ
+    { 26, 38, 34, 4, 37, 247, 28672 }, // Ğ
+    { 17, 37, 25, 4, 28, 158, 28919 }, // ğ
+    { 26, 39, 34, 4, 38, 254, 29077 }, // Ġ
+    { 17, 37, 25, 4, 28, 158, 29331 }, // ġ
+    { 26, 44, 34, 4, 43, 286, 29489 }, // Ģ
+    { 17, 39, 25, 4, 30, 166, 29775 }, // ģ
+    { 22, 37, 31, 4, 37, 204, 29941 }, // Ĥ
+    { 22, 35, 26, 0, 35, 193, 30145 }, // ĥ
+    { 25, 25, 31, 3, 25, 157, 30338 }, // Ħ
+    { 22, 25, 26, 0, 25, 138, 30495 }, // ħ
+    { 11, 38, 16, 2, 38, 105, 30720 }, // Ĩ
+    { 12, 27, 14, 1, 27, 81, 30825 }, // ĩ
+    { 16, 37, 16, -1, 37, 148, 30906 }, // Ī
+    { 17, 27, 14, -2, 27, 115, 31054 }, // ī
+    { 9, 32, 16, 3, 25, 72, 31169 }, // Į
+    { 8, 36, 14, 3, 27, 72, 31241 }, // į
+    { 8, 38, 16, 4, 38, 76, 31313 }, // İ
+    { 6, 17, 14, 4, 17, 26, 31389 }, // ı
+    { 23, 36, 46, 11, 25, 207, 31415 }, // Ĳ
+    { 18, 34, 14, 3, 27, 153, 31622 }, // ĳ
+    { 20, 43, 26, 4, 36, 215, 31775 }, // Ĵ
+    { 17, 37, 18, 3, 29, 158, 31990 }, // ĵ
+    { 22, 40, 31, 4, 40, 220, 32148 }, // Ķ
+    { 18, 40, 26, 4, 25, 180, 32368 }, // ķ
+    { 15, 16, 19, 2, 16, 60, 32548 }, // ĸ
+    { 18, 34, 26, 4, 34, 153, 32608 }, // Ĺ
+    { 9, 38, 17, 4, 38, 86, 32768 }, // ĺ
+    { 20, 39, 26, 2, 39, 195, 32854 }, // Ļ
+    { 11, 41, 17, 2, 25, 113, 33049 }, // ļ
+    { 18, 25, 26, 4, 25, 113, 33162 }, // Ľ
+    { 14, 30, 17, 4, 30, 105, 33275 }, // ľ
+    { 18, 25, 26, 4, 25, 113, 33380 }, // Ŀ
+    { 14, 25, 17, 4, 25, 88, 33493 }, // ŀ
+    { 32, 45, 26, -8, 35, 360, 33581 }, // Ł
+    { 22, 25, 17, -6, 25, 138, 33941 }, // ł
+    { 22, 35, 30, 4, 35, 193, 34079 }, // Ń
+    { 17, 29, 25, 4, 29, 124, 34272 }, // ń
+    { 22, 37, 30, 4, 25, 204, 34396 }, // Ņ
+    { 17, 30, 25, 4, 18, 128, 34600 }, // ņ
+    { 22, 38, 30, 4, 38, 209, 34816 }, // Ň
+    { 18, 31, 25, 4, 31, 140, 35025 }, // ň
+    { 17, 30, 25, 4, 30, 128, 35165 }, // ŉ
+    { 22, 32, 30, 4, 25, 176, 35293 }, // Ŋ
+    { 17, 24, 25, 4, 18, 102, 35469 }, // ŋ
+    { 25, 38, 33, 4, 36, 238, 35571 }, // Ō
+    { 17, 29, 25, 4, 28, 124, 35809 }, // ō
+    { 25, 38, 33, 4, 36, 238, 35933 }, // Ŏ
+    { 17, 29, 25, 4, 28, 124, 36171 }, // ŏ
+    { 27, 37, 33, 4, 35, 250, 36295 }, // Ő
+    { 25, 28, 25, 2, 27, 175, 36545 }, // ő
+    { 35, 28, 35, 4, 26, 245, 36864 }, // Œ
+    { 29, 19, 31, 4, 18, 138, 37109 }, // œ
+    { 20, 34, 28, 4, 34, 170, 37247 }, // Ŕ
+    { 13, 25, 21, 4, 25, 82, 37417 }, // ŕ
+    { 20, 40, 28, 4, 40, 200, 37499 }, // Ŗ
+    { 14, 30, 21, 3, 30, 105, 37699 }, // ŗ
+    { 20, 37, 28, 4, 37, 185, 37804 }, // Ř
+    { 17, 27, 21, 1, 27, 115, 37989 }, // ř
+    { 23, 36, 31, 4, 34, 207, 38104 }, // Ś
+    { 17, 27, 25, 4, 25, 115, 38311 }, // ś
+    { 23, 37, 31, 4, 35, 213, 38426 }, // Ŝ
+    { 17, 29, 25, 4, 27, 124, 38639 }, // ŝ
+    { 23, 33, 31, 4, 25, 190, 38912 }, // Ş
+    { 17, 26, 25, 4, 18, 111, 39102 }, // ş
+    { 23, 38, 31, 4, 36, 219, 39213 }, // Š
+    { 17, 30, 25, 4, 28, 128, 39432 }, // š
+    { 23, 33, 31, 4, 25, 190, 39560 }, // Ţ
+    { 15, 29, 23, 4, 22, 109, 39750 }, // ţ
+    { 23, 37, 31, 4, 37, 213, 39859 }, // Ť
+    { 19, 28, 23, 4, 27, 133, 40072 }, // ť
+    { 23, 25, 31, 4, 25, 144, 40205 }, // Ŧ
+    { 16, 23, 23, 3, 22, 92, 40349 }, // ŧ
+    { 22, 38, 30, 4, 37, 209, 40441 }, // Ũ
+    { 17, 29, 25, 4, 28, 124, 40650 }, // ũ
+    { 22, 38, 30, 4, 37, 209, 40960 }, // Ū
+    { 17, 28, 25, 4, 27, 119, 41169 }, // ū
+    { 22, 38, 30, 4, 37, 209, 41288 }, // Ŭ
+    { 17, 29, 25, 4, 28, 124, 41497 }, // ŭ
+    { 22, 40, 30, 4, 39, 220, 41621 }, // Ů
+    { 17, 31, 25, 4, 30, 132, 41841 }, // ů
+    { 26, 37, 30, 4, 36, 241, 41973 }, // Ű
+    { 25, 27, 25, 2, 26, 169, 42214 }, // ű
+    { 22, 32, 30, 4, 25, 176, 42383 }, // Ų
+    { 17, 26, 25, 4, 17, 111, 42559 }, // ų
+    { 33, 37, 42, 4, 37, 306, 42670 }, // Ŵ
+    { 24, 31, 32, 4, 30, 186, 43008 }, // ŵ
+    { 23, 39, 31, 4, 39, 225, 43194 }, // Ŷ
+    { 19, 40, 27, 4, 31, 190, 43419 }, // ŷ
+    { 23, 39, 31, 4, 39, 225, 43609 }, // Ÿ
+    { 23, 34, 32, 4, 34, 196, 43834 }, // Ź
+    { 18, 28, 26, 4, 28, 126, 44030 }, // ź
+    { 23, 34, 32, 4, 34, 196, 44156 }, // Ż
+    { 18, 28, 26, 4, 28, 126, 44352 }, // ż
+    { 23, 36, 32, 4, 36, 207, 44478 }, // Ž
+    { 18, 30, 26, 4, 30, 135, 44685 }, // ž
+    { 11, 24, 18, 3, 24, 66, 44820 }, // ſ
+    { 12, 6, 0, 0, 23, 18, 44886 }, // ̀
+    { 7, 7, 0, 1, 23, 13, 44904 }, // ́
+    { 16, 8, 0, 0, 1, 32, 44917 }, // ̂
+    { 12, 6, 0, 1, 22, 18, 44949 }, // ̃
+    { 16, 5, 0, 1, 21, 20, 44967 }, // ̄
+    { 21, 5, 0, 0, 27, 27, 44987 }, // ̅
+    { 14, 6, 0, 1, 21, 21, 45014 }, // ̆
+    { 7, 7, 0, 4, 24, 13, 45035 }, // ̇
+    { 14, 6, 0, 0, 21, 21, 45056 }, // ̈
+    { 6, 7, 0, 6, 19, 11, 45077 }, // ̉
+    { 8, 8, 0, 1, 23, 16, 45088 }, // ̊
+    { 25, 6, 0, 1, 23, 38, 45104 }, // ̋
+    { 16, 8, 0, 0, 23, 32, 45142 }, // ̌
+    { 25, 6, 0, -7, 23, 38, 45174 }, // ̏
+    { 10, 10, 0, 0, 23, 25, 45212 }, // ̒
+    { 10, 10, 0, 0, 22, 25, 45237 }, // ̓
+    { 10, 10, 0, -1, 22, 25, 45262 }, // ̔
+    { 7, 9, 0, 1, 0, 16, 45287 }, // ̘
+    { 7, 9, 0, 1, 0, 16, 45303 }, // ̙
+    { 14, 9, 0, 1, 24, 32, 45319 }, // ̚
+    { 7, 9, 0, 0, 20, 16, 45351 }, // ̛
+    { 5, 9, 0, 1, 0, 12, 45367 }, // ̜
+    { 8, 7, 0, 1, 4, 14, 45379 }, // ̝
+    { 8, 6, 0, 1, 0, 12, 45393 }, // ̞
+    { 7, 7, 0, 2, -2, 13, 45405 }, // ̟
+    { 16, 5, 0, 1, -3, 20, 45418 }, // ̠
+    { 8, 7, 0, 0, 3, 14, 45438 }, // ̣
+    { 14, 6, 0, 0, -2, 21, 45452 }, // ̤
+    { 8, 8, 0, 1, 23, 16, 45473 }, // ̥
+    { 10, 10, 0, 0, 5, 25, 45489 }, // ̦
+    { 8, 9, 0, 1, 1, 18, 45514 }, // ̧
+    { 9, 10, 0, 1, 1, 23, 45532 }, // ̨
+    { 6, 10, 0, 1, -1, 15, 45555 }, // ̩
+    { 13, 7, 0, 0, 0, 23, 45570 }, // ̪
+    { 18, 9, 0, -1, 1, 41, 45593 }, // ̬
+    { 18, 9, 0, -1, 1, 41, 45634 }, // ̭
+    { 13, 8, 0, 1, 25, 26, 45675 }, // ̰
+    { 15, 5, 0, 1, 24, 19, 45701 }, // ̱
+    { 16, 5, 0, 0, -1, 20, 45720 }, // ̲
+    { 13, 8, 0, 1, 25, 26, 45740 }, // ̴
+    { 16, 4, 0, 0, 11, 16, 45766 }, // ̵
+    { 5, 10, 0, 1, 0, 13, 45782 }, // ̹
+    { 13, 9, 0, 0, 1, 30, 45795 }, // ̺
+    { 12, 10, 0, 0, 1, 30, 45825 }, // ̻
+    { 11, 8, 0, 1, 1, 22, 45855 }, // ̼
+    { 9, 7, 0, 2, 22, 16, 45877 }, // ̽
+    { 12, 6, 0, 1, 22, 18, 45893 }, // ͂
+    { 6, 8, 0, 7, 26, 12, 45911 }, // ̓
+    { 14, 22, 0, 1, 37, 77, 45923 }, // ̈́
+    { 13, 7, 0, 0, 24, 23, 46000 }, // ͆
+    { 16, 11, 0, 1, 0, 44, 46023 }, // ͇
+    { 13, 9, 0, 1, 1, 30, 46067 }, // ͈
+    { 11, 9, 0, 1, -1, 25, 46097 }, // ͉
+    { 15, 23, 0, 1, 31, 87, 46122 }, // ͊
+    { 26, 22, 0, 1, 33, 143, 46209 }, // ͋
+    { 18, 17, 0, 12, 17, 77, 46352 }, // ͌
+    { 15, 7, 0, 2, -3, 27, 46429 }, // ͍
+    { 5, 5, 0, 1, 4, 7, 46456 }, // ͎
+    { 25, 8, 0, 1, 2, 50, 46463 }, // ͜
+    { 25, 8, 0, 1, 24, 50, 46513 }, // ͡
+    { 31, 9, 0, 1, -1, 70, 46563 }, // ͢
+    { 18, 36, 26, 4, 36, 162, 46633 }, // Ѐ
+    { 19, 36, 27, 4, 36, 171, 46795 }, // Ё
+    { 25, 27, 20, -4, 25, 169, 47104 }, // Ђ
+    { 17, 34, 19, 1, 33, 145, 47273 }, // Ѓ
+    { 22, 25, 24, 1, 23, 138, 47418 }, // Є
+    { 23, 27, 31, 4, 25, 156, 47556 }, // Ѕ
+    { 8, 25, 16, 4, 25, 50, 47712 }, // І
+    { 13, 36, 16, 1, 36, 117, 47762 }, // Ї
+    { 18, 32, 26, 4, 25, 144, 47879 }, // Ј
+    { 29, 24, 34, 2, 22, 174, 48023 }, // Љ
+    { 27, 24, 18, -5, 23, 162, 48197 }, // Њ
+    { 27, 27, 31, 4, 27, 183, 48359 }, // Ћ
+    { 22, 34, 31, 4, 34, 187, 48542 }, // Ќ
+    { 22, 38, 30, 4, 38, 209, 48729 }, // Ѝ
+    { 19, 37, 23, 2, 34, 176, 48938 }, // Ў
+    { 19, 28, 23, 2, 21, 133, 49152 }, // Џ
+    { 25, 25, 28, 2, 25, 157, 49285 }, // А
+    { 15, 21, 19, 2, 21, 79, 49442 }, // Б
+    { 16, 23, 20, 2, 22, 92, 49521 }, // В
+    { 17, 23, 19, 1, 22, 98, 49613 }, // Г
+    { 23, 26, 24, 1, 22, 150, 49711 }, // Д
+    { 18, 25, 26, 4, 25, 113, 49861 }, // Е
+    { 36, 25, 32, -1, 25, 225, 49974 }, // Ж
+    { 15, 22, 19, 2, 21, 83, 50199 }, // З
+    { 22, 25, 30, 4, 25, 138, 50282 }, // И
+    { 22, 38, 30, 4, 38, 209, 50420 }, // Й
+    { 22, 25, 31, 4, 25, 138, 50629 }, // К
+    { 19, 24, 18, -1, 22, 114, 50767 }, // Л
+    { 23, 23, 25, 1, 22, 133, 50881 }, // М
+    { 22, 25, 31, 4, 25, 138, 51014 }, // Н
+    { 25, 28, 33, 4, 26, 175, 51200 }, // О
+    { 18, 24, 20, 1, 23, 108, 51375 }, // П
+    { 19, 25, 27, 4, 25, 119, 51483 }, // Р
+    { 22, 27, 29, 3, 27, 149, 51602 }, // С
+    { 23, 25, 31, 4, 25, 144, 51751 }, // Т
+    { 19, 25, 23, 2, 22, 119, 51895 }, // У
+    { 22, 22, 25, 2, 22, 121, 52014 }, // Ф
+    { 24, 25, 33, 4, 25, 150, 52135 }, // Х
+    { 19, 28, 21, 1, 22, 133, 52285 }, // Ц
+    { 16, 22, 19, 2, 22, 88, 52418 }, // Ч
+    { 22, 23, 24, 1, 22, 127, 52506 }, // Ш
+    { 24, 28, 26, 1, 22, 168, 52633 }, // Щ
+    { 21, 22, 18, -5, 22, 116, 52801 }, // Ъ
+    { 29, 25, 34, 1, 25, 182, 52917 }, // Ы
+    { 15, 22, 18, 1, 22, 83, 53099 }, // Ь
+    { 22, 25, 24, 1, 23, 138, 53248 }, // Э
+    { 23, 22, 27, 2, 22, 127, 53386 }, // Ю
+    { 20, 25, 28, 4, 25, 125, 53513 }, // Я
+    { 17, 19, 25, 4, 18, 81, 53638 }, // а
+    { 18, 28, 20, 1, 26, 126, 53719 }, // б
+    { 15, 17, 21, 3, 17, 64, 53845 }, // в
+    { 15, 18, 17, 1, 17, 68, 53909 }, // г
+    { 20, 21, 22, 1, 17, 105, 53977 }, // д
+    { 17, 18, 25, 4, 17, 77, 54082 }, // е
+    { 34, 21, 41, 4, 21, 179, 54159 }, // ж
+    { 11, 16, 13, 1, 16, 44, 54338 }, // з
+    { 18, 18, 20, 1, 17, 81, 54382 }, // и
+    { 16, 28, 20, 1, 28, 112, 54463 }, // й
+    { 17, 16, 24, 3, 16, 68, 54575 }, // к
+    { 13, 17, 12, -1, 15, 56, 54643 }, // л
+    { 19, 18, 25, 3, 18, 86, 54699 }, // м
+    { 18, 18, 24, 3, 18, 81, 54785 }, // н
+    { 17, 19, 25, 4, 18, 81, 54866 }, // о
+    { 17, 18, 19, 1, 17, 77, 54947 }, // п
+    { 19, 26, 27, 4, 17, 124, 55024 }, // р
+    { 15, 18, 23, 4, 18, 68, 55148 }, // с
+    { 18, 18, 20, 1, 17, 81, 55296 }, // т
+    { 19, 25, 27, 4, 16, 119, 55377 }, // у
+    { 24, 24, 25, 1, 17, 144, 55496 }, // ф
+    { 21, 18, 21, 0, 17, 95, 55640 }, // х
+    { 19, 22, 21, 1, 17, 105, 55735 }, // ц
+    { 11, 15, 13, 1, 15, 42, 55840 }, // ч
+    { 22, 18, 24, 1, 17, 99, 55882 }, // ш
+    { 24, 23, 26, 1, 17, 138, 55981 }, // щ
+    { 17, 16, 14, -4, 16, 68, 56119 }, // ъ
+    { 21, 19, 25, 1, 19, 100, 56187 }, // ы
+    { 12, 17, 14, 1, 17, 51, 56287 }, // ь
+    { 15, 16, 19, 2, 16, 60, 56338 }, // э
+    { 19, 18, 22, 1, 18, 86, 56398 }, // ю
+    { 17, 20, 24, 3, 19, 85, 56484 }, // я
+    { 17, 32, 25, 4, 31, 136, 56569 }, // ѐ
+    { 17, 30, 25, 4, 29, 128, 56705 }, // ё
+    { 23, 29, 26, 0, 25, 167, 56833 }, // ђ
+    { 15, 26, 17, 1, 25, 98, 57000 }, // ѓ
+    { 15, 17, 17, 1, 16, 64, 57098 }, // є
+    { 17, 20, 25, 4, 18, 85, 57162 }, // ѕ
+    { 7, 27, 14, 3, 27, 48, 57247 }, // і
+    { 14, 25, 14, 0, 25, 88, 57344 }, // ї
+    { 11, 34, 18, 4, 26, 94, 57432 }, // ј
+    { 20, 17, 23, 2, 15, 85, 57526 }, // љ
+    { 19, 17, 12, -4, 16, 81, 57611 }, // њ
+    { 22, 25, 26, 0, 25, 138, 57692 }, // ћ
+    { 17, 25, 24, 3, 25, 107, 57830 }, // ќ
+    { 18, 28, 20, 1, 27, 126, 57937 }, // ѝ
+    { 19, 39, 27, 4, 30, 186, 58063 }, // ў
+    { 14, 22, 17, 2, 16, 77, 58249 }, // џ
+    { 20, 24, 22, 0, 22, 120, 58326 }, // Ѣ
+    { 20, 24, 19, -1, 22, 120, 58446 }, // ѣ
+    { 27, 23, 25, -1, 22, 156, 58566 }, // Ѫ
+    { 19, 17, 18, -1, 16, 81, 58722 }, // ѫ
+    { 23, 32, 32, 5, 31, 184, 58803 }, // Ѳ
+    { 18, 26, 25, 4, 25, 117, 58987 }, // ѳ
+    { 28, 31, 33, 4, 31, 217, 59104 }, // Ѵ
+    { 20, 21, 25, 3, 21, 105, 59392 }, // ѵ
+    { 12, 11, 0, 3, 28, 33, 59497 }, // ҆
+    { 17, 26, 19, 1, 25, 111, 59530 }, // Ґ
+    { 15, 22, 17, 1, 21, 83, 59641 }, // ґ
+    { 20, 24, 19, -2, 22, 120, 59724 }, // Ғ
+    { 14, 16, 13, -1, 15, 56, 59844 }, // ғ
+    { 19, 27, 18, -1, 25, 129, 59900 }, // Ҕ
+    { 11, 17, 11, 0, 15, 47, 60029 }, // ҕ
+    { 38, 30, 43, 3, 25, 285, 60076 }, // Җ
+    { 26, 21, 29, 2, 17, 137, 60361 }, // җ
+    { 15, 26, 19, 2, 21, 98, 60498 }, // Ҙ
+    { 11, 23, 13, 1, 16, 64, 60596 }, // ҙ
+    { 23, 30, 21, 3, 25, 173, 60660 }, // Қ
+    { 16, 20, 15, 2, 17, 80, 60833 }, // қ
+    { 28, 24, 32, 2, 22, 168, 60913 }, // Ҝ
+    { 20, 17, 22, 1, 16, 85, 61081 }, // ҝ
+    { 22, 25, 31, 4, 25, 138, 61166 }, // Ҟ
+    { 21, 25, 26, 1, 25, 132, 61304 }, // ҟ
+    { 26, 25, 31, 0, 25, 163, 61440 }, // Ҡ
+    { 18, 17, 21, 0, 17, 77, 61603 }, // ҡ
+    { 24, 29, 22, 0, 25, 174, 61680 }, // Ң
+    { 16, 20, 16, 0, 17, 80, 61854 }, // ң
+    { 32, 25, 31, 4, 25, 200, 61934 }, // Ҥ
+    { 22, 17, 21, 3, 17, 94, 62134 }, // ҥ
+    { 31, 27, 37, 3, 25, 210, 62228 }, // Ҧ
+    { 28, 29, 37, 4, 20, 203, 62438 }, // ҧ
+    { 28, 25, 20, -4, 22, 175, 62641 }, // Ҩ
+    { 22, 20, 16, -3, 18, 110, 62816 }, // ҩ
+    { 22, 31, 29, 3, 27, 171, 62926 }, // Ҫ
+    { 15, 21, 23, 4, 18, 79, 63097 }, // ҫ
+    { 22, 29, 23, 1, 25, 160, 63176 }, // Ҭ
+    { 16, 20, 16, 0, 17, 80, 63336 }, // ҭ
+    { 23, 25, 31, 4, 25, 144, 63488 }, // Ү
+    { 18, 23, 22, 2, 16, 104, 63632 }, // ү
+    { 23, 25, 31, 4, 25, 144, 63736 }, // Ұ
+    { 19, 23, 22, 1, 16, 110, 63880 }, // ұ
+    { 24, 30, 23, 4, 25, 180, 63990 }, // Ҳ
+    { 17, 20, 16, 2, 17, 85, 64170 }, // ҳ
+    { 27, 28, 18, -5, 21, 189, 64255 }, // Ҵ
+    { 19, 20, 13, -3, 15, 95, 64444 }, // ҵ
+    { 20, 29, 20, 0, 22, 145, 64539 }, // Ҷ
+    { 14, 21, 14, 0, 16, 74, 64684 }, // ҷ
+    { 16, 22, 19, 2, 22, 88, 64758 }, // Ҹ
+    { 11, 15, 13, 1, 15, 42, 64846 }, // ҹ
+    { 18, 25, 20, 1, 24, 113, 64888 }, // Һ
+    { 18, 25, 26, 4, 25, 113, 65001 }, // һ
+    { 33, 23, 28, -6, 22, 190, 65114 }, // Ҽ
+    { 23, 16, 20, -4, 15, 92, 65304 }, // ҽ
+    { 32, 28, 26, -4, 22, 224, 65536 }, // Ҿ
+    { 23, 19, 19, -3, 15, 110, 65760 }, // ҿ
+    { 8, 25, 16, 4, 25, 50, 65870 }, // Ӏ
+    { 36, 39, 32, -1, 39, 351, 65920 }, // Ӂ
+    { 34, 34, 41, 4, 34, 289, 66271 }, // ӂ
+    { 19, 31, 21, 1, 23, 148, 66560 }, // Ӄ
+    { 13, 21, 15, 1, 15, 69, 66708 }, // ӄ
+    { 21, 29, 18, -1, 22, 153, 66777 }, // Ӆ
+    { 15, 20, 12, -1, 15, 75, 66930 }, // ӆ
+    { 24, 33, 31, 4, 25, 198, 67005 }, // Ӈ
+    { 16, 22, 21, 3, 17, 88, 67203 }, // ӈ
+    { 24, 35, 31, 4, 25, 210, 67291 }, // Ӊ
+    { 17, 24, 21, 3, 17, 102, 67584 }, // ӊ
+    { 18, 28, 20, 1, 22, 126, 67686 }, // Ӌ
+    { 12, 20, 18, 3, 15, 60, 67812 }, // ӌ
+    { 28, 35, 34, 4, 25, 245, 67872 }, // Ӎ
+    { 19, 24, 23, 3, 17, 114, 68117 }, // ӎ
+    { 6, 22, 18, 6, 21, 33, 68231 }, // ӏ
+    { 25, 35, 28, 2, 35, 219, 68264 }, // Ӑ
+    { 17, 27, 25, 4, 26, 115, 68483 }, // ӑ
+    { 25, 34, 28, 2, 34, 213, 68598 }, // Ӓ
+    { 17, 28, 25, 4, 27, 119, 68811 }, // ӓ
+    { 36, 26, 40, 2, 25, 234, 68930 }, // Ӕ
+    { 29, 19, 37, 4, 18, 138, 69164 }, // ӕ
+    { 18, 35, 26, 4, 35, 158, 69302 }, // Ӗ
+    { 17, 31, 25, 4, 30, 132, 69460 }, // ӗ
+    { 22, 24, 31, 5, 22, 132, 69632 }, // Ә
+    { 17, 19, 25, 5, 18, 81, 69764 }, // ә
+    { 22, 34, 31, 5, 32, 187, 69845 }, // Ӛ
+    { 17, 24, 25, 5, 18, 102, 70032 }, // ӛ
+    { 37, 38, 41, 2, 38, 352, 70134 }, // Ӝ
+    { 34, 33, 41, 4, 33, 281, 70486 }, // ӝ
+    { 15, 35, 19, 2, 34, 132, 70767 }, // Ӟ
+    { 14, 23, 13, -1, 23, 81, 70899 }, // ӟ
+    { 16, 24, 20, 2, 22, 96, 70980 }, // Ӡ
+    { 16, 23, 20, 2, 16, 92, 71076 }, // ӡ
+    { 22, 38, 30, 4, 38, 209, 71168 }, // Ӣ
+    { 18, 28, 20, 1, 27, 126, 71377 }, // ӣ
+    { 22, 36, 30, 4, 36, 198, 71680 }, // Ӥ
+    { 18, 27, 20, 1, 26, 122, 71878 }, // ӥ
+    { 25, 37, 33, 4, 35, 232, 72000 }, // Ӧ
+    { 18, 31, 25, 3, 30, 140, 72232 }, // ӧ
+    { 22, 24, 33, 5, 23, 132, 72372 }, // Ө
+    { 17, 19, 25, 4, 18, 81, 72504 }, // ө
+    { 22, 33, 33, 5, 32, 182, 72585 }, // Ӫ
+    { 17, 28, 25, 4, 27, 119, 72767 }, // ӫ
+    { 22, 37, 24, 1, 35, 204, 72886 }, // Ӭ
+    { 16, 24, 19, 1, 24, 96, 73090 }, // ӭ
+    { 19, 37, 23, 2, 34, 176, 73186 }, // Ӯ
+    { 19, 39, 27, 4, 30, 186, 73362 }, // ӯ
+    { 19, 37, 23, 2, 34, 176, 73548 }, // Ӱ
+    { 19, 38, 27, 4, 29, 181, 73728 }, // ӱ
+    { 26, 37, 23, 1, 34, 241, 73909 }, // Ӳ
+    { 26, 38, 27, 3, 29, 247, 74150 }, // ӳ
+    { 16, 29, 19, 2, 29, 116, 74397 }, // Ӵ
+    { 13, 22, 13, 0, 22, 72, 74513 }, // ӵ
+    { 17, 27, 19, 1, 22, 115, 74585 }, // Ӷ
+    { 12, 19, 13, 1, 15, 57, 74700 }, // ӷ
+    { 29, 38, 34, 1, 38, 276, 74757 }, // Ӹ
+    { 21, 30, 25, 1, 30, 158, 75033 }, // ӹ
+    { 27, 28, 33, 4, 25, 189, 75191 }, // Ӽ
+    { 19, 19, 23, 3, 17, 91, 75380 }, // ӽ
+    { 0, 0, 19, 0, 0, 0, 75471 }, //  
+    { 0, 0, 34, 0, 0, 0, 75471 }, //  
+    { 0, 0, 19, 0, 0, 0, 75471 }, //  
+    { 0, 0, 34, 0, 0, 0, 75471 }, //  
+    { 0, 0, 14, 0, 0, 0, 75471 }, //  
+    { 0, 0, 12, 0, 0, 0, 75471 }, //  
+    { 0, 0, 10, 0, 0, 0, 75471 }, //  
+    { 0, 0, 21, 0, 0, 0, 75471 }, //  
+    { 0, 0, 8, 0, 0, 0, 75471 }, //  
+    { 0, 0, 11, 0, 0, 0, 75471 }, //  
+    { 0, 0, 9, 0, 0, 0, 75471 }, //  
+    { 0, 0, 5, 0, 0, 0, 75471 }, // ​
+    { 0, 0, 0, 0, 0, 0, 75471 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 75471 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 75471 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 75471 }, // ‏
+    { 16, 4, 16, 0, 11, 16, 75471 }, // ‐
+    { 16, 4, 16, 0, 11, 16, 75487 }, // ‑
+    { 24, 4, 16, -4, 11, 24, 75503 }, // ‒
+    { 21, 6, 23, 1, 11, 32, 75527 }, // –
+    { 31, 6, 33, 1, 11, 47, 75559 }, // —
+    { 31, 6, 33, 1, 11, 47, 75606 }, // ―
+    { 14, 27, 16, 3, 22, 95, 75653 }, // ‖
+    { 24, 10, 16, -4, -2, 60, 75776 }, // ‗
+    { 10, 10, 13, 1, 26, 25, 75836 }, // ‘
+    { 10, 10, 13, 1, 26, 25, 75861 }, // ’
+    { 10, 10, 9, 0, 5, 25, 75886 }, // ‚
+    { 10, 10, 13, 1, 26, 25, 75911 }, // ‛
+    { 20, 10, 22, 1, 26, 50, 75936 }, // “
+    { 20, 10, 22, 1, 26, 50, 75986 }, // ”
+    { 10, 10, 9, 0, 5, 25, 76036 }, // „
+    { 20, 10, 22, 1, 26, 50, 76061 }, // ‟
+    { 18, 41, 24, 3, 31, 185, 76111 }, // †
+    { 17, 41, 25, 5, 30, 175, 76296 }, // ‡
+    { 23, 23, 15, -4, 26, 133, 76471 }, // •
+    { 10, 10, 18, 4, 13, 25, 76604 }, // ‣
+    { 7, 7, 18, 5, 7, 13, 76629 }, // ․
+    { 7, 7, 18, 5, 7, 13, 76642 }, // ‥
+    { 27, 7, 28, 0, 7, 48, 76655 }, // …
+    { 4, 4, 16, 6, 11, 4, 76703 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 76707 }, //  
+    { 21, 26, 33, 6, 23, 137, 76707 }, // ‰
+    { 10, 10, 16, 5, 26, 25, 76844 }, // ′
+    { 19, 10, 23, 5, 26, 48, 76869 }, // ″
+    { 23, 9, 12, 2, 25, 52, 76917 }, // ‴
+    { 8, 9, 12, 2, 24, 18, 76969 }, // ‵
+    { 14, 9, 12, 0, 24, 32, 76987 }, // ‶
+    { 24, 9, 12, -6, 25, 54, 77019 }, // ‷
+    { 17, 7, 19, 1, 25, 30, 77073 }, // ‸
+    { 10, 16, 12, 1, 16, 40, 77103 }, // ‹
+    { 10, 16, 12, 1, 16, 40, 77143 }, // ›
+    { 32, 38, 40, 5, 30, 304, 77183 }, // ※
+    { 9, 37, 18, 4, 32, 84, 77487 }, // ‼
+    { 18, 46, 25, 3, 39, 207, 77571 }, // ‽
+    { 16, 4, 16, 0, 24, 16, 77778 }, // ‾
+    { 14, 7, 16, 1, 20, 25, 77794 }, // ‿
+    { 21, 22, 19, -1, 28, 116, 77824 }, // ⁂
+    { 20, 25, 36, 8, 23, 125, 77940 }, // ⁄
+    { 36, 37, 44, 4, 33, 333, 78065 }, // ⁇
+    { 31, 38, 35, 2, 33, 295, 78398 }, // ⁈
+    { 24, 38, 23, -1, 33, 228, 78693 }, // ⁉
+    { 22, 51, 27, 2, 35, 281, 78921 }, // ⁒
+    { 0, 0, 136, 0, 0, 0, 79202 }, //  
+    { 8, 12, 10, 1, 24, 24, 79202 }, // ⁰
+    { 9, 11, 10, 1, 25, 25, 79226 }, // ⁴
+    { 8, 12, 10, 1, 25, 24, 79251 }, // ⁵
+    { 9, 11, 10, 1, 24, 25, 79275 }, // ⁶
+    { 9, 13, 11, 1, 25, 30, 79300 }, // ⁷
+    { 9, 11, 11, 1, 24, 25, 79330 }, // ⁸
+    { 9, 12, 11, 1, 24, 27, 79355 }, // ⁹
+    { 17, 18, 25, 4, 18, 77, 79382 }, // ⁿ
+    { 9, 12, 10, 1, 7, 27, 79459 }, // ₀
+    { 8, 12, 10, 1, 7, 24, 79486 }, // ₁
+    { 9, 12, 11, 1, 7, 27, 79510 }, // ₂
+    { 9, 12, 10, 1, 7, 27, 79537 }, // ₃
+    { 9, 12, 11, 1, 7, 27, 79564 }, // ₄
+    { 8, 12, 10, 1, 7, 24, 79591 }, // ₅
+    { 9, 12, 11, 1, 7, 27, 79615 }, // ₆
+    { 9, 12, 11, 1, 7, 27, 79642 }, // ₇
+    { 9, 12, 11, 1, 7, 27, 79669 }, // ₈
+    { 9, 13, 11, 1, 7, 30, 79696 }, // ₉
+    { 13, 40, 14, 1, 30, 130, 79726 }, // ₍
+    { 13, 40, 13, -2, 30, 130, 79872 }, // ₎
+    { 21, 39, 29, 4, 33, 205, 80002 }, // ₡
+    { 22, 27, 29, 3, 27, 149, 80207 }, // ₢
+    { 20, 27, 20, 0, 26, 135, 80356 }, // ₤
+    { 32, 25, 30, -1, 25, 200, 80491 }, // ₦
+    { 25, 25, 27, 1, 25, 157, 80691 }, // ₧
+    { 32, 27, 38, 3, 25, 216, 80848 }, // ₨
+    { 25, 26, 25, 0, 26, 163, 81064 }, // ₩
+    { 23, 23, 31, 4, 23, 133, 81227 }, // ₪
+    { 22, 25, 15, -2, 24, 138, 81360 }, // ₫
+    { 20, 28, 22, 1, 24, 140, 81498 }, // €
+    { 23, 25, 31, 4, 25, 144, 81638 }, // ₮
+    { 29, 25, 19, -1, 25, 182, 81920 }, // ₱
+    { 26, 39, 34, 4, 33, 254, 82102 }, // ₲
+    { 30, 24, 31, 5, 22, 180, 82356 }, // ₴
+    { 15, 24, 17, 4, 21, 90, 82536 }, // ₵
+    { 24, 26, 31, 3, 26, 156, 82626 }, // ₸
+    { 16, 24, 20, 2, 23, 96, 82782 }, // ₹
+    { 18, 22, 20, 1, 20, 99, 82878 }, // ₺
+    { 21, 24, 24, 1, 23, 126, 82977 }, // ₼
+    { 26, 25, 27, -3, 25, 163, 83103 }, // ₽
+    { 20, 20, 21, 0, 18, 100, 83266 }, // ←
+    { 21, 20, 22, 1, 19, 105, 83366 }, // ↑
+    { 20, 20, 22, 1, 18, 100, 83471 }, // →
+    { 21, 20, 22, 1, 19, 105, 83571 }, // ↓
+    { 24, 17, 30, 3, 16, 102, 83676 }, // ↔
+    { 17, 24, 23, 3, 26, 102, 83778 }, // ↕
+    { 17, 16, 23, 3, 15, 68, 83880 }, // ↖
+    { 17, 16, 19, 1, 15, 68, 83968 }, // ↗
+    { 17, 16, 19, 1, 16, 68, 84036 }, // ↘
+    { 17, 16, 19, 1, 16, 68, 84104 }, // ↙
+    { 23, 20, 29, 3, 19, 115, 84172 }, // ⇐
+    { 25, 24, 31, 3, 23, 150, 84287 }, // ⇑
+    { 23, 20, 29, 3, 19, 115, 84437 }, // ⇒
+    { 25, 24, 31, 3, 22, 150, 84552 }, // ⇓
+    { 26, 20, 32, 3, 19, 130, 84702 }, // ⇔
+    { 20, 25, 26, 3, 14, 125, 84832 }, // ⇕
+    { 18, 26, 20, 1, 24, 117, 84957 }, // ∂
+    { 30, 30, 33, 1, 27, 225, 85074 }, // ∅
+    { 23, 23, 25, 1, 22, 133, 85299 }, // ∆
+    { 19, 23, 22, 1, 21, 110, 85432 }, // ∏
+    { 19, 23, 22, 1, 22, 110, 85542 }, // ∐
+    { 15, 22, 17, 1, 21, 83, 85652 }, // ∑
+    { 16, 5, 18, 1, 11, 20, 85735 }, // −
+    { 24, 26, 28, 2, 24, 156, 85755 }, // √
+    { 25, 17, 27, 1, 19, 107, 86016 }, // ∞
+    { 23, 31, 25, 1, 23, 179, 86123 }, // ∫
+    { 8, 20, 9, 1, 20, 40, 86302 }, // ∶
+    { 18, 17, 42, 12, 17, 77, 86342 }, // ≈
+    { 22, 26, 36, 7, 23, 143, 86419 }, // ≠
+    { 25, 25, 23, -1, 21, 157, 86562 }, // ≤
+    { 24, 26, 25, 1, 22, 156, 86719 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
@@ -6046,4 +3411,9 @@ static const EpdFontData opendyslexic_14_bold = {
     38,
     -16,
     true,
+    opendyslexic_14_boldBlockOffsets,
+    opendyslexic_14_boldDirectGlyphs,
+    opendyslexic_14_boldGlyphPages,
+    35,
+    opendyslexic_14_boldPageGlyphs,
 };
@@ -2,6298 +2,2990 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_bolditalic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_bolditalic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_14_bolditalic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_bolditalicBitmaps[100556] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0xD0, 0x2F, 0xFF,
-    0x03, 0xFF, 0xD0, 0x1F, 0xFE, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x0F, 0xFF, 0x00,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0xBF,
-    0xF8, 0x03, 0xFF, 0xD0, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x3F, 0xE4, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x93, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0x80,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xAB, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x03, 0xFC, 0x00, 0x02, 0xF0,
-    0x0B, 0xC0, 0x2F, 0xD0, 0x00, 0x0F, 0x80, 0x3E, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x2F,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xCB, 0xC0,
-    0x3D, 0x00, 0x00, 0x0B, 0xFC, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0x7F, 0xC1, 0xF0, 0x07, 0xC0, 0x00,
-    0x07, 0xFD, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0x9B, 0xF4, 0x00, 0x03, 0xFE, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0x42, 0xFF, 0x83, 0xFC, 0x03, 0xFC, 0x0F, 0xFC, 0x03, 0xFC, 0x2F,
-    0xE0, 0xBF, 0xD0, 0x07, 0xFE, 0xFF, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0x1F,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x0D, 0x00, 0x00, 0xBF, 0xFA, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x1F, 0xFF, 0x43, 0xFF, 0xC0, 0xFF, 0xF0, 0x2F, 0xFC,
-    0x07, 0xFF, 0x40, 0xFF, 0xF0, 0x3F, 0xFC, 0x0B, 0xFF, 0x41, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0x6B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x1F, 0xC0, 0x24, 0x0F, 0x0B, 0xF0, 0xBD, 0x0F, 0xF7, 0xF9, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0x7F, 0x2F, 0xC0, 0x3D, 0x2F, 0xC0, 0xC0, 0x04, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x40, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x1A, 0xAB, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
-    0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x55, 0x03, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x1F, 0xFD, 0x2F, 0xFC, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x2F, 0xE0,
-    0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x10, 0x2F, 0xC0,
-    0x03, 0xFC, 0x3F, 0x0F, 0xF0, 0x02, 0xFF, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x8F, 0xF0, 0xFF, 0x00,
-    0x7F, 0xC7, 0xFC, 0xBF, 0xC0, 0x2F, 0xF2, 0xFF, 0x3F, 0xE0, 0x0F, 0xF8, 0xBF, 0x5F, 0xF4, 0x03,
-    0xFE, 0x0F, 0x8F, 0xFC, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x2F,
-    0xFD, 0x07, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x0E, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xE4, 0x07, 0xFE, 0x00,
-    0x0B, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6B, 0xFE, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xEA, 0xAF, 0xF8, 0x00, 0x09,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0x90, 0x01,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x1F, 0xD2,
-    0xFE, 0x00, 0x01, 0xFE, 0x0F, 0xF4, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x01, 0xFE, 0x02, 0xFF, 0x00,
-    0x1F, 0xF5, 0x6F, 0xFE, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x5A, 0xAA, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x50, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x01, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0x90, 0x0B, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x9B, 0xF9, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0B,
-    0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0xAB, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xF4, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x1F,
-    0xF0, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE5,
-    0xBF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xF9, 0x5B, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x2F, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0xE9, 0x57, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFC, 0x00,
-    0xBF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0B, 0xFF, 0x00,
-    0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x90, 0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x15, 0x6A, 0xAF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2B, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFE, 0xAA, 0x95, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFC,
-    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x90, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0x90, 0x2F, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFF,
-    0x40, 0x00, 0x90, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xF0, 0x6F, 0xBC,
-    0x00, 0x3C, 0x00, 0x01, 0xFD, 0x1F, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x3F, 0x83, 0xD1, 0xF4, 0x00,
-    0x7C, 0x00, 0x07, 0xF0, 0xF4, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xFF, 0x0E, 0x00, 0xF0, 0x00, 0xF8,
-    0x00, 0x1F, 0xD2, 0xC0, 0x0F, 0x00, 0x2F, 0x40, 0x02, 0xFD, 0x2C, 0x03, 0xF0, 0x07, 0xF0, 0x00,
-    0x3F, 0xD3, 0xFF, 0xFE, 0x01, 0xFD, 0x00, 0x03, 0xFD, 0x2F, 0xFF, 0xE1, 0xFF, 0x80, 0x00, 0x3F,
-    0xE0, 0xBF, 0xAF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x05, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00,
-    0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFF, 0x55, 0x6F,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x1F,
-    0xFE, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x41, 0x6F, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0xFF,
-    0xD5, 0x56, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xEA, 0xAF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x01, 0x80, 0x00, 0x7F, 0xFF, 0xFA, 0x6B, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x3F, 0xF8, 0x01, 0x6F, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55,
-    0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xAA, 0xAB, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0x55, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAF, 0xA9, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0x90, 0x00, 0x59, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xA5, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xF9, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0x00, 0x02, 0xBF, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFE, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xFE, 0x40, 0x16, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0x95,
-    0x55, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xEA, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07,
-    0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F,
-    0xFE, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x02, 0xE4, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x07, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF2, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF6, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xAA,
-    0xAB, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xF7, 0xFF, 0x4F, 0xFE, 0xFF, 0x80, 0x00, 0xFF, 0xDF, 0xFE, 0xBF, 0xEF, 0xFD, 0x00, 0x07,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0xFF, 0xFF, 0xF6, 0xFF, 0xC0, 0x00, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xCF, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0xFD, 0x3F, 0xF8, 0x00, 0x2F, 0xFC,
-    0x3F, 0xFF, 0xF2, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x82,
-    0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x1F, 0xFD, 0x0B, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x01, 0xFF,
-    0x42, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xF0, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFD, 0x01,
-    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xF3, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0xFF,
-    0xF2, 0xFF, 0x4F, 0xFC, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x00, 0x03, 0xFF, 0xD0, 0xFF,
-    0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x06, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x6F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xD5, 0x6F, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xF9,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x07, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x34, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0xBF, 0x9B, 0xFF, 0x00, 0x0F, 0xFF, 0x95, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0x55, 0x5F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00,
-    0xBF, 0x40, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x55, 0x54, 0x01, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x68, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xE4, 0x01,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0x83, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF4,
-    0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0x00,
-    0x1F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x00,
-    0x2F, 0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x83, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF3, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA1, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC1, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xD0,
-    0x00, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xE0, 0x02, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0x3F, 0xFD, 0x0F, 0xFF, 0xFC, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0xC3, 0xFF, 0xFF, 0xD2, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0xBF, 0xFF, 0xFE, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFD,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x82, 0xFF,
-    0x80, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xF4,
-    0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFA, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x6A, 0xAA, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD5, 0x55, 0x50,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0xA0, 0x03, 0xC0, 0x1F, 0x00,
-    0xFC, 0x07, 0xF0, 0x2F, 0xC0, 0xBF, 0x41, 0xFD, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFF, 0x07,
-    0xFC, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x3F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F,
-    0xFC, 0x3F, 0xF0, 0xFF, 0xC3, 0xFE, 0x0F, 0xF0, 0x3F, 0x40, 0xF8, 0x02, 0xC0, 0x09, 0x00, 0x10,
-    0x00, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x07, 0xFE,
-    0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xE0, 0x3F, 0xC0, 0x07, 0xFC, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFA, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x0F,
-    0xE0, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00,
-    0x7F, 0x40, 0xFD, 0x00, 0x02, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0xC0,
-    0x7F, 0x95, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC6, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFE, 0x47, 0xF8, 0x0F, 0xFF, 0x40, 0x1F,
-    0xC0, 0xFF, 0xD0, 0x01, 0xFC, 0x0F, 0xFC, 0x00, 0x1F, 0xC1, 0xFF, 0x40, 0x02, 0xFC, 0x2F, 0xF0,
-    0x00, 0x7F, 0x83, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFE, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2D, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F,
-    0xE0, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x91, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0xD0, 0x00,
-    0xBF, 0x40, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xD0,
-    0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFA, 0xBF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00, 0xFF,
-    0x9A, 0xBF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xAA, 0x55, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xC6, 0xA0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x7F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xFC, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0x40, 0x0F,
-    0xFF, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xBE, 0x00,
-    0x03, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0x80, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x06, 0xE9, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0x40, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x5B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF6,
-    0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xAF,
-    0xFC, 0x00, 0xBF, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x01, 0xFF, 0x80, 0x02, 0xFC,
-    0x02, 0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x0B, 0xF4, 0x0B,
-    0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0xBF, 0xD0, 0x7F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x01,
-    0xFF, 0xC0, 0x06, 0xB0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x06, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x05, 0x54, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x07, 0xF8, 0xFF,
-    0xC0, 0x00, 0xBF, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFB, 0xFF, 0xE0, 0x02, 0xFF, 0x3F, 0xFF, 0x80, 0x3F, 0xF0,
-    0xFF, 0xFD, 0x07, 0xFE, 0x0B, 0xFF, 0xF4, 0xBF, 0xD0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFA, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFE, 0x40, 0x2F, 0xD0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xAF, 0xFF, 0xFE, 0xBF, 0xC0, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x40, 0xBF, 0x40,
-    0x07, 0xFF, 0x00, 0x2F, 0xF8, 0x02, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xFD, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x0B, 0xFD,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0x80,
-    0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xF4, 0x07, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xF8,
-    0x00, 0xFF, 0x00, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x03,
-    0xFD, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x02,
-    0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x7F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x06, 0xE9, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x1F, 0xF0, 0x00, 0x2F, 0xFF, 0xDB, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF6, 0xFF, 0xFE, 0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0x40, 0x1F,
-    0xD0, 0x02, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0xF0, 0x01, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0xBE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0x00, 0x0F, 0xE0,
-    0x02, 0xFF, 0xC0, 0x03, 0xFF, 0xAF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x40, 0x02, 0xFE,
-    0x6F, 0xDB, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xBF, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x45, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x1A, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xAB, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x40, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x02, 0xD0, 0x03, 0xFF, 0x80, 0x3F, 0xFA, 0xBF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x1B, 0xFF, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xF8, 0xAA, 0xFF, 0xAA, 0x90, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF9, 0xA0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x07,
-    0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00, 0x1F, 0xF0,
-    0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x0F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xE0, 0x02, 0xFF, 0x80, 0x2F, 0xF0,
-    0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0xFF,
-    0x80, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x7F, 0xD0, 0x07, 0xFE, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x0F, 0xFD, 0x1F, 0xF4, 0x00,
-    0x02, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x40,
-    0x15, 0x00, 0x7F, 0xD0, 0x7F, 0xD0, 0x2F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF0,
-    0x07, 0xFD, 0x1F, 0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0x5F, 0xFF, 0xCF, 0xFC, 0x00, 0x7F, 0xEF, 0xFF,
-    0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xDF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xE2, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x7F,
-    0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x0A, 0xA0, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xD7, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFE, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x00,
-    0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0A, 0xAA, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xD5, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xA0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFA,
-    0x50, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x05, 0xAF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3D, 0x1F, 0xF8,
-    0x3E, 0x3F, 0xFD, 0xBD, 0x7E, 0x7F, 0xFC, 0xBD, 0x2F, 0xF4, 0xBC, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xBC, 0x02,
-    0xFF, 0xBE, 0x00, 0x07, 0xFD, 0x3D, 0x00, 0x0B, 0xF8, 0x7C, 0x00, 0x0F, 0xF4, 0xBC, 0x00, 0x1F,
-    0xF0, 0xF8, 0x00, 0x3F, 0xE0, 0xF4, 0x00, 0x3F, 0xE0, 0xF4, 0x00, 0x3F, 0xF1, 0xF0, 0x00, 0x3F,
-    0xF6, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xF9, 0x07, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xB0,
-    0x00, 0x2F, 0xFF, 0xE3, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFE, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x3F, 0xC0, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0xFF,
-    0x40, 0xBF, 0xC0, 0x00, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF7, 0xFE, 0xFF,
-    0x40, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xFF,
-    0xE0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2A, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x01,
-    0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0xBD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x91, 0xBE, 0x00, 0x00, 0x0F, 0xD0,
-    0x03, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD,
-    0x6F, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x90, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x0F, 0xFD, 0x0F,
-    0xFC, 0x1F, 0xFC, 0x1F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x7F, 0xFC, 0x15, 0x54, 0x15,
-    0x54, 0x00, 0x06, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xFA, 0xFD, 0x01, 0xFD, 0x00, 0xF8,
-    0x0F, 0xEF, 0xC2, 0xF0, 0x7F, 0xD0, 0x07, 0xC2, 0xFE, 0x00, 0x2F, 0x0F, 0xBD, 0x41, 0xF4, 0x2F,
-    0x7F, 0x1F, 0xC0, 0x7E, 0x02, 0xFD, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEE, 0x03, 0xFF, 0xD0, 0xF4, 0x3D, 0x1D, 0x03, 0xC3, 0xC0,
-    0x3C, 0x34, 0x07, 0xC3, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0xFE, 0xA4, 0x00, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x00, 0x28, 0x00, 0x1C, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00,
-    0x7F, 0xD0, 0x2F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xC0,
-    0x2F, 0xE0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0xF0, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x1F,
-    0xFD, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0xFC,
-    0x00, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x2F, 0xA9, 0x50, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x56, 0xAF, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFA, 0xFD, 0x01, 0xFF, 0xF0, 0xF8, 0x0F, 0xF4, 0x92, 0xF0, 0x7E, 0xC3, 0x47, 0xC2, 0xF7, 0xF8,
-    0x2F, 0x0F, 0xBD, 0xD0, 0xF8, 0x3F, 0xE3, 0x8F, 0xC0, 0xBF, 0x4F, 0xFE, 0x00, 0xFF, 0xBF, 0xE0,
-    0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xBF, 0xD1, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0B, 0xF0, 0x0F, 0xF4, 0x07,
-    0xF4, 0x1F, 0xF0, 0x0B, 0xF0, 0x1F, 0xE0, 0x1F, 0xF0, 0x2F, 0xFA, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x58, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6E, 0x00, 0x3F, 0xFC, 0x03, 0x43, 0xD0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x02, 0xF4,
-    0x01, 0xFD, 0x00, 0xFF, 0x40, 0x2F, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x2F, 0xFC, 0x01, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0xB8, 0x2F, 0xFF, 0x43, 0xFF, 0xE0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x0B, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xE1, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE, 0x1F, 0xD0, 0x00, 0x0F, 0xFF,
-    0xD2, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0x83, 0xF8, 0x00, 0x1F, 0xFF,
-    0xF4, 0x7F, 0x40, 0x03, 0xFF, 0xFF, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0x00, 0x03, 0xFF,
-    0xFD, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xC1, 0xFD, 0x00, 0x00, 0xFF, 0xF8, 0x2F, 0xC0, 0x00, 0x07,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x80, 0x00, 0x0B, 0xFE, 0x07, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0xBF, 0x00, 0x00, 0x2F, 0xFC, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0xFE, 0x00, 0x00,
-    0xBF, 0xF0, 0x1F, 0xD0, 0x00, 0x0F, 0xFF, 0x02, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x3F, 0xC0, 0x00,
-    0x3F, 0xFC, 0x03, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0xFF, 0xF8, 0x0B, 0xF0, 0x00,
-    0x1F, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x0F, 0xE0, 0x00, 0x7F, 0xFD, 0x01, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x03, 0xFE, 0x0B, 0xFD, 0x0F, 0xFD, 0x2F, 0xFC, 0x3F, 0xFC, 0x15, 0x54, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0xF0, 0x0F, 0xFE, 0x05, 0x0F, 0xC2, 0xFF, 0xE0, 0xFF,
-    0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x05, 0xF0, 0x00, 0x3C, 0x00,
-    0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x0B, 0xFF, 0xC3, 0xFF, 0xE0, 0x55, 0x50, 0x00,
-    0xBF, 0x40, 0x0F, 0xFF, 0x40, 0xF8, 0x2E, 0x07, 0xC0, 0x78, 0x2D, 0x02, 0xE0, 0xF8, 0x2F, 0x03,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x34, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x00, 0x1F,
-    0xF4, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x3F, 0xE0, 0x00, 0x0F,
-    0xF0, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0xBF, 0xF0,
-    0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0xBE, 0x00, 0x3F,
-    0x00, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x43, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xD0, 0x1F, 0x40,
-    0xBF, 0xFF, 0xE0, 0x02, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xF0, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x42, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x82, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0x5A, 0xBF, 0xA0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x43,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x5A, 0x40,
-    0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xE2, 0xFF, 0xFD, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xF0, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0x40, 0x1F, 0xF0, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xAB, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x0B,
-    0x40, 0x7F, 0xFF, 0xF4, 0x00, 0xBF, 0x40, 0xFD, 0x03, 0xFF, 0xFF, 0x80, 0x0B, 0xF8, 0x0F, 0xF0,
-    0x06, 0xFF, 0xE4, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x0F, 0x8B, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xD6, 0xFE, 0x40, 0x00,
-    0x00, 0x2F, 0xE0, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x56, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x60, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0x40, 0x00,
-    0xFF, 0x40, 0x7F, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x0B,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF,
-    0x80, 0x00, 0x2F, 0xFD, 0x55, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFB,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE,
-    0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00,
-    0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x0B, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x3E, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC,
-    0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xF8, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x0F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x8B, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAA, 0xAA, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
-    0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD1,
-    0xFF, 0xD5, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xE9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xEA, 0xAF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x40,
-    0x00, 0x7F, 0xFF, 0xD4, 0x05, 0xB8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE,
-    0x95, 0x50, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55,
-    0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x55,
-    0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55,
-    0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x6A, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x54, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x0B, 0xFC,
-    0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x2F, 0xFC, 0x00, 0x3F, 0xFC, 0x3F,
-    0xFC, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x55, 0xBF, 0xF9, 0x54, 0x00,
-    0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x01, 0x6F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xC2, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF7,
-    0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x4F, 0xFC, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x00,
-    0x03, 0xFF, 0xD0, 0xFF, 0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0xBF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x06, 0xFF, 0xE0, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFE, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xE5, 0x16,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFE,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x01, 0xBF, 0xF8,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x55, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x6F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF9, 0x45, 0xBF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x00, 0xBF, 0xE7, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0x8B, 0xFF, 0x80, 0x6A, 0xA4, 0x0A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x02, 0xFF, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x7F,
-    0xFD, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0x4B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF3, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xE5, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x8B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xF0,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF,
-    0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x0B, 0xFE, 0x00, 0x00,
-    0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x01, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x40, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFE,
-    0x00, 0x7F, 0xC0, 0x1F, 0xC0, 0x0F, 0xF8, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x3F, 0xC6, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF9,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFE,
-    0x47, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x6F, 0xC0, 0x00, 0xFF, 0x01,
-    0xFF, 0xF0, 0x00, 0x7F, 0x81, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0xFF, 0xE4, 0x00, 0x0F, 0xF0, 0xBF,
-    0x40, 0x00, 0x07, 0xFC, 0x3F, 0x80, 0x00, 0x02, 0xFE, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFD,
-    0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x0F, 0xFE, 0x00, 0x0F, 0xF8, 0x01, 0xFF,
-    0xD0, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0xFF, 0xE4, 0x01, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFA, 0xFF, 0xF4, 0x02,
-    0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x00,
-    0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0xFD, 0x00, 0x02, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xC0, 0x00, 0xBF, 0xC0, 0x7F, 0x95, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFA, 0xFF, 0xF4, 0x00, 0xBF, 0x80, 0x2F,
-    0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0x1F, 0xE0,
-    0x07, 0xF0, 0x00, 0x1F, 0xD0, 0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x0F,
-    0xC0, 0x00, 0xBF, 0xC0, 0x1F, 0xE5, 0x5B, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFA, 0xFF, 0xF4, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0xFE, 0x00,
-    0x1F, 0xF0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x07, 0xF0, 0x00, 0x1F,
-    0xD0, 0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x0F, 0xC0, 0x00, 0xBF, 0xC0,
-    0x1F, 0xE5, 0x5B, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0x80, 0x00, 0x00, 0xFF, 0xC3, 0xF0, 0x00, 0x00,
-    0xBF, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0x87, 0xFE, 0x00, 0x00, 0x03,
-    0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0xBF, 0xFD, 0x00, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x03, 0xF8, 0x00,
-    0x7F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x01,
-    0xFD, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x2F,
-    0xF0, 0x01, 0xFE, 0x55, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xE0,
-    0xBF, 0xE0, 0x00, 0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xD1, 0xFF, 0xD0, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x01, 0x55, 0x41, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFA, 0xFF, 0xF4, 0x00, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xC0, 0x01, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xC0, 0x01,
-    0xFE, 0x55, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xEF, 0x00,
-    0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xAF, 0xFF, 0x40, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0xFE, 0x00,
-    0x1F, 0xF0, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x3F, 0x40, 0x01, 0xFE, 0x01, 0xFC, 0x00, 0x07, 0xF4,
-    0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x0B, 0xFC, 0x07, 0xF9,
-    0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xAF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFA, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xE0, 0x02, 0xFE, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x01, 0xFF, 0xF5, 0xAF,
-    0xFF, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x02, 0xFF, 0xFA, 0x95, 0x40,
-    0x03, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x95, 0x6F, 0xFF, 0xF4, 0x00, 0x2E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x40, 0x01, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFE, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2D, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x97, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xF8, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00, 0xFF, 0x9A, 0xBF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xAA, 0x55,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xBD, 0x00, 0x0F, 0xF9, 0xAB,
-    0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFA, 0xA5, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x01, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xBD, 0x00,
-    0x0F, 0xF9, 0xAB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFA, 0xA5, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x01, 0x54, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x3F,
-    0xF4, 0x00, 0x02, 0xFF, 0xD2, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x2F,
-    0x40, 0x00, 0x3F, 0xE6, 0xAF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xEA, 0x95, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x6C, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00,
-    0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00,
-    0x06, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1A, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x03, 0xFE, 0x0B, 0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x54, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x6B, 0xE0, 0x00, 0x00, 0x00,
-    0xA9, 0x02, 0xA4, 0x0B, 0xF8, 0x2F, 0xE0, 0x3F, 0xE0, 0xFF, 0x81, 0xFF, 0x47, 0xFD, 0x0F, 0xFD,
-    0x3F, 0xF0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBA, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x06, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x55, 0xBF,
-    0x95, 0x50, 0x00, 0x02, 0xBE, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x4F, 0xF0, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x3D,
-    0x00, 0x00, 0x01, 0xFF, 0xC3, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x7D, 0x00, 0x00, 0x07, 0xE3, 0xFF,
-    0xC0, 0x00, 0x00, 0xBD, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x6F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0xFF, 0xC0,
-    0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x02, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xFD, 0x00, 0x00,
-    0x3F, 0xD0, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x1F,
-    0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x00, 0x3F, 0xF0, 0xBC, 0x00, 0x00, 0x7F, 0xF8,
-    0xFC, 0x00, 0x00, 0xFC, 0xBF, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0xF8, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00,
-    0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x2F,
-    0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x2F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x47, 0xFF, 0x40, 0x03, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x55,
-    0x50, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0xBF, 0xF8, 0x00, 0x1F, 0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x1A, 0xBF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFA, 0xAA, 0xAA, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xDF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x5F, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0xBF, 0xCB, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x3F, 0xC3, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x03, 0xFC, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F,
-    0xF4, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F,
-    0xE0, 0x02, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x03, 0xFC, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F,
-    0xF4, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F,
-    0xE0, 0x02, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xF7, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x02, 0xFC,
-    0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00,
-    0x1F, 0xF0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xE0, 0x02, 0xFF, 0x80,
-    0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x15, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF8, 0x1F, 0xF8, 0x00, 0x0B, 0xFE, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x02, 0xFF,
-    0xD2, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x7F, 0xC0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x0F,
-    0xF8, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFF,
-    0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x42,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xEF, 0xFF, 0x00, 0x01, 0xFE,
-    0x0B, 0xFD, 0x00, 0x0B, 0xF4, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x07, 0xF8, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x03,
-    0xFC, 0x07, 0xFD, 0x00, 0x1F, 0xE0, 0xBF, 0xE0, 0x00, 0xBF, 0x5F, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x05, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xEA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF4,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xBF, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xAF, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x0B, 0xFC,
-    0x00, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x40, 0x01,
-    0xFE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF9, 0x56, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0xBF, 0x40, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xAF, 0xFF, 0x40,
-    0x00, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF9,
-    0x56, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x3F,
-    0xE0, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00,
-    0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFF, 0x55, 0x6F,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x1F,
-    0xFE, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFA, 0xFF, 0xF4, 0x02,
-    0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x00,
-    0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0xFD, 0x00, 0x02, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xC0, 0x00, 0xBF, 0xC0, 0x7F, 0x95, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x4F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0xAA, 0xF0,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x18, 0x00, 0x07, 0xFF,
-    0xFF, 0xA6, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFB, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x2D, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0xAF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x01, 0x80, 0x00, 0x07,
-    0xFF, 0xFF, 0xA6, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xD0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0xAA, 0xF0, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x18, 0x00, 0x07, 0xFF, 0xFF, 0xA6, 0xBF,
-    0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFE, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x42,
-    0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0xFA, 0xAB, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x60, 0x00, 0x00, 0x7F, 0xFF,
-    0xFA, 0x6B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0x80, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFE, 0x00,
-    0x5B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE2,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F,
-    0xE0, 0xFF, 0x2F, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x3F, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x91, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFA, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x55, 0xBF, 0xF9, 0x54, 0x00,
-    0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x01, 0x6F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x15, 0x5F, 0xF9, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x91, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0x40, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFA, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xAA, 0xA9,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xFA, 0x55, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF5, 0x55, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6A, 0xBF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x7F,
-    0xD0, 0x02, 0xF4, 0x00, 0x00, 0xFF, 0x9A, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xAA, 0x55,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x06, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAF, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE9, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE5, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x14, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0xFF,
-    0x9A, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xAA, 0x55, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE,
-    0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0x6A, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFE, 0xA9,
-    0x54, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x6C, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFE, 0x95, 0x50, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x07, 0xF0,
-    0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00, 0xFF, 0x9A, 0xBF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xAA, 0x55, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x55, 0x59, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x95, 0x55, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x90, 0x00, 0x6A, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xE2, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xF4,
-    0x00, 0x00, 0x3F, 0xE6, 0xAF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xEA, 0x95, 0x40, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x06, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAF, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x59, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xA5, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x16, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xDF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0x40, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xBA, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x34, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x5B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xA9, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0x90, 0x00, 0x59, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x01, 0xA5, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
-    0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0x00, 0x02, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x16, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDF,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBA, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xBE, 0xA5, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0x90, 0x00, 0x59, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x06, 0x94, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xF9, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x0A, 0xFF, 0xFF, 0x80, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x03, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xE4, 0x01,
-    0x6F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x81,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xDF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFB,
-    0xFF, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0xBE,
-    0x00, 0x0B, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xC0, 0x00,
-    0xBD, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBA,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xD0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x16, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFA,
-    0x94, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE,
-    0x40, 0x01, 0x64, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1A,
-    0x50, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xE4, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x2B, 0xFF, 0xFE, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFF, 0x90, 0x05, 0xBF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xDF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x02,
-    0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBD,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0xBA, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0x40, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x16, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0x95,
-    0x55, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x03, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x6F,
-    0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xEB,
-    0xFF, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x80, 0x02,
-    0xFC, 0x00, 0xBF, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x2F,
-    0xD0, 0x0B, 0xFD, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0xBF, 0xD0, 0x1F, 0xFD, 0x00, 0x3F, 0xF0,
-    0x0B, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x1A, 0xC0, 0x05, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x55, 0x5F, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x3F, 0xFE,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xAF, 0xFC, 0x00, 0xBF, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC,
-    0x01, 0xFF, 0x80, 0x02, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x07,
-    0xFE, 0x00, 0x0B, 0xF4, 0x0B, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0xBF, 0xD0, 0x7F, 0xF4, 0x00,
-    0xFF, 0xC0, 0xBF, 0xF4, 0x01, 0xFF, 0xC0, 0x06, 0xB0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x3F, 0x00, 0x00, 0xBF, 0xF9, 0xF8, 0x00,
-    0x03, 0xF3, 0xFF, 0xC0, 0x00, 0x1F, 0x87, 0xFE, 0x00, 0x00, 0x3E, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA8, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x03, 0xE0, 0x03, 0xFF, 0x0F, 0xC0, 0x2F, 0xFE, 0x7D, 0x00, 0xFC, 0xFF, 0xF0, 0x0B, 0xE1, 0xFF,
-    0x80, 0x0F, 0x42, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x6B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x06, 0xBF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xAA, 0xA5,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x2F, 0xEA, 0xAA, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xA8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFC, 0x50, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xEA, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x06, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x2E, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x0F,
-    0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x06, 0xBE, 0x00, 0x00, 0x02,
-    0xFA, 0x40, 0x00, 0x01, 0xAA, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xAF, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x6B,
-    0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x41,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x3F, 0xF0,
-    0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0x00, 0x00,
-    0x03, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xDB, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x2F, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x55, 0x40, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0xFF,
-    0xC0, 0x00, 0x02, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xEF, 0xFF, 0x80,
-    0x00, 0x2F, 0xF3, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0x40, 0x07, 0xFE, 0x0B, 0xFF, 0xF4,
-    0x02, 0xFF, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x55, 0x00, 0x02, 0xF4, 0x7F, 0x80, 0x00, 0xFC, 0x3F,
-    0x80, 0x00, 0x7E, 0x3F, 0xC0, 0x00, 0x2F, 0x6F, 0xC0, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0B, 0xEF, 0xFC, 0x00, 0x03, 0xF5, 0xFF, 0xC0, 0x01,
-    0xFC, 0x3F, 0xFC, 0x00, 0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xAA,
-    0xAF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0xAB, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x1F, 0xD0, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x2F, 0xF4, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0xFF, 0xD0, 0x0F, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFA,
-    0xAA, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0xFA, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x2F,
-    0xD0, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x01, 0x54, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x2F, 0xF4, 0x07, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x2F, 0xD1, 0xFF, 0xC0, 0x03,
-    0xFC, 0x2F, 0xFC, 0x00, 0x7F, 0xC3, 0xFF, 0x80, 0x0B, 0xF8, 0xBF, 0xF4, 0x00, 0xFF, 0x05, 0x55,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFA, 0xAA, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x05, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xA4, 0x00, 0x06, 0xBF, 0xFF,
-    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x50, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF3,
-    0xFF, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x4F,
-    0xFC, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x00, 0x03, 0xFF, 0xD0, 0xFF, 0xEF, 0xF4, 0x00,
-    0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0x80, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x07,
-    0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x2F,
-    0xD0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x0B, 0xFE, 0x00, 0x3F, 0xF4,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x3F,
-    0xF7, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF2, 0xFF,
-    0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x4F, 0xFC, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8,
-    0x00, 0x03, 0xFF, 0xD0, 0xFF, 0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x40,
-    0xBF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xF4,
-    0x07, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B,
-    0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x3F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x02, 0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF7, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xF2,
-    0xFF, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE1, 0xFF,
-    0x9F, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xFC, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-    0xFD, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x03,
-    0xFF, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF2, 0xFF, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xF2, 0xFF, 0x4F, 0xFC, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0x9F, 0xF8, 0x00, 0x03, 0xFF,
-    0xD1, 0xFF, 0xEF, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F,
-    0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xF4, 0x07, 0xF8, 0x00, 0xFF, 0xC0, 0x03,
-    0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xF4,
-    0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x1F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xF0,
-    0x02, 0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x06, 0xBE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x6F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF9,
-    0x45, 0xBF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0A, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xAF, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x2F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x01,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x6F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x07, 0xFF, 0xF9, 0x45, 0xBF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x40, 0x00, 0x07, 0xF4, 0x02, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xAF, 0xFE, 0x00,
-    0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x06,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE5, 0x16, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x02,
-    0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0x54, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFA, 0x6A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
-    0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFE, 0xBF, 0xFB, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x2F, 0xFF, 0xE0, 0x1F, 0xD0,
-    0x0F, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0xBF, 0xC0, 0x00, 0xFF, 0xE6, 0xAF, 0xFE, 0x03,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0x95, 0x40, 0x0F, 0xF8,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0x6C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFD, 0x55, 0x7F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x7F,
-    0x80, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00,
-    0xBF, 0xD0, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0F, 0xFF,
-    0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x0F,
-    0xFF, 0x40, 0x3F, 0xFF, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xFC, 0x01, 0x55, 0x50, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x45, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1A, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xD5, 0x57, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x0B, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x43,
-    0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x3F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x2F, 0xFE, 0x00, 0x3F,
-    0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0,
-    0x15, 0x55, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0x91, 0x40, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x06, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD5, 0x57,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x43, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xF8, 0x00,
-    0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xC0, 0x00, 0x55, 0x54, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xBD,
-    0x00, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x5B, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE4, 0x50, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x1A, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3D, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xF9, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xEA, 0xFD, 0x00, 0x03, 0xF8,
-    0x00, 0x10, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xB4, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0xAF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x06, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x43, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x68, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x40, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0x40, 0x0F, 0xFE,
-    0x00, 0x00, 0xFF, 0xEA, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x68, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0xFF, 0xE4, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x6F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x40, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xAB, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x02, 0xD0, 0x03, 0xFF, 0x80, 0x3F, 0xFA, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xA4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x97, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x90, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00,
-    0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xD0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xAB, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x09, 0x6F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xAA, 0xFF, 0xAA,
-    0x90, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F,
-    0xF9, 0xA0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x02, 0x5F, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2C,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x02, 0xAB, 0xFE, 0xAA, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE6, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x5B,
-    0xFF, 0x95, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xAA, 0xFF, 0xAA, 0x90, 0x00, 0xBF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x05, 0x57, 0xFE,
-    0x55, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF9, 0xA0, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xC7, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F,
-    0xF4, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x3C, 0x00, 0x00, 0x1F,
-    0xF8, 0x7D, 0x00, 0x00, 0x3F, 0xFC, 0xBC, 0x00, 0x00, 0x7D, 0x7F, 0xFC, 0x00, 0x00, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0xBC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC,
-    0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF,
-    0xC0, 0x1F, 0xE0, 0x02, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x80,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0A, 0xA5, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x0F,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x02,
-    0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x00,
-    0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x0A, 0x90, 0x00, 0x0B, 0xF9, 0x5B, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x40, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xE7, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC,
-    0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF0, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xE0, 0x00, 0xFF,
-    0xC0, 0x1F, 0xE0, 0x02, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0x00,
-    0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFD,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00,
-    0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0xAF, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x02, 0xFC,
-    0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00,
-    0x1F, 0xF0, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xE0, 0x01, 0xFF, 0x80,
-    0x1F, 0xF0, 0x03, 0xFF, 0x40, 0x2F, 0xF9, 0x6F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF,
-    0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFA, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xF0, 0x02, 0xFF, 0xD0, 0x03,
-    0xFF, 0x40, 0x0F, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFC, 0x00, 0x03,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xE3, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x1F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x40, 0x15, 0x00, 0x7F,
-    0xD0, 0x7F, 0xD0, 0x2F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF4, 0x2F, 0xF4, 0x2F, 0xF0, 0x07, 0xFD, 0x1F,
-    0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0x5F, 0xFF, 0xCF, 0xFC, 0x00, 0x7F, 0xEF, 0xFF, 0xFB, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xE2, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFD,
-    0x00, 0x00, 0x0A, 0xA0, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0xBF,
-    0x80, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x01, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xEB,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x00,
-    0xBF, 0x40, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x42,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x0F, 0xFD, 0x00,
-    0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x0F, 0xFF,
-    0x00, 0x00, 0x15, 0x54, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0,
-    0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFE,
-    0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x16, 0xAA, 0xAF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x55, 0x55, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2A, 0xAA, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x16, 0xAA, 0xAF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x55,
-    0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2A, 0xAA, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x55, 0x54, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x16, 0xAA, 0xAF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD,
-    0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x2A, 0x40, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x3F, 0xE1, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xAA, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF5,
-    0x55, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0x41, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xE0, 0x0B, 0xF0, 0x07,
-    0xF4, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x0B, 0xFC, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x54, 0x00, 0x00, 0x50, 0x02, 0xE0, 0x3D, 0x1F, 0xF8, 0x3E, 0x3F, 0xFD, 0xBD, 0x7E,
-    0x7F, 0xFC, 0xBD, 0x2F, 0xF4, 0xBC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02,
-    0xBF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xAA, 0xA5, 0x00,
-    0x00, 0x05, 0x55, 0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x50, 0xBF, 0x40,
-    0x2F, 0xE2, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x2F, 0xFC, 0x3F, 0xF8, 0xBF,
-    0xF8, 0x55, 0x50, 0x03, 0xF8, 0x1F, 0xE0, 0xBF, 0x82, 0xFE, 0x0F, 0xF4, 0x3F, 0xD2, 0xFF, 0x4B,
-    0xFD, 0x3F, 0xF0, 0xFF, 0xC2, 0xAA, 0x1A, 0xA8, 0x1F, 0x80, 0xBF, 0x80, 0x0E, 0x01, 0xF4, 0x2F,
-    0x80, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0xF8, 0x2F, 0xFC, 0x3F, 0x3D, 0x7D, 0xBD, 0x7F,
-    0xFC, 0x3F, 0xF4, 0x0F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x1F, 0xFD, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x1F, 0xF0, 0x1F,
-    0xF0, 0x0B, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xF8,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFD, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xF0, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0x80,
-    0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x7F, 0xF8, 0xBF, 0xF4, 0xFF, 0xF0, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xBF, 0xF4, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0xFE, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0x54, 0x07, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC6, 0xAA,
-    0xAF, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x1F, 0xC0, 0xBE, 0x07, 0xF5, 0xFF, 0xCB, 0xFC,
-    0x1F, 0xC0, 0x34, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBF, 0x07, 0xF8, 0x2F, 0x00, 0xBF, 0x01, 0xFC,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0xFF, 0xC0, 0x3F, 0xFD, 0x0F,
-    0xFF, 0xD0, 0x6F, 0xF4, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x64, 0x00, 0x7F, 0xE4, 0x7F, 0xFF, 0x2F,
-    0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x00, 0x3C, 0x1F, 0xFE,
-    0x5B, 0x90, 0x2C, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xAA, 0xA5, 0x00, 0x00, 0x55, 0x03, 0xFE,
-    0x07, 0xFE, 0x0F, 0xFD, 0x1F, 0xFD, 0x3F, 0xFC, 0x3F, 0xFC, 0x0B, 0xF4, 0x2F, 0xD0, 0xFF, 0x43,
-    0xFD, 0x1F, 0xF0, 0x7F, 0xC3, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0xFF, 0xC6, 0xAA, 0x1A, 0xA4, 0x00,
-    0x40, 0x0B, 0xF8, 0x2F, 0xFC, 0x3F, 0x3D, 0x7D, 0xBD, 0x7F, 0xFC, 0x3F, 0xF4, 0x0F, 0xD0, 0x00,
-    0x2F, 0xFF, 0x40, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00,
-    0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0xF0, 0x0F, 0xFE, 0x05, 0x0F, 0xC2, 0xFF, 0xE0,
-    0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x1E, 0x40, 0x2F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x03, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x01, 0xFF, 0x03, 0xFE,
-    0x03, 0xFD, 0x07, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x2F, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x6A, 0x90,
-    0x0A, 0xAA, 0xAA, 0x81, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0,
-    0xFF, 0x0B, 0xF4, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x7F, 0xE0,
-    0x0B, 0xFC, 0x00, 0xBF, 0xE2, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE7, 0xFF, 0x40, 0x1F,
-    0xF8, 0x07, 0xFE, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F,
-    0xC0, 0xFF, 0xE0, 0xFC, 0x2F, 0xFF, 0x0F, 0xC3, 0xFB, 0xFB, 0xF8, 0x7F, 0x1F, 0xFF, 0x0B, 0xF0,
-    0xFF, 0xE0, 0x3E, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x2F, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x02, 0xBF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFE, 0xAA, 0xA4,
-    0x02, 0xF8, 0x0F, 0x80, 0xFF, 0xD0, 0xFC, 0x2F, 0xFF, 0x0F, 0xC3, 0xF7, 0xFB, 0xF8, 0xBF, 0x1F,
-    0xFF, 0x0F, 0xE0, 0xFF, 0xE0, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xE0,
-    0x0F, 0xF4, 0x2F, 0xF0, 0x0F, 0xD0, 0x6F, 0x82, 0xFE, 0x07, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x1A, 0x90, 0x3F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0xFE, 0x02,
-    0xFC, 0x0F, 0xD0, 0x3F, 0x81, 0xFC, 0x03, 0xF4, 0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFE, 0x01, 0x55, 0x55, 0x40, 0x01, 0xFE, 0xBC, 0x00, 0xFF, 0xFF, 0xC0, 0xBA, 0xFF, 0xF0,
-    0x3D, 0x3F, 0x7C, 0x1F, 0x1F, 0x2E, 0x0F, 0x8B, 0x8F, 0x43, 0xC3, 0xD3, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0xE0, 0x03, 0xEE, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x02, 0xFF, 0x00, 0x2E, 0x3D,
-    0x01, 0x90, 0x64, 0x00, 0x02, 0xE0, 0x3D, 0x1F, 0xF8, 0x3E, 0x3F, 0xFD, 0xBD, 0x7E, 0x7F, 0xFC,
-    0xBD, 0x2F, 0xF4, 0xBC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0xFC, 0x0B, 0xF8,
-    0x1F, 0xE1, 0xFF, 0x47, 0xF4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x02,
-    0xFE, 0x0B, 0xF8, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0xBF, 0xD2, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0xC0,
-    0x0A, 0xA8, 0x6A, 0xA0, 0x00, 0x0A, 0xAA, 0xAA, 0x80, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xC0, 0xFF, 0x43, 0xFC, 0x0F, 0xF0, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x15,
-    0x6A, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x6F, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFA, 0xAA, 0x95, 0x00,
-    0x01, 0xA4, 0x06, 0xA0, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x40, 0xFE, 0x03, 0xFC, 0x0B, 0xF4, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x7F, 0x81, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x0F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC1,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xF1, 0xF8, 0x00, 0x01, 0xFF, 0xF4, 0xBF, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0x80, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xAF, 0xFF, 0xF0, 0x00, 0x1F, 0xEF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x0B,
-    0xE0, 0x00, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x55, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x50, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x02, 0xA0, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x07, 0xF8, 0x00, 0xFF, 0x4B, 0xF4, 0xFF, 0x40, 0x2F, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0xFF,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x2A, 0x00, 0x02, 0xFF, 0xFC, 0x07, 0xF8, 0x00, 0xBF, 0xFF, 0xF0, 0xFF, 0x40, 0x1F,
-    0xF0, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x0A, 0xE0, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x10, 0x0F, 0x0B, 0xF0, 0x34, 0x0E, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xFA, 0xAF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x01,
-    0x6A, 0xA5, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0x90, 0x00, 0x16, 0xFF, 0xD0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x28, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x57, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x95, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00,
-    0x00, 0x2F, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x0B,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x50, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAB, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFA, 0x55, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF5, 0x55, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFA, 0xAA, 0xA0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x05, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFE,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0x94, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x1F, 0xFD, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0x55, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x50, 0x00, 0x0F, 0xFF, 0x40, 0x06, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x68,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xE4, 0x01, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x03,
-    0xEA, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07,
-    0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F,
-    0xFE, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x00, 0x02, 0xA8, 0x0A, 0xA0, 0x00, 0x7F, 0xC1, 0xFE, 0x00,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x01, 0xFF, 0x87, 0xFD, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x03, 0xFF, 0x4F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x06, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xE4, 0x1B,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00,
-    0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x3F, 0xD5, 0xAF, 0xF4, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0xFF,
-    0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x2F, 0xD0,
-    0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x1B, 0xFF, 0xC0, 0x0B, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x0F, 0xFC, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x1B,
-    0xFF, 0x80, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6A, 0x95, 0xBF, 0xF5, 0x6A, 0xA0, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFE, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x2F, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
-    0x7F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
-    0xC0, 0x01, 0xFF, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xD0,
-    0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x1B, 0xC0, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0xBF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0xBF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xC2, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x0A, 0xAA, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00,
-    0x1F, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x07,
-    0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFC, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0x82, 0xFF, 0x7F, 0xFC, 0x00, 0x1F, 0xF4, 0x7F,
-    0xD3, 0xFF, 0x80, 0x03, 0xFF, 0x1F, 0xF8, 0xBF, 0xF4, 0x00, 0x3F, 0xF3, 0xFF, 0x0F, 0xFF, 0x00,
-    0x07, 0xFE, 0xFF, 0xC1, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4, 0x2F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
-    0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0xBF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xF0,
-    0x03, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00,
-    0xA9, 0x00, 0x00, 0x0B, 0xF9, 0x5B, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x83, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFE, 0x00, 0x03, 0xFF, 0x55, 0x55, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xF8, 0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x07, 0xF0, 0x00,
-    0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0xC0, 0x00, 0xBF,
-    0xC0, 0x1F, 0xD6, 0xAF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x00,
-    0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0,
-    0x00, 0x02, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x2F,
-    0xF0, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xC0,
-    0x00, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xF9, 0x54, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x54, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xFE, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xD1, 0xFF, 0xFF,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x2F, 0xFF, 0xD3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xCB, 0xFF, 0xF3, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x3F, 0xF8, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x1F, 0xFD, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xAF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFA, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0x6A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x1E, 0x40, 0x6F,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xAA, 0x00, 0x07, 0xFD, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0x82,
-    0xFF, 0x7F, 0xFC, 0x00, 0x1F, 0xF4, 0x7F, 0xD3, 0xFF, 0x80, 0x03, 0xFF, 0x1F, 0xF8, 0xBF, 0xF4,
-    0x00, 0x3F, 0xF3, 0xFF, 0x0F, 0xFF, 0x00, 0x07, 0xFE, 0xFF, 0xC1, 0xFF, 0xF0, 0x00, 0xBF, 0xFF,
-    0xF4, 0x2F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0xBF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0x80, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x0F, 0xF9, 0x5B, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x7F, 0xD0,
-    0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFC,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x2F, 0xF0,
-    0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x00, 0x0F, 0xF8,
-    0x2F, 0xF7, 0xFF, 0xC0, 0x01, 0xFF, 0x47, 0xFD, 0x3F, 0xF8, 0x00, 0x3F, 0xF1, 0xFF, 0x8B, 0xFF,
-    0x40, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x7F, 0xEF, 0xFC, 0x1F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0x42, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x03, 0xFF,
-    0xF8, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x00,
-    0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x83, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xF9, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF6, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF9, 0x5F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF4, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
-    0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x00,
-    0x0B, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xBF, 0xD0, 0x00, 0xFF, 0xBF, 0xF3, 0xFF, 0xBF, 0xC0, 0x01, 0xFF, 0x7F, 0xFF, 0xFC, 0xFF, 0xC0,
-    0x02, 0xFF, 0x3F, 0xFF, 0xF8, 0xFF, 0x80, 0x03, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0x40, 0x07, 0xFE,
-    0x2F, 0xFF, 0xD3, 0xFF, 0x00, 0x0B, 0xFD, 0x2F, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xFF,
-    0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x1F, 0xFE, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x05, 0x50, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0x95, 0x55, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x06, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0x94, 0x5B, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00,
-    0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x07,
-    0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x90,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x6F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF0, 0x00,
-    0xFF, 0xD5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0xAF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x01, 0x80, 0x00, 0x7F, 0xFF, 0xFA, 0x6B, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xA4, 0x00, 0x02, 0xA9, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC,
-    0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x83, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0xAB, 0xFC, 0x0B, 0xF4,
-    0x0F, 0xF8, 0x03, 0xF0, 0x3F, 0x00, 0xBF, 0xD0, 0x0F, 0xC1, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0x0B,
-    0xC0, 0x0F, 0xFC, 0x03, 0xFC, 0x2F, 0x80, 0xBF, 0xE0, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xAF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x01, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFD,
-    0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x03, 0xFC, 0x07, 0xF0,
-    0x00, 0x3F, 0x80, 0xFD, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0xFF, 0x02, 0xF8, 0x00, 0x0F, 0xF0,
-    0x3F, 0x00, 0x02, 0xFE, 0x07, 0xE0, 0x00, 0x7F, 0xD0, 0xBE, 0x00, 0x0F, 0xFC, 0x0B, 0xF4, 0x0B,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFD, 0xBF, 0x00, 0x00, 0x55, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x0B, 0xFC, 0x01, 0x54, 0x0B, 0xF8, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x80,
-    0xFF, 0xC0, 0xFF, 0x00, 0x07, 0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x1F, 0xF4, 0x2F,
-    0xE0, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x40, 0x07, 0xFD, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x2F,
-    0xF0, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0xBF, 0x80, 0x03, 0xFE, 0x02, 0xFF,
-    0x03, 0xFD, 0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x03, 0xFF, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xC0,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x0B,
-    0xF8, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x3F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00,
-    0x0A, 0xA8, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0x00,
-    0x07, 0xFD, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x1F, 0xF4, 0x2F, 0xE0, 0x00, 0xFF, 0x80,
-    0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xFD, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x1F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0x03, 0xFE, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x0F,
-    0xF0, 0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xFF,
-    0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x3F, 0xC0,
-    0x02, 0xFE, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x0B, 0xF8, 0x00, 0x3F, 0xC0,
-    0x1F, 0xE0, 0x3F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x15, 0x55, 0xA8, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xD5, 0xAF, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x07, 0xF4, 0x00, 0xBF, 0x80,
-    0x2F, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x2F, 0xF4, 0x07, 0xF8, 0x07, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x55, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x03, 0xF8,
-    0x00, 0xBF, 0x80, 0x0F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x80, 0x0F, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0,
-    0x2F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFD, 0x5A, 0xFF, 0x40, 0xFE, 0x00, 0x2F, 0xE0, 0x7F, 0x40, 0x0B, 0xF8, 0x2F, 0xC0,
-    0x03, 0xFE, 0x0F, 0xF0, 0x02, 0xFF, 0x47, 0xF8, 0x07, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xFC,
-    0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x01, 0xE9, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x06, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0x82, 0xFF, 0xE4, 0x2F, 0xF0, 0x00, 0x3F, 0x47,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x0F, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0xBE, 0x1F, 0xF4, 0x00,
-    0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE0,
-    0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xE0, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x0F, 0xD0, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x0F, 0xC1, 0xFF, 0xFE, 0xFF, 0xFD,
-    0x00, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F,
-    0xE5, 0x57, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x80, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x0F, 0xFF, 0x40, 0x02, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x2F,
-    0xFF, 0x80, 0x3F, 0xFD, 0x00, 0x3F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x15, 0x55, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFA, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xE0,
-    0x01, 0xFF, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x7F,
-    0x40, 0xFD, 0x00, 0x02, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0xC0, 0x7F,
-    0x95, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF9, 0x55, 0x40, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x6F, 0xF9, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xF5, 0xBF, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xE0,
-    0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x7F,
-    0xE0, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFA, 0xAF, 0xF0, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0xFD,
-    0x00, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x2F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x07, 0xF8,
-    0x1F, 0xE5, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFA, 0xAA, 0xA9, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0x82, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x0B, 0xF8, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x0B, 0xFC,
-    0x00, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x3F, 0xD0,
-    0x16, 0xFF, 0xE5, 0x6F, 0xF9, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x03, 0xFE, 0x03,
-    0xFE, 0x00, 0x01, 0xFF, 0x00, 0xAA, 0x40, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00,
-    0x7F, 0xD0, 0x02, 0xF4, 0x00, 0xFF, 0x9A, 0xBF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xAA, 0x55, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x6A, 0xA0, 0x06, 0xA9, 0x00, 0x2A, 0x90, 0x1A, 0xA9, 0x00,
-    0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xF8, 0x00, 0x1F, 0xFE, 0x07, 0xFE, 0x00, 0xFF,
-    0xC0, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x03, 0xFE, 0x01, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xC3, 0xFF, 0x02, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0x03, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xF3, 0xFF, 0x0B, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0xFF,
-    0x0F, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x01, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8,
-    0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x00, 0x19, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x2A, 0xFE, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x90, 0x2F,
-    0xC0, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x01, 0xBF, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xE0, 0x00, 0xFF, 0xE0, 0x0B, 0xF4, 0x00, 0xFF, 0xF4, 0x03,
-    0xFC, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x7F, 0x80, 0xBF, 0xFF, 0x80, 0x2F,
-    0xD0, 0xBF, 0xFF, 0xD0, 0x0F, 0xF0, 0x7F, 0xEF, 0xF0, 0x03, 0xFC, 0x7F, 0xE3, 0xFC, 0x01, 0xFE,
-    0x7F, 0xE1, 0xFE, 0x00, 0xBF, 0xBF, 0xF0, 0xFF, 0x80, 0x3F, 0xFF, 0xF0, 0x3F, 0xD0, 0x1F, 0xFF,
-    0xF0, 0x1F, 0xF0, 0x0B, 0xFF, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0xF4, 0x03, 0xFE, 0x00, 0xFF, 0xF4,
-    0x01, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xBF, 0xC0, 0x1A, 0xA8, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x15, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x07, 0xFC, 0x00, 0x02, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x03,
-    0xFF, 0x80, 0x00, 0x3F, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0x82, 0xFF, 0xF0, 0x00, 0x0F, 0xD2, 0xFB,
-    0xFC, 0x00, 0x03, 0xF1, 0xFD, 0xFD, 0x00, 0x01, 0xFC, 0xFC, 0xBF, 0x00, 0x00, 0xBE, 0xFD, 0x3F,
-    0xC0, 0x00, 0x3F, 0xFE, 0x2F, 0xE0, 0x00, 0x1F, 0xFE, 0x0F, 0xF4, 0x00, 0x0B, 0xFF, 0x07, 0xFC,
-    0x00, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x0B,
-    0xFC, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x07, 0xF4, 0xBF, 0xC0, 0x00, 0x0F, 0xF2, 0xFF, 0x00,
-    0x00, 0x1F, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xEF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xF7, 0xFF, 0xD0, 0x00, 0x1F, 0xF1, 0xFF,
-    0xF4, 0x00, 0x3F, 0xE0, 0xFF, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x0B,
-    0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x02, 0xFC, 0x1F, 0xC0,
-    0x00, 0x3F, 0x42, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0xBE, 0x07, 0xF4, 0x00, 0x0F, 0xD0,
-    0xBF, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0xFD, 0x00, 0x2F, 0xF4, 0x1F, 0xC0, 0x03,
-    0xFD, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x03,
-    0xFF, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x40, 0x2F, 0xFC, 0x00,
-    0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0x40,
-    0x3F, 0xFF, 0xC7, 0xFF, 0xF0, 0x03, 0xFB, 0xFC, 0xFF, 0xFF, 0x00, 0x7F, 0x7F, 0xFF, 0xDF, 0xE0,
-    0x0B, 0xF3, 0xFF, 0xFA, 0xFD, 0x00, 0xFF, 0x3F, 0xFF, 0x3F, 0xC0, 0x1F, 0xE3, 0xFF, 0xE7, 0xFC,
-    0x02, 0xFD, 0x2F, 0xFC, 0xBF, 0x80, 0x3F, 0xD2, 0xFF, 0x4F, 0xF4, 0x03, 0xFC, 0x2F, 0xF1, 0xFF,
-    0x40, 0xBF, 0xC1, 0xFC, 0x3F, 0xF0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x0A, 0xA0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x00,
-    0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xEA, 0xAB,
-    0xFF, 0x40, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFF, 0x00,
-    0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0xBF, 0xC0,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x55, 0x5B, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x0B,
-    0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1A, 0xA0, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFE, 0x06, 0xE9, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFE, 0xFC, 0x02,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x2D, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xE9, 0xBF, 0x9A, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x00,
-    0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F,
-    0xE0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0x42, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFA, 0xFF, 0xAB, 0xFF, 0x00,
-    0x3F, 0xF4, 0x1F, 0xE0, 0x0F, 0xF4, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0B, 0xF4, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0x42, 0xFD, 0x00, 0xBF, 0x80, 0x1F, 0xF0,
-    0x2F, 0xC0, 0x0F, 0xF4, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0xE0, 0x2F, 0xF0, 0x1F,
-    0xF0, 0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x07,
-    0xFD, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xE0, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFD,
-    0x00, 0x2A, 0xA8, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF4, 0x00,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0x3F,
-    0xD0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFE,
-    0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x6A, 0xAF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x02, 0x80, 0x0A, 0x01, 0xF0,
-    0x07, 0xC0, 0xB8, 0x02, 0xF0, 0x3C, 0x00, 0xF8, 0x1F, 0x00, 0x7D, 0x0B, 0x40, 0x2F, 0x03, 0xC0,
-    0x1F, 0xC0, 0xF4, 0x2F, 0xF0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0x9F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xF0, 0x05,
-    0x50, 0x3F, 0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0xBF, 0xC0,
-    0x0F, 0xFC, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x40, 0x1F, 0xF4, 0x0F,
-    0xF8, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0,
-    0x03, 0xFE, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x2F, 0xE0, 0x3F, 0xC0, 0x0B, 0xFC, 0x03,
-    0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF4, 0x07, 0xF8, 0x0B, 0xF4,
-    0x01, 0xFF, 0x95, 0xFF, 0x95, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x05, 0x50, 0x3F, 0xD0, 0x07, 0xFE, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x3F, 0xD0, 0xBF, 0xC0, 0x0F, 0xFC, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0xC0,
-    0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xF8, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x2F, 0xE0,
-    0x3F, 0xC0, 0x0B, 0xFC, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0xBF, 0x80, 0x0F,
-    0xF4, 0x07, 0xF8, 0x0B, 0xF4, 0x01, 0xFF, 0x95, 0xFF, 0x95, 0xFF, 0xA4, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x06, 0xAB,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xE4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFE, 0xAF, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x2F, 0x40, 0x3F,
-    0x00, 0xFC, 0x02, 0xFC, 0x03, 0xF0, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x29, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFA, 0x90,
-    0x00, 0x0F, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xC0, 0x07,
-    0xD0, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x3F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x7F,
-    0x80, 0x0F, 0x81, 0xFF, 0x40, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x3F, 0xFF, 0xFC,
-    0x01, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBE, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0x80, 0x3F,
-    0xAB, 0xFC, 0x03, 0xE0, 0x0F, 0xD0, 0xBD, 0x00, 0xFD, 0x0F, 0xC0, 0x1F, 0xC0, 0xFC, 0x1B, 0xFC,
-    0x1F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE4, 0x1F, 0xE0,
-    0x00, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x08, 0x00, 0x1F, 0xFC, 0x01, 0xFA, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBD, 0x03, 0xFF, 0xFD, 0x00,
-    0x0F, 0xC0, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x3F, 0xF5, 0x7F, 0x40, 0x1F, 0x4B, 0xF8, 0x02, 0xF8,
-    0x02, 0xF0, 0xFE, 0x00, 0x1F, 0x80, 0x3F, 0x6F, 0xC0, 0x01, 0xF8, 0x03, 0xFF, 0xF4, 0x00, 0x2F,
-    0x40, 0x7F, 0xFF, 0x00, 0x02, 0xF0, 0x0B, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0xFF, 0xFE, 0x00, 0x0B,
-    0xE0, 0x0F, 0xDF, 0xE0, 0x00, 0xFD, 0x01, 0xF0, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0x0F, 0xFE, 0xBF,
-    0xF8, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x3D, 0x07, 0xFF, 0xFF, 0xD0, 0x07, 0xC0, 0x2F, 0xFF,
-    0xF4, 0x00, 0xB8, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x50, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xD0, 0x0F, 0xD0,
-    0x03, 0xF4, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B,
-    0xFE, 0xAB, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFC, 0x1B, 0xFE, 0x02, 0xFE, 0x01, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xF0, 0x7F, 0xE0, 0x1F,
-    0xFC, 0x2F, 0xF8, 0x07, 0xFF, 0x0F, 0xFF, 0x01, 0xFF, 0xC7, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00,
-    0x2F, 0x40, 0x03, 0xFE, 0x6A, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFE, 0xA9, 0x54, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x6C, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF1,
-    0xFF, 0xC0, 0x00, 0x06, 0xA9, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x7F,
-    0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xF9, 0xAB, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFA, 0xA5, 0x50, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xAF, 0xFC, 0x00, 0xBF, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0xC0, 0x02,
-    0xFC, 0x01, 0xFF, 0x80, 0x02, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x00, 0x03, 0xF8,
-    0x07, 0xFE, 0x00, 0x0B, 0xF4, 0x0B, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0xBF, 0xD0, 0x7F, 0xF4,
-    0x00, 0xFF, 0xD0, 0xBF, 0xF4, 0x26, 0xFF, 0xC0, 0x06, 0xB0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFA, 0xAA, 0xA9, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x00, 0xBD, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFE, 0x55, 0x54, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x40, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xAB, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x02, 0xD0, 0x03, 0xFF, 0x80, 0x3F, 0xFA, 0xBF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x1B, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x06, 0xBE, 0x00, 0x00, 0x00, 0xA9, 0x02, 0xA4, 0x0B, 0xF8, 0x2F, 0xE0, 0x3F, 0xE0, 0xFF,
-    0x81, 0xFF, 0x47, 0xFD, 0x0F, 0xFD, 0x3F, 0xF0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x06, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0xAF, 0xC0, 0x00, 0x00, 0x3D, 0x01,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x1F,
-    0xFF, 0x80, 0x01, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0xFC, 0x03, 0xF5, 0x7F, 0x40, 0x3D, 0x00, 0xF8,
-    0x07, 0xD0, 0x2F, 0x00, 0x7D, 0x02, 0xF4, 0x0F, 0xC0, 0x2F, 0x02, 0xFC, 0x07, 0xE0, 0x0F, 0xFF,
-    0xFE, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0x07, 0xF8, 0x02, 0xFF, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0A,
-    0x00, 0x00, 0x0B, 0xD0, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xB8,
-    0x00, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0xEA, 0xBF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF4, 0x00, 0xF9, 0x5F, 0xC0, 0xBC, 0x00, 0x7D, 0x02,
-    0xF4, 0x3F, 0x00, 0x2F, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0xC0, 0xBF, 0x07, 0xD0, 0x03, 0xFF, 0xFF,
-    0x82, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0xBF, 0xFF, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xAB, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x50, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFF, 0x90, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xAF, 0xFC, 0x00, 0xBF, 0xF4,
-    0x02, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x01, 0xFF, 0x80, 0x02, 0xFC, 0x02, 0xFF, 0x00, 0x03,
-    0xF8, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x0B, 0xF4, 0x0B, 0xFD, 0x00, 0x0F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F,
-    0xF8, 0x00, 0xBF, 0xD0, 0x7F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x01, 0xFF, 0xC0, 0x06, 0xB0,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x42, 0xFF, 0x00, 0x00, 0x3F, 0xC2, 0xFF, 0x00, 0x00, 0x1F, 0xD2,
-    0xFF, 0x00, 0x00, 0x0F, 0xF2, 0xFF, 0x00, 0x00, 0x07, 0xF6, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x03, 0xFD, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0x83, 0xFF, 0xF4,
-    0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xFC, 0x01, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0x40, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x0B, 0xFF, 0xF0, 0x07, 0xF8, 0x0B, 0xFF, 0xF8, 0x02, 0xFD, 0x0B, 0xFF, 0xFD,
-    0x00, 0xFF, 0x07, 0xFE, 0xFF, 0x00, 0x3F, 0xC7, 0xFE, 0x3F, 0xC0, 0x1F, 0xE7, 0xFE, 0x1F, 0xE0,
-    0x0B, 0xFB, 0xFF, 0x0F, 0xF8, 0x03, 0xFF, 0xFF, 0x03, 0xFD, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0x00,
-    0xBF, 0xFF, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0x40, 0x3F, 0xE0, 0x0F, 0xFF, 0x40, 0x1F, 0xF4, 0x07,
-    0xFF, 0x40, 0x0B, 0xFC, 0x01, 0xAA, 0x80, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x3F, 0x40, 0x3F, 0x80, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x02, 0xF8, 0x02, 0xFD, 0x55, 0x7F,
-    0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x15, 0x6F,
-    0xF5, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xF0, 0x07, 0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0xFF, 0xC0, 0x03, 0xF8, 0x0F, 0xF8, 0x00,
-    0xBF, 0x41, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x15, 0xBF, 0x95, 0x50, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0x96, 0xFF, 0x00, 0x3F, 0xF0, 0x01, 0xFD, 0x01, 0xFF, 0x80, 0x07, 0xF0, 0x0B, 0xFC, 0x00,
-    0x3F, 0xC0, 0x2F, 0xF9, 0xAF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x95, 0x55, 0x55, 0x59, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xE2, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x41, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x1F,
-    0xFC, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x0B, 0xFF,
-    0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x7F, 0xF4, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xC0,
-    0xBF, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0xFD, 0xBE, 0x00, 0x00, 0x1F, 0xD3, 0xF0,
-    0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC3, 0xF0, 0x00, 0x0B, 0xF0, 0xBD, 0x0F, 0xC0, 0x00, 0x7F, 0x43,
-    0xF0, 0x3F, 0x00, 0x03, 0xFC, 0x1F, 0xC0, 0xFD, 0x00, 0x2F, 0xD0, 0xFF, 0x03, 0xF8, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFA, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xEA, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x8B, 0xF8, 0x00, 0x00,
-    0xFF, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x2F, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xD1, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xAF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFD, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xA4, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0xBF,
-    0x40, 0x3F, 0xC0, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x7F, 0x81, 0xFF, 0x00, 0x00, 0x7F, 0xC3,
-    0xFD, 0x00, 0x00, 0x7F, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x1F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xAA, 0xAA, 0x90, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xFD, 0x55, 0x55, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0xAA, 0xA4, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x5F, 0xF5, 0x55, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF9, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFB,
-    0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x1F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x16, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0x40, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F,
-    0x44, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x00, 0x1F, 0xD0, 0xBE, 0x00, 0xBD, 0x00,
-    0xF8, 0x03, 0xF0, 0x03, 0xD0, 0x1F, 0x80, 0x2F, 0x00, 0xBD, 0x0B, 0xF8, 0x03, 0xF0, 0x7F, 0xC0,
-    0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xF8, 0x0F, 0xFF, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD1, 0xFF, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x7F, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x2F, 0xFF, 0xF2, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xCB, 0xFF, 0xF5, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF,
-    0xFD, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0xFF,
-    0xF6, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x3F, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0x80,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F,
-    0xFF, 0x42, 0xFD, 0x00, 0x03, 0xFC, 0x1F, 0xFF, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x2F, 0xFE, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x2F, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x3F, 0xFC, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x7F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFA, 0xFF, 0x7F, 0xF4, 0x00, 0x01, 0xFF,
-    0xE2, 0xFE, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x83, 0xFD, 0x0F, 0xFF, 0x80, 0x7F, 0xFD, 0x07, 0xFC,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFA,
-    0xAB, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFE, 0x40, 0x00, 0x01, 0x6A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0x00, 0x01, 0xFF, 0xC0, 0x1E, 0x41, 0xBF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x00, 0x19, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x2A, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x90, 0x2F, 0xC0, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x01,
-    0xBF, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x09, 0x6F,
-    0x40, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xCB, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xFF, 0xE2, 0xFC, 0x3F, 0xFC,
-    0x00, 0xFF, 0xFF, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x1F, 0xC2, 0xFD,
-    0x00, 0x00, 0xFE, 0x2F, 0xE0, 0x00, 0x03, 0xF1, 0xFE, 0x00, 0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x00,
-    0xFE, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x9F, 0xFD, 0x00, 0x01, 0xFD, 0x3F, 0xFC, 0x00, 0x0B, 0xF0,
-    0x7F, 0xFC, 0x14, 0x3F, 0xC0, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xF8, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x3F, 0x43, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xF3, 0xF4, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x2F, 0xCB, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xD3, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x0A,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x40,
-    0x00, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0x14, 0x0F, 0xF0, 0x00, 0x03, 0xFB, 0x83, 0xFC, 0x00, 0x00, 0xBD, 0xF8, 0xFF, 0x40,
-    0x00, 0x0F, 0xCF, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x3E, 0xFF, 0xD0, 0x00, 0x0B, 0xF3, 0xE7, 0xFF,
-    0x00, 0x00, 0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x0B,
-    0xFF, 0x40, 0x3F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD7, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF7, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF2, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xF6, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x01, 0x5B, 0xFD, 0x54, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD,
-    0x05, 0x54, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x07, 0xF8, 0xFF, 0xC0, 0x00, 0xBF, 0xBF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFB, 0xFF, 0xE0, 0x02, 0xFF, 0x3F, 0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0xFD, 0x07, 0xFE, 0x0B, 0xFF,
-    0xF4, 0xBF, 0xD0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0x47, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0x80, 0x55, 0x57, 0xFF, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF2, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF6, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x3F, 0xC1, 0xFF, 0xFE, 0x0F, 0xF0, 0x05, 0x5F, 0xD2, 0xFD,
-    0x00, 0x01, 0xFC, 0xBF, 0x40, 0x00, 0x2F, 0x9F, 0xE0, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFE, 0xBF,
-    0xF0, 0x00, 0x1F, 0xD3, 0xFF, 0xC0, 0x03, 0xFC, 0x2F, 0xFF, 0x00, 0x3F, 0x80, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F,
-    0xE0, 0x00, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF,
-    0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0x95, 0x55, 0x7F, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xAA, 0x2F, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x2F,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xF5, 0x56, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x2F,
-    0xE0, 0x03, 0xFF, 0xF4, 0x3F, 0xE0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x95, 0x55, 0x54, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0x55, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x95, 0x55, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD5,
-    0x5B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x95, 0x57, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xEF, 0xFE, 0x00, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x0F,
-    0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xFC, 0x00,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x01, 0xFF, 0xF4,
-    0x00, 0x0F, 0xF4, 0x1F, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x03, 0xFF,
-    0xF0, 0x05, 0xBF, 0xE0, 0x3F, 0xF4, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x03, 0xFF, 0x00, 0x07,
-    0xFF, 0xD0, 0x3F, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0xBF, 0xFD, 0x03, 0xFF, 0xE0, 0x0B, 0xFE, 0x00,
-    0x0F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x15,
-    0x40, 0x07, 0xFF, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xD0, 0x15, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xBF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x47, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x92, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0x80, 0x3F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xF8, 0x00, 0x3F, 0x80, 0x2F, 0xF8,
-    0x02, 0xFF, 0x00, 0x07, 0xF8, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x0B,
-    0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0B, 0xFD, 0x01, 0xFF, 0x40, 0x1F, 0xF0,
-    0x02, 0xFF, 0x80, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0xBF, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x3F,
-    0xFD, 0x40, 0x2F, 0xF4, 0x02, 0xFF, 0x5F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0x9F, 0xFF, 0xF0, 0x00, 0xFF, 0xF5, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x42, 0xFE, 0x03, 0xF4,
-    0x07, 0xFC, 0x07, 0xF4, 0x02, 0xF4, 0x0F, 0xF0, 0x0F, 0xE0, 0x03, 0xF0, 0x1F, 0xE0, 0x1F, 0xC0,
-    0x0B, 0xE0, 0x2F, 0xC0, 0x2F, 0x80, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0x3F, 0xC0,
-    0x3F, 0x41, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0x8B, 0xFF, 0xC0, 0x3F, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFA, 0xAB, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xFF, 0xD4, 0x05, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFE, 0xBC, 0x02, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x04, 0x00, 0x3F, 0xF8, 0x6E, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x15, 0xBF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xA8, 0x00, 0x00, 0x01, 0xFF,
-    0xF2, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xA9,
-    0x6F, 0xD5, 0xA4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF3, 0xE0, 0x00, 0x07, 0xFC, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x02,
-    0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x3F, 0xFC, 0x00,
-    0x00, 0x3F, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x01, 0xFF, 0x43, 0xFF, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x01,
-    0xFF, 0x40, 0x2F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0x4B, 0xFC, 0x00, 0x1F, 0xF4, 0xFF, 0x80, 0x01,
-    0xFF, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00,
-    0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE3, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xF5, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x4B, 0xFC, 0x00,
-    0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x01, 0x55, 0x7F, 0xFF, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xEB, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF4, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x40, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x03, 0xFF, 0x55, 0x57, 0xFE, 0x54, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x45, 0x43, 0xFF, 0xFF,
-    0xF0, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x80, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0x00,
-    0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x02, 0xFC, 0x00,
-    0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x01, 0x00, 0x00, 0x06, 0x54, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x07, 0xFE, 0x00,
-    0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x1F,
-    0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xE0,
-    0x1F, 0xD0, 0x00, 0xBF, 0xD0, 0x2F, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xE0, 0x0B, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAA,
-    0x97, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x01, 0xFD, 0x00, 0xFE, 0x2F, 0xC0, 0x0F, 0xD2, 0xF8,
-    0x01, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xF0, 0x03, 0xF4, 0x3E, 0x00, 0x3F, 0x07, 0xD0, 0x0F, 0xF0,
-    0x7E, 0x06, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0x6A, 0x7F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x03, 0xFC,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0xFF, 0x02, 0xF8, 0xFC,
-    0x0F, 0xF0, 0x3F, 0x1F, 0xC2, 0xFE, 0x07, 0xE2, 0xF8, 0x7F, 0xD0, 0xBE, 0x3F, 0x4F, 0xFC, 0x0B,
-    0xFB, 0xFB, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFD, 0xBF, 0x00, 0x02, 0xFD, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x03,
-    0xF0, 0x2F, 0xC0, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x02, 0x80, 0x0A, 0x40, 0xF0, 0x03, 0xD0, 0xB8, 0x02, 0xF0, 0x3C, 0x00, 0xFC, 0x1F, 0x10,
-    0x3E, 0x0B, 0x6E, 0x2F, 0x43, 0xCF, 0x5F, 0xC0, 0xFB, 0xEF, 0xF0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFD, 0x00, 0xBF, 0x9F, 0x00, 0x0F, 0x0B, 0xC0, 0x07, 0xC3, 0xE0, 0x01, 0x51, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xBF, 0xF8, 0x02, 0xFF, 0xD0, 0x07, 0xF8, 0x03, 0xFF, 0x40,
-    0x03, 0xF8, 0x03, 0xFE, 0x00, 0x07, 0xF4, 0x07, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x3F, 0xE0,
-    0x3F, 0xF0, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x15,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xFF,
-    0x90, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xAF, 0xFC,
-    0x00, 0xBF, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x01, 0xFF, 0x80, 0x02, 0xFC, 0x02,
-    0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x0B, 0xF4, 0x0B, 0xFD,
-    0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0xBF, 0xD0, 0x7F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x01, 0xFF,
-    0xC0, 0x06, 0xB0, 0x01, 0x50, 0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0x2B, 0xF9, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xE4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFA, 0x47, 0xFF, 0xD0, 0x07, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0x5A, 0xBF, 0xE0,
-    0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0xA4, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x40,
-    0x5F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xE9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x07, 0xF9, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x0F,
-    0xF9, 0x00, 0x3F, 0xFF, 0xFE, 0x2F, 0xFF, 0xE7, 0xFE, 0x00, 0xBC, 0x1F, 0xFF, 0xFF, 0xF4, 0x16,
-    0xF4, 0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xA9, 0x54, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x08, 0x00, 0x00, 0xBF, 0xFA, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x39, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFE, 0x42, 0xFF, 0xE0, 0x02, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF9, 0x5A, 0xBF, 0xF0, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0xA9, 0x54, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x06, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0xBF, 0x90, 0x02, 0xFF, 0xEF,
-    0xF0, 0x7F, 0xFF, 0x9B, 0xFC, 0x01, 0xF4, 0x1F, 0xFF, 0xFF, 0xF4, 0x16, 0xF8, 0x00, 0x6F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xAA, 0x55, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x50, 0x00, 0x01, 0xFF, 0xE9, 0x5B, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xC2, 0xFF, 0xE4, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF,
-    0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xFF,
-    0x40, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xFF, 0xF0, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x87, 0xFF, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF2, 0xFF, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0xBF, 0xFF, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC3,
-    0xFF, 0x8B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0xFF, 0xD0, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0xBF, 0xF0, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC,
-    0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE5, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x06, 0xA8, 0x00, 0x2A, 0x90, 0x0A,
-    0xA9, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x3F, 0xF8, 0x00, 0x1F, 0xFD, 0x07, 0xFE,
-    0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x03, 0xFE, 0x00, 0xFF, 0x43, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0x83, 0xFF, 0x02, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD3, 0xFF, 0x03, 0xFE,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0xFF, 0x0B, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0xFA, 0xFF, 0x0F, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x01, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF4, 0x00,
-    0x02, 0xFD, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x80,
-    0x00, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xCF, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x1F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x41, 0xA8, 0x00, 0x2F, 0x47, 0xF4, 0x00, 0x3F,
-    0x0F, 0xE0, 0x00, 0x7E, 0x3F, 0x80, 0x00, 0xBD, 0xFF, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xEB,
-    0xFF, 0x00, 0x0F, 0xC0, 0x7F, 0x40, 0x2F, 0xC0, 0x2F, 0x80, 0x3F, 0x80, 0x2F, 0x80, 0x3F, 0x40,
-    0x3F, 0x80, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF9, 0x5F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xFE, 0x00, 0x00,
-    0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x7F,
-    0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xE5,
-    0x40, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0x43,
-    0xF4, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x0B, 0xE0, 0xBF, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x01, 0xFC,
-    0x0F, 0xD0, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x0F,
-    0xE0, 0x7F, 0x40, 0x03, 0xF4, 0x2F, 0xC0, 0x0B, 0xFC, 0x0F, 0xFF, 0x07, 0xFE, 0x03, 0xFF, 0x82,
-    0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0x95,
-    0x55, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0,
-    0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x07,
-    0xF4, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xE0,
-    0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xF5,
-    0x56, 0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x40, 0x3F, 0xD0, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0x00, 0x07, 0xFF, 0x95, 0x55, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x03,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0xC0,
-    0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x07,
-    0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x1F, 0xE0,
-    0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xF5, 0x56, 0xFF, 0x40, 0x1F, 0xF0,
-    0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x01, 0x00, 0x00, 0x02, 0x55, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x07,
-    0xFD, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xF4,
-    0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x1F, 0xE0, 0x00,
-    0xBF, 0xD0, 0x1F, 0xD0, 0x01, 0xFF, 0xC0, 0x1F, 0xE0, 0x0B, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x6A, 0x97, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x06, 0x40, 0x15, 0x0F,
-    0x80, 0x3E, 0x0F, 0x00, 0x3D, 0x2E, 0x00, 0x7C, 0x3C, 0x00, 0xFC, 0x7C, 0x00, 0xF8, 0xB4, 0x03,
-    0xF4, 0xB8, 0x1F, 0xF0, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x1F, 0xF3, 0xD0, 0x00, 0x07, 0xD0,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF7,
-    0xFF, 0x4F, 0xFE, 0xFF, 0x80, 0x00, 0xFF, 0xDF, 0xFE, 0xBF, 0xEF, 0xFD, 0x00, 0x07, 0xFE, 0x3F,
-    0xFF, 0xFF, 0x3F, 0xF4, 0x00, 0x2F, 0xF8, 0xFF, 0xFF, 0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xCF, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0xFD, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x3F, 0xFF,
-    0xF2, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x82, 0xFF, 0xF8,
-    0x7F, 0xFC, 0x00, 0x1F, 0xFD, 0x0B, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x0F,
-    0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0x42, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x7F,
-    0xF8, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xCB, 0xFF, 0xE0, 0x02, 0xFA, 0xFD, 0xFE, 0xFD, 0x00, 0x3F, 0xAF, 0xFF, 0xEF, 0xC0, 0x03,
-    0xF6, 0xFF, 0xF7, 0xFC, 0x00, 0xBF, 0x1F, 0xFE, 0x7F, 0x80, 0x0F, 0xF1, 0xFF, 0xCB, 0xF8, 0x00,
-    0xFF, 0x1F, 0xF8, 0xFF, 0x40, 0x1F, 0xE0, 0xFF, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xD2, 0xFF, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0xBF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC2,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFA, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xE5, 0x5B, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x06, 0xA0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x55, 0x6F, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80,
-    0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x01, 0x54, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0x80,
-    0x00, 0x0F, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xC2, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xAF, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x0B,
-    0xFC, 0x00, 0x07, 0xF9, 0x56, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAA, 0xAA, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD1, 0xFF, 0xD5, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x82, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
-    0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xAF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFA, 0xFF, 0xFF, 0xF4, 0x1F, 0xE0,
-    0x02, 0xFE, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x01, 0xFF, 0xF5, 0xAF, 0xFF, 0x00,
-    0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x02, 0xFF, 0xFA, 0x95, 0x40, 0x03, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x95,
-    0x6F, 0xFF, 0xF4, 0x00, 0x2E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x40, 0x01, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x55, 0x55, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0xA9, 0x00, 0x00, 0x0B, 0xF9, 0x5B, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0xFF,
-    0x9A, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xAA, 0x55, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x06, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xF4, 0x00, 0x1B, 0xFF, 0xF0, 0x01, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xD5, 0x00, 0x0F,
-    0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAE, 0x90,
-    0x00, 0x06, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x40, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x05, 0x5A, 0xBF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xA7, 0xFF, 0x00, 0xBD, 0x00, 0x1F, 0xF0, 0x01, 0xFD,
-    0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x43, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x06, 0xAA, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xF4, 0x00, 0x1B, 0xFF, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xD5, 0x00,
-    0x0F, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xE9, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x55, 0xAB, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFA, 0x7F,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xD0, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x1F, 0xF4, 0x00,
-    0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xAA, 0x82, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA0, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xC1, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xC2, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x2F, 0xFF, 0xE1, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x8F, 0xFF, 0xF1, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xFC, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xFD, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x7F, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x1F, 0xFE, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0B, 0xFF, 0x43, 0xFF, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFD, 0x00, 0x3F,
-    0xD0, 0x1F, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x7F, 0xF4, 0x00, 0x1F, 0xFE,
-    0x07, 0xFE, 0x00, 0xFF, 0x81, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFE, 0x01, 0xFF, 0x43, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0x02, 0xFF, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE3, 0xFF,
-    0x03, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0xFF, 0x0B, 0xFC, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0xFF, 0x0F, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0x81, 0xFF, 0xF8, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x01, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x1F,
-    0xF8, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0x00, 0x0A, 0xA8, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x05, 0xAB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xE4, 0x06, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0x02, 0xA8, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x0B, 0xFC,
-    0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0x90, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2A, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x09, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1A, 0xAA, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0A, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x10, 0x07, 0xFD, 0x00, 0x0B, 0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFE, 0x80,
-    0x00, 0x00, 0x00, 0x16, 0xAA, 0xAA, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x04, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x3F, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x6A, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xAA, 0x00, 0x07, 0xFD, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xC0, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0x82, 0xFF,
-    0x7F, 0xFC, 0x00, 0x1F, 0xF4, 0x7F, 0xD3, 0xFF, 0x80, 0x03, 0xFF, 0x1F, 0xF8, 0xBF, 0xF4, 0x00,
-    0x3F, 0xF3, 0xFF, 0x0F, 0xFF, 0x00, 0x07, 0xFE, 0xFF, 0xC1, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4,
-    0x2F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0xBF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xAA, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF,
-    0xFC, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0xBF, 0xFF, 0x80, 0x02, 0xFD, 0x0B,
-    0xFF, 0xFD, 0x00, 0x0F, 0xF0, 0x7F, 0xEF, 0xF0, 0x00, 0x3F, 0xC7, 0xFE, 0x3F, 0xC0, 0x01, 0xFE,
-    0x7F, 0xE1, 0xFE, 0x00, 0x0B, 0xFB, 0xFF, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xD0, 0x01,
-    0xFF, 0xFF, 0x01, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x0B, 0xFC, 0x00, 0x3F, 0xFF, 0x40, 0x3F, 0xE0,
-    0x00, 0xFF, 0xF4, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x1A, 0xA8, 0x00, 0x2A,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x7F, 0xD0,
-    0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFC,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x2F, 0xF0,
-    0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0xFF, 0xEF, 0xFC, 0x00, 0x0F, 0xF8,
-    0x2F, 0xF7, 0xFF, 0xC0, 0x01, 0xFF, 0x47, 0xFD, 0x3F, 0xF8, 0x00, 0x3F, 0xF1, 0xFF, 0x8B, 0xFF,
-    0x40, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0xF0, 0x00, 0x7F, 0xEF, 0xFC, 0x1F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0x42, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x03, 0xFF,
-    0xF8, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x2A, 0x40, 0x00, 0x0B, 0xF8, 0x2F, 0xE0, 0x00, 0x03, 0xFD,
-    0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x7F, 0xF1,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x07, 0xF8, 0x00, 0x3F, 0xF8, 0x02, 0xFD, 0x00, 0x3F,
-    0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xC0, 0x2F, 0xFF, 0xC0, 0x1F, 0xE0, 0x2F, 0xFF,
-    0xE0, 0x0B, 0xF4, 0x2F, 0xFF, 0xF4, 0x03, 0xFC, 0x1F, 0xFB, 0xFC, 0x00, 0xFF, 0x1F, 0xF8, 0xFF,
-    0x00, 0x7F, 0x9F, 0xF8, 0x7F, 0x80, 0x2F, 0xEF, 0xFC, 0x3F, 0xE0, 0x0F, 0xFF, 0xFC, 0x0F, 0xF4,
-    0x07, 0xFF, 0xFC, 0x07, 0xFC, 0x02, 0xFF, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0x80,
-    0x3F, 0xFD, 0x00, 0x7F, 0xD0, 0x1F, 0xFD, 0x00, 0x2F, 0xF0, 0x06, 0xAA, 0x00, 0x0A, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA0, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFE, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xE5, 0x16, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x81, 0xFE, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x02, 0xFF, 0x4B,
-    0xFD, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x06, 0xAA, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0,
-    0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F,
-    0xF0, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x3F, 0xE0, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFA, 0xAA,
-    0x97, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFA, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x03, 0xFF, 0x00,
-    0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xEA, 0xBF, 0xD0, 0x3F, 0xE0, 0x00, 0xBF, 0xC0,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0xA9, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xD0, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x0B,
-    0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xAA, 0xA9, 0x7F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x0F,
-    0xFF, 0x40, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x41, 0xA9, 0x00,
-    0x00, 0xFF, 0x43, 0xFD, 0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xEA, 0xBF, 0xD0, 0x3F, 0xE0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x4B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA1, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE9, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x0A, 0x90, 0x00, 0xBF, 0x82, 0xFE, 0x00, 0x0F, 0xF4,
-    0x3F, 0xD0, 0x01, 0xFF, 0x4B, 0xFD, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x07, 0xFF, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0xFE, 0x41, 0xFE, 0x00, 0x0D, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x01, 0xFF, 0xC0, 0x1F, 0xAB,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x2B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAA, 0xBC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4,
-    0x00, 0x02, 0xA9, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00,
-    0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06,
-    0xAA, 0xA5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x7F,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA4, 0x0A, 0x90, 0x00, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0x41, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x80, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x83,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00,
-    0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xCF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
-    0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4,
-    0x0A, 0x90, 0x00, 0xBF, 0x42, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x02, 0xFF, 0x0B, 0xFC, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x0B, 0xFF, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0xBF,
-    0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF, 0x40, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0x40, 0x00, 0xFF,
-    0x03, 0xF0, 0x00, 0x2F, 0xE0, 0x7E, 0x00, 0x07, 0xFD, 0x0B, 0xE0, 0x00, 0xFF, 0xC0, 0xBF, 0x40,
-    0xBF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xDB, 0xF0, 0x00, 0x05, 0x50, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0xA9, 0x02, 0xA4, 0x0B, 0xF8, 0x2F, 0xE0, 0x3F, 0xD0, 0xFF, 0x42, 0xFF, 0x4B, 0xFD, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x80, 0x07, 0xC0,
-    0x1F, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x40, 0x2D, 0x00, 0xBC,
-    0x00, 0xF0, 0x07, 0xF0, 0x03, 0xD0, 0xBF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x2F, 0xE7, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0xFF, 0x55, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x80,
-    0x0F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x80, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80,
-    0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xE0, 0x2F, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xAA,
-    0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x29, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFA, 0x90,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xC0,
-    0x00, 0x7D, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0xFC, 0x02,
-    0xFC, 0x07, 0xF8, 0x00, 0x0F, 0x81, 0xFF, 0x40, 0xBF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xCF,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x3F, 0xFF, 0x10, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0x40, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00,
-    0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xEF, 0xF8, 0x00, 0x00, 0x3F, 0xE2, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE4, 0x00, 0x3F, 0xF0,
-    0x0F, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF4, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x1F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x00, 0x0F, 0xD0,
-    0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x0B,
-    0xF0, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x07, 0xF4,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x3F,
-    0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x02,
-    0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F,
-    0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x3F,
-    0xFC, 0x00, 0x2F, 0xFE, 0xBF, 0xFD, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0xBF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x2F, 0xFF, 0x43, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xD0, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x02,
-    0xFF, 0xD0, 0x00, 0xBF, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0xBF, 0xF0, 0x00, 0x3F, 0xFC,
-    0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x02, 0xFF, 0xE0, 0x00, 0xBF,
-    0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x02,
-    0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F,
-    0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x7F, 0xFC,
-    0x00, 0x2F, 0xFF, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x00, 0x02,
-    0xA8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0x82, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x03, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x1F, 0xFD, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x55,
-    0x03, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x1F, 0xFD, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x55, 0x00, 0x05,
-    0x50, 0x00, 0x55, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x07,
-    0xFE, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xFD, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x2F,
-    0xFC, 0x01, 0xFF, 0xD0, 0x3F, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xD0, 0x3F, 0xFC, 0x15, 0x0F, 0xD3,
-    0xF4, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBA, 0xB0,
-    0x0B, 0xF0, 0x00, 0x00, 0x0E, 0xEA, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xD5, 0xE0, 0x7F, 0x80, 0x00,
-    0x00, 0x1E, 0x3C, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x28, 0x06, 0x80, 0x00, 0x0F, 0xF8, 0x0C, 0xA1, 0xCD, 0x00, 0x02, 0xFF,
-    0x02, 0xB6, 0x3A, 0xD0, 0x00, 0xBF, 0xC0, 0x3B, 0xD7, 0xAC, 0x00, 0x2F, 0xF0, 0x03, 0x5C, 0x72,
-    0xC0, 0x07, 0xFD, 0x00, 0x3F, 0x87, 0xF4, 0x01, 0xFF, 0x40, 0x02, 0xE0, 0x3E, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
-    0xFF, 0x40, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x7F,
-    0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x0B,
-    0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x0F, 0xFF, 0x40, 0x0F, 0xFF, 0x00,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x80,
-    0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x78, 0x00, 0xE0, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x2F, 0xC0, 0xFF, 0x40, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0xD0, 0x7F, 0x81, 0xFD,
-    0x03, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0x3F, 0x40, 0xFE, 0x03, 0xF4, 0x07, 0xF0, 0x0F, 0xC0, 0x14,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6C, 0x07, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0x40,
-    0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x0B, 0xF4, 0x7F, 0x41, 0xFE,
-    0x1F, 0xE0, 0x3F, 0xC3, 0xFC, 0x07, 0xF4, 0x7F, 0x40, 0xFE, 0x0F, 0xE0, 0x1F, 0x81, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x01, 0xF0, 0x01, 0xD0, 0x3F, 0xC0,
-    0xBF, 0x40, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF,
-    0x02, 0xFC, 0x03, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x7E, 0x00, 0xFD, 0x00,
-    0x50, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xCB, 0xFE, 0x03, 0xFF,
-    0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1D, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xF8, 0x00,
-    0x2F, 0xF0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0F,
-    0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x2F,
-    0xFC, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFC, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x06, 0xAA, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE7, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x07, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xD2, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFD, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x02,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFC, 0x00, 0x01, 0x55, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x47, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x03, 0x8F, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0xBF,
-    0x80, 0x00, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x54, 0x05, 0x40, 0x00, 0x50, 0xBF, 0x40, 0x2F,
-    0xE2, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x05, 0x00, 0x00, 0x02, 0xCB, 0x8B, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF7, 0xDB, 0xC0, 0x00, 0x00, 0x20, 0xF4, 0x6E, 0x00, 0x00, 0x7C,
-    0x7D, 0x0F, 0x42, 0x00, 0x2F, 0x1F, 0xE7, 0xCB, 0x83, 0xDF, 0xBF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xAF, 0xFF, 0x80, 0x1F, 0xFE, 0x01, 0xFF, 0xD0, 0x07, 0xFF, 0xD7, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFB, 0xDF, 0x87, 0xDF, 0x5E, 0x62, 0xF0, 0x40, 0x83, 0xC0, 0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xD0,
-    0x1F, 0xF0, 0x3F, 0xFD, 0x01, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x3E, 0x00, 0x02, 0xFD,
-    0x00, 0x09, 0x00, 0x00, 0xBF, 0x80, 0x90, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x07, 0xFF, 0x90, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x19, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x03, 0xFC, 0x90, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x81, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x83, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x41, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x2E, 0x7C, 0x07, 0x82, 0xC0, 0xF7, 0x6C, 0x1F, 0xB7, 0xC2, 0xEB, 0x7C, 0x3D, 0x1B, 0x83, 0xE1,
-    0xF0, 0x3F, 0xFF, 0x02, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0xFB, 0x40, 0x3C, 0xF0, 0x0F, 0x1F, 0x03, 0xFF, 0xFC, 0x3F,
-    0xFF, 0x80, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0xF4, 0x03, 0xFF, 0xD0, 0x1D, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x0D, 0x1F, 0xC0,
-    0x7F, 0xFE, 0x02, 0xFF, 0xF0, 0x06, 0xF9, 0x00, 0x00, 0x6F, 0xE0, 0x2F, 0xFE, 0x07, 0x80, 0x00,
-    0xFB, 0x90, 0x2F, 0xFF, 0x03, 0xF4, 0xF8, 0x3D, 0x0B, 0x87, 0xC0, 0xF4, 0x3D, 0x6F, 0x03, 0xFF,
-    0xD0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE7, 0xFF, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x03, 0xEB, 0xC0, 0x2E, 0x0B, 0x40, 0xF4, 0x7C, 0x01, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0xF8, 0x3D, 0x07, 0xC0, 0xF8, 0x2F, 0x9F, 0xC0, 0x7F, 0xFE, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x2F, 0x80, 0x07, 0xEF, 0xC0, 0x3C, 0x0F, 0x02, 0xC0, 0x2C, 0x0F, 0x00, 0xF0, 0x3C,
-    0x1F, 0xC0, 0xBF, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x0B, 0xC0, 0xFF, 0xFC, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xF4, 0x07, 0xF8,
-    0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x7F, 0xF0, 0x02, 0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x03,
-    0xDB, 0x80, 0x3C, 0x0F, 0x01, 0xE6, 0x3C, 0x0F, 0x7C, 0xF0, 0x3D, 0xFB, 0x81, 0xF3, 0x7D, 0x0B,
-    0xC1, 0xF0, 0x2F, 0x6F, 0x80, 0xBF, 0xFC, 0x01, 0xFF, 0xD0, 0x01, 0xF9, 0x00, 0x00, 0x05, 0x40,
-    0x1F, 0xD0, 0x0F, 0xF0, 0x02, 0xBC, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x02, 0xF0, 0x00,
-    0xF8, 0x02, 0xBE, 0x92, 0xFF, 0xF8, 0xFF, 0xFD, 0x00, 0x6F, 0xD0, 0x00, 0xFF, 0xF4, 0x01, 0xD0,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x80,
-    0x03, 0xFE, 0x00, 0x0F, 0xFD, 0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0x6A, 0x00, 0x0F,
-    0xFF, 0x40, 0x10, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x07, 0xD0, 0x07, 0xFD, 0x00, 0x3F, 0xF4, 0x00,
-    0x02, 0xF0, 0x14, 0x1F, 0x80, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x03, 0xBC, 0x00, 0xE7, 0x80, 0x38, 0xB4, 0x0F, 0x5F, 0x93, 0xFF,
-    0xFD, 0x2A, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x01, 0xAA, 0x90, 0x3F, 0xFD,
-    0x03, 0x80, 0x00, 0x74, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x24,
-    0x2F, 0x03, 0xFF, 0xF0, 0x7F, 0xFC, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0xC0, 0x3D,
-    0x00, 0x01, 0xD0, 0x00, 0x0F, 0xBE, 0x00, 0x7F, 0xFE, 0x02, 0xF8, 0xBC, 0x0F, 0x81, 0xF0, 0x3D,
-    0x07, 0xC0, 0xF9, 0xBD, 0x03, 0xFF, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xF4, 0x00,
-    0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x01, 0x50, 0x00, 0x00, 0x05, 0x40, 0x02, 0xFF, 0x80, 0x2F, 0x0F,
-    0x00, 0xF0, 0x3C, 0x03, 0xC2, 0xF0, 0x0B, 0xFF, 0x00, 0x2F, 0xF8, 0x07, 0xD0, 0xF4, 0x3E, 0x03,
-    0xD0, 0xFE, 0xBF, 0x03, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x1A, 0x40, 0x07, 0xFF, 0x40, 0x3C,
-    0x1F, 0x02, 0xC0, 0x3C, 0x0E, 0x00, 0xF0, 0x38, 0x1F, 0x80, 0xFF, 0xFD, 0x00, 0xFF, 0xF0, 0x00,
-    0x07, 0xC0, 0x94, 0x7D, 0x03, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x6B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xAF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0xFE, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFA, 0xF8, 0x7F, 0x00, 0x00, 0x01, 0xFF,
-    0xF3, 0xF0, 0xBD, 0x00, 0x00, 0x03, 0xFF, 0xD7, 0xE0, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xCF, 0xD2,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x9F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0x47, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x3F, 0x46, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x7F, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xEA, 0xAF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xF7, 0xF0, 0x00, 0x1F, 0xFF, 0x00,
-    0x7F, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-    0x3F, 0x46, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x0A, 0x80, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x05, 0x7F, 0x95, 0x55, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF0, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x1F, 0xF9, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0x47, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
-    0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x57, 0xFE, 0x55, 0x5F,
-    0xFD, 0x50, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xD5, 0x6F, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF9, 0x57, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xC0,
-    0x00, 0x01, 0xFF, 0x90, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x07, 0xF0, 0x0B,
-    0xF8, 0x00, 0x01, 0xFE, 0xBF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x04, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x03, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xE0, 0x0F, 0xF0, 0x3F, 0xF0, 0x1F,
-    0xF4, 0x00, 0x0B, 0xFA, 0xFF, 0xC1, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x0B, 0xFE,
-    0x03, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x55, 0x40, 0x15, 0x50, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x54, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x7F, 0xF4, 0xFE, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0xD3, 0xF0, 0x00,
-    0x00, 0x2F, 0xCF, 0xFF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x7F, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0xBF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD2, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x95, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xF8, 0x03, 0xFF, 0xE5, 0xBF, 0xD0, 0x1F, 0xD0, 0x0F, 0xF8, 0x00, 0x3F, 0x80,
-    0xBF, 0x00, 0x7F, 0x80, 0x00, 0xBD, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x02, 0xF4, 0x0F, 0xD0, 0x0F,
-    0xD1, 0x94, 0x0F, 0xD0, 0x7F, 0x00, 0x3F, 0x0B, 0xF0, 0x3F, 0x03, 0xFC, 0x01, 0xFC, 0x3F, 0xC1,
-    0xFC, 0x0F, 0xE0, 0x0B, 0xE0, 0xFE, 0x0B, 0xE0, 0x7F, 0x40, 0x3F, 0x47, 0xF4, 0x3F, 0x42, 0xFC,
-    0x00, 0xFC, 0x2F, 0xC0, 0x58, 0x0F, 0xF0, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0x83,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0xFD, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x07, 0xF0, 0x2F, 0xFE, 0x57,
-    0xFF, 0xC0, 0x2F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x56, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x1A, 0xBF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE6, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x97,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0x96, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0x80, 0x14, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xAF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x06, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0x95, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x10, 0x00,
-    0x00, 0x00, 0xFF, 0xD6, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x09, 0x00, 0x00,
-    0x09, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBA, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x42, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0x55, 0xFF, 0x95, 0x6F, 0xFD, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x6B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xA9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFB, 0xF0, 0x00, 0x50, 0x03, 0xFF, 0xF4, 0xBF, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x1F,
-    0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xF4, 0x03, 0xFE, 0x94, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0, 0x0F, 0xFB, 0xFF, 0xFE,
-    0x0F, 0xFF, 0x00, 0xFE, 0x03, 0xFF, 0xD0, 0xFF, 0xF8, 0x1F, 0xD0, 0xBF, 0xC0, 0x0F, 0xFF, 0xF6,
-    0xFD, 0x6F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0xFF, 0xD5, 0x55, 0x54, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE5, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0xAC, 0x02, 0xFF, 0xBF, 0x00, 0x07, 0xFD, 0xBF, 0x00, 0x0F, 0xF8, 0xFE, 0x00, 0x0F, 0xF0, 0xFD,
-    0x00, 0x2F, 0xF1, 0xFC, 0x00, 0x2F, 0xE2, 0xFC, 0x00, 0x3F, 0xE3, 0xF8, 0x00, 0x3F, 0xF3, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x15, 0x40, 0xBF, 0xE0, 0x15, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xAB, 0xFF, 0xAA, 0x40, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x10, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x08, 0x00, 0x00, 0xBF,
-    0x8B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x2E, 0x00, 0x2F, 0xFF, 0xEF, 0xF4, 0x00, 0xFB,
-    0xFF, 0xFF, 0xC0, 0x01, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x93, 0xA4, 0xBF, 0xFF, 0x90,
-    0x2F, 0xC3, 0xFF, 0xF8, 0x03, 0xFE, 0x0F, 0xEF, 0xD0, 0xBF, 0xF0, 0x60, 0x7F, 0x2F, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x7F,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x40, 0x00, 0x7F, 0xDF, 0xE2, 0xFD, 0x00, 0x02, 0xFF, 0x3F,
-    0x4B, 0xF0, 0x00, 0x0F, 0xF5, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xCB, 0xF0, 0xFE, 0x00, 0x01, 0xFD,
-    0x3F, 0x87, 0xF4, 0x00, 0x0B, 0xF0, 0xFD, 0x2F, 0xC0, 0x00, 0x3F, 0xC7, 0xF0, 0xFF, 0x00, 0x00,
-    0xFE, 0x2F, 0xC3, 0xF8, 0x00, 0x07, 0xF4, 0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xC3, 0xF4, 0xFF, 0x00,
-    0x00, 0xFF, 0x1F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0xBF, 0x2F, 0xD0, 0x00, 0x1F, 0xF3, 0xFC, 0xFF,
-    0x40, 0x00, 0x05, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x6F, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x56, 0xFF, 0xF5, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0x00, 0x3F, 0xC0, 0x01,
-    0xBF, 0x00, 0xFF, 0x01, 0xBF, 0xFF, 0x02, 0xFE, 0xBF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF9,
-    0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFE, 0xBF, 0x7F, 0xF8, 0x1F, 0xFD, 0x3F, 0xC7,
-    0xFF, 0x4F, 0xFC, 0x0F, 0xE0, 0x7F, 0xC1, 0xF4, 0x07, 0xF4, 0x07, 0x80, 0x10, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x01, 0xFD, 0x00, 0x7F, 0xFE,
-    0x40, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0x80,
-    0x3F, 0xC0, 0x18, 0x03, 0xFC, 0x0B, 0xF4, 0x1F, 0xC0, 0xFF, 0xE1, 0xFE, 0x0F, 0xFC, 0x0B, 0xFF,
-    0x3F, 0xCF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x1B, 0xFF, 0x90, 0x0B, 0xE0, 0x00,
-    0x1F, 0xC6, 0xFF, 0xFF, 0xFF, 0xE4, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x83, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xEF, 0xEF, 0xF0, 0xFF, 0x8B, 0xD3, 0xFE, 0x3F, 0x43, 0xF0,
-    0x3F, 0x07, 0x00, 0xFC, 0x02, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xB8, 0x0F, 0xC0,
-    0x70, 0x7F, 0xC3, 0xF4, 0x7F, 0x47, 0xFD, 0xBE, 0x7F, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x16, 0xFF, 0xF8, 0x01, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0xFA, 0x40, 0xBF, 0xFF, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xC7, 0xFF, 0xF4, 0x00, 0xFF, 0x02,
-    0xFF, 0xF8, 0x03, 0xFC, 0x00, 0xBF, 0xFE, 0x0F, 0xF0, 0x00, 0x3F, 0xFE, 0x3F, 0xC0, 0x00, 0x1F,
-    0xE0, 0xFA, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x6F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x87, 0xFC, 0x01, 0xFF, 0xFD, 0x07, 0xFC, 0x0F, 0xFF, 0xD0, 0x07, 0xFC, 0x3F, 0xFE, 0x00,
-    0x0B, 0xF8, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x03, 0x40, 0x00, 0x06, 0xF8, 0x01, 0x40, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x01, 0xF8,
-    0x07, 0xFC, 0x02, 0xFC, 0x03, 0xFD, 0x03, 0xF8, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0xFF, 0x47, 0xF0,
-    0x00, 0x7F, 0x8B, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0,
-    0x14, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0x00, 0x3F, 0xD0,
-    0x3F, 0x00, 0x7F, 0xC0, 0x3F, 0x40, 0xFF, 0x40, 0x2F, 0x81, 0xFF, 0x00, 0x1F, 0xC2, 0xFD, 0x00,
-    0x0F, 0xC3, 0xFC, 0x00, 0x0F, 0xDB, 0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xC0, 0x14, 0x03, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xE2, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x8B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD3,
-    0xFB, 0xFF, 0x40, 0xFF, 0xE3, 0xF1, 0xFC, 0x7F, 0xF0, 0xFF, 0xD1, 0xFC, 0xBF, 0x0B, 0xFD, 0x3F,
-    0xC0, 0xBE, 0x3F, 0x80, 0xFD, 0x07, 0xC0, 0x3F, 0x4F, 0xD0, 0x1D, 0x00, 0x40, 0x0F, 0xC7, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00,
-    0x01, 0x40, 0x2F, 0x8F, 0xE0, 0x00, 0x00, 0xF8, 0x07, 0xF1, 0xFC, 0x03, 0xC0, 0xBF, 0xC0, 0xFC,
-    0x3F, 0x02, 0xFD, 0x1F, 0xFC, 0x2F, 0x4F, 0xD1, 0xFF, 0xC0, 0xFF, 0xD7, 0xE2, 0xF8, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x7F, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD3,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x9F, 0xFF, 0xFC, 0x03, 0xFF, 0x1F, 0xAF,
-    0xF4, 0x0F, 0xFF, 0x1F, 0x42, 0xD0, 0x3F, 0xFF, 0x1F, 0x40, 0x00, 0xFF, 0xFF, 0x1F, 0x40, 0x00,
-    0x7F, 0xBF, 0x1F, 0x40, 0x00, 0x01, 0x3F, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x00,
-    0x3F, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x00, 0x3F,
-    0x1F, 0x40, 0x00, 0x01, 0x3F, 0x1F, 0x40, 0x00, 0x7F, 0xBF, 0x1F, 0x40, 0x00, 0xFF, 0xFF, 0x1F,
-    0x40, 0x00, 0x3F, 0xFF, 0x1F, 0x40, 0x00, 0x0F, 0xFF, 0x1F, 0x42, 0xD0, 0x03, 0xFF, 0x1F, 0xAF,
-    0xF4, 0x00, 0xFF, 0x9F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x40,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xBE, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x4F, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xE0, 0x00,
-    0xBF, 0xD0, 0x07, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFD, 0x02, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD,
-    0x2F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0xBF, 0xD0, 0xBF, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFD, 0x02,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x0F, 0xFD, 0x00, 0x07, 0xFE, 0x0B, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0x2F, 0xF4, 0xBF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x51, 0x6F, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE0,
-    0x1B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0,
-    0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF8,
-    0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x00, 0x00,
-    0x2F, 0xFC, 0x1F, 0xFF, 0x55, 0x55, 0x7F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x6F, 0xFE, 0xAB, 0xFF, 0xA8, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00,
-    0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x03, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x02, 0xFE,
-    0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x15, 0x50, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xF8,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00,
-    0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xF8,
-    0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA, 0xAA, 0xA4, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xAA, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0xAF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFE, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x40, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF9, 0x07, 0xFF, 0xD0, 0x7F, 0x00,
-    0xFF, 0x80, 0x03, 0xF8, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x2F, 0xC0, 0x00,
-    0x3C, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x02, 0xF8, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFD, 0x01,
-    0xFE, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-    0x7F, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00,
-    0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x02, 0xA0, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xC0,
-    0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x00, 0xFF, 0x4B, 0xF4, 0xFF, 0x40, 0x2F, 0xF0, 0x3F, 0xFF, 0xE0,
-    0x00, 0xFF, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x2A, 0x00, 0x02, 0xFF, 0xFC, 0x07, 0xF8, 0x00, 0xBF, 0xFF, 0xF0, 0xFF,
-    0x40, 0x1F, 0xF0, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x0A, 0xE0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x07, 0xEA, 0xBF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x2F, 0xFF, 0xFA,
-    0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x5A, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAB, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x15,
-    0xA8, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFF, 0xFC, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xA5, 0x40, 0x00, 0x3F, 0xEA,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_bolditalicBitmaps[45400] = {
+    0x85, 0x55, 0xB1, 0x8E, 0xD6, 0x48, 0x0C, 0x76, 0x12, 0xC4, 0x48, 0x44, 0x28, 0x15, 0x0D, 0x14,
+    0x69, 0xAE, 0xA0, 0x9B, 0xE6, 0x4A, 0xD8, 0x09, 0xF0, 0x00, 0x50, 0xB0, 0x15, 0x8F, 0xC0, 0x2B,
+    0x9C, 0x94, 0x48, 0x3C, 0xC2, 0x95, 0xD7, 0x5C, 0x7D, 0x3C, 0x03, 0x64, 0x56, 0x94, 0x34, 0x79,
+    0x84, 0x20, 0xD1, 0xD0, 0x4D, 0x11, 0x89, 0x80, 0x26, 0x31, 0xFE, 0x3C, 0x93, 0x5D, 0xFE, 0x83,
+    0x85, 0x68, 0xED, 0xC9, 0x4E, 0x66, 0x6C, 0x7F, 0xF6, 0x67, 0xFF, 0x44, 0xFA, 0xFC, 0x29, 0xF2,
+    0x97, 0xC8, 0x5B, 0x91, 0x9D, 0xA8, 0xD8, 0x88, 0xAA, 0x98, 0xC4, 0xAC, 0x44, 0xCD, 0x22, 0x12,
+    0x88, 0xEC, 0x4C, 0xE4, 0x26, 0xA2, 0xDE, 0x13, 0x8D, 0x22, 0x3C, 0x50, 0xC1, 0x44, 0xA5, 0x48,
+    0x25, 0xD7, 0x2A, 0xB9, 0x46, 0x72, 0x85, 0x1E, 0x88, 0xDC, 0xA0, 0xEB, 0x9E, 0x82, 0x3D, 0x55,
+    0x22, 0x46, 0xA4, 0x51, 0x19, 0xC8, 0x72, 0x47, 0x4E, 0x64, 0x14, 0x53, 0x8E, 0x0D, 0xCF, 0x8E,
+    0x2B, 0x9E, 0x2C, 0x54, 0xBB, 0x97, 0x3C, 0x35, 0x5C, 0x40, 0x11, 0xCF, 0x35, 0x77, 0x1C, 0x0C,
+    0x0F, 0xBC, 0x88, 0x8D, 0x71, 0x95, 0x03, 0x3D, 0x5C, 0x4A, 0xD8, 0x63, 0x87, 0xB5, 0xDC, 0x88,
+    0xD5, 0x4D, 0x15, 0x8B, 0xF4, 0x52, 0xAF, 0x1A, 0x18, 0x60, 0x54, 0x7A, 0x94, 0xDA, 0x50, 0xAF,
+    0xFA, 0xE2, 0x66, 0x40, 0x93, 0x08, 0xF4, 0x89, 0xD4, 0xA6, 0x97, 0x45, 0x62, 0xD0, 0x67, 0x96,
+    0x80, 0xF4, 0x11, 0xB0, 0x15, 0x03, 0x2F, 0x0C, 0xEF, 0x05, 0xAB, 0xAB, 0x3A, 0x96, 0xC9, 0x43,
+    0x13, 0x01, 0x1F, 0x86, 0x57, 0x93, 0x5C, 0xB9, 0xA5, 0x81, 0xAB, 0x2A, 0xDD, 0xDE, 0xA8, 0xBE,
+    0xDE, 0x83, 0x1C, 0xEA, 0x60, 0x5F, 0x52, 0x2D, 0x1E, 0xF4, 0xA5, 0x16, 0xC8, 0xEA, 0xA1, 0xD9,
+    0xAA, 0xE4, 0xC1, 0x46, 0x93, 0x5E, 0xDC, 0x5A, 0x6F, 0x97, 0x99, 0xBC, 0x93, 0x81, 0xA6, 0x20,
+    0x66, 0x5D, 0xFA, 0x94, 0x05, 0xDD, 0xBB, 0xCB, 0x5F, 0x60, 0x4D, 0xDC, 0x20, 0xEB, 0xCC, 0x52,
+    0xC2, 0x36, 0xFF, 0xB3, 0xB9, 0x8F, 0xC0, 0xDD, 0x21, 0xEE, 0x3E, 0x54, 0x0B, 0xAA, 0x38, 0xB4,
+    0x1E, 0x7B, 0x34, 0xC2, 0x0F, 0xFF, 0x8D, 0x14, 0x09, 0x7C, 0xA9, 0x37, 0xA5, 0x40, 0x0B, 0x0D,
+    0x5C, 0xCE, 0xA7, 0xE5, 0xA6, 0x1A, 0xC4, 0xAE, 0x4F, 0x5E, 0xA8, 0x18, 0xE4, 0x5E, 0x24, 0xBB,
+    0xC8, 0x85, 0xB9, 0x64, 0x7E, 0x2D, 0x7B, 0x8A, 0x73, 0x49, 0x89, 0xE8, 0x4A, 0x68, 0x31, 0xF8,
+    0x42, 0xED, 0xC1, 0x14, 0x5D, 0x45, 0x7B, 0x20, 0x70, 0x8A, 0xA0, 0x88, 0x07, 0xCA, 0x5B, 0xFF,
+    0x7E, 0x77, 0xD4, 0x2C, 0x84, 0x14, 0xF7, 0x03, 0x8D, 0x1B, 0x55, 0x2B, 0xD5, 0x73, 0x24, 0xE7,
+    0xE9, 0xAC, 0x0C, 0x92, 0x86, 0x32, 0xD4, 0xDE, 0x4E, 0xD4, 0x0C, 0x67, 0xC2, 0x02, 0x72, 0x55,
+    0x00, 0x61, 0x99, 0x2F, 0x76, 0xA0, 0x8B, 0x6D, 0x40, 0xAE, 0x07, 0xCD, 0xE3, 0xB3, 0x66, 0x19,
+    0x51, 0x4C, 0x7E, 0x8A, 0x9A, 0xD6, 0xEB, 0x66, 0x01, 0xF6, 0xBD, 0x7F, 0x88, 0xAA, 0x9E, 0x91,
+    0xC0, 0xEB, 0x2F, 0x82, 0x11, 0x8E, 0x6E, 0xC6, 0x3B, 0x90, 0xDE, 0xFE, 0xB3, 0x80, 0xE3, 0xBD,
+    0x60, 0x75, 0x81, 0x04, 0x24, 0x4A, 0x2F, 0x8C, 0xB3, 0xE1, 0x67, 0x0C, 0x1F, 0x91, 0x3B, 0xCB,
+    0x68, 0xA1, 0x0D, 0xE0, 0xAC, 0x47, 0x86, 0x23, 0x99, 0x89, 0x4C, 0x20, 0xDB, 0x51, 0xEB, 0xB1,
+    0xED, 0x3A, 0x87, 0x00, 0x6B, 0xD6, 0x14, 0x07, 0x44, 0xB9, 0xE9, 0xC5, 0x01, 0x91, 0x6E, 0x5A,
+    0x06, 0xA1, 0xF3, 0x63, 0x7E, 0x15, 0xAB, 0x28, 0x24, 0x8B, 0x76, 0x1E, 0x27, 0xB3, 0x4B, 0x57,
+    0x74, 0x86, 0x57, 0xA9, 0x5E, 0xCB, 0x83, 0x53, 0x7E, 0x8D, 0x4A, 0xAE, 0x94, 0x5D, 0xE6, 0xFD,
+    0xB6, 0xC4, 0xF6, 0xB5, 0x3B, 0xC2, 0x19, 0xB7, 0x96, 0x9F, 0xB0, 0xE7, 0x00, 0x16, 0x49, 0xF7,
+    0xB8, 0x58, 0xF3, 0xA3, 0x5C, 0x00, 0xA4, 0xF4, 0x23, 0x98, 0xAB, 0x85, 0xC5, 0x5E, 0x72, 0xAE,
+    0xAC, 0x46, 0x2C, 0x57, 0xFB, 0x3E, 0x75, 0xBA, 0xE6, 0x3F, 0x7D, 0xD4, 0x4B, 0x80, 0xA0, 0x13,
+    0x41, 0x6F, 0x6A, 0xCF, 0xE9, 0x31, 0x6D, 0x09, 0x13, 0x0F, 0x55, 0x43, 0x35, 0x2B, 0xA5, 0x69,
+    0x92, 0x14, 0x2A, 0xF2, 0x83, 0x5A, 0x2E, 0xD5, 0x7A, 0xF8, 0xB9, 0x52, 0xF5, 0x9E, 0xFA, 0x24,
+    0x87, 0x58, 0xA1, 0x4D, 0x8A, 0x97, 0x3E, 0x23, 0xB9, 0x87, 0x17, 0xAD, 0x48, 0xEE, 0x3E, 0xCA,
+    0x71, 0x27, 0x04, 0x8A, 0x25, 0x7D, 0xD9, 0x95, 0xB8, 0xC8, 0x10, 0xE6, 0x58, 0xC2, 0x90, 0x2E,
+    0xAE, 0x47, 0xC0, 0xF9, 0x8C, 0x9A, 0xE8, 0x32, 0xBA, 0x84, 0xD3, 0xA9, 0x9A, 0x4E, 0xEE, 0xD9,
+    0x70, 0x0D, 0x9E, 0xAB, 0xAF, 0xEE, 0x52, 0xF5, 0x50, 0xA3, 0x26, 0x75, 0xCA, 0x11, 0x16, 0x69,
+    0xC4, 0x20, 0xF7, 0x9F, 0x72, 0x67, 0xA3, 0x93, 0x5B, 0xFF, 0x47, 0x53, 0x87, 0x37, 0xCD, 0xE7,
+    0x2F, 0x8C, 0x21, 0x75, 0x21, 0xB5, 0x95, 0xBE, 0x8B, 0x68, 0xBA, 0xC9, 0xC8, 0xC6, 0x53, 0x6C,
+    0xEE, 0xBD, 0xF5, 0x0F, 0xAD, 0xF7, 0x37, 0x30, 0xA3, 0x41, 0x34, 0xD2, 0xD2, 0xBF, 0x14, 0x2D,
+    0xDD, 0xA0, 0x93, 0x1B, 0x33, 0xA2, 0x00, 0x20, 0xD6, 0x99, 0x14, 0x40, 0x17, 0x69, 0xE3, 0xFD,
+    0xEE, 0x6B, 0xFE, 0x8F, 0x74, 0x60, 0x4A, 0x47, 0x9D, 0x9C, 0xA6, 0xE7, 0x4A, 0x3F, 0x4C, 0x67,
+    0x19, 0xD4, 0x25, 0x78, 0x15, 0xA8, 0x97, 0xB9, 0x15, 0xF1, 0xD7, 0xEE, 0x18, 0x14, 0x74, 0xE7,
+    0xFC, 0xFC, 0x1C, 0x71, 0xBD, 0x13, 0xF9, 0xA0, 0xD3, 0xE1, 0xBC, 0xDA, 0xCD, 0xDE, 0x6C, 0xED,
+    0x66, 0xA3, 0x3B, 0x3A, 0xB8, 0x38, 0x88, 0x96, 0xEB, 0xD4, 0xE6, 0x35, 0xF7, 0xBB, 0xBA, 0xD4,
+    0xEF, 0x69, 0x28, 0x1F, 0x03, 0x2D, 0x05, 0xAC, 0xF9, 0x3F, 0x88, 0x9C, 0x29, 0xED, 0xB2, 0x01,
+    0xAD, 0xC1, 0x91, 0xE8, 0x83, 0x54, 0x3F, 0x31, 0x54, 0xFE, 0x60, 0x68, 0x48, 0x6B, 0xFF, 0x1B,
+    0x43, 0x75, 0x36, 0x90, 0x7F, 0x40, 0x2E, 0x0D, 0x15, 0x87, 0x21, 0xFE, 0xBF, 0xA1, 0x0C, 0xC9,
+    0xFE, 0xC6, 0x50, 0x1E, 0xEB, 0x99, 0x83, 0x07, 0x4B, 0x7F, 0x65, 0x68, 0x3D, 0x35, 0x64, 0xF6,
+    0xEB, 0x0C, 0x0D, 0xA7, 0xB9, 0x3A, 0xCB, 0x91, 0xDE, 0xCF, 0xEB, 0xE9, 0xEF, 0xF2, 0x37, 0x9D,
+    0x55, 0x31, 0x8E, 0xE4, 0x54, 0x10, 0x7D, 0x6E, 0x6B, 0xA6, 0x85, 0x2C, 0xAD, 0x49, 0x26, 0x60,
+    0x27, 0xF8, 0x07, 0x58, 0x24, 0x5F, 0x00, 0xE9, 0xFB, 0x08, 0x13, 0x20, 0x21, 0x41, 0x40, 0x42,
+    0x34, 0x04, 0x73, 0x01, 0x24, 0x5B, 0xE2, 0x00, 0xDB, 0x04, 0x44, 0xA4, 0x04, 0xCC, 0x6C, 0x30,
+    0x1C, 0x00, 0xC9, 0x96, 0x08, 0x48, 0x9B, 0xDD, 0x03, 0xD0, 0x48, 0x4B, 0xB0, 0x44, 0x06, 0x19,
+    0xC9, 0x8B, 0x6C, 0x17, 0xEF, 0xD5, 0xEF, 0x69, 0x40, 0x40, 0xC2, 0x97, 0xFC, 0xDD, 0xB6, 0xEB,
+    0x57, 0xBD, 0x7A, 0xF5, 0xAA, 0x1A, 0xD8, 0xDC, 0x02, 0x08, 0x36, 0x00, 0x95, 0x19, 0xB7, 0xB1,
+    0x3A, 0x20, 0x0C, 0xF9, 0x8C, 0x72, 0x44, 0x87, 0x62, 0x7A, 0xB3, 0xEA, 0xF3, 0x39, 0x96, 0xC3,
+    0xC6, 0xE2, 0xB7, 0x33, 0xEC, 0xE9, 0x60, 0x68, 0xBE, 0x9B, 0xBB, 0xBE, 0xFA, 0xD5, 0xE2, 0xA1,
+    0x9C, 0xBA, 0x0F, 0xC7, 0x7C, 0x2D, 0x9F, 0xCE, 0x99, 0xB5, 0xDB, 0x15, 0xCD, 0x21, 0xB7, 0xBA,
+    0x5A, 0xB6, 0xD6, 0x17, 0x66, 0xB6, 0xCF, 0xB8, 0x0D, 0x68, 0xCC, 0x46, 0x94, 0x66, 0x13, 0x36,
+    0xDA, 0x18, 0x67, 0x04, 0xB2, 0x6E, 0x87, 0xE3, 0x2A, 0x66, 0x64, 0x36, 0x23, 0xE7, 0xB7, 0xC2,
+    0x2D, 0x07, 0x3C, 0x22, 0x08, 0xC4, 0x3D, 0xD0, 0xF4, 0x40, 0xC7, 0xCB, 0x5A, 0xDA, 0xD4, 0x74,
+    0x00, 0xDA, 0xF1, 0x5A, 0x79, 0x6C, 0x01, 0xCA, 0xD9, 0xAF, 0x60, 0x36, 0xC7, 0xE3, 0xC5, 0x68,
+    0x53, 0xA7, 0x88, 0xB8, 0x5C, 0x6B, 0x1E, 0xA2, 0x67, 0x10, 0x46, 0x8F, 0xA8, 0x97, 0xE1, 0x25,
+    0x51, 0x16, 0xB5, 0xFB, 0x84, 0x82, 0xA0, 0x9C, 0x90, 0xFC, 0xA0, 0x58, 0xB5, 0x99, 0x1E, 0x19,
+    0x8A, 0x30, 0x5B, 0xC6, 0xF7, 0xC0, 0xDC, 0x08, 0xBD, 0x66, 0x68, 0xC7, 0xA0, 0xA4, 0x4C, 0xA9,
+    0x30, 0xCE, 0x2A, 0xBF, 0x56, 0x07, 0x0F, 0x01, 0x7C, 0xCC, 0x98, 0xFC, 0xB6, 0xE8, 0xA4, 0x62,
+    0xFE, 0x7C, 0x3F, 0xE1, 0x0D, 0xBE, 0x51, 0x9E, 0x51, 0x06, 0xA5, 0x62, 0x16, 0xA3, 0x38, 0x9F,
+    0x65, 0xC4, 0x2D, 0x8A, 0x94, 0x60, 0x4A, 0x89, 0x9C, 0x09, 0x97, 0xD0, 0xE4, 0x7E, 0xC6, 0xDA,
+    0xCD, 0x2E, 0xE3, 0x4B, 0x8F, 0xD9, 0x29, 0x66, 0xA3, 0x8C, 0xA2, 0x42, 0x94, 0x1E, 0xE7, 0xC6,
+    0x5E, 0xE2, 0xB4, 0x02, 0x8F, 0x67, 0x76, 0x74, 0x9E, 0xA9, 0xA8, 0xC1, 0x13, 0xA0, 0x5D, 0xF8,
+    0x61, 0x40, 0xB6, 0x10, 0x43, 0x78, 0xBE, 0x22, 0x5B, 0x59, 0xDD, 0x70, 0x88, 0x7D, 0xB6, 0x92,
+    0xD2, 0xF0, 0xDB, 0xCD, 0xFA, 0x19, 0x23, 0x98, 0x8A, 0x26, 0x12, 0xED, 0xF0, 0xFE, 0x5D, 0x67,
+    0x62, 0xAF, 0x3D, 0xD2, 0x12, 0x55, 0x32, 0x65, 0xE8, 0xFC, 0x9C, 0x16, 0x09, 0x31, 0x6C, 0xC5,
+    0x82, 0x83, 0x29, 0x7F, 0xBF, 0xFB, 0xCA, 0x31, 0xA0, 0xEA, 0x1F, 0x12, 0x8E, 0x74, 0x41, 0xE4,
+    0x3B, 0xD1, 0xB2, 0x7A, 0x29, 0x5A, 0xC9, 0xA2, 0xCF, 0xAE, 0xD0, 0xC8, 0x32, 0x8A, 0x90, 0x66,
+    0x9F, 0xF1, 0x53, 0xBF, 0xDD, 0x15, 0xD6, 0x97, 0x0F, 0x7C, 0x4A, 0x90, 0x9E, 0xAA, 0x4B, 0xA8,
+    0xC6, 0xF9, 0x31, 0xD3, 0x1B, 0xE1, 0xE8, 0x12, 0x73, 0x04, 0x58, 0xAA, 0xAE, 0xB9, 0x2A, 0x06,
+    0xDF, 0x82, 0x1C, 0xE6, 0xA2, 0x10, 0xCD, 0x17, 0xAF, 0x55, 0x4C, 0x93, 0xC0, 0x98, 0x94, 0x1C,
+    0x1A, 0x4D, 0x87, 0x6A, 0x42, 0x9C, 0xE0, 0x8A, 0x65, 0xF9, 0x3B, 0xD2, 0x5B, 0x53, 0x84, 0x61,
+    0x10, 0x04, 0xCA, 0xC3, 0x9E, 0x91, 0x71, 0x27, 0x3B, 0x77, 0xCC, 0x41, 0x61, 0x50, 0xA9, 0xB4,
+    0x70, 0x75, 0x98, 0xBD, 0xE0, 0xF5, 0x8B, 0x34, 0x70, 0xFD, 0x4C, 0x40, 0xA4, 0x47, 0xE9, 0x13,
+    0x82, 0xA6, 0xB4, 0xA2, 0xFA, 0x69, 0x4A, 0xC2, 0x12, 0x81, 0xB9, 0xAB, 0xA7, 0x87, 0x6A, 0x09,
+    0xD5, 0xA5, 0xE1, 0xC7, 0x38, 0x4B, 0x65, 0x49, 0x6E, 0x4C, 0x9C, 0x06, 0x82, 0x4E, 0x81, 0x1D,
+    0x9C, 0xD9, 0xBD, 0xA3, 0x16, 0xF7, 0x2C, 0x56, 0x41, 0x9C, 0x35, 0x75, 0xA4, 0xBA, 0x0D, 0x2C,
+    0x31, 0xA3, 0x75, 0x87, 0x94, 0x1B, 0x69, 0xF0, 0xF0, 0x49, 0xA5, 0xE2, 0x78, 0x5F, 0x8D, 0x42,
+    0x60, 0x2D, 0x7B, 0x84, 0x09, 0xD2, 0xB5, 0xB5, 0x44, 0x52, 0x8D, 0x99, 0x1D, 0x82, 0x29, 0x1F,
+    0x86, 0x50, 0xAD, 0xA5, 0x38, 0xF3, 0xCE, 0x67, 0x82, 0x4F, 0x52, 0x82, 0xE7, 0xFA, 0xBD, 0x3D,
+    0x2A, 0x5D, 0x42, 0xFE, 0xA9, 0x1B, 0x9C, 0x1B, 0x91, 0x5A, 0x0C, 0x88, 0xD0, 0x5C, 0x38, 0xE8,
+    0xE7, 0x22, 0x65, 0x97, 0x3D, 0x2A, 0xFD, 0x64, 0x9A, 0xE5, 0xEB, 0x0F, 0x92, 0x56, 0x67, 0x39,
+    0x60, 0xD8, 0x90, 0x1A, 0x7E, 0x75, 0xD1, 0xD0, 0x8A, 0x8E, 0x69, 0xF8, 0xEA, 0x3D, 0x21, 0x52,
+    0x5D, 0x83, 0x22, 0x48, 0x44, 0x35, 0x1E, 0xDB, 0x03, 0xBF, 0x34, 0x5A, 0xDD, 0xDB, 0x82, 0x6A,
+    0x11, 0x49, 0x1D, 0xE7, 0xCE, 0x8C, 0x7F, 0xAC, 0x8D, 0xD5, 0x6C, 0x12, 0x0A, 0xB2, 0x54, 0x4A,
+    0x88, 0x1C, 0x3F, 0xEB, 0xE9, 0x3C, 0x49, 0x40, 0x58, 0x9C, 0xF3, 0x38, 0x3B, 0xBB, 0xFF, 0xE6,
+    0x42, 0xEB, 0xFA, 0x36, 0x7D, 0x9E, 0xE4, 0x47, 0xF5, 0x71, 0xFB, 0x5A, 0x55, 0x8A, 0x0B, 0xF3,
+    0x68, 0x71, 0x71, 0x95, 0x2C, 0xFD, 0xB6, 0xF5, 0x1A, 0x35, 0x9E, 0x8B, 0xA6, 0x0C, 0xB5, 0x39,
+    0x3A, 0x5F, 0xED, 0xB1, 0x9D, 0xB7, 0xDE, 0xC4, 0x8D, 0xA8, 0xE3, 0x2E, 0xEB, 0x28, 0xF5, 0x4B,
+    0xAC, 0x3B, 0x1F, 0x0B, 0xBC, 0x9D, 0x75, 0x7E, 0x3B, 0x77, 0x12, 0x74, 0x9B, 0x7C, 0xF4, 0x38,
+    0xC2, 0xCB, 0x84, 0xF3, 0x2D, 0x5C, 0x5C, 0xDF, 0x1F, 0xBC, 0xB7, 0x64, 0xA5, 0xAE, 0xCC, 0xDE,
+    0xFD, 0x13, 0xF5, 0x05, 0x9E, 0xF0, 0xAD, 0xCA, 0xE7, 0x43, 0x36, 0xAE, 0x77, 0x9F, 0x03, 0x67,
+    0x69, 0x9E, 0xEE, 0x5D, 0xA5, 0x8B, 0x0F, 0x04, 0x1F, 0x28, 0xC1, 0xC1, 0x6C, 0xD2, 0x74, 0x89,
+    0xFE, 0x90, 0x50, 0x1E, 0x61, 0x16, 0xBE, 0x9F, 0x2B, 0xFE, 0xB9, 0x8A, 0x27, 0x5C, 0x8B, 0xB6,
+    0xF5, 0xAA, 0x74, 0xA0, 0xC1, 0xB1, 0xC7, 0x94, 0x8D, 0x77, 0xE1, 0x47, 0x7F, 0xE3, 0xF0, 0xF1,
+    0xCE, 0x7D, 0x79, 0xDE, 0x24, 0xA2, 0x4A, 0x65, 0xDD, 0xB1, 0xE2, 0xA1, 0x55, 0x57, 0xEE, 0xD2,
+    0xC8, 0x93, 0x84, 0x21, 0x09, 0xE3, 0x38, 0x12, 0x5D, 0x12, 0xB9, 0x23, 0xF5, 0xF1, 0xA9, 0x31,
+    0x83, 0x9B, 0xD5, 0x27, 0x86, 0x5A, 0x4E, 0x1E, 0x53, 0x57, 0x34, 0xE3, 0xC3, 0x70, 0x86, 0x3F,
+    0x87, 0x94, 0xD1, 0x69, 0xC2, 0x64, 0xF8, 0xCF, 0xB5, 0x49, 0xD3, 0x77, 0x38, 0x0A, 0xE3, 0xAF,
+    0x0E, 0x72, 0x27, 0xE1, 0xE2, 0xC4, 0xEB, 0xD9, 0xAD, 0xDF, 0x2E, 0x6D, 0x4D, 0xE4, 0x79, 0x45,
+    0x0A, 0x6B, 0x35, 0x53, 0x28, 0x37, 0x54, 0x75, 0x1A, 0x32, 0x53, 0xFA, 0x77, 0xDA, 0xF6, 0xEC,
+    0x82, 0x9B, 0x6F, 0xF0, 0x0E, 0x27, 0x2B, 0x07, 0x6D, 0x4E, 0xAD, 0x7D, 0xFA, 0xFD, 0x88, 0x4F,
+    0xB0, 0x1D, 0xC6, 0xB2, 0x2E, 0x28, 0xAA, 0x47, 0x18, 0x68, 0x1C, 0x9E, 0xF7, 0x25, 0xCF, 0x6E,
+    0x96, 0xB7, 0xF3, 0x61, 0x4B, 0x59, 0xBD, 0xB0, 0x35, 0x23, 0x41, 0x4B, 0x65, 0x3F, 0x32, 0xCD,
+    0x78, 0xE8, 0xEE, 0x09, 0x29, 0xB7, 0x94, 0xBF, 0xAE, 0xAB, 0x07, 0x68, 0x5E, 0xC1, 0xB3, 0xAF,
+    0xE1, 0x83, 0x53, 0x91, 0xD5, 0x2C, 0xE3, 0x71, 0x08, 0x89, 0xCC, 0x2A, 0x3D, 0xB2, 0x7D, 0xBE,
+    0xC4, 0xFF, 0x58, 0x7F, 0x00, 0x6D, 0x55, 0x3B, 0x92, 0xE4, 0x44, 0x10, 0xCD, 0x96, 0x22, 0x56,
+    0x86, 0x0C, 0x79, 0xEB, 0xAC, 0xA1, 0x23, 0xE8, 0x08, 0x25, 0xB8, 0x00, 0xEB, 0x34, 0x11, 0x5C,
+    0x01, 0x8C, 0x39, 0x82, 0x14, 0x70, 0x81, 0x75, 0xF6, 0x08, 0x18, 0xCC, 0x1A, 0x73, 0x04, 0x09,
+    0x38, 0x00, 0x0A, 0x08, 0x6C, 0xDA, 0x58, 0x87, 0x75, 0x50, 0x6C, 0x88, 0x45, 0x43, 0x48, 0x95,
+    0xBC, 0xF7, 0x4A, 0xDD, 0xC3, 0x6F, 0x8C, 0x9C, 0xCE, 0x54, 0x55, 0xE6, 0xCB, 0x97, 0x9F, 0x32,
+    0x33, 0x1B, 0x46, 0x88, 0x93, 0x53, 0xE6, 0x92, 0xA5, 0x64, 0xED, 0x13, 0x64, 0x90, 0x1C, 0x86,
+    0x0B, 0x8F, 0x04, 0xC8, 0x3C, 0x36, 0x33, 0x8E, 0x6C, 0x94, 0xF5, 0x42, 0x19, 0x66, 0xCA, 0x61,
+    0x6C, 0x16, 0x1C, 0xE9, 0xEB, 0x05, 0x5E, 0xAC, 0x5E, 0xE1, 0xE5, 0x7C, 0xB7, 0x5A, 0xE5, 0xEE,
+    0x1B, 0xBC, 0x50, 0x0E, 0x92, 0x4E, 0x99, 0x53, 0xEE, 0xA5, 0xC3, 0xC7, 0x5E, 0x45, 0xC8, 0x18,
+    0x36, 0xCA, 0x61, 0x65, 0x60, 0x2B, 0xDC, 0xDF, 0x9A, 0x35, 0x3C, 0x6E, 0xBA, 0xC4, 0xF3, 0x0B,
+    0xBD, 0x02, 0x02, 0xF0, 0x0E, 0x3D, 0x62, 0x64, 0xD1, 0x2A, 0x04, 0x98, 0xAD, 0x9B, 0x60, 0xCB,
+    0xFC, 0xA3, 0xBB, 0x5D, 0xE1, 0x26, 0x86, 0xDB, 0x2D, 0x63, 0x84, 0x6B, 0x7C, 0x1C, 0x5A, 0x01,
+    0x0E, 0x3F, 0xCA, 0x9D, 0x28, 0x61, 0x40, 0x58, 0xFF, 0xF9, 0x53, 0x5F, 0x0A, 0x42, 0x19, 0x11,
+    0xCB, 0xA3, 0xB0, 0xCD, 0xC2, 0x06, 0x14, 0xF8, 0x49, 0xC8, 0x40, 0xF4, 0xF4, 0xF7, 0xC2, 0x7F,
+    0x35, 0x01, 0xBB, 0x48, 0xEE, 0xA6, 0x00, 0xA3, 0xF0, 0xAD, 0xC4, 0xFA, 0xEE, 0x81, 0x9C, 0xF5,
+    0x62, 0x71, 0x12, 0xAF, 0x33, 0xEF, 0x85, 0x9D, 0xB2, 0x10, 0xB1, 0x86, 0x4C, 0x8C, 0x17, 0x29,
+    0x33, 0x7A, 0xBA, 0x7E, 0xCF, 0x75, 0xE5, 0x76, 0x78, 0xB6, 0x53, 0x6F, 0x9D, 0xFF, 0xF9, 0xC5,
+    0x2A, 0xFF, 0xDE, 0x8A, 0xC7, 0x25, 0x29, 0x76, 0x20, 0xB4, 0xA4, 0xD0, 0x76, 0x61, 0x50, 0x62,
+    0x22, 0x7F, 0x07, 0x4E, 0x5C, 0xD2, 0x89, 0x04, 0x11, 0xFF, 0xEA, 0xE4, 0x09, 0x05, 0xED, 0x1C,
+    0xB6, 0xD6, 0x9A, 0xCD, 0x2A, 0xD0, 0x1C, 0x16, 0xEB, 0xE0, 0xAD, 0x03, 0x91, 0x3D, 0x50, 0x5B,
+    0x05, 0x3F, 0x85, 0x98, 0xB3, 0x66, 0x56, 0x77, 0x78, 0x2F, 0xDB, 0x2E, 0x5B, 0x90, 0x2D, 0xF3,
+    0xB1, 0x44, 0xF5, 0x3A, 0xD8, 0xD6, 0xD3, 0x1D, 0xD0, 0xB8, 0xBC, 0x8B, 0xD2, 0x4D, 0xE1, 0x71,
+    0x48, 0xA5, 0x4E, 0xE1, 0x27, 0x85, 0x07, 0x51, 0x43, 0x02, 0x68, 0xF6, 0xF9, 0xFD, 0x51, 0xAA,
+    0x6B, 0x8D, 0x0B, 0x65, 0x55, 0xC6, 0xD7, 0x2F, 0x4D, 0xB8, 0x8C, 0x45, 0x66, 0x2E, 0x22, 0x2D,
+    0x24, 0x36, 0x7F, 0x3F, 0xBF, 0x42, 0x54, 0xFA, 0xA3, 0xA7, 0x51, 0x29, 0x8E, 0x40, 0xCD, 0xCC,
+    0x32, 0xB1, 0x9F, 0x7B, 0xE2, 0x90, 0x92, 0x10, 0xE1, 0x26, 0x9E, 0xCF, 0x2F, 0x55, 0xAE, 0x59,
+    0x28, 0x2E, 0x62, 0xF3, 0x2A, 0x3B, 0xC9, 0x21, 0xB1, 0x68, 0xF7, 0x6F, 0x70, 0x88, 0x78, 0xFA,
+    0xA3, 0xCA, 0xBA, 0x95, 0xFB, 0x99, 0x73, 0x21, 0x20, 0x69, 0x5C, 0xE4, 0xB8, 0x16, 0xA6, 0x81,
+    0x68, 0xF2, 0x6B, 0x61, 0xB6, 0x7F, 0x1A, 0x94, 0xC1, 0x30, 0xDD, 0x70, 0xA5, 0xC4, 0xC8, 0x37,
+    0x0C, 0x84, 0x5B, 0xED, 0x37, 0x43, 0x26, 0xD7, 0x95, 0x5C, 0x77, 0x8B, 0x0C, 0xD3, 0xD1, 0x7D,
+    0xCF, 0x1E, 0xBE, 0x69, 0x53, 0x55, 0x93, 0xBC, 0x28, 0x91, 0x28, 0xCE, 0xA0, 0xB8, 0xBF, 0xB2,
+    0xCF, 0x90, 0x4F, 0xAB, 0xCC, 0xA7, 0xA7, 0x56, 0xAB, 0xA3, 0xDD, 0x1C, 0x5B, 0xD8, 0x12, 0x33,
+    0xED, 0xE9, 0x6B, 0x60, 0x9A, 0xE1, 0xE8, 0x11, 0xAD, 0x88, 0x12, 0x5C, 0x90, 0x62, 0xF0, 0x48,
+    0x65, 0x90, 0x62, 0x01, 0x4A, 0x8B, 0x59, 0x37, 0x8F, 0xED, 0x73, 0x1F, 0x2B, 0xBF, 0x8D, 0xB1,
+    0xF7, 0xAA, 0xE7, 0x22, 0x3E, 0x0F, 0x34, 0xFD, 0x75, 0x3C, 0x32, 0x5C, 0xAA, 0x52, 0x57, 0x75,
+    0x17, 0x96, 0x0C, 0x06, 0x0E, 0x1F, 0x6D, 0xBB, 0xB2, 0x94, 0x6D, 0x64, 0x07, 0x21, 0x4F, 0x6E,
+    0x01, 0x74, 0x5F, 0x58, 0xB9, 0x84, 0x4E, 0xC0, 0x0D, 0x04, 0xB2, 0xAD, 0xC4, 0x4A, 0x03, 0x72,
+    0x2B, 0xB9, 0x14, 0x5E, 0x9F, 0xBB, 0xA3, 0xAB, 0x2E, 0xA9, 0xD3, 0xFA, 0x22, 0x35, 0x97, 0x6C,
+    0x47, 0xF7, 0x8D, 0x42, 0x16, 0xB9, 0x46, 0x98, 0x3E, 0xBA, 0xAD, 0xA0, 0x6D, 0xC2, 0xA1, 0x64,
+    0x5B, 0x6D, 0xD8, 0x60, 0xE3, 0x2E, 0x7B, 0xA7, 0x42, 0x02, 0x24, 0xBA, 0xAB, 0xDA, 0x54, 0x1C,
+    0xE0, 0xC4, 0x3E, 0xC1, 0x46, 0xA3, 0x1E, 0x11, 0xBE, 0xE5, 0xC2, 0xE1, 0xBE, 0x80, 0xA3, 0xA8,
+    0xDC, 0x5C, 0x3A, 0xE7, 0x26, 0x72, 0x82, 0x84, 0x70, 0x26, 0x56, 0xF0, 0xFC, 0xEC, 0xA1, 0x4F,
+    0xB5, 0x1A, 0x34, 0xD7, 0xA9, 0xAE, 0xA7, 0x83, 0xF9, 0xD5, 0x6E, 0x1D, 0x40, 0xE6, 0xFF, 0xFD,
+    0xBD, 0x39, 0xBE, 0xB7, 0xB7, 0x5E, 0x38, 0x5A, 0x37, 0x75, 0x9B, 0xD5, 0x9B, 0xDD, 0x1A, 0xE6,
+    0x98, 0x84, 0x32, 0x39, 0x4B, 0xC5, 0x4E, 0x5D, 0x95, 0x1D, 0xDF, 0x97, 0xA7, 0x01, 0xB0, 0xB4,
+    0x64, 0x78, 0x3F, 0x7B, 0xFB, 0x82, 0xCE, 0x02, 0x6B, 0xC7, 0x6D, 0xC1, 0xEF, 0x1A, 0x1E, 0xB6,
+    0xD2, 0xA2, 0x3D, 0x42, 0x2F, 0xCF, 0x87, 0xC7, 0xBF, 0xAF, 0xBD, 0x66, 0x2E, 0x55, 0xD3, 0x02,
+    0xBE, 0x8B, 0x9D, 0x32, 0x77, 0xBD, 0x15, 0xFE, 0x15, 0xE5, 0xF0, 0xA3, 0x7C, 0xBE, 0x27, 0x8C,
+    0xFA, 0x91, 0xB2, 0xDC, 0xC5, 0xAF, 0xA6, 0xE9, 0xA4, 0x35, 0x65, 0x49, 0x06, 0xC9, 0x46, 0xB2,
+    0xD2, 0x6E, 0x2D, 0xB4, 0xA3, 0xB2, 0xEB, 0x21, 0x02, 0xEA, 0xA4, 0x84, 0x0F, 0xA8, 0x22, 0x82,
+    0x06, 0x95, 0xBF, 0xD4, 0x0E, 0xE9, 0x31, 0x54, 0xE0, 0xBB, 0x66, 0x1B, 0x72, 0x51, 0x8F, 0x07,
+    0x39, 0x45, 0x14, 0xCA, 0x43, 0xD3, 0x5C, 0x6A, 0x61, 0x48, 0xF3, 0xFF, 0x68, 0x1A, 0x48, 0xE2,
+    0xFC, 0x3F, 0x6D, 0x3B, 0xAA, 0x97, 0xFB, 0xFD, 0x9B, 0x5D, 0x4B, 0x96, 0x1D, 0xFF, 0x3D, 0x9B,
+    0x8A, 0xDA, 0x32, 0x1C, 0xCB, 0x86, 0xBB, 0x77, 0xD6, 0x63, 0xC9, 0xBD, 0x1E, 0xD8, 0xB1, 0xEC,
+    0x17, 0xC2, 0x5C, 0x60, 0x5E, 0xF4, 0x82, 0x06, 0xB5, 0x2A, 0x13, 0xEB, 0x4B, 0x80, 0x06, 0xE3,
+    0xC8, 0x8E, 0x4B, 0x87, 0x4F, 0x60, 0x4B, 0x52, 0x1A, 0x67, 0x37, 0xFA, 0xB7, 0xCC, 0xB9, 0xF9,
+    0xC3, 0x3F, 0x89, 0x60, 0xD7, 0x7F, 0x89, 0xC3, 0x6F, 0x3B, 0xB2, 0x42, 0x9D, 0x50, 0xC8, 0x66,
+    0x75, 0xFF, 0xC0, 0x4D, 0xFA, 0x93, 0xFB, 0x0F, 0xDC, 0xDA, 0x95, 0xEF, 0x68, 0xA6, 0x06, 0xD4,
+    0xBC, 0x57, 0xF3, 0x39, 0x2C, 0x30, 0x7F, 0xE9, 0x2B, 0x06, 0xA4, 0xC6, 0xBB, 0xFA, 0x1D, 0xC3,
+    0xCE, 0x78, 0x5B, 0xBD, 0x45, 0x9D, 0xBA, 0x99, 0x66, 0x3F, 0xF9, 0xC7, 0x7C, 0xD2, 0x56, 0x32,
+    0x3F, 0xA6, 0xC2, 0xFE, 0x05, 0xBD, 0x55, 0x31, 0xAE, 0xE5, 0x44, 0x10, 0x6C, 0xDB, 0xD2, 0x5A,
+    0xC2, 0x81, 0xF3, 0x25, 0x78, 0x47, 0x70, 0x42, 0x6E, 0xDF, 0x80, 0x64, 0x7F, 0x44, 0x40, 0x4A,
+    0xF6, 0x8F, 0x60, 0x4B, 0x5C, 0xE0, 0x07, 0x10, 0x11, 0x00, 0xD9, 0xEA, 0x25, 0x1C, 0xC1, 0x46,
+    0x1C, 0x00, 0x0B, 0x89, 0x18, 0x23, 0x6D, 0x40, 0xB6, 0x23, 0xD6, 0xD2, 0x1A, 0xF0, 0x73, 0x6F,
+    0x55, 0xB5, 0xF7, 0x7F, 0xE0, 0x00, 0x3B, 0x7A, 0xCF, 0x6D, 0xF7, 0xF4, 0xF4, 0x74, 0x57, 0x57,
+    0xCF, 0x98, 0x61, 0x14, 0x37, 0xB3, 0xEB, 0x77, 0x56, 0xED, 0x66, 0x9E, 0xAC, 0xDE, 0x2D, 0xA3,
+    0x58, 0x2D, 0xF7, 0xD5, 0x9A, 0x64, 0x85, 0x6F, 0xD6, 0x26, 0x2B, 0x7D, 0xB7, 0x76, 0xB1, 0x0A,
+    0x62, 0x9C, 0xAC, 0x86, 0xF0, 0xC9, 0x2E, 0x7E, 0xCB, 0x7C, 0xB0, 0xD6, 0x8F, 0xDC, 0xCD, 0xDA,
+    0xB7, 0x5E, 0x40, 0xF4, 0x6F, 0xBC, 0x3C, 0xE0, 0xEB, 0x4F, 0xAF, 0x6E, 0x12, 0x9F, 0xEE, 0xF0,
+    0xF5, 0xBB, 0x7F, 0xBB, 0xC1, 0xD7, 0xEC, 0xAF, 0x57, 0x88, 0xC9, 0xB1, 0x47, 0x45, 0xB1, 0xC0,
+    0xD7, 0xE0, 0x3E, 0xC3, 0x57, 0x37, 0xC2, 0x65, 0xE3, 0xD6, 0xCB, 0x25, 0x44, 0x67, 0xFD, 0xC1,
+    0x37, 0x1B, 0x43, 0x60, 0x7C, 0x8C, 0x39, 0x8C, 0xD1, 0xF9, 0x99, 0x39, 0xDD, 0xC0, 0xB9, 0xF3,
+    0x33, 0xF7, 0xED, 0x19, 0xDC, 0xE5, 0xF8, 0x37, 0x4C, 0x62, 0xC1, 0x3E, 0x9D, 0x41, 0xD8, 0x38,
+    0xDB, 0x08, 0xBB, 0x06, 0x89, 0xAC, 0x66, 0x08, 0x0E, 0xF3, 0xB0, 0x1B, 0xEA, 0x1B, 0x5D, 0xCD,
+    0x0C, 0x1A, 0x33, 0xCC, 0x84, 0xE9, 0xC3, 0x1A, 0xD9, 0x32, 0x67, 0xD9, 0xC0, 0xD4, 0x7C, 0x2E,
+    0x69, 0xE3, 0x89, 0xD0, 0x64, 0x00, 0xA4, 0xF7, 0xAF, 0x3E, 0x03, 0x04, 0x17, 0xEE, 0x7C, 0xC0,
+    0x3A, 0x22, 0x90, 0x18, 0x90, 0x82, 0x44, 0x11, 0x42, 0x9F, 0x1D, 0x56, 0xDF, 0xFB, 0x1F, 0xF6,
+    0xAF, 0x71, 0xBD, 0x3E, 0x18, 0x6D, 0x56, 0x59, 0x6C, 0x5A, 0xBD, 0xB2, 0x18, 0xF7, 0xC9, 0x2E,
+    0xC9, 0xDA, 0x89, 0x00, 0xBB, 0x15, 0x70, 0x8F, 0x8D, 0x56, 0xEB, 0x93, 0xF9, 0xAF, 0xF7, 0x3E,
+    0xD0, 0x6D, 0xEC, 0x3C, 0x73, 0xC9, 0x4D, 0xFB, 0x2C, 0x54, 0x6C, 0xC4, 0xE5, 0x2F, 0x53, 0xDA,
+    0x66, 0x97, 0x5D, 0x40, 0x25, 0x56, 0x18, 0x9E, 0xA0, 0x38, 0xA4, 0x58, 0x9F, 0x14, 0x82, 0x74,
+    0xDC, 0xED, 0x3F, 0xE3, 0x1E, 0x7E, 0x09, 0x80, 0x53, 0xDF, 0x28, 0x2F, 0x25, 0x36, 0x61, 0xD5,
+    0x5A, 0x62, 0xB2, 0x86, 0xFB, 0x11, 0x18, 0x03, 0x3C, 0x60, 0xD4, 0x6E, 0x12, 0xAC, 0x43, 0x0B,
+    0x78, 0x26, 0x8A, 0x9C, 0x69, 0xB7, 0x29, 0x70, 0x4D, 0x82, 0xAE, 0x5F, 0xAA, 0x43, 0x60, 0x0B,
+    0x73, 0x9F, 0x08, 0x6B, 0x26, 0xF1, 0x09, 0xC2, 0x85, 0x72, 0xFC, 0xC6, 0xE1, 0xF9, 0x6B, 0x26,
+    0x54, 0xBB, 0x52, 0x94, 0x48, 0x01, 0xEE, 0x1C, 0x68, 0x76, 0x0A, 0x85, 0x8E, 0xFA, 0x08, 0xEC,
+    0x99, 0x02, 0x53, 0x84, 0x8C, 0x1A, 0x6A, 0xE6, 0x0B, 0xB2, 0x6C, 0x14, 0xCF, 0xAF, 0x2F, 0x35,
+    0xF5, 0x4A, 0x40, 0x6F, 0x76, 0x82, 0xE4, 0x77, 0x9F, 0x83, 0xD6, 0xBB, 0x35, 0x20, 0xDD, 0x62,
+    0x23, 0x38, 0xD2, 0xE1, 0x0B, 0xBF, 0x5A, 0xC8, 0x8F, 0x03, 0x14, 0x55, 0xE0, 0x9A, 0x04, 0xB4,
+    0x76, 0x5D, 0xA4, 0x90, 0x0F, 0xB2, 0xFB, 0x86, 0xD0, 0x0B, 0x1F, 0x9A, 0xD5, 0x2E, 0x37, 0x52,
+    0xC6, 0x91, 0x2E, 0x6A, 0x33, 0xD5, 0x07, 0x71, 0x1D, 0x37, 0xF3, 0xAD, 0xA0, 0x6E, 0xAE, 0x7D,
+    0xBA, 0x90, 0xCC, 0x76, 0xF7, 0x22, 0xBB, 0x7B, 0xF1, 0x84, 0x73, 0xE5, 0x47, 0x27, 0x80, 0x89,
+    0x9C, 0x68, 0xD0, 0x2A, 0xBA, 0xD6, 0xBB, 0x2F, 0x8C, 0x4E, 0x69, 0xA3, 0xA7, 0x70, 0xB4, 0x2C,
+    0x12, 0xED, 0xA5, 0xAA, 0xB5, 0xB8, 0x08, 0x2C, 0x62, 0x75, 0x1E, 0xF8, 0x54, 0x72, 0x88, 0xAF,
+    0xD3, 0x6E, 0xD0, 0xD2, 0xC5, 0x60, 0x01, 0x2B, 0x7F, 0x95, 0xB1, 0x73, 0xC5, 0x9B, 0xE0, 0x6E,
+    0xBC, 0x63, 0x15, 0xF7, 0x7E, 0xEE, 0xC7, 0x83, 0x05, 0xAB, 0x77, 0xB1, 0x78, 0x6B, 0xF9, 0x5C,
+    0xF5, 0x4C, 0x7D, 0x14, 0xC4, 0x7A, 0x41, 0x1D, 0x80, 0x2B, 0xA8, 0x08, 0x4D, 0x55, 0x3F, 0xC9,
+    0xA7, 0x9A, 0xC3, 0xAB, 0x62, 0x10, 0xEF, 0x54, 0xF7, 0x93, 0x94, 0x8D, 0x9E, 0xAD, 0x6A, 0xD4,
+    0xAF, 0x8F, 0x34, 0xB5, 0x28, 0x1E, 0x3B, 0x56, 0x5D, 0x4C, 0x67, 0xF3, 0x23, 0x5B, 0xE1, 0x73,
+    0xB2, 0x96, 0xA1, 0x0E, 0xD6, 0xEF, 0xC1, 0x42, 0x0A, 0xE5, 0x25, 0x91, 0x48, 0x71, 0x76, 0xE8,
+    0xD9, 0xFE, 0x2D, 0xCF, 0x9D, 0x89, 0xFB, 0xD0, 0x43, 0xCF, 0x73, 0x67, 0xE0, 0x4E, 0x65, 0x1C,
+    0x0B, 0x8C, 0x8E, 0x74, 0x3E, 0x14, 0x3F, 0xE2, 0xA3, 0xF1, 0x45, 0x55, 0x8D, 0x35, 0xDD, 0xB9,
+    0x26, 0x13, 0x0B, 0xFF, 0xFE, 0x01, 0x6B, 0x4E, 0x32, 0x96, 0xD1, 0x10, 0x65, 0x70, 0xB2, 0x08,
+    0x4E, 0xE6, 0x81, 0x21, 0xA9, 0xF9, 0x60, 0xFF, 0x1B, 0x3C, 0x4C, 0x0A, 0xAF, 0x75, 0xEC, 0x7C,
+    0xE9, 0x42, 0x8C, 0xA9, 0xF9, 0xCC, 0x03, 0x69, 0x4C, 0x84, 0xA8, 0x4F, 0xE7, 0xC6, 0xD8, 0x0D,
+    0x91, 0xE3, 0xD7, 0xB0, 0x15, 0xC8, 0xA6, 0x9C, 0x2C, 0x62, 0xEB, 0x32, 0xF7, 0xE6, 0x20, 0x10,
+    0x15, 0xDC, 0xCC, 0x98, 0x78, 0xA3, 0x82, 0x1C, 0x24, 0x40, 0x90, 0x3B, 0x1A, 0x37, 0x7B, 0xEC,
+    0x12, 0xF5, 0xB9, 0x07, 0x59, 0x26, 0x75, 0xC3, 0x24, 0xCA, 0x2C, 0x62, 0x87, 0x00, 0xFF, 0xE8,
+    0x1A, 0x07, 0xD2, 0xF7, 0x52, 0x82, 0x7A, 0x71, 0x52, 0x14, 0xFE, 0x63, 0x28, 0xFA, 0x14, 0x8A,
+    0xFA, 0xC8, 0xA4, 0x40, 0xF0, 0xCD, 0x11, 0x15, 0xCC, 0x79, 0x08, 0x75, 0x40, 0x12, 0xB1, 0x22,
+    0x15, 0x5F, 0xA0, 0x40, 0x90, 0x28, 0x40, 0x8B, 0x9B, 0x61, 0x57, 0x4B, 0xCC, 0xAD, 0x4F, 0x40,
+    0xBD, 0xBD, 0xE1, 0xD2, 0x40, 0xA2, 0x85, 0xFF, 0xE4, 0xFE, 0x0B, 0xEB, 0xB2, 0x8F, 0x7E, 0x08,
+    0xE8, 0xD7, 0xEE, 0xFF, 0xB8, 0x78, 0xFC, 0xDB, 0xD9, 0x67, 0xBB, 0xB2, 0x80, 0xA2, 0xE2, 0x11,
+    0x8A, 0x9C, 0xE6, 0x51, 0x89, 0xFA, 0x5E, 0x31, 0x31, 0x28, 0xF0, 0x3E, 0x51, 0x81, 0x93, 0x59,
+    0x59, 0xEF, 0x6C, 0x31, 0x1E, 0x80, 0x58, 0xAE, 0xA8, 0x45, 0x4D, 0x22, 0x75, 0x04, 0xFC, 0xBD,
+    0xEE, 0x36, 0x96, 0x55, 0xFD, 0x84, 0x10, 0x59, 0x81, 0x2C, 0x4A, 0x00, 0x28, 0x82, 0xA6, 0xE3,
+    0x5B, 0xB1, 0xB8, 0xF4, 0x70, 0xD2, 0xEA, 0x14, 0x64, 0x69, 0xE5, 0xF2, 0x12, 0x4C, 0x24, 0xE3,
+    0x62, 0x76, 0x08, 0x9A, 0xBF, 0x37, 0x5A, 0x9E, 0xEE, 0x26, 0x76, 0xF6, 0xAA, 0xC9, 0x9F, 0xB9,
+    0x28, 0xF7, 0x24, 0xAB, 0xF1, 0x56, 0xD2, 0x0A, 0x97, 0x1D, 0x2F, 0x34, 0xBC, 0xE3, 0x50, 0xD5,
+    0x8D, 0x42, 0xD7, 0xCC, 0x20, 0xFA, 0xF6, 0x03, 0x8D, 0x77, 0xB5, 0x55, 0xBD, 0x92, 0xD4, 0x46,
+    0x10, 0x6E, 0x8D, 0xCA, 0x27, 0xF0, 0x06, 0x72, 0x42, 0x44, 0xA0, 0x27, 0x00, 0x3D, 0xC2, 0xC8,
+    0x91, 0xD3, 0x0B, 0xB8, 0xC8, 0x4F, 0x60, 0x27, 0x3C, 0x82, 0x16, 0xEE, 0x05, 0x20, 0x70, 0x42,
+    0x44, 0x40, 0xB4, 0x89, 0xFD, 0x04, 0xA7, 0xA1, 0xA8, 0x22, 0x56, 0x42, 0xAE, 0x94, 0x08, 0x05,
+    0x2A, 0x97, 0x8C, 0x47, 0x6A, 0xBE, 0xAF, 0x47, 0xBB, 0x4B, 0x5D, 0xB9, 0x28, 0x43, 0x15, 0x53,
+    0x7B, 0xD2, 0xA9, 0xA7, 0xA7, 0x7F, 0xBE, 0xAF, 0xBB, 0xC7, 0x8F, 0x22, 0x7E, 0xD2, 0x5E, 0x9C,
+    0x3E, 0xD5, 0xBD, 0x54, 0xB1, 0x50, 0x11, 0x0D, 0x55, 0x94, 0x72, 0xC1, 0x86, 0xE8, 0x80, 0xDF,
+    0x4E, 0xB1, 0x1D, 0xDA, 0x49, 0x76, 0x9A, 0x53, 0x69, 0xF1, 0x11, 0xA7, 0x3E, 0x6A, 0x80, 0xAA,
+    0x2E, 0x82, 0x4D, 0xA8, 0x61, 0x13, 0x47, 0xA5, 0x52, 0x58, 0x14, 0xAF, 0x0D, 0x9E, 0x3A, 0xE3,
+    0x91, 0x53, 0x0D, 0x62, 0x3C, 0xA4, 0x4B, 0x82, 0xFE, 0x2C, 0x88, 0x26, 0x18, 0x4C, 0xC0, 0x23,
+    0x22, 0xAD, 0x62, 0x05, 0x29, 0xF8, 0x9A, 0x69, 0x09, 0xAB, 0x81, 0x0E, 0x16, 0x2C, 0xD7, 0x7C,
+    0x8B, 0x64, 0xBF, 0x1F, 0xD4, 0xEC, 0x6E, 0xFE, 0xE0, 0x9C, 0xA6, 0xA1, 0xB6, 0xF2, 0x95, 0x29,
+    0xC2, 0x34, 0x5B, 0xB4, 0x8C, 0x43, 0x13, 0x5F, 0x25, 0x63, 0xA5, 0x8E, 0x79, 0x82, 0x4E, 0x6F,
+    0x21, 0xA4, 0xCD, 0x5A, 0x63, 0xD2, 0xB1, 0xB8, 0xE0, 0xFD, 0xDD, 0xD5, 0x25, 0x75, 0xCC, 0x5D,
+    0x9D, 0xBC, 0xE7, 0xDB, 0xA7, 0x4F, 0x9F, 0xC5, 0xF6, 0xD9, 0x6D, 0xB1, 0x61, 0xFD, 0x78, 0x78,
+    0x65, 0x6E, 0x7B, 0x73, 0x63, 0xF6, 0x68, 0xB6, 0x65, 0xA8, 0xB9, 0x85, 0x56, 0x9A, 0x37, 0x13,
+    0xB8, 0xAF, 0x12, 0x78, 0x13, 0xE8, 0x2D, 0x41, 0x96, 0x04, 0xF3, 0x2D, 0xC1, 0x2E, 0x09, 0xFA,
+    0xFF, 0x25, 0x90, 0x24, 0x88, 0xB7, 0x04, 0x45, 0x12, 0x18, 0xB0, 0x06, 0x76, 0x61, 0x19, 0xD5,
+    0x9B, 0xC0, 0x14, 0x6D, 0x65, 0x72, 0x47, 0x5E, 0xE6, 0xA1, 0x92, 0x58, 0x8C, 0x75, 0xE8, 0x7E,
+    0x5E, 0x8A, 0xB9, 0x1A, 0xDA, 0x27, 0x5A, 0xC4, 0x6A, 0xF4, 0x41, 0xF3, 0xA5, 0x9C, 0xFC, 0xA0,
+    0xD7, 0x6B, 0x19, 0xFD, 0xA8, 0x6F, 0xD6, 0x72, 0xF4, 0xCD, 0xEC, 0xC2, 0x5D, 0xF9, 0x49, 0x0E,
+    0x87, 0x3D, 0xA9, 0x8B, 0x47, 0xAA, 0x12, 0x66, 0x52, 0x1A, 0x98, 0xC6, 0xD2, 0x16, 0x95, 0xE1,
+    0x67, 0xEC, 0xD5, 0xC3, 0x39, 0x6B, 0x83, 0xA1, 0xDB, 0x9F, 0x63, 0xED, 0x4F, 0x98, 0x55, 0xE3,
+    0x29, 0x8F, 0x04, 0x4E, 0xA2, 0xE0, 0x33, 0xB5, 0xFF, 0xF6, 0xD4, 0x7E, 0x9B, 0x27, 0x53, 0x33,
+    0xA8, 0x9C, 0x41, 0x95, 0x68, 0x37, 0x90, 0x52, 0x5B, 0xD8, 0x21, 0xDA, 0x87, 0x0D, 0x64, 0xEA,
+    0xB0, 0x5F, 0xAC, 0xDA, 0x10, 0x19, 0x1F, 0x8A, 0x78, 0x4F, 0xE4, 0x51, 0x52, 0xB2, 0x52, 0x0B,
+    0x56, 0x59, 0x56, 0x5F, 0x93, 0x4F, 0xFD, 0x20, 0xF2, 0xC3, 0x23, 0xF1, 0x83, 0xB4, 0x83, 0x74,
+    0x43, 0x6A, 0xCB, 0x33, 0x01, 0x6B, 0x63, 0x45, 0xB9, 0xCF, 0xD9, 0x8E, 0x68, 0xCC, 0x09, 0xA1,
+    0x75, 0xA1, 0x1C, 0x10, 0x56, 0x87, 0x88, 0xF3, 0x49, 0xAA, 0xA1, 0x0A, 0xD2, 0x36, 0x8B, 0xB8,
+    0x25, 0x1F, 0x91, 0x76, 0x19, 0xA0, 0xD0, 0xFE, 0xF1, 0x58, 0x59, 0xE2, 0x33, 0x0B, 0x7B, 0x28,
+    0xD9, 0x68, 0x78, 0x44, 0xD9, 0xAD, 0xCD, 0x66, 0x39, 0x3F, 0x56, 0xAF, 0xA1, 0x43, 0x9C, 0x0C,
+    0x31, 0x6B, 0x74, 0xF8, 0x77, 0x04, 0xCA, 0xBF, 0x5D, 0x48, 0x5C, 0x64, 0x04, 0x23, 0x63, 0x6E,
+    0xBA, 0xF5, 0x97, 0xB9, 0xD4, 0xA6, 0x0A, 0xDA, 0x67, 0xB1, 0x8C, 0x52, 0xBD, 0xD6, 0xC6, 0xC5,
+    0x7A, 0x94, 0xF6, 0x5A, 0x81, 0xA5, 0x9F, 0x38, 0x47, 0xE0, 0x11, 0x07, 0x22, 0xFF, 0xE1, 0xC9,
+    0x90, 0xD0, 0xFA, 0xED, 0x94, 0xD4, 0xE3, 0x19, 0xD0, 0xAD, 0xD8, 0x5A, 0x44, 0xD7, 0xE8, 0xD0,
+    0xD0, 0xA4, 0x85, 0x65, 0x4B, 0x36, 0x88, 0x3A, 0xD0, 0x48, 0x7F, 0x36, 0xC3, 0x1E, 0x10, 0x3A,
+    0xF6, 0x6F, 0x28, 0x68, 0xA9, 0x35, 0x72, 0x8E, 0x65, 0x1E, 0xBE, 0x50, 0xF7, 0x27, 0x41, 0x3B,
+    0x28, 0xE7, 0x09, 0x58, 0x04, 0x89, 0x30, 0x41, 0x2A, 0x70, 0xEA, 0x39, 0x04, 0xE5, 0xE4, 0x20,
+    0xE8, 0x1A, 0x4C, 0x47, 0x40, 0x82, 0xE9, 0x58, 0xE1, 0x0B, 0x3F, 0x24, 0xBE, 0x09, 0xCA, 0x31,
+    0x03, 0x23, 0xFE, 0x63, 0x07, 0x90, 0x94, 0x68, 0xB8, 0xD3, 0xC8, 0xB0, 0x61, 0xB6, 0xB2, 0x34,
+    0x6C, 0x28, 0xC9, 0xFD, 0x7F, 0xB6, 0x09, 0xB5, 0xE3, 0xDC, 0xAC, 0xE7, 0x02, 0xC0, 0xF4, 0x0E,
+    0xB3, 0xF6, 0x45, 0x37, 0x9F, 0xE8, 0x98, 0x89, 0x24, 0x80, 0x3A, 0x5C, 0x25, 0xC8, 0xAD, 0x04,
+    0xCB, 0x55, 0x2E, 0x02, 0x79, 0x62, 0x8E, 0x46, 0x37, 0xAC, 0xD8, 0x0C, 0xBA, 0xAF, 0xCF, 0x58,
+    0x3C, 0x11, 0x86, 0x23, 0x9C, 0x12, 0xBB, 0x29, 0x01, 0x05, 0x80, 0xEA, 0x1E, 0x11, 0xBC, 0x7D,
+    0x09, 0x77, 0x3D, 0xF1, 0x41, 0x8A, 0xFB, 0x0C, 0x61, 0xB2, 0x05, 0x72, 0x4D, 0x83, 0xA9, 0x58,
+    0x12, 0xC7, 0x60, 0x8B, 0xD9, 0x20, 0x2A, 0x62, 0x9A, 0xB0, 0x6D, 0x47, 0xD9, 0xAA, 0xCD, 0xAD,
+    0xC5, 0xCC, 0x79, 0xD7, 0xF6, 0x04, 0x9A, 0x37, 0xC5, 0x07, 0x96, 0xCB, 0xC4, 0x91, 0xDE, 0xA2,
+    0x76, 0xC4, 0xCD, 0x8C, 0x01, 0xC5, 0x05, 0xFD, 0x1B, 0x1A, 0x47, 0x5A, 0x04, 0xA7, 0xA7, 0xC0,
+    0xEF, 0xAB, 0x23, 0x38, 0x46, 0x3F, 0xF3, 0x87, 0xC0, 0x4A, 0x8E, 0x4F, 0xB8, 0xB8, 0x78, 0x6F,
+    0xBD, 0xB8, 0x35, 0xD9, 0x20, 0x39, 0x11, 0x97, 0xFA, 0x5F, 0xCE, 0x68, 0xDD, 0x20, 0x4B, 0x97,
+    0x02, 0xA0, 0xFC, 0x75, 0x6B, 0x01, 0xEB, 0xCB, 0x74, 0xE1, 0x1C, 0xBB, 0xD2, 0x3A, 0xD8, 0x8A,
+    0xD7, 0xE8, 0x4D, 0xE0, 0xFD, 0x0D, 0x8C, 0xC0, 0xE9, 0xC4, 0xE3, 0x11, 0x03, 0xE7, 0xCF, 0x28,
+    0xDD, 0xE4, 0x22, 0xAE, 0x3B, 0x17, 0x33, 0xDD, 0x3B, 0x14, 0x99, 0xE4, 0x33, 0x19, 0x9D, 0x8B,
+    0x15, 0x59, 0xED, 0x16, 0x36, 0x0A, 0xD8, 0x1D, 0x91, 0x82, 0x1F, 0x01, 0x09, 0x9A, 0x75, 0x06,
+    0xEF, 0xB8, 0x09, 0x35, 0x74, 0x53, 0xA6, 0xE1, 0xE2, 0xAF, 0xEC, 0x32, 0x45, 0x4A, 0x00, 0x81,
+    0x42, 0x45, 0xE2, 0x83, 0xE0, 0x82, 0xCC, 0xAE, 0x1A, 0x39, 0xAF, 0x87, 0x7B, 0x0B, 0x07, 0xED,
+    0xBF, 0x9B, 0x2C, 0x4E, 0x90, 0x9A, 0xAD, 0x46, 0x0D, 0xE5, 0x28, 0x50, 0x22, 0x4B, 0x34, 0x26,
+    0x2B, 0xD4, 0x7A, 0x34, 0x6A, 0xD0, 0xED, 0x17, 0x37, 0xF2, 0x1D, 0xD7, 0x27, 0x8D, 0x55, 0xBD,
+    0xAE, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0x22, 0x96, 0xE2, 0x62, 0x2B, 0x1A, 0x52, 0x6C, 0x4D, 0xE5,
+    0x47, 0x58, 0x2B, 0x08, 0xD1, 0x52, 0x40, 0x41, 0x45, 0x4F, 0x93, 0x47, 0xB0, 0x25, 0x0A, 0x0A,
+    0x0A, 0xF2, 0x08, 0xB7, 0x48, 0x75, 0x29, 0x78, 0x03, 0xD6, 0x88, 0x07, 0x88, 0x1B, 0xA0, 0x48,
+    0x81, 0x85, 0x68, 0xA8, 0xD8, 0xC2, 0x44, 0xE6, 0xBB, 0xB6, 0x87, 0x73, 0x66, 0xFD, 0x7D, 0x41,
+    0x02, 0x09, 0xAC, 0x7B, 0xE7, 0xF3, 0xEE, 0xCE, 0xCE, 0x9C, 0x39, 0xF3, 0x63, 0x11, 0xA9, 0x16,
+    0x11, 0x69, 0x47, 0x08, 0xC5, 0x7F, 0xBD, 0x41, 0x84, 0x24, 0xFF, 0xF6, 0x14, 0x14, 0x9E, 0x67,
+    0xB1, 0xC3, 0x3D, 0x6A, 0x3A, 0xAE, 0xFA, 0x41, 0xA4, 0xFC, 0x5F, 0xAB, 0xF0, 0x8F, 0xB3, 0x6A,
+    0x3F, 0xFD, 0x05, 0xC5, 0x4A, 0x71, 0xD6, 0xE8, 0xCC, 0x15, 0xB6, 0x3F, 0x7B, 0x6E, 0x6E, 0xE3,
+    0x90, 0xF5, 0x0B, 0xEE, 0xB5, 0xD3, 0xE9, 0xB9, 0x07, 0xE2, 0x66, 0x39, 0x51, 0x7B, 0x5C, 0x29,
+    0xF7, 0xB7, 0x3E, 0x92, 0xF0, 0xBD, 0x4A, 0xBD, 0xEA, 0x28, 0x31, 0x26, 0x71, 0xBA, 0xE2, 0xD2,
+    0x81, 0x4B, 0xB0, 0x5D, 0x29, 0x94, 0x7B, 0x9C, 0x34, 0x8A, 0x1B, 0x0A, 0x4F, 0xFE, 0x41, 0xE7,
+    0x52, 0xE1, 0x37, 0x24, 0xDD, 0xEB, 0xA3, 0xD1, 0x25, 0x4E, 0x01, 0x0A, 0x72, 0x31, 0xEB, 0xF0,
+    0x04, 0xAF, 0xF5, 0x0A, 0xC3, 0xE6, 0xE4, 0xCD, 0xD6, 0x26, 0x25, 0x8C, 0x6A, 0x27, 0x01, 0x5B,
+    0xB3, 0xB8, 0x85, 0x88, 0x88, 0x0E, 0x48, 0xC3, 0x44, 0x86, 0x9A, 0x15, 0xFE, 0x36, 0x78, 0x81,
+    0xC7, 0xC1, 0x33, 0xA0, 0xEB, 0xE3, 0x5F, 0x1F, 0x1D, 0x63, 0x50, 0xD5, 0x2F, 0x35, 0x41, 0x8B,
+    0xCF, 0x0C, 0x84, 0xDF, 0xE8, 0x11, 0x47, 0xD1, 0xE4, 0xB4, 0x8B, 0x5D, 0xAD, 0xD2, 0xAE, 0xF0,
+    0x1B, 0x16, 0xD1, 0xD1, 0x51, 0x54, 0x07, 0xBC, 0x35, 0xBB, 0xB4, 0x09, 0x8E, 0xC0, 0x97, 0x0E,
+    0x6E, 0x2B, 0x74, 0xC0, 0x4E, 0x98, 0x29, 0x52, 0xA9, 0x1D, 0x45, 0xDE, 0x76, 0x9B, 0xF4, 0xC9,
+    0xED, 0xD2, 0x23, 0x40, 0x84, 0x57, 0x69, 0xE7, 0x76, 0xBC, 0x79, 0x6E, 0x9F, 0x40, 0xDC, 0x8F,
+    0x08, 0xC0, 0xD3, 0x77, 0x50, 0x00, 0x81, 0x58, 0x25, 0x2E, 0x08, 0x17, 0xBE, 0x20, 0x10, 0x38,
+    0x82, 0x6C, 0x16, 0xE4, 0xC7, 0x51, 0xF8, 0xD4, 0x6C, 0x70, 0x0E, 0xC3, 0x21, 0xF9, 0x15, 0x86,
+    0x5B, 0x28, 0x4D, 0x86, 0xAF, 0x87, 0xDB, 0x31, 0xC2, 0x09, 0xA8, 0x7B, 0x06, 0x92, 0x6B, 0x12,
+    0xDC, 0x2A, 0x93, 0x70, 0xD1, 0xB9, 0xD0, 0xB1, 0xC5, 0x19, 0x0C, 0x80, 0x37, 0x97, 0xDC, 0x8A,
+    0x37, 0x90, 0xE8, 0x13, 0x68, 0x6A, 0x67, 0xD0, 0x17, 0xA6, 0x30, 0x4B, 0x1C, 0x0D, 0x3C, 0x50,
+    0x28, 0xAF, 0x1E, 0x44, 0x06, 0x75, 0xCD, 0x14, 0xA1, 0x00, 0xFA, 0x35, 0xC3, 0xFE, 0x84, 0x75,
+    0x78, 0xF4, 0x56, 0x0A, 0x54, 0x91, 0xD2, 0xF8, 0x03, 0xFE, 0xAE, 0x47, 0x65, 0x00, 0x3C, 0x02,
+    0xEC, 0x17, 0x09, 0x2C, 0x24, 0xE1, 0x02, 0xA7, 0x38, 0x01, 0xF0, 0x66, 0x46, 0x92, 0x46, 0x41,
+    0x36, 0xC3, 0xCE, 0x6C, 0x92, 0x7B, 0x58, 0x8D, 0xF4, 0x49, 0x57, 0x38, 0xA3, 0x31, 0x44, 0x10,
+    0x1E, 0x68, 0xB9, 0x3E, 0x1E, 0xFD, 0xC6, 0xFA, 0x1A, 0x2D, 0x6F, 0xAC, 0x39, 0x5C, 0xE9, 0xF8,
+    0x93, 0x49, 0x74, 0xBB, 0x21, 0xCA, 0xE7, 0xED, 0x7A, 0xEB, 0x90, 0xDB, 0xD3, 0xEC, 0x8C, 0x51,
+    0x5F, 0x2D, 0x64, 0x17, 0xC4, 0xBD, 0x46, 0x5C, 0xED, 0x84, 0x04, 0xFB, 0x09, 0x8C, 0x01, 0x4E,
+    0x9C, 0x01, 0x10, 0x19, 0xDD, 0x08, 0xEF, 0x5B, 0x61, 0x8E, 0xBB, 0x52, 0xC5, 0x21, 0x6B, 0x63,
+    0x85, 0x8A, 0x98, 0x58, 0x26, 0x29, 0x07, 0x5A, 0x91, 0x15, 0x94, 0x93, 0x4A, 0x57, 0x1E, 0xCF,
+    0x5E, 0x4D, 0x84, 0x9C, 0xC4, 0xCA, 0x0C, 0xB0, 0x09, 0x85, 0x61, 0x48, 0xFF, 0x2B, 0xC4, 0xBB,
+    0x37, 0x08, 0xEE, 0x8F, 0xC8, 0x9B, 0x63, 0x41, 0x3B, 0x91, 0x20, 0x8E, 0xF7, 0xE9, 0x4C, 0x6A,
+    0xDC, 0x80, 0x3F, 0x2B, 0x63, 0xEB, 0x25, 0xF6, 0x20, 0x92, 0x23, 0xCD, 0x91, 0xC3, 0x2C, 0x94,
+    0x55, 0x4A, 0x32, 0xA1, 0xFD, 0x4E, 0x7C, 0x33, 0x04, 0xE2, 0xA5, 0x23, 0x22, 0x38, 0xFD, 0x7A,
+    0x01, 0x54, 0xE9, 0x48, 0xAF, 0x14, 0xE4, 0xA7, 0x3A, 0x3A, 0xD2, 0x4E, 0x2B, 0x19, 0x16, 0x37,
+    0x5B, 0x36, 0x29, 0x0A, 0x71, 0xAA, 0x90, 0xDF, 0x4B, 0xDC, 0x48, 0xFB, 0x1C, 0x18, 0x0D, 0x82,
+    0x99, 0xE4, 0x89, 0xBE, 0xB8, 0x9A, 0x7E, 0x84, 0x3F, 0xDC, 0x45, 0x0B, 0xB1, 0x99, 0x9A, 0xFC,
+    0x0A, 0xA5, 0xCF, 0xA1, 0x0C, 0x8F, 0xEB, 0xBD, 0xDE, 0x3F, 0x47, 0x15, 0x72, 0x97, 0x0D, 0xC9,
+    0x51, 0xD5, 0xFE, 0xED, 0xF5, 0xCF, 0x3B, 0x50, 0x00, 0xDE, 0x50, 0x6B, 0x0C, 0x14, 0xD8, 0x8B,
+    0x1D, 0x9D, 0x89, 0x79, 0x53, 0x6F, 0x68, 0x50, 0xB7, 0x52, 0x2C, 0x15, 0x0B, 0xB0, 0x5E, 0x40,
+    0x7B, 0x83, 0xAA, 0x9F, 0x51, 0x8A, 0xFD, 0x04, 0x11, 0x47, 0x84, 0xA2, 0xA3, 0x67, 0xC3, 0xE0,
+    0x48, 0x3B, 0x38, 0xCC, 0x82, 0xA5, 0xA8, 0xAC, 0x8F, 0x83, 0xA3, 0x63, 0x07, 0xB6, 0xF9, 0xC4,
+    0x48, 0xBA, 0xF4, 0x3D, 0x4E, 0x93, 0x01, 0xAD, 0x1B, 0x47, 0x44, 0xDA, 0x4F, 0x35, 0x92, 0x48,
+    0x4B, 0xE0, 0x33, 0xA4, 0x16, 0x43, 0x68, 0xF7, 0x0B, 0x98, 0xF8, 0x6A, 0x65, 0xF2, 0x00, 0xD3,
+    0x33, 0x57, 0x95, 0x1E, 0xD7, 0x84, 0xD9, 0xDC, 0x73, 0x2C, 0xA2, 0x4A, 0xD3, 0x39, 0xD7, 0x4A,
+    0xF5, 0x36, 0xEF, 0x3E, 0x20, 0x7F, 0xFA, 0x9D, 0x76, 0x6F, 0xC3, 0x70, 0x3F, 0xB5, 0x63, 0x98,
+    0xFD, 0xD2, 0x2E, 0x6D, 0xAA, 0x77, 0x7F, 0xB8, 0xB5, 0xD0, 0x4F, 0xF5, 0x25, 0x5A, 0xFA, 0x77,
+    0x7D, 0xB0, 0x86, 0x81, 0xBD, 0x9A, 0x72, 0x28, 0xD4, 0xAA, 0xB9, 0xB7, 0xD6, 0xF0, 0xFA, 0x33,
+    0x0C, 0xD7, 0xFA, 0x0B, 0x2A, 0xBB, 0xD0, 0xC4, 0x74, 0xDA, 0x6C, 0x90, 0xC7, 0x77, 0xE5, 0x7D,
+    0x2E, 0x6A, 0x56, 0x04, 0xE7, 0xC7, 0x6C, 0xDE, 0x38, 0x87, 0x7F, 0x22, 0xBE, 0x9E, 0x99, 0x04,
+    0xC0, 0x59, 0xF2, 0x08, 0x05, 0x4E, 0x6E, 0xE7, 0xE1, 0x0C, 0x1F, 0x9D, 0xF5, 0x3A, 0xF0, 0xB6,
+    0x07, 0x75, 0x62, 0xB2, 0x6E, 0x1D, 0xD1, 0xAA, 0x0E, 0x33, 0x6A, 0x63, 0xE5, 0xB4, 0xB8, 0x80,
+    0xF8, 0x39, 0x45, 0x56, 0x66, 0x14, 0x8E, 0x38, 0x1E, 0x39, 0xB5, 0xD0, 0x5F, 0xB9, 0x0B, 0x59,
+    0x82, 0x95, 0x3E, 0x3D, 0x18, 0xF7, 0x17, 0x1B, 0x2D, 0xBF, 0x5C, 0x8D, 0x9D, 0x64, 0x72, 0xE2,
+    0x27, 0xC0, 0xBC, 0x5B, 0xD7, 0xA3, 0x82, 0x4D, 0x5A, 0x3F, 0x86, 0xC5, 0xE4, 0x7C, 0xEB, 0xC3,
+    0x27, 0x54, 0xF4, 0x9A, 0xC7, 0x83, 0x7D, 0xCA, 0xD8, 0xCF, 0x62, 0x63, 0xFD, 0x36, 0x43, 0xEC,
+    0x61, 0xAB, 0x0F, 0xA2, 0xE7, 0x00, 0x5C, 0xE5, 0xF1, 0x7D, 0x34, 0xFD, 0xF5, 0xAA, 0x18, 0xED,
+    0xE3, 0x62, 0x79, 0x30, 0xC1, 0x4F, 0x0C, 0xC1, 0x54, 0x14, 0xB5, 0xFE, 0xF0, 0xB1, 0x0D, 0x90,
+    0x31, 0x8F, 0x0C, 0x65, 0x79, 0x44, 0x63, 0x9D, 0x1F, 0xAE, 0x3B, 0x82, 0x1D, 0xA0, 0xB5, 0x65,
+    0xFE, 0x4A, 0x4B, 0xB2, 0x7D, 0xB6, 0xCC, 0x8C, 0x9C, 0xAB, 0x60, 0xAB, 0x2E, 0x8F, 0x17, 0x6F,
+    0x1D, 0x67, 0xED, 0x37, 0x73, 0x35, 0x9C, 0x11, 0xDF, 0x34, 0x0B, 0x6A, 0xBA, 0xEB, 0x07, 0xDA,
+    0x56, 0x8D, 0xAD, 0x2E, 0x1F, 0x92, 0xA8, 0x21, 0xCF, 0x01, 0x2B, 0xA3, 0x32, 0x03, 0xF9, 0xCF,
+    0xE7, 0x2F, 0x95, 0x55, 0x3F, 0x6F, 0xDF, 0x54, 0x14, 0x3D, 0xB6, 0x09, 0x96, 0xB0, 0xD0, 0x63,
+    0xC9, 0xD2, 0x82, 0xCC, 0x88, 0x22, 0xB5, 0x5E, 0x18, 0x18, 0x9A, 0xDA, 0xA8, 0x03, 0x23, 0x19,
+    0x12, 0xC4, 0x57, 0x28, 0x03, 0x5D, 0x18, 0x18, 0xAA, 0xF8, 0x27, 0xF8, 0x00, 0x04, 0x3E, 0x43,
+    0x17, 0x58, 0xDA, 0x81, 0x81, 0x21, 0xA9, 0x4D, 0x32, 0xB0, 0x1A, 0x3E, 0x81, 0x51, 0x17, 0x26,
+    0x78, 0x48, 0x16, 0x75, 0x8A, 0xED, 0xCB, 0x39, 0xCF, 0x49, 0x08, 0x12, 0x0C, 0xD8, 0x3F, 0xDF,
+    0x9F, 0x9F, 0x7D, 0x7D, 0xFF, 0x9C, 0x7B, 0xEE, 0x7D, 0xC0, 0x3E, 0xA2, 0x19, 0xF1, 0x84, 0x84,
+    0xBF, 0x01, 0xA9, 0x87, 0xE3, 0xAF, 0x47, 0xDE, 0xA1, 0x68, 0x51, 0x6E, 0x50, 0x56, 0x68, 0x00,
+    0x03, 0x66, 0x44, 0x53, 0x50, 0x1C, 0x91, 0x0E, 0xC8, 0x82, 0x96, 0x5B, 0xB5, 0x5A, 0x69, 0xD5,
+    0x90, 0x22, 0xB0, 0xF3, 0x88, 0xC2, 0x16, 0x20, 0xB5, 0x19, 0xC8, 0x6D, 0x00, 0x22, 0x6B, 0x81,
+    0x84, 0x36, 0xE0, 0x46, 0x8A, 0xBA, 0xBB, 0x5C, 0x4D, 0x5A, 0xF5, 0x40, 0x6C, 0x1B, 0x20, 0x33,
+    0x0F, 0x14, 0x52, 0x2D, 0x17, 0x3D, 0x1A, 0xB4, 0xE2, 0xF3, 0xF0, 0x4E, 0x9A, 0xA5, 0xC7, 0xC5,
+    0x6A, 0xBE, 0xB6, 0xDA, 0x7A, 0xCC, 0x77, 0xA5, 0xF5, 0xAB, 0xD3, 0x4C, 0x37, 0xE5, 0x2F, 0xB8,
+    0x38, 0xE2, 0x7E, 0x37, 0x1F, 0xEF, 0x96, 0xF3, 0xC9, 0x61, 0x3D, 0x9D, 0x14, 0xC3, 0x31, 0x63,
+    0x86, 0x9C, 0x8F, 0x70, 0xD6, 0xA1, 0x36, 0x86, 0xC6, 0xA4, 0xE9, 0x33, 0xE7, 0xB7, 0xCD, 0x40,
+    0xAF, 0x2D, 0xFE, 0xE3, 0x88, 0x78, 0x7D, 0x42, 0x07, 0x2D, 0xBF, 0x59, 0x13, 0x29, 0xBB, 0x70,
+    0xAB, 0xD8, 0x8A, 0x3E, 0xC4, 0x92, 0x30, 0x30, 0xE2, 0x87, 0xBA, 0x45, 0xAC, 0x60, 0x98, 0x02,
+    0xC1, 0x11, 0x7A, 0x44, 0x4D, 0x98, 0x0A, 0xA2, 0x98, 0xBA, 0xAF, 0x5E, 0x99, 0x4D, 0xF8, 0x30,
+    0x6D, 0xD7, 0x8B, 0xB6, 0xE1, 0x98, 0xDF, 0x03, 0x42, 0xCC, 0x64, 0x4A, 0x02, 0x68, 0x76, 0x1C,
+    0xDB, 0x53, 0xA4, 0xF3, 0x2E, 0xB2, 0xF1, 0x21, 0xDC, 0x70, 0x8C, 0xDC, 0x8F, 0x28, 0xFB, 0x61,
+    0xBD, 0x7E, 0xF7, 0x28, 0xFF, 0x98, 0xA9, 0x6A, 0x84, 0xDA, 0x36, 0xA9, 0x31, 0xAD, 0x66, 0xF9,
+    0xDB, 0x94, 0xAB, 0xE8, 0x97, 0x6E, 0xB6, 0xAE, 0x65, 0xB2, 0x27, 0x60, 0x08, 0x01, 0x85, 0x20,
+    0x37, 0x63, 0xD2, 0xC5, 0x79, 0x3A, 0x8B, 0x03, 0xD4, 0x63, 0x2D, 0x19, 0x96, 0xD0, 0x45, 0x19,
+    0x22, 0x1C, 0xC2, 0x6D, 0x78, 0xAA, 0xF2, 0xD1, 0x8F, 0x11, 0x42, 0x7D, 0x4B, 0xB7, 0xF4, 0x95,
+    0x4C, 0x41, 0x41, 0xC8, 0x85, 0xDB, 0x50, 0x6E, 0x01, 0x2B, 0x07, 0x15, 0x82, 0x56, 0xA5, 0x0F,
+    0x26, 0x22, 0xCE, 0x00, 0x33, 0x93, 0x05, 0x40, 0x16, 0x99, 0xF6, 0x13, 0x96, 0xF9, 0xD9, 0x88,
+    0xC6, 0x98, 0x6E, 0x2D, 0xA5, 0x62, 0x51, 0x6D, 0x7A, 0x1A, 0x6C, 0x36, 0x14, 0x56, 0x35, 0x14,
+    0x9F, 0x11, 0x5E, 0x7E, 0x16, 0xEC, 0x54, 0x0A, 0xA1, 0x2D, 0x65, 0x2B, 0x7F, 0xBE, 0x58, 0x95,
+    0x6D, 0xF0, 0x50, 0xF5, 0x79, 0x0D, 0x38, 0x80, 0x2E, 0x72, 0x23, 0x16, 0x18, 0x81, 0x58, 0xD6,
+    0x27, 0x94, 0xC5, 0x24, 0x99, 0xD8, 0x0F, 0x22, 0x10, 0x7D, 0x09, 0x9B, 0x20, 0xE3, 0x20, 0xE9,
+    0x59, 0xD2, 0x29, 0x5E, 0x3D, 0x42, 0x50, 0x6A, 0x83, 0x54, 0x41, 0x15, 0x1C, 0x76, 0x1E, 0x2F,
+    0x2B, 0x7D, 0xAA, 0xCB, 0x2C, 0xF1, 0x91, 0x00, 0x57, 0x86, 0x43, 0x90, 0xF3, 0x0A, 0x4F, 0x25,
+    0x25, 0xD9, 0x83, 0xDE, 0xD2, 0x48, 0x40, 0xF3, 0xC6, 0xA3, 0x15, 0xFF, 0x6F, 0xE1, 0xD8, 0x31,
+    0x88, 0x46, 0x64, 0xDD, 0xB5, 0xFF, 0x80, 0xC7, 0xD5, 0x91, 0x55, 0x98, 0x90, 0xF6, 0x28, 0xF4,
+    0xCF, 0x6A, 0xE4, 0x97, 0xFF, 0x1B, 0x9C, 0x04, 0x2E, 0xF2, 0xB8, 0x79, 0x1E, 0x42, 0x1E, 0xE5,
+    0x4D, 0x8E, 0xEA, 0x2F, 0x9F, 0x72, 0xDD, 0x25, 0x0C, 0x6C, 0x12, 0x18, 0xEE, 0x3C, 0xC4, 0xA9,
+    0x70, 0x42, 0x68, 0xB5, 0x72, 0x71, 0xF3, 0x03, 0xAB, 0xE2, 0x59, 0x4D, 0xCC, 0x9A, 0x96, 0xAA,
+    0x69, 0xE6, 0xD7, 0xD8, 0x93, 0x40, 0x85, 0xFC, 0x22, 0x63, 0xD5, 0xFA, 0xA6, 0x80, 0x20, 0xEB,
+    0x80, 0x8D, 0x58, 0x5C, 0x1E, 0xD5, 0x5E, 0xB0, 0xAD, 0xAA, 0x7A, 0x1D, 0xA0, 0x10, 0xA1, 0x92,
+    0x25, 0x99, 0x53, 0x9E, 0x6E, 0x76, 0x53, 0xCE, 0xB3, 0x0C, 0x67, 0x3D, 0x6D, 0xEF, 0x6F, 0xEF,
+    0xE3, 0x65, 0x0E, 0x0F, 0x7E, 0x94, 0xBF, 0x98, 0x39, 0x6C, 0x46, 0xF7, 0xDB, 0xA9, 0xAF, 0xBB,
+    0xF4, 0x74, 0x41, 0xE1, 0x4E, 0xDE, 0x1D, 0x8A, 0x3A, 0x6F, 0x0F, 0x63, 0x51, 0xBD, 0x83, 0x9C,
+    0xDE, 0x5F, 0xF3, 0xFF, 0x35, 0xB1, 0x6E, 0xD8, 0x7D, 0x23, 0x39, 0x6B, 0xEF, 0xBC, 0x9D, 0x9E,
+    0xD9, 0x58, 0xDA, 0x66, 0x21, 0x80, 0x2F, 0x29, 0xF9, 0xB7, 0xF0, 0x3A, 0xA2, 0x01, 0xC7, 0x8C,
+    0x3C, 0x1D, 0x39, 0x4F, 0x0A, 0x1F, 0x5B, 0x64, 0x9B, 0x7C, 0x64, 0x2F, 0x96, 0x2D, 0x9B, 0xB1,
+    0xE9, 0x48, 0x81, 0xC6, 0x97, 0xEC, 0x94, 0x29, 0x9F, 0xE1, 0x16, 0x72, 0x21, 0x99, 0xD8, 0x93,
+    0x04, 0x9B, 0x14, 0x7D, 0x82, 0x77, 0x80, 0x37, 0x09, 0x51, 0xF1, 0xF5, 0x5E, 0x48, 0x9D, 0xD7,
+    0x24, 0xEE, 0x6D, 0x7F, 0xA0, 0x69, 0xA2, 0xE6, 0xCE, 0x35, 0x7E, 0xFC, 0x3A, 0x66, 0xCA, 0x30,
+    0x35, 0xB6, 0x0F, 0x0E, 0x0E, 0x44, 0x65, 0x71, 0xA1, 0x11, 0x4F, 0xAF, 0x65, 0x65, 0x7E, 0x74,
+    0xC3, 0x57, 0xFE, 0xF0, 0xEC, 0xBD, 0xD3, 0xE7, 0x23, 0xB3, 0xEA, 0xC6, 0xF2, 0xD9, 0x17, 0x6D,
+    0xF3, 0xFE, 0x02, 0x6B, 0xFA, 0x48, 0x4D, 0xD2, 0x04, 0x3A, 0x44, 0xDF, 0x34, 0x3F, 0x92, 0x2B,
+    0xA1, 0x1A, 0x3A, 0xF6, 0xC5, 0x17, 0x4E, 0x58, 0xEB, 0xD4, 0x8B, 0xE9, 0x92, 0x79, 0x37, 0xA4,
+    0x43, 0xEE, 0x33, 0x9F, 0xF7, 0xB9, 0x2F, 0x5E, 0x90, 0xE0, 0x2C, 0x89, 0x0B, 0x0D, 0xC7, 0xA0,
+    0x9A, 0xA3, 0xC0, 0xA3, 0x23, 0xFC, 0xA3, 0xE9, 0xB2, 0xD0, 0xA0, 0xAA, 0x54, 0xE8, 0x31, 0x11,
+    0x70, 0x13, 0x87, 0xFE, 0xBC, 0xD0, 0x6A, 0x54, 0x24, 0xE7, 0x2F, 0xB5, 0xF0, 0xCA, 0xD1, 0xBF,
+    0x0D, 0xB8, 0xED, 0x0F, 0x03, 0xDB, 0x3B, 0x19, 0x58, 0x42, 0x81, 0xFB, 0xCB, 0x57, 0x1F, 0x13,
+    0xC6, 0xE4, 0x5E, 0x07, 0x0E, 0xA1, 0x36, 0x1E, 0x58, 0x43, 0xAB, 0x0A, 0x4B, 0x2C, 0x58, 0xBC,
+    0xCF, 0xD6, 0x8A, 0xA2, 0x1E, 0xB7, 0x38, 0x00, 0x09, 0x18, 0x87, 0xCE, 0x77, 0x85, 0xDD, 0xB3,
+    0xBE, 0x10, 0x7F, 0x48, 0x57, 0xD7, 0xBA, 0x9E, 0x65, 0x1A, 0x34, 0x3B, 0x22, 0x55, 0x41, 0xA3,
+    0x31, 0x0D, 0x1B, 0x0E, 0x71, 0x96, 0x1C, 0xC4, 0xC1, 0xDC, 0x2B, 0x8F, 0x22, 0xEC, 0x3F, 0xC4,
+    0x9B, 0x4B, 0x6E, 0x13, 0x5C, 0xB2, 0xF7, 0xB9, 0x24, 0x2D, 0xEB, 0x3E, 0x34, 0xB3, 0xCF, 0x88,
+    0x97, 0x06, 0x48, 0x15, 0xDB, 0xE5, 0x20, 0x32, 0x8E, 0x4B, 0xC5, 0x9C, 0xFD, 0x29, 0x60, 0xDD,
+    0xCF, 0x0A, 0x3C, 0x6F, 0xAF, 0xF0, 0xC1, 0xCE, 0x45, 0x67, 0xDD, 0x58, 0x38, 0x82, 0x9D, 0xFD,
+    0x44, 0xE7, 0x36, 0x69, 0xB2, 0xD8, 0xE7, 0xA3, 0x76, 0xA8, 0x5A, 0x53, 0x25, 0x34, 0x41, 0x2F,
+    0x83, 0x33, 0x77, 0x89, 0xD2, 0xBE, 0x67, 0x89, 0x6C, 0xE4, 0xF6, 0x96, 0x9A, 0x50, 0xAC, 0x3D,
+    0x37, 0xC3, 0x6C, 0x61, 0xD7, 0x30, 0x18, 0x4E, 0xF1, 0x62, 0x62, 0xA0, 0x6C, 0x72, 0x95, 0xD6,
+    0x07, 0xB3, 0xDC, 0x1B, 0x63, 0xD3, 0xD4, 0x22, 0x56, 0x1A, 0xE0, 0x6D, 0xCD, 0x40, 0x47, 0x9A,
+    0xCD, 0x0D, 0x32, 0xEB, 0x69, 0xB6, 0x56, 0x03, 0x50, 0x2D, 0x59, 0x32, 0x76, 0x4A, 0xC1, 0x0E,
+    0x61, 0x77, 0x8C, 0x24, 0xF2, 0x5D, 0xE6, 0xEA, 0x96, 0x2D, 0x77, 0xCA, 0x10, 0x7C, 0x1D, 0x80,
+    0xCF, 0x5B, 0xD7, 0x6D, 0x79, 0xDC, 0xC1, 0x6D, 0x4E, 0xF1, 0xA4, 0x8D, 0x98, 0xF9, 0x99, 0xF5,
+    0x07, 0x7B, 0x2C, 0x27, 0xC7, 0xD4, 0x78, 0x3B, 0x6D, 0x3F, 0xBD, 0x15, 0xF7, 0x63, 0x41, 0x66,
+    0x64, 0xD6, 0xAE, 0x24, 0xF8, 0xBF, 0xC7, 0x5F, 0xDD, 0x54, 0x31, 0x8E, 0xD5, 0x30, 0x10, 0x7D,
+    0x4E, 0xB4, 0x7C, 0xA4, 0x14, 0xA9, 0x28, 0xA8, 0xC2, 0x05, 0x20, 0x0D, 0x25, 0x8B, 0xAD, 0xE5,
+    0x02, 0x5B, 0xEC, 0x52, 0x6C, 0x45, 0x8D, 0x90, 0x38, 0x01, 0xCA, 0x17, 0x2D, 0x97, 0xA0, 0x44,
+    0xD0, 0x70, 0x01, 0xD6, 0x91, 0xB8, 0x40, 0x24, 0x24, 0xEA, 0xCF, 0x8A, 0x03, 0x44, 0x28, 0x45,
+    0x10, 0x4E, 0x86, 0x79, 0xE3, 0x80, 0xB6, 0xA1, 0xA0, 0x04, 0x4B, 0x89, 0xE3, 0x49, 0x3C, 0xF3,
+    0xDE, 0x9B, 0xE7, 0x04, 0xE8, 0x78, 0x8F, 0xFB, 0xC0, 0x31, 0x5A, 0xC0, 0xF7, 0xCD, 0x80, 0x66,
+    0xAA, 0x13, 0xCA, 0xD5, 0x49, 0x40, 0x37, 0xF8, 0x03, 0xEA, 0xB1, 0x9A, 0x51, 0xA7, 0x6A, 0x81,
+    0x9F, 0x9B, 0x84, 0x38, 0xFA, 0xC9, 0x49, 0x2F, 0x07, 0x48, 0x88, 0x3D, 0x2E, 0xE1, 0x81, 0x07,
+    0xB8, 0x0B, 0xDC, 0xC1, 0x4D, 0xC0, 0xBD, 0x81, 0x8D, 0xEE, 0x60, 0x53, 0xA9, 0x49, 0x00, 0xD1,
+    0xED, 0x3A, 0x55, 0x23, 0x1E, 0x8D, 0x3A, 0x47, 0xA0, 0xD5, 0x70, 0x35, 0x01, 0x0C, 0x77, 0x01,
+    0xA5, 0x86, 0x77, 0x33, 0xD0, 0xEC, 0x89, 0x01, 0x58, 0x74, 0xA7, 0xBE, 0x62, 0x98, 0xCB, 0x76,
+    0x40, 0xB9, 0x20, 0x34, 0x92, 0xF4, 0xB1, 0x09, 0x51, 0x0E, 0xC5, 0xEA, 0x52, 0x29, 0x12, 0x9A,
+    0xB1, 0x61, 0x46, 0x27, 0x85, 0xE8, 0x56, 0x85, 0xDA, 0xBE, 0x60, 0x59, 0x39, 0xF9, 0x36, 0x71,
+    0x39, 0xB5, 0x75, 0xCF, 0xE5, 0xCB, 0xA9, 0x63, 0xC1, 0xD4, 0x0A, 0xF1, 0xC4, 0x5E, 0x34, 0x93,
+    0x2E, 0xDD, 0x45, 0x7C, 0xAD, 0xF5, 0x07, 0x14, 0xBA, 0xDC, 0x69, 0xD1, 0x5A, 0x51, 0x7B, 0x5E,
+    0x01, 0xC5, 0x9A, 0x89, 0xFC, 0x66, 0xB4, 0xDB, 0x02, 0x99, 0xD2, 0x5B, 0xCD, 0xDA, 0x67, 0xF0,
+    0xC6, 0x49, 0xE7, 0x82, 0x25, 0xBB, 0x7D, 0x26, 0xE5, 0xC9, 0x04, 0x19, 0xFE, 0x2F, 0x56, 0xF5,
+    0x90, 0x67, 0xD2, 0x52, 0x4A, 0x28, 0x16, 0xCE, 0x17, 0x99, 0xD7, 0x95, 0x2C, 0x95, 0xAC, 0x68,
+    0x46, 0x91, 0x8F, 0x46, 0xEC, 0x98, 0x9F, 0x29, 0x23, 0xE0, 0x83, 0x51, 0xC9, 0xF9, 0x38, 0xB7,
+    0xCC, 0x35, 0xE7, 0x1C, 0xDA, 0x1A, 0xD3, 0xBA, 0xD2, 0xA2, 0x31, 0xCF, 0x4E, 0x5B, 0x83, 0x5D,
+    0x42, 0x21, 0x83, 0xB1, 0x72, 0xA2, 0x0F, 0x64, 0x27, 0x32, 0x6A, 0x5F, 0xF5, 0x7B, 0xAD, 0x47,
+    0x7A, 0x47, 0xE7, 0x67, 0x9A, 0xF1, 0x34, 0xD3, 0x8A, 0xCB, 0xC6, 0x2E, 0xD9, 0x7C, 0x1B, 0x9A,
+    0xB8, 0xE4, 0x75, 0xD8, 0x48, 0x04, 0x53, 0xE9, 0x5D, 0xB2, 0xFA, 0xB5, 0xCA, 0xED, 0x74, 0x87,
+    0xD7, 0x34, 0x8D, 0x7E, 0xA1, 0xCF, 0x8E, 0xFA, 0x94, 0x93, 0x21, 0x0E, 0xFA, 0x89, 0x28, 0x48,
+    0xD1, 0xCE, 0x4F, 0x55, 0xE8, 0x64, 0x42, 0x0C, 0x8B, 0x36, 0x6C, 0x5F, 0xCD, 0xF5, 0x78, 0x43,
+    0xBE, 0x22, 0xEE, 0x4D, 0xBE, 0x5D, 0xAA, 0x2F, 0xCD, 0x2E, 0xFD, 0x77, 0xAA, 0x57, 0x2E, 0xF5,
+    0x2B, 0x86, 0xFD, 0x30, 0x93, 0x6C, 0xB9, 0xD6, 0x9F, 0x57, 0x55, 0xBB, 0x3D, 0x88, 0x68, 0xB1,
+    0x42, 0x4A, 0x52, 0x40, 0x3B, 0xE2, 0xB1, 0x86, 0x69, 0x50, 0xB5, 0x94, 0xFA, 0x35, 0xCB, 0x4D,
+    0x07, 0x2C, 0x59, 0x91, 0xAD, 0x63, 0x56, 0x22, 0x32, 0x71, 0x25, 0x66, 0x8B, 0x81, 0x0A, 0x1A,
+    0x41, 0xB3, 0xCB, 0xD1, 0x29, 0xFE, 0x38, 0x9E, 0xB1, 0xF5, 0xD1, 0x5A, 0x7C, 0x2D, 0x01, 0x5D,
+    0x5D, 0x53, 0xA9, 0x82, 0xB9, 0x0B, 0x13, 0xCB, 0x3C, 0xE5, 0x99, 0xB0, 0xE6, 0x53, 0x76, 0x22,
+    0x5D, 0x64, 0x4D, 0xD1, 0xF7, 0xF4, 0xCB, 0x66, 0x53, 0xAE, 0x5B, 0xBE, 0xA2, 0xFE, 0x4F, 0x18,
+    0xD5, 0x93, 0x20, 0xA1, 0x4B, 0x5A, 0x40, 0xD5, 0xD1, 0x34, 0xC4, 0x18, 0x0D, 0xE8, 0xD3, 0x70,
+    0x0D, 0x4E, 0x4E, 0x95, 0x3D, 0xB7, 0x51, 0x70, 0x79, 0xD1, 0x2C, 0x7F, 0x60, 0x60, 0xE0, 0xD1,
+    0xB1, 0x30, 0xBC, 0xED, 0x68, 0xAD, 0x7E, 0x93, 0x65, 0x10, 0xA3, 0xF5, 0x63, 0xB5, 0x2E, 0x10,
+    0x73, 0xB9, 0xAA, 0xB0, 0x0A, 0x9F, 0xA5, 0x9C, 0x9C, 0x88, 0x95, 0x63, 0x92, 0xD8, 0xB7, 0x13,
+    0x5D, 0x46, 0x0F, 0xF9, 0xD1, 0xE9, 0xB7, 0xED, 0x72, 0xAE, 0x66, 0xD3, 0xF6, 0xAA, 0x00, 0xBC,
+    0x8B, 0xC1, 0x97, 0xBE, 0xE4, 0x7D, 0xB4, 0xFB, 0x42, 0x85, 0x76, 0x12, 0x54, 0x32, 0x35, 0x24,
+    0xDB, 0xD6, 0xCD, 0x91, 0x47, 0x5C, 0x32, 0x3A, 0x1E, 0x06, 0x98, 0xA5, 0x08, 0x32, 0x87, 0xEC,
+    0x9F, 0x51, 0xE6, 0x50, 0x0C, 0xF8, 0xDB, 0x51, 0x5D, 0x97, 0x25, 0x33, 0xAE, 0x6C, 0xE1, 0xC4,
+    0x34, 0xF2, 0x46, 0x3C, 0x53, 0x76, 0x62, 0x1D, 0xF2, 0x57, 0x62, 0x1B, 0xC9, 0x7C, 0xE3, 0xEC,
+    0x47, 0x2E, 0xAA, 0x54, 0x08, 0x2D, 0xB6, 0x37, 0x77, 0x19, 0xE9, 0x4A, 0xCE, 0x9F, 0xCF, 0x6C,
+    0xB7, 0x12, 0x65, 0xA3, 0x24, 0x6D, 0xAC, 0x2D, 0x94, 0x2C, 0x24, 0x03, 0x8D, 0xA2, 0x2D, 0xC9,
+    0xB4, 0x09, 0xA2, 0x59, 0x2B, 0x1E, 0x16, 0x2A, 0x60, 0x87, 0x89, 0xDC, 0xF6, 0x46, 0x77, 0xCD,
+    0x07, 0xCE, 0xFC, 0x1A, 0xED, 0x7D, 0x33, 0xEA, 0xCF, 0x88, 0x0A, 0xF0, 0x37, 0x72, 0x0B, 0x38,
+    0xFB, 0x97, 0xC8, 0xE1, 0x5E, 0xEE, 0x62, 0x7A, 0x68, 0xE7, 0xE3, 0x13, 0x63, 0xDE, 0x13, 0xDC,
+    0xEE, 0x8B, 0x21, 0x7D, 0x51, 0x1D, 0xFE, 0xD9, 0xCE, 0xFD, 0xA7, 0xE3, 0x27, 0xD5, 0x55, 0x3B,
+    0x8E, 0xD4, 0x40, 0x10, 0xED, 0xB1, 0xB5, 0x9A, 0xA0, 0x03, 0x47, 0x1B, 0x11, 0xF8, 0x08, 0x3E,
+    0x82, 0x7D, 0x84, 0x09, 0xC6, 0x11, 0x37, 0xD8, 0x84, 0x23, 0xD8, 0x22, 0x25, 0x21, 0xD9, 0x4B,
+    0x0C, 0x01, 0x29, 0x01, 0xC2, 0x46, 0x1C, 0x80, 0x41, 0x62, 0x73, 0x8B, 0x8C, 0x8D, 0x8C, 0x64,
+    0x24, 0x0B, 0x6C, 0x17, 0xF5, 0x5E, 0xF5, 0x8C, 0x17, 0x69, 0x27, 0x40, 0x24, 0x60, 0x69, 0x5C,
+    0xBD, 0xDE, 0xFA, 0xBC, 0xF7, 0xAA, 0xBB, 0xCB, 0x39, 0x17, 0x2F, 0xF1, 0xE2, 0x60, 0xB6, 0x30,
+    0x7E, 0xF6, 0xB3, 0x9A, 0x64, 0x4E, 0x60, 0xB2, 0x29, 0x9B, 0xD4, 0xE4, 0x53, 0x0E, 0x73, 0xBD,
+    0xBF, 0xDE, 0xBB, 0x4B, 0x4F, 0xD3, 0xE2, 0xBD, 0x11, 0x9A, 0xD8, 0x8C, 0x37, 0x93, 0xCA, 0x11,
+    0x26, 0x37, 0xD3, 0x34, 0x1D, 0x1D, 0xF3, 0x8E, 0x55, 0xB3, 0x1E, 0x8E, 0x13, 0x4D, 0x3A, 0xD0,
+    0xE4, 0x3D, 0x4D, 0xD3, 0x66, 0x03, 0x1C, 0xEB, 0x74, 0x40, 0x46, 0x97, 0x8E, 0xC8, 0x58, 0x3E,
+    0x53, 0x93, 0x88, 0xC8, 0x84, 0x8C, 0x34, 0x8D, 0x19, 0xA1, 0x89, 0x61, 0x66, 0x75, 0xD4, 0x74,
+    0xB3, 0x4B, 0x94, 0x53, 0xBA, 0x38, 0xC0, 0x57, 0xD3, 0x8C, 0x00, 0x43, 0xB8, 0xD1, 0x68, 0x38,
+    0x6B, 0x60, 0xF9, 0x89, 0x72, 0x6E, 0x9E, 0x88, 0x72, 0x31, 0xE4, 0xF4, 0x7A, 0x77, 0x81, 0xAC,
+    0xA7, 0xEB, 0x56, 0x56, 0xAE, 0x91, 0xF4, 0x64, 0x05, 0xD5, 0x14, 0x49, 0x71, 0x26, 0x5A, 0x7D,
+    0x44, 0xA5, 0xFC, 0x0B, 0x7C, 0xB3, 0x1E, 0x2A, 0x19, 0xCB, 0x64, 0x42, 0x12, 0x3F, 0x45, 0xEA,
+    0xAB, 0xCA, 0x57, 0xC7, 0x40, 0x31, 0x92, 0xBB, 0xA7, 0x8B, 0x91, 0x69, 0xF9, 0xEE, 0x03, 0x3F,
+    0x90, 0x15, 0x7B, 0x1F, 0xD1, 0x95, 0x6A, 0x30, 0x72, 0x89, 0x00, 0xC9, 0x0B, 0x65, 0xB2, 0x21,
+    0x06, 0xE7, 0xCA, 0xC3, 0x41, 0x26, 0xEB, 0x86, 0x3E, 0x83, 0x41, 0x65, 0x26, 0x67, 0xD2, 0x59,
+    0x5B, 0x72, 0x59, 0x6E, 0x0B, 0x67, 0x78, 0x2D, 0x50, 0x8B, 0x9F, 0x56, 0xDB, 0x59, 0x3A, 0x5B,
+    0xA5, 0xDF, 0xAC, 0x6F, 0x1A, 0xF0, 0x49, 0xEE, 0x4A, 0x46, 0xC8, 0x73, 0x4D, 0x52, 0x33, 0x40,
+    0x43, 0xC8, 0xD6, 0xCF, 0x58, 0x31, 0x60, 0xD4, 0x1E, 0x50, 0xC5, 0xBC, 0xDF, 0x4A, 0xA8, 0xD0,
+    0x06, 0x45, 0xD9, 0x1E, 0xD3, 0xF0, 0xBC, 0x4A, 0xB1, 0x2A, 0x91, 0xB9, 0x12, 0x09, 0xF0, 0xE4,
+    0xB4, 0x8A, 0xB5, 0x66, 0xC3, 0x15, 0x88, 0xDA, 0x2A, 0x9B, 0x4F, 0x02, 0x55, 0xA3, 0x91, 0x6C,
+    0x1F, 0x6D, 0xD3, 0x13, 0xF9, 0x0A, 0xD5, 0x05, 0x54, 0x32, 0xEC, 0x0A, 0xB2, 0x6F, 0x09, 0x62,
+    0x44, 0x8A, 0xFB, 0xD7, 0x90, 0xA1, 0x26, 0x1A, 0x92, 0x34, 0xB5, 0xF2, 0xD9, 0x34, 0x63, 0xD6,
+    0x66, 0x30, 0xD9, 0x4C, 0xD0, 0x6E, 0xFD, 0x7F, 0x1C, 0xB6, 0x75, 0x70, 0x56, 0xE1, 0x0A, 0x25,
+    0xF0, 0xF9, 0xEA, 0x8D, 0xA9, 0x5D, 0xB3, 0x57, 0xC3, 0x89, 0x71, 0x6A, 0x0D, 0xB0, 0x3F, 0xF0,
+    0xAD, 0xA3, 0x04, 0x0C, 0x7E, 0x4B, 0xB4, 0x49, 0x6D, 0x2D, 0x30, 0xAD, 0xB9, 0x3F, 0xAF, 0xEC,
+    0xDB, 0xEF, 0x10, 0x8A, 0x07, 0x0C, 0x83, 0x77, 0x68, 0x28, 0x7B, 0x97, 0x06, 0x3C, 0xC5, 0xC5,
+    0xA3, 0xEA, 0x6E, 0x0E, 0x5A, 0x37, 0x3A, 0x1F, 0x97, 0x81, 0x80, 0x7B, 0xE7, 0x97, 0xDB, 0x1D,
+    0x36, 0x26, 0x8B, 0xB1, 0x7E, 0x36, 0xAC, 0x79, 0xF3, 0xEF, 0xE5, 0x4B, 0x76, 0xE8, 0xC8, 0x36,
+    0x58, 0x8F, 0x5A, 0xCA, 0x5F, 0x68, 0xB2, 0x9A, 0x8A, 0xAC, 0xC7, 0xC2, 0x73, 0x07, 0x24, 0x4B,
+    0x59, 0xEE, 0xA8, 0x7A, 0x4F, 0x05, 0x3A, 0x8A, 0x72, 0x7A, 0x57, 0x7C, 0x37, 0x26, 0x06, 0xE2,
+    0x59, 0xCE, 0x1B, 0x0D, 0xA3, 0x44, 0xFE, 0x4C, 0x18, 0xCD, 0xEE, 0xCF, 0x9F, 0x7F, 0x94, 0x29,
+    0x4B, 0x46, 0xCB, 0x7A, 0x05, 0x25, 0xFC, 0x9E, 0xF1, 0xD8, 0x56, 0xEF, 0xD1, 0x3B, 0xBD, 0x0C,
+    0xF4, 0xD3, 0xDE, 0x6D, 0x76, 0xFF, 0x05, 0x23, 0xA9, 0x91, 0x25, 0xEF, 0x2A, 0x1C, 0xB5, 0x01,
+    0xB5, 0x6D, 0x84, 0x78, 0xF1, 0xDC, 0xEF, 0x1F, 0x50, 0xB4, 0xDC, 0x95, 0xBB, 0xCB, 0xBD, 0xDA,
+    0x1C, 0x5E, 0x29, 0x9D, 0xE8, 0x7C, 0x99, 0xCF, 0x76, 0x1F, 0x68, 0xBE, 0x1F, 0xB8, 0x1B, 0x8C,
+    0x1B, 0x67, 0x95, 0x8B, 0x6C, 0x77, 0x87, 0x6D, 0x4F, 0x72, 0x29, 0x6F, 0x3A, 0xCF, 0xE0, 0x98,
+    0x61, 0xC6, 0xCE, 0x35, 0xDD, 0x83, 0xB3, 0x31, 0xAD, 0xF4, 0x62, 0xB9, 0x2D, 0xF7, 0xA7, 0x03,
+    0x59, 0x9D, 0x0F, 0x6C, 0x47, 0xC6, 0x23, 0x65, 0x5D, 0x88, 0x86, 0xF2, 0x04, 0x59, 0x51, 0x9E,
+    0x33, 0xAE, 0xE9, 0x31, 0x1D, 0x1F, 0xE5, 0x11, 0xDF, 0x9B, 0x9A, 0x98, 0xA7, 0x18, 0xA6, 0x00,
+    0xCE, 0x1F, 0xA6, 0xCF, 0x80, 0x29, 0x60, 0x70, 0x30, 0x00, 0xAB, 0xA3, 0x4D, 0x4E, 0xB6, 0x04,
+    0x37, 0x78, 0x4D, 0x6E, 0xB1, 0x58, 0x0A, 0x68, 0x87, 0x5B, 0x1E, 0x4A, 0xE2, 0x5C, 0x63, 0x8E,
+    0xE1, 0xA7, 0xD7, 0x9E, 0xBB, 0x19, 0xDD, 0xDF, 0x3F, 0xBF, 0x00, 0xE5, 0x54, 0x3B, 0x8E, 0xD5,
+    0x40, 0x10, 0x6C, 0x3F, 0x4B, 0xEB, 0x60, 0x02, 0x47, 0x90, 0x10, 0xF8, 0x08, 0xBE, 0x01, 0xF6,
+    0x0D, 0xD8, 0xE0, 0xBD, 0x88, 0x1B, 0x10, 0xB0, 0x47, 0xB0, 0x25, 0x2E, 0x40, 0x40, 0xCE, 0xC6,
+    0x24, 0x1C, 0x61, 0x46, 0xA4, 0x24, 0x3E, 0x82, 0x09, 0x10, 0x88, 0x04, 0x0B, 0x2C, 0x61, 0x90,
+    0xED, 0xA6, 0xAA, 0x67, 0x9E, 0xC4, 0x22, 0x2D, 0x42, 0x44, 0x08, 0x46, 0xB2, 0xDB, 0x9F, 0xEE,
+    0x9A, 0xEA, 0xEA, 0xEE, 0x11, 0x91, 0x32, 0x88, 0xE4, 0xB3, 0x88, 0x78, 0x5C, 0x15, 0x5F, 0x16,
+    0x3C, 0xA8, 0xFC, 0xFE, 0xBA, 0x7F, 0x8D, 0x20, 0x06, 0x74, 0xA3, 0x88, 0xDB, 0x18, 0x0D, 0x98,
+    0x72, 0xE5, 0x43, 0x0F, 0x4C, 0x80, 0x1F, 0xF8, 0xBB, 0x99, 0xE0, 0xB7, 0xD3, 0x6F, 0x80, 0xDF,
+    0x7A, 0xF6, 0xC3, 0x76, 0x19, 0xFD, 0xEA, 0x39, 0xC1, 0xD0, 0xCF, 0xF1, 0x41, 0x81, 0x57, 0x6E,
+    0xFC, 0x8D, 0x80, 0x66, 0xE5, 0x6F, 0x04, 0x74, 0x08, 0xB8, 0x78, 0x89, 0x00, 0x71, 0x43, 0x62,
+    0x5A, 0xC3, 0xA9, 0x50, 0xC4, 0x2B, 0x42, 0x9A, 0xD1, 0x07, 0xB7, 0x88, 0x6F, 0x8F, 0x22, 0xC7,
+    0xBF, 0x85, 0x6A, 0xBE, 0xE5, 0x1B, 0x80, 0x00, 0x55, 0xAE, 0xD8, 0xAE, 0x5A, 0xEB, 0x15, 0x6E,
+    0x70, 0xEC, 0x16, 0x38, 0x9D, 0x2E, 0x4F, 0x97, 0xB7, 0xEB, 0x9B, 0x7F, 0x90, 0xB4, 0x5D, 0x41,
+    0x4A, 0x46, 0xDB, 0x28, 0xC7, 0x1B, 0xCB, 0x45, 0xE2, 0x52, 0x4F, 0x89, 0x11, 0x24, 0x48, 0xD4,
+    0xC5, 0x87, 0xC4, 0xDD, 0xF2, 0x33, 0xF2, 0x07, 0x6D, 0x13, 0x9C, 0xDD, 0x8C, 0x7E, 0x49, 0x60,
+    0xF2, 0x97, 0x8A, 0x37, 0x26, 0x10, 0x6F, 0xCC, 0x40, 0x1E, 0x2D, 0xC6, 0xA3, 0xD3, 0xFD, 0x29,
+    0xB7, 0x51, 0x25, 0x42, 0x09, 0x63, 0x79, 0x62, 0x05, 0x20, 0x63, 0x81, 0x84, 0x1F, 0xE1, 0x86,
+    0xD8, 0x19, 0xDB, 0x04, 0x23, 0x88, 0xC7, 0x02, 0x5F, 0x8A, 0x15, 0x5F, 0x7A, 0xF8, 0x81, 0x09,
+    0x88, 0x75, 0xE1, 0xE4, 0xBF, 0x1E, 0x41, 0xB9, 0x53, 0xDD, 0x90, 0x03, 0x41, 0xA5, 0xD8, 0x08,
+    0x1A, 0x50, 0x81, 0x0C, 0xC1, 0x04, 0x00, 0x5C, 0x01, 0xF7, 0x66, 0xC9, 0xAE, 0x74, 0xB2, 0x2D,
+    0x95, 0x70, 0xB6, 0xF5, 0x81, 0x66, 0x63, 0xCD, 0xCD, 0x34, 0xD1, 0x54, 0x30, 0x0B, 0xB3, 0x8A,
+    0x64, 0xB9, 0x1E, 0xE7, 0x54, 0x22, 0xD3, 0x27, 0xA3, 0xE5, 0xFC, 0x9A, 0x6A, 0x14, 0xEF, 0x4C,
+    0x14, 0xF7, 0x8A, 0xA9, 0x88, 0x0B, 0xDB, 0x2F, 0xFA, 0x1B, 0x95, 0x93, 0x17, 0xD7, 0xD6, 0x06,
+    0x24, 0xB1, 0x02, 0x0A, 0x86, 0x19, 0xCE, 0xD4, 0x3C, 0xC7, 0x7E, 0x50, 0xBD, 0x00, 0x25, 0xE8,
+    0xEE, 0x60, 0x20, 0x7A, 0x09, 0x83, 0x1D, 0x2A, 0xDD, 0xA8, 0x79, 0xA3, 0x3B, 0xDB, 0xAA, 0xF9,
+    0xA2, 0x94, 0xBC, 0xFB, 0xAC, 0x2C, 0xA4, 0x7E, 0x52, 0x96, 0x12, 0xE6, 0x01, 0x93, 0x79, 0xA3,
+    0xCF, 0x17, 0x60, 0x0D, 0xFA, 0x71, 0x66, 0xF3, 0x28, 0xF6, 0x70, 0x34, 0x23, 0xB0, 0x7A, 0x85,
+    0x08, 0x95, 0xB6, 0x1E, 0x90, 0xB5, 0x42, 0x61, 0x42, 0xC2, 0xB4, 0xD2, 0xED, 0x7C, 0x12, 0x1F,
+    0xCD, 0xB9, 0x09, 0x52, 0x69, 0xCF, 0xED, 0x20, 0x56, 0x01, 0x2E, 0x3F, 0xDD, 0x9E, 0xE6, 0x3D,
+    0x36, 0x07, 0x5C, 0x54, 0x4D, 0x2D, 0x12, 0x88, 0x1A, 0xD3, 0x2C, 0x17, 0x20, 0x72, 0xC0, 0x55,
+    0x33, 0xFD, 0x11, 0xF8, 0xAD, 0xF5, 0xBC, 0x1F, 0x0C, 0xB3, 0x5E, 0x58, 0x67, 0xF6, 0x27, 0xFE,
+    0xB3, 0xD0, 0xD6, 0x4B, 0x7E, 0x88, 0x43, 0x32, 0x5B, 0xDF, 0x41, 0x38, 0x78, 0x93, 0x4A, 0x33,
+    0x45, 0x1F, 0x9B, 0xAB, 0xC1, 0xB8, 0xE9, 0x44, 0x51, 0x33, 0x48, 0xD9, 0xE9, 0xB3, 0x87, 0x10,
+    0x8F, 0x75, 0xD4, 0x3D, 0xD6, 0x5A, 0x63, 0x91, 0x01, 0x52, 0x47, 0x93, 0x47, 0x73, 0x6E, 0x45,
+    0xB9, 0xD2, 0xF7, 0x3F, 0x25, 0xD3, 0xB4, 0x51, 0x0D, 0x4B, 0xC9, 0x8E, 0x35, 0x36, 0xF8, 0x18,
+    0x4D, 0x14, 0xC1, 0xCD, 0xF2, 0x67, 0x8B, 0x52, 0xC4, 0x39, 0x08, 0x36, 0x15, 0x1C, 0x03, 0xCA,
+    0xC6, 0x57, 0xBF, 0x67, 0x1E, 0xED, 0x87, 0x8B, 0x73, 0xC5, 0xE9, 0xB1, 0xF6, 0xB5, 0x23, 0x83,
+    0xD2, 0xB8, 0x3D, 0x1D, 0x13, 0xBD, 0xCD, 0x9D, 0x1F, 0x29, 0x24, 0x7F, 0xDA, 0xF9, 0xB2, 0xD9,
+    0xB9, 0x04, 0xD1, 0x78, 0xC0, 0x60, 0x06, 0x4C, 0x21, 0xFA, 0x24, 0x15, 0x83, 0x4D, 0x65, 0x87,
+    0xAF, 0xA8, 0x7B, 0xA5, 0x6F, 0xEF, 0x72, 0x68, 0xA2, 0x34, 0x36, 0x80, 0x70, 0xE0, 0x18, 0x28,
+    0xDB, 0xD0, 0x8C, 0x24, 0xC3, 0xD7, 0xC1, 0x6A, 0xFC, 0xED, 0x66, 0x2E, 0x55, 0xFF, 0xA3, 0x16,
+    0x46, 0x46, 0xAC, 0xA3, 0xC5, 0x8A, 0x1F, 0xAC, 0x15, 0x0A, 0x9B, 0x0E, 0x95, 0x8A, 0x79, 0xDF,
+    0xB9, 0x79, 0xAA, 0xFE, 0x4B, 0x62, 0xFC, 0x7F, 0xEB, 0x3B, 0xD5, 0x54, 0x3D, 0x8E, 0xD5, 0x30,
+    0x10, 0x76, 0x5E, 0xB4, 0x44, 0x22, 0x12, 0xEE, 0x68, 0x28, 0x72, 0x04, 0x1F, 0xC1, 0x91, 0x10,
+    0xD5, 0xD6, 0x7B, 0x09, 0x9A, 0x3D, 0x42, 0xD2, 0xD3, 0xEC, 0x21, 0xA8, 0x68, 0x68, 0xA9, 0x70,
+    0x24, 0x2E, 0x90, 0x23, 0xA4, 0x59, 0xD1, 0x46, 0x22, 0x45, 0xF6, 0x91, 0xE7, 0x61, 0xBE, 0xB1,
+    0x95, 0xD8, 0x68, 0x17, 0x21, 0x81, 0x90, 0x18, 0xE9, 0xBD, 0x79, 0xF3, 0xE6, 0xFF, 0x9B, 0xF1,
+    0x28, 0xA5, 0xD4, 0x27, 0x25, 0x44, 0x5F, 0x26, 0x30, 0xB7, 0xAC, 0x60, 0xD6, 0x5E, 0xC0, 0x9A,
+    0x6B, 0x0F, 0x56, 0x8D, 0x9F, 0xD5, 0x93, 0xF4, 0x8C, 0xC4, 0xD1, 0x10, 0x0D, 0xCC, 0x3A, 0xA2,
+    0x0D, 0x61, 0x48, 0x44, 0xE7, 0x0B, 0xC7, 0xF1, 0xF8, 0x53, 0x13, 0xEB, 0xF8, 0x27, 0x8D, 0xCA,
+    0x32, 0x33, 0x8B, 0x32, 0x6C, 0x57, 0x7B, 0xA5, 0x39, 0x51, 0x41, 0x3D, 0xF4, 0xCA, 0x4D, 0x25,
+    0xB5, 0xA2, 0x84, 0x33, 0x6B, 0x3A, 0x0E, 0x5D, 0x12, 0xFE, 0x60, 0x9B, 0x41, 0x6F, 0xD1, 0x06,
+    0x05, 0x2E, 0x05, 0x6C, 0xEC, 0xA6, 0x3A, 0xFE, 0xB7, 0xF3, 0xAA, 0xA1, 0xFB, 0x97, 0x44, 0xAA,
+    0x22, 0x50, 0x5F, 0x08, 0x1B, 0x94, 0x05, 0x9B, 0x38, 0xBB, 0x30, 0x15, 0x19, 0xC4, 0x91, 0x83,
+    0xBC, 0xA2, 0x73, 0xDE, 0x8B, 0x5E, 0x35, 0xDA, 0xAF, 0x7C, 0x85, 0xF6, 0x4F, 0xF4, 0x1A, 0xE5,
+    0x70, 0xCD, 0xD2, 0x9A, 0x9B, 0xDD, 0x8C, 0xCC, 0x9B, 0x45, 0x1D, 0x57, 0x37, 0x57, 0x37, 0x4F,
+    0x62, 0x22, 0x5D, 0x4B, 0x1E, 0x78, 0x34, 0x9C, 0x2E, 0x20, 0x04, 0xD1, 0x50, 0x7F, 0xCB, 0xA8,
+    0x1A, 0xCF, 0xF1, 0x07, 0xD5, 0x78, 0xF4, 0xA2, 0x34, 0xB3, 0xFA, 0x22, 0x28, 0x9D, 0xA8, 0x17,
+    0x14, 0xBA, 0x09, 0x7A, 0x65, 0x56, 0x60, 0x06, 0xA5, 0x9D, 0x01, 0x46, 0xDB, 0x20, 0x34, 0x0D,
+    0x35, 0x2A, 0xEC, 0x66, 0x01, 0x03, 0x36, 0x11, 0x30, 0xB6, 0xD1, 0xC4, 0x19, 0x91, 0xB5, 0xAF,
+    0xE8, 0xE1, 0x8D, 0xA3, 0x21, 0x80, 0x31, 0x61, 0x36, 0xA8, 0x40, 0x83, 0xAD, 0x9C, 0x47, 0x98,
+    0x40, 0xB4, 0x2A, 0x11, 0x17, 0x19, 0xA7, 0xEF, 0x93, 0x4E, 0xBA, 0x89, 0xD3, 0xBA, 0xAF, 0x1E,
+    0xD8, 0x01, 0xC0, 0x0B, 0x2C, 0x27, 0x74, 0x31, 0x70, 0x31, 0xFC, 0xC5, 0x41, 0x79, 0x78, 0xEF,
+    0xA8, 0x7F, 0xFB, 0xFE, 0xF9, 0x87, 0x9F, 0x36, 0xE3, 0x2E, 0x95, 0xBA, 0x35, 0x95, 0x8C, 0x4F,
+    0xA5, 0x8A, 0xD2, 0x9C, 0x45, 0xD8, 0xA8, 0xC7, 0x1D, 0xD1, 0x5A, 0xEA, 0x38, 0x64, 0x8E, 0x73,
+    0xE6, 0xB8, 0xFD, 0x05, 0xC7, 0x5B, 0xDF, 0xC8, 0x12, 0x04, 0x72, 0x71, 0x73, 0xA2, 0x5D, 0xC4,
+    0x2C, 0xB6, 0xC4, 0xD2, 0x65, 0x97, 0x6A, 0x9A, 0xCC, 0x91, 0x83, 0x31, 0x2B, 0x69, 0x4B, 0x5B,
+    0x4A, 0xE2, 0xF0, 0xF0, 0xED, 0xE1, 0xC9, 0x53, 0xAF, 0xE9, 0x40, 0xC0, 0x2E, 0x27, 0xFA, 0xEE,
+    0x8F, 0xA8, 0xAA, 0xBB, 0xB8, 0x5D, 0x49, 0x63, 0x43, 0xD7, 0xBB, 0xA7, 0xDE, 0x2A, 0x9A, 0xF6,
+    0xB0, 0xFC, 0xA8, 0x68, 0xD5, 0x7B, 0x4E, 0xB3, 0x58, 0x2A, 0xF6, 0x82, 0x4A, 0xD2, 0x34, 0x98,
+    0x1D, 0x58, 0xFB, 0x8D, 0xE6, 0x72, 0x6F, 0xB3, 0x42, 0x1F, 0x07, 0x22, 0xDC, 0x65, 0xDB, 0xF9,
+    0x03, 0x38, 0xBA, 0x77, 0x47, 0x63, 0x5D, 0xDC, 0xA2, 0x5D, 0x19, 0x76, 0x3D, 0x86, 0x8D, 0xEF,
+    0x2D, 0x51, 0xAE, 0x07, 0xE4, 0x4C, 0x3E, 0x83, 0xF2, 0xC0, 0xB9, 0xE1, 0x85, 0x3A, 0x27, 0xB3,
+    0x9A, 0xB2, 0x59, 0x65, 0x63, 0xED, 0x28, 0x1F, 0xF2, 0x90, 0x0D, 0x39, 0x1B, 0x6B, 0xEE, 0x68,
+    0x93, 0xB1, 0xE2, 0xD1, 0x8C, 0x89, 0x54, 0x26, 0x63, 0x85, 0xE3, 0x43, 0xE6, 0x98, 0x6D, 0xE7,
+    0x8B, 0x56, 0xFD, 0x92, 0xCC, 0x1C, 0x67, 0x13, 0x03, 0xC7, 0x1E, 0x42, 0x99, 0x6E, 0x56, 0xBF,
+    0x43, 0x58, 0x56, 0x8B, 0xEB, 0xD0, 0x63, 0x35, 0x35, 0x17, 0xEE, 0xC0, 0xB8, 0xB0, 0x25, 0xB0,
+    0x19, 0x77, 0x04, 0x4B, 0xCC, 0x47, 0x15, 0xAF, 0x87, 0x2F, 0x14, 0x8E, 0x07, 0x5F, 0xDA, 0x12,
+    0x4F, 0x74, 0x61, 0xD6, 0x23, 0x59, 0xC5, 0xAE, 0x72, 0x0E, 0xE5, 0x10, 0x6B, 0x2F, 0x85, 0xF0,
+    0xD9, 0x90, 0x4B, 0xB4, 0x89, 0x95, 0xF8, 0xB4, 0xD1, 0x07, 0x21, 0x2B, 0x3A, 0x7F, 0x64, 0x1F,
+    0x99, 0xDE, 0x18, 0xD8, 0x10, 0x58, 0x8B, 0x0B, 0x80, 0x19, 0x9E, 0xE2, 0x60, 0x79, 0x88, 0x77,
+    0x8F, 0x36, 0x60, 0x03, 0x48, 0x2E, 0x34, 0x1F, 0xA1, 0x08, 0xAB, 0xA0, 0x03, 0x04, 0x66, 0x54,
+    0x7F, 0x4A, 0xFF, 0x3D, 0x4A, 0xFF, 0x9E, 0x7E, 0x00, 0xD5, 0x55, 0x31, 0x8E, 0xD4, 0x40, 0x10,
+    0x6C, 0xDB, 0x42, 0x0E, 0x1C, 0x4C, 0x44, 0x3C, 0x3F, 0xC0, 0x4F, 0xF0, 0x20, 0x02, 0xD2, 0x0B,
+    0x58, 0x12, 0x7E, 0x40, 0x72, 0x3F, 0x60, 0x4C, 0x44, 0x7A, 0xC9, 0xBD, 0x63, 0x3F, 0x70, 0x60,
+    0x4B, 0x48, 0xC4, 0x46, 0x7C, 0xC0, 0xC1, 0x12, 0x20, 0x02, 0x1C, 0x18, 0xC9, 0x77, 0xF2, 0xBA,
+    0xA9, 0x6A, 0xFB, 0x0E, 0x84, 0x16, 0xE9, 0x24, 0x24, 0x24, 0x46, 0xAB, 0xE9, 0x5D, 0xBB, 0xA7,
+    0xA7, 0xBA, 0xBA, 0xBA, 0x57, 0x44, 0x5C, 0x2D, 0x5C, 0x65, 0x6F, 0xA6, 0x9A, 0xCC, 0xE8, 0xC2,
+    0x3D, 0x55, 0x6D, 0x61, 0xF2, 0xD9, 0x8F, 0x30, 0x6E, 0x48, 0xF8, 0xF4, 0x41, 0x90, 0x87, 0x72,
+    0x7A, 0xE5, 0x70, 0xAF, 0x8E, 0x52, 0x68, 0x2D, 0x71, 0x16, 0xA7, 0x41, 0x1A, 0x1A, 0x84, 0x1B,
+    0x57, 0x33, 0x88, 0x5F, 0x24, 0x81, 0x29, 0x67, 0x98, 0x5E, 0xAA, 0x19, 0x77, 0xB4, 0xBC, 0x34,
+    0x83, 0x89, 0x23, 0x4C, 0x2D, 0xCD, 0x80, 0x40, 0x41, 0xF0, 0xBA, 0xE0, 0x99, 0x4E, 0x1C, 0xCF,
+    0xB4, 0xE2, 0x8E, 0xE6, 0xEC, 0x67, 0xF3, 0xB2, 0x33, 0x61, 0x3B, 0xC3, 0x90, 0xB9, 0xDE, 0xEC,
+    0x71, 0x26, 0x57, 0xAC, 0x6E, 0x35, 0xED, 0x6A, 0x02, 0x5C, 0x94, 0x19, 0x21, 0x1F, 0x65, 0x7E,
+    0x51, 0xF5, 0xE2, 0x04, 0x7C, 0x37, 0xB9, 0xC9, 0x8C, 0xA7, 0x29, 0xC7, 0x8A, 0x59, 0x57, 0xAB,
+    0x69, 0x06, 0xC0, 0x62, 0x06, 0x4A, 0xB3, 0x3B, 0xDB, 0x9D, 0xC9, 0x3D, 0xD6, 0x7F, 0x4E, 0x88,
+    0xCC, 0xDC, 0x0A, 0x53, 0x46, 0xE4, 0x96, 0x8D, 0xA6, 0x11, 0x8A, 0x22, 0x3D, 0xCA, 0xDF, 0x2E,
+    0x8A, 0x4B, 0x3F, 0x01, 0x4D, 0xB1, 0x14, 0x00, 0x13, 0x07, 0xCB, 0x04, 0x16, 0xA4, 0x23, 0x4D,
+    0xA4, 0x81, 0x0F, 0x88, 0x29, 0x34, 0x41, 0x02, 0xE5, 0xEC, 0xE8, 0x34, 0xB2, 0x00, 0xFA, 0x15,
+    0x44, 0x20, 0x07, 0xC0, 0x29, 0x14, 0xB9, 0x4B, 0xA9, 0xB3, 0xA5, 0x41, 0x64, 0x4A, 0x64, 0x99,
+    0x12, 0x35, 0x39, 0x16, 0x52, 0xCF, 0x54, 0xD7, 0x07, 0xE1, 0xE7, 0x83, 0xC1, 0x1E, 0x50, 0xFE,
+    0x71, 0x4D, 0x26, 0xE7, 0x93, 0x86, 0x4F, 0xE9, 0x4B, 0xB1, 0x7B, 0xF8, 0x83, 0x24, 0xE4, 0x8C,
+    0xA8, 0xE0, 0x6E, 0x90, 0x26, 0x68, 0xED, 0x86, 0x6C, 0xC6, 0xEB, 0xD8, 0xFA, 0xD6, 0x4D, 0xE9,
+    0x0C, 0xDA, 0xAB, 0x0F, 0xDA, 0x67, 0xE4, 0x32, 0x2A, 0xCB, 0x8D, 0xA3, 0x7A, 0x8D, 0x30, 0x9D,
+    0x48, 0xC2, 0xBB, 0x4A, 0xE0, 0xCA, 0x8C, 0xE8, 0x70, 0x97, 0x7D, 0xDA, 0x74, 0xB2, 0xBA, 0x3A,
+    0xB5, 0x9A, 0x3E, 0x9D, 0xD1, 0x69, 0xE0, 0x19, 0xCC, 0x9E, 0xB7, 0xA2, 0x2C, 0x61, 0x7C, 0x8D,
+    0x90, 0x55, 0xA7, 0x07, 0x34, 0x5F, 0x13, 0xF0, 0xBA, 0xAA, 0x25, 0x5D, 0x18, 0x56, 0x9F, 0x00,
+    0x72, 0x6C, 0x9B, 0x5E, 0xCA, 0x01, 0xBC, 0xB8, 0x09, 0x14, 0x65, 0x47, 0xD8, 0x54, 0x43, 0xBA,
+    0x88, 0x1E, 0x12, 0x80, 0x62, 0xC5, 0x3D, 0xB6, 0xDE, 0x71, 0x63, 0xCD, 0xFB, 0x04, 0x75, 0xAF,
+    0xE5, 0xE5, 0x56, 0xED, 0x48, 0xBE, 0x88, 0x83, 0xAA, 0x5A, 0xB7, 0xC4, 0xBE, 0x49, 0xF8, 0xAD,
+    0x56, 0xC9, 0x12, 0x48, 0x02, 0x4B, 0x82, 0x0C, 0xAB, 0x1B, 0x1D, 0x71, 0x4B, 0xD3, 0x3A, 0x04,
+    0x04, 0x63, 0xF9, 0x0C, 0x65, 0xF8, 0xDE, 0x43, 0xB2, 0x01, 0xA2, 0x3C, 0x66, 0x03, 0x00, 0xBB,
+    0x16, 0x0E, 0xF1, 0xF2, 0x1C, 0x99, 0x80, 0x99, 0xEC, 0x16, 0x47, 0xC0, 0x86, 0x9A, 0x2E, 0xDB,
+    0x0D, 0xEF, 0x64, 0xE3, 0xC8, 0xB4, 0x65, 0xC4, 0x93, 0x2D, 0x89, 0xF5, 0xFD, 0x85, 0x14, 0x2F,
+    0x4C, 0x0D, 0x13, 0x99, 0x1C, 0x0D, 0x9C, 0x34, 0x75, 0x39, 0xA0, 0x44, 0x7E, 0x48, 0x67, 0x6C,
+    0x86, 0x0E, 0xD5, 0xF5, 0x1D, 0xB8, 0x2B, 0x3B, 0x20, 0xAB, 0x5A, 0x83, 0xE7, 0x3F, 0xBF, 0x58,
+    0x29, 0xAA, 0xDD, 0xED, 0x16, 0x88, 0x14, 0xAC, 0x1C, 0x4C, 0xEA, 0x72, 0x0B, 0x85, 0xF2, 0xC9,
+    0xA8, 0xB2, 0x62, 0x81, 0x26, 0xFC, 0x58, 0xA1, 0x59, 0xDB, 0x7C, 0xE2, 0x2C, 0x7C, 0xF6, 0x6F,
+    0xB0, 0xAC, 0xEB, 0x6D, 0x01, 0x34, 0xFA, 0x1E, 0x4A, 0x6D, 0x26, 0x28, 0xAA, 0xC2, 0x78, 0x11,
+    0xFF, 0x06, 0x2A, 0xCA, 0xFA, 0x57, 0x27, 0x06, 0xD0, 0xB5, 0x69, 0x1C, 0xE0, 0x0D, 0x8E, 0x5B,
+    0x1A, 0xC8, 0x13, 0x1A, 0xA1, 0x1A, 0x63, 0x6B, 0x78, 0x04, 0xC2, 0xC6, 0x0F, 0x49, 0x50, 0x56,
+    0xCC, 0xA7, 0x60, 0x80, 0x50, 0xC0, 0x12, 0xE3, 0x7E, 0x87, 0x71, 0x15, 0x39, 0x29, 0x0C, 0x51,
+    0x66, 0x83, 0xA4, 0x62, 0x17, 0xA4, 0xEB, 0xBC, 0x28, 0x07, 0x64, 0x96, 0x69, 0x86, 0xEB, 0x9B,
+    0x1E, 0x5A, 0x74, 0x47, 0xCC, 0xA4, 0x44, 0x3F, 0xD2, 0x6D, 0xC6, 0x2C, 0x4B, 0x76, 0x8F, 0x77,
+    0xE1, 0x4F, 0xB3, 0xF1, 0x5A, 0x36, 0xA6, 0xC4, 0x46, 0x92, 0x51, 0x65, 0xD8, 0x8C, 0x2B, 0xA8,
+    0x00, 0xD2, 0x32, 0xB2, 0x56, 0x70, 0xC6, 0x16, 0x26, 0x12, 0x5A, 0xCF, 0xE8, 0x5A, 0xD1, 0x19,
+    0x5F, 0xA2, 0x1B, 0xE1, 0x0C, 0x43, 0x78, 0x77, 0x8C, 0xF9, 0x9A, 0x8D, 0x8E, 0xCD, 0x7F, 0xC3,
+    0xAF, 0xAB, 0xAB, 0xAD, 0xED, 0x73, 0xCE, 0x85, 0x62, 0x38, 0x89, 0xCB, 0x1F, 0x36, 0x58, 0x88,
+    0x84, 0x19, 0xB4, 0xD7, 0x50, 0xF6, 0xC5, 0x6C, 0x98, 0x70, 0x22, 0xB6, 0x55, 0x48, 0x16, 0x08,
+    0x36, 0x1F, 0x0D, 0x10, 0x04, 0xA2, 0x00, 0x55, 0xCC, 0xF9, 0xF5, 0x73, 0x1D, 0x0C, 0x4D, 0x45,
+    0xC2, 0x94, 0x74, 0xDB, 0xC4, 0xFD, 0xB5, 0x78, 0xD6, 0x46, 0xE7, 0x9D, 0x75, 0xD2, 0x5E, 0x07,
+    0x1B, 0xC3, 0xC4, 0x8B, 0xDC, 0x75, 0xF4, 0x3D, 0x5B, 0x0A, 0x5C, 0x5B, 0x57, 0x7D, 0xDF, 0x5B,
+    0x63, 0xE1, 0xB5, 0xF5, 0x16, 0xDD, 0xD8, 0x5E, 0x0C, 0xC9, 0xB1, 0x7F, 0x73, 0x19, 0xD8, 0x64,
+    0xF6, 0x7F, 0xD5, 0x8A, 0xFD, 0x37, 0xB1, 0xD5, 0x46, 0x79, 0x94, 0x58, 0x4C, 0x1D, 0xD7, 0xD8,
+    0xDA, 0xBA, 0xD5, 0xCA, 0x6A, 0x27, 0x76, 0x5E, 0xA2, 0x5F, 0x36, 0x3C, 0x3F, 0x00, 0xC5, 0x55,
+    0xBD, 0x8A, 0xD5, 0x40, 0x18, 0x3D, 0x49, 0x64, 0x53, 0xA4, 0x48, 0x65, 0xA3, 0x45, 0x9E, 0x40,
+    0xF2, 0x04, 0x32, 0x17, 0x2C, 0x2C, 0xDD, 0xE2, 0xFA, 0x14, 0x0A, 0x3E, 0x81, 0xDC, 0xF8, 0x06,
+    0x16, 0x2E, 0x82, 0x95, 0x85, 0x16, 0x6A, 0xA1, 0xF5, 0xC2, 0x3A, 0x01, 0x5F, 0x20, 0xF8, 0x04,
+    0x01, 0x45, 0xC4, 0x2A, 0xC2, 0x2D, 0xB2, 0x6B, 0x92, 0xCF, 0x73, 0x66, 0xF6, 0xAE, 0x0A, 0x8A,
+    0x82, 0x7F, 0x03, 0x3B, 0x37, 0x99, 0xF9, 0x72, 0xBE, 0x33, 0xE7, 0x3B, 0xF3, 0x2D, 0xA0, 0x71,
+    0x6B, 0x44, 0x61, 0x0B, 0x9C, 0xCD, 0xB0, 0x65, 0x4A, 0xAD, 0x41, 0x36, 0x03, 0xC5, 0x08, 0x94,
+    0x5B, 0xA0, 0x1A, 0x80, 0xBA, 0x07, 0x9C, 0xFE, 0xF8, 0xEC, 0xB6, 0x97, 0x50, 0x9B, 0xA1, 0x32,
+    0x6B, 0x0B, 0xB3, 0x2E, 0xF1, 0x0B, 0x03, 0x08, 0xE3, 0x1A, 0xC0, 0x33, 0xE0, 0xFE, 0x80, 0xC4,
+    0x06, 0xA4, 0xD6, 0x22, 0x5B, 0x84, 0x5F, 0x11, 0x05, 0x05, 0x21, 0x91, 0xD9, 0x8A, 0xB3, 0x75,
+    0x9C, 0x36, 0x5A, 0xC4, 0x39, 0xFC, 0x64, 0x5C, 0x3C, 0x06, 0xD1, 0x48, 0x89, 0xA9, 0x7A, 0xD4,
+    0x63, 0x3E, 0x60, 0xD3, 0xA5, 0x5B, 0xD8, 0x03, 0x3F, 0x72, 0xDD, 0xC6, 0x4C, 0x53, 0xCE, 0x69,
+    0x5B, 0xD8, 0xD3, 0xEB, 0x28, 0x49, 0x20, 0xD0, 0x46, 0xB9, 0x60, 0xAF, 0x2D, 0xB9, 0xD1, 0x6A,
+    0xB7, 0x51, 0x5C, 0x03, 0x4E, 0xC4, 0xB4, 0xBB, 0x01, 0xBB, 0x6E, 0x44, 0xAE, 0x55, 0xAC, 0x18,
+    0x85, 0x4F, 0x0B, 0x4D, 0xF9, 0x88, 0xDF, 0x18, 0x7B, 0x0B, 0x0F, 0x59, 0x19, 0x31, 0x6A, 0xA5,
+    0x0C, 0x9C, 0x29, 0xC1, 0x11, 0xCA, 0xE3, 0x67, 0xD6, 0x88, 0x4C, 0x1F, 0x48, 0x8B, 0xFE, 0x0C,
+    0x7F, 0xF2, 0x78, 0x1F, 0xAE, 0xDD, 0xB1, 0xCE, 0xAC, 0x49, 0x5E, 0x88, 0xE6, 0x24, 0x81, 0x17,
+    0x44, 0xDA, 0x8E, 0xA7, 0x40, 0xE2, 0x8F, 0x05, 0x5F, 0xB6, 0x3B, 0x86, 0x8C, 0x05, 0x65, 0x9E,
+    0xA4, 0x90, 0xE7, 0x09, 0xEC, 0x0A, 0xE5, 0x36, 0x15, 0xEC, 0x3C, 0xB0, 0xFE, 0x8F, 0x14, 0x93,
+    0x75, 0xC2, 0xF4, 0xF5, 0x20, 0xBB, 0x58, 0xAB, 0xE2, 0x2D, 0x05, 0xA9, 0xB9, 0xD1, 0x6D, 0xC9,
+    0xF7, 0x35, 0xEB, 0x5F, 0xDA, 0x35, 0xFB, 0x75, 0x45, 0x13, 0xAF, 0x82, 0x6D, 0x68, 0x80, 0x68,
+    0x03, 0xF8, 0x9E, 0x65, 0xCB, 0x67, 0xD4, 0x2B, 0xB8, 0x77, 0xCF, 0x17, 0x04, 0x27, 0x40, 0xC5,
+    0xEE, 0x19, 0x66, 0xB6, 0x4A, 0xED, 0xC3, 0xC1, 0x2A, 0x56, 0x14, 0x4E, 0xC5, 0x05, 0x77, 0x6E,
+    0x06, 0xAA, 0x03, 0x82, 0x1F, 0x14, 0x4D, 0x4E, 0xA5, 0x16, 0xB0, 0x67, 0x6F, 0x63, 0x26, 0xAE,
+    0x57, 0x23, 0xD2, 0xA0, 0x09, 0xA3, 0xDB, 0x2F, 0x1C, 0x8A, 0x87, 0xC8, 0x26, 0x24, 0xFC, 0xC4,
+    0xAF, 0x24, 0x06, 0xB1, 0x59, 0x84, 0x74, 0x96, 0xE2, 0x7A, 0xAF, 0x7A, 0xA9, 0xC3, 0x8B, 0x93,
+    0xF0, 0xDD, 0xB7, 0xBA, 0x2A, 0x44, 0xDA, 0x7B, 0xB9, 0xFB, 0x5E, 0x3E, 0x63, 0x70, 0x29, 0xF6,
+    0xAC, 0xDF, 0x16, 0x51, 0xD1, 0x1F, 0x8D, 0xF4, 0x7D, 0x34, 0xE4, 0xA6, 0x09, 0x39, 0xF4, 0xC8,
+    0x78, 0xA5, 0x2F, 0x4E, 0x3F, 0xB5, 0xE8, 0x02, 0x9D, 0x8E, 0xB7, 0x2A, 0x9F, 0x24, 0xB8, 0xE4,
+    0x46, 0xCE, 0xA0, 0x0B, 0xF2, 0x47, 0x7D, 0x6A, 0xEA, 0x42, 0xA1, 0xB6, 0xD5, 0xE9, 0x9B, 0x6C,
+    0x29, 0x26, 0x02, 0xD6, 0xDD, 0xFA, 0xCC, 0x22, 0x87, 0x88, 0x80, 0x55, 0x1F, 0xC1, 0x79, 0xCC,
+    0x80, 0xAE, 0xDC, 0x0C, 0x8C, 0x18, 0x5A, 0x54, 0x76, 0xE5, 0x0A, 0x39, 0xD5, 0x16, 0x8A, 0x49,
+    0x6E, 0x90, 0xFD, 0x18, 0x79, 0x83, 0x9F, 0xE3, 0x49, 0xFA, 0xA8, 0x18, 0xEB, 0xDE, 0xF5, 0x76,
+    0xC7, 0xAE, 0xCE, 0xE5, 0xEC, 0x86, 0xCD, 0x47, 0xFB, 0xE6, 0x9C, 0x87, 0x11, 0x4B, 0xC9, 0x28,
+    0xA4, 0x1E, 0xBF, 0x7F, 0x4C, 0x59, 0x8D, 0x79, 0xA4, 0xA6, 0xD2, 0xB8, 0x21, 0x64, 0x39, 0xD3,
+    0xF3, 0x5E, 0x98, 0xF3, 0x39, 0xFC, 0xB8, 0x29, 0x48, 0x66, 0xF1, 0xDA, 0xAA, 0x59, 0x85, 0x4A,
+    0xF7, 0xF2, 0xB8, 0x89, 0xB0, 0xB7, 0x70, 0x4B, 0xAE, 0xFB, 0x83, 0x7D, 0xA4, 0x2F, 0x53, 0x85,
+    0x7B, 0xBB, 0x36, 0xEC, 0xF6, 0x93, 0x60, 0x66, 0x76, 0x8C, 0x2C, 0x98, 0xAB, 0xCB, 0x99, 0x94,
+    0xAD, 0xAB, 0x9A, 0xC2, 0x31, 0x37, 0x3C, 0xAD, 0x6F, 0x92, 0xB8, 0x26, 0x5A, 0xE5, 0xAC, 0xDE,
+    0x26, 0xC7, 0x47, 0xA0, 0xD0, 0xCF, 0x82, 0x9B, 0xC8, 0x41, 0x08, 0x04, 0x8C, 0xC4, 0xCE, 0x7F,
+    0x53, 0xD3, 0xBC, 0xBF, 0xAC, 0xAD, 0x57, 0x6A, 0xA4, 0xF3, 0x6D, 0xBE, 0xBF, 0x11, 0xCC, 0x51,
+    0x4D, 0xC8, 0xBC, 0x3B, 0xFA, 0x91, 0x13, 0xE6, 0x5B, 0xDB, 0xC0, 0xB3, 0x0F, 0x67, 0x0A, 0x69,
+    0xD5, 0xAF, 0x57, 0x94, 0xCC, 0xDA, 0x6C, 0x94, 0x66, 0x9B, 0x26, 0x5D, 0x54, 0x3A, 0xEA, 0x65,
+    0x2B, 0x5A, 0x90, 0xA4, 0x7D, 0x9B, 0x1A, 0xCA, 0x89, 0xBA, 0x51, 0x36, 0x3A, 0x82, 0x76, 0xB6,
+    0x8E, 0xED, 0x97, 0x4B, 0x9B, 0x21, 0x55, 0xE7, 0x0E, 0xAA, 0x25, 0xA1, 0x21, 0xAB, 0x79, 0xB0,
+    0xAF, 0xCB, 0x2E, 0xE2, 0x9D, 0x87, 0x45, 0xAC, 0xBE, 0x66, 0x21, 0x12, 0xB9, 0xD2, 0xD7, 0xBA,
+    0xE7, 0xFE, 0xC4, 0xFA, 0xC4, 0xDA, 0x7A, 0xC8, 0xD4, 0x6E, 0xE8, 0xBD, 0x72, 0x28, 0x47, 0x3E,
+    0x91, 0x4B, 0x35, 0x30, 0x7B, 0xDD, 0xB3, 0x08, 0xAE, 0xE3, 0xBF, 0x0C, 0xDF, 0x3A, 0xA6, 0x6B,
+    0x9C, 0xA8, 0xD7, 0xD2, 0xA8, 0x92, 0x6A, 0xE1, 0xD6, 0xC9, 0x8E, 0xAC, 0x7C, 0x2C, 0x5A, 0xAA,
+    0x9F, 0x7C, 0xD8, 0xF5, 0xE2, 0x70, 0x37, 0x3C, 0x4E, 0x3D, 0xF7, 0x0B, 0xE3, 0x2F, 0xF3, 0x9B,
+    0x42, 0x51, 0x77, 0x3D, 0xB7, 0x50, 0xCF, 0xA8, 0x3E, 0xCD, 0x72, 0xA8, 0x6F, 0x62, 0xCB, 0x5D,
+    0x23, 0xD9, 0xFF, 0x47, 0x5A, 0xFD, 0xB9, 0xF1, 0x19, 0xE5, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10,
+    0x2D, 0xDB, 0x02, 0x07, 0x0E, 0x3A, 0xDA, 0x04, 0x02, 0x1F, 0xC1, 0x47, 0x68, 0x0B, 0x02, 0xD2,
+    0x0D, 0xD8, 0x78, 0x8F, 0xB0, 0x47, 0xF0, 0x64, 0xDC, 0x65, 0xCF, 0x80, 0xD4, 0xBD, 0xDA, 0x70,
+    0x03, 0x2C, 0x38, 0x00, 0x16, 0x90, 0xD3, 0x81, 0x25, 0x5A, 0x4B, 0xDB, 0xC5, 0xAB, 0x72, 0x0F,
+    0xCC, 0xCC, 0x6E, 0x80, 0x84, 0x20, 0xC1, 0x41, 0xB5, 0x7B, 0xBA, 0xFD, 0xEA, 0xD5, 0xEF, 0x0D,
+    0x51, 0x33, 0xBE, 0x25, 0xB2, 0x01, 0x66, 0x88, 0x89, 0x28, 0xB9, 0x19, 0xC6, 0x06, 0xA2, 0xD8,
+    0x7A, 0x3A, 0x7D, 0xAE, 0x70, 0x58, 0x33, 0x13, 0x75, 0xCC, 0x9E, 0xDC, 0x3D, 0x4F, 0x05, 0xFB,
+    0x2E, 0x54, 0x4C, 0x6D, 0xA8, 0x13, 0x99, 0x60, 0x22, 0xDE, 0x4C, 0x80, 0x69, 0x03, 0x75, 0x53,
+    0x37, 0x91, 0x1D, 0xED, 0x44, 0xCE, 0xDB, 0x50, 0xF2, 0xCE, 0x32, 0xBE, 0xC5, 0xA7, 0x2B, 0xB5,
+    0xCC, 0xB8, 0xCE, 0x1C, 0xA8, 0x62, 0xDE, 0x89, 0x6F, 0x81, 0x77, 0xDE, 0x79, 0x70, 0x81, 0xF7,
+    0x36, 0x76, 0x91, 0xCC, 0x6A, 0x56, 0xB8, 0x7B, 0xC5, 0x7D, 0xC5, 0x1F, 0xE0, 0xEF, 0xE2, 0xFC,
+    0xE2, 0xFC, 0x01, 0xA5, 0xA7, 0xDC, 0x13, 0xE0, 0x52, 0xE6, 0xD4, 0xAD, 0x0E, 0x14, 0x52, 0xC9,
+    0x64, 0x12, 0x0D, 0x5E, 0x49, 0x55, 0x40, 0x49, 0xC4, 0x54, 0x30, 0x7E, 0x21, 0xB7, 0x53, 0x56,
+    0x60, 0xAA, 0xC4, 0xE1, 0x87, 0x85, 0x8C, 0xD2, 0xAA, 0x85, 0x20, 0xA9, 0x31, 0xD8, 0xEE, 0x79,
+    0x51, 0xF1, 0x7A, 0xA3, 0x07, 0x03, 0x58, 0xEC, 0x59, 0x5E, 0xAD, 0x1C, 0xD6, 0x42, 0x9F, 0x78,
+    0x3E, 0xA0, 0xF4, 0xA4, 0x7F, 0xE6, 0x00, 0x29, 0x60, 0x7C, 0x23, 0x26, 0x59, 0xBE, 0xBF, 0xBE,
+    0xEE, 0xE9, 0x00, 0x6B, 0x18, 0x8F, 0xB1, 0x3A, 0x79, 0xAD, 0x14, 0xCB, 0xC5, 0x07, 0x41, 0x52,
+    0x99, 0x6B, 0xD1, 0x4C, 0xDB, 0x8A, 0x14, 0x6F, 0xFB, 0xEC, 0xB7, 0x4A, 0xF9, 0xDE, 0x92, 0x3F,
+    0xE0, 0xFD, 0x9A, 0xBD, 0x0E, 0xBB, 0x6D, 0xB5, 0x19, 0xA8, 0x3D, 0x05, 0x8A, 0x8F, 0x03, 0x15,
+    0x19, 0xE8, 0x6A, 0x03, 0x2A, 0x58, 0xD9, 0x52, 0x29, 0x29, 0xDB, 0x56, 0x3D, 0x28, 0xF8, 0x23,
+    0x2B, 0x12, 0xDF, 0x6D, 0x07, 0xC3, 0xED, 0xA2, 0x5F, 0xDA, 0x4F, 0xAC, 0x2E, 0x4D, 0xE0, 0x4B,
+    0xB9, 0x50, 0x27, 0x77, 0x27, 0xAE, 0xCA, 0xD5, 0xDE, 0xAA, 0x0B, 0xE6, 0xCF, 0xDB, 0x45, 0xFE,
+    0xAE, 0xD1, 0xA3, 0x29, 0xD4, 0x85, 0x20, 0x2B, 0xC7, 0x81, 0x37, 0xE4, 0x26, 0xAF, 0x94, 0x7F,
+    0x27, 0x97, 0x63, 0xB3, 0x39, 0x94, 0x2E, 0x87, 0xD2, 0xE6, 0x9C, 0x98, 0x1C, 0x4A, 0x9D, 0x43,
+    0xA9, 0x72, 0x28, 0xE5, 0x3E, 0x27, 0x9C, 0x73, 0xE2, 0x72, 0x4E, 0x86, 0x0C, 0x64, 0xF7, 0x40,
+    0x63, 0x06, 0xCA, 0xF7, 0x9A, 0x9C, 0xD3, 0xE2, 0xB8, 0x36, 0x85, 0xE2, 0x39, 0xB9, 0x6C, 0xC5,
+    0xB5, 0x59, 0xB4, 0x2D, 0xFA, 0x93, 0x12, 0x16, 0x0B, 0x92, 0x5B, 0x26, 0x64, 0x00, 0x39, 0x36,
+    0x51, 0xCC, 0x5C, 0xC9, 0xB8, 0xD4, 0x33, 0xA8, 0x37, 0x01, 0x71, 0xA0, 0x18, 0xC3, 0x08, 0xE3,
+    0xBC, 0x99, 0x88, 0x7D, 0x3B, 0x61, 0x66, 0x70, 0xC4, 0x7D, 0x27, 0x69, 0x16, 0x23, 0x83, 0xC3,
+    0x92, 0xA3, 0x55, 0xF2, 0xB1, 0xC0, 0xF7, 0x74, 0xD0, 0x24, 0xE2, 0xBD, 0x16, 0xF2, 0x46, 0xC9,
+    0x68, 0x33, 0x6D, 0x9E, 0x7F, 0xE3, 0xF9, 0xEB, 0xFC, 0x92, 0xE6, 0x5E, 0x0B, 0xE1, 0xA5, 0xCE,
+    0x60, 0xDB, 0x7D, 0xC3, 0x90, 0x0D, 0x98, 0xFA, 0x02, 0xF7, 0xC3, 0xBF, 0xE1, 0x72, 0xD6, 0x9F,
+    0xF5, 0x9B, 0xC8, 0x98, 0xD8, 0x46, 0x6A, 0x44, 0x64, 0x2A, 0x7E, 0xC9, 0x7D, 0xC9, 0xEF, 0x41,
+    0x8C, 0x03, 0x87, 0x47, 0xF3, 0x03, 0xD7, 0x26, 0x28, 0x27, 0x0C, 0x17, 0x24, 0x05, 0x6D, 0xCD,
+    0x3D, 0x7C, 0x43, 0x64, 0x84, 0x54, 0x29, 0x44, 0x71, 0x82, 0x6E, 0xB3, 0x5E, 0xE4, 0x47, 0x58,
+    0xD5, 0x91, 0x1C, 0x88, 0x11, 0x44, 0xD5, 0x09, 0x05, 0xA5, 0x55, 0x6B, 0x87, 0x6B, 0x7B, 0x63,
+    0x3F, 0x1F, 0xD7, 0x70, 0x9F, 0x28, 0xAA, 0xB4, 0x8B, 0xB7, 0xA4, 0x6C, 0x4A, 0xAC, 0xF5, 0xFC,
+    0x39, 0xD8, 0x7F, 0xF4, 0x60, 0x44, 0xAA, 0x45, 0xF8, 0x62, 0xEC, 0x31, 0x26, 0xD0, 0xEA, 0x66,
+    0x91, 0x39, 0xAA, 0x57, 0x51, 0x48, 0x0C, 0x0A, 0xBA, 0xB7, 0xE2, 0x17, 0xAB, 0x14, 0xEC, 0x4D,
+    0x92, 0x16, 0x7F, 0x17, 0x75, 0xF2, 0x82, 0xDA, 0x51, 0xA7, 0x6F, 0xA7, 0xC3, 0xA9, 0xCC, 0x56,
+    0xB5, 0xCA, 0x5B, 0x47, 0x20, 0xCF, 0xA4, 0x0E, 0xF2, 0x73, 0xB9, 0xD8, 0x8A, 0xA4, 0x22, 0xDC,
+    0xA4, 0x93, 0x3E, 0xAB, 0xF5, 0xBF, 0xF4, 0xF5, 0xE0, 0x51, 0x01, 0x52, 0x75, 0x72, 0x7D, 0xDE,
+    0xA9, 0x46, 0x0D, 0x4A, 0x06, 0xBC, 0x8C, 0x18, 0xFB, 0x15, 0x72, 0xBE, 0x82, 0x74, 0x33, 0x23,
+    0x04, 0xEB, 0x71, 0x85, 0xB1, 0x20, 0xDF, 0x2B, 0x75, 0x63, 0x23, 0xBB, 0xC1, 0x57, 0x09, 0xC5,
+    0x68, 0x27, 0x87, 0xFF, 0x9F, 0x4B, 0xA9, 0x31, 0xD8, 0xAB, 0xAA, 0x0F, 0x70, 0x5D, 0xF2, 0x17,
+    0x00, 0xCF, 0x59, 0x11, 0x8B, 0x75, 0xAF, 0xA5, 0x2A, 0x56, 0xC2, 0xB5, 0x8E, 0xF4, 0x1F, 0x3C,
+    0x3F, 0x00, 0xCD, 0x55, 0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x19, 0x39, 0x70, 0xD0, 0x11,
+    0x12, 0xD2, 0x06, 0x3E, 0x01, 0xF2, 0x11, 0xDA, 0xE2, 0x02, 0x6C, 0xC0, 0x92, 0x70, 0x03, 0x92,
+    0x3D, 0x82, 0x7D, 0x04, 0x12, 0x72, 0x22, 0x24, 0x48, 0xE6, 0x06, 0xB4, 0x25, 0x0E, 0x80, 0x13,
+    0x72, 0x0B, 0x6D, 0xB4, 0x91, 0x03, 0x07, 0x66, 0xB1, 0xBB, 0xA8, 0x8F, 0x67, 0x76, 0x76, 0x83,
+    0xD5, 0x90, 0x31, 0xD2, 0x4C, 0x8D, 0xCB, 0xDD, 0xF5, 0x79, 0xEF, 0x75, 0x35, 0x00, 0xDF, 0xFB,
+    0x1E, 0x28, 0x96, 0x62, 0x01, 0x40, 0x1D, 0x75, 0x40, 0xB9, 0x54, 0xFC, 0x90, 0xD1, 0x77, 0x79,
+    0x68, 0xE6, 0x66, 0x06, 0x76, 0x57, 0xBB, 0x2B, 0xFC, 0xDB, 0xA7, 0x9C, 0x90, 0xAD, 0x1C, 0xB2,
+    0x45, 0x68, 0xE1, 0x16, 0x94, 0x23, 0x10, 0xFA, 0x2C, 0x02, 0x79, 0x44, 0xC3, 0x91, 0xFD, 0xE8,
+    0x26, 0x49, 0xF3, 0x8A, 0x5D, 0xA8, 0x66, 0x71, 0x25, 0xF4, 0x83, 0x93, 0xC1, 0x11, 0x49, 0x04,
+    0x22, 0xAE, 0x0C, 0x05, 0x89, 0x0B, 0x8D, 0xBA, 0x32, 0x1A, 0xC4, 0xF8, 0xC5, 0x1E, 0x6A, 0x7D,
+    0x50, 0x97, 0x53, 0xD7, 0x05, 0xA7, 0xE3, 0x28, 0x34, 0x4A, 0x48, 0x5A, 0x74, 0x91, 0xAE, 0xF2,
+    0xD2, 0x0B, 0x72, 0x79, 0xFD, 0xE8, 0xF3, 0x8C, 0xBF, 0xE9, 0x9E, 0xA2, 0xA6, 0xD2, 0xC4, 0xA5,
+    0x19, 0x4F, 0xB7, 0x5F, 0xCE, 0xEC, 0x35, 0x48, 0x70, 0xCE, 0xDB, 0x59, 0x59, 0x6A, 0x0A, 0x33,
+    0xA5, 0x36, 0xC1, 0xC1, 0xD4, 0x84, 0x30, 0xE8, 0x42, 0xAD, 0x39, 0x8B, 0x95, 0xD4, 0x59, 0x2C,
+    0x6A, 0xCA, 0x49, 0x8D, 0x1F, 0xD5, 0x84, 0xAE, 0x9A, 0x64, 0x61, 0x5B, 0x2A, 0x46, 0x28, 0x67,
+    0x89, 0x78, 0x75, 0x3D, 0x2B, 0x3A, 0xD2, 0x99, 0x37, 0x13, 0xCC, 0x90, 0x9A, 0x4C, 0xCC, 0xCA,
+    0x0B, 0x39, 0xDC, 0x0A, 0xC7, 0x3D, 0x95, 0x51, 0xC1, 0x62, 0x13, 0x66, 0x29, 0xE6, 0x58, 0xF2,
+    0xFB, 0xC0, 0xF5, 0xE5, 0xDA, 0xA9, 0xDF, 0xB6, 0xDE, 0x7D, 0x3A, 0x8B, 0xD7, 0x1B, 0x43, 0x75,
+    0xD6, 0x8D, 0x3D, 0xFF, 0xDD, 0x33, 0xC2, 0xD5, 0x20, 0x02, 0x8A, 0xC2, 0x72, 0x31, 0x0A, 0xBD,
+    0xBE, 0x4E, 0x22, 0x92, 0x05, 0xF9, 0x04, 0xD7, 0xA3, 0xEA, 0xE1, 0xB9, 0x48, 0x60, 0xE1, 0x76,
+    0x91, 0xFF, 0x7E, 0xCB, 0x0C, 0x09, 0xCC, 0xAD, 0xC4, 0x88, 0x5A, 0xFE, 0xA4, 0xBF, 0x8C, 0x59,
+    0xB8, 0xD9, 0x32, 0xBD, 0xC1, 0x73, 0xC5, 0xAC, 0xAE, 0x7A, 0x45, 0x50, 0x59, 0x2D, 0x74, 0xA5,
+    0xAC, 0x9D, 0x0C, 0x65, 0x65, 0x1F, 0xBB, 0x27, 0x2A, 0x56, 0x69, 0x0B, 0xF9, 0x38, 0xA1, 0x27,
+    0xD5, 0x68, 0x8C, 0xF0, 0x0A, 0x0B, 0x57, 0xDF, 0xF3, 0x83, 0x46, 0x65, 0x08, 0xFF, 0x4B, 0xB7,
+    0x54, 0xA3, 0xF2, 0xBB, 0x11, 0xE4, 0xEC, 0xA8, 0x14, 0x4B, 0x2A, 0x5B, 0x44, 0xCB, 0xFD, 0x91,
+    0xA1, 0x94, 0x7E, 0xBE, 0x8B, 0x30, 0x36, 0x3A, 0x33, 0xE3, 0x91, 0x22, 0x21, 0x8C, 0x36, 0xC3,
+    0x88, 0xB0, 0xA7, 0x99, 0x0E, 0x1C, 0x39, 0x52, 0x71, 0x16, 0x0C, 0x48, 0xA2, 0x85, 0xED, 0x6A,
+    0x5C, 0x6A, 0xEB, 0x03, 0x07, 0x25, 0x7D, 0x4B, 0xC6, 0x7D, 0x7B, 0x6C, 0xFA, 0xF2, 0x7F, 0x20,
+    0x49, 0xA1, 0x31, 0xE5, 0x1B, 0xB2, 0xA6, 0x7B, 0x93, 0xBD, 0xA9, 0x5E, 0x41, 0x35, 0xCD, 0x9B,
+    0xE4, 0x4D, 0xF1, 0x86, 0xA7, 0xE9, 0x5D, 0xE5, 0x6E, 0x6A, 0x37, 0x28, 0x4D, 0xEB, 0x26, 0x75,
+    0x53, 0xBA, 0xA1, 0xA8, 0x3A, 0x37, 0x99, 0x9B, 0xCA, 0x0D, 0x40, 0xD3, 0xF8, 0xBD, 0xC4, 0x2B,
+    0x15, 0x47, 0xA3, 0x4C, 0x93, 0xF1, 0xAC, 0x22, 0xB0, 0xDF, 0xA0, 0xEC, 0x16, 0xD3, 0x29, 0x62,
+    0x49, 0xAC, 0x15, 0xAB, 0x36, 0x93, 0x13, 0xE4, 0xEF, 0x68, 0x4A, 0xF9, 0xCC, 0x74, 0x6E, 0x48,
+    0x08, 0x01, 0xF9, 0x92, 0x4D, 0x28, 0x87, 0xB2, 0x43, 0x53, 0xAF, 0x48, 0xD7, 0x6C, 0x84, 0x1B,
+    0x5D, 0xC7, 0x0B, 0x9A, 0x8F, 0xD7, 0xC4, 0x03, 0x87, 0x66, 0x29, 0x6A, 0x90, 0x82, 0x6B, 0x27,
+    0x68, 0x15, 0xF1, 0xB5, 0x4E, 0xD4, 0x7E, 0xD3, 0x9F, 0xE7, 0x5A, 0xD2, 0x45, 0x87, 0x5B, 0x2F,
+    0xB3, 0xA9, 0xDE, 0xA6, 0xD8, 0x85, 0xE9, 0x17, 0xA6, 0x51, 0xAF, 0xF3, 0xA9, 0x30, 0x69, 0xAE,
+    0x27, 0x2E, 0x37, 0x3E, 0x7D, 0x2A, 0x93, 0x10, 0x3F, 0x88, 0xFE, 0x84, 0xA7, 0x54, 0x05, 0x86,
+    0x7B, 0xD5, 0xF1, 0xFC, 0xA5, 0xF8, 0x75, 0x64, 0x68, 0xB5, 0xF1, 0xB0, 0xDA, 0x60, 0xB2, 0xD3,
+    0xA0, 0x73, 0xA9, 0xD1, 0xF4, 0xCE, 0x0E, 0x81, 0x9D, 0x8C, 0x2A, 0x9E, 0xBC, 0xF7, 0xEB, 0xE9,
+    0x62, 0xDE, 0xF9, 0x42, 0x04, 0xF9, 0x39, 0xA8, 0x34, 0x68, 0xB2, 0xC1, 0x53, 0xEB, 0xC3, 0x28,
+    0xF3, 0x57, 0x14, 0xEB, 0x4C, 0xFD, 0xA6, 0x1D, 0xA1, 0xCF, 0x22, 0xC9, 0x97, 0xD3, 0x54, 0x72,
+    0xD1, 0xB0, 0xC7, 0x0D, 0x8F, 0x9A, 0xDB, 0xCF, 0xD2, 0x80, 0xD0, 0xD0, 0x67, 0xF4, 0x67, 0x4C,
+    0x45, 0xF0, 0x52, 0x17, 0xE7, 0x82, 0x5C, 0x55, 0x72, 0x8F, 0xB8, 0x59, 0xA4, 0xA4, 0x17, 0x16,
+    0x3B, 0xA7, 0x97, 0x32, 0x15, 0x3A, 0x48, 0xBF, 0xA5, 0x94, 0xD1, 0xC4, 0x07, 0xD8, 0x7C, 0x33,
+    0x63, 0xCD, 0xA5, 0x76, 0x76, 0xB6, 0x5B, 0xA5, 0xBC, 0x53, 0x14, 0x7C, 0x2F, 0x87, 0x98, 0x57,
+    0xE4, 0x33, 0xCE, 0xC1, 0x99, 0xF9, 0x93, 0x30, 0x1B, 0xD0, 0xCE, 0x8E, 0x84, 0x21, 0xCD, 0x55,
+    0xDC, 0xEE, 0x71, 0x80, 0xBA, 0xB0, 0xA6, 0xB7, 0xB9, 0x6B, 0x28, 0x6E, 0x60, 0xC3, 0x06, 0xD8,
+    0x86, 0xF6, 0x56, 0xD6, 0x86, 0xF0, 0x43, 0x93, 0x0B, 0xA6, 0xED, 0x01, 0xF0, 0x0D, 0xEA, 0x53,
+    0x83, 0x03, 0xE4, 0xA0, 0xC3, 0xD5, 0x75, 0xB8, 0xCF, 0xD6, 0x27, 0xBB, 0xF9, 0x0B, 0xBD, 0x55,
+    0x31, 0x8E, 0xD4, 0x40, 0x10, 0x6C, 0xAF, 0x05, 0x0E, 0x36, 0x70, 0xC2, 0x49, 0x64, 0x7E, 0x00,
+    0x81, 0x9F, 0x30, 0x86, 0x0F, 0x90, 0xEC, 0x46, 0x04, 0x90, 0x13, 0xF0, 0x04, 0xEF, 0x0F, 0x38,
+    0x02, 0xBE, 0x80, 0xC4, 0x5D, 0xC0, 0x13, 0xC6, 0x19, 0xE9, 0x4A, 0x7C, 0x60, 0x45, 0x46, 0xE6,
+    0xC0, 0x08, 0xDF, 0xC9, 0xEB, 0xA6, 0xAB, 0x7A, 0xBC, 0xBB, 0xC1, 0x49, 0x47, 0xC4, 0x48, 0x3B,
+    0xB3, 0xF6, 0xF4, 0x74, 0x77, 0x55, 0x75, 0x8F, 0x45, 0x38, 0xD6, 0x7B, 0x9B, 0xF2, 0xA3, 0x4D,
+    0x2B, 0xDD, 0x63, 0x9A, 0x45, 0x32, 0xFD, 0xD6, 0x8B, 0xE8, 0x4B, 0x6D, 0x44, 0x9B, 0x62, 0x94,
+    0x8B, 0xF1, 0x54, 0x77, 0x22, 0xB5, 0xDA, 0xBB, 0xA0, 0x47, 0x4C, 0xD1, 0x1E, 0x61, 0x51, 0x0E,
+    0x70, 0x36, 0x2E, 0xCE, 0x32, 0x85, 0x35, 0x8C, 0x25, 0x1C, 0xB0, 0x3D, 0x61, 0x47, 0x5F, 0x59,
+    0x88, 0xA8, 0xF6, 0xBF, 0x54, 0xED, 0xCC, 0x48, 0xED, 0x54, 0xA1, 0x07, 0xF7, 0xED, 0x67, 0x24,
+    0xF4, 0x98, 0x0B, 0x7F, 0xF0, 0xBD, 0x72, 0x96, 0x25, 0x41, 0x91, 0xAB, 0x8D, 0x3C, 0x3C, 0xB2,
+    0x38, 0x5F, 0xC3, 0x0A, 0x10, 0x6C, 0x86, 0xB5, 0xCD, 0x13, 0xB2, 0x54, 0xCB, 0xA4, 0xD4, 0xF9,
+    0xA6, 0xB7, 0x1C, 0x88, 0x27, 0x22, 0x49, 0xA9, 0x18, 0x24, 0x77, 0xBF, 0xED, 0xC4, 0x50, 0x06,
+    0x1A, 0x71, 0x99, 0x44, 0x3D, 0x5F, 0xEC, 0x87, 0xE3, 0xA5, 0xB1, 0x9D, 0x7C, 0x6E, 0x49, 0xEA,
+    0x97, 0xB8, 0xA3, 0xFF, 0xC1, 0x76, 0x6C, 0x34, 0x7C, 0xE8, 0x01, 0x4D, 0x95, 0x30, 0xE1, 0x29,
+    0x30, 0x27, 0x43, 0x9E, 0x10, 0x58, 0x88, 0x35, 0xA2, 0x19, 0x07, 0x52, 0x4D, 0x70, 0x6A, 0x44,
+    0xB5, 0xE3, 0x29, 0xFA, 0x99, 0xEB, 0xB5, 0x1D, 0xCC, 0x71, 0x4C, 0xE7, 0x89, 0x44, 0x93, 0x5D,
+    0x8B, 0x49, 0xC2, 0xC9, 0x18, 0xF8, 0xCD, 0xE7, 0x44, 0x1C, 0x29, 0xAE, 0x11, 0x1A, 0xC8, 0x0B,
+    0x9C, 0x4C, 0xFC, 0x56, 0x07, 0x81, 0xF5, 0x6A, 0x5E, 0x11, 0x54, 0xF8, 0x93, 0xE0, 0x70, 0x49,
+    0xE0, 0x5D, 0x26, 0xF3, 0xEB, 0x8B, 0x3C, 0x93, 0x47, 0x87, 0x93, 0x6E, 0x79, 0x92, 0x57, 0x8B,
+    0x0C, 0x7F, 0x81, 0xE0, 0x13, 0xEF, 0xB6, 0xDC, 0xDF, 0x76, 0x58, 0x76, 0xE4, 0xD4, 0x21, 0x3A,
+    0xF5, 0x0B, 0xE0, 0x02, 0x4C, 0x9C, 0xC8, 0x4D, 0xEC, 0x4B, 0xF4, 0xD2, 0x73, 0xE2, 0x17, 0xD3,
+    0x64, 0x93, 0x41, 0xD8, 0x77, 0x10, 0xE2, 0xFE, 0xFD, 0xE8, 0x44, 0x1F, 0x65, 0xD1, 0x00, 0xBA,
+    0x93, 0x5B, 0xA7, 0x3F, 0xF7, 0x32, 0x58, 0x64, 0x58, 0xB9, 0x4D, 0x1A, 0xED, 0xAE, 0x98, 0x12,
+    0x2B, 0xE5, 0x8C, 0xF7, 0x01, 0x27, 0x33, 0x92, 0xC6, 0x7A, 0x96, 0xF6, 0x21, 0xDC, 0x6C, 0x04,
+    0xA8, 0xE3, 0xF2, 0x50, 0x1F, 0xEF, 0x04, 0x2A, 0x44, 0x89, 0xBC, 0x29, 0xBC, 0xAC, 0xD9, 0x05,
+    0xF9, 0x7C, 0x2A, 0x70, 0xEF, 0x05, 0x2A, 0x45, 0xA9, 0x5C, 0xAB, 0x53, 0x33, 0x6C, 0x24, 0x43,
+    0x99, 0xC7, 0xA6, 0xEA, 0x79, 0xD8, 0xDD, 0xB9, 0x58, 0x05, 0xBA, 0x06, 0x30, 0x3A, 0x27, 0xCB,
+    0x13, 0x9A, 0x1E, 0x11, 0xCA, 0xFC, 0xFF, 0x72, 0xA1, 0x10, 0xA7, 0x74, 0x4A, 0x4A, 0x2F, 0xD3,
+    0xCA, 0x69, 0xB3, 0xF4, 0x2B, 0x73, 0x1A, 0x06, 0xFA, 0x46, 0x9A, 0x66, 0xDA, 0xDA, 0xD2, 0x76,
+    0x12, 0x0F, 0x5C, 0x70, 0x16, 0x8B, 0x85, 0x8E, 0x5D, 0x86, 0x45, 0x77, 0xB9, 0x1D, 0xCD, 0xB4,
+    0xC9, 0x15, 0xA8, 0xD8, 0xB8, 0x6B, 0x95, 0xB5, 0x41, 0x6D, 0x8F, 0xE8, 0xDC, 0x37, 0x16, 0x88,
+    0x71, 0x06, 0x8F, 0xD3, 0x03, 0x35, 0xE4, 0x09, 0xE7, 0x86, 0x39, 0x42, 0x48, 0x05, 0xF6, 0xE8,
+    0x69, 0xCA, 0x89, 0x7D, 0x29, 0xBD, 0x18, 0xAA, 0x9E, 0xE4, 0xD5, 0x3F, 0xC9, 0x41, 0xF8, 0x41,
+    0xBC, 0xE1, 0xBB, 0x77, 0xF3, 0x47, 0x32, 0xA2, 0xAF, 0x91, 0xEB, 0x41, 0xEB, 0x03, 0xD0, 0xCE,
+    0x61, 0xBF, 0xD4, 0x63, 0x24, 0xD8, 0x4C, 0x3F, 0xA9, 0x77, 0x50, 0x34, 0xF3, 0xF5, 0x40, 0x68,
+    0xE6, 0x1D, 0x4B, 0xB5, 0x97, 0x08, 0x3D, 0x1C, 0x5A, 0x70, 0x68, 0xA1, 0x2B, 0x58, 0xBF, 0xF7,
+    0xD1, 0xEB, 0x82, 0x62, 0xD5, 0xBE, 0x94, 0xBE, 0x14, 0x5E, 0x52, 0xA4, 0xC7, 0xEF, 0x05, 0xB6,
+    0x43, 0xED, 0x25, 0x96, 0x58, 0xCE, 0x1D, 0x6F, 0xE6, 0x24, 0xC0, 0x16, 0xD7, 0x47, 0xA2, 0x19,
+    0x2D, 0x67, 0x7F, 0x41, 0x1B, 0x0A, 0xD1, 0x02, 0xA2, 0x60, 0x9C, 0xE7, 0x6D, 0xBC, 0xDB, 0x48,
+    0xDD, 0xB7, 0x40, 0x51, 0x8E, 0x8C, 0x5C, 0x1C, 0xE1, 0xB4, 0x5B, 0xA9, 0x20, 0x45, 0x38, 0x88,
+    0x40, 0xBB, 0x97, 0x30, 0x66, 0x1F, 0x8C, 0xDB, 0xC4, 0x74, 0xA1, 0x0C, 0x8D, 0x52, 0x07, 0x03,
+    0x69, 0x49, 0x54, 0x43, 0x86, 0x91, 0xA5, 0xC0, 0x64, 0x2F, 0xB8, 0x0E, 0xDD, 0xF9, 0x22, 0x66,
+    0x54, 0x7A, 0xE8, 0x1D, 0x89, 0xED, 0x5D, 0xBD, 0xBD, 0xE3, 0xED, 0x1B, 0xD0, 0x83, 0xC6, 0x34,
+    0x1B, 0x19, 0xBE, 0xD2, 0x7D, 0xEB, 0xE4, 0x24, 0xA2, 0xCB, 0x81, 0x37, 0x76, 0x6C, 0x80, 0x2D,
+    0x9F, 0x78, 0xD3, 0x25, 0x9E, 0xA3, 0xE4, 0xE7, 0x77, 0x65, 0xCF, 0x6E, 0x4B, 0x34, 0x3B, 0x65,
+    0xAB, 0x73, 0xE7, 0x76, 0x27, 0x96, 0x57, 0x7E, 0x83, 0x70, 0x3C, 0xB1, 0xDF, 0x0B, 0x56, 0x4C,
+    0xE0, 0x81, 0x2A, 0xDD, 0xB7, 0x37, 0x5F, 0x1B, 0xF9, 0xA7, 0x91, 0xDD, 0xDC, 0xEA, 0xC0, 0x38,
+    0x13, 0x83, 0xA6, 0x12, 0x34, 0x0C, 0xF7, 0xDB, 0x66, 0xB9, 0x09, 0xF3, 0xF4, 0xE1, 0xF1, 0x6F,
+    0x02, 0xC9, 0x09, 0xBF, 0xB7, 0xD7, 0x0C, 0x37, 0x90, 0xC1, 0x24, 0xAF, 0x50, 0xDD, 0x66, 0x29,
+    0x04, 0xFF, 0x86, 0x55, 0xF4, 0xB1, 0x4E, 0x1F, 0x91, 0xCF, 0xDB, 0x8D, 0x0B, 0xE1, 0x81, 0xFC,
+    0xB3, 0x71, 0x20, 0xB3, 0x23, 0xF5, 0x9A, 0x5D, 0xAE, 0x9D, 0xFC, 0x97, 0xF1, 0x17, 0xE5, 0x55,
+    0x31, 0xAE, 0xD3, 0x40, 0x10, 0x1D, 0x7B, 0x95, 0x44, 0xC2, 0x85, 0x1B, 0xA8, 0x28, 0x5C, 0x53,
+    0xF9, 0x08, 0xF6, 0x11, 0x52, 0x7C, 0x17, 0x5C, 0x21, 0x42, 0xE2, 0x08, 0xC9, 0x11, 0x7E, 0x93,
+    0x86, 0x1B, 0x10, 0x8A, 0x7F, 0x84, 0xF5, 0x11, 0x72, 0x04, 0x0B, 0x01, 0x12, 0x54, 0x29, 0x8C,
+    0x64, 0x90, 0xBD, 0xC3, 0xCC, 0x1B, 0x6F, 0x9C, 0xEA, 0x83, 0x7E, 0xF5, 0x25, 0xB6, 0x18, 0xC5,
+    0xEB, 0xC9, 0xCC, 0x9B, 0xF7, 0x5E, 0x26, 0x44, 0x76, 0x56, 0x3B, 0x3F, 0x12, 0x15, 0xCC, 0x12,
+    0x2B, 0x44, 0x66, 0x1E, 0x88, 0x6A, 0x7A, 0xCA, 0x79, 0xFD, 0x4B, 0x42, 0xC2, 0x7C, 0x20, 0xCA,
+    0x98, 0x3B, 0xA2, 0x72, 0xD8, 0x5C, 0x88, 0xF6, 0xE7, 0xB4, 0x97, 0xC2, 0x1F, 0xFC, 0xA0, 0x2F,
+    0xA5, 0xBC, 0x43, 0xDC, 0x48, 0xEC, 0x25, 0xF1, 0xD4, 0x10, 0xE5, 0x17, 0xFD, 0x7E, 0xDE, 0x23,
+    0x06, 0x5A, 0xB7, 0x94, 0xCB, 0xDB, 0x16, 0x39, 0x07, 0xE4, 0x1F, 0x00, 0x4D, 0x9B, 0xF0, 0x3D,
+    0x9A, 0xBD, 0xA2, 0x95, 0xA0, 0xCC, 0xFA, 0x74, 0x22, 0xBC, 0x6A, 0xD1, 0x54, 0x2B, 0x54, 0xAC,
+    0x57, 0xE4, 0x03, 0xF2, 0x5E, 0x3E, 0x0A, 0x79, 0x7D, 0x7A, 0xE0, 0x33, 0xA5, 0x1C, 0x19, 0xE0,
+    0x1A, 0x3D, 0x05, 0x8E, 0xFF, 0xDE, 0x28, 0x98, 0x11, 0x69, 0xDA, 0x5E, 0xC6, 0x01, 0x3E, 0xC7,
+    0xB8, 0xAA, 0x7E, 0x36, 0x02, 0x44, 0x92, 0xB5, 0x99, 0x47, 0xFF, 0x1C, 0x55, 0x12, 0x54, 0x91,
+    0xD9, 0x6F, 0x92, 0xF7, 0x98, 0x2F, 0x33, 0x44, 0xFC, 0xB5, 0x69, 0x90, 0x2C, 0x6D, 0x34, 0x39,
+    0x58, 0xE7, 0x0E, 0x73, 0xCA, 0xC3, 0x1E, 0x0F, 0x99, 0x3D, 0x48, 0xBD, 0xAD, 0xCE, 0xB0, 0xE9,
+    0xD3, 0x80, 0x09, 0x47, 0x34, 0x1D, 0xB4, 0xB4, 0x52, 0x2C, 0x63, 0xAA, 0x58, 0x49, 0xFD, 0x7C,
+    0x95, 0xA2, 0x02, 0xDF, 0xA9, 0x2E, 0x0B, 0x13, 0x40, 0x9E, 0x20, 0xA6, 0xC2, 0xBF, 0x7C, 0x6E,
+    0x1E, 0x19, 0x60, 0x77, 0x12, 0x92, 0x4D, 0x23, 0x07, 0x28, 0x26, 0x51, 0x16, 0x8E, 0xDB, 0xA8,
+    0x50, 0x3E, 0x2C, 0x02, 0x59, 0x23, 0xD3, 0x47, 0xB8, 0x3C, 0x47, 0x79, 0x80, 0xD3, 0xD4, 0x49,
+    0x21, 0xA8, 0x89, 0xB3, 0xE1, 0x45, 0x9B, 0x3C, 0x34, 0xCD, 0x76, 0x96, 0xA6, 0x80, 0x0C, 0xD5,
+    0x4D, 0x34, 0x61, 0x3C, 0x1B, 0xF1, 0x52, 0x50, 0x31, 0xFB, 0x36, 0xB6, 0x2C, 0x47, 0xE3, 0x44,
+    0x4B, 0x1E, 0xFE, 0x32, 0xD2, 0xED, 0x49, 0x3C, 0x8C, 0x14, 0x66, 0x2D, 0xB2, 0x90, 0x8C, 0xB4,
+    0x99, 0xA8, 0xAC, 0x5D, 0xD8, 0x71, 0x67, 0x42, 0xC0, 0x0C, 0xDA, 0xBF, 0x2E, 0xC3, 0xC7, 0x3B,
+    0x53, 0xC1, 0x4D, 0x33, 0x95, 0xEF, 0x80, 0x6F, 0x96, 0x00, 0xE8, 0x72, 0x58, 0xF8, 0x3D, 0xAC,
+    0xF1, 0x2C, 0xD9, 0xAB, 0xCE, 0xC0, 0xAE, 0x21, 0x1D, 0xED, 0x87, 0xB2, 0x98, 0x81, 0x3C, 0xE2,
+    0xAA, 0xBE, 0x7A, 0x15, 0x56, 0x05, 0x3B, 0x30, 0x2A, 0x7C, 0xAA, 0x36, 0x05, 0x39, 0x30, 0x29,
+    0x3C, 0x0A, 0x8B, 0x82, 0x1B, 0x18, 0x14, 0xFE, 0x84, 0x3D, 0x41, 0x8D, 0x8B, 0xFC, 0xDC, 0x58,
+    0x93, 0x68, 0xAB, 0x43, 0x5C, 0xA2, 0x4B, 0xF7, 0x3A, 0x99, 0x0E, 0x93, 0x84, 0xAD, 0xB6, 0xBD,
+    0x44, 0xB3, 0x16, 0xE7, 0x45, 0xAF, 0x89, 0x32, 0xB9, 0x77, 0x21, 0x51, 0xFC, 0x2E, 0xEC, 0x3B,
+    0xF0, 0x00, 0x35, 0x32, 0xA5, 0xEA, 0xBA, 0x36, 0x8A, 0xF6, 0x1F, 0x56, 0xD0, 0xB5, 0xEC, 0xE9,
+    0x93, 0xAE, 0xAF, 0x92, 0x23, 0xDD, 0x13, 0xC5, 0x5D, 0x54, 0xFE, 0x86, 0x97, 0xAC, 0xB6, 0xB3,
+    0x2D, 0x62, 0x6A, 0xC5, 0x3B, 0x6E, 0xDE, 0x12, 0x16, 0x79, 0x7F, 0xDD, 0x46, 0xCE, 0x7E, 0x85,
+    0xF1, 0xAE, 0xBB, 0x59, 0x47, 0x85, 0xC1, 0x8B, 0x77, 0xC7, 0xE6, 0x2E, 0xEE, 0x23, 0xA8, 0x74,
+    0x88, 0x9B, 0x28, 0xB7, 0x7F, 0x03, 0x53, 0x4E, 0x2D, 0x64, 0x7B, 0xF0, 0xC5, 0x3D, 0xED, 0x60,
+    0x3F, 0x2F, 0xA8, 0xAA, 0xCF, 0x8C, 0xF1, 0x79, 0xD9, 0xB9, 0xF9, 0x34, 0xD3, 0xA4, 0xE7, 0x0D,
+    0x3D, 0xFD, 0xBF, 0x44, 0x3A, 0x63, 0xC5, 0x61, 0x11, 0xFA, 0x4E, 0xE9, 0xB4, 0x15, 0x55, 0x7D,
+    0x7B, 0x08, 0x18, 0x4D, 0x00, 0xE5, 0x40, 0x67, 0x3B, 0x2A, 0xE5, 0x1F, 0xC7, 0x7A, 0xF6, 0xD5,
+    0xEC, 0x31, 0x5B, 0x52, 0xEE, 0x3A, 0xDD, 0x80, 0xB1, 0x02, 0xC5, 0x2D, 0xB5, 0xE6, 0x2F, 0xF4,
+    0xDF, 0x9D, 0x3F, 0xE5, 0x55, 0x31, 0x6E, 0xDB, 0x40, 0x10, 0x5C, 0x8A, 0x90, 0x05, 0x98, 0xC5,
+    0x55, 0x71, 0xA1, 0x14, 0x7C, 0x40, 0x0A, 0x36, 0xEE, 0x8F, 0x4F, 0x50, 0x61, 0x17, 0x41, 0xDA,
+    0x34, 0x49, 0xA3, 0x27, 0x50, 0xFE, 0x81, 0x0A, 0x3F, 0x21, 0x2E, 0x5C, 0xA5, 0x0F, 0x10, 0x1F,
+    0x9F, 0xC0, 0x1F, 0x84, 0x85, 0x9B, 0x74, 0x2A, 0x54, 0xC8, 0x09, 0xC9, 0xCD, 0xEE, 0xCE, 0x51,
+    0xA0, 0x2A, 0xC7, 0xE9, 0x02, 0x13, 0x86, 0x17, 0xB7, 0xBC, 0xDB, 0x9D, 0x9B, 0x19, 0xAE, 0x88,
+    0x88, 0xB2, 0x9A, 0xEC, 0x61, 0x84, 0xA2, 0xB3, 0xB0, 0xE0, 0x3D, 0xB2, 0xDC, 0x6A, 0xF0, 0x6D,
+    0xD0, 0x6D, 0xD9, 0x9E, 0x42, 0x29, 0xF1, 0xCA, 0xFE, 0x5E, 0xF6, 0x9C, 0x7D, 0xBD, 0xD7, 0xA3,
+    0x05, 0x33, 0xC7, 0x20, 0x95, 0x73, 0x09, 0x83, 0x76, 0xC3, 0x92, 0x79, 0x4B, 0xEF, 0xA5, 0x1B,
+    0x97, 0xC0, 0xD0, 0x00, 0x03, 0xA0, 0xE4, 0x83, 0x85, 0x19, 0x03, 0xB0, 0x1F, 0x81, 0x96, 0xC9,
+    0x9D, 0xC4, 0xB0, 0x93, 0x9A, 0x4F, 0xE4, 0x58, 0x36, 0x48, 0x29, 0xDE, 0x49, 0x95, 0xC1, 0x96,
+    0x01, 0x4B, 0xF2, 0xBA, 0x2C, 0x29, 0x93, 0x73, 0x3C, 0x94, 0x17, 0x52, 0xC6, 0x69, 0x5B, 0x59,
+    0x06, 0x8D, 0x1B, 0x4A, 0x35, 0x48, 0x2F, 0x4B, 0x47, 0x8C, 0x1B, 0x89, 0x6F, 0xF9, 0xE7, 0xC9,
+    0x4D, 0x3C, 0x1A, 0x77, 0x13, 0x70, 0xDE, 0xA0, 0x66, 0xBD, 0xEE, 0x4F, 0x38, 0xD1, 0xD3, 0xBE,
+    0x9E, 0xF5, 0x7F, 0x41, 0x4B, 0xD1, 0x56, 0x1B, 0x6D, 0xF5, 0x23, 0x36, 0x26, 0x81, 0x11, 0x14,
+    0x6E, 0x28, 0xBD, 0x9C, 0xCF, 0x9B, 0x54, 0x80, 0xCE, 0x0E, 0xA6, 0x8B, 0x97, 0x77, 0x1B, 0xCA,
+    0x5A, 0xF2, 0xF2, 0xFE, 0xBB, 0x5C, 0x5D, 0x8E, 0x34, 0xA4, 0xC4, 0x0D, 0x54, 0xF5, 0x38, 0x5F,
+    0x2B, 0x8B, 0x7C, 0x10, 0x30, 0x12, 0x4A, 0x45, 0xA6, 0xC5, 0xC8, 0x68, 0xA6, 0xE4, 0x5B, 0xD5,
+    0x4C, 0xB1, 0x4B, 0xE7, 0x4B, 0xAA, 0xE4, 0x7D, 0x36, 0x70, 0x6F, 0xBB, 0xD8, 0xC0, 0x68, 0xC9,
+    0xD4, 0xAA, 0xD0, 0x85, 0xFD, 0xB7, 0xE7, 0x13, 0x9D, 0x6F, 0x25, 0xB8, 0xA7, 0x0F, 0x1D, 0xAC,
+    0x61, 0x4A, 0x64, 0x68, 0x20, 0x8D, 0x50, 0x74, 0x7D, 0xA0, 0x57, 0x68, 0x8D, 0x37, 0x94, 0xAC,
+    0xC8, 0x74, 0xA8, 0x8D, 0x3A, 0x05, 0xE4, 0xC0, 0x4C, 0x6E, 0x27, 0x24, 0x00, 0x72, 0xF9, 0x0C,
+    0x19, 0xE1, 0x66, 0xA0, 0xD1, 0x10, 0x29, 0x38, 0xF6, 0xBF, 0xB5, 0x84, 0xD8, 0x49, 0x21, 0xC0,
+    0x11, 0xF4, 0x20, 0xC4, 0xCB, 0x06, 0xB9, 0x8B, 0xF0, 0x5D, 0x6C, 0x48, 0x73, 0xB0, 0x44, 0xBA,
+    0xB7, 0x9C, 0x6B, 0x8D, 0x24, 0x0F, 0xC0, 0xF0, 0x84, 0xDC, 0x5F, 0x73, 0x29, 0x72, 0x51, 0xE1,
+    0xD1, 0x14, 0x09, 0x26, 0x80, 0xD3, 0x5C, 0x93, 0x68, 0xBD, 0xE8, 0x0A, 0x6F, 0x02, 0xCC, 0x8E,
+    0x97, 0x6A, 0x4F, 0x6D, 0x41, 0xF3, 0x15, 0x80, 0x1B, 0xF9, 0x29, 0xAA, 0x14, 0x78, 0x8D, 0xE9,
+    0xB1, 0x80, 0x68, 0xBE, 0x7F, 0x89, 0x29, 0x96, 0x0F, 0x77, 0x47, 0x4F, 0x64, 0x06, 0x3F, 0x81,
+    0x15, 0x72, 0x48, 0x02, 0x43, 0x38, 0xB0, 0x5A, 0xF5, 0xE8, 0xDD, 0x4C, 0xDC, 0x10, 0x76, 0xC8,
+    0x19, 0xAC, 0xBC, 0xA7, 0xB3, 0xDB, 0xD1, 0x0A, 0x9A, 0x0B, 0x7C, 0x10, 0x07, 0x08, 0x05, 0xAD,
+    0xB8, 0xE5, 0x5C, 0x0A, 0xC2, 0x07, 0x5A, 0x62, 0xC6, 0x52, 0xF6, 0x31, 0x59, 0x77, 0x46, 0x9E,
+    0xE4, 0xC3, 0xD8, 0x91, 0x95, 0x0F, 0xE4, 0x34, 0x39, 0x9C, 0x0C, 0x87, 0xAC, 0xC3, 0xA4, 0x34,
+    0x23, 0xAA, 0x39, 0x5C, 0x7F, 0x84, 0x01, 0x14, 0xF3, 0xEB, 0x67, 0x64, 0x37, 0xD5, 0x21, 0xBA,
+    0x69, 0x0E, 0xC9, 0xA1, 0xB8, 0x09, 0x0E, 0xBD, 0x21, 0xB7, 0xA9, 0x0D, 0xB1, 0xA1, 0x35, 0xA4,
+    0x36, 0xAA, 0x20, 0x74, 0x1A, 0xE7, 0x89, 0x6A, 0x15, 0x55, 0x86, 0xC8, 0xAA, 0xB1, 0x49, 0x0C,
+    0x85, 0x4D, 0x60, 0xE8, 0x0B, 0x79, 0x27, 0xEA, 0x5E, 0x5F, 0x4D, 0xBE, 0xB7, 0x82, 0x27, 0x5F,
+    0x5D, 0x64, 0x36, 0xFE, 0x60, 0x40, 0x69, 0x87, 0x0D, 0xD5, 0x61, 0xB2, 0x61, 0x79, 0x4F, 0xFF,
+    0xF0, 0x7C, 0xFE, 0x75, 0x4B, 0x46, 0x72, 0x37, 0x4E, 0x84, 0x05, 0x54, 0xA8, 0x6C, 0x2E, 0xA4,
+    0xF2, 0x9D, 0x26, 0x1F, 0xE3, 0x38, 0x48, 0x00, 0xC8, 0xC1, 0x66, 0x68, 0x1E, 0x67, 0xC1, 0x08,
+    0x68, 0x4F, 0xCB, 0x95, 0xE5, 0x02, 0x3F, 0xC6, 0x41, 0x20, 0xBA, 0x3B, 0xE8, 0xFE, 0x8E, 0x07,
+    0xC3, 0xAA, 0x96, 0xB0, 0x29, 0xE0, 0x79, 0x3B, 0x17, 0xDD, 0xB4, 0x21, 0xD7, 0xCA, 0xA5, 0x75,
+    0xB4, 0x11, 0x60, 0xA1, 0x36, 0x82, 0xB5, 0xCF, 0x9A, 0xBF, 0xD0, 0xFF, 0xFB, 0xFC, 0x01, 0xCD,
+    0x95, 0x31, 0x6E, 0xD5, 0x40, 0x10, 0x86, 0xC7, 0xB6, 0x88, 0x25, 0xB6, 0x70, 0x83, 0x28, 0xD2,
+    0xF8, 0x06, 0xF8, 0x06, 0xEC, 0x13, 0x27, 0x48, 0x91, 0x57, 0xD3, 0x43, 0xC1, 0x09, 0x90, 0xDD,
+    0xD1, 0xD2, 0xD0, 0xD3, 0x20, 0xA1, 0x50, 0x84, 0x1A, 0x29, 0x59, 0x1F, 0xC1, 0x37, 0x88, 0x29,
+    0x90, 0x50, 0x68, 0x56, 0xC2, 0x42, 0x46, 0xB2, 0xBD, 0xFC, 0xFF, 0xAC, 0x1D, 0x92, 0x08, 0x22,
+    0x4A, 0xAC, 0xF7, 0xC6, 0xCF, 0xEB, 0xDD, 0xD9, 0xF9, 0xBF, 0x99, 0xD9, 0x27, 0xB2, 0x5D, 0x61,
+    0x52, 0x3B, 0xC0, 0x24, 0xC1, 0xC3, 0xA6, 0xA1, 0x83, 0xCD, 0x42, 0x0B, 0x6B, 0x02, 0x5F, 0x96,
+    0x0B, 0xAD, 0xD5, 0x89, 0x6E, 0xD4, 0xE9, 0x5E, 0x6E, 0x5E, 0xE9, 0x92, 0xE3, 0x45, 0x15, 0x2E,
+    0xE0, 0x27, 0x04, 0xBC, 0xCE, 0x82, 0x83, 0x35, 0x43, 0x06, 0x6F, 0x65, 0x47, 0x6F, 0x55, 0x93,
+    0xC2, 0x5A, 0xBC, 0x69, 0xE4, 0x1C, 0x56, 0xE4, 0x4C, 0x72, 0xD8, 0x59, 0x0A, 0xF8, 0x5F, 0xA4,
+    0x9E, 0x75, 0xE9, 0xA4, 0x16, 0xCE, 0x5C, 0x60, 0x50, 0x96, 0xCE, 0xA4, 0x08, 0xA1, 0x47, 0x7C,
+    0x9F, 0x6A, 0x86, 0x26, 0x75, 0xAB, 0x31, 0x34, 0x92, 0xED, 0xE8, 0xC0, 0x2C, 0x61, 0xD6, 0x29,
+    0x1A, 0x01, 0x27, 0x62, 0x51, 0x23, 0xF2, 0x30, 0x8C, 0x37, 0x62, 0xCC, 0x06, 0xBD, 0x95, 0x31,
+    0x76, 0x55, 0x8C, 0x55, 0x3A, 0xC7, 0x5D, 0xF0, 0x96, 0x4F, 0x39, 0x35, 0xDA, 0x36, 0x9D, 0xE5,
+    0x8E, 0x2B, 0x0D, 0x3B, 0x29, 0x26, 0x7E, 0xA4, 0xEE, 0xC5, 0x7A, 0x0E, 0x24, 0xD8, 0x90, 0x63,
+    0x58, 0x58, 0xFB, 0x38, 0xD6, 0x26, 0x90, 0x0B, 0x69, 0x64, 0x68, 0x07, 0xB1, 0x23, 0xF8, 0x62,
+    0xAC, 0xC3, 0x9E, 0x71, 0x6C, 0x24, 0x52, 0x0E, 0x20, 0x64, 0x0C, 0xE4, 0xE1, 0xCD, 0xBE, 0x9E,
+    0xA8, 0x80, 0x1A, 0x68, 0x43, 0x93, 0xD3, 0xCE, 0x71, 0xCC, 0xC7, 0xB1, 0x36, 0xA3, 0x5D, 0xA4,
+    0x0C, 0xAA, 0x01, 0xF1, 0xE7, 0x1C, 0xEB, 0x30, 0x29, 0x8E, 0x8D, 0xE2, 0x26, 0x8C, 0xF5, 0x54,
+    0xA2, 0x12, 0xFD, 0x96, 0x48, 0x43, 0xCD, 0x39, 0xD9, 0x64, 0xB3, 0x19, 0x61, 0x20, 0x55, 0x8E,
+    0x45, 0x8E, 0xAE, 0xAB, 0x33, 0x24, 0x91, 0x29, 0x00, 0x4D, 0xBE, 0x6B, 0xE8, 0xA8, 0xBB, 0x72,
+    0x74, 0xED, 0xF5, 0x8B, 0x9F, 0x9A, 0xA5, 0x8E, 0xBC, 0x27, 0x6C, 0xFE, 0x8D, 0xC2, 0x76, 0x15,
+    0xA2, 0x11, 0xE3, 0x41, 0x24, 0x9D, 0xC4, 0xB5, 0xC8, 0x2C, 0x70, 0xD8, 0xA6, 0x1C, 0xA5, 0xEA,
+    0x0C, 0x92, 0xED, 0xF1, 0x3A, 0x9F, 0x12, 0x06, 0x2D, 0x0E, 0x42, 0x1B, 0x80, 0x70, 0x5D, 0x89,
+    0x60, 0x3C, 0x56, 0x97, 0x93, 0x1C, 0xB6, 0xF7, 0x76, 0x57, 0x94, 0x59, 0x27, 0x58, 0xCA, 0x5B,
+    0x35, 0x48, 0x8E, 0x4A, 0x81, 0x37, 0x13, 0x31, 0x93, 0xB6, 0xF3, 0x52, 0xB2, 0x70, 0x56, 0x62,
+    0xF0, 0xAB, 0x37, 0x85, 0x14, 0xC6, 0x78, 0x1B, 0x58, 0xAF, 0x39, 0xFC, 0x45, 0xD0, 0x49, 0xF8,
+    0xB2, 0x7F, 0x1A, 0xB0, 0x01, 0x2F, 0x59, 0x71, 0xAE, 0xA4, 0x8D, 0xAE, 0x66, 0x31, 0x5D, 0xDD,
+    0xC6, 0x0D, 0xB5, 0x5D, 0xB4, 0x43, 0xEC, 0x8C, 0xA5, 0x5E, 0x6A, 0xC6, 0xD6, 0xFF, 0x66, 0xAD,
+    0x9C, 0xB0, 0x07, 0xE6, 0x7C, 0x68, 0x18, 0xCC, 0x8E, 0x06, 0x4F, 0xCB, 0xD1, 0x4A, 0x4D, 0xF9,
+    0x95, 0x3F, 0xC2, 0x6B, 0xE6, 0x73, 0x88, 0xD0, 0xEA, 0x70, 0x0A, 0x48, 0x03, 0x48, 0x85, 0x36,
+    0x9D, 0x94, 0x59, 0x8A, 0x98, 0x10, 0x38, 0x0C, 0xD4, 0x9A, 0x41, 0x91, 0x01, 0x44, 0xE9, 0x81,
+    0xC6, 0xFA, 0x0A, 0x55, 0xD3, 0x2B, 0xB1, 0x1A, 0xB2, 0x5A, 0x37, 0x00, 0xE4, 0xC1, 0xC7, 0xE4,
+    0x2A, 0x85, 0x67, 0x86, 0x85, 0x88, 0xC4, 0xBB, 0x9F, 0xA0, 0xF6, 0x1D, 0x25, 0x58, 0xBE, 0x02,
+    0xB4, 0xC7, 0xA6, 0x97, 0x3B, 0xAF, 0xE2, 0xBD, 0x28, 0x5A, 0x61, 0x25, 0x2B, 0x60, 0x7D, 0x12,
+    0x1E, 0x03, 0x19, 0xFB, 0xBF, 0x64, 0xBF, 0x38, 0x3E, 0xB1, 0x2C, 0x0A, 0x0A, 0x62, 0x37, 0xA6,
+    0xFA, 0xA4, 0x6D, 0xD3, 0xFF, 0x71, 0xB1, 0x56, 0x9E, 0xE5, 0x74, 0x9E, 0x2B, 0xCC, 0x42, 0x3C,
+    0x49, 0xD8, 0xD6, 0x39, 0xA7, 0x1F, 0x9E, 0x6F, 0x31, 0xD8, 0xAC, 0xCF, 0x42, 0xD1, 0x56, 0xCB,
+    0x4B, 0x99, 0x82, 0x37, 0x9F, 0x43, 0x53, 0x3C, 0x19, 0x6F, 0x07, 0x6A, 0xDE, 0xB2, 0x43, 0x25,
+    0x41, 0x4C, 0x66, 0xD0, 0x9F, 0xAC, 0x53, 0x3D, 0x7D, 0x3A, 0xFD, 0x99, 0xC1, 0x7B, 0xD9, 0x6B,
+    0x2E, 0x58, 0xA7, 0x6C, 0x77, 0x84, 0xBD, 0xD6, 0x91, 0x3C, 0x5F, 0x39, 0x3C, 0x90, 0x03, 0x87,
+    0x7C, 0x17, 0x4C, 0xBA, 0x65, 0x01, 0xB8, 0x70, 0xF2, 0x4E, 0xFE, 0xE1, 0xCA, 0x2E, 0x65, 0x65,
+    0xC0, 0x62, 0x8C, 0x62, 0x55, 0x7F, 0x34, 0xE3, 0x86, 0xAA, 0xF2, 0x1B, 0x05, 0x82, 0x51, 0x56,
+    0x8A, 0x4F, 0xA1, 0xF0, 0xF0, 0x8A, 0xB0, 0x58, 0xE6, 0xD1, 0x5D, 0x16, 0xB6, 0x3E, 0xE5, 0x79,
+    0xA8, 0xC5, 0xAD, 0xA5, 0x1D, 0x71, 0xA9, 0xA9, 0xE9, 0xFD, 0xD9, 0x8A, 0x64, 0xCF, 0xDE, 0x6B,
+    0x6B, 0x94, 0x12, 0xE2, 0x9F, 0xAB, 0xCB, 0x93, 0xFD, 0x5F, 0x8E, 0xAB, 0xAF, 0x6B, 0x2B, 0xD7,
+    0x4D, 0x64, 0xC4, 0x3A, 0x24, 0x24, 0x22, 0x14, 0xB7, 0x8B, 0x0C, 0x39, 0x48, 0x88, 0xDA, 0xDA,
+    0x8C, 0x89, 0x87, 0x2C, 0x35, 0x50, 0x16, 0x95, 0x26, 0xA7, 0xCD, 0x56, 0x27, 0x1C, 0x22, 0xCB,
+    0x6A, 0x88, 0x0A, 0xF5, 0xDB, 0x47, 0x8D, 0x94, 0x48, 0x85, 0xD0, 0x96, 0xC0, 0x0D, 0xCB, 0x83,
+    0xC2, 0x58, 0x42, 0xF4, 0x42, 0x5C, 0x5C, 0xCE, 0x6F, 0x35, 0xC5, 0xC2, 0xC0, 0xE1, 0x28, 0xF5,
+    0x10, 0x2B, 0x02, 0xDF, 0x04, 0xED, 0x94, 0x4E, 0x47, 0x38, 0x42, 0xB0, 0x0B, 0x3C, 0x5A, 0xEC,
+    0x8B, 0x9E, 0x53, 0x02, 0x86, 0x14, 0x8E, 0x63, 0xB1, 0x60, 0xC3, 0x7C, 0x5E, 0xCB, 0x0A, 0xAD,
+    0xC1, 0x13, 0x37, 0x4E, 0x4A, 0xF6, 0xBB, 0x5B, 0x08, 0x1E, 0x35, 0x51, 0xB1, 0x22, 0x60, 0xD5,
+    0x28, 0x0F, 0x4A, 0x56, 0x06, 0x84, 0x92, 0xC5, 0x93, 0x3F, 0x42, 0x50, 0x00, 0xC5, 0xC0, 0x14,
+    0xAD, 0x99, 0xD4, 0xE4, 0xE0, 0xB4, 0xC7, 0x9F, 0xCD, 0x9A, 0x38, 0xEE, 0xAF, 0xD9, 0xD6, 0xE6,
+    0xC0, 0xDE, 0x09, 0xFF, 0x4A, 0x0C, 0x5F, 0xDD, 0xF7, 0xF2, 0xBF, 0x5F, 0xBF, 0x00, 0xAD, 0x55,
+    0x3D, 0x6E, 0xD5, 0x40, 0x10, 0x1E, 0xDB, 0x52, 0x5C, 0xBC, 0xC2, 0x55, 0x9A, 0x34, 0xBE, 0x41,
+    0xF6, 0x08, 0x36, 0x35, 0x4D, 0x0A, 0xDE, 0x29, 0x52, 0x70, 0x03, 0xFC, 0x8E, 0xC0, 0x21, 0xA8,
+    0xD2, 0xE4, 0x06, 0xD8, 0xA2, 0xA5, 0xB1, 0x68, 0x69, 0x5C, 0x20, 0x21, 0xD1, 0xC4, 0x12, 0x46,
+    0x58, 0xC8, 0xCF, 0xC3, 0x7C, 0xDF, 0xEC, 0x7B, 0x79, 0x21, 0x21, 0x34, 0x58, 0xF2, 0xAE, 0x77,
+    0xF6, 0xDB, 0xF9, 0xF9, 0x66, 0x76, 0x2C, 0x22, 0xBA, 0x13, 0x69, 0x06, 0x91, 0x30, 0x89, 0x14,
+    0x7B, 0x91, 0x8D, 0x8A, 0x64, 0xDA, 0x89, 0x6C, 0xAF, 0xE4, 0xC9, 0x27, 0xFB, 0x66, 0x03, 0x00,
+    0xC7, 0x53, 0x0B, 0x4E, 0x48, 0x54, 0xD5, 0x9B, 0x70, 0x8C, 0xC2, 0x55, 0x24, 0xD1, 0x5A, 0xA4,
+    0x35, 0x74, 0x05, 0xE1, 0x2C, 0x92, 0x9B, 0x30, 0x85, 0x50, 0xA3, 0x30, 0x18, 0xB2, 0x58, 0xA1,
+    0xA2, 0x36, 0xB4, 0x1D, 0x57, 0x13, 0x56, 0x26, 0x2C, 0x4D, 0x78, 0x76, 0x6B, 0x3A, 0xE5, 0x72,
+    0x97, 0x2D, 0xD2, 0xEC, 0x36, 0x93, 0xA8, 0x14, 0x63, 0xB2, 0x4A, 0xE8, 0x4D, 0x50, 0x75, 0xF9,
+    0x2C, 0x5A, 0x17, 0x53, 0xA2, 0x66, 0xD2, 0x3C, 0x68, 0x86, 0xB3, 0xF7, 0xA6, 0xFC, 0x97, 0xE9,
+    0xB9, 0xA9, 0x85, 0xAA, 0x7A, 0x9A, 0xB0, 0x17, 0xFE, 0x98, 0x25, 0x58, 0x37, 0x63, 0x70, 0x00,
+    0xF6, 0xCC, 0x87, 0xC4, 0x5E, 0x60, 0xDA, 0x81, 0xEE, 0x55, 0x93, 0xE4, 0xC6, 0x42, 0xB9, 0x18,
+    0xC6, 0xC8, 0x58, 0xE9, 0x27, 0xA0, 0xD5, 0xC0, 0xCF, 0xD2, 0x02, 0x6E, 0x47, 0xD9, 0x2C, 0x84,
+    0x22, 0x6C, 0xD3, 0x0C, 0x1D, 0xB9, 0x52, 0x47, 0x6A, 0x24, 0xD8, 0x06, 0x2C, 0xC3, 0x64, 0x33,
+    0x72, 0x23, 0xCC, 0xB6, 0xD1, 0x91, 0x5F, 0x1D, 0x78, 0xAA, 0x99, 0x09, 0x0D, 0x7B, 0x87, 0x2A,
+    0x9D, 0x4C, 0x6F, 0x3B, 0x58, 0xC6, 0x03, 0xA8, 0x78, 0x36, 0x24, 0x1D, 0x36, 0x20, 0x4B, 0x54,
+    0x11, 0x93, 0x34, 0x0A, 0x86, 0xA4, 0x52, 0x9D, 0x00, 0x54, 0x5D, 0x08, 0xE4, 0x94, 0xA9, 0xCE,
+    0x38, 0x77, 0xA1, 0x5F, 0x1E, 0x24, 0xED, 0xDC, 0x08, 0x87, 0xCB, 0xE6, 0xA0, 0x4D, 0x6D, 0x2F,
+    0xC6, 0x1F, 0x0C, 0x6F, 0xDC, 0x79, 0x8B, 0x9C, 0x39, 0xB7, 0xF4, 0xF8, 0xF4, 0xE4, 0x73, 0x89,
+    0xFC, 0x5A, 0x78, 0x86, 0x68, 0x6B, 0x7C, 0x89, 0xF2, 0x2B, 0x59, 0xF9, 0x95, 0xEE, 0x39, 0x99,
+    0x66, 0x08, 0xB2, 0x99, 0x82, 0x7C, 0xA2, 0xA9, 0x62, 0xF4, 0x69, 0x10, 0xCB, 0x99, 0x94, 0x16,
+    0xB1, 0xF9, 0x1E, 0x3A, 0x4E, 0xA6, 0xAF, 0xB4, 0x80, 0x9A, 0x9A, 0x85, 0xD3, 0x7A, 0x55, 0x28,
+    0xEB, 0x0B, 0x1A, 0xAE, 0x07, 0x1E, 0x15, 0xAF, 0x29, 0x84, 0x38, 0xFB, 0x34, 0x3A, 0x41, 0x03,
+    0xB7, 0xDC, 0x6D, 0x94, 0xCC, 0xE9, 0x93, 0x0F, 0x3E, 0xA3, 0xDE, 0xB0, 0xED, 0xA4, 0x46, 0x0D,
+    0xE2, 0x3C, 0x9A, 0x55, 0x14, 0x2D, 0x1C, 0x6B, 0x51, 0x6C, 0xE7, 0x22, 0xAF, 0xE4, 0xEF, 0xCF,
+    0x26, 0x9A, 0x60, 0x2A, 0xE4, 0x90, 0xAE, 0x0C, 0xB5, 0x2F, 0xEE, 0xFA, 0x21, 0x6D, 0x8F, 0x40,
+    0xE9, 0x01, 0x34, 0xB9, 0x73, 0x11, 0xD4, 0x0E, 0x27, 0xD1, 0x31, 0x1D, 0x04, 0xCD, 0x51, 0x71,
+    0x04, 0x8D, 0xA7, 0x65, 0x21, 0x11, 0x14, 0x0E, 0x20, 0x8F, 0xAF, 0x89, 0xA0, 0xF5, 0x44, 0xD3,
+    0xE5, 0x8B, 0x36, 0x16, 0x06, 0x41, 0xAD, 0x07, 0x1D, 0xAB, 0x26, 0x89, 0x52, 0xAB, 0x25, 0x60,
+    0x93, 0x6B, 0x7D, 0xFB, 0x47, 0xB8, 0x95, 0x2B, 0xA6, 0x39, 0x52, 0x9D, 0xF2, 0x60, 0xBE, 0xE2,
+    0x5C, 0x31, 0x85, 0x01, 0xF9, 0xCB, 0x97, 0x7F, 0xD2, 0x76, 0xE5, 0x1E, 0x91, 0x06, 0xC6, 0xE0,
+    0x39, 0xF5, 0x31, 0x27, 0x21, 0xC5, 0x78, 0x3F, 0x96, 0xE4, 0x24, 0xD0, 0x6C, 0xC5, 0xB1, 0x21,
+    0x77, 0xAD, 0x47, 0x4F, 0x65, 0x8C, 0x32, 0x3D, 0x55, 0x43, 0x36, 0x8A, 0xE9, 0x98, 0x88, 0x82,
+    0x1E, 0x7B, 0x6D, 0x04, 0x92, 0x5F, 0xF1, 0xE8, 0xC5, 0xBB, 0xE3, 0xBD, 0xD8, 0xD2, 0x1A, 0xF7,
+    0xFC, 0x92, 0x65, 0x9E, 0x33, 0x2F, 0x8D, 0xC6, 0x75, 0x51, 0x7B, 0xD8, 0xDF, 0x57, 0x58, 0x41,
+    0x35, 0x67, 0x37, 0xF5, 0x33, 0x11, 0x5B, 0xD7, 0xC3, 0x91, 0x6A, 0xC4, 0x91, 0x72, 0xC2, 0x58,
+    0x2C, 0x38, 0x98, 0xAD, 0x18, 0x53, 0x7D, 0xC9, 0x9E, 0xF9, 0x11, 0x44, 0x36, 0x5F, 0x31, 0x86,
+    0x9F, 0xF0, 0xC3, 0x52, 0xB3, 0x43, 0x71, 0xC0, 0x9B, 0x4C, 0xE3, 0xC5, 0xEF, 0x98, 0xBA, 0x8E,
+    0x11, 0x0C, 0xF4, 0x78, 0xEF, 0x97, 0xDE, 0x41, 0x8B, 0xA7, 0xD2, 0x16, 0xFA, 0x19, 0xC5, 0x5D,
+    0x8D, 0x50, 0x12, 0x96, 0x60, 0x2D, 0xA2, 0x58, 0x0D, 0x50, 0xE7, 0x5A, 0x37, 0x3A, 0x5A, 0x13,
+    0x32, 0xF5, 0xA0, 0x6D, 0x3D, 0xF2, 0xC8, 0xDC, 0x86, 0xFE, 0x40, 0x3D, 0x72, 0x19, 0x53, 0xA4,
+    0x47, 0xDE, 0x43, 0xBF, 0xAD, 0x6D, 0x1B, 0x6D, 0x6E, 0xB6, 0x21, 0x5D, 0x69, 0x8A, 0xFD, 0x1E,
+    0x43, 0x70, 0xBF, 0x7B, 0xB8, 0xBD, 0x20, 0x34, 0xDF, 0x46, 0xFF, 0xBB, 0x83, 0x1F, 0xDF, 0xCD,
+    0xA7, 0x62, 0xA9, 0xCC, 0x8B, 0x75, 0xA3, 0x93, 0x35, 0x5F, 0xD5, 0x67, 0x78, 0xF3, 0x9B, 0xCD,
+    0xE6, 0xD6, 0x2C, 0x07, 0xE2, 0xC9, 0x38, 0xAF, 0x55, 0x0E, 0x63, 0xEC, 0x56, 0x29, 0xA9, 0xF0,
+    0x06, 0x90, 0x5C, 0x6D, 0x25, 0x9D, 0xCC, 0xD9, 0xA5, 0xDA, 0xC9, 0x1B, 0x2B, 0x99, 0xF0, 0xDA,
+    0xBA, 0xCB, 0x5D, 0xC7, 0x86, 0x96, 0xC5, 0x7F, 0x01, 0x6F, 0x51, 0x85, 0xF6, 0x8E, 0xD6, 0x77,
+    0xB7, 0x48, 0xF6, 0x43, 0xBB, 0x64, 0xB1, 0xFC, 0xAE, 0xF7, 0x7D, 0x2F, 0x85, 0xE1, 0xD2, 0x56,
+    0x09, 0x8C, 0x17, 0x43, 0x24, 0x62, 0x33, 0x3D, 0xF4, 0x11, 0xA0, 0x59, 0xFC, 0xDF, 0xC6, 0x55,
+    0xC1, 0x55, 0x7F, 0x58, 0x2D, 0x8F, 0x56, 0xF8, 0x5F, 0xF2, 0xA6, 0x3E, 0xB5, 0x1A, 0x63, 0x7B,
+    0x28, 0xD6, 0x9B, 0xDB, 0xC9, 0x3A, 0xBC, 0x7E, 0xB0, 0x57, 0x2D, 0x59, 0x3A, 0x63, 0xF5, 0x09,
+    0x2B, 0xF9, 0xEF, 0xCF, 0x6F, 0x8D, 0x55, 0x4B, 0x92, 0xD3, 0x30, 0x10, 0x95, 0xAD, 0x0A, 0x5E,
+    0x78, 0xE1, 0x23, 0x78, 0xCF, 0xC6, 0x37, 0x40, 0x73, 0x03, 0x58, 0xC0, 0x79, 0xEC, 0x23, 0x70,
+    0x03, 0x58, 0xB0, 0xA0, 0xC2, 0x09, 0xD8, 0x20, 0x4F, 0x71, 0x01, 0x73, 0x83, 0xCC, 0x96, 0x0D,
+    0x1E, 0xC6, 0x14, 0x21, 0xE5, 0xB8, 0x79, 0xAF, 0x25, 0xDB, 0x99, 0x9A, 0x90, 0xE0, 0xAA, 0xB4,
+    0x3A, 0x6E, 0xA9, 0x3F, 0xAF, 0x5F, 0xCB, 0xC6, 0x98, 0xA2, 0x35, 0xC6, 0x0E, 0xC6, 0x98, 0x2F,
+    0xF8, 0x95, 0xF8, 0x93, 0xED, 0xA1, 0x88, 0xB9, 0xF8, 0x1C, 0xB8, 0xB7, 0x37, 0x26, 0x3D, 0x42,
+    0x71, 0xF3, 0x21, 0x7F, 0x03, 0x77, 0x78, 0x9B, 0xF0, 0x74, 0xD5, 0xC1, 0xEF, 0x08, 0xA5, 0x86,
+    0x39, 0x57, 0x9F, 0xD1, 0x9C, 0x4E, 0x3C, 0x74, 0xD6, 0x5C, 0x2E, 0x66, 0x69, 0x8D, 0x15, 0xD8,
+    0x6B, 0x69, 0x4C, 0x26, 0xB4, 0x1B, 0xD7, 0x73, 0xFB, 0x8E, 0x81, 0x5A, 0xEE, 0x57, 0xD1, 0xE0,
+    0x00, 0x4F, 0x5A, 0xC6, 0x54, 0x91, 0x33, 0xA7, 0x62, 0x9C, 0x45, 0xC9, 0xB3, 0x6E, 0x78, 0x74,
+    0x5E, 0xBA, 0x78, 0x3E, 0xA1, 0x48, 0xE9, 0xC4, 0xCA, 0xF6, 0xD3, 0x31, 0x13, 0x91, 0x31, 0xA7,
+    0x28, 0x20, 0xF6, 0x25, 0xC4, 0x50, 0x41, 0xF4, 0xFF, 0x46, 0xC2, 0x31, 0xA4, 0x63, 0xC8, 0x9A,
+    0xD1, 0x3C, 0x03, 0x71, 0x7F, 0x4A, 0xCF, 0x19, 0x3D, 0x17, 0x8A, 0x06, 0x8B, 0x7A, 0xFE, 0x31,
+    0x9C, 0x79, 0x81, 0xB7, 0xD9, 0x78, 0x0A, 0xD8, 0xF4, 0x04, 0xB0, 0x21, 0x36, 0xA1, 0x7C, 0x02,
+    0x98, 0xA7, 0xCF, 0xB3, 0xE6, 0x6C, 0x31, 0x33, 0x03, 0x81, 0xBD, 0x94, 0x1D, 0x6A, 0x9C, 0x2E,
+    0xF6, 0xB2, 0x02, 0x7C, 0x96, 0x07, 0xDC, 0x18, 0x33, 0xF6, 0xF8, 0x53, 0x4E, 0xC4, 0xA4, 0x0D,
+    0x15, 0xB1, 0x04, 0xAB, 0xA0, 0x05, 0xD4, 0x15, 0xC4, 0xAA, 0x9F, 0x21, 0xB6, 0x0C, 0x80, 0x2E,
+    0x94, 0x1D, 0xCC, 0xA8, 0xC7, 0xF5, 0x48, 0xB4, 0x1A, 0x90, 0x17, 0xCC, 0xC2, 0xAE, 0xD4, 0x6D,
+    0x22, 0x8D, 0xDB, 0x01, 0x78, 0x35, 0xCF, 0x6D, 0x29, 0x8E, 0x73, 0xD3, 0xB4, 0x11, 0xC6, 0xD3,
+    0xAF, 0x3B, 0x6C, 0xA5, 0x23, 0xF4, 0xBD, 0x76, 0xC2, 0x42, 0x4C, 0x09, 0x84, 0xDC, 0x78, 0x88,
+    0x56, 0x73, 0xAE, 0x9B, 0x08, 0x98, 0xC2, 0xA7, 0xEC, 0x3B, 0x58, 0x38, 0xAB, 0x6F, 0x85, 0xEF,
+    0x81, 0x41, 0xD1, 0x03, 0x11, 0x65, 0xA5, 0x72, 0x34, 0x10, 0x9A, 0xC8, 0x9E, 0x1E, 0x63, 0xF2,
+    0x8A, 0x9E, 0x92, 0x4F, 0x89, 0x6C, 0x2A, 0xE6, 0xA0, 0xF8, 0x2A, 0xDA, 0xCA, 0x65, 0x05, 0x55,
+    0x21, 0x56, 0xC0, 0x03, 0x5F, 0x95, 0x9E, 0x8A, 0xB2, 0x92, 0x54, 0xB1, 0x5E, 0x10, 0xD2, 0xF2,
+    0x52, 0x09, 0xB4, 0x4D, 0x5E, 0x13, 0x22, 0x04, 0xF7, 0x1D, 0x00, 0x29, 0x46, 0x16, 0x2B, 0xAD,
+    0x23, 0x46, 0xC0, 0x1B, 0xF5, 0xFB, 0x7D, 0x00, 0x25, 0x0B, 0xB9, 0x74, 0x33, 0xB0, 0x89, 0x34,
+    0x33, 0x79, 0x6D, 0x28, 0x40, 0xA3, 0x87, 0x5D, 0xDF, 0xB7, 0x40, 0x9C, 0x30, 0xA5, 0x04, 0x07,
+    0x44, 0x14, 0xD9, 0x91, 0xC0, 0x47, 0x33, 0xE3, 0x74, 0x7E, 0x4A, 0xC3, 0x18, 0xB2, 0x23, 0x88,
+    0x51, 0x7D, 0x93, 0xD6, 0x8E, 0xD5, 0x68, 0xEA, 0xAF, 0xD2, 0xE4, 0x7B, 0x34, 0x5B, 0x36, 0x6F,
+    0xCE, 0x90, 0x8E, 0xC8, 0x15, 0xFF, 0x35, 0xA5, 0xF3, 0x93, 0xAC, 0x1A, 0x69, 0x1E, 0x55, 0xB9,
+    0xAA, 0x36, 0x17, 0x55, 0xB9, 0x5D, 0xD4, 0xFA, 0x6E, 0x51, 0xAB, 0xFB, 0xC8, 0x0B, 0x52, 0x6A,
+    0x51, 0xAD, 0x2C, 0x6A, 0xBA, 0xAA, 0xE6, 0x44, 0x75, 0xAB, 0x5A, 0xAD, 0x6A, 0x11, 0x98, 0x1E,
+    0x5C, 0x74, 0x6B, 0x0E, 0x8B, 0x6A, 0x4E, 0xD5, 0xF5, 0x6E, 0x50, 0x3E, 0x44, 0xF5, 0xB8, 0xAA,
+    0x62, 0xCE, 0x44, 0x96, 0x48, 0x16, 0x55, 0x0F, 0x5B, 0xDF, 0x45, 0x75, 0xB9, 0x6C, 0xD8, 0xC3,
+    0xE8, 0xD0, 0x3F, 0x70, 0x04, 0x82, 0x7A, 0xAF, 0x83, 0xA0, 0x6A, 0xBF, 0x8C, 0x03, 0xE7, 0xD5,
+    0x04, 0x08, 0xFD, 0x9A, 0x8E, 0x5E, 0x45, 0x17, 0xD5, 0xB5, 0x8A, 0xCF, 0x57, 0xEE, 0xFA, 0x79,
+    0x58, 0xE6, 0xF1, 0x59, 0xBF, 0x10, 0xD9, 0xFE, 0xFC, 0xEB, 0xF1, 0xF2, 0xEB, 0x58, 0x7D, 0x6C,
+    0xBC, 0x5D, 0x5E, 0x6F, 0xDE, 0x46, 0x1C, 0xE0, 0xF6, 0x19, 0x0A, 0xFC, 0xA0, 0xF2, 0x97, 0xCE,
+    0xD8, 0x1F, 0xED, 0xF7, 0xE6, 0x95, 0x8D, 0xE0, 0x96, 0xB1, 0x56, 0xDF, 0xC4, 0x5E, 0x8D, 0xB1,
+    0x7D, 0xE1, 0x7D, 0x1D, 0xE8, 0x71, 0x72, 0xFD, 0xD5, 0x61, 0x09, 0xDB, 0x6C, 0x48, 0x3C, 0x0F,
+    0x9B, 0xCB, 0x90, 0xA7, 0x6B, 0xCD, 0xD5, 0x87, 0xE1, 0xB7, 0xEF, 0x4D, 0x3E, 0x6A, 0xF3, 0x31,
+    0x43, 0x09, 0x97, 0x01, 0x1C, 0x1B, 0x78, 0x27, 0x5A, 0xD1, 0x61, 0xCE, 0x90, 0x0D, 0x2E, 0xBC,
+    0x1C, 0x0B, 0xBE, 0x56, 0x05, 0x16, 0xF4, 0xAA, 0x94, 0x23, 0xA9, 0xEC, 0x64, 0xE2, 0xD5, 0xE0,
+    0x7E, 0x0B, 0xA7, 0xBA, 0x7E, 0x10, 0xCE, 0xBD, 0xFC, 0x14, 0x7E, 0xB9, 0xB0, 0xBC, 0x1C, 0xE1,
+    0xEB, 0x4E, 0xDE, 0xED, 0x49, 0x3F, 0xF9, 0x31, 0xF0, 0x1E, 0x26, 0x2D, 0x72, 0x2E, 0x3B, 0xF8,
+    0x6A, 0x04, 0x04, 0x2C, 0x79, 0x1F, 0xB6, 0xE0, 0xAD, 0x16, 0xEA, 0xB8, 0xDC, 0x98, 0x7A, 0xD2,
+    0x0F, 0x92, 0x0F, 0xCB, 0xF5, 0xE7, 0x2F, 0xBD, 0x55, 0x3D, 0x92, 0x95, 0x40, 0x10, 0xFE, 0x60,
+    0xCA, 0x25, 0x20, 0x20, 0x37, 0x21, 0xB5, 0x4C, 0x38, 0xC2, 0x90, 0x18, 0x6F, 0xE4, 0x39, 0x3C,
+    0x02, 0x1C, 0xC1, 0x1B, 0xF8, 0x02, 0x23, 0x13, 0x4F, 0xA0, 0x70, 0x04, 0x4C, 0x8C, 0x31, 0xD4,
+    0xC4, 0x29, 0xA5, 0x4A, 0xAC, 0xE2, 0xD1, 0x7E, 0xDD, 0xC3, 0x3C, 0xAD, 0xAD, 0x2D, 0x6B, 0xAD,
+    0x55, 0x27, 0x98, 0x7E, 0x2C, 0x43, 0x4F, 0x7F, 0x3F, 0xDD, 0x0B, 0x1C, 0xAB, 0x1E, 0xB9, 0x55,
+    0x93, 0x6E, 0x33, 0xB7, 0x32, 0x70, 0x2B, 0x16, 0x6E, 0x6E, 0xC3, 0x6F, 0x56, 0xF5, 0x5E, 0x5A,
+    0x14, 0x22, 0x2B, 0x9C, 0x88, 0x00, 0xDC, 0x66, 0x0C, 0x4B, 0xB1, 0xC2, 0x07, 0xEC, 0xA8, 0x02,
+    0xBA, 0xBE, 0x5C, 0xD1, 0x4C, 0xEE, 0x8C, 0x6A, 0x81, 0xB4, 0xC5, 0x86, 0x61, 0xCC, 0x45, 0x5F,
+    0xCB, 0x58, 0xAF, 0xE8, 0xE6, 0x72, 0x87, 0x5F, 0x9C, 0xB4, 0xD5, 0x96, 0xC9, 0x58, 0x0A, 0x86,
+    0xE0, 0x64, 0x8C, 0xD9, 0xF9, 0x11, 0x5E, 0x9D, 0x50, 0xB2, 0x04, 0x09, 0xA8, 0x36, 0x64, 0x1A,
+    0x16, 0xE4, 0xB2, 0xA0, 0x09, 0xBC, 0xD2, 0xAE, 0x29, 0x64, 0x83, 0x9F, 0x51, 0x8A, 0xA6, 0x46,
+    0xC5, 0xC0, 0xEF, 0x6B, 0x39, 0x67, 0xD2, 0xC3, 0xCB, 0xCE, 0xCB, 0xE0, 0xBF, 0x89, 0x63, 0xE8,
+    0xBE, 0x4A, 0xB1, 0x33, 0xD7, 0x17, 0x29, 0xCF, 0x16, 0xAE, 0x37, 0xE6, 0xFA, 0x20, 0x2F, 0xB4,
+    0xFC, 0x49, 0x3E, 0x2F, 0x0C, 0xA3, 0xF0, 0x8E, 0x52, 0xC3, 0xCC, 0x5C, 0xBD, 0xC8, 0xC4, 0x5C,
+    0xED, 0xC0, 0x94, 0x8D, 0xA0, 0xB3, 0x94, 0x0C, 0x2D, 0xBA, 0x5D, 0x7F, 0x61, 0x88, 0x21, 0xAD,
+    0x9C, 0xE5, 0x2A, 0x73, 0xA2, 0x4C, 0x6A, 0x1A, 0x23, 0x89, 0xC7, 0x2D, 0xD8, 0x91, 0x26, 0x12,
+    0xEA, 0x57, 0x0B, 0xA2, 0x44, 0x13, 0xD7, 0x6C, 0x78, 0xE3, 0xF9, 0xEC, 0xE9, 0x4D, 0x86, 0x6B,
+    0xAD, 0xC6, 0x6B, 0x65, 0x5E, 0xB9, 0x36, 0x82, 0x65, 0x74, 0xDC, 0x50, 0xAC, 0xF9, 0x8E, 0x72,
+    0x31, 0x7E, 0xB9, 0xD5, 0x81, 0x6C, 0x35, 0x81, 0x5C, 0xF9, 0x60, 0xF4, 0x36, 0x3C, 0x34, 0x79,
+    0x52, 0x3F, 0x76, 0x21, 0x97, 0xF1, 0x17, 0x76, 0x3D, 0xA9, 0x40, 0x47, 0x22, 0x30, 0x68, 0x49,
+    0xB2, 0x1C, 0xE5, 0xE4, 0x7A, 0xA0, 0x20, 0xD2, 0x58, 0x71, 0xA3, 0xC7, 0xFC, 0x6D, 0x2E, 0x18,
+    0xFA, 0xD2, 0x1C, 0xB2, 0x17, 0x5B, 0xC4, 0xB7, 0xDB, 0x9F, 0x95, 0x24, 0xA5, 0x22, 0x72, 0xA0,
+    0x7A, 0xD9, 0x7A, 0x83, 0x3F, 0x59, 0x7E, 0xBA, 0x48, 0xAF, 0x55, 0xB0, 0xA4, 0x43, 0x7B, 0xCA,
+    0xD0, 0xAA, 0xA4, 0x87, 0xF8, 0xBC, 0x6D, 0x74, 0x3B, 0x92, 0xFA, 0x34, 0xE0, 0x48, 0xEC, 0x49,
+    0x7E, 0x9A, 0x72, 0xA6, 0x51, 0x92, 0xFE, 0x85, 0xF8, 0xD0, 0xCD, 0x17, 0x03, 0x54, 0xD2, 0x2C,
+    0x4C, 0x7C, 0x38, 0x00, 0xFE, 0x5C, 0xED, 0xE4, 0xFA, 0xB0, 0x00, 0x49, 0x31, 0x40, 0x87, 0x07,
+    0x32, 0x59, 0xF4, 0x8A, 0x64, 0x02, 0x27, 0xA1, 0x50, 0xC2, 0x0E, 0x17, 0x94, 0x32, 0xBB, 0xA8,
+    0xE4, 0xD5, 0x09, 0x8F, 0x09, 0xDF, 0x8F, 0x75, 0x50, 0x59, 0xAF, 0x57, 0xB3, 0xC1, 0xD9, 0x20,
+    0x45, 0xFD, 0x23, 0xFD, 0xD6, 0x60, 0xC0, 0xA3, 0xBB, 0x33, 0x62, 0x46, 0x60, 0x4A, 0x63, 0xD9,
+    0xBC, 0x60, 0x3D, 0xC7, 0xCB, 0xCC, 0x0E, 0xDA, 0x1E, 0x9E, 0x0F, 0xEA, 0x08, 0x96, 0xC9, 0x2E,
+    0x6C, 0x11, 0x9B, 0x8E, 0x5C, 0x66, 0x5A, 0xA3, 0xFA, 0x42, 0xAF, 0x57, 0x26, 0xCC, 0x1A, 0x44,
+    0xDE, 0x57, 0x2C, 0xCD, 0xDC, 0x41, 0x72, 0xCC, 0x9A, 0xC9, 0x20, 0x0F, 0x4F, 0xC7, 0xBD, 0x6E,
+    0x4F, 0x15, 0x24, 0xE3, 0xA0, 0x39, 0x24, 0xD5, 0x6F, 0xD2, 0xBB, 0x29, 0x09, 0xB7, 0x1E, 0x3F,
+    0x1E, 0xB4, 0xB8, 0xCF, 0x8A, 0x70, 0x71, 0x41, 0x7C, 0x01, 0x8D, 0x0B, 0x6E, 0x24, 0xE8, 0xB8,
+    0xA0, 0x47, 0x22, 0x00, 0x89, 0x83, 0x38, 0x46, 0x0E, 0x13, 0x46, 0x26, 0x70, 0x21, 0x03, 0x89,
+    0x0F, 0x24, 0x4A, 0xCC, 0xB8, 0xC6, 0x0A, 0x12, 0x31, 0x11, 0xE7, 0xD1, 0xB6, 0x3F, 0xFB, 0xE7,
+    0xBF, 0x0E, 0xA7, 0x77, 0xF7, 0x1C, 0x4E, 0x3E, 0x02, 0xB2, 0x46, 0xC7, 0x20, 0x46, 0x50, 0x64,
+    0xD3, 0x89, 0x49, 0x97, 0x0F, 0x1F, 0x6F, 0x55, 0xE0, 0xAF, 0x4F, 0x1E, 0xA7, 0xCA, 0x95, 0xD6,
+    0x67, 0xD6, 0x91, 0xD6, 0x62, 0x2C, 0xEB, 0xEA, 0xED, 0xF3, 0x9B, 0x05, 0xE4, 0xAF, 0x4D, 0xF9,
+    0x3C, 0xAA, 0x4D, 0x1F, 0x58, 0xC1, 0x22, 0x9F, 0x5E, 0xDE, 0xD1, 0x43, 0xD9, 0xB0, 0xC6, 0x31,
+    0x6C, 0x1F, 0xD6, 0xF6, 0x1F, 0x8A, 0x4C, 0xD9, 0x63, 0x23, 0xFD, 0xB3, 0xDD, 0xA6, 0x9B, 0xCE,
+    0xBB, 0x7A, 0x37, 0xB5, 0x2B, 0x9D, 0x24, 0x67, 0x7E, 0x60, 0x2E, 0x70, 0xEA, 0xC0, 0x6E, 0xB6,
+    0x79, 0x68, 0x60, 0xEC, 0xA5, 0xB7, 0xC6, 0x6B, 0xEB, 0xD5, 0xCC, 0xA3, 0x5A, 0xA1, 0x0B, 0xE6,
+    0x21, 0x3D, 0xC3, 0xA3, 0x34, 0x4F, 0x17, 0x6C, 0x6C, 0xD5, 0xDA, 0x69, 0xD2, 0x17, 0xF2, 0xFD,
+    0x09, 0x35, 0x52, 0x00, 0xCA, 0x66, 0x27, 0x56, 0x41, 0xA5, 0x61, 0x35, 0x74, 0xAA, 0x87, 0x8F,
+    0x41, 0x1F, 0xD5, 0xAB, 0x57, 0xB2, 0xF7, 0xF8, 0xF7, 0xEB, 0x07, 0xBD, 0x55, 0x31, 0x6E, 0xD4,
+    0x50, 0x10, 0x1D, 0xDB, 0x62, 0x2D, 0xE1, 0xE2, 0x37, 0x09, 0x05, 0x29, 0x7C, 0x04, 0x1F, 0xE1,
+    0x5B, 0x42, 0xE9, 0x53, 0x60, 0x71, 0x87, 0x08, 0x29, 0x47, 0xB0, 0xC5, 0x09, 0xD2, 0x70, 0x03,
+    0x2A, 0x9A, 0xDC, 0x00, 0xFB, 0x08, 0xDB, 0xD0, 0xFF, 0x02, 0x28, 0xA8, 0xB6, 0x58, 0x24, 0x67,
+    0xF1, 0x7A, 0x78, 0x6F, 0xBE, 0x9D, 0x20, 0xC8, 0x52, 0x62, 0xED, 0xFA, 0x8F, 0xED, 0xEF, 0x99,
+    0x37, 0xF3, 0xDE, 0x8C, 0x45, 0x44, 0x92, 0x5A, 0x9E, 0xF7, 0x3A, 0x49, 0xA2, 0xAA, 0x83, 0x78,
+    0x85, 0xE9, 0xF4, 0xF0, 0xB1, 0x96, 0x7F, 0x1D, 0x37, 0x7B, 0x9C, 0x5A, 0xDD, 0x89, 0x54, 0x7C,
+    0xAB, 0xD0, 0xBB, 0x19, 0x0E, 0x86, 0x6A, 0x27, 0x7E, 0x97, 0xA8, 0xE4, 0xF0, 0xB1, 0x13, 0xED,
+    0x60, 0x62, 0x2D, 0x79, 0x2B, 0x9D, 0xA5, 0x0A, 0xE2, 0xB7, 0xD9, 0x2C, 0xC5, 0x84, 0x5D, 0xA9,
+    0x76, 0x19, 0x22, 0xEE, 0xE8, 0x60, 0x5E, 0x82, 0x3B, 0x5E, 0x03, 0xC2, 0x48, 0xE7, 0x63, 0x8C,
+    0x04, 0x78, 0xAF, 0xB1, 0xA4, 0x47, 0xE9, 0x09, 0xC9, 0xF6, 0x59, 0xD4, 0x2D, 0x96, 0x2C, 0x2E,
+    0xB8, 0xEC, 0x6C, 0xF3, 0xD9, 0x69, 0xC4, 0x49, 0x6F, 0x0E, 0x0B, 0x0B, 0x21, 0x25, 0xFC, 0x44,
+    0x37, 0x31, 0x87, 0xEE, 0x66, 0xC6, 0x32, 0x4B, 0x0A, 0xEF, 0x25, 0x4C, 0xBF, 0x17, 0x87, 0xA5,
+    0x38, 0xE2, 0x05, 0x04, 0x27, 0x56, 0x44, 0x6F, 0x03, 0x9F, 0x4B, 0x35, 0x0A, 0xC3, 0xE2, 0xA1,
+    0xDF, 0x11, 0x43, 0x5D, 0xD2, 0xB5, 0x0E, 0xB8, 0x81, 0x3D, 0xBB, 0xCC, 0x3C, 0x63, 0x0F, 0xB6,
+    0xBA, 0x23, 0x6E, 0x60, 0x51, 0x44, 0x64, 0xD4, 0x2E, 0xD7, 0xFB, 0xCB, 0x5E, 0x07, 0xE6, 0xAB,
+    0x1A, 0x50, 0x42, 0x43, 0xE0, 0xB8, 0x8C, 0x88, 0x63, 0x0B, 0x49, 0xE0, 0xC2, 0x4B, 0xD6, 0x79,
+    0xA3, 0x73, 0xF7, 0x7B, 0x2A, 0xE7, 0x2C, 0x4A, 0xBE, 0x47, 0x45, 0xA5, 0x67, 0x39, 0xF2, 0xE5,
+    0x25, 0x5C, 0x4B, 0x3F, 0xD7, 0xA7, 0xEA, 0xF0, 0xFF, 0x38, 0x5B, 0x0F, 0xB8, 0xC6, 0x7B, 0x00,
+    0x35, 0xD0, 0x44, 0x3E, 0xB5, 0x15, 0x0E, 0x95, 0xCD, 0x48, 0x98, 0x1F, 0xAD, 0xC8, 0xA7, 0x8F,
+    0x8B, 0x48, 0x6B, 0x4A, 0x4D, 0x3E, 0x92, 0xC6, 0xA4, 0x59, 0xDB, 0x54, 0xC7, 0x0D, 0x4A, 0x88,
+    0x44, 0x3A, 0xE9, 0xE1, 0x7E, 0xE1, 0x8D, 0x6E, 0xA5, 0xC2, 0xCA, 0x7B, 0xA0, 0xC1, 0x42, 0x96,
+    0xA3, 0xAC, 0xD4, 0x19, 0x93, 0x78, 0x6E, 0x34, 0x61, 0x7F, 0x4E, 0x08, 0x20, 0x72, 0x61, 0x4F,
+    0x9C, 0x21, 0x0E, 0x71, 0xC5, 0xBB, 0xE5, 0x44, 0x8E, 0x87, 0x95, 0x40, 0xFC, 0xBF, 0xBE, 0x50,
+    0x8D, 0x68, 0x58, 0x72, 0x5B, 0x27, 0x59, 0x39, 0xA4, 0xC2, 0xC8, 0x2C, 0xB5, 0xA9, 0x86, 0x1F,
+    0x70, 0xE9, 0xFA, 0x2F, 0x1A, 0x97, 0xA3, 0x04, 0x84, 0x23, 0x7F, 0x89, 0xD6, 0x29, 0x53, 0x09,
+    0x44, 0x5E, 0x4D, 0xFC, 0x15, 0xFA, 0x74, 0x61, 0x36, 0xCC, 0x81, 0xBC, 0x3F, 0x56, 0xA7, 0x3F,
+    0x30, 0x68, 0x39, 0xA5, 0xCA, 0xD0, 0xE0, 0x0F, 0xC9, 0x0C, 0x82, 0x0B, 0x37, 0xDA, 0x85, 0xC2,
+    0xBF, 0xD0, 0x02, 0xA3, 0xE0, 0x35, 0x03, 0x24, 0x1F, 0xC8, 0x0C, 0x36, 0x57, 0x8B, 0xE6, 0xA2,
+    0xE4, 0x82, 0xE5, 0x34, 0xC5, 0x66, 0x8B, 0x4D, 0xD6, 0x59, 0xB4, 0x05, 0xFD, 0x85, 0xA5, 0x71,
+    0x66, 0x9B, 0x7F, 0xC6, 0x9C, 0xAD, 0x06, 0x26, 0x84, 0x3E, 0x5A, 0x5B, 0xB2, 0x93, 0xC7, 0x0A,
+    0x18, 0x3F, 0x7B, 0x4B, 0x75, 0x61, 0x28, 0x72, 0x14, 0x2D, 0xB2, 0x14, 0x75, 0x43, 0x9E, 0xAC,
+    0x49, 0x13, 0x32, 0x65, 0x82, 0x32, 0xAE, 0xCC, 0x09, 0xD9, 0xA2, 0xE0, 0x6A, 0xE3, 0x2B, 0x35,
+    0x64, 0x64, 0x2C, 0x33, 0xCB, 0x99, 0x75, 0xC0, 0xA0, 0x20, 0x6B, 0x85, 0x0D, 0x85, 0xF2, 0x48,
+    0x4E, 0x06, 0xD3, 0x0D, 0xAD, 0xCE, 0xAC, 0xC3, 0xB5, 0x5A, 0xED, 0x22, 0xE2, 0xA6, 0xA9, 0x57,
+    0xEC, 0x51, 0xCA, 0x8B, 0x55, 0x3C, 0x58, 0xD9, 0x83, 0xB5, 0xA6, 0x36, 0xB0, 0xFC, 0xAB, 0xF5,
+    0x67, 0x7B, 0xD1, 0xF1, 0x94, 0xF4, 0xB7, 0xC6, 0x0A, 0x7B, 0xAD, 0x9A, 0x7B, 0xD4, 0x08, 0xCD,
+    0xD4, 0x55, 0x1A, 0xCA, 0x2D, 0xC8, 0x68, 0x8F, 0x52, 0x76, 0xA8, 0xBB, 0x7E, 0xBB, 0x9B, 0xD1,
+    0x58, 0x2C, 0xD2, 0x08, 0x5A, 0x08, 0x23, 0x90, 0x31, 0x1C, 0xEF, 0xD8, 0x20, 0xDF, 0xDF, 0xD7,
+    0xD8, 0x6D, 0x45, 0x62, 0xE7, 0x85, 0xC8, 0x87, 0x7E, 0x91, 0xB7, 0xE9, 0x52, 0xED, 0x7C, 0x81,
+    0x11, 0x71, 0xCF, 0xC0, 0x3F, 0x3B, 0x4E, 0x0C, 0x30, 0xB5, 0xC1, 0x3E, 0x3B, 0x3C, 0x4F, 0x99,
+    0x41, 0xAB, 0x88, 0x37, 0xB1, 0x4E, 0x72, 0xC1, 0x0A, 0xFE, 0x94, 0xB4, 0x90, 0xF0, 0xAD, 0x89,
+    0x39, 0x70, 0x58, 0xE0, 0x9C, 0x1D, 0x1B, 0xC0, 0xC2, 0x48, 0xC0, 0xFC, 0x6D, 0x3B, 0xCC, 0x61,
+    0x48, 0x07, 0x57, 0xF8, 0xF9, 0x01, 0x12, 0x8B, 0x5A, 0x42, 0x3F, 0x39, 0xAB, 0x48, 0x4B, 0xE5,
+    0x64, 0x46, 0x99, 0x33, 0x11, 0xB5, 0x14, 0x48, 0xA6, 0x7B, 0x74, 0x18, 0x9A, 0xBD, 0xDF, 0x4A,
+    0xBB, 0xC7, 0x1C, 0x40, 0x43, 0x39, 0x02, 0xA6, 0x10, 0x5A, 0x68, 0x36, 0x64, 0x1A, 0x1C, 0x33,
+    0xA9, 0xBD, 0xE2, 0x46, 0x82, 0x22, 0x36, 0x57, 0xCF, 0x9A, 0xAB, 0x15, 0xD5, 0x27, 0xF6, 0x26,
+    0xD3, 0x01, 0x77, 0xBE, 0x8B, 0xB9, 0x94, 0x21, 0x3E, 0x73, 0x3F, 0x7A, 0x46, 0xE4, 0x4C, 0x05,
+    0x48, 0xC4, 0xF4, 0xF3, 0xA5, 0xE9, 0x20, 0xA7, 0x2A, 0xD8, 0xDD, 0x36, 0xBB, 0x07, 0xEB, 0x72,
+    0xB6, 0x83, 0x14, 0x73, 0x94, 0x56, 0x42, 0xA1, 0x50, 0xB5, 0x2D, 0x76, 0xBF, 0xEC, 0x97, 0x0F,
+    0x45, 0x13, 0xF5, 0xC1, 0x73, 0x3F, 0x59, 0x45, 0x28, 0x27, 0xA7, 0xAB, 0x5A, 0xE3, 0xF0, 0x12,
+    0x3F, 0x59, 0xF3, 0x85, 0x87, 0x67, 0xD7, 0x1F, 0x4E, 0x4F, 0x32, 0xAF, 0xF7, 0xC6, 0xDF, 0x6C,
+    0x5D, 0xCB, 0x36, 0xF8, 0xFC, 0x66, 0x22, 0x03, 0x05, 0xE8, 0x1A, 0xA5, 0xDA, 0x62, 0xCA, 0x92,
+    0x0F, 0x95, 0x6C, 0xE2, 0x24, 0xB6, 0xB1, 0x6B, 0xF3, 0x92, 0x45, 0xCC, 0xD7, 0x4F, 0xF3, 0xB8,
+    0x7C, 0x00, 0x73, 0x2B, 0xB0, 0xD7, 0x57, 0x7C, 0x25, 0xA0, 0x0F, 0x72, 0xAD, 0x41, 0x01, 0x20,
+    0x01, 0x8F, 0xE2, 0x0B, 0x84, 0xEF, 0xCC, 0x80, 0xCF, 0x99, 0x9F, 0x05, 0xAF, 0xEB, 0x3E, 0xA3,
+    0x58, 0x86, 0x52, 0x87, 0xF3, 0x46, 0x9A, 0xE6, 0x11, 0xD6, 0x2F, 0xD5, 0x55, 0x31, 0x72, 0xD4,
+    0x40, 0x10, 0x1C, 0x49, 0x55, 0x56, 0x70, 0x81, 0x9C, 0x90, 0x38, 0xD1, 0x13, 0xF4, 0x02, 0x6A,
+    0x55, 0xE5, 0x0F, 0x10, 0xD8, 0x45, 0xC0, 0x07, 0xA8, 0x22, 0xF0, 0x0B, 0x40, 0xE2, 0x07, 0x47,
+    0x44, 0x4A, 0x40, 0xE6, 0xE0, 0x12, 0x42, 0x8C, 0xEE, 0x09, 0x4A, 0x88, 0x48, 0x14, 0x38, 0xC1,
+    0xD1, 0x05, 0x17, 0xC8, 0xF6, 0x49, 0xC3, 0x74, 0x8F, 0x74, 0x67, 0x83, 0x0B, 0x62, 0x36, 0x58,
+    0xDD, 0xEE, 0xCE, 0xF4, 0xF4, 0xF4, 0xCC, 0xEE, 0x89, 0x14, 0x2A, 0x92, 0x69, 0x2D, 0x89, 0xAE,
+    0x25, 0xD2, 0x4E, 0x44, 0x37, 0x22, 0xD5, 0x56, 0x24, 0xEC, 0x44, 0x8A, 0x41, 0x24, 0xA7, 0x41,
+    0x29, 0x8F, 0x46, 0x32, 0x5C, 0xAC, 0x45, 0xCD, 0xB4, 0xD2, 0x9D, 0x41, 0xA8, 0x59, 0x7C, 0x28,
+    0x13, 0xB3, 0x8C, 0x60, 0x69, 0x70, 0x12, 0x5A, 0x73, 0x35, 0xA8, 0xCC, 0x60, 0x92, 0x51, 0x24,
+    0xC6, 0xA6, 0xB6, 0x07, 0x6C, 0xE0, 0x1E, 0xAD, 0xD6, 0x0F, 0x40, 0xAB, 0x3A, 0xED, 0xCD, 0x70,
+    0x4C, 0x2D, 0xAA, 0x64, 0xA3, 0x62, 0x2F, 0xC0, 0xCD, 0x89, 0xD9, 0xDE, 0x96, 0x76, 0xEF, 0xE4,
+    0xAF, 0x43, 0xF5, 0x1A, 0xB6, 0x0A, 0x9F, 0x48, 0x95, 0x64, 0xBE, 0xBF, 0x04, 0x0D, 0xA3, 0x0A,
+    0x02, 0x75, 0x3C, 0x10, 0x2B, 0x58, 0x70, 0xC5, 0x2E, 0x88, 0x36, 0x26, 0xC1, 0x20, 0x05, 0xC8,
+    0x99, 0x8F, 0x48, 0x6A, 0x33, 0xCE, 0x09, 0x63, 0x60, 0x3B, 0x07, 0xEB, 0x70, 0x7E, 0x6A, 0xE7,
+    0x89, 0xD6, 0x30, 0xAE, 0xB6, 0xB1, 0x65, 0x9C, 0xA9, 0x84, 0x1E, 0xD2, 0xD9, 0x2E, 0x12, 0x6B,
+    0x7A, 0x3B, 0xEF, 0x32, 0x03, 0x08, 0x83, 0x98, 0x6B, 0xAA, 0xEB, 0xDC, 0x16, 0xE7, 0x67, 0xD1,
+    0xF9, 0x99, 0x71, 0x2B, 0xEA, 0xE8, 0x4A, 0xD2, 0x1D, 0x68, 0x34, 0x3F, 0xC0, 0x05, 0xE8, 0xA2,
+    0x86, 0x20, 0x39, 0x52, 0x4C, 0xF0, 0x4B, 0xCE, 0x7E, 0x4B, 0xEB, 0xD5, 0x06, 0xB1, 0xA9, 0x9C,
+    0xC5, 0x5F, 0x80, 0x5E, 0xA2, 0xD7, 0x2F, 0xEC, 0x04, 0x22, 0x56, 0x2D, 0xD4, 0xEA, 0x66, 0x95,
+    0x52, 0x20, 0x26, 0x94, 0x90, 0x0A, 0x36, 0x38, 0x09, 0x38, 0xC9, 0xA9, 0x2E, 0x4E, 0x52, 0x38,
+    0x46, 0x97, 0x9B, 0xC7, 0x71, 0xBE, 0x79, 0x2D, 0x38, 0x07, 0x96, 0x3D, 0xB0, 0x48, 0x05, 0xE7,
+    0xBC, 0x7B, 0x5A, 0xF4, 0x58, 0x75, 0x49, 0x52, 0x3B, 0xAA, 0xC5, 0xA4, 0x74, 0xC4, 0xDC, 0x9E,
+    0x20, 0x52, 0x49, 0x1B, 0xC2, 0x91, 0xAE, 0x54, 0x0C, 0x9B, 0x73, 0x2B, 0xA1, 0xB3, 0x78, 0xAD,
+    0xDC, 0x5B, 0x1A, 0x45, 0xB3, 0xC4, 0x04, 0xC4, 0xCA, 0xED, 0x18, 0xBD, 0xEA, 0xE5, 0xB9, 0x40,
+    0xD9, 0x70, 0x6B, 0xFD, 0xC7, 0x7A, 0x69, 0xC9, 0xB9, 0xF6, 0xDF, 0xE6, 0x85, 0xD8, 0x47, 0x8D,
+    0x7E, 0xF6, 0x6E, 0xDD, 0x4C, 0xB9, 0xC4, 0x00, 0xCB, 0x11, 0x7F, 0x84, 0x08, 0x8F, 0x32, 0xBF,
+    0x18, 0x97, 0x2E, 0x6A, 0x73, 0x33, 0xA0, 0x02, 0xC7, 0x6E, 0x48, 0x21, 0x40, 0x2F, 0x56, 0x76,
+    0xB1, 0x92, 0x8D, 0x4D, 0x0B, 0xB0, 0xCC, 0x7B, 0xF9, 0x22, 0x56, 0xE9, 0x71, 0xA5, 0xA0, 0xDF,
+    0x67, 0x20, 0x61, 0xF5, 0xD9, 0xCA, 0x91, 0xFE, 0x7C, 0x00, 0xCE, 0x24, 0x24, 0xED, 0x5D, 0x55,
+    0x7E, 0x12, 0xCF, 0xAC, 0xB8, 0x1F, 0xD8, 0xE0, 0xA7, 0xCE, 0x28, 0xC2, 0xE7, 0xD9, 0x1F, 0xC5,
+    0xDF, 0x8F, 0x85, 0x8E, 0x25, 0x69, 0x28, 0x2F, 0x87, 0x05, 0x82, 0x7A, 0xEC, 0x71, 0x2D, 0x5F,
+    0x03, 0xA8, 0x95, 0x99, 0x9C, 0xED, 0x31, 0xC3, 0xC8, 0x15, 0x4F, 0xFD, 0x28, 0x23, 0x02, 0x7C,
+    0xBB, 0x3D, 0x04, 0xAE, 0xF0, 0x96, 0xE8, 0x4A, 0x8F, 0x62, 0x36, 0xAD, 0x59, 0x24, 0xE3, 0x64,
+    0xA7, 0x66, 0x91, 0x8D, 0x25, 0xFA, 0x18, 0x22, 0x0F, 0x28, 0x14, 0x30, 0x7C, 0x81, 0x7A, 0xC1,
+    0xFA, 0x44, 0xC7, 0xE5, 0x81, 0x6D, 0x46, 0x18, 0x3C, 0x05, 0xC6, 0xB2, 0x25, 0x30, 0x2F, 0xE5,
+    0x0A, 0x0F, 0xC3, 0x16, 0xBD, 0xAE, 0xB3, 0x28, 0xF3, 0x70, 0xDD, 0x1A, 0x88, 0xB3, 0x18, 0x57,
+    0xE6, 0x13, 0xEA, 0xC8, 0x5C, 0xA8, 0x55, 0x4A, 0x72, 0xD9, 0xAD, 0xCC, 0x48, 0x36, 0x6F, 0x48,
+    0x9B, 0x07, 0x4D, 0xCB, 0x64, 0x6B, 0x59, 0x94, 0x99, 0x51, 0xD6, 0x1B, 0xDB, 0x66, 0x41, 0x58,
+    0x1A, 0x5E, 0xDF, 0xD2, 0xEB, 0xFC, 0xB4, 0xAA, 0x05, 0xB3, 0x77, 0x45, 0x02, 0x3C, 0x26, 0x4D,
+    0x79, 0x63, 0x26, 0x49, 0xFD, 0x4A, 0x4D, 0x8A, 0x56, 0xC3, 0x41, 0xD0, 0x84, 0x2D, 0x37, 0x79,
+    0xC7, 0x1E, 0x6A, 0x92, 0x33, 0xD6, 0xE1, 0xA0, 0x26, 0x9E, 0x32, 0x17, 0x53, 0xAF, 0x23, 0xCB,
+    0xD2, 0xE5, 0x53, 0x76, 0x6C, 0xC3, 0xDF, 0x39, 0xD9, 0xCA, 0x05, 0x95, 0x8C, 0xFC, 0xC9, 0xF3,
+    0x42, 0x54, 0x5C, 0x1C, 0xBF, 0x95, 0xF9, 0x06, 0x5B, 0x4D, 0xEB, 0xC3, 0xC5, 0xF2, 0x11, 0x35,
+    0x77, 0x25, 0x9F, 0xE4, 0x58, 0x2F, 0xAD, 0x62, 0x9D, 0x94, 0xEC, 0x61, 0x2A, 0x98, 0x8C, 0x64,
+    0xD5, 0x63, 0xDA, 0xC1, 0x0F, 0x9B, 0x78, 0xC6, 0xA4, 0xEA, 0xE2, 0xD6, 0x1E, 0xAF, 0x70, 0xD7,
+    0xEC, 0xF0, 0xF2, 0x75, 0x01, 0x7C, 0x72, 0xDC, 0xC1, 0x0C, 0x97, 0xE8, 0xEB, 0xDC, 0xBD, 0x78,
+    0xB9, 0xE5, 0xE3, 0x66, 0x8A, 0xCC, 0x95, 0x73, 0x3B, 0x68, 0xB9, 0x95, 0x06, 0x74, 0xF4, 0x3D,
+    0x19, 0x66, 0xF7, 0xA3, 0x2B, 0xE6, 0x1D, 0x59, 0xF8, 0x27, 0xF1, 0x0B, 0x21, 0x57, 0xF2, 0xCF,
+    0x51, 0xE8, 0xAD, 0xBF, 0x00, 0xD4, 0x5C, 0xF9, 0x2C, 0x4C, 0xCF, 0xB2, 0xE8, 0x10, 0x7D, 0xDA,
+    0xEB, 0xE2, 0x89, 0xF8, 0x3F, 0x0E, 0xA5, 0x71, 0x39, 0xD4, 0x77, 0x83, 0xC3, 0x64, 0xD4, 0x76,
+    0x8F, 0xB3, 0xF0, 0xC7, 0x06, 0x7A, 0xAD, 0xBD, 0x11, 0x26, 0xEB, 0x51, 0x66, 0x79, 0x93, 0x96,
+    0xBD, 0x9B, 0xE8, 0x32, 0xB5, 0x6A, 0xE2, 0xB2, 0x99, 0x0D, 0x3F, 0xFD, 0xBC, 0x82, 0x3B, 0xF9,
+    0xBC, 0xD1, 0xBB, 0x52, 0xFE, 0xA7, 0xF1, 0x0B, 0xD5, 0x54, 0xBB, 0x8E, 0xD4, 0x40, 0x10, 0xEC,
+    0xB5, 0x75, 0x67, 0x71, 0x1B, 0x38, 0x22, 0xF6, 0x0F, 0x20, 0xF9, 0x07, 0x90, 0x3C, 0x19, 0x3F,
+    0xC0, 0x8A, 0x80, 0x00, 0x62, 0x92, 0xFB, 0x82, 0xC3, 0xFB, 0x09, 0x9B, 0x90, 0x93, 0x20, 0xA1,
+    0xBD, 0xE0, 0x12, 0xC2, 0x13, 0x36, 0x22, 0x20, 0xC4, 0x9F, 0xE0, 0x88, 0x80, 0xC8, 0x81, 0x03,
+    0xDF, 0x69, 0xEC, 0xA6, 0xBA, 0xC6, 0xBB, 0x20, 0xDD, 0x43, 0xAC, 0x20, 0x80, 0x09, 0xDA, 0xBB,
+    0xF3, 0xA8, 0xAE, 0xAE, 0xAE, 0x19, 0x91, 0x30, 0xCA, 0x75, 0x32, 0x88, 0xE4, 0x6D, 0xD1, 0x88,
+    0xA4, 0x93, 0x3A, 0x91, 0x58, 0x3D, 0xE6, 0x17, 0xDA, 0xDA, 0xB2, 0xAE, 0x2D, 0xBE, 0x96, 0x5B,
+    0xC7, 0xE9, 0xB4, 0x11, 0x89, 0x54, 0x3B, 0x91, 0xE5, 0x74, 0x61, 0x00, 0xAD, 0x00, 0x20, 0xAB,
+    0x6D, 0x31, 0xC4, 0xF4, 0xCA, 0xE2, 0x52, 0x91, 0xC3, 0x76, 0xDA, 0x9F, 0x5C, 0xB9, 0x52, 0x35,
+    0x4C, 0x8F, 0x2C, 0x1F, 0x04, 0xB9, 0x62, 0x3D, 0xC7, 0x7C, 0xAA, 0x8A, 0x8C, 0x85, 0xEA, 0x04,
+    0x00, 0xD5, 0x1E, 0x3C, 0xAA, 0x6B, 0xB7, 0xCB, 0x87, 0x19, 0x55, 0x9F, 0x5B, 0x1C, 0x0A, 0x8B,
+    0x3D, 0x63, 0x57, 0x32, 0x02, 0x8C, 0x90, 0x1A, 0x62, 0xCD, 0x22, 0x6A, 0xE6, 0xB5, 0x22, 0x62,
+    0xAB, 0x4D, 0x12, 0x0D, 0x7C, 0xC8, 0x6D, 0x62, 0x1C, 0x09, 0xED, 0x49, 0x8D, 0xB1, 0x18, 0xC8,
+    0xAC, 0x27, 0xCB, 0x8E, 0x60, 0x21, 0xB6, 0x04, 0x6B, 0x09, 0xD6, 0x30, 0xB2, 0x92, 0x4B, 0x0B,
+    0x0B, 0x6E, 0x8F, 0xFD, 0x4F, 0xF8, 0x07, 0xA7, 0x84, 0x0F, 0x35, 0x33, 0x49, 0xD1, 0xCE, 0x85,
+    0xBC, 0x14, 0x39, 0x46, 0x92, 0x78, 0x34, 0x8A, 0x96, 0x05, 0x04, 0xD1, 0x80, 0x04, 0x75, 0xC5,
+    0xA8, 0x3D, 0x32, 0x15, 0xB6, 0xBA, 0xDD, 0x48, 0x55, 0x73, 0x41, 0x52, 0x10, 0x48, 0x80, 0x1D,
+    0x19, 0x8E, 0x9D, 0x28, 0xB1, 0x90, 0x5F, 0xBD, 0x05, 0xBC, 0x07, 0x0D, 0x05, 0x0C, 0xB8, 0x14,
+    0xE0, 0x99, 0x0B, 0xDB, 0x40, 0x0E, 0xD1, 0x8B, 0x1A, 0x0B, 0x5D, 0xA8, 0x62, 0x4E, 0xBE, 0x92,
+    0xC5, 0x53, 0x4B, 0x98, 0xD9, 0x54, 0x67, 0xCA, 0xA4, 0x3A, 0x52, 0x98, 0x8E, 0xD5, 0xB1, 0x22,
+    0x72, 0x0E, 0x75, 0xDD, 0x3E, 0xFE, 0xD1, 0x4E, 0xD8, 0x2F, 0x1E, 0xC9, 0x9A, 0x7D, 0x19, 0xA1,
+    0x25, 0x39, 0xF6, 0x3E, 0xB2, 0x89, 0xAC, 0x35, 0x1D, 0xD5, 0x41, 0x8E, 0x64, 0xBF, 0x62, 0x13,
+    0xC6, 0xD1, 0x6C, 0x07, 0x0B, 0x02, 0xA2, 0x52, 0xA0, 0x47, 0xE7, 0xD3, 0x16, 0xF3, 0x79, 0xB7,
+    0xDB, 0x31, 0x83, 0x65, 0x9C, 0xA8, 0x6E, 0x4C, 0x7C, 0x5B, 0x0B, 0x9B, 0x21, 0x6C, 0x0B, 0x88,
+    0x93, 0xAD, 0x92, 0xDB, 0x9F, 0x2B, 0x76, 0xF4, 0x5C, 0xDF, 0x04, 0x1C, 0x27, 0x86, 0x23, 0xF3,
+    0x3D, 0xF9, 0x3D, 0xC5, 0xBA, 0xBB, 0x14, 0x3B, 0xC4, 0x8B, 0x33, 0xF9, 0xD1, 0x48, 0x1C, 0x3D,
+    0x9B, 0x56, 0xEE, 0x7E, 0x2F, 0xFE, 0x32, 0x3E, 0x26, 0xA1, 0x9A, 0x27, 0x0D, 0x5B, 0xFF, 0xD5,
+    0xFE, 0x2D, 0xBF, 0xB0, 0xB8, 0xF4, 0x73, 0xF0, 0xC0, 0x27, 0x2F, 0x07, 0x8C, 0xC4, 0x72, 0x8C,
+    0xF0, 0xCF, 0x5A, 0x4A, 0x8F, 0xD4, 0x4E, 0x2A, 0xCF, 0xCB, 0x86, 0x47, 0x83, 0x9F, 0x4E, 0xB2,
+    0x89, 0xEE, 0x87, 0x30, 0xF6, 0x98, 0x15, 0x9E, 0xEE, 0x86, 0x40, 0x56, 0x3A, 0x14, 0x8A, 0x71,
+    0x14, 0x12, 0x25, 0x38, 0x8A, 0x65, 0x33, 0x22, 0x84, 0x49, 0x27, 0x0A, 0x0F, 0x2B, 0xDA, 0xE6,
+    0xCC, 0x73, 0x17, 0xCF, 0xB8, 0xF9, 0x8C, 0x41, 0x26, 0x7A, 0x7D, 0x81, 0x33, 0x89, 0xF5, 0xAE,
+    0x09, 0x9F, 0x3A, 0x7C, 0x9C, 0x29, 0x60, 0x5D, 0x31, 0xDD, 0x06, 0x7A, 0x40, 0x37, 0x37, 0xD9,
+    0x1F, 0xB7, 0x8F, 0xD1, 0xB7, 0xE1, 0x0C, 0x52, 0x7B, 0x5C, 0xB3, 0x33, 0x94, 0x20, 0xBE, 0x80,
+    0x62, 0x97, 0x69, 0x73, 0x67, 0xC9, 0x8B, 0x11, 0x76, 0x8B, 0x3C, 0x7C, 0x0B, 0xD7, 0xA5, 0x83,
+    0x85, 0x1E, 0x76, 0xCF, 0xBA, 0xA4, 0x87, 0x47, 0x97, 0x1D, 0xAE, 0x38, 0xDE, 0x89, 0xB2, 0x41,
+    0xA8, 0x6A, 0xBC, 0x01, 0x5A, 0x67, 0x2D, 0xFC, 0x83, 0x25, 0x75, 0x66, 0x18, 0x06, 0x1A, 0xC8,
+    0x4C, 0x3E, 0xA1, 0x64, 0xDC, 0xFC, 0xF9, 0x9D, 0xDF, 0x8D, 0x93, 0x8A, 0xAC, 0xF3, 0x3D, 0x79,
+    0x4F, 0x07, 0x7F, 0x7F, 0x2F, 0x07, 0x8F, 0xFF, 0xBB, 0x43, 0xF2, 0xF0, 0xD5, 0xDA, 0x64, 0xA2,
+    0xA5, 0x71, 0xB6, 0xB2, 0x9F, 0x27, 0xEF, 0x56, 0xEE, 0xBE, 0x92, 0xD9, 0x21, 0xC9, 0x41, 0xBE,
+    0x66, 0x8B, 0xA4, 0xC0, 0x9D, 0x71, 0xEC, 0x91, 0x94, 0x2E, 0x52, 0x61, 0x93, 0x70, 0x69, 0x92,
+    0x51, 0xD8, 0x25, 0x99, 0x24, 0xF5, 0xC2, 0x36, 0x61, 0xB5, 0xEA, 0x79, 0xB1, 0x5D, 0xC4, 0x27,
+    0x81, 0x8D, 0xB2, 0x2B, 0xD7, 0x86, 0x4E, 0x99, 0x5A, 0x7F, 0x6F, 0xFC, 0x00, 0xD5, 0x95, 0x3D,
+    0x8E, 0xD4, 0x40, 0x10, 0x85, 0xDF, 0xD8, 0x48, 0x2D, 0xE1, 0xA0, 0xB9, 0x81, 0x8F, 0xE0, 0x23,
+    0xD8, 0x47, 0x20, 0x20, 0xE3, 0x06, 0x24, 0x7B, 0x04, 0xCF, 0x0D, 0xD8, 0x9B, 0x70, 0x81, 0x95,
+    0x6C, 0x62, 0x12, 0xDF, 0x80, 0x91, 0x36, 0x20, 0xA4, 0x03, 0x4B, 0x78, 0x56, 0x6D, 0x17, 0xAF,
+    0xAA, 0xDD, 0x0B, 0x68, 0x34, 0xC0, 0x84, 0xEB, 0xA0, 0xCB, 0xEE, 0xDF, 0x57, 0xF5, 0x55, 0xB5,
+    0x01, 0x1C, 0xDE, 0xE2, 0x1D, 0x80, 0x6A, 0x2E, 0x56, 0x1A, 0x2F, 0x12, 0xF5, 0x4B, 0x64, 0xA6,
+    0x29, 0x45, 0x26, 0x1A, 0x0C, 0x9B, 0xB6, 0x38, 0x74, 0xF8, 0x9F, 0xC7, 0xC9, 0x88, 0x76, 0xE5,
+    0x1E, 0x47, 0xF4, 0x91, 0x3B, 0x76, 0x18, 0xD4, 0x00, 0xDC, 0xD3, 0x4C, 0x40, 0xBD, 0xE1, 0x40,
+    0xD3, 0x44, 0x9A, 0x13, 0xDA, 0x88, 0x42, 0xD7, 0x2C, 0x3C, 0x70, 0x44, 0x3F, 0xD3, 0x1C, 0x31,
+    0x04, 0x6E, 0xD4, 0x81, 0xC3, 0x95, 0xAE, 0x99, 0xE0, 0x75, 0xCD, 0x08, 0xBF, 0xDA, 0xE4, 0x3A,
+    0xDA, 0x2C, 0x5B, 0xD3, 0xED, 0x6B, 0x74, 0x4B, 0x27, 0x4F, 0x9F, 0xB8, 0xC6, 0x89, 0xA8, 0x76,
+    0x33, 0x63, 0x32, 0x9D, 0xBA, 0x23, 0xF4, 0xA4, 0xA0, 0x59, 0xA8, 0xB3, 0x17, 0xB9, 0xBF, 0x54,
+    0xFF, 0x01, 0xAF, 0xEF, 0x51, 0x9D, 0xDF, 0x33, 0x1A, 0xC3, 0xBE, 0x36, 0x00, 0x8D, 0x85, 0xE5,
+    0xEE, 0x7C, 0xC5, 0xE5, 0xC3, 0x8A, 0x32, 0xA2, 0xA1, 0xF8, 0x91, 0xD6, 0x2F, 0x68, 0x47, 0x48,
+    0x57, 0x2E, 0xA8, 0x03, 0xFA, 0xAE, 0x10, 0x54, 0x01, 0xED, 0x09, 0x02, 0xB7, 0xC2, 0x07, 0x0C,
+    0x23, 0x36, 0xF8, 0x88, 0xFA, 0x54, 0xC8, 0x91, 0xA3, 0xC3, 0xCC, 0x03, 0xA8, 0x50, 0x95, 0x31,
+    0x38, 0x6C, 0xE9, 0xB1, 0x98, 0xEB, 0x42, 0x1D, 0xF5, 0x96, 0x23, 0x7B, 0x32, 0xD3, 0x2C, 0x66,
+    0xFA, 0x07, 0x33, 0x0F, 0xD1, 0x8C, 0xA4, 0x4E, 0x86, 0xCD, 0xA6, 0x8C, 0xB8, 0xFD, 0x79, 0xD9,
+    0xE0, 0xF0, 0xCA, 0xC2, 0xD0, 0xC1, 0xC4, 0xC0, 0x7D, 0x63, 0x53, 0x7D, 0xD5, 0xC6, 0x3E, 0x45,
+    0x31, 0x2D, 0xD7, 0x9D, 0x37, 0x84, 0x45, 0x84, 0x8B, 0x46, 0x50, 0x9B, 0xD9, 0x00, 0x3A, 0xC2,
+    0x09, 0xC6, 0x8F, 0xE4, 0xFA, 0xC9, 0xF0, 0x79, 0xB2, 0x1C, 0x8D, 0x1E, 0x87, 0xA4, 0x33, 0x78,
+    0xDA, 0x24, 0x76, 0x5E, 0xD5, 0x1A, 0x3A, 0x0D, 0xD2, 0xEF, 0x4F, 0x13, 0x50, 0x29, 0xAE, 0x61,
+    0xD2, 0x57, 0x3A, 0xD4, 0xE9, 0xAB, 0x46, 0x48, 0x63, 0xA2, 0x41, 0xF1, 0xDB, 0xCD, 0xBC, 0x32,
+    0xB0, 0x4C, 0x2C, 0x23, 0xCB, 0xCC, 0x32, 0xB4, 0x4C, 0x2D, 0x63, 0xCB, 0xDC, 0x32, 0xB8, 0x4C,
+    0x2E, 0xA3, 0xDB, 0xD9, 0x65, 0x78, 0x99, 0x5E, 0xC6, 0x97, 0xF9, 0x65, 0x80, 0x99, 0x60, 0x46,
+    0x98, 0x19, 0x66, 0x88, 0x99, 0xE2, 0x33, 0xC6, 0x6B, 0x1C, 0x79, 0x20, 0xC7, 0x98, 0x4F, 0x13,
+    0xEA, 0x59, 0x93, 0xBD, 0xD2, 0x68, 0xEA, 0xF1, 0xAA, 0x80, 0x22, 0xDF, 0xEC, 0xAC, 0x2F, 0x9F,
+    0x7A, 0xD2, 0xCA, 0x33, 0x8A, 0xB0, 0x1A, 0x3C, 0xC2, 0x40, 0xF2, 0xE3, 0xA8, 0xBB, 0x1A, 0x4B,
+    0x3A, 0x8A, 0x92, 0x42, 0x0C, 0x27, 0xBD, 0x34, 0x24, 0x46, 0x14, 0x87, 0xCD, 0x8A, 0xCB, 0xA0,
+    0x9A, 0xCE, 0x19, 0x56, 0x99, 0xAA, 0xC9, 0xEE, 0x01, 0x9F, 0x5C, 0x18, 0xCC, 0xC1, 0x4C, 0xF7,
+    0xA5, 0xD5, 0x4D, 0xB9, 0x9A, 0x6C, 0xFF, 0xC7, 0x55, 0xD1, 0xA6, 0xC4, 0x6B, 0xD2, 0x58, 0x95,
+    0x8C, 0xFD, 0x1A, 0xFE, 0x51, 0x19, 0x33, 0x2B, 0xA3, 0xFA, 0x55, 0x19, 0xC1, 0x2A, 0xE3, 0x20,
+    0xC7, 0x3A, 0x50, 0x68, 0x73, 0xBE, 0xDB, 0x2B, 0xA3, 0x79, 0xAE, 0x0C, 0x9F, 0x2A, 0xE3, 0xBB,
+    0x9E, 0xDB, 0x6A, 0xA3, 0x27, 0x97, 0x2A, 0xD0, 0x3D, 0x75, 0x29, 0x9A, 0x29, 0x1F, 0x79, 0x75,
+    0x5E, 0x22, 0x8E, 0x19, 0x75, 0x52, 0xCF, 0x99, 0x53, 0x7A, 0xB1, 0x1C, 0x53, 0x0F, 0x7E, 0x24,
+    0x4F, 0x5C, 0x74, 0xFB, 0xCD, 0xC8, 0x9F, 0xDB, 0xDF, 0xCA, 0x28, 0x51, 0xF4, 0x5B, 0xBA, 0x66,
+    0x0B, 0xF9, 0x9C, 0x3A, 0xDA, 0x25, 0x75, 0x54, 0xB2, 0x73, 0x96, 0x53, 0xEA, 0x68, 0x62, 0x61,
+    0x1D, 0xD4, 0xC8, 0x68, 0x31, 0xB9, 0x86, 0x50, 0xC8, 0x44, 0x67, 0x09, 0x8C, 0x1D, 0xC3, 0x42,
+    0x5C, 0x54, 0x55, 0xCB, 0x48, 0x58, 0xED, 0xEA, 0x24, 0x12, 0x28, 0x3B, 0x08, 0xC6, 0xD8, 0xB7,
+    0xB2, 0x36, 0x0A, 0xF3, 0x8B, 0xC8, 0xA3, 0x12, 0xDD, 0x18, 0x19, 0xC2, 0x27, 0xAC, 0xD5, 0x70,
+    0xB5, 0x22, 0x1F, 0x15, 0x22, 0x3B, 0xC2, 0xA0, 0xE0, 0x7A, 0x59, 0x2B, 0xCD, 0x41, 0x52, 0x1D,
+    0x07, 0x3D, 0xBA, 0x97, 0xE0, 0xF4, 0x87, 0xE4, 0x18, 0xC8, 0x5E, 0x23, 0xD5, 0xCB, 0xE8, 0x34,
+    0x3D, 0x2B, 0x36, 0xED, 0x0D, 0x37, 0xC8, 0x4F, 0xDD, 0x55, 0xB1, 0x8E, 0xD4, 0x30, 0x10, 0x9D,
+    0xEC, 0x0A, 0x45, 0x22, 0x45, 0xAA, 0xA5, 0x80, 0xC2, 0x3D, 0x8D, 0x3F, 0xC1, 0x81, 0x86, 0x92,
+    0x66, 0xB7, 0xA6, 0xE7, 0x23, 0x70, 0x3A, 0x7E, 0xE3, 0xEA, 0x6D, 0xEE, 0x0F, 0x48, 0x10, 0x1F,
+    0x70, 0x91, 0xEE, 0x03, 0x88, 0x68, 0x29, 0x70, 0x91, 0x22, 0x82, 0x24, 0xC3, 0x9B, 0xB1, 0xB3,
+    0x77, 0x27, 0x6E, 0xD1, 0x55, 0x27, 0x81, 0xB5, 0x9A, 0x68, 0x1D, 0xFB, 0xCD, 0x9B, 0xF7, 0xC6,
+    0x0E, 0x51, 0x1C, 0x65, 0x2B, 0x31, 0x9F, 0x24, 0x6E, 0xB9, 0xD3, 0x38, 0x23, 0x6E, 0xD8, 0xF7,
+    0x44, 0x19, 0x67, 0x8C, 0x3F, 0x4C, 0xC5, 0x40, 0x67, 0x87, 0x6F, 0x65, 0xB9, 0x09, 0xB2, 0xFC,
+    0x8D, 0x00, 0xF1, 0x67, 0xAE, 0x76, 0xE4, 0x3B, 0xDF, 0xD9, 0xD6, 0xF5, 0x66, 0xB0, 0x83, 0x0D,
+    0xF9, 0x6C, 0x96, 0x72, 0xCC, 0xF8, 0x1D, 0x5F, 0x4D, 0xE4, 0x7F, 0xF0, 0xAF, 0x85, 0x0C, 0x63,
+    0x50, 0x2E, 0xB1, 0xCE, 0x24, 0xB6, 0xE4, 0x11, 0x7B, 0xBC, 0xF8, 0xCA, 0x01, 0x2F, 0xBE, 0xF1,
+    0x00, 0xC8, 0xE0, 0x81, 0xE9, 0x43, 0x09, 0x56, 0x4F, 0x2F, 0x36, 0x47, 0x4D, 0xF9, 0x41, 0xE9,
+    0x0A, 0x4F, 0x32, 0x1A, 0x79, 0x91, 0x5A, 0x58, 0xC8, 0x36, 0xC8, 0x4E, 0xF9, 0x48, 0x4D, 0x4D,
+    0x4F, 0x2A, 0xDA, 0xD1, 0x5F, 0x07, 0x72, 0x12, 0x5F, 0x63, 0x43, 0xB1, 0x14, 0x8B, 0xA4, 0x31,
+    0x13, 0x04, 0xC0, 0x93, 0xDC, 0x40, 0xDC, 0x6D, 0xB9, 0xC6, 0xCF, 0x4E, 0x54, 0x40, 0x88, 0x8E,
+    0xEC, 0x54, 0xCA, 0xA2, 0x01, 0xEC, 0x88, 0xBF, 0xB3, 0x68, 0x05, 0x8A, 0x78, 0xC9, 0x35, 0x91,
+    0x65, 0xA9, 0xDD, 0x0B, 0x22, 0xA9, 0x84, 0x5B, 0x94, 0x22, 0xA4, 0x54, 0xA3, 0x49, 0x35, 0x8D,
+    0x13, 0xD5, 0xCD, 0x44, 0xD0, 0x89, 0x5A, 0x26, 0xE6, 0x3B, 0xC4, 0x3E, 0x45, 0x7A, 0xD5, 0x69,
+    0x5B, 0xCE, 0xA3, 0x54, 0xFB, 0x53, 0xE0, 0x1C, 0xA4, 0x45, 0xA1, 0x55, 0x3E, 0xD2, 0x43, 0x86,
+    0x19, 0x44, 0xAB, 0x72, 0xA4, 0x62, 0xA4, 0x72, 0x22, 0x38, 0x55, 0xCC, 0xE4, 0x7A, 0xCA, 0x17,
+    0xF1, 0x0E, 0xE5, 0x22, 0xCD, 0x96, 0x5F, 0x2F, 0x92, 0xEA, 0xE3, 0x24, 0x36, 0x5E, 0x09, 0x30,
+    0x2B, 0x3B, 0xD6, 0xA6, 0x68, 0x22, 0x47, 0xAD, 0xC5, 0x2D, 0x1A, 0xB5, 0x65, 0x9C, 0xF6, 0x85,
+    0xEB, 0x57, 0x2D, 0xE9, 0x85, 0x2C, 0x34, 0x6A, 0x44, 0x14, 0xC4, 0x89, 0x42, 0x88, 0xF2, 0xD2,
+    0xDF, 0xE1, 0xEB, 0x7A, 0xEC, 0xCB, 0xF8, 0x15, 0xB2, 0x97, 0xB3, 0xD8, 0xEB, 0x03, 0x74, 0xDF,
+    0xF0, 0x17, 0xAC, 0x2D, 0x59, 0x74, 0xDB, 0xED, 0x77, 0x7B, 0x7A, 0xE0, 0xD8, 0xAA, 0x1D, 0x6F,
+    0x01, 0x63, 0x47, 0x3B, 0x02, 0xB7, 0x05, 0x58, 0x39, 0xE1, 0xA9, 0x3E, 0x56, 0x70, 0x0E, 0xBF,
+    0x26, 0xC0, 0xC4, 0x1C, 0x19, 0x9B, 0xE0, 0x64, 0xD1, 0x35, 0x8B, 0x00, 0x97, 0x93, 0x36, 0x4F,
+    0x27, 0x9C, 0x17, 0xAD, 0x56, 0x9B, 0x99, 0x15, 0x76, 0x38, 0x59, 0xA4, 0x25, 0x67, 0xAA, 0x4A,
+    0x11, 0x27, 0xE6, 0x5B, 0x13, 0xED, 0x2A, 0x4D, 0xC6, 0x7F, 0x1C, 0x16, 0xD3, 0x46, 0x8E, 0x21,
+    0xFE, 0x5D, 0xE2, 0xC3, 0xC6, 0xD9, 0x3C, 0x2D, 0xE7, 0x7B, 0xAA, 0xD2, 0xD3, 0x21, 0xFD, 0xAF,
+    0xA7, 0x44, 0xFA, 0x4D, 0x3B, 0xCE, 0xE9, 0xD1, 0x81, 0x56, 0xAC, 0x26, 0x3D, 0x3B, 0x5E, 0xAA,
+    0xD6, 0x89, 0xF3, 0x6A, 0x17, 0x96, 0xA9, 0x31, 0x46, 0x5B, 0x07, 0x58, 0x9A, 0x17, 0x9B, 0x2A,
+    0x3A, 0x19, 0x9B, 0xFC, 0xC1, 0x1A, 0xED, 0xBF, 0x82, 0x53, 0xCB, 0x69, 0x39, 0xA9, 0x05, 0x90,
+    0x7D, 0x3E, 0x1C, 0x28, 0x1E, 0xD8, 0x10, 0xB3, 0x72, 0x22, 0x11, 0x22, 0x27, 0x4E, 0x14, 0x83,
+    0x20, 0x30, 0xDF, 0x2E, 0xC5, 0x09, 0xA0, 0xAD, 0x57, 0x15, 0x4A, 0x3D, 0x03, 0x2A, 0xD9, 0xB9,
+    0x3B, 0x05, 0x10, 0x8B, 0xC2, 0xD6, 0xA4, 0xF7, 0xC1, 0xCB, 0x63, 0xEC, 0x44, 0xBD, 0x90, 0x7A,
+    0x61, 0xD7, 0x89, 0x31, 0xAD, 0x94, 0xA4, 0xA1, 0x96, 0x3D, 0x55, 0x3A, 0x5A, 0x86, 0x0F, 0x7B,
+    0x71, 0x93, 0x95, 0x4A, 0x27, 0x38, 0xE3, 0xE6, 0xC4, 0x69, 0xC3, 0x6B, 0xF3, 0xC5, 0x54, 0xC9,
+    0x8A, 0xA8, 0x05, 0xD9, 0x39, 0xF5, 0x52, 0x74, 0xE6, 0xBE, 0xEE, 0xFB, 0xB7, 0x1D, 0x51, 0xAC,
+    0x46, 0x5B, 0x55, 0x70, 0xEC, 0xB4, 0xDE, 0x50, 0x2A, 0x62, 0x76, 0xA8, 0x1E, 0xDD, 0x91, 0xE7,
+    0x35, 0xBD, 0x57, 0x9D, 0xF4, 0x3B, 0x82, 0x2F, 0x51, 0x74, 0xC6, 0xA6, 0x43, 0x14, 0x55, 0x04,
+    0x62, 0xB2, 0x2D, 0x1A, 0x93, 0x5D, 0x9C, 0xBF, 0x08, 0xFE, 0x83, 0x23, 0xF3, 0x08, 0xE3, 0x37,
+    0x8D, 0x55, 0xBF, 0x6F, 0xE4, 0x44, 0x14, 0x7E, 0xF6, 0x10, 0x2C, 0xC5, 0x12, 0xD3, 0x10, 0x09,
+    0xA5, 0x60, 0xFA, 0x08, 0xCE, 0x0D, 0x25, 0xC9, 0x18, 0xA5, 0xB8, 0xE2, 0x9A, 0x2D, 0xB2, 0x15,
+    0xED, 0x55, 0xD7, 0xA4, 0xA5, 0x38, 0xCE, 0xCE, 0xB5, 0x14, 0x6C, 0x43, 0x9F, 0x22, 0x48, 0xA7,
+    0x6D, 0xD2, 0x22, 0x94, 0x60, 0x5F, 0x22, 0xD1, 0xD0, 0x58, 0xC7, 0x3F, 0x30, 0x39, 0x21, 0x21,
+    0x1A, 0x98, 0x93, 0x7C, 0xC2, 0x70, 0x63, 0x3F, 0xBE, 0x37, 0xDE, 0xE3, 0xF7, 0xAF, 0xD9, 0xDD,
+    0xF1, 0xEA, 0xCD, 0xCC, 0x7B, 0xF3, 0xBE, 0xEF, 0x7B, 0xCF, 0x44, 0xDB, 0x2B, 0xDA, 0x2B, 0x29,
+    0x9D, 0xA8, 0xA9, 0x89, 0xEC, 0x0D, 0x97, 0x44, 0x8A, 0x99, 0x30, 0xAA, 0x49, 0xE6, 0x7C, 0x94,
+    0x99, 0xE2, 0x7F, 0xDA, 0xA3, 0xFF, 0x1E, 0x0D, 0xB3, 0x83, 0x27, 0xE6, 0x81, 0x48, 0x33, 0xE3,
+    0x60, 0xBA, 0x3E, 0x8F, 0x0E, 0x75, 0x74, 0x62, 0xE2, 0x5C, 0x44, 0xB7, 0x36, 0xC4, 0x40, 0xF3,
+    0x3C, 0xC4, 0xD3, 0xBD, 0xCC, 0x2C, 0x73, 0xC2, 0xCF, 0x97, 0xB8, 0x0D, 0x33, 0xFB, 0xE8, 0x75,
+    0x8C, 0x5E, 0xB9, 0xA6, 0x62, 0x36, 0xC1, 0xD5, 0x4F, 0x62, 0xEA, 0x60, 0xF0, 0x64, 0x38, 0x20,
+    0xDC, 0x7B, 0xB8, 0xBC, 0x9C, 0x14, 0x4F, 0x92, 0x4F, 0x87, 0x4D, 0xD8, 0x9A, 0xC3, 0xB7, 0x92,
+    0x88, 0xB2, 0x50, 0xB5, 0x08, 0x0F, 0xA3, 0x46, 0xD8, 0x4C, 0xAE, 0x27, 0x39, 0x33, 0x8C, 0x16,
+    0xC6, 0x42, 0x6E, 0x3D, 0xD2, 0xC6, 0x8D, 0x18, 0x1D, 0x55, 0x8E, 0x1A, 0x47, 0x1C, 0xBF, 0x71,
+    0x98, 0x5A, 0xB7, 0xDA, 0xE5, 0x3E, 0xEB, 0x15, 0xB6, 0x5B, 0x49, 0x4D, 0x82, 0xE0, 0x48, 0x86,
+    0x9B, 0x03, 0xBE, 0x5A, 0x4D, 0x79, 0x48, 0x47, 0xB2, 0xED, 0x11, 0xD1, 0x22, 0x75, 0xFB, 0x66,
+    0x38, 0xB0, 0xE3, 0xE5, 0x83, 0x2A, 0x5C, 0x16, 0xFD, 0x85, 0xDE, 0xB8, 0x79, 0x3D, 0x6D, 0x78,
+    0x12, 0x88, 0x24, 0x21, 0x3B, 0xAD, 0x3F, 0x25, 0xDA, 0x5A, 0xAE, 0x25, 0x61, 0xEE, 0x64, 0x1A,
+    0x64, 0xFA, 0x6E, 0xDE, 0xBB, 0x55, 0xD2, 0xA2, 0x29, 0x8B, 0xA7, 0xB0, 0x64, 0x58, 0xC1, 0xA9,
+    0x3A, 0x97, 0xEB, 0x2C, 0x10, 0x33, 0x68, 0x7C, 0x8A, 0x60, 0x87, 0x66, 0x58, 0x2E, 0xD4, 0x60,
+    0x5C, 0xF3, 0x70, 0xD2, 0xBD, 0x7D, 0xC2, 0x77, 0x46, 0xEB, 0xF9, 0x6A, 0xBD, 0xFB, 0xC8, 0xD4,
+    0x4D, 0xFD, 0x5A, 0xD2, 0x17, 0x75, 0x44, 0xB7, 0xCC, 0x07, 0xEC, 0xDE, 0xFF, 0xF0, 0xB2, 0x0A,
+    0xB6, 0xD7, 0x1D, 0xE9, 0x81, 0xD4, 0x24, 0xD9, 0x03, 0x11, 0xA4, 0x6C, 0xBD, 0xE2, 0x32, 0xE1,
+    0xCE, 0x8C, 0x48, 0xA7, 0x9C, 0xC3, 0xDB, 0x3A, 0x1D, 0x8D, 0x37, 0x3E, 0x1F, 0x91, 0x9B, 0x30,
+    0x11, 0x39, 0x69, 0xE7, 0xE4, 0x5F, 0xA1, 0xCD, 0x61, 0x7C, 0x81, 0x5B, 0xC6, 0x82, 0x9C, 0x80,
+    0x57, 0x79, 0x6A, 0x3C, 0x15, 0x61, 0xE3, 0x43, 0x96, 0x5A, 0xE1, 0x16, 0x12, 0x50, 0x12, 0x68,
+    0x00, 0x66, 0xA5, 0xB8, 0x2A, 0x66, 0x43, 0x33, 0x12, 0x58, 0xC4, 0x06, 0xF6, 0x29, 0x77, 0x8A,
+    0x6B, 0xCD, 0xB2, 0x17, 0x2A, 0x81, 0x2C, 0x70, 0x3C, 0xFF, 0xC3, 0x71, 0x08, 0x06, 0xEB, 0xF1,
+    0xF8, 0x18, 0x0D, 0x44, 0x21, 0x09, 0xD5, 0xD0, 0xF4, 0xEC, 0x33, 0x3F, 0x83, 0xAC, 0x5B, 0xD5,
+    0xE3, 0xB0, 0x99, 0xB0, 0x3E, 0x91, 0x91, 0x3D, 0x76, 0x7D, 0x04, 0x04, 0x03, 0x04, 0xF5, 0xE5,
+    0xFA, 0x1C, 0xF4, 0x35, 0x65, 0x64, 0x0F, 0x9E, 0xCC, 0xCC, 0x4B, 0xA9, 0xBC, 0x69, 0xBF, 0xC8,
+    0x9E, 0xF3, 0x57, 0xC1, 0xB4, 0xEF, 0xC0, 0x90, 0xB5, 0x4D, 0x36, 0x14, 0xD4, 0x24, 0x21, 0x8D,
+    0xB2, 0xA3, 0x01, 0x69, 0x73, 0x6B, 0x47, 0xCD, 0xDD, 0x71, 0x4F, 0x6F, 0xC3, 0x72, 0x97, 0xAA,
+    0x6F, 0x2A, 0x2E, 0xC0, 0x4D, 0xE6, 0x94, 0x8B, 0x18, 0xD3, 0xBB, 0x66, 0x7A, 0x7F, 0xF5, 0x16,
+    0xAD, 0x22, 0x7D, 0x74, 0xCC, 0xDC, 0x56, 0xCC, 0x3D, 0x24, 0x3C, 0x16, 0x2C, 0x5C, 0x2F, 0xD5,
+    0x94, 0x4D, 0x7A, 0x34, 0xA3, 0x0D, 0x36, 0xE4, 0x7D, 0xD1, 0xF1, 0x21, 0x30, 0xAE, 0xAE, 0x59,
+    0x87, 0xEA, 0x19, 0x2E, 0xB7, 0x7B, 0xF6, 0x17, 0xA6, 0x0A, 0x2E, 0x35, 0xB7, 0x8A, 0xBB, 0x04,
+    0xDC, 0x03, 0x5A, 0x40, 0x00, 0x70, 0x90, 0x3E, 0x80, 0xD0, 0xC2, 0xD5, 0x40, 0x17, 0x74, 0x00,
+    0x75, 0xEB, 0x69, 0x4B, 0x5F, 0xB1, 0x63, 0x0F, 0xED, 0xD2, 0x9B, 0x65, 0xE1, 0xAC, 0xB7, 0xA0,
+    0x4F, 0x83, 0x5A, 0xCF, 0xC1, 0x30, 0x1D, 0xD7, 0x09, 0xAB, 0x49, 0x8D, 0x10, 0xCF, 0xA0, 0xFB,
+    0x02, 0xAB, 0xD6, 0xDD, 0x5B, 0x6D, 0xAF, 0xD7, 0x27, 0x50, 0x17, 0xEE, 0x78, 0x88, 0x12, 0xAB,
+    0x5A, 0xCE, 0x7B, 0xE3, 0x18, 0x95, 0x83, 0x42, 0xB2, 0x5D, 0xE5, 0x72, 0x30, 0xF1, 0x54, 0x88,
+    0x92, 0xE2, 0x66, 0x04, 0x4C, 0x44, 0x07, 0xA9, 0x54, 0x55, 0xE6, 0x5F, 0x36, 0x80, 0x02, 0x85,
+    0xA7, 0xA4, 0xC8, 0xAB, 0x5E, 0x3A, 0x80, 0x93, 0x82, 0xC0, 0x91, 0x6F, 0xB9, 0x34, 0x43, 0x86,
+    0x90, 0xB1, 0x1A, 0x31, 0xD2, 0x41, 0xB7, 0xEC, 0x42, 0xC1, 0xFA, 0xFA, 0xC5, 0x8B, 0xA1, 0x32,
+    0x9C, 0x7B, 0x76, 0x07, 0x6A, 0x5E, 0xA4, 0x64, 0x81, 0xAA, 0x78, 0x0C, 0xB9, 0x43, 0xEA, 0x1B,
+    0x01, 0xC5, 0x82, 0x19, 0x41, 0x1E, 0x80, 0xE7, 0x11, 0x05, 0x73, 0x06, 0x17, 0x35, 0x77, 0xD1,
+    0xC5, 0x8F, 0x2F, 0x86, 0xC6, 0xB0, 0x76, 0xEC, 0x1E, 0xA8, 0xA8, 0xF2, 0x9D, 0xE5, 0x72, 0x89,
+    0x7D, 0x7C, 0x8D, 0xDF, 0x0D, 0x7E, 0x28, 0x4C, 0x27, 0x99, 0xEA, 0xEE, 0xF8, 0xE1, 0x94, 0x79,
+    0x83, 0x2D, 0xBB, 0xAB, 0xDD, 0xD5, 0x0C, 0x0C, 0xA0, 0xE9, 0xF1, 0x41, 0xEE, 0x39, 0xC2, 0x89,
+    0x3E, 0x54, 0x6C, 0x38, 0xB1, 0x19, 0x3A, 0xCB, 0x23, 0xCC, 0xED, 0x94, 0x06, 0xDD, 0xD9, 0x93,
+    0xA0, 0x7A, 0x5C, 0x0D, 0x76, 0x6F, 0x79, 0x4A, 0x96, 0xCB, 0x32, 0x99, 0x2E, 0x00, 0x46, 0xFB,
+    0x39, 0xFB, 0x7D, 0x7B, 0xDF, 0x98, 0x5B, 0xFA, 0xA3, 0x8F, 0x0F, 0xAF, 0xBF, 0x16, 0xAD, 0x91,
+    0x77, 0xEA, 0x7B, 0xCA, 0x1C, 0x15, 0x25, 0x40, 0xBA, 0xB5, 0x9F, 0xAC, 0xEE, 0xD2, 0x3F, 0x74,
+    0x83, 0x0F, 0x92, 0x90, 0x0F, 0xE6, 0x86, 0x6F, 0xF7, 0x3B, 0x2F, 0x81, 0xD4, 0x70, 0x01, 0xD2,
+    0x29, 0xF7, 0x33, 0xBC, 0x02, 0x8D, 0x0A, 0xF4, 0xFF, 0x86, 0xF4, 0x81, 0x74, 0x02, 0xD4, 0x50,
+    0x15, 0x35, 0x4F, 0xB8, 0x44, 0x2B, 0x68, 0xB7, 0x1F, 0xDD, 0x3B, 0x25, 0x90, 0x5C, 0xB3, 0x88,
+    0x80, 0xAF, 0x84, 0xEB, 0x96, 0x0F, 0x83, 0xF6, 0xD5, 0x09, 0x18, 0xDB, 0xB9, 0xD7, 0xB4, 0x02,
+    0x77, 0x2A, 0x1D, 0x08, 0x62, 0x1D, 0xB7, 0x16, 0xBF, 0x39, 0x3C, 0x12, 0x09, 0x77, 0x82, 0x3C,
+    0x52, 0x67, 0x57, 0xFD, 0xBC, 0xFE, 0x84, 0x92, 0xB3, 0x57, 0x4F, 0xB5, 0xB7, 0x6D, 0x55, 0x4E,
+    0x0A, 0x12, 0x8E, 0x7F, 0x4F, 0xA0, 0x97, 0x7C, 0xC0, 0xDF, 0xAE, 0x7A, 0x3C, 0xB7, 0x7D, 0x89,
+    0x05, 0x8E, 0x82, 0x85, 0x6A, 0x4C, 0x2F, 0xBD, 0x17, 0xED, 0x62, 0x2F, 0xD6, 0x85, 0xB4, 0x97,
+    0x24, 0x02, 0x80, 0xFC, 0x92, 0xE9, 0xD9, 0x00, 0x45, 0xF5, 0x0D, 0xB4, 0x35, 0xDA, 0x5A, 0x7A,
+    0x3E, 0x64, 0x77, 0x2E, 0xCD, 0xFD, 0x07, 0xD0, 0x97, 0x71, 0x8E, 0x9D, 0xE7, 0x75, 0xAC, 0x48,
+    0xC9, 0xB0, 0x13, 0x11, 0xC9, 0xE1, 0x24, 0x6A, 0x2F, 0xB2, 0xFE, 0x99, 0x4C, 0xF7, 0x65, 0xDA,
+    0x8F, 0x3D, 0x47, 0xA6, 0x5B, 0x32, 0xBD, 0xF1, 0x27, 0x7C, 0x8E, 0xE6, 0x07, 0xCF, 0x8F, 0xAA,
+    0x9E, 0x5B, 0xD4, 0xCC, 0x85, 0x89, 0xAE, 0x5E, 0xBE, 0xFA, 0xFE, 0x6D, 0x80, 0x2B, 0xBC, 0xA3,
+    0x72, 0x24, 0x66, 0x47, 0x79, 0x2F, 0x01, 0xBE, 0x1A, 0xD5, 0x13, 0xD0, 0xA9, 0xE4, 0x5D, 0x85,
+    0x04, 0x2C, 0x27, 0xF2, 0x28, 0xB8, 0xC6, 0x72, 0x97, 0xB1, 0x4B, 0xA4, 0x6E, 0xA6, 0x05, 0x04,
+    0x8E, 0xDE, 0xB3, 0xE9, 0x8C, 0xED, 0x1C, 0xD6, 0xFF, 0x5D, 0x88, 0xE3, 0x3E, 0x3D, 0x85, 0xEB,
+    0xCE, 0xB6, 0xD0, 0x60, 0x06, 0x3E, 0xEF, 0xF4, 0x5C, 0xA2, 0x60, 0xE5, 0x7D, 0x94, 0xC6, 0xD2,
+    0xC8, 0xA7, 0xCD, 0x56, 0xBC, 0xCD, 0xF6, 0x50, 0x8D, 0x01, 0xBB, 0x1A, 0xD4, 0x79, 0x69, 0x3C,
+    0x1E, 0x0A, 0x52, 0x0D, 0xB4, 0xED, 0x7E, 0xDD, 0xF5, 0xFB, 0xF1, 0x0B, 0xCD, 0x54, 0xBD, 0x6E,
+    0xD4, 0x40, 0x10, 0x1E, 0xDB, 0x24, 0x96, 0x58, 0x29, 0xA6, 0x4A, 0x41, 0x0A, 0xB7, 0x74, 0xDB,
+    0xD0, 0x92, 0xF5, 0x1B, 0x70, 0x05, 0x16, 0xAF, 0x80, 0xA0, 0xA0, 0xA1, 0xB7, 0x25, 0x0A, 0xDA,
+    0x14, 0xA4, 0x4F, 0x01, 0x12, 0x0A, 0x45, 0x1E, 0xE1, 0x8C, 0x78, 0x01, 0x3F, 0x82, 0x8B, 0x14,
+    0x88, 0xEA, 0x0A, 0x23, 0x1D, 0xC1, 0xF6, 0x30, 0xF3, 0xED, 0xFA, 0x9C, 0x28, 0x8A, 0xA0, 0x42,
+    0x58, 0xC9, 0xF8, 0xD6, 0x3B, 0xBF, 0xDF, 0x7C, 0x33, 0x44, 0x44, 0xFB, 0x2B, 0xA2, 0xBC, 0x25,
+    0x3A, 0x96, 0xDF, 0x7B, 0xF4, 0x4F, 0x9E, 0x37, 0x44, 0xE9, 0x20, 0xFF, 0x1B, 0xF9, 0x5D, 0x3C,
+    0xC8, 0xCC, 0xE6, 0xF1, 0x01, 0xDD, 0xC3, 0xCD, 0x5B, 0xFD, 0x44, 0x4F, 0xF2, 0x5A, 0xA4, 0x6D,
+    0xB9, 0x20, 0xAA, 0xFA, 0x98, 0xAF, 0x2E, 0x78, 0xA0, 0x94, 0x99, 0x7F, 0x4A, 0xBA, 0xCC, 0x1F,
+    0xE4, 0x32, 0x7A, 0xF9, 0xB1, 0xC0, 0x81, 0x3B, 0x8A, 0x19, 0x2F, 0x3E, 0xA1, 0x43, 0x6E, 0xAD,
+    0x98, 0x46, 0x0C, 0x3F, 0xD1, 0xF0, 0x48, 0xBD, 0xC5, 0xF5, 0xF5, 0xD8, 0x85, 0x7F, 0xC5, 0x3D,
+    0xED, 0x95, 0xF2, 0x3C, 0xE7, 0xC2, 0x32, 0x9E, 0xCE, 0xF9, 0xF7, 0x36, 0xBC, 0xBD, 0x62, 0xD6,
+    0x7B, 0xFD, 0x83, 0xE2, 0x76, 0x19, 0xD9, 0xA0, 0x32, 0x61, 0x1C, 0xB8, 0x51, 0x59, 0x21, 0x7F,
+    0x3B, 0xFC, 0x15, 0x0C, 0xF1, 0x85, 0x44, 0x13, 0x7B, 0xE6, 0x0D, 0xAA, 0x6B, 0xC9, 0x88, 0xAC,
+    0x29, 0xDB, 0xEA, 0x6D, 0x8E, 0xC8, 0x16, 0x0E, 0x5D, 0x07, 0xE7, 0xAD, 0xCA, 0xB5, 0xAA, 0x90,
+    0x4F, 0x50, 0xA4, 0x56, 0xAB, 0x32, 0xE1, 0xD3, 0x62, 0x4E, 0x26, 0x9D, 0x54, 0x9A, 0x11, 0x49,
+    0x8E, 0x65, 0x59, 0x50, 0x2E, 0x3A, 0x0D, 0x59, 0x48, 0x77, 0x4D, 0x56, 0x90, 0x0C, 0xA9, 0x45,
+    0xD4, 0xEA, 0xDB, 0x75, 0x95, 0xC4, 0xB3, 0xBD, 0xED, 0xD5, 0x3C, 0x13, 0x37, 0x86, 0x0D, 0x42,
+    0x7C, 0x55, 0xB5, 0x72, 0x55, 0xAE, 0xEE, 0x2E, 0x2A, 0x3A, 0xFF, 0xCC, 0x3D, 0x5A, 0x32, 0x20,
+    0x3F, 0xB1, 0xAE, 0x90, 0xA0, 0xBD, 0x92, 0x3C, 0x66, 0xCC, 0x90, 0x60, 0xEC, 0x31, 0xF6, 0xA1,
+    0xDD, 0x8F, 0xF2, 0x84, 0x34, 0xCF, 0x5E, 0xC3, 0xA9, 0x71, 0xB2, 0xAB, 0x4E, 0xD4, 0xD6, 0x40,
+    0xC0, 0x01, 0x8D, 0x1C, 0x3E, 0xCC, 0xE4, 0xD1, 0x3F, 0x2D, 0x9F, 0x21, 0x10, 0xFB, 0x40, 0x35,
+    0x2A, 0xEB, 0x28, 0xD3, 0x56, 0x02, 0xD6, 0xC9, 0x13, 0x64, 0x61, 0xC1, 0x11, 0x8E, 0x11, 0xBA,
+    0x0C, 0x4C, 0x78, 0x50, 0x8D, 0xAB, 0xF3, 0x33, 0xCA, 0x11, 0x80, 0xD6, 0xCD, 0x92, 0xE5, 0x4C,
+    0x81, 0xAA, 0xF1, 0x39, 0xFB, 0x6F, 0x13, 0x6B, 0x42, 0x95, 0xB6, 0x0E, 0xEE, 0xE5, 0x95, 0xF1,
+    0x2F, 0x69, 0x21, 0xB9, 0xAD, 0x56, 0x14, 0x71, 0xA3, 0xAA, 0x66, 0x00, 0xD3, 0xA5, 0x7F, 0xB9,
+    0xE8, 0x4B, 0x21, 0xF2, 0x37, 0x7F, 0xDB, 0xEC, 0x69, 0x51, 0x5C, 0xAF, 0x59, 0x3B, 0x16, 0x4B,
+    0xB6, 0x82, 0x79, 0x86, 0xE6, 0x36, 0xEE, 0xF2, 0x26, 0xAA, 0x18, 0x08, 0x42, 0xDD, 0x99, 0x67,
+    0x01, 0xFA, 0x8C, 0xCC, 0xAA, 0xFA, 0x0F, 0x3C, 0x43, 0x2F, 0x0C, 0x92, 0x74, 0x00, 0x02, 0xA0,
+    0xA4, 0xE3, 0xC2, 0x2F, 0xB4, 0xC0, 0xB3, 0xC6, 0xF6, 0xBB, 0x0F, 0x9E, 0x4C, 0x1E, 0x6D, 0xE0,
+    0x9F, 0xA0, 0x61, 0xE1, 0xC3, 0x06, 0x1F, 0x6A, 0x80, 0x81, 0x34, 0x7A, 0xC0, 0xA3, 0x86, 0x19,
+    0x0C, 0x2B, 0xA5, 0x71, 0xC4, 0x6D, 0xC8, 0xE2, 0xF0, 0xBD, 0x1E, 0xD7, 0x8A, 0x9B, 0xEF, 0x6C,
+    0x1A, 0x88, 0xDF, 0xE6, 0x23, 0x1C, 0x71, 0xA3, 0xD2, 0x6E, 0x22, 0x91, 0x02, 0x90, 0x7A, 0x7A,
+    0x15, 0x38, 0xEF, 0xC9, 0x9A, 0xA1, 0xB1, 0x6A, 0xA6, 0x04, 0x2B, 0xD1, 0xF7, 0x66, 0xA6, 0xC5,
+    0x4A, 0xAE, 0x8B, 0x7D, 0xEE, 0x53, 0xF4, 0x13, 0x84, 0x98, 0x60, 0xC7, 0xB0, 0x53, 0xE8, 0x21,
+    0x73, 0xC4, 0xA6, 0xD7, 0xFC, 0xED, 0x36, 0x50, 0x86, 0x27, 0x29, 0xD0, 0xA2, 0x9B, 0x0E, 0x4C,
+    0x74, 0x4A, 0x22, 0x91, 0xC5, 0x0B, 0xA9, 0x7B, 0x5C, 0xA6, 0xCA, 0x43, 0x13, 0x85, 0xA1, 0xF7,
+    0x83, 0x06, 0xE3, 0x44, 0xC3, 0xCE, 0xD6, 0xB1, 0xE7, 0xAE, 0x81, 0x43, 0x39, 0x05, 0xBD, 0x1A,
+    0xA6, 0x1D, 0x89, 0x86, 0x68, 0xF1, 0x65, 0x14, 0xF2, 0x1D, 0x43, 0xD6, 0xFE, 0xB7, 0x01, 0x81,
+    0xE9, 0x21, 0x4F, 0x27, 0x1A, 0xF0, 0x3B, 0x8A, 0x95, 0xC1, 0x94, 0x06, 0xC9, 0x10, 0x69, 0x02,
+    0xE2, 0x48, 0xE0, 0x91, 0x0E, 0xEA, 0x79, 0x12, 0x97, 0x85, 0x12, 0x57, 0xC0, 0x90, 0x05, 0x92,
+    0x4E, 0x18, 0x2F, 0xC6, 0x59, 0xF6, 0x91, 0xF4, 0x48, 0xBA, 0xA7, 0xDD, 0x50, 0x16, 0x0C, 0x94,
+    0x4F, 0xB4, 0x7F, 0x21, 0x89, 0xC4, 0x9F, 0xEE, 0x9F, 0x51, 0xF5, 0x65, 0x12, 0x1B, 0xD7, 0x45,
+    0xFC, 0x6E, 0x24, 0xD7, 0x73, 0x9B, 0xF0, 0xD3, 0x3B, 0x57, 0xD8, 0xF1, 0x59, 0x28, 0x5F, 0x97,
+    0x04, 0xD0, 0x50, 0x14, 0x30, 0xD7, 0x5A, 0x59, 0xDE, 0x87, 0x21, 0xD1, 0xA6, 0x60, 0x82, 0xB4,
+    0x85, 0x66, 0x98, 0xF5, 0xB6, 0x5A, 0x7B, 0xED, 0x79, 0x96, 0xCC, 0x7A, 0xBA, 0x5D, 0x48, 0x99,
+    0xA1, 0xCB, 0x06, 0x94, 0x71, 0x58, 0x00, 0x8D, 0x67, 0x11, 0x32, 0xA5, 0x1D, 0x0D, 0xA1, 0xB5,
+    0x43, 0xDF, 0x6D, 0xAF, 0x6D, 0x61, 0xB0, 0xF2, 0xE6, 0xBD, 0x0D, 0xF7, 0xC5, 0xB2, 0x9F, 0xFD,
+    0xEA, 0x08, 0xE4, 0xC9, 0xC3, 0x16, 0xAF, 0x97, 0x05, 0x63, 0xC2, 0x4A, 0x6F, 0x97, 0x2D, 0x1F,
+    0x87, 0x7B, 0x4C, 0x47, 0x1A, 0xEE, 0xBB, 0xD9, 0x3E, 0xBE, 0x3C, 0x52, 0x67, 0x6E, 0xDE, 0x5E,
+    0xEC, 0xA7, 0xAE, 0x99, 0x17, 0x5A, 0x82, 0x85, 0x46, 0x87, 0xEB, 0x9F, 0xF4, 0x5F, 0x3D, 0xBF,
+    0x01, 0x8D, 0x55, 0x31, 0x8E, 0xDD, 0x36, 0x10, 0x1D, 0x89, 0x70, 0x04, 0x58, 0x05, 0x2B, 0x57,
+    0x5B, 0xE8, 0x08, 0x3C, 0x82, 0x94, 0x3B, 0x78, 0xAB, 0xDC, 0xC0, 0x4D, 0x8E, 0x20, 0x21, 0xB9,
+    0x40, 0x9A, 0xF4, 0x6E, 0xED, 0xC6, 0x37, 0x08, 0xE9, 0x34, 0x69, 0x05, 0x04, 0x49, 0x1B, 0x15,
+    0xE9, 0x23, 0xC0, 0x32, 0xA0, 0x05, 0x28, 0x4D, 0xDE, 0x1B, 0xCA, 0xFB, 0xBD, 0x8E, 0x8B, 0x2C,
+    0x3E, 0x86, 0xAB, 0x01, 0x39, 0x7C, 0xF3, 0xDE, 0xCC, 0x50, 0xA4, 0x55, 0x3D, 0x05, 0x7F, 0xBD,
+    0xEA, 0xCE, 0x55, 0x55, 0x13, 0x16, 0xB8, 0x95, 0x9F, 0x61, 0xAE, 0x8B, 0x5B, 0xFC, 0x8C, 0xC5,
+    0xED, 0x32, 0xF2, 0xB3, 0x9B, 0xEB, 0x7C, 0xB9, 0x97, 0xE2, 0xEE, 0xF5, 0x6F, 0xBA, 0x2B, 0xD5,
+    0x4C, 0x77, 0xCB, 0x95, 0xEE, 0x3F, 0xDE, 0x6D, 0x08, 0x52, 0x1D, 0xD2, 0x2F, 0x74, 0xAF, 0x12,
+    0x87, 0x06, 0xEE, 0xE4, 0x0E, 0xB8, 0xE5, 0x94, 0xB0, 0xC2, 0xDD, 0xEC, 0x77, 0x9A, 0xDA, 0x5D,
+    0x82, 0xEA, 0x51, 0xEB, 0x4C, 0x10, 0x8B, 0x57, 0x71, 0xC4, 0x16, 0x37, 0xBA, 0x07, 0xA7, 0x13,
+    0x2F, 0x94, 0x67, 0x83, 0x3C, 0xFD, 0xAB, 0x5E, 0x96, 0xB5, 0x4F, 0xB6, 0x20, 0xB8, 0x5B, 0xB1,
+    0xC6, 0xC1, 0x90, 0xFA, 0x55, 0xDA, 0xC5, 0x80, 0xCA, 0x41, 0xDC, 0x8B, 0x78, 0xEC, 0xAB, 0x0F,
+    0x31, 0xFC, 0x38, 0xD3, 0x23, 0x2C, 0xEE, 0x21, 0x6A, 0x89, 0x58, 0x91, 0x86, 0xE7, 0xA2, 0x8B,
+    0xD8, 0xA2, 0xA9, 0x5B, 0x91, 0x64, 0x9B, 0xEB, 0x53, 0xAA, 0x2C, 0xFD, 0xCC, 0x33, 0x40, 0xEF,
+    0x4A, 0x7A, 0x69, 0x9C, 0x64, 0x1C, 0x7C, 0x6E, 0x37, 0x69, 0xB7, 0x3B, 0x9D, 0xD4, 0x18, 0x5C,
+    0x71, 0x2D, 0xA2, 0x1C, 0x15, 0xCE, 0xE0, 0x73, 0x40, 0xA6, 0x41, 0xCF, 0xC1, 0xE5, 0x02, 0xB5,
+    0x63, 0xDC, 0x1C, 0xCC, 0xF6, 0xB4, 0xBB, 0xD9, 0x6D, 0xA4, 0x5D, 0x5F, 0xFD, 0x1C, 0x3F, 0xBE,
+    0x7A, 0x0D, 0x34, 0xAB, 0x31, 0xBC, 0x98, 0x25, 0xF9, 0x95, 0x29, 0x53, 0x9B, 0x2D, 0x74, 0x34,
+    0xFA, 0xCF, 0x59, 0xB4, 0x4A, 0x86, 0x1A, 0xD9, 0xE9, 0x89, 0x73, 0x9D, 0x4E, 0x40, 0x10, 0x4E,
+    0xA6, 0xDF, 0x67, 0xB3, 0x3B, 0x73, 0x1F, 0xA9, 0x85, 0x28, 0x3E, 0xCD, 0x8E, 0xA9, 0x82, 0x8D,
+    0xA9, 0x66, 0xB2, 0x93, 0x53, 0xA8, 0x07, 0x8B, 0xCF, 0x41, 0xEE, 0x52, 0xF5, 0x84, 0x68, 0x23,
+    0x51, 0x1A, 0x83, 0xE4, 0x36, 0xB3, 0x96, 0x4C, 0x29, 0x83, 0xEA, 0xFC, 0x42, 0x14, 0xD0, 0x05,
+    0xC8, 0x4E, 0x2B, 0x44, 0xAE, 0xF4, 0x5B, 0x26, 0xA1, 0x09, 0x77, 0xA1, 0x0A, 0x68, 0xC3, 0xC6,
+    0xE4, 0x7C, 0x86, 0xB6, 0xD2, 0x9C, 0x40, 0x85, 0xAC, 0xC6, 0xDD, 0xAA, 0x8F, 0x76, 0x34, 0x35,
+    0x7A, 0xB3, 0xDE, 0x6C, 0x6B, 0xD6, 0x59, 0xA9, 0x82, 0xD1, 0xD9, 0xC4, 0x2A, 0x9B, 0x48, 0x47,
+    0x67, 0xFA, 0xF9, 0x23, 0x82, 0x15, 0xA7, 0x1E, 0x41, 0x6A, 0xFD, 0x15, 0xBC, 0x83, 0xBD, 0x5E,
+    0x37, 0xA4, 0xDD, 0xA0, 0x9A, 0x43, 0x46, 0xF8, 0xF5, 0x86, 0xB1, 0x39, 0x6C, 0x09, 0x96, 0x4D,
+    0x61, 0x18, 0x87, 0x2D, 0xEB, 0xEE, 0xF8, 0x22, 0x9F, 0x5A, 0x4B, 0x8D, 0x2D, 0xF2, 0xFC, 0x2D,
+    0x0F, 0x56, 0xD8, 0x1E, 0x93, 0x8C, 0xE0, 0x16, 0x3F, 0x40, 0x20, 0x71, 0xA0, 0x78, 0x03, 0xAC,
+    0x01, 0x9B, 0x03, 0x39, 0x5E, 0x78, 0x2B, 0x36, 0x53, 0x97, 0x98, 0x7A, 0x3D, 0xB0, 0xD9, 0x9F,
+    0xDC, 0xFC, 0x83, 0xE2, 0x64, 0xB7, 0x8D, 0xBF, 0xF3, 0x58, 0xB7, 0x83, 0x86, 0xFE, 0x03, 0x60,
+    0x83, 0x0B, 0x7D, 0x4F, 0x45, 0x74, 0xA3, 0x76, 0x7A, 0x3A, 0xEB, 0x85, 0x14, 0x33, 0x03, 0xE2,
+    0x1A, 0x87, 0x92, 0x52, 0xF6, 0xDA, 0x14, 0x74, 0x68, 0x74, 0x75, 0xDC, 0x9C, 0xC1, 0x17, 0xC1,
+    0x7D, 0xF3, 0x5A, 0xDE, 0x80, 0xA9, 0x87, 0xEF, 0x0E, 0x29, 0xED, 0x87, 0xF2, 0x60, 0xBE, 0x75,
+    0xE9, 0xE8, 0xF0, 0x20, 0xFF, 0xEB, 0xCF, 0x6F, 0x82, 0x52, 0x47, 0x5A, 0x4D, 0x86, 0x8C, 0xFC,
+    0x44, 0x0A, 0xE8, 0x52, 0xA7, 0xAC, 0x1A, 0x58, 0xE4, 0x5D, 0x43, 0x52, 0x0A, 0xF1, 0x23, 0xF5,
+    0xD0, 0xDF, 0x28, 0x84, 0xFE, 0xB5, 0x99, 0x28, 0xAB, 0xE9, 0x37, 0x9B, 0x9D, 0x4C, 0x20, 0x23,
+    0xCE, 0x0A, 0x24, 0xE4, 0x1B, 0xE1, 0xFD, 0xFA, 0xC8, 0xFA, 0x1D, 0x37, 0x7A, 0x9B, 0x37, 0x9D,
+    0x92, 0xF9, 0xA0, 0x9B, 0x9D, 0x24, 0xEC, 0xFE, 0xE1, 0x2A, 0x28, 0x6A, 0xE0, 0xD8, 0x5E, 0x13,
+    0x7F, 0x80, 0x32, 0xCE, 0x82, 0xD6, 0x04, 0xB2, 0xD6, 0x54, 0x70, 0x27, 0x7F, 0xA2, 0x43, 0x05,
+    0x0D, 0xC7, 0x44, 0x98, 0x81, 0x22, 0x88, 0xDF, 0xAF, 0x24, 0x9A, 0x5B, 0x8C, 0x64, 0x31, 0x96,
+    0xAF, 0xC5, 0xD0, 0xFB, 0x7B, 0xC6, 0xB0, 0x9E, 0xE2, 0x40, 0x58, 0x59, 0x63, 0x20, 0x9D, 0xFD,
+    0x65, 0xE0, 0xAC, 0x50, 0xFC, 0x7A, 0xEB, 0x81, 0xAB, 0xFA, 0x4B, 0x89, 0xBC, 0xF8, 0xD4, 0x36,
+    0x31, 0x3D, 0xB6, 0xAC, 0xBB, 0x46, 0x6A, 0xB2, 0x0C, 0x67, 0xCB, 0xCD, 0x4A, 0x38, 0x2E, 0xDC,
+    0x02, 0x1C, 0xB8, 0x19, 0x20, 0x80, 0x82, 0xB6, 0xDB, 0x68, 0xFB, 0x95, 0x36, 0x26, 0xD0, 0x85,
+    0xB6, 0x44, 0x65, 0x01, 0x78, 0xB7, 0x23, 0xCA, 0xFD, 0xF7, 0x05, 0x4C, 0x36, 0x60, 0xD9, 0x40,
+    0x66, 0x1B, 0x56, 0x99, 0x83, 0x4C, 0x8F, 0x56, 0x59, 0xC1, 0x1E, 0xA8, 0xBA, 0x13, 0xDD, 0x0F,
+    0x1B, 0x77, 0x5E, 0xCC, 0xFD, 0x2C, 0x16, 0xAB, 0xB0, 0x42, 0x81, 0x5C, 0x66, 0x20, 0x0E, 0xAB,
+    0xF3, 0x97, 0x36, 0x0E, 0x17, 0x9A, 0x83, 0x05, 0x84, 0x99, 0xBD, 0x83, 0x35, 0x30, 0xA8, 0x4C,
+    0xFA, 0x24, 0x5F, 0xA8, 0x87, 0xA5, 0xC9, 0xE5, 0xC9, 0xE8, 0x2F, 0x86, 0xD0, 0x0C, 0xEC, 0xCE,
+    0xA8, 0x3F, 0x3D, 0xAD, 0x26, 0x76, 0x61, 0xC7, 0x3D, 0x61, 0xE2, 0xBC, 0x1C, 0x30, 0x43, 0x47,
+    0x0E, 0xD2, 0x5F, 0x38, 0x3E, 0x0F, 0x46, 0xC3, 0x1D, 0x7C, 0x36, 0x4E, 0x16, 0xEA, 0x5A, 0x66,
+    0xBE, 0xE3, 0x76, 0x0C, 0x1B, 0x9F, 0x30, 0x77, 0xFC, 0x8C, 0xA7, 0x27, 0xCC, 0x9E, 0x92, 0x76,
+    0x7F, 0xBE, 0xD3, 0xC4, 0xC1, 0x39, 0x31, 0x77, 0xE6, 0x62, 0xF9, 0xCF, 0xD7, 0x6D, 0xCE, 0xF4,
+    0x0A, 0xA6, 0x9D, 0x5A, 0x20, 0x93, 0xAE, 0xDB, 0x1E, 0x05, 0x71, 0xA6, 0x52, 0x67, 0x6F, 0x5A,
+    0x9C, 0x1F, 0x1D, 0xDE, 0x84, 0x1C, 0x57, 0xA3, 0x80, 0x8C, 0xF8, 0xE3, 0x33, 0x07, 0x0F, 0xFA,
+    0xF2, 0x4A, 0xEE, 0x26, 0xEA, 0x6C, 0x72, 0x9A, 0x23, 0x9B, 0x63, 0xB1, 0x61, 0x7C, 0x49, 0x5F,
+    0xDE, 0x4E, 0x6F, 0x0F, 0x6B, 0x99, 0x4C, 0xC1, 0x6C, 0x3F, 0xB7, 0xB4, 0x09, 0x05, 0x89, 0x02,
+    0x05, 0xA3, 0xE0, 0x1D, 0xF9, 0x83, 0x58, 0x28, 0x0D, 0xFA, 0x51, 0x07, 0xE8, 0x3C, 0x94, 0x24,
+    0xDE, 0x46, 0x80, 0x05, 0xC3, 0xB8, 0x19, 0xAF, 0x22, 0x87, 0xFB, 0x86, 0x1A, 0xC0, 0x36, 0x8E,
+    0xE6, 0xB8, 0x00, 0x73, 0xCD, 0x61, 0x20, 0xF6, 0x60, 0x2C, 0xF1, 0x66, 0x93, 0xD9, 0xC9, 0x2C,
+    0x63, 0xA0, 0xA0, 0x19, 0x23, 0xF3, 0x7F, 0xBF, 0xFF, 0xB7, 0xD9, 0xFF, 0x05, 0x8D, 0x55, 0xB1,
+    0xAE, 0xDD, 0x44, 0x10, 0x1D, 0xDB, 0x02, 0x4B, 0xCF, 0x85, 0x3F, 0x20, 0x12, 0xFE, 0x04, 0x7F,
+    0xC2, 0x5A, 0x69, 0x68, 0x29, 0xF2, 0xAA, 0x14, 0xD4, 0xD0, 0xBC, 0x4F, 0xB0, 0x05, 0x25, 0x4D,
+    0x8A, 0xD0, 0x53, 0xBF, 0x14, 0x7C, 0xC2, 0x1A, 0x51, 0x50, 0xD0, 0x18, 0xA2, 0xF4, 0xB7, 0xA4,
+    0x8B, 0x93, 0x67, 0x81, 0x6F, 0x58, 0xFB, 0x70, 0xCE, 0xF8, 0xDE, 0x47, 0x44, 0x85, 0xE5, 0xBB,
+    0x77, 0x35, 0x3B, 0x3B, 0x73, 0x66, 0xE6, 0xCC, 0xD8, 0xCC, 0x9F, 0x9B, 0x08, 0x9C, 0x2C, 0x00,
+    0xB0, 0x8C, 0xCB, 0x62, 0x15, 0xD7, 0xC1, 0xC2, 0x89, 0x67, 0x19, 0x3A, 0xAE, 0x55, 0x92, 0xDE,
+    0xC7, 0x02, 0x60, 0x35, 0x5D, 0x99, 0xCC, 0x74, 0xCF, 0x4A, 0x80, 0x3A, 0xE1, 0xFC, 0x8C, 0x87,
+    0x18, 0xB9, 0x94, 0xBB, 0xAE, 0xB4, 0x8B, 0x56, 0xBC, 0xB9, 0x7D, 0x26, 0x0D, 0xCC, 0xD6, 0x72,
+    0x1D, 0x75, 0x05, 0x56, 0x40, 0x77, 0x1A, 0x17, 0xC3, 0xC5, 0x66, 0x35, 0xB8, 0x3D, 0x71, 0xB5,
+    0x1C, 0x53, 0xC0, 0xA2, 0x9D, 0xF5, 0x6B, 0x8D, 0xE4, 0xBB, 0x1A, 0x05, 0xF6, 0x4A, 0x08, 0x72,
+    0xFC, 0x06, 0x94, 0x8E, 0xA5, 0x5F, 0x7B, 0xFC, 0x42, 0xBC, 0x3A, 0x6E, 0xF1, 0xDA, 0x77, 0x39,
+    0x7E, 0xC5, 0x83, 0x5B, 0xB4, 0xF0, 0x37, 0x3E, 0x1C, 0xBB, 0xFA, 0xEA, 0x85, 0xC7, 0x70, 0xE8,
+    0xE6, 0x31, 0x5C, 0x76, 0x3A, 0x3E, 0xF9, 0x2E, 0x7B, 0xDC, 0x59, 0x2F, 0x74, 0xFE, 0x44, 0x8F,
+    0xD3, 0xC3, 0xB9, 0x1E, 0x4B, 0x0F, 0xFB, 0xA3, 0x41, 0xB7, 0x53, 0x22, 0xD1, 0xF3, 0xE6, 0x39,
+    0x4A, 0x61, 0x8D, 0x72, 0x48, 0xF8, 0xCD, 0x56, 0x2B, 0x41, 0x0D, 0x52, 0x85, 0x4C, 0x28, 0x5A,
+    0xA4, 0x02, 0x63, 0x60, 0x1A, 0x03, 0x0F, 0x70, 0x62, 0x7A, 0x18, 0x4C, 0xF6, 0xE3, 0x99, 0x49,
+    0x93, 0x4D, 0x19, 0x2E, 0x3E, 0xBC, 0x52, 0xE2, 0x2B, 0x21, 0x08, 0xA3, 0xBC, 0x08, 0x91, 0xD7,
+    0xA7, 0xA3, 0x16, 0x31, 0x60, 0xEF, 0x2C, 0xFB, 0xDA, 0xD3, 0xA0, 0xB3, 0x42, 0xEA, 0xED, 0x2C,
+    0x64, 0xE3, 0x67, 0xDD, 0xDD, 0x2E, 0xD0, 0xB3, 0xF2, 0x3C, 0xD4, 0x70, 0x4F, 0x4C, 0xCE, 0x13,
+    0xBC, 0xB0, 0xCB, 0x93, 0x1F, 0x01, 0xB1, 0xAE, 0x37, 0xF7, 0x56, 0x6E, 0xBC, 0x35, 0x59, 0x1C,
+    0xAD, 0x4F, 0x56, 0xF3, 0x55, 0x9D, 0x86, 0x82, 0xD7, 0x9A, 0x85, 0x76, 0x3A, 0x2A, 0xB7, 0xCC,
+    0x45, 0x10, 0x52, 0x29, 0x2B, 0x07, 0x91, 0x01, 0x6C, 0x54, 0xAE, 0x77, 0x29, 0x7F, 0x03, 0xDE,
+    0x6C, 0x96, 0xFE, 0xB5, 0xAE, 0x35, 0x6B, 0x5C, 0x2C, 0x3C, 0x80, 0x75, 0x2B, 0x77, 0xFC, 0xC4,
+    0x9B, 0x11, 0x4B, 0xBB, 0xD3, 0xEC, 0x5E, 0xD0, 0x0D, 0x53, 0x10, 0x93, 0x0C, 0xD2, 0x4D, 0x81,
+    0x2D, 0x73, 0x74, 0x43, 0x8B, 0xAE, 0x14, 0x60, 0x2A, 0x27, 0xA6, 0xDE, 0xD1, 0x7D, 0x65, 0x37,
+    0x04, 0x5C, 0x9F, 0x9F, 0xA7, 0x23, 0xF5, 0xA3, 0xB3, 0xCF, 0x53, 0x02, 0xA7, 0xE5, 0xDD, 0x7A,
+    0x8D, 0xC7, 0x43, 0x67, 0x16, 0x98, 0xBE, 0xFB, 0x1F, 0xAC, 0x9F, 0xAC, 0xD9, 0x44, 0xDD, 0x52,
+    0xE0, 0xF8, 0x32, 0x26, 0xF7, 0x42, 0x0A, 0x57, 0x64, 0x79, 0x3B, 0xE7, 0x62, 0xE1, 0x4E, 0x47,
+    0x33, 0x95, 0x09, 0x8C, 0xCA, 0x85, 0xAA, 0x88, 0x11, 0x6F, 0xA5, 0xDC, 0xFE, 0x85, 0x31, 0xC3,
+    0xE7, 0x5B, 0xE0, 0xB5, 0x77, 0xF8, 0x0E, 0x5D, 0x81, 0x30, 0x4B, 0xF9, 0x6D, 0x6A, 0x20, 0x14,
+    0x4F, 0x99, 0x03, 0xE6, 0x21, 0x6C, 0x2A, 0x71, 0x85, 0x51, 0x06, 0xE9, 0x26, 0x60, 0x6A, 0x3C,
+    0x75, 0x39, 0xDD, 0x30, 0x8C, 0x20, 0xE5, 0xB1, 0x74, 0xD0, 0xED, 0x2C, 0xFE, 0xD6, 0xA9, 0x64,
+    0x29, 0xCA, 0x4D, 0x6B, 0x41, 0x52, 0x33, 0x28, 0x7C, 0xAB, 0x35, 0xFE, 0xAE, 0x35, 0xBC, 0x17,
+    0x97, 0x9A, 0xB3, 0xD6, 0x6A, 0x53, 0xA1, 0x0B, 0xA7, 0x5C, 0x76, 0x04, 0x7E, 0x0D, 0xDF, 0xED,
+    0xF9, 0x5A, 0xAB, 0x1D, 0xED, 0xE0, 0x50, 0x7E, 0x55, 0xC2, 0x23, 0x7F, 0xC3, 0x9F, 0xA2, 0x54,
+    0x9D, 0x02, 0x8D, 0x54, 0xA8, 0x58, 0xB3, 0x02, 0x03, 0x23, 0xCD, 0x04, 0x34, 0x59, 0x14, 0x47,
+    0xC6, 0xA3, 0xAD, 0x69, 0xA1, 0x38, 0xB2, 0x7C, 0xB0, 0xBC, 0xD7, 0x40, 0x60, 0x63, 0x7F, 0x99,
+    0x64, 0xA0, 0xF0, 0x56, 0x27, 0x2F, 0xE8, 0xA5, 0x8B, 0x6A, 0xFE, 0x31, 0xC8, 0xFE, 0x4C, 0xC2,
+    0xB0, 0xD9, 0x4B, 0xF7, 0x92, 0xCB, 0xC6, 0xAE, 0x94, 0x73, 0xD7, 0xCF, 0x52, 0x6A, 0x09, 0xAF,
+    0x3F, 0xD5, 0x9B, 0x2B, 0xE1, 0x50, 0x1A, 0xAC, 0xA2, 0xD2, 0xC4, 0x08, 0x3A, 0xDA, 0x20, 0x0F,
+    0x9A, 0x44, 0x00, 0x53, 0x4D, 0xDE, 0x63, 0x2A, 0x68, 0xE3, 0xD6, 0xDF, 0xEB, 0x43, 0xC4, 0x46,
+    0x03, 0x15, 0xFF, 0xDA, 0x83, 0x9D, 0xFD, 0x85, 0xA4, 0x64, 0xA8, 0x48, 0xB4, 0xD2, 0xD2, 0xA4,
+    0xC2, 0x7A, 0xFA, 0xC9, 0x54, 0x16, 0xC6, 0x69, 0x37, 0x47, 0x2F, 0xD3, 0x3B, 0x10, 0x30, 0xE2,
+    0x03, 0x22, 0x8B, 0xDA, 0xB3, 0x4D, 0x59, 0x2E, 0xF6, 0x9F, 0x0A, 0xD5, 0xE2, 0x3D, 0x99, 0xB7,
+    0x6B, 0x7A, 0x30, 0xDF, 0x2D, 0x7E, 0x06, 0x11, 0x36, 0x60, 0x38, 0xFC, 0xDB, 0xAB, 0xCD, 0x9A,
+    0xB5, 0x49, 0x0C, 0xB1, 0x5D, 0x3E, 0xF9, 0x82, 0x28, 0x15, 0x32, 0x23, 0x52, 0x68, 0x81, 0x05,
+    0x3E, 0x99, 0x4B, 0x72, 0xAF, 0xAB, 0x5E, 0x89, 0x28, 0xA1, 0x20, 0x13, 0xE8, 0x24, 0xDC, 0xD2,
+    0x76, 0x19, 0x9D, 0x8F, 0xC6, 0x20, 0x2B, 0xF8, 0x6D, 0x72, 0x2B, 0x93, 0x6C, 0xD2, 0xEC, 0x73,
+    0x19, 0xC9, 0x96, 0xBC, 0x15, 0xBD, 0x58, 0x4C, 0xF7, 0xF7, 0xB7, 0x7D, 0xF2, 0xC1, 0xE9, 0x61,
+    0xA8, 0x9B, 0x35, 0x4B, 0x59, 0x44, 0x97, 0x1D, 0xC3, 0x53, 0x09, 0xF0, 0x61, 0x44, 0x62, 0x1A,
+    0x73, 0xC0, 0x6C, 0x94, 0x92, 0x29, 0xBD, 0x87, 0x6C, 0x55, 0x4F, 0x95, 0xC7, 0xE0, 0x7A, 0xE2,
+    0x43, 0x52, 0xD3, 0xE1, 0x32, 0xC5, 0xE6, 0xCB, 0x08, 0xD3, 0xDF, 0xFA, 0x29, 0x95, 0x72, 0xFE,
+    0x5A, 0xC1, 0x38, 0x99, 0x4A, 0xA1, 0x6B, 0xCC, 0x5E, 0x3C, 0x02, 0x27, 0x6C, 0xCD, 0x77, 0x9E,
+    0x53, 0x6F, 0x50, 0x70, 0x3C, 0x14, 0x35, 0x78, 0xA2, 0x88, 0x15, 0xB2, 0xC8, 0xC1, 0x4A, 0x1F,
+    0x89, 0x19, 0x6A, 0x6F, 0xDE, 0x49, 0xA5, 0x37, 0xCC, 0x19, 0xFD, 0xA9, 0xE3, 0x7B, 0xBC, 0x7C,
+    0x7E, 0xF9, 0x04, 0x10, 0xB9, 0x07, 0x05, 0xBB, 0x84, 0x78, 0x04, 0x37, 0x38, 0x19, 0x65, 0xB2,
+    0x75, 0x6A, 0xB2, 0xDB, 0xF1, 0x87, 0xFD, 0xF7, 0x69, 0x1F, 0x53, 0xD3, 0x7D, 0xFC, 0x51, 0x89,
+    0xC7, 0x00, 0xB3, 0x62, 0x53, 0xE3, 0x37, 0x6A, 0x72, 0xCA, 0x0A, 0xEF, 0x79, 0x15, 0xC5, 0x4B,
+    0xD7, 0x93, 0x05, 0xBC, 0xE5, 0x82, 0x55, 0x70, 0x7B, 0x76, 0xC5, 0x90, 0x8B, 0x07, 0x92, 0x05,
+    0x4D, 0x3C, 0x53, 0x81, 0x3A, 0x67, 0x83, 0x97, 0x6C, 0x76, 0x01, 0xAB, 0x20, 0xA5, 0x66, 0x39,
+    0xC6, 0xCE, 0xFD, 0xFD, 0x0B, 0x6F, 0xD3, 0xC5, 0xF1, 0xAC, 0x1E, 0xC7, 0x22, 0xDF, 0x77, 0xB3,
+    0x7C, 0x87, 0x63, 0x06, 0xC9, 0x77, 0xA9, 0x29, 0x29, 0x3E, 0xE0, 0xCD, 0x9D, 0x00, 0x5E, 0x11,
+    0x6B, 0x2A, 0x7A, 0x6B, 0x2A, 0x9A, 0xC6, 0x6D, 0x44, 0x9C, 0xCD, 0x0B, 0xC0, 0x69, 0xE0, 0xC3,
+    0x4E, 0x15, 0x30, 0x9F, 0x17, 0xD6, 0xF8, 0x97, 0x27, 0x2E, 0xFF, 0x0A, 0x7C, 0x60, 0xC6, 0x64,
+    0xFF, 0xF7, 0xF9, 0x07, 0xAD, 0x55, 0x3D, 0xB2, 0xE6, 0x34, 0x10, 0x1C, 0x5B, 0x55, 0xEB, 0x2A,
+    0x1C, 0x28, 0x7A, 0x09, 0x1B, 0xF8, 0x00, 0x04, 0x3E, 0x82, 0x4C, 0x44, 0x4A, 0xC0, 0x97, 0x70,
+    0x05, 0x0E, 0x61, 0x57, 0x71, 0x05, 0x8E, 0x40, 0xF0, 0xA8, 0x0D, 0xDE, 0x0D, 0x56, 0x5A, 0x12,
+    0x42, 0x9C, 0x10, 0xE3, 0x60, 0x03, 0x16, 0x12, 0x05, 0xAE, 0xC2, 0x50, 0xB6, 0x87, 0xEE, 0x91,
+    0xDF, 0x0F, 0x24, 0x24, 0xEB, 0xAA, 0x37, 0x7A, 0x9F, 0x2C, 0x69, 0xBA, 0x7B, 0x5A, 0x63, 0x91,
+    0xC7, 0xE7, 0xB5, 0x7E, 0x40, 0xEC, 0x55, 0x17, 0x8B, 0x87, 0x88, 0x57, 0xD5, 0x24, 0x0E, 0x71,
+    0x13, 0x51, 0xFD, 0xFD, 0x41, 0x24, 0xE8, 0x84, 0x45, 0xAD, 0xCE, 0x88, 0x95, 0x66, 0xEE, 0x0B,
+    0x07, 0x63, 0x83, 0x95, 0x78, 0x74, 0x65, 0xF4, 0xCA, 0x58, 0xF3, 0xA4, 0xC7, 0xF7, 0xCE, 0xB6,
+    0x3C, 0x2D, 0xCE, 0x52, 0x4D, 0x32, 0xEA, 0xDF, 0xDF, 0x6C, 0x76, 0xBE, 0x0E, 0x38, 0x59, 0xB1,
+    0xD9, 0x7E, 0x88, 0x74, 0x88, 0x99, 0x39, 0xF9, 0x83, 0x73, 0x0B, 0x93, 0x12, 0x13, 0xDF, 0xE8,
+    0xDE, 0x33, 0x6E, 0xDC, 0xA2, 0xAB, 0xC5, 0x3C, 0x6A, 0xD9, 0x32, 0x5A, 0x9A, 0x92, 0xCC, 0x20,
+    0x55, 0x16, 0x6B, 0xC3, 0xED, 0x90, 0x87, 0xD9, 0xC5, 0x38, 0x18, 0xD2, 0xD3, 0xA2, 0xA1, 0xEA,
+    0x76, 0xC6, 0xDE, 0x62, 0xD8, 0x18, 0x47, 0x63, 0x13, 0x8D, 0x66, 0x21, 0x6B, 0x94, 0x0A, 0xB1,
+    0xC2, 0xC8, 0x15, 0xDE, 0x9F, 0x7C, 0x2F, 0xF5, 0x0F, 0xE2, 0x77, 0x69, 0x76, 0x69, 0x77, 0xF1,
+    0x9B, 0x34, 0x87, 0x74, 0x59, 0xDC, 0x29, 0x61, 0xC6, 0x22, 0x89, 0x09, 0xDB, 0x06, 0xE4, 0xAF,
+    0xF4, 0x5B, 0xE6, 0xD4, 0x9F, 0x98, 0x47, 0x7F, 0x65, 0x1E, 0x03, 0x2E, 0xD1, 0xCE, 0x1B, 0xED,
+    0xBC, 0x60, 0xE0, 0xC2, 0xF9, 0x0C, 0xA8, 0x37, 0x28, 0x21, 0x3F, 0xB1, 0x7B, 0x4D, 0x46, 0x9E,
+    0xFA, 0x40, 0x93, 0xC3, 0x2A, 0xB7, 0xDA, 0x4E, 0xDB, 0xFF, 0x97, 0x3C, 0x3F, 0x9F, 0x51, 0xD8,
+    0x96, 0xB2, 0x49, 0xFC, 0x43, 0xDF, 0xEC, 0xED, 0xEA, 0x37, 0x97, 0x83, 0xC4, 0xD9, 0xBF, 0x5B,
+    0x01, 0x2D, 0xB4, 0xC9, 0xEF, 0x6E, 0xEF, 0xA7, 0xB8, 0x8C, 0x0B, 0x65, 0xD4, 0xCA, 0xE4, 0xB5,
+    0x5A, 0x4C, 0x8D, 0x95, 0xBF, 0x7A, 0xD0, 0x13, 0xDA, 0x85, 0xD5, 0xE8, 0xA7, 0xA7, 0x1A, 0x9B,
+    0x4E, 0x95, 0x01, 0x2A, 0x82, 0x86, 0xDD, 0x26, 0xAC, 0xF2, 0x56, 0x00, 0xFC, 0xB5, 0x67, 0x41,
+    0x3E, 0x66, 0x2A, 0xC4, 0x2A, 0x38, 0x2D, 0xC4, 0xB8, 0x11, 0xBB, 0xED, 0x58, 0xAF, 0xA5, 0x18,
+    0xF1, 0x4F, 0xAB, 0x55, 0xA3, 0x97, 0x7D, 0x74, 0x2F, 0x66, 0xB2, 0xE3, 0xC1, 0x35, 0xC9, 0xB3,
+    0xD1, 0x2E, 0x3F, 0x22, 0xF7, 0xE3, 0x22, 0xDB, 0x13, 0xCB, 0xE2, 0x5E, 0x6D, 0x55, 0xAB, 0x3F,
+    0x73, 0x53, 0xAD, 0xD9, 0x56, 0xC5, 0xA3, 0xE1, 0xAA, 0x4E, 0x07, 0xAA, 0x8C, 0xFF, 0x1D, 0x56,
+    0x55, 0xE0, 0xC8, 0xA3, 0x47, 0x4C, 0x99, 0x9A, 0xCD, 0x26, 0x7E, 0x91, 0x38, 0x54, 0x87, 0xF8,
+    0x2C, 0x7D, 0xAA, 0x54, 0xDC, 0x2E, 0xFD, 0x22, 0xE3, 0xE4, 0x0E, 0x69, 0x57, 0x09, 0x49, 0x94,
+    0xD5, 0xC6, 0xDB, 0x98, 0xEA, 0x93, 0x25, 0x47, 0xA5, 0x41, 0x6D, 0x67, 0xDD, 0xC7, 0x04, 0x8A,
+    0x30, 0x42, 0x58, 0x04, 0x12, 0xC2, 0x0A, 0x2B, 0x57, 0x29, 0xF9, 0x43, 0x09, 0x4C, 0x9D, 0xE6,
+    0xE4, 0xA3, 0xA6, 0xC6, 0x89, 0x16, 0xDE, 0x1A, 0x73, 0xFB, 0x58, 0x6C, 0x2C, 0xCE, 0x2C, 0x19,
+    0x4D, 0xE9, 0xCD, 0xA8, 0xBD, 0xA8, 0xA8, 0x74, 0x49, 0x0E, 0xB7, 0x01, 0x56, 0x00, 0xAA, 0x26,
+    0x4B, 0x98, 0x0E, 0x69, 0x56, 0x0F, 0x48, 0x35, 0x70, 0xA3, 0xB6, 0xF5, 0xD9, 0x00, 0xEA, 0xFC,
+    0x16, 0x09, 0xDB, 0xB5, 0xD5, 0x14, 0xAF, 0x04, 0xE0, 0x8C, 0xE3, 0xF5, 0x88, 0x22, 0x37, 0x4F,
+    0xAD, 0xCC, 0x39, 0xC8, 0xE2, 0x28, 0x4D, 0x80, 0x98, 0x0D, 0x24, 0x6B, 0xF7, 0xEA, 0xAB, 0x16,
+    0x7C, 0x72, 0x9F, 0xC9, 0x69, 0xD2, 0x04, 0xAA, 0x87, 0x3B, 0x41, 0xB7, 0xCF, 0xDD, 0xDA, 0x93,
+    0x54, 0x4C, 0x3A, 0x70, 0x8E, 0xAA, 0x64, 0xBF, 0x82, 0xB3, 0xA6, 0x31, 0xC5, 0xC9, 0x9D, 0xB5,
+    0x3A, 0x12, 0x6E, 0x37, 0x93, 0x26, 0xCC, 0xA6, 0x85, 0x52, 0xA2, 0xB5, 0xD9, 0xFD, 0x0A, 0x6D,
+    0xFA, 0x39, 0x50, 0x0C, 0xF8, 0x0C, 0xE4, 0xDC, 0xCE, 0x54, 0x73, 0xB7, 0x84, 0xD9, 0x7C, 0xA7,
+    0xE6, 0x55, 0xD4, 0xC3, 0x2E, 0xF6, 0x2C, 0x65, 0xCE, 0xD4, 0x21, 0xC6, 0x57, 0xF7, 0xB8, 0x6D,
+    0xF7, 0xFF, 0x8F, 0xCD, 0x41, 0x5B, 0xAB, 0x85, 0x61, 0x03, 0x0E, 0xC3, 0x56, 0x11, 0x9B, 0xCF,
+    0x2F, 0xB1, 0x9D, 0xFF, 0xC1, 0xB6, 0x04, 0x96, 0x53, 0x3F, 0x07, 0xB6, 0xB5, 0x60, 0x4B, 0xCF,
+    0xD8, 0xDE, 0x1B, 0x36, 0x5D, 0x42, 0x41, 0x65, 0xB1, 0x54, 0xAE, 0xF8, 0xD2, 0x9D, 0xA5, 0x3E,
+    0xEB, 0x93, 0xFF, 0x85, 0x9D, 0x80, 0xCF, 0xDD, 0x97, 0x72, 0x77, 0xBB, 0x87, 0xD3, 0x60, 0xB7,
+    0x86, 0xCB, 0x7B, 0x73, 0x69, 0xCD, 0xEA, 0x7A, 0x5E, 0xA0, 0x80, 0x0B, 0x56, 0x91, 0xA2, 0xCF,
+    0xE6, 0xEC, 0xF7, 0x5C, 0x7B, 0x50, 0x0D, 0x98, 0xE6, 0x97, 0x87, 0x55, 0x4E, 0xF8, 0x0F, 0xE5,
+    0x89, 0x53, 0x6F, 0xA8, 0xD1, 0x13, 0x1A, 0xE4, 0x4E, 0xD6, 0xAC, 0x09, 0x0A, 0x17, 0xD6, 0x6C,
+    0x35, 0xBD, 0xB4, 0x8A, 0xFF, 0xED, 0x1A, 0xF7, 0x7F, 0x8F, 0xDD, 0x26, 0xED, 0x5C, 0x1A, 0x8B,
+    0x4F, 0xA5, 0xB5, 0x74, 0xD7, 0xD8, 0xDB, 0xB8, 0x98, 0x1D, 0xD8, 0x50, 0x09, 0x8C, 0x56, 0x1C,
+    0x2F, 0x4E, 0xD1, 0xC6, 0x49, 0xF4, 0xC6, 0xDB, 0x3B, 0x08, 0x19, 0xA1, 0x9C, 0x54, 0x88, 0xAD,
+    0x8E, 0x9E, 0x1E, 0x00, 0x10, 0xEA, 0xEB, 0xD4, 0x1E, 0x02, 0xA3, 0xC6, 0xC9, 0xDB, 0xA5, 0xC1,
+    0x68, 0x37, 0x46, 0xA7, 0x8E, 0x23, 0x36, 0xF5, 0xB8, 0x77, 0x4B, 0xAF, 0x6C, 0x24, 0xC6, 0x03,
+    0x2D, 0x37, 0xB0, 0xF8, 0x68, 0xBA, 0x81, 0xB7, 0x19, 0x6E, 0x1D, 0xC1, 0xEA, 0x6A, 0xBF, 0x22,
+    0x6F, 0x4A, 0x67, 0x11, 0x47, 0x85, 0x49, 0x85, 0xA0, 0xFA, 0xA9, 0x48, 0xC8, 0x49, 0x53, 0x30,
+    0x5E, 0x02, 0x42, 0x8C, 0x99, 0xFA, 0xB9, 0xE3, 0x6B, 0x1D, 0x28, 0xDF, 0x38, 0xB4, 0x1B, 0xD5,
+    0x63, 0xEE, 0x2F, 0x20, 0xDE, 0x8F, 0xB4, 0xD8, 0x55, 0xD0, 0xE5, 0xA5, 0x74, 0x9F, 0x7E, 0x67,
+    0x1F, 0x80, 0xAB, 0xA7, 0x96, 0x86, 0xC1, 0xD7, 0x8D, 0x0E, 0x71, 0x27, 0x6B, 0x36, 0x3D, 0x18,
+    0x10, 0x3D, 0x0B, 0x16, 0x41, 0x6B, 0xAB, 0x3E, 0xB0, 0xB3, 0x95, 0xA6, 0xB4, 0xD8, 0xA7, 0xEB,
+    0x2C, 0x7B, 0x66, 0x13, 0x04, 0xA8, 0xEE, 0x6E, 0xB7, 0x62, 0x08, 0x5C, 0xE8, 0x6A, 0xE0, 0xE2,
+    0xA0, 0xC3, 0x2B, 0xCD, 0xD6, 0x67, 0x8F, 0x62, 0xF7, 0xC9, 0x95, 0xEF, 0x58, 0xB0, 0x2D, 0x55,
+    0xF9, 0x00, 0xB6, 0x96, 0x19, 0x03, 0x5B, 0xF0, 0x47, 0x7E, 0xFE, 0x01, 0xAD, 0x55, 0xB1, 0x8E,
+    0xDD, 0x44, 0x14, 0xBD, 0xCF, 0xA3, 0xAC, 0x25, 0x5C, 0xB8, 0x0A, 0x12, 0x9B, 0x62, 0xFA, 0x95,
+    0xD0, 0x7C, 0xC2, 0x18, 0x28, 0x28, 0x28, 0x48, 0xC1, 0x8A, 0x22, 0x7F, 0x90, 0x66, 0xFF, 0x80,
+    0x31, 0xFB, 0x05, 0xDB, 0xD0, 0x50, 0x6D, 0x41, 0x41, 0x96, 0x82, 0x3F, 0x88, 0x27, 0xA2, 0xA0,
+    0xB5, 0x42, 0x49, 0x81, 0xA3, 0x64, 0x85, 0x44, 0x93, 0x59, 0x62, 0x84, 0x77, 0x77, 0xEC, 0xCB,
+    0x39, 0xF3, 0x36, 0x51, 0x3E, 0x00, 0xEF, 0x6A, 0xC6, 0xCF, 0x1E, 0xCF, 0x3D, 0xF7, 0xDC, 0x73,
+    0xCF, 0x88, 0xEC, 0xAF, 0x7B, 0x9D, 0x0C, 0x8B, 0x48, 0x3B, 0x36, 0xAA, 0x9D, 0xD8, 0xE8, 0x55,
+    0xA3, 0xB8, 0xA8, 0xAA, 0x93, 0xF8, 0x53, 0x7D, 0xE5, 0x92, 0xF8, 0xCF, 0x55, 0xDA, 0x24, 0xA1,
+    0xCD, 0xD2, 0x24, 0x79, 0x6A, 0x67, 0x4E, 0x7C, 0x5F, 0xA6, 0x28, 0xED, 0xB4, 0xDB, 0x4F, 0x15,
+    0xB7, 0x70, 0xA3, 0x51, 0x15, 0xF1, 0xB1, 0xE6, 0x34, 0xF4, 0xCD, 0xA4, 0xDD, 0x4E, 0xBB, 0x76,
+    0xD4, 0xD8, 0x60, 0x9F, 0x67, 0xBA, 0xE9, 0x8A, 0x38, 0x08, 0x90, 0xC5, 0x75, 0x98, 0x10, 0x40,
+    0x82, 0xEA, 0x88, 0xC9, 0xF2, 0x93, 0x6F, 0xA4, 0xD2, 0x57, 0xF2, 0xDE, 0x75, 0xC8, 0xA7, 0x08,
+    0xB1, 0x89, 0x00, 0xE4, 0x2A, 0xE2, 0x2E, 0xBF, 0xCE, 0x22, 0xA1, 0x33, 0x18, 0x55, 0x30, 0xEE,
+    0x36, 0xA9, 0x17, 0xA9, 0x56, 0x69, 0x67, 0x31, 0x2B, 0xC1, 0x1A, 0x15, 0xCB, 0x91, 0xDB, 0x9B,
+    0x92, 0x0C, 0xA0, 0x22, 0x06, 0xC7, 0x58, 0x9E, 0x00, 0x70, 0xB6, 0x18, 0x7D, 0x32, 0xDA, 0x4B,
+    0x98, 0x6A, 0x60, 0xD7, 0xB1, 0xD5, 0xAE, 0xD2, 0xD8, 0xAA, 0xD4, 0x1A, 0x2D, 0xE0, 0x6A, 0xEF,
+    0x37, 0x71, 0x18, 0x57, 0xF1, 0xDA, 0x85, 0x55, 0xEE, 0x1F, 0xCB, 0xF1, 0x57, 0x77, 0xC0, 0x76,
+    0x5B, 0x87, 0x44, 0x55, 0x7B, 0x43, 0x58, 0xFE, 0x46, 0xE7, 0x6A, 0x93, 0x21, 0x92, 0x0F, 0x19,
+    0xA4, 0xCE, 0x66, 0x16, 0x3B, 0xD9, 0x08, 0xA4, 0x2B, 0xC0, 0x99, 0x04, 0x60, 0x6D, 0xC4, 0x82,
+    0xF0, 0xDD, 0x89, 0x22, 0x1F, 0x5D, 0x0A, 0xB2, 0x16, 0x43, 0xD7, 0x92, 0x8E, 0x86, 0xFB, 0xBD,
+    0x77, 0xF5, 0x1C, 0x3E, 0xE6, 0xF0, 0x00, 0xF8, 0x0F, 0x48, 0x03, 0x28, 0x9E, 0x85, 0x74, 0x45,
+    0x20, 0x54, 0xB2, 0x70, 0x7D, 0xDC, 0x09, 0xB1, 0x03, 0x49, 0x22, 0x26, 0x3D, 0xB9, 0x46, 0x39,
+    0xB5, 0xD4, 0x80, 0x23, 0x03, 0x6D, 0x20, 0xEE, 0x9F, 0x21, 0x0B, 0xB2, 0x18, 0x50, 0x33, 0xE0,
+    0x8B, 0x86, 0x29, 0x8A, 0x5D, 0xC4, 0x2D, 0x48, 0x7E, 0xA7, 0x23, 0xFE, 0x9D, 0xDE, 0x31, 0x56,
+    0x20, 0xB1, 0x1A, 0x88, 0xE5, 0x78, 0x8B, 0xFB, 0x91, 0x9B, 0x3F, 0x24, 0x18, 0x0F, 0x36, 0xB1,
+    0xA2, 0xAB, 0x6F, 0x7E, 0x4E, 0x20, 0x7F, 0xC5, 0x1F, 0x2A, 0x28, 0xBE, 0xC7, 0xD2, 0x1E, 0x2F,
+    0xB0, 0xB7, 0xE6, 0x2A, 0xCB, 0xD0, 0x6D, 0x10, 0x85, 0xEF, 0xEA, 0xC5, 0x5E, 0x3E, 0x5A, 0x51,
+    0x3A, 0xE5, 0xEE, 0x9F, 0x70, 0xEF, 0x41, 0xAF, 0xCB, 0x46, 0xC8, 0x80, 0x01, 0x91, 0x8A, 0xF6,
+    0xEE, 0xE6, 0xE2, 0x89, 0x20, 0x2F, 0x31, 0x28, 0xB4, 0x38, 0x84, 0xDE, 0xFF, 0x42, 0x22, 0x62,
+    0x91, 0xA9, 0x0C, 0x13, 0x7F, 0x01, 0x4C, 0xCB, 0x5F, 0x21, 0xF1, 0x17, 0x16, 0xB4, 0x5C, 0x1E,
+    0xB0, 0x7C, 0x77, 0x51, 0x08, 0x23, 0xEE, 0x8E, 0x00, 0x4B, 0x9D, 0x13, 0x29, 0x83, 0xC0, 0xB5,
+    0x86, 0x70, 0xC2, 0x29, 0x59, 0x19, 0x59, 0xFB, 0xE4, 0xA1, 0xDF, 0xC5, 0x52, 0x2F, 0x4D, 0xC6,
+    0x9A, 0x4A, 0x31, 0x74, 0xDA, 0x57, 0xA8, 0xF5, 0xF8, 0xA1, 0x5E, 0x9E, 0x5C, 0x7F, 0x01, 0x50,
+    0xFA, 0x9C, 0x43, 0x1A, 0x58, 0x2C, 0x47, 0xC9, 0x36, 0x0B, 0xE0, 0x01, 0x20, 0x2A, 0x7C, 0xD1,
+    0xF1, 0x1F, 0xB5, 0xB9, 0x2E, 0xEA, 0xEC, 0x29, 0xCE, 0x09, 0x74, 0xD6, 0x68, 0x95, 0xB1, 0x9A,
+    0x45, 0xBF, 0x1F, 0x96, 0x77, 0x55, 0x5E, 0x98, 0xE2, 0xDC, 0xE8, 0xC5, 0x31, 0xD5, 0x29, 0x14,
+    0x6A, 0x41, 0x7E, 0x10, 0xC9, 0x75, 0x2C, 0x04, 0x70, 0x5D, 0x2F, 0xA5, 0x72, 0x0F, 0xF4, 0x4C,
+    0xE4, 0xF1, 0xF9, 0xC1, 0x13, 0x39, 0x3A, 0x3B, 0x7C, 0x22, 0x3E, 0x03, 0x7D, 0x88, 0x7E, 0x11,
+    0xBB, 0xD5, 0x1B, 0x68, 0x61, 0xF3, 0xA9, 0xD9, 0x76, 0xFA, 0x19, 0xBE, 0x30, 0xFA, 0x0B, 0xE0,
+    0x93, 0x86, 0x9D, 0xFE, 0xA6, 0x66, 0xC5, 0x32, 0x90, 0xF5, 0x46, 0x9B, 0x4C, 0xD9, 0x53, 0x97,
+    0xED, 0xAD, 0xF6, 0x7B, 0x62, 0x2C, 0xBB, 0xA8, 0xF4, 0x51, 0x20, 0x2B, 0xA4, 0x50, 0x87, 0xB2,
+    0xAC, 0xB4, 0x86, 0xF6, 0xEF, 0xEE, 0xCA, 0x0D, 0x71, 0x91, 0xE3, 0x22, 0x03, 0x92, 0x59, 0x52,
+    0x2D, 0xBD, 0xCB, 0x4D, 0x56, 0xCD, 0x65, 0xA1, 0xD7, 0x17, 0x9A, 0x03, 0x16, 0xE2, 0xE5, 0xB7,
+    0x64, 0x2A, 0xE1, 0x25, 0xD0, 0xCD, 0x2D, 0x16, 0x7A, 0x05, 0x0D, 0xA9, 0xB8, 0xC1, 0x8E, 0x52,
+    0x1D, 0xB1, 0xBD, 0x7C, 0x24, 0x20, 0xA0, 0xED, 0x64, 0x97, 0xE4, 0x88, 0xEA, 0x44, 0xEF, 0x01,
+    0x0E, 0x7A, 0x45, 0xB2, 0x9C, 0xB9, 0xE8, 0x0A, 0x6B, 0x32, 0x40, 0x96, 0xAC, 0xBA, 0x8F, 0xC8,
+    0xD9, 0x4E, 0x50, 0x6E, 0x03, 0x5E, 0x67, 0x88, 0x0E, 0x62, 0xE6, 0x6B, 0x09, 0xFD, 0x00, 0xE5,
+    0x8C, 0x58, 0xD8, 0xA6, 0xF0, 0x1A, 0x72, 0x0C, 0x2F, 0xF3, 0x6E, 0x0B, 0x2F, 0xD0, 0x87, 0x43,
+    0x42, 0x29, 0x35, 0xF9, 0xD1, 0x6A, 0xB2, 0xA9, 0xD1, 0xD4, 0x64, 0x83, 0x6F, 0x41, 0xDF, 0x0C,
+    0x3F, 0x82, 0x60, 0x86, 0x78, 0xF8, 0xA3, 0x1C, 0x9D, 0x03, 0xFF, 0x43, 0xB9, 0x0F, 0xC6, 0x3A,
+    0x37, 0x52, 0x92, 0xC4, 0x4E, 0xE1, 0x97, 0xA1, 0x29, 0xDC, 0xDC, 0x7B, 0xDB, 0x91, 0x8E, 0x05,
+    0x6F, 0x23, 0x50, 0xD4, 0xA9, 0x86, 0x6C, 0x16, 0xAA, 0x33, 0xD3, 0x40, 0xBC, 0x41, 0x62, 0xF6,
+    0x94, 0xCD, 0xF3, 0xFC, 0x36, 0x8B, 0xB9, 0x5A, 0x57, 0xD9, 0xE5, 0x3C, 0x88, 0x3C, 0x5D, 0x01,
+    0xDF, 0x6F, 0x6E, 0x42, 0xF1, 0x50, 0xF6, 0x46, 0xF1, 0xA1, 0xA1, 0xDE, 0x84, 0x7A, 0x03, 0x29,
+    0x14, 0xA0, 0xC9, 0x30, 0xDA, 0x7A, 0x1E, 0xA0, 0xCC, 0xBF, 0xF1, 0xC6, 0xFE, 0x0E, 0x82, 0xDD,
+    0xEB, 0x44, 0x6A, 0xC1, 0xC9, 0xC0, 0xA2, 0x91, 0xA0, 0x8A, 0x98, 0x0C, 0x3D, 0xB0, 0x2E, 0x22,
+    0xFF, 0x97, 0x41, 0xAF, 0xF0, 0xD0, 0x4F, 0x74, 0x20, 0xB8, 0x77, 0x47, 0xBD, 0x47, 0x92, 0xCE,
+    0xD2, 0x76, 0x12, 0x60, 0x3B, 0x4D, 0x0A, 0x22, 0x6B, 0x0B, 0x00, 0x11, 0x46, 0x94, 0xC1, 0xB2,
+    0xFF, 0x34, 0x23, 0x03, 0xDF, 0xCB, 0xD3, 0x7A, 0x86, 0xF7, 0x0F, 0x80, 0x8A, 0xD7, 0xDA, 0xAF,
+    0xE8, 0x3B, 0x1B, 0xCD, 0x5A, 0xE5, 0xB7, 0x09, 0x27, 0x71, 0x13, 0xBD, 0x62, 0xA5, 0xBD, 0xD0,
+    0xC2, 0x3B, 0x07, 0xEA, 0xE7, 0x9A, 0x9D, 0xDE, 0xB3, 0xB2, 0xA8, 0x76, 0xE7, 0xF5, 0x57, 0x4D,
+    0xE6, 0x96, 0x62, 0x08, 0x41, 0xFF, 0x98, 0x9A, 0x37, 0x7A, 0xB3, 0x8A, 0x7A, 0xF5, 0xD1, 0xBE,
+    0xD4, 0x3F, 0x73, 0xB5, 0xBA, 0x3C, 0xF4, 0xFE, 0xB9, 0x7E, 0x89, 0xDA, 0xB9, 0x2B, 0xF4, 0xFF,
+    0xB3, 0xEC, 0x53, 0xBB, 0x94, 0xE6, 0x3E, 0xF8, 0x41, 0x3E, 0x38, 0xC7, 0xB1, 0x81, 0x5A, 0xA2,
+    0xA6, 0x30, 0x71, 0xF0, 0xD3, 0x32, 0x2C, 0x14, 0x0F, 0x8A, 0x60, 0xA9, 0x7C, 0x30, 0x13, 0x0A,
+    0x1F, 0xA0, 0x43, 0x89, 0x06, 0x1F, 0xBB, 0xE2, 0xE8, 0x45, 0xAB, 0xF5, 0xFE, 0x38, 0x29, 0x46,
+    0xAF, 0x7F, 0xFD, 0x04, 0x6F, 0xDA, 0xE8, 0x12, 0x30, 0x91, 0x40, 0xD4, 0x55, 0xD1, 0xF5, 0xC9,
+    0x5C, 0x68, 0x2B, 0x5A, 0x86, 0x0D, 0xDF, 0x14, 0x1F, 0x74, 0xA9, 0x1C, 0x15, 0x25, 0x26, 0xF6,
+    0xB4, 0x09, 0xA1, 0x2D, 0xF4, 0x82, 0xF8, 0x40, 0xE0, 0x47, 0xD8, 0xC4, 0x10, 0x7D, 0xA2, 0x2D,
+    0x30, 0x90, 0xA3, 0x99, 0x5A, 0x06, 0x6B, 0xEF, 0x8E, 0x16, 0xEC, 0x1C, 0x96, 0xBD, 0x99, 0xF1,
+    0xC8, 0x00, 0x02, 0x3A, 0xDD, 0x6C, 0xF4, 0xF8, 0x51, 0xDE, 0xA3, 0x0D, 0x00, 0xD9, 0xF3, 0x1C,
+    0x1D, 0x09, 0x29, 0x19, 0x42, 0x83, 0x02, 0x0D, 0xCF, 0x0A, 0xCC, 0xE0, 0x75, 0x88, 0x30, 0x62,
+    0x9F, 0x1A, 0x1C, 0x8C, 0x54, 0x14, 0xE6, 0x62, 0xD0, 0x01, 0xC9, 0xC4, 0xC3, 0x73, 0x79, 0x7C,
+    0x26, 0xFF, 0xFB, 0xF5, 0x1F, 0xB5, 0x55, 0xB1, 0x6E, 0xE6, 0x44, 0x10, 0x1E, 0xDB, 0xBA, 0x18,
+    0x9D, 0x8B, 0xED, 0x2F, 0x85, 0x6B, 0x90, 0xD0, 0xBE, 0x00, 0xC7, 0x9A, 0x50, 0x52, 0x90, 0x82,
+    0x2B, 0x78, 0x05, 0x84, 0xF4, 0xBF, 0x00, 0xC8, 0xA6, 0xBA, 0x36, 0x05, 0x34, 0x34, 0x34, 0x87,
+    0x44, 0x94, 0xE2, 0xDA, 0x2B, 0x38, 0x76, 0x3B, 0x4A, 0xFC, 0x06, 0xB7, 0x42, 0x69, 0xAE, 0x5B,
+    0x24, 0x23, 0x39, 0x61, 0xBD, 0xC3, 0x37, 0xE3, 0x5F, 0x49, 0x1A, 0xA4, 0x6B, 0x70, 0xF4, 0x8F,
+    0x63, 0xEF, 0xEE, 0xCC, 0x37, 0xDF, 0x7C, 0x33, 0x26, 0x22, 0xFA, 0x12, 0xBF, 0xAA, 0x8C, 0x8C,
+    0x9B, 0x65, 0xCE, 0x44, 0x35, 0x33, 0x47, 0x22, 0xC7, 0xC3, 0x48, 0xD4, 0x70, 0x68, 0x12, 0xD1,
+    0xB8, 0x90, 0x23, 0xEA, 0x98, 0xE4, 0x01, 0xAB, 0x58, 0x31, 0x99, 0xBA, 0x48, 0x15, 0x07, 0xDA,
+    0xB0, 0x79, 0xA3, 0x31, 0x60, 0x33, 0xF3, 0x4A, 0xE4, 0x71, 0xC3, 0x3A, 0x6C, 0x50, 0x67, 0x0B,
+    0xD6, 0xFF, 0x11, 0xCF, 0x6D, 0x39, 0x79, 0x8B, 0x30, 0x78, 0x8D, 0xAB, 0xCF, 0x62, 0x1B, 0x1E,
+    0xE4, 0x36, 0x26, 0xB1, 0x66, 0x13, 0x7B, 0x5C, 0xB7, 0xAB, 0xD8, 0x8A, 0x1E, 0x5C, 0x87, 0x15,
+    0x10, 0x0A, 0x90, 0x6D, 0xC4, 0x25, 0xD7, 0x3C, 0x51, 0x83, 0x13, 0x1D, 0x36, 0x1A, 0xC4, 0xE8,
+    0xE1, 0xC3, 0xC5, 0xE3, 0x4F, 0xFE, 0x5F, 0x3E, 0x94, 0x8C, 0x04, 0x48, 0x68, 0x99, 0x67, 0x1A,
+    0x8B, 0x82, 0xCA, 0x23, 0xCC, 0x9F, 0xF8, 0xF1, 0xE7, 0x6F, 0xFD, 0x8F, 0x59, 0x7D, 0x90, 0x11,
+    0x00, 0x48, 0x81, 0xEA, 0x42, 0xBB, 0x3B, 0x1A, 0x67, 0xE1, 0x82, 0x34, 0x53, 0x3C, 0x45, 0x79,
+    0x1A, 0x8E, 0x4F, 0xE2, 0x5F, 0xE2, 0xD3, 0xE3, 0x4B, 0xCD, 0x65, 0x11, 0x2F, 0x66, 0x15, 0x2C,
+    0x58, 0x07, 0x92, 0x6E, 0x13, 0x1C, 0x6D, 0xD9, 0x69, 0x21, 0x1C, 0x6C, 0xF8, 0xAC, 0xC8, 0xA1,
+    0xE7, 0x38, 0x5F, 0xF1, 0x1F, 0x92, 0x1D, 0x73, 0x52, 0x8B, 0x40, 0x20, 0x6D, 0x92, 0x28, 0x12,
+    0x8F, 0x5C, 0x51, 0xAB, 0x04, 0xB9, 0x45, 0x6D, 0xBC, 0x23, 0xE6, 0x54, 0x36, 0xF6, 0xBC, 0xD7,
+    0x4B, 0xB1, 0x08, 0xC1, 0xB0, 0xB2, 0x38, 0xAE, 0x0F, 0xF9, 0xA2, 0x5E, 0xAD, 0xD4, 0x8C, 0x6A,
+    0x2F, 0x71, 0xA4, 0x1C, 0xD8, 0xC8, 0xB7, 0x7C, 0xC5, 0x70, 0xDD, 0x47, 0xB3, 0xB4, 0xB9, 0xDE,
+    0xC8, 0x0F, 0x78, 0x0C, 0x1D, 0x5E, 0x34, 0x99, 0xF8, 0x0C, 0x2F, 0xA6, 0x3E, 0xD9, 0x60, 0x96,
+    0x86, 0xE5, 0x05, 0xF9, 0x68, 0x53, 0x9F, 0xC6, 0x5C, 0xC9, 0x79, 0x1E, 0x84, 0x46, 0xA8, 0xC0,
+    0xEE, 0xC5, 0x3D, 0x30, 0x5F, 0x23, 0x42, 0xBB, 0xEC, 0xD5, 0x53, 0xAB, 0x7C, 0x42, 0x57, 0xFA,
+    0x60, 0x67, 0x85, 0xB1, 0x3D, 0x40, 0xD6, 0x65, 0x6A, 0x37, 0x79, 0x25, 0xD4, 0xB1, 0x70, 0x5D,
+    0x71, 0x25, 0xF4, 0xF2, 0x73, 0x39, 0xE3, 0xDF, 0xAC, 0x9A, 0x53, 0x54, 0x2B, 0xCC, 0xF4, 0xEA,
+    0xD7, 0xAA, 0x0F, 0x4D, 0x1E, 0x62, 0x1B, 0x54, 0x65, 0xC8, 0xDB, 0xAD, 0x2C, 0x52, 0x8C, 0x3E,
+    0x51, 0xCB, 0x13, 0x48, 0xE8, 0x8B, 0x48, 0xF2, 0x83, 0x5F, 0xE8, 0xC9, 0xA5, 0x90, 0x57, 0xB1,
+    0xC4, 0xF1, 0x01, 0x51, 0x5D, 0x44, 0x38, 0xD4, 0x97, 0x27, 0x24, 0xE6, 0x82, 0xAC, 0x24, 0x64,
+    0x8B, 0xC2, 0xB9, 0x59, 0x6A, 0x98, 0x90, 0x40, 0x9B, 0x51, 0x36, 0x08, 0xC1, 0x46, 0x10, 0x83,
+    0xBD, 0x2E, 0x34, 0xE5, 0xAB, 0x97, 0xA8, 0xA2, 0x90, 0x27, 0xEA, 0x99, 0x25, 0xF3, 0x64, 0x76,
+    0xB9, 0xCB, 0x76, 0xC0, 0x11, 0xD8, 0x9A, 0x01, 0x3D, 0x1B, 0xA8, 0x9E, 0x1E, 0x57, 0xA9, 0x0D,
+    0xAF, 0xEA, 0xF4, 0x11, 0xAD, 0x3D, 0x7D, 0xDB, 0x0D, 0xB6, 0x09, 0x7D, 0x58, 0x6C, 0x72, 0xBC,
+    0x1A, 0xE8, 0xD7, 0xFF, 0x04, 0x0E, 0x20, 0x0D, 0xC0, 0x06, 0x6D, 0xBF, 0x8A, 0xA2, 0x1E, 0x9D,
+    0xBB, 0xB9, 0x2D, 0x0D, 0xC3, 0x9D, 0x0F, 0x6E, 0xF6, 0xC1, 0xE4, 0x36, 0x03, 0x17, 0x4F, 0x3E,
+    0xF0, 0xD0, 0x2F, 0x66, 0x35, 0x09, 0x7A, 0xE4, 0x4F, 0x50, 0x2A, 0x14, 0xC3, 0xC6, 0xA6, 0x54,
+    0x0C, 0xC8, 0xE3, 0x6C, 0x23, 0x6A, 0x97, 0x9B, 0x0D, 0x27, 0x79, 0x72, 0xC1, 0x4F, 0xA8, 0xEA,
+    0xDA, 0x2D, 0x15, 0xFF, 0x80, 0x3F, 0xAD, 0x12, 0x27, 0xE9, 0x4D, 0xED, 0x1D, 0x81, 0xDF, 0x8A,
+    0xCD, 0xFF, 0x63, 0xD0, 0x17, 0x1A, 0x94, 0x35, 0x28, 0x27, 0x0D, 0xBA, 0x69, 0xD0, 0x63, 0xEF,
+    0xAF, 0x7B, 0xEF, 0xD3, 0x7D, 0xEF, 0x77, 0x77, 0xBD, 0x3F, 0x72, 0xA8, 0xC1, 0xD0, 0xC9, 0x55,
+    0x52, 0x8A, 0xE8, 0x63, 0xBC, 0xC6, 0xFE, 0x16, 0x22, 0xB3, 0x90, 0x5B, 0x79, 0x99, 0xDA, 0x68,
+    0x82, 0x1D, 0x1C, 0xE5, 0x3A, 0x37, 0xE9, 0x10, 0xA5, 0x19, 0x3C, 0x43, 0xAA, 0xE5, 0x5E, 0x5F,
+    0xDF, 0xDF, 0x6B, 0x11, 0x22, 0x7C, 0x1F, 0x76, 0xA3, 0xA7, 0xE8, 0x82, 0x4C, 0xDF, 0x20, 0xF0,
+    0x2A, 0x8C, 0x37, 0x8B, 0xBA, 0x4D, 0x84, 0x02, 0x74, 0xA9, 0xBE, 0xBD, 0x20, 0x13, 0xC5, 0x87,
+    0x99, 0x01, 0x7B, 0xEA, 0x43, 0x3B, 0xDB, 0x80, 0x14, 0x83, 0x81, 0x45, 0xBC, 0x30, 0x4E, 0xE6,
+    0x3B, 0x1E, 0xFC, 0x20, 0xE1, 0x78, 0x70, 0x8C, 0x66, 0x00, 0x9D, 0xB3, 0x8E, 0x08, 0xAA, 0x7F,
+    0x23, 0x7A, 0x84, 0x5B, 0x54, 0xBC, 0xED, 0xAC, 0x35, 0x35, 0x41, 0x91, 0xF7, 0x7C, 0x81, 0xBE,
+    0x9B, 0xDC, 0x55, 0x6E, 0xA2, 0x99, 0x5F, 0xD3, 0x66, 0x20, 0x85, 0x7C, 0x9A, 0xE1, 0xE8, 0x0C,
+    0xC5, 0xD8, 0x55, 0x7E, 0xBC, 0xFC, 0xB5, 0xC8, 0x1B, 0x53, 0xE4, 0xBA, 0x8F, 0x34, 0xCB, 0xD0,
+    0x15, 0xB4, 0xA8, 0x14, 0x7A, 0xA0, 0x5D, 0x45, 0xEE, 0x53, 0xAD, 0x4D, 0xA7, 0xB9, 0xB9, 0xF8,
+    0x1E, 0xE6, 0x68, 0x75, 0xEB, 0x05, 0x8F, 0x40, 0xC1, 0x40, 0xA9, 0xC5, 0xC5, 0xC3, 0xEB, 0xA4,
+    0x0C, 0xF4, 0xBA, 0x01, 0xA3, 0x26, 0xC8, 0x7A, 0x76, 0x7F, 0x8F, 0x43, 0xFF, 0xD9, 0x5A, 0xAF,
+    0x75, 0x2A, 0xD4, 0x4F, 0xEE, 0x10, 0xAA, 0xB5, 0x81, 0x4B, 0x3B, 0x60, 0xFA, 0xD4, 0xA9, 0x03,
+    0x1C, 0x87, 0xF9, 0x8A, 0xE9, 0x6E, 0xDE, 0x44, 0xDA, 0xAA, 0x84, 0xF6, 0x0C, 0xD6, 0x14, 0xBF,
+    0x36, 0x51, 0x26, 0xFB, 0x53, 0x19, 0xA6, 0x6D, 0x90, 0x5A, 0xBC, 0xA2, 0xC3, 0x72, 0x17, 0xE7,
+    0xD9, 0x39, 0x32, 0xCD, 0xA2, 0x30, 0xB2, 0x93, 0x99, 0x41, 0xE3, 0x02, 0x8A, 0x0B, 0x3E, 0x0F,
+    0x0E, 0xFA, 0x30, 0xA9, 0x2B, 0x57, 0x59, 0x5A, 0x48, 0x92, 0x10, 0x05, 0x2E, 0x4D, 0x3E, 0x2D,
+    0x35, 0xE4, 0x34, 0xA1, 0x65, 0xD3, 0x18, 0xFB, 0x6C, 0xD7, 0x96, 0x0D, 0xC6, 0xC0, 0xEF, 0xE8,
+    0xB2, 0x3B, 0xBF, 0x7B, 0xF7, 0x0B, 0x07, 0x3A, 0x70, 0xD1, 0xEB, 0x2A, 0x9D, 0x89, 0xDE, 0xFD,
+    0xAA, 0xFC, 0x85, 0xE8, 0xA7, 0xC8, 0x17, 0x0C, 0xD9, 0x75, 0xA5, 0xD2, 0xE9, 0x63, 0x07, 0xB4,
+    0x35, 0xC7, 0x4A, 0xDB, 0x58, 0xBB, 0x43, 0x7A, 0x7B, 0xB0, 0xE5, 0xF2, 0x8B, 0x7D, 0x7E, 0xED,
+    0x13, 0x0B, 0x27, 0xBE, 0xD6, 0xBE, 0x21, 0x51, 0xF0, 0x44, 0x3A, 0xFA, 0x8C, 0xCE, 0xEE, 0x43,
+    0x91, 0x7E, 0xEF, 0x16, 0x19, 0x70, 0xFC, 0xE9, 0x26, 0xDF, 0x20, 0x9D, 0xF7, 0xF2, 0x8D, 0x18,
+    0xFF, 0x82, 0x96, 0x4F, 0x2E, 0x9F, 0xBC, 0x78, 0x07, 0x80, 0xA7, 0x37, 0x3A, 0xE1, 0xD6, 0x23,
+    0x40, 0x24, 0x3A, 0xCA, 0xF7, 0xA7, 0x5E, 0xC8, 0xDC, 0x5C, 0xF1, 0xB4, 0x23, 0x14, 0x08, 0x53,
+    0xAB, 0x23, 0xD7, 0xDF, 0xFE, 0x7C, 0x7E, 0x1C, 0xB1, 0x3A, 0x71, 0x4C, 0xA1, 0x93, 0x40, 0xDA,
+    0xD3, 0x3B, 0x46, 0xA7, 0x93, 0x49, 0xBF, 0xC3, 0x95, 0xBF, 0xF9, 0xCF, 0xB8, 0xFF, 0x02, 0xC5,
+    0x55, 0xB1, 0xAE, 0xDD, 0x44, 0x10, 0x1D, 0xAF, 0xC5, 0xB3, 0x14, 0x17, 0x5B, 0xBD, 0x2A, 0x85,
+    0x3B, 0x4A, 0xFC, 0x05, 0x2F, 0x6B, 0xD2, 0xD0, 0xBE, 0x82, 0x5B, 0xD3, 0xD3, 0xE4, 0x0B, 0x82,
+    0x0D, 0xFC, 0x40, 0x1A, 0xF8, 0x82, 0x34, 0x79, 0x29, 0x1E, 0x25, 0x42, 0x24, 0x5E, 0xD1, 0xD0,
+    0x5A, 0x7C, 0xC1, 0x76, 0x48, 0x54, 0x06, 0x39, 0x91, 0xDF, 0xC3, 0xF6, 0xE4, 0x9C, 0xF1, 0xBD,
+    0x2F, 0xA0, 0x80, 0x04, 0xA2, 0x60, 0x75, 0xEF, 0xC8, 0x7B, 0x77, 0x3D, 0x73, 0x66, 0xE6, 0x9C,
+    0xB9, 0x22, 0x7D, 0x27, 0x22, 0xDA, 0x88, 0x64, 0xFA, 0xBC, 0x13, 0x55, 0x3C, 0xC2, 0x60, 0xB7,
+    0x5D, 0x8A, 0x94, 0x33, 0x0E, 0xFD, 0x08, 0x53, 0xBD, 0xD6, 0x27, 0x52, 0xAB, 0x4E, 0x12, 0x54,
+    0x17, 0x69, 0xF5, 0x7A, 0x91, 0x7E, 0x72, 0x8B, 0x68, 0x74, 0x4B, 0xA6, 0x9D, 0x5B, 0x9C, 0x4A,
+    0x3E, 0xE7, 0x34, 0xC5, 0x26, 0xE5, 0x54, 0xAE, 0x78, 0xD1, 0x2F, 0x52, 0x8D, 0xD5, 0x22, 0x61,
+    0xAC, 0x67, 0x09, 0x29, 0xCC, 0xD2, 0x0F, 0xED, 0x24, 0x3A, 0xF4, 0xD3, 0xFB, 0x1A, 0xCF, 0xBE,
+    0x09, 0x1A, 0x45, 0x7A, 0x1A, 0xBD, 0x33, 0xBD, 0x02, 0xD1, 0xD9, 0x8D, 0xFC, 0x69, 0xBD, 0xC0,
+    0xB7, 0x24, 0x8E, 0x16, 0xDF, 0x9C, 0xA8, 0x02, 0xAE, 0xBA, 0xF5, 0x78, 0x6C, 0x98, 0x00, 0x7B,
+    0x2C, 0x60, 0xBA, 0xFA, 0xF6, 0xEA, 0x99, 0xD0, 0x55, 0xBE, 0xE1, 0xAC, 0x9E, 0x98, 0x20, 0x77,
+    0xCA, 0x3C, 0x16, 0x98, 0x3E, 0x71, 0x87, 0x9C, 0x3D, 0x77, 0xED, 0xC8, 0x1D, 0x2E, 0x78, 0x5E,
+    0x07, 0x3C, 0xC9, 0xAE, 0x3A, 0x73, 0xFB, 0x1E, 0xAE, 0x54, 0x38, 0x29, 0x51, 0x10, 0xB7, 0x21,
+    0xD9, 0x5E, 0x7C, 0xAC, 0xA2, 0xBC, 0x70, 0x86, 0x40, 0x37, 0x9E, 0x0C, 0xB2, 0x1D, 0x3E, 0x16,
+    0x3F, 0x58, 0x19, 0xEB, 0xD1, 0xB3, 0x7A, 0xF8, 0x0E, 0x78, 0x40, 0xCE, 0x0A, 0x88, 0x8F, 0xEE,
+    0x92, 0xC9, 0xFA, 0xDB, 0x86, 0x55, 0x14, 0xA7, 0xCF, 0x27, 0xF1, 0x49, 0x1A, 0x4B, 0x28, 0x23,
+    0x8C, 0x7C, 0x43, 0xB4, 0x12, 0xEF, 0xC0, 0x60, 0xEF, 0x68, 0x76, 0xF0, 0x6D, 0x72, 0x43, 0xAE,
+    0x5D, 0xB8, 0xED, 0x97, 0x1C, 0x9E, 0x13, 0xB2, 0xDD, 0xD0, 0x01, 0x44, 0xBE, 0xAF, 0x4F, 0x4F,
+    0xAE, 0x43, 0x92, 0x02, 0xB1, 0xF0, 0x23, 0x52, 0x74, 0x00, 0x1D, 0x16, 0xC9, 0x0E, 0xCD, 0x1F,
+    0x6A, 0xF8, 0x41, 0x27, 0x39, 0x7C, 0xB6, 0x1D, 0xBA, 0x83, 0x8B, 0xD6, 0xD8, 0x0C, 0x29, 0xD7,
+    0x83, 0xFD, 0x8E, 0x82, 0x16, 0xB3, 0x51, 0xC1, 0x4F, 0x68, 0x3F, 0x7E, 0x1F, 0xAD, 0x64, 0x6D,
+    0x92, 0xB3, 0x97, 0x78, 0xFD, 0x99, 0x7B, 0x5A, 0xCE, 0x75, 0x0A, 0x49, 0x3F, 0xD7, 0x8F, 0x56,
+    0xBF, 0x86, 0xB1, 0xFD, 0x95, 0x55, 0x7B, 0xBB, 0xBE, 0x13, 0x73, 0x54, 0xA1, 0xBA, 0x7D, 0x63,
+    0x8F, 0xA4, 0x0E, 0xE2, 0xB1, 0x4F, 0x7C, 0x44, 0x08, 0x06, 0x84, 0x7F, 0x09, 0x83, 0xC5, 0x28,
+    0x19, 0x18, 0x30, 0xD0, 0x73, 0x0B, 0xC2, 0x3A, 0x30, 0xE5, 0x9A, 0x8E, 0xD9, 0xAF, 0x82, 0x55,
+    0x08, 0xA3, 0xFC, 0xD5, 0xCA, 0x68, 0x2A, 0x9E, 0x21, 0x9C, 0xC5, 0xDB, 0xB9, 0x8A, 0x88, 0xE2,
+    0xFE, 0xD1, 0x2E, 0xBC, 0x73, 0x96, 0xAF, 0xC7, 0x78, 0x81, 0x34, 0x64, 0x0F, 0x4A, 0x4D, 0xDC,
+    0xE1, 0xE7, 0x4F, 0x9F, 0x30, 0x20, 0x28, 0x46, 0xBE, 0xF0, 0x78, 0xBB, 0x06, 0xCC, 0x8B, 0x0C,
+    0xB7, 0x2B, 0x41, 0xE9, 0x7C, 0xBC, 0xC0, 0xC9, 0x50, 0x69, 0x97, 0x8D, 0xEC, 0xE1, 0x92, 0xBF,
+    0x6A, 0x9B, 0x0B, 0x99, 0x8B, 0xA1, 0x96, 0xC7, 0x6E, 0xF2, 0xB1, 0x76, 0x4B, 0x91, 0xBC, 0x6E,
+    0x7E, 0xC4, 0xFB, 0xC5, 0xEC, 0x74, 0x35, 0x22, 0x9D, 0xD6, 0xB9, 0xE5, 0xD3, 0xDD, 0x43, 0xCC,
+    0x21, 0x8F, 0x92, 0x8F, 0xF4, 0x3C, 0xCB, 0xB7, 0x22, 0x8F, 0x05, 0x9E, 0xEB, 0x5F, 0xA0, 0x55,
+    0xD2, 0x6B, 0x20, 0x0B, 0x34, 0x9B, 0xE4, 0xE6, 0x93, 0xF8, 0x3D, 0x3D, 0x07, 0xA9, 0x65, 0xF1,
+    0x9D, 0x8F, 0x7D, 0xC1, 0xB3, 0x2F, 0xC6, 0x0C, 0xF0, 0xC0, 0x56, 0x6D, 0x1E, 0x1C, 0x5D, 0xFF,
+    0x2F, 0x2A, 0x8F, 0xFD, 0x94, 0x51, 0xE5, 0xD9, 0xE5, 0xDB, 0x1C, 0x4B, 0xEA, 0xA4, 0x18, 0x4F,
+    0xC6, 0xA4, 0x6C, 0x9D, 0xBB, 0xD3, 0xF2, 0xBE, 0xDA, 0x87, 0xA8, 0x72, 0xF8, 0x01, 0xA6, 0xFA,
+    0x89, 0x54, 0xFD, 0x0D, 0xA6, 0x78, 0x0D, 0xE3, 0x36, 0xB6, 0x82, 0x3D, 0x90, 0x9E, 0x7A, 0x0D,
+    0xA6, 0x71, 0x13, 0x33, 0x60, 0xB3, 0x3B, 0xA0, 0xDE, 0xAA, 0xA4, 0x70, 0xC5, 0x2C, 0xBF, 0x64,
+    0x32, 0x31, 0xF0, 0x82, 0x78, 0xAB, 0x36, 0x3B, 0xB7, 0xCF, 0x01, 0x67, 0xFC, 0xAD, 0x17, 0xF9,
+    0xFB, 0x05, 0x6C, 0x7E, 0x01, 0x69, 0x31, 0x1B, 0xFA, 0xC6, 0x6B, 0x13, 0x62, 0xA9, 0xD1, 0xA3,
+    0xBD, 0x63, 0x31, 0x43, 0xAC, 0x6E, 0x2D, 0xA1, 0x70, 0x2D, 0x00, 0x2A, 0xFC, 0xB8, 0x85, 0x58,
+    0xFD, 0xBC, 0x55, 0xA9, 0xFC, 0x5D, 0x3D, 0x6A, 0xA4, 0xF9, 0x8A, 0x3E, 0x80, 0xE5, 0x3D, 0x3E,
+    0x44, 0x10, 0xD0, 0xFB, 0xA6, 0x9A, 0x0A, 0x6D, 0xCA, 0x05, 0x23, 0xC6, 0x5D, 0xED, 0x4D, 0xCF,
+    0xD8, 0x16, 0x08, 0x3A, 0x1A, 0x7A, 0x96, 0x01, 0x4D, 0x1E, 0x2D, 0xAB, 0xCD, 0x18, 0xA1, 0x83,
+    0xB1, 0xBD, 0x91, 0x7F, 0xBB, 0x32, 0x64, 0x0D, 0xA1, 0x61, 0x0C, 0xBA, 0xCD, 0x86, 0x1D, 0xC5,
+    0x82, 0x91, 0xC2, 0x0A, 0xB4, 0xC9, 0xA4, 0xA5, 0x11, 0x17, 0x40, 0xE7, 0x87, 0x0C, 0x55, 0x6E,
+    0xA6, 0xA6, 0x6A, 0xB1, 0x12, 0x05, 0x9B, 0x40, 0xA2, 0x16, 0xDE, 0xED, 0x58, 0x0A, 0x03, 0x06,
+    0x80, 0x36, 0x20, 0xC3, 0x5E, 0xB9, 0x1D, 0x9F, 0x0D, 0xDB, 0x93, 0x56, 0xEF, 0xDB, 0x85, 0x56,
+    0xF7, 0x2A, 0x5B, 0x99, 0xBD, 0xA5, 0x26, 0x36, 0xF2, 0x81, 0x2C, 0xBD, 0x83, 0x16, 0x84, 0xD8,
+    0x38, 0x61, 0x07, 0x9F, 0x30, 0x10, 0x57, 0xCC, 0x80, 0x2A, 0xE6, 0x33, 0xC8, 0x17, 0x9A, 0xD0,
+    0x15, 0x23, 0xE6, 0xC2, 0x4B, 0x4C, 0x4B, 0x3F, 0x94, 0x49, 0x78, 0x5C, 0x45, 0x1F, 0x1D, 0x1A,
+    0x70, 0x68, 0x1B, 0x90, 0x95, 0x8A, 0x52, 0x0E, 0xC5, 0x24, 0x8E, 0x03, 0x24, 0x10, 0x11, 0xA1,
+    0x7C, 0x76, 0x72, 0x7F, 0xEF, 0x52, 0x6C, 0xE4, 0x9C, 0x3F, 0x7A, 0x75, 0xB0, 0x31, 0x8A, 0xCB,
+    0xE8, 0x1E, 0xC1, 0x71, 0x7C, 0x18, 0xFF, 0xED, 0x1F, 0x62, 0x32, 0xC8, 0x26, 0x81, 0xC4, 0x8B,
+    0x4D, 0xCB, 0x5E, 0x2F, 0xC0, 0xA3, 0xC0, 0x03, 0x0E, 0xF5, 0x1F, 0xF2, 0xAF, 0xA6, 0xA2, 0x06,
+    0x8F, 0x83, 0x9E, 0x5A, 0xD3, 0xC6, 0x59, 0xA9, 0x0E, 0xF0, 0x71, 0xC6, 0xB1, 0x5C, 0xA7, 0xA3,
+    0xE6, 0x8C, 0xDF, 0xFB, 0xAE, 0xA3, 0x6B, 0x7B, 0x45, 0xE5, 0xBC, 0xFF, 0xEA, 0x72, 0xAF, 0x9A,
+    0xD7, 0x1B, 0x16, 0x0B, 0xFA, 0xE2, 0xDF, 0x97, 0xD7, 0xAF, 0xC1, 0xA6, 0x31, 0x03, 0x7B, 0x90,
+    0x36, 0x02, 0x87, 0x58, 0xDF, 0x5C, 0x6F, 0x14, 0xEC, 0x44, 0x3C, 0xD1, 0x73, 0xFE, 0xD7, 0xE4,
+    0x48, 0x6D, 0x3A, 0xF8, 0x0F, 0xEB, 0x0D, 0xED, 0x55, 0x3D, 0x92, 0xEC, 0x34, 0x10, 0xEE, 0xB1,
+    0x0B, 0x1C, 0x38, 0x50, 0xB4, 0x04, 0x24, 0x3A, 0x82, 0x8F, 0x20, 0xF3, 0x93, 0x93, 0xEC, 0x04,
+    0x44, 0xE4, 0x24, 0x1C, 0xC1, 0x7E, 0x31, 0x01, 0x2F, 0xE1, 0x06, 0x1B, 0x50, 0x9B, 0x70, 0x82,
+    0x5D, 0x09, 0x5E, 0x48, 0x62, 0x8A, 0x0B, 0xB8, 0x08, 0x49, 0x9E, 0x8A, 0x32, 0x55, 0x06, 0x6C,
+    0x37, 0xDF, 0xD7, 0x9A, 0x99, 0x05, 0x02, 0x4E, 0x80, 0xAA, 0xA6, 0x7B, 0x46, 0x6A, 0x75, 0x7F,
+    0xFD, 0x75, 0xB7, 0x46, 0xE4, 0xEE, 0xEB, 0xF3, 0xF9, 0xD3, 0x7B, 0xA9, 0x94, 0x6B, 0x12, 0x67,
+    0x5A, 0x24, 0x50, 0x6D, 0x97, 0xED, 0x19, 0x7A, 0x11, 0xDD, 0x45, 0x6A, 0x9D, 0x9D, 0x26, 0x91,
+    0x46, 0x93, 0xAE, 0x22, 0xD2, 0xEA, 0x57, 0xDA, 0x43, 0xE3, 0x5A, 0x86, 0x12, 0xAF, 0x07, 0x55,
+    0xA3, 0x45, 0xC7, 0xA2, 0x71, 0xFA, 0x76, 0xE3, 0xCF, 0x9F, 0xD5, 0x2D, 0x38, 0x3D, 0xDC, 0xDA,
+    0xCD, 0x88, 0x91, 0xC3, 0x34, 0x24, 0xF8, 0xFE, 0x40, 0x4F, 0x08, 0xE9, 0xB7, 0x76, 0x6B, 0x60,
+    0xA6, 0x53, 0x98, 0x7D, 0x86, 0xEB, 0x93, 0xF6, 0xC3, 0x24, 0xC3, 0xE2, 0xB6, 0x4A, 0xFB, 0x5A,
+    0x53, 0xCC, 0x2D, 0xBC, 0xDD, 0xD1, 0xF1, 0xBD, 0x5C, 0x96, 0x07, 0xBC, 0x24, 0xCA, 0x38, 0x35,
+    0xE4, 0x22, 0xED, 0x5E, 0x03, 0x11, 0x02, 0x00, 0x8F, 0xFB, 0xF5, 0x30, 0x93, 0x49, 0xE4, 0xC4,
+    0xA4, 0xA4, 0xA3, 0xAC, 0xF6, 0xFD, 0x19, 0xBB, 0x3F, 0x65, 0xC4, 0x3A, 0xFC, 0x1B, 0x44, 0xCA,
+    0x4F, 0x2E, 0xC9, 0xF0, 0x51, 0x0E, 0x52, 0x6F, 0x3E, 0xED, 0xD2, 0x4D, 0x5A, 0xAF, 0xF2, 0xCE,
+    0x35, 0xC6, 0x35, 0x9A, 0xD7, 0xD1, 0x31, 0xE9, 0x01, 0x24, 0x80, 0x0B, 0x44, 0x05, 0x34, 0x72,
+    0xA2, 0x5B, 0xB7, 0x32, 0xE9, 0x4F, 0x8C, 0x05, 0x77, 0x34, 0xA4, 0x4C, 0x1C, 0x90, 0x90, 0x2B,
+    0xBF, 0xC3, 0xB2, 0x27, 0x57, 0x0B, 0xCD, 0x08, 0x62, 0x14, 0x43, 0x44, 0x2B, 0x72, 0x05, 0xD8,
+    0xF4, 0xFE, 0x87, 0x92, 0xA4, 0x70, 0x48, 0x67, 0x64, 0x2D, 0xC2, 0x28, 0x27, 0x18, 0x39, 0x63,
+    0x3E, 0x5D, 0x74, 0x6F, 0xBA, 0x35, 0xC6, 0x18, 0x0D, 0x57, 0xAE, 0x7A, 0x2D, 0x9A, 0xFE, 0x9C,
+    0xC2, 0x34, 0xD3, 0xED, 0x2F, 0x91, 0x04, 0x58, 0x61, 0xD3, 0x45, 0x5B, 0xE5, 0x94, 0x05, 0x35,
+    0xD6, 0xD6, 0x0B, 0x9C, 0x49, 0x2C, 0x3B, 0x2B, 0x9D, 0xBC, 0xAB, 0xAF, 0x6F, 0xE9, 0x83, 0x80,
+    0x4A, 0x53, 0x48, 0xB0, 0xDE, 0x5C, 0xA6, 0xED, 0x97, 0xB8, 0x83, 0x7C, 0x11, 0x78, 0xF8, 0x8E,
+    0x17, 0xBA, 0xB9, 0x3B, 0x98, 0xCB, 0x8F, 0x0F, 0x34, 0xD5, 0x92, 0x57, 0xA6, 0xFC, 0xF6, 0x60,
+    0x10, 0x89, 0xBC, 0x2C, 0x9E, 0x97, 0xC1, 0x32, 0xD2, 0x1B, 0x59, 0x73, 0xB8, 0x44, 0x07, 0x60,
+    0x17, 0xFD, 0xD0, 0xAE, 0x82, 0xEE, 0xA8, 0x0F, 0x69, 0xD9, 0x04, 0x89, 0xB5, 0x0E, 0x86, 0x95,
+    0x50, 0x47, 0x03, 0x98, 0x6C, 0x2B, 0x19, 0x6A, 0x72, 0xE8, 0x0F, 0xF9, 0xF7, 0x62, 0x63, 0x91,
+    0xBD, 0xCD, 0x94, 0xA5, 0x08, 0x75, 0xB0, 0x50, 0x28, 0x43, 0x4D, 0x64, 0x71, 0x16, 0xFA, 0x18,
+    0xB2, 0x04, 0x10, 0x15, 0x0A, 0xCF, 0x28, 0x4D, 0x0D, 0x9F, 0xA4, 0x94, 0x8C, 0x17, 0x56, 0x41,
+    0x22, 0x3F, 0x2D, 0x38, 0x07, 0xFF, 0x0D, 0x6F, 0xC5, 0x85, 0x95, 0x90, 0x6E, 0xAF, 0x58, 0xBD,
+    0x56, 0x5F, 0x31, 0x4B, 0x7C, 0xB7, 0x1A, 0xC6, 0xCD, 0x4A, 0xE8, 0x35, 0xEE, 0x2F, 0x53, 0x70,
+    0x2A, 0x84, 0x83, 0xD8, 0x82, 0xD9, 0x12, 0xE0, 0xA1, 0xD1, 0x7D, 0x19, 0x9C, 0x50, 0x94, 0xB3,
+    0x5A, 0x90, 0xE6, 0x7F, 0x66, 0xF5, 0xCC, 0x1B, 0xD6, 0xCC, 0x1B, 0x59, 0x7B, 0x80, 0x38, 0x24,
+    0x4A, 0xB5, 0x41, 0x34, 0x8B, 0xC4, 0x1E, 0x55, 0x89, 0x3D, 0xD8, 0x8C, 0x63, 0x1C, 0x65, 0x78,
+    0x85, 0xF3, 0xE1, 0x0D, 0x30, 0x0C, 0x3F, 0xB0, 0x42, 0x6F, 0xB3, 0x35, 0x2D, 0x85, 0x31, 0xD8,
+    0x53, 0x30, 0x28, 0x51, 0x06, 0x8B, 0x28, 0x77, 0x3D, 0x06, 0xC3, 0x0A, 0xD2, 0xAC, 0x80, 0xF8,
+    0x21, 0x70, 0x05, 0xE2, 0xF6, 0xF3, 0x75, 0xFF, 0x54, 0xC6, 0xA0, 0xFA, 0xC6, 0x10, 0x1A, 0xC0,
+    0x76, 0xBD, 0x4E, 0x9D, 0x32, 0x0F, 0x77, 0x93, 0xB3, 0xF8, 0xC5, 0xAA, 0x51, 0x92, 0x33, 0x39,
+    0x58, 0x65, 0x62, 0xC9, 0x3A, 0xDD, 0xE4, 0xC9, 0x64, 0x65, 0xDC, 0xD4, 0xF6, 0x98, 0x34, 0x46,
+    0x57, 0x6B, 0xD2, 0x1D, 0x2F, 0xD2, 0x5B, 0x31, 0x6D, 0x38, 0xAC, 0xE5, 0xE1, 0xD2, 0xB0, 0x0F,
+    0xCB, 0x95, 0xA6, 0xCF, 0xED, 0x88, 0xFE, 0x7C, 0x2E, 0xF0, 0x02, 0xBB, 0x9C, 0x88, 0x6C, 0xCE,
+    0xC6, 0x4A, 0x1F, 0x1F, 0x5F, 0x97, 0xB8, 0x81, 0x70, 0x3A, 0x5E, 0xB5, 0xDE, 0xB0, 0xCE, 0x28,
+    0x58, 0x22, 0x4F, 0xC2, 0xED, 0xC4, 0xE0, 0x58, 0xD1, 0xC5, 0x06, 0xD6, 0xC2, 0xBD, 0x6F, 0x2C,
+    0x58, 0xF6, 0x99, 0x13, 0xFD, 0xF7, 0x47, 0x68, 0xBD, 0x24, 0x1F, 0xD3, 0xCD, 0xEF, 0x17, 0xFB,
+    0xF9, 0x6C, 0x66, 0x1B, 0xCD, 0x34, 0x13, 0x0C, 0x32, 0x1E, 0xF2, 0x2D, 0x75, 0x7B, 0x51, 0x0A,
+    0x53, 0x95, 0xC5, 0x72, 0x96, 0x7F, 0x28, 0xB3, 0x39, 0xDD, 0x08, 0x29, 0x89, 0x1B, 0x90, 0xD6,
+    0xD8, 0xBA, 0xAC, 0x68, 0xAE, 0x37, 0x39, 0x1E, 0x1F, 0x4E, 0x30, 0xA9, 0xD6, 0x32, 0x2A, 0x68,
+    0xBA, 0xF4, 0xD9, 0x6F, 0x67, 0x71, 0x7C, 0x98, 0x70, 0xC9, 0xC3, 0x53, 0x97, 0x0A, 0x49, 0x61,
+    0xE4, 0x18, 0xC2, 0xD9, 0x8B, 0x9B, 0xCE, 0x5E, 0x01, 0xBD, 0xF2, 0x85, 0x89, 0xFC, 0xFD, 0x7C,
+    0xEE, 0x25, 0x4C, 0x86, 0xC2, 0xCA, 0x52, 0xE8, 0xB7, 0x5A, 0x96, 0x6A, 0x95, 0x8D, 0x3F, 0x99,
+    0x85, 0xDD, 0x6E, 0x8C, 0x8D, 0x4E, 0xB9, 0xA3, 0x98, 0x16, 0x52, 0x00, 0x23, 0x70, 0xC2, 0x26,
+    0x4D, 0x08, 0x8D, 0x19, 0xAF, 0x0E, 0xDB, 0x40, 0xEB, 0xA6, 0xF7, 0x34, 0xD5, 0x78, 0xEB, 0x51,
+    0xA6, 0xAD, 0x01, 0x99, 0xC3, 0xDC, 0x29, 0x28, 0xE8, 0x6F, 0xCF, 0x0F, 0x7A, 0xF3, 0x7C, 0x0F,
+    0xD7, 0x33, 0x1C, 0xF7, 0x1D, 0x7E, 0x22, 0x60, 0x83, 0xF8, 0xDD, 0xC7, 0x0C, 0x88, 0x3F, 0x06,
+    0x3C, 0x2B, 0xD3, 0xB3, 0x3C, 0xC9, 0x5A, 0xE7, 0x7A, 0xF2, 0x63, 0x27, 0x4F, 0x2D, 0xBE, 0x0E,
+    0xC9, 0x7D, 0xBF, 0xCA, 0xFF, 0xEB, 0x3F, 0xD7, 0x5F, 0x9D, 0x55, 0xB1, 0x8E, 0xDE, 0x44, 0x10,
+    0x1E, 0xDB, 0x3A, 0x59, 0xE0, 0x62, 0x9B, 0x34, 0x08, 0x09, 0xF7, 0x34, 0x7E, 0x82, 0x64, 0x0D,
+    0x14, 0xBC, 0x40, 0x02, 0x05, 0x05, 0x7D, 0x1A, 0x1E, 0x61, 0xAD, 0xDC, 0x0B, 0x5C, 0x43, 0x7D,
+    0x2D, 0x1C, 0x05, 0x4F, 0x80, 0x6C, 0x48, 0x79, 0x45, 0x9C, 0xA4, 0x48, 0xFB, 0x2B, 0x0D, 0x25,
+    0x4E, 0xE2, 0x10, 0xE7, 0x6E, 0xED, 0xE1, 0xFB, 0x66, 0x7F, 0x5F, 0x22, 0x94, 0x02, 0xF1, 0xEB,
+    0xD7, 0xEE, 0x78, 0x76, 0x3D, 0xF3, 0xCD, 0xCC, 0x37, 0x63, 0x11, 0xA7, 0xA2, 0x3A, 0x55, 0xDA,
+    0x4A, 0xAE, 0xA3, 0xD7, 0xA5, 0xD2, 0x4E, 0x24, 0x2C, 0x4E, 0xD7, 0x92, 0x92, 0xD3, 0x42, 0xF1,
+    0x1F, 0x04, 0xC7, 0x8F, 0x55, 0x4F, 0x29, 0xE1, 0x38, 0xE8, 0x43, 0x93, 0x9C, 0x36, 0xFA, 0xD2,
+    0xA4, 0x5C, 0x2F, 0xF5, 0xB5, 0x8E, 0x90, 0xC4, 0x5F, 0xEB, 0x9A, 0x24, 0xA7, 0xF8, 0x1D, 0xC4,
+    0x8E, 0x77, 0x49, 0x3C, 0xA4, 0x49, 0xF6, 0xE3, 0x24, 0x65, 0x37, 0x92, 0x04, 0xD5, 0x25, 0x49,
+    0x3D, 0x94, 0xAD, 0x49, 0xBA, 0x1F, 0xF3, 0x9E, 0xEA, 0x8D, 0x41, 0x53, 0x96, 0xF0, 0xF6, 0xB7,
+    0x6E, 0x90, 0x2A, 0x8D, 0x3E, 0x7A, 0xBA, 0x71, 0x1A, 0x6B, 0xAD, 0x74, 0x15, 0xA9, 0x35, 0x22,
+    0x24, 0xFA, 0x6E, 0x34, 0x16, 0x3A, 0xD6, 0x50, 0x7A, 0x8D, 0xA2, 0x13, 0x02, 0x1B, 0xE4, 0xF8,
+    0xF3, 0xDD, 0x2E, 0xD5, 0xE3, 0x2E, 0x55, 0xD3, 0x2E, 0x15, 0xCB, 0x2E, 0xC9, 0xCF, 0x7C, 0x84,
+    0xED, 0x2F, 0x57, 0xDB, 0xAA, 0x45, 0xF2, 0xAD, 0xD9, 0x6A, 0xB8, 0xD4, 0x66, 0xF5, 0xB0, 0xA7,
+    0x3E, 0x12, 0x5F, 0x08, 0xD7, 0x31, 0xC5, 0x3A, 0xA5, 0x8D, 0x66, 0xEB, 0x14, 0x8F, 0x33, 0xB0,
+    0x54, 0x1E, 0x23, 0x1A, 0x08, 0xDD, 0xD2, 0xE3, 0xAF, 0x34, 0xCC, 0xD0, 0x3D, 0xDF, 0xFC, 0x8A,
+    0x7B, 0xA7, 0xAB, 0xD3, 0x2E, 0xAC, 0x25, 0x42, 0x48, 0x50, 0xEB, 0x84, 0xA2, 0x49, 0xDB, 0x9D,
+    0x1B, 0x58, 0xD9, 0xAF, 0x6F, 0xA1, 0xA5, 0x5D, 0xC5, 0x52, 0x5C, 0xFD, 0x12, 0xF7, 0x00, 0xBC,
+    0x95, 0x8E, 0x88, 0x66, 0x3A, 0x69, 0x71, 0x8B, 0x60, 0xB7, 0x56, 0xB2, 0xFB, 0x86, 0x46, 0x2D,
+    0x22, 0x1A, 0x9D, 0x32, 0x78, 0x1E, 0x3E, 0xFB, 0xA2, 0xDF, 0x98, 0x7A, 0xE6, 0x47, 0x3B, 0xC7,
+    0x6A, 0x00, 0x69, 0x27, 0x9F, 0xEA, 0x19, 0xA0, 0xEF, 0x26, 0x33, 0xCB, 0xF7, 0x6C, 0xBE, 0x5B,
+    0x94, 0x60, 0x84, 0x63, 0xF9, 0x44, 0xA0, 0x70, 0xB0, 0x3C, 0xC9, 0xE7, 0x9B, 0x90, 0x53, 0x2C,
+    0x65, 0x8D, 0xEB, 0x51, 0xCE, 0x9A, 0xA1, 0xD1, 0x05, 0x36, 0x61, 0x7B, 0xCC, 0x7A, 0x38, 0x74,
+    0x9D, 0x14, 0x28, 0x50, 0x98, 0xE4, 0xA3, 0x1F, 0x70, 0x73, 0x92, 0x1A, 0x39, 0xDD, 0x2C, 0x41,
+    0xD1, 0x18, 0x17, 0x46, 0x8F, 0x6B, 0x85, 0xE6, 0x4C, 0x9E, 0x5B, 0x70, 0x0C, 0x4E, 0x3C, 0x26,
+    0xFC, 0x42, 0x1D, 0xFD, 0xD7, 0x8B, 0x65, 0xB7, 0xBF, 0xB4, 0x18, 0xB4, 0x9F, 0xDE, 0xE5, 0x58,
+    0x75, 0x36, 0x1D, 0x39, 0x8C, 0x90, 0x97, 0xC4, 0xA2, 0x21, 0xD1, 0xC5, 0x52, 0xA8, 0x31, 0xE9,
+    0xA2, 0xE9, 0xEC, 0x86, 0x4F, 0x9B, 0x3E, 0xE2, 0xCB, 0x95, 0xD6, 0xB4, 0xEE, 0x17, 0xCF, 0x4D,
+    0xC7, 0x80, 0xAD, 0x62, 0xB3, 0x3C, 0x07, 0xC9, 0xB0, 0xFD, 0x75, 0x64, 0xB3, 0x31, 0x34, 0x8B,
+    0xEF, 0x53, 0xE6, 0xC8, 0xA6, 0xBB, 0x00, 0x30, 0xFB, 0x51, 0xEA, 0x3F, 0xE0, 0x71, 0x6B, 0x0E,
+    0x52, 0xBC, 0x00, 0xEA, 0xE6, 0x1C, 0x97, 0x36, 0xA5, 0xD3, 0x89, 0x30, 0xE8, 0x70, 0xE6, 0x53,
+    0x4B, 0x00, 0x7C, 0xDA, 0xE8, 0x1C, 0xAF, 0xF8, 0xF3, 0x55, 0xB2, 0x15, 0xCE, 0xAA, 0x29, 0xC4,
+    0x5B, 0x7E, 0xD0, 0x8D, 0xE6, 0x1D, 0x8D, 0xDF, 0xA6, 0x4F, 0x3C, 0x5D, 0x60, 0xBF, 0x38, 0xB3,
+    0xB2, 0xE0, 0x1E, 0x8B, 0x82, 0x7E, 0x16, 0xF8, 0x64, 0x02, 0x59, 0x55, 0xFA, 0xE8, 0x07, 0x1E,
+    0x8A, 0xBB, 0x42, 0x57, 0xA3, 0x38, 0xEA, 0xBF, 0x62, 0x42, 0x9B, 0x57, 0x33, 0xFD, 0x16, 0x9B,
+    0xF7, 0xCC, 0x65, 0x78, 0x66, 0xB9, 0x3A, 0xF2, 0x90, 0x1D, 0xB7, 0xA6, 0x6C, 0xD2, 0x02, 0xA9,
+    0xC0, 0xE4, 0xF9, 0x17, 0x2B, 0xD1, 0x95, 0x5B, 0x73, 0xC9, 0x77, 0xF5, 0x29, 0xBA, 0x6D, 0x40,
+    0xB9, 0xC8, 0x62, 0xB0, 0xAC, 0x63, 0xDF, 0x89, 0x9F, 0x19, 0xC8, 0xA1, 0x54, 0x6B, 0xD2, 0xB6,
+    0x87, 0xB9, 0x8F, 0x2F, 0x7E, 0x7A, 0x47, 0xD5, 0x56, 0x4E, 0x5A, 0x10, 0xA2, 0x5C, 0x10, 0x0A,
+    0x10, 0xE7, 0xB3, 0x04, 0x00, 0xBC, 0x85, 0x18, 0x8A, 0xEB, 0x53, 0xE0, 0xFC, 0x6D, 0x01, 0x4A,
+    0xF7, 0xA8, 0x1F, 0x69, 0x75, 0x66, 0x8A, 0xD4, 0x10, 0xA0, 0x34, 0xE1, 0x0E, 0x90, 0x57, 0xAF,
+    0xFE, 0x84, 0x62, 0x65, 0x4C, 0xF5, 0x90, 0xE9, 0x21, 0x8F, 0xA4, 0x1A, 0x72, 0xEE, 0x13, 0x8B,
+    0xC9, 0x3B, 0x17, 0x39, 0xBD, 0x82, 0x3E, 0xC3, 0xDA, 0xE8, 0x1B, 0x80, 0xCC, 0xD2, 0xEC, 0xEA,
+    0x9F, 0x58, 0x1C, 0x2F, 0x99, 0x81, 0xDA, 0xE6, 0x55, 0xB5, 0x26, 0x46, 0x71, 0xCD, 0xF6, 0xE0,
+    0x53, 0xD3, 0x4E, 0xC6, 0x13, 0x4B, 0xBA, 0x11, 0xA3, 0x34, 0x6E, 0xE5, 0x89, 0x5B, 0x69, 0x0E,
+    0x05, 0xBB, 0xEB, 0x6D, 0xFE, 0x38, 0x9B, 0x3D, 0x95, 0xCD, 0x9D, 0x82, 0x33, 0x67, 0xCC, 0x38,
+    0x6F, 0xA2, 0xF4, 0xFB, 0xAC, 0xE9, 0x39, 0x51, 0xD9, 0xDF, 0xB8, 0xCE, 0x99, 0x90, 0x7D, 0xB7,
+    0x82, 0x24, 0x61, 0x38, 0xB6, 0x12, 0x0D, 0x72, 0x94, 0xE4, 0xEB, 0xC9, 0x5D, 0xF1, 0x0F, 0x15,
+    0x39, 0xC2, 0x6B, 0x3D, 0x32, 0x48, 0xFF, 0x19, 0x7D, 0x34, 0x08, 0xA8, 0xA0, 0xFF, 0x80, 0x93,
+    0x8A, 0x10, 0xC8, 0xE0, 0xFA, 0x1A, 0x69, 0x50, 0xAF, 0x9D, 0x9F, 0x30, 0xB7, 0xB7, 0x4A, 0xE7,
+    0x1E, 0xB3, 0x7C, 0x70, 0x36, 0xD9, 0xBF, 0xC6, 0x8D, 0x52, 0x1F, 0xA8, 0x4D, 0xF4, 0x7B, 0xDF,
+    0xA6, 0x69, 0xFE, 0x81, 0x6C, 0xBC, 0xFD, 0x40, 0x36, 0xA6, 0xFF, 0x92, 0x8D, 0xE9, 0x7F, 0x65,
+    0x03, 0xDD, 0xE5, 0x7F, 0xD7, 0xCD, 0x4D, 0x27, 0xDF, 0x3F, 0x01, 0xCF, 0x63, 0x8F, 0xD1, 0x74,
+    0x8E, 0x1E, 0x79, 0xC3, 0x3A, 0x2B, 0x9D, 0x0C, 0x89, 0xBE, 0xCD, 0x4A, 0x40, 0x07, 0x6A, 0xDB,
+    0xD4, 0x18, 0x1B, 0x3A, 0xBD, 0x7E, 0xAA, 0x43, 0x11, 0xD1, 0x3E, 0xBE, 0x23, 0x9A, 0x42, 0x39,
+    0x0E, 0x48, 0x45, 0x01, 0x71, 0x02, 0xEC, 0x68, 0x6B, 0x84, 0x8C, 0xE2, 0xD2, 0x90, 0xC1, 0x1F,
+    0x30, 0x72, 0xF2, 0x15, 0xA3, 0x75, 0x33, 0x1D, 0xA8, 0x0A, 0x45, 0x46, 0x1D, 0xE7, 0x95, 0x50,
+    0xE1, 0x97, 0xA4, 0x63, 0xD2, 0xA1, 0xFB, 0xF1, 0x5E, 0x88, 0xF6, 0xC9, 0x82, 0xC2, 0x3E, 0x39,
+    0x6D, 0xC9, 0xF5, 0xA8, 0x9B, 0x92, 0xAE, 0x33, 0xDD, 0x2A, 0xCD, 0x66, 0x90, 0x95, 0xA3, 0x76,
+    0x28, 0x61, 0xD6, 0xEB, 0x45, 0x63, 0x35, 0x9A, 0x01, 0xB2, 0xDC, 0x3F, 0x38, 0xFA, 0xFE, 0x57,
+    0xE5, 0xF8, 0xC1, 0xB9, 0xCF, 0x41, 0x89, 0x31, 0xD2, 0x0C, 0xE0, 0xB3, 0xEF, 0xD0, 0xBB, 0xBE,
+    0xC5, 0x8D, 0xD0, 0x96, 0x33, 0xEE, 0xA3, 0x39, 0xB8, 0xA0, 0x5D, 0xEA, 0x43, 0x0E, 0x3F, 0x23,
+    0x3B, 0x72, 0xB0, 0xA5, 0x3A, 0x8E, 0x69, 0x6D, 0xDD, 0xEB, 0x6F, 0xB4, 0xAD, 0x27, 0x4C, 0xFB,
+    0xE6, 0x00, 0x8E, 0xF8, 0x83, 0x11, 0x45, 0x72, 0xD6, 0xA7, 0x38, 0xA4, 0xD6, 0xFB, 0xD7, 0xEF,
+    0x1F, 0x65, 0x55, 0x31, 0x8E, 0xE5, 0x44, 0x10, 0x6D, 0xDB, 0x8C, 0x1C, 0x38, 0x30, 0xC9, 0xC4,
+    0x3E, 0x82, 0x8F, 0xD0, 0x1E, 0x36, 0x20, 0xD8, 0x64, 0x02, 0xBE, 0x08, 0x08, 0xB8, 0x01, 0x73,
+    0x01, 0x24, 0x5B, 0xA4, 0x24, 0x2B, 0xA4, 0x89, 0x37, 0x21, 0xD8, 0x15, 0x17, 0x20, 0x40, 0x6A,
+    0x0B, 0x2E, 0xE0, 0x80, 0xCD, 0x2D, 0x0D, 0xF9, 0x1A, 0xF0, 0x4A, 0x66, 0xE9, 0xEF, 0xE2, 0xBD,
+    0xD7, 0x9E, 0xF9, 0x42, 0x63, 0xFD, 0xDF, 0x6D, 0x77, 0xBB, 0x5F, 0x55, 0xBD, 0x7A, 0x55, 0x76,
+    0xB9, 0x75, 0xAE, 0x36, 0xB3, 0xC5, 0xF9, 0xC5, 0x65, 0xB8, 0xD9, 0x5D, 0x61, 0xCE, 0xB5, 0xB8,
+    0x1B, 0x5D, 0x3F, 0xE3, 0xE1, 0xFE, 0xF4, 0x85, 0xAB, 0xCF, 0xCE, 0xF5, 0x8B, 0xC3, 0x85, 0xD5,
+    0x6A, 0xE7, 0x4D, 0x13, 0xF1, 0x30, 0xE3, 0x26, 0xC7, 0x12, 0xF7, 0x9D, 0xF3, 0x1B, 0x10, 0x46,
+    0xDC, 0x94, 0x00, 0xF5, 0x91, 0x4B, 0x61, 0x01, 0xC2, 0x80, 0x9B, 0x1A, 0xA0, 0xFD, 0x2A, 0x84,
+    0xD9, 0x55, 0x26, 0x84, 0xFD, 0x74, 0xB2, 0x45, 0x08, 0xB2, 0x4B, 0x04, 0xDE, 0xCD, 0x42, 0xC0,
+    0x25, 0xD0, 0x60, 0x72, 0xC5, 0xC9, 0x4B, 0x13, 0x28, 0x6F, 0x04, 0xDA, 0x00, 0xC7, 0x08, 0x5A,
+    0xE0, 0x50, 0x23, 0x50, 0x7F, 0x06, 0xDC, 0x22, 0x84, 0xD1, 0x79, 0x81, 0x86, 0x88, 0x07, 0x82,
+    0xE2, 0xC0, 0x88, 0x10, 0x37, 0x17, 0x08, 0x36, 0x16, 0x9B, 0xF3, 0xF7, 0x27, 0xD7, 0x4C, 0x19,
+    0x0D, 0x05, 0x57, 0xE1, 0x58, 0x11, 0x9D, 0x87, 0xB1, 0x7A, 0xCE, 0x78, 0xB4, 0xEF, 0xAA, 0xF5,
+    0xB2, 0x06, 0xA3, 0x5C, 0x23, 0x80, 0x5C, 0x9E, 0xD3, 0x5A, 0x87, 0xB5, 0x77, 0x5F, 0x45, 0xAE,
+    0xB9, 0x16, 0x10, 0xF5, 0xE6, 0xE8, 0x9C, 0x9F, 0x4A, 0xF9, 0xFF, 0x74, 0x85, 0xC3, 0xFD, 0xFA,
+    0xD1, 0x7B, 0xCE, 0x9B, 0xA2, 0x48, 0x28, 0xB9, 0xDD, 0x7F, 0x29, 0xD7, 0x91, 0x09, 0x4F, 0x53,
+    0xC5, 0xAE, 0xC0, 0x80, 0x3F, 0xB9, 0x9E, 0x60, 0x55, 0x04, 0x75, 0x63, 0xCA, 0x42, 0xC2, 0x8A,
+    0x80, 0x7B, 0xBF, 0x83, 0xF6, 0x21, 0x13, 0x7C, 0xBB, 0x2A, 0x75, 0x0B, 0x72, 0x58, 0x98, 0xBD,
+    0xB7, 0x4E, 0x58, 0x43, 0xBD, 0x95, 0xBB, 0x48, 0x08, 0x63, 0x98, 0x78, 0xB4, 0x8C, 0x3A, 0x3A,
+    0xB8, 0x30, 0x18, 0x38, 0x59, 0x5D, 0xBD, 0x36, 0x1B, 0x8E, 0x02, 0x09, 0x8A, 0x28, 0x6C, 0xB9,
+    0x0A, 0xB3, 0x5F, 0x41, 0x60, 0x6E, 0x11, 0x58, 0xA5, 0x4D, 0x40, 0x81, 0x02, 0xC2, 0x19, 0x1E,
+    0x41, 0x00, 0xB5, 0x8D, 0x7E, 0x76, 0xCF, 0x2E, 0x9F, 0x72, 0xD5, 0xA7, 0x08, 0x43, 0x8A, 0x0B,
+    0xE6, 0x19, 0x8D, 0x75, 0xCD, 0x9E, 0x48, 0x3A, 0x33, 0x61, 0x12, 0x08, 0x22, 0xE4, 0x04, 0xA6,
+    0xFA, 0x4D, 0xD1, 0x84, 0x35, 0x11, 0x08, 0x1A, 0x9A, 0x35, 0xE3, 0xD4, 0x2E, 0x39, 0x69, 0xF2,
+    0x08, 0x09, 0x68, 0xFD, 0xCC, 0x69, 0xBA, 0xEE, 0x4A, 0xDB, 0xB9, 0x5B, 0x29, 0x42, 0xF1, 0xC0,
+    0x23, 0x9B, 0x26, 0x64, 0x81, 0x13, 0x36, 0x9A, 0x99, 0x89, 0xE0, 0x0F, 0x1C, 0x5E, 0xD3, 0xB5,
+    0x30, 0x7A, 0xBA, 0x66, 0x63, 0x0F, 0x9F, 0x40, 0x5B, 0x50, 0xE2, 0x86, 0xF0, 0xEA, 0x79, 0x30,
+    0xD9, 0x1B, 0x4D, 0xA5, 0x18, 0xC7, 0xB4, 0x65, 0x6F, 0x95, 0xF8, 0xCF, 0x29, 0xCC, 0x60, 0xFF,
+    0xB2, 0x68, 0x5A, 0xFB, 0x81, 0xB1, 0x96, 0x36, 0xF8, 0x15, 0xD9, 0xB1, 0x19, 0xCE, 0xFB, 0xA1,
+    0xDD, 0x10, 0x66, 0xB9, 0x31, 0x3A, 0x24, 0x0A, 0x36, 0x2B, 0x70, 0xBB, 0x30, 0xAE, 0xAE, 0x3A,
+    0x67, 0x20, 0x02, 0x31, 0x0D, 0x8C, 0x0F, 0xF5, 0x21, 0xD5, 0xF8, 0x73, 0xD7, 0xAE, 0xB9, 0x7D,
+    0x6D, 0x38, 0x38, 0xAA, 0xF6, 0x1A, 0xBB, 0x61, 0x42, 0x33, 0x69, 0xDD, 0x26, 0x89, 0x06, 0x76,
+    0xFD, 0x51, 0x2A, 0x9C, 0xFE, 0x81, 0x8B, 0x61, 0xBF, 0xB9, 0x7D, 0xEE, 0x79, 0x3B, 0x1E, 0x75,
+    0x49, 0xB5, 0xFD, 0x8A, 0x78, 0xBD, 0xBD, 0x86, 0xB3, 0xF6, 0xC1, 0x6C, 0x2D, 0xEC, 0xB3, 0xBD,
+    0x58, 0xCB, 0x58, 0xAE, 0xF9, 0x5A, 0x2F, 0xF5, 0x5C, 0x2C, 0xCD, 0xDC, 0x8C, 0xD5, 0xDC, 0x8E,
+    0xED, 0xD0, 0x4C, 0x7E, 0xF4, 0x43, 0x3F, 0x60, 0xBC, 0x41, 0x82, 0x46, 0xFF, 0x3D, 0xD2, 0x0C,
+    0xC2, 0x30, 0xAE, 0x18, 0xA7, 0xF6, 0xE2, 0x4B, 0x57, 0xA6, 0x0A, 0xB8, 0xFB, 0xE3, 0x7F, 0x94,
+    0x85, 0xFD, 0x15, 0x93, 0x42, 0x5D, 0xB7, 0x2A, 0x60, 0xAF, 0xAA, 0xF1, 0x12, 0x84, 0xB7, 0x8F,
+    0x3F, 0x8D, 0x4E, 0xFC, 0x63, 0xB7, 0x93, 0x77, 0x97, 0x31, 0xF1, 0x9C, 0xDB, 0xA4, 0x12, 0x57,
+    0xB3, 0x09, 0xDB, 0x51, 0xD2, 0x4F, 0x2F, 0x15, 0xDA, 0xCE, 0x28, 0xFE, 0x4F, 0x21, 0xB3, 0xDF,
+    0xAF, 0x7E, 0x56, 0xF9, 0xB0, 0x50, 0x24, 0xB6, 0xD4, 0x2C, 0x54, 0x02, 0x5A, 0x8A, 0x12, 0xE3,
+    0x9E, 0x1A, 0x4A, 0xF7, 0x88, 0x9B, 0x7A, 0x53, 0x9B, 0x70, 0xB7, 0x8B, 0xFB, 0x77, 0x1B, 0x7C,
+    0x47, 0xD2, 0xE0, 0xB8, 0xED, 0xBF, 0x20, 0x47, 0xAE, 0xC0, 0x3B, 0x15, 0xA5, 0x09, 0x5D, 0x36,
+    0x94, 0x16, 0x05, 0xC5, 0xFF, 0xF2, 0x09, 0xDA, 0xDD, 0x37, 0xB4, 0xA4, 0x5E, 0x52, 0x53, 0x94,
+    0x21, 0xA9, 0x19, 0x6D, 0xD0, 0xA1, 0xCA, 0x52, 0xA1, 0xEF, 0x1A, 0xCF, 0xAA, 0xF1, 0x28, 0xFE,
+    0x36, 0xE5, 0x70, 0x95, 0x3E, 0xDD, 0xE3, 0x18, 0x54, 0x4C, 0x47, 0xEC, 0xA3, 0x42, 0x4C, 0x6C,
+    0x0C, 0x0A, 0x3A, 0xF1, 0xC3, 0xCD, 0xD4, 0x3A, 0x6B, 0x35, 0xB6, 0xD4, 0x75, 0x9B, 0x78, 0x09,
+    0x29, 0x8D, 0xBD, 0x42, 0x0A, 0xA9, 0xDB, 0xFE, 0xF9, 0x86, 0x60, 0x7F, 0x49, 0xE6, 0x0F, 0xDA,
+    0x2E, 0xB5, 0x5D, 0x69, 0xBB, 0x5E, 0x1E, 0x47, 0x7A, 0xF8, 0x12, 0xFF, 0xDF, 0xC8, 0xDD, 0xDB,
+    0xBB, 0x77, 0x3F, 0xA2, 0x09, 0xC2, 0x34, 0xDE, 0xCA, 0xA2, 0xDA, 0x23, 0xD0, 0xE1, 0x0C, 0x2B,
+    0xEA, 0x68, 0x8A, 0x00, 0xA7, 0x31, 0xF5, 0x3A, 0x60, 0xFC, 0x3D, 0xA3, 0xAB, 0x10, 0xF4, 0x5B,
+    0xBE, 0x8A, 0xFF, 0x55, 0x0A, 0xCE, 0xAF, 0x08, 0x2B, 0xB7, 0xEF, 0x10, 0x4A, 0x13, 0x19, 0x04,
+    0xC4, 0x1D, 0xE9, 0x3B, 0xFA, 0x0B, 0x14, 0x84, 0x76, 0x62, 0xD4, 0x2A, 0x3E, 0x0E, 0x95, 0xF1,
+    0x5B, 0xD1, 0x9C, 0x45, 0xE2, 0x47, 0x12, 0x20, 0x09, 0xE5, 0x12, 0x5A, 0xA5, 0xEE, 0xDB, 0xA4,
+    0x06, 0x29, 0x42, 0xD4, 0x3C, 0x0B, 0xF1, 0x94, 0x7A, 0x7F, 0xD8, 0x9E, 0x14, 0x72, 0x2C, 0xC4,
+    0xE3, 0xDB, 0xC0, 0x05, 0x1E, 0x41, 0xEA, 0xFC, 0x03, 0x32, 0x16, 0xFD, 0x92, 0xD9, 0x0B, 0x48,
+    0x7C, 0x6E, 0x97, 0x2A, 0xE6, 0x86, 0x9A, 0x44, 0x11, 0x62, 0xED, 0x65, 0x44, 0xDF, 0x61, 0x33,
+    0xC5, 0x87, 0xAB, 0xA6, 0x71, 0xEA, 0xB6, 0xA6, 0x51, 0x3E, 0xD4, 0xF2, 0x69, 0x39, 0xF8, 0xA7,
+    0xA1, 0x26, 0x1E, 0x85, 0xC6, 0xA4, 0x2B, 0x4F, 0xD7, 0xB7, 0x8F, 0x39, 0x44, 0xA5, 0xE0, 0x4C,
+    0xBB, 0x31, 0xB9, 0x25, 0x7B, 0xA8, 0x92, 0x8A, 0x26, 0x8A, 0xC0, 0xF1, 0x2A, 0x31, 0x3C, 0xEB,
+    0x5D, 0xD1, 0x33, 0x03, 0x67, 0xBE, 0x9F, 0xD9, 0x03, 0x93, 0x5E, 0xD3, 0x03, 0x9A, 0x8F, 0x4A,
+    0x3A, 0x91, 0x4F, 0x66, 0x1F, 0x6E, 0x0F, 0xB9, 0xEB, 0x93, 0x39, 0xA9, 0xAE, 0xE2, 0x53, 0xDE,
+    0x8F, 0x4E, 0x95, 0xAA, 0x26, 0xD5, 0x4B, 0x96, 0x04, 0xDF, 0x8A, 0x8E, 0xC4, 0x44, 0xFA, 0x94,
+    0x1C, 0xD7, 0x7F, 0xB5, 0x55, 0x31, 0x8B, 0xE6, 0x54, 0x14, 0xBD, 0x49, 0xE4, 0x8B, 0x98, 0xE2,
+    0xD9, 0x68, 0xE1, 0x14, 0xE9, 0x15, 0x4C, 0x2D, 0xC8, 0xBE, 0xE0, 0x22, 0x5B, 0x58, 0xEC, 0x08,
+    0x3B, 0x08, 0x6E, 0xB1, 0xB5, 0x16, 0xFA, 0x07, 0x64, 0x13, 0xD8, 0x3F, 0xB0, 0x8D, 0x58, 0x58,
+    0xD8, 0xD8, 0xEC, 0x34, 0x5A, 0x5A, 0x2C, 0x26, 0xCC, 0xFE, 0x00, 0x83, 0xFE, 0x81, 0x20, 0x82,
+    0x2C, 0x16, 0xF3, 0x90, 0x20, 0xF9, 0x76, 0x92, 0x5C, 0xCF, 0xB9, 0x2F, 0x33, 0x22, 0xD8, 0xFA,
+    0x91, 0xB9, 0x49, 0xE6, 0xDD, 0x77, 0xEF, 0xB9, 0xF7, 0xDC, 0x77, 0x22, 0x6E, 0x16, 0x5C, 0x3E,
+    0x88, 0xF6, 0xB8, 0xF2, 0x55, 0x32, 0x15, 0x3F, 0x4A, 0xB1, 0xA4, 0x2A, 0x52, 0x85, 0x72, 0x12,
+    0xE9, 0x7A, 0x6D, 0x25, 0xD1, 0x0F, 0x16, 0x91, 0x7C, 0xF5, 0x83, 0x48, 0x79, 0x85, 0x35, 0xF1,
+    0x1A, 0x60, 0x15, 0x6B, 0xD8, 0x83, 0x35, 0x71, 0x3A, 0x48, 0x72, 0xD6, 0xE8, 0x59, 0xED, 0x14,
+    0x3F, 0x69, 0x60, 0xE6, 0x94, 0x8F, 0xD8, 0xD3, 0xD0, 0x39, 0x45, 0x12, 0xF8, 0x6D, 0xC2, 0xED,
+    0x13, 0xED, 0x59, 0x4D, 0x2B, 0xCD, 0x88, 0xBF, 0x81, 0xB9, 0x85, 0x19, 0xAB, 0x59, 0x72, 0x38,
+    0x25, 0xDA, 0x27, 0x0C, 0xEF, 0xD6, 0xB8, 0x5D, 0x43, 0xC9, 0x3C, 0xB9, 0xDE, 0x51, 0x8B, 0xB0,
+    0x5A, 0xB8, 0x4C, 0xD5, 0x42, 0x95, 0xBA, 0x5A, 0x2C, 0x43, 0x44, 0x34, 0xA3, 0xBD, 0x76, 0x8B,
+    0xC4, 0xD5, 0x41, 0xCC, 0x79, 0xDB, 0x9D, 0x82, 0x85, 0x88, 0xCE, 0xC0, 0xBB, 0xD8, 0xE2, 0x1F,
+    0xE6, 0xA5, 0xB3, 0xDF, 0x6C, 0x31, 0xA3, 0x97, 0xD3, 0xBE, 0x82, 0x17, 0x9F, 0xE9, 0x85, 0x2C,
+    0x2C, 0xB4, 0xD2, 0x5A, 0x3A, 0x83, 0x21, 0x59, 0xCC, 0x20, 0xDE, 0xF2, 0x4A, 0x1E, 0xE2, 0x6B,
+    0x27, 0xFF, 0xFC, 0xCA, 0x01, 0xAF, 0xD9, 0x2C, 0x0D, 0xFF, 0x0D, 0x53, 0x8E, 0x0D, 0xF7, 0x35,
+    0xA8, 0xBE, 0xEB, 0x6A, 0xA2, 0xB3, 0x2E, 0x32, 0x40, 0xC7, 0x9A, 0xAC, 0xDC, 0x86, 0x20, 0x1A,
+    0xD6, 0xD8, 0x5C, 0xA2, 0xC2, 0xE6, 0x17, 0x65, 0x93, 0xB0, 0xDE, 0x8C, 0x25, 0x28, 0x1B, 0x33,
+    0x4B, 0xFF, 0x05, 0xCD, 0xDB, 0x56, 0x71, 0x0D, 0x54, 0xAA, 0x17, 0x2B, 0xAA, 0xD2, 0x67, 0x0B,
+    0xED, 0x23, 0xB3, 0xF9, 0x0C, 0x3E, 0xA5, 0x98, 0xC4, 0x2D, 0xE2, 0x02, 0xF9, 0x86, 0x2D, 0x71,
+    0x8D, 0x60, 0x58, 0xAA, 0x81, 0x84, 0xFB, 0x5E, 0x40, 0x2D, 0x6C, 0x83, 0xAB, 0x25, 0x0A, 0xE0,
+    0x02, 0x20, 0x05, 0x0B, 0x78, 0x00, 0x75, 0x92, 0x6E, 0x80, 0x78, 0xF6, 0xD1, 0x76, 0x2F, 0x23,
+    0xA7, 0x73, 0x4E, 0x3B, 0x15, 0xB4, 0xC1, 0x08, 0x1F, 0xDD, 0xCE, 0xB5, 0x30, 0xC8, 0x75, 0x29,
+    0x12, 0xE9, 0x50, 0x12, 0x9D, 0xE8, 0xDE, 0x8F, 0x37, 0xCF, 0xCF, 0xDF, 0xBF, 0x8D, 0x7D, 0x84,
+    0xE7, 0xDA, 0x2C, 0x24, 0x13, 0xBA, 0xE2, 0xA5, 0x18, 0xB3, 0x20, 0xAB, 0x3C, 0x94, 0xB2, 0x2F,
+    0x86, 0x74, 0x91, 0x05, 0x3D, 0x75, 0x7D, 0x36, 0x25, 0xEC, 0x5C, 0x25, 0xCC, 0x55, 0x5F, 0xA7,
+    0x4B, 0x98, 0x11, 0xA1, 0x48, 0xBA, 0x43, 0xA2, 0x84, 0x2C, 0xBC, 0x51, 0x27, 0x22, 0x07, 0x00,
+    0x94, 0x62, 0xC3, 0x04, 0x15, 0x0B, 0x06, 0xDA, 0x2D, 0x28, 0xDE, 0xCD, 0xA8, 0xBA, 0x9C, 0xDC,
+    0x84, 0x8A, 0x51, 0xBC, 0x0F, 0xA8, 0xDD, 0x8F, 0xA4, 0x65, 0xA8, 0x06, 0xCC, 0x59, 0x35, 0x16,
+    0xDA, 0x96, 0x8C, 0xCF, 0xD8, 0x96, 0x49, 0xE4, 0xFC, 0x2B, 0x32, 0x90, 0x33, 0x43, 0x61, 0x03,
+    0x6E, 0x66, 0xA6, 0xE1, 0xC4, 0x95, 0x24, 0x89, 0x73, 0x80, 0x49, 0x21, 0xFD, 0x46, 0xD7, 0x7A,
+    0x3D, 0x10, 0xF9, 0x8D, 0xF3, 0x4B, 0xC9, 0x2A, 0x5B, 0xD5, 0xBB, 0x9F, 0xE7, 0x64, 0xF1, 0x75,
+    0xF5, 0x28, 0x64, 0xD3, 0x2D, 0xF1, 0xF9, 0xE0, 0xC2, 0xC3, 0xC3, 0x86, 0x5E, 0xF6, 0x1E, 0x73,
+    0xF5, 0x29, 0x9A, 0x9E, 0x21, 0xAA, 0x8F, 0x03, 0x84, 0xE6, 0x33, 0x25, 0xC8, 0x67, 0x88, 0xAA,
+    0x96, 0x6C, 0x9F, 0xAA, 0xB2, 0x97, 0x15, 0x83, 0x54, 0xF5, 0x1E, 0x69, 0xE0, 0xE9, 0xDB, 0x55,
+    0xF2, 0x09, 0x0D, 0xD0, 0x74, 0x5E, 0x5C, 0xF0, 0xE5, 0xC5, 0x96, 0xFF, 0x3A, 0x37, 0xC3, 0x8F,
+    0xFE, 0xEE, 0x52, 0x5C, 0x5D, 0x69, 0xDF, 0xED, 0x54, 0xD5, 0x9E, 0x33, 0xAF, 0x6B, 0x27, 0xE9,
+    0xEA, 0x50, 0x7C, 0x8D, 0xA3, 0x1E, 0x2A, 0x90, 0x6D, 0x68, 0x39, 0xBB, 0xF9, 0x24, 0x69, 0xFB,
+    0x4A, 0x1D, 0xB2, 0xE1, 0x87, 0x34, 0xBC, 0x2B, 0x4B, 0xF9, 0xEA, 0xAD, 0xE2, 0xB3, 0xEA, 0xF6,
+    0x4F, 0x0F, 0xFA, 0xAB, 0xCB, 0xE0, 0x75, 0x76, 0x18, 0xFD, 0xEE, 0x1B, 0x71, 0x45, 0x9F, 0x3F,
+    0x1B, 0x93, 0x0F, 0x01, 0xF6, 0x29, 0x8E, 0xF4, 0xBF, 0x0B, 0x2E, 0xFE, 0xAB, 0x45, 0x34, 0x9E,
+    0x5C, 0x51, 0x3C, 0xA4, 0xBB, 0xE4, 0x58, 0x19, 0x18, 0xCC, 0x0F, 0x68, 0xEC, 0x20, 0x12, 0x43,
+    0x3E, 0x67, 0x5A, 0x67, 0x73, 0xB6, 0x01, 0x46, 0xCE, 0x61, 0xB5, 0x59, 0x25, 0x69, 0xD4, 0xA0,
+    0x2A, 0x20, 0x88, 0x1F, 0x21, 0x53, 0xCD, 0x00, 0xD3, 0x0D, 0x10, 0x0C, 0xED, 0x5F, 0x3B, 0x8D,
+    0x07, 0xAD, 0xBD, 0x9E, 0x2F, 0xD2, 0x90, 0x92, 0x86, 0xEC, 0x06, 0x55, 0x71, 0x83, 0xC5, 0xFD,
+    0xA5, 0x8F, 0x79, 0x40, 0x26, 0x9E, 0xFA, 0x05, 0x07, 0xEB, 0xBB, 0x45, 0xBA, 0x09, 0x53, 0xA6,
+    0x7D, 0xBA, 0x40, 0x67, 0x52, 0x4A, 0x1E, 0x10, 0xD0, 0x70, 0x76, 0xA6, 0x62, 0x25, 0x82, 0x85,
+    0x08, 0x30, 0x88, 0xA1, 0xE2, 0x99, 0xF3, 0x33, 0x93, 0x4F, 0xD8, 0xD3, 0x01, 0x7A, 0x7F, 0xF8,
+    0x3E, 0x39, 0x95, 0x4F, 0x98, 0xFA, 0xAD, 0x23, 0x55, 0x0B, 0x13, 0xAE, 0x81, 0xD2, 0x95, 0xD9,
+    0x84, 0xFE, 0x26, 0xEC, 0xFC, 0xE8, 0xF5, 0xC5, 0x1D, 0x54, 0xB8, 0xD8, 0x59, 0x69, 0xA5, 0xA9,
+    0xA9, 0x8C, 0xC7, 0x8F, 0xBB, 0x51, 0x3E, 0x57, 0x3B, 0x4A, 0x22, 0x27, 0xBC, 0x47, 0xD1, 0x31,
+    0x1F, 0x29, 0x35, 0xCE, 0x37, 0xC7, 0x71, 0xFB, 0x96, 0x01, 0xBF, 0x8C, 0x52, 0x69, 0x9A, 0x77,
+    0x2D, 0x11, 0x26, 0x6C, 0xA8, 0xB9, 0xA7, 0xC3, 0xB1, 0x7E, 0x30, 0x9A, 0xB4, 0x45, 0x41, 0xA4,
+    0x16, 0xAC, 0x51, 0x1F, 0xD5, 0xCE, 0x1D, 0xB3, 0xEE, 0x82, 0x89, 0x4E, 0x08, 0x93, 0x3E, 0x17,
+    0x79, 0x02, 0xE6, 0x8E, 0x68, 0x15, 0x84, 0xDA, 0x1D, 0x91, 0x7E, 0xAB, 0xF4, 0xF7, 0x4D, 0x9E,
+    0x22, 0xFF, 0xF4, 0xFA, 0x94, 0x76, 0x76, 0xA2, 0x09, 0xA2, 0x26, 0xB4, 0x15, 0x05, 0x3E, 0xB9,
+    0x87, 0xAE, 0x5A, 0xF2, 0x6A, 0x94, 0x97, 0xD1, 0xFE, 0x17, 0xF7, 0x03, 0xEB, 0x46, 0xEC, 0xD4,
+    0x6A, 0x88, 0x82, 0x9C, 0x74, 0x47, 0x79, 0x87, 0x90, 0x4F, 0xB6, 0x78, 0x70, 0x3A, 0x65, 0x6F,
+    0xCD, 0xB3, 0x85, 0x03, 0x3F, 0x0C, 0xA1, 0xD2, 0xED, 0x3D, 0x1D, 0xD3, 0x2D, 0x8B, 0xCA, 0xE1,
+    0xFB, 0x2A, 0x76, 0x26, 0xC4, 0x86, 0x50, 0x6F, 0x0F, 0xBA, 0xE3, 0xE7, 0x12, 0xF1, 0x9B, 0xCA,
+    0x04, 0x7E, 0x06, 0x74, 0x23, 0x96, 0x34, 0x0A, 0x0C, 0x12, 0x8C, 0xBB, 0x0E, 0xEF, 0x7A, 0x6C,
+    0xDF, 0xA3, 0x81, 0x0E, 0xDA, 0x9E, 0x84, 0xBD, 0x01, 0xF1, 0x43, 0x15, 0x23, 0xA6, 0x7B, 0xAF,
+    0x2D, 0x34, 0x1C, 0x8B, 0x3F, 0xE3, 0x3D, 0x9B, 0x0F, 0xEC, 0x4C, 0xD4, 0x16, 0xEB, 0xDC, 0x7E,
+    0xF7, 0x7B, 0xEF, 0x5D, 0xCC, 0x84, 0xD6, 0x1D, 0x36, 0xEA, 0x7C, 0xA3, 0x43, 0xF7, 0x38, 0xD5,
+    0xCB, 0xD0, 0xE8, 0xD7, 0x4B, 0x32, 0x59, 0xEF, 0x66, 0x23, 0x77, 0x66, 0xDD, 0xB4, 0xF1, 0x59,
+    0xCF, 0xCF, 0xD0, 0x01, 0x0B, 0x4B, 0x2D, 0x3C, 0x85, 0x7D, 0x7E, 0x7F, 0xB0, 0xD5, 0xDE, 0x3C,
+    0x7B, 0x03, 0xD3, 0x8A, 0xBB, 0xC0, 0xF0, 0x88, 0xB3, 0xCA, 0x4A, 0x23, 0xBE, 0x92, 0xFF, 0xE3,
+    0xF7, 0x37, 0xCD, 0x55, 0xB1, 0xB2, 0xDD, 0x34, 0x10, 0x5D, 0xDB, 0xC3, 0xD3, 0x4C, 0x5C, 0xA8,
+    0x21, 0x4D, 0x1A, 0xF5, 0x34, 0xFA, 0x04, 0x39, 0xA4, 0xA0, 0xA5, 0x49, 0xDA, 0xF4, 0x69, 0xF8,
+    0x03, 0x2C, 0xA0, 0xA0, 0xA0, 0x49, 0x93, 0x3E, 0x45, 0x8A, 0x50, 0xBD, 0x2F, 0x00, 0x09, 0xF8,
+    0x80, 0x78, 0x26, 0x3F, 0xE0, 0x26, 0x4D, 0xD2, 0x38, 0x60, 0x66, 0x4C, 0xD0, 0xF5, 0x72, 0x76,
+    0xE5, 0x7B, 0x33, 0x2F, 0x33, 0xA9, 0xD2, 0xE0, 0x3B, 0xD7, 0xB3, 0x5A, 0xAD, 0xB4, 0xBB, 0x67,
+    0xCF, 0xAE, 0xA9, 0x7B, 0x4D, 0xC4, 0x99, 0xC6, 0x99, 0xFC, 0x4A, 0xB6, 0x50, 0xC7, 0x58, 0x47,
+    0x1A, 0x27, 0xF2, 0x8B, 0xAE, 0x77, 0x6A, 0x78, 0xA0, 0x94, 0x29, 0x60, 0xBD, 0x91, 0xD9, 0xA9,
+    0xC5, 0x9A, 0x75, 0xED, 0x0B, 0xD9, 0x1D, 0x47, 0x86, 0x86, 0x27, 0xE2, 0x85, 0x42, 0x21, 0xB7,
+    0xD3, 0xD5, 0x75, 0xA4, 0x9B, 0x4F, 0xBB, 0xD1, 0x38, 0x54, 0x91, 0x9F, 0xE0, 0x2A, 0x7D, 0x02,
+    0xF3, 0x5C, 0xA5, 0x9E, 0x71, 0xF6, 0xD8, 0x3E, 0xEB, 0xE8, 0x8A, 0x3F, 0xBC, 0xE5, 0xD3, 0x1E,
+    0x5E, 0x2C, 0xEF, 0x12, 0x24, 0xF9, 0x53, 0xC7, 0x3C, 0x88, 0x64, 0x38, 0x32, 0x67, 0x75, 0xCE,
+    0x4B, 0xE0, 0x39, 0xAD, 0x24, 0xDB, 0x8E, 0x97, 0x51, 0x24, 0xC3, 0x3F, 0x72, 0x19, 0x37, 0x3D,
+    0xFD, 0x27, 0x9F, 0x82, 0x4A, 0xBE, 0x24, 0x46, 0x9E, 0x78, 0x3A, 0x4E, 0x7C, 0x5D, 0x8E, 0xB0,
+    0x99, 0xAB, 0xE4, 0x21, 0x9D, 0xA8, 0x6E, 0x9F, 0x25, 0xD9, 0xDE, 0xAB, 0xE4, 0x2E, 0x92, 0x81,
+    0xF2, 0x92, 0xFE, 0x91, 0xBF, 0xBD, 0x18, 0x3A, 0xB9, 0x71, 0x3E, 0x5F, 0x58, 0xEF, 0x19, 0xF9,
+    0x05, 0x07, 0x00, 0x4D, 0x94, 0xF8, 0x0F, 0xFE, 0x49, 0x1D, 0x32, 0xFF, 0xC6, 0x13, 0x72, 0x40,
+    0x91, 0x38, 0xA7, 0xC5, 0x41, 0xD9, 0x42, 0x0A, 0x05, 0xDE, 0x23, 0xFE, 0x19, 0xF5, 0x19, 0x79,
+    0x3D, 0x30, 0xB8, 0x13, 0xDB, 0x67, 0x55, 0xF2, 0xAF, 0xBE, 0x39, 0x94, 0xFE, 0x02, 0xBE, 0x93,
+    0x7B, 0xCE, 0x71, 0x1C, 0x27, 0x9A, 0x34, 0x7F, 0x1A, 0xEC, 0x8F, 0x9E, 0x5E, 0x3D, 0xA7, 0x2F,
+    0x1E, 0xDF, 0xFA, 0x19, 0xE4, 0x30, 0x27, 0xF0, 0x0A, 0x28, 0xBA, 0x13, 0x58, 0x04, 0xDC, 0x67,
+    0x38, 0x02, 0xBF, 0xF8, 0x1E, 0x4A, 0xDD, 0xF1, 0x0F, 0xDC, 0x32, 0xA2, 0x45, 0x26, 0x2F, 0xA1,
+    0x55, 0xB0, 0xD3, 0x5F, 0xDC, 0x17, 0x85, 0x21, 0xBC, 0x63, 0xFB, 0xAF, 0x32, 0x02, 0x51, 0xBA,
+    0x0A, 0x12, 0x70, 0x1B, 0x79, 0x3B, 0xA0, 0x4E, 0x07, 0x71, 0x04, 0xAD, 0x78, 0x91, 0x2E, 0x48,
+    0xD7, 0xCC, 0x14, 0x4B, 0xC9, 0xB6, 0xE1, 0x73, 0xC5, 0x7A, 0x3E, 0xE1, 0xC7, 0xCA, 0xC7, 0xB7,
+    0xA8, 0x76, 0x85, 0xF2, 0x3B, 0xDE, 0x3C, 0x0C, 0x7B, 0xDE, 0x1B, 0x5E, 0x2D, 0x0C, 0x03, 0x6F,
+    0x0D, 0x2F, 0x46, 0x0D, 0xC7, 0x1C, 0x56, 0x6A, 0x41, 0xA2, 0x48, 0x76, 0xF1, 0x08, 0x60, 0xFC,
+    0x5D, 0x12, 0xD8, 0x1D, 0xEE, 0xB3, 0x6F, 0xC5, 0x53, 0x7A, 0x01, 0xB1, 0xDB, 0x45, 0xB4, 0x5A,
+    0xBB, 0x24, 0x65, 0xEB, 0x34, 0x6C, 0xA7, 0x01, 0x24, 0x51, 0x77, 0x1A, 0xA1, 0x7B, 0x27, 0xEF,
+    0x94, 0xC3, 0x49, 0x9A, 0x0F, 0x2D, 0xE5, 0x36, 0xE9, 0x2D, 0xE9, 0xA8, 0x0C, 0x85, 0xE8, 0x00,
+    0x59, 0x11, 0x45, 0x9A, 0xB0, 0x32, 0x9A, 0x95, 0xD2, 0xF2, 0x5A, 0x3C, 0x18, 0xF5, 0xE0, 0x95,
+    0x18, 0x9A, 0x52, 0xB7, 0x4B, 0xAF, 0x7D, 0xA6, 0xB9, 0xDF, 0xBA, 0xFB, 0x9C, 0xFC, 0x57, 0x2B,
+    0x05, 0x3B, 0xD3, 0xB7, 0x21, 0xD2, 0x2F, 0x38, 0xBC, 0x17, 0xA4, 0xB8, 0x80, 0x27, 0x99, 0x24,
+    0x07, 0x83, 0x43, 0xF6, 0x0D, 0x93, 0xCD, 0xE3, 0xE0, 0xB3, 0x8F, 0x21, 0xE2, 0x3F, 0x84, 0x98,
+    0x68, 0x44, 0xE7, 0xC2, 0x5E, 0xD8, 0x8E, 0x80, 0x68, 0x04, 0xAE, 0x9F, 0x9F, 0x09, 0x3B, 0x68,
+    0xF4, 0x59, 0x61, 0x9E, 0x85, 0x9B, 0x42, 0xB2, 0xF0, 0xCF, 0x43, 0xC1, 0xA0, 0xC8, 0x10, 0x41,
+    0x98, 0xB8, 0x1C, 0xB3, 0x22, 0x4D, 0x32, 0x61, 0xF4, 0x82, 0x19, 0x03, 0x05, 0x73, 0x06, 0xD5,
+    0x57, 0xA3, 0x81, 0x94, 0x07, 0x62, 0x84, 0xF9, 0x03, 0x09, 0x23, 0xE8, 0x30, 0x0A, 0x8B, 0xA4,
+    0x69, 0x4B, 0x8B, 0x3B, 0x7A, 0x18, 0xBD, 0x1A, 0x02, 0xA3, 0x08, 0x93, 0x83, 0x11, 0x2F, 0x3D,
+    0x78, 0xCD, 0x6B, 0x27, 0xF8, 0x68, 0xD7, 0x79, 0xED, 0x0F, 0xBB, 0x57, 0xEE, 0xD6, 0x9A, 0x47,
+    0xE5, 0x85, 0x94, 0xBD, 0xB9, 0xFF, 0x75, 0x65, 0x81, 0xB6, 0x86, 0x8E, 0x98, 0x70, 0x6F, 0x25,
+    0x97, 0x0B, 0xF5, 0x73, 0xA2, 0x6E, 0x0D, 0xB1, 0x29, 0x76, 0xA2, 0x5F, 0x0D, 0x26, 0xD8, 0x97,
+    0xC0, 0x3F, 0xEF, 0x64, 0xE7, 0x71, 0xE8, 0x56, 0x9F, 0xFB, 0x62, 0xD9, 0xEC, 0x1D, 0x7F, 0xBF,
+    0x0B, 0x5C, 0xE4, 0x91, 0x8B, 0x45, 0x26, 0x16, 0x81, 0x9A, 0x8D, 0x74, 0x14, 0x22, 0x5C, 0x89,
+    0x18, 0x19, 0x04, 0x01, 0x15, 0xB3, 0x30, 0xAA, 0x0E, 0x31, 0x8D, 0x4B, 0xD5, 0xE5, 0x06, 0x87,
+    0x11, 0x5E, 0x2F, 0x68, 0xA2, 0x18, 0x1B, 0x0A, 0x90, 0x65, 0x66, 0x22, 0x58, 0xD5, 0x6D, 0x02,
+    0xB2, 0x0E, 0xD1, 0x59, 0x14, 0x86, 0x9F, 0xDC, 0x1F, 0x4B, 0xA5, 0xEB, 0xAC, 0x44, 0xE6, 0x68,
+    0xEA, 0x1C, 0x38, 0x28, 0xAC, 0xBA, 0x2C, 0x25, 0x00, 0xA9, 0x9C, 0xCC, 0xEC, 0x95, 0xD0, 0x0B,
+    0x86, 0xC1, 0x10, 0x8C, 0x6E, 0xCE, 0xAA, 0x63, 0x4A, 0x45, 0xEB, 0xAB, 0x58, 0xCC, 0x15, 0x85,
+    0x41, 0xB9, 0x5E, 0x6A, 0x17, 0xCC, 0xEF, 0xBB, 0x3D, 0xD4, 0x0E, 0x6A, 0x64, 0xDF, 0xE5, 0x06,
+    0xEE, 0x73, 0x0B, 0xE2, 0xC7, 0x4E, 0x86, 0xB7, 0x59, 0x29, 0x51, 0x0F, 0xBF, 0x92, 0x3E, 0x3C,
+    0xCE, 0x0D, 0x42, 0x99, 0x3A, 0xEC, 0x6B, 0x10, 0x59, 0xA2, 0x8B, 0xC2, 0x8B, 0x28, 0x33, 0x6C,
+    0x70, 0x7F, 0x3F, 0x00, 0x6D, 0x17, 0xB0, 0x27, 0xCC, 0xA8, 0x73, 0x98, 0x8C, 0xB8, 0x6D, 0x6A,
+    0x9B, 0x09, 0x7B, 0xF7, 0x33, 0x59, 0x1F, 0x3D, 0xFE, 0x3F, 0xA2, 0x98, 0x2B, 0x8A, 0x55, 0xB7,
+    0x55, 0x14, 0x4F, 0x15, 0xC5, 0xA5, 0x92, 0x4C, 0x3F, 0x67, 0xF5, 0x3B, 0xD0, 0x6A, 0xEB, 0x1D,
+    0xF4, 0xA3, 0x6A, 0x50, 0xF9, 0x77, 0xD3, 0xE0, 0x98, 0xAD, 0x99, 0xDE, 0x43, 0x7B, 0x13, 0x5F,
+    0x5B, 0xF1, 0x6D, 0x04, 0xDF, 0x56, 0xF1, 0x3D, 0x87, 0x97, 0x2F, 0xD0, 0x46, 0x0B, 0x68, 0x07,
+    0x27, 0xD0, 0x7A, 0x40, 0xAB, 0xF8, 0x8A, 0xAB, 0x0B, 0xBE, 0xAD, 0xC4, 0x69, 0xC4, 0xAF, 0x10,
+    0x15, 0x46, 0x78, 0xDD, 0x1E, 0x3E, 0x36, 0x9E, 0xFF, 0x03, 0xD5, 0x55, 0xB1, 0x92, 0xDC, 0x44,
+    0x10, 0x6D, 0x49, 0xC5, 0x29, 0x50, 0xA0, 0xC8, 0xF1, 0xE4, 0x04, 0xD6, 0x0F, 0x60, 0x46, 0xC5,
+    0x0F, 0x38, 0xB9, 0x25, 0xE1, 0x0F, 0x48, 0xEE, 0x07, 0x5C, 0xA5, 0x85, 0x94, 0xC4, 0xC9, 0x15,
+    0x29, 0x01, 0x01, 0xE5, 0xE4, 0x12, 0x07, 0xCE, 0x24, 0x9C, 0x3A, 0x40, 0x40, 0x11, 0xA3, 0x2A,
+    0x4C, 0x40, 0x74, 0xB2, 0x11, 0xB6, 0xB8, 0x92, 0xE6, 0xF1, 0xBA, 0x67, 0xF6, 0xEC, 0xA2, 0x8E,
+    0x0F, 0x40, 0x75, 0xDB, 0xA3, 0xEB, 0x9D, 0xE9, 0x7E, 0xFD, 0x5E, 0xF7, 0x6C, 0x26, 0x92, 0x1F,
+    0x0A, 0x48, 0x19, 0x68, 0xAA, 0xBD, 0xDC, 0xA5, 0xDE, 0xAA, 0x2D, 0x99, 0xB5, 0x5E, 0xC4, 0xCD,
+    0xF5, 0x2C, 0x8D, 0x1A, 0x3F, 0xB9, 0x49, 0xFA, 0xD1, 0x8D, 0x19, 0x06, 0x37, 0x55, 0x34, 0x00,
+    0x8E, 0x35, 0x4D, 0x5B, 0xD2, 0x88, 0x7C, 0xFE, 0x75, 0x10, 0x11, 0x86, 0x10, 0xE1, 0x69, 0x61,
+    0x10, 0x35, 0xAB, 0x9A, 0x85, 0xC6, 0xCD, 0x22, 0x19, 0x68, 0x72, 0x8C, 0x22, 0x05, 0x86, 0x64,
+    0x4A, 0xDD, 0x51, 0xD1, 0x7F, 0xD6, 0xDE, 0xAB, 0x8F, 0x1F, 0xD7, 0xF2, 0xE0, 0xBE, 0x3C, 0xFA,
+    0x48, 0xB6, 0x47, 0xB2, 0x3E, 0x2D, 0x96, 0x67, 0x6E, 0xEE, 0x31, 0x77, 0x98, 0xDC, 0x9F, 0xA3,
+    0x94, 0xA3, 0x86, 0x22, 0x16, 0xFD, 0x9B, 0xA4, 0x1E, 0xA5, 0x19, 0xC4, 0x1F, 0x79, 0x3E, 0x46,
+    0xE6, 0x87, 0xB8, 0xA4, 0xE4, 0xC7, 0x13, 0x90, 0x0F, 0x74, 0xEF, 0xCC, 0xB2, 0xD0, 0xCD, 0x52,
+    0x98, 0xD7, 0x63, 0x12, 0xC5, 0x4A, 0xE4, 0x15, 0x36, 0xBA, 0x21, 0x8C, 0x4D, 0xF7, 0x56, 0xB0,
+    0x0E, 0xBA, 0xE7, 0x86, 0x6E, 0xD6, 0xF3, 0x3D, 0x5F, 0xA5, 0x79, 0x8B, 0x87, 0x01, 0x47, 0xC1,
+    0xAF, 0xA1, 0xBF, 0xDE, 0x49, 0x92, 0x07, 0xFC, 0x22, 0xCD, 0x0A, 0xBC, 0x61, 0x0E, 0xFC, 0x0C,
+    0xFC, 0x00, 0xC6, 0xAF, 0xB1, 0xFB, 0x55, 0x9A, 0xCD, 0xE3, 0x35, 0x73, 0x60, 0x06, 0x3D, 0x74,
+    0x7F, 0x89, 0xB5, 0xDB, 0xC4, 0xED, 0x15, 0x9E, 0x6B, 0xDA, 0xD9, 0xED, 0x35, 0x5A, 0xD6, 0xDC,
+    0xCD, 0xEA, 0x46, 0x86, 0x4F, 0x98, 0xA3, 0x67, 0xF9, 0xB5, 0xF2, 0x20, 0xCA, 0xC7, 0x6C, 0x6B,
+    0x0D, 0xAB, 0x49, 0xFC, 0x26, 0xB1, 0xB6, 0x29, 0xB9, 0x6D, 0x91, 0x6E, 0x49, 0xBB, 0xE3, 0xA9,
+    0x66, 0xBF, 0x63, 0x97, 0x0A, 0x36, 0xE4, 0x68, 0xA9, 0x84, 0x5F, 0x32, 0x1C, 0x0B, 0x1C, 0x09,
+    0xB1, 0x5B, 0x2B, 0xBA, 0x30, 0x30, 0x0F, 0x88, 0x96, 0x20, 0x5E, 0x60, 0xCA, 0x6F, 0xF6, 0xB0,
+    0x8B, 0xBF, 0xC2, 0xF5, 0x50, 0xBC, 0xC1, 0xDB, 0x4D, 0x7A, 0x17, 0xBA, 0x63, 0xFD, 0x0A, 0x2F,
+    0x56, 0x81, 0x5B, 0xD1, 0xBA, 0x09, 0x6E, 0x2E, 0xF6, 0xFA, 0x27, 0x30, 0x26, 0xFB, 0x40, 0xE3,
+    0xF7, 0xC3, 0x49, 0x5C, 0xB1, 0x7C, 0xCD, 0xA8, 0x88, 0x0C, 0x2F, 0x79, 0xA4, 0xDA, 0xDC, 0xE5,
+    0x16, 0x6E, 0x63, 0x5F, 0x71, 0x5B, 0x37, 0xE6, 0xD0, 0xAE, 0xE0, 0x61, 0xB6, 0xCB, 0xC6, 0x8E,
+    0x12, 0x62, 0xDA, 0xB5, 0x29, 0xB8, 0x25, 0xA8, 0xAC, 0x1D, 0xE1, 0x6A, 0xCF, 0xF8, 0x29, 0xB3,
+    0x08, 0x92, 0x7F, 0x2B, 0x1F, 0x5A, 0xBC, 0x4B, 0x4B, 0x46, 0xEE, 0x35, 0x73, 0x85, 0x48, 0x52,
+    0xFC, 0x4F, 0xCE, 0x12, 0x55, 0x77, 0x3E, 0x4D, 0xA4, 0xD3, 0x6D, 0xEF, 0xD3, 0x57, 0x45, 0xDA,
+    0x4A, 0x2C, 0x91, 0x44, 0x63, 0x2F, 0x0F, 0x16, 0x27, 0x43, 0xAC, 0x0E, 0x5F, 0xD9, 0x91, 0xFE,
+    0xB9, 0x1D, 0xE9, 0xC6, 0x08, 0x60, 0xB6, 0x78, 0xCD, 0x5C, 0xE9, 0x11, 0xB7, 0x1A, 0x4C, 0x02,
+    0xEE, 0x26, 0x0D, 0x7A, 0xB8, 0x58, 0x35, 0x9A, 0x4D, 0x82, 0x2D, 0x03, 0x1B, 0x1D, 0x06, 0x56,
+    0x97, 0x2D, 0x2E, 0x3C, 0xD2, 0xCF, 0x4C, 0xC3, 0x4E, 0xE4, 0xF6, 0x6E, 0x35, 0x89, 0x5D, 0x90,
+    0x26, 0x88, 0xB5, 0xAD, 0xC8, 0x07, 0xAD, 0x9C, 0xAB, 0x7C, 0xF9, 0xAE, 0x88, 0xF5, 0x1C, 0xED,
+    0xA2, 0xDF, 0xEA, 0xD8, 0x08, 0x82, 0x69, 0xDD, 0xDE, 0x59, 0x6F, 0xF7, 0xD8, 0x2A, 0xC2, 0x7A,
+    0x3A, 0xE4, 0x6F, 0xD4, 0xF6, 0x47, 0x05, 0x1E, 0x94, 0xEC, 0x7C, 0x53, 0x5B, 0x2C, 0xAA, 0x4F,
+    0x39, 0x8B, 0x1B, 0x6D, 0x88, 0x68, 0x07, 0x95, 0x96, 0x96, 0x95, 0xBA, 0xDF, 0x3F, 0x23, 0x12,
+    0x9B, 0x6E, 0x0D, 0x93, 0x6C, 0x6B, 0x55, 0x29, 0x29, 0x2F, 0x63, 0xB2, 0xEC, 0xBB, 0xB3, 0x6F,
+    0xAC, 0xD1, 0xBC, 0xC2, 0xEE, 0x8C, 0x2A, 0x8E, 0xC2, 0x66, 0x84, 0x2B, 0x27, 0x82, 0xDF, 0xFE,
+    0x53, 0x9C, 0x1C, 0xEF, 0x2B, 0x13, 0x15, 0x4D, 0xC2, 0x74, 0xA6, 0x7E, 0xD2, 0xA5, 0xB9, 0x5E,
+    0xDF, 0xC9, 0x52, 0xAF, 0xA6, 0x43, 0x54, 0xA5, 0xDC, 0xED, 0x92, 0x89, 0xA2, 0x30, 0x5C, 0x3F,
+    0xDE, 0x6A, 0x82, 0xA1, 0x0C, 0xB7, 0x92, 0x78, 0xD3, 0x20, 0x29, 0xD2, 0x44, 0x7D, 0xA2, 0x20,
+    0x5A, 0x15, 0xE9, 0x89, 0x7A, 0x70, 0x3E, 0x48, 0xF1, 0x31, 0xCA, 0x91, 0x6B, 0x6F, 0x75, 0x1A,
+    0x3E, 0x3B, 0xCF, 0xCE, 0x35, 0x09, 0xF3, 0x67, 0xF8, 0x42, 0xA9, 0x08, 0x35, 0x81, 0xF9, 0x85,
+    0x33, 0x98, 0x73, 0xAC, 0xC9, 0x19, 0x4E, 0x63, 0x79, 0xC7, 0xE3, 0x5E, 0xDE, 0x0A, 0xE2, 0x55,
+    0xBF, 0x02, 0x57, 0x04, 0xD8, 0x4C, 0x0A, 0xDD, 0xF4, 0xE0, 0xBD, 0xD7, 0x91, 0xFA, 0x36, 0xE3,
+    0x55, 0xC5, 0x7B, 0x67, 0x49, 0x72, 0x78, 0x9B, 0xAA, 0x4D, 0x27, 0xA6, 0xFC, 0xFB, 0x53, 0xE2,
+    0x8F, 0x6A, 0x30, 0x46, 0x30, 0xF4, 0x8B, 0xD9, 0xE1, 0x9D, 0x18, 0x22, 0x87, 0x27, 0x4F, 0xB0,
+    0xC5, 0x7B, 0x20, 0x6E, 0xB0, 0x96, 0x49, 0xC3, 0x52, 0xC7, 0xF2, 0x6D, 0x8A, 0xC2, 0x65, 0x6C,
+    0x9E, 0xF4, 0x95, 0x92, 0x77, 0x7A, 0x2B, 0xF7, 0x74, 0x87, 0x88, 0x7B, 0x65, 0xDD, 0xA6, 0x07,
+    0x7E, 0xC4, 0x2F, 0x07, 0x3B, 0xC1, 0xFB, 0x0C, 0x26, 0x68, 0x8E, 0xDC, 0x1A, 0x82, 0x1C, 0xEF,
+    0x79, 0x6C, 0x0A, 0x52, 0x5F, 0x20, 0xF6, 0xA6, 0x9F, 0x4B, 0xA4, 0x0C, 0x43, 0x85, 0x74, 0x53,
+    0xA5, 0x5D, 0x3A, 0xBD, 0xE9, 0x4D, 0x2B, 0xC2, 0x41, 0x23, 0x77, 0x36, 0x18, 0x0A, 0x0F, 0xA7,
+    0xB7, 0x82, 0x39, 0x7B, 0x7B, 0x53, 0x72, 0xE3, 0x9B, 0x5E, 0x73, 0xF1, 0x5B, 0x8E, 0x4D, 0x76,
+    0x5B, 0xD0, 0xBF, 0x9F, 0x2C, 0xB4, 0x72, 0x31, 0x1A, 0xDF, 0x57, 0x27, 0xE1, 0xB9, 0x72, 0x12,
+    0xB0, 0xB8, 0x29, 0x0F, 0xD2, 0xF3, 0xB6, 0x19, 0x6A, 0x5E, 0x32, 0x7F, 0x5D, 0xB1, 0x6B, 0x8C,
+    0xA4, 0x4D, 0x07, 0x42, 0xB7, 0xB9, 0xC1, 0xD0, 0x0C, 0x3B, 0x6B, 0xBC, 0xB9, 0x6C, 0x8B, 0x39,
+    0xFD, 0x7E, 0x0D, 0xDA, 0x25, 0x44, 0x7A, 0x79, 0x41, 0x66, 0xEF, 0x67, 0x11, 0xE6, 0x52, 0x24,
+    0xB8, 0x75, 0x5C, 0x23, 0xCB, 0xD4, 0xBA, 0x0A, 0x6D, 0x86, 0x3F, 0xE4, 0xFF, 0xF0, 0xFC, 0x03,
+    0xCD, 0x55, 0xBB, 0x92, 0xD4, 0x56, 0x10, 0x6D, 0xE9, 0xD6, 0x8E, 0x0A, 0x14, 0x28, 0xDF, 0x09,
+    0x6E, 0x4E, 0xA2, 0x4F, 0xB8, 0x53, 0x45, 0xE0, 0x10, 0x27, 0x9B, 0xD8, 0x7F, 0x40, 0xE2, 0x4F,
+    0xD0, 0x2C, 0xFE, 0x00, 0x6F, 0x42, 0x42, 0xB4, 0x19, 0x30, 0x54, 0xB1, 0x5F, 0xE0, 0xD2, 0x00,
+    0xA1, 0x13, 0x55, 0xB9, 0x9C, 0x0F, 0x8F, 0x04, 0x22, 0x51, 0xAB, 0x40, 0x0B, 0x92, 0x0E, 0xDD,
+    0xE7, 0x6A, 0x05, 0x0E, 0x4C, 0xE1, 0xC2, 0x81, 0x55, 0x35, 0xDD, 0x3D, 0x73, 0x7B, 0x6E, 0x9F,
+    0x3E, 0xFD, 0x90, 0x88, 0x1C, 0x6D, 0xE4, 0x47, 0x11, 0xF1, 0x4D, 0x36, 0x98, 0x02, 0xBA, 0xA8,
+    0x0E, 0xAA, 0x0A, 0x60, 0xAB, 0x2A, 0xC1, 0x28, 0xF6, 0x1C, 0xC9, 0xD7, 0x9F, 0xF4, 0x02, 0xE8,
+    0x45, 0x1C, 0x80, 0x56, 0x24, 0x53, 0xD5, 0x88, 0xE4, 0xE0, 0x25, 0x45, 0x4F, 0x17, 0xDF, 0x51,
+    0x95, 0x2D, 0x55, 0x38, 0x50, 0x55, 0x0D, 0x55, 0x1D, 0xA3, 0xA9, 0xFF, 0x26, 0x2A, 0x86, 0xA6,
+    0x72, 0xB8, 0xBF, 0xA1, 0xA2, 0x63, 0x36, 0x51, 0xE5, 0x11, 0x55, 0x31, 0x9E, 0x9C, 0x6C, 0x08,
+    0x19, 0x7B, 0xBD, 0x39, 0xAA, 0xF0, 0x37, 0x55, 0x45, 0x85, 0xA8, 0x44, 0x56, 0xE7, 0xF2, 0x58,
+    0xFF, 0x7F, 0xF5, 0xF3, 0x48, 0x7C, 0x03, 0x65, 0x4B, 0xE4, 0x76, 0xFE, 0x4B, 0x2F, 0xFF, 0xE6,
+    0x59, 0x5F, 0x45, 0xA0, 0x5B, 0x5E, 0xA3, 0x29, 0x95, 0x7D, 0xD6, 0x5A, 0x56, 0xA9, 0x26, 0x8B,
+    0x07, 0x75, 0xCF, 0x2C, 0x7A, 0xF2, 0xD2, 0x93, 0x96, 0x4E, 0x1D, 0x77, 0x27, 0x0A, 0x9D, 0x34,
+    0x14, 0xE4, 0xA4, 0x98, 0x64, 0xB5, 0x37, 0xC6, 0x15, 0x42, 0x46, 0xCE, 0x5C, 0x64, 0x2E, 0x32,
+    0xB0, 0xC6, 0xD9, 0x12, 0x30, 0xB9, 0xB0, 0xDF, 0x2B, 0x02, 0xAF, 0x49, 0x57, 0xCC, 0xCC, 0xE4,
+    0xC1, 0x62, 0xA1, 0xD5, 0xD0, 0x6B, 0xB4, 0x89, 0xB1, 0xCA, 0x18, 0x61, 0x96, 0x6B, 0x9E, 0x1A,
+    0x49, 0x68, 0x28, 0xF7, 0x94, 0x5B, 0x4A, 0x29, 0xFF, 0x32, 0x18, 0xBE, 0x91, 0x30, 0x28, 0xB6,
+    0x54, 0x29, 0x29, 0x50, 0xEB, 0xC5, 0x8E, 0x18, 0x92, 0xD8, 0x1B, 0xEB, 0x69, 0xB3, 0x20, 0x59,
+    0x3D, 0x3D, 0x93, 0x95, 0xFD, 0x5C, 0x9A, 0xB0, 0xAB, 0xCD, 0xF5, 0xE0, 0x37, 0x6B, 0x43, 0xC8,
+    0x72, 0x65, 0xBD, 0x1C, 0xFD, 0x54, 0x1F, 0x0C, 0x27, 0x09, 0xB0, 0x0C, 0x9B, 0x80, 0x87, 0x90,
+    0xDF, 0xC5, 0xB7, 0xC9, 0x98, 0x62, 0xE3, 0xEC, 0xCF, 0x8E, 0x21, 0xEA, 0xCF, 0x59, 0x56, 0xA7,
+    0x56, 0x66, 0xDC, 0x1E, 0x2D, 0xF2, 0x0F, 0x83, 0x5D, 0x57, 0x0C, 0xD6, 0x56, 0x5E, 0xE5, 0x6A,
+    0x77, 0xFC, 0xE8, 0x9F, 0x2B, 0xF2, 0xFF, 0x21, 0x48, 0xEE, 0xBE, 0x95, 0xC8, 0x50, 0x7A, 0x8D,
+    0xA3, 0xB5, 0xAE, 0xD4, 0x4B, 0x22, 0x47, 0x31, 0xB0, 0x92, 0x24, 0x27, 0x4F, 0x26, 0x82, 0x8D,
+    0x4D, 0x4B, 0x9A, 0x1C, 0x3E, 0x54, 0x2D, 0x79, 0xD2, 0x98, 0x25, 0x39, 0xEA, 0xAC, 0xA9, 0xDB,
+    0x99, 0xA9, 0xB0, 0x87, 0xCD, 0x52, 0xBD, 0xD5, 0xF1, 0xD2, 0x59, 0xCA, 0x26, 0x6F, 0x3E, 0x77,
+    0x94, 0xB1, 0xDD, 0xBD, 0xDD, 0x5C, 0xA1, 0xF3, 0xE3, 0x6D, 0xB4, 0xDC, 0x10, 0xDB, 0x4D, 0xE7,
+    0x14, 0xF9, 0x30, 0xC3, 0xC3, 0xAF, 0xD3, 0x6C, 0xD5, 0xAF, 0x30, 0x3B, 0x86, 0x0E, 0x8D, 0xFC,
+    0x87, 0x8F, 0xC3, 0x3E, 0xA0, 0xCB, 0xD8, 0xCB, 0x6D, 0x81, 0xC1, 0xD9, 0x90, 0xF9, 0xD1, 0x61,
+    0xA2, 0xE5, 0xF0, 0x0C, 0xB8, 0xCD, 0xC1, 0x43, 0x5B, 0xE1, 0x39, 0x83, 0xFB, 0xB1, 0xC4, 0x4B,
+    0x5A, 0x0E, 0xBF, 0xE1, 0x3D, 0xB7, 0x91, 0xE0, 0x12, 0x43, 0xB4, 0xFC, 0x88, 0x11, 0x6D, 0xBC,
+    0x3C, 0x6E, 0x9B, 0xB8, 0x3F, 0x66, 0xCB, 0x2F, 0x96, 0x43, 0xAC, 0x49, 0x3C, 0x9E, 0xAD, 0x92,
+    0x8D, 0xC1, 0x54, 0xE3, 0x88, 0x49, 0x5C, 0x11, 0xFD, 0x72, 0x0D, 0x37, 0x10, 0xDB, 0x85, 0xF7,
+    0x68, 0x61, 0xAB, 0x91, 0x63, 0xA8, 0x55, 0xF4, 0x53, 0x98, 0x77, 0x45, 0xAE, 0xB0, 0x27, 0xEB,
+    0x48, 0x4B, 0xA4, 0x56, 0x64, 0xB9, 0x7E, 0xC5, 0xA1, 0xD0, 0x75, 0xE9, 0xD5, 0xAA, 0xBA, 0x14,
+    0x0B, 0x93, 0xC7, 0x67, 0x77, 0xE7, 0xAE, 0x08, 0x0D, 0x66, 0xAB, 0x7A, 0x86, 0x6B, 0xF2, 0x9F,
+    0x5F, 0x5B, 0x78, 0x81, 0xEB, 0x22, 0xFD, 0x81, 0xEF, 0xE3, 0xBD, 0xEE, 0xB2, 0x51, 0xA3, 0x79,
+    0x15, 0x83, 0x5A, 0xD5, 0xBE, 0xEA, 0xC4, 0x4F, 0xBA, 0x3C, 0x71, 0xAA, 0xB0, 0x72, 0xB8, 0x29,
+    0xD1, 0x04, 0x36, 0x9A, 0xC9, 0x0B, 0xA4, 0x28, 0x38, 0x67, 0xAF, 0xE1, 0xC6, 0x60, 0x34, 0xD5,
+    0x97, 0xDA, 0x24, 0x44, 0x1F, 0x26, 0x14, 0x1F, 0x09, 0x59, 0x7B, 0xD2, 0xC7, 0x57, 0x81, 0xEE,
+    0xB9, 0x2A, 0xD2, 0xA5, 0x34, 0xD4, 0xB1, 0x26, 0xA4, 0x8B, 0x64, 0x26, 0x0B, 0x83, 0xF9, 0xB2,
+    0x72, 0xC3, 0x17, 0x5C, 0x22, 0xF2, 0x9F, 0xE3, 0x4A, 0xEB, 0x09, 0x1E, 0xBE, 0xC4, 0x50, 0xA9,
+    0xA3, 0x1E, 0x9E, 0xA2, 0x2F, 0xD5, 0x51, 0xA9, 0x4C, 0xD0, 0x69, 0xB7, 0xE8, 0x61, 0x9F, 0xA0,
+    0xCD, 0xE8, 0x58, 0xB4, 0xC1, 0x9C, 0xEC, 0x55, 0x15, 0x0E, 0x1A, 0x4C, 0x3B, 0x5E, 0x51, 0xE0,
+    0x4F, 0x8D, 0x76, 0xF3, 0xD1, 0xAD, 0xF3, 0x6F, 0x65, 0xE6, 0xD8, 0x96, 0x69, 0x3E, 0x6F, 0x57,
+    0xAD, 0x60, 0xF1, 0xEE, 0x82, 0xED, 0x52, 0x73, 0x11, 0xB7, 0x64, 0x9F, 0x50, 0x1B, 0x6B, 0x87,
+    0xCE, 0x7C, 0x2D, 0x59, 0xD8, 0x60, 0x1F, 0x3D, 0x19, 0x17, 0x2F, 0xC1, 0xF2, 0x32, 0xCB, 0x20,
+    0xC9, 0x9B, 0x95, 0x32, 0xC1, 0xE6, 0x8A, 0xAB, 0x3B, 0xD8, 0xDB, 0xC0, 0xB1, 0xAF, 0x56, 0x78,
+    0xF3, 0x39, 0xFC, 0x2E, 0xD5, 0xDD, 0x65, 0x49, 0x70, 0x10, 0xDD, 0xA4, 0xEF, 0xC6, 0x7C, 0x2A,
+    0x7B, 0x7D, 0x93, 0x85, 0xB9, 0x43, 0x13, 0x63, 0xAF, 0x1A, 0x49, 0xAA, 0x7E, 0x3B, 0x2B, 0x48,
+    0xBF, 0x09, 0xAF, 0x9F, 0x5B, 0x13, 0xAB, 0x6B, 0xA7, 0x06, 0x2B, 0x61, 0x33, 0xAB, 0xB8, 0x91,
+    0x0E, 0xD6, 0xDC, 0xFD, 0xBC, 0x22, 0x6A, 0x83, 0xBF, 0x9E, 0xBE, 0x46, 0xC4, 0x27, 0xAD, 0x55,
+    0xB1, 0x8E, 0xDE, 0x44, 0x10, 0x1E, 0xDB, 0xF0, 0x5B, 0x3A, 0x17, 0x4E, 0x43, 0x8A, 0xA3, 0x70,
+    0x7F, 0xCD, 0x3E, 0xC2, 0x1A, 0x52, 0x50, 0xD0, 0xD0, 0xF0, 0x12, 0xD7, 0xF0, 0x08, 0x76, 0xA0,
+    0x4C, 0x93, 0x8E, 0x92, 0x94, 0x77, 0xCE, 0x43, 0xD8, 0x88, 0x82, 0xD6, 0x12, 0x2F, 0xE0, 0x08,
+    0x68, 0x68, 0x6E, 0x23, 0x2C, 0x61, 0x5D, 0xD6, 0x1E, 0xBE, 0x6F, 0xF6, 0x40, 0xBA, 0x08, 0x92,
+    0x28, 0xCA, 0xCA, 0xBF, 0xFD, 0x7B, 0x77, 0x76, 0xE6, 0x9B, 0x6F, 0xBE, 0x59, 0x8B, 0x70, 0x74,
+    0xAA, 0x53, 0xAE, 0xAA, 0x52, 0xA9, 0x46, 0x39, 0x1F, 0xC6, 0x20, 0x92, 0x6B, 0x8B, 0x85, 0x55,
+    0x30, 0xD7, 0x4A, 0xA6, 0x98, 0x69, 0x0E, 0x98, 0x8E, 0x07, 0x97, 0x70, 0x3B, 0x1B, 0x23, 0x5E,
+    0xAB, 0x0D, 0xB7, 0x66, 0xC1, 0x4D, 0x7B, 0x79, 0x50, 0xEE, 0x52, 0x2D, 0x5D, 0x10, 0xB8, 0xEA,
+    0x6B, 0xBA, 0x6A, 0x54, 0x67, 0xA9, 0x75, 0x17, 0x39, 0x1D, 0x3D, 0x8C, 0x1E, 0x0E, 0x43, 0x5F,
+    0x28, 0xDE, 0x3D, 0x16, 0x4A, 0xFE, 0x81, 0xC7, 0x29, 0xC5, 0x71, 0x31, 0x85, 0x60, 0x3C, 0x51,
+    0x4C, 0xD4, 0xBA, 0x20, 0x30, 0xFC, 0x4A, 0xC5, 0x50, 0x1E, 0x76, 0x65, 0x94, 0x8F, 0x44, 0xA7,
+    0x22, 0xF8, 0xCD, 0xF0, 0x8E, 0xAA, 0x4B, 0xCE, 0x40, 0x15, 0x21, 0x55, 0x47, 0x2B, 0xF7, 0xC7,
+    0xC7, 0x97, 0xE3, 0x46, 0xBC, 0xE6, 0xA5, 0xA3, 0x21, 0xBC, 0xDA, 0xCB, 0xEB, 0x96, 0xB4, 0xB2,
+    0x87, 0x5F, 0xE4, 0x6C, 0x10, 0x64, 0x92, 0x01, 0x3A, 0xB0, 0x75, 0x51, 0x6A, 0x5C, 0x3A, 0x21,
+    0xC3, 0x42, 0x37, 0x69, 0x56, 0x44, 0x6D, 0x61, 0xEC, 0xC0, 0x89, 0x5F, 0x90, 0x04, 0x8D, 0x81,
+    0x03, 0xC6, 0x1E, 0x09, 0xD5, 0xB1, 0x3E, 0x68, 0xFC, 0xAD, 0x62, 0x67, 0xB3, 0x76, 0xBF, 0x70,
+    0x5B, 0xB3, 0x8D, 0xAB, 0xF8, 0x3F, 0xB5, 0x86, 0xF1, 0xA1, 0x3F, 0x62, 0xE7, 0xA8, 0xAB, 0x3B,
+    0xE0, 0xF6, 0x28, 0x10, 0x06, 0xF4, 0x83, 0x4D, 0x38, 0x44, 0x98, 0x42, 0xF7, 0x0C, 0x61, 0xBC,
+    0xF6, 0x4E, 0xDB, 0x52, 0x43, 0x41, 0xE3, 0x08, 0xF0, 0x77, 0x30, 0x1F, 0x88, 0x5C, 0xC2, 0x5E,
+    0x0A, 0xE6, 0x4F, 0x1E, 0x77, 0xE6, 0x37, 0x3C, 0x93, 0x37, 0x8D, 0xC2, 0x92, 0x40, 0x9D, 0x08,
+    0xB3, 0xAD, 0xB5, 0xC5, 0x04, 0x9C, 0xD6, 0xA1, 0x82, 0xF7, 0xAE, 0x1F, 0xB5, 0xCF, 0xF7, 0x8A,
+    0xE0, 0x43, 0x77, 0x83, 0xAC, 0x7E, 0x3E, 0xFC, 0x94, 0x1D, 0xDD, 0x8B, 0x43, 0xAA, 0x57, 0x5A,
+    0x13, 0x4C, 0xF0, 0x33, 0x4A, 0x91, 0x51, 0x21, 0x01, 0xD5, 0xF0, 0xDA, 0x82, 0x27, 0x5D, 0x33,
+    0x42, 0x6C, 0x31, 0x71, 0x7E, 0x25, 0x17, 0x06, 0xE1, 0x32, 0xBB, 0xC2, 0xBD, 0x0E, 0xAC, 0x56,
+    0xAE, 0xA9, 0x70, 0x41, 0x59, 0xBA, 0xA3, 0xA1, 0x56, 0xF4, 0x57, 0xB2, 0x9F, 0x86, 0x0B, 0x86,
+    0x0D, 0x95, 0x03, 0xFC, 0x6E, 0x96, 0x66, 0x67, 0xA5, 0x4B, 0xB2, 0x87, 0x0B, 0xF0, 0x8C, 0x06,
+    0xC4, 0xA8, 0x20, 0x07, 0x17, 0x90, 0x26, 0x8D, 0x3B, 0x42, 0x9E, 0xC1, 0x1C, 0x8C, 0x0B, 0xEA,
+    0x4B, 0x27, 0xBD, 0xA1, 0xB1, 0xFB, 0x4B, 0xA7, 0x4C, 0xBF, 0xD8, 0x3D, 0xB6, 0xBD, 0xD4, 0x27,
+    0x48, 0x52, 0x11, 0x1A, 0xC6, 0x37, 0xB1, 0x31, 0x69, 0x7F, 0x8E, 0xEC, 0x51, 0x28, 0x8F, 0x3C,
+    0x35, 0x56, 0x26, 0x79, 0x86, 0xF1, 0x3A, 0x37, 0x56, 0xDB, 0x1C, 0x61, 0xC0, 0xB3, 0xA7, 0xF1,
+    0x54, 0x52, 0xF2, 0x72, 0xF6, 0xF4, 0xA2, 0x85, 0xC8, 0xDD, 0x22, 0xC5, 0x5E, 0xAF, 0x42, 0xF7,
+    0xC8, 0xE1, 0x27, 0x30, 0xDF, 0xBD, 0x64, 0x56, 0xF7, 0x47, 0x0D, 0xEE, 0x42, 0x89, 0xF0, 0x5B,
+    0x0E, 0x89, 0x43, 0x15, 0xA8, 0x29, 0x74, 0xEB, 0x74, 0x6A, 0x16, 0xA7, 0x4B, 0xB5, 0x3A, 0x5D,
+    0x8B, 0xD8, 0xBC, 0x8A, 0x02, 0x45, 0xA8, 0x74, 0x3F, 0x6C, 0x5D, 0xEF, 0x6E, 0xA2, 0x5F, 0x80,
+    0xA7, 0x5E, 0x4B, 0x8D, 0x65, 0xCC, 0x15, 0x97, 0xA0, 0x14, 0xDA, 0xC3, 0x41, 0x37, 0x83, 0x13,
+    0x17, 0x4E, 0x83, 0x9C, 0x91, 0x56, 0x39, 0x3D, 0x3B, 0xEF, 0xAD, 0x9C, 0x75, 0x90, 0x7F, 0xF9,
+    0x4D, 0x78, 0x80, 0xE8, 0x85, 0x51, 0xEB, 0x37, 0x5D, 0xFE, 0x57, 0x08, 0xA7, 0xB4, 0xE6, 0xD4,
+    0xC0, 0xA7, 0x8E, 0x60, 0x17, 0xF1, 0x75, 0x3C, 0x32, 0x76, 0x0B, 0x7E, 0x15, 0xF3, 0xC3, 0x5F,
+    0x90, 0x0B, 0x32, 0xC5, 0xAD, 0xD6, 0x9C, 0x15, 0xF4, 0x8A, 0xEC, 0x33, 0xED, 0xB9, 0x2E, 0xE3,
+    0x52, 0xB0, 0x53, 0xB1, 0xC8, 0xCD, 0x58, 0xE9, 0xE0, 0xBA, 0x50, 0x4E, 0xC0, 0x66, 0xAA, 0xE3,
+    0x9D, 0x0D, 0x21, 0x41, 0x28, 0xB0, 0xF1, 0x91, 0xDD, 0x24, 0xDD, 0x81, 0x73, 0xE1, 0xF7, 0x87,
+    0x6C, 0x1C, 0xE5, 0x40, 0x85, 0xD5, 0x10, 0x78, 0x3E, 0x16, 0x56, 0x8A, 0x0F, 0xB9, 0x7B, 0xF0,
+    0x75, 0x86, 0x93, 0x4F, 0xF5, 0xF6, 0x5E, 0x2A, 0xDD, 0x63, 0x08, 0x47, 0xBF, 0xE3, 0xED, 0x11,
+    0x7B, 0xE0, 0xCB, 0x1D, 0xD1, 0x11, 0xF5, 0x34, 0x9C, 0x5F, 0xC9, 0x5B, 0xC6, 0x37, 0xC0, 0xC8,
+    0xCE, 0x4D, 0x44, 0x8C, 0xB7, 0xBA, 0x00, 0xA0, 0x43, 0xAF, 0x49, 0x13, 0x4A, 0xF6, 0x05, 0xA4,
+    0xD7, 0x04, 0x90, 0xDC, 0x84, 0x26, 0x88, 0x5B, 0x50, 0x7F, 0x3F, 0x7B, 0x6B, 0x71, 0xC8, 0xB0,
+    0x27, 0x50, 0x6E, 0x65, 0x22, 0xD4, 0xA9, 0x42, 0x2B, 0x45, 0x3A, 0x63, 0x36, 0xF3, 0xFF, 0xC9,
+    0x57, 0xE9, 0x58, 0x5D, 0x13, 0xC9, 0x8B, 0x05, 0x02, 0x5B, 0xCC, 0x25, 0x82, 0x9D, 0xBD, 0x24,
+    0xB5, 0xE0, 0x13, 0x22, 0xC6, 0x36, 0x9C, 0xB7, 0x96, 0xB7, 0xD1, 0x3C, 0x86, 0xC2, 0xF8, 0xE0,
+    0x46, 0x6C, 0x35, 0x36, 0x76, 0x60, 0x1C, 0xBE, 0x07, 0xA9, 0x6A, 0xF5, 0x61, 0x3B, 0x28, 0xDA,
+    0xF8, 0x76, 0x54, 0x3B, 0x6C, 0xB1, 0x6E, 0x66, 0xBD, 0xED, 0x31, 0x2C, 0x77, 0x47, 0x1D, 0x8F,
+    0x6C, 0xCF, 0xC8, 0xC8, 0x39, 0x9D, 0x8E, 0xEF, 0x98, 0x3A, 0xFD, 0x34, 0x8C, 0xEF, 0xF4, 0x8F,
+    0xF1, 0xB5, 0xD4, 0xDB, 0x37, 0xA5, 0x7E, 0xD1, 0x5E, 0xDB, 0x77, 0xC1, 0xD9, 0x47, 0xE1, 0x11,
+    0x4F, 0x78, 0x9C, 0x82, 0xB3, 0xA4, 0xE2, 0xFC, 0x77, 0xDF, 0xA4, 0x91, 0x7D, 0xCD, 0x7B, 0x69,
+    0x68, 0x4B, 0x83, 0xCE, 0x83, 0x7B, 0xFD, 0x47, 0x9F, 0x8D, 0xCE, 0x1D, 0x4B, 0x9C, 0x0E, 0x31,
+    0x13, 0x29, 0xE8, 0x03, 0x5D, 0x39, 0x16, 0x2B, 0x4D, 0xEA, 0x09, 0x26, 0xA9, 0xC3, 0xB6, 0xE8,
+    0x5C, 0xE9, 0x70, 0x0D, 0xC5, 0x01, 0x62, 0xC5, 0x0F, 0x52, 0xCB, 0x06, 0x57, 0x7D, 0x8E, 0xEC,
+    0x6B, 0x5B, 0x37, 0xB3, 0x2D, 0xC9, 0xD0, 0x78, 0x22, 0xB4, 0xA4, 0xBA, 0xC2, 0x22, 0xA3, 0x5F,
+    0x7E, 0x33, 0x6C, 0x97, 0x9F, 0x5D, 0xA7, 0x6C, 0x32, 0x05, 0x49, 0xD6, 0x78, 0x96, 0x4F, 0xA5,
+    0x2E, 0xBE, 0xAF, 0xBA, 0xDE, 0x9B, 0xE2, 0x0F, 0x38, 0xFE, 0x06, 0xAD, 0x55, 0x3B, 0x8E, 0xD4,
+    0x40, 0x10, 0x2D, 0xDB, 0xDA, 0xB1, 0xB4, 0x16, 0x72, 0x0E, 0x81, 0x73, 0x08, 0x7C, 0x84, 0xF6,
+    0x92, 0x10, 0x10, 0x90, 0x30, 0x1C, 0x82, 0x4B, 0xD8, 0x62, 0x03, 0x52, 0x02, 0x2E, 0x80, 0xB4,
+    0x04, 0x3B, 0x5C, 0x01, 0xC9, 0x46, 0x04, 0x84, 0xF8, 0x06, 0x4C, 0x4A, 0x84, 0x85, 0x3A, 0x68,
+    0x24, 0xDB, 0x45, 0xFD, 0xEC, 0x35, 0x62, 0x25, 0x58, 0xED, 0x3A, 0x18, 0xF5, 0xD8, 0xD5, 0x55,
+    0xF5, 0xDE, 0xAB, 0xD7, 0x0D, 0x20, 0x4F, 0x34, 0xA7, 0x41, 0x57, 0x90, 0x05, 0x77, 0xB4, 0xA5,
+    0xEB, 0xB1, 0xD2, 0x55, 0x8C, 0x4F, 0x27, 0x7B, 0x99, 0x8F, 0x6E, 0xB0, 0xE5, 0xCB, 0x77, 0x87,
+    0x06, 0x6E, 0xFF, 0xDC, 0x7F, 0xBB, 0xAC, 0x0A, 0x5C, 0xAA, 0x24, 0x88, 0xB3, 0x2D, 0xEB, 0x75,
+    0x99, 0x62, 0xD5, 0x8E, 0xF6, 0xB2, 0x87, 0xDA, 0x6B, 0x24, 0x6D, 0x41, 0xED, 0xB8, 0x3C, 0x42,
+    0x84, 0x9D, 0xE0, 0xF9, 0xCE, 0x29, 0xD6, 0x0A, 0xB9, 0x81, 0xCB, 0x11, 0x2D, 0x94, 0xB3, 0x1A,
+    0xB8, 0x98, 0x56, 0x96, 0xF5, 0x64, 0xBF, 0xAF, 0x87, 0x75, 0x17, 0x2A, 0xB8, 0x13, 0xC6, 0xAC,
+    0x7C, 0x60, 0xB5, 0x43, 0xFD, 0x8E, 0xB8, 0xEC, 0x4F, 0x78, 0x15, 0xD6, 0xF4, 0x5A, 0x9F, 0x42,
+    0xD7, 0xA4, 0xF5, 0xFA, 0x12, 0xDA, 0x25, 0x92, 0x7A, 0xC5, 0x5F, 0xD7, 0x50, 0x11, 0x5F, 0x9C,
+    0xBE, 0x81, 0xF6, 0xD5, 0x0C, 0xB9, 0x77, 0x7D, 0xC4, 0xA4, 0xBB, 0x01, 0xBB, 0x14, 0x8B, 0xF1,
+    0x2A, 0x26, 0x9B, 0x2B, 0xAE, 0xD4, 0xC0, 0x7C, 0x36, 0xC3, 0x3D, 0x48, 0xB8, 0x21, 0x47, 0xAD,
+    0x26, 0x9C, 0xBA, 0x6E, 0x80, 0x6B, 0x94, 0xD2, 0x5C, 0x4E, 0x9F, 0x92, 0x19, 0x1A, 0x22, 0xA5,
+    0xF8, 0x80, 0x9E, 0x3A, 0x9D, 0xF8, 0x0B, 0xC0, 0xA3, 0xB9, 0x5A, 0xD3, 0xED, 0x0F, 0x1F, 0xA5,
+    0xF3, 0x51, 0x9A, 0x1E, 0xA5, 0x5F, 0xA2, 0x74, 0xFF, 0xFC, 0x46, 0x1A, 0x9E, 0x5E, 0x40, 0x7C,
+    0xC9, 0x3C, 0xA5, 0x23, 0x64, 0x23, 0x13, 0x9E, 0x4E, 0x50, 0x0C, 0x5C, 0xDE, 0xF5, 0x2C, 0x45,
+    0xDB, 0x11, 0xD1, 0x15, 0x75, 0x15, 0xE1, 0x39, 0xCB, 0x89, 0x5F, 0x18, 0x12, 0x7E, 0x0B, 0x42,
+    0xE6, 0x20, 0xE4, 0xF4, 0xC2, 0x56, 0x27, 0xF4, 0x09, 0x89, 0xA2, 0x7B, 0x29, 0xD8, 0x4B, 0x51,
+    0x5B, 0x47, 0x4F, 0x02, 0x1F, 0xB0, 0x3C, 0x39, 0xA3, 0xB1, 0xB1, 0x29, 0xD1, 0xCB, 0x4E, 0xD9,
+    0xBF, 0x92, 0x1B, 0xBD, 0xA0, 0xB0, 0x4C, 0x20, 0x45, 0x24, 0x44, 0x2F, 0x28, 0x29, 0xEF, 0xEE,
+    0xF0, 0x7E, 0x7F, 0x9B, 0xA1, 0x2D, 0xBC, 0x4E, 0x5E, 0x03, 0x6D, 0xC3, 0xB8, 0x09, 0x2B, 0xB4,
+    0x3D, 0xC1, 0x85, 0x74, 0x86, 0xBA, 0xE3, 0x56, 0x73, 0xCF, 0xD3, 0xF1, 0x98, 0x41, 0x94, 0x81,
+    0x5F, 0x45, 0xF8, 0x35, 0xC0, 0xD2, 0x34, 0x48, 0x33, 0xD4, 0x5A, 0xD0, 0x21, 0xD1, 0x59, 0x92,
+    0xE9, 0x74, 0xA3, 0xFE, 0x11, 0x91, 0xD4, 0x8D, 0x3A, 0x81, 0x82, 0x39, 0x52, 0xBA, 0x4A, 0x99,
+    0xAF, 0x44, 0xA7, 0x50, 0x51, 0xA7, 0xD8, 0xFC, 0x3D, 0x4D, 0x90, 0xF9, 0x92, 0x0A, 0xF1, 0x40,
+    0xD1, 0xA6, 0xA1, 0x95, 0xD6, 0x38, 0xBC, 0xFE, 0xB9, 0x8C, 0xE5, 0x3F, 0x1E, 0x12, 0x93, 0x70,
+    0xE5, 0x22, 0x2C, 0x6B, 0xEB, 0x19, 0x62, 0x39, 0xB0, 0xAA, 0xAE, 0xE3, 0x5F, 0x2A, 0x1B, 0xE3,
+    0x19, 0x72, 0x6B, 0x9F, 0x37, 0xDA, 0xFE, 0xF0, 0xA2, 0xEA, 0x20, 0xF0, 0x7A, 0xE9, 0xB2, 0xB9,
+    0x4B, 0x6D, 0x1F, 0x36, 0x97, 0x9C, 0xFA, 0x93, 0x94, 0xE4, 0xA1, 0x8A, 0xF0, 0xC9, 0xC4, 0x94,
+    0x3C, 0x93, 0xDF, 0xAD, 0x67, 0xFE, 0x53, 0x4E, 0x42, 0x9A, 0x05, 0x53, 0x33, 0x9B, 0x98, 0x7A,
+    0x15, 0x93, 0x31, 0x56, 0xA6, 0x65, 0x8C, 0xAF, 0xC7, 0x55, 0x4A, 0x95, 0x42, 0x95, 0x6C, 0x05,
+    0x5D, 0xBD, 0x41, 0xA7, 0x3A, 0x3A, 0x7F, 0x25, 0xA3, 0x00, 0x10, 0x74, 0x85, 0xA0, 0x53, 0x11,
+    0xDD, 0x06, 0x5D, 0x1D, 0xAE, 0xEF, 0x8E, 0xEC, 0x04, 0xF5, 0x11, 0x8A, 0x20, 0x47, 0x1C, 0x9D,
+    0x52, 0x29, 0xCA, 0xAA, 0x98, 0xF8, 0x58, 0xBC, 0xB1, 0x53, 0xCD, 0xAA, 0xE6, 0x55, 0x33, 0xAB,
+    0xB9, 0xD5, 0xEC, 0x6A, 0x7E, 0x5D, 0x0C, 0x6B, 0xAA, 0x9A, 0x65, 0x0D, 0xB9, 0x99, 0xD6, 0x5C,
+    0x6B, 0xD2, 0x1A, 0x7A, 0x13, 0xD7, 0xD4, 0x35, 0x79, 0x55, 0x5F, 0xA5, 0x60, 0x31, 0x82, 0x9D,
+    0xFA, 0xAA, 0xB1, 0xD1, 0xB0, 0x71, 0x30, 0x85, 0x32, 0x79, 0xD4, 0xB0, 0x9C, 0xE8, 0xF4, 0x99,
+    0x53, 0xE5, 0x93, 0x1A, 0x84, 0x1C, 0xE3, 0xC2, 0x6D, 0x6F, 0x20, 0xBA, 0x4D, 0xD8, 0xAC, 0xE6,
+    0x66, 0xAE, 0xC3, 0xDC, 0xD8, 0x08, 0x50, 0x83, 0x21, 0x52, 0x55, 0xC5, 0xD2, 0x8C, 0x81, 0xA3,
+    0x6C, 0x12, 0xD8, 0x76, 0xE6, 0x51, 0x34, 0xF8, 0x0A, 0xC4, 0x06, 0x82, 0xF8, 0x1B, 0x61, 0x63,
+    0x6E, 0x0A, 0xB3, 0xDB, 0xD5, 0xFF, 0x71, 0xCD, 0xD8, 0x1D, 0xB3, 0xD3, 0xA8, 0xC2, 0x72, 0xA9,
+    0x7D, 0x16, 0x9B, 0xD3, 0x5E, 0x65, 0xB1, 0x0E, 0x70, 0x37, 0xCF, 0x6F, 0xA5, 0x54, 0xB1, 0xAE,
+    0xDD, 0x44, 0x10, 0x9D, 0xBB, 0x26, 0x58, 0xB0, 0xC5, 0xD2, 0xA4, 0x49, 0xE3, 0x3A, 0x05, 0xF8,
+    0x13, 0xD6, 0x4A, 0x4A, 0x1A, 0x8A, 0xDC, 0x9F, 0x78, 0xDF, 0x00, 0xD8, 0xFC, 0xC1, 0xFB, 0x84,
+    0x14, 0x29, 0x1E, 0xE1, 0x17, 0x10, 0x6B, 0x41, 0x41, 0x89, 0x7B, 0x1A, 0x83, 0x90, 0xA0, 0xC3,
+    0x48, 0x96, 0x70, 0xD0, 0xDA, 0xC3, 0x39, 0xB3, 0x97, 0xE4, 0x3D, 0x21, 0xF1, 0x10, 0x5C, 0x69,
+    0x77, 0xF6, 0x8E, 0x67, 0x67, 0x67, 0xCE, 0x9C, 0x19, 0x71, 0x2F, 0xDE, 0xBD, 0x96, 0xF4, 0x64,
+    0x97, 0xB0, 0xC6, 0xC9, 0xA9, 0xCF, 0x12, 0x17, 0x1D, 0xBD, 0xB6, 0x59, 0xF8, 0x7B, 0x0B, 0xEB,
+    0x94, 0x25, 0x4C, 0x71, 0x70, 0xB9, 0x5A, 0x24, 0x8E, 0x49, 0xAA, 0x2D, 0x4C, 0x92, 0x3A, 0x68,
+    0x97, 0xB6, 0x13, 0x85, 0xB6, 0x9D, 0x3F, 0x95, 0x7A, 0xF7, 0xB3, 0xE8, 0x98, 0xBA, 0x94, 0xBD,
+    0xAA, 0x0E, 0xBD, 0xEA, 0x5A, 0xE1, 0x20, 0x41, 0xBF, 0x5F, 0xE4, 0xC1, 0x47, 0x07, 0x3C, 0xE1,
+    0x9E, 0x38, 0x3A, 0x8E, 0xA3, 0xC0, 0x0D, 0x0E, 0x7D, 0x27, 0xF2, 0xB9, 0x7B, 0xE1, 0xB7, 0x76,
+    0x8E, 0x93, 0x3E, 0xD1, 0x0F, 0xF7, 0x90, 0xE3, 0xD2, 0xFF, 0xA6, 0x23, 0x5F, 0x7F, 0xEE, 0x86,
+    0x7A, 0x6C, 0xE4, 0x03, 0xF9, 0x52, 0x96, 0x6A, 0xC6, 0xB1, 0x7B, 0x9F, 0xC7, 0x7A, 0xA9, 0xA6,
+    0x34, 0x06, 0x3D, 0x24, 0xEA, 0x2A, 0xED, 0xCF, 0xB0, 0x6D, 0x61, 0x0D, 0x7F, 0xF5, 0x54, 0x8E,
+    0x7C, 0x18, 0x61, 0x61, 0x1F, 0x05, 0xDB, 0x61, 0x8A, 0x4D, 0x9A, 0x95, 0x5E, 0xD3, 0x68, 0x16,
+    0x3C, 0x86, 0xCD, 0x14, 0xD3, 0x1B, 0x85, 0xA5, 0xDD, 0x2F, 0xD8, 0x9C, 0x0E, 0x54, 0xEC, 0xB7,
+    0x14, 0xBC, 0x18, 0xCC, 0x2E, 0xF2, 0xE2, 0x49, 0x79, 0xD1, 0x17, 0x85, 0x76, 0x54, 0x64, 0x53,
+    0x2C, 0xA6, 0xE1, 0x75, 0x31, 0x7F, 0xB5, 0x29, 0x1E, 0x75, 0x06, 0xE9, 0xD5, 0xCB, 0x1B, 0x49,
+    0x30, 0x54, 0xAC, 0x5C, 0xF0, 0x20, 0x14, 0xD5, 0x5A, 0xEC, 0x3C, 0x56, 0xC0, 0x6A, 0x66, 0xA4,
+    0x32, 0x15, 0xA8, 0xB8, 0xFA, 0xB9, 0x04, 0x5A, 0xE3, 0xEC, 0xB1, 0xDE, 0x2E, 0xDE, 0xE4, 0xEA,
+    0x74, 0x63, 0x52, 0x2B, 0x7B, 0xCA, 0x4A, 0x68, 0xE9, 0x94, 0x54, 0xEA, 0xA3, 0xB1, 0x1C, 0xC3,
+    0x61, 0x21, 0xFF, 0x9F, 0x5F, 0xF8, 0xE5, 0x22, 0xF3, 0x5D, 0x89, 0x07, 0x3C, 0x81, 0x68, 0x57,
+    0x09, 0x44, 0x28, 0x2E, 0xD2, 0x5C, 0x64, 0x6B, 0x72, 0x2E, 0x58, 0xF4, 0x93, 0xC4, 0xAE, 0xE0,
+    0xDF, 0x5B, 0xC4, 0xA3, 0x24, 0x93, 0x83, 0xE8, 0x99, 0xE0, 0x81, 0x4C, 0xA8, 0xA7, 0x53, 0x1C,
+    0xC1, 0x1B, 0x14, 0xC4, 0x41, 0x76, 0x15, 0xAA, 0x07, 0xB4, 0x06, 0xBF, 0x13, 0xA7, 0x34, 0xA0,
+    0x22, 0x7E, 0xA5, 0x24, 0x01, 0xA1, 0x6F, 0x28, 0x71, 0xA9, 0x45, 0x7D, 0xE7, 0x56, 0x59, 0x1A,
+    0x14, 0x7E, 0x97, 0x7E, 0x45, 0x51, 0x50, 0xF4, 0xB4, 0x50, 0x82, 0x9B, 0x8B, 0xF4, 0x60, 0x82,
+    0x94, 0xEA, 0x88, 0x7C, 0x31, 0x1B, 0x3E, 0x1B, 0x81, 0x16, 0x7D, 0xCA, 0x3A, 0x37, 0x6B, 0x4F,
+    0x86, 0x16, 0xE8, 0xD8, 0x07, 0x80, 0xF9, 0xE5, 0xA3, 0x9B, 0x7F, 0x85, 0xCE, 0x3B, 0xA5, 0x1E,
+    0x5A, 0x20, 0x99, 0xE5, 0x31, 0x32, 0x42, 0xC4, 0x24, 0xE4, 0x28, 0x1F, 0x5B, 0x8D, 0x59, 0x36,
+    0x20, 0xB0, 0x59, 0xA1, 0x03, 0xEC, 0x93, 0x9C, 0xFE, 0xB8, 0x96, 0x00, 0x7C, 0x10, 0xDF, 0x4E,
+    0x92, 0x0E, 0x40, 0xEE, 0x13, 0x74, 0x5A, 0x86, 0x71, 0x18, 0x51, 0xF7, 0xEC, 0x72, 0xBD, 0x49,
+    0xF8, 0x4C, 0xBB, 0xD4, 0x01, 0x96, 0x25, 0x30, 0xAB, 0x7C, 0x22, 0x3C, 0xBB, 0xB4, 0x96, 0x8A,
+    0xFB, 0xEA, 0x82, 0x26, 0x97, 0x3F, 0x0C, 0x78, 0x32, 0x96, 0x59, 0x54, 0xC0, 0x8F, 0x21, 0xA1,
+    0x9D, 0x49, 0x56, 0x30, 0x36, 0xAE, 0x46, 0xE2, 0x70, 0x18, 0xF3, 0x7F, 0x37, 0x92, 0xD7, 0x7A,
+    0xA1, 0xAC, 0x5E, 0x38, 0x74, 0xC9, 0xA2, 0x74, 0xA1, 0xA8, 0xB5, 0x0D, 0x50, 0x35, 0x46, 0xFB,
+    0xD7, 0x46, 0x93, 0xB9, 0x28, 0xC6, 0xAD, 0x9A, 0x95, 0xD7, 0xEF, 0x68, 0xE5, 0x74, 0x31, 0xAB,
+    0x7E, 0xAF, 0x91, 0x19, 0x1C, 0x75, 0x51, 0xDF, 0xC3, 0x33, 0x33, 0x52, 0x44, 0x1A, 0xA8, 0x14,
+    0x56, 0x8F, 0x8B, 0x5A, 0x9E, 0xF0, 0x6A, 0x6D, 0x86, 0x00, 0xCA, 0x8B, 0x57, 0xD7, 0xB7, 0x68,
+    0x07, 0x78, 0x3A, 0x74, 0x09, 0x90, 0x8B, 0x03, 0x88, 0x14, 0x16, 0x6C, 0x6E, 0xB7, 0xBE, 0xA0,
+    0x79, 0xE0, 0x56, 0x7A, 0x93, 0xD5, 0x13, 0x4B, 0x30, 0xAA, 0x6D, 0xEC, 0x9F, 0x5F, 0x81, 0x77,
+    0xFC, 0x51, 0x09, 0x4B, 0xFF, 0x13, 0xB6, 0x80, 0x60, 0xC0, 0x17, 0x26, 0x1C, 0x19, 0xA3, 0x7B,
+    0x55, 0xDE, 0x79, 0x78, 0x3E, 0x9F, 0x03, 0x08, 0xF7, 0x0D, 0xD6, 0x0F, 0x58, 0xEB, 0xDF, 0x14,
+    0x0F, 0xCE, 0xFC, 0x71, 0x94, 0xA8, 0x7E, 0x6D, 0xFB, 0x6C, 0x7B, 0x21, 0x14, 0xC9, 0xAA, 0x7B,
+    0xE4, 0xFE, 0x2D, 0xB7, 0x2D, 0x71, 0xBF, 0x4B, 0x92, 0xD6, 0xEC, 0x35, 0xC7, 0x22, 0xB7, 0xBE,
+    0xC8, 0x25, 0xE9, 0x2D, 0x47, 0xFF, 0xC9, 0xFE, 0x99, 0x3C, 0xE4, 0x34, 0x05, 0x2A, 0xED, 0x88,
+    0x31, 0x1B, 0x30, 0x24, 0x31, 0x52, 0x00, 0x1B, 0xA6, 0x37, 0x49, 0xCF, 0x49, 0x1B, 0x07, 0x50,
+    0xB1, 0x99, 0x00, 0xA8, 0x5F, 0x30, 0x6E, 0xAA, 0x8D, 0xB3, 0x67, 0x27, 0x65, 0x13, 0x3B, 0x34,
+    0x8E, 0x20, 0x5F, 0x98, 0x30, 0x80, 0x30, 0x60, 0x37, 0x0C, 0x26, 0xF0, 0x17, 0x77, 0x93, 0xF9,
+    0x1D, 0x2E, 0x7E, 0x67, 0x4F, 0xBF, 0xE0, 0xA7, 0xFB, 0xCB, 0x2F, 0x39, 0x4D, 0xBF, 0xA3, 0xF9,
+    0xAD, 0x81, 0xFE, 0xC9, 0x70, 0x7A, 0x16, 0x2C, 0xC6, 0xA9, 0xC4, 0x5A, 0x50, 0x5B, 0xEF, 0xA6,
+    0x77, 0xDB, 0x6E, 0x2E, 0x39, 0xBA, 0x92, 0xB0, 0xA4, 0x5D, 0xE2, 0x81, 0xFC, 0x39, 0x6F, 0x6B,
+    0x92, 0x78, 0x3C, 0x81, 0x49, 0x69, 0x65, 0xCD, 0x5A, 0x7E, 0xE8, 0x50, 0xF7, 0x0A, 0x05, 0x06,
+    0x08, 0xEC, 0xF0, 0x8D, 0x1F, 0x9A, 0x83, 0xE6, 0x9E, 0xA3, 0x38, 0xF2, 0xE6, 0x50, 0xEB, 0xE8,
+    0x8A, 0x4D, 0x6F, 0x37, 0x5F, 0xDB, 0xDC, 0xE3, 0x3F, 0xED, 0xE6, 0x7D, 0x4E, 0xF8, 0xA3, 0xE5,
+    0x15, 0xDC, 0x83, 0x1D, 0x3C, 0xC5, 0x5C, 0xEB, 0x00, 0x63, 0xB4, 0x94, 0xBF, 0x28, 0x20, 0x1D,
+    0x12, 0xA0, 0xF1, 0x53, 0x28, 0x34, 0x07, 0x7A, 0x9C, 0x7A, 0x4C, 0x26, 0xE5, 0xFB, 0x09, 0xA4,
+    0x43, 0x2B, 0x0E, 0x0C, 0x34, 0x57, 0x76, 0x3B, 0x96, 0x6F, 0x7C, 0x32, 0x14, 0xAE, 0xDE, 0x17,
+    0x6F, 0x89, 0xA8, 0xFF, 0xE7, 0x88, 0x60, 0xFA, 0x26, 0xA2, 0x29, 0xE6, 0xFB, 0xA6, 0xD6, 0x9F,
+    0xA5, 0x55, 0x3D, 0xAB, 0xE6, 0x44, 0x14, 0x3E, 0x49, 0xBC, 0x3B, 0x62, 0x16, 0x63, 0xB1, 0x5B,
+    0x6A, 0x1A, 0x8B, 0x2D, 0xD4, 0x58, 0x58, 0x88, 0x2E, 0x3B, 0xB1, 0xB2, 0xBD, 0x85, 0x6F, 0x27,
+    0xD8, 0x58, 0x5A, 0x59, 0x59, 0x2C, 0x26, 0xAB, 0x85, 0x60, 0xA3, 0x3F, 0x41, 0x3B, 0x11, 0x61,
+    0xB7, 0xB2, 0x10, 0x31, 0x59, 0xB6, 0xB0, 0x10, 0x21, 0x28, 0x62, 0x69, 0x10, 0x41, 0xB0, 0x31,
+    0x42, 0x8A, 0x14, 0x93, 0x1C, 0x9F, 0xE7, 0x4C, 0xDE, 0xBD, 0xBB, 0x57, 0xF6, 0x36, 0x0E, 0xCC,
+    0xC9, 0xCC, 0x9C, 0x99, 0xF3, 0xF1, 0x9C, 0x8F, 0x88, 0xA4, 0x5F, 0x88, 0x88, 0xEF, 0x45, 0xF2,
+    0x19, 0x0B, 0xC5, 0x2C, 0x26, 0x91, 0x64, 0xC3, 0xA2, 0x1A, 0x44, 0xB2, 0x80, 0x45, 0xF3, 0x00,
+    0xDB, 0xAB, 0x86, 0x5C, 0x55, 0xEF, 0x62, 0x06, 0x6C, 0xB4, 0x7F, 0x88, 0x2D, 0x25, 0x5E, 0xA7,
+    0x7C, 0xED, 0xEF, 0xBF, 0x6E, 0x21, 0xF3, 0xD1, 0xEC, 0xEE, 0x3C, 0x5B, 0xC8, 0x2E, 0x20, 0x53,
+    0x6E, 0x62, 0x66, 0x60, 0xCB, 0xB3, 0x98, 0x89, 0x9C, 0x8D, 0x27, 0x3E, 0xDD, 0xCD, 0x33, 0xCB,
+    0x23, 0xA1, 0x1A, 0xE9, 0xEA, 0x5D, 0x90, 0x09, 0x49, 0x56, 0xD9, 0x95, 0x18, 0x71, 0xBA, 0x4A,
+    0xA9, 0xBA, 0xD1, 0x87, 0x4D, 0x60, 0xFA, 0x96, 0xAA, 0x8E, 0x17, 0x09, 0x21, 0x31, 0x28, 0x32,
+    0x55, 0x3C, 0x07, 0x29, 0x49, 0xE8, 0xB6, 0x7C, 0x77, 0x7B, 0xDA, 0xC1, 0x92, 0xEA, 0x51, 0x42,
+    0x3A, 0x0A, 0xF1, 0x24, 0x37, 0x48, 0x9E, 0x27, 0xB9, 0x4C, 0xF2, 0xF8, 0x99, 0x2F, 0x05, 0x84,
+    0x0D, 0x92, 0x10, 0x4E, 0x43, 0x17, 0x80, 0x66, 0x71, 0xD3, 0xE1, 0xD3, 0x1A, 0x7F, 0x11, 0x58,
+    0xAA, 0x5A, 0x1B, 0x7F, 0x16, 0xE2, 0x0F, 0xD3, 0x48, 0x27, 0xB3, 0x48, 0xED, 0x09, 0x36, 0x0D,
+    0xBD, 0xB2, 0x27, 0x70, 0x8C, 0x74, 0x95, 0x8A, 0x9F, 0xC1, 0xF8, 0xC1, 0x44, 0x6A, 0x6F, 0xFC,
+    0x40, 0x95, 0xD8, 0x50, 0xA4, 0x2E, 0x4E, 0xA3, 0x82, 0x38, 0x92, 0x5A, 0xCA, 0x41, 0xBA, 0x31,
+    0xD3, 0xB9, 0xD0, 0xA9, 0xD1, 0x0F, 0xF0, 0x5D, 0xE5, 0x85, 0xC8, 0x3C, 0x64, 0x9B, 0xDB, 0x8A,
+    0xB5, 0x5C, 0x7D, 0xF0, 0xE1, 0xFC, 0x4E, 0x4E, 0x4E, 0x79, 0x24, 0xD5, 0xC4, 0x73, 0xF1, 0x13,
+    0x99, 0x90, 0xC4, 0x1B, 0xA2, 0x63, 0x19, 0x2A, 0xE8, 0x1D, 0x78, 0x37, 0xE3, 0xE7, 0x6A, 0xF1,
+    0xF3, 0xBC, 0x46, 0x18, 0x18, 0x4D, 0xC9, 0x16, 0xA4, 0x52, 0x4F, 0xDC, 0xB3, 0x8F, 0xA5, 0x02,
+    0x98, 0xDF, 0xDC, 0xC9, 0x81, 0xF0, 0x93, 0x7F, 0xA5, 0xBC, 0xF5, 0xCB, 0x48, 0x68, 0x9F, 0xB9,
+    0x5E, 0x02, 0xEF, 0x44, 0x3F, 0x0C, 0x86, 0xBF, 0x05, 0xEA, 0x8A, 0xB7, 0xE7, 0x96, 0x85, 0x31,
+    0xBF, 0x62, 0x62, 0xED, 0x19, 0x25, 0x2E, 0xD8, 0x51, 0x74, 0xD0, 0x0F, 0xD7, 0x2E, 0x01, 0xD7,
+    0xE5, 0xF2, 0xE7, 0x3F, 0x02, 0xD7, 0xF4, 0xEB, 0x57, 0xE0, 0x6A, 0xFF, 0xEA, 0xAF, 0x5F, 0xD1,
+    0xE8, 0x37, 0xDF, 0xED, 0xDD, 0x2A, 0xFE, 0xA3, 0x39, 0xD1, 0x3A, 0x1D, 0x6F, 0x88, 0x1F, 0x1F,
+    0x48, 0x3B, 0xC0, 0x0F, 0xB8, 0xEB, 0x5C, 0xFB, 0x0C, 0x51, 0x02, 0xC2, 0x1D, 0x10, 0x5F, 0x04,
+    0x7E, 0x57, 0xCC, 0x2C, 0xBB, 0x90, 0xEB, 0xE0, 0x74, 0x20, 0xD4, 0xA1, 0xD0, 0xBA, 0x50, 0x41,
+    0x54, 0x74, 0x04, 0xBF, 0x82, 0xC7, 0xAD, 0xD3, 0x96, 0xFB, 0xA9, 0x04, 0x42, 0x2B, 0x84, 0x38,
+    0xED, 0xBB, 0x79, 0x17, 0x7E, 0x4D, 0xDE, 0x93, 0x31, 0x9F, 0x8A, 0xA9, 0xEA, 0xB5, 0xD6, 0x2C,
+    0x60, 0x31, 0x34, 0xB7, 0xD6, 0x2C, 0xE4, 0x38, 0xF1, 0xF5, 0x96, 0xCD, 0x6E, 0x2A, 0xFA, 0x2B,
+    0xB8, 0x79, 0x8A, 0xF9, 0x8E, 0x5B, 0xCA, 0xC9, 0xF7, 0x4D, 0xBD, 0x25, 0xD1, 0x37, 0xD7, 0xDF,
+    0xCC, 0xE7, 0xE6, 0xB5, 0xAD, 0x1C, 0xFD, 0xBD, 0xE0, 0x66, 0x30, 0x8A, 0xB1, 0xBC, 0x15, 0xCE,
+    0x8C, 0x7F, 0x3B, 0x99, 0x92, 0xC1, 0xF7, 0x1D, 0x64, 0xAF, 0xF9, 0x52, 0x4C, 0xB8, 0xD8, 0x37,
+    0xAD, 0xA6, 0x21, 0x0B, 0x10, 0x3C, 0x94, 0xD0, 0xF1, 0xBE, 0xAC, 0x10, 0x5E, 0x23, 0xFC, 0xB0,
+    0x06, 0xDE, 0x00, 0x41, 0x0F, 0xFC, 0x1A, 0x4B, 0xB6, 0x29, 0xD5, 0x1F, 0x36, 0xD8, 0xCC, 0x92,
+    0x41, 0x31, 0x3E, 0x2D, 0xF2, 0xAD, 0xB8, 0x05, 0xA0, 0x25, 0xDA, 0xE6, 0xF0, 0x7F, 0xE4, 0x5D,
+    0xBF, 0x08, 0xE2, 0xED, 0x14, 0xC0, 0x0A, 0x84, 0xC9, 0x75, 0xC4, 0x86, 0xCA, 0x5F, 0xB2, 0x12,
+    0x40, 0xC9, 0x16, 0xCC, 0xE5, 0x9A, 0xB8, 0xE6, 0x8B, 0xE4, 0x40, 0x2E, 0x48, 0x33, 0x1B, 0x96,
+    0x3D, 0x2B, 0xE5, 0x39, 0x91, 0xC7, 0x8E, 0x60, 0x0F, 0xFB, 0x22, 0x5F, 0x8F, 0x2E, 0x68, 0xBF,
+    0x2F, 0xCA, 0xA3, 0x5F, 0x59, 0x3C, 0xF2, 0xAB, 0x34, 0x01, 0x04, 0xFB, 0xE9, 0xD2, 0x97, 0x6F,
+    0x59, 0x2B, 0x81, 0x96, 0xDC, 0xB8, 0x08, 0x46, 0xAA, 0x4C, 0x83, 0x9C, 0x45, 0x11, 0xF6, 0x40,
+    0x36, 0x96, 0x38, 0xA9, 0x2E, 0x55, 0x14, 0x51, 0xEA, 0x6F, 0x1A, 0x83, 0x6D, 0x05, 0xC7, 0x4B,
+    0x7F, 0xB2, 0x98, 0xAA, 0x49, 0xDC, 0x86, 0x22, 0x69, 0x91, 0xD5, 0xA2, 0x3F, 0xB1, 0xB0, 0xBA,
+    0x11, 0x4E, 0x96, 0x28, 0x44, 0xB8, 0x9A, 0xEA, 0xF7, 0x4A, 0x6F, 0x61, 0xFD, 0xCA, 0xDA, 0x44,
+    0x32, 0x24, 0x07, 0xD6, 0x55, 0x72, 0xA8, 0x25, 0x76, 0x9A, 0x63, 0x95, 0xC7, 0x4C, 0xD4, 0x8D,
+    0x55, 0x4D, 0xCD, 0xFA, 0xBA, 0x9A, 0x67, 0x1D, 0x2A, 0xC1, 0x98, 0x9E, 0x18, 0x33, 0x47, 0x4B,
+    0x58, 0x59, 0xD0, 0x52, 0xC7, 0xE7, 0x54, 0x99, 0xF2, 0x91, 0x53, 0x95, 0x87, 0xC7, 0xD5, 0x63,
+    0xC5, 0xBA, 0xFF, 0x62, 0x54, 0x1C, 0x31, 0x4A, 0xEF, 0x1F, 0xF9, 0xE3, 0x51, 0x6E, 0x26, 0x1C,
+    0xC7, 0x8B, 0xC2, 0x58, 0xC6, 0x9E, 0x89, 0xC9, 0x5A, 0x63, 0xC3, 0x74, 0x4B, 0xAC, 0x28, 0xF6,
+    0x38, 0x96, 0x11, 0xDB, 0x1C, 0x83, 0xC2, 0x7E, 0xCF, 0xF7, 0xB0, 0x94, 0x51, 0xCE, 0x38, 0xB7,
+    0xBD, 0xC7, 0x72, 0xBE, 0x2C, 0x17, 0x8D, 0xD4, 0x1A, 0x5C, 0x0F, 0x67, 0xD8, 0xDB, 0x5A, 0x8B,
+    0x93, 0xC7, 0x64, 0x3C, 0xBA, 0xE8, 0xDF, 0x53, 0x46, 0x3F, 0xB3, 0xF8, 0x5A, 0x12, 0xD8, 0xDF,
+    0x20, 0x76, 0x53, 0xD3, 0x12, 0xDB, 0x6E, 0xD2, 0x31, 0x4C, 0x0D, 0x41, 0x2C, 0xD8, 0xE9, 0x00,
+    0xD4, 0xDF, 0x0C, 0xF5, 0x86, 0xDF, 0x49, 0xF6, 0xC9, 0xCC, 0xFF, 0x03, 0xD2, 0xBD, 0x45, 0xAB,
+    0xA0, 0x79, 0x48, 0xF9, 0x99, 0xF6, 0x9B, 0xF5, 0x6C, 0x11, 0x2E, 0x94, 0x3C, 0xF8, 0x87, 0xE8,
+    0xE8, 0x6D, 0x03, 0x1B, 0x8D, 0x18, 0xFD, 0x32, 0x58, 0x0E, 0x10, 0x20, 0x9D, 0x2D, 0x62, 0xD4,
+    0x58, 0x99, 0x5E, 0xCB, 0x10, 0x67, 0x6D, 0xC4, 0x5B, 0xDD, 0xFE, 0x71, 0x81, 0xA7, 0x27, 0xA7,
+    0xE7, 0x9F, 0x58, 0x90, 0x2C, 0xD4, 0xCE, 0x62, 0xE2, 0xE3, 0x5F, 0x26, 0x58, 0x44, 0x62, 0x06,
+    0x98, 0xDA, 0x2D, 0xE6, 0xA8, 0x32, 0xEF, 0x56, 0xF4, 0xEC, 0x70, 0x38, 0x1C, 0xDE, 0x38, 0xA9,
+    0xE5, 0xB4, 0xAB, 0xAB, 0xDF, 0x91, 0x49, 0xB0, 0x14, 0x8D, 0x59, 0x6B, 0xA7, 0x83, 0xFC, 0xAF,
+    0xF1, 0x2F, 0x8D, 0x55, 0xB1, 0x8E, 0xDC, 0x36, 0x10, 0x1D, 0xAD, 0x60, 0x13, 0x81, 0xE0, 0xD0,
+    0x8D, 0x81, 0xC4, 0x46, 0x20, 0x7F, 0x80, 0x61, 0xB6, 0x29, 0x76, 0x23, 0x25, 0x5F, 0xE0, 0x22,
+    0xD7, 0xA6, 0x70, 0x6D, 0xE4, 0x7E, 0x60, 0x0F, 0x92, 0x73, 0x85, 0x8B, 0x34, 0xFB, 0x07, 0xA9,
+    0x53, 0xA5, 0x4C, 0x63, 0x40, 0x8C, 0x5B, 0x37, 0x0B, 0x04, 0x48, 0x0A, 0x17, 0xA7, 0x00, 0x81,
+    0x5D, 0xB8, 0x08, 0x81, 0x08, 0xF0, 0x1A, 0x27, 0x69, 0x3C, 0x6F, 0xC8, 0x4D, 0xD6, 0x8B, 0x0B,
+    0x62, 0xE1, 0x8E, 0x5C, 0x4A, 0xE4, 0xF0, 0xF1, 0xBD, 0x37, 0x43, 0xA2, 0xF8, 0xDC, 0x43, 0xE3,
+    0xAE, 0x11, 0x2D, 0x9E, 0x7F, 0x5F, 0xD3, 0x82, 0xD9, 0x13, 0x75, 0xBC, 0x95, 0x31, 0xB7, 0x68,
+    0x76, 0x44, 0x86, 0xF1, 0xF3, 0xCD, 0x0B, 0xF9, 0x72, 0x77, 0xF8, 0x96, 0x68, 0x7D, 0x66, 0xBF,
+    0x22, 0x57, 0xBE, 0x7A, 0x7E, 0x7E, 0xD1, 0x31, 0xFF, 0xCA, 0xFC, 0x13, 0xB7, 0xE5, 0x9C, 0xF1,
+    0xD6, 0xF0, 0xEF, 0xCC, 0x25, 0xF3, 0xE5, 0xC5, 0x93, 0x8B, 0x6F, 0x1E, 0x86, 0xFA, 0xDC, 0xD3,
+    0x8E, 0xB2, 0x9E, 0x6E, 0xA6, 0xBD, 0x8A, 0x5E, 0xBB, 0x4E, 0x5B, 0x33, 0x68, 0xD7, 0xD4, 0x68,
+    0xF3, 0x9D, 0x0E, 0x2A, 0xAF, 0x83, 0xF1, 0x60, 0xB0, 0x98, 0x74, 0xE0, 0xB6, 0x68, 0xB3, 0x59,
+    0x07, 0x65, 0xD0, 0x01, 0xEB, 0xC0, 0xEA, 0x80, 0x58, 0xE3, 0xD8, 0x18, 0xB4, 0x6B, 0x75, 0xBB,
+    0x18, 0xA7, 0xD3, 0x38, 0x26, 0x0E, 0x1A, 0x8D, 0x93, 0xC7, 0xA0, 0x95, 0xE2, 0xC9, 0x63, 0x9C,
+    0x2A, 0xD0, 0xF1, 0x73, 0x7B, 0x23, 0xBB, 0xFC, 0x28, 0x3F, 0xEE, 0x08, 0x0D, 0x59, 0x27, 0x2C,
+    0x08, 0x15, 0x23, 0x55, 0x20, 0x49, 0x4E, 0xBE, 0x2B, 0x58, 0x98, 0xC9, 0x79, 0x5B, 0x86, 0x6A,
+    0x12, 0x34, 0x79, 0x2F, 0x30, 0xBF, 0x00, 0xE2, 0x8F, 0x00, 0x61, 0x43, 0x06, 0xA7, 0x5A, 0x00,
+    0xB3, 0xC3, 0x4E, 0x16, 0x43, 0x50, 0x49, 0xD5, 0x36, 0x61, 0xD0, 0x33, 0xE8, 0x71, 0xFE, 0xFD,
+    0x08, 0xBC, 0x0A, 0xBD, 0xC0, 0xCA, 0xAE, 0x87, 0x0A, 0xD2, 0xB8, 0x19, 0xD3, 0x65, 0x7E, 0xC9,
+    0x01, 0x4D, 0x2F, 0x23, 0x4C, 0x60, 0x89, 0x63, 0x21, 0x58, 0x8E, 0xD5, 0x15, 0xC2, 0x94, 0x23,
+    0xA6, 0xE2, 0xD8, 0x98, 0x5A, 0x30, 0x1D, 0x7E, 0x74, 0x13, 0x3E, 0x82, 0x86, 0x59, 0x28, 0xB3,
+    0x7F, 0x02, 0x05, 0x0E, 0x7B, 0x93, 0x3E, 0xFC, 0x69, 0x7C, 0x22, 0x54, 0xB9, 0x73, 0x8A, 0x1F,
+    0x43, 0xDD, 0xB3, 0xBB, 0x62, 0xCF, 0x39, 0x1D, 0x82, 0x4E, 0x1E, 0x10, 0x5D, 0x3B, 0x39, 0xE6,
+    0x19, 0xDA, 0xD5, 0xC9, 0x77, 0x1F, 0xA3, 0x17, 0x35, 0xB3, 0x01, 0x44, 0x4B, 0x54, 0xE7, 0x0D,
+    0x6F, 0x44, 0x1D, 0xB1, 0x85, 0x6B, 0x89, 0xD5, 0x32, 0x2D, 0x64, 0x8F, 0xCA, 0xB3, 0xFE, 0xA9,
+    0x0F, 0x94, 0x65, 0x08, 0x31, 0x25, 0x75, 0xD5, 0x42, 0x02, 0xB4, 0x50, 0x7B, 0x09, 0x3A, 0x75,
+    0x89, 0xC4, 0x52, 0xCA, 0x85, 0x89, 0x05, 0x96, 0x36, 0x82, 0x13, 0x56, 0xA8, 0x64, 0x7B, 0x33,
+    0x01, 0x77, 0x88, 0x2A, 0x34, 0x43, 0xD4, 0xC5, 0x72, 0x32, 0x2A, 0xF0, 0x65, 0x21, 0x12, 0x4C,
+    0x06, 0x33, 0x3D, 0x1D, 0xD8, 0x8A, 0xE8, 0x7A, 0xFD, 0xA1, 0x14, 0x2A, 0x73, 0x4D, 0x88, 0x26,
+    0xC4, 0x06, 0xC5, 0x94, 0xF4, 0xC2, 0x26, 0x4E, 0x5E, 0xB8, 0x11, 0xB3, 0xFA, 0xB8, 0x49, 0x27,
+    0x0C, 0xDE, 0xFA, 0x3A, 0x29, 0xAD, 0xA7, 0x9C, 0xDE, 0x0B, 0x77, 0x97, 0x3E, 0x7D, 0x80, 0xFE,
+    0x73, 0x13, 0x3F, 0x9C, 0x35, 0x1C, 0xCD, 0x24, 0x16, 0xC5, 0x0A, 0xE6, 0x0D, 0x64, 0xCA, 0xC4,
+    0xC8, 0xC8, 0x91, 0x7C, 0xDC, 0x50, 0x31, 0xC4, 0x54, 0x43, 0x0F, 0x82, 0xF0, 0x5E, 0xFF, 0x43,
+    0xB4, 0x24, 0xE6, 0x83, 0x51, 0x98, 0x15, 0xFF, 0x80, 0x21, 0xC2, 0xE7, 0xE0, 0x50, 0xD8, 0x39,
+    0x55, 0xF3, 0xB5, 0x05, 0x2A, 0x84, 0x70, 0xEE, 0xA2, 0x05, 0xA9, 0xC2, 0xEB, 0x7C, 0x56, 0xEE,
+    0x28, 0x9B, 0xD4, 0x0D, 0x52, 0x32, 0x48, 0xD5, 0xA7, 0x4F, 0xB2, 0x84, 0x7F, 0x91, 0x98, 0x4B,
+    0x89, 0x1F, 0x2D, 0xF8, 0x7F, 0x8F, 0x78, 0x5A, 0xBD, 0x26, 0x8C, 0x54, 0xA9, 0x6F, 0x10, 0xB6,
+    0x60, 0xAF, 0xE1, 0x2D, 0x3F, 0xD6, 0xF0, 0x8E, 0xCF, 0xB5, 0xAF, 0xF8, 0xCB, 0x93, 0x5A, 0x05,
+    0xBE, 0x52, 0x96, 0x2C, 0x89, 0x66, 0x52, 0xE6, 0x17, 0x03, 0xBD, 0x87, 0x29, 0xD5, 0xA1, 0x7D,
+    0xD5, 0x49, 0x3E, 0x43, 0xBC, 0x96, 0x0E, 0x2A, 0x54, 0xCA, 0xEE, 0x7D, 0x29, 0x12, 0x84, 0x1A,
+    0x48, 0x8C, 0x63, 0x52, 0x16, 0xAB, 0x1F, 0x85, 0x37, 0xCD, 0x76, 0x30, 0xA0, 0x78, 0x44, 0x6B,
+    0xE4, 0x11, 0x64, 0xBD, 0x32, 0x10, 0x51, 0xF2, 0xED, 0x3F, 0xC5, 0x0B, 0xBC, 0xD2, 0x41, 0xE9,
+    0xDB, 0x57, 0xBD, 0x7D, 0x8D, 0x8B, 0x3A, 0xD1, 0x3E, 0x25, 0xB5, 0x1E, 0xC6, 0x5C, 0xB3, 0x63,
+    0x74, 0xA8, 0x19, 0x63, 0x99, 0xCB, 0x67, 0xCD, 0x57, 0x09, 0x54, 0xC4, 0x50, 0xC2, 0x98, 0x86,
+    0xE8, 0x9E, 0x45, 0xA1, 0xAA, 0xFE, 0x38, 0x50, 0xEA, 0x13, 0x12, 0x33, 0x1D, 0xD8, 0x58, 0x03,
+    0x25, 0x24, 0xFB, 0x8C, 0xE8, 0x12, 0x92, 0xE3, 0x40, 0x65, 0x7A, 0x6F, 0x13, 0x87, 0xA6, 0x3E,
+    0x36, 0x40, 0x43, 0xF7, 0xD7, 0xE6, 0x3B, 0xFF, 0xE6, 0x51, 0xF9, 0xF3, 0xB3, 0xD7, 0xEB, 0xD5,
+    0x9D, 0xF3, 0x3F, 0x42, 0xC5, 0xE2, 0x97, 0x3D, 0x29, 0xB4, 0x24, 0xEB, 0x45, 0xA3, 0xCB, 0x7A,
+    0x19, 0x6C, 0x99, 0xF3, 0x58, 0x71, 0x6B, 0x3C, 0x3D, 0x95, 0x3D, 0x07, 0x29, 0xC6, 0x9F, 0x11,
+    0x05, 0x10, 0x55, 0x0A, 0xB2, 0x15, 0xD1, 0x70, 0xA3, 0xF4, 0xCD, 0xBC, 0xE0, 0x70, 0xFD, 0x2D,
+    0xD1, 0x69, 0xEF, 0x66, 0xD3, 0xD2, 0xE5, 0xC6, 0x71, 0x3E, 0xEC, 0x56, 0xC5, 0x13, 0x3F, 0xAC,
+    0x4E, 0x65, 0x8D, 0x9E, 0xAE, 0xE4, 0x57, 0x22, 0xC9, 0x53, 0x59, 0xE4, 0xA8, 0xAC, 0xAD, 0x37,
+    0x7D, 0x1E, 0xB2, 0x91, 0x26, 0xBA, 0xA5, 0xF7, 0x4F, 0xFE, 0xDA, 0xDF, 0x2F, 0xEA, 0x61, 0x8D,
+    0x7B, 0x6E, 0xA6, 0xDD, 0xCA, 0xF8, 0x9D, 0xFB, 0x41, 0x42, 0x6B, 0xEE, 0xBB, 0xD6, 0xFC, 0xE5,
+    0x97, 0x76, 0xE1, 0xEF, 0x59, 0x0A, 0xCB, 0xD2, 0x4B, 0xBA, 0x76, 0x03, 0x15, 0x9E, 0xC7, 0x3C,
+    0x19, 0x5E, 0xCF, 0xFC, 0x9B, 0xB0, 0x24, 0xF7, 0x63, 0x8F, 0xCA, 0x16, 0xD0, 0xEC, 0x64, 0x9A,
+    0xDC, 0x12, 0x8C, 0xF3, 0xB0, 0xDC, 0x17, 0x72, 0x59, 0x14, 0x83, 0xD8, 0xC5, 0xA2, 0x29, 0x83,
+    0x5C, 0x03, 0x2E, 0x08, 0xE5, 0x55, 0x28, 0x77, 0xD4, 0xF4, 0x4E, 0x26, 0x6D, 0xAB, 0x41, 0xA6,
+    0x37, 0x41, 0x08, 0xE9, 0x02, 0x4A, 0x83, 0x6B, 0xF3, 0x17, 0xED, 0xD2, 0x66, 0x2F, 0x97, 0x76,
+    0x1D, 0x56, 0x97, 0x8F, 0xFF, 0x3E, 0x2B, 0x7E, 0x09, 0xEE, 0xB4, 0xED, 0x46, 0x41, 0x9A, 0xBD,
+    0xFD, 0xAF, 0x5C, 0x7A, 0x07, 0xCD, 0x55, 0x3D, 0x8C, 0x1D, 0x35, 0x10, 0x9E, 0x5D, 0xF3, 0xB2,
+    0x12, 0x96, 0x30, 0x05, 0x34, 0x9C, 0x14, 0x37, 0x54, 0x14, 0x6C, 0x7B, 0xC5, 0x5D, 0xBC, 0x08,
+    0x29, 0x29, 0xD2, 0x5C, 0x73, 0x4A, 0x41, 0x91, 0x1E, 0x8A, 0x34, 0x94, 0xA0, 0x5D, 0x44, 0x41,
+    0x7B, 0xE2, 0xA7, 0x26, 0x25, 0xBA, 0x26, 0x0D, 0xE5, 0xE5, 0xAD, 0x81, 0x22, 0x65, 0x9C, 0x48,
+    0x11, 0xED, 0x22, 0x45, 0x42, 0x50, 0x59, 0x62, 0x25, 0xF6, 0x45, 0xEB, 0x1D, 0x66, 0xC6, 0xFB,
+    0xEE, 0x08, 0x82, 0x1E, 0xEB, 0x34, 0xDE, 0xB3, 0xE7, 0xEF, 0xFB, 0x66, 0xC6, 0x0F, 0x36, 0x8D,
+    0x0D, 0x26, 0x96, 0x17, 0xF0, 0x2E, 0x98, 0xA6, 0xF2, 0x65, 0x84, 0xA9, 0xDC, 0x7E, 0x89, 0x13,
+    0x26, 0xB8, 0x17, 0x00, 0xC7, 0x22, 0x5C, 0x00, 0xD0, 0xDF, 0x04, 0x2A, 0x82, 0x09, 0xD0, 0x76,
+    0x6A, 0x01, 0x93, 0x3A, 0x8B, 0xDE, 0xA1, 0x87, 0x0F, 0xC1, 0x60, 0xF3, 0xFA, 0x75, 0x80, 0x43,
+    0xA8, 0x42, 0x95, 0xC0, 0x8D, 0x50, 0xC6, 0x37, 0x6C, 0x87, 0xA9, 0xC2, 0xE1, 0x20, 0x01, 0xC0,
+    0x19, 0x1C, 0x83, 0xF1, 0xEA, 0x02, 0x7E, 0xED, 0x0E, 0xBF, 0x37, 0x77, 0xBF, 0xC2, 0xF4, 0x0E,
+    0x7A, 0x35, 0xD0, 0x69, 0x15, 0x8A, 0xF3, 0x33, 0x97, 0x54, 0x07, 0x1F, 0x83, 0x99, 0x00, 0xC9,
+    0x7F, 0x03, 0xE3, 0xDB, 0xB5, 0xC2, 0xD8, 0xCE, 0xE5, 0x0E, 0xA0, 0x8E, 0x0A, 0xFD, 0x31, 0x14,
+    0x01, 0xCC, 0x16, 0xDA, 0xA5, 0x9C, 0x2E, 0xCC, 0x67, 0xF1, 0xB8, 0xF2, 0xBB, 0x87, 0xA4, 0x52,
+    0x52, 0x30, 0xFC, 0x02, 0x47, 0xB0, 0x40, 0xDE, 0x3E, 0xA1, 0x18, 0xC5, 0x08, 0x0E, 0xF4, 0x00,
+    0x33, 0xD4, 0x5D, 0x71, 0x02, 0xB0, 0x69, 0x4A, 0xEC, 0x6A, 0x03, 0xF1, 0x48, 0xFD, 0x18, 0x35,
+    0x42, 0x3D, 0x55, 0x61, 0xBC, 0xA1, 0xC2, 0xD2, 0x2B, 0x1C, 0xCB, 0x05, 0xE0, 0xAD, 0xA6, 0xC2,
+    0xE6, 0xC8, 0x96, 0xFE, 0xE8, 0x35, 0x88, 0x87, 0x9C, 0x34, 0x27, 0x51, 0xF9, 0xAF, 0x3F, 0x55,
+    0x38, 0x58, 0x4E, 0xFE, 0x72, 0x55, 0xCF, 0x49, 0xD8, 0x91, 0x44, 0x3B, 0x90, 0xC0, 0x0E, 0x40,
+    0x21, 0x7D, 0x98, 0x99, 0x44, 0x7D, 0x75, 0xEE, 0x01, 0x4A, 0x3E, 0xAF, 0xD2, 0xFE, 0x52, 0x8C,
+    0x1C, 0x5F, 0xB6, 0x7E, 0xB5, 0x2C, 0x58, 0x43, 0xD4, 0x88, 0x4B, 0xD2, 0x9D, 0xF7, 0x42, 0xB3,
+    0x20, 0x2A, 0x48, 0x8C, 0x7B, 0x61, 0xE3, 0xBF, 0x88, 0xF1, 0x52, 0x4C, 0xFB, 0x38, 0x57, 0x42,
+    0x8B, 0x53, 0x71, 0x9F, 0x45, 0x43, 0x21, 0x3F, 0xF2, 0x2B, 0x92, 0x03, 0xFE, 0xA8, 0xE3, 0x5E,
+    0x59, 0x54, 0x24, 0xEF, 0x8C, 0x40, 0xB0, 0xE4, 0x1B, 0x76, 0x53, 0xB0, 0x31, 0xF4, 0x7E, 0x8F,
+    0x21, 0x1B, 0x4E, 0xFB, 0x84, 0x57, 0x1D, 0x71, 0xD1, 0xAC, 0xE8, 0x32, 0x4E, 0x27, 0x22, 0xBC,
+    0x64, 0x57, 0xC7, 0xFF, 0xC0, 0x73, 0x75, 0xEB, 0x2E, 0x45, 0xCB, 0xA2, 0x17, 0x52, 0xC3, 0x9A,
+    0x61, 0xC1, 0x42, 0x09, 0xF7, 0xBF, 0x09, 0x96, 0xF2, 0xFE, 0x77, 0xBC, 0xE9, 0x27, 0x9C, 0x10,
+    0x98, 0x9F, 0xD8, 0x04, 0xEA, 0xCF, 0x65, 0x73, 0x9A, 0xCD, 0x60, 0x6B, 0x04, 0xF8, 0x6C, 0x39,
+    0xBD, 0x6B, 0x8B, 0x13, 0x38, 0xC8, 0x3E, 0x34, 0x22, 0xE7, 0xEC, 0x68, 0x63, 0xFF, 0x88, 0x0B,
+    0x3B, 0xC7, 0x07, 0x84, 0xCB, 0x20, 0xB2, 0x59, 0x8D, 0xC9, 0xD2, 0xE6, 0x96, 0x99, 0xCD, 0xF0,
+    0xC5, 0xD4, 0x72, 0x0E, 0x7F, 0xC4, 0x87, 0xAC, 0xF8, 0xF3, 0x30, 0xF3, 0xF6, 0xF8, 0xE9, 0xC4,
+    0xAE, 0xBE, 0xE5, 0xD8, 0x06, 0xDB, 0x5B, 0x03, 0x6F, 0x3D, 0x5B, 0x1B, 0x5C, 0x2C, 0x85, 0xB1,
+    0x38, 0xBB, 0x9B, 0xBC, 0xA5, 0x76, 0xCB, 0x9B, 0xC4, 0xA1, 0x00, 0xD4, 0x6C, 0x92, 0xC2, 0xCC,
+    0xB5, 0x92, 0x4D, 0xE5, 0x8D, 0x53, 0x99, 0x72, 0x96, 0x5C, 0x8B, 0xD9, 0x09, 0x52, 0x8E, 0x4D,
+    0x2A, 0x51, 0xBA, 0x52, 0xFF, 0x32, 0x67, 0xC0, 0xAC, 0x00, 0x9B, 0xF7, 0x4E, 0xE0, 0xA5, 0x75,
+    0x80, 0x4C, 0x4F, 0x8D, 0x38, 0x88, 0x4C, 0x39, 0x9E, 0x97, 0x38, 0x13, 0xFB, 0xFF, 0xFD, 0x01,
+    0xE3, 0xE6, 0x5A, 0x69, 0xA9, 0x7C, 0x81, 0x99, 0x32, 0xF1, 0x5A, 0xC9, 0x05, 0x4D, 0x82, 0xFA,
+    0x33, 0x52, 0xBE, 0xD0, 0x22, 0xF5, 0xEA, 0xA0, 0x49, 0xC5, 0x25, 0x2E, 0xB0, 0xC2, 0x60, 0x03,
+    0xB3, 0x52, 0x4A, 0xEA, 0x93, 0xBB, 0xE9, 0x49, 0x87, 0x3D, 0x33, 0x00, 0xA2, 0x94, 0x19, 0x1D,
+    0xF3, 0x3F, 0x19, 0x70, 0x14, 0x4C, 0x98, 0x11, 0x0E, 0x82, 0x37, 0xC1, 0x3F, 0x16, 0x57, 0xBA,
+    0x90, 0x5B, 0xA9, 0x8E, 0x5D, 0x3E, 0x98, 0xB9, 0xBB, 0x5E, 0xED, 0xC0, 0x75, 0x99, 0x8C, 0x59,
+    0x50, 0x74, 0x85, 0x78, 0xDF, 0xB4, 0xDF, 0x9C, 0x92, 0x3F, 0xC1, 0xCF, 0x0A, 0xA5, 0x84, 0x91,
+    0x5A, 0xAE, 0x41, 0xA4, 0x01, 0x95, 0x20, 0x92, 0x4F, 0x2B, 0xC3, 0xC8, 0x15, 0xAF, 0x99, 0x57,
+    0xD6, 0x7A, 0x2E, 0x06, 0xBE, 0x92, 0x62, 0xF4, 0x39, 0x51, 0x59, 0x32, 0x78, 0xE7, 0xF7, 0xF3,
+    0x3C, 0x12, 0x2B, 0x32, 0x24, 0x44, 0x85, 0x34, 0xB9, 0xA6, 0x7E, 0xEC, 0xA5, 0x11, 0x27, 0xE9,
+    0x54, 0x4A, 0x28, 0x4F, 0x44, 0x8F, 0x3E, 0x1B, 0x10, 0x75, 0xD9, 0x40, 0xF8, 0xE2, 0xB4, 0xBB,
+    0x3E, 0xB0, 0x41, 0x1F, 0xC9, 0x80, 0x51, 0xF0, 0xBA, 0xBD, 0xEE, 0x8F, 0xD6, 0xDD, 0x13, 0x68,
+    0xBB, 0xCB, 0x06, 0xB7, 0x30, 0x1B, 0x78, 0xC9, 0xA9, 0xC4, 0xE8, 0xA4, 0x25, 0x70, 0x32, 0xC2,
+    0x5C, 0x9B, 0x4A, 0x69, 0xDA, 0x9A, 0xAB, 0x23, 0x06, 0xDE, 0xF2, 0x94, 0xD0, 0x9B, 0xAB, 0xB2,
+    0x01, 0x3D, 0xA7, 0x02, 0x1D, 0xCE, 0xCF, 0xCF, 0x64, 0xCA, 0xA5, 0x97, 0x6C, 0xEE, 0x2C, 0x61,
+    0x10, 0x54, 0xE2, 0x91, 0x73, 0x12, 0xFB, 0x69, 0x4E, 0x61, 0x73, 0x67, 0x39, 0xBD, 0x9B, 0x4E,
+    0xF8, 0x69, 0xE1, 0xF1, 0xC3, 0x67, 0xF7, 0x08, 0xF0, 0xDA, 0x96, 0x5C, 0xC8, 0x20, 0xB6, 0x29,
+    0xB3, 0x17, 0x2E, 0xFD, 0xF5, 0xB8, 0xDB, 0xBF, 0x33, 0x2B, 0xCF, 0x74, 0x26, 0x5C, 0x2A, 0x69,
+    0x2F, 0x02, 0x96, 0xCF, 0xC6, 0xBF, 0x9F, 0x61, 0x3E, 0xCB, 0xEA, 0xC2, 0x66, 0xE6, 0x7E, 0xDF,
+    0x1B, 0xED, 0x8A, 0xA0, 0xDC, 0xDD, 0x19, 0xF3, 0x4D, 0xD0, 0x83, 0x7C, 0x38, 0xB0, 0xD2, 0xA2,
+    0xC5, 0x0C, 0x5B, 0x39, 0xD0, 0x43, 0xEE, 0x04, 0x6A, 0x05, 0x9A, 0xBC, 0x02, 0xCF, 0x80, 0xEA,
+    0xC9, 0xF4, 0x84, 0x2A, 0xEA, 0x09, 0x8A, 0xA5, 0xE7, 0x39, 0xF0, 0xA0, 0xFD, 0x2B, 0x20, 0xF9,
+    0xDF, 0x10, 0x08, 0x9E, 0x7F, 0xD6, 0x18, 0x44, 0x07, 0xFC, 0x73, 0xD3, 0x33, 0xA7, 0xD4, 0xFD,
+    0x0A, 0xDF, 0x9F, 0x65, 0x32, 0xCC, 0xA8, 0xA3, 0x9C, 0xB4, 0x41, 0x5E, 0x32, 0xA4, 0x37, 0x9B,
+    0x41, 0x96, 0xB3, 0x99, 0x89, 0x3D, 0x18, 0x0C, 0xD5, 0x93, 0xB8, 0xD2, 0x2F, 0xF0, 0x07, 0x2A,
+    0xF1, 0x40, 0x1E, 0x92, 0x5E, 0xE8, 0x81, 0xA2, 0x8E, 0x1A, 0xDC, 0x68, 0x16, 0x72, 0xB2, 0xC0,
+    0x69, 0xF3, 0xE6, 0x09, 0x5C, 0xCB, 0x43, 0xF5, 0xBF, 0x5B, 0x7F, 0x01, 0xBD, 0x55, 0x31, 0x8F,
+    0xDD, 0x44, 0x10, 0x1E, 0xDB, 0x70, 0x26, 0xB8, 0xD8, 0x14, 0x5C, 0x03, 0xC5, 0xEB, 0x29, 0xF0,
+    0x4F, 0xF0, 0x53, 0x1A, 0xDA, 0x2B, 0xEE, 0x01, 0x65, 0x6A, 0x28, 0xEE, 0x27, 0xAC, 0x25, 0x4A,
+    0x9A, 0x48, 0xE4, 0xA0, 0x4D, 0x91, 0x02, 0x0E, 0xA4, 0xEB, 0x91, 0xC8, 0x1A, 0xE5, 0x07, 0xE0,
+    0x80, 0x48, 0x6D, 0x41, 0xA0, 0xBD, 0x8D, 0x30, 0xC8, 0xCA, 0xAD, 0x3D, 0xCC, 0x37, 0xE3, 0xC7,
+    0x3B, 0x02, 0x35, 0xAB, 0xD3, 0xEC, 0xF3, 0xEC, 0xEC, 0xCC, 0x37, 0xDF, 0xCC, 0xCE, 0x11, 0xE9,
+    0x2A, 0x47, 0xA2, 0x2A, 0xD2, 0xA6, 0x27, 0x6A, 0x5A, 0xF2, 0xA2, 0x99, 0x29, 0x4B, 0xA2, 0x8F,
+    0xF8, 0x83, 0x6E, 0xD3, 0x41, 0x27, 0x47, 0xA7, 0xA2, 0xC8, 0x53, 0x31, 0xD4, 0x1D, 0x79, 0xC6,
+    0x7A, 0xAC, 0x72, 0xDE, 0xE8, 0x16, 0x8B, 0xE4, 0xC7, 0x45, 0x9C, 0x3D, 0xE7, 0x1F, 0xE5, 0x62,
+    0xFD, 0x3D, 0x9F, 0xC9, 0x45, 0xF6, 0xB3, 0xE8, 0x0A, 0xE6, 0x6B, 0x89, 0xE3, 0xF8, 0x8A, 0x45,
+    0xD7, 0xB0, 0x17, 0x1D, 0x71, 0x0A, 0x23, 0x8E, 0x7E, 0x80, 0xCE, 0x71, 0xC5, 0xA2, 0x6B, 0xA6,
+    0x7A, 0xC2, 0x51, 0x1F, 0x3A, 0x1C, 0x65, 0xD0, 0xB9, 0xA9, 0x9C, 0xE8, 0xB0, 0x1E, 0x9D, 0x43,
+    0x8A, 0xC7, 0x01, 0x67, 0x12, 0x97, 0x02, 0x05, 0x84, 0x9F, 0x0A, 0xFE, 0x35, 0xF4, 0x9B, 0xDE,
+    0x4D, 0x82, 0x3A, 0x90, 0x6F, 0xE9, 0xDB, 0x62, 0xCA, 0x13, 0xE5, 0xA3, 0xEB, 0xDD, 0x93, 0xFB,
+    0xAE, 0xF7, 0xD4, 0x54, 0xB1, 0x29, 0x52, 0x96, 0x9A, 0xEF, 0x92, 0x1B, 0xAA, 0x61, 0xA9, 0x06,
+    0xBF, 0x6D, 0xDE, 0x1D, 0x9B, 0x3B, 0x89, 0x52, 0xDD, 0x7D, 0xE0, 0x62, 0x19, 0x83, 0x64, 0xDA,
+    0xD6, 0x1F, 0x27, 0x2A, 0x66, 0x9A, 0x5D, 0xA2, 0x5A, 0x74, 0xF5, 0xF2, 0x3E, 0x77, 0x75, 0xD7,
+    0x30, 0x2F, 0xC2, 0x84, 0x47, 0x4C, 0x22, 0xC9, 0xBA, 0x03, 0x92, 0xF7, 0x1E, 0x19, 0xAE, 0x6C,
+    0x0B, 0x99, 0x1B, 0xD4, 0x19, 0x02, 0xE6, 0xC8, 0x96, 0xE5, 0xE4, 0xCD, 0xF0, 0xA2, 0x25, 0x65,
+    0x55, 0xA8, 0xF9, 0x0D, 0x46, 0x9E, 0x67, 0x95, 0x9A, 0xF6, 0xE7, 0xCA, 0x4B, 0xEB, 0xA5, 0x0A,
+    0x9B, 0xD6, 0x89, 0x51, 0xD5, 0x95, 0x52, 0x84, 0x22, 0xE6, 0x70, 0x31, 0x11, 0x5C, 0xF8, 0xCF,
+    0x8C, 0x28, 0x44, 0x97, 0xF4, 0x0F, 0x3E, 0xF2, 0xC5, 0xEF, 0xC9, 0xC9, 0x50, 0x09, 0x44, 0x06,
+    0x38, 0x89, 0xAC, 0x24, 0xED, 0xD7, 0xAB, 0x3B, 0x11, 0x15, 0xE0, 0x88, 0x59, 0xD2, 0x0C, 0xA2,
+    0xDA, 0xB6, 0xE2, 0xB5, 0x7D, 0x43, 0xDC, 0x45, 0x65, 0xF6, 0x72, 0x50, 0x3F, 0xD0, 0x22, 0x03,
+    0x46, 0xAC, 0xA3, 0xCB, 0x11, 0x2E, 0x7C, 0xA7, 0xF1, 0xF0, 0xF3, 0x12, 0x21, 0x2A, 0x0D, 0xE7,
+    0xE1, 0x4E, 0x20, 0x2D, 0x0F, 0x24, 0x39, 0xB5, 0x0B, 0xF0, 0x94, 0xF3, 0x8B, 0x73, 0x0D, 0xF8,
+    0x77, 0xAC, 0x06, 0x5E, 0xA9, 0x56, 0xD4, 0xAF, 0x2B, 0x8B, 0x64, 0x4C, 0x8A, 0x4D, 0x0D, 0x39,
+    0x01, 0x33, 0x8F, 0x2A, 0xA3, 0x36, 0x99, 0x18, 0xF9, 0xFE, 0x36, 0xD8, 0x7C, 0xDA, 0x2B, 0xA7,
+    0x9D, 0x66, 0xD9, 0xA9, 0xE3, 0x16, 0x3F, 0x27, 0xA5, 0x43, 0x08, 0x2A, 0x95, 0xCB, 0x8A, 0x97,
+    0x5B, 0x44, 0xB7, 0x1C, 0xA2, 0x8A, 0xEB, 0xA4, 0x25, 0x10, 0x9B, 0xA3, 0x15, 0xC1, 0xAC, 0x8A,
+    0xA8, 0xEC, 0x41, 0x7E, 0xA3, 0x1C, 0xDD, 0xE1, 0x5E, 0x73, 0x37, 0xA9, 0x85, 0xA5, 0xB7, 0x2F,
+    0x1E, 0x92, 0xD5, 0x51, 0xCB, 0x59, 0x5A, 0x3D, 0x91, 0x84, 0x7C, 0x67, 0x3B, 0x3E, 0x3F, 0x9B,
+    0x77, 0x27, 0x41, 0x9B, 0x5F, 0xC2, 0x37, 0x91, 0x9A, 0x0E, 0x94, 0x19, 0xEA, 0x6A, 0xA6, 0x46,
+    0x63, 0xFF, 0xF1, 0x11, 0x1B, 0x70, 0x45, 0x57, 0x22, 0x3D, 0x73, 0x02, 0xC8, 0xB4, 0x7E, 0x1E,
+    0x7C, 0x2F, 0xDA, 0x46, 0x7A, 0x05, 0x6A, 0x63, 0xA8, 0x4E, 0xB6, 0xAF, 0x94, 0x95, 0x60, 0x11,
+    0xEA, 0xF9, 0x25, 0xB5, 0xE1, 0xAE, 0x99, 0x5E, 0x5A, 0x85, 0x75, 0xA5, 0x57, 0xDF, 0xA5, 0x59,
+    0x07, 0x95, 0x6E, 0x38, 0xF4, 0x6B, 0x16, 0xF8, 0x4B, 0x43, 0x18, 0x55, 0x2E, 0xD6, 0x4E, 0x83,
+    0xBE, 0xF6, 0x45, 0xB8, 0xBC, 0x8E, 0x74, 0x52, 0xF0, 0x88, 0x9B, 0x3E, 0xE1, 0xA6, 0xE3, 0xED,
+    0x82, 0x72, 0x0C, 0x3A, 0x3E, 0x52, 0x9E, 0x94, 0x3C, 0xA1, 0x81, 0xFC, 0x58, 0x2C, 0xF7, 0xA5,
+    0x16, 0x48, 0x74, 0xE0, 0x88, 0xFC, 0x1C, 0xE3, 0x9D, 0xCA, 0x87, 0xBB, 0xD6, 0x8F, 0x45, 0xD8,
+    0xE6, 0x69, 0x23, 0x4F, 0xDD, 0xF1, 0x9F, 0xF3, 0x59, 0x52, 0x8A, 0xB8, 0xAB, 0xB4, 0x0F, 0x94,
+    0x20, 0x61, 0xC8, 0xC8, 0x2C, 0x54, 0x25, 0x0D, 0xC5, 0xF7, 0x00, 0x74, 0x31, 0xE8, 0xCA, 0x51,
+    0x66, 0xD4, 0xD4, 0x96, 0xFA, 0x89, 0xCA, 0xB7, 0xF8, 0xD9, 0xBE, 0xB1, 0xFA, 0x75, 0x58, 0x98,
+    0x55, 0xB8, 0x34, 0xE6, 0x5E, 0xB1, 0x56, 0x47, 0xB7, 0xAC, 0xCC, 0xE6, 0xE0, 0x2C, 0xDB, 0xED,
+    0x76, 0xFC, 0xD3, 0xEE, 0xB4, 0xB0, 0x22, 0x2E, 0x99, 0xED, 0x4C, 0xEB, 0xDE, 0x1E, 0x5E, 0x92,
+    0xAE, 0xD3, 0xD2, 0xF4, 0xE9, 0x5F, 0x17, 0x30, 0xC5, 0x1E, 0x00, 0xE3, 0x42, 0x78, 0xC7, 0x84,
+    0xD1, 0xA4, 0xD7, 0x83, 0xB5, 0xB4, 0xF5, 0x09, 0xAD, 0x8A, 0xAD, 0x91, 0xFF, 0xEC, 0x9F, 0x45,
+    0xCB, 0x4E, 0xAC, 0x56, 0x32, 0x9D, 0xB5, 0x4C, 0x61, 0x12, 0x3E, 0x67, 0xED, 0x60, 0xE6, 0xAF,
+    0x73, 0x0E, 0x54, 0xCE, 0x41, 0xA6, 0xE3, 0x42, 0x2E, 0xCE, 0x54, 0x3F, 0x97, 0x59, 0xF5, 0x73,
+    0xA2, 0xE6, 0x17, 0xE1, 0xEE, 0xF7, 0x51, 0xCD, 0xE4, 0x49, 0x21, 0x50, 0x5B, 0x82, 0x87, 0xB0,
+    0xE8, 0x34, 0xA7, 0x46, 0xA2, 0x1D, 0xAF, 0x0D, 0xC9, 0xB3, 0x21, 0x1E, 0xE9, 0xBF, 0x96, 0xBD,
+    0x4B, 0xAA, 0x6F, 0x14, 0x64, 0xA4, 0xF5, 0x51, 0x1E, 0x6F, 0xC3, 0x70, 0x0C, 0xB6, 0xD7, 0x9E,
+    0xB3, 0x2D, 0x37, 0x8A, 0x0A, 0xCD, 0x48, 0x36, 0xA3, 0xD8, 0x36, 0x67, 0x55, 0xDB, 0xCC, 0x37,
+    0x3B, 0xBA, 0x59, 0x1B, 0xD3, 0x00, 0x84, 0x78, 0xA3, 0x9D, 0x33, 0x9B, 0x5D, 0xF9, 0xBE, 0x84,
+    0x16, 0xE7, 0x58, 0x58, 0xB7, 0x79, 0xA3, 0xA0, 0x0C, 0xBB, 0x16, 0x5F, 0xDA, 0x21, 0x47, 0xB7,
+    0xA2, 0x16, 0x3D, 0x44, 0x97, 0x7F, 0xC5, 0x17, 0x5B, 0x07, 0x9A, 0x9D, 0x8D, 0xA0, 0x01, 0x6F,
+    0x43, 0x87, 0x80, 0x5C, 0xBA, 0xED, 0x10, 0xDB, 0xA5, 0xBD, 0xD8, 0xA4, 0x3D, 0x2C, 0x7D, 0xB7,
+    0x1E, 0x22, 0x40, 0x7C, 0xF8, 0x05, 0x02, 0x5F, 0x00, 0x84, 0xDA, 0xC5, 0xD7, 0xE4, 0xE0, 0x13,
+    0x6D, 0x4A, 0xF9, 0xE7, 0x28, 0x34, 0x1F, 0xE1, 0x8D, 0x00, 0x48, 0xC9, 0xD3, 0x3B, 0x12, 0xE1,
+    0x6A, 0xA4, 0x6B, 0x09, 0x9F, 0x6D, 0x8C, 0xFE, 0x4F, 0x1F, 0x06, 0xBE, 0x57, 0x3F, 0xE6, 0xA9,
+    0x58, 0xDC, 0x55, 0x1F, 0xE2, 0x5D, 0x2F, 0x0F, 0x34, 0x07, 0x89, 0x0E, 0x83, 0xC4, 0x63, 0x1E,
+    0xDB, 0xAB, 0xFF, 0x5F, 0xD7, 0x5F, 0x95, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0x4A,
+    0x56, 0x60, 0x89, 0xBD, 0xE2, 0x40, 0x88, 0x08, 0x4C, 0x41, 0x89, 0xE4, 0x96, 0x6E, 0x2D, 0x51,
+    0xA4, 0xA0, 0x38, 0x0A, 0x44, 0xC1, 0x3F, 0xA0, 0x3A, 0x0A, 0x5A, 0x6E, 0x8D, 0x52, 0xA4, 0xB8,
+    0x82, 0x14, 0xF9, 0x09, 0x50, 0xC0, 0x2F, 0xA0, 0xC9, 0xAD, 0xE1, 0xA4, 0x7C, 0x45, 0x8A, 0x38,
+    0x9C, 0x10, 0x05, 0x05, 0xE6, 0xA0, 0x8F, 0x0F, 0x1C, 0xC9, 0x09, 0x6B, 0x0F, 0xF3, 0x66, 0x9D,
+    0x4B, 0x14, 0x2A, 0x2C, 0x79, 0xD6, 0xDF, 0xDA, 0x3B, 0xF3, 0xE6, 0xCD, 0x9B, 0xF9, 0x88, 0xE8,
+    0x23, 0x92, 0xAB, 0x1C, 0x61, 0x5D, 0x07, 0xBB, 0xC2, 0x98, 0x59, 0x4C, 0xCE, 0x78, 0x76, 0xB0,
+    0x05, 0x73, 0xC4, 0x23, 0x4F, 0xB2, 0xCB, 0xBE, 0x27, 0xCB, 0x91, 0x1B, 0xF2, 0xBF, 0x9D, 0x2F,
+    0xB2, 0xE1, 0x3E, 0x18, 0xC9, 0x3E, 0x8A, 0x72, 0xDE, 0xDD, 0x1B, 0x57, 0xCA, 0x16, 0x77, 0x73,
+    0x12, 0x9F, 0x4B, 0x2D, 0x1B, 0xBB, 0x91, 0xC5, 0x67, 0x7D, 0x3A, 0x93, 0x99, 0xD6, 0xBA, 0xA7,
+    0xFA, 0x74, 0x92, 0x0D, 0xAE, 0x4E, 0x23, 0x15, 0x31, 0xC8, 0x46, 0xF5, 0x37, 0x3C, 0x5D, 0x69,
+    0x68, 0x1F, 0x81, 0xE9, 0xE5, 0xEF, 0xBE, 0xC5, 0x52, 0x20, 0x14, 0x51, 0xC6, 0xCC, 0xAD, 0xAC,
+    0x9C, 0x7E, 0xBA, 0xFE, 0xAA, 0x1C, 0xA6, 0x6A, 0x54, 0xAC, 0x36, 0x92, 0x15, 0xE0, 0xC5, 0x4A,
+    0x26, 0xE2, 0xD3, 0xC6, 0xE0, 0x25, 0xFF, 0x7C, 0x28, 0x47, 0x18, 0x57, 0x07, 0xC4, 0xCC, 0x40,
+    0xAB, 0x4B, 0x81, 0x65, 0x50, 0xA7, 0xF0, 0xEA, 0x99, 0x1F, 0x6B, 0xDE, 0x70, 0x6D, 0xD2, 0x81,
+    0x1C, 0xCB, 0xA8, 0x01, 0x59, 0x38, 0x78, 0xF5, 0x63, 0x7E, 0xA4, 0x0C, 0x85, 0x49, 0xD1, 0xB9,
+    0xA8, 0x4B, 0xC5, 0xBA, 0x94, 0xAC, 0x8C, 0x11, 0xBD, 0x0D, 0x73, 0x07, 0x78, 0xC1, 0x58, 0x81,
+    0x8F, 0x4A, 0x1C, 0xA8, 0x24, 0x98, 0x40, 0xCD, 0x02, 0x71, 0x16, 0x38, 0x5F, 0x03, 0x33, 0x30,
+    0x3C, 0xB6, 0x88, 0x5C, 0x23, 0xBA, 0x5B, 0x9B, 0xCD, 0x9D, 0x11, 0x80, 0x12, 0x57, 0xD3, 0x5C,
+    0xE0, 0x00, 0x5E, 0x72, 0x0D, 0xFB, 0xA1, 0x06, 0xD9, 0x83, 0xF9, 0x42, 0xC1, 0x74, 0x48, 0x37,
+    0xA2, 0x42, 0x82, 0x40, 0x6B, 0x03, 0xF8, 0xAD, 0x5D, 0x83, 0x9F, 0xAB, 0xC5, 0xED, 0xF8, 0x20,
+    0xDA, 0xC1, 0xFF, 0x30, 0x99, 0xC9, 0xB4, 0x7B, 0xB9, 0x62, 0x56, 0xC4, 0x0E, 0x5C, 0xD6, 0x88,
+    0x03, 0xE2, 0x12, 0x50, 0x85, 0x4C, 0x01, 0xE6, 0x0D, 0xBC, 0xA6, 0x97, 0xF4, 0x4B, 0x18, 0xFF,
+    0xFC, 0xE7, 0x7B, 0xF8, 0xDC, 0xB7, 0xD9, 0x42, 0x7E, 0x6D, 0x58, 0xC8, 0x5B, 0x43, 0x57, 0x2B,
+    0x9F, 0x87, 0x5A, 0x9C, 0x43, 0x00, 0x92, 0x77, 0x70, 0x36, 0xA3, 0x80, 0x83, 0x1C, 0x93, 0xCA,
+    0xA6, 0x6C, 0x6A, 0xC4, 0xB3, 0xA0, 0x2B, 0xA7, 0xED, 0xD2, 0xE8, 0x29, 0x70, 0x85, 0x18, 0xC5,
+    0x7C, 0x89, 0xB3, 0xC6, 0x87, 0x66, 0xDA, 0xE4, 0x58, 0xB4, 0xAE, 0x7B, 0xBD, 0x88, 0xE5, 0x54,
+    0x75, 0xFC, 0xFB, 0x6A, 0x63, 0xC9, 0xEE, 0xFE, 0x8A, 0xEA, 0xB1, 0x96, 0x0B, 0xFC, 0x69, 0xE1,
+    0x59, 0x4B, 0xD2, 0x00, 0x05, 0x4C, 0xDE, 0x3E, 0x8D, 0x94, 0xE1, 0x09, 0x77, 0xDC, 0xEE, 0x13,
+    0xC4, 0x80, 0x02, 0x10, 0x56, 0xC2, 0xB8, 0x86, 0x1A, 0xFC, 0xA8, 0xDB, 0x6B, 0x7C, 0xAB, 0x1C,
+    0xA8, 0xBA, 0x2B, 0x7E, 0xFF, 0x5C, 0x92, 0x6E, 0x84, 0x63, 0x59, 0x6F, 0x89, 0x6A, 0x24, 0xB2,
+    0x94, 0x4C, 0x2A, 0x79, 0x43, 0x45, 0x49, 0x61, 0x54, 0xE9, 0x50, 0x18, 0x72, 0xDD, 0x08, 0x03,
+    0xD5, 0x48, 0x22, 0xF4, 0xD2, 0x03, 0x5B, 0x5A, 0x6F, 0x01, 0x49, 0x4F, 0x2F, 0x5C, 0xA6, 0x4D,
+    0x0A, 0xA9, 0x04, 0x6E, 0x2D, 0x7A, 0x13, 0x9D, 0x92, 0x7F, 0xF8, 0x70, 0xE4, 0xE3, 0xB3, 0xD5,
+    0xBD, 0x3F, 0x3A, 0x43, 0x51, 0x78, 0x3A, 0x02, 0xCC, 0x26, 0xF1, 0x66, 0x84, 0xC0, 0x1C, 0xCE,
+    0x97, 0xAD, 0x3A, 0xA5, 0x38, 0xCD, 0xE6, 0xED, 0x87, 0xED, 0xB7, 0xB7, 0x92, 0xC4, 0xF7, 0xB6,
+    0xFB, 0xCC, 0x9F, 0x4E, 0xFE, 0xFA, 0x72, 0xE2, 0x7B, 0x71, 0x3C, 0x64, 0x28, 0x92, 0x85, 0xAA,
+    0xC3, 0x98, 0x1C, 0x25, 0xC1, 0x7E, 0x4A, 0xF4, 0x1A, 0xCF, 0x92, 0x0E, 0x0F, 0x52, 0xC8, 0x27,
+    0x4D, 0xE0, 0xDB, 0xE8, 0x0D, 0xED, 0x85, 0x16, 0xA4, 0xF6, 0xE4, 0x77, 0x52, 0x5A, 0xCE, 0x79,
+    0x96, 0x62, 0x85, 0x55, 0x54, 0xE0, 0x56, 0xE9, 0xBC, 0x6A, 0x78, 0x22, 0x8D, 0x4A, 0xF4, 0x8D,
+    0x16, 0x0C, 0x0A, 0x16, 0x92, 0xBE, 0x86, 0x0E, 0x84, 0xDC, 0x6B, 0x30, 0x06, 0xC6, 0x8B, 0xC9,
+    0xB1, 0x57, 0xF3, 0xCD, 0x98, 0xF1, 0x62, 0xA2, 0xE5, 0xDE, 0x44, 0xB7, 0x52, 0x39, 0xDB, 0x41,
+    0x4C, 0xD1, 0xD0, 0xD5, 0x39, 0x93, 0xE3, 0x65, 0x97, 0x74, 0x06, 0x55, 0x96, 0x53, 0x36, 0x9B,
+    0x98, 0xC7, 0x62, 0x29, 0xE6, 0x8C, 0xA5, 0x3A, 0x7C, 0x7D, 0x24, 0x7F, 0x2C, 0xA1, 0xEF, 0x4B,
+    0x61, 0x44, 0xEF, 0x96, 0xBB, 0x7D, 0xC3, 0xAD, 0x64, 0xD6, 0x88, 0x06, 0x28, 0xE8, 0x2D, 0x32,
+    0xF9, 0x64, 0xD9, 0xC8, 0x85, 0xC2, 0x4C, 0x97, 0xBC, 0x55, 0xA3, 0x97, 0xA9, 0xE1, 0xC8, 0x77,
+    0xAE, 0xE1, 0xA6, 0xFE, 0x92, 0xA9, 0xFA, 0x51, 0xEA, 0x2A, 0xD3, 0xC7, 0xFE, 0x2A, 0x33, 0x4A,
+    0x48, 0x31, 0x3A, 0x18, 0xBA, 0x7D, 0xB4, 0x11, 0xD0, 0xA2, 0xCE, 0xA4, 0xF7, 0xED, 0xE4, 0xEE,
+    0x1D, 0xBA, 0x6C, 0x3C, 0x0A, 0x8D, 0xA6, 0xDC, 0xE8, 0x68, 0x52, 0x11, 0x6B, 0x50, 0xA3, 0x52,
+    0x56, 0xB5, 0x68, 0x4F, 0x70, 0xAF, 0x83, 0x67, 0xF0, 0x83, 0xAA, 0x19, 0xCF, 0x93, 0x49, 0x23,
+    0x05, 0x56, 0x18, 0x89, 0x69, 0x7E, 0x28, 0xDC, 0x34, 0x4C, 0xEE, 0xA8, 0x7D, 0x8F, 0xFE, 0x7B,
+    0x69, 0xB1, 0xEC, 0x2B, 0xDA, 0x28, 0x3B, 0x48, 0xA9, 0x3E, 0xD7, 0x96, 0x9A, 0x30, 0x7E, 0x5C,
+    0x74, 0x4A, 0x75, 0x25, 0x25, 0xF3, 0x7C, 0x2C, 0xE5, 0x0A, 0x7C, 0xF6, 0x0F, 0x37, 0xFC, 0xC7,
+    0x45, 0xF4, 0x23, 0x3F, 0x88, 0xA1, 0x5C, 0x5C, 0x77, 0xE2, 0xDA, 0xC5, 0x74, 0xEE, 0xA0, 0x7F,
+    0x93, 0x1A, 0xBB, 0x83, 0x02, 0xCC, 0x5F, 0x69, 0xBE, 0x68, 0xF7, 0x47, 0x87, 0x8C, 0x5C, 0x85,
+    0xB6, 0xAB, 0x8E, 0x01, 0xBA, 0x3C, 0x83, 0xB2, 0x8B, 0x51, 0x27, 0x44, 0x44, 0x9F, 0xD0, 0x49,
+    0xDD, 0x3E, 0x4F, 0x48, 0x7C, 0xD6, 0xC3, 0x89, 0x84, 0x44, 0x48, 0x22, 0x47, 0xF8, 0x2E, 0x95,
+    0x07, 0xE5, 0x64, 0xB4, 0xDB, 0x38, 0x15, 0xEF, 0x51, 0x99, 0x19, 0xD5, 0xB6, 0xE8, 0xE1, 0xF5,
+    0x72, 0xBC, 0x66, 0x3A, 0x4E, 0x37, 0x37, 0xA9, 0x98, 0x9F, 0xBF, 0x40, 0x85, 0x3D, 0x1D, 0x9F,
+    0xA1, 0x3E, 0xD2, 0x31, 0x91, 0xD2, 0x29, 0x26, 0x3D, 0x70, 0xA2, 0x13, 0xAE, 0xBA, 0xA7, 0x5B,
+    0x17, 0x0A, 0x6E, 0x91, 0xDC, 0xB2, 0xA6, 0xFE, 0x4A, 0xB2, 0x9A, 0xCD, 0x45, 0x2C, 0xBA, 0xD0,
+    0x45, 0x97, 0x2F, 0x55, 0xAC, 0x0F, 0x1E, 0x70, 0xC7, 0xBF, 0x9C, 0xCF, 0x40, 0x19, 0xBD, 0x34,
+    0x6F, 0x60, 0xAB, 0x82, 0x38, 0x43, 0xAF, 0xF8, 0x19, 0xDD, 0x52, 0x70, 0x05, 0x68, 0xF5, 0x99,
+    0xFE, 0x21, 0xCE, 0xEA, 0xB1, 0x7A, 0x57, 0xB1, 0x5C, 0xD9, 0xA8, 0x90, 0xE9, 0x62, 0xFA, 0xA4,
+    0x10, 0xC8, 0x43, 0x66, 0xBE, 0x9D, 0x34, 0x0D, 0xCD, 0x44, 0x9E, 0x5D, 0xAF, 0xB3, 0x54, 0x45,
+    0x22, 0x54, 0xA5, 0x99, 0x32, 0xD6, 0x69, 0xBD, 0x91, 0x96, 0x98, 0xA4, 0x12, 0x7E, 0x4A, 0x3F,
+    0x67, 0x55, 0x0B, 0x3F, 0x9D, 0x40, 0x04, 0xC1, 0x14, 0x98, 0x31, 0x82, 0x09, 0x83, 0x55, 0x34,
+    0x63, 0xE7, 0x34, 0x04, 0x8E, 0x92, 0x6C, 0x8A, 0x8E, 0xFE, 0xFF, 0xF5, 0x2F, 0xBD, 0x54, 0xBD,
+    0x8E, 0xE4, 0x44, 0x10, 0xAE, 0x71, 0x4B, 0x6B, 0x09, 0x0B, 0x99, 0x64, 0x13, 0x2E, 0x70, 0x7E,
+    0x89, 0x5F, 0x00, 0xA9, 0x07, 0x52, 0x02, 0x0E, 0x89, 0x7D, 0x8E, 0x7D, 0x01, 0x24, 0x8F, 0x74,
+    0x0F, 0xC0, 0x23, 0xDC, 0x05, 0x20, 0x9D, 0x86, 0xE0, 0xDE, 0x80, 0x76, 0x4E, 0xE2, 0x9C, 0xC4,
+    0xF1, 0x46, 0x96, 0x70, 0xE0, 0x5B, 0xD9, 0x5D, 0x7C, 0x5F, 0x95, 0x67, 0xD9, 0x61, 0x21, 0xC5,
+    0xD2, 0x94, 0xC7, 0xD5, 0xD5, 0x55, 0x5F, 0x7D, 0xF5, 0x23, 0x32, 0x8B, 0x48, 0x91, 0x21, 0x4A,
+    0x1D, 0x44, 0x1A, 0xCD, 0x47, 0x89, 0xAA, 0x8B, 0xE8, 0x3B, 0x5D, 0x83, 0x36, 0x1F, 0xE7, 0x5A,
+    0x9B, 0x6F, 0x86, 0xA8, 0xCD, 0x51, 0x94, 0xA2, 0x4B, 0x10, 0x87, 0x08, 0x21, 0xFF, 0x25, 0xEC,
+    0xD4, 0xEC, 0xEC, 0x86, 0xDD, 0x35, 0x2F, 0xE6, 0xCF, 0x3C, 0x33, 0xC6, 0xEA, 0xD1, 0x4A, 0x1D,
+    0x77, 0x04, 0x86, 0x05, 0xCF, 0x0F, 0x14, 0xE5, 0x46, 0x19, 0x57, 0xC2, 0x03, 0x1C, 0x3C, 0xCD,
+    0x48, 0xD9, 0x9D, 0xA8, 0xA1, 0x5A, 0xEA, 0xC9, 0x4C, 0x4E, 0x52, 0xFC, 0x46, 0x45, 0xD2, 0xEF,
+    0x26, 0xB8, 0x54, 0x65, 0x5C, 0x78, 0xAF, 0x73, 0x80, 0xEB, 0x34, 0x94, 0x7A, 0x0C, 0x59, 0x6A,
+    0x84, 0x9B, 0x24, 0x0E, 0x92, 0xFA, 0x83, 0x0A, 0x15, 0xB3, 0xD4, 0x5B, 0xA1, 0xBD, 0x43, 0xC1,
+    0x6D, 0xE6, 0xAF, 0x0A, 0x20, 0x07, 0x25, 0xA4, 0x83, 0x1A, 0x82, 0x5B, 0x79, 0xF1, 0xD4, 0x14,
+    0x37, 0x3A, 0x22, 0x10, 0xB0, 0xD9, 0x6D, 0xE9, 0xF0, 0xEE, 0x45, 0x2A, 0xBC, 0x78, 0x2D, 0xE5,
+    0x03, 0x41, 0x57, 0x7A, 0xAA, 0x15, 0x28, 0x3B, 0xF0, 0x09, 0xF7, 0x81, 0x9F, 0xB8, 0xD5, 0xAE,
+    0xA2, 0x7F, 0x20, 0x90, 0x0E, 0xF5, 0xD6, 0x2E, 0xB0, 0x02, 0xCA, 0x34, 0x4A, 0x9C, 0x2B, 0x00,
+    0x02, 0xFA, 0x3E, 0xE1, 0x40, 0xCA, 0x5C, 0x6D, 0x12, 0x27, 0x69, 0xE7, 0x34, 0x1C, 0xE0, 0x5C,
+    0x7F, 0xCF, 0x52, 0x65, 0x38, 0x31, 0x53, 0x92, 0x87, 0xFF, 0x3D, 0x22, 0x8F, 0xD2, 0x65, 0x82,
+    0xFE, 0xFE, 0x1E, 0xB1, 0x4A, 0xE5, 0x73, 0x32, 0x22, 0x88, 0x8C, 0xC0, 0x60, 0x61, 0xEA, 0x6C,
+    0x69, 0xF2, 0xB3, 0xCA, 0xC9, 0x80, 0xB6, 0xE3, 0x2B, 0x7D, 0x04, 0xDE, 0xCF, 0x5F, 0x66, 0x59,
+    0x9C, 0x29, 0x81, 0x8D, 0xD4, 0x33, 0x55, 0x10, 0x45, 0x49, 0xE7, 0x4C, 0x1B, 0xD9, 0x96, 0x99,
+    0xB2, 0x5E, 0xC9, 0x5C, 0x9C, 0x29, 0xD3, 0x08, 0x70, 0x00, 0x9B, 0x08, 0x44, 0xBA, 0x09, 0x45,
+    0xA0, 0x44, 0xC2, 0x40, 0x0C, 0x65, 0x5C, 0x0E, 0x30, 0x8B, 0x2B, 0x81, 0xC7, 0xB5, 0x86, 0xF3,
+    0x76, 0x6D, 0xF4, 0xEE, 0xAE, 0xDB, 0xA2, 0xE1, 0x75, 0x69, 0x98, 0x17, 0x83, 0x3A, 0x8B, 0xFD,
+    0x0F, 0x94, 0x83, 0xE5, 0x24, 0xF7, 0xF9, 0x57, 0xFD, 0x80, 0x62, 0x56, 0xAC, 0xDA, 0x29, 0x8E,
+    0x12, 0x36, 0x01, 0xB2, 0x7A, 0x2A, 0xA9, 0xE8, 0xDB, 0x89, 0xD5, 0x05, 0xC8, 0x7A, 0xC6, 0x81,
+    0x74, 0x3D, 0xCA, 0x5E, 0x80, 0xE1, 0x5E, 0xEA, 0x05, 0x07, 0x68, 0x01, 0x54, 0x1E, 0x2D, 0xD0,
+    0xF5, 0x52, 0xAD, 0xEC, 0xBB, 0x38, 0x42, 0x01, 0x0F, 0x50, 0x94, 0x6B, 0x41, 0x48, 0x63, 0xBD,
+    0x50, 0x81, 0x66, 0xD9, 0x9F, 0xDB, 0xE3, 0xED, 0x1B, 0xDE, 0x81, 0x93, 0xB0, 0xE1, 0x4D, 0x57,
+    0x64, 0x6F, 0xAA, 0x96, 0x3D, 0x82, 0x9B, 0x7B, 0xE0, 0xCA, 0xBC, 0x34, 0x86, 0xC7, 0xA2, 0x41,
+    0x09, 0x98, 0x0E, 0x22, 0xAC, 0x76, 0xDF, 0xB0, 0x79, 0xA0, 0x8E, 0x90, 0x79, 0xBF, 0xB7, 0xFB,
+    0xD6, 0xBD, 0x3A, 0x5B, 0xC6, 0x23, 0xFB, 0x49, 0xFB, 0x2F, 0xCF, 0x78, 0x70, 0x89, 0xBD, 0x4D,
+    0x3D, 0x3A, 0x58, 0x51, 0xEA, 0xF4, 0x78, 0xFE, 0x59, 0x1A, 0x9F, 0x10, 0xAB, 0x0F, 0xE7, 0xA1,
+    0xB2, 0x49, 0x62, 0x2D, 0xFC, 0x28, 0xE4, 0x7D, 0x48, 0x10, 0xAE, 0x67, 0xA3, 0x52, 0xB0, 0x6C,
+    0x05, 0xEB, 0x58, 0xBA, 0x78, 0x38, 0x9F, 0x82, 0xF5, 0x85, 0x31, 0xDE, 0xB1, 0x71, 0x5A, 0x52,
+    0xED, 0x03, 0xF0, 0x11, 0x11, 0x51, 0x8C, 0x89, 0xFA, 0x98, 0xCF, 0xBF, 0x88, 0xB7, 0x04, 0x9D,
+    0xA0, 0x03, 0xD5, 0xA6, 0x30, 0xF9, 0xB4, 0xD4, 0x8F, 0x36, 0xBC, 0x61, 0x75, 0xDE, 0x6C, 0x58,
+    0x2F, 0x83, 0xBA, 0x0F, 0x39, 0xC0, 0xF4, 0xAE, 0xB5, 0xA9, 0x26, 0xAD, 0xAE, 0xB5, 0xF1, 0x96,
+    0x6A, 0xBF, 0xAA, 0x7E, 0x35, 0xFA, 0xD5, 0xD2, 0x8C, 0xBE, 0xF0, 0xBC, 0xC2, 0xD0, 0x9A, 0x51,
+    0x7C, 0x6B, 0x69, 0x5F, 0x20, 0x44, 0x87, 0xE0, 0xAD, 0x49, 0x80, 0xBE, 0x4E, 0xF6, 0x34, 0x6A,
+    0xF5, 0x6A, 0x9E, 0x3F, 0x5C, 0x75, 0xF9, 0x2B, 0x3D, 0x26, 0xF6, 0x87, 0xFE, 0x04, 0x27, 0xD6,
+    0x7D, 0xA3, 0x31, 0xAF, 0x7D, 0xF3, 0x09, 0x1B, 0xB1, 0x03, 0x8E, 0xB0, 0xC8, 0x8A, 0x5F, 0x7D,
+    0x0A, 0x13, 0x18, 0xFC, 0x0A, 0x34, 0xAA, 0x14, 0x4B, 0xB1, 0x21, 0x49, 0x30, 0x32, 0xD5, 0x3E,
+    0x70, 0xDE, 0xB9, 0x3E, 0x5F, 0x98, 0x55, 0xFD, 0x93, 0xF3, 0x9F, 0xB6, 0x03, 0x36, 0xDC, 0xF3,
+    0x1D, 0x52, 0xF0, 0x9B, 0x20, 0x3D, 0xCD, 0xE4, 0x58, 0xDB, 0xED, 0x47, 0xF1, 0x5A, 0xD9, 0x69,
+    0xDA, 0x09, 0xF2, 0x04, 0x8A, 0x0B, 0x41, 0x9E, 0x40, 0x79, 0x4D, 0x50, 0xF3, 0xAF, 0xDC, 0x3E,
+    0xB1, 0x78, 0x7C, 0x6E, 0x14, 0xF2, 0x95, 0xA7, 0x7F, 0x18, 0xB5, 0x3B, 0xD5, 0x66, 0x74, 0xF3,
+    0xB5, 0x21, 0xAB, 0xD4, 0x76, 0x6F, 0xD8, 0x9B, 0x21, 0xAA, 0xB3, 0xE8, 0x5A, 0xA8, 0x8D, 0x71,
+    0xB9, 0x39, 0x5F, 0xAF, 0x0E, 0xEC, 0x6E, 0xEC, 0x2F, 0xB4, 0x1F, 0xD6, 0x77, 0x07, 0x4E, 0xB0,
+    0xEE, 0x96, 0x97, 0x0B, 0x26, 0x28, 0xCB, 0x8A, 0x1D, 0x80, 0x1D, 0xD1, 0x66, 0x89, 0x1B, 0xE8,
+    0xBA, 0x9C, 0xDD, 0xCF, 0xC5, 0x7B, 0xB4, 0xE0, 0x10, 0x7B, 0x20, 0x28, 0xB1, 0x3D, 0xBF, 0x9D,
+    0xF5, 0xD8, 0x4E, 0x91, 0x2D, 0xEA, 0xDC, 0x55, 0xF9, 0x12, 0x2C, 0xCB, 0x6B, 0xF2, 0x09, 0xAB,
+    0xA4, 0x93, 0x1E, 0x9B, 0x09, 0xAF, 0xA0, 0x01, 0x56, 0x9F, 0x8D, 0x4F, 0x56, 0xDE, 0x6A, 0x6F,
+    0xE4, 0x69, 0x18, 0x24, 0x2C, 0xCF, 0x08, 0xDB, 0x1B, 0x76, 0xFF, 0xD8, 0xFE, 0x6E, 0xC8, 0x64,
+    0x93, 0xE6, 0x63, 0xE8, 0xC5, 0x3D, 0x96, 0x0F, 0x78, 0x7F, 0x7A, 0xE2, 0x6D, 0xAF, 0x52, 0x7A,
+    0xC0, 0xE6, 0x0B, 0x6E, 0x67, 0xBD, 0xE0, 0x1F, 0xAB, 0xBC, 0xD6, 0xAB, 0x08, 0xC3, 0xB3, 0x42,
+    0x38, 0xE3, 0x7B, 0x7D, 0x77, 0xFA, 0xEF, 0xE4, 0xFF, 0x7C, 0xFE, 0x02, 0x4D, 0x90, 0xB1, 0x0D,
+    0xC2, 0x40, 0x0C, 0x45, 0x7F, 0x90, 0x02, 0x45, 0x84, 0xA0, 0x81, 0x82, 0x14, 0x19, 0x21, 0x23,
+    0x24, 0x23, 0xA4, 0x66, 0x09, 0x46, 0x20, 0x23, 0x64, 0x09, 0x24, 0x24, 0x86, 0xB8, 0x15, 0x32,
+    0x02, 0x05, 0x15, 0x15, 0x45, 0x0A, 0x40, 0x49, 0x8C, 0xFD, 0x1D, 0x89, 0x5C, 0x71, 0x4F, 0xFF,
+    0x64, 0xFF, 0x6F, 0x1F, 0x00, 0x6C, 0x61, 0x27, 0xEA, 0x88, 0xAC, 0xA7, 0x10, 0x22, 0x93, 0x81,
+    0x42, 0xEE, 0x14, 0xE2, 0xA2, 0x73, 0x51, 0x2A, 0x72, 0x79, 0x7B, 0x9D, 0x15, 0x60, 0x23, 0xD2,
+    0xF0, 0x91, 0x8C, 0x83, 0x33, 0x52, 0x9A, 0xDB, 0x52, 0xE8, 0xA6, 0x1C, 0x99, 0x94, 0xA8, 0xDD,
+    0xA1, 0x02, 0x52, 0xEB, 0xF8, 0x56, 0x53, 0xE3, 0x58, 0xA3, 0x50, 0xC8, 0x0B, 0x38, 0x06, 0xCF,
+    0x42, 0x7C, 0xE3, 0x34, 0xF3, 0xB3, 0x76, 0xE4, 0x2D, 0x51, 0x0C, 0x0E, 0x69, 0xFF, 0x53, 0x63,
+    0x21, 0x2E, 0x73, 0x97, 0xAB, 0x49, 0x9E, 0x7D, 0xB5, 0xC4, 0x27, 0x3F, 0x31, 0x21, 0x65, 0x9E,
+    0xDE, 0xFA, 0x68, 0xF7, 0xC7, 0xBC, 0x38, 0x66, 0x21, 0x63, 0xC9, 0xA6, 0xDA, 0xAA, 0x43, 0xC3,
+    0x9C, 0x07, 0xB0, 0xBB, 0x2A, 0xF7, 0x41, 0xBD, 0x16, 0xB6, 0x66, 0xAF, 0x7E, 0x84, 0xFE, 0x8B,
+    0x5C, 0x4A, 0x14, 0xCF, 0x6A, 0x36, 0xEC, 0x0F,
+};
+
+static const uint32_t opendyslexic_14_bolditalicBlockOffsets[53] = {
+    0, 879, 1909, 2869, 3818, 4733, 5778, 6904,
+    7645, 8347, 9018, 9657, 10494, 11305, 12034, 12830,
+    13646, 14259, 14911, 15790, 16629, 17367, 18091, 18987,
+    19816, 20493, 21160, 21808, 22972, 23777, 24765, 25796,
+    26764, 27925, 28991, 29975, 30857, 31889, 32915, 34002,
+    34922, 35872, 36718, 37675, 38380, 39312, 40306, 41269,
+    42252, 43222, 44301, 45212, 45400,
+};
+
+static const uint16_t opendyslexic_14_bolditalicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_14_bolditalicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_14_bolditalicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
@@ -6313,715 +3005,715 @@ static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
     { 17, 4, 16, 2, 11, 17, 1599 }, // -
     { 8, 7, 8, 0, 7, 14, 1616 }, // .
     { 33, 50, 20, -4, 34, 413, 1630 }, // /
-    { 21, 24, 23, 2, 23, 126, 2043 }, // 0
-    { 16, 23, 21, 1, 23, 92, 2169 }, // 1
-    { 21, 22, 23, 1, 22, 116, 2261 }, // 2
-    { 21, 23, 23, 1, 22, 121, 2377 }, // 3
-    { 19, 24, 24, 2, 23, 114, 2498 }, // 4
-    { 20, 24, 22, 1, 23, 120, 2612 }, // 5
-    { 22, 23, 23, 1, 22, 127, 2732 }, // 6
-    { 17, 23, 22, 6, 23, 98, 2859 }, // 7
-    { 22, 23, 24, 1, 22, 127, 2957 }, // 8
-    { 22, 24, 23, 1, 22, 132, 3084 }, // 9
-    { 12, 20, 8, 0, 20, 60, 3216 }, // :
-    { 14, 25, 10, -1, 19, 88, 3276 }, // ;
-    { 24, 19, 23, -2, 19, 114, 3364 }, // <
-    { 18, 11, 18, 1, 13, 50, 3478 }, // =
-    { 24, 19, 23, 1, 19, 114, 3528 }, // >
-    { 22, 37, 19, 4, 33, 204, 3642 }, // ?
-    { 30, 27, 30, 1, 24, 203, 3846 }, // @
-    { 24, 25, 33, 2, 25, 150, 4049 }, // A
-    { 23, 25, 27, 2, 25, 144, 4199 }, // B
-    { 26, 27, 28, 2, 27, 176, 4343 }, // C
-    { 27, 25, 30, 2, 25, 169, 4519 }, // D
-    { 24, 25, 26, 2, 25, 150, 4688 }, // E
-    { 23, 26, 24, 2, 26, 150, 4838 }, // F
-    { 26, 26, 33, 3, 25, 169, 4988 }, // G
-    { 27, 25, 30, 2, 25, 169, 5157 }, // H
-    { 13, 27, 15, 2, 26, 88, 5326 }, // I
-    { 26, 32, 26, 0, 25, 208, 5414 }, // J
-    { 25, 25, 30, 2, 25, 157, 5622 }, // K
-    { 19, 25, 26, 2, 25, 119, 5779 }, // L
-    { 31, 25, 33, 2, 25, 194, 5898 }, // M
-    { 28, 25, 30, 2, 25, 175, 6092 }, // N
-    { 29, 28, 32, 3, 26, 203, 6267 }, // O
-    { 23, 25, 26, 2, 25, 144, 6470 }, // P
-    { 28, 31, 34, 3, 26, 217, 6614 }, // Q
-    { 23, 25, 28, 2, 25, 144, 6831 }, // R
-    { 25, 26, 30, 2, 25, 163, 6975 }, // S
-    { 24, 25, 30, 7, 25, 150, 7138 }, // T
-    { 28, 27, 29, 2, 25, 189, 7288 }, // U
-    { 25, 25, 32, 8, 25, 157, 7477 }, // V
-    { 34, 25, 41, 7, 25, 213, 7634 }, // W
-    { 30, 25, 32, 2, 25, 188, 7847 }, // X
-    { 23, 25, 31, 8, 25, 144, 8035 }, // Y
-    { 30, 25, 31, 2, 25, 188, 8179 }, // Z
-    { 23, 43, 14, -2, 32, 248, 8367 }, // [
-    { 7, 33, 14, 6, 25, 58, 8615 }, // <backslash>
-    { 22, 43, 14, -7, 32, 237, 8673 }, // ]
-    { 16, 8, 16, 4, 27, 32, 8910 }, // ^
-    { 23, 6, 20, -3, -1, 35, 8942 }, // _
-    { 11, 6, 13, 6, 23, 17, 8977 }, // `
-    { 19, 19, 25, 2, 18, 91, 8994 }, // a
-    { 18, 27, 25, 4, 26, 122, 9085 }, // b
-    { 16, 18, 23, 3, 18, 72, 9207 }, // c
-    { 23, 26, 26, 3, 25, 150, 9279 }, // d
-    { 20, 18, 25, 2, 17, 90, 9429 }, // e
-    { 16, 24, 20, 4, 24, 96, 9519 }, // f
-    { 23, 26, 25, 0, 17, 150, 9615 }, // g
-    { 20, 26, 26, 2, 25, 130, 9765 }, // h
-    { 14, 28, 12, 1, 27, 98, 9895 }, // i
-    { 19, 34, 18, 2, 26, 162, 9993 }, // j
-    { 18, 25, 26, 2, 25, 113, 10155 }, // k
-    { 13, 26, 17, 2, 26, 85, 10268 }, // l
-    { 31, 18, 36, 2, 18, 140, 10353 }, // m
-    { 20, 18, 25, 2, 18, 90, 10493 }, // n
-    { 20, 19, 25, 3, 18, 95, 10583 }, // o
-    { 26, 26, 27, -1, 17, 169, 10678 }, // p
-    { 21, 26, 28, 2, 18, 137, 10847 }, // q
-    { 17, 18, 21, 2, 17, 77, 10984 }, // r
-    { 19, 20, 25, 2, 18, 95, 11061 }, // s
-    { 15, 22, 23, 5, 22, 83, 11156 }, // t
-    { 20, 18, 25, 3, 17, 90, 11239 }, // u
-    { 21, 17, 29, 6, 17, 90, 11329 }, // v
-    { 25, 18, 32, 6, 17, 113, 11419 }, // w
-    { 24, 16, 28, 2, 16, 96, 11532 }, // x
-    { 24, 25, 27, 1, 16, 150, 11628 }, // y
-    { 21, 17, 26, 2, 17, 90, 11778 }, // z
-    { 19, 30, 21, 3, 23, 143, 11868 }, // {
-    { 12, 27, 11, 2, 22, 81, 12011 }, // |
-    { 19, 30, 20, -1, 23, 143, 12092 }, // }
-    { 12, 7, 14, 6, 22, 21, 12235 }, // ~
-    { 0, 0, 25, 0, 0, 0, 12256 }, //  
-    { 15, 37, 15, 3, 32, 139, 12256 }, // ¡
-    { 16, 27, 23, 3, 22, 108, 12395 }, // ¢
-    { 22, 26, 20, 1, 25, 143, 12503 }, // £
-    { 20, 17, 20, 2, 19, 85, 12646 }, // ¤
-    { 25, 26, 22, 3, 23, 163, 12731 }, // ¥
-    { 11, 26, 11, 2, 21, 72, 12894 }, // ¦
-    { 22, 26, 22, 1, 23, 143, 12966 }, // §
-    { 16, 7, 16, 5, 24, 28, 13109 }, // ¨
-    { 15, 13, 20, 8, 28, 49, 13137 }, // ©
-    { 10, 10, 19, 9, 22, 25, 13186 }, // ª
-    { 20, 16, 24, 3, 15, 80, 13211 }, // «
-    { 16, 11, 18, 3, 11, 44, 13291 }, // ¬
-    { 16, 4, 18, 3, 11, 16, 13335 }, // ­
-    { 15, 13, 20, 9, 32, 49, 13351 }, // ®
-    { 13, 5, 15, 6, 22, 17, 13400 }, // ¯
-    { 16, 13, 20, 6, 22, 52, 13417 }, // °
-    { 22, 21, 24, 0, 16, 116, 13469 }, // ±
-    { 10, 11, 9, 10, 24, 28, 13585 }, // ²
-    { 10, 11, 10, 10, 24, 28, 13613 }, // ³
-    { 9, 7, 8, 5, 23, 16, 13641 }, // ´
-    { 24, 21, 25, -1, 17, 126, 13657 }, // µ
-    { 22, 25, 22, 2, 21, 138, 13783 }, // ¶
-    { 8, 7, 8, 2, 14, 14, 13921 }, // ·
-    { 9, 9, 10, -1, 1, 21, 13935 }, // ¸
-    { 9, 12, 9, 10, 25, 27, 13956 }, // ¹
-    { 11, 10, 19, 9, 21, 28, 13983 }, // º
-    { 20, 16, 22, -4, 15, 80, 14011 }, // »
-    { 31, 27, 38, 2, 25, 210, 14091 }, // ¼
-    { 33, 27, 38, 2, 25, 223, 14301 }, // ½
-    { 31, 28, 38, 2, 26, 217, 14524 }, // ¾
-    { 22, 37, 19, -2, 21, 204, 14741 }, // ¿
-    { 25, 33, 33, 2, 33, 207, 14945 }, // À
-    { 26, 38, 33, 2, 38, 247, 15152 }, // Á
-    { 26, 34, 33, 2, 34, 221, 15399 }, // Â
-    { 26, 34, 33, 2, 34, 221, 15620 }, // Ã
-    { 28, 35, 33, 2, 35, 245, 15841 }, // Ä
-    { 25, 35, 33, 2, 35, 219, 16086 }, // Å
-    { 40, 26, 40, 2, 25, 260, 16305 }, // Æ
-    { 26, 35, 28, 2, 27, 228, 16565 }, // Ç
-    { 24, 35, 26, 2, 35, 210, 16793 }, // È
-    { 24, 39, 26, 2, 39, 234, 17003 }, // É
-    { 24, 35, 26, 2, 35, 210, 17237 }, // Ê
-    { 25, 36, 26, 2, 36, 225, 17447 }, // Ë
-    { 16, 38, 15, 2, 37, 152, 17672 }, // Ì
-    { 18, 42, 15, 2, 41, 189, 17824 }, // Í
-    { 18, 38, 15, 2, 37, 171, 18013 }, // Î
-    { 20, 39, 15, 2, 38, 195, 18184 }, // Ï
-    { 29, 25, 30, 0, 25, 182, 18379 }, // Ð
-    { 28, 34, 30, 2, 34, 238, 18561 }, // Ñ
-    { 29, 36, 32, 3, 34, 261, 18799 }, // Ò
-    { 29, 41, 32, 3, 39, 298, 19060 }, // Ó
-    { 29, 37, 32, 3, 35, 269, 19358 }, // Ô
-    { 29, 37, 32, 3, 35, 269, 19627 }, // Õ
-    { 29, 38, 32, 3, 36, 276, 19896 }, // Ö
-    { 19, 10, 17, 0, 12, 48, 20172 }, // ×
-    { 58, 54, 32, -12, 40, 783, 20220 }, // Ø
-    { 28, 37, 29, 2, 35, 259, 21003 }, // Ù
-    { 28, 42, 29, 2, 40, 294, 21262 }, // Ú
-    { 28, 38, 29, 2, 36, 266, 21556 }, // Û
-    { 28, 39, 29, 2, 37, 273, 21822 }, // Ü
-    { 23, 42, 31, 8, 42, 242, 22095 }, // Ý
-    { 18, 24, 16, 1, 23, 108, 22337 }, // Þ
-    { 21, 25, 20, 1, 23, 132, 22445 }, // ß
-    { 19, 27, 25, 2, 26, 129, 22577 }, // à
-    { 20, 32, 25, 2, 31, 160, 22706 }, // á
-    { 20, 28, 25, 2, 27, 140, 22866 }, // â
-    { 21, 28, 25, 2, 27, 147, 23006 }, // ã
-    { 22, 29, 25, 2, 28, 160, 23153 }, // ä
-    { 19, 29, 25, 2, 28, 138, 23313 }, // å
-    { 31, 19, 37, 2, 18, 148, 23451 }, // æ
-    { 16, 25, 23, 3, 18, 100, 23599 }, // ç
-    { 20, 30, 25, 2, 29, 150, 23699 }, // è
-    { 21, 35, 25, 2, 34, 184, 23849 }, // é
-    { 21, 31, 25, 2, 30, 163, 24033 }, // ê
-    { 23, 32, 25, 2, 31, 184, 24196 }, // ë
-    { 13, 27, 12, 1, 26, 88, 24380 }, // ì
-    { 15, 32, 12, 1, 31, 120, 24468 }, // í
-    { 17, 27, 12, -1, 26, 115, 24588 }, // î
-    { 15, 27, 12, 1, 26, 102, 24703 }, // ï
-    { 27, 26, 20, 0, 24, 176, 24805 }, // ð
-    { 22, 28, 25, 2, 28, 154, 24981 }, // ñ
-    { 20, 27, 25, 3, 26, 135, 25135 }, // ò
-    { 20, 32, 25, 3, 31, 160, 25270 }, // ó
-    { 20, 28, 25, 3, 27, 140, 25430 }, // ô
-    { 20, 28, 25, 3, 27, 140, 25570 }, // õ
-    { 21, 29, 25, 3, 28, 153, 25710 }, // ö
-    { 22, 21, 26, 5, 20, 116, 25863 }, // ÷
-    { 33, 51, 25, -4, 35, 421, 25979 }, // ø
-    { 20, 27, 25, 3, 26, 135, 26400 }, // ù
-    { 20, 32, 25, 3, 31, 160, 26535 }, // ú
-    { 20, 28, 25, 3, 27, 140, 26695 }, // û
-    { 21, 29, 25, 3, 28, 153, 26835 }, // ü
-    { 24, 43, 27, 1, 34, 258, 26988 }, // ý
-    { 19, 31, 16, 0, 25, 148, 27246 }, // þ
-    { 26, 39, 27, 1, 30, 254, 27394 }, // ÿ
-    { 28, 35, 33, 2, 35, 245, 27648 }, // Ā
-    { 23, 29, 25, 2, 28, 167, 27893 }, // ā
-    { 29, 35, 33, 2, 35, 254, 28060 }, // Ă
-    { 23, 29, 25, 2, 28, 167, 28314 }, // ă
-    { 24, 33, 33, 2, 25, 198, 28481 }, // Ą
-    { 19, 27, 25, 2, 18, 129, 28679 }, // ą
-    { 26, 36, 28, 2, 36, 234, 28808 }, // Ć
-    { 17, 25, 23, 3, 25, 107, 29042 }, // ć
-    { 28, 38, 28, 2, 38, 266, 29149 }, // Ĉ
-    { 21, 27, 23, 3, 27, 142, 29415 }, // ĉ
-    { 26, 36, 28, 2, 36, 234, 29557 }, // Ċ
-    { 18, 26, 23, 3, 26, 117, 29791 }, // ċ
-    { 29, 38, 28, 2, 38, 276, 29908 }, // Č
-    { 22, 28, 23, 3, 28, 154, 30184 }, // č
-    { 28, 37, 30, 2, 37, 259, 30338 }, // Ď
-    { 28, 26, 26, 3, 25, 182, 30597 }, // ď
-    { 29, 25, 30, 0, 25, 182, 30779 }, // Đ
-    { 27, 26, 26, 3, 25, 176, 30961 }, // đ
-    { 25, 36, 26, 2, 36, 225, 31137 }, // Ē
-    { 24, 32, 25, 2, 31, 192, 31362 }, // ē
-    { 26, 36, 26, 2, 36, 234, 31554 }, // Ĕ
-    { 24, 32, 25, 2, 31, 192, 31788 }, // ĕ
-    { 24, 36, 26, 2, 36, 216, 31980 }, // Ė
-    { 21, 32, 25, 2, 31, 168, 32196 }, // ė
-    { 24, 32, 26, 2, 25, 192, 32364 }, // Ę
-    { 20, 29, 25, 2, 17, 145, 32556 }, // ę
-    { 27, 38, 26, 2, 38, 257, 32701 }, // Ě
-    { 25, 34, 25, 2, 33, 213, 32958 }, // ě
-    { 30, 40, 33, 3, 39, 300, 33171 }, // Ĝ
-    { 26, 39, 25, 0, 30, 254, 33471 }, // ĝ
-    { 30, 38, 33, 3, 37, 285, 33725 }, // Ğ
-    { 27, 37, 25, 0, 28, 250, 34010 }, // ğ
-    { 27, 39, 33, 3, 38, 264, 34260 }, // Ġ
-    { 23, 37, 25, 0, 28, 213, 34524 }, // ġ
-    { 27, 44, 33, 3, 43, 297, 34737 }, // Ģ
-    { 24, 39, 25, 0, 30, 234, 35034 }, // ģ
-    { 27, 37, 30, 2, 37, 250, 35268 }, // Ĥ
-    { 21, 36, 26, 2, 35, 189, 35518 }, // ĥ
-    { 28, 25, 30, 2, 25, 175, 35707 }, // Ħ
-    { 20, 26, 26, 2, 25, 130, 35882 }, // ħ
-    { 19, 40, 15, 2, 39, 190, 36012 }, // Ĩ
-    { 15, 29, 12, 1, 28, 109, 36202 }, // ĩ
-    { 20, 39, 15, 2, 38, 195, 36311 }, // Ī
-    { 17, 28, 12, 1, 27, 119, 36506 }, // ī
-    { 16, 34, 15, -1, 26, 136, 36625 }, // Į
-    { 18, 36, 12, -3, 27, 162, 36761 }, // į
-    { 17, 39, 15, 2, 38, 166, 36923 }, // İ
-    { 10, 18, 12, 1, 17, 45, 37089 }, // ı
-    { 29, 38, 46, 8, 26, 276, 37134 }, // Ĳ
-    { 28, 35, 12, 1, 27, 245, 37410 }, // ĳ
-    { 30, 43, 26, 0, 36, 323, 37655 }, // Ĵ
-    { 24, 37, 18, 2, 29, 222, 37978 }, // ĵ
-    { 25, 40, 30, 2, 40, 250, 38200 }, // Ķ
-    { 21, 40, 26, -1, 25, 210, 38450 }, // ķ
-    { 17, 16, 19, -3, 16, 68, 38660 }, // ĸ
-    { 19, 34, 26, 2, 34, 162, 38728 }, // Ĺ
-    { 18, 38, 17, 2, 38, 171, 38890 }, // ĺ
-    { 20, 40, 26, 1, 25, 200, 39061 }, // Ļ
-    { 18, 42, 17, -3, 26, 189, 39261 }, // ļ
-    { 21, 25, 26, 2, 25, 132, 39450 }, // Ľ
-    { 21, 30, 17, 2, 30, 158, 39582 }, // ľ
-    { 22, 25, 26, 2, 25, 138, 39740 }, // Ŀ
-    { 18, 26, 17, 2, 26, 117, 39878 }, // ŀ
-    { 45, 41, 26, -14, 33, 462, 39995 }, // Ł
-    { 31, 26, 17, -10, 26, 202, 40457 }, // ł
-    { 28, 35, 30, 2, 35, 245, 40659 }, // Ń
-    { 21, 29, 25, 2, 29, 153, 40904 }, // ń
-    { 28, 37, 30, 2, 25, 259, 41057 }, // Ņ
-    { 20, 30, 25, 2, 18, 150, 41316 }, // ņ
-    { 30, 38, 30, 2, 38, 285, 41466 }, // Ň
-    { 26, 31, 25, 2, 31, 202, 41751 }, // ň
-    { 38, 30, 25, -16, 30, 285, 41953 }, // ŉ
-    { 28, 32, 30, 2, 25, 224, 42238 }, // Ŋ
-    { 20, 25, 25, 2, 18, 125, 42462 }, // ŋ
-    { 29, 38, 32, 3, 36, 276, 42587 }, // Ō
-    { 22, 29, 25, 3, 28, 160, 42863 }, // ō
-    { 29, 38, 32, 3, 36, 276, 43023 }, // Ŏ
-    { 22, 29, 25, 3, 28, 160, 43299 }, // ŏ
-    { 32, 37, 32, 3, 35, 296, 43459 }, // Ő
-    { 26, 28, 25, 3, 27, 182, 43755 }, // ő
-    { 40, 28, 35, 3, 26, 280, 43937 }, // Œ
-    { 31, 19, 31, 3, 18, 148, 44217 }, // œ
-    { 23, 34, 28, 2, 34, 196, 44365 }, // Ŕ
-    { 17, 26, 21, 2, 25, 111, 44561 }, // ŕ
-    { 23, 40, 28, 2, 40, 230, 44672 }, // Ŗ
-    { 17, 31, 21, 2, 30, 132, 44902 }, // ŗ
-    { 26, 37, 28, 2, 37, 241, 45034 }, // Ř
-    { 21, 28, 21, 2, 27, 147, 45275 }, // ř
-    { 25, 35, 30, 2, 34, 219, 45422 }, // Ś
-    { 19, 27, 25, 2, 25, 129, 45641 }, // ś
-    { 27, 36, 30, 2, 35, 243, 45770 }, // Ŝ
-    { 23, 29, 25, 2, 27, 167, 46013 }, // ŝ
-    { 25, 33, 30, 2, 25, 207, 46180 }, // Ş
-    { 19, 26, 25, 2, 18, 124, 46387 }, // ş
-    { 29, 37, 30, 2, 36, 269, 46511 }, // Š
-    { 24, 30, 25, 2, 28, 180, 46780 }, // š
-    { 24, 33, 30, 7, 25, 198, 46960 }, // Ţ
-    { 17, 29, 23, 3, 22, 124, 47158 }, // ţ
-    { 24, 37, 30, 7, 37, 222, 47282 }, // Ť
-    { 23, 27, 23, 5, 27, 156, 47504 }, // ť
-    { 24, 25, 30, 7, 25, 150, 47660 }, // Ŧ
-    { 17, 22, 23, 3, 22, 94, 47810 }, // ŧ
-    { 28, 40, 29, 2, 38, 280, 47904 }, // Ũ
-    { 20, 29, 25, 3, 28, 145, 48184 }, // ũ
-    { 28, 39, 29, 2, 37, 273, 48329 }, // Ū
-    { 22, 28, 25, 3, 27, 154, 48602 }, // ū
-    { 28, 39, 29, 2, 37, 273, 48756 }, // Ŭ
-    { 22, 28, 25, 3, 27, 154, 49029 }, // ŭ
-    { 28, 41, 29, 2, 39, 287, 49183 }, // Ů
-    { 20, 31, 25, 3, 30, 155, 49470 }, // ů
-    { 32, 38, 29, 2, 36, 304, 49625 }, // Ű
-    { 26, 27, 25, 3, 26, 176, 49929 }, // ű
-    { 28, 32, 29, 2, 25, 224, 50105 }, // Ų
-    { 20, 26, 25, 3, 17, 130, 50329 }, // ų
-    { 34, 36, 41, 7, 36, 306, 50459 }, // Ŵ
-    { 25, 30, 32, 6, 29, 188, 50765 }, // ŵ
-    { 23, 38, 31, 8, 38, 219, 50953 }, // Ŷ
-    { 24, 39, 27, 1, 30, 234, 51172 }, // ŷ
-    { 23, 39, 31, 8, 39, 225, 51406 }, // Ÿ
-    { 30, 34, 31, 2, 34, 255, 51631 }, // Ź
-    { 21, 28, 26, 2, 28, 147, 51886 }, // ź
-    { 30, 34, 31, 2, 34, 255, 52033 }, // Ż
-    { 21, 28, 26, 2, 28, 147, 52288 }, // ż
-    { 30, 36, 31, 2, 36, 270, 52435 }, // Ž
-    { 25, 30, 26, 2, 30, 188, 52705 }, // ž
-    { 17, 24, 18, 3, 24, 102, 52893 }, // ſ
-    { 11, 6, 0, 6, 23, 17, 52995 }, // ̀
-    { 9, 7, 0, 5, 23, 16, 53012 }, // ́
-    { 17, 8, 0, -1, 1, 34, 53028 }, // ̂
-    { 12, 7, 0, 6, 22, 21, 53062 }, // ̃
-    { 16, 5, 0, 6, 21, 20, 53083 }, // ̄
-    { 21, 5, 0, 7, 27, 27, 53103 }, // ̅
-    { 15, 7, 0, 6, 21, 27, 53130 }, // ̆
-    { 8, 7, 0, 6, 24, 14, 53157 }, // ̇
-    { 14, 6, 0, 4, 21, 21, 53171 }, // ̈
-    { 7, 7, 0, 10, 19, 13, 53192 }, // ̉
-    { 8, 8, 0, 6, 23, 16, 53205 }, // ̊
-    { 24, 6, 0, 5, 23, 36, 53221 }, // ̋
-    { 16, 8, 0, 6, 23, 32, 53257 }, // ̌
-    { 24, 6, 0, -11, 23, 36, 53289 }, // ̏
-    { 13, 10, 0, 3, 23, 33, 53325 }, // ̒
-    { 12, 10, 0, 4, 22, 30, 53358 }, // ̓
-    { 13, 10, 0, -7, 22, 33, 53388 }, // ̔
-    { 8, 9, 0, 0, 0, 18, 53421 }, // ̘
-    { 9, 9, 0, 1, 0, 21, 53439 }, // ̙
-    { 14, 9, 0, 7, 24, 32, 53460 }, // ̚
-    { 7, 9, 0, 4, 20, 16, 53492 }, // ̛
-    { 7, 9, 0, -1, 0, 16, 53508 }, // ̜
-    { 9, 9, 0, 2, 6, 21, 53524 }, // ̝
-    { 8, 8, 0, -1, 0, 16, 53545 }, // ̞
-    { 7, 7, 0, 0, -2, 13, 53561 }, // ̟
-    { 17, 5, 0, -2, -3, 22, 53574 }, // ̠
-    { 8, 7, 0, -4, 3, 14, 53596 }, // ̣
-    { 14, 6, 0, -2, -2, 21, 53610 }, // ̤
-    { 8, 8, 0, 6, 23, 16, 53631 }, // ̥
-    { 13, 10, 0, -1, 5, 33, 53647 }, // ̦
-    { 9, 9, 0, -1, 1, 21, 53680 }, // ̧
-    { 9, 10, 0, 0, 1, 23, 53701 }, // ̨
-    { 8, 10, 0, -2, -1, 20, 53724 }, // ̩
-    { 14, 7, 0, -1, 0, 25, 53744 }, // ̪
-    { 19, 9, 0, -1, 1, 43, 53769 }, // ̬
-    { 18, 9, 0, -1, 1, 41, 53812 }, // ̭
-    { 14, 8, 0, 7, 25, 28, 53853 }, // ̰
-    { 15, 5, 0, 7, 24, 19, 53881 }, // ̱
-    { 16, 5, 0, -2, -1, 20, 53900 }, // ̲
-    { 14, 8, 0, 8, 25, 28, 53920 }, // ̴
-    { 17, 4, 0, 2, 11, 17, 53948 }, // ̵
-    { 7, 10, 0, 2, 0, 18, 53965 }, // ̹
-    { 16, 9, 0, -5, 1, 36, 53983 }, // ̺
-    { 14, 10, 0, -2, 1, 35, 54019 }, // ̻
-    { 13, 8, 0, -1, 1, 26, 54054 }, // ̼
-    { 11, 7, 0, 5, 22, 20, 54080 }, // ̽
-    { 12, 7, 0, 6, 22, 21, 54100 }, // ͂
-    { 7, 8, 0, 12, 26, 14, 54121 }, // ̓
-    { 17, 22, 0, 5, 37, 94, 54135 }, // ̈́
-    { 14, 7, 0, 5, 24, 25, 54229 }, // ͆
-    { 18, 11, 0, -2, 0, 50, 54254 }, // ͇
-    { 15, 9, 0, -1, 1, 34, 54304 }, // ͈
-    { 12, 9, 0, -1, -1, 27, 54338 }, // ͉
-    { 21, 23, 0, 5, 31, 121, 54365 }, // ͊
-    { 29, 23, 0, 10, 34, 167, 54486 }, // ͋
-    { 22, 16, 0, 15, 16, 88, 54653 }, // ͌
-    { 16, 33, 0, 1, 11, 132, 54741 }, // ͍
-    { 5, 5, 0, 15, 4, 7, 54873 }, // ͎
-    { 26, 7, 0, 0, 1, 46, 54880 }, // ͜
-    { 26, 8, 0, 5, 24, 52, 54926 }, // ͡
-    { 32, 9, 0, -1, -1, 72, 54978 }, // ͢
-    { 24, 36, 25, 2, 36, 216, 55050 }, // Ѐ
-    { 25, 36, 26, 2, 36, 225, 55266 }, // Ё
-    { 27, 27, 20, 3, 25, 183, 55491 }, // Ђ
-    { 23, 34, 19, 1, 33, 196, 55674 }, // Ѓ
-    { 25, 25, 24, 2, 23, 157, 55870 }, // Є
-    { 25, 26, 30, 2, 25, 163, 56027 }, // Ѕ
-    { 13, 27, 15, 2, 26, 88, 56190 }, // І
-    { 18, 38, 15, 2, 37, 171, 56278 }, // Ї
-    { 26, 32, 26, 0, 25, 208, 56449 }, // Ј
-    { 31, 25, 34, 2, 22, 194, 56657 }, // Љ
-    { 30, 24, 18, -6, 23, 180, 56851 }, // Њ
-    { 24, 28, 30, 7, 27, 168, 57031 }, // Ћ
-    { 25, 34, 30, 2, 34, 213, 57199 }, // Ќ
-    { 26, 33, 28, 2, 33, 215, 57412 }, // Ѝ
-    { 24, 37, 23, 0, 34, 222, 57627 }, // Ў
-    { 25, 28, 23, 2, 21, 175, 57849 }, // Џ
-    { 24, 25, 33, 2, 25, 150, 58024 }, // А
-    { 20, 22, 19, 3, 21, 110, 58174 }, // Б
-    { 20, 23, 20, 2, 22, 115, 58284 }, // В
-    { 23, 23, 19, 1, 22, 133, 58399 }, // Г
-    { 24, 26, 24, 2, 22, 156, 58532 }, // Д
-    { 23, 25, 25, 2, 25, 144, 58688 }, // Е
-    { 41, 25, 44, 1, 25, 257, 58832 }, // Ж
-    { 19, 23, 19, 2, 21, 110, 59089 }, // З
-    { 26, 25, 28, 2, 25, 163, 59199 }, // И
-    { 26, 32, 28, 2, 32, 208, 59362 }, // Й
-    { 25, 25, 30, 2, 25, 157, 59570 }, // К
-    { 25, 25, 18, -1, 22, 157, 59727 }, // Л
-    { 28, 23, 25, 1, 22, 161, 59884 }, // М
-    { 27, 25, 30, 2, 25, 169, 60045 }, // Н
-    { 29, 28, 32, 3, 26, 203, 60214 }, // О
-    { 23, 24, 20, 1, 23, 138, 60417 }, // П
-    { 23, 25, 26, 2, 25, 144, 60555 }, // Р
-    { 26, 27, 28, 2, 27, 176, 60699 }, // С
-    { 24, 25, 30, 7, 25, 150, 60875 }, // Т
-    { 24, 25, 23, 0, 22, 150, 61025 }, // У
-    { 23, 22, 25, 5, 22, 127, 61175 }, // Ф
-    { 30, 25, 32, 2, 25, 188, 61302 }, // Х
-    { 22, 28, 21, 1, 22, 154, 61490 }, // Ц
-    { 18, 22, 19, 5, 22, 99, 61644 }, // Ч
-    { 27, 23, 24, 1, 22, 156, 61743 }, // Ш
-    { 27, 28, 26, 1, 22, 189, 61899 }, // Щ
-    { 19, 23, 18, -1, 22, 110, 62088 }, // Ъ
-    { 32, 27, 33, 1, 26, 216, 62198 }, // Ы
-    { 17, 23, 18, 1, 22, 98, 62414 }, // Ь
-    { 26, 25, 28, 2, 23, 163, 62512 }, // Э
-    { 28, 24, 27, 2, 23, 168, 62675 }, // Ю
-    { 24, 25, 26, 1, 25, 150, 62843 }, // Я
-    { 19, 19, 25, 2, 18, 91, 62993 }, // а
-    { 23, 28, 20, 3, 26, 161, 63084 }, // б
-    { 17, 17, 21, -1, 17, 73, 63245 }, // в
-    { 19, 18, 17, 1, 17, 86, 63318 }, // г
-    { 21, 21, 22, 2, 17, 111, 63404 }, // д
-    { 20, 18, 25, 2, 17, 90, 63515 }, // е
-    { 40, 21, 43, 1, 21, 210, 63605 }, // ж
-    { 14, 16, 13, -2, 16, 56, 63815 }, // з
-    { 21, 18, 20, 1, 17, 95, 63871 }, // и
-    { 21, 24, 19, 0, 24, 126, 63966 }, // й
-    { 20, 16, 24, -1, 16, 80, 64092 }, // к
-    { 18, 17, 12, -4, 15, 77, 64172 }, // л
-    { 22, 18, 25, -1, 18, 99, 64249 }, // м
-    { 23, 18, 24, -1, 18, 104, 64348 }, // н
-    { 20, 19, 25, 3, 18, 95, 64452 }, // о
-    { 21, 18, 19, 1, 17, 95, 64547 }, // п
-    { 26, 26, 27, -1, 17, 169, 64642 }, // р
-    { 16, 18, 23, 3, 18, 72, 64811 }, // с
-    { 19, 18, 20, 4, 17, 86, 64883 }, // т
-    { 24, 25, 27, 1, 16, 150, 64969 }, // у
-    { 26, 24, 25, 2, 17, 156, 65119 }, // ф
-    { 24, 18, 21, 0, 17, 108, 65275 }, // х
-    { 21, 22, 21, 1, 17, 116, 65383 }, // ц
-    { 13, 15, 13, 0, 15, 49, 65499 }, // ч
-    { 26, 18, 24, 1, 17, 117, 65548 }, // ш
-    { 26, 23, 26, 1, 17, 150, 65665 }, // щ
-    { 15, 17, 14, -3, 16, 64, 65815 }, // ъ
-    { 24, 20, 25, -2, 19, 120, 65879 }, // ы
-    { 14, 18, 14, -2, 17, 63, 65999 }, // ь
-    { 18, 18, 19, 2, 17, 81, 66062 }, // э
-    { 22, 20, 22, 0, 19, 110, 66143 }, // ю
-    { 17, 19, 24, 2, 19, 81, 66253 }, // я
-    { 21, 32, 25, 2, 31, 168, 66334 }, // ѐ
-    { 22, 30, 25, 2, 29, 165, 66502 }, // ё
-    { 20, 32, 26, 2, 25, 160, 66667 }, // ђ
-    { 19, 26, 17, 1, 25, 124, 66827 }, // ѓ
-    { 18, 17, 17, -2, 16, 77, 66951 }, // є
-    { 19, 20, 25, 2, 18, 95, 67028 }, // ѕ
-    { 14, 28, 12, 1, 27, 98, 67123 }, // і
-    { 15, 27, 12, 1, 26, 102, 67221 }, // ї
-    { 19, 34, 18, 2, 26, 162, 67323 }, // ј
-    { 21, 17, 23, -1, 15, 90, 67485 }, // љ
-    { 21, 17, 12, -7, 16, 90, 67575 }, // њ
-    { 20, 26, 26, 2, 25, 130, 67665 }, // ћ
-    { 21, 25, 24, -1, 25, 132, 67795 }, // ќ
-    { 21, 28, 20, 1, 27, 147, 67927 }, // ѝ
-    { 27, 39, 27, 1, 30, 264, 68074 }, // ў
-    { 18, 22, 17, -1, 16, 99, 68338 }, // џ
-    { 18, 24, 22, 5, 22, 108, 68437 }, // Ѣ
-    { 19, 24, 19, 3, 22, 114, 68545 }, // ѣ
-    { 31, 24, 25, -1, 22, 186, 68659 }, // Ѫ
-    { 23, 18, 18, -4, 16, 104, 68845 }, // ѫ
-    { 32, 32, 33, 3, 31, 256, 68949 }, // Ѳ
-    { 25, 26, 25, 3, 25, 163, 69205 }, // ѳ
-    { 29, 30, 32, 8, 30, 218, 69368 }, // Ѵ
-    { 20, 21, 25, 6, 21, 105, 69586 }, // ѵ
-    { 14, 11, 0, 8, 28, 39, 69691 }, // ҆
-    { 24, 26, 19, 1, 25, 156, 69730 }, // Ґ
-    { 21, 22, 17, 1, 21, 116, 69886 }, // ґ
-    { 23, 24, 19, 1, 22, 138, 70002 }, // Ғ
-    { 16, 16, 13, -2, 15, 64, 70140 }, // ғ
-    { 23, 27, 18, 0, 25, 156, 70204 }, // Ҕ
-    { 15, 17, 11, -4, 15, 64, 70360 }, // ҕ
-    { 41, 30, 44, 1, 25, 308, 70424 }, // Җ
-    { 28, 21, 29, -2, 17, 147, 70732 }, // җ
-    { 19, 26, 19, 2, 21, 124, 70879 }, // Ҙ
-    { 14, 23, 13, -2, 16, 81, 71003 }, // ҙ
-    { 27, 30, 21, 0, 25, 203, 71084 }, // Қ
-    { 19, 20, 15, -3, 17, 95, 71287 }, // қ
-    { 30, 24, 32, 2, 22, 180, 71382 }, // Ҝ
-    { 22, 17, 22, 0, 16, 94, 71562 }, // ҝ
-    { 25, 25, 30, 2, 25, 157, 71656 }, // Ҟ
-    { 18, 25, 26, 2, 25, 113, 71813 }, // ҟ
-    { 25, 25, 30, 2, 25, 157, 71926 }, // Ҡ
-    { 18, 17, 21, -2, 17, 77, 72083 }, // ҡ
-    { 27, 29, 22, -2, 25, 196, 72160 }, // Ң
-    { 20, 20, 16, -5, 17, 100, 72356 }, // ң
-    { 38, 25, 30, 2, 25, 238, 72456 }, // Ҥ
-    { 27, 17, 21, -2, 17, 115, 72694 }, // ҥ
-    { 34, 27, 37, 3, 25, 230, 72809 }, // Ҧ
-    { 28, 29, 37, 5, 20, 203, 73039 }, // ҧ
-    { 30, 25, 20, -3, 22, 188, 73242 }, // Ҩ
-    { 24, 20, 29, 2, 18, 120, 73430 }, // ҩ
-    { 25, 31, 28, 3, 27, 194, 73550 }, // Ҫ
-    { 16, 21, 23, 3, 18, 84, 73744 }, // ҫ
-    { 24, 29, 23, 3, 25, 174, 73828 }, // Ҭ
-    { 17, 20, 16, -1, 17, 85, 74002 }, // ҭ
-    { 23, 25, 31, 8, 25, 144, 74087 }, // Ү
-    { 18, 23, 22, 6, 16, 104, 74231 }, // ү
-    { 26, 25, 31, 5, 25, 163, 74335 }, // Ұ
-    { 23, 23, 22, 1, 16, 133, 74498 }, // ұ
-    { 30, 30, 23, 1, 25, 225, 74631 }, // Ҳ
-    { 21, 20, 23, 1, 17, 105, 74856 }, // ҳ
-    { 24, 28, 18, 0, 21, 168, 74961 }, // Ҵ
-    { 18, 20, 25, 4, 15, 90, 75129 }, // ҵ
-    { 20, 29, 20, 3, 22, 145, 75219 }, // Ҷ
-    { 14, 21, 14, 0, 16, 74, 75364 }, // ҷ
-    { 18, 22, 19, 5, 22, 99, 75438 }, // Ҹ
-    { 13, 15, 13, 0, 15, 49, 75537 }, // ҹ
-    { 20, 26, 20, 1, 24, 130, 75586 }, // Һ
-    { 20, 26, 26, 2, 25, 130, 75716 }, // һ
-    { 33, 23, 41, 6, 22, 190, 75846 }, // Ҽ
-    { 23, 16, 20, 2, 15, 92, 76036 }, // ҽ
-    { 33, 27, 26, 7, 22, 223, 76128 }, // Ҿ
-    { 24, 20, 19, 3, 15, 120, 76351 }, // ҿ
-    { 13, 27, 15, 2, 26, 88, 76471 }, // Ӏ
-    { 41, 39, 44, 1, 39, 400, 76559 }, // Ӂ
-    { 40, 33, 43, 1, 33, 330, 76959 }, // ӂ
-    { 23, 30, 21, 1, 22, 173, 77289 }, // Ӄ
-    { 16, 21, 15, -2, 15, 84, 77462 }, // ӄ
-    { 25, 29, 18, -1, 22, 182, 77546 }, // Ӆ
-    { 17, 20, 12, -1, 15, 85, 77728 }, // ӆ
-    { 27, 32, 30, 2, 25, 216, 77813 }, // Ӈ
-    { 20, 22, 21, -2, 17, 110, 78029 }, // ӈ
-    { 27, 35, 30, 2, 25, 237, 78139 }, // Ӊ
-    { 20, 24, 21, 0, 17, 120, 78376 }, // ӊ
-    { 20, 28, 20, 4, 22, 140, 78496 }, // Ӌ
-    { 12, 20, 18, 3, 15, 60, 78636 }, // ӌ
-    { 31, 35, 34, 2, 25, 272, 78696 }, // Ӎ
-    { 22, 24, 23, 0, 17, 132, 78968 }, // ӎ
-    { 11, 22, 18, 6, 21, 61, 79100 }, // ӏ
-    { 29, 34, 33, 2, 34, 247, 79161 }, // Ӑ
-    { 24, 28, 25, 2, 27, 168, 79408 }, // ӑ
-    { 27, 34, 33, 2, 34, 230, 79576 }, // Ӓ
-    { 23, 29, 25, 2, 28, 167, 79806 }, // ӓ
-    { 40, 26, 40, 2, 25, 260, 79973 }, // Ӕ
-    { 31, 19, 37, 2, 18, 148, 80233 }, // ӕ
-    { 28, 35, 25, 2, 35, 245, 80381 }, // Ӗ
-    { 24, 31, 25, 2, 30, 186, 80626 }, // ӗ
-    { 24, 24, 31, 10, 22, 144, 80812 }, // Ә
-    { 19, 19, 25, 9, 18, 91, 80956 }, // ә
-    { 24, 33, 31, 10, 31, 198, 81047 }, // Ӛ
-    { 21, 24, 25, 7, 18, 126, 81245 }, // ӛ
-    { 41, 38, 41, 5, 38, 390, 81371 }, // Ӝ
-    { 40, 33, 43, 1, 33, 330, 81761 }, // ӝ
-    { 22, 36, 19, 2, 34, 198, 82091 }, // Ӟ
-    { 20, 23, 13, -2, 23, 115, 82289 }, // ӟ
-    { 19, 23, 20, 3, 22, 110, 82404 }, // Ӡ
-    { 18, 23, 20, 2, 16, 104, 82514 }, // ӡ
-    { 26, 33, 26, 2, 33, 215, 82618 }, // Ӣ
-    { 23, 28, 20, 1, 27, 161, 82833 }, // ӣ
-    { 26, 32, 28, 2, 32, 208, 82994 }, // Ӥ
-    { 21, 27, 20, 1, 26, 142, 83202 }, // ӥ
-    { 29, 37, 32, 3, 35, 269, 83344 }, // Ӧ
-    { 20, 31, 25, 3, 30, 155, 83613 }, // ӧ
-    { 26, 24, 32, 4, 23, 156, 83768 }, // Ө
-    { 20, 19, 25, 3, 18, 95, 83924 }, // ө
-    { 26, 33, 32, 4, 32, 215, 84019 }, // Ӫ
-    { 20, 28, 25, 3, 27, 140, 84234 }, // ӫ
-    { 43, 37, 28, 2, 35, 398, 84374 }, // Ӭ
-    { 18, 25, 19, 2, 24, 113, 84772 }, // ӭ
-    { 24, 37, 23, 0, 34, 222, 84885 }, // Ӯ
-    { 26, 39, 27, 1, 30, 254, 85107 }, // ӯ
-    { 24, 37, 23, 0, 34, 222, 85361 }, // Ӱ
-    { 24, 38, 27, 1, 29, 228, 85583 }, // ӱ
-    { 28, 37, 23, 0, 34, 259, 85811 }, // Ӳ
-    { 31, 38, 27, 1, 29, 295, 86070 }, // ӳ
-    { 18, 29, 19, 5, 29, 131, 86365 }, // Ӵ
-    { 15, 22, 13, 0, 22, 83, 86496 }, // ӵ
-    { 23, 27, 19, 1, 22, 156, 86579 }, // Ӷ
-    { 16, 19, 13, -2, 15, 76, 86735 }, // ӷ
-    { 32, 40, 33, 1, 39, 320, 86811 }, // Ӹ
-    { 26, 31, 25, -2, 30, 202, 87131 }, // ӹ
-    { 30, 29, 32, 2, 25, 218, 87333 }, // Ӽ
-    { 21, 20, 23, -2, 17, 105, 87551 }, // ӽ
-    { 0, 0, 19, 0, 0, 0, 87656 }, //  
-    { 0, 0, 34, 0, 0, 0, 87656 }, //  
-    { 0, 0, 19, 0, 0, 0, 87656 }, //  
-    { 0, 0, 34, 0, 0, 0, 87656 }, //  
-    { 0, 0, 14, 0, 0, 0, 87656 }, //  
-    { 0, 0, 12, 0, 0, 0, 87656 }, //  
-    { 0, 0, 10, 0, 0, 0, 87656 }, //  
-    { 0, 0, 21, 0, 0, 0, 87656 }, //  
-    { 0, 0, 8, 0, 0, 0, 87656 }, //  
-    { 0, 0, 11, 0, 0, 0, 87656 }, //  
-    { 0, 0, 9, 0, 0, 0, 87656 }, //  
-    { 0, 0, 5, 0, 0, 0, 87656 }, // ​
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 87656 }, // ‏
-    { 17, 4, 16, 2, 11, 17, 87656 }, // ‐
-    { 17, 4, 16, 2, 11, 17, 87673 }, // ‑
-    { 25, 4, 16, -1, 11, 25, 87690 }, // ‒
-    { 22, 6, 23, 3, 11, 33, 87715 }, // –
-    { 32, 6, 33, 3, 11, 48, 87748 }, // —
-    { 32, 6, 33, 3, 11, 48, 87796 }, // ―
-    { 21, 27, 16, 2, 22, 142, 87844 }, // ‖
-    { 27, 10, 16, -6, -2, 68, 87986 }, // ‗
-    { 12, 10, 13, 6, 26, 30, 88054 }, // ‘
-    { 13, 10, 13, 5, 26, 33, 88084 }, // ’
-    { 13, 10, 9, -2, 5, 33, 88117 }, // ‚
-    { 12, 10, 13, 6, 26, 30, 88150 }, // ‛
-    { 22, 10, 22, 6, 26, 55, 88180 }, // “
-    { 23, 10, 22, 5, 26, 58, 88235 }, // ”
-    { 13, 10, 9, -2, 5, 33, 88293 }, // „
-    { 22, 10, 22, 6, 26, 55, 88326 }, // ‟
-    { 18, 40, 24, 7, 30, 180, 88381 }, // †
-    { 20, 41, 25, 6, 30, 205, 88561 }, // ‡
-    { 26, 23, 15, -3, 26, 150, 88766 }, // •
-    { 11, 10, 18, 5, 13, 28, 88916 }, // ‣
-    { 8, 7, 18, 5, 7, 14, 88944 }, // ․
-    { 8, 7, 18, 5, 7, 14, 88958 }, // ‥
-    { 28, 7, 28, 0, 7, 49, 88972 }, // …
-    { 5, 4, 16, 6, 11, 5, 89021 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 89026 }, //  
-    { 26, 26, 33, 4, 23, 169, 89026 }, // ‰
-    { 13, 10, 16, 9, 26, 33, 89195 }, // ′
-    { 22, 10, 23, 9, 26, 55, 89228 }, // ″
-    { 22, 9, 12, -3, 25, 50, 89283 }, // ‴
-    { 7, 9, 12, 8, 25, 16, 89333 }, // ‵
-    { 13, 9, 12, 6, 25, 30, 89349 }, // ‶
-    { 22, 9, 12, 0, 25, 50, 89379 }, // ‷
-    { 17, 7, 19, 6, 25, 30, 89429 }, // ‸
-    { 12, 16, 12, 3, 16, 48, 89459 }, // ‹
-    { 12, 16, 12, -3, 16, 48, 89507 }, // ›
-    { 38, 38, 40, 2, 30, 361, 89555 }, // ※
-    { 16, 37, 18, 3, 32, 148, 89916 }, // ‼
-    { 23, 46, 25, 5, 39, 265, 90064 }, // ‽
-    { 16, 4, 16, 6, 24, 16, 90329 }, // ‾
-    { 15, 7, 22, 6, 20, 27, 90345 }, // ‿
-    { 21, 21, 19, 2, 28, 111, 90372 }, // ⁂
-    { 27, 25, 38, 6, 23, 169, 90483 }, // ⁄
-    { 39, 37, 44, 8, 33, 361, 90652 }, // ⁇
-    { 34, 38, 35, 6, 33, 323, 91013 }, // ⁈
-    { 32, 38, 23, -2, 33, 304, 91336 }, // ⁉
-    { 33, 51, 27, -2, 35, 421, 91640 }, // ⁒
-    { 0, 0, 136, 0, 0, 0, 92061 }, //  
-    { 10, 12, 10, 11, 24, 30, 92061 }, // ⁰
-    { 10, 11, 10, 11, 25, 28, 92091 }, // ⁴
-    { 11, 12, 10, 10, 25, 33, 92119 }, // ⁵
-    { 10, 11, 10, 11, 24, 28, 92152 }, // ⁶
-    { 9, 13, 11, 13, 25, 30, 92180 }, // ⁷
-    { 11, 11, 11, 10, 24, 31, 92210 }, // ⁸
-    { 11, 12, 11, 10, 24, 33, 92241 }, // ⁹
-    { 20, 18, 25, 2, 18, 90, 92274 }, // ⁿ
-    { 11, 12, 10, -9, 7, 33, 92364 }, // ₀
-    { 9, 12, 10, -10, 7, 27, 92397 }, // ₁
-    { 12, 12, 11, -10, 7, 36, 92424 }, // ₂
-    { 11, 12, 10, -9, 7, 33, 92460 }, // ₃
-    { 10, 12, 11, -9, 7, 30, 92493 }, // ₄
-    { 10, 12, 10, -9, 7, 30, 92523 }, // ₅
-    { 11, 12, 11, -9, 7, 33, 92553 }, // ₆
-    { 10, 12, 11, -7, 7, 30, 92586 }, // ₇
-    { 11, 12, 11, -9, 7, 33, 92616 }, // ₈
-    { 11, 13, 11, -9, 7, 36, 92649 }, // ₉
-    { 20, 41, 14, 2, 31, 205, 92685 }, // ₍
-    { 20, 41, 13, -9, 31, 205, 92890 }, // ₎
-    { 28, 39, 28, 3, 33, 273, 93095 }, // ₡
-    { 26, 27, 28, 2, 27, 176, 93368 }, // ₢
-    { 22, 27, 20, 1, 26, 149, 93544 }, // ₤
-    { 33, 25, 30, -1, 25, 207, 93693 }, // ₦
-    { 27, 25, 26, 2, 25, 169, 93900 }, // ₧
-    { 35, 27, 38, -1, 25, 237, 94069 }, // ₨
-    { 27, 26, 25, -2, 26, 176, 94306 }, // ₩
-    { 27, 23, 31, 5, 23, 156, 94482 }, // ₪
-    { 25, 25, 15, -2, 24, 157, 94638 }, // ₫
-    { 23, 28, 24, 2, 24, 161, 94795 }, // €
-    { 24, 25, 30, 7, 25, 150, 94956 }, // ₮
-    { 31, 25, 19, 1, 25, 194, 95106 }, // ₱
-    { 26, 38, 33, 3, 32, 247, 95300 }, // ₲
-    { 33, 24, 31, 9, 22, 198, 95547 }, // ₴
-    { 16, 24, 17, 3, 21, 96, 95745 }, // ₵
-    { 28, 26, 30, 7, 26, 182, 95841 }, // ₸
-    { 20, 24, 20, 4, 23, 120, 96023 }, // ₹
-    { 19, 22, 20, 2, 20, 105, 96143 }, // ₺
-    { 23, 25, 24, 4, 23, 144, 96248 }, // ₼
-    { 29, 25, 26, -4, 25, 182, 96392 }, // ₽
-    { 20, 20, 21, -5, 15, 100, 96574 }, // ←
-    { 21, 20, 22, 3, 19, 105, 96674 }, // ↑
-    { 20, 20, 22, 6, 15, 100, 96779 }, // →
-    { 21, 21, 22, 8, 19, 111, 96879 }, // ↓
-    { 33, 17, 30, -1, 14, 141, 96990 }, // ↔
-    { 17, 32, 23, 5, 31, 136, 97131 }, // ↕
-    { 19, 14, 23, -2, 13, 67, 97267 }, // ↖
-    { 20, 14, 19, 3, 13, 70, 97334 }, // ↗
-    { 16, 20, 19, 6, 17, 80, 97404 }, // ↘
-    { 16, 20, 19, -3, 17, 80, 97484 }, // ↙
-    { 24, 20, 29, 1, 18, 120, 97564 }, // ⇐
-    { 25, 24, 31, 6, 23, 150, 97684 }, // ⇑
-    { 24, 20, 29, 4, 18, 120, 97834 }, // ⇒
-    { 25, 24, 31, 12, 22, 150, 97954 }, // ⇓
-    { 30, 20, 32, 1, 18, 150, 98104 }, // ⇔
-    { 20, 29, 26, 8, 16, 145, 98254 }, // ⇕
-    { 23, 26, 20, 2, 24, 150, 98399 }, // ∂
-    { 31, 31, 32, 0, 28, 241, 98549 }, // ∅
-    { 24, 23, 25, 1, 22, 138, 98790 }, // ∆
-    { 23, 23, 22, 3, 21, 133, 98928 }, // ∏
-    { 23, 23, 22, 9, 22, 133, 99061 }, // ∐
-    { 21, 22, 17, 1, 21, 116, 99194 }, // ∑
-    { 17, 5, 18, 2, 11, 22, 99310 }, // −
-    { 30, 26, 28, 3, 24, 195, 99332 }, // √
-    { 27, 17, 27, 3, 19, 115, 99527 }, // ∞
-    { 30, 31, 25, 0, 23, 233, 99642 }, // ∫
-    { 12, 20, 9, 1, 20, 60, 99875 }, // ∶
-    { 22, 16, 42, 15, 16, 88, 99935 }, // ≈
-    { 27, 26, 38, 6, 23, 176, 100023 }, // ≠
-    { 28, 25, 23, -4, 21, 175, 100199 }, // ≤
-    { 28, 26, 25, 0, 22, 182, 100374 }, // ≥
+    { 21, 24, 23, 2, 23, 126, 2048 }, // 0
+    { 16, 23, 21, 1, 23, 92, 2174 }, // 1
+    { 21, 22, 23, 1, 22, 116, 2266 }, // 2
+    { 21, 23, 23, 1, 22, 121, 2382 }, // 3
+    { 19, 24, 24, 2, 23, 114, 2503 }, // 4
+    { 20, 24, 22, 1, 23, 120, 2617 }, // 5
+    { 22, 23, 23, 1, 22, 127, 2737 }, // 6
+    { 17, 23, 22, 6, 23, 98, 2864 }, // 7
+    { 22, 23, 24, 1, 22, 127, 2962 }, // 8
+    { 22, 24, 23, 1, 22, 132, 3089 }, // 9
+    { 12, 20, 8, 0, 20, 60, 3221 }, // :
+    { 14, 25, 10, -1, 19, 88, 3281 }, // ;
+    { 24, 19, 23, -2, 19, 114, 3369 }, // <
+    { 18, 11, 18, 1, 13, 50, 3483 }, // =
+    { 24, 19, 23, 1, 19, 114, 3533 }, // >
+    { 22, 37, 19, 4, 33, 204, 3647 }, // ?
+    { 30, 27, 30, 1, 24, 203, 3851 }, // @
+    { 24, 25, 33, 2, 25, 150, 4096 }, // A
+    { 23, 25, 27, 2, 25, 144, 4246 }, // B
+    { 26, 27, 28, 2, 27, 176, 4390 }, // C
+    { 27, 25, 30, 2, 25, 169, 4566 }, // D
+    { 24, 25, 26, 2, 25, 150, 4735 }, // E
+    { 23, 26, 24, 2, 26, 150, 4885 }, // F
+    { 26, 26, 33, 3, 25, 169, 5035 }, // G
+    { 27, 25, 30, 2, 25, 169, 5204 }, // H
+    { 13, 27, 15, 2, 26, 88, 5373 }, // I
+    { 26, 32, 26, 0, 25, 208, 5461 }, // J
+    { 25, 25, 30, 2, 25, 157, 5669 }, // K
+    { 19, 25, 26, 2, 25, 119, 5826 }, // L
+    { 31, 25, 33, 2, 25, 194, 5945 }, // M
+    { 28, 25, 30, 2, 25, 175, 6144 }, // N
+    { 29, 28, 32, 3, 26, 203, 6319 }, // O
+    { 23, 25, 26, 2, 25, 144, 6522 }, // P
+    { 28, 31, 34, 3, 26, 217, 6666 }, // Q
+    { 23, 25, 28, 2, 25, 144, 6883 }, // R
+    { 25, 26, 30, 2, 25, 163, 7027 }, // S
+    { 24, 25, 30, 7, 25, 150, 7190 }, // T
+    { 28, 27, 29, 2, 25, 189, 7340 }, // U
+    { 25, 25, 32, 8, 25, 157, 7529 }, // V
+    { 34, 25, 41, 7, 25, 213, 7686 }, // W
+    { 30, 25, 32, 2, 25, 188, 7899 }, // X
+    { 23, 25, 31, 8, 25, 144, 8192 }, // Y
+    { 30, 25, 31, 2, 25, 188, 8336 }, // Z
+    { 23, 43, 14, -2, 32, 248, 8524 }, // [
+    { 7, 33, 14, 6, 25, 58, 8772 }, // <backslash>
+    { 22, 43, 14, -7, 32, 237, 8830 }, // ]
+    { 16, 8, 16, 4, 27, 32, 9067 }, // ^
+    { 23, 6, 20, -3, -1, 35, 9099 }, // _
+    { 11, 6, 13, 6, 23, 17, 9134 }, // `
+    { 19, 19, 25, 2, 18, 91, 9151 }, // a
+    { 18, 27, 25, 4, 26, 122, 9242 }, // b
+    { 16, 18, 23, 3, 18, 72, 9364 }, // c
+    { 23, 26, 26, 3, 25, 150, 9436 }, // d
+    { 20, 18, 25, 2, 17, 90, 9586 }, // e
+    { 16, 24, 20, 4, 24, 96, 9676 }, // f
+    { 23, 26, 25, 0, 17, 150, 9772 }, // g
+    { 20, 26, 26, 2, 25, 130, 9922 }, // h
+    { 14, 28, 12, 1, 27, 98, 10052 }, // i
+    { 19, 34, 18, 2, 26, 162, 10240 }, // j
+    { 18, 25, 26, 2, 25, 113, 10402 }, // k
+    { 13, 26, 17, 2, 26, 85, 10515 }, // l
+    { 31, 18, 36, 2, 18, 140, 10600 }, // m
+    { 20, 18, 25, 2, 18, 90, 10740 }, // n
+    { 20, 19, 25, 3, 18, 95, 10830 }, // o
+    { 26, 26, 27, -1, 17, 169, 10925 }, // p
+    { 21, 26, 28, 2, 18, 137, 11094 }, // q
+    { 17, 18, 21, 2, 17, 77, 11231 }, // r
+    { 19, 20, 25, 2, 18, 95, 11308 }, // s
+    { 15, 22, 23, 5, 22, 83, 11403 }, // t
+    { 20, 18, 25, 3, 17, 90, 11486 }, // u
+    { 21, 17, 29, 6, 17, 90, 11576 }, // v
+    { 25, 18, 32, 6, 17, 113, 11666 }, // w
+    { 24, 16, 28, 2, 16, 96, 11779 }, // x
+    { 24, 25, 27, 1, 16, 150, 11875 }, // y
+    { 21, 17, 26, 2, 17, 90, 12025 }, // z
+    { 19, 30, 21, 3, 23, 143, 12115 }, // {
+    { 12, 27, 11, 2, 22, 81, 12288 }, // |
+    { 19, 30, 20, -1, 23, 143, 12369 }, // }
+    { 12, 7, 14, 6, 22, 21, 12512 }, // ~
+    { 0, 0, 25, 0, 0, 0, 12533 }, //  
+    { 15, 37, 15, 3, 32, 139, 12533 }, // ¡
+    { 16, 27, 23, 3, 22, 108, 12672 }, // ¢
+    { 22, 26, 20, 1, 25, 143, 12780 }, // £
+    { 20, 17, 20, 2, 19, 85, 12923 }, // ¤
+    { 25, 26, 22, 3, 23, 163, 13008 }, // ¥
+    { 11, 26, 11, 2, 21, 72, 13171 }, // ¦
+    { 22, 26, 22, 1, 23, 143, 13243 }, // §
+    { 16, 7, 16, 5, 24, 28, 13386 }, // ¨
+    { 15, 13, 20, 8, 28, 49, 13414 }, // ©
+    { 10, 10, 19, 9, 22, 25, 13463 }, // ª
+    { 20, 16, 24, 3, 15, 80, 13488 }, // «
+    { 16, 11, 18, 3, 11, 44, 13568 }, // ¬
+    { 16, 4, 18, 3, 11, 16, 13612 }, // ­
+    { 15, 13, 20, 9, 32, 49, 13628 }, // ®
+    { 13, 5, 15, 6, 22, 17, 13677 }, // ¯
+    { 16, 13, 20, 6, 22, 52, 13694 }, // °
+    { 22, 21, 24, 0, 16, 116, 13746 }, // ±
+    { 10, 11, 9, 10, 24, 28, 13862 }, // ²
+    { 10, 11, 10, 10, 24, 28, 13890 }, // ³
+    { 9, 7, 8, 5, 23, 16, 13918 }, // ´
+    { 24, 21, 25, -1, 17, 126, 13934 }, // µ
+    { 22, 25, 22, 2, 21, 138, 14060 }, // ¶
+    { 8, 7, 8, 2, 14, 14, 14198 }, // ·
+    { 9, 9, 10, -1, 1, 21, 14212 }, // ¸
+    { 9, 12, 9, 10, 25, 27, 14233 }, // ¹
+    { 11, 10, 19, 9, 21, 28, 14260 }, // º
+    { 20, 16, 22, -4, 15, 80, 14336 }, // »
+    { 31, 27, 38, 2, 25, 210, 14416 }, // ¼
+    { 33, 27, 38, 2, 25, 223, 14626 }, // ½
+    { 31, 28, 38, 2, 26, 217, 14849 }, // ¾
+    { 22, 37, 19, -2, 21, 204, 15066 }, // ¿
+    { 25, 33, 33, 2, 33, 207, 15270 }, // À
+    { 26, 38, 33, 2, 38, 247, 15477 }, // Á
+    { 26, 34, 33, 2, 34, 221, 15724 }, // Â
+    { 26, 34, 33, 2, 34, 221, 15945 }, // Ã
+    { 28, 35, 33, 2, 35, 245, 16384 }, // Ä
+    { 25, 35, 33, 2, 35, 219, 16629 }, // Å
+    { 40, 26, 40, 2, 25, 260, 16848 }, // Æ
+    { 26, 35, 28, 2, 27, 228, 17108 }, // Ç
+    { 24, 35, 26, 2, 35, 210, 17336 }, // È
+    { 24, 39, 26, 2, 39, 234, 17546 }, // É
+    { 24, 35, 26, 2, 35, 210, 17780 }, // Ê
+    { 25, 36, 26, 2, 36, 225, 17990 }, // Ë
+    { 16, 38, 15, 2, 37, 152, 18215 }, // Ì
+    { 18, 42, 15, 2, 41, 189, 18432 }, // Í
+    { 18, 38, 15, 2, 37, 171, 18621 }, // Î
+    { 20, 39, 15, 2, 38, 195, 18792 }, // Ï
+    { 29, 25, 30, 0, 25, 182, 18987 }, // Ð
+    { 28, 34, 30, 2, 34, 238, 19169 }, // Ñ
+    { 29, 36, 32, 3, 34, 261, 19407 }, // Ò
+    { 29, 41, 32, 3, 39, 298, 19668 }, // Ó
+    { 29, 37, 32, 3, 35, 269, 19966 }, // Ô
+    { 29, 37, 32, 3, 35, 269, 20480 }, // Õ
+    { 29, 38, 32, 3, 36, 276, 20749 }, // Ö
+    { 19, 10, 17, 0, 12, 48, 21025 }, // ×
+    { 58, 54, 32, -12, 40, 783, 21073 }, // Ø
+    { 28, 37, 29, 2, 35, 259, 21856 }, // Ù
+    { 28, 42, 29, 2, 40, 294, 22115 }, // Ú
+    { 28, 38, 29, 2, 36, 266, 22528 }, // Û
+    { 28, 39, 29, 2, 37, 273, 22794 }, // Ü
+    { 23, 42, 31, 8, 42, 242, 23067 }, // Ý
+    { 18, 24, 16, 1, 23, 108, 23309 }, // Þ
+    { 21, 25, 20, 1, 23, 132, 23417 }, // ß
+    { 19, 27, 25, 2, 26, 129, 23549 }, // à
+    { 20, 32, 25, 2, 31, 160, 23678 }, // á
+    { 20, 28, 25, 2, 27, 140, 23838 }, // â
+    { 21, 28, 25, 2, 27, 147, 23978 }, // ã
+    { 22, 29, 25, 2, 28, 160, 24125 }, // ä
+    { 19, 29, 25, 2, 28, 138, 24285 }, // å
+    { 31, 19, 37, 2, 18, 148, 24423 }, // æ
+    { 16, 25, 23, 3, 18, 100, 24576 }, // ç
+    { 20, 30, 25, 2, 29, 150, 24676 }, // è
+    { 21, 35, 25, 2, 34, 184, 24826 }, // é
+    { 21, 31, 25, 2, 30, 163, 25010 }, // ê
+    { 23, 32, 25, 2, 31, 184, 25173 }, // ë
+    { 13, 27, 12, 1, 26, 88, 25357 }, // ì
+    { 15, 32, 12, 1, 31, 120, 25445 }, // í
+    { 17, 27, 12, -1, 26, 115, 25565 }, // î
+    { 15, 27, 12, 1, 26, 102, 25680 }, // ï
+    { 27, 26, 20, 0, 24, 176, 25782 }, // ð
+    { 22, 28, 25, 2, 28, 154, 25958 }, // ñ
+    { 20, 27, 25, 3, 26, 135, 26112 }, // ò
+    { 20, 32, 25, 3, 31, 160, 26247 }, // ó
+    { 20, 28, 25, 3, 27, 140, 26407 }, // ô
+    { 20, 28, 25, 3, 27, 140, 26624 }, // õ
+    { 21, 29, 25, 3, 28, 153, 26764 }, // ö
+    { 22, 21, 26, 5, 20, 116, 26917 }, // ÷
+    { 33, 51, 25, -4, 35, 421, 27033 }, // ø
+    { 20, 27, 25, 3, 26, 135, 27454 }, // ù
+    { 20, 32, 25, 3, 31, 160, 27589 }, // ú
+    { 20, 28, 25, 3, 27, 140, 27749 }, // û
+    { 21, 29, 25, 3, 28, 153, 27889 }, // ü
+    { 24, 43, 27, 1, 34, 258, 28042 }, // ý
+    { 19, 31, 16, 0, 25, 148, 28300 }, // þ
+    { 26, 39, 27, 1, 30, 254, 28672 }, // ÿ
+    { 28, 35, 33, 2, 35, 245, 28926 }, // Ā
+    { 23, 29, 25, 2, 28, 167, 29171 }, // ā
+    { 29, 35, 33, 2, 35, 254, 29338 }, // Ă
+    { 23, 29, 25, 2, 28, 167, 29592 }, // ă
+    { 24, 33, 33, 2, 25, 198, 29759 }, // Ą
+    { 19, 27, 25, 2, 18, 129, 29957 }, // ą
+    { 26, 36, 28, 2, 36, 234, 30086 }, // Ć
+    { 17, 25, 23, 3, 25, 107, 30320 }, // ć
+    { 28, 38, 28, 2, 38, 266, 30427 }, // Ĉ
+    { 21, 27, 23, 3, 27, 142, 30720 }, // ĉ
+    { 26, 36, 28, 2, 36, 234, 30862 }, // Ċ
+    { 18, 26, 23, 3, 26, 117, 31096 }, // ċ
+    { 29, 38, 28, 2, 38, 276, 31213 }, // Č
+    { 22, 28, 23, 3, 28, 154, 31489 }, // č
+    { 28, 37, 30, 2, 37, 259, 31643 }, // Ď
+    { 28, 26, 26, 3, 25, 182, 31902 }, // ď
+    { 29, 25, 30, 0, 25, 182, 32084 }, // Đ
+    { 27, 26, 26, 3, 25, 176, 32266 }, // đ
+    { 25, 36, 26, 2, 36, 225, 32442 }, // Ē
+    { 24, 32, 25, 2, 31, 192, 32768 }, // ē
+    { 26, 36, 26, 2, 36, 234, 32960 }, // Ĕ
+    { 24, 32, 25, 2, 31, 192, 33194 }, // ĕ
+    { 24, 36, 26, 2, 36, 216, 33386 }, // Ė
+    { 21, 32, 25, 2, 31, 168, 33602 }, // ė
+    { 24, 32, 26, 2, 25, 192, 33770 }, // Ę
+    { 20, 29, 25, 2, 17, 145, 33962 }, // ę
+    { 27, 38, 26, 2, 38, 257, 34107 }, // Ě
+    { 25, 34, 25, 2, 33, 213, 34364 }, // ě
+    { 30, 40, 33, 3, 39, 300, 34816 }, // Ĝ
+    { 26, 39, 25, 0, 30, 254, 35116 }, // ĝ
+    { 30, 38, 33, 3, 37, 285, 35370 }, // Ğ
+    { 27, 37, 25, 0, 28, 250, 35655 }, // ğ
+    { 27, 39, 33, 3, 38, 264, 35905 }, // Ġ
+    { 23, 37, 25, 0, 28, 213, 36169 }, // ġ
+    { 27, 44, 33, 3, 43, 297, 36382 }, // Ģ
+    { 24, 39, 25, 0, 30, 234, 36864 }, // ģ
+    { 27, 37, 30, 2, 37, 250, 37098 }, // Ĥ
+    { 21, 36, 26, 2, 35, 189, 37348 }, // ĥ
+    { 28, 25, 30, 2, 25, 175, 37537 }, // Ħ
+    { 20, 26, 26, 2, 25, 130, 37712 }, // ħ
+    { 19, 40, 15, 2, 39, 190, 37842 }, // Ĩ
+    { 15, 29, 12, 1, 28, 109, 38032 }, // ĩ
+    { 20, 39, 15, 2, 38, 195, 38141 }, // Ī
+    { 17, 28, 12, 1, 27, 119, 38336 }, // ī
+    { 16, 34, 15, -1, 26, 136, 38455 }, // Į
+    { 18, 36, 12, -3, 27, 162, 38591 }, // į
+    { 17, 39, 15, 2, 38, 166, 38912 }, // İ
+    { 10, 18, 12, 1, 17, 45, 39078 }, // ı
+    { 29, 38, 46, 8, 26, 276, 39123 }, // Ĳ
+    { 28, 35, 12, 1, 27, 245, 39399 }, // ĳ
+    { 30, 43, 26, 0, 36, 323, 39644 }, // Ĵ
+    { 24, 37, 18, 2, 29, 222, 39967 }, // ĵ
+    { 25, 40, 30, 2, 40, 250, 40189 }, // Ķ
+    { 21, 40, 26, -1, 25, 210, 40439 }, // ķ
+    { 17, 16, 19, -3, 16, 68, 40649 }, // ĸ
+    { 19, 34, 26, 2, 34, 162, 40717 }, // Ĺ
+    { 18, 38, 17, 2, 38, 171, 40960 }, // ĺ
+    { 20, 40, 26, 1, 25, 200, 41131 }, // Ļ
+    { 18, 42, 17, -3, 26, 189, 41331 }, // ļ
+    { 21, 25, 26, 2, 25, 132, 41520 }, // Ľ
+    { 21, 30, 17, 2, 30, 158, 41652 }, // ľ
+    { 22, 25, 26, 2, 25, 138, 41810 }, // Ŀ
+    { 18, 26, 17, 2, 26, 117, 41948 }, // ŀ
+    { 45, 41, 26, -14, 33, 462, 42065 }, // Ł
+    { 31, 26, 17, -10, 26, 202, 42527 }, // ł
+    { 28, 35, 30, 2, 35, 245, 42729 }, // Ń
+    { 21, 29, 25, 2, 29, 153, 43008 }, // ń
+    { 28, 37, 30, 2, 25, 259, 43161 }, // Ņ
+    { 20, 30, 25, 2, 18, 150, 43420 }, // ņ
+    { 30, 38, 30, 2, 38, 285, 43570 }, // Ň
+    { 26, 31, 25, 2, 31, 202, 43855 }, // ň
+    { 38, 30, 25, -16, 30, 285, 44057 }, // ŉ
+    { 28, 32, 30, 2, 25, 224, 44342 }, // Ŋ
+    { 20, 25, 25, 2, 18, 125, 44566 }, // ŋ
+    { 29, 38, 32, 3, 36, 276, 44691 }, // Ō
+    { 22, 29, 25, 3, 28, 160, 45056 }, // ō
+    { 29, 38, 32, 3, 36, 276, 45216 }, // Ŏ
+    { 22, 29, 25, 3, 28, 160, 45492 }, // ŏ
+    { 32, 37, 32, 3, 35, 296, 45652 }, // Ő
+    { 26, 28, 25, 3, 27, 182, 45948 }, // ő
+    { 40, 28, 35, 3, 26, 280, 46130 }, // Œ
+    { 31, 19, 31, 3, 18, 148, 46410 }, // œ
+    { 23, 34, 28, 2, 34, 196, 46558 }, // Ŕ
+    { 17, 26, 21, 2, 25, 111, 46754 }, // ŕ
+    { 23, 40, 28, 2, 40, 230, 46865 }, // Ŗ
+    { 17, 31, 21, 2, 30, 132, 47104 }, // ŗ
+    { 26, 37, 28, 2, 37, 241, 47236 }, // Ř
+    { 21, 28, 21, 2, 27, 147, 47477 }, // ř
+    { 25, 35, 30, 2, 34, 219, 47624 }, // Ś
+    { 19, 27, 25, 2, 25, 129, 47843 }, // ś
+    { 27, 36, 30, 2, 35, 243, 47972 }, // Ŝ
+    { 23, 29, 25, 2, 27, 167, 48215 }, // ŝ
+    { 25, 33, 30, 2, 25, 207, 48382 }, // Ş
+    { 19, 26, 25, 2, 18, 124, 48589 }, // ş
+    { 29, 37, 30, 2, 36, 269, 48713 }, // Š
+    { 24, 30, 25, 2, 28, 180, 49152 }, // š
+    { 24, 33, 30, 7, 25, 198, 49332 }, // Ţ
+    { 17, 29, 23, 3, 22, 124, 49530 }, // ţ
+    { 24, 37, 30, 7, 37, 222, 49654 }, // Ť
+    { 23, 27, 23, 5, 27, 156, 49876 }, // ť
+    { 24, 25, 30, 7, 25, 150, 50032 }, // Ŧ
+    { 17, 22, 23, 3, 22, 94, 50182 }, // ŧ
+    { 28, 40, 29, 2, 38, 280, 50276 }, // Ũ
+    { 20, 29, 25, 3, 28, 145, 50556 }, // ũ
+    { 28, 39, 29, 2, 37, 273, 50701 }, // Ū
+    { 22, 28, 25, 3, 27, 154, 50974 }, // ū
+    { 28, 39, 29, 2, 37, 273, 51200 }, // Ŭ
+    { 22, 28, 25, 3, 27, 154, 51473 }, // ŭ
+    { 28, 41, 29, 2, 39, 287, 51627 }, // Ů
+    { 20, 31, 25, 3, 30, 155, 51914 }, // ů
+    { 32, 38, 29, 2, 36, 304, 52069 }, // Ű
+    { 26, 27, 25, 3, 26, 176, 52373 }, // ű
+    { 28, 32, 29, 2, 25, 224, 52549 }, // Ų
+    { 20, 26, 25, 3, 17, 130, 52773 }, // ų
+    { 34, 36, 41, 7, 36, 306, 52903 }, // Ŵ
+    { 25, 30, 32, 6, 29, 188, 53248 }, // ŵ
+    { 23, 38, 31, 8, 38, 219, 53436 }, // Ŷ
+    { 24, 39, 27, 1, 30, 234, 53655 }, // ŷ
+    { 23, 39, 31, 8, 39, 225, 53889 }, // Ÿ
+    { 30, 34, 31, 2, 34, 255, 54114 }, // Ź
+    { 21, 28, 26, 2, 28, 147, 54369 }, // ź
+    { 30, 34, 31, 2, 34, 255, 54516 }, // Ż
+    { 21, 28, 26, 2, 28, 147, 54771 }, // ż
+    { 30, 36, 31, 2, 36, 270, 54918 }, // Ž
+    { 25, 30, 26, 2, 30, 188, 55296 }, // ž
+    { 17, 24, 18, 3, 24, 102, 55484 }, // ſ
+    { 11, 6, 0, 6, 23, 17, 55586 }, // ̀
+    { 9, 7, 0, 5, 23, 16, 55603 }, // ́
+    { 17, 8, 0, -1, 1, 34, 55619 }, // ̂
+    { 12, 7, 0, 6, 22, 21, 55653 }, // ̃
+    { 16, 5, 0, 6, 21, 20, 55674 }, // ̄
+    { 21, 5, 0, 7, 27, 27, 55694 }, // ̅
+    { 15, 7, 0, 6, 21, 27, 55721 }, // ̆
+    { 8, 7, 0, 6, 24, 14, 55748 }, // ̇
+    { 14, 6, 0, 4, 21, 21, 55762 }, // ̈
+    { 7, 7, 0, 10, 19, 13, 55783 }, // ̉
+    { 8, 8, 0, 6, 23, 16, 55796 }, // ̊
+    { 24, 6, 0, 5, 23, 36, 55812 }, // ̋
+    { 16, 8, 0, 6, 23, 32, 55848 }, // ̌
+    { 24, 6, 0, -11, 23, 36, 55880 }, // ̏
+    { 13, 10, 0, 3, 23, 33, 55916 }, // ̒
+    { 12, 10, 0, 4, 22, 30, 55949 }, // ̓
+    { 13, 10, 0, -7, 22, 33, 55979 }, // ̔
+    { 8, 9, 0, 0, 0, 18, 56012 }, // ̘
+    { 9, 9, 0, 1, 0, 21, 56030 }, // ̙
+    { 14, 9, 0, 7, 24, 32, 56051 }, // ̚
+    { 7, 9, 0, 4, 20, 16, 56083 }, // ̛
+    { 7, 9, 0, -1, 0, 16, 56099 }, // ̜
+    { 9, 9, 0, 2, 6, 21, 56115 }, // ̝
+    { 8, 8, 0, -1, 0, 16, 56136 }, // ̞
+    { 7, 7, 0, 0, -2, 13, 56152 }, // ̟
+    { 17, 5, 0, -2, -3, 22, 56165 }, // ̠
+    { 8, 7, 0, -4, 3, 14, 56187 }, // ̣
+    { 14, 6, 0, -2, -2, 21, 56201 }, // ̤
+    { 8, 8, 0, 6, 23, 16, 56222 }, // ̥
+    { 13, 10, 0, -1, 5, 33, 56238 }, // ̦
+    { 9, 9, 0, -1, 1, 21, 56271 }, // ̧
+    { 9, 10, 0, 0, 1, 23, 56292 }, // ̨
+    { 8, 10, 0, -2, -1, 20, 56315 }, // ̩
+    { 14, 7, 0, -1, 0, 25, 56335 }, // ̪
+    { 19, 9, 0, -1, 1, 43, 56360 }, // ̬
+    { 18, 9, 0, -1, 1, 41, 56403 }, // ̭
+    { 14, 8, 0, 7, 25, 28, 56444 }, // ̰
+    { 15, 5, 0, 7, 24, 19, 56472 }, // ̱
+    { 16, 5, 0, -2, -1, 20, 56491 }, // ̲
+    { 14, 8, 0, 8, 25, 28, 56511 }, // ̴
+    { 17, 4, 0, 2, 11, 17, 56539 }, // ̵
+    { 7, 10, 0, 2, 0, 18, 56556 }, // ̹
+    { 16, 9, 0, -5, 1, 36, 56574 }, // ̺
+    { 14, 10, 0, -2, 1, 35, 56610 }, // ̻
+    { 13, 8, 0, -1, 1, 26, 56645 }, // ̼
+    { 11, 7, 0, 5, 22, 20, 56671 }, // ̽
+    { 12, 7, 0, 6, 22, 21, 56691 }, // ͂
+    { 7, 8, 0, 12, 26, 14, 56712 }, // ̓
+    { 17, 22, 0, 5, 37, 94, 56726 }, // ̈́
+    { 14, 7, 0, 5, 24, 25, 56820 }, // ͆
+    { 18, 11, 0, -2, 0, 50, 56845 }, // ͇
+    { 15, 9, 0, -1, 1, 34, 56895 }, // ͈
+    { 12, 9, 0, -1, -1, 27, 56929 }, // ͉
+    { 21, 23, 0, 5, 31, 121, 56956 }, // ͊
+    { 29, 23, 0, 10, 34, 167, 57077 }, // ͋
+    { 22, 16, 0, 15, 16, 88, 57244 }, // ͌
+    { 16, 33, 0, 1, 11, 132, 57344 }, // ͍
+    { 5, 5, 0, 15, 4, 7, 57476 }, // ͎
+    { 26, 7, 0, 0, 1, 46, 57483 }, // ͜
+    { 26, 8, 0, 5, 24, 52, 57529 }, // ͡
+    { 32, 9, 0, -1, -1, 72, 57581 }, // ͢
+    { 24, 36, 25, 2, 36, 216, 57653 }, // Ѐ
+    { 25, 36, 26, 2, 36, 225, 57869 }, // Ё
+    { 27, 27, 20, 3, 25, 183, 58094 }, // Ђ
+    { 23, 34, 19, 1, 33, 196, 58277 }, // Ѓ
+    { 25, 25, 24, 2, 23, 157, 58473 }, // Є
+    { 25, 26, 30, 2, 25, 163, 58630 }, // Ѕ
+    { 13, 27, 15, 2, 26, 88, 58793 }, // І
+    { 18, 38, 15, 2, 37, 171, 58881 }, // Ї
+    { 26, 32, 26, 0, 25, 208, 59052 }, // Ј
+    { 31, 25, 34, 2, 22, 194, 59392 }, // Љ
+    { 30, 24, 18, -6, 23, 180, 59586 }, // Њ
+    { 24, 28, 30, 7, 27, 168, 59766 }, // Ћ
+    { 25, 34, 30, 2, 34, 213, 59934 }, // Ќ
+    { 26, 33, 28, 2, 33, 215, 60147 }, // Ѝ
+    { 24, 37, 23, 0, 34, 222, 60362 }, // Ў
+    { 25, 28, 23, 2, 21, 175, 60584 }, // Џ
+    { 24, 25, 33, 2, 25, 150, 60759 }, // А
+    { 20, 22, 19, 3, 21, 110, 60909 }, // Б
+    { 20, 23, 20, 2, 22, 115, 61019 }, // В
+    { 23, 23, 19, 1, 22, 133, 61134 }, // Г
+    { 24, 26, 24, 2, 22, 156, 61267 }, // Д
+    { 23, 25, 25, 2, 25, 144, 61440 }, // Е
+    { 41, 25, 44, 1, 25, 257, 61584 }, // Ж
+    { 19, 23, 19, 2, 21, 110, 61841 }, // З
+    { 26, 25, 28, 2, 25, 163, 61951 }, // И
+    { 26, 32, 28, 2, 32, 208, 62114 }, // Й
+    { 25, 25, 30, 2, 25, 157, 62322 }, // К
+    { 25, 25, 18, -1, 22, 157, 62479 }, // Л
+    { 28, 23, 25, 1, 22, 161, 62636 }, // М
+    { 27, 25, 30, 2, 25, 169, 62797 }, // Н
+    { 29, 28, 32, 3, 26, 203, 62966 }, // О
+    { 23, 24, 20, 1, 23, 138, 63169 }, // П
+    { 23, 25, 26, 2, 25, 144, 63307 }, // Р
+    { 26, 27, 28, 2, 27, 176, 63488 }, // С
+    { 24, 25, 30, 7, 25, 150, 63664 }, // Т
+    { 24, 25, 23, 0, 22, 150, 63814 }, // У
+    { 23, 22, 25, 5, 22, 127, 63964 }, // Ф
+    { 30, 25, 32, 2, 25, 188, 64091 }, // Х
+    { 22, 28, 21, 1, 22, 154, 64279 }, // Ц
+    { 18, 22, 19, 5, 22, 99, 64433 }, // Ч
+    { 27, 23, 24, 1, 22, 156, 64532 }, // Ш
+    { 27, 28, 26, 1, 22, 189, 64688 }, // Щ
+    { 19, 23, 18, -1, 22, 110, 64877 }, // Ъ
+    { 32, 27, 33, 1, 26, 216, 64987 }, // Ы
+    { 17, 23, 18, 1, 22, 98, 65203 }, // Ь
+    { 26, 25, 28, 2, 23, 163, 65301 }, // Э
+    { 28, 24, 27, 2, 23, 168, 65536 }, // Ю
+    { 24, 25, 26, 1, 25, 150, 65704 }, // Я
+    { 19, 19, 25, 2, 18, 91, 65854 }, // а
+    { 23, 28, 20, 3, 26, 161, 65945 }, // б
+    { 17, 17, 21, -1, 17, 73, 66106 }, // в
+    { 19, 18, 17, 1, 17, 86, 66179 }, // г
+    { 21, 21, 22, 2, 17, 111, 66265 }, // д
+    { 20, 18, 25, 2, 17, 90, 66376 }, // е
+    { 40, 21, 43, 1, 21, 210, 66466 }, // ж
+    { 14, 16, 13, -2, 16, 56, 66676 }, // з
+    { 21, 18, 20, 1, 17, 95, 66732 }, // и
+    { 21, 24, 19, 0, 24, 126, 66827 }, // й
+    { 20, 16, 24, -1, 16, 80, 66953 }, // к
+    { 18, 17, 12, -4, 15, 77, 67033 }, // л
+    { 22, 18, 25, -1, 18, 99, 67110 }, // м
+    { 23, 18, 24, -1, 18, 104, 67209 }, // н
+    { 20, 19, 25, 3, 18, 95, 67313 }, // о
+    { 21, 18, 19, 1, 17, 95, 67408 }, // п
+    { 26, 26, 27, -1, 17, 169, 67584 }, // р
+    { 16, 18, 23, 3, 18, 72, 67753 }, // с
+    { 19, 18, 20, 4, 17, 86, 67825 }, // т
+    { 24, 25, 27, 1, 16, 150, 67911 }, // у
+    { 26, 24, 25, 2, 17, 156, 68061 }, // ф
+    { 24, 18, 21, 0, 17, 108, 68217 }, // х
+    { 21, 22, 21, 1, 17, 116, 68325 }, // ц
+    { 13, 15, 13, 0, 15, 49, 68441 }, // ч
+    { 26, 18, 24, 1, 17, 117, 68490 }, // ш
+    { 26, 23, 26, 1, 17, 150, 68607 }, // щ
+    { 15, 17, 14, -3, 16, 64, 68757 }, // ъ
+    { 24, 20, 25, -2, 19, 120, 68821 }, // ы
+    { 14, 18, 14, -2, 17, 63, 68941 }, // ь
+    { 18, 18, 19, 2, 17, 81, 69004 }, // э
+    { 22, 20, 22, 0, 19, 110, 69085 }, // ю
+    { 17, 19, 24, 2, 19, 81, 69195 }, // я
+    { 21, 32, 25, 2, 31, 168, 69276 }, // ѐ
+    { 22, 30, 25, 2, 29, 165, 69444 }, // ё
+    { 20, 32, 26, 2, 25, 160, 69632 }, // ђ
+    { 19, 26, 17, 1, 25, 124, 69792 }, // ѓ
+    { 18, 17, 17, -2, 16, 77, 69916 }, // є
+    { 19, 20, 25, 2, 18, 95, 69993 }, // ѕ
+    { 14, 28, 12, 1, 27, 98, 70088 }, // і
+    { 15, 27, 12, 1, 26, 102, 70186 }, // ї
+    { 19, 34, 18, 2, 26, 162, 70288 }, // ј
+    { 21, 17, 23, -1, 15, 90, 70450 }, // љ
+    { 21, 17, 12, -7, 16, 90, 70540 }, // њ
+    { 20, 26, 26, 2, 25, 130, 70630 }, // ћ
+    { 21, 25, 24, -1, 25, 132, 70760 }, // ќ
+    { 21, 28, 20, 1, 27, 147, 70892 }, // ѝ
+    { 27, 39, 27, 1, 30, 264, 71039 }, // ў
+    { 18, 22, 17, -1, 16, 99, 71303 }, // џ
+    { 18, 24, 22, 5, 22, 108, 71402 }, // Ѣ
+    { 19, 24, 19, 3, 22, 114, 71510 }, // ѣ
+    { 31, 24, 25, -1, 22, 186, 71680 }, // Ѫ
+    { 23, 18, 18, -4, 16, 104, 71866 }, // ѫ
+    { 32, 32, 33, 3, 31, 256, 71970 }, // Ѳ
+    { 25, 26, 25, 3, 25, 163, 72226 }, // ѳ
+    { 29, 30, 32, 8, 30, 218, 72389 }, // Ѵ
+    { 20, 21, 25, 6, 21, 105, 72607 }, // ѵ
+    { 14, 11, 0, 8, 28, 39, 72712 }, // ҆
+    { 24, 26, 19, 1, 25, 156, 72751 }, // Ґ
+    { 21, 22, 17, 1, 21, 116, 72907 }, // ґ
+    { 23, 24, 19, 1, 22, 138, 73023 }, // Ғ
+    { 16, 16, 13, -2, 15, 64, 73161 }, // ғ
+    { 23, 27, 18, 0, 25, 156, 73225 }, // Ҕ
+    { 15, 17, 11, -4, 15, 64, 73381 }, // ҕ
+    { 41, 30, 44, 1, 25, 308, 73728 }, // Җ
+    { 28, 21, 29, -2, 17, 147, 74036 }, // җ
+    { 19, 26, 19, 2, 21, 124, 74183 }, // Ҙ
+    { 14, 23, 13, -2, 16, 81, 74307 }, // ҙ
+    { 27, 30, 21, 0, 25, 203, 74388 }, // Қ
+    { 19, 20, 15, -3, 17, 95, 74591 }, // қ
+    { 30, 24, 32, 2, 22, 180, 74686 }, // Ҝ
+    { 22, 17, 22, 0, 16, 94, 74866 }, // ҝ
+    { 25, 25, 30, 2, 25, 157, 74960 }, // Ҟ
+    { 18, 25, 26, 2, 25, 113, 75117 }, // ҟ
+    { 25, 25, 30, 2, 25, 157, 75230 }, // Ҡ
+    { 18, 17, 21, -2, 17, 77, 75387 }, // ҡ
+    { 27, 29, 22, -2, 25, 196, 75464 }, // Ң
+    { 20, 20, 16, -5, 17, 100, 75660 }, // ң
+    { 38, 25, 30, 2, 25, 238, 75776 }, // Ҥ
+    { 27, 17, 21, -2, 17, 115, 76014 }, // ҥ
+    { 34, 27, 37, 3, 25, 230, 76129 }, // Ҧ
+    { 28, 29, 37, 5, 20, 203, 76359 }, // ҧ
+    { 30, 25, 20, -3, 22, 188, 76562 }, // Ҩ
+    { 24, 20, 29, 2, 18, 120, 76750 }, // ҩ
+    { 25, 31, 28, 3, 27, 194, 76870 }, // Ҫ
+    { 16, 21, 23, 3, 18, 84, 77064 }, // ҫ
+    { 24, 29, 23, 3, 25, 174, 77148 }, // Ҭ
+    { 17, 20, 16, -1, 17, 85, 77322 }, // ҭ
+    { 23, 25, 31, 8, 25, 144, 77407 }, // Ү
+    { 18, 23, 22, 6, 16, 104, 77551 }, // ү
+    { 26, 25, 31, 5, 25, 163, 77655 }, // Ұ
+    { 23, 23, 22, 1, 16, 133, 77824 }, // ұ
+    { 30, 30, 23, 1, 25, 225, 77957 }, // Ҳ
+    { 21, 20, 23, 1, 17, 105, 78182 }, // ҳ
+    { 24, 28, 18, 0, 21, 168, 78287 }, // Ҵ
+    { 18, 20, 25, 4, 15, 90, 78455 }, // ҵ
+    { 20, 29, 20, 3, 22, 145, 78545 }, // Ҷ
+    { 14, 21, 14, 0, 16, 74, 78690 }, // ҷ
+    { 18, 22, 19, 5, 22, 99, 78764 }, // Ҹ
+    { 13, 15, 13, 0, 15, 49, 78863 }, // ҹ
+    { 20, 26, 20, 1, 24, 130, 78912 }, // Һ
+    { 20, 26, 26, 2, 25, 130, 79042 }, // һ
+    { 33, 23, 41, 6, 22, 190, 79172 }, // Ҽ
+    { 23, 16, 20, 2, 15, 92, 79362 }, // ҽ
+    { 33, 27, 26, 7, 22, 223, 79454 }, // Ҿ
+    { 24, 20, 19, 3, 15, 120, 79677 }, // ҿ
+    { 13, 27, 15, 2, 26, 88, 79872 }, // Ӏ
+    { 41, 39, 44, 1, 39, 400, 79960 }, // Ӂ
+    { 40, 33, 43, 1, 33, 330, 80360 }, // ӂ
+    { 23, 30, 21, 1, 22, 173, 80690 }, // Ӄ
+    { 16, 21, 15, -2, 15, 84, 80863 }, // ӄ
+    { 25, 29, 18, -1, 22, 182, 80947 }, // Ӆ
+    { 17, 20, 12, -1, 15, 85, 81129 }, // ӆ
+    { 27, 32, 30, 2, 25, 216, 81214 }, // Ӈ
+    { 20, 22, 21, -2, 17, 110, 81430 }, // ӈ
+    { 27, 35, 30, 2, 25, 237, 81540 }, // Ӊ
+    { 20, 24, 21, 0, 17, 120, 81777 }, // ӊ
+    { 20, 28, 20, 4, 22, 140, 81920 }, // Ӌ
+    { 12, 20, 18, 3, 15, 60, 82060 }, // ӌ
+    { 31, 35, 34, 2, 25, 272, 82120 }, // Ӎ
+    { 22, 24, 23, 0, 17, 132, 82392 }, // ӎ
+    { 11, 22, 18, 6, 21, 61, 82524 }, // ӏ
+    { 29, 34, 33, 2, 34, 247, 82585 }, // Ӑ
+    { 24, 28, 25, 2, 27, 168, 82832 }, // ӑ
+    { 27, 34, 33, 2, 34, 230, 83000 }, // Ӓ
+    { 23, 29, 25, 2, 28, 167, 83230 }, // ӓ
+    { 40, 26, 40, 2, 25, 260, 83397 }, // Ӕ
+    { 31, 19, 37, 2, 18, 148, 83657 }, // ӕ
+    { 28, 35, 25, 2, 35, 245, 83968 }, // Ӗ
+    { 24, 31, 25, 2, 30, 186, 84213 }, // ӗ
+    { 24, 24, 31, 10, 22, 144, 84399 }, // Ә
+    { 19, 19, 25, 9, 18, 91, 84543 }, // ә
+    { 24, 33, 31, 10, 31, 198, 84634 }, // Ӛ
+    { 21, 24, 25, 7, 18, 126, 84832 }, // ӛ
+    { 41, 38, 41, 5, 38, 390, 84958 }, // Ӝ
+    { 40, 33, 43, 1, 33, 330, 85348 }, // ӝ
+    { 22, 36, 19, 2, 34, 198, 85678 }, // Ӟ
+    { 20, 23, 13, -2, 23, 115, 85876 }, // ӟ
+    { 19, 23, 20, 3, 22, 110, 86016 }, // Ӡ
+    { 18, 23, 20, 2, 16, 104, 86126 }, // ӡ
+    { 26, 33, 26, 2, 33, 215, 86230 }, // Ӣ
+    { 23, 28, 20, 1, 27, 161, 86445 }, // ӣ
+    { 26, 32, 28, 2, 32, 208, 86606 }, // Ӥ
+    { 21, 27, 20, 1, 26, 142, 86814 }, // ӥ
+    { 29, 37, 32, 3, 35, 269, 86956 }, // Ӧ
+    { 20, 31, 25, 3, 30, 155, 87225 }, // ӧ
+    { 26, 24, 32, 4, 23, 156, 87380 }, // Ө
+    { 20, 19, 25, 3, 18, 95, 87536 }, // ө
+    { 26, 33, 32, 4, 32, 215, 87631 }, // Ӫ
+    { 20, 28, 25, 3, 27, 140, 87846 }, // ӫ
+    { 43, 37, 28, 2, 35, 398, 88064 }, // Ӭ
+    { 18, 25, 19, 2, 24, 113, 88462 }, // ӭ
+    { 24, 37, 23, 0, 34, 222, 88575 }, // Ӯ
+    { 26, 39, 27, 1, 30, 254, 88797 }, // ӯ
+    { 24, 37, 23, 0, 34, 222, 89051 }, // Ӱ
+    { 24, 38, 27, 1, 29, 228, 89273 }, // ӱ
+    { 28, 37, 23, 0, 34, 259, 89501 }, // Ӳ
+    { 31, 38, 27, 1, 29, 295, 89760 }, // ӳ
+    { 18, 29, 19, 5, 29, 131, 90112 }, // Ӵ
+    { 15, 22, 13, 0, 22, 83, 90243 }, // ӵ
+    { 23, 27, 19, 1, 22, 156, 90326 }, // Ӷ
+    { 16, 19, 13, -2, 15, 76, 90482 }, // ӷ
+    { 32, 40, 33, 1, 39, 320, 90558 }, // Ӹ
+    { 26, 31, 25, -2, 30, 202, 90878 }, // ӹ
+    { 30, 29, 32, 2, 25, 218, 91080 }, // Ӽ
+    { 21, 20, 23, -2, 17, 105, 91298 }, // ӽ
+    { 0, 0, 19, 0, 0, 0, 91403 }, //  
+    { 0, 0, 34, 0, 0, 0, 91403 }, //  
+    { 0, 0, 19, 0, 0, 0, 91403 }, //  
+    { 0, 0, 34, 0, 0, 0, 91403 }, //  
+    { 0, 0, 14, 0, 0, 0, 91403 }, //  
+    { 0, 0, 12, 0, 0, 0, 91403 }, //  
+    { 0, 0, 10, 0, 0, 0, 91403 }, //  
+    { 0, 0, 21, 0, 0, 0, 91403 }, //  
+    { 0, 0, 8, 0, 0, 0, 91403 }, //  
+    { 0, 0, 11, 0, 0, 0, 91403 }, //  
+    { 0, 0, 9, 0, 0, 0, 91403 }, //  
+    { 0, 0, 5, 0, 0, 0, 91403 }, // ​
+    { 0, 0, 0, 0, 0, 0, 91403 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 91403 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 91403 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 91403 }, // ‏
+    { 17, 4, 16, 2, 11, 17, 91403 }, // ‐
+    { 17, 4, 16, 2, 11, 17, 91420 }, // ‑
+    { 25, 4, 16, -1, 11, 25, 91437 }, // ‒
+    { 22, 6, 23, 3, 11, 33, 91462 }, // –
+    { 32, 6, 33, 3, 11, 48, 91495 }, // —
+    { 32, 6, 33, 3, 11, 48, 91543 }, // ―
+    { 21, 27, 16, 2, 22, 142, 91591 }, // ‖
+    { 27, 10, 16, -6, -2, 68, 91733 }, // ‗
+    { 12, 10, 13, 6, 26, 30, 91801 }, // ‘
+    { 13, 10, 13, 5, 26, 33, 91831 }, // ’
+    { 13, 10, 9, -2, 5, 33, 91864 }, // ‚
+    { 12, 10, 13, 6, 26, 30, 91897 }, // ‛
+    { 22, 10, 22, 6, 26, 55, 91927 }, // “
+    { 23, 10, 22, 5, 26, 58, 91982 }, // ”
+    { 13, 10, 9, -2, 5, 33, 92040 }, // „
+    { 22, 10, 22, 6, 26, 55, 92073 }, // ‟
+    { 18, 40, 24, 7, 30, 180, 92160 }, // †
+    { 20, 41, 25, 6, 30, 205, 92340 }, // ‡
+    { 26, 23, 15, -3, 26, 150, 92545 }, // •
+    { 11, 10, 18, 5, 13, 28, 92695 }, // ‣
+    { 8, 7, 18, 5, 7, 14, 92723 }, // ․
+    { 8, 7, 18, 5, 7, 14, 92737 }, // ‥
+    { 28, 7, 28, 0, 7, 49, 92751 }, // …
+    { 5, 4, 16, 6, 11, 5, 92800 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 92805 }, //  
+    { 26, 26, 33, 4, 23, 169, 92805 }, // ‰
+    { 13, 10, 16, 9, 26, 33, 92974 }, // ′
+    { 22, 10, 23, 9, 26, 55, 93007 }, // ″
+    { 22, 9, 12, -3, 25, 50, 93062 }, // ‴
+    { 7, 9, 12, 8, 25, 16, 93112 }, // ‵
+    { 13, 9, 12, 6, 25, 30, 93128 }, // ‶
+    { 22, 9, 12, 0, 25, 50, 93158 }, // ‷
+    { 17, 7, 19, 6, 25, 30, 93208 }, // ‸
+    { 12, 16, 12, 3, 16, 48, 93238 }, // ‹
+    { 12, 16, 12, -3, 16, 48, 93286 }, // ›
+    { 38, 38, 40, 2, 30, 361, 93334 }, // ※
+    { 16, 37, 18, 3, 32, 148, 93695 }, // ‼
+    { 23, 46, 25, 5, 39, 265, 93843 }, // ‽
+    { 16, 4, 16, 6, 24, 16, 94108 }, // ‾
+    { 15, 7, 22, 6, 20, 27, 94124 }, // ‿
+    { 21, 21, 19, 2, 28, 111, 94208 }, // ⁂
+    { 27, 25, 38, 6, 23, 169, 94319 }, // ⁄
+    { 39, 37, 44, 8, 33, 361, 94488 }, // ⁇
+    { 34, 38, 35, 6, 33, 323, 94849 }, // ⁈
+    { 32, 38, 23, -2, 33, 304, 95172 }, // ⁉
+    { 33, 51, 27, -2, 35, 421, 95476 }, // ⁒
+    { 0, 0, 136, 0, 0, 0, 95897 }, //  
+    { 10, 12, 10, 11, 24, 30, 95897 }, // ⁰
+    { 10, 11, 10, 11, 25, 28, 95927 }, // ⁴
+    { 11, 12, 10, 10, 25, 33, 95955 }, // ⁵
+    { 10, 11, 10, 11, 24, 28, 95988 }, // ⁶
+    { 9, 13, 11, 13, 25, 30, 96016 }, // ⁷
+    { 11, 11, 11, 10, 24, 31, 96046 }, // ⁸
+    { 11, 12, 11, 10, 24, 33, 96077 }, // ⁹
+    { 20, 18, 25, 2, 18, 90, 96110 }, // ⁿ
+    { 11, 12, 10, -9, 7, 33, 96200 }, // ₀
+    { 9, 12, 10, -10, 7, 27, 96256 }, // ₁
+    { 12, 12, 11, -10, 7, 36, 96283 }, // ₂
+    { 11, 12, 10, -9, 7, 33, 96319 }, // ₃
+    { 10, 12, 11, -9, 7, 30, 96352 }, // ₄
+    { 10, 12, 10, -9, 7, 30, 96382 }, // ₅
+    { 11, 12, 11, -9, 7, 33, 96412 }, // ₆
+    { 10, 12, 11, -7, 7, 30, 96445 }, // ₇
+    { 11, 12, 11, -9, 7, 33, 96475 }, // ₈
+    { 11, 13, 11, -9, 7, 36, 96508 }, // ₉
+    { 20, 41, 14, 2, 31, 205, 96544 }, // ₍
+    { 20, 41, 13, -9, 31, 205, 96749 }, // ₎
+    { 28, 39, 28, 3, 33, 273, 96954 }, // ₡
+    { 26, 27, 28, 2, 27, 176, 97227 }, // ₢
+    { 22, 27, 20, 1, 26, 149, 97403 }, // ₤
+    { 33, 25, 30, -1, 25, 207, 97552 }, // ₦
+    { 27, 25, 26, 2, 25, 169, 97759 }, // ₧
+    { 35, 27, 38, -1, 25, 237, 97928 }, // ₨
+    { 27, 26, 25, -2, 26, 176, 98304 }, // ₩
+    { 27, 23, 31, 5, 23, 156, 98480 }, // ₪
+    { 25, 25, 15, -2, 24, 157, 98636 }, // ₫
+    { 23, 28, 24, 2, 24, 161, 98793 }, // €
+    { 24, 25, 30, 7, 25, 150, 98954 }, // ₮
+    { 31, 25, 19, 1, 25, 194, 99104 }, // ₱
+    { 26, 38, 33, 3, 32, 247, 99298 }, // ₲
+    { 33, 24, 31, 9, 22, 198, 99545 }, // ₴
+    { 16, 24, 17, 3, 21, 96, 99743 }, // ₵
+    { 28, 26, 30, 7, 26, 182, 99839 }, // ₸
+    { 20, 24, 20, 4, 23, 120, 100021 }, // ₹
+    { 19, 22, 20, 2, 20, 105, 100141 }, // ₺
+    { 23, 25, 24, 4, 23, 144, 100352 }, // ₼
+    { 29, 25, 26, -4, 25, 182, 100496 }, // ₽
+    { 20, 20, 21, -5, 15, 100, 100678 }, // ←
+    { 21, 20, 22, 3, 19, 105, 100778 }, // ↑
+    { 20, 20, 22, 6, 15, 100, 100883 }, // →
+    { 21, 21, 22, 8, 19, 111, 100983 }, // ↓
+    { 33, 17, 30, -1, 14, 141, 101094 }, // ↔
+    { 17, 32, 23, 5, 31, 136, 101235 }, // ↕
+    { 19, 14, 23, -2, 13, 67, 101371 }, // ↖
+    { 20, 14, 19, 3, 13, 70, 101438 }, // ↗
+    { 16, 20, 19, 6, 17, 80, 101508 }, // ↘
+    { 16, 20, 19, -3, 17, 80, 101588 }, // ↙
+    { 24, 20, 29, 1, 18, 120, 101668 }, // ⇐
+    { 25, 24, 31, 6, 23, 150, 101788 }, // ⇑
+    { 24, 20, 29, 4, 18, 120, 101938 }, // ⇒
+    { 25, 24, 31, 12, 22, 150, 102058 }, // ⇓
+    { 30, 20, 32, 1, 18, 150, 102208 }, // ⇔
+    { 20, 29, 26, 8, 16, 145, 102400 }, // ⇕
+    { 23, 26, 20, 2, 24, 150, 102545 }, // ∂
+    { 31, 31, 32, 0, 28, 241, 102695 }, // ∅
+    { 24, 23, 25, 1, 22, 138, 102936 }, // ∆
+    { 23, 23, 22, 3, 21, 133, 103074 }, // ∏
+    { 23, 23, 22, 9, 22, 133, 103207 }, // ∐
+    { 21, 22, 17, 1, 21, 116, 103340 }, // ∑
+    { 17, 5, 18, 2, 11, 22, 103456 }, // −
+    { 30, 26, 28, 3, 24, 195, 103478 }, // √
+    { 27, 17, 27, 3, 19, 115, 103673 }, // ∞
+    { 30, 31, 25, 0, 23, 233, 103788 }, // ∫
+    { 12, 20, 9, 1, 20, 60, 104021 }, // ∶
+    { 22, 16, 42, 15, 16, 88, 104081 }, // ≈
+    { 27, 26, 38, 6, 23, 176, 104169 }, // ≠
+    { 28, 25, 23, -4, 21, 175, 104448 }, // ≤
+    { 28, 26, 25, 0, 22, 182, 104623 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_bolditalicIntervals[] = {
@@ -7092,4 +3784,9 @@ static const EpdFontData opendyslexic_14_bolditalic = {
     38,
     -16,
     true,
+    opendyslexic_14_bolditalicBlockOffsets,
+    opendyslexic_14_bolditalicDirectGlyphs,
+    opendyslexic_14_bolditalicGlyphPages,
+    35,
+    opendyslexic_14_bolditalicPageGlyphs,
 };
@@ -2,5347 +2,2695 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_italic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_italic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_14_italic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_italicBitmaps[85332] = {
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC1, 0xFF, 0x42, 0xFF, 0x03, 0xFD, 0x0B,
-    0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x2F, 0xD0, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x40, 0xFF, 0x02, 0xFE,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1A, 0xAA, 0xFE, 0xAA, 0xBF, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xAA, 0xBF, 0xEA,
-    0xAF, 0xEA, 0xAA, 0x90, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xAF, 0x06, 0x40, 0x00, 0x0B, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x3C, 0x1E,
-    0x00, 0x00, 0x00, 0x2F, 0xC7, 0x82, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0xB4, 0x3C, 0x00, 0x00, 0x00,
-    0x3F, 0xCF, 0x43, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x78, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0x83,
-    0xDF, 0xFF, 0xC0, 0x00, 0x00, 0xB4, 0x3C, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x43, 0xEF, 0xFF, 0xC0,
-    0x0B, 0x95, 0xF5, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x03, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0x00, 0x03,
-    0xD0, 0x74, 0x00, 0x3C, 0x00, 0x0B, 0x00, 0x38, 0x00, 0xF4, 0x00, 0x0E, 0x00, 0x38, 0x02, 0xD0,
-    0x00, 0x1D, 0x00, 0x38, 0x0B, 0x80, 0x00, 0x2C, 0x00, 0xB0, 0x1E, 0x00, 0x00, 0x2D, 0x01, 0xF0,
-    0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0x94, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAB, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xC0,
-    0x00, 0x00, 0x02, 0xF4, 0x01, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x03, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x07, 0x80, 0x00, 0x00, 0xF8, 0xFE, 0xBF, 0x00, 0x00, 0x03,
-    0xE0, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF9, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xFB,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xF4, 0x00,
-    0xA8, 0x07, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0x07, 0xF8, 0x2F, 0xF0, 0x00,
-    0x1F, 0xDF, 0xF0, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x2F,
-    0xFD, 0x00, 0x6F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F,
-    0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x05, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x43, 0xFE, 0x0F, 0xF8, 0x2F, 0xE0, 0x7F, 0xC0, 0xFF, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x01, 0x40, 0xF0, 0x0E, 0x1F, 0x83, 0xC2, 0xF4,
-    0x7F, 0xDE, 0xBD, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xBE,
-    0x79, 0xFF, 0x0F, 0xD1, 0xD0, 0xB8, 0x18, 0x0B, 0x00, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F,
-    0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0xFE, 0x1F, 0xE3,
-    0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xE4, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x07, 0xD0, 0x00, 0xB4, 0x00, 0x3E, 0x00,
-    0x02, 0xE0, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x0F, 0x80, 0x80, 0x3E, 0x00, 0xBD, 0x0F, 0x80, 0xF8,
-    0x03, 0xF0, 0x3E, 0x03, 0xD0, 0x1F, 0x82, 0xF4, 0x2F, 0x00, 0xBD, 0x0B, 0xC0, 0xFC, 0x03, 0xF0,
-    0x1E, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7E,
-    0xF8, 0x00, 0x0A, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0x90, 0x1F, 0xF0, 0x00, 0x18, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xAF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x55, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x06, 0x95, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFA, 0xE0, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x1F, 0x87, 0xD0,
-    0x00, 0x7F, 0x0B, 0xC0, 0x01, 0xFC, 0x0F, 0xC0, 0x07, 0xF0, 0x1F, 0x80, 0x1F, 0xC0, 0x2F, 0x80,
-    0x7F, 0xEA, 0xBF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02,
-    0xF5, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x10, 0x00, 0x1F, 0xF0, 0x00, 0xFD, 0x5B, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xFA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xE5, 0x55,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF4, 0x1F, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x1F, 0x80,
-    0x00, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xFE, 0x40, 0x00, 0x00, 0xBF, 0x9B, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xF4, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x6F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFB, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0x7F, 0x80, 0x1F, 0xF4, 0x06, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00,
-    0xBC, 0x00, 0x07, 0xE0, 0x03, 0xD0, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xBE, 0x00, 0xF8, 0x00,
-    0x02, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x0B, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xF9, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x10, 0x00, 0x1F,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00,
-    0xFF, 0xC0, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA0, 0x00, 0x00, 0x01, 0x54, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1A, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xD0, 0x55, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF,
-    0x90, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x41, 0xBF, 0xC0, 0x0F,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x03, 0xF0, 0x7F, 0x30, 0x00, 0x2C, 0x00, 0x03, 0xF0, 0xB9, 0xBC, 0x00, 0x0B, 0x00, 0x01,
-    0xF4, 0x70, 0x0F, 0x00, 0x02, 0xC0, 0x00, 0xFC, 0x30, 0x03, 0x80, 0x00, 0xF0, 0x00, 0xBE, 0x28,
-    0x01, 0xD0, 0x00, 0xB4, 0x00, 0x3F, 0x4E, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x0F, 0xD3, 0xEB, 0xFC,
-    0x00, 0x7D, 0x00, 0x07, 0xF4, 0xBF, 0xFF, 0x00, 0xBD, 0x00, 0x01, 0xFE, 0x0B, 0xE3, 0xDB, 0xFD,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x51, 0x6B, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC,
-    0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x01,
-    0xFC, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0,
-    0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0xBE, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x02, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0xFE, 0x55, 0x56, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x56,
-    0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x5A, 0xAA, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xBF, 0xAA, 0xA5, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xAA, 0xFC,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x1B,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xF9, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0x43, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF3,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x0F,
-    0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFD, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xAA,
-    0x80, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xDF, 0xF4, 0x00,
-    0xFF, 0xBF, 0x40, 0x00, 0xBE, 0x7F, 0xE0, 0x0B, 0xFA, 0xFD, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x7F,
-    0xCF, 0xF0, 0x00, 0x1F, 0xD3, 0xFF, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x0F, 0xFC, 0x2F, 0xE2,
-    0xFE, 0x00, 0x03, 0xFC, 0x3F, 0xF1, 0xFF, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0xBF, 0xDF, 0xF4, 0x7F,
-    0xD0, 0x00, 0xBF, 0x82, 0xFF, 0xFF, 0xC2, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFF, 0xFC, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xFF, 0x02, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xF8,
-    0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00,
-    0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x1B, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x00, 0x03, 0x80, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xBF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xAA, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x2F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
-    0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF,
-    0xEA, 0xAF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01,
-    0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0xA9, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x3F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xD0, 0x00,
-    0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x40,
-    0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x1F,
-    0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xC0,
-    0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x3F, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x2F, 0xFF,
-    0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x1F, 0xFB, 0xFC, 0x0B, 0xF8, 0x00, 0x03, 0xFD, 0x0F, 0xF8,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x3F, 0xD2, 0xFD, 0x00, 0x00, 0x3F, 0xDB, 0xFD,
-    0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xFE, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40,
-    0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x4B,
-    0xF8, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x03, 0x01, 0xD0, 0xB4, 0x2D, 0x0B, 0x82, 0xE0, 0xBC, 0x2F, 0x0B, 0xC1, 0xF0, 0x7C,
-    0x1F, 0x47, 0xD1, 0xF4, 0x7E, 0x1F, 0x83, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3E, 0x0F,
-    0x03, 0x00, 0x40, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x00, 0xB4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0x0B, 0x80, 0x0F, 0x00, 0x7C,
-    0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00,
-    0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00,
-    0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00,
-    0xFF, 0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE,
-    0x7E, 0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x4B, 0xFE, 0x00, 0x03, 0xFB, 0xFF, 0xFD, 0x00, 0x7F, 0xFE, 0x5B, 0xF0, 0x0B, 0xFF, 0x00, 0x1F,
-    0x80, 0xFF, 0xC0, 0x00, 0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x0F, 0x82, 0xFC, 0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x3F, 0xE5, 0x6F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x2F, 0xF9, 0x68, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x01,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0xD0, 0x00, 0x07,
-    0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xD0, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x5A, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x05, 0xFE, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1A, 0x00, 0x00, 0x7F, 0xFF, 0x4F,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0x40, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xC0,
-    0x02, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xEA, 0xBF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x7F, 0x93, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xD0, 0x1B, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x7C, 0x6F, 0xF4, 0x00, 0x03, 0xFB, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE4,
-    0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x01, 0xF4,
-    0x03, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x03, 0xF8,
-    0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xFC, 0xFD, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0B,
-    0xEF, 0xF0, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x2F, 0xC2, 0xFF, 0x40, 0x3F,
-    0x80, 0xFF, 0xD0, 0x3F, 0x40, 0xBF, 0xF0, 0xBF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x90, 0x00, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x1B, 0xF4, 0x00, 0x03, 0xF7, 0xFF, 0xF4, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0x40, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00,
-    0x1F, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x0B, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xE0,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0xFD,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00,
-    0xFD, 0x00, 0x0B, 0xE0, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x01, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0x41, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x01,
-    0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x0F, 0xD0, 0x01, 0xF8,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03,
-    0xFE, 0x55, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x06, 0xE4, 0x00, 0x00, 0x02, 0xF1, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xEF, 0xFA, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0xFF,
-    0x80, 0x03, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0xC0, 0x02, 0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x47, 0xFF,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x54, 0x00, 0x07, 0xFF, 0xF1, 0xFC, 0x00,
-    0x2F, 0xFB, 0xFA, 0xF4, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0xE0, 0x07, 0xF0,
-    0x00, 0x3F, 0xD0, 0x0B, 0xC0, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x00, 0x7F, 0x80, 0x1F, 0x00, 0x00,
-    0xBF, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0x00, 0x0B, 0xFC,
-    0x00, 0x3F, 0x90, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFA, 0xF0, 0x00, 0x00, 0xBF, 0x93, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xC6, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xF9, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x1B, 0xD0, 0x01, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF9, 0x60,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFA, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x51, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x90, 0x1F, 0xF0,
-    0x07, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40,
-    0xBD, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00,
-    0xFD, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x2F, 0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x2F, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x2F, 0x80, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0xBF,
-    0x0F, 0xC0, 0x00, 0x07, 0xF2, 0xF4, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x14, 0x00, 0xFE, 0x01, 0xFC, 0x02, 0xF4, 0x07, 0xF0,
-    0x07, 0xF0, 0x2F, 0xF0, 0x3F, 0x80, 0x1F, 0xC2, 0xFF, 0xD1, 0xFC, 0x00, 0x7F, 0x2F, 0xFF, 0xCF,
-    0xE0, 0x01, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xEF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x0B, 0xFD,
-    0x02, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x41, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x06, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00,
-    0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x07,
-    0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFD, 0x50, 0x07, 0xF4, 0xF0, 0x00, 0x3F, 0x0B, 0x40, 0x02, 0xF8, 0x3C, 0x00, 0x0F, 0xC0,
-    0xF0, 0x00, 0x7E, 0x07, 0x80, 0x02, 0xF4, 0x3C, 0x00, 0x0F, 0xD0, 0xF0, 0x00, 0x3F, 0x47, 0x80,
-    0x00, 0xFF, 0x3D, 0x00, 0x03, 0xFF, 0xFA, 0x80, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x02, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE9, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x7C, 0x00, 0xBF, 0xBF, 0xAF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xD0,
-    0xFE, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x01,
-    0xF8, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xEF, 0xFF, 0xFD, 0x01, 0xF0, 0x15, 0x0F, 0x40, 0x08, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x01, 0x40, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x47, 0xF8, 0x00,
-    0x00, 0x07, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40,
-    0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x90, 0x06, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFE, 0x50,
-    0x00, 0xFC, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0xFD, 0x00, 0xFD, 0x2F, 0xD0, 0x2F, 0xC3, 0xFC, 0x03, 0xFC,
-    0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x78, 0x07, 0x00, 0x7B, 0xC0, 0x20, 0x3E, 0x00,
-    0x0C, 0x2B, 0x00, 0x03, 0x0E, 0x80, 0x00, 0xC3, 0xB0, 0x00, 0x90, 0xDF, 0xD0, 0x70, 0x24, 0x50,
-    0x70, 0x03, 0x41, 0xB4, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDC, 0x03, 0xD7, 0xC0,
-    0xE0, 0x2C, 0x1C, 0x03, 0xC2, 0x80, 0x38, 0x34, 0x0B, 0x43, 0x96, 0xF4, 0x3F, 0xFF, 0x00, 0xFE,
-    0x70, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x0B, 0x00, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00,
-    0x2F, 0x80, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x00, 0xBF, 0x40, 0x1F, 0xE0, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x3F, 0xA9, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x6B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x15, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x1B, 0xE0, 0x00, 0x38, 0x03, 0x40, 0x3F, 0xE0, 0x30, 0x36, 0x0C, 0x08, 0x19, 0x46, 0x02, 0x0C,
-    0xBF, 0x00, 0xC3, 0x35, 0xC0, 0x70, 0xDC, 0x30, 0x34, 0x2F, 0x1C, 0x38, 0x03, 0x81, 0xB4, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE2, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x0F, 0xD0, 0x03, 0xD0, 0x7D,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x3D, 0x0F, 0xC0, 0x02, 0xF0, 0x7F, 0x00, 0x1F, 0x80, 0xFE, 0x02,
-    0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xAA, 0xAF, 0xEA, 0x90, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xAA, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0x43, 0x80, 0x00, 0x28, 0x00, 0x03, 0x40, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x1F, 0x80,
-    0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0x28,
-    0x00, 0xFD, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x40, 0x00, 0x70, 0x04, 0x1F, 0x03, 0xFF, 0xC0, 0x2F,
-    0xE0, 0x00, 0x00, 0x64, 0x07, 0xC0, 0x3D, 0x03, 0xE0, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x2F, 0x40, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x02,
-    0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x03, 0xEF, 0xFF, 0xFF, 0xF4, 0x01, 0xE7, 0xFF, 0xFD, 0xFC, 0x00, 0xF0, 0x7F, 0xF8, 0x7F,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x14, 0x00, 0x00, 0x7F, 0xD0, 0x3D, 0x00, 0x02, 0xFF, 0xC0, 0x3C,
-    0x00, 0x0B, 0xFF, 0xC0, 0x7C, 0x00, 0x0F, 0xFF, 0x40, 0xB8, 0x00, 0x2F, 0xFF, 0x00, 0xF4, 0x00,
-    0x2F, 0xFF, 0x00, 0xF0, 0x00, 0x2F, 0xFD, 0x01, 0xF0, 0x00, 0x2F, 0xFC, 0x02, 0xE0, 0x00, 0x0F,
-    0xFC, 0x03, 0xD0, 0x00, 0x03, 0xF4, 0x03, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0xF0,
-    0x0B, 0x80, 0x00, 0x1F, 0xD0, 0x0F, 0x40, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x7F, 0xC0, 0x1F,
-    0x00, 0x00, 0xFF, 0x40, 0x2E, 0x00, 0x01, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xFE, 0x00, 0x3C, 0x00,
-    0x03, 0xFD, 0x00, 0x7C, 0x00, 0x0B, 0xFC, 0x00, 0xB8, 0x00, 0x0F, 0xF8, 0x00, 0xF4, 0x00, 0x2F,
-    0xF4, 0x00, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0xFE, 0x1F, 0xD3, 0xFD, 0x7F,
-    0xC0, 0x01, 0x40, 0x03, 0x00, 0x08, 0x00, 0x0F, 0xE0, 0x00, 0x34, 0x00, 0x34, 0x2B, 0xE0, 0xBF,
-    0x80, 0x00, 0x14, 0x00, 0xFC, 0x01, 0x78, 0x00, 0x34, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xD0, 0x01,
-    0xC0, 0x03, 0xC0, 0x3F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x0B, 0x42, 0xC1, 0xC0,
-    0x0C, 0x2C, 0x01, 0xC3, 0x80, 0x38, 0x3D, 0x5B, 0x42, 0xFF, 0xD0, 0x0B, 0xE0, 0x00, 0x10, 0x00,
-    0x04, 0x00, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x34, 0x00, 0x0E, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2B, 0xFA, 0x80, 0x1F,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x3C, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0xF4, 0x00, 0xD0, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0xF3, 0x80, 0x00, 0x01, 0xF0, 0x03, 0xC7, 0x40, 0x00, 0x07, 0xD0, 0x0F,
-    0x0B, 0x40, 0x00, 0x0F, 0x80, 0x3C, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFC,
-    0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xAF, 0xEA, 0x00, 0x7C, 0x1A, 0x40, 0x7F, 0xFF, 0x80, 0x7D, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0,
-    0x3C, 0x74, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x39, 0x5B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3C,
-    0x00, 0x02, 0xAF, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0x40, 0x0D, 0x06, 0xBE, 0x40, 0x0F,
-    0x80, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0xB0, 0x00,
-    0x00, 0x0B, 0xC0, 0x0F, 0x38, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x1D, 0x00, 0x00, 0x07, 0xD0, 0x0F,
-    0x0B, 0x40, 0x00, 0x03, 0xE0, 0x0F, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03,
-    0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x02, 0x00, 0x0B, 0xF8,
-    0x00, 0x7E, 0x00, 0x0F, 0xFE, 0xAF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x83, 0x47, 0x40, 0x00, 0x00,
-    0x00, 0xB0, 0x2E, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xFE, 0x55, 0x69, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00,
-    0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0xA8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD5, 0x5A, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55,
-    0xA8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x55, 0x6A, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xDF, 0x80, 0x00, 0x1E,
-    0x01, 0xF0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00,
-    0x2F, 0xD0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x6F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x03, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x8E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x07, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F,
-    0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8,
-    0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50,
-    0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF,
-    0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x5F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2D,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF,
-    0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x0F, 0xC3, 0xE0,
-    0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x0B, 0xF1,
-    0xFD, 0x07, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0xBF, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F,
-    0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF8, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF4, 0x16, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x06, 0xA9, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE,
-    0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x06, 0xA9,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0x40, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x03,
-    0xFD, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55, 0xBF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x40, 0x00,
-    0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x03, 0xF4, 0x7F, 0xE0, 0x00, 0x1F, 0x80, 0x1F, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03,
-    0xF0, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x02, 0xF4, 0x00,
-    0x7F, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x3E, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x01, 0xFD, 0x01,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0x0B, 0xC0, 0x00, 0x74, 0x00, 0x0F, 0x40, 0x00, 0x70,
-    0x00, 0x2F, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0x3D, 0x01, 0xE0, 0x00, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0x80, 0x00, 0x00, 0xFC, 0x03, 0x80, 0x00, 0x01, 0xF8,
-    0x03, 0xE0, 0x00, 0x02, 0xF4, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0xD0, 0x00, 0x1F,
-    0x80, 0x2F, 0xCE, 0x55, 0xBF, 0x00, 0x3F, 0xCF, 0xFF, 0xFE, 0x00, 0x3F, 0x8F, 0xFF, 0xF8, 0x00,
-    0xBF, 0x47, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00,
-    0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE, 0x47,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80,
-    0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0x9F, 0x80, 0x00, 0x00, 0x2E, 0x01, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F,
-    0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5,
-    0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE,
-    0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x34, 0x00, 0x01, 0xFB, 0x42,
-    0xC0, 0x00, 0x0F, 0x0F, 0x0E, 0x00, 0x00, 0x78, 0x0F, 0xF0, 0x00, 0x01, 0xC0, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x7C, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x01, 0xF8, 0x03, 0xE0,
-    0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x3E, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x5A, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF9, 0xF8, 0x00,
-    0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x01, 0xFD, 0x01, 0xFC, 0x00,
-    0x02, 0xFC, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0,
-    0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F,
-    0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2C, 0x30, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x00, 0xA0, 0x34, 0x00,
-    0x00, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80,
-    0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE,
-    0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x02, 0xFE,
-    0x40, 0x00, 0x02, 0xFF, 0xFD, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xB4,
-    0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0x00, 0x03, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x2D, 0x00,
-    0xF8, 0x00, 0x0F, 0xF0, 0x01, 0x6B, 0xD0, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x01, 0xFD, 0x54, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x5A, 0xFF, 0xFF, 0x80, 0x00, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFE, 0x47, 0xD2, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0x00, 0x2F, 0xF9, 0x68, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x02, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x07, 0xE0,
-    0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x5A, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0x40, 0x3C, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x00, 0x7D, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x05, 0xAF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE5, 0x50, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x06, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x0B, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x03, 0xC0, 0x00, 0x7E,
-    0x00, 0x07, 0x40, 0x07, 0xD0, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x5A, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x7E, 0x55, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x60, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x01, 0xFE,
-    0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0,
-    0x0F, 0x00, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x18, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4,
-    0x00, 0x07, 0xF4, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3E, 0x1F, 0x40, 0x0B, 0x80,
-    0x2E, 0x00, 0x90, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x07, 0xFC,
-    0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x7C, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x2E, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xCF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x03,
-    0xF8, 0x01, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xC0, 0x00, 0x00, 0xF1, 0xD0, 0xE0, 0x00,
-    0x00, 0x74, 0x2F, 0xF0, 0x00, 0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07,
-    0x9B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x7F,
-    0x80, 0x0B, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00,
-    0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x80, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x0F, 0xD0,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC1,
-    0xF4, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0xFE, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xAB, 0xFD, 0x00, 0x0F, 0xD0,
-    0x01, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFA, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7D,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00,
-    0xBD, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x3F, 0xE5, 0x5B, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x38, 0x00, 0x00, 0xFB, 0x80, 0xD0, 0x00, 0x0B, 0x4B,
-    0x0B, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x00, 0x01, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xEA, 0xFF,
-    0x40, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0xFF, 0x95, 0x6F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x03,
-    0xFD, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40,
-    0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x4F, 0xC0,
-    0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0x7D, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC1, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xBE,
-    0x6F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00,
-    0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x2F,
-    0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00,
-    0x0F, 0xD0, 0x1F, 0x80, 0x02, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x01, 0xD0, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80,
-    0x02, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x2F, 0x40,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0x80,
-    0x00, 0xFD, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x01,
-    0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00,
-    0xBD, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x7F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0x47, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00,
-    0xF8, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x3F,
-    0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x3D, 0x0F, 0xF4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00,
-    0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F,
-    0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00,
-    0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF,
-    0x40, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0x90, 0x00, 0x28, 0x00, 0x02,
-    0xD0, 0x00, 0x78, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x07, 0xC0,
-    0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0x80, 0x03,
-    0xFF, 0x00, 0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01,
-    0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8,
-    0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4, 0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00,
-    0x0B, 0xFE, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9,
-    0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xF9, 0x68, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xE5, 0xA0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x01, 0x00, 0x00, 0x7F, 0xFF, 0xE5, 0x5B, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00,
-    0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x5A, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x68, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF9, 0x55, 0xA0, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x95, 0x6F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
-    0x2F, 0xF9, 0x68, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x07,
-    0x40, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x3F, 0x2E, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE5, 0xA0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x96, 0x80, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x80,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x7F, 0xF8, 0x03, 0xF9, 0x55, 0x5B, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0x02, 0x90, 0x00,
-    0x00, 0xFF, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xF9, 0x55, 0x5B, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF7, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x0A, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0xA8, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x00, 0x7E, 0x00,
-    0x07, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xC0, 0x00,
-    0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x6A, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x09, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x00, 0x7E, 0x00,
-    0x07, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD5, 0x5A, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x02, 0xFD, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x1F, 0x40, 0x00, 0x3C, 0x03,
-    0xE0, 0x05, 0xAF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x81, 0xF9, 0x54, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x01, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF5, 0x56, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x3E,
-    0x00, 0x5A, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x18, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x06, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x6A, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x07, 0x80, 0x00, 0x0B, 0x80, 0xB4, 0x00, 0x00, 0x0F, 0xEF,
-    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x03, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x07,
-    0xD0, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x5A, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x7E, 0x55, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x60, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xAB, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x01, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x25, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3E, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1A, 0x00, 0x00, 0x1F, 0xFF, 0xD3,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x0F,
-    0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xAA, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xBE, 0x00, 0x00, 0x01, 0xFE, 0x4F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0x01, 0xBF, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0xAB, 0xF0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x25, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x50,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xA5,
-    0x56, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x40, 0x02, 0xC0, 0x00,
-    0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xA0, 0x00, 0x07,
-    0xFF, 0xF4, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF4, 0x0F, 0xFF, 0x00, 0x03, 0xF0,
-    0x00, 0xFF, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x7C, 0x00,
-    0x03, 0xFC, 0x00, 0x2E, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x00, 0x03, 0xE0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFE, 0xAB, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xBE, 0x00, 0x00, 0x07, 0xF9, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0D, 0x01, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xAA, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xF0, 0x00,
-    0x00, 0x1B, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xF9, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x06,
-    0x80, 0x00, 0x1F, 0xFF, 0xD3, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0x3F, 0xFC,
-    0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x3F, 0xC0,
-    0x01, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xB8, 0x00, 0x07, 0xF8, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFA, 0xAF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x1F, 0xE4, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x34, 0x06, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xAA, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xF0,
-    0x00, 0x00, 0x1B, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xF9, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBD,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xA5, 0x56, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x68, 0x00, 0x01, 0xFF,
-    0xFD, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFD, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0xF4, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x00, 0x00,
-    0xFF, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x80, 0x03, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xF8, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xAA, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xEF, 0x80, 0x00, 0x01, 0xFE, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0x40, 0x6F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00,
-    0x00, 0x06, 0xA0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x18, 0x00,
-    0x06, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xC6, 0xFF,
-    0x40, 0x00, 0x3F, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFE, 0x40, 0xFD, 0x00,
-    0x3F, 0xD0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x03, 0xD0, 0x07, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x80,
-    0x00, 0x7C, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0x3F, 0x80, 0x00, 0x7D,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0xFF,
-    0x00, 0x03, 0xF8, 0x0B, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xAA,
-    0xAA, 0xBF, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xD5, 0x55, 0x5B, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x6B, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE5, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x6F, 0xF4, 0x00, 0x03, 0xFB, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE4, 0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0,
-    0x00, 0x3D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x7F, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xBF,
-    0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xFF, 0x01, 0xC0, 0x00, 0xF4, 0xE0, 0xF0, 0x00,
-    0x78, 0x2F, 0xF4, 0x00, 0x2C, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xD0, 0x1F,
-    0xB4, 0x1C, 0x03, 0xC2, 0xC3, 0xC0, 0x78, 0x0F, 0xF4, 0x07, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x2F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xF8, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xBF,
-    0x40, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0x40, 0x00, 0x6F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xE3, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0F,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0xBF, 0xFD, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0xBC, 0x3F, 0x40, 0x00,
-    0xFC, 0xFD, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x0B, 0xEF, 0xF0, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x2F,
-    0xC2, 0xFF, 0x40, 0x3F, 0x80, 0xFF, 0xD0, 0x3F, 0x40, 0xBF, 0xF0, 0xBF, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x50, 0x03, 0xD0, 0xBC, 0x00, 0x3C,
-    0x1F, 0x00, 0x0B, 0x87, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x1F, 0x3E, 0x00, 0x02, 0xEF, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xF7, 0xF8,
-    0x00, 0x3F, 0x2F, 0xD0, 0x03, 0xD0, 0xFF, 0x00, 0x7C, 0x0F, 0xF8, 0x0F, 0xC0, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFA, 0xAB, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B,
-    0x80, 0x03, 0xF4, 0x00, 0x3D, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x03,
-    0xF8, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFA,
-    0xAB, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x40, 0xBC, 0x00,
-    0x01, 0xF4, 0x0F, 0x80, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x07, 0xE0, 0x2F, 0x00, 0x00, 0xBD, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAB, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0x40, 0x7E, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x7D, 0x03, 0xFD,
-    0x00, 0xFC, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA4, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0xEA, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xAF, 0xF4, 0x00, 0x00, 0x01, 0x6F,
-    0xFF, 0xA4, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFE, 0x90, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x0F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F,
-    0xD7, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x02, 0xFD, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8,
-    0x00, 0x01, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00,
-    0xBF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x1E, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF4,
-    0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0x80,
-    0x07, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x2F,
-    0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0xBF, 0x80,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF,
-    0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE,
-    0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x41,
-    0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0xBF,
-    0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01, 0xFE,
-    0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F, 0xE0,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x09, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x47,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1E,
-    0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x1F, 0xC0, 0x00, 0x7F, 0x80,
-    0x0B, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x40,
-    0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0xE7, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
-    0xFE, 0x41, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x03,
-    0xF4, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x0B, 0xF0,
-    0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x0B,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x7F, 0x80, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x00, 0x00,
-    0xBF, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x42, 0xFD, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0x01,
-    0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x1F,
-    0xE0, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x7F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0x41, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02,
-    0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x2B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x56, 0xAB, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xAA, 0x95, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x40,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00,
-    0xFE, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x18, 0x00, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x3F,
-    0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x29, 0x40, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFD, 0x40, 0x5B,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0xC0, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x94, 0x00,
-    0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xAB, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x58, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFE, 0x1F, 0xE4, 0x0F, 0x00, 0x07, 0xFE, 0xAF, 0xFB, 0xE0, 0x00, 0x38, 0x00, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x16, 0xBC, 0x07, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x40, 0x00, 0x1F,
-    0xD5, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0xFF, 0xF4, 0x00,
-    0x18, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x6F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xF9, 0x5B, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x1B,
-    0xD0, 0x01, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF9, 0x60, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xF0, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD1, 0xBD, 0x00, 0x00, 0x7E, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x02, 0x40, 0x00, 0x00, 0x78, 0x02, 0xD0, 0x00, 0x00, 0x02, 0xF1, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xF9, 0x5B, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x07, 0x80, 0x0B, 0x80, 0xB8, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x1B,
-    0xD0, 0x01, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xF9, 0x60, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x10, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xAA, 0xBF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07,
-    0xF5, 0x45, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x1E, 0x40, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0xBF, 0xEA, 0xAF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x0F,
-    0x80, 0x00, 0x01, 0xE0, 0x07, 0xC0, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFD,
-    0x51, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x79, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xEA,
-    0xAF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFA, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x51, 0x40, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x90,
-    0x1F, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x10, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x01, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0xB8, 0x0F, 0x40,
-    0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xF5, 0x45, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x1E, 0x40, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4,
-    0x00, 0x0C, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xD0,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0B, 0x40, 0x0B, 0x40, 0x00,
-    0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xA9,
-    0x50, 0xBF, 0x00, 0x15, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x70, 0x3E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0xBD, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x05, 0x50,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0x80, 0x00, 0x00, 0x00, 0x78, 0xB0, 0x34, 0x00,
-    0x00, 0x00, 0x0F, 0x07, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4,
-    0x00, 0x00, 0x6A, 0x90, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xC0, 0x00, 0x2F, 0xB0, 0x2C, 0x00,
-    0x03, 0xC3, 0x83, 0x80, 0x00, 0xB4, 0x2E, 0xF0, 0x00, 0x0F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x02, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80,
-    0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2B, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x02, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03,
-    0xE0, 0x00, 0x3F, 0x40, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0xBF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xDF, 0xC0,
-    0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x55,
-    0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0,
-    0x00, 0x2E, 0x00, 0x07, 0x40, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x7E, 0x00,
-    0x02, 0xF4, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8,
-    0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF7,
-    0xF0, 0x00, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x74, 0xD0, 0x00, 0x00, 0x0D, 0x0A,
-    0x00, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x02,
-    0xFD, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xBF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x06, 0x80, 0x01, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x06, 0x90, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00,
-    0xBC, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0x80, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0x7F, 0x00,
-    0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03,
-    0xF0, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0x80, 0x00, 0xFD, 0x01, 0xF8,
-    0x00, 0x2F, 0xD0, 0x2F, 0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF7, 0xF0, 0x00, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x01, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x01, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0xF4, 0x00,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0xBF, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xEF, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x3F, 0xE3, 0xFC,
-    0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0xFF, 0x4B, 0xF4, 0x00, 0x00, 0xFF, 0x6F, 0xF4, 0x3F,
-    0xE7, 0xFC, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xD0,
-    0x0B, 0x40, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x28, 0x00, 0xFE,
-    0x01, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x07, 0xF0, 0x3F, 0xF0, 0x3F, 0x80, 0x1F, 0xC3, 0xFF, 0xD1,
-    0xFC, 0x00, 0x7F, 0x3F, 0xFF, 0xCF, 0xE0, 0x01, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x3F, 0xFD, 0x00, 0x01, 0xFF,
-    0xC0, 0xFF, 0xF0, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x4F,
-    0xF0, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F,
-    0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x3F,
-    0xE7, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x2D, 0x00, 0x00, 0x01, 0x80, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC2, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00,
-    0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0xB0, 0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xA0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFD, 0x04, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3E, 0x00,
-    0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x64, 0x07, 0xC0, 0x3D, 0x03,
-    0xE0, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x2F,
-    0x0F, 0x80, 0x1E, 0x00, 0x7C, 0x0A, 0x00, 0x02, 0x80, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0,
-    0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x07, 0x4F, 0x00, 0x03, 0xC3, 0xE0, 0x07, 0xD0, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xD0, 0x00, 0x6A,
-    0x40, 0x00, 0x0F, 0xD1, 0xFC, 0x3F, 0xC7, 0xFC, 0xBF, 0x80, 0x0B, 0xD0, 0x0B, 0xD0, 0xFD, 0x00,
-    0xFD, 0x2F, 0xD0, 0x2F, 0xC3, 0xFC, 0x03, 0xFC, 0xBF, 0xC0, 0xBF, 0xC0, 0x2F, 0xD1, 0x41, 0xC0,
-    0x0F, 0x01, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0D, 0x0C, 0x28, 0x0C, 0x34, 0x2C, 0x2F,
-    0xF0, 0x0B, 0x80, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x0F, 0xE0, 0x00,
-    0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x50, 0x00, 0x74, 0x00, 0x2D, 0x2E,
-    0x01, 0xF0, 0x0F, 0x9F, 0x80, 0x03, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x90, 0x00, 0x14, 0x00,
-    0x00, 0x14, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0x1F, 0xD0, 0x01, 0xAD, 0x00, 0x01, 0xAD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC,
-    0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x07,
-    0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x60,
-    0x02, 0xC1, 0x5F, 0x0F, 0xF4, 0x01, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x24, 0x00, 0xE0, 0x02, 0xD5,
-    0x07, 0xFC, 0x0D, 0x00, 0x38, 0x00, 0x00, 0x00, 0xBF, 0xA9, 0x50, 0xFF, 0xFF, 0xFD, 0x05, 0x55,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0D,
-    0x00, 0xC0, 0x2C, 0x0B, 0x43, 0xE0, 0x24, 0x00, 0x07, 0x47, 0x03, 0x40, 0xC0, 0x2C, 0x01, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x34, 0x1F, 0xE0, 0x2F, 0xF4, 0x01, 0xA0, 0xA4, 0x02, 0xFF, 0x80, 0xBF,
-    0x02, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x24, 0x0F, 0xFC, 0x03, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x41, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0xFD, 0x2F, 0xD3, 0xFC, 0xBF, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x2F, 0xC0, 0x2F,
-    0xC0, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x0B, 0xFC, 0x2F, 0xE0, 0x2F, 0xE0, 0x02, 0xF4, 0x0D, 0x0C,
-    0x28, 0x0C, 0x34, 0x2C, 0x2F, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40,
-    0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x03, 0x00, 0x08, 0x00, 0x0F, 0xE0, 0x00, 0x34, 0x00, 0x34, 0x2B, 0xE0, 0xBF,
-    0x80, 0x00, 0x24, 0x01, 0xE0, 0x07, 0x80, 0x0E, 0x00, 0x2C, 0x00, 0x1F, 0xF0, 0x06, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x3D, 0x0B, 0xC0, 0xFC, 0x1F, 0x82, 0xF4, 0x3F, 0x02, 0xA0, 0x0A, 0xAA, 0xA0,
-    0x7F, 0xFF, 0xC2, 0xD0, 0x1E, 0x0F, 0x00, 0xB4, 0x28, 0x02, 0x80, 0x60, 0x00, 0x19, 0x3D, 0x00,
-    0xB4, 0x0F, 0x4B, 0xC0, 0x07, 0xFE, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x01, 0x90, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0x9F, 0x40, 0x3D, 0x02, 0xE0, 0xB4, 0x00, 0x2C, 0x02,
-    0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE2, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0,
-    0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x38, 0x03, 0x80, 0x30, 0x0C, 0x0F, 0x01, 0x00,
-    0x14, 0x01, 0x40, 0xF0, 0x0B, 0x42, 0xD0, 0x1E, 0x07, 0xEA, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC1, 0xC0, 0x0E, 0x0B, 0x00, 0x34, 0x38, 0x01, 0xC0, 0xD0, 0x0B, 0x07, 0xFF,
-    0xF8, 0x05, 0x55, 0x40, 0x03, 0xE1, 0x80, 0x28, 0x74, 0x80, 0xC1, 0x83, 0x06, 0x08, 0x28, 0x34,
-    0x30, 0xD0, 0x40, 0x42, 0x00, 0x06, 0x08, 0x03, 0x74, 0x02, 0xD0, 0x03, 0xC0, 0x0D, 0xE0, 0x74,
-    0x70, 0x02, 0xF4, 0x07, 0x02, 0xEF, 0x02, 0xC0, 0xE0, 0xD0, 0xE0, 0xB4, 0x2E, 0xF0, 0x3C, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0xC0, 0x30, 0x7C, 0x24, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0xFD, 0x00, 0xFD, 0x2F,
-    0xD0, 0x2F, 0xC3, 0xFC, 0x03, 0xFC, 0xBF, 0xC0, 0xBF, 0xC0, 0x2A, 0xAA, 0x93, 0xFF, 0xFD, 0x3C,
-    0x03, 0xC7, 0x80, 0x3C, 0xA0, 0x06, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0xAF, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFD, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x42, 0xF0, 0x0B, 0xC0, 0xF8, 0x03, 0xF0, 0x7D, 0x00, 0xF8,
-    0x3F, 0x00, 0xBC, 0x0F, 0xC0, 0x3F, 0x07, 0xE0, 0x1F, 0x81, 0xA0, 0x06, 0x90, 0x19, 0x55, 0x02,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF4, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x01, 0x80, 0x02, 0xF4, 0x3B, 0x00, 0xBB, 0xCD, 0xB0, 0x0E, 0x0F, 0xCE, 0x02, 0xD0,
-    0xBF, 0xC0, 0x3C, 0x0F, 0xF4, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x03, 0xF4, 0x03, 0xFF, 0xAF,
-    0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x0F, 0xE0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xFA, 0xFF,
-    0xC0, 0x2F, 0xD0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3D, 0x01, 0xFC, 0x2F,
-    0x00, 0x7C, 0x03, 0xF0, 0x0F, 0x81, 0xF4, 0x0B, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0x40,
-    0x0F, 0xEB, 0xD0, 0x07, 0xD0, 0x3F, 0x00, 0xF4, 0x0F, 0x80, 0xBD, 0x00, 0x7F, 0xFF, 0x00, 0x58,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3D, 0x0C, 0x08, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x01, 0xF5, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x02, 0xE5, 0x00, 0x05, 0xBE, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x06, 0xD0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0x55, 0x40, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0x95, 0x55, 0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55, 0x55, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x95, 0x55,
-    0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xAF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x01, 0xFE, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x7C, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x00, 0x07, 0xD0, 0x03,
-    0xF0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-    0x80, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xE0, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x58, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBE, 0x80, 0x0B, 0xFF, 0xE9,
-    0xAF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFD, 0x40, 0x04, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x40,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xEA, 0xAF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x2F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x02, 0xFC, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0xFF, 0x40,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x3F, 0xFF, 0xA0, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0x00,
-    0xF8, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0x07, 0xE0,
-    0x01, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFA,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xE0,
-    0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x0F, 0x40,
-    0x00, 0x07, 0xE0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0x82, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3D, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xD0, 0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0A, 0xA5, 0x4B, 0xF0, 0x15, 0x50, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFF, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0x40, 0x00, 0x2F, 0xF4, 0x00,
-    0x7D, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xE0,
-    0x00, 0x2F, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0xF0, 0x00, 0x2F, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x0F,
-    0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF4,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFF,
-    0x80, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x3F, 0xC0, 0x0B, 0xF5, 0xFD, 0x00, 0x07, 0xF4, 0x02, 0xFD, 0x3F,
-    0xC0, 0x00, 0xBF, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x80, 0x01, 0xFE,
-    0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0xFF, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x2F,
-    0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x03, 0xFE, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x1F,
-    0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x01,
-    0xFC, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x01, 0x50, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0,
-    0x00, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xE0, 0x00, 0x3E, 0x00, 0x0F, 0xD0, 0x00,
-    0x2E, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x1F, 0xC0, 0x00, 0x3D, 0x00, 0x2F, 0x80, 0x00, 0xFC,
-    0x00, 0x3F, 0x40, 0x1B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x0F, 0xC0,
-    0x00, 0x3C, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x01, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0xC0, 0x00, 0x2E,
-    0x00, 0x3F, 0x00, 0x02, 0xF4, 0x01, 0xFD, 0x55, 0xBF, 0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00,
-    0x2F, 0x40, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x0F, 0xF0, 0x1F, 0x80, 0x16, 0xFF, 0x80,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xAA, 0xAF, 0xD0, 0x00, 0x03, 0xE0,
-    0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0xF8,
-    0x00, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x55,
-    0x55, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x95, 0x55, 0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x02, 0xFF, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xD0,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F,
-    0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xEF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF3, 0xFF, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x1F, 0xFD, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0x43, 0xFF, 0xD0, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0x02, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x03, 0xFA, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x5B, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xE0,
-    0x00, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF5, 0xFD, 0x00, 0x07, 0xF4, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x7F, 0x83, 0xFC, 0x00,
-    0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x80, 0x01, 0xFE, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0xFF,
-    0x01, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x2F, 0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x03, 0xFE, 0x00,
-    0x07, 0xF9, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xAA, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF4, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0x80,
-    0x01, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xDF, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xF5, 0xFD, 0x00, 0x07, 0xF8, 0x02, 0xFD, 0x3F, 0xC0,
-    0x00, 0xBF, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x80, 0x01, 0xFE, 0x03,
-    0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0xFF, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x2F, 0xF0,
-    0x00, 0x3F, 0xC7, 0xF8, 0x03, 0xFE, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xF8,
-    0x00, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFC,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xE0, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x8B, 0xFF,
-    0x80, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0x80,
-    0x3F, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xBF,
-    0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x01,
-    0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xFB, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-    0x7D, 0x00, 0x0B, 0xDF, 0x40, 0x03, 0xE7, 0xE0, 0x01, 0xF6, 0xF0, 0x00, 0x7D, 0x7E, 0x00, 0x3F,
-    0x3F, 0x00, 0x0B, 0xC3, 0xF0, 0x0F, 0xD3, 0xE0, 0x00, 0xFC, 0x3F, 0x01, 0xF8, 0xBD, 0x00, 0x1F,
-    0x83, 0xF0, 0x3F, 0x0F, 0xC0, 0x02, 0xF4, 0x3F, 0x4F, 0xD0, 0xFC, 0x00, 0x3F, 0x43, 0xF6, 0xFC,
-    0x1F, 0x80, 0x03, 0xF0, 0x3F, 0xFF, 0x02, 0xF4, 0x00, 0x7F, 0x03, 0xFF, 0xE0, 0x3F, 0x00, 0x0F,
-    0xE0, 0x2F, 0xFC, 0x07, 0xF0, 0x00, 0xFD, 0x02, 0xFF, 0x40, 0xBE, 0x00, 0x1F, 0xC0, 0x2F, 0xE0,
-    0x0F, 0xD0, 0x02, 0xFC, 0x01, 0xA8, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02,
-    0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50, 0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBE, 0x55, 0x55,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0x0B,
-    0xD0, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7E,
-    0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x07, 0xF0,
-    0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00,
-    0xFD, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xEA, 0xFF,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x1B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xAA, 0x40, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xF9, 0x56, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00,
-    0xFC, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x2B, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xEB, 0xFA, 0xAF, 0xD0, 0x02,
-    0xF8, 0x03, 0xF0, 0x02, 0xF0, 0x0B, 0xC0, 0x07, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0B, 0xE0, 0x00,
-    0xF4, 0x1E, 0x00, 0x0F, 0xD0, 0x01, 0xF0, 0x2D, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x3E, 0x00, 0x2F,
-    0xC0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6B, 0xFF, 0xFA, 0x40,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE3,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x00,
-    0x2E, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x02, 0xF0,
-    0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x00,
-    0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x7E,
-    0x00, 0x2F, 0x80, 0x55, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0xF4,
-    0x0F, 0x80, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00,
-    0x07, 0xE0, 0x3E, 0x00, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x1F, 0xC0, 0x7C, 0x00, 0x03, 0xFC, 0x07,
-    0xD0, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFB,
-    0xF0, 0x00, 0xFF, 0xFC, 0xBE, 0x00, 0x00, 0x54, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x50, 0x03, 0xE0, 0x01, 0xFC,
-    0x00, 0xFC, 0x01, 0xF4, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x3F,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x07, 0xE0, 0x03, 0xF0, 0x07, 0xD0, 0x02, 0xF4, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x00, 0x3E, 0x00,
-    0x2F, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xF0, 0x01, 0xF0,
-    0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3F,
-    0x00, 0x0F, 0x40, 0x1F, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x07, 0xE0, 0x02, 0xF0, 0x03,
-    0xD0, 0x02, 0xF4, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x01, 0x50, 0x03, 0xE0, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0xBD,
-    0x00, 0x7F, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0x80, 0x07, 0xE0, 0x03, 0xF0, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x7D, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x1F, 0x40,
-    0x0F, 0xC0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0xBC,
-    0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0F,
-    0x80, 0x07, 0xC0, 0x0F, 0x80, 0x07, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x02, 0xFA, 0xA9, 0xFE, 0xAA,
-    0xF9, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0x01, 0xFC, 0x01, 0xF4, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x03, 0xD0,
-    0x3F, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x7C, 0x0B, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0xBF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x40,
-    0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x02, 0xFE, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0x00, 0x3F, 0xD0, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x02,
-    0xFD, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xE0, 0x01, 0xFC, 0x01, 0xF4, 0x00,
-    0x0F, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0xF4, 0x1F, 0x80, 0x00, 0x7C, 0x0B, 0xD0,
-    0x00, 0x7F, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFD, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xE0,
-    0x00, 0x7D, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x94, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2A, 0xE0, 0x00, 0x02,
-    0xFF, 0x00, 0x3F, 0xFF, 0xA6, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0x80, 0x2F, 0xE0, 0x1F, 0xD0, 0x00, 0x2F, 0x40, 0x7F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x07,
-    0xD0, 0x00, 0x01, 0xF0, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x1F, 0x40, 0x00,
-    0x02, 0xF0, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xF8, 0x7E, 0x00, 0x00, 0x07, 0xE0,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0,
-    0xFD, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0xFF, 0x40,
-    0x02, 0xFE, 0x00, 0x0F, 0x80, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x2F, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x3E, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3D,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xAA, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x2F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0x95, 0xBF, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00,
-    0xFC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0xF4,
-    0x00, 0x0B, 0xF4, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x5A, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x0B, 0xFE, 0x47, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xB8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x6A, 0x90, 0x00, 0x03, 0xEB, 0xFF, 0xFE, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x2F, 0xD0, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x2F, 0x80,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE4, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0x78, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x1F, 0x40, 0x1F, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x3E, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0xBE, 0x02, 0xF5, 0x5A, 0xFF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x00, 0x00,
-    0xF4, 0x0B, 0xE0, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x07,
-    0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x02, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xF0, 0x00, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x2A, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x07, 0xE0, 0x00, 0x74, 0x01, 0xF4, 0x00, 0x03,
-    0xC0, 0x3E, 0x00, 0x5A, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x95,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x18, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF0, 0x07, 0xF0, 0x00,
-    0x00, 0xFD, 0x02, 0xFF, 0x80, 0x7F, 0x40, 0x00, 0x03, 0xF8, 0x0B, 0xFC, 0x07, 0xF4, 0x00, 0x00,
-    0x07, 0xF0, 0x3F, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0x43, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xC3, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF7,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xCB, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xFF, 0x0F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0xFF, 0xE0, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x09, 0x00, 0xB0, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x6B, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFC, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF0,
-    0x0F, 0x80, 0x00, 0xBF, 0x80, 0x3D, 0x00, 0x0B, 0xFD, 0x01, 0xF0, 0x00, 0xBD, 0xF0, 0x0B, 0xC0,
-    0x07, 0xD7, 0xC0, 0x3E, 0x00, 0x7D, 0x2E, 0x00, 0xF4, 0x07, 0xE0, 0xF4, 0x07, 0xC0, 0x3E, 0x07,
-    0xC0, 0x2F, 0x03, 0xF0, 0x2F, 0x00, 0xF8, 0x3F, 0x00, 0xF8, 0x03, 0xE3, 0xF0, 0x07, 0xE0, 0x1F,
-    0x6F, 0x00, 0x2F, 0x40, 0xBE, 0xF4, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x07, 0xF0, 0x1F, 0xF4, 0x00,
-    0x2F, 0x80, 0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x00, 0x01, 0xFE, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0xC0, 0x3E, 0x00, 0x02, 0xFE, 0x00, 0xF4, 0x00,
-    0x2F, 0xF4, 0x07, 0xC0, 0x02, 0xF7, 0xC0, 0x2F, 0x00, 0x1F, 0x5F, 0x00, 0xF8, 0x01, 0xF4, 0xB8,
-    0x03, 0xD0, 0x1F, 0x83, 0xD0, 0x1F, 0x00, 0xF8, 0x1F, 0x00, 0xBC, 0x0F, 0xC0, 0xBC, 0x03, 0xE0,
-    0xFC, 0x03, 0xE0, 0x0F, 0x8F, 0xC0, 0x1F, 0x80, 0x7D, 0xBC, 0x00, 0xBD, 0x02, 0xFB, 0xD0, 0x03,
-    0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xC0, 0x7F, 0xD0, 0x00, 0xBE, 0x02, 0xFE, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7D, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0xF8,
-    0x3F, 0x40, 0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xD7, 0xFD, 0x00, 0x00, 0xFC, 0x3F, 0xF4, 0x00, 0x1F,
-    0x80, 0xFF, 0xC0, 0x03, 0xF4, 0x0B, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x2E, 0x01,
-    0xF0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xF4, 0x0B,
-    0xC0, 0x01, 0xF0, 0x0F, 0x80, 0x02, 0xE0, 0x0F, 0x40, 0x03, 0xD0, 0x2F, 0x00, 0x07, 0xC0, 0x3E,
-    0x00, 0x3F, 0x80, 0x3D, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0,
-    0x00, 0x01, 0xA4, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x0B,
-    0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
-    0x0B, 0xEF, 0xC0, 0x2F, 0xBE, 0x00, 0x3E, 0xBF, 0x01, 0xFE, 0xF4, 0x00, 0xF9, 0xFC, 0x0F, 0xCF,
-    0xC0, 0x0B, 0xD7, 0xF4, 0xBE, 0x7F, 0x00, 0x3F, 0x0F, 0xE7, 0xF2, 0xFC, 0x00, 0xFC, 0x3F, 0xFF,
-    0x4F, 0xE0, 0x07, 0xE0, 0xFF, 0xF8, 0x7F, 0x40, 0x3F, 0x42, 0xFF, 0xC2, 0xFD, 0x00, 0xFD, 0x0B,
-    0xFD, 0x0F, 0xF0, 0x07, 0xF0, 0x1F, 0xF0, 0x7F, 0xC0, 0x3F, 0xC0, 0x7F, 0x02, 0xFE, 0x00, 0xFE,
-    0x00, 0x54, 0x0F, 0xF4, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x01,
-    0xA4, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x80, 0x03,
-    0xF4, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0xFC,
-    0x00, 0x03, 0xD0, 0xBD, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x2F, 0x0B,
-    0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0B, 0xD0, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0xEA, 0xBF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xD0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0x0F,
-    0xC0, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x1F,
-    0xC0, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x40, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x06, 0xE4, 0x00, 0x00, 0x02, 0xF1,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xEF, 0xFA, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xF4, 0x00, 0x00,
-    0xFF, 0x80, 0x03, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0xBF, 0xC0, 0x02, 0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x47,
-    0xFF, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x2F, 0xF9, 0x68,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0xE5, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0x50, 0x0B, 0xC0,
-    0x04, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF4,
-    0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFD,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x01, 0xF8, 0x03, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0xF4, 0x0B, 0x40, 0x07,
-    0xF0, 0x00, 0xF4, 0x0F, 0x00, 0x0F, 0xE0, 0x00, 0xF4, 0x2E, 0x00, 0x0F, 0xD0, 0x01, 0xF0, 0x2D,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0xE5, 0x7F, 0x96, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7D,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x2F,
-    0xC0, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xC0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x07,
-    0xD0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x1F, 0x40, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0x80,
-    0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x02, 0x00, 0x02, 0x01, 0xC0,
-    0x02, 0xC0, 0xB0, 0x00, 0xF0, 0x38, 0x00, 0x78, 0x1D, 0x00, 0x2D, 0x0B, 0x00, 0x0F, 0x03, 0xC0,
-    0x07, 0xC0, 0xF0, 0x07, 0xE0, 0x3E, 0x5B, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x9F, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x15, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0xBC, 0x00, 0xFC,
-    0x00, 0xBD, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0xFC, 0x01, 0xF4,
-    0x03, 0xF4, 0x01, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x03, 0xF0, 0x07, 0xE0, 0x02, 0xF0,
-    0x03, 0xD0, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x07, 0xC0, 0x0B, 0x80, 0x1F, 0x80, 0x0B, 0xC0, 0x0F, 0x40, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x15, 0x00, 0x7D, 0x00, 0xFD,
-    0x00, 0x7E, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xF8,
-    0x02, 0xF8, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF4, 0x01, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x02, 0xF4,
-    0x03, 0xE0, 0x07, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xC0,
-    0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x1F, 0x80, 0x0B, 0xC0, 0x0F, 0x40,
-    0x2F, 0x40, 0x0F, 0x80, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xAB,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xF9, 0x00, 0x03, 0xFA, 0xAB, 0xF0, 0x00, 0xF8, 0x00, 0x2E, 0x00, 0x7D, 0x00, 0x03,
-    0xC0, 0x2F, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x01, 0xFD, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0x00,
-    0x1F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xFF, 0xFE, 0x40, 0x03, 0xE0, 0x0F, 0xEA, 0xAF,
-    0xC0, 0x0F, 0x40, 0x7E, 0x00, 0x07, 0x80, 0xBC, 0x01, 0xF4, 0x00, 0x0F, 0x03, 0xF0, 0x0B, 0xC0,
-    0x00, 0x7C, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0xFC, 0x00, 0x7F, 0x42, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7E, 0x00, 0xFF, 0xFF, 0xE4, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x07, 0xEA, 0xAB, 0xF0, 0x0B, 0xC0, 0x00, 0xB8, 0x0F,
-    0xC0, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0xB8, 0x1F, 0x40, 0x01, 0xF8, 0x2F, 0x00, 0x1B, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0x0B,
-    0xF0, 0x00, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x10, 0x00, 0x03, 0xFC, 0x02, 0xE4, 0x07, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x7C, 0x02, 0xFE, 0xFF,
-    0x00, 0x0B, 0xC0, 0xBD, 0x00, 0xF4, 0x00, 0xF8, 0x2F, 0x00, 0x07, 0xC0, 0x0F, 0x03, 0xD0, 0x00,
-    0x7C, 0x01, 0xF0, 0xB8, 0x00, 0x07, 0xC0, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x03, 0xD2, 0xE0, 0x00,
-    0x0B, 0x80, 0x7D, 0x3D, 0x00, 0x00, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFE, 0xFC, 0x00,
-    0x02, 0xF0, 0x0F, 0x0B, 0xC0, 0x00, 0x7D, 0x01, 0xF0, 0xBE, 0x00, 0x2F, 0xC0, 0x2E, 0x0B, 0xFE,
-    0xAF, 0xF4, 0x03, 0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x3C, 0x02, 0xFF, 0xFF, 0x40, 0x07, 0x80, 0x06,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0x90, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x0B, 0x00, 0x07,
-    0xC0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00,
-    0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x01, 0xFE, 0x47, 0xE0, 0x00, 0x1F, 0xC0,
-    0x1F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x40,
-    0x07, 0xE0, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x1F, 0x40,
-    0x00, 0x3C, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x81,
-    0xF9, 0x54, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x01, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x01, 0xA0, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x02, 0xE4, 0x6F, 0xC0, 0x00, 0x3C,
-    0x00, 0x1F, 0x80, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x50, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x7E, 0x6B, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE5, 0x40, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x6F, 0xF4,
-    0x00, 0x03, 0xFB, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE4, 0x0F, 0xD0, 0x03,
-    0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x03, 0xF8, 0x00,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xD0,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x3F, 0x80, 0xBF, 0x80, 0x16, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xF9, 0x07, 0xC0, 0x00, 0xF4,
-    0x00, 0x78, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x0A, 0x90, 0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x40, 0x01,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x51, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x90, 0x1F, 0xF0, 0x07, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00,
-    0xFF, 0x07, 0xFC, 0x07, 0xFC, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xBA, 0xAA, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xE0, 0x02,
-    0xC0, 0x00, 0x00, 0x0D, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xD4, 0x00, 0x00, 0x38, 0x00,
-    0x7F, 0xFE, 0x00, 0x03, 0x40, 0x0B, 0x00, 0x74, 0x00, 0xB0, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00,
-    0x0E, 0x00, 0x3C, 0x00, 0xD0, 0x02, 0xD0, 0x03, 0x80, 0x2C, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0x80,
-    0x03, 0xEA, 0xFF, 0x02, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x3E, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x18, 0x00, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x00, 0x0F,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0xB0, 0x00, 0x00, 0xB0,
-    0x00, 0x3C, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x40, 0x1F, 0xAA, 0xAF, 0x95, 0xB8, 0x0B, 0x00,
-    0x02, 0xC0, 0x0B, 0x03, 0xC0, 0x00, 0xF0, 0x02, 0xC0, 0xE0, 0x00, 0x78, 0x00, 0xF0, 0x74, 0x00,
-    0x2D, 0x00, 0xB8, 0x2C, 0x00, 0x0F, 0xAB, 0xFC, 0x0F, 0x00, 0x03, 0xFF, 0xFD, 0x03, 0x80, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x6B, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xE5, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x7C, 0x6F, 0xF4, 0x00, 0x03, 0xFB, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xE4, 0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00,
-    0x7F, 0x00, 0x01, 0xF4, 0x03, 0xF8, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7F, 0x00,
-    0x00, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00, 0xFC,
-    0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x07, 0xD0, 0x3F,
-    0x40, 0x00, 0xBC, 0x0F, 0xD0, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xBD, 0x7F,
-    0xD0, 0x00, 0x0F, 0xC3, 0xFF, 0x40, 0x01, 0xF8, 0x0F, 0xFC, 0x00, 0x3F, 0x40, 0xBF, 0xF0, 0x07,
-    0xF0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0x80, 0x00, 0xBF, 0x80, 0x3D, 0x00, 0x0B, 0xFD, 0x01, 0xF0, 0x00,
-    0xBD, 0xF0, 0x0B, 0xC0, 0x07, 0xD7, 0xC0, 0x3E, 0x00, 0x7D, 0x2E, 0x00, 0xF4, 0x07, 0xE0, 0xF4,
-    0x07, 0xC0, 0x3E, 0x07, 0xC0, 0x2F, 0x03, 0xF0, 0x2F, 0x00, 0xF8, 0x3F, 0x00, 0xF8, 0x03, 0xE3,
-    0xF0, 0x07, 0xE0, 0x1F, 0x6F, 0x00, 0x2F, 0x40, 0xBE, 0xF4, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x07,
-    0xF0, 0x1F, 0xF4, 0x00, 0x2F, 0x80, 0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0xE0, 0x00, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xD0, 0x1B, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xBE,
-    0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF8, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00,
-    0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x2D, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0xF0, 0x0F, 0x40, 0x01,
-    0xF0, 0x0F, 0x00, 0x02, 0xE0, 0x1F, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x07,
-    0xC0, 0x3C, 0x00, 0x0B, 0x40, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xAB,
-    0xF0, 0x0F, 0xF0, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x78, 0x1F, 0xC0, 0x00, 0x78, 0x2F, 0x80, 0x00,
-    0xB4, 0x3F, 0x80, 0x02, 0xF0, 0x3F, 0xFA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x05, 0xFD, 0x55, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xEA, 0xF8, 0x0F, 0xF0, 0x00, 0xF0, 0x7F, 0x00,
-    0x01, 0xD2, 0xFC, 0x00, 0x0B, 0x4F, 0xE0, 0x00, 0x3D, 0x3F, 0x40, 0x07, 0xF0, 0xFF, 0xEB, 0xFF,
-    0x83, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x02,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF0, 0x00,
-    0x02, 0xF4, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xD0,
-    0x03, 0xF0, 0x01, 0xF4, 0x00, 0x2F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0x3F, 0x40, 0x0F, 0xF0,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xC0,
-    0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF4, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x2E, 0x3D, 0x3D, 0x00,
-    0x00, 0xB4, 0x3C, 0x0F, 0x00, 0x01, 0xE0, 0x3C, 0x0F, 0x00, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0x0B,
-    0x80, 0xB4, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x3E, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xE0,
-    0x00, 0xBF, 0x47, 0xE0, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0xBD, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x0F,
-    0xEB, 0xFC, 0x00, 0x1F, 0xC1, 0xBF, 0xFF, 0xFD, 0x00, 0x06, 0xA7, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x95, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x07,
-    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFC, 0x00,
-    0x1F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x24, 0x00, 0x1F, 0xFD, 0x00, 0x7C, 0x00, 0x7E, 0x0F, 0x00, 0xF4, 0x00, 0xFC, 0x07, 0xC2, 0xF0,
-    0x01, 0xF1, 0xBF, 0xFF, 0xC0, 0x02, 0xBB, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00,
-    0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x3F, 0xE5, 0x5B, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x41, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0x40, 0x00, 0x00, 0xFF, 0x1F, 0x00,
-    0x00, 0x0F, 0xD4, 0x7D, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0x3F,
-    0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x03,
-    0xF0, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x1F,
-    0xC0, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x05, 0x55, 0xBC, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x15, 0x55, 0x55, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0x80, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAF,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xF0, 0x02, 0xFF,
-    0xC0, 0x00, 0x2F, 0xC0, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x14, 0x00, 0x0F,
-    0xFF, 0xD0, 0x0B, 0xE0, 0x3C, 0x03, 0xD0, 0x07, 0x40, 0xF0, 0x01, 0xD0, 0x78, 0x00, 0xB0, 0x2D,
-    0x00, 0x3C, 0x0F, 0x01, 0xFC, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0x00,
-    0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x3F, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0x83, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF3, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x1F, 0xFD, 0x3F, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xD0, 0xFF,
-    0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0x02, 0xFF, 0xF8, 0xB4, 0x3F, 0xFF, 0x40, 0xFF, 0xFC,
-    0x03, 0xFF, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x1F, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0xC2, 0xFD, 0x0F, 0xC0,
-    0x00, 0x02, 0xF0, 0xBF, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x2F, 0x8B, 0xC0, 0x00, 0x00, 0x0F, 0xCF,
-    0xDB, 0xD0, 0x00, 0x00, 0x01, 0xFB, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0xFF, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x7F, 0xCB, 0xFC, 0x00, 0x07, 0xFD, 0x2F, 0xF1, 0xFF,
-    0x84, 0x0B, 0xFD, 0x0F, 0xF8, 0x3F, 0xF7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xBF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x02, 0xFE, 0xAB, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x05, 0x56, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x01, 0xE0, 0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x24, 0x02, 0xC0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0,
-    0x01, 0xFF, 0xE4, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0xB0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE3,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xFF, 0x80,
-    0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x03,
-    0xFF, 0xF8, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x0F, 0x80, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x1F, 0x0F, 0xC0,
-    0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xDB, 0xD0, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xEF,
-    0xF0, 0x00, 0x02, 0xF2, 0xFE, 0x00, 0x00, 0xFC, 0x3F, 0xD0, 0x00, 0x7E, 0x0B, 0xFC, 0x00, 0x2F,
-    0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x3F, 0xF4, 0x60, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7C, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0B,
-    0xDB, 0xD0, 0x2F, 0xC0, 0x00, 0x03, 0xF3, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0xFC, 0x1F, 0xC0,
-    0x00, 0x00, 0xBD, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xCF,
-    0xEF, 0xE0, 0x00, 0x00, 0x0B, 0xE3, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x4F, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xC3, 0xF9, 0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFD, 0x3F, 0xF0, 0x00, 0x03,
-    0xF4, 0xBF, 0x0B, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x01, 0x50, 0x03, 0xC0,
-    0x00, 0xBC, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x0B, 0x69, 0x07, 0xD0, 0x00, 0xF3, 0xD1, 0xF4, 0x00,
-    0x1E, 0x3D, 0x3D, 0x00, 0x03, 0xD7, 0xDF, 0x40, 0x00, 0x3E, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0xF4, 0xFF, 0xC0, 0x00, 0x1F, 0x1F, 0xBF, 0x00, 0x02, 0xF2, 0xF3, 0xF8, 0x00, 0x3E,
-    0x3F, 0x1F, 0xE0, 0x07, 0xC3, 0xF0, 0xFF, 0x40, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x4B, 0xF4, 0x00, 0x0A,
-    0xFF, 0xE8, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00,
-    0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFD,
-    0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x05, 0x5B, 0xF9, 0x40, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x02,
-    0xF8, 0x00, 0x7E, 0x0F, 0xE0, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0B, 0xEF, 0xF0,
-    0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x2F, 0xC2, 0xFF, 0x40, 0x3F, 0x80, 0xFF,
-    0xC0, 0x3F, 0x40, 0xBF, 0xF0, 0xBF, 0x00, 0x3F, 0xFC, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x47, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0xBF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0xF8, 0x00, 0x00,
-    0x03, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x3F,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x0B,
-    0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xCF, 0xFF,
-    0xFC, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x07, 0xC7, 0xD0, 0x00,
-    0x03, 0xE7, 0xE0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xF9, 0xFF,
-    0x00, 0x00, 0xBC, 0x3F, 0xE0, 0x00, 0x3F, 0x07, 0xFD, 0x00, 0x1F, 0x80, 0xFF, 0xC0, 0x0B, 0xC0,
-    0x1F, 0xF8, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x68, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00,
-    0xBC, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0x00,
-    0x03, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x74, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x95,
-    0x55, 0x5B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x0F, 0x40, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xEF, 0xFF,
-    0x40, 0x02, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x0F, 0xFE, 0x40, 0x7F,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFC,
-    0x0B, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xE0, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x80,
-    0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xFC, 0x03, 0xF4,
-    0x00, 0x07, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x07, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFE, 0xFF, 0xF4, 0x07, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x2F, 0x80, 0x00, 0x7F, 0xE4, 0x0B, 0xF0, 0xA9, 0x00, 0x02, 0xFD, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xBF, 0xC0,
-    0x00, 0x00, 0x3F, 0x40, 0x1F, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x01, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x3D, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xF8,
-    0x0B, 0xE0, 0x00, 0xBC, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0xC0,
-    0x00, 0xF8, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x01, 0xF8,
-    0x07, 0xFD, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x3F, 0xF8, 0x08, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xD1,
-    0xBD, 0x1F, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x1B, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x6F, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0x00, 0x1F, 0x40, 0x3C,
-    0x07, 0xC0, 0x03, 0xC0, 0x02, 0xC0, 0xF8, 0x00, 0xF4, 0x00, 0x3C, 0x0F, 0x40, 0x1F, 0x00, 0x0B,
-    0x82, 0xF0, 0x02, 0xD0, 0x02, 0xF0, 0x3E, 0x00, 0x3D, 0x00, 0xBD, 0x03, 0xE0, 0x03, 0xC0, 0x3F,
-    0x80, 0x3E, 0x00, 0x3D, 0x1F, 0xE0, 0x43, 0xF0, 0x03, 0xFF, 0xF8, 0x7C, 0x3F, 0xD4, 0x3F, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x1B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95,
-    0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFF, 0xE4, 0x05, 0xBC, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x26, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
-    0x2F, 0xF9, 0x68, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE6, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2A, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x05, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x4B, 0xC0, 0x10,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x82, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x03, 0xF0,
-    0x7E, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00,
-    0x2F, 0x6F, 0x40, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x2A, 0x00, 0x0B, 0xE0, 0x00, 0x2F,
-    0x40, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0xD0,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00,
-    0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00,
-    0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x14, 0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0B,
-    0x80, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0xBF,
-    0x03, 0xF4, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0xFE, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3C, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x07, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00,
-    0x01, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x00, 0x03, 0xF4,
-    0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x04, 0x7F, 0xFF, 0xF8, 0x2D, 0x00, 0x7C,
-    0x00, 0x3C, 0x00, 0xB8, 0x00, 0x38, 0x00, 0xF0, 0x00, 0x74, 0x00, 0xF0, 0x00, 0xB0, 0x02, 0xE0,
-    0x00, 0xF0, 0x03, 0xD0, 0x00, 0xE0, 0x03, 0xC0, 0x01, 0xD0, 0x07, 0xC0, 0x02, 0xC0, 0x0B, 0x80,
-    0x03, 0xC0, 0x0F, 0x40, 0x03, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x02, 0x80, 0x01, 0x50, 0x00, 0x06, 0x50, 0x7F, 0x00, 0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x0F, 0xD0,
-    0xBD, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x02, 0xF4, 0x0F, 0x40, 0x00,
-    0x3F, 0x01, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0x00, 0x00, 0xBE, 0x02, 0xE0, 0x00, 0x0F, 0xD0, 0x2E,
-    0x00, 0x03, 0xFC, 0x02, 0xF4, 0x06, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xF2, 0x90, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x0A, 0x43, 0xC0, 0x03, 0xD1, 0xF0, 0x00, 0xF0, 0xB4, 0x00, 0x7C, 0x2C, 0x00, 0x2E,
-    0x0F, 0x00, 0x0F, 0x43, 0x80, 0x07, 0xC0, 0xE0, 0x07, 0xE0, 0x3E, 0xAF, 0xF4, 0x07, 0xFF, 0xBC,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x2D, 0xF0, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x00, 0xBC,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x0F, 0xD0, 0x1F, 0x41,
-    0xF0, 0x1F, 0xC0, 0x2F, 0x42, 0xE0, 0x3F, 0xC0, 0x3F, 0x43, 0xD1, 0xFF, 0x80, 0x3F, 0xD3, 0xEB,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0xFE,
-    0x00, 0x00, 0x1F, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0x02, 0xFC, 0x00, 0x00, 0x2E, 0x03, 0xFC, 0x00,
-    0x00, 0x3D, 0x07, 0xF8, 0x00, 0x00, 0x3C, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x06,
-    0x00, 0x01, 0x80, 0xF0, 0x00, 0x3C, 0x0F, 0x00, 0x0B, 0x41, 0xD0, 0x00, 0xF0, 0x2C, 0x00, 0x0F,
-    0x03, 0xC0, 0x02, 0xE0, 0x78, 0x34, 0x3D, 0x07, 0x87, 0x0F, 0xC0, 0x7D, 0xFB, 0xFC, 0x03, 0xFF,
-    0xFF, 0x80, 0x0B, 0xF8, 0xF4, 0x00, 0x1C, 0x1F, 0x00, 0x02, 0xC2, 0xF0, 0x00, 0x38, 0x3E, 0x00,
-    0x01, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-    0xF9, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x07, 0xC0, 0x3F, 0x40, 0x00, 0x7C, 0x07, 0xF0, 0x00, 0x07,
-    0xC0, 0xBD, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x01, 0xF4, 0x1F, 0x80,
-    0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x6F, 0xF4, 0x00,
-    0x03, 0xFB, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE4, 0x0F, 0xD0, 0x03, 0xFD,
-    0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x03, 0xF8, 0x00, 0x07,
-    0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xD0, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00,
-    0x3F, 0x80, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x79, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x7F, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0x40, 0xBF, 0xE4, 0x07, 0xD0, 0x3F,
-    0xFB, 0xFD, 0x00, 0x01, 0xF0, 0x0B, 0xFF, 0xFE, 0x90, 0x00, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x90,
-    0xF4, 0x00, 0x7F, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xAA, 0x55, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x6E, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xAB, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x2E,
-    0x00, 0xFF, 0xFD, 0x0B, 0xD1, 0xFD, 0x02, 0xC0, 0xFF, 0xF8, 0x00, 0x38, 0x07, 0xFF, 0xF9, 0x0F,
-    0x00, 0xB9, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFA, 0x94, 0x0F, 0x40, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xFE,
-    0xAA, 0xF0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x3A, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x3F, 0x80, 0x7F, 0xE4, 0x07, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xF4, 0x07, 0xFF, 0xFF,
-    0x90, 0x00, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0xFC, 0x00, 0x3F, 0x47, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFA, 0xA5, 0x50,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1B, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x1A, 0x90, 0x1F, 0x00, 0x7F, 0xFE, 0x03, 0xD0, 0xFE,
-    0x41, 0xE0, 0xBF, 0xFD, 0x00, 0x2C, 0x02, 0xFF, 0xFA, 0x47, 0x40, 0x7D, 0xBF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFA, 0xA4, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xAA, 0xF4, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x6F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF0, 0x01,
-    0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x03,
-    0xFF, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x3F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD3, 0xFD, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF7, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x3F, 0xF9, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xD3, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0x0F, 0xFF, 0x4B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xFD, 0x0F, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0x42, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xFC, 0x01,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xE0, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0x01, 0xFD,
-    0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xD1, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF8, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xAF, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xEB, 0xFD, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF2, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE1,
-    0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFF, 0x40, 0x02, 0xFF, 0xE0, 0x3F,
-    0xF8, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00,
-    0x02, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x00,
-    0x2F, 0x4F, 0xD0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0x81, 0xBF, 0xD0, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x80, 0x03, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80,
-    0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x02, 0xE0, 0x00, 0xB0, 0x2F, 0x00, 0x03, 0xC2, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0xB4, 0xF0,
-    0x00, 0x03, 0xCF, 0x40, 0x00, 0x1E, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x1F, 0x0B, 0xE0, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x1F, 0x00, 0x1F, 0x00, 0xF8,
-    0x00, 0x7C, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF0,
-    0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xF0, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x00,
-    0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x54, 0x02, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x2F,
-    0xFF, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0x40,
-    0xB4, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x3C, 0x03,
-    0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF0, 0x0F, 0x80, 0x02, 0xE0, 0x0F,
-    0x40, 0x03, 0xD0, 0x1F, 0x00, 0x07, 0xC0, 0x3F, 0x50, 0x3F, 0x80, 0x3F, 0xE0, 0xBE, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0xF8,
-    0x02, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x02, 0xA0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x07, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBE, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0A,
-    0x50, 0xBF, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0x2F, 0x80, 0xF8, 0x00, 0x03, 0xF4, 0x1F, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x07, 0xE0,
-    0x2E, 0x00, 0x00, 0xFD, 0x03, 0xD0, 0x00, 0x1F, 0xC0, 0x3D, 0x00, 0x07, 0xFC, 0x03, 0xF4, 0x06,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x06, 0x00, 0x06, 0x02, 0xC0, 0x03, 0xC0, 0xE0, 0x00, 0xE0,
-    0x74, 0x00, 0xB4, 0x2C, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x0B, 0x80, 0xE0, 0x07, 0xD0,
-    0x3D, 0x5F, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0x6E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x1F, 0xDF, 0xF4, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0xBE, 0x7F, 0xE0, 0x0B, 0xFA,
-    0xFD, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x7F, 0xCF, 0xF0, 0x00, 0x1F, 0xD3, 0xFF, 0x03, 0xFD, 0x7F,
-    0xC0, 0x00, 0xBF, 0x0F, 0xFC, 0x2F, 0xE2, 0xFE, 0x00, 0x03, 0xFC, 0x3F, 0xF1, 0xFF, 0x0F, 0xF8,
-    0x00, 0x1F, 0xE0, 0xBF, 0xDF, 0xF4, 0x7F, 0xD0, 0x00, 0xBF, 0x82, 0xFF, 0xFF, 0xC2, 0xFF, 0x00,
-    0x03, 0xFD, 0x07, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xE0, 0x7F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x3F, 0xFF, 0x02, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0x0F,
-    0xF4, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x2F, 0xD0, 0x0F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x3E, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0x7F, 0x03, 0xF7,
-    0xD0, 0x0B, 0x9F, 0xC1, 0xF6, 0xF0, 0x03, 0xE3, 0xF0, 0xFC, 0xFC, 0x01, 0xF4, 0xFD, 0xFC, 0x7E,
-    0x00, 0xBC, 0x3F, 0xFE, 0x3F, 0x80, 0x3F, 0x0B, 0xFF, 0x0F, 0xD0, 0x1F, 0x82, 0xFF, 0x47, 0xF0,
-    0x0B, 0xD0, 0x7F, 0x83, 0xFC, 0x03, 0xF4, 0x1F, 0xC0, 0xFF, 0x01, 0xFC, 0x02, 0x90, 0x7F, 0x80,
-    0xBF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x05, 0x40, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xF8, 0x00,
-    0xBD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x2C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x01, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF5, 0xAF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00,
-    0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD3, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFD, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xF5, 0xAF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x02, 0xFE, 0x55, 0x69, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xEA, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x02, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x40, 0xB4, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0x00, 0x03, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x2D, 0x00, 0xF8, 0x00, 0x0F, 0xF0, 0x01, 0x6B, 0xD0, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x01, 0xFD, 0x54, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x5A, 0xFF, 0xFF, 0x80, 0x00, 0x80, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x47, 0xD2, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x06, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD5, 0x55, 0x54, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x55, 0x55, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x09, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x00, 0x7E, 0x00, 0x07, 0x40, 0x01,
-    0xF4, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x05, 0xAF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x1F, 0x95, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x18, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00,
-    0x00, 0x06, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x01, 0x80, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x6F, 0x80, 0xBF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFB, 0xF0, 0x0B, 0xE9, 0x40, 0x1F, 0x40, 0x2D, 0x00, 0x00, 0xF8, 0x00, 0x38, 0x00,
-    0x1F, 0x80, 0x00, 0xB4, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x24, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x56, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xA5, 0x00, 0xFC, 0x03, 0xC0, 0x00, 0x2F, 0x00,
-    0x2C, 0x00, 0x0B, 0xD0, 0x00, 0xE0, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x1F,
-    0xD0, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00,
-    0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0x80, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x6F, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x0B, 0xE9, 0x40, 0x1F, 0x40,
-    0x00, 0x2D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xB4, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x24, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0x56, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFA, 0x50, 0x0F, 0xC0, 0x03,
-    0xC0, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0xBD, 0x00, 0x01, 0xE0, 0x0B, 0xF4, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFB, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x3F,
-    0xE0, 0x00, 0x15, 0x40, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF4, 0x01, 0xFF, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x0B, 0xFF, 0x40, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xFC,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xCF,
-    0xFE, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x7F, 0xF4, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
-    0xC3, 0xFF, 0xD2, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFD, 0x0F, 0xFF, 0x43, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xD0, 0xBF, 0xFC, 0x0B, 0xFF, 0xE0, 0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0xAA, 0x80, 0x0A, 0x80, 0x00,
-    0x07, 0xF0, 0x07, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xF4, 0x0F, 0xE0, 0x00, 0x00,
-    0x1F, 0xC0, 0xFF, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xFA, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xDF,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE3, 0xFF, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x1F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0x81, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0x03, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0x56, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0x80, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x90, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x03, 0xC0, 0x3F, 0xD0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x1A, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0x40, 0xBF, 0x80, 0x7F,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x1F, 0xE0,
-    0x00, 0x7F, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0xFE,
-    0x00, 0x03, 0xF8, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0x2F, 0xD3, 0xFC, 0x00, 0x0F, 0xF0,
-    0x07, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0xFF,
-    0x40, 0x02, 0xFD, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC2, 0xFD, 0x02, 0xFF, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x3F, 0xE0, 0x00, 0xBF, 0x9F, 0xE0, 0x07, 0xFD, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x02, 0xFF,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xAF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xF8, 0x00,
-    0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xF0, 0x00, 0xBD, 0xF0, 0x02, 0xF0, 0x01, 0xF5, 0xF0, 0x03, 0xE0,
-    0x07, 0xD2, 0xE0, 0x03, 0xD0, 0x1F, 0x83, 0xD0, 0x07, 0xC0, 0x3E, 0x07, 0xC0, 0x0B, 0xC0, 0xFC,
-    0x0B, 0xC0, 0x0F, 0x83, 0xF0, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x1F, 0x80, 0x1F, 0x6F, 0x00, 0x2F,
-    0x40, 0x2F, 0xBD, 0x00, 0x3F, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0xD0, 0x00, 0xBE, 0x00,
-    0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF5, 0xFD, 0x00, 0x07, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x7F, 0x83, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x80, 0x01, 0xFE, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xD0,
-    0xFF, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x2F, 0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x03, 0xFE,
-    0x00, 0x07, 0xF9, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x02, 0xFC, 0x00, 0x03,
-    0xFC, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0x0B,
-    0xF8, 0x00, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xF0, 0x00, 0xBD, 0xF0, 0x02, 0xF0, 0x01, 0xF5, 0xF0,
-    0x03, 0xE0, 0x07, 0xD2, 0xE0, 0x03, 0xD0, 0x1F, 0x83, 0xD0, 0x07, 0xC0, 0x3E, 0x07, 0xC0, 0x0B,
-    0xC0, 0xFC, 0x0B, 0xC0, 0x0F, 0x83, 0xF0, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x1F, 0x80, 0x1F, 0x6F,
-    0x00, 0x2F, 0x40, 0x2F, 0xBD, 0x00, 0x3F, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0xD0, 0x00,
-    0xBE, 0x00, 0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x50,
-    0x16, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x03, 0xF8, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0x0F, 0xF8, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x7E,
-    0x00, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x0B, 0xD0, 0x00, 0x0F, 0x40,
-    0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0xEA, 0xBF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x95, 0xBF, 0xD0, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xF4, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x0F,
-    0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0x40, 0x0F, 0xF9, 0x00, 0x1B, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x0F, 0xD0, 0x01, 0xF8, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xEA, 0xAA, 0x6F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x55, 0xBF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFE,
-    0x95, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF0, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xF0, 0x0B, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x00,
-    0x00, 0x1F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF9, 0x00, 0x1B, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x07,
-    0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07,
-    0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xEA,
-    0xAA, 0x6F, 0x80, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0xE5, 0x5B,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x0B,
-    0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x94, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2A, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xFF, 0xA6, 0xBF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0x1F, 0xE0, 0x1F, 0xE0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x7F, 0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x90, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0xF4, 0x00, 0xBF, 0x00, 0x04, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x3F, 0xC0,
-    0x2E, 0x40, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xBF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x07,
-    0xE0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0x80, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00,
-    0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x06, 0x80, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x02, 0xF8,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xE2, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x2B, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x1F,
-    0xE0, 0x00, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0xBD, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x25, 0x40, 0x00, 0x25, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0x80, 0x00, 0x00,
-    0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x0F, 0xF8, 0x00, 0x3F, 0xD0,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x01, 0x40, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x02, 0xF0,
-    0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x03,
-    0xE0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xFD, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x07,
-    0xC0, 0x00, 0x3F, 0xC0, 0x1F, 0x40, 0x03, 0xFE, 0x00, 0xBF, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xBF, 0x00, 0x03, 0xFF, 0xF2, 0xF8, 0x00, 0x00, 0x54, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0xFE, 0x00,
-    0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x03, 0xFE, 0x03, 0xFD, 0x03, 0xFD, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06,
-    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1D, 0x00, 0x2D,
-    0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x3C, 0x01, 0xF8, 0x00, 0x3E, 0x5B, 0xF4,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xE0, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xF4, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x2F,
-    0xE0, 0x00, 0x7E, 0x00, 0x01, 0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x7F, 0xC0,
-    0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0x90, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x7E,
-    0x00, 0x00, 0x00, 0x7C, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xFF, 0xF9, 0x00, 0x0F, 0x80,
-    0x3F, 0xAA, 0xBF, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x1E, 0x01, 0xF0, 0x07, 0xD0, 0x00, 0x3C, 0x0F,
-    0xC0, 0x2F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0xFC, 0x00, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0x01, 0xFD,
-    0x0B, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0x00, 0xBF, 0xFF, 0xFF, 0x01, 0xF8, 0x03, 0xFF, 0xFF,
-    0x90, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFD, 0x20,
-    0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x01, 0xF6, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x7F,
-    0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x03,
-    0xFE, 0x80, 0x7F, 0x80, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0xE0, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-    0x0B, 0x40, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x0B, 0x40,
-    0x03, 0xC0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x03, 0xC0,
-    0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x2D,
-    0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0xB4, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x00,
-    0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x03,
-    0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x40, 0x2F, 0xF0, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFF, 0x0B, 0xF8, 0x00,
-    0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x3F, 0xD0, 0x0B, 0xFC, 0x2F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x01, 0xFF, 0x0B, 0xF8,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0xBF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x02,
-    0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xE0, 0x01,
-    0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x43, 0xFD,
-    0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFE, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1B,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x95, 0x54, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x5F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF5, 0x55, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x01, 0x55, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0xFD, 0x00, 0x3F, 0xF4, 0x1F, 0xFF, 0x0F, 0xFF, 0x43, 0xF9, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0xFE, 0x1F, 0xE3, 0xFD, 0x7F, 0xD0, 0x07, 0xE0, 0xFE, 0x1F, 0xE3, 0xFD, 0x7F,
-    0xD0, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x1F, 0xE0,
-    0x00, 0xFF, 0x00, 0x1F, 0xD3, 0xFD, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x7F, 0xD0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x3F, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x01, 0x60, 0x00, 0x01, 0xE0, 0x00, 0x06, 0x08, 0x00, 0x03, 0xC0, 0x00, 0x0C,
-    0x0C, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x88, 0x00, 0x3C, 0x00, 0x00, 0x25, 0x68, 0x00, 0xF4, 0x00,
-    0x00, 0x34, 0x70, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x48, 0x52, 0x04, 0x00, 0x00, 0x3E, 0x15, 0x15, 0x48, 0x00, 0x00, 0xFC,
-    0x22, 0x58, 0x94, 0x00, 0x03, 0xF0, 0x30, 0xCC, 0x30, 0x00, 0x0B, 0xC0, 0x3B, 0x8E, 0xE0, 0x00,
-    0x2F, 0x40, 0x2E, 0x07, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0F,
-    0xFC, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF4, 0x3F, 0xD0,
-    0x0B, 0xFC, 0x2F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x03, 0xFC,
-    0x00, 0xBF, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x03, 0x40, 0x09, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x7E, 0x00, 0xFC, 0x01, 0xF4, 0x2F,
-    0x00, 0x3E, 0x00, 0xFC, 0x0F, 0x80, 0x1F, 0x00, 0x3D, 0x03, 0xC0, 0x0B, 0x80, 0x1F, 0x02, 0xD0,
-    0x03, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3F, 0x02, 0xF0,
-    0x0F, 0x80, 0xBC, 0x03, 0xC0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0xA0, 0x3F, 0x03,
-    0xF0, 0x2F, 0x02, 0xF4, 0x0F, 0x40, 0xF8, 0x0B, 0xC0, 0xBC, 0x03, 0xC0, 0x3C, 0x01, 0xD0, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x0B, 0x00, 0x09, 0x03, 0xF0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0xBC, 0x01, 0xF4, 0x03, 0xF0, 0x0F, 0x40, 0x3F, 0x00, 0x7D, 0x02, 0xF0, 0x07,
-    0xC0, 0x0F, 0x80, 0x3C, 0x00, 0xF4, 0x01, 0xF0, 0x0B, 0x40, 0x1A, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2F, 0x80, 0x00, 0xF7, 0xD0, 0x0B, 0xD2, 0xF4, 0x3F,
-    0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0xBD,
-    0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x02,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF,
-    0x00, 0x0F, 0xC0, 0x00, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x2A, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x4B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xCF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x07, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x1F, 0xFF, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x6F, 0xFF, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xDF, 0xFC, 0x00, 0x0F,
-    0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0xFD, 0x00, 0x00, 0x2F,
-    0x00, 0xFD, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x03,
-    0xF0, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x06, 0x4F, 0x00, 0x03, 0xC3, 0xE0, 0x07, 0xD0, 0xBF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xD0, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x01, 0xD3, 0x4B, 0x00, 0x00, 0x01, 0xFB, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xCD, 0x3C, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x01, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x38, 0x12, 0x47, 0x0A, 0x2D, 0x30,
-    0xF3, 0xEA, 0xB4, 0x0B, 0xBB, 0x40, 0x6F, 0x40, 0x01, 0xF8, 0x00, 0xBF, 0xD0, 0x0B, 0xEF, 0x4B,
-    0x9C, 0xF8, 0x78, 0xD3, 0xC9, 0x28, 0x10, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFA, 0xFF, 0xE0,
-    0x1F, 0xFA, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0x40, 0x00,
-    0x3F, 0x41, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x41, 0xFF, 0x80,
-    0x0F, 0x40, 0x38, 0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBE, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x0B, 0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F,
-    0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x0B, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x1D, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0D, 0x1C, 0x03, 0x40, 0xC0, 0x71, 0x0C,
-    0x0E, 0x34, 0xC0, 0xD3, 0x2C, 0x1D, 0x03, 0x81, 0xD0, 0xB0, 0x1F, 0xBE, 0x00, 0xFF, 0xC0, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x3C, 0x00, 0xEC, 0x03, 0x9C, 0x0E, 0x38, 0x3C, 0x79,
-    0x7F, 0xFE, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x02, 0x80, 0x00,
-    0x34, 0x00, 0x03, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0x07, 0x40, 0x00, 0x38, 0x00, 0x07, 0x41, 0x96,
-    0xF0, 0x3F, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0xB4, 0x00, 0xA0, 0x00, 0x30, 0x00, 0x2E,
-    0xFC, 0x0F, 0x43, 0x83, 0x80, 0xA1, 0xC0, 0x38, 0x74, 0x2C, 0x0F, 0xFD, 0x00, 0xB9, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07,
-    0x80, 0x0F, 0x40, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x0E, 0x09, 0x02, 0x80,
-    0xA0, 0x34, 0x0D, 0x02, 0xD7, 0x80, 0x0F, 0xE0, 0x0B, 0x47, 0x41, 0xC0, 0x3C, 0x2C, 0x03, 0x82,
-    0xE6, 0xF0, 0x0B, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x74, 0x74, 0x0D, 0x03, 0x81, 0xC0, 0x38, 0x28,
-    0x03, 0x82, 0xC0, 0xB4, 0x0F, 0xFF, 0x00, 0x15, 0xA0, 0x00, 0x1D, 0x07, 0xFF, 0x80, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xE6, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0x41, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xC0, 0x0F, 0xE0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x00, 0x06,
-    0xF8, 0x00, 0x03, 0x80, 0xA0, 0x00, 0xF0, 0x07, 0x00, 0x2C, 0x00, 0x70, 0x03, 0x83, 0x07, 0x40,
-    0xB4, 0xB0, 0xB0, 0x0F, 0x0F, 0x0F, 0x00, 0xF0, 0xE1, 0xE0, 0x1F, 0x00, 0x3D, 0x02, 0xF0, 0x07,
-    0xC0, 0x2F, 0x01, 0xF8, 0x02, 0xFE, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x02,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xED, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x34, 0x00,
-    0x70, 0x00, 0xB0, 0x00, 0xE0, 0x01, 0xD0, 0x2F, 0xFE, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x18, 0x0F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0F,
-    0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x10,
-    0x28, 0x00, 0x01, 0xC0, 0x00, 0x74, 0x03, 0xFD, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0xE0,
-    0x10, 0x6D, 0x07, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x02,
-    0x34, 0x02, 0x1C, 0x02, 0x0B, 0x02, 0xFF, 0xD0, 0xAF, 0xFC, 0x00, 0x74, 0x00, 0x2D, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x60, 0x00, 0x34, 0x00, 0x0C, 0x00, 0x07, 0xFD, 0x00, 0x01,
-    0xD0, 0x00, 0x74, 0x10, 0x7C, 0x1F, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x02, 0xD0, 0x00, 0x70, 0x00, 0x0D, 0x00, 0x01, 0xEF, 0xD0, 0x2E, 0x0B, 0x03, 0xC0, 0x70,
-    0x34, 0x07, 0x03, 0x81, 0xE0, 0x2F, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1D,
-    0x00, 0x2C, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x40, 0x2F, 0x00,
-    0x3D, 0x00, 0x00, 0x2E, 0x90, 0x03, 0x80, 0xC0, 0x1C, 0x07, 0x00, 0x70, 0x74, 0x00, 0xBF, 0x40,
-    0x0B, 0x5E, 0x00, 0xF0, 0x1C, 0x07, 0x40, 0xB0, 0x1E, 0x07, 0x80, 0x3F, 0xF8, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x34, 0x3C, 0x0E, 0x02, 0xC0, 0xC0, 0x2C, 0x1C, 0x03, 0xC0, 0xE5, 0xF8,
-    0x07, 0xFF, 0x40, 0x00, 0x70, 0x00, 0x1E, 0x03, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0xBE, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x03,
-    0xD0, 0x00, 0x00, 0x02, 0xFE, 0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xF4, 0x0F, 0x40, 0x00,
-    0x00, 0x0F, 0xF2, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xE3, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x3F,
-    0xCB, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xBD, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x3D, 0x00, 0x40, 0x00, 0x01,
-    0xFF, 0xFE, 0xFD, 0x6F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xF2, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x03, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x41,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x95, 0x5A, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x41, 0x40, 0x00, 0x3F, 0x80, 0x00, 0xFB,
-    0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x03, 0xF0, 0x10,
-    0x00, 0x1F, 0xFF, 0xF9, 0xFE, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xE0,
-    0x00, 0x03, 0xF8, 0x00, 0x02, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xAA, 0xA8, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xE9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF5, 0xFE, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0xBF, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-    0xAF, 0xFE, 0xAB, 0xFE, 0xBF, 0xEA, 0x90, 0x00, 0xFF, 0xC0, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F,
-    0xF8, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xCF, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x02, 0xFE, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFA, 0xA5,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xAF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x2E, 0x56, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0x91, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x90, 0x7F, 0x00,
-    0x00, 0x3F, 0x90, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xF0, 0x02, 0xF0,
-    0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x1F, 0xD0, 0x00, 0x29, 0x07, 0xF0, 0x1F, 0xD0, 0x0B,
-    0xF4, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x03, 0xFC, 0x00,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x01, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x7C, 0x00, 0x50, 0x03, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7C, 0x1F, 0xF4, 0x3E, 0x00, 0x00, 0xBC, 0x3F, 0xF8, 0x3D, 0x00, 0x00, 0xBC, 0x7E, 0xF8,
-    0xBC, 0x00, 0x00, 0xBC, 0xFC, 0xFC, 0xF8, 0x00, 0x00, 0xBD, 0xF8, 0xFC, 0xF4, 0x00, 0x00, 0xBF,
-    0xF4, 0xBE, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xD0, 0x00,
-    0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x95, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x6F, 0xF0, 0x00, 0xF8,
-    0x03, 0xF8, 0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x7E, 0x00,
-    0x00, 0x3E, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x0F, 0xC0, 0x24, 0x03, 0xD0,
-    0x2F, 0x00, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x0B, 0xC0, 0xBC, 0x03, 0xE0, 0x0B,
-    0xC0, 0x3E, 0x03, 0xE0, 0x1F, 0x40, 0x3F, 0x00, 0xF4, 0x0F, 0x40, 0xBC, 0x00, 0xF8, 0x07, 0xC0,
-    0x18, 0x03, 0xF0, 0x07, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0xBD,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x2F, 0x00,
-    0x0F, 0xF9, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x56, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x6E, 0x54,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xDF, 0x00, 0x00, 0x03, 0xFA, 0xBF, 0xE0,
-    0x00, 0x00, 0xB8, 0x02, 0xFD, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xC0, 0x01, 0xF8,
-    0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xFE,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFB,
-    0xC0, 0x00, 0x00, 0x0B, 0xF9, 0x28, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xE4, 0x05, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF5, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0A, 0x95, 0x0B, 0xF0, 0x01, 0x50, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x10, 0x00,
-    0x00, 0x00, 0x2F, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF8,
-    0x64, 0x00, 0x00, 0x04, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0x93, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x94, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFE, 0x40, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xEA, 0xFC, 0x00, 0x03, 0xFF, 0xD2, 0xD0, 0x01, 0x00,
-    0x03, 0xFF, 0x40, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x1E,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x2E, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x0B, 0xE5, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x78, 0x1B, 0xFF, 0x03, 0xFC, 0x00, 0x2D, 0x00, 0xF9,
-    0x40, 0xFF, 0x40, 0x0F, 0x00, 0xBD, 0x00, 0x3F, 0xF0, 0x03, 0xC0, 0x3F, 0x40, 0x0F, 0xFF, 0xA5,
-    0xF6, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xEA, 0xAF,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0x54, 0x02, 0xFD, 0x78, 0x00, 0x1F, 0xD2, 0xD0, 0x00, 0xBE, 0x0F, 0x00, 0x03, 0xF0, 0x3C,
-    0x00, 0x1F, 0x81, 0xE0, 0x00, 0xBD, 0x0B, 0x40, 0x03, 0xF4, 0x3C, 0x00, 0x0F, 0xD0, 0xE0, 0x00,
-    0x3F, 0xCB, 0x40, 0x00, 0xBF, 0xFE, 0xA0, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA,
-    0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x05, 0x5F, 0xD0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x60, 0x00, 0x07, 0xD6, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x10, 0x03, 0x9B, 0xC1, 0xB8, 0x00, 0x03, 0xFB, 0xFC,
-    0x00, 0x01, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xD3, 0xEF, 0xC0,
-    0x03, 0xE0, 0x47, 0xE0, 0x0B, 0xF0, 0x02, 0xF0, 0x1F, 0xF0, 0x00, 0xFD, 0xBF, 0xD0, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xEE, 0x2F, 0xC0, 0x00, 0x2F, 0xCB, 0x43, 0xF0,
-    0x00, 0x0F, 0xC3, 0xC0, 0xFC, 0x00, 0x0B, 0xD0, 0xF0, 0x2E, 0x00, 0x03, 0xF0, 0x78, 0x0F, 0x40,
-    0x00, 0xF4, 0x2D, 0x03, 0xD0, 0x00, 0x7C, 0x0F, 0x40, 0xF0, 0x00, 0x2E, 0x03, 0xC0, 0xB8, 0x00,
-    0x0F, 0x41, 0xF0, 0x3D, 0x00, 0x03, 0xC0, 0xB8, 0x0F, 0x00, 0x01, 0xF0, 0x2D, 0x07, 0xC0, 0x00,
-    0xBC, 0x0F, 0x02, 0xE0, 0x00, 0x3E, 0x03, 0xC0, 0xF4, 0x00, 0x0F, 0x81, 0xE0, 0x7C, 0x00, 0x03,
-    0xD0, 0xB4, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xEA, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x1B, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-    0xAA, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE0, 0x3D, 0x00,
-    0x6F, 0xFE, 0x0B, 0x86, 0xFF, 0xF9, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0xB8, 0xFD, 0x00, 0x1F, 0x83, 0xD0, 0xFC,
-    0x02, 0xF4, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x7C, 0x01, 0xF0, 0x60, 0x02, 0xE0, 0x01, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0xBE, 0x40, 0x00, 0xF0, 0x0B, 0xFF, 0x90, 0x07, 0xC0, 0x06, 0xFF, 0xF9, 0x2E, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x14, 0x00, 0xF4, 0x00,
-    0x40, 0xF8, 0x02, 0xE0, 0x0B, 0x80, 0xFD, 0x07, 0xC0, 0x7F, 0x00, 0xBE, 0x0F, 0x07, 0xF0, 0x00,
-    0x7F, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x18, 0x40,
-    0x00, 0x3C, 0x00, 0x0B, 0x00, 0x1B, 0xF7, 0xF9, 0x00, 0x78, 0x00, 0x74, 0x6F, 0xFE, 0x46, 0xFF,
-    0xE4, 0xB4, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFF, 0xC0,
-    0x01, 0xF6, 0xCB, 0xC0, 0x2F, 0x0F, 0x0F, 0xC3, 0xE0, 0x38, 0x0F, 0x9D, 0x01, 0xD0, 0x08, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x1E, 0x01, 0xE0, 0x2D, 0x1F, 0x43, 0xC1, 0xF4, 0x0F,
-    0x8F, 0x1F, 0x40, 0x0B, 0xEE, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x16, 0xE0, 0x00, 0x1A, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x50, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0x7F, 0xC0, 0x00, 0x07, 0xC2, 0xFE, 0x00, 0x01,
-    0xF0, 0x0B, 0xF4, 0x00, 0x7C, 0x00, 0x7F, 0xD0, 0x1F, 0x00, 0x01, 0xFF, 0x03, 0xC0, 0x00, 0x0B,
-    0xF4, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE5, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x01, 0xFE, 0xBC, 0x00, 0x01, 0xFF, 0x47, 0xC0, 0x00, 0xBF, 0x40, 0x7C, 0x00, 0xBF,
-    0x80, 0x0B, 0xC0, 0x7F, 0xC0, 0x00, 0xBC, 0x3F, 0xD0, 0x00, 0x0B, 0xC0, 0xE0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x3D, 0x00, 0x3C, 0x02, 0xF0, 0x07, 0x80, 0x0F, 0x40,
-    0xB4, 0x00, 0xBC, 0x0F, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x2F, 0x1E, 0x00, 0x00, 0xF6, 0xD0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0xEB, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x05, 0xBF, 0xF0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x74, 0x00, 0x7C, 0x07, 0x80, 0x0F, 0x80, 0x3C, 0x01, 0xF0, 0x03, 0xC0, 0x3E, 0x00,
-    0x2D, 0x07, 0xC0, 0x01, 0xE0, 0xF8, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0xF3, 0xE0, 0x00, 0x0B, 0xBC,
-    0x00, 0x00, 0x7F, 0x80, 0x04, 0x03, 0xFA, 0xBF, 0xC0, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xA5, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55, 0x55, 0x50, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xF5, 0x55, 0x55, 0x54,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x0D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x7F,
-    0x41, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xBE, 0xF0, 0x3D, 0xF4, 0x00, 0x0F,
-    0xE3, 0x80, 0xE2, 0xF4, 0x00, 0xFD, 0x1D, 0x07, 0x43, 0xF0, 0x1F, 0xC0, 0xB0, 0x2C, 0x07, 0xF1,
-    0xF8, 0x03, 0xC0, 0xF0, 0x0B, 0xC3, 0x40, 0x0D, 0x07, 0x80, 0x08, 0x00, 0x00, 0x70, 0x2D, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x34, 0x1D,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x38,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x74, 0x00, 0x00, 0x00, 0x07, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x55, 0x55, 0x55, 0x57,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x55, 0x55, 0x56,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x34, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x74,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x01, 0x40, 0x0B, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x1C,
-    0x0B, 0x00, 0x3C, 0x1F, 0xC0, 0x34, 0x1D, 0x02, 0xF8, 0x0F, 0xD0, 0xE0, 0x3C, 0x0F, 0xC0, 0x0F,
-    0xE2, 0xC0, 0xF0, 0xFC, 0x00, 0x0B, 0xE7, 0x02, 0xDB, 0xD0, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x70,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xD5, 0x55, 0x55,
-    0x7F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xF6, 0xFE, 0x40, 0x00, 0x3E, 0x1E, 0xFF, 0x90, 0x0F, 0xC1,
-    0xC2, 0xFD, 0x03, 0xF8, 0x1C, 0x03, 0x40, 0xFF, 0x81, 0xC0, 0x00, 0x3F, 0xA8, 0x1C, 0x00, 0x07,
-    0xE2, 0x81, 0xC0, 0x00, 0x04, 0x28, 0x1C, 0x00, 0x00, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x28, 0x1C,
-    0x00, 0x00, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x28, 0x1C, 0x00, 0x00, 0x02, 0x81, 0xC0, 0x00, 0x00,
-    0x28, 0x1C, 0x00, 0x00, 0x42, 0x81, 0xC0, 0x00, 0x7E, 0x28, 0x1C, 0x00, 0x03, 0xFA, 0x81, 0xC0,
-    0x00, 0x0F, 0xF8, 0x1C, 0x00, 0x00, 0x3F, 0x81, 0xC0, 0x34, 0x00, 0xFC, 0x1C, 0x2F, 0xD0, 0x03,
-    0xE1, 0xEF, 0xF9, 0x00, 0x0F, 0x6F, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x3C, 0x00, 0x07, 0xFF, 0xFD, 0x2E, 0x00, 0x07,
-    0xF8, 0x0B, 0xCF, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x01, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xBD, 0x00, 0x03, 0xF8, 0x01, 0xBE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x80, 0x3C, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xF5,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBC, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x01, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xE0, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x0B, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF2,
-    0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x90,
-    0x16, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0x87, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xE0, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x1F, 0xE0, 0x00, 0x07,
-    0xF8, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0x40,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x01, 0xF8, 0x00,
-    0x01, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00,
-    0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x01, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x06, 0x90, 0x00, 0x00, 0xBF, 0xFD,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x0F, 0xE4, 0x1F, 0x7F, 0x80, 0xF0,
-    0x02, 0xF4, 0x00, 0x3F, 0xC0, 0x07, 0x40, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x34, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x07, 0x40, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0xB0, 0x0F, 0x00, 0x00, 0x7D, 0x00, 0x1E,
-    0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x0F, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0xBF, 0xE0,
-    0x00, 0x00, 0x6A, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x09, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00,
-    0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3D, 0x01,
-    0xFC, 0x2F, 0x00, 0x7C, 0x03, 0xF0, 0x0F, 0x81, 0xF4, 0x0B, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x01, 0x40, 0x0F, 0xEB, 0xD0, 0x07, 0xD0, 0x3F, 0x00, 0xF4, 0x0F, 0x80, 0xBD, 0x00, 0x7F, 0xFF,
-    0x00, 0x58, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xD5, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xA5, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x56, 0xAF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x5A, 0x80, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFE, 0x40, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xC0,
-    0x00, 0x16, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xA5, 0x40, 0x00, 0x02, 0xA5, 0x40,
-    0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_italicBitmaps[40696] = {
+    0xAD, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0xFE, 0xD6, 0xAB, 0x64, 0x25, 0x2C, 0xC5, 0x34, 0x48,
+    0x11, 0x88, 0xF8, 0x0F, 0x10, 0xDC, 0x50, 0x5C, 0xF1, 0xF2, 0x6C, 0x71, 0x3F, 0xE8, 0x9A, 0x14,
+    0x20, 0xE5, 0x62, 0x2B, 0xF9, 0x01, 0x5C, 0x01, 0x3D, 0x25, 0x3C, 0x8A, 0x50, 0x5C, 0x91, 0xE2,
+    0x2E, 0x76, 0x68, 0x52, 0x50, 0xE0, 0x54, 0x74, 0x9C, 0xA5, 0x50, 0xA5, 0xC1, 0x85, 0x11, 0x8E,
+    0xF0, 0xF3, 0x32, 0xDF, 0xAC, 0xDF, 0xCB, 0x1D, 0x1C, 0x54, 0xAC, 0xE4, 0x5D, 0x7B, 0xBD, 0x33,
+    0xF3, 0xCD, 0xCC, 0x37, 0xB3, 0x80, 0x39, 0x01, 0xEE, 0x01, 0x71, 0x03, 0x4C, 0x40, 0x52, 0x20,
+    0xEA, 0x81, 0x1C, 0xB0, 0x1D, 0x70, 0x2E, 0x1B, 0x0D, 0x8C, 0xEC, 0x67, 0x15, 0xEC, 0x00, 0x94,
+    0x72, 0x50, 0x7E, 0xCF, 0x40, 0xDA, 0x22, 0x92, 0xFD, 0xBC, 0x82, 0x93, 0xFD, 0x23, 0xEC, 0x46,
+    0xDE, 0x20, 0x1E, 0x01, 0x5F, 0x21, 0x1B, 0x60, 0x7D, 0x81, 0x5A, 0xCE, 0xD7, 0xAD, 0x7F, 0xEE,
+    0x3F, 0xF5, 0x76, 0x1B, 0x4F, 0xC9, 0x98, 0xF6, 0x59, 0x9B, 0x37, 0x65, 0xE3, 0x0B, 0x1F, 0xCD,
+    0x76, 0xEB, 0xA6, 0x45, 0xD2, 0x35, 0xB4, 0x2C, 0x86, 0x7B, 0x8C, 0xBA, 0x31, 0xE0, 0x81, 0xAE,
+    0x67, 0x84, 0x43, 0xD5, 0x48, 0x2A, 0xAE, 0x69, 0x41, 0xB0, 0x84, 0x66, 0x29, 0xE0, 0x75, 0x4C,
+    0xA8, 0x75, 0xDD, 0xE2, 0xFD, 0xCD, 0xBC, 0xA9, 0x37, 0xDF, 0xCA, 0x9F, 0x67, 0xC8, 0x8A, 0x45,
+    0x50, 0x05, 0xD2, 0x26, 0xEE, 0x54, 0xB0, 0x55, 0x41, 0xB8, 0xDE, 0xA8, 0x71, 0x3B, 0x62, 0xCB,
+    0xED, 0xA0, 0xA9, 0x8A, 0xC3, 0xDA, 0x44, 0x9B, 0xFA, 0xF5, 0x93, 0xD7, 0x9B, 0x13, 0x0A, 0x3A,
+    0x15, 0x48, 0x7A, 0xAB, 0xD0, 0x5C, 0x10, 0x60, 0x04, 0x6A, 0x85, 0xE6, 0x19, 0x08, 0x19, 0xEF,
+    0x15, 0x37, 0x8A, 0xC5, 0x1D, 0xFB, 0xA8, 0xE5, 0xF2, 0x74, 0xC5, 0x39, 0x3E, 0x24, 0x00, 0xE3,
+    0xFD, 0xA8, 0xB3, 0x6F, 0x14, 0xB6, 0x7C, 0xE4, 0xFE, 0xC9, 0xCD, 0x02, 0xB1, 0x7F, 0xAE, 0x9E,
+    0xAC, 0xEE, 0xC8, 0x9C, 0xBD, 0xA0, 0xA4, 0x1D, 0x4F, 0x29, 0x99, 0xFF, 0x44, 0x49, 0xEB, 0x87,
+    0xCF, 0x88, 0x5F, 0xC0, 0xC9, 0x22, 0x8E, 0xB6, 0x61, 0x91, 0x2F, 0xFB, 0xB3, 0xF7, 0xF2, 0xB1,
+    0xCA, 0xA8, 0xCD, 0x3D, 0xBE, 0xA0, 0xEA, 0xD3, 0x95, 0x67, 0x2A, 0x0F, 0x7F, 0xF3, 0x4D, 0xFC,
+    0xD5, 0xEF, 0xB5, 0x1F, 0x2C, 0xFD, 0x99, 0x43, 0xA4, 0xAA, 0x9C, 0x73, 0xAB, 0x4E, 0x76, 0xB8,
+    0x29, 0x33, 0x11, 0xBB, 0x80, 0x56, 0x6D, 0x22, 0xB1, 0x0D, 0xAE, 0x19, 0xF7, 0x39, 0x99, 0x0E,
+    0xE2, 0xA2, 0x1C, 0x90, 0xBC, 0x26, 0xB0, 0xED, 0x7D, 0xAC, 0x10, 0xE3, 0x40, 0x92, 0x75, 0x0B,
+    0x07, 0x51, 0x8B, 0x0F, 0x71, 0x10, 0x57, 0xF8, 0x08, 0xDF, 0x8B, 0x2B, 0x77, 0x4D, 0xFF, 0x80,
+    0xA8, 0xE9, 0x5C, 0xEC, 0xA9, 0xD4, 0x7C, 0x99, 0xCC, 0x9A, 0x91, 0xEF, 0x68, 0xE1, 0xCC, 0xC8,
+    0x1C, 0x0D, 0xA6, 0x25, 0xAB, 0xF8, 0x9E, 0xF6, 0x3C, 0x74, 0xDC, 0x3B, 0x71, 0x6C, 0x9C, 0x6B,
+    0x92, 0xB0, 0xA6, 0x27, 0x4D, 0xDA, 0x61, 0x21, 0xC1, 0xD5, 0xF1, 0x01, 0xC1, 0x1B, 0x3A, 0x02,
+    0xF7, 0x26, 0x1A, 0x94, 0xAE, 0x12, 0x87, 0xB4, 0x32, 0x32, 0x67, 0x05, 0x29, 0x9B, 0x55, 0x14,
+    0x4E, 0xDA, 0x5A, 0x74, 0xBA, 0x3F, 0x99, 0xB6, 0x88, 0xC7, 0xE1, 0xD4, 0xEF, 0x4C, 0x23, 0xEA,
+    0x2F, 0x3A, 0x06, 0x59, 0x8E, 0x7F, 0x23, 0x74, 0x9C, 0xCC, 0x94, 0x0C, 0x28, 0xDD, 0x98, 0xF5,
+    0x48, 0x2F, 0x7A, 0x99, 0x63, 0xDF, 0xE4, 0x3D, 0xD9, 0x9C, 0x6D, 0x71, 0x34, 0x33, 0x0F, 0x12,
+    0x74, 0xD2, 0xE5, 0x8B, 0x22, 0x92, 0x34, 0xDE, 0x10, 0x3D, 0xF3, 0x2E, 0xEF, 0x28, 0x5F, 0xFA,
+    0xC3, 0x39, 0x19, 0xB3, 0x4E, 0x28, 0x6E, 0xB7, 0x7B, 0xA8, 0xE4, 0x2E, 0x79, 0xEB, 0xC4, 0x5B,
+    0xD7, 0x29, 0xCD, 0xB5, 0xD4, 0x8C, 0x60, 0x54, 0xC2, 0x9F, 0xC9, 0x73, 0x8C, 0xE0, 0x67, 0x5A,
+    0xA8, 0x2B, 0x7A, 0x58, 0xB9, 0xBA, 0x3B, 0x90, 0x2F, 0x9A, 0xF8, 0x43, 0xCB, 0x85, 0x04, 0x5E,
+    0x5F, 0xDA, 0x54, 0x75, 0x54, 0x93, 0x21, 0xD8, 0x63, 0x54, 0x58, 0xC8, 0xAA, 0x53, 0x4F, 0x50,
+    0x57, 0x89, 0x60, 0x40, 0x95, 0x13, 0x64, 0x56, 0x05, 0x98, 0xEB, 0xE5, 0x64, 0xDC, 0x5C, 0xB2,
+    0xBC, 0xD3, 0x77, 0x2D, 0xA4, 0xF5, 0xEE, 0x67, 0x15, 0x0E, 0xC4, 0x6D, 0x68, 0x1E, 0xFF, 0x70,
+    0x70, 0x5A, 0x9E, 0xB3, 0x4B, 0xCF, 0xF9, 0xDF, 0x9E, 0xB3, 0x4B, 0xE7, 0xE4, 0x31, 0xCB, 0x13,
+    0x89, 0x3C, 0x93, 0xC9, 0xBC, 0x89, 0x99, 0xBB, 0x30, 0x45, 0x7F, 0x2B, 0x7D, 0xFC, 0xC3, 0x50,
+    0xFE, 0x72, 0xAE, 0x24, 0x90, 0xAE, 0x14, 0x49, 0xED, 0x3F, 0xFB, 0xDC, 0x27, 0x2F, 0xDB, 0xA7,
+    0xB7, 0x63, 0x14, 0x20, 0x95, 0xB5, 0xDC, 0x29, 0x2B, 0x98, 0x52, 0x56, 0xE3, 0xF2, 0x5A, 0x38,
+    0x49, 0x5E, 0xC6, 0x0A, 0x94, 0x86, 0xC7, 0x36, 0x43, 0xA0, 0x74, 0x40, 0x3A, 0x21, 0xBE, 0x0E,
+    0xF9, 0x9A, 0x8C, 0x2F, 0xF2, 0xDE, 0x4E, 0x28, 0xAB, 0xA4, 0x8F, 0x66, 0x94, 0xA4, 0xAC, 0x14,
+    0xCF, 0x1F, 0xD2, 0x64, 0xA4, 0xF6, 0x1A, 0xD7, 0xCD, 0xE9, 0xAB, 0x6D, 0xD9, 0x86, 0xB8, 0x99,
+    0x90, 0xFF, 0xA5, 0x72, 0x6C, 0xD8, 0x35, 0x3D, 0x96, 0x4E, 0xB6, 0x34, 0x32, 0x1D, 0xF7, 0xC2,
+    0xF2, 0x71, 0x58, 0xD2, 0xB7, 0xF4, 0xD0, 0x26, 0x18, 0xE4, 0x15, 0x78, 0xC8, 0xF0, 0xBF, 0xC9,
+    0x2F, 0xF5, 0x90, 0x06, 0xC3, 0xA1, 0xC3, 0x21, 0xBE, 0x56, 0x3E, 0xF4, 0x53, 0x2C, 0x9D, 0xF6,
+    0xF8, 0xBF, 0xE4, 0x03, 0xF0, 0xD0, 0x1F, 0x77, 0x8B, 0xB9, 0x2A, 0xFF, 0xF0, 0x8A, 0x7C, 0x76,
+    0x9D, 0xBC, 0x5B, 0xE4, 0x03, 0x70, 0x33, 0x5D, 0x91, 0x5F, 0xDC, 0xF8, 0x24, 0x2C, 0xEF, 0xEE,
+    0x2B, 0x24, 0x65, 0x07, 0xFB, 0xF5, 0x98, 0x00, 0x57, 0xA4, 0xD9, 0xA9, 0x50, 0x2B, 0xEA, 0xC4,
+    0x87, 0xB8, 0x4A, 0xAA, 0x6A, 0x8D, 0xF3, 0xA4, 0x1A, 0x6D, 0xBF, 0xB6, 0x6D, 0xFA, 0x68, 0xC8,
+    0x70, 0x1E, 0x37, 0x93, 0xED, 0xEF, 0xB8, 0x4E, 0x2C, 0xE7, 0x45, 0x29, 0x46, 0xC4, 0x4C, 0xD2,
+    0xC9, 0xE5, 0x23, 0x65, 0xFA, 0xE6, 0x48, 0xD2, 0xC6, 0x36, 0xCB, 0x0B, 0xC1, 0xB2, 0x3F, 0x58,
+    0x79, 0x11, 0x8A, 0x84, 0x28, 0x17, 0xEC, 0xDC, 0x56, 0x7E, 0x3F, 0x1C, 0xF1, 0x4E, 0xBA, 0xBF,
+    0xF2, 0xDC, 0xFE, 0xCA, 0xC3, 0xDB, 0x2B, 0x2F, 0x0F, 0xDE, 0xCC, 0xBB, 0xAB, 0x50, 0x58, 0xF3,
+    0x4A, 0xB4, 0x8A, 0xF6, 0x1F, 0x43, 0x3B, 0x0F, 0x1D, 0x48, 0xAF, 0x8F, 0x16, 0xE9, 0x49, 0xDA,
+    0xE3, 0x76, 0x08, 0x9C, 0x46, 0xDF, 0xEE, 0xA7, 0x84, 0x39, 0xC9, 0x18, 0x26, 0xB6, 0xA2, 0x88,
+    0x5D, 0x3B, 0x65, 0x44, 0x6A, 0xED, 0x8E, 0xB2, 0x55, 0x2A, 0xC2, 0x81, 0x5F, 0x8D, 0xAA, 0x53,
+    0x63, 0x13, 0x39, 0x37, 0xD2, 0x9B, 0x01, 0xFF, 0xFF, 0xF8, 0x0B, 0xA5, 0x55, 0xBD, 0xCE, 0xDC,
+    0x54, 0x10, 0x1D, 0xAF, 0xC9, 0x5A, 0x8A, 0x8B, 0x4B, 0x0D, 0xC5, 0x6D, 0x23, 0x81, 0xE4, 0x14,
+    0xB4, 0xC8, 0x97, 0x17, 0x40, 0x20, 0x65, 0x53, 0xC0, 0x23, 0x50, 0x7C, 0x94, 0x14, 0x41, 0x76,
+    0x47, 0x9B, 0x26, 0x15, 0x0D, 0x6F, 0x00, 0x05, 0x05, 0x48, 0x1F, 0xDF, 0xBD, 0x8F, 0x60, 0x29,
+    0x05, 0x05, 0x8D, 0xA5, 0x80, 0x04, 0xA4, 0xB1, 0x90, 0x91, 0xFC, 0x05, 0xDB, 0xC3, 0x39, 0x63,
+    0x6F, 0xC8, 0x0A, 0x3A, 0xAC, 0xDD, 0xBB, 0xFE, 0xB9, 0x9E, 0x39, 0x73, 0xCE, 0x99, 0x59, 0xC9,
+    0xBE, 0xBE, 0x15, 0xC9, 0x55, 0x93, 0xDC, 0x0D, 0xC5, 0x20, 0x38, 0x6C, 0x19, 0xCF, 0x67, 0x07,
+    0x2E, 0x45, 0x12, 0x39, 0xC5, 0x80, 0x7D, 0x13, 0x2E, 0xF4, 0x67, 0xDC, 0xCA, 0x56, 0xEE, 0xA8,
+    0x2F, 0x97, 0x86, 0x0F, 0x16, 0x39, 0x3E, 0xB9, 0x9A, 0xC5, 0xA9, 0x8E, 0x52, 0xA9, 0x76, 0x52,
+    0xAB, 0x06, 0x39, 0xEA, 0x57, 0x72, 0x3E, 0x3E, 0xC3, 0x2E, 0x24, 0x60, 0x3A, 0x8F, 0x6F, 0x33,
+    0x48, 0xF6, 0xA2, 0x97, 0xE2, 0x59, 0x27, 0xFE, 0x8B, 0x4E, 0x9A, 0x32, 0x65, 0xB3, 0x4B, 0xC5,
+    0xE0, 0x5B, 0x9F, 0xAA, 0xB6, 0xF9, 0x3D, 0x2E, 0x51, 0x75, 0xE6, 0x57, 0x44, 0xB7, 0xCC, 0x87,
+    0x05, 0xA0, 0xE7, 0xED, 0x5B, 0xCE, 0x7B, 0x58, 0xCF, 0x2A, 0xB0, 0x4D, 0xF2, 0x0E, 0x57, 0x8E,
+    0xB7, 0x1E, 0xB1, 0x82, 0x9E, 0x57, 0xE1, 0x7C, 0xF5, 0x27, 0xCE, 0x9C, 0xE2, 0x7D, 0xC0, 0x12,
+    0xF9, 0x40, 0x6E, 0xB8, 0x8F, 0x21, 0x72, 0x56, 0xEA, 0x51, 0xA9, 0xAC, 0xF2, 0x3A, 0x81, 0x2D,
+    0x1F, 0x6B, 0x2A, 0x98, 0xB5, 0x62, 0x60, 0x45, 0xED, 0x59, 0x7C, 0x61, 0x99, 0x8E, 0x0A, 0xC8,
+    0xBC, 0x59, 0xFD, 0x72, 0x92, 0x1C, 0x9C, 0x48, 0x15, 0xB6, 0x9A, 0xC4, 0xA5, 0x3D, 0x51, 0xFE,
+    0x87, 0xF6, 0x84, 0x34, 0x48, 0x1C, 0x7D, 0x9F, 0xAF, 0x78, 0xE2, 0x7A, 0xD0, 0x04, 0x8E, 0xE6,
+    0x6C, 0x42, 0xB6, 0x12, 0xE5, 0xB6, 0xBE, 0x45, 0xEE, 0x26, 0x54, 0x3D, 0xE2, 0xAB, 0x1C, 0xB8,
+    0x3D, 0x57, 0x16, 0xA8, 0xED, 0x56, 0x14, 0x6E, 0xFF, 0xC8, 0x47, 0x72, 0x07, 0x69, 0xCA, 0x64,
+    0x44, 0x1F, 0xC6, 0x0D, 0xE8, 0xBA, 0x71, 0x58, 0xB7, 0x92, 0xA1, 0x00, 0x87, 0x53, 0x6A, 0x84,
+    0x53, 0x84, 0x23, 0x53, 0x0E, 0xAF, 0x34, 0x1D, 0x02, 0x62, 0x3B, 0x5E, 0x51, 0x42, 0x93, 0xBB,
+    0x2B, 0xA0, 0xC6, 0x2F, 0x7B, 0x2A, 0x3B, 0x52, 0xD9, 0x6B, 0x71, 0x2D, 0x97, 0x20, 0x93, 0xF8,
+    0x80, 0xD8, 0xAE, 0x45, 0x54, 0xD7, 0x5D, 0x25, 0x48, 0x4D, 0xBE, 0xA1, 0xA3, 0x54, 0x7F, 0x21,
+    0x99, 0x86, 0xBA, 0x45, 0xB5, 0x3E, 0xF1, 0x79, 0x72, 0x1D, 0x16, 0xC0, 0xA8, 0x92, 0x87, 0x68,
+    0xAD, 0x1F, 0x8F, 0x4A, 0xD1, 0x67, 0xBA, 0x09, 0xF9, 0xAF, 0x8C, 0xAA, 0xB7, 0x88, 0x9A, 0x6C,
+    0x2F, 0x80, 0xE8, 0x12, 0xA2, 0x5F, 0x4B, 0xD1, 0x43, 0xA0, 0xAA, 0xAD, 0x04, 0xDC, 0x4F, 0x28,
+    0x26, 0xEF, 0x91, 0x0D, 0xBC, 0x45, 0x54, 0x02, 0x31, 0x23, 0x5F, 0x8F, 0xF4, 0x4C, 0x73, 0x6B,
+    0xBA, 0xF4, 0x67, 0x7E, 0x67, 0xEA, 0xD2, 0x65, 0xA4, 0xA3, 0x24, 0x53, 0xA6, 0x60, 0xD4, 0xC7,
+    0xA4, 0xBD, 0x87, 0xEF, 0xEA, 0xAE, 0x98, 0x51, 0xE5, 0x9D, 0x07, 0xF2, 0xAF, 0x23, 0x82, 0x9E,
+    0x4C, 0xA5, 0x1E, 0x0A, 0xF3, 0xAD, 0x1C, 0x66, 0x12, 0x55, 0x4E, 0xE4, 0xA8, 0x1A, 0xE5, 0x3F,
+    0x0F, 0x4D, 0x99, 0x06, 0x90, 0x87, 0x8D, 0xC5, 0x44, 0x7A, 0x41, 0x6B, 0x93, 0x2E, 0xB6, 0x7C,
+    0x67, 0xB1, 0x79, 0x2F, 0x32, 0x48, 0x9C, 0x2E, 0x97, 0x85, 0x8D, 0xC1, 0x85, 0x12, 0xA0, 0x08,
+    0x83, 0x1A, 0x15, 0x1D, 0x27, 0x6F, 0x2A, 0x2F, 0x8E, 0x74, 0x15, 0xB8, 0x32, 0x69, 0x4A, 0xEE,
+    0x94, 0x0C, 0x7D, 0x92, 0x3D, 0x80, 0x13, 0xE6, 0xD2, 0x1C, 0x7F, 0x71, 0x84, 0x37, 0xE0, 0x3A,
+    0x94, 0xDD, 0x9D, 0x78, 0xF5, 0x9A, 0xBC, 0x6C, 0xD5, 0xAD, 0x06, 0x03, 0x61, 0x7A, 0x5D, 0xAC,
+    0x87, 0x7D, 0x25, 0x91, 0xC5, 0xB2, 0xE7, 0xCB, 0x22, 0xEE, 0x12, 0x45, 0x66, 0x80, 0x2A, 0x76,
+    0x75, 0x4E, 0x6F, 0xC8, 0x3B, 0xAF, 0x24, 0x24, 0x97, 0x25, 0x60, 0xC0, 0x09, 0x43, 0xB6, 0xBE,
+    0x17, 0x93, 0x23, 0x75, 0xE0, 0x9B, 0x2D, 0xB6, 0xEC, 0x7E, 0xA7, 0xFB, 0x20, 0xE8, 0xE6, 0x46,
+    0xBA, 0x12, 0x9E, 0xC0, 0x6B, 0xB8, 0xC8, 0x17, 0xE6, 0x0D, 0xF8, 0xE2, 0x46, 0x44, 0x7E, 0x47,
+    0x24, 0x24, 0xC3, 0xF7, 0x5B, 0x17, 0x4B, 0x9D, 0xB6, 0x36, 0x86, 0xB6, 0xAF, 0x1C, 0xE5, 0x39,
+    0x7E, 0xD5, 0xED, 0x8F, 0xE3, 0x25, 0xF3, 0x80, 0x6E, 0x1D, 0xD2, 0xB0, 0x5B, 0x30, 0x13, 0x42,
+    0xC1, 0x80, 0x20, 0xF3, 0xDD, 0xAD, 0x93, 0xF3, 0xB4, 0x35, 0xF4, 0x37, 0xF8, 0x69, 0xEE, 0xCB,
+    0xDB, 0xF8, 0xF9, 0xFE, 0x5A, 0x4A, 0x34, 0xE9, 0xA7, 0x28, 0x21, 0xC9, 0x7C, 0x3F, 0x6F, 0x31,
+    0xE0, 0x6E, 0xEE, 0x65, 0x9D, 0x7C, 0x2B, 0xF5, 0xFB, 0xA0, 0xF1, 0x91, 0xB8, 0xA7, 0xCF, 0x67,
+    0xF9, 0x5C, 0x8A, 0x31, 0xAA, 0xFC, 0x80, 0xA0, 0xE5, 0xB3, 0x9F, 0x80, 0x01, 0x9A, 0xB3, 0xC7,
+    0xFD, 0x64, 0x79, 0xF3, 0xBD, 0x33, 0xE3, 0xFA, 0xE1, 0x27, 0x36, 0x4A, 0x38, 0xE2, 0xAC, 0x4F,
+    0x59, 0x1A, 0x78, 0x5A, 0x36, 0x74, 0xBF, 0x5D, 0xC2, 0x35, 0xDB, 0x95, 0x16, 0xA2, 0x1E, 0x2C,
+    0x0C, 0xEB, 0xF1, 0xD1, 0xA6, 0x8F, 0x31, 0xFA, 0x94, 0xEF, 0x37, 0x24, 0x36, 0x1F, 0xEA, 0x40,
+    0x42, 0x6F, 0x48, 0x2D, 0x6B, 0x72, 0x1D, 0xC9, 0x8C, 0xA4, 0x15, 0x14, 0x37, 0x6C, 0x79, 0x70,
+    0x0E, 0x21, 0x8A, 0x91, 0x4A, 0xE0, 0x83, 0xF4, 0xDA, 0xC2, 0x30, 0x60, 0x03, 0xF6, 0xD0, 0x29,
+    0xE7, 0x8D, 0x81, 0x24, 0xD7, 0x89, 0x74, 0x2B, 0x53, 0xE7, 0x33, 0xED, 0x8B, 0x51, 0x90, 0x9D,
+    0x4E, 0x81, 0xD4, 0xA1, 0x94, 0xD2, 0x86, 0xCB, 0x62, 0x91, 0x12, 0x5A, 0x9F, 0x5A, 0x4E, 0x14,
+    0xD3, 0x07, 0xF0, 0x87, 0x4F, 0xCD, 0x89, 0xCE, 0x5D, 0x81, 0x49, 0x5A, 0x2B, 0x38, 0x30, 0xFB,
+    0xC2, 0x5D, 0x6E, 0xC8, 0x47, 0xCE, 0xFD, 0x9A, 0xE2, 0x53, 0x7E, 0xE5, 0x40, 0xF5, 0x3D, 0x20,
+    0x41, 0xFB, 0x99, 0xC2, 0x7B, 0xE2, 0x39, 0x10, 0x8F, 0x41, 0xEB, 0x0A, 0xA3, 0xCA, 0xBA, 0xFC,
+    0x42, 0xCE, 0xC7, 0xB4, 0xEB, 0xF6, 0x07, 0x43, 0xDF, 0x97, 0xFA, 0xE4, 0x23, 0x54, 0x6E, 0xBC,
+    0xB9, 0xF9, 0x9F, 0x75, 0xE3, 0xB0, 0xB0, 0x73, 0x33, 0xC6, 0xFE, 0x57, 0x64, 0xAE, 0x02, 0x14,
+    0x53, 0x87, 0xAE, 0xD9, 0xCD, 0x06, 0x53, 0xDB, 0xA6, 0x6D, 0xFA, 0x35, 0x33, 0x8D, 0xE6, 0xF5,
+    0xF6, 0xA1, 0x79, 0x9A, 0xE6, 0x51, 0xAB, 0x0D, 0x33, 0x1E, 0x3B, 0x48, 0xDB, 0x60, 0xCC, 0x4C,
+    0x34, 0xAE, 0xFE, 0xFA, 0x12, 0x1F, 0xA6, 0xF2, 0x06, 0x90, 0xF2, 0x6F, 0xFF, 0x45, 0xB5, 0xBD,
+    0x82, 0x09, 0xD8, 0x4C, 0x34, 0xFB, 0x41, 0xCD, 0x26, 0x18, 0x12, 0xDB, 0x9F, 0x53, 0x63, 0x98,
+    0xD8, 0x09, 0x35, 0x27, 0xFF, 0x4E, 0x55, 0x3E, 0x5B, 0xB7, 0xA8, 0x50, 0xF9, 0x26, 0x61, 0x76,
+    0xE3, 0x0D, 0x8A, 0xEE, 0x46, 0xD2, 0xE7, 0x66, 0xB6, 0x97, 0x5F, 0x65, 0x3D, 0x3D, 0xDC, 0x09,
+    0xD3, 0xE0, 0x4D, 0x5D, 0x67, 0xAB, 0x09, 0x1B, 0x88, 0x63, 0x21, 0x0E, 0x82, 0xFA, 0x3F, 0xC7,
+    0xDF, 0x7D, 0x55, 0x3B, 0x8E, 0xDC, 0x46, 0x14, 0x7C, 0x1C, 0xC2, 0xCB, 0x80, 0x41, 0x67, 0x0E,
+    0xAC, 0x80, 0xB9, 0x13, 0x1E, 0x81, 0x84, 0x74, 0x01, 0x25, 0xAB, 0x40, 0x97, 0xD8, 0x23, 0x70,
+    0x60, 0x87, 0x4E, 0x9C, 0x38, 0xDF, 0x44, 0x80, 0x34, 0x3A, 0x83, 0xD5, 0x03, 0xEB, 0x00, 0x26,
+    0xE0, 0x40, 0xA1, 0x08, 0xDB, 0x91, 0x9D, 0xD0, 0x30, 0x0D, 0x50, 0x02, 0xC9, 0xA7, 0xAA, 0x6A,
+    0xCE, 0xAC, 0xA0, 0xC0, 0x83, 0xD9, 0xE6, 0xEC, 0xEB, 0xEE, 0xF7, 0xA9, 0xAA, 0xF7, 0x68, 0x66,
+    0xF6, 0xD5, 0x53, 0x2B, 0xDD, 0xFD, 0x6C, 0x8D, 0xFB, 0x6A, 0x86, 0x9F, 0x83, 0x15, 0x13, 0x36,
+    0xAC, 0x69, 0xB9, 0x2E, 0x5C, 0x8A, 0x91, 0x6B, 0x7D, 0xE4, 0xBA, 0xCA, 0xF0, 0xDF, 0xB3, 0x7B,
+    0x18, 0x78, 0x0F, 0x57, 0x36, 0xB3, 0xDC, 0x1D, 0x97, 0xAA, 0x9E, 0x9B, 0x1B, 0x97, 0x5C, 0x3E,
+    0xAA, 0x33, 0xD7, 0x28, 0xC3, 0x2C, 0x03, 0x02, 0xB4, 0x16, 0x19, 0x0B, 0x57, 0x70, 0x27, 0x60,
+    0xED, 0x69, 0x70, 0x6E, 0xDF, 0x3E, 0x3F, 0x1D, 0x99, 0xC9, 0xC0, 0x83, 0xA3, 0x85, 0xF1, 0xE2,
+    0x29, 0x5B, 0xAE, 0x9E, 0x95, 0x97, 0x1C, 0x97, 0x3C, 0x03, 0x37, 0xB3, 0x65, 0x4A, 0x3E, 0x9E,
+    0x5E, 0x60, 0x9B, 0x59, 0x2A, 0x91, 0x52, 0xB7, 0x79, 0x31, 0xD3, 0xC5, 0xC8, 0x8B, 0x0D, 0x2F,
+    0xCA, 0x6F, 0xC9, 0x84, 0x72, 0x95, 0xA3, 0xD8, 0x51, 0xB9, 0x5E, 0x3F, 0xDF, 0xF8, 0xD6, 0xD2,
+    0x6F, 0x0A, 0x71, 0x5A, 0xB0, 0xF6, 0x96, 0x61, 0xA5, 0x97, 0x83, 0x6E, 0x98, 0x7E, 0x5B, 0x14,
+    0x2E, 0x72, 0x6C, 0xF5, 0xC0, 0x35, 0xA8, 0x78, 0x85, 0x56, 0xEC, 0x9F, 0x14, 0xBC, 0xF1, 0xA1,
+    0xE9, 0x51, 0xF0, 0xC2, 0xF0, 0x8F, 0x5C, 0xDB, 0x1F, 0x5A, 0xFA, 0xF8, 0xD9, 0x9A, 0x91, 0x85,
+    0x05, 0x7F, 0xF1, 0xCC, 0xCF, 0x04, 0x06, 0x51, 0x89, 0xC9, 0x2C, 0x7C, 0xE0, 0x41, 0x88, 0x59,
+    0x16, 0xFD, 0x47, 0xBA, 0x7C, 0x89, 0x0C, 0xEE, 0x55, 0x5F, 0x7D, 0x56, 0xC1, 0x9B, 0x65, 0xD8,
+    0x06, 0x6F, 0x17, 0xDB, 0x59, 0x45, 0x6D, 0x82, 0xBD, 0x48, 0xCC, 0xEC, 0x36, 0x57, 0x62, 0x05,
+    0x8A, 0xAF, 0x46, 0xAB, 0x7B, 0xA5, 0xEF, 0x02, 0xA2, 0xD8, 0x6E, 0x6F, 0xEF, 0x46, 0xB2, 0x4A,
+    0x5E, 0x5D, 0x81, 0x95, 0xCB, 0x24, 0xDA, 0x76, 0x9B, 0x5B, 0x0E, 0xB7, 0x61, 0xB6, 0x0A, 0x6E,
+    0xBB, 0x9E, 0xB0, 0x1D, 0xBC, 0xCD, 0xE1, 0x22, 0x2C, 0x34, 0x5B, 0x87, 0xD4, 0x7B, 0xD8, 0x8E,
+    0x0A, 0x9E, 0x62, 0x95, 0xCA, 0x0C, 0x75, 0x87, 0x9E, 0xD4, 0xA5, 0xAC, 0x41, 0x64, 0xDC, 0xD3,
+    0x04, 0x48, 0x87, 0x95, 0x67, 0xF1, 0x05, 0x2F, 0xC0, 0x0F, 0xDF, 0x7A, 0x24, 0x2C, 0xDD, 0x60,
+    0x77, 0x02, 0xD5, 0x4E, 0x5C, 0x3A, 0x82, 0xCD, 0xB4, 0x13, 0x89, 0x05, 0x41, 0x3C, 0x3C, 0x90,
+    0x28, 0x16, 0x1E, 0xB6, 0x3F, 0x67, 0xFF, 0xBA, 0x5D, 0xD1, 0x5D, 0x39, 0x5D, 0x19, 0xFA, 0x52,
+    0x1C, 0xDC, 0x56, 0x0B, 0x1C, 0xBE, 0xD8, 0xEE, 0xB0, 0xDD, 0x46, 0x6C, 0x37, 0xA0, 0x07, 0x98,
+    0x4C, 0x94, 0xE0, 0x4C, 0xF1, 0xF3, 0xB4, 0xA8, 0xB9, 0x7C, 0xC0, 0xE5, 0x48, 0xD1, 0x82, 0xDD,
+    0x30, 0x30, 0x56, 0xD3, 0x02, 0xE7, 0xC3, 0x42, 0xDC, 0xC3, 0x40, 0x47, 0xCD, 0x93, 0x85, 0x11,
+    0x18, 0x32, 0xFC, 0xC1, 0x02, 0x3A, 0x80, 0x09, 0xD8, 0x18, 0x2E, 0x38, 0x73, 0xE8, 0x5C, 0x4A,
+    0x1B, 0x65, 0x18, 0x65, 0xD0, 0x09, 0x36, 0x5D, 0xF8, 0x97, 0x6B, 0xF7, 0x03, 0x50, 0xCE, 0xD7,
+    0xC0, 0x28, 0x63, 0xED, 0x44, 0xA7, 0xD9, 0x48, 0x65, 0x5C, 0x61, 0xC8, 0x7C, 0x01, 0xB9, 0x39,
+    0x33, 0xB4, 0x57, 0x7B, 0xCF, 0xA8, 0x24, 0x2A, 0x46, 0x5D, 0x15, 0x2F, 0xE5, 0xAE, 0xFB, 0x76,
+    0x7E, 0xD9, 0x56, 0xC7, 0xFB, 0xBE, 0x4D, 0x6D, 0x91, 0xB3, 0xD4, 0xC3, 0x5D, 0xBB, 0xB7, 0x16,
+    0xB7, 0xAB, 0x8F, 0xAF, 0xFD, 0x17, 0x0A, 0x15, 0x4D, 0xEB, 0x4F, 0xA8, 0xDB, 0xBD, 0x95, 0xD1,
+    0xC7, 0xF6, 0xED, 0xBD, 0xDA, 0x25, 0x43, 0xAA, 0x15, 0x35, 0x83, 0x3F, 0x26, 0x13, 0x27, 0x98,
+    0x47, 0x2B, 0x68, 0xD6, 0xE0, 0xA1, 0xBC, 0x51, 0x17, 0x5B, 0x6C, 0x81, 0x09, 0xCD, 0xFF, 0x7E,
+    0x32, 0x07, 0xE4, 0x6F, 0xBA, 0xA1, 0xFC, 0x08, 0x5D, 0xCC, 0x7E, 0xEC, 0x7E, 0x1D, 0xAD, 0xFA,
+    0xCD, 0xF3, 0x15, 0xD8, 0xC5, 0xB0, 0xD4, 0xBF, 0xA3, 0xCE, 0xA5, 0xF9, 0xC7, 0x29, 0xC4, 0x21,
+    0xBE, 0x9F, 0xA8, 0xC4, 0xEF, 0x1C, 0xB9, 0xA0, 0xFC, 0x02, 0x2D, 0x06, 0x47, 0x23, 0x60, 0xA4,
+    0x18, 0xCF, 0x8D, 0x43, 0x8D, 0x50, 0xAD, 0x4F, 0x01, 0xB8, 0x4C, 0x39, 0xBC, 0x51, 0xA3, 0xE5,
+    0x72, 0x60, 0xB3, 0x41, 0x2E, 0xC1, 0x29, 0x5E, 0x94, 0x36, 0x1B, 0xE9, 0x3D, 0x78, 0x9F, 0x58,
+    0x64, 0xA3, 0x41, 0x70, 0x44, 0x05, 0x89, 0xB2, 0x7A, 0x3C, 0x50, 0x3B, 0x0F, 0x04, 0xCE, 0x85,
+    0x81, 0xF8, 0x14, 0x78, 0x40, 0x72, 0x25, 0x6A, 0x02, 0x9B, 0xA4, 0x0A, 0x77, 0xAA, 0xBF, 0x27,
+    0x8A, 0xA6, 0x7E, 0x37, 0x13, 0xA7, 0xE6, 0xED, 0x4C, 0x15, 0x76, 0x6F, 0x17, 0x6A, 0x35, 0x7E,
+    0xBF, 0xC8, 0xE5, 0xE3, 0xB5, 0xE0, 0xE8, 0xCA, 0x36, 0x08, 0x04, 0x13, 0xC5, 0xE9, 0x12, 0x59,
+    0x42, 0x9F, 0xC5, 0x6A, 0xCE, 0x59, 0x01, 0x02, 0x51, 0x2F, 0x1E, 0x1D, 0xC1, 0x9A, 0x81, 0x15,
+    0xC6, 0xC8, 0x24, 0xC8, 0x1A, 0x76, 0x2A, 0x7C, 0xE1, 0x21, 0xF9, 0xDB, 0x1D, 0x3B, 0x8E, 0x33,
+    0x51, 0x24, 0x39, 0x20, 0x85, 0xEF, 0x9E, 0x7D, 0x58, 0x6C, 0x9A, 0x6E, 0x9C, 0x4A, 0x70, 0xDA,
+    0x0C, 0x1A, 0x53, 0x6C, 0x24, 0x44, 0x4A, 0x1C, 0x8B, 0xE1, 0xD0, 0x8B, 0x7E, 0x3C, 0x26, 0xC9,
+    0x41, 0x1A, 0xA8, 0xCF, 0xE2, 0x1A, 0x7A, 0x96, 0x24, 0x93, 0x5C, 0x5C, 0xDD, 0x05, 0x9D, 0xB1,
+    0xDF, 0x2B, 0xB4, 0xBD, 0x3F, 0xFD, 0x7A, 0x9F, 0xE5, 0xA8, 0xBE, 0x4C, 0xC3, 0x42, 0xA3, 0xA3,
+    0xA5, 0x5E, 0x5D, 0xD8, 0xBA, 0x44, 0x7D, 0xE3, 0x1F, 0x3E, 0x9F, 0xB2, 0xEE, 0x7F, 0xEA, 0xE5,
+    0x81, 0x13, 0xD5, 0x5F, 0x5C, 0x57, 0xB6, 0x5E, 0x0E, 0x27, 0x03, 0x05, 0x59, 0x1D, 0xD9, 0x7E,
+    0x6F, 0xA8, 0x56, 0xD8, 0x2A, 0x0D, 0xB6, 0x68, 0x8F, 0xD2, 0xCB, 0x43, 0x2F, 0x89, 0x34, 0x1B,
+    0xC1, 0x91, 0x9F, 0xDA, 0xBD, 0xB5, 0x53, 0xB3, 0xA6, 0xC9, 0x5E, 0x8D, 0xD7, 0xD1, 0x9E, 0x6F,
+    0x0F, 0xA3, 0x39, 0x19, 0x34, 0x31, 0x44, 0xBC, 0x68, 0xD7, 0xE7, 0x26, 0x71, 0x5F, 0xBB, 0x66,
+    0x7B, 0xB7, 0x45, 0xA2, 0x89, 0x79, 0xC6, 0x7F, 0xD1, 0xC1, 0xAC, 0x1B, 0x0F, 0xE2, 0x45, 0x00,
+    0x31, 0xC2, 0xD4, 0xC0, 0xC3, 0xA5, 0x3D, 0x04, 0xCF, 0x66, 0x3B, 0x66, 0xEA, 0x97, 0xD0, 0x0B,
+    0x5D, 0xA0, 0x19, 0xD3, 0xC8, 0xE1, 0x51, 0x5B, 0xD3, 0x80, 0x8A, 0xD7, 0x96, 0x83, 0x70, 0x8F,
+    0xF0, 0xD5, 0x0C, 0x07, 0x47, 0x32, 0xC1, 0x4F, 0xFB, 0x9B, 0x87, 0x0F, 0xBD, 0x0B, 0x46, 0x13,
+    0xC0, 0xEA, 0xBC, 0x44, 0xF2, 0xCD, 0xFE, 0xD6, 0x94, 0xF4, 0x84, 0x66, 0x52, 0x42, 0xED, 0x7A,
+    0x17, 0xA5, 0xCE, 0xFF, 0x9F, 0xCF, 0x27, 0xA5, 0x55, 0xBD, 0xAE, 0xDE, 0x44, 0x10, 0x1D, 0x7F,
+    0x1B, 0xB0, 0x14, 0x17, 0x5B, 0x51, 0xBB, 0x47, 0x02, 0xBF, 0x41, 0xD6, 0x5D, 0x0A, 0x8A, 0xD0,
+    0xDC, 0x8A, 0x37, 0xE0, 0x19, 0xAE, 0xB2, 0x56, 0x78, 0x86, 0xF4, 0xB4, 0xA1, 0xA1, 0x49, 0x09,
+    0x59, 0x93, 0xBC, 0x80, 0x43, 0x4B, 0x63, 0x09, 0x21, 0x24, 0x1A, 0x5C, 0xB8, 0xF0, 0x55, 0x6C,
+    0x0F, 0x67, 0xCE, 0x7E, 0xBF, 0x51, 0x3A, 0x2C, 0xDD, 0x19, 0x7F, 0x3B, 0xEB, 0xD9, 0x73, 0xCE,
+    0xCC, 0xCE, 0x15, 0xF9, 0xFE, 0x55, 0x2B, 0xE2, 0x55, 0x3B, 0x29, 0x54, 0x77, 0x91, 0xAF, 0xA5,
+    0x9A, 0xC4, 0x0D, 0xD2, 0xB4, 0x72, 0x2F, 0x87, 0x59, 0xAA, 0x5E, 0x1A, 0x91, 0x45, 0xCA, 0x49,
+    0x6A, 0x29, 0x76, 0x39, 0x4C, 0x85, 0xF6, 0x12, 0x54, 0x67, 0x29, 0x55, 0x17, 0x91, 0xA4, 0x1B,
+    0x13, 0xCC, 0x22, 0xFA, 0x32, 0x61, 0xF7, 0x50, 0x6C, 0xE2, 0x56, 0xF1, 0xA3, 0x84, 0x5E, 0x76,
+    0xA9, 0x56, 0xA9, 0x47, 0xD1, 0xEE, 0xB0, 0x8B, 0x9F, 0x25, 0x8C, 0x07, 0x95, 0x72, 0x97, 0x30,
+    0x49, 0x1A, 0x9D, 0x8A, 0xDF, 0xE1, 0x45, 0x47, 0xC1, 0x53, 0xDC, 0x7D, 0x0B, 0x5B, 0x2B, 0xF2,
+    0x4B, 0x54, 0x9D, 0xC4, 0x8E, 0xC1, 0x09, 0x61, 0x6B, 0x1F, 0x89, 0x34, 0x93, 0xED, 0xF1, 0xDC,
+    0x59, 0xF2, 0xFD, 0xB0, 0x98, 0x15, 0xA5, 0x0D, 0x0F, 0x0C, 0xE8, 0x0E, 0x3A, 0xC0, 0xB4, 0xF3,
+    0x87, 0x81, 0x92, 0xCF, 0x8D, 0x1C, 0x76, 0xF3, 0x87, 0x34, 0x16, 0x91, 0xCA, 0xCE, 0x10, 0x87,
+    0x33, 0x5A, 0x04, 0x16, 0x49, 0xFF, 0xFC, 0xAC, 0x2B, 0x3E, 0x53, 0x90, 0xB9, 0xB6, 0x8D, 0x5A,
+    0x8E, 0x22, 0xE5, 0xB4, 0x7C, 0x40, 0x15, 0xD8, 0xA2, 0xD9, 0xB7, 0x66, 0xF6, 0xC7, 0x2F, 0xAB,
+    0xA9, 0x00, 0xF2, 0x60, 0xA7, 0xC8, 0x76, 0xC1, 0xD7, 0xD8, 0x19, 0xC2, 0xF3, 0xCA, 0xF9, 0xB2,
+    0x40, 0xBC, 0x25, 0xB1, 0x37, 0xC3, 0x79, 0x01, 0x8A, 0x19, 0x79, 0xD2, 0x23, 0x5E, 0xC7, 0x4C,
+    0x35, 0x33, 0x25, 0xA2, 0x65, 0xA6, 0x7A, 0xBE, 0x2C, 0x64, 0xE6, 0x50, 0x55, 0xE2, 0x50, 0x68,
+    0x6B, 0x52, 0x9B, 0x4A, 0xDA, 0xDB, 0x56, 0xBF, 0x48, 0x18, 0x50, 0x54, 0x29, 0x57, 0x8A, 0x87,
+    0x4F, 0x1C, 0x4B, 0x60, 0xCB, 0xF8, 0x12, 0xCB, 0x1E, 0x9B, 0x53, 0x87, 0xA2, 0x4A, 0x35, 0x13,
+    0x9C, 0x12, 0x86, 0x55, 0x0E, 0xED, 0xB0, 0x11, 0x35, 0x6A, 0x98, 0x88, 0x8E, 0x9B, 0x5B, 0xFB,
+    0x12, 0x6F, 0x48, 0x83, 0xD3, 0x0B, 0xFD, 0xEB, 0x3B, 0x1D, 0xAC, 0x62, 0x10, 0xAF, 0x30, 0x31,
+    0x5A, 0xCA, 0x33, 0x5A, 0x05, 0xAC, 0x72, 0x10, 0xEE, 0xE1, 0xA4, 0x9B, 0x7C, 0x69, 0x12, 0xBE,
+    0x42, 0x3E, 0x64, 0x33, 0x5B, 0xCD, 0x66, 0xFD, 0x68, 0x36, 0xF4, 0x66, 0x53, 0x97, 0x11, 0x43,
+    0x16, 0xB0, 0x87, 0xAD, 0x16, 0x69, 0x46, 0xD3, 0x00, 0x36, 0x8C, 0x47, 0x16, 0xF5, 0x64, 0x5C,
+    0xEB, 0xC9, 0x48, 0xD6, 0x13, 0x38, 0xC3, 0xD6, 0x8B, 0x29, 0x83, 0xA6, 0x02, 0xB2, 0x34, 0x1C,
+    0x1B, 0xDA, 0x2C, 0x0B, 0xB6, 0xD3, 0xAE, 0xB4, 0x33, 0xED, 0x44, 0xDB, 0x9F, 0x1B, 0x4A, 0x92,
+    0xCB, 0xCD, 0x14, 0xBA, 0x3D, 0xFB, 0x3E, 0x76, 0xB9, 0x20, 0xB9, 0x24, 0x7E, 0xCA, 0x15, 0x2B,
+    0x97, 0x62, 0x3F, 0x96, 0x0B, 0x1B, 0x92, 0xDD, 0x08, 0xE0, 0x8C, 0x3D, 0x74, 0x81, 0x86, 0xD6,
+    0xD5, 0xDD, 0x61, 0x43, 0xC7, 0x52, 0xB7, 0x36, 0x68, 0x07, 0xE4, 0xCD, 0xD0, 0xE8, 0x44, 0xD1,
+    0xEA, 0x0F, 0x2B, 0x28, 0xB9, 0xCD, 0x2F, 0x6A, 0x42, 0xEB, 0xB3, 0x35, 0xFC, 0x8E, 0x32, 0x87,
+    0x3F, 0x36, 0xFF, 0x60, 0xC2, 0x7E, 0xD8, 0xDD, 0x0E, 0x6E, 0x0E, 0xB8, 0x93, 0xA1, 0x83, 0xA0,
+    0x0D, 0x04, 0xC6, 0x3D, 0xE8, 0x2A, 0xC3, 0x0C, 0xC8, 0x85, 0x31, 0x70, 0x58, 0x8C, 0x48, 0x50,
+    0x40, 0x6A, 0x6F, 0x7D, 0x12, 0xA7, 0x53, 0x37, 0xC8, 0xAF, 0xF8, 0x7B, 0x0E, 0xE0, 0x76, 0x89,
+    0xB0, 0x73, 0xA6, 0xB3, 0x1A, 0x46, 0xE8, 0x5F, 0x0F, 0x74, 0x20, 0x1B, 0x79, 0x4F, 0x84, 0x2C,
+    0xEB, 0x91, 0xCE, 0xAD, 0x99, 0x73, 0x62, 0x77, 0xA1, 0xAC, 0x74, 0x2E, 0xBB, 0xDC, 0x72, 0xC8,
+    0x32, 0x67, 0x97, 0x65, 0x8A, 0x39, 0x18, 0xFF, 0xA5, 0x38, 0xF1, 0x4F, 0x62, 0x88, 0x63, 0x1C,
+    0x88, 0xC9, 0xAF, 0x74, 0x0E, 0x94, 0x4C, 0x9A, 0x38, 0xD1, 0xD9, 0x6A, 0x98, 0x71, 0xED, 0x3A,
+    0x73, 0x79, 0x15, 0xE7, 0x86, 0x67, 0xF6, 0xF2, 0xC2, 0x9A, 0xB5, 0x07, 0xB8, 0xA6, 0x87, 0x62,
+    0xF5, 0x90, 0x07, 0x49, 0x6A, 0xBD, 0xF5, 0x00, 0x4C, 0xB9, 0x56, 0x36, 0x68, 0xBE, 0xB1, 0xB1,
+    0xF0, 0xF7, 0x6A, 0x17, 0x79, 0x33, 0x19, 0xB6, 0x13, 0x24, 0xAF, 0x84, 0xDC, 0x9E, 0x6E, 0x51,
+    0x30, 0x24, 0x1C, 0x1D, 0x04, 0x53, 0xED, 0xA7, 0x70, 0x41, 0xE4, 0x6C, 0x84, 0x98, 0x4B, 0xCF,
+    0x3E, 0x56, 0x0B, 0x2B, 0xBB, 0xC7, 0x1C, 0xB5, 0xE7, 0x28, 0xB2, 0x5C, 0xCB, 0xB5, 0x8B, 0x37,
+    0x2E, 0x65, 0x59, 0xF2, 0x8C, 0x29, 0xF2, 0x07, 0x47, 0x77, 0xC8, 0xCE, 0xE5, 0x21, 0x77, 0x74,
+    0x65, 0x76, 0x95, 0x0E, 0x79, 0xA6, 0x1C, 0xDD, 0xB5, 0xF0, 0x84, 0x33, 0xE6, 0x79, 0xB3, 0x66,
+    0x54, 0x9A, 0x6F, 0x19, 0xE2, 0x49, 0xCF, 0xB0, 0x1A, 0x6D, 0x8F, 0x19, 0x4A, 0x5B, 0xC9, 0x53,
+    0x91, 0xC3, 0x23, 0x32, 0x6C, 0x32, 0x78, 0xCB, 0xEF, 0x26, 0xB9, 0x09, 0x07, 0x9E, 0xD2, 0xDF,
+    0x84, 0x8B, 0xF5, 0xD4, 0x43, 0x57, 0xE1, 0x6A, 0xBC, 0x0D, 0xBF, 0x61, 0xB8, 0xBD, 0x0D, 0x93,
+    0xF9, 0x47, 0x61, 0xDF, 0x9F, 0x86, 0xE1, 0x55, 0xF8, 0x0A, 0x15, 0xC3, 0x36, 0x28, 0x0E, 0xBC,
+    0x9D, 0xBC, 0xAE, 0x5F, 0xDC, 0x71, 0xD4, 0x3E, 0x72, 0xC5, 0xF0, 0xFA, 0xAB, 0xEA, 0xC5, 0xF8,
+    0x4B, 0x53, 0xFD, 0x36, 0xDD, 0xD7, 0x4F, 0xDF, 0xCF, 0xCF, 0xEB, 0x1F, 0xA6, 0x35, 0xF8, 0x77,
+    0xD3, 0xFA, 0xC4, 0x3B, 0x69, 0x93, 0x91, 0x48, 0x3B, 0xBB, 0xF0, 0x7C, 0xE2, 0x25, 0x2F, 0x39,
+    0x11, 0xDA, 0x05, 0x00, 0xC9, 0x67, 0x0E, 0x17, 0xA4, 0xF1, 0x4C, 0xF6, 0x42, 0xE9, 0xA3, 0x0C,
+    0xEE, 0x53, 0x19, 0xB6, 0x4F, 0x64, 0xE0, 0xF1, 0x97, 0x0C, 0x57, 0xC7, 0x9F, 0x33, 0xD8, 0xC7,
+    0x4E, 0xD7, 0x53, 0xD7, 0x72, 0x38, 0xDD, 0xDD, 0xC9, 0x6B, 0x1E, 0xDF, 0xCC, 0x52, 0x57, 0x9D,
+    0x97, 0xFB, 0xC7, 0x52, 0xF0, 0x2E, 0xDA, 0x3F, 0x31, 0xD5, 0x77, 0x6C, 0x85, 0x9F, 0xF0, 0xFC,
+    0xF8, 0xC4, 0xF2, 0x25, 0x9B, 0xC1, 0x9F, 0xC9, 0xFF, 0x7F, 0xFE, 0x03, 0x8D, 0x95, 0x3F, 0x6F,
+    0xDE, 0x54, 0x18, 0xC5, 0x1F, 0xDB, 0x22, 0xEF, 0xE0, 0xC1, 0x8C, 0xA8, 0x19, 0xFC, 0x05, 0x10,
+    0x9E, 0x91, 0x48, 0xAE, 0x11, 0x43, 0x07, 0x06, 0x8A, 0xD4, 0x2E, 0x65, 0x61, 0x64, 0xCB, 0xC2,
+    0x18, 0x62, 0x8B, 0x4F, 0x10, 0xA9, 0x62, 0xE7, 0x83, 0x34, 0xD8, 0x80, 0xC4, 0xEC, 0x9D, 0xC5,
+    0x43, 0xCA, 0xD0, 0xA5, 0xAE, 0x64, 0x29, 0x4E, 0x62, 0xFB, 0xF2, 0x3B, 0xD7, 0x49, 0x9A, 0xA2,
+    0x08, 0xB0, 0xE4, 0xF7, 0xB5, 0xAF, 0xAF, 0x9F, 0x3F, 0xE7, 0x9C, 0xE7, 0xD8, 0x4C, 0x47, 0xBC,
+    0x72, 0xFA, 0x65, 0x30, 0xEF, 0x57, 0x73, 0x5D, 0xD1, 0xEF, 0x06, 0x5B, 0x6C, 0xB2, 0xAC, 0x2D,
+    0xCC, 0xE6, 0xA4, 0xE3, 0xE2, 0xD8, 0xA2, 0x29, 0xAB, 0xCD, 0xD5, 0xA3, 0xA5, 0x63, 0x56, 0x27,
+    0xDE, 0xFC, 0x73, 0x3F, 0x64, 0xDE, 0x7B, 0x6B, 0xBC, 0xEF, 0x13, 0xBF, 0x9E, 0x58, 0xBA, 0x3E,
+    0xEE, 0xD8, 0x61, 0xB6, 0x1B, 0x09, 0xDA, 0x70, 0xA6, 0x03, 0x3F, 0x04, 0xB7, 0xAC, 0x33, 0x8B,
+    0x66, 0x2E, 0xF2, 0x96, 0x54, 0x13, 0x17, 0xEE, 0xCB, 0xD5, 0x92, 0x6B, 0xBF, 0x58, 0xB5, 0x7E,
+    0x33, 0xA4, 0xDE, 0xF2, 0xDA, 0xB7, 0x36, 0x67, 0x03, 0xB9, 0x78, 0x61, 0x66, 0x5F, 0xF6, 0xE3,
+    0x6C, 0xF1, 0xE8, 0x5A, 0xAB, 0x92, 0xD9, 0x8A, 0xCE, 0xBD, 0x3A, 0x9A, 0x12, 0xE5, 0x73, 0xDE,
+    0xB7, 0x31, 0x39, 0x2D, 0xF5, 0xE4, 0x89, 0x9E, 0xD8, 0x76, 0xEC, 0xF9, 0x3A, 0xE2, 0x69, 0x71,
+    0xF9, 0x5D, 0xB4, 0x6E, 0x09, 0x7F, 0x31, 0x4B, 0x28, 0x20, 0xA7, 0xA2, 0x33, 0x2E, 0xC7, 0x6D,
+    0x95, 0x80, 0xE6, 0x5F, 0xFD, 0xCC, 0xDE, 0x8E, 0x28, 0xAD, 0x35, 0x8B, 0xDD, 0x1D, 0xAA, 0xDB,
+    0x76, 0xAD, 0x7E, 0x5D, 0x58, 0x98, 0x1E, 0x5E, 0x20, 0x4C, 0x3E, 0x82, 0x4D, 0xE2, 0x27, 0x16,
+    0x2A, 0x7F, 0xDD, 0xD1, 0x33, 0x4D, 0xD8, 0xA1, 0x65, 0xB3, 0x92, 0xBA, 0xCE, 0x78, 0xEC, 0xB5,
+    0x9F, 0xE2, 0xD9, 0x9F, 0xF5, 0x5A, 0x68, 0x4A, 0xE3, 0x8E, 0x1D, 0x93, 0x55, 0x74, 0x4A, 0x37,
+    0xB5, 0x15, 0x1E, 0x10, 0xD4, 0xD4, 0xA0, 0x48, 0x6F, 0xC8, 0x55, 0x4C, 0x87, 0xEF, 0x4A, 0x3A,
+    0xEA, 0xB5, 0xDC, 0x02, 0x40, 0x66, 0xBB, 0xDE, 0xBE, 0x8F, 0x46, 0x4B, 0xDA, 0x43, 0x7B, 0x3E,
+    0xA7, 0xBC, 0xDD, 0x72, 0x4E, 0xF9, 0x4F, 0xA5, 0xC5, 0xC3, 0x4D, 0x85, 0x89, 0x0A, 0x2C, 0x46,
+    0xFB, 0x28, 0x52, 0x70, 0x32, 0x8C, 0x0A, 0x4D, 0x98, 0xB5, 0xDC, 0xE2, 0xA5, 0xC0, 0xEE, 0x3B,
+    0x3B, 0x01, 0x8C, 0xDA, 0x22, 0x5E, 0xFB, 0x84, 0x97, 0x7A, 0xDB, 0xB1, 0x09, 0x4C, 0x3F, 0x58,
+    0x9F, 0x42, 0x00, 0x5C, 0x13, 0xA4, 0x0C, 0xE8, 0xB9, 0x8D, 0xC5, 0x0D, 0x52, 0x51, 0x58, 0xB4,
+    0x21, 0x49, 0x55, 0x6E, 0xEC, 0x5A, 0xD1, 0x3F, 0x52, 0x85, 0x5F, 0xC1, 0x13, 0x90, 0xB2, 0x4E,
+    0x23, 0x4E, 0x30, 0x14, 0x96, 0x2C, 0x96, 0x95, 0xA0, 0x00, 0x80, 0xAE, 0x8D, 0x7B, 0xCB, 0x7B,
+    0x10, 0x86, 0xE2, 0x80, 0x52, 0xF6, 0xBA, 0x59, 0x51, 0x9D, 0x8A, 0x13, 0xA3, 0xB0, 0x79, 0xAD,
+    0x56, 0x5F, 0x0C, 0xB7, 0x5D, 0x00, 0x9C, 0x75, 0xFB, 0x24, 0x6E, 0x6E, 0xF6, 0x00, 0xBA, 0x7E,
+    0xEC, 0xE8, 0xF2, 0x1D, 0x3C, 0xC7, 0xB6, 0x91, 0xAC, 0x6E, 0xFE, 0xE3, 0xEE, 0x68, 0x94, 0xE0,
+    0x66, 0x0B, 0xA0, 0x54, 0xE7, 0x59, 0x47, 0x79, 0x79, 0x0D, 0x31, 0x07, 0x56, 0x59, 0x34, 0x92,
+    0x73, 0xD7, 0xD2, 0xBB, 0xE3, 0xCE, 0x26, 0xDD, 0x75, 0x74, 0xEC, 0xCA, 0x46, 0x23, 0x30, 0xD3,
+    0x2C, 0x85, 0xBB, 0xBA, 0xA9, 0x23, 0xD8, 0x82, 0x04, 0xDE, 0x6B, 0x4A, 0x45, 0x18, 0xEC, 0xDE,
+    0xF1, 0x44, 0x58, 0xD2, 0xF3, 0xB1, 0xC5, 0xE1, 0xFF, 0x33, 0x31, 0x43, 0xFA, 0x83, 0xF0, 0xAF,
+    0xE0, 0x88, 0x3F, 0x84, 0x0D, 0xD3, 0x70, 0x33, 0x14, 0x99, 0x62, 0x54, 0x14, 0x99, 0x84, 0x59,
+    0x19, 0xED, 0xC1, 0xE3, 0xC0, 0x42, 0x62, 0x53, 0x1C, 0x29, 0xED, 0xE6, 0x2E, 0x7D, 0xF8, 0xCE,
+    0xFE, 0xE5, 0xEE, 0x2E, 0x8A, 0x26, 0x65, 0xAF, 0x11, 0xCB, 0x1E, 0xB6, 0x19, 0xA9, 0x7B, 0x87,
+    0x36, 0x09, 0x3D, 0x9D, 0x12, 0xBC, 0xF6, 0xEB, 0xD4, 0x38, 0x15, 0x52, 0x1B, 0x10, 0x9D, 0xD0,
+    0xCA, 0x4B, 0x87, 0xA8, 0x17, 0x8B, 0x00, 0x35, 0x86, 0xFF, 0x04, 0x49, 0xEF, 0xF8, 0x4F, 0xDF,
+    0xD0, 0xF0, 0x9F, 0xA0, 0xFD, 0xFB, 0x6A, 0xC5, 0x6F, 0xBE, 0x74, 0xB5, 0xEF, 0x00, 0x73, 0x68,
+    0xCC, 0xD1, 0xF2, 0xA9, 0x42, 0x3A, 0xE9, 0x2C, 0xFD, 0xE7, 0x7F, 0x7B, 0xFF, 0x1E, 0xDC, 0x7B,
+    0x49, 0x70, 0x96, 0xF6, 0x49, 0xE4, 0xB1, 0x80, 0x3E, 0xA7, 0x58, 0x79, 0xD6, 0x3E, 0x84, 0x5E,
+    0xF8, 0xD1, 0xA1, 0x09, 0x64, 0xE4, 0x28, 0xBF, 0xD1, 0xB3, 0x99, 0xE9, 0x8B, 0x31, 0x14, 0xCB,
+    0x3B, 0x4C, 0x28, 0x6D, 0xC5, 0x5B, 0x99, 0xF4, 0xCC, 0x3F, 0xE5, 0x4F, 0x71, 0x08, 0x79, 0x86,
+    0xBF, 0x69, 0x4C, 0xE1, 0x1A, 0x42, 0xF2, 0x16, 0xD7, 0x5A, 0x58, 0xE7, 0x8D, 0x0A, 0xA3, 0x48,
+    0xC5, 0x74, 0x34, 0x27, 0x7A, 0x62, 0x9E, 0x22, 0x20, 0x5B, 0xBE, 0x86, 0xD7, 0x44, 0x7F, 0x91,
+    0x06, 0x2D, 0xE2, 0x80, 0x9F, 0xCF, 0x70, 0x46, 0xF8, 0xDE, 0x5E, 0x52, 0x5F, 0xD6, 0xB2, 0x77,
+    0x26, 0x09, 0xC1, 0xCA, 0x78, 0xDA, 0x29, 0x29, 0xCA, 0x1F, 0xA4, 0x93, 0x98, 0x39, 0x18, 0xF0,
+    0x9D, 0x15, 0x1D, 0xE5, 0x5D, 0x53, 0x27, 0x92, 0x50, 0xD3, 0x4B, 0xD9, 0x24, 0x7C, 0xED, 0xCB,
+    0xAC, 0x8B, 0xA6, 0x44, 0x02, 0xF9, 0x81, 0x56, 0xA9, 0x32, 0xFB, 0x15, 0xF0, 0x67, 0x50, 0x2E,
+    0xBE, 0x18, 0xA8, 0x93, 0xC6, 0xD7, 0x64, 0x7D, 0xD6, 0xB4, 0x85, 0x5C, 0x42, 0x7E, 0xB1, 0xC3,
+    0xA8, 0x19, 0x65, 0xCD, 0xF4, 0x87, 0x7B, 0xE7, 0xA0, 0xF1, 0x16, 0x61, 0x83, 0xF9, 0x15, 0xBF,
+    0x6E, 0x12, 0xDB, 0x54, 0xC8, 0x54, 0x83, 0x63, 0xAD, 0x89, 0x3D, 0x0C, 0x13, 0x3C, 0x5A, 0x10,
+    0xB9, 0x80, 0x01, 0xD3, 0xA6, 0x8D, 0x47, 0x79, 0x01, 0x8F, 0x89, 0x3B, 0x07, 0x10, 0x31, 0xD5,
+    0x0B, 0x85, 0x76, 0x8F, 0x7D, 0x98, 0x76, 0xCC, 0x35, 0x0B, 0xAA, 0xA8, 0xEC, 0x76, 0x2C, 0x83,
+    0x85, 0x07, 0x6F, 0xBB, 0x31, 0xFA, 0xF7, 0x8F, 0x47, 0xE5, 0x53, 0xAA, 0x7B, 0xCB, 0xF8, 0x5F,
+    0x5F, 0x8D, 0x24, 0xAD, 0x06, 0x00, 0x76, 0xFA, 0xA2, 0xB8, 0x4E, 0xDC, 0xB6, 0x4C, 0x43, 0x55,
+    0xE7, 0xFA, 0x3E, 0x04, 0x87, 0x3C, 0x14, 0x93, 0xCE, 0x52, 0x58, 0x3B, 0xAD, 0x66, 0x55, 0x32,
+    0x69, 0x42, 0x69, 0xDB, 0x5F, 0xA1, 0xBC, 0xE6, 0x85, 0xD2, 0xF3, 0x09, 0xA2, 0xBB, 0x3F, 0xA4,
+    0x42, 0x2F, 0x09, 0x4A, 0x00, 0x85, 0x5C, 0xE0, 0xD3, 0xF7, 0x06, 0x64, 0xBF, 0x8B, 0xAE, 0x3D,
+    0x5B, 0x88, 0x75, 0xF9, 0x6D, 0xE4, 0x37, 0xE7, 0x82, 0x38, 0x0D, 0xD9, 0xED, 0xE5, 0xB2, 0x8D,
+    0x1B, 0x6C, 0xA0, 0x11, 0xCB, 0xE4, 0x64, 0x5B, 0x83, 0x57, 0x25, 0x96, 0xD9, 0x46, 0xCB, 0xD7,
+    0x65, 0x18, 0x16, 0x99, 0x47, 0x1E, 0x46, 0x92, 0x5C, 0x55, 0xF8, 0x40, 0xEA, 0x6B, 0xA3, 0xB6,
+    0x8B, 0x76, 0x77, 0x9A, 0x0F, 0x38, 0xE6, 0x84, 0x07, 0xCF, 0x89, 0xB0, 0xDB, 0xF7, 0xE7, 0x5B,
+    0x0D, 0x1F, 0x9B, 0xAC, 0x15, 0xEF, 0x84, 0x45, 0x24, 0xCB, 0x33, 0xB9, 0x57, 0x75, 0xB7, 0x34,
+    0x84, 0xAF, 0xDF, 0x12, 0x00, 0x2D, 0x6A, 0x59, 0xC1, 0x4E, 0x73, 0xB3, 0xB0, 0xB3, 0x74, 0xBE,
+    0xCB, 0x48, 0xC2, 0xE0, 0xA5, 0x5D, 0xF8, 0xF0, 0x4A, 0x11, 0x1A, 0x06, 0x02, 0x15, 0xE5, 0x19,
+    0x42, 0x00, 0xC0, 0xCA, 0x24, 0x60, 0x40, 0x5C, 0x18, 0x92, 0x02, 0xF2, 0xD2, 0x59, 0x26, 0x2A,
+    0x69, 0x4C, 0xBA, 0x28, 0x73, 0x7F, 0x31, 0x58, 0x35, 0x55, 0xF6, 0x7F, 0x8E, 0xBF, 0x01, 0x7D,
+    0x55, 0x31, 0x6F, 0xDE, 0x54, 0x14, 0x3D, 0xF6, 0x0B, 0x75, 0x55, 0x47, 0x98, 0xA1, 0x19, 0x50,
+    0x2B, 0xCC, 0xC0, 0x80, 0x44, 0xA9, 0x3B, 0x14, 0x94, 0x21, 0xA9, 0x5D, 0x55, 0xA2, 0x6B, 0x06,
+    0xE0, 0x17, 0x30, 0x20, 0x31, 0x90, 0xB1, 0x12, 0x69, 0x6D, 0xC4, 0x1F, 0xC8, 0xC4, 0xCC, 0x82,
+    0x04, 0x19, 0x48, 0x87, 0x0C, 0x0C, 0x10, 0x3F, 0x35, 0x3F, 0x00, 0x23, 0x21, 0xB1, 0x54, 0xC2,
+    0xD0, 0x4A, 0x08, 0x96, 0x58, 0xE8, 0x93, 0x6A, 0x22, 0xDB, 0x8F, 0x73, 0x9E, 0xBF, 0x26, 0x55,
+    0x05, 0x38, 0xF1, 0xE7, 0xE7, 0xF7, 0xEE, 0xBB, 0xF7, 0xDC, 0x73, 0xCF, 0x7D, 0xBE, 0x0B, 0x98,
+    0x47, 0x2D, 0x30, 0xE4, 0x40, 0x66, 0x16, 0x88, 0x9A, 0xAC, 0x42, 0x1F, 0x0C, 0xC8, 0x91, 0xD8,
+    0xB8, 0xC1, 0x18, 0xF4, 0x48, 0x5A, 0x2E, 0xD6, 0x89, 0x45, 0xF4, 0xD7, 0x02, 0x28, 0x0F, 0x81,
+    0xC8, 0x59, 0x0E, 0x06, 0x0D, 0x0A, 0x2E, 0x75, 0x7C, 0x01, 0x10, 0xFF, 0xCA, 0x19, 0xE4, 0x11,
+    0x5F, 0x4D, 0x9F, 0xD2, 0x22, 0xB5, 0x25, 0x2E, 0x62, 0x0A, 0x86, 0x70, 0x11, 0x75, 0x51, 0x97,
+    0x75, 0x79, 0x95, 0x3E, 0x70, 0x3F, 0x0E, 0x28, 0x33, 0xF7, 0x43, 0x1B, 0x4C, 0xCE, 0xD5, 0xF4,
+    0xE0, 0xDC, 0x02, 0xA9, 0x3B, 0xA6, 0xCB, 0x72, 0xC8, 0x47, 0x04, 0xCE, 0xBA, 0x0E, 0xF1, 0x18,
+    0xD2, 0x75, 0xD6, 0x44, 0x72, 0x49, 0x5C, 0x44, 0x95, 0xD9, 0xB8, 0x45, 0x30, 0x9A, 0x1E, 0x44,
+    0x34, 0x71, 0xBA, 0x2C, 0x19, 0xDC, 0xB8, 0x86, 0xC3, 0x8C, 0xC0, 0x10, 0x6A, 0x12, 0x65, 0xA7,
+    0x77, 0xE1, 0x8A, 0x9F, 0x70, 0x73, 0x38, 0x66, 0x34, 0x70, 0x37, 0x1D, 0x91, 0x35, 0x49, 0x87,
+    0x64, 0x81, 0xBA, 0x32, 0x03, 0xF8, 0x8F, 0xA4, 0x62, 0x92, 0x18, 0x10, 0x2C, 0xC0, 0x54, 0x99,
+    0xE4, 0xA1, 0x9E, 0xC4, 0xCF, 0xB5, 0x1C, 0x79, 0xC1, 0x34, 0x94, 0x4C, 0x66, 0x47, 0x20, 0x18,
+    0x32, 0x66, 0x94, 0x3C, 0x52, 0x20, 0xC2, 0xA6, 0x77, 0x1F, 0xB8, 0xF4, 0xF8, 0x14, 0x0D, 0xB9,
+    0x02, 0x9B, 0xD1, 0x63, 0xA0, 0xA9, 0x22, 0x89, 0x20, 0x2C, 0xE9, 0xCA, 0x9D, 0x78, 0x71, 0xBD,
+    0x96, 0x65, 0x14, 0x3F, 0x96, 0x25, 0x67, 0xDC, 0x20, 0x12, 0x96, 0x3F, 0xCA, 0x4D, 0x16, 0x95,
+    0x90, 0x73, 0x90, 0xCA, 0x69, 0x5D, 0x2D, 0x1D, 0xA7, 0x72, 0x59, 0xD3, 0x99, 0x51, 0xAA, 0xC9,
+    0xB4, 0xF7, 0x05, 0x33, 0x25, 0x7D, 0xB9, 0xA3, 0xDF, 0x72, 0xDE, 0x1F, 0x4F, 0x1E, 0x55, 0x30,
+    0xA9, 0x0A, 0xBC, 0xE9, 0x80, 0xBC, 0x21, 0x21, 0x5A, 0x26, 0x0B, 0x65, 0xC1, 0xCC, 0x54, 0xB0,
+    0x80, 0x2E, 0x73, 0x55, 0x54, 0x35, 0xE4, 0xB2, 0x2F, 0x5C, 0x37, 0x3F, 0xFD, 0x16, 0x5F, 0x42,
+    0x88, 0x7B, 0xBF, 0x25, 0xD7, 0x93, 0xF9, 0x64, 0x74, 0x7D, 0x4E, 0x70, 0x82, 0x06, 0x1B, 0x30,
+    0x16, 0x77, 0x10, 0x17, 0xE8, 0xF0, 0x0A, 0xC2, 0xE5, 0xC4, 0xB7, 0x48, 0x70, 0x36, 0x11, 0x55,
+    0x38, 0x98, 0x27, 0xAE, 0x6A, 0x71, 0x39, 0x21, 0x1E, 0x1B, 0x56, 0x9B, 0x00, 0xE2, 0xDE, 0xD7,
+    0xD8, 0xDF, 0xD1, 0x73, 0x78, 0xD3, 0x25, 0x66, 0x55, 0x31, 0x55, 0x3D, 0x79, 0xA7, 0xBD, 0x4A,
+    0x05, 0x95, 0x29, 0xEC, 0x9F, 0xC3, 0xDC, 0xCC, 0x5B, 0x98, 0x53, 0x2E, 0x22, 0xFA, 0x99, 0x3D,
+    0x0A, 0x30, 0x3C, 0x0E, 0x6D, 0xDB, 0xB4, 0x07, 0x57, 0xBB, 0x0D, 0xC5, 0x51, 0xF8, 0xCE, 0xB8,
+    0x2A, 0x19, 0x54, 0x38, 0x57, 0x48, 0x0F, 0xFE, 0xFA, 0x06, 0xD1, 0x42, 0x11, 0x6B, 0xD1, 0x47,
+    0x77, 0x25, 0x4B, 0x2F, 0xD7, 0x64, 0x60, 0x50, 0xA8, 0xB4, 0xC2, 0xF7, 0x7A, 0x12, 0xDC, 0x0D,
+    0x29, 0x27, 0xB2, 0xC8, 0x80, 0x0F, 0xFD, 0x5E, 0x92, 0x94, 0xF0, 0xDE, 0x20, 0x35, 0xC4, 0x12,
+    0xCF, 0xC3, 0x4B, 0x8E, 0xA5, 0x1D, 0x50, 0x8F, 0x5B, 0xD1, 0xA2, 0x43, 0x1E, 0x17, 0x61, 0xBF,
+    0xC1, 0xDD, 0x1D, 0xEE, 0x45, 0x55, 0xB8, 0xE0, 0xB0, 0xE1, 0xEC, 0xED, 0x0A, 0x6E, 0x93, 0x62,
+    0x38, 0xA9, 0x28, 0x83, 0x22, 0x76, 0x0E, 0x21, 0x99, 0x21, 0x5B, 0x78, 0x93, 0x7E, 0xEF, 0xE3,
+    0xEC, 0x5A, 0x93, 0xD6, 0x52, 0xD7, 0x4A, 0x56, 0x92, 0x54, 0xFD, 0x98, 0xB9, 0x13, 0x6A, 0xE8,
+    0xF5, 0xCC, 0x6B, 0x47, 0x3F, 0x81, 0x74, 0x23, 0x6C, 0x32, 0xC6, 0xE9, 0x34, 0xFC, 0xB4, 0x91,
+    0x72, 0x3D, 0x52, 0x5C, 0xA8, 0xF7, 0xBE, 0x82, 0xA4, 0xD3, 0x32, 0xA0, 0x93, 0x58, 0x53, 0xBF,
+    0xE7, 0xD0, 0x6F, 0xF7, 0x3C, 0x89, 0x3F, 0x64, 0xBD, 0x17, 0x9C, 0xD7, 0xB9, 0x73, 0x7F, 0xB0,
+    0x6E, 0xB2, 0x26, 0x4E, 0x37, 0x2D, 0x71, 0x31, 0xE3, 0x1D, 0xD4, 0xF5, 0x7E, 0x13, 0x49, 0x8C,
+    0x59, 0x33, 0xC1, 0xB4, 0x0C, 0x34, 0x60, 0x93, 0xB8, 0xE2, 0x26, 0xD0, 0xA1, 0x92, 0x36, 0x75,
+    0x15, 0x4A, 0xB0, 0xDC, 0x67, 0xF3, 0x63, 0x37, 0x06, 0xDD, 0x5A, 0x52, 0x9C, 0x07, 0xB6, 0x80,
+    0x77, 0xE9, 0xA2, 0x50, 0x87, 0x0F, 0xA2, 0xFA, 0x50, 0x85, 0xA6, 0xF0, 0xD2, 0x56, 0xFD, 0xE0,
+    0x6E, 0x33, 0x7C, 0x34, 0x4E, 0x3E, 0x3A, 0xE1, 0x04, 0x4A, 0x1F, 0x49, 0xEF, 0xE1, 0xF9, 0x5C,
+    0xBC, 0x94, 0x9C, 0x04, 0xED, 0x7E, 0x52, 0x86, 0xBE, 0x9A, 0x12, 0x2C, 0x62, 0x9F, 0x84, 0x5B,
+    0x91, 0x11, 0xB7, 0x99, 0x19, 0x71, 0x6E, 0x4F, 0xAD, 0x4A, 0x6F, 0xE5, 0x89, 0xF9, 0x77, 0x41,
+    0x3F, 0x7B, 0xFD, 0xBF, 0xA0, 0x7D, 0xF3, 0x09, 0x88, 0x78, 0x2C, 0x12, 0xCF, 0xF7, 0x45, 0x22,
+    0x17, 0x6D, 0xBE, 0x90, 0x24, 0xB6, 0xF0, 0xC7, 0xD3, 0xDF, 0xBE, 0x7C, 0xB4, 0xCE, 0x77, 0xCF,
+    0x0D, 0x08, 0x3B, 0xE8, 0x9C, 0xE5, 0x81, 0xD3, 0x92, 0x2E, 0x6E, 0xC5, 0xB4, 0x45, 0xE6, 0x42,
+    0x77, 0xB2, 0xDF, 0x7A, 0xAA, 0x21, 0x19, 0xB5, 0xA7, 0x90, 0x93, 0x39, 0x27, 0x2B, 0x1F, 0xE3,
+    0xB2, 0x7C, 0xC6, 0x0F, 0xCF, 0xB9, 0x93, 0xE2, 0x29, 0xD6, 0xB8, 0x89, 0x9B, 0x11, 0x3C, 0xFF,
+    0xB2, 0xA3, 0xC1, 0x0C, 0xB5, 0xE5, 0xC1, 0x91, 0xB5, 0xB8, 0x13, 0xE1, 0x13, 0xFB, 0xEA, 0x0D,
+    0xAC, 0xBE, 0x01, 0xF3, 0x62, 0x85, 0xA3, 0xFB, 0xD8, 0xFD, 0xA5, 0xD9, 0x7E, 0x6D, 0x6B, 0xDB,
+    0xDC, 0x3C, 0x40, 0xB6, 0xEB, 0x37, 0x3E, 0x34, 0x3F, 0xDB, 0xF6, 0xCA, 0x65, 0xF3, 0xA0, 0x5A,
+    0xBF, 0x1E, 0xDF, 0xFA, 0x7C, 0xC1, 0xAE, 0x9F, 0xB6, 0x55, 0xA5, 0x15, 0xC4, 0x40, 0x4B, 0x68,
+    0x19, 0x8B, 0x63, 0x16, 0x6C, 0xA4, 0x7B, 0xFC, 0x4B, 0x9A, 0xC8, 0xCF, 0x59, 0x0A, 0x26, 0xB7,
+    0x04, 0x57, 0x5A, 0x9E, 0xB4, 0x75, 0x91, 0xB6, 0xF8, 0x0E, 0x59, 0x81, 0x06, 0x57, 0xE4, 0xF6,
+    0x25, 0xE4, 0x5F, 0x6F, 0x09, 0xF1, 0x47, 0x4E, 0x67, 0xE7, 0xE0, 0x1B, 0x9C, 0x79, 0xCB, 0x44,
+    0x3D, 0xBC, 0x26, 0x69, 0x3D, 0xE1, 0x7A, 0x4D, 0x75, 0xE0, 0x52, 0x8B, 0x75, 0x53, 0xE4, 0xED,
+    0xB5, 0xB7, 0x57, 0xCF, 0xBF, 0xFC, 0x4E, 0xB8, 0x5A, 0xE3, 0xE8, 0x2D, 0xBB, 0xFD, 0xF0, 0xDA,
+    0xF5, 0xEC, 0xF2, 0xBA, 0xF9, 0xF4, 0x40, 0xA9, 0xA8, 0xFA, 0xEE, 0xB7, 0xBD, 0x2F, 0xE7, 0x8C,
+    0x3F, 0x66, 0x4F, 0x52, 0x5A, 0x93, 0xE9, 0x92, 0xC6, 0x34, 0x77, 0x91, 0x7C, 0xD6, 0x61, 0x33,
+    0xB1, 0x61, 0x57, 0xB2, 0x67, 0xA7, 0x70, 0xA0, 0xF0, 0x1A, 0x43, 0x8E, 0x8C, 0xAB, 0x9E, 0x4A,
+    0xB6, 0x58, 0x36, 0x8A, 0x84, 0xB4, 0x39, 0x77, 0xCA, 0xDE, 0xFE, 0x9F, 0xBB, 0xB9, 0x24, 0x1A,
+    0x3E, 0xBB, 0xC0, 0x0E, 0xC7, 0x0B, 0xC5, 0x99, 0x0C, 0xDE, 0xDF, 0x1B, 0xA4, 0x61, 0xBC, 0xB7,
+    0x35, 0xBF, 0x67, 0x6D, 0x78, 0xAB, 0xC2, 0xEB, 0x30, 0x92, 0xCD, 0x0E, 0xCD, 0xD3, 0xCA, 0x38,
+    0xAB, 0x8F, 0x43, 0x5D, 0x60, 0x15, 0xB0, 0x5C, 0x1B, 0xD5, 0xC7, 0x34, 0xD8, 0x5E, 0x49, 0xB9,
+    0x26, 0xF8, 0x1F, 0x44, 0x76, 0xD3, 0xB4, 0x59, 0xA0, 0x63, 0xAF, 0x21, 0x0B, 0x61, 0x37, 0x7F,
+    0x8F, 0x48, 0x46, 0x2E, 0x62, 0xFC, 0x51, 0x93, 0xE8, 0xCB, 0xA4, 0x73, 0xC7, 0x86, 0xFE, 0x1C,
+    0x9A, 0x74, 0x4C, 0x96, 0x15, 0xBF, 0x0E, 0x79, 0x17, 0x3A, 0x89, 0xDA, 0x59, 0xF5, 0x61, 0x6B,
+    0x8E, 0x09, 0x3B, 0xF8, 0xDD, 0x8D, 0x03, 0xBA, 0xB2, 0x2F, 0x67, 0xE1, 0x7A, 0xD1, 0x5D, 0xC0,
+    0x7F, 0x5E, 0xFF, 0x00, 0xA5, 0x54, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0xA0, 0x18, 0x30,
+    0x61, 0x28, 0x42, 0x03, 0x22, 0x6E, 0x11, 0x81, 0x75, 0x93, 0x22, 0x48, 0x6F, 0xD7, 0x56, 0x1A,
+    0x4A, 0x52, 0xD0, 0xE5, 0x23, 0xA0, 0xA0, 0x48, 0xB1, 0xC9, 0xB3, 0x44, 0xC9, 0x4F, 0x50, 0xA4,
+    0xA2, 0xD9, 0x2D, 0x52, 0x6C, 0xB1, 0xDA, 0x37, 0x28, 0x05, 0xAD, 0xA5, 0xFC, 0x80, 0x0B, 0x2A,
+    0x1A, 0x2C, 0xC5, 0xC5, 0x13, 0xF2, 0x7B, 0xC3, 0x39, 0x77, 0xFC, 0xB2, 0x5B, 0x00, 0x12, 0x62,
+    0x34, 0x3A, 0xF2, 0xD8, 0x9E, 0x3B, 0xE7, 0xDC, 0x73, 0xEF, 0x00, 0xD9, 0xA3, 0x3B, 0xC0, 0xBA,
+    0x3F, 0x46, 0x1E, 0xC3, 0x0A, 0x65, 0x0C, 0xA7, 0xF0, 0xB1, 0xBD, 0x40, 0x1D, 0x31, 0x09, 0x46,
+    0xD4, 0xBB, 0x8C, 0x30, 0xE7, 0x03, 0xFC, 0xEC, 0x7A, 0xB8, 0xC9, 0x05, 0x94, 0x63, 0x11, 0xE0,
+    0xC7, 0xB2, 0x43, 0xD5, 0xFB, 0x16, 0x4D, 0xF0, 0x0C, 0x12, 0x2A, 0x20, 0xB6, 0x47, 0xC8, 0x22,
+    0x8E, 0xE1, 0xF6, 0x58, 0xC1, 0xED, 0x70, 0x8A, 0x72, 0xC6, 0x05, 0xFC, 0x56, 0xE1, 0x26, 0x86,
+    0x6B, 0x46, 0x86, 0x2B, 0x87, 0x7D, 0xF5, 0x6A, 0xB7, 0x0E, 0x59, 0xEB, 0xF0, 0x36, 0xFC, 0x80,
+    0xFB, 0xB8, 0x7F, 0x6F, 0xD8, 0x74, 0xB8, 0x83, 0x39, 0x7B, 0xC2, 0xD5, 0x77, 0x18, 0xD0, 0x67,
+    0xC1, 0x85, 0x66, 0x5E, 0x6F, 0x01, 0x54, 0x53, 0xF9, 0xF0, 0x97, 0xF0, 0xDE, 0xE7, 0xD9, 0xCB,
+    0xEE, 0xC1, 0xF1, 0xE3, 0x87, 0xB1, 0x2F, 0x07, 0x7C, 0x80, 0xB7, 0x80, 0x07, 0x28, 0x5A, 0xD4,
+    0xAD, 0x1B, 0x50, 0x0C, 0xD8, 0x81, 0xB3, 0xEE, 0x38, 0xDD, 0xA8, 0xF5, 0x4C, 0x8E, 0x39, 0xDF,
+    0x0C, 0xC5, 0x16, 0xEB, 0xCE, 0x8F, 0x88, 0xA8, 0x03, 0x2E, 0x51, 0xB5, 0x3C, 0xE2, 0x7D, 0x30,
+    0xC2, 0x9B, 0x51, 0x75, 0xC2, 0x4D, 0x2B, 0xFC, 0xD1, 0xDE, 0x50, 0x12, 0x9E, 0xE0, 0x2E, 0x71,
+    0xC4, 0x17, 0x00, 0x55, 0xAF, 0xEC, 0x25, 0x91, 0xCB, 0x0B, 0xE0, 0x05, 0xA8, 0x89, 0x69, 0xE1,
+    0x77, 0x66, 0xE3, 0xDE, 0x9F, 0x1D, 0xF5, 0xAF, 0x63, 0xC7, 0xEF, 0x9B, 0xD8, 0x4E, 0xE8, 0xB9,
+    0x67, 0xE0, 0x2E, 0x94, 0x9D, 0x27, 0xD6, 0x38, 0x21, 0x5E, 0xE2, 0x75, 0x87, 0x6C, 0x74, 0xBF,
+    0xB6, 0x28, 0x7A, 0x5F, 0xB6, 0xF0, 0xDD, 0x8A, 0x31, 0x4F, 0x10, 0xE3, 0x48, 0xBA, 0x31, 0x0E,
+    0x64, 0xCE, 0x65, 0xC9, 0x7F, 0x9F, 0x52, 0x97, 0x76, 0x7C, 0x48, 0x0A, 0x33, 0xF0, 0x71, 0x10,
+    0xAB, 0x7A, 0x10, 0xBE, 0x73, 0x6E, 0x14, 0x79, 0x54, 0x36, 0x48, 0x08, 0x91, 0xB1, 0x48, 0x44,
+    0xE7, 0x8D, 0x87, 0x99, 0x38, 0x1E, 0xDB, 0x83, 0x37, 0x3C, 0xFB, 0x1D, 0xA7, 0x1F, 0xB5, 0x24,
+    0xF9, 0x34, 0xCE, 0x75, 0xEC, 0x57, 0xDF, 0xEB, 0x9C, 0x63, 0xFB, 0xF9, 0xC4, 0xC2, 0x1D, 0xD9,
+    0xAC, 0x99, 0x8F, 0x84, 0xAD, 0x3D, 0x74, 0x7A, 0xD8, 0x88, 0x6C, 0x16, 0x13, 0x32, 0x60, 0x20,
+    0xDB, 0x40, 0x5C, 0xC7, 0x81, 0x51, 0x3E, 0xFB, 0xF9, 0xF9, 0x21, 0x95, 0xDF, 0xFE, 0x26, 0xFC,
+    0xF2, 0xB1, 0xE5, 0x12, 0x3F, 0x19, 0x7E, 0x2A, 0xA7, 0x70, 0xDB, 0xCE, 0xA8, 0x84, 0xE5, 0x4E,
+    0x98, 0x9F, 0xB5, 0x4A, 0x26, 0xF3, 0xC8, 0x53, 0xF9, 0x74, 0xD7, 0xF2, 0x5E, 0xC9, 0x0F, 0x55,
+    0x53, 0x13, 0x55, 0x58, 0x24, 0xEA, 0xDB, 0xDB, 0xB7, 0xAE, 0x5A, 0xDF, 0xC9, 0x93, 0x94, 0xCE,
+    0x32, 0xF8, 0x73, 0x43, 0x86, 0x2D, 0x82, 0xFF, 0x04, 0x4B, 0x3E, 0xDD, 0xE0, 0x99, 0x03, 0x62,
+    0x8C, 0x70, 0xA3, 0x8B, 0xB1, 0xCB, 0x4D, 0x9C, 0xB0, 0x6A, 0xF3, 0x49, 0x7B, 0xF0, 0x0D, 0xAD,
+    0x19, 0x2D, 0x9B, 0x42, 0x4A, 0x82, 0x9B, 0x75, 0xB2, 0x72, 0xDB, 0xE0, 0xE6, 0xC8, 0xF8, 0x2D,
+    0xDB, 0xEB, 0x9B, 0xFE, 0x6C, 0xC2, 0xB2, 0x2A, 0x19, 0x87, 0x05, 0xCF, 0x87, 0xA8, 0x00, 0xDC,
+    0xE7, 0x55, 0xA5, 0xF1, 0x10, 0x44, 0xFF, 0x14, 0xB6, 0x43, 0xFB, 0x15, 0xBB, 0x1C, 0x96, 0x95,
+    0x8A, 0x14, 0x6E, 0x8B, 0x1C, 0xE5, 0x16, 0xCF, 0xE0, 0xF7, 0x67, 0x23, 0xAA, 0xC8, 0x0D, 0xB7,
+    0x62, 0xF7, 0xE6, 0x58, 0x67, 0x2E, 0x17, 0x86, 0xA5, 0x31, 0xB5, 0xF3, 0x81, 0x47, 0xF8, 0xBB,
+    0xB1, 0xB7, 0xFF, 0xC4, 0x80, 0xED, 0xA5, 0xED, 0x51, 0xB5, 0x52, 0x6D, 0xF4, 0x62, 0x36, 0x65,
+    0xAF, 0x8C, 0xB0, 0x57, 0x4D, 0x8E, 0x62, 0x51, 0x77, 0x57, 0x22, 0x96, 0x73, 0x8F, 0xEF, 0x75,
+    0xC2, 0x46, 0x9D, 0x41, 0xCA, 0x6B, 0x86, 0xE8, 0xC8, 0x38, 0x9F, 0x51, 0x4C, 0xFC, 0xA6, 0x19,
+    0x39, 0xBA, 0x92, 0xB0, 0xA7, 0x23, 0x31, 0x6E, 0x9D, 0x5E, 0x8C, 0xD5, 0xA0, 0x84, 0x98, 0x7E,
+    0x1D, 0xED, 0x66, 0xE5, 0xA3, 0x9A, 0x8C, 0x50, 0x69, 0xDE, 0x17, 0x26, 0xA8, 0xB0, 0xBA, 0xE5,
+    0xCD, 0x81, 0x43, 0xD6, 0xB3, 0xE7, 0xF8, 0x8F, 0xA3, 0xE9, 0xAE, 0x6B, 0xDF, 0xCF, 0x86, 0xD1,
+    0x62, 0xFF, 0xA1, 0xE0, 0xEE, 0xB5, 0x89, 0x9E, 0x94, 0xD9, 0x6C, 0xB6, 0x24, 0xCF, 0x92, 0x8A,
+    0x2B, 0xE9, 0xA3, 0xA4, 0x2B, 0xCB, 0x7D, 0xAD, 0x2E, 0x0C, 0x12, 0x5B, 0x05, 0x79, 0x42, 0xA7,
+    0xD6, 0x96, 0xDE, 0x4A, 0xB7, 0x9A, 0x4D, 0xD3, 0x98, 0x9B, 0x5E, 0x53, 0x3D, 0x18, 0xCE, 0xBC,
+    0x3C, 0x64, 0xAE, 0xEC, 0x6F, 0x82, 0x58, 0xF8, 0xB1, 0x62, 0x98, 0x62, 0x67, 0xE4, 0x5E, 0x24,
+    0x8A, 0x26, 0xB9, 0x36, 0xFD, 0x55, 0xD9, 0x59, 0x21, 0x9F, 0x12, 0xDF, 0x45, 0x76, 0xC3, 0x57,
+    0xF3, 0x28, 0x37, 0xBF, 0x60, 0x26, 0x21, 0x5A, 0x4A, 0x9E, 0x99, 0xA8, 0xC6, 0x8A, 0xAF, 0xF9,
+    0x5A, 0xDC, 0xAB, 0x97, 0x0A, 0xE5, 0xC3, 0xCE, 0x8A, 0x87, 0x2D, 0x48, 0x77, 0x54, 0x44, 0x6E,
+    0xA2, 0x35, 0xB2, 0x67, 0x63, 0x95, 0x55, 0x05, 0xD9, 0x5F, 0x98, 0x83, 0xD9, 0xCE, 0x68, 0x68,
+    0x1A, 0xF7, 0x5A, 0x66, 0x31, 0x53, 0x12, 0x25, 0x8C, 0xA1, 0x90, 0xDF, 0xA3, 0x8A, 0xDD, 0xCD,
+    0xC6, 0x22, 0xAA, 0x95, 0x79, 0xFF, 0xEB, 0xDC, 0xCB, 0x5C, 0x84, 0x4E, 0xC6, 0x95, 0x12, 0xFB,
+    0xC3, 0x57, 0xD2, 0x73, 0x7E, 0x34, 0x9A, 0x90, 0xDD, 0x3F, 0x19, 0x93, 0x94, 0x24, 0x63, 0x5C,
+    0xC4, 0xB5, 0xA0, 0x54, 0x7C, 0xC9, 0x19, 0xEC, 0x2C, 0x39, 0x49, 0x51, 0xAA, 0xBF, 0xC5, 0x9A,
+    0x2A, 0x48, 0x58, 0x92, 0x94, 0x4A, 0x70, 0xF1, 0x86, 0x89, 0x92, 0xB2, 0xA4, 0x29, 0x55, 0x61,
+    0x32, 0x87, 0x77, 0xAB, 0xA4, 0x25, 0x51, 0xA9, 0x10, 0x17, 0x77, 0xD4, 0x21, 0xBC, 0xEE, 0x4D,
+    0x15, 0xAE, 0x6B, 0xD1, 0x8D, 0xD6, 0x88, 0x75, 0x90, 0x7B, 0xD4, 0x6B, 0xED, 0xBB, 0xB5, 0x66,
+    0x69, 0xFA, 0xA6, 0xFF, 0x77, 0x61, 0xA9, 0xA7, 0x52, 0x53, 0x2D, 0x5D, 0xB5, 0x28, 0x4B, 0x7D,
+    0xB5, 0x34, 0x56, 0xEA, 0xAC, 0x83, 0x34, 0xEB, 0xAD, 0xA5, 0xB9, 0x96, 0xEE, 0x5A, 0xB4, 0xA5,
+    0xFE, 0x4A, 0x0D, 0xB6, 0x74, 0xD8, 0x22, 0x2E, 0xF5, 0x18, 0x52, 0x93, 0xA5, 0x2E, 0x3B, 0xA8,
+    0x4B, 0x7D, 0x66, 0x77, 0x4B, 0x44, 0xEA, 0xB4, 0x1B, 0xF2, 0xFE, 0xDF, 0xF8, 0x0B, 0xCD, 0x55,
+    0x3B, 0x8E, 0xD4, 0x40, 0x10, 0x2D, 0xDB, 0x42, 0x96, 0x68, 0x90, 0x09, 0xD8, 0x00, 0xF1, 0x19,
+    0x2E, 0x00, 0x26, 0x20, 0xD8, 0x08, 0xFB, 0x08, 0x04, 0x3B, 0x04, 0x7B, 0x03, 0x48, 0xF6, 0x02,
+    0x20, 0xFB, 0x08, 0x9B, 0x90, 0x13, 0x22, 0x12, 0x4E, 0x00, 0x36, 0x37, 0x70, 0x42, 0x8C, 0x03,
+    0x02, 0x44, 0x82, 0x83, 0x09, 0xBC, 0x92, 0x67, 0x9A, 0x7A, 0xAF, 0xDA, 0x63, 0x60, 0x17, 0x04,
+    0x19, 0xAD, 0x99, 0x9A, 0x56, 0xDB, 0x5D, 0xF5, 0xDE, 0xAB, 0xCF, 0x88, 0x88, 0xC4, 0x83, 0x1A,
+    0xB9, 0x7A, 0x0B, 0xF6, 0xE1, 0x15, 0xDA, 0x43, 0xD8, 0x9C, 0xE7, 0xAE, 0x96, 0x3F, 0xAC, 0x1D,
+    0x4C, 0x4C, 0x9B, 0x78, 0xD8, 0x8C, 0x76, 0xD5, 0xC0, 0x16, 0x05, 0xEC, 0xB6, 0x28, 0x45, 0xA2,
+    0x09, 0x36, 0x19, 0x60, 0x5D, 0x9F, 0xAB, 0xCF, 0x55, 0x0B, 0x5B, 0x94, 0x79, 0x2B, 0xD2, 0x88,
+    0xDA, 0x68, 0xD2, 0x33, 0x49, 0x46, 0x58, 0x37, 0xC8, 0xAA, 0x93, 0x8C, 0x9F, 0xC2, 0x7B, 0xDF,
+    0x4B, 0x43, 0xEB, 0x61, 0x13, 0xD8, 0x21, 0x1D, 0x35, 0xD8, 0x90, 0x0D, 0xB0, 0x79, 0x0F, 0x5B,
+    0xA9, 0xA7, 0xD5, 0x66, 0x46, 0x76, 0x50, 0x12, 0x88, 0xBE, 0x3A, 0x19, 0x3A, 0x5D, 0x2D, 0x76,
+    0xD8, 0x7C, 0x26, 0x3C, 0xDF, 0xD9, 0xAB, 0xEE, 0xDB, 0x64, 0x9B, 0xE8, 0xCC, 0x07, 0xB6, 0xD5,
+    0xEC, 0x28, 0xFB, 0xE0, 0x6D, 0x93, 0x6C, 0x56, 0xBD, 0xED, 0xB6, 0xF1, 0x6E, 0xFD, 0x94, 0x02,
+    0xD5, 0xB9, 0xF9, 0x4C, 0x87, 0xD8, 0xC2, 0x28, 0x07, 0x85, 0x0B, 0x1F, 0x45, 0x99, 0x98, 0xD3,
+    0xAC, 0x97, 0x8A, 0x4E, 0xE3, 0x51, 0xB2, 0x91, 0x47, 0xCD, 0xD7, 0x37, 0x16, 0x07, 0xE8, 0xC6,
+    0x3D, 0xBA, 0x7A, 0x46, 0xA7, 0x4B, 0x1D, 0xB4, 0x92, 0x92, 0xB3, 0x53, 0x24, 0xCA, 0x7E, 0x27,
+    0x91, 0x87, 0xBC, 0x38, 0x02, 0x53, 0x8F, 0xA3, 0x8B, 0xD6, 0x4D, 0x7F, 0xAA, 0x40, 0xE8, 0x38,
+    0x25, 0x2A, 0xE7, 0x5F, 0x1E, 0xEB, 0x4D, 0xBE, 0x9D, 0x4D, 0x8B, 0x75, 0x0C, 0x9D, 0x9A, 0x3C,
+    0xB4, 0x91, 0x79, 0x34, 0xC6, 0x86, 0x3A, 0xA7, 0x46, 0x19, 0xD5, 0x48, 0xF8, 0x38, 0x32, 0x19,
+    0x2B, 0xBD, 0x71, 0x4D, 0x19, 0x9C, 0x3D, 0x99, 0x08, 0x74, 0x67, 0xD8, 0x4B, 0xC9, 0x29, 0x34,
+    0x18, 0x69, 0x6E, 0x2A, 0xE2, 0x88, 0x1A, 0xFF, 0x05, 0x77, 0x1E, 0xD0, 0xF1, 0xDD, 0x59, 0x17,
+    0x96, 0x9D, 0x89, 0xCB, 0x64, 0xBD, 0x65, 0xC4, 0x26, 0xA4, 0x80, 0xE8, 0x22, 0xE2, 0x8A, 0x7F,
+    0xC0, 0x28, 0xD7, 0x7F, 0x25, 0x1C, 0x1D, 0x49, 0xCC, 0x68, 0x19, 0xE3, 0x17, 0x08, 0x19, 0x6D,
+    0x19, 0x83, 0xE0, 0x8B, 0xC5, 0x91, 0x63, 0x50, 0x14, 0xA1, 0xBE, 0xB1, 0x7E, 0x0D, 0x6D, 0x80,
+    0xD2, 0x72, 0xE6, 0xBD, 0x5E, 0x4A, 0xC9, 0xB4, 0x20, 0x06, 0xFA, 0x48, 0xD9, 0x05, 0x79, 0xBB,
+    0xAF, 0x76, 0x90, 0xED, 0xC8, 0xB2, 0x04, 0xE3, 0x2D, 0xA9, 0x6E, 0x02, 0x6D, 0x86, 0x3A, 0x65,
+    0x6C, 0xEE, 0x37, 0x4B, 0x0B, 0x3D, 0x27, 0x87, 0x5E, 0xFE, 0x65, 0xAD, 0x4D, 0x4E, 0x4A, 0xBB,
+    0x61, 0xA0, 0x1A, 0x8D, 0x31, 0x63, 0x4B, 0x88, 0x6D, 0xC5, 0xB0, 0xEF, 0xAD, 0x48, 0x79, 0xF0,
+    0xF1, 0xB8, 0x66, 0xCD, 0xB0, 0xB0, 0x46, 0x56, 0x8D, 0x5E, 0xAA, 0x40, 0x3B, 0x19, 0x17, 0x61,
+    0xAA, 0x45, 0x5B, 0xCB, 0x46, 0x05, 0x3A, 0x31, 0x63, 0x65, 0x64, 0x89, 0xDE, 0x2B, 0xE3, 0xB9,
+    0x87, 0xE4, 0x06, 0x2D, 0xF7, 0x29, 0x01, 0x3C, 0x7A, 0x01, 0x97, 0xDD, 0x7D, 0xB5, 0xF7, 0xC4,
+    0x2D, 0xB8, 0x0F, 0xFE, 0xAF, 0x94, 0x4C, 0xC0, 0x1C, 0x4D, 0xA0, 0x9A, 0x4C, 0x28, 0xA3, 0x74,
+    0x42, 0xF1, 0x67, 0x63, 0x68, 0xC8, 0x73, 0xEB, 0xE0, 0x71, 0xC0, 0x9F, 0xD0, 0xB3, 0x09, 0x6F,
+    0x38, 0x8C, 0x40, 0xD6, 0x2E, 0xCA, 0xE7, 0xF5, 0x9E, 0x81, 0x54, 0xEB, 0x67, 0x12, 0xA4, 0x17,
+    0x6B, 0x50, 0x52, 0x30, 0xEE, 0xA6, 0xBD, 0xE5, 0xC8, 0x38, 0xB8, 0x61, 0x11, 0x7F, 0xB5, 0xEF,
+    0x9E, 0xD2, 0x74, 0x0F, 0xB6, 0x61, 0x01, 0xC8, 0x25, 0xFD, 0xBE, 0x33, 0x1F, 0x78, 0xFF, 0xE4,
+    0x82, 0xB1, 0x8C, 0x67, 0x18, 0x1B, 0xFA, 0xD3, 0x94, 0xF4, 0xED, 0x89, 0x17, 0x42, 0xE7, 0xAD,
+    0x3D, 0x5E, 0xCE, 0x7B, 0xB6, 0xBB, 0xF6, 0x37, 0x04, 0xD1, 0x6B, 0x50, 0x44, 0xC3, 0x69, 0xAB,
+    0xC7, 0x18, 0x3F, 0x83, 0xA4, 0xFA, 0xF8, 0xC4, 0xEA, 0xF5, 0x32, 0x50, 0x96, 0x56, 0xC9, 0x69,
+    0x8B, 0x94, 0xCF, 0xC5, 0xF7, 0x37, 0x0B, 0x78, 0x11, 0x84, 0xE3, 0x45, 0x91, 0x31, 0x75, 0x98,
+    0xDC, 0x90, 0x82, 0x55, 0xD0, 0x84, 0x04, 0x43, 0x5C, 0xE0, 0x63, 0xAB, 0xEF, 0xC2, 0x10, 0xC2,
+    0x08, 0xCA, 0xC2, 0x21, 0xFF, 0x6A, 0x14, 0xA5, 0x14, 0x9D, 0xFD, 0x41, 0x61, 0x94, 0x01, 0x68,
+    0x64, 0x63, 0xE3, 0x95, 0xEE, 0xD4, 0x69, 0xA2, 0x7A, 0xBB, 0x4F, 0xB5, 0xDC, 0x89, 0x06, 0x39,
+    0x94, 0xDB, 0xE7, 0x54, 0x62, 0x0D, 0xE8, 0x2F, 0x66, 0xAB, 0x1B, 0xCC, 0x3D, 0x62, 0x23, 0xA1,
+    0x00, 0x57, 0xD4, 0x96, 0xD0, 0x26, 0x4C, 0xC3, 0x9D, 0x81, 0x8F, 0xB7, 0x76, 0x15, 0x5F, 0x16,
+    0xD0, 0xC6, 0xBE, 0x00, 0x52, 0x60, 0xDA, 0xF5, 0x41, 0x31, 0xD7, 0xB9, 0x4E, 0x6B, 0x75, 0xAB,
+    0xD8, 0xF3, 0x96, 0x25, 0xD7, 0xB4, 0x4D, 0xFB, 0x1B, 0x79, 0x58, 0x16, 0x9A, 0x00, 0x22, 0xA2,
+    0x3E, 0x2C, 0x0B, 0x1F, 0x8A, 0x8D, 0x02, 0x01, 0x94, 0xBD, 0xF7, 0xD3, 0xE3, 0x3E, 0x88, 0x0A,
+    0x89, 0xA8, 0x19, 0xDC, 0x70, 0xAE, 0x43, 0x23, 0x40, 0x43, 0x2E, 0x89, 0x0D, 0x22, 0xCD, 0xE9,
+    0x5C, 0xD6, 0x77, 0xED, 0x54, 0x31, 0x8E, 0xD5, 0x30, 0x10, 0x7D, 0x49, 0x04, 0x29, 0x2C, 0xE1,
+    0x0A, 0x44, 0x03, 0xB9, 0xC0, 0xA2, 0x5C, 0x60, 0x51, 0x22, 0x4E, 0xF0, 0x1B, 0x2A, 0x0A, 0x8E,
+    0xC0, 0x05, 0x90, 0x12, 0x69, 0xFB, 0x3D, 0x05, 0xC5, 0x76, 0xEC, 0x01, 0x56, 0x8A, 0xA5, 0x5F,
+    0x50, 0x92, 0x8E, 0x36, 0x3D, 0x4D, 0x90, 0x5C, 0x64, 0x25, 0xFF, 0x0C, 0x6F, 0xC6, 0x42, 0x42,
+    0x48, 0x4B, 0xCD, 0xAE, 0x98, 0xC2, 0xEF, 0xDB, 0xDF, 0x9E, 0xF7, 0xDE, 0x8C, 0x63, 0x40, 0xE4,
+    0x13, 0x80, 0x46, 0x64, 0x03, 0x4A, 0x11, 0x59, 0x81, 0x8E, 0x10, 0x50, 0xAF, 0x5C, 0x05, 0x26,
+    0xA0, 0x8D, 0xF0, 0x0B, 0x7F, 0x8D, 0x38, 0x01, 0x55, 0x42, 0x13, 0xB8, 0x27, 0x94, 0xC9, 0x26,
+    0xDD, 0xC8, 0xC9, 0x51, 0x64, 0xE7, 0x64, 0x12, 0x99, 0xD1, 0x7D, 0x15, 0x49, 0xA8, 0x13, 0x76,
+    0xE8, 0x19, 0x3F, 0x03, 0x3E, 0x16, 0xBA, 0x59, 0xD0, 0x8E, 0xE4, 0x58, 0xAA, 0xDB, 0xB7, 0xEF,
+    0xB8, 0x65, 0x20, 0x8D, 0xF4, 0x4E, 0xC7, 0x05, 0x3A, 0x6E, 0xF0, 0xA2, 0x67, 0x0B, 0x8E, 0x64,
+    0x6A, 0xB3, 0x34, 0x8D, 0x43, 0xD1, 0x43, 0xD9, 0x2A, 0x05, 0x77, 0x59, 0xEB, 0x9A, 0xAF, 0xBD,
+    0xC2, 0xCB, 0xEA, 0xA4, 0xF0, 0x02, 0xBF, 0xF6, 0xE6, 0x28, 0xAE, 0x80, 0xA7, 0xBD, 0x0A, 0xC4,
+    0x14, 0x50, 0xD1, 0x9C, 0x5A, 0x8A, 0xCC, 0x1D, 0xE0, 0x57, 0x6A, 0x99, 0xD5, 0x53, 0x45, 0xE6,
+    0x76, 0x86, 0xA3, 0xEB, 0x8E, 0xEB, 0x0A, 0x23, 0xFC, 0xF7, 0x88, 0xA9, 0x47, 0xFB, 0x6D, 0x03,
+    0xFD, 0x77, 0x5F, 0xB6, 0x82, 0x4E, 0x86, 0x63, 0x2A, 0x49, 0x34, 0x5D, 0x24, 0x4D, 0x29, 0x6F,
+    0x4E, 0xF5, 0xC6, 0x5C, 0xC5, 0xEE, 0x22, 0x1D, 0x41, 0x34, 0xE5, 0x0E, 0x69, 0x16, 0xD4, 0x27,
+    0x88, 0xA6, 0x4C, 0x98, 0x06, 0xA6, 0x54, 0x9B, 0x01, 0xCD, 0xC6, 0xA2, 0xF6, 0xE8, 0x22, 0x81,
+    0x29, 0x57, 0x7A, 0x63, 0x2E, 0x82, 0x69, 0xC7, 0xA3, 0xAC, 0xD9, 0x07, 0x83, 0x6A, 0xCD, 0x0E,
+    0xF2, 0x7F, 0xF8, 0xDC, 0xE3, 0xAE, 0xF8, 0x20, 0xA3, 0xD6, 0xC3, 0x7A, 0x47, 0x9E, 0x89, 0x49,
+    0x0B, 0x99, 0x4B, 0xAE, 0xD6, 0xBB, 0xF9, 0xF6, 0x91, 0x6C, 0x6C, 0x09, 0xBB, 0xD7, 0x2E, 0x18,
+    0xB8, 0x9B, 0x0A, 0x45, 0xA9, 0x16, 0x4B, 0xEF, 0x67, 0x75, 0xA3, 0x10, 0xF5, 0x12, 0x84, 0x5A,
+    0xA9, 0xDB, 0xE0, 0x14, 0xBA, 0x5E, 0x9B, 0x8E, 0xC1, 0x7A, 0xCF, 0x43, 0xB4, 0x08, 0xD6, 0xDA,
+    0x93, 0xAB, 0x49, 0xAC, 0xD5, 0xE1, 0x99, 0x44, 0x6B, 0x18, 0xAB, 0x66, 0x4D, 0x64, 0x99, 0xAD,
+    0xA3, 0x76, 0x8D, 0x92, 0x29, 0x12, 0x3D, 0xFA, 0x58, 0x6E, 0xFF, 0xD0, 0xFD, 0x3C, 0xC3, 0xC7,
+    0x0C, 0xD9, 0x6E, 0xB5, 0x18, 0xB8, 0x5C, 0x83, 0xE6, 0x6E, 0xD3, 0x7F, 0x8B, 0xFB, 0x59, 0x90,
+    0x62, 0xFC, 0xBD, 0xEF, 0x75, 0xCA, 0x97, 0xE1, 0xBD, 0x95, 0xE0, 0x75, 0x69, 0x75, 0xB9, 0xC6,
+    0xF9, 0xFD, 0xEF, 0xFB, 0xA1, 0x30, 0x7F, 0x9B, 0x7D, 0xB7, 0xFE, 0xD5, 0x13, 0x85, 0x33, 0x7F,
+    0xA3, 0x70, 0x6E, 0x42, 0x1E, 0x52, 0x53, 0x9B, 0xA0, 0xCF, 0x24, 0x69, 0x3A, 0x85, 0x2E, 0xA8,
+    0x2C, 0x3E, 0x87, 0xE6, 0x45, 0x7A, 0xE9, 0x1F, 0x90, 0xDB, 0x72, 0x75, 0xC1, 0x1F, 0xA9, 0x65,
+    0x43, 0x49, 0x8D, 0x54, 0xD6, 0xC8, 0xE8, 0x7E, 0xF0, 0x89, 0x74, 0x11, 0xFF, 0xE3, 0x5F, 0x8E,
+    0x9F, 0xC5, 0x55, 0xB1, 0x8E, 0xD4, 0x30, 0x10, 0x1D, 0xDB, 0xD2, 0xA6, 0x48, 0x91, 0x8E, 0x86,
+    0xC2, 0x2D, 0x15, 0xF9, 0x02, 0x36, 0xE9, 0x68, 0x69, 0xEE, 0x0F, 0x68, 0x11, 0x14, 0x94, 0x07,
+    0x1B, 0xE9, 0x3E, 0x80, 0xFD, 0x0D, 0xA8, 0x28, 0x29, 0x40, 0x8E, 0x44, 0x0F, 0xFB, 0x09, 0xF9,
+    0x84, 0x08, 0xF9, 0xA4, 0x20, 0x25, 0x1E, 0x66, 0xEC, 0xB3, 0xE3, 0x83, 0x3D, 0x56, 0x8B, 0x10,
+    0xB8, 0x88, 0xBC, 0xC9, 0x4C, 0xFC, 0xDE, 0x9B, 0x97, 0xB7, 0x00, 0xC7, 0xD7, 0xB3, 0x6C, 0xDF,
+    0x74, 0xEB, 0xBE, 0x1A, 0xD6, 0xBD, 0x9A, 0xB2, 0x22, 0x77, 0x57, 0xC3, 0x98, 0x35, 0xCC, 0x59,
+    0x11, 0xE6, 0x0D, 0xFD, 0xB1, 0x86, 0xE7, 0xEE, 0x2A, 0x35, 0x18, 0xC4, 0xD4, 0xB0, 0x43, 0x83,
+    0xB1, 0x41, 0x2F, 0x50, 0x47, 0x18, 0x85, 0x03, 0x99, 0x1E, 0x60, 0x0B, 0x66, 0x89, 0xAF, 0x1F,
+    0xA0, 0xC6, 0x1B, 0xE0, 0xC5, 0x04, 0xE5, 0xB5, 0x4B, 0x18, 0xE4, 0x12, 0x19, 0xE9, 0x03, 0x98,
+    0x76, 0x49, 0x40, 0xEB, 0x03, 0xDD, 0x08, 0xDD, 0x6D, 0x39, 0x89, 0x1B, 0x20, 0xC5, 0x28, 0x1D,
+    0xD4, 0x37, 0x67, 0x18, 0x30, 0x9D, 0xB2, 0x51, 0x97, 0x7A, 0x80, 0x5D, 0xD4, 0xA2, 0x9C, 0x12,
+    0x8D, 0xEA, 0x9B, 0x03, 0x15, 0x81, 0x20, 0x76, 0x22, 0x22, 0xAC, 0xD0, 0xDE, 0x43, 0x9B, 0x1E,
+    0xAC, 0xFC, 0x4A, 0xDE, 0xF7, 0x19, 0xEF, 0x58, 0x54, 0xD3, 0x7E, 0xCE, 0x8A, 0x22, 0x0B, 0x89,
+    0x1B, 0xFC, 0x9E, 0x84, 0xCA, 0xA4, 0xAC, 0x33, 0xED, 0xCB, 0x65, 0xDD, 0x4B, 0x12, 0x27, 0x2D,
+    0x73, 0xC8, 0x1A, 0xEC, 0xF1, 0x06, 0x81, 0xD9, 0x44, 0x77, 0x99, 0x05, 0xF4, 0x7E, 0xDD, 0x6F,
+    0x5A, 0x38, 0xB5, 0x8A, 0xD0, 0x5A, 0x77, 0x99, 0x65, 0xA2, 0x29, 0x9E, 0x1C, 0x6F, 0x21, 0xA8,
+    0xC5, 0x02, 0xDA, 0x32, 0x33, 0x49, 0x12, 0x55, 0x33, 0x8F, 0x13, 0xB0, 0x63, 0x51, 0xF5, 0x08,
+    0xBB, 0x9E, 0xE8, 0x40, 0x39, 0xFB, 0x29, 0x53, 0x31, 0xDD, 0x66, 0xE9, 0xE9, 0x36, 0x15, 0xD3,
+    0x1C, 0x34, 0x15, 0x9B, 0x56, 0xCE, 0xDE, 0x58, 0xEC, 0x33, 0xE7, 0x7D, 0x4B, 0xC3, 0xDD, 0xB5,
+    0x7C, 0x76, 0x39, 0x7A, 0xFB, 0x71, 0xB1, 0xF5, 0x9D, 0xE8, 0xCF, 0x6C, 0x46, 0xD0, 0xEE, 0x82,
+    0x1C, 0x24, 0xC2, 0x34, 0x74, 0x98, 0x43, 0x50, 0x9D, 0xC5, 0x27, 0x0A, 0xF7, 0x11, 0xF7, 0xB7,
+    0xC1, 0x06, 0xBD, 0x1F, 0x06, 0xAE, 0x61, 0x10, 0x41, 0xD1, 0x26, 0x28, 0xD4, 0xC1, 0x99, 0xEB,
+    0x5D, 0x0B, 0x9B, 0xB7, 0x77, 0xB2, 0xB7, 0xB7, 0xD9, 0x9B, 0x9F, 0xD8, 0x17, 0x89, 0xFD, 0x92,
+    0xD8, 0x63, 0xC6, 0x5E, 0xFE, 0x55, 0xF6, 0x65, 0x18, 0xFF, 0x9C, 0x19, 0xA9, 0xF8, 0xCC, 0xF3,
+    0x16, 0xA3, 0x97, 0xE2, 0x01, 0x6C, 0xFE, 0x90, 0x56, 0x17, 0x69, 0x35, 0xFF, 0x81, 0xD6, 0x16,
+    0x5E, 0x33, 0xB9, 0xD1, 0x7F, 0xCF, 0x4E, 0xB0, 0x67, 0x6B, 0xFE, 0xD6, 0x09, 0x93, 0x5A, 0x7E,
+    0x37, 0x3A, 0x7A, 0x19, 0x1B, 0x77, 0x3C, 0x61, 0xDC, 0xE9, 0x17, 0xE3, 0x8A, 0x7F, 0x6E, 0x5C,
+    0xB1, 0x4F, 0xE6, 0xF5, 0x73, 0xFB, 0xC0, 0x97, 0x8F, 0x7C, 0x79, 0x75, 0x86, 0x57, 0x19, 0x9D,
+    0xB2, 0xC8, 0x1B, 0x4A, 0x48, 0x39, 0x17, 0x96, 0x47, 0x81, 0x20, 0x16, 0xC6, 0xE9, 0x18, 0x26,
+    0xE5, 0xAD, 0x63, 0x9C, 0xBB, 0x9E, 0xBC, 0x5A, 0x59, 0x9E, 0xAC, 0x23, 0x1D, 0x28, 0xE5, 0x28,
+    0x84, 0x34, 0x5F, 0x0A, 0x9F, 0xD3, 0xC8, 0x58, 0x1A, 0xC6, 0x52, 0x71, 0xB8, 0x7B, 0xA1, 0xA5,
+    0xCF, 0x47, 0x1F, 0x8C, 0x66, 0x88, 0x8F, 0xF5, 0xEC, 0x93, 0x94, 0xBD, 0x16, 0x22, 0xCA, 0x27,
+    0x4C, 0x1D, 0x8D, 0xA8, 0xAE, 0xB9, 0x86, 0x9F, 0xF0, 0x09, 0xCA, 0x52, 0x74, 0xE9, 0x8E, 0x14,
+    0xFC, 0x04, 0xBA, 0x57, 0x24, 0x14, 0x54, 0x3D, 0x5C, 0xD2, 0x80, 0xD5, 0x20, 0xC9, 0x74, 0xF4,
+    0x8B, 0x30, 0x6E, 0x29, 0x1D, 0x49, 0xBB, 0x91, 0xC4, 0xA2, 0x50, 0x6D, 0x38, 0x58, 0x19, 0x43,
+    0x71, 0x88, 0x9F, 0xF1, 0xBC, 0x06, 0x19, 0x88, 0xA7, 0x3E, 0x97, 0x7B, 0x22, 0x29, 0x46, 0xA0,
+    0x57, 0xBE, 0x87, 0xB2, 0x87, 0x97, 0x50, 0xB5, 0xF0, 0x82, 0x60, 0xD0, 0x98, 0xB7, 0x74, 0x18,
+    0x3C, 0x12, 0x54, 0x7F, 0xA9, 0x08, 0xFB, 0xAC, 0xBA, 0x70, 0x11, 0x93, 0x1A, 0x40, 0x5A, 0x39,
+    0x71, 0x17, 0xD2, 0x1F, 0x0B, 0xA5, 0x62, 0x39, 0x10, 0x84, 0xEA, 0x40, 0x17, 0xC2, 0xA8, 0xBB,
+    0xFA, 0xCB, 0x85, 0x81, 0xE6, 0x2B, 0x0D, 0xAE, 0x79, 0x83, 0x13, 0x98, 0xC7, 0x78, 0x76, 0x7E,
+    0x9C, 0x5C, 0x3F, 0x00, 0xBD, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x9D, 0xF5, 0x8A, 0x58, 0xC2,
+    0x12, 0xDB, 0x22, 0x22, 0xE1, 0x86, 0x0A, 0x85, 0x98, 0x22, 0x65, 0x38, 0x5B, 0x34, 0xB4, 0x14,
+    0xD0, 0xA4, 0x21, 0x25, 0x12, 0x45, 0x28, 0x52, 0x50, 0x84, 0xDC, 0x7E, 0x02, 0x0D, 0x35, 0x69,
+    0xA9, 0xD2, 0x50, 0x50, 0x84, 0x78, 0xFF, 0x00, 0x8B, 0x2F, 0x70, 0x91, 0xF4, 0x16, 0x32, 0x92,
+    0x4F, 0xD8, 0x5E, 0xDE, 0xCC, 0xDE, 0xE5, 0x12, 0x44, 0x80, 0x82, 0xB0, 0x17, 0xEF, 0xF9, 0xEE,
+    0xD6, 0xF3, 0xDE, 0x9B, 0x37, 0x33, 0x21, 0xE2, 0x95, 0x54, 0xD8, 0xF2, 0x02, 0xDB, 0x80, 0x2B,
+    0xEE, 0x68, 0xB9, 0xA2, 0x11, 0x97, 0x1F, 0x1A, 0xF2, 0x7E, 0xA4, 0xBC, 0xCA, 0xEA, 0xB8, 0xC1,
+    0xA1, 0x8E, 0x8C, 0xCB, 0x88, 0x7A, 0x5D, 0xE1, 0x66, 0x8F, 0x54, 0x67, 0x2C, 0xE5, 0xB6, 0xA5,
+    0xA4, 0x35, 0x56, 0x7B, 0xF2, 0x5B, 0xBE, 0x31, 0xDE, 0x7B, 0x2A, 0xBD, 0xAF, 0xB5, 0x1F, 0xF7,
+    0x29, 0x19, 0x1F, 0x31, 0x86, 0xAA, 0xB1, 0x6D, 0xE2, 0x32, 0x00, 0x8B, 0x1A, 0xDC, 0xEC, 0xE1,
+    0xBA, 0x6E, 0xE9, 0x92, 0xF5, 0x6F, 0xD1, 0xDF, 0x70, 0xC4, 0x16, 0x9B, 0x66, 0x99, 0xE6, 0x1D,
+    0x60, 0xD7, 0x99, 0xD1, 0x2E, 0xAD, 0xCD, 0xF1, 0xB2, 0x7A, 0x8E, 0x87, 0xE7, 0x6B, 0x01, 0xA4,
+    0x29, 0x99, 0x4A, 0x10, 0x41, 0xD7, 0x38, 0x81, 0x8C, 0x1D, 0xA5, 0x56, 0x30, 0x21, 0xA3, 0x2C,
+    0x04, 0xD4, 0x7C, 0x3B, 0xF4, 0x24, 0xA8, 0x09, 0x73, 0x15, 0x58, 0x2A, 0x4F, 0x5E, 0x73, 0x50,
+    0xBB, 0x41, 0xEA, 0xFB, 0x43, 0x47, 0xC6, 0xDC, 0x20, 0x7A, 0x65, 0x1A, 0x52, 0xEE, 0xD6, 0x39,
+    0x81, 0xE0, 0xB9, 0x17, 0x00, 0x7D, 0x51, 0x5A, 0x51, 0x38, 0x21, 0xDD, 0x08, 0x1E, 0x00, 0x72,
+    0x62, 0x89, 0xBA, 0x26, 0x53, 0x0B, 0xDC, 0x84, 0x4C, 0x2F, 0x1A, 0x35, 0xD0, 0x9C, 0xA0, 0x19,
+    0x3F, 0xEB, 0x16, 0x22, 0x3F, 0xE1, 0xA5, 0x06, 0xD5, 0x53, 0xD4, 0xEB, 0x9E, 0x74, 0x1F, 0xF7,
+    0x94, 0xF4, 0x78, 0xE2, 0xDC, 0xBA, 0x12, 0x95, 0xC4, 0xDB, 0xDA, 0x7D, 0x94, 0x8F, 0x86, 0xB7,
+    0x07, 0x1B, 0xB0, 0x35, 0xC1, 0x37, 0x53, 0x70, 0x52, 0x07, 0x57, 0x66, 0xE9, 0x59, 0xCC, 0x68,
+    0x2C, 0x38, 0xEC, 0x57, 0x04, 0x45, 0x64, 0x3F, 0x16, 0x1F, 0x38, 0xB8, 0x27, 0xED, 0x10, 0xDF,
+    0x3B, 0xBA, 0xC7, 0x10, 0x8D, 0x7A, 0x51, 0x65, 0xE1, 0x77, 0x06, 0xC2, 0x7B, 0x05, 0xAC, 0xE1,
+    0x09, 0x8A, 0x81, 0xE1, 0x10, 0x09, 0x88, 0x5C, 0xFD, 0x0C, 0xEA, 0xF0, 0x0E, 0x5C, 0x6F, 0xC9,
+    0xF2, 0x49, 0xEF, 0x7B, 0x46, 0xE7, 0x9C, 0x83, 0xC0, 0xD4, 0x7B, 0xC9, 0xF8, 0x97, 0xF2, 0x24,
+    0x50, 0x58, 0xF1, 0x56, 0x81, 0x5F, 0x36, 0x7B, 0xAE, 0xC0, 0x00, 0xC9, 0xA4, 0x63, 0xD4, 0x19,
+    0x2A, 0x3C, 0xB5, 0xEC, 0x09, 0xE9, 0x36, 0x7C, 0x9B, 0x23, 0xAC, 0x3F, 0x3D, 0x88, 0x00, 0x0D,
+    0xFF, 0x9C, 0x2A, 0x51, 0x8A, 0x38, 0x11, 0x73, 0x63, 0xBC, 0x44, 0xAA, 0xF0, 0xF3, 0x6D, 0x9C,
+    0xC2, 0xC7, 0xF7, 0x0B, 0x75, 0x1C, 0x85, 0x52, 0xA6, 0x53, 0xB2, 0xD6, 0xFE, 0xB2, 0x66, 0xA1,
+    0x1D, 0x3C, 0x35, 0x05, 0xEF, 0xAC, 0x32, 0x1C, 0x70, 0x57, 0xB5, 0x90, 0x3F, 0xA1, 0xAD, 0x3E,
+    0x61, 0xD6, 0xB8, 0xBA, 0xF4, 0x6D, 0x11, 0xDA, 0x2E, 0xE7, 0xB8, 0xAC, 0x34, 0x6B, 0xE9, 0x26,
+    0x88, 0x7B, 0xD6, 0xD8, 0x52, 0x0E, 0x09, 0xB4, 0x33, 0x16, 0x12, 0x8E, 0xCF, 0x25, 0x76, 0xDE,
+    0xA3, 0xBA, 0x9A, 0x3F, 0x75, 0xC1, 0xCC, 0x3F, 0xAF, 0x55, 0x80, 0xC4, 0x48, 0x1D, 0x2A, 0x68,
+    0x53, 0x48, 0x71, 0x9D, 0x34, 0xBA, 0xBE, 0x76, 0xE8, 0x32, 0x36, 0x94, 0x59, 0xC5, 0xA7, 0x8F,
+    0x41, 0x84, 0x4F, 0xF7, 0x0B, 0x5A, 0xC9, 0x40, 0x2B, 0x94, 0x72, 0x92, 0x41, 0xA9, 0x0A, 0xBC,
+    0x56, 0x3D, 0x37, 0xF0, 0x0A, 0x2D, 0x88, 0x78, 0x36, 0xEA, 0x19, 0xB8, 0xB6, 0x60, 0x99, 0x90,
+    0xFE, 0x79, 0x8A, 0xA8, 0xD2, 0x86, 0x7C, 0x24, 0xAD, 0x76, 0xB4, 0x4F, 0x71, 0x11, 0xC3, 0x74,
+    0xE2, 0x84, 0x20, 0xFD, 0xA1, 0xA0, 0xEC, 0xFE, 0xD3, 0xF9, 0x20, 0x32, 0x9C, 0x60, 0xA9, 0x81,
+    0xB2, 0xA2, 0x6D, 0x49, 0x09, 0x0C, 0x1A, 0x50, 0xE3, 0x1E, 0x0D, 0x5B, 0xCE, 0x38, 0xE2, 0x14,
+    0x2F, 0x02, 0x67, 0x52, 0x23, 0x5C, 0xD6, 0xA3, 0xC6, 0x36, 0xC8, 0x30, 0xF9, 0x9D, 0x25, 0x22,
+    0x9F, 0x3D, 0x11, 0x0E, 0x62, 0x8A, 0xE8, 0x17, 0x57, 0x84, 0x04, 0xDB, 0x12, 0x12, 0x90, 0xD3,
+    0x82, 0x05, 0x1B, 0x13, 0x32, 0x20, 0xCE, 0x08, 0x0D, 0xB1, 0x06, 0x6C, 0x51, 0x4C, 0xF8, 0x8B,
+    0x5B, 0x52, 0xDB, 0x67, 0x48, 0xEB, 0x5C, 0xBC, 0xE8, 0x59, 0x79, 0x87, 0x5E, 0x84, 0xEB, 0xD8,
+    0x35, 0xEE, 0x2A, 0x2E, 0xA1, 0xCC, 0xA2, 0xCD, 0xF0, 0x94, 0x14, 0x12, 0x7E, 0xC7, 0x29, 0x3E,
+    0x1B, 0x87, 0xBB, 0xBB, 0x97, 0x4B, 0x88, 0x20, 0xE1, 0x41, 0x38, 0x78, 0x14, 0x06, 0x37, 0x57,
+    0x35, 0x62, 0x2C, 0xBF, 0xEF, 0x25, 0x7D, 0x51, 0x27, 0xFF, 0x44, 0xB8, 0xD2, 0xA7, 0x14, 0xE6,
+    0x3C, 0x7A, 0x8F, 0x9B, 0x6F, 0x92, 0x16, 0x89, 0x5D, 0xC7, 0xFC, 0xBD, 0xF3, 0x8B, 0x80, 0xF6,
+    0x6F, 0x03, 0x46, 0x8D, 0x6E, 0x52, 0x97, 0x3A, 0x18, 0x10, 0x63, 0xAC, 0xE5, 0x0D, 0x77, 0xC9,
+    0xC5, 0xF5, 0x31, 0x14, 0x6A, 0xBA, 0xBC, 0x45, 0xD6, 0x19, 0x85, 0x63, 0x33, 0xF5, 0xA3, 0xD0,
+    0x4E, 0x6C, 0xF6, 0xF1, 0xB2, 0x29, 0xA7, 0x73, 0xA5, 0xA1, 0x97, 0xBD, 0x3D, 0xEB, 0x3A, 0x79,
+    0x40, 0x06, 0x86, 0xE3, 0x52, 0xC2, 0xB4, 0xA4, 0x8C, 0xDD, 0x08, 0x22, 0x64, 0x5E, 0x60, 0xEA,
+    0x60, 0x88, 0xC0, 0xE4, 0x81, 0xB3, 0xD9, 0x25, 0x9F, 0x45, 0x35, 0xCE, 0x73, 0xAE, 0x2B, 0x4C,
+    0x32, 0x49, 0xC2, 0x11, 0xC1, 0x77, 0x76, 0x37, 0x28, 0xE3, 0x81, 0xD0, 0xA9, 0xE3, 0x10, 0x9A,
+    0xBB, 0x5B, 0xF6, 0x48, 0x76, 0x5A, 0x9D, 0xD1, 0x7F, 0x5B, 0x3F, 0x00, 0xAD, 0x55, 0xB1, 0x8E,
+    0xDD, 0x44, 0x14, 0x3D, 0xB6, 0xA5, 0x58, 0x62, 0x8A, 0xA9, 0x52, 0xA5, 0x70, 0x43, 0x43, 0x13,
+    0xB7, 0x14, 0x64, 0x6D, 0x89, 0x82, 0x82, 0x82, 0x2D, 0xA0, 0xE2, 0x23, 0xB6, 0xA1, 0xDC, 0xAC,
+    0xDD, 0xD1, 0xA6, 0xA1, 0xA2, 0xA1, 0x27, 0x65, 0xCA, 0x7D, 0xFB, 0x4C, 0xBE, 0x60, 0xC4, 0x17,
+    0x18, 0x29, 0x34, 0x54, 0x46, 0xB2, 0x84, 0x45, 0xFC, 0xDE, 0x70, 0xCE, 0x1D, 0xBF, 0xB0, 0xDA,
+    0x64, 0x85, 0x82, 0xE2, 0x27, 0x7B, 0x3C, 0xB6, 0x67, 0xEE, 0xB9, 0xE7, 0x9C, 0x7B, 0x1F, 0x80,
+    0xF3, 0x0C, 0xC8, 0x62, 0x3E, 0x00, 0x7F, 0x86, 0x11, 0xF8, 0xAE, 0x9E, 0x80, 0xCF, 0xF2, 0x19,
+    0x6F, 0x1D, 0xD9, 0x39, 0x50, 0xFE, 0x18, 0x7B, 0x14, 0x31, 0x2E, 0x40, 0x0C, 0x1D, 0xD0, 0xF5,
+    0x6E, 0x40, 0xD3, 0xE7, 0x13, 0xFC, 0x80, 0x15, 0xE5, 0x84, 0x06, 0xC5, 0x8C, 0x6A, 0xC0, 0x01,
+    0x6E, 0x44, 0xA7, 0x49, 0x33, 0x64, 0x2B, 0xFC, 0x88, 0x3D, 0x9C, 0x26, 0x85, 0x4D, 0x22, 0xCA,
+    0x19, 0xFB, 0xBE, 0x38, 0x68, 0xE7, 0xAF, 0x79, 0x16, 0x0C, 0xAB, 0x75, 0xE0, 0x77, 0x40, 0xFE,
+    0x1C, 0xF7, 0x1C, 0xD9, 0x9E, 0x20, 0xF7, 0x31, 0xA0, 0xFB, 0x23, 0xB6, 0x3E, 0x64, 0x4B, 0xA1,
+    0xD8, 0x4F, 0x81, 0x95, 0x08, 0xFC, 0x2F, 0xC4, 0xBD, 0xD6, 0x40, 0xFD, 0xF9, 0xC4, 0x1D, 0x9B,
+    0x16, 0xC7, 0xE2, 0xF8, 0xCD, 0x7E, 0xA8, 0x63, 0x9C, 0x10, 0xE3, 0x01, 0x65, 0x3C, 0x02, 0xEE,
+    0xD8, 0xDA, 0x56, 0x3F, 0xF1, 0x74, 0x3D, 0x2F, 0x97, 0x8A, 0x1F, 0x78, 0x39, 0x53, 0xE8, 0x09,
+    0xEF, 0x73, 0x5C, 0x90, 0x0A, 0xC7, 0x9D, 0xB3, 0xF8, 0xF3, 0x01, 0xC2, 0x43, 0x1A, 0x8A, 0xA9,
+    0x0C, 0x04, 0xD5, 0x00, 0x4D, 0x26, 0x40, 0xE4, 0xC8, 0x05, 0xCD, 0xC8, 0x4A, 0xB1, 0x18, 0x22,
+    0x17, 0x23, 0x79, 0x88, 0xCC, 0xA3, 0x12, 0x99, 0x1B, 0xA4, 0x8F, 0x70, 0x02, 0x71, 0x14, 0x1B,
+    0x17, 0xBC, 0x4C, 0xBE, 0x85, 0x47, 0xD9, 0xDF, 0x09, 0xFB, 0x80, 0x3A, 0x18, 0x0D, 0xD5, 0xDF,
+    0xFB, 0xC0, 0x6D, 0xAB, 0x9E, 0xE9, 0x37, 0x10, 0x0F, 0x85, 0x52, 0xAF, 0xB8, 0x6A, 0xB8, 0x06,
+    0x76, 0x36, 0xF3, 0x81, 0x22, 0x35, 0xBF, 0x7F, 0xBB, 0x72, 0x49, 0x1C, 0x8C, 0x89, 0x2C, 0xDA,
+    0x0E, 0xAF, 0x60, 0xB4, 0x7F, 0x0A, 0xBC, 0xEE, 0x03, 0xDC, 0x97, 0x8E, 0xE2, 0xFB, 0x05, 0xD9,
+    0x58, 0xF5, 0xF7, 0xA6, 0xFC, 0x88, 0xE0, 0xF2, 0x18, 0x5B, 0x93, 0x80, 0x02, 0x5F, 0x31, 0x30,
+    0x56, 0x66, 0xCA, 0x40, 0x43, 0x12, 0xA3, 0x21, 0x8B, 0xF9, 0x6C, 0x33, 0x89, 0x80, 0xF8, 0xC3,
+    0xC5, 0xC4, 0x25, 0x51, 0xDE, 0x99, 0x93, 0x0A, 0x79, 0x7C, 0xA6, 0xCD, 0x6E, 0xF8, 0xE3, 0x07,
+    0x47, 0xE4, 0x87, 0x9C, 0xEC, 0x1C, 0xE8, 0x88, 0x72, 0x2D, 0xD7, 0xFB, 0x09, 0x37, 0x03, 0x88,
+    0x71, 0x0B, 0x6F, 0xA9, 0x9B, 0x05, 0x8C, 0x72, 0x8B, 0x68, 0xB9, 0xCB, 0x04, 0xAD, 0x71, 0x6E,
+    0x00, 0x2C, 0x79, 0xB3, 0x81, 0x91, 0x6E, 0x08, 0x4E, 0xD9, 0x2B, 0x53, 0x4D, 0x4B, 0x0A, 0x81,
+    0x26, 0xA8, 0x1C, 0xDA, 0xB7, 0xE3, 0x3E, 0x3C, 0xE7, 0xF2, 0xF8, 0x2B, 0xCF, 0xDB, 0x6F, 0x6B,
+    0xDE, 0x67, 0x42, 0xEB, 0x65, 0x9B, 0x6E, 0x50, 0x5E, 0xFF, 0x42, 0x4D, 0x43, 0x39, 0xD8, 0x50,
+    0xA4, 0x21, 0x1F, 0xD3, 0xD3, 0xCD, 0x66, 0x4B, 0x1A, 0x2E, 0xD3, 0x70, 0x96, 0x86, 0x2A, 0x0D,
+    0x3E, 0x05, 0x72, 0xDB, 0xFA, 0x90, 0xD6, 0xA7, 0x85, 0xD9, 0x94, 0xC8, 0xB0, 0xF5, 0x79, 0xC2,
+    0x54, 0x1E, 0xF7, 0x7A, 0x5A, 0xCC, 0xF5, 0x95, 0x55, 0x54, 0xF5, 0x15, 0x57, 0x66, 0xB3, 0x7F,
+    0xA9, 0xA7, 0x6B, 0x19, 0x84, 0xF3, 0x69, 0x31, 0x2A, 0x48, 0x9D, 0x4F, 0x82, 0xCE, 0x82, 0x21,
+    0x65, 0xFC, 0x74, 0xF5, 0x82, 0x15, 0x6F, 0x2E, 0xF4, 0xA9, 0xF1, 0x84, 0xA4, 0x95, 0xB2, 0x8A,
+    0x06, 0xD9, 0x27, 0xC1, 0xCA, 0x84, 0xBF, 0x48, 0x30, 0x4E, 0x8D, 0x62, 0x13, 0x6C, 0x97, 0x86,
+    0x2E, 0x0D, 0x4D, 0xC2, 0x5F, 0x25, 0xFC, 0x3E, 0x0D, 0xEE, 0x9D, 0xEB, 0x37, 0x52, 0x9E, 0xDD,
+    0x15, 0xBB, 0xDD, 0x38, 0x36, 0x81, 0x0A, 0x25, 0xFB, 0x68, 0xBC, 0xF3, 0xC9, 0xCC, 0xE2, 0xAA,
+    0x93, 0xEF, 0x55, 0x73, 0xD9, 0x42, 0x84, 0x75, 0xBB, 0x63, 0x04, 0x12, 0xD7, 0x11, 0x99, 0x1B,
+    0x7D, 0x8F, 0x03, 0x2B, 0xB3, 0x0E, 0xF5, 0xE0, 0x56, 0xF9, 0x50, 0x1D, 0x61, 0xD1, 0x4D, 0x5B,
+    0xC5, 0xBF, 0x26, 0x74, 0x4B, 0xF7, 0x66, 0xBF, 0xBC, 0xDF, 0xC4, 0x79, 0x7C, 0x92, 0x4E, 0x10,
+    0x9B, 0xFF, 0x6C, 0x04, 0x74, 0xDD, 0x2E, 0x4F, 0x10, 0x0C, 0x4B, 0xD5, 0x5F, 0x31, 0x3B, 0xC7,
+    0xCA, 0xC3, 0x35, 0x1B, 0x23, 0xB3, 0xBF, 0xA1, 0xD8, 0x3E, 0x54, 0x3D, 0x9D, 0xCE, 0x42, 0x14,
+    0x04, 0xC3, 0xD2, 0xF3, 0x66, 0x66, 0x39, 0x76, 0x74, 0xE5, 0xF7, 0xA7, 0xE6, 0xF3, 0xB1, 0x98,
+    0x92, 0xE0, 0x12, 0xB6, 0xB9, 0x52, 0xA3, 0xBA, 0x44, 0x16, 0xF0, 0xE2, 0xC3, 0xC7, 0x2A, 0x66,
+    0x75, 0xEC, 0x40, 0x95, 0xA2, 0xDA, 0xB2, 0x8A, 0xAF, 0x1E, 0xEB, 0x77, 0xB1, 0xAC, 0x5E, 0x6F,
+    0xB5, 0xAE, 0x56, 0x3F, 0x1A, 0xCD, 0xD4, 0x66, 0xB5, 0x98, 0x44, 0x51, 0xF7, 0xE2, 0x99, 0xED,
+    0xC0, 0xCD, 0x16, 0xD4, 0xA9, 0xE0, 0x45, 0xB4, 0xBA, 0x4E, 0xB0, 0xA8, 0x59, 0xFC, 0xED, 0x56,
+    0x69, 0x5B, 0x57, 0x4B, 0x46, 0x7E, 0x62, 0x0E, 0xE9, 0xDF, 0xF8, 0xFB, 0x13, 0xFC, 0x8F, 0x63,
+    0x11, 0x34, 0x26, 0x2F, 0x7A, 0x64, 0x30, 0x5A, 0x6D, 0x27, 0x33, 0xF2, 0x51, 0x31, 0x31, 0x49,
+    0x36, 0x41, 0xEA, 0x9C, 0xAF, 0x6C, 0x87, 0xA8, 0x5E, 0x0A, 0xC8, 0x51, 0x16, 0xF5, 0xAF, 0x15,
+    0x72, 0xAF, 0xBF, 0xA2, 0x32, 0x4A, 0xF0, 0x66, 0x36, 0xF7, 0x63, 0x6B, 0x07, 0x48, 0xED, 0xC8,
+    0x4A, 0xAC, 0xB3, 0x32, 0x5F, 0xAD, 0x38, 0xF4, 0x5A, 0x4D, 0xB4, 0x8C, 0xFA, 0xE8, 0xE6, 0x76,
+    0x57, 0x38, 0x19, 0x5C, 0xA5, 0x56, 0xEA, 0xED, 0xB5, 0xD2, 0x93, 0x87, 0xD5, 0xB8, 0xAA, 0x2F,
+    0x16, 0xA6, 0x49, 0xB9, 0xCE, 0xF4, 0x77, 0x19, 0xC8, 0xC0, 0x25, 0x7B, 0x3C, 0xD9, 0x9D, 0x98,
+    0xC2, 0x63, 0x96, 0x7D, 0x39, 0x64, 0xBA, 0xAD, 0xF5, 0x7A, 0xA4, 0x30, 0x4F, 0xBC, 0x9A, 0xE6,
+    0x9A, 0x40, 0xFA, 0x57, 0x9B, 0x27, 0xAB, 0x13, 0x5B, 0x67, 0xA7, 0xEE, 0xA0, 0x2E, 0xF2, 0xA0,
+    0x7F, 0x0F, 0xC6, 0xFE, 0x01, 0xCD, 0x95, 0xBF, 0x6E, 0xD4, 0x40, 0x10, 0xC6, 0x67, 0xBD, 0x22,
+    0x96, 0xE2, 0x62, 0x29, 0x91, 0x22, 0xE4, 0x96, 0x02, 0xE4, 0x17, 0x40, 0xD8, 0x3D, 0x0D, 0x05,
+    0xA2, 0x08, 0x2F, 0x40, 0x97, 0x36, 0x05, 0x60, 0x3F, 0x42, 0x1A, 0x7A, 0xDE, 0x80, 0x86, 0x96,
+    0xD8, 0x8F, 0x60, 0x89, 0x17, 0xB8, 0xE2, 0x22, 0x51, 0xBA, 0x38, 0x24, 0x07, 0x7C, 0x9E, 0x7C,
+    0xDF, 0xEC, 0xFD, 0x93, 0x22, 0x41, 0x28, 0x90, 0xB2, 0x77, 0xD9, 0xB3, 0xF7, 0xCF, 0xEC, 0x37,
+    0xBF, 0x99, 0x9D, 0x88, 0x24, 0x43, 0x32, 0x88, 0xE4, 0x5D, 0xDE, 0x89, 0x28, 0x3E, 0x92, 0x4E,
+    0xE9, 0x24, 0x52, 0x0E, 0x25, 0x86, 0xFF, 0xDA, 0xFC, 0x42, 0xFC, 0x20, 0xA1, 0x93, 0xBC, 0x92,
+    0xA2, 0x12, 0x6C, 0xBC, 0x94, 0xAC, 0x17, 0x37, 0x49, 0x89, 0xC9, 0xC1, 0xAF, 0x44, 0xC2, 0x82,
+    0xA6, 0x8B, 0x6E, 0x8D, 0xE5, 0x75, 0x46, 0xA3, 0x73, 0x59, 0x61, 0x72, 0xC6, 0x62, 0xC9, 0xB4,
+    0x47, 0x9F, 0x2B, 0x6D, 0x95, 0x2B, 0xF6, 0xDA, 0xD1, 0x2C, 0x17, 0x4B, 0x6E, 0x0A, 0xB4, 0xE2,
+    0x23, 0x17, 0xA7, 0x9C, 0x0B, 0xCA, 0xC7, 0x52, 0x1B, 0x11, 0xA7, 0xDC, 0x91, 0x2D, 0xF7, 0x72,
+    0x1E, 0xBC, 0xE2, 0x06, 0x9D, 0x6D, 0x85, 0x2E, 0xFE, 0x28, 0x3D, 0xD8, 0x74, 0x32, 0xDB, 0x4B,
+    0x74, 0x36, 0x98, 0x0E, 0xF7, 0xDB, 0x5E, 0xCA, 0xD2, 0x86, 0xBE, 0xF3, 0x0C, 0x37, 0x51, 0xB2,
+    0x94, 0xDE, 0x0E, 0x5C, 0x14, 0x3C, 0x7C, 0x4A, 0x46, 0x0E, 0x55, 0x05, 0x44, 0x65, 0x43, 0x32,
+    0x71, 0x48, 0xE8, 0x6A, 0xD9, 0xE0, 0x01, 0x43, 0x92, 0xC3, 0xB7, 0xB5, 0x7D, 0x21, 0x06, 0x6A,
+    0x32, 0x35, 0x69, 0x6A, 0x2F, 0x1C, 0x52, 0x49, 0x61, 0x23, 0x0C, 0xC4, 0x8E, 0xBF, 0x62, 0xC1,
+    0x17, 0xD2, 0x77, 0xE6, 0xB4, 0x7B, 0x2D, 0x89, 0xC2, 0xDD, 0x4C, 0xCD, 0xE7, 0x5D, 0xE3, 0xBA,
+    0x44, 0xD7, 0xE0, 0x6E, 0x86, 0x7A, 0xBC, 0xD7, 0x12, 0x7A, 0x19, 0x11, 0x88, 0x84, 0xD1, 0xF0,
+    0x3D, 0xBA, 0x14, 0x41, 0x69, 0x42, 0x03, 0x39, 0xA1, 0x92, 0xB6, 0x0A, 0x8D, 0x57, 0x09, 0x3F,
+    0xBF, 0x28, 0x77, 0x29, 0x6D, 0xCE, 0xE2, 0x75, 0xFE, 0x28, 0xD2, 0x2E, 0x3F, 0xD0, 0xEA, 0xB1,
+    0xC8, 0x05, 0x7E, 0x06, 0x79, 0x4A, 0xB7, 0x9B, 0x8C, 0x71, 0x68, 0x95, 0x28, 0x7C, 0x3C, 0x3E,
+    0xBB, 0x96, 0xBB, 0xB4, 0xFB, 0xCE, 0xD5, 0x5D, 0xC8, 0x13, 0x49, 0x7A, 0x39, 0x47, 0xEA, 0xBB,
+    0x81, 0xDB, 0x7A, 0x3A, 0x0A, 0x1D, 0x27, 0xCB, 0xDB, 0xDE, 0xFC, 0x1F, 0xD6, 0x62, 0x74, 0xB2,
+    0x71, 0x87, 0xC8, 0x5B, 0xDA, 0xE7, 0x2D, 0x07, 0xA6, 0x69, 0xC7, 0xA7, 0xC6, 0x49, 0xB8, 0x46,
+    0x84, 0x54, 0x34, 0x97, 0x5B, 0x38, 0xA1, 0xE7, 0x35, 0x6A, 0x71, 0xA7, 0x24, 0x1D, 0x20, 0x27,
+    0x92, 0x01, 0xA9, 0x74, 0x45, 0x69, 0xF8, 0x92, 0x41, 0x13, 0xB1, 0x90, 0xC7, 0xE8, 0x39, 0x30,
+    0xE4, 0xF0, 0xA5, 0xEC, 0x8C, 0x09, 0x8F, 0xF6, 0x53, 0x8D, 0x43, 0x73, 0xBB, 0x75, 0x5F, 0x2D,
+    0x26, 0x26, 0xCD, 0x82, 0x94, 0xCA, 0xFE, 0x02, 0x9E, 0x74, 0x87, 0x40, 0x18, 0x58, 0x03, 0x62,
+    0xC6, 0xC1, 0x03, 0x12, 0xD6, 0x86, 0xA3, 0x80, 0x74, 0xA3, 0xF1, 0x5E, 0xDC, 0x68, 0x30, 0x56,
+    0x92, 0xAD, 0x8C, 0x85, 0x9E, 0xEA, 0x60, 0x28, 0x5A, 0x50, 0x34, 0x12, 0xD9, 0x7C, 0x06, 0xD7,
+    0x2C, 0xC9, 0x98, 0x2F, 0x8F, 0xB7, 0x37, 0x3D, 0xD9, 0x54, 0x9D, 0x73, 0xEB, 0x9F, 0x5B, 0xFF,
+    0x22, 0x46, 0x22, 0x4A, 0xAA, 0x2C, 0x57, 0x1B, 0xF9, 0xC7, 0x76, 0xA2, 0x17, 0x0C, 0xBF, 0x8E,
+    0x2C, 0x23, 0xCC, 0xE7, 0x4C, 0x3F, 0x9D, 0xC2, 0x65, 0x0B, 0x44, 0x98, 0xF6, 0x7D, 0x0C, 0x4A,
+    0x6A, 0xCF, 0xDE, 0x7A, 0x17, 0x53, 0xD9, 0x72, 0x58, 0x6A, 0x3B, 0xB9, 0xE8, 0x6D, 0x83, 0xA1,
+    0xF3, 0x36, 0xED, 0x2C, 0x80, 0x52, 0x63, 0xC7, 0x43, 0xD4, 0xB3, 0xEB, 0x37, 0x13, 0xCF, 0xD9,
+    0xA6, 0x25, 0x8A, 0x23, 0xFA, 0x4E, 0x18, 0x07, 0x38, 0x58, 0x9B, 0x0E, 0xDC, 0xED, 0x1F, 0x07,
+    0x0A, 0x8F, 0x79, 0x38, 0xAC, 0x23, 0x97, 0xC4, 0xF7, 0x56, 0x5A, 0x77, 0x34, 0x6E, 0xB5, 0x23,
+    0xD4, 0xBF, 0x1C, 0xA6, 0x8A, 0xEB, 0x77, 0xC2, 0xB0, 0x32, 0x4F, 0xB2, 0x05, 0x73, 0x05, 0x52,
+    0xE8, 0xC1, 0x37, 0xBB, 0x43, 0x71, 0xC2, 0xDC, 0xD0, 0xAB, 0xCF, 0xD8, 0xB1, 0xE6, 0xA9, 0xDD,
+    0xA6, 0xEC, 0xC6, 0xF6, 0x28, 0x16, 0xF2, 0x78, 0x52, 0x6B, 0x5E, 0xE4, 0x67, 0xA4, 0xEC, 0xBB,
+    0x67, 0x31, 0x1F, 0xCE, 0xEF, 0x02, 0xF8, 0x48, 0x97, 0x56, 0xC9, 0x59, 0x98, 0x73, 0xF3, 0x32,
+    0x12, 0xF6, 0xDA, 0xEC, 0xCA, 0xFA, 0xA6, 0x1C, 0x44, 0xC4, 0x2E, 0x02, 0x2D, 0x6D, 0x22, 0x1D,
+    0x0F, 0x18, 0xE7, 0xB1, 0x82, 0xAC, 0xE3, 0x7C, 0xBF, 0x87, 0x2C, 0x75, 0x4C, 0x4E, 0x18, 0x73,
+    0xA4, 0x78, 0xF5, 0x76, 0xD8, 0x52, 0x66, 0x9A, 0xF7, 0x74, 0x8E, 0xB1, 0x0D, 0x06, 0x7B, 0x83,
+    0x19, 0x39, 0xF7, 0xEB, 0x40, 0x67, 0xDA, 0x6C, 0xC8, 0x24, 0xA6, 0xF4, 0x25, 0xBA, 0xC1, 0x77,
+    0x72, 0x24, 0xEE, 0x20, 0xA7, 0x5C, 0xBB, 0xE0, 0x76, 0x80, 0x9A, 0x4F, 0x63, 0xCC, 0xAD, 0x42,
+    0xB1, 0x3E, 0x89, 0xFD, 0x27, 0xA2, 0xC2, 0x82, 0x90, 0x28, 0xD2, 0xE6, 0x02, 0xA5, 0x95, 0x08,
+    0x07, 0xF6, 0xAD, 0x36, 0x95, 0xB3, 0xB0, 0x32, 0x7E, 0x9F, 0xDB, 0x0D, 0xB5, 0x95, 0xB1, 0x6E,
+    0xD4, 0x40, 0x10, 0x86, 0xC7, 0xB6, 0x82, 0x51, 0x2C, 0xB4, 0x94, 0x48, 0x14, 0xF7, 0x04, 0xB0,
+    0x2D, 0x05, 0x8A, 0x2D, 0x9E, 0x80, 0x22, 0x47, 0x01, 0x0D, 0x25, 0x4A, 0x93, 0x96, 0x22, 0x8A,
+    0x8F, 0x37, 0xA0, 0x09, 0x75, 0x8A, 0x14, 0x74, 0x34, 0x94, 0x04, 0x5B, 0xE2, 0x01, 0xB8, 0x47,
+    0x70, 0x13, 0x89, 0x0E, 0x17, 0x96, 0xF0, 0x45, 0x7B, 0x5E, 0xE6, 0xFF, 0xD7, 0x39, 0x87, 0x00,
+    0x01, 0x0A, 0x2C, 0x65, 0x1C, 0xD9, 0xEB, 0xD9, 0xF9, 0xBF, 0xF9, 0x67, 0x4F, 0x44, 0x64, 0x56,
+    0x6B, 0x90, 0xAC, 0x45, 0x4C, 0x1C, 0x62, 0x3C, 0x20, 0x8A, 0x2F, 0xE4, 0x6F, 0xAF, 0xA8, 0x5A,
+    0x21, 0x93, 0xF7, 0x0B, 0x91, 0xD2, 0x7B, 0xCD, 0x58, 0xAD, 0xE6, 0xC7, 0x9A, 0xA2, 0x61, 0xA2,
+    0x7A, 0x8A, 0xD5, 0x02, 0xB1, 0xE4, 0xFF, 0x39, 0xE3, 0x8C, 0x6B, 0x0C, 0xF7, 0x4F, 0x7B, 0xEE,
+    0xBF, 0xBE, 0xB4, 0x7F, 0xCE, 0xD7, 0x33, 0x16, 0x96, 0x6A, 0x8E, 0x48, 0x22, 0xEF, 0x8F, 0xF6,
+    0x6B, 0xEC, 0xA3, 0xE9, 0x8D, 0xC6, 0x4E, 0x62, 0x8D, 0xBA, 0x22, 0xD7, 0x1B, 0x56, 0xB1, 0x0E,
+    0xEB, 0x87, 0xC5, 0x54, 0x61, 0xDC, 0x06, 0xA5, 0x78, 0x8F, 0x95, 0xED, 0x55, 0x09, 0x37, 0xFC,
+    0x42, 0x13, 0x8B, 0x5D, 0xBD, 0x88, 0x54, 0xBE, 0x59, 0x8A, 0x7C, 0x54, 0x1E, 0xF8, 0x4A, 0xB3,
+    0x9C, 0xEA, 0xBF, 0x5D, 0x78, 0x8A, 0xA2, 0xFD, 0xD9, 0xB1, 0xAE, 0x5D, 0xC6, 0x50, 0x5A, 0xAD,
+    0x2F, 0x32, 0x3C, 0x96, 0x9B, 0x10, 0x22, 0xF7, 0x00, 0xA4, 0x3D, 0xC0, 0x23, 0xCB, 0xB2, 0x13,
+    0xAA, 0x92, 0x03, 0xF9, 0xD7, 0xEB, 0xAE, 0x7F, 0x2D, 0x90, 0xDB, 0x53, 0x94, 0xE6, 0xCA, 0xFC,
+    0xD1, 0x53, 0xDD, 0x82, 0xFD, 0x31, 0x6E, 0x8A, 0x19, 0x77, 0x48, 0xDD, 0xD4, 0xC3, 0x68, 0xEC,
+    0x21, 0x63, 0x49, 0x10, 0x76, 0xC9, 0x0F, 0x3A, 0x2E, 0xE2, 0xEB, 0x28, 0xF4, 0xA4, 0xD4, 0x2F,
+    0x6E, 0x6B, 0xF7, 0x56, 0x4F, 0x1C, 0xE1, 0xE9, 0x3B, 0x8D, 0x8A, 0xDF, 0x7A, 0x28, 0x4C, 0x34,
+    0xB6, 0xEC, 0xAB, 0xEE, 0xA2, 0x9A, 0xBF, 0x6C, 0xEA, 0xBB, 0x25, 0x69, 0x11, 0x37, 0x33, 0x85,
+    0x72, 0x7F, 0x4C, 0x79, 0xA8, 0x7F, 0xDB, 0xBF, 0x94, 0x32, 0x20, 0x83, 0xE2, 0x3A, 0x3B, 0x66,
+    0x39, 0xB9, 0x36, 0xD7, 0xEA, 0xDD, 0x68, 0x05, 0xA9, 0xB6, 0x38, 0x46, 0x59, 0x40, 0x89, 0x17,
+    0x30, 0x43, 0xE2, 0xDF, 0x2C, 0xF4, 0x8B, 0x4E, 0x35, 0x7B, 0x34, 0xF3, 0x8A, 0x19, 0xDF, 0xCB,
+    0x4B, 0x88, 0x29, 0xA8, 0xE6, 0xBC, 0x9D, 0x8C, 0x94, 0x84, 0xCE, 0x3E, 0xBF, 0x8E, 0xAB, 0xF1,
+    0xE7, 0x05, 0x91, 0x0E, 0x14, 0x04, 0x75, 0x9E, 0xD6, 0x29, 0x15, 0x49, 0x23, 0xB6, 0x96, 0xCC,
+    0x89, 0x69, 0xE0, 0x56, 0xB6, 0xBD, 0x8D, 0x1C, 0xB9, 0x56, 0x24, 0x9A, 0xA3, 0xFC, 0x1A, 0x5E,
+    0x30, 0x6D, 0x8A, 0x4A, 0x5D, 0xEC, 0xC0, 0x52, 0x06, 0xFA, 0x1B, 0x02, 0xF2, 0x25, 0xBC, 0x96,
+    0xB7, 0x98, 0xAA, 0xB2, 0x4F, 0x56, 0xF3, 0x67, 0xDA, 0x3D, 0x6C, 0xB1, 0xA6, 0x6D, 0x07, 0x3A,
+    0x75, 0xA0, 0x79, 0xD7, 0x44, 0x4E, 0x0B, 0x9F, 0x5F, 0x68, 0xEC, 0xC2, 0x50, 0x05, 0x25, 0x49,
+    0xBB, 0xC3, 0x5B, 0xF3, 0x90, 0x3D, 0xAE, 0x3F, 0x50, 0x41, 0xCD, 0x8E, 0x9B, 0x57, 0x5C, 0x3A,
+    0x7B, 0x04, 0x9F, 0x76, 0x36, 0x56, 0xBB, 0xF8, 0x61, 0x87, 0x93, 0xE2, 0x4F, 0xF1, 0x62, 0x49,
+    0x07, 0xEE, 0x04, 0x9B, 0x38, 0x36, 0x5F, 0x27, 0x81, 0x7C, 0x1B, 0xDE, 0xD2, 0x25, 0x85, 0x66,
+    0x35, 0xED, 0xA1, 0xDD, 0xC0, 0x68, 0x9A, 0x86, 0xCE, 0x30, 0x61, 0x90, 0x32, 0x7A, 0x81, 0x36,
+    0xA0, 0x67, 0x7C, 0x45, 0x37, 0xF5, 0x3B, 0x97, 0x91, 0x7A, 0x7F, 0x12, 0x4E, 0x80, 0x7E, 0x83,
+    0x34, 0xA7, 0x7B, 0x94, 0xD0, 0x4C, 0xBF, 0xD3, 0x6F, 0x6C, 0x37, 0x32, 0x45, 0x9F, 0x95, 0x26,
+    0x11, 0xD5, 0x71, 0x40, 0x4B, 0xA8, 0x9F, 0x00, 0x25, 0x71, 0x95, 0xCE, 0x96, 0xE4, 0x9F, 0xE1,
+    0x78, 0xB5, 0x74, 0xA0, 0x4A, 0xDC, 0x1D, 0xFB, 0xE0, 0x61, 0x9C, 0xD8, 0x37, 0x23, 0xD6, 0x92,
+    0x5E, 0x45, 0x91, 0xDA, 0x3A, 0xC4, 0x9E, 0x85, 0x3B, 0x54, 0xAA, 0x74, 0x61, 0xE2, 0x13, 0xF9,
+    0x01, 0x6C, 0x4A, 0xD7, 0x8B, 0x0D, 0xCF, 0x08, 0xD2, 0xB2, 0x62, 0x61, 0xC5, 0xA3, 0x31, 0xC8,
+    0x86, 0x58, 0x41, 0xDF, 0xF7, 0x20, 0x58, 0xFA, 0x6F, 0xFA, 0x2C, 0xED, 0x32, 0xBF, 0xA1, 0xAA,
+    0x7E, 0xC3, 0x11, 0x65, 0xC3, 0xAC, 0xF5, 0x1C, 0xBF, 0x11, 0xAA, 0x3E, 0xAB, 0x0A, 0x60, 0xC7,
+    0x60, 0xEA, 0x21, 0x50, 0xB6, 0x1B, 0xA6, 0x96, 0xA5, 0x01, 0x51, 0xCB, 0xB4, 0x5F, 0xEB, 0x9F,
+    0x91, 0x0A, 0xA6, 0x52, 0xB6, 0x21, 0x4B, 0x2A, 0x14, 0x16, 0xED, 0xFE, 0xC6, 0xCF, 0x5B, 0xBB,
+    0x23, 0x73, 0xC3, 0x56, 0xE5, 0x60, 0x10, 0xF1, 0x5C, 0x32, 0x9C, 0xF9, 0x9C, 0x76, 0x0A, 0x27,
+    0x05, 0x87, 0x04, 0x1E, 0xD5, 0x15, 0xF3, 0xB7, 0xEC, 0x6E, 0xE8, 0xD5, 0x02, 0xF2, 0xD7, 0x50,
+    0xC7, 0x15, 0x3C, 0x32, 0x98, 0x23, 0xA5, 0x0F, 0x2D, 0xA1, 0x05, 0x2E, 0x1E, 0x0D, 0xB2, 0xDC,
+    0x8B, 0x8C, 0x13, 0x3A, 0x38, 0x9C, 0x16, 0xB8, 0x76, 0x91, 0x6A, 0xC0, 0xE3, 0xE1, 0x4F, 0x47,
+    0xDC, 0x7E, 0x83, 0x7C, 0x0E, 0xA7, 0x93, 0xC1, 0xF1, 0x91, 0x16, 0x51, 0x27, 0x49, 0x9D, 0x34,
+    0x5B, 0xEF, 0x6A, 0xF4, 0xB4, 0x26, 0xB0, 0xD9, 0x51, 0x31, 0xF6, 0x2B, 0xDF, 0x14, 0xA7, 0x76,
+    0xBA, 0x13, 0x0C, 0x67, 0xB0, 0x7B, 0x42, 0x1D, 0xFB, 0x03, 0x94, 0xC5, 0xB5, 0x3C, 0xC0, 0xE1,
+    0xA0, 0x77, 0xB1, 0xC5, 0x21, 0x09, 0x43, 0x44, 0xC5, 0x72, 0xF6, 0xAE, 0xFD, 0x5D, 0x9B, 0x13,
+    0xB6, 0xA3, 0xA6, 0x25, 0x52, 0xE3, 0xE0, 0xC2, 0x17, 0x49, 0x17, 0x06, 0x8F, 0x27, 0x26, 0x7F,
+    0x52, 0xFA, 0x89, 0x70, 0x39, 0xDF, 0xA3, 0xEF, 0x1D, 0x3B, 0xDC, 0x10, 0x68, 0x71, 0xD1, 0x83,
+    0x4B, 0xC8, 0xDD, 0xF4, 0x5B, 0x4B, 0x11, 0x11, 0xC9, 0x65, 0xDC, 0x2B, 0x9F, 0x80, 0x66, 0x61,
+    0x82, 0xFE, 0xFB, 0xF5, 0x1D, 0xCD, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0x7B, 0x95, 0xB3,
+    0x22, 0x2B, 0x5A, 0x4A, 0x44, 0x0A, 0x57, 0x74, 0x04, 0xB7, 0x14, 0x47, 0xBC, 0xFF, 0x80, 0x14,
+    0x24, 0x45, 0x2A, 0xEA, 0x34, 0x69, 0x28, 0x28, 0xA2, 0xC4, 0xD4, 0x34, 0x34, 0xF4, 0xD7, 0xD0,
+    0x90, 0x82, 0x86, 0x82, 0x2A, 0xF6, 0x4F, 0xB0, 0x84, 0xA8, 0x71, 0x41, 0x8F, 0x0B, 0x23, 0x5D,
+    0xA4, 0xB3, 0x97, 0x79, 0xCF, 0xBE, 0x0F, 0x45, 0x10, 0x52, 0xC6, 0xD2, 0xAD, 0xEE, 0xD6, 0x3B,
+    0x33, 0xEF, 0xBD, 0x79, 0xB3, 0x27, 0x32, 0x93, 0x6D, 0x91, 0x46, 0x9E, 0x88, 0xCC, 0xE5, 0xAB,
+    0x48, 0xE1, 0x1B, 0x91, 0xCC, 0xE7, 0x22, 0xF1, 0x5C, 0xEE, 0xF4, 0x9C, 0xD6, 0x22, 0x91, 0x5F,
+    0x88, 0xA4, 0x95, 0x15, 0x39, 0x97, 0xC8, 0x05, 0xAD, 0x98, 0xD2, 0xD4, 0x5B, 0x9F, 0xCB, 0xD8,
+    0x7B, 0x5F, 0x5A, 0x5D, 0xF2, 0xE4, 0x83, 0xD3, 0x13, 0x38, 0x9F, 0x71, 0xD1, 0x02, 0x92, 0xB6,
+    0xF2, 0x50, 0x12, 0xEF, 0xE7, 0xA2, 0x47, 0x34, 0xC6, 0xA3, 0xF6, 0x69, 0xEF, 0x98, 0x76, 0x81,
+    0x25, 0x6E, 0x78, 0xB8, 0xD4, 0x25, 0xF4, 0xF8, 0x6A, 0x6F, 0x05, 0x75, 0xE8, 0x24, 0xD5, 0x62,
+    0x22, 0x7E, 0xCC, 0xA7, 0x3C, 0x92, 0x0A, 0x6F, 0x3A, 0x2C, 0x86, 0xD9, 0x12, 0x64, 0x93, 0x2B,
+    0x6E, 0xB4, 0xDC, 0xF8, 0x7E, 0x9C, 0x83, 0xB8, 0xC6, 0x19, 0x80, 0x01, 0x1A, 0x0D, 0xBA, 0x00,
+    0x0E, 0xC3, 0x7A, 0x96, 0x39, 0x2E, 0xB0, 0x84, 0xC4, 0x65, 0x6B, 0x6E, 0x78, 0xDF, 0x29, 0x2E,
+    0xD4, 0x02, 0xC7, 0x4A, 0x75, 0xF3, 0xDE, 0x61, 0x83, 0x87, 0x18, 0x60, 0xB5, 0x66, 0xD0, 0x83,
+    0x84, 0x86, 0x98, 0xEE, 0x56, 0x25, 0x27, 0xFD, 0xA0, 0x64, 0xD8, 0x69, 0x43, 0x20, 0x64, 0xE2,
+    0x64, 0x4A, 0x1D, 0x15, 0xDC, 0x02, 0x25, 0xDE, 0x5E, 0xBF, 0x1C, 0x54, 0x24, 0x15, 0x88, 0x18,
+    0x7A, 0x17, 0xE4, 0xD4, 0x10, 0xB5, 0x29, 0xE1, 0xC4, 0xFF, 0x64, 0xBA, 0xAD, 0x03, 0xA1, 0xFE,
+    0x80, 0xD5, 0x51, 0x93, 0x5A, 0x22, 0x32, 0xCE, 0xDC, 0x4A, 0xE1, 0x88, 0x9A, 0xA4, 0xF9, 0x4A,
+    0xA4, 0xE8, 0xF7, 0xD1, 0x4C, 0x20, 0x63, 0x89, 0x90, 0x9E, 0x9A, 0x68, 0xD0, 0x20, 0x63, 0xBF,
+    0xA1, 0x1A, 0x65, 0x2C, 0x64, 0x25, 0x52, 0x02, 0x00, 0x90, 0xB1, 0xA3, 0xF2, 0x4B, 0x4D, 0x0A,
+    0x36, 0x44, 0xF6, 0x28, 0x1E, 0x63, 0x76, 0x88, 0x2E, 0x63, 0xC2, 0xD4, 0xDD, 0x70, 0xD2, 0x85,
+    0xD6, 0x85, 0x91, 0xA2, 0x5A, 0x5E, 0xD3, 0x47, 0xFB, 0x72, 0xBC, 0x20, 0x0D, 0xFD, 0xCC, 0xE1,
+    0xA2, 0xB0, 0x19, 0x4D, 0xC4, 0xB2, 0xF0, 0x50, 0x80, 0x46, 0xD3, 0x42, 0x19, 0x6A, 0xD1, 0x41,
+    0x5F, 0xF4, 0xDD, 0x14, 0xFA, 0x2F, 0xCB, 0x4E, 0x97, 0x1E, 0x9A, 0x90, 0xB1, 0xBA, 0x54, 0x01,
+    0xC4, 0xF9, 0x19, 0xCE, 0xBC, 0x03, 0x7D, 0xDB, 0xAE, 0x01, 0x3D, 0xBB, 0xB5, 0x4F, 0x87, 0x74,
+    0xCB, 0x82, 0x34, 0x2B, 0xD0, 0xEC, 0x97, 0x6E, 0x61, 0x0A, 0x5B, 0xAE, 0xDD, 0xB2, 0x69, 0x9F,
+    0xC3, 0x13, 0x20, 0x80, 0x37, 0x2C, 0x5A, 0x01, 0xB0, 0x4E, 0x82, 0x6E, 0xED, 0x27, 0xB6, 0x25,
+    0xD8, 0x34, 0x3E, 0x70, 0x05, 0x14, 0x33, 0x5E, 0x1B, 0x0C, 0x9D, 0xEC, 0xB8, 0xD1, 0x2C, 0x11,
+    0x45, 0x2E, 0xCA, 0x95, 0x8C, 0x92, 0xB6, 0xBF, 0xDC, 0x60, 0xBA, 0x61, 0xD8, 0x1E, 0xFC, 0x67,
+    0x78, 0x83, 0x22, 0x1F, 0x34, 0x8F, 0x5B, 0x53, 0xD2, 0x73, 0x91, 0x32, 0x12, 0x88, 0x0E, 0x1F,
+    0x37, 0x9C, 0xDD, 0x73, 0x25, 0x4C, 0xD5, 0xC9, 0x8C, 0xA0, 0x8A, 0x4A, 0x5E, 0x51, 0x76, 0x33,
+    0xF6, 0xBB, 0xD1, 0x54, 0xD7, 0x43, 0xCE, 0xED, 0x21, 0x73, 0xBB, 0xD1, 0x66, 0xFB, 0x03, 0x41,
+    0x61, 0x9D, 0xE0, 0xC7, 0x9B, 0xC1, 0x0C, 0x7F, 0xF1, 0x7F, 0xE1, 0xDF, 0x0F, 0x3E, 0x82, 0x44,
+    0xFD, 0x65, 0xA3, 0x89, 0x2B, 0x09, 0xD4, 0x87, 0x83, 0x57, 0x48, 0x77, 0x9C, 0xA1, 0x82, 0x8E,
+    0x25, 0x51, 0x09, 0xFB, 0x8D, 0x52, 0x66, 0x9C, 0xBD, 0x5C, 0x1E, 0x3B, 0x65, 0xA5, 0x29, 0x7A,
+    0x51, 0xCD, 0x32, 0xE5, 0xA2, 0x87, 0x77, 0xBD, 0xC0, 0x03, 0xFB, 0x07, 0xE8, 0x76, 0x5C, 0x09,
+    0x5C, 0xDE, 0x69, 0xB1, 0x8F, 0x47, 0xFA, 0xCD, 0x73, 0x72, 0x21, 0xAC, 0xDE, 0x1B, 0x90, 0x7A,
+    0x2E, 0x83, 0x9F, 0xD5, 0x53, 0xE3, 0x4C, 0xED, 0xAD, 0x07, 0xA0, 0x40, 0xB9, 0x24, 0x56, 0x1C,
+    0xA6, 0x04, 0xAF, 0x99, 0x5E, 0x66, 0x9B, 0x4F, 0x5A, 0x3F, 0x02, 0x99, 0x6F, 0x8D, 0xCE, 0xB4,
+    0xE6, 0x08, 0x3A, 0x83, 0x51, 0x14, 0xAB, 0x15, 0x4A, 0x20, 0x6A, 0x81, 0x5E, 0x03, 0xBD, 0xEA,
+    0x22, 0x49, 0x2D, 0xCF, 0x01, 0xDD, 0xD4, 0x80, 0x94, 0x7D, 0xD2, 0xD2, 0xE1, 0xA8, 0x03, 0xBA,
+    0x5C, 0xF8, 0x2B, 0x5C, 0x23, 0x2F, 0xCA, 0xD5, 0xB4, 0xE9, 0xAB, 0x9D, 0xA0, 0xA8, 0x47, 0x43,
+    0xD1, 0xF7, 0x11, 0x67, 0x76, 0x02, 0x0D, 0x57, 0xCF, 0xB6, 0x04, 0x0A, 0x30, 0xA8, 0xE9, 0xE8,
+    0x04, 0x17, 0x0A, 0xA6, 0x1A, 0xC8, 0x23, 0x4F, 0x16, 0xBB, 0x77, 0xBA, 0xE5, 0xEF, 0x7F, 0x67,
+    0xA6, 0x62, 0x72, 0xB1, 0x4E, 0x47, 0xDD, 0x34, 0x11, 0xEF, 0x11, 0xCD, 0x19, 0x63, 0xCC, 0xE4,
+    0xC4, 0xFD, 0x83, 0x55, 0xD8, 0x07, 0x33, 0xE8, 0xB0, 0x18, 0x3A, 0x14, 0xB5, 0xD6, 0xE3, 0x62,
+    0xF5, 0xA5, 0x9A, 0x5D, 0x21, 0xB3, 0x41, 0x67, 0x80, 0xFD, 0x14, 0x57, 0xB8, 0xD5, 0xC1, 0x1B,
+    0xFB, 0xD3, 0x5F, 0x6A, 0xE2, 0x14, 0x9D, 0x31, 0x94, 0x9F, 0xED, 0x89, 0xAE, 0xD7, 0xFF, 0x6C,
+    0xFA, 0x8F, 0xC5, 0xEE, 0xC4, 0xE3, 0x99, 0x06, 0x53, 0xDC, 0xDC, 0x6C, 0xCE, 0x3D, 0x78, 0xFE,
+    0x00, 0xD5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x9D, 0xBD, 0x55, 0xCE, 0x42, 0x2E, 0xB6, 0x45,
+    0x04, 0xE1, 0x1A, 0x09, 0xC9, 0x0D, 0x6D, 0xE2, 0xFD, 0x07, 0xA4, 0x09, 0x0D, 0x7F, 0x00, 0x89,
+    0x22, 0x6D, 0x8A, 0x24, 0xF6, 0x4F, 0xA0, 0xA1, 0xA7, 0x41, 0x42, 0x69, 0x68, 0x28, 0x52, 0x00,
+    0x36, 0x20, 0x51, 0x5B, 0x42, 0xF4, 0x57, 0x84, 0x1A, 0x17, 0x2E, 0x0C, 0xF8, 0xBC, 0xBC, 0x37,
+    0x7B, 0x47, 0xE0, 0xA2, 0xA4, 0x44, 0xC2, 0xC5, 0x9C, 0xBD, 0x5E, 0xCF, 0xCC, 0xFB, 0xD8, 0x39,
+    0x11, 0x91, 0x74, 0x81, 0x20, 0xB6, 0x67, 0x9C, 0x2D, 0x19, 0x25, 0x68, 0x2C, 0x1B, 0xB9, 0xE6,
+    0xBA, 0x15, 0x26, 0x2F, 0x26, 0x84, 0xD0, 0x89, 0x0D, 0xE1, 0x74, 0x44, 0x6C, 0xC5, 0x20, 0x7A,
+    0xE6, 0x89, 0x19, 0xF4, 0x5E, 0xEA, 0x8A, 0xB1, 0xD0, 0x6C, 0xB9, 0x16, 0x73, 0x5A, 0xCC, 0x8E,
+    0x8C, 0x66, 0x12, 0x79, 0x86, 0x4D, 0x5E, 0x8A, 0xB0, 0x28, 0x5A, 0x71, 0x61, 0x74, 0x9D, 0xC8,
+    0x76, 0xD0, 0xD7, 0xDF, 0x3D, 0x73, 0xBC, 0x95, 0x02, 0x4B, 0x85, 0x77, 0xE1, 0xC5, 0xC3, 0xD0,
+    0xA0, 0x1C, 0xAB, 0xD6, 0x88, 0x03, 0xB6, 0x87, 0x80, 0x0C, 0x78, 0x40, 0xEB, 0xA6, 0x0E, 0x4F,
+    0xB5, 0xB0, 0x63, 0xB1, 0xB4, 0x5B, 0x17, 0x99, 0x4D, 0xDA, 0x4D, 0x75, 0x05, 0x94, 0x74, 0x98,
+    0x57, 0x92, 0x85, 0xCF, 0x1D, 0x42, 0xE8, 0x25, 0x6B, 0x8B, 0x11, 0x19, 0x6C, 0x90, 0xB4, 0x01,
+    0x04, 0xDB, 0xA2, 0x77, 0xD3, 0x09, 0xBA, 0x3A, 0x93, 0x64, 0x90, 0x1D, 0xE6, 0x74, 0x15, 0x5E,
+    0xDB, 0x1F, 0xAF, 0x90, 0x13, 0xA5, 0x1B, 0xB6, 0xD1, 0x01, 0xF5, 0x34, 0x88, 0x64, 0xE7, 0x8A,
+    0x6B, 0x5A, 0x11, 0x79, 0x7F, 0x8E, 0x3D, 0xF9, 0x6A, 0x4F, 0x23, 0x09, 0x83, 0x6C, 0x4F, 0xFE,
+    0xFF, 0x22, 0xF4, 0xAA, 0xCB, 0x0D, 0x4A, 0xA0, 0x16, 0xB6, 0x0A, 0xD9, 0xC4, 0x4E, 0x6B, 0x7F,
+    0xD1, 0x23, 0x9A, 0xC0, 0x95, 0x75, 0x97, 0xBE, 0x36, 0x8A, 0x87, 0x84, 0xC4, 0x3D, 0x0A, 0x86,
+    0xCD, 0x42, 0x12, 0x84, 0x64, 0xBC, 0xB0, 0xE4, 0xEF, 0xAB, 0xAE, 0x1E, 0xE3, 0xBB, 0x65, 0xA1,
+    0x54, 0x79, 0xB3, 0xB4, 0xF8, 0x7C, 0x24, 0x9C, 0x37, 0x64, 0x41, 0xC5, 0xC9, 0x48, 0x7C, 0x5A,
+    0x49, 0x59, 0xA9, 0x76, 0x32, 0xF0, 0x75, 0x71, 0x0A, 0x70, 0x69, 0x08, 0xC8, 0x89, 0x0F, 0x51,
+    0x2B, 0x7C, 0xAB, 0xC0, 0xD5, 0x03, 0x16, 0x77, 0xAB, 0xBA, 0xD6, 0x1F, 0x0C, 0xA0, 0x3A, 0xEE,
+    0x41, 0x28, 0x19, 0x4C, 0x7D, 0xFE, 0x27, 0xE0, 0xF8, 0xF3, 0x4E, 0xA3, 0x8D, 0x58, 0x77, 0x33,
+    0x3D, 0x3B, 0x6D, 0x4A, 0x34, 0x37, 0x64, 0xB6, 0xA9, 0xAD, 0x79, 0x29, 0x32, 0x7F, 0xAE, 0x55,
+    0xF2, 0x46, 0x8A, 0x8A, 0xE6, 0x30, 0x80, 0x95, 0xF4, 0xEA, 0x51, 0xAE, 0x35, 0xEA, 0x15, 0x10,
+    0x68, 0xD1, 0x24, 0xC4, 0xCC, 0xDB, 0xF5, 0x5A, 0x50, 0x5D, 0x13, 0x1A, 0x6B, 0xC1, 0x65, 0xAA,
+    0xCF, 0xB5, 0xA5, 0x24, 0xD3, 0xFE, 0xFE, 0x41, 0x47, 0x6F, 0xD1, 0x53, 0x41, 0x75, 0x53, 0x29,
+    0x7B, 0xFA, 0x78, 0xBD, 0x16, 0x54, 0x17, 0xE8, 0x94, 0x21, 0x6D, 0xD9, 0x4A, 0xDD, 0x00, 0xA1,
+    0x67, 0xE7, 0x6E, 0x54, 0xF9, 0x4A, 0x28, 0xDF, 0x62, 0x8D, 0xA6, 0xBA, 0xC3, 0x76, 0x49, 0x78,
+    0x42, 0x2D, 0x8F, 0x73, 0xD4, 0x69, 0x80, 0xF8, 0xA6, 0xCC, 0xB1, 0xA4, 0x32, 0x71, 0x83, 0x6A,
+    0x73, 0xDD, 0xD3, 0x27, 0xE8, 0x5A, 0xD4, 0xB1, 0x01, 0x9F, 0x4C, 0x7E, 0x09, 0x79, 0xCD, 0x00,
+    0x78, 0xB6, 0x4D, 0x70, 0xC8, 0x3C, 0x28, 0x38, 0x82, 0x68, 0xB6, 0xC3, 0x93, 0xAB, 0xF0, 0x74,
+    0x8C, 0xA2, 0xB6, 0x07, 0x19, 0xAE, 0x01, 0xEC, 0x1A, 0x00, 0xED, 0x00, 0x0B, 0x64, 0x80, 0x6B,
+    0x20, 0x01, 0xB7, 0x81, 0x3C, 0x6C, 0x2C, 0xBC, 0x92, 0x37, 0x5E, 0x26, 0x8F, 0xB6, 0x4F, 0xD6,
+    0xE4, 0x29, 0x0D, 0xA1, 0x75, 0x91, 0x80, 0x7C, 0x3A, 0x3D, 0xAD, 0x07, 0xB5, 0x18, 0x1A, 0x5B,
+    0x11, 0x1A, 0x3D, 0xAF, 0xE4, 0x55, 0x2B, 0xF2, 0x92, 0x48, 0xDE, 0x9A, 0xD0, 0x2F, 0xFB, 0x8F,
+    0x82, 0x24, 0x60, 0x23, 0x1B, 0x24, 0x47, 0x29, 0xB0, 0x84, 0x65, 0x1B, 0x09, 0xCD, 0x46, 0xC9,
+    0x51, 0xAA, 0xA6, 0x73, 0x8E, 0x68, 0x05, 0xBA, 0xD6, 0x91, 0xC3, 0x93, 0x27, 0x3A, 0x47, 0x00,
+    0xE3, 0xAB, 0xDF, 0x7C, 0x77, 0x74, 0xD0, 0x8B, 0xFD, 0x09, 0x57, 0x39, 0x16, 0x2A, 0xCF, 0x5D,
+    0x0B, 0x1D, 0xB3, 0x0A, 0xE0, 0x76, 0xA4, 0x14, 0xD3, 0x43, 0xFD, 0xA4, 0xC1, 0xF0, 0x2A, 0xF0,
+    0x24, 0x03, 0x9F, 0x5A, 0x07, 0x27, 0xF8, 0x5A, 0x64, 0x44, 0xD3, 0x69, 0x07, 0x93, 0x16, 0x55,
+    0x5D, 0xD1, 0x3D, 0xB2, 0x67, 0x80, 0xC7, 0x34, 0xD2, 0x2F, 0x3A, 0x39, 0x44, 0x33, 0xF7, 0x66,
+    0xC3, 0x75, 0x27, 0x75, 0x11, 0x07, 0x04, 0x79, 0xD2, 0xD3, 0x09, 0xE6, 0xF4, 0xAC, 0x71, 0xF2,
+    0x93, 0x50, 0xD0, 0xAE, 0x14, 0x0B, 0x2A, 0x2A, 0xB5, 0x3A, 0x2F, 0xB8, 0xBB, 0xAC, 0xD4, 0x90,
+    0x71, 0xF7, 0xB8, 0x1A, 0xA7, 0x3C, 0xBA, 0x64, 0x94, 0xCC, 0xB8, 0x31, 0x3A, 0xC6, 0xE8, 0x64,
+    0x3A, 0x91, 0x36, 0x7B, 0x7D, 0xDB, 0x7E, 0xF8, 0xD8, 0x1C, 0xBA, 0x3E, 0xF1, 0x77, 0x37, 0x1A,
+    0x99, 0xA1, 0x91, 0x9D, 0x68, 0x99, 0x33, 0x7C, 0x8A, 0x34, 0x94, 0x11, 0x99, 0xE3, 0x3A, 0x66,
+    0x2E, 0xAC, 0xC1, 0x09, 0x4E, 0x38, 0xD0, 0x9B, 0xFD, 0x95, 0xAB, 0x83, 0xE4, 0x31, 0x90, 0x46,
+    0x1C, 0xCB, 0xD0, 0x6C, 0xED, 0x5D, 0x0D, 0x95, 0x20, 0xB4, 0x79, 0x36, 0x4E, 0x43, 0x28, 0x34,
+    0x9D, 0x2B, 0xE4, 0x2D, 0x43, 0x85, 0xD9, 0xB8, 0xDE, 0xF7, 0xD7, 0x6B, 0x02, 0xC3, 0x31, 0x8B,
+    0x43, 0x87, 0xBE, 0xD2, 0x34, 0x44, 0xA5, 0x13, 0x96, 0x98, 0x89, 0x57, 0xCF, 0x7D, 0x89, 0x7D,
+    0x73, 0x1D, 0x79, 0xB2, 0xB5, 0x07, 0xC1, 0xDF, 0xD3, 0xEC, 0x9B, 0xFF, 0x2C, 0x95, 0x62, 0x22,
+    0x42, 0xE2, 0x5A, 0xDD, 0x12, 0xFA, 0x2E, 0x6E, 0x91, 0x32, 0x69, 0xE3, 0xB9, 0x19, 0xE3, 0xFF,
+    0x30, 0xED, 0xBD, 0x54, 0xBF, 0xFF, 0x9B, 0xEB, 0x17, 0xC5, 0x55, 0xB1, 0x8E, 0xDC, 0x36, 0x10,
+    0x7D, 0x92, 0x82, 0x13, 0x60, 0x15, 0xAA, 0x0C, 0xB8, 0x8A, 0x9A, 0xB4, 0x89, 0x5A, 0x17, 0x17,
+    0x53, 0x80, 0xCB, 0x34, 0xD7, 0xA4, 0xCF, 0x1F, 0xB8, 0x75, 0x71, 0xB6, 0xD4, 0xB9, 0x70, 0xE3,
+    0xFF, 0x70, 0xE3, 0xC2, 0x45, 0x8A, 0x33, 0xB4, 0x70, 0x7E, 0x40, 0xBD, 0x1B, 0x01, 0x71, 0x91,
+    0xCE, 0x04, 0x22, 0x20, 0x82, 0xA1, 0x5D, 0xFA, 0xBD, 0xA1, 0x6E, 0xB5, 0x7B, 0xE7, 0x3E, 0x5A,
+    0x88, 0x0B, 0x3E, 0x92, 0xC3, 0x99, 0x37, 0x6F, 0x46, 0x40, 0xFD, 0x06, 0xE9, 0x1E, 0x70, 0x3B,
+    0x64, 0x33, 0xD0, 0x36, 0x28, 0x3C, 0x10, 0x80, 0x72, 0x44, 0x42, 0xBC, 0x26, 0xBE, 0x70, 0xB9,
+    0x43, 0x3E, 0x01, 0x3D, 0x71, 0x8F, 0xE4, 0x40, 0x7C, 0x40, 0x16, 0x8F, 0xE5, 0x5C, 0x0E, 0x1D,
+    0xCA, 0x09, 0x69, 0x68, 0xE0, 0x3C, 0x32, 0x9E, 0xFE, 0x19, 0x28, 0x1A, 0xA4, 0x03, 0x70, 0x09,
+    0xE2, 0xC0, 0x05, 0xAD, 0x02, 0x55, 0x23, 0xBB, 0xC5, 0xA4, 0xB3, 0x49, 0xC0, 0xF9, 0x73, 0x05,
+    0x3C, 0xA1, 0xFD, 0x06, 0xF9, 0x0E, 0xE9, 0x08, 0x4C, 0x76, 0xB8, 0x26, 0xD4, 0x21, 0x1B, 0x90,
+    0x72, 0x2E, 0x4F, 0x08, 0x75, 0xB2, 0x92, 0x4D, 0x48, 0x38, 0x7F, 0x0F, 0xBC, 0x03, 0x1E, 0x43,
+    0x0E, 0xE0, 0xC3, 0x6A, 0xAA, 0x1C, 0x4E, 0x9D, 0xEF, 0x77, 0xF8, 0xEE, 0xC3, 0xA0, 0xB4, 0xDC,
+    0x76, 0xF2, 0x68, 0x8D, 0x0D, 0x3C, 0x56, 0xF1, 0xFE, 0x18, 0x73, 0xB6, 0xE1, 0x8C, 0xB9, 0x1A,
+    0x8F, 0x54, 0xC9, 0xAA, 0xC5, 0x0C, 0xC6, 0x5C, 0xC7, 0x98, 0xDB, 0x11, 0x17, 0x07, 0x33, 0xFC,
+    0x0B, 0x7E, 0xC5, 0x35, 0xFE, 0x64, 0x04, 0x3E, 0xF5, 0xD9, 0x98, 0x0D, 0xC5, 0xAE, 0xE4, 0xAF,
+    0xEE, 0x5C, 0xE3, 0x9A, 0x16, 0x62, 0x9A, 0x6C, 0xD2, 0xAA, 0x1B, 0x74, 0x7B, 0x90, 0xD9, 0x7C,
+    0x16, 0xF3, 0xA4, 0x95, 0xE6, 0x83, 0xDC, 0x20, 0x90, 0x1B, 0x50, 0x1B, 0x70, 0x10, 0x40, 0x7F,
+    0x8E, 0x40, 0x90, 0x17, 0xB4, 0x54, 0x0D, 0x72, 0x8C, 0x40, 0xDF, 0x08, 0x58, 0x34, 0xA3, 0xE9,
+    0x5E, 0x1E, 0x0A, 0xD8, 0x1B, 0x30, 0x71, 0x99, 0x44, 0x08, 0x08, 0x62, 0xAF, 0x9A, 0x05, 0x3C,
+    0x1B, 0x15, 0x09, 0x43, 0x22, 0xDD, 0x49, 0xAE, 0x84, 0x54, 0x81, 0x2A, 0x40, 0x1F, 0x48, 0x59,
+    0x16, 0x16, 0x03, 0xC4, 0x5E, 0xFB, 0x59, 0xDB, 0x92, 0x29, 0xB2, 0x3B, 0xDA, 0x1F, 0xCF, 0xC3,
+    0x35, 0x52, 0x01, 0xF3, 0x50, 0xF9, 0x48, 0x93, 0xF6, 0x1A, 0xDD, 0xE9, 0xE1, 0x7E, 0x7A, 0xF9,
+    0x64, 0x3C, 0x9B, 0x7A, 0x65, 0x59, 0x69, 0xBD, 0x26, 0xF2, 0xC2, 0x92, 0xBD, 0x61, 0xCC, 0x39,
+    0xE9, 0xE3, 0xDC, 0xB0, 0x8E, 0xD8, 0x8E, 0xF3, 0x5B, 0x2C, 0xF1, 0x9A, 0xA3, 0xD8, 0x49, 0x08,
+    0xD4, 0x4B, 0x3A, 0x47, 0x6C, 0x88, 0x58, 0x23, 0x4C, 0xB2, 0x58, 0x5D, 0x2D, 0x62, 0xEA, 0x9F,
+    0xC4, 0xBB, 0xA7, 0x13, 0xFF, 0xC2, 0xDE, 0x42, 0x09, 0x16, 0x4B, 0xFB, 0xCF, 0x99, 0xAB, 0xC9,
+    0xB8, 0x6D, 0xCF, 0x2D, 0x8E, 0xEA, 0x37, 0x1D, 0xBA, 0x84, 0x22, 0xFC, 0x03, 0x8F, 0xB6, 0xAD,
+    0xBF, 0xDB, 0x7E, 0x93, 0x72, 0x6A, 0x16, 0x23, 0xA1, 0xB9, 0x8D, 0xC5, 0x6C, 0x77, 0xF8, 0x6D,
+    0xAC, 0xCC, 0xB2, 0xDB, 0x6D, 0x23, 0xF3, 0xBF, 0x72, 0x69, 0x65, 0x07, 0xAB, 0xAE, 0x73, 0x63,
+    0x99, 0x99, 0x29, 0xA6, 0x13, 0x63, 0x66, 0x86, 0x99, 0x87, 0x89, 0x3C, 0x6A, 0xF9, 0xD6, 0x8C,
+    0x79, 0xF3, 0x43, 0x71, 0xB0, 0xF0, 0x62, 0x0A, 0x75, 0xB4, 0xB6, 0x50, 0x5D, 0xD0, 0x16, 0xF7,
+    0xF9, 0x2C, 0xDE, 0xD4, 0x0E, 0x67, 0x7E, 0xF3, 0xB9, 0x7A, 0xA6, 0xF1, 0x52, 0x05, 0xCC, 0x98,
+    0x9F, 0xDF, 0x49, 0x65, 0xD9, 0xAC, 0xC5, 0x0C, 0xAB, 0xC7, 0x23, 0xC1, 0x2F, 0x6C, 0xBC, 0xB1,
+    0x71, 0xDE, 0x04, 0x93, 0xFA, 0xDB, 0xCC, 0x43, 0x85, 0x7C, 0x4C, 0x4B, 0xD9, 0x6D, 0xC6, 0xEA,
+    0x7B, 0x66, 0x22, 0x8F, 0x32, 0x73, 0xD1, 0x7B, 0x8B, 0x45, 0x47, 0xDD, 0x99, 0xAC, 0x5C, 0xA3,
+    0x76, 0xB4, 0xA8, 0x08, 0xCB, 0x51, 0x04, 0xB9, 0x86, 0x65, 0x99, 0x2E, 0x3A, 0x56, 0x8E, 0x4A,
+    0xB4, 0x7B, 0x4A, 0x3B, 0xE9, 0x22, 0xAE, 0xCB, 0xBF, 0xC5, 0x69, 0xDB, 0x0E, 0xEA, 0x48, 0x87,
+    0x63, 0xF2, 0x5B, 0xD1, 0x95, 0x86, 0x78, 0x85, 0x37, 0xC0, 0x76, 0x48, 0xF7, 0xE5, 0xBF, 0x1A,
+    0xDB, 0xD7, 0xEC, 0x6F, 0xD9, 0xBE, 0xD4, 0x2D, 0xBE, 0x56, 0xA5, 0x77, 0x74, 0x83, 0xC2, 0xEF,
+    0xF7, 0x04, 0x12, 0x72, 0xCC, 0x4A, 0xB3, 0xBA, 0x39, 0x79, 0x2A, 0x9B, 0x5B, 0xF1, 0x64, 0x96,
+    0xCB, 0xDA, 0x58, 0x30, 0xFA, 0xA3, 0x3A, 0x2C, 0xFF, 0x77, 0xCB, 0x44, 0x8C, 0x29, 0x11, 0x7A,
+    0xF3, 0xC1, 0xC4, 0x6F, 0x6F, 0xD5, 0x45, 0x8E, 0x1C, 0xC5, 0xF0, 0x92, 0x6A, 0xBF, 0xA1, 0xD4,
+    0x17, 0x35, 0x51, 0xB5, 0x5D, 0xF6, 0x62, 0x7A, 0x98, 0xF3, 0xBF, 0xF8, 0xC2, 0x5A, 0xF8, 0xB4,
+    0xA0, 0xFC, 0xEB, 0x80, 0xFA, 0x63, 0x68, 0x5C, 0x17, 0x06, 0x72, 0xE2, 0x7B, 0xB8, 0xE5, 0xBB,
+    0x3D, 0xB0, 0x12, 0x69, 0xBC, 0x8B, 0x9D, 0xC8, 0xFA, 0x64, 0x88, 0x2E, 0x49, 0x78, 0xE5, 0x6D,
+    0x44, 0x0F, 0x93, 0xAB, 0x6C, 0xB8, 0xC1, 0x65, 0x85, 0xE2, 0xD5, 0x80, 0x69, 0x42, 0xC5, 0xBA,
+    0xFB, 0xD2, 0xE9, 0x5C, 0x1E, 0xDB, 0x6B, 0x19, 0x90, 0xFC, 0x37, 0xC3, 0xD5, 0x43, 0x36, 0x04,
+    0x5C, 0x97, 0x73, 0xB9, 0x13, 0xCD, 0xF8, 0x49, 0xA4, 0x2A, 0xCA, 0x71, 0xD5, 0x85, 0x34, 0x13,
+    0x85, 0x70, 0xEF, 0x11, 0x49, 0xEC, 0xBC, 0xD6, 0x7A, 0x4D, 0xCE, 0xFA, 0xE0, 0xA8, 0x8D, 0x45,
+    0xB5, 0xEF, 0x57, 0xA9, 0x5B, 0x49, 0xA8, 0xCE, 0x73, 0xBF, 0x56, 0x8C, 0x96, 0x93, 0xE3, 0xB2,
+    0x9C, 0xE6, 0x57, 0xCC, 0x3E, 0x63, 0xB6, 0x5C, 0x7D, 0x7D, 0x1B, 0x3E, 0x86, 0x10, 0x66, 0xC7,
+    0xE1, 0x29, 0x5F, 0xDF, 0x73, 0xD0, 0x8D, 0x3F, 0x5A, 0x49, 0xDB, 0x87, 0x46, 0x12, 0xE5, 0x67,
+    0x07, 0x0F, 0xBA, 0xFB, 0x8E, 0x5D, 0x9D, 0x64, 0x85, 0x57, 0x15, 0xC3, 0x49, 0x46, 0x9A, 0x58,
+    0x00, 0x2F, 0xD7, 0xF0, 0xD4, 0x78, 0xE8, 0x40, 0xBA, 0x6E, 0x97, 0x8B, 0xC5, 0x78, 0x27, 0x89,
+    0x4D, 0x14, 0xB1, 0xDE, 0x76, 0x8F, 0xFF, 0xF9, 0xF9, 0x06, 0xB5, 0x55, 0x3B, 0x6E, 0xD5, 0x40,
+    0x14, 0x3D, 0x63, 0x17, 0x96, 0x70, 0x31, 0x14, 0x34, 0x08, 0x09, 0x37, 0x14, 0x74, 0x5E, 0x01,
+    0x1A, 0x03, 0x1B, 0x60, 0x1F, 0x14, 0xD9, 0x00, 0x89, 0x2D, 0xB1, 0x01, 0x76, 0x40, 0x93, 0x02,
+    0x44, 0x91, 0x86, 0x32, 0x89, 0x2D, 0x52, 0xD0, 0x1A, 0x1A, 0xDA, 0x57, 0x51, 0x40, 0xE3, 0xC2,
+    0x85, 0x85, 0x6C, 0x0F, 0xE7, 0xCE, 0xC7, 0xEF, 0x25, 0x10, 0x51, 0x31, 0x7A, 0x9E, 0x19, 0xBF,
+    0xB9, 0x73, 0xEF, 0x3D, 0xE7, 0x7E, 0x0C, 0xBC, 0x07, 0x50, 0x74, 0x40, 0x32, 0x73, 0x63, 0x1A,
+    0x20, 0x1D, 0xB9, 0x69, 0xF9, 0xE8, 0x1D, 0xA7, 0x25, 0x1C, 0xA7, 0xF1, 0x38, 0x1B, 0xB8, 0xB1,
+    0xE1, 0x58, 0xC9, 0x71, 0x29, 0xC7, 0x13, 0x37, 0x75, 0x05, 0xE4, 0xF1, 0xB8, 0xF8, 0xF5, 0xC1,
+    0x7E, 0xB2, 0xD6, 0x4E, 0x86, 0xD3, 0x73, 0x3E, 0x43, 0xCB, 0x09, 0x7F, 0x19, 0x96, 0xF7, 0x0B,
+    0x1A, 0x4D, 0xE4, 0xD4, 0xF4, 0x34, 0x31, 0x05, 0x1D, 0x25, 0x4D, 0x64, 0xF3, 0x26, 0xF8, 0x08,
+    0x38, 0x06, 0x66, 0xA8, 0x09, 0xC9, 0x88, 0x74, 0x40, 0xB6, 0x43, 0xDE, 0x43, 0x77, 0x28, 0x1A,
+    0x94, 0xBC, 0x0B, 0x9C, 0x00, 0x17, 0x4E, 0x64, 0x46, 0x32, 0x89, 0x88, 0x97, 0xD2, 0x94, 0xB2,
+    0x0D, 0x7F, 0x85, 0xAD, 0xAE, 0xD9, 0xAE, 0x7B, 0x31, 0x6F, 0x2B, 0xDA, 0x4E, 0x17, 0x31, 0xAC,
+    0x07, 0x67, 0x55, 0x86, 0x30, 0xE3, 0xD0, 0x0A, 0x40, 0xAC, 0x08, 0xD4, 0x84, 0xB7, 0xBC, 0xE1,
+    0xDB, 0x13, 0x72, 0x93, 0x0C, 0xF4, 0x55, 0x37, 0x64, 0xE0, 0xD8, 0xBF, 0x09, 0x77, 0x8E, 0x8F,
+    0xA2, 0x0F, 0x4C, 0xDE, 0x78, 0x9B, 0x03, 0x3D, 0x1D, 0x19, 0x59, 0x53, 0xB2, 0x32, 0x6A, 0x4E,
+    0x5D, 0xE4, 0x27, 0xED, 0x70, 0xA7, 0x3A, 0x87, 0x1A, 0x75, 0x03, 0xA3, 0x46, 0xFA, 0x4F, 0x6C,
+    0x17, 0xE9, 0x4E, 0x80, 0x0A, 0x76, 0x08, 0x56, 0x01, 0xE6, 0xE0, 0x22, 0x17, 0x7F, 0x9C, 0x4A,
+    0x46, 0x27, 0x11, 0x0F, 0x4D, 0x74, 0xFC, 0x52, 0xC2, 0x74, 0x78, 0xEC, 0x00, 0x18, 0x42, 0x49,
+    0x2D, 0x41, 0xD6, 0x8B, 0xC3, 0x29, 0xB3, 0x12, 0x09, 0x97, 0x02, 0xCE, 0xD7, 0x4C, 0xE4, 0x18,
+    0xCA, 0x99, 0x51, 0xE6, 0x91, 0xEE, 0xE9, 0x73, 0xD9, 0x31, 0x14, 0xA6, 0xD3, 0x13, 0x8C, 0x70,
+    0x58, 0x23, 0x04, 0xC9, 0x31, 0xE3, 0x12, 0xE1, 0xCF, 0xFB, 0x10, 0x3E, 0x03, 0xD8, 0x92, 0xF0,
+    0x1A, 0x49, 0x86, 0x4A, 0x26, 0x1C, 0x64, 0xC3, 0xE8, 0xFD, 0x16, 0x44, 0x8C, 0x95, 0xF3, 0x58,
+    0x9E, 0xA2, 0x3A, 0x21, 0x94, 0x95, 0x1C, 0x2C, 0x38, 0x66, 0x74, 0x66, 0xDA, 0x9F, 0x3D, 0x03,
+    0x22, 0x1A, 0xC5, 0x99, 0x01, 0xDB, 0x95, 0x92, 0x18, 0xC5, 0x3B, 0x81, 0x28, 0x4F, 0x40, 0xE8,
+    0xC7, 0xBD, 0xB8, 0x49, 0x86, 0xB8, 0x93, 0xBB, 0x7E, 0x94, 0x5B, 0x5E, 0x5C, 0x04, 0xA1, 0x53,
+    0xC7, 0xA5, 0xA3, 0x32, 0x8A, 0xE5, 0x43, 0x14, 0xD3, 0xBB, 0xCB, 0x20, 0xAE, 0xBF, 0x4E, 0x51,
+    0xC5, 0xE7, 0x90, 0x38, 0x30, 0x6F, 0x9B, 0xB8, 0x5B, 0xB7, 0x4C, 0x9B, 0xB6, 0x7C, 0x1F, 0x0E,
+    0x33, 0xDF, 0x0D, 0xB5, 0x15, 0x46, 0xB2, 0xA5, 0x7B, 0xB6, 0x5D, 0x28, 0xC6, 0x4D, 0xC9, 0xB0,
+    0x5D, 0x88, 0xB6, 0x32, 0x1B, 0x31, 0x14, 0x9B, 0xBA, 0xBA, 0x0E, 0x3B, 0xB5, 0xD4, 0x3F, 0xCE,
+    0x9C, 0xEE, 0x6C, 0x94, 0x64, 0x73, 0x62, 0x3D, 0x99, 0x77, 0xBC, 0xD4, 0x15, 0x77, 0x62, 0x4F,
+    0xAD, 0x49, 0xD8, 0xED, 0x8D, 0xEA, 0x68, 0xC0, 0x55, 0xBD, 0x1F, 0x1B, 0x98, 0x74, 0x2F, 0xB6,
+    0xF1, 0x76, 0xF7, 0x5A, 0x61, 0x25, 0xFE, 0xFF, 0xCC, 0x3B, 0xA7, 0xBD, 0x3F, 0x45, 0x73, 0xC8,
+    0xB5, 0xF1, 0x92, 0x27, 0x7E, 0x39, 0xF7, 0x8B, 0x87, 0xAF, 0xA6, 0xC3, 0x40, 0xA5, 0x7E, 0xC9,
+    0xBC, 0x47, 0xF9, 0x97, 0x33, 0xF2, 0xA1, 0x8E, 0xEC, 0x29, 0xF0, 0x92, 0x29, 0x05, 0x3C, 0x58,
+    0xDF, 0x5C, 0x57, 0x79, 0x5D, 0x73, 0x08, 0xA8, 0x9D, 0x0E, 0x16, 0x65, 0x23, 0xA7, 0xF7, 0xFD,
+    0xF2, 0xCA, 0x2F, 0xC1, 0x60, 0xB0, 0x14, 0xBC, 0xAE, 0xF0, 0xCF, 0x21, 0xF5, 0xD3, 0x36, 0xAE,
+    0xB4, 0x19, 0x05, 0xD2, 0xA3, 0xB8, 0xB0, 0x00, 0x12, 0x46, 0x87, 0x25, 0x20, 0xE5, 0x46, 0x42,
+    0x33, 0x2E, 0x6C, 0x1F, 0x39, 0x33, 0xC0, 0x74, 0xEC, 0x48, 0x03, 0xEA, 0x06, 0xC5, 0xCF, 0x11,
+    0x6D, 0x85, 0xF2, 0xDB, 0x24, 0xE5, 0x64, 0xAE, 0x66, 0x25, 0x89, 0x7B, 0x35, 0x27, 0x8C, 0x51,
+    0xFB, 0x7A, 0x76, 0x2A, 0x9F, 0x2D, 0x99, 0xA8, 0x54, 0x6B, 0x3E, 0x4A, 0x9B, 0xB4, 0xA2, 0x72,
+    0x85, 0x2D, 0xA8, 0x72, 0x81, 0x65, 0xCF, 0xD4, 0x33, 0x5A, 0x06, 0x9D, 0x4B, 0x4D, 0xC3, 0x05,
+    0x6B, 0x94, 0x8D, 0xCE, 0x8C, 0x5C, 0xA8, 0x92, 0x2D, 0x8D, 0x4B, 0xCB, 0x25, 0x94, 0xC3, 0x63,
+    0x99, 0x3E, 0x8A, 0xDB, 0x83, 0xEF, 0x37, 0x8C, 0x50, 0x13, 0xFA, 0xCA, 0xED, 0x10, 0x5F, 0x00,
+    0x0F, 0x8F, 0xA4, 0xB0, 0x84, 0x74, 0x33, 0xF2, 0xAB, 0x50, 0x37, 0xA4, 0x68, 0x15, 0x9E, 0xD8,
+    0x23, 0x3A, 0x69, 0x14, 0x1D, 0x3B, 0x4C, 0x21, 0x53, 0xD9, 0xB0, 0x03, 0x99, 0x8A, 0x8E, 0xD6,
+    0x82, 0xBC, 0x45, 0xC9, 0x4E, 0x2B, 0xA8, 0x59, 0xCF, 0x1D, 0x0B, 0xBA, 0x6D, 0xD2, 0xE0, 0x8C,
+    0x7A, 0x07, 0xA1, 0x61, 0x4F, 0x1D, 0x6E, 0xA5, 0xAE, 0xFF, 0x07, 0x75, 0xD3, 0xFF, 0xA7, 0xEE,
+    0xE6, 0x87, 0x4B, 0x52, 0xC9, 0xE5, 0x47, 0xEA, 0x4B, 0x38, 0xA0, 0x0A, 0x75, 0xA4, 0x7D, 0x3E,
+    0x85, 0x2F, 0x4A, 0xAC, 0xCA, 0x3D, 0xA1, 0xEA, 0x3B, 0x61, 0x09, 0x9F, 0xA9, 0x7D, 0x3A, 0x3B,
+    0x3A, 0x09, 0xF5, 0xDC, 0xB1, 0x49, 0x7A, 0x67, 0x47, 0xA6, 0xA9, 0x92, 0xC9, 0x71, 0x69, 0xD9,
+    0x89, 0x84, 0x4A, 0xA2, 0xD3, 0x83, 0x30, 0x49, 0x7C, 0x45, 0xBF, 0x27, 0xD2, 0xD9, 0x5D, 0x82,
+    0x5F, 0xFA, 0xF0, 0x83, 0x9A, 0xC7, 0x0F, 0xAA, 0xD9, 0xDD, 0x80, 0xF0, 0x1B, 0xD5, 0x55, 0x3B,
+    0x6E, 0xD5, 0x40, 0x14, 0x3D, 0xF3, 0x2C, 0x62, 0x21, 0x17, 0xAE, 0x40, 0x48, 0x08, 0x5C, 0x03,
+    0x85, 0x37, 0x80, 0xB0, 0x43, 0x43, 0x9B, 0x82, 0xD0, 0xA4, 0x61, 0x07, 0x6F, 0x07, 0xD8, 0x12,
+    0x5B, 0x80, 0x9E, 0x92, 0xCF, 0x06, 0x28, 0x90, 0xC6, 0x52, 0x36, 0xE0, 0x8E, 0x82, 0xC6, 0x05,
+    0x1F, 0x09, 0x1A, 0x17, 0x2E, 0x8C, 0x64, 0x7B, 0x38, 0xE7, 0xFA, 0x85, 0x84, 0x26, 0x49, 0x41,
+    0x93, 0xC9, 0x64, 0xAE, 0xE4, 0x37, 0x9E, 0x7B, 0x3E, 0xF7, 0x8E, 0x81, 0x93, 0xF1, 0x10, 0x77,
+    0x14, 0x52, 0x37, 0x28, 0xC4, 0x5F, 0x1A, 0x85, 0xCD, 0xB2, 0xFE, 0x38, 0xAE, 0xE1, 0x39, 0xCE,
+    0x19, 0xEE, 0x2D, 0x50, 0xD5, 0x88, 0x26, 0x20, 0x34, 0x88, 0x46, 0x0B, 0x49, 0x8F, 0x4D, 0x68,
+    0x91, 0xF6, 0x88, 0x42, 0x87, 0xB4, 0x43, 0xCC, 0x90, 0xB7, 0x48, 0x42, 0x8F, 0xA2, 0x41, 0xCA,
+    0xC0, 0x77, 0xB2, 0x5F, 0x03, 0x7C, 0x89, 0xFC, 0xF3, 0x88, 0x00, 0x14, 0xC7, 0xA3, 0x63, 0xDE,
+    0xEA, 0x78, 0xDA, 0xCC, 0x80, 0x7F, 0x39, 0xD9, 0x91, 0x8F, 0xE7, 0x78, 0x84, 0x0B, 0x6E, 0x49,
+    0x06, 0x1E, 0x89, 0xA0, 0x23, 0x17, 0x84, 0x8C, 0x47, 0xCE, 0x08, 0x05, 0x73, 0x4C, 0xF0, 0x55,
+    0xA3, 0x50, 0x31, 0x71, 0x36, 0xA2, 0x08, 0x25, 0x8A, 0x81, 0x81, 0x47, 0xF6, 0xC8, 0x19, 0x3C,
+    0xC3, 0xBC, 0x12, 0xB9, 0x2E, 0xC6, 0x1F, 0xC9, 0xF7, 0x49, 0x4B, 0xB6, 0x41, 0x5C, 0x27, 0x91,
+    0xE8, 0xCF, 0xA5, 0x78, 0x00, 0xDC, 0xDD, 0x12, 0x5B, 0x11, 0x42, 0xCD, 0xB3, 0xB3, 0x86, 0xE8,
+    0x93, 0x06, 0x0B, 0xB8, 0x4C, 0x48, 0x1B, 0xA7, 0x25, 0x1A, 0x90, 0x69, 0xC9, 0xEB, 0x98, 0x24,
+    0x4B, 0x02, 0xAD, 0xC4, 0xDC, 0x8B, 0x77, 0x10, 0xEB, 0x85, 0x8B, 0x9B, 0xE1, 0xEB, 0x88, 0x60,
+    0x1E, 0xE9, 0x60, 0xA5, 0xDE, 0x48, 0xE4, 0x58, 0xF9, 0xC9, 0x89, 0xCF, 0x6B, 0x5C, 0x76, 0xDC,
+    0xE0, 0xCB, 0x3F, 0xA8, 0x72, 0x14, 0xC2, 0x40, 0x51, 0xF6, 0x47, 0x50, 0xA3, 0x49, 0x39, 0x27,
+    0x22, 0xE1, 0x92, 0xD7, 0x5C, 0x8A, 0x92, 0x19, 0x2A, 0x10, 0x98, 0xD7, 0xB2, 0x30, 0x17, 0x41,
+    0x24, 0x3D, 0x45, 0x4E, 0x3B, 0x4A, 0x9C, 0x75, 0x31, 0x77, 0xB6, 0xC9, 0x28, 0x88, 0x57, 0xC0,
+    0xD0, 0xE2, 0xAC, 0xA1, 0x28, 0x26, 0x0B, 0xD5, 0x5A, 0xA9, 0xC1, 0x6C, 0xDC, 0x12, 0x28, 0x88,
+    0xD3, 0x8A, 0x38, 0x59, 0x4A, 0x85, 0x6B, 0xA7, 0x56, 0xBA, 0xEF, 0x84, 0x2E, 0x27, 0xA3, 0xB0,
+    0x3F, 0x99, 0x91, 0xA4, 0xF3, 0xC9, 0x7C, 0x94, 0x6A, 0x66, 0xA3, 0x44, 0x33, 0x17, 0x03, 0xE5,
+    0x92, 0x89, 0x52, 0xAB, 0x97, 0x87, 0x52, 0xAC, 0x5D, 0x2D, 0x34, 0xC1, 0xD2, 0x11, 0x06, 0x29,
+    0x56, 0xD2, 0xBF, 0x59, 0xB4, 0x3C, 0x50, 0xB1, 0x10, 0xD3, 0x1A, 0x0E, 0xCF, 0x31, 0x72, 0x6B,
+    0x3B, 0x92, 0x10, 0xC4, 0xA2, 0x0A, 0x9E, 0xC7, 0xB9, 0xD0, 0x6E, 0xF8, 0x34, 0x26, 0x07, 0x4F,
+    0x2D, 0xD8, 0x9C, 0x54, 0xA6, 0x60, 0x81, 0xE4, 0x9D, 0x84, 0x56, 0xAD, 0xA8, 0x78, 0xD3, 0xCE,
+    0x09, 0x48, 0xDA, 0x4A, 0x5A, 0x05, 0x75, 0x71, 0xD6, 0x58, 0x39, 0xE5, 0x4D, 0xA2, 0xC0, 0x4A,
+    0x54, 0x5D, 0x59, 0x2D, 0x12, 0x8D, 0x2C, 0x04, 0xD1, 0x0B, 0x77, 0x46, 0xCE, 0xE1, 0xE0, 0x26,
+    0xAB, 0x27, 0x25, 0x4A, 0x8A, 0x97, 0x28, 0x34, 0x2A, 0xA8, 0x40, 0xCD, 0x37, 0x5C, 0x27, 0x43,
+    0x14, 0xF4, 0xEA, 0x5E, 0xF8, 0x7D, 0x16, 0xF4, 0xB3, 0x0F, 0xB3, 0x36, 0xCE, 0xD8, 0x7B, 0xFF,
+    0xFA, 0xE9, 0x05, 0x95, 0xEA, 0x7C, 0x27, 0x7E, 0x84, 0x5A, 0xFD, 0xE4, 0xC1, 0x33, 0xB2, 0x3A,
+    0xEA, 0xA9, 0x77, 0x4C, 0xB7, 0x9B, 0xB4, 0x91, 0xF2, 0x25, 0x97, 0x9C, 0xA0, 0xCB, 0x82, 0x90,
+    0x09, 0x5A, 0xDD, 0xF2, 0xED, 0x88, 0x95, 0x29, 0x5C, 0x84, 0xD7, 0x52, 0x61, 0x19, 0xEA, 0xBF,
+    0xEE, 0xAE, 0xAD, 0xB8, 0xB4, 0x90, 0x5A, 0x15, 0xE0, 0x85, 0x42, 0x66, 0x02, 0x32, 0x51, 0x67,
+    0x49, 0xDF, 0x5D, 0xD8, 0x41, 0x57, 0x52, 0xF8, 0x37, 0xB8, 0x05, 0xF4, 0xA4, 0x8E, 0x81, 0x7F,
+    0xB0, 0x3D, 0x95, 0x88, 0x24, 0xE3, 0xA5, 0xAE, 0x8D, 0xFF, 0x6F, 0xC6, 0x7D, 0x9B, 0xDC, 0xAE,
+    0x89, 0xA2, 0xD6, 0x54, 0x73, 0xA8, 0x3F, 0xEE, 0x95, 0x9A, 0x17, 0x8C, 0xDB, 0xAB, 0x63, 0xDE,
+    0x5A, 0xC5, 0x85, 0x45, 0xEC, 0x77, 0x46, 0x38, 0xFE, 0xE7, 0x54, 0x8E, 0x48, 0xD5, 0x73, 0xDA,
+    0xE0, 0xEB, 0x13, 0x27, 0x94, 0x80, 0x17, 0x54, 0xA6, 0x7E, 0x9F, 0x4D, 0x60, 0x82, 0xDD, 0x59,
+    0xE1, 0xA4, 0x20, 0x8D, 0xF0, 0xBA, 0x0B, 0x06, 0x83, 0xE4, 0xA6, 0x13, 0x2F, 0xCC, 0x35, 0x1E,
+    0x69, 0x09, 0x08, 0x74, 0x2E, 0x8F, 0x74, 0xBB, 0xAD, 0x66, 0x6C, 0xD6, 0xA0, 0x3B, 0x82, 0x0E,
+    0x99, 0x37, 0xFD, 0xA9, 0x1B, 0xCE, 0x2F, 0xFF, 0xF0, 0x19, 0x35, 0x29, 0x5B, 0xA6, 0xBB, 0xDD,
+    0xE9, 0x76, 0xD0, 0x7C, 0x05, 0xCD, 0x4B, 0x8C, 0xED, 0x88, 0x9D, 0x1B, 0x2E, 0xB0, 0xA3, 0x58,
+    0x4A, 0x6E, 0xD4, 0x87, 0x81, 0x96, 0x98, 0x21, 0x30, 0x0B, 0xF4, 0x75, 0x9E, 0xF4, 0xB5, 0x49,
+    0xDA, 0xF5, 0x01, 0xE9, 0x92, 0x78, 0xB4, 0x1C, 0xB2, 0x48, 0x13, 0xAB, 0x16, 0xB3, 0x65, 0xD7,
+    0x02, 0xC9, 0x72, 0x81, 0xE4, 0x7F, 0x00, 0xCD, 0x55, 0x2D, 0x8F, 0xD5, 0x50, 0x10, 0x3D, 0xB7,
+    0x05, 0x1A, 0x68, 0x48, 0x31, 0x10, 0x92, 0x4D, 0xA8, 0x45, 0x6D, 0x2D, 0x86, 0xB4, 0x06, 0x85,
+    0x01, 0x41, 0x42, 0x82, 0x59, 0x49, 0x30, 0x6B, 0x21, 0xD9, 0xD0, 0xFE, 0x04, 0x04, 0x78, 0x2C,
+    0x6B, 0xD6, 0x22, 0x20, 0xED, 0x4F, 0x28, 0x02, 0x85, 0xA9, 0x58, 0x04, 0x18, 0x4A, 0xF2, 0x48,
+    0xDE, 0x2E, 0x7D, 0xBD, 0x9C, 0x33, 0xED, 0xDB, 0x05, 0x96, 0x80, 0x00, 0xC1, 0x64, 0xB7, 0xEF,
+    0x76, 0x6E, 0xEF, 0xCC, 0x9C, 0x33, 0x1F, 0x17, 0xC0, 0xF6, 0x58, 0x01, 0x17, 0x0B, 0xA0, 0xF6,
+    0x92, 0x01, 0x28, 0xBD, 0x2D, 0x2B, 0xA4, 0x2B, 0x64, 0x5C, 0x74, 0x88, 0x46, 0x6E, 0xB7, 0xA0,
+    0x50, 0x1B, 0xAE, 0xB4, 0xC8, 0x3B, 0xFE, 0x4B, 0x15, 0xF1, 0x44, 0x38, 0xDA, 0x1E, 0xFF, 0x4B,
+    0xAA, 0x91, 0x52, 0x1F, 0xEB, 0xAB, 0x60, 0x90, 0xFA, 0xFD, 0x5D, 0x7E, 0x4A, 0x27, 0xA9, 0xF7,
+    0x0D, 0xA2, 0x9E, 0x6A, 0x73, 0x53, 0xCB, 0x8A, 0xDC, 0x24, 0x3C, 0x13, 0x7A, 0x46, 0x00, 0x99,
+    0xA9, 0xF9, 0x81, 0xA9, 0x92, 0xC9, 0x28, 0xF5, 0x3C, 0x66, 0xAF, 0xAE, 0x5E, 0x9A, 0x4A, 0xA2,
+    0x45, 0x6C, 0x2B, 0x3F, 0x2A, 0x64, 0x93, 0x4E, 0xA6, 0x67, 0x55, 0xB4, 0x56, 0xE1, 0x8C, 0x3F,
+    0x9C, 0x54, 0x26, 0x19, 0x35, 0x1B, 0x23, 0x3D, 0xB7, 0x3C, 0x3F, 0xA6, 0xFB, 0x09, 0xD1, 0xED,
+    0x7D, 0xED, 0x70, 0x0D, 0x2B, 0xA4, 0x4B, 0x84, 0x4D, 0x2E, 0x24, 0x97, 0x5E, 0x45, 0x2D, 0x12,
+    0x1E, 0x6B, 0x06, 0x73, 0x38, 0xA4, 0x05, 0xD2, 0xB7, 0x05, 0x82, 0x1E, 0xC1, 0x42, 0x81, 0xDB,
+    0x1F, 0xC2, 0x05, 0x12, 0xC5, 0x94, 0xBF, 0xBF, 0xE7, 0x17, 0xB8, 0x3C, 0x7B, 0xAF, 0x78, 0xF0,
+    0x9D, 0xA7, 0xA2, 0xF4, 0x7D, 0xA6, 0x50, 0xEB, 0x7D, 0xD2, 0x5C, 0x98, 0xFB, 0x44, 0x8F, 0xC0,
+    0xB8, 0xDC, 0xB1, 0x77, 0xA9, 0x43, 0xB1, 0x86, 0xFB, 0x38, 0x29, 0x67, 0x76, 0x9F, 0x1A, 0xE2,
+    0xA5, 0xD1, 0x47, 0x7C, 0x9D, 0x78, 0xBB, 0xAE, 0x20, 0xA2, 0x06, 0x59, 0x81, 0x57, 0x0A, 0x29,
+    0xA9, 0x50, 0xC2, 0xF5, 0x48, 0x3B, 0x64, 0x48, 0x07, 0xB2, 0xE9, 0xC9, 0x5B, 0x29, 0x72, 0xC9,
+    0x51, 0x6B, 0x08, 0x0A, 0x24, 0x07, 0xF7, 0x06, 0x04, 0x2B, 0xA5, 0x27, 0x6F, 0xC8, 0x75, 0x38,
+    0x88, 0xE7, 0xBA, 0x71, 0xA3, 0x40, 0x90, 0x17, 0x5F, 0x30, 0x91, 0x59, 0xCF, 0x24, 0x86, 0x1E,
+    0x31, 0x39, 0xEA, 0xE1, 0x3B, 0xFE, 0x4E, 0x99, 0x78, 0x3E, 0x05, 0xFB, 0x12, 0xF2, 0xCC, 0x10,
+    0x10, 0xF6, 0x3F, 0x84, 0x7A, 0x7D, 0xA3, 0x75, 0x5F, 0x3D, 0x49, 0x1B, 0x90, 0x1F, 0x6C, 0x39,
+    0xC2, 0x8E, 0x7B, 0x4B, 0xBC, 0x1B, 0x8E, 0x97, 0xAC, 0x8A, 0x44, 0xCB, 0x86, 0x99, 0x82, 0x71,
+    0x67, 0x15, 0x83, 0x07, 0x2F, 0x68, 0x3A, 0x51, 0xC0, 0xCE, 0x52, 0xB5, 0xA9, 0x13, 0x61, 0x2B,
+    0x84, 0x3B, 0x02, 0x1B, 0x13, 0x2C, 0xB0, 0x54, 0xF9, 0xA4, 0x60, 0xC0, 0x41, 0xEF, 0x58, 0x15,
+    0xB9, 0x48, 0x8E, 0x8C, 0x9D, 0xDA, 0xAF, 0xCC, 0x00, 0x93, 0xE3, 0x9F, 0xD5, 0xFC, 0xBA, 0xA5,
+    0xAF, 0x09, 0xA1, 0x81, 0x8D, 0x07, 0xB1, 0xE3, 0xAB, 0x80, 0x70, 0x16, 0xAC, 0x5E, 0xBA, 0x8F,
+    0x0C, 0x61, 0x2D, 0xB0, 0x44, 0x58, 0x73, 0xB7, 0xC3, 0x6F, 0xA5, 0x54, 0xDA, 0x92, 0x61, 0x5D,
+    0x96, 0xA2, 0x0A, 0x73, 0x3B, 0x94, 0x15, 0x26, 0x64, 0x08, 0xC6, 0x9F, 0x4E, 0x85, 0x6F, 0x5E,
+    0x03, 0x8F, 0x19, 0xAD, 0x98, 0x61, 0x37, 0xB0, 0xAF, 0xFA, 0xB9, 0x35, 0xD4, 0x15, 0x6A, 0x08,
+    0xEB, 0x05, 0xD5, 0xBC, 0xF8, 0x51, 0xBC, 0x8A, 0x9C, 0xDA, 0x66, 0xA2, 0xC8, 0xF9, 0x0A, 0x7F,
+    0x14, 0x05, 0x17, 0x0F, 0x73, 0x68, 0xF2, 0x60, 0x81, 0x95, 0xCD, 0x14, 0xD6, 0x1C, 0xD5, 0x79,
+    0x04, 0xDC, 0x7D, 0xA8, 0xFA, 0x0B, 0x3E, 0xF7, 0x47, 0x68, 0x4A, 0x8B, 0xB3, 0xF9, 0xBF, 0xEB,
+    0x0F, 0x51, 0x15, 0x55, 0x71, 0xF5, 0x12, 0xC9, 0xA7, 0xC2, 0x30, 0xB1, 0x20, 0x70, 0xE1, 0x1F,
+    0xD5, 0x1F, 0xE5, 0xAA, 0x3D, 0x37, 0xED, 0x99, 0xE2, 0xA8, 0x37, 0x05, 0x4E, 0xB3, 0xA6, 0xF9,
+    0x73, 0x0A, 0x70, 0xFA, 0x8E, 0x4E, 0x94, 0x6A, 0x79, 0xA7, 0xD9, 0x61, 0xC0, 0x69, 0xDF, 0x7F,
+    0x51, 0xA0, 0xB5, 0x99, 0xC8, 0xCD, 0x5C, 0x6A, 0xEB, 0xD8, 0x7C, 0x5B, 0xAE, 0xF9, 0xD1, 0xBE,
+    0x6D, 0xF8, 0x03, 0xD8, 0x84, 0x5C, 0xDA, 0x8B, 0xC8, 0xC3, 0xC6, 0x34, 0xBC, 0x62, 0x7B, 0xC1,
+    0x34, 0x04, 0x33, 0x9B, 0x80, 0x89, 0x6F, 0x9C, 0x36, 0x58, 0xCE, 0xBB, 0xB5, 0xEF, 0x6D, 0xFE,
+    0x2C, 0xBE, 0x7F, 0xDA, 0x54, 0x6F, 0x39, 0x02, 0xCD, 0xEC, 0x91, 0x9C, 0x9B, 0x27, 0x51, 0x5C,
+    0x4D, 0xDD, 0xCC, 0x61, 0x37, 0x0F, 0xA1, 0x5F, 0x88, 0xF3, 0x1F, 0xD4, 0x64, 0x88, 0xBE, 0xDC,
+    0x50, 0x4B, 0x2A, 0xD1, 0x2C, 0x68, 0x59, 0x38, 0xD0, 0xE6, 0x72, 0x8E, 0x2C, 0xB2, 0x92, 0xC5,
+    0x95, 0xA2, 0x6C, 0x54, 0x2A, 0x1C, 0x7C, 0x3D, 0xFB, 0xB1, 0xC7, 0xB6, 0x7F, 0x62, 0x66, 0xAE,
+    0x4C, 0xDD, 0xB0, 0xB0, 0x9F, 0xDA, 0x9C, 0xA5, 0x37, 0x2B, 0x2B, 0x3C, 0x1B, 0x8A, 0x5B, 0xB8,
+    0x7C, 0xC2, 0xF3, 0x9D, 0x5B, 0xB0, 0x49, 0xDE, 0x4F, 0xF3, 0x1C, 0x6B, 0x42, 0xF3, 0x55, 0x71,
+    0x6A, 0x2E, 0xF7, 0xE9, 0xD6, 0x58, 0x33, 0x1A, 0x18, 0x39, 0xD6, 0x42, 0xBA, 0x54, 0x9E, 0x1C,
+    0x53, 0x4A, 0x26, 0x46, 0x03, 0xE3, 0xAD, 0x61, 0xB7, 0x8D, 0xE0, 0x35, 0xA7, 0x99, 0xD9, 0x08,
+    0xBC, 0x4D, 0xB4, 0xDC, 0x63, 0x22, 0x15, 0xF5, 0xC7, 0x3D, 0x56, 0x93, 0xEE, 0x40, 0x5F, 0xD8,
+    0x65, 0xD3, 0xCE, 0xAC, 0x66, 0xF6, 0xA4, 0x91, 0x19, 0x1B, 0x8E, 0x67, 0x7B, 0x89, 0xF9, 0x36,
+    0xDB, 0x64, 0xE1, 0xB8, 0x8E, 0xEC, 0x9E, 0x85, 0x2B, 0xBE, 0x6F, 0xD4, 0x43, 0x5E, 0x25, 0x34,
+    0xEB, 0x56, 0xB7, 0x8B, 0xA9, 0xC4, 0x74, 0x11, 0x38, 0x85, 0x13, 0xEA, 0x92, 0x88, 0x04, 0x30,
+    0x90, 0x79, 0x6B, 0x63, 0x64, 0x0D, 0x1E, 0xB1, 0x9A, 0x6D, 0xCC, 0x31, 0x9B, 0x4D, 0xA8, 0xDB,
+    0xD3, 0xD5, 0x63, 0x81, 0xBF, 0x97, 0x6F, 0x95, 0x55, 0xB1, 0x8E, 0xD4, 0x48, 0x10, 0x2D, 0xDB,
+    0xBB, 0x58, 0x5A, 0x23, 0xF9, 0x02, 0x48, 0x00, 0x61, 0x42, 0x82, 0x15, 0x4E, 0x88, 0xCF, 0x4D,
+    0x40, 0x7C, 0x4B, 0x40, 0xC4, 0x1F, 0x90, 0x40, 0x40, 0x40, 0x80, 0xB0, 0x25, 0x02, 0xD2, 0x09,
+    0xE0, 0x0F, 0x48, 0x20, 0x81, 0xE0, 0x82, 0x0B, 0x58, 0x6C, 0x71, 0x3F, 0xE0, 0x4F, 0xB0, 0x10,
+    0x04, 0x90, 0xE0, 0xC0, 0x48, 0xB3, 0xC8, 0x9E, 0xE2, 0xBD, 0x6A, 0xEF, 0xCC, 0x80, 0x16, 0x10,
+    0xBD, 0x9A, 0xB2, 0x5D, 0x65, 0x57, 0xBF, 0x7A, 0xF5, 0xAA, 0x57, 0x44, 0x82, 0x9B, 0x07, 0x22,
+    0x92, 0xA9, 0x36, 0x22, 0xA5, 0x6A, 0x2F, 0x52, 0xA8, 0x2E, 0x61, 0x27, 0xB7, 0x23, 0x92, 0xE3,
+    0x59, 0x24, 0xED, 0x68, 0x63, 0xBB, 0x0F, 0x97, 0xB4, 0xA2, 0x66, 0x8B, 0x23, 0x0B, 0xE8, 0xCA,
+    0xE1, 0x52, 0xEB, 0xCA, 0x1E, 0x74, 0xC0, 0xE5, 0x94, 0x6A, 0xC5, 0xB7, 0xED, 0x41, 0x72, 0x46,
+    0x24, 0xE1, 0x1E, 0x12, 0x61, 0x0F, 0x87, 0xC0, 0x52, 0xEA, 0x4F, 0x2F, 0x75, 0xC4, 0x67, 0xAA,
+    0xD3, 0x77, 0x36, 0x57, 0xE6, 0x08, 0x6A, 0x9F, 0x56, 0x2A, 0xDB, 0x6A, 0x32, 0x2B, 0x0B, 0xB3,
+    0x97, 0xCD, 0xEE, 0xD3, 0x44, 0x3E, 0xF0, 0xCC, 0x87, 0xCB, 0xAF, 0x2E, 0x40, 0x29, 0xC1, 0x74,
+    0xC3, 0x09, 0x77, 0x7E, 0xC0, 0xDA, 0x90, 0x20, 0x62, 0xAA, 0x72, 0x35, 0x03, 0x0A, 0x88, 0x3E,
+    0x6F, 0xE2, 0x45, 0xD6, 0x03, 0xEE, 0x32, 0x51, 0x1D, 0x23, 0xFC, 0xE4, 0xBC, 0xBE, 0x17, 0xD9,
+    0x25, 0xEC, 0xE3, 0x42, 0x43, 0x6E, 0x7E, 0x17, 0xBF, 0x7B, 0x60, 0x01, 0x8E, 0xF0, 0x89, 0x6D,
+    0xF3, 0x97, 0xEC, 0x90, 0x16, 0xFC, 0x21, 0x59, 0x7F, 0x85, 0xAE, 0xEC, 0xD0, 0xD0, 0x8C, 0x16,
+    0x7F, 0x60, 0x76, 0x47, 0x7E, 0xB9, 0x76, 0x6F, 0xB2, 0x3C, 0x70, 0x4E, 0x40, 0xC6, 0x3F, 0x2C,
+    0x98, 0xD6, 0x2F, 0xC8, 0x2F, 0x75, 0x63, 0x04, 0x5B, 0xF1, 0x99, 0xDD, 0x27, 0xDD, 0xD6, 0x0E,
+    0x44, 0xCA, 0xB6, 0x1D, 0x19, 0xC9, 0x6C, 0x18, 0x7B, 0xD8, 0xE2, 0x72, 0x5E, 0x67, 0xB2, 0xF9,
+    0x20, 0xB5, 0xB5, 0x2B, 0xB7, 0x76, 0xA5, 0x20, 0x86, 0x81, 0x2E, 0xD4, 0x17, 0xB5, 0xF6, 0xF8,
+    0x0C, 0x3C, 0x6F, 0x5B, 0xE3, 0xBF, 0x65, 0xEF, 0x8E, 0xB6, 0x81, 0x06, 0x12, 0x57, 0x71, 0x25,
+    0xFF, 0xA5, 0x4E, 0xD2, 0xCF, 0x73, 0xEF, 0x73, 0xF3, 0x9F, 0xB0, 0x02, 0xFD, 0x48, 0x0D, 0x48,
+    0xFC, 0xE5, 0xBA, 0x44, 0x2D, 0xE9, 0x81, 0xF3, 0x21, 0x77, 0x3F, 0x62, 0x70, 0x39, 0x23, 0x8B,
+    0x59, 0x46, 0x2D, 0x17, 0x5D, 0xD9, 0x00, 0x77, 0x87, 0x96, 0xF7, 0x29, 0xD5, 0x77, 0x47, 0x17,
+    0xC0, 0x89, 0xD5, 0x97, 0xB4, 0x6F, 0x69, 0x56, 0x7B, 0x4F, 0x93, 0x3E, 0x38, 0x38, 0x66, 0x63,
+    0xDA, 0x88, 0x31, 0x37, 0x62, 0xAC, 0xDE, 0x78, 0xD8, 0x38, 0xAC, 0xDA, 0xD8, 0x57, 0xDE, 0xAE,
+    0x1D, 0x9E, 0xB9, 0xCC, 0x58, 0x34, 0x71, 0x7A, 0xE9, 0x64, 0x96, 0xC9, 0xE8, 0x8E, 0x2C, 0x53,
+    0x36, 0x6C, 0x1C, 0x5E, 0xE6, 0x97, 0x4C, 0xF8, 0x5E, 0x68, 0x17, 0xAC, 0xC8, 0x6E, 0x1D, 0xDC,
+    0x5B, 0xAC, 0x4B, 0xDF, 0xB7, 0x42, 0x73, 0xB0, 0xD4, 0x48, 0xDC, 0xA1, 0x9B, 0x23, 0xF8, 0x94,
+    0x72, 0xED, 0xEA, 0x4D, 0x53, 0x48, 0x43, 0x57, 0x25, 0x69, 0x4B, 0xD0, 0x21, 0x04, 0xAF, 0xEA,
+    0x0A, 0x6D, 0x53, 0x34, 0xE0, 0xB4, 0xC7, 0x1D, 0x61, 0xBB, 0x46, 0xCA, 0x56, 0xCE, 0x39, 0xA3,
+    0x19, 0x7A, 0x48, 0x5C, 0x82, 0xFB, 0xF4, 0x1A, 0xD1, 0xA6, 0x6F, 0x36, 0x95, 0xFC, 0x3D, 0x0B,
+    0xF2, 0x84, 0x45, 0xEE, 0x34, 0xA6, 0x19, 0x39, 0x52, 0xDA, 0x3D, 0x3F, 0xA8, 0xE5, 0x2C, 0xB2,
+    0x1B, 0x33, 0xA9, 0x31, 0x53, 0x5A, 0x69, 0xE3, 0x66, 0xCA, 0x4B, 0xB7, 0x71, 0x18, 0x33, 0x65,
+    0xB5, 0x2E, 0xDE, 0x3B, 0x0A, 0x32, 0x13, 0x18, 0x55, 0xA9, 0x65, 0x2A, 0x5A, 0x99, 0x67, 0x4A,
+    0x12, 0xFB, 0xB0, 0xE8, 0xCC, 0xE1, 0x36, 0x8E, 0x7E, 0x0B, 0x56, 0xC8, 0xE8, 0x3C, 0x9C, 0x77,
+    0x01, 0x7F, 0x99, 0x39, 0x39, 0x4C, 0x1A, 0x29, 0xFC, 0xAC, 0x62, 0x12, 0x29, 0xCD, 0x51, 0x02,
+    0x7E, 0xCA, 0xA9, 0x2A, 0xE6, 0x11, 0xE0, 0x00, 0x44, 0x1C, 0x5F, 0x06, 0x48, 0x41, 0x81, 0x1D,
+    0xB2, 0x96, 0x8A, 0x1A, 0xF0, 0xD9, 0xC4, 0x8A, 0x1D, 0x8E, 0xAF, 0x56, 0x4E, 0x96, 0xD0, 0xEE,
+    0x6F, 0x24, 0x14, 0x59, 0xE3, 0xB3, 0xB5, 0x62, 0x78, 0x2E, 0xD8, 0x71, 0xD8, 0xDB, 0x80, 0x56,
+    0x6B, 0x09, 0x79, 0xC5, 0xFC, 0x91, 0x84, 0x8E, 0x05, 0x02, 0x5D, 0x50, 0x0E, 0x32, 0xDA, 0x2D,
+    0x60, 0x36, 0xD4, 0x08, 0xA1, 0x40, 0x11, 0xC0, 0x05, 0xCF, 0x88, 0x1D, 0xDF, 0x61, 0x3F, 0x17,
+    0xF5, 0x1E, 0xDE, 0xE4, 0xA1, 0xE5, 0x28, 0x8C, 0x5E, 0xE5, 0x5B, 0xB6, 0xC1, 0xAE, 0x3B, 0x63,
+    0xBD, 0x89, 0x08, 0xE5, 0xFE, 0xAB, 0xAB, 0xEC, 0x48, 0xFC, 0x0F, 0x23, 0x5D, 0xDE, 0x6D, 0x1F,
+    0x8B, 0x27, 0xAF, 0x3D, 0x44, 0x6F, 0x2F, 0xD8, 0x27, 0x74, 0x89, 0x27, 0xBD, 0x36, 0x84, 0x8F,
+    0xA6, 0xA2, 0xA3, 0x70, 0x73, 0x46, 0xE1, 0x46, 0x19, 0x70, 0xA7, 0x83, 0x35, 0x5A, 0x6D, 0x74,
+    0x29, 0x84, 0xB2, 0xA2, 0x06, 0x92, 0xC1, 0x46, 0x4C, 0x8D, 0x1A, 0xB8, 0xC1, 0x6F, 0x30, 0xD9,
+    0x30, 0x02, 0x79, 0x6D, 0x8C, 0xF1, 0xE5, 0xDA, 0xF1, 0x4B, 0xDC, 0xA5, 0xEC, 0x14, 0x92, 0x7F,
+    0xB8, 0x85, 0x6A, 0x32, 0xB5, 0x3E, 0xB3, 0x41, 0xCE, 0x5A, 0xD6, 0xF1, 0xBF, 0x08, 0xCF, 0x08,
+    0x1C, 0xFE, 0xDB, 0x47, 0xD0, 0x61, 0xD0, 0x48, 0xFE, 0x6A, 0x5F, 0xA2, 0xFF, 0x1F, 0x55, 0xF2,
+    0xEF, 0x15, 0xA4, 0x31, 0x61, 0xFC, 0xB8, 0x28, 0xA4, 0x10, 0xC1, 0x06, 0x8A, 0x19, 0xC1, 0x5E,
+    0x56, 0x3D, 0x94, 0x70, 0x48, 0x5A, 0x28, 0xE8, 0x35, 0x38, 0xC6, 0x0C, 0xBE, 0x91, 0x25, 0x84,
+    0x9F, 0x55, 0xE1, 0x04, 0x89, 0xD7, 0x0D, 0xC6, 0x62, 0xE4, 0xD1, 0x57, 0xE1, 0x66, 0x00, 0x8E,
+    0x12, 0x47, 0xD7, 0xE3, 0x2D, 0xAD, 0xF2, 0x04, 0xDF, 0x33, 0x58, 0x50, 0x25, 0x3B, 0x7B, 0xD6,
+    0xFD, 0xF2, 0x48, 0xE7, 0x3C, 0xD4, 0x2D, 0x47, 0xE1, 0x7B, 0x46, 0x07, 0xCF, 0xA8, 0x1C, 0x33,
+    0x5A, 0xAD, 0x19, 0x6D, 0x66, 0x46, 0x29, 0xA1, 0xBA, 0x0A, 0xFD, 0xCB, 0x6C, 0xFA, 0xCC, 0x68,
+    0xB7, 0xC5, 0x68, 0xF1, 0x53, 0x46, 0x57, 0x7F, 0xCC, 0xA8, 0x5F, 0xDF, 0x00, 0xC5, 0x95, 0xB1,
+    0x6E, 0xDC, 0x46, 0x10, 0x86, 0x7F, 0x92, 0x88, 0x88, 0x98, 0x88, 0xD9, 0xB8, 0x8B, 0x04, 0xB6,
+    0x06, 0x0C, 0x88, 0x4D, 0x8A, 0x14, 0x89, 0x97, 0xBD, 0x1B, 0x17, 0x4E, 0xE5, 0x37, 0x48, 0x93,
+    0x26, 0x45, 0x1A, 0x99, 0x04, 0x52, 0xA4, 0xD5, 0x73, 0xE4, 0x09, 0x52, 0x48, 0xE6, 0x02, 0x79,
+    0x80, 0xD0, 0x4F, 0x90, 0x0B, 0x0C, 0x23, 0xA5, 0xB6, 0x38, 0xC0, 0x0C, 0xBC, 0xE4, 0xE4, 0x9F,
+    0xE1, 0x2A, 0x3E, 0x19, 0x11, 0xAC, 0x26, 0x08, 0xEF, 0xB0, 0x7B, 0x37, 0x9C, 0xDD, 0x9D, 0xF9,
+    0xE6, 0xE7, 0x10, 0x00, 0x9E, 0xE2, 0x91, 0x88, 0xCF, 0x44, 0x04, 0x9F, 0x3C, 0xC5, 0x87, 0xD7,
+    0x19, 0xF2, 0x7D, 0x1E, 0x50, 0xFB, 0xDA, 0xC3, 0xF1, 0x93, 0xCD, 0xD9, 0x8C, 0x6A, 0xAA, 0x26,
+    0xFE, 0x6E, 0x91, 0x45, 0x44, 0x54, 0xBB, 0x62, 0x07, 0xD7, 0x35, 0x43, 0xBE, 0x60, 0x44, 0x1B,
+    0x72, 0x6E, 0xE5, 0x2B, 0x91, 0x15, 0xAD, 0xC8, 0x1E, 0xBD, 0xFC, 0xEE, 0xD1, 0xCF, 0xFD, 0x3F,
+    0x5B, 0x06, 0x9C, 0x70, 0xAC, 0x51, 0x78, 0x4E, 0x91, 0xDB, 0x01, 0x15, 0x9D, 0x79, 0x39, 0xE9,
+    0x74, 0xFA, 0xB6, 0xC3, 0xC7, 0x2F, 0xBA, 0x96, 0x0B, 0x9A, 0x3D, 0x30, 0xFA, 0x5C, 0xB8, 0x5F,
+    0x84, 0xDB, 0xD1, 0x3C, 0x14, 0x0B, 0xD0, 0x04, 0xF4, 0x1E, 0x34, 0x57, 0x11, 0x6A, 0xA6, 0x33,
+    0xCD, 0x75, 0x80, 0x9A, 0xE9, 0x5C, 0xCD, 0x68, 0xE8, 0x3C, 0x76, 0x39, 0xEF, 0xD3, 0xEC, 0x18,
+    0xCA, 0x8A, 0x82, 0xA1, 0x34, 0x13, 0x7A, 0x3A, 0x33, 0x2B, 0x3A, 0xBB, 0xCD, 0x79, 0x6F, 0x2B,
+    0xC5, 0xCE, 0x74, 0x01, 0xCD, 0xFA, 0xCD, 0xB8, 0x40, 0x81, 0x89, 0x47, 0x23, 0x9A, 0x23, 0x44,
+    0xD3, 0x65, 0x1A, 0x22, 0x03, 0xF0, 0xB9, 0xC8, 0xF9, 0xFB, 0x40, 0xCB, 0x8E, 0x19, 0x9F, 0xEA,
+    0x74, 0x89, 0x0B, 0xF5, 0xF4, 0x5C, 0xAB, 0x49, 0xFF, 0xFC, 0xAF, 0x79, 0x35, 0x9B, 0x5F, 0x11,
+    0x8A, 0x44, 0xFD, 0x05, 0x3F, 0xAC, 0x01, 0x83, 0xF0, 0x15, 0x41, 0x92, 0x7B, 0x3E, 0x63, 0x46,
+    0x3D, 0x95, 0x3B, 0x26, 0xD0, 0x7A, 0xA6, 0x38, 0x8A, 0x18, 0xF5, 0x81, 0x01, 0x90, 0x89, 0xBC,
+    0xD5, 0x20, 0x1B, 0xFF, 0x7E, 0xD3, 0xD6, 0xC6, 0xFB, 0xC7, 0x3A, 0x66, 0xDE, 0x6E, 0x7C, 0x61,
+    0x7F, 0x8A, 0x1F, 0x07, 0xBB, 0x1F, 0xCC, 0xE1, 0x97, 0x3B, 0x70, 0xAF, 0x99, 0x6D, 0x3F, 0x65,
+    0x44, 0xC1, 0x83, 0x75, 0x9D, 0xF8, 0x82, 0xA9, 0xD7, 0x33, 0xDC, 0xC4, 0xC4, 0xBA, 0x32, 0xDA,
+    0x76, 0xA3, 0x07, 0xCD, 0xEA, 0x4C, 0x33, 0xD1, 0xD1, 0xAC, 0x10, 0xC7, 0x21, 0x5B, 0x8D, 0x68,
+    0xEB, 0x95, 0x68, 0xA1, 0xF8, 0x29, 0x9E, 0x01, 0xD9, 0x82, 0x72, 0x6F, 0xC4, 0x47, 0xA8, 0xD9,
+    0x9C, 0x3B, 0x5D, 0xC9, 0x5F, 0xDC, 0xA6, 0x10, 0x6E, 0xFE, 0xE6, 0xB9, 0x4C, 0x46, 0x3C, 0x6E,
+    0xF8, 0x3B, 0xD4, 0x1C, 0xB5, 0x90, 0xA2, 0x44, 0xB3, 0x51, 0xFE, 0x3A, 0x88, 0xD4, 0x94, 0xF5,
+    0xFD, 0x04, 0x7C, 0x76, 0x4F, 0xB3, 0xA6, 0xDB, 0xB1, 0xE6, 0xAC, 0x15, 0x3A, 0x3A, 0xBF, 0x85,
+    0xBC, 0x49, 0xDD, 0x51, 0x96, 0xA4, 0xDF, 0x0C, 0x0A, 0xDE, 0x94, 0x7E, 0x81, 0x32, 0xB0, 0x14,
+    0x2F, 0x8D, 0xBB, 0x0A, 0x9D, 0xBA, 0x19, 0x3D, 0xE5, 0x1D, 0x0D, 0xBB, 0xEA, 0x9C, 0x01, 0xF5,
+    0x28, 0xE5, 0xA7, 0x70, 0xBD, 0xDD, 0x03, 0xE0, 0x99, 0x05, 0xC1, 0x72, 0xA9, 0x9A, 0x54, 0x50,
+    0xCC, 0x5A, 0x13, 0x7F, 0x69, 0xDF, 0x3B, 0xC3, 0x4E, 0x2A, 0x4F, 0xB4, 0x93, 0xCC, 0x37, 0xDC,
+    0x48, 0x3A, 0x4F, 0xBC, 0x93, 0xD0, 0x13, 0xF0, 0xA4, 0xF4, 0x44, 0x3C, 0x49, 0x3D, 0x21, 0x4F,
+    0x5A, 0x4F, 0xCC, 0x93, 0xD8, 0x13, 0xF4, 0xA4, 0xF6, 0x8D, 0x7A, 0x92, 0x7B, 0xC2, 0x7E, 0xAD,
+    0xF7, 0xC4, 0x3D, 0x09, 0xFE, 0x03, 0xF0, 0xA4, 0x7B, 0x34, 0xB0, 0x35, 0x30, 0x77, 0x3E, 0xF5,
+    0xFD, 0x96, 0xB5, 0x1A, 0xCF, 0x6F, 0x49, 0xD3, 0x34, 0x6F, 0xE8, 0xA1, 0xEC, 0x61, 0xF0, 0x4D,
+    0xF6, 0x30, 0xFC, 0xC6, 0x1F, 0x56, 0x00, 0xAB, 0x00, 0xAC, 0xD7, 0x58, 0x0D, 0xB4, 0xC7, 0x44,
+    0x58, 0x15, 0xB6, 0x76, 0x63, 0x75, 0xB8, 0x51, 0x88, 0x8F, 0x28, 0x16, 0xFF, 0x97, 0x62, 0xE3,
+    0x01, 0xB8, 0x1F, 0x6C, 0x3C, 0xB1, 0xB1, 0xD8, 0x1E, 0xDC, 0x76, 0x67, 0x53, 0x7F, 0x20, 0x68,
+    0xC5, 0xD1, 0x6E, 0xE2, 0x54, 0x95, 0x66, 0x33, 0x5B, 0x40, 0xDB, 0x5D, 0x92, 0x97, 0x75, 0x06,
+    0x6D, 0xC5, 0xF5, 0x80, 0x85, 0xDC, 0xDB, 0x49, 0x1B, 0x83, 0x75, 0x62, 0x52, 0x99, 0xF5, 0x47,
+    0x67, 0x7D, 0x61, 0x6B, 0xC4, 0xA7, 0xDA, 0x73, 0x59, 0xB8, 0x5C, 0xCF, 0xF8, 0x72, 0x6B, 0x52,
+    0x96, 0xB7, 0x36, 0x7C, 0x3B, 0x6A, 0x48, 0x67, 0xC6, 0x34, 0x8F, 0xA9, 0x9B, 0x9C, 0x5D, 0x6E,
+    0xF3, 0xD7, 0xF9, 0x64, 0xF3, 0x57, 0xB8, 0x7F, 0x50, 0x48, 0x67, 0xCB, 0xF2, 0x58, 0x6F, 0xB1,
+    0xAF, 0xAA, 0x32, 0x7D, 0xE4, 0xB2, 0x75, 0xCB, 0x65, 0xE8, 0xCD, 0xC1, 0xF9, 0xC6, 0x1C, 0x9A,
+    0x5D, 0x69, 0x0E, 0x75, 0xA0, 0x03, 0xCB, 0xC9, 0x7F, 0x63, 0x97, 0x19, 0xE4, 0x96, 0x35, 0xF0,
+    0xF9, 0xAA, 0xE0, 0x59, 0x54, 0x01, 0xEB, 0xCD, 0x0E, 0x3B, 0x0E, 0x74, 0x18, 0xC5, 0x13, 0xBA,
+    0x9B, 0xFA, 0xAB, 0x40, 0x46, 0xF5, 0xDE, 0xBD, 0x8E, 0xAA, 0xEB, 0xC5, 0x05, 0x79, 0xA2, 0xAD,
+    0xF8, 0xBB, 0xBD, 0xFB, 0x53, 0xDB, 0xFE, 0xD5, 0x5C, 0xBF, 0x5B, 0x54, 0xAA, 0xCA, 0x81, 0x58,
+    0xD9, 0x1A, 0x47, 0x7D, 0xC1, 0xD8, 0x8B, 0xC9, 0xEB, 0xDB, 0x86, 0x32, 0x99, 0xD4, 0x81, 0x67,
+    0x06, 0xD5, 0x0C, 0x1F, 0x2A, 0x6E, 0x90, 0xF1, 0x66, 0xBD, 0xE5, 0x5D, 0x6F, 0xB9, 0x5B, 0x55,
+    0x44, 0xC7, 0xC7, 0x94, 0x2A, 0xF2, 0xA9, 0xE2, 0xF8, 0x29, 0xF2, 0x1B, 0xEF, 0x29, 0xE5, 0x5A,
+    0xFF, 0xA1, 0xEB, 0x7A, 0x8A, 0x95, 0x0F, 0x98, 0x36, 0xE0, 0xC6, 0xF7, 0x78, 0x88, 0x35, 0x8B,
+    0xC5, 0xBE, 0x0C, 0x65, 0x70, 0xC1, 0x0D, 0xCD, 0xAF, 0xF2, 0x2A, 0xA2, 0x77, 0xF2, 0xDB, 0x2E,
+    0x5B, 0x45, 0x46, 0x9E, 0xAB, 0xBA, 0x6D, 0xE4, 0x8A, 0xE7, 0xF6, 0xD1, 0xE9, 0xAB, 0xC5, 0x33,
+    0x9E, 0x6A, 0xC9, 0x19, 0x6D, 0x3B, 0x95, 0x11, 0xFF, 0xD9, 0xF5, 0x37, 0xDD, 0x55, 0xB1, 0x6E,
+    0xD4, 0x40, 0x10, 0x1D, 0x7B, 0x89, 0x2C, 0xC5, 0x81, 0x6D, 0x68, 0x68, 0x70, 0x8B, 0x10, 0x89,
+    0x1B, 0xCA, 0x4B, 0xD6, 0xD4, 0x14, 0xC9, 0x27, 0x50, 0x50, 0x51, 0x53, 0x50, 0x20, 0x6C, 0xF1,
+    0x05, 0xFC, 0x01, 0xA9, 0x91, 0x10, 0x14, 0x29, 0x93, 0xD8, 0x22, 0x05, 0xAD, 0x81, 0x1F, 0x70,
+    0x97, 0x12, 0x17, 0x2E, 0x8C, 0xD8, 0xBB, 0xE5, 0xBD, 0x5D, 0xDF, 0xE5, 0x22, 0x02, 0x74, 0x29,
+    0xD8, 0xB3, 0xE7, 0x9D, 0x3D, 0x6B, 0xEF, 0x9B, 0x37, 0xB3, 0x63, 0x91, 0x3B, 0x82, 0xA1, 0x1B,
+    0x98, 0xC4, 0xC2, 0xA8, 0xF3, 0x16, 0xA6, 0xDD, 0x11, 0x89, 0x5B, 0xF9, 0x28, 0x17, 0xC3, 0x54,
+    0x38, 0xF7, 0x7B, 0x98, 0xD7, 0x98, 0x97, 0x37, 0x65, 0x01, 0xA3, 0x7B, 0xC9, 0x5A, 0x65, 0x45,
+    0x77, 0x52, 0x17, 0xB8, 0xC8, 0x3B, 0x98, 0xC4, 0xA6, 0x83, 0x88, 0x7B, 0x3C, 0x62, 0xEE, 0x39,
+    0xE6, 0xA6, 0x6E, 0x2E, 0x12, 0xD1, 0x48, 0xB9, 0xE0, 0x62, 0x8E, 0xEB, 0xB8, 0x02, 0xD6, 0x55,
+    0x7C, 0x33, 0x56, 0x94, 0xBC, 0xA7, 0x87, 0x0C, 0xD2, 0xC5, 0xD2, 0x1D, 0x39, 0xD2, 0x72, 0xF4,
+    0x94, 0xE3, 0x44, 0xE3, 0x85, 0xA7, 0xDB, 0x09, 0xBD, 0x7C, 0x78, 0x37, 0xE7, 0x75, 0xB1, 0x8D,
+    0xEB, 0x4A, 0x9E, 0xC8, 0x6F, 0x03, 0xCF, 0x59, 0x86, 0x97, 0x15, 0x72, 0x22, 0xAA, 0x97, 0xB4,
+    0x03, 0x4A, 0xC9, 0x5B, 0xAA, 0x57, 0x03, 0xE3, 0x2A, 0x11, 0xAB, 0xD5, 0x20, 0x91, 0x7D, 0xE2,
+    0xFA, 0x0B, 0x83, 0xA5, 0xF5, 0x4F, 0xAE, 0x5A, 0x93, 0x73, 0xE2, 0x59, 0x98, 0xC1, 0xB3, 0x92,
+    0x25, 0x5F, 0x2F, 0x96, 0xF8, 0x20, 0x4A, 0x4F, 0xD0, 0xD2, 0x4D, 0xBF, 0x21, 0xAF, 0xC4, 0x71,
+    0xD2, 0x69, 0x11, 0x48, 0x58, 0xFC, 0xA4, 0xC6, 0x4F, 0x4C, 0x63, 0x1A, 0xA8, 0x94, 0x77, 0xA2,
+    0x07, 0x3D, 0xC8, 0x55, 0x83, 0xC1, 0xE9, 0x6F, 0x96, 0x7F, 0xF0, 0x40, 0xDA, 0x67, 0x2D, 0x0C,
+    0x34, 0x4E, 0x06, 0x71, 0xA2, 0x46, 0xC9, 0x29, 0x78, 0x3A, 0xC2, 0x44, 0x2E, 0x06, 0x41, 0xF3,
+    0x15, 0x82, 0xE9, 0x1F, 0x58, 0x3A, 0x76, 0xE4, 0x53, 0xD2, 0x64, 0x24, 0xA1, 0x82, 0x7E, 0x64,
+    0x62, 0xA8, 0x98, 0x5F, 0x30, 0xB5, 0xCB, 0x40, 0x62, 0x2F, 0xA0, 0x77, 0xFB, 0x10, 0x0C, 0x3D,
+    0xD9, 0x62, 0x45, 0x64, 0x16, 0x60, 0x37, 0xC0, 0x4E, 0x80, 0x6C, 0x22, 0x59, 0x79, 0xD8, 0xAC,
+    0xE4, 0x1F, 0x23, 0x72, 0x18, 0xAC, 0x1A, 0xC0, 0xC8, 0xDC, 0x3B, 0x16, 0x82, 0xE2, 0x5D, 0xEF,
+    0x57, 0x9E, 0xC4, 0x12, 0x92, 0x4B, 0x90, 0x7A, 0x79, 0xF1, 0x8C, 0x87, 0x2C, 0x3C, 0x30, 0x41,
+    0x1E, 0xC0, 0x2C, 0xD6, 0xA1, 0x0C, 0xE0, 0xD3, 0x86, 0xC8, 0x26, 0xB0, 0x81, 0x87, 0x5D, 0xD1,
+    0xC1, 0x2C, 0x02, 0xD4, 0x31, 0x81, 0x5D, 0x46, 0x80, 0xA8, 0x6E, 0x45, 0x4B, 0x0E, 0x39, 0x99,
+    0xA2, 0x25, 0x8D, 0x2F, 0x30, 0x2E, 0xC9, 0xFB, 0xC7, 0x7F, 0x89, 0x55, 0xF1, 0x25, 0xC9, 0xCA,
+    0x4C, 0x75, 0x5A, 0x22, 0x16, 0xE6, 0x49, 0x32, 0x5F, 0x52, 0xCC, 0x8B, 0xBF, 0x62, 0x32, 0x6A,
+    0xBC, 0x5C, 0xF9, 0x3D, 0xB1, 0x78, 0x77, 0x88, 0x98, 0xDC, 0x40, 0x4A, 0x23, 0x72, 0x18, 0xE8,
+    0x86, 0x8D, 0xC9, 0x2A, 0x08, 0x0B, 0xD8, 0x49, 0xD3, 0xB0, 0x5E, 0xFD, 0x67, 0xF5, 0xB3, 0x10,
+    0x89, 0xD7, 0xB9, 0x0A, 0xE1, 0xB6, 0x21, 0x09, 0xE1, 0x4D, 0x66, 0x5C, 0x87, 0xF2, 0x12, 0xD4,
+    0xA1, 0x2E, 0xDD, 0x10, 0xD6, 0xEA, 0xD7, 0x20, 0x0E, 0xA0, 0x5C, 0xB7, 0x06, 0x49, 0x80, 0xD4,
+    0x57, 0x12, 0xB2, 0x35, 0x41, 0x13, 0x78, 0x34, 0x2B, 0x3A, 0x9D, 0xCF, 0x3E, 0x02, 0x53, 0x41,
+    0xE7, 0x68, 0x4A, 0x42, 0xED, 0x2E, 0x68, 0xF9, 0xFD, 0xE4, 0x3B, 0xC3, 0x32, 0xCE, 0x78, 0x71,
+    0x5D, 0x62, 0x3F, 0x0D, 0xBD, 0x30, 0x65, 0x33, 0x61, 0xE7, 0x08, 0xA9, 0xD6, 0x41, 0x94, 0x78,
+    0xBC, 0xB4, 0x29, 0xFE, 0xC3, 0x8A, 0xC7, 0xE8, 0xD9, 0xF1, 0x67, 0x29, 0x74, 0xCA, 0x4E, 0xC9,
+    0xC6, 0xF7, 0x3C, 0xA6, 0x33, 0x2A, 0xAE, 0xAD, 0xE2, 0x83, 0xE2, 0x68, 0xA7, 0xD1, 0xFC, 0x06,
+    0x1B, 0xB6, 0xA4, 0x6D, 0x68, 0x37, 0xE8, 0xE0, 0x62, 0xE0, 0xDE, 0xC3, 0xF9, 0x0A, 0xE7, 0x89,
+    0x6F, 0xAC, 0xFE, 0x64, 0x72, 0xD8, 0xCB, 0x39, 0x3D, 0xE9, 0xA7, 0x16, 0xCA, 0x86, 0xDE, 0xF0,
+    0x4B, 0x15, 0xBE, 0x5D, 0xAC, 0xAA, 0x3D, 0x7A, 0x6B, 0xC1, 0x37, 0x6A, 0x03, 0xE9, 0x4E, 0x9A,
+    0x5D, 0xD5, 0xE5, 0x11, 0x9E, 0x3B, 0xF2, 0x6F, 0x46, 0x8B, 0xCF, 0x75, 0x75, 0x57, 0x5E, 0x6E,
+    0x4A, 0x5C, 0xC5, 0x43, 0x12, 0x7F, 0x8F, 0x9B, 0xAE, 0xED, 0x8E, 0x76, 0xFA, 0x99, 0x9A, 0x5A,
+    0xF5, 0xC6, 0x01, 0xE4, 0xCA, 0x5D, 0x28, 0x78, 0x8E, 0xFB, 0x1F, 0x9C, 0x3B, 0x5B, 0x69, 0x38,
+    0x93, 0x64, 0x5F, 0xD4, 0x59, 0x97, 0xB4, 0xB5, 0xEB, 0xB8, 0x11, 0x9E, 0x15, 0xA2, 0xBF, 0x58,
+    0xF3, 0xD9, 0xD6, 0x55, 0xDA, 0xA6, 0xED, 0x5C, 0xE6, 0x79, 0x9B, 0x9F, 0x59, 0x65, 0xEB, 0xA6,
+    0x6E, 0xF2, 0x2F, 0x8F, 0x1A, 0x1D, 0xF5, 0xB7, 0x58, 0x5D, 0xC3, 0xCD, 0xAD, 0x7B, 0x5B, 0x0F,
+    0x1F, 0xE4, 0x7D, 0x5A, 0x31, 0xB0, 0xE3, 0x78, 0xC0, 0x3D, 0x84, 0xA1, 0x3B, 0x7C, 0x2F, 0x4C,
+    0x73, 0x20, 0x72, 0x20, 0xCF, 0x65, 0x7B, 0x27, 0xEA, 0xF5, 0xDB, 0x0A, 0x6A, 0xC2, 0x2F, 0x6F,
+    0xE4, 0xB6, 0xE0, 0x40, 0xA0, 0x38, 0x20, 0xF0, 0x9C, 0x98, 0xB5, 0xD1, 0x7B, 0xC1, 0x81, 0xEF,
+    0xA9, 0xAB, 0xD0, 0xEB, 0x4D, 0x8B, 0x0D, 0x84, 0x80, 0xCB, 0x46, 0xCD, 0xAF, 0x48, 0xE0, 0x2F,
+    0xC5, 0x55, 0x31, 0x6F, 0x1C, 0x55, 0x10, 0xFE, 0xDE, 0xDB, 0xDC, 0xAD, 0x61, 0x6D, 0xBF, 0x26,
+    0x48, 0x44, 0x46, 0x59, 0x0A, 0x17, 0x56, 0x30, 0xAC, 0x8B, 0x2B, 0x2C, 0xE1, 0x63, 0x17, 0x53,
+    0x50, 0xD0, 0xB8, 0xC8, 0x49, 0xE9, 0x48, 0x4D, 0x03, 0x85, 0x4B, 0xC3, 0x6D, 0xC2, 0x1F, 0x88,
+    0x84, 0xA8, 0x71, 0x01, 0x05, 0x6E, 0x9C, 0xC2, 0x1D, 0x49, 0xF6, 0x39, 0x14, 0x54, 0xA0, 0x15,
+    0x88, 0x7E, 0x41, 0xA1, 0x20, 0x14, 0x6C, 0xB1, 0x88, 0x05, 0xED, 0xDD, 0x30, 0x33, 0x7B, 0xB6,
+    0x95, 0x28, 0x12, 0x12, 0x0D, 0xA3, 0xD5, 0xEC, 0xEE, 0xBD, 0xB7, 0x33, 0xDF, 0x7C, 0xDF, 0xCC,
+    0x3B, 0x00, 0xE1, 0x1C, 0xE4, 0x5D, 0x63, 0x09, 0x69, 0x19, 0xB6, 0x20, 0x24, 0x15, 0x80, 0x60,
+    0x8E, 0xA4, 0x06, 0x65, 0x61, 0x87, 0xD4, 0x1B, 0x82, 0x6B, 0x30, 0xF5, 0xB8, 0x69, 0x4F, 0xDF,
+    0x75, 0x8D, 0xF1, 0x11, 0xEF, 0x58, 0x47, 0x65, 0x7F, 0x0C, 0xBB, 0x15, 0x6C, 0xF3, 0x4B, 0xF1,
+    0xE5, 0x1E, 0xD1, 0x6C, 0x30, 0xE9, 0x00, 0xBE, 0x5A, 0x98, 0x06, 0xB6, 0x06, 0x56, 0xE0, 0x37,
+    0xA3, 0xB7, 0xAA, 0x75, 0x84, 0x6F, 0x07, 0x99, 0xDF, 0x34, 0x90, 0x9F, 0x46, 0x71, 0x95, 0x34,
+    0xE6, 0xF0, 0x73, 0x4B, 0x79, 0x61, 0x35, 0x14, 0x30, 0xC4, 0xBA, 0xEB, 0x02, 0xBC, 0xA8, 0x2F,
+    0x83, 0x37, 0x39, 0x56, 0x4A, 0x54, 0xF2, 0x73, 0x58, 0xCE, 0x92, 0x1F, 0xBA, 0xC2, 0x07, 0x75,
+    0x50, 0x27, 0x3E, 0xF1, 0x04, 0x0A, 0xBB, 0xA8, 0x4B, 0xAA, 0xA4, 0xB2, 0xCD, 0xCA, 0xF2, 0xC6,
+    0xF2, 0x68, 0x33, 0xA9, 0xA3, 0x9C, 0x77, 0xBA, 0xCE, 0x50, 0x96, 0xD6, 0x41, 0x87, 0x69, 0xEE,
+    0x6A, 0x3B, 0x17, 0xBC, 0x80, 0xC9, 0x02, 0x2C, 0xC1, 0x55, 0x18, 0x61, 0xF4, 0x4A, 0x55, 0xE4,
+    0x58, 0x37, 0x55, 0x98, 0xAF, 0x62, 0x13, 0x71, 0x3D, 0x64, 0x84, 0x41, 0x35, 0x8E, 0x7C, 0x17,
+    0xDF, 0x6E, 0x52, 0x7B, 0xF8, 0xFC, 0xD1, 0xE1, 0x94, 0x1E, 0x96, 0x57, 0x1D, 0x4E, 0x36, 0x6C,
+    0x7E, 0x13, 0x57, 0xC6, 0x38, 0x71, 0xEF, 0x78, 0x26, 0xC8, 0x72, 0x45, 0x15, 0xCC, 0x1D, 0x04,
+    0x35, 0x98, 0x11, 0xF7, 0x59, 0x36, 0xB6, 0xD5, 0x09, 0x36, 0x6D, 0x13, 0xDA, 0xDF, 0xAD, 0xAF,
+    0xCA, 0xEA, 0xE4, 0xB5, 0x7A, 0x27, 0x68, 0xD0, 0x5B, 0x41, 0x3F, 0x1F, 0x7D, 0x91, 0xF1, 0x83,
+    0x25, 0x7A, 0x48, 0x74, 0x28, 0x4F, 0xCF, 0xD8, 0xC9, 0x25, 0xFE, 0xC9, 0x95, 0x16, 0x44, 0x7E,
+    0x3B, 0xC8, 0xB7, 0x96, 0x9D, 0xC1, 0x65, 0x93, 0xD5, 0xD1, 0x6E, 0x79, 0x35, 0x7C, 0xDC, 0x39,
+    0xAA, 0x75, 0xCF, 0xA9, 0x5F, 0x8D, 0x30, 0xDA, 0x36, 0xBE, 0x8C, 0x42, 0x6A, 0x07, 0x93, 0x2C,
+    0xF8, 0x29, 0xDF, 0xD8, 0xCF, 0x4F, 0x3F, 0x1E, 0x2E, 0x6D, 0x8C, 0xB6, 0xCA, 0x6C, 0x17, 0xC3,
+    0xA5, 0x60, 0xDF, 0x96, 0x81, 0x5F, 0xA9, 0xF6, 0x3F, 0x78, 0x56, 0x9E, 0x97, 0x42, 0xBF, 0x75,
+    0xB0, 0x2E, 0x20, 0x98, 0xA7, 0x13, 0x20, 0xE6, 0xB2, 0xBD, 0xA8, 0x84, 0x64, 0x01, 0x18, 0x51,
+    0x19, 0x95, 0x33, 0xCC, 0x92, 0x32, 0xF9, 0xBA, 0x0B, 0x98, 0xEE, 0xC2, 0x5F, 0x3B, 0xFA, 0x84,
+    0x66, 0x3B, 0xC1, 0x37, 0xF9, 0xCE, 0xE1, 0x50, 0x4A, 0xB9, 0x84, 0x63, 0x9A, 0x05, 0x0C, 0xD7,
+    0x5C, 0xC7, 0x53, 0xF6, 0xC2, 0x9E, 0x23, 0xAA, 0xB8, 0x1A, 0x69, 0x1C, 0x84, 0xDE, 0xED, 0xD6,
+    0x91, 0x6F, 0x83, 0xFA, 0x43, 0xB4, 0x29, 0xEE, 0x39, 0x9F, 0x86, 0x55, 0x7C, 0xEB, 0x70, 0x78,
+    0xE7, 0xCA, 0xC4, 0x52, 0x97, 0x92, 0x37, 0x2D, 0x92, 0x8C, 0xA1, 0x5D, 0x5B, 0x7C, 0xBF, 0xC2,
+    0x32, 0x31, 0xB2, 0xAD, 0xC5, 0x93, 0x6D, 0x5E, 0xC7, 0x57, 0xDF, 0xDE, 0x5D, 0x75, 0xDF, 0xD9,
+    0xB2, 0xF0, 0x3B, 0xDC, 0x79, 0xC6, 0xEB, 0xEA, 0x2A, 0xF4, 0x69, 0x24, 0x60, 0xD4, 0xEE, 0xA9,
+    0x0F, 0x6A, 0xBD, 0x25, 0x5E, 0x6F, 0x73, 0x71, 0x6B, 0xC4, 0x52, 0x35, 0x01, 0x1D, 0x57, 0xDC,
+    0xBD, 0x69, 0xE9, 0x2A, 0xCB, 0x55, 0x21, 0xFA, 0x9B, 0x7C, 0x52, 0x62, 0x48, 0x8F, 0xF0, 0x86,
+    0xEE, 0x65, 0x59, 0xC5, 0x5C, 0xD5, 0x97, 0xB1, 0x80, 0x33, 0xD8, 0x63, 0x37, 0xED, 0x30, 0x36,
+    0x5D, 0x82, 0x83, 0xA0, 0x76, 0xB7, 0x9A, 0xC8, 0x07, 0x5A, 0xDC, 0x7B, 0xD9, 0x45, 0xD5, 0x96,
+    0x32, 0x93, 0xB9, 0xDF, 0xCA, 0xB0, 0x4C, 0xD1, 0xB8, 0xFC, 0x3E, 0xA6, 0x84, 0x1B, 0x88, 0xFB,
+    0x90, 0x8A, 0x70, 0xD6, 0x33, 0x7E, 0x61, 0xD2, 0xFF, 0x4C, 0xB9, 0xBD, 0x2B, 0x2F, 0x97, 0xC7,
+    0xCB, 0x4B, 0x2F, 0x6B, 0xEF, 0x6B, 0xD7, 0xBF, 0x2A, 0x83, 0x60, 0x6B, 0xF3, 0x07, 0x4C, 0x91,
+    0x71, 0x01, 0x5C, 0xC1, 0xC2, 0xD6, 0x68, 0x9E, 0xC1, 0xFE, 0x82, 0xC1, 0x03, 0x61, 0x00, 0xC3,
+    0x72, 0x24, 0xBF, 0x6E, 0xEB, 0xB7, 0xCF, 0x9D, 0xC7, 0x15, 0x6B, 0xB9, 0xDF, 0xC4, 0xCA, 0xFE,
+    0xD6, 0xB7, 0xA3, 0x2B, 0x7B, 0xB8, 0xD9, 0x53, 0xAA, 0x85, 0xD5, 0x39, 0x03, 0xCA, 0x59, 0x9A,
+    0x3F, 0xAD, 0xEB, 0x60, 0x32, 0xB9, 0x0E, 0x96, 0xB6, 0x43, 0x2C, 0x2E, 0xD5, 0x5D, 0xE2, 0x3E,
+    0x12, 0x77, 0x5F, 0x5C, 0x77, 0xE6, 0xCC, 0x6C, 0x32, 0xC9, 0x24, 0x7D, 0xC6, 0x3D, 0x42, 0xBD,
+    0x26, 0x9A, 0x21, 0x12, 0x59, 0x9C, 0x3A, 0x49, 0x10, 0x7F, 0xCA, 0x31, 0x13, 0x0D, 0x47, 0xD4,
+    0x32, 0x67, 0x8C, 0x92, 0x07, 0xA0, 0x3E, 0xCB, 0x99, 0x60, 0x0C, 0x56, 0x87, 0xDD, 0x78, 0x21,
+    0xEF, 0xFF, 0x84, 0x65, 0x60, 0x84, 0xC2, 0xEF, 0xC5, 0xB5, 0x7D, 0x08, 0xD3, 0x9E, 0xA7, 0xD2,
+    0xCC, 0x1A, 0x28, 0xD2, 0xC3, 0xB2, 0x39, 0xCF, 0x3F, 0x3D, 0x66, 0x32, 0x13, 0x09, 0xE2, 0x66,
+    0x66, 0x0E, 0xEE, 0x3A, 0xE7, 0x6D, 0x27, 0x87, 0x21, 0x77, 0xC3, 0x81, 0x7C, 0x98, 0x20, 0xCE,
+    0x39, 0x7F, 0x54, 0xF2, 0xD9, 0x26, 0xC7, 0x49, 0xCD, 0x1F, 0x4E, 0xF9, 0x74, 0x45, 0xDA, 0xB2,
+    0x06, 0xEE, 0x91, 0x66, 0xD7, 0x96, 0x88, 0x35, 0x0B, 0xCE, 0xE0, 0x2A, 0xFA, 0xB0, 0xC4, 0xBF,
+    0x99, 0x99, 0x4C, 0x26, 0x90, 0xCA, 0x3D, 0x48, 0x80, 0x28, 0x43, 0x49, 0x7E, 0xD6, 0x0A, 0xA1,
+    0xD4, 0x62, 0xBB, 0x0B, 0xDD, 0xA5, 0x31, 0x62, 0xAD, 0x45, 0x56, 0x82, 0x8B, 0x95, 0x42, 0x56,
+    0x52, 0xA5, 0x4B, 0x29, 0x94, 0xFA, 0xAD, 0xAE, 0xD0, 0xF9, 0x4A, 0x52, 0x3F, 0x91, 0xBB, 0x90,
+    0x3D, 0x11, 0x11, 0x67, 0x9B, 0x96, 0x71, 0x05, 0x3B, 0x13, 0x72, 0x24, 0x70, 0xA7, 0x39, 0x3A,
+    0x4D, 0x77, 0x83, 0xAB, 0x3D, 0x67, 0x4C, 0x78, 0xCE, 0xA1, 0x72, 0x29, 0xEA, 0xB3, 0x81, 0x56,
+    0x9C, 0x3D, 0x26, 0x44, 0xBC, 0xF3, 0x41, 0x1E, 0xD1, 0xAF, 0xC7, 0xE4, 0x23, 0x91, 0x24, 0x0B,
+    0xD9, 0xCD, 0x75, 0x3F, 0x2F, 0x91, 0x1E, 0x3D, 0x6B, 0xF4, 0xD7, 0x13, 0x2C, 0xC8, 0x18, 0xC7,
+    0xC2, 0x82, 0x28, 0x5B, 0xA3, 0x17, 0x19, 0xE9, 0x2C, 0xBB, 0x74, 0x06, 0xBB, 0x1F, 0xFC, 0x3E,
+    0xD1, 0xE2, 0x2C, 0x20, 0xF5, 0xA9, 0x46, 0x0A, 0x65, 0xF0, 0xE4, 0x34, 0x9F, 0xEB, 0x8B, 0xCE,
+    0xD3, 0x50, 0x6B, 0x63, 0xB8, 0x2A, 0x79, 0xA2, 0x6C, 0x44, 0x92, 0x83, 0xB1, 0xD4, 0xE0, 0x39,
+    0xE5, 0x1C, 0xC5, 0xE3, 0x63, 0x46, 0xC5, 0x9D, 0x44, 0xB3, 0x27, 0x7C, 0xA2, 0x33, 0x69, 0x8A,
+    0x3E, 0x6C, 0x6F, 0x41, 0x2B, 0x8C, 0x33, 0xB5, 0x91, 0xD2, 0xC4, 0x44, 0xB3, 0x48, 0xCC, 0x14,
+    0x9F, 0x66, 0x3C, 0x90, 0x4C, 0x56, 0xA1, 0x98, 0xE6, 0xE0, 0x66, 0x12, 0x32, 0x3B, 0xB9, 0xA2,
+    0x56, 0xFE, 0x8F, 0xF9, 0xE2, 0x32, 0xD2, 0x1A, 0xD3, 0x0A, 0xEF, 0x57, 0xF8, 0x4F, 0xF6, 0x0F,
+    0xC5, 0x55, 0x31, 0x8E, 0xDC, 0x46, 0x10, 0x6C, 0x72, 0x20, 0x10, 0xF0, 0x04, 0x93, 0xD8, 0x0E,
+    0xEC, 0x80, 0x3F, 0x38, 0x7E, 0xE0, 0x4E, 0xC3, 0xDC, 0xC9, 0x25, 0x7E, 0x87, 0x3F, 0x20, 0x99,
+    0x84, 0xFD, 0x81, 0x7B, 0x82, 0x12, 0x01, 0x82, 0xDF, 0x70, 0xD6, 0x0C, 0x9C, 0x38, 0x25, 0xE0,
+    0x07, 0x98, 0x81, 0x1F, 0x40, 0x40, 0x14, 0x40, 0x19, 0x24, 0xDB, 0x55, 0x4D, 0xEE, 0x4A, 0x32,
+    0xA4, 0x58, 0xC4, 0xDE, 0xDC, 0xEE, 0x74, 0x4F, 0x77, 0x4D, 0x77, 0x75, 0x51, 0x42, 0xAE, 0x73,
+    0xB9, 0x96, 0xAB, 0xC4, 0x1C, 0xB3, 0x5F, 0xFC, 0x22, 0xDA, 0x6A, 0x2B, 0x9F, 0x7E, 0xDC, 0x82,
+    0x25, 0x66, 0x91, 0x8A, 0x5F, 0x12, 0xDC, 0xFC, 0x84, 0x2F, 0x8A, 0xBF, 0x30, 0x88, 0x14, 0x2B,
+    0xBE, 0x34, 0xF9, 0xE2, 0xF7, 0x91, 0x79, 0x84, 0x79, 0xA7, 0x19, 0x7E, 0x6E, 0x3D, 0xC3, 0x78,
+    0xFA, 0x31, 0x5B, 0x98, 0x45, 0x4A, 0xFA, 0x45, 0x1C, 0xA8, 0xE8, 0xF7, 0xD3, 0x78, 0xE6, 0xFC,
+    0x8D, 0x4B, 0xD7, 0x9F, 0x47, 0x25, 0x30, 0x62, 0xC5, 0x00, 0xE5, 0x26, 0x67, 0x70, 0x8B, 0xF5,
+    0x81, 0xD9, 0xE2, 0x5B, 0x36, 0x49, 0x57, 0x73, 0xCD, 0x80, 0x7E, 0xBE, 0x98, 0xE5, 0x30, 0xB7,
+    0x17, 0x33, 0x01, 0x4A, 0x45, 0x73, 0xF9, 0x3F, 0x73, 0x07, 0x73, 0x9B, 0x60, 0x8E, 0x8A, 0xE0,
+    0xB5, 0xC2, 0xC7, 0x2B, 0x80, 0x3B, 0x7E, 0x13, 0x7D, 0xF8, 0xB8, 0x44, 0xF7, 0x06, 0x57, 0x95,
+    0xE1, 0x9C, 0xAA, 0x95, 0x32, 0xB4, 0xF2, 0x8C, 0xDB, 0xCF, 0xA4, 0x24, 0xBC, 0x72, 0x94, 0xD0,
+    0x1F, 0xDB, 0x77, 0xDC, 0xBE, 0x3D, 0xB6, 0x8B, 0x49, 0x42, 0x3E, 0xB6, 0xA3, 0xBE, 0xE0, 0x76,
+    0xA1, 0x48, 0x81, 0x6D, 0x9F, 0xCB, 0xD9, 0xB6, 0x79, 0xF4, 0x56, 0x64, 0x91, 0x2A, 0x63, 0xBB,
+    0x1A, 0xA4, 0x39, 0xB6, 0xB1, 0x83, 0xED, 0x55, 0xFC, 0x80, 0x48, 0xD5, 0x58, 0x28, 0x13, 0x34,
+    0x3C, 0xFD, 0x08, 0x84, 0xAA, 0x3D, 0xCA, 0x0A, 0x30, 0x0B, 0xAB, 0x55, 0xEB, 0xBF, 0x52, 0x5E,
+    0x41, 0x3F, 0x39, 0x5A, 0xED, 0x50, 0xBB, 0xC9, 0x20, 0x18, 0x52, 0x9C, 0xBA, 0xC1, 0xBF, 0xA7,
+    0x62, 0x40, 0x91, 0x82, 0xF6, 0x2A, 0x1B, 0x4E, 0xFE, 0xB1, 0x42, 0x8B, 0xD9, 0x01, 0x15, 0xCF,
+    0x3F, 0x88, 0xCA, 0x67, 0xF0, 0x59, 0xDC, 0x24, 0xAB, 0x1B, 0x69, 0x0F, 0x2D, 0x0A, 0xF4, 0x5C,
+    0xDC, 0x88, 0x90, 0xC4, 0xC8, 0x70, 0x59, 0xEE, 0x10, 0xAE, 0x1A, 0x25, 0x32, 0xDC, 0x2C, 0xE9,
+    0x97, 0xC9, 0x10, 0xE6, 0xC5, 0x42, 0x0D, 0x77, 0x04, 0xA8, 0x43, 0xCD, 0x1A, 0xEF, 0x57, 0x1A,
+    0x06, 0x06, 0x9F, 0x3A, 0xAE, 0x7F, 0x70, 0xD9, 0xBF, 0x7A, 0xF9, 0xC3, 0xF4, 0xCD, 0xFD, 0xD9,
+    0x3A, 0x31, 0x22, 0x54, 0xAC, 0xA1, 0xB1, 0xEF, 0x6C, 0x5E, 0xF5, 0x96, 0xBD, 0x69, 0xAC, 0x15,
+    0xCC, 0x80, 0x0A, 0xF4, 0x5D, 0x2B, 0xCD, 0x0C, 0x4C, 0x20, 0x5D, 0x31, 0x93, 0x08, 0x40, 0x01,
+    0x62, 0x34, 0xC6, 0xC2, 0x45, 0xDC, 0x06, 0xB4, 0x52, 0x4F, 0xD2, 0xB4, 0x92, 0x32, 0xAE, 0xE9,
+    0x76, 0xC6, 0xAD, 0x67, 0x89, 0x3D, 0x37, 0x76, 0xC4, 0x38, 0x38, 0xC4, 0x36, 0xF6, 0x56, 0x39,
+    0x4B, 0x58, 0x1A, 0x5B, 0x0B, 0x83, 0x20, 0x87, 0x7D, 0x95, 0xCF, 0x3F, 0x6E, 0x66, 0x27, 0x30,
+    0x2E, 0xA4, 0xC7, 0x6E, 0x34, 0x8B, 0x6D, 0xEA, 0x09, 0x9F, 0x4C, 0x0F, 0x23, 0x39, 0xE7, 0x66,
+    0xDE, 0xAE, 0x5C, 0xED, 0x8E, 0x7B, 0x24, 0xBB, 0xBB, 0x8E, 0x6B, 0x63, 0xE4, 0x0A, 0xB6, 0x56,
+    0x6A, 0x8C, 0xB2, 0x15, 0xB7, 0x3C, 0xC8, 0x77, 0x38, 0x11, 0x40, 0x78, 0xA3, 0x36, 0xAD, 0x89,
+    0x7C, 0xDD, 0x02, 0xD3, 0xA9, 0x39, 0x77, 0x7D, 0x44, 0x91, 0xE2, 0xE0, 0xE1, 0x1C, 0xA6, 0x02,
+    0xCE, 0x98, 0xC5, 0xA8, 0x76, 0xA5, 0xDA, 0x56, 0x79, 0xFD, 0x7E, 0xE4, 0xCF, 0xB9, 0x02, 0xE4,
+    0xF7, 0xCA, 0xF0, 0x4A, 0xCE, 0x7A, 0x63, 0xD0, 0x38, 0x51, 0x71, 0x64, 0x91, 0xC2, 0xC6, 0x21,
+    0x72, 0xC8, 0x8A, 0xC9, 0x4B, 0x2B, 0xCF, 0xD5, 0xDA, 0xC3, 0xA5, 0x02, 0x19, 0x31, 0xA1, 0x80,
+    0x08, 0xE7, 0xF8, 0x37, 0x9C, 0xB3, 0x7F, 0x4B, 0xE7, 0x72, 0x8B, 0x74, 0xEE, 0x7E, 0xA5, 0x73,
+    0x98, 0x12, 0x9C, 0xDD, 0x1A, 0xE8, 0xAC, 0x05, 0x9D, 0x9B, 0xA1, 0x99, 0x24, 0xFE, 0xB9, 0xB0,
+    0x15, 0xEF, 0x76, 0x41, 0x05, 0x34, 0x65, 0x0F, 0x67, 0x5C, 0x43, 0x73, 0xA1, 0x9B, 0xD4, 0x0B,
+    0x6E, 0xDB, 0x3A, 0x7E, 0x46, 0x0A, 0x48, 0xC4, 0x65, 0xF4, 0x18, 0xAC, 0xAA, 0x65, 0x83, 0x26,
+    0x52, 0xF5, 0x39, 0xCB, 0xC4, 0x0B, 0x06, 0xAB, 0xCF, 0x77, 0x0F, 0x9F, 0xE8, 0x0B, 0x18, 0xF5,
+    0x35, 0x39, 0x8A, 0xCF, 0xA3, 0x14, 0x8B, 0xF1, 0x94, 0xDC, 0xF5, 0x83, 0xD1, 0x1A, 0xD7, 0xED,
+    0xA1, 0x6A, 0xC5, 0x4A, 0xAE, 0xD5, 0x99, 0xB4, 0xDB, 0x49, 0xB8, 0xF0, 0x86, 0x2D, 0x4F, 0x6A,
+    0xFD, 0x60, 0xF0, 0xB8, 0xDA, 0xF4, 0xB3, 0x58, 0x8D, 0x09, 0x92, 0x31, 0xB4, 0xCB, 0x97, 0xDF,
+    0x35, 0x7E, 0x97, 0x89, 0x60, 0x22, 0xFD, 0x9D, 0xB5, 0xB2, 0x7B, 0xB8, 0x4C, 0x64, 0x71, 0x8F,
+    0xDC, 0xF2, 0x33, 0x59, 0x18, 0xB2, 0xB3, 0x79, 0x8B, 0x6C, 0x8B, 0x1F, 0x39, 0x32, 0x1B, 0x11,
+    0x05, 0x0E, 0x1A, 0xF5, 0x16, 0x5E, 0x3D, 0xF0, 0x5D, 0xBD, 0x42, 0x06, 0x68, 0x1C, 0xFF, 0x1D,
+    0xA9, 0xDA, 0x90, 0x4F, 0xDC, 0x1D, 0x9B, 0x0A, 0x75, 0x98, 0xCD, 0x8B, 0xD3, 0x50, 0x29, 0xF5,
+    0x20, 0x1D, 0x0A, 0x65, 0x32, 0x54, 0x19, 0x93, 0x1F, 0xAD, 0xDB, 0xFD, 0x95, 0xC7, 0x4F, 0x2E,
+    0xB5, 0xB1, 0x99, 0x32, 0xC1, 0x36, 0x91, 0xB6, 0x1E, 0x03, 0x94, 0x09, 0xEC, 0x6A, 0x5C, 0xFB,
+    0x8B, 0x07, 0x3A, 0xBE, 0x08, 0xDC, 0x44, 0xF1, 0x6F, 0xFA, 0xD7, 0x24, 0x79, 0xB9, 0xF0, 0xED,
+    0xC0, 0x37, 0x41, 0x22, 0x5D, 0x50, 0xBB, 0x0E, 0x21, 0x7A, 0x80, 0x87, 0xD2, 0x82, 0x2C, 0x38,
+    0x10, 0x48, 0x0C, 0x34, 0xC7, 0x73, 0xB6, 0x0D, 0xDF, 0xE2, 0x6C, 0xE4, 0x29, 0xDA, 0x31, 0xB3,
+    0xB0, 0xCA, 0xD4, 0x6E, 0x65, 0x0D, 0x39, 0x8E, 0x0A, 0xC6, 0x76, 0x14, 0xB8, 0x74, 0xC5, 0xB6,
+    0x5D, 0xA6, 0xCE, 0x5E, 0x43, 0xCC, 0x0A, 0x8C, 0x7B, 0x4F, 0xE1, 0x9B, 0x99, 0xF5, 0x51, 0x50,
+    0xBF, 0xA7, 0xCC, 0x75, 0xC3, 0xF2, 0xDD, 0xA0, 0x83, 0xB8, 0x38, 0xAA, 0x87, 0x8A, 0xB4, 0xDF,
+    0x93, 0xFD, 0x6A, 0x81, 0x07, 0x06, 0xC6, 0xFC, 0x43, 0xD5, 0xAE, 0xF2, 0xF3, 0xCE, 0x34, 0x9D,
+    0xDA, 0x67, 0x67, 0x6F, 0x29, 0x7D, 0x13, 0x15, 0x24, 0x7B, 0x46, 0x82, 0x30, 0xCF, 0xC5, 0xF6,
+    0x63, 0x6A, 0x3D, 0xD5, 0x26, 0x92, 0x66, 0x14, 0x63, 0x74, 0xC2, 0xE7, 0x86, 0x8D, 0x00, 0xA2,
+    0x0D, 0xCA, 0x12, 0xA6, 0xBA, 0xFF, 0x56, 0x7B, 0x54, 0x7D, 0xE5, 0xFD, 0x86, 0x9A, 0xD7, 0x48,
+    0xBA, 0xCB, 0x17, 0x7B, 0xFE, 0x03, 0xBD, 0x55, 0x31, 0x8E, 0xDC, 0x46, 0x10, 0xEC, 0x21, 0x21,
+    0x31, 0x20, 0x8C, 0xC9, 0x9C, 0xF2, 0x09, 0x7C, 0xC2, 0x10, 0xB8, 0x07, 0xD8, 0x81, 0x19, 0xF9,
+    0x07, 0x4A, 0xEE, 0x05, 0x27, 0x12, 0xB8, 0xD0, 0xB1, 0x63, 0x2B, 0x94, 0xE5, 0xC0, 0x1F, 0x90,
+    0x8E, 0x03, 0x38, 0x70, 0x3A, 0x80, 0x02, 0x87, 0x22, 0x60, 0x03, 0x0E, 0x3D, 0x80, 0x68, 0x81,
+    0xB2, 0x48, 0xB6, 0xAB, 0x7A, 0x77, 0x4F, 0xB0, 0x2E, 0x96, 0x17, 0x87, 0xDE, 0xBD, 0x9E, 0x9E,
+    0x9E, 0xAE, 0xEA, 0x9A, 0x1E, 0x71, 0x7D, 0xDF, 0x4B, 0xA9, 0xAA, 0x51, 0x60, 0xB2, 0x3C, 0x15,
+    0x7C, 0xDA, 0x11, 0xC6, 0x27, 0x98, 0x2A, 0xC3, 0x14, 0x1B, 0x9D, 0x07, 0x4D, 0xE8, 0x60, 0x9A,
+    0x08, 0x53, 0x73, 0xA5, 0xFC, 0xB8, 0x32, 0x71, 0x25, 0x70, 0xC5, 0x73, 0xA5, 0x5A, 0xB9, 0xD1,
+    0x56, 0xF4, 0x7E, 0xA5, 0xE5, 0x0A, 0x23, 0x78, 0x92, 0x53, 0xC5, 0x72, 0xFB, 0xE2, 0xE7, 0x24,
+    0xE5, 0x2C, 0x48, 0x74, 0x23, 0x3E, 0x4A, 0x1D, 0x1D, 0x76, 0xAE, 0xD2, 0x76, 0xD2, 0x74, 0x65,
+    0x96, 0x22, 0x4B, 0xC0, 0x6E, 0xA9, 0x66, 0xA9, 0x92, 0xEC, 0x22, 0x2F, 0x19, 0xE5, 0xA3, 0xDB,
+    0x2C, 0x6A, 0x94, 0x56, 0xCA, 0x55, 0xEA, 0x19, 0x95, 0xA1, 0x4C, 0x94, 0x8B, 0x3A, 0x94, 0x50,
+    0xF4, 0xF0, 0xB4, 0x91, 0x66, 0x25, 0x96, 0xC0, 0x33, 0xAA, 0x19, 0xBB, 0xF9, 0xE3, 0x51, 0xDF,
+    0x7F, 0xC3, 0x3A, 0x36, 0x69, 0x68, 0x82, 0x81, 0xA3, 0x31, 0x02, 0x5E, 0xD1, 0x6C, 0x17, 0xE3,
+    0xF6, 0xBE, 0xEF, 0x0A, 0xE4, 0xE9, 0x48, 0x94, 0x94, 0x86, 0x6F, 0x26, 0x07, 0x06, 0xD7, 0x0C,
+    0x19, 0x6B, 0xBE, 0x47, 0xCE, 0xD6, 0xD2, 0xE1, 0x4C, 0x19, 0x54, 0x17, 0x99, 0x08, 0x15, 0x1C,
+    0xE0, 0x18, 0x69, 0x00, 0x67, 0x97, 0x61, 0x75, 0x8A, 0xFD, 0x5B, 0xA1, 0x89, 0x4C, 0xF9, 0xA5,
+    0x56, 0xA3, 0xA8, 0xC9, 0x61, 0xF5, 0x8B, 0x51, 0xA5, 0x69, 0x62, 0xBE, 0xE9, 0x56, 0xEB, 0xD5,
+    0x18, 0xF4, 0xEB, 0xC0, 0x53, 0x8A, 0x3D, 0xFC, 0x66, 0x55, 0x55, 0xBB, 0x9A, 0x43, 0xFC, 0x07,
+    0xDD, 0x8D, 0x52, 0xA0, 0x48, 0xF6, 0x23, 0xE8, 0x71, 0x22, 0xF9, 0x74, 0xB0, 0x91, 0x9D, 0xCE,
+    0x0E, 0x8D, 0x67, 0x87, 0xFD, 0x70, 0xA4, 0x66, 0x3C, 0xED, 0xFD, 0x8B, 0x15, 0x38, 0x7D, 0xAB,
+    0x3F, 0x28, 0xFB, 0xA4, 0xCD, 0x1E, 0x90, 0xA6, 0xD0, 0xAC, 0xCB, 0xB4, 0x33, 0xE9, 0x95, 0x26,
+    0xE0, 0x2A, 0x75, 0x69, 0xB5, 0x00, 0xB6, 0xA0, 0x9D, 0x6E, 0xF8, 0xEF, 0x74, 0x94, 0x3C, 0xD6,
+    0x3F, 0x50, 0x2E, 0x03, 0xFE, 0xF9, 0x89, 0x05, 0x1A, 0x45, 0x35, 0x8F, 0x6D, 0x2F, 0x24, 0xA2,
+    0x05, 0x8F, 0xBE, 0xDD, 0x19, 0x35, 0x22, 0x0D, 0x8B, 0x76, 0xC7, 0x3D, 0xC1, 0xF9, 0x42, 0x26,
+    0x5B, 0x50, 0xAE, 0xC5, 0x2C, 0x53, 0xF4, 0xD4, 0x07, 0x88, 0x9C, 0xC5, 0x84, 0x72, 0x7D, 0x74,
+    0xE7, 0xC3, 0xE4, 0xB9, 0xD9, 0x36, 0x32, 0x03, 0x15, 0x18, 0xD0, 0xFD, 0x51, 0xFC, 0x2E, 0xD5,
+    0x82, 0xD4, 0x51, 0x26, 0x9C, 0xB2, 0x51, 0x86, 0x8D, 0x8E, 0x08, 0xA9, 0x50, 0x66, 0x9B, 0x84,
+    0x9D, 0x43, 0x67, 0xDE, 0x20, 0x38, 0xD6, 0x7F, 0x33, 0x18, 0x74, 0x32, 0x78, 0xB8, 0x65, 0xB0,
+    0xCF, 0x13, 0x82, 0xCB, 0xCD, 0x33, 0x58, 0x1D, 0x83, 0xDB, 0x04, 0xC1, 0x86, 0x5F, 0xD7, 0x12,
+    0x39, 0xDE, 0x1F, 0x32, 0x20, 0xC7, 0x14, 0x6B, 0x04, 0x83, 0x59, 0x8D, 0x0E, 0x20, 0x1A, 0x48,
+    0x90, 0xAA, 0xC0, 0x1F, 0xD2, 0x22, 0x78, 0x93, 0x5A, 0xAD, 0xBA, 0x2C, 0x5F, 0x10, 0xB4, 0x94,
+    0x44, 0xB5, 0x51, 0xD3, 0xA8, 0xC3, 0x00, 0xB7, 0xC6, 0xB9, 0x3C, 0xB9, 0x87, 0xF3, 0x10, 0xD6,
+    0x8B, 0x07, 0xB0, 0x8A, 0x87, 0xB0, 0xCA, 0xFF, 0xC2, 0xCA, 0x17, 0x58, 0xEB, 0x67, 0x84, 0x15,
+    0x3A, 0x1C, 0x8F, 0xAB, 0x07, 0xB5, 0xF8, 0xB9, 0x5E, 0xE8, 0x80, 0x52, 0x8B, 0x8D, 0xB7, 0xDD,
+    0xCF, 0x94, 0x64, 0xB8, 0xDA, 0x38, 0x30, 0x78, 0xDD, 0xFD, 0xEF, 0xEC, 0xF2, 0x80, 0xFC, 0x28,
+    0xFF, 0x30, 0xE1, 0xF1, 0xD2, 0x0C, 0xCC, 0x54, 0x98, 0x38, 0xBD, 0xD9, 0x41, 0x2D, 0x82, 0x9A,
+    0xF4, 0x6F, 0x69, 0x87, 0xEF, 0xA8, 0x91, 0xDD, 0xF3, 0x94, 0xDC, 0x22, 0x7C, 0x18, 0xA1, 0xC6,
+    0x72, 0x17, 0x48, 0xD1, 0x67, 0x07, 0x99, 0x4D, 0x63, 0xA9, 0xEB, 0x49, 0xCA, 0x2C, 0x82, 0x7B,
+    0x79, 0x3F, 0x39, 0x7B, 0x8A, 0xD5, 0xCA, 0x4C, 0x2C, 0x73, 0xE0, 0x98, 0xFA, 0xD4, 0x31, 0x73,
+    0x9C, 0xC1, 0x31, 0xD3, 0x81, 0x79, 0x76, 0xEF, 0xC8, 0x67, 0x87, 0x9F, 0xDD, 0xC5, 0x81, 0x15,
+    0xB4, 0xA0, 0x99, 0x1D, 0x78, 0x55, 0x8E, 0xBC, 0x76, 0xE1, 0x24, 0xFB, 0xF1, 0xD4, 0x30, 0x70,
+    0x66, 0x1D, 0x88, 0xB8, 0xCD, 0xD2, 0xE0, 0x1F, 0x8D, 0xC5, 0x87, 0x24, 0x01, 0xD7, 0xE3, 0x46,
+    0xEA, 0x37, 0x5D, 0xF9, 0xE7, 0xEC, 0xDE, 0x65, 0xB9, 0x79, 0x2A, 0x21, 0x48, 0xFD, 0x4B, 0xF6,
+    0xAF, 0x31, 0xE7, 0x82, 0x5B, 0x5F, 0x49, 0x73, 0x9B, 0x83, 0x8F, 0xC5, 0x12, 0xBE, 0x4A, 0x38,
+    0xE1, 0xEA, 0xDD, 0xD6, 0x8C, 0x65, 0x0E, 0x5A, 0x2C, 0x32, 0x80, 0xF2, 0x80, 0x12, 0xDA, 0x0D,
+    0xB3, 0x6C, 0x2F, 0xB4, 0xBB, 0xC3, 0xB8, 0x6D, 0x67, 0x9F, 0x8A, 0xCD, 0x3D, 0x77, 0x56, 0x0E,
+    0x24, 0x52, 0x2E, 0xBC, 0x26, 0x54, 0x84, 0x4D, 0x64, 0x07, 0xE9, 0x14, 0xCF, 0x6C, 0x24, 0x43,
+    0x3E, 0x0C, 0x39, 0x30, 0xB4, 0x84, 0xC2, 0xB9, 0xF8, 0x22, 0x67, 0x10, 0x27, 0x35, 0xB6, 0xC1,
+    0x2D, 0x4D, 0xBA, 0xF8, 0xD4, 0xC6, 0x38, 0x3B, 0x88, 0xF9, 0x04, 0x38, 0x20, 0xD7, 0x7C, 0x80,
+    0x7C, 0xF4, 0xFD, 0x75, 0xE6, 0x44, 0x3B, 0x3F, 0x0F, 0x7A, 0xD8, 0x53, 0x01, 0xCE, 0x9B, 0x8F,
+    0x3E, 0x48, 0x0A, 0x69, 0xFD, 0x2A, 0x0D, 0xD2, 0xA2, 0xD9, 0x13, 0x7B, 0x01, 0xE5, 0xC0, 0xB7,
+    0xD1, 0x2D, 0x03, 0x86, 0x72, 0x82, 0xCF, 0x64, 0x7F, 0x6D, 0x5F, 0xB5, 0x5A, 0xFB, 0x06, 0x9D,
+    0x94, 0x63, 0x27, 0x71, 0xB1, 0x42, 0x16, 0xEC, 0xE5, 0x08, 0x0C, 0x89, 0xE2, 0x97, 0x76, 0x46,
+    0xE7, 0x51, 0xD6, 0xCC, 0x7A, 0xD8, 0x96, 0xDD, 0xE6, 0x48, 0x79, 0x1A, 0x27, 0xE4, 0x00, 0xDC,
+    0xD8, 0x0B, 0xD5, 0x46, 0x7B, 0x8E, 0xAC, 0xAB, 0x48, 0x2B, 0xF6, 0xA5, 0xF6, 0x12, 0x01, 0x07,
+    0x8B, 0x68, 0xA8, 0xEF, 0xAF, 0xBF, 0x44, 0xE9, 0xF6, 0x2C, 0x64, 0x96, 0x40, 0x04, 0x86, 0xA7,
+    0x33, 0xF5, 0x6C, 0x56, 0x91, 0x69, 0xF4, 0xB1, 0xBE, 0xFF, 0xF4, 0x76, 0x32, 0x70, 0x76, 0x06,
+    0xFE, 0xAE, 0xEF, 0xB7, 0xD3, 0xAB, 0xC4, 0xA7, 0x68, 0xC4, 0x53, 0x50, 0x27, 0xB4, 0x0E, 0x43,
+    0x6F, 0xE3, 0x3C, 0x0B, 0x7C, 0x44, 0xF8, 0x32, 0x51, 0x74, 0x3E, 0xC2, 0x5D, 0x65, 0x74, 0x0E,
+    0x3A, 0xBC, 0x13, 0xBC, 0x60, 0x68, 0x98, 0x6D, 0xB4, 0xD2, 0x21, 0xBE, 0x55, 0x80, 0x64, 0x3F,
+    0xAB, 0x73, 0xBA, 0x34, 0xF0, 0x7F, 0xFA, 0xFC, 0x0B, 0xB5, 0x55, 0x31, 0xAE, 0xE4, 0x44, 0x14,
+    0x2C, 0xDB, 0x0B, 0x96, 0x70, 0xD0, 0xE4, 0x2B, 0xE1, 0x1C, 0x04, 0x73, 0x01, 0xF6, 0xB7, 0x8F,
+    0x40, 0x00, 0x04, 0x5C, 0x81, 0x80, 0x0B, 0xEC, 0x7C, 0xFB, 0x08, 0x04, 0xEC, 0x15, 0x90, 0xD8,
+    0x84, 0x0B, 0xCC, 0x7E, 0x5B, 0x9C, 0xC0, 0x47, 0xB0, 0xB4, 0x1B, 0x20, 0x08, 0xE8, 0xC0, 0x81,
+    0xFF, 0x5F, 0xCF, 0x34, 0x55, 0xAF, 0x67, 0xBE, 0x47, 0xA0, 0x45, 0x9B, 0xE0, 0xD1, 0x74, 0x7B,
+    0x7A, 0xDC, 0xFD, 0xEA, 0x55, 0xD5, 0x7B, 0x06, 0x62, 0x7C, 0x03, 0x14, 0x31, 0xAE, 0x40, 0xFD,
+    0x87, 0xC6, 0x23, 0xCA, 0x19, 0x45, 0x40, 0x35, 0xA1, 0x1E, 0x50, 0x77, 0x38, 0x01, 0x77, 0x28,
+    0x6C, 0x8D, 0x0B, 0x7E, 0x40, 0x8F, 0xA7, 0x47, 0x6D, 0x89, 0x7C, 0x22, 0x46, 0xFE, 0xDD, 0xC7,
+    0xD8, 0x71, 0xE1, 0x65, 0xC3, 0x33, 0x26, 0xF0, 0xEA, 0x79, 0x87, 0xE2, 0xA8, 0xDB, 0x3A, 0xD8,
+    0xC2, 0xA0, 0x85, 0x93, 0x6E, 0xDD, 0xBC, 0x2D, 0x44, 0x5B, 0x58, 0x6D, 0xC1, 0x36, 0x6E, 0xD7,
+    0xD3, 0xF8, 0x23, 0x90, 0xC5, 0xB8, 0x00, 0xA5, 0xA1, 0xAB, 0xE2, 0x8B, 0xEF, 0xF8, 0xF0, 0x69,
+    0xDB, 0x92, 0xC6, 0x6A, 0xD1, 0x58, 0xDA, 0x7D, 0x61, 0x63, 0x66, 0xCF, 0xC0, 0x0E, 0x47, 0xDB,
+    0x69, 0xDC, 0x8D, 0x5B, 0xE8, 0x04, 0x23, 0x8B, 0x83, 0xFD, 0xCD, 0x1D, 0x1F, 0x33, 0x8D, 0xFB,
+    0x6F, 0x57, 0xC5, 0x51, 0x36, 0x1C, 0x63, 0x83, 0x1D, 0xC7, 0xC1, 0xB2, 0x64, 0x02, 0xAD, 0xE1,
+    0xC8, 0x63, 0xFC, 0xFD, 0x02, 0xCF, 0xE9, 0xA9, 0xD0, 0x6A, 0xFC, 0x4D, 0xC3, 0xE9, 0xA3, 0x17,
+    0x55, 0xC8, 0xBE, 0x02, 0xBC, 0xC5, 0xB3, 0xD4, 0x4B, 0x4B, 0x7D, 0x67, 0x71, 0x2C, 0x66, 0x39,
+    0x6F, 0x0B, 0x86, 0xAE, 0x5C, 0x36, 0x70, 0x71, 0x4B, 0x20, 0x91, 0x18, 0xBB, 0x77, 0x93, 0x58,
+    0xFF, 0x93, 0x44, 0xB8, 0x0E, 0xD5, 0x00, 0x6E, 0x5F, 0x50, 0x8D, 0xD8, 0x01, 0xB7, 0x28, 0x27,
+    0x69, 0xC6, 0x25, 0xDF, 0x50, 0xC6, 0x7C, 0xE1, 0x0F, 0x2A, 0x78, 0x27, 0x78, 0x8E, 0x3B, 0xDD,
+    0x6B, 0x45, 0xEF, 0x5B, 0xE1, 0x88, 0x8A, 0xE8, 0x57, 0x3B, 0x4E, 0x61, 0xBD, 0x02, 0xE6, 0x16,
+    0xCA, 0x0F, 0x17, 0x92, 0xF3, 0x68, 0xBC, 0x11, 0xED, 0x67, 0xA2, 0xA3, 0x88, 0xC2, 0xE6, 0xF5,
+    0x50, 0x79, 0x7F, 0xA5, 0xDC, 0x87, 0xC9, 0x13, 0x7F, 0x3E, 0xFC, 0x3A, 0x2A, 0x66, 0x1E, 0xAA,
+    0x81, 0x4C, 0x04, 0x27, 0x47, 0xCD, 0x9F, 0xC0, 0x8D, 0x59, 0xF8, 0x9C, 0x38, 0x8A, 0x70, 0x43,
+    0x2A, 0xAA, 0xC9, 0x77, 0xBE, 0x6B, 0x07, 0xD1, 0x1D, 0xBB, 0xDA, 0x14, 0x90, 0x0E, 0xCC, 0xEF,
+    0xFB, 0xF8, 0xD0, 0x5C, 0xA8, 0xCC, 0xAF, 0xE4, 0x2D, 0x96, 0x8D, 0xCB, 0xCA, 0x88, 0x71, 0x61,
+    0x63, 0x0D, 0xAF, 0xA0, 0xDC, 0x65, 0x55, 0x30, 0x35, 0xFA, 0x56, 0x13, 0x3D, 0x8B, 0x56, 0xF6,
+    0x1C, 0x6D, 0xE2, 0x11, 0x9A, 0xB8, 0x6A, 0xF6, 0xA8, 0x27, 0x9B, 0x8A, 0x35, 0x99, 0xA5, 0x37,
+    0x5E, 0x69, 0x0A, 0x9B, 0x8A, 0x34, 0x25, 0xB2, 0x79, 0xCA, 0x9C, 0xA6, 0xE4, 0xB1, 0xF6, 0xEC,
+    0xA2, 0xBF, 0x0C, 0x53, 0xFB, 0xDA, 0xB4, 0x68, 0xA7, 0x56, 0x8A, 0xB6, 0xC1, 0x0C, 0xDA, 0x86,
+    0x82, 0x76, 0x12, 0xA3, 0x6D, 0xB0, 0x49, 0xAB, 0x7E, 0x26, 0x9B, 0x9D, 0x26, 0x5B, 0xD5, 0xF5,
+    0x44, 0x12, 0x7E, 0x01, 0xD7, 0xE0, 0x19, 0x6A, 0xE0, 0x4B, 0x69, 0x78, 0xC0, 0x8D, 0x04, 0xDD,
+    0x03, 0x33, 0xEF, 0x33, 0x89, 0x49, 0x11, 0x17, 0x14, 0x53, 0x36, 0xA3, 0x1C, 0x73, 0x56, 0x29,
+    0x79, 0x84, 0x1B, 0x28, 0x75, 0xDD, 0x49, 0xF7, 0x86, 0xCA, 0x7A, 0xD8, 0x40, 0xCD, 0x6F, 0xB1,
+    0xEB, 0xBE, 0x39, 0x35, 0x5E, 0x5E, 0xB6, 0xA1, 0x37, 0x6F, 0x33, 0x3E, 0x12, 0x4B, 0x90, 0x3D,
+    0x90, 0x2D, 0x57, 0xF2, 0x3D, 0x63, 0xD8, 0x72, 0x20, 0x98, 0x03, 0xA3, 0x12, 0x52, 0x0D, 0x95,
+    0x3E, 0x11, 0x79, 0x86, 0x2B, 0x27, 0x02, 0x3A, 0x96, 0x23, 0xE9, 0x7D, 0x4E, 0xBE, 0x78, 0x13,
+    0xBB, 0x1E, 0xFD, 0x2C, 0xC9, 0xE0, 0xE3, 0xDB, 0x80, 0xB8, 0xD2, 0x60, 0x5F, 0x3B, 0x12, 0x90,
+    0xAD, 0x67, 0xB3, 0x9B, 0x60, 0xBE, 0xB9, 0x14, 0x84, 0x91, 0xCA, 0x5A, 0x61, 0x12, 0x2B, 0x56,
+    0x26, 0x72, 0x47, 0x85, 0x0E, 0x84, 0xB4, 0x6B, 0x84, 0x9C, 0x9F, 0xAE, 0x9C, 0x8A, 0xC0, 0xF4,
+    0x66, 0x2C, 0xB9, 0x72, 0xDE, 0xF3, 0xDB, 0x92, 0x0F, 0x1A, 0xA6, 0x73, 0x43, 0xCD, 0x1C, 0x8B,
+    0x49, 0x89, 0x67, 0x81, 0xDF, 0x85, 0x7B, 0x17, 0xAA, 0x7E, 0x43, 0xE4, 0xDC, 0xDF, 0xD4, 0xA2,
+    0x63, 0xA8, 0x78, 0x46, 0x1E, 0x0A, 0x3B, 0x83, 0xBC, 0xC9, 0x5D, 0x2B, 0xBC, 0xD9, 0xAB, 0x8E,
+    0x67, 0x12, 0xFE, 0x8D, 0xE4, 0xD5, 0xFB, 0x20, 0xB9, 0x4D, 0x48, 0x9A, 0x2B, 0x24, 0x94, 0x83,
+    0xE7, 0xCC, 0x86, 0x44, 0x9A, 0xED, 0x0D, 0xC9, 0x8E, 0x24, 0x96, 0x3A, 0x63, 0x30, 0x24, 0x0F,
+    0xBF, 0x9C, 0x5E, 0xDE, 0x1B, 0x92, 0x38, 0x79, 0x6B, 0x1F, 0x86, 0x64, 0x79, 0x74, 0xED, 0x59,
+    0x16, 0xA3, 0x2A, 0x19, 0x18, 0xF8, 0x40, 0x9D, 0x88, 0x6A, 0xB0, 0x0B, 0x15, 0xEA, 0x82, 0x32,
+    0x84, 0x3C, 0x02, 0x4A, 0x84, 0x5C, 0x7C, 0x2E, 0x49, 0x33, 0x3E, 0xF6, 0x46, 0x5D, 0x49, 0x60,
+    0x94, 0x8A, 0x23, 0x90, 0x62, 0xF4, 0x49, 0xC3, 0xE7, 0xB4, 0x46, 0x4B, 0xA3, 0xF4, 0x8D, 0x4C,
+    0xC0, 0xAE, 0xA5, 0x7A, 0x1B, 0x5C, 0x3C, 0x35, 0x57, 0xC2, 0x3F, 0x49, 0x13, 0xAB, 0x5E, 0x67,
+    0xAB, 0xEE, 0x0F, 0xA9, 0xE6, 0x5C, 0x97, 0xFA, 0xA8, 0x9C, 0x5F, 0xCD, 0x32, 0xA7, 0xBA, 0x95,
+    0x05, 0x77, 0x93, 0x01, 0xCA, 0xF8, 0xD2, 0x18, 0x93, 0xDA, 0x3D, 0xFB, 0xB6, 0xF6, 0xA8, 0x7B,
+    0xB2, 0xC6, 0x58, 0x68, 0x2A, 0xD2, 0xBA, 0x41, 0x48, 0x7B, 0x5C, 0xC3, 0x6A, 0x15, 0x2C, 0xC5,
+    0xA1, 0x6B, 0xE1, 0x47, 0x26, 0x5F, 0x06, 0x36, 0x70, 0x37, 0xE4, 0x47, 0x95, 0x99, 0x30, 0xBA,
+    0x45, 0x3A, 0x85, 0x2C, 0x36, 0xB9, 0x29, 0xC7, 0x3D, 0xF1, 0xFE, 0xD2, 0xEB, 0x1E, 0xAF, 0x4C,
+    0x18, 0x0E, 0xEF, 0x62, 0x65, 0xFF, 0x5F, 0xAC, 0xD4, 0xEF, 0xC9, 0x0A, 0xCF, 0xB3, 0x57, 0xD3,
+    0x0F, 0x6A, 0x6A, 0xF9, 0x31, 0x63, 0xD5, 0xAA, 0xCE, 0x06, 0x1A, 0x40, 0xD9, 0xEF, 0xAD, 0x07,
+    0xFD, 0x74, 0xF1, 0x76, 0xF1, 0x38, 0xFA, 0xCB, 0x8B, 0x63, 0xB2, 0xF7, 0x63, 0x7A, 0xFF, 0x98,
+    0xA4, 0x3B, 0x6B, 0x32, 0x6D, 0xF3, 0xE9, 0xA4, 0x8E, 0xEA, 0xE3, 0xCF, 0xFD, 0xD1, 0x9C, 0x99,
+    0xFC, 0x19, 0xCE, 0x6F, 0x1E, 0x67, 0x5D, 0x34, 0x13, 0x9D, 0xFF, 0xE3, 0xF5, 0x37, 0x8D, 0x55,
+    0x3D, 0x8F, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0xA0, 0x58, 0x68, 0x84, 0x86, 0x82, 0x02, 0x51, 0x30,
+    0x3D, 0x45, 0xFC, 0x0B, 0xF2, 0x6C, 0x41, 0x91, 0x32, 0x5B, 0x50, 0xA5, 0x49, 0x8B, 0xA0, 0xD8,
+    0x86, 0x82, 0x22, 0xFB, 0x6C, 0x29, 0x05, 0x25, 0x69, 0xD2, 0xA7, 0x48, 0x95, 0x26, 0x94, 0x5B,
+    0xEC, 0xAE, 0x47, 0xA4, 0xA4, 0xC0, 0x5D, 0x5A, 0x4B, 0x49, 0x84, 0x04, 0xC5, 0x0E, 0x30, 0x28,
+    0x0E, 0xD8, 0xBE, 0x9C, 0x3B, 0xFB, 0x22, 0x42, 0x87, 0xA5, 0xF7, 0x6C, 0xCF, 0xC7, 0x9D, 0x7B,
+    0xCE, 0xBD, 0xE7, 0x18, 0xB8, 0xBA, 0xDC, 0x88, 0xE3, 0xD7, 0xBC, 0x85, 0x4A, 0xA4, 0x87, 0xEF,
+    0xEB, 0xC9, 0x8F, 0xA8, 0xDB, 0x0E, 0x26, 0xA2, 0x29, 0x16, 0x94, 0xBC, 0xF1, 0xB1, 0x88, 0xD8,
+    0x57, 0xA3, 0xDE, 0x56, 0x17, 0x74, 0x70, 0xF1, 0x2D, 0x6F, 0xC5, 0xDC, 0x00, 0x66, 0x2A, 0xE7,
+    0x3D, 0x50, 0x4D, 0x46, 0x56, 0xC0, 0x86, 0x7C, 0x63, 0xC0, 0x89, 0xB7, 0xA6, 0xB7, 0x61, 0x03,
+    0x06, 0xBE, 0x4B, 0x5B, 0x6E, 0x70, 0xBD, 0xBC, 0x7C, 0xB2, 0xC0, 0x43, 0x44, 0x12, 0x6A, 0x74,
+    0x22, 0x23, 0x76, 0xF0, 0x22, 0xC0, 0x0D, 0x94, 0xF2, 0x02, 0x6F, 0x5D, 0xD7, 0x1E, 0x3F, 0x62,
+    0x58, 0x5D, 0xA1, 0xCB, 0x19, 0x73, 0xC2, 0x5D, 0xE0, 0x1C, 0xE5, 0xC4, 0x33, 0xE1, 0x5A, 0xE6,
+    0x89, 0x13, 0x60, 0xD5, 0x7C, 0xCC, 0xC2, 0x23, 0xE0, 0x56, 0x06, 0x43, 0xA3, 0xB1, 0xF5, 0x9F,
+    0x1B, 0x3B, 0xDD, 0x68, 0x45, 0x16, 0x26, 0xF1, 0x60, 0x98, 0x60, 0x23, 0x86, 0x16, 0x84, 0xB7,
+    0xEA, 0x16, 0x1F, 0xE1, 0x27, 0x0C, 0x01, 0xD2, 0x9A, 0x0D, 0x15, 0x63, 0x24, 0x34, 0x11, 0xDD,
+    0x58, 0x08, 0x61, 0xC0, 0x31, 0xE1, 0x05, 0x5D, 0x42, 0x37, 0x1D, 0x52, 0x22, 0x04, 0x66, 0xB9,
+    0x46, 0x26, 0xB4, 0xA1, 0x19, 0xEB, 0xA9, 0x22, 0x23, 0x98, 0x79, 0x76, 0x0D, 0x2C, 0x66, 0xE4,
+    0xC3, 0x5D, 0x14, 0xB3, 0xEB, 0x89, 0x3C, 0xC1, 0x26, 0xD7, 0x33, 0x8C, 0xDC, 0x96, 0xE8, 0x14,
+    0xC1, 0x20, 0x42, 0x92, 0xB6, 0x3D, 0xEC, 0x76, 0x73, 0x3C, 0x44, 0x2C, 0x1E, 0x9F, 0x6A, 0x96,
+    0x44, 0xA0, 0xF9, 0xF2, 0x7C, 0x66, 0xDE, 0x42, 0x61, 0x72, 0x6E, 0xE6, 0x9F, 0x89, 0x5F, 0xDE,
+    0x87, 0xF9, 0x95, 0xE7, 0x91, 0x0A, 0x69, 0xAD, 0xB4, 0x43, 0x60, 0x56, 0x4D, 0x70, 0x11, 0xF5,
+    0xA8, 0xD5, 0x0A, 0x3E, 0xF0, 0xAF, 0xD6, 0x33, 0x6B, 0x42, 0x21, 0xA4, 0x8A, 0x89, 0x8B, 0xCC,
+    0x0A, 0x3C, 0x32, 0x5F, 0x61, 0xC0, 0x4E, 0xA9, 0xAD, 0xB7, 0xFB, 0x3A, 0x01, 0x13, 0x58, 0xB4,
+    0x88, 0x6F, 0x98, 0xF9, 0xC7, 0xE4, 0xDD, 0xB5, 0xBE, 0xF5, 0x3D, 0x17, 0xB7, 0x4C, 0x62, 0x42,
+    0xC2, 0x9E, 0x44, 0x57, 0x61, 0xC7, 0x7A, 0x93, 0xE5, 0xA5, 0x0A, 0xB8, 0x28, 0xFF, 0xBC, 0x2D,
+    0x2D, 0xCF, 0x0F, 0xA4, 0xB5, 0xF7, 0xB2, 0xB5, 0x57, 0xD9, 0x57, 0xCA, 0x2C, 0x61, 0x05, 0x92,
+    0x4F, 0x02, 0xF8, 0x63, 0x2E, 0x28, 0xE7, 0x03, 0x0A, 0xB2, 0xA3, 0xC5, 0x67, 0xE9, 0xF4, 0x61,
+    0xD3, 0x69, 0xE2, 0x2E, 0x57, 0x9D, 0xE6, 0x3A, 0xA3, 0x1B, 0x86, 0xFE, 0xDF, 0x8A, 0x2B, 0x05,
+    0x95, 0x56, 0x6C, 0xC7, 0xD6, 0x43, 0xB2, 0xAC, 0x57, 0x60, 0x9C, 0x1D, 0x23, 0x17, 0x91, 0xC1,
+    0x9C, 0xA2, 0xDC, 0x91, 0x71, 0x13, 0xB5, 0x3F, 0x5B, 0x17, 0x78, 0xD4, 0x9E, 0xE0, 0xCB, 0xA4,
+    0x04, 0x6F, 0x4C, 0x4E, 0x22, 0x7F, 0x72, 0x8F, 0xE7, 0x9D, 0x31, 0x27, 0x33, 0x7D, 0x02, 0x7C,
+    0xC4, 0xC8, 0xC7, 0x93, 0xB2, 0x4C, 0x9E, 0x46, 0xC7, 0x4E, 0xC5, 0xD7, 0x45, 0x22, 0x09, 0x3B,
+    0xDC, 0x5E, 0xAC, 0x82, 0xE2, 0x6F, 0xF6, 0x0F, 0xB4, 0xA3, 0x35, 0x33, 0x25, 0x5D, 0x11, 0xD4,
+    0x09, 0x1F, 0x16, 0x9C, 0xEA, 0x9D, 0x36, 0x54, 0xA3, 0x79, 0x1D, 0x67, 0xE0, 0x1D, 0x3A, 0xCD,
+    0x06, 0x6B, 0x29, 0x7D, 0xD7, 0x72, 0xB1, 0x5D, 0xAA, 0xA4, 0x68, 0x9B, 0xC8, 0x57, 0x6A, 0x4A,
+    0x3E, 0xD3, 0x3A, 0xD6, 0x4F, 0x97, 0x5C, 0xCA, 0xEE, 0xCE, 0x73, 0x7D, 0xC5, 0x36, 0xE8, 0xAC,
+    0xD6, 0x23, 0xBF, 0x9A, 0x5C, 0x17, 0x2E, 0x97, 0x39, 0x83, 0x1F, 0x24, 0x77, 0x99, 0xCD, 0x7D,
+    0x9B, 0x5B, 0x5E, 0x39, 0xF5, 0x9A, 0x80, 0x6E, 0x7A, 0xF2, 0x4A, 0x97, 0x37, 0xB3, 0xFC, 0x28,
+    0xBA, 0xF7, 0x5B, 0x61, 0x77, 0xA2, 0x9B, 0x9B, 0xB9, 0x59, 0xB9, 0xA7, 0x97, 0xA9, 0x53, 0x36,
+    0x5B, 0x6E, 0x68, 0xDF, 0xC5, 0xF7, 0xC0, 0x7B, 0x5C, 0x45, 0x44, 0x54, 0xEB, 0x08, 0x46, 0xF8,
+    0x8A, 0xF9, 0x7A, 0x0E, 0x05, 0x15, 0xB1, 0xD2, 0xB5, 0x54, 0xB2, 0x14, 0x03, 0xBB, 0xE2, 0x03,
+    0xCD, 0x89, 0xDC, 0x46, 0x76, 0xED, 0xD0, 0xDF, 0x80, 0x5D, 0xB9, 0xE2, 0x3C, 0xDA, 0x50, 0x3D,
+    0x23, 0x43, 0x27, 0xD7, 0x91, 0xAA, 0x29, 0xB1, 0x1B, 0xAA, 0x50, 0x9B, 0x58, 0x83, 0x92, 0x9F,
+    0xCD, 0xF3, 0x58, 0x4D, 0xFE, 0x98, 0x02, 0xBC, 0x48, 0x6C, 0x7B, 0x69, 0xAB, 0xE8, 0x29, 0xE7,
+    0x9E, 0xB5, 0xD4, 0xDA, 0xBE, 0x5F, 0xF4, 0x28, 0x36, 0xA6, 0x57, 0x64, 0x08, 0xE9, 0x50, 0xDD,
+    0x23, 0x45, 0x17, 0x58, 0xF9, 0x9D, 0xEA, 0x88, 0xEB, 0x19, 0xB5, 0x7C, 0x45, 0xE5, 0xF8, 0x3B,
+    0x98, 0x8B, 0x74, 0x6A, 0x46, 0x7F, 0x6F, 0xF4, 0x98, 0xBD, 0x96, 0xEE, 0xCC, 0x4C, 0x8B, 0x99,
+    0xDC, 0x77, 0xC1, 0xF7, 0x27, 0x67, 0x38, 0x2F, 0xFF, 0x1E, 0x4D, 0xA4, 0xBC, 0x7D, 0xE8, 0x46,
+    0x76, 0xE3, 0x06, 0x93, 0x54, 0x1A, 0xB4, 0xAF, 0x13, 0x3E, 0xD9, 0xC0, 0x63, 0x67, 0x92, 0x5D,
+    0xDF, 0x1A, 0x61, 0xFE, 0xE0, 0xD4, 0x5E, 0xAD, 0x48, 0x09, 0x53, 0x32, 0xFD, 0xA2, 0x8C, 0x45,
+    0xED, 0x80, 0x1E, 0xF6, 0x19, 0xA7, 0x96, 0x26, 0xD1, 0xEC, 0x28, 0xF2, 0x64, 0x85, 0xE5, 0x6C,
+    0x66, 0x6D, 0xE5, 0x25, 0x97, 0xC2, 0xB5, 0x9C, 0x42, 0xC4, 0x75, 0xB2, 0x70, 0x83, 0x56, 0x73,
+    0x97, 0xAA, 0x3E, 0xA5, 0x04, 0x92, 0x0D, 0x94, 0x43, 0x5F, 0x4E, 0xAE, 0x35, 0x63, 0x9D, 0xE5,
+    0xD1, 0x90, 0xAD, 0x0B, 0xF5, 0xA4, 0xEC, 0x56, 0x0F, 0x51, 0x3C, 0xD2, 0xB6, 0xF6, 0x53, 0xC1,
+    0x83, 0xA9, 0xD4, 0x0D, 0x76, 0xD1, 0xD0, 0x1D, 0xED, 0x22, 0x1A, 0x09, 0xF6, 0x32, 0xD4, 0x17,
+    0xD8, 0x0D, 0xC5, 0x96, 0xF0, 0x7A, 0x71, 0x3F, 0x05, 0xFB, 0x2C, 0x5D, 0xF0, 0x70, 0xF7, 0xF3,
+    0xEF, 0x0B, 0x33, 0x92, 0x5B, 0x53, 0x35, 0xC9, 0xDC, 0xB5, 0xCD, 0xA7, 0xF2, 0xC3, 0x8A, 0xD5,
+    0xAE, 0x8E, 0x5D, 0xE6, 0x63, 0x17, 0x9A, 0xD0, 0x11, 0xF1, 0x86, 0xCF, 0x5D, 0xD2, 0x3E, 0xEB,
+    0x54, 0x43, 0xF9, 0x34, 0x4F, 0x38, 0xA3, 0x5A, 0x45, 0xA3, 0x7E, 0x4D, 0xCD, 0x50, 0x7D, 0x14,
+    0xCD, 0x85, 0xAA, 0x8F, 0xB4, 0x1C, 0x06, 0x62, 0x1E, 0xE8, 0x75, 0x60, 0xCD, 0xFD, 0x14, 0x55,
+    0xB2, 0xEA, 0x70, 0xEA, 0x62, 0x3E, 0x5B, 0x31, 0x4D, 0xB1, 0x09, 0xD4, 0x63, 0xA1, 0xF6, 0x01,
+    0x3B, 0xE7, 0x81, 0xF1, 0x6A, 0xE0, 0x70, 0x1D, 0xBF, 0xE0, 0x8B, 0x84, 0x62, 0x2B, 0x66, 0x0D,
+    0x4C, 0x4D, 0x9A, 0x91, 0x47, 0x27, 0xEA, 0xE5, 0x84, 0x5F, 0x83, 0x9A, 0xA5, 0x75, 0x4F, 0x23,
+    0x13, 0x62, 0x3F, 0xC6, 0xE6, 0x97, 0x61, 0xB6, 0x6A, 0x41, 0x6A, 0x10, 0x5E, 0x3B, 0x7C, 0x78,
+    0xDB, 0xDB, 0x4B, 0xCD, 0x42, 0x25, 0xDB, 0x73, 0xF7, 0x39, 0x7D, 0xCE, 0x44, 0xAB, 0xE6, 0xC9,
+    0xB7, 0x3D, 0x03, 0x97, 0xE9, 0x8D, 0xD8, 0x3B, 0xB5, 0xF7, 0x99, 0xE0, 0xDC, 0x48, 0x28, 0x0D,
+    0x91, 0x14, 0x0B, 0x81, 0xB8, 0x89, 0xE2, 0x6E, 0xDA, 0x41, 0x21, 0xB2, 0xDF, 0xAE, 0x31, 0x76,
+    0xF9, 0x9B, 0x9A, 0xBC, 0xBD, 0xFC, 0x6B, 0x51, 0x95, 0x68, 0xD3, 0x49, 0xCF, 0xCF, 0x44, 0x45,
+    0x17, 0xEC, 0xE9, 0x10, 0xFA, 0x61, 0xD8, 0xB4, 0x17, 0x29, 0x6D, 0x56, 0x93, 0x3E, 0xC4, 0xB3,
+    0x06, 0x1A, 0x07, 0x3B, 0x63, 0xE4, 0x74, 0x9D, 0xBF, 0x11, 0xA2, 0xFE, 0x67, 0x5F, 0x91, 0x16,
+    0x34, 0x37, 0xD9, 0x3A, 0x0C, 0x7F, 0x94, 0x3F, 0x3C, 0x59, 0xF5, 0x6F, 0x8C, 0x21, 0x9B, 0x1C,
+    0x17, 0x67, 0x07, 0x4C, 0xF8, 0xEF, 0x75, 0x4D, 0x7A, 0xD2, 0x84, 0xFA, 0xF5, 0x17, 0xC5, 0x96,
+    0xBF, 0xAF, 0xCA, 0xBE, 0x51, 0xF5, 0xF5, 0xD9, 0xD5, 0xB5, 0x71, 0x75, 0x54, 0x0D, 0x50, 0x5E,
+    0x3E, 0xE4, 0xDA, 0xB1, 0x54, 0xA9, 0x0F, 0x6B, 0xDE, 0xDE, 0xA9, 0x7D, 0xC9, 0xE5, 0x76, 0x64,
+    0xC3, 0x3B, 0xFC, 0x5C, 0x72, 0x1B, 0x9B, 0xB8, 0x3E, 0xD8, 0x92, 0xFE, 0x18, 0x2D, 0x8B, 0x8C,
+    0xD9, 0x2A, 0x78, 0x4D, 0xC8, 0xA4, 0x2B, 0xAB, 0xB5, 0x11, 0xFF, 0xF7, 0xFA, 0x07, 0x95, 0x55,
+    0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x7D, 0xCB, 0x85, 0x45, 0xC0, 0x2C, 0x36, 0x45, 0x92, 0xC6, 0x08,
+    0xD8, 0xA6, 0xB1, 0xAE, 0x4D, 0x21, 0x89, 0x8B, 0x34, 0x69, 0x1D, 0xC0, 0x5D, 0xFE, 0x40, 0x00,
+    0x17, 0x6E, 0x5D, 0xDC, 0x89, 0xCC, 0x3F, 0x50, 0x95, 0x36, 0x29, 0xDC, 0xB9, 0x50, 0xCA, 0x2B,
+    0x64, 0x71, 0x7F, 0x02, 0x91, 0x5F, 0x40, 0x20, 0x72, 0xE3, 0x6A, 0x0B, 0x16, 0x94, 0xC3, 0x23,
+    0xF3, 0xDE, 0x9E, 0xBE, 0xAC, 0x22, 0x48, 0x78, 0xD2, 0xDC, 0x92, 0xB7, 0x3B, 0xF3, 0xE6, 0xCD,
+    0x9B, 0x21, 0x5C, 0x03, 0x17, 0x30, 0xC1, 0x0C, 0x28, 0x3A, 0x54, 0xC0, 0xA5, 0xBE, 0xF3, 0xC8,
+    0x47, 0xBC, 0xAB, 0x3C, 0xEC, 0xC8, 0x1B, 0xAC, 0xC2, 0x0E, 0x30, 0xD3, 0x2A, 0x00, 0xEE, 0xAF,
+    0x01, 0xC0, 0xD2, 0xD2, 0x14, 0x4B, 0x47, 0x5B, 0x73, 0x2B, 0xEC, 0xE2, 0x69, 0xAB, 0xA8, 0x25,
+    0xB7, 0xF2, 0x29, 0xB7, 0xC2, 0x69, 0x6B, 0xBE, 0x24, 0xC3, 0xFB, 0x6A, 0x89, 0xDA, 0x39, 0xEA,
+    0x67, 0x6D, 0x2A, 0xAE, 0xB0, 0xBF, 0xD6, 0xC9, 0x4E, 0x69, 0xDF, 0x42, 0x4F, 0x35, 0x6D, 0x6F,
+    0x46, 0x3B, 0x98, 0x68, 0x3B, 0x1B, 0x31, 0x14, 0x9E, 0x28, 0x06, 0x07, 0xD7, 0x63, 0x38, 0x84,
+    0xEB, 0x4C, 0x7C, 0x8E, 0x32, 0xD8, 0x58, 0x11, 0x59, 0xD9, 0x55, 0x1F, 0xEA, 0x5F, 0x97, 0xB0,
+    0x5A, 0x74, 0xB6, 0xA4, 0xD9, 0x25, 0x37, 0x8C, 0xDD, 0x2E, 0x4B, 0x23, 0xDC, 0xF2, 0x9E, 0x25,
+    0x6B, 0xC7, 0x7B, 0x5B, 0x08, 0x1D, 0x5C, 0xC4, 0xDD, 0x55, 0x7A, 0x9C, 0x80, 0xF1, 0x4E, 0x80,
+    0x0B, 0x91, 0xE1, 0x1A, 0x1A, 0x45, 0x01, 0x36, 0x32, 0x4E, 0xA9, 0x64, 0x32, 0x68, 0x95, 0x6F,
+    0xDB, 0xCB, 0x28, 0x95, 0x56, 0xD4, 0x2C, 0x96, 0x1E, 0x17, 0x7E, 0xF8, 0x57, 0xF6, 0x34, 0x76,
+    0xDA, 0xFB, 0x35, 0x23, 0x8A, 0x90, 0xF8, 0xA5, 0x97, 0x91, 0x89, 0xE6, 0x5D, 0xDE, 0x61, 0xC5,
+    0x0F, 0xD7, 0x13, 0x6C, 0x6F, 0x7B, 0xC6, 0x66, 0xF4, 0x0B, 0x7E, 0x6C, 0x24, 0x02, 0xD7, 0xB0,
+    0x32, 0xC7, 0x38, 0x82, 0x89, 0x86, 0xB9, 0x4C, 0x85, 0x18, 0xA9, 0x68, 0x6E, 0x89, 0x2A, 0x44,
+    0xBD, 0x30, 0x99, 0xB7, 0xC8, 0x90, 0x99, 0x90, 0x85, 0x3F, 0x10, 0xBF, 0xC3, 0x9B, 0x6F, 0xF0,
+    0xBC, 0x80, 0xB3, 0x21, 0x0F, 0x31, 0xEF, 0x4F, 0x7E, 0x1A, 0x8A, 0x65, 0x42, 0xFB, 0x1B, 0x0F,
+    0x34, 0xB0, 0x3C, 0x13, 0x6F, 0xD9, 0x86, 0x6A, 0xFD, 0x15, 0x36, 0xD8, 0xE1, 0x94, 0x51, 0x27,
+    0xBC, 0xC7, 0x64, 0x84, 0x66, 0xCC, 0x88, 0xD0, 0x0C, 0x24, 0x7F, 0xCC, 0x08, 0x25, 0x1B, 0x2C,
+    0x1D, 0x71, 0xD5, 0x15, 0x9D, 0xED, 0xF3, 0xE0, 0x02, 0x57, 0xB4, 0x79, 0x28, 0x9A, 0xB2, 0xE1,
+    0xCA, 0xAF, 0x3C, 0xD1, 0x42, 0xE0, 0x96, 0x64, 0xE7, 0x54, 0xBF, 0xDD, 0xFF, 0x8D, 0xD2, 0xFF,
+    0xE7, 0x28, 0x43, 0xB2, 0x51, 0x51, 0x92, 0x02, 0x25, 0x61, 0x5E, 0xAB, 0x46, 0xB6, 0xF2, 0xA9,
+    0x3C, 0x29, 0xF4, 0x8E, 0x15, 0xF3, 0x49, 0x7B, 0xD9, 0xBB, 0x78, 0x43, 0xDC, 0xA9, 0x76, 0x7A,
+    0xD5, 0xF2, 0x1A, 0xF6, 0x13, 0x1F, 0x8F, 0x38, 0x24, 0x3E, 0x1B, 0x56, 0xE4, 0x9A, 0x8E, 0x46,
+    0xDB, 0x9B, 0x9D, 0x38, 0xA7, 0x7A, 0x66, 0xC6, 0x1B, 0xEF, 0xE5, 0x01, 0x5F, 0xB0, 0xE0, 0x36,
+    0x28, 0x44, 0x99, 0x9C, 0x6D, 0xAD, 0x14, 0xDD, 0x95, 0x8D, 0x1E, 0x5C, 0xF2, 0xC1, 0x85, 0x5D,
+    0x66, 0x6F, 0x7B, 0xF7, 0xF1, 0x9C, 0x90, 0x4F, 0x91, 0x37, 0x17, 0xEC, 0x2C, 0x67, 0x63, 0x11,
+    0xB0, 0x96, 0x9A, 0x6C, 0xDC, 0xF0, 0x60, 0xFD, 0x7D, 0xA4, 0x42, 0x27, 0x27, 0xCD, 0x86, 0x53,
+    0x2C, 0xCB, 0x95, 0xB9, 0x0B, 0xF3, 0xE5, 0x4D, 0x3F, 0x6C, 0x21, 0xA9, 0x00, 0x94, 0x94, 0x61,
+    0x90, 0x2C, 0xB5, 0xCE, 0xEC, 0xF3, 0x8F, 0xEF, 0xE4, 0x6C, 0xEB, 0x92, 0x43, 0x6C, 0x4B, 0x6F,
+    0xC6, 0x15, 0x9E, 0xC5, 0x6A, 0xAF, 0x0F, 0xDF, 0x2E, 0xC3, 0x03, 0xC0, 0xE7, 0xD7, 0x6A, 0x82,
+    0x11, 0xCE, 0x17, 0x11, 0x3E, 0xE5, 0x9D, 0x9C, 0x26, 0xC2, 0x26, 0x4A, 0x99, 0xFD, 0x51, 0xA5,
+    0x13, 0x49, 0xDE, 0xFD, 0x17, 0x94, 0x6C, 0x76, 0x95, 0xA7, 0x3A, 0x06, 0x4B, 0x97, 0xDC, 0xD2,
+    0x3F, 0xF0, 0xC7, 0x5C, 0x33, 0x32, 0xBA, 0xCE, 0xE6, 0x85, 0x8A, 0x7E, 0x4F, 0x70, 0x0C, 0xCE,
+    0x6A, 0x51, 0x59, 0x6B, 0x13, 0xB7, 0x5C, 0x9E, 0x38, 0xC2, 0xB7, 0x7F, 0xF6, 0xD4, 0xDB, 0xE6,
+    0x98, 0xE8, 0x0B, 0x92, 0x5F, 0x62, 0x66, 0xAC, 0xE8, 0x88, 0x7B, 0x63, 0xE2, 0x25, 0x7B, 0xF6,
+    0xB0, 0x98, 0xCF, 0x07, 0x1B, 0x6A, 0xAA, 0xE4, 0x88, 0x20, 0x7C, 0xDE, 0x1C, 0x2C, 0x0D, 0x3E,
+    0xBB, 0x6A, 0x1E, 0x74, 0x67, 0x27, 0x52, 0x2C, 0x67, 0x13, 0x3D, 0xB3, 0x19, 0xD8, 0x2F, 0x3D,
+    0xF1, 0xB3, 0x5F, 0x3A, 0xB5, 0xB8, 0x26, 0x10, 0x47, 0xD7, 0xFC, 0x03, 0xBB, 0x27, 0xB0, 0x7B,
+    0xA4, 0x2B, 0x0A, 0x27, 0x52, 0x64, 0xA5, 0xCF, 0x7B, 0xEA, 0xAD, 0x56, 0x37, 0xDF, 0xF5, 0x20,
+    0xF7, 0x2B, 0x99, 0x4A, 0x91, 0x16, 0xFC, 0xDB, 0x75, 0x30, 0x6B, 0x14, 0x11, 0xF4, 0x8E, 0xE1,
+    0x59, 0x46, 0xF5, 0xE6, 0x91, 0xED, 0x9F, 0x9C, 0x87, 0x56, 0x75, 0xA3, 0x3A, 0x7E, 0xB9, 0x7E,
+    0x09, 0xE1, 0xD9, 0x07, 0x90, 0x4B, 0x12, 0x63, 0x1A, 0x8E, 0x9F, 0x11, 0x9A, 0x43, 0x24, 0x2F,
+    0xE2, 0x60, 0xB9, 0x9D, 0x70, 0xCE, 0x8B, 0x22, 0x7E, 0x99, 0xDF, 0xF1, 0xF3, 0xC3, 0x40, 0x4C,
+    0x3B, 0xBB, 0x7A, 0xAD, 0xE4, 0xCA, 0xC6, 0x06, 0x96, 0xE1, 0x90, 0x22, 0x92, 0xFC, 0x7A, 0x45,
+    0xF1, 0x1B, 0x0D, 0x1C, 0xD5, 0xC7, 0xA5, 0x7E, 0x57, 0xD9, 0x28, 0xF9, 0x17, 0x56, 0xBF, 0x49,
+    0x42, 0xA2, 0xA1, 0x87, 0x69, 0xDF, 0xDE, 0x8E, 0xD1, 0x04, 0xC7, 0x29, 0xC3, 0xD3, 0x57, 0x11,
+    0x84, 0x13, 0xD0, 0x7E, 0xF0, 0x8F, 0x7F, 0x5B, 0xBF, 0x1E, 0x60, 0xFF, 0xE6, 0x71, 0xA7, 0x39,
+    0x59, 0x5F, 0xB9, 0x8E, 0x53, 0xBB, 0x6C, 0x38, 0x5E, 0x8F, 0xC9, 0x19, 0xDB, 0x52, 0x03, 0xCB,
+    0x09, 0x4E, 0x4D, 0xC1, 0xF0, 0x2E, 0xEF, 0x08, 0xA0, 0xF2, 0x2D, 0x87, 0x29, 0x87, 0x5A, 0x11,
+    0x39, 0x35, 0xAB, 0xA6, 0x6D, 0xBE, 0x16, 0x8D, 0x74, 0x43, 0x18, 0x7A, 0x4B, 0xA8, 0x86, 0xAB,
+    0x7B, 0xFD, 0x7D, 0x8B, 0x34, 0x76, 0x92, 0x7E, 0xE9, 0x78, 0x1F, 0x3B, 0x8B, 0x8F, 0xB8, 0x4E,
+    0x69, 0x90, 0xD6, 0x70, 0x23, 0x4A, 0xB6, 0x12, 0x17, 0xD9, 0x78, 0xD3, 0xCB, 0x7A, 0xFD, 0xA4,
+    0x76, 0x4E, 0x83, 0x7A, 0xD6, 0xCF, 0xA4, 0x22, 0xDB, 0xDD, 0xD0, 0x91, 0x46, 0x6C, 0xBB, 0xD7,
+    0xCE, 0x13, 0x2D, 0x29, 0x88, 0x6B, 0x8A, 0x65, 0xC0, 0x1B, 0xFE, 0xBB, 0xD4, 0x46, 0x47, 0x3A,
+    0xC4, 0x3C, 0x1D, 0x03, 0x59, 0x05, 0x91, 0xA7, 0x1A, 0x4F, 0xCF, 0x48, 0xCF, 0x60, 0x55, 0x31,
+    0xF5, 0xC8, 0x7D, 0xB1, 0x50, 0x7F, 0xF2, 0x2C, 0x41, 0x30, 0xBB, 0x1F, 0xBD, 0xFA, 0x2F, 0x91,
+    0xA7, 0x1E, 0xB7, 0x33, 0x01, 0xD5, 0xB3, 0x6A, 0xAD, 0xB6, 0x54, 0xF2, 0xAB, 0x90, 0x9F, 0x95,
+    0xEA, 0xE6, 0x91, 0x23, 0x7A, 0xB2, 0xCA, 0xE5, 0x99, 0x1C, 0xA9, 0xED, 0x7B, 0xBE, 0x25, 0xC4,
+    0xEB, 0x67, 0x19, 0xBF, 0xA0, 0x7C, 0xA9, 0x03, 0xFA, 0xCC, 0xD2, 0xF7, 0x91, 0x18, 0x49, 0xC3,
+    0x5E, 0xDF, 0xA2, 0x9C, 0xA9, 0x27, 0xB2, 0xF5, 0xDE, 0xD2, 0x6C, 0xA4, 0xB6, 0x03, 0xDF, 0x2A,
+    0xF9, 0x94, 0x4F, 0x55, 0xAC, 0xFA, 0xC7, 0x5A, 0xDD, 0x22, 0x0D, 0xF6, 0xF2, 0x7E, 0xE9, 0x34,
+    0x88, 0xA0, 0x38, 0x0A, 0x90, 0x96, 0x71, 0xDF, 0xF3, 0x1C, 0x51, 0x7A, 0x47, 0x49, 0x4C, 0xB5,
+    0xCE, 0xFE, 0x03, 0x95, 0x55, 0xB1, 0x8E, 0xDD, 0x44, 0x14, 0x3D, 0xF6, 0x68, 0xD7, 0x85, 0x45,
+    0xA6, 0xA1, 0x40, 0x41, 0xE0, 0x86, 0x06, 0xB4, 0x59, 0xB7, 0x29, 0xDE, 0x3E, 0x1B, 0x51, 0x50,
+    0xB2, 0x05, 0x5B, 0xF1, 0x09, 0x14, 0x69, 0xB6, 0xD8, 0x62, 0xF7, 0xD9, 0x52, 0xBE, 0x21, 0x7F,
+    0x10, 0x09, 0x29, 0x29, 0x48, 0xB1, 0xC5, 0x0A, 0xB2, 0x99, 0x01, 0x7E, 0xE0, 0x11, 0x45, 0xA2,
+    0xB5, 0x94, 0x4D, 0xB3, 0x29, 0x18, 0x24, 0x23, 0x3D, 0xC0, 0xEF, 0x5D, 0xCE, 0x1D, 0xFB, 0xA5,
+    0x58, 0x05, 0x10, 0x96, 0x67, 0xC6, 0xE3, 0x19, 0xDF, 0xB9, 0xF7, 0xDC, 0x73, 0xAE, 0x01, 0x24,
+    0x03, 0x00, 0x1B, 0xD8, 0x35, 0x2D, 0x60, 0x36, 0x3A, 0xEB, 0xF1, 0xD6, 0xEB, 0x80, 0x2D, 0xD1,
+    0x35, 0xEB, 0xD9, 0xCD, 0xB7, 0xB3, 0xFC, 0xED, 0x33, 0xFC, 0xCB, 0xEC, 0x8D, 0x95, 0x84, 0xE7,
+    0xED, 0x3A, 0x9E, 0x5E, 0x49, 0x0D, 0x23, 0xDD, 0xF6, 0x28, 0x23, 0xC2, 0xFE, 0xBB, 0x47, 0x7C,
+    0x91, 0xE3, 0x03, 0x3E, 0x76, 0x29, 0x77, 0xBF, 0x83, 0x19, 0x90, 0x7A, 0xF3, 0x02, 0xB8, 0x8B,
+    0x66, 0x03, 0x53, 0xE7, 0x38, 0xC6, 0x13, 0x04, 0xE3, 0x6F, 0xE1, 0x16, 0x17, 0x97, 0xE9, 0xD2,
+    0xB4, 0x7B, 0x7C, 0xE8, 0x4D, 0x6B, 0xAE, 0x25, 0xED, 0xD1, 0x88, 0x9F, 0x23, 0x7F, 0x63, 0xF8,
+    0x18, 0xEF, 0x01, 0x7B, 0xB4, 0x09, 0x0B, 0xD3, 0xF2, 0x4E, 0x96, 0xE0, 0xFD, 0x04, 0xBC, 0x67,
+    0xEA, 0x85, 0x6C, 0xEA, 0xE2, 0xD1, 0xB7, 0x0F, 0x2E, 0x72, 0x9E, 0x93, 0x1B, 0x8F, 0x90, 0xFA,
+    0x0E, 0x27, 0x08, 0xC7, 0xB8, 0x83, 0x8B, 0x3D, 0xD8, 0xC7, 0x03, 0x3F, 0x94, 0x35, 0x3F, 0x94,
+    0xD5, 0xD6, 0xD9, 0x53, 0x75, 0x58, 0x11, 0xB4, 0x44, 0x10, 0x8B, 0xAF, 0x03, 0x0A, 0x11, 0x0F,
+    0xF7, 0xAA, 0xBE, 0xB9, 0x76, 0x7A, 0xAF, 0x87, 0xF9, 0x4B, 0x06, 0x58, 0x11, 0xFA, 0x76, 0x65,
+    0x97, 0x66, 0x8D, 0xA2, 0xB5, 0x1D, 0xB1, 0x6D, 0x88, 0x8A, 0x59, 0x21, 0xF3, 0xC4, 0xA5, 0xE2,
+    0x0C, 0x2B, 0x9D, 0x2D, 0xED, 0x12, 0x55, 0xED, 0x80, 0xC1, 0x0C, 0xC8, 0x03, 0x13, 0x55, 0xB5,
+    0xAE, 0x4D, 0xD6, 0x11, 0x24, 0x85, 0xF3, 0x82, 0xAD, 0xD0, 0xC9, 0x92, 0x9D, 0xBA, 0x74, 0xFB,
+    0x66, 0xDA, 0x2A, 0xAC, 0x69, 0xA7, 0xAA, 0xF1, 0x94, 0xB6, 0xEC, 0xFD, 0x1E, 0x69, 0xCF, 0xCF,
+    0x2B, 0xBE, 0xC8, 0x7E, 0xE5, 0x47, 0x8E, 0xB9, 0xB0, 0x7C, 0x91, 0xD2, 0x65, 0x02, 0x00, 0x64,
+    0x1A, 0xD9, 0x65, 0xC3, 0xBD, 0x3F, 0x49, 0x9D, 0xAC, 0xEC, 0xA0, 0x0E, 0x84, 0x2C, 0x18, 0x69,
+    0x27, 0x8B, 0x0B, 0xED, 0x9E, 0x69, 0xA7, 0x74, 0x81, 0xDC, 0x3C, 0xF1, 0x5D, 0xB6, 0x34, 0x90,
+    0x55, 0x0C, 0xDA, 0xB5, 0x07, 0xC8, 0xD7, 0x49, 0xC0, 0x65, 0xC8, 0x7D, 0xF6, 0x0B, 0xB3, 0x71,
+    0xB6, 0x8F, 0x3E, 0xEB, 0xFA, 0xCC, 0xCF, 0x33, 0x5F, 0x9A, 0x50, 0x62, 0x55, 0x31, 0xD6, 0x97,
+    0x21, 0xEB, 0x8A, 0x7B, 0x28, 0xEB, 0x67, 0x3D, 0x63, 0x95, 0x3A, 0x0B, 0x45, 0x8F, 0x92, 0xB1,
+    0x42, 0x63, 0xCD, 0x6B, 0x30, 0x85, 0xE7, 0x4C, 0x02, 0xF2, 0xE5, 0xFB, 0xD1, 0xD1, 0xA0, 0x2E,
+    0x6B, 0xC0, 0xBB, 0x0F, 0xF1, 0xDF, 0x17, 0x3D, 0x21, 0xAE, 0x83, 0x32, 0x2F, 0x27, 0xA2, 0xEA,
+    0x3E, 0xC7, 0x2C, 0xF0, 0x15, 0x67, 0xC4, 0xC2, 0xAC, 0x38, 0x41, 0xE9, 0xD7, 0x2A, 0x89, 0x92,
+    0x27, 0xD8, 0x97, 0x4A, 0x52, 0x71, 0x7A, 0xBA, 0x28, 0xB8, 0xCD, 0x10, 0x89, 0x59, 0x2B, 0xA4,
+    0x9A, 0x51, 0x13, 0x93, 0xD0, 0xF8, 0xAD, 0x62, 0x32, 0x89, 0xDD, 0xD6, 0x39, 0x13, 0x9D, 0x6B,
+    0xA2, 0xF7, 0x57, 0x18, 0x25, 0xF0, 0x21, 0x02, 0xEE, 0x10, 0x99, 0x19, 0xB3, 0x75, 0xCA, 0xF4,
+    0x5D, 0x64, 0x1E, 0x7D, 0xDE, 0x22, 0xD8, 0x3A, 0x09, 0x16, 0x69, 0x57, 0x30, 0x8F, 0xFB, 0x4C,
+    0xEC, 0x01, 0x79, 0x30, 0x63, 0xD4, 0x0D, 0x75, 0xE0, 0x54, 0x0B, 0x77, 0x23, 0x79, 0x95, 0xA6,
+    0x40, 0x98, 0x62, 0xFA, 0x78, 0x54, 0x13, 0x49, 0x1B, 0xB4, 0x71, 0x6F, 0xA7, 0x32, 0x4B, 0x42,
+    0x44, 0x3F, 0xD2, 0xCE, 0xF4, 0xEA, 0x92, 0xD4, 0xB9, 0x3C, 0x56, 0xEE, 0xF4, 0xC4, 0xE0, 0xA4,
+    0x60, 0x2B, 0x5B, 0x9C, 0x57, 0x6D, 0x1A, 0xAA, 0x3F, 0x9D, 0x7E, 0xBB, 0x64, 0xF3, 0x45, 0xDC,
+    0xF7, 0xC7, 0x68, 0xFB, 0x93, 0x91, 0x4D, 0x19, 0x03, 0x2F, 0xC7, 0x47, 0x11, 0xA1, 0xA5, 0x61,
+    0x67, 0x7D, 0x54, 0xAB, 0xE5, 0x42, 0xA9, 0x23, 0xBD, 0x91, 0xEB, 0x15, 0x0D, 0x07, 0xB2, 0xF7,
+    0x39, 0x09, 0xFA, 0x05, 0x99, 0x5C, 0x31, 0x77, 0xF2, 0x5A, 0xEE, 0x8B, 0xAC, 0x49, 0xF3, 0x50,
+    0xD2, 0xFD, 0x9D, 0xA3, 0x43, 0xCD, 0x16, 0xAF, 0x8D, 0x4A, 0x9B, 0x2B, 0xE3, 0x30, 0x70, 0x60,
+    0x00, 0x3D, 0x12, 0x72, 0x4B, 0x91, 0x73, 0x3E, 0x56, 0xA0, 0xAA, 0x8B, 0x88, 0xDA, 0x50, 0x29,
+    0xBA, 0xD9, 0xEF, 0x91, 0x66, 0xA9, 0xC4, 0xBA, 0x54, 0x8A, 0xCE, 0xD2, 0x8D, 0x63, 0x1C, 0xC8,
+    0xBB, 0x85, 0x21, 0x31, 0xCA, 0xF6, 0x52, 0x23, 0x5E, 0x60, 0xD0, 0x61, 0xC0, 0x40, 0x0C, 0xD2,
+    0x3E, 0xED, 0x39, 0x98, 0x60, 0x02, 0x93, 0x4E, 0xA5, 0xE9, 0x50, 0xFA, 0xAC, 0x63, 0x55, 0xA8,
+    0x6A, 0x1B, 0x52, 0xC6, 0xC4, 0x90, 0x25, 0x8A, 0x9E, 0x0B, 0x54, 0x9B, 0x5D, 0x52, 0x89, 0x26,
+    0x90, 0x0D, 0x49, 0xAF, 0xC9, 0x76, 0x9D, 0xA2, 0xC7, 0xE4, 0xED, 0x1F, 0xB0, 0xF6, 0x9D, 0xCF,
+    0x2C, 0x92, 0x8E, 0x9D, 0xF1, 0x27, 0x16, 0x79, 0x7B, 0x6E, 0x59, 0x44, 0x98, 0xB5, 0x39, 0x53,
+    0x57, 0x4F, 0x29, 0x69, 0x3A, 0x65, 0x1A, 0x8D, 0x66, 0x1D, 0xDC, 0xE7, 0x1D, 0x81, 0x6A, 0x70,
+    0xC9, 0x93, 0x78, 0xE0, 0xEB, 0x01, 0xC5, 0x0F, 0x8E, 0x91, 0xEF, 0x7E, 0x23, 0x8A, 0xB2, 0x55,
+    0x14, 0x60, 0x37, 0x0F, 0x9C, 0x87, 0xA5, 0xD2, 0x57, 0xC8, 0x19, 0x9F, 0xD3, 0x07, 0x14, 0x9E,
+    0x6A, 0x57, 0x76, 0x32, 0xD4, 0x74, 0x80, 0x8B, 0x22, 0x53, 0x2C, 0x2A, 0xAD, 0x15, 0xC4, 0x3E,
+    0x53, 0xD1, 0x06, 0x2D, 0x03, 0xDC, 0xCE, 0xC2, 0x9D, 0xD1, 0xF8, 0x0A, 0xC5, 0x84, 0x6E, 0x4C,
+    0x96, 0x4C, 0xE1, 0x45, 0xDC, 0xB5, 0x48, 0x48, 0xE4, 0xEB, 0xED, 0x43, 0xED, 0x93, 0x43, 0x7C,
+    0x84, 0x62, 0xCD, 0xF2, 0xB4, 0xB0, 0xE4, 0xCC, 0x90, 0xFD, 0x18, 0x92, 0xDF, 0x9C, 0xF8, 0xF4,
+    0x7B, 0xDD, 0xDB, 0x5C, 0xB3, 0xD3, 0xC2, 0x44, 0xFF, 0xAD, 0x27, 0x07, 0xAC, 0x16, 0x25, 0xEB,
+    0x8B, 0x9A, 0x1D, 0xE9, 0x50, 0xD6, 0xD5, 0xA4, 0x9A, 0x0D, 0xAA, 0x57, 0x5F, 0x0D, 0xCC, 0x09,
+    0x19, 0xCF, 0x80, 0xA8, 0xA8, 0x98, 0x1D, 0x77, 0xF5, 0x8F, 0x42, 0x74, 0x63, 0x29, 0x4E, 0x47,
+    0x6F, 0xA6, 0xFD, 0x91, 0xA4, 0xE9, 0xC3, 0x28, 0x35, 0x89, 0xF5, 0xC4, 0x6E, 0x3E, 0x8D, 0x01,
+    0xE7, 0xC3, 0xF8, 0x77, 0x62, 0x76, 0xA0, 0x98, 0x68, 0xD3, 0x0D, 0x69, 0xA4, 0x09, 0x8B, 0xB7,
+    0x6E, 0x56, 0xE0, 0x54, 0x97, 0x29, 0x6D, 0x3A, 0x2D, 0x52, 0xEC, 0xA2, 0x2E, 0xCB, 0x8E, 0x54,
+    0x42, 0xB4, 0x52, 0xAA, 0x6A, 0xB8, 0xBB, 0xE8, 0x47, 0xD5, 0xDA, 0x58, 0xBE, 0x8B, 0xA0, 0x07,
+    0xF0, 0xF8, 0x21, 0x8B, 0x7E, 0x24, 0xF2, 0xD9, 0x58, 0xCD, 0xAA, 0xE7, 0x51, 0xE8, 0x1A, 0x54,
+    0x3B, 0xFD, 0x90, 0x7C, 0x5C, 0x90, 0xE9, 0x5F, 0x12, 0x35, 0x1E, 0x37, 0xF4, 0xD3, 0x1F, 0x6B,
+    0x18, 0x03, 0xDC, 0x8E, 0xDB, 0x2B, 0xFF, 0x99, 0x86, 0x84, 0x25, 0xDA, 0xBE, 0x38, 0x03, 0xCE,
+    0x48, 0x42, 0xD3, 0x91, 0x1D, 0x15, 0x89, 0xC2, 0xE7, 0xF9, 0x58, 0x96, 0xA8, 0x07, 0xD6, 0x3F,
+    0x3E, 0x2B, 0xB0, 0x1A, 0xEB, 0x9A, 0xEC, 0x36, 0x5A, 0xA7, 0xAD, 0x9E, 0xA7, 0x65, 0x19, 0x6E,
+    0x35, 0x15, 0xE9, 0x7C, 0x84, 0xEE, 0x4B, 0x1A, 0x42, 0xB1, 0x73, 0xF4, 0xD4, 0x29, 0xF8, 0x35,
+    0x73, 0xA9, 0x35, 0xB7, 0xC5, 0xFF, 0xB8, 0xFE, 0x06, 0x5D, 0x55, 0x31, 0x6F, 0xE4, 0x54, 0x10,
+    0x1E, 0xFB, 0x29, 0x58, 0xC2, 0x42, 0x8F, 0xE2, 0x68, 0x90, 0x38, 0x37, 0x54, 0x88, 0x93, 0x1B,
+    0x0A, 0x8A, 0x24, 0xCF, 0x12, 0x05, 0x05, 0x05, 0x34, 0xA1, 0xA1, 0xA1, 0xA0, 0xB9, 0x8A, 0xF6,
+    0x8A, 0x23, 0x5E, 0x09, 0xBA, 0x6B, 0xF8, 0x09, 0x14, 0x54, 0x50, 0xDC, 0x15, 0x57, 0x5C, 0x91,
+    0x60, 0xEB, 0x52, 0x52, 0xC4, 0x54, 0x57, 0xA4, 0xB8, 0x45, 0x77, 0x05, 0x5D, 0x0C, 0x6B, 0x29,
+    0x8E, 0x62, 0x7B, 0xF8, 0xBE, 0x79, 0xBB, 0x11, 0x22, 0xCA, 0xCE, 0xEE, 0x3E, 0xCF, 0x9B, 0x99,
+    0xEF, 0x9B, 0x6F, 0x66, 0x45, 0x76, 0x7F, 0x0F, 0x69, 0xF2, 0x56, 0xDE, 0x39, 0x3A, 0x1A, 0xC5,
+    0xAB, 0xAA, 0x08, 0x4C, 0x2F, 0xC5, 0x0A, 0xE7, 0xE9, 0xC8, 0xA7, 0xA1, 0x82, 0xC9, 0x7A, 0x7E,
+    0x6C, 0x68, 0xFC, 0x9A, 0x76, 0xA6, 0x29, 0x5A, 0x7A, 0x4D, 0xE6, 0xC5, 0x8F, 0xCE, 0x2E, 0x34,
+    0xBC, 0xE0, 0xED, 0x82, 0x9A, 0x17, 0x2F, 0xA4, 0x8B, 0x79, 0x75, 0xF4, 0xB2, 0x0B, 0x4D, 0xBB,
+    0xAB, 0xE1, 0xA7, 0x58, 0x02, 0x9E, 0xF2, 0xDB, 0x20, 0xB5, 0x6A, 0x9B, 0xB2, 0x14, 0xBF, 0x3B,
+    0x4C, 0x78, 0x23, 0x5F, 0x6F, 0x8B, 0x89, 0xDF, 0xFA, 0x5D, 0x52, 0x06, 0xCE, 0x06, 0x98, 0xB2,
+    0xDB, 0x66, 0xB4, 0x04, 0xA5, 0x95, 0x99, 0x1C, 0x1D, 0x1D, 0x89, 0x43, 0xB0, 0x36, 0xE2, 0x3A,
+    0xE6, 0x61, 0x49, 0x70, 0xDE, 0x4A, 0xE9, 0x77, 0x00, 0x32, 0x3E, 0x66, 0xD6, 0x91, 0x8E, 0x73,
+    0x8C, 0x1F, 0x2B, 0x5D, 0x6E, 0x41, 0x59, 0x3E, 0x43, 0x96, 0x8D, 0xB7, 0x98, 0xF4, 0xF6, 0x49,
+    0x69, 0x98, 0xE5, 0x83, 0x5F, 0x7E, 0x4E, 0x54, 0xBB, 0x1C, 0x59, 0x0E, 0xF0, 0x15, 0x87, 0x25,
+    0xC0, 0x30, 0x32, 0x2E, 0x65, 0x48, 0x5B, 0xE2, 0x14, 0x91, 0x1D, 0x2A, 0x2C, 0x70, 0xF9, 0x64,
+    0x5B, 0x07, 0x92, 0xD0, 0x89, 0x5D, 0xE8, 0x48, 0x82, 0x6E, 0x8F, 0x3D, 0xCB, 0x95, 0xEF, 0x68,
+    0xD2, 0xC1, 0x0E, 0x8C, 0x3A, 0x63, 0x2B, 0x31, 0xC6, 0x0D, 0x8B, 0x84, 0xC7, 0xA8, 0x27, 0xB1,
+    0x1E, 0xE6, 0x0B, 0x7B, 0x85, 0xA2, 0x66, 0x76, 0x2A, 0x19, 0x48, 0x9E, 0xEB, 0xC8, 0x1E, 0x12,
+    0x4E, 0x4C, 0x99, 0xAD, 0x99, 0xBF, 0xAC, 0xA4, 0xA6, 0x47, 0x3D, 0x22, 0x57, 0x0A, 0x92, 0xCA,
+    0x36, 0x7F, 0x4D, 0x24, 0x8A, 0xFF, 0xD6, 0xA3, 0xB0, 0x56, 0x12, 0x94, 0xF9, 0x54, 0x64, 0xFF,
+    0x0E, 0x2A, 0xEB, 0xF2, 0xF5, 0xBE, 0xEB, 0xB2, 0xAA, 0x4F, 0xBA, 0x07, 0xF2, 0xE4, 0x9E, 0xEC,
+    0xFB, 0x64, 0x72, 0xED, 0x33, 0xE3, 0xBD, 0xC0, 0x7F, 0x2F, 0x6E, 0x96, 0x66, 0x4C, 0x50, 0x42,
+    0x36, 0xA5, 0xDA, 0x91, 0x2B, 0x3F, 0xE4, 0x6A, 0x6D, 0x29, 0xD6, 0x61, 0xF4, 0x83, 0x91, 0xA5,
+    0x9D, 0xF1, 0xD9, 0x7C, 0xAF, 0xB9, 0x01, 0x50, 0x3F, 0xD6, 0x44, 0xE9, 0xE6, 0xF0, 0xC2, 0x38,
+    0xCF, 0x66, 0xAD, 0x0D, 0xA5, 0xBF, 0x51, 0x3B, 0x40, 0x78, 0x35, 0x94, 0x12, 0x74, 0x8E, 0xBA,
+    0x61, 0x3F, 0xCD, 0x65, 0xF7, 0xC4, 0xDA, 0x1C, 0x0F, 0xEC, 0x03, 0xB9, 0xD0, 0x55, 0xBC, 0x7B,
+    0xC9, 0x0A, 0x52, 0xDD, 0xE8, 0x63, 0x35, 0x7C, 0xC5, 0x1C, 0x16, 0x1E, 0xF4, 0x3A, 0x34, 0x33,
+    0x83, 0x3A, 0xED, 0x90, 0xC9, 0xE9, 0x50, 0x6A, 0xAA, 0xE3, 0xD3, 0xA0, 0x95, 0x4E, 0x4E, 0xAF,
+    0x76, 0x2A, 0xF5, 0x3B, 0xB5, 0x3E, 0xD8, 0xBE, 0xA7, 0xDD, 0xFF, 0x9F, 0xB8, 0xBE, 0xE8, 0xD1,
+    0xAB, 0xD3, 0x6C, 0x44, 0x83, 0xFC, 0xF3, 0x19, 0x36, 0xED, 0x1B, 0x36, 0xEB, 0xB0, 0x7C, 0x04,
+    0xEB, 0xCF, 0x2F, 0x70, 0x27, 0xB9, 0xB9, 0xEA, 0x0C, 0xC5, 0xDA, 0x54, 0x67, 0xB3, 0xA1, 0x83,
+    0x59, 0xD3, 0xAE, 0xA1, 0x72, 0xBA, 0x2C, 0x46, 0x02, 0x06, 0x26, 0x9B, 0xEB, 0xDF, 0x27, 0xD8,
+    0xF2, 0x6F, 0xFD, 0x21, 0x9F, 0xFD, 0x18, 0xAE, 0x2A, 0x4B, 0x17, 0x2B, 0x7B, 0x62, 0xF6, 0xCE,
+    0xB6, 0x84, 0x37, 0x1A, 0x74, 0xAF, 0x06, 0x41, 0xE9, 0xF2, 0x2B, 0x69, 0x73, 0x0C, 0x9C, 0x31,
+    0x47, 0x59, 0x45, 0xD1, 0x71, 0x7C, 0xF7, 0xBE, 0x5C, 0xE8, 0xF5, 0x23, 0x52, 0x1A, 0x95, 0xBF,
+    0xD1, 0x9C, 0x90, 0x30, 0x73, 0xEF, 0xB6, 0xE2, 0x72, 0x13, 0x5A, 0xDF, 0x74, 0x39, 0x15, 0x15,
+    0x58, 0x96, 0x2A, 0xEE, 0x7D, 0xBB, 0x20, 0x92, 0xEB, 0x76, 0xC0, 0x1F, 0xDE, 0xAE, 0x12, 0x79,
+    0x1B, 0x84, 0x0F, 0xF2, 0x7E, 0x8A, 0xC2, 0xDE, 0xC2, 0x57, 0xB8, 0x7C, 0x08, 0x25, 0x56, 0x82,
+    0x16, 0xBC, 0x8B, 0xCC, 0x49, 0x6F, 0x57, 0xF8, 0x76, 0x8A, 0x50, 0x6D, 0xA1, 0x7D, 0xA2, 0xAF,
+    0x65, 0x0F, 0xAE, 0xD7, 0x78, 0x7D, 0x84, 0xA8, 0x15, 0xF1, 0x64, 0xA8, 0xE9, 0x7E, 0xEC, 0x74,
+    0x45, 0xFD, 0xD4, 0xB6, 0x35, 0x16, 0x9B, 0xB3, 0x99, 0x23, 0x97, 0x4E, 0x14, 0x8D, 0x1B, 0x0B,
+    0x12, 0x35, 0x50, 0x26, 0x79, 0x4F, 0xEA, 0xFC, 0x2B, 0xA2, 0x29, 0x5E, 0xDA, 0x2E, 0x30, 0x62,
+    0x83, 0x75, 0xBF, 0xB6, 0x2D, 0xD4, 0x4C, 0x51, 0x22, 0x51, 0x17, 0x95, 0x31, 0xDD, 0x12, 0x24,
+    0xF9, 0xCE, 0xC6, 0x66, 0xA4, 0x52, 0xC3, 0xC4, 0xF9, 0x86, 0xFA, 0xB1, 0x3E, 0x0A, 0x5C, 0x0E,
+    0x1D, 0x34, 0x0F, 0xBD, 0x66, 0x70, 0x6A, 0x56, 0x4E, 0xC7, 0xBB, 0x56, 0xD8, 0x3D, 0xB3, 0xFB,
+    0xFF, 0xD1, 0xC3, 0x37, 0x66, 0x13, 0xF6, 0xFF, 0x19, 0x3A, 0x7E, 0x80, 0x57, 0x41, 0x15, 0xA0,
+    0xEF, 0x0E, 0x5D, 0x4F, 0x6E, 0x00, 0x81, 0x25, 0x05, 0xBC, 0xCA, 0x81, 0x12, 0x45, 0xEA, 0xCB,
+    0x5E, 0xD2, 0x7F, 0x00, 0x68, 0x02, 0xC0, 0xE3, 0x7C, 0xC2, 0x5E, 0xD0, 0x95, 0x6F, 0xC3, 0xF0,
+    0x35, 0x42, 0x7D, 0x2C, 0x91, 0xC5, 0xB8, 0x12, 0xA5, 0xAE, 0xC8, 0x34, 0xE6, 0x17, 0x8D, 0x09,
+    0x2B, 0xAE, 0x04, 0xD8, 0xFC, 0xA2, 0x2B, 0x11, 0x7F, 0x33, 0x70, 0x0F, 0x8F, 0x13, 0xED, 0x69,
+    0xCD, 0x5D, 0x10, 0xCA, 0x73, 0xD8, 0xE2, 0xFC, 0x12, 0xD9, 0xF2, 0x57, 0xCC, 0x1B, 0x65, 0x05,
+    0xE0, 0x64, 0x61, 0x29, 0x89, 0x3C, 0x7C, 0x8E, 0x65, 0x23, 0xE5, 0xD9, 0x35, 0xC8, 0xF0, 0x7F,
+    0xCE, 0x01, 0xB3, 0x3B, 0x34, 0x18, 0xD5, 0x74, 0xC2, 0x7C, 0xF6, 0xDC, 0x7A, 0xE5, 0xC2, 0xBC,
+    0x8E, 0xD3, 0xF5, 0x9E, 0x24, 0x5F, 0x60, 0x17, 0x9C, 0x00, 0x6E, 0x21, 0xF9, 0x7D, 0x68, 0x64,
+    0xF3, 0xC7, 0x20, 0x77, 0x0F, 0x0E, 0xC4, 0xBD, 0x78, 0x59, 0xC9, 0x21, 0x7C, 0x72, 0x86, 0x1B,
+    0x10, 0xB9, 0x28, 0x1A, 0xE0, 0xDA, 0x8C, 0x72, 0x18, 0x8A, 0x75, 0x76, 0xD6, 0x6B, 0x35, 0x59,
+    0x53, 0x63, 0x3F, 0xB1, 0xBD, 0xB5, 0x42, 0x21, 0x9F, 0x0D, 0xF2, 0xA6, 0xFE, 0xD5, 0xAC, 0x90,
+    0x8F, 0xCB, 0xD4, 0xAF, 0xD9, 0xC8, 0xF0, 0xC9, 0x24, 0x56, 0xC0, 0xAE, 0x9B, 0x75, 0xDD, 0x71,
+    0x32, 0x16, 0x9B, 0xEA, 0xF5, 0xAE, 0x99, 0xA9, 0x4D, 0xBE, 0x37, 0x5B, 0xAB, 0x79, 0x10, 0x91,
+    0xDF, 0xD0, 0xD6, 0x8F, 0xD0, 0x38, 0x37, 0x7B, 0xC2, 0xB2, 0x56, 0xD6, 0x2B, 0x8C, 0x3A, 0xF7,
+    0xD2, 0x8C, 0x83, 0x04, 0x0C, 0x58, 0x27, 0xA3, 0xDA, 0xD3, 0x5E, 0xF6, 0xBE, 0xBA, 0xAE, 0xA0,
+    0xF1, 0xD6, 0x73, 0x57, 0x70, 0x5A, 0xF9, 0xDB, 0xC7, 0x71, 0x09, 0xF8, 0xFD, 0x3B, 0xC6, 0xB8,
+    0x9C, 0x82, 0xEA, 0x69, 0x31, 0x71, 0x63, 0xA5, 0x81, 0x8F, 0x15, 0xE6, 0x16, 0x78, 0xD1, 0x3E,
+    0x7F, 0x31, 0x89, 0x3F, 0x5B, 0xA4, 0x7C, 0xAE, 0x55, 0x58, 0x69, 0x1B, 0xAA, 0xA6, 0x6F, 0x24,
+    0x4C, 0x58, 0xF8, 0x03, 0x96, 0x1A, 0xE9, 0xD6, 0x4F, 0x39, 0x36, 0x5C, 0x77, 0x78, 0xC8, 0xC8,
+    0x2D, 0x37, 0x5D, 0x84, 0xEB, 0x06, 0x22, 0x8D, 0x78, 0x65, 0xB1, 0x1F, 0x47, 0x03, 0xBC, 0x95,
+    0xAF, 0xDF, 0xEE, 0x88, 0xFE, 0x16, 0x72, 0xD4, 0x6F, 0xC4, 0x0C, 0x27, 0x9B, 0x67, 0x03, 0x1D,
+    0x05, 0x1C, 0x51, 0x8B, 0x9A, 0xB3, 0xC1, 0x86, 0x82, 0x73, 0x38, 0x47, 0xDC, 0x18, 0x9B, 0x38,
+    0x11, 0xFF, 0x02, 0x95, 0x55, 0x21, 0x93, 0xDE, 0x54, 0x14, 0x3D, 0x49, 0xA6, 0x0D, 0xD3, 0x88,
+    0xD4, 0xA0, 0x2A, 0xE2, 0x10, 0x98, 0x18, 0x64, 0xBB, 0xC9, 0x0C, 0x72, 0x05, 0x35, 0x6B, 0xE0,
+    0x0F, 0x54, 0x30, 0x53, 0x04, 0xB2, 0x6D, 0x32, 0xE5, 0x0F, 0x60, 0xD6, 0x57, 0x60, 0x70, 0x08,
+    0x04, 0x62, 0xB7, 0x79, 0x33, 0x08, 0x24, 0x81, 0xE1, 0x07, 0x44, 0x6C, 0xA9, 0x24, 0x22, 0x22,
+    0x3B, 0x24, 0x79, 0x9C, 0x73, 0x5F, 0xC2, 0xB7, 0x48, 0x32, 0xFB, 0xBD, 0xEF, 0x7D, 0xF7, 0xBD,
+    0xDC, 0x7B, 0xEE, 0xB9, 0xE7, 0xDE, 0x05, 0x80, 0xD2, 0x4F, 0xF9, 0xAF, 0x7E, 0xC9, 0x1C, 0xCE,
+    0xB2, 0x1E, 0xF9, 0x79, 0x8F, 0xF4, 0x97, 0x1E, 0xC9, 0xFB, 0x01, 0xF8, 0x9B, 0x9F, 0x66, 0x04,
+    0x2A, 0x7E, 0xF2, 0x05, 0xC8, 0x7C, 0x8D, 0xC4, 0xF3, 0xC7, 0xAD, 0x07, 0xAE, 0xAA, 0x01, 0x55,
+    0xBA, 0xA2, 0x68, 0xBD, 0xCB, 0x5C, 0x31, 0x03, 0xD1, 0x77, 0xC0, 0xFD, 0x37, 0xC8, 0xF8, 0x56,
+    0xE9, 0x50, 0xD5, 0xC0, 0x86, 0x68, 0x05, 0xD2, 0x09, 0xD9, 0x18, 0x6C, 0x0E, 0xF0, 0x32, 0x23,
+    0x99, 0x91, 0x4D, 0xB4, 0xF5, 0x87, 0x8D, 0x7F, 0xC9, 0x82, 0x94, 0x6E, 0x8A, 0x41, 0x66, 0x74,
+    0xAD, 0xD9, 0x56, 0xA4, 0xDB, 0xC5, 0xC5, 0xF3, 0x91, 0x38, 0xF9, 0x38, 0x68, 0xDD, 0x88, 0x82,
+    0xCF, 0x74, 0xD7, 0xE6, 0x91, 0xD0, 0x6D, 0x3E, 0xA3, 0xA0, 0xDB, 0xA6, 0x47, 0xE7, 0x78, 0x49,
+    0x7F, 0x42, 0x2E, 0x74, 0xCD, 0xF8, 0xAC, 0xEB, 0x11, 0xFB, 0x6F, 0x08, 0x8F, 0x4F, 0x6E, 0x2B,
+    0x5E, 0xD8, 0x1A, 0x0F, 0x28, 0x80, 0x09, 0x57, 0x48, 0x5C, 0xC2, 0xF0, 0xC8, 0x6B, 0x2C, 0x3C,
+    0x4B, 0x86, 0x64, 0x44, 0x51, 0xE7, 0x2D, 0x4F, 0x5E, 0x22, 0x19, 0xE3, 0x89, 0xE9, 0xE6, 0xDE,
+    0xAF, 0x68, 0xBC, 0x1F, 0x63, 0x05, 0xCF, 0x15, 0xBA, 0x62, 0x3E, 0xD1, 0x82, 0xBC, 0x67, 0xEE,
+    0x0D, 0x33, 0x8F, 0x97, 0xAF, 0xE5, 0xD5, 0x1D, 0x71, 0x1E, 0xE2, 0xDF, 0x27, 0x36, 0x1E, 0x05,
+    0x97, 0x98, 0x72, 0xCB, 0x65, 0xB2, 0x0D, 0x13, 0x25, 0x49, 0x05, 0x33, 0x3F, 0xD8, 0xA2, 0x59,
+    0xE4, 0x6B, 0x53, 0xA8, 0x12, 0x2D, 0x10, 0x98, 0x21, 0xB3, 0x07, 0x6D, 0x77, 0x36, 0x3C, 0x8F,
+    0x36, 0x6D, 0x58, 0xA5, 0x78, 0xB5, 0x8D, 0x71, 0xCA, 0xC2, 0xF8, 0xCB, 0x8B, 0x2F, 0xB4, 0x11,
+    0x62, 0xAF, 0x8D, 0xF1, 0x37, 0x1F, 0x9B, 0x09, 0x01, 0x93, 0x4A, 0x2B, 0x28, 0xFB, 0x86, 0xE7,
+    0x95, 0xC8, 0xDA, 0x19, 0x65, 0x70, 0x9A, 0x3B, 0xC1, 0x91, 0x20, 0xBC, 0x36, 0xCD, 0x40, 0xE7,
+    0xDA, 0x18, 0xB5, 0x02, 0x88, 0x27, 0x8A, 0xD2, 0x92, 0x40, 0xEF, 0xFB, 0xD4, 0xF1, 0x27, 0xC4,
+    0x21, 0x0F, 0x58, 0x71, 0xDE, 0x24, 0x8D, 0xD2, 0x07, 0x22, 0x65, 0xED, 0x70, 0x4D, 0x79, 0x50,
+    0x47, 0x01, 0x9A, 0x32, 0xF1, 0x9E, 0xC7, 0x95, 0x61, 0x2A, 0x0C, 0x2B, 0x45, 0xD9, 0x40, 0x24,
+    0x95, 0xCC, 0x4F, 0x1C, 0x33, 0x98, 0x51, 0x75, 0x7A, 0xAA, 0xF0, 0x2E, 0x4C, 0x1A, 0x74, 0xB8,
+    0xA7, 0x54, 0xD6, 0x81, 0xC5, 0x35, 0x10, 0x44, 0x18, 0xE2, 0x1C, 0x85, 0x0B, 0x2C, 0xBF, 0xDD,
+    0xCD, 0x53, 0x20, 0x89, 0x60, 0x0A, 0x79, 0x65, 0xB0, 0xEE, 0x2F, 0x5F, 0xC7, 0xB3, 0x71, 0x53,
+    0x33, 0x5E, 0xBE, 0xD5, 0x8D, 0x20, 0x92, 0x83, 0x57, 0x44, 0x10, 0x33, 0xC6, 0xC2, 0x42, 0xB3,
+    0x38, 0xC9, 0x40, 0x95, 0x57, 0x2D, 0xF2, 0x76, 0x35, 0xA5, 0xBF, 0x24, 0x2E, 0x16, 0x2F, 0x19,
+    0x83, 0xD6, 0xCB, 0x76, 0x93, 0xD8, 0xCB, 0x85, 0x31, 0xD2, 0x89, 0x44, 0x31, 0x74, 0xE9, 0xD2,
+    0x9B, 0x03, 0x77, 0x12, 0xB2, 0x15, 0xE3, 0x2C, 0xE9, 0x2B, 0xBA, 0x25, 0x0F, 0x93, 0x80, 0x0A,
+    0x0D, 0xF3, 0x55, 0x54, 0xBA, 0x8D, 0x66, 0xB3, 0x91, 0x09, 0x3A, 0x90, 0x8D, 0xD0, 0x79, 0x57,
+    0xC2, 0x21, 0x79, 0xB9, 0x6C, 0x35, 0x49, 0x31, 0xDB, 0xE6, 0x27, 0x82, 0xA0, 0xCB, 0x89, 0xEF,
+    0x37, 0x37, 0xD9, 0xF8, 0xBD, 0xC4, 0xC0, 0x57, 0x91, 0xF3, 0x6A, 0x6B, 0xF9, 0x9D, 0x31, 0xCC,
+    0x2C, 0xBD, 0xEB, 0xDD, 0x34, 0xB8, 0xAC, 0x2C, 0x8C, 0xCC, 0xD9, 0x10, 0x75, 0xE6, 0xB2, 0x50,
+    0xE8, 0x45, 0x8D, 0x88, 0xE8, 0x29, 0xEA, 0xBB, 0x8C, 0x77, 0xB6, 0x66, 0xA6, 0x3B, 0xF6, 0x02,
+    0x4C, 0x64, 0xEF, 0xF4, 0x95, 0xAE, 0xA1, 0xBD, 0x06, 0x56, 0x74, 0x30, 0x12, 0x58, 0x44, 0xC6,
+    0xDC, 0xE8, 0x69, 0x55, 0x1A, 0x4F, 0x54, 0x44, 0xEA, 0x42, 0x15, 0x65, 0xFF, 0x11, 0x2C, 0xE1,
+    0xCC, 0xE4, 0xF3, 0x8A, 0xB9, 0xF3, 0x60, 0x21, 0x00, 0x7E, 0xCD, 0x64, 0xAA, 0x70, 0x84, 0xE4,
+    0x6B, 0x7D, 0xD1, 0x6D, 0xE9, 0xA2, 0xA5, 0x9A, 0x3F, 0x28, 0x86, 0xC8, 0xFB, 0xDF, 0xAE, 0x8B,
+    0x35, 0x52, 0xB9, 0x4D, 0xAD, 0x7E, 0x4B, 0xED, 0x4B, 0x27, 0xDE, 0xDF, 0x02, 0x8F, 0xFC, 0xB7,
+    0x27, 0xAC, 0xD1, 0x8F, 0xA6, 0x7C, 0xE1, 0x37, 0x5D, 0x57, 0x92, 0x29, 0x09, 0x79, 0x3E, 0xD0,
+    0x7B, 0xE5, 0x5D, 0xC5, 0x0E, 0x7F, 0x9C, 0xBA, 0xC4, 0xC5, 0x6E, 0x26, 0x27, 0x8F, 0xF3, 0xBA,
+    0x40, 0xF6, 0x7A, 0x8C, 0xFB, 0x78, 0x3C, 0xA3, 0x7C, 0xAF, 0x39, 0x04, 0x5C, 0xD5, 0x72, 0x5B,
+    0x0C, 0x9F, 0x8E, 0x89, 0x9F, 0x5F, 0x54, 0x7F, 0x50, 0x70, 0xBF, 0x5B, 0x07, 0xA9, 0x6B, 0x6E,
+    0xF0, 0x68, 0xFB, 0x0F, 0x39, 0x16, 0x3D, 0xB2, 0xFE, 0x4A, 0x83, 0x84, 0xFD, 0xE5, 0xE7, 0xA4,
+    0xC4, 0x9A, 0x53, 0x73, 0xF4, 0x58, 0xB3, 0xD9, 0x18, 0xB3, 0xBD, 0x69, 0x70, 0x6F, 0x60, 0xEC,
+    0xBC, 0x5A, 0x3F, 0xA9, 0xE3, 0xF9, 0xC2, 0x64, 0x97, 0xD6, 0xC0, 0xB4, 0xB3, 0xE3, 0x59, 0x83,
+    0xA5, 0xF0, 0x37, 0xF7, 0xAE, 0x4C, 0xF2, 0x9B, 0x35, 0x00, 0xF3, 0x2C, 0xAD, 0x1D, 0x92, 0xD0,
+    0xC6, 0x8D, 0x21, 0x88, 0x3A, 0xD1, 0x02, 0x7C, 0x64, 0x2E, 0xF1, 0x89, 0xAD, 0x5F, 0x9E, 0xEA,
+    0xA5, 0xD1, 0x1D, 0x9E, 0xFB, 0xBE, 0x25, 0x74, 0x94, 0xB7, 0xCF, 0xA4, 0x73, 0x75, 0xDB, 0x5B,
+    0x6B, 0x1D, 0x0E, 0x3E, 0xA8, 0x5B, 0x6D, 0x5A, 0x0D, 0xFB, 0xD8, 0xF9, 0xF3, 0x0D, 0xEF, 0xF6,
+    0xB1, 0xC2, 0x75, 0xBC, 0x1D, 0xF3, 0xCA, 0x03, 0xE0, 0xE3, 0xD1, 0x46, 0x7C, 0x18, 0x24, 0x9D,
+    0xD6, 0x9F, 0xAD, 0x48, 0x0F, 0x2E, 0xB3, 0xF1, 0xDE, 0xD3, 0xBD, 0x00, 0xB0, 0xB8, 0xA1, 0x8F,
+    0x6D, 0xC4, 0xC1, 0x52, 0x4F, 0x2D, 0x4F, 0x6B, 0xDB, 0xC0, 0x42, 0x3A, 0x9F, 0x48, 0xF0, 0x27,
+    0xA2, 0xCA, 0x61, 0x9F, 0x74, 0x87, 0xC1, 0x7A, 0x37, 0x0C, 0xA5, 0xC4, 0x3C, 0x15, 0xE6, 0xA9,
+    0x9B, 0xAC, 0xCF, 0xCC, 0x5F, 0x61, 0x09, 0xFE, 0x64, 0x4E, 0xFA, 0x30, 0x36, 0x16, 0x7D, 0x3E,
+    0x3C, 0x77, 0x0F, 0xAD, 0x35, 0x38, 0xB4, 0xEC, 0x12, 0x75, 0x29, 0x51, 0x72, 0x56, 0xF1, 0xDF,
+    0x9C, 0xB5, 0x95, 0x7A, 0x43, 0xAD, 0x69, 0x4C, 0x58, 0x2F, 0x8E, 0x7B, 0x4D, 0xBE, 0xE2, 0xE7,
+    0x87, 0x7D, 0x0C, 0xA9, 0x61, 0x3F, 0xD3, 0xC8, 0x7E, 0xBD, 0x28, 0x87, 0x46, 0xF3, 0x87, 0x53,
+    0xA2, 0xE8, 0x09, 0x91, 0x9C, 0x75, 0x35, 0x7F, 0x94, 0x03, 0x97, 0x74, 0xD1, 0x3F, 0x3F, 0x7F,
+    0xAE, 0x09, 0xFB, 0xDE, 0x04, 0xA2, 0x56, 0xD3, 0x82, 0x66, 0xB3, 0x19, 0x6C, 0xA8, 0x4D, 0xB2,
+    0x22, 0xAB, 0x3A, 0xA6, 0x6F, 0x10, 0x4E, 0xB6, 0x1D, 0xC7, 0x41, 0x0A, 0x26, 0xEB, 0x66, 0xC6,
+    0xFF, 0x7E, 0xFE, 0x01, 0xB5, 0x55, 0x3D, 0x6F, 0xDD, 0x36, 0x14, 0x3D, 0x12, 0x5B, 0x0B, 0x88,
+    0x5A, 0xB0, 0x43, 0xA6, 0x24, 0xA8, 0xF6, 0xC0, 0xB6, 0x96, 0x0C, 0x46, 0x61, 0x5B, 0x72, 0x3D,
+    0x64, 0x8C, 0x97, 0xFE, 0x8D, 0x7A, 0xE9, 0x90, 0x02, 0xCF, 0x16, 0xB7, 0xAC, 0x1E, 0xFA, 0x13,
+    0x92, 0xC5, 0x1D, 0xD2, 0x21, 0x43, 0x0B, 0x38, 0x16, 0xD1, 0x5F, 0x20, 0xA3, 0x63, 0x17, 0x01,
+    0x79, 0x5B, 0x86, 0x10, 0x85, 0x06, 0xD9, 0xD6, 0x13, 0x7B, 0x2E, 0xF9, 0x5E, 0xBB, 0x75, 0xEB,
+    0xB3, 0x49, 0x4A, 0xE4, 0xE5, 0xFD, 0x38, 0xF7, 0xDC, 0xAB, 0xF7, 0x48, 0xC6, 0x6B, 0x28, 0x77,
+    0x8E, 0xBC, 0x3B, 0x87, 0xB6, 0x0D, 0x2A, 0xFE, 0x9D, 0x73, 0x4C, 0xA8, 0xD2, 0x01, 0x55, 0xD6,
+    0xA3, 0x7A, 0x61, 0x51, 0x9E, 0xD6, 0x28, 0x5B, 0xA0, 0x9C, 0x80, 0x62, 0xE4, 0x70, 0x1C, 0x1D,
+    0xDF, 0x2D, 0x50, 0xC9, 0x30, 0x40, 0x53, 0x03, 0x14, 0x81, 0xEE, 0x39, 0x3A, 0x0F, 0xA8, 0x31,
+    0xA7, 0x98, 0x47, 0x63, 0x28, 0xA7, 0x26, 0x64, 0xD4, 0x67, 0x93, 0x19, 0xE9, 0x4A, 0xEE, 0x14,
+    0x4E, 0x3B, 0x24, 0x5E, 0xAD, 0x28, 0x3D, 0xB4, 0xBC, 0xEF, 0xDF, 0x52, 0x3A, 0xF7, 0xB4, 0x80,
+    0xC6, 0x53, 0x97, 0xF2, 0x54, 0x54, 0x7A, 0xEF, 0xF8, 0xE4, 0xA9, 0xAE, 0xF2, 0xB2, 0x91, 0x51,
+    0x9E, 0xB2, 0xB4, 0x89, 0x42, 0x44, 0x53, 0xCF, 0xAB, 0xA8, 0x06, 0xC8, 0xDD, 0x70, 0xE4, 0xE4,
+    0x68, 0x96, 0x47, 0x3C, 0xAA, 0xF1, 0x14, 0x79, 0x8F, 0xB2, 0x4E, 0x46, 0x14, 0x06, 0x12, 0x22,
+    0x0A, 0x9B, 0x77, 0x0C, 0x59, 0x51, 0x6E, 0x92, 0xA9, 0xE2, 0x19, 0xF7, 0xA9, 0x4C, 0xB9, 0xF7,
+    0xBC, 0xB4, 0x3A, 0xE7, 0x54, 0x36, 0x41, 0x61, 0x2D, 0x06, 0x6C, 0x70, 0x60, 0x4A, 0x38, 0xAD,
+    0xD0, 0x06, 0x5F, 0x94, 0x98, 0x46, 0x30, 0x22, 0x61, 0x07, 0x1C, 0x36, 0x3F, 0xD1, 0x41, 0x15,
+    0x05, 0xB7, 0xA8, 0x44, 0x0D, 0x61, 0x21, 0x0C, 0x61, 0xE1, 0xAE, 0x5C, 0x50, 0x63, 0xBC, 0xD7,
+    0xC6, 0xA5, 0xE8, 0x1B, 0x89, 0x42, 0x4D, 0x61, 0x41, 0xDB, 0x06, 0x75, 0x45, 0x88, 0x92, 0xC6,
+    0xA3, 0xF2, 0xB8, 0x89, 0xC6, 0xC5, 0x25, 0x46, 0xD8, 0xC4, 0xC3, 0xE6, 0xD3, 0x18, 0x96, 0x0F,
+    0x01, 0x82, 0xA6, 0x6F, 0xBB, 0x20, 0xA9, 0x03, 0x98, 0x4E, 0x49, 0x1C, 0xBC, 0x27, 0x57, 0x39,
+    0x64, 0xB7, 0x19, 0xA8, 0xD7, 0x3C, 0x6C, 0xC4, 0x3B, 0xB7, 0x13, 0x1D, 0xD7, 0x71, 0x51, 0xD1,
+    0x4E, 0xD2, 0xC7, 0xD7, 0x77, 0xC4, 0xC1, 0xE0, 0x00, 0x99, 0xC5, 0x08, 0xD5, 0xAB, 0x1E, 0xA9,
+    0xE3, 0x46, 0x32, 0x94, 0x3C, 0x9C, 0xAE, 0xC4, 0x31, 0xF1, 0x48, 0x58, 0x80, 0x2A, 0xC4, 0x64,
+    0x22, 0x68, 0xC8, 0x3F, 0x09, 0x43, 0x5E, 0xF1, 0xB4, 0x25, 0x0A, 0xE9, 0x44, 0xD0, 0x72, 0x97,
+    0x4C, 0x02, 0xD6, 0xFC, 0xA5, 0xA8, 0xFE, 0x42, 0xA6, 0x27, 0x32, 0x3D, 0x8C, 0x96, 0x89, 0xAD,
+    0xD9, 0x27, 0xC2, 0x03, 0x8D, 0x31, 0xCF, 0xA3, 0xA4, 0x4B, 0xD7, 0xBC, 0x92, 0x38, 0xE6, 0x10,
+    0x25, 0x33, 0x44, 0x17, 0xC8, 0x4E, 0xF1, 0xA7, 0x17, 0x97, 0x08, 0xF6, 0x55, 0x90, 0x32, 0x64,
+    0x2C, 0x06, 0x94, 0x06, 0x85, 0x60, 0x9E, 0xBA, 0xB5, 0x94, 0x13, 0x29, 0x49, 0xDA, 0xA0, 0xBD,
+    0xA4, 0x4E, 0x26, 0x57, 0x70, 0x0A, 0xF8, 0xE5, 0x82, 0x13, 0x42, 0x32, 0xB5, 0x04, 0x90, 0x04,
+    0x18, 0xCB, 0x3A, 0x86, 0xFE, 0xF4, 0xF2, 0xF5, 0x67, 0x8D, 0x1F, 0x77, 0xB0, 0xC0, 0x3E, 0x7E,
+    0xC5, 0x1E, 0x1C, 0x7E, 0xE0, 0xF8, 0x25, 0xED, 0xE1, 0x54, 0x87, 0x5E, 0xD9, 0xA4, 0xCB, 0x6C,
+    0x6A, 0x73, 0xA3, 0xAC, 0xAE, 0x95, 0xA1, 0x85, 0x91, 0xAA, 0x47, 0x92, 0x56, 0xF8, 0xC8, 0xC0,
+    0xE9, 0x37, 0x28, 0x8D, 0xD4, 0x24, 0x27, 0xD8, 0x3A, 0x21, 0x03, 0x66, 0xD6, 0x84, 0xEE, 0xE8,
+    0xF6, 0x14, 0xA8, 0x38, 0x22, 0x1D, 0x74, 0x4D, 0x0E, 0xD2, 0x4F, 0x47, 0x44, 0xAF, 0x29, 0xAD,
+    0xBB, 0x5D, 0x52, 0x21, 0x1D, 0xB6, 0xBC, 0xD5, 0xA2, 0xA9, 0x9A, 0x85, 0x39, 0x99, 0xA0, 0x7C,
+    0xBD, 0xF1, 0x79, 0x5A, 0x7B, 0x1C, 0x1C, 0x96, 0x4C, 0xA8, 0xBF, 0x2E, 0x80, 0xC3, 0x33, 0xCA,
+    0xFD, 0x69, 0x37, 0xE7, 0x4C, 0x44, 0x32, 0x84, 0x48, 0x1E, 0xE0, 0xC1, 0xB1, 0x55, 0x37, 0x0E,
+    0xEE, 0x1D, 0x16, 0xDB, 0xD8, 0xD5, 0xD0, 0xC7, 0x26, 0xB3, 0x7D, 0xD6, 0x1F, 0xBE, 0x1D, 0x32,
+    0xCF, 0x2C, 0x16, 0x21, 0xCD, 0x8C, 0x4A, 0xDC, 0x7E, 0x09, 0xEC, 0xD0, 0xCD, 0x05, 0xF0, 0x35,
+    0xB7, 0x6B, 0x24, 0x6B, 0x40, 0x68, 0xEC, 0x4C, 0x34, 0x5E, 0xA5, 0xEB, 0xE2, 0x49, 0xC6, 0x8C,
+    0xB5, 0x34, 0xE4, 0x2C, 0x11, 0x47, 0x77, 0xB2, 0x9E, 0x36, 0x75, 0x57, 0x1C, 0xB9, 0xC2, 0x96,
+    0xDF, 0xF6, 0x95, 0xAD, 0x8E, 0x6F, 0xBC, 0xA9, 0xFE, 0xF8, 0xE8, 0xEB, 0x52, 0xC0, 0x97, 0x14,
+    0x30, 0xCB, 0x03, 0xB1, 0x2F, 0x12, 0x26, 0xB8, 0x48, 0xE9, 0xE7, 0xAE, 0x14, 0xD3, 0x41, 0x46,
+    0xDD, 0xFB, 0xD2, 0x2F, 0xC0, 0xB6, 0xB0, 0x85, 0xC4, 0x38, 0xEC, 0x6B, 0xE4, 0x47, 0x1D, 0xDC,
+    0x36, 0xB4, 0xB2, 0x69, 0xFF, 0xF2, 0xD9, 0x41, 0xF6, 0x4A, 0xDB, 0xB3, 0xFB, 0x89, 0x3C, 0x31,
+    0xF9, 0x38, 0xE0, 0x49, 0x81, 0xF4, 0x77, 0x87, 0xBD, 0x43, 0x24, 0x59, 0xB7, 0xAE, 0xBE, 0x43,
+    0x81, 0x4A, 0x5E, 0xAE, 0x36, 0x39, 0x15, 0x84, 0x58, 0xFB, 0xA1, 0x12, 0x85, 0x14, 0xFF, 0x22,
+    0xA9, 0x3F, 0xB2, 0xA3, 0x08, 0xE7, 0x8A, 0x5B, 0x46, 0xB3, 0x22, 0x53, 0x48, 0xE0, 0x45, 0xA0,
+    0x0C, 0x13, 0x34, 0x06, 0x5A, 0x91, 0x7B, 0x03, 0x6F, 0x57, 0xBC, 0xAD, 0x1C, 0x8F, 0x5B, 0x1E,
+    0x4B, 0x87, 0x5B, 0x08, 0xE6, 0x6E, 0x8D, 0xF2, 0x7F, 0xBF, 0x9D, 0xF2, 0xEA, 0x3D, 0xFB, 0x5A,
+    0x48, 0x66, 0xB3, 0xD4, 0x1D, 0x4D, 0x15, 0x86, 0x4A, 0x0E, 0xD8, 0x12, 0x92, 0x81, 0xBD, 0x20,
+    0xB3, 0xB4, 0x55, 0x49, 0x83, 0x18, 0xE5, 0xAD, 0xD3, 0x1D, 0x4B, 0xA9, 0x15, 0x88, 0xA5, 0x64,
+    0x08, 0x48, 0x65, 0x5A, 0x93, 0x84, 0xCE, 0xF7, 0x79, 0x8D, 0x1F, 0x59, 0x5E, 0x2B, 0x0A, 0x93,
+    0x6A, 0xA6, 0xA9, 0xDB, 0x65, 0xD6, 0x55, 0xF7, 0x2B, 0x52, 0x2D, 0xF7, 0xF3, 0x05, 0x4B, 0x80,
+    0x7D, 0xF2, 0x82, 0x76, 0x1E, 0x93, 0x88, 0xF0, 0x64, 0xFE, 0x28, 0x8D, 0xCB, 0x8F, 0xA9, 0xF7,
+    0x97, 0xDF, 0x45, 0x10, 0x22, 0x02, 0x9B, 0x39, 0x50, 0x3E, 0x9B, 0x63, 0x01, 0x2E, 0xF1, 0x7D,
+    0x28, 0x43, 0xEA, 0x0B, 0x33, 0x1B, 0x8C, 0x74, 0x64, 0x9A, 0x5A, 0xF2, 0xFC, 0xE7, 0x37, 0xA1,
+    0x2C, 0xEA, 0x5D, 0xF8, 0x55, 0x7E, 0xB3, 0x4A, 0x2D, 0x4D, 0xEC, 0x65, 0xFE, 0x56, 0xE3, 0xB7,
+    0xD6, 0x5B, 0x1A, 0x76, 0xA5, 0xBF, 0xFB, 0x89, 0x7C, 0x0E, 0x29, 0x08, 0xDC, 0x94, 0xFE, 0xA6,
+    0xE7, 0x4B, 0x97, 0x8A, 0x3B, 0xA5, 0xE8, 0x6D, 0x97, 0xEB, 0x38, 0xBE, 0xE1, 0xF3, 0xCC, 0xB0,
+    0xA9, 0xDC, 0x56, 0xA6, 0x59, 0x66, 0x7D, 0x29, 0x55, 0x49, 0x3E, 0xFA, 0x0B, 0x88, 0xB0, 0x5F,
+    0xF2, 0x2B, 0xF4, 0x5C, 0x1C, 0x90, 0x02, 0x9E, 0x42, 0xED, 0xB2, 0x0D, 0xDF, 0xBD, 0x39, 0x91,
+    0x06, 0x8A, 0x75, 0x4A, 0x37, 0xCF, 0x53, 0x8C, 0xC0, 0xE0, 0x31, 0xF1, 0x09, 0x5D, 0x3A, 0x56,
+    0x79, 0x13, 0xE2, 0x28, 0xC2, 0x9C, 0xB4, 0x54, 0x0D, 0x69, 0x14, 0x88, 0x05, 0xFA, 0x4F, 0x9F,
+    0xA3, 0x9B, 0x5F, 0xE1, 0xD1, 0x45, 0xC1, 0xC6, 0xAA, 0xBA, 0xF9, 0xA8, 0x6F, 0x57, 0xD8, 0x4E,
+    0xFD, 0xDD, 0xF3, 0xFA, 0xAC, 0xF5, 0x5D, 0x15, 0x0A, 0xFB, 0xEE, 0x35, 0x79, 0x2E, 0xFD, 0x27,
+    0x96, 0x97, 0x74, 0xBC, 0xDC, 0x5F, 0x0E, 0x10, 0xD7, 0x0A, 0xB1, 0xD7, 0xDE, 0x72, 0xFB, 0xD9,
+    0xBA, 0xA7, 0x6D, 0x45, 0xCF, 0xE4, 0xBB, 0x37, 0x22, 0x1F, 0x20, 0x75, 0x2F, 0xA5, 0x2F, 0x9F,
+    0x00, 0x76, 0x40, 0x7E, 0x31, 0x85, 0x4D, 0xE1, 0xC3, 0x30, 0x23, 0x7E, 0x15, 0x29, 0x2B, 0x09,
+    0x67, 0xDB, 0x1B, 0xE4, 0xBF, 0x64, 0xDE, 0xD9, 0xB4, 0x7B, 0x9C, 0xF6, 0xF8, 0x9F, 0x7E, 0x7F,
+    0x03, 0xDD, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x7D, 0xF6, 0x8A, 0xB3, 0x84, 0x8B, 0x6D, 0x69,
+    0xB8, 0xFD, 0x03, 0x28, 0xFE, 0x03, 0x77, 0x59, 0x8B, 0x96, 0x82, 0x2B, 0xB8, 0x1A, 0x7E, 0x01,
+    0x34, 0x94, 0x21, 0x36, 0x15, 0x7F, 0x23, 0x25, 0x1D, 0x14, 0x57, 0x42, 0xBC, 0x82, 0x92, 0x02,
+    0xA3, 0x14, 0x94, 0x31, 0x35, 0x8D, 0x83, 0x2C, 0xE1, 0x28, 0xB6, 0x87, 0x37, 0xB3, 0x26, 0x09,
+    0x54, 0x29, 0x11, 0xBE, 0x93, 0xBD, 0x1E, 0xEF, 0xCE, 0xBC, 0x79, 0xF3, 0x66, 0x3E, 0x00, 0x78,
+    0x84, 0x77, 0xA0, 0x97, 0x4B, 0x98, 0x6D, 0xE1, 0xFB, 0xBA, 0xB7, 0x45, 0x23, 0xAB, 0x3D, 0x11,
+    0x25, 0x1B, 0xD0, 0x4C, 0x78, 0xB3, 0xCB, 0xCF, 0x85, 0xF0, 0x9F, 0x27, 0xC6, 0x4A, 0xFA, 0x40,
+    0xC7, 0x5D, 0x6A, 0x76, 0xD0, 0x00, 0x69, 0x87, 0xD9, 0x2F, 0x40, 0x21, 0x4E, 0x7A, 0x69, 0x19,
+    0x78, 0xF3, 0x7B, 0xAD, 0x91, 0xEA, 0x35, 0xCE, 0x43, 0x6F, 0xA7, 0xE5, 0xAB, 0xCD, 0xE2, 0x3D,
+    0xD9, 0xBB, 0xA4, 0x8B, 0xEE, 0xE9, 0x9F, 0x66, 0x80, 0x0C, 0x32, 0xEA, 0xB3, 0x10, 0xD9, 0x33,
+    0x6C, 0x91, 0x0C, 0xCA, 0x8B, 0xE4, 0xD8, 0x7F, 0x7F, 0xA1, 0xE1, 0x3C, 0x73, 0x2E, 0x02, 0x17,
+    0x6B, 0x3E, 0x7B, 0xC8, 0x62, 0x86, 0xF8, 0x5C, 0x88, 0xAD, 0x94, 0x67, 0xF2, 0x44, 0xDD, 0x34,
+    0xE2, 0xE5, 0x03, 0x06, 0x70, 0xB2, 0xC4, 0xDD, 0x4B, 0x62, 0xE6, 0xEF, 0xCB, 0xDC, 0x48, 0x4F,
+    0x03, 0x5F, 0xA3, 0xC2, 0xE5, 0xF6, 0x16, 0x9F, 0xE8, 0xF3, 0x52, 0x39, 0xE3, 0xF5, 0x05, 0xFF,
+    0x72, 0x9C, 0x13, 0x5A, 0x8E, 0x5F, 0x0C, 0x3D, 0xDE, 0xF8, 0x0A, 0x29, 0x6C, 0x05, 0x51, 0xC6,
+    0x76, 0x98, 0x02, 0xDD, 0x1C, 0xA5, 0x14, 0x74, 0x53, 0x6C, 0x7E, 0xD3, 0x57, 0xB7, 0xC6, 0x5F,
+    0xD4, 0x6B, 0x3D, 0x8B, 0xBE, 0x22, 0xFC, 0xBA, 0x5A, 0x90, 0xF8, 0xCD, 0x53, 0x8B, 0xD9, 0x9D,
+    0x31, 0x4F, 0x08, 0xEE, 0x7C, 0x3D, 0x2B, 0x58, 0x8A, 0xA5, 0xCB, 0x6C, 0x34, 0x5B, 0x54, 0x92,
+    0x39, 0x1B, 0x7E, 0xDF, 0x75, 0xBB, 0x3F, 0xE2, 0x1F, 0x4C, 0x15, 0xF2, 0x9B, 0xFC, 0xC8, 0x42,
+    0x87, 0xC3, 0x1F, 0x5E, 0xDA, 0x52, 0xA6, 0xB8, 0x06, 0x79, 0x09, 0xF0, 0x1A, 0x91, 0xDF, 0xF4,
+    0xE6, 0x53, 0x4C, 0x70, 0x53, 0x93, 0x50, 0x2E, 0x81, 0xE7, 0x36, 0xBD, 0x3D, 0xF4, 0xF4, 0xD4,
+    0x7C, 0xA8, 0xEE, 0x7E, 0xA2, 0xEF, 0xEA, 0xC5, 0xA4, 0x61, 0x35, 0x8A, 0x85, 0xEE, 0x14, 0x48,
+    0xFC, 0x72, 0x18, 0xE1, 0xC7, 0x72, 0x63, 0x1A, 0x68, 0x7A, 0xB7, 0xA2, 0x9A, 0x41, 0xA0, 0x1B,
+    0x06, 0xEE, 0x50, 0xD7, 0x4D, 0x0A, 0xBA, 0xC3, 0x12, 0x55, 0xA0, 0x8A, 0x3E, 0x68, 0xED, 0xAC,
+    0x80, 0x51, 0x6F, 0x41, 0xDD, 0x15, 0x56, 0x87, 0x77, 0xCB, 0x09, 0xDF, 0x36, 0x70, 0x3F, 0xCC,
+    0xB8, 0x0C, 0xC0, 0xDD, 0x0C, 0xF7, 0x73, 0x8B, 0x4B, 0x6E, 0x18, 0x5A, 0x52, 0x30, 0x22, 0xD4,
+    0x13, 0x56, 0x37, 0xB9, 0x54, 0xA5, 0x40, 0xEC, 0x2B, 0x1E, 0xB8, 0xD1, 0x11, 0x13, 0x37, 0x17,
+    0x74, 0xCD, 0x64, 0x1D, 0x37, 0xBF, 0xA5, 0xBE, 0x6A, 0xA3, 0x88, 0x04, 0x25, 0x95, 0x87, 0xA8,
+    0x06, 0x4B, 0x85, 0xDC, 0x13, 0x0D, 0xEB, 0x12, 0x15, 0x51, 0xB9, 0x99, 0x61, 0x52, 0xC4, 0xB1,
+    0xA5, 0xC1, 0x0A, 0xD6, 0x2B, 0xD4, 0xD7, 0x0D, 0xED, 0x69, 0xE8, 0x35, 0x89, 0xFD, 0x34, 0xA8,
+    0x8F, 0x44, 0xA7, 0x90, 0x8F, 0x4A, 0x69, 0x2B, 0x19, 0x9B, 0x8D, 0xD5, 0x51, 0x08, 0xB9, 0x34,
+    0x26, 0x73, 0xB7, 0xBF, 0x6A, 0x32, 0x63, 0xFE, 0xE2, 0x6B, 0x2B, 0x17, 0x09, 0x23, 0x7F, 0xBE,
+    0xBD, 0x23, 0x72, 0x32, 0x57, 0xCC, 0xB8, 0x66, 0xEA, 0x57, 0x6E, 0xC4, 0x77, 0x55, 0xC2, 0x52,
+    0xB3, 0x73, 0x7D, 0x5F, 0x4E, 0xBE, 0x75, 0x63, 0x40, 0x95, 0xE2, 0x4D, 0xEC, 0xE3, 0xF4, 0xD8,
+    0x7C, 0x06, 0x32, 0x45, 0xF0, 0xF8, 0x9E, 0x29, 0xD3, 0x59, 0xF9, 0xC8, 0x98, 0x65, 0xED, 0x08,
+    0x0F, 0x07, 0x54, 0x63, 0xD5, 0xF2, 0xD2, 0x96, 0x2C, 0xEE, 0xA1, 0x7A, 0x53, 0x33, 0x58, 0x8D,
+    0xD3, 0x26, 0xDA, 0xA7, 0x56, 0x10, 0x36, 0x73, 0xC3, 0x0A, 0x51, 0xDC, 0x62, 0x88, 0xAB, 0xE3,
+    0xF6, 0xF6, 0x33, 0xDA, 0xC8, 0x1A, 0xC9, 0xD3, 0xFB, 0xA1, 0x4D, 0xA9, 0x7C, 0x86, 0x57, 0x36,
+    0x81, 0xA3, 0x5B, 0xBF, 0x5A, 0xFD, 0xBA, 0x09, 0x03, 0xD5, 0x23, 0xAD, 0x53, 0xA2, 0x45, 0xCD,
+    0xE8, 0xA8, 0x82, 0x91, 0xB6, 0x39, 0x0B, 0xD6, 0x5A, 0xC7, 0x67, 0x15, 0x0F, 0x73, 0x6E, 0x5A,
+    0x1B, 0x0D, 0xB9, 0x95, 0xBB, 0xAC, 0xF3, 0xDB, 0xD6, 0x94, 0x59, 0xCE, 0xA4, 0xE2, 0x3E, 0x1E,
+    0xC0, 0x8D, 0x3E, 0xF1, 0x41, 0xAE, 0x12, 0x13, 0x5F, 0xCB, 0x19, 0xA1, 0x8F, 0x94, 0x69, 0x35,
+    0x91, 0x84, 0x81, 0xEA, 0xF7, 0x8A, 0x8E, 0x68, 0x46, 0x42, 0xDB, 0x4A, 0x22, 0x4C, 0xB1, 0x75,
+    0x2B, 0x65, 0x18, 0xC7, 0x01, 0x95, 0x89, 0x2C, 0xE9, 0x20, 0x32, 0x58, 0x84, 0xC1, 0x28, 0x05,
+    0xFE, 0x53, 0xD4, 0x8D, 0xAF, 0x53, 0xB7, 0x65, 0xEA, 0xE6, 0x4C, 0x5D, 0x9F, 0xA7, 0x8F, 0xF5,
+    0x86, 0xCF, 0xA3, 0x2F, 0x8E, 0x99, 0xCE, 0x3C, 0x10, 0x4D, 0x69, 0x59, 0x6A, 0x0A, 0xE9, 0xDF,
+    0x13, 0xFD, 0x3E, 0x89, 0xC4, 0xC2, 0xF9, 0x4F, 0x51, 0xB1, 0xDD, 0x41, 0x9D, 0xAD, 0xA8, 0x53,
+    0xC5, 0x4C, 0xD0, 0x68, 0xC7, 0x50, 0x87, 0xA3, 0x51, 0xD9, 0xE8, 0x44, 0xD5, 0x29, 0xA2, 0x68,
+    0x5B, 0xE5, 0x12, 0x8F, 0xD9, 0xCC, 0xEC, 0xA6, 0xA6, 0xE7, 0x34, 0xD8, 0xD9, 0xD0, 0xCA, 0x41,
+    0xEE, 0x62, 0x95, 0x5F, 0x61, 0xF3, 0x5D, 0x03, 0x3F, 0x84, 0x51, 0x89, 0xE2, 0x06, 0x6F, 0xDF,
+    0xB0, 0xEF, 0x77, 0xF6, 0xA8, 0x4F, 0x9B, 0x4E, 0xBA, 0xC4, 0xD3, 0x2B, 0x5B, 0x92, 0xED, 0x19,
+    0x89, 0xA4, 0x9A, 0xEE, 0xF1, 0x33, 0x2B, 0x1B, 0xD2, 0x35, 0x6B, 0xE3, 0x96, 0x0B, 0xFE, 0x92,
+    0x28, 0x37, 0xDD, 0x31, 0x68, 0x5B, 0xCC, 0x59, 0xD6, 0x3C, 0x0D, 0xED, 0x37, 0xD2, 0x4B, 0x02,
+    0xCA, 0xE5, 0x8C, 0xE8, 0xFE, 0xF1, 0x59, 0x5F, 0xEE, 0x9D, 0x83, 0xE3, 0x02, 0x17, 0x65, 0x72,
+    0x69, 0xC2, 0xF4, 0x39, 0xEE, 0xDE, 0xC3, 0x95, 0x87, 0x77, 0xA9, 0xEE, 0xA7, 0x6A, 0xBC, 0xFE,
+    0x78, 0x56, 0x7D, 0x0D, 0x9F, 0xF2, 0x54, 0xAB, 0x70, 0x19, 0x43, 0x9B, 0x9E, 0xA7, 0xAF, 0x74,
+    0xDC, 0xFF, 0xEF, 0xAE, 0xBF, 0x00, 0xC5, 0x95, 0xBF, 0x8E, 0xDF, 0x44, 0x10, 0xC7, 0xC7, 0x5E,
+    0xDD, 0x59, 0xC8, 0xC5, 0x56, 0x91, 0xE8, 0xB6, 0x45, 0x28, 0x91, 0xDB, 0x14, 0x88, 0x75, 0x97,
+    0x17, 0xC8, 0xAF, 0xC9, 0x1B, 0x20, 0x8A, 0x7B, 0x01, 0x38, 0xAF, 0xC2, 0x0B, 0x5C, 0x43, 0x4D,
+    0x8A, 0x54, 0x69, 0xD2, 0xA4, 0xA0, 0x80, 0xB3, 0x93, 0x3C, 0x40, 0x2C, 0x22, 0xEA, 0x58, 0x90,
+    0x26, 0x34, 0x2C, 0x60, 0xC0, 0x90, 0xB5, 0x27, 0xF3, 0x9D, 0xF5, 0x2F, 0x14, 0x91, 0x92, 0x0A,
+    0x65, 0xEF, 0xFC, 0x67, 0xC7, 0x3F, 0xEF, 0xCE, 0x7C, 0xBE, 0x33, 0x63, 0xA2, 0x7B, 0x81, 0xE8,
+    0xE3, 0x3B, 0x64, 0xB8, 0xA5, 0x82, 0x07, 0x72, 0x1B, 0x91, 0x95, 0x83, 0x17, 0xA2, 0x7E, 0x16,
+    0x73, 0xA4, 0x0A, 0x66, 0x39, 0x3C, 0x8B, 0x89, 0xA9, 0xE4, 0x24, 0xE6, 0x24, 0xA6, 0x89, 0xDC,
+    0xB3, 0x99, 0xB8, 0x6F, 0xE9, 0xB2, 0x9B, 0xEA, 0x7F, 0x57, 0x32, 0x0B, 0x87, 0xEE, 0x49, 0x24,
+    0xF7, 0x94, 0xCD, 0xDA, 0x0D, 0xD4, 0xDB, 0xD4, 0xFC, 0xB4, 0x91, 0x49, 0xFE, 0x37, 0xB6, 0x0B,
+    0xB9, 0xA9, 0x7F, 0x36, 0x77, 0x23, 0xF5, 0xB7, 0x99, 0x1F, 0x31, 0x99, 0xB5, 0xE2, 0x64, 0x65,
+    0xA1, 0x68, 0x79, 0xEA, 0x22, 0xF5, 0x83, 0xE7, 0x92, 0x83, 0xD9, 0x88, 0x67, 0xBB, 0x92, 0x9D,
+    0x8D, 0xAC, 0x26, 0xE6, 0xB1, 0x4E, 0x25, 0x0F, 0x86, 0xA9, 0x19, 0x2D, 0x93, 0xBC, 0x40, 0xD4,
+    0x2D, 0xD4, 0x4F, 0x24, 0xAE, 0x8C, 0xA4, 0xA3, 0x89, 0xF9, 0xCA, 0x41, 0x2F, 0x55, 0xCA, 0x53,
+    0x3F, 0xED, 0xE6, 0x7C, 0xB1, 0x73, 0xBE, 0x8A, 0x67, 0x18, 0x66, 0xA5, 0xFF, 0x86, 0x1B, 0xA8,
+    0x69, 0x6D, 0xA4, 0x66, 0x10, 0xB3, 0x8D, 0x05, 0xB7, 0xB2, 0x11, 0x4F, 0xD5, 0x46, 0x9F, 0x26,
+    0x61, 0xE3, 0x3A, 0xF3, 0xF7, 0x58, 0x7F, 0xF3, 0xF0, 0xAF, 0x68, 0x7E, 0x8E, 0x29, 0x15, 0xF3,
+    0x9A, 0xCE, 0xE9, 0x3B, 0xBF, 0xF9, 0xE0, 0x6B, 0xB6, 0xA3, 0xBB, 0xCD, 0x37, 0x62, 0x3D, 0x76,
+    0x5F, 0x25, 0x33, 0xBB, 0x81, 0x8B, 0x54, 0x5E, 0x74, 0xA1, 0x17, 0x07, 0xD4, 0x3F, 0xDD, 0xA7,
+    0x53, 0x3F, 0x5B, 0xB8, 0x81, 0xED, 0x6B, 0x3C, 0x29, 0x2F, 0x88, 0x4E, 0xDA, 0x6A, 0x2A, 0x67,
+    0x4A, 0xE4, 0xC9, 0x85, 0x7A, 0x34, 0x51, 0x6E, 0xCF, 0xE1, 0xCB, 0x60, 0x62, 0xB1, 0xD0, 0xF7,
+    0xE4, 0xE5, 0xB6, 0xDA, 0x6F, 0x73, 0x18, 0x54, 0xE0, 0xE5, 0x48, 0x9F, 0xE8, 0x62, 0x0E, 0x31,
+    0x77, 0x8C, 0x50, 0x4B, 0xA8, 0x46, 0x74, 0x7A, 0x97, 0xDE, 0x3E, 0xB6, 0x0C, 0x4D, 0xE9, 0x98,
+    0x0C, 0x87, 0x95, 0xA0, 0xEB, 0xD5, 0xF4, 0x87, 0x4E, 0x56, 0x0F, 0x6F, 0xDD, 0x63, 0x50, 0x33,
+    0x51, 0x27, 0x97, 0xE5, 0xA2, 0xAC, 0x1A, 0xD9, 0xD3, 0xCC, 0x25, 0x30, 0xF7, 0x82, 0x0C, 0xA6,
+    0x42, 0x26, 0x66, 0x01, 0x47, 0x31, 0x15, 0x12, 0xB2, 0x1D, 0xF1, 0x6F, 0x98, 0x79, 0x43, 0xDE,
+    0xB0, 0x78, 0x68, 0x75, 0x02, 0x93, 0x6C, 0xD7, 0x05, 0x08, 0x23, 0xC8, 0xE5, 0x28, 0x37, 0x55,
+    0x09, 0xC2, 0x38, 0x6C, 0x57, 0x4C, 0x74, 0x55, 0xCE, 0x91, 0xAE, 0xCB, 0x79, 0x29, 0xE1, 0x0E,
+    0xAB, 0xD6, 0x9E, 0xDB, 0x77, 0x05, 0xD8, 0x64, 0x12, 0x2B, 0x16, 0xC6, 0xA6, 0x22, 0x02, 0x4C,
+    0x1D, 0xBC, 0xA1, 0x05, 0xF4, 0x65, 0x3D, 0x39, 0x9B, 0x11, 0xE7, 0x4A, 0x72, 0x3B, 0x90, 0x0D,
+    0xE4, 0xE5, 0xDC, 0x92, 0xE4, 0xB2, 0x0D, 0x40, 0x62, 0xFF, 0xBC, 0xCF, 0xBA, 0x80, 0x9C, 0x6B,
+    0x0D, 0xC1, 0xF0, 0x76, 0x8E, 0x78, 0x9F, 0x7F, 0x99, 0x73, 0x6C, 0x54, 0x09, 0x37, 0x55, 0xB7,
+    0x19, 0x9B, 0x11, 0x09, 0x65, 0x34, 0x39, 0x87, 0x7E, 0x78, 0x2B, 0x7E, 0xAB, 0xE0, 0xCB, 0xAC,
+    0x82, 0x57, 0xD6, 0x56, 0x55, 0x28, 0x5E, 0xEA, 0xC4, 0xAB, 0xCE, 0xF6, 0xA9, 0x92, 0x48, 0x0A,
+    0xDE, 0x1B, 0x4C, 0xEA, 0x09, 0xE0, 0x25, 0xBB, 0xA0, 0x82, 0x6F, 0x01, 0xBE, 0x8E, 0x50, 0x41,
+    0xE0, 0x03, 0xBC, 0x0F, 0x50, 0xA1, 0x96, 0x02, 0x1C, 0x35, 0xEB, 0x56, 0x00, 0x03, 0x83, 0x3A,
+    0xAB, 0xC0, 0x3A, 0x81, 0x89, 0xA9, 0x5A, 0x00, 0x5E, 0x4B, 0x83, 0x95, 0x99, 0x8D, 0x28, 0x9B,
+    0x42, 0x01, 0x5F, 0xCA, 0xDF, 0x1E, 0x5B, 0xB9, 0x96, 0xEB, 0x31, 0xB4, 0x2A, 0x1D, 0x2B, 0xEB,
+    0xBD, 0x20, 0xD7, 0x71, 0xA5, 0xD5, 0x44, 0x95, 0x5F, 0xA5, 0x9C, 0xBE, 0x32, 0x14, 0x37, 0x6E,
+    0x9E, 0x2B, 0xBE, 0x63, 0x57, 0xA8, 0x7F, 0xDD, 0xBD, 0x2D, 0xFE, 0xD9, 0x1B, 0x03, 0x75, 0x6E,
+    0xEF, 0x01, 0xF6, 0xE1, 0xDE, 0x14, 0xA4, 0x60, 0xF7, 0x2E, 0xB1, 0x96, 0xDB, 0xE1, 0x33, 0x0D,
+    0x27, 0x34, 0x79, 0xCD, 0x2A, 0x96, 0x79, 0x1B, 0xC1, 0x2A, 0xD4, 0x82, 0x52, 0x37, 0xE9, 0x28,
+    0x62, 0xA7, 0x8B, 0x8A, 0x18, 0x56, 0xCB, 0x8E, 0xFA, 0x5F, 0xEE, 0xE5, 0x7D, 0xE0, 0xDD, 0xF2,
+    0xDA, 0xBB, 0x70, 0xF4, 0x4E, 0x23, 0xF3, 0x02, 0x20, 0x6B, 0x32, 0x6B, 0x59, 0x6C, 0x82, 0x3C,
+    0x47, 0x3D, 0x69, 0xFE, 0x67, 0xA5, 0xDE, 0x1C, 0x92, 0x2E, 0xE5, 0xD6, 0x82, 0xF2, 0xEF, 0xBB,
+    0x94, 0x5B, 0xFB, 0x00, 0xA0, 0xA5, 0x91, 0x4A, 0x7F, 0x20, 0x71, 0xF8, 0x1A, 0x58, 0xC7, 0xE2,
+    0xF3, 0xB1, 0xC9, 0xCF, 0x81, 0x5B, 0xAE, 0xE3, 0x17, 0x52, 0x8F, 0x37, 0x69, 0x27, 0x4E, 0x34,
+    0x53, 0x0D, 0xE7, 0x00, 0x1D, 0x41, 0xF2, 0x2D, 0xB8, 0x18, 0xAC, 0xFA, 0x97, 0xB4, 0x52, 0x19,
+    0xED, 0x76, 0xEB, 0x10, 0x44, 0xBD, 0xDD, 0xF8, 0xA1, 0x07, 0xD6, 0x8F, 0xE8, 0x14, 0xAD, 0xC7,
+    0x40, 0x45, 0x59, 0x98, 0x54, 0x67, 0xA7, 0x6D, 0xA7, 0x0F, 0x6F, 0x78, 0x5B, 0x1C, 0x0E, 0x07,
+    0x75, 0x62, 0x90, 0xD6, 0x24, 0xC5, 0x9E, 0x33, 0x5A, 0x99, 0x6A, 0xAE, 0xA8, 0x0A, 0x0A, 0x52,
+    0x9F, 0xB8, 0x1F, 0x0F, 0x37, 0xA1, 0xF9, 0xAA, 0xC4, 0xF6, 0x27, 0xE7, 0xAA, 0xC5, 0xEB, 0x17,
+    0xCD, 0xA4, 0x4A, 0x1E, 0x0E, 0x2D, 0x7C, 0x8C, 0x10, 0x64, 0x01, 0xE9, 0x55, 0xB3, 0x1B, 0x3F,
+    0xBB, 0x43, 0x1F, 0xA0, 0x2D, 0x5E, 0x45, 0xCE, 0x7D, 0x0B, 0xB8, 0x11, 0xC9, 0x20, 0xCE, 0xD5,
+    0x0B, 0xBD, 0x6B, 0x9C, 0xC9, 0xEA, 0x15, 0xB4, 0x96, 0x8F, 0x0C, 0xB6, 0xAE, 0xDA, 0x42, 0xBE,
+    0x7E, 0x83, 0x99, 0x4E, 0xEE, 0x0F, 0x58, 0x7F, 0x00, 0x9F, 0xE0, 0xBE, 0x6E, 0x77, 0x97, 0xD4,
+    0x6D, 0xC5, 0xD9, 0xCC, 0xF4, 0x21, 0xFC, 0x58, 0x00, 0x1B, 0x5F, 0x4C, 0x6C, 0x7B, 0x26, 0x52,
+    0xD1, 0x29, 0x5F, 0xE4, 0xA9, 0xD5, 0x7E, 0x27, 0xC4, 0x8A, 0x50, 0x68, 0x6F, 0xE8, 0x8E, 0xE1,
+    0x4B, 0xBB, 0xA7, 0x93, 0xB3, 0x20, 0x01, 0xC9, 0x57, 0x86, 0x5F, 0xC6, 0xFA, 0x45, 0xEB, 0xDA,
+    0x6B, 0x08, 0xE0, 0x3A, 0x8A, 0xE4, 0x01, 0xAA, 0x94, 0x51, 0x92, 0x67, 0x17, 0xF4, 0x7F, 0x8C,
+    0x57, 0xB5, 0x55, 0x31, 0xAE, 0xDE, 0x44, 0x10, 0x9E, 0xF5, 0x02, 0x96, 0xB2, 0xC5, 0x36, 0xA4,
+    0xA1, 0x71, 0x43, 0x49, 0xE4, 0x96, 0x02, 0xB1, 0x16, 0xB9, 0x00, 0x05, 0x4A, 0xCB, 0x01, 0x28,
+    0xDE, 0x05, 0x10, 0x36, 0x7A, 0x07, 0xC8, 0xBB, 0x01, 0x15, 0x52, 0x94, 0x86, 0x86, 0x32, 0x2F,
+    0x5E, 0x41, 0x41, 0x89, 0x15, 0x0E, 0x10, 0x23, 0x2A, 0xAA, 0x6C, 0xE1, 0x08, 0x27, 0x59, 0x7B,
+    0xF8, 0x66, 0xD6, 0x7E, 0x28, 0x50, 0x90, 0x02, 0x76, 0x7F, 0xCF, 0x6F, 0x7B, 0x67, 0x77, 0x66,
+    0xBE, 0xF9, 0x66, 0x4C, 0x84, 0x61, 0xC6, 0x95, 0x0C, 0xF3, 0x4A, 0x2D, 0xF3, 0x5C, 0x31, 0x33,
+    0xBD, 0x4F, 0xCD, 0x8A, 0x85, 0x30, 0x60, 0x51, 0x6E, 0x9A, 0x81, 0xCC, 0xBD, 0x25, 0x60, 0xC9,
+    0xE2, 0x9A, 0xC2, 0xB7, 0x94, 0x6D, 0xA4, 0x96, 0x3E, 0x20, 0x37, 0xD1, 0xEC, 0x16, 0xAA, 0x39,
+    0x13, 0xB9, 0x17, 0x74, 0x0E, 0xBB, 0xD8, 0x05, 0xDB, 0xA6, 0x26, 0x12, 0x31, 0x26, 0xD5, 0xB9,
+    0x86, 0x46, 0x3B, 0xB7, 0x33, 0xBD, 0xE9, 0x78, 0x87, 0xAF, 0x70, 0x10, 0x73, 0x22, 0xF2, 0x2A,
+    0x7B, 0xB8, 0x47, 0x66, 0x30, 0x63, 0x94, 0xE5, 0x5E, 0x95, 0xB2, 0x5A, 0xC3, 0x22, 0xBD, 0x7D,
+    0x31, 0xD0, 0xC8, 0xF0, 0x03, 0x5B, 0x5E, 0x25, 0x72, 0xBF, 0x77, 0x4D, 0x47, 0x77, 0x88, 0xE0,
+    0xFF, 0x87, 0x12, 0x00, 0x7D, 0x5F, 0x4B, 0x28, 0xCC, 0x1D, 0xE4, 0xC5, 0xD5, 0x8D, 0x19, 0x89,
+    0x9E, 0x1A, 0xE6, 0x41, 0xC3, 0x17, 0x91, 0xCE, 0xF8, 0xAD, 0x08, 0x73, 0x0A, 0x73, 0x2F, 0x49,
+    0xF4, 0x2A, 0x26, 0xFB, 0xF2, 0x53, 0x1F, 0x15, 0x03, 0x88, 0x6B, 0x32, 0x05, 0x04, 0x6C, 0xF5,
+    0xAF, 0x20, 0x9A, 0xB9, 0x99, 0x29, 0xCC, 0x61, 0xA6, 0xDB, 0xDD, 0xED, 0x4E, 0xCD, 0x5C, 0x63,
+    0xFE, 0x85, 0x0C, 0x46, 0x3B, 0xB5, 0x1A, 0x47, 0xC1, 0x07, 0xC3, 0x65, 0x97, 0xDF, 0x0C, 0x19,
+    0x9B, 0xA9, 0xC7, 0x2F, 0x92, 0x5B, 0x0C, 0xCF, 0x02, 0x6C, 0x93, 0x1C, 0x77, 0x01, 0xE7, 0x85,
+    0xA9, 0xCD, 0x76, 0x13, 0x78, 0x22, 0xCF, 0x61, 0x92, 0xE3, 0x2D, 0x7F, 0xB2, 0xE3, 0xBF, 0xDA,
+    0x7D, 0x56, 0xF4, 0x6D, 0x0E, 0xBF, 0xAA, 0x45, 0xB7, 0xF0, 0xE7, 0x82, 0x1C, 0x35, 0x7F, 0x6C,
+    0xC5, 0x85, 0xF0, 0x8C, 0x8B, 0x73, 0x7D, 0x81, 0x49, 0xE0, 0x5A, 0x8B, 0x49, 0xE6, 0xE2, 0x6D,
+    0x38, 0x56, 0x04, 0x85, 0xF3, 0x85, 0xDE, 0x20, 0x7A, 0xDE, 0x8F, 0xBD, 0xE3, 0xA6, 0x2F, 0x7E,
+    0xDE, 0x7B, 0x89, 0x68, 0xCC, 0xFD, 0x22, 0xC7, 0x38, 0xFE, 0x91, 0x9F, 0x88, 0x01, 0xDE, 0x3C,
+    0xDF, 0x15, 0xAC, 0x78, 0x1A, 0xB3, 0x03, 0xE8, 0xBC, 0x59, 0x4E, 0x78, 0x2A, 0xC9, 0xD4, 0x74,
+    0x52, 0x1B, 0x0B, 0x3E, 0x07, 0x3C, 0x27, 0x3A, 0xAD, 0xA0, 0xFA, 0x6F, 0xC3, 0x3C, 0xA0, 0x87,
+    0xC3, 0xAD, 0x81, 0xEA, 0x54, 0xEF, 0x04, 0xA7, 0xFC, 0xDC, 0x2E, 0x1E, 0xDB, 0x9A, 0xC8, 0x51,
+    0x7C, 0x0C, 0x77, 0x37, 0x79, 0xA4, 0xD1, 0x27, 0x79, 0x34, 0xB9, 0xBF, 0xAF, 0xC8, 0xBC, 0xDC,
+    0x34, 0x02, 0x27, 0x44, 0x20, 0xA1, 0xDD, 0x7E, 0x84, 0xA8, 0x8F, 0x46, 0x48, 0x22, 0x2E, 0x14,
+    0x08, 0x4E, 0x04, 0xFA, 0x12, 0x77, 0xCD, 0xE3, 0x53, 0x09, 0x7B, 0xFC, 0x8D, 0x5B, 0x78, 0xEA,
+    0xF7, 0x26, 0x07, 0xA9, 0xAB, 0x19, 0x73, 0xA1, 0x76, 0xB7, 0xFC, 0xB5, 0x90, 0x98, 0x02, 0x66,
+    0x09, 0xCE, 0x27, 0x0F, 0x9E, 0xAE, 0x6E, 0x25, 0xBB, 0x6B, 0xCE, 0xFE, 0x16, 0xC4, 0x88, 0x7A,
+    0xAA, 0x94, 0xF9, 0xFB, 0x43, 0xB5, 0xE4, 0x05, 0x90, 0x4A, 0x33, 0xF4, 0x48, 0xFD, 0x52, 0xD1,
+    0x81, 0x99, 0x70, 0xA8, 0x52, 0x2F, 0x8A, 0x6B, 0xCA, 0xF4, 0xB2, 0x5C, 0xEB, 0x9E, 0x74, 0x53,
+    0x2B, 0x3B, 0xB9, 0xA1, 0x62, 0x75, 0x7E, 0x20, 0x15, 0x41, 0x84, 0x1A, 0x3B, 0x47, 0xC6, 0x34,
+    0xB9, 0x42, 0x29, 0x65, 0x50, 0x4D, 0x4B, 0xD7, 0xAF, 0x7E, 0xFD, 0x87, 0x87, 0x62, 0xAA, 0x17,
+    0xC7, 0xAF, 0x9C, 0x66, 0xAE, 0x3B, 0x85, 0x3E, 0xDE, 0x11, 0x17, 0x04, 0xB8, 0x2F, 0xD4, 0xFA,
+    0x97, 0x22, 0x3E, 0x3A, 0xEF, 0x24, 0x8A, 0x50, 0x8A, 0x1A, 0x0E, 0x5E, 0xDC, 0x18, 0xF7, 0x52,
+    0x5B, 0xAC, 0x2C, 0x7C, 0xA4, 0xDE, 0x92, 0x81, 0x81, 0x6A, 0x53, 0xD2, 0x53, 0x8D, 0xF7, 0x76,
+    0x87, 0x05, 0x65, 0x65, 0xDB, 0x1D, 0xA5, 0x9F, 0x8F, 0x76, 0x10, 0x06, 0x1B, 0xC3, 0xE4, 0x4A,
+    0x8D, 0x26, 0xE4, 0x29, 0x21, 0xAE, 0x93, 0x2D, 0x48, 0x93, 0xF4, 0x07, 0xDC, 0x7D, 0x85, 0x6B,
+    0x2B, 0x87, 0xB5, 0x13, 0x69, 0x77, 0x92, 0x16, 0x20, 0xFC, 0x80, 0xBD, 0xF7, 0x24, 0xC9, 0x82,
+    0x74, 0x3D, 0x95, 0xCB, 0x4F, 0x92, 0x2F, 0xD7, 0x8D, 0x83, 0x1C, 0xD1, 0x03, 0xE6, 0x06, 0xE6,
+    0x2B, 0x3E, 0x5A, 0xC8, 0x5B, 0xB8, 0x6E, 0x29, 0x61, 0xAA, 0x42, 0x84, 0xA3, 0xE0, 0x75, 0x34,
+    0x4A, 0xE9, 0x4A, 0x5A, 0x5F, 0x22, 0xD4, 0x27, 0xE8, 0x28, 0x4D, 0x05, 0x4C, 0xEF, 0x3B, 0x0A,
+    0x80, 0x55, 0x8A, 0x00, 0x79, 0xC0, 0xDE, 0x45, 0x3C, 0xE8, 0x59, 0x94, 0x3D, 0x8B, 0xB2, 0xDD,
+    0x54, 0x99, 0x5B, 0x51, 0x6E, 0x7F, 0x11, 0xE5, 0x7A, 0x45, 0xD1, 0xB3, 0xD9, 0x41, 0x99, 0x66,
+    0x0E, 0x91, 0xBB, 0x6A, 0xF3, 0xA9, 0x81, 0xF2, 0x0F, 0x9B, 0xE4, 0x34, 0xF7, 0x1D, 0x00, 0x1F,
+    0xBF, 0x99, 0xEB, 0x0D, 0x7D, 0x28, 0x13, 0xA0, 0x85, 0xC7, 0x3E, 0xC3, 0xE1, 0x68, 0x78, 0x10,
+    0x1B, 0x01, 0x3F, 0x1C, 0x2B, 0x04, 0x40, 0xBB, 0x4C, 0x67, 0x04, 0xDF, 0xB1, 0xBC, 0x84, 0x30,
+    0x9F, 0xBD, 0x96, 0xE1, 0x77, 0x0B, 0xD7, 0x80, 0xFD, 0x0A, 0xA6, 0x12, 0x78, 0xBC, 0x98, 0x44,
+    0xD7, 0xA9, 0x4A, 0xE6, 0x79, 0xB2, 0x73, 0xFD, 0x64, 0xB6, 0x53, 0x73, 0x39, 0xD5, 0xF1, 0xE3,
+    0x3A, 0xBA, 0x98, 0x5D, 0xF4, 0x97, 0xC9, 0x0F, 0xFE, 0x7E, 0x6C, 0x86, 0xE6, 0x02, 0x09, 0x6A,
+    0xAF, 0x85, 0xEF, 0x0B, 0xB2, 0xD3, 0x4F, 0xF4, 0x98, 0xC6, 0x81, 0x94, 0xE7, 0x8F, 0x31, 0xA5,
+    0x2A, 0x05, 0xDA, 0x6A, 0x93, 0xEC, 0xA2, 0x71, 0x49, 0xFB, 0x2A, 0x9F, 0x89, 0x63, 0x3C, 0x28,
+    0x7D, 0x32, 0x92, 0xD9, 0x35, 0xFB, 0x88, 0x0D, 0x5F, 0x24, 0xBF, 0x49, 0xE6, 0x2C, 0x62, 0x1B,
+    0xA5, 0xB5, 0x08, 0x84, 0x0D, 0x0F, 0x50, 0xA9, 0xA5, 0xCC, 0x26, 0x89, 0x18, 0xCA, 0xE1, 0x29,
+    0x94, 0xA3, 0x7B, 0x0E, 0xE5, 0xB5, 0xDA, 0x82, 0x28, 0xF7, 0x97, 0x59, 0x4B, 0x6E, 0x84, 0xB2,
+    0xCD, 0x5E, 0x94, 0xD9, 0x88, 0x32, 0x3A, 0x31, 0x20, 0xFC, 0x69, 0xB5, 0x38, 0xE3, 0xC5, 0x2E,
+    0x9E, 0xF2, 0x18, 0x5D, 0x49, 0x83, 0x00, 0xB7, 0xC9, 0xD7, 0xA0, 0xE5, 0xCE, 0xCA, 0x0F, 0xC7,
+    0x26, 0xC9, 0x9C, 0xE3, 0x12, 0x08, 0x7C, 0xDF, 0x40, 0x51, 0x44, 0x71, 0x53, 0x2E, 0xAF, 0xB5,
+    0xF1, 0xFF, 0x09, 0xC1, 0xFF, 0x68, 0xFC, 0x09, 0xCD, 0x95, 0x3D, 0x6E, 0xD5, 0x40, 0x14, 0x85,
+    0xAF, 0x6D, 0x12, 0x4B, 0x71, 0x31, 0x1D, 0x0D, 0xC5, 0xF4, 0x20, 0xE1, 0x1D, 0x60, 0x2F, 0x21,
+    0x0D, 0x15, 0x8B, 0xC8, 0x06, 0x08, 0x63, 0x89, 0x0D, 0xA4, 0x80, 0x2D, 0x20, 0xC1, 0x1A, 0x92,
+    0x37, 0x86, 0x15, 0x78, 0x09, 0x16, 0x3F, 0x4D, 0x1A, 0x5C, 0x58, 0xE2, 0x45, 0x8C, 0x3D, 0x9C,
+    0x73, 0xED, 0xBC, 0x3C, 0x29, 0x41, 0x49, 0x85, 0xB0, 0xA3, 0x19, 0xC5, 0x1E, 0xDF, 0xF9, 0xEE,
+    0xB9, 0xE7, 0xCE, 0x13, 0x91, 0xB2, 0x29, 0x1B, 0x11, 0xA9, 0xEA, 0xAA, 0xC6, 0xE4, 0x6B, 0xCF,
+    0x29, 0xE2, 0x16, 0x49, 0x62, 0xC2, 0xE9, 0xEE, 0xEB, 0x24, 0xF2, 0xB3, 0x22, 0xC6, 0x2D, 0x26,
+    0x17, 0x7D, 0xE4, 0xFA, 0x2E, 0xC5, 0xD3, 0x7C, 0x46, 0x9C, 0x56, 0xCC, 0x88, 0xA8, 0x9D, 0x54,
+    0x3D, 0xF6, 0xE8, 0xC5, 0x61, 0xB5, 0xED, 0x35, 0xAC, 0xE9, 0x93, 0x89, 0x53, 0x97, 0x85, 0x65,
+    0xC2, 0x42, 0xB1, 0x6D, 0x3E, 0x60, 0x2A, 0xDB, 0x62, 0x50, 0x1A, 0xD3, 0x33, 0xAC, 0xE8, 0x14,
+    0xC5, 0xE0, 0x61, 0x36, 0x89, 0xC1, 0x5E, 0x36, 0x88, 0x89, 0xC7, 0x8F, 0xE3, 0x88, 0x09, 0xD7,
+    0x40, 0x84, 0x18, 0x5B, 0xC9, 0x38, 0xD5, 0x92, 0x62, 0x0C, 0x4A, 0x14, 0xF9, 0xE9, 0x61, 0xBC,
+    0xDA, 0x87, 0x0E, 0xB8, 0xD3, 0x90, 0x06, 0xC9, 0x42, 0xB6, 0x95, 0x62, 0x5B, 0x6C, 0x11, 0x93,
+    0xA0, 0x77, 0x5C, 0x89, 0x3F, 0xC3, 0x6E, 0x0C, 0xE6, 0x9A, 0x37, 0x92, 0x04, 0xB1, 0x92, 0x0D,
+    0x62, 0xEA, 0xA2, 0xC3, 0x60, 0x5A, 0xB1, 0xB5, 0xAD, 0xA5, 0xC4, 0x2D, 0x15, 0x6E, 0xB9, 0x00,
+    0x34, 0x02, 0x57, 0x97, 0x7E, 0x2B, 0x25, 0x37, 0x37, 0xA4, 0xCA, 0xE3, 0x4C, 0x55, 0xBF, 0xEF,
+    0xA2, 0x1E, 0x2A, 0x96, 0xE3, 0xE3, 0x54, 0xB9, 0xCD, 0xFC, 0xDE, 0xAB, 0x4A, 0xC8, 0xD1, 0x37,
+    0x52, 0x0C, 0x09, 0x5E, 0xE5, 0x23, 0xB5, 0xC1, 0x08, 0xB4, 0x62, 0x28, 0x66, 0x26, 0xBA, 0xA4,
+    0x4B, 0x41, 0x6C, 0x6F, 0x3A, 0x4A, 0x65, 0x31, 0xBA, 0xD6, 0x0E, 0x10, 0xBE, 0x36, 0x57, 0xF2,
+    0x24, 0xAA, 0x24, 0x41, 0x15, 0x19, 0x55, 0x90, 0x0E, 0xAF, 0x62, 0xD4, 0x0D, 0x99, 0x64, 0xF2,
+    0x71, 0x49, 0x0C, 0x31, 0x3C, 0xDE, 0xB9, 0x4B, 0x7C, 0xD1, 0x25, 0x5B, 0xA6, 0xD5, 0x9E, 0x42,
+    0x1D, 0x64, 0x65, 0x3E, 0x33, 0x44, 0x79, 0xF9, 0xE9, 0xE4, 0xED, 0x80, 0x7C, 0x91, 0xD8, 0x26,
+    0x9B, 0x5F, 0xFA, 0xB6, 0x64, 0xC8, 0x18, 0xA7, 0x25, 0xA3, 0x62, 0xA6, 0x4B, 0xE4, 0x1C, 0x72,
+    0x42, 0x19, 0x68, 0x43, 0x41, 0x49, 0x1C, 0x72, 0x8C, 0x26, 0xB0, 0x50, 0x0F, 0xBF, 0xFE, 0x03,
+    0x4D, 0x50, 0xBE, 0xF3, 0x25, 0x13, 0x4D, 0x44, 0xF3, 0x40, 0x1A, 0xE1, 0x1E, 0x72, 0x95, 0xB2,
+    0x80, 0x2A, 0xAA, 0xA5, 0x4C, 0x62, 0x1B, 0x15, 0x33, 0x87, 0x47, 0x5A, 0xAA, 0xD9, 0x5A, 0x26,
+    0x44, 0x39, 0x9B, 0x6A, 0x35, 0xCA, 0x46, 0xAA, 0x1F, 0xAF, 0x82, 0xA8, 0xA0, 0x86, 0x38, 0xFB,
+    0x1E, 0xC9, 0xFB, 0x1C, 0x11, 0xCD, 0x9A, 0x12, 0x1A, 0x06, 0x2A, 0xA0, 0x89, 0xD0, 0x48, 0xAE,
+    0xFB, 0x3B, 0x46, 0x4A, 0x0C, 0x74, 0x24, 0x05, 0x9C, 0x12, 0xB4, 0x20, 0x3C, 0x5A, 0xB6, 0x52,
+    0xD6, 0xEC, 0x9F, 0x53, 0xCA, 0x25, 0xEF, 0x10, 0x9B, 0x9D, 0x45, 0x0F, 0xAF, 0x63, 0xC5, 0xEE,
+    0x59, 0x1B, 0xC5, 0x13, 0x84, 0xDD, 0xD8, 0x72, 0xD4, 0x13, 0x41, 0x5C, 0xFD, 0xB4, 0x47, 0x41,
+    0xB0, 0xEE, 0x83, 0x9F, 0xB8, 0x1A, 0x32, 0x56, 0xDA, 0x72, 0xE5, 0x52, 0xA5, 0xC8, 0x0D, 0x13,
+    0x1F, 0xCF, 0x76, 0x20, 0x8A, 0x3F, 0xE3, 0x26, 0x7B, 0x36, 0xA1, 0x65, 0xDD, 0x2D, 0xF0, 0x23,
+    0xAC, 0x47, 0x35, 0x1A, 0x19, 0xC5, 0xCB, 0x23, 0x49, 0x59, 0x04, 0xD3, 0x68, 0x73, 0xEA, 0xFE,
+    0x25, 0x4E, 0x94, 0x8C, 0xAD, 0xBC, 0xA0, 0xCE, 0x09, 0x48, 0xDB, 0xE7, 0xB5, 0x1B, 0xB2, 0x05,
+    0x00, 0x7B, 0x96, 0xF3, 0x7E, 0x0D, 0x98, 0x3F, 0x4B, 0xA9, 0xFD, 0x7F, 0x50, 0xDF, 0x25, 0x10,
+    0xEC, 0xF8, 0x5A, 0xB4, 0x1E, 0x28, 0x34, 0x76, 0x04, 0xA5, 0x63, 0x39, 0xE0, 0x99, 0x6C, 0xA4,
+    0x7D, 0xCB, 0x06, 0xC7, 0x5F, 0x12, 0x78, 0xF8, 0x98, 0x8E, 0xA7, 0xD3, 0x5C, 0x41, 0x89, 0xE2,
+    0xD7, 0xA8, 0x3E, 0x61, 0x66, 0xAA, 0x4F, 0x45, 0xC6, 0x8C, 0x6C, 0x52, 0x12, 0x4E, 0x4F, 0x30,
+    0x5A, 0x74, 0xFD, 0xDF, 0x4E, 0x0A, 0xD3, 0x50, 0xDC, 0x8E, 0x2B, 0xD5, 0xD8, 0x3B, 0x7D, 0x0E,
+    0x8E, 0x85, 0xDA, 0xB5, 0x6A, 0xF3, 0x87, 0x74, 0xC6, 0x0B, 0x42, 0x42, 0x98, 0x64, 0x24, 0x35,
+    0xE8, 0x8B, 0x1E, 0x09, 0xE0, 0xB0, 0xD4, 0xFA, 0x09, 0x8F, 0xEC, 0x99, 0xF8, 0x69, 0xA0, 0xFB,
+    0xF3, 0xC1, 0x53, 0xC2, 0x6F, 0x84, 0xAE, 0x7E, 0xB2, 0x92, 0x7E, 0xD2, 0x63, 0x7C, 0xD8, 0x51,
+    0x2F, 0x8E, 0xA6, 0xA3, 0x64, 0x39, 0xDB, 0xF5, 0xF0, 0x4B, 0x22, 0x17, 0x3B, 0xBE, 0x23, 0x1D,
+    0xD6, 0xB2, 0x7F, 0xAD, 0x7E, 0xB1, 0x59, 0x05, 0xD5, 0x1F, 0x88, 0x7C, 0xCC, 0xC7, 0xF5, 0xD7,
+    0xC1, 0x0E, 0x68, 0xB2, 0x34, 0xA6, 0xF3, 0x6D, 0xEA, 0xA3, 0x5A, 0x0E, 0x1B, 0x96, 0x33, 0xA8,
+    0x11, 0x6B, 0x79, 0xC3, 0x52, 0xE2, 0xEF, 0x82, 0x61, 0x2C, 0xD2, 0xDF, 0xB2, 0x89, 0x6D, 0x8B,
+    0x1A, 0xC8, 0x44, 0x72, 0xF3, 0x95, 0x7B, 0x7B, 0x57, 0xB3, 0x9B, 0x48, 0xEB, 0x26, 0x45, 0x26,
+    0x56, 0x45, 0xC2, 0x34, 0xEE, 0xB8, 0x8B, 0x70, 0xFD, 0x7F, 0x42, 0x8D, 0x9F, 0x91, 0x35, 0x63,
+    0x0B, 0x4A, 0x45, 0x96, 0xFC, 0x6A, 0xCF, 0x8A, 0x00, 0x9D, 0xD7, 0x46, 0x4A, 0x67, 0xB8, 0xF1,
+    0x9E, 0x3E, 0xDA, 0xB3, 0x4B, 0x10, 0x3D, 0xE2, 0x81, 0x0C, 0xEE, 0x45, 0x75, 0xC7, 0x47, 0xD9,
+    0x40, 0xF4, 0xAA, 0x71, 0xD7, 0xA2, 0xDB, 0x2F, 0x41, 0xED, 0x02, 0x74, 0xF3, 0x7B, 0xB8, 0xD6,
+    0x3C, 0xBF, 0x41, 0xCF, 0x6E, 0xD0, 0x73, 0x55, 0x5F, 0x65, 0x75, 0xC3, 0xAA, 0x78, 0xA6, 0x4E,
+    0xA8, 0xE8, 0x99, 0xC5, 0x63, 0x9B, 0x5A, 0xFE, 0xD9, 0xF5, 0x07, 0x95, 0x55, 0xBD, 0x8E, 0xE6,
+    0x34, 0x14, 0x3D, 0x8E, 0x25, 0x82, 0x88, 0x84, 0x1B, 0x5A, 0xC6, 0x34, 0xDB, 0x8C, 0xD8, 0xCD,
+    0x0B, 0x0C, 0x93, 0xA0, 0x7D, 0x05, 0xA6, 0xA2, 0xE1, 0x31, 0xB6, 0xF8, 0x58, 0x47, 0xE2, 0x01,
+    0xD8, 0x87, 0xA0, 0x40, 0x53, 0x51, 0x6C, 0x41, 0x01, 0x13, 0x23, 0x4A, 0x9A, 0xBC, 0x01, 0x41,
+    0xBB, 0x3D, 0x11, 0x8A, 0x20, 0x2B, 0x25, 0x31, 0xE7, 0x5E, 0x7F, 0xF3, 0xB7, 0x62, 0x47, 0x22,
+    0xB1, 0xEC, 0xD8, 0x8E, 0x6F, 0xCE, 0xB9, 0xF7, 0xDC, 0x1B, 0xE0, 0x14, 0xD2, 0x9A, 0xDC, 0x5A,
+    0x6D, 0x1D, 0x42, 0x87, 0x47, 0xAD, 0xB4, 0x77, 0x5E, 0x76, 0x44, 0x31, 0x01, 0x2B, 0xB0, 0x00,
+    0x75, 0x8B, 0x9F, 0x80, 0x72, 0xC4, 0x73, 0xC8, 0x12, 0x2D, 0xD1, 0x8E, 0xEF, 0x80, 0x6A, 0x74,
+    0x11, 0x30, 0x6B, 0x35, 0xCA, 0xD2, 0x53, 0x1E, 0x80, 0x7B, 0xC5, 0x03, 0x28, 0xB6, 0x55, 0xAC,
+    0x84, 0x5D, 0x7A, 0x97, 0xD4, 0x62, 0xEA, 0x64, 0x48, 0x51, 0xFA, 0x7A, 0xD4, 0x0D, 0x39, 0x80,
+    0x6A, 0xD1, 0x5E, 0x0F, 0xF8, 0x8D, 0xDD, 0x07, 0x69, 0xD7, 0xF7, 0x37, 0x7D, 0x5F, 0x77, 0xC3,
+    0x8B, 0xFB, 0xF0, 0x56, 0x6D, 0x99, 0x8F, 0x1B, 0xA5, 0xD9, 0x45, 0x9A, 0x5C, 0x0F, 0xB0, 0x7A,
+    0xEB, 0x72, 0x1D, 0x04, 0xFF, 0x0A, 0x33, 0x13, 0xC0, 0xA0, 0xC4, 0xAE, 0xE4, 0x01, 0xE5, 0x24,
+    0xF6, 0xB9, 0x40, 0xFB, 0xB4, 0x5B, 0x0A, 0xD0, 0x3A, 0x0A, 0x20, 0xB3, 0xD6, 0x51, 0x69, 0xCE,
+    0x8A, 0xAE, 0x57, 0xEC, 0x69, 0x50, 0x90, 0x6B, 0xE6, 0xA9, 0x00, 0x1A, 0xE5, 0x66, 0x95, 0x03,
+    0x82, 0x92, 0x76, 0x7A, 0xA4, 0x4C, 0xB9, 0x97, 0xA5, 0x26, 0x4D, 0x7A, 0x22, 0x73, 0xD4, 0x77,
+    0xAB, 0xD7, 0x19, 0x5B, 0x39, 0xF1, 0xA3, 0x75, 0x6C, 0x22, 0x92, 0xD9, 0xE9, 0x23, 0xB7, 0xA0,
+    0x19, 0x9A, 0xE1, 0x3E, 0x01, 0xD3, 0xB2, 0xB9, 0x16, 0x35, 0x0E, 0x0C, 0x14, 0x03, 0x66, 0x07,
+    0x72, 0xF2, 0xF8, 0x8C, 0xA4, 0x0C, 0x67, 0x63, 0x15, 0xE1, 0xDB, 0x73, 0x60, 0x23, 0x43, 0x5A,
+    0x8C, 0x68, 0xA2, 0x6F, 0xED, 0x8E, 0x1E, 0xFD, 0x6C, 0x52, 0x4A, 0xD1, 0x26, 0x52, 0xB0, 0xE9,
+    0x2F, 0x22, 0xF8, 0xC2, 0x89, 0xF5, 0x20, 0xD1, 0x13, 0x22, 0x4E, 0x63, 0xDA, 0x0A, 0x63, 0x3E,
+    0x3C, 0xE7, 0xBD, 0x63, 0x37, 0xBC, 0xED, 0x6E, 0x37, 0xBB, 0x95, 0xDB, 0xDB, 0xDE, 0x2C, 0xDA,
+    0xF7, 0x50, 0xA2, 0x82, 0xE3, 0xFD, 0x21, 0x4E, 0xF0, 0x31, 0x1E, 0xE3, 0x53, 0x9C, 0xF1, 0x3E,
+    0xE0, 0xCC, 0x2C, 0x38, 0xFF, 0x72, 0x46, 0x4D, 0xC2, 0xD5, 0x1B, 0x92, 0x2E, 0x68, 0xDD, 0xF2,
+    0x7B, 0x96, 0x6E, 0x28, 0x45, 0x43, 0x17, 0x17, 0x17, 0xC4, 0x41, 0x44, 0x60, 0x37, 0xA9, 0xD2,
+    0x50, 0x8B, 0x62, 0x14, 0x95, 0x06, 0x40, 0x61, 0x41, 0x25, 0x25, 0xB8, 0xE0, 0xC5, 0x85, 0x95,
+    0x7A, 0xF0, 0x76, 0xA7, 0x97, 0x9D, 0x26, 0x5E, 0xAB, 0xAB, 0xCC, 0x6A, 0xD4, 0x58, 0xE9, 0x8E,
+    0x58, 0xAB, 0xF5, 0x75, 0xA7, 0x01, 0x92, 0x4F, 0x18, 0x75, 0xEB, 0x57, 0xCA, 0xE2, 0xF4, 0xF2,
+    0x3B, 0x22, 0x18, 0x4B, 0xAE, 0x3F, 0xE1, 0x74, 0xCE, 0xF0, 0x6A, 0x68, 0x22, 0x08, 0x62, 0xCF,
+    0x47, 0x66, 0x83, 0xA5, 0x75, 0x49, 0x81, 0x9F, 0x8F, 0x5F, 0xFF, 0x21, 0xDB, 0x7A, 0x3F, 0xFB,
+    0xC2, 0x47, 0xC5, 0x6E, 0x97, 0xAC, 0xC9, 0xD0, 0x85, 0x56, 0x05, 0xA0, 0x12, 0x30, 0xE9, 0xF3,
+    0x84, 0xFF, 0x73, 0x31, 0x5B, 0x0E, 0x99, 0x65, 0x15, 0x33, 0xBB, 0x25, 0x53, 0x73, 0xAD, 0x32,
+    0x36, 0x53, 0xA6, 0x5B, 0x67, 0x2F, 0x58, 0x89, 0x9C, 0x1F, 0xF0, 0x75, 0xF6, 0x59, 0x95, 0xDE,
+    0xE8, 0x99, 0x94, 0x56, 0x94, 0x33, 0x45, 0x4F, 0x67, 0xF6, 0x22, 0x79, 0x77, 0x3C, 0x33, 0x23,
+    0x09, 0x1D, 0xD7, 0xD6, 0x92, 0xE1, 0x66, 0xA2, 0x68, 0x99, 0x03, 0x41, 0x54, 0xBB, 0xA2, 0x1E,
+    0x98, 0x99, 0x4E, 0xCE, 0xA6, 0x4E, 0x14, 0x03, 0x2F, 0x51, 0x14, 0xE1, 0x48, 0xB8, 0x5E, 0x1C,
+    0x75, 0x7E, 0xBC, 0xAA, 0x28, 0xF9, 0x14, 0x44, 0x44, 0x76, 0x15, 0xB7, 0xF8, 0xC9, 0x4F, 0x92,
+    0xF3, 0x39, 0xF7, 0xDF, 0x4D, 0xB0, 0x93, 0x70, 0xD0, 0x95, 0x38, 0x58, 0x15, 0x87, 0x98, 0x71,
+    0xAD, 0x88, 0xE0, 0x50, 0x90, 0x6B, 0x31, 0x39, 0x92, 0x70, 0x5D, 0x73, 0xD9, 0x53, 0xDB, 0x0B,
+    0x4E, 0xCC, 0x54, 0x0E, 0x38, 0x73, 0xB1, 0x26, 0xDC, 0x73, 0xA2, 0x74, 0xBF, 0xCC, 0x76, 0x32,
+    0x5B, 0x15, 0x3D, 0xC5, 0xD3, 0xA0, 0x4F, 0xC9, 0x2C, 0x02, 0xAF, 0x1C, 0x6F, 0xBE, 0x71, 0xA5,
+    0x2A, 0x56, 0xD1, 0x08, 0xBC, 0x39, 0x4B, 0xBD, 0xCF, 0x83, 0x1F, 0x74, 0x20, 0xE4, 0x90, 0x5D,
+    0xAA, 0x83, 0x1F, 0x75, 0xB0, 0x6B, 0x50, 0xF8, 0x7D, 0x66, 0xE1, 0x73, 0x09, 0xB3, 0x79, 0x40,
+    0x9F, 0x87, 0x30, 0xE7, 0x21, 0x1D, 0x07, 0x5D, 0x0D, 0x7F, 0xE6, 0xF0, 0xBF, 0xD2, 0xD5, 0x30,
+    0x06, 0x81, 0x13, 0x26, 0xB7, 0xEA, 0x50, 0x88, 0x22, 0xE9, 0xBF, 0x30, 0xE9, 0xE0, 0xB6, 0x4F,
+    0xD0, 0xCC, 0x28, 0x58, 0xFD, 0x9A, 0xF9, 0xC6, 0x84, 0xCF, 0xC5, 0xE1, 0x58, 0x23, 0x50, 0xBF,
+    0xBE, 0x93, 0xFD, 0xC0, 0x47, 0x22, 0x81, 0x1F, 0xE9, 0x19, 0xE6, 0x7E, 0x19, 0xA9, 0x0E, 0x3B,
+    0xD6, 0xA2, 0x4D, 0x0A, 0xD4, 0xFC, 0x2D, 0x91, 0xD1, 0xCA, 0xA4, 0x39, 0x11, 0x54, 0x79, 0x5A,
+    0x7A, 0x48, 0xC3, 0xFF, 0x2E, 0x7E, 0x60, 0x8E, 0xD3, 0x69, 0x3C, 0x3A, 0xD3, 0x1F, 0x7E, 0xB0,
+    0x7B, 0x17, 0xBA, 0x42, 0x8E, 0x98, 0x24, 0x48, 0xAF, 0x72, 0x29, 0x6D, 0x52, 0xFA, 0x27, 0xA5,
+    0x8D, 0x4E, 0x8D, 0xF7, 0x1F, 0x53, 0xFA, 0x56, 0xBA, 0xDF, 0xA4, 0x9B, 0x4E, 0x2F, 0x2F, 0x2F,
+    0xBF, 0x97, 0xC5, 0x95, 0xBB, 0x47, 0xB4, 0xB2, 0xC6, 0xEB, 0x9B, 0xA4, 0xD7, 0xD2, 0xE7, 0xF1,
+    0xBA, 0x40, 0x3F, 0xBC, 0x2B, 0x59, 0xC9, 0xCA, 0x0E, 0x66, 0xE2, 0x19, 0x2B, 0x89, 0x19, 0xC1,
+    0xD2, 0xD1, 0x32, 0x19, 0xEF, 0xCC, 0xAC, 0xCC, 0x4E, 0xC0, 0xE7, 0x19, 0x55, 0x77, 0x3B, 0x7B,
+    0xC9, 0x53, 0x9C, 0x3D, 0x96, 0x64, 0xBD, 0x33, 0x73, 0x32, 0x7B, 0xC6, 0x9A, 0xC3, 0x3C, 0x7E,
+    0x72, 0x3B, 0x2B, 0x06, 0x9E, 0xE2, 0xEC, 0xA5, 0x64, 0x99, 0xD4, 0xA0, 0xB4, 0x97, 0xD2, 0xAF,
+    0x2E, 0xDD, 0x30, 0xB9, 0x2F, 0x57, 0x25, 0xAC, 0x0E, 0x18, 0x14, 0x75, 0xEC, 0xA3, 0x5B, 0x8A,
+    0xC4, 0xEA, 0xC2, 0x9F, 0x19, 0x53, 0x64, 0xCA, 0x75, 0x3F, 0x8C, 0x8C, 0x74, 0x6A, 0x6B, 0x99,
+    0x86, 0xE8, 0xA6, 0x62, 0xBF, 0xFE, 0xF1, 0xAC, 0x26, 0xB5, 0xCD, 0x24, 0x72, 0xEB, 0x74, 0x59,
+    0x7F, 0x10, 0xFF, 0x69, 0xA4, 0xFF, 0x95, 0x2B, 0x7F, 0x88, 0x91, 0x14, 0xDD, 0xDC, 0xC4, 0x6A,
+    0xA9, 0x07, 0xBB, 0xBA, 0xC9, 0x24, 0x79, 0xEB, 0xE9, 0xF6, 0x70, 0xE5, 0xF8, 0x17, 0xDD, 0x55,
+    0xBF, 0x8B, 0x1D, 0x55, 0x14, 0xFE, 0xEE, 0x5C, 0xDD, 0x31, 0xCE, 0xCA, 0x15, 0xF1, 0x41, 0x8C,
+    0x09, 0x23, 0x82, 0x10, 0x44, 0x33, 0x5B, 0x58, 0x04, 0xDC, 0xCD, 0x0C, 0xA4, 0x30, 0xB0, 0x85,
+    0x20, 0x09, 0x68, 0xA5, 0xA5, 0xD8, 0xAC, 0x85, 0x45, 0x0A, 0x75, 0x06, 0x6C, 0x52, 0x05, 0x0B,
+    0xED, 0x2C, 0x52, 0x6F, 0xBD, 0x85, 0xE0, 0xC6, 0x37, 0xB8, 0x95, 0xA0, 0x38, 0x64, 0xFF, 0x00,
+    0x47, 0xEC, 0x6C, 0x32, 0xE8, 0x88, 0x2F, 0x38, 0x6F, 0x8E, 0xDF, 0x39, 0xB3, 0xEF, 0x25, 0x28,
+    0x48, 0x6C, 0x1D, 0x38, 0xF7, 0x9D, 0xB9, 0x73, 0x7E, 0x7E, 0xE7, 0xC7, 0x43, 0xF9, 0x93, 0x14,
+    0x79, 0x27, 0x75, 0xE8, 0xF3, 0x26, 0x19, 0xB2, 0xCE, 0x2F, 0x43, 0xEF, 0x24, 0x59, 0x40, 0xFC,
+    0x80, 0xF9, 0x27, 0x23, 0x56, 0x4F, 0x18, 0x9C, 0x4A, 0xF2, 0xB6, 0xAC, 0x42, 0x17, 0x8D, 0x28,
+    0x6B, 0xDE, 0x96, 0x77, 0xA4, 0x08, 0x43, 0xDE, 0x3A, 0x89, 0x07, 0xE4, 0xAD, 0x54, 0xF1, 0x90,
+    0x76, 0x90, 0xCB, 0x4B, 0x84, 0xAE, 0xAC, 0xA3, 0x91, 0x86, 0xA6, 0xE7, 0x19, 0xD2, 0x25, 0xD2,
+    0x0E, 0xE9, 0x43, 0xD2, 0x21, 0x49, 0xBF, 0xF5, 0x80, 0xEB, 0x80, 0x88, 0xE4, 0x5B, 0x52, 0x03,
+    0xC4, 0x34, 0xFC, 0xAC, 0x0C, 0x99, 0xC8, 0x50, 0xCA, 0xE7, 0x57, 0x91, 0x52, 0x2C, 0xFB, 0x6F,
+    0xEA, 0x09, 0x29, 0x54, 0xA4, 0x02, 0xFF, 0x50, 0x3F, 0x4B, 0xDA, 0x24, 0x3D, 0x32, 0x05, 0x76,
+    0x1E, 0x93, 0xBA, 0xC9, 0x9B, 0x80, 0x1A, 0x34, 0x0B, 0xA6, 0xA2, 0x2E, 0xCC, 0xA6, 0x19, 0xC1,
+    0x97, 0x98, 0xBC, 0xE0, 0x6D, 0x61, 0x9E, 0x42, 0xE0, 0xE4, 0xF7, 0x6B, 0x93, 0x23, 0x0B, 0xEC,
+    0x5F, 0x4D, 0xDD, 0xBB, 0x85, 0x94, 0x2A, 0xAA, 0x07, 0x77, 0x6D, 0xB1, 0x32, 0xA5, 0x11, 0x5A,
+    0x46, 0x9A, 0xC2, 0xDF, 0x4C, 0xC5, 0x6A, 0xEA, 0x09, 0x15, 0x78, 0x6E, 0x5D, 0x0A, 0xEA, 0x0F,
+    0x48, 0x44, 0x5A, 0xE4, 0x22, 0x55, 0x24, 0x42, 0xB4, 0x45, 0x7A, 0x94, 0xB4, 0xED, 0xD5, 0x76,
+    0xAA, 0x02, 0x64, 0xBA, 0x98, 0x47, 0x45, 0xA1, 0xD1, 0x91, 0xE9, 0x29, 0x24, 0x0D, 0x85, 0x44,
+    0x85, 0x86, 0x54, 0x05, 0xDE, 0xDB, 0xDF, 0xDF, 0xA7, 0xBF, 0xA8, 0xC2, 0x12, 0x79, 0x9F, 0x4A,
+    0x90, 0xCB, 0xF7, 0xA0, 0x51, 0x20, 0x6E, 0xC7, 0xF4, 0xE7, 0x65, 0xD9, 0xDC, 0xFF, 0x45, 0xAE,
+    0x97, 0x48, 0x3A, 0x8C, 0x69, 0x0B, 0x7A, 0x39, 0x5E, 0x22, 0x6B, 0x3D, 0xBF, 0x79, 0xED, 0x86,
+    0x3C, 0x1C, 0x75, 0xF7, 0x43, 0xC4, 0x07, 0x70, 0xEF, 0xC0, 0xB5, 0xD8, 0x78, 0x0C, 0xBE, 0xC6,
+    0xE6, 0x26, 0x02, 0x70, 0xFA, 0x06, 0xB6, 0x81, 0x17, 0xDE, 0x55, 0x4C, 0x5F, 0x79, 0x3F, 0x62,
+    0xEE, 0x79, 0x9B, 0x30, 0xC1, 0xB4, 0x32, 0x08, 0x2C, 0x6B, 0xC0, 0xAC, 0x18, 0x30, 0x13, 0x90,
+    0xB8, 0x80, 0x15, 0x40, 0x13, 0xA0, 0x88, 0xA7, 0x8F, 0x57, 0xDE, 0x60, 0x0D, 0x2F, 0xCD, 0x66,
+    0x57, 0x80, 0xE1, 0xF9, 0x37, 0x3F, 0x83, 0xEF, 0xB6, 0xBE, 0xDB, 0x22, 0xDC, 0xAF, 0xDE, 0x6C,
+    0x91, 0x15, 0x17, 0x08, 0xDD, 0x6C, 0x8A, 0xA5, 0x6C, 0x03, 0xF1, 0x28, 0xB4, 0xBB, 0x19, 0xA8,
+    0x75, 0xAF, 0x5D, 0x3F, 0x6C, 0xEF, 0x13, 0xA0, 0xC2, 0x17, 0xA7, 0x30, 0xB8, 0x85, 0xEF, 0x3E,
+    0xE6, 0x4F, 0x9F, 0xB1, 0xA0, 0x43, 0x60, 0xD8, 0x3B, 0xBE, 0x4E, 0xAA, 0x34, 0x6A, 0x7C, 0x95,
+    0x14, 0x2B, 0xE1, 0x5B, 0x79, 0xD4, 0x85, 0xEA, 0xD0, 0xD7, 0xE7, 0xEC, 0xF5, 0x0C, 0x2F, 0x7C,
+    0x97, 0x45, 0x7D, 0x28, 0x16, 0x49, 0xCD, 0xEB, 0x6D, 0xD7, 0x9C, 0x5B, 0x1B, 0xAE, 0x12, 0x9C,
+    0xF2, 0x5D, 0xA8, 0x43, 0x7D, 0xE8, 0x7A, 0x32, 0x45, 0x8E, 0x8F, 0xA2, 0x2E, 0xAE, 0x43, 0xB5,
+    0x8D, 0xDE, 0x75, 0x49, 0x71, 0x06, 0x2F, 0x9D, 0xC8, 0xD2, 0x43, 0x56, 0xE1, 0x8F, 0x26, 0xB9,
+    0xD3, 0xE7, 0xC5, 0x12, 0xD6, 0x18, 0x71, 0x1D, 0xF5, 0x6E, 0xC0, 0x6D, 0x16, 0x87, 0x85, 0xC9,
+    0x6B, 0xC7, 0x02, 0xF5, 0x7C, 0x21, 0x8A, 0x8F, 0x2A, 0x52, 0xDA, 0x79, 0xFC, 0x1E, 0xF5, 0x88,
+    0x3B, 0x84, 0x1A, 0x23, 0xB2, 0x46, 0x33, 0x54, 0xFE, 0x00, 0x6E, 0x35, 0xDC, 0xB5, 0xB5, 0x15,
+    0x5D, 0x74, 0x2F, 0x16, 0x5A, 0x15, 0xF8, 0x41, 0xE7, 0x9B, 0x43, 0x1D, 0x8D, 0x73, 0x2D, 0x82,
+    0x54, 0x6C, 0x28, 0x65, 0xB2, 0x1E, 0x5C, 0x04, 0x5A, 0x21, 0x41, 0x64, 0x0C, 0xE6, 0x8D, 0x9F,
+    0x98, 0x30, 0xC4, 0x62, 0xF6, 0xBC, 0xEC, 0xCA, 0x09, 0xF4, 0x32, 0x31, 0xE9, 0x0F, 0x32, 0xDA,
+    0x14, 0x84, 0x5F, 0x95, 0xC9, 0x6A, 0xC4, 0x8B, 0x9C, 0x4C, 0xA0, 0xAB, 0x31, 0x55, 0xCF, 0x1C,
+    0x07, 0xD9, 0x63, 0x4F, 0x7B, 0xCD, 0x2C, 0x67, 0x03, 0xAF, 0xF4, 0x2D, 0x36, 0xCC, 0x17, 0xD2,
+    0x4F, 0xCD, 0xBF, 0x48, 0xCD, 0xA4, 0x93, 0xDE, 0x4B, 0x63, 0x4C, 0x87, 0x52, 0xC5, 0x23, 0x32,
+    0x41, 0x83, 0xF4, 0x34, 0xB3, 0xC1, 0x17, 0xC4, 0x64, 0x12, 0x8D, 0x20, 0xA1, 0x24, 0xBB, 0xBE,
+    0x99, 0x30, 0x5F, 0xAE, 0x07, 0x69, 0x55, 0xB3, 0xD9, 0x09, 0xE3, 0x3E, 0xB5, 0xC1, 0xD5, 0x91,
+    0x1D, 0x6C, 0x14, 0x75, 0x08, 0xF3, 0x69, 0x32, 0x6F, 0x1B, 0x4E, 0x04, 0x53, 0xAB, 0xE0, 0x19,
+    0x4C, 0xA9, 0x78, 0x81, 0x90, 0x22, 0x6D, 0x10, 0xF1, 0x3E, 0xAF, 0x10, 0xF3, 0x7E, 0x6F, 0xDD,
+    0x36, 0x79, 0x3D, 0xE5, 0x55, 0x29, 0x6C, 0x0A, 0xD2, 0xFC, 0x81, 0x11, 0xE9, 0x56, 0x33, 0xAE,
+    0xB6, 0x30, 0xA7, 0x10, 0xC7, 0x95, 0x19, 0xDC, 0xFD, 0x71, 0x40, 0x08, 0xDF, 0xA8, 0xFF, 0x8A,
+    0x91, 0xA6, 0x5A, 0xEA, 0x8C, 0xF3, 0x89, 0x5C, 0x7D, 0x97, 0x11, 0x0D, 0x7E, 0xED, 0xA9, 0xB7,
+    0x24, 0x76, 0x18, 0x32, 0x0D, 0x49, 0x34, 0xF9, 0xA5, 0x26, 0x6E, 0x49, 0xEB, 0x06, 0xD4, 0xEE,
+    0x0D, 0x6A, 0x38, 0xA8, 0x8B, 0x54, 0x67, 0x3A, 0x6B, 0xA6, 0x90, 0x2C, 0xD0, 0x07, 0x1E, 0xA7,
+    0xB2, 0xDE, 0x0E, 0x45, 0x26, 0x59, 0x5A, 0x29, 0x55, 0x4B, 0x8F, 0x4C, 0x8F, 0xD9, 0x55, 0x7D,
+    0xE5, 0x0E, 0x99, 0x8B, 0x1C, 0xC9, 0x54, 0xD3, 0x8B, 0xD8, 0x78, 0x1D, 0xFE, 0xA8, 0x8D, 0x9B,
+    0xB9, 0xB4, 0x0A, 0xF0, 0x5B, 0x0A, 0xA2, 0xAB, 0xAC, 0xAB, 0xC9, 0x1C, 0xEF, 0xF2, 0xF8, 0x53,
+    0x17, 0x66, 0xAA, 0x77, 0x25, 0x83, 0x89, 0xBF, 0xE7, 0xFC, 0x3B, 0x5B, 0x67, 0x67, 0xD9, 0x7B,
+    0xA7, 0xB5, 0x3F, 0x2F, 0x3E, 0xF5, 0xDA, 0xE3, 0x2F, 0x6F, 0xFD, 0xF6, 0xCB, 0x41, 0xF2, 0x55,
+    0xB1, 0x57, 0xB8, 0x05, 0xDB, 0x29, 0xB9, 0xBB, 0xFB, 0xC5, 0xE2, 0xFA, 0xF1, 0xB7, 0xE7, 0x9F,
+    0x44, 0x4D, 0x37, 0x6E, 0x1D, 0xED, 0x75, 0x3B, 0x6D, 0x3F, 0x79, 0x6B, 0x8B, 0x60, 0x17, 0x3B,
+    0x76, 0x1E, 0x58, 0x6D, 0xA7, 0xE5, 0x65, 0x1A, 0xD3, 0x52, 0xD9, 0xC6, 0x6A, 0x8B, 0x3F, 0xCC,
+    0x52, 0x49, 0xAD, 0x11, 0x6C, 0x5B, 0xDB, 0x1F, 0x0C, 0xBC, 0x7D, 0xB4, 0x1D, 0xCE, 0xA5, 0xA2,
+    0xE7, 0xD3, 0xF8, 0xFF, 0x3C, 0x7F, 0x01, 0x9D, 0x55, 0x3D, 0x8F, 0xE3, 0x44, 0x18, 0x7E, 0x3D,
+    0x23, 0x6E, 0x84, 0x7C, 0x59, 0x6F, 0xB3, 0x08, 0x41, 0xF6, 0xDC, 0x5E, 0x11, 0xD6, 0x14, 0x29,
+    0x52, 0xEC, 0xAD, 0x1D, 0x51, 0x5C, 0x4B, 0x43, 0x8B, 0xF8, 0x03, 0x48, 0x41, 0x4A, 0x83, 0xB4,
+    0x47, 0xBC, 0x77, 0x7F, 0xE0, 0x2A, 0x2A, 0x8A, 0xE5, 0x17, 0x90, 0x62, 0x0B, 0x90, 0xB2, 0xE7,
+    0x91, 0xF8, 0x03, 0x46, 0x14, 0xB4, 0xA6, 0xE0, 0x2A, 0x10, 0x53, 0xA4, 0x30, 0x27, 0xDB, 0xC3,
+    0xF3, 0xCE, 0x4C, 0xB8, 0xEC, 0x2A, 0x15, 0x96, 0x5E, 0x8D, 0x33, 0xF3, 0x7E, 0x3D, 0xCF, 0x3C,
+    0xAF, 0x43, 0xB4, 0x7B, 0x1E, 0xD8, 0x12, 0xF6, 0x92, 0x22, 0x6B, 0x1B, 0x98, 0xA1, 0xEC, 0x8D,
+    0x6D, 0xD2, 0x37, 0x78, 0xE9, 0x28, 0xD7, 0x3D, 0x65, 0xB5, 0x28, 0x28, 0x9F, 0x97, 0x94, 0x97,
+    0xF0, 0xEE, 0x61, 0xAF, 0x60, 0x72, 0x4B, 0x24, 0x5A, 0xBC, 0x24, 0x1A, 0x56, 0xE3, 0x65, 0x05,
+    0xCB, 0xF9, 0xA4, 0x0D, 0x27, 0xA9, 0xF6, 0xE6, 0x62, 0x06, 0x76, 0x6D, 0xBC, 0x91, 0x25, 0x54,
+    0xC3, 0x9A, 0x19, 0x6F, 0x0A, 0x3F, 0x3E, 0x1C, 0x78, 0xD3, 0xC0, 0xE0, 0x11, 0x23, 0x44, 0x75,
+    0x9C, 0x10, 0x99, 0xB3, 0xDA, 0x87, 0x38, 0x53, 0x6D, 0x38, 0xE1, 0xDD, 0xAC, 0xD9, 0x3B, 0xE1,
+    0xBA, 0xD1, 0xA7, 0x74, 0xE0, 0x89, 0xB6, 0xE1, 0x85, 0x8B, 0x2B, 0xD4, 0xA3, 0xAA, 0x20, 0x07,
+    0x47, 0xA2, 0x4E, 0xC4, 0xAD, 0xA5, 0xD8, 0x4D, 0x76, 0x6E, 0xAB, 0x7A, 0x2F, 0xF8, 0xC4, 0xA5,
+    0xAC, 0x40, 0x12, 0x33, 0xD4, 0xB1, 0xFF, 0xDC, 0x96, 0x49, 0x31, 0xA3, 0xD8, 0x28, 0x46, 0xD7,
+    0x49, 0xCE, 0x98, 0x17, 0x5B, 0x47, 0xC6, 0x86, 0x7B, 0x34, 0x9E, 0x87, 0x84, 0x63, 0xBA, 0x98,
+    0xB3, 0x0D, 0xCE, 0xC9, 0x12, 0x77, 0x5E, 0x31, 0x81, 0xC0, 0x9F, 0x17, 0x24, 0x2C, 0xF3, 0x17,
+    0x5B, 0xE4, 0xA2, 0x78, 0x60, 0x08, 0xDC, 0x51, 0xEF, 0x00, 0x55, 0x68, 0x04, 0xA4, 0x6B, 0x46,
+    0x8A, 0xC6, 0x13, 0x78, 0x6C, 0x49, 0x76, 0x14, 0xA1, 0x44, 0x71, 0x17, 0x20, 0xFC, 0x50, 0x25,
+    0x6F, 0xF8, 0x56, 0xD2, 0x2D, 0x89, 0x8E, 0x12, 0x97, 0x83, 0x79, 0xAD, 0xB4, 0xB0, 0xFA, 0xAE,
+    0xFB, 0x3B, 0x9E, 0xA5, 0xD4, 0xF2, 0x2D, 0xA1, 0x3A, 0x33, 0x8E, 0xC2, 0xC2, 0x22, 0x6D, 0x74,
+    0xEA, 0x89, 0x34, 0xFE, 0xEE, 0x2E, 0x18, 0x01, 0x0E, 0x81, 0x21, 0x05, 0x9A, 0x4B, 0x7F, 0xF1,
+    0x7C, 0xE7, 0x0C, 0x11, 0x8E, 0x31, 0x62, 0xD3, 0xC2, 0x3B, 0x19, 0xA6, 0xC1, 0x9D, 0x30, 0xD1,
+    0x38, 0x71, 0x17, 0xD5, 0x93, 0xB4, 0x8E, 0x1A, 0xC5, 0x7D, 0xA0, 0x37, 0x57, 0x2E, 0x2F, 0x99,
+    0x72, 0x64, 0x13, 0xBD, 0xE3, 0x97, 0x81, 0x72, 0x9C, 0xE4, 0x10, 0xC4, 0xAC, 0x58, 0x6C, 0x99,
+    0x8E, 0x99, 0x55, 0xEC, 0x7D, 0xC6, 0xBB, 0xEF, 0x95, 0xF7, 0x2E, 0x96, 0xFB, 0x60, 0x7D, 0x76,
+    0xAE, 0x7F, 0x9F, 0xA2, 0xD2, 0xB1, 0x93, 0x25, 0xEA, 0xC0, 0x7D, 0x87, 0x3D, 0xEF, 0x0E, 0xE8,
+    0x42, 0xF8, 0x7C, 0xCA, 0xBB, 0x48, 0x7F, 0xEB, 0x8C, 0x9C, 0x9F, 0x20, 0x86, 0x8D, 0x5F, 0x9E,
+    0xF8, 0x25, 0x0B, 0x75, 0xC3, 0xC2, 0xF1, 0xA2, 0xF5, 0xF1, 0xBD, 0x6C, 0x1C, 0x90, 0xB9, 0x8B,
+    0xCF, 0xB5, 0xE3, 0x36, 0x35, 0x07, 0xE3, 0xD3, 0xE2, 0x6D, 0xFB, 0xA8, 0xEF, 0x0B, 0xFB, 0x78,
+    0x12, 0xA1, 0x7E, 0x7B, 0xA7, 0xFE, 0x37, 0x7E, 0xC9, 0x43, 0xFC, 0x53, 0xE7, 0x94, 0xFC, 0xEC,
+    0x50, 0xC5, 0xBF, 0x0C, 0x2E, 0xDE, 0x58, 0xD7, 0xCF, 0x36, 0x77, 0xF9, 0x02, 0xE0, 0xEE, 0x50,
+    0x7C, 0x56, 0xEE, 0xD7, 0x8F, 0x43, 0x7D, 0x5F, 0x58, 0x7A, 0xE0, 0x51, 0x08, 0xEC, 0xFD, 0x72,
+    0xE9, 0x97, 0xE9, 0x3D, 0x06, 0x4F, 0x68, 0x34, 0x96, 0x85, 0xFE, 0xEA, 0xE1, 0xD1, 0x54, 0xFF,
+    0x3A, 0x39, 0x95, 0x57, 0xF5, 0x3A, 0x7D, 0x45, 0x56, 0x2B, 0x87, 0x65, 0x44, 0xE7, 0xF4, 0xA7,
+    0xFC, 0xEE, 0x68, 0x76, 0xFE, 0xF5, 0x6A, 0x20, 0x43, 0x26, 0xE2, 0xED, 0x64, 0x00, 0xEF, 0x53,
+    0x92, 0x3C, 0x67, 0x91, 0x2A, 0x68, 0x46, 0x6A, 0xFE, 0xAD, 0xC9, 0x7B, 0x01, 0x14, 0x2B, 0x7D,
+    0x43, 0xD7, 0xF4, 0x31, 0x9D, 0x75, 0xC9, 0x27, 0x2F, 0xCA, 0xEF, 0xF5, 0x6C, 0x39, 0x81, 0x92,
+    0x7F, 0x62, 0x89, 0x0F, 0x34, 0x46, 0xBA, 0x25, 0x27, 0x91, 0x5A, 0x61, 0x00, 0x33, 0x4F, 0xEA,
+    0x07, 0xC5, 0xD1, 0xBB, 0xA2, 0xBC, 0x9E, 0x8E, 0xC4, 0x6F, 0x65, 0xD2, 0xC4, 0x4F, 0xE7, 0xFA,
+    0x7C, 0x22, 0x9F, 0xBF, 0x36, 0xAC, 0x82, 0x5B, 0x5A, 0x2E, 0x47, 0xF2, 0x4A, 0xCF, 0x1E, 0xCB,
+    0xE7, 0xFA, 0x26, 0xB1, 0x74, 0x72, 0x4D, 0xA7, 0xCA, 0x96, 0x15, 0x23, 0xC6, 0xB7, 0x22, 0x7A,
+    0x0D, 0x2D, 0xE6, 0xD6, 0x96, 0xD2, 0xCE, 0x3B, 0x48, 0x2E, 0xD6, 0x10, 0xEE, 0x06, 0x9C, 0x25,
+    0x1A, 0xE2, 0xEF, 0x78, 0x9A, 0x74, 0x5E, 0xE0, 0x86, 0x0D, 0x84, 0x8D, 0x71, 0x32, 0x38, 0xAE,
+    0x20, 0xD8, 0xC4, 0x40, 0x6A, 0x03, 0x64, 0x99, 0xD6, 0x55, 0xC9, 0x13, 0xFB, 0x00, 0x83, 0x5B,
+    0x5E, 0x93, 0x51, 0x34, 0xA1, 0x85, 0x7C, 0xA1, 0x8A, 0x9B, 0xF5, 0x3A, 0x49, 0x12, 0x32, 0xBF,
+    0x37, 0x29, 0x3D, 0x11, 0xF8, 0x50, 0x64, 0x51, 0x2B, 0x06, 0x8B, 0x99, 0xAB, 0x09, 0x63, 0x27,
+    0xFE, 0x71, 0xF4, 0x9D, 0xD1, 0x5F, 0x40, 0x35, 0x03, 0x1B, 0x0B, 0x5A, 0x53, 0x13, 0xD5, 0xD9,
+    0x90, 0x33, 0xE1, 0x18, 0x98, 0xF7, 0xA1, 0xB1, 0x09, 0x51, 0x43, 0x71, 0x41, 0x3F, 0x42, 0x69,
+    0xF8, 0xA2, 0xA2, 0x13, 0x6B, 0x12, 0xAB, 0x41, 0xD4, 0xF1, 0x63, 0x8A, 0x34, 0x2D, 0x51, 0x3A,
+    0xAA, 0x59, 0x8D, 0xCD, 0xF1, 0x97, 0x01, 0x96, 0x20, 0xA9, 0x45, 0x23, 0xA6, 0x62, 0x2C, 0x62,
+    0x61, 0xEB, 0x1F, 0x3A, 0x50, 0xF6, 0x91, 0x17, 0xAC, 0xAD, 0xBF, 0x40, 0xA5, 0x87, 0xA4, 0x5C,
+    0xD4, 0xF2, 0xF8, 0x32, 0xED, 0xE3, 0x70, 0xBD, 0xAA, 0x13, 0x35, 0x7A, 0x18, 0x51, 0xF4, 0x77,
+    0x7D, 0x16, 0x4B, 0xBD, 0x98, 0x2A, 0x79, 0xD5, 0x64, 0x1D, 0x18, 0x74, 0xD4, 0x9F, 0xA2, 0x97,
+    0x1D, 0xF5, 0x3A, 0x50, 0x7F, 0xF6, 0x52, 0x96, 0x7A, 0xAC, 0x68, 0xB1, 0xC4, 0xE7, 0x34, 0xFE,
+    0x9C, 0xCC, 0x58, 0x15, 0xEB, 0x47, 0xAA, 0xCC, 0x5B, 0xC8, 0x82, 0xFF, 0x24, 0xA6, 0xE7, 0x47,
+    0x42, 0xEB, 0xC9, 0x58, 0xEA, 0x3F, 0x5A, 0x85, 0x6F, 0xCB, 0x82, 0x1E, 0x49, 0xAB, 0x57, 0xCD,
+    0x7F, 0xD3, 0x0B, 0x15, 0xC6, 0xDA, 0xEB, 0x9F, 0x05, 0xC3, 0x02, 0x64, 0xF5, 0xBB, 0xCF, 0x75,
+    0x1B, 0xB4, 0xFF, 0x2C, 0xA8, 0x96, 0x47, 0x26, 0x09, 0xCE, 0x4E, 0xA9, 0x3B, 0x87, 0x3C, 0x64,
+    0xE2, 0x03, 0x37, 0x3B, 0x2C, 0xDC, 0x8B, 0xBD, 0x4D, 0x97, 0xEE, 0x59, 0x18, 0x3E, 0xAE, 0x27,
+    0x78, 0xE3, 0x36, 0xE4, 0x74, 0x1E, 0x6D, 0xF8, 0xFB, 0xE2, 0x02, 0x2E, 0x79, 0xFF, 0x76, 0x48,
+    0x5C, 0x2E, 0xF6, 0x8C, 0xF5, 0x5E, 0xE5, 0x5D, 0xBE, 0x83, 0x2D, 0x5D, 0xEC, 0x0E, 0x4B, 0xEF,
+    0xC0, 0x03, 0x26, 0x0F, 0x01, 0xEC, 0x82, 0x6D, 0xF6, 0xEC, 0xF6, 0x9E, 0x6D, 0xF6, 0xFC, 0x3A,
+    0x3F, 0x97, 0x6C, 0xFC, 0x0F, 0x2B, 0xB7, 0xF4, 0xBF, 0x9F, 0x7F, 0x01, 0x85, 0x55, 0x3D, 0x8F,
+    0xDD, 0x54, 0x10, 0x9D, 0xEB, 0x4B, 0x64, 0x29, 0x96, 0x30, 0x05, 0x91, 0x90, 0x28, 0xDC, 0x50,
+    0x90, 0x26, 0xFE, 0x03, 0xEC, 0xDA, 0xF9, 0x07, 0x29, 0xD8, 0x14, 0xD4, 0xD4, 0xE4, 0x0F, 0x6C,
+    0xE2, 0xF7, 0x0F, 0x58, 0x04, 0xDB, 0xD3, 0x20, 0xA1, 0x50, 0x6C, 0xBB, 0x42, 0x6F, 0xD7, 0x16,
+    0x94, 0x14, 0xB8, 0xA7, 0xC0, 0x12, 0x4F, 0x02, 0xB6, 0xBA, 0x8A, 0x1C, 0xC9, 0x9B, 0xF8, 0x79,
+    0x38, 0x67, 0xEE, 0xDB, 0x7D, 0x09, 0x12, 0xC2, 0x5A, 0xCF, 0x7D, 0x7B, 0x3D, 0x77, 0x3E, 0xCE,
+    0x9C, 0x99, 0x2B, 0x22, 0xE2, 0xBE, 0xBD, 0x0F, 0x29, 0xBE, 0x7F, 0xCA, 0x25, 0xEB, 0x26, 0x2E,
+    0xF9, 0xC3, 0xC0, 0xA5, 0xF4, 0x03, 0x97, 0x83, 0xB4, 0xE3, 0xA2, 0xDA, 0x43, 0xA6, 0xAA, 0xDC,
+    0x6C, 0x54, 0xB1, 0x99, 0xE8, 0xE6, 0x72, 0x05, 0x75, 0x5D, 0x8D, 0xD8, 0xAB, 0x34, 0xE1, 0x31,
+    0x5D, 0x3C, 0x14, 0x93, 0x65, 0x9D, 0x41, 0x23, 0x9D, 0xC7, 0xBC, 0x86, 0xC6, 0x8B, 0x50, 0xE1,
+    0x53, 0xF1, 0x47, 0x7F, 0x4C, 0xC5, 0x5F, 0xCC, 0x4D, 0xF5, 0xA5, 0xB9, 0x69, 0x1B, 0x73, 0xA3,
+    0x17, 0xE6, 0x46, 0xA7, 0x1C, 0x16, 0x9D, 0x86, 0x52, 0x6C, 0x39, 0x90, 0x1A, 0xCB, 0xB2, 0x7D,
+    0xD2, 0x61, 0xC1, 0xB3, 0x62, 0x20, 0xAA, 0xB0, 0xD9, 0x62, 0x91, 0xDB, 0x05, 0x72, 0x81, 0xD7,
+    0x17, 0xAA, 0x1B, 0x66, 0x73, 0xFC, 0x9F, 0xD9, 0x3C, 0x8D, 0xD9, 0x9C, 0x67, 0x2B, 0x79, 0xEB,
+    0xF9, 0x50, 0x4F, 0xE8, 0x50, 0x27, 0xCB, 0x71, 0xC6, 0x69, 0x3D, 0xFD, 0x0C, 0x87, 0x17, 0x33,
+    0xB1, 0x35, 0x39, 0x9B, 0x55, 0x93, 0x3E, 0x4A, 0xDB, 0x77, 0xA6, 0x23, 0x2A, 0xEE, 0x61, 0x2D,
+    0xD5, 0x4A, 0x5E, 0x8F, 0x52, 0xF6, 0xD2, 0xCC, 0x92, 0x8F, 0xFC, 0x17, 0x4A, 0xC8, 0xC9, 0x69,
+    0x47, 0xCF, 0xCD, 0xEC, 0xC3, 0x7B, 0x52, 0xE8, 0xF5, 0x32, 0xD3, 0x0F, 0x83, 0x8E, 0xF9, 0x54,
+    0x4A, 0x48, 0x3D, 0x64, 0x30, 0x78, 0x27, 0xC2, 0xAB, 0x7F, 0xC9, 0xBF, 0x9F, 0x7B, 0x35, 0x81,
+    0x64, 0x11, 0x52, 0x53, 0x6D, 0x37, 0xE9, 0x20, 0x7E, 0x92, 0x44, 0xE8, 0x05, 0x8F, 0xA5, 0xEE,
+    0x2C, 0xE5, 0x9B, 0xC2, 0x01, 0x35, 0x28, 0x23, 0xD6, 0xD2, 0x8E, 0xB0, 0x3E, 0xD0, 0xA6, 0xA1,
+    0xBB, 0xED, 0xF3, 0xEF, 0xCD, 0xDD, 0x40, 0x6F, 0x04, 0xB2, 0xB0, 0x33, 0x97, 0x76, 0x9C, 0x55,
+    0x95, 0x96, 0x56, 0x4B, 0x22, 0x99, 0x2F, 0xB5, 0x95, 0x59, 0xFF, 0x8E, 0xB5, 0x00, 0x44, 0x96,
+    0x40, 0x7C, 0x1A, 0x16, 0x1D, 0x4A, 0x70, 0x50, 0xE1, 0xC5, 0x4F, 0x0F, 0x7B, 0x25, 0xCC, 0xB5,
+    0xA3, 0xC1, 0x05, 0x9A, 0x10, 0x0E, 0x07, 0x70, 0xB3, 0xC0, 0x58, 0x3A, 0x40, 0x06, 0xA5, 0x59,
+    0x0A, 0x64, 0xD3, 0x9C, 0xF5, 0x09, 0x22, 0xCC, 0x5E, 0x2E, 0x52, 0xE1, 0x8C, 0xE6, 0x21, 0x85,
+    0xCF, 0x22, 0xA8, 0xB4, 0xB5, 0x41, 0x04, 0x48, 0xCA, 0xB8, 0x26, 0x67, 0xCB, 0x0F, 0x4B, 0x7B,
+    0x75, 0x22, 0xDA, 0x55, 0x3F, 0xD3, 0xF0, 0xE4, 0xE7, 0x86, 0x86, 0xEB, 0xEA, 0xD7, 0x91, 0xDE,
+    0x93, 0xC5, 0x0C, 0x03, 0x26, 0x62, 0x39, 0x08, 0x53, 0x47, 0x09, 0x73, 0x72, 0x16, 0x6F, 0x8B,
+    0x33, 0x25, 0x82, 0x20, 0x8B, 0x08, 0xCF, 0x26, 0x66, 0x85, 0x8F, 0xC5, 0x95, 0x55, 0xBE, 0xA7,
+    0x4F, 0x1F, 0x24, 0x1B, 0xC4, 0xCD, 0xE2, 0x26, 0x23, 0x99, 0x0E, 0x8D, 0x5A, 0x75, 0x80, 0x10,
+    0xB2, 0x42, 0x0A, 0x4D, 0x6F, 0xF5, 0x1A, 0x0C, 0xE2, 0xC1, 0xA8, 0x08, 0x0E, 0x55, 0xAF, 0xBE,
+    0x23, 0x56, 0x46, 0xB6, 0x6C, 0xDC, 0xB3, 0x84, 0xC9, 0x12, 0x4E, 0xC3, 0xB7, 0xB2, 0xCF, 0xF9,
+    0xF8, 0x06, 0xA1, 0xE2, 0x67, 0xB5, 0xCF, 0xED, 0x10, 0x31, 0xF5, 0x1A, 0x7F, 0x38, 0x8D, 0xB1,
+    0xCA, 0x8F, 0x67, 0x56, 0x58, 0xF9, 0x44, 0xAC, 0x5F, 0xE5, 0xDD, 0x58, 0x46, 0x49, 0xEB, 0x58,
+    0xD4, 0xA4, 0x13, 0xB3, 0x29, 0x41, 0xD6, 0x12, 0xD9, 0xD0, 0xC2, 0xC3, 0xB5, 0x3C, 0x78, 0x0C,
+    0x0B, 0x85, 0xAE, 0x72, 0x92, 0x21, 0xFF, 0xAA, 0xF6, 0xB4, 0x98, 0x99, 0x65, 0x30, 0x94, 0x45,
+    0x22, 0xE3, 0x88, 0xDE, 0x49, 0x43, 0x21, 0x79, 0x87, 0xFE, 0x4D, 0xB5, 0x4E, 0x03, 0xBB, 0xBA,
+    0x1C, 0x93, 0x59, 0xB6, 0x56, 0x65, 0xD4, 0x87, 0x1D, 0xDD, 0x55, 0x75, 0xD1, 0xCB, 0xFD, 0x34,
+    0x14, 0x3D, 0xB2, 0x2C, 0xD0, 0xB7, 0x01, 0x79, 0x16, 0x3A, 0xA3, 0xD4, 0x5A, 0x67, 0xBA, 0x45,
+    0x57, 0x00, 0xA0, 0xE6, 0x9A, 0xC1, 0xF2, 0xA5, 0x5C, 0x9B, 0x1C, 0x4D, 0x06, 0x4A, 0xD8, 0x06,
+    0x5F, 0xD1, 0x99, 0xC7, 0xF2, 0x08, 0x51, 0x1C, 0xBB, 0x90, 0x75, 0x39, 0x61, 0x9E, 0x8B, 0x7D,
+    0xC5, 0xA1, 0x53, 0x8C, 0x87, 0x38, 0x5D, 0x4D, 0x07, 0x90, 0xCF, 0x26, 0xA4, 0xB6, 0x9E, 0x67,
+    0xC4, 0x7B, 0x31, 0xCD, 0x23, 0xF9, 0x75, 0xC9, 0x46, 0x08, 0x44, 0xAD, 0xED, 0xDB, 0x9E, 0x20,
+    0x13, 0x66, 0x5D, 0x35, 0x94, 0xD2, 0xD4, 0x26, 0xE1, 0x73, 0x6B, 0x72, 0xF7, 0x5C, 0x9E, 0x46,
+    0x88, 0x0D, 0x63, 0x38, 0x45, 0xB3, 0xE2, 0xF8, 0x93, 0x20, 0x13, 0xDA, 0x29, 0xEB, 0xD3, 0x3E,
+    0xEF, 0xD0, 0x52, 0xA5, 0x3C, 0x13, 0x39, 0x94, 0x29, 0x81, 0xA3, 0x91, 0x7B, 0x1F, 0xF9, 0xBE,
+    0x94, 0x43, 0x17, 0x0A, 0x99, 0xDD, 0x98, 0x75, 0x6B, 0x3F, 0x64, 0xDD, 0xA1, 0x1F, 0x8A, 0xBA,
+    0x12, 0xCC, 0xBA, 0xB5, 0x4C, 0x69, 0xF7, 0x81, 0x0F, 0x69, 0x5F, 0x80, 0x4E, 0x38, 0x8D, 0x58,
+    0x2F, 0x70, 0x3A, 0x08, 0xF7, 0xD0, 0xAA, 0x65, 0x57, 0x4A, 0x7E, 0x9D, 0x2E, 0x02, 0xDA, 0x5B,
+    0x37, 0xB2, 0x8B, 0xAC, 0xE8, 0x8F, 0x2F, 0xDF, 0x68, 0xF3, 0xFC, 0xB6, 0x8B, 0xEF, 0x7D, 0xF1,
+    0xA9, 0x45, 0xC9, 0xE1, 0x41, 0x76, 0x0A, 0x27, 0x57, 0x36, 0x8C, 0x3C, 0xF8, 0x3B, 0xBE, 0xBC,
+    0x62, 0xDA, 0xE7, 0xEC, 0x9D, 0x07, 0xA4, 0xA6, 0xEF, 0xC0, 0x57, 0x39, 0x97, 0xB2, 0x06, 0x35,
+    0xC0, 0x61, 0x44, 0xB9, 0x58, 0x7A, 0x46, 0xD0, 0x2D, 0x4D, 0xBD, 0xEE, 0x48, 0x89, 0x8F, 0x45,
+    0xEE, 0x1C, 0x1D, 0x1D, 0x59, 0xDF, 0x07, 0x1B, 0x3F, 0x7B, 0xEF, 0xEE, 0x79, 0x6D, 0xE3, 0xA7,
+    0xDB, 0x4D, 0xC4, 0x6A, 0x73, 0xA7, 0xDE, 0x91, 0xD9, 0xB8, 0x5C, 0x72, 0x26, 0xF8, 0xF0, 0xFE,
+    0xAE, 0x6F, 0x32, 0x1B, 0x98, 0x62, 0x3C, 0xB6, 0x21, 0xC4, 0x1E, 0xE7, 0xB0, 0xE9, 0xC1, 0xA0,
+    0x97, 0xC6, 0x77, 0x23, 0x69, 0xD8, 0xCD, 0x89, 0x9B, 0xC6, 0x68, 0xF7, 0x37, 0x4A, 0xC5, 0x41,
+    0xE2, 0xEC, 0x8E, 0x71, 0xED, 0x7C, 0x03, 0x82, 0x55, 0xDF, 0xDA, 0xEE, 0x27, 0x8A, 0xE5, 0xEE,
+    0x69, 0x16, 0xDC, 0x23, 0xE1, 0x18, 0xB9, 0x09, 0x25, 0xC5, 0x38, 0x85, 0xAF, 0xDF, 0xEC, 0xF2,
+    0x58, 0x0C, 0xCE, 0x13, 0x8A, 0xDE, 0xEE, 0x06, 0x86, 0xF9, 0xE7, 0xF4, 0xB9, 0xC8, 0x3B, 0xA5,
+    0xDE, 0x6A, 0x94, 0x6C, 0xA6, 0xDC, 0xCA, 0x5E, 0xF1, 0x42, 0x71, 0x5F, 0x9B, 0xA5, 0x22, 0xDC,
+    0xF6, 0xA7, 0xB7, 0xA9, 0x56, 0x8C, 0xFB, 0x8D, 0x1D, 0x38, 0x71, 0x58, 0x48, 0x04, 0xCB, 0x2D,
+    0x67, 0x34, 0xEA, 0x41, 0xFF, 0x9E, 0x70, 0x08, 0xCA, 0x9B, 0xDA, 0x84, 0xDA, 0xB2, 0xFF, 0x31,
+    0x3D, 0x24, 0xEF, 0xED, 0xCF, 0x36, 0x71, 0x2B, 0x74, 0x8E, 0xAE, 0xAB, 0x38, 0x35, 0xE3, 0x90,
+    0xDF, 0x4D, 0x0D, 0xD1, 0xAB, 0x6F, 0xF6, 0x57, 0x49, 0x12, 0x27, 0xC6, 0x6E, 0x70, 0xC4, 0xBB,
+    0x66, 0x37, 0x27, 0x30, 0xED, 0x64, 0x3F, 0x3B, 0xA4, 0x8C, 0xF3, 0xA0, 0x7A, 0x6B, 0xB9, 0x19,
+    0x1F, 0xFF, 0xF3, 0xFC, 0x03, 0xB5, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x63, 0x7B,
+    0x91, 0x46, 0x62, 0x52, 0xA0, 0x08, 0xE5, 0x24, 0x2F, 0x25, 0x05, 0xE7, 0x6B, 0x53, 0xD8, 0xDE,
+    0x41, 0x91, 0x48, 0x4B, 0x01, 0x35, 0xF9, 0x0F, 0xD2, 0xA4, 0xB8, 0xE2, 0xA4, 0xDB, 0x08, 0x89,
+    0x96, 0x14, 0x74, 0x08, 0x89, 0x26, 0x8D, 0x1B, 0x1A, 0x17, 0x2E, 0x6C, 0xEF, 0x84, 0x94, 0x6E,
+    0x56, 0x41, 0xA2, 0x9E, 0xC2, 0x48, 0x60, 0xA4, 0xB0, 0x12, 0x2B, 0x73, 0x07, 0xBB, 0x3B, 0x7C,
+    0xEF, 0xCD, 0x5E, 0x30, 0x16, 0x2D, 0xA3, 0xF3, 0x3C, 0xEF, 0xCC, 0xFB, 0xFD, 0xBD, 0xF7, 0x86,
+    0x88, 0x68, 0x9F, 0x78, 0x19, 0xD9, 0xB3, 0x92, 0xF7, 0xB4, 0x96, 0x8F, 0x86, 0xB7, 0xBB, 0x61,
+    0xB0, 0x94, 0x84, 0x10, 0x1A, 0x4A, 0x43, 0xB8, 0xEA, 0x48, 0x85, 0x57, 0x75, 0x82, 0xDD, 0xE2,
+    0x3A, 0x0D, 0x2C, 0x9D, 0x04, 0xBB, 0x0B, 0xCE, 0xAA, 0xD4, 0x96, 0xA8, 0x70, 0xCA, 0x11, 0xCD,
+    0x3C, 0x4B, 0x9B, 0x96, 0x16, 0x44, 0xAA, 0xA3, 0x3D, 0x30, 0x0D, 0xA4, 0x7F, 0x02, 0x93, 0x55,
+    0x21, 0xF8, 0xA2, 0xA6, 0x10, 0x3A, 0xD3, 0xD0, 0x7C, 0x12, 0x70, 0x3D, 0xA5, 0xB5, 0x0D, 0xD6,
+    0xD0, 0x19, 0x15, 0x8D, 0x72, 0x85, 0x35, 0xE1, 0xF9, 0x75, 0x70, 0x60, 0x64, 0xAB, 0x15, 0xF6,
+    0x15, 0x19, 0xEC, 0x03, 0xF1, 0x47, 0x0F, 0x5D, 0xD5, 0xF0, 0x8C, 0x7D, 0x3B, 0x16, 0x37, 0x6F,
+    0xFA, 0x9F, 0x8A, 0xFF, 0x44, 0x9F, 0x7E, 0x15, 0x0F, 0x61, 0x6B, 0xA4, 0xAB, 0x91, 0xF6, 0x4C,
+    0xB7, 0x28, 0x1F, 0x22, 0x63, 0x12, 0x22, 0xA5, 0x0D, 0x1D, 0xCF, 0xA9, 0x8F, 0x24, 0xED, 0xA2,
+    0x18, 0x56, 0x47, 0x33, 0xA1, 0x2D, 0x15, 0x21, 0xBA, 0x76, 0x6B, 0xA5, 0x72, 0x1C, 0xBC, 0x8E,
+    0xD4, 0x45, 0xB1, 0x60, 0x67, 0xA3, 0x6E, 0xA6, 0xDB, 0x42, 0xAF, 0xBE, 0x0B, 0x42, 0xF9, 0x76,
+    0x54, 0x8F, 0xA4, 0x65, 0x23, 0x95, 0x90, 0x19, 0x82, 0x9D, 0x10, 0xD6, 0xB7, 0x8D, 0xD0, 0x6E,
+    0x0C, 0x9C, 0xB3, 0x9C, 0xE3, 0x27, 0x79, 0x82, 0x47, 0x9F, 0xA4, 0xFD, 0x9C, 0xF2, 0x57, 0x35,
+    0x9D, 0x1B, 0x52, 0xCD, 0x3E, 0xE5, 0x4F, 0x3D, 0x9D, 0x69, 0xAB, 0xDA, 0x7D, 0x32, 0xB5, 0xA7,
+    0xE2, 0xC2, 0x52, 0x35, 0x7C, 0x0B, 0x20, 0xEB, 0x94, 0x8D, 0x54, 0xBD, 0xE0, 0x9B, 0xB0, 0xC6,
+    0x7B, 0x47, 0x58, 0xA5, 0x78, 0xBD, 0xA2, 0xFF, 0x58, 0x7C, 0x7D, 0x04, 0x4B, 0x1C, 0xB3, 0x80,
+    0xC2, 0x39, 0x9A, 0x49, 0xA6, 0x55, 0x2B, 0x1C, 0x4B, 0xD9, 0x75, 0x73, 0x23, 0x83, 0xB9, 0xD4,
+    0x90, 0xEA, 0xE4, 0xA3, 0x10, 0x66, 0xDD, 0xDE, 0xC8, 0x74, 0x2E, 0xCC, 0x69, 0x64, 0x2E, 0x84,
+    0x39, 0x8B, 0xCC, 0x92, 0x02, 0xAE, 0x1D, 0x49, 0x69, 0xBC, 0x8F, 0x9A, 0x39, 0x3D, 0x4B, 0x86,
+    0x54, 0xBB, 0xB1, 0x3C, 0xA7, 0xAC, 0xD6, 0x12, 0x0E, 0xEB, 0x19, 0x23, 0x92, 0x20, 0x80, 0x9D,
+    0x0E, 0x62, 0xA0, 0x0C, 0x50, 0x01, 0xFD, 0xDB, 0x9F, 0x41, 0x3B, 0x5F, 0x88, 0x9B, 0x39, 0x44,
+    0x51, 0x78, 0xE2, 0x99, 0x80, 0x5F, 0xB9, 0x37, 0xFA, 0xB1, 0x4E, 0xD9, 0x1A, 0x9B, 0x2F, 0x1F,
+    0x51, 0xF6, 0x23, 0x6B, 0xEA, 0xF1, 0xD7, 0x02, 0x23, 0x4B, 0x3A, 0xD8, 0x3B, 0xEA, 0xEB, 0x17,
+    0x27, 0xA4, 0xFE, 0xEA, 0x20, 0xBB, 0xC6, 0x41, 0x8D, 0x0B, 0x52, 0x3F, 0xFC, 0xE6, 0x94, 0x7F,
+    0xE8, 0x75, 0x93, 0x36, 0x08, 0xAB, 0xAF, 0x6A, 0xE0, 0x51, 0x52, 0xFE, 0xF3, 0xAD, 0x3C, 0x1E,
+    0xBF, 0xA9, 0x56, 0x29, 0x56, 0x5D, 0x4B, 0x0D, 0xA0, 0x00, 0x96, 0xEC, 0xEA, 0x92, 0xD3, 0x5A,
+    0xBC, 0x9E, 0x39, 0x9A, 0x5D, 0x3C, 0x68, 0xC8, 0xBC, 0x74, 0x1D, 0x58, 0x9A, 0x3D, 0xA0, 0x39,
+    0x37, 0x96, 0xDA, 0xA9, 0xAA, 0x69, 0x61, 0xD0, 0x75, 0x7B, 0xCA, 0x9D, 0x90, 0xF9, 0xB0, 0x39,
+    0x40, 0x0D, 0x9C, 0x18, 0x4A, 0x9A, 0x69, 0xE6, 0xE8, 0xD4, 0xA4, 0x9E, 0x0E, 0x95, 0x83, 0xA7,
+    0x4F, 0xFD, 0x82, 0x54, 0x7D, 0xBC, 0x37, 0xA6, 0xEC, 0x92, 0x61, 0xE0, 0xEA, 0x45, 0xEC, 0x57,
+    0x42, 0x7A, 0xCA, 0x90, 0x5C, 0xD5, 0x90, 0xF6, 0x92, 0x8F, 0xBC, 0x14, 0xD0, 0xCE, 0x05, 0x4E,
+    0x1C, 0xF3, 0x59, 0xE1, 0x18, 0xA8, 0x49, 0x1F, 0x61, 0xF7, 0x52, 0x92, 0x43, 0xAC, 0xF0, 0x92,
+    0x0B, 0xF6, 0xC8, 0xB2, 0x3E, 0x69, 0x2E, 0xF4, 0xF4, 0x58, 0xCC, 0x5E, 0x20, 0x0A, 0xB1, 0x92,
+    0xD9, 0x92, 0x8A, 0xF0, 0x46, 0x2C, 0x25, 0xD3, 0xEC, 0x4B, 0x3C, 0x8B, 0x60, 0x57, 0x51, 0x05,
+    0xD9, 0x11, 0xCC, 0x6C, 0x83, 0xEC, 0xE1, 0x3F, 0x1F, 0x13, 0x7F, 0x40, 0x8F, 0x07, 0xFD, 0x45,
+    0x58, 0x27, 0x1C, 0x4E, 0x81, 0x81, 0x94, 0xAD, 0x36, 0x25, 0xB6, 0x84, 0x64, 0xC2, 0xCD, 0xAA,
+    0xF8, 0xC8, 0xB0, 0xC4, 0x7B, 0xFF, 0xEA, 0x15, 0x29, 0x31, 0xAE, 0x03, 0xCD, 0xBD, 0xDF, 0x9F,
+    0x20, 0xA4, 0xCF, 0xEB, 0x2E, 0x6D, 0x0D, 0x75, 0x05, 0x2D, 0x92, 0xE6, 0x51, 0xEA, 0xD1, 0x05,
+    0xC6, 0x8E, 0xD8, 0x24, 0x6C, 0x5C, 0x73, 0xBD, 0x1E, 0x6C, 0x66, 0xA0, 0xB8, 0x21, 0x5F, 0x74,
+    0x67, 0x33, 0x23, 0x6F, 0x5F, 0x9E, 0x5B, 0x6A, 0x74, 0x78, 0x96, 0xB9, 0x9D, 0xB0, 0xDE, 0xE3,
+    0x0E, 0x46, 0xC8, 0x13, 0xAE, 0xE4, 0xB4, 0x1F, 0xEB, 0x9F, 0xBD, 0xE5, 0xBC, 0xCB, 0x44, 0xE1,
+    0x12, 0xA3, 0x72, 0x34, 0x2B, 0x48, 0x2D, 0x36, 0x0A, 0x55, 0xBD, 0x71, 0x20, 0x1F, 0xEB, 0xE5,
+    0x1D, 0x6A, 0xC9, 0xAE, 0x52, 0xAF, 0xCB, 0x3E, 0x73, 0x4B, 0x34, 0x78, 0xD6, 0xD0, 0xF2, 0xA0,
+    0xE0, 0x9C, 0x33, 0x58, 0x32, 0x42, 0xDA, 0x8D, 0x10, 0xAF, 0x1D, 0x0E, 0x7B, 0x8C, 0x07, 0xA5,
+    0x96, 0xBA, 0x98, 0x0A, 0xCE, 0x06, 0x7D, 0xC0, 0x56, 0xDE, 0xB5, 0xB8, 0xD3, 0x34, 0xF9, 0x63,
+    0x4D, 0x73, 0x7A, 0xF2, 0x78, 0xF8, 0x28, 0x5C, 0x1E, 0x2B, 0x9E, 0x35, 0x93, 0xD0, 0x14, 0x97,
+    0x11, 0x97, 0x88, 0x4F, 0x5E, 0x9E, 0xC9, 0x98, 0x5C, 0x91, 0x50, 0x74, 0xFD, 0x39, 0x2B, 0x87,
+    0xB9, 0x39, 0x45, 0xF7, 0xED, 0x8D, 0x0A, 0x67, 0xDF, 0x97, 0x0E, 0x99, 0x76, 0xC9, 0xF5, 0x85,
+    0x9B, 0x19, 0xF3, 0xD2, 0xDF, 0x37, 0xDF, 0x24, 0xF5, 0x5B, 0x30, 0x16, 0xDD, 0xF1, 0xD2, 0xAF,
+    0xF2, 0x2F, 0x7C, 0xCF, 0x2C, 0xCF, 0x62, 0xA2, 0xFB, 0xF1, 0x93, 0x1D, 0xE5, 0xA3, 0xB7, 0x85,
+    0x39, 0x41, 0xC3, 0xEC, 0x26, 0x7E, 0x9A, 0x3F, 0x78, 0xD1, 0x9A, 0x2F, 0x73, 0xAB, 0x5F, 0xAF,
+    0x50, 0x58, 0x25, 0xA5, 0x00, 0x3A, 0xE1, 0x90, 0xEE, 0x7A, 0xBA, 0x17, 0xBA, 0x2C, 0x0C, 0x1F,
+    0xA7, 0x9C, 0x83, 0x0A, 0x4E, 0xCD, 0x60, 0x3D, 0xFB, 0x7E, 0x00, 0x8A, 0x9A, 0xDF, 0x9E, 0x65,
+    0x9D, 0xA3, 0x51, 0x31, 0x2A, 0x75, 0x8B, 0xCB, 0xF7, 0xA3, 0x93, 0xBF, 0xC8, 0x44, 0xC7, 0x5B,
+    0xB4, 0x53, 0x31, 0x40, 0x93, 0x8E, 0xC7, 0x8C, 0xC3, 0x03, 0x75, 0x0A, 0xDE, 0x87, 0x18, 0x8D,
+    0x76, 0xC1, 0x6F, 0x99, 0x83, 0xAA, 0x53, 0x0C, 0x26, 0xED, 0xE0, 0xF3, 0x09, 0xC5, 0x67, 0x83,
+    0x92, 0x3A, 0xE2, 0xD2, 0x32, 0xF2, 0xCA, 0x1D, 0xD0, 0x7E, 0xDA, 0x64, 0xA5, 0xB1, 0xC7, 0xE8,
+    0x40, 0x84, 0xDF, 0xD0, 0x0C, 0x59, 0xBE, 0x86, 0x54, 0xC7, 0x4F, 0x61, 0xF5, 0xEB, 0x0A, 0xBD,
+    0x62, 0xB7, 0xAB, 0x71, 0xD4, 0x6E, 0xC5, 0x38, 0xA1, 0x40, 0xF9, 0x27, 0xB4, 0x80, 0x60, 0xB9,
+    0x9F, 0xE0, 0xC9, 0x3B, 0x24, 0xF4, 0x70, 0xE2, 0xF1, 0xCC, 0xE1, 0xEA, 0x77, 0xCC, 0x37, 0x8C,
+    0xA1, 0x65, 0xB9, 0xA5, 0xFE, 0xAC, 0x5C, 0x11, 0xFA, 0x34, 0x3C, 0x17, 0xC9, 0xFF, 0x61, 0xFD,
+    0x0D, 0x8D, 0x54, 0x31, 0x73, 0xDC, 0x54, 0x10, 0x5E, 0xE9, 0x31, 0x96, 0x19, 0xE1, 0xBC, 0x2A,
+    0x0C, 0x33, 0x39, 0x5B, 0x0D, 0x05, 0xC5, 0x11, 0x35, 0x57, 0x50, 0x5C, 0x4E, 0x72, 0x28, 0x68,
+    0x53, 0x58, 0x30, 0x0C, 0xFF, 0x80, 0xC6, 0x2E, 0x28, 0x83, 0xA5, 0x54, 0xB4, 0xFE, 0x07, 0x34,
+    0x14, 0x94, 0x2E, 0x53, 0x38, 0xBE, 0x07, 0x94, 0x14, 0x68, 0x86, 0x49, 0x45, 0x81, 0x70, 0x3C,
+    0x93, 0x12, 0x91, 0x51, 0x18, 0x05, 0xA4, 0x7B, 0x7C, 0xBB, 0x4F, 0xBA, 0xF3, 0x65, 0x60, 0x06,
+    0x8D, 0xBD, 0xF7, 0xDE, 0xBE, 0x7D, 0xBB, 0xDF, 0xEE, 0xB7, 0x6F, 0x89, 0xF8, 0xDB, 0x11, 0x79,
+    0xC1, 0x42, 0x1B, 0x08, 0xAF, 0xE6, 0xE5, 0x5D, 0x16, 0x01, 0xEF, 0xA9, 0xCF, 0xB2, 0xEC, 0x41,
+    0x6C, 0xF1, 0x05, 0x25, 0xEF, 0x4F, 0x59, 0x78, 0x3D, 0x4B, 0xC5, 0x5A, 0x13, 0xBE, 0xCC, 0xB2,
+    0x23, 0x8A, 0xC5, 0x38, 0x97, 0xC3, 0x86, 0x65, 0x48, 0x9B, 0xCF, 0x13, 0x39, 0xDD, 0xE3, 0x3B,
+    0xD5, 0x9C, 0xED, 0x0E, 0x3B, 0xF8, 0xEF, 0xC2, 0x96, 0xE8, 0xB2, 0xBE, 0xD7, 0x90, 0x7E, 0x56,
+    0x5C, 0x35, 0xD4, 0xEF, 0x07, 0x1F, 0xD6, 0x91, 0x39, 0x9F, 0x06, 0x7F, 0xB4, 0xCA, 0xD4, 0xE1,
+    0x0F, 0xE9, 0x5E, 0x50, 0xEC, 0x12, 0x9D, 0xBC, 0x8F, 0x2B, 0xBE, 0x61, 0x64, 0xB7, 0x54, 0x01,
+    0x39, 0xDB, 0x67, 0xA7, 0xE6, 0x9C, 0xC3, 0x28, 0x0E, 0xFC, 0xC1, 0x2D, 0x0E, 0x50, 0x7E, 0xC1,
+    0xA8, 0x7D, 0x56, 0xCC, 0xF5, 0x8D, 0xF0, 0xF4, 0x96, 0xA0, 0x15, 0xF8, 0x0B, 0x5A, 0x27, 0xA9,
+    0xD9, 0x15, 0x3D, 0x24, 0x24, 0xF8, 0x49, 0xA5, 0x39, 0x97, 0x74, 0x53, 0x0B, 0x36, 0x0E, 0xEA,
+    0x04, 0xCA, 0xD6, 0xCB, 0xB2, 0x8F, 0x25, 0xDF, 0x24, 0x1D, 0x4F, 0x7C, 0x49, 0x71, 0x6F, 0x1D,
+    0x60, 0x57, 0xCA, 0x38, 0x3B, 0x60, 0x59, 0xCF, 0xD7, 0x68, 0x83, 0xC3, 0x72, 0x8D, 0x79, 0x2A,
+    0x88, 0x4E, 0xA6, 0x6B, 0xA0, 0xAA, 0xA8, 0xC8, 0x4B, 0x19, 0xBF, 0x2E, 0x26, 0x21, 0xCD, 0x23,
+    0x33, 0xDB, 0xF7, 0x5B, 0x5D, 0x56, 0x73, 0x6D, 0xF4, 0x95, 0xA9, 0x3B, 0x0A, 0x9F, 0xFB, 0xBF,
+    0x94, 0x14, 0xAC, 0x82, 0x9E, 0x8B, 0xA5, 0x2B, 0xDC, 0xA9, 0x63, 0x76, 0x5E, 0x9E, 0xB0, 0x2C,
+    0x52, 0xDA, 0xFE, 0xDE, 0xE1, 0xD4, 0x0A, 0x0A, 0x51, 0x00, 0xBF, 0x86, 0xAD, 0x24, 0x23, 0xB9,
+    0x22, 0xD5, 0xC7, 0x2E, 0xEF, 0x87, 0xAE, 0x08, 0x09, 0x92, 0xCE, 0x3E, 0x33, 0xC2, 0xAB, 0xED,
+    0x22, 0xF1, 0xA4, 0xBF, 0xAA, 0x84, 0xB8, 0x2A, 0x77, 0x79, 0x0A, 0xBD, 0xB6, 0xA4, 0xF8, 0x69,
+    0x96, 0xE5, 0x86, 0x7C, 0x50, 0xC6, 0x2C, 0x47, 0x86, 0xE2, 0x42, 0x58, 0x96, 0x02, 0x4E, 0x49,
+    0x0A, 0x3E, 0x7E, 0xAC, 0x8A, 0x71, 0x3F, 0xE0, 0x62, 0xFE, 0xB9, 0x4A, 0x69, 0x71, 0x60, 0xCF,
+    0xF4, 0x77, 0xDF, 0xF7, 0xAA, 0x9D, 0xA8, 0xD4, 0x3E, 0x32, 0x94, 0x7C, 0x3B, 0xA1, 0xE0, 0x0A,
+    0x8B, 0x37, 0xDE, 0x9B, 0x00, 0x28, 0x16, 0xF4, 0xEF, 0x8B, 0xFB, 0x58, 0x9C, 0x62, 0xA1, 0xFE,
+    0xC2, 0x42, 0xB7, 0xD0, 0x24, 0x8F, 0xCC, 0x8C, 0xBA, 0x49, 0x5C, 0xAA, 0xDF, 0x7E, 0x7F, 0x45,
+    0xFA, 0x18, 0x2C, 0xE4, 0xF8, 0xF7, 0xDB, 0x35, 0x19, 0xFE, 0x35, 0xA7, 0x29, 0x44, 0x4A, 0xFE,
+    0x8E, 0x4D, 0x69, 0x67, 0x2D, 0xCA, 0x4D, 0x8F, 0x37, 0xE4, 0xDB, 0x72, 0x0E, 0xA0, 0xFD, 0x5D,
+    0x0A, 0xDA, 0xF0, 0x27, 0xD0, 0x4D, 0xD6, 0xA8, 0x86, 0xA2, 0xD2, 0x6B, 0x79, 0x73, 0xC1, 0x39,
+    0x26, 0x44, 0x1D, 0xBF, 0x8C, 0x27, 0xA4, 0x5A, 0xEF, 0x92, 0x08, 0x15, 0x41, 0x09, 0x58, 0xF8,
+    0x2C, 0xE8, 0xCE, 0xAB, 0x6D, 0x0E, 0x8E, 0x57, 0x05, 0xF3, 0xBF, 0xB4, 0xF6, 0x6B, 0x84, 0xCA,
+    0xED, 0xD2, 0xA2, 0xA8, 0x51, 0x4F, 0x31, 0x37, 0xFC, 0x0A, 0x07, 0xD0, 0x02, 0x1E, 0x34, 0x94,
+    0x54, 0x14, 0xE2, 0x34, 0x68, 0xC9, 0x7F, 0x89, 0x13, 0x78, 0xBB, 0x00, 0xC7, 0x51, 0x89, 0x98,
+    0x3D, 0x29, 0x8E, 0xCA, 0xEB, 0x54, 0xD5, 0x5E, 0x07, 0x38, 0xC0, 0x84, 0xEA, 0x2F, 0xF1, 0xFE,
+    0x00, 0x51, 0x57, 0x51, 0xC1, 0x8F, 0x6D, 0x15, 0x96, 0xA4, 0x6B, 0xD2, 0x2F, 0x1A, 0x52, 0xF0,
+    0x68, 0x7B, 0xE4, 0x8E, 0x5A, 0xD9, 0xB3, 0xB7, 0x6D, 0x23, 0x58, 0x19, 0x63, 0x28, 0xCF, 0xD4,
+    0x6D, 0xA1, 0xE5, 0x9E, 0xEE, 0x98, 0x6D, 0x6B, 0x57, 0xFC, 0x1E, 0x77, 0x2C, 0xA7, 0xF0, 0xEE,
+    0x6B, 0xBD, 0x44, 0x2B, 0x16, 0xB1, 0x74, 0x31, 0xE7, 0x49, 0x7C, 0x95, 0x92, 0x25, 0xF8, 0x0D,
+    0x5F, 0xE0, 0xBA, 0xD7, 0x71, 0x2F, 0x24, 0xFC, 0x8E, 0x75, 0x0D, 0x9C, 0xE8, 0x0E, 0xDC, 0xC8,
+    0x53, 0x46, 0x53, 0x21, 0x17, 0xE0, 0x0F, 0x1B, 0x5A, 0xA6, 0xF8, 0x8B, 0x38, 0x47, 0xEC, 0x29,
+    0x37, 0xC8, 0x5C, 0x75, 0x31, 0x2A, 0x92, 0xFC, 0xCC, 0x68, 0xFA, 0x9C, 0xE5, 0x8F, 0xD6, 0x21,
+    0x92, 0x01, 0x82, 0x65, 0xC5, 0x5D, 0x59, 0x23, 0x51, 0xB4, 0x65, 0xCC, 0xDD, 0xAC, 0x0D, 0xB8,
+    0x54, 0x15, 0x2A, 0x00, 0x42, 0x9E, 0x30, 0xA7, 0x60, 0x25, 0x61, 0x56, 0xA2, 0x22, 0x40, 0x11,
+    0x4B, 0x3C, 0x47, 0x58, 0x74, 0x4C, 0xD5, 0x82, 0xFE, 0xD7, 0x45, 0x3A, 0xA2, 0xDB, 0xE0, 0x25,
+    0x45, 0xFD, 0x54, 0x45, 0x2D, 0xDF, 0x4C, 0xB8, 0x71, 0x71, 0x29, 0xA8, 0x78, 0x80, 0x89, 0x27,
+    0x31, 0x15, 0xF7, 0x70, 0x71, 0x3A, 0xEC, 0xC5, 0xA9, 0xF3, 0xB7, 0x00, 0x00, 0xB7, 0xF7, 0x25,
+    0xFC, 0x97, 0x1C, 0x59, 0x17, 0xF0, 0x28, 0x70, 0x78, 0xA6, 0xB4, 0xCA, 0x8E, 0x2D, 0xD3, 0x70,
+    0x57, 0x18, 0xAF, 0x1A, 0xDB, 0x50, 0x44, 0xC0, 0x0F, 0x46, 0x46, 0x83, 0x08, 0x99, 0x20, 0x73,
+    0x99, 0x14, 0xE3, 0xE1, 0xE3, 0xA1, 0x77, 0x65, 0xAC, 0xC6, 0x32, 0x42, 0x87, 0x49, 0xCB, 0xAE,
+    0x37, 0x8E, 0x47, 0xE2, 0x6E, 0xDF, 0x47, 0x35, 0xF3, 0x8D, 0x42, 0x4B, 0x9F, 0x52, 0x6C, 0xBF,
+    0x59, 0x8F, 0x6F, 0x4E, 0x8F, 0xD6, 0x63, 0x6C, 0x78, 0x29, 0x6E, 0xB2, 0xC9, 0xFB, 0x96, 0x61,
+    0xE7, 0x0C, 0x2F, 0xDD, 0x00, 0x77, 0xF6, 0xAA, 0x95, 0x9F, 0xD0, 0xD9, 0x47, 0x95, 0x33, 0x74,
+    0xF6, 0x4B, 0x7E, 0x5E, 0xBB, 0x24, 0xB1, 0x16, 0xCA, 0xCD, 0xCB, 0x8F, 0xE4, 0x5A, 0xF2, 0x6B,
+    0xE3, 0x00, 0x88, 0x7D, 0xE4, 0x80, 0x69, 0x5B, 0xB8, 0x1F, 0xE7, 0xFF, 0x68, 0x00, 0xFB, 0x29,
+    0xED, 0x9C, 0xC1, 0x57, 0xAF, 0x60, 0x95, 0xD8, 0x1A, 0xD0, 0xF5, 0x75, 0x94, 0x17, 0x35, 0x90,
+    0x26, 0x26, 0x48, 0xEF, 0x31, 0xD6, 0x19, 0x48, 0x5A, 0x50, 0x90, 0x36, 0x3C, 0xD2, 0xCF, 0x35,
+    0x97, 0xFD, 0x80, 0xD0, 0x76, 0x75, 0x58, 0xEA, 0x22, 0xE4, 0x56, 0xB2, 0xF6, 0x6F, 0xDC, 0xC4,
+    0x32, 0xC6, 0xF8, 0x4A, 0xAC, 0x59, 0x22, 0xF2, 0xE7, 0x05, 0x3D, 0x18, 0x4B, 0x14, 0x5F, 0xBB,
+    0x3C, 0x1C, 0x22, 0x5A, 0x1E, 0xA6, 0x6E, 0xF0, 0xD1, 0xCD, 0xCC, 0x95, 0x2B, 0xCE, 0x58, 0x0F,
+    0xE6, 0xFB, 0x46, 0xB1, 0x64, 0x06, 0x6E, 0x2A, 0x89, 0xAE, 0xD9, 0xBA, 0x3C, 0x14, 0x0C, 0xCD,
+    0xB3, 0xA5, 0xF6, 0xDB, 0x81, 0x93, 0xC1, 0x67, 0xBE, 0x1D, 0x6A, 0x54, 0x5F, 0xBE, 0x16, 0x6A,
+    0x50, 0xF7, 0x83, 0x95, 0xA8, 0xDF, 0x24, 0x99, 0x72, 0xFE, 0xF0, 0x74, 0x46, 0xC2, 0xF1, 0xA8,
+    0x5C, 0x4E, 0xD6, 0x45, 0x3E, 0x6E, 0xE9, 0x3F, 0xBE, 0x7F, 0x00, 0x6D, 0x50, 0x31, 0x4E, 0xC3,
+    0x40, 0x10, 0xDC, 0xF3, 0x29, 0xB9, 0xC2, 0xC5, 0x35, 0x88, 0x86, 0xC2, 0x0D, 0x35, 0x79, 0x01,
+    0xD8, 0x4F, 0x48, 0x81, 0x10, 0xE2, 0x09, 0x50, 0xF0, 0x01, 0xA4, 0x4B, 0x7E, 0xC0, 0x27, 0x5C,
+    0xD3, 0xD2, 0x20, 0xFB, 0x09, 0x6E, 0xE8, 0x5D, 0xA4, 0x41, 0x34, 0x2E, 0x5C, 0x04, 0xC9, 0xCE,
+    0x70, 0x3B, 0x26, 0x4A, 0x10, 0x5C, 0x31, 0x7B, 0xDA, 0xDD, 0x99, 0x9D, 0x5D, 0xF1, 0xAD, 0x19,
+    0x25, 0x6F, 0xDC, 0x20, 0xA8, 0x67, 0xD7, 0xF2, 0xE7, 0x55, 0xE2, 0x3B, 0x03, 0xC9, 0x3B, 0xB7,
+    0x13, 0x99, 0x2D, 0x63, 0x26, 0x0C, 0x72, 0x69, 0x86, 0x85, 0x3C, 0xD9, 0xCE, 0xAF, 0xFB, 0xB4,
+    0xB6, 0x68, 0x63, 0xF6, 0xBE, 0x38, 0x70, 0x12, 0x14, 0xA6, 0xF0, 0x9F, 0x8D, 0x6B, 0x72, 0xE9,
+    0xFD, 0xEA, 0x4D, 0x02, 0xE4, 0x56, 0xB2, 0xED, 0x91, 0xEC, 0x39, 0xB1, 0x53, 0xB0, 0x8D, 0x62,
+    0x4A, 0xFE, 0x05, 0xD3, 0xAF, 0x0A, 0x86, 0x45, 0xD7, 0x2C, 0xC5, 0x03, 0xE8, 0x25, 0x8F, 0xA8,
+    0x0A, 0x54, 0xB1, 0x2D, 0x39, 0x2B, 0xC5, 0x8C, 0x9C, 0x00, 0x88, 0x89, 0x2D, 0x10, 0x87, 0x77,
+    0xD5, 0xF2, 0x14, 0xBC, 0x3A, 0x08, 0x26, 0x14, 0x4C, 0x6B, 0xC5, 0xC5, 0xEF, 0x25, 0xE7, 0xC4,
+    0x8C, 0xA5, 0xD0, 0xEB, 0x70, 0xEE, 0xE4, 0xA0, 0x99, 0x0C, 0xAA, 0x14, 0x46, 0xA6, 0x39, 0x9D,
+    0x45, 0xC9, 0xBE, 0xE8, 0x04, 0x3B, 0x2D, 0x9F, 0x01, 0xCF, 0x64, 0x60, 0xA3, 0x7A, 0x80, 0x2E,
+    0x65, 0x2A, 0xB6, 0x9B, 0x6A, 0x9A, 0x52, 0xC8, 0x09, 0xA3, 0x47, 0x49, 0x22, 0xF0, 0x11, 0xA9,
+    0x37, 0x2F, 0x18, 0x99, 0xBE, 0x5B, 0xED, 0xCF, 0x62, 0x7B, 0x86, 0x7C, 0x0A, 0xD5, 0x71, 0x30,
+    0xF8, 0x27, 0x24, 0xF4, 0x29, 0x8F, 0xDB, 0x69, 0xB4, 0x7E, 0xD5, 0xD5, 0x9C, 0x07, 0xB3, 0x93,
+    0xB3, 0x40, 0xB7, 0x7E, 0xF3, 0xE3, 0x64, 0xFF, 0xD4, 0x91, 0x79, 0x88, 0xFC, 0xD3, 0x0A, 0x18,
+    0xF4, 0xD4, 0x65, 0x21, 0x49, 0xC9, 0x86, 0x6F,
+};
+
+static const uint32_t opendyslexic_14_italicBlockOffsets[45] = {
+    0, 971, 2001, 2999, 3916, 5007, 6164, 7150,
+    7939, 8417, 9060, 9900, 10805, 11564, 12421, 13217,
+    14073, 14954, 15789, 16535, 17399, 18301, 19180, 19968,
+    21040, 22006, 22985, 23918, 25134, 26211, 27321, 28435,
+    29476, 30609, 31510, 32465, 33432, 34283, 35246, 36231,
+    37244, 38309, 39377, 40411, 40696,
+};
+
+static const uint16_t opendyslexic_14_italicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_14_italicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_14_italicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
@@ -5365,712 +2713,712 @@ static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
     { 19, 22, 19, 3, 22, 105, 1674 }, // 0
     { 14, 22, 17, 2, 22, 77, 1779 }, // 1
     { 20, 22, 19, 2, 22, 110, 1856 }, // 2
-    { 20, 22, 19, 2, 22, 110, 1966 }, // 3
-    { 16, 22, 19, 4, 22, 88, 2076 }, // 4
-    { 19, 23, 18, 2, 23, 110, 2164 }, // 5
-    { 19, 22, 19, 3, 22, 105, 2274 }, // 6
-    { 15, 22, 18, 7, 22, 83, 2379 }, // 7
-    { 20, 22, 20, 2, 22, 110, 2462 }, // 8
-    { 19, 22, 19, 3, 22, 105, 2572 }, // 9
-    { 10, 18, 8, 1, 18, 45, 2677 }, // :
-    { 12, 22, 9, 0, 17, 66, 2722 }, // ;
-    { 22, 17, 23, -1, 18, 94, 2788 }, // <
-    { 16, 10, 18, 3, 13, 40, 2882 }, // =
-    { 22, 17, 23, 2, 18, 94, 2922 }, // >
-    { 18, 33, 17, 5, 33, 149, 3016 }, // ?
-    { 29, 25, 35, 4, 23, 182, 3165 }, // @
-    { 23, 25, 29, 1, 25, 144, 3347 }, // A
-    { 22, 25, 24, 1, 25, 138, 3491 }, // B
-    { 25, 27, 25, 1, 26, 169, 3629 }, // C
-    { 25, 25, 28, 1, 25, 157, 3798 }, // D
-    { 23, 25, 23, 1, 25, 144, 3955 }, // E
-    { 21, 25, 21, 1, 25, 132, 4099 }, // F
-    { 25, 26, 29, 2, 26, 163, 4231 }, // G
-    { 27, 25, 27, 1, 25, 169, 4394 }, // H
-    { 12, 25, 12, 1, 25, 75, 4563 }, // I
-    { 21, 33, 18, -1, 26, 174, 4638 }, // J
-    { 23, 25, 26, 1, 25, 144, 4812 }, // K
-    { 18, 25, 22, 1, 25, 113, 4956 }, // L
-    { 31, 25, 32, 1, 25, 194, 5069 }, // M
-    { 28, 25, 27, 1, 25, 175, 5263 }, // N
-    { 28, 26, 29, 2, 25, 182, 5438 }, // O
-    { 23, 25, 23, 1, 25, 144, 5620 }, // P
-    { 29, 29, 31, 1, 25, 211, 5764 }, // Q
-    { 22, 25, 24, 1, 25, 138, 5975 }, // R
-    { 25, 27, 29, 1, 26, 169, 6113 }, // S
-    { 23, 25, 27, 6, 25, 144, 6282 }, // T
-    { 26, 26, 27, 2, 25, 169, 6426 }, // U
-    { 24, 25, 30, 7, 25, 150, 6595 }, // V
-    { 33, 25, 37, 6, 25, 207, 6745 }, // W
-    { 29, 25, 29, 1, 25, 182, 6952 }, // X
-    { 21, 25, 27, 7, 25, 132, 7134 }, // Y
-    { 29, 25, 29, 1, 25, 182, 7266 }, // Z
-    { 21, 41, 14, -1, 31, 216, 7448 }, // [
-    { 5, 28, 14, 7, 23, 35, 7664 }, // <backslash>
-    { 20, 41, 14, -6, 31, 205, 7699 }, // ]
-    { 13, 6, 16, 5, 26, 20, 7904 }, // ^
-    { 21, 4, 23, 0, -2, 21, 7924 }, // _
-    { 9, 5, 12, 7, 22, 12, 7945 }, // `
-    { 18, 18, 22, 1, 18, 81, 7957 }, // a
-    { 18, 26, 23, 3, 25, 117, 8038 }, // b
-    { 15, 18, 20, 2, 17, 68, 8155 }, // c
-    { 23, 26, 23, 1, 25, 150, 8223 }, // d
-    { 18, 17, 22, 2, 17, 77, 8373 }, // e
-    { 14, 24, 16, 3, 24, 84, 8450 }, // f
-    { 21, 24, 22, 0, 16, 126, 8534 }, // g
-    { 19, 25, 22, 1, 25, 119, 8660 }, // h
-    { 11, 26, 11, 1, 26, 72, 8779 }, // i
-    { 19, 32, 19, 2, 25, 152, 8851 }, // j
-    { 16, 24, 22, 1, 24, 96, 9003 }, // k
-    { 11, 24, 14, 1, 24, 66, 9099 }, // l
-    { 29, 16, 32, 1, 16, 116, 9165 }, // m
-    { 18, 17, 22, 1, 17, 77, 9281 }, // n
-    { 18, 16, 22, 2, 16, 72, 9358 }, // o
-    { 23, 24, 24, -1, 16, 138, 9430 }, // p
-    { 20, 25, 26, 2, 18, 125, 9568 }, // q
-    { 15, 17, 17, 1, 17, 64, 9693 }, // r
-    { 17, 16, 21, 1, 16, 68, 9757 }, // s
-    { 13, 22, 19, 4, 22, 72, 9825 }, // t
-    { 18, 17, 21, 2, 16, 77, 9897 }, // u
-    { 18, 16, 24, 5, 16, 72, 9974 }, // v
-    { 23, 16, 28, 5, 16, 92, 10046 }, // w
-    { 22, 16, 24, 1, 16, 88, 10138 }, // x
-    { 22, 24, 23, 0, 16, 132, 10226 }, // y
-    { 20, 16, 22, 1, 16, 80, 10358 }, // z
-    { 16, 27, 16, 4, 22, 108, 10438 }, // {
-    { 10, 25, 7, 1, 21, 63, 10546 }, // |
-    { 16, 27, 18, 0, 22, 108, 10609 }, // }
-    { 13, 6, 17, 5, 22, 20, 10717 }, // ~
-    { 0, 0, 25, 0, 0, 0, 10737 }, //  
-    { 11, 29, 13, 3, 22, 80, 10737 }, // ¡
-    { 15, 25, 20, 2, 22, 94, 10817 }, // ¢
-    { 23, 27, 20, 1, 27, 156, 10911 }, // £
-    { 18, 15, 20, 3, 18, 68, 11067 }, // ¤
-    { 22, 24, 22, 4, 22, 132, 11135 }, // ¥
-    { 10, 25, 7, 1, 21, 63, 11267 }, // ¦
-    { 23, 25, 24, 1, 22, 144, 11330 }, // §
-    { 14, 5, 16, 6, 23, 18, 11474 }, // ¨
-    { 13, 11, 16, 7, 26, 36, 11492 }, // ©
-    { 10, 10, 12, 5, 22, 25, 11528 }, // ª
-    { 19, 14, 24, 3, 14, 67, 11553 }, // «
-    { 14, 9, 18, 4, 10, 32, 11620 }, // ¬
-    { 14, 3, 16, 4, 10, 11, 11652 }, // ­
-    { 13, 11, 16, 8, 31, 36, 11663 }, // ®
-    { 11, 3, 15, 7, 21, 9, 11699 }, // ¯
-    { 15, 14, 16, 5, 23, 53, 11708 }, // °
-    { 17, 17, 21, 1, 16, 73, 11761 }, // ±
-    { 10, 11, 9, 3, 24, 28, 11834 }, // ²
-    { 10, 11, 9, 3, 23, 28, 11862 }, // ³
-    { 7, 6, 8, 6, 23, 11, 11890 }, // ´
-    { 21, 19, 21, -1, 16, 100, 11901 }, // µ
-    { 20, 24, 18, 1, 21, 120, 12001 }, // ¶
-    { 6, 5, 8, 3, 12, 8, 12121 }, // ·
-    { 8, 8, 10, 0, 1, 16, 12129 }, // ¸
-    { 8, 11, 8, 3, 24, 22, 12145 }, // ¹
-    { 10, 9, 12, 5, 21, 23, 12167 }, // º
-    { 20, 14, 19, -4, 14, 70, 12190 }, // »
-    { 24, 28, 32, 7, 26, 168, 12260 }, // ¼
-    { 25, 27, 32, 7, 25, 169, 12428 }, // ½
-    { 25, 27, 32, 6, 25, 169, 12597 }, // ¾
-    { 19, 32, 17, -2, 17, 152, 12766 }, // ¿
-    { 23, 33, 29, 1, 33, 190, 12918 }, // À
-    { 25, 38, 29, 1, 38, 238, 13108 }, // Á
-    { 25, 32, 29, 1, 32, 200, 13346 }, // Â
-    { 26, 33, 29, 1, 33, 215, 13546 }, // Ã
-    { 27, 33, 29, 1, 33, 223, 13761 }, // Ä
-    { 24, 35, 29, 1, 35, 210, 13984 }, // Å
-    { 38, 26, 42, 1, 25, 247, 14194 }, // Æ
-    { 25, 33, 25, 1, 26, 207, 14441 }, // Ç
-    { 23, 32, 23, 1, 32, 184, 14648 }, // È
-    { 23, 38, 23, 1, 38, 219, 14832 }, // É
-    { 23, 32, 23, 1, 32, 184, 15051 }, // Ê
-    { 24, 33, 23, 1, 33, 198, 15235 }, // Ë
-    { 14, 35, 12, 1, 35, 123, 15433 }, // Ì
-    { 17, 40, 12, 1, 40, 170, 15556 }, // Í
-    { 16, 34, 12, 1, 34, 136, 15726 }, // Î
-    { 18, 35, 12, 1, 35, 158, 15862 }, // Ï
-    { 26, 25, 28, 0, 25, 163, 16020 }, // Ð
-    { 28, 32, 27, 1, 32, 224, 16183 }, // Ñ
-    { 28, 34, 29, 2, 33, 238, 16407 }, // Ò
-    { 28, 39, 29, 2, 38, 273, 16645 }, // Ó
-    { 28, 33, 29, 2, 32, 231, 16918 }, // Ô
-    { 28, 34, 29, 2, 33, 238, 17149 }, // Õ
-    { 28, 34, 29, 2, 33, 238, 17387 }, // Ö
-    { 14, 8, 17, 3, 11, 28, 17625 }, // ×
-    { 50, 49, 29, -10, 37, 613, 17653 }, // Ø
-    { 26, 35, 27, 2, 34, 228, 18266 }, // Ù
-    { 26, 39, 27, 2, 38, 254, 18494 }, // Ú
-    { 26, 33, 27, 2, 32, 215, 18748 }, // Û
-    { 26, 35, 27, 2, 34, 228, 18963 }, // Ü
-    { 21, 39, 27, 7, 39, 205, 19191 }, // Ý
-    { 19, 23, 16, 1, 23, 110, 19396 }, // Þ
-    { 20, 23, 20, 2, 23, 115, 19506 }, // ß
-    { 18, 24, 22, 1, 24, 108, 19621 }, // à
-    { 18, 28, 22, 1, 28, 126, 19729 }, // á
-    { 20, 24, 22, 1, 24, 120, 19855 }, // â
-    { 19, 23, 22, 1, 23, 110, 19975 }, // ã
-    { 20, 24, 22, 1, 24, 120, 20085 }, // ä
-    { 18, 26, 22, 1, 26, 117, 20205 }, // å
-    { 30, 18, 36, 1, 18, 135, 20322 }, // æ
-    { 15, 24, 20, 2, 17, 90, 20457 }, // ç
-    { 18, 27, 22, 2, 27, 122, 20547 }, // è
-    { 19, 32, 22, 2, 32, 152, 20669 }, // é
-    { 19, 26, 22, 2, 26, 124, 20821 }, // ê
-    { 20, 27, 22, 2, 27, 135, 20945 }, // ë
-    { 11, 24, 11, 1, 24, 66, 21080 }, // ì
-    { 14, 29, 11, 1, 29, 102, 21146 }, // í
-    { 14, 23, 11, 1, 23, 81, 21248 }, // î
-    { 15, 25, 11, 1, 25, 94, 21329 }, // ï
-    { 25, 23, 24, 3, 23, 144, 21423 }, // ð
-    { 21, 25, 22, 1, 25, 132, 21567 }, // ñ
-    { 18, 26, 22, 2, 26, 117, 21699 }, // ò
-    { 19, 31, 22, 2, 31, 148, 21816 }, // ó
-    { 19, 25, 22, 2, 25, 119, 21964 }, // ô
-    { 19, 26, 22, 2, 26, 124, 22083 }, // õ
-    { 20, 26, 22, 2, 26, 130, 22207 }, // ö
-    { 19, 18, 22, 4, 18, 86, 22337 }, // ÷
-    { 29, 45, 22, -4, 30, 327, 22423 }, // ø
-    { 18, 25, 21, 2, 24, 113, 22750 }, // ù
-    { 18, 30, 21, 2, 29, 135, 22863 }, // ú
-    { 18, 24, 21, 2, 23, 108, 22998 }, // û
-    { 19, 25, 21, 2, 24, 119, 23106 }, // ü
-    { 22, 39, 23, 0, 31, 215, 23225 }, // ý
-    { 18, 30, 16, 1, 24, 135, 23440 }, // þ
-    { 23, 35, 23, 0, 27, 202, 23575 }, // ÿ
-    { 26, 32, 29, 1, 32, 208, 23777 }, // Ā
-    { 20, 22, 22, 1, 22, 110, 23985 }, // ā
-    { 26, 36, 29, 1, 36, 234, 24095 }, // Ă
-    { 20, 26, 22, 1, 26, 130, 24329 }, // ă
-    { 23, 32, 29, 1, 25, 184, 24459 }, // Ą
-    { 18, 23, 22, 1, 18, 104, 24643 }, // ą
-    { 25, 39, 25, 1, 38, 244, 24747 }, // Ć
-    { 17, 28, 20, 2, 27, 119, 24991 }, // ć
-    { 26, 37, 25, 1, 36, 241, 25110 }, // Ĉ
-    { 19, 25, 20, 2, 24, 119, 25351 }, // ĉ
-    { 25, 37, 25, 1, 36, 232, 25470 }, // Ċ
-    { 15, 26, 20, 2, 25, 98, 25702 }, // ċ
-    { 25, 39, 25, 1, 38, 244, 25800 }, // Č
-    { 17, 27, 20, 2, 26, 115, 26044 }, // č
-    { 25, 36, 28, 1, 36, 225, 26159 }, // Ď
-    { 28, 26, 23, 1, 25, 182, 26384 }, // ď
-    { 26, 25, 28, 0, 25, 163, 26566 }, // Đ
-    { 27, 26, 23, 1, 25, 176, 26729 }, // đ
-    { 23, 32, 23, 1, 32, 184, 26905 }, // Ē
-    { 20, 26, 22, 2, 26, 130, 27089 }, // ē
-    { 23, 35, 23, 1, 35, 202, 27219 }, // Ĕ
-    { 20, 30, 22, 2, 30, 150, 27421 }, // ĕ
-    { 23, 34, 23, 1, 34, 196, 27571 }, // Ė
-    { 18, 28, 22, 2, 28, 126, 27767 }, // ė
-    { 23, 31, 23, 1, 25, 179, 27893 }, // Ę
-    { 18, 24, 22, 2, 17, 108, 28072 }, // ę
-    { 23, 35, 23, 1, 35, 202, 28180 }, // Ě
-    { 19, 30, 22, 2, 30, 143, 28382 }, // ě
-    { 26, 34, 29, 2, 34, 221, 28525 }, // Ĝ
-    { 22, 32, 22, 0, 24, 176, 28746 }, // ĝ
-    { 26, 36, 29, 2, 36, 234, 28922 }, // Ğ
-    { 21, 34, 22, 0, 26, 179, 29156 }, // ğ
-    { 25, 34, 29, 2, 34, 213, 29335 }, // Ġ
-    { 21, 33, 22, 0, 25, 174, 29548 }, // ġ
-    { 25, 39, 29, 2, 26, 244, 29722 }, // Ģ
-    { 21, 35, 22, 0, 27, 184, 29966 }, // ģ
-    { 27, 33, 27, 1, 33, 223, 30150 }, // Ĥ
-    { 19, 31, 22, 1, 31, 148, 30373 }, // ĥ
-    { 27, 24, 27, 1, 24, 162, 30521 }, // Ħ
-    { 19, 25, 22, 1, 25, 119, 30683 }, // ħ
-    { 17, 36, 12, 1, 36, 153, 30802 }, // Ĩ
-    { 14, 25, 11, 1, 25, 88, 30955 }, // ĩ
-    { 18, 34, 12, 1, 34, 153, 31043 }, // Ī
-    { 15, 23, 11, 1, 23, 87, 31196 }, // ī
-    { 14, 31, 18, 3, 25, 109, 31283 }, // Į
-    { 13, 32, 11, -1, 26, 104, 31392 }, // į
-    { 14, 36, 12, 1, 36, 126, 31496 }, // İ
-    { 8, 17, 11, 1, 17, 34, 31622 }, // ı
-    { 23, 32, 27, 1, 25, 184, 31656 }, // Ĳ
-    { 27, 34, 11, 1, 26, 230, 31840 }, // ĳ
-    { 24, 40, 18, -1, 33, 240, 32070 }, // Ĵ
-    { 24, 31, 19, 2, 24, 186, 32310 }, // ĵ
-    { 23, 36, 26, 1, 25, 207, 32496 }, // Ķ
-    { 16, 38, 22, 1, 24, 152, 32703 }, // ķ
-    { 14, 16, 16, 0, 16, 56, 32855 }, // ĸ
-    { 18, 35, 22, 1, 35, 158, 32911 }, // Ĺ
-    { 16, 34, 14, 1, 34, 136, 33069 }, // ĺ
-    { 18, 38, 22, 1, 25, 171, 33205 }, // Ļ
-    { 12, 37, 14, 0, 24, 111, 33376 }, // ļ
-    { 19, 25, 22, 1, 25, 119, 33487 }, // Ľ
-    { 18, 25, 14, 1, 25, 113, 33606 }, // ľ
-    { 20, 25, 22, 1, 25, 125, 33719 }, // Ŀ
-    { 16, 25, 14, 1, 25, 100, 33844 }, // ŀ
-    { 40, 37, 22, -14, 30, 370, 33944 }, // Ł
-    { 28, 24, 14, -10, 24, 168, 34314 }, // ł
-    { 28, 35, 27, 1, 35, 245, 34482 }, // Ń
-    { 20, 28, 22, 1, 28, 140, 34727 }, // ń
-    { 28, 36, 27, 1, 25, 252, 34867 }, // Ņ
-    { 18, 28, 22, 1, 17, 126, 35119 }, // ņ
-    { 28, 35, 27, 1, 35, 245, 35245 }, // Ň
-    { 20, 28, 22, 1, 28, 140, 35490 }, // ň
-    { 20, 30, 20, -3, 30, 150, 35630 }, // ŉ
-    { 28, 32, 27, 1, 25, 224, 35780 }, // Ŋ
-    { 18, 22, 22, 1, 17, 99, 36004 }, // ŋ
-    { 28, 33, 29, 2, 32, 231, 36103 }, // Ō
-    { 20, 25, 22, 2, 25, 125, 36334 }, // ō
-    { 28, 36, 29, 2, 35, 252, 36459 }, // Ŏ
-    { 20, 29, 22, 2, 29, 145, 36711 }, // ŏ
-    { 29, 35, 29, 2, 34, 254, 36856 }, // Ő
-    { 23, 27, 22, 2, 27, 156, 37110 }, // ő
-    { 38, 25, 35, 2, 25, 238, 37266 }, // Œ
-    { 30, 17, 31, 2, 17, 128, 37504 }, // œ
-    { 22, 34, 24, 1, 34, 187, 37632 }, // Ŕ
-    { 15, 25, 17, 1, 25, 94, 37819 }, // ŕ
-    { 22, 39, 24, 1, 25, 215, 37913 }, // Ŗ
-    { 18, 32, 17, -2, 17, 144, 38128 }, // ŗ
-    { 22, 34, 24, 1, 34, 187, 38272 }, // Ř
-    { 15, 25, 17, 1, 25, 94, 38459 }, // ř
-    { 25, 38, 29, 1, 37, 238, 38553 }, // Ś
-    { 17, 27, 21, 1, 27, 115, 38791 }, // ś
-    { 26, 35, 29, 1, 34, 228, 38906 }, // Ŝ
-    { 19, 24, 21, 1, 24, 114, 39134 }, // ŝ
-    { 25, 33, 29, 1, 26, 207, 39248 }, // Ş
-    { 17, 24, 21, 1, 16, 102, 39455 }, // ş
-    { 25, 38, 29, 1, 37, 238, 39557 }, // Š
-    { 17, 27, 21, 1, 27, 115, 39795 }, // š
-    { 23, 31, 27, 6, 25, 179, 39910 }, // Ţ
-    { 13, 28, 19, 4, 22, 91, 40089 }, // ţ
-    { 23, 35, 27, 6, 35, 202, 40180 }, // Ť
-    { 17, 25, 19, 4, 25, 107, 40382 }, // ť
-    { 23, 25, 27, 6, 25, 144, 40489 }, // Ŧ
-    { 15, 22, 19, 2, 22, 83, 40633 }, // ŧ
-    { 26, 36, 27, 2, 35, 234, 40716 }, // Ũ
-    { 18, 26, 21, 2, 25, 117, 40950 }, // ũ
-    { 26, 34, 27, 2, 33, 221, 41067 }, // Ū
-    { 19, 24, 21, 2, 23, 114, 41288 }, // ū
-    { 26, 37, 27, 2, 36, 241, 41402 }, // Ŭ
-    { 19, 27, 21, 2, 26, 129, 41643 }, // ŭ
-    { 26, 38, 27, 2, 37, 247, 41772 }, // Ů
-    { 18, 28, 21, 2, 27, 126, 42019 }, // ů
-    { 28, 36, 27, 2, 35, 252, 42145 }, // Ű
-    { 22, 26, 21, 2, 25, 143, 42397 }, // ű
-    { 26, 31, 27, 2, 25, 202, 42540 }, // Ų
-    { 18, 23, 21, 2, 16, 104, 42742 }, // ų
-    { 33, 32, 37, 6, 32, 264, 42846 }, // Ŵ
-    { 23, 24, 28, 5, 24, 138, 43110 }, // ŵ
-    { 21, 33, 27, 7, 33, 174, 43248 }, // Ŷ
-    { 22, 33, 23, 0, 25, 182, 43422 }, // ŷ
-    { 21, 34, 27, 7, 34, 179, 43604 }, // Ÿ
-    { 29, 35, 29, 1, 35, 254, 43783 }, // Ź
-    { 20, 27, 22, 1, 27, 135, 44037 }, // ź
-    { 29, 33, 29, 1, 33, 240, 44172 }, // Ż
-    { 20, 25, 22, 1, 25, 125, 44412 }, // ż
-    { 29, 35, 29, 1, 35, 254, 44537 }, // Ž
-    { 20, 27, 22, 1, 27, 135, 44791 }, // ž
-    { 16, 24, 15, 4, 24, 96, 44926 }, // ſ
-    { 9, 5, 0, 7, 22, 12, 45022 }, // ̀
-    { 7, 6, 0, 6, 23, 11, 45034 }, // ́
-    { 13, 6, 0, -1, 0, 20, 45045 }, // ̂
-    { 13, 6, 0, 5, 22, 20, 45065 }, // ̃
-    { 14, 4, 0, 5, 20, 14, 45085 }, // ̄
-    { 19, 4, 0, 9, 26, 19, 45099 }, // ̅
-    { 13, 6, 0, 6, 21, 20, 45118 }, // ̆
-    { 6, 5, 0, 6, 22, 8, 45138 }, // ̇
-    { 14, 5, 0, 6, 23, 18, 45146 }, // ̈
-    { 7, 6, 0, 5, 19, 11, 45164 }, // ̉
-    { 8, 6, 0, 6, 22, 12, 45175 }, // ̊
-    { 20, 5, 0, 6, 22, 25, 45187 }, // ̋
-    { 12, 6, 0, 6, 22, 18, 45212 }, // ̌
-    { 21, 5, 0, -9, 24, 27, 45230 }, // ̏
-    { 10, 9, 0, 4, 22, 23, 45257 }, // ̒
-    { 10, 9, 0, 4, 22, 23, 45280 }, // ̓
-    { 10, 9, 0, -5, 22, 23, 45303 }, // ̔
-    { 7, 7, 0, 0, -1, 13, 45326 }, // ̘
-    { 7, 7, 0, 2, -1, 13, 45339 }, // ̙
-    { 12, 7, 0, 8, 23, 21, 45352 }, // ̚
-    { 6, 7, 0, 5, 19, 11, 45373 }, // ̛
-    { 5, 6, 0, 0, -2, 8, 45384 }, // ̜
-    { 7, 6, 0, 3, 5, 11, 45392 }, // ̝
-    { 7, 6, 0, 0, -1, 11, 45403 }, // ̞
-    { 7, 7, 0, 0, -2, 13, 45414 }, // ̟
-    { 14, 4, 0, 0, -4, 14, 45427 }, // ̠
-    { 6, 5, 0, 0, 1, 8, 45441 }, // ̣
-    { 15, 5, 0, -1, -1, 19, 45449 }, // ̤
-    { 8, 6, 0, 6, 22, 12, 45468 }, // ̥
-    { 10, 10, 0, 0, 5, 25, 45480 }, // ̦
-    { 8, 8, 0, 0, 1, 16, 45505 }, // ̧
-    { 8, 8, 0, 0, 1, 16, 45521 }, // ̨
-    { 6, 8, 0, -1, -2, 12, 45537 }, // ̩
-    { 11, 5, 0, 0, -1, 14, 45549 }, // ̪
-    { 12, 6, 0, 0, 0, 18, 45563 }, // ̬
-    { 12, 6, 0, -1, -1, 18, 45581 }, // ̭
-    { 13, 6, 0, 5, 22, 20, 45599 }, // ̰
-    { 11, 3, 0, 7, 21, 9, 45619 }, // ̱
-    { 13, 4, 0, 0, -2, 13, 45628 }, // ̲
-    { 13, 6, 0, 5, 22, 20, 45641 }, // ̴
-    { 14, 3, 0, 4, 10, 11, 45661 }, // ̵
-    { 5, 6, 0, 2, -2, 8, 45672 }, // ̹
-    { 11, 5, 0, -2, -1, 14, 45680 }, // ̺
-    { 11, 8, 0, 0, 0, 22, 45694 }, // ̻
-    { 11, 6, 0, 0, 0, 17, 45716 }, // ̼
-    { 8, 6, 0, 6, 22, 12, 45733 }, // ̽
-    { 13, 6, 0, 5, 22, 20, 45745 }, // ͂
-    { 5, 5, 0, 6, 24, 7, 45765 }, // ̓
-    { 14, 13, 0, 6, 31, 46, 45772 }, // ̈́
-    { 10, 5, 0, 7, 23, 13, 45818 }, // ͆
-    { 16, 11, 0, -1, 0, 44, 45831 }, // ͇
-    { 13, 8, 0, 0, 0, 26, 45875 }, // ͈
-    { 10, 7, 0, 0, -2, 18, 45901 }, // ͉
-    { 14, 17, 0, 5, 28, 60, 45919 }, // ͊
-    { 27, 13, 0, 10, 26, 88, 45979 }, // ͋
-    { 20, 14, 0, 6, 15, 70, 46067 }, // ͌
-    { 15, 9, 0, 2, -1, 34, 46137 }, // ͍
-    { 4, 4, 0, 4, 3, 4, 46171 }, // ͎
-    { 24, 6, 0, 1, 0, 36, 46175 }, // ͜
-    { 24, 5, 0, 6, 23, 30, 46211 }, // ͡
-    { 29, 7, 0, 0, -2, 51, 46241 }, // ͢
-    { 20, 30, 18, 2, 30, 150, 46292 }, // Ѐ
-    { 20, 28, 18, 2, 28, 140, 46442 }, // Ё
-    { 21, 24, 30, 9, 24, 126, 46582 }, // Ђ
-    { 21, 34, 19, 2, 34, 179, 46708 }, // Ѓ
-    { 24, 24, 26, 1, 23, 144, 46887 }, // Є
-    { 25, 27, 29, 1, 26, 169, 47031 }, // Ѕ
-    { 12, 25, 12, 1, 25, 75, 47200 }, // І
-    { 18, 35, 12, 1, 35, 158, 47275 }, // Ї
-    { 21, 33, 18, -1, 26, 174, 47433 }, // Ј
-    { 31, 23, 34, 3, 22, 179, 47607 }, // Љ
-    { 29, 23, 33, 3, 22, 167, 47786 }, // Њ
-    { 23, 25, 27, 6, 25, 144, 47953 }, // Ћ
-    { 25, 35, 26, 1, 35, 219, 48097 }, // Ќ
-    { 26, 31, 27, 2, 31, 202, 48316 }, // Ѝ
-    { 22, 33, 20, -1, 32, 182, 48518 }, // Ў
-    { 22, 27, 21, 2, 21, 149, 48700 }, // Џ
-    { 23, 25, 29, 1, 25, 144, 48849 }, // А
-    { 20, 22, 19, 3, 21, 110, 48993 }, // Б
-    { 19, 22, 20, 2, 21, 105, 49103 }, // В
-    { 21, 22, 19, 2, 22, 116, 49208 }, // Г
-    { 22, 24, 24, 3, 21, 132, 49324 }, // Д
-    { 20, 22, 18, 2, 22, 110, 49456 }, // Е
-    { 35, 25, 37, 1, 25, 219, 49566 }, // Ж
-    { 19, 24, 21, 1, 23, 114, 49785 }, // З
-    { 26, 25, 27, 2, 25, 163, 49899 }, // И
-    { 26, 33, 27, 2, 33, 215, 50062 }, // Й
-    { 23, 25, 26, 1, 25, 144, 50277 }, // К
-    { 23, 22, 22, 2, 21, 127, 50421 }, // Л
-    { 26, 21, 25, 2, 21, 137, 50548 }, // М
-    { 27, 25, 27, 1, 25, 169, 50685 }, // Н
-    { 28, 26, 29, 2, 25, 182, 50854 }, // О
-    { 21, 22, 20, 2, 22, 116, 51036 }, // П
-    { 23, 25, 23, 1, 25, 144, 51152 }, // Р
-    { 25, 27, 25, 1, 26, 169, 51296 }, // С
-    { 23, 25, 27, 6, 25, 144, 51465 }, // Т
-    { 22, 24, 20, -1, 23, 132, 51609 }, // У
-    { 24, 22, 25, 5, 22, 132, 51741 }, // Ф
-    { 29, 25, 29, 1, 25, 182, 51873 }, // Х
-    { 20, 27, 21, 2, 22, 135, 52055 }, // Ц
-    { 18, 22, 19, 5, 22, 99, 52190 }, // Ч
-    { 25, 22, 24, 2, 22, 138, 52289 }, // Ш
-    { 25, 27, 26, 2, 22, 169, 52427 }, // Щ
-    { 17, 23, 19, 2, 22, 98, 52596 }, // Ъ
-    { 30, 24, 32, 2, 23, 180, 52694 }, // Ы
-    { 17, 23, 19, 2, 22, 98, 52874 }, // Ь
-    { 24, 24, 26, 2, 23, 144, 52972 }, // Э
-    { 28, 23, 29, 3, 22, 161, 53116 }, // Ю
-    { 23, 25, 24, 1, 25, 144, 53277 }, // Я
-    { 18, 18, 22, 1, 18, 81, 53421 }, // а
-    { 20, 23, 20, 3, 23, 115, 53502 }, // б
-    { 17, 18, 18, 0, 18, 77, 53617 }, // в
-    { 18, 17, 17, 2, 17, 77, 53694 }, // г
-    { 19, 20, 22, 3, 17, 95, 53771 }, // д
-    { 18, 17, 22, 2, 17, 77, 53866 }, // е
-    { 31, 20, 31, 0, 20, 155, 53943 }, // ж
-    { 13, 16, 13, 1, 16, 52, 54098 }, // з
-    { 19, 17, 20, 2, 17, 81, 54150 }, // и
-    { 19, 22, 20, 2, 22, 105, 54231 }, // й
-    { 18, 17, 20, 0, 17, 77, 54336 }, // к
-    { 16, 16, 15, 1, 15, 64, 54413 }, // л
-    { 23, 19, 24, 0, 19, 110, 54477 }, // м
-    { 23, 19, 23, 0, 19, 110, 54587 }, // н
-    { 17, 18, 24, 3, 17, 77, 54697 }, // о
-    { 19, 17, 19, 2, 17, 81, 54774 }, // п
-    { 23, 24, 24, -1, 16, 138, 54855 }, // р
-    { 15, 18, 20, 2, 17, 68, 54993 }, // с
-    { 16, 16, 20, 6, 16, 64, 55061 }, // т
-    { 22, 24, 23, 0, 16, 132, 55125 }, // у
-    { 24, 23, 25, 3, 16, 138, 55257 }, // ф
-    { 21, 16, 21, 2, 16, 84, 55395 }, // х
-    { 19, 21, 21, 2, 17, 100, 55479 }, // ц
-    { 13, 15, 13, 2, 15, 49, 55579 }, // ч
-    { 24, 17, 24, 2, 17, 102, 55628 }, // ш
-    { 24, 22, 26, 2, 17, 132, 55730 }, // щ
-    { 17, 17, 22, 5, 16, 73, 55862 }, // ъ
-    { 23, 18, 24, 3, 17, 104, 55935 }, // ы
-    { 16, 18, 18, 2, 17, 72, 56039 }, // ь
-    { 18, 18, 19, 2, 17, 81, 56111 }, // э
-    { 22, 19, 23, 2, 18, 105, 56192 }, // ю
-    { 19, 17, 18, 2, 17, 81, 56297 }, // я
-    { 18, 28, 22, 2, 28, 126, 56378 }, // ѐ
-    { 19, 22, 19, 3, 22, 105, 56504 }, // ё
-    { 19, 30, 22, 1, 25, 143, 56609 }, // ђ
-    { 18, 25, 17, 2, 25, 113, 56752 }, // ѓ
-    { 17, 17, 18, 0, 16, 73, 56865 }, // є
-    { 17, 16, 21, 1, 16, 68, 56938 }, // ѕ
-    { 11, 26, 11, 1, 26, 72, 57006 }, // і
-    { 15, 25, 11, 1, 25, 94, 57078 }, // ї
-    { 19, 32, 19, 2, 25, 152, 57172 }, // ј
-    { 22, 16, 23, 1, 15, 88, 57324 }, // љ
-    { 21, 16, 23, 1, 15, 84, 57412 }, // њ
-    { 19, 25, 22, 1, 25, 119, 57496 }, // ћ
-    { 18, 26, 20, 0, 26, 117, 57615 }, // ќ
-    { 19, 25, 20, 2, 25, 119, 57732 }, // ѝ
-    { 22, 36, 23, 0, 28, 198, 57851 }, // ў
-    { 16, 20, 15, 1, 15, 80, 58049 }, // џ
-    { 16, 23, 24, 8, 22, 92, 58129 }, // Ѣ
-    { 15, 22, 21, 6, 21, 83, 58221 }, // ѣ
-    { 28, 21, 30, 3, 21, 147, 58304 }, // Ѫ
-    { 20, 16, 21, 1, 15, 80, 58451 }, // ѫ
-    { 25, 27, 29, 3, 26, 169, 58531 }, // Ѳ
-    { 20, 20, 22, 2, 20, 100, 58700 }, // ѳ
-    { 33, 31, 30, 7, 31, 256, 58800 }, // Ѵ
-    { 19, 20, 24, 5, 20, 95, 59056 }, // ѵ
-    { 11, 9, 0, 8, 27, 25, 59151 }, // ҆
-    { 22, 25, 19, 2, 25, 138, 59176 }, // Ґ
-    { 19, 20, 17, 2, 20, 95, 59314 }, // ґ
-    { 21, 22, 19, 2, 22, 116, 59409 }, // Ғ
-    { 15, 15, 13, 0, 15, 57, 59525 }, // ғ
-    { 23, 24, 20, 2, 24, 138, 59582 }, // Ҕ
-    { 13, 15, 12, 0, 15, 49, 59720 }, // ҕ
-    { 35, 29, 37, -1, 25, 254, 59769 }, // Җ
-    { 25, 21, 26, -2, 18, 132, 60023 }, // җ
-    { 19, 27, 21, 2, 23, 129, 60155 }, // Ҙ
-    { 14, 23, 13, 0, 16, 81, 60284 }, // ҙ
-    { 24, 29, 26, -1, 25, 174, 60365 }, // Қ
-    { 17, 21, 18, -2, 18, 90, 60539 }, // қ
-    { 25, 21, 28, 3, 21, 132, 60629 }, // Ҝ
-    { 18, 15, 21, 2, 15, 68, 60761 }, // ҝ
-    { 23, 25, 26, 1, 25, 144, 60829 }, // Ҟ
-    { 16, 23, 22, 1, 23, 92, 60973 }, // ҟ
-    { 25, 25, 26, -1, 25, 157, 61065 }, // Ҡ
-    { 17, 18, 18, -1, 18, 77, 61222 }, // ҡ
-    { 27, 28, 27, -1, 25, 189, 61299 }, // Ң
-    { 19, 20, 19, -2, 17, 95, 61488 }, // ң
-    { 36, 26, 27, 1, 26, 234, 61583 }, // Ҥ
-    { 25, 17, 19, 0, 17, 107, 61817 }, // ҥ
-    { 31, 24, 34, 3, 24, 186, 61924 }, // Ҧ
-    { 27, 27, 31, 3, 19, 183, 62110 }, // ҧ
-    { 28, 25, 35, 4, 24, 175, 62293 }, // Ҩ
-    { 22, 20, 27, 3, 19, 110, 62468 }, // ҩ
-    { 25, 31, 25, 1, 26, 194, 62578 }, // Ҫ
-    { 15, 21, 20, 2, 17, 79, 62772 }, // ҫ
-    { 23, 28, 27, 4, 25, 161, 62851 }, // Ҭ
-    { 16, 20, 19, 2, 17, 80, 63012 }, // ҭ
-    { 21, 25, 27, 7, 25, 132, 63092 }, // Ү
-    { 16, 21, 19, 6, 15, 84, 63224 }, // ү
-    { 22, 25, 27, 6, 25, 138, 63308 }, // Ұ
-    { 21, 22, 19, 1, 15, 116, 63446 }, // ұ
-    { 29, 29, 29, -1, 25, 211, 63562 }, // Ҳ
-    { 20, 20, 20, -2, 17, 100, 63773 }, // ҳ
-    { 22, 27, 31, 8, 21, 149, 63873 }, // Ҵ
-    { 16, 19, 22, 5, 15, 76, 64022 }, // ҵ
-    { 18, 28, 24, 5, 21, 126, 64098 }, // Ҷ
-    { 13, 20, 17, 3, 15, 65, 64224 }, // ҷ
-    { 20, 22, 21, 5, 22, 110, 64289 }, // Ҹ
-    { 14, 15, 15, 3, 15, 53, 64399 }, // ҹ
-    { 18, 24, 22, 3, 24, 108, 64452 }, // Һ
-    { 19, 25, 22, 1, 25, 119, 64560 }, // һ
-    { 24, 22, 28, 2, 21, 132, 64679 }, // Ҽ
-    { 17, 16, 20, 1, 16, 68, 64811 }, // ҽ
-    { 24, 25, 32, 5, 21, 150, 64879 }, // Ҿ
-    { 17, 19, 23, 3, 16, 81, 65029 }, // ҿ
-    { 12, 25, 12, 1, 25, 75, 65110 }, // Ӏ
-    { 35, 35, 37, 1, 35, 307, 65185 }, // Ӂ
-    { 31, 31, 31, 0, 31, 241, 65492 }, // ӂ
-    { 21, 29, 23, 3, 22, 153, 65733 }, // Ӄ
-    { 15, 20, 16, 1, 15, 75, 65886 }, // ӄ
-    { 23, 27, 22, 2, 22, 156, 65961 }, // Ӆ
-    { 16, 18, 15, 1, 15, 72, 66117 }, // ӆ
-    { 27, 32, 27, 1, 25, 216, 66189 }, // Ӈ
-    { 18, 22, 19, 0, 17, 99, 66405 }, // ӈ
-    { 27, 34, 27, 1, 25, 230, 66504 }, // Ӊ
-    { 19, 23, 19, 0, 17, 110, 66734 }, // ӊ
-    { 18, 27, 20, 4, 21, 122, 66844 }, // Ӌ
-    { 13, 19, 15, 3, 15, 62, 66966 }, // ӌ
-    { 31, 34, 36, 1, 25, 264, 67028 }, // Ӎ
-    { 21, 23, 25, 0, 17, 121, 67292 }, // ӎ
-    { 9, 21, 8, 2, 21, 48, 67413 }, // ӏ
-    { 26, 35, 29, 1, 35, 228, 67461 }, // Ӑ
-    { 24, 27, 22, 1, 27, 162, 67689 }, // ӑ
-    { 26, 34, 29, 1, 34, 221, 67851 }, // Ӓ
-    { 24, 25, 22, 1, 25, 150, 68072 }, // ӓ
-    { 38, 26, 42, 1, 25, 247, 68222 }, // Ӕ
-    { 30, 18, 36, 1, 18, 135, 68469 }, // ӕ
-    { 21, 31, 18, 2, 31, 163, 68604 }, // Ӗ
-    { 20, 29, 22, 2, 29, 145, 68767 }, // ӗ
-    { 19, 17, 22, 2, 16, 81, 68912 }, // Ә
-    { 18, 19, 24, 10, 18, 86, 68993 }, // ә
-    { 23, 29, 22, 2, 28, 167, 69079 }, // Ӛ
-    { 20, 21, 24, 8, 18, 105, 69246 }, // ӛ
-    { 35, 34, 38, 1, 34, 298, 69351 }, // Ӝ
-    { 31, 29, 31, 0, 29, 225, 69649 }, // ӝ
-    { 21, 31, 21, 1, 30, 163, 69874 }, // Ӟ
-    { 20, 24, 13, 1, 24, 120, 70037 }, // ӟ
-    { 17, 21, 17, 3, 21, 90, 70157 }, // Ӡ
-    { 16, 22, 17, 2, 16, 88, 70247 }, // ӡ
-    { 26, 30, 27, 2, 30, 195, 70335 }, // Ӣ
-    { 20, 23, 20, 2, 23, 115, 70530 }, // ӣ
-    { 26, 31, 27, 2, 31, 202, 70645 }, // Ӥ
-    { 20, 24, 20, 2, 24, 120, 70847 }, // ӥ
-    { 28, 34, 29, 2, 33, 238, 70967 }, // Ӧ
-    { 20, 26, 24, 3, 25, 130, 71205 }, // ӧ
-    { 24, 22, 29, 3, 21, 132, 71335 }, // Ө
-    { 18, 16, 22, 2, 16, 72, 71467 }, // ө
-    { 24, 34, 29, 3, 33, 204, 71539 }, // Ӫ
-    { 20, 27, 22, 2, 27, 135, 71743 }, // ӫ
-    { 24, 32, 26, 2, 31, 192, 71878 }, // Ӭ
-    { 18, 25, 19, 2, 24, 113, 72070 }, // ӭ
-    { 22, 31, 20, -1, 30, 171, 72183 }, // Ӯ
-    { 23, 33, 23, 0, 25, 190, 72354 }, // ӯ
-    { 22, 32, 20, -1, 31, 176, 72544 }, // Ӱ
-    { 22, 35, 23, 0, 27, 193, 72720 }, // ӱ
-    { 25, 33, 20, -1, 32, 207, 72913 }, // Ӳ
-    { 26, 36, 23, 0, 28, 234, 73120 }, // ӳ
-    { 19, 30, 19, 5, 30, 143, 73354 }, // Ӵ
-    { 16, 24, 13, 2, 24, 96, 73497 }, // ӵ
-    { 21, 26, 19, 2, 22, 137, 73593 }, // Ӷ
-    { 15, 18, 13, 0, 15, 68, 73730 }, // ӷ
-    { 30, 33, 32, 2, 32, 248, 73798 }, // Ӹ
-    { 23, 27, 24, 3, 26, 156, 74046 }, // ӹ
-    { 29, 29, 29, 1, 25, 211, 74202 }, // Ӽ
-    { 20, 21, 20, 0, 18, 105, 74413 }, // ӽ
-    { 0, 0, 24, 0, 0, 0, 74518 }, //  
-    { 0, 0, 39, 0, 0, 0, 74518 }, //  
-    { 0, 0, 24, 0, 0, 0, 74518 }, //  
-    { 0, 0, 39, 0, 0, 0, 74518 }, //  
-    { 0, 0, 19, 0, 0, 0, 74518 }, //  
-    { 0, 0, 17, 0, 0, 0, 74518 }, //  
-    { 0, 0, 14, 0, 0, 0, 74518 }, //  
-    { 0, 0, 19, 0, 0, 0, 74518 }, //  
-    { 0, 0, 8, 0, 0, 0, 74518 }, //  
-    { 0, 0, 15, 0, 0, 0, 74518 }, //  
-    { 0, 0, 14, 0, 0, 0, 74518 }, //  
-    { 0, 0, 9, 0, 0, 0, 74518 }, // ​
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 74518 }, // ‏
-    { 14, 3, 16, 4, 10, 11, 74518 }, // ‐
-    { 14, 3, 16, 4, 10, 11, 74529 }, // ‑
-    { 21, 3, 22, 5, 10, 16, 74540 }, // ‒
-    { 20, 4, 23, 4, 10, 20, 74556 }, // –
-    { 30, 4, 33, 4, 10, 30, 74576 }, // —
-    { 30, 4, 33, 4, 10, 30, 74606 }, // ―
-    { 19, 25, 16, 1, 21, 119, 74636 }, // ‖
-    { 24, 9, 23, 0, -3, 54, 74755 }, // ‗
-    { 9, 9, 10, 6, 25, 21, 74809 }, // ‘
-    { 10, 9, 10, 5, 25, 23, 74830 }, // ’
-    { 10, 10, 9, 0, 5, 25, 74853 }, // ‚
-    { 9, 9, 10, 6, 25, 21, 74878 }, // ‛
-    { 16, 9, 16, 6, 25, 36, 74899 }, // “
-    { 17, 9, 17, 5, 25, 39, 74935 }, // ”
-    { 10, 10, 9, 0, 5, 25, 74974 }, // „
-    { 17, 9, 17, 6, 25, 39, 74999 }, // ‟
-    { 16, 38, 17, 5, 30, 152, 75038 }, // †
-    { 19, 38, 18, 2, 30, 181, 75190 }, // ‡
-    { 19, 17, 15, 0, 20, 81, 75371 }, // •
-    { 9, 9, 11, 3, 13, 21, 75452 }, // ‣
-    { 6, 5, 8, 1, 5, 8, 75473 }, // ․
-    { 6, 5, 8, 1, 5, 8, 75481 }, // ‥
-    { 26, 5, 28, 1, 5, 33, 75489 }, // …
-    { 5, 3, 7, 2, 10, 4, 75522 }, // ‧
-    { 0, 0, 37, 0, 0, 0, 75526 }, //  
-    { 24, 25, 32, 7, 23, 150, 75526 }, // ‰
-    { 10, 9, 9, 5, 25, 23, 75676 }, // ′
-    { 17, 9, 16, 5, 25, 39, 75699 }, // ″
-    { 21, 9, 25, -3, 25, 48, 75738 }, // ‴
-    { 6, 9, 10, 7, 24, 14, 75786 }, // ‵
-    { 12, 9, 15, 6, 24, 27, 75800 }, // ‶
-    { 21, 9, 25, 7, 25, 48, 75827 }, // ‷
-    { 12, 5, 16, 7, 23, 15, 75875 }, // ‸
-    { 10, 14, 12, 4, 15, 35, 75890 }, // ‹
-    { 10, 14, 12, -2, 15, 35, 75925 }, // ›
-    { 37, 29, 39, 1, 26, 269, 75960 }, // ※
-    { 14, 29, 10, 1, 29, 102, 76229 }, // ‼
-    { 20, 37, 22, 5, 35, 185, 76331 }, // ‽
-    { 15, 4, 16, 7, 24, 15, 76516 }, // ‾
-    { 13, 6, 19, 6, 20, 20, 76531 }, // ‿
-    { 20, 18, 23, 5, 25, 90, 76551 }, // ⁂
-    { 24, 24, 32, 7, 22, 144, 76641 }, // ⁄
-    { 35, 33, 37, 7, 33, 289, 76785 }, // ⁇
-    { 25, 33, 29, 7, 33, 207, 77074 }, // ⁈
-    { 30, 35, 24, 0, 33, 263, 77281 }, // ⁉
-    { 29, 46, 22, -1, 32, 334, 77544 }, // ⁒
-    { 0, 0, 141, 0, 0, 0, 77878 }, //  
-    { 10, 11, 9, 3, 24, 28, 77878 }, // ⁰
-    { 8, 11, 9, 4, 24, 22, 77906 }, // ⁴
-    { 10, 12, 9, 3, 25, 30, 77928 }, // ⁵
-    { 9, 11, 9, 4, 24, 25, 77958 }, // ⁶
-    { 8, 13, 10, 6, 25, 26, 77983 }, // ⁷
-    { 10, 11, 10, 3, 24, 28, 78009 }, // ⁸
-    { 10, 11, 10, 4, 24, 28, 78037 }, // ⁹
-    { 18, 17, 22, 1, 17, 77, 78065 }, // ⁿ
-    { 14, 15, 13, 1, 15, 53, 78142 }, // ₀
-    { 8, 12, 9, -2, 7, 24, 78195 }, // ₁
-    { 11, 12, 10, -2, 7, 33, 78219 }, // ₂
-    { 10, 11, 9, -1, 6, 28, 78252 }, // ₃
-    { 9, 11, 10, -1, 6, 25, 78280 }, // ₄
-    { 9, 12, 9, -1, 7, 27, 78305 }, // ₅
-    { 10, 12, 10, -1, 7, 30, 78332 }, // ₆
-    { 8, 12, 10, 1, 7, 24, 78362 }, // ₇
-    { 11, 11, 10, -2, 6, 31, 78386 }, // ₈
-    { 10, 11, 10, -1, 6, 28, 78417 }, // ₉
-    { 17, 40, 13, 3, 30, 170, 78445 }, // ₍
-    { 16, 40, 13, -7, 30, 160, 78615 }, // ₎
-    { 28, 37, 25, 0, 31, 259, 78775 }, // ₡
-    { 25, 27, 25, 1, 26, 169, 79034 }, // ₢
-    { 23, 27, 20, 1, 27, 156, 79203 }, // ₤
-    { 30, 25, 27, 0, 25, 188, 79359 }, // ₦
-    { 25, 25, 23, 1, 25, 157, 79547 }, // ₧
-    { 33, 24, 33, 0, 24, 198, 79704 }, // ₨
-    { 24, 24, 23, -1, 24, 144, 79902 }, // ₩
-    { 27, 23, 31, 5, 23, 156, 80046 }, // ₪
-    { 22, 23, 20, 2, 23, 127, 80202 }, // ₫
-    { 22, 26, 24, 3, 23, 143, 80329 }, // €
-    { 23, 25, 27, 6, 25, 144, 80472 }, // ₮
-    { 28, 25, 19, 1, 25, 175, 80616 }, // ₱
-    { 25, 34, 29, 2, 30, 213, 80791 }, // ₲
-    { 32, 27, 27, 3, 26, 216, 81004 }, // ₴
-    { 15, 23, 20, 2, 21, 87, 81220 }, // ₵
-    { 26, 26, 27, 6, 26, 169, 81307 }, // ₸
-    { 17, 22, 18, 4, 22, 94, 81476 }, // ₹
-    { 17, 21, 20, 3, 20, 90, 81570 }, // ₺
-    { 21, 23, 18, 2, 23, 121, 81660 }, // ₼
-    { 27, 25, 23, -3, 25, 169, 81781 }, // ₽
-    { 18, 18, 22, -3, 14, 81, 81950 }, // ←
-    { 19, 18, 22, 4, 18, 86, 82031 }, // ↑
-    { 18, 18, 22, 7, 14, 81, 82117 }, // →
-    { 19, 18, 22, 9, 18, 86, 82198 }, // ↓
-    { 31, 15, 26, -2, 13, 117, 82284 }, // ↔
-    { 15, 30, 19, 4, 28, 113, 82401 }, // ↕
-    { 17, 13, 19, -3, 13, 56, 82514 }, // ↖
-    { 18, 13, 19, 4, 13, 59, 82570 }, // ↗
-    { 14, 18, 19, 7, 16, 63, 82629 }, // ↘
-    { 14, 18, 19, -2, 16, 63, 82692 }, // ↙
-    { 22, 19, 25, 0, 18, 105, 82755 }, // ⇐
-    { 23, 21, 27, 5, 21, 121, 82860 }, // ⇑
-    { 22, 19, 25, 3, 18, 105, 82981 }, // ⇒
-    { 23, 22, 27, 10, 21, 127, 83086 }, // ⇓
-    { 29, 19, 28, 0, 18, 138, 83213 }, // ⇔
-    { 18, 28, 23, 7, 18, 126, 83351 }, // ⇕
-    { 21, 23, 20, 3, 23, 121, 83477 }, // ∂
-    { 30, 27, 29, 0, 26, 203, 83598 }, // ∅
-    { 22, 22, 25, 2, 22, 121, 83801 }, // ∆
-    { 21, 21, 22, 4, 21, 111, 83922 }, // ∏
-    { 21, 21, 22, 10, 21, 111, 84033 }, // ∐
-    { 19, 22, 17, 2, 21, 105, 84144 }, // ∑
-    { 14, 4, 18, 4, 10, 14, 84249 }, // −
-    { 28, 25, 27, 3, 23, 175, 84263 }, // √
-    { 26, 15, 27, 3, 18, 98, 84438 }, // ∞
-    { 31, 33, 25, 0, 26, 256, 84536 }, // ∫
-    { 10, 18, 8, 1, 18, 45, 84792 }, // ∶
-    { 20, 14, 23, 6, 15, 70, 84837 }, // ≈
-    { 24, 24, 32, 7, 22, 144, 84907 }, // ≠
-    { 25, 22, 25, -1, 20, 138, 85051 }, // ≤
-    { 26, 22, 25, 1, 20, 143, 85189 }, // ≥
+    { 20, 22, 19, 2, 22, 110, 2048 }, // 3
+    { 16, 22, 19, 4, 22, 88, 2158 }, // 4
+    { 19, 23, 18, 2, 23, 110, 2246 }, // 5
+    { 19, 22, 19, 3, 22, 105, 2356 }, // 6
+    { 15, 22, 18, 7, 22, 83, 2461 }, // 7
+    { 20, 22, 20, 2, 22, 110, 2544 }, // 8
+    { 19, 22, 19, 3, 22, 105, 2654 }, // 9
+    { 10, 18, 8, 1, 18, 45, 2759 }, // :
+    { 12, 22, 9, 0, 17, 66, 2804 }, // ;
+    { 22, 17, 23, -1, 18, 94, 2870 }, // <
+    { 16, 10, 18, 3, 13, 40, 2964 }, // =
+    { 22, 17, 23, 2, 18, 94, 3004 }, // >
+    { 18, 33, 17, 5, 33, 149, 3098 }, // ?
+    { 29, 25, 35, 4, 23, 182, 3247 }, // @
+    { 23, 25, 29, 1, 25, 144, 3429 }, // A
+    { 22, 25, 24, 1, 25, 138, 3573 }, // B
+    { 25, 27, 25, 1, 26, 169, 3711 }, // C
+    { 25, 25, 28, 1, 25, 157, 3880 }, // D
+    { 23, 25, 23, 1, 25, 144, 4096 }, // E
+    { 21, 25, 21, 1, 25, 132, 4240 }, // F
+    { 25, 26, 29, 2, 26, 163, 4372 }, // G
+    { 27, 25, 27, 1, 25, 169, 4535 }, // H
+    { 12, 25, 12, 1, 25, 75, 4704 }, // I
+    { 21, 33, 18, -1, 26, 174, 4779 }, // J
+    { 23, 25, 26, 1, 25, 144, 4953 }, // K
+    { 18, 25, 22, 1, 25, 113, 5097 }, // L
+    { 31, 25, 32, 1, 25, 194, 5210 }, // M
+    { 28, 25, 27, 1, 25, 175, 5404 }, // N
+    { 28, 26, 29, 2, 25, 182, 5579 }, // O
+    { 23, 25, 23, 1, 25, 144, 5761 }, // P
+    { 29, 29, 31, 1, 25, 211, 5905 }, // Q
+    { 22, 25, 24, 1, 25, 138, 6144 }, // R
+    { 25, 27, 29, 1, 26, 169, 6282 }, // S
+    { 23, 25, 27, 6, 25, 144, 6451 }, // T
+    { 26, 26, 27, 2, 25, 169, 6595 }, // U
+    { 24, 25, 30, 7, 25, 150, 6764 }, // V
+    { 33, 25, 37, 6, 25, 207, 6914 }, // W
+    { 29, 25, 29, 1, 25, 182, 7121 }, // X
+    { 21, 25, 27, 7, 25, 132, 7303 }, // Y
+    { 29, 25, 29, 1, 25, 182, 7435 }, // Z
+    { 21, 41, 14, -1, 31, 216, 7617 }, // [
+    { 5, 28, 14, 7, 23, 35, 7833 }, // <backslash>
+    { 20, 41, 14, -6, 31, 205, 7868 }, // ]
+    { 13, 6, 16, 5, 26, 20, 8073 }, // ^
+    { 21, 4, 23, 0, -2, 21, 8093 }, // _
+    { 9, 5, 12, 7, 22, 12, 8114 }, // `
+    { 18, 18, 22, 1, 18, 81, 8192 }, // a
+    { 18, 26, 23, 3, 25, 117, 8273 }, // b
+    { 15, 18, 20, 2, 17, 68, 8390 }, // c
+    { 23, 26, 23, 1, 25, 150, 8458 }, // d
+    { 18, 17, 22, 2, 17, 77, 8608 }, // e
+    { 14, 24, 16, 3, 24, 84, 8685 }, // f
+    { 21, 24, 22, 0, 16, 126, 8769 }, // g
+    { 19, 25, 22, 1, 25, 119, 8895 }, // h
+    { 11, 26, 11, 1, 26, 72, 9014 }, // i
+    { 19, 32, 19, 2, 25, 152, 9086 }, // j
+    { 16, 24, 22, 1, 24, 96, 9238 }, // k
+    { 11, 24, 14, 1, 24, 66, 9334 }, // l
+    { 29, 16, 32, 1, 16, 116, 9400 }, // m
+    { 18, 17, 22, 1, 17, 77, 9516 }, // n
+    { 18, 16, 22, 2, 16, 72, 9593 }, // o
+    { 23, 24, 24, -1, 16, 138, 9665 }, // p
+    { 20, 25, 26, 2, 18, 125, 9803 }, // q
+    { 15, 17, 17, 1, 17, 64, 9928 }, // r
+    { 17, 16, 21, 1, 16, 68, 9992 }, // s
+    { 13, 22, 19, 4, 22, 72, 10060 }, // t
+    { 18, 17, 21, 2, 16, 77, 10132 }, // u
+    { 18, 16, 24, 5, 16, 72, 10240 }, // v
+    { 23, 16, 28, 5, 16, 92, 10312 }, // w
+    { 22, 16, 24, 1, 16, 88, 10404 }, // x
+    { 22, 24, 23, 0, 16, 132, 10492 }, // y
+    { 20, 16, 22, 1, 16, 80, 10624 }, // z
+    { 16, 27, 16, 4, 22, 108, 10704 }, // {
+    { 10, 25, 7, 1, 21, 63, 10812 }, // |
+    { 16, 27, 18, 0, 22, 108, 10875 }, // }
+    { 13, 6, 17, 5, 22, 20, 10983 }, // ~
+    { 0, 0, 25, 0, 0, 0, 11003 }, //  
+    { 11, 29, 13, 3, 22, 80, 11003 }, // ¡
+    { 15, 25, 20, 2, 22, 94, 11083 }, // ¢
+    { 23, 27, 20, 1, 27, 156, 11177 }, // £
+    { 18, 15, 20, 3, 18, 68, 11333 }, // ¤
+    { 22, 24, 22, 4, 22, 132, 11401 }, // ¥
+    { 10, 25, 7, 1, 21, 63, 11533 }, // ¦
+    { 23, 25, 24, 1, 22, 144, 11596 }, // §
+    { 14, 5, 16, 6, 23, 18, 11740 }, // ¨
+    { 13, 11, 16, 7, 26, 36, 11758 }, // ©
+    { 10, 10, 12, 5, 22, 25, 11794 }, // ª
+    { 19, 14, 24, 3, 14, 67, 11819 }, // «
+    { 14, 9, 18, 4, 10, 32, 11886 }, // ¬
+    { 14, 3, 16, 4, 10, 11, 11918 }, // ­
+    { 13, 11, 16, 8, 31, 36, 11929 }, // ®
+    { 11, 3, 15, 7, 21, 9, 11965 }, // ¯
+    { 15, 14, 16, 5, 23, 53, 11974 }, // °
+    { 17, 17, 21, 1, 16, 73, 12027 }, // ±
+    { 10, 11, 9, 3, 24, 28, 12100 }, // ²
+    { 10, 11, 9, 3, 23, 28, 12128 }, // ³
+    { 7, 6, 8, 6, 23, 11, 12156 }, // ´
+    { 21, 19, 21, -1, 16, 100, 12167 }, // µ
+    { 20, 24, 18, 1, 21, 120, 12288 }, // ¶
+    { 6, 5, 8, 3, 12, 8, 12408 }, // ·
+    { 8, 8, 10, 0, 1, 16, 12416 }, // ¸
+    { 8, 11, 8, 3, 24, 22, 12432 }, // ¹
+    { 10, 9, 12, 5, 21, 23, 12454 }, // º
+    { 20, 14, 19, -4, 14, 70, 12477 }, // »
+    { 24, 28, 32, 7, 26, 168, 12547 }, // ¼
+    { 25, 27, 32, 7, 25, 169, 12715 }, // ½
+    { 25, 27, 32, 6, 25, 169, 12884 }, // ¾
+    { 19, 32, 17, -2, 17, 152, 13053 }, // ¿
+    { 23, 33, 29, 1, 33, 190, 13205 }, // À
+    { 25, 38, 29, 1, 38, 238, 13395 }, // Á
+    { 25, 32, 29, 1, 32, 200, 13633 }, // Â
+    { 26, 33, 29, 1, 33, 215, 13833 }, // Ã
+    { 27, 33, 29, 1, 33, 223, 14048 }, // Ä
+    { 24, 35, 29, 1, 35, 210, 14336 }, // Å
+    { 38, 26, 42, 1, 25, 247, 14546 }, // Æ
+    { 25, 33, 25, 1, 26, 207, 14793 }, // Ç
+    { 23, 32, 23, 1, 32, 184, 15000 }, // È
+    { 23, 38, 23, 1, 38, 219, 15184 }, // É
+    { 23, 32, 23, 1, 32, 184, 15403 }, // Ê
+    { 24, 33, 23, 1, 33, 198, 15587 }, // Ë
+    { 14, 35, 12, 1, 35, 123, 15785 }, // Ì
+    { 17, 40, 12, 1, 40, 170, 15908 }, // Í
+    { 16, 34, 12, 1, 34, 136, 16078 }, // Î
+    { 18, 35, 12, 1, 35, 158, 16214 }, // Ï
+    { 26, 25, 28, 0, 25, 163, 16384 }, // Ð
+    { 28, 32, 27, 1, 32, 224, 16547 }, // Ñ
+    { 28, 34, 29, 2, 33, 238, 16771 }, // Ò
+    { 28, 39, 29, 2, 38, 273, 17009 }, // Ó
+    { 28, 33, 29, 2, 32, 231, 17282 }, // Ô
+    { 28, 34, 29, 2, 33, 238, 17513 }, // Õ
+    { 28, 34, 29, 2, 33, 238, 17751 }, // Ö
+    { 14, 8, 17, 3, 11, 28, 17989 }, // ×
+    { 50, 49, 29, -10, 37, 613, 18432 }, // Ø
+    { 26, 35, 27, 2, 34, 228, 19045 }, // Ù
+    { 26, 39, 27, 2, 38, 254, 19273 }, // Ú
+    { 26, 33, 27, 2, 32, 215, 19527 }, // Û
+    { 26, 35, 27, 2, 34, 228, 19742 }, // Ü
+    { 21, 39, 27, 7, 39, 205, 19970 }, // Ý
+    { 19, 23, 16, 1, 23, 110, 20175 }, // Þ
+    { 20, 23, 20, 2, 23, 115, 20285 }, // ß
+    { 18, 24, 22, 1, 24, 108, 20480 }, // à
+    { 18, 28, 22, 1, 28, 126, 20588 }, // á
+    { 20, 24, 22, 1, 24, 120, 20714 }, // â
+    { 19, 23, 22, 1, 23, 110, 20834 }, // ã
+    { 20, 24, 22, 1, 24, 120, 20944 }, // ä
+    { 18, 26, 22, 1, 26, 117, 21064 }, // å
+    { 30, 18, 36, 1, 18, 135, 21181 }, // æ
+    { 15, 24, 20, 2, 17, 90, 21316 }, // ç
+    { 18, 27, 22, 2, 27, 122, 21406 }, // è
+    { 19, 32, 22, 2, 32, 152, 21528 }, // é
+    { 19, 26, 22, 2, 26, 124, 21680 }, // ê
+    { 20, 27, 22, 2, 27, 135, 21804 }, // ë
+    { 11, 24, 11, 1, 24, 66, 21939 }, // ì
+    { 14, 29, 11, 1, 29, 102, 22005 }, // í
+    { 14, 23, 11, 1, 23, 81, 22107 }, // î
+    { 15, 25, 11, 1, 25, 94, 22188 }, // ï
+    { 25, 23, 24, 3, 23, 144, 22282 }, // ð
+    { 21, 25, 22, 1, 25, 132, 22528 }, // ñ
+    { 18, 26, 22, 2, 26, 117, 22660 }, // ò
+    { 19, 31, 22, 2, 31, 148, 22777 }, // ó
+    { 19, 25, 22, 2, 25, 119, 22925 }, // ô
+    { 19, 26, 22, 2, 26, 124, 23044 }, // õ
+    { 20, 26, 22, 2, 26, 130, 23168 }, // ö
+    { 19, 18, 22, 4, 18, 86, 23298 }, // ÷
+    { 29, 45, 22, -4, 30, 327, 23384 }, // ø
+    { 18, 25, 21, 2, 24, 113, 23711 }, // ù
+    { 18, 30, 21, 2, 29, 135, 23824 }, // ú
+    { 18, 24, 21, 2, 23, 108, 23959 }, // û
+    { 19, 25, 21, 2, 24, 119, 24067 }, // ü
+    { 22, 39, 23, 0, 31, 215, 24186 }, // ý
+    { 18, 30, 16, 1, 24, 135, 24401 }, // þ
+    { 23, 35, 23, 0, 27, 202, 24576 }, // ÿ
+    { 26, 32, 29, 1, 32, 208, 24778 }, // Ā
+    { 20, 22, 22, 1, 22, 110, 24986 }, // ā
+    { 26, 36, 29, 1, 36, 234, 25096 }, // Ă
+    { 20, 26, 22, 1, 26, 130, 25330 }, // ă
+    { 23, 32, 29, 1, 25, 184, 25460 }, // Ą
+    { 18, 23, 22, 1, 18, 104, 25644 }, // ą
+    { 25, 39, 25, 1, 38, 244, 25748 }, // Ć
+    { 17, 28, 20, 2, 27, 119, 25992 }, // ć
+    { 26, 37, 25, 1, 36, 241, 26111 }, // Ĉ
+    { 19, 25, 20, 2, 24, 119, 26352 }, // ĉ
+    { 25, 37, 25, 1, 36, 232, 26624 }, // Ċ
+    { 15, 26, 20, 2, 25, 98, 26856 }, // ċ
+    { 25, 39, 25, 1, 38, 244, 26954 }, // Č
+    { 17, 27, 20, 2, 26, 115, 27198 }, // č
+    { 25, 36, 28, 1, 36, 225, 27313 }, // Ď
+    { 28, 26, 23, 1, 25, 182, 27538 }, // ď
+    { 26, 25, 28, 0, 25, 163, 27720 }, // Đ
+    { 27, 26, 23, 1, 25, 176, 27883 }, // đ
+    { 23, 32, 23, 1, 32, 184, 28059 }, // Ē
+    { 20, 26, 22, 2, 26, 130, 28243 }, // ē
+    { 23, 35, 23, 1, 35, 202, 28373 }, // Ĕ
+    { 20, 30, 22, 2, 30, 150, 28672 }, // ĕ
+    { 23, 34, 23, 1, 34, 196, 28822 }, // Ė
+    { 18, 28, 22, 2, 28, 126, 29018 }, // ė
+    { 23, 31, 23, 1, 25, 179, 29144 }, // Ę
+    { 18, 24, 22, 2, 17, 108, 29323 }, // ę
+    { 23, 35, 23, 1, 35, 202, 29431 }, // Ě
+    { 19, 30, 22, 2, 30, 143, 29633 }, // ě
+    { 26, 34, 29, 2, 34, 221, 29776 }, // Ĝ
+    { 22, 32, 22, 0, 24, 176, 29997 }, // ĝ
+    { 26, 36, 29, 2, 36, 234, 30173 }, // Ğ
+    { 21, 34, 22, 0, 26, 179, 30407 }, // ğ
+    { 25, 34, 29, 2, 34, 213, 30720 }, // Ġ
+    { 21, 33, 22, 0, 25, 174, 30933 }, // ġ
+    { 25, 39, 29, 2, 26, 244, 31107 }, // Ģ
+    { 21, 35, 22, 0, 27, 184, 31351 }, // ģ
+    { 27, 33, 27, 1, 33, 223, 31535 }, // Ĥ
+    { 19, 31, 22, 1, 31, 148, 31758 }, // ĥ
+    { 27, 24, 27, 1, 24, 162, 31906 }, // Ħ
+    { 19, 25, 22, 1, 25, 119, 32068 }, // ħ
+    { 17, 36, 12, 1, 36, 153, 32187 }, // Ĩ
+    { 14, 25, 11, 1, 25, 88, 32340 }, // ĩ
+    { 18, 34, 12, 1, 34, 153, 32428 }, // Ī
+    { 15, 23, 11, 1, 23, 87, 32581 }, // ī
+    { 14, 31, 18, 3, 25, 109, 32768 }, // Į
+    { 13, 32, 11, -1, 26, 104, 32877 }, // į
+    { 14, 36, 12, 1, 36, 126, 32981 }, // İ
+    { 8, 17, 11, 1, 17, 34, 33107 }, // ı
+    { 23, 32, 27, 1, 25, 184, 33141 }, // Ĳ
+    { 27, 34, 11, 1, 26, 230, 33325 }, // ĳ
+    { 24, 40, 18, -1, 33, 240, 33555 }, // Ĵ
+    { 24, 31, 19, 2, 24, 186, 33795 }, // ĵ
+    { 23, 36, 26, 1, 25, 207, 33981 }, // Ķ
+    { 16, 38, 22, 1, 24, 152, 34188 }, // ķ
+    { 14, 16, 16, 0, 16, 56, 34340 }, // ĸ
+    { 18, 35, 22, 1, 35, 158, 34396 }, // Ĺ
+    { 16, 34, 14, 1, 34, 136, 34554 }, // ĺ
+    { 18, 38, 22, 1, 25, 171, 34816 }, // Ļ
+    { 12, 37, 14, 0, 24, 111, 34987 }, // ļ
+    { 19, 25, 22, 1, 25, 119, 35098 }, // Ľ
+    { 18, 25, 14, 1, 25, 113, 35217 }, // ľ
+    { 20, 25, 22, 1, 25, 125, 35330 }, // Ŀ
+    { 16, 25, 14, 1, 25, 100, 35455 }, // ŀ
+    { 40, 37, 22, -14, 30, 370, 35555 }, // Ł
+    { 28, 24, 14, -10, 24, 168, 35925 }, // ł
+    { 28, 35, 27, 1, 35, 245, 36093 }, // Ń
+    { 20, 28, 22, 1, 28, 140, 36338 }, // ń
+    { 28, 36, 27, 1, 25, 252, 36478 }, // Ņ
+    { 18, 28, 22, 1, 17, 126, 36730 }, // ņ
+    { 28, 35, 27, 1, 35, 245, 36864 }, // Ň
+    { 20, 28, 22, 1, 28, 140, 37109 }, // ň
+    { 20, 30, 20, -3, 30, 150, 37249 }, // ŉ
+    { 28, 32, 27, 1, 25, 224, 37399 }, // Ŋ
+    { 18, 22, 22, 1, 17, 99, 37623 }, // ŋ
+    { 28, 33, 29, 2, 32, 231, 37722 }, // Ō
+    { 20, 25, 22, 2, 25, 125, 37953 }, // ō
+    { 28, 36, 29, 2, 35, 252, 38078 }, // Ŏ
+    { 20, 29, 22, 2, 29, 145, 38330 }, // ŏ
+    { 29, 35, 29, 2, 34, 254, 38475 }, // Ő
+    { 23, 27, 22, 2, 27, 156, 38729 }, // ő
+    { 38, 25, 35, 2, 25, 238, 38912 }, // Œ
+    { 30, 17, 31, 2, 17, 128, 39150 }, // œ
+    { 22, 34, 24, 1, 34, 187, 39278 }, // Ŕ
+    { 15, 25, 17, 1, 25, 94, 39465 }, // ŕ
+    { 22, 39, 24, 1, 25, 215, 39559 }, // Ŗ
+    { 18, 32, 17, -2, 17, 144, 39774 }, // ŗ
+    { 22, 34, 24, 1, 34, 187, 39918 }, // Ř
+    { 15, 25, 17, 1, 25, 94, 40105 }, // ř
+    { 25, 38, 29, 1, 37, 238, 40199 }, // Ś
+    { 17, 27, 21, 1, 27, 115, 40437 }, // ś
+    { 26, 35, 29, 1, 34, 228, 40552 }, // Ŝ
+    { 19, 24, 21, 1, 24, 114, 40780 }, // ŝ
+    { 25, 33, 29, 1, 26, 207, 40960 }, // Ş
+    { 17, 24, 21, 1, 16, 102, 41167 }, // ş
+    { 25, 38, 29, 1, 37, 238, 41269 }, // Š
+    { 17, 27, 21, 1, 27, 115, 41507 }, // š
+    { 23, 31, 27, 6, 25, 179, 41622 }, // Ţ
+    { 13, 28, 19, 4, 22, 91, 41801 }, // ţ
+    { 23, 35, 27, 6, 35, 202, 41892 }, // Ť
+    { 17, 25, 19, 4, 25, 107, 42094 }, // ť
+    { 23, 25, 27, 6, 25, 144, 42201 }, // Ŧ
+    { 15, 22, 19, 2, 22, 83, 42345 }, // ŧ
+    { 26, 36, 27, 2, 35, 234, 42428 }, // Ũ
+    { 18, 26, 21, 2, 25, 117, 42662 }, // ũ
+    { 26, 34, 27, 2, 33, 221, 42779 }, // Ū
+    { 19, 24, 21, 2, 23, 114, 43008 }, // ū
+    { 26, 37, 27, 2, 36, 241, 43122 }, // Ŭ
+    { 19, 27, 21, 2, 26, 129, 43363 }, // ŭ
+    { 26, 38, 27, 2, 37, 247, 43492 }, // Ů
+    { 18, 28, 21, 2, 27, 126, 43739 }, // ů
+    { 28, 36, 27, 2, 35, 252, 43865 }, // Ű
+    { 22, 26, 21, 2, 25, 143, 44117 }, // ű
+    { 26, 31, 27, 2, 25, 202, 44260 }, // Ų
+    { 18, 23, 21, 2, 16, 104, 44462 }, // ų
+    { 33, 32, 37, 6, 32, 264, 44566 }, // Ŵ
+    { 23, 24, 28, 5, 24, 138, 44830 }, // ŵ
+    { 21, 33, 27, 7, 33, 174, 45056 }, // Ŷ
+    { 22, 33, 23, 0, 25, 182, 45230 }, // ŷ
+    { 21, 34, 27, 7, 34, 179, 45412 }, // Ÿ
+    { 29, 35, 29, 1, 35, 254, 45591 }, // Ź
+    { 20, 27, 22, 1, 27, 135, 45845 }, // ź
+    { 29, 33, 29, 1, 33, 240, 45980 }, // Ż
+    { 20, 25, 22, 1, 25, 125, 46220 }, // ż
+    { 29, 35, 29, 1, 35, 254, 46345 }, // Ž
+    { 20, 27, 22, 1, 27, 135, 46599 }, // ž
+    { 16, 24, 15, 4, 24, 96, 46734 }, // ſ
+    { 9, 5, 0, 7, 22, 12, 46830 }, // ̀
+    { 7, 6, 0, 6, 23, 11, 46842 }, // ́
+    { 13, 6, 0, -1, 0, 20, 46853 }, // ̂
+    { 13, 6, 0, 5, 22, 20, 46873 }, // ̃
+    { 14, 4, 0, 5, 20, 14, 46893 }, // ̄
+    { 19, 4, 0, 9, 26, 19, 46907 }, // ̅
+    { 13, 6, 0, 6, 21, 20, 46926 }, // ̆
+    { 6, 5, 0, 6, 22, 8, 46946 }, // ̇
+    { 14, 5, 0, 6, 23, 18, 46954 }, // ̈
+    { 7, 6, 0, 5, 19, 11, 46972 }, // ̉
+    { 8, 6, 0, 6, 22, 12, 46983 }, // ̊
+    { 20, 5, 0, 6, 22, 25, 46995 }, // ̋
+    { 12, 6, 0, 6, 22, 18, 47020 }, // ̌
+    { 21, 5, 0, -9, 24, 27, 47038 }, // ̏
+    { 10, 9, 0, 4, 22, 23, 47065 }, // ̒
+    { 10, 9, 0, 4, 22, 23, 47104 }, // ̓
+    { 10, 9, 0, -5, 22, 23, 47127 }, // ̔
+    { 7, 7, 0, 0, -1, 13, 47150 }, // ̘
+    { 7, 7, 0, 2, -1, 13, 47163 }, // ̙
+    { 12, 7, 0, 8, 23, 21, 47176 }, // ̚
+    { 6, 7, 0, 5, 19, 11, 47197 }, // ̛
+    { 5, 6, 0, 0, -2, 8, 47208 }, // ̜
+    { 7, 6, 0, 3, 5, 11, 47216 }, // ̝
+    { 7, 6, 0, 0, -1, 11, 47227 }, // ̞
+    { 7, 7, 0, 0, -2, 13, 47238 }, // ̟
+    { 14, 4, 0, 0, -4, 14, 47251 }, // ̠
+    { 6, 5, 0, 0, 1, 8, 47265 }, // ̣
+    { 15, 5, 0, -1, -1, 19, 47273 }, // ̤
+    { 8, 6, 0, 6, 22, 12, 47292 }, // ̥
+    { 10, 10, 0, 0, 5, 25, 47304 }, // ̦
+    { 8, 8, 0, 0, 1, 16, 47329 }, // ̧
+    { 8, 8, 0, 0, 1, 16, 47345 }, // ̨
+    { 6, 8, 0, -1, -2, 12, 47361 }, // ̩
+    { 11, 5, 0, 0, -1, 14, 47373 }, // ̪
+    { 12, 6, 0, 0, 0, 18, 47387 }, // ̬
+    { 12, 6, 0, -1, -1, 18, 47405 }, // ̭
+    { 13, 6, 0, 5, 22, 20, 47423 }, // ̰
+    { 11, 3, 0, 7, 21, 9, 47443 }, // ̱
+    { 13, 4, 0, 0, -2, 13, 47452 }, // ̲
+    { 13, 6, 0, 5, 22, 20, 47465 }, // ̴
+    { 14, 3, 0, 4, 10, 11, 47485 }, // ̵
+    { 5, 6, 0, 2, -2, 8, 47496 }, // ̹
+    { 11, 5, 0, -2, -1, 14, 47504 }, // ̺
+    { 11, 8, 0, 0, 0, 22, 47518 }, // ̻
+    { 11, 6, 0, 0, 0, 17, 47540 }, // ̼
+    { 8, 6, 0, 6, 22, 12, 47557 }, // ̽
+    { 13, 6, 0, 5, 22, 20, 47569 }, // ͂
+    { 5, 5, 0, 6, 24, 7, 47589 }, // ̓
+    { 14, 13, 0, 6, 31, 46, 47596 }, // ̈́
+    { 10, 5, 0, 7, 23, 13, 47642 }, // ͆
+    { 16, 11, 0, -1, 0, 44, 47655 }, // ͇
+    { 13, 8, 0, 0, 0, 26, 47699 }, // ͈
+    { 10, 7, 0, 0, -2, 18, 47725 }, // ͉
+    { 14, 17, 0, 5, 28, 60, 47743 }, // ͊
+    { 27, 13, 0, 10, 26, 88, 47803 }, // ͋
+    { 20, 14, 0, 6, 15, 70, 47891 }, // ͌
+    { 15, 9, 0, 2, -1, 34, 47961 }, // ͍
+    { 4, 4, 0, 4, 3, 4, 47995 }, // ͎
+    { 24, 6, 0, 1, 0, 36, 47999 }, // ͜
+    { 24, 5, 0, 6, 23, 30, 48035 }, // ͡
+    { 29, 7, 0, 0, -2, 51, 48065 }, // ͢
+    { 20, 30, 18, 2, 30, 150, 48116 }, // Ѐ
+    { 20, 28, 18, 2, 28, 140, 48266 }, // Ё
+    { 21, 24, 30, 9, 24, 126, 48406 }, // Ђ
+    { 21, 34, 19, 2, 34, 179, 48532 }, // Ѓ
+    { 24, 24, 26, 1, 23, 144, 48711 }, // Є
+    { 25, 27, 29, 1, 26, 169, 48855 }, // Ѕ
+    { 12, 25, 12, 1, 25, 75, 49024 }, // І
+    { 18, 35, 12, 1, 35, 158, 49152 }, // Ї
+    { 21, 33, 18, -1, 26, 174, 49310 }, // Ј
+    { 31, 23, 34, 3, 22, 179, 49484 }, // Љ
+    { 29, 23, 33, 3, 22, 167, 49663 }, // Њ
+    { 23, 25, 27, 6, 25, 144, 49830 }, // Ћ
+    { 25, 35, 26, 1, 35, 219, 49974 }, // Ќ
+    { 26, 31, 27, 2, 31, 202, 50193 }, // Ѝ
+    { 22, 33, 20, -1, 32, 182, 50395 }, // Ў
+    { 22, 27, 21, 2, 21, 149, 50577 }, // Џ
+    { 23, 25, 29, 1, 25, 144, 50726 }, // А
+    { 20, 22, 19, 3, 21, 110, 50870 }, // Б
+    { 19, 22, 20, 2, 21, 105, 50980 }, // В
+    { 21, 22, 19, 2, 22, 116, 51200 }, // Г
+    { 22, 24, 24, 3, 21, 132, 51316 }, // Д
+    { 20, 22, 18, 2, 22, 110, 51448 }, // Е
+    { 35, 25, 37, 1, 25, 219, 51558 }, // Ж
+    { 19, 24, 21, 1, 23, 114, 51777 }, // З
+    { 26, 25, 27, 2, 25, 163, 51891 }, // И
+    { 26, 33, 27, 2, 33, 215, 52054 }, // Й
+    { 23, 25, 26, 1, 25, 144, 52269 }, // К
+    { 23, 22, 22, 2, 21, 127, 52413 }, // Л
+    { 26, 21, 25, 2, 21, 137, 52540 }, // М
+    { 27, 25, 27, 1, 25, 169, 52677 }, // Н
+    { 28, 26, 29, 2, 25, 182, 52846 }, // О
+    { 21, 22, 20, 2, 22, 116, 53028 }, // П
+    { 23, 25, 23, 1, 25, 144, 53248 }, // Р
+    { 25, 27, 25, 1, 26, 169, 53392 }, // С
+    { 23, 25, 27, 6, 25, 144, 53561 }, // Т
+    { 22, 24, 20, -1, 23, 132, 53705 }, // У
+    { 24, 22, 25, 5, 22, 132, 53837 }, // Ф
+    { 29, 25, 29, 1, 25, 182, 53969 }, // Х
+    { 20, 27, 21, 2, 22, 135, 54151 }, // Ц
+    { 18, 22, 19, 5, 22, 99, 54286 }, // Ч
+    { 25, 22, 24, 2, 22, 138, 54385 }, // Ш
+    { 25, 27, 26, 2, 22, 169, 54523 }, // Щ
+    { 17, 23, 19, 2, 22, 98, 54692 }, // Ъ
+    { 30, 24, 32, 2, 23, 180, 54790 }, // Ы
+    { 17, 23, 19, 2, 22, 98, 54970 }, // Ь
+    { 24, 24, 26, 2, 23, 144, 55068 }, // Э
+    { 28, 23, 29, 3, 22, 161, 55296 }, // Ю
+    { 23, 25, 24, 1, 25, 144, 55457 }, // Я
+    { 18, 18, 22, 1, 18, 81, 55601 }, // а
+    { 20, 23, 20, 3, 23, 115, 55682 }, // б
+    { 17, 18, 18, 0, 18, 77, 55797 }, // в
+    { 18, 17, 17, 2, 17, 77, 55874 }, // г
+    { 19, 20, 22, 3, 17, 95, 55951 }, // д
+    { 18, 17, 22, 2, 17, 77, 56046 }, // е
+    { 31, 20, 31, 0, 20, 155, 56123 }, // ж
+    { 13, 16, 13, 1, 16, 52, 56278 }, // з
+    { 19, 17, 20, 2, 17, 81, 56330 }, // и
+    { 19, 22, 20, 2, 22, 105, 56411 }, // й
+    { 18, 17, 20, 0, 17, 77, 56516 }, // к
+    { 16, 16, 15, 1, 15, 64, 56593 }, // л
+    { 23, 19, 24, 0, 19, 110, 56657 }, // м
+    { 23, 19, 23, 0, 19, 110, 56767 }, // н
+    { 17, 18, 24, 3, 17, 77, 56877 }, // о
+    { 19, 17, 19, 2, 17, 81, 56954 }, // п
+    { 23, 24, 24, -1, 16, 138, 57035 }, // р
+    { 15, 18, 20, 2, 17, 68, 57173 }, // с
+    { 16, 16, 20, 6, 16, 64, 57241 }, // т
+    { 22, 24, 23, 0, 16, 132, 57344 }, // у
+    { 24, 23, 25, 3, 16, 138, 57476 }, // ф
+    { 21, 16, 21, 2, 16, 84, 57614 }, // х
+    { 19, 21, 21, 2, 17, 100, 57698 }, // ц
+    { 13, 15, 13, 2, 15, 49, 57798 }, // ч
+    { 24, 17, 24, 2, 17, 102, 57847 }, // ш
+    { 24, 22, 26, 2, 17, 132, 57949 }, // щ
+    { 17, 17, 22, 5, 16, 73, 58081 }, // ъ
+    { 23, 18, 24, 3, 17, 104, 58154 }, // ы
+    { 16, 18, 18, 2, 17, 72, 58258 }, // ь
+    { 18, 18, 19, 2, 17, 81, 58330 }, // э
+    { 22, 19, 23, 2, 18, 105, 58411 }, // ю
+    { 19, 17, 18, 2, 17, 81, 58516 }, // я
+    { 18, 28, 22, 2, 28, 126, 58597 }, // ѐ
+    { 19, 22, 19, 3, 22, 105, 58723 }, // ё
+    { 19, 30, 22, 1, 25, 143, 58828 }, // ђ
+    { 18, 25, 17, 2, 25, 113, 58971 }, // ѓ
+    { 17, 17, 18, 0, 16, 73, 59084 }, // є
+    { 17, 16, 21, 1, 16, 68, 59157 }, // ѕ
+    { 11, 26, 11, 1, 26, 72, 59225 }, // і
+    { 15, 25, 11, 1, 25, 94, 59297 }, // ї
+    { 19, 32, 19, 2, 25, 152, 59392 }, // ј
+    { 22, 16, 23, 1, 15, 88, 59544 }, // љ
+    { 21, 16, 23, 1, 15, 84, 59632 }, // њ
+    { 19, 25, 22, 1, 25, 119, 59716 }, // ћ
+    { 18, 26, 20, 0, 26, 117, 59835 }, // ќ
+    { 19, 25, 20, 2, 25, 119, 59952 }, // ѝ
+    { 22, 36, 23, 0, 28, 198, 60071 }, // ў
+    { 16, 20, 15, 1, 15, 80, 60269 }, // џ
+    { 16, 23, 24, 8, 22, 92, 60349 }, // Ѣ
+    { 15, 22, 21, 6, 21, 83, 60441 }, // ѣ
+    { 28, 21, 30, 3, 21, 147, 60524 }, // Ѫ
+    { 20, 16, 21, 1, 15, 80, 60671 }, // ѫ
+    { 25, 27, 29, 3, 26, 169, 60751 }, // Ѳ
+    { 20, 20, 22, 2, 20, 100, 60920 }, // ѳ
+    { 33, 31, 30, 7, 31, 256, 61020 }, // Ѵ
+    { 19, 20, 24, 5, 20, 95, 61276 }, // ѵ
+    { 11, 9, 0, 8, 27, 25, 61371 }, // ҆
+    { 22, 25, 19, 2, 25, 138, 61440 }, // Ґ
+    { 19, 20, 17, 2, 20, 95, 61578 }, // ґ
+    { 21, 22, 19, 2, 22, 116, 61673 }, // Ғ
+    { 15, 15, 13, 0, 15, 57, 61789 }, // ғ
+    { 23, 24, 20, 2, 24, 138, 61846 }, // Ҕ
+    { 13, 15, 12, 0, 15, 49, 61984 }, // ҕ
+    { 35, 29, 37, -1, 25, 254, 62033 }, // Җ
+    { 25, 21, 26, -2, 18, 132, 62287 }, // җ
+    { 19, 27, 21, 2, 23, 129, 62419 }, // Ҙ
+    { 14, 23, 13, 0, 16, 81, 62548 }, // ҙ
+    { 24, 29, 26, -1, 25, 174, 62629 }, // Қ
+    { 17, 21, 18, -2, 18, 90, 62803 }, // қ
+    { 25, 21, 28, 3, 21, 132, 62893 }, // Ҝ
+    { 18, 15, 21, 2, 15, 68, 63025 }, // ҝ
+    { 23, 25, 26, 1, 25, 144, 63093 }, // Ҟ
+    { 16, 23, 22, 1, 23, 92, 63237 }, // ҟ
+    { 25, 25, 26, -1, 25, 157, 63329 }, // Ҡ
+    { 17, 18, 18, -1, 18, 77, 63488 }, // ҡ
+    { 27, 28, 27, -1, 25, 189, 63565 }, // Ң
+    { 19, 20, 19, -2, 17, 95, 63754 }, // ң
+    { 36, 26, 27, 1, 26, 234, 63849 }, // Ҥ
+    { 25, 17, 19, 0, 17, 107, 64083 }, // ҥ
+    { 31, 24, 34, 3, 24, 186, 64190 }, // Ҧ
+    { 27, 27, 31, 3, 19, 183, 64376 }, // ҧ
+    { 28, 25, 35, 4, 24, 175, 64559 }, // Ҩ
+    { 22, 20, 27, 3, 19, 110, 64734 }, // ҩ
+    { 25, 31, 25, 1, 26, 194, 64844 }, // Ҫ
+    { 15, 21, 20, 2, 17, 79, 65038 }, // ҫ
+    { 23, 28, 27, 4, 25, 161, 65117 }, // Ҭ
+    { 16, 20, 19, 2, 17, 80, 65278 }, // ҭ
+    { 21, 25, 27, 7, 25, 132, 65358 }, // Ү
+    { 16, 21, 19, 6, 15, 84, 65536 }, // ү
+    { 22, 25, 27, 6, 25, 138, 65620 }, // Ұ
+    { 21, 22, 19, 1, 15, 116, 65758 }, // ұ
+    { 29, 29, 29, -1, 25, 211, 65874 }, // Ҳ
+    { 20, 20, 20, -2, 17, 100, 66085 }, // ҳ
+    { 22, 27, 31, 8, 21, 149, 66185 }, // Ҵ
+    { 16, 19, 22, 5, 15, 76, 66334 }, // ҵ
+    { 18, 28, 24, 5, 21, 126, 66410 }, // Ҷ
+    { 13, 20, 17, 3, 15, 65, 66536 }, // ҷ
+    { 20, 22, 21, 5, 22, 110, 66601 }, // Ҹ
+    { 14, 15, 15, 3, 15, 53, 66711 }, // ҹ
+    { 18, 24, 22, 3, 24, 108, 66764 }, // Һ
+    { 19, 25, 22, 1, 25, 119, 66872 }, // һ
+    { 24, 22, 28, 2, 21, 132, 66991 }, // Ҽ
+    { 17, 16, 20, 1, 16, 68, 67123 }, // ҽ
+    { 24, 25, 32, 5, 21, 150, 67191 }, // Ҿ
+    { 17, 19, 23, 3, 16, 81, 67341 }, // ҿ
+    { 12, 25, 12, 1, 25, 75, 67422 }, // Ӏ
+    { 35, 35, 37, 1, 35, 307, 67584 }, // Ӂ
+    { 31, 31, 31, 0, 31, 241, 67891 }, // ӂ
+    { 21, 29, 23, 3, 22, 153, 68132 }, // Ӄ
+    { 15, 20, 16, 1, 15, 75, 68285 }, // ӄ
+    { 23, 27, 22, 2, 22, 156, 68360 }, // Ӆ
+    { 16, 18, 15, 1, 15, 72, 68516 }, // ӆ
+    { 27, 32, 27, 1, 25, 216, 68588 }, // Ӈ
+    { 18, 22, 19, 0, 17, 99, 68804 }, // ӈ
+    { 27, 34, 27, 1, 25, 230, 68903 }, // Ӊ
+    { 19, 23, 19, 0, 17, 110, 69133 }, // ӊ
+    { 18, 27, 20, 4, 21, 122, 69243 }, // Ӌ
+    { 13, 19, 15, 3, 15, 62, 69365 }, // ӌ
+    { 31, 34, 36, 1, 25, 264, 69632 }, // Ӎ
+    { 21, 23, 25, 0, 17, 121, 69896 }, // ӎ
+    { 9, 21, 8, 2, 21, 48, 70017 }, // ӏ
+    { 26, 35, 29, 1, 35, 228, 70065 }, // Ӑ
+    { 24, 27, 22, 1, 27, 162, 70293 }, // ӑ
+    { 26, 34, 29, 1, 34, 221, 70455 }, // Ӓ
+    { 24, 25, 22, 1, 25, 150, 70676 }, // ӓ
+    { 38, 26, 42, 1, 25, 247, 70826 }, // Ӕ
+    { 30, 18, 36, 1, 18, 135, 71073 }, // ӕ
+    { 21, 31, 18, 2, 31, 163, 71208 }, // Ӗ
+    { 20, 29, 22, 2, 29, 145, 71371 }, // ӗ
+    { 19, 17, 22, 2, 16, 81, 71516 }, // Ә
+    { 18, 19, 24, 10, 18, 86, 71680 }, // ә
+    { 23, 29, 22, 2, 28, 167, 71766 }, // Ӛ
+    { 20, 21, 24, 8, 18, 105, 71933 }, // ӛ
+    { 35, 34, 38, 1, 34, 298, 72038 }, // Ӝ
+    { 31, 29, 31, 0, 29, 225, 72336 }, // ӝ
+    { 21, 31, 21, 1, 30, 163, 72561 }, // Ӟ
+    { 20, 24, 13, 1, 24, 120, 72724 }, // ӟ
+    { 17, 21, 17, 3, 21, 90, 72844 }, // Ӡ
+    { 16, 22, 17, 2, 16, 88, 72934 }, // ӡ
+    { 26, 30, 27, 2, 30, 195, 73022 }, // Ӣ
+    { 20, 23, 20, 2, 23, 115, 73217 }, // ӣ
+    { 26, 31, 27, 2, 31, 202, 73332 }, // Ӥ
+    { 20, 24, 20, 2, 24, 120, 73534 }, // ӥ
+    { 28, 34, 29, 2, 33, 238, 73728 }, // Ӧ
+    { 20, 26, 24, 3, 25, 130, 73966 }, // ӧ
+    { 24, 22, 29, 3, 21, 132, 74096 }, // Ө
+    { 18, 16, 22, 2, 16, 72, 74228 }, // ө
+    { 24, 34, 29, 3, 33, 204, 74300 }, // Ӫ
+    { 20, 27, 22, 2, 27, 135, 74504 }, // ӫ
+    { 24, 32, 26, 2, 31, 192, 74639 }, // Ӭ
+    { 18, 25, 19, 2, 24, 113, 74831 }, // ӭ
+    { 22, 31, 20, -1, 30, 171, 74944 }, // Ӯ
+    { 23, 33, 23, 0, 25, 190, 75115 }, // ӯ
+    { 22, 32, 20, -1, 31, 176, 75305 }, // Ӱ
+    { 22, 35, 23, 0, 27, 193, 75481 }, // ӱ
+    { 25, 33, 20, -1, 32, 207, 75776 }, // Ӳ
+    { 26, 36, 23, 0, 28, 234, 75983 }, // ӳ
+    { 19, 30, 19, 5, 30, 143, 76217 }, // Ӵ
+    { 16, 24, 13, 2, 24, 96, 76360 }, // ӵ
+    { 21, 26, 19, 2, 22, 137, 76456 }, // Ӷ
+    { 15, 18, 13, 0, 15, 68, 76593 }, // ӷ
+    { 30, 33, 32, 2, 32, 248, 76661 }, // Ӹ
+    { 23, 27, 24, 3, 26, 156, 76909 }, // ӹ
+    { 29, 29, 29, 1, 25, 211, 77065 }, // Ӽ
+    { 20, 21, 20, 0, 18, 105, 77276 }, // ӽ
+    { 0, 0, 24, 0, 0, 0, 77381 }, //  
+    { 0, 0, 39, 0, 0, 0, 77381 }, //  
+    { 0, 0, 24, 0, 0, 0, 77381 }, //  
+    { 0, 0, 39, 0, 0, 0, 77381 }, //  
+    { 0, 0, 19, 0, 0, 0, 77381 }, //  
+    { 0, 0, 17, 0, 0, 0, 77381 }, //  
+    { 0, 0, 14, 0, 0, 0, 77381 }, //  
+    { 0, 0, 19, 0, 0, 0, 77381 }, //  
+    { 0, 0, 8, 0, 0, 0, 77381 }, //  
+    { 0, 0, 15, 0, 0, 0, 77381 }, //  
+    { 0, 0, 14, 0, 0, 0, 77381 }, //  
+    { 0, 0, 9, 0, 0, 0, 77381 }, // ​
+    { 0, 0, 0, 0, 0, 0, 77381 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 77381 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 77381 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 77381 }, // ‏
+    { 14, 3, 16, 4, 10, 11, 77381 }, // ‐
+    { 14, 3, 16, 4, 10, 11, 77392 }, // ‑
+    { 21, 3, 22, 5, 10, 16, 77403 }, // ‒
+    { 20, 4, 23, 4, 10, 20, 77419 }, // –
+    { 30, 4, 33, 4, 10, 30, 77439 }, // —
+    { 30, 4, 33, 4, 10, 30, 77469 }, // ―
+    { 19, 25, 16, 1, 21, 119, 77499 }, // ‖
+    { 24, 9, 23, 0, -3, 54, 77618 }, // ‗
+    { 9, 9, 10, 6, 25, 21, 77672 }, // ‘
+    { 10, 9, 10, 5, 25, 23, 77693 }, // ’
+    { 10, 10, 9, 0, 5, 25, 77716 }, // ‚
+    { 9, 9, 10, 6, 25, 21, 77741 }, // ‛
+    { 16, 9, 16, 6, 25, 36, 77762 }, // “
+    { 17, 9, 17, 5, 25, 39, 77824 }, // ”
+    { 10, 10, 9, 0, 5, 25, 77863 }, // „
+    { 17, 9, 17, 6, 25, 39, 77888 }, // ‟
+    { 16, 38, 17, 5, 30, 152, 77927 }, // †
+    { 19, 38, 18, 2, 30, 181, 78079 }, // ‡
+    { 19, 17, 15, 0, 20, 81, 78260 }, // •
+    { 9, 9, 11, 3, 13, 21, 78341 }, // ‣
+    { 6, 5, 8, 1, 5, 8, 78362 }, // ․
+    { 6, 5, 8, 1, 5, 8, 78370 }, // ‥
+    { 26, 5, 28, 1, 5, 33, 78378 }, // …
+    { 5, 3, 7, 2, 10, 4, 78411 }, // ‧
+    { 0, 0, 37, 0, 0, 0, 78415 }, //  
+    { 24, 25, 32, 7, 23, 150, 78415 }, // ‰
+    { 10, 9, 9, 5, 25, 23, 78565 }, // ′
+    { 17, 9, 16, 5, 25, 39, 78588 }, // ″
+    { 21, 9, 25, -3, 25, 48, 78627 }, // ‴
+    { 6, 9, 10, 7, 24, 14, 78675 }, // ‵
+    { 12, 9, 15, 6, 24, 27, 78689 }, // ‶
+    { 21, 9, 25, 7, 25, 48, 78716 }, // ‷
+    { 12, 5, 16, 7, 23, 15, 78764 }, // ‸
+    { 10, 14, 12, 4, 15, 35, 78779 }, // ‹
+    { 10, 14, 12, -2, 15, 35, 78814 }, // ›
+    { 37, 29, 39, 1, 26, 269, 78849 }, // ※
+    { 14, 29, 10, 1, 29, 102, 79118 }, // ‼
+    { 20, 37, 22, 5, 35, 185, 79220 }, // ‽
+    { 15, 4, 16, 7, 24, 15, 79405 }, // ‾
+    { 13, 6, 19, 6, 20, 20, 79420 }, // ‿
+    { 20, 18, 23, 5, 25, 90, 79440 }, // ⁂
+    { 24, 24, 32, 7, 22, 144, 79530 }, // ⁄
+    { 35, 33, 37, 7, 33, 289, 79872 }, // ⁇
+    { 25, 33, 29, 7, 33, 207, 80161 }, // ⁈
+    { 30, 35, 24, 0, 33, 263, 80368 }, // ⁉
+    { 29, 46, 22, -1, 32, 334, 80631 }, // ⁒
+    { 0, 0, 141, 0, 0, 0, 80965 }, //  
+    { 10, 11, 9, 3, 24, 28, 80965 }, // ⁰
+    { 8, 11, 9, 4, 24, 22, 80993 }, // ⁴
+    { 10, 12, 9, 3, 25, 30, 81015 }, // ⁵
+    { 9, 11, 9, 4, 24, 25, 81045 }, // ⁶
+    { 8, 13, 10, 6, 25, 26, 81070 }, // ⁷
+    { 10, 11, 10, 3, 24, 28, 81096 }, // ⁸
+    { 10, 11, 10, 4, 24, 28, 81124 }, // ⁹
+    { 18, 17, 22, 1, 17, 77, 81152 }, // ⁿ
+    { 14, 15, 13, 1, 15, 53, 81229 }, // ₀
+    { 8, 12, 9, -2, 7, 24, 81282 }, // ₁
+    { 11, 12, 10, -2, 7, 33, 81306 }, // ₂
+    { 10, 11, 9, -1, 6, 28, 81339 }, // ₃
+    { 9, 11, 10, -1, 6, 25, 81367 }, // ₄
+    { 9, 12, 9, -1, 7, 27, 81392 }, // ₅
+    { 10, 12, 10, -1, 7, 30, 81419 }, // ₆
+    { 8, 12, 10, 1, 7, 24, 81449 }, // ₇
+    { 11, 11, 10, -2, 6, 31, 81473 }, // ₈
+    { 10, 11, 10, -1, 6, 28, 81504 }, // ₉
+    { 17, 40, 13, 3, 30, 170, 81532 }, // ₍
+    { 16, 40, 13, -7, 30, 160, 81702 }, // ₎
+    { 28, 37, 25, 0, 31, 259, 81920 }, // ₡
+    { 25, 27, 25, 1, 26, 169, 82179 }, // ₢
+    { 23, 27, 20, 1, 27, 156, 82348 }, // ₤
+    { 30, 25, 27, 0, 25, 188, 82504 }, // ₦
+    { 25, 25, 23, 1, 25, 157, 82692 }, // ₧
+    { 33, 24, 33, 0, 24, 198, 82849 }, // ₨
+    { 24, 24, 23, -1, 24, 144, 83047 }, // ₩
+    { 27, 23, 31, 5, 23, 156, 83191 }, // ₪
+    { 22, 23, 20, 2, 23, 127, 83347 }, // ₫
+    { 22, 26, 24, 3, 23, 143, 83474 }, // €
+    { 23, 25, 27, 6, 25, 144, 83617 }, // ₮
+    { 28, 25, 19, 1, 25, 175, 83761 }, // ₱
+    { 25, 34, 29, 2, 30, 213, 83968 }, // ₲
+    { 32, 27, 27, 3, 26, 216, 84181 }, // ₴
+    { 15, 23, 20, 2, 21, 87, 84397 }, // ₵
+    { 26, 26, 27, 6, 26, 169, 84484 }, // ₸
+    { 17, 22, 18, 4, 22, 94, 84653 }, // ₹
+    { 17, 21, 20, 3, 20, 90, 84747 }, // ₺
+    { 21, 23, 18, 2, 23, 121, 84837 }, // ₼
+    { 27, 25, 23, -3, 25, 169, 84958 }, // ₽
+    { 18, 18, 22, -3, 14, 81, 85127 }, // ←
+    { 19, 18, 22, 4, 18, 86, 85208 }, // ↑
+    { 18, 18, 22, 7, 14, 81, 85294 }, // →
+    { 19, 18, 22, 9, 18, 86, 85375 }, // ↓
+    { 31, 15, 26, -2, 13, 117, 85461 }, // ↔
+    { 15, 30, 19, 4, 28, 113, 85578 }, // ↕
+    { 17, 13, 19, -3, 13, 56, 85691 }, // ↖
+    { 18, 13, 19, 4, 13, 59, 85747 }, // ↗
+    { 14, 18, 19, 7, 16, 63, 85806 }, // ↘
+    { 14, 18, 19, -2, 16, 63, 85869 }, // ↙
+    { 22, 19, 25, 0, 18, 105, 86016 }, // ⇐
+    { 23, 21, 27, 5, 21, 121, 86121 }, // ⇑
+    { 22, 19, 25, 3, 18, 105, 86242 }, // ⇒
+    { 23, 22, 27, 10, 21, 127, 86347 }, // ⇓
+    { 29, 19, 28, 0, 18, 138, 86474 }, // ⇔
+    { 18, 28, 23, 7, 18, 126, 86612 }, // ⇕
+    { 21, 23, 20, 3, 23, 121, 86738 }, // ∂
+    { 30, 27, 29, 0, 26, 203, 86859 }, // ∅
+    { 22, 22, 25, 2, 22, 121, 87062 }, // ∆
+    { 21, 21, 22, 4, 21, 111, 87183 }, // ∏
+    { 21, 21, 22, 10, 21, 111, 87294 }, // ∐
+    { 19, 22, 17, 2, 21, 105, 87405 }, // ∑
+    { 14, 4, 18, 4, 10, 14, 87510 }, // −
+    { 28, 25, 27, 3, 23, 175, 87524 }, // √
+    { 26, 15, 27, 3, 18, 98, 87699 }, // ∞
+    { 31, 33, 25, 0, 26, 256, 87797 }, // ∫
+    { 10, 18, 8, 1, 18, 45, 88064 }, // ∶
+    { 20, 14, 23, 6, 15, 70, 88109 }, // ≈
+    { 24, 24, 32, 7, 22, 144, 88179 }, // ≠
+    { 25, 22, 25, -1, 20, 138, 88323 }, // ≤
+    { 26, 22, 25, 1, 20, 143, 88461 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_italicIntervals[] = {
@@ -6141,4 +3489,9 @@ static const EpdFontData opendyslexic_14_italic = {
     38,
     -16,
     true,
+    opendyslexic_14_italicBlockOffsets,
+    opendyslexic_14_italicDirectGlyphs,
+    opendyslexic_14_italicGlyphPages,
+    35,
+    opendyslexic_14_italicPageGlyphs,
 };
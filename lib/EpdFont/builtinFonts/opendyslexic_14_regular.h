@@ -2,4450 +2,2339 @@
  * generated by fontconvert.py
  * name: opendyslexic_14_regular
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_regularBitmaps[70983] = {
-    0x00, 0xA0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x1F,
-    0xFC, 0xBF, 0xF0, 0x7F, 0xE0, 0xBF, 0xC7, 0xFD, 0x0B, 0xFC, 0x7F, 0xC0, 0xFF, 0xC7, 0xFC, 0x0F,
-    0xF8, 0x7F, 0x80, 0xFF, 0x4B, 0xF8, 0x0F, 0xF4, 0xBF, 0x80, 0xFF, 0x4B, 0xFC, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xAA, 0xBF, 0xAA, 0xAF, 0xEA, 0xAA, 0x80, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0xAA, 0xBF, 0xAA, 0xAF, 0xEA, 0xAA, 0x80, 0x00, 0x1F, 0xD0,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xE8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xF9, 0xF5, 0x90, 0x00, 0x03, 0xFF, 0xBC, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x0B, 0x40,
-    0x00, 0x00, 0x7F, 0x47, 0xC2, 0xD0, 0x00, 0x00, 0x1F, 0xD1, 0xF0, 0xB4, 0x00, 0x00, 0x03, 0xFC,
-    0x7C, 0x2D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xBB, 0xFF, 0xF0,
-    0x00, 0x00, 0x3C, 0x2D, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0x0B, 0x7F, 0xFF, 0x40, 0x3E, 0x9B, 0xD7,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0x82, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x01, 0xE0, 0x0B, 0xFF,
-    0x00, 0x0F, 0x00, 0xB4, 0x1F, 0x00, 0xB8, 0x03, 0x80, 0x1D, 0x03, 0xC0, 0x0D, 0x00, 0x34, 0x3D,
-    0x00, 0x74, 0x00, 0xE1, 0xF0, 0x01, 0xD0, 0x03, 0x4F, 0x40, 0x03, 0xC0, 0x3D, 0xB8, 0x00, 0x0B,
-    0xFF, 0xF7, 0xC0, 0x00, 0x0B, 0xFF, 0x3E, 0x00, 0x00, 0x05, 0x91, 0xF2, 0xFD, 0x00, 0x00, 0x0F,
-    0xBE, 0xBE, 0x00, 0x00, 0xBE, 0xC0, 0x2C, 0x00, 0x07, 0xDE, 0x00, 0x38, 0x00, 0x3E, 0x34, 0x00,
-    0xE0, 0x02, 0xF0, 0xE0, 0x03, 0x80, 0x0F, 0x83, 0xC0, 0x1E, 0x00, 0xFC, 0x0B, 0xEA, 0xF0, 0x07,
-    0xD0, 0x0F, 0xFF, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4,
-    0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xE0, 0x00, 0x00, 0x1F,
-    0xF0, 0x3F, 0x80, 0x06, 0x93, 0xFD, 0x00, 0xBF, 0x00, 0xFE, 0x3F, 0xC0, 0x02, 0xFC, 0x1F, 0xD7,
-    0xFC, 0x00, 0x07, 0xF7, 0xFC, 0x7F, 0xD0, 0x00, 0x1F, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0xBF, 0xE0,
-    0x3F, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x10, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x7F, 0xCB, 0xFC, 0xBF, 0x8B, 0xF8, 0xBF, 0x8B, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00,
-    0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x02,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x1F,
-    0xC0, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x2F,
-    0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x07,
-    0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBF, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x05, 0x03, 0xC0, 0x34, 0x7E, 0x0F, 0x0B, 0xD0, 0xBF, 0x6D, 0xF8, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7F, 0x6C, 0xBF, 0x83, 0xF0,
-    0xB0, 0x3E, 0x07, 0x02, 0xD0, 0x10, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0x43,
-    0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xF4, 0x6F, 0x00, 0x0B, 0xC0,
-    0x07, 0xC0, 0x0F, 0x40, 0x02, 0xE0, 0x2F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0xF4, 0x7E, 0x03,
-    0x80, 0xF8, 0x7D, 0x0B, 0xC0, 0xFC, 0xBD, 0x0B, 0xC0, 0xBC, 0xBD, 0x0B, 0xC0, 0xFC, 0xBD, 0x0B,
-    0xC0, 0xFC, 0xBE, 0x03, 0x80, 0xFC, 0xBE, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x03, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xF9, 0x6F, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x7E, 0xFC, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x1F, 0x90, 0x1F, 0xF0, 0x50, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF,
-    0xF8, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xF8,
-    0x02, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x15, 0x6F, 0x80, 0x03, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x90, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x69, 0x55, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x7F, 0x3E, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x03, 0xF4, 0x3E, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x00,
-    0xBF, 0xAA, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x14, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0B, 0xF0, 0x40, 0x00, 0x7F, 0xC3, 0xF9, 0x6F, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x02, 0xFE, 0x55, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0x7F, 0xFD, 0x00, 0xBE,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xF4, 0x1F, 0xE0, 0xBF, 0x80, 0x03, 0xF4, 0xBF, 0x00, 0x01, 0xF8, 0xBF,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x2F,
-    0xD0, 0x07, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0x96, 0xF8, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x01,
-    0xF0, 0x07, 0xC0, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x07, 0xD0, 0x0F, 0xC0,
-    0x03, 0xF0, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x07, 0xF4, 0x02, 0xFD, 0x03, 0xF4, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x03, 0xF0,
-    0xBE, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x3F, 0x8B, 0xF4, 0x00, 0x1F, 0xD0, 0xFF, 0x80, 0x2F,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x0B, 0xC0, 0x02, 0xF8, 0x7D, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x0F, 0xDB, 0xC0, 0x00, 0x2F, 0xAF, 0x00, 0x00, 0xBF, 0x7C, 0x00, 0x01, 0xFD,
-    0xF8, 0x00, 0x0B, 0xF3, 0xF8, 0x00, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x02,
-    0xBF, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x10, 0x00,
-    0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x80, 0x6F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xC3, 0xFC, 0x3F, 0xD7, 0xFD, 0x7F, 0xE1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xDB, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0,
-    0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFE, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x15,
-    0x42, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xBF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC1, 0x50, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x01, 0xBF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xD0, 0x6F, 0xF4, 0x1E, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF9,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x0B, 0xEA, 0x00, 0x3C, 0x00, 0xFC, 0x03,
-    0xE7, 0xF0, 0x02, 0xC0, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x1D, 0x01, 0xF8, 0x0A, 0x00, 0xF0, 0x01,
-    0xD0, 0x2F, 0x40, 0xD0, 0x0B, 0x00, 0x2D, 0x02, 0xF8, 0x0D, 0x00, 0xF0, 0x03, 0xC0, 0x2F, 0xC0,
-    0xFA, 0xBF, 0x40, 0xB8, 0x02, 0xFC, 0x07, 0xFF, 0xF4, 0x3F, 0x00, 0x2F, 0xE0, 0x1F, 0xE3, 0xFF,
-    0xC0, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x55, 0xBD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x15, 0x55, 0x50, 0x00,
-    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x7F,
-    0x00, 0x00, 0xBD, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00,
-    0x1F, 0x80, 0x7F, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0xBF, 0x07, 0xF0,
-    0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00,
-    0x3F, 0xC7, 0xF0, 0x00, 0x01, 0xFF, 0x1F, 0xC0, 0x00, 0x2F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0x00, 0x06, 0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x07, 0xF0, 0x00, 0x00,
-    0xBF, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0x07, 0xF5, 0x55, 0x5B, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x05, 0x56, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
-    0x47, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xEA, 0xA9, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA, 0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x3F,
-    0xC0, 0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x53, 0xFF, 0x00, 0x00, 0x00, 0xFC,
-    0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xA5, 0x56, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x69, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF9, 0x55,
-    0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xE7, 0xFD, 0x00, 0x00,
-    0x1F, 0xF9, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0xAA, 0x4B, 0xF4,
-    0xBF, 0x4B, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F,
-    0x47, 0xF4, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xFF, 0xCF,
-    0xFC, 0xFF, 0xC0, 0x00, 0x01, 0xA9, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x10, 0x7F, 0xF0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x7F, 0xFE, 0x00,
-    0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00,
-    0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3,
-    0xFC, 0x00, 0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00,
-    0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F,
-    0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0,
-    0x02, 0xFF, 0xFC, 0x0A, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x0A, 0xA8, 0x00, 0x00, 0x02, 0xA9, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x2F, 0xEF, 0xF0, 0x00, 0xFF,
-    0xBF, 0x42, 0xFD, 0xFF, 0x80, 0x2F, 0xEB, 0xF4, 0x2F, 0xCF, 0xFC, 0x03, 0xFD, 0xBF, 0x42, 0xFC,
-    0x7F, 0xD0, 0x7F, 0xCB, 0xF8, 0x3F, 0xC3, 0xFF, 0x0F, 0xF8, 0xBF, 0x83, 0xFC, 0x2F, 0xF0, 0xFF,
-    0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0xAF, 0xF0, 0xFF, 0xC3, 0xFC, 0x0F, 0xFF, 0xFD, 0x0F, 0xFC, 0x3F,
-    0xD0, 0x7F, 0xFF, 0xC0, 0xFF, 0xC3, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xFC, 0x3F, 0xD0, 0x2F, 0xFF,
-    0x40, 0xFF, 0xC3, 0xFD, 0x00, 0xFF, 0xF0, 0x0F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC7,
-    0xFE, 0x00, 0x7F, 0xD0, 0x1F, 0xFD, 0x7F, 0xE0, 0x03, 0xFC, 0x01, 0xFF, 0xD7, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F,
-    0xFF, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F,
-    0xFF, 0x40, 0x01, 0xFD, 0x0F, 0xEF, 0xF0, 0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x7F, 0x8B, 0xF4, 0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8,
-    0x2F, 0xD0, 0x3F, 0xC2, 0xFE, 0x03, 0xFC, 0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0,
-    0x0F, 0xE0, 0xFF, 0x0F, 0xFC, 0x03, 0xFC, 0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0,
-    0x0F, 0xF7, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00,
-    0x07, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xFE, 0xAF, 0xFF,
-    0xC0, 0xBE, 0x00, 0x07, 0xFC, 0x2F, 0x80, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x0B, 0xD2, 0xF8, 0x00,
-    0x02, 0xF8, 0xFE, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x3F, 0x4F, 0xE0, 0x00, 0xBF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0xA9, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xEB, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF8, 0x00, 0x1E, 0x01, 0xFE, 0x01,
-    0xFF, 0x80, 0x0F, 0xFE, 0xFF, 0x40, 0x3F, 0xFE, 0xAB, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0xAA, 0x94, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0B, 0xD0,
-    0x1F, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x01, 0xFD, 0x02, 0xF0, 0x00,
-    0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x6F, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00,
-    0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x16, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0x50, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83,
-    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x0F,
-    0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x00, 0x01, 0xA8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0xFF, 0xD0,
-    0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
-    0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF8, 0x0F, 0xFB, 0xFC, 0x07,
-    0xF8, 0x00, 0x1F, 0xF0, 0xBF, 0xCB, 0xF8, 0x2F, 0xD0, 0x00, 0x3F, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF,
-    0x00, 0x00, 0xFF, 0x2F, 0xF4, 0x3F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0xFF, 0xC0, 0xBF, 0xEF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xFB, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0x81, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xD0, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80,
-    0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0xFF, 0x0F, 0xFF, 0xF0, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x0B, 0x00, 0x00, 0xB4, 0x00, 0x07, 0xC0,
-    0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00,
-    0x03, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0B,
-    0xC0, 0x00, 0x78, 0x00, 0x03, 0x00, 0x00, 0x10, 0xBF, 0xFD, 0x0B, 0xFF, 0xE0, 0xBF, 0xFE, 0x00,
-    0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4,
-    0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD2, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x05, 0x55, 0x40, 0x00,
-    0x28, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xE7, 0xD0, 0x0F, 0x00, 0xF4, 0x38, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A,
-    0xAA, 0xAA, 0xAA, 0xA9, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA,
-    0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C,
-    0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0,
-    0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD2, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x6F, 0xE0, 0x3F, 0xF8, 0x00,
-    0xBD, 0x0B, 0xFC, 0x00, 0x0F, 0xC2, 0xFD, 0x00, 0x02, 0xF4, 0xBF, 0x00, 0x00, 0x7D, 0x2F, 0xC0,
-    0x00, 0x1F, 0x87, 0xF0, 0x00, 0x07, 0xD1, 0xFC, 0x00, 0x03, 0xF4, 0x7F, 0x80, 0x02, 0xFC, 0x0F,
-    0xFD, 0x57, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xF4, 0x3F, 0x00, 0x3F,
-    0xFF, 0x8F, 0xC0, 0x3F, 0xFF, 0xFB, 0xE0, 0x2F, 0x90, 0x7F, 0xF8, 0x0F, 0x80, 0x03, 0xFE, 0x0F,
-    0xC0, 0x00, 0xBF, 0x83, 0xE0, 0x00, 0x1F, 0xE1, 0xF4, 0x00, 0x07, 0xF8, 0x7D, 0x00, 0x00, 0xFD,
-    0x1F, 0x40, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x2F, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFC, 0xF8, 0x00, 0x2F,
-    0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03,
-    0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x01, 0xFF, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xBF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0x6B, 0xFA, 0xA0, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC, 0x7C,
-    0x00, 0x07, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8, 0x3D,
-    0x00, 0x0F, 0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFA, 0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0E,
-    0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x02,
-    0xBF, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x4B, 0xFE, 0x00, 0x2F, 0xBF, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0xFC, 0x3F,
-    0x80, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F,
-    0x40, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x7F, 0x40, 0x00, 0xFD, 0x7F, 0x40, 0x00, 0xFD, 0x7F,
-    0x80, 0x01, 0xFD, 0xBF, 0x80, 0x01, 0xFD, 0x2F, 0x43, 0xF8, 0x3F, 0x87, 0xFC, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE0, 0x2E, 0x02, 0xF0, 0x2F,
-    0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x47, 0xF4, 0x00, 0x02,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00,
-    0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x3F, 0x1F, 0xC0,
-    0x00, 0x3F, 0x3F, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0xE0, 0x00, 0x7F, 0x0F, 0xF8,
-    0x00, 0x7F, 0x07, 0xFE, 0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xE0, 0xBF, 0x00, 0x3F,
-    0xFC, 0x05, 0x40, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0,
-    0x02, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x01, 0xFE, 0x40, 0x1B, 0xF4, 0x00, 0xBC, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0x01,
-    0xF8, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xC0, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x7C, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x2F, 0xC0, 0x00, 0x7E, 0x00,
-    0x07, 0xD2, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xD3, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0xFE, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
-    0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F,
-    0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF,
-    0xC0, 0x02, 0xFD, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F,
-    0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD,
-    0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F,
-    0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x3F, 0x2F, 0xFF, 0x80, 0x03, 0xFB, 0xFA, 0xBF,
-    0x00, 0x2F, 0xF8, 0x00, 0xF8, 0x02, 0xFF, 0x00, 0x07, 0xC0, 0x2F, 0xD0, 0x00, 0x3D, 0x02, 0xFC,
-    0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00, 0x3E, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x1F, 0xD0, 0x00, 0x3E,
-    0x02, 0xFF, 0x00, 0x07, 0xD0, 0x2F, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x07, 0xF3, 0xFF, 0xFE, 0x00, 0xBF, 0x0F, 0xFF, 0x40, 0x0B, 0xE0, 0x05, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x15, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0x00, 0x07, 0xFE,
-    0xBF, 0x7F, 0x00, 0x0F, 0xD0, 0x0F, 0xFE, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0x03,
-    0xFE, 0x00, 0x7D, 0x00, 0x02, 0xFD, 0x00, 0x7D, 0x00, 0x02, 0xFD, 0x00, 0xBC, 0x00, 0x02, 0xFC,
-    0x00, 0x7C, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x0B, 0xFC, 0x00,
-    0x2F, 0x90, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFD, 0xBC, 0x00, 0x00, 0x2F, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x90, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x86, 0xF4, 0x3E,
-    0xFF, 0xD0, 0xFF, 0xFF, 0x83, 0xFF, 0x99, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x40, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x00,
-    0xBE, 0x41, 0x50, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0xBF, 0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xBD, 0x00, 0x02, 0xF5,
-    0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00,
-    0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xE3, 0xF0, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x02, 0xF0, 0x0B, 0xE0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x40,
-    0x00, 0xBE, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x01, 0xFE,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x05, 0x00, 0x2F, 0x80,
-    0xFD, 0x01, 0xF8, 0x03, 0xF4, 0x0F, 0xE0, 0x3F, 0xD0, 0x3F, 0x00, 0xBF, 0x0F, 0xFF, 0x07, 0xF0,
-    0x07, 0xF2, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xBF, 0xFF, 0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x07, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xF4, 0x01, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0x80, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x1F,
-    0xDF, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0F, 0xF0,
-    0xFF, 0x40, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x1F, 0xF0, 0x00, 0xFF, 0x43,
-    0xFC, 0x00, 0x03, 0xFC, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD,
-    0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x2F, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xF4, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B,
-    0xF4, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x2C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xB8,
-    0xB8, 0xB4, 0xB4, 0xB4, 0xB4, 0xBF, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0xFE, 0x80, 0x00, 0x0B, 0xC0, 0x2C,
-    0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF1,
-    0xFF, 0xC7, 0xFF, 0x0F, 0xF8, 0x3F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x00,
-    0xB0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0x98,
-    0x02, 0xFC, 0xB8, 0x00, 0x3F, 0x0B, 0x40, 0x07, 0xF0, 0xB4, 0x00, 0x7E, 0x0B, 0x40, 0x07, 0xD0,
-    0xB4, 0x00, 0xBD, 0x0B, 0x40, 0x07, 0xF0, 0xB4, 0x00, 0x7F, 0x4B, 0x40, 0x03, 0xFD, 0xF4, 0x00,
-    0x2F, 0xFF, 0xA8, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xE0, 0x1B, 0xF0, 0x0F, 0xE0, 0x00, 0x08, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x1A, 0xFF, 0xAA, 0xA4, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x90, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xD0, 0x2F,
-    0xEF, 0xEB, 0xF4, 0x1F, 0xFF, 0xFF, 0xF0, 0x07, 0xF4, 0x2F, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x07, 0xD0, 0x0F, 0xC0, 0x07, 0xE0, 0x0F, 0xC0, 0x0B, 0xD0, 0x0B, 0xF4, 0x2F, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x2F, 0x05, 0x41, 0xF4, 0x08,
-    0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x01, 0x53, 0xF0, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x3F,
-    0x80, 0xBF, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x00, 0xBF,
-    0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xD4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC1, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x78, 0x78,
-    0x78, 0x78, 0xB8, 0xB8, 0xB4, 0xB4, 0xB4, 0xB4, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x18, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x07, 0xF4, 0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x3F,
-    0x07, 0xFF, 0xA6, 0xFE, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x01, 0x00, 0x0B, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x2F, 0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xFC, 0x7F, 0xC0,
-    0xBF, 0xC0, 0x01, 0xBE, 0x00, 0x0E, 0x01, 0xE0, 0x24, 0xBC, 0x24, 0x62, 0x80, 0x0C, 0x93, 0x00,
-    0x0C, 0x93, 0x00, 0x09, 0x63, 0xC0, 0x0C, 0x30, 0xFE, 0x1C, 0x28, 0x04, 0x30, 0x0B, 0x41, 0xD0,
-    0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA4, 0x0B, 0x5F, 0x80, 0xD0, 0x38, 0x1C, 0x03, 0x81,
-    0x80, 0x3C, 0x2C, 0x03, 0xC1, 0xE5, 0xFC, 0x0F, 0xFF, 0xC0, 0x2F, 0x8C, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x3C, 0x01, 0xD0, 0x03, 0xE0, 0x2F, 0x40, 0x7E, 0x02, 0xF4, 0x0B, 0xE0, 0x3F, 0x40, 0xBD,
-    0x03, 0xF0, 0x07, 0xE0, 0x3F, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x2F, 0xE0,
-    0xFF, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0xA5, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x6B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01,
-    0x40, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xBE, 0x00, 0x0E,
-    0x01, 0xE0, 0x24, 0xFD, 0x34, 0x30, 0x83, 0x0C, 0x50, 0x87, 0x0C, 0x90, 0xFD, 0x09, 0x51, 0xDA,
-    0x0C, 0x71, 0xC3, 0x0C, 0x29, 0xC3, 0x74, 0x0F, 0x82, 0xE0, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD6, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0xFD, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0xBC, 0x7E, 0x00, 0x0B, 0xC7, 0xE0,
-    0x00, 0xBC, 0x3F, 0x00, 0x0F, 0xC3, 0xFD, 0x07, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x06, 0xAA, 0xFE, 0xAA, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAA, 0xBF, 0x83, 0xFF, 0xFF, 0xFC, 0x15,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x0B, 0x00, 0x0C, 0x00, 0x30, 0x03, 0xC0, 0x2D, 0x03,
-    0xE0, 0x3E, 0x02, 0xFF, 0xDF, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x28, 0x00, 0x0C, 0x00, 0x28, 0x0F,
-    0xE0, 0x00, 0x78, 0x00, 0x2C, 0x00, 0x1C, 0x10, 0x7C, 0xBF, 0xF4, 0x7F, 0xD0, 0x01, 0x90, 0x3C,
-    0x07, 0xC0, 0xF4, 0x1F, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0xBD, 0x3F, 0x40,
-    0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0xBD, 0x7F, 0x80, 0x00, 0xFD, 0x7F, 0xC0,
-    0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFE, 0x7F, 0xE0,
-    0x03, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBB, 0xFF, 0xFF, 0xFF, 0xB6, 0xFF,
-    0xFF, 0x7F, 0xB4, 0x7F, 0xF8, 0x7F, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x7F, 0xD0, 0x3C, 0x1F, 0xFD, 0x03, 0xC3, 0xFF, 0xC0, 0x3C,
-    0x7F, 0xFC, 0x03, 0xCB, 0xFF, 0xC0, 0x3C, 0xBF, 0xFC, 0x03, 0xD7, 0xFF, 0xC0, 0x3D, 0x3F, 0xFC,
-    0x03, 0xD0, 0xFF, 0xC0, 0x3D, 0x03, 0xF8, 0x03, 0xD0, 0x3F, 0x80, 0x3D, 0x03, 0xF8, 0x03, 0xD0,
-    0x7F, 0x40, 0x3D, 0x0B, 0xF4, 0x03, 0xD0, 0xFF, 0x40, 0x3D, 0x0F, 0xF4, 0x03, 0xD0, 0xFF, 0x00,
-    0x3D, 0x1F, 0xF0, 0x02, 0xD2, 0xFF, 0x00, 0x2E, 0x3F, 0xF0, 0x02, 0xE3, 0xFF, 0x00, 0x2E, 0x3F,
-    0xF0, 0x02, 0xE7, 0xFF, 0x00, 0x2E, 0x2F, 0x83, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xC0, 0x10, 0x03,
-    0x00, 0x60, 0x0B, 0xF4, 0x00, 0xD0, 0x0D, 0x6B, 0xCF, 0xE0, 0x05, 0x00, 0xFC, 0x01, 0xB0, 0x02,
-    0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x03, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x40,
-    0x03, 0xFE, 0x03, 0x80, 0xE1, 0xC0, 0x1C, 0xB0, 0x03, 0x5C, 0x01, 0xC3, 0x95, 0xF0, 0xBF, 0xF4,
-    0x0B, 0xF4, 0x00, 0x40, 0x01, 0x00, 0x02, 0xC0, 0x0E, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x0B, 0xD0,
-    0x3F, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x07, 0xE0, 0x2F, 0x40, 0x07, 0xD0, 0x3F, 0x00, 0x7F, 0x83,
-    0xFC, 0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0x83, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0x0F, 0x80, 0xBC, 0x00,
-    0x38, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x13, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00,
-    0xAF, 0xEA, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xF0, 0x00, 0x40, 0xFF, 0xFF, 0x03, 0xC0,
-    0x02, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x2E, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x79, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0xF1, 0xD0,
-    0x00, 0x03, 0xF0, 0x03, 0xD1, 0xE0, 0x00, 0x07, 0xD0, 0x0B, 0x81, 0xE0, 0x00, 0x0F, 0x80, 0x0F,
-    0xFF, 0xFE, 0x00, 0x2F, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x03, 0xF0,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x7C,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xBF, 0xA8, 0x03, 0xD0, 0x69, 0x00, 0xFF, 0xFF, 0x02, 0xF2, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xC0, 0xF0, 0xA4, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xBD, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x95, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x2A, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0x00, 0x04, 0x03, 0xFF, 0xF8,
-    0x03, 0xC0, 0x02, 0xC0, 0x1B, 0xE9, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xED, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x79, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x0F, 0x1D, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xD1, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0xB8,
-    0x1E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x18, 0x0F, 0xF8, 0x00, 0x7E, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00,
-    0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1E, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFB,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF1,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xF8, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xB8, 0x0E,
-    0x00, 0x00, 0x00, 0x38, 0x78, 0x34, 0x00, 0x00, 0x01, 0xD0, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0x40,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00,
-    0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF3,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01,
-    0xFF, 0x55, 0x6A, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x0F, 0xFF, 0xFA, 0x55, 0xBE,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xAF, 0x40, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFE, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE5, 0x5A, 0x90, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x42, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xE4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x55, 0xA9, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0xF4, 0x07, 0xC0,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xF8, 0x01, 0xF4, 0x00, 0xBF, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x40, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x07,
-    0xF4, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x0B, 0xFC,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0x80, 0x7C,
-    0x0F, 0x41, 0xF0, 0x3F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x4B, 0xF4, 0xBF, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47,
-    0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xFC,
-    0xBF, 0xCB, 0xFC, 0xBF, 0xCF, 0xFC, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0x83, 0xE0, 0x2D, 0x00, 0xB8, 0x60, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80,
-    0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x2F, 0xD0, 0x2F, 0xD3,
-    0xFD, 0x03, 0xFD, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFF,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xF5, 0x55, 0x6B, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0xE0, 0x00, 0x00, 0x3C, 0xB0, 0x34, 0x00, 0x00, 0x1D, 0x0F, 0x1D, 0x00, 0x00, 0x07,
-    0x41, 0xFF, 0x00, 0x00, 0x01, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xC2, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xD0,
-    0x00, 0x03, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0x83, 0xFF, 0xF0,
-    0x00, 0x1F, 0xE0, 0xFF, 0xFD, 0x00, 0x07, 0xF4, 0x3F, 0xBF, 0xC0, 0x01, 0xFD, 0x0F, 0xEB, 0xF4,
-    0x00, 0xBF, 0x47, 0xF8, 0xFF, 0x00, 0x2F, 0xD1, 0xFE, 0x2F, 0xD0, 0x0B, 0xF4, 0x7F, 0x83, 0xFC,
-    0x03, 0xFC, 0x2F, 0xE0, 0xBF, 0x00, 0xFF, 0x0B, 0xF8, 0x0F, 0xE0, 0x3F, 0xC2, 0xFE, 0x02, 0xFC,
-    0x0F, 0xF0, 0xFF, 0xC0, 0x7F, 0x83, 0xFC, 0x3F, 0xF0, 0x0F, 0xF0, 0xFF, 0x0F, 0xFC, 0x01, 0xFE,
-    0x7F, 0xC3, 0xFF, 0x00, 0x3F, 0xDF, 0xF0, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0xFF,
-    0xFE, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0x87, 0xFF, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF8, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00,
-    0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0xBF, 0xFD, 0x40, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBE, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2,
-    0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0xBC, 0x0B, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x00, 0x00,
-    0x00, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC3, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF9,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xFD,
-    0x40, 0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F,
-    0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF9, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x7F,
-    0x00, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x8F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xFD, 0x40, 0x5B,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x02, 0xF8, 0xBD,
-    0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFE, 0x2F,
-    0xD0, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF8,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x2F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x5B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xBF,
-    0x43, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFE, 0x95, 0xBF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x6A, 0x87, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFE, 0x55, 0xBF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x4F,
-    0x80, 0x00, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x00, 0x0D, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02,
-    0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD,
-    0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0,
-    0x2F, 0xFE, 0x95, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00,
-    0x07, 0xF8, 0x07, 0xF8, 0x00, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x43, 0xFD, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFE, 0x95, 0xBF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x07, 0xE5, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x7E,
-    0x0B, 0xFD, 0x07, 0xD0, 0x0B, 0xF4, 0x7D, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x02,
-    0xE7, 0xD0, 0x00, 0x3E, 0x7D, 0x00, 0x0F, 0xD7, 0xD0, 0x07, 0xF8, 0x7E, 0x07, 0xFF, 0x07, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x0F, 0x80, 0x03, 0xC0, 0x2F, 0x00, 0x01, 0xD0, 0x2F,
-    0x00, 0x00, 0xE0, 0x3E, 0x00, 0x1F, 0xE0, 0x3E, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x3E,
-    0x01, 0xD0, 0x00, 0x3E, 0x01, 0xD0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x7F, 0x80, 0x3F, 0x00, 0x2F, 0xF0, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0xBD, 0x7F,
-    0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x7D, 0x7F, 0x2E, 0x56, 0xFD, 0xBF, 0x2F, 0xFF, 0xFC, 0xBF,
-    0x2F, 0xFF, 0xF0, 0xBF, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x7F, 0xAB,
-    0xFF, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x03, 0xC0,
-    0x00, 0x2F, 0x41, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0xFF, 0x07,
-    0xD0, 0x00, 0xBF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xD7, 0xD0, 0x02, 0xFF, 0x81, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C,
-    0x00, 0x1F, 0xFF, 0xEF, 0x00, 0x1F, 0xEA, 0xFF, 0xC0, 0x0F, 0xC0, 0x0B, 0xF0, 0x0B, 0xC0, 0x00,
-    0xFC, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x01, 0xF8, 0x1F, 0x00,
-    0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xC1, 0xF4, 0x00, 0x2F, 0xF0, 0x3F, 0xE5, 0xBF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5, 0xF4, 0x00, 0xBF, 0xE0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x00, 0x24, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x7C, 0x00, 0x1F, 0xFF, 0xEF, 0x00, 0x1F, 0xEA, 0xFF, 0xC0, 0x0F,
-    0xC0, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0xF0, 0x00, 0x0B, 0xD0,
-    0x7C, 0x00, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xC1, 0xF4, 0x00, 0x2F,
-    0xF0, 0x3F, 0xE5, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xF5, 0xF4, 0x00, 0xBF, 0xE0, 0x7D, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x38, 0x00, 0x0F,
-    0x2C, 0x0D, 0x00, 0x07, 0x43, 0xC7, 0x40, 0x01, 0xD0, 0x7F, 0xC0, 0x00, 0x74, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x7F, 0xAB, 0xFF,
-    0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x03, 0xC0, 0x00,
-    0x2F, 0x41, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0xFF, 0x07, 0xD0,
-    0x00, 0xBF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xD7, 0xD0, 0x02, 0xFF, 0x81, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0x3F, 0x80, 0x7F, 0x80, 0x1F, 0xF0, 0x1F, 0xF0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x7F, 0xFF, 0xBC, 0x00, 0x7F,
-    0xAB, 0xFF, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xBD, 0x03,
-    0xC0, 0x00, 0x2F, 0x41, 0xF0, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x00, 0xFF,
-    0x07, 0xD0, 0x00, 0xBF, 0xC0, 0xFF, 0x96, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xD7, 0xD0, 0x02, 0xFF, 0x81, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03,
-    0x87, 0x00, 0x00, 0x00, 0xC0, 0xD0, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02,
-    0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00,
-    0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F,
-    0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D,
-    0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFE, 0x1F,
-    0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFB, 0xEF, 0xD0, 0x2F, 0x00, 0x07, 0xFA, 0xBF, 0xFF, 0x40,
-    0x01, 0xE0, 0x03, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x3F, 0xC0, 0x05, 0x6F,
-    0x80, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x3C, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE8, 0x1F,
-    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x6F, 0xFF,
-    0xF9, 0x00, 0x09, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xF8, 0x1F, 0x4A, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F,
-    0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF,
-    0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x90, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-    0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-    0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0xB8, 0x3E, 0x00, 0x02, 0xD0, 0x07, 0x80, 0x06, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-    0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF4, 0x0B, 0xF4, 0x0F, 0xF8, 0x0F,
-    0xF4, 0x0F, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56,
-    0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x1A, 0x00, 0x00,
-    0xBD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x01, 0xE0, 0x3C, 0x07, 0xC0, 0xF8, 0x1F,
-    0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x02,
-    0xF0, 0x2E, 0x02, 0xE0, 0x2F, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0,
-    0x3F, 0x03, 0xF4, 0x7F, 0x40, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x0B,
-    0xDF, 0x80, 0x0B, 0x80, 0xB8, 0x0B, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x2F, 0xD0,
-    0x2F, 0xD3, 0xFD, 0x03, 0xFD, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0F, 0xFF, 0x03, 0xD0, 0x00, 0x0B, 0xFF, 0xFC, 0x3D, 0x00, 0x01, 0xFE, 0x02, 0xF3, 0xC0,
-    0x00, 0x3F, 0x40, 0x0B, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7D, 0x00, 0x02, 0xF8,
-    0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x80, 0x0B, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0xA0, 0x00, 0x7F, 0xC0, 0xB0, 0x00, 0xF1, 0xE0, 0xB0, 0x00, 0xE0, 0x7F, 0xE0, 0x00, 0xE0,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0,
-    0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40,
-    0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80,
-    0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0,
-    0x02, 0xFD, 0x01, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x06, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE,
-    0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00,
-    0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x03, 0x80, 0x07, 0x80, 0x05, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0,
-    0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5,
-    0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xBD, 0x01, 0xC0, 0x01, 0xFB, 0x41, 0xC0, 0x03, 0xC3, 0xC2, 0xC0, 0x03, 0xC0,
-    0xFF, 0x80, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0,
-    0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5,
-    0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xBF, 0xFC, 0x01, 0xFC, 0x0F, 0xEF, 0x80,
-    0xFC, 0x07, 0xD3, 0xF0, 0x3E, 0x02, 0xF0, 0x7D, 0x1F, 0x40, 0xFC, 0x1F, 0x8B, 0xD0, 0x3E, 0x03,
-    0xE1, 0xF4, 0x2F, 0x01, 0xF8, 0x7E, 0x0F, 0xC0, 0x7E, 0x0F, 0xC3, 0xE0, 0x3F, 0x43, 0xFF, 0xF9,
-    0xBF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD,
-    0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F,
-    0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0xBD, 0x7E, 0x00, 0x02,
-    0xF5, 0xF8, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8,
-    0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xFE, 0x2F, 0xFF, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x7F, 0x01, 0xFF, 0xE1, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xE0, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0xBD, 0x7E,
-    0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xFE, 0x3F, 0x00,
-    0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x7F, 0x01, 0xFF, 0xE1, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x7F, 0x40, 0x7F, 0x02, 0xFD, 0x02, 0xFD, 0x0B,
-    0xF8, 0x0F, 0xF8, 0x2F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x80, 0x00,
-    0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE,
-    0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0,
-    0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F,
-    0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0xBC, 0x2F, 0xE0, 0x2F, 0x00, 0xBE, 0x0B, 0xC0,
-    0x0B, 0xD1, 0xF0, 0x00, 0xB8, 0x7C, 0x00, 0x0F, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x01, 0xF1, 0xF0,
-    0x00, 0xB8, 0x7C, 0x00, 0x7D, 0x1F, 0x00, 0x3F, 0x07, 0xC0, 0x3F, 0x41, 0xF4, 0xBF, 0x80, 0x7F,
-    0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x02, 0xF4, 0x03, 0xF8, 0x03, 0xF4, 0x03, 0xF8, 0x07, 0xF8, 0x07, 0xFC, 0x0B, 0xFC,
-    0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC,
-    0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0,
-    0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x47,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x3F,
-    0x40, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0xAF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0xBC,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD, 0x07, 0xC0, 0x00, 0x1F, 0x81,
-    0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02, 0xFF, 0x03, 0xFE, 0x5B, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x5F, 0x40, 0x0B, 0xFE,
-    0x07, 0xD0, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xD0,
-    0xBF, 0x80, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03,
-    0xFD, 0x03, 0xC0, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0,
-    0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B,
-    0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00,
-    0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB,
-    0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00,
-    0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0,
-    0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA,
-    0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00,
-    0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0x5F, 0x40, 0x07, 0x80,
-    0x2D, 0x01, 0xD0, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0F, 0xFA, 0x68, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF9, 0x58, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0x55, 0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
-    0x40, 0x00, 0x0B, 0x40, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55,
-    0x68, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x07, 0x40, 0x3C, 0x02, 0xD0, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFA, 0x68, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF9, 0x58, 0x00,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00,
-    0x02, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFA,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xF4, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F,
-    0x00, 0x00, 0x07, 0xFF, 0xC1, 0xFD, 0x55, 0x56, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x1F, 0xF4, 0x3F, 0x00, 0x00, 0x0F,
-    0xFF, 0xE3, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0xBE, 0x41, 0xFF, 0xE0, 0x00, 0x0F,
-    0x80, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3E, 0x00, 0x01, 0xFE, 0x00, 0x07,
-    0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x7F, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xE0,
-    0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xF5, 0x55, 0x6B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0x8F, 0xC0, 0x00, 0x3F, 0xFF, 0xFB, 0xE0, 0x00, 0x2F,
-    0x90, 0x7F, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0x03, 0xE0,
-    0x00, 0x1F, 0xE0, 0x01, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0x40,
-    0x00, 0x7F, 0x40, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFC, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0xAF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x40, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE5, 0x5A, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00,
-    0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x03, 0xC0,
-    0x00, 0x74, 0x00, 0xB4, 0x00, 0x2C, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x95, 0x6A, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x06, 0x40, 0x00, 0xA0, 0x07, 0x80, 0x00, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03,
-    0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x42, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xE4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x55, 0xA9, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x01, 0x55,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x90, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x56, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0,
-    0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9,
-    0x7D, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xB8, 0x00,
-    0x02, 0xD0, 0x00, 0xB0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x95, 0x6A, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0xF4, 0x0F,
-    0x40, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56,
-    0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x0F, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA,
-    0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF,
-    0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0x53, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF,
-    0xA5, 0x56, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0xF8, 0x3E, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x05, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC, 0x7C, 0x00, 0x07,
-    0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0F,
-    0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFA,
-    0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0E, 0x00, 0xBF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xE0,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6B, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0xAB,
-    0xF4, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x09, 0x50, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xFF,
-    0xE5, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE3, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0xCF, 0xF4, 0x00, 0x00,
-    0x03, 0xF5, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0x01, 0xFF, 0xFA,
-    0x55, 0x6B, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x0B, 0x40, 0x00, 0xE0, 0x07, 0x40, 0x01, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC,
-    0x7C, 0x00, 0x07, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8,
-    0x3D, 0x00, 0x0F, 0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFA, 0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x0E, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00,
-    0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA, 0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x5F, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xC0,
-    0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x53, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xA5, 0x56, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68,
-    0x03, 0xFF, 0xF8, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC,
-    0x3D, 0x00, 0x0B, 0xFC, 0x7C, 0x00, 0x07, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8,
-    0x7C, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0F, 0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFA, 0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x0E, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xEA, 0xBF, 0x40, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x95, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x5F, 0xF0,
-    0x00, 0x07, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x6F, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x53,
-    0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xA5, 0x56, 0xBF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x68, 0x03, 0xFF, 0xF8, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0x80, 0x7F, 0xFC, 0x3E, 0x00, 0x1F, 0xFC, 0x3D, 0x00, 0x0B, 0xFC, 0x7C, 0x00, 0x07,
-    0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x03, 0xF8, 0x7C, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0F,
-    0xF8, 0x3F, 0xEA, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFA,
-    0xF4, 0x00, 0x7F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0E, 0x00, 0xBF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x69,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x03, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F,
-    0xF9, 0x55, 0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xE7, 0xFD,
-    0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0xBC,
-    0x00, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xFE, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x00, 0xFF,
-    0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00,
-    0xBC, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x7F, 0x40, 0x00, 0xFD, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0x1F, 0xD0, 0x2F, 0xE0,
-    0x00, 0x7F, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2B,
-    0xFE, 0xAA, 0xAA, 0xAF, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x07,
-    0xFE, 0x55, 0x55, 0x6F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x1F,
-    0xF8, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0xBF, 0xE0, 0x00, 0x0B, 0xEF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE0, 0x1F,
-    0xD0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00,
-    0xFD, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x3F,
-    0x40, 0x7F, 0x80, 0x01, 0xFD, 0x02, 0xFE, 0x00, 0x07, 0xF4, 0x05, 0x00, 0x60, 0xFF, 0x01, 0xCB,
-    0x4E, 0x07, 0x3C, 0x1D, 0x3C, 0xF0, 0x2F, 0xE1, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xF4,
-    0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07,
-    0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x38,
-    0xFB, 0xC0, 0xE3, 0x83, 0xC3, 0x5D, 0x07, 0xFC, 0x74, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0x41, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xD1, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x03, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0A, 0xA0, 0x7F, 0xC0, 0xFE, 0x03,
-    0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x7F,
-    0xD1, 0xFF, 0x47, 0xFE, 0x2F, 0xF8, 0x2C, 0x01, 0xD0, 0x0E, 0x00, 0x38, 0x00, 0xBF, 0xC0, 0x6F,
-    0x00, 0x0B, 0xD0, 0x3F, 0x80, 0xFE, 0x07, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2E, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x7F, 0x41, 0xD0,
-    0x0E, 0x00, 0xB0, 0x03, 0xC0, 0x07, 0xFC, 0x02, 0xF4, 0x1F, 0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF4,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x2F, 0xD0,
-    0xBF, 0x42, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41, 0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x41,
-    0xFD, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x81, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0xC2, 0xFF, 0x0B,
-    0xFC, 0x2F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x00, 0x0B, 0xC2, 0xF0, 0xBC, 0x2E, 0x0B, 0x82,
-    0xF0, 0xBC, 0x2F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFD, 0x7F, 0x40, 0xAA, 0x40,
-    0x00, 0x2A, 0x8B, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00,
-    0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xC7,
-    0xF4, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0x87, 0xF4, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00,
-    0x7F, 0x87, 0xF8, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x07, 0xF4, 0x7F,
-    0xC0, 0x00, 0x7F, 0x4B, 0xFC, 0x00, 0x07, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x4B, 0xFC, 0x00, 0x0B,
-    0xF4, 0xFF, 0xC0, 0x00, 0xBF, 0x0F, 0xFC, 0x00, 0x0B, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x47, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x2F,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xE0, 0xB8, 0x02, 0xD0, 0x07, 0x81, 0x80, 0x1A, 0xB4,
-    0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x10, 0x7F, 0xF0, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFE,
-    0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0xB8, 0x07, 0xC0, 0x0B, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0,
-    0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC1, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0xE0, 0x00, 0x7F, 0x0F, 0xF8, 0x00, 0x7F,
-    0x07, 0xFE, 0x00, 0x7F, 0x02, 0xFF, 0x80, 0x7F, 0x00, 0xFF, 0xE0, 0xBF, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x05, 0x00, 0x50, 0x07, 0xC0, 0xF8, 0x01, 0xF0, 0xBC, 0x00, 0x7C, 0x3D, 0x00,
-    0x2E, 0x3F, 0x00, 0x0B, 0x9F, 0x40, 0x02, 0xEF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xF7, 0xFC, 0x00, 0x3D, 0x3F, 0xC0, 0x1F, 0x47, 0xF8,
-    0x07, 0xC0, 0xBF, 0x81, 0xF0, 0x0F, 0xF8, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x2F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00,
-    0x1F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x03, 0xF4, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x0B, 0xFF, 0xC0,
-    0x0A, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x05, 0x40, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x01, 0xF4,
-    0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x2F, 0xE0,
-    0x0B, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x0A, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC0, 0x01, 0xF0, 0x2F, 0xC0, 0x02, 0xF0, 0x2F, 0xC0, 0x02, 0xE0, 0x2F, 0xC0, 0x03,
-    0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3E,
-    0x07, 0xC0, 0x3D, 0x0B, 0xC0, 0x3D, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x7D, 0x0F, 0xC0, 0x7D, 0x0F,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40,
-    0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xF0,
-    0x2F, 0xC0, 0x03, 0xF4, 0x2F, 0xC0, 0x07, 0xF8, 0x2F, 0xC0, 0x0B, 0xF8, 0x2F, 0xC0, 0x0F, 0xFC,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x03, 0xF0, 0x7E, 0x01, 0xFC, 0x1F, 0x80, 0xBF, 0x47, 0xD0, 0x3F, 0xD1, 0xF4, 0x0F, 0xF8,
-    0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xEA, 0xAF, 0xFF, 0x00, 0x00,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x09, 0x00, 0x00, 0x02,
-    0xFA, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x4F, 0xD0, 0x00, 0x7F, 0xD0, 0x3F, 0x40, 0x00, 0x14,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0x83,
-    0xFF, 0x80, 0x00, 0x0F, 0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x0F,
-    0xFF, 0xC0, 0x00, 0x7F, 0x83, 0xFF, 0xF8, 0x00, 0x1F, 0xD0, 0xFE, 0xFF, 0x00, 0x07, 0xF4, 0x3F,
-    0xAF, 0xD0, 0x02, 0xFD, 0x1F, 0xE3, 0xFC, 0x00, 0xBF, 0x47, 0xF8, 0xBF, 0x40, 0x2F, 0xD1, 0xFE,
-    0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x82, 0xFD, 0x03, 0xFC, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x0B, 0xF8,
-    0x0B, 0xF4, 0x3F, 0xC3, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0xFF, 0xC0, 0x2F, 0xC3, 0xFC, 0x3F, 0xF0,
-    0x07, 0xF9, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x7F, 0xC3, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x7F, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F,
-    0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF,
-    0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xC0,
-    0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0xE0,
-    0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x01, 0xFD, 0x0F, 0xEF, 0xF0,
-    0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE, 0x3F, 0xC0, 0x0B, 0xF4, 0x7F, 0x8B, 0xF4,
-    0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8, 0x2F, 0xD0, 0x3F, 0xC2, 0xFE, 0x03, 0xFC,
-    0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF, 0x0F, 0xFC, 0x03, 0xFC,
-    0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF7, 0xFC, 0x3F, 0xF0, 0x01, 0xFF,
-    0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00, 0x07, 0xFF, 0xE1, 0xFF, 0xC0, 0x00, 0xFF,
-    0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F,
-    0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F,
-    0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01,
-    0xE0, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA8, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xC2, 0xFF, 0x80, 0x00, 0x0F,
-    0xE0, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
-    0x83, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0xFE, 0xFF, 0x00, 0x07, 0xF4, 0x3F, 0xAF, 0xD0, 0x02, 0xFD,
-    0x1F, 0xE3, 0xFC, 0x00, 0xBF, 0x47, 0xF8, 0xBF, 0x40, 0x2F, 0xD1, 0xFE, 0x0F, 0xF0, 0x0F, 0xF0,
-    0xBF, 0x82, 0xFD, 0x03, 0xFC, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x0B, 0xF8, 0x0B, 0xF4, 0x3F, 0xC3,
-    0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0xFF, 0xC0, 0x3F, 0xC3, 0xFC, 0x3F, 0xF0, 0x07, 0xF9, 0xFF, 0x0F,
-    0xFC, 0x00, 0xFF, 0x7F, 0xC3, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x7F,
-    0xF0, 0x00, 0x7F, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x01,
-    0x80, 0x00, 0x20, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F,
-    0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F,
-    0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F,
-    0x40, 0x01, 0xFC, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F,
-    0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2E, 0x2F, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xF4, 0x0F, 0xD0, 0x3F, 0xC0, 0x03, 0xF0, 0x3F, 0x80, 0x02, 0xF0, 0x3F, 0x40, 0x02, 0xF4, 0x3F,
-    0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF8, 0x7F,
-    0x40, 0x02, 0xFC, 0x7F, 0x40, 0x02, 0xFC, 0x7F, 0x40, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0xBF,
-    0x80, 0x03, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xFE, 0x00, 0x00,
-    0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0x00, 0x00,
-    0x3F, 0x83, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x01,
-    0xFD, 0x0F, 0xEF, 0xF0, 0x00, 0x7F, 0x43, 0xFA, 0xFD, 0x00, 0x2F, 0xD1, 0xFE, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x7F, 0x8B, 0xF4, 0x02, 0xFD, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x0B, 0xF8, 0x2F, 0xD0, 0x3F,
-    0xC2, 0xFE, 0x03, 0xFC, 0x0F, 0xF0, 0xBF, 0x80, 0xBF, 0x43, 0xFC, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF,
-    0x0F, 0xFC, 0x03, 0xFC, 0x3F, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xF0, 0xFF, 0xC0, 0x0F, 0xF7, 0xFC,
-    0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0x00, 0x07, 0xFF, 0xE1,
-    0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4, 0x3F, 0x40, 0x01,
-    0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x40, 0x02,
-    0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02,
-    0xFC, 0x7F, 0x80, 0x02, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFE, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
-    0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE3,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF, 0x50, 0x16, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x0A, 0xAA, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00,
-    0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00,
-    0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x2D, 0x00, 0x07, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFE, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0,
-    0x00, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xFF,
-    0x50, 0x16, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xA0,
-    0x07, 0x40, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4,
-    0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x3E,
-    0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x50, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xFF, 0x50, 0x16,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x0B, 0x80, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x15, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0xBF, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0xA5, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xC3, 0xF9, 0x02, 0xE0, 0x0B, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0xF4, 0x1F, 0xC0, 0x02, 0xFF,
-    0x40, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x16, 0xBD, 0x3E, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xEA, 0xBD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0xFF, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF8, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0xA9, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x07,
-    0xF8, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0xBD, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x1F,
-    0x00, 0x00, 0xBE, 0x01, 0xF0, 0x00, 0x1F, 0xD0, 0x2F, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFE,
-    0x56, 0xFF, 0x80, 0x3F, 0xC0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0xFF,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0F, 0xF8, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x0F, 0xFE,
-    0x00, 0x19, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1B, 0xD0, 0xFB, 0xFF, 0x43, 0xFF,
-    0xFE, 0x0F, 0xFE, 0x64, 0x7F, 0xC0, 0x01, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x1F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x0A, 0xAA, 0x94, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x0B, 0xD0,
-    0x1F, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x01, 0xFD, 0x02, 0xF0, 0x00,
-    0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x6F, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00,
-    0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x3F,
-    0xD0, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xBD, 0x03, 0xEF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF,
-    0x99, 0x07, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x1F,
-    0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA9, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x07, 0xF8, 0x00, 0xF0, 0x00, 0x0F,
-    0xC0, 0x1F, 0x00, 0x00, 0xBD, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0xBE, 0x01, 0xF0,
-    0x00, 0x1F, 0xD0, 0x2F, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x56, 0xFF, 0x80, 0x3F, 0xC0,
-    0x02, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xF0,
-    0x3F, 0xD0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xD7, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x07, 0x80, 0xB8, 0x0B, 0x80, 0x0B, 0xDF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1B, 0xD0, 0x0F, 0xBF, 0xF4, 0x03,
-    0xFF, 0xFE, 0x00, 0xFF, 0xE6, 0x40, 0x7F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95,
-    0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x14, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0xBF, 0xEA, 0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0xFF, 0xFF, 0xD0, 0x0B, 0xE4, 0x15, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x0E, 0x40, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x90, 0x01, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x40, 0x00, 0x03, 0xFF,
-    0xF0, 0x0B, 0xFE, 0xAA, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x2C, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0xBE,
-    0x41, 0x50, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x01,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x16, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x50, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x10, 0x00, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0xBE, 0x41, 0x50, 0x03, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3E, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x14, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0xBF, 0xEA,
-    0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x0F, 0x40, 0x3C, 0x00, 0x0B, 0x8B,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xE4, 0x15, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x0E, 0x40, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80,
-    0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x55, 0x0F, 0xD0, 0x05, 0x50,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x1E, 0x07, 0xD0,
-    0x07, 0xE0, 0x7C, 0x00, 0x7E, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA9, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0x40, 0x0C, 0x00, 0x00, 0x03, 0xFC, 0x03,
-    0x40, 0x00, 0x01, 0xE3, 0xC0, 0xD0, 0x00, 0x00, 0xB0, 0x38, 0xB0, 0x00, 0x00, 0x2C, 0x07, 0xFC,
-    0x00, 0x00, 0x04, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x2A,
-    0xA1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x43,
-    0xFC, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x0B,
-    0xFF, 0x95, 0x6F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07, 0x00, 0x1F, 0xB4, 0x1C, 0x00, 0xB0, 0xB0, 0x70, 0x02,
-    0xC0, 0xFB, 0xC0, 0x0F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F, 0x5F, 0x40, 0x00,
-    0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xFE,
-    0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x03, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x7F, 0x01, 0xFF,
-    0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC3,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F,
-    0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF,
-    0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6B, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFE, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xE0,
-    0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x3E, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00,
-    0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xF7, 0xF0, 0x1F, 0xFE, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0,
-    0x07, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x01, 0xFF,
-    0x02, 0xFF, 0xE9, 0x5B, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x0E, 0x00, 0xF8, 0x01,
-    0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x5F,
-    0x40, 0x00, 0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x4F, 0x80,
-    0x00, 0xFD, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00,
-    0xFE, 0x3F, 0x80, 0x0F, 0xF8, 0xBF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFD, 0xFC, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x03, 0x40,
-    0x00, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F,
-    0xC0, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0xBF,
-    0xF9, 0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xD2, 0x80, 0x00, 0x0B, 0x03, 0x00, 0x00,
-    0x28, 0x0C, 0x00, 0x00, 0xB0, 0x70, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0xBD, 0x7D, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD,
-    0x3E, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0xFE, 0x3F,
-    0x00, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF7, 0xF0, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x07,
-    0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x00, 0x02,
-    0xFD, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xE9, 0x5B,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x06, 0x90, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x1A, 0x50, 0x00, 0x1A, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x1F, 0x40, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00,
-    0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x07, 0xFF, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00,
-    0xBF, 0xC7, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0xFF,
-    0x42, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xFA, 0x56, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF5, 0xF4, 0x00, 0x0B, 0xD7, 0xD0, 0x00, 0x2F,
-    0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x3F, 0x8F,
-    0xC0, 0x00, 0xFE, 0x3F, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0xFF, 0x8B, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xDF, 0xC0, 0x7F, 0xF8,
-    0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x40, 0x07, 0xF8, 0x00,
-    0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F,
-    0xF4, 0x0B, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x3F, 0xEF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F,
-    0xC2, 0xFF, 0x2F, 0xE0, 0xBF, 0x40, 0x00, 0xFF, 0x0F, 0xF8, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFC,
-    0xBF, 0xD0, 0xFF, 0x9F, 0xF0, 0x00, 0x0B, 0xFB, 0xFF, 0x02, 0xFF, 0xBF, 0x80, 0x00, 0x1F, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x1F, 0xC0, 0x05, 0x00, 0x2F, 0x80, 0xFD, 0x01, 0xF8, 0x03, 0xF4, 0x0F, 0xE0, 0x3F, 0xD0,
-    0x3F, 0x00, 0xBF, 0x0F, 0xFF, 0x07, 0xF0, 0x07, 0xF2, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xBF, 0xFF,
-    0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0xC0, 0x01, 0xFF, 0xF4,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xF4,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x0F, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xD0, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF3, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x03,
-    0x80, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F,
-    0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01,
-    0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00,
-    0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x0F,
-    0xD0, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x02, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x40, 0x7F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xCF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x19, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1F,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x02, 0xD0, 0x00, 0xB8, 0x0F, 0x40, 0x00, 0x2F, 0xBD, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFF, 0xC0,
-    0xFD, 0x08, 0x1F, 0x80, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF4, 0x00, 0x7F,
-    0x40, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x01,
-    0x40, 0x01, 0x90, 0x3C, 0x07, 0xC0, 0xF4, 0x1F, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0xBF, 0x00,
-    0x01, 0xFF, 0x80, 0x07, 0xC3, 0xE0, 0x1E, 0x00, 0x78, 0x24, 0x00, 0x09, 0x0B, 0xC0, 0x2C, 0xBB,
-    0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x42, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xAF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x0E, 0x78, 0x00, 0x1D, 0x3D, 0x00, 0x7C, 0x2F, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x00, 0xA9, 0x00,
-    0x2F, 0x83, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0xC0, 0x1F, 0x40, 0x2F, 0x43, 0xF8, 0x03, 0xF8, 0x3F,
-    0xC0, 0x3F, 0xC3, 0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0xBF, 0xC0, 0x2F, 0xE0, 0x81, 0xE0, 0x03, 0x80,
-    0x78, 0x03, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0xB0, 0xD3, 0x41, 0xCE, 0x0B, 0x1F, 0xF4, 0x1A, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0x02, 0xF8,
-    0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x38, 0x00, 0x1D, 0x0F,
-    0x00, 0xF4, 0x03, 0xE7, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x28, 0x00, 0x14, 0x00,
-    0x00, 0x14, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x6B, 0x40, 0x00, 0x6B, 0x40, 0xBF, 0xD1, 0xFF, 0x43, 0xFD, 0x0F,
-    0xF8, 0x2F, 0xE0, 0x7F, 0xC0, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x47,
-    0xFD, 0x0F, 0xF4, 0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x02, 0x40, 0xE5, 0x7A,
-    0xFE, 0x03, 0x80, 0xE0, 0x00, 0x60, 0x2C, 0x0B, 0x56, 0xFE, 0xB0, 0x2C, 0x00, 0x00, 0xBE, 0xA5,
-    0x50, 0xBF, 0xFF, 0xFD, 0x05, 0x55, 0xBD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3E, 0x0E, 0x0A, 0x0E, 0x1D, 0xB8, 0x60, 0x1D, 0xCA, 0x28, 0x3C, 0x10, 0x06, 0x00,
-    0x1C, 0x00, 0x70, 0x2F, 0xFC, 0x6A, 0xA0, 0xBF, 0xF1, 0xBE, 0x80, 0x70, 0x01, 0xC0, 0x01, 0x00,
-    0x00, 0x00, 0x60, 0x06, 0x0B, 0xFE, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xF8, 0x3F, 0xC3, 0xFC, 0x7F,
-    0xC0, 0x2F, 0x80, 0x2F, 0x83, 0xFC, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC7, 0xFC, 0x07, 0xFC, 0x7F,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xD0, 0xB0, 0xD3, 0x41, 0xCE, 0x0B, 0x1F, 0xF4, 0x1A, 0x40, 0x00, 0x00,
-    0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x00, 0x00, 0x10, 0x03, 0x00, 0x60, 0x0B, 0xF4, 0x00, 0xD0, 0x0D, 0x6B, 0xCF, 0xE0, 0x02, 0x40,
-    0xE0, 0x3C, 0x07, 0x00, 0xB0, 0x07, 0xFD, 0x0B, 0xE0, 0x00, 0x3C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC,
-    0xBC, 0xA8, 0xAA, 0xAA, 0x6F, 0xFF, 0xEB, 0x40, 0x7A, 0xD0, 0x1E, 0xA4, 0x06, 0x40, 0x24, 0x00,
-    0x09, 0x1E, 0x00, 0x78, 0x07, 0xC3, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xDB, 0xC0, 0x07, 0x80, 0x7C,
-    0x0B, 0x40, 0x02, 0xC0, 0x0B, 0xC0, 0x2C, 0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD6, 0xAA, 0xA5, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x2C, 0xBB, 0xC0, 0xB3,
-    0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0xA0, 0xA0, 0xCB, 0xB5, 0x40, 0x50, 0x01, 0x6D, 0x01, 0xEB,
-    0x40, 0x7A, 0xFA, 0xBE, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xCA, 0x00, 0x32, 0x80, 0x0C,
-    0xA0, 0x03, 0x28, 0x00, 0xCB, 0xFF, 0xF0, 0x55, 0x54, 0x2E, 0x09, 0x1C, 0x38, 0xC6, 0x0C, 0x25,
-    0x83, 0x0A, 0xA0, 0xC2, 0x80, 0x10, 0x50, 0x24, 0x50, 0x77, 0x00, 0xB0, 0x03, 0xD0, 0x29, 0xC2,
-    0xC2, 0xC0, 0x0B, 0xC0, 0x2C, 0xBB, 0xC0, 0xB3, 0xC3, 0xC3, 0x8E, 0x07, 0xFD, 0x38, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0xA0, 0xBC, 0x0D, 0x1C, 0x50, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC,
-    0x07, 0xFC, 0x7F, 0xC0, 0xBF, 0xC0, 0xAA, 0xAA, 0x6F, 0xFF, 0xEB, 0x40, 0x7A, 0xD0, 0x1E, 0xA4,
-    0x06, 0x40, 0x00, 0x00, 0x01, 0x02, 0xBF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC1, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x2F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF5, 0xF0, 0x03, 0xD7, 0xC0,
-    0x1F, 0x5F, 0x00, 0x7D, 0xBC, 0x01, 0xF6, 0xF0, 0x0B, 0xDB, 0xC0, 0x2F, 0x6A, 0x00, 0x69, 0x65,
-    0x54, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x02, 0xA0, 0x00,
-    0x00, 0x50, 0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xA0, 0x00, 0x03, 0x40, 0x2F, 0x1C, 0xB2,
-    0xEF, 0xA2, 0xCF, 0x0F, 0x4E, 0x38, 0x1F, 0xF4, 0xE0, 0xBF, 0x80, 0x03, 0x80, 0x00, 0x0D, 0x00,
-    0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0xFD, 0x0F, 0xFA, 0xBF, 0x40, 0x00, 0xFD, 0x3F,
-    0xC0, 0x0F, 0xF4, 0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFF, 0xAF, 0xF8, 0x7F, 0x80, 0x00, 0x1B, 0xFF,
-    0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x01, 0x42, 0xFA, 0xF4, 0x00, 0xF0, 0xF8, 0x0F, 0x40, 0x7C, 0x7D, 0x01, 0xF4, 0x3E, 0x2F, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x03, 0xC3, 0xF0, 0xBC, 0x01, 0xF0, 0xF4, 0x0B, 0xC0, 0xBC, 0x7D, 0x00, 0xBE, 0xFD,
-    0x16, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x40, 0x00, 0xBF, 0x07, 0x00, 0x00, 0x14, 0x3F, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x18, 0x14, 0x50, 0x00, 0x00, 0x00, 0x00, 0x08, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xF9, 0x00, 0x01, 0x7E, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFE,
-    0x90, 0x00, 0x01, 0xF9, 0x40, 0x01, 0xBE, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xF9, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xF4, 0xBC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF9,
-    0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0xF4, 0x03, 0xE0, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xF2, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0xBF, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xAF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x02, 0xFE, 0x41, 0xBF, 0x40, 0x0B,
-    0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x3F, 0x00,
-    0x00, 0x00, 0xA4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x06, 0xA9,
-    0x7F, 0xFE, 0x9A, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x50, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x10, 0x00, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xAA, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x4B, 0xF4, 0xBF, 0x4B, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47,
-    0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC,
-    0xFF, 0xCF, 0xFC, 0xFF, 0xC0, 0x2F, 0x80, 0x3F, 0x43, 0xF8, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC7,
-    0xFC, 0x07, 0xFC, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF4, 0x00,
-    0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x10, 0x7F,
-    0xF0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x7F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x02, 0xF8, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x01, 0xF0,
-    0x00, 0x07, 0xD0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x0B,
-    0xD0, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x0B, 0xD0, 0x01,
-    0xFE, 0x03, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x07, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x25, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0x00,
-    0x00, 0x0F, 0xC0, 0x07, 0xF4, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xD7, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3E,
-    0x7C, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF9, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xD7, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x7C, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x81, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xA0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x6A, 0x54, 0x3F, 0x80, 0x55,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x8B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBC, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFD, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x0F,
-    0xE0, 0xFF, 0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xEB,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00,
-    0x3F, 0xC1, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x7F,
-    0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xC1, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0x80, 0x00,
-    0x2F, 0xFC, 0x0F, 0xE0, 0x00, 0x0F, 0xFF, 0x43, 0xF8, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0x00, 0x03,
-    0xFF, 0xF4, 0x3F, 0xC0, 0x02, 0xFE, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x7F, 0x83, 0xFC, 0x00, 0x7F,
-    0x9F, 0xE0, 0xFF, 0x00, 0x3F, 0xC7, 0xFC, 0x3F, 0xC0, 0x1F, 0xE1, 0xFF, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x7F, 0xC2, 0xFD, 0x07, 0xF8, 0x1F, 0xF0, 0xBF, 0x43, 0xFC, 0x07, 0xFC, 0x2F, 0xD1, 0xFE, 0x01,
-    0xFF, 0x0B, 0xF8, 0xFF, 0x00, 0x7F, 0xD2, 0xFE, 0x7F, 0x80, 0x1F, 0xF4, 0x7F, 0xBF, 0xC0, 0x07,
-    0xFD, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0x87, 0xFF, 0xF4, 0x00, 0x7F, 0xE1, 0xFF, 0xFC, 0x00, 0x1F,
-    0xF8, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x02, 0x40, 0x00, 0xA0,
-    0x03, 0xC0, 0x00, 0xF0, 0x03, 0xD0, 0x02, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC,
-    0x1F, 0x80, 0x01, 0xF8, 0x0F, 0xD0, 0x02, 0xF8, 0x07, 0xF0, 0x03, 0xF4, 0x03, 0xF8, 0x03, 0xF0,
-    0x01, 0xFC, 0x0B, 0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x7F, 0x4F, 0xD0, 0x00, 0x3F, 0xDF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x15, 0x2F, 0x40, 0x00, 0x0B, 0xDB, 0xD0, 0x00, 0x02,
-    0xF6, 0xF4, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x2F, 0x6F, 0x40, 0x00, 0x0B, 0xDB, 0xD0, 0x00,
-    0x02, 0xF6, 0xF4, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x2F, 0x6F, 0x40, 0x00, 0x0B, 0xDB, 0xD0,
-    0x00, 0x02, 0xF6, 0xF4, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x2F, 0x6F, 0x40, 0x00, 0x0B, 0xDB,
-    0xD0, 0x00, 0x02, 0xF6, 0xF4, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x2F, 0x6F, 0x40, 0x00, 0x0B,
-    0xDB, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00,
-    0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x0B,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xCB, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE8, 0x01, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0xBD,
-    0x0F, 0xC0, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x0F, 0x8F,
-    0xC0, 0x00, 0x7E, 0x3F, 0x40, 0x1B, 0xF4, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0xBC, 0x00,
-    0x1F, 0xC0, 0xBC, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x01, 0xF0, 0xBC, 0x00,
-    0x02, 0xE0, 0xBC, 0x00, 0x03, 0xD0, 0xBD, 0x55, 0x6F, 0x80, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0xBC, 0x00, 0x0B, 0xF4, 0xBC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xBD, 0xBC, 0x00,
-    0x00, 0xFE, 0xBC, 0x00, 0x00, 0xFE, 0xBD, 0x00, 0x5B, 0xFE, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF9, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFA, 0xAA, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0xBD, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0x02,
-    0xF8, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x3E, 0x00, 0x0B,
-    0xE0, 0x00, 0x1F, 0x40, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x42, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x55, 0x55, 0x55, 0x52, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xF4, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x4B, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x03, 0xFD,
-    0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8,
-    0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x82, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xDF,
-    0xF7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x7F, 0xFC, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0x03, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0xFF, 0xFD, 0x03, 0xFF, 0xF8,
-    0x06, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFA, 0xAF, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x01, 0x55,
-    0xBF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBD, 0x40, 0x00, 0x07, 0xF2,
-    0xE0, 0x00, 0xBF, 0xCB, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00,
-    0x00, 0xBF, 0xC1, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0x2F, 0xFC, 0x0F, 0xE0, 0x00,
-    0x0F, 0xFF, 0x43, 0xF8, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xC0, 0x02,
-    0xFE, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x7F, 0x83, 0xFC, 0x00, 0x7F, 0x9F, 0xE0, 0xFF, 0x00, 0x3F,
-    0xC7, 0xFC, 0x3F, 0xC0, 0x1F, 0xE1, 0xFF, 0x0F, 0xF4, 0x0F, 0xF0, 0x7F, 0xC2, 0xFD, 0x07, 0xF8,
-    0x1F, 0xF0, 0xBF, 0x43, 0xFC, 0x07, 0xFC, 0x2F, 0xD1, 0xFE, 0x01, 0xFF, 0x0B, 0xF8, 0xFF, 0x00,
-    0x7F, 0xD2, 0xFE, 0x7F, 0x80, 0x1F, 0xF4, 0x7F, 0xBF, 0xC0, 0x07, 0xFD, 0x1F, 0xFF, 0xE0, 0x01,
-    0xFF, 0x87, 0xFF, 0xF4, 0x00, 0x7F, 0xE1, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x3F, 0xFD, 0x00, 0x07,
-    0xFF, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0x80, 0x00, 0x24, 0x00, 0x00, 0x74, 0x00, 0x1D,
-    0x00, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x0B, 0xFC, 0x1F, 0xD0, 0x00, 0x03, 0xFF,
-    0x03, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x3F, 0x80, 0x00, 0xBF, 0xFD,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x43, 0xFC, 0x00, 0x2F, 0xEF, 0xE0, 0xFF, 0x00, 0x0F, 0xF7, 0xF8,
-    0x3F, 0xC0, 0x0B, 0xF5, 0xFE, 0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xC3, 0xFC, 0x01, 0xFE, 0x1F, 0xF0,
-    0xFF, 0x40, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0x7F, 0x81, 0xFF, 0x0B, 0xF4, 0x3F, 0xC0, 0x7F, 0xC2,
-    0xFD, 0x1F, 0xE0, 0x1F, 0xF0, 0xBF, 0x8F, 0xF0, 0x07, 0xFD, 0x2F, 0xE7, 0xF8, 0x01, 0xFF, 0x47,
-    0xFB, 0xFC, 0x00, 0x7F, 0xD1, 0xFF, 0xFE, 0x00, 0x1F, 0xF8, 0x7F, 0xFF, 0x40, 0x07, 0xFE, 0x1F,
-    0xFF, 0xC0, 0x01, 0xFF, 0x83, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x07,
-    0xF0, 0x01, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF,
-    0x40, 0x00, 0x0F, 0xE1, 0xFE, 0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xEB, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xC1,
-    0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0, 0x0F,
-    0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x7F, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0xBF, 0x00,
-    0x1F, 0xC0, 0x2F, 0xC0, 0x0B, 0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xBE,
-    0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x0B, 0xF0, 0x0F, 0xE0, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0x00,
-    0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xF0, 0x00, 0xFF,
-    0x01, 0xFC, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x03, 0xFC, 0xBF, 0xE0, 0x00,
-    0xFF, 0x3F, 0xF0, 0x00, 0x3F, 0xCA, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x1F,
-    0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0xFB, 0xE0, 0x00, 0x2F, 0xFC, 0x7D,
-    0xFC, 0x00, 0x0F, 0xBF, 0x1F, 0xAF, 0x40, 0x0B, 0xDF, 0xC7, 0xE3, 0xF0, 0x03, 0xF3, 0xF1, 0xF8,
-    0xFC, 0x01, 0xF8, 0xFC, 0x7E, 0x2F, 0x80, 0xFC, 0x3F, 0x1F, 0x83, 0xF0, 0x7F, 0x0F, 0xC7, 0xE0,
-    0xFD, 0x3F, 0x83, 0xF1, 0xF8, 0x2F, 0xCF, 0xC0, 0xFC, 0x7E, 0x03, 0xFF, 0xF0, 0x3F, 0x2F, 0x80,
-    0xFF, 0xF8, 0x0F, 0xCB, 0xF0, 0x1F, 0xFC, 0x03, 0xF2, 0xFC, 0x03, 0xFF, 0x00, 0xFD, 0xBF, 0x00,
-    0xFF, 0x40, 0x3F, 0x6F, 0xC0, 0x1A, 0x80, 0x0F, 0xDB, 0xF0, 0x00, 0x00, 0x03, 0xF6, 0xFC, 0x00,
-    0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x1A, 0x40, 0x00, 0x00, 0x69, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF9, 0x55,
-    0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xE7, 0xFD, 0x00, 0x00,
-    0x1F, 0xF9, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x82,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07,
-    0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xFF,
-    0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBE,
-    0x55, 0x55, 0xFC, 0xBE, 0x00, 0x00, 0xBC, 0xBE, 0x00, 0x00, 0xBC, 0xBE, 0x00, 0x00, 0xBC, 0xBE,
-    0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0xFD, 0xBE,
-    0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0xFD, 0xBE,
-    0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0x1F, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFE, 0xAF, 0xFF, 0xC0, 0xBE, 0x00, 0x07, 0xFC, 0x2F, 0x80, 0x00, 0x3F,
-    0x0B, 0xE0, 0x00, 0x0B, 0xD2, 0xF8, 0x00, 0x02, 0xF8, 0xFE, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00,
-    0x3F, 0x4F, 0xE0, 0x00, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFE, 0xA9, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9,
-    0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x55, 0x68, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x05, 0x0F, 0xFF, 0xFA, 0x56, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x50, 0xFD,
-    0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x01,
-    0xF8, 0x0F, 0xD0, 0x02, 0xF8, 0x07, 0xF0, 0x03, 0xF4, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x7F, 0x4F, 0xD0, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xF9, 0x00, 0x0B, 0xFA, 0xBF, 0xAB,
-    0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x02, 0xF0, 0x3C, 0x00, 0x3F, 0x00, 0x0F, 0x87, 0x80, 0x03, 0xF0,
-    0x00, 0x7C, 0xB4, 0x00, 0x3F, 0x00, 0x07, 0xCB, 0x80, 0x03, 0xF0, 0x00, 0xBC, 0x7C, 0x00, 0x3F,
-    0x00, 0x0F, 0xC7, 0xF8, 0x03, 0xF4, 0x07, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xBF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x0B,
-    0xFB, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF2, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFC, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x1F, 0x00,
-    0x00, 0x3C, 0x07, 0xC0, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x7D, 0x00, 0x00, 0xF0, 0x1F,
-    0x40, 0x00, 0x7C, 0x07, 0xD0, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x01, 0xF4,
-    0x1F, 0x40, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x1F, 0x42, 0xF4, 0x00, 0x07, 0xD0, 0xBD, 0x00, 0x02,
-    0xF4, 0x2F, 0x40, 0x00, 0xBD, 0x0B, 0xD0, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x0B, 0xD0, 0xBE, 0x00,
-    0x02, 0xF8, 0x2F, 0x80, 0x00, 0xBE, 0x0B, 0xE0, 0x15, 0x7F, 0x96, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x7E, 0xBC, 0x00, 0x01, 0xFA, 0xF0,
-    0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x3F, 0x9F, 0x80, 0x02, 0xFE, 0x3F, 0x80, 0x2F, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xEF, 0xC0, 0xFF, 0xF8, 0x7F, 0x00, 0x15, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x15, 0x00, 0xBC, 0xBE, 0x00, 0x7F, 0x00, 0xBC, 0xBE,
-    0x00, 0x3F, 0x00, 0xBC, 0xBE, 0x00, 0x3F, 0x00, 0xBC, 0xBE, 0x00, 0x3F, 0x00, 0xBC, 0xBE, 0x00,
-    0x3F, 0x00, 0x7C, 0xBD, 0x00, 0x3F, 0x00, 0x7C, 0xBD, 0x00, 0x3F, 0x00, 0x7C, 0xBD, 0x00, 0x3E,
-    0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00,
-    0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x3C,
-    0xBD, 0x00, 0x3E, 0x00, 0x3D, 0xBD, 0x00, 0x3E, 0x00, 0x3D, 0xBD, 0x00, 0x3E, 0x00, 0x7D, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x54, 0x02, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x80, 0x0F, 0xC0, 0x2F, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0xFC, 0x02, 0xF0,
-    0x0B, 0xD0, 0x03, 0xF0, 0x0B, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x7C, 0x02, 0xF4, 0x00, 0xF8, 0x01, 0xF0, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xC0, 0x2F, 0x00, 0x0F,
-    0x80, 0x1F, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x0B, 0xC0,
-    0x03, 0xE0, 0x07, 0xC0, 0x2F, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x3C, 0x02,
-    0xF0, 0x00, 0xF8, 0x00, 0xF4, 0x0B, 0xEA, 0xA7, 0xFA, 0xAB, 0xE4, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7C,
-    0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0xFF, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x3E, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0x0F, 0xC0, 0x00,
-    0x3D, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x07, 0xD0, 0x00,
-    0x3F, 0xC3, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0xFE, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0x80, 0x07,
-    0xF0, 0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x3D,
-    0x3F, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x2F, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFE, 0x01, 0xBF, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
-    0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x1A, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x6A, 0x90, 0x00, 0x07, 0xFE, 0x7F, 0xFE, 0xA6, 0xBF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x07, 0xE0, 0x01, 0xFF, 0xFF, 0xE0,
-    0x1F, 0x80, 0x1F, 0xD0, 0x1F, 0xE0, 0x7E, 0x00, 0xFC, 0x00, 0x0F, 0xC1, 0xF8, 0x0B, 0xC0, 0x00,
-    0x1F, 0x87, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x81, 0xF4, 0x00, 0x00, 0xBD, 0x7E, 0x0B, 0xC0,
-    0x00, 0x01, 0xF5, 0xF8, 0x3F, 0x00, 0x00, 0x03, 0xE7, 0xE0, 0xFC, 0x00, 0x00, 0x0F, 0x9F, 0x83,
-    0xF0, 0x00, 0x00, 0x3E, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE7,
-    0xE0, 0xFD, 0x00, 0x00, 0x2F, 0x5F, 0x43, 0xFC, 0x00, 0x00, 0xFD, 0x7D, 0x0B, 0xFC, 0x00, 0x0F,
-    0xF1, 0xF4, 0x1F, 0xFE, 0x56, 0xFF, 0x87, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0x40, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x7C, 0x00, 0x3F, 0xFF, 0xFD, 0x01, 0xF0, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0x6A, 0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0xB8,
-    0x03, 0xF4, 0x00, 0x0B, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x03, 0xF0, 0x00, 0x0B, 0x80, 0x3F, 0x00,
-    0x00, 0xBC, 0x03, 0xF8, 0x00, 0x0B, 0xC0, 0x2F, 0xF4, 0x00, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x95,
-    0xBF, 0xC0, 0x3F, 0xC0, 0x03, 0xFD, 0x07, 0xF4, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x03, 0xFD, 0x0F,
-    0xF0, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x03,
-    0xFE, 0x3F, 0xF4, 0x00, 0x3F, 0xE3, 0xFF, 0x40, 0x03, 0xFE, 0x7F, 0xF4, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0,
-    0x03, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02,
-    0xF4, 0x1F, 0x00, 0x00, 0x7E, 0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00,
-    0x0B, 0xFC, 0x0F, 0xF9, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFD, 0x7D, 0x00, 0x2F, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xAC,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0xAE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x06, 0xA9, 0x00, 0x2F, 0x2F,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xD0, 0x7F, 0xF0, 0xBF, 0xC0, 0x02, 0xFE, 0x2F,
-    0xD0, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x00, 0xBF,
-    0x0F, 0xE0, 0x00, 0x3F, 0x82, 0xFE, 0x00, 0x7F, 0xD0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x90, 0x00, 0xBF, 0xFA, 0x40, 0x0F, 0xFF, 0xFF,
-    0x00, 0xF8, 0x00, 0xBC, 0x0F, 0x80, 0x02, 0xD0, 0xF8, 0x00, 0x2E, 0x0F, 0x80, 0x02, 0xE0, 0xF8,
-    0x00, 0xBC, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x07, 0xF0, 0xF8, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0xBC, 0xF8, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0xFC, 0xFD, 0x56, 0xBF, 0xCF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xC7, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x0F, 0xD0,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x03, 0xE0,
-    0x0F, 0xD0, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x03, 0xF4, 0x00, 0xBD, 0x00,
-    0xBF, 0x00, 0x0B, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xD3, 0xF0, 0x00, 0x00, 0x7C, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0xA4, 0x00, 0x00, 0xA8, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F,
-    0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD,
-    0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1B, 0xFE, 0x80, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x0F, 0xE0,
-    0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xE0, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xCF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEF, 0xF8, 0x00, 0x00,
-    0xFF, 0xF7, 0xFF, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0xFF, 0xF4, 0x7F,
-    0xF4, 0x7F, 0xF8, 0x0F, 0xFF, 0x42, 0xFF, 0xD0, 0xBF, 0xF8, 0x00, 0x50, 0x00, 0x7F, 0xFD, 0x01,
-    0x40, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x2D, 0x00, 0xFF, 0xD0,
-    0x02, 0xAF, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x0B, 0xFF, 0x40, 0x10, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF8, 0xBC, 0x00,
-    0x0B, 0xF8, 0xBC, 0x00, 0x0F, 0xFC, 0xBC, 0x00, 0x3F, 0x7C, 0xBC, 0x00, 0x7D, 0x7C, 0xBC, 0x00,
-    0xF8, 0x7C, 0xBC, 0x02, 0xF0, 0xBC, 0xBC, 0x07, 0xD0, 0xBC, 0xBC, 0x0F, 0xC0, 0xBC, 0xBC, 0x2F,
-    0x00, 0xBC, 0xBC, 0x7E, 0x00, 0xFC, 0xBC, 0xFC, 0x00, 0xFC, 0xBE, 0xF4, 0x00, 0xFC, 0xBF, 0xE0,
-    0x00, 0xFC, 0xBF, 0xC0, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFC, 0x02, 0x40, 0x04, 0x00, 0x03, 0xFA,
-    0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x0B, 0xF8, 0xBC, 0x00, 0x0F, 0xFC, 0xBC, 0x00,
-    0x3F, 0x7C, 0xBC, 0x00, 0x7D, 0x7C, 0xBC, 0x00, 0xF8, 0x7C, 0xBC, 0x02, 0xF0, 0xBC, 0xBC, 0x07,
-    0xD0, 0xBC, 0xBC, 0x0F, 0xC0, 0xBC, 0xBC, 0x2F, 0x00, 0xBC, 0xBC, 0x7E, 0x00, 0xFC, 0xBC, 0xFC,
-    0x00, 0xFC, 0xBE, 0xF4, 0x00, 0xFC, 0xBF, 0xE0, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0xFC, 0xBF, 0x40,
-    0x00, 0xFC, 0x0F, 0x80, 0x3F, 0x00, 0x3D, 0x03, 0xF4, 0x01, 0xF4, 0x2F, 0x80, 0x07, 0xD0, 0xFC,
-    0x00, 0x2F, 0x4F, 0xD0, 0x00, 0xBC, 0xBE, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x7F,
-    0x3F, 0xF0, 0x01, 0xFC, 0x3F, 0xF0, 0x07, 0xE0, 0x3F, 0xF0, 0x2F, 0x80, 0x7F, 0xF0, 0xBE, 0x00,
-    0xBF, 0xF4, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x02, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xE0,
-    0x1F, 0x02, 0xE0, 0x1F, 0x02, 0xE0, 0x2F, 0x03, 0xD0, 0x2F, 0x03, 0xD0, 0x2F, 0x03, 0xD0, 0x2F,
-    0x03, 0xC0, 0x2F, 0x03, 0xC0, 0x2F, 0x07, 0xC0, 0x2F, 0x2F, 0xC0, 0x2F, 0x3F, 0x40, 0x2F, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x0A, 0x90, 0xFF, 0x40, 0x00, 0x7F, 0x83, 0xFE, 0x00, 0x02, 0xFE,
-    0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xF8, 0x00, 0xBF, 0xF0, 0xFF, 0xF0, 0x03, 0xFF, 0xC3, 0xEF,
-    0xD0, 0x1F, 0xFF, 0x0F, 0x7F, 0x80, 0xBD, 0xFC, 0x7D, 0x7F, 0x03, 0xF3, 0xF1, 0xF4, 0xFE, 0x2F,
-    0x8F, 0xC7, 0xE2, 0xFC, 0xFD, 0x3F, 0x5F, 0x87, 0xFB, 0xF0, 0xFD, 0xBE, 0x0F, 0xFF, 0x87, 0xF6,
-    0xFC, 0x1F, 0xFD, 0x1F, 0xEB, 0xF0, 0x3F, 0xF0, 0x7F, 0xAF, 0xC0, 0xBF, 0x81, 0xFE, 0xBF, 0x01,
-    0xFC, 0x0B, 0xFB, 0xFC, 0x01, 0x50, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x2A, 0x00, 0x00,
-    0x0A, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xFC, 0x3F,
-    0x40, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00,
-    0xFD, 0x3F, 0x80, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x2F,
-    0xE3, 0xFC, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFF, 0x7F, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0xFE, 0x01, 0xFC, 0x07, 0xD0,
-    0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x0F, 0xEF, 0x00, 0x00,
-    0x3F, 0xBC, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x3F, 0x8F, 0xFE, 0xAB, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0x40, 0x00, 0x3E, 0xBD, 0x00,
-    0x00, 0xFA, 0xF4, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x7F, 0xBD, 0x00, 0x01,
-    0xFE, 0xF4, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x7F, 0xBE, 0x00, 0x01, 0xFE,
-    0xF8, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x7F, 0xBE, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2A, 0x90, 0x00, 0x3F, 0x2F, 0xFF, 0x80, 0x03, 0xFB, 0xFA, 0xBF, 0x00, 0x2F, 0xF8, 0x00,
-    0xF8, 0x02, 0xFF, 0x00, 0x07, 0xC0, 0x2F, 0xD0, 0x00, 0x3D, 0x02, 0xFC, 0x00, 0x03, 0xE0, 0x1F,
-    0xC0, 0x00, 0x3E, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x1F, 0xD0, 0x00, 0x3E, 0x02, 0xFF, 0x00, 0x07,
-    0xD0, 0x2F, 0xFE, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xF3,
-    0xFF, 0xFE, 0x00, 0xBF, 0x0F, 0xFF, 0x40, 0x0B, 0xE0, 0x05, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x95, 0x80, 0x0F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x50, 0x07, 0xC0, 0x04, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4,
-    0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F,
-    0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0x40, 0x3F, 0x00, 0x7F, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0xF4, 0x78, 0x00, 0x3F, 0x00, 0x0B,
-    0xC7, 0x40, 0x03, 0xF0, 0x00, 0x7C, 0xB4, 0x00, 0x3F, 0x00, 0x0B, 0xCB, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x7E, 0x00, 0x3F, 0x00, 0x2F, 0xC3, 0xFE, 0x57, 0xF9, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFF,
-    0xE9, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F,
-    0x8F, 0xC0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xD0,
-    0x02, 0xFD, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xBD, 0x00,
-    0x02, 0xF0, 0x1F, 0x40, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x7D,
-    0x00, 0x02, 0xF0, 0x1F, 0x40, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x07, 0xC0,
-    0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x69, 0x00, 0x20, 0x00, 0x61, 0xD0, 0x02, 0xC7, 0x40, 0x0B, 0x1D,
-    0x00, 0x2D, 0x74, 0x00, 0xB5, 0xD0, 0x02, 0xD7, 0x40, 0x0F, 0x5F, 0x00, 0x7D, 0x3E, 0x5B, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x7F, 0x8F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x15, 0x00, 0xBC, 0xBE, 0x00, 0x7F, 0x00, 0xBC,
-    0xBE, 0x00, 0x3F, 0x00, 0xBC, 0xBE, 0x00, 0x3F, 0x00, 0xBC, 0xBD, 0x00, 0x3F, 0x00, 0x7C, 0xBD,
-    0x00, 0x3F, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00,
-    0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0xBD, 0x00, 0x3E, 0x00, 0x3C, 0xBD, 0x00, 0x3E,
-    0x00, 0x3D, 0xBD, 0x00, 0x3E, 0x00, 0x3D, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0x50, 0x0B,
-    0xC0, 0xBE, 0x00, 0x7F, 0x00, 0xBC, 0x0B, 0xE0, 0x03, 0xF0, 0x0B, 0xC0, 0xBE, 0x00, 0x3F, 0x00,
-    0xBC, 0x0B, 0xD0, 0x03, 0xF0, 0x07, 0xC0, 0xBD, 0x00, 0x3F, 0x00, 0x7C, 0x0B, 0xD0, 0x03, 0xE0,
-    0x07, 0xC0, 0xBD, 0x00, 0x3E, 0x00, 0x7C, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xC0, 0xBD, 0x00, 0x3E,
-    0x00, 0x7C, 0x0B, 0xD0, 0x03, 0xE0, 0x03, 0xC0, 0xBD, 0x00, 0x3E, 0x00, 0x3C, 0x0B, 0xD0, 0x03,
-    0xE0, 0x03, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x6A, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x07,
-    0xFA, 0xAB, 0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x03,
-    0xD0, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x1F, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x3C, 0xBE, 0x00, 0x00, 0x00, 0x3C, 0xBE, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x7C,
-    0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7F, 0xFF, 0xE4, 0x00, 0x7C, 0x7F,
-    0xAA, 0xBF, 0x00, 0x7C, 0x3E, 0x00, 0x0B, 0xC0, 0x7C, 0x3E, 0x00, 0x03, 0xD0, 0x7D, 0x3F, 0x00,
-    0x02, 0xE0, 0x7D, 0x3F, 0x00, 0x03, 0xE0, 0xBD, 0x3F, 0x00, 0x1F, 0xD0, 0xBD, 0x3F, 0xFF, 0xFF,
-    0xC0, 0xBD, 0x3F, 0xFF, 0xFF, 0x40, 0xBD, 0x3F, 0xFF, 0xE4, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBE, 0xAA, 0xFE, 0x0B, 0xC0, 0x00, 0xF8, 0xBC,
-    0x00, 0x03, 0xCB, 0xC0, 0x00, 0x3C, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x01, 0xFC, 0xBF, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xE4, 0x00, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xBF, 0xF4, 0x0B,
-    0x40, 0x07, 0xF4, 0x10, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x7F, 0x14, 0x00, 0x03, 0xF8, 0xB9, 0x41, 0xBF, 0xC2, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xD0,
-    0x01, 0xBF, 0xE4, 0x00, 0x3D, 0x00, 0x2F, 0xF8, 0x00, 0xF4, 0x03, 0xFF, 0xFD, 0x03, 0xD0, 0x3E,
-    0x00, 0xBC, 0x0F, 0x42, 0xE0, 0x00, 0xB8, 0x3D, 0x0F, 0x00, 0x01, 0xF0, 0xF4, 0x7C, 0x00, 0x03,
-    0xD3, 0xD2, 0xE0, 0x00, 0x0F, 0x4F, 0x4B, 0x80, 0x00, 0x3E, 0x3D, 0x3D, 0x00, 0x00, 0xB8, 0xFF,
-    0xF8, 0x00, 0x03, 0xE3, 0xEB, 0xF0, 0x00, 0x0F, 0x4F, 0x0B, 0xD0, 0x00, 0x7D, 0x3C, 0x1F, 0xC0,
-    0x07, 0xF0, 0xF0, 0x3F, 0xEA, 0xBF, 0x83, 0xC0, 0xBF, 0xFF, 0xFC, 0x0F, 0x00, 0xBF, 0xFF, 0xD0,
-    0x3C, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0x50, 0x3F, 0x02, 0xD0, 0x03, 0xF0,
-    0x3C, 0x00, 0x3F, 0x03, 0x80, 0x03, 0xF0, 0x3C, 0x00, 0x3F, 0x02, 0xF4, 0x03, 0xF0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xE4, 0x3F, 0x02, 0xF4, 0x03, 0xF0, 0x3E, 0x00, 0x3F, 0x0F,
-    0xC0, 0x03, 0xF1, 0xF8, 0x00, 0x3F, 0x3F, 0x40, 0x03, 0xF7, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x03, 0xF8, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56,
-    0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x2F, 0x01, 0xA0, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x90, 0x00, 0xFD, 0x47, 0xF0, 0x0F, 0x80, 0x02, 0xF0, 0x7C,
-    0x00, 0x03, 0xD3, 0xD0, 0x00, 0x07, 0x8F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xF4, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01,
-    0x91, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x6B, 0xE9, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F,
-    0xF8, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x1F,
-    0xD0, 0x00, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x02, 0xF0,
-    0x00, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x00,
-    0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x01, 0xFD,
-    0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF9,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC7, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x3E, 0x01, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x1F, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0x01, 0xA8, 0x2F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD,
-    0x00, 0xBE, 0x41, 0x50, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0xE4, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x2F, 0x43, 0xF8, 0x3F, 0x87, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xE0, 0x2E, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
-    0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x47, 0xF4, 0x0F, 0xC0, 0x0F, 0xC1,
-    0xFC, 0x01, 0xFC, 0x2F, 0xD0, 0x2F, 0xD3, 0xFD, 0x03, 0xFD, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0x00, 0x7F, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xEA, 0xAF, 0x00,
-    0x00, 0x03, 0x40, 0x0F, 0x00, 0x00, 0x03, 0x40, 0x0F, 0x00, 0x00, 0x03, 0x40, 0x0F, 0x00, 0x00,
-    0x03, 0x00, 0x0F, 0x54, 0x00, 0x07, 0x00, 0x0F, 0xFF, 0xD0, 0x07, 0x00, 0x0F, 0x00, 0xB4, 0x07,
-    0x00, 0x0F, 0x00, 0x3C, 0x0B, 0x00, 0x0F, 0x00, 0x2C, 0x0B, 0x00, 0x0F, 0x00, 0x2C, 0x0B, 0x00,
-    0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0xAA, 0xFC, 0x3E, 0x00, 0x0F, 0xFF, 0xF4, 0x7C, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x18, 0x00, 0x02, 0xC0, 0x00, 0xB0, 0x00,
-    0x0B, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x00, 0xB0, 0x00, 0x2C, 0x00, 0x02, 0xC0,
-    0x00, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2E, 0xAA, 0xAF, 0x55, 0xF4, 0xB0, 0x00, 0x3C,
-    0x00, 0xF2, 0xC0, 0x00, 0xF0, 0x01, 0xDB, 0x00, 0x03, 0xC0, 0x07, 0x6C, 0x00, 0x0F, 0x00, 0x3D,
-    0xB0, 0x00, 0x3E, 0xAB, 0xF2, 0xC0, 0x00, 0xFF, 0xFF, 0x8B, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xBF, 0xE0, 0x00, 0x0B,
-    0xEF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE0, 0x1F, 0xD0, 0x02, 0xFD, 0x00,
-    0x1F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x02, 0xF0,
-    0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0xFD,
-    0x00, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x7F, 0x80, 0x01,
-    0xFD, 0x02, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0xF4, 0x0F, 0xD0, 0x07,
-    0xD0, 0xBE, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0xBD, 0x3F, 0x40, 0x02, 0xF2, 0xF8, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x3F, 0xBF, 0xC0, 0x01, 0xFC, 0xFF, 0xC0, 0x07, 0xF0, 0xFF, 0xC0, 0x1F, 0x80, 0xFF, 0xC0,
-    0xBE, 0x01, 0xFF, 0xC2, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF8,
-    0xBC, 0x00, 0x0B, 0xF8, 0xBC, 0x00, 0x0F, 0xFC, 0xBC, 0x00, 0x3F, 0x7C, 0xBC, 0x00, 0x7D, 0x7C,
-    0xBC, 0x00, 0xF8, 0x7C, 0xBC, 0x02, 0xF0, 0xBC, 0xBC, 0x07, 0xD0, 0xBC, 0xBC, 0x0F, 0xC0, 0xBC,
-    0xBC, 0x2F, 0x00, 0xBC, 0xBC, 0x7E, 0x00, 0xFC, 0xBC, 0xFC, 0x00, 0xFC, 0xBE, 0xF4, 0x00, 0xFC,
-    0xBF, 0xE0, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFC, 0x03, 0xC0, 0x00, 0xB4,
-    0x03, 0xC0, 0x00, 0xF0, 0x02, 0xF4, 0x02, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC,
-    0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0,
-    0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x5F,
-    0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x3D, 0x7C, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD7,
-    0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x3D, 0x7C, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF5,
-    0xF0, 0x00, 0x3D, 0x7C, 0x00, 0x0F, 0x5F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x00, 0x74, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xAB, 0xF4,
-    0x01, 0xFD, 0x00, 0x1F, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x1F, 0xC0, 0x00, 0x78, 0x07, 0xF0, 0x00,
-    0x1F, 0x01, 0xFD, 0x00, 0x0F, 0x80, 0x3F, 0xFA, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x5B, 0xD5, 0x54,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xAB, 0xF4, 0x01, 0xFD, 0x00, 0x1F, 0x00, 0x7F, 0x00, 0x02, 0xE0, 0x1F, 0xC0, 0x00, 0x38, 0x07,
-    0xF0, 0x00, 0x1F, 0x01, 0xFD, 0x00, 0x1F, 0xC0, 0x3F, 0xFE, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x01, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xF8, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x02, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xE7, 0xF9,
-    0xFE, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0xBD, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0xFC, 0x00, 0x3F, 0x00,
-    0xFD, 0x01, 0xF8, 0x01, 0xF4, 0x02, 0xF4, 0x03, 0xF0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xC0, 0x3F,
-    0x00, 0x2F, 0x40, 0x1F, 0x41, 0xF8, 0x00, 0xBD, 0x00, 0x3F, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0xFC,
-    0x3F, 0x40, 0x0F, 0xE0, 0x03, 0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFD,
-    0x00, 0x2F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x03, 0xD3, 0xD2, 0xD0, 0x01, 0xE0, 0xF4, 0x3C,
-    0x00, 0xF0, 0x2D, 0x07, 0x80, 0x3C, 0x0B, 0x40, 0xF0, 0x2E, 0x02, 0xD0, 0x3C, 0x0F, 0x40, 0xB4,
-    0x0B, 0x47, 0xC0, 0x3E, 0x02, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x3F,
-    0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xC0, 0xFC, 0x03, 0xF8, 0x07, 0xE0, 0x7F, 0x00, 0x3F, 0xEB, 0xF4,
-    0x1F, 0x81, 0xBF, 0xFF, 0xF8, 0x06, 0x93, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFE, 0x40, 0x6F, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xD0,
-    0xBF, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC3,
-    0xF4, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x1F,
-    0xF9, 0x00, 0x1B, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x06, 0xA4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x64, 0x2F, 0xFC, 0x00, 0xB8, 0x3E, 0x1F, 0x40, 0xB4,
-    0xBC, 0x0B, 0xD1, 0xF4, 0xBC, 0x07, 0xFF, 0xF0, 0xB8, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xD0, 0x07, 0xF4, 0x2F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xBD, 0x7D, 0x00, 0x00, 0x7E,
-    0x7D, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xFD,
-    0x3F, 0xE5, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x7F, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x87, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x80, 0x00, 0x07, 0xF4, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x3F, 0x00,
-    0x00, 0x7E, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x07,
-    0xF2, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x3E,
-    0x00, 0x03, 0xE5, 0x55, 0x7E, 0xBF, 0xFF, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC5, 0x55, 0x55,
-    0x7F, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x7F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0A, 0xAA,
-    0xA8, 0x0F, 0xFF, 0xFD, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xF8, 0x02, 0xFC, 0x0B, 0xF4, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x03, 0xF0, 0xBE,
-    0x00, 0x00, 0x7D, 0x2F, 0x80, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x03, 0xD2, 0xF8, 0x00, 0x01, 0xF4,
-    0xBE, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x0B, 0xFF, 0x0B, 0xF0, 0x03, 0xFF, 0x42, 0xFC, 0x00, 0xFE,
-    0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xF0, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
-    0x78, 0x10, 0x07, 0xFF, 0xF4, 0x7E, 0x03, 0xC7, 0x80, 0x0E, 0x78, 0x00, 0xB7, 0x40, 0x0B, 0xB4,
-    0x00, 0xFB, 0x80, 0xFE, 0xB8, 0x0F, 0x80, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x07,
-    0xFC, 0x03, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x3F, 0x82, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE1, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xD7, 0xFC, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0xFF, 0xBF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE2, 0xFF, 0xF1, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x2F, 0xFF, 0x03, 0xFF,
-    0xF8, 0x3F, 0xFF, 0x80, 0xFF, 0xFC, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02,
-    0xF0, 0x0F, 0xC0, 0x02, 0xF4, 0x1F, 0x02, 0xF4, 0x00, 0x0F, 0xC1, 0xF0, 0x3E, 0x00, 0x00, 0x7E,
-    0x1F, 0x0F, 0xC0, 0x00, 0x02, 0xF2, 0xF1, 0xF4, 0x00, 0x00, 0x0F, 0xAF, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xBF, 0xEF, 0xF0, 0x00, 0x3F, 0xE7, 0xFC, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x7F, 0xC3, 0xFF, 0x03, 0xFF, 0x0B, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0xFF, 0xE4, 0x00,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFA, 0xAF, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x55, 0xBF, 0xC0, 0x0F, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF5, 0xE4, 0x00, 0xBF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x50, 0x00, 0x7F, 0xFD, 0x01,
-    0x40, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x2D, 0x00, 0xFF, 0xD0,
-    0x02, 0xAF, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0x40, 0x0C, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x07, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x74, 0x00, 0xFF, 0x80, 0x02, 0xA4, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x00, 0x07,
-    0xF0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x0B, 0xF8, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x0F, 0xE2, 0xFE,
-    0x00, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xDB, 0xF4, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xCF, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF, 0xF0, 0x00, 0x3F, 0xC0,
-    0xBF, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x07,
-    0xFF, 0xF4, 0x7F, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x0F, 0xC0, 0x1F, 0x02, 0xF0, 0x01, 0xF0, 0x7E, 0x00, 0x1F, 0x0F, 0xC0, 0x02, 0xF1, 0xF4, 0x00,
-    0x2F, 0x3F, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3E, 0xFF, 0x00, 0x03, 0xE7, 0xFC, 0x00, 0x7E, 0x2F, 0xF0, 0x07,
-    0xD0, 0xFF, 0xC0, 0x7D, 0x03, 0xFF, 0x0B, 0xD0, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x40, 0x0B, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xCA, 0x80, 0x3F, 0x40,
-    0x00, 0xFC, 0xFD, 0x0B, 0xF0, 0x00, 0x0F, 0x8F, 0xD1, 0xFC, 0x00, 0x01, 0xF8, 0xFD, 0x3F, 0x80,
-    0x00, 0x1F, 0x8F, 0xD7, 0xF0, 0x00, 0x01, 0xF8, 0xFD, 0xFD, 0x00, 0x00, 0x2F, 0x9F, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xF9, 0xFE, 0xFE,
-    0x00, 0x00, 0x3F, 0x9F, 0xDB, 0xF8, 0x00, 0x03, 0xF5, 0xFD, 0x3F, 0xF0, 0x00, 0x3F, 0x5F, 0xD0,
-    0xFF, 0xC0, 0x03, 0xF5, 0xFD, 0x07, 0xFF, 0x00, 0x7F, 0x6F, 0xD0, 0x3F, 0xFC, 0x07, 0xF4, 0x00,
-    0x00, 0xFF, 0xF0, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x0E, 0x00, 0x02, 0xF0, 0x03, 0xC0, 0x01,
-    0xF4, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x7C, 0xF0, 0x7C, 0x00, 0x1E, 0x7C, 0x3D, 0x00, 0x0B, 0x9F,
-    0x2F, 0x00, 0x02, 0xE7, 0xDF, 0x00, 0x00, 0xBE, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F,
-    0xAF, 0xBD, 0x00, 0x03, 0xEB, 0xCF, 0xE0, 0x00, 0xF6, 0xF0, 0xFE, 0x00, 0x3D, 0xBC, 0x1F, 0xE0,
-    0x1F, 0x6A, 0x02, 0xFE, 0x07, 0xD0, 0x00, 0x3F, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-    0x00, 0x3F, 0xD0, 0x07, 0xFF, 0xFE, 0x1F, 0xE0, 0x00, 0xAF, 0xFA, 0x4F, 0xF0, 0x00, 0x02, 0xFC,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x83, 0xFD, 0x00, 0x00, 0x0F, 0xE1,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xC1, 0xFF,
-    0xF0, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
-    0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x1F, 0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x05, 0x5B, 0xE5, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xC3, 0xF4,
-    0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xF3,
-    0xFE, 0x00, 0x00, 0x1F, 0xC3, 0xFE, 0x00, 0x00, 0x7F, 0x07, 0xFE, 0x00, 0x01, 0xFC, 0x0B, 0xFE,
-    0x00, 0x07, 0xF0, 0x0F, 0xFE, 0x00, 0x2F, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xBC, 0x07, 0xFF, 0xFE,
-    0x07, 0xE0, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0x00, 0x0F, 0x4F, 0xC0,
-    0x00, 0x00, 0x3C, 0xBC, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x00, 0x3F, 0x3F, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xF0, 0x7F, 0xC0,
-    0x00, 0x0F, 0xC0, 0xBF, 0xC0, 0x00, 0x3E, 0x00, 0xFF, 0xC0, 0x1A, 0x40, 0x00, 0x00, 0x69, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0x80, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x03, 0xFE, 0x55, 0x55, 0x6F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00,
-    0x00, 0x1F, 0xF8, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xD0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x3E, 0x0F,
-    0x40, 0x00, 0xFC, 0x7D, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x3F, 0x1F, 0x80,
-    0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFC, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0xFD,
-    0xBF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x3F, 0x80,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE5, 0x55, 0x56, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x7F, 0xFF, 0xF3, 0xE0, 0x00, 0x1F,
-    0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBC,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80,
-    0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xAF, 0xFE, 0x00,
-    0x7F, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0xBF, 0xE4, 0x07, 0xF4, 0x7F, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7D, 0x7F, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x7F,
-    0x00, 0x00, 0xFF, 0x00, 0x1F, 0xFC, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xF8, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF6,
-    0xFF, 0xE0, 0x0B, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x2F, 0x80, 0x00, 0x7F, 0xE0, 0x0B, 0xF0,
-    0x69, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xBE, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00,
-    0x2E, 0x00, 0x7E, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x01, 0xF4, 0x00, 0x07, 0xD0,
-    0x07, 0xE0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xF8, 0x00, 0x7F,
-    0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0x87, 0xFF, 0x00, 0x40, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0x02, 0xF0, 0x1F, 0xFD, 0x41, 0xFF,
-    0xFF, 0xEF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0x90, 0x00, 0x3E, 0x00,
-    0x07, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0xBD, 0x07, 0xD0, 0x0F, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x3E,
-    0x00, 0x2D, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x38, 0x03, 0xD0, 0x03, 0xC0, 0x02, 0xE0,
-    0x0F, 0x40, 0x1F, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF4, 0x0F,
-    0xD0, 0x03, 0xF4, 0x03, 0xF1, 0xFE, 0x00, 0x07, 0xF9, 0x07, 0xFF, 0xF0, 0xBC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xE7, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00,
-    0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x95, 0x68, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x6E, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xAB, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xA6, 0x80, 0x2F, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0xE6, 0x80,
-    0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0xAB, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF6,
-    0xFF, 0xFF, 0xFF, 0xD5, 0x50, 0xF8, 0x01, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x81, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x02, 0xF4,
-    0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0,
-    0x07, 0xE0, 0x1F, 0x80, 0x03, 0xF0, 0x2F, 0x40, 0x02, 0xF4, 0x3F, 0x00, 0x01, 0xFC, 0x7E, 0x00,
-    0x00, 0xFC, 0xBD, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x07, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFC,
-    0x00, 0x03, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0,
-    0x00, 0x01, 0xFF, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x2A, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x03,
-    0xF0, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x03, 0xF0,
-    0x2F, 0x40, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xE4, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x00, 0x00, 0xB8,
-    0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x2F,
-    0x00, 0x00, 0x1F, 0x4F, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x0F, 0xD0,
-    0x7F, 0x80, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x01, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x7C, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x1F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA4, 0x04, 0x07, 0xFF,
-    0xFF, 0x82, 0xD0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x2D,
-    0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x3C,
-    0x00, 0x2D, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x02, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x55, 0x00, 0x00, 0x54, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0x80,
-    0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0xFD, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x03, 0xD0, 0x00, 0x0F,
-    0xD0, 0x0F, 0x40, 0x00, 0x3F, 0x40, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x02,
-    0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xE7, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x90, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00,
-    0x2F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x29, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3D, 0x03,
-    0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3D, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3D, 0x02, 0xD0, 0x0B,
-    0xD0, 0x0F, 0xAB, 0xFD, 0x00, 0x7F, 0xFB, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x2C,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x3F,
-    0x1F, 0x40, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00,
-    0x3F, 0x1F, 0x82, 0xE0, 0x1F, 0xD7, 0xE0, 0xB8, 0x0B, 0xF4, 0xFD, 0x2E, 0x07, 0xFD, 0x3F, 0xDF,
-    0xCB, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFB, 0xF4, 0x07, 0xFF, 0xE0, 0xFD, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x02, 0xE0, 0x0F, 0xE0, 0x00, 0xB8, 0x07, 0xF8, 0x00, 0x2E, 0x01, 0xFE,
-    0x00, 0x0B, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x24, 0x00, 0x18, 0x38, 0x00, 0x2D, 0x38,
-    0x00, 0x2D, 0x38, 0x00, 0x2D, 0x38, 0x00, 0x2D, 0x38, 0x00, 0x3D, 0x3C, 0x74, 0x3D, 0x3C, 0x74,
-    0xBE, 0x3F, 0xFA, 0xFE, 0x1F, 0xFF, 0xFE, 0x02, 0xFE, 0x3E, 0x00, 0x74, 0x3E, 0x00, 0x74, 0x3E,
-    0x00, 0x74, 0x3E, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xE4, 0x07, 0xF0, 0x7F, 0x80,
-    0x00, 0xF4, 0x7F, 0x00, 0x00, 0xB8, 0x7F, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0xBC, 0x7E, 0x00,
-    0x00, 0xBC, 0x7E, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFD, 0x7F, 0x00,
-    0x00, 0xFD, 0x7F, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x4B, 0xFE, 0x00, 0x2F, 0xBF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x01, 0xF8, 0x3F, 0xC0,
-    0x00, 0xFC, 0x3F, 0x80, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0xBC, 0x3F, 0x40,
-    0x00, 0xBC, 0x3F, 0x40, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x7F, 0x40, 0x00, 0xFD, 0x7F, 0x40,
-    0x00, 0xFD, 0x7F, 0x80, 0x01, 0xFD, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xEA, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x0F, 0x8F,
-    0xE0, 0x7F, 0x00, 0x00, 0x07, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x81, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xA0, 0x01, 0xFE, 0x95, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE4, 0x00, 0x1B, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x06, 0xBA, 0x90, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xD0,
-    0x1F, 0x05, 0x02, 0xF0, 0x00, 0x78, 0xF4, 0x3C, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xEA, 0x95, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAB, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAB, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3D, 0x0B, 0xE0, 0x2F, 0x80,
-    0x00, 0x02, 0xF0, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x6F, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x0F, 0xE5,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF9, 0x00, 0x00, 0x60, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x7E, 0x40, 0xB4, 0x04, 0x03, 0xD0,
-    0x00, 0xF0, 0x7C, 0x2E, 0x00, 0x01, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x1F, 0xEA, 0x55, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xAA, 0x4B, 0xF4, 0xBF, 0x4B, 0xF4,
-    0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0xF4, 0x7F,
-    0x87, 0xF8, 0x7F, 0x87, 0xF8, 0x7F, 0xCB, 0xFC, 0xBF, 0xCB, 0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xC0,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80,
-    0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x0F,
-    0xF0, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0xCF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFD, 0xFF,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0xCF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0xBF, 0xFC, 0x2F, 0xFF, 0x80,
-    0x3F, 0xFF, 0x42, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0xA0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x3F,
-    0x40, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xBF, 0xFB, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xCF, 0xFE, 0x00, 0x03, 0xFF, 0xC7,
-    0xFF, 0x0F, 0xFE, 0x00, 0x3F, 0xFD, 0x1F, 0xFD, 0x1F, 0xFE, 0x03, 0xFF, 0xD0, 0xBF, 0xF4, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0xFC, 0x1F, 0xC0, 0x00,
-    0x3E, 0x0F, 0xD0, 0x00, 0x1F, 0x8B, 0xF0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xFA, 0xF8, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x03, 0xF8, 0x5F,
-    0xFE, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x3F, 0x40, 0x01, 0xFD, 0x0F, 0xD0, 0x00, 0x2F, 0xC3, 0xF4,
-    0x00, 0x03, 0xF1, 0xFD, 0x00, 0x00, 0xFD, 0x7F, 0x40, 0x00, 0x3F, 0x5F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1D, 0x03,
-    0xE0, 0x1D, 0x07, 0xC0, 0x2D, 0x0F, 0x40, 0x2D, 0x2F, 0x00, 0x2D, 0x3C, 0x00, 0x3C, 0xB8, 0x00,
-    0x3D, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xFA, 0x00, 0x3C, 0x1F, 0xD0, 0x3C, 0x02, 0xF0, 0x7C,
-    0x00, 0xB8, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x3C, 0xBC, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x01,
-    0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00,
-    0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0xBF, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x00, 0x0F,
-    0xE0, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x40, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x50, 0x6F, 0xF0,
-    0x00, 0xFF, 0xFC, 0x3F, 0xF4, 0x00, 0x3F, 0xFE, 0x0F, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x0B,
-    0xC0, 0x7C, 0x00, 0xBC, 0x07, 0xC0, 0x0B, 0xC0, 0x7C, 0x00, 0xB8, 0x07, 0xC0, 0x0B, 0x80, 0x7C,
-    0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x40, 0xBC, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x40, 0xBC, 0x00, 0xF0,
-    0x0B, 0xC0, 0x1F, 0x00, 0xBD, 0x4B, 0xF0, 0x0B, 0xFC, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x1A, 0x40, 0x00, 0x00, 0x69, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0xFF, 0x95, 0x55, 0x5B, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x81,
-    0xFF, 0x40, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0xBF,
-    0xFC, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2E,
-    0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xF0, 0x3F,
-    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x02, 0xF4, 0x3F,
-    0x00, 0x02, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x03, 0xFE, 0x3F,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x15, 0x40, 0x1A, 0x40, 0x00, 0x00, 0x69, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0xFF, 0x95, 0x55, 0x5B, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x41,
-    0xFF, 0x40, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0xBF,
-    0xE0, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xF0, 0x3E,
-    0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xF0, 0x3F, 0x00, 0x01, 0xF0, 0x3F, 0x00, 0x01, 0xF0, 0x3F,
-    0x00, 0x02, 0xF4, 0x3F, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x02, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F,
-    0x00, 0x03, 0xF8, 0x3F, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xA0, 0x55, 0x00, 0x00, 0x54, 0xFE, 0x00, 0x01, 0xFC, 0xBE,
-    0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xFC, 0x7D,
-    0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x01, 0xFC, 0x3F,
-    0x00, 0x03, 0xFC, 0x1F, 0x90, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE6, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x50, 0x60, 0x00, 0x62, 0xC0, 0x03, 0xCB, 0x00, 0x0F, 0x2C, 0x00, 0x3C, 0xB0, 0x00,
-    0xF2, 0xC0, 0x03, 0xCB, 0x00, 0x0F, 0x2E, 0x00, 0xBC, 0x7E, 0x5B, 0xF0, 0xFF, 0xFF, 0xC0, 0xBF,
-    0x8F, 0x00, 0x00, 0x3C, 0x00, 0x06, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x02, 0xC0, 0x00,
-    0x0B, 0x00, 0x00, 0x2C, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xEF, 0xF0,
-    0x00, 0xFF, 0xBF, 0x40, 0x2F, 0xDF, 0xF8, 0x02, 0xFE, 0xBF, 0x40, 0x2F, 0xCF, 0xFC, 0x03, 0xFD,
-    0xBF, 0x40, 0x2F, 0xC7, 0xFD, 0x07, 0xFC, 0xBF, 0x80, 0x3F, 0xC3, 0xFF, 0x0B, 0xF8, 0xBF, 0x80,
-    0x3F, 0xC2, 0xFF, 0x0F, 0xF0, 0xFF, 0x80, 0x3F, 0xC0, 0xFF, 0xAF, 0xF0, 0xFF, 0xC0, 0x3F, 0xC0,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xC0, 0x3F, 0xD0, 0x7F, 0xFF, 0xC0, 0xFF, 0xC0, 0x3F, 0xD0, 0x3F, 0xFF,
-    0xC0, 0xFF, 0xC0, 0x3F, 0xD0, 0x2F, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xD0, 0x0F, 0xFF, 0x00, 0xFF,
-    0xC0, 0x3F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFD, 0x01, 0xFF, 0xD0, 0x7F,
-    0xE0, 0x03, 0xFC, 0x01, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x7F, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x00,
-    0x7F, 0x80, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x01, 0xFF, 0xC0, 0x2E, 0xFC, 0x02, 0xFB,
-    0xC0, 0x2E, 0xBE, 0x03, 0xFB, 0xC0, 0x2F, 0x3F, 0x07, 0xDB, 0xC0, 0x3F, 0x3F, 0x4F, 0xCF, 0xC0,
-    0x3F, 0x1F, 0xDF, 0x8F, 0xD0, 0x3F, 0x0F, 0xFF, 0x4F, 0xD0, 0x3F, 0x0B, 0xFF, 0x0F, 0xD0, 0x3F,
-    0x03, 0xFE, 0x0F, 0xE0, 0x3F, 0x03, 0xFD, 0x0F, 0xE0, 0x3F, 0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x40,
-    0xA4, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0x90, 0x54, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBE, 0x7E, 0x7E, 0x7E,
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x0F, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD1,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0,
-    0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC7, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0F, 0x80,
-    0x1F, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x87, 0xC0, 0x01, 0xFF, 0xFE, 0xF0, 0x01, 0xFE, 0xAF, 0xFC, 0x00, 0xFC, 0x00, 0xBF,
-    0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xBD, 0x07, 0xC0, 0x00,
-    0x1F, 0x81, 0xF0, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x03, 0xFC, 0x1F, 0x40, 0x02, 0xFF, 0x03, 0xFE,
-    0x5B, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x5F, 0x40,
-    0x0B, 0xFE, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00,
-    0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8,
-    0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x7F,
-    0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x0F, 0xF8, 0x0F, 0xF4, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x1F, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x07, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x3C, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x7E,
-    0x07, 0xC0, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x0B, 0xFC, 0x0F, 0xF9, 0x6F,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x7D, 0x00, 0x2F,
-    0xF8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF3, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xFF, 0x55, 0x6A, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFE, 0x1F, 0x1F, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFB, 0xEF, 0xD0, 0x2F, 0x00, 0x07, 0xFA, 0xBF, 0xFF, 0x40, 0x01, 0xE0,
-    0x03, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x3F, 0xC0, 0x05, 0x6F, 0x80, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x3C, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE8, 0x1F, 0x00, 0x00,
-    0x7F, 0x50, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x6F, 0xFF, 0xF9, 0x00,
-    0x09, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xF8, 0x1F, 0x4A, 0xFF, 0x90, 0x00, 0x09,
-    0x00, 0x02, 0x80, 0x3C, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0xB8, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0xBC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0B, 0xE5, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xD2, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0xE5, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x40, 0x00, 0xA0, 0x03, 0x80, 0x00, 0xF0, 0x03, 0xD0, 0x02, 0xE0,
-    0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF8, 0x03, 0xD0,
-    0x0F, 0xC0, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xE9, 0xBD, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x18, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x80, 0x01, 0xBF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF4, 0x14, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x7E, 0x6B, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x3F, 0x95, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x02, 0xF0,
-    0x03, 0xD0, 0x1F, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xE4, 0x00, 0x01, 0xBF, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x14, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x2B, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x00, 0x7C, 0x1E, 0x00, 0x00, 0xF8,
-    0x0F, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x1F, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x14, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x7E, 0x6B, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0x95, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x1F, 0xD0,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xE4, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x14, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x2B, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xA5, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x02, 0xF0,
-    0x07, 0xD0, 0x1F, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFB, 0xFF, 0xE0, 0x1F, 0xF0, 0x1F, 0xE0,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x15, 0x50, 0x15, 0x50, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFE, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x83,
-    0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x5F, 0xF3, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x7F,
-    0xDF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x2F, 0xFF, 0x0B, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xD0, 0xBF, 0xFC, 0x0F, 0xFF, 0xE0, 0xFF, 0xFE, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x02,
-    0xA0, 0x02, 0xA0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0xBF, 0x00, 0x00, 0x00,
-    0x7F, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xDF, 0xFC, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFC, 0x7F, 0xF0, 0xFF, 0xE0, 0x03, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xE0, 0x3F, 0xFD, 0x0B,
-    0xFF, 0x42, 0xFF, 0xE0, 0x3F, 0x00, 0x3F, 0x00, 0xFD, 0x01, 0xFD, 0x07, 0xF8, 0x0B, 0xF4, 0x2F,
-    0xE0, 0x2F, 0xE0, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFA, 0xAF, 0xF8, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4,
-    0x01, 0x55, 0xBF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBD, 0x40, 0x00,
-    0x07, 0xF2, 0xE0, 0x00, 0xBF, 0xCB, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0x00, 0x6F, 0xFF, 0x90, 0x00, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xFC, 0x2F, 0xD0, 0x2F, 0xC3,
-    0xFD, 0x03, 0xFD, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x14, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xAF, 0x80,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x03, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x07, 0xC0, 0x3F, 0xC1, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x6F, 0xE0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0x00,
-    0x1F, 0xC0, 0xBD, 0x07, 0xFC, 0x2F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00,
-    0x01, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0A, 0xA0, 0x7F, 0x40, 0x00,
-    0x0B, 0xFC, 0x1F, 0xD0, 0x00, 0x03, 0xFF, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0xFE, 0x00, 0x00,
-    0xFF, 0xF4, 0x3F, 0x80, 0x00, 0xBF, 0xFD, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x43, 0xFC, 0x00, 0x1F,
-    0xEF, 0xE0, 0xFF, 0x00, 0x0F, 0xF7, 0xF8, 0x3F, 0xC0, 0x07, 0xF8, 0xFE, 0x0F, 0xF0, 0x03, 0xFC,
-    0x7F, 0xC3, 0xFC, 0x01, 0xFE, 0x1F, 0xF0, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0x7F, 0x81,
-    0xFF, 0x0B, 0xF4, 0x3F, 0xC0, 0x7F, 0xC2, 0xFD, 0x1F, 0xE0, 0x1F, 0xF0, 0xBF, 0x8F, 0xF0, 0x07,
-    0xFD, 0x2F, 0xE7, 0xF8, 0x01, 0xFF, 0x47, 0xFA, 0xFC, 0x00, 0x7F, 0xD1, 0xFF, 0xFF, 0x00, 0x1F,
-    0xF8, 0x7F, 0xFF, 0x40, 0x07, 0xFE, 0x1F, 0xFF, 0xC0, 0x01, 0xFF, 0x83, 0xFF, 0xD0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x40, 0x0A, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x0B, 0xF8, 0xBC, 0x00, 0x0F, 0xFC, 0xBC, 0x00,
-    0x3F, 0x7C, 0xBC, 0x00, 0x7D, 0x7C, 0xBC, 0x00, 0xF8, 0x7C, 0xBC, 0x02, 0xF0, 0xBC, 0xBC, 0x07,
-    0xD0, 0xBC, 0xBC, 0x0F, 0xC0, 0xBC, 0xBC, 0x2F, 0x00, 0xBC, 0xBC, 0x7E, 0x00, 0xFC, 0xBC, 0xFC,
-    0x00, 0xFC, 0xBE, 0xF4, 0x00, 0xFC, 0xBF, 0xE0, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0xFC, 0xBF, 0x40,
-    0x00, 0xFC, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x7F,
-    0x80, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xC1, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x3F, 0x80, 0x00, 0x2F, 0xFC, 0x0F, 0xE0, 0x00, 0x0F, 0xFF, 0x43, 0xF8, 0x00, 0x0B, 0xFF,
-    0xD0, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xC0, 0x02, 0xFE, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x7F,
-    0x83, 0xFC, 0x00, 0xBF, 0x5F, 0xE0, 0xFF, 0x00, 0x3F, 0xC7, 0xFC, 0x3F, 0xC0, 0x1F, 0xE1, 0xFF,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x7F, 0xC2, 0xFD, 0x07, 0xF8, 0x1F, 0xF0, 0xBF, 0x43, 0xFC, 0x07, 0xFC,
-    0x2F, 0xD1, 0xFE, 0x01, 0xFF, 0x0B, 0xF8, 0xFF, 0x00, 0x7F, 0xD2, 0xFE, 0x7F, 0x80, 0x1F, 0xF4,
-    0x7F, 0xBF, 0xC0, 0x07, 0xFD, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0x87, 0xFF, 0xF4, 0x00, 0x7F, 0xE1,
-    0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xC0,
-    0x0F, 0xD0, 0x0F, 0xC0, 0x0F, 0xD0, 0x1F, 0xD0, 0x1F, 0xE0, 0x1F, 0xD0, 0x2F, 0xE0, 0x2F, 0xE0,
-    0x2F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x0B, 0xF8, 0xBC, 0x00, 0x0F, 0xFC, 0xBC, 0x00, 0x3F, 0x7C,
-    0xBC, 0x00, 0x7D, 0x7C, 0xBC, 0x00, 0xF8, 0x7C, 0xBC, 0x02, 0xF0, 0xBC, 0xBC, 0x07, 0xD0, 0xBC,
-    0xBC, 0x0F, 0xC0, 0xBC, 0xBC, 0x2F, 0x00, 0xBC, 0xBC, 0x7E, 0x00, 0xFC, 0xBC, 0xFC, 0x00, 0xFC,
-    0xBE, 0xF4, 0x00, 0xFC, 0xBF, 0xE0, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0xFC,
-    0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x01, 0xFE, 0x01, 0xFD,
-    0x00, 0x00, 0x0B, 0xF8, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x82, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x3F, 0x80, 0x3F, 0x80, 0xFE, 0x00, 0xFE, 0x07,
-    0xFC, 0x07, 0xFC, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xF8, 0x07,
-    0xF0, 0x1F, 0x40, 0x03, 0xF0, 0xFC, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x3F,
-    0xBC, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0xFE, 0x3F,
-    0xFA, 0xAF, 0xF4, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x6F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFE, 0x56, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x00,
-    0x7F, 0x42, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0x4F, 0xFB, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFE, 0x00, 0x00, 0x01,
-    0xFD, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0x00, 0x1F,
-    0xF0, 0x7F, 0xF4, 0x00, 0x6F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE,
-    0xAF, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xBD, 0x7D, 0x00,
-    0x00, 0x7E, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xA9, 0xBE, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0,
-    0x00, 0x0B, 0xF4, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x56, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x07,
-    0xF8, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x80, 0x00, 0x00, 0x7F, 0x4F, 0xFB, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFE,
-    0x00, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC2, 0xFE,
-    0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xF4, 0x00, 0x6F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x0F, 0xE0, 0x0F,
-    0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xAF,
-    0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0xBD, 0x7D, 0x00, 0x00,
-    0x7E, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xA9, 0xBE, 0x7E, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0xFD, 0x3F, 0xE5, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFE, 0x01, 0xBF,
-    0x80, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x01, 0xFC,
-    0x1A, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x6A, 0x90, 0x00,
-    0x07, 0xFE, 0x7F, 0xFE, 0xA6, 0xBF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xE8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x1F, 0xFB, 0xFF, 0x40, 0x2D, 0x00, 0x1F,
-    0xD0, 0x10, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x14, 0x00, 0x03, 0xF8, 0x2E, 0x50, 0x6F, 0xF0, 0x2F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0x40, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0xBF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x69, 0x7E, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x01,
-    0xFC, 0x0F, 0xD0, 0x02, 0xF8, 0x07, 0xF0, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF0, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x03, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00,
-    0xBD, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF,
-    0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x6F, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x2F, 0x90, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x14, 0xBD, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0xFC, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x0B, 0xF0, 0x03, 0xF4, 0x03, 0xF4, 0x03,
-    0xF0, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0xBF, 0x0F, 0xD0, 0x00, 0x3F, 0xDF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0xBD, 0x0F, 0xD0, 0x00,
-    0xFC, 0x07, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xFE, 0x03,
-    0xF0, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x6F, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0x90, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x15, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x7F,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x00,
-    0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x0B, 0xD0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x2F, 0xD0, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0xD1, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x90, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x7F, 0x40, 0x7F, 0x02, 0xFD, 0x02, 0xFD, 0x0F,
-    0xF8, 0x0F, 0xF4, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x52, 0xF0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00,
-    0x3D, 0xBC, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x7E,
-    0xBC, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x0B, 0xEB, 0xC0, 0x00, 0x3F, 0x9F, 0x80, 0x02, 0xFE, 0x3F,
-    0x80, 0x2F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xEF, 0xC0, 0xFF, 0xF8, 0x7F, 0x00, 0x15,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x80, 0x1F, 0x43, 0xFC, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC3,
-    0xFC, 0x03, 0xFC, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x07, 0x40, 0x0B, 0x00, 0x74, 0x00, 0xB0, 0x07,
-    0x40, 0x0B, 0x40, 0x74, 0x00, 0xB4, 0x07, 0x40, 0x0B, 0x40, 0x74, 0x00, 0xF4, 0x07, 0xC0, 0x1F,
-    0x40, 0x3E, 0x5B, 0xF4, 0x02, 0xFF, 0xFF, 0x40, 0x07, 0xF8, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0xFF, 0xFF,
-    0xE3, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40,
-    0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0xA0, 0x00, 0x02, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xFF, 0xF9,
-    0x00, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0xF8, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0xC3, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xFC, 0x3F,
-    0x00, 0x00, 0xF4, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x1F,
-    0x40, 0x00, 0xFF, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xF4, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xD3, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x8F, 0xFF,
-    0xFA, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00,
-    0xFE, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3C, 0xBE, 0x00, 0x00, 0x00,
-    0x3C, 0xBE, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x7C,
-    0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7F, 0xFF, 0xE4, 0x00, 0x7C, 0x7F, 0xAA, 0xBF, 0x00, 0x7C, 0x3E,
-    0x00, 0x0B, 0xC0, 0x7C, 0x3E, 0x00, 0x03, 0xD0, 0x7D, 0x3F, 0x00, 0x02, 0xE0, 0x7D, 0x3F, 0x00,
-    0x03, 0xE0, 0xBD, 0x3F, 0x00, 0x1F, 0xD0, 0xBD, 0x3F, 0xFF, 0xFF, 0xC0, 0xBD, 0x3F, 0xFF, 0xFF,
-    0x40, 0xBD, 0x3F, 0xFF, 0xE4, 0x00, 0xBD, 0x0A, 0x80, 0x00, 0x00, 0x06, 0x90, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xFB, 0xD0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x07, 0xF8, 0x10, 0x0F, 0xE0, 0x02, 0xFF, 0xF4,
-    0x3F, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x1D, 0x3C, 0x00, 0x2E, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D,
-    0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x2D, 0x3C, 0x00, 0x3D, 0x3C,
-    0x00, 0x3C, 0x7C, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00,
-    0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C,
-    0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xE0,
-    0x3F, 0xE0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x0F, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xE0, 0x3F, 0xE0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x0B, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0x40, 0xFF, 0x87, 0xFD, 0x03, 0xFE, 0x0F,
-    0xF8, 0x0B, 0xFC, 0x2F, 0xE0, 0x1F, 0xF0, 0x7F, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x83, 0xFD,
-    0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x3F, 0xE0, 0xFF, 0x80,
-    0xFF, 0x43, 0xFD, 0x03, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x7F, 0xC0, 0xBF, 0x82, 0xFE, 0x03, 0xFD,
-    0x0F, 0xF4, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0F, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE1,
-    0xFF, 0x80, 0xFF, 0xC3, 0xFF, 0x02, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x3F, 0xD0, 0xFF, 0x40, 0xBF, 0xC2, 0xFE, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x6F, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF9, 0x55, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x5F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x95, 0x54, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x96, 0x40, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x15, 0x5F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xAA, 0xAA, 0xAA, 0x40,
-    0x00, 0x00, 0x64, 0x00, 0xBE, 0x00, 0xBF, 0xE0, 0xBF, 0xFC, 0xBF, 0xF4, 0xBF, 0x40, 0xB4, 0x00,
-    0x00, 0x00, 0x1F, 0x43, 0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0xC0, 0x1F, 0x43, 0xF8, 0x3F, 0xC3, 0xFC,
-    0x7F, 0xC0, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x2F, 0x43, 0xF8, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFD,
-    0x00, 0xBF, 0xC0, 0xBD, 0xBD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x09,
-    0x80, 0x00, 0x0F, 0x02, 0x45, 0x00, 0x01, 0xE0, 0x30, 0x30, 0x00, 0x3C, 0x03, 0x33, 0x00, 0x0B,
-    0x80, 0x33, 0x30, 0x00, 0xF0, 0x03, 0x47, 0x00, 0x3D, 0x00, 0x3F, 0xE0, 0x07, 0xC0, 0x00, 0xF8,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x40, 0x00, 0x00, 0x7D, 0x21, 0x08, 0x40, 0x0F, 0x86, 0x48, 0x92,
-    0x02, 0xF0, 0x58, 0x9A, 0x20, 0x3E, 0x06, 0x19, 0x82, 0x0F, 0xC0, 0x3B, 0x4E, 0xE1, 0xF4, 0x01,
-    0xE0, 0x7C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x3F, 0xE0, 0xFF,
-    0x80, 0xFF, 0x43, 0xFD, 0x03, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x7F, 0xC0, 0xBF, 0x82, 0xFE, 0x03,
-    0xFD, 0x0F, 0xF4, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x03, 0x40, 0x09, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x7F, 0x00, 0xFD, 0x01, 0xFC,
-    0x03, 0xF4, 0x07, 0xE0, 0x0F, 0xC0, 0x2F, 0x40, 0x3F, 0x00, 0x7D, 0x00, 0xF8, 0x02, 0xF0, 0x03,
-    0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x6C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x3F, 0x03, 0xF4, 0x01, 0xF8, 0x1F, 0xC0, 0x0B,
-    0xD0, 0xBD, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xF4, 0x0F, 0x40, 0x06, 0xC0, 0x6C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xB0, 0x00, 0x90, 0x03, 0xF0, 0x0F, 0xD0,
-    0x0F, 0xC0, 0x0B, 0xE0, 0x1F, 0xC0, 0x2F, 0x80, 0x0B, 0xD0, 0x1F, 0x80, 0x3F, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x2C, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xEB, 0x80, 0x0B, 0xC3,
-    0xF0, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x2F, 0x00, 0xFD, 0x03, 0xF0, 0x1F, 0xC0,
-    0x3E, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x2C, 0x00, 0x08,
-    0x00, 0x00, 0xA0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0xFE,
-    0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x00, 0x3C, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0xFD, 0x00, 0x0A, 0xA0, 0x02, 0xFE, 0x00, 0x1F, 0xE0,
-    0x03, 0xFC, 0x00, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x3F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x00, 0x01, 0xFC,
-    0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xF0, 0x2F, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0x43, 0xFC, 0x00,
-    0x0F, 0xFF, 0x40, 0x07, 0xF4, 0x3F, 0xD0, 0x00, 0xFF, 0xF4, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x3F,
-    0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x80,
-    0x0B, 0xFF, 0xD0, 0x3F, 0x40, 0x3F, 0xFE, 0x01, 0xFF, 0xF8, 0x03, 0xF4, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF,
-    0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x1F, 0xFC, 0xBF, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x17, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x3F, 0x93, 0xFF, 0xF4, 0x1D, 0x03, 0xF3, 0xFC, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x03, 0xF0,
-    0xBE, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x03, 0xF0,
-    0xFD, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x0E, 0x74, 0x00,
-    0x1D, 0x3D, 0x00, 0x7C, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x0C, 0x2C, 0x00, 0x00, 0x1B, 0xBB, 0x80, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xCD, 0x7C, 0x00, 0x00, 0x08,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x04, 0x00, 0x02, 0x40, 0x00, 0xB0, 0x00, 0x0D, 0x04, 0x91,
-    0xC3, 0x5E, 0x34, 0xB2, 0xEB, 0x78, 0x1F, 0xFE, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x02, 0xFE, 0x00,
-    0xBE, 0xF4, 0xB9, 0xCB, 0x8F, 0x28, 0xB1, 0x47, 0x04, 0x10, 0xA0, 0x00, 0x1C, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x7F, 0xEB, 0xFF, 0xC0, 0x3F, 0xEB, 0xFF, 0xC0, 0x3F, 0x40, 0x0B, 0xF8, 0x2F, 0x40,
-    0x0B, 0xFC, 0x03, 0x00, 0x00, 0xBF, 0x03, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0x90, 0x6F, 0xF4, 0x02, 0xE1, 0xD0, 0x00, 0x3F, 0xC0, 0x3E, 0x04, 0x00, 0x00, 0xFD, 0x03,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xE0,
-    0x3E, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x00, 0x01, 0xFC,
-    0x07, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xE0, 0x00, 0x02, 0xFD,
-    0x00, 0xBE, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0xBE, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xE0, 0x02, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x2F,
-    0xD0, 0x00, 0x0A, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0xFD, 0x00, 0x07, 0xFD, 0x00,
-    0x1F, 0xE0, 0x00, 0x7F, 0xE0, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x00, 0x01, 0x3C, 0x00, 0x0B,
-    0xF4, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x01, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0x00,
-    0x1F, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x01,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x02,
-    0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0x7F, 0xF0, 0x03, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x03, 0xF4, 0x0F, 0x80, 0x00, 0xFD, 0x03, 0xD0, 0x00, 0x7F, 0x81, 0xF0, 0x00, 0x2F, 0xE0, 0xBC,
-    0x00, 0x0B, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xF0, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x03, 0xE0, 0xFF,
-    0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x24, 0x70, 0x70, 0x28, 0xA2, 0x1C, 0xE3, 0x4C, 0xE3,
-    0x1C, 0xF0, 0x2C, 0xB0, 0x3C, 0x7E, 0xF8, 0x3F, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x02,
-    0xD0, 0x07, 0xA0, 0x0D, 0xA0, 0x38, 0xA0, 0xB4, 0xF4, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0xF0, 0x00,
-    0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x60, 0x00, 0xA0, 0x00, 0xB0, 0x00, 0xBF, 0xD0, 0x10, 0x78, 0x00,
-    0x2C, 0x00, 0x2C, 0x65, 0xBC, 0xBF, 0xF4, 0x7F, 0xD0, 0x07, 0xF8, 0x2D, 0x00, 0x30, 0x00, 0xA0,
-    0x00, 0xAF, 0xE0, 0xF8, 0x3C, 0xF0, 0x1C, 0xB0, 0x0D, 0x74, 0x2C, 0x3F, 0xF8, 0x0B, 0xD0, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xB4, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x03, 0x42, 0x80, 0xC0, 0x70,
-    0x30, 0x1C, 0x0B, 0x5D, 0x00, 0xFE, 0x00, 0xE0, 0xF0, 0xB0, 0x0D, 0x3C, 0x03, 0x47, 0xDB, 0xC0,
-    0x7F, 0x80, 0x0B, 0xD0, 0x34, 0x78, 0xA0, 0x2C, 0xE0, 0x1D, 0xA0, 0x1D, 0x74, 0x2E, 0x2F, 0xFE,
-    0x01, 0x4D, 0x00, 0x1D, 0x3F, 0xFC, 0x3F, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x1F, 0x2F, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xE0, 0x2F, 0xD0, 0x03, 0xF0, 0x2F, 0xC0, 0x02, 0xF4,
-    0x3F, 0x40, 0x01, 0xF4, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x3F, 0x40, 0x01, 0xFC,
-    0x3F, 0x40, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC,
-    0x7F, 0x80, 0x02, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0xC0, 0x02, 0xFD, 0x01, 0xBE, 0x00, 0x2C,
-    0x0B, 0x01, 0xC0, 0x0E, 0x0F, 0x00, 0x2C, 0x38, 0x34, 0x75, 0xE1, 0xE1, 0xD7, 0x87, 0x87, 0x9F,
-    0x0D, 0x2E, 0x7C, 0x00, 0xB4, 0xF0, 0x03, 0xD3, 0xF0, 0x2F, 0x0F, 0xFB, 0xFC, 0x1F, 0xFF, 0xE0,
-    0x2F, 0xFF, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xB0, 0x01, 0xC0, 0x07, 0x00, 0x1C,
-    0x00, 0xB0, 0x02, 0xC0, 0x0B, 0x00, 0x2C, 0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x90,
-    0x78, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0xB8, 0x02, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0xBF,
-    0xFC, 0xBF, 0xFD, 0x2F, 0xD0, 0x00, 0x28, 0x00, 0x0C, 0x00, 0x28, 0x0F, 0xE0, 0x00, 0xB4, 0x00,
-    0x2C, 0x00, 0x1C, 0x10, 0x7C, 0xBF, 0xF8, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0xE0, 0x02, 0xA0, 0x06,
-    0x60, 0x0C, 0xB0, 0x34, 0xB0, 0xBF, 0xF4, 0xBF, 0xFD, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00,
-    0x01, 0xFF, 0xCA, 0x00, 0x28, 0x00, 0xA0, 0x02, 0xFF, 0x40, 0x07, 0x40, 0x0E, 0x00, 0x7A, 0xFF,
-    0xCB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x2C, 0x00, 0x30, 0x00, 0xB0, 0x00, 0xBF, 0xF0,
-    0xF8, 0x2C, 0xB0, 0x0D, 0xB0, 0x0D, 0x78, 0x2C, 0x3F, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x1C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x74, 0x00, 0xB4, 0x00, 0xF0, 0x01, 0xF0,
-    0x02, 0xF0, 0x02, 0xE0, 0x02, 0xF8, 0x03, 0x01, 0xC0, 0xC0, 0x30, 0x38, 0x2C, 0x03, 0xFC, 0x02,
-    0xD7, 0x81, 0xC0, 0x34, 0xF0, 0x0E, 0x2E, 0x0B, 0x83, 0xFF, 0x80, 0x05, 0x00, 0x1F, 0xE0, 0x34,
-    0x38, 0xA0, 0x1C, 0xE0, 0x1D, 0xA0, 0x1D, 0x79, 0x7D, 0x1F, 0xFD, 0x00, 0x0D, 0x00, 0x2C, 0x3F,
-    0xFC, 0x3F, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00,
-    0x0F, 0x80, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xF8,
-    0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0x00, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00,
-    0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
-    0x00, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0xFC,
-    0x00, 0x2F, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00,
-    0xFC, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x1A, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x07, 0xD0,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF9,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x97, 0xF8, 0x00,
-    0x3F, 0xFD, 0x07, 0xC0, 0x00, 0xFF, 0xFC, 0x0B, 0xC0, 0x01, 0xFF, 0xFC, 0x0F, 0x80, 0x03, 0xFC,
-    0xF8, 0x0F, 0x40, 0x07, 0xF8, 0xF4, 0x1F, 0x00, 0x0B, 0xF1, 0xF0, 0x2F, 0x00, 0x0F, 0xF3, 0xF0,
-    0x3E, 0x00, 0x0F, 0xE3, 0xE0, 0x3D, 0x00, 0x1F, 0xE7, 0xD0, 0x7C, 0x00, 0x1F, 0xEB, 0xC0, 0xBC,
-    0x00, 0x1F, 0xFF, 0xC0, 0xF8, 0x00, 0x1F, 0xFF, 0x41, 0xF4, 0x00, 0x1F, 0xFF, 0x02, 0xF0, 0x00,
-    0x0F, 0xFF, 0x43, 0xF0, 0x00, 0x0F, 0xFF, 0xFB, 0xE5, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x01, 0xF6, 0xFF, 0xFF, 0xA4, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x3D,
-    0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00,
-    0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9,
-    0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x95, 0x68, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x14, 0x14, 0x1F, 0xE0, 0x00, 0x7E, 0xFC, 0x1F, 0xE0, 0x00, 0x7F,
-    0xFD, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x1F, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0xFC, 0x00, 0x7C, 0x00,
-    0x0F, 0xFF, 0x80, 0x7C, 0x00, 0x0F, 0xFF, 0xFE, 0xBE, 0xBE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xE0, 0x1B, 0xF0, 0x0F, 0xE0, 0x00, 0x09, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1A, 0xFF, 0xAA, 0xA4, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x90, 0xBF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x01, 0xFD, 0x00, 0x00, 0x3F, 0xBF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xAF, 0xD0, 0x02, 0xFD,
-    0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x8B, 0xF4, 0x02, 0xFD, 0x00, 0x00,
-    0x7F, 0x83, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2A, 0xFF, 0xEA, 0xFF, 0xAB, 0xFE, 0xA9, 0x00, 0xFF, 0xC0, 0x3F, 0xC3,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xE7, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0xBF,
-    0x80, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0x55, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0x51, 0x40, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xF4, 0x0B, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0x00,
-    0x1F, 0x40, 0x00, 0x1F, 0xFD, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x01, 0xF5, 0xFD, 0x00, 0x7F, 0x00, 0x03, 0x90, 0xBD, 0x7F, 0x40, 0x1F, 0xD0, 0x02,
-    0xFF, 0xFF, 0x6F, 0xD0, 0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0xCB, 0xF4, 0x02, 0xFF, 0x00, 0x7F, 0xFF,
-    0xE2, 0xFD, 0x00, 0xBF, 0xC0, 0x06, 0xFF, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00,
-    0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xD0,
-    0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x01, 0x00, 0x2E, 0x00, 0x2E,
-    0x00, 0xB8, 0x03, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0x43, 0xFE, 0x0B, 0xC0, 0x00, 0xF4, 0x7F, 0xF0, 0xBC, 0x00,
-    0x0F, 0x8B, 0xDF, 0x4F, 0x80, 0x00, 0xBC, 0xFC, 0xF8, 0xF4, 0x00, 0x0B, 0xDF, 0xCF, 0xCF, 0x40,
-    0x00, 0x7E, 0xF8, 0xBE, 0xF0, 0x00, 0x07, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFA, 0x94, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3E, 0x7F, 0xD0, 0x6F, 0xF0, 0x00, 0xF9, 0xFC, 0x00, 0x0B, 0xF0, 0x03, 0xE7, 0xE0,
-    0x00, 0x0B, 0xC0, 0x0F, 0x9F, 0x40, 0x00, 0x0F, 0x40, 0x3E, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0xF9,
-    0xF4, 0x05, 0x00, 0xB8, 0x03, 0xE7, 0xD0, 0x2F, 0x02, 0xE0, 0x0F, 0x9F, 0x40, 0xBC, 0x0B, 0xC0,
-    0x3E, 0x7D, 0x02, 0xF0, 0x2F, 0x00, 0xF9, 0xF4, 0x0B, 0xC0, 0xBC, 0x03, 0xE7, 0xD0, 0x2F, 0x00,
-    0x50, 0x1F, 0x9F, 0x40, 0x7C, 0x00, 0x00, 0x7E, 0x7D, 0x01, 0xF0, 0x00, 0x01, 0xF9, 0xF4, 0x03,
-    0xE0, 0x00, 0x07, 0xE7, 0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0x9F, 0x40, 0x0F, 0xF9, 0x07, 0xFE, 0x7C,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16, 0xAF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x15, 0x6E, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x02, 0xFD, 0x2D, 0x00, 0x00, 0x3F, 0xFD, 0xB4, 0x00, 0x03, 0xFA, 0xFF, 0xD0,
-    0x00, 0x2E, 0x00, 0xBF, 0x40, 0x00, 0xF0, 0x00, 0xFD, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x00, 0x2E,
-    0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFE, 0x29, 0x00,
-    0x55, 0x55, 0x55, 0x54, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x0F, 0xF9, 0x01, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x50, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x10, 0x00, 0x00, 0x00, 0xFE, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x87, 0x40, 0x00, 0x04, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0x4B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFA, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xEA,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0xFF, 0x40, 0x07, 0xFF, 0x42, 0xD0, 0x05, 0x00, 0x3F,
-    0xF0, 0x0B, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xB4, 0x00, 0x00,
-    0x3F, 0xC0, 0x02, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x2D, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0xB4, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x0B,
-    0x94, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x5F, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x3F, 0xC0,
-    0x03, 0xC0, 0x6F, 0xFC, 0xFF, 0x40, 0x0F, 0x00, 0x3F, 0x53, 0xFF, 0x00, 0x3C, 0x00, 0xFC, 0x0B,
-    0xFF, 0x00, 0xF0, 0x07, 0xF0, 0x1F, 0xFF, 0xE7, 0xD6, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x56, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x6F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x40,
-    0x00, 0x3F, 0xFF, 0xEA, 0xAB, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xAC, 0x02, 0xFC, 0xB4, 0x00, 0x3F, 0x0B, 0x40, 0x07, 0xF0,
-    0xB4, 0x00, 0x7E, 0x0B, 0x40, 0x07, 0xD0, 0xB4, 0x00, 0xBD, 0x0B, 0x40, 0x07, 0xE0, 0x78, 0x00,
-    0x7F, 0x07, 0x80, 0x03, 0xFC, 0x78, 0x00, 0x2F, 0xFF, 0xE8, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA,
-    0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0xBF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF,
-    0xFD, 0x00, 0x05, 0x5B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF4,
-    0x0A, 0x00, 0x01, 0xF5, 0xBE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0xBF, 0xF4, 0x01, 0x00, 0xA5, 0xF4, 0x6E, 0x00, 0x01, 0xFB, 0xFE, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x3E, 0xBA, 0xF4, 0x00, 0x7C, 0x41, 0xF4,
-    0x02, 0xF8, 0x01, 0xF4, 0x1F, 0xE0, 0x01, 0xFA, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0xF2, 0xFC, 0x00, 0x3F,
-    0x0F, 0x0F, 0xD0, 0x07, 0xE0, 0xF0, 0x7E, 0x00, 0xBC, 0x0F, 0x03, 0xE0, 0x0B, 0xC0, 0xF0, 0x2E,
-    0x00, 0xBC, 0x0F, 0x02, 0xF0, 0x0B, 0x80, 0xF0, 0x2F, 0x00, 0xB8, 0x0F, 0x02, 0xE0, 0x0B, 0x80,
-    0xF0, 0x2E, 0x00, 0xB8, 0x0F, 0x02, 0xE0, 0x0B, 0x80, 0xF0, 0x2E, 0x00, 0xBC, 0x0F, 0x02, 0xE0,
-    0x07, 0xC0, 0xF0, 0x2E, 0x00, 0x7C, 0x0F, 0x03, 0xE0, 0x07, 0xD0, 0xF0, 0x3E, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xFF, 0xFC, 0x00,
-    0x00, 0xBE, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0B,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0xA9, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xCF, 0x5F, 0xC0, 0x07, 0xE0, 0xF4, 0x3F, 0x02, 0xF8,
-    0x0F, 0x40, 0xFD, 0x7D, 0x00, 0xF4, 0x03, 0xD2, 0x40, 0x0F, 0x40, 0x04, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x14, 0x00, 0xF4, 0x00, 0x47, 0xD0, 0x0F, 0x40, 0x3D, 0x2F, 0x80,
-    0xF4, 0x0F, 0xD0, 0xBE, 0x0F, 0x43, 0xF0, 0x01, 0xFC, 0xF5, 0xFC, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xB0, 0x00, 0x00, 0x3E, 0x00,
-    0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x2E,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00,
-    0x0C, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xF7, 0xAF, 0x00, 0x3E, 0x0E, 0x2F,
-    0x03, 0xE0, 0x38, 0x1F, 0x4D, 0x00, 0xE0, 0x1D, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00,
-    0x38, 0x00, 0x1F, 0x00, 0xE0, 0x1D, 0x2F, 0x43, 0x81, 0xF4, 0x2F, 0x4E, 0x2F, 0x00, 0x1F, 0xBA,
-    0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0xAB, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xA9, 0x50, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xF3, 0xF4, 0x00, 0x07, 0xC3, 0xF4, 0x00, 0x1F, 0x03, 0xF4, 0x00, 0x78,
-    0x03, 0xF4, 0x01, 0xE0, 0x03, 0xF4, 0x0B, 0x80, 0x03, 0xF4, 0x2E, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x02, 0x00, 0x1F, 0xA9, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x56, 0xAF,
-    0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0xBD, 0x1F,
-    0x00, 0x0B, 0xD0, 0x3C, 0x00, 0xBD, 0x00, 0xF0, 0x0B, 0xD0, 0x03, 0xC0, 0xBD, 0x00, 0x0F, 0x0B,
-    0xD0, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x0A, 0x03, 0xF0, 0x00, 0x3C, 0x07, 0xE0, 0x00, 0xF0, 0x07, 0xE0,
-    0x07, 0xC0, 0x0B, 0xD0, 0x2E, 0x00, 0x0B, 0xD0, 0xB4, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x0F, 0xCF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0B, 0xC6, 0x40, 0x00, 0x7E, 0x2E,
-    0x00, 0x07, 0xE0, 0x7C, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0x0F, 0x02,
-    0xF0, 0x00, 0x3D, 0x2F, 0x40, 0x00, 0xB9, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xD5, 0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x7F, 0x55, 0x55, 0x55, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x03, 0xFB,
-    0x80, 0xEB, 0xD0, 0x00, 0x2F, 0x8E, 0x03, 0x8B, 0xD0, 0x02, 0xF8, 0x38, 0x0E, 0x0B, 0xD0, 0x2F,
-    0x80, 0xE0, 0x38, 0x0B, 0xD1, 0xF8, 0x03, 0x80, 0xE0, 0x0B, 0xC3, 0x80, 0x0E, 0x03, 0x80, 0x08,
-    0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0,
-    0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x38, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x55,
-    0x55, 0x55, 0x5F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0x55,
-    0x55, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x90, 0x24, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00,
-    0x00, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x02, 0x40, 0x0E, 0x03, 0x80, 0x04, 0x1F, 0x40, 0x38,
-    0x0E, 0x00, 0x78, 0x3F, 0x40, 0xE0, 0x38, 0x07, 0xF0, 0x3F, 0x43, 0x80, 0xE0, 0x7F, 0x00, 0x3F,
-    0x4E, 0x03, 0x87, 0xE0, 0x00, 0x3F, 0x38, 0x0E, 0x3E, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xE0, 0x00,
-    0x00, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xF5, 0x55, 0x55, 0x5B, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFD, 0x55, 0x55, 0x7F,
-    0x80, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xEF,
-    0xD0, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0xD7, 0xF8,
-    0x1F, 0xEB, 0x03, 0x43, 0xFC, 0x0E, 0x1C, 0x0D, 0x03, 0xC0, 0x00, 0x70, 0x34, 0x00, 0x00, 0x01,
-    0xC0, 0xD0, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x00, 0x1C, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x34,
-    0x00, 0x00, 0x01, 0xC0, 0xD0, 0x00, 0x01, 0x07, 0x03, 0x40, 0x50, 0x3F, 0x5C, 0x0D, 0x0B, 0xE0,
-    0xBF, 0xF0, 0x34, 0xFF, 0x40, 0x7F, 0xC0, 0xEF, 0xD0, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x2F,
-    0x6F, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xFF, 0xF0, 0x2D, 0x0B, 0xFF, 0xFC, 0x3D, 0x1F, 0xE0, 0x2F,
-    0x3C, 0x3F, 0x40, 0x0B, 0xBC, 0x7E, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x01,
-    0xF4, 0xBD, 0x00, 0x01, 0xF0, 0xBF, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x0B, 0xD0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xFF, 0xEF, 0xFF, 0xD3, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xE0, 0xFE, 0x00, 0x07, 0xF0, 0x00,
-    0x07, 0xE0, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xE0,
-    0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0xBE, 0x00, 0x07, 0xF4, 0x07, 0xD0, 0x00, 0x3F,
-    0x80, 0x01, 0xFD, 0x0B, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xCB, 0xD0, 0x00, 0x0B, 0xF4, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xF5, 0x01, 0x6F, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xDF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xC0, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x47,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x02,
-    0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
-    0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x01, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFC, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x90, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x20, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xBF, 0x80,
-    0x00, 0x00, 0x0B, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x01, 0xA4, 0x00, 0x0F, 0xFF, 0xD0, 0x7F, 0xFC,
-    0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x0B, 0xE4, 0x1F, 0xAF, 0x80, 0xF4, 0x3E, 0x00, 0x0F, 0xF4,
-    0x00, 0xF1, 0xF0, 0x00, 0x1F, 0xC0, 0x02, 0xCB, 0x80, 0x00, 0x3E, 0x00, 0x07, 0x2E, 0x00, 0x00,
-    0xF8, 0x00, 0x1D, 0xB8, 0x00, 0x03, 0xF0, 0x00, 0xB1, 0xF0, 0x00, 0x1F, 0xE0, 0x0B, 0xC7, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xAF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0x80,
-    0x1F, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x06, 0xE8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x08, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x3F, 0xD7, 0xFD, 0x7F, 0xE1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xDB, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x01, 0x42, 0xFA, 0xF4, 0x00, 0xF0, 0xF8, 0x0F, 0x40, 0x7C, 0x7D, 0x01,
-    0xF4, 0x3E, 0x2F, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xC3, 0xF0, 0xBC, 0x01, 0xF0, 0xF4, 0x0B, 0xC0, 0xBC,
-    0x7D, 0x00, 0xBE, 0xFD, 0x16, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x05, 0xF4, 0x50, 0x2F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x55, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF9,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE9,
-    0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x94, 0x00, 0x15, 0xAF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x56, 0x90, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x06, 0xFF,
-    0xFF, 0xE4, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xE0, 0x1A, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x95,
-    0x00, 0x1A, 0x54, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_14_regularBitmaps[35020] = {
+    0x85, 0x55, 0x3D, 0x8F, 0xDD, 0x44, 0x14, 0xBD, 0xF6, 0x64, 0xD7, 0x42, 0x16, 0x9A, 0x14, 0xAC,
+    0x84, 0x14, 0x11, 0xFF, 0x81, 0x44, 0x6E, 0xB6, 0xA0, 0xC8, 0xBE, 0xB1, 0x84, 0x44, 0x0A, 0x0A,
+    0xB6, 0xC9, 0x3F, 0xA0, 0x41, 0x02, 0xBD, 0x86, 0x32, 0xBB, 0xB6, 0xB2, 0x12, 0xCD, 0x36, 0x8B,
+    0x90, 0x68, 0x68, 0xA8, 0xB7, 0x09, 0x45, 0x8A, 0x48, 0xD9, 0x7D, 0x1E, 0xB2, 0x45, 0x8A, 0x34,
+    0xA6, 0xDA, 0x0E, 0x4C, 0x87, 0x42, 0xC1, 0x28, 0x32, 0x8A, 0x17, 0x8D, 0x77, 0x38, 0x67, 0xFC,
+    0x36, 0xE1, 0xA3, 0xC0, 0xB2, 0x3D, 0xF6, 0x7C, 0x9C, 0xB9, 0xF7, 0xDC, 0x73, 0xEF, 0xC8, 0x77,
+    0xB9, 0x2D, 0xE5, 0x44, 0x39, 0x6D, 0x8D, 0xF8, 0xD8, 0x24, 0x3E, 0x73, 0x85, 0x6D, 0x53, 0x9F,
+    0xBB, 0xD2, 0x06, 0x85, 0x46, 0x44, 0xF2, 0xC1, 0xF4, 0xE1, 0x20, 0x14, 0xBE, 0x75, 0x75, 0xDF,
+    0x3E, 0x9B, 0x72, 0x5F, 0xDB, 0xF0, 0xCC, 0xEB, 0xB1, 0x6E, 0xC2, 0x47, 0xA3, 0x1E, 0x5A, 0x34,
+    0x5E, 0x0F, 0x12, 0xAF, 0x42, 0xF2, 0x86, 0x6B, 0xAC, 0xEA, 0xD1, 0x28, 0x27, 0x23, 0x7B, 0x47,
+    0xD9, 0x61, 0xB3, 0x90, 0xA2, 0xE2, 0x9C, 0x26, 0xEB, 0xD0, 0x64, 0x5D, 0x0A, 0xF8, 0x3A, 0xF0,
+    0xBA, 0x2C, 0x63, 0x13, 0x3E, 0x3C, 0x6E, 0x8F, 0x1F, 0xBE, 0x38, 0x6E, 0x44, 0x5B, 0xE5, 0x22,
+    0x40, 0x42, 0x80, 0xC4, 0xCB, 0x3E, 0x01, 0x5A, 0x29, 0x89, 0x5E, 0x36, 0x39, 0x01, 0x74, 0xAF,
+    0xB0, 0xAB, 0x99, 0x57, 0xEA, 0xB9, 0xF9, 0xF2, 0x0A, 0xA0, 0xE8, 0xB2, 0x68, 0xBC, 0x4B, 0x3D,
+    0x71, 0x3C, 0xD6, 0xE2, 0x0A, 0x62, 0x2C, 0x1A, 0x63, 0x35, 0xCD, 0xDB, 0xD8, 0x4D, 0x76, 0xA3,
+    0xD5, 0x6F, 0x6D, 0xF0, 0x9D, 0x3D, 0x25, 0x6A, 0xE2, 0x1E, 0xF1, 0x1D, 0xC2, 0xAF, 0x58, 0x0D,
+    0xC4, 0xF9, 0xDD, 0x48, 0x16, 0x2E, 0xFE, 0x38, 0x12, 0x15, 0x4E, 0x6E, 0x13, 0xA7, 0xC8, 0xE1,
+    0x49, 0x7D, 0x97, 0x2B, 0x8A, 0x1F, 0xB9, 0x42, 0xF9, 0xFB, 0x71, 0x20, 0x70, 0x00, 0xC6, 0xF4,
+    0xF1, 0x27, 0x1C, 0x89, 0x6C, 0xC2, 0x3D, 0x5A, 0xBB, 0x0C, 0xB0, 0x56, 0x3D, 0x25, 0xA2, 0xB8,
+    0x27, 0x01, 0xD6, 0xDD, 0xB9, 0x1D, 0x26, 0x0C, 0xE4, 0x75, 0xA8, 0x16, 0xDF, 0x9E, 0x87, 0x60,
+    0x23, 0x0B, 0xAE, 0x78, 0xF3, 0x1E, 0xB8, 0x37, 0xB0, 0x6E, 0x00, 0x83, 0xD4, 0xDD, 0xE1, 0x1E,
+    0x58, 0xC1, 0x6F, 0xF5, 0xA0, 0x93, 0x7F, 0x5D, 0x8A, 0xCE, 0xDD, 0x92, 0x2D, 0x49, 0xFA, 0x3C,
+    0x88, 0x96, 0x47, 0x85, 0x3C, 0x56, 0xCD, 0x7B, 0xCA, 0xBE, 0x2D, 0xDB, 0x3B, 0xF2, 0x85, 0xFC,
+    0xE2, 0x92, 0x4E, 0x7D, 0x5C, 0x29, 0xBB, 0xF3, 0x18, 0x5E, 0xBD, 0xB2, 0x78, 0x2D, 0x40, 0xC3,
+    0x57, 0x2F, 0x69, 0xC6, 0x6A, 0x25, 0xB2, 0xB2, 0xB7, 0x24, 0xFB, 0x49, 0xDE, 0x97, 0xC5, 0xB6,
+    0xF4, 0xA9, 0xEB, 0x55, 0xA3, 0x0F, 0xEC, 0x4D, 0xF1, 0xF9, 0x0B, 0x97, 0x75, 0x3A, 0x34, 0x06,
+    0x6A, 0x48, 0x87, 0x7F, 0x6E, 0xBA, 0x19, 0x60, 0x87, 0x82, 0xF5, 0x22, 0x97, 0x55, 0xCB, 0xF0,
+    0x62, 0x06, 0xEE, 0xB2, 0x42, 0xA0, 0x10, 0xA1, 0x64, 0x22, 0xF7, 0xF9, 0x50, 0x63, 0x42, 0xF9,
+    0x3B, 0x83, 0xD2, 0x32, 0xA6, 0x39, 0x79, 0x50, 0x81, 0x9F, 0xED, 0xCF, 0x60, 0xAB, 0x70, 0xA6,
+    0xD9, 0xFC, 0x9A, 0x73, 0x2F, 0x8D, 0x4D, 0x7D, 0x71, 0xEE, 0x25, 0x7B, 0xE5, 0xEB, 0x4E, 0x8A,
+    0x70, 0x17, 0x53, 0xDB, 0xDE, 0x4C, 0x52, 0x4F, 0xC9, 0x6B, 0x56, 0x0E, 0x2D, 0x18, 0xEA, 0xAE,
+    0x83, 0x9A, 0xA3, 0xB5, 0x21, 0xF5, 0xF9, 0x54, 0x3F, 0xF7, 0xED, 0xE1, 0x88, 0x9B, 0xE1, 0xB4,
+    0xD0, 0x5D, 0x21, 0x10, 0xE2, 0x7D, 0xD1, 0x4D, 0xE2, 0xA4, 0x5C, 0x7F, 0xC7, 0xFE, 0x2A, 0x8D,
+    0x1D, 0x4E, 0xCC, 0xFA, 0xD5, 0xBF, 0xFE, 0xE2, 0x40, 0x32, 0x60, 0x8D, 0x78, 0x4E, 0x3E, 0x95,
+    0x8C, 0xDD, 0xF0, 0xA8, 0xB0, 0xE8, 0xC9, 0xE3, 0x44, 0x20, 0xD8, 0x35, 0xEC, 0x62, 0xDE, 0x09,
+    0x60, 0x1D, 0x86, 0xE3, 0x86, 0x1E, 0x7F, 0x99, 0x05, 0xC6, 0x02, 0x53, 0xF0, 0x3F, 0x62, 0xC9,
+    0xFA, 0x63, 0x0F, 0x5B, 0xE7, 0x14, 0x37, 0x25, 0x5D, 0x56, 0xDA, 0x66, 0x3D, 0x90, 0x29, 0x4F,
+    0x53, 0x15, 0x90, 0x65, 0x54, 0x2D, 0x23, 0x4D, 0x95, 0xC8, 0x86, 0xB2, 0xDB, 0xFB, 0x3A, 0xEF,
+    0xDA, 0xCF, 0xB1, 0x61, 0xA8, 0xC0, 0x22, 0x94, 0x09, 0x1E, 0x3E, 0x6B, 0x0F, 0xDC, 0xF7, 0x8B,
+    0x2C, 0x85, 0xFF, 0xD4, 0x02, 0x55, 0xC1, 0xBC, 0x83, 0xDB, 0xFA, 0xEF, 0x4D, 0x1B, 0xC2, 0x6F,
+    0x54, 0x9F, 0xFE, 0xCF, 0xD8, 0x27, 0x94, 0x11, 0x72, 0x58, 0x0F, 0x85, 0x2B, 0x5C, 0xD9, 0x9B,
+    0x8E, 0xE1, 0xC1, 0xFC, 0xE7, 0x21, 0x78, 0x34, 0xB6, 0xF8, 0x60, 0x34, 0x67, 0x9E, 0x9D, 0x92,
+    0xCC, 0x64, 0x4A, 0x4A, 0x4D, 0x0F, 0x6B, 0xDB, 0x4A, 0x99, 0x81, 0xE0, 0x34, 0x52, 0x06, 0x3F,
+    0x8F, 0xF1, 0xEC, 0xC4, 0x0A, 0xC0, 0xF4, 0x17, 0xD2, 0x40, 0x16, 0x45, 0x4E, 0x98, 0x70, 0xEB,
+    0xD9, 0x84, 0x89, 0x89, 0xCD, 0x00, 0xED, 0x5D, 0xC1, 0xA0, 0x33, 0xC3, 0xEC, 0x28, 0x2C, 0x1F,
+    0xEB, 0x84, 0xC4, 0x4A, 0xA1, 0xD7, 0xB3, 0x63, 0x0D, 0x38, 0x5D, 0xC3, 0x20, 0x08, 0x8C, 0xC1,
+    0x0C, 0xC3, 0xD9, 0xAC, 0x0C, 0x66, 0x3D, 0x9B, 0xEC, 0xB1, 0xAA, 0x08, 0x4D, 0xBD, 0x1E, 0x89,
+    0x2C, 0x29, 0xC6, 0x25, 0x4C, 0xCA, 0xAC, 0xAE, 0xD2, 0x1E, 0xA1, 0x75, 0xC0, 0x1F, 0xF6, 0x55,
+    0x33, 0xEE, 0xE5, 0xD6, 0x9F, 0xE6, 0xF6, 0xE4, 0x74, 0x6E, 0xFD, 0x4A, 0x35, 0x7E, 0x85, 0x62,
+    0xD3, 0x4A, 0xEA, 0xEB, 0x4A, 0x8D, 0xC6, 0xE6, 0xA3, 0xB9, 0x58, 0x0E, 0x48, 0x4B, 0xC7, 0x94,
+    0xCE, 0xC0, 0x4B, 0xCA, 0xFC, 0x05, 0xA6, 0x5C, 0x83, 0xE0, 0xAC, 0x20, 0x8D, 0xF7, 0xBD, 0xBC,
+    0x6B, 0xE2, 0xF6, 0x34, 0xC9, 0x47, 0x2B, 0x61, 0x24, 0x4C, 0x41, 0xD9, 0x92, 0x3A, 0xFE, 0xA0,
+    0x90, 0xB2, 0x0E, 0x21, 0x0F, 0x4A, 0x0B, 0xF1, 0xFE, 0x89, 0xA0, 0x80, 0xE4, 0x87, 0x4C, 0xED,
+    0x2D, 0xF4, 0x85, 0x5E, 0x31, 0xE3, 0x8F, 0x0A, 0xB7, 0x2B, 0xBA, 0x9B, 0x7D, 0x34, 0xB3, 0x7B,
+    0xF4, 0xC8, 0x34, 0x92, 0x4E, 0xCC, 0x10, 0x49, 0xB1, 0xB9, 0x19, 0x50, 0x8B, 0x2A, 0x26, 0x91,
+    0x9E, 0x1B, 0x35, 0x97, 0x3F, 0x8F, 0x52, 0xFA, 0x12, 0x9F, 0xDD, 0x26, 0x50, 0xDB, 0x30, 0xA6,
+    0x55, 0xE4, 0x0D, 0xA6, 0x26, 0xFD, 0xCC, 0xFC, 0xCD, 0xF8, 0xBB, 0xB5, 0x6C, 0x14, 0x4A, 0x91,
+    0x66, 0xDE, 0x00, 0x92, 0xB6, 0x45, 0xEE, 0xC8, 0xE1, 0xC4, 0x0D, 0x3F, 0xBD, 0x17, 0xCE, 0x60,
+    0x20, 0x20, 0x5D, 0x0B, 0xF1, 0x2C, 0x2F, 0x59, 0x73, 0xAF, 0xAD, 0xE3, 0x8E, 0x68, 0x22, 0xA1,
+    0x45, 0xB1, 0x62, 0xE0, 0x29, 0xC1, 0x7E, 0x0D, 0x3E, 0xFD, 0x42, 0xD4, 0x80, 0x4C, 0x70, 0x10,
+    0x3A, 0x8E, 0x13, 0x53, 0x19, 0x69, 0x8F, 0xA3, 0x92, 0x68, 0x16, 0x79, 0xA8, 0xE6, 0xA7, 0xE5,
+    0xD3, 0xBC, 0x79, 0x58, 0x25, 0x2F, 0xE1, 0xC1, 0xA8, 0xAB, 0x59, 0x3F, 0xC3, 0xAC, 0xA9, 0xAB,
+    0xDF, 0x8B, 0x8A, 0xFE, 0x55, 0xC8, 0x75, 0xFB, 0x0E, 0xC8, 0x93, 0x78, 0x02, 0xD4, 0xF1, 0x48,
+    0x80, 0xE5, 0x95, 0xD4, 0x67, 0x17, 0xCB, 0x68, 0x2A, 0xB6, 0x79, 0x80, 0xD2, 0x90, 0xB4, 0x17,
+    0xB1, 0xB8, 0x90, 0x82, 0x3E, 0xBD, 0xBC, 0x57, 0x51, 0x2B, 0x94, 0x5E, 0xB9, 0x16, 0x16, 0x55,
+    0xB7, 0x57, 0x4F, 0xB2, 0x02, 0x62, 0x3B, 0x14, 0x7D, 0x8B, 0x1A, 0xD5, 0x42, 0x62, 0x88, 0x8D,
+    0x07, 0xAE, 0x37, 0x7C, 0xAA, 0xC4, 0x97, 0x5D, 0x36, 0x12, 0x17, 0x41, 0xEF, 0x50, 0x75, 0x50,
+    0xCC, 0xE2, 0x51, 0xC6, 0xD2, 0x03, 0xAF, 0x10, 0xDC, 0x7D, 0x1E, 0x61, 0x51, 0x97, 0x64, 0xCF,
+    0xC7, 0xA8, 0xA5, 0x63, 0x8C, 0x56, 0x36, 0x44, 0x47, 0xB5, 0xE3, 0x89, 0x13, 0xE3, 0x86, 0x13,
+    0xC0, 0xF4, 0x91, 0xB5, 0xD6, 0x22, 0xF1, 0xD0, 0x6F, 0xE5, 0x06, 0x3A, 0xCB, 0x6F, 0x58, 0x39,
+    0x74, 0xA5, 0xAB, 0xC4, 0x21, 0x44, 0x3B, 0x10, 0xAF, 0xAE, 0xF6, 0x00, 0xCC, 0x03, 0x30, 0x9D,
+    0x32, 0x8C, 0xA2, 0x44, 0xA6, 0x81, 0x31, 0x0F, 0x36, 0x1B, 0xD2, 0x09, 0x15, 0xB5, 0xFC, 0xC1,
+    0x43, 0x6B, 0x28, 0xD7, 0x13, 0x08, 0x31, 0x87, 0x28, 0x4C, 0x5D, 0x68, 0x4A, 0x57, 0xD2, 0x7D,
+    0x3C, 0xA8, 0xC8, 0x47, 0xF2, 0xFF, 0xD7, 0x5F, 0x85, 0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x1D,
+    0x92, 0xB1, 0x08, 0x98, 0x08, 0x56, 0x8D, 0x9A, 0x18, 0x09, 0xFF, 0x40, 0x12, 0xFE, 0x81, 0x20,
+    0xBC, 0xB8, 0x71, 0xE1, 0x46, 0x40, 0x72, 0x6A, 0x52, 0xA8, 0x4D, 0x2A, 0xE5, 0x07, 0x38, 0x58,
+    0x22, 0x29, 0x5C, 0xA4, 0x51, 0x93, 0x7F, 0xA0, 0x14, 0x76, 0xE3, 0x36, 0x45, 0xAC, 0xA5, 0xA0,
+    0xC2, 0x85, 0x0B, 0x33, 0x95, 0x0B, 0x37, 0x14, 0x6C, 0x40, 0x88, 0xD2, 0xAC, 0x63, 0x1A, 0xE0,
+    0x19, 0x24, 0x27, 0xEF, 0x2D, 0xCF, 0x96, 0x64, 0x08, 0xC9, 0x69, 0x77, 0x4E, 0x37, 0xBB, 0x3B,
+    0x1F, 0x6F, 0xDE, 0xEC, 0x8A, 0xED, 0xC4, 0xE8, 0x20, 0x63, 0x3C, 0x64, 0x75, 0xDC, 0xFF, 0x28,
+    0xC9, 0x3F, 0x5E, 0xCC, 0xB3, 0x5A, 0x8A, 0x07, 0x22, 0xEE, 0x8E, 0x44, 0x63, 0x2F, 0xD9, 0xAB,
+    0x5E, 0xEC, 0xB1, 0xAA, 0xA6, 0xAA, 0x43, 0xEC, 0x4E, 0xBD, 0x88, 0xA9, 0x45, 0xBE, 0x14, 0x89,
+    0xBB, 0x4D, 0xC9, 0xEB, 0x79, 0xA5, 0xCB, 0x55, 0xAB, 0x3D, 0x6D, 0xA5, 0x38, 0x1E, 0xCA, 0xA7,
+    0xA3, 0x3D, 0xF9, 0x46, 0xDE, 0x7D, 0xE2, 0xA1, 0x3C, 0x1E, 0xED, 0xB3, 0x09, 0x07, 0x3D, 0xFF,
+    0xF2, 0xAE, 0xE8, 0xE4, 0xD2, 0xC7, 0x0C, 0xA6, 0x37, 0x5D, 0xEE, 0x73, 0x5F, 0xB4, 0x65, 0x63,
+    0xEB, 0x59, 0xBB, 0x89, 0x19, 0xC1, 0x9D, 0x14, 0x10, 0xB1, 0x36, 0x22, 0x7B, 0xA3, 0x48, 0xCA,
+    0x7F, 0xDC, 0x4A, 0x24, 0xD3, 0x0A, 0xFF, 0xF4, 0x58, 0x77, 0x0D, 0xC5, 0xB4, 0xC0, 0x4E, 0x85,
+    0x8C, 0x9C, 0xAE, 0x78, 0x40, 0xB1, 0xB6, 0x81, 0xEC, 0x44, 0x6E, 0x50, 0xC8, 0xA7, 0x22, 0x5B,
+    0x37, 0x91, 0x84, 0x55, 0xAD, 0x2F, 0x7A, 0x8F, 0x62, 0x17, 0x94, 0x47, 0xDB, 0xB3, 0x4F, 0xF9,
+    0x9C, 0xA2, 0x78, 0x21, 0xF4, 0xB1, 0x90, 0xB5, 0x93, 0xE0, 0x4E, 0x1C, 0x22, 0x98, 0x43, 0x10,
+    0x4B, 0xA3, 0xD9, 0x40, 0x4F, 0x03, 0x7D, 0xF6, 0x98, 0xA3, 0x58, 0x46, 0xE0, 0x74, 0x7F, 0x1D,
+    0xD5, 0xC1, 0x3B, 0x2F, 0x5B, 0xDB, 0x0C, 0x69, 0x61, 0x54, 0xDB, 0xA2, 0xD9, 0xEB, 0x3E, 0x91,
+    0x84, 0xE7, 0x69, 0xEE, 0xF0, 0xBD, 0x49, 0x1D, 0xD6, 0x12, 0x78, 0xCD, 0x90, 0x79, 0x01, 0x3B,
+    0xF0, 0x9D, 0xA9, 0x48, 0x0E, 0x55, 0xDE, 0x5E, 0x31, 0xB1, 0xE5, 0x83, 0x0B, 0x19, 0x65, 0xF8,
+    0x6D, 0x9A, 0x79, 0xAD, 0x68, 0x67, 0x00, 0xDF, 0x7E, 0x36, 0x18, 0x1B, 0xAC, 0x11, 0x83, 0x74,
+    0x25, 0x76, 0x21, 0x31, 0xAC, 0xDE, 0x11, 0xF9, 0x03, 0x6A, 0x2F, 0x05, 0x12, 0x4E, 0xAB, 0xA4,
+    0xCD, 0xCE, 0xE4, 0x0B, 0x19, 0x92, 0x53, 0x1F, 0xD7, 0xA6, 0xFA, 0xC1, 0xC8, 0xC7, 0x51, 0x7F,
+    0x5D, 0x7C, 0xD4, 0x14, 0x8B, 0x26, 0x93, 0xCF, 0xE2, 0xFE, 0x43, 0xF1, 0x49, 0x5D, 0xD4, 0x6F,
+    0xDC, 0xE2, 0xF7, 0x78, 0x48, 0xB5, 0x2B, 0xE1, 0x28, 0x7F, 0xAE, 0x75, 0x04, 0xC4, 0x4C, 0x2B,
+    0x66, 0x0C, 0xCE, 0x6C, 0x1F, 0x08, 0xA0, 0xAB, 0xE5, 0xC3, 0xE0, 0x53, 0x19, 0x0C, 0xBE, 0x24,
+    0x7C, 0x31, 0xAA, 0x1B, 0xFA, 0xD7, 0x05, 0x1E, 0x10, 0x32, 0x71, 0x04, 0x3A, 0xE1, 0x1E, 0xC9,
+    0x83, 0x99, 0x43, 0x22, 0x95, 0xBC, 0xE2, 0xF6, 0xFC, 0x97, 0x96, 0x08, 0xE5, 0x08, 0x3E, 0xF1,
+    0x25, 0x2B, 0x5E, 0x05, 0xC8, 0x22, 0x6C, 0x49, 0x7D, 0xD2, 0x51, 0x41, 0xD0, 0x46, 0x30, 0x13,
+    0x0A, 0x29, 0x2B, 0x0E, 0x17, 0x40, 0x1D, 0x43, 0x04, 0x83, 0x94, 0x90, 0x3E, 0x52, 0x46, 0x63,
+    0x28, 0xEB, 0x12, 0xD6, 0xF4, 0x26, 0xF8, 0x19, 0x4F, 0x06, 0x16, 0xD2, 0x81, 0x0C, 0x34, 0xDD,
+    0xD6, 0x72, 0x5B, 0xB0, 0x6D, 0x42, 0xBD, 0x11, 0x31, 0xEC, 0x39, 0xB1, 0x22, 0x0F, 0xE9, 0xAA,
+    0x87, 0xE9, 0xA4, 0x85, 0x2A, 0xAF, 0xAC, 0x44, 0x03, 0x8D, 0x35, 0x29, 0x09, 0x97, 0x73, 0x3F,
+    0x54, 0xFA, 0x15, 0x76, 0xB9, 0xD4, 0xCF, 0xB1, 0xC6, 0x3D, 0x0E, 0x9A, 0x97, 0x50, 0x95, 0x8F,
+    0x3C, 0x16, 0xA1, 0x2A, 0xC8, 0x38, 0x3D, 0xA1, 0xFF, 0x5B, 0x98, 0x3D, 0x0E, 0x6A, 0x65, 0x03,
+    0x40, 0x6B, 0x56, 0x92, 0xE3, 0x7B, 0xB0, 0x06, 0xD6, 0x8C, 0xE8, 0xD2, 0xE5, 0x77, 0x52, 0xB2,
+    0x6D, 0x58, 0xB7, 0x88, 0xE0, 0x04, 0xFE, 0xA4, 0x81, 0x9A, 0x44, 0xC6, 0x04, 0xC1, 0xE3, 0xF9,
+    0xB9, 0x08, 0x90, 0xF1, 0x54, 0xCE, 0xCD, 0x06, 0x34, 0xBA, 0x66, 0xF4, 0xCD, 0xCE, 0x21, 0x81,
+    0x98, 0x12, 0x0A, 0x86, 0x3E, 0x81, 0xB0, 0x10, 0x85, 0xCE, 0xDE, 0x66, 0xCE, 0x5A, 0x16, 0x86,
+    0xAB, 0x55, 0xC8, 0xBF, 0x65, 0x6A, 0x90, 0x16, 0x04, 0x6A, 0x09, 0x81, 0x6B, 0x98, 0x9D, 0xAB,
+    0x59, 0x0A, 0x07, 0x14, 0x10, 0x19, 0xD5, 0xC9, 0x48, 0x75, 0xD6, 0x53, 0x9D, 0x7B, 0xAA, 0xCB,
+    0x23, 0xFA, 0x56, 0xAA, 0x93, 0xE1, 0x5C, 0xAD, 0x54, 0xE7, 0x9A, 0xBE, 0x5E, 0x7E, 0x3B, 0x67,
+    0xAF, 0xB5, 0x7D, 0x1B, 0x90, 0xB6, 0x69, 0x08, 0x2B, 0x80, 0xC2, 0x96, 0xDA, 0x0F, 0x88, 0x2C,
+    0x19, 0xF6, 0x4F, 0x5C, 0xE6, 0x2C, 0xF7, 0x67, 0xC2, 0xB0, 0xE8, 0xA1, 0x67, 0x48, 0x87, 0xA0,
+    0x58, 0xED, 0x1C, 0x08, 0x41, 0x2B, 0xE7, 0x7E, 0x6B, 0xD8, 0x49, 0x97, 0x76, 0xA4, 0x38, 0x12,
+    0x8D, 0x21, 0x49, 0x1D, 0xE9, 0xE4, 0x2E, 0xE6, 0x4B, 0x9D, 0xEF, 0x06, 0x5D, 0x5C, 0xDB, 0xB9,
+    0x7F, 0x80, 0xB3, 0x7F, 0xB2, 0x36, 0xD8, 0xC9, 0x98, 0x11, 0x31, 0xB3, 0x0B, 0xFD, 0xC8, 0x6B,
+    0x47, 0x15, 0x40, 0x0D, 0x30, 0xEE, 0xCB, 0xB3, 0x7B, 0x0B, 0x9D, 0xAB, 0xC1, 0x12, 0x04, 0x2E,
+    0x5D, 0xFA, 0xC9, 0x62, 0xA5, 0xC3, 0x5C, 0x0C, 0x7B, 0x7E, 0xF1, 0x6C, 0x38, 0xDC, 0x22, 0x31,
+    0xD3, 0x46, 0x14, 0x67, 0x6E, 0x91, 0x86, 0xAB, 0xA6, 0xF4, 0xA1, 0x5F, 0x42, 0x33, 0x84, 0xDE,
+    0xA1, 0xBD, 0xB9, 0xDE, 0xC1, 0xC8, 0xBA, 0xB0, 0x62, 0xD9, 0x23, 0x11, 0x28, 0xFB, 0x2B, 0x29,
+    0x10, 0xEB, 0xB4, 0xEB, 0x51, 0xA6, 0x89, 0xBB, 0xF7, 0x06, 0x5A, 0x2A, 0xBF, 0xE6, 0x99, 0x21,
+    0x9B, 0xD8, 0x17, 0xB9, 0xFE, 0xB6, 0xE3, 0x6A, 0xF2, 0x5E, 0x99, 0x32, 0x7A, 0x80, 0xD2, 0x53,
+    0x4E, 0xBC, 0x11, 0x70, 0x65, 0x7D, 0x84, 0x33, 0xDF, 0x93, 0x3E, 0xE5, 0xCF, 0x3D, 0x43, 0x9F,
+    0x98, 0x43, 0x48, 0x26, 0xA4, 0x71, 0x1C, 0xF2, 0xD1, 0xFF, 0x51, 0xAE, 0x96, 0x4B, 0xC7, 0xA7,
+    0x42, 0x3B, 0x8A, 0x31, 0x38, 0xDC, 0xA5, 0x78, 0x4A, 0xF1, 0x1A, 0x71, 0xA5, 0xA3, 0x6D, 0x90,
+    0xCE, 0x2E, 0x60, 0xB5, 0xA7, 0xA8, 0x40, 0xBE, 0x82, 0x32, 0x9B, 0x6C, 0x8B, 0x1C, 0xAA, 0xFB,
+    0xB7, 0x3B, 0x77, 0xBB, 0xB3, 0xB7, 0x2E, 0x8F, 0xBB, 0x3D, 0xC7, 0xE3, 0xC1, 0x3D, 0x1E, 0xF4,
+    0xC9, 0x00, 0xB8, 0xA2, 0x7B, 0x12, 0x8F, 0x1C, 0xC9, 0x3C, 0x86, 0xFF, 0x1C, 0xFD, 0x7A, 0xA4,
+    0xF3, 0xE8, 0xCE, 0x07, 0x8A, 0x69, 0xFC, 0xA6, 0xF5, 0x56, 0x5B, 0xAB, 0x8D, 0x45, 0xFB, 0xA1,
+    0x75, 0x5F, 0x04, 0xA4, 0x71, 0x3D, 0xF0, 0x3A, 0xC1, 0x8D, 0xE1, 0x71, 0x28, 0xC3, 0xA3, 0x05,
+    0x81, 0x9B, 0xD4, 0x78, 0x54, 0xD0, 0xB4, 0xBC, 0xE3, 0x4E, 0xF8, 0x9E, 0x3D, 0x27, 0x02, 0x7F,
+    0x13, 0x30, 0x5E, 0x66, 0x39, 0xDF, 0x85, 0x9C, 0xEF, 0x44, 0xAE, 0xE1, 0x31, 0xAA, 0x29, 0x48,
+    0x19, 0xBE, 0x42, 0xE5, 0x13, 0x25, 0x66, 0x50, 0x96, 0x47, 0x50, 0x96, 0xB5, 0xC3, 0x55, 0x84,
+    0xA2, 0x80, 0x14, 0x06, 0xDC, 0xAF, 0x53, 0x85, 0x71, 0xBC, 0x25, 0xD7, 0xAB, 0x99, 0x72, 0x17,
+    0x67, 0x71, 0xC5, 0x2C, 0xDF, 0x9F, 0xD5, 0xD5, 0xD3, 0x9E, 0x3D, 0x50, 0x96, 0xFB, 0xE2, 0x5C,
+    0x73, 0xF0, 0x5F, 0x5D, 0x55, 0xBB, 0x92, 0xDD, 0x44, 0x10, 0x6D, 0x49, 0xC1, 0xAD, 0xB2, 0x82,
+    0x21, 0x22, 0xA1, 0x0A, 0xE5, 0x24, 0xFA, 0x84, 0xD9, 0xDA, 0x0D, 0x08, 0x08, 0x70, 0x02, 0x1F,
+    0x41, 0xB2, 0x7F, 0xC0, 0xC8, 0x6C, 0xE0, 0x80, 0x94, 0xDC, 0x11, 0x55, 0xB6, 0x09, 0xFC, 0x07,
+    0x8C, 0xF0, 0x0D, 0x1C, 0x38, 0x40, 0x90, 0x10, 0x22, 0x0A, 0x28, 0x07, 0x0E, 0x76, 0xA0, 0xE4,
+    0xB2, 0x6C, 0xCF, 0xA8, 0x39, 0xA7, 0x75, 0xD9, 0xA5, 0x50, 0xED, 0xCE, 0x1D, 0xF5, 0x3C, 0xFA,
+    0xF4, 0xE9, 0xD3, 0xAD, 0x3B, 0x0F, 0x45, 0xEA, 0x47, 0xA2, 0x93, 0x48, 0x98, 0xDD, 0x26, 0xE2,
+    0xB4, 0xD2, 0x24, 0xA2, 0xA9, 0xD3, 0x41, 0x7A, 0xBC, 0x64, 0x69, 0xF8, 0x32, 0x49, 0xD0, 0x5A,
+    0x15, 0xEB, 0xA9, 0xBF, 0x4E, 0xA2, 0xF1, 0xBC, 0xE8, 0xD0, 0xBF, 0x5C, 0xFA, 0x1F, 0x73, 0x53,
+    0xE2, 0x79, 0x0E, 0x53, 0x78, 0xBE, 0xFA, 0xA3, 0xBA, 0x35, 0x5E, 0xE5, 0x3E, 0xE1, 0xD7, 0x8F,
+    0xFA, 0x24, 0xE9, 0x31, 0x3B, 0x2D, 0x2E, 0xFB, 0x29, 0xE8, 0xA8, 0xC7, 0xD2, 0x68, 0xE6, 0x4B,
+    0xAF, 0x67, 0x78, 0x81, 0x17, 0xBC, 0xC0, 0x6D, 0xA5, 0xCF, 0x36, 0x09, 0x53, 0x57, 0xC2, 0xDC,
+    0xE4, 0x4A, 0x7F, 0x01, 0x0E, 0xE9, 0x4B, 0x00, 0x8E, 0x5A, 0x67, 0xCC, 0xE5, 0xA3, 0x7B, 0x84,
+    0x96, 0xE2, 0x28, 0x4D, 0xEE, 0x57, 0x91, 0xCD, 0xA9, 0x88, 0xBF, 0xC2, 0xA2, 0x9B, 0x81, 0xF0,
+    0xB0, 0x7A, 0x3D, 0xAB, 0x8A, 0x03, 0xB0, 0x70, 0xF1, 0xB6, 0x48, 0xFF, 0xD3, 0xE6, 0xC7, 0x76,
+    0x09, 0x5F, 0x2F, 0x75, 0xE9, 0x66, 0x15, 0x6D, 0xD7, 0x7E, 0xF2, 0x4F, 0xB7, 0x26, 0xE3, 0x8E,
+    0x21, 0x5E, 0x64, 0x9F, 0x70, 0xCE, 0xE5, 0x26, 0x03, 0xB1, 0x84, 0x07, 0x49, 0x47, 0xF7, 0x1A,
+    0xC6, 0x4A, 0x61, 0x14, 0xAF, 0xF7, 0x55, 0x0E, 0xFA, 0x9B, 0x8E, 0xA2, 0x2B, 0x40, 0x74, 0xF0,
+    0x5D, 0xC5, 0x37, 0x80, 0x11, 0x14, 0xA4, 0xB4, 0x7A, 0x0D, 0x36, 0x74, 0xAE, 0x74, 0x6A, 0x0B,
+    0x98, 0x1A, 0x3D, 0xC8, 0xD3, 0xAF, 0xB8, 0x49, 0x1D, 0x20, 0x37, 0xC5, 0x8F, 0x22, 0x87, 0x57,
+    0x58, 0x13, 0xF7, 0x02, 0x06, 0xF1, 0x0F, 0x60, 0x90, 0x18, 0x30, 0xD4, 0x25, 0x63, 0x6C, 0x4F,
+    0x66, 0x1C, 0x94, 0x8D, 0xBB, 0xDB, 0x05, 0xCE, 0x24, 0x3E, 0xD5, 0x57, 0xD5, 0xA5, 0x36, 0x8A,
+    0x67, 0x6D, 0x39, 0x8E, 0x0E, 0xC3, 0x26, 0x1C, 0x67, 0x38, 0xD6, 0x42, 0x24, 0xDB, 0x99, 0xEC,
+    0x4F, 0x87, 0xA5, 0x03, 0xB6, 0xD6, 0xDB, 0x13, 0x1D, 0xBF, 0x97, 0x43, 0xEE, 0x07, 0xF1, 0x2D,
+    0x36, 0xFE, 0xBC, 0x4A, 0xBD, 0x02, 0x50, 0xF1, 0x30, 0x7C, 0x3A, 0x4B, 0x3C, 0xF2, 0x02, 0xFC,
+    0x27, 0xAF, 0x3A, 0xB9, 0xED, 0x11, 0x68, 0xC4, 0x79, 0x65, 0x48, 0xF0, 0xDB, 0x01, 0xCD, 0x21,
+    0x13, 0x3F, 0x61, 0xC2, 0xD0, 0xC3, 0xC0, 0xD8, 0x6A, 0x85, 0xAB, 0x38, 0x99, 0xB3, 0x4B, 0x26,
+    0x05, 0x04, 0xAD, 0x34, 0xBF, 0x04, 0x03, 0x58, 0x3C, 0x14, 0xA9, 0x61, 0x46, 0x04, 0x18, 0x9B,
+    0x55, 0x22, 0x2F, 0x14, 0x38, 0x45, 0x5A, 0x3A, 0xDC, 0x53, 0xE7, 0x96, 0x81, 0x06, 0x2C, 0xC1,
+    0xCB, 0xC8, 0x1B, 0x9A, 0xC4, 0x65, 0x29, 0x8E, 0x79, 0xF5, 0xA7, 0x05, 0xFA, 0x6D, 0x13, 0x89,
+    0x68, 0x72, 0xBB, 0xCA, 0x87, 0x15, 0x14, 0x31, 0xB8, 0x4D, 0xCF, 0xFC, 0xF6, 0x1D, 0x48, 0x30,
+    0x2A, 0x40, 0xB9, 0xB1, 0x40, 0x2E, 0x28, 0xD0, 0x1D, 0x49, 0x64, 0x46, 0x70, 0x8C, 0x2F, 0xCC,
+    0x0F, 0xA9, 0x39, 0xE8, 0xB2, 0xBF, 0xC8, 0x9D, 0xC7, 0xDF, 0x70, 0xE7, 0xCA, 0x43, 0x49, 0x20,
+    0x8E, 0xC1, 0x89, 0xE4, 0x2A, 0x49, 0x3B, 0x75, 0x22, 0x5F, 0x72, 0x32, 0x77, 0x52, 0x95, 0x3A,
+    0x21, 0xEC, 0x9E, 0x4C, 0x92, 0x62, 0x4C, 0x06, 0xE6, 0x40, 0xFC, 0x9F, 0x97, 0x2B, 0x88, 0x82,
+    0x74, 0x10, 0x60, 0x53, 0x20, 0x40, 0xA4, 0x5A, 0x39, 0x59, 0x38, 0xB9, 0x8F, 0xC4, 0xE4, 0x30,
+    0x0B, 0xC5, 0xEB, 0x0A, 0x27, 0x88, 0xE9, 0xFD, 0xCF, 0xA8, 0x5D, 0x80, 0x16, 0xBB, 0x02, 0x62,
+    0x82, 0x3E, 0x2B, 0xFD, 0x43, 0xEE, 0x4A, 0x6B, 0x18, 0x19, 0x25, 0xE2, 0xE7, 0xD0, 0x18, 0x4E,
+    0x6A, 0x06, 0x47, 0x2C, 0xAB, 0x5E, 0xDF, 0xD8, 0xC8, 0xA0, 0x3A, 0x46, 0x8B, 0x74, 0x33, 0x5A,
+    0xC4, 0x94, 0x2C, 0xCC, 0xD9, 0xE6, 0xA3, 0x25, 0x5F, 0xDE, 0x43, 0x70, 0xB9, 0xD6, 0xC7, 0x91,
+    0x05, 0x8A, 0x67, 0xE0, 0x90, 0x9D, 0x4D, 0x71, 0x07, 0x68, 0xF8, 0x40, 0xE1, 0xF9, 0xF4, 0x04,
+    0xDA, 0x7F, 0xE5, 0xF0, 0x9A, 0x43, 0xF9, 0xF6, 0x6E, 0x11, 0x80, 0xF5, 0xF4, 0xEB, 0xA6, 0x1B,
+    0x38, 0x86, 0x6C, 0x37, 0xD2, 0x99, 0x65, 0xA8, 0xDA, 0xEC, 0x02, 0x32, 0xDD, 0x19, 0x82, 0x5B,
+    0x63, 0xA4, 0x91, 0x7A, 0x91, 0x96, 0x92, 0xAA, 0x55, 0x4E, 0x1A, 0xDA, 0x8D, 0x2E, 0x1B, 0x6C,
+    0x1A, 0x89, 0x1A, 0x6A, 0xAB, 0x95, 0x72, 0x8B, 0xCF, 0xB0, 0xD0, 0xFF, 0xA5, 0x3C, 0xF6, 0x3F,
+    0x63, 0x52, 0xAA, 0x11, 0x34, 0xED, 0xE5, 0x14, 0x8E, 0x99, 0x5E, 0x69, 0x5C, 0x69, 0xDC, 0xCC,
+    0x78, 0x75, 0x63, 0x5C, 0x60, 0xAC, 0x8B, 0x03, 0x76, 0x3D, 0x57, 0x7A, 0x88, 0x6F, 0x3F, 0xDF,
+    0xF9, 0xC8, 0x8D, 0x15, 0x4F, 0x54, 0x6B, 0x5B, 0x0A, 0x6D, 0x04, 0xDD, 0x4E, 0x64, 0x7C, 0x81,
+    0x00, 0xAB, 0x87, 0x94, 0x62, 0x93, 0xAD, 0x5C, 0xD7, 0x6E, 0x62, 0x2A, 0x78, 0xF9, 0x3E, 0xF6,
+    0x33, 0xF3, 0xE5, 0x47, 0x56, 0x4A, 0x18, 0x1B, 0x56, 0xFA, 0x40, 0xB1, 0x2B, 0xFF, 0x18, 0xA6,
+    0x9E, 0x35, 0x1B, 0x43, 0x3D, 0xD8, 0x06, 0x06, 0xEA, 0xE7, 0x6E, 0x65, 0x00, 0x8C, 0xBC, 0x5B,
+    0x3C, 0xAF, 0x5A, 0x21, 0x0B, 0x16, 0x2E, 0x5D, 0xD8, 0xD8, 0x58, 0x6E, 0x1B, 0x4A, 0x83, 0xD5,
+    0x64, 0xC4, 0x18, 0x28, 0xD6, 0x76, 0xB0, 0xCA, 0x6E, 0xF2, 0x8E, 0xD2, 0xFD, 0x9E, 0xED, 0x37,
+    0x7E, 0x92, 0x76, 0x73, 0x3F, 0xED, 0x7A, 0xB1, 0x44, 0x20, 0x1D, 0x76, 0xBA, 0x2E, 0x40, 0x88,
+    0xD4, 0xB9, 0xD4, 0x2E, 0xE4, 0xDC, 0x8F, 0x48, 0x91, 0x4E, 0xC8, 0x0E, 0x5A, 0xA0, 0x0E, 0x30,
+    0x42, 0xC8, 0xCA, 0x40, 0x4A, 0x0D, 0x4F, 0x0A, 0x19, 0xBA, 0x77, 0x19, 0x19, 0xEC, 0x52, 0x7C,
+    0x8E, 0xB6, 0x28, 0xFE, 0xB8, 0x75, 0xE4, 0x5C, 0xFB, 0xC5, 0xBF, 0xC8, 0x28, 0x68, 0x1D, 0xE3,
+    0xF5, 0x0C, 0xB8, 0xD8, 0x0C, 0xCE, 0x3A, 0x4D, 0x68, 0xDA, 0x14, 0xE5, 0x68, 0x22, 0x04, 0x4E,
+    0xA7, 0xCC, 0x58, 0x82, 0x66, 0x19, 0xD5, 0x20, 0x61, 0xD9, 0x13, 0x0D, 0x73, 0xCB, 0x66, 0x36,
+    0xB1, 0xF6, 0xAD, 0x0F, 0x00, 0x17, 0xA4, 0x84, 0x49, 0x44, 0x2F, 0x40, 0xAF, 0x13, 0xB0, 0x5C,
+    0x15, 0x72, 0xD8, 0x58, 0x6B, 0x68, 0x32, 0x63, 0x69, 0xDF, 0x31, 0x50, 0xC7, 0x8F, 0x90, 0x35,
+    0xDB, 0x93, 0x76, 0xEC, 0xAB, 0x64, 0xCE, 0xC0, 0x81, 0x31, 0xB8, 0x91, 0x3B, 0xFF, 0x37, 0x50,
+    0xD5, 0x7A, 0x81, 0x4B, 0xBA, 0xF5, 0xC0, 0x8C, 0x8C, 0xE8, 0x55, 0xAE, 0x10, 0x42, 0x9C, 0xA5,
+    0xCF, 0x07, 0x96, 0xDD, 0xE2, 0x01, 0x2A, 0x24, 0x0A, 0x39, 0x30, 0x9D, 0xFE, 0x5E, 0x61, 0xA7,
+    0x41, 0xAE, 0x5D, 0x42, 0xF0, 0x46, 0x0B, 0x88, 0xEB, 0xE6, 0xBA, 0xA0, 0x63, 0x57, 0xA6, 0x1C,
+    0xDC, 0xEB, 0x96, 0x40, 0xE1, 0xB1, 0xA5, 0x7B, 0x46, 0xDB, 0x5A, 0x2F, 0x61, 0xFC, 0xF8, 0x20,
+    0xDD, 0x4A, 0x99, 0x09, 0xF0, 0xAC, 0x04, 0xC7, 0x4A, 0x20, 0x08, 0x20, 0xA2, 0x31, 0x5A, 0x5B,
+    0xA3, 0x91, 0x1F, 0x53, 0x63, 0x07, 0x2B, 0x6C, 0x59, 0xD6, 0xD5, 0x87, 0xBD, 0x9F, 0xF7, 0x7B,
+    0xF7, 0xBA, 0x89, 0xD0, 0xA6, 0xE9, 0x76, 0xBA, 0xD8, 0x94, 0x62, 0xB0, 0x6D, 0x6E, 0xBF, 0xDA,
+    0xBE, 0x1C, 0x3B, 0x1B, 0xFB, 0x94, 0x87, 0x63, 0xB1, 0x29, 0xDD, 0xC6, 0xCD, 0xA6, 0xE9, 0xDF,
+    0x5A, 0xFF, 0x81, 0x83, 0x7E, 0xCC, 0x61, 0xB3, 0xFE, 0x90, 0xCD, 0x9C, 0xE4, 0x3F, 0xCF, 0x3F,
+    0x95, 0x55, 0x3D, 0x6F, 0xE4, 0x54, 0x14, 0x3D, 0xB6, 0x15, 0x5C, 0x58, 0xC2, 0x34, 0x48, 0x48,
+    0x11, 0x72, 0x8B, 0x28, 0x78, 0x2D, 0x05, 0x99, 0x67, 0x44, 0xB1, 0x05, 0x4D, 0x0A, 0x02, 0x05,
+    0x05, 0x94, 0x48, 0x14, 0x69, 0x29, 0x66, 0xC6, 0x16, 0x2B, 0xB1, 0x05, 0xC5, 0xA6, 0xA1, 0x80,
+    0x8A, 0x02, 0x21, 0x91, 0x9A, 0x32, 0xB3, 0x36, 0xF0, 0x07, 0x9C, 0x6C, 0x41, 0x89, 0x11, 0x8B,
+    0x56, 0x50, 0x19, 0xF1, 0x56, 0x7A, 0x9B, 0xD8, 0xBE, 0x9C, 0x6B, 0x67, 0xC2, 0x64, 0x25, 0x0A,
+    0x2C, 0xDF, 0x2B, 0xCF, 0xF3, 0xDC, 0xEF, 0x73, 0xAE, 0x13, 0x69, 0x64, 0x48, 0xA5, 0x19, 0x90,
+    0xD6, 0xE8, 0xB7, 0x2A, 0xE8, 0x91, 0xDD, 0x28, 0x53, 0x86, 0x7E, 0xAB, 0x22, 0x07, 0x9B, 0xDF,
+    0x28, 0x44, 0xDD, 0x56, 0xC5, 0x1D, 0x8A, 0x1B, 0xF5, 0x00, 0x49, 0xAB, 0x4A, 0xBA, 0x4A, 0x52,
+    0xE9, 0x8E, 0x8E, 0x00, 0x04, 0xC0, 0x87, 0x48, 0x80, 0xEF, 0x11, 0xD7, 0x78, 0x03, 0x61, 0x8B,
+    0x0C, 0x70, 0x48, 0x4B, 0x9C, 0x21, 0x6A, 0xE8, 0x21, 0xEC, 0x90, 0x95, 0x8C, 0x9E, 0xD4, 0x58,
+    0x4F, 0x3E, 0xF3, 0xC0, 0x6B, 0x3E, 0x83, 0x9E, 0x7C, 0x82, 0x08, 0x78, 0xA1, 0x1A, 0x12, 0x69,
+    0xAB, 0x71, 0xF6, 0x7E, 0x2B, 0xE2, 0x6E, 0x2A, 0xB7, 0x72, 0xDC, 0x4D, 0xFE, 0x56, 0x55, 0xBB,
+    0xE5, 0x32, 0x46, 0x7A, 0x21, 0x43, 0x26, 0xE7, 0x32, 0xEC, 0x1D, 0xE5, 0x78, 0x05, 0x4C, 0x01,
+    0x92, 0x47, 0x8F, 0x9B, 0x14, 0xEE, 0x75, 0xBC, 0x0C, 0x2D, 0x40, 0x78, 0x5D, 0xA9, 0xFA, 0xEA,
+    0xF4, 0xF4, 0xF4, 0x3B, 0x0B, 0x5A, 0x45, 0xCC, 0xB0, 0x43, 0x90, 0xEB, 0x7B, 0x84, 0x63, 0x86,
+    0x58, 0xAE, 0xEA, 0xF8, 0xB2, 0xEA, 0xA2, 0x2E, 0xEC, 0x43, 0x4D, 0xC6, 0x23, 0x69, 0x58, 0xAD,
+    0x63, 0xB1, 0x6B, 0x16, 0x6E, 0x3E, 0xED, 0x68, 0xB1, 0x42, 0xD2, 0xA7, 0x4F, 0x8F, 0x25, 0xA2,
+    0xB3, 0xBA, 0x10, 0xE9, 0x62, 0x19, 0x56, 0x30, 0x3E, 0xCB, 0x0B, 0xBA, 0xCA, 0x1A, 0x20, 0x76,
+    0x0C, 0x38, 0xD0, 0xA9, 0xE5, 0x41, 0xCA, 0x03, 0x96, 0xA2, 0x01, 0xAF, 0x0F, 0x2E, 0xA4, 0xA6,
+    0xED, 0x08, 0x19, 0x8F, 0x5B, 0xEB, 0xB1, 0x49, 0x58, 0xC5, 0x8F, 0x03, 0xC3, 0x54, 0xC0, 0xCA,
+    0xD4, 0xC8, 0xEE, 0x75, 0x88, 0xCF, 0x7B, 0x5A, 0x15, 0x65, 0xD8, 0xA7, 0xC3, 0x7B, 0xA3, 0x86,
+    0x42, 0x25, 0x92, 0xA7, 0x14, 0x3E, 0xD0, 0xD3, 0x3B, 0x53, 0xD6, 0x4C, 0x99, 0xBE, 0x7A, 0xC8,
+    0xB7, 0x25, 0x0D, 0x35, 0x4C, 0xC1, 0xB3, 0x16, 0xD8, 0x80, 0xA9, 0x4F, 0x8D, 0xD0, 0x64, 0x6C,
+    0x83, 0x50, 0xBE, 0x28, 0x69, 0x0D, 0x2B, 0x6C, 0xE6, 0x38, 0xD7, 0x0C, 0x43, 0xE1, 0x7C, 0x74,
+    0x7A, 0xE0, 0x24, 0xE7, 0x03, 0x76, 0x54, 0x47, 0x01, 0x36, 0x37, 0x73, 0x96, 0x06, 0xF7, 0x6B,
+    0x2B, 0x57, 0xAD, 0x39, 0x29, 0x7C, 0x5A, 0x46, 0x23, 0x5F, 0x57, 0x77, 0x39, 0xFF, 0x5F, 0x1D,
+    0x62, 0xBF, 0x62, 0x59, 0x59, 0x8E, 0xE2, 0x4E, 0x07, 0x73, 0x3E, 0xC2, 0x38, 0xCB, 0xC2, 0x62,
+    0x66, 0x5B, 0x32, 0xDB, 0x36, 0x91, 0x9E, 0xC1, 0xFC, 0x62, 0x0E, 0xB6, 0xEF, 0x39, 0x15, 0x8E,
+    0xC5, 0x47, 0x0D, 0x7D, 0x74, 0xEC, 0xE9, 0x72, 0x81, 0x77, 0xCF, 0x68, 0x31, 0xB0, 0x8B, 0x7F,
+    0x6C, 0x98, 0x13, 0xDD, 0x69, 0xCA, 0xB0, 0x25, 0xC5, 0xE1, 0x25, 0x26, 0xDC, 0xD3, 0x5B, 0xCF,
+    0xE9, 0xF5, 0xD8, 0x1F, 0x4B, 0x2D, 0x78, 0x0C, 0xA4, 0x35, 0x88, 0x5A, 0xC2, 0x30, 0xAA, 0x71,
+    0xC0, 0x6E, 0x70, 0xAC, 0x1F, 0x5F, 0x7E, 0xFD, 0x0C, 0x8A, 0xAF, 0x55, 0xD2, 0xA1, 0x9A, 0x15,
+    0x8A, 0x93, 0x8F, 0x22, 0xF1, 0xBD, 0xFA, 0xCC, 0xCA, 0xA2, 0x5F, 0x20, 0xEB, 0x0F, 0x38, 0xCA,
+    0x25, 0xCB, 0x58, 0x12, 0x0B, 0xB3, 0xC4, 0xFE, 0x00, 0xA9, 0xB7, 0x7F, 0x8A, 0xCF, 0x44, 0x1C,
+    0xFF, 0xEB, 0x22, 0xB9, 0x74, 0x28, 0x1E, 0xB2, 0x21, 0x74, 0x88, 0xAC, 0x7B, 0x1E, 0x55, 0xCB,
+    0x77, 0xB5, 0x61, 0x2D, 0x86, 0x53, 0x0C, 0xAB, 0x76, 0x6A, 0xD9, 0x24, 0xE5, 0x33, 0xA2, 0x80,
+    0xD8, 0xCA, 0xDB, 0xEC, 0x4F, 0x25, 0x0D, 0xED, 0x3A, 0xE3, 0x63, 0x67, 0x9A, 0xC0, 0x5B, 0x22,
+    0x98, 0xB5, 0x9E, 0x11, 0x16, 0xBB, 0xD2, 0xAB, 0x10, 0x4C, 0xC3, 0x24, 0x65, 0x30, 0x54, 0x14,
+    0xF3, 0x96, 0xB7, 0xF7, 0xFA, 0xAA, 0x9E, 0x9B, 0x79, 0x68, 0xC2, 0xCE, 0x84, 0xED, 0x6B, 0xAA,
+    0x3B, 0x1B, 0x6D, 0xEF, 0x3B, 0x0E, 0x24, 0x0B, 0x81, 0x1D, 0xF5, 0x88, 0xA7, 0xFB, 0xDF, 0xEB,
+    0x10, 0x81, 0x9B, 0xEE, 0x4E, 0xEF, 0xF0, 0x3F, 0x6E, 0x36, 0x76, 0xF7, 0x8E, 0x1B, 0x05, 0x70,
+    0x51, 0x67, 0x42, 0x10, 0xA0, 0xF8, 0x66, 0xEB, 0x8C, 0x64, 0x9F, 0x85, 0x95, 0x99, 0x5D, 0xB9,
+    0x06, 0x91, 0x0D, 0x7B, 0x58, 0xA5, 0x76, 0x56, 0xC3, 0xB2, 0x1C, 0x3B, 0xF2, 0x8C, 0xD9, 0x10,
+    0xEF, 0xF3, 0x73, 0x55, 0xA2, 0xB0, 0x2D, 0x8A, 0xD4, 0xA3, 0x88, 0x47, 0x14, 0xA1, 0x94, 0x05,
+    0xB8, 0x1F, 0xF8, 0xAF, 0xBD, 0x9C, 0x79, 0xD0, 0x9C, 0x2D, 0x8D, 0xF4, 0x61, 0xCD, 0x48, 0x71,
+    0xC3, 0xCC, 0x37, 0x0C, 0x91, 0x34, 0xA1, 0x3E, 0xD8, 0x3C, 0x6D, 0x08, 0xF7, 0x41, 0x1F, 0xE4,
+    0x27, 0xAE, 0xAA, 0x1E, 0xC1, 0x98, 0xEF, 0x3B, 0x9C, 0xC9, 0x98, 0x48, 0xC3, 0xC1, 0x3D, 0x21,
+    0xD8, 0x75, 0x4A, 0x81, 0x27, 0xC9, 0xA5, 0x4E, 0xEA, 0x41, 0xA9, 0xB0, 0x64, 0x3E, 0x84, 0xC6,
+    0x0F, 0xBD, 0xB2, 0x44, 0xC9, 0xB6, 0x46, 0x7C, 0xD1, 0x2B, 0x57, 0x36, 0x1C, 0x04, 0xB7, 0xD5,
+    0xC3, 0x79, 0x6D, 0xE9, 0x04, 0x90, 0xFE, 0xE6, 0xB8, 0x6E, 0x30, 0x16, 0x39, 0xAB, 0x49, 0x1F,
+    0x77, 0x8A, 0xCB, 0x11, 0xC1, 0x21, 0x32, 0x33, 0x62, 0xC2, 0x80, 0x4B, 0x5A, 0xD3, 0x44, 0x9D,
+    0xA9, 0x43, 0xC7, 0x8D, 0xA7, 0xE2, 0xAF, 0x85, 0x33, 0x0C, 0x39, 0xDB, 0x59, 0x8A, 0x1D, 0xA9,
+    0xEA, 0x70, 0x80, 0x79, 0x4A, 0x42, 0x4A, 0x99, 0x8C, 0x55, 0x97, 0xA9, 0x2D, 0xC9, 0x46, 0x96,
+    0xAC, 0x88, 0xFF, 0x35, 0x99, 0xBB, 0xA0, 0xAC, 0xC9, 0x83, 0xB5, 0xAE, 0x29, 0xFB, 0xFB, 0xFB,
+    0x8A, 0x59, 0x97, 0x90, 0x50, 0xE4, 0x41, 0x49, 0x42, 0xB1, 0xBF, 0xAF, 0x9E, 0xC0, 0x1A, 0x29,
+    0xA3, 0xAB, 0xCB, 0x4A, 0x0F, 0x7C, 0x28, 0xDC, 0xCC, 0xA6, 0xC1, 0x01, 0x33, 0x8D, 0x5A, 0x26,
+    0xBD, 0x08, 0xA6, 0x87, 0x06, 0x0B, 0x7D, 0xD5, 0x98, 0x31, 0xE8, 0xA7, 0x85, 0x45, 0xBA, 0xB9,
+    0xF8, 0x6F, 0xE2, 0xB6, 0x4A, 0x25, 0x4F, 0xDA, 0x3D, 0xB0, 0xA2, 0x79, 0x49, 0x05, 0x0A, 0x16,
+    0xA3, 0xDB, 0x40, 0x1F, 0x6C, 0x8D, 0xDD, 0xEB, 0xB9, 0x93, 0x17, 0xC9, 0xDE, 0x81, 0x24, 0x1B,
+    0xAB, 0x82, 0x7F, 0x4F, 0x09, 0xE6, 0x3C, 0x1A, 0x75, 0x61, 0x8F, 0xA4, 0x2D, 0x4B, 0x9A, 0xD4,
+    0x99, 0x1A, 0x2F, 0x15, 0x7D, 0x2B, 0x55, 0x0B, 0xF2, 0x0B, 0x5C, 0x1C, 0xEC, 0x9E, 0x32, 0x38,
+    0x51, 0x15, 0xC8, 0xC0, 0x4D, 0x63, 0x5A, 0xAD, 0x02, 0xB3, 0x5A, 0x52, 0x89, 0x06, 0x15, 0xFD,
+    0x2D, 0x27, 0xCC, 0xE5, 0xD1, 0x1C, 0x36, 0xFD, 0xCC, 0x2D, 0xF8, 0x8D, 0x93, 0xBB, 0xF2, 0x65,
+    0x46, 0x3A, 0xB3, 0xAD, 0xCA, 0x42, 0x96, 0x57, 0x69, 0x20, 0x0E, 0x96, 0x69, 0x4A, 0x4E, 0xFC,
+    0x64, 0xB4, 0x3C, 0x1E, 0x89, 0x85, 0x01, 0x0F, 0xDE, 0x3C, 0x8C, 0x94, 0x8B, 0xD7, 0xEB, 0xB6,
+    0xA2, 0x2B, 0x7E, 0x75, 0xC0, 0x6E, 0x21, 0x20, 0xEA, 0x68, 0xFA, 0x28, 0xD6, 0x8E, 0x76, 0xA2,
+    0x7E, 0xB9, 0x5C, 0xAA, 0x79, 0x1D, 0xC6, 0xA5, 0x62, 0x82, 0x9F, 0x2D, 0x5D, 0x9E, 0x2C, 0x4E,
+    0xE4, 0x2F, 0xCD, 0x77, 0x98, 0xDC, 0xB0, 0x41, 0xBA, 0x13, 0x15, 0xC1, 0x13, 0xD5, 0xF9, 0x43,
+    0xFB, 0x45, 0x82, 0x66, 0xD2, 0xC6, 0xD3, 0x86, 0xE2, 0xA6, 0xAC, 0x37, 0x08, 0x9F, 0x38, 0x24,
+    0x3F, 0x37, 0x30, 0x1F, 0x94, 0xD8, 0xAC, 0xB9, 0xD4, 0x89, 0x27, 0x2E, 0x0F, 0x7B, 0x9F, 0x38,
+    0x62, 0xB3, 0xBC, 0xA2, 0xCA, 0x43, 0x3E, 0xE7, 0x9E, 0x24, 0x82, 0x3C, 0xC7, 0xC1, 0xCF, 0xEC,
+    0x2F, 0x75, 0xE1, 0x0B, 0xFC, 0xFF, 0xEB, 0x1F, 0x9D, 0x55, 0x3D, 0x88, 0x1D, 0x55, 0x14, 0xFE,
+    0x66, 0xAE, 0xD9, 0x49, 0x98, 0x67, 0x26, 0xA0, 0x01, 0x31, 0x0B, 0xD3, 0xA4, 0x88, 0xB0, 0xC9,
+    0x6C, 0x61, 0xB1, 0xC5, 0x6E, 0xEE, 0x84, 0x2D, 0x2C, 0x6C, 0x56, 0xB4, 0x14, 0x14, 0xB5, 0x4B,
+    0x11, 0x04, 0x8B, 0x08, 0xEB, 0xCE, 0xC4, 0x2D, 0x6C, 0x44, 0x17, 0x44, 0xB0, 0xB4, 0x48, 0x44,
+    0xB6, 0x31, 0xE0, 0x22, 0x81, 0xEC, 0xEE, 0xDC, 0xF8, 0x8A, 0x14, 0x29, 0x72, 0x15, 0x51, 0xB0,
+    0xC9, 0x48, 0x22, 0x82, 0x16, 0x7B, 0x23, 0x53, 0x4C, 0x64, 0xDE, 0x1C, 0xBF, 0x3B, 0x6F, 0x77,
+    0x63, 0x5A, 0x67, 0xDE, 0xBD, 0x67, 0xEE, 0xDF, 0x39, 0xDF, 0x39, 0xE7, 0xBB, 0xE7, 0x7D, 0x00,
+    0xA8, 0xFB, 0x0E, 0xD8, 0x4E, 0x4B, 0x24, 0x65, 0x87, 0xD0, 0xC5, 0x35, 0x34, 0xDF, 0xD8, 0x86,
+    0x2D, 0x3A, 0x24, 0x26, 0xCB, 0xB1, 0xAB, 0x1C, 0x22, 0xB7, 0x0B, 0xE8, 0x4F, 0x0D, 0x82, 0xBE,
+    0x05, 0x12, 0xC9, 0x01, 0x69, 0x80, 0x58, 0x00, 0x54, 0x0E, 0x05, 0x45, 0x7C, 0x9F, 0x13, 0x98,
+    0xE8, 0x92, 0xEB, 0xDF, 0x77, 0x40, 0xD0, 0xA5, 0xE6, 0x08, 0xB2, 0x72, 0x12, 0xB4, 0xAA, 0x49,
+    0x6A, 0x6D, 0x35, 0xAA, 0x44, 0x22, 0x17, 0xFD, 0x2D, 0xDD, 0x2E, 0x74, 0x25, 0x7B, 0x56, 0x89,
+    0x48, 0x87, 0x4C, 0xF6, 0xC4, 0x04, 0xD2, 0x48, 0x8B, 0xA4, 0x8F, 0xA8, 0x5A, 0x8C, 0x76, 0x88,
+    0x9B, 0x40, 0xA0, 0x1A, 0x2A, 0x48, 0x4D, 0xEC, 0xD0, 0x07, 0x1D, 0x47, 0x3A, 0x47, 0x7A, 0xAF,
+    0xA6, 0x6D, 0x82, 0x50, 0xDE, 0x76, 0xC6, 0x41, 0xE4, 0x3F, 0xA8, 0x07, 0x7A, 0xAF, 0x46, 0xE2,
+    0x24, 0x0F, 0x27, 0xAA, 0x43, 0x51, 0x66, 0x75, 0xEA, 0x20, 0xCB, 0x3C, 0xD7, 0xAD, 0x71, 0x51,
+    0x03, 0x6B, 0x74, 0x73, 0x27, 0xB1, 0xE8, 0x22, 0x87, 0x4E, 0x35, 0x61, 0x1B, 0xB0, 0x47, 0x4F,
+    0xFF, 0x8A, 0x97, 0x1C, 0xF4, 0xDD, 0x1A, 0xA9, 0x57, 0x21, 0x96, 0x3A, 0x0D, 0x0D, 0xD0, 0x5D,
+    0xA1, 0x3B, 0x83, 0xB7, 0x74, 0x88, 0x2D, 0x9A, 0x00, 0x97, 0x3C, 0x64, 0xC7, 0x66, 0x90, 0xF5,
+    0x84, 0xB0, 0xE1, 0xB1, 0x48, 0xB7, 0xDF, 0xB8, 0x21, 0x22, 0xBA, 0x94, 0xC0, 0xAA, 0x12, 0x21,
+    0x37, 0xC4, 0x1C, 0x6A, 0x0F, 0xBA, 0x84, 0xE2, 0x30, 0xF1, 0xC3, 0x7F, 0x36, 0x37, 0xB4, 0x88,
+    0x2B, 0x44, 0x9A, 0xC2, 0xC7, 0x60, 0x46, 0x68, 0xB6, 0x8C, 0x1A, 0x28, 0xAE, 0x52, 0x05, 0x1D,
+    0x4D, 0x88, 0x80, 0xA9, 0xF1, 0x7E, 0x51, 0x9D, 0x41, 0x6A, 0x51, 0xD5, 0xC8, 0x2C, 0xE2, 0x7E,
+    0x18, 0x13, 0x39, 0x98, 0x94, 0xAC, 0x04, 0x73, 0xE6, 0x07, 0xFE, 0x18, 0x07, 0x0D, 0x81, 0x36,
+    0xD0, 0x3D, 0x82, 0xAA, 0x9C, 0x5B, 0x3C, 0x7C, 0x56, 0x2F, 0x4F, 0x9F, 0x1B, 0x37, 0xB6, 0xF8,
+    0x50, 0x53, 0x4A, 0x77, 0xD2, 0x43, 0x03, 0x8C, 0xCA, 0x81, 0x8E, 0xDC, 0x2B, 0x0C, 0xDB, 0xE1,
+    0xCB, 0xC7, 0x36, 0x33, 0x60, 0x3E, 0xA8, 0xFA, 0x09, 0x44, 0x8F, 0x07, 0x1E, 0xBA, 0xF1, 0xC1,
+    0xEA, 0x69, 0xDD, 0xCC, 0xDD, 0x34, 0xDF, 0x8E, 0xC7, 0x9F, 0x44, 0x93, 0x85, 0xA8, 0xF6, 0xE4,
+    0x78, 0x28, 0xB7, 0x25, 0x69, 0x75, 0x5D, 0x31, 0x88, 0x98, 0x71, 0xDA, 0x48, 0xD8, 0xC5, 0x2E,
+    0x33, 0x55, 0xC0, 0x2C, 0xA4, 0x46, 0x33, 0x11, 0x2E, 0x99, 0x8A, 0xD8, 0x64, 0xD8, 0xC6, 0x75,
+    0x04, 0xDC, 0xB9, 0xCA, 0x30, 0x32, 0xF4, 0x97, 0x0F, 0x05, 0xA3, 0x5E, 0x88, 0x49, 0xE4, 0x8B,
+    0xB0, 0xBB, 0x01, 0x1D, 0xE7, 0x91, 0xDB, 0xC2, 0x1A, 0x85, 0xDD, 0xC2, 0xCE, 0x74, 0x54, 0xBC,
+    0x9C, 0xAB, 0x09, 0x09, 0x23, 0x5F, 0x83, 0xA1, 0x65, 0x2A, 0xCA, 0x50, 0x1E, 0x20, 0xA1, 0x32,
+    0xE2, 0xF4, 0xE2, 0xF1, 0xF3, 0x1A, 0x10, 0x32, 0x53, 0x81, 0x0F, 0x7D, 0x51, 0x9F, 0x72, 0x49,
+    0x8D, 0xA3, 0xDE, 0x15, 0xE2, 0x9F, 0xDA, 0x86, 0xB2, 0xEC, 0xCE, 0xB3, 0x05, 0x3C, 0x8C, 0xC4,
+    0x83, 0x3F, 0x58, 0x7F, 0x5E, 0x36, 0xAF, 0xF2, 0xA4, 0x94, 0xA9, 0x90, 0x87, 0x3E, 0x50, 0x3E,
+    0x09, 0x43, 0xE6, 0x30, 0xDC, 0x07, 0x1E, 0xAD, 0x1E, 0xF8, 0xCB, 0x21, 0xFD, 0x46, 0xC5, 0x8D,
+    0x77, 0x64, 0xA0, 0x05, 0x67, 0x10, 0xDA, 0x6C, 0xEF, 0xAF, 0x86, 0x07, 0x5D, 0xD4, 0x64, 0x26,
+    0xE6, 0x9B, 0x98, 0xC8, 0xB2, 0xD5, 0x89, 0x89, 0x6D, 0xDC, 0x64, 0x96, 0xA7, 0x6C, 0xB6, 0x4F,
+    0x8B, 0xEC, 0xC8, 0x85, 0xE6, 0x28, 0xB0, 0xF2, 0x2C, 0x61, 0xBC, 0x4A, 0x1C, 0x13, 0xA6, 0x5D,
+    0x97, 0x15, 0x62, 0xA7, 0xBA, 0xB0, 0x63, 0xF6, 0x18, 0xD4, 0x8A, 0x8C, 0x55, 0x9E, 0xFD, 0x89,
+    0xB7, 0x5D, 0xD0, 0xB6, 0xF2, 0x40, 0xB5, 0x94, 0x9E, 0x90, 0xA8, 0xE4, 0xA7, 0x83, 0x19, 0x73,
+    0xF0, 0x71, 0xCB, 0xF3, 0xB5, 0xE5, 0x92, 0x27, 0xB9, 0x47, 0xAD, 0x0F, 0xE0, 0xF3, 0xE3, 0x90,
+    0x32, 0x43, 0xA0, 0x16, 0x1E, 0x53, 0x06, 0x33, 0x7D, 0x3E, 0x10, 0x7F, 0x95, 0xAF, 0xC3, 0x73,
+    0xA8, 0xA7, 0x91, 0xF5, 0x24, 0x84, 0x7E, 0x44, 0x9F, 0xA5, 0xF6, 0x26, 0x49, 0xE2, 0x5D, 0x86,
+    0x49, 0x27, 0x25, 0xD3, 0x64, 0xA1, 0x23, 0xF9, 0xAA, 0x0F, 0x7D, 0x00, 0x2E, 0xF9, 0x8A, 0x51,
+    0xF0, 0x44, 0xDC, 0x79, 0x24, 0x01, 0x65, 0xE2, 0x9D, 0xA4, 0xB3, 0xBC, 0x0B, 0xF6, 0x94, 0x3C,
+    0x1A, 0x4C, 0xA6, 0x79, 0xB6, 0xDC, 0xAA, 0x56, 0x1B, 0x3D, 0xEE, 0xA2, 0xAE, 0x30, 0x95, 0x09,
+    0x76, 0x71, 0x3C, 0xA8, 0x4F, 0x6F, 0x9F, 0x7E, 0xAB, 0x1C, 0x7D, 0x06, 0xFE, 0x8E, 0xBD, 0x6D,
+    0x46, 0xF3, 0xFD, 0xEC, 0x99, 0xA7, 0xE6, 0xE3, 0x0B, 0x36, 0xF0, 0xF6, 0x91, 0x5D, 0x8D, 0xDF,
+    0x28, 0xED, 0xC2, 0xAC, 0xBA, 0x52, 0x2E, 0xCE, 0xA9, 0x5B, 0xBF, 0x53, 0xB5, 0xC9, 0x3E, 0x46,
+    0xC8, 0xA5, 0xC5, 0xC0, 0xAA, 0x3A, 0xCB, 0xD7, 0xC2, 0x26, 0xAE, 0x75, 0xBE, 0xA3, 0x5C, 0x54,
+    0x6B, 0xDE, 0x26, 0x61, 0xF1, 0x98, 0x36, 0xFF, 0x9D, 0x32, 0xBD, 0xB3, 0x83, 0x4B, 0xD8, 0xBD,
+    0x96, 0x33, 0x09, 0xDD, 0x45, 0x1F, 0x1E, 0xEC, 0x10, 0xAE, 0xFD, 0xAF, 0x08, 0xF2, 0x6A, 0xC8,
+    0x68, 0xE7, 0xC3, 0xB7, 0x8F, 0x6C, 0xF2, 0xE2, 0xFC, 0xFA, 0x68, 0xE5, 0xA3, 0xD1, 0xC6, 0xE4,
+    0xD8, 0x2B, 0xBF, 0x8E, 0xDE, 0x1D, 0x8F, 0x5E, 0x18, 0xBF, 0x97, 0x7C, 0x58, 0x4F, 0x91, 0x89,
+    0xFC, 0xBC, 0x79, 0x6D, 0xF0, 0x2C, 0x9E, 0xF0, 0x3E, 0x75, 0x98, 0x44, 0x4E, 0x23, 0x59, 0xAE,
+    0xB1, 0xBD, 0x86, 0xF8, 0x36, 0x05, 0x47, 0xE3, 0x49, 0xD4, 0x32, 0x18, 0x9E, 0xE2, 0x90, 0x01,
+    0xC5, 0x70, 0x0B, 0x7C, 0xAD, 0x2D, 0xF7, 0xC5, 0xCC, 0x66, 0xBF, 0x49, 0x9B, 0xF5, 0x13, 0x93,
+    0xC0, 0x3B, 0x07, 0x9C, 0x3E, 0xB9, 0x59, 0xAD, 0x13, 0xD6, 0xC9, 0x15, 0x7F, 0x56, 0x8E, 0xC5,
+    0x18, 0x61, 0x5E, 0x99, 0xB3, 0xAA, 0x3E, 0x1F, 0xCA, 0x3D, 0xC9, 0x59, 0x38, 0xCE, 0x70, 0xEA,
+    0x0C, 0xA9, 0x7E, 0x19, 0x73, 0x98, 0x3D, 0xB1, 0x5A, 0x35, 0x85, 0x0D, 0x36, 0x16, 0x23, 0xD3,
+    0xA4, 0xCA, 0xF1, 0xAE, 0xEF, 0x1C, 0xB6, 0x72, 0xDA, 0x8A, 0x12, 0x93, 0x82, 0xD7, 0xFA, 0x89,
+    0x56, 0xAB, 0x9E, 0x28, 0x86, 0x76, 0x93, 0xBC, 0xFE, 0x4E, 0xA4, 0xD8, 0x2A, 0xDA, 0x62, 0x8B,
+    0x56, 0x7D, 0xFD, 0xFF, 0x72, 0xB8, 0x5E, 0x41, 0x5E, 0xD8, 0xC5, 0x74, 0xA2, 0xC6, 0x62, 0x16,
+    0x8B, 0x4E, 0xDD, 0xA1, 0xA8, 0x3A, 0xF5, 0x8B, 0x98, 0x25, 0xDD, 0x29, 0x4B, 0xA1, 0x5A, 0x65,
+    0x75, 0x39, 0x88, 0x22, 0x5F, 0x8A, 0x1B, 0x4E, 0xE6, 0x4B, 0x89, 0x17, 0x58, 0x4A, 0x5D, 0xF8,
+    0xA3, 0xE0, 0x9C, 0x76, 0xE1, 0xFD, 0xA9, 0xF8, 0x83, 0x22, 0x5B, 0xEF, 0xF4, 0x6D, 0xB2, 0xE1,
+    0x84, 0xC2, 0x9B, 0x2C, 0x71, 0xF6, 0xE9, 0x8B, 0x77, 0xEB, 0x23, 0xE8, 0x82, 0xEB, 0xA1, 0x89,
+    0xE9, 0x8E, 0x53, 0x26, 0x51, 0x72, 0x97, 0x57, 0x20, 0x57, 0xBD, 0x2A, 0x7F, 0x33, 0xB3, 0xD7,
+    0xD5, 0xEB, 0xC1, 0xF8, 0x73, 0x57, 0x35, 0xDC, 0x9D, 0x07, 0x08, 0xCD, 0x71, 0x5E, 0x5E, 0xFF,
+    0xC7, 0xC6, 0x46, 0x1A, 0x44, 0x64, 0x44, 0xC4, 0xEF, 0x62, 0x9D, 0x24, 0xD3, 0x96, 0x42, 0xB5,
+    0x99, 0x49, 0xCA, 0x6D, 0x2C, 0x04, 0x06, 0xF9, 0x61, 0xA5, 0x18, 0x0A, 0xC2, 0x70, 0x77, 0x80,
+    0x67, 0x86, 0x5E, 0xB1, 0x5F, 0x1C, 0xFA, 0x2D, 0xDF, 0x07, 0xB5, 0xEF, 0xA7, 0xBF, 0xB8, 0xF4,
+    0x7D, 0x32, 0xEC, 0x39, 0xCB, 0xCA, 0x65, 0x7C, 0x29, 0xF9, 0xE6, 0x4F, 0x1F, 0x18, 0x91, 0xD0,
+    0x21, 0x17, 0x51, 0x26, 0x34, 0x3E, 0x71, 0x5C, 0x23, 0xE7, 0x58, 0x44, 0x59, 0x64, 0xCE, 0x91,
+    0x59, 0xDB, 0x78, 0xDF, 0xFA, 0x08, 0x3E, 0x64, 0x1D, 0x76, 0xEA, 0x87, 0x1A, 0x91, 0x8D, 0xAF,
+    0xF0, 0xBF, 0xA8, 0x4C, 0xA4, 0x47, 0x06, 0xDF, 0xB3, 0x1A, 0x51, 0x47, 0xE7, 0xFB, 0x80, 0x1A,
+    0x95, 0x0B, 0x56, 0x30, 0xD4, 0xE0, 0xFF, 0xFF, 0xFC, 0x0B, 0xD5, 0x55, 0xB1, 0x6E, 0xD5, 0x30,
+    0x14, 0x3D, 0x89, 0x91, 0x22, 0x11, 0x81, 0x19, 0x40, 0x42, 0x42, 0x90, 0x15, 0x55, 0xD0, 0x2C,
+    0x0C, 0x0C, 0x2D, 0x89, 0xF8, 0x06, 0xFA, 0x0F, 0xC0, 0xC2, 0x5A, 0xA4, 0xD2, 0x3C, 0x89, 0x91,
+    0x85, 0x85, 0x3F, 0x60, 0x40, 0x2C, 0x2C, 0x0C, 0x1D, 0xCA, 0x4B, 0x24, 0x06, 0x46, 0x5E, 0xFF,
+    0x20, 0x03, 0x0B, 0x20, 0x44, 0xA0, 0x6F, 0x08, 0xF4, 0xBD, 0x98, 0x73, 0x6E, 0x80, 0x0A, 0x54,
+    0x21, 0x31, 0xD6, 0xB2, 0xAF, 0xE3, 0x6B, 0xFB, 0xFA, 0x9C, 0x7B, 0xAF, 0x9D, 0xB4, 0x01, 0x8B,
+    0xEF, 0x24, 0xE3, 0x35, 0xD8, 0x80, 0xAD, 0x83, 0xE3, 0xC4, 0x4B, 0x7D, 0x60, 0x13, 0x58, 0xB3,
+    0xCA, 0x89, 0x55, 0x68, 0x62, 0x5C, 0x91, 0x96, 0xC0, 0x16, 0x92, 0x06, 0x71, 0xFD, 0xCC, 0xCD,
+    0xEE, 0x20, 0x84, 0xF8, 0x6B, 0xE8, 0x8B, 0xD0, 0x74, 0x4F, 0xB3, 0x09, 0xD0, 0xDB, 0xE6, 0x2D,
+    0xDB, 0xB9, 0x6E, 0x9B, 0x73, 0x20, 0xE5, 0xE6, 0x12, 0xC9, 0x0C, 0xBE, 0x41, 0xD2, 0x6A, 0x73,
+    0xCA, 0xA3, 0x5A, 0x64, 0x1D, 0xE2, 0x4E, 0x30, 0xA2, 0x1E, 0x69, 0x58, 0x60, 0x01, 0x17, 0x02,
+    0x5E, 0x01, 0x75, 0x68, 0xCE, 0x19, 0xAA, 0x74, 0x69, 0x10, 0x9F, 0xEC, 0xDA, 0x08, 0x33, 0x93,
+    0x27, 0xCD, 0x3A, 0x5A, 0xC3, 0x72, 0xC5, 0x60, 0x87, 0x52, 0xAA, 0x95, 0x1E, 0x09, 0x31, 0xC4,
+    0xAD, 0x30, 0xF0, 0xEC, 0xAB, 0x5A, 0xDD, 0x25, 0x22, 0x9B, 0x63, 0x4E, 0x11, 0x66, 0x39, 0x4E,
+    0xB8, 0xD0, 0xBB, 0x26, 0x6E, 0x2E, 0xBC, 0xC7, 0x8E, 0x80, 0x22, 0x13, 0x2C, 0xC2, 0x89, 0x3F,
+    0x71, 0xB0, 0x8B, 0xFB, 0x3C, 0xC4, 0x97, 0xFE, 0x22, 0x55, 0x9D, 0xDB, 0x6B, 0x81, 0x07, 0xD8,
+    0xB9, 0x44, 0xD5, 0xC4, 0x87, 0x41, 0x70, 0x43, 0x68, 0x71, 0x03, 0x06, 0xBC, 0x91, 0xDD, 0x68,
+    0xAE, 0x95, 0x10, 0xDE, 0x82, 0x5F, 0xCB, 0x9F, 0x6D, 0xC1, 0x25, 0x6C, 0x64, 0x76, 0x58, 0xCE,
+    0x8E, 0x3A, 0x77, 0x44, 0xCB, 0xD8, 0x2A, 0x5A, 0x22, 0x11, 0x0D, 0x13, 0x12, 0xF0, 0x04, 0x92,
+    0xF1, 0x88, 0x82, 0x94, 0x8A, 0xF2, 0xB0, 0xE5, 0x1C, 0x67, 0x33, 0x9C, 0xF7, 0x3D, 0xB6, 0x5D,
+    0xF8, 0xB8, 0x20, 0xA2, 0x0E, 0x17, 0x86, 0x72, 0x74, 0x98, 0xB9, 0x28, 0x6D, 0x4D, 0x5A, 0x7C,
+    0xD3, 0xB9, 0x4D, 0x9C, 0xC1, 0x51, 0xC5, 0xDB, 0xF2, 0x9A, 0x16, 0xE9, 0x43, 0x7D, 0x66, 0xE6,
+    0xF0, 0xE9, 0x42, 0x8A, 0x7D, 0xED, 0xCF, 0x1E, 0xC9, 0xD6, 0x52, 0x40, 0x5C, 0x37, 0x1E, 0x3F,
+    0x95, 0x22, 0x32, 0x94, 0x4E, 0x5E, 0x9D, 0xE8, 0xA0, 0xA5, 0xB0, 0x12, 0x36, 0xD1, 0xB2, 0xD6,
+    0x52, 0xB0, 0xA6, 0x21, 0x30, 0xAE, 0x05, 0x65, 0x17, 0x51, 0x84, 0xD6, 0x4B, 0x36, 0x05, 0xAD,
+    0x85, 0x9B, 0x03, 0xDD, 0x31, 0x78, 0x5A, 0x48, 0x16, 0x15, 0x15, 0xFA, 0x52, 0xF2, 0x59, 0xB2,
+    0x59, 0xC8, 0x54, 0x0C, 0x7D, 0x6A, 0x8A, 0x15, 0xFC, 0x4F, 0x11, 0x56, 0xDA, 0x37, 0x96, 0xA2,
+    0x63, 0xEE, 0x45, 0x7C, 0x60, 0xA9, 0xF1, 0x56, 0x06, 0xB7, 0xE5, 0x49, 0x37, 0xAF, 0xA4, 0x68,
+    0xC4, 0x7B, 0x1A, 0xF7, 0x52, 0xC8, 0xF9, 0x59, 0x23, 0xD7, 0x4C, 0x91, 0x37, 0x54, 0xA0, 0xB2,
+    0x48, 0xD0, 0xD6, 0xA0, 0x00, 0x52, 0xC1, 0x9A, 0x8B, 0x14, 0x8C, 0x4E, 0x22, 0x39, 0x11, 0xCB,
+    0x80, 0xA0, 0xF8, 0xA7, 0xB4, 0x93, 0xF6, 0x85, 0x02, 0xF8, 0x45, 0x6E, 0xD5, 0x57, 0x6A, 0x01,
+    0xAA, 0x8C, 0x9F, 0xA1, 0x5A, 0x5F, 0x35, 0xAA, 0xCC, 0x2D, 0x5C, 0x56, 0x4E, 0x1F, 0x03, 0x0E,
+    0xBD, 0xE3, 0x69, 0x7E, 0xE7, 0x34, 0x87, 0xD7, 0x37, 0xAF, 0x31, 0xBB, 0x67, 0x35, 0x41, 0x24,
+    0xE5, 0xF4, 0x38, 0x24, 0x97, 0x9F, 0x09, 0x50, 0x31, 0xD1, 0x7D, 0x0A, 0xD1, 0xA0, 0x99, 0x54,
+    0x37, 0xAF, 0xCB, 0xBB, 0xE3, 0x70, 0x35, 0xC6, 0x3B, 0xB0, 0x27, 0x99, 0x38, 0xE5, 0xC5, 0xC5,
+    0x53, 0x96, 0x22, 0x06, 0x7E, 0xF5, 0x5F, 0x37, 0xC1, 0x70, 0xA7, 0xFD, 0xEF, 0xD5, 0x51, 0x10,
+    0xB5, 0xF4, 0xB3, 0x4C, 0x15, 0x85, 0x14, 0xBD, 0x70, 0xFB, 0x3D, 0x51, 0x2B, 0x84, 0x3B, 0xEE,
+    0xF5, 0x82, 0xF8, 0x99, 0xA8, 0x55, 0xCA, 0x42, 0x26, 0x55, 0x2D, 0x85, 0xA8, 0x55, 0x70, 0xBD,
+    0x2A, 0xA9, 0xD1, 0x47, 0xAC, 0xB5, 0x70, 0x3B, 0xCB, 0x9C, 0x8C, 0x62, 0xB0, 0x84, 0x5A, 0xE8,
+    0x19, 0xF3, 0xF3, 0x9C, 0x76, 0xF2, 0x96, 0xAF, 0x1A, 0xAA, 0x37, 0x32, 0x1F, 0xC6, 0x67, 0x0A,
+    0xD1, 0x2D, 0xDD, 0x70, 0x73, 0x01, 0xCC, 0x09, 0xEA, 0x65, 0x68, 0x2E, 0x7C, 0xE3, 0x2A, 0x77,
+    0x60, 0x99, 0x8F, 0x64, 0x7F, 0xEC, 0xFD, 0xEB, 0xB1, 0xCF, 0x1E, 0x8E, 0x7D, 0x31, 0xDE, 0x0C,
+    0x4C, 0xA3, 0xB0, 0x71, 0x97, 0xBD, 0x5E, 0xC2, 0x20, 0xF0, 0x63, 0xEF, 0x94, 0xD9, 0x83, 0x3D,
+    0x86, 0x66, 0x8F, 0x64, 0x2C, 0x8E, 0x8C, 0x81, 0x8D, 0xAB, 0x0F, 0xCF, 0x83, 0xA2, 0x6B, 0x6E,
+    0xB7, 0x53, 0xAD, 0x37, 0x22, 0xC4, 0x23, 0x87, 0xA9, 0xD7, 0x5F, 0x52, 0xBD, 0x98, 0xB0, 0x5F,
+    0x5A, 0x80, 0xCC, 0xF0, 0x1F, 0x25, 0xAA, 0xBF, 0x01, 0xF7, 0xF4, 0x8B, 0xE0, 0x1A, 0xF8, 0xB0,
+    0x71, 0x1B, 0x85, 0x2E, 0xEB, 0x68, 0x1A, 0xE3, 0x2B, 0x8F, 0xA4, 0xFF, 0xF5, 0x2E, 0xDB, 0xCF,
+    0xD7, 0x2B, 0x81, 0xB2, 0x43, 0x61, 0x59, 0xA5, 0x5D, 0xFA, 0x1D, 0xD0, 0x48, 0x89, 0xC8, 0x87,
+    0xEF, 0x1B, 0x53, 0xE5, 0xCA, 0x20, 0x60, 0x43, 0x64, 0x47, 0xD7, 0x12, 0x79, 0x18, 0x4F, 0x7B,
+    0xC7, 0xA5, 0x8F, 0x05, 0x41, 0xF1, 0x8C, 0x0C, 0x57, 0x2C, 0x5E, 0xB1, 0x4E, 0x7E, 0x41, 0xA6,
+    0xF1, 0xF2, 0xEF, 0x8C, 0xF8, 0x01, 0xD5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x9D, 0xB5, 0x21,
+    0x46, 0xD9, 0x62, 0x7B, 0xA4, 0x70, 0x2D, 0x42, 0x02, 0x37, 0x94, 0x91, 0xF6, 0x42, 0x93, 0x82,
+    0x02, 0x0A, 0x8E, 0x02, 0x1A, 0x5A, 0x44, 0x91, 0x3F, 0x80, 0x64, 0x2B, 0x57, 0xA4, 0xE4, 0xFE,
+    0x01, 0x14, 0x69, 0xA0, 0xA2, 0x4C, 0x81, 0x58, 0x93, 0x14, 0x14, 0x14, 0x31, 0xE2, 0x07, 0xC4,
+    0x91, 0x40, 0x08, 0x51, 0x60, 0x24, 0x47, 0x72, 0x84, 0xED, 0xE1, 0xCD, 0xFA, 0xC8, 0x25, 0xC7,
+    0x67, 0x85, 0xC0, 0xDA, 0x9D, 0xDD, 0x9B, 0x9D, 0xD9, 0x7D, 0x33, 0xFB, 0x66, 0x4F, 0x55, 0x44,
+    0x34, 0x48, 0x89, 0x54, 0x2B, 0x93, 0x02, 0xE2, 0x14, 0x1D, 0xFB, 0x4E, 0xDF, 0x88, 0x99, 0x3B,
+    0xCD, 0xCC, 0x63, 0xF4, 0xB4, 0x1B, 0x12, 0x59, 0x74, 0x93, 0x13, 0x85, 0xE2, 0x2A, 0x5E, 0x5E,
+    0xF1, 0xEE, 0xD6, 0x24, 0x64, 0xAE, 0x88, 0xB9, 0x25, 0xCB, 0x3C, 0x34, 0xC5, 0x9C, 0xC5, 0x00,
+    0x2E, 0x11, 0x14, 0x0A, 0xFB, 0x54, 0x09, 0x36, 0x1D, 0x60, 0xF2, 0x12, 0xFD, 0x33, 0x8B, 0x0F,
+    0x2D, 0xC2, 0x4E, 0xC3, 0x2E, 0xCC, 0x88, 0x02, 0xC1, 0x21, 0xCE, 0xCF, 0xE8, 0xB7, 0xDF, 0xE8,
+    0x0A, 0xFC, 0x0B, 0xC7, 0x5C, 0xE3, 0xD8, 0xDA, 0xBC, 0x9D, 0x07, 0xF6, 0x0D, 0x69, 0x37, 0x7A,
+    0xDC, 0x03, 0x63, 0xCE, 0x3D, 0xD2, 0x6E, 0xCE, 0xC2, 0x67, 0x20, 0x11, 0xA4, 0xD8, 0x70, 0x15,
+    0x7D, 0x1F, 0xBD, 0x01, 0x52, 0x16, 0x45, 0x4E, 0x0A, 0x76, 0xD4, 0xA0, 0x33, 0x10, 0xD6, 0x40,
+    0x56, 0x45, 0x19, 0x3D, 0xA2, 0xF3, 0xC7, 0xB0, 0xA8, 0x91, 0x64, 0x6A, 0x5D, 0x00, 0x49, 0xB7,
+    0x93, 0x1F, 0x65, 0x4A, 0x14, 0x87, 0x37, 0x37, 0x67, 0x99, 0x12, 0x40, 0xF5, 0x9C, 0x45, 0x74,
+    0x04, 0x08, 0x66, 0x72, 0xFE, 0xC6, 0x34, 0x53, 0x1E, 0xD0, 0x50, 0xD5, 0xAA, 0x22, 0x87, 0x10,
+    0x6C, 0x66, 0x33, 0x53, 0x9A, 0x32, 0x6A, 0xA3, 0x66, 0x2E, 0x31, 0x7F, 0x0D, 0x0C, 0xB6, 0x28,
+    0xC5, 0x2E, 0x4E, 0xC9, 0x0D, 0x4F, 0x40, 0x78, 0x32, 0xD4, 0x80, 0x29, 0x22, 0x19, 0x46, 0x3F,
+    0x11, 0x69, 0x54, 0x4F, 0x45, 0xA6, 0x1B, 0x72, 0x22, 0x38, 0x33, 0x22, 0x82, 0xF4, 0xBE, 0x59,
+    0x29, 0x6D, 0x94, 0x9F, 0xD8, 0x53, 0x57, 0xEE, 0x6A, 0xE5, 0x56, 0xAB, 0xE4, 0x44, 0xAB, 0x93,
+    0x0D, 0xB4, 0xC6, 0xBD, 0x6A, 0xDC, 0x6E, 0xC3, 0xBB, 0x3E, 0x17, 0xCB, 0xB8, 0x74, 0x0A, 0x38,
+    0xD5, 0xE3, 0xE2, 0x22, 0x6D, 0xDD, 0xA1, 0x33, 0x73, 0xD8, 0x04, 0x6D, 0xDF, 0x92, 0x5F, 0xB7,
+    0xF4, 0x58, 0xCB, 0x00, 0x71, 0xDA, 0x78, 0xDA, 0x4C, 0x66, 0x5E, 0x34, 0xAA, 0x89, 0xF3, 0xF8,
+    0x4D, 0x1B, 0xB6, 0xB6, 0xB0, 0xC5, 0xF7, 0x2C, 0xBD, 0x30, 0xA1, 0x00, 0x19, 0x8C, 0x73, 0x3F,
+    0xA0, 0x16, 0xD4, 0xEF, 0x86, 0x82, 0x54, 0x37, 0x1B, 0x4A, 0x04, 0x02, 0xF7, 0x7E, 0xB0, 0x25,
+    0x85, 0xFD, 0x80, 0x1B, 0xF9, 0x40, 0x7D, 0x4D, 0xA1, 0x86, 0x23, 0xB9, 0xE7, 0x9E, 0xBF, 0x18,
+    0x12, 0x5A, 0xC0, 0xA0, 0x90, 0x0A, 0x97, 0x53, 0x24, 0xB6, 0x19, 0x0D, 0x40, 0x5D, 0x87, 0x28,
+    0x84, 0xC5, 0x7E, 0x29, 0x6C, 0xFD, 0x92, 0xAE, 0x63, 0x29, 0x89, 0x41, 0xE9, 0x84, 0xE9, 0x76,
+    0xDB, 0x5F, 0x2B, 0xFB, 0xA5, 0xB0, 0xF1, 0x5E, 0x40, 0xE0, 0xBD, 0x32, 0xF1, 0x1A, 0x60, 0xE9,
+    0x60, 0x74, 0x8F, 0x6B, 0x7F, 0x16, 0x92, 0x20, 0x3C, 0xE8, 0x3C, 0x0C, 0x1C, 0x19, 0xF9, 0x1F,
+    0x7E, 0x29, 0x15, 0x84, 0xDD, 0x44, 0x32, 0x70, 0x5D, 0x84, 0x1B, 0x02, 0xD8, 0xF2, 0xD3, 0xCB,
+    0x44, 0x4B, 0x66, 0x09, 0x80, 0x57, 0x10, 0x86, 0xCA, 0x17, 0x8F, 0x25, 0xEA, 0xAE, 0x82, 0x21,
+    0x00, 0x80, 0x79, 0x25, 0x70, 0x87, 0xB5, 0xC5, 0x79, 0x9D, 0x01, 0x1C, 0x3B, 0xE6, 0x12, 0xF9,
+    0x00, 0x51, 0xA3, 0xCA, 0xBA, 0x4C, 0xB5, 0xE6, 0x23, 0xC8, 0xB5, 0x5A, 0x33, 0xC5, 0xAF, 0xBB,
+    0x38, 0xD7, 0x55, 0x32, 0x6E, 0xC2, 0x26, 0x2E, 0x1C, 0xB1, 0xAE, 0x4D, 0x61, 0xB7, 0xBB, 0xA0,
+    0x31, 0x25, 0x67, 0x50, 0x5B, 0x54, 0x08, 0x9B, 0x46, 0x75, 0xC9, 0x0E, 0x93, 0xDD, 0x83, 0x32,
+    0x62, 0x28, 0x09, 0x8F, 0x10, 0xA2, 0x03, 0x9D, 0x91, 0xCF, 0x7D, 0x09, 0xA3, 0xA6, 0x85, 0xD4,
+    0x93, 0xCC, 0x73, 0x4E, 0xFB, 0x8B, 0xD4, 0xA5, 0xC8, 0x85, 0xCD, 0xB9, 0x1B, 0x5D, 0xEB, 0xFA,
+    0xA7, 0xA2, 0xC0, 0x95, 0x7C, 0x41, 0xEE, 0x2C, 0x18, 0x5C, 0x05, 0x82, 0xB3, 0x34, 0xA8, 0x17,
+    0x5B, 0x38, 0x09, 0x7E, 0xC7, 0x3F, 0x18, 0xD7, 0x4A, 0x29, 0x20, 0x79, 0x5B, 0xC2, 0x43, 0x51,
+    0x98, 0xF7, 0xB2, 0x67, 0xBC, 0x97, 0x49, 0x4A, 0x24, 0xAD, 0xC1, 0x54, 0x2D, 0xB5, 0x69, 0x1F,
+    0x60, 0x31, 0x68, 0xE5, 0x76, 0xE3, 0xD2, 0xB5, 0xC3, 0xDB, 0x9C, 0x49, 0x5E, 0xBB, 0x40, 0x64,
+    0x19, 0x8A, 0x4C, 0x45, 0xD6, 0x14, 0xF4, 0xD5, 0xB7, 0xC6, 0x93, 0x19, 0xAC, 0x65, 0x11, 0x81,
+    0x87, 0x6F, 0xBC, 0x62, 0x4B, 0x44, 0xE8, 0x15, 0x67, 0xE9, 0x8F, 0x3E, 0xE5, 0x0E, 0xFB, 0x5A,
+    0x4F, 0x49, 0xF3, 0x27, 0xF0, 0x81, 0x0B, 0xC5, 0xB9, 0x6E, 0xE5, 0xF6, 0x2D, 0x36, 0xE2, 0xF5,
+    0x4E, 0x28, 0x67, 0x84, 0x1C, 0xAD, 0x45, 0x0C, 0xD1, 0x41, 0x7B, 0x14, 0x94, 0x7D, 0x38, 0x0B,
+    0xAA, 0x95, 0xA0, 0xF4, 0x54, 0x2D, 0x08, 0x3A, 0xB1, 0xD6, 0x95, 0x3C, 0xA0, 0x6E, 0x9B, 0x0F,
+    0xD4, 0x1A, 0xFB, 0x70, 0x6A, 0xED, 0x59, 0x64, 0x3C, 0x6F, 0x8C, 0xE7, 0x90, 0xF6, 0xFF, 0x09,
+    0xCA, 0x75, 0xB3, 0x07, 0x45, 0xF9, 0x69, 0xEC, 0xA7, 0xF2, 0x76, 0xD3, 0xE0, 0xB9, 0x4C, 0xCB,
+    0x4B, 0x90, 0x4B, 0x74, 0xEE, 0xBF, 0x88, 0xE1, 0x9F, 0xFB, 0xBE, 0x02, 0xCD, 0x55, 0xB1, 0x8E,
+    0xD4, 0x30, 0x10, 0x7D, 0x71, 0x24, 0x2C, 0x11, 0x21, 0x53, 0x51, 0x5C, 0x81, 0x7F, 0x00, 0xE1,
+    0x96, 0xE2, 0x58, 0x47, 0xA2, 0xA0, 0x3C, 0x1A, 0x68, 0xEE, 0x0F, 0x68, 0xEE, 0x0B, 0xF6, 0x12,
+    0x89, 0x82, 0x92, 0x6B, 0xE8, 0xF9, 0x0C, 0x8A, 0x3B, 0x12, 0x89, 0xE2, 0xDA, 0x74, 0x94, 0xA4,
+    0x81, 0x2B, 0x09, 0x22, 0x45, 0x0E, 0x36, 0x19, 0x66, 0x9C, 0x78, 0x05, 0x1C, 0x48, 0xDB, 0x20,
+    0x9D, 0x57, 0xB1, 0x67, 0x27, 0x9E, 0xF1, 0x9B, 0x37, 0xE3, 0x09, 0x70, 0xAA, 0x6A, 0x20, 0x3B,
+    0xCD, 0x00, 0xEC, 0xEF, 0xEF, 0xF3, 0xDC, 0x16, 0x2D, 0x90, 0x96, 0x05, 0x7E, 0x1F, 0x47, 0x53,
+    0x0E, 0x58, 0xA2, 0x16, 0x8A, 0x7E, 0x50, 0x0F, 0x3F, 0xA0, 0xE8, 0x15, 0xE5, 0xF0, 0x9D, 0xE9,
+    0x01, 0xDF, 0x56, 0x25, 0x50, 0xBC, 0xDF, 0xF0, 0x56, 0x3A, 0xE8, 0x80, 0x64, 0x2C, 0xD8, 0x20,
+    0xBD, 0x14, 0x85, 0xB9, 0x60, 0x05, 0xDC, 0x47, 0x3E, 0x09, 0x95, 0x38, 0x56, 0x8B, 0x9A, 0x0D,
+    0xE1, 0x5F, 0xF1, 0x4B, 0x35, 0x7A, 0x9E, 0x5D, 0x57, 0x8D, 0xF9, 0x21, 0xD5, 0xC4, 0x63, 0x52,
+    0x32, 0x77, 0xA9, 0xCC, 0xA5, 0xCC, 0x03, 0x44, 0xC3, 0x3E, 0x8F, 0xE8, 0x24, 0x82, 0xD2, 0x5D,
+    0xC6, 0x60, 0x5D, 0xED, 0xD9, 0x33, 0xF1, 0x0F, 0xE9, 0x26, 0x65, 0xCF, 0xA6, 0xB7, 0xDD, 0xF5,
+    0x47, 0x6F, 0xF3, 0x53, 0x35, 0x9C, 0xC1, 0x8D, 0x6C, 0xCF, 0xC7, 0xD6, 0xA0, 0x0D, 0x26, 0xD7,
+    0x90, 0xFC, 0x9B, 0xC7, 0x5E, 0x14, 0x36, 0xCB, 0x9A, 0xF6, 0xDB, 0xC0, 0x17, 0xC1, 0x34, 0x8B,
+    0xE0, 0xCA, 0x45, 0xD8, 0x26, 0x6E, 0x5A, 0x56, 0x75, 0xC5, 0xDA, 0xB4, 0x11, 0x42, 0xBD, 0x08,
+    0x3E, 0x58, 0xDF, 0xA0, 0xCB, 0x6A, 0xF6, 0x41, 0x14, 0x40, 0x28, 0xFA, 0x4E, 0xC1, 0x3A, 0x9B,
+    0x60, 0x83, 0x3F, 0x3B, 0xC0, 0x48, 0x18, 0x4C, 0x19, 0x3C, 0x89, 0x39, 0x73, 0x5F, 0x14, 0x82,
+    0x82, 0x29, 0x24, 0x27, 0x9E, 0x89, 0xD3, 0x60, 0xBA, 0x80, 0x40, 0x0F, 0x41, 0x18, 0x61, 0xBA,
+    0x6C, 0x16, 0x5C, 0xA3, 0x67, 0xA1, 0x28, 0x17, 0x81, 0xE6, 0x68, 0x46, 0x35, 0x21, 0xEC, 0x21,
+    0x4E, 0x61, 0xB0, 0xA2, 0x83, 0x1E, 0x56, 0x1C, 0x56, 0x5F, 0x5A, 0x84, 0x23, 0x0A, 0x6A, 0x0E,
+    0xE7, 0x43, 0x85, 0x58, 0x11, 0x2C, 0xCD, 0xB4, 0x22, 0x13, 0x01, 0x8B, 0x10, 0x30, 0x1B, 0x92,
+    0x7C, 0xCB, 0xE6, 0xCF, 0x74, 0x39, 0x87, 0x15, 0xC3, 0x0D, 0x16, 0x12, 0x5F, 0xE4, 0x48, 0x47,
+    0x8E, 0xCC, 0x10, 0xF9, 0x8C, 0x0C, 0xFB, 0xC8, 0x30, 0x2D, 0xD6, 0x09, 0x45, 0x3E, 0xA3, 0x75,
+    0x16, 0xAD, 0x6D, 0xCC, 0xED, 0x03, 0xFC, 0x7D, 0x64, 0xC1, 0xD9, 0xBB, 0x20, 0x86, 0x03, 0xAA,
+    0x80, 0xE4, 0xF6, 0x95, 0x8D, 0x52, 0xC0, 0xD5, 0x39, 0xFB, 0x75, 0x5F, 0x49, 0x0E, 0x60, 0xE8,
+    0x8A, 0xFE, 0x54, 0x32, 0xF5, 0x09, 0x09, 0x55, 0xA1, 0x72, 0x6D, 0xC7, 0x4A, 0x3D, 0x88, 0x72,
+    0x0A, 0xCA, 0x17, 0xA2, 0x6C, 0xB7, 0xCA, 0x51, 0x94, 0xD5, 0xA3, 0x51, 0x42, 0xAA, 0x6A, 0xDE,
+    0xEE, 0xA6, 0xD7, 0xD5, 0x46, 0x07, 0xDE, 0x42, 0x9D, 0x3A, 0xE1, 0x54, 0x8A, 0xB5, 0x11, 0x5A,
+    0x63, 0x3D, 0x41, 0x05, 0xCC, 0x01, 0xED, 0x5B, 0x99, 0x1E, 0x06, 0x7A, 0x64, 0xBA, 0x99, 0x63,
+    0xA7, 0xB1, 0xF7, 0x06, 0x78, 0xFE, 0x72, 0xFC, 0xCF, 0xC1, 0x3C, 0xDD, 0x25, 0x98, 0x7B, 0xDB,
+    0xB2, 0xB7, 0x92, 0x69, 0x7B, 0xC0, 0x6F, 0xEE, 0x4A, 0x5C, 0xB7, 0xA0, 0xF2, 0xEB, 0x9B, 0x04,
+    0x07, 0x2F, 0x77, 0x9D, 0x6F, 0xBB, 0x1E, 0x34, 0xF7, 0x92, 0x49, 0x2A, 0x97, 0x5B, 0x4D, 0xFD,
+    0x57, 0xBE, 0x6D, 0x7F, 0x6D, 0x8A, 0x27, 0x39, 0xF9, 0x57, 0xF1, 0x98, 0x12, 0xBB, 0x0F, 0x69,
+    0x5D, 0x5A, 0x20, 0xA6, 0x83, 0x6D, 0x90, 0x84, 0x2E, 0x4F, 0xDC, 0x42, 0xF8, 0xFE, 0x30, 0x30,
+    0x5F, 0x27, 0x13, 0x37, 0x16, 0x86, 0xC6, 0x41, 0xEA, 0x8D, 0x74, 0x74, 0x7A, 0x2C, 0xF8, 0xBF,
+    0x31, 0xDE, 0x34, 0xB4, 0x85, 0x4A, 0xAE, 0xBC, 0x11, 0xBE, 0x14, 0x49, 0x3D, 0x4B, 0xC3, 0x9E,
+    0x2F, 0xFB, 0x7C, 0x8B, 0x03, 0x62, 0xF9, 0xF2, 0xC1, 0x0D, 0x73, 0xBF, 0x13, 0x4B, 0x51, 0x86,
+    0x1E, 0x52, 0xB0, 0x72, 0xCD, 0x10, 0x9A, 0x79, 0xF9, 0xC4, 0x1A, 0x6E, 0x6E, 0x34, 0xE1, 0x38,
+    0x1B, 0x75, 0x93, 0xF5, 0x6B, 0xD8, 0xF3, 0x06, 0xAB, 0x35, 0xD4, 0x45, 0x58, 0xCC, 0x87, 0x46,
+    0x0F, 0xC7, 0x9A, 0x98, 0xA0, 0xB2, 0xA0, 0x52, 0xF3, 0xE7, 0xE7, 0x17, 0xF3, 0x79, 0x01, 0xEE,
+    0x3C, 0xE1, 0x14, 0x8C, 0xD0, 0xAD, 0xCD, 0x4D, 0x99, 0xD6, 0x0E, 0x49, 0xC3, 0xD4, 0xB4, 0x2B,
+    0x26, 0x7E, 0x85, 0x33, 0xAC, 0x98, 0xB7, 0x55, 0xD2, 0x84, 0xC7, 0x27, 0x1C, 0x26, 0x7F, 0x07,
+    0x3C, 0x07, 0xED, 0xB9, 0x39, 0x15, 0xDC, 0x63, 0xB9, 0xD3, 0x9F, 0xF1, 0xB3, 0xE2, 0x67, 0x5D,
+    0xDC, 0x7F, 0x36, 0x56, 0x8E, 0x36, 0xFC, 0x74, 0x55, 0x36, 0xED, 0x78, 0x31, 0xF1, 0x13, 0xB5,
+    0x55, 0x3D, 0x8F, 0x14, 0x47, 0x10, 0x7D, 0xD3, 0x23, 0x6E, 0x0C, 0xCD, 0xA9, 0x13, 0xCB, 0xE2,
+    0x23, 0x98, 0xC4, 0x01, 0x01, 0xBA, 0x4E, 0x09, 0x8E, 0xEB, 0xB1, 0x9C, 0x11, 0x11, 0x39, 0xE1,
+    0x47, 0x40, 0xE0, 0x80, 0xE0, 0x76, 0x67, 0x70, 0x42, 0x4A, 0x02, 0x31, 0x01, 0x22, 0x71, 0x42,
+    0x40, 0x70, 0xC1, 0x1E, 0xDB, 0x44, 0xA4, 0x23, 0x39, 0x70, 0xE8, 0x71, 0x80, 0x64, 0x48, 0x68,
+    0xC4, 0x20, 0xCD, 0x99, 0xD9, 0x6D, 0xBF, 0xEA, 0x5D, 0xC3, 0xF1, 0x21, 0x1B, 0x89, 0xA3, 0x67,
+    0x6B, 0xFA, 0x63, 0xB7, 0xDF, 0xEB, 0xAE, 0x7A, 0x55, 0x0B, 0xB0, 0x4D, 0x68, 0x45, 0xC7, 0x57,
+    0x5D, 0x71, 0x30, 0xE0, 0x5D, 0xB3, 0x7F, 0x06, 0xD4, 0x71, 0x86, 0xFA, 0xD7, 0x08, 0x07, 0xEB,
+    0x2D, 0xF2, 0x60, 0x1A, 0xEC, 0xE7, 0x1E, 0xF6, 0x87, 0xC0, 0x4D, 0xBB, 0x50, 0x83, 0x05, 0x62,
+    0xD1, 0x62, 0xEE, 0xE3, 0x9D, 0x18, 0x5C, 0x8C, 0x63, 0x11, 0x63, 0xE4, 0xB6, 0xDF, 0x5B, 0x15,
+    0x6F, 0xF4, 0xC0, 0x69, 0x02, 0x19, 0xA1, 0xF0, 0x40, 0xDE, 0x02, 0x59, 0xE0, 0x64, 0xC4, 0x7F,
+    0x34, 0x3D, 0xEC, 0xA2, 0x8C, 0x2F, 0x50, 0x3E, 0x8F, 0xDE, 0x78, 0x1D, 0xB4, 0xC7, 0x98, 0x77,
+    0xB0, 0x55, 0x80, 0x6E, 0x77, 0x91, 0x0D, 0x25, 0xF0, 0x88, 0x8B, 0xEE, 0x71, 0x0F, 0x1B, 0xDC,
+    0xD3, 0xF9, 0x68, 0x48, 0x99, 0xD1, 0x7C, 0x19, 0x5F, 0xF7, 0x98, 0x77, 0x93, 0x15, 0xD0, 0x43,
+    0xB9, 0x14, 0xCD, 0x91, 0x72, 0xC2, 0x73, 0x5E, 0x27, 0xF7, 0xF7, 0x38, 0x71, 0x74, 0x2C, 0xDF,
+    0x8A, 0x93, 0xDA, 0x0B, 0x30, 0xE7, 0x37, 0x51, 0xFC, 0xF8, 0xA4, 0xCA, 0xDA, 0xDA, 0xE3, 0x67,
+    0xD5, 0x1C, 0x99, 0xFB, 0x14, 0x1F, 0x2C, 0xF9, 0xB8, 0xA6, 0x6E, 0xCA, 0x50, 0x06, 0x3D, 0xEA,
+    0xF1, 0x68, 0x03, 0xA4, 0x18, 0xFA, 0xFC, 0x26, 0xC1, 0x3C, 0x83, 0x73, 0xED, 0x02, 0xB0, 0xB9,
+    0x09, 0xA8, 0xC8, 0x85, 0xAD, 0x43, 0x31, 0x51, 0xCB, 0x12, 0x45, 0x7C, 0xE3, 0x8B, 0xBF, 0xE7,
+    0x21, 0x0F, 0x6A, 0x54, 0x81, 0x84, 0x03, 0x3D, 0xB5, 0x0D, 0xD5, 0xD3, 0x53, 0x53, 0x86, 0xD7,
+    0xFE, 0x12, 0x60, 0xC2, 0x04, 0x7A, 0x34, 0x07, 0x57, 0x63, 0x2E, 0x9E, 0xAA, 0x63, 0x0C, 0x45,
+    0x5C, 0x4C, 0x60, 0x87, 0xB2, 0x12, 0x9C, 0xE2, 0x20, 0x61, 0x95, 0xB1, 0x13, 0xB8, 0x17, 0xAD,
+    0x05, 0x11, 0x63, 0x95, 0x75, 0x04, 0x8D, 0x0D, 0x2E, 0x0A, 0xAE, 0x3F, 0x76, 0xB5, 0x21, 0x34,
+    0xF7, 0x07, 0xA2, 0xB3, 0xFB, 0x8B, 0x04, 0xF5, 0xE5, 0x24, 0x21, 0x4B, 0x15, 0x29, 0xA1, 0x49,
+    0xC2, 0xD5, 0x72, 0x4C, 0x21, 0x3B, 0xC0, 0x71, 0xE1, 0x63, 0xAB, 0xEA, 0xD4, 0xB5, 0x64, 0xE5,
+    0xA8, 0x17, 0xE2, 0x4B, 0xF1, 0x56, 0xBA, 0x43, 0x11, 0x7D, 0x1E, 0x47, 0xC4, 0xFB, 0x0D, 0x51,
+    0xF2, 0x3E, 0x69, 0x43, 0x84, 0xBF, 0x4F, 0x31, 0xF0, 0xEE, 0x53, 0xCE, 0xB8, 0xE8, 0x5A, 0x72,
+    0xDE, 0x6E, 0x18, 0x6C, 0xB8, 0x38, 0xA0, 0x5E, 0x56, 0xE0, 0x76, 0xC3, 0xDF, 0x29, 0x72, 0x9F,
+    0x4C, 0x9D, 0xE1, 0xEF, 0xEE, 0xAD, 0xFC, 0xC2, 0x11, 0x1E, 0x49, 0x28, 0xF8, 0xA5, 0xEE, 0x3F,
+    0x2D, 0xE8, 0xB3, 0x4C, 0x2A, 0x9E, 0x2C, 0x1F, 0xF2, 0xD6, 0x78, 0x04, 0xDE, 0x66, 0x77, 0x07,
+    0x3F, 0xCD, 0x18, 0x0B, 0x39, 0xE3, 0xB3, 0xFD, 0x6A, 0x95, 0x84, 0x53, 0x91, 0x2A, 0xB5, 0xE3,
+    0x7A, 0x9C, 0x32, 0xAB, 0x38, 0x8D, 0xD4, 0xDB, 0x88, 0xB3, 0x4B, 0xAE, 0x6E, 0xF3, 0xDB, 0xEB,
+    0xB4, 0x7E, 0x95, 0x42, 0x94, 0x2A, 0x36, 0x6E, 0xE1, 0xB3, 0xDA, 0x91, 0xF0, 0xB3, 0x51, 0x56,
+    0xC9, 0x11, 0x96, 0x78, 0x7B, 0x3B, 0x50, 0x6D, 0xD1, 0x6C, 0x00, 0xCD, 0xD7, 0xE0, 0xCB, 0xA9,
+    0xB2, 0x82, 0x8F, 0xEE, 0x75, 0x6F, 0x06, 0x93, 0xEC, 0x6B, 0xDD, 0xED, 0x8C, 0x48, 0x40, 0x51,
+    0x71, 0x01, 0xDF, 0xBD, 0xBD, 0x8C, 0x15, 0x99, 0x59, 0xC9, 0x8E, 0xAD, 0xF5, 0x48, 0x14, 0x9F,
+    0xBF, 0xF7, 0xAA, 0x8A, 0x3E, 0xEB, 0xB6, 0x0B, 0x3F, 0x94, 0xEA, 0xEE, 0xA1, 0x54, 0x09, 0x56,
+    0x85, 0x2D, 0xD5, 0xF1, 0x6D, 0xF3, 0xE0, 0xD6, 0x9F, 0x9E, 0xD5, 0xF5, 0x1B, 0xBA, 0xCF, 0xB3,
+    0xF0, 0x40, 0xFF, 0xD1, 0xE8, 0x66, 0x4F, 0xA3, 0x38, 0xE4, 0x3B, 0x96, 0x1A, 0x52, 0x60, 0x96,
+    0xF2, 0x4E, 0x37, 0xFF, 0x4E, 0x6C, 0xDA, 0x43, 0x36, 0xA9, 0x99, 0xEE, 0xED, 0x64, 0x91, 0xCA,
+    0xB5, 0xF1, 0xE6, 0xF1, 0x98, 0x8D, 0xB6, 0xB5, 0xBF, 0x2D, 0xF2, 0x85, 0xEB, 0x5C, 0xF7, 0x81,
+    0x77, 0x66, 0x09, 0x37, 0x75, 0xA4, 0xDA, 0x7B, 0x37, 0xF3, 0x09, 0xCF, 0x7C, 0xD4, 0x11, 0xB7,
+    0x6C, 0xE5, 0x34, 0x49, 0x5A, 0xD1, 0x63, 0x2D, 0xEF, 0x74, 0x1C, 0x48, 0x4A, 0x43, 0xDC, 0xB7,
+    0x1E, 0xA6, 0xE2, 0x91, 0x0E, 0x6C, 0x22, 0x6B, 0xBB, 0x8E, 0xE3, 0x45, 0x64, 0x4B, 0xF5, 0x8A,
+    0x55, 0xB3, 0xD2, 0x33, 0x49, 0x2E, 0xE7, 0xE9, 0x7E, 0xF1, 0x6D, 0x0B, 0x16, 0x80, 0x7D, 0x91,
+    0xAE, 0x16, 0xF7, 0x31, 0x18, 0x5A, 0x12, 0x4D, 0xA0, 0x08, 0xC8, 0x28, 0xB9, 0x98, 0xFE, 0x83,
+    0x12, 0xE0, 0x31, 0xDC, 0x45, 0xED, 0x1F, 0xE0, 0x65, 0xF7, 0x00, 0x1D, 0x97, 0xBA, 0xD2, 0xBF,
+    0x77, 0xAD, 0xEC, 0x32, 0x4A, 0xBB, 0x64, 0xF9, 0x8E, 0xDE, 0xF6, 0xBA, 0xB3, 0x6D, 0x1E, 0xAC,
+    0x57, 0xBD, 0xAB, 0x32, 0xB1, 0x61, 0x6D, 0xA3, 0xAB, 0xD4, 0xE8, 0x9A, 0x95, 0xD5, 0x87, 0x6C,
+    0xEE, 0xD5, 0x22, 0xAB, 0x3E, 0x48, 0xDE, 0x8D, 0x87, 0x9F, 0x4E, 0x1E, 0x7B, 0x20, 0xC7, 0x6C,
+    0xF4, 0x72, 0x1E, 0x4A, 0xE1, 0xA0, 0xAB, 0x76, 0xA8, 0x29, 0x8A, 0x6A, 0xCA, 0xC2, 0xB1, 0x43,
+    0x9B, 0x52, 0x5C, 0x53, 0xAE, 0x2F, 0xDC, 0xD3, 0x2B, 0xF2, 0x27, 0xD1, 0xB3, 0x74, 0x75, 0x14,
+    0x57, 0x93, 0x12, 0x05, 0xE7, 0x3E, 0x4E, 0xDC, 0xA2, 0xFD, 0xBC, 0xC4, 0xFD, 0x62, 0xEE, 0xFF,
+    0x69, 0xFF, 0x00, 0xCD, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0x9E, 0xDD, 0xD5, 0x69, 0x25, 0x5C,
+    0x2C, 0x0D, 0x15, 0xC5, 0xFE, 0x02, 0xE2, 0x3F, 0x70, 0x79, 0xEB, 0x40, 0x91, 0x92, 0x8A, 0x2A,
+    0x45, 0x7E, 0x42, 0xFE, 0xC0, 0x3D, 0xDB, 0x09, 0x05, 0x45, 0x8A, 0xF0, 0x13, 0xD2, 0x52, 0x85,
+    0x32, 0xC5, 0x7B, 0x78, 0x95, 0x14, 0x94, 0x18, 0x5D, 0x41, 0x89, 0x13, 0x44, 0x9D, 0x8D, 0xE4,
+    0x48, 0xBE, 0x64, 0xED, 0xC9, 0x37, 0x7E, 0x77, 0xE2, 0x08, 0x04, 0x21, 0x71, 0x08, 0xD6, 0x6F,
+    0x9E, 0xEC, 0x59, 0xEF, 0xCC, 0x7C, 0x33, 0xDF, 0x8C, 0x49, 0x55, 0x44, 0x36, 0x12, 0xB9, 0x81,
+    0x68, 0x33, 0x11, 0x8D, 0xD7, 0xC8, 0xB4, 0xB6, 0x3D, 0x22, 0xC2, 0xC6, 0x3B, 0xAB, 0x3C, 0x23,
+    0xCD, 0xDC, 0x16, 0x4B, 0x97, 0x7C, 0xD4, 0x63, 0x20, 0xCA, 0x1B, 0xA2, 0xED, 0x96, 0xA8, 0xDE,
+    0xE3, 0x34, 0xA4, 0xAE, 0x21, 0xD0, 0xCF, 0xE1, 0xD7, 0x5B, 0xD9, 0x31, 0x8F, 0x05, 0xF3, 0xA0,
+    0x70, 0x86, 0x4A, 0xD8, 0xDE, 0xAB, 0xA8, 0xDE, 0xDC, 0x88, 0xE6, 0xE9, 0x93, 0x68, 0x22, 0xB7,
+    0x26, 0x06, 0xFA, 0xD3, 0xF5, 0x0F, 0xFD, 0xD8, 0x64, 0x53, 0xB1, 0x5E, 0x2E, 0xB9, 0xF1, 0x70,
+    0xFD, 0x1B, 0x7E, 0x48, 0x27, 0x18, 0x09, 0x92, 0x40, 0x3C, 0x50, 0xD7, 0x22, 0x8B, 0xF9, 0x0F,
+    0x4E, 0xD4, 0x17, 0x9F, 0x32, 0xF3, 0x1C, 0xF0, 0x37, 0x5C, 0x72, 0x0D, 0x31, 0x12, 0x55, 0x83,
+    0x53, 0x85, 0x1C, 0xE7, 0xB8, 0xBE, 0x0D, 0x6B, 0x06, 0x77, 0x4A, 0x4C, 0x3F, 0x86, 0x5C, 0x87,
+    0x78, 0x48, 0x01, 0xA5, 0x11, 0x03, 0x72, 0x68, 0x07, 0x41, 0xA4, 0xE4, 0xCE, 0x8B, 0x27, 0x81,
+    0x74, 0xD3, 0x0A, 0x46, 0x73, 0x97, 0x55, 0x76, 0x2F, 0xDA, 0x6C, 0x4F, 0xD3, 0x46, 0xA7, 0xAD,
+    0xAF, 0xB2, 0xBF, 0xDF, 0x6F, 0xCC, 0xB3, 0xB1, 0x54, 0x53, 0xED, 0x62, 0xED, 0x9E, 0x0E, 0xE1,
+    0x33, 0x3E, 0xEB, 0x62, 0xC3, 0xDC, 0x0B, 0x1E, 0xEA, 0x20, 0x0E, 0x98, 0x0C, 0xCC, 0x28, 0x89,
+    0x65, 0x2F, 0xB8, 0xC4, 0x3E, 0x6C, 0x17, 0xC3, 0x79, 0xA4, 0x02, 0xAD, 0x3E, 0x07, 0x2C, 0x1B,
+    0x16, 0x1B, 0xBA, 0x87, 0x22, 0x5E, 0x80, 0x3A, 0x12, 0x60, 0xD8, 0x2D, 0x81, 0xC9, 0x63, 0xE7,
+    0xE3, 0xE1, 0x72, 0x22, 0xF6, 0xA4, 0x5F, 0x8D, 0x54, 0xFC, 0xD4, 0x53, 0x79, 0xBB, 0xA5, 0x7D,
+    0x4D, 0x7A, 0x9C, 0xC8, 0x9D, 0x26, 0x0A, 0x0F, 0x22, 0x2D, 0x81, 0xCC, 0x94, 0xC9, 0xFD, 0x32,
+    0x11, 0xDF, 0x67, 0x5E, 0x3C, 0xF3, 0x84, 0x94, 0xA5, 0x8E, 0x7F, 0x8E, 0xCD, 0xD4, 0x1C, 0x2C,
+    0x3C, 0x3C, 0xE4, 0xE6, 0x1A, 0x6E, 0xD3, 0x21, 0x23, 0x1B, 0x7A, 0xFF, 0xD2, 0x17, 0xCE, 0xAA,
+    0xD5, 0xD9, 0xAB, 0x89, 0x8A, 0xD3, 0x81, 0xC2, 0xE7, 0x97, 0x9C, 0x89, 0xEF, 0xC1, 0x2C, 0x25,
+    0x9C, 0x21, 0x19, 0x03, 0x4A, 0xF4, 0x84, 0xB9, 0x51, 0xFC, 0xEC, 0xB7, 0x32, 0x1E, 0xC3, 0x27,
+    0x9E, 0x42, 0x46, 0xF6, 0x77, 0xA8, 0xC6, 0x09, 0xFA, 0xE2, 0xC3, 0xAB, 0xF2, 0xE0, 0xA2, 0x8B,
+    0x4D, 0xD5, 0xE8, 0x59, 0xCF, 0xC5, 0xE4, 0xA6, 0x72, 0x08, 0xC3, 0x95, 0x26, 0xEC, 0x93, 0x03,
+    0x80, 0x95, 0x48, 0xE3, 0x81, 0x26, 0xFA, 0x21, 0xFD, 0x9D, 0x85, 0x42, 0x07, 0x30, 0xA0, 0xF6,
+    0x70, 0xEC, 0x7A, 0xCA, 0x36, 0x51, 0x36, 0xA3, 0x9E, 0x14, 0xFE, 0x69, 0x01, 0x51, 0x9A, 0x9B,
+    0x88, 0xE3, 0x87, 0x81, 0xFC, 0x0B, 0xE1, 0x4E, 0x4F, 0x16, 0xFC, 0x35, 0x10, 0x05, 0x1E, 0x11,
+    0x83, 0x04, 0x0C, 0x2E, 0x41, 0xEC, 0x4C, 0x74, 0x27, 0x53, 0xC9, 0x09, 0x12, 0xA9, 0x5C, 0x40,
+    0x8F, 0xAF, 0x2F, 0x5A, 0x00, 0x25, 0x94, 0x98, 0x76, 0x87, 0x87, 0xA5, 0xD2, 0x3C, 0xD3, 0xAE,
+    0x1C, 0x4A, 0xFA, 0xAE, 0x88, 0xC5, 0x8F, 0x89, 0x1E, 0x9F, 0x90, 0xF3, 0x64, 0xBE, 0x8F, 0xEA,
+    0xE5, 0xFA, 0xB0, 0xF5, 0x14, 0x6C, 0x0C, 0x37, 0xC6, 0xAE, 0x6D, 0xB8, 0xF2, 0x8B, 0x70, 0x50,
+    0x01, 0x18, 0x3A, 0xD6, 0x57, 0x64, 0xFA, 0x15, 0xE5, 0xF5, 0x8B, 0xE2, 0xE8, 0xD1, 0x4C, 0x06,
+    0x62, 0x27, 0x9B, 0x8B, 0xF5, 0xFA, 0x0F, 0xD1, 0x1E, 0xE1, 0xA5, 0x20, 0x83, 0x03, 0x4D, 0xBA,
+    0xBC, 0x3F, 0xEF, 0x6B, 0xA7, 0x51, 0xB9, 0xD2, 0x60, 0x9D, 0x08, 0x56, 0xAC, 0x53, 0xD9, 0x89,
+    0x22, 0x0B, 0x00, 0xFB, 0x5C, 0x3A, 0x34, 0xDC, 0x94, 0x01, 0x91, 0x11, 0x2C, 0x1A, 0x54, 0xFA,
+    0x2D, 0x54, 0xA8, 0xB9, 0xCA, 0x34, 0x8B, 0x42, 0x0B, 0x63, 0x2B, 0xA0, 0x80, 0x02, 0x83, 0x1D,
+    0xBF, 0x32, 0x4A, 0xDF, 0x06, 0x64, 0x18, 0x0B, 0x10, 0x98, 0x33, 0x81, 0x90, 0x3C, 0x19, 0x51,
+    0x60, 0x50, 0xE2, 0x40, 0x2F, 0x13, 0xAC, 0xFB, 0x72, 0x16, 0x28, 0x1E, 0x0A, 0x83, 0x3B, 0x70,
+    0xFD, 0x11, 0xE2, 0xED, 0x98, 0xE3, 0x47, 0xBF, 0xFB, 0x20, 0x74, 0x5F, 0x45, 0xC5, 0x4B, 0x52,
+    0xCB, 0xA3, 0x8C, 0xC9, 0xD0, 0xA1, 0x86, 0x2E, 0x6E, 0x90, 0x74, 0x07, 0xDE, 0x62, 0x24, 0xF9,
+    0xBB, 0x09, 0x71, 0xEC, 0xD0, 0x3B, 0x1E, 0x3E, 0xCD, 0x72, 0x8B, 0xA3, 0xF8, 0x01, 0x4B, 0x33,
+    0xC6, 0xE7, 0xED, 0xAA, 0x58, 0x6C, 0x4F, 0x1F, 0x90, 0x6A, 0x85, 0xA0, 0x6E, 0xA5, 0xE8, 0x89,
+    0x40, 0x16, 0xCC, 0x8A, 0x67, 0x3A, 0x9F, 0xA7, 0x7F, 0xBD, 0xFE, 0x5F, 0xC9, 0xC2, 0x68, 0xFA,
+    0x16, 0x73, 0xE9, 0x18, 0x5C, 0xC6, 0x37, 0x14, 0x07, 0x71, 0x06, 0xBB, 0xDF, 0xBC, 0x3B, 0x96,
+    0x16, 0x8F, 0x38, 0xDF, 0x44, 0xFB, 0xBA, 0x4B, 0x26, 0xE9, 0x8C, 0x06, 0x08, 0x84, 0xC9, 0xD1,
+    0x1F, 0x23, 0x7B, 0x98, 0xF4, 0x35, 0xB2, 0x57, 0xDE, 0x4B, 0xE4, 0xD2, 0x96, 0x8A, 0xEC, 0xCE,
+    0xEE, 0xB0, 0x78, 0x95, 0x61, 0x9D, 0x2C, 0xCF, 0x5B, 0x7C, 0x78, 0x7C, 0x45, 0x57, 0xB6, 0xDE,
+    0x02, 0xD5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x1D, 0xDB, 0x0A, 0x8B, 0x64, 0x29, 0xDB, 0x23,
+    0x24, 0x7F, 0x01, 0x6C, 0x4B, 0x11, 0xC5, 0x0E, 0xFF, 0x90, 0x88, 0x8E, 0x36, 0x12, 0x05, 0x0D,
+    0x05, 0x05, 0x89, 0x2D, 0x5A, 0x1A, 0x1A, 0x7A, 0x0A, 0xC4, 0x57, 0x90, 0xB3, 0xC3, 0x17, 0xF8,
+    0x13, 0x2C, 0x41, 0x43, 0xB7, 0x52, 0x1C, 0xE1, 0x5C, 0x6C, 0x0F, 0xEF, 0xED, 0xDD, 0x25, 0x42,
+    0x0A, 0x12, 0x52, 0x0A, 0xC2, 0xEA, 0x6E, 0x6E, 0x6F, 0x76, 0x77, 0xE6, 0xCD, 0x9B, 0xD9, 0x59,
+    0x11, 0xDB, 0x0A, 0x46, 0x5D, 0x41, 0x24, 0xCA, 0x69, 0x36, 0x51, 0x2E, 0x46, 0x2A, 0xCE, 0x3C,
+    0x15, 0xEF, 0x3A, 0xC8, 0x29, 0x6B, 0xA0, 0xF0, 0x79, 0x21, 0xE2, 0xAA, 0x05, 0x15, 0x11, 0xB6,
+    0x18, 0x9F, 0xF4, 0x54, 0xA4, 0xD8, 0x38, 0x09, 0xB6, 0x18, 0x2F, 0x79, 0xC5, 0x4F, 0x4D, 0x05,
+    0x3E, 0xA9, 0xAA, 0x8E, 0x92, 0x43, 0xFA, 0x08, 0x42, 0x3B, 0x4B, 0xD9, 0xE4, 0xB0, 0xA6, 0x4F,
+    0x67, 0x91, 0x78, 0xB6, 0xB0, 0x60, 0xC6, 0x12, 0x0A, 0xCE, 0x44, 0x5E, 0x53, 0x18, 0x02, 0x92,
+    0x27, 0x14, 0x42, 0xF7, 0x6B, 0x70, 0xF4, 0x79, 0x35, 0xE2, 0x39, 0x13, 0xA3, 0x97, 0x8D, 0x59,
+    0xD6, 0x3E, 0xF1, 0xF1, 0x18, 0xC3, 0xB7, 0x0C, 0x92, 0xB6, 0x3B, 0x12, 0xF7, 0x99, 0xC8, 0xB1,
+    0x69, 0xC4, 0xBD, 0xF5, 0x62, 0xFD, 0x91, 0xA4, 0xA3, 0xBD, 0x78, 0xA9, 0x09, 0x5D, 0x97, 0x80,
+    0x62, 0x74, 0x3A, 0x12, 0x37, 0x30, 0x9A, 0x1D, 0x58, 0x7A, 0x88, 0x6F, 0x8A, 0x79, 0xA4, 0x10,
+    0x29, 0xFD, 0x31, 0xF0, 0x98, 0x93, 0x84, 0xFC, 0xA4, 0x00, 0x27, 0x96, 0x90, 0x1E, 0x14, 0xF2,
+    0x57, 0x23, 0xAA, 0x2F, 0x44, 0x5E, 0xEA, 0x2C, 0xB1, 0xEA, 0x24, 0x56, 0xF7, 0x0F, 0x25, 0x67,
+    0x74, 0xDA, 0xD0, 0x0B, 0xED, 0x32, 0x12, 0x33, 0xD0, 0x38, 0x7D, 0xD9, 0x20, 0xE8, 0x30, 0xBB,
+    0x16, 0x81, 0x7D, 0x9E, 0xCA, 0xB8, 0xD9, 0x6A, 0x25, 0x5B, 0x56, 0x97, 0x07, 0x0B, 0x72, 0x3A,
+    0x33, 0x96, 0x99, 0x94, 0xCE, 0x52, 0x53, 0x38, 0x5D, 0x79, 0xFB, 0xB4, 0x46, 0xF0, 0x11, 0xC7,
+    0x56, 0xF0, 0xDF, 0xE0, 0x6C, 0x23, 0x51, 0x7F, 0x03, 0x4C, 0xA3, 0x4D, 0x82, 0xF4, 0xE8, 0xE7,
+    0xCA, 0x35, 0xC2, 0x54, 0x96, 0xD0, 0xC1, 0xF7, 0x09, 0x60, 0xE1, 0xE4, 0x31, 0xFE, 0x41, 0x99,
+    0xB7, 0x30, 0xFC, 0xA1, 0x42, 0xE6, 0x90, 0xC8, 0x41, 0xDC, 0xBC, 0x22, 0x61, 0x2B, 0x94, 0x0B,
+    0xE7, 0xCC, 0xA6, 0x5C, 0x7A, 0xBA, 0x83, 0xB3, 0x6D, 0xB1, 0x77, 0x9A, 0x1A, 0xA0, 0x8B, 0x61,
+    0xBD, 0x6C, 0x25, 0x7B, 0x5E, 0x98, 0xEA, 0x51, 0xD4, 0xCA, 0xAB, 0x0D, 0xB8, 0x92, 0xB5, 0xDA,
+    0xD8, 0xE5, 0x61, 0x0C, 0xBB, 0x28, 0x0F, 0xD4, 0x33, 0x59, 0x20, 0x19, 0x27, 0x2B, 0x6A, 0xCA,
+    0x42, 0x12, 0x54, 0xB6, 0xBB, 0x78, 0x26, 0x28, 0x24, 0xB8, 0xAA, 0x62, 0xFD, 0xBE, 0x3A, 0xCC,
+    0x2B, 0x22, 0xAE, 0xD9, 0x10, 0x92, 0xB7, 0x1B, 0x71, 0xC7, 0x6B, 0x05, 0x95, 0xCD, 0x70, 0x59,
+    0x02, 0xD3, 0x0D, 0x88, 0x6F, 0x53, 0x24, 0xF7, 0x25, 0x2A, 0x70, 0xB5, 0x32, 0xDE, 0xA6, 0x2F,
+    0x6C, 0x34, 0x7E, 0x43, 0x91, 0xFD, 0x4F, 0x6E, 0xD2, 0xB6, 0x98, 0x62, 0x27, 0x6E, 0xE5, 0xBC,
+    0x0F, 0xEC, 0x64, 0x55, 0xB8, 0x5A, 0xBF, 0x8F, 0x5B, 0x55, 0x4D, 0x68, 0x65, 0x6D, 0xD4, 0x91,
+    0xA2, 0xC7, 0x9C, 0xFF, 0xEC, 0x42, 0x73, 0x0B, 0x5D, 0xCF, 0x87, 0xD5, 0x3F, 0xB3, 0x93, 0xE9,
+    0x12, 0x3C, 0xA2, 0xA5, 0x75, 0xC2, 0x08, 0x06, 0x24, 0x8B, 0x32, 0x6B, 0xA2, 0x7A, 0x60, 0x9E,
+    0x5C, 0xCF, 0x96, 0xE9, 0x3C, 0x11, 0xB9, 0x8E, 0x05, 0x9A, 0x37, 0x25, 0xD9, 0xDB, 0x1B, 0xE9,
+    0x83, 0x6A, 0x33, 0x52, 0x6D, 0x3D, 0xD5, 0xF9, 0x29, 0xF9, 0xD1, 0x6B, 0x75, 0x4E, 0xB5, 0xD1,
+    0xD3, 0x69, 0xFF, 0x40, 0x67, 0xDA, 0x56, 0x9F, 0x51, 0x56, 0x25, 0xFD, 0x84, 0x8E, 0x5E, 0x51,
+    0xDD, 0x01, 0xC9, 0x9A, 0x30, 0x17, 0x20, 0x07, 0xE0, 0x8E, 0x3F, 0xB1, 0x67, 0x54, 0x2E, 0xE9,
+    0x18, 0xCE, 0x2E, 0x9D, 0x6C, 0xA6, 0x59, 0x9F, 0x33, 0x19, 0xDF, 0x3C, 0xBA, 0xBB, 0xE2, 0x4D,
+    0x59, 0xEC, 0xC1, 0x8E, 0xAD, 0x92, 0x99, 0x71, 0xBB, 0x4E, 0x76, 0x25, 0x9A, 0xC5, 0xB4, 0xCC,
+    0xE1, 0x11, 0xDF, 0x12, 0x4E, 0x5B, 0x44, 0x15, 0x4F, 0xCC, 0x77, 0xDD, 0xF2, 0x59, 0x99, 0x43,
+    0xDC, 0x1D, 0xDF, 0x19, 0x30, 0xE6, 0xF4, 0x0C, 0xB6, 0xDD, 0xB0, 0x7B, 0x95, 0x19, 0xFD, 0xC1,
+    0x1A, 0x22, 0x4C, 0x91, 0x15, 0x50, 0x22, 0xE5, 0x4F, 0x29, 0xF7, 0xC8, 0x1A, 0x02, 0x86, 0x25,
+    0x46, 0x8C, 0x27, 0x88, 0x21, 0xE3, 0x2D, 0x0C, 0x0C, 0x85, 0x25, 0x24, 0x8D, 0x4B, 0xE9, 0x80,
+    0xA2, 0xE8, 0x51, 0x47, 0x28, 0x10, 0xB8, 0xFD, 0x0A, 0x0B, 0x05, 0x76, 0x70, 0x09, 0xE5, 0xC7,
+    0x53, 0x28, 0xB1, 0x70, 0xAA, 0xE1, 0xA9, 0x0C, 0x4B, 0xE7, 0xFB, 0x2F, 0x98, 0x88, 0xF0, 0xDA,
+    0x31, 0x41, 0x6B, 0xA4, 0x70, 0x69, 0xC2, 0x9F, 0xB0, 0x54, 0x11, 0xE1, 0xFC, 0x5E, 0xFE, 0xD5,
+    0xF8, 0x05, 0xC5, 0x55, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xF6, 0xEA, 0x62, 0xA1, 0x93, 0x62,
+    0x1A, 0x24, 0x24, 0x84, 0xDC, 0x52, 0x20, 0xDC, 0xD2, 0xE4, 0xCE, 0xA2, 0xA1, 0x8D, 0x04, 0x97,
+    0x82, 0x86, 0x16, 0x91, 0x22, 0x0D, 0x65, 0x82, 0x2D, 0x28, 0x28, 0xB9, 0x26, 0x3D, 0x05, 0x14,
+    0x11, 0x05, 0x14, 0x14, 0x29, 0x12, 0xD9, 0x1D, 0x25, 0x46, 0xFC, 0xC0, 0x21, 0x92, 0x82, 0x54,
+    0x06, 0x19, 0xC9, 0x09, 0x8E, 0x87, 0x37, 0xEB, 0xBB, 0x4B, 0x72, 0x4A, 0x04, 0x05, 0x51, 0x56,
+    0x1A, 0xEB, 0xB4, 0x9E, 0x9D, 0x37, 0xEF, 0xED, 0xF3, 0x1C, 0x80, 0x10, 0x5C, 0xDD, 0x8C, 0x0F,
+    0xB7, 0xD0, 0x9F, 0x5B, 0x0C, 0x11, 0xC9, 0xD0, 0x17, 0x29, 0xE0, 0x8B, 0xD4, 0xDC, 0x60, 0x04,
+    0x65, 0x1F, 0xDC, 0x7B, 0xA9, 0x2F, 0x7E, 0x8F, 0x10, 0x0E, 0xE3, 0x0A, 0x7E, 0x62, 0x1A, 0xF8,
+    0x19, 0xD2, 0xC4, 0x8C, 0x10, 0x8C, 0x9C, 0x12, 0x5E, 0x85, 0x35, 0xE0, 0x10, 0x41, 0x84, 0x38,
+    0xF2, 0x0A, 0x84, 0xB9, 0xD3, 0x20, 0x2C, 0xB5, 0x58, 0x03, 0x8F, 0x75, 0x13, 0xA4, 0x22, 0x23,
+    0x74, 0xA5, 0xAE, 0x88, 0x5D, 0xF5, 0x30, 0x5D, 0x97, 0xF1, 0x4E, 0x04, 0x31, 0xA1, 0x3B, 0x8B,
+    0x98, 0x5D, 0x9D, 0xFB, 0x21, 0x2B, 0x74, 0x59, 0xE0, 0xB9, 0x16, 0x69, 0x22, 0xF6, 0xC2, 0xF0,
+    0x73, 0xC0, 0x94, 0x50, 0xC4, 0xF1, 0xC6, 0xEE, 0x83, 0xA1, 0x11, 0x29, 0x49, 0xE1, 0x50, 0x41,
+    0x23, 0x7F, 0x34, 0x93, 0x11, 0xF0, 0x88, 0xC7, 0x0D, 0x87, 0x75, 0x4A, 0xA2, 0x35, 0x01, 0x7F,
+    0x7C, 0x64, 0xFC, 0x10, 0x3D, 0x83, 0xCE, 0x22, 0xDB, 0x2C, 0x7C, 0xAD, 0x71, 0xD6, 0xBA, 0x56,
+    0xA9, 0x44, 0x91, 0xA9, 0x4C, 0x4E, 0xF2, 0x45, 0x00, 0xAC, 0xF6, 0xB0, 0xB4, 0x45, 0xB8, 0x43,
+    0x16, 0xFC, 0xBE, 0x4D, 0x14, 0x8A, 0x80, 0xA7, 0x8A, 0x98, 0x30, 0x4A, 0x5C, 0x55, 0x1D, 0x59,
+    0xB7, 0x76, 0x54, 0xCF, 0x6B, 0x4D, 0x62, 0x32, 0x3C, 0xC1, 0x07, 0xDC, 0xA4, 0x50, 0x21, 0xD8,
+    0x70, 0xC4, 0x66, 0x23, 0x38, 0x1B, 0xA7, 0xE2, 0x5D, 0x59, 0xA4, 0x66, 0x95, 0x0A, 0xC0, 0x32,
+    0x8D, 0xD9, 0x3F, 0xCE, 0xF7, 0x84, 0x00, 0xEB, 0x8F, 0x23, 0x66, 0xE4, 0x47, 0x02, 0x24, 0x33,
+    0x19, 0xF1, 0x44, 0x00, 0x72, 0xFD, 0xCC, 0xA8, 0xD8, 0xAF, 0x4C, 0x04, 0x28, 0xE7, 0x22, 0xBC,
+    0xF2, 0x12, 0x8C, 0x4C, 0x6E, 0x72, 0x57, 0x2D, 0x90, 0x0A, 0xC9, 0x9E, 0xAD, 0xC3, 0xFF, 0x12,
+    0x03, 0x2E, 0x6B, 0xA0, 0xD1, 0x0C, 0xFA, 0x30, 0xA0, 0x0D, 0xBD, 0xFA, 0x54, 0xAC, 0xC1, 0x1D,
+    0xB6, 0x39, 0x52, 0x31, 0x58, 0xBE, 0xF2, 0x77, 0x66, 0x2F, 0x7F, 0x42, 0xB5, 0x19, 0x6C, 0xB4,
+    0x97, 0x3F, 0x11, 0xA3, 0x99, 0xC9, 0x70, 0xA6, 0x62, 0xB0, 0xE0, 0x5D, 0xC6, 0x57, 0x46, 0x3D,
+    0x11, 0x23, 0x07, 0x9D, 0x8B, 0x2E, 0xC3, 0xD7, 0x28, 0xDB, 0x38, 0x4F, 0x01, 0xE0, 0x0C, 0xD4,
+    0xDB, 0xCF, 0x94, 0x9E, 0x46, 0x7F, 0x78, 0x9A, 0xB7, 0x75, 0x63, 0x7F, 0xE9, 0xF5, 0x91, 0xB7,
+    0x95, 0x5E, 0x35, 0x93, 0xE1, 0x4D, 0xE9, 0x31, 0x4D, 0xD9, 0xBC, 0x18, 0x7B, 0xDB, 0xD2, 0x8B,
+    0xC0, 0xEF, 0xC1, 0xC6, 0x6D, 0x86, 0xAF, 0x32, 0xC7, 0xFF, 0xC6, 0x63, 0x6D, 0x86, 0x47, 0x78,
+    0x8C, 0x07, 0x2C, 0x0F, 0x19, 0xDA, 0xCA, 0x46, 0x4D, 0xC7, 0xA4, 0xEB, 0xE3, 0xF0, 0x59, 0xD7,
+    0xD9, 0x84, 0x9B, 0xE3, 0x3D, 0x6E, 0xA1, 0x80, 0xFB, 0x93, 0xA2, 0x86, 0x0C, 0x57, 0xC9, 0xDD,
+    0xB8, 0x50, 0xC7, 0x2B, 0x96, 0xC9, 0xD8, 0x5A, 0xE9, 0x47, 0xE8, 0x6D, 0xB7, 0x17, 0xCD, 0x59,
+    0x06, 0x27, 0x3A, 0xE7, 0x0B, 0x6F, 0x97, 0x6F, 0x61, 0x52, 0x3B, 0x82, 0x45, 0x9F, 0x9B, 0x3A,
+    0x8E, 0xBB, 0x91, 0x6F, 0xE7, 0x61, 0xE7, 0x24, 0xEE, 0x5C, 0x4A, 0x67, 0xBA, 0x76, 0x36, 0xC7,
+    0xB2, 0x97, 0x46, 0x9E, 0xE8, 0xE9, 0xBE, 0x4E, 0x6D, 0xD7, 0x1E, 0x56, 0xA5, 0xDB, 0x6F, 0x88,
+    0xD3, 0x4D, 0x7F, 0xB6, 0x9F, 0x51, 0xA0, 0xD7, 0x8D, 0x58, 0x41, 0x39, 0x8C, 0xB1, 0xAE, 0x43,
+    0xDA, 0x95, 0xE6, 0x61, 0x41, 0x51, 0x1A, 0xCD, 0x5E, 0xA9, 0xB5, 0x52, 0xFF, 0x9E, 0x9E, 0xA9,
+    0xBB, 0x4C, 0xF1, 0x8A, 0x40, 0xDE, 0x2C, 0xA5, 0x19, 0x29, 0xB5, 0x23, 0x99, 0x5D, 0xEB, 0xB3,
+    0xD0, 0x27, 0xDF, 0xCF, 0x49, 0x33, 0xD6, 0x87, 0x73, 0x0C, 0x3A, 0x62, 0xFB, 0x84, 0xE6, 0x30,
+    0x37, 0x99, 0x97, 0xB0, 0xEB, 0x29, 0x3F, 0xC4, 0xC3, 0x47, 0x46, 0xAA, 0x5A, 0xF9, 0x07, 0x49,
+    0x5C, 0xF7, 0x10, 0xD4, 0x0B, 0xE8, 0xD6, 0xAB, 0xEC, 0x61, 0x15, 0x66, 0x1C, 0x5E, 0xB5, 0xC0,
+    0xDE, 0xFB, 0x7B, 0x52, 0xF1, 0x62, 0x4A, 0x1D, 0xBD, 0x46, 0x0E, 0x4A, 0xC4, 0x5F, 0x74, 0x12,
+    0x14, 0x3A, 0x11, 0xE6, 0x91, 0x8E, 0xF8, 0x2E, 0xA3, 0x23, 0xA2, 0x90, 0x1D, 0xB8, 0x29, 0x31,
+    0x75, 0x5C, 0x01, 0xF3, 0xB6, 0x87, 0x05, 0x5A, 0x4B, 0x2D, 0xAF, 0x62, 0xA4, 0x96, 0xFB, 0x4A,
+    0x8E, 0xBF, 0xAC, 0x65, 0x1D, 0xF7, 0xA1, 0x72, 0xA3, 0x0E, 0x6F, 0x89, 0xA7, 0x76, 0x30, 0xF6,
+    0x70, 0x68, 0xFF, 0x0A, 0x45, 0x79, 0x98, 0x56, 0x43, 0xBB, 0x11, 0x67, 0x63, 0x0D, 0xA1, 0x1A,
+    0xB6, 0xD2, 0x5E, 0x5A, 0x54, 0x69, 0x43, 0xD9, 0x15, 0xC5, 0xFF, 0x56, 0xAB, 0x3A, 0x9F, 0xD4,
+    0x45, 0xBF, 0xF4, 0x66, 0xFC, 0x4C, 0x3B, 0x8D, 0x1D, 0x39, 0x18, 0x2C, 0xD7, 0x46, 0xE5, 0x2C,
+    0xD4, 0x89, 0x92, 0xD9, 0xA7, 0x75, 0x25, 0xDF, 0xAF, 0xC8, 0x0E, 0x2E, 0x64, 0xFD, 0x01, 0xCD,
+    0x54, 0x31, 0x8F, 0x15, 0x37, 0x10, 0x9E, 0xB7, 0x16, 0x58, 0x39, 0x4B, 0x6C, 0x95, 0x06, 0x29,
+    0x72, 0x1B, 0x29, 0xE4, 0xDC, 0x52, 0x70, 0x78, 0x49, 0x93, 0x02, 0x89, 0x86, 0xBC, 0x74, 0xE8,
+    0x52, 0x26, 0xD5, 0x35, 0x29, 0x2F, 0xDA, 0x4D, 0xF8, 0x03, 0x34, 0xF4, 0x14, 0x49, 0x43, 0x93,
+    0x94, 0x14, 0x4F, 0xD9, 0x15, 0xAF, 0xA4, 0x59, 0x44, 0x41, 0xBB, 0x11, 0x05, 0x12, 0x0D, 0x5B,
+    0x18, 0xC9, 0x24, 0xDE, 0x9D, 0x7C, 0xB3, 0xFB, 0x5E, 0xDE, 0x5D, 0x38, 0x82, 0x44, 0x81, 0x62,
+    0x69, 0x67, 0xBC, 0x63, 0x7B, 0xE6, 0x9B, 0x6F, 0xC6, 0x36, 0x05, 0x75, 0xBA, 0x58, 0xB4, 0xAA,
+    0xD5, 0x4D, 0xC6, 0x5C, 0x51, 0x3D, 0x12, 0xED, 0xDD, 0xA1, 0x37, 0x46, 0x79, 0xE7, 0x5B, 0xC5,
+    0x31, 0xE5, 0xCC, 0xC9, 0x56, 0x65, 0xBA, 0x4A, 0x36, 0x1D, 0x90, 0x49, 0xC7, 0xA4, 0xE3, 0x31,
+    0xA9, 0xCD, 0xA7, 0xE3, 0x01, 0xE5, 0xD1, 0xBF, 0xE0, 0x68, 0x99, 0x03, 0xF6, 0x06, 0xC5, 0x7F,
+    0x06, 0x2A, 0x9F, 0xF4, 0x44, 0x1A, 0x9F, 0xED, 0x2F, 0x50, 0xDD, 0x61, 0xAD, 0x71, 0xCC, 0x85,
+    0xE3, 0x91, 0xB2, 0xBA, 0xA3, 0x79, 0x0D, 0xAB, 0x8D, 0xC8, 0xBA, 0x80, 0x50, 0x83, 0x4C, 0xF3,
+    0x40, 0x6F, 0x1D, 0xE7, 0x6B, 0x6E, 0x09, 0x88, 0xB9, 0xA1, 0x92, 0x5F, 0xD4, 0x85, 0x66, 0x39,
+    0xE7, 0xC5, 0x51, 0xC6, 0xD3, 0xE1, 0x28, 0xD2, 0x8B, 0xCF, 0xC5, 0x64, 0xD0, 0x69, 0x0A, 0xD2,
+    0x4D, 0xD9, 0x54, 0x62, 0x46, 0xAA, 0x77, 0x81, 0x19, 0x07, 0xC6, 0xC3, 0x9E, 0x34, 0x8F, 0xB2,
+    0xFB, 0x28, 0x89, 0x27, 0x7F, 0x53, 0xCE, 0x24, 0x33, 0x0A, 0x38, 0xCB, 0xBF, 0x7C, 0x5D, 0x37,
+    0x1E, 0xC1, 0x18, 0xC1, 0xC0, 0xC0, 0x24, 0x7B, 0x91, 0x58, 0x3F, 0xCF, 0x23, 0x0E, 0x18, 0xF8,
+    0x35, 0x88, 0x9E, 0x6F, 0x3E, 0x1B, 0x3E, 0x30, 0x87, 0xFF, 0x4B, 0x56, 0xDE, 0x36, 0x58, 0x00,
+    0xA8, 0x93, 0x88, 0xDA, 0xC9, 0xBC, 0x43, 0xE4, 0x26, 0x44, 0x13, 0xFC, 0xD9, 0x30, 0x2D, 0x49,
+    0x60, 0xB4, 0x86, 0x81, 0xC5, 0xE0, 0x9C, 0x09, 0x1B, 0xB2, 0xF1, 0xF9, 0xEE, 0x03, 0x11, 0xFD,
+    0xD1, 0x84, 0x5A, 0x12, 0x10, 0x18, 0x64, 0x1E, 0x61, 0x6A, 0x8A, 0x63, 0x08, 0xCA, 0x9A, 0x13,
+    0x39, 0x5E, 0x04, 0xF6, 0xEF, 0x72, 0x9C, 0xF0, 0xB7, 0xA3, 0xC0, 0x04, 0x76, 0x95, 0x84, 0x4B,
+    0x16, 0xC8, 0x7E, 0x9D, 0xC4, 0xC8, 0xEF, 0x30, 0xBE, 0x5E, 0x2E, 0xEB, 0xB5, 0x50, 0x1C, 0x44,
+    0x0C, 0x13, 0xDB, 0x87, 0x22, 0x9E, 0x8A, 0x78, 0x05, 0x7E, 0xF4, 0x50, 0xB6, 0xA8, 0xE5, 0x21,
+    0xA8, 0x28, 0x9F, 0x83, 0x1B, 0xFB, 0x1A, 0x46, 0x33, 0x96, 0x1D, 0x0A, 0x58, 0xD1, 0xE7, 0x82,
+    0x44, 0x60, 0xE6, 0x22, 0xC2, 0x0A, 0x13, 0x02, 0xD4, 0x7B, 0xF4, 0x29, 0x62, 0xF4, 0xDB, 0x44,
+    0xAE, 0xCA, 0x2E, 0xA9, 0x83, 0x92, 0x04, 0x73, 0x69, 0x83, 0x03, 0x69, 0x05, 0xE9, 0x61, 0x2D,
+    0x95, 0xB1, 0xD7, 0x81, 0xFE, 0x77, 0xD0, 0x20, 0xBD, 0x05, 0xEF, 0x8B, 0x81, 0x5C, 0xBB, 0x88,
+    0x28, 0x98, 0xEA, 0x55, 0x24, 0xD3, 0xE4, 0x2D, 0x39, 0xF2, 0x05, 0xAD, 0x68, 0xA0, 0xAC, 0x57,
+    0x01, 0x7E, 0x61, 0xF2, 0x54, 0x16, 0x34, 0x60, 0xB3, 0x0A, 0x68, 0x28, 0xDB, 0xA2, 0xA8, 0x65,
+    0x91, 0x49, 0xE1, 0x3A, 0x25, 0x9C, 0xCC, 0xB2, 0xDF, 0xC8, 0x74, 0xB6, 0xF4, 0xBB, 0xCC, 0xD3,
+    0x67, 0xE3, 0xFD, 0xFB, 0xBF, 0xC6, 0x53, 0x7B, 0xC4, 0x3E, 0xCB, 0x30, 0x4B, 0x7D, 0x52, 0x8E,
+    0xCB, 0xE5, 0x51, 0x90, 0x96, 0xB1, 0xB3, 0x8C, 0x3B, 0xE9, 0xA2, 0xB4, 0x93, 0x8B, 0x40, 0xB9,
+    0xE1, 0x68, 0xCE, 0x1E, 0xBD, 0x59, 0x4B, 0xB1, 0x79, 0x22, 0x64, 0xCA, 0x5E, 0xBA, 0xF0, 0x87,
+    0x89, 0x10, 0x74, 0x80, 0x79, 0xC9, 0x81, 0x9C, 0x74, 0x3A, 0xBA, 0xA3, 0xCD, 0x06, 0xB2, 0x15,
+    0x6A, 0xE7, 0xC9, 0x57, 0xBB, 0xEC, 0x77, 0x84, 0x24, 0x98, 0x54, 0xAF, 0x41, 0x48, 0x6B, 0x41,
+    0x48, 0x51, 0x56, 0x8B, 0x21, 0x1B, 0x49, 0x87, 0x73, 0xF4, 0x0D, 0x2F, 0x1E, 0xDD, 0xD0, 0x57,
+    0x3E, 0xB9, 0xD2, 0xBB, 0x3F, 0xE8, 0xE2, 0xBF, 0x6E, 0xC8, 0x92, 0xE0, 0x19, 0xFD, 0xED, 0x5A,
+    0x50, 0x06, 0x06, 0xE1, 0xC1, 0x9E, 0x31, 0x8D, 0x72, 0x75, 0xE1, 0x73, 0x94, 0x5B, 0xE2, 0x00,
+    0x09, 0xAF, 0xB8, 0xD4, 0x1A, 0x57, 0x9E, 0x9B, 0xBC, 0xBA, 0xFC, 0x57, 0xF3, 0xEC, 0xF6, 0xFA,
+    0x96, 0x4E, 0xDF, 0x67, 0x27, 0xDF, 0xF4, 0xAC, 0x07, 0x42, 0xE0, 0xA3, 0x07, 0x94, 0x75, 0x9B,
+    0xE9, 0x4A, 0xFA, 0x01, 0xDD, 0xE0, 0x85, 0x8B, 0xCD, 0x54, 0x42, 0x20, 0xEB, 0x6B, 0x35, 0x27,
+    0xF0, 0xFF, 0xF8, 0xAB, 0xB3, 0xAE, 0x72, 0x26, 0x54, 0xB6, 0x5B, 0x25, 0x07, 0xEC, 0x3B, 0xD4,
+    0x38, 0xBD, 0x37, 0x5B, 0x85, 0x66, 0x07, 0xEE, 0x6C, 0x56, 0xF2, 0x24, 0xF8, 0x59, 0xD1, 0xC7,
+    0x28, 0x67, 0x2C, 0x99, 0x9B, 0xD3, 0xF1, 0x16, 0xE8, 0x5A, 0x37, 0xA5, 0x40, 0xFB, 0x24, 0xF0,
+    0xB7, 0x7F, 0x6E, 0xEE, 0x68, 0xFF, 0x86, 0x92, 0x9B, 0x51, 0xD0, 0xDE, 0xBD, 0xB2, 0x19, 0x55,
+    0xCC, 0x3B, 0x5F, 0xFD, 0xA3, 0x12, 0xBA, 0xAB, 0xE1, 0xAD, 0x1A, 0xF2, 0x50, 0x3E, 0xE6, 0x2F,
+    0x47, 0x17, 0x2F, 0x2D, 0xDA, 0x0B, 0x74, 0x19, 0x64, 0x1E, 0x91, 0x69, 0xB1, 0x51, 0x27, 0xD7,
+    0x6F, 0xC2, 0x9F, 0xA3, 0x55, 0xD6, 0x9B, 0x66, 0x9F, 0x1E, 0x88, 0x72, 0x94, 0x54, 0x9F, 0x37,
+    0x7E, 0x52, 0x6D, 0x79, 0x0D, 0xC7, 0x7E, 0x53, 0x8D, 0x4E, 0x59, 0xB0, 0x4D, 0x0D, 0xBF, 0x61,
+    0x7E, 0xD7, 0xE6, 0xB1, 0xF7, 0xB3, 0x6B, 0xEB, 0x2F, 0x06, 0x1D, 0x2C, 0x76, 0x9E, 0x52, 0x3F,
+    0x8E, 0x3A, 0xDA, 0xAE, 0x7C, 0xC8, 0x06, 0x81, 0x78, 0xCD, 0x28, 0xA0, 0x79, 0xD8, 0xAF, 0xF6,
+    0xCD, 0x4F, 0xFD, 0xCA, 0xE5, 0xEB, 0x3E, 0x79, 0x88, 0xA1, 0xFC, 0x8F, 0x07, 0xF5, 0x7D, 0xC7,
+    0xDF, 0xA5, 0x55, 0xB1, 0x6E, 0x14, 0x31, 0x10, 0x9D, 0xDD, 0x15, 0xB2, 0x84, 0x0B, 0x53, 0x53,
+    0xB0, 0x2D, 0x42, 0x02, 0x7F, 0xC1, 0x9D, 0x57, 0x34, 0x29, 0x68, 0x28, 0xF8, 0x9C, 0x04, 0x2F,
+    0x15, 0x05, 0x0D, 0x7F, 0x00, 0x25, 0xA2, 0xA1, 0xA1, 0x48, 0x91, 0x68, 0x8D, 0x52, 0x50, 0x50,
+    0xB0, 0xFC, 0xC1, 0x22, 0x3A, 0x28, 0x70, 0xB1, 0x12, 0x0B, 0xDA, 0x9C, 0x79, 0x33, 0xBE, 0x5C,
+    0x92, 0x4B, 0x22, 0x21, 0x62, 0x79, 0x3C, 0xCF, 0x7B, 0x5E, 0xCF, 0xBC, 0x99, 0xD9, 0xB9, 0xB7,
+    0x0D, 0xDD, 0x7B, 0x31, 0x52, 0x35, 0x77, 0x0D, 0xB9, 0x4F, 0x0C, 0x3C, 0xC0, 0xC7, 0x7F, 0x00,
+    0xCF, 0x47, 0x52, 0x93, 0x6F, 0xC9, 0x3F, 0x9F, 0xCE, 0x80, 0xD1, 0x07, 0xF2, 0x8F, 0x66, 0x80,
+    0x2E, 0x03, 0x3D, 0xA6, 0x40, 0x9D, 0x01, 0x88, 0x00, 0x89, 0x88, 0xEA, 0x48, 0x85, 0x06, 0xF0,
+    0xA9, 0x27, 0x95, 0x66, 0xA2, 0x2E, 0x35, 0xA4, 0xD3, 0x00, 0x30, 0x90, 0x6D, 0x70, 0xA2, 0x9A,
+    0xB0, 0x90, 0x6B, 0x21, 0x3B, 0x33, 0x6F, 0x71, 0x97, 0x6C, 0x49, 0xCD, 0xFC, 0x0B, 0x6F, 0x37,
+    0xE3, 0x31, 0x2F, 0x96, 0xEF, 0x7D, 0x18, 0x89, 0xCA, 0xC8, 0xD0, 0x96, 0x03, 0xC3, 0x07, 0x02,
+    0xCF, 0x3C, 0x15, 0xE8, 0x18, 0x56, 0x1B, 0xE8, 0x18, 0x56, 0x03, 0xC3, 0xE5, 0x1A, 0xC2, 0x87,
+    0xA5, 0x1A, 0x01, 0x7B, 0xBE, 0x7B, 0xC1, 0x8B, 0x12, 0x78, 0x2C, 0xB6, 0x60, 0xBD, 0x60, 0xBF,
+    0xC9, 0x31, 0x1D, 0xB5, 0x6A, 0x4E, 0x9D, 0xA9, 0x02, 0x95, 0x33, 0x95, 0xA9, 0x2D, 0x87, 0xFD,
+    0xB2, 0x57, 0xCF, 0xDA, 0xDB, 0xEF, 0x11, 0x01, 0x2A, 0xF1, 0x22, 0x48, 0xBA, 0x9E, 0x4C, 0x44,
+    0xF8, 0x88, 0xE3, 0xE0, 0xC2, 0xA5, 0x9B, 0x95, 0x30, 0x35, 0x03, 0x62, 0x4A, 0x05, 0x36, 0x08,
+    0x75, 0x8D, 0x38, 0x8D, 0x54, 0xE0, 0x8E, 0x8E, 0x4F, 0xDE, 0xF2, 0xB1, 0x4E, 0x93, 0x4A, 0xC7,
+    0x45, 0x5A, 0x91, 0x5F, 0x51, 0xFD, 0x7B, 0x6D, 0xFC, 0x25, 0x91, 0x09, 0x12, 0x1D, 0xFD, 0x29,
+    0xD0, 0xBE, 0x0A, 0x9A, 0xCA, 0x4D, 0xA4, 0x8A, 0x31, 0x93, 0xA8, 0x81, 0x77, 0x99, 0x3B, 0x91,
+    0x0E, 0x39, 0x70, 0x07, 0x17, 0xB7, 0x08, 0x9F, 0x41, 0xBC, 0x97, 0xD8, 0x4E, 0x1C, 0x12, 0xBC,
+    0xD7, 0x08, 0x7D, 0x24, 0xAF, 0xE6, 0x3C, 0x22, 0xC3, 0x7F, 0x32, 0x6F, 0x15, 0x8B, 0x84, 0xA5,
+    0x3A, 0x46, 0x86, 0xE1, 0xB3, 0x8E, 0x20, 0xA2, 0xA3, 0x1D, 0x40, 0x08, 0xB5, 0x60, 0x06, 0xF0,
+    0x36, 0x5F, 0x41, 0xC4, 0x7C, 0x03, 0x3B, 0xF3, 0x03, 0xD7, 0x99, 0x04, 0x6B, 0x75, 0x62, 0x67,
+    0x52, 0xCB, 0x0B, 0x2E, 0xB2, 0x89, 0xAD, 0xF3, 0x0F, 0x96, 0x43, 0xEB, 0x3E, 0x73, 0x50, 0x8E,
+    0xF0, 0xD0, 0x7D, 0xC0, 0x43, 0x17, 0xBA, 0x19, 0x0B, 0xE2, 0xED, 0x83, 0x49, 0xC1, 0x07, 0x95,
+    0x70, 0x79, 0x29, 0x49, 0x38, 0x19, 0x2E, 0x6E, 0x96, 0x81, 0x17, 0x4E, 0x98, 0x63, 0xFA, 0x9E,
+    0x0B, 0x87, 0x6D, 0x48, 0xF5, 0xF1, 0xA8, 0xDB, 0xB5, 0xB0, 0xE1, 0xB3, 0xB2, 0xAE, 0x24, 0x87,
+    0x1C, 0x3A, 0x05, 0xB3, 0x35, 0xEC, 0xA3, 0x1A, 0x1C, 0x27, 0x85, 0xBD, 0x82, 0xF3, 0x82, 0x3B,
+    0x54, 0x3B, 0xAC, 0x78, 0x33, 0x91, 0x57, 0x48, 0x02, 0x12, 0xEE, 0x29, 0x0D, 0x9D, 0x9C, 0xBA,
+    0x64, 0x30, 0x39, 0x50, 0x45, 0xA0, 0xB2, 0xE0, 0x0E, 0xC4, 0x4B, 0xF2, 0xAD, 0x21, 0x37, 0xE8,
+    0xB1, 0x0A, 0x53, 0x11, 0x0F, 0x68, 0x77, 0x41, 0x0F, 0x1C, 0xE9, 0x57, 0x4D, 0xF9, 0xB3, 0xE5,
+    0xB7, 0xB8, 0x62, 0x66, 0xAA, 0x80, 0x7E, 0xCD, 0xB4, 0x70, 0xA1, 0xDE, 0x99, 0x54, 0xE8, 0x9E,
+    0x45, 0x18, 0x7E, 0x8D, 0x34, 0xF5, 0x52, 0x71, 0x92, 0x39, 0xB3, 0xF6, 0x7F, 0x7B, 0x80, 0xC2,
+    0x39, 0xB1, 0x57, 0x88, 0xDB, 0x96, 0xF6, 0x72, 0xF1, 0xDF, 0xDF, 0x25, 0x9F, 0xD2, 0x39, 0xA1,
+    0x3B, 0x64, 0x48, 0x85, 0xAA, 0x2F, 0x22, 0xBD, 0x39, 0x35, 0xFD, 0x04, 0x0E, 0x99, 0x80, 0x6F,
+    0x0A, 0xD1, 0x04, 0x50, 0x43, 0x31, 0xD1, 0x1E, 0x82, 0xAE, 0xFB, 0x72, 0xA4, 0x43, 0x44, 0x5C,
+    0xF7, 0xD5, 0x88, 0xA2, 0x72, 0x8D, 0x61, 0x90, 0x66, 0x97, 0x74, 0x0A, 0x37, 0xDB, 0x7F, 0x73,
+    0xFA, 0x5A, 0x0E, 0x5F, 0x36, 0x0C, 0xD7, 0x27, 0x97, 0xE7, 0x28, 0x65, 0x4E, 0x35, 0xCA, 0xC8,
+    0xF6, 0xF9, 0x72, 0x54, 0xF2, 0x8D, 0xA6, 0x3C, 0x61, 0x22, 0x94, 0x9E, 0xA2, 0x84, 0x54, 0x5F,
+    0x9C, 0x30, 0x11, 0x4A, 0x6B, 0x26, 0x42, 0x29, 0x1D, 0xA5, 0xD8, 0x9D, 0x96, 0x83, 0x5A, 0x15,
+    0xA9, 0xE9, 0x82, 0x1D, 0xF4, 0x58, 0xCD, 0x28, 0x82, 0xD4, 0x5E, 0x4D, 0xB4, 0x88, 0x36, 0x94,
+    0x2C, 0x83, 0x0D, 0x68, 0x47, 0x1B, 0xF9, 0x1F, 0xA2, 0x4B, 0x15, 0x16, 0x3A, 0x2C, 0x0C, 0xCF,
+    0x3D, 0x99, 0xFC, 0x65, 0xD7, 0x79, 0x36, 0x3C, 0xED, 0xF9, 0xE9, 0xB6, 0x66, 0xE2, 0x69, 0xD3,
+    0x15, 0xAE, 0xB2, 0x9B, 0xD5, 0x68, 0x83, 0x9A, 0x6C, 0xD0, 0x10, 0x33, 0x5F, 0x27, 0x2F, 0x2A,
+    0x48, 0x27, 0xE2, 0x4F, 0x4D, 0x7A, 0x19, 0xF7, 0xE3, 0xA9, 0x8A, 0x4F, 0x8B, 0xB9, 0x6E, 0xBB,
+    0x9D, 0xDE, 0x7D, 0x19, 0xCD, 0x74, 0x28, 0xDF, 0xAA, 0xEE, 0x09, 0x11, 0x47, 0xC8, 0xD9, 0x47,
+    0xD3, 0x13, 0xA2, 0xCE, 0xED, 0x89, 0x37, 0x29, 0x54, 0x68, 0x19, 0xDD, 0xD6, 0x97, 0x78, 0x3F,
+    0x2B, 0xF9, 0x67, 0x11, 0x23, 0x74, 0xD2, 0xDF, 0xA5, 0x69, 0x52, 0xEE, 0x06, 0x74, 0xB3, 0x5D,
+    0xE6, 0xAF, 0xE6, 0x40, 0xD4, 0x07, 0x39, 0x5F, 0x1F, 0xC9, 0xF9, 0xFA, 0xA3, 0x9C, 0xB7, 0x9F,
+    0xE5, 0xBC, 0xFD, 0x29, 0x6F, 0xD9, 0x55, 0x56, 0xD9, 0x9C, 0x1D, 0x4F, 0x7B, 0xD1, 0xBA, 0xFD,
+    0x6C, 0xAB, 0xAE, 0x95, 0x76, 0x9C, 0x44, 0x55, 0x59, 0xE9, 0xAC, 0x4C, 0x56, 0x2E, 0x1F, 0xF1,
+    0x1C, 0x21, 0xB0, 0x92, 0x3C, 0x96, 0xB3, 0xA8, 0x2A, 0x8A, 0x32, 0x83, 0xA8, 0x7A, 0x7D, 0x71,
+    0x6E, 0xC4, 0x5D, 0xEE, 0xF3, 0xD9, 0x91, 0xFC, 0x17, 0x8A, 0x46, 0x9C, 0x19, 0xBE, 0x14, 0x75,
+    0xF7, 0x62, 0xD1, 0xFF, 0x05, 0xCD, 0x55, 0x31, 0x6E, 0xD5, 0x40, 0x10, 0x1D, 0x7B, 0x01, 0x8B,
+    0xB8, 0xD8, 0x06, 0xD1, 0xA4, 0x30, 0x05, 0x15, 0x12, 0xF1, 0x05, 0x50, 0xD6, 0x52, 0x0A, 0xCA,
+    0xA4, 0xA1, 0x81, 0x82, 0x86, 0x9E, 0x0B, 0x90, 0xAC, 0x21, 0x05, 0x05, 0x4D, 0x6E, 0x00, 0x25,
+    0xA2, 0xC9, 0x05, 0x80, 0xB5, 0x92, 0x0B, 0x18, 0x71, 0x00, 0x8C, 0xF2, 0xA9, 0xD9, 0xC2, 0x52,
+    0x9C, 0x68, 0xED, 0xE1, 0x8D, 0xBF, 0x13, 0xA5, 0xC8, 0x8F, 0x22, 0x08, 0x52, 0x56, 0x9A, 0x91,
+    0x3C, 0xF6, 0xCE, 0xCC, 0x7B, 0xFB, 0x76, 0x4C, 0x14, 0x6D, 0x10, 0x51, 0x5A, 0xC1, 0x19, 0x18,
+    0x05, 0x98, 0xF2, 0x70, 0x5A, 0x42, 0xAB, 0xB0, 0xA8, 0x83, 0x4B, 0x1A, 0xB8, 0xAC, 0x80, 0xDB,
+    0xBC, 0x4D, 0x14, 0x1F, 0x23, 0x96, 0x0E, 0x78, 0xB2, 0x25, 0xC2, 0x3D, 0xDE, 0x73, 0x4B, 0x11,
+    0xAF, 0xD7, 0x64, 0x6B, 0x53, 0xD0, 0x1D, 0xEA, 0x25, 0x4D, 0x2B, 0x69, 0x6A, 0xC9, 0xCC, 0x70,
+    0x8C, 0xD4, 0x31, 0x4B, 0xEA, 0x17, 0x52, 0xE8, 0x91, 0xB8, 0x4C, 0x9C, 0x96, 0xB4, 0x49, 0x75,
+    0x52, 0x78, 0xC1, 0x8A, 0xBB, 0x1C, 0x3D, 0x70, 0x8A, 0x2C, 0x66, 0x9B, 0x4B, 0xD2, 0x0D, 0x72,
+    0xA9, 0xCE, 0xA0, 0x8B, 0x41, 0x73, 0x45, 0x76, 0x9B, 0x3B, 0xCA, 0xEA, 0x81, 0x29, 0x69, 0xCD,
+    0x6E, 0x1D, 0xF7, 0xD9, 0x41, 0x20, 0xF7, 0xB8, 0x73, 0x45, 0xFE, 0x6D, 0xD0, 0x5E, 0x7B, 0xF7,
+    0xA6, 0x57, 0x21, 0x6F, 0x4C, 0xC5, 0x69, 0x97, 0xB6, 0x66, 0x9F, 0xB1, 0xCF, 0x73, 0x95, 0xEF,
+    0x07, 0xE3, 0x93, 0x23, 0xD6, 0x81, 0xD8, 0x22, 0x98, 0x31, 0x82, 0x8A, 0x3B, 0xEB, 0xC9, 0x0E,
+    0x59, 0x20, 0xCD, 0x6F, 0x19, 0xD0, 0x50, 0x7B, 0x09, 0x5D, 0xAC, 0x4C, 0x9D, 0x7F, 0x86, 0x01,
+    0x5E, 0xBC, 0xA0, 0x61, 0x90, 0x9A, 0xE5, 0x03, 0x72, 0x21, 0x7F, 0x9B, 0x36, 0x79, 0xAD, 0x7C,
+    0x5E, 0xC5, 0xAD, 0x29, 0x22, 0xB1, 0x6E, 0xB2, 0x60, 0x8A, 0x38, 0x98, 0x72, 0x6E, 0xF6, 0x8C,
+    0xB9, 0x2A, 0x16, 0x02, 0xE9, 0xC1, 0x6B, 0xA0, 0x43, 0xE7, 0x15, 0xA1, 0xF3, 0x6E, 0x04, 0x3A,
+    0xA2, 0x6F, 0x04, 0x7D, 0xA0, 0xA4, 0x33, 0x5C, 0x44, 0xBD, 0xFE, 0x8D, 0x56, 0xD7, 0x8E, 0x7B,
+    0x02, 0x50, 0x53, 0xA5, 0xAD, 0x7D, 0xD7, 0x02, 0x7D, 0xC3, 0x20, 0xAB, 0xCB, 0x6B, 0xB3, 0x37,
+    0xA8, 0x80, 0x1C, 0xA5, 0x5B, 0x03, 0x50, 0xEC, 0xD3, 0x41, 0x05, 0x41, 0x6F, 0xDF, 0x03, 0xA8,
+    0x3E, 0x44, 0x30, 0x62, 0x41, 0x6F, 0x04, 0x68, 0xC2, 0x3F, 0xC1, 0xE5, 0x88, 0x3E, 0x1B, 0xCE,
+    0x22, 0x52, 0xF2, 0x14, 0xB1, 0x1C, 0x95, 0x95, 0xA3, 0xCA, 0x05, 0x79, 0x2A, 0xD2, 0x50, 0xFD,
+    0xF8, 0x46, 0x3E, 0x72, 0xE5, 0xD5, 0x61, 0x1F, 0x97, 0xF1, 0x93, 0x81, 0x7E, 0x03, 0x25, 0x99,
+    0x6A, 0x2E, 0x39, 0xE9, 0x83, 0x4F, 0x95, 0x51, 0x47, 0x78, 0xBD, 0x12, 0xC3, 0xC5, 0x87, 0xA2,
+    0x53, 0x11, 0xCA, 0xA4, 0xA5, 0xFB, 0xE7, 0x6B, 0xE9, 0x63, 0x76, 0xAA, 0xA5, 0xBD, 0xF3, 0xB5,
+    0xD4, 0xFE, 0x8D, 0x96, 0xCC, 0x25, 0xB5, 0x14, 0x95, 0x74, 0x8F, 0x5A, 0x74, 0xBD, 0xAA, 0x51,
+    0x1C, 0x55, 0x95, 0x10, 0xF9, 0x3F, 0xB5, 0x24, 0x17, 0x1C, 0x17, 0x93, 0xA6, 0x5A, 0x1A, 0xB5,
+    0x56, 0x4B, 0xBA, 0x70, 0xA1, 0xEE, 0x0A, 0xEA, 0xE6, 0x63, 0x5D, 0x5D, 0x9B, 0x4A, 0x79, 0xE4,
+    0xF6, 0xA8, 0x83, 0xBA, 0x71, 0x77, 0xD6, 0x2C, 0x6A, 0xCF, 0x4D, 0xA1, 0xA6, 0x0A, 0x6E, 0xB2,
+    0xEB, 0xA1, 0xE1, 0x54, 0x94, 0xF2, 0x92, 0x45, 0x36, 0xA2, 0x1B, 0x3B, 0xC3, 0xE3, 0x8D, 0x4B,
+    0x33, 0x1B, 0x2F, 0x62, 0xB6, 0x77, 0x95, 0x48, 0x5F, 0x50, 0x8A, 0x01, 0x4B, 0x84, 0x09, 0x14,
+    0xF1, 0xCE, 0xC4, 0xDF, 0x4D, 0x0C, 0x56, 0x21, 0x0F, 0x21, 0xE6, 0xF3, 0x08, 0x5E, 0x96, 0x4F,
+    0x13, 0xC6, 0x26, 0x72, 0x03, 0xF7, 0x22, 0x04, 0x8C, 0x52, 0x57, 0x13, 0xD0, 0x21, 0xB1, 0x1E,
+    0x07, 0x5E, 0xE6, 0x65, 0xAF, 0xF9, 0x2E, 0x5C, 0xDA, 0xE7, 0x32, 0x4C, 0x07, 0x2B, 0xEA, 0x3E,
+    0x92, 0x40, 0x7A, 0x28, 0x9A, 0xC9, 0x7F, 0xC8, 0x85, 0xFC, 0x3A, 0x0F, 0xCB, 0xDD, 0xD1, 0x07,
+    0xF2, 0xD2, 0xAD, 0xC3, 0xA7, 0x21, 0xE7, 0x8D, 0xBB, 0xEC, 0x0D, 0x7A, 0xE0, 0xD2, 0xC1, 0x41,
+    0x9A, 0x58, 0x8D, 0x78, 0x90, 0x83, 0x48, 0x2D, 0x9D, 0xCC, 0x4E, 0x0E, 0xFD, 0xE9, 0xAE, 0xD7,
+    0xCC, 0xED, 0xD2, 0xA7, 0x27, 0x1B, 0x0B, 0x95, 0x91, 0x1F, 0x61, 0x90, 0x73, 0x99, 0x0E, 0xCE,
+    0x67, 0xC2, 0x17, 0xFE, 0x1A, 0xF8, 0x51, 0x6C, 0x6E, 0x12, 0x6D, 0x7D, 0x81, 0xAE, 0x60, 0x5B,
+    0x5B, 0x30, 0xC4, 0x7B, 0xF3, 0xEB, 0x59, 0x90, 0x7C, 0x29, 0x4A, 0x82, 0x87, 0x92, 0x44, 0x02,
+    0x18, 0xA4, 0x40, 0xFE, 0x90, 0x12, 0x9C, 0xC6, 0xAB, 0x71, 0x9C, 0x4A, 0x43, 0xF0, 0xE3, 0xC4,
+    0x71, 0x3B, 0x8B, 0x35, 0x79, 0x1D, 0x29, 0xBB, 0x45, 0xF4, 0x21, 0x29, 0xA2, 0x46, 0x55, 0xAA,
+    0x16, 0x5A, 0x48, 0x4E, 0x7B, 0x79, 0x76, 0xF1, 0xE5, 0xFA, 0x57, 0x0A, 0xAF, 0x6A, 0xFD, 0x01,
+    0xC5, 0x55, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0xFE, 0xFC, 0x0C, 0x67, 0x09, 0x4B, 0x59, 0x0A, 0x12,
+    0x81, 0x4E, 0xE8, 0xD5, 0x20, 0x90, 0x5B, 0x0A, 0x38, 0x1B, 0xE5, 0x0F, 0x5C, 0x41, 0x90, 0x10,
+    0x2D, 0xFD, 0xB5, 0x14, 0x47, 0x6C, 0x89, 0x82, 0x36, 0x05, 0x14, 0x74, 0x69, 0x28, 0xB8, 0x26,
+    0x6D, 0x0A, 0x2E, 0xB6, 0x44, 0x41, 0xEB, 0x8E, 0x12, 0x23, 0x3D, 0x40, 0x4A, 0x13, 0x17, 0x46,
+    0xF2, 0x09, 0xBF, 0x1D, 0xBE, 0x6F, 0xDE, 0xBD, 0xE3, 0x14, 0x0E, 0xA5, 0x64, 0xB5, 0xB7, 0x6F,
+    0xCE, 0x9E, 0x9D, 0xF9, 0xF6, 0x9B, 0xD9, 0xCF, 0xC0, 0x0F, 0xC0, 0x63, 0x64, 0xA3, 0x66, 0xD1,
+    0x69, 0x1A, 0x38, 0x93, 0x63, 0xCD, 0x1B, 0x46, 0xD2, 0x5E, 0x70, 0x5D, 0x9B, 0x0D, 0x40, 0x1B,
+    0x6D, 0x8B, 0xD4, 0x9A, 0xCC, 0xAA, 0x7C, 0xCB, 0x5D, 0x5D, 0x98, 0x80, 0x72, 0x28, 0xF8, 0x6A,
+    0x3D, 0x96, 0x1D, 0x10, 0x26, 0xAD, 0xD9, 0x54, 0x57, 0x40, 0x3A, 0xD7, 0xD8, 0xAF, 0xAB, 0xE5,
+    0xDA, 0xBA, 0x7F, 0xEE, 0x3E, 0xF2, 0xCF, 0xA7, 0x72, 0x04, 0x8A, 0xB1, 0xB0, 0xE3, 0x3B, 0x36,
+    0x06, 0xE3, 0x18, 0x72, 0xAD, 0x5D, 0xAA, 0xB5, 0x01, 0x97, 0x48, 0x07, 0xB3, 0x49, 0x78, 0x62,
+    0xB5, 0xC7, 0x96, 0x77, 0xC8, 0x9B, 0x74, 0x42, 0x3A, 0x25, 0x5B, 0x24, 0x0B, 0x5A, 0x42, 0xC4,
+    0xED, 0x4A, 0xF3, 0xC5, 0xA3, 0xD0, 0xB9, 0x0A, 0x9B, 0x19, 0x26, 0xB6, 0xA3, 0xB6, 0x17, 0x15,
+    0x4A, 0x60, 0x41, 0x3A, 0x20, 0xEB, 0xF1, 0x05, 0x70, 0x1F, 0x79, 0xAF, 0xFF, 0xCE, 0x65, 0x66,
+    0x83, 0x26, 0x1D, 0x48, 0x41, 0xBC, 0xD7, 0x76, 0x08, 0x8E, 0xA7, 0x15, 0xB4, 0x44, 0x28, 0xB1,
+    0xD2, 0x72, 0x49, 0xD8, 0x3D, 0x64, 0xE6, 0xA3, 0x0B, 0xF6, 0x4C, 0xBF, 0x63, 0x88, 0x62, 0xD1,
+    0xA6, 0x7C, 0x21, 0x73, 0x3D, 0xCF, 0xBE, 0x15, 0x5F, 0xDC, 0x15, 0xB5, 0x13, 0x2A, 0x02, 0xA3,
+    0x91, 0x8E, 0x92, 0x51, 0x0A, 0xBE, 0x58, 0xF7, 0x82, 0x06, 0x15, 0x8A, 0x0E, 0xB6, 0x10, 0xA1,
+    0xD2, 0x19, 0x6A, 0x07, 0x6E, 0xDD, 0x5A, 0x8C, 0xDB, 0x77, 0x95, 0x1C, 0x52, 0xE5, 0x8E, 0x8A,
+    0xC2, 0x62, 0x88, 0xD4, 0x92, 0x11, 0x82, 0x52, 0x2C, 0xDA, 0xFD, 0x67, 0x72, 0xA2, 0xF0, 0xE5,
+    0x8E, 0x4F, 0xE4, 0x3B, 0x6C, 0x06, 0xBB, 0x02, 0xE9, 0x63, 0x54, 0x7C, 0x8E, 0xAD, 0x68, 0xAE,
+    0x77, 0xBE, 0xF4, 0x9E, 0x9D, 0xAD, 0xD6, 0x2A, 0xC2, 0xF8, 0xF1, 0x62, 0x35, 0xE4, 0xF1, 0x91,
+    0x75, 0x98, 0xD6, 0xDD, 0xCA, 0x2A, 0x9C, 0x96, 0x82, 0x7E, 0xE7, 0xFC, 0xC8, 0xC1, 0x45, 0xD2,
+    0xC6, 0x8D, 0x4F, 0x49, 0x99, 0x0A, 0xEC, 0xCC, 0xF9, 0x9F, 0x40, 0xCB, 0x93, 0x11, 0xCB, 0xDF,
+    0x3E, 0x25, 0x73, 0xAF, 0xEF, 0x72, 0x2E, 0xC4, 0xF2, 0x87, 0x4E, 0xC7, 0x64, 0xFC, 0x41, 0x31,
+    0xE3, 0xD0, 0x1E, 0x00, 0xEF, 0xAA, 0x49, 0x78, 0x0E, 0x36, 0x2B, 0x0F, 0xC1, 0x50, 0x2B, 0x9E,
+    0x12, 0x6F, 0x3D, 0x5F, 0xC5, 0xB3, 0xEF, 0x2B, 0x15, 0xC2, 0x7B, 0x04, 0x01, 0xD9, 0x8C, 0x11,
+    0xA1, 0x5B, 0x33, 0x73, 0xC2, 0x16, 0x1F, 0x68, 0x3C, 0xA1, 0xB1, 0xEE, 0x0B, 0xE4, 0xCB, 0x4A,
+    0x07, 0x22, 0x71, 0x3D, 0x8D, 0x59, 0x5C, 0x8C, 0x69, 0xFC, 0xD8, 0x9A, 0xB2, 0x5B, 0x6D, 0xD3,
+    0x05, 0x61, 0x28, 0x7B, 0x18, 0xAB, 0x12, 0x46, 0x19, 0x77, 0x69, 0xCC, 0xF5, 0x00, 0xFB, 0x29,
+    0x92, 0x43, 0x19, 0x3F, 0xD3, 0x88, 0x78, 0x03, 0xCC, 0x90, 0x75, 0xF8, 0x00, 0x89, 0x32, 0x5D,
+    0x01, 0x39, 0x3A, 0xEC, 0xFF, 0xB2, 0xBB, 0x16, 0x43, 0xFC, 0xAC, 0xEE, 0xD8, 0x8E, 0x2C, 0x0A,
+    0xEB, 0x53, 0xB3, 0xE9, 0x91, 0x8F, 0xAA, 0x88, 0xA9, 0xE2, 0xEB, 0x19, 0x0C, 0xF5, 0xCA, 0xD9,
+    0xD7, 0x64, 0x82, 0x18, 0x82, 0x28, 0x1F, 0x51, 0x37, 0x81, 0x7D, 0xC7, 0x78, 0x79, 0x4F, 0xC0,
+    0xF7, 0x65, 0x10, 0x79, 0xB2, 0xE5, 0x91, 0xDB, 0x8E, 0x80, 0xE7, 0x95, 0x4A, 0x42, 0xA3, 0xD1,
+    0x85, 0x20, 0x7F, 0x27, 0x33, 0x01, 0x17, 0x3D, 0xA3, 0xC6, 0x2B, 0xC0, 0x32, 0x26, 0x19, 0x5F,
+    0xED, 0x01, 0x0B, 0xF9, 0x56, 0xC6, 0xF0, 0x1F, 0x57, 0x40, 0xBD, 0xE1, 0x15, 0x51, 0x1F, 0x7A,
+    0xFF, 0x85, 0x71, 0xD7, 0x90, 0x60, 0x20, 0x64, 0xCB, 0xA5, 0x5F, 0xFA, 0xEB, 0x79, 0xFA, 0x6C,
+    0x9B, 0x5A, 0x4C, 0xED, 0x5B, 0x3E, 0xCC, 0xA6, 0x4B, 0xFD, 0xE0, 0xCC, 0x7D, 0x86, 0xDD, 0x9C,
+    0x74, 0x3E, 0xCE, 0x9B, 0x93, 0xF1, 0x15, 0x1D, 0xA8, 0x3A, 0x9C, 0x83, 0x12, 0xD4, 0x1D, 0xDA,
+    0x06, 0xAB, 0x06, 0x0F, 0x59, 0xB9, 0x53, 0x52, 0x58, 0x08, 0x05, 0x29, 0x4D, 0x55, 0xEA, 0x37,
+    0xFF, 0xF7, 0x52, 0xB3, 0xF3, 0xAB, 0xAC, 0x79, 0x9C, 0x37, 0xF9, 0x2F, 0x8D, 0x90, 0xAA, 0xDA,
+    0xD5, 0xB5, 0x7A, 0x87, 0x76, 0x22, 0x27, 0xB0, 0xDF, 0x2B, 0x9E, 0x84, 0xB7, 0x35, 0x73, 0x15,
+    0x51, 0xA7, 0x53, 0x55, 0xC9, 0x4A, 0xBA, 0x38, 0xA9, 0x4C, 0x41, 0x4E, 0xB2, 0xE8, 0xDB, 0x1E,
+    0xFA, 0x85, 0xF2, 0x28, 0xEF, 0x6B, 0xF1, 0xAE, 0xF6, 0xFE, 0x86, 0x94, 0xF9, 0x05, 0xE3, 0xE5,
+    0x6F, 0x2A, 0xBF, 0xBC, 0xA3, 0xDA, 0xC7, 0x5C, 0x82, 0x98, 0xA0, 0xBE, 0xC0, 0x6B, 0xBB, 0xAA,
+    0x79, 0xFD, 0x98, 0xD1, 0xC3, 0x6D, 0xBD, 0x74, 0x5E, 0xC3, 0x5C, 0x37, 0x8A, 0xDE, 0x92, 0xCE,
+    0xE0, 0x52, 0x9E, 0x89, 0x17, 0xE0, 0xC4, 0xF4, 0x3E, 0xF1, 0x15, 0xFE, 0x24, 0x51, 0x70, 0xBE,
+    0xEE, 0x5E, 0x92, 0x5C, 0xA0, 0x7D, 0xFA, 0xC8, 0x16, 0x97, 0xB2, 0xC1, 0xC5, 0xC3, 0x15, 0x79,
+    0x08, 0xAE, 0x11, 0x07, 0x66, 0x17, 0xFF, 0x60, 0xFB, 0x7C, 0x77, 0x5F, 0x59, 0x06, 0x30, 0x0E,
+    0x6F, 0x08, 0xDE, 0xFE, 0x17, 0xFE, 0x03, 0xDB, 0x10, 0x78, 0x9F, 0x6F, 0x6E, 0xFB, 0xE9, 0xA5,
+    0x5B, 0x93, 0x44, 0xAE, 0x22, 0xC2, 0x81, 0x32, 0xC5, 0x8D, 0x87, 0x12, 0xE4, 0xF1, 0x16, 0x29,
+    0x65, 0x0E, 0xE6, 0x99, 0x99, 0xB6, 0x3B, 0xE4, 0xBE, 0xFD, 0x38, 0xF5, 0x63, 0x79, 0x93, 0x49,
+    0xE3, 0x90, 0xF6, 0xB2, 0xDF, 0x53, 0xFE, 0xA4, 0xC2, 0xAB, 0xCF, 0x65, 0xFC, 0xE4, 0xA3, 0x4B,
+    0xD1, 0xD4, 0xB9, 0x17, 0xA7, 0x8D, 0xCD, 0x62, 0x0F, 0xE8, 0x5A, 0xF8, 0xB5, 0x30, 0x0F, 0x37,
+    0x39, 0x79, 0xBD, 0x07, 0xF5, 0x3B, 0xED, 0x22, 0x4E, 0xEF, 0x8D, 0xAF, 0xE2, 0xB6, 0x76, 0x35,
+    0x3C, 0x10, 0xED, 0xFA, 0x1E, 0x76, 0x4E, 0x68, 0xE3, 0xB6, 0x5C, 0xEB, 0x85, 0xBD, 0x91, 0xDA,
+    0x98, 0xC7, 0x33, 0xBA, 0x48, 0x3B, 0xA3, 0x73, 0x35, 0x96, 0xFE, 0xF5, 0x92, 0xD9, 0x93, 0x6E,
+    0x2F, 0xC4, 0x8E, 0x8B, 0xCA, 0x05, 0x31, 0xE5, 0xEE, 0xA3, 0x92, 0xA7, 0x58, 0xE3, 0x1D, 0xDC,
+    0xBA, 0xC2, 0x7D, 0x12, 0xAB, 0x40, 0x8A, 0x9F, 0x7C, 0x78, 0x2C, 0x52, 0xC3, 0x65, 0x51, 0xDB,
+    0x8D, 0x3E, 0xC2, 0x52, 0xFF, 0x86, 0x0A, 0xDD, 0xE8, 0x73, 0xB7, 0xC9, 0x16, 0xA9, 0x08, 0xC3,
+    0x7F, 0x29, 0x15, 0xBD, 0xF6, 0x75, 0xBC, 0x71, 0xFC, 0x0D, 0xCD, 0x55, 0x31, 0x8F, 0xDC, 0x54,
+    0x10, 0x1E, 0xDB, 0xB9, 0xB3, 0x74, 0x2F, 0xE4, 0xA5, 0x00, 0x84, 0x74, 0x08, 0xF7, 0x08, 0x69,
+    0x29, 0x53, 0x24, 0xB1, 0x13, 0x7E, 0x40, 0xB6, 0xE0, 0xD2, 0xD2, 0x82, 0x28, 0x2E, 0x25, 0xC5,
+    0x11, 0x5B, 0x4A, 0x41, 0x41, 0x01, 0x4D, 0x7E, 0x00, 0x12, 0x48, 0x84, 0x86, 0x2B, 0x68, 0x2F,
+    0x7E, 0x90, 0x82, 0x82, 0xC6, 0x12, 0x45, 0xA4, 0x34, 0x31, 0xE4, 0x2A, 0x1A, 0x36, 0xD2, 0x46,
+    0xD9, 0x80, 0xED, 0xE1, 0xFB, 0x66, 0x6F, 0xCF, 0xCB, 0x1D, 0x57, 0xA4, 0xE3, 0x49, 0x1E, 0xAF,
+    0xE7, 0xD9, 0x33, 0xDF, 0x7C, 0xF3, 0xBD, 0x59, 0x91, 0xD7, 0x77, 0x44, 0x64, 0xA2, 0x1A, 0x24,
+    0x51, 0x55, 0x91, 0x5C, 0xB5, 0x93, 0x48, 0x0F, 0x65, 0x2A, 0x6E, 0x81, 0x2D, 0xC9, 0x03, 0x6D,
+    0x4F, 0x93, 0xCC, 0x69, 0xFD, 0x8C, 0x76, 0x32, 0x14, 0xDC, 0xD4, 0x17, 0x66, 0xB5, 0x12, 0xC9,
+    0x54, 0x5B, 0x91, 0xA8, 0x56, 0xEE, 0xA7, 0x66, 0x13, 0x7A, 0xF0, 0x9B, 0x21, 0x32, 0x95, 0x8B,
+    0x22, 0xDA, 0xC5, 0xFA, 0x1D, 0x5E, 0xC1, 0xCB, 0xF8, 0x88, 0xA6, 0xF3, 0xF6, 0x13, 0x31, 0x74,
+    0x2E, 0xDB, 0x8A, 0xCC, 0x58, 0x5F, 0x5A, 0x3A, 0xCB, 0x2F, 0xEF, 0x98, 0x7D, 0x97, 0x26, 0x66,
+    0xA0, 0xC4, 0xB0, 0x6C, 0x31, 0xFD, 0xEE, 0x50, 0x78, 0xED, 0xE5, 0xFE, 0xB5, 0x69, 0x82, 0x1D,
+    0x4F, 0x28, 0x70, 0xD7, 0x08, 0x51, 0x0F, 0xAC, 0xAA, 0x02, 0x1C, 0x20, 0xAB, 0xE5, 0x30, 0x65,
+    0x9A, 0x19, 0x72, 0xDC, 0x41, 0xC6, 0xA8, 0x06, 0xF8, 0x04, 0x6F, 0xBF, 0x81, 0xEB, 0x3E, 0x11,
+    0xE2, 0x7A, 0x05, 0xD7, 0x2D, 0x00, 0xAC, 0x24, 0xFE, 0x5A, 0xE4, 0x9C, 0x44, 0x78, 0xBE, 0x24,
+    0x9F, 0xC0, 0x5E, 0x71, 0x88, 0x21, 0x57, 0xD7, 0xD8, 0xD8, 0x33, 0x48, 0x53, 0x39, 0x7B, 0x6D,
+    0xDC, 0x05, 0x10, 0xA7, 0x64, 0x41, 0x49, 0xAE, 0x37, 0x72, 0xCB, 0x17, 0xF2, 0xAA, 0xC4, 0xC3,
+    0xC8, 0x22, 0xE1, 0xAE, 0xC8, 0xED, 0x68, 0x9D, 0xB2, 0x74, 0xAF, 0x64, 0xD7, 0x1B, 0xA1, 0xA9,
+    0x2A, 0x33, 0xEF, 0x2A, 0xF7, 0x23, 0xB3, 0x62, 0x9E, 0xE8, 0x88, 0xE8, 0x70, 0x8E, 0x1D, 0x90,
+    0xFA, 0x8F, 0xEF, 0xB5, 0x4B, 0xC9, 0x65, 0x4B, 0x2E, 0x35, 0xB1, 0x9F, 0xCC, 0xDB, 0xCB, 0xA6,
+    0x5A, 0x9F, 0x6C, 0x6D, 0x49, 0x5C, 0xF9, 0xE2, 0xB2, 0xB8, 0xCF, 0x83, 0x38, 0x44, 0xF3, 0x8D,
+    0xC8, 0x85, 0x53, 0xF8, 0x37, 0xD1, 0x07, 0xD5, 0xC6, 0x1D, 0xBE, 0x26, 0x97, 0xF1, 0x38, 0x5B,
+    0x36, 0xDF, 0x01, 0x96, 0x03, 0xA8, 0x98, 0x00, 0xB6, 0x71, 0xB9, 0xD9, 0x85, 0xA2, 0x0C, 0xC8,
+    0x81, 0x3C, 0x0B, 0xA4, 0x0D, 0xDB, 0xF8, 0xAE, 0x64, 0xE6, 0xC7, 0x34, 0xCF, 0x69, 0xFA, 0x6F,
+    0xA6, 0xBD, 0xEC, 0x1C, 0xD5, 0xCA, 0x6C, 0x47, 0x3A, 0xEA, 0x8F, 0x09, 0xF0, 0xED, 0xAA, 0xDB,
+    0x91, 0x71, 0x53, 0x92, 0xEF, 0xCC, 0xA4, 0x33, 0x3A, 0xD9, 0x48, 0x99, 0xB0, 0x64, 0xA2, 0x06,
+    0x04, 0x73, 0x86, 0x95, 0xD3, 0x77, 0xA6, 0x37, 0x63, 0xC7, 0x7A, 0x64, 0x26, 0xAF, 0x8E, 0x15,
+    0xE4, 0x8C, 0x32, 0xA6, 0xFB, 0x68, 0x59, 0x62, 0x5A, 0x49, 0xDA, 0x4A, 0x84, 0x0C, 0x07, 0x88,
+    0x51, 0x80, 0xAF, 0xA7, 0xD4, 0x7E, 0x6F, 0xA0, 0x80, 0x33, 0x41, 0x58, 0x04, 0xCD, 0x11, 0x3B,
+    0xF0, 0x21, 0xC2, 0x43, 0x59, 0x40, 0xC7, 0x6D, 0x0A, 0x09, 0xA1, 0x9D, 0x39, 0x12, 0x41, 0x96,
+    0x7E, 0x6E, 0x02, 0x82, 0x36, 0xF3, 0x86, 0xB2, 0xBC, 0x48, 0xE9, 0xA4, 0x15, 0xC2, 0xCB, 0x1E,
+    0x95, 0x93, 0xFE, 0x59, 0xAD, 0x6A, 0x72, 0x06, 0xAA, 0x38, 0xC5, 0xB6, 0xB5, 0xAD, 0xA7, 0x51,
+    0x23, 0xEF, 0xD1, 0x8E, 0x6F, 0x36, 0xA6, 0xA7, 0x79, 0x1A, 0xC9, 0x1B, 0x8E, 0xAB, 0x3B, 0xC9,
+    0xD3, 0x48, 0x9E, 0x9D, 0xDF, 0x93, 0x3C, 0xAD, 0x91, 0x67, 0x3C, 0xE5, 0xC7, 0xE4, 0xD9, 0xBA,
+    0x82, 0x04, 0x0D, 0x6F, 0x6F, 0xA5, 0x4D, 0xDA, 0xEE, 0xC9, 0x6D, 0x17, 0x5C, 0x43, 0x86, 0x40,
+    0xCF, 0x0C, 0xD8, 0x0C, 0x43, 0xBF, 0x84, 0xD2, 0x19, 0x33, 0x6B, 0xB7, 0x2C, 0x48, 0xD4, 0xF3,
+    0xA4, 0xB7, 0xA4, 0x27, 0x83, 0x3E, 0x71, 0x3B, 0xA9, 0x86, 0x7B, 0x2F, 0xA9, 0x06, 0x3B, 0x3E,
+    0x39, 0x4F, 0x92, 0x67, 0x7B, 0xD6, 0xAB, 0x7C, 0x09, 0x35, 0x60, 0xE1, 0x28, 0x67, 0x95, 0xF5,
+    0x7B, 0x52, 0x48, 0x3C, 0x67, 0xB8, 0x1F, 0x19, 0x11, 0x49, 0x09, 0x21, 0x2F, 0x70, 0x5C, 0xBB,
+    0x5A, 0xF5, 0x17, 0x73, 0x8A, 0xF5, 0xBF, 0x04, 0xB5, 0xD8, 0x2B, 0xB5, 0x42, 0xCF, 0x71, 0x0B,
+    0x09, 0xA7, 0x63, 0x71, 0x9E, 0xC7, 0x35, 0x29, 0x24, 0x7A, 0x12, 0x50, 0xC1, 0xFE, 0xA5, 0x7D,
+    0x68, 0x2C, 0xED, 0x38, 0x35, 0x3E, 0xFC, 0xEF, 0x71, 0xB0, 0xF9, 0xAD, 0xC8, 0xDB, 0x5F, 0x29,
+    0xD1, 0x96, 0x01, 0x68, 0x33, 0xC4, 0xAE, 0x7F, 0xC6, 0x17, 0x93, 0xA7, 0xA3, 0x93, 0x23, 0xA1,
+    0x7C, 0x40, 0x1E, 0x67, 0x70, 0xA6, 0x1D, 0x66, 0x4D, 0x34, 0x98, 0xF3, 0x0E, 0x9D, 0x2D, 0x9D,
+    0x8B, 0xD1, 0xF9, 0x1E, 0x3F, 0x6F, 0xA0, 0x68, 0x3F, 0x47, 0xCD, 0x69, 0xE7, 0xF4, 0xEE, 0xAE,
+    0x46, 0xE4, 0x38, 0x70, 0x00, 0xB4, 0x28, 0xC7, 0x3A, 0x80, 0xB1, 0x9A, 0xDA, 0x24, 0xE1, 0x8A,
+    0xE6, 0xA9, 0x64, 0x3F, 0xBC, 0x29, 0xFB, 0xFB, 0xB7, 0xE2, 0xF0, 0x77, 0xF0, 0x4B, 0xDE, 0xD7,
+    0x16, 0x88, 0x71, 0x0F, 0x1B, 0x99, 0x7C, 0x50, 0xC8, 0xC1, 0x6D, 0x89, 0x9F, 0x2D, 0xC4, 0xFD,
+    0xDA, 0x4A, 0x7E, 0x23, 0xC8, 0x90, 0xA3, 0x2B, 0x9D, 0xF8, 0x27, 0x33, 0xC9, 0xBF, 0x68, 0x93,
+    0x01, 0x7F, 0x1A, 0x0B, 0x34, 0xB7, 0x45, 0x86, 0x9F, 0xA0, 0xDB, 0x48, 0x7F, 0x5B, 0xA9, 0x08,
+    0xFA, 0xDF, 0xC2, 0xF0, 0xE0, 0xFC, 0x5B, 0x48, 0xF4, 0xFE, 0x59, 0x33, 0xB2, 0x6C, 0xCE, 0x62,
+    0xC2, 0x9C, 0x64, 0x62, 0x32, 0x32, 0xB1, 0x46, 0xCF, 0x49, 0x26, 0x46, 0x7A, 0xE6, 0x70, 0xC6,
+    0x3D, 0x4F, 0xA4, 0x5E, 0xE7, 0xBC, 0x0D, 0xF5, 0x5F, 0x37, 0x97, 0x7F, 0x36, 0x1D, 0xE7, 0xE1,
+    0x20, 0x35, 0xE7, 0x30, 0x87, 0x62, 0x81, 0x89, 0x3A, 0x8C, 0x58, 0x8A, 0x8F, 0x6D, 0x62, 0x0E,
+    0x1B, 0xFF, 0x1E, 0xEA, 0x50, 0xCA, 0xC1, 0xA7, 0x60, 0x81, 0xA4, 0xB4, 0x20, 0xA5, 0x92, 0x83,
+    0xAB, 0x50, 0xCB, 0x8A, 0x85, 0x23, 0x52, 0x06, 0xC9, 0x7F, 0x47, 0xC8, 0xCF, 0xF0, 0x3D, 0x35,
+    0x3A, 0xD1, 0xE7, 0xB3, 0x6C, 0xC8, 0x82, 0xFC, 0xFF, 0xD7, 0x3F, 0xBD, 0x55, 0x31, 0x8F, 0xDE,
+    0x44, 0x10, 0x7D, 0xF6, 0x2A, 0xB8, 0x30, 0xCA, 0x36, 0x14, 0x28, 0x44, 0xB8, 0xA5, 0x40, 0x71,
+    0x43, 0x91, 0x02, 0x65, 0x2D, 0x9A, 0x94, 0xA4, 0x4A, 0x43, 0x91, 0x9E, 0xE6, 0xF8, 0x01, 0x21,
+    0xB6, 0x94, 0x22, 0x05, 0x45, 0xEE, 0x1F, 0xD0, 0xD0, 0xE7, 0xFE, 0xC0, 0xE1, 0x4D, 0x52, 0x50,
+    0x62, 0x91, 0x82, 0x12, 0x43, 0x2A, 0xAA, 0x33, 0x64, 0x51, 0x16, 0xB0, 0x3D, 0xBC, 0x59, 0x7F,
+    0x51, 0x3E, 0x1D, 0x77, 0x97, 0x2E, 0x96, 0xBD, 0x1E, 0xCF, 0xDA, 0x3B, 0x6F, 0xDF, 0xBC, 0x19,
+    0xE3, 0x3A, 0x2C, 0x78, 0x1A, 0x0F, 0x33, 0x16, 0x23, 0xE0, 0x64, 0x02, 0x0A, 0x1D, 0x70, 0xE5,
+    0x10, 0xE7, 0x1F, 0x99, 0x00, 0xE5, 0xDC, 0x7A, 0xE4, 0x52, 0xF1, 0xE5, 0xFE, 0x87, 0x19, 0xA8,
+    0xFF, 0x38, 0xE5, 0x7C, 0x4A, 0x67, 0x35, 0xD1, 0x59, 0xCC, 0xCE, 0xF3, 0x13, 0x4B, 0x67, 0x7B,
+    0x5F, 0x9D, 0xA3, 0x3A, 0xA3, 0x3A, 0xD7, 0xD7, 0xCE, 0x41, 0x3F, 0x0F, 0x6E, 0x80, 0x59, 0xCA,
+    0x99, 0xAF, 0xE7, 0xF2, 0xFB, 0x17, 0xE2, 0x5B, 0x11, 0x99, 0x2C, 0x87, 0x98, 0x73, 0x98, 0x89,
+    0x50, 0x16, 0x4E, 0x4A, 0xDC, 0x21, 0xF9, 0x90, 0xE0, 0xAF, 0xE3, 0x32, 0x62, 0x16, 0xE8, 0xED,
+    0x32, 0x9D, 0xF8, 0xB2, 0x39, 0x05, 0xB7, 0x1C, 0x50, 0xDF, 0x69, 0x70, 0xFC, 0x35, 0xF2, 0xBF,
+    0x22, 0xCA, 0x9F, 0x47, 0xD4, 0x9F, 0x77, 0x58, 0x1C, 0x4C, 0x9C, 0x61, 0x9F, 0x4F, 0x70, 0x0F,
+    0x3D, 0x56, 0xD7, 0xD9, 0xD8, 0x8B, 0xFC, 0xCA, 0x38, 0xF7, 0x79, 0x95, 0xB2, 0xCC, 0x85, 0x3C,
+    0x98, 0xB6, 0x25, 0xAE, 0xE9, 0xF0, 0xC9, 0x11, 0x87, 0xAB, 0xEF, 0xEA, 0x8A, 0x86, 0x31, 0xB2,
+    0xC7, 0x9E, 0xA6, 0x23, 0x6F, 0xC8, 0xC7, 0x0B, 0xD8, 0xC2, 0x1B, 0x88, 0x4A, 0xCE, 0xD3, 0x44,
+    0x3D, 0x3D, 0x97, 0xA8, 0xE4, 0x0C, 0x74, 0xE6, 0x8B, 0x0D, 0x80, 0x7C, 0x26, 0x1A, 0xA1, 0xFF,
+    0xFB, 0xB6, 0x4C, 0x95, 0x72, 0x64, 0x38, 0xAC, 0xE0, 0x4E, 0x04, 0x4A, 0x5C, 0x83, 0x96, 0x8F,
+    0xBB, 0xC3, 0x76, 0xC0, 0x4F, 0x1D, 0xE1, 0x03, 0x1F, 0x71, 0x1F, 0x47, 0x5F, 0xF1, 0x7B, 0xBA,
+    0xBE, 0x3B, 0x8D, 0xB8, 0xDE, 0xB1, 0x15, 0x36, 0xB6, 0xEE, 0x74, 0x38, 0xBE, 0x01, 0x13, 0xF6,
+    0xD9, 0x22, 0x79, 0x2B, 0xDC, 0x6F, 0x8C, 0xF0, 0x80, 0xF1, 0x18, 0x69, 0xAE, 0xE5, 0xE5, 0x54,
+    0xAD, 0x95, 0x4F, 0x0A, 0xB9, 0x85, 0xAC, 0x01, 0xE1, 0xCE, 0x68, 0x09, 0x0F, 0xB5, 0xE7, 0x69,
+    0x47, 0xD8, 0x37, 0x13, 0x55, 0x24, 0x3A, 0x2E, 0x30, 0x4D, 0x12, 0x56, 0xA2, 0xEA, 0xB5, 0xB9,
+    0x26, 0x73, 0x3C, 0xD3, 0x1C, 0x12, 0x59, 0x66, 0x61, 0xB2, 0x86, 0x7A, 0x22, 0xCD, 0x9B, 0xB6,
+    0x12, 0x5B, 0xE0, 0x20, 0x5D, 0xA9, 0x32, 0xDB, 0xC4, 0xB5, 0x4F, 0xD7, 0x3B, 0x87, 0x3C, 0xF3,
+    0x08, 0x9E, 0xF4, 0xAD, 0x68, 0x3B, 0xB4, 0xCD, 0x95, 0x5B, 0xE0, 0x79, 0xF6, 0xA1, 0xBC, 0x21,
+    0x0B, 0xAA, 0xB8, 0x2A, 0x99, 0x31, 0x99, 0xA4, 0x0F, 0x88, 0xB0, 0x03, 0xAC, 0xD7, 0x95, 0x66,
+    0xE5, 0x61, 0xDF, 0x1C, 0x0D, 0x4D, 0xA6, 0x6C, 0x64, 0xF5, 0x69, 0x78, 0xA7, 0x70, 0xA8, 0xF8,
+    0x56, 0xCB, 0xF1, 0x95, 0x06, 0xDF, 0x82, 0x8C, 0x86, 0xFE, 0x9F, 0x73, 0x65, 0x74, 0x20, 0xAB,
+    0x16, 0xD6, 0xA7, 0x0A, 0xE5, 0xE3, 0x24, 0x26, 0x1D, 0x72, 0xD1, 0xF1, 0x83, 0x61, 0x83, 0x78,
+    0xBC, 0xD3, 0xCC, 0xB0, 0x69, 0xE6, 0x1E, 0xF2, 0xC0, 0x6D, 0x3F, 0xDB, 0xD3, 0x8C, 0x4A, 0x28,
+    0x42, 0xBE, 0xE1, 0xE2, 0x0C, 0x13, 0x75, 0xA3, 0xBD, 0xFC, 0xE2, 0xDB, 0xA8, 0x5B, 0xF5, 0x69,
+    0xF9, 0x9C, 0xB7, 0xCB, 0xBB, 0x48, 0x3D, 0xED, 0x83, 0x7D, 0x86, 0xAF, 0xED, 0x3A, 0xD0, 0xBC,
+    0xDD, 0xAB, 0xED, 0x9E, 0x4D, 0x77, 0x77, 0xED, 0x20, 0xC1, 0xC3, 0x21, 0xDE, 0xFB, 0x7F, 0xD3,
+    0x5A, 0xB6, 0x12, 0x78, 0xB1, 0xF5, 0x0E, 0xF7, 0x30, 0xD1, 0x9A, 0x2F, 0x75, 0x12, 0xAC, 0x9D,
+    0xFA, 0xD4, 0x36, 0xDC, 0xE3, 0x94, 0xFD, 0x4D, 0x39, 0xDA, 0x91, 0xC8, 0x18, 0xF3, 0xE6, 0x7C,
+    0x3D, 0x28, 0x18, 0xA1, 0x06, 0x8C, 0x34, 0x05, 0xB7, 0x80, 0x7A, 0x45, 0x3D, 0xF0, 0x35, 0x15,
+    0x11, 0x6C, 0x28, 0x25, 0xF2, 0xA1, 0x1E, 0xDD, 0xC9, 0x54, 0x8D, 0x68, 0x9F, 0x48, 0x3D, 0x72,
+    0x49, 0xB1, 0x51, 0x93, 0x60, 0xE6, 0x7E, 0x90, 0x6F, 0x27, 0x94, 0xFF, 0xB2, 0xB1, 0xF5, 0x1D,
+    0x2A, 0xBE, 0xBC, 0x89, 0xCD, 0x5B, 0xED, 0xB7, 0x64, 0xB9, 0x12, 0xB6, 0x61, 0x09, 0xCC, 0x3D,
+    0xC3, 0xD2, 0xEE, 0x89, 0xB3, 0x5A, 0x99, 0x48, 0x72, 0xEB, 0x26, 0x4E, 0x29, 0x9E, 0x4B, 0x09,
+    0x5C, 0xD8, 0xC9, 0x81, 0x2F, 0x3C, 0x82, 0xF2, 0xC6, 0xDD, 0x67, 0x23, 0x8E, 0xCE, 0x2B, 0x2B,
+    0xDD, 0xC8, 0x73, 0xFD, 0x68, 0x71, 0xAC, 0x76, 0xFB, 0x64, 0x56, 0x02, 0x2B, 0x7F, 0x09, 0x75,
+    0xB7, 0x64, 0xD1, 0x04, 0x3B, 0xBA, 0xC1, 0xA1, 0xB7, 0x52, 0x4C, 0xC5, 0x9F, 0x32, 0x7F, 0x0F,
+    0xD7, 0xCB, 0xC9, 0x60, 0x52, 0x7D, 0xD4, 0x72, 0x22, 0x3E, 0x93, 0xC0, 0xCE, 0x6A, 0xD7, 0x82,
+    0x3A, 0x10, 0x4F, 0x34, 0x65, 0xD0, 0x7F, 0x00, 0xDE, 0x7F, 0xD5, 0x54, 0xA0, 0x1A, 0x82, 0x7D,
+    0x44, 0x0E, 0x6D, 0x13, 0x54, 0x1B, 0x65, 0x73, 0x26, 0x16, 0xC3, 0xC9, 0x42, 0x55, 0x6A, 0x62,
+    0x35, 0x10, 0x85, 0xD2, 0xAC, 0xA4, 0xA2, 0x6F, 0xC8, 0xB4, 0xF3, 0x99, 0x92, 0xCA, 0x3A, 0xAD,
+    0xB4, 0x4E, 0x93, 0x30, 0x6F, 0xAA, 0x5A, 0x5F, 0x90, 0x2B, 0xE2, 0x51, 0x45, 0x88, 0xC6, 0x20,
+    0x3F, 0x94, 0x9E, 0xAA, 0xCE, 0x69, 0x1A, 0xAD, 0xE6, 0xD4, 0xA4, 0xCC, 0x69, 0x3F, 0x43, 0xAB,
+    0x6D, 0xA6, 0x56, 0x67, 0xA9, 0x4E, 0x93, 0x9C, 0xA2, 0xCE, 0x56, 0x9D, 0x19, 0x1F, 0xCD, 0xB4,
+    0x7D, 0x76, 0xE3, 0x1E, 0x10, 0xCA, 0xCE, 0x74, 0xD9, 0x99, 0xAD, 0x89, 0xB3, 0xCE, 0xF1, 0xA6,
+    0x35, 0x4C, 0x1D, 0xCC, 0xC5, 0x84, 0xD9, 0x84, 0x3C, 0x12, 0x79, 0xC0, 0xCA, 0x45, 0xDA, 0x9B,
+    0x84, 0xFD, 0xE3, 0x88, 0xEA, 0x84, 0x75, 0x4C, 0x44, 0x45, 0x4A, 0xA3, 0x16, 0x20, 0x83, 0x28,
+    0x56, 0xD9, 0xFE, 0x97, 0x05, 0x77, 0x70, 0xA0, 0x74, 0x4E, 0xBC, 0xBC, 0x8A, 0x07, 0xF5, 0x45,
+    0xFF, 0xD8, 0xB7, 0x70, 0xFC, 0x07, 0xD5, 0x55, 0xCF, 0x6F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x51,
+    0x63, 0x1A, 0x37, 0x71, 0x0E, 0x70, 0x00, 0x25, 0xF1, 0xA5, 0x48, 0x41, 0x8A, 0x6A, 0x89, 0x53,
+    0x0E, 0xDB, 0x7A, 0xDA, 0x1C, 0x7A, 0x43, 0x7B, 0x48, 0xB9, 0xB2, 0x17, 0x24, 0x48, 0x85, 0xC8,
+    0x8D, 0xA8, 0x5A, 0xB0, 0xAB, 0xDE, 0x51, 0xFF, 0x84, 0x15, 0xA2, 0x12, 0xE4, 0x42, 0x54, 0x40,
+    0x8A, 0xC4, 0x36, 0x9E, 0x66, 0x25, 0x22, 0x35, 0x12, 0x31, 0x42, 0x82, 0x43, 0x2F, 0xC3, 0x01,
+    0x71, 0xE0, 0x80, 0x91, 0x0C, 0xB2, 0x2A, 0x7B, 0x87, 0xF7, 0xC6, 0x25, 0x49, 0x9B, 0xE5, 0x04,
+    0x3D, 0x74, 0x34, 0xF3, 0x3C, 0xFB, 0x76, 0x3C, 0xEF, 0x7B, 0xDF, 0xFB, 0x61, 0xC4, 0x32, 0x96,
+    0x08, 0x74, 0x90, 0xC3, 0xAB, 0xBC, 0x0A, 0xAE, 0x71, 0xC7, 0x40, 0x96, 0x66, 0x29, 0x26, 0x0D,
+    0x3A, 0x86, 0x70, 0x54, 0xD3, 0x46, 0x27, 0x12, 0x5E, 0x11, 0x14, 0x10, 0xB5, 0x33, 0x86, 0xDB,
+    0x20, 0x56, 0x30, 0x74, 0x07, 0x32, 0x09, 0x23, 0x13, 0x85, 0xB0, 0x88, 0x73, 0x88, 0x26, 0x2C,
+    0x80, 0xE4, 0xB0, 0xA4, 0x37, 0x0C, 0xBD, 0xE6, 0x9A, 0x86, 0x6E, 0x89, 0x0D, 0x09, 0xDF, 0x48,
+    0x92, 0x46, 0xF1, 0x6F, 0xCD, 0x57, 0x57, 0x24, 0x04, 0x19, 0x87, 0x63, 0xD8, 0x78, 0xC6, 0xCA,
+    0x88, 0x95, 0x01, 0x2B, 0x05, 0x2B, 0x1D, 0xA3, 0x2D, 0x8C, 0x82, 0x85, 0x6F, 0x21, 0x5E, 0x64,
+    0xE1, 0x5A, 0x45, 0x60, 0x15, 0xEF, 0xE0, 0x5F, 0x47, 0x64, 0x68, 0x90, 0x75, 0x63, 0x2A, 0xF0,
+    0x56, 0xBB, 0x2C, 0xF9, 0xAD, 0x80, 0x61, 0xC1, 0xF0, 0x35, 0x81, 0x39, 0xB1, 0xB5, 0x10, 0x4B,
+    0xBB, 0xE5, 0x63, 0xA6, 0xB2, 0xC0, 0x19, 0x73, 0x56, 0x1F, 0x6F, 0x1B, 0xBB, 0xCD, 0x79, 0x3B,
+    0xB6, 0x5B, 0x46, 0x99, 0xF1, 0x3D, 0x1E, 0x1B, 0xA8, 0x43, 0x96, 0x65, 0xC2, 0xF2, 0x67, 0x16,
+    0x66, 0xDF, 0x4A, 0xFA, 0x7F, 0x89, 0x56, 0x87, 0xD6, 0x4E, 0xEB, 0x14, 0xFB, 0x21, 0xF4, 0x44,
+    0xEC, 0x82, 0xEE, 0x79, 0xBC, 0xC8, 0x1C, 0xF1, 0x8C, 0x50, 0x73, 0xA0, 0xC0, 0xF1, 0xF2, 0xAB,
+    0x96, 0x44, 0x02, 0xC9, 0x0C, 0x32, 0x95, 0xF1, 0xA3, 0xAD, 0xDB, 0xE4, 0x69, 0x91, 0xB4, 0x96,
+    0x09, 0x6D, 0xC8, 0x58, 0x91, 0xD9, 0xCB, 0x6A, 0xCB, 0x97, 0x65, 0x2D, 0xCE, 0x27, 0x58, 0xB3,
+    0xC4, 0x14, 0xC2, 0xD2, 0x13, 0x90, 0x18, 0x5B, 0xEE, 0x2A, 0xCB, 0x4C, 0xFE, 0x34, 0x49, 0x38,
+    0x26, 0x49, 0xFE, 0x43, 0x52, 0xCB, 0xD7, 0x49, 0x92, 0xEA, 0x63, 0x92, 0x9A, 0x63, 0x92, 0x5A,
+    0xBE, 0xF8, 0x1E, 0x4B, 0xCF, 0x7D, 0x4B, 0xCC, 0x55, 0x16, 0x63, 0xCB, 0x5A, 0x6D, 0xD5, 0x05,
+    0xA5, 0x1A, 0xEC, 0xF2, 0x39, 0x93, 0x1E, 0xAF, 0xFF, 0x9B, 0xA1, 0x97, 0xE1, 0x12, 0xFE, 0x45,
+    0x1B, 0x8C, 0xD0, 0x26, 0x53, 0x68, 0x3D, 0x8E, 0x6C, 0x5E, 0x75, 0x9E, 0xA7, 0xBC, 0xA2, 0x08,
+    0x2A, 0x37, 0xC7, 0x4E, 0x20, 0x11, 0xDD, 0x6B, 0x59, 0xB3, 0x79, 0x25, 0x9F, 0x41, 0x5E, 0x91,
+    0x5A, 0x18, 0xD5, 0xBC, 0x10, 0xA6, 0x94, 0xBE, 0x31, 0x44, 0x81, 0x4B, 0x2C, 0xE2, 0x09, 0x22,
+    0xE1, 0x18, 0x92, 0x28, 0x91, 0x48, 0x12, 0x31, 0xD0, 0x40, 0x54, 0x9C, 0x88, 0x8E, 0x74, 0x6E,
+    0x77, 0x3C, 0x55, 0x86, 0x74, 0xAA, 0xC3, 0x59, 0x4A, 0x4D, 0xC0, 0x1B, 0xE9, 0x45, 0x6C, 0x9E,
+    0xC7, 0x59, 0x5F, 0x2D, 0x7F, 0xA3, 0xBE, 0x1C, 0x8D, 0x3E, 0xF6, 0x9A, 0x15, 0xAF, 0x2D, 0x8F,
+    0x97, 0xAE, 0x90, 0x6D, 0xC2, 0x71, 0x94, 0xBC, 0xEB, 0x5F, 0x18, 0xB3, 0x6A, 0x33, 0x95, 0xC7,
+    0x57, 0x98, 0xDD, 0xC4, 0xC2, 0x45, 0xF4, 0x23, 0x53, 0x31, 0x6D, 0x9F, 0x23, 0xBA, 0x55, 0xC7,
+    0xFB, 0x75, 0xA2, 0x42, 0x19, 0xAD, 0x56, 0xA2, 0x8A, 0x55, 0x3C, 0xAA, 0x3D, 0xFA, 0x9D, 0xA9,
+    0x48, 0xDF, 0xD4, 0x22, 0xDD, 0x14, 0x14, 0x08, 0x3F, 0xDF, 0xFE, 0xE1, 0xF2, 0x77, 0x7E, 0x58,
+    0xBE, 0x42, 0x3D, 0x51, 0xD1, 0x24, 0xB8, 0x9E, 0x76, 0xA9, 0x2D, 0x56, 0x18, 0x83, 0xFA, 0xDC,
+    0x8B, 0xE0, 0xB9, 0x82, 0x85, 0x00, 0xA5, 0xF8, 0x35, 0xA7, 0x4E, 0x87, 0x8F, 0xB8, 0x8A, 0xAD,
+    0x9E, 0xCF, 0x95, 0xF0, 0x0B, 0xF8, 0x1A, 0x61, 0x8E, 0x28, 0xC7, 0x75, 0x49, 0x33, 0xFB, 0xDE,
+    0xAC, 0x36, 0x41, 0x15, 0xE9, 0x44, 0x99, 0x2B, 0x16, 0x5E, 0x50, 0x07, 0x55, 0x50, 0x86, 0x45,
+    0x58, 0x44, 0x3A, 0xCE, 0xA9, 0x57, 0xBA, 0xE6, 0x6A, 0x13, 0x94, 0xB1, 0x4E, 0x52, 0x23, 0x1A,
+    0xBF, 0x72, 0xE5, 0x2F, 0x37, 0xC6, 0x22, 0xD5, 0xE8, 0x2D, 0xFB, 0x6F, 0x8E, 0xB7, 0x97, 0x81,
+    0xDD, 0x3B, 0xDD, 0xCC, 0x34, 0x67, 0xAE, 0xDD, 0xB3, 0x0D, 0x8F, 0xE6, 0x25, 0x9A, 0xB3, 0xD3,
+    0xB3, 0x0B, 0x3B, 0xBD, 0x85, 0x07, 0x4B, 0x9D, 0xB9, 0x29, 0xCC, 0x63, 0x23, 0xAA, 0xD7, 0x07,
+    0xD9, 0x1F, 0xBB, 0xE9, 0x86, 0xA3, 0x1C, 0xB2, 0xD2, 0x9B, 0xF2, 0xC7, 0x53, 0xE8, 0x1D, 0xB1,
+    0x45, 0xD1, 0xE2, 0xAC, 0x0A, 0x57, 0x2B, 0x72, 0x3D, 0x51, 0x51, 0x4A, 0x94, 0x58, 0x22, 0xF6,
+    0x2D, 0x11, 0x89, 0x3A, 0xE9, 0xFD, 0x69, 0x8C, 0x98, 0x13, 0xE8, 0x51, 0x22, 0xE5, 0x33, 0xD7,
+    0x0F, 0xB5, 0x2B, 0x75, 0xC7, 0xC3, 0xB6, 0xD7, 0x90, 0xAB, 0x9D, 0x7E, 0xBF, 0x3F, 0x1C, 0x0E,
+    0x3F, 0xDB, 0xDA, 0x7A, 0xDF, 0xFC, 0x26, 0x6F, 0xE4, 0x8B, 0x9F, 0x4E, 0x49, 0x0A, 0x1A, 0x85,
+    0x8E, 0x02, 0xC8, 0xBD, 0x3C, 0xB3, 0xC5, 0x33, 0xCD, 0xF4, 0xC2, 0xAB, 0xE1, 0x3D, 0x54, 0x5E,
+    0xDA, 0xF7, 0xA5, 0xAB, 0x26, 0xC4, 0x95, 0xEA, 0xE7, 0xC7, 0xAD, 0x3B, 0x6D, 0x51, 0x11, 0x62,
+    0x5B, 0x17, 0x4F, 0x9F, 0xCA, 0x8C, 0x39, 0x20, 0x7F, 0xE8, 0xA1, 0x06, 0x83, 0x83, 0xAF, 0x65,
+    0xD7, 0x79, 0xCF, 0x21, 0xC3, 0x8F, 0x76, 0x33, 0x2E, 0xA6, 0xC8, 0x3C, 0xC0, 0xEB, 0xE9, 0xB9,
+    0x81, 0x58, 0xC2, 0x81, 0x29, 0xAE, 0xAD, 0x5D, 0x38, 0x3B, 0xBF, 0xF2, 0xED, 0xB9, 0x57, 0x6F,
+    0x4D, 0x0F, 0xF6, 0xD2, 0xB9, 0xEE, 0xF9, 0xEE, 0x07, 0xD8, 0x16, 0xF9, 0x6B, 0x7B, 0x7B, 0xA7,
+    0xAD, 0x0F, 0x86, 0x33, 0xF3, 0x5D, 0x7A, 0x00, 0x17, 0xA8, 0x2E, 0x28, 0xB3, 0x86, 0xF6, 0x9B,
+    0xE2, 0x1C, 0xB5, 0x9A, 0xD3, 0xB9, 0x73, 0xD2, 0x67, 0xFA, 0x3C, 0xB9, 0x99, 0xA5, 0xF9, 0xFE,
+    0xDA, 0x93, 0x35, 0x76, 0x66, 0x2D, 0xB2, 0xB5, 0x59, 0xB7, 0x7D, 0xE4, 0xCF, 0x42, 0xFC, 0xA4,
+    0xC2, 0xB7, 0xF0, 0xE1, 0xD0, 0xF9, 0xAB, 0xF0, 0x1F, 0xAA, 0x68, 0x1D, 0xEF, 0xBE, 0x4D, 0x47,
+    0x08, 0x2E, 0x6A, 0xC4, 0x32, 0xC8, 0x5D, 0xC2, 0xD0, 0x85, 0x00, 0x45, 0x95, 0xE0, 0x08, 0x19,
+    0xCD, 0xDF, 0xFD, 0xFD, 0x93, 0xC3, 0xE0, 0x8D, 0x95, 0xB0, 0xD4, 0x59, 0x4A, 0x99, 0x3A, 0x03,
+    0x6C, 0xA0, 0x7D, 0xFE, 0xB7, 0xF1, 0x37, 0xB5, 0x55, 0x3B, 0x93, 0xDC, 0x44, 0x10, 0xEE, 0x91,
+    0xB0, 0x05, 0x25, 0x40, 0x0E, 0x0E, 0x17, 0x65, 0x82, 0x25, 0x21, 0xA2, 0x40, 0x89, 0x03, 0x02,
+    0x7C, 0x23, 0x20, 0x70, 0x70, 0xC9, 0x41, 0x59, 0x31, 0x04, 0x44, 0xFE, 0x0D, 0x7B, 0x48, 0x44,
+    0x04, 0x24, 0x97, 0x90, 0x90, 0xE0, 0x80, 0xC4, 0x4E, 0x9C, 0x3A, 0x58, 0x9F, 0x44, 0x39, 0x20,
+    0xB8, 0xC0, 0x2A, 0x12, 0xA7, 0xEB, 0xC2, 0x55, 0x04, 0x24, 0x03, 0xA5, 0x40, 0x7B, 0xA5, 0x55,
+    0xF3, 0x75, 0x8F, 0xF6, 0xE1, 0xBB, 0x3D, 0x88, 0x98, 0x9A, 0xFD, 0x5A, 0xEA, 0x9E, 0xE9, 0x6E,
+    0xF5, 0x6B, 0x89, 0x28, 0x6A, 0x08, 0x2B, 0x9E, 0x0B, 0x26, 0x1E, 0x1D, 0x05, 0xDC, 0x12, 0x2D,
+    0x93, 0xB3, 0x2A, 0xA3, 0xA5, 0xAD, 0x93, 0xD6, 0xF4, 0xB6, 0x34, 0xFC, 0xB0, 0x2B, 0x4A, 0x7A,
+    0x87, 0x8F, 0x77, 0xDF, 0xF1, 0x2B, 0x18, 0xC8, 0x7C, 0x7A, 0xD6, 0x92, 0xEB, 0x92, 0x6C, 0x7A,
+    0x64, 0xDA, 0xFD, 0x94, 0x12, 0xCE, 0x88, 0xEE, 0xAA, 0xD4, 0x1C, 0x12, 0x85, 0x5C, 0x87, 0x4F,
+    0xDC, 0xCC, 0xB8, 0x36, 0xAE, 0x67, 0x47, 0x74, 0xB2, 0xBC, 0x4E, 0xD1, 0x40, 0x9B, 0x65, 0xB2,
+    0x8C, 0xAA, 0x88, 0x68, 0xCF, 0xD6, 0x44, 0xEF, 0x8E, 0xCC, 0xBD, 0xE9, 0xDB, 0x7B, 0x87, 0xF2,
+    0xF0, 0xEA, 0x4D, 0xC1, 0x9B, 0x6F, 0x8A, 0xA9, 0xC6, 0x2C, 0xC8, 0x7C, 0x43, 0x70, 0x09, 0x3E,
+    0x8D, 0xEB, 0x06, 0x0F, 0xC7, 0x64, 0x16, 0x99, 0x39, 0xA1, 0x24, 0x93, 0x33, 0x1F, 0xE9, 0xF9,
+    0xAF, 0x04, 0x5F, 0xDF, 0xB2, 0xF2, 0x8A, 0x27, 0x49, 0x59, 0xB1, 0xAC, 0xCE, 0x93, 0xDE, 0x33,
+    0xF5, 0xF3, 0xE8, 0x8D, 0xAD, 0xE3, 0x94, 0xD4, 0x9E, 0x2F, 0x9F, 0x1B, 0xBB, 0x6D, 0x49, 0x9E,
+    0xE7, 0x5F, 0xE0, 0xEA, 0x29, 0x7E, 0x29, 0x5E, 0x67, 0x30, 0x0A, 0x79, 0x8C, 0xF3, 0xAB, 0xD7,
+    0x45, 0x9E, 0xC7, 0xCC, 0xCB, 0x94, 0xB9, 0xDD, 0x2D, 0x3D, 0x90, 0xBB, 0xB0, 0x0E, 0x27, 0xFE,
+    0xC6, 0x63, 0x2D, 0x6A, 0x3F, 0xA4, 0x5B, 0xD4, 0x51, 0x1B, 0xCE, 0xC3, 0x66, 0x34, 0x74, 0x05,
+    0x96, 0x56, 0xA7, 0xCE, 0xE9, 0x58, 0xBD, 0xFE, 0x90, 0x1F, 0x42, 0xFA, 0x1B, 0x74, 0x1C, 0xEC,
+    0x94, 0xDE, 0x19, 0x2D, 0x9C, 0x8E, 0x06, 0x35, 0xB4, 0x48, 0x10, 0x16, 0xA5, 0x82, 0x08, 0xD9,
+    0x63, 0x35, 0x76, 0x19, 0x9E, 0x5C, 0xC0, 0xEA, 0xE1, 0x52, 0x50, 0xDD, 0xE6, 0x66, 0x02, 0x63,
+    0x4C, 0x41, 0x47, 0x84, 0x9C, 0x42, 0xFF, 0x52, 0x5D, 0x00, 0x4E, 0xF5, 0x75, 0xBA, 0xE1, 0x18,
+    0x95, 0x5A, 0x3D, 0x69, 0x9D, 0x62, 0x49, 0xF4, 0x35, 0x0A, 0x04, 0x8A, 0x26, 0x50, 0x89, 0x12,
+    0x8C, 0xF0, 0x68, 0xE9, 0x92, 0xF5, 0x56, 0x9E, 0x7F, 0x0E, 0x97, 0xFF, 0xC0, 0xEF, 0x27, 0x9C,
+    0x2B, 0x48, 0x55, 0x46, 0x50, 0x35, 0xD9, 0xF1, 0x9A, 0x51, 0x00, 0xCB, 0x31, 0x94, 0xA6, 0x08,
+    0x28, 0x0A, 0x1B, 0x95, 0x4A, 0x31, 0xAC, 0xA7, 0xC8, 0x68, 0x55, 0xEA, 0xEB, 0xB8, 0xAE, 0x4A,
+    0x39, 0x15, 0xBC, 0x04, 0xEF, 0x93, 0x2A, 0x43, 0xB6, 0x93, 0x06, 0x2A, 0x22, 0x67, 0x71, 0xA9,
+    0x13, 0x77, 0x7E, 0x3E, 0x59, 0x07, 0x44, 0xD3, 0xB5, 0x01, 0x8D, 0xA8, 0x6A, 0x62, 0x8D, 0x4D,
+    0x43, 0x57, 0xEF, 0x17, 0xC3, 0x8F, 0x55, 0x6F, 0xA5, 0xBA, 0x24, 0xC4, 0x9D, 0x44, 0xDB, 0x05,
+    0x7A, 0xFA, 0x7D, 0x5E, 0xAC, 0x6C, 0x5E, 0xCF, 0x01, 0xA9, 0x30, 0x43, 0x49, 0x06, 0x59, 0xC9,
+    0x8E, 0xE1, 0x17, 0x74, 0xA8, 0x4E, 0x82, 0xA1, 0x55, 0x21, 0xA1, 0xA6, 0xB0, 0xDD, 0xB4, 0x5C,
+    0x3A, 0x64, 0x22, 0x54, 0x45, 0xB8, 0x83, 0x08, 0x4E, 0x98, 0xF1, 0x45, 0xA6, 0x62, 0x91, 0x47,
+    0x8A, 0xA1, 0x70, 0xF0, 0x2C, 0x2A, 0x26, 0x4C, 0xD7, 0xE0, 0x5D, 0x1F, 0xF0, 0x03, 0x1C, 0x99,
+    0x48, 0xD2, 0x4B, 0x2D, 0x7D, 0xAD, 0x82, 0x52, 0xFC, 0x6C, 0xA5, 0xA3, 0x5E, 0xAC, 0x3C, 0x7B,
+    0x70, 0xD0, 0x56, 0x07, 0x6D, 0x71, 0xFB, 0xE5, 0xFD, 0x5D, 0x27, 0xFB, 0xB4, 0xAF, 0x4E, 0x7B,
+    0x7E, 0xDA, 0x73, 0x9D, 0x96, 0xF6, 0xB3, 0x2E, 0xEC, 0x6C, 0x6D, 0x7F, 0xED, 0xA3, 0xBE, 0xA8,
+    0x8B, 0xFA, 0x62, 0xC2, 0x6E, 0x1C, 0x6B, 0x0E, 0x10, 0x7F, 0x21, 0x93, 0x86, 0xCC, 0x7F, 0x91,
+    0x39, 0x99, 0x61, 0x43, 0x64, 0x2E, 0xE1, 0xBA, 0x27, 0x28, 0x99, 0xD0, 0x13, 0x32, 0xF7, 0x45,
+    0x21, 0x76, 0xE8, 0x77, 0xFF, 0xAF, 0xBB, 0x1B, 0x77, 0xE4, 0x77, 0xBB, 0xD9, 0x92, 0x69, 0x77,
+    0xAD, 0x70, 0x05, 0xCF, 0x0B, 0x6E, 0x0A, 0x2E, 0x8B, 0x81, 0x8A, 0x55, 0x1C, 0xAE, 0x64, 0xAB,
+    0x6C, 0xAF, 0x49, 0xAB, 0xF5, 0x79, 0x8E, 0xB8, 0x4B, 0x08, 0x9F, 0x79, 0x82, 0x54, 0x08, 0x33,
+    0xE8, 0x8C, 0x93, 0x39, 0x7A, 0xE4, 0xC9, 0xBE, 0x27, 0x69, 0x30, 0xA7, 0x78, 0x4D, 0x6C, 0x28,
+    0xC4, 0x0C, 0x42, 0x30, 0x3F, 0x20, 0x07, 0xE9, 0xAD, 0x12, 0x87, 0x00, 0xC7, 0x3C, 0x64, 0xEF,
+    0x8D, 0xF3, 0xD1, 0x8F, 0x4E, 0x04, 0xE3, 0x91, 0x76, 0x0D, 0x14, 0x48, 0x0F, 0x49, 0xDB, 0x4F,
+    0x75, 0x10, 0x88, 0x68, 0xE6, 0x45, 0xEE, 0xBC, 0x48, 0x47, 0xDF, 0xBD, 0x48, 0x49, 0x3B, 0x91,
+    0x59, 0x17, 0xB5, 0x2A, 0x0A, 0xFE, 0x72, 0xD2, 0xB5, 0xE1, 0x33, 0x54, 0x25, 0x62, 0xF3, 0xA5,
+    0x8E, 0xC1, 0xFD, 0xA9, 0xF4, 0xA4, 0x59, 0xA8, 0x68, 0xF2, 0xCC, 0x17, 0xAC, 0xDC, 0xC2, 0xE5,
+    0xA9, 0x16, 0xE1, 0xB7, 0x32, 0x03, 0xF8, 0x1E, 0x5A, 0x48, 0x02, 0xB5, 0x8D, 0x77, 0xEF, 0xD8,
+    0x32, 0x47, 0x20, 0xA5, 0xD3, 0xD7, 0x98, 0x5D, 0xC0, 0xEF, 0x07, 0x5F, 0xCD, 0xD2, 0xB7, 0x2C,
+    0x15, 0x5C, 0x74, 0x48, 0x0F, 0x15, 0x8D, 0x41, 0x2B, 0x14, 0xDA, 0x65, 0xF8, 0x27, 0x9A, 0x69,
+    0xDF, 0x0A, 0xD6, 0x2F, 0x61, 0xBF, 0x85, 0x28, 0x22, 0x1E, 0xD1, 0xAC, 0xF1, 0x35, 0x31, 0xF2,
+    0x81, 0xC0, 0xC7, 0x02, 0x8F, 0xC8, 0x0F, 0x1B, 0x8D, 0xCC, 0xAE, 0x15, 0x39, 0xC3, 0x00, 0x94,
+    0x56, 0xEC, 0x50, 0x32, 0xB1, 0x43, 0xEB, 0xC5, 0x0E, 0x73, 0x23, 0x91, 0x2C, 0x24, 0x73, 0x4C,
+    0xCD, 0xE4, 0x39, 0x5C, 0x4E, 0x7E, 0x87, 0xD1, 0xE4, 0xCF, 0x4E, 0x62, 0x21, 0x41, 0xE6, 0x46,
+    0x40, 0x5B, 0x32, 0x93, 0xE6, 0x96, 0x19, 0x2C, 0x82, 0x54, 0x06, 0xAF, 0x7D, 0x2A, 0xD5, 0xFB,
+    0x04, 0x4C, 0xFB, 0x0B, 0x98, 0xB6, 0xAE, 0x7A, 0x80, 0x65, 0x7C, 0x5F, 0x82, 0x70, 0xD5, 0x91,
+    0xA4, 0x38, 0x18, 0xFF, 0x91, 0xFE, 0xAF, 0xF5, 0x0F, 0xCD, 0x54, 0x3D, 0x8F, 0x1C, 0x45, 0x10,
+    0xAD, 0x99, 0x96, 0x3C, 0xC1, 0x04, 0x1D, 0x5D, 0x02, 0x42, 0x9D, 0x90, 0xCF, 0x3F, 0x70, 0x8F,
+    0x7C, 0x01, 0x01, 0x01, 0x1F, 0x62, 0x23, 0xFE, 0x00, 0x22, 0xB9, 0x84, 0x10, 0xDF, 0x0C, 0x5C,
+    0x40, 0x40, 0x60, 0xFE, 0x81, 0x1D, 0x93, 0xF8, 0x0F, 0xEC, 0x5E, 0xB7, 0x7D, 0xC1, 0x49, 0x38,
+    0xF0, 0x98, 0x84, 0xC0, 0xC1, 0xF5, 0xE9, 0x90, 0x8C, 0x44, 0xE0, 0xDE, 0xF3, 0x70, 0x6E, 0xDB,
+    0x3D, 0x53, 0xBC, 0x9A, 0x15, 0x42, 0xC2, 0x17, 0x11, 0x20, 0x46, 0xDB, 0xDD, 0xDB, 0x35, 0x35,
+    0x5D, 0x55, 0xEF, 0xBD, 0x2E, 0xFA, 0x82, 0xF0, 0xE8, 0x41, 0xE6, 0x79, 0xF9, 0x1B, 0x65, 0xFE,
+    0x92, 0xDE, 0x7A, 0x16, 0x93, 0x81, 0x23, 0x57, 0x23, 0x91, 0x7B, 0x30, 0x11, 0xD9, 0x68, 0x7B,
+    0x6A, 0xB2, 0x0E, 0xA4, 0x79, 0x3F, 0x51, 0xCD, 0x03, 0x93, 0xE2, 0xD1, 0xFA, 0x72, 0x9E, 0x71,
+    0x0E, 0x77, 0x47, 0x99, 0xBA, 0xBB, 0x81, 0xC9, 0x9E, 0x66, 0xEB, 0xCD, 0x39, 0xEB, 0x51, 0xC7,
+    0xEE, 0xE1, 0x54, 0x25, 0x13, 0xDD, 0x7E, 0xAE, 0x72, 0xF3, 0x64, 0x2E, 0xB8, 0x4E, 0x4C, 0xDD,
+    0xCF, 0x73, 0xD7, 0x9B, 0xB1, 0x73, 0xBE, 0x9A, 0x0C, 0x87, 0x82, 0xBF, 0xE3, 0x91, 0xBA, 0x73,
+    0xCE, 0x64, 0x92, 0x9D, 0xA8, 0x62, 0xCD, 0x54, 0xB0, 0x2F, 0x5B, 0xBA, 0xA7, 0x3C, 0x45, 0x35,
+    0x94, 0xF0, 0x61, 0x4F, 0x8E, 0x5B, 0xAA, 0xD3, 0x5B, 0xB9, 0xAE, 0x89, 0x6E, 0x1F, 0x62, 0xB1,
+    0x44, 0xD9, 0xF4, 0x45, 0xD2, 0x43, 0x99, 0xAA, 0xA8, 0x46, 0x95, 0x54, 0x2C, 0x72, 0x1D, 0x69,
+    0x46, 0xCE, 0xDD, 0x47, 0x03, 0xD9, 0x33, 0x4F, 0x06, 0xE7, 0x68, 0xEE, 0x11, 0xA4, 0x45, 0xF6,
+    0x44, 0x25, 0x46, 0x01, 0x2C, 0x14, 0x2A, 0xAC, 0x32, 0x51, 0x93, 0xA8, 0xE1, 0x48, 0x16, 0x6E,
+    0x16, 0x66, 0x1B, 0x88, 0x3E, 0x23, 0xDA, 0x6B, 0x10, 0xF9, 0xE9, 0x40, 0xE5, 0x15, 0xD0, 0xD8,
+    0x6C, 0xE0, 0x76, 0xF0, 0x2F, 0x0D, 0xCC, 0x7C, 0x85, 0x31, 0x39, 0x4C, 0x2D, 0x49, 0x31, 0x37,
+    0x85, 0x87, 0x1E, 0x19, 0x20, 0xD4, 0x62, 0xD8, 0xFB, 0x9B, 0x24, 0x07, 0xFB, 0x92, 0x26, 0xC8,
+    0x98, 0x64, 0x3E, 0xCE, 0x62, 0x78, 0x21, 0xB4, 0x99, 0xEF, 0xE5, 0x83, 0xC9, 0x78, 0x18, 0xA2,
+    0x6D, 0x11, 0xA0, 0x3F, 0x16, 0x43, 0x01, 0x17, 0x29, 0x5F, 0x0C, 0x28, 0x9E, 0x26, 0x82, 0x4B,
+    0x85, 0x92, 0x7A, 0xF9, 0x39, 0x31, 0xE0, 0x57, 0x23, 0x7E, 0x46, 0x99, 0xCC, 0x11, 0xD8, 0x32,
+    0x07, 0x2D, 0xB3, 0xB7, 0x38, 0x8D, 0x6F, 0xA1, 0xF0, 0x72, 0xD6, 0xA3, 0x20, 0xD2, 0xC1, 0xA0,
+    0x47, 0xB7, 0xCB, 0xFA, 0x11, 0x22, 0x36, 0x30, 0x74, 0xC0, 0x6C, 0x89, 0x42, 0x72, 0x36, 0x75,
+    0xFC, 0x1B, 0xCE, 0x98, 0x54, 0xA4, 0x8D, 0xF6, 0xF4, 0x35, 0x78, 0x18, 0x33, 0xA9, 0x8B, 0x48,
+    0xFA, 0x8E, 0xA7, 0x43, 0xDB, 0xBE, 0x3B, 0xE2, 0xDB, 0x13, 0xE6, 0x19, 0x31, 0x82, 0xE5, 0x04,
+    0x22, 0x7F, 0xC5, 0x60, 0x30, 0x67, 0xFC, 0x9A, 0xD4, 0xB0, 0xA6, 0x32, 0xAC, 0xA9, 0x88, 0xBB,
+    0x55, 0x0D, 0x9B, 0xD5, 0x41, 0xEF, 0x78, 0x12, 0x9F, 0x7E, 0x4D, 0xF5, 0x08, 0x86, 0x33, 0xC6,
+    0x06, 0x63, 0x96, 0xB1, 0xA1, 0xCF, 0x67, 0xBC, 0xCB, 0x18, 0x09, 0x63, 0x70, 0xFC, 0x8A, 0xF6,
+    0x56, 0xAB, 0x4F, 0x10, 0xE6, 0x19, 0xC6, 0xDD, 0x6B, 0x52, 0xFC, 0xC7, 0xB6, 0xA5, 0x12, 0x30,
+    0xD4, 0x02, 0x12, 0x80, 0x76, 0xD8, 0xA2, 0x66, 0xD1, 0x56, 0x13, 0x16, 0xD4, 0xCB, 0xE5, 0x7A,
+    0x34, 0xA2, 0x3A, 0x20, 0x15, 0xA9, 0x7C, 0xFD, 0x23, 0xFC, 0x33, 0x41, 0x07, 0x96, 0xEA, 0x81,
+    0xB4, 0x2F, 0x47, 0x92, 0x82, 0x85, 0x32, 0x18, 0x6F, 0x2E, 0xC6, 0xBE, 0x4C, 0x42, 0xE3, 0xF1,
+    0x62, 0xEC, 0xC5, 0x18, 0xC8, 0xB4, 0x30, 0xE2, 0xE5, 0xB1, 0x04, 0x6F, 0xBC, 0xC2, 0x26, 0x22,
+    0xB6, 0xCA, 0xC2, 0x00, 0x6F, 0x65, 0x4A, 0x42, 0xC3, 0x24, 0x8C, 0xDB, 0x5B, 0x48, 0x41, 0xFB,
+    0x43, 0xC9, 0x74, 0xB5, 0x5A, 0x7D, 0x2A, 0x98, 0x63, 0x34, 0x3B, 0x95, 0x97, 0xC8, 0xBE, 0x46,
+    0xF6, 0x7F, 0x6D, 0x5F, 0xAD, 0x56, 0x38, 0x64, 0x42, 0x96, 0xE3, 0xF5, 0x6F, 0x3F, 0x94, 0x6F,
+    0x77, 0x38, 0x5D, 0x0A, 0xBB, 0xC4, 0x64, 0x22, 0x4A, 0x2B, 0x70, 0x49, 0x7B, 0xDC, 0x59, 0x88,
+    0x7E, 0x26, 0xB9, 0x08, 0x59, 0x25, 0x11, 0x7F, 0x9D, 0x74, 0x10, 0x05, 0xE8, 0x68, 0xBF, 0x15,
+    0x00, 0x4C, 0xE0, 0xA5, 0x43, 0xD8, 0x5F, 0x32, 0xBC, 0x00, 0xDB, 0xD9, 0xCB, 0xBC, 0xC8, 0x52,
+    0xCE, 0xC2, 0x03, 0x4A, 0x65, 0x29, 0x04, 0xA1, 0x45, 0xA8, 0x8B, 0x17, 0x10, 0x5B, 0xBC, 0xA0,
+    0x8B, 0x65, 0xAD, 0x78, 0xB7, 0x76, 0xBB, 0xB5, 0x92, 0x8A, 0xE5, 0xD0, 0xDD, 0xAA, 0xF8, 0x39,
+    0x3B, 0xAC, 0x76, 0xEE, 0x32, 0xF6, 0x0A, 0x90, 0x6C, 0xB1, 0x5A, 0xAE, 0xF9, 0x21, 0x27, 0x34,
+    0x98, 0x86, 0x95, 0x20, 0xD4, 0x43, 0x60, 0x9C, 0x6E, 0x70, 0x40, 0xD4, 0xA4, 0x5E, 0xDF, 0x97,
+    0x4F, 0x45, 0xA1, 0x41, 0x00, 0x5B, 0x6E, 0x51, 0x39, 0x16, 0x2B, 0xD7, 0x6B, 0xF4, 0x12, 0x0B,
+    0x2F, 0x54, 0x4A, 0x82, 0xFF, 0xF2, 0x56, 0x30, 0xD9, 0xB4, 0x54, 0x5D, 0x06, 0x72, 0x00, 0x74,
+    0x06, 0x28, 0x51, 0x04, 0x78, 0xC0, 0x3F, 0xFC, 0x2F, 0x5A, 0x5D, 0xD1, 0xD3, 0xFB, 0x44, 0x5F,
+    0xD1, 0x7B, 0xC8, 0x84, 0x34, 0xD4, 0x08, 0xE1, 0xD3, 0xD2, 0x84, 0xD0, 0x9C, 0x5A, 0xBA, 0xF6,
+    0xB9, 0x71, 0x4F, 0xA0, 0x9F, 0x84, 0x2D, 0xC8, 0xB9, 0xCE, 0x28, 0x41, 0x31, 0xE4, 0x55, 0xB2,
+    0x07, 0x2B, 0xC8, 0x16, 0x97, 0x7D, 0xD2, 0xD2, 0xCA, 0xF6, 0xA1, 0xDB, 0xE7, 0xC8, 0x56, 0xBF,
+    0x4C, 0xD6, 0xD7, 0x7F, 0xA0, 0x04, 0x95, 0xBB, 0x93, 0x5C, 0xCC, 0x26, 0x72, 0xCB, 0xC8, 0x76,
+    0xE8, 0xBE, 0xE1, 0x1A, 0xE5, 0xA1, 0x04, 0x13, 0x50, 0xC2, 0x9D, 0x58, 0x4D, 0xCD, 0xB3, 0x54,
+    0xF0, 0x07, 0x6F, 0x50, 0xE8, 0x13, 0xB0, 0x6C, 0x52, 0xC7, 0x6D, 0x35, 0xA3, 0x7B, 0x16, 0x7C,
+    0xC4, 0x03, 0x75, 0x11, 0x94, 0x9B, 0x5C, 0xA1, 0x79, 0x48, 0xB3, 0x41, 0x3F, 0x89, 0x95, 0x28,
+    0x1B, 0xF1, 0xEA, 0x88, 0x3B, 0x84, 0x9C, 0xD0, 0x67, 0x03, 0xF4, 0xA0, 0xCF, 0x91, 0x8D, 0xBE,
+    0x00, 0xF3, 0xFA, 0x77, 0x11, 0xB7, 0x48, 0xC5, 0xE0, 0x04, 0x4C, 0xBD, 0x4C, 0xD2, 0xB8, 0xA4,
+    0x4E, 0xE9, 0xBA, 0x98, 0xE0, 0x67, 0x1F, 0xA3, 0xE1, 0xD9, 0x13, 0xE9, 0xC0, 0x0F, 0xA4, 0x15,
+    0x7B, 0x87, 0x46, 0xE5, 0x2D, 0xC0, 0xF4, 0x9A, 0x7D, 0xE7, 0x2B, 0xC6, 0xE1, 0x25, 0x3C, 0x45,
+    0x86, 0xC2, 0x24, 0x2E, 0x41, 0x2E, 0x91, 0x28, 0x9A, 0x9B, 0xF1, 0x8D, 0xAF, 0x23, 0x6E, 0x98,
+    0x18, 0x1C, 0x2E, 0x5D, 0xE3, 0xA5, 0x0B, 0xEA, 0x50, 0x66, 0xA8, 0xC5, 0xA1, 0xF1, 0xE1, 0x24,
+    0x64, 0xA7, 0x3D, 0x34, 0x0F, 0x26, 0x0B, 0x39, 0xDA, 0x89, 0xE0, 0x61, 0x70, 0xD0, 0x96, 0x45,
+    0xC0, 0x9F, 0x3E, 0x16, 0x79, 0x0E, 0x20, 0xC6, 0x20, 0x63, 0x77, 0x2A, 0xE9, 0x6C, 0xDF, 0x04,
+    0x28, 0xE2, 0x76, 0x26, 0xED, 0xCC, 0xFD, 0xB6, 0x3E, 0x3B, 0xBD, 0x88, 0xEA, 0xC5, 0x36, 0xE5,
+    0x22, 0xE5, 0xC3, 0xA6, 0xCF, 0xD6, 0x1C, 0xC5, 0x4E, 0x9F, 0x86, 0xC9, 0x1E, 0x6D, 0x53, 0xF3,
+    0xD8, 0xE7, 0x43, 0xC5, 0xD1, 0x36, 0x3D, 0x27, 0xFD, 0x28, 0x9A, 0xAC, 0x2E, 0x33, 0xBA, 0xF8,
+    0xE4, 0x70, 0xD9, 0xEC, 0x81, 0x7F, 0xA7, 0xD7, 0x4F, 0x51, 0xAC, 0xBA, 0xCA, 0x42, 0xA0, 0xA3,
+    0xA5, 0x1F, 0xFD, 0x17, 0xCF, 0x9F, 0x85, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0x3D, 0xB6, 0x45,
+    0x2C, 0xE1, 0xC2, 0xD5, 0x36, 0x69, 0xFC, 0x13, 0xFC, 0x07, 0x76, 0xF7, 0x0D, 0xF0, 0x03, 0x36,
+    0x45, 0x86, 0x36, 0x2D, 0xD0, 0xEC, 0x1F, 0x98, 0x59, 0x8F, 0x48, 0x41, 0xBB, 0x15, 0x6D, 0x28,
+    0xF8, 0x10, 0x4A, 0x91, 0x86, 0x72, 0x77, 0x6C, 0xB1, 0x05, 0x05, 0x8D, 0x45, 0x93, 0x82, 0x22,
+    0x96, 0x40, 0x0A, 0x82, 0x22, 0x56, 0xE4, 0x15, 0xDE, 0xC5, 0xF6, 0xE5, 0x9C, 0x37, 0xB3, 0x1F,
+    0x59, 0x44, 0x32, 0x92, 0xCF, 0xD8, 0xE7, 0xF9, 0xDD, 0x8F, 0x73, 0xEF, 0x7D, 0xBE, 0x3F, 0x03,
+    0x3E, 0x4D, 0x1B, 0xC0, 0x3D, 0xEE, 0x81, 0xB4, 0x9D, 0x80, 0x68, 0x70, 0x15, 0x60, 0x69, 0x4B,
+    0xF2, 0x6C, 0x10, 0x69, 0xEF, 0x20, 0x2F, 0xE6, 0xF3, 0xF2, 0xCC, 0xF8, 0xEB, 0x04, 0xA3, 0x13,
+    0x3E, 0x12, 0x3C, 0x17, 0x9C, 0xDB, 0x0C, 0xF1, 0x58, 0xD4, 0x08, 0xEC, 0x51, 0x07, 0x14, 0x2F,
+    0x47, 0x20, 0xBB, 0x20, 0x99, 0x4C, 0x45, 0x83, 0xD0, 0x56, 0x08, 0xCA, 0x0B, 0x70, 0xC1, 0x78,
+    0x9B, 0xD8, 0x2B, 0xAB, 0x61, 0x4D, 0x60, 0x75, 0xC2, 0xF7, 0xAC, 0x72, 0x35, 0xF1, 0x73, 0x86,
+    0x15, 0x78, 0xE7, 0xD1, 0x28, 0x97, 0xF1, 0x39, 0xD7, 0x90, 0xBE, 0x24, 0x01, 0xF7, 0x84, 0x04,
+    0xCA, 0x82, 0x10, 0x8E, 0x8C, 0x0C, 0xC9, 0x96, 0xE6, 0x46, 0x4C, 0x7A, 0x3B, 0xE9, 0x8C, 0x58,
+    0xFE, 0x68, 0xE7, 0xC1, 0xA1, 0x45, 0x0A, 0xA9, 0x4F, 0x84, 0x55, 0x4A, 0x98, 0x20, 0x6C, 0xE8,
+    0xD8, 0x68, 0x33, 0x28, 0x27, 0x0A, 0x72, 0xFD, 0x2B, 0xCD, 0x06, 0x5D, 0xEB, 0xF9, 0x7C, 0x58,
+    0x03, 0x27, 0xB7, 0xAE, 0xE1, 0xD6, 0x35, 0xBE, 0xED, 0x2A, 0xEF, 0x5C, 0x19, 0x5D, 0xC6, 0x0C,
+    0x21, 0x9C, 0x9E, 0x59, 0xB5, 0x46, 0x3C, 0xE4, 0x2B, 0xB8, 0x84, 0x01, 0xFC, 0xD2, 0x23, 0xEC,
+    0x99, 0xE8, 0xE8, 0x48, 0x1C, 0x34, 0xF0, 0x92, 0x36, 0xBC, 0x5A, 0x0A, 0x5A, 0xA7, 0xD3, 0xF7,
+    0xD4, 0x9B, 0x31, 0x99, 0xA4, 0x62, 0x3E, 0x19, 0xB3, 0x8C, 0x07, 0xE9, 0xA2, 0x40, 0x49, 0xE4,
+    0x24, 0xA4, 0x59, 0x48, 0x69, 0x51, 0xD6, 0x37, 0x59, 0x78, 0x79, 0x0F, 0xE9, 0x36, 0x54, 0x8E,
+    0xA9, 0xCD, 0x3F, 0x81, 0xEB, 0x64, 0xA9, 0xDA, 0xEE, 0xF6, 0x76, 0xE3, 0x5E, 0xDA, 0x49, 0xBA,
+    0xD4, 0x03, 0x7B, 0x02, 0xD9, 0x0D, 0x88, 0xCB, 0xB4, 0x2B, 0xD3, 0xCB, 0x29, 0x4B, 0xF5, 0x5E,
+    0x6A, 0x97, 0x1F, 0xAF, 0xA5, 0xE4, 0x24, 0x51, 0xA7, 0xC0, 0xAB, 0x59, 0x0A, 0x72, 0xDB, 0x78,
+    0xFB, 0xDA, 0xFB, 0x2F, 0x24, 0xF6, 0x0B, 0xC1, 0xDF, 0xBE, 0x3F, 0xBE, 0x79, 0x30, 0x62, 0xCE,
+    0x0A, 0x49, 0xE9, 0x54, 0x71, 0x46, 0xB2, 0x0B, 0x95, 0x74, 0x4B, 0xCA, 0x63, 0xA4, 0x78, 0x82,
+    0xC9, 0x1B, 0x58, 0x5D, 0x85, 0x11, 0xDF, 0x90, 0xA5, 0x48, 0xE5, 0x8C, 0x44, 0x11, 0x85, 0x86,
+    0xAD, 0x0E, 0x1B, 0x32, 0x15, 0x19, 0x79, 0x52, 0x79, 0x9E, 0x00, 0xCB, 0x23, 0xFE, 0x39, 0x56,
+    0x2C, 0x5B, 0x05, 0x7D, 0x5A, 0x87, 0x7D, 0xDC, 0x46, 0x5D, 0xD4, 0x47, 0x6D, 0x30, 0x30, 0xED,
+    0x89, 0x4E, 0x8B, 0x83, 0x1A, 0xEE, 0x45, 0x85, 0x8C, 0x3B, 0x94, 0x61, 0x4C, 0x25, 0x65, 0x42,
+    0xB6, 0xE5, 0x34, 0x1A, 0x37, 0x92, 0xE7, 0x3D, 0x33, 0x6C, 0xE1, 0xF8, 0x9A, 0x23, 0xED, 0x9A,
+    0x2B, 0xA5, 0xDF, 0x37, 0xBB, 0x40, 0x72, 0x59, 0x3E, 0x1D, 0xC2, 0x2E, 0x6A, 0xC3, 0x76, 0x17,
+    0x0E, 0xE9, 0x17, 0xAB, 0xA8, 0xC5, 0xE2, 0x07, 0xDE, 0xC6, 0x3F, 0xEB, 0xF6, 0x64, 0x21, 0xF6,
+    0xA7, 0x3E, 0xEA, 0xE2, 0xDE, 0x8F, 0xCA, 0x4C, 0xD0, 0x48, 0xC3, 0x1E, 0xF7, 0x4A, 0x2F, 0x9A,
+    0x97, 0x61, 0x23, 0x4B, 0xA1, 0xDB, 0xF8, 0x7F, 0x6F, 0x13, 0x35, 0x78, 0x9D, 0x11, 0x0B, 0xB0,
+    0x71, 0xB8, 0x87, 0x7B, 0x79, 0x53, 0x22, 0x64, 0xA4, 0x13, 0x32, 0xCE, 0xDD, 0x08, 0x3F, 0xAC,
+    0x2A, 0x6E, 0x34, 0x48, 0xCC, 0xE4, 0x9F, 0x4D, 0x11, 0x25, 0x7E, 0xE6, 0xD5, 0xF4, 0x9A, 0xC1,
+    0x13, 0xA9, 0xF9, 0x81, 0x12, 0xC6, 0x13, 0x55, 0x80, 0x7B, 0x4D, 0x1D, 0x42, 0xFB, 0x88, 0x46,
+    0xB2, 0x3E, 0x9E, 0x24, 0x28, 0xFB, 0x2C, 0x1D, 0xA5, 0x71, 0xD9, 0x20, 0x1F, 0x62, 0xAE, 0xB8,
+    0x4E, 0x3D, 0x55, 0xC8, 0xCC, 0x83, 0x0C, 0xD8, 0x8D, 0x29, 0x61, 0xD0, 0x22, 0xAA, 0x96, 0x40,
+    0x9B, 0xCD, 0xB0, 0x88, 0x6B, 0x64, 0x1F, 0x74, 0x88, 0xEB, 0x25, 0x82, 0x8E, 0xC4, 0x32, 0x21,
+    0xF1, 0xA1, 0x88, 0x53, 0x84, 0x5D, 0x3E, 0xC3, 0x29, 0x89, 0x9C, 0x44, 0x52, 0xAF, 0x39, 0x08,
+    0x9C, 0x8A, 0x75, 0xD2, 0xEC, 0x14, 0x5F, 0xAA, 0xAB, 0xD8, 0x54, 0x76, 0xA8, 0x89, 0x65, 0x2D,
+    0xE4, 0x41, 0xD1, 0x3B, 0xC5, 0xBE, 0xDA, 0x0A, 0x4F, 0x36, 0xFA, 0x95, 0x1E, 0x0F, 0x81, 0x3D,
+    0x96, 0xFA, 0x92, 0x8F, 0x7F, 0xB1, 0x8E, 0xCF, 0x80, 0xA3, 0x13, 0x04, 0x7C, 0x4C, 0xF8, 0xE8,
+    0x9E, 0xAC, 0xC2, 0xC9, 0xAD, 0xF2, 0x5E, 0x33, 0x65, 0xF6, 0xAA, 0xB2, 0xBE, 0xC0, 0x8E, 0x64,
+    0x92, 0x32, 0xB9, 0xCE, 0x08, 0xE0, 0xEA, 0x91, 0xBF, 0x35, 0x76, 0x34, 0xEA, 0x85, 0xC0, 0xDD,
+    0x85, 0xC5, 0xE9, 0x2D, 0xD8, 0x7F, 0x07, 0xEC, 0x0A, 0xF6, 0xAE, 0x61, 0xA9, 0x7C, 0xC6, 0x1B,
+    0xD8, 0xA4, 0xD0, 0xE3, 0x61, 0xD8, 0x26, 0x4D, 0xDC, 0x26, 0x55, 0xBE, 0x4A, 0xAB, 0x1C, 0x32,
+    0x7E, 0x12, 0x76, 0x18, 0x48, 0xD7, 0x91, 0xE8, 0x59, 0x5A, 0x65, 0x9E, 0x5E, 0x90, 0xEE, 0x03,
+    0xD1, 0x4D, 0xCC, 0x37, 0xD3, 0x55, 0xC6, 0x0E, 0xA7, 0x33, 0xEA, 0x20, 0xBA, 0x7A, 0x93, 0xDE,
+    0x15, 0x8D, 0x2E, 0xF9, 0xF3, 0xBB, 0xCB, 0xA7, 0xBF, 0xE7, 0xEA, 0x36, 0x9D, 0x6A, 0x66, 0xAF,
+    0x05, 0xE6, 0x35, 0x3C, 0x15, 0x44, 0x3E, 0xEF, 0xB4, 0xF2, 0x0D, 0xE6, 0x83, 0x7A, 0xC8, 0x26,
+    0x57, 0x07, 0x48, 0x79, 0x0F, 0xB4, 0xF9, 0x56, 0x60, 0xFF, 0xEB, 0x40, 0xAD, 0xF9, 0x18, 0xB7,
+    0x32, 0x35, 0x08, 0x16, 0x82, 0xBD, 0x6B, 0x58, 0x12, 0xA8, 0x33, 0xDF, 0xF3, 0xD0, 0x6D, 0x77,
+    0xD8, 0x25, 0x6E, 0xFF, 0x8A, 0x33, 0x3F, 0x57, 0xE6, 0x0D, 0x47, 0xC3, 0xBE, 0x8F, 0xAD, 0xE9,
+    0xFD, 0x29, 0xF1, 0xD8, 0x2F, 0x4D, 0x9B, 0xA5, 0xFE, 0xCD, 0x25, 0xD3, 0x11, 0x6E, 0xDE, 0xA4,
+    0x76, 0x71, 0x34, 0xD2, 0xD6, 0x47, 0xE1, 0xCE, 0x5A, 0x64, 0x5A, 0x52, 0x18, 0xFC, 0x76, 0x01,
+    0x9D, 0x5F, 0x62, 0x67, 0x6A, 0x89, 0xC5, 0xB7, 0x03, 0x85, 0x14, 0xEB, 0x0B, 0xC6, 0xE6, 0xEC,
+    0x7C, 0x69, 0x8A, 0xDF, 0x6C, 0xE2, 0x27, 0x6A, 0x23, 0x13, 0x5D, 0x44, 0xCD, 0x26, 0xD7, 0xFD,
+    0xFF, 0x3E, 0x9A, 0x1D, 0x73, 0x8A, 0x3B, 0xA5, 0xEE, 0x28, 0x26, 0x2D, 0xD1, 0x6C, 0x7A, 0x40,
+    0x77, 0x8E, 0x3D, 0x3F, 0x20, 0xD7, 0x89, 0xAE, 0x84, 0x9D, 0x1F, 0xFA, 0xAF, 0xB6, 0x89, 0xDE,
+    0xB3, 0x63, 0x1D, 0x92, 0x23, 0xCF, 0x98, 0xA0, 0xF4, 0xB2, 0x35, 0x0C, 0x31, 0xEA, 0x38, 0x02,
+    0xC1, 0x70, 0x7F, 0xDB, 0xEE, 0x9B, 0x0A, 0x1D, 0x41, 0xC7, 0xC4, 0x2D, 0xB8, 0xAA, 0x54, 0xE9,
+    0xF5, 0xF8, 0xEC, 0x98, 0x23, 0x5B, 0x4C, 0xDF, 0x96, 0xFE, 0x1B, 0x3C, 0xA8, 0xD4, 0xBD, 0x3E,
+    0x6F, 0x6D, 0xE4, 0xEB, 0x7C, 0x68, 0x7F, 0xE0, 0xCE, 0xEF, 0x5F, 0xAD, 0x55, 0x3D, 0x6F, 0xDD,
+    0x36, 0x14, 0x3D, 0x12, 0xD3, 0x08, 0x88, 0x06, 0x76, 0x2C, 0xEA, 0x41, 0x7B, 0x80, 0x84, 0x7F,
+    0x20, 0x36, 0x85, 0x76, 0xE8, 0x58, 0x4F, 0xEE, 0x98, 0xBD, 0x8B, 0x3B, 0x76, 0xF0, 0xB3, 0x94,
+    0x64, 0xF0, 0x68, 0x2F, 0x99, 0xBB, 0x14, 0x45, 0xBF, 0x50, 0x2F, 0x1D, 0x32, 0xE8, 0x59, 0x0A,
+    0x3C, 0x78, 0xE8, 0x60, 0x01, 0xFE, 0x01, 0x15, 0xE2, 0x21, 0x28, 0x32, 0x98, 0x41, 0xD4, 0x46,
+    0xB1, 0x29, 0xDD, 0x1E, 0xEA, 0xD5, 0x28, 0xD2, 0x8F, 0x2D, 0x7A, 0xE2, 0xE3, 0x15, 0x25, 0x5E,
+    0x9E, 0x7B, 0x78, 0xEE, 0x25, 0xC0, 0x2B, 0x1A, 0x90, 0x4A, 0x99, 0x74, 0x91, 0x48, 0x97, 0x95,
+    0x59, 0x9B, 0x75, 0xBB, 0xF0, 0xD0, 0x4F, 0x87, 0xB4, 0x41, 0xB6, 0xD7, 0x59, 0xC0, 0x66, 0x0F,
+    0x7A, 0x60, 0xB9, 0xCB, 0x81, 0xE8, 0xF7, 0x81, 0x03, 0xEA, 0x79, 0xE7, 0x01, 0xFD, 0xD5, 0x23,
+    0x07, 0x6C, 0x14, 0xD2, 0x00, 0x6F, 0x44, 0x80, 0xE4, 0x79, 0x37, 0x02, 0xE6, 0xFE, 0xC7, 0x7C,
+    0x39, 0x2E, 0x52, 0x3A, 0x79, 0xD9, 0x67, 0xD3, 0x96, 0xEC, 0xB5, 0x56, 0xC4, 0x67, 0x39, 0xFF,
+    0xDB, 0x1D, 0x58, 0x19, 0x23, 0x87, 0x35, 0x29, 0xB9, 0xF4, 0xE7, 0xDF, 0x83, 0xCB, 0xF6, 0xA8,
+    0x45, 0x72, 0xDD, 0xE1, 0x89, 0xEA, 0x91, 0x96, 0x5C, 0xE0, 0x89, 0x72, 0x2B, 0xA3, 0x52, 0x44,
+    0xD7, 0x98, 0x1E, 0x15, 0x44, 0xA4, 0x51, 0xF4, 0x83, 0x8C, 0x46, 0x42, 0x23, 0x92, 0xC7, 0x75,
+    0x63, 0x1B, 0x35, 0x26, 0x3D, 0x6C, 0x5B, 0x43, 0x8D, 0xDA, 0xD1, 0x10, 0xA8, 0x29, 0xE3, 0xC8,
+    0x33, 0xC9, 0xD5, 0x64, 0x69, 0x9C, 0x07, 0xA3, 0xE8, 0x51, 0xB8, 0x10, 0x2E, 0xE2, 0x29, 0x43,
+    0x22, 0x57, 0x4D, 0x72, 0x59, 0x3B, 0xE5, 0x62, 0x1F, 0x73, 0x12, 0xB8, 0x4A, 0x7B, 0x0F, 0x71,
+    0x9F, 0x01, 0xBB, 0x49, 0x03, 0xF3, 0xD0, 0x41, 0xBB, 0x05, 0x52, 0xAF, 0xDF, 0x6C, 0x8B, 0x0A,
+    0x4B, 0x17, 0x22, 0x2E, 0x91, 0x71, 0x01, 0x33, 0x64, 0xF9, 0xEC, 0x08, 0x5B, 0x3F, 0xD2, 0xD1,
+    0x84, 0x74, 0xFA, 0x09, 0x29, 0x7D, 0x27, 0x1D, 0x99, 0x71, 0x33, 0xA1, 0x64, 0xEB, 0xE6, 0x77,
+    0x30, 0x46, 0xFA, 0x94, 0x73, 0x3F, 0x92, 0xB6, 0x70, 0x75, 0x13, 0x4F, 0xA6, 0x85, 0x3D, 0xA1,
+    0xE7, 0x97, 0x1E, 0xB1, 0x67, 0x74, 0x35, 0x63, 0xB6, 0x0F, 0x27, 0x14, 0x81, 0x20, 0x7A, 0x17,
+    0x42, 0x91, 0x8E, 0x94, 0x1C, 0xA0, 0xBE, 0xCC, 0x35, 0x39, 0x1D, 0x50, 0xE9, 0x32, 0x6E, 0x07,
+    0xDC, 0x65, 0xD7, 0x85, 0x27, 0x2E, 0x28, 0x32, 0xE8, 0x32, 0x71, 0x03, 0xF4, 0x7E, 0x89, 0x8A,
+    0xD0, 0x4F, 0x4B, 0xF8, 0x71, 0xAB, 0x3E, 0xE5, 0x0B, 0x2E, 0xC7, 0x79, 0x01, 0x60, 0xA0, 0x88,
+    0xA0, 0x4F, 0x88, 0x6A, 0x17, 0x33, 0xC0, 0xFA, 0xFF, 0x3A, 0xEE, 0x6E, 0x9D, 0xAF, 0xBA, 0x12,
+    0x7F, 0x5D, 0x0C, 0x99, 0x4C, 0x7B, 0x44, 0x4E, 0x93, 0x0F, 0x2A, 0x22, 0x76, 0x9A, 0xF0, 0x31,
+    0x42, 0x75, 0x34, 0x36, 0xAE, 0x8D, 0x25, 0x7F, 0x59, 0x93, 0xB6, 0xDC, 0xBA, 0x25, 0x9D, 0xA5,
+    0x2D, 0xF7, 0x52, 0x5E, 0xB3, 0x4D, 0x8C, 0x49, 0xCE, 0xB8, 0xC2, 0x8E, 0xA1, 0xEF, 0xE6, 0x6B,
+    0xE0, 0x5B, 0xAC, 0x0D, 0xC1, 0x71, 0xAE, 0x06, 0xD5, 0xD2, 0xAB, 0x23, 0xDB, 0x3B, 0x1B, 0xD8,
+    0xAA, 0xF8, 0xE5, 0x48, 0xA8, 0xBF, 0x2D, 0x89, 0x7B, 0x81, 0x19, 0x2F, 0x2C, 0x91, 0x70, 0xF7,
+    0x3E, 0x60, 0x34, 0x7E, 0xB5, 0xDB, 0x04, 0xB3, 0x36, 0x95, 0x91, 0x27, 0x16, 0xAE, 0x3D, 0x28,
+    0x47, 0xF6, 0x54, 0xAF, 0x9B, 0x22, 0x04, 0x62, 0xB9, 0x3E, 0x74, 0xE7, 0x0D, 0xC5, 0x98, 0x9D,
+    0x90, 0x60, 0x0A, 0xF1, 0xD7, 0xD3, 0x2E, 0x38, 0x0A, 0xD2, 0x04, 0x0A, 0xCA, 0x6C, 0x0E, 0x6B,
+    0x8E, 0x50, 0xC2, 0x07, 0xD4, 0x7D, 0xD8, 0x2A, 0xAA, 0x6F, 0x98, 0x1F, 0xE6, 0xAE, 0x9E, 0x3B,
+    0x3D, 0xC9, 0x45, 0xC0, 0xFA, 0x5A, 0x2C, 0x69, 0x96, 0xCC, 0xB3, 0x93, 0xBE, 0xE8, 0x8B, 0x41,
+    0x87, 0xED, 0xAC, 0x07, 0x6C, 0xA2, 0x18, 0xA3, 0xFC, 0x0E, 0x70, 0x0F, 0xF8, 0x02, 0x71, 0x83,
+    0x3B, 0x90, 0x36, 0x3E, 0x2C, 0x19, 0x2A, 0x34, 0xB0, 0x4E, 0xBE, 0x44, 0x8E, 0xC5, 0xA7, 0x92,
+    0xBF, 0x4F, 0xB7, 0x15, 0x11, 0x57, 0x48, 0xD9, 0xB4, 0xAF, 0x60, 0x77, 0x2A, 0x2C, 0xD8, 0x86,
+    0x9D, 0x2A, 0x76, 0x55, 0x95, 0xB4, 0x55, 0xA5, 0x9B, 0xAA, 0x32, 0xA8, 0x2A, 0x26, 0x5F, 0xC5,
+    0x10, 0x8F, 0x7A, 0xF8, 0xBA, 0x63, 0x6B, 0xD8, 0x72, 0xF8, 0x38, 0xBF, 0x01, 0x75, 0x49, 0xD4,
+    0x1C, 0x84, 0x5E, 0x09, 0xF0, 0x5D, 0xF8, 0xD5, 0xCC, 0xB2, 0x75, 0xD5, 0x47, 0xBD, 0x29, 0x93,
+    0xD6, 0xC3, 0x7C, 0xDA, 0xA2, 0x3A, 0x42, 0xFC, 0x9A, 0x2A, 0xA5, 0x8A, 0x6C, 0xE0, 0x80, 0x2C,
+    0xB3, 0xE9, 0x8B, 0x0E, 0x85, 0x75, 0x91, 0xB7, 0x2E, 0xE9, 0xAC, 0x33, 0x65, 0xE1, 0x8E, 0x50,
+    0xF7, 0xB1, 0x48, 0xB8, 0x5D, 0x16, 0xEE, 0x6E, 0x75, 0x1B, 0xD5, 0x5E, 0xDF, 0x4D, 0xB8, 0x93,
+    0xC6, 0x98, 0xC6, 0xD8, 0xDC, 0x10, 0xEF, 0x87, 0x39, 0x6E, 0x1D, 0xD0, 0x73, 0xF1, 0x68, 0x62,
+    0x26, 0x6A, 0xD6, 0x88, 0x81, 0x8B, 0xD4, 0x4E, 0x9C, 0x92, 0xE3, 0x8B, 0x36, 0x13, 0x5D, 0x94,
+    0x4B, 0xBF, 0x28, 0xD4, 0xAB, 0x97, 0xFD, 0x64, 0xF6, 0x4F, 0x9E, 0xF9, 0xD1, 0xDE, 0xDF, 0xBB,
+    0x72, 0xE3, 0x91, 0x96, 0xBD, 0x3F, 0x7C, 0x36, 0x66, 0x2F, 0x9C, 0x75, 0xC5, 0x61, 0x53, 0x3F,
+    0x98, 0xEA, 0xC8, 0xA7, 0x57, 0x3E, 0xDA, 0x34, 0x12, 0x74, 0xDC, 0xDC, 0x06, 0x6E, 0x85, 0x8A,
+    0xE4, 0x6D, 0x0E, 0x7D, 0xDC, 0xFF, 0xD3, 0x38, 0xA3, 0x31, 0x52, 0x55, 0xFA, 0x6C, 0x40, 0x34,
+    0xCE, 0xE2, 0xBC, 0x56, 0xE9, 0xF9, 0x6C, 0x50, 0xE6, 0xE7, 0xD4, 0xFB, 0xB5, 0x11, 0x4B, 0x41,
+    0xC3, 0x61, 0xBB, 0x27, 0x15, 0x23, 0xA6, 0xC8, 0x27, 0x2D, 0x3D, 0xB1, 0x04, 0xF6, 0x2C, 0x80,
+    0xDC, 0xE4, 0x0B, 0x6A, 0xAB, 0xA2, 0xCF, 0xF0, 0xC8, 0xC4, 0xDD, 0x9F, 0x7E, 0x18, 0x59, 0x9A,
+    0xBA, 0xA0, 0x37, 0x4B, 0xB1, 0xAD, 0x8D, 0x73, 0xB5, 0xA1, 0xEB, 0x17, 0x6C, 0x87, 0x39, 0x36,
+    0x96, 0xC0, 0x25, 0x3F, 0x7E, 0xD1, 0x72, 0x2E, 0x19, 0x58, 0x72, 0xAD, 0x1E, 0xC9, 0x55, 0x87,
+    0xEC, 0xA2, 0x44, 0x71, 0xC4, 0xC7, 0xE1, 0xAD, 0x47, 0xEE, 0xF6, 0xED, 0x03, 0x58, 0x23, 0xA5,
+    0xBA, 0xBA, 0xAC, 0x59, 0x78, 0x30, 0xC4, 0x02, 0xB2, 0xD9, 0x62, 0x3D, 0xF6, 0x4C, 0xBF, 0xAC,
+    0xC1, 0x46, 0x34, 0x1B, 0x4C, 0xC8, 0xF0, 0xAA, 0x35, 0x84, 0x39, 0x97, 0x2B, 0xA2, 0xE8, 0x93,
+    0x57, 0x2C, 0x16, 0x35, 0xF7, 0x31, 0xED, 0xDE, 0x03, 0x26, 0xA2, 0x61, 0xBE, 0xCE, 0x6E, 0x11,
+    0xD2, 0x24, 0x0E, 0x06, 0x83, 0xFD, 0xFB, 0x4A, 0x42, 0x85, 0xF5, 0x90, 0x6F, 0x4A, 0xBE, 0x0F,
+    0x09, 0x55, 0xAC, 0xAA, 0x1A, 0x81, 0xA7, 0xED, 0x9C, 0x96, 0x2C, 0xB5, 0x2C, 0xB1, 0x8C, 0xEA,
+    0x71, 0xA9, 0xE7, 0x38, 0x07, 0x98, 0x29, 0x5F, 0xA5, 0xCD, 0x14, 0xDA, 0x66, 0xD2, 0xDC, 0x20,
+    0x0E, 0xBC, 0xD5, 0xC2, 0xE4, 0xB4, 0xFB, 0x77, 0xD3, 0xA1, 0xB9, 0xB9, 0xD1, 0xB7, 0x65, 0x45,
+    0xDC, 0xCD, 0x4A, 0x2C, 0x89, 0xD2, 0x27, 0x0E, 0x5E, 0xF5, 0xF1, 0xC0, 0x70, 0x7A, 0x4C, 0x2C,
+    0xAB, 0xC5, 0x27, 0xE4, 0xF8, 0x34, 0x90, 0x43, 0x2D, 0x4A, 0x1B, 0xB0, 0x52, 0x97, 0x3C, 0x91,
+    0x42, 0x42, 0x87, 0x82, 0xC7, 0x2C, 0x8F, 0xC2, 0x21, 0x44, 0xDA, 0xB7, 0x29, 0x64, 0x6A, 0xC2,
+    0xF0, 0xB5, 0x61, 0xD8, 0xE6, 0x20, 0x04, 0x77, 0x37, 0xFC, 0x85, 0xFA, 0x1C, 0xB0, 0x76, 0xE1,
+    0x4F, 0x1A, 0x9E, 0x49, 0x28, 0x54, 0xC3, 0xD1, 0xFE, 0x4B, 0xD6, 0xB6, 0xF4, 0x24, 0xA7, 0xB9,
+    0xF3, 0x73, 0x30, 0x7F, 0x09, 0xA3, 0x7E, 0x97, 0xA6, 0x39, 0x9E, 0x3E, 0x7B, 0xB3, 0x3D, 0x18,
+    0x4E, 0x90, 0x70, 0x0A, 0x49, 0xC7, 0x7A, 0xC4, 0xC0, 0x6F, 0xB2, 0x62, 0x05, 0x06, 0xE7, 0x62,
+    0x3B, 0x17, 0x97, 0xE2, 0x3F, 0xCD, 0x70, 0x51, 0xFA, 0xEB, 0x2A, 0x1C, 0x34, 0x1B, 0x34, 0xD3,
+    0x36, 0x0B, 0x99, 0x47, 0x09, 0xED, 0x37, 0xA4, 0x92, 0xE4, 0x58, 0xB7, 0xAA, 0xC2, 0x09, 0x03,
+    0x50, 0x44, 0xAE, 0x3C, 0xB3, 0xC3, 0xEB, 0x36, 0x1E, 0xE3, 0x31, 0x9A, 0x60, 0x9F, 0xF2, 0x50,
+    0xF3, 0x78, 0xE7, 0xD7, 0x9F, 0x95, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC, 0x11, 0x71,
+    0xE1, 0x62, 0xAE, 0x00, 0x29, 0x52, 0x84, 0xCC, 0x1F, 0x70, 0xC4, 0xFF, 0xC0, 0xEE, 0x8E, 0x13,
+    0x8A, 0x2B, 0x28, 0xB8, 0x02, 0x68, 0x28, 0x10, 0x1D, 0xBF, 0xA4, 0x34, 0x94, 0x7B, 0xD9, 0x95,
+    0x52, 0x50, 0x50, 0x24, 0xFC, 0x07, 0x14, 0x14, 0xD1, 0xA5, 0xC8, 0x15, 0x20, 0x1D, 0x92, 0x77,
+    0x67, 0x48, 0x93, 0x82, 0xC6, 0x22, 0x05, 0x45, 0x0A, 0x2C, 0xB1, 0x4D, 0x92, 0x02, 0x13, 0x59,
+    0xC2, 0x20, 0xEF, 0x0E, 0xDF, 0x9B, 0xF5, 0xE5, 0xB8, 0x1C, 0x57, 0x60, 0x8D, 0xBF, 0x79, 0x9E,
+    0xB1, 0xDF, 0xCC, 0xFB, 0xDE, 0x37, 0xCF, 0x00, 0x90, 0x17, 0xE8, 0xD3, 0x0A, 0x26, 0x6E, 0xA1,
+    0xDD, 0x02, 0x71, 0x93, 0x15, 0x28, 0x93, 0x0A, 0x79, 0xD4, 0x22, 0x75, 0x07, 0xA7, 0x03, 0x19,
+    0x07, 0x12, 0x37, 0x46, 0xD4, 0xE8, 0x02, 0x53, 0xE5, 0xBD, 0x6F, 0x79, 0xF7, 0x86, 0x40, 0x37,
+    0xDA, 0x01, 0xAA, 0x01, 0xA2, 0x8E, 0x0F, 0x9F, 0xE0, 0x0D, 0x7C, 0x54, 0xC5, 0x0F, 0x8B, 0xF4,
+    0x75, 0xBC, 0xF9, 0x05, 0xBE, 0xAF, 0xE2, 0x5F, 0x0A, 0xFD, 0x21, 0x0E, 0x26, 0x1F, 0xB4, 0xD6,
+    0x57, 0xB3, 0xDB, 0x05, 0xC6, 0x40, 0x07, 0x55, 0x43, 0xCF, 0x21, 0xD7, 0x12, 0xAF, 0xA1, 0x5C,
+    0x62, 0x26, 0x60, 0x06, 0x58, 0x10, 0xA6, 0x03, 0x4C, 0xFE, 0x13, 0x46, 0x02, 0xE3, 0x00, 0x96,
+    0xBB, 0x58, 0x9F, 0x42, 0x70, 0x9A, 0xD6, 0xD1, 0x7E, 0xEA, 0x82, 0xD7, 0xB4, 0x56, 0x8D, 0x98,
+    0x74, 0x9B, 0x56, 0xAA, 0x49, 0x5C, 0xF0, 0x4B, 0xB3, 0x16, 0x73, 0x72, 0xCE, 0x54, 0xC1, 0x1C,
+    0x05, 0xB3, 0x12, 0x8F, 0xFE, 0x99, 0x3F, 0x71, 0xEE, 0x2B, 0x71, 0xDE, 0x63, 0x08, 0x1A, 0x51,
+    0x30, 0x73, 0x31, 0xE3, 0xCE, 0x70, 0xE9, 0x44, 0xDE, 0xF8, 0x54, 0xF6, 0x90, 0xC8, 0xAB, 0x07,
+    0x62, 0xD4, 0x84, 0x99, 0x5F, 0x21, 0xF9, 0xFB, 0x5E, 0x43, 0xCF, 0xA9, 0x63, 0xEC, 0x63, 0x1A,
+    0xAA, 0x1A, 0x8C, 0xAC, 0x22, 0xA3, 0x3D, 0xC8, 0x26, 0x94, 0xDF, 0x14, 0x03, 0x2B, 0xC0, 0xE8,
+    0x05, 0x4C, 0x6F, 0x9E, 0x05, 0x71, 0x37, 0x9D, 0x1D, 0x5A, 0x4C, 0xC5, 0xDF, 0x54, 0x7C, 0x1D,
+    0x18, 0xC4, 0x35, 0x41, 0xD5, 0x0B, 0x43, 0x8F, 0x0B, 0x7A, 0x73, 0x02, 0x05, 0x61, 0x85, 0xC5,
+    0x0E, 0x37, 0xC2, 0x6D, 0x4E, 0xCF, 0x75, 0x7E, 0x83, 0xE5, 0xE1, 0x26, 0x75, 0xE8, 0x4A, 0xA8,
+    0x9F, 0x1C, 0x46, 0x25, 0x92, 0xC7, 0x2E, 0xEA, 0x19, 0xEE, 0x57, 0xDE, 0x37, 0x96, 0x1F, 0x5F,
+    0xF2, 0x77, 0x22, 0x6F, 0xDB, 0xB4, 0x48, 0xDA, 0x9D, 0x90, 0x68, 0x09, 0x49, 0xE2, 0x37, 0x85,
+    0x26, 0xDF, 0xC6, 0xB7, 0x7C, 0x64, 0xB8, 0xB3, 0x57, 0xA1, 0xBA, 0x1F, 0xAE, 0xD9, 0x07, 0x64,
+    0x2B, 0x21, 0x57, 0x91, 0x5D, 0x31, 0xBE, 0xBC, 0x43, 0xAB, 0xFC, 0x5A, 0x55, 0x13, 0x94, 0xFA,
+    0x7A, 0x8D, 0xE3, 0xB1, 0xA6, 0x8E, 0xDA, 0x29, 0xD4, 0xA3, 0x9F, 0x29, 0x82, 0x77, 0xDE, 0x9E,
+    0x63, 0x32, 0xA6, 0x26, 0x8E, 0x3D, 0x55, 0xF1, 0xDB, 0xB3, 0x86, 0x43, 0xD4, 0xE4, 0xC1, 0x28,
+    0x73, 0x49, 0xD3, 0x98, 0xA7, 0xF6, 0x96, 0xB3, 0xBE, 0xD7, 0xA0, 0x78, 0x46, 0xB8, 0x41, 0x85,
+    0x65, 0xBE, 0xD1, 0xFB, 0x26, 0x66, 0x2A, 0x47, 0x30, 0x6A, 0x1E, 0xBA, 0xB8, 0x55, 0x8D, 0x26,
+    0x7D, 0x86, 0x73, 0xAB, 0xF0, 0x34, 0x81, 0xD1, 0x4E, 0xFD, 0xD1, 0xC1, 0x98, 0x42, 0xFD, 0xD9,
+    0x30, 0xE5, 0x18, 0x04, 0x3A, 0xC3, 0x76, 0xB7, 0xAA, 0xC3, 0x85, 0xD7, 0x15, 0xCE, 0x91, 0x3A,
+    0xD5, 0xA9, 0x8A, 0x71, 0x36, 0x19, 0x84, 0xE8, 0xF7, 0x4B, 0xD2, 0xB9, 0x9E, 0x79, 0xFF, 0x64,
+    0x51, 0x6C, 0x53, 0x2B, 0xB9, 0x30, 0x54, 0xB1, 0x69, 0x71, 0x99, 0xCB, 0xF7, 0x0C, 0xBA, 0x8F,
+    0x24, 0x95, 0x57, 0x36, 0x41, 0xDB, 0x39, 0x59, 0x2E, 0x79, 0x9A, 0xBE, 0xC1, 0xC7, 0x27, 0x9E,
+    0x2F, 0xD9, 0x3B, 0x58, 0xEF, 0x35, 0x7A, 0x1E, 0x37, 0xC2, 0x40, 0x85, 0xE4, 0x36, 0x65, 0x45,
+    0xA7, 0x1B, 0x92, 0xC8, 0xB8, 0xE5, 0x4C, 0x86, 0x2D, 0xFA, 0x79, 0xF4, 0x35, 0x67, 0xAE, 0x73,
+    0x86, 0x2E, 0x5B, 0x7C, 0xF6, 0x04, 0xDB, 0x20, 0x02, 0x4C, 0x82, 0xC5, 0xC3, 0x67, 0x99, 0x3F,
+    0xD8, 0x8D, 0x3C, 0x8E, 0x31, 0x28, 0x6E, 0x00, 0x12, 0x8F, 0x25, 0xA3, 0xE0, 0x3B, 0xDE, 0xC1,
+    0xD6, 0x59, 0x05, 0x5B, 0x30, 0x75, 0x5E, 0x72, 0xB8, 0xE1, 0xE1, 0xC6, 0xFA, 0x65, 0x50, 0x5B,
+    0x88, 0x08, 0xAD, 0x40, 0x1F, 0x6D, 0x90, 0xAC, 0xE3, 0x0D, 0xB4, 0xAC, 0x60, 0x45, 0xED, 0x92,
+    0x6C, 0x78, 0x51, 0xFC, 0x5F, 0x8C, 0x86, 0x9B, 0xE5, 0x33, 0xF9, 0xA1, 0x94, 0x65, 0xD9, 0x70,
+    0x2A, 0x4E, 0x2E, 0xA1, 0x83, 0x91, 0x3D, 0xAC, 0x03, 0x53, 0x29, 0x85, 0x63, 0x2F, 0xEA, 0xE8,
+    0xC4, 0x16, 0xDB, 0x4E, 0x98, 0x7B, 0xA5, 0x40, 0xEC, 0x6B, 0x4C, 0xA2, 0x56, 0x55, 0x11, 0xE9,
+    0x8F, 0x6B, 0xCE, 0x28, 0xFA, 0xD6, 0xE1, 0x9C, 0x34, 0xE0, 0x67, 0xAA, 0x92, 0x3C, 0x46, 0x77,
+    0x73, 0xAA, 0x94, 0xAB, 0xCC, 0xA9, 0x12, 0xE4, 0xC3, 0xE9, 0xB9, 0xB1, 0x09, 0xCA, 0x5C, 0x5E,
+    0xDB, 0x0F, 0x1F, 0x09, 0x57, 0x9C, 0xA0, 0x1C, 0x03, 0x55, 0xB9, 0x9F, 0x23, 0x92, 0x75, 0x2C,
+    0x56, 0x49, 0xCF, 0xC4, 0x35, 0x24, 0xFA, 0x96, 0xE4, 0xCE, 0x6E, 0x8A, 0xFC, 0xAD, 0xCE, 0x7C,
+    0xD9, 0xDB, 0x21, 0x8E, 0xFD, 0x3C, 0x6E, 0xF2, 0xB8, 0xBE, 0x2A, 0xD8, 0x18, 0x75, 0xD2, 0xF6,
+    0x5A, 0xED, 0xF4, 0x8F, 0x7D, 0xD4, 0xE7, 0x55, 0xFE, 0x68, 0xAD, 0xD6, 0xA6, 0x36, 0xF5, 0x4B,
+    0x12, 0x2A, 0x19, 0x95, 0xDB, 0x76, 0x5C, 0xE9, 0xF8, 0xF4, 0xC9, 0x85, 0x02, 0xA2, 0xCF, 0x75,
+    0x2C, 0x1A, 0xCC, 0x10, 0xEB, 0x88, 0x28, 0x53, 0xF5, 0x48, 0x42, 0x3B, 0xBD, 0xF6, 0xC1, 0x22,
+    0x2C, 0xAD, 0x91, 0x16, 0x5F, 0xD0, 0x98, 0x87, 0x7F, 0x37, 0x56, 0x21, 0x6A, 0x7D, 0xE6, 0x32,
+    0xEF, 0xA8, 0x96, 0xD9, 0xB7, 0xE2, 0x48, 0x49, 0xD1, 0x56, 0x4F, 0xEF, 0x13, 0x0A, 0x7D, 0x06,
+    0xA0, 0xDF, 0x45, 0x42, 0x8E, 0x2B, 0x02, 0xBE, 0x13, 0x18, 0xA5, 0x84, 0xDD, 0x17, 0x30, 0xD2,
+    0xD0, 0x87, 0xFD, 0x84, 0xAF, 0xF0, 0xFC, 0x6A, 0xBF, 0x2D, 0xE0, 0x47, 0xB8, 0x8C, 0xD8, 0xB1,
+    0x4B, 0xA5, 0xDB, 0x65, 0x47, 0x7B, 0x77, 0x18, 0x22, 0xB3, 0xF5, 0xD5, 0xC3, 0xFB, 0xEF, 0xB5,
+    0x47, 0x18, 0xE1, 0x39, 0xCF, 0x52, 0xF4, 0x98, 0x89, 0x4C, 0x3E, 0xA7, 0xB3, 0xF1, 0x11, 0x26,
+    0xF7, 0x38, 0xC4, 0x42, 0xC3, 0x3D, 0xAD, 0x06, 0x65, 0x4B, 0xC8, 0x22, 0x26, 0xBA, 0x77, 0x41,
+    0xDD, 0xB1, 0x97, 0x83, 0x2A, 0xD9, 0x46, 0x56, 0x0C, 0xE2, 0x8E, 0x5A, 0x5B, 0x23, 0xFD, 0x9D,
+    0x5A, 0x94, 0xEC, 0x07, 0x6D, 0xC7, 0x6B, 0x64, 0x73, 0x2D, 0x07, 0x9D, 0x27, 0xB2, 0x0C, 0x82,
+    0x56, 0xF2, 0x17, 0x63, 0xF8, 0xB9, 0x64, 0xBF, 0x0F, 0xCA, 0x4E, 0xF8, 0xA7, 0xAB, 0x48, 0xB3,
+    0x29, 0x66, 0xF3, 0x48, 0x84, 0xCD, 0x81, 0xA8, 0xDE, 0x4A, 0x64, 0xBA, 0x5D, 0x98, 0x62, 0xC6,
+    0xDD, 0x33, 0xA9, 0x9C, 0xF0, 0xE3, 0x56, 0x57, 0x49, 0xB5, 0x44, 0xB6, 0xD7, 0x60, 0x61, 0x8A,
+    0xF8, 0x79, 0x87, 0xF4, 0x57, 0x07, 0x29, 0xF9, 0xD4, 0xA9, 0x22, 0x13, 0xC2, 0x86, 0xB1, 0x2C,
+    0x9C, 0x9E, 0x75, 0xCB, 0xBB, 0x6C, 0xEE, 0xDD, 0x32, 0xF2, 0x0F, 0xBA, 0x78, 0xFB, 0xCF, 0x88,
+    0xDB, 0xA1, 0xA8, 0x67, 0x4C, 0x75, 0xD2, 0x9E, 0xF1, 0xBF, 0x13, 0xE4, 0xA2, 0x58, 0x80, 0x53,
+    0xDE, 0xBA, 0x2F, 0x61, 0xA6, 0x25, 0x0E, 0x78, 0x77, 0xD3, 0x32, 0x6E, 0x4A, 0xFE, 0x81, 0xCB,
+    0x52, 0xBB, 0xB2, 0xCC, 0x51, 0x96, 0x37, 0xD1, 0x97, 0x3D, 0xFA, 0x65, 0x8B, 0x9E, 0x1C, 0x88,
+    0x50, 0x7B, 0x5B, 0xA0, 0xC7, 0xFF, 0xBD, 0xFE, 0x01, 0x7D, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14,
+    0x7E, 0xF6, 0x88, 0xB3, 0x84, 0x25, 0x86, 0xFE, 0x84, 0xE6, 0x2F, 0x20, 0x6E, 0x29, 0x8E, 0x1D,
+    0x43, 0x93, 0x82, 0x02, 0x8A, 0xDB, 0x2A, 0x05, 0x0D, 0xFD, 0x51, 0x50, 0x5C, 0x11, 0xD6, 0x86,
+    0x86, 0x92, 0x93, 0xF8, 0x07, 0x28, 0x28, 0x10, 0x14, 0x69, 0x4E, 0xE2, 0x8A, 0x3B, 0x76, 0x92,
+    0x08, 0xA5, 0xC4, 0x04, 0xA1, 0x2B, 0x31, 0x28, 0x51, 0x0A, 0x8A, 0x9B, 0x44, 0x3E, 0xC5, 0x17,
+    0xC6, 0x7E, 0x7C, 0x6F, 0x66, 0x0F, 0x25, 0x22, 0x87, 0x77, 0xDF, 0x8C, 0x67, 0x3C, 0x7E, 0x3F,
+    0xBF, 0xF7, 0x59, 0x39, 0x3A, 0x54, 0x8E, 0x7C, 0x3E, 0xE4, 0x9E, 0x98, 0x1D, 0x59, 0xAE, 0x69,
+    0xEB, 0x1B, 0xBA, 0xEA, 0x5A, 0x11, 0x59, 0x8B, 0xC9, 0xB4, 0x74, 0xA2, 0x3B, 0x0A, 0x85, 0xA7,
+    0xA0, 0x86, 0x7C, 0xCC, 0x30, 0xD2, 0xAC, 0x3C, 0x35, 0xD7, 0x3D, 0xD9, 0x9F, 0x7B, 0x32, 0x67,
+    0x3D, 0x69, 0xEE, 0xA8, 0x80, 0x4E, 0x05, 0xC9, 0xB8, 0x25, 0x82, 0x6E, 0x62, 0xC2, 0x3D, 0x51,
+    0x31, 0x11, 0xED, 0x05, 0xAA, 0xD8, 0x43, 0x1C, 0x55, 0x33, 0x51, 0x75, 0x40, 0x74, 0x93, 0xF4,
+    0x87, 0xA4, 0x4E, 0x1D, 0x9D, 0x7B, 0x7A, 0xFB, 0xFF, 0x17, 0xCC, 0xA7, 0xCC, 0x03, 0x7D, 0x42,
+    0xF4, 0x06, 0xD4, 0xD5, 0x94, 0x75, 0xD1, 0xC3, 0x0F, 0x20, 0x9F, 0x12, 0x6C, 0x73, 0x50, 0xCC,
+    0x8C, 0xA0, 0xA0, 0xFE, 0x26, 0x36, 0x0D, 0xA4, 0x70, 0xB0, 0x3E, 0xE0, 0xA6, 0x81, 0x27, 0x86,
+    0x67, 0xB8, 0xF7, 0xFD, 0x90, 0x4D, 0x78, 0xD6, 0x50, 0xDE, 0x19, 0x47, 0xFB, 0x08, 0xC8, 0x60,
+    0x43, 0xB7, 0xF6, 0xD9, 0xBA, 0x87, 0x92, 0x31, 0x67, 0x9E, 0x90, 0x15, 0xA6, 0x1C, 0xC7, 0xE3,
+    0xF5, 0x75, 0xB2, 0x40, 0x06, 0x3A, 0x0A, 0x18, 0xCD, 0x3C, 0x7C, 0x67, 0xEE, 0x4A, 0x9C, 0xA6,
+    0x1B, 0xBF, 0xED, 0x52, 0x36, 0x5E, 0x61, 0xA1, 0x87, 0x85, 0xB7, 0x36, 0x16, 0x8C, 0xB3, 0x33,
+    0x47, 0x0B, 0xEA, 0xD2, 0x42, 0xB6, 0xDC, 0x15, 0xBF, 0x99, 0xBD, 0x95, 0xD1, 0xC9, 0xC0, 0x39,
+    0x92, 0x56, 0xC1, 0x0B, 0xC9, 0x20, 0x46, 0x3D, 0x52, 0x3E, 0x13, 0x92, 0x99, 0x4F, 0x1A, 0x81,
+    0xE4, 0x61, 0x0D, 0x3B, 0x39, 0x4B, 0x4C, 0x6B, 0xBE, 0x40, 0xDC, 0x8F, 0x2E, 0xE0, 0x66, 0xD0,
+    0xDD, 0x09, 0x95, 0x9D, 0xAD, 0x03, 0x59, 0x9A, 0xB2, 0x31, 0x1B, 0xF2, 0x41, 0xF9, 0xD2, 0x95,
+    0x5D, 0xE9, 0x2C, 0x55, 0xB5, 0x79, 0x67, 0xA4, 0x13, 0xB2, 0x65, 0x9F, 0x0F, 0x14, 0x6C, 0xAD,
+    0x7B, 0x35, 0x22, 0x82, 0x19, 0x11, 0x70, 0x3B, 0x51, 0xE5, 0xB4, 0x83, 0xA7, 0x41, 0x3B, 0x32,
+    0x5F, 0x4A, 0xE9, 0x1C, 0x2C, 0x5C, 0x90, 0xFA, 0xF5, 0x7E, 0x97, 0xF5, 0xC3, 0x0E, 0xF9, 0x37,
+    0x8B, 0x76, 0xA7, 0xAC, 0xFD, 0xB5, 0xBC, 0xDB, 0xD1, 0xF5, 0x61, 0x79, 0xDD, 0x2D, 0x72, 0x9F,
+    0xCF, 0x35, 0xA0, 0x80, 0x0C, 0x58, 0x35, 0xDA, 0x56, 0xBB, 0xA0, 0xC6, 0xA2, 0x6F, 0xC8, 0xFE,
+    0x35, 0x98, 0xCF, 0xD6, 0x3C, 0x6E, 0x7D, 0x25, 0xD9, 0x29, 0x60, 0xA0, 0x56, 0x73, 0xBD, 0x37,
+    0xA8, 0x49, 0xA0, 0x80, 0xC1, 0x74, 0x6B, 0x22, 0x79, 0x05, 0x01, 0xE8, 0x1E, 0x99, 0xBC, 0x8B,
+    0x58, 0x0A, 0x8F, 0x27, 0xD9, 0x24, 0x9B, 0xCD, 0xFB, 0x71, 0x33, 0x20, 0x34, 0x8F, 0x54, 0x14,
+    0xC1, 0x5C, 0xD0, 0xF6, 0x24, 0xA5, 0x65, 0x6A, 0x44, 0x5D, 0x74, 0x1A, 0xC1, 0x63, 0x80, 0x7A,
+    0x64, 0x43, 0xE0, 0x9B, 0x1D, 0xD0, 0x47, 0x55, 0xA0, 0xA3, 0x85, 0xA9, 0x0F, 0x8F, 0xCB, 0x5F,
+    0x86, 0xE3, 0x82, 0xFD, 0x11, 0x52, 0x8A, 0x13, 0xBD, 0xEE, 0x8A, 0xA1, 0x42, 0x8E, 0x16, 0x44,
+    0x27, 0xA8, 0xE3, 0x0A, 0xB2, 0x38, 0xC1, 0x0C, 0x6C, 0xAF, 0x80, 0xED, 0xC9, 0x3E, 0xBC, 0x11,
+    0x0C, 0xA0, 0x05, 0xC5, 0x3E, 0x13, 0xB5, 0xD5, 0xF8, 0xF2, 0x66, 0xD8, 0x4B, 0x88, 0xB3, 0x53,
+    0x9C, 0x34, 0xD2, 0x84, 0x4B, 0x52, 0x40, 0xB1, 0x1A, 0x9B, 0xDD, 0xBE, 0x89, 0x15, 0xAA, 0x55,
+    0x90, 0xB3, 0x80, 0x3A, 0x8E, 0x15, 0x23, 0x65, 0x82, 0x26, 0x96, 0xA8, 0x92, 0xE0, 0x16, 0x85,
+    0x95, 0x27, 0x72, 0x48, 0xA4, 0xC0, 0x0B, 0x31, 0x4D, 0xC8, 0x42, 0xD5, 0xC7, 0x43, 0x24, 0x30,
+    0x14, 0xAD, 0x03, 0xD9, 0x5E, 0x8C, 0x38, 0x39, 0x24, 0x27, 0xA3, 0x71, 0xDB, 0x1B, 0x31, 0x9E,
+    0x73, 0x3C, 0x44, 0x66, 0xB0, 0xF2, 0x0E, 0xF1, 0x17, 0x11, 0xB9, 0x25, 0x27, 0x0F, 0x1B, 0x0E,
+    0xC9, 0x51, 0x51, 0x2C, 0xD0, 0x15, 0xF0, 0xA0, 0xCA, 0xFF, 0x3A, 0x1C, 0x67, 0x9E, 0x9E, 0x0F,
+    0xB5, 0x94, 0x37, 0x67, 0x8D, 0x14, 0x4B, 0xEA, 0xAC, 0xE0, 0x3F, 0xE0, 0x57, 0xF4, 0xA0, 0x8D,
+    0x0A, 0x13, 0xEE, 0xB5, 0x2B, 0x7B, 0x40, 0x4B, 0xD8, 0x21, 0x0B, 0x02, 0xC1, 0x9E, 0xD4, 0x80,
+    0x55, 0xF1, 0x24, 0x6C, 0xB4, 0x5A, 0xB1, 0xD0, 0x88, 0x71, 0x59, 0x29, 0x59, 0xE5, 0x3D, 0x2D,
+    0x48, 0x3D, 0x5C, 0xAE, 0xD6, 0x1C, 0xEF, 0x36, 0x43, 0xBC, 0xA0, 0x9A, 0xCA, 0x9F, 0x96, 0xCB,
+    0x06, 0x65, 0x9E, 0x50, 0xE4, 0xA7, 0x58, 0x03, 0x96, 0x68, 0x24, 0x12, 0x03, 0xC5, 0x4B, 0x96,
+    0x28, 0x08, 0xFA, 0x21, 0x87, 0xEB, 0x25, 0x82, 0xAA, 0x64, 0xD9, 0xC6, 0xB4, 0x96, 0x63, 0xCC,
+    0xA1, 0x2C, 0x71, 0x6D, 0x61, 0x3C, 0x4E, 0x41, 0x1D, 0x43, 0xF9, 0x3D, 0x70, 0x05, 0x8A, 0x5F,
+    0xC8, 0x73, 0xEC, 0xFA, 0xAB, 0xA6, 0x3A, 0x6A, 0x95, 0x09, 0xDA, 0x5E, 0x59, 0x2E, 0x77, 0x81,
+    0x92, 0x39, 0x8A, 0x4B, 0xAE, 0x3C, 0x2F, 0x9C, 0x9C, 0x8E, 0x72, 0xB9, 0x27, 0x0E, 0xBD, 0x20,
+    0xFD, 0x7F, 0xE5, 0xD5, 0xEF, 0xBE, 0xD5, 0x3C, 0x69, 0xA4, 0x2C, 0xFE, 0x51, 0x2C, 0xFC, 0x41,
+    0x35, 0x2F, 0xFC, 0xDB, 0xCB, 0x3F, 0xB4, 0x83, 0x08, 0x85, 0x09, 0xF9, 0x7C, 0x4C, 0xFC, 0x2C,
+    0xFB, 0x31, 0x96, 0x44, 0x43, 0x94, 0x4C, 0x4B, 0x7A, 0xB2, 0x69, 0x3D, 0x4A, 0xCF, 0x74, 0xE0,
+    0x93, 0x80, 0x50, 0xCC, 0x9D, 0x40, 0xCA, 0xFF, 0x08, 0x36, 0xAB, 0x5A, 0xD2, 0xEF, 0x75, 0xA4,
+    0xEE, 0x03, 0x97, 0x03, 0x36, 0x42, 0xD5, 0x96, 0x5C, 0x7A, 0xC5, 0xEF, 0x06, 0x9A, 0x51, 0x37,
+    0x74, 0xCF, 0x3E, 0x15, 0x2D, 0xA5, 0xE1, 0xF5, 0x82, 0x87, 0x95, 0xBA, 0xD7, 0xBE, 0xB6, 0x4F,
+    0x3F, 0xD4, 0xE5, 0x21, 0xFD, 0xDD, 0xCE, 0x47, 0x80, 0x06, 0x93, 0xE9, 0x91, 0x6B, 0x00, 0xDB,
+    0xB6, 0xC6, 0x0B, 0x74, 0x67, 0x8A, 0x1D, 0x0B, 0x26, 0x18, 0xA5, 0x22, 0xBA, 0x17, 0x64, 0x6B,
+    0x6F, 0x3F, 0x17, 0x3C, 0x9A, 0x3F, 0x66, 0x23, 0xF0, 0xB4, 0xA7, 0x41, 0xBA, 0x96, 0x9A, 0xDF,
+    0x9F, 0x86, 0xD4, 0x38, 0x09, 0xA6, 0x9C, 0xF8, 0x16, 0xFC, 0xEB, 0x37, 0x70, 0xAD, 0x13, 0x8A,
+    0xE3, 0xA9, 0x4B, 0x14, 0xA3, 0xA1, 0x43, 0x5A, 0xC6, 0xBE, 0x13, 0x82, 0x19, 0xD3, 0x52, 0xE6,
+    0x82, 0xCF, 0x78, 0x2D, 0x1D, 0x35, 0x35, 0x01, 0x6B, 0xC5, 0x7F, 0xF2, 0x63, 0xA1, 0x28, 0x2E,
+    0xF9, 0x8E, 0x10, 0xEF, 0x50, 0x31, 0xFA, 0xD5, 0x72, 0x2B, 0x1F, 0x8B, 0x21, 0xC1, 0x4E, 0x6F,
+    0x20, 0xBF, 0xB3, 0x99, 0x7D, 0x9A, 0x94, 0x4B, 0x33, 0xA8, 0x4E, 0xBB, 0x7C, 0x30, 0x60, 0x4E,
+    0x7D, 0xDB, 0x2F, 0xE4, 0x5B, 0x08, 0x9E, 0xCC, 0x9F, 0x3C, 0xC6, 0xEB, 0xFA, 0x56, 0x13, 0x03,
+    0x70, 0x97, 0x34, 0x60, 0x38, 0x76, 0x96, 0x8F, 0x1E, 0x09, 0x08, 0xA4, 0xC9, 0x92, 0xCB, 0xBC,
+    0x3E, 0xC3, 0x97, 0xF2, 0x51, 0x60, 0xA7, 0x43, 0x73, 0x17, 0x6E, 0x94, 0xC1, 0xA4, 0x88, 0xA2,
+    0x99, 0x8F, 0x23, 0x4E, 0x69, 0x8B, 0x1F, 0x90, 0x7C, 0xC9, 0x9E, 0xDD, 0x12, 0x32, 0x80, 0x4A,
+    0x25, 0x74, 0x21, 0xFC, 0x80, 0xCC, 0x8C, 0xB4, 0x5C, 0x3B, 0x0D, 0x43, 0x95, 0xF4, 0xD3, 0xB6,
+    0x4F, 0x55, 0x2E, 0xBB, 0xF4, 0x69, 0x02, 0xA5, 0xA9, 0xF3, 0x07, 0xB4, 0x06, 0xBA, 0x19, 0x76,
+    0x3D, 0x52, 0x42, 0xDB, 0x7C, 0x20, 0x2D, 0x47, 0x25, 0x20, 0x72, 0x4D, 0x2C, 0xFC, 0x03, 0xA5,
+    0x55, 0x3D, 0x73, 0xDD, 0x44, 0x14, 0x3D, 0x92, 0xC6, 0xA8, 0x10, 0xB0, 0x0D, 0x15, 0xCC, 0xB0,
+    0xBF, 0xC0, 0xE8, 0x0F, 0xE4, 0x79, 0x45, 0x45, 0x19, 0x1A, 0xD3, 0x50, 0x50, 0x87, 0x26, 0x14,
+    0x94, 0xF6, 0x93, 0x66, 0x52, 0xA4, 0x34, 0xFF, 0xC0, 0x0D, 0xBD, 0x29, 0x29, 0x8C, 0xDF, 0x32,
+    0x2E, 0x32, 0x03, 0x85, 0x05, 0xC3, 0x0C, 0x45, 0x0A, 0x04, 0x49, 0x26, 0x05, 0x85, 0x37, 0x93,
+    0x47, 0xE6, 0x41, 0x24, 0x5D, 0xCE, 0xDD, 0x7D, 0x49, 0xEC, 0x2E, 0x0C, 0x1A, 0xBF, 0x7B, 0x77,
+    0xB5, 0xAB, 0x7B, 0xEF, 0x39, 0xF7, 0xC3, 0xF8, 0x18, 0xED, 0x94, 0x35, 0xBB, 0xC0, 0x0D, 0xE0,
+    0x0B, 0xE4, 0x1E, 0xBB, 0x90, 0x3E, 0x3F, 0xE9, 0x50, 0x79, 0x18, 0x60, 0x81, 0x3C, 0x88, 0x9C,
+    0xCB, 0x68, 0xA4, 0x79, 0x13, 0x38, 0x6B, 0x50, 0x02, 0x6F, 0x01, 0x5F, 0x42, 0xBA, 0xFC, 0x6B,
+    0xA0, 0x0C, 0x99, 0x50, 0x14, 0x13, 0xAA, 0x50, 0x6D, 0x28, 0x4C, 0x80, 0x09, 0x75, 0x0F, 0x33,
+    0xB4, 0x34, 0x30, 0x48, 0x03, 0xF3, 0xC7, 0x0C, 0x98, 0x07, 0x23, 0xC5, 0xFD, 0x35, 0x60, 0x2F,
+    0x03, 0x85, 0xF4, 0x2A, 0x3A, 0xA0, 0xE6, 0x0D, 0x0A, 0xAF, 0x82, 0x07, 0x4E, 0x78, 0xCF, 0x5D,
+    0x08, 0xC5, 0x39, 0x5F, 0xBA, 0xEF, 0xF9, 0xD2, 0xF9, 0xD5, 0x48, 0xE1, 0x04, 0xAD, 0x37, 0xE2,
+    0x5B, 0x5F, 0xCA, 0xBA, 0xED, 0x72, 0x99, 0xC0, 0x67, 0xF7, 0xBA, 0x78, 0x47, 0x45, 0x30, 0xDE,
+    0xE6, 0x21, 0x0B, 0x4B, 0x58, 0xE3, 0xF3, 0x27, 0x6B, 0xD4, 0x0E, 0xF9, 0x73, 0x5A, 0xDB, 0xA0,
+    0x50, 0xCB, 0x81, 0xCA, 0x63, 0x4F, 0x50, 0x3C, 0x1E, 0xB1, 0xAC, 0x43, 0xD9, 0x8B, 0x3F, 0x2C,
+    0xA4, 0xEA, 0xAD, 0x9A, 0xEC, 0x23, 0x40, 0x34, 0x24, 0xA0, 0xD8, 0xE0, 0x14, 0x68, 0x61, 0x14,
+    0x0A, 0x46, 0xE4, 0x23, 0xCC, 0x0F, 0x9D, 0x6B, 0x30, 0x4E, 0x15, 0x71, 0x1E, 0xFD, 0x34, 0x22,
+    0xDB, 0x4C, 0xAE, 0x83, 0x3D, 0xFA, 0x35, 0xE8, 0x92, 0xDF, 0xD7, 0xC7, 0x84, 0x95, 0x8B, 0x82,
+    0xA9, 0x85, 0xCB, 0xE2, 0xEF, 0x99, 0xF8, 0xDD, 0xF1, 0x7D, 0x3A, 0xFF, 0x6B, 0xA2, 0x6F, 0xF7,
+    0x19, 0xDD, 0x71, 0x59, 0x12, 0xCF, 0xED, 0xDE, 0x8D, 0x25, 0x49, 0x91, 0xD0, 0x92, 0x59, 0xE9,
+    0xDF, 0x26, 0xDD, 0x85, 0xCF, 0xD6, 0x08, 0xF4, 0x76, 0x10, 0x0E, 0xF0, 0xFE, 0xC1, 0x02, 0xD5,
+    0x71, 0x8D, 0xFC, 0xF1, 0x6F, 0x64, 0x9F, 0xE6, 0x1C, 0x99, 0x33, 0x27, 0xDF, 0xA1, 0xF8, 0xF3,
+    0x62, 0xC0, 0xB3, 0x30, 0x63, 0x71, 0x6A, 0x07, 0xFB, 0x79, 0x3E, 0x97, 0x3D, 0x81, 0x65, 0x23,
+    0x39, 0x62, 0xC0, 0xAE, 0x2F, 0x65, 0xB6, 0x03, 0x4E, 0xFE, 0xB9, 0x19, 0x18, 0x35, 0x33, 0x03,
+    0x29, 0x95, 0xD9, 0x3B, 0x8C, 0xD0, 0xFC, 0xCE, 0x80, 0x8A, 0x0D, 0x99, 0xC0, 0xBC, 0xEA, 0x94,
+    0x73, 0xBF, 0xCD, 0x48, 0x29, 0x03, 0x90, 0x09, 0x03, 0xC2, 0x2A, 0xE5, 0x85, 0x28, 0x2A, 0xE1,
+    0xCD, 0x62, 0xD4, 0xA5, 0x18, 0xA5, 0x4F, 0x73, 0xC2, 0x1C, 0x93, 0xBE, 0xB1, 0x10, 0xCD, 0x7F,
+    0xCC, 0x4C, 0x29, 0xC1, 0x06, 0x7E, 0x06, 0x2C, 0xF9, 0x79, 0x46, 0x8F, 0x3B, 0x9F, 0x3E, 0x6A,
+    0x78, 0xC6, 0x37, 0xA2, 0x59, 0xCD, 0xD5, 0x6C, 0x45, 0x2F, 0xA8, 0x35, 0x49, 0x23, 0x19, 0x2C,
+    0x42, 0xCB, 0x70, 0xCE, 0x79, 0xE0, 0x48, 0x22, 0x66, 0x7E, 0xA4, 0x99, 0x81, 0x61, 0x80, 0x70,
+    0x9A, 0x0C, 0x4D, 0x72, 0xF9, 0x94, 0x5B, 0x7B, 0x4E, 0xD1, 0x96, 0x33, 0xB2, 0xB1, 0x9A, 0x59,
+    0x71, 0xBC, 0x52, 0x7B, 0x0A, 0x11, 0xF1, 0x25, 0xE3, 0xA0, 0x1B, 0xD7, 0x1B, 0x3A, 0xCA, 0xF4,
+    0xDB, 0x58, 0x87, 0x74, 0xE4, 0x15, 0x5F, 0x82, 0x4E, 0xC4, 0x4E, 0x9D, 0x47, 0xF4, 0xB4, 0x7E,
+    0xA4, 0x17, 0x12, 0x01, 0x74, 0xAA, 0x17, 0x12, 0x07, 0xF4, 0x12, 0x2F, 0x24, 0x1A, 0x88, 0x3E,
+    0xAA, 0xC8, 0x84, 0xB2, 0xA2, 0x2A, 0x91, 0x41, 0x0E, 0xA2, 0x8A, 0x7C, 0xD0, 0x49, 0xAE, 0x2A,
+    0x52, 0x42, 0x4B, 0x21, 0xAA, 0xC8, 0x0A, 0x2D, 0xD1, 0x4A, 0x48, 0x36, 0xA5, 0x3B, 0x65, 0x66,
+    0x4A, 0xD2, 0xBC, 0x76, 0xBC, 0xFD, 0x33, 0x8D, 0x9B, 0x9B, 0x44, 0x7C, 0x83, 0x75, 0x96, 0x3D,
+    0x1F, 0x34, 0x05, 0x1A, 0x48, 0xCC, 0x00, 0x83, 0xC9, 0x35, 0x22, 0x73, 0xD9, 0x2B, 0x41, 0x14,
+    0x23, 0x05, 0x39, 0x63, 0x35, 0xFA, 0x15, 0x0B, 0x18, 0xE2, 0xDF, 0x65, 0x96, 0x6E, 0xB1, 0x4C,
+    0x59, 0x9F, 0x91, 0xC1, 0xB8, 0x0C, 0xBA, 0x94, 0x62, 0x8C, 0x4B, 0xFF, 0x5A, 0xCB, 0x79, 0x7F,
+    0xFF, 0x76, 0x60, 0xAE, 0x44, 0x94, 0x4A, 0xF6, 0x97, 0xCA, 0x8F, 0xAE, 0x2C, 0x27, 0x8D, 0xAA,
+    0xED, 0x09, 0x21, 0x2E, 0x37, 0x5C, 0xE6, 0x72, 0x57, 0xEB, 0x7D, 0x8A, 0xCB, 0xC8, 0xDC, 0x42,
+    0x45, 0x91, 0x96, 0x0B, 0x14, 0xC3, 0x1A, 0xE6, 0x4E, 0x8F, 0x3D, 0xC3, 0x86, 0x39, 0x44, 0xC1,
+    0x46, 0x34, 0xF7, 0x58, 0xA5, 0xB6, 0xC3, 0xB8, 0xE4, 0x96, 0x66, 0xEF, 0xF1, 0x67, 0x99, 0x34,
+    0xFA, 0x78, 0xC2, 0xDE, 0xFA, 0x91, 0xDD, 0x51, 0x7B, 0x4C, 0x2B, 0xC4, 0x8C, 0x7D, 0x03, 0x1D,
+    0x48, 0x2F, 0x9F, 0x88, 0x4D, 0x64, 0x8E, 0xE8, 0x44, 0x1E, 0x5C, 0xDD, 0x2A, 0xF3, 0x8A, 0x86,
+    0x44, 0xF9, 0xFF, 0xB1, 0x7D, 0xB4, 0xFF, 0x89, 0x6E, 0x23, 0x6E, 0x6D, 0x0C, 0x3E, 0xCD, 0xCB,
+    0x6D, 0x9B, 0xB6, 0xE5, 0x8B, 0xAD, 0x92, 0xC1, 0x6D, 0xA4, 0x63, 0xBB, 0xED, 0xAE, 0x6E, 0x73,
+    0xDD, 0xB2, 0x96, 0x6A, 0x6E, 0x3F, 0xD0, 0xDC, 0x5F, 0x74, 0xB4, 0xF1, 0x74, 0x80, 0x05, 0x36,
+    0x3A, 0x5F, 0x39, 0x95, 0x82, 0xCE, 0x96, 0x53, 0x26, 0x15, 0x35, 0x49, 0xD2, 0xF6, 0x70, 0xDA,
+    0x28, 0xC4, 0x35, 0x45, 0xBF, 0x8D, 0x22, 0xED, 0x35, 0x92, 0x8D, 0xDE, 0x9C, 0xF5, 0x26, 0x01,
+    0x8F, 0x3A, 0x8F, 0x5C, 0x64, 0x64, 0xFB, 0x30, 0xB8, 0xF9, 0x9A, 0xD2, 0x3A, 0x62, 0x27, 0xAE,
+    0x5E, 0x4F, 0xB5, 0xAF, 0xD4, 0xC9, 0x1C, 0x15, 0xDD, 0xAA, 0x7A, 0x58, 0xAE, 0x55, 0xD1, 0x65,
+    0xBA, 0x72, 0x98, 0xD4, 0x5E, 0x52, 0xAE, 0x8D, 0xFC, 0x6D, 0xD5, 0x5E, 0x52, 0x67, 0x51, 0xD9,
+    0x31, 0xAA, 0x7A, 0x93, 0xD4, 0x57, 0x29, 0x4C, 0x0E, 0xC6, 0xED, 0x4C, 0x89, 0x23, 0x9F, 0xF3,
+    0x81, 0x2F, 0xCF, 0x58, 0xD9, 0x3C, 0xDA, 0x28, 0x38, 0x54, 0x83, 0x02, 0x45, 0xDD, 0x6D, 0x8F,
+    0xB2, 0x74, 0x54, 0xA6, 0x23, 0x9B, 0x8E, 0xDA, 0x6B, 0x47, 0xCF, 0x64, 0xD0, 0x23, 0x66, 0x45,
+    0x8F, 0x86, 0x2A, 0xDC, 0x42, 0x36, 0xC7, 0x2F, 0xF8, 0xAB, 0x74, 0xB8, 0x79, 0xD8, 0x26, 0x62,
+    0xDD, 0x4B, 0xA3, 0x89, 0x7F, 0xEC, 0xC1, 0x82, 0xFD, 0xC6, 0x62, 0x64, 0x14, 0x34, 0xF6, 0x9E,
+    0x1A, 0x1B, 0xA1, 0x13, 0xB0, 0x0A, 0x85, 0x92, 0xB8, 0xD3, 0xEC, 0xBC, 0x2A, 0x3E, 0x70, 0x40,
+    0xC7, 0x0E, 0xEE, 0x13, 0x8C, 0x75, 0x52, 0xBF, 0xC4, 0x33, 0xC1, 0x0B, 0x65, 0xE7, 0x08, 0xC9,
+    0xF1, 0x5C, 0x11, 0x34, 0xFC, 0xDF, 0xA1, 0x29, 0x2D, 0x06, 0x42, 0x63, 0xDA, 0xBF, 0xD5, 0xCC,
+    0x75, 0xAC, 0x86, 0xA5, 0xB6, 0x89, 0xE9, 0x6C, 0xC7, 0x59, 0x5F, 0xF6, 0x8C, 0x85, 0xFD, 0x11,
+    0x18, 0x99, 0x6D, 0x98, 0xD3, 0x96, 0xC1, 0x31, 0x14, 0xEB, 0xB3, 0x91, 0x81, 0xB0, 0x38, 0xDD,
+    0x5D, 0x41, 0xB3, 0xEA, 0xC8, 0x5A, 0x1E, 0xEC, 0xF4, 0xA1, 0xC8, 0xE5, 0xAC, 0x44, 0x2A, 0x89,
+    0xB1, 0x46, 0xA5, 0x89, 0x5B, 0xA2, 0x7A, 0x43, 0x1E, 0xE2, 0xBF, 0x3C, 0xFF, 0x02, 0xB5, 0x55,
+    0x3D, 0x73, 0xDD, 0x44, 0x14, 0xBD, 0xD2, 0x06, 0x54, 0x68, 0x98, 0xA5, 0xCC, 0xA4, 0x51, 0x43,
+    0x01, 0x19, 0x1C, 0xB5, 0x29, 0xFC, 0xBC, 0xEA, 0x28, 0x49, 0x41, 0xFE, 0x03, 0x43, 0x41, 0x52,
+    0xA4, 0x34, 0x96, 0x48, 0x43, 0xEB, 0x86, 0x7F, 0x00, 0x14, 0xA4, 0xA1, 0x74, 0x11, 0xFB, 0x6D,
+    0x47, 0x91, 0x02, 0x35, 0x4C, 0x4A, 0xAB, 0xF0, 0x90, 0x76, 0x93, 0x51, 0x82, 0x9C, 0x48, 0x5A,
+    0xCE, 0xB9, 0xE2, 0xC5, 0x2F, 0x1E, 0x33, 0xC3, 0x0C, 0x83, 0xDE, 0xDB, 0x2B, 0xED, 0x95, 0x74,
+    0xEF, 0x39, 0xF7, 0x4B, 0x92, 0x34, 0x82, 0x23, 0x52, 0x14, 0x23, 0xE5, 0x5C, 0x41, 0xE4, 0xAD,
+    0xDC, 0x38, 0x94, 0x3D, 0xC9, 0x62, 0x97, 0x04, 0x39, 0xCE, 0x5A, 0xDB, 0x18, 0x6F, 0x9A, 0x3D,
+    0xD9, 0x11, 0x2B, 0xBD, 0x04, 0xB9, 0x6D, 0x5A, 0xE3, 0xD3, 0xCE, 0x56, 0x85, 0x14, 0xB2, 0x92,
+    0x7D, 0x19, 0xF1, 0xEB, 0x6D, 0x6B, 0x7A, 0xF3, 0x7C, 0x96, 0xEC, 0x3C, 0x8B, 0xE1, 0xB1, 0x8D,
+    0x38, 0x7A, 0x95, 0xD5, 0xFB, 0xF1, 0x59, 0x3C, 0x94, 0xED, 0x23, 0x59, 0x9F, 0x8B, 0xDC, 0x8B,
+    0xB3, 0xA4, 0x31, 0x4E, 0x62, 0xE3, 0xF7, 0x5F, 0x8A, 0xEB, 0x09, 0xC5, 0xE3, 0x1E, 0xF1, 0x98,
+    0x09, 0x22, 0x1B, 0x88, 0x26, 0x40, 0x58, 0x15, 0x1D, 0x71, 0x5E, 0x88, 0xF0, 0x56, 0x10, 0xBB,
+    0x8D, 0x2A, 0xCE, 0xE4, 0xEB, 0x1C, 0x3E, 0x67, 0x43, 0x91, 0x50, 0xC8, 0x9A, 0xA2, 0xA0, 0x48,
+    0xD6, 0xF1, 0x9C, 0x5E, 0xC8, 0x32, 0xF1, 0x04, 0x42, 0xF1, 0x88, 0x51, 0x98, 0x15, 0x57, 0x16,
+    0xBD, 0x89, 0xA3, 0xC4, 0x9F, 0x9A, 0xD2, 0x8B, 0x01, 0xA2, 0x1A, 0x3A, 0x38, 0x3B, 0x06, 0x8E,
+    0x6E, 0xD9, 0x41, 0xE9, 0x5A, 0xE0, 0xFE, 0xA3, 0x01, 0x39, 0x29, 0xE3, 0x00, 0xD3, 0x95, 0x5A,
+    0xFB, 0x00, 0xA6, 0x3C, 0x51, 0xD6, 0x64, 0x7D, 0x4A, 0xF1, 0x27, 0xC5, 0xF4, 0xE3, 0x9D, 0x49,
+    0xEE, 0xE2, 0x35, 0xBA, 0xB5, 0x2D, 0xD9, 0x91, 0xAB, 0x90, 0xE2, 0x96, 0x52, 0xD9, 0x26, 0x8A,
+    0xA3, 0x6E, 0x36, 0x24, 0xB7, 0x94, 0x6B, 0x2A, 0x4B, 0x2A, 0x73, 0xF2, 0x4D, 0x35, 0x6D, 0x6B,
+    0x12, 0x70, 0x1A, 0x1D, 0x2A, 0x8D, 0x2A, 0x19, 0x45, 0xD9, 0xE5, 0x95, 0xA5, 0x30, 0xD8, 0x22,
+    0x06, 0xAF, 0x00, 0xE5, 0xF7, 0x3B, 0x43, 0x22, 0x06, 0x36, 0x2C, 0x8C, 0xED, 0xE1, 0x1E, 0xCC,
+    0x6F, 0x6F, 0x61, 0xC3, 0xC0, 0x98, 0xC5, 0x1B, 0x0E, 0x7E, 0xB1, 0xCD, 0xB0, 0x45, 0x2C, 0xE4,
+    0x17, 0x78, 0xF4, 0x0B, 0xDC, 0x9A, 0xD9, 0x70, 0xDF, 0x02, 0x7E, 0xE1, 0x1D, 0x08, 0x07, 0x80,
+    0xCC, 0x7B, 0x94, 0x91, 0x19, 0x01, 0x3A, 0x9D, 0x90, 0x3C, 0xE6, 0xB0, 0xF6, 0x88, 0x8B, 0xED,
+    0x6B, 0x8F, 0x8C, 0x22, 0x62, 0xE2, 0x22, 0x5E, 0xCB, 0xA3, 0xA6, 0x99, 0x58, 0xCB, 0xE9, 0x02,
+    0x30, 0xA9, 0x39, 0x52, 0xB3, 0xE4, 0x9B, 0xCD, 0xCA, 0x8F, 0xCA, 0x35, 0x95, 0x8E, 0x4A, 0x3B,
+    0x6B, 0x7E, 0xA0, 0x3C, 0x00, 0x4E, 0x27, 0x69, 0xEF, 0x2A, 0x13, 0x8A, 0x26, 0x0B, 0xD6, 0xE7,
+    0x6D, 0xDE, 0x5A, 0x9F, 0x75, 0x45, 0x63, 0x42, 0x59, 0xE1, 0x0E, 0xA0, 0xF3, 0x29, 0xA4, 0xED,
+    0x04, 0xAE, 0xEA, 0x61, 0x89, 0x51, 0x19, 0x96, 0xA8, 0x5E, 0xB1, 0x94, 0x57, 0xBE, 0xE1, 0x55,
+    0x2A, 0xAF, 0x8E, 0xBC, 0x02, 0x79, 0x21, 0xC7, 0x01, 0xE4, 0xC0, 0x6B, 0x56, 0x5E, 0xC4, 0xB9,
+    0x26, 0xAF, 0x7A, 0xC3, 0x2B, 0x7B, 0xCB, 0x0B, 0x55, 0x31, 0x80, 0x16, 0xAA, 0x4D, 0x10, 0xF0,
+    0xE6, 0x1F, 0x78, 0xC5, 0x2B, 0x78, 0xDD, 0xA8, 0xE4, 0x26, 0xC2, 0x5D, 0x34, 0x23, 0x0A, 0xA2,
+    0x04, 0x15, 0x13, 0xD2, 0x41, 0x7B, 0xAB, 0x6C, 0x9C, 0x90, 0x99, 0x4C, 0xC8, 0x4C, 0xF1, 0x5D,
+    0x27, 0xE6, 0x05, 0xDC, 0x1D, 0xC3, 0x5B, 0x31, 0x33, 0x86, 0x55, 0x06, 0x57, 0x2F, 0x59, 0x6A,
+    0x2C, 0xBD, 0x4A, 0xEB, 0x85, 0x35, 0x44, 0x72, 0x5A, 0x41, 0x2C, 0x1A, 0xCF, 0xCE, 0x26, 0xC5,
+    0xC2, 0x1B, 0x06, 0xA4, 0x4A, 0x26, 0x2D, 0xFB, 0xB5, 0xA4, 0x30, 0xE4, 0x1A, 0x56, 0x76, 0xD1,
+    0x32, 0xB7, 0x36, 0x80, 0x3E, 0xB2, 0x49, 0x13, 0xE9, 0xBC, 0x64, 0x48, 0x8B, 0xB5, 0x56, 0x5B,
+    0x5A, 0x6E, 0x4B, 0xBF, 0x2E, 0x99, 0x44, 0x13, 0x2B, 0x3B, 0x92, 0xB0, 0x23, 0x4B, 0xD2, 0x05,
+    0x3E, 0x54, 0x77, 0xC5, 0xC0, 0x6A, 0xB4, 0x13, 0x31, 0x22, 0xD5, 0x39, 0x1B, 0xBE, 0x61, 0xBB,
+    0xC6, 0x33, 0xBE, 0x5F, 0xAB, 0x55, 0xCC, 0x95, 0xCB, 0xF2, 0x7A, 0x21, 0x72, 0x84, 0xC2, 0xDC,
+    0xC7, 0x78, 0x59, 0x01, 0x3A, 0x8A, 0x71, 0x28, 0x01, 0xEF, 0xF3, 0x06, 0x96, 0x68, 0xDF, 0x2F,
+    0x0D, 0x69, 0x58, 0xB0, 0x50, 0xA4, 0xAF, 0x07, 0xA4, 0x1C, 0x49, 0x9C, 0x32, 0x26, 0x0C, 0x3D,
+    0x8F, 0x10, 0xD6, 0x8D, 0xF6, 0x88, 0x36, 0xFA, 0x7D, 0xAC, 0x6B, 0x4B, 0x20, 0x30, 0x09, 0xA6,
+    0x24, 0x30, 0x62, 0xD5, 0x3E, 0x52, 0xDD, 0x60, 0x86, 0xD1, 0x56, 0x06, 0x2B, 0x30, 0x02, 0xD8,
+    0x27, 0x22, 0xFF, 0xFD, 0x06, 0x1B, 0xBF, 0x65, 0xDB, 0xA1, 0x1A, 0x4A, 0x1D, 0x43, 0x1C, 0x4B,
+    0x9A, 0x7B, 0x9D, 0x28, 0xC0, 0xB5, 0x24, 0xE6, 0x60, 0x01, 0xB5, 0x75, 0x43, 0xE4, 0xAB, 0x9F,
+    0x7F, 0xB8, 0x06, 0x80, 0x0F, 0x5B, 0x74, 0xF1, 0x0E, 0xFA, 0x37, 0xFD, 0x77, 0x17, 0x2E, 0xC6,
+    0x8E, 0x73, 0x8F, 0x17, 0x3A, 0x17, 0xE9, 0x65, 0x73, 0x21, 0x87, 0x18, 0x41, 0x5F, 0x20, 0xD5,
+    0xA6, 0x47, 0x11, 0xD8, 0x16, 0x1E, 0x5D, 0x75, 0xC0, 0x29, 0x84, 0x72, 0xED, 0x4D, 0x0B, 0x95,
+    0xAD, 0xA0, 0x5A, 0x71, 0x0A, 0x40, 0x15, 0xD2, 0x80, 0x30, 0x9B, 0x3E, 0x8B, 0x44, 0x3E, 0xA2,
+    0x44, 0x9F, 0xE9, 0x98, 0xD1, 0x81, 0x23, 0xCB, 0xAC, 0xD0, 0x61, 0x71, 0x59, 0xF5, 0x02, 0xA3,
+    0x3E, 0xFF, 0x0D, 0xBA, 0xF2, 0x8A, 0xC7, 0xE4, 0x63, 0xF9, 0x04, 0x1F, 0x93, 0x76, 0x57, 0x56,
+    0xEF, 0x9E, 0x52, 0xB6, 0xF0, 0xA3, 0x49, 0xEA, 0x37, 0x68, 0x29, 0x60, 0x00, 0x20, 0x8E, 0x30,
+    0xCE, 0x2E, 0x9E, 0x4E, 0x45, 0x3E, 0x0D, 0xCB, 0x3C, 0xC3, 0xE9, 0x3D, 0x0D, 0x59, 0x25, 0xF9,
+    0xAF, 0x98, 0xC4, 0xCF, 0x51, 0x48, 0xE3, 0x37, 0x40, 0x00, 0x85, 0x85, 0xC2, 0x5C, 0x28, 0x1E,
+    0x76, 0xC5, 0xD3, 0xEE, 0x28, 0xEF, 0xA7, 0x5B, 0xD9, 0xE4, 0x4E, 0x9F, 0xC4, 0xCF, 0x98, 0x94,
+    0x18, 0xDF, 0x80, 0x54, 0x87, 0xCF, 0x8E, 0x77, 0x15, 0xBE, 0x62, 0x9D, 0x1C, 0xA1, 0x47, 0x6E,
+    0xA1, 0x69, 0xF2, 0x66, 0x69, 0x9A, 0x8F, 0xE4, 0xFA, 0x6D, 0xD9, 0xD9, 0xFA, 0xAF, 0x76, 0x1F,
+    0xE0, 0x7F, 0xE2, 0x5E, 0xCF, 0x45, 0x9C, 0xD3, 0x79, 0x4F, 0x1E, 0x6C, 0xFE, 0x1F, 0x72, 0x6A,
+    0xEA, 0xE8, 0xDC, 0x5E, 0xEE, 0xD2, 0xAA, 0x37, 0xEB, 0x5E, 0xAC, 0xD0, 0xA1, 0x5D, 0x7D, 0x96,
+    0x05, 0xB8, 0xEA, 0xA1, 0x3B, 0xC2, 0x7A, 0x7C, 0xF0, 0xEE, 0x1A, 0xA1, 0x9B, 0xFE, 0x5E, 0xB3,
+    0xFC, 0x7F, 0xC7, 0x5F, 0xC5, 0x55, 0x3D, 0x73, 0xDD, 0x54, 0x10, 0x3D, 0xD2, 0x4D, 0xAC, 0x42,
+    0x85, 0x68, 0x28, 0x70, 0x08, 0xFA, 0x05, 0x46, 0x7F, 0xE0, 0x39, 0x57, 0xA1, 0x49, 0xE1, 0x26,
+    0x05, 0x69, 0x42, 0x11, 0x5A, 0x2A, 0xB7, 0x14, 0x6F, 0x90, 0x32, 0x14, 0x14, 0x14, 0xA4, 0x49,
+    0xEF, 0x92, 0x89, 0xDB, 0x14, 0x1E, 0xC6, 0x41, 0x9A, 0x50, 0x50, 0xA4, 0x78, 0xFA, 0x09, 0xCA,
+    0x60, 0x86, 0x19, 0x57, 0x37, 0x8C, 0x66, 0x22, 0x12, 0xE9, 0x5E, 0xCE, 0xAE, 0x62, 0xC7, 0x76,
+    0x13, 0x3A, 0xF4, 0xB4, 0xBB, 0x73, 0x57, 0xF7, 0xE3, 0xEC, 0xDE, 0xB3, 0xFB, 0xB2, 0x16, 0xC8,
+    0x44, 0xEA, 0x2B, 0x52, 0x02, 0xF9, 0x99, 0xEC, 0x79, 0x14, 0x4D, 0xE8, 0x8A, 0x10, 0x5C, 0x31,
+    0x26, 0x43, 0xD1, 0x45, 0xA3, 0x6D, 0x31, 0xD9, 0x1A, 0xC7, 0xB6, 0xBC, 0x24, 0x93, 0x48, 0x55,
+    0x62, 0x56, 0xA9, 0xA3, 0xB9, 0xA1, 0x00, 0xD8, 0x3F, 0xA1, 0x8A, 0x42, 0xE8, 0x80, 0x38, 0x9C,
+    0x7A, 0x6A, 0x8F, 0xA4, 0x83, 0x7C, 0xE3, 0x32, 0xEA, 0xEC, 0xA7, 0xBE, 0x02, 0x92, 0xBF, 0x83,
+    0x3C, 0xB3, 0x55, 0xF3, 0xF0, 0x90, 0xCA, 0x1F, 0x44, 0xFE, 0x31, 0x17, 0xA3, 0x12, 0x85, 0xAC,
+    0x13, 0x6D, 0x26, 0x1D, 0x84, 0x5A, 0x74, 0x31, 0xAA, 0x2B, 0x9C, 0xE0, 0x06, 0xD0, 0x70, 0x49,
+    0x8B, 0x94, 0xDA, 0xE9, 0x80, 0x13, 0x93, 0x10, 0xFE, 0xE1, 0x84, 0xAD, 0x5F, 0x1E, 0x51, 0x6F,
+    0x73, 0x49, 0xC1, 0x75, 0x69, 0x97, 0x5F, 0x8F, 0x1D, 0xBE, 0x1D, 0x56, 0x30, 0x9B, 0xB3, 0x23,
+    0x5D, 0x76, 0xCA, 0xA3, 0x64, 0x3B, 0x49, 0x09, 0x9E, 0x51, 0x12, 0x19, 0x59, 0x7F, 0xD8, 0x42,
+    0xF6, 0x32, 0xB2, 0xF9, 0x56, 0x90, 0x8D, 0x8A, 0x13, 0x3D, 0x3B, 0xC8, 0xF7, 0xDC, 0x1F, 0x3A,
+    0x05, 0x25, 0x99, 0x63, 0x70, 0xBB, 0x69, 0x5F, 0xD4, 0x88, 0x5D, 0x65, 0xE8, 0xDE, 0xBF, 0xA3,
+    0xC1, 0x4C, 0x4B, 0x4C, 0xED, 0x7D, 0xD1, 0x3F, 0x23, 0xFB, 0xF3, 0xAE, 0xAC, 0xF7, 0x4B, 0x50,
+    0xFD, 0x12, 0x4E, 0x29, 0x3A, 0x9D, 0x75, 0x60, 0x89, 0xF9, 0x6B, 0x26, 0x8B, 0x0F, 0x27, 0x2C,
+    0xF1, 0x14, 0x3A, 0x90, 0xB0, 0x64, 0x41, 0xE3, 0x05, 0x07, 0x8E, 0x74, 0x7A, 0xAA, 0xA9, 0x78,
+    0x37, 0xD8, 0xD2, 0x8D, 0xB6, 0x1F, 0x49, 0xEC, 0x03, 0xF0, 0x5D, 0xF9, 0xF4, 0x9A, 0xE9, 0xE0,
+    0xD6, 0x9F, 0x23, 0x7A, 0x29, 0x1B, 0x3E, 0x17, 0x55, 0xE6, 0xA7, 0xF7, 0x80, 0xB5, 0xDC, 0xCB,
+    0x20, 0xF9, 0x73, 0x02, 0x64, 0xD0, 0x68, 0x9E, 0xF4, 0x20, 0xDA, 0x9A, 0xE7, 0x11, 0xDF, 0x0D,
+    0x09, 0x37, 0x91, 0x0D, 0x3F, 0x15, 0xF5, 0x11, 0xF0, 0x64, 0x6F, 0x68, 0xF6, 0x86, 0xEA, 0xCE,
+    0xE5, 0xF7, 0x87, 0x51, 0xDE, 0x17, 0x53, 0xF3, 0x62, 0x0A, 0x9B, 0x89, 0x79, 0x12, 0x18, 0x07,
+    0xB2, 0xE4, 0x33, 0x18, 0x45, 0xB7, 0x8B, 0x1D, 0x85, 0xD7, 0x48, 0x2C, 0x6A, 0xD5, 0x60, 0xBF,
+    0xC3, 0x07, 0x9F, 0xCC, 0x45, 0x01, 0x45, 0x8F, 0xDC, 0x99, 0x11, 0x5C, 0x67, 0xBB, 0xAC, 0x17,
+    0xB4, 0xB6, 0xB5, 0x75, 0xC5, 0xB3, 0x9A, 0xDA, 0x2B, 0x29, 0x82, 0x19, 0x39, 0x0B, 0x91, 0xCF,
+    0x9C, 0xEC, 0x6E, 0xE6, 0x6A, 0x23, 0x31, 0x25, 0x73, 0x90, 0x59, 0x42, 0x0C, 0xA5, 0x4E, 0xB6,
+    0xA4, 0x10, 0x79, 0x58, 0x30, 0x58, 0xC9, 0x93, 0x42, 0x92, 0x59, 0x42, 0x19, 0xB5, 0xD5, 0x62,
+    0x93, 0xB0, 0x58, 0x0E, 0x85, 0x72, 0x26, 0x2C, 0xD6, 0xFA, 0xF0, 0x96, 0xD6, 0x84, 0xBF, 0xC2,
+    0x86, 0xD6, 0x86, 0x9C, 0xBF, 0xDA, 0x04, 0xD7, 0x4C, 0xA4, 0x98, 0x0D, 0x5F, 0x04, 0x67, 0xC3,
+    0xF7, 0x61, 0xCC, 0x42, 0x67, 0x65, 0xFE, 0x01, 0x3E, 0xE1, 0x26, 0x71, 0x8B, 0xA7, 0xB2, 0x67,
+    0x9B, 0xB4, 0x0A, 0x64, 0x5E, 0xF0, 0x28, 0x9C, 0x74, 0xC4, 0x7F, 0x79, 0x2A, 0x58, 0xB0, 0xD0,
+    0x3C, 0x26, 0x26, 0x03, 0xB3, 0x71, 0x79, 0x8B, 0x78, 0xCA, 0x5A, 0x6E, 0x65, 0x46, 0x9B, 0x32,
+    0xBB, 0xC9, 0xAB, 0x49, 0xEA, 0x25, 0x7D, 0xFD, 0x7A, 0x5C, 0xA2, 0x6D, 0x35, 0xD8, 0x79, 0x89,
+    0xB5, 0x5F, 0x8C, 0xE8, 0x38, 0xF8, 0x85, 0xC7, 0x5E, 0x07, 0x6A, 0x0A, 0x35, 0x26, 0x34, 0x6F,
+    0x69, 0xEC, 0x1C, 0x36, 0x9E, 0x83, 0xDF, 0x43, 0xE6, 0x39, 0xC8, 0xE7, 0xDC, 0x9B, 0xD0, 0x35,
+    0x43, 0xB1, 0x50, 0x37, 0x76, 0xF1, 0x84, 0x63, 0xCC, 0x44, 0x14, 0x58, 0x35, 0x15, 0x79, 0xC4,
+    0xB6, 0x30, 0x11, 0xD0, 0x2D, 0x96, 0x6A, 0xFE, 0xA3, 0x43, 0xF2, 0x87, 0x43, 0xF4, 0x86, 0x30,
+    0x1A, 0x66, 0xBE, 0xF0, 0xA5, 0xDC, 0x41, 0x6D, 0xC6, 0x07, 0x9E, 0xF8, 0x8B, 0xDE, 0x96, 0xD1,
+    0xCC, 0x89, 0xC5, 0x6F, 0x03, 0xCC, 0x2B, 0xC2, 0x93, 0xC6, 0x61, 0x1F, 0x74, 0x5A, 0xE7, 0xC9,
+    0x52, 0x54, 0xBC, 0xBC, 0x05, 0x6D, 0x46, 0x31, 0x72, 0xEC, 0x97, 0xC0, 0x4D, 0xD3, 0xDF, 0x4C,
+    0xDA, 0x9D, 0xAC, 0xDC, 0x29, 0xB0, 0xB3, 0xC2, 0xEA, 0x08, 0xBB, 0x8E, 0xA4, 0x80, 0x7D, 0x83,
+    0x55, 0xDE, 0xAD, 0x62, 0xB7, 0xC6, 0xD1, 0x1A, 0xEB, 0x35, 0x56, 0xC7, 0x58, 0x09, 0xCD, 0xA3,
+    0x91, 0xDC, 0x01, 0x71, 0x5D, 0xD3, 0x7B, 0x14, 0x72, 0x93, 0x86, 0xCA, 0x07, 0x46, 0xC0, 0x64,
+    0x35, 0xF2, 0xB1, 0x68, 0x99, 0xBD, 0x54, 0x62, 0xE2, 0xDB, 0x00, 0xBF, 0xD2, 0x83, 0xA2, 0xA6,
+    0x33, 0xEB, 0xE9, 0x31, 0x83, 0x38, 0x67, 0x71, 0xDA, 0x32, 0xA3, 0xB3, 0x25, 0x3E, 0x56, 0x4E,
+    0x40, 0x34, 0x91, 0x8A, 0xDC, 0x86, 0xCE, 0xA2, 0x35, 0xF3, 0xDD, 0x7D, 0x3A, 0x27, 0x3B, 0x90,
+    0x23, 0x64, 0x69, 0xA6, 0x95, 0x6D, 0xF5, 0x0E, 0xDC, 0xD9, 0x35, 0x9B, 0x59, 0x5B, 0x22, 0x21,
+    0x4C, 0x42, 0xBB, 0xB4, 0x5D, 0xE3, 0x38, 0x51, 0x73, 0x44, 0x53, 0xAF, 0x31, 0x26, 0x6D, 0x56,
+    0x1E, 0x63, 0x48, 0xD5, 0xB8, 0xB4, 0xCD, 0xF1, 0x6C, 0xCF, 0xA5, 0xD3, 0x4C, 0xB2, 0x6B, 0xCD,
+    0x5A, 0xA9, 0xDA, 0x6D, 0x6E, 0xFD, 0x8D, 0xF4, 0x11, 0x33, 0x0A, 0x19, 0x32, 0x27, 0xCD, 0x84,
+    0x55, 0xC1, 0xC3, 0x82, 0x14, 0x8A, 0x99, 0x24, 0x85, 0x74, 0xBB, 0x0F, 0xBB, 0x1F, 0xDF, 0xFB,
+    0x6A, 0x52, 0x72, 0x0F, 0xD2, 0x70, 0x84, 0xB5, 0x7C, 0x6E, 0x6B, 0x47, 0x4E, 0xD4, 0x9D, 0xF3,
+    0xD4, 0xAA, 0xAB, 0xD8, 0xB8, 0xC3, 0x43, 0xC6, 0x94, 0x78, 0xB9, 0x1A, 0xB2, 0x7E, 0x90, 0xDB,
+    0xAD, 0x7A, 0x12, 0xC8, 0x69, 0x50, 0x4B, 0xD1, 0x28, 0xCB, 0x26, 0xAD, 0x9B, 0x5E, 0xC9, 0x75,
+    0x4E, 0xF4, 0xEB, 0x00, 0x7B, 0x91, 0xBB, 0x75, 0x41, 0x2C, 0xA9, 0xF4, 0x4E, 0x86, 0x73, 0xE1,
+    0x91, 0x17, 0x64, 0xB4, 0x42, 0xEF, 0x45, 0xBC, 0x5D, 0xA8, 0x40, 0x91, 0x3F, 0x11, 0x3B, 0x2F,
+    0x47, 0x7D, 0x5C, 0xFE, 0x5F, 0xF9, 0xB8, 0xFD, 0x3E, 0x1F, 0xA3, 0xE6, 0xA3, 0xD7, 0x7C, 0x68,
+    0xE3, 0xD3, 0x7C, 0x28, 0x5C, 0xE4, 0xDA, 0x67, 0xB4, 0x17, 0x45, 0x9A, 0xA0, 0x54, 0x1D, 0xF6,
+    0xBD, 0x03, 0x97, 0x73, 0x63, 0xCF, 0xE5, 0x42, 0x5E, 0x2E, 0xE7, 0x66, 0xBC, 0x92, 0x9B, 0xD1,
+    0x96, 0x12, 0xBA, 0xFE, 0xB9, 0x08, 0xC9, 0xE4, 0x0A, 0x38, 0x8E, 0x79, 0x52, 0x7C, 0x70, 0xA5,
+    0x95, 0xFC, 0x0B, 0xAD, 0x55, 0xB1, 0x92, 0xDC, 0x44, 0x10, 0x7D, 0xD2, 0x14, 0xA8, 0x8C, 0x82,
+    0x49, 0x08, 0xA8, 0xBA, 0x2A, 0xF4, 0x01, 0xB8, 0x4E, 0x3F, 0x70, 0xBE, 0x51, 0x0C, 0x81, 0x1D,
+    0xDC, 0x3A, 0x71, 0x00, 0x45, 0x68, 0x02, 0xFF, 0xC0, 0xED, 0x8D, 0x80, 0x80, 0xD0, 0x97, 0x90,
+    0x13, 0x40, 0x15, 0x90, 0x98, 0x90, 0x60, 0x6F, 0x35, 0x85, 0x03, 0x07, 0x0E, 0x4E, 0x76, 0x4A,
+    0x60, 0x05, 0x86, 0x02, 0x92, 0x13, 0x46, 0x81, 0x8E, 0x95, 0x34, 0xBC, 0x1E, 0xED, 0x61, 0x53,
+    0xF6, 0x11, 0x59, 0xAB, 0x99, 0x27, 0xCD, 0xEC, 0x74, 0xBF, 0x7E, 0xDD, 0x33, 0x5A, 0x00, 0x07,
+    0x13, 0xA2, 0x61, 0x0D, 0x84, 0x76, 0xC2, 0xB6, 0xDC, 0xB6, 0x6B, 0xFF, 0xB6, 0x68, 0x30, 0x50,
+    0x43, 0x76, 0x9C, 0x0D, 0xDA, 0xFB, 0x21, 0xF2, 0xBF, 0x0E, 0xE0, 0xD8, 0xDC, 0x70, 0x49, 0xBB,
+    0x98, 0x8F, 0xDA, 0xB9, 0xE1, 0xC6, 0x47, 0xF8, 0xD8, 0xA9, 0x87, 0xD0, 0x57, 0xB1, 0xF7, 0x03,
+    0x9E, 0x85, 0xC7, 0x5D, 0xAC, 0x8E, 0x6E, 0xB5, 0xDE, 0xBB, 0xEA, 0x2E, 0xB0, 0x87, 0x37, 0x3B,
+    0xE4, 0x35, 0xAA, 0x22, 0x76, 0x48, 0x81, 0xAB, 0x78, 0xEB, 0x5B, 0x20, 0xFE, 0x0E, 0x7A, 0x04,
+    0x92, 0x09, 0x7A, 0x02, 0x52, 0x8F, 0xCC, 0x03, 0x5A, 0xA0, 0x44, 0x2E, 0xE0, 0x60, 0x04, 0x6A,
+    0x58, 0xCF, 0x81, 0x06, 0x15, 0xE1, 0xAC, 0x85, 0xAF, 0x8A, 0xFC, 0x49, 0x1F, 0x4F, 0x84, 0xD3,
+    0x41, 0x8D, 0x84, 0x07, 0x63, 0x32, 0x54, 0xA5, 0xB9, 0xEF, 0xD3, 0x9E, 0xF0, 0x93, 0xD7, 0xAD,
+    0x2F, 0x8D, 0xF3, 0xF7, 0x5A, 0xEF, 0x08, 0xBE, 0x26, 0xD4, 0xD6, 0x3B, 0x01, 0x33, 0x43, 0xEE,
+    0x0B, 0x01, 0x7A, 0x23, 0x34, 0x7A, 0x8A, 0xBC, 0xB3, 0x4D, 0x32, 0x46, 0xBE, 0xB6, 0x8D, 0x1A,
+    0x02, 0x90, 0x20, 0xA1, 0x15, 0xE0, 0x33, 0x02, 0xD1, 0x00, 0x63, 0x80, 0x74, 0x98, 0xA1, 0x9F,
+    0xA1, 0x0B, 0xA0, 0xDB, 0x00, 0xD9, 0x0C, 0x66, 0x5E, 0xC7, 0x77, 0x87, 0xBC, 0xC8, 0x1A, 0x98,
+    0x92, 0x33, 0xB6, 0xCC, 0x3A, 0x7A, 0xCD, 0xE9, 0xC5, 0xED, 0x0E, 0xF1, 0xC6, 0xED, 0xAE, 0xD5,
+    0xC6, 0xE5, 0x26, 0xF9, 0xD9, 0x19, 0x73, 0xFD, 0xD4, 0x99, 0xEC, 0xC9, 0xDD, 0xDA, 0x68, 0x7F,
+    0xBD, 0x36, 0xA9, 0xD7, 0xB5, 0x51, 0x93, 0x6E, 0x8C, 0x1A, 0xD9, 0x45, 0x03, 0xBB, 0xE2, 0xEB,
+    0xAC, 0x35, 0xC5, 0xD6, 0x85, 0x70, 0x08, 0xA9, 0x8A, 0x84, 0x46, 0x2C, 0x24, 0x94, 0x4C, 0xC4,
+    0xC7, 0x07, 0x27, 0x72, 0xAD, 0x8F, 0xE6, 0xCB, 0x5A, 0x23, 0x17, 0x34, 0xE2, 0x5A, 0xE4, 0x67,
+    0x0E, 0xB0, 0xC4, 0x8A, 0x3D, 0x33, 0x24, 0x7D, 0x88, 0xE9, 0x76, 0x81, 0xCB, 0xAF, 0xF1, 0x79,
+    0xB4, 0x46, 0x5C, 0x50, 0x23, 0x19, 0x38, 0x93, 0xE5, 0xB4, 0x2C, 0x14, 0xD6, 0xA2, 0xC0, 0x23,
+    0xA1, 0x63, 0x14, 0xA9, 0xC4, 0x7D, 0x4A, 0x01, 0x74, 0xCD, 0xE8, 0x61, 0x41, 0xCE, 0x71, 0x8F,
+    0x4A, 0x06, 0x84, 0xB1, 0x85, 0xEA, 0xE5, 0x4E, 0x5B, 0x0E, 0xC8, 0x5D, 0x79, 0x52, 0x51, 0xEC,
+    0x24, 0xE5, 0xDE, 0x4F, 0x90, 0xC7, 0x41, 0xF1, 0xAF, 0xBA, 0xCB, 0x69, 0x27, 0x6F, 0x3C, 0xE9,
+    0xD9, 0x07, 0x62, 0xDE, 0x17, 0x51, 0xC3, 0xA2, 0xDA, 0x63, 0x3C, 0xBA, 0xCC, 0xCA, 0x10, 0x84,
+    0x54, 0xCD, 0xAB, 0x23, 0xA8, 0xBE, 0x70, 0x91, 0x9F, 0xDA, 0x68, 0xBA, 0x37, 0x50, 0xB0, 0x8A,
+    0x61, 0x6B, 0xB7, 0x4F, 0xB1, 0x34, 0x70, 0x92, 0x70, 0xE1, 0xA7, 0x2D, 0xD2, 0x66, 0x25, 0xDB,
+    0xA0, 0x88, 0xBD, 0x9A, 0x6E, 0xB1, 0x42, 0xBC, 0x6F, 0xB3, 0xB0, 0x1F, 0xFC, 0x87, 0x45, 0x3A,
+    0x25, 0x24, 0xE8, 0xE8, 0x86, 0xA4, 0xC9, 0x3F, 0x1E, 0xE2, 0x40, 0x4A, 0x77, 0x92, 0x61, 0x53,
+    0x5F, 0x2E, 0x99, 0x11, 0x36, 0x71, 0xA8, 0x1A, 0x1D, 0xAA, 0xC5, 0x4A, 0x82, 0xE2, 0x8D, 0xC8,
+    0xA7, 0x4F, 0x45, 0xB8, 0xA3, 0x9C, 0x56, 0x55, 0x67, 0x65, 0xC0, 0x89, 0xC2, 0x6B, 0x6A, 0xC4,
+    0x81, 0xA4, 0x95, 0xA2, 0xA1, 0x2A, 0x58, 0x23, 0x77, 0x1C, 0xA0, 0x6B, 0xA9, 0x22, 0xDA, 0x9A,
+    0x48, 0x40, 0x06, 0x78, 0xE7, 0xC2, 0x33, 0xE8, 0xE4, 0x12, 0xE9, 0x4B, 0x13, 0xE4, 0xE3, 0x2E,
+    0x52, 0xA3, 0x64, 0x2A, 0xED, 0x85, 0x5D, 0xF6, 0xA7, 0x17, 0x2E, 0x35, 0x24, 0x7A, 0x5B, 0x58,
+    0x6E, 0xC4, 0xBC, 0xD6, 0xBD, 0xEE, 0xD4, 0xA4, 0xA6, 0x97, 0x49, 0xC7, 0x53, 0x86, 0xC4, 0x6F,
+    0x5C, 0xF2, 0x77, 0xD5, 0xAA, 0x96, 0xC1, 0xB6, 0x30, 0x60, 0x9E, 0xEA, 0x3D, 0x4A, 0x96, 0x91,
+    0x32, 0x25, 0xCB, 0x3F, 0x63, 0xD6, 0xDA, 0x25, 0xF7, 0x80, 0x3E, 0xBF, 0xE3, 0x25, 0x69, 0xCE,
+    0x92, 0x4A, 0xE2, 0xC7, 0x25, 0xF2, 0x3E, 0xDB, 0x26, 0x21, 0x3A, 0x60, 0x27, 0x1C, 0x43, 0x45,
+    0x6C, 0x51, 0xD2, 0xDC, 0x49, 0xF5, 0xF8, 0xF0, 0x2F, 0xB5, 0xD9, 0x6E, 0xAA, 0xBF, 0x66, 0xD4,
+    0xF7, 0x67, 0xCC, 0x3E, 0x9F, 0xD1, 0xCC, 0xF2, 0x61, 0x1D, 0xF9, 0xC5, 0xED, 0x50, 0xF0, 0x12,
+    0xA1, 0x54, 0x52, 0x40, 0x25, 0xE1, 0xCB, 0xE1, 0xD1, 0x20, 0xD8, 0xA3, 0x44, 0x3E, 0x2C, 0x2B,
+    0xE7, 0x77, 0xFB, 0xC7, 0xF7, 0x52, 0x16, 0xB3, 0x46, 0xC1, 0x6B, 0xC0, 0x50, 0x66, 0xE4, 0x23,
+    0x22, 0x09, 0xCA, 0xB6, 0x15, 0x94, 0x3A, 0x23, 0x8E, 0xC6, 0x05, 0xFC, 0x8F, 0x3A, 0xC9, 0x79,
+    0xD0, 0x26, 0xE3, 0x61, 0x40, 0x79, 0xCE, 0xEA, 0x1C, 0x54, 0x48, 0x0A, 0x91, 0x22, 0xD1, 0xC7,
+    0x35, 0xD1, 0xC9, 0xBD, 0x71, 0xA7, 0xA4, 0x54, 0x92, 0x16, 0xAA, 0x45, 0xF8, 0x8D, 0x82, 0xD9,
+    0x1B, 0x5C, 0xEC, 0x24, 0x8D, 0x88, 0xDB, 0xF9, 0x84, 0x58, 0xCA, 0x69, 0xC7, 0x60, 0x29, 0xDE,
+    0x39, 0xAE, 0x6C, 0xD9, 0x14, 0x36, 0x40, 0x4D, 0x15, 0xAD, 0x68, 0x44, 0x21, 0xDF, 0xF7, 0xC7,
+    0xB8, 0x82, 0xB8, 0x94, 0x42, 0xEF, 0xF0, 0x23, 0xE9, 0xBB, 0x58, 0xB6, 0x6A, 0x55, 0xBE, 0x40,
+    0x2C, 0x5A, 0x2C, 0x16, 0x1F, 0x70, 0x21, 0x95, 0x1E, 0x56, 0xC1, 0x07, 0x52, 0xFA, 0xCA, 0x39,
+    0x75, 0xF1, 0xFA, 0xCB, 0xE2, 0x80, 0xB3, 0x1D, 0xB5, 0x7F, 0xFC, 0xCA, 0xD9, 0x85, 0xAC, 0xE5,
+    0xEC, 0x33, 0x9A, 0x79, 0x28, 0xC2, 0xC6, 0x05, 0xBE, 0x52, 0x25, 0x5A, 0x55, 0xC7, 0x8D, 0x78,
+    0x65, 0xDA, 0x0A, 0xEC, 0xF4, 0x97, 0x97, 0xFA, 0x4E, 0x50, 0xB2, 0x50, 0xBD, 0xAA, 0xB5, 0x43,
+    0xCB, 0xB0, 0x0F, 0xF7, 0x71, 0x73, 0xC5, 0xAC, 0x4B, 0x30, 0xBF, 0x9F, 0x14, 0x12, 0x34, 0x8B,
+    0x67, 0xCE, 0x0D, 0x4C, 0x87, 0x77, 0xE4, 0x83, 0x93, 0xCC, 0x9B, 0x6C, 0xC0, 0xCE, 0x54, 0x46,
+    0xD5, 0x53, 0xA9, 0x96, 0x82, 0xAD, 0x11, 0xB6, 0x6F, 0x23, 0x93, 0x8F, 0x4C, 0xD8, 0x15, 0x6C,
+    0xFB, 0x7C, 0x3E, 0xFA, 0x84, 0x49, 0xB1, 0x92, 0xA0, 0x2F, 0x71, 0xB8, 0x0B, 0xF4, 0x3C, 0xCF,
+    0xC8, 0x31, 0xAB, 0xC5, 0x37, 0x76, 0x9E, 0x42, 0x6C, 0x64, 0xCF, 0x6D, 0xF4, 0x2F, 0xD8, 0x08,
+    0xAE, 0xA5, 0x24, 0xDE, 0xA3, 0x0D, 0xE1, 0x65, 0xBE, 0xC1, 0xE1, 0xBB, 0x2F, 0xD9, 0xE8, 0xB6,
+    0x07, 0x76, 0x1E, 0x7E, 0xE6, 0xE2, 0x57, 0xDB, 0xFF, 0xD9, 0xE7, 0xC0, 0xEB, 0xE0, 0xFE, 0x9A,
+    0xAF, 0x7F, 0x00, 0xCD, 0x55, 0xBD, 0x6E, 0xDE, 0x36, 0x14, 0xBD, 0x94, 0x90, 0x0A, 0x88, 0x06,
+    0x76, 0x48, 0x96, 0x2E, 0x7C, 0x80, 0x02, 0xD5, 0x1B, 0x94, 0x42, 0x3C, 0x74, 0xAC, 0x87, 0xB6,
+    0x4B, 0x87, 0x3C, 0xC2, 0xD7, 0x07, 0x70, 0xAC, 0x2F, 0xCD, 0xD0, 0xB1, 0x79, 0x83, 0x64, 0xE9,
+    0x90, 0x2E, 0x7E, 0x01, 0x39, 0xA2, 0xED, 0x21, 0x43, 0x17, 0xB9, 0x19, 0x3A, 0x46, 0x01, 0x52,
+    0x64, 0x0C, 0xD1, 0x30, 0x08, 0xED, 0x50, 0xBC, 0x3D, 0x57, 0xB2, 0x11, 0x17, 0x0D, 0xDA, 0xA5,
+    0x43, 0x25, 0xD0, 0xB4, 0xF8, 0x91, 0xF7, 0x9E, 0x73, 0x7F, 0x0E, 0xD5, 0xF0, 0x82, 0x0C, 0xF3,
+    0xB6, 0x61, 0x9E, 0x30, 0xE2, 0x0D, 0x32, 0x89, 0x48, 0xCD, 0x44, 0xB4, 0x8F, 0x61, 0x31, 0xBA,
+    0x4F, 0x99, 0xB3, 0x65, 0x9E, 0xED, 0x4F, 0xB4, 0xF7, 0x19, 0x51, 0xD4, 0x54, 0xF8, 0x6A, 0x34,
+    0xA3, 0x66, 0x1E, 0xF5, 0x3B, 0x9E, 0x8C, 0x37, 0x53, 0xE3, 0x1B, 0x7F, 0x73, 0xF7, 0xE6, 0x2E,
+    0x51, 0x3D, 0xD6, 0x23, 0xC9, 0xD1, 0xAD, 0xDD, 0xCA, 0x9C, 0xF1, 0xE2, 0xA9, 0x52, 0x95, 0x64,
+    0x96, 0x8D, 0xF4, 0x6F, 0x4F, 0x99, 0xA8, 0x73, 0x75, 0xC4, 0x21, 0x1C, 0xB6, 0x8E, 0x74, 0x28,
+    0x63, 0x09, 0x4C, 0xDA, 0x6B, 0x78, 0x83, 0x91, 0xC9, 0x6E, 0x59, 0x7C, 0xB8, 0x8C, 0x5D, 0x80,
+    0x78, 0x2F, 0x61, 0x17, 0x11, 0xDF, 0x7E, 0x2D, 0xC8, 0x15, 0x77, 0xCF, 0xC4, 0x49, 0xC1, 0xCC,
+    0x8B, 0x39, 0x10, 0x5B, 0x30, 0x30, 0xCB, 0x2E, 0xD2, 0x3C, 0x2F, 0x6E, 0x1A, 0x5E, 0xA0, 0x28,
+    0x5E, 0x67, 0xB3, 0xCE, 0xF8, 0x5C, 0x66, 0x7C, 0xF2, 0x24, 0x46, 0xD7, 0x59, 0xF3, 0x90, 0x65,
+    0xE6, 0x33, 0x7E, 0x8D, 0x59, 0xF3, 0x13, 0xBC, 0x13, 0x71, 0x6A, 0xB8, 0xE6, 0x49, 0xF3, 0x38,
+    0x24, 0xCD, 0x13, 0xE7, 0x92, 0x83, 0x96, 0x7D, 0x49, 0x09, 0xDF, 0xCA, 0x57, 0x62, 0xAB, 0x19,
+    0x1B, 0x09, 0x0A, 0xB7, 0xDC, 0x02, 0x4E, 0x2E, 0xE7, 0x7F, 0xA4, 0xFF, 0xD1, 0xC3, 0x02, 0x2F,
+    0xE9, 0x51, 0xBB, 0xC6, 0x91, 0x71, 0x56, 0x4C, 0x59, 0x97, 0x34, 0xCC, 0xDA, 0x1D, 0x3F, 0x08,
+    0x63, 0x73, 0x12, 0x24, 0xB8, 0xDD, 0x12, 0xE4, 0x9C, 0xD3, 0x4A, 0x77, 0x5C, 0xD9, 0xAE, 0x64,
+    0xFD, 0xCA, 0x71, 0x7C, 0xFF, 0x53, 0xB3, 0x30, 0x29, 0x56, 0x42, 0xCD, 0x32, 0x15, 0xFC, 0x2C,
+    0x61, 0x6A, 0x52, 0xE7, 0x79, 0x2A, 0xF9, 0x14, 0xEF, 0x64, 0xE7, 0x9A, 0x6F, 0x61, 0x42, 0xFA,
+    0x67, 0x35, 0x57, 0xB1, 0x0E, 0xCD, 0xD4, 0x4C, 0xC3, 0x76, 0xD8, 0x5E, 0x05, 0x29, 0xE4, 0x39,
+    0x96, 0xE7, 0x07, 0x88, 0x6D, 0x09, 0x30, 0x95, 0x04, 0x09, 0xF1, 0xFD, 0x1C, 0x1E, 0x82, 0xFA,
+    0x7A, 0xD8, 0x6A, 0x0E, 0x64, 0xC5, 0x93, 0xA4, 0xAC, 0xBE, 0xF8, 0xB5, 0xC1, 0xD1, 0xC3, 0x96,
+    0xAA, 0x3F, 0x26, 0x1A, 0x7E, 0x41, 0x61, 0x01, 0x85, 0x1F, 0x80, 0x78, 0xC3, 0xF7, 0xF1, 0xBB,
+    0x3E, 0x42, 0xD8, 0x10, 0xAC, 0x93, 0xB9, 0x9C, 0xED, 0x64, 0xA7, 0x2B, 0xFE, 0x76, 0x91, 0x98,
+    0x40, 0x37, 0x0A, 0xF0, 0xD0, 0xF8, 0xFC, 0x0E, 0x26, 0xE1, 0x68, 0x24, 0x1B, 0xA8, 0x38, 0xD8,
+    0xAE, 0x86, 0xE1, 0x47, 0xB7, 0xA8, 0x4E, 0x09, 0x81, 0x65, 0x57, 0x2C, 0xA4, 0x25, 0x20, 0x1E,
+    0xF5, 0xDB, 0x92, 0x02, 0xCA, 0x0E, 0x70, 0x1C, 0xD2, 0x42, 0x05, 0x42, 0x86, 0x48, 0xEA, 0x33,
+    0xA4, 0x25, 0x49, 0xA2, 0xF0, 0x3F, 0xCC, 0xA4, 0x05, 0xA6, 0x4A, 0x95, 0xB3, 0x47, 0x2C, 0xC9,
+    0xE5, 0xB6, 0x43, 0x24, 0xBB, 0x70, 0x59, 0x9A, 0x57, 0x8D, 0xD9, 0x16, 0x49, 0xA2, 0x32, 0x4A,
+    0x95, 0x53, 0xB7, 0x45, 0x9D, 0xC2, 0x58, 0xA0, 0x6B, 0x1B, 0x09, 0x6F, 0x7B, 0x69, 0x0C, 0xA5,
+    0x00, 0x9F, 0x87, 0x95, 0x18, 0xBB, 0xCB, 0x1C, 0x4A, 0x94, 0x9F, 0x7A, 0x24, 0x95, 0xF6, 0x15,
+    0x20, 0x48, 0xB6, 0xEC, 0x9A, 0x9E, 0xBF, 0x3C, 0x6A, 0x97, 0xD6, 0x46, 0xBC, 0xFE, 0xB0, 0x6B,
+    0xA9, 0x4E, 0x06, 0x8E, 0xB8, 0x8A, 0x48, 0x98, 0xCB, 0xE2, 0x05, 0x89, 0x1F, 0x66, 0xED, 0x71,
+    0x76, 0x27, 0x91, 0x79, 0x35, 0x31, 0xE9, 0xB7, 0xD1, 0xBA, 0x2A, 0x66, 0xED, 0xCB, 0xD4, 0x9D,
+    0x24, 0x95, 0x8D, 0x67, 0x62, 0xB8, 0x1D, 0xBB, 0xBB, 0x5C, 0x07, 0xEB, 0xBA, 0xE3, 0xD9, 0xA0,
+    0x7F, 0x86, 0x1F, 0x7D, 0x35, 0x37, 0x2F, 0xA3, 0xE2, 0x2F, 0xCE, 0xD1, 0x68, 0xA7, 0x40, 0x60,
+    0x62, 0xC7, 0x6D, 0x95, 0x0D, 0x3B, 0xC5, 0xF7, 0x80, 0x05, 0xC5, 0xE0, 0x17, 0x25, 0xA0, 0xF6,
+    0x3A, 0x08, 0xA3, 0xD3, 0xFD, 0xB5, 0xF6, 0x3D, 0xB6, 0x8F, 0x31, 0x7A, 0xF0, 0xEE, 0xA9, 0xC6,
+    0xD0, 0xA9, 0x27, 0xBB, 0xD7, 0xD3, 0x1D, 0x8C, 0xB8, 0xD7, 0x17, 0xBE, 0xEF, 0xAB, 0xB1, 0xEF,
+    0xB5, 0xEB, 0xFB, 0x86, 0xFA, 0x7E, 0x9F, 0x52, 0x9F, 0x28, 0x3D, 0x0E, 0x94, 0x86, 0x09, 0xC3,
+    0x61, 0xB4, 0x94, 0x8A, 0x50, 0x04, 0x89, 0xDB, 0x2C, 0x52, 0x81, 0xD8, 0x19, 0x11, 0x86, 0x3A,
+    0xD5, 0xE9, 0x6F, 0xED, 0xD0, 0x2D, 0xCD, 0x39, 0x22, 0xFF, 0x15, 0x4E, 0x0C, 0x47, 0x72, 0xC2,
+    0x83, 0x7E, 0x23, 0x0D, 0xA1, 0x79, 0x27, 0x52, 0xCD, 0x23, 0x23, 0x3A, 0xA0, 0x58, 0x64, 0xD0,
+    0x27, 0x86, 0x20, 0xD0, 0x70, 0x1B, 0x31, 0xB1, 0x4F, 0xA0, 0x0C, 0xE6, 0x39, 0xEB, 0xA0, 0x3D,
+    0xE8, 0x57, 0x11, 0xF4, 0x77, 0x20, 0x45, 0xCD, 0x69, 0x56, 0x5C, 0x47, 0xA6, 0xEE, 0xD7, 0xDC,
+    0x6D, 0x4D, 0xE8, 0x06, 0x57, 0xCD, 0x86, 0x27, 0xC5, 0x3F, 0x20, 0x81, 0xDD, 0x73, 0x94, 0x84,
+    0x89, 0x76, 0x46, 0x17, 0x69, 0x86, 0x63, 0x27, 0xBD, 0xA8, 0xA1, 0x79, 0x88, 0xDF, 0x28, 0xCD,
+    0x20, 0xEF, 0x7F, 0x19, 0x0D, 0xAA, 0x9D, 0x54, 0x8A, 0x6D, 0x51, 0x52, 0x2A, 0x4B, 0xDA, 0xEB,
+    0x28, 0xD2, 0x06, 0xA2, 0x1F, 0x92, 0x4B, 0x35, 0x9C, 0x49, 0x60, 0x20, 0xDC, 0xE0, 0xFE, 0x0A,
+    0x09, 0x13, 0xE4, 0x63, 0x8D, 0x63, 0xEC, 0x2C, 0x4A, 0x89, 0xBF, 0xCF, 0x22, 0x64, 0x08, 0x05,
+    0xA1, 0x91, 0x60, 0xB8, 0x7A, 0x23, 0x92, 0xA3, 0x5F, 0x8A, 0x31, 0xFB, 0x40, 0x54, 0x70, 0x90,
+    0xB0, 0x16, 0xB3, 0x84, 0xBB, 0xBE, 0x58, 0x96, 0x1A, 0xCC, 0xB2, 0xBB, 0x0E, 0x22, 0x94, 0xC3,
+    0x31, 0xBF, 0x51, 0x1B, 0x2E, 0x45, 0x00, 0x63, 0x2D, 0x7F, 0x1D, 0x0A, 0x81, 0x33, 0xE9, 0x45,
+    0x39, 0xB0, 0x32, 0x0B, 0x92, 0x7C, 0x59, 0x18, 0xA2, 0xFC, 0xA2, 0xFA, 0x50, 0x7C, 0x51, 0xFB,
+    0x0F, 0x28, 0xBD, 0x1A, 0xD0, 0xAF, 0x68, 0x80, 0x58, 0x79, 0xD3, 0x96, 0x3E, 0x51, 0xF5, 0xDB,
+    0x48, 0xFA, 0x01, 0x7C, 0xF7, 0xF0, 0xEC, 0xA9, 0x7C, 0x2B, 0x9F, 0x0E, 0x20, 0xCE, 0x0F, 0x82,
+    0xB0, 0x43, 0x07, 0x92, 0xF4, 0xC6, 0x26, 0x88, 0x6C, 0xBD, 0x20, 0x71, 0x3A, 0x8A, 0x32, 0xCF,
+    0xA4, 0xF3, 0x37, 0xB8, 0x7E, 0xE4, 0x8E, 0x40, 0x53, 0x50, 0x77, 0x4B, 0x7A, 0xCD, 0x0B, 0xEB,
+    0x24, 0x92, 0xD8, 0x7D, 0xF9, 0x0E, 0x20, 0x9F, 0x0A, 0xE8, 0x20, 0x8B, 0xF3, 0xBA, 0x08, 0x40,
+    0xF6, 0x38, 0x8B, 0x22, 0xA1, 0xA1, 0x37, 0x51, 0x88, 0x24, 0xB5, 0x70, 0x12, 0x35, 0xBC, 0xB8,
+    0x30, 0xCC, 0x72, 0x3D, 0x7C, 0x72, 0x5F, 0x04, 0xF3, 0x4C, 0xD6, 0xB6, 0x75, 0x3E, 0xF0, 0xC6,
+    0x15, 0x01, 0xD7, 0x61, 0x82, 0xBC, 0x1D, 0xDE, 0xC1, 0xED, 0x88, 0xC6, 0xCD, 0xC3, 0xCF, 0x8F,
+    0x1E, 0xE3, 0x9A, 0xDC, 0xC7, 0xFA, 0x6C, 0x7F, 0xFF, 0x36, 0x01, 0x58, 0x00, 0x42, 0xAF, 0x24,
+    0x31, 0x4D, 0xA4, 0xFF, 0xFF, 0xF3, 0x27, 0xC5, 0x55, 0xBD, 0x8E, 0xDD, 0x44, 0x18, 0x3D, 0xB6,
+    0x95, 0xB8, 0x70, 0x31, 0x29, 0x76, 0x9B, 0x34, 0x43, 0x8D, 0x04, 0x7E, 0x81, 0xB0, 0x63, 0x41,
+    0x41, 0xC9, 0x82, 0x08, 0x4D, 0x1A, 0x5A, 0x68, 0x6E, 0x93, 0x92, 0xBD, 0xB6, 0xC4, 0x03, 0x90,
+    0x37, 0x08, 0x05, 0x42, 0x90, 0x26, 0x14, 0x94, 0xBB, 0x78, 0x44, 0x1E, 0x00, 0x23, 0x4A, 0x0A,
+    0x2C, 0x11, 0x04, 0x12, 0x45, 0xA6, 0x70, 0x31, 0x49, 0x7C, 0x3D, 0x9C, 0xE3, 0xBB, 0x51, 0xB2,
+    0x22, 0x91, 0x96, 0x0A, 0x8F, 0x67, 0xEE, 0x9D, 0xDF, 0x73, 0xBE, 0xF3, 0x7D, 0xF3, 0x19, 0x0E,
+    0x47, 0x80, 0xF5, 0xD6, 0xA3, 0x9A, 0xAA, 0x80, 0x62, 0x57, 0xEC, 0x80, 0xD4, 0xA5, 0x0E, 0x97,
+    0x7A, 0xF2, 0xF4, 0x10, 0xA8, 0x52, 0x1A, 0x60, 0x53, 0xDA, 0xC1, 0x2C, 0x1F, 0xA5, 0xC1, 0x44,
+    0x94, 0x73, 0x19, 0x81, 0xF6, 0xED, 0x19, 0x30, 0x61, 0x01, 0xB2, 0xD9, 0xF1, 0xC0, 0xF6, 0xBD,
+    0xA7, 0x29, 0xA5, 0x5F, 0x58, 0xD3, 0xA4, 0xC1, 0xDD, 0x7E, 0x30, 0x00, 0xEE, 0x47, 0xF6, 0x6D,
+    0x68, 0x27, 0x6C, 0xA2, 0xE1, 0xF4, 0x9C, 0xB1, 0x59, 0x50, 0xB3, 0x25, 0x04, 0x1B, 0x1E, 0x4F,
+    0x5E, 0xB8, 0x7E, 0x87, 0x68, 0x43, 0x35, 0x98, 0x51, 0xC5, 0x8E, 0x36, 0xD8, 0x50, 0xB3, 0xBC,
+    0x92, 0x5F, 0xFD, 0x58, 0xFB, 0xBB, 0x6A, 0xB9, 0x1F, 0xAC, 0xCF, 0x27, 0x07, 0xCC, 0xB4, 0xF7,
+    0xEC, 0x04, 0xD8, 0xF6, 0x44, 0xE8, 0xEF, 0x7D, 0xFB, 0xC3, 0x96, 0xFF, 0x39, 0xBE, 0x73, 0x7F,
+    0xDC, 0x9A, 0x69, 0xC4, 0x44, 0x6B, 0x02, 0xE1, 0x3B, 0xD4, 0x11, 0xB6, 0xB3, 0xFC, 0xF5, 0xB5,
+    0x87, 0xF3, 0x8E, 0xCD, 0xB0, 0x36, 0xED, 0xF0, 0x72, 0xB0, 0xAB, 0x89, 0xF4, 0x5A, 0x12, 0xCD,
+    0x96, 0xAC, 0xEF, 0xCA, 0x00, 0x92, 0xF4, 0x28, 0xA6, 0xBA, 0xA3, 0x00, 0xD7, 0xB9, 0x60, 0xD6,
+    0xAA, 0x33, 0x35, 0x5B, 0x14, 0x32, 0xEB, 0x79, 0xC3, 0xA7, 0x55, 0xD3, 0xAB, 0x59, 0x3E, 0xBD,
+    0x83, 0x72, 0x69, 0x97, 0xAF, 0xFB, 0x9D, 0x93, 0x1A, 0xD2, 0x61, 0xD5, 0x25, 0x68, 0x6D, 0x87,
+    0x4D, 0xFA, 0x6B, 0x8F, 0x68, 0x9B, 0xBA, 0x71, 0x1D, 0x8B, 0x57, 0x69, 0x59, 0x7A, 0xFF, 0x22,
+    0xA3, 0xAC, 0x7F, 0x08, 0xFB, 0x34, 0x35, 0x6F, 0xC0, 0x0E, 0xD7, 0x50, 0x50, 0xA7, 0x2C, 0x9E,
+    0xF3, 0xA0, 0xB3, 0xD2, 0xBE, 0xEA, 0x3F, 0x09, 0x1E, 0xA0, 0x88, 0x6F, 0x1E, 0x6F, 0x02, 0xC1,
+    0x06, 0xEA, 0xD0, 0x68, 0x2F, 0x9F, 0x6B, 0x57, 0xFB, 0x34, 0x11, 0x3B, 0x5E, 0x39, 0xBE, 0x68,
+    0xED, 0x37, 0xC0, 0x27, 0xD4, 0xEE, 0x54, 0x9A, 0xDA, 0x2E, 0x9B, 0xCD, 0x90, 0xC7, 0x32, 0x14,
+    0x13, 0x4B, 0xC8, 0x66, 0xC6, 0xD2, 0x62, 0x46, 0xB4, 0x66, 0x80, 0xFB, 0xCD, 0xD3, 0x7D, 0x9E,
+    0x58, 0x1D, 0xCA, 0xD4, 0xD0, 0x5E, 0xC5, 0x0D, 0x21, 0xE9, 0xF3, 0x9C, 0xD0, 0x25, 0xE9, 0x50,
+    0xEB, 0x3A, 0x05, 0x38, 0x2E, 0x73, 0x1C, 0x76, 0xE3, 0xCA, 0xFE, 0x98, 0xE6, 0x46, 0xFA, 0x23,
+    0xBE, 0xCA, 0xBD, 0xC4, 0x77, 0xC4, 0xDF, 0xD2, 0x4B, 0x67, 0x44, 0x9A, 0xA9, 0xF9, 0x5C, 0x4C,
+    0x79, 0xCC, 0xD8, 0x62, 0xA1, 0xBD, 0xED, 0xBB, 0x3C, 0xF4, 0xA7, 0x11, 0xF6, 0xD1, 0x48, 0xFC,
+    0x81, 0xF8, 0x74, 0x08, 0x6B, 0xA6, 0x00, 0x27, 0x17, 0x88, 0x07, 0x6B, 0x49, 0x1E, 0x9B, 0x79,
+    0xE5, 0x50, 0x73, 0xBA, 0x26, 0x87, 0x5A, 0xB1, 0x36, 0x56, 0xA3, 0x09, 0xCF, 0x8A, 0x5D, 0xCB,
+    0x8B, 0xF8, 0x1F, 0x02, 0x07, 0xF4, 0xE7, 0x99, 0x34, 0xA0, 0x97, 0x67, 0xE3, 0xF3, 0x58, 0x9D,
+    0x6B, 0x90, 0x8B, 0x8D, 0x34, 0xE8, 0xCF, 0x35, 0xA8, 0xCF, 0x35, 0xA8, 0x2E, 0xAF, 0x41, 0x39,
+    0x96, 0x63, 0x15, 0x54, 0x88, 0x3F, 0xED, 0xCB, 0xFF, 0xA5, 0x05, 0x4A, 0x6E, 0x19, 0xF2, 0x09,
+    0x7C, 0x77, 0x8A, 0x99, 0xB6, 0xE1, 0x7B, 0xD8, 0x80, 0xEF, 0xCB, 0x9F, 0x53, 0xE0, 0x84, 0x26,
+    0xA0, 0xA2, 0x41, 0x0A, 0xBA, 0x4C, 0x17, 0x0A, 0x8A, 0x13, 0x05, 0xBB, 0xA3, 0x0A, 0x51, 0x21,
+    0x69, 0xBD, 0x82, 0x5E, 0x4A, 0xA1, 0x9C, 0x14, 0x8E, 0x12, 0x8B, 0x4C, 0x14, 0xA5, 0x66, 0x4D,
+    0x44, 0xAD, 0x8C, 0x2E, 0xD6, 0x4B, 0xB2, 0xDE, 0x75, 0xA9, 0xC6, 0x65, 0xBA, 0x86, 0x12, 0x8E,
+    0x4A, 0x72, 0x95, 0xF8, 0x72, 0x91, 0xFA, 0x92, 0x0F, 0xC5, 0xF2, 0x9C, 0x49, 0x35, 0xF0, 0xA5,
+    0x28, 0x66, 0xB0, 0xCC, 0x54, 0x43, 0x3D, 0xA0, 0x1E, 0x2E, 0x95, 0xDF, 0xC4, 0xD7, 0x93, 0x24,
+    0xAD, 0xD8, 0xCA, 0x70, 0x09, 0xCB, 0xBB, 0x22, 0x7B, 0x5C, 0x43, 0x8F, 0x97, 0x81, 0x23, 0xAB,
+    0xBA, 0xB0, 0x3F, 0x13, 0xBA, 0x98, 0x85, 0xDA, 0xF6, 0x1D, 0x56, 0x89, 0x69, 0x85, 0xF8, 0x3A,
+    0x91, 0x2A, 0x57, 0x3E, 0xD2, 0x99, 0xC9, 0x44, 0x47, 0x6B, 0xC6, 0xCA, 0x32, 0x8A, 0xCD, 0xA0,
+    0x98, 0x65, 0x87, 0x16, 0xF6, 0x0A, 0xF7, 0x55, 0x71, 0xE3, 0x8D, 0x6F, 0x9B, 0x36, 0xDF, 0xE5,
+    0x3B, 0x13, 0xCD, 0xE4, 0xC6, 0xFD, 0xBD, 0x38, 0x7F, 0x0E, 0x80, 0x0F, 0x98, 0xB1, 0x7F, 0x65,
+    0x54, 0x6D, 0x80, 0xB7, 0xA8, 0xF6, 0x13, 0x76, 0xFF, 0xE6, 0x65, 0xBB, 0xCF, 0x30, 0x38, 0x45,
+    0xC6, 0x6E, 0xC5, 0xAE, 0xBB, 0xDB, 0xE5, 0x8B, 0xEB, 0xEA, 0xA8, 0x04, 0x92, 0xD2, 0x23, 0x9F,
+    0x62, 0x8B, 0xC3, 0x5C, 0xA0, 0xA4, 0xC0, 0xDC, 0xA6, 0xA4, 0xB3, 0xEF, 0x32, 0xDF, 0xBD, 0x33,
+    0x17, 0x91, 0xC9, 0xE4, 0xC1, 0x5C, 0xCC, 0xCA, 0x27, 0x17, 0xE5, 0x78, 0x0D, 0x1F, 0x97, 0x4D,
+    0x85, 0xDB, 0xF8, 0x8E, 0x3F, 0xCD, 0x6D, 0x7C, 0xBF, 0xFF, 0x99, 0x4A, 0x6F, 0x9B, 0xA3, 0x5B,
+    0x13, 0x53, 0x6D, 0x53, 0x46, 0x9A, 0x64, 0x68, 0x25, 0xAD, 0x30, 0x94, 0x21, 0x1E, 0xDE, 0xBC,
+    0xF9, 0x3E, 0x91, 0xFF, 0x64, 0xBD, 0xEB, 0xD7, 0x2C, 0x47, 0xFD, 0x28, 0x9C, 0x1C, 0xFF, 0xEF,
+    0x6E, 0xB3, 0x5E, 0x87, 0x8A, 0x67, 0xC8, 0x43, 0x3D, 0xBB, 0x94, 0xAD, 0xE2, 0x59, 0x35, 0x4D,
+    0xEF, 0x07, 0x4A, 0xC4, 0x55, 0x86, 0x54, 0x6E, 0xB0, 0x72, 0x53, 0x4E, 0x88, 0xD7, 0xEF, 0x7D,
+    0x95, 0xD2, 0xEF, 0x5E, 0xC3, 0x37, 0x34, 0x58, 0x78, 0x11, 0x38, 0x41, 0x36, 0x29, 0x66, 0x6D,
+    0x43, 0xD7, 0x31, 0xF4, 0xF4, 0x45, 0xFA, 0x52, 0xEB, 0xAF, 0xC8, 0x03, 0x8D, 0x93, 0x23, 0x16,
+    0x45, 0x32, 0x67, 0xCA, 0x55, 0xF2, 0x20, 0x0C, 0xF4, 0x5D, 0x7F, 0xC9, 0x8F, 0x9F, 0xDC, 0x2B,
+    0x13, 0xE9, 0xF5, 0x23, 0xF5, 0x4C, 0x58, 0x13, 0x95, 0xFB, 0x7C, 0xF5, 0xD2, 0xB2, 0x9F, 0x8A,
+    0xFB, 0xA9, 0xF1, 0xE2, 0x54, 0x7A, 0xAC, 0x5D, 0x4C, 0xEE, 0xCD, 0xBA, 0x8B, 0x2A, 0xB8, 0x07,
+    0x41, 0x51, 0x95, 0xF8, 0xC5, 0xF8, 0x4C, 0x53, 0x00, 0xA3, 0x2D, 0xCC, 0x28, 0x86, 0x75, 0x8A,
+    0x56, 0x70, 0x8A, 0x5E, 0x2A, 0xF4, 0x49, 0x60, 0x7F, 0x4A, 0xDA, 0xDC, 0xF2, 0x6B, 0x3A, 0x91,
+    0xC6, 0x17, 0xE9, 0xC9, 0xB3, 0x08, 0xFB, 0x4F, 0xCF, 0x3F, 0xB5, 0x55, 0x3D, 0x8C, 0xDD, 0x44,
+    0x10, 0x1E, 0x7B, 0xC5, 0x39, 0xB9, 0x2D, 0x96, 0x26, 0x05, 0x05, 0x38, 0x74, 0x08, 0x41, 0x7C,
+    0x52, 0x4A, 0x5E, 0xDE, 0x5A, 0x3A, 0x45, 0xA4, 0x0A, 0x0D, 0x48, 0x74, 0x69, 0xA8, 0x50, 0xA4,
+    0xB4, 0x14, 0xEF, 0xB0, 0x95, 0x48, 0xD0, 0x46, 0x48, 0x50, 0x50, 0x5D, 0x7D, 0x55, 0x8A, 0x14,
+    0x14, 0xF7, 0xF0, 0x86, 0x2B, 0xD3, 0x58, 0xA1, 0xA4, 0x71, 0xA4, 0x74, 0x14, 0x6C, 0xE1, 0xC2,
+    0xA7, 0xAC, 0x3D, 0x7C, 0xB3, 0xBE, 0xBF, 0xC0, 0x5D, 0x14, 0x0A, 0xD6, 0x9E, 0x99, 0xDD, 0xD9,
+    0x9D, 0x9F, 0x9D, 0x9D, 0x9D, 0xA5, 0x35, 0xAD, 0x89, 0x26, 0x7C, 0x34, 0x25, 0x13, 0x25, 0x9C,
+    0x30, 0xA5, 0x9C, 0x32, 0x5D, 0xD8, 0x7E, 0x05, 0x2C, 0x4E, 0xD0, 0xEA, 0xDB, 0x57, 0x51, 0xC5,
+    0x2F, 0x80, 0xF6, 0x1A, 0x5A, 0x2D, 0x49, 0x3B, 0x20, 0xD5, 0xEE, 0x58, 0x4A, 0x3B, 0x20, 0xD5,
+    0xAD, 0x2D, 0xE5, 0xED, 0xDA, 0x32, 0x3B, 0x41, 0x25, 0xD0, 0x0B, 0x5A, 0x6F, 0xD6, 0x44, 0x1B,
+    0x0F, 0x29, 0xF3, 0x44, 0xB9, 0x23, 0x35, 0x10, 0xD9, 0x92, 0x68, 0x24, 0x6A, 0x48, 0x20, 0x09,
+    0x20, 0xB6, 0x16, 0x3E, 0x84, 0x0D, 0x56, 0x91, 0xF1, 0x45, 0x0B, 0xA2, 0x42, 0x05, 0x51, 0x4A,
+    0xA7, 0xD9, 0x59, 0x1E, 0x23, 0xA9, 0x86, 0x48, 0x0A, 0x1F, 0x89, 0xED, 0xE7, 0x39, 0x51, 0x82,
+    0x7D, 0xC5, 0x95, 0xD9, 0xC4, 0xA5, 0x68, 0x09, 0x8D, 0x93, 0x85, 0xBD, 0x95, 0xA5, 0x55, 0x97,
+    0x8B, 0x20, 0x3B, 0x03, 0x35, 0x8A, 0x4B, 0xFC, 0xA4, 0x27, 0x88, 0xBC, 0x6C, 0x73, 0x08, 0x33,
+    0xF7, 0xA2, 0xAA, 0x9A, 0x15, 0x59, 0x8E, 0x6A, 0xF5, 0x54, 0x9E, 0x0D, 0x8C, 0x29, 0x69, 0x45,
+    0x99, 0xA3, 0x9E, 0x52, 0x9F, 0x42, 0xE7, 0x80, 0x3E, 0xED, 0x83, 0x4B, 0xD6, 0x8A, 0xF3, 0x22,
+    0xAA, 0xC5, 0x88, 0xF2, 0xC7, 0xBD, 0x5C, 0x7C, 0xB6, 0x15, 0xD0, 0x54, 0x38, 0x4A, 0x83, 0xE9,
+    0x28, 0xEB, 0xB3, 0xE1, 0x6D, 0xD3, 0xA5, 0x30, 0xE8, 0x66, 0xBF, 0xAB, 0x2E, 0xAA, 0x6F, 0x98,
+    0x9F, 0x32, 0x07, 0x10, 0xF7, 0x6A, 0x97, 0xA7, 0x53, 0xF4, 0xF5, 0x1E, 0x1A, 0x3A, 0xFC, 0x52,
+    0x90, 0x84, 0x87, 0x22, 0x6B, 0x6F, 0xEF, 0x1E, 0xC7, 0xF6, 0xC7, 0x4C, 0xFA, 0x23, 0x9F, 0x5F,
+    0x3B, 0xF9, 0x11, 0xBD, 0xBB, 0xA0, 0x6B, 0x0B, 0xFA, 0xF8, 0xBC, 0xFF, 0xC6, 0x82, 0x16, 0x2B,
+    0x5A, 0x7C, 0x73, 0xDE, 0xFF, 0x4B, 0xFC, 0x1F, 0x9F, 0xF9, 0xC5, 0x39, 0xFE, 0xEB, 0xC4, 0xB1,
+    0xF0, 0x8F, 0x9C, 0xD2, 0xC2, 0x9C, 0xA2, 0xF1, 0xB8, 0xD2, 0x55, 0xAD, 0xED, 0x6C, 0x57, 0xF8,
+    0xDC, 0x1B, 0xAF, 0x87, 0x2C, 0xC8, 0x71, 0x99, 0xC1, 0xF4, 0x06, 0xE3, 0xA2, 0xB3, 0x6D, 0xE5,
+    0x62, 0xC4, 0x23, 0x2F, 0xC7, 0xAA, 0x63, 0xDE, 0xBF, 0xE5, 0xAA, 0x67, 0x5C, 0xF2, 0xF7, 0xA3,
+    0x9A, 0xCC, 0xA0, 0x43, 0xD1, 0xE5, 0xBE, 0xAA, 0xAD, 0x63, 0x6A, 0x1E, 0x8C, 0x09, 0xEB, 0x30,
+    0x6B, 0xB1, 0xDE, 0x76, 0x5C, 0xF3, 0xF6, 0xA8, 0x82, 0x08, 0x56, 0xAE, 0xB9, 0x3F, 0xA9, 0x51,
+    0x34, 0xCF, 0x76, 0xCE, 0xB3, 0x64, 0x9F, 0x43, 0xE2, 0x00, 0x37, 0x45, 0x87, 0x2C, 0x4A, 0x59,
+    0x67, 0x5B, 0x2E, 0x9B, 0xDF, 0x26, 0xE2, 0x6C, 0xDE, 0xDF, 0x86, 0x5C, 0x08, 0xA2, 0x04, 0xC7,
+    0x2D, 0xA9, 0x90, 0xBF, 0x76, 0x78, 0x8F, 0x7D, 0x3C, 0x81, 0xC3, 0x2F, 0x48, 0x61, 0x68, 0xE4,
+    0x82, 0x01, 0x30, 0xAB, 0xDA, 0x98, 0x5B, 0x74, 0x03, 0xC3, 0xFE, 0xBF, 0x0C, 0x1F, 0x03, 0x30,
+    0x4C, 0x30, 0x4C, 0xD0, 0x7D, 0x6B, 0xCE, 0xD1, 0x37, 0x86, 0x3B, 0x48, 0x41, 0xE6, 0xA1, 0xE2,
+    0x1F, 0x3F, 0x3F, 0xE5, 0xD7, 0x17, 0xC0, 0x4F, 0x65, 0x8E, 0x63, 0x93, 0xAB, 0x7D, 0xE5, 0x4E,
+    0x7D, 0xF1, 0x3A, 0x0D, 0x50, 0x80, 0x54, 0xE2, 0x1A, 0xD3, 0x13, 0x25, 0x87, 0x07, 0x5C, 0xAC,
+    0x89, 0x0A, 0x08, 0x1B, 0x66, 0xAF, 0x90, 0x1F, 0x60, 0x22, 0x96, 0xCC, 0xAD, 0x78, 0x00, 0xE6,
+    0x04, 0x26, 0x3F, 0x01, 0x78, 0x30, 0x03, 0x98, 0xFC, 0x19, 0xE0, 0x77, 0xC0, 0xA1, 0xE4, 0x8B,
+    0xA4, 0x31, 0xBC, 0xFB, 0x0A, 0xC5, 0xA9, 0xE9, 0x9A, 0xD0, 0xF4, 0x4D, 0x29, 0x9B, 0xCF, 0xB7,
+    0x07, 0x7B, 0x10, 0x2A, 0x77, 0x42, 0xCB, 0x64, 0xA0, 0x62, 0x1B, 0xE0, 0xD4, 0x60, 0x9D, 0x0A,
+    0x04, 0x36, 0xD9, 0x36, 0xC3, 0x9C, 0x1A, 0xA9, 0x71, 0xEB, 0xF5, 0xFA, 0x38, 0x25, 0x17, 0x97,
+    0x6B, 0x32, 0xE9, 0x4D, 0x4A, 0xBA, 0xAD, 0x2D, 0x5A, 0xA8, 0xEB, 0x70, 0xFD, 0xFA, 0x16, 0x79,
+    0xF5, 0x29, 0x42, 0x6B, 0x3B, 0x9C, 0xD8, 0x20, 0xE1, 0xA6, 0x6B, 0x72, 0x9F, 0x65, 0x33, 0xF1,
+    0x3A, 0xD3, 0x7C, 0x00, 0xB4, 0x7F, 0x14, 0x6A, 0xE5, 0x81, 0x76, 0xDE, 0xBF, 0x54, 0x9A, 0xEF,
+    0x6E, 0xFD, 0x90, 0xFA, 0x2F, 0x7F, 0xBE, 0xBA, 0xDC, 0x78, 0xE7, 0xBE, 0x71, 0x9F, 0xDC, 0x7E,
+    0xDE, 0x27, 0xDD, 0xEA, 0xCA, 0x69, 0x6A, 0x9D, 0x4D, 0xEC, 0x37, 0x49, 0xC8, 0x58, 0xCF, 0x4A,
+    0x55, 0x5E, 0x46, 0xD1, 0x2C, 0xEA, 0x8A, 0xC6, 0x24, 0xA8, 0x3E, 0xEB, 0x8C, 0x2B, 0x4A, 0x4B,
+    0x3B, 0x34, 0xA4, 0x5E, 0x75, 0xDA, 0x99, 0xF2, 0xBD, 0x98, 0x45, 0x73, 0xDB, 0x24, 0xD4, 0x5F,
+    0xA7, 0x5B, 0xD4, 0x9F, 0x9E, 0xEE, 0xCE, 0xBC, 0x5D, 0x30, 0x55, 0x9F, 0x0C, 0xC2, 0x5F, 0xA3,
+    0x8B, 0x29, 0x53, 0x6E, 0xB8, 0xBB, 0xA7, 0x56, 0x3E, 0xA0, 0x47, 0xF4, 0x50, 0x79, 0xD3, 0x1A,
+    0xA7, 0x3B, 0x31, 0xA6, 0xDB, 0xBC, 0xB6, 0x04, 0x4B, 0xB4, 0xC4, 0x26, 0x97, 0xB0, 0x96, 0xA3,
+    0x54, 0xAC, 0x8E, 0xE3, 0x26, 0x45, 0x3B, 0xFD, 0xB3, 0xD6, 0x07, 0xDE, 0x4A, 0x15, 0x27, 0x4D,
+    0x05, 0x8D, 0xCA, 0xE7, 0x6E, 0x89, 0x09, 0xEB, 0x8C, 0x47, 0xD8, 0x47, 0x08, 0x5C, 0x82, 0x71,
+    0x04, 0x0A, 0x9A, 0xDA, 0xB4, 0xC7, 0x23, 0x34, 0xA9, 0x10, 0x2F, 0x11, 0x34, 0x5C, 0x8D, 0x71,
+    0x91, 0x9D, 0x7E, 0x58, 0x63, 0xED, 0xE6, 0x6E, 0x3A, 0x51, 0xDE, 0x41, 0x4E, 0x0F, 0xE8, 0xA1,
+    0x32, 0xDB, 0x56, 0x22, 0x44, 0xD2, 0x35, 0xB8, 0x6B, 0xD9, 0x48, 0xF1, 0xC5, 0x42, 0xD1, 0x8F,
+    0x35, 0x9D, 0x5D, 0x2E, 0x67, 0xA3, 0x38, 0x9B, 0x44, 0x53, 0x7E, 0xC8, 0x4E, 0xDE, 0x91, 0x06,
+    0xB9, 0xE5, 0x71, 0xF4, 0x78, 0x29, 0xAA, 0xED, 0x40, 0x86, 0xCB, 0xAC, 0xB7, 0x2D, 0xA1, 0xDE,
+    0xA1, 0x1A, 0xA0, 0xA8, 0xB7, 0x06, 0x87, 0x68, 0xE6, 0x47, 0x42, 0x1D, 0x15, 0xA9, 0xA6, 0x67,
+    0xA9, 0xD6, 0xC5, 0x94, 0x41, 0x07, 0xEA, 0x54, 0x9D, 0xB3, 0x3C, 0x24, 0x30, 0x84, 0x69, 0x80,
+    0x42, 0xB7, 0x10, 0x37, 0xB8, 0xD6, 0xC8, 0xD6, 0xD2, 0x4E, 0x09, 0x0F, 0x08, 0x28, 0x4B, 0x3E,
+    0x54, 0x73, 0x86, 0xEB, 0xF9, 0x49, 0xA2, 0x26, 0x0E, 0x77, 0x35, 0x22, 0xB7, 0x8F, 0x80, 0x62,
+    0xAB, 0x21, 0x92, 0x24, 0x64, 0x08, 0x4F, 0x93, 0x06, 0x0D, 0xEF, 0x58, 0x81, 0x88, 0x50, 0x8F,
+    0x14, 0x78, 0xC0, 0x79, 0x68, 0x3C, 0xFD, 0x8F, 0xED, 0x6F, 0xD5, 0x55, 0xBF, 0x6F, 0xE4, 0x44,
+    0x14, 0x7E, 0xF6, 0xEC, 0x61, 0xC0, 0xD9, 0x38, 0x05, 0x88, 0x22, 0x1B, 0xB9, 0xA1, 0x08, 0x92,
+    0x89, 0x53, 0x6C, 0x91, 0x62, 0x2F, 0xB6, 0x68, 0xD2, 0x80, 0x94, 0xE6, 0x4A, 0xD0, 0x35, 0xD4,
+    0xA4, 0x08, 0x52, 0x40, 0x7B, 0xB1, 0x4F, 0x14, 0x57, 0x72, 0x88, 0x3F, 0x80, 0x15, 0xA2, 0xC7,
+    0xA0, 0x14, 0x20, 0x72, 0xEB, 0x11, 0x74, 0x44, 0x48, 0x96, 0x28, 0xAE, 0xA0, 0x71, 0x74, 0xE5,
+    0x35, 0x83, 0xCE, 0x85, 0xA5, 0x9B, 0xDD, 0xE1, 0x7B, 0x63, 0x67, 0x59, 0xA1, 0xFC, 0x03, 0x8C,
+    0xF5, 0xC5, 0xCF, 0x33, 0x6F, 0xDF, 0xCF, 0xEF, 0x4D, 0x88, 0xB6, 0x88, 0x1C, 0x45, 0xE4, 0x02,
+    0x6F, 0x29, 0x72, 0x8D, 0x49, 0x03, 0x63, 0xEA, 0xE4, 0x6B, 0xD3, 0xEC, 0x88, 0x17, 0x9A, 0x84,
+    0x5A, 0x00, 0xF3, 0xFF, 0x60, 0x41, 0xDE, 0xDF, 0x9A, 0xBC, 0x17, 0x0D, 0x79, 0x2F, 0x15, 0x79,
+    0xA6, 0x22, 0xDF, 0xE4, 0x14, 0x2E, 0x89, 0xC2, 0x06, 0x50, 0xB7, 0xA0, 0xA6, 0xD5, 0x8A, 0x2B,
+    0x00, 0xDF, 0x09, 0x03, 0x67, 0x59, 0x8F, 0x12, 0xB8, 0x77, 0x4C, 0xA5, 0x31, 0x57, 0xC6, 0x68,
+    0xBC, 0x24, 0x94, 0x2F, 0x68, 0xF3, 0x94, 0x76, 0xEE, 0xD2, 0x34, 0x34, 0x8D, 0x87, 0x9D, 0x37,
+    0xB0, 0x97, 0x03, 0x02, 0xF0, 0x37, 0x22, 0xA2, 0xED, 0x5F, 0xF2, 0x2E, 0x7C, 0x8A, 0x5B, 0x22,
+    0xEF, 0x8F, 0x29, 0xD1, 0xAB, 0x63, 0x76, 0x53, 0x0D, 0xC8, 0x4D, 0xA9, 0xA0, 0xE1, 0xE0, 0xAB,
+    0xDF, 0x3E, 0x1A, 0xFF, 0xF8, 0xFC, 0x0C, 0xF1, 0x9D, 0x93, 0x57, 0xB9, 0x4B, 0x9A, 0x37, 0x3F,
+    0x5F, 0x7D, 0xB9, 0xFB, 0xC3, 0xD1, 0x60, 0x6B, 0x46, 0x23, 0x72, 0xF3, 0x2E, 0xAE, 0x80, 0x4D,
+    0xA6, 0xB0, 0x81, 0x6F, 0x01, 0xDF, 0x0E, 0xC7, 0xAC, 0x6C, 0x0C, 0x44, 0x30, 0x4B, 0x77, 0xD9,
+    0x49, 0xAF, 0x18, 0x40, 0xC9, 0x83, 0x92, 0xA8, 0x7B, 0xEF, 0x48, 0x9C, 0x74, 0xAF, 0x78, 0xD8,
+    0x2B, 0x86, 0x50, 0x0A, 0xA0, 0xE4, 0x23, 0x63, 0x3A, 0xA6, 0xB5, 0xB5, 0xBD, 0x00, 0x96, 0x29,
+    0x65, 0xA6, 0xA5, 0xC4, 0x68, 0xCA, 0x9E, 0x1B, 0x99, 0x30, 0x52, 0xBF, 0x8D, 0x53, 0x5F, 0x23,
+    0xBD, 0x52, 0xE0, 0x18, 0xE1, 0x04, 0xF8, 0xB1, 0xCF, 0x5E, 0x90, 0x9E, 0xC3, 0x1E, 0xE6, 0x40,
+    0xC6, 0x1E, 0x60, 0x3D, 0x84, 0xF5, 0xA0, 0xEE, 0x14, 0x04, 0xC2, 0x10, 0x08, 0xC3, 0xD5, 0x5D,
+    0x28, 0x0E, 0x7C, 0x10, 0xE0, 0x18, 0xBC, 0x4B, 0xEC, 0xF7, 0x6F, 0xCF, 0xA4, 0xD8, 0x4B, 0xED,
+    0x5B, 0xF4, 0xB2, 0xD5, 0xC9, 0x60, 0x30, 0x93, 0x5D, 0xB3, 0xB8, 0x69, 0x1E, 0x17, 0x94, 0x0D,
+    0x2D, 0x69, 0x4D, 0x21, 0xEF, 0xF2, 0x7A, 0x8D, 0x6E, 0x59, 0x71, 0xFF, 0xE6, 0x98, 0x39, 0x2C,
+    0xB6, 0x20, 0x00, 0xD4, 0x9C, 0x88, 0x2D, 0x70, 0x4F, 0xD9, 0x05, 0x2F, 0x76, 0xD1, 0x2D, 0xE7,
+    0x1E, 0x71, 0x78, 0x56, 0xC1, 0x20, 0xE2, 0xE4, 0xF1, 0x27, 0x8D, 0x7B, 0x5D, 0x51, 0x22, 0x0F,
+    0x07, 0x48, 0x81, 0x6B, 0x1C, 0xD4, 0x5C, 0xD4, 0xB9, 0xB0, 0xB9, 0xAE, 0xC4, 0xA0, 0x3A, 0xE4,
+    0xA2, 0x78, 0xCC, 0xA4, 0xFC, 0x1C, 0x47, 0x0A, 0xA2, 0xBB, 0xE0, 0x12, 0x99, 0x1C, 0x35, 0x01,
+    0xA5, 0xE6, 0xCC, 0x8B, 0xA0, 0xE6, 0x08, 0x96, 0x4C, 0xBB, 0xDB, 0xC4, 0x8A, 0x5E, 0xAF, 0x9D,
+    0x74, 0x3D, 0x11, 0xA1, 0xB9, 0x71, 0x49, 0x85, 0xFA, 0x79, 0x0B, 0x2E, 0x48, 0xC6, 0xBA, 0xBE,
+    0x61, 0xC2, 0x9A, 0x55, 0xDC, 0x6F, 0x72, 0x4F, 0x33, 0xC3, 0xE5, 0x62, 0xB6, 0x8A, 0xD6, 0x33,
+    0xE4, 0x4C, 0xC8, 0x6F, 0x98, 0x11, 0xB1, 0xE4, 0x6A, 0x68, 0x16, 0x03, 0x99, 0xB0, 0x28, 0x6E,
+    0x44, 0xC7, 0x8A, 0x71, 0x9E, 0x70, 0xD3, 0x58, 0x5C, 0x12, 0xC4, 0x44, 0x7A, 0x8A, 0x07, 0x28,
+    0xA3, 0x10, 0x5E, 0x15, 0xB7, 0x26, 0xC3, 0x26, 0x92, 0x42, 0x34, 0x68, 0xDC, 0x4A, 0x34, 0x2C,
+    0x06, 0xBD, 0xF8, 0x0E, 0xCC, 0x15, 0x6B, 0x91, 0x3B, 0x2D, 0x17, 0x20, 0x46, 0xF0, 0x35, 0x14,
+    0xC4, 0x92, 0x93, 0xC8, 0x94, 0x80, 0x45, 0x2E, 0xAF, 0x1D, 0xB2, 0x7F, 0x57, 0xD5, 0x33, 0x9C,
+    0x49, 0xBB, 0xC7, 0x7D, 0x4B, 0x3B, 0x56, 0x5B, 0x46, 0xA3, 0x6F, 0x34, 0xB1, 0x4D, 0x15, 0x0D,
+    0xE8, 0xBE, 0x10, 0x30, 0xF4, 0x50, 0xA1, 0x70, 0x97, 0xE4, 0xB7, 0xDC, 0x82, 0x10, 0xDA, 0x7E,
+    0x3F, 0x03, 0x96, 0xFF, 0x97, 0x40, 0x72, 0x33, 0x1C, 0x55, 0x6F, 0x86, 0xD9, 0x78, 0xCE, 0x66,
+    0x8E, 0x14, 0x05, 0xBF, 0x22, 0xA4, 0xDA, 0x90, 0xDB, 0x20, 0x03, 0x1D, 0x34, 0x56, 0x9B, 0xD9,
+    0xC4, 0x13, 0xC2, 0x85, 0xB0, 0x04, 0x7F, 0x72, 0x63, 0x46, 0xF6, 0xC4, 0x5E, 0x9F, 0xAD, 0x5D,
+    0x60, 0xC0, 0xB1, 0xDF, 0x49, 0xDF, 0x3E, 0x39, 0xD9, 0xFD, 0x76, 0xF4, 0xEC, 0xFD, 0x67, 0x23,
+    0x15, 0x15, 0x93, 0xF3, 0x36, 0x51, 0x76, 0xD0, 0x2A, 0xB7, 0xF2, 0x66, 0xC3, 0xD9, 0xC1, 0xEC,
+    0xA2, 0x01, 0x99, 0x94, 0x7D, 0x28, 0x6B, 0xEE, 0xD3, 0x0C, 0xB7, 0x41, 0x59, 0x6D, 0x9D, 0x51,
+    0x44, 0xD1, 0xC7, 0x97, 0x65, 0x93, 0x55, 0x5E, 0xFB, 0x2E, 0xED, 0x63, 0xFF, 0xFB, 0xBA, 0x9D,
+    0xA8, 0x51, 0x31, 0x3C, 0x8D, 0x92, 0x96, 0x6D, 0xE0, 0x77, 0x23, 0x3C, 0x13, 0x3C, 0x67, 0x18,
+    0xFF, 0x86, 0x94, 0xA3, 0x38, 0x19, 0xE7, 0x3B, 0xF1, 0x5E, 0x2E, 0x4F, 0xF6, 0x47, 0xFE, 0x87,
+    0xE8, 0x59, 0xAD, 0x8A, 0xE1, 0x44, 0x1C, 0xFD, 0x25, 0xB3, 0xDC, 0xAF, 0xC6, 0x67, 0xB3, 0xA8,
+    0xDE, 0x99, 0xED, 0x9C, 0xEE, 0xC5, 0x4B, 0xE7, 0x03, 0xDA, 0x49, 0x34, 0xEE, 0x37, 0xE7, 0x98,
+    0xC2, 0x78, 0x69, 0xD9, 0x11, 0x37, 0x7E, 0x1D, 0x57, 0x42, 0xC5, 0x12, 0xC9, 0xA7, 0x0E, 0xA3,
+    0xED, 0xA1, 0x93, 0xD4, 0xD5, 0x49, 0xDE, 0x21, 0x5B, 0x43, 0x29, 0xDD, 0x85, 0x33, 0xA7, 0xC8,
+    0x77, 0xE4, 0x66, 0x40, 0xD1, 0xC1, 0xF8, 0xD3, 0xEB, 0xEB, 0xA7, 0x8F, 0x1E, 0x7D, 0x33, 0xDC,
+    0x9B, 0xD2, 0x85, 0x12, 0x7F, 0xAA, 0x38, 0x78, 0xA9, 0x43, 0x53, 0xC7, 0x86, 0xB6, 0xB9, 0x07,
+    0x53, 0x51, 0x38, 0xD2, 0x43, 0xE0, 0x85, 0x2B, 0x7D, 0x8A, 0x02, 0x53, 0x82, 0xDF, 0x59, 0xFD,
+    0xD8, 0x66, 0x8C, 0x5C, 0x7E, 0x72, 0x55, 0x08, 0xFE, 0x95, 0xBA, 0x5C, 0x80, 0xF3, 0xBB, 0xB4,
+    0x41, 0xBB, 0x98, 0xD2, 0x0B, 0x9C, 0x8D, 0xB6, 0xA6, 0x65, 0x9B, 0x55, 0xB8, 0xA4, 0x6A, 0x77,
+    0xF6, 0xCA, 0xFD, 0x8D, 0x62, 0x5C, 0x94, 0x4D, 0xD9, 0x55, 0xAF, 0xC1, 0xF0, 0xFF, 0x0E, 0xED,
+    0x99, 0x6B, 0x52, 0x2F, 0xDD, 0xA4, 0xCF, 0xCD, 0x15, 0xDF, 0x2C, 0x20, 0x41, 0x84, 0xE2, 0xA1,
+    0xA4, 0xAA, 0x8D, 0x8A, 0x61, 0x31, 0x3C, 0x8B, 0x12, 0xCD, 0xED, 0x2A, 0x35, 0x22, 0x60, 0x77,
+    0x07, 0x74, 0x0A, 0xE3, 0xB6, 0x74, 0x6E, 0xED, 0xB6, 0xC2, 0x91, 0x72, 0xFF, 0x20, 0x12, 0xDA,
+    0x7D, 0xFA, 0x50, 0x8E, 0xD5, 0xE6, 0x9E, 0xFF, 0x85, 0xC9, 0xEF, 0x60, 0xB8, 0xC6, 0x07, 0xB3,
+    0x11, 0x97, 0xEE, 0xB3, 0x07, 0x20, 0xFE, 0x90, 0x22, 0x5B, 0x3A, 0xD0, 0xB0, 0xA5, 0x90, 0xB9,
+    0x35, 0x05, 0x9F, 0xF0, 0x3F, 0x2A, 0xEE, 0x65, 0xBB, 0x9F, 0xBA, 0x76, 0x43, 0x81, 0x27, 0xDD,
+    0x9F, 0x7A, 0x25, 0xF1, 0x81, 0xD3, 0x30, 0x07, 0xED, 0x0C, 0x3F, 0xC1, 0x28, 0x61, 0xDB, 0x6D,
+    0xF8, 0xAE, 0xD4, 0xCC, 0xA7, 0x84, 0xAF, 0xA4, 0x50, 0xF6, 0x66, 0x0F, 0x3B, 0x4F, 0x30, 0x56,
+    0xE1, 0xD8, 0x3A, 0xD4, 0xF8, 0xF2, 0x24, 0x6C, 0x1C, 0x42, 0x05, 0xDF, 0xB8, 0xA2, 0x6F, 0x84,
+    0x07, 0x70, 0xED, 0x4B, 0xF8, 0xD0, 0xE0, 0x74, 0x9C, 0x06, 0xD2, 0xAB, 0x61, 0x59, 0xF3, 0x74,
+    0xA6, 0xA1, 0x0C, 0x6A, 0x4F, 0xD1, 0xFF, 0x69, 0xFD, 0x03, 0xC5, 0x55, 0xBF, 0x8F, 0xDC, 0x54,
+    0x10, 0xFE, 0xEC, 0xC7, 0x9D, 0x45, 0x5C, 0x98, 0x22, 0xA4, 0x48, 0x24, 0x5C, 0x83, 0x20, 0xFB,
+    0x0F, 0x84, 0xB5, 0x21, 0x05, 0x05, 0x45, 0x0E, 0x91, 0xAB, 0x69, 0xA9, 0xB8, 0x96, 0x22, 0x77,
+    0xB6, 0x44, 0x41, 0x91, 0x82, 0x2B, 0x82, 0x28, 0x2F, 0xC5, 0x51, 0x00, 0xC5, 0xA5, 0x48, 0x91,
+    0xE2, 0x72, 0xB6, 0x44, 0x41, 0x91, 0x22, 0xAE, 0x68, 0xCF, 0xE2, 0x87, 0x56, 0x0A, 0xCD, 0x43,
+    0x38, 0xB0, 0x7B, 0xB1, 0x3D, 0x7C, 0x33, 0xBB, 0xB7, 0x87, 0x10, 0x3D, 0x6F, 0xA5, 0x19, 0xBF,
+    0xF1, 0x7B, 0xE3, 0x6F, 0x7E, 0x7C, 0xB3, 0x40, 0x70, 0xFF, 0x2A, 0xE0, 0xFC, 0x94, 0xA2, 0x7D,
+    0x1B, 0x88, 0x9A, 0x3B, 0x40, 0x5C, 0x1F, 0x03, 0x49, 0x39, 0xA7, 0x90, 0x05, 0x50, 0xC8, 0x88,
+    0x50, 0x64, 0xE0, 0xEE, 0xAB, 0x39, 0xB2, 0x21, 0xAA, 0x21, 0x7D, 0x5C, 0x07, 0xD2, 0x27, 0xA5,
+    0xEB, 0xE7, 0x49, 0x1E, 0xCD, 0xBB, 0x14, 0xF1, 0xEF, 0x7E, 0x82, 0xE4, 0x0F, 0x7A, 0x4A, 0x7E,
+    0xA6, 0xA7, 0x74, 0x46, 0x4F, 0xE9, 0x6F, 0xF4, 0x94, 0x4A, 0x3D, 0xA7, 0x78, 0xA7, 0xA3, 0x08,
+    0x3D, 0x9D, 0xDC, 0x54, 0xF1, 0xE2, 0xD7, 0x93, 0x58, 0x44, 0x46, 0xA7, 0x22, 0x50, 0x81, 0xB5,
+    0x08, 0xFE, 0x14, 0x39, 0x0C, 0xD7, 0x98, 0xDC, 0x05, 0xA6, 0x5A, 0x31, 0xE5, 0x1D, 0xCE, 0x57,
+    0x50, 0x11, 0xDF, 0xCE, 0x05, 0xBE, 0x2F, 0x3F, 0x46, 0xA6, 0x6F, 0xA5, 0xE6, 0x3B, 0xE1, 0x83,
+    0x1B, 0x28, 0x22, 0xDE, 0x42, 0xEC, 0x29, 0x12, 0x13, 0x2D, 0x2E, 0x5F, 0x4E, 0x5B, 0xEC, 0xF5,
+    0x14, 0xC5, 0x90, 0x7A, 0x14, 0x79, 0xDA, 0x61, 0x17, 0x69, 0x8F, 0x3B, 0x74, 0x52, 0xAA, 0x18,
+    0x4F, 0xFE, 0x81, 0x2F, 0x34, 0x68, 0x95, 0x8A, 0x89, 0x2C, 0xBF, 0x76, 0x88, 0x7F, 0xAD, 0xDB,
+    0xA0, 0x79, 0xE0, 0x57, 0xA5, 0x47, 0xD1, 0x5E, 0xF3, 0xFC, 0xCA, 0xCB, 0xE8, 0xF5, 0xC3, 0xC4,
+    0x42, 0xBF, 0x1A, 0x87, 0x1E, 0x11, 0x51, 0x1F, 0xDE, 0x1E, 0xD6, 0xEF, 0xAF, 0xCA, 0xB7, 0x87,
+    0x9A, 0x84, 0x32, 0x15, 0x99, 0x23, 0x54, 0xBC, 0x93, 0x92, 0x37, 0xF4, 0x41, 0xC3, 0xA8, 0x78,
+    0xB5, 0xFA, 0x85, 0x67, 0xF9, 0xF5, 0x7D, 0xE2, 0x90, 0x27, 0xA2, 0x01, 0xEB, 0x3A, 0xE1, 0xD1,
+    0xD6, 0x4E, 0x4D, 0xBC, 0xA9, 0x8C, 0x97, 0x46, 0xAA, 0x7E, 0xA9, 0xC6, 0xA5, 0x12, 0x04, 0xA6,
+    0xCA, 0x80, 0xD7, 0xB2, 0xAA, 0x36, 0x75, 0xD4, 0x84, 0x54, 0xC5, 0x17, 0xDE, 0xD4, 0xDD, 0xCE,
+    0xD4, 0x67, 0xBD, 0xEB, 0x79, 0x50, 0xD7, 0xB8, 0x52, 0x6F, 0xC8, 0x33, 0xF9, 0x6E, 0xFC, 0x86,
+    0x69, 0xCD, 0xBE, 0xEF, 0x35, 0xBB, 0x93, 0xA5, 0x4A, 0x66, 0x4B, 0xF5, 0xC2, 0x54, 0x24, 0xA6,
+    0x1C, 0x23, 0x08, 0x84, 0xED, 0x61, 0x0A, 0x2B, 0x55, 0x10, 0x55, 0xCA, 0xD4, 0x69, 0x3B, 0x49,
+    0x89, 0x70, 0x3C, 0xA2, 0x31, 0x6E, 0x51, 0x95, 0x1A, 0x69, 0x61, 0x71, 0x0C, 0xCE, 0x3E, 0x77,
+    0x4B, 0x2C, 0xB8, 0xAC, 0x44, 0x96, 0x13, 0x7B, 0xD4, 0x43, 0xED, 0x2D, 0x8B, 0x22, 0x16, 0x82,
+    0x30, 0x19, 0xF2, 0x6C, 0x8B, 0xE9, 0xD1, 0xF4, 0x2D, 0x6B, 0x8A, 0x42, 0xB3, 0x6C, 0x25, 0xD7,
+    0x0B, 0x5C, 0xE9, 0x85, 0x39, 0x34, 0x73, 0x6C, 0xF9, 0x9A, 0x58, 0xF3, 0x68, 0x3E, 0x09, 0xA7,
+    0x34, 0xFB, 0x32, 0x91, 0xE1, 0x59, 0xA5, 0x67, 0xF1, 0x00, 0x9A, 0x74, 0xBC, 0x89, 0xD4, 0x5E,
+    0xC2, 0xA9, 0x95, 0xC2, 0xDC, 0x79, 0x2B, 0x24, 0x6E, 0x20, 0xA3, 0xA7, 0x79, 0xB2, 0xCD, 0x2B,
+    0x99, 0x38, 0x45, 0x94, 0x7E, 0x90, 0x2B, 0xC6, 0x58, 0x01, 0x7A, 0x3D, 0x9F, 0x68, 0x7D, 0x1F,
+    0xC1, 0x75, 0x0C, 0x92, 0x7D, 0xD6, 0xF3, 0x17, 0x4A, 0x5D, 0x20, 0xCD, 0x91, 0x0E, 0x69, 0x1D,
+    0xB1, 0x66, 0xE9, 0x0F, 0x3E, 0x20, 0xD6, 0xE0, 0xF9, 0xC0, 0x04, 0xB8, 0xFD, 0xC7, 0x6C, 0xC3,
+    0x86, 0x7D, 0xB1, 0xD3, 0xC4, 0x73, 0x36, 0xC3, 0x93, 0x8E, 0xB8, 0x0B, 0xF9, 0x69, 0x40, 0x55,
+    0x6F, 0x4A, 0x13, 0x13, 0x6C, 0x5C, 0xEA, 0xE7, 0x3B, 0x12, 0x90, 0x2C, 0xB8, 0xA1, 0x78, 0xB4,
+    0xA7, 0x52, 0x90, 0x24, 0xA1, 0x77, 0x6D, 0x80, 0xEB, 0xFC, 0x3D, 0x72, 0x6D, 0xA1, 0x19, 0xFC,
+    0xCB, 0x92, 0x69, 0x8F, 0x6D, 0x72, 0x73, 0x64, 0x9B, 0x75, 0x85, 0x3F, 0x46, 0x72, 0xF7, 0xF4,
+    0x56, 0x89, 0xE3, 0x7E, 0xDE, 0x21, 0x3E, 0x7D, 0xFA, 0x34, 0xC7, 0xDE, 0xFC, 0xC4, 0x23, 0x92,
+    0xF7, 0xB4, 0x75, 0x7C, 0x46, 0xEC, 0xE2, 0x34, 0xCD, 0x2D, 0xBB, 0xCA, 0x0D, 0xDA, 0x26, 0x93,
+    0x3A, 0x69, 0x10, 0xF4, 0xD6, 0xAC, 0x9A, 0xE4, 0xB3, 0x7B, 0x9A, 0x64, 0x2B, 0x03, 0xDB, 0xD5,
+    0x63, 0x5A, 0x34, 0x3B, 0x1E, 0x8B, 0x9E, 0x14, 0x73, 0x33, 0xA6, 0xA0, 0x4E, 0x0E, 0x72, 0xE2,
+    0x9B, 0xEE, 0x02, 0x53, 0x2C, 0xBA, 0x0D, 0x22, 0x9A, 0x35, 0x93, 0xB0, 0xA5, 0xF9, 0x38, 0xAE,
+    0xA7, 0xBB, 0x21, 0x07, 0xC5, 0xA2, 0x23, 0xA1, 0xD5, 0x8C, 0xAD, 0xF4, 0x20, 0x67, 0x54, 0x7B,
+    0xBB, 0x81, 0x47, 0xB0, 0xE8, 0x5C, 0x8B, 0x68, 0xD6, 0x30, 0x67, 0xD9, 0x41, 0x9E, 0x2C, 0xA2,
+    0x51, 0xB9, 0xC8, 0x16, 0xC2, 0xA6, 0x66, 0x17, 0xB8, 0x72, 0x54, 0x9E, 0x53, 0x5F, 0xB7, 0x11,
+    0x77, 0xAF, 0x7E, 0x42, 0xEA, 0x89, 0x74, 0xB0, 0x3A, 0x20, 0xCE, 0x11, 0x0E, 0x6F, 0x31, 0x80,
+    0xE1, 0x21, 0xDC, 0x19, 0x2D, 0xD7, 0x51, 0xE5, 0x2C, 0xDC, 0xC0, 0xC3, 0xCE, 0x73, 0x97, 0xD4,
+    0x2C, 0x4B, 0x86, 0xA0, 0x0B, 0xAD, 0xB1, 0x3A, 0x25, 0x55, 0xA3, 0x22, 0xC7, 0xE6, 0xF8, 0x3A,
+    0xB6, 0xB7, 0xB7, 0x6F, 0x2B, 0x39, 0xBD, 0xD2, 0xBF, 0x5E, 0xCF, 0x19, 0x63, 0x76, 0xC3, 0x7A,
+    0x70, 0xCC, 0x2C, 0x82, 0x5C, 0xC9, 0xC4, 0xC4, 0x30, 0xEF, 0xDA, 0x4F, 0x19, 0x0D, 0xD6, 0xB2,
+    0x0A, 0xD2, 0x69, 0xA7, 0x64, 0xDA, 0x34, 0x62, 0x3C, 0x22, 0x2F, 0x9E, 0xAB, 0x25, 0xA7, 0xA5,
+    0x5B, 0xDD, 0xD2, 0xB4, 0x22, 0x5D, 0x28, 0xBB, 0x79, 0xCD, 0x72, 0x99, 0x6A, 0x1B, 0x5E, 0xD3,
+    0x08, 0x8C, 0x22, 0x22, 0xA7, 0xEB, 0x22, 0x0E, 0x5F, 0x6F, 0x0D, 0xD8, 0x5E, 0xBA, 0x40, 0xA2,
+    0x27, 0x5C, 0xF7, 0x0A, 0xE5, 0xF8, 0x58, 0xFD, 0x12, 0x37, 0x27, 0x4A, 0x4E, 0x7C, 0x5A, 0x20,
+    0xA3, 0xD8, 0xB4, 0xF8, 0x3C, 0xC7, 0x4B, 0xA9, 0x3A, 0x8B, 0x18, 0x20, 0xDD, 0xEE, 0x1B, 0xF7,
+    0x75, 0xA0, 0x13, 0x9D, 0x7B, 0xBF, 0x5F, 0xB3, 0xC2, 0x9A, 0x7E, 0x62, 0x63, 0xB1, 0x37, 0xCC,
+    0x58, 0x8D, 0x4F, 0x45, 0x55, 0x9E, 0xD3, 0x15, 0xF1, 0x59, 0x25, 0x36, 0x6C, 0x94, 0x5C, 0xAC,
+    0x4E, 0xC2, 0xA8, 0x74, 0xF5, 0x3A, 0x4D, 0xB9, 0xD7, 0x19, 0x73, 0xB2, 0xC4, 0xCD, 0xCB, 0x46,
+    0x5A, 0x2D, 0x9C, 0x5E, 0x35, 0xEE, 0xEA, 0xC6, 0x06, 0xB3, 0xF2, 0x76, 0x45, 0x59, 0x9B, 0x6C,
+    0xE7, 0x44, 0x0D, 0xFE, 0x63, 0x63, 0xB0, 0x56, 0x38, 0x57, 0xC4, 0x0D, 0x35, 0xDA, 0xF3, 0x0D,
+    0x0F, 0xDE, 0xC7, 0xAA, 0x0B, 0x80, 0xD7, 0xCC, 0xF2, 0xE9, 0xBA, 0x37, 0x36, 0x2A, 0xC6, 0x1F,
+    0x1A, 0x1E, 0xFE, 0x83, 0x49, 0x1E, 0xC9, 0xBB, 0xCD, 0x06, 0x5B, 0x3C, 0xD6, 0x54, 0x81, 0x1D,
+    0x92, 0xCC, 0xF1, 0x90, 0x69, 0xA9, 0x43, 0x9D, 0x27, 0xDA, 0x37, 0x04, 0x4D, 0x33, 0xC9, 0x4A,
+    0x73, 0x51, 0xD2, 0xCC, 0x2A, 0xC7, 0xF7, 0xF4, 0xEF, 0x23, 0x93, 0xF1, 0x23, 0x0F, 0x1D, 0x88,
+    0xB5, 0xAB, 0x77, 0x7A, 0xC9, 0x13, 0x64, 0x1F, 0x0A, 0xE7, 0x40, 0x1F, 0x0B, 0x7C, 0xE4, 0x53,
+    0x99, 0xFD, 0x58, 0xD5, 0x36, 0x2D, 0x2D, 0x09, 0xBD, 0x49, 0xAF, 0x92, 0x89, 0xB9, 0x24, 0x67,
+    0xB9, 0x4D, 0x8D, 0xE5, 0x08, 0x59, 0xCE, 0x13, 0xAE, 0x4B, 0xF8, 0xBF, 0xD7, 0xDF, 0xB5, 0x55,
+    0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xF6, 0x04, 0x8C, 0xE2, 0x64, 0xE7, 0x8A, 0xD0, 0x20, 0xC0,
+    0x4D, 0x3A, 0xD0, 0xBA, 0xDD, 0xE2, 0x72, 0x36, 0xBA, 0x82, 0x8A, 0xE8, 0x0A, 0x36, 0x4D, 0x8A,
+    0x50, 0x53, 0x90, 0xF6, 0x8A, 0xCB, 0xAD, 0xA9, 0x28, 0x90, 0x20, 0x7F, 0x02, 0x0D, 0x8A, 0x8E,
+    0x20, 0x85, 0xE2, 0x0A, 0x88, 0x72, 0xB7, 0x96, 0x4E, 0xA2, 0xA1, 0x88, 0x89, 0x84, 0x52, 0xD0,
+    0x8C, 0x04, 0x05, 0x0A, 0xCD, 0x08, 0x1C, 0x61, 0x91, 0xDD, 0x1D, 0xBE, 0xEF, 0xD9, 0x77, 0xB9,
+    0x6B, 0x88, 0x28, 0x18, 0xAD, 0x3D, 0xE3, 0x37, 0x6F, 0xBE, 0xF7, 0xEB, 0x7B, 0xB3, 0x12, 0x5D,
+    0xDB, 0x12, 0x91, 0x24, 0x84, 0x16, 0x53, 0x11, 0x82, 0x13, 0x31, 0x21, 0x84, 0x4A, 0xE4, 0x92,
+    0xDC, 0x5C, 0x08, 0x47, 0xD1, 0xE8, 0xB4, 0xD2, 0x77, 0xEA, 0x74, 0x9A, 0xEB, 0xDB, 0x3A, 0x99,
+    0x07, 0x8E, 0x9F, 0xF5, 0xBD, 0xEC, 0x3F, 0x7A, 0xF5, 0x61, 0xA4, 0xA7, 0x77, 0x06, 0xB5, 0x99,
+    0xE2, 0x26, 0xB4, 0x55, 0xC2, 0xE6, 0x93, 0xBB, 0x4B, 0xB5, 0x19, 0xBC, 0x58, 0x4E, 0x35, 0xFD,
+    0x08, 0x30, 0x37, 0x0B, 0xEA, 0xCF, 0x5B, 0x21, 0x7C, 0x71, 0x82, 0x17, 0xE1, 0xF1, 0xB0, 0xDC,
+    0x4F, 0x40, 0x9A, 0x85, 0xDA, 0x86, 0xAF, 0xE3, 0xC5, 0xBE, 0x14, 0x69, 0x99, 0xF8, 0x7D, 0xD9,
+    0xC5, 0xD4, 0xEC, 0xCB, 0x01, 0x26, 0xB7, 0x2D, 0xB3, 0xA4, 0x32, 0x8B, 0x6D, 0xC9, 0xC3, 0x6F,
+    0x02, 0x03, 0x30, 0x53, 0xBD, 0x1C, 0x7E, 0x15, 0x53, 0x13, 0xEB, 0xC3, 0xAF, 0x30, 0x6E, 0x86,
+    0xDE, 0xCA, 0x99, 0xF1, 0x1A, 0x77, 0xEE, 0xA8, 0xB3, 0xEA, 0x32, 0x92, 0x50, 0x32, 0x5E, 0x86,
+    0x66, 0x98, 0x29, 0x59, 0x6A, 0x66, 0xCA, 0x3E, 0x09, 0x08, 0xA6, 0xA3, 0x6F, 0x9A, 0xA2, 0x19,
+    0x72, 0x27, 0xD9, 0x89, 0x30, 0x0E, 0x9A, 0x2F, 0x1A, 0xCC, 0x3D, 0x13, 0xB2, 0x38, 0x11, 0x06,
+    0x0A, 0x0B, 0x08, 0x91, 0x9D, 0x1F, 0x42, 0x58, 0x48, 0x81, 0x6F, 0xA0, 0x27, 0x40, 0x58, 0xA7,
+    0xF0, 0x31, 0xEC, 0x4B, 0x5A, 0x4B, 0xD2, 0xCA, 0x7C, 0x85, 0x54, 0x96, 0x32, 0x5F, 0xCA, 0x4B,
+    0xD7, 0x71, 0x22, 0xC3, 0xD1, 0x45, 0x6F, 0x1B, 0x50, 0x16, 0x12, 0x6C, 0xDA, 0x4E, 0x31, 0xD7,
+    0xE0, 0x09, 0x04, 0x51, 0xCB, 0xE7, 0xBC, 0x44, 0x4F, 0x0F, 0x25, 0x42, 0x3A, 0x99, 0xEF, 0x19,
+    0xDC, 0x9E, 0xB7, 0x91, 0x7C, 0xD9, 0x7E, 0x24, 0xD1, 0xB3, 0x15, 0xFC, 0xE8, 0x90, 0x1A, 0xC0,
+    0xB6, 0xB2, 0x71, 0xBF, 0x95, 0x9D, 0x77, 0xDA, 0xB8, 0x8B, 0xDA, 0xCC, 0x45, 0x7F, 0x87, 0x2A,
+    0xC2, 0x5E, 0xB4, 0x2A, 0x4F, 0x65, 0xE5, 0x4D, 0xC6, 0xE8, 0x8E, 0x17, 0x34, 0x01, 0x15, 0xF8,
+    0xE9, 0x24, 0x0B, 0xA1, 0x34, 0xAB, 0x3F, 0x10, 0x81, 0xB5, 0x4D, 0xE2, 0xFC, 0xAE, 0x3C, 0xB0,
+    0xC6, 0xA5, 0xB5, 0x1F, 0x63, 0x11, 0xFB, 0xB4, 0xF2, 0xB9, 0x7C, 0x6B, 0x63, 0x87, 0xC5, 0xF8,
+    0xF9, 0x02, 0x5B, 0x2E, 0xA1, 0xCE, 0x0E, 0x94, 0x93, 0xC6, 0x6F, 0x10, 0x91, 0xB5, 0x00, 0x1D,
+    0x01, 0x9C, 0x3F, 0x41, 0x4A, 0xE4, 0x50, 0x92, 0x85, 0xC4, 0x9D, 0x18, 0x4F, 0xEE, 0xA5, 0x8D,
+    0xE4, 0x15, 0x7F, 0x2B, 0x96, 0xC0, 0x74, 0xAC, 0x06, 0x59, 0x58, 0xB3, 0x4A, 0xAB, 0x9E, 0x45,
+    0x24, 0xD1, 0x12, 0x1C, 0x5A, 0xED, 0xB1, 0x1A, 0x5A, 0x69, 0xA6, 0x9B, 0x6C, 0xAA, 0x23, 0xAD,
+    0x26, 0xF0, 0x09, 0x1D, 0x69, 0x15, 0xB4, 0x20, 0x7D, 0x6D, 0x64, 0xDE, 0x68, 0x71, 0x18, 0x74,
+    0xAA, 0x15, 0x8E, 0x58, 0xCC, 0x2B, 0xAC, 0x32, 0x16, 0x86, 0x3A, 0xD4, 0xCE, 0xB9, 0x0F, 0xD5,
+    0xA8, 0x1B, 0x70, 0x7F, 0xA1, 0xF5, 0x8C, 0xC7, 0x6E, 0x11, 0x80, 0x0C, 0x49, 0xB5, 0xB8, 0x32,
+    0x9C, 0x30, 0xD5, 0x99, 0xA6, 0x80, 0xA6, 0x21, 0x3E, 0xC3, 0x2C, 0x98, 0xBF, 0x87, 0x37, 0xEA,
+    0xC4, 0xB5, 0x45, 0xDC, 0xD9, 0x72, 0x79, 0x4B, 0x5A, 0xF3, 0xA8, 0xB4, 0xE5, 0x39, 0x25, 0x83,
+    0xD8, 0x52, 0xFE, 0x75, 0x71, 0x99, 0x4C, 0x6B, 0x06, 0xAF, 0x7A, 0x63, 0x7E, 0x70, 0x58, 0x76,
+    0xD5, 0x9B, 0xF9, 0xD0, 0x7A, 0xB4, 0x48, 0x27, 0x13, 0xD6, 0x90, 0xAE, 0x6F, 0x50, 0xAF, 0x1E,
+    0x0E, 0xBC, 0x7D, 0xEC, 0xDD, 0x8B, 0x8D, 0x5E, 0xC2, 0xE2, 0xDD, 0xC6, 0x96, 0x57, 0xF2, 0xAA,
+    0xB5, 0xCD, 0xA1, 0xDD, 0xF4, 0xD1, 0xE2, 0xE9, 0x02, 0x69, 0x45, 0x55, 0x2C, 0xEF, 0x0E, 0xBD,
+    0x32, 0xF6, 0xCF, 0xB4, 0x94, 0x93, 0x6F, 0x68, 0x30, 0xAD, 0xF8, 0x1B, 0x4B, 0xEC, 0x89, 0xB6,
+    0x03, 0xDB, 0x0D, 0x7B, 0xD9, 0x6A, 0xE9, 0x16, 0xCC, 0x65, 0x78, 0x44, 0x6F, 0x5A, 0x68, 0x41,
+    0x6D, 0x2C, 0x54, 0x6F, 0xA9, 0x6E, 0x1A, 0xAA, 0x5F, 0x90, 0xE4, 0x34, 0xEA, 0xC5, 0xBE, 0xEB,
+    0x32, 0x50, 0xF9, 0xAF, 0x7B, 0xB2, 0x31, 0xCA, 0x8D, 0x9B, 0x64, 0xEF, 0x89, 0x7B, 0x43, 0x33,
+    0x3E, 0x82, 0xC6, 0x44, 0x6D, 0x0F, 0x9F, 0x31, 0x3E, 0x33, 0xEC, 0xE6, 0x9B, 0x1F, 0xB7, 0xF9,
+    0xD5, 0x5C, 0xB2, 0xFB, 0x9E, 0x67, 0xB5, 0x8F, 0x2E, 0x0E, 0x90, 0xD3, 0xBB, 0x24, 0x93, 0x09,
+    0x7B, 0x5B, 0x16, 0xE1, 0x16, 0x78, 0xFE, 0x6C, 0x25, 0x39, 0x6A, 0x25, 0x03, 0xD7, 0xB6, 0x4D,
+    0x1B, 0x39, 0x03, 0xE7, 0x4C, 0x3B, 0xD6, 0x9B, 0x80, 0xA9, 0x8B, 0x25, 0xDB, 0xDB, 0x22, 0x0F,
+    0xAA, 0x6B, 0xF7, 0x00, 0x96, 0xB2, 0x29, 0x40, 0xD5, 0xC7, 0xB5, 0x1C, 0x64, 0xE0, 0xC9, 0xBA,
+    0x1C, 0x88, 0x4F, 0x1B, 0x53, 0x1F, 0x88, 0x05, 0x6B, 0xD6, 0x49, 0x91, 0xDB, 0xC2, 0x0B, 0x56,
+    0x9B, 0x08, 0x08, 0xE7, 0xF1, 0xAC, 0xA3, 0x2A, 0x3E, 0x41, 0x3F, 0xA4, 0xCD, 0x18, 0x87, 0xF6,
+    0xC5, 0x1E, 0x35, 0x62, 0x1F, 0xC2, 0x37, 0xF6, 0xB9, 0xCF, 0x81, 0xAE, 0x97, 0x62, 0x3F, 0x10,
+    0x4D, 0xFA, 0x7D, 0x29, 0xBB, 0x63, 0x14, 0x73, 0x07, 0x34, 0xF3, 0xC6, 0x9B, 0xBA, 0x10, 0xF4,
+    0x9A, 0x5C, 0xC9, 0x4B, 0xF9, 0xAE, 0x05, 0xB9, 0x2B, 0xBD, 0x80, 0xD0, 0x0D, 0x0D, 0xEE, 0xD3,
+    0xD3, 0x7D, 0xAC, 0x2D, 0xF1, 0x40, 0x06, 0x02, 0xF4, 0x24, 0x55, 0xF2, 0x28, 0x83, 0xED, 0x4F,
+    0xD3, 0xE9, 0xFB, 0x7A, 0x11, 0x7F, 0x4E, 0x45, 0x25, 0x4B, 0xAF, 0xA3, 0x35, 0xAA, 0x66, 0xD3,
+    0xE9, 0xB4, 0xEC, 0xA5, 0x87, 0x32, 0x10, 0x48, 0xA2, 0xFA, 0x39, 0xFC, 0x9A, 0xEA, 0x56, 0x94,
+    0x6C, 0xF0, 0xA2, 0x35, 0x1D, 0x55, 0x0A, 0x07, 0x52, 0x98, 0x67, 0xD5, 0xEF, 0xE8, 0xE0, 0xCF,
+    0xCC, 0xA7, 0x4D, 0xDC, 0x4D, 0x46, 0x69, 0x93, 0x57, 0x6E, 0x92, 0xFE, 0xD8, 0x99, 0xCA, 0xA5,
+    0x47, 0xD5, 0xC8, 0x54, 0xAF, 0xA0, 0x60, 0x23, 0xA5, 0xCB, 0x44, 0x41, 0x68, 0x66, 0xA4, 0xCD,
+    0xF3, 0x62, 0xF1, 0x30, 0x2E, 0xC8, 0x31, 0x5B, 0x95, 0xD6, 0x7D, 0x8C, 0x46, 0xFF, 0x94, 0x76,
+    0x22, 0xF8, 0x7E, 0xA3, 0x9E, 0xF7, 0xED, 0x3F, 0xB8, 0xAE, 0x5A, 0xC6, 0x53, 0xE8, 0x5F, 0x9D,
+    0x4E, 0xAF, 0xFB, 0xE3, 0x3B, 0x3E, 0xEE, 0x8E, 0x1B, 0x4A, 0x5E, 0x3F, 0x41, 0xBF, 0x7D, 0xF9,
+    0x3F, 0xFB, 0x45, 0x71, 0x5C, 0x42, 0x7C, 0x2E, 0x2B, 0x21, 0xDE, 0x2E, 0x4A, 0x37, 0x49, 0x7C,
+    0xB1, 0x59, 0xB9, 0x99, 0x14, 0x57, 0xCD, 0x27, 0x4E, 0x8A, 0xC9, 0x08, 0x5E, 0xCE, 0x5C, 0xE1,
+    0xF8, 0xF7, 0xC1, 0x22, 0xEF, 0x1A, 0x42, 0x6D, 0x2B, 0x27, 0x3F, 0x58, 0x93, 0xFF, 0x6D, 0xFC,
+    0x03, 0xAD, 0x54, 0x31, 0x8F, 0xDD, 0x44, 0x10, 0xFE, 0xD6, 0x9B, 0xE0, 0x48, 0xD6, 0xE1, 0x2A,
+    0x48, 0xE4, 0x02, 0xA6, 0xA0, 0x84, 0xB8, 0x49, 0x19, 0x6E, 0xAD, 0x50, 0xD0, 0xBE, 0x22, 0x8F,
+    0x02, 0x28, 0xA8, 0x69, 0x8E, 0x92, 0x22, 0x77, 0xB6, 0xC4, 0x1F, 0x48, 0x01, 0xFF, 0x80, 0xFE,
+    0x84, 0x44, 0x41, 0xF1, 0x12, 0x5B, 0xBA, 0x22, 0xC5, 0x35, 0x96, 0x28, 0x52, 0x50, 0xB0, 0x91,
+    0xAE, 0x08, 0xA2, 0xC8, 0x22, 0x39, 0xE0, 0x03, 0xDB, 0xCB, 0x37, 0xEB, 0xE7, 0x7B, 0x51, 0x44,
+    0x99, 0x95, 0x77, 0xEC, 0x1D, 0xEF, 0xEC, 0xCE, 0x7C, 0xF3, 0xCD, 0x00, 0x61, 0x68, 0xE0, 0x01,
+    0x90, 0x34, 0x91, 0x03, 0xD2, 0x4A, 0x75, 0x80, 0x01, 0x36, 0xE1, 0x31, 0x90, 0x65, 0x5A, 0xE9,
+    0x17, 0xEB, 0xF5, 0xE7, 0x6D, 0xEA, 0x39, 0x3A, 0x23, 0x36, 0x0F, 0x8F, 0x45, 0x1E, 0xA7, 0x0D,
+    0x10, 0x75, 0x5A, 0xF4, 0xAD, 0x1A, 0xD7, 0xEB, 0xB2, 0x02, 0x7F, 0xF0, 0xC9, 0x2B, 0x35, 0xD0,
+    0xB0, 0x89, 0x68, 0x1E, 0x03, 0x16, 0xCB, 0x28, 0xE4, 0x42, 0x5A, 0xC1, 0x50, 0xC4, 0xCF, 0x5B,
+    0xA0, 0x4C, 0x5B, 0x24, 0xCE, 0x58, 0xE5, 0x9B, 0x27, 0x7D, 0xF6, 0x87, 0xFE, 0x78, 0x78, 0xF3,
+    0xE6, 0x1E, 0xB7, 0x7C, 0x7D, 0x1B, 0x50, 0x0D, 0x37, 0xC4, 0x9A, 0x46, 0x37, 0xF7, 0x68, 0xB3,
+    0xA8, 0x14, 0x55, 0x2B, 0xF3, 0xC5, 0x5E, 0x62, 0x6B, 0x77, 0xDB, 0x17, 0x65, 0xC3, 0x73, 0xCC,
+    0xB7, 0xBC, 0x30, 0x3F, 0xAC, 0x28, 0x78, 0x27, 0x72, 0xB9, 0xE8, 0x7D, 0xB9, 0x31, 0x61, 0x70,
+    0x69, 0x2F, 0x3E, 0x73, 0x1E, 0xC8, 0x2F, 0xCE, 0x8C, 0xF3, 0xDD, 0xED, 0xBC, 0x05, 0xEF, 0x3E,
+    0x4C, 0xFC, 0xF0, 0x51, 0x66, 0xF3, 0x3B, 0xA6, 0x48, 0x36, 0xC7, 0xD0, 0xC3, 0x11, 0xA2, 0xFE,
+    0x21, 0xA3, 0xE7, 0x74, 0x35, 0xB4, 0x33, 0x55, 0xD2, 0xE6, 0xDE, 0x37, 0xC4, 0xA0, 0xD0, 0x7E,
+    0xA2, 0xDB, 0x4B, 0x4C, 0x8A, 0x4F, 0x7D, 0x81, 0xC8, 0x22, 0xF6, 0xBE, 0x67, 0xC0, 0x89, 0x7F,
+    0xEE, 0x7F, 0x71, 0x48, 0x27, 0x64, 0xDE, 0x21, 0x19, 0xC1, 0xF3, 0xA1, 0xC7, 0xE0, 0x45, 0x44,
+    0x4B, 0xED, 0xA9, 0x91, 0x57, 0x23, 0x20, 0xE8, 0xBF, 0x3B, 0x64, 0x2D, 0xB4, 0x9D, 0x10, 0x3B,
+    0xC4, 0xD6, 0x08, 0x72, 0xB1, 0x4D, 0x2D, 0x4A, 0xBE, 0xA2, 0x01, 0x59, 0x13, 0x5B, 0x3C, 0x42,
+    0xDC, 0xC5, 0x0C, 0xB2, 0x52, 0x63, 0xD2, 0x82, 0x3F, 0xCD, 0x19, 0x51, 0xEB, 0x90, 0x7A, 0xBE,
+    0x06, 0x28, 0xFF, 0x42, 0x1D, 0xF2, 0x4C, 0x23, 0x99, 0xA8, 0x10, 0x12, 0xD5, 0xD0, 0x11, 0x0E,
+    0x8B, 0xE4, 0xB7, 0xF9, 0xD5, 0xD4, 0x5E, 0x76, 0x37, 0xAA, 0x9E, 0x0A, 0xC2, 0x88, 0xFF, 0x19,
+    0x74, 0x84, 0x6E, 0x12, 0x48, 0xC6, 0x22, 0x89, 0xA2, 0x19, 0xD4, 0x28, 0xEB, 0xDA, 0x10, 0x59,
+    0xF3, 0x09, 0x29, 0x92, 0x37, 0x8C, 0x21, 0xB5, 0x39, 0xCF, 0x77, 0xBA, 0x07, 0x9F, 0x1A, 0xD1,
+    0x88, 0xCC, 0x32, 0x28, 0x3D, 0xA0, 0x2C, 0x50, 0x56, 0x8C, 0x2B, 0x75, 0xD4, 0x44, 0x63, 0x4A,
+    0x8B, 0xF2, 0xB1, 0x70, 0xE1, 0x2F, 0xF1, 0x66, 0xAA, 0x45, 0x9E, 0xCC, 0x8E, 0x49, 0x72, 0xF8,
+    0x31, 0x88, 0xAE, 0x39, 0x10, 0x9A, 0x59, 0xF4, 0x78, 0x5D, 0x1F, 0x6A, 0x85, 0x7B, 0x78, 0xAD,
+    0xA7, 0x3A, 0xD5, 0xEF, 0xFC, 0xA5, 0x38, 0xE3, 0xF7, 0x37, 0x04, 0x88, 0x91, 0xC4, 0x95, 0xF0,
+    0x08, 0xF8, 0x89, 0xF5, 0x40, 0x0C, 0x13, 0xB2, 0xEF, 0x03, 0x2E, 0x09, 0xF2, 0x1D, 0x86, 0x5E,
+    0x40, 0x53, 0xD9, 0x87, 0xCA, 0xC8, 0x2A, 0xC9, 0x33, 0xB6, 0xE6, 0xB5, 0xE4, 0x49, 0xC6, 0xF5,
+    0xBB, 0x5C, 0x95, 0xCB, 0x8A, 0x89, 0x24, 0x64, 0xCA, 0x4F, 0x52, 0x98, 0x6D, 0x50, 0x04, 0xAA,
+    0x09, 0x8D, 0x91, 0x36, 0xAF, 0x2A, 0x76, 0x3B, 0xA2, 0x21, 0x28, 0x02, 0xB6, 0x65, 0xB1, 0x53,
+    0xB8, 0xA0, 0xA0, 0x93, 0xEF, 0x69, 0x39, 0xB8, 0x13, 0x85, 0xEE, 0x6A, 0x2A, 0x92, 0x7F, 0x47,
+    0xD9, 0xE0, 0x65, 0x47, 0x1E, 0xAE, 0x37, 0x93, 0x6C, 0xAE, 0xA5, 0x8A, 0xB0, 0x96, 0x33, 0xF0,
+    0x76, 0xA1, 0x7E, 0x10, 0xAA, 0x95, 0x03, 0xBC, 0x3F, 0xF5, 0x43, 0x72, 0x9E, 0x9D, 0x54, 0x1D,
+    0x31, 0xE9, 0xF0, 0xA7, 0x23, 0x41, 0xA3, 0xB3, 0x8A, 0x08, 0xC5, 0xB7, 0x24, 0xC6, 0x77, 0x7E,
+    0x66, 0xB5, 0xE0, 0x47, 0xAA, 0x6D, 0xF2, 0x98, 0x45, 0xED, 0x7D, 0x2A, 0x09, 0xEF, 0x32, 0x3F,
+    0x1A, 0x5F, 0x65, 0xBE, 0x35, 0x3D, 0xDE, 0x78, 0x86, 0xAB, 0x73, 0x9C, 0xFB, 0x21, 0x00, 0x09,
+    0x96, 0x44, 0xBA, 0x26, 0xBC, 0xB3, 0xBB, 0x10, 0x67, 0x49, 0xC0, 0x96, 0x7A, 0x86, 0x29, 0x2E,
+    0x23, 0xDD, 0xCA, 0x32, 0xC8, 0xD0, 0x8D, 0x42, 0x81, 0x2F, 0x72, 0x78, 0x55, 0xAA, 0x61, 0x07,
+    0x58, 0x14, 0xA4, 0x0E, 0x11, 0x6A, 0xB7, 0x93, 0xB1, 0x5B, 0xD0, 0x53, 0x55, 0x4E, 0x50, 0xB3,
+    0x90, 0x8F, 0x5A, 0x4A, 0x4A, 0x4A, 0x2B, 0xF0, 0x75, 0x0C, 0xE0, 0x9C, 0x5F, 0x96, 0x4C, 0x7E,
+    0x3A, 0x98, 0x27, 0x63, 0xF9, 0xF4, 0xDE, 0xAE, 0x8A, 0xA2, 0xC1, 0x9C, 0x8E, 0xE5, 0xAF, 0x01,
+    0x46, 0x16, 0xBC, 0xBA, 0xFB, 0x4F, 0x07, 0xD7, 0xA7, 0xC5, 0xFD, 0x23, 0xD5, 0x1D, 0xE4, 0x04,
+    0x92, 0x51, 0x7C, 0x35, 0xF7, 0x8E, 0x55, 0xE8, 0x03, 0xFA, 0xD4, 0x6D, 0x94, 0xEB, 0x92, 0x66,
+    0x73, 0x84, 0x47, 0xE3, 0x5B, 0x88, 0xA7, 0xCB, 0xA3, 0xAA, 0x6D, 0x93, 0x82, 0xB8, 0x26, 0xB4,
+    0xC2, 0x7D, 0x71, 0xB7, 0xC5, 0xCC, 0xB7, 0xAB, 0xDD, 0x8A, 0x5D, 0xC9, 0x3F, 0x9D, 0x0B, 0x3E,
+    0xA8, 0xF3, 0x65, 0x77, 0x2A, 0xB6, 0xA5, 0x1F, 0xA5, 0x1B, 0x90, 0x5A, 0xEB, 0x97, 0xD5, 0x1B,
+    0x39, 0xC4, 0x6E, 0x51, 0x54, 0xDD, 0xCB, 0x3D, 0xE0, 0xCB, 0x05, 0xAC, 0x44, 0x02, 0xCE, 0x47,
+    0xE1, 0xA1, 0x74, 0x71, 0xF6, 0x0E, 0x12, 0x84, 0x1E, 0xD4, 0x82, 0x5E, 0x2D, 0xC6, 0xF9, 0x45,
+    0xE8, 0x14, 0x6C, 0x27, 0x38, 0x0C, 0x92, 0x80, 0x91, 0xB1, 0xFB, 0x01, 0xAA, 0xFD, 0x40, 0xA6,
+    0x19, 0xD2, 0x2B, 0x2A, 0x44, 0xEB, 0x7F, 0x5F, 0x05, 0x38, 0xA7, 0xEF, 0x70, 0xFD, 0x24, 0x6C,
+    0xC2, 0xA7, 0x0F, 0x74, 0xC8, 0x69, 0x80, 0xD5, 0xF4, 0x61, 0xD7, 0x39, 0xB6, 0xD7, 0xF1, 0x3C,
+    0xF9, 0x99, 0xCF, 0x84, 0x94, 0xCB, 0x22, 0x49, 0x85, 0x92, 0xCB, 0x0F, 0x3D, 0x79, 0xE4, 0xFD,
+    0xB9, 0xAA, 0x99, 0x12, 0x1D, 0xEE, 0xF5, 0x17, 0x0B, 0x45, 0xAE, 0x60, 0xD7, 0x9C, 0xF1, 0x99,
+    0xB7, 0x37, 0x04, 0x02, 0xE3, 0xA7, 0xEF, 0x71, 0x23, 0xE4, 0xE9, 0x3F,
+};
+
+static const uint32_t opendyslexic_14_regularBlockOffsets[37] = {
+    0, 1176, 2243, 3360, 4504, 5754, 6550, 7356,
+    8063, 8899, 9713, 10434, 11215, 12049, 12901, 13616,
+    14602, 15515, 16406, 17367, 18281, 19350, 20379, 21557,
+    22665, 23791, 24846, 25828, 26835, 27843, 28903, 29882,
+    30874, 31962, 33054, 34097, 35020,
+};
+
+static const uint16_t opendyslexic_14_regularDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_14_regularGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_14_regularPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
@@ -4474,706 +2363,706 @@ static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 16, 22, 19, 2, 22, 88, 1755 }, // 6
     { 14, 22, 18, 2, 22, 77, 1843 }, // 7
     { 17, 22, 20, 1, 22, 94, 1920 }, // 8
-    { 15, 22, 19, 2, 22, 83, 2014 }, // 9
-    { 6, 18, 8, 1, 18, 27, 2097 }, // :
-    { 8, 22, 9, 1, 17, 44, 2124 }, // ;
-    { 20, 17, 23, 2, 18, 85, 2168 }, // <
-    { 14, 10, 18, 2, 13, 35, 2253 }, // =
-    { 20, 17, 23, 2, 18, 85, 2288 }, // >
-    { 16, 33, 17, 0, 33, 132, 2373 }, // ?
-    { 26, 25, 35, 3, 23, 163, 2505 }, // @
-    { 23, 25, 33, 5, 25, 144, 2668 }, // A
-    { 19, 25, 28, 5, 25, 119, 2812 }, // B
-    { 20, 27, 29, 4, 26, 135, 2931 }, // C
-    { 23, 25, 32, 5, 25, 144, 3066 }, // D
-    { 17, 25, 27, 5, 25, 107, 3210 }, // E
-    { 15, 25, 25, 5, 25, 94, 3317 }, // F
-    { 23, 26, 33, 5, 26, 150, 3411 }, // G
-    { 21, 25, 31, 5, 25, 132, 3561 }, // H
-    { 6, 25, 13, 4, 25, 38, 3693 }, // I
-    { 12, 33, 22, 5, 26, 99, 3731 }, // J
-    { 20, 25, 30, 5, 25, 125, 3830 }, // K
-    { 16, 25, 27, 5, 25, 100, 3955 }, // L
-    { 26, 25, 36, 5, 25, 163, 4055 }, // M
-    { 21, 25, 31, 5, 25, 132, 4218 }, // N
-    { 23, 26, 33, 5, 25, 150, 4350 }, // O
-    { 17, 25, 27, 5, 25, 107, 4500 }, // P
-    { 25, 29, 30, 2, 25, 182, 4607 }, // Q
-    { 18, 25, 28, 5, 25, 113, 4789 }, // R
-    { 23, 27, 33, 5, 26, 156, 4902 }, // S
-    { 21, 25, 31, 5, 25, 132, 5058 }, // T
-    { 21, 26, 31, 5, 25, 137, 5190 }, // U
-    { 24, 25, 34, 5, 25, 150, 5327 }, // V
-    { 31, 25, 42, 5, 25, 194, 5477 }, // W
-    { 23, 25, 33, 5, 25, 144, 5671 }, // X
-    { 21, 25, 31, 5, 25, 132, 5815 }, // Y
-    { 23, 25, 33, 5, 25, 144, 5947 }, // Z
-    { 10, 41, 14, 2, 31, 103, 6091 }, // [
-    { 10, 28, 14, 2, 23, 70, 6194 }, // <backslash>
-    { 10, 41, 14, 2, 31, 103, 6264 }, // ]
-    { 12, 6, 16, 2, 27, 18, 6367 }, // ^
-    { 19, 4, 23, 2, -2, 19, 6385 }, // _
-    { 10, 5, 12, 1, 22, 13, 6404 }, // `
-    { 17, 17, 24, 3, 17, 73, 6417 }, // a
-    { 17, 26, 25, 4, 25, 111, 6490 }, // b
-    { 14, 18, 22, 4, 17, 63, 6601 }, // c
-    { 17, 26, 25, 4, 25, 111, 6664 }, // d
-    { 16, 17, 24, 4, 17, 68, 6775 }, // e
-    { 10, 24, 18, 4, 24, 60, 6843 }, // f
-    { 16, 23, 23, 4, 16, 92, 6903 }, // g
-    { 16, 25, 24, 4, 25, 100, 6995 }, // h
-    { 6, 26, 13, 4, 26, 39, 7095 }, // i
-    { 12, 33, 19, 4, 25, 99, 7134 }, // j
-    { 16, 24, 24, 4, 24, 96, 7233 }, // k
-    { 9, 24, 16, 3, 24, 54, 7329 }, // l
-    { 26, 16, 34, 4, 16, 104, 7383 }, // m
-    { 16, 17, 24, 4, 17, 68, 7487 }, // n
-    { 16, 16, 24, 4, 16, 64, 7555 }, // o
-    { 18, 24, 24, 2, 16, 108, 7619 }, // p
-    { 20, 25, 28, 4, 18, 125, 7727 }, // q
-    { 11, 16, 19, 4, 16, 44, 7852 }, // r
-    { 15, 16, 23, 4, 16, 60, 7896 }, // s
-    { 13, 22, 21, 4, 22, 72, 7956 }, // t
-    { 15, 17, 23, 4, 16, 64, 8028 }, // u
-    { 18, 16, 26, 4, 16, 72, 8092 }, // v
-    { 22, 16, 30, 4, 16, 88, 8164 }, // w
-    { 18, 16, 26, 4, 16, 72, 8252 }, // x
-    { 16, 24, 24, 4, 16, 96, 8324 }, // y
-    { 16, 16, 24, 4, 16, 64, 8420 }, // z
-    { 13, 27, 16, 2, 22, 88, 8484 }, // {
-    { 4, 25, 7, 2, 21, 25, 8572 }, // |
-    { 13, 27, 16, 2, 22, 88, 8597 }, // }
-    { 11, 6, 14, 1, 22, 17, 8685 }, // ~
-    { 0, 0, 25, 0, 0, 0, 8702 }, //  
-    { 7, 29, 10, 1, 22, 51, 8702 }, // ¡
-    { 14, 25, 22, 4, 22, 88, 8753 }, // ¢
-    { 18, 28, 20, 1, 28, 126, 8841 }, // £
-    { 16, 15, 20, 2, 18, 60, 8967 }, // ¤
-    { 18, 24, 22, 2, 22, 108, 9027 }, // ¥
-    { 4, 25, 7, 2, 21, 25, 9135 }, // ¦
-    { 16, 26, 24, 4, 23, 104, 9160 }, // §
-    { 14, 5, 16, 1, 23, 18, 9264 }, // ¨
-    { 12, 11, 16, 2, 26, 33, 9282 }, // ©
-    { 10, 10, 12, 2, 22, 25, 9315 }, // ª
-    { 15, 14, 19, 2, 14, 53, 9340 }, // «
-    { 14, 9, 18, 2, 10, 32, 9393 }, // ¬
-    { 14, 3, 16, 2, 10, 11, 9425 }, // ­
-    { 12, 11, 16, 2, 31, 33, 9436 }, // ®
-    { 11, 3, 15, 2, 21, 9, 9469 }, // ¯
-    { 14, 14, 16, 1, 23, 49, 9478 }, // °
-    { 14, 17, 18, 2, 16, 60, 9527 }, // ±
-    { 7, 11, 9, 1, 24, 20, 9587 }, // ²
-    { 8, 11, 9, 1, 23, 22, 9607 }, // ³
-    { 6, 6, 8, 1, 23, 9, 9629 }, // ´
-    { 16, 19, 23, 3, 16, 76, 9638 }, // µ
-    { 14, 24, 18, 2, 21, 84, 9714 }, // ¶
-    { 6, 5, 8, 1, 12, 8, 9798 }, // ·
-    { 6, 8, 10, 2, 1, 12, 9806 }, // ¸
-    { 7, 11, 8, 1, 24, 20, 9818 }, // ¹
-    { 9, 9, 12, 3, 21, 21, 9838 }, // º
-    { 15, 14, 19, 2, 14, 53, 9859 }, // »
-    { 24, 28, 32, 5, 26, 168, 9912 }, // ¼
-    { 25, 27, 32, 5, 25, 169, 10080 }, // ½
-    { 26, 27, 32, 3, 25, 176, 10249 }, // ¾
-    { 16, 32, 17, 0, 17, 128, 10425 }, // ¿
-    { 23, 33, 33, 5, 33, 190, 10553 }, // À
-    { 23, 38, 33, 5, 38, 219, 10743 }, // Á
-    { 23, 34, 33, 5, 34, 196, 10962 }, // Â
-    { 23, 33, 33, 5, 33, 190, 11158 }, // Ã
-    { 23, 33, 33, 5, 33, 190, 11348 }, // Ä
-    { 23, 35, 33, 5, 35, 202, 11538 }, // Å
-    { 32, 26, 42, 5, 25, 208, 11740 }, // Æ
-    { 20, 33, 29, 4, 26, 165, 11948 }, // Ç
-    { 17, 32, 27, 5, 32, 136, 12113 }, // È
-    { 17, 38, 27, 5, 38, 162, 12249 }, // É
-    { 17, 33, 27, 5, 33, 141, 12411 }, // Ê
-    { 17, 33, 27, 5, 33, 141, 12552 }, // Ë
-    { 10, 35, 13, 0, 35, 88, 12693 }, // Ì
-    { 6, 40, 13, 4, 40, 60, 12781 }, // Í
-    { 12, 36, 13, 0, 36, 108, 12841 }, // Î
-    { 14, 35, 13, -1, 35, 123, 12949 }, // Ï
-    { 27, 25, 32, 1, 25, 169, 13072 }, // Ð
-    { 21, 32, 31, 5, 32, 168, 13241 }, // Ñ
-    { 23, 33, 33, 5, 32, 190, 13409 }, // Ò
-    { 23, 38, 33, 5, 37, 219, 13599 }, // Ó
-    { 23, 34, 33, 5, 33, 196, 13818 }, // Ô
-    { 23, 33, 33, 5, 32, 190, 14014 }, // Õ
-    { 23, 33, 33, 5, 32, 190, 14204 }, // Ö
-    { 13, 8, 17, 2, 11, 26, 14394 }, // ×
-    { 36, 52, 35, -1, 38, 468, 14420 }, // Ø
-    { 21, 35, 31, 5, 34, 184, 14888 }, // Ù
-    { 21, 39, 31, 5, 38, 205, 15072 }, // Ú
-    { 21, 35, 31, 5, 34, 184, 15277 }, // Û
-    { 21, 35, 31, 5, 34, 184, 15461 }, // Ü
-    { 21, 39, 31, 5, 39, 205, 15645 }, // Ý
-    { 14, 23, 16, 1, 23, 81, 15850 }, // Þ
-    { 16, 23, 20, 2, 23, 92, 15931 }, // ß
-    { 17, 23, 24, 3, 23, 98, 16023 }, // à
-    { 17, 28, 24, 3, 28, 119, 16121 }, // á
-    { 17, 24, 24, 3, 24, 102, 16240 }, // â
-    { 17, 23, 24, 3, 23, 98, 16342 }, // ã
-    { 17, 23, 24, 3, 23, 98, 16440 }, // ä
-    { 17, 25, 24, 3, 25, 107, 16538 }, // å
-    { 29, 17, 36, 3, 17, 124, 16645 }, // æ
-    { 14, 24, 22, 4, 17, 84, 16769 }, // ç
-    { 16, 27, 24, 4, 27, 108, 16853 }, // è
-    { 16, 32, 24, 4, 32, 128, 16961 }, // é
-    { 16, 28, 24, 4, 28, 112, 17089 }, // ê
-    { 16, 27, 24, 4, 27, 108, 17201 }, // ë
-    { 10, 24, 13, 0, 24, 60, 17309 }, // ì
-    { 6, 29, 13, 4, 29, 44, 17369 }, // í
-    { 13, 25, 13, 0, 25, 82, 17413 }, // î
-    { 14, 25, 13, -1, 25, 88, 17495 }, // ï
-    { 22, 23, 24, 2, 23, 127, 17583 }, // ð
-    { 16, 25, 24, 4, 25, 100, 17710 }, // ñ
-    { 16, 26, 24, 4, 26, 104, 17810 }, // ò
-    { 16, 31, 24, 4, 31, 124, 17914 }, // ó
-    { 16, 27, 24, 4, 27, 108, 18038 }, // ô
-    { 16, 26, 24, 4, 26, 104, 18146 }, // õ
-    { 16, 26, 24, 4, 26, 104, 18250 }, // ö
-    { 18, 18, 22, 2, 18, 81, 18354 }, // ÷
-    { 17, 45, 24, 3, 30, 192, 18435 }, // ø
-    { 15, 25, 23, 4, 24, 94, 18627 }, // ù
-    { 15, 30, 23, 4, 29, 113, 18721 }, // ú
-    { 15, 26, 23, 4, 25, 98, 18834 }, // û
-    { 15, 25, 23, 4, 24, 94, 18932 }, // ü
-    { 16, 39, 24, 4, 31, 156, 19026 }, // ý
-    { 13, 30, 16, 2, 24, 98, 19182 }, // þ
-    { 16, 35, 24, 4, 27, 140, 19280 }, // ÿ
-    { 23, 32, 33, 5, 32, 184, 19420 }, // Ā
-    { 17, 22, 24, 3, 22, 94, 19604 }, // ā
-    { 23, 36, 33, 5, 36, 207, 19698 }, // Ă
-    { 17, 25, 24, 3, 25, 107, 19905 }, // ă
-    { 23, 32, 33, 5, 25, 184, 20012 }, // Ą
-    { 17, 22, 24, 3, 17, 94, 20196 }, // ą
-    { 20, 39, 29, 4, 38, 195, 20290 }, // Ć
-    { 14, 28, 22, 4, 27, 98, 20485 }, // ć
-    { 20, 37, 29, 4, 36, 185, 20583 }, // Ĉ
-    { 14, 25, 22, 4, 24, 88, 20768 }, // ĉ
-    { 20, 37, 29, 4, 36, 185, 20856 }, // Ċ
-    { 14, 26, 22, 4, 25, 91, 21041 }, // ċ
-    { 20, 39, 29, 4, 38, 195, 21132 }, // Č
-    { 14, 27, 22, 4, 26, 95, 21327 }, // č
-    { 23, 36, 32, 5, 36, 207, 21422 }, // Ď
-    { 22, 26, 25, 4, 25, 143, 21629 }, // ď
-    { 27, 25, 32, 1, 25, 169, 21772 }, // Đ
-    { 21, 26, 25, 4, 25, 137, 21941 }, // đ
-    { 17, 32, 27, 5, 32, 136, 22078 }, // Ē
-    { 16, 26, 24, 4, 26, 104, 22214 }, // ē
-    { 17, 35, 27, 5, 35, 149, 22318 }, // Ĕ
-    { 16, 30, 24, 4, 30, 120, 22467 }, // ĕ
-    { 17, 34, 27, 5, 34, 145, 22587 }, // Ė
-    { 16, 28, 24, 4, 28, 112, 22732 }, // ė
-    { 17, 31, 27, 5, 25, 132, 22844 }, // Ę
-    { 16, 24, 24, 4, 17, 96, 22976 }, // ę
-    { 17, 35, 27, 5, 35, 149, 23072 }, // Ě
-    { 16, 30, 24, 4, 30, 120, 23221 }, // ě
-    { 23, 34, 33, 5, 34, 196, 23341 }, // Ĝ
-    { 16, 32, 23, 4, 25, 128, 23537 }, // ĝ
-    { 23, 36, 33, 5, 36, 207, 23665 }, // Ğ
-    { 16, 33, 23, 4, 26, 132, 23872 }, // ğ
-    { 23, 34, 33, 5, 34, 196, 24004 }, // Ġ
-    { 16, 32, 23, 4, 25, 128, 24200 }, // ġ
-    { 23, 39, 33, 5, 26, 225, 24328 }, // Ģ
-    { 16, 34, 23, 4, 27, 136, 24553 }, // ģ
-    { 21, 33, 31, 5, 33, 174, 24689 }, // Ĥ
-    { 19, 31, 24, 1, 31, 148, 24863 }, // ĥ
-    { 24, 24, 31, 3, 24, 144, 25011 }, // Ħ
-    { 19, 25, 24, 1, 25, 119, 25155 }, // ħ
-    { 11, 36, 13, 1, 36, 99, 25274 }, // Ĩ
-    { 11, 25, 13, 1, 25, 69, 25373 }, // ĩ
-    { 14, 34, 13, -1, 34, 119, 25442 }, // Ī
-    { 14, 23, 13, 0, 23, 81, 25561 }, // ī
-    { 7, 31, 18, 7, 25, 55, 25642 }, // Į
-    { 7, 32, 13, 3, 26, 56, 25697 }, // į
-    { 7, 36, 13, 3, 36, 63, 25753 }, // İ
-    { 5, 17, 13, 4, 17, 22, 25816 }, // ı
-    { 18, 32, 27, 4, 25, 144, 25838 }, // Ĳ
-    { 22, 34, 13, 4, 26, 187, 25982 }, // ĳ
-    { 13, 39, 22, 5, 32, 127, 26169 }, // Ĵ
-    { 15, 32, 19, 4, 24, 120, 26296 }, // ĵ
-    { 20, 35, 30, 5, 25, 175, 26416 }, // Ķ
-    { 16, 37, 24, 4, 24, 148, 26591 }, // ķ
-    { 13, 16, 19, 3, 16, 52, 26739 }, // ĸ
-    { 16, 35, 27, 5, 35, 140, 26791 }, // Ĺ
-    { 9, 34, 16, 3, 34, 77, 26931 }, // ĺ
-    { 16, 38, 27, 5, 25, 152, 27008 }, // Ļ
-    { 9, 36, 16, 3, 24, 81, 27160 }, // ļ
-    { 16, 25, 27, 5, 25, 100, 27241 }, // Ľ
-    { 12, 25, 16, 3, 25, 75, 27341 }, // ľ
-    { 16, 25, 27, 5, 25, 100, 27416 }, // Ŀ
-    { 13, 24, 16, 3, 24, 78, 27516 }, // ŀ
-    { 28, 41, 27, -7, 32, 287, 27594 }, // Ł
-    { 19, 24, 16, -6, 24, 114, 27881 }, // ł
-    { 21, 35, 31, 5, 35, 184, 27995 }, // Ń
-    { 16, 28, 24, 4, 28, 112, 28179 }, // ń
-    { 21, 35, 31, 5, 25, 184, 28291 }, // Ņ
-    { 16, 27, 24, 4, 17, 108, 28475 }, // ņ
-    { 21, 35, 31, 5, 35, 184, 28583 }, // Ň
-    { 16, 28, 24, 4, 28, 112, 28767 }, // ň
-    { 16, 30, 20, 2, 30, 120, 28879 }, // ŉ
-    { 21, 30, 31, 5, 25, 158, 28999 }, // Ŋ
-    { 16, 23, 24, 4, 17, 92, 29157 }, // ŋ
-    { 23, 32, 33, 5, 31, 184, 29249 }, // Ō
-    { 16, 25, 24, 4, 25, 100, 29433 }, // ō
-    { 23, 36, 33, 5, 35, 207, 29533 }, // Ŏ
-    { 16, 29, 24, 4, 29, 116, 29740 }, // ŏ
-    { 24, 34, 33, 5, 33, 204, 29856 }, // Ő
-    { 22, 27, 24, 2, 27, 149, 30060 }, // ő
-    { 33, 25, 35, 5, 25, 207, 30209 }, // Œ
-    { 28, 17, 31, 4, 17, 119, 30416 }, // œ
-    { 18, 34, 28, 5, 34, 153, 30535 }, // Ŕ
-    { 11, 25, 19, 4, 25, 69, 30688 }, // ŕ
-    { 18, 39, 28, 5, 25, 176, 30757 }, // Ŗ
-    { 12, 31, 19, 3, 16, 93, 30933 }, // ŗ
-    { 18, 34, 28, 5, 34, 153, 31026 }, // Ř
-    { 13, 25, 19, 2, 25, 82, 31179 }, // ř
-    { 23, 38, 33, 5, 37, 219, 31261 }, // Ś
-    { 15, 26, 23, 4, 26, 98, 31480 }, // ś
-    { 23, 36, 33, 5, 35, 207, 31578 }, // Ŝ
-    { 15, 24, 23, 4, 24, 90, 31785 }, // ŝ
-    { 23, 33, 33, 5, 26, 190, 31875 }, // Ş
-    { 15, 24, 23, 4, 16, 90, 32065 }, // ş
-    { 23, 38, 33, 5, 37, 219, 32155 }, // Š
-    { 15, 26, 23, 4, 26, 98, 32374 }, // š
-    { 21, 31, 31, 5, 25, 163, 32472 }, // Ţ
-    { 13, 28, 21, 4, 22, 91, 32635 }, // ţ
-    { 21, 35, 31, 5, 35, 184, 32726 }, // Ť
-    { 14, 25, 21, 4, 25, 88, 32910 }, // ť
-    { 21, 25, 31, 5, 25, 132, 32998 }, // Ŧ
-    { 14, 22, 21, 3, 22, 77, 33130 }, // ŧ
-    { 21, 36, 31, 5, 35, 189, 33207 }, // Ũ
-    { 15, 26, 23, 4, 25, 98, 33396 }, // ũ
-    { 21, 34, 31, 5, 33, 179, 33494 }, // Ū
-    { 15, 24, 23, 4, 23, 90, 33673 }, // ū
-    { 21, 37, 31, 5, 36, 195, 33763 }, // Ŭ
-    { 15, 27, 23, 4, 26, 102, 33958 }, // ŭ
-    { 21, 38, 31, 5, 37, 200, 34060 }, // Ů
-    { 15, 28, 23, 4, 27, 105, 34260 }, // ů
-    { 22, 36, 31, 5, 35, 198, 34365 }, // Ű
-    { 22, 26, 23, 1, 25, 143, 34563 }, // ű
-    { 21, 31, 31, 5, 25, 163, 34706 }, // Ų
-    { 15, 23, 23, 4, 16, 87, 34869 }, // ų
-    { 31, 34, 42, 5, 34, 264, 34956 }, // Ŵ
-    { 22, 26, 30, 4, 26, 143, 35220 }, // ŵ
-    { 21, 35, 31, 5, 35, 184, 35363 }, // Ŷ
-    { 16, 35, 24, 4, 27, 140, 35547 }, // ŷ
-    { 21, 34, 31, 5, 34, 179, 35687 }, // Ÿ
-    { 23, 35, 33, 5, 35, 202, 35866 }, // Ź
-    { 16, 27, 24, 4, 27, 108, 36068 }, // ź
-    { 23, 33, 33, 5, 33, 190, 36176 }, // Ż
-    { 16, 25, 24, 4, 25, 100, 36366 }, // ż
-    { 23, 35, 33, 5, 35, 202, 36466 }, // Ž
-    { 16, 27, 24, 4, 27, 108, 36668 }, // ž
-    { 10, 24, 15, 4, 24, 60, 36776 }, // ſ
-    { 10, 5, 0, 1, 22, 13, 36836 }, // ̀
-    { 6, 6, 0, 1, 23, 9, 36849 }, // ́
-    { 12, 6, 0, 2, 0, 18, 36858 }, // ̂
-    { 11, 6, 0, 1, 22, 17, 36876 }, // ̃
-    { 14, 4, 0, 2, 20, 14, 36893 }, // ̄
-    { 19, 4, 0, 2, 26, 19, 36907 }, // ̅
-    { 12, 6, 0, 2, 21, 18, 36926 }, // ̆
-    { 6, 5, 0, 1, 22, 8, 36944 }, // ̇
-    { 14, 5, 0, 1, 23, 18, 36952 }, // ̈
-    { 7, 6, 0, 0, 19, 11, 36970 }, // ̉
-    { 7, 6, 0, 1, 22, 11, 36981 }, // ̊
-    { 22, 5, 0, 1, 22, 28, 36992 }, // ̋
-    { 12, 6, 0, 2, 22, 18, 37020 }, // ̌
-    { 22, 5, 0, -6, 24, 28, 37038 }, // ̏
-    { 7, 9, 0, 1, 22, 16, 37066 }, // ̒
-    { 8, 9, 0, 1, 22, 18, 37082 }, // ̓
-    { 7, 9, 0, 1, 22, 16, 37100 }, // ̔
-    { 5, 7, 0, 2, -1, 9, 37116 }, // ̘
-    { 5, 7, 0, 2, -1, 9, 37125 }, // ̙
-    { 12, 7, 0, 2, 23, 21, 37134 }, // ̚
-    { 4, 6, 0, 2, 18, 6, 37155 }, // ̛
-    { 3, 6, 0, 2, -2, 5, 37161 }, // ̜
-    { 7, 5, 0, 2, 3, 9, 37166 }, // ̝
-    { 7, 5, 0, 2, -1, 9, 37175 }, // ̞
-    { 6, 7, 0, 2, -2, 11, 37184 }, // ̟
-    { 14, 4, 0, 2, -4, 14, 37195 }, // ̠
-    { 6, 5, 0, 1, 1, 8, 37209 }, // ̣
-    { 14, 5, 0, 1, -1, 18, 37217 }, // ̤
-    { 7, 6, 0, 1, 22, 11, 37235 }, // ̥
-    { 8, 10, 0, 1, 5, 20, 37246 }, // ̦
-    { 6, 8, 0, 2, 1, 12, 37266 }, // ̧
-    { 6, 8, 0, 2, 1, 12, 37278 }, // ̨
-    { 4, 8, 0, 2, -2, 8, 37290 }, // ̩
-    { 9, 5, 0, 2, -1, 12, 37298 }, // ̪
-    { 12, 6, 0, 2, 0, 18, 37310 }, // ̬
-    { 13, 6, 0, 1, -1, 20, 37328 }, // ̭
-    { 11, 6, 0, 1, 22, 17, 37348 }, // ̰
-    { 11, 3, 0, 2, 21, 9, 37365 }, // ̱
-    { 12, 4, 0, 2, -2, 12, 37374 }, // ̲
-    { 11, 6, 0, 1, 22, 17, 37386 }, // ̴
-    { 14, 3, 0, 2, 10, 11, 37403 }, // ̵
-    { 3, 6, 0, 2, -2, 5, 37414 }, // ̹
-    { 9, 5, 0, 2, -1, 12, 37419 }, // ̺
-    { 9, 8, 0, 2, 0, 18, 37431 }, // ̻
-    { 9, 6, 0, 2, 0, 14, 37449 }, // ̼
-    { 7, 6, 0, 3, 22, 11, 37463 }, // ̽
-    { 11, 6, 0, 1, 22, 17, 37474 }, // ͂
-    { 4, 5, 0, 2, 24, 5, 37491 }, // ̓
-    { 14, 13, 0, 1, 31, 46, 37496 }, // ̈́
-    { 9, 5, 0, 2, 23, 12, 37542 }, // ͆
-    { 14, 11, 0, 2, 0, 39, 37554 }, // ͇
-    { 11, 8, 0, 2, 0, 22, 37593 }, // ͈
-    { 9, 7, 0, 2, -2, 16, 37615 }, // ͉
-    { 11, 16, 0, 1, 27, 44, 37631 }, // ͊
-    { 24, 13, 0, 1, 26, 78, 37675 }, // ͋
-    { 17, 15, 0, 3, 16, 64, 37753 }, // ͌
-    { 15, 7, 0, 2, -3, 27, 37817 }, // ͍
-    { 4, 4, 0, 2, 3, 4, 37844 }, // ͎
-    { 24, 6, 0, 2, 0, 36, 37848 }, // ͜
-    { 24, 6, 0, 2, 23, 36, 37884 }, // ͡
-    { 28, 7, 0, 2, -2, 49, 37920 }, // ͢
-    { 15, 30, 18, 2, 30, 113, 37969 }, // Ѐ
-    { 15, 28, 18, 2, 28, 105, 38082 }, // Ё
-    { 24, 24, 30, 3, 24, 144, 38187 }, // Ђ
-    { 15, 34, 19, 2, 34, 128, 38331 }, // Ѓ
-    { 20, 24, 27, 4, 23, 120, 38459 }, // Є
-    { 23, 27, 33, 5, 26, 156, 38579 }, // Ѕ
-    { 6, 25, 13, 4, 25, 38, 38735 }, // І
-    { 14, 35, 13, -1, 35, 123, 38773 }, // Ї
-    { 12, 33, 22, 5, 26, 99, 38896 }, // Ј
-    { 28, 23, 34, 3, 22, 161, 38995 }, // Љ
-    { 27, 22, 33, 3, 22, 149, 39156 }, // Њ
-    { 24, 25, 31, 5, 25, 150, 39305 }, // Ћ
-    { 20, 35, 30, 5, 35, 175, 39455 }, // Ќ
-    { 21, 33, 31, 5, 33, 174, 39630 }, // Ѝ
-    { 16, 34, 20, 2, 33, 136, 39804 }, // Ў
-    { 17, 27, 21, 2, 21, 115, 39940 }, // Џ
-    { 23, 25, 33, 5, 25, 144, 40055 }, // А
-    { 15, 21, 19, 2, 21, 79, 40199 }, // Б
-    { 16, 21, 20, 2, 21, 84, 40278 }, // В
-    { 15, 22, 19, 2, 22, 83, 40362 }, // Г
-    { 21, 24, 24, 2, 21, 126, 40445 }, // Д
-    { 15, 22, 18, 2, 22, 83, 40571 }, // Е
-    { 31, 25, 42, 5, 25, 194, 40654 }, // Ж
-    { 15, 22, 19, 2, 22, 83, 40848 }, // З
-    { 21, 25, 31, 5, 25, 132, 40931 }, // И
-    { 21, 35, 31, 5, 35, 184, 41063 }, // Й
-    { 20, 25, 30, 5, 25, 125, 41247 }, // К
-    { 17, 22, 22, 2, 21, 94, 41372 }, // Л
-    { 21, 21, 25, 2, 21, 111, 41466 }, // М
-    { 21, 25, 31, 5, 25, 132, 41577 }, // Н
-    { 23, 26, 33, 5, 25, 150, 41709 }, // О
-    { 16, 22, 20, 2, 22, 88, 41859 }, // П
-    { 17, 25, 27, 5, 25, 107, 41947 }, // Р
-    { 20, 27, 29, 4, 26, 135, 42054 }, // С
-    { 21, 25, 31, 5, 25, 132, 42189 }, // Т
-    { 16, 24, 20, 2, 23, 96, 42321 }, // У
-    { 22, 22, 25, 2, 22, 121, 42417 }, // Ф
-    { 23, 25, 33, 5, 25, 144, 42538 }, // Х
-    { 17, 27, 21, 2, 22, 115, 42682 }, // Ц
-    { 15, 22, 19, 2, 22, 83, 42797 }, // Ч
-    { 20, 22, 24, 2, 22, 110, 42880 }, // Ш
-    { 23, 27, 26, 2, 22, 156, 42990 }, // Щ
-    { 20, 22, 19, -3, 22, 110, 43146 }, // Ъ
-    { 27, 23, 33, 2, 23, 156, 43256 }, // Ы
-    { 15, 22, 19, 2, 22, 83, 43412 }, // Ь
-    { 20, 24, 27, 3, 23, 120, 43495 }, // Э
-    { 23, 22, 29, 3, 22, 127, 43615 }, // Ю
-    { 18, 25, 28, 5, 25, 113, 43742 }, // Я
-    { 17, 17, 24, 3, 17, 73, 43855 }, // а
-    { 17, 23, 20, 2, 23, 98, 43928 }, // б
-    { 14, 18, 21, 4, 18, 63, 44026 }, // в
-    { 14, 17, 17, 2, 17, 60, 44089 }, // г
-    { 18, 20, 22, 2, 17, 90, 44149 }, // д
-    { 16, 17, 24, 4, 17, 68, 44239 }, // е
-    { 27, 20, 35, 4, 20, 135, 44307 }, // ж
-    { 11, 16, 13, 1, 16, 44, 44442 }, // з
-    { 16, 17, 20, 2, 17, 68, 44486 }, // и
-    { 16, 22, 20, 2, 22, 88, 44554 }, // й
-    { 15, 17, 23, 4, 17, 64, 44642 }, // к
-    { 12, 16, 15, 1, 15, 48, 44706 }, // л
-    { 19, 19, 27, 4, 19, 91, 44754 }, // м
-    { 18, 19, 27, 4, 19, 86, 44845 }, // н
-    { 15, 16, 19, 2, 16, 60, 44931 }, // о
-    { 15, 17, 19, 2, 17, 64, 44991 }, // п
-    { 18, 24, 24, 2, 16, 108, 45055 }, // р
-    { 14, 18, 22, 4, 17, 63, 45163 }, // с
-    { 16, 16, 20, 2, 16, 64, 45226 }, // т
-    { 16, 24, 24, 4, 16, 96, 45290 }, // у
-    { 22, 23, 25, 2, 16, 127, 45386 }, // ф
-    { 17, 16, 21, 2, 16, 68, 45513 }, // х
-    { 17, 21, 21, 2, 17, 90, 45581 }, // ц
-    { 11, 15, 13, 1, 15, 42, 45671 }, // ч
-    { 20, 17, 24, 2, 17, 85, 45713 }, // ш
-    { 22, 22, 26, 2, 17, 121, 45798 }, // щ
-    { 18, 16, 22, 2, 16, 72, 45919 }, // ъ
-    { 20, 17, 24, 2, 17, 85, 45991 }, // ы
-    { 14, 17, 18, 2, 17, 60, 46076 }, // ь
-    { 15, 16, 19, 2, 16, 60, 46136 }, // э
-    { 19, 17, 23, 2, 17, 81, 46196 }, // ю
-    { 14, 16, 18, 2, 16, 56, 46277 }, // я
-    { 16, 28, 24, 4, 28, 112, 46333 }, // ѐ
-    { 15, 22, 19, 2, 22, 83, 46445 }, // ё
-    { 20, 29, 24, 1, 25, 145, 46528 }, // ђ
-    { 14, 25, 17, 2, 25, 88, 46673 }, // ѓ
-    { 15, 17, 19, 2, 16, 64, 46761 }, // є
-    { 15, 16, 23, 4, 16, 60, 46825 }, // ѕ
-    { 6, 26, 13, 4, 26, 39, 46885 }, // і
-    { 14, 25, 13, -1, 25, 88, 46924 }, // ї
-    { 12, 33, 19, 4, 25, 99, 47012 }, // ј
-    { 20, 16, 23, 2, 15, 80, 47111 }, // љ
-    { 19, 15, 23, 2, 15, 72, 47191 }, // њ
-    { 19, 25, 24, 1, 25, 119, 47263 }, // ћ
-    { 15, 26, 23, 4, 26, 98, 47382 }, // ќ
-    { 16, 25, 20, 2, 25, 100, 47480 }, // ѝ
-    { 16, 36, 24, 4, 28, 144, 47580 }, // ў
-    { 13, 20, 15, 1, 15, 65, 47724 }, // џ
-    { 17, 23, 24, 4, 22, 98, 47789 }, // Ѣ
-    { 17, 22, 21, 2, 21, 94, 47887 }, // ѣ
-    { 23, 21, 30, 3, 21, 121, 47981 }, // Ѫ
-    { 17, 15, 21, 2, 15, 64, 48102 }, // ѫ
-    { 21, 27, 31, 5, 26, 142, 48166 }, // Ѳ
-    { 16, 20, 24, 4, 20, 80, 48308 }, // ѳ
-    { 30, 33, 34, 5, 33, 248, 48388 }, // Ѵ
-    { 19, 20, 24, 3, 20, 95, 48636 }, // ѵ
-    { 10, 9, 0, 2, 27, 23, 48731 }, // ҆
-    { 15, 25, 19, 2, 25, 94, 48754 }, // Ґ
-    { 14, 20, 17, 2, 20, 70, 48848 }, // ґ
-    { 16, 22, 19, 1, 22, 88, 48918 }, // Ғ
-    { 12, 15, 13, 0, 15, 45, 49006 }, // ғ
-    { 17, 24, 20, 2, 24, 102, 49051 }, // Ҕ
-    { 10, 15, 12, 1, 15, 38, 49153 }, // ҕ
-    { 31, 29, 37, 3, 25, 225, 49191 }, // Җ
-    { 22, 21, 26, 2, 18, 116, 49416 }, // җ
-    { 15, 25, 21, 3, 22, 94, 49532 }, // Ҙ
-    { 11, 23, 13, 1, 16, 64, 49626 }, // ҙ
-    { 20, 29, 26, 3, 25, 145, 49690 }, // Қ
-    { 14, 21, 18, 2, 18, 74, 49835 }, // қ
-    { 22, 21, 28, 3, 21, 116, 49909 }, // Ҝ
-    { 17, 15, 21, 2, 15, 64, 50025 }, // ҝ
-    { 21, 25, 30, 4, 25, 132, 50089 }, // Ҟ
-    { 19, 23, 24, 1, 23, 110, 50221 }, // ҟ
-    { 27, 25, 30, -2, 25, 169, 50331 }, // Ҡ
-    { 19, 18, 20, -2, 18, 86, 50500 }, // ҡ
-    { 22, 28, 27, 3, 25, 154, 50586 }, // Ң
-    { 15, 20, 19, 2, 17, 75, 50740 }, // ң
-    { 30, 26, 31, 5, 26, 195, 50815 }, // Ҥ
-    { 21, 17, 22, 3, 17, 90, 51010 }, // ҥ
-    { 28, 24, 34, 3, 24, 168, 51100 }, // Ҧ
-    { 27, 27, 31, 2, 19, 183, 51268 }, // ҧ
-    { 29, 25, 35, 3, 24, 182, 51451 }, // Ҩ
-    { 23, 20, 27, 2, 19, 115, 51633 }, // ҩ
-    { 20, 31, 29, 4, 26, 155, 51748 }, // Ҫ
-    { 14, 21, 22, 4, 17, 74, 51903 }, // ҫ
-    { 21, 28, 27, 3, 25, 147, 51977 }, // Ҭ
-    { 15, 19, 19, 2, 17, 72, 52124 }, // ҭ
-    { 21, 25, 31, 5, 25, 132, 52196 }, // Ү
-    { 16, 21, 19, 2, 15, 84, 52328 }, // ү
-    { 21, 25, 31, 5, 25, 132, 52412 }, // Ұ
-    { 17, 22, 19, 1, 15, 94, 52544 }, // ұ
-    { 24, 29, 29, 3, 25, 174, 52638 }, // Ҳ
-    { 17, 20, 20, 2, 17, 85, 52812 }, // ҳ
-    { 25, 27, 31, 3, 21, 169, 52897 }, // Ҵ
-    { 18, 19, 22, 2, 15, 86, 53066 }, // ҵ
-    { 19, 28, 24, 2, 21, 133, 53152 }, // Ҷ
-    { 14, 20, 17, 1, 15, 70, 53285 }, // ҷ
-    { 17, 22, 21, 2, 22, 94, 53355 }, // Ҹ
-    { 12, 15, 15, 1, 15, 45, 53449 }, // ҹ
-    { 16, 24, 22, 3, 24, 96, 53494 }, // Һ
-    { 16, 25, 24, 4, 25, 100, 53590 }, // һ
-    { 25, 22, 28, 0, 21, 138, 53690 }, // Ҽ
-    { 18, 16, 20, 0, 16, 72, 53828 }, // ҽ
-    { 26, 25, 32, 3, 21, 163, 53900 }, // Ҿ
-    { 19, 19, 23, 2, 16, 91, 54063 }, // ҿ
-    { 6, 25, 13, 4, 25, 38, 54154 }, // Ӏ
-    { 31, 35, 42, 5, 35, 272, 54192 }, // Ӂ
-    { 27, 31, 35, 4, 31, 210, 54464 }, // ӂ
-    { 17, 29, 23, 3, 22, 124, 54674 }, // Ӄ
-    { 12, 20, 16, 2, 15, 60, 54798 }, // ӄ
-    { 21, 27, 22, 2, 22, 142, 54858 }, // Ӆ
-    { 14, 18, 15, 2, 15, 63, 55000 }, // ӆ
-    { 23, 32, 31, 5, 25, 184, 55063 }, // Ӈ
-    { 16, 22, 22, 3, 17, 88, 55247 }, // ӈ
-    { 23, 34, 31, 5, 25, 196, 55335 }, // Ӊ
-    { 16, 23, 22, 3, 17, 92, 55531 }, // ӊ
-    { 16, 27, 20, 1, 21, 108, 55623 }, // Ӌ
-    { 11, 18, 15, 2, 15, 50, 55731 }, // ӌ
-    { 28, 34, 36, 5, 25, 238, 55781 }, // Ӎ
-    { 20, 23, 25, 3, 17, 115, 56019 }, // ӎ
-    { 4, 21, 8, 2, 21, 21, 56134 }, // ӏ
-    { 23, 35, 33, 5, 35, 202, 56155 }, // Ӑ
-    { 17, 26, 24, 3, 26, 111, 56357 }, // ӑ
-    { 23, 34, 33, 5, 34, 196, 56468 }, // Ӓ
-    { 17, 25, 24, 3, 25, 107, 56664 }, // ӓ
-    { 32, 26, 42, 5, 25, 208, 56771 }, // Ӕ
-    { 29, 17, 36, 3, 17, 124, 56979 }, // ӕ
-    { 15, 31, 18, 2, 31, 117, 57103 }, // Ӗ
-    { 16, 29, 24, 4, 29, 116, 57220 }, // ӗ
-    { 16, 17, 24, 4, 16, 68, 57336 }, // Ә
-    { 16, 18, 24, 5, 17, 72, 57404 }, // ә
-    { 16, 29, 24, 4, 28, 116, 57476 }, // Ӛ
-    { 16, 20, 24, 5, 17, 80, 57592 }, // ӛ
-    { 31, 34, 38, 5, 34, 264, 57672 }, // Ӝ
-    { 27, 29, 35, 4, 29, 196, 57936 }, // ӝ
-    { 15, 30, 19, 2, 30, 113, 58132 }, // Ӟ
-    { 14, 24, 13, 1, 24, 84, 58245 }, // ӟ
-    { 14, 22, 17, 2, 21, 77, 58329 }, // Ӡ
-    { 14, 22, 17, 2, 16, 77, 58406 }, // ӡ
-    { 21, 31, 31, 5, 31, 163, 58483 }, // Ӣ
-    { 16, 23, 20, 2, 23, 92, 58646 }, // ӣ
-    { 21, 33, 31, 5, 33, 174, 58738 }, // Ӥ
-    { 16, 24, 20, 2, 24, 96, 58912 }, // ӥ
-    { 23, 34, 33, 5, 33, 196, 59008 }, // Ӧ
-    { 15, 25, 19, 2, 25, 94, 59204 }, // ӧ
-    { 21, 22, 31, 5, 21, 116, 59298 }, // Ө
-    { 16, 16, 24, 4, 16, 64, 59414 }, // ө
-    { 21, 34, 31, 5, 33, 179, 59478 }, // Ӫ
-    { 16, 27, 24, 4, 27, 108, 59657 }, // ӫ
-    { 20, 32, 27, 3, 31, 160, 59765 }, // Ӭ
-    { 16, 24, 19, 1, 24, 96, 59925 }, // ӭ
-    { 16, 31, 20, 2, 30, 124, 60021 }, // Ӯ
-    { 16, 33, 24, 4, 25, 132, 60145 }, // ӯ
-    { 16, 32, 20, 2, 31, 128, 60277 }, // Ӱ
-    { 16, 35, 24, 4, 27, 140, 60405 }, // ӱ
-    { 22, 33, 20, 0, 32, 182, 60545 }, // Ӳ
-    { 21, 36, 24, 3, 28, 189, 60727 }, // ӳ
-    { 15, 30, 19, 2, 30, 113, 60916 }, // Ӵ
-    { 14, 24, 13, -1, 24, 84, 61029 }, // ӵ
-    { 15, 26, 19, 2, 22, 98, 61113 }, // Ӷ
-    { 11, 18, 13, 1, 15, 50, 61211 }, // ӷ
-    { 27, 32, 33, 2, 32, 216, 61261 }, // Ӹ
-    { 20, 26, 24, 2, 26, 130, 61477 }, // ӹ
-    { 28, 28, 33, 5, 25, 196, 61607 }, // Ӽ
-    { 20, 20, 23, 3, 18, 100, 61803 }, // ӽ
-    { 0, 0, 24, 0, 0, 0, 61903 }, //  
-    { 0, 0, 39, 0, 0, 0, 61903 }, //  
-    { 0, 0, 24, 0, 0, 0, 61903 }, //  
-    { 0, 0, 39, 0, 0, 0, 61903 }, //  
-    { 0, 0, 19, 0, 0, 0, 61903 }, //  
-    { 0, 0, 17, 0, 0, 0, 61903 }, //  
-    { 0, 0, 14, 0, 0, 0, 61903 }, //  
-    { 0, 0, 19, 0, 0, 0, 61903 }, //  
-    { 0, 0, 8, 0, 0, 0, 61903 }, //  
-    { 0, 0, 15, 0, 0, 0, 61903 }, //  
-    { 0, 0, 14, 0, 0, 0, 61903 }, //  
-    { 0, 0, 9, 0, 0, 0, 61903 }, // ​
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‏
-    { 14, 3, 16, 2, 10, 11, 61903 }, // ‐
-    { 14, 3, 16, 2, 10, 11, 61914 }, // ‑
-    { 20, 3, 22, 2, 10, 15, 61925 }, // ‒
-    { 19, 4, 23, 2, 10, 19, 61940 }, // –
-    { 29, 4, 33, 2, 10, 29, 61959 }, // —
-    { 29, 4, 33, 2, 10, 29, 61988 }, // ―
-    { 12, 25, 16, 2, 21, 75, 62017 }, // ‖
-    { 21, 9, 23, 2, -3, 48, 62092 }, // ‗
-    { 8, 9, 10, 1, 25, 18, 62140 }, // ‘
-    { 8, 9, 10, 1, 25, 18, 62158 }, // ’
-    { 8, 10, 9, 1, 5, 20, 62176 }, // ‚
-    { 8, 9, 10, 1, 25, 18, 62196 }, // ‛
-    { 15, 9, 16, 1, 25, 34, 62214 }, // “
-    { 15, 9, 17, 1, 25, 34, 62248 }, // ”
-    { 8, 10, 9, 1, 5, 20, 62282 }, // „
-    { 15, 9, 17, 1, 25, 34, 62302 }, // ‟
-    { 15, 38, 17, 1, 30, 143, 62336 }, // †
-    { 16, 38, 18, 1, 30, 152, 62479 }, // ‡
-    { 17, 17, 15, -1, 20, 73, 62631 }, // •
-    { 8, 9, 11, 2, 13, 18, 62704 }, // ‣
-    { 6, 5, 8, 1, 5, 8, 62722 }, // ․
-    { 6, 5, 8, 1, 5, 8, 62730 }, // ‥
-    { 26, 5, 28, 1, 5, 33, 62738 }, // …
-    { 4, 3, 7, 2, 10, 3, 62771 }, // ‧
-    { 0, 0, 37, 0, 0, 0, 62774 }, //  
-    { 18, 25, 32, 7, 23, 113, 62774 }, // ‰
-    { 8, 9, 9, 1, 25, 18, 62887 }, // ′
-    { 15, 9, 16, 1, 25, 34, 62905 }, // ″
-    { 23, 9, 25, 1, 25, 52, 62939 }, // ‴
-    { 8, 9, 10, 1, 24, 18, 62991 }, // ‵
-    { 14, 9, 15, 0, 24, 32, 63009 }, // ‶
-    { 23, 9, 25, 1, 25, 52, 63041 }, // ‷
-    { 12, 5, 16, 2, 23, 15, 63093 }, // ‸
-    { 8, 14, 12, 2, 15, 28, 63108 }, // ‹
-    { 8, 14, 12, 2, 15, 28, 63136 }, // ›
-    { 30, 29, 39, 6, 26, 218, 63164 }, // ※
-    { 7, 29, 10, 1, 29, 51, 63382 }, // ‼
-    { 16, 37, 22, 2, 35, 148, 63433 }, // ‽
-    { 14, 4, 16, 2, 24, 14, 63581 }, // ‾
-    { 12, 6, 16, 2, 20, 18, 63595 }, // ‿
-    { 19, 18, 23, 2, 25, 86, 63613 }, // ⁂
-    { 17, 24, 32, 8, 22, 102, 63699 }, // ⁄
-    { 33, 33, 37, 2, 33, 273, 63801 }, // ⁇
-    { 22, 33, 29, 2, 33, 182, 64074 }, // ⁈
-    { 22, 35, 24, 1, 33, 193, 64256 }, // ⁉
-    { 17, 46, 22, 2, 32, 196, 64449 }, // ⁒
-    { 0, 0, 141, 0, 0, 0, 64645 }, //  
-    { 8, 11, 9, 1, 24, 22, 64645 }, // ⁰
-    { 8, 11, 9, 1, 24, 22, 64667 }, // ⁴
-    { 8, 12, 9, 1, 25, 24, 64689 }, // ⁵
-    { 8, 11, 9, 1, 24, 22, 64713 }, // ⁶
-    { 8, 13, 10, 1, 25, 26, 64735 }, // ⁷
-    { 9, 11, 10, 0, 24, 25, 64761 }, // ⁸
-    { 8, 11, 10, 1, 24, 22, 64786 }, // ⁹
-    { 16, 17, 24, 4, 17, 68, 64808 }, // ⁿ
-    { 11, 15, 13, 1, 15, 42, 64876 }, // ₀
-    { 7, 12, 9, 1, 7, 21, 64918 }, // ₁
-    { 8, 12, 10, 1, 7, 24, 64939 }, // ₂
-    { 8, 11, 9, 1, 6, 22, 64963 }, // ₃
-    { 8, 11, 10, 1, 6, 22, 64985 }, // ₄
-    { 7, 12, 9, 1, 7, 21, 65007 }, // ₅
-    { 8, 12, 10, 1, 7, 24, 65028 }, // ₆
-    { 8, 12, 10, 1, 7, 24, 65052 }, // ₇
-    { 9, 11, 10, 0, 6, 25, 65076 }, // ₈
-    { 8, 11, 10, 1, 6, 22, 65101 }, // ₉
-    { 10, 39, 13, 2, 29, 98, 65123 }, // ₍
-    { 9, 39, 13, 1, 29, 88, 65221 }, // ₎
-    { 20, 37, 29, 4, 31, 185, 65309 }, // ₡
-    { 20, 27, 29, 4, 26, 135, 65494 }, // ₢
-    { 18, 28, 20, 1, 28, 126, 65629 }, // ₤
-    { 28, 25, 31, 2, 25, 175, 65755 }, // ₦
-    { 23, 25, 27, 1, 25, 144, 65930 }, // ₧
-    { 29, 24, 33, 4, 24, 174, 66074 }, // ₨
-    { 22, 24, 25, 1, 24, 132, 66248 }, // ₩
-    { 23, 23, 31, 4, 23, 133, 66380 }, // ₪
-    { 19, 23, 20, 2, 23, 110, 66513 }, // ₫
-    { 18, 26, 22, 2, 23, 117, 66623 }, // €
-    { 21, 25, 31, 5, 25, 132, 66740 }, // ₮
-    { 26, 25, 19, 0, 25, 163, 66872 }, // ₱
-    { 23, 34, 33, 5, 30, 196, 67035 }, // ₲
-    { 26, 27, 27, 2, 26, 176, 67231 }, // ₴
-    { 14, 22, 22, 4, 20, 77, 67407 }, // ₵
-    { 21, 26, 31, 5, 26, 137, 67484 }, // ₸
-    { 14, 22, 18, 2, 22, 77, 67621 }, // ₹
-    { 16, 21, 20, 2, 20, 84, 67698 }, // ₺
-    { 18, 23, 18, 0, 23, 104, 67782 }, // ₼
-    { 23, 25, 27, -1, 25, 144, 67886 }, // ₽
-    { 18, 18, 22, 2, 16, 81, 68030 }, // ←
-    { 18, 18, 22, 2, 18, 81, 68111 }, // ↑
-    { 18, 18, 22, 2, 16, 81, 68192 }, // →
-    { 18, 18, 22, 2, 18, 81, 68273 }, // ↓
-    { 22, 16, 26, 2, 16, 88, 68354 }, // ↔
-    { 15, 23, 19, 2, 23, 87, 68442 }, // ↕
-    { 15, 14, 19, 2, 15, 53, 68529 }, // ↖
-    { 15, 14, 19, 2, 15, 53, 68582 }, // ↗
-    { 15, 15, 19, 2, 16, 57, 68635 }, // ↘
-    { 15, 15, 19, 2, 16, 57, 68692 }, // ↙
-    { 21, 19, 25, 2, 18, 100, 68749 }, // ⇐
-    { 23, 21, 27, 2, 21, 121, 68849 }, // ⇑
-    { 21, 19, 25, 2, 18, 100, 68970 }, // ⇒
-    { 23, 22, 27, 2, 21, 127, 69070 }, // ⇓
-    { 24, 19, 28, 2, 18, 114, 69197 }, // ⇔
-    { 19, 24, 23, 2, 16, 114, 69311 }, // ⇕
-    { 16, 23, 20, 2, 23, 92, 69425 }, // ∂
-    { 29, 28, 33, 2, 26, 203, 69517 }, // ∅
-    { 21, 22, 25, 2, 22, 116, 69720 }, // ∆
-    { 18, 21, 22, 2, 21, 95, 69836 }, // ∏
-    { 18, 21, 22, 2, 21, 95, 69931 }, // ∐
-    { 14, 22, 17, 2, 21, 77, 70026 }, // ∑
-    { 14, 4, 18, 2, 10, 14, 70103 }, // −
-    { 23, 25, 27, 2, 23, 144, 70117 }, // √
-    { 23, 15, 27, 2, 18, 87, 70261 }, // ∞
-    { 24, 33, 25, 1, 26, 198, 70348 }, // ∫
-    { 6, 18, 8, 1, 18, 27, 70546 }, // ∶
-    { 17, 15, 23, 3, 16, 64, 70573 }, // ≈
-    { 19, 24, 32, 7, 22, 114, 70637 }, // ≠
-    { 21, 22, 25, 2, 20, 116, 70751 }, // ≤
-    { 21, 22, 25, 2, 20, 116, 70867 }, // ≥
+    { 15, 22, 19, 2, 22, 83, 2048 }, // 9
+    { 6, 18, 8, 1, 18, 27, 2131 }, // :
+    { 8, 22, 9, 1, 17, 44, 2158 }, // ;
+    { 20, 17, 23, 2, 18, 85, 2202 }, // <
+    { 14, 10, 18, 2, 13, 35, 2287 }, // =
+    { 20, 17, 23, 2, 18, 85, 2322 }, // >
+    { 16, 33, 17, 0, 33, 132, 2407 }, // ?
+    { 26, 25, 35, 3, 23, 163, 2539 }, // @
+    { 23, 25, 33, 5, 25, 144, 2702 }, // A
+    { 19, 25, 28, 5, 25, 119, 2846 }, // B
+    { 20, 27, 29, 4, 26, 135, 2965 }, // C
+    { 23, 25, 32, 5, 25, 144, 3100 }, // D
+    { 17, 25, 27, 5, 25, 107, 3244 }, // E
+    { 15, 25, 25, 5, 25, 94, 3351 }, // F
+    { 23, 26, 33, 5, 26, 150, 3445 }, // G
+    { 21, 25, 31, 5, 25, 132, 3595 }, // H
+    { 6, 25, 13, 4, 25, 38, 3727 }, // I
+    { 12, 33, 22, 5, 26, 99, 3765 }, // J
+    { 20, 25, 30, 5, 25, 125, 3864 }, // K
+    { 16, 25, 27, 5, 25, 100, 3989 }, // L
+    { 26, 25, 36, 5, 25, 163, 4096 }, // M
+    { 21, 25, 31, 5, 25, 132, 4259 }, // N
+    { 23, 26, 33, 5, 25, 150, 4391 }, // O
+    { 17, 25, 27, 5, 25, 107, 4541 }, // P
+    { 25, 29, 30, 2, 25, 182, 4648 }, // Q
+    { 18, 25, 28, 5, 25, 113, 4830 }, // R
+    { 23, 27, 33, 5, 26, 156, 4943 }, // S
+    { 21, 25, 31, 5, 25, 132, 5099 }, // T
+    { 21, 26, 31, 5, 25, 137, 5231 }, // U
+    { 24, 25, 34, 5, 25, 150, 5368 }, // V
+    { 31, 25, 42, 5, 25, 194, 5518 }, // W
+    { 23, 25, 33, 5, 25, 144, 5712 }, // X
+    { 21, 25, 31, 5, 25, 132, 5856 }, // Y
+    { 23, 25, 33, 5, 25, 144, 5988 }, // Z
+    { 10, 41, 14, 2, 31, 103, 6144 }, // [
+    { 10, 28, 14, 2, 23, 70, 6247 }, // <backslash>
+    { 10, 41, 14, 2, 31, 103, 6317 }, // ]
+    { 12, 6, 16, 2, 27, 18, 6420 }, // ^
+    { 19, 4, 23, 2, -2, 19, 6438 }, // _
+    { 10, 5, 12, 1, 22, 13, 6457 }, // `
+    { 17, 17, 24, 3, 17, 73, 6470 }, // a
+    { 17, 26, 25, 4, 25, 111, 6543 }, // b
+    { 14, 18, 22, 4, 17, 63, 6654 }, // c
+    { 17, 26, 25, 4, 25, 111, 6717 }, // d
+    { 16, 17, 24, 4, 17, 68, 6828 }, // e
+    { 10, 24, 18, 4, 24, 60, 6896 }, // f
+    { 16, 23, 23, 4, 16, 92, 6956 }, // g
+    { 16, 25, 24, 4, 25, 100, 7048 }, // h
+    { 6, 26, 13, 4, 26, 39, 7148 }, // i
+    { 12, 33, 19, 4, 25, 99, 7187 }, // j
+    { 16, 24, 24, 4, 24, 96, 7286 }, // k
+    { 9, 24, 16, 3, 24, 54, 7382 }, // l
+    { 26, 16, 34, 4, 16, 104, 7436 }, // m
+    { 16, 17, 24, 4, 17, 68, 7540 }, // n
+    { 16, 16, 24, 4, 16, 64, 7608 }, // o
+    { 18, 24, 24, 2, 16, 108, 7672 }, // p
+    { 20, 25, 28, 4, 18, 125, 7780 }, // q
+    { 11, 16, 19, 4, 16, 44, 7905 }, // r
+    { 15, 16, 23, 4, 16, 60, 7949 }, // s
+    { 13, 22, 21, 4, 22, 72, 8009 }, // t
+    { 15, 17, 23, 4, 16, 64, 8081 }, // u
+    { 18, 16, 26, 4, 16, 72, 8192 }, // v
+    { 22, 16, 30, 4, 16, 88, 8264 }, // w
+    { 18, 16, 26, 4, 16, 72, 8352 }, // x
+    { 16, 24, 24, 4, 16, 96, 8424 }, // y
+    { 16, 16, 24, 4, 16, 64, 8520 }, // z
+    { 13, 27, 16, 2, 22, 88, 8584 }, // {
+    { 4, 25, 7, 2, 21, 25, 8672 }, // |
+    { 13, 27, 16, 2, 22, 88, 8697 }, // }
+    { 11, 6, 14, 1, 22, 17, 8785 }, // ~
+    { 0, 0, 25, 0, 0, 0, 8802 }, //  
+    { 7, 29, 10, 1, 22, 51, 8802 }, // ¡
+    { 14, 25, 22, 4, 22, 88, 8853 }, // ¢
+    { 18, 28, 20, 1, 28, 126, 8941 }, // £
+    { 16, 15, 20, 2, 18, 60, 9067 }, // ¤
+    { 18, 24, 22, 2, 22, 108, 9127 }, // ¥
+    { 4, 25, 7, 2, 21, 25, 9235 }, // ¦
+    { 16, 26, 24, 4, 23, 104, 9260 }, // §
+    { 14, 5, 16, 1, 23, 18, 9364 }, // ¨
+    { 12, 11, 16, 2, 26, 33, 9382 }, // ©
+    { 10, 10, 12, 2, 22, 25, 9415 }, // ª
+    { 15, 14, 19, 2, 14, 53, 9440 }, // «
+    { 14, 9, 18, 2, 10, 32, 9493 }, // ¬
+    { 14, 3, 16, 2, 10, 11, 9525 }, // ­
+    { 12, 11, 16, 2, 31, 33, 9536 }, // ®
+    { 11, 3, 15, 2, 21, 9, 9569 }, // ¯
+    { 14, 14, 16, 1, 23, 49, 9578 }, // °
+    { 14, 17, 18, 2, 16, 60, 9627 }, // ±
+    { 7, 11, 9, 1, 24, 20, 9687 }, // ²
+    { 8, 11, 9, 1, 23, 22, 9707 }, // ³
+    { 6, 6, 8, 1, 23, 9, 9729 }, // ´
+    { 16, 19, 23, 3, 16, 76, 9738 }, // µ
+    { 14, 24, 18, 2, 21, 84, 9814 }, // ¶
+    { 6, 5, 8, 1, 12, 8, 9898 }, // ·
+    { 6, 8, 10, 2, 1, 12, 9906 }, // ¸
+    { 7, 11, 8, 1, 24, 20, 9918 }, // ¹
+    { 9, 9, 12, 3, 21, 21, 9938 }, // º
+    { 15, 14, 19, 2, 14, 53, 9959 }, // »
+    { 24, 28, 32, 5, 26, 168, 10012 }, // ¼
+    { 25, 27, 32, 5, 25, 169, 10240 }, // ½
+    { 26, 27, 32, 3, 25, 176, 10409 }, // ¾
+    { 16, 32, 17, 0, 17, 128, 10585 }, // ¿
+    { 23, 33, 33, 5, 33, 190, 10713 }, // À
+    { 23, 38, 33, 5, 38, 219, 10903 }, // Á
+    { 23, 34, 33, 5, 34, 196, 11122 }, // Â
+    { 23, 33, 33, 5, 33, 190, 11318 }, // Ã
+    { 23, 33, 33, 5, 33, 190, 11508 }, // Ä
+    { 23, 35, 33, 5, 35, 202, 11698 }, // Å
+    { 32, 26, 42, 5, 25, 208, 11900 }, // Æ
+    { 20, 33, 29, 4, 26, 165, 12108 }, // Ç
+    { 17, 32, 27, 5, 32, 136, 12288 }, // È
+    { 17, 38, 27, 5, 38, 162, 12424 }, // É
+    { 17, 33, 27, 5, 33, 141, 12586 }, // Ê
+    { 17, 33, 27, 5, 33, 141, 12727 }, // Ë
+    { 10, 35, 13, 0, 35, 88, 12868 }, // Ì
+    { 6, 40, 13, 4, 40, 60, 12956 }, // Í
+    { 12, 36, 13, 0, 36, 108, 13016 }, // Î
+    { 14, 35, 13, -1, 35, 123, 13124 }, // Ï
+    { 27, 25, 32, 1, 25, 169, 13247 }, // Ð
+    { 21, 32, 31, 5, 32, 168, 13416 }, // Ñ
+    { 23, 33, 33, 5, 32, 190, 13584 }, // Ò
+    { 23, 38, 33, 5, 37, 219, 13774 }, // Ó
+    { 23, 34, 33, 5, 33, 196, 13993 }, // Ô
+    { 23, 33, 33, 5, 32, 190, 14336 }, // Õ
+    { 23, 33, 33, 5, 32, 190, 14526 }, // Ö
+    { 13, 8, 17, 2, 11, 26, 14716 }, // ×
+    { 36, 52, 35, -1, 38, 468, 14742 }, // Ø
+    { 21, 35, 31, 5, 34, 184, 15210 }, // Ù
+    { 21, 39, 31, 5, 38, 205, 15394 }, // Ú
+    { 21, 35, 31, 5, 34, 184, 15599 }, // Û
+    { 21, 35, 31, 5, 34, 184, 15783 }, // Ü
+    { 21, 39, 31, 5, 39, 205, 15967 }, // Ý
+    { 14, 23, 16, 1, 23, 81, 16172 }, // Þ
+    { 16, 23, 20, 2, 23, 92, 16253 }, // ß
+    { 17, 23, 24, 3, 23, 98, 16384 }, // à
+    { 17, 28, 24, 3, 28, 119, 16482 }, // á
+    { 17, 24, 24, 3, 24, 102, 16601 }, // â
+    { 17, 23, 24, 3, 23, 98, 16703 }, // ã
+    { 17, 23, 24, 3, 23, 98, 16801 }, // ä
+    { 17, 25, 24, 3, 25, 107, 16899 }, // å
+    { 29, 17, 36, 3, 17, 124, 17006 }, // æ
+    { 14, 24, 22, 4, 17, 84, 17130 }, // ç
+    { 16, 27, 24, 4, 27, 108, 17214 }, // è
+    { 16, 32, 24, 4, 32, 128, 17322 }, // é
+    { 16, 28, 24, 4, 28, 112, 17450 }, // ê
+    { 16, 27, 24, 4, 27, 108, 17562 }, // ë
+    { 10, 24, 13, 0, 24, 60, 17670 }, // ì
+    { 6, 29, 13, 4, 29, 44, 17730 }, // í
+    { 13, 25, 13, 0, 25, 82, 17774 }, // î
+    { 14, 25, 13, -1, 25, 88, 17856 }, // ï
+    { 22, 23, 24, 2, 23, 127, 17944 }, // ð
+    { 16, 25, 24, 4, 25, 100, 18071 }, // ñ
+    { 16, 26, 24, 4, 26, 104, 18171 }, // ò
+    { 16, 31, 24, 4, 31, 124, 18275 }, // ó
+    { 16, 27, 24, 4, 27, 108, 18432 }, // ô
+    { 16, 26, 24, 4, 26, 104, 18540 }, // õ
+    { 16, 26, 24, 4, 26, 104, 18644 }, // ö
+    { 18, 18, 22, 2, 18, 81, 18748 }, // ÷
+    { 17, 45, 24, 3, 30, 192, 18829 }, // ø
+    { 15, 25, 23, 4, 24, 94, 19021 }, // ù
+    { 15, 30, 23, 4, 29, 113, 19115 }, // ú
+    { 15, 26, 23, 4, 25, 98, 19228 }, // û
+    { 15, 25, 23, 4, 24, 94, 19326 }, // ü
+    { 16, 39, 24, 4, 31, 156, 19420 }, // ý
+    { 13, 30, 16, 2, 24, 98, 19576 }, // þ
+    { 16, 35, 24, 4, 27, 140, 19674 }, // ÿ
+    { 23, 32, 33, 5, 32, 184, 19814 }, // Ā
+    { 17, 22, 24, 3, 22, 94, 19998 }, // ā
+    { 23, 36, 33, 5, 36, 207, 20092 }, // Ă
+    { 17, 25, 24, 3, 25, 107, 20299 }, // ă
+    { 23, 32, 33, 5, 25, 184, 20480 }, // Ą
+    { 17, 22, 24, 3, 17, 94, 20664 }, // ą
+    { 20, 39, 29, 4, 38, 195, 20758 }, // Ć
+    { 14, 28, 22, 4, 27, 98, 20953 }, // ć
+    { 20, 37, 29, 4, 36, 185, 21051 }, // Ĉ
+    { 14, 25, 22, 4, 24, 88, 21236 }, // ĉ
+    { 20, 37, 29, 4, 36, 185, 21324 }, // Ċ
+    { 14, 26, 22, 4, 25, 91, 21509 }, // ċ
+    { 20, 39, 29, 4, 38, 195, 21600 }, // Č
+    { 14, 27, 22, 4, 26, 95, 21795 }, // č
+    { 23, 36, 32, 5, 36, 207, 21890 }, // Ď
+    { 22, 26, 25, 4, 25, 143, 22097 }, // ď
+    { 27, 25, 32, 1, 25, 169, 22240 }, // Đ
+    { 21, 26, 25, 4, 25, 137, 22528 }, // đ
+    { 17, 32, 27, 5, 32, 136, 22665 }, // Ē
+    { 16, 26, 24, 4, 26, 104, 22801 }, // ē
+    { 17, 35, 27, 5, 35, 149, 22905 }, // Ĕ
+    { 16, 30, 24, 4, 30, 120, 23054 }, // ĕ
+    { 17, 34, 27, 5, 34, 145, 23174 }, // Ė
+    { 16, 28, 24, 4, 28, 112, 23319 }, // ė
+    { 17, 31, 27, 5, 25, 132, 23431 }, // Ę
+    { 16, 24, 24, 4, 17, 96, 23563 }, // ę
+    { 17, 35, 27, 5, 35, 149, 23659 }, // Ě
+    { 16, 30, 24, 4, 30, 120, 23808 }, // ě
+    { 23, 34, 33, 5, 34, 196, 23928 }, // Ĝ
+    { 16, 32, 23, 4, 25, 128, 24124 }, // ĝ
+    { 23, 36, 33, 5, 36, 207, 24252 }, // Ğ
+    { 16, 33, 23, 4, 26, 132, 24576 }, // ğ
+    { 23, 34, 33, 5, 34, 196, 24708 }, // Ġ
+    { 16, 32, 23, 4, 25, 128, 24904 }, // ġ
+    { 23, 39, 33, 5, 26, 225, 25032 }, // Ģ
+    { 16, 34, 23, 4, 27, 136, 25257 }, // ģ
+    { 21, 33, 31, 5, 33, 174, 25393 }, // Ĥ
+    { 19, 31, 24, 1, 31, 148, 25567 }, // ĥ
+    { 24, 24, 31, 3, 24, 144, 25715 }, // Ħ
+    { 19, 25, 24, 1, 25, 119, 25859 }, // ħ
+    { 11, 36, 13, 1, 36, 99, 25978 }, // Ĩ
+    { 11, 25, 13, 1, 25, 69, 26077 }, // ĩ
+    { 14, 34, 13, -1, 34, 119, 26146 }, // Ī
+    { 14, 23, 13, 0, 23, 81, 26265 }, // ī
+    { 7, 31, 18, 7, 25, 55, 26346 }, // Į
+    { 7, 32, 13, 3, 26, 56, 26401 }, // į
+    { 7, 36, 13, 3, 36, 63, 26457 }, // İ
+    { 5, 17, 13, 4, 17, 22, 26520 }, // ı
+    { 18, 32, 27, 4, 25, 144, 26624 }, // Ĳ
+    { 22, 34, 13, 4, 26, 187, 26768 }, // ĳ
+    { 13, 39, 22, 5, 32, 127, 26955 }, // Ĵ
+    { 15, 32, 19, 4, 24, 120, 27082 }, // ĵ
+    { 20, 35, 30, 5, 25, 175, 27202 }, // Ķ
+    { 16, 37, 24, 4, 24, 148, 27377 }, // ķ
+    { 13, 16, 19, 3, 16, 52, 27525 }, // ĸ
+    { 16, 35, 27, 5, 35, 140, 27577 }, // Ĺ
+    { 9, 34, 16, 3, 34, 77, 27717 }, // ĺ
+    { 16, 38, 27, 5, 25, 152, 27794 }, // Ļ
+    { 9, 36, 16, 3, 24, 81, 27946 }, // ļ
+    { 16, 25, 27, 5, 25, 100, 28027 }, // Ľ
+    { 12, 25, 16, 3, 25, 75, 28127 }, // ľ
+    { 16, 25, 27, 5, 25, 100, 28202 }, // Ŀ
+    { 13, 24, 16, 3, 24, 78, 28302 }, // ŀ
+    { 28, 41, 27, -7, 32, 287, 28380 }, // Ł
+    { 19, 24, 16, -6, 24, 114, 28672 }, // ł
+    { 21, 35, 31, 5, 35, 184, 28786 }, // Ń
+    { 16, 28, 24, 4, 28, 112, 28970 }, // ń
+    { 21, 35, 31, 5, 25, 184, 29082 }, // Ņ
+    { 16, 27, 24, 4, 17, 108, 29266 }, // ņ
+    { 21, 35, 31, 5, 35, 184, 29374 }, // Ň
+    { 16, 28, 24, 4, 28, 112, 29558 }, // ň
+    { 16, 30, 20, 2, 30, 120, 29670 }, // ŉ
+    { 21, 30, 31, 5, 25, 158, 29790 }, // Ŋ
+    { 16, 23, 24, 4, 17, 92, 29948 }, // ŋ
+    { 23, 32, 33, 5, 31, 184, 30040 }, // Ō
+    { 16, 25, 24, 4, 25, 100, 30224 }, // ō
+    { 23, 36, 33, 5, 35, 207, 30324 }, // Ŏ
+    { 16, 29, 24, 4, 29, 116, 30531 }, // ŏ
+    { 24, 34, 33, 5, 33, 204, 30720 }, // Ő
+    { 22, 27, 24, 2, 27, 149, 30924 }, // ő
+    { 33, 25, 35, 5, 25, 207, 31073 }, // Œ
+    { 28, 17, 31, 4, 17, 119, 31280 }, // œ
+    { 18, 34, 28, 5, 34, 153, 31399 }, // Ŕ
+    { 11, 25, 19, 4, 25, 69, 31552 }, // ŕ
+    { 18, 39, 28, 5, 25, 176, 31621 }, // Ŗ
+    { 12, 31, 19, 3, 16, 93, 31797 }, // ŗ
+    { 18, 34, 28, 5, 34, 153, 31890 }, // Ř
+    { 13, 25, 19, 2, 25, 82, 32043 }, // ř
+    { 23, 38, 33, 5, 37, 219, 32125 }, // Ś
+    { 15, 26, 23, 4, 26, 98, 32344 }, // ś
+    { 23, 36, 33, 5, 35, 207, 32442 }, // Ŝ
+    { 15, 24, 23, 4, 24, 90, 32649 }, // ŝ
+    { 23, 33, 33, 5, 26, 190, 32768 }, // Ş
+    { 15, 24, 23, 4, 16, 90, 32958 }, // ş
+    { 23, 38, 33, 5, 37, 219, 33048 }, // Š
+    { 15, 26, 23, 4, 26, 98, 33267 }, // š
+    { 21, 31, 31, 5, 25, 163, 33365 }, // Ţ
+    { 13, 28, 21, 4, 22, 91, 33528 }, // ţ
+    { 21, 35, 31, 5, 35, 184, 33619 }, // Ť
+    { 14, 25, 21, 4, 25, 88, 33803 }, // ť
+    { 21, 25, 31, 5, 25, 132, 33891 }, // Ŧ
+    { 14, 22, 21, 3, 22, 77, 34023 }, // ŧ
+    { 21, 36, 31, 5, 35, 189, 34100 }, // Ũ
+    { 15, 26, 23, 4, 25, 98, 34289 }, // ũ
+    { 21, 34, 31, 5, 33, 179, 34387 }, // Ū
+    { 15, 24, 23, 4, 23, 90, 34566 }, // ū
+    { 21, 37, 31, 5, 36, 195, 34816 }, // Ŭ
+    { 15, 27, 23, 4, 26, 102, 35011 }, // ŭ
+    { 21, 38, 31, 5, 37, 200, 35113 }, // Ů
+    { 15, 28, 23, 4, 27, 105, 35313 }, // ů
+    { 22, 36, 31, 5, 35, 198, 35418 }, // Ű
+    { 22, 26, 23, 1, 25, 143, 35616 }, // ű
+    { 21, 31, 31, 5, 25, 163, 35759 }, // Ų
+    { 15, 23, 23, 4, 16, 87, 35922 }, // ų
+    { 31, 34, 42, 5, 34, 264, 36009 }, // Ŵ
+    { 22, 26, 30, 4, 26, 143, 36273 }, // ŵ
+    { 21, 35, 31, 5, 35, 184, 36416 }, // Ŷ
+    { 16, 35, 24, 4, 27, 140, 36600 }, // ŷ
+    { 21, 34, 31, 5, 34, 179, 36864 }, // Ÿ
+    { 23, 35, 33, 5, 35, 202, 37043 }, // Ź
+    { 16, 27, 24, 4, 27, 108, 37245 }, // ź
+    { 23, 33, 33, 5, 33, 190, 37353 }, // Ż
+    { 16, 25, 24, 4, 25, 100, 37543 }, // ż
+    { 23, 35, 33, 5, 35, 202, 37643 }, // Ž
+    { 16, 27, 24, 4, 27, 108, 37845 }, // ž
+    { 10, 24, 15, 4, 24, 60, 37953 }, // ſ
+    { 10, 5, 0, 1, 22, 13, 38013 }, // ̀
+    { 6, 6, 0, 1, 23, 9, 38026 }, // ́
+    { 12, 6, 0, 2, 0, 18, 38035 }, // ̂
+    { 11, 6, 0, 1, 22, 17, 38053 }, // ̃
+    { 14, 4, 0, 2, 20, 14, 38070 }, // ̄
+    { 19, 4, 0, 2, 26, 19, 38084 }, // ̅
+    { 12, 6, 0, 2, 21, 18, 38103 }, // ̆
+    { 6, 5, 0, 1, 22, 8, 38121 }, // ̇
+    { 14, 5, 0, 1, 23, 18, 38129 }, // ̈
+    { 7, 6, 0, 0, 19, 11, 38147 }, // ̉
+    { 7, 6, 0, 1, 22, 11, 38158 }, // ̊
+    { 22, 5, 0, 1, 22, 28, 38169 }, // ̋
+    { 12, 6, 0, 2, 22, 18, 38197 }, // ̌
+    { 22, 5, 0, -6, 24, 28, 38215 }, // ̏
+    { 7, 9, 0, 1, 22, 16, 38243 }, // ̒
+    { 8, 9, 0, 1, 22, 18, 38259 }, // ̓
+    { 7, 9, 0, 1, 22, 16, 38277 }, // ̔
+    { 5, 7, 0, 2, -1, 9, 38293 }, // ̘
+    { 5, 7, 0, 2, -1, 9, 38302 }, // ̙
+    { 12, 7, 0, 2, 23, 21, 38311 }, // ̚
+    { 4, 6, 0, 2, 18, 6, 38332 }, // ̛
+    { 3, 6, 0, 2, -2, 5, 38338 }, // ̜
+    { 7, 5, 0, 2, 3, 9, 38343 }, // ̝
+    { 7, 5, 0, 2, -1, 9, 38352 }, // ̞
+    { 6, 7, 0, 2, -2, 11, 38361 }, // ̟
+    { 14, 4, 0, 2, -4, 14, 38372 }, // ̠
+    { 6, 5, 0, 1, 1, 8, 38386 }, // ̣
+    { 14, 5, 0, 1, -1, 18, 38394 }, // ̤
+    { 7, 6, 0, 1, 22, 11, 38412 }, // ̥
+    { 8, 10, 0, 1, 5, 20, 38423 }, // ̦
+    { 6, 8, 0, 2, 1, 12, 38443 }, // ̧
+    { 6, 8, 0, 2, 1, 12, 38455 }, // ̨
+    { 4, 8, 0, 2, -2, 8, 38467 }, // ̩
+    { 9, 5, 0, 2, -1, 12, 38475 }, // ̪
+    { 12, 6, 0, 2, 0, 18, 38487 }, // ̬
+    { 13, 6, 0, 1, -1, 20, 38505 }, // ̭
+    { 11, 6, 0, 1, 22, 17, 38525 }, // ̰
+    { 11, 3, 0, 2, 21, 9, 38542 }, // ̱
+    { 12, 4, 0, 2, -2, 12, 38551 }, // ̲
+    { 11, 6, 0, 1, 22, 17, 38563 }, // ̴
+    { 14, 3, 0, 2, 10, 11, 38580 }, // ̵
+    { 3, 6, 0, 2, -2, 5, 38591 }, // ̹
+    { 9, 5, 0, 2, -1, 12, 38596 }, // ̺
+    { 9, 8, 0, 2, 0, 18, 38608 }, // ̻
+    { 9, 6, 0, 2, 0, 14, 38626 }, // ̼
+    { 7, 6, 0, 3, 22, 11, 38640 }, // ̽
+    { 11, 6, 0, 1, 22, 17, 38651 }, // ͂
+    { 4, 5, 0, 2, 24, 5, 38668 }, // ̓
+    { 14, 13, 0, 1, 31, 46, 38673 }, // ̈́
+    { 9, 5, 0, 2, 23, 12, 38719 }, // ͆
+    { 14, 11, 0, 2, 0, 39, 38731 }, // ͇
+    { 11, 8, 0, 2, 0, 22, 38770 }, // ͈
+    { 9, 7, 0, 2, -2, 16, 38792 }, // ͉
+    { 11, 16, 0, 1, 27, 44, 38808 }, // ͊
+    { 24, 13, 0, 1, 26, 78, 38912 }, // ͋
+    { 17, 15, 0, 3, 16, 64, 38990 }, // ͌
+    { 15, 7, 0, 2, -3, 27, 39054 }, // ͍
+    { 4, 4, 0, 2, 3, 4, 39081 }, // ͎
+    { 24, 6, 0, 2, 0, 36, 39085 }, // ͜
+    { 24, 6, 0, 2, 23, 36, 39121 }, // ͡
+    { 28, 7, 0, 2, -2, 49, 39157 }, // ͢
+    { 15, 30, 18, 2, 30, 113, 39206 }, // Ѐ
+    { 15, 28, 18, 2, 28, 105, 39319 }, // Ё
+    { 24, 24, 30, 3, 24, 144, 39424 }, // Ђ
+    { 15, 34, 19, 2, 34, 128, 39568 }, // Ѓ
+    { 20, 24, 27, 4, 23, 120, 39696 }, // Є
+    { 23, 27, 33, 5, 26, 156, 39816 }, // Ѕ
+    { 6, 25, 13, 4, 25, 38, 39972 }, // І
+    { 14, 35, 13, -1, 35, 123, 40010 }, // Ї
+    { 12, 33, 22, 5, 26, 99, 40133 }, // Ј
+    { 28, 23, 34, 3, 22, 161, 40232 }, // Љ
+    { 27, 22, 33, 3, 22, 149, 40393 }, // Њ
+    { 24, 25, 31, 5, 25, 150, 40542 }, // Ћ
+    { 20, 35, 30, 5, 35, 175, 40692 }, // Ќ
+    { 21, 33, 31, 5, 33, 174, 40960 }, // Ѝ
+    { 16, 34, 20, 2, 33, 136, 41134 }, // Ў
+    { 17, 27, 21, 2, 21, 115, 41270 }, // Џ
+    { 23, 25, 33, 5, 25, 144, 41385 }, // А
+    { 15, 21, 19, 2, 21, 79, 41529 }, // Б
+    { 16, 21, 20, 2, 21, 84, 41608 }, // В
+    { 15, 22, 19, 2, 22, 83, 41692 }, // Г
+    { 21, 24, 24, 2, 21, 126, 41775 }, // Д
+    { 15, 22, 18, 2, 22, 83, 41901 }, // Е
+    { 31, 25, 42, 5, 25, 194, 41984 }, // Ж
+    { 15, 22, 19, 2, 22, 83, 42178 }, // З
+    { 21, 25, 31, 5, 25, 132, 42261 }, // И
+    { 21, 35, 31, 5, 35, 184, 42393 }, // Й
+    { 20, 25, 30, 5, 25, 125, 42577 }, // К
+    { 17, 22, 22, 2, 21, 94, 42702 }, // Л
+    { 21, 21, 25, 2, 21, 111, 42796 }, // М
+    { 21, 25, 31, 5, 25, 132, 43008 }, // Н
+    { 23, 26, 33, 5, 25, 150, 43140 }, // О
+    { 16, 22, 20, 2, 22, 88, 43290 }, // П
+    { 17, 25, 27, 5, 25, 107, 43378 }, // Р
+    { 20, 27, 29, 4, 26, 135, 43485 }, // С
+    { 21, 25, 31, 5, 25, 132, 43620 }, // Т
+    { 16, 24, 20, 2, 23, 96, 43752 }, // У
+    { 22, 22, 25, 2, 22, 121, 43848 }, // Ф
+    { 23, 25, 33, 5, 25, 144, 43969 }, // Х
+    { 17, 27, 21, 2, 22, 115, 44113 }, // Ц
+    { 15, 22, 19, 2, 22, 83, 44228 }, // Ч
+    { 20, 22, 24, 2, 22, 110, 44311 }, // Ш
+    { 23, 27, 26, 2, 22, 156, 44421 }, // Щ
+    { 20, 22, 19, -3, 22, 110, 44577 }, // Ъ
+    { 27, 23, 33, 2, 23, 156, 44687 }, // Ы
+    { 15, 22, 19, 2, 22, 83, 44843 }, // Ь
+    { 20, 24, 27, 3, 23, 120, 44926 }, // Э
+    { 23, 22, 29, 3, 22, 127, 45056 }, // Ю
+    { 18, 25, 28, 5, 25, 113, 45183 }, // Я
+    { 17, 17, 24, 3, 17, 73, 45296 }, // а
+    { 17, 23, 20, 2, 23, 98, 45369 }, // б
+    { 14, 18, 21, 4, 18, 63, 45467 }, // в
+    { 14, 17, 17, 2, 17, 60, 45530 }, // г
+    { 18, 20, 22, 2, 17, 90, 45590 }, // д
+    { 16, 17, 24, 4, 17, 68, 45680 }, // е
+    { 27, 20, 35, 4, 20, 135, 45748 }, // ж
+    { 11, 16, 13, 1, 16, 44, 45883 }, // з
+    { 16, 17, 20, 2, 17, 68, 45927 }, // и
+    { 16, 22, 20, 2, 22, 88, 45995 }, // й
+    { 15, 17, 23, 4, 17, 64, 46083 }, // к
+    { 12, 16, 15, 1, 15, 48, 46147 }, // л
+    { 19, 19, 27, 4, 19, 91, 46195 }, // м
+    { 18, 19, 27, 4, 19, 86, 46286 }, // н
+    { 15, 16, 19, 2, 16, 60, 46372 }, // о
+    { 15, 17, 19, 2, 17, 64, 46432 }, // п
+    { 18, 24, 24, 2, 16, 108, 46496 }, // р
+    { 14, 18, 22, 4, 17, 63, 46604 }, // с
+    { 16, 16, 20, 2, 16, 64, 46667 }, // т
+    { 16, 24, 24, 4, 16, 96, 46731 }, // у
+    { 22, 23, 25, 2, 16, 127, 46827 }, // ф
+    { 17, 16, 21, 2, 16, 68, 46954 }, // х
+    { 17, 21, 21, 2, 17, 90, 47104 }, // ц
+    { 11, 15, 13, 1, 15, 42, 47194 }, // ч
+    { 20, 17, 24, 2, 17, 85, 47236 }, // ш
+    { 22, 22, 26, 2, 17, 121, 47321 }, // щ
+    { 18, 16, 22, 2, 16, 72, 47442 }, // ъ
+    { 20, 17, 24, 2, 17, 85, 47514 }, // ы
+    { 14, 17, 18, 2, 17, 60, 47599 }, // ь
+    { 15, 16, 19, 2, 16, 60, 47659 }, // э
+    { 19, 17, 23, 2, 17, 81, 47719 }, // ю
+    { 14, 16, 18, 2, 16, 56, 47800 }, // я
+    { 16, 28, 24, 4, 28, 112, 47856 }, // ѐ
+    { 15, 22, 19, 2, 22, 83, 47968 }, // ё
+    { 20, 29, 24, 1, 25, 145, 48051 }, // ђ
+    { 14, 25, 17, 2, 25, 88, 48196 }, // ѓ
+    { 15, 17, 19, 2, 16, 64, 48284 }, // є
+    { 15, 16, 23, 4, 16, 60, 48348 }, // ѕ
+    { 6, 26, 13, 4, 26, 39, 48408 }, // і
+    { 14, 25, 13, -1, 25, 88, 48447 }, // ї
+    { 12, 33, 19, 4, 25, 99, 48535 }, // ј
+    { 20, 16, 23, 2, 15, 80, 48634 }, // љ
+    { 19, 15, 23, 2, 15, 72, 48714 }, // њ
+    { 19, 25, 24, 1, 25, 119, 48786 }, // ћ
+    { 15, 26, 23, 4, 26, 98, 48905 }, // ќ
+    { 16, 25, 20, 2, 25, 100, 49003 }, // ѝ
+    { 16, 36, 24, 4, 28, 144, 49152 }, // ў
+    { 13, 20, 15, 1, 15, 65, 49296 }, // џ
+    { 17, 23, 24, 4, 22, 98, 49361 }, // Ѣ
+    { 17, 22, 21, 2, 21, 94, 49459 }, // ѣ
+    { 23, 21, 30, 3, 21, 121, 49553 }, // Ѫ
+    { 17, 15, 21, 2, 15, 64, 49674 }, // ѫ
+    { 21, 27, 31, 5, 26, 142, 49738 }, // Ѳ
+    { 16, 20, 24, 4, 20, 80, 49880 }, // ѳ
+    { 30, 33, 34, 5, 33, 248, 49960 }, // Ѵ
+    { 19, 20, 24, 3, 20, 95, 50208 }, // ѵ
+    { 10, 9, 0, 2, 27, 23, 50303 }, // ҆
+    { 15, 25, 19, 2, 25, 94, 50326 }, // Ґ
+    { 14, 20, 17, 2, 20, 70, 50420 }, // ґ
+    { 16, 22, 19, 1, 22, 88, 50490 }, // Ғ
+    { 12, 15, 13, 0, 15, 45, 50578 }, // ғ
+    { 17, 24, 20, 2, 24, 102, 50623 }, // Ҕ
+    { 10, 15, 12, 1, 15, 38, 50725 }, // ҕ
+    { 31, 29, 37, 3, 25, 225, 50763 }, // Җ
+    { 22, 21, 26, 2, 18, 116, 50988 }, // җ
+    { 15, 25, 21, 3, 22, 94, 51104 }, // Ҙ
+    { 11, 23, 13, 1, 16, 64, 51200 }, // ҙ
+    { 20, 29, 26, 3, 25, 145, 51264 }, // Қ
+    { 14, 21, 18, 2, 18, 74, 51409 }, // қ
+    { 22, 21, 28, 3, 21, 116, 51483 }, // Ҝ
+    { 17, 15, 21, 2, 15, 64, 51599 }, // ҝ
+    { 21, 25, 30, 4, 25, 132, 51663 }, // Ҟ
+    { 19, 23, 24, 1, 23, 110, 51795 }, // ҟ
+    { 27, 25, 30, -2, 25, 169, 51905 }, // Ҡ
+    { 19, 18, 20, -2, 18, 86, 52074 }, // ҡ
+    { 22, 28, 27, 3, 25, 154, 52160 }, // Ң
+    { 15, 20, 19, 2, 17, 75, 52314 }, // ң
+    { 30, 26, 31, 5, 26, 195, 52389 }, // Ҥ
+    { 21, 17, 22, 3, 17, 90, 52584 }, // ҥ
+    { 28, 24, 34, 3, 24, 168, 52674 }, // Ҧ
+    { 27, 27, 31, 2, 19, 183, 52842 }, // ҧ
+    { 29, 25, 35, 3, 24, 182, 53025 }, // Ҩ
+    { 23, 20, 27, 2, 19, 115, 53248 }, // ҩ
+    { 20, 31, 29, 4, 26, 155, 53363 }, // Ҫ
+    { 14, 21, 22, 4, 17, 74, 53518 }, // ҫ
+    { 21, 28, 27, 3, 25, 147, 53592 }, // Ҭ
+    { 15, 19, 19, 2, 17, 72, 53739 }, // ҭ
+    { 21, 25, 31, 5, 25, 132, 53811 }, // Ү
+    { 16, 21, 19, 2, 15, 84, 53943 }, // ү
+    { 21, 25, 31, 5, 25, 132, 54027 }, // Ұ
+    { 17, 22, 19, 1, 15, 94, 54159 }, // ұ
+    { 24, 29, 29, 3, 25, 174, 54253 }, // Ҳ
+    { 17, 20, 20, 2, 17, 85, 54427 }, // ҳ
+    { 25, 27, 31, 3, 21, 169, 54512 }, // Ҵ
+    { 18, 19, 22, 2, 15, 86, 54681 }, // ҵ
+    { 19, 28, 24, 2, 21, 133, 54767 }, // Ҷ
+    { 14, 20, 17, 1, 15, 70, 54900 }, // ҷ
+    { 17, 22, 21, 2, 22, 94, 54970 }, // Ҹ
+    { 12, 15, 15, 1, 15, 45, 55064 }, // ҹ
+    { 16, 24, 22, 3, 24, 96, 55109 }, // Һ
+    { 16, 25, 24, 4, 25, 100, 55296 }, // һ
+    { 25, 22, 28, 0, 21, 138, 55396 }, // Ҽ
+    { 18, 16, 20, 0, 16, 72, 55534 }, // ҽ
+    { 26, 25, 32, 3, 21, 163, 55606 }, // Ҿ
+    { 19, 19, 23, 2, 16, 91, 55769 }, // ҿ
+    { 6, 25, 13, 4, 25, 38, 55860 }, // Ӏ
+    { 31, 35, 42, 5, 35, 272, 55898 }, // Ӂ
+    { 27, 31, 35, 4, 31, 210, 56170 }, // ӂ
+    { 17, 29, 23, 3, 22, 124, 56380 }, // Ӄ
+    { 12, 20, 16, 2, 15, 60, 56504 }, // ӄ
+    { 21, 27, 22, 2, 22, 142, 56564 }, // Ӆ
+    { 14, 18, 15, 2, 15, 63, 56706 }, // ӆ
+    { 23, 32, 31, 5, 25, 184, 56769 }, // Ӈ
+    { 16, 22, 22, 3, 17, 88, 56953 }, // ӈ
+    { 23, 34, 31, 5, 25, 196, 57041 }, // Ӊ
+    { 16, 23, 22, 3, 17, 92, 57237 }, // ӊ
+    { 16, 27, 20, 1, 21, 108, 57344 }, // Ӌ
+    { 11, 18, 15, 2, 15, 50, 57452 }, // ӌ
+    { 28, 34, 36, 5, 25, 238, 57502 }, // Ӎ
+    { 20, 23, 25, 3, 17, 115, 57740 }, // ӎ
+    { 4, 21, 8, 2, 21, 21, 57855 }, // ӏ
+    { 23, 35, 33, 5, 35, 202, 57876 }, // Ӑ
+    { 17, 26, 24, 3, 26, 111, 58078 }, // ӑ
+    { 23, 34, 33, 5, 34, 196, 58189 }, // Ӓ
+    { 17, 25, 24, 3, 25, 107, 58385 }, // ӓ
+    { 32, 26, 42, 5, 25, 208, 58492 }, // Ӕ
+    { 29, 17, 36, 3, 17, 124, 58700 }, // ӕ
+    { 15, 31, 18, 2, 31, 117, 58824 }, // Ӗ
+    { 16, 29, 24, 4, 29, 116, 58941 }, // ӗ
+    { 16, 17, 24, 4, 16, 68, 59057 }, // Ә
+    { 16, 18, 24, 5, 17, 72, 59125 }, // ә
+    { 16, 29, 24, 4, 28, 116, 59197 }, // Ӛ
+    { 16, 20, 24, 5, 17, 80, 59392 }, // ӛ
+    { 31, 34, 38, 5, 34, 264, 59472 }, // Ӝ
+    { 27, 29, 35, 4, 29, 196, 59736 }, // ӝ
+    { 15, 30, 19, 2, 30, 113, 59932 }, // Ӟ
+    { 14, 24, 13, 1, 24, 84, 60045 }, // ӟ
+    { 14, 22, 17, 2, 21, 77, 60129 }, // Ӡ
+    { 14, 22, 17, 2, 16, 77, 60206 }, // ӡ
+    { 21, 31, 31, 5, 31, 163, 60283 }, // Ӣ
+    { 16, 23, 20, 2, 23, 92, 60446 }, // ӣ
+    { 21, 33, 31, 5, 33, 174, 60538 }, // Ӥ
+    { 16, 24, 20, 2, 24, 96, 60712 }, // ӥ
+    { 23, 34, 33, 5, 33, 196, 60808 }, // Ӧ
+    { 15, 25, 19, 2, 25, 94, 61004 }, // ӧ
+    { 21, 22, 31, 5, 21, 116, 61098 }, // Ө
+    { 16, 16, 24, 4, 16, 64, 61214 }, // ө
+    { 21, 34, 31, 5, 33, 179, 61440 }, // Ӫ
+    { 16, 27, 24, 4, 27, 108, 61619 }, // ӫ
+    { 20, 32, 27, 3, 31, 160, 61727 }, // Ӭ
+    { 16, 24, 19, 1, 24, 96, 61887 }, // ӭ
+    { 16, 31, 20, 2, 30, 124, 61983 }, // Ӯ
+    { 16, 33, 24, 4, 25, 132, 62107 }, // ӯ
+    { 16, 32, 20, 2, 31, 128, 62239 }, // Ӱ
+    { 16, 35, 24, 4, 27, 140, 62367 }, // ӱ
+    { 22, 33, 20, 0, 32, 182, 62507 }, // Ӳ
+    { 21, 36, 24, 3, 28, 189, 62689 }, // ӳ
+    { 15, 30, 19, 2, 30, 113, 62878 }, // Ӵ
+    { 14, 24, 13, -1, 24, 84, 62991 }, // ӵ
+    { 15, 26, 19, 2, 22, 98, 63075 }, // Ӷ
+    { 11, 18, 13, 1, 15, 50, 63173 }, // ӷ
+    { 27, 32, 33, 2, 32, 216, 63223 }, // Ӹ
+    { 20, 26, 24, 2, 26, 130, 63488 }, // ӹ
+    { 28, 28, 33, 5, 25, 196, 63618 }, // Ӽ
+    { 20, 20, 23, 3, 18, 100, 63814 }, // ӽ
+    { 0, 0, 24, 0, 0, 0, 63914 }, //  
+    { 0, 0, 39, 0, 0, 0, 63914 }, //  
+    { 0, 0, 24, 0, 0, 0, 63914 }, //  
+    { 0, 0, 39, 0, 0, 0, 63914 }, //  
+    { 0, 0, 19, 0, 0, 0, 63914 }, //  
+    { 0, 0, 17, 0, 0, 0, 63914 }, //  
+    { 0, 0, 14, 0, 0, 0, 63914 }, //  
+    { 0, 0, 19, 0, 0, 0, 63914 }, //  
+    { 0, 0, 8, 0, 0, 0, 63914 }, //  
+    { 0, 0, 15, 0, 0, 0, 63914 }, //  
+    { 0, 0, 14, 0, 0, 0, 63914 }, //  
+    { 0, 0, 9, 0, 0, 0, 63914 }, // ​
+    { 0, 0, 0, 0, 0, 0, 63914 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 63914 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 63914 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 63914 }, // ‏
+    { 14, 3, 16, 2, 10, 11, 63914 }, // ‐
+    { 14, 3, 16, 2, 10, 11, 63925 }, // ‑
+    { 20, 3, 22, 2, 10, 15, 63936 }, // ‒
+    { 19, 4, 23, 2, 10, 19, 63951 }, // –
+    { 29, 4, 33, 2, 10, 29, 63970 }, // —
+    { 29, 4, 33, 2, 10, 29, 63999 }, // ―
+    { 12, 25, 16, 2, 21, 75, 64028 }, // ‖
+    { 21, 9, 23, 2, -3, 48, 64103 }, // ‗
+    { 8, 9, 10, 1, 25, 18, 64151 }, // ‘
+    { 8, 9, 10, 1, 25, 18, 64169 }, // ’
+    { 8, 10, 9, 1, 5, 20, 64187 }, // ‚
+    { 8, 9, 10, 1, 25, 18, 64207 }, // ‛
+    { 15, 9, 16, 1, 25, 34, 64225 }, // “
+    { 15, 9, 17, 1, 25, 34, 64259 }, // ”
+    { 8, 10, 9, 1, 5, 20, 64293 }, // „
+    { 15, 9, 17, 1, 25, 34, 64313 }, // ‟
+    { 15, 38, 17, 1, 30, 143, 64347 }, // †
+    { 16, 38, 18, 1, 30, 152, 64490 }, // ‡
+    { 17, 17, 15, -1, 20, 73, 64642 }, // •
+    { 8, 9, 11, 2, 13, 18, 64715 }, // ‣
+    { 6, 5, 8, 1, 5, 8, 64733 }, // ․
+    { 6, 5, 8, 1, 5, 8, 64741 }, // ‥
+    { 26, 5, 28, 1, 5, 33, 64749 }, // …
+    { 4, 3, 7, 2, 10, 3, 64782 }, // ‧
+    { 0, 0, 37, 0, 0, 0, 64785 }, //  
+    { 18, 25, 32, 7, 23, 113, 64785 }, // ‰
+    { 8, 9, 9, 1, 25, 18, 64898 }, // ′
+    { 15, 9, 16, 1, 25, 34, 64916 }, // ″
+    { 23, 9, 25, 1, 25, 52, 64950 }, // ‴
+    { 8, 9, 10, 1, 24, 18, 65002 }, // ‵
+    { 14, 9, 15, 0, 24, 32, 65020 }, // ‶
+    { 23, 9, 25, 1, 25, 52, 65052 }, // ‷
+    { 12, 5, 16, 2, 23, 15, 65104 }, // ‸
+    { 8, 14, 12, 2, 15, 28, 65119 }, // ‹
+    { 8, 14, 12, 2, 15, 28, 65147 }, // ›
+    { 30, 29, 39, 6, 26, 218, 65175 }, // ※
+    { 7, 29, 10, 1, 29, 51, 65393 }, // ‼
+    { 16, 37, 22, 2, 35, 148, 65536 }, // ‽
+    { 14, 4, 16, 2, 24, 14, 65684 }, // ‾
+    { 12, 6, 16, 2, 20, 18, 65698 }, // ‿
+    { 19, 18, 23, 2, 25, 86, 65716 }, // ⁂
+    { 17, 24, 32, 8, 22, 102, 65802 }, // ⁄
+    { 33, 33, 37, 2, 33, 273, 65904 }, // ⁇
+    { 22, 33, 29, 2, 33, 182, 66177 }, // ⁈
+    { 22, 35, 24, 1, 33, 193, 66359 }, // ⁉
+    { 17, 46, 22, 2, 32, 196, 66552 }, // ⁒
+    { 0, 0, 141, 0, 0, 0, 66748 }, //  
+    { 8, 11, 9, 1, 24, 22, 66748 }, // ⁰
+    { 8, 11, 9, 1, 24, 22, 66770 }, // ⁴
+    { 8, 12, 9, 1, 25, 24, 66792 }, // ⁵
+    { 8, 11, 9, 1, 24, 22, 66816 }, // ⁶
+    { 8, 13, 10, 1, 25, 26, 66838 }, // ⁷
+    { 9, 11, 10, 0, 24, 25, 66864 }, // ⁸
+    { 8, 11, 10, 1, 24, 22, 66889 }, // ⁹
+    { 16, 17, 24, 4, 17, 68, 66911 }, // ⁿ
+    { 11, 15, 13, 1, 15, 42, 66979 }, // ₀
+    { 7, 12, 9, 1, 7, 21, 67021 }, // ₁
+    { 8, 12, 10, 1, 7, 24, 67042 }, // ₂
+    { 8, 11, 9, 1, 6, 22, 67066 }, // ₃
+    { 8, 11, 10, 1, 6, 22, 67088 }, // ₄
+    { 7, 12, 9, 1, 7, 21, 67110 }, // ₅
+    { 8, 12, 10, 1, 7, 24, 67131 }, // ₆
+    { 8, 12, 10, 1, 7, 24, 67155 }, // ₇
+    { 9, 11, 10, 0, 6, 25, 67179 }, // ₈
+    { 8, 11, 10, 1, 6, 22, 67204 }, // ₉
+    { 10, 39, 13, 2, 29, 98, 67226 }, // ₍
+    { 9, 39, 13, 1, 29, 88, 67324 }, // ₎
+    { 20, 37, 29, 4, 31, 185, 67584 }, // ₡
+    { 20, 27, 29, 4, 26, 135, 67769 }, // ₢
+    { 18, 28, 20, 1, 28, 126, 67904 }, // ₤
+    { 28, 25, 31, 2, 25, 175, 68030 }, // ₦
+    { 23, 25, 27, 1, 25, 144, 68205 }, // ₧
+    { 29, 24, 33, 4, 24, 174, 68349 }, // ₨
+    { 22, 24, 25, 1, 24, 132, 68523 }, // ₩
+    { 23, 23, 31, 4, 23, 133, 68655 }, // ₪
+    { 19, 23, 20, 2, 23, 110, 68788 }, // ₫
+    { 18, 26, 22, 2, 23, 117, 68898 }, // €
+    { 21, 25, 31, 5, 25, 132, 69015 }, // ₮
+    { 26, 25, 19, 0, 25, 163, 69147 }, // ₱
+    { 23, 34, 33, 5, 30, 196, 69310 }, // ₲
+    { 26, 27, 27, 2, 26, 176, 69632 }, // ₴
+    { 14, 22, 22, 4, 20, 77, 69808 }, // ₵
+    { 21, 26, 31, 5, 26, 137, 69885 }, // ₸
+    { 14, 22, 18, 2, 22, 77, 70022 }, // ₹
+    { 16, 21, 20, 2, 20, 84, 70099 }, // ₺
+    { 18, 23, 18, 0, 23, 104, 70183 }, // ₼
+    { 23, 25, 27, -1, 25, 144, 70287 }, // ₽
+    { 18, 18, 22, 2, 16, 81, 70431 }, // ←
+    { 18, 18, 22, 2, 18, 81, 70512 }, // ↑
+    { 18, 18, 22, 2, 16, 81, 70593 }, // →
+    { 18, 18, 22, 2, 18, 81, 70674 }, // ↓
+    { 22, 16, 26, 2, 16, 88, 70755 }, // ↔
+    { 15, 23, 19, 2, 23, 87, 70843 }, // ↕
+    { 15, 14, 19, 2, 15, 53, 70930 }, // ↖
+    { 15, 14, 19, 2, 15, 53, 70983 }, // ↗
+    { 15, 15, 19, 2, 16, 57, 71036 }, // ↘
+    { 15, 15, 19, 2, 16, 57, 71093 }, // ↙
+    { 21, 19, 25, 2, 18, 100, 71150 }, // ⇐
+    { 23, 21, 27, 2, 21, 121, 71250 }, // ⇑
+    { 21, 19, 25, 2, 18, 100, 71371 }, // ⇒
+    { 23, 22, 27, 2, 21, 127, 71471 }, // ⇓
+    { 24, 19, 28, 2, 18, 114, 71680 }, // ⇔
+    { 19, 24, 23, 2, 16, 114, 71794 }, // ⇕
+    { 16, 23, 20, 2, 23, 92, 71908 }, // ∂
+    { 29, 28, 33, 2, 26, 203, 72000 }, // ∅
+    { 21, 22, 25, 2, 22, 116, 72203 }, // ∆
+    { 18, 21, 22, 2, 21, 95, 72319 }, // ∏
+    { 18, 21, 22, 2, 21, 95, 72414 }, // ∐
+    { 14, 22, 17, 2, 21, 77, 72509 }, // ∑
+    { 14, 4, 18, 2, 10, 14, 72586 }, // −
+    { 23, 25, 27, 2, 23, 144, 72600 }, // √
+    { 23, 15, 27, 2, 18, 87, 72744 }, // ∞
+    { 24, 33, 25, 1, 26, 198, 72831 }, // ∫
+    { 6, 18, 8, 1, 18, 27, 73029 }, // ∶
+    { 17, 15, 23, 3, 16, 64, 73056 }, // ≈
+    { 19, 24, 32, 7, 22, 114, 73120 }, // ≠
+    { 21, 22, 25, 2, 20, 116, 73234 }, // ≤
+    { 21, 22, 25, 2, 20, 116, 73350 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
@@ -5244,4 +3133,9 @@ static const EpdFontData opendyslexic_14_regular = {
     38,
     -16,
     true,
+    opendyslexic_14_regularBlockOffsets,
+    opendyslexic_14_regularDirectGlyphs,
+    opendyslexic_14_regularGlyphPages,
+    35,
+    opendyslexic_14_regularPageGlyphs,
 };
@@ -2,1794 +2,1246 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_bold
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_boldBitmaps[28493] = {
-    0x00, 0x03, 0x00, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0x7C, 0x1F, 0x0B, 0xC2, 0xF0, 0x7C, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF5, 0xFE, 0xBF, 0x9A, 0x90, 0x2A, 0x86, 0xA4, 0xFF,
-    0x1F, 0xD3, 0xF4, 0x7F, 0x0F, 0xD1, 0xFC, 0x3F, 0x47, 0xF0, 0xFE, 0x2F, 0xC0, 0x00, 0x0B, 0x82,
-    0xE0, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x57, 0xF5, 0xBD, 0x54, 0x00, 0x0F,
-    0xC2, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x05, 0x6F, 0x9B, 0xE5, 0x50, 0x00, 0xBE, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x00,
-    0x0A, 0x91, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x06, 0xF9, 0x40, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xBE, 0x7C, 0x00, 0x02,
-    0xF5, 0xF0, 0x00, 0x0B, 0xFB, 0xC0, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x07, 0x9F, 0xF0, 0x0E, 0x1E, 0x1F, 0xC0, 0xFF, 0xFE, 0xFF, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xF0, 0x2F, 0x80, 0x2E, 0x0B, 0x1D, 0x03, 0xC0, 0xE0, 0xE0,
-    0xF4, 0x0B, 0x0E, 0x1F, 0x00, 0x7F, 0xD3, 0xD0, 0x02, 0xF4, 0xBC, 0x00, 0x00, 0x1F, 0x2F, 0x80,
-    0x03, 0xE7, 0x4D, 0x00, 0x7C, 0xB0, 0xE0, 0x0F, 0x8B, 0x0E, 0x02, 0xF0, 0x7F, 0xD0, 0x7D, 0x01,
-    0xF8, 0x0A, 0x80, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x7D, 0x7D, 0x00, 0xB0, 0x0F, 0x00, 0xB0, 0x0F,
-    0x00, 0xBC, 0x2F, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF0, 0x14, 0xBC, 0xBC, 0x3D,
-    0xFC, 0x1F, 0xBD, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x0B, 0xF9, 0x00, 0x3F,
-    0xC3, 0xF8, 0x3F, 0x43, 0xF4, 0x3F, 0x42, 0xA0, 0x00, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F,
-    0x00, 0xFC, 0x03, 0xD0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xF0,
-    0x0B, 0xC0, 0x1F, 0x40, 0x3E, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x0F, 0xC0, 0x1A,
-    0x40, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x00,
-    0xF8, 0x01, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x6A, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x18, 0xF1, 0xC3, 0xFF, 0xFD, 0x1B, 0xFE, 0x00, 0x7F, 0xF4, 0x3F, 0xFF,
-    0xE1, 0xDB, 0x5C, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00,
-    0x0B, 0x80, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x01,
-    0x00, 0x2A, 0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0x29,
-    0x3E, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFA, 0xF4, 0x2E,
-    0x07, 0xC3, 0xD0, 0x3C, 0x7C, 0xF3, 0xD7, 0xCF, 0x7E, 0xBC, 0xF7, 0xEB, 0xCF, 0x3E, 0x7D, 0x07,
-    0xE7, 0xF0, 0xFD, 0x3F, 0xFF, 0xC2, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x2F, 0x80, 0x01, 0x90, 0x07,
-    0xF8, 0x03, 0xFE, 0x00, 0xDF, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
-    0xE0, 0x00, 0xF8, 0x07, 0xFF, 0xF2, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x1B, 0xF8, 0x03, 0xFF, 0xF0,
-    0x7E, 0x6F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xF0, 0x07,
-    0xFD, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0xC7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD0, 0x1B, 0xF8, 0x03, 0xFF,
-    0xF4, 0x10, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x7F, 0xF4, 0x0B, 0xFF, 0x40, 0x01, 0xFC,
-    0x00, 0x07, 0xD2, 0x95, 0xFD, 0x3F, 0xFF, 0xC7, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x03, 0xDF, 0x00, 0xB4, 0xF4, 0x1F, 0x0F, 0x43, 0xEA,
-    0xFE, 0xBF, 0xFF, 0xF6, 0xAB, 0xFF, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x3F, 0xFF, 0x43, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3F,
-    0xF8, 0x07, 0xFF, 0xF4, 0x14, 0x1F, 0xC0, 0x00, 0xBC, 0x24, 0x1F, 0xC3, 0xFF, 0xFC, 0x7F, 0xFF,
-    0x47, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x2F, 0x55, 0x43, 0xC0, 0x00,
-    0x7D, 0xFD, 0x07, 0xFF, 0xF8, 0xBF, 0x5F, 0xCB, 0xD0, 0x3E, 0xBD, 0x03, 0xE7, 0xE0, 0x3E, 0x3F,
-    0xEF, 0xD1, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x01, 0xA8, 0x00, 0x3F, 0xFD, 0x02, 0xF0, 0xBC,
-    0x0F, 0x40, 0xF4, 0x3F, 0x0B, 0xC0, 0x7F, 0xFE, 0x00, 0x7F, 0xF4, 0x0F, 0xD6, 0xF4, 0x7D, 0x03,
-    0xF2, 0xF0, 0x0F, 0xC7, 0xE0, 0x7F, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0xC0, 0x0B, 0xE4, 0x00, 0x07,
-    0xF8, 0x02, 0xFF, 0xF4, 0x3C, 0x0B, 0xC7, 0x40, 0x3D, 0xB4, 0x03, 0xD7, 0x80, 0x3E, 0x3E, 0x6F,
-    0xE2, 0xFF, 0xFE, 0x06, 0xFF, 0xE0, 0x00, 0x3D, 0x3E, 0xAF, 0xC3, 0xFF, 0xF8, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF1, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC7, 0xF2,
-    0xFC, 0x00, 0x01, 0xF8, 0x2F, 0x83, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42, 0xFC,
-    0x2F, 0xC2, 0xF8, 0x3F, 0x47, 0xF0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0x90, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0x90, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFE,
-    0x80, 0x14, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x6F, 0xFF, 0xF8, 0x3F, 0xFF, 0x90,
-    0x03, 0xFE, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x01, 0xFF, 0xFC,
-    0x0F, 0xD1, 0xF8, 0x18, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03,
-    0xF0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBD, 0x02, 0xE0, 0x02, 0xE0,
-    0x00, 0x34, 0x03, 0xC3, 0xFC, 0x2C, 0x0B, 0x4A, 0x2C, 0x1C, 0x0F, 0x4C, 0x1C, 0x1C, 0x0F, 0x8F,
-    0xFC, 0x38, 0x0F, 0xC3, 0xEF, 0xF0, 0x0B, 0xE0, 0x06, 0x40, 0x03, 0xFD, 0x01, 0x40, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x06, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00,
-    0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x7F,
-    0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x7E, 0x07, 0xF0, 0x7D, 0x01, 0xF0, 0x7D, 0x01, 0xF0, 0x7E, 0x5B,
-    0xE0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xF4, 0x7D, 0x01, 0xFC, 0x7D, 0x00, 0xFC, 0x7F, 0xAB, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x7F, 0xFE, 0x80, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE1,
-    0xF8, 0x02, 0xFC, 0x7E, 0x00, 0x2F, 0x5F, 0x80, 0x03, 0xE7, 0xE0, 0x00, 0xF9, 0xF8, 0x00, 0x3F,
-    0x7E, 0x00, 0x0F, 0x9F, 0x80, 0x6F, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xD2, 0xFF, 0xFD,
-    0x2F, 0x95, 0x42, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xFF, 0x83, 0xFF, 0xF4, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1A,
-    0xA9, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x50, 0x3F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3A, 0x50, 0x7F, 0x00, 0xFF, 0xF0,
-    0xFD, 0x01, 0xBF, 0xD3, 0xFC, 0x00, 0x7E, 0x0B, 0xFE, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x3F, 0x00, 0x2F, 0x0F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02,
-    0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFE, 0xAA,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFD, 0x00, 0xFE, 0x7F, 0x40,
-    0x3F, 0x9F, 0xD0, 0x0F, 0xF0, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x1F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x50, 0x7F, 0x03, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xFD, 0x00, 0x05, 0x40, 0x00, 0x0F, 0xC3, 0xF8, 0x03, 0xF1, 0xFC, 0x00,
-    0xF8, 0xFD, 0x00, 0x3E, 0x7F, 0x00, 0x1F, 0xBF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0xFC, 0xFF, 0xC0,
-    0x3F, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF, 0xD0, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x15, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0,
-    0x07, 0xF0, 0xFF, 0x40, 0x3F, 0xC3, 0xFE, 0x00, 0xFF, 0x0F, 0xFC, 0x0B, 0xFD, 0x3F, 0xF8, 0x3F,
-    0xF4, 0xFF, 0xF1, 0xFF, 0xD3, 0xFF, 0xDF, 0xFF, 0x4F, 0xEF, 0xFF, 0xBD, 0x3F, 0x3F, 0xFA, 0xF4,
-    0xFC, 0xFF, 0xDF, 0xE3, 0xF1, 0xFF, 0x3F, 0x8F, 0xC3, 0xF8, 0xFE, 0x7F, 0x0F, 0xD3, 0xF9, 0xFD,
-    0x05, 0x0F, 0xE0, 0x05, 0x40, 0x0F, 0x87, 0xF0, 0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D,
-    0x2F, 0xF8, 0x1F, 0x4B, 0xFF, 0x07, 0xD2, 0xFB, 0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF,
-    0x0F, 0xE3, 0xFF, 0xC3, 0xF8, 0x7F, 0xF0, 0xFE, 0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8, 0x07, 0xF0, 0x03, 0xF4,
-    0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0xFC, 0x3F,
-    0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x02,
-    0xFF, 0xFD, 0x0B, 0xC0, 0xBC, 0x2F, 0x00, 0xF4, 0xFC, 0x07, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0x80, 0xFE, 0x90, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x0F, 0xE0, 0x7F, 0x80, 0x2F, 0x80, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x03, 0xE0,
-    0x7E, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x3F, 0x01, 0x03, 0xE0, 0x3F, 0x43, 0xEB, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01, 0xF0, 0x2E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF8,
-    0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
-    0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F,
-    0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0xD0, 0x1F, 0xC3,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x1F, 0x82, 0xF8, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF0, 0x0F,
-    0xD0, 0x2F, 0x80, 0x2F, 0xC0, 0xFD, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0xFE, 0x3F, 0x80, 0x02, 0xFE,
-    0xFD, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x14, 0x03, 0xF0, 0x1F, 0xC0,
-    0xBD, 0x07, 0xF0, 0x0F, 0xD0, 0xFF, 0x0B, 0xE0, 0x0F, 0xE2, 0xFF, 0x4F, 0xD0, 0x0B, 0xF3, 0xFF,
-    0xCF, 0xC0, 0x07, 0xFB, 0xFF, 0xEF, 0xC0, 0x07, 0xFF, 0xEB, 0xFF, 0x80, 0x03, 0xFF, 0xD7, 0xFF,
-    0x40, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00,
-    0x1F, 0x80, 0x0B, 0xC0, 0xFC, 0x00, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0xFD,
-    0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFF, 0x80, 0x02, 0xFE, 0xFD, 0x00, 0x7F, 0x4F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC3, 0xFC, 0x02,
-    0xFE, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03,
-    0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0xAA, 0x07, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0x87,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0x3F, 0xF0, 0xF4, 0x03, 0xD0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E,
-    0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0xBC, 0x00,
-    0x74, 0x00, 0x30, 0x00, 0x10, 0x3F, 0xF0, 0xFF, 0xC0, 0x2F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
-    0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xE0, 0x0F, 0x80,
-    0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0B, 0x80, 0x2F, 0x00, 0xBC, 0x7F, 0xF1, 0xFF, 0xC7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0xFB, 0xF0, 0x3D, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x54, 0x7D, 0x00, 0x7E, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40,
-    0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF1, 0x90, 0x03, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xF0, 0x3F, 0x42, 0xE0, 0xFC, 0x03, 0xC3, 0xF0, 0x0F, 0x0B, 0xC0, 0xBC, 0x2F, 0xFF, 0xE0, 0x7F,
-    0xFF, 0x00, 0xBF, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x0B, 0xEB, 0xC0, 0xFF,
-    0xFF, 0x0F, 0xDB, 0xFC, 0x3C, 0x07, 0xF1, 0xE0, 0x1F, 0x87, 0xD0, 0xBE, 0x0F, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xF0, 0x1B, 0xEB, 0xC0, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E,
-    0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xE0,
-    0xBF, 0x83, 0xD0, 0x0F, 0x01, 0xFF, 0xF7, 0xFF, 0xC7, 0xE5, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x07,
-    0xE0, 0x1F, 0x80, 0x7E, 0x00, 0x06, 0xF6, 0xF1, 0xFF, 0xFE, 0x3D, 0x1F, 0xE7, 0x80, 0xBE, 0x74,
-    0x07, 0xE7, 0x80, 0xBE, 0x3F, 0xFF, 0xD2, 0xFF, 0xFD, 0x0B, 0xFF, 0xD0, 0x04, 0x3C, 0x00, 0x0B,
-    0xC2, 0xFB, 0xF8, 0x3F, 0xFF, 0x02, 0xFF, 0x80, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xD1, 0xF4, 0x3E, 0x01,
-    0xE0, 0xF8, 0x07, 0xC3, 0xE0, 0x2F, 0x1F, 0x80, 0xBC, 0x7F, 0x03, 0xF1, 0xFC, 0x0F, 0xC0, 0x7D,
-    0xBD, 0xBE, 0xA9, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0x00, 0xA0,
-    0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80,
-    0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0xA4, 0x03, 0xDF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F,
-    0xFF, 0x80, 0x7D, 0xBF, 0x81, 0xF4, 0xBF, 0xC0, 0x2E, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03,
-    0xC0, 0x3C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xD4, 0x7F, 0xC7, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xBE, 0x4B, 0xE0, 0x1F, 0xFF, 0xEF, 0xF8, 0x2F, 0x83, 0xF8, 0x7D, 0x2F, 0x02, 0xF4,
-    0x3E, 0x3F, 0x02, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x3F, 0x3F, 0x03, 0xF0, 0x3F, 0x7E, 0x07, 0xE0,
-    0x3F, 0x7E, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4, 0x7D, 0x3D,
-    0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F, 0x02, 0xFD,
-    0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1,
-    0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xBF, 0xC0, 0x0F, 0xFA, 0xF0, 0x0F, 0xD0,
-    0x38, 0x0F, 0xC0, 0x3C, 0x0F, 0xC0, 0x3C, 0x0F, 0xD0, 0x3C, 0x0F, 0xFE, 0xFC, 0x1F, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xD0, 0x2F, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xF0, 0x1F, 0xFF, 0xE0, 0x3C, 0x0F, 0xE0, 0x78, 0x0B,
-    0xD0, 0x74, 0x07, 0xD0, 0x7C, 0x0B, 0xC0, 0x3F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xC1,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xF9, 0x00, 0x02, 0x40, 0x2F, 0xBC, 0x2F, 0xFD,
-    0x2F, 0xD4, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x0F, 0xAB, 0x00, 0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0,
-    0xFE, 0xFE, 0x3F, 0xFF, 0xC1, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x3F, 0xFF, 0x0F, 0xFF, 0xD0, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4,
-    0x00, 0x3E, 0xA0, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C,
-    0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB,
-    0xE0, 0x3D, 0x00, 0x3E, 0x2F, 0x00, 0x7C, 0x1F, 0x40, 0xF8, 0x0F, 0xC2, 0xF0, 0x07, 0xE3, 0xE0,
-    0x03, 0xFB, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x7D, 0x00, 0x03, 0xF3,
-    0xE0, 0x00, 0x3E, 0x3F, 0x0B, 0x07, 0xD2, 0xF1, 0xFC, 0xBC, 0x1F, 0x7F, 0xDF, 0xC0, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x03, 0xE2, 0xF0, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFB, 0xF0, 0x0F, 0xD3, 0xF8, 0x3F, 0x80, 0xFD, 0x3D, 0x00,
-    0xF8, 0xBC, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F,
-    0xF4, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x54, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0xBF,
-    0x40, 0xBF, 0xD0, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xFF, 0x00,
-    0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7F, 0xE0,
-    0x0F, 0xF8, 0x00, 0x59, 0x00, 0x02, 0xEB, 0x6D, 0xB6, 0xDB, 0x6D, 0xF7, 0xDF, 0x3C, 0xF3, 0xCF,
-    0x3C, 0x3F, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F,
-    0x80, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0A, 0x40, 0x00, 0x1F, 0x2C, 0xFE, 0xB3, 0x9F, 0x85, 0x14, 0x2A,
-    0x83, 0xFC, 0x3F, 0xC2, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0F, 0x41,
-    0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF8, 0x0F, 0x80, 0xB8, 0x0B, 0x80, 0xB4, 0x06, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x0B, 0xF4, 0x1F, 0xFE, 0x0F, 0xAC, 0x07, 0xCB, 0x01,
-    0xF2, 0xC0, 0x7D, 0xB0, 0x0F, 0xFD, 0x02, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0xE0, 0x00, 0x38, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0x01, 0x90, 0x0F, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x02, 0xE0, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x90, 0x3F, 0xFF, 0xF4, 0x2A, 0xAA, 0xA4, 0x00,
-    0x00, 0x00, 0x24, 0x0B, 0x02, 0xFF, 0xFF, 0x07, 0xFF, 0xF4, 0x0F, 0x8B, 0xC0, 0x3E, 0x1F, 0x40,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x20, 0x02, 0x00, 0x3E, 0x00, 0x3F, 0x0B, 0xE0,
-    0x3F, 0x00, 0xFE, 0x3F, 0x40, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x2F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0xF3, 0xCF, 0x3C, 0x40, 0x00, 0x28, 0xE3, 0x8E, 0x38, 0xE1, 0x00, 0x03, 0xF8, 0x03, 0xFF, 0xC1,
-    0xD0, 0x60, 0x7E, 0x40, 0x0F, 0xFD, 0x0B, 0xEF, 0xC3, 0xC0, 0xF4, 0xFF, 0xFD, 0x2F, 0xFF, 0x01,
-    0xFF, 0x80, 0x02, 0xF4, 0xE0, 0x3D, 0xBF, 0xFF, 0x0B, 0xFE, 0x00, 0x29, 0x1A, 0x0F, 0x8B, 0xC7,
-    0xF3, 0xF6, 0xFC, 0xFD, 0x1F, 0xD0, 0x79, 0xB4, 0xF6, 0x6C, 0xDC, 0x1C, 0xFB, 0x6C, 0x7E, 0xB4,
-    0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x24, 0xD3, 0x09, 0x3A, 0xE1, 0xFA, 0x00, 0x00, 0x00, 0x20, 0x20,
-    0x2C, 0x38, 0x3E, 0x7D, 0x3E, 0x7D, 0x2F, 0x3E, 0x07, 0xFB, 0xE0, 0x7E, 0xBD, 0x07, 0x8B, 0x40,
-    0x50, 0x40, 0x3F, 0xA9, 0x43, 0xFF, 0xFC, 0x16, 0xAF, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00,
-    0x68, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x1F, 0xD0, 0x7F, 0xF4, 0xE8, 0xAC, 0xDF, 0x9C, 0xFC, 0xEC,
-    0x7E, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFD, 0x2A, 0xA5, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0xF4,
-    0xF8, 0x7C, 0xF4, 0x3C, 0xFE, 0xFC, 0x7F, 0xF4, 0x1F, 0xD0, 0x00, 0x64, 0x00, 0x0B, 0x80, 0x00,
-    0xB8, 0x03, 0xFF, 0xFD, 0x2A, 0xFE, 0x90, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2E, 0x04, 0xD0, 0x34, 0x2C, 0x2D, 0x0F, 0xE1, 0x50, 0x2E,
-    0x00, 0x60, 0x18, 0x7D, 0x02, 0xCF, 0xE1, 0x90, 0x05, 0x03, 0x82, 0xD0, 0xF0, 0x2E, 0x00, 0xF4,
-    0xFC, 0x03, 0xD3, 0xF0, 0x0F, 0x4F, 0xC0, 0x3E, 0x3F, 0x01, 0xF8, 0xFD, 0x0B, 0xE3, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFE, 0x3E, 0xFE, 0xF8, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0xF3, 0xC2, 0xFF,
-    0x3C, 0x3F, 0xF3, 0xD7, 0xFE, 0x3D, 0x3F, 0xE3, 0xD1, 0xFE, 0x3D, 0x07, 0xE3, 0xD0, 0xBD, 0x3D,
-    0x0F, 0xD3, 0xD0, 0xFD, 0x3D, 0x0F, 0xC3, 0xD1, 0xFC, 0x2D, 0x2F, 0xC2, 0xD3, 0xFC, 0x2D, 0x15,
-    0x40, 0x40, 0x3E, 0x7E, 0x7F, 0x6A, 0x04, 0x0B, 0x03, 0xF0, 0x9E, 0x3F, 0x4A, 0x40, 0x18, 0x0F,
-    0x00, 0xC0, 0x30, 0x0C, 0x1F, 0xD1, 0x50, 0x00, 0x00, 0xF8, 0x38, 0xE3, 0x4A, 0x3F, 0xE0, 0xF8,
-    0x00, 0x00, 0x01, 0x05, 0x00, 0x38, 0x74, 0x03, 0xF7, 0xE0, 0x0B, 0xDF, 0x80, 0x3E, 0x7D, 0x0F,
-    0xEF, 0xC3, 0xF7, 0xF0, 0x2C, 0x3C, 0x01, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x02,
-    0xD0, 0x2B, 0x40, 0x07, 0xC0, 0x07, 0x40, 0x0F, 0x40, 0x0B, 0x40, 0x2E, 0x00, 0x0B, 0x40, 0x3C,
-    0x00, 0x0B, 0x40, 0xB8, 0x00, 0x3F, 0xF1, 0xF0, 0xB0, 0x3F, 0xF3, 0xE1, 0xF4, 0x00, 0x07, 0xC3,
-    0xB4, 0x00, 0x0F, 0x4E, 0x74, 0x00, 0x2F, 0x2E, 0xB9, 0x00, 0x7D, 0x3F, 0xFD, 0x00, 0xFC, 0x00,
-    0x78, 0x01, 0xF4, 0x00, 0xB8, 0x01, 0x50, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x05, 0x00, 0x2B, 0x40, 0x03, 0xD0, 0x00, 0x74, 0x00, 0x78, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x00,
-    0xB4, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x00, 0xBF, 0x0F, 0x85, 0x40, 0x3F, 0xF1, 0xF2,
-    0xFF, 0x40, 0x00, 0x3D, 0x14, 0x38, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x3F, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x0F, 0xD0, 0x00, 0xF8, 0x02, 0xFF, 0xC0, 0x2F, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x25, 0xB4, 0x02, 0xD0, 0x00, 0x38,
-    0x07, 0xC0, 0x05, 0xB0, 0x0F, 0x40, 0x0F, 0xF4, 0x2E, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x2F, 0xF8,
-    0xF4, 0xB0, 0x3F, 0xF2, 0xF1, 0xF4, 0x00, 0x03, 0xD3, 0xB4, 0x00, 0x0F, 0x8E, 0x74, 0x00, 0x1F,
-    0x2E, 0xB8, 0x00, 0x3E, 0x3F, 0xFD, 0x00, 0xBC, 0x00, 0x78, 0x01, 0xF4, 0x00, 0xB8, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xC0,
-    0x07, 0xF9, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00,
-    0x40, 0xFD, 0x0B, 0xC0, 0xFF, 0xFE, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xAF, 0x00, 0x01,
-    0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xE0, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40,
-    0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E,
-    0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0,
-    0x00, 0xFE, 0x00, 0x3C, 0x70, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0xE7, 0xF0, 0x00, 0x0A, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x0F, 0xAF, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00,
-    0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0x00,
-    0xFD, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xA0, 0x68, 0x00, 0x1F, 0x4F, 0xC0, 0x02, 0xF8, 0xFC, 0x00,
-    0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02,
-    0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0xA6, 0xBF, 0xFF, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xA5,
-    0x40, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0x8F, 0xFD, 0x68,
-    0x00, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0xC0, 0x02, 0xF4, 0x1F, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xAA, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0x80, 0x0F, 0xFF, 0xFF, 0x1F, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0,
-    0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x0B, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x0A, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xE9, 0x54, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF5, 0xA0, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xEA, 0xA8, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x80, 0x00, 0x1D,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0xFB, 0xF0, 0x0F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xF0, 0xFE, 0x95, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x5A, 0x00, 0xFF,
-    0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0xAA, 0x83, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x0F, 0xC7, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBE, 0x06, 0xA2, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xD6, 0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xAA, 0xA0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x3E, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x03, 0xF0, 0x07, 0xF4, 0x01, 0x03, 0xC1, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC7,
-    0xF4, 0x00, 0xE0, 0x00, 0x3F, 0x40, 0x0F, 0xFD, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x07, 0xF4, 0x00, 0x3E, 0x2F, 0x1F, 0x8F, 0xC7, 0xF3, 0xF5, 0xA8, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF8, 0x01, 0xF8, 0x02, 0xFC, 0x01, 0xF8, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x3E, 0x3F, 0xFF,
-    0xD0, 0x3F, 0x3F, 0xFF, 0xD0, 0x3F, 0x01, 0xF8, 0x00, 0x7E, 0x01, 0xF8, 0x06, 0xFE, 0x01, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x3D,
-    0x70, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x03, 0xE1, 0xFC, 0x00, 0xF4, 0x7F, 0x80, 0x7D, 0x1F, 0xF0, 0x1F, 0x4B, 0xFE, 0x07, 0xD2, 0xFF,
-    0xC1, 0xF4, 0xBE, 0xF8, 0xBC, 0x3F, 0xAF, 0x2F, 0x0F, 0xE7, 0xEB, 0xC3, 0xF8, 0xFF, 0xF0, 0xFE,
-    0x1F, 0xFC, 0x3F, 0x83, 0xFF, 0x0F, 0xF0, 0xBF, 0xC7, 0xFC, 0x0F, 0xF0, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0x6F, 0xE0, 0x1F, 0xC0, 0x0F, 0xD0, 0xFC, 0x00,
-    0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F,
-    0xC3, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0x9B, 0xF8,
-    0x07, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x1F,
-    0x80, 0x00, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80,
-    0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x34,
-    0x00, 0x01, 0xFD, 0xD0, 0x00, 0x0B, 0x3F, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0x6F, 0xE0, 0x1F, 0xC0, 0x0F, 0xD0, 0xFC,
-    0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x0F, 0xC3, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x68, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x1F, 0xCF, 0xD0, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F,
-    0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00,
-    0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0xFF, 0xD0, 0x03, 0xF8, 0x00, 0xBF,
-    0xD0, 0x2F, 0xBF, 0x85, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFE, 0x6F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x07, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0x83, 0xF8, 0xFC, 0x00,
-    0x00, 0x07, 0xE3, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFE,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF9, 0xFD, 0x00, 0xFD, 0x3F,
-    0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x0F,
-    0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFD, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xE7, 0xF4, 0x03, 0xF4, 0xFC, 0x00,
-    0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFC, 0x3F, 0x00,
-    0x3F, 0x0F, 0xC0, 0x0F, 0xC3, 0xF4, 0x07, 0xF0, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F,
-    0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0xA0, 0x00, 0xFC, 0x7D, 0x00, 0x3F, 0x2F, 0x80, 0x1F, 0xCF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F,
-    0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03,
-    0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4,
-    0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xFF, 0x40, 0x3F, 0xFC, 0x0F, 0x6F, 0x83, 0xC0, 0xF0, 0xF0, 0x7C, 0x3D, 0x7F,
-    0x0F, 0xFF, 0x03, 0xFE, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x3F,
-    0xFE, 0x01, 0xF0, 0x3C, 0x0B, 0x82, 0xF4, 0x2E, 0x2E, 0x40, 0xB8, 0xF0, 0x03, 0xF2, 0xE0, 0x0F,
-    0xC3, 0xF4, 0x3F, 0x03, 0xF0, 0xFD, 0x03, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x2A, 0x6E, 0x40,
-    0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F,
-    0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xE0, 0xBF, 0x7E, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80,
-    0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x01, 0xFD, 0x00, 0x7E, 0xF4, 0x1F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x02, 0x46, 0x00, 0xBE, 0x70, 0x0E, 0xBF, 0x00, 0xF2, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74,
-    0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x1F, 0x4F, 0xC2, 0xF4,
-    0xFC, 0x2F, 0x8F, 0xC2, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC,
-    0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B,
-    0xF7, 0xE0, 0x00, 0x10, 0x00, 0x1F, 0x80, 0x02, 0xEC, 0x00, 0x2F, 0xC0, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C,
-    0x74, 0x07, 0xD3, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0xE6, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xF4, 0x3F, 0xD1, 0xB8, 0x38, 0x07, 0xFF, 0xFF, 0x1D,
-    0x00, 0xFE, 0x95, 0x47, 0x40, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFD, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00, 0x3C, 0x00,
-    0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x2F, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0x40, 0x06, 0xF0,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xEF, 0x83, 0xE1, 0x7C, 0x3F, 0xFF,
-    0xE7, 0xEA, 0x54, 0x7D, 0x00, 0x03, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x2F, 0xF4, 0x00, 0x14, 0x00,
-    0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE,
-    0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x78, 0x00,
-    0x0F, 0xD0, 0x03, 0xFF, 0x40, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00,
-    0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x0A, 0x06, 0x81, 0xF4, 0xFC, 0x2F, 0x8F, 0xC3,
-    0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE,
-    0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE,
-    0x02, 0xFF, 0x40, 0x7D, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xD0, 0x1F, 0x40, 0x0E, 0x2D, 0x3C, 0x14,
-    0x00, 0x00, 0x00, 0x14, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x02, 0xFC, 0x00, 0xBE, 0xF0, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3C, 0x7C, 0x7D, 0x7D, 0xBD, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
-    0xD0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xF4, 0x00, 0x7F, 0xCF, 0x00, 0x1F,
-    0xFF, 0xF0, 0x03, 0xF0, 0xBF, 0x00, 0x3D, 0x03, 0xE0, 0x07, 0xD0, 0x3E, 0x00, 0x3F, 0x4B, 0xC0,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xE2, 0x80, 0x3F, 0xAC,
-    0x03, 0x6F, 0x80, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x03, 0xFF, 0xFC, 0x3F,
-    0x47, 0xD3, 0xD0, 0x3D, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x7E, 0x03, 0xF7, 0xE0, 0x3F, 0x7F, 0x03,
-    0xF0, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x1F, 0xFF, 0x83, 0xE0, 0x7D, 0x7C, 0x03, 0xE7, 0xC0, 0x3F, 0x3F, 0x5B, 0xE3, 0xFF, 0xFD, 0x1F,
-    0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x14, 0x00, 0x03, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7,
-    0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00,
-    0x74, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0x41, 0xF4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1,
-    0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x03, 0xC7, 0x00, 0xBF, 0x70, 0x0E, 0x7F, 0x00, 0xA1, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xFF, 0x83, 0xE0, 0x7D, 0x7C, 0x03, 0xE7, 0xC0, 0x3F, 0x3F, 0x5B,
-    0xE3, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x2F, 0xD0, 0x0A, 0x06, 0x81, 0xF4, 0xFC, 0x2F, 0x8F, 0xC3,
-    0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0,
-    0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x50, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-    0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xAF, 0xF4, 0x1F, 0x3E, 0xF8, 0x1F,
-    0x3D, 0xBC, 0x1F, 0xFD, 0xF8, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D, 0x7C, 0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x03, 0xE3,
-    0xC0, 0x7E, 0x3D, 0x0B, 0xE3, 0xFF, 0xFE, 0x2F, 0xFF, 0xE0, 0xBF, 0xBE, 0x00, 0x14, 0x00, 0x03,
-    0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F,
-    0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x00, 0x78, 0x00, 0x0F, 0xD0, 0x07, 0xFF, 0x41, 0xF4,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E,
-    0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x1F, 0x4F, 0xC1,
-    0xF4, 0xFC, 0x2F, 0x8F, 0xC2, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0,
-    0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE,
-    0x0B, 0xFB, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x0F, 0x8B, 0xC0, 0x3D, 0x0F, 0x81, 0xF0, 0x2F, 0x4F, 0x80, 0x3F, 0x3D, 0x00, 0xBF, 0xF0, 0x00,
-    0xFF, 0x80, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0xBF, 0xF0, 0x02,
-    0xFF, 0x40, 0x0B, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xFF, 0x80, 0x3F, 0xFC,
-    0x0F, 0x5F, 0xC3, 0xD0, 0xF0, 0xF4, 0x2D, 0x3D, 0x0F, 0x4F, 0x47, 0xC3, 0xD7, 0xE0, 0xFF, 0xF0,
-    0x3F, 0xE0, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC3,
-    0xF0, 0x2F, 0x4F, 0xC0, 0xFD, 0x7F, 0x02, 0xA5, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03,
-    0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00,
-    0xFE, 0x16, 0xAB, 0x83, 0xFF, 0xFC, 0x2A, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F,
-    0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x40, 0x14, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0xFF,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F,
-    0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x02,
-    0xF0, 0x7C, 0x1F, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B,
-    0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F,
-    0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEE, 0x01, 0xFF, 0xFC,
-    0x0F, 0x43, 0xF0, 0x38, 0x07, 0xC1, 0xD0, 0x0F, 0x07, 0x40, 0x7D, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xE0, 0x2F, 0xDF, 0xC0, 0x00, 0x2D, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x74,
-    0x00, 0x3C, 0x00, 0x1F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFB, 0xE0, 0x03, 0xD0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0,
-    0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x03, 0xF8, 0x01, 0xFB, 0xE0, 0x7C, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF,
-    0xE0, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x58, 0x01, 0xFF, 0xF0,
-    0x06, 0xFE, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4,
-    0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00,
-    0x3F, 0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x01,
-    0xA0, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD,
-    0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x03,
-    0xC0, 0x78, 0x00, 0xFA, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x28, 0x06,
-    0x81, 0xF6, 0xF0, 0x07, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01,
-    0xFF, 0xE0, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x58, 0x01, 0xFF,
-    0xF0, 0x06, 0xFE, 0x00, 0x05, 0x00, 0x50, 0x01, 0xF4, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x7F, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0x87, 0xE0, 0x0B, 0xF1, 0xF8, 0x00, 0xBD, 0x7E, 0x00, 0x0F, 0x9F, 0x80,
-    0x03, 0xE7, 0xE0, 0x00, 0xFD, 0xF8, 0x00, 0x3E, 0x7E, 0x01, 0xBF, 0x9F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x14,
-    0x00, 0x01, 0xF3, 0xD0, 0x00, 0x1F, 0x3C, 0x00, 0x01, 0xF7, 0xC0, 0x2F, 0xAF, 0x7C, 0x0F, 0xFF,
-    0xF0, 0x03, 0xF6, 0xFF, 0x00, 0x3C, 0x07, 0xF0, 0x07, 0x80, 0x7E, 0x00, 0x7D, 0x0B, 0xE0, 0x03,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x6F, 0xAF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xF8, 0x02, 0xFC, 0x01, 0xF8, 0x00, 0x7D, 0x01, 0xF8,
-    0x00, 0x3E, 0x3F, 0xFF, 0xD0, 0x3F, 0x3F, 0xFF, 0xD0, 0x3F, 0x01, 0xF8, 0x00, 0x7E, 0x01, 0xF8,
-    0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFF, 0xFC, 0x01, 0xAF, 0xEA, 0x00,
-    0x01, 0xF0, 0x00, 0xBE, 0xBC, 0x00, 0xFF, 0xFF, 0x00, 0xFD, 0xBF, 0xC0, 0x3C, 0x07, 0xF0, 0x1E,
-    0x01, 0xF8, 0x07, 0xD0, 0xBE, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x01, 0xBE, 0xBC, 0x00,
-    0x0A, 0xAF, 0xC0, 0xBF, 0xFF, 0x41, 0x95, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD6,
-    0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xAA, 0xA0, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x00, 0x15, 0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8,
-    0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFE, 0x95, 0x43, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x5A, 0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFE, 0xAA, 0x83, 0xFF, 0xFF, 0x1F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x04, 0x41, 0x41, 0xFF,
-    0xFC, 0x0F, 0xFF, 0x40, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F,
-    0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD6, 0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0xAA, 0xA0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x00, 0xF8,
-    0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0,
-    0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x2B, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xFA,
-    0x55, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xE0,
-    0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1,
-    0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x0F, 0x40, 0x01, 0xE0, 0x00, 0x1F,
-    0xD0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50, 0x3E, 0x1F, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xC3, 0xFA, 0x55, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x68, 0x03, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFA, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xE0, 0x2E, 0x03, 0xC0, 0xBE, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xEF, 0x83, 0xE1,
-    0x7C, 0x3F, 0xFF, 0xE7, 0xEA, 0x54, 0x7D, 0x00, 0x03, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x2F, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2E, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xA9, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x50, 0x3F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3A, 0x50, 0x7F, 0x00, 0xFF, 0xF0,
-    0xFD, 0x01, 0xBF, 0xD3, 0xFC, 0x00, 0x7E, 0x0B, 0xFE, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF4, 0x03,
-    0xD0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0xBC, 0x1F, 0xFF, 0xE0,
-    0xF4, 0x7F, 0x87, 0x80, 0xBE, 0x1D, 0x01, 0xF8, 0x78, 0x0B, 0xE0, 0xFF, 0xFF, 0x42, 0xFF, 0xFD,
-    0x02, 0xFF, 0xF4, 0x00, 0x43, 0xC0, 0x00, 0x2F, 0x02, 0xFB, 0xF8, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xA9, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x50, 0x3F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3A, 0x50, 0x7F, 0x00, 0xFF,
-    0xF0, 0xFD, 0x01, 0xBF, 0xD3, 0xFC, 0x00, 0x7E, 0x0B, 0xFE, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x2E, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6F, 0x1F, 0xFF, 0xE3, 0xD1,
-    0xFE, 0x78, 0x0B, 0xE7, 0x40, 0x7E, 0x78, 0x0B, 0xE3, 0xFF, 0xFD, 0x2F, 0xFF, 0xD0, 0xBF, 0xFD,
-    0x00, 0x43, 0xC0, 0x00, 0xBC, 0x2F, 0xBF, 0x83, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFE, 0x02, 0xFE, 0x40, 0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x0E, 0x94, 0x1F, 0xC0, 0x3F, 0xFC, 0x3F, 0x40, 0x6F, 0xF4, 0xFF, 0x00, 0x1F,
-    0x82, 0xFF, 0xAA, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xE4, 0x00,
-    0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF6, 0xF1, 0xFF, 0xFE, 0x3D, 0x1F, 0xE7, 0x80, 0xBE, 0x74, 0x07, 0xE7, 0x80, 0xBE, 0x3F, 0xFF,
-    0xD2, 0xFF, 0xFD, 0x0B, 0xFF, 0xD0, 0x04, 0x3C, 0x00, 0x0B, 0xC2, 0xFB, 0xF8, 0x3F, 0xFF, 0x02,
-    0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00, 0xBF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0x80, 0xBF, 0x90, 0x05, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xFC, 0x03, 0xA5, 0x07, 0xF0, 0x0F, 0xFF, 0x0F, 0xD0, 0x1B, 0xFD, 0x3F, 0xC0, 0x07,
-    0xE0, 0xBF, 0xEA, 0xBF, 0x40, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x6F, 0xF9, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x6F, 0x6F, 0x1F, 0xFF, 0xE3, 0xD1, 0xFE, 0x78, 0x0B, 0xE7, 0x40, 0x7E, 0x78, 0x0B,
-    0xE3, 0xFF, 0xFD, 0x2F, 0xFF, 0xD0, 0xBF, 0xFD, 0x00, 0x43, 0xC0, 0x00, 0xBC, 0x2F, 0xBF, 0x83,
-    0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xEF, 0x80, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x3F,
-    0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F,
-    0xC0, 0x0F, 0xD3, 0xFA, 0xAB, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3,
-    0xF4, 0x03, 0xF9, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEF,
-    0xD0, 0x03, 0xFF, 0xFC, 0x00, 0xFD, 0x1F, 0x40, 0x3E, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xE0,
-    0x2F, 0x01, 0xF8, 0x0B, 0xC0, 0x7F, 0x03, 0xF0, 0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0x0B, 0xC0, 0x3F,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0xBD, 0x07, 0xF5, 0x57, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFC, 0x00, 0xFE, 0x03, 0xFA, 0xAB, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xFE, 0x03, 0xF4, 0x03, 0xF8, 0x1F, 0xD0, 0x0F, 0xE0, 0x7F, 0x40, 0x3F, 0xC0,
-    0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF4, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xD1, 0xF4, 0x03, 0xE0, 0x1E, 0x00, 0xF8, 0x07,
-    0xC0, 0x3E, 0x02, 0xF0, 0x1F, 0x80, 0xBC, 0x07, 0xF0, 0x3F, 0x01, 0xFC, 0x0F, 0xC0, 0x3D, 0x31,
-    0xFF, 0xCB, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03,
-    0xF0, 0x1F, 0xD0, 0x09, 0x14, 0xFD, 0xB3, 0xBF, 0xCE, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7D, 0x01, 0xF4, 0x05,
-    0x5A, 0x82, 0xFF, 0xFC, 0x3F, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x01, 0xFD, 0x00, 0x1A, 0xAF, 0x43, 0xFF, 0xFC, 0x69, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-    0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC1, 0xFD, 0x1E,
-    0x03, 0xC0, 0x3F, 0x81, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF4, 0x2F, 0x82, 0xA4, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xF0, 0x1F, 0x01, 0xF4, 0x1F, 0x41, 0xF0, 0x3C,
-    0x03, 0xFC, 0x1F, 0xC0, 0x00, 0x3E, 0x0F, 0xC7, 0xF1, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x40,
-    0x14, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7D, 0x7D, 0xBD, 0x00, 0x0F, 0xC7, 0xD0, 0x00,
-    0xFC, 0x7D, 0x00, 0x1F, 0xC7, 0xD0, 0x01, 0xF8, 0x7D, 0x00, 0x1F, 0x87, 0xD0, 0x02, 0xF8, 0x7D,
-    0x00, 0x2F, 0x47, 0xD0, 0x02, 0xF4, 0x7E, 0x00, 0x3F, 0x07, 0xE0, 0x03, 0xF0, 0x7E, 0x00, 0x3F,
-    0x07, 0xF0, 0x03, 0xF0, 0xBF, 0x00, 0x3F, 0x0B, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x09,
-    0x0F, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x1A, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0x87, 0xD0, 0x3D, 0xBE, 0x03, 0xDF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x03, 0xD3, 0xC0, 0x3C, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x3C, 0x03, 0xC7,
-    0xC0, 0x3C, 0x7D, 0x07, 0xC7, 0xD0, 0x7C, 0x7E, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0xBF, 0x80, 0x0F,
-    0xF0, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF0,
-    0x03, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x14, 0x1F, 0xC0, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x40, 0x3F, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x7F, 0x40, 0x7E, 0xF4, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB4, 0x00, 0x2D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0xFE, 0x00, 0xFC, 0x7F, 0x00, 0x3E, 0x3F, 0x40, 0x0F, 0x9F, 0xC0, 0x07, 0xEF, 0xC0, 0x01, 0xFF,
-    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0x3F, 0xF0, 0x0F, 0xC3, 0xFF, 0x07, 0xF0, 0x7F, 0xF4, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0xA4, 0x03, 0xDF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x7D, 0xBF, 0x81,
-    0xF4, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0x54, 0x00, 0x00, 0x1D, 0x38, 0x0B, 0x3D,
-    0x02, 0xDE, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xFD, 0x00, 0xFB, 0xE0, 0x7C, 0xBE,
-    0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x54, 0x3F, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x40, 0x07, 0x40, 0xF0, 0x1F, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07,
-    0xC0, 0x7D, 0x47, 0xFC, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x54, 0x0F,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xD4, 0x1F, 0xF0, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x41, 0xFD, 0x07, 0xF0, 0x2F, 0x80, 0xFD, 0x07, 0xF0,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x14, 0x0B, 0xC0, 0xF4, 0x3F, 0x03, 0xC0, 0xFC,
-    0x0F, 0x03, 0xF0, 0x7C, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x15, 0x0F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x1F, 0x00, 0x2E, 0x2E, 0x3E,
-    0x3D, 0x3E, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7D, 0x40, 0x7F, 0xC0, 0x7F, 0xD0, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x3E, 0x0B, 0xC1, 0xF8, 0x3F, 0x07, 0xF0, 0xFC, 0x1A, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x15, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xD0, 0x2E, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x3D, 0x3D, 0x7E, 0x3C, 0xBE, 0x3C, 0x6A, 0x7C,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7D, 0x40, 0x7F, 0xC0, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00,
-    0x2F, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x05, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x7F, 0xFF, 0xF4, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xF0, 0x01, 0xFD, 0x7C, 0x00, 0x00, 0x1F, 0x50,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xF8, 0x7F, 0x00,
-    0x3D, 0x1F, 0xE0, 0x1F, 0x47, 0xFC, 0x07, 0xD2, 0xFF, 0x81, 0xF4, 0xBF, 0xF0, 0x7D, 0x2F, 0xBE,
-    0x2F, 0x0F, 0xEB, 0xCB, 0xC3, 0xF9, 0xFA, 0xF0, 0xFE, 0x3F, 0xFC, 0x3F, 0x87, 0xFF, 0x0F, 0xE0,
-    0xFF, 0xC3, 0xFC, 0x2F, 0xF1, 0xFF, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4,
-    0x7D, 0x3D, 0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F,
-    0x05, 0x40, 0x0F, 0x87, 0xF0, 0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D, 0x2F, 0xF8, 0x1F,
-    0x4B, 0xFF, 0x07, 0xD2, 0xFB, 0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF, 0x0F, 0xE3, 0xFF,
-    0xC3, 0xF8, 0x7F, 0xF0, 0xFE, 0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4, 0x7D, 0x3D,
-    0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F, 0x00, 0x54,
-    0x00, 0x1F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x01, 0x50, 0x00,
-    0x02, 0xE0, 0x7C, 0x00, 0x2F, 0xBC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3E, 0x1F, 0xC0, 0x0F, 0x47, 0xF8, 0x07,
-    0xD1, 0xFF, 0x01, 0xF4, 0xBF, 0xE0, 0x7D, 0x2F, 0xFC, 0x1F, 0x4B, 0xEF, 0x8B, 0xC3, 0xFA, 0xF2,
-    0xF0, 0xFE, 0x7E, 0xBC, 0x3F, 0x8F, 0xFF, 0x0F, 0xE1, 0xFF, 0xC3, 0xF8, 0x3F, 0xF0, 0xFF, 0x0B,
-    0xFC, 0x7F, 0xC0, 0xFF, 0x00, 0x0E, 0x01, 0xE0, 0x0F, 0xAF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x00, 0xFF, 0xFF,
-    0x03, 0xF4, 0x7D, 0x0F, 0x40, 0xF4, 0x3D, 0x03, 0xE0, 0xF4, 0x0F, 0x87, 0xE0, 0x3F, 0x1F, 0x80,
-    0xFC, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0x80, 0x07, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x03, 0xFF, 0xFC, 0x3F, 0x47, 0xD3,
-    0xD0, 0x3D, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x7E, 0x03, 0xF7, 0xE0, 0x3F, 0x7F, 0x03, 0xF0, 0x05,
-    0x40, 0x0F, 0x87, 0xF0, 0x03, 0xD1, 0xFE, 0x01, 0xF4, 0x7F, 0xC0, 0x7D, 0x2F, 0xF8, 0x1F, 0x4B,
-    0xFF, 0x07, 0xD2, 0xFB, 0xE2, 0xF0, 0xFE, 0xBC, 0xBC, 0x3F, 0x9F, 0xAF, 0x0F, 0xE3, 0xFF, 0xC3,
-    0xF8, 0x7F, 0xF0, 0xFE, 0x0F, 0xFC, 0x3F, 0xC2, 0xFF, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F,
-    0xFF, 0xC3, 0xF4, 0x7D, 0x3D, 0x03, 0xD3, 0xD0, 0x3E, 0x3D, 0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03,
-    0xF7, 0xF0, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xF9, 0xBF, 0x80, 0x7F,
-    0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8,
-    0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02,
-    0xFD, 0x00, 0x00, 0x40, 0x14, 0x00, 0x03, 0xEA, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80,
-    0x0F, 0xF9, 0xBF, 0x80, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xFC, 0x3E,
-    0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x01, 0x41, 0xFA, 0xFC, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE, 0x3F,
-    0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x01, 0xF8, 0x03, 0xF0, 0x0B,
-    0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x0F, 0xF9, 0xBF, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x2F, 0x40, 0x7E, 0x03, 0xF4,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0xFD, 0x6F, 0x80,
-    0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x15,
-    0x55, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xF9, 0xBF, 0xFF, 0xFC, 0x1F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xF5, 0x90, 0x3E, 0x00, 0x0B, 0xFF, 0xE0, 0x7E,
-    0x00, 0x0B, 0xFF, 0xE0, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFA, 0xA8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x0B, 0xE4, 0x07, 0xFF, 0xFF, 0xEF, 0x43,
-    0xE0, 0x7F, 0x85, 0xF1, 0xF0, 0x0F, 0xFF, 0xFD, 0x7C, 0x03, 0xFA, 0x95, 0x0F, 0xD6, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x02, 0xFD, 0x0B, 0xFD, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x2F, 0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01, 0xF0, 0x2E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
-    0xF8, 0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x0B, 0x80,
-    0x0F, 0x00, 0x00, 0x00, 0x2F, 0xBC, 0x2F, 0xFD, 0x2F, 0xD4, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01, 0xF0, 0x2E, 0x01, 0xF0,
-    0x3E, 0x03, 0xF0, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x3F, 0x43, 0xF0, 0x3F,
-    0x43, 0xF4, 0x3F, 0x43, 0xF8, 0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x3F, 0xC0, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0xBF, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xBC,
-    0x2F, 0xFD, 0x2F, 0xD4, 0x2F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40,
-    0x14, 0x01, 0x40, 0x1F, 0x4B, 0x80, 0x07, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x2E, 0x02, 0xE0, 0x2E, 0x01,
-    0xF0, 0x2E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0,
-    0x3F, 0x43, 0xF0, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF8, 0x3F, 0x43, 0xFC, 0x7F, 0x83, 0xFC, 0x00,
-    0x00, 0x00, 0x64, 0x06, 0x4F, 0x8F, 0x80, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0xBE, 0xF0, 0x2F, 0xFD, 0x0B, 0xF5, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x40,
-    0x0B, 0xE0, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0x80, 0x2F, 0xC1,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0xAF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xAB, 0x00,
-    0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0, 0xFE, 0xFE, 0x3F, 0xFF, 0xC1, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3D,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0xFC, 0x00, 0xBE, 0xF0, 0x2E, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0xFA, 0xB0, 0x0F, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xC0, 0x00, 0x7E, 0x0F,
-    0xEF, 0xE3, 0xFF, 0xFC, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x1B, 0xFF, 0xE4, 0x00, 0x0F, 0x40,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x0F, 0xAB, 0x00, 0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0, 0xFE, 0xFE,
-    0x3F, 0xFF, 0xC2, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0xBE, 0x00, 0x0A, 0xE0, 0x00, 0xF8, 0x00, 0x02,
-    0x80, 0x68, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0xBE,
-    0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0xB8, 0x02, 0xFC, 0x1F, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x02, 0xD0, 0xBD,
-    0xF8, 0x02, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0xFA, 0xB0,
-    0x0F, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xC0, 0x00, 0x7E, 0x0F, 0xEF, 0xE3, 0xFF, 0xFC, 0x1B,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x3F, 0xFF, 0x0F, 0xFF, 0xD0,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3E, 0xA0, 0x0F, 0xFC, 0x03, 0xFF, 0x40,
-    0xE0, 0x00, 0x7F, 0x00, 0x1B, 0xC0, 0x07, 0xD0, 0x00, 0x02, 0x40, 0x24, 0x00, 0xBC, 0xBC, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x01, 0xE0, 0xBC, 0x03, 0xE0, 0x54, 0x03, 0xE0, 0x00,
-    0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xEA, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0xF4, 0x03, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x0F, 0x40, 0x00, 0xFA, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xB8, 0xD0, 0x00, 0x3F, 0x78, 0x00, 0x1D, 0xFD, 0x00, 0x02, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3,
-    0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0,
-    0xFC, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0x00, 0xBF, 0xF0, 0x0F, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E,
-    0x3C, 0x07, 0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x00, 0x01, 0x50,
-    0x01, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03,
-    0xF4, 0xFC, 0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00,
-    0xFC, 0x3F, 0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x43, 0xFF, 0xFC, 0x3F, 0xFA, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07,
-    0xE3, 0xD0, 0xBE, 0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x0B, 0xFB, 0xE0, 0x01, 0x44, 0x10, 0x00, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC,
-    0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F,
-    0x40, 0x7F, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x1F, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D, 0x7C, 0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x03, 0xE3, 0xC0,
-    0x7E, 0x3D, 0x0B, 0xE3, 0xFF, 0xFE, 0x2F, 0xFF, 0xE0, 0xBF, 0xBE, 0x00, 0x2E, 0x00, 0x00, 0x1E,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC,
-    0x00, 0xFD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F,
-    0x00, 0x3F, 0x0F, 0xD0, 0x1F, 0xC3, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D, 0x7C, 0x03, 0xD7, 0xC0, 0x3D, 0x3C,
-    0x03, 0xE3, 0xC0, 0x7E, 0x3D, 0x0B, 0xE3, 0xFF, 0xFE, 0x2F, 0xFF, 0xE0, 0xBF, 0xBE, 0x00, 0xF8,
-    0x02, 0xF0, 0x1F, 0x80, 0x3F, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x1F, 0xD0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x40,
-    0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x03,
-    0xE0, 0x2F, 0x40, 0x7E, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xD0, 0x01, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3D, 0x00, 0x0F, 0x00, 0xF8, 0x00, 0x3C,
-    0x07, 0xE0, 0x00, 0xF4, 0x2F, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFB,
-    0xE0, 0x00, 0x7F, 0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xD3, 0xF0, 0x03, 0xF4, 0xFC, 0x00, 0xFD, 0x3F,
-    0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F,
-    0xD0, 0x1F, 0xC3, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x03, 0xD7, 0xC0, 0x3D, 0x7C, 0x03, 0xD3, 0xC0, 0x3E, 0x3C, 0x07, 0xE3, 0xE0, 0xBE, 0x3F,
-    0xFF, 0xE1, 0xFF, 0xFE, 0x07, 0xFB, 0xE0, 0x00, 0xB8, 0x00, 0x1E, 0x00, 0x01, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x54, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x02, 0xF8,
-    0x2F, 0x80, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x28, 0x03, 0xF0, 0x1F, 0xC0, 0xBE, 0x07, 0xF0, 0x0F,
-    0xD0, 0xFF, 0x0B, 0xE0, 0x0F, 0xE2, 0xFF, 0x4F, 0xD0, 0x0B, 0xF3, 0xFF, 0xCF, 0xC0, 0x07, 0xFB,
-    0xFF, 0xEF, 0xC0, 0x03, 0xFF, 0xEB, 0xFF, 0x80, 0x03, 0xFF, 0xD7, 0xFF, 0x40, 0x03, 0xFF, 0xC3,
-    0xFF, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xEF, 0x40, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x3E, 0x3F,
-    0x0B, 0x07, 0xD2, 0xF1, 0xFC, 0xBC, 0x1F, 0x7F, 0xDF, 0xC0, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xF0, 0x03, 0xF8, 0xFE, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2E, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4,
-    0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x07, 0xF4, 0x00, 0x7E, 0xF4, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x03, 0xE2, 0xF0, 0x0F, 0x43, 0xE0, 0x7C, 0x0B, 0xD3, 0xE0,
-    0x0F, 0xCF, 0x40, 0x2F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0x2F, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0xF8, 0x00,
-    0x3F, 0x1F, 0x80, 0x03, 0xF2, 0xFC, 0x00, 0x2A, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F,
-    0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xEA,
-    0xA0, 0x7F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xE5, 0x40,
-    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xEA, 0xA0, 0x7F, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xBC, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xE5, 0x40, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF,
-    0xEA, 0xA0, 0x7F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x3F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x54, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF0, 0x00, 0x40, 0x3F, 0xE1,
-    0xFF, 0x8B, 0xD0, 0x3F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x03,
-    0x82, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0xF4, 0x01, 0xFB, 0xE0, 0x7C, 0x0B, 0x80,
-    0x1F, 0x2C, 0xFE, 0xB3, 0x9F, 0x85, 0x14, 0x00, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFE, 0x80, 0x00,
-    0x00, 0x54, 0x2F, 0xFF, 0xFD, 0x7F, 0xAA, 0xA9, 0x00, 0x00, 0x0F, 0x43, 0xC3, 0xFF, 0xF0, 0x7F,
-    0xF0, 0x00, 0x40, 0x00, 0x29, 0x0F, 0xC3, 0xF1, 0xFC, 0x00, 0x00, 0x3C, 0x7C, 0x7D, 0x7D, 0xBD,
-    0xBD, 0x38, 0x09, 0x2C, 0x10, 0x1F, 0x0E, 0xE3, 0xF8, 0x7C, 0x00, 0xF8, 0x02, 0xF0, 0x1F, 0x80,
-    0x2F, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0x81, 0xFB, 0xE0, 0x07, 0xF8,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x7F, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x3F, 0x03, 0xF8, 0x2F, 0xC0, 0xA8, 0x1A, 0x91,
-    0xFD, 0x1F, 0xC2, 0xF8, 0x3F, 0x47, 0xF0, 0x2A, 0x83, 0xFC, 0x2F, 0x81, 0xFC, 0x0F, 0xD0, 0xFE,
-    0x0B, 0x4B, 0xD3, 0xF4, 0x2D, 0x01, 0x00, 0x38, 0x0F, 0x83, 0xF4, 0xE0, 0x10, 0x00, 0x29, 0x50,
-    0x0F, 0xFF, 0xC1, 0x56, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x1D, 0x1E, 0x2D, 0x7C, 0x20, 0x04,
-    0x2D, 0x38, 0x3D, 0x08, 0x00, 0x05, 0x00, 0xF0, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x0F, 0x00,
-    0x50, 0x00, 0x14, 0xBE, 0x14, 0x00, 0x1A, 0xBF, 0x83, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x29, 0x0F,
-    0x87, 0xF2, 0xFC, 0x3C, 0x3C, 0x7D, 0x7D, 0xBD, 0xBD, 0x00, 0x00, 0x1F, 0x0E, 0xE3, 0xF8, 0x7C,
-    0x2A, 0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0x04, 0x0B, 0x03, 0xF0, 0x9E, 0x3F, 0x4A,
-    0x40, 0x1E, 0x1F, 0x4F, 0x43, 0xFD, 0x7F, 0x40, 0x00, 0x15, 0x3E, 0x3E, 0x3E, 0x3E, 0x7E, 0x7F,
-    0xFD, 0xFF, 0xF7, 0xCB, 0xDF, 0x1F, 0x29, 0x00, 0xA0, 0x3E, 0x2F, 0x40, 0x3F, 0xF4, 0x00, 0x3F,
-    0x40, 0x00, 0x78, 0x00, 0x00, 0x24, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xF7, 0xF0, 0x3E,
-    0x02, 0xF0, 0x3D, 0x3A, 0xFD, 0xEF, 0x3F, 0xBC, 0x7C, 0x1A, 0xFF, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x2A, 0xFF, 0x1F, 0xFF, 0xD5, 0x55, 0x40, 0x3D, 0x3A, 0xFD, 0xEF, 0x3F, 0xBC, 0x7C, 0xBF, 0xFF,
-    0xEF, 0xFF, 0xF0, 0x10, 0x7C, 0x1D, 0x7C, 0x74, 0x00, 0x00, 0x00, 0xF8, 0x7D, 0xF8, 0x7D, 0xFF,
-    0xFD, 0xFF, 0xFD, 0x55, 0x54, 0x7F, 0xF9, 0xFF, 0xE7, 0x47, 0x9D, 0x1E, 0x7F, 0xF9, 0xFF, 0xE0,
-    0x05, 0x60, 0xFF, 0xD3, 0x7B, 0x8C, 0xEA, 0x11, 0x00, 0x25, 0x40, 0xF0, 0x0F, 0x03, 0x68, 0x1F,
-    0x2C, 0xFE, 0xB3, 0x9F, 0x85, 0x14, 0x03, 0x8F, 0xAE, 0x90, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x8B,
-    0x83, 0xF3, 0xF0, 0xFC, 0xFC, 0x7F, 0xFD, 0xFF, 0xF7, 0xCB, 0xDF, 0x1F, 0x1A, 0xBF, 0xC3, 0xFF,
-    0xFC, 0x15, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x2D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x45, 0xBD, 0x01,
-    0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x30, 0x3F, 0xBE, 0xBF, 0xEF, 0xF6, 0xFE, 0xB6, 0xFC, 0x03,
-    0x80, 0x03, 0x40, 0x0B, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFC, 0x1F, 0xFF, 0xD1, 0xFC, 0x3F, 0xCB, 0xF6,
-    0xFC, 0x3F, 0xC1, 0xFF, 0xF4, 0x15, 0x5E, 0x1A, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x29, 0x7F, 0xF2, 0xEB, 0xCB, 0xFD, 0x14, 0x1A, 0x41, 0xA4, 0x14,
-    0x7F, 0xE3, 0xEB, 0xDF, 0x7D, 0x68, 0x7F, 0xC0, 0x01, 0xA4, 0x00, 0x01, 0x04, 0x03, 0xD7, 0xC0,
-    0x10, 0x40, 0x00, 0x18, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE1, 0xF4, 0x00,
-    0x6F, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x54, 0x00, 0x00, 0x15, 0x50, 0x00, 0x0F, 0xFF, 0xFE,
-    0x01, 0xF4, 0x00, 0x6F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x3F,
-    0x54, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xD5, 0x80, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x03,
-    0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xAA, 0x91, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC,
-    0x0F, 0xC7, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBE, 0x06, 0xA2, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xBF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0xA5, 0x50, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD6,
-    0x80, 0x3F, 0xFF, 0x40, 0xFF, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xAA, 0xA0, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xF0, 0x7E, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC2, 0xFE, 0x00, 0xBD, 0x2F, 0xC0, 0x05, 0x41, 0x50, 0x00,
-    0x04, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xE0, 0x7F,
-    0x01, 0xF4, 0x01, 0xF4, 0x2F, 0x00, 0x05, 0x43, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xE0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x1F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0xBE, 0x01, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x2F, 0xC0, 0xB8, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x0A, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x1F, 0xD0, 0x00, 0x00, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
-    0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF4, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x50, 0x7F, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xD0, 0x3F, 0xFD, 0x00, 0x05, 0x40,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x0B, 0x40, 0x00, 0x0F, 0x02,
-    0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x01, 0xF0, 0x2D, 0x00, 0x00, 0x7C, 0x0B, 0xFF, 0x80, 0x1F,
-    0x02, 0xFF, 0xFC, 0x07, 0x80, 0xB8, 0x2F, 0x42, 0xE0, 0x2E, 0x03, 0xE0, 0xB8, 0x0B, 0x96, 0xF4,
-    0xBE, 0x02, 0xFF, 0xFC, 0x3F, 0x40, 0xBF, 0xF8, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xC0, 0x00, 0xF8, 0x03, 0xC0,
-    0x00, 0xF8, 0x03, 0xC0, 0x00, 0xF8, 0x03, 0xC0, 0x00, 0xFF, 0xFF, 0xFA, 0x80, 0xFF, 0xFF, 0xFF,
-    0xF4, 0xF8, 0x03, 0xFF, 0xFC, 0xF8, 0x03, 0xD0, 0xBC, 0xF8, 0x03, 0xD0, 0x7D, 0xF8, 0x03, 0xE5,
-    0xFC, 0xF8, 0x03, 0xFF, 0xF8, 0xF8, 0x03, 0xFF, 0xE0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0xF8, 0x00, 0x3F, 0x80, 0x7C, 0x00, 0x3F, 0x40,
-    0x7C, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x3F, 0x80, 0xBC, 0x00, 0x3F, 0x80, 0xBC, 0x00, 0x01, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFE,
-    0x00, 0xFC, 0x7F, 0x00, 0x3E, 0x3F, 0x40, 0x0F, 0x9F, 0xC0, 0x07, 0xEF, 0xC0, 0x01, 0xFF, 0xE0,
-    0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0x00, 0x3F, 0x3F, 0xF0, 0x0F, 0xC3, 0xFF, 0x07, 0xF0, 0x7F, 0xF4, 0x07, 0xD0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x50, 0x3D, 0x00, 0xFE, 0x0F, 0x80, 0x7F, 0x83, 0xE0, 0x3F, 0xE0, 0xF8,
-    0x1F, 0xFC, 0x3E, 0x0F, 0xFF, 0x0F, 0xC7, 0xEF, 0xC3, 0xF3, 0xF7, 0xF0, 0xFD, 0xF9, 0xFC, 0x3F,
-    0xFC, 0x7F, 0x0F, 0xFE, 0x1F, 0xD2, 0xFF, 0x47, 0xF4, 0xBF, 0xC2, 0xFD, 0x2F, 0xD0, 0xBF, 0x80,
-    0x01, 0x00, 0x40, 0x3F, 0xAF, 0x40, 0xBF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x7D, 0x01, 0xF4, 0xFC, 0x0B, 0xC1, 0xF8, 0x3E, 0x03, 0xF0,
-    0xF4, 0x07, 0xE7, 0xC0, 0x0F, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x03, 0xE7, 0xD0, 0x0F, 0x9F, 0x40, 0x3E, 0x7D, 0x00, 0xF9, 0xF4, 0x03, 0xE7, 0xD0, 0x0F,
-    0x9F, 0x40, 0x3E, 0x7D, 0x00, 0xF9, 0xF4, 0x03, 0xE7, 0xD0, 0x0F, 0x9F, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xF8, 0xAB, 0xFA, 0x90, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F, 0x4F,
-    0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x55, 0x55, 0x2F,
-    0xFF, 0xCB, 0xD5, 0x42, 0xF0, 0x00, 0xBC, 0x00, 0x1F, 0xF9, 0x07, 0xFF, 0xE1, 0xF0, 0x7C, 0x7C,
-    0x07, 0x5F, 0x03, 0xE7, 0xFF, 0xF4, 0xFF, 0xFC, 0x3F, 0xE4, 0x00, 0x15, 0x40, 0x0B, 0xFF, 0xD0,
-    0xB0, 0x0F, 0x0B, 0x00, 0x74, 0xB0, 0x0B, 0x4B, 0xFF, 0xE0, 0xBF, 0xF8, 0x0B, 0x55, 0xF4, 0xB0,
-    0x03, 0xCB, 0x00, 0x3C, 0xBA, 0xAF, 0xCB, 0xFF, 0xFC, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xF5, 0x7D, 0x00,
-    0x1F, 0x03, 0xE0, 0x01, 0xF0, 0x3E, 0x00, 0x1F, 0x03, 0xE0, 0x02, 0xF0, 0x3E, 0x00, 0x2F, 0x03,
-    0xE0, 0x02, 0xF0, 0x3E, 0x00, 0x7E, 0x03, 0xE0, 0x2F, 0xFA, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0x81, 0xF0, 0x01, 0xF4, 0x0A, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFE, 0x0F, 0xD5, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF5, 0x60, 0x0F, 0xFF, 0xC0,
-    0x3F, 0xFF, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xEA, 0xA4, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF,
-    0xC7, 0xFF, 0xFF, 0x00, 0x07, 0xF0, 0xBF, 0x83, 0xF4, 0x00, 0xFE, 0x2F, 0xE2, 0xFC, 0x00, 0x0F,
-    0xC7, 0xF4, 0xFD, 0x00, 0x02, 0xFD, 0xFD, 0xBE, 0x00, 0x00, 0x3F, 0xBF, 0xBF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE,
-    0xFE, 0xFF, 0x80, 0x0F, 0xFD, 0x7F, 0x5F, 0xFC, 0x0F, 0xFE, 0x1F, 0xE2, 0xFF, 0xC0, 0x2F, 0xF4,
-    0x1F, 0xFF, 0x41, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0xBC,
-    0x00, 0x1F, 0x24, 0x0B, 0xCB, 0xFF, 0xF2, 0xFF, 0xF8, 0x6F, 0xF4, 0x00, 0x7D, 0x00, 0x14, 0x0F,
-    0x40, 0x3F, 0x83, 0xE0, 0x1F, 0xE0, 0xF8, 0x0F, 0xF8, 0x3E, 0x07, 0xFF, 0x0F, 0x83, 0xFF, 0xC3,
-    0xF1, 0xFB, 0xF0, 0xFC, 0xFD, 0xFC, 0x3F, 0x7E, 0x7F, 0x0F, 0xFF, 0x1F, 0xC3, 0xFF, 0x87, 0xF4,
-    0xBF, 0xD1, 0xFD, 0x2F, 0xF0, 0xBF, 0x4B, 0xF4, 0x2F, 0xE0, 0x05, 0x00, 0x40, 0x03, 0xEA, 0xF0,
-    0x00, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x14, 0x0F, 0x40, 0x3F, 0x83, 0xE0, 0x1F, 0xE0, 0xF8, 0x0F,
-    0xF8, 0x3E, 0x07, 0xFF, 0x0F, 0x83, 0xFF, 0xC3, 0xF1, 0xFB, 0xF0, 0xFC, 0xFD, 0xFC, 0x3F, 0x7E,
-    0x7F, 0x0F, 0xFF, 0x1F, 0xC3, 0xFF, 0x87, 0xF4, 0xBF, 0xD1, 0xFD, 0x2F, 0xF0, 0xBF, 0x4B, 0xF4,
-    0x2F, 0xE0, 0x0F, 0xC3, 0xF8, 0x03, 0xF1, 0xFC, 0x00, 0xF8, 0xFD, 0x00, 0x3E, 0x7F, 0x00, 0x1F,
-    0xBF, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F,
-    0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0xFC, 0xFF, 0xC0, 0x3F, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF, 0xD0,
-    0x01, 0x55, 0x54, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0xFC, 0x3F, 0x03, 0xF0, 0xFC, 0x0F, 0xC3,
-    0xF0, 0x3E, 0x0F, 0xC0, 0xF8, 0x3F, 0x03, 0xE0, 0xFC, 0x1F, 0x43, 0xF0, 0x7D, 0x0F, 0xC2, 0xF4,
-    0x3F, 0x3F, 0xC0, 0xFC, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xC3, 0xFC, 0x02,
-    0xFC, 0x3F, 0xD0, 0x3F, 0xC3, 0xFF, 0x0B, 0xFC, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x9F, 0xFC, 0x3E,
-    0xFF, 0xFB, 0xC3, 0xE7, 0xFE, 0xBC, 0x3E, 0x3F, 0xDB, 0xC3, 0xF3, 0xFC, 0xBC, 0x3F, 0x1F, 0x8B,
-    0xC3, 0xF0, 0x00, 0xBC, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x0F, 0xC0,
-    0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0,
-    0x03, 0xF4, 0xFE, 0xAA, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFD,
-    0x00, 0xFE, 0x7F, 0x40, 0x3F, 0x9F, 0xD0, 0x0F, 0xF0, 0x00, 0x6F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0xFF, 0x9B, 0xF8, 0x07, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x7F, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x50, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0x80, 0x7D, 0x3E, 0x01, 0xF4,
-    0xF8, 0x07, 0xD3, 0xE0, 0x1F, 0x4F, 0x80, 0x7D, 0x3E, 0x01, 0xF4, 0xF8, 0x07, 0xD3, 0xE0, 0x1F,
-    0x4F, 0xC0, 0x7D, 0x3F, 0x01, 0xF4, 0xA8, 0x06, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x02, 0xFF,
-    0xFD, 0x0B, 0xC0, 0xBC, 0x2F, 0x00, 0xF4, 0xFC, 0x07, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0x80, 0xFE, 0x90, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F,
-    0xF4, 0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x80,
-    0x00, 0x3F, 0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x03, 0xD3, 0xF0, 0x2F, 0x07, 0xD0, 0xF8, 0x0F, 0xC3, 0xD0, 0x1F, 0x9F, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x3F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x03, 0xEB,
-    0xFB, 0xE2, 0xC0, 0xF8, 0x3C, 0xB0, 0x7E, 0x0F, 0x1F, 0xFF, 0xEF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0xFC, 0x00, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x2F, 0x4B,
-    0xD0, 0x00, 0xFD, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFE, 0xFD, 0x00, 0x7F, 0x4F, 0xF0, 0x0F, 0xF0, 0x3F,
-    0xC3, 0xFC, 0x02, 0xFE, 0x14, 0x00, 0x40, 0x3D, 0x02, 0xE0, 0x3D, 0x02, 0xE0, 0x3D, 0x02, 0xE0,
-    0x3D, 0x02, 0xE0, 0x3D, 0x02, 0xF0, 0x3E, 0x02, 0xF0, 0x3E, 0x02, 0xF0, 0x3E, 0x03, 0xF0, 0x3E,
-    0x03, 0xF0, 0x3E, 0x03, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x01, 0x1E, 0x01, 0xE7, 0x40, 0xB9, 0xD0, 0x2E,
-    0xB0, 0x0B, 0xAC, 0x03, 0xEB, 0x82, 0xFD, 0xFF, 0xFF, 0x3F, 0xFB, 0xC1, 0x91, 0xF0, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x07, 0xC0, 0x14, 0x00, 0x05, 0x0F, 0x87, 0xD3, 0xE3, 0xE1, 0xF4, 0xF8, 0xF8,
-    0x7D, 0x3E, 0x3E, 0x1F, 0x4F, 0x8F, 0x83, 0xD3, 0xE3, 0xE0, 0xF4, 0xF8, 0xF8, 0x3D, 0x3E, 0x3E,
-    0x0F, 0x4F, 0x8F, 0x83, 0xD2, 0xE3, 0xE0, 0xF4, 0xB8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x8A,
-    0xAA, 0xAA, 0x90, 0x3E, 0x0A, 0x0F, 0x80, 0xF8, 0x7D, 0x3E, 0x03, 0xE1, 0xF4, 0xF8, 0x0F, 0x87,
-    0xD3, 0xE0, 0x3E, 0x0F, 0x4F, 0x80, 0xF4, 0x3D, 0x3E, 0x03, 0xD0, 0xF4, 0xF8, 0x0F, 0x43, 0xD3,
-    0xE0, 0x3D, 0x0F, 0x4F, 0x80, 0xF4, 0x3D, 0x2E, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xA0, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x03, 0xC0, 0xFC, 0x00, 0xF0, 0x2F, 0x00, 0x3D, 0x6F, 0xC0,
-    0x0F, 0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0x80,
-    0x00, 0x02, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0B, 0xC3,
-    0xC0, 0x00, 0x02, 0xF0, 0xFF, 0xF4, 0x00, 0xBC, 0x3F, 0xFF, 0x40, 0x2F, 0x4F, 0x03, 0xF0, 0x0B,
-    0xD3, 0xC0, 0xBC, 0x02, 0xF4, 0xF5, 0xBF, 0x00, 0xBE, 0x3F, 0xFF, 0x40, 0x3F, 0x8F, 0xFF, 0x40,
-    0x0F, 0xE0, 0x28, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xFF,
-    0xD0, 0x3F, 0xFF, 0x43, 0xC0, 0xFC, 0x3C, 0x0B, 0xC3, 0xD6, 0xFC, 0x3F, 0xFF, 0x43, 0xFF, 0xD0,
-    0x00, 0xBF, 0x90, 0x00, 0xFF, 0xFE, 0x00, 0xFD, 0x0B, 0xE0, 0xBC, 0x00, 0x7D, 0x15, 0x00, 0x0F,
-    0x80, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x1F,
-    0xE3, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xFF, 0x80, 0xB4, 0x7F, 0xFF, 0x0B, 0x4F, 0xC1, 0xF4, 0xB5,
-    0xF0, 0x0B, 0x8B, 0xFF, 0x00, 0x7C, 0xBF, 0xE0, 0x03, 0xCB, 0xFE, 0x00, 0x3C, 0xBA, 0xF0, 0x07,
-    0xCB, 0x1F, 0xD6, 0xF8, 0xB0, 0xFF, 0xFF, 0x4B, 0x07, 0xFF, 0xE0, 0xB0, 0x1B, 0xF4, 0x00, 0x00,
-    0xBF, 0xF8, 0x03, 0xFF, 0xF8, 0x0B, 0xC0, 0xB8, 0x0B, 0x80, 0xBC, 0x0F, 0x80, 0xBC, 0x0B, 0xC0,
-    0xBC, 0x07, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x0B, 0xC1, 0xFC, 0x0F, 0xC0, 0xFC,
-    0x1F, 0xC1, 0xFD, 0x3F, 0xC1, 0xFD, 0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xB8, 0x1F, 0xFF, 0xC3, 0xD0, 0xFC, 0x38, 0x07, 0xC7, 0x40, 0x3C, 0x74, 0x07, 0xD3, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xE0, 0xBF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x6F, 0x00, 0xBF, 0xF8,
-    0x0B, 0xFF, 0xC0, 0x7E, 0x00, 0x03, 0xF1, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0xFE, 0x0F,
-    0xE3, 0xF0, 0x1F, 0x8F, 0xC0, 0x7E, 0x2F, 0x87, 0xF8, 0x3F, 0xFF, 0xC0, 0xBF, 0xFD, 0x00, 0x7F,
-    0x80, 0xFF, 0xE0, 0xFA, 0xB8, 0xF0, 0x3C, 0xFA, 0xF8, 0xFF, 0xF8, 0xF0, 0x2E, 0xFA, 0xBF, 0xFF,
-    0xFE, 0xFF, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0xFF, 0xF4, 0x00, 0xF6, 0xF4, 0x01, 0xF1, 0xF4, 0x02, 0xF1, 0xF4, 0x03, 0xF1,
-    0xF4, 0x0B, 0xD1, 0xF4, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x2F, 0xAA, 0xBD, 0x1F, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E, 0xA5, 0x47,
-    0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x07, 0xE0, 0xFE, 0x0F, 0xD0, 0x03,
-    0xF4, 0xFF, 0x2F, 0x80, 0x00, 0xFC, 0xBE, 0x3F, 0x00, 0x00, 0x7E, 0xBD, 0xFD, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0xFF, 0x7F,
-    0xD0, 0x2F, 0xF4, 0xFF, 0x2F, 0xF8, 0x1F, 0xD0, 0x96, 0xC0, 0x03, 0x41, 0x6C, 0x0F, 0xF0, 0x02,
-    0xD1, 0x57, 0x8F, 0xFD, 0x2F, 0xE0, 0x3C, 0x03, 0xF0, 0xF0, 0x2F, 0xC3, 0xC0, 0xFF, 0x0F, 0x0F,
-    0xFC, 0x3D, 0xBE, 0xF0, 0xF7, 0xE7, 0xC3, 0xFF, 0x1F, 0x0F, 0xF4, 0x7C, 0x3F, 0xC1, 0xF4, 0xFC,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x04, 0x2F, 0xAF, 0x87, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x24, 0x38, 0x2F, 0x0E, 0x0F, 0xC3, 0xCB, 0xF0, 0xF3, 0xBC,
-    0x3E, 0xDF, 0x4F, 0xF3, 0xD3, 0xF4, 0xF4, 0xFC, 0x3E, 0x3D, 0x3E, 0x03, 0xCB, 0xC0, 0x3D, 0xF0,
-    0x03, 0xFD, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0x9F, 0xD0, 0xF8, 0x7F, 0x80,
-    0x06, 0xAA, 0x0B, 0xFF, 0x0B, 0x4F, 0x0B, 0x4F, 0x0B, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F,
-    0x3F, 0x1F, 0x28, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x3F, 0x81, 0xF8, 0x3F, 0xC3, 0xF8,
-    0x3F, 0xD3, 0xFC, 0x3F, 0xEB, 0xFC, 0x3E, 0xFF, 0xBC, 0x3D, 0xFF, 0xBC, 0x3D, 0xBE, 0xBC, 0x3D,
-    0x3D, 0xBC, 0x3E, 0x18, 0xFC, 0x00, 0x00, 0x0B, 0x80, 0x3D, 0xB8, 0x03, 0xDB, 0xC0, 0x3D, 0xBC,
-    0x03, 0xDB, 0xC0, 0x3D, 0xBE, 0xAB, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xC0, 0x7E, 0xFC, 0x07,
-    0xE0, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xC0, 0x3E, 0x7C, 0x03, 0xF3, 0xF5, 0xBE,
-    0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC3, 0xE0, 0x2F,
-    0x0F, 0x80, 0xBC, 0x3E, 0x02, 0xF0, 0xF8, 0x0B, 0xC3, 0xE0, 0x2F, 0x0F, 0x80, 0xBC, 0x3E, 0x02,
-    0xF0, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xBF, 0xC0, 0x0F, 0xFA, 0xF0,
-    0x0F, 0xD0, 0x38, 0x0F, 0xC0, 0x3C, 0x0F, 0xC0, 0x3C, 0x0F, 0xD0, 0x3C, 0x0F, 0xFE, 0xFC, 0x1F,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x2F, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0xE0, 0xFD, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x01, 0xBF, 0x80, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xE1, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0,
-    0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x1F, 0xEF, 0xEF, 0xC3, 0xD0, 0xF4, 0x3E, 0x3C,
-    0x0F, 0x42, 0xE3, 0xC0, 0xF4, 0x3E, 0x3F, 0x4F, 0x5B, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F,
-    0x00, 0xF8, 0x0F, 0x82, 0xF0, 0x07, 0xD7, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-    0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0xD0, 0x1F, 0xC3, 0xF0, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x00,
-    0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3D,
-    0x02, 0xE0, 0x3D, 0x02, 0xE0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x1A, 0xAA, 0xF8, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0xF4, 0x10, 0x10, 0xD0, 0xE3, 0x03, 0x8C, 0x0E, 0x34, 0xB8, 0xFF, 0xE0, 0xA6,
-    0x80, 0x0E, 0x00, 0x38, 0x3E, 0x0A, 0x0F, 0x8F, 0x87, 0xD3, 0xE3, 0xE1, 0xF4, 0xF8, 0xF8, 0x3D,
-    0x3E, 0x3E, 0x0F, 0x4F, 0x8F, 0x83, 0xD3, 0xE3, 0xE0, 0xF4, 0xB8, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0x8A, 0xAA, 0xAA, 0x90, 0x3E, 0x0A, 0x0F, 0x80, 0xF8, 0x7D, 0x3E, 0x03, 0xE1, 0xF4, 0xF8,
-    0x0F, 0x83, 0xD3, 0xE0, 0x3E, 0x0F, 0x4F, 0x80, 0xF8, 0x3D, 0x3E, 0x03, 0xE0, 0xF4, 0xB8, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAF, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x16, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00,
-    0x01, 0xE5, 0x00, 0x1F, 0xFD, 0x01, 0xD1, 0xE0, 0x1D, 0x0F, 0x01, 0xFF, 0xE0, 0x1F, 0xF8, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x03, 0xC7, 0x00, 0x00, 0xF1, 0xC0, 0x00, 0x3C, 0x70, 0x00, 0x0F, 0x1E,
-    0x50, 0x03, 0xC7, 0xFF, 0x00, 0xF1, 0xD2, 0xE0, 0x3D, 0x74, 0x38, 0x0F, 0x5F, 0xFE, 0x03, 0xD7,
-    0xFE, 0x00, 0xF4, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x7A, 0x41, 0xFF, 0xD7, 0x47, 0xDD,
-    0x0F, 0x7F, 0xF9, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFD, 0x06, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x1F,
-    0x03, 0xFF, 0xD0, 0x00, 0xF1, 0x40, 0xBC, 0xBF, 0xFC, 0x0B, 0xF8, 0x00, 0xE0, 0xBF, 0x43, 0x8B,
-    0xFF, 0x4E, 0x3C, 0x0F, 0x3E, 0xD0, 0x2C, 0xFF, 0x40, 0xB3, 0xEE, 0x03, 0xCE, 0x3F, 0xBF, 0x38,
-    0xFF, 0xF4, 0xD0, 0xBF, 0x40, 0x00, 0x15, 0x00, 0x7F, 0xF8, 0x0F, 0x03, 0x81, 0xE0, 0x3C, 0x1F,
-    0x03, 0xC0, 0xFF, 0xFC, 0x0B, 0xFF, 0xC1, 0xF4, 0xFC, 0x3F, 0x0B, 0xC3, 0xF0, 0xFD, 0xBF, 0x0F,
-    0xD0, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E,
-    0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x0F, 0x4F, 0x40, 0xF8,
-    0xF8, 0x1F, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x0F, 0xEF, 0x83, 0xE1, 0x7C, 0x3F, 0xFF, 0xE7, 0xEA, 0x54, 0x7D, 0x00, 0x03, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xE0, 0x2F, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF4,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xD1, 0xF4, 0x03, 0xE0,
-    0x1E, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x02, 0xF0, 0x1F, 0x80, 0xBC, 0x07, 0xF0, 0x3F, 0x81, 0xFC,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0x90, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00,
-    0x14, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x01, 0xFA, 0xF0, 0x3C, 0x07, 0x83, 0xD5, 0x40, 0x7F, 0xFC, 0x07, 0x80, 0x00, 0x3D, 0x06, 0x83,
-    0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xAB, 0x00, 0xF0,
-    0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xE0, 0xFE, 0xFE, 0x3F, 0xFF, 0xC1, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x7D, 0xBD, 0xBE, 0xA9, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C,
-    0x7D, 0x7D, 0x00, 0x00, 0x3C, 0x7C, 0x7D, 0x7D, 0xBD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xD0, 0x07, 0xD0,
-    0x00, 0xA0, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xB8, 0x02, 0xE0,
-    0x0B, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x3F, 0xC0, 0xFF, 0x07,
-    0xF4, 0x00, 0x00, 0x05, 0x64, 0x00, 0x2F, 0xFC, 0x00, 0x1C, 0x2C, 0x00, 0x1C, 0x2C, 0x00, 0x2C,
-    0x2F, 0xF0, 0x2C, 0x2D, 0xBC, 0x2C, 0x2C, 0x3C, 0x3C, 0x2E, 0xBC, 0xB8, 0x2F, 0xF0, 0x60, 0x00,
-    0x00, 0xE0, 0x10, 0x03, 0x80, 0xC0, 0x0E, 0x03, 0x00, 0x3D, 0x6E, 0x00, 0xFF, 0xFF, 0xE3, 0x80,
-    0xE7, 0xDE, 0x03, 0x47, 0x78, 0x0E, 0xBD, 0xE0, 0x3F, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x3F, 0xFF,
-    0xC0, 0x0F, 0xD1, 0xF4, 0x03, 0xE0, 0x1E, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x02, 0xF0, 0x1F, 0x80,
-    0xBC, 0x07, 0xF0, 0x3F, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x50, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xE0, 0x3C, 0xBC, 0x03, 0xDF, 0x00, 0x3F, 0xD0, 0x07, 0xF8,
-    0x00, 0x7F, 0x80, 0x0B, 0xFF, 0x00, 0xB9, 0xFD, 0x0F, 0x87, 0xF8, 0x07, 0xC0, 0x00, 0x0B, 0xD0,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3F, 0x0F, 0x02,
-    0xFC, 0x3C, 0x0F, 0xF0, 0xF0, 0xFF, 0xC3, 0xDB, 0xEF, 0x0F, 0x7E, 0x7C, 0x3F, 0xF1, 0xF0, 0xFF,
-    0x47, 0xC3, 0xFC, 0x1F, 0x4F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x01, 0x10, 0x40, 0x2F, 0xFF, 0x80,
-    0x7F, 0xFC, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B, 0xFF,
-    0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xFF,
-    0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xFF, 0xFE, 0xFF, 0xFE, 0x03, 0x80, 0x03, 0x80, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x03, 0xD0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x03, 0xF0, 0x3C, 0x03, 0xF0, 0x3D, 0x03,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xFE, 0x90,
-    0x03, 0xFF, 0xFC, 0x03, 0xF0, 0x3D, 0x03, 0xF0, 0x2E, 0x02, 0xFA, 0xBE, 0x02, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFC, 0x00, 0x6A, 0xA4, 0x0A, 0xAA, 0xAA, 0xA4, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x03, 0xF8, 0x1F, 0xF0, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xF7, 0xEB, 0xC0, 0x07, 0xD3, 0xE3, 0xE0, 0x0F, 0xC3, 0xE2,
-    0xF0, 0x0F, 0x83, 0xE1, 0xF4, 0x2F, 0x43, 0xE0, 0xFC, 0x2F, 0x47, 0xD0, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x07, 0xD3, 0xE0, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x0B,
-    0x7D, 0xE0, 0x0F, 0x3C, 0xF0, 0x1E, 0x3C, 0xB4, 0x3D, 0x3C, 0x7C, 0x07, 0xF4, 0x2F, 0x03, 0xFF,
-    0x87, 0xD2, 0xFB, 0xF5, 0xF4, 0xFC, 0x3F, 0xFC, 0x3F, 0x07, 0xFE, 0x06, 0xFF, 0xF9, 0x00, 0xBF,
-    0xFF, 0x00, 0xBF, 0xAF, 0xF0, 0x3F, 0x40, 0xFE, 0x1F, 0x80, 0x1F, 0xCB, 0xE0, 0x03, 0xF2, 0xF8,
-    0x00, 0xFC, 0xBF, 0x00, 0x7F, 0x1F, 0xE5, 0x7F, 0xC3, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xF4, 0x00, 0x6F, 0xE0, 0x00, 0x0B, 0xD1, 0xF0, 0x7F, 0xE7, 0xC2, 0xE7, 0xFF, 0x0F, 0x8B,
-    0xF0, 0x0B, 0xFF, 0x00, 0x7F, 0xFF, 0x03, 0xE0, 0x7E, 0x1F, 0x00, 0xF8, 0x7C, 0x03, 0xF0, 0xFD,
-    0x6F, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x0B,
-    0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x0B, 0xF0, 0x3F, 0x40,
-    0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x0B, 0xFB, 0xF4, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7D, 0x3C, 0x00, 0xF0, 0x2E,
-    0x01, 0xE0, 0x1F, 0x03, 0xD0, 0x0F, 0x47, 0xC0, 0x0B, 0xCF, 0x80, 0x03, 0xEF, 0x40, 0x03, 0xFF,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x28, 0x00, 0x3C, 0x2A, 0xFC, 0x3F, 0xFC, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x07, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0A, 0xA9, 0x1F, 0xFF, 0x1E, 0x00,
-    0xBF, 0xFD, 0x2F, 0x54, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xF0, 0xBE, 0x0B, 0xD2, 0xF0, 0x0F, 0x8B, 0xC0, 0x2E, 0x3F, 0x00, 0xF8,
-    0xFC, 0x3F, 0xD3, 0xF0, 0xFF, 0x05, 0x41, 0x40, 0xFF, 0x03, 0xD4, 0x0F, 0x00, 0x3C, 0x40, 0xFF,
-    0xD3, 0xC3, 0xCF, 0x07, 0x3C, 0x7C, 0xF2, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0xF0, 0xBF, 0x00,
-    0x07, 0xF0, 0xFF, 0xC3, 0xF4, 0x00, 0x0F, 0xE3, 0xFF, 0x2F, 0x80, 0x00, 0x0F, 0xCF, 0xFC, 0xFC,
-    0x00, 0x00, 0x2F, 0xBF, 0xEF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xE7, 0xF6, 0xFF, 0x40, 0x07,
-    0xFF, 0x1F, 0xD3, 0xFF, 0x40, 0xBF, 0xF0, 0x7F, 0x43, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x0F, 0x1F, 0xD3, 0xD0,
-    0x1F, 0x3F, 0x6E, 0x00, 0x3D, 0xFD, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFA, 0xF7, 0xF0, 0x3F, 0x8B, 0xCB, 0xF4, 0x00, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x2F, 0xF4, 0x1F, 0xFF, 0x41, 0x02, 0xF0, 0x00, 0x7C, 0x00,
-    0x2F, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0xBC, 0x00, 0x1F, 0x24, 0x0F, 0xCB, 0xFF, 0xF2, 0xFF,
-    0xF8, 0x6F, 0xF4, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x96, 0xC0, 0x03, 0x41,
-    0x6C, 0x0F, 0xF0, 0x02, 0xD1, 0x47, 0x8F, 0xFD, 0x3F, 0xD0, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x0F,
-    0xC0, 0x28, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0xBC, 0x3F, 0x40, 0x0F, 0xCB, 0xE0, 0x00, 0xFD, 0xFC,
-    0x00, 0x0F, 0xBF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F,
-    0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF6, 0xFF, 0x40, 0x3F, 0x4F, 0xFD,
-    0x03, 0xF4, 0x3F, 0xFE, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x50, 0x2C,
-    0x7C, 0x03, 0xCF, 0x40, 0x3E, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x7F, 0xE0,
-    0x0B, 0xAF, 0xC0, 0xB8, 0xBF, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0x80, 0x04, 0x00, 0x01, 0x40, 0x2F,
-    0x00, 0x0F, 0xD0, 0x2F, 0x00, 0x2F, 0xC0, 0x3E, 0x00, 0x7F, 0x00, 0x3E, 0x74, 0xFE, 0x00, 0x3E,
-    0x76, 0xFC, 0x00, 0x3E, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x7E,
-    0xBB, 0xFD, 0x00, 0x7E, 0xB4, 0xFF, 0x40, 0x7D, 0x00, 0x7F, 0xD0, 0xBD, 0x00, 0x1F, 0xF8, 0x69,
-    0x00, 0x0A, 0xA9, 0x08, 0x00, 0x00, 0x1D, 0x01, 0xF0, 0x2D, 0x43, 0xC0, 0x2D, 0xCF, 0x80, 0x2E,
-    0xEF, 0x00, 0x3F, 0xFD, 0x00, 0x3D, 0xFF, 0x40, 0x3D, 0xCB, 0xE0, 0x3C, 0x02, 0xFC, 0x0F, 0xC3,
-    0xF8, 0x0F, 0xFD, 0xFC, 0x01, 0xFD, 0xFD, 0x00, 0x3E, 0x7F, 0x00, 0x1F, 0xBF, 0x40, 0x07, 0xFF,
-    0x80, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF,
-    0xFC, 0x00, 0xFC, 0xFF, 0xC0, 0x3F, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF, 0xD0, 0x0B, 0xC0, 0x00, 0xFF,
-    0xFC, 0x00, 0xAF, 0xE8, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x4A, 0x40, 0x0F, 0x7F,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80,
-    0x1F, 0x6F, 0xE0, 0x1F, 0x4B, 0xFC, 0xFF, 0xFC, 0x2F, 0x83, 0xFF, 0xF1, 0xFC, 0x00, 0x0F, 0x8F,
-    0xD0, 0x00, 0x3E, 0x7F, 0x00, 0x01, 0xFB, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFC, 0xFF, 0xC0, 0x03, 0xF0, 0xFF, 0xC0, 0x1F, 0xC1, 0xFF, 0xD0, 0xFF, 0x8F, 0x81, 0x6E, 0x7C,
-    0x00, 0x7B, 0xD0, 0x02, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xDF,
-    0xD0, 0x0F, 0x1F, 0xD0, 0x7E, 0x00, 0x3F, 0x07, 0xE0, 0x03, 0xF0, 0x7E, 0x00, 0x3F, 0x07, 0xE0,
-    0x03, 0xF0, 0x7E, 0x00, 0x3F, 0x07, 0xF0, 0x03, 0xF0, 0x7F, 0x00, 0x3F, 0x0B, 0xFA, 0xAB, 0xF0,
-    0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x4B, 0xF0, 0x07, 0xF4, 0xBF, 0x00,
-    0x7F, 0x8B, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0xB4, 0x0F, 0x0B, 0x80,
-    0xF0, 0xB8, 0x0F, 0x4B, 0x80, 0xF4, 0xBD, 0x5F, 0x4B, 0xFF, 0xF4, 0xBF, 0xFF, 0x4B, 0xC0, 0xF8,
-    0xFC, 0x0F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x2F, 0xFF, 0xF4, 0xFC, 0x00, 0xBF,
-    0xFF, 0xD3, 0xF0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x0F, 0xEA, 0xAF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0xE0,
-    0x00, 0x7F, 0x40, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x03, 0xFF, 0xC3, 0xC0,
-    0x3D, 0x54, 0x3C, 0x07, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xC0, 0x03, 0xE5, 0xBC, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xEA, 0xBF, 0x40, 0x00, 0xFC, 0x03, 0xF8,
-    0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xD0, 0xFC,
-    0x03, 0xFF, 0xFF, 0x4F, 0xC0, 0x3F, 0xD0, 0xFC, 0xFC, 0x03, 0xF8, 0x07, 0xCF, 0xC0, 0x3F, 0x40,
-    0x3D, 0xFC, 0x07, 0xF4, 0x07, 0xCF, 0xC0, 0x7F, 0x87, 0xFC, 0xFC, 0x07, 0xF8, 0x7F, 0x46, 0x40,
-    0x29, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xAF, 0xE0, 0x00, 0x7C,
-    0x0B, 0xE0, 0x00, 0x7D, 0x0B, 0xE0, 0x00, 0x7D, 0x0B, 0xE0, 0x00, 0x7D, 0x0B, 0xF0, 0x00, 0x7D,
-    0x0B, 0xF0, 0x00, 0x7D, 0x0B, 0xFF, 0xE0, 0x7D, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xF4, 0xBD, 0x00,
-    0x0B, 0xC0, 0x3E, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0B, 0xC3, 0xFD, 0x00,
-    0x0B, 0xC3, 0xFC, 0x00, 0x05, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0xF1, 0xBE, 0x00, 0x2F, 0xFA, 0xFF, 0xF0, 0x1F, 0xC1, 0xF4, 0x7E, 0x0B, 0xC0, 0xF4, 0x0B,
-    0x83, 0xF0, 0x3C, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF0, 0x3E, 0x07, 0xD2, 0xF8, 0x0F, 0xC0, 0xFE,
-    0xFF, 0x82, 0xFD, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1B,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFF, 0x2F, 0x80, 0xF8, 0x7E, 0xF8,
-    0x7C, 0x3C, 0x0F, 0x2E, 0x0F, 0x03, 0xCB, 0x83, 0xC3, 0xD1, 0xF4, 0xFB, 0xFC, 0x3F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xE0, 0x05, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFD, 0x00, 0xAE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF,
-    0xE0, 0xFD, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x60, 0x1F, 0xFF, 0x06, 0xFF,
-    0x80, 0xFC, 0x00, 0x68, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x7F, 0xFF, 0xDF, 0xFF, 0xF0, 0x1E, 0x00,
-    0x07, 0x80, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x0B, 0x00,
-    0x01, 0x40, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0B, 0xE0,
-    0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x7D, 0x02, 0xF0, 0xFC, 0x0F, 0x82, 0xF0, 0x7D, 0x03, 0xD2, 0xF0, 0x0F, 0xCF,
-    0x80, 0x2F, 0xBC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC2, 0xF4, 0x02, 0xF8, 0x0F, 0xC0,
-    0x3F, 0x00, 0xBD, 0x0B, 0xE0, 0x07, 0xF0, 0xFC, 0x00, 0x3F, 0x6F, 0x80, 0x01, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x14, 0x00, 0x50, 0xF8, 0x0F, 0xC3, 0xF0, 0x3E,
-    0x07, 0xC1, 0xF0, 0x0F, 0x8F, 0xC0, 0x3F, 0x3D, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFD,
-    0x03, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xA0, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0xFC, 0x01, 0xF4, 0x0B, 0xE0, 0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x01, 0xFD, 0xF8,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
-    0xFF, 0x40, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0x0F, 0xF0, 0x1F, 0xE0, 0xBF, 0x83, 0xFC, 0x0B, 0xFD,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x10, 0x00, 0x2D, 0x03, 0xC0, 0xF0, 0xB4,
-    0x07, 0xDF, 0x00, 0x2F, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xFF, 0x00, 0xF8, 0xF8, 0x3F,
-    0x0F, 0xD0, 0x00, 0xE0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE3, 0xD0, 0x7F,
-    0xFF, 0xE3, 0xD0, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xD0, 0x00,
-    0xFC, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0xF8, 0xD1, 0xAF, 0x97, 0x40, 0x38, 0x1D, 0x00,
-    0xE0, 0x74, 0x03, 0x81, 0xD0, 0x0E, 0x07, 0x40, 0x3C, 0x1E, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x54, 0x01, 0x50, 0xBC, 0x03, 0xE0, 0xBC, 0x03,
-    0xE0, 0xBC, 0x03, 0xE0, 0x7C, 0x03, 0xE0, 0x7C, 0x03, 0xE0, 0x3D, 0x0B, 0xE0, 0x3F, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE4, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0xA0, 0x28, 0xF0, 0x3C, 0xB0,
-    0x3C, 0xB0, 0x3C, 0x74, 0x7C, 0x3F, 0xFC, 0x05, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x0F, 0x10, 0x01, 0x1E, 0x01, 0xE7, 0x40, 0xB9, 0xD0, 0x2E, 0xB3, 0x8B, 0xAC, 0xF3,
-    0xEB, 0xBE, 0xFD, 0xFF, 0xFF, 0x3F, 0xFB, 0xC1, 0xF1, 0xF0, 0x3C, 0x7C, 0x0A, 0x1F, 0x00, 0x07,
-    0xC0, 0x10, 0x10, 0xD0, 0xE3, 0x03, 0x8D, 0xCE, 0x3F, 0xB8, 0xFF, 0xE0, 0xF6, 0x81, 0xCA, 0x00,
-    0x3C, 0x2D, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xF4, 0x3F, 0x42, 0xF0, 0xF8, 0x07, 0xC3, 0xE0, 0x1F, 0x0F,
-    0x80, 0x7C, 0x3E, 0x01, 0xF0, 0xFC, 0x0B, 0xD1, 0x50, 0x15, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xD1,
-    0xF4, 0x3E, 0x01, 0xE0, 0xF8, 0x07, 0xC3, 0xE0, 0x2F, 0x1F, 0x80, 0xBC, 0x7F, 0x03, 0xF1, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x2F, 0x8F,
-    0xC0, 0x3F, 0x00, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0x5F, 0xFA,
-    0xA5, 0x50, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0xA0, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x7E, 0xF8, 0x3C, 0x0F, 0x03, 0xC3, 0xFF, 0xFF, 0xFD, 0x1B, 0xFF, 0xFF, 0x90, 0x02,
-    0xE0, 0x00, 0x00, 0x1F, 0xEA, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x06,
-    0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0xBD, 0x0F, 0xC0, 0x3F, 0x00, 0xBC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x15, 0x7F, 0xEA, 0x95, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xF0, 0x64, 0x1F, 0x47, 0x87,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xFE,
-    0xAC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x2F, 0xE0, 0xFD, 0x00, 0x3F, 0x8B, 0xF8, 0xBF, 0x00, 0x03, 0xF1, 0xFD, 0x3F, 0x40,
-    0x00, 0xBF, 0x7F, 0x6F, 0x80, 0x00, 0x0F, 0xEF, 0xEF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xBF, 0xBF, 0xE0, 0x03,
-    0xFF, 0x5F, 0xD7, 0xFF, 0x03, 0xFF, 0x87, 0xF8, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x82, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0xFF, 0x0F, 0xD0, 0x02, 0xF8, 0xFE, 0x2F, 0x80, 0x00, 0xFC, 0xBE, 0x7F,
-    0x00, 0x00, 0x7F, 0xBD, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0xFF, 0x7F, 0xD0, 0x2F, 0xF4, 0xFF, 0x2F, 0xF8, 0x2D, 0x0F,
-    0x80, 0xF8, 0xBD, 0x03, 0xD3, 0xF0, 0x0F, 0x7F, 0x40, 0x3E, 0xF8, 0x01, 0xFF, 0xC0, 0x07, 0xFD,
-    0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFF, 0x82, 0xF4, 0x3F, 0x4B, 0xC0, 0x3F, 0x3F, 0x00, 0xFC, 0xFC,
-    0x03, 0xF1, 0x50, 0x1F, 0xC0, 0x07, 0xFD, 0x00, 0x2F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x78, 0x2C, 0xF0, 0x2E, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xF4, 0x3C, 0x7C, 0x3C, 0x1D,
-    0x7C, 0x2D, 0x00, 0x3D, 0x01, 0xFC, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3E, 0x0F,
-    0xC0, 0x0F, 0x83, 0xF0, 0x03, 0xE0, 0xFC, 0x01, 0xF4, 0x3F, 0x00, 0x7D, 0x0F, 0xC0, 0x2F, 0x43,
-    0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x06, 0xAA, 0x02, 0xFF, 0xC0, 0xB4, 0xF0, 0x2D, 0x3C, 0x0B, 0x0F, 0x03, 0xC3, 0xC0,
-    0xF0, 0xF0, 0x3C, 0x3C, 0x3F, 0x0F, 0x8A, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0xBC, 0x3F, 0x00, 0x2F,
-    0x03, 0xF0, 0x02, 0xF4, 0x3F, 0x00, 0x2F, 0x43, 0xF0, 0x02, 0xF4, 0x3F, 0x00, 0x3F, 0x43, 0xF0,
-    0x03, 0xF4, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xAB, 0xF8, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0x83, 0xF4, 0x03, 0xFC, 0x7F, 0x40, 0x3F, 0xD7, 0xF4, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x3C, 0x07, 0xC3, 0xC0, 0x7C, 0x3D, 0x07, 0xC3, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC3, 0xE5, 0xBC, 0x3D, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x03, 0xF0, 0x02, 0xF4, 0x3F, 0x00, 0x2F, 0x43, 0xF0, 0x02, 0xF4, 0x3F,
-    0x00, 0x3F, 0x43, 0xF0, 0x03, 0xF4, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xAB, 0xF8, 0x3F, 0xFF, 0xFF,
-    0x83, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x83, 0xF4, 0x03, 0xF8, 0x7F, 0x40, 0x3F, 0xC7, 0xF4,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x3C, 0x0F,
-    0x01, 0xF0, 0x3E, 0x5B, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F, 0x41, 0xF0, 0x3D, 0x07, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x06, 0x80, 0x15, 0x01, 0x50, 0xFC, 0x0B,
-    0xD3, 0xE0, 0x1F, 0x4F, 0x80, 0x7D, 0x3E, 0x01, 0xF4, 0xB8, 0x07, 0xD2, 0xF0, 0x3F, 0x43, 0xFF,
-    0xFD, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x40, 0x10, 0x11, 0xC1, 0xCA, 0x0B, 0x28,
-    0x2C, 0xA0, 0xF1, 0xFF, 0xC1, 0xA7, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0x10, 0x3F,
-    0xC0, 0x07, 0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x3F, 0xF8, 0x3F, 0xF4, 0x0F, 0xFF, 0x1F, 0xFD, 0x03, 0xFF, 0xDF, 0xFF, 0x40, 0xFE, 0xFF, 0xFB,
-    0xD0, 0x3F, 0x3F, 0xFA, 0xF4, 0x0F, 0xCF, 0xFD, 0xFE, 0x03, 0xF1, 0xFF, 0x3F, 0x80, 0xFC, 0x3F,
-    0x8F, 0xE0, 0x7F, 0x0F, 0xD3, 0xF8, 0x1F, 0xD0, 0x50, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0A, 0x90, 0x3F, 0x01, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x87, 0xF0, 0x3F, 0xCB, 0xF0,
-    0x3F, 0xEF, 0xF0, 0x3D, 0xFE, 0xF0, 0x3C, 0xFD, 0xF4, 0x3C, 0xBC, 0xF4, 0x3D, 0x25, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D,
-    0x7D, 0x7D, 0x7D, 0x7D, 0x3D, 0x3D, 0x3D, 0x29, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAB, 0xC0, 0x01,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x1F,
-    0x4F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x07, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xD7, 0xF0, 0x00, 0xFE, 0x10, 0x05,
-    0x03, 0xEA, 0xF0, 0x3F, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81,
-    0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C, 0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF,
-    0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0xF4, 0xF4, 0x00, 0x0F, 0x4F, 0x40, 0x01, 0xF9, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xAF, 0x00, 0x01, 0xF4, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x03, 0xF0,
-    0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xC3,
-    0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xE0, 0x3E, 0x2F, 0x03, 0xE2, 0xF4, 0x7F, 0x3F, 0x46, 0xA2,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x81, 0xFF, 0xFC, 0x3D, 0x0F, 0xC3, 0x80, 0x7C,
-    0x74, 0x03, 0xC7, 0x40, 0x7D, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x0B, 0xF7, 0xE0, 0x00, 0x00, 0xA6,
-    0xBF, 0xFF, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xA5, 0x40, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0x8F, 0xFD, 0x68, 0x00, 0x07, 0xD3, 0xFF,
-    0xFF, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0xC0, 0x02, 0xF4, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xAA, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x0F, 0xFF,
-    0xFF, 0x1F, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0xE6, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xF4, 0x3F, 0xD1, 0xB8, 0x38, 0x07, 0xFF,
-    0xFF, 0x1D, 0x00, 0xFE, 0x95, 0x47, 0x40, 0x7F, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFD, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x01, 0xFF, 0xF4, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xE0,
-    0xFD, 0x50, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x56, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xF0,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xFE, 0xAA, 0x47, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xF0, 0x04, 0x01, 0x41, 0xF9, 0xBC, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0xF8, 0x3E, 0x17, 0xC3, 0xFF, 0xFE, 0x7E,
-    0xA5, 0x47, 0xD0, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFE, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x90, 0x03, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x7A, 0xAF, 0xFD, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF1, 0xAA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x43, 0xE0, 0x0F, 0xC0,
-    0x7E, 0x0B, 0xE0, 0x0B, 0xFF, 0xE0, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0B,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xC4, 0x00, 0xBC, 0x00, 0x07, 0xDB, 0xFF, 0xFD, 0x7F, 0xFF, 0xC3, 0xC0,
-    0xB8, 0x1F, 0xBF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xF4, 0x00,
-    0x7D, 0x7D, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x1E, 0xAB, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC,
-    0x6A, 0xBF, 0xFF, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xD0, 0xF8, 0x03, 0xF0, 0x1F, 0x82, 0xF8,
-    0x02, 0xFF, 0xF8, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0B, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xC4, 0x00, 0xBC, 0x00, 0x07, 0xDB, 0xFF, 0xFD, 0x7F, 0xFF, 0xC3, 0xC0, 0xB8, 0x2F, 0xBF,
-    0x00, 0x7F, 0x80, 0x1F, 0x1F, 0x02, 0xF2, 0xF0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xCF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0xC3, 0xF8, 0x00, 0xBF, 0x1F, 0xF1,
-    0xFC, 0x00, 0x0F, 0xD3, 0xF8, 0xFD, 0x00, 0x01, 0xFC, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xBF, 0xBF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFE, 0xFE, 0xFF, 0xC0, 0x0B, 0xFE, 0x3F, 0x8F, 0xFC, 0x0B, 0xFF, 0x1F, 0xE1, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00, 0x07, 0xD7, 0xD0, 0x00,
-    0x00, 0x07, 0xE7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0xAA, 0x0A, 0x80, 0x03, 0xF4, 0xFF, 0x1F, 0xC0, 0x01, 0xFC,
-    0xFE, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0xBD, 0x00, 0x00, 0x3F, 0xBE, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0xFF, 0xBF, 0xD0, 0x2F, 0xF4, 0xFF, 0x2F, 0xF8,
-    0x00, 0x00, 0x1F, 0x1F, 0x0B, 0xCB, 0xC2, 0xF6, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x1F, 0xFF, 0x41, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x03, 0xFF, 0x00,
-    0xFF, 0x80, 0x00, 0xBC, 0x00, 0x1F, 0x24, 0x0B, 0xCB, 0xFF, 0xF2, 0xFF, 0xF8, 0x6F, 0xF4, 0x00,
-    0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x00, 0x00, 0x07, 0xF4, 0x09, 0x6C, 0x00, 0x0D, 0x01, 0x6C,
-    0x03, 0xFC, 0x00, 0x2D, 0x05, 0x5E, 0x0F, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC3, 0xFF,
-    0xF0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0x40, 0x03,
-    0xE0, 0xA1, 0xF8, 0xFF, 0xFD, 0x2F, 0xFF, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC3, 0xFF,
-    0xF0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0x40, 0x03,
-    0xE0, 0xE1, 0xF8, 0xFF, 0xFD, 0x2F, 0xFF, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xF0,
-    0x02, 0xFF, 0xFD, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x14, 0x0F, 0x40, 0x3F, 0x83, 0xE0, 0x1F, 0xE0, 0xF8, 0x0F,
-    0xF8, 0x3E, 0x07, 0xFF, 0x0F, 0x83, 0xFF, 0xC3, 0xF1, 0xFB, 0xF0, 0xFC, 0xFD, 0xFC, 0x3F, 0x7E,
-    0x7F, 0x0F, 0xFF, 0x1F, 0xC3, 0xFF, 0x87, 0xF4, 0xBF, 0xD1, 0xFD, 0x2F, 0xF0, 0xBF, 0x4B, 0xF4,
-    0x2F, 0xE0, 0x00, 0x00, 0x40, 0x7F, 0xFF, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x3F, 0x0F, 0x02, 0xFC, 0x3C, 0x0F, 0xF0, 0xF0, 0xFF, 0xC3, 0xDB, 0xEF,
-    0x0F, 0x7E, 0x7C, 0x3F, 0xF1, 0xF0, 0xFF, 0x47, 0xC3, 0xFC, 0x1F, 0x4F, 0xC0, 0x7D, 0x00, 0x00,
-    0x00, 0x0B, 0xCB, 0xC0, 0x02, 0xF2, 0xF0, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x50, 0x3D, 0x00, 0xFE, 0x0F, 0x80,
-    0x7F, 0x83, 0xE0, 0x3F, 0xE0, 0xF8, 0x1F, 0xFC, 0x3E, 0x0F, 0xFF, 0x0F, 0xC7, 0xEF, 0xC3, 0xF3,
-    0xF7, 0xF0, 0xFD, 0xF9, 0xFC, 0x3F, 0xFC, 0x7F, 0x0F, 0xFE, 0x1F, 0xD2, 0xFF, 0x47, 0xF4, 0xBF,
-    0xC2, 0xFD, 0x2F, 0xD0, 0xBF, 0x80, 0x0B, 0xCB, 0xC0, 0x3F, 0x3F, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xC3, 0xC0, 0xBF, 0x0F, 0x03, 0xFC, 0x3C, 0x3F, 0xF0, 0xF6,
-    0xFB, 0xC3, 0xDF, 0x9F, 0x0F, 0xFC, 0x7C, 0x3F, 0xD1, 0xF0, 0xFF, 0x07, 0xD3, 0xF0, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0x6F, 0xE0,
-    0x1F, 0xC0, 0x0F, 0xD0, 0xFC, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC, 0x7E,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2E, 0x00,
-    0xFC, 0xFC, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x07, 0xFF, 0xE0, 0x3E, 0x07, 0xD1, 0xF0, 0x0F, 0x87, 0xC0, 0x3F, 0x0F, 0xD6,
-    0xF8, 0x3F, 0xFF, 0xD0, 0x7F, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x19, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xC0, 0xFF, 0x07, 0xF4, 0x7F, 0x00, 0x7F, 0x1F, 0x80, 0x0F, 0xCB, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFC, 0xBF, 0x00, 0x3F, 0x1F, 0xE5, 0xBF, 0xC3, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xF4, 0x00, 0x6F, 0xE0, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xF8, 0x3E, 0x07, 0xD7, 0xE6,
-    0xBE, 0x7F, 0xFF, 0xF7, 0xE5, 0xBE, 0x3F, 0xFF, 0xD1, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0xF8, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xC1, 0xFD, 0x1F, 0xC0, 0x1F, 0xC7, 0xE0,
-    0x03, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x2F, 0xC0, 0x0F, 0xC7, 0xF9, 0x6F, 0xF0, 0xFF,
-    0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x02, 0xFF, 0xFD, 0x00, 0x1B, 0xF8, 0x00, 0x0F, 0x4F, 0x40, 0xF8,
-    0xF8, 0x1F, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xFF, 0x83, 0xE0, 0x7D,
-    0x7E, 0x6B, 0xE7, 0xFF, 0xFF, 0x7E, 0x5B, 0xE3, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x2F, 0xD0, 0x00,
-    0xF4, 0xF4, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x03, 0xFF, 0xF8, 0x03, 0xF4, 0x2F, 0x82,
-    0xF0, 0x01, 0xF4, 0x54, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x3F, 0x80, 0x7F, 0x8F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF4,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x0B, 0xCB, 0xC3, 0xF3, 0xF0,
-    0x00, 0x00, 0x1F, 0xFD, 0x06, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x03, 0xFF, 0xD0, 0x00, 0xF1,
-    0x40, 0xBC, 0xBF, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x41, 0xFF, 0xFF, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xF4,
-    0xFC, 0x0B, 0xC1, 0xF4, 0x3E, 0x03, 0xF0, 0xF4, 0x07, 0xE7, 0xC0, 0x0F, 0xFE, 0x00, 0x1F, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xF0,
-    0x00, 0xFE, 0x00, 0x00, 0x05, 0x6A, 0x90, 0x3F, 0xFF, 0xC1, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0,
-    0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00,
-    0x00, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x05, 0x1F, 0x40, 0x7D, 0x3F, 0x02, 0xF0, 0x7E, 0x0F, 0x80, 0xFC, 0x3D, 0x01,
-    0xF9, 0xF0, 0x03, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7D, 0x00,
-    0x03, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F,
-    0x40, 0x7D, 0x7D, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0xF8, 0xBC, 0x03, 0xD0, 0xF8, 0x1F, 0x02, 0xF4, 0xF8, 0x03, 0xF3, 0xD0, 0x0B,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x0B,
-    0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x0F, 0xC0, 0x2F, 0x41,
-    0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x01, 0x40, 0x07, 0xD0, 0x1F, 0x40, 0x0F, 0xC0, 0xBC, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x3F, 0x0F,
-    0x40, 0x00, 0x7E, 0x7C, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xE0, 0x3F, 0x00, 0x7E, 0x07, 0xF0,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x3E, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0xBD, 0x3E, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC3, 0xF3, 0xF0, 0xFC, 0xFC, 0x00,
-    0x00, 0x1E, 0x01, 0xE7, 0x40, 0xB9, 0xD0, 0x2E, 0xB0, 0x0B, 0xAC, 0x03, 0xEB, 0x81, 0xF9, 0xFF,
-    0xFF, 0x3F, 0xFB, 0xC1, 0x91, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
-    0x7C, 0xBC, 0xBC, 0xFD, 0xFD, 0x00, 0x00, 0x34, 0x38, 0x34, 0x38, 0x30, 0x38, 0x34, 0xB8, 0x3F,
-    0xF8, 0x0A, 0x68, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xAF, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xB0, 0x00, 0x3F, 0xFC, 0x7E, 0xA8, 0x78, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x0E, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0x80, 0x00, 0x02, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x2F,
-    0x0F, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x02, 0xF0, 0xFF, 0xF4, 0x00, 0xBC, 0x3F, 0xFF, 0x40,
-    0x2F, 0x4F, 0x03, 0xF0, 0x0B, 0xD3, 0xC0, 0xBC, 0x02, 0xF4, 0xF5, 0xBF, 0x00, 0xBE, 0x3F, 0xFF,
-    0x40, 0x3F, 0x8F, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x7D, 0x7D,
-    0x00, 0x2F, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x03, 0xC7, 0x00, 0x00, 0xF1, 0xC0, 0x00, 0x3C, 0x79, 0x40,
-    0x0F, 0x1F, 0xFC, 0x03, 0xC7, 0x4B, 0x80, 0xF5, 0xD0, 0xE0, 0x3D, 0x7F, 0xF8, 0x0F, 0x5F, 0xF8,
-    0x03, 0xD0, 0x1F, 0x80, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xF4,
-    0xBD, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x07, 0xF4,
-    0xFF, 0x60, 0x0F, 0xF0, 0x3F, 0xFC, 0x3F, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x02, 0xD0, 0x0F, 0x47, 0x80, 0x03, 0xDF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0x8F, 0xD0, 0x2F, 0x07, 0xFC, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0x55,
-    0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF1, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0xB8, 0x2D, 0xB4, 0x3D, 0xB4, 0x3D, 0xB4, 0x3C, 0xB4,
-    0x3C, 0xB4, 0x3C, 0xB4, 0x3C, 0xF4, 0x3C, 0xF4, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0,
-    0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xD0, 0xAA, 0x0B, 0xF0, 0x7F,
-    0x03, 0xF4, 0x3F, 0x82, 0xFC, 0x2A, 0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0x2A, 0x83,
-    0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0xAA, 0x0B, 0xF0, 0x7F, 0x03, 0xF4, 0x3F, 0x82, 0xFC,
-    0xAA, 0x1A, 0x92, 0xFC, 0x3F, 0x87, 0xF0, 0xFD, 0x0F, 0xD2, 0xF8, 0x3F, 0x87, 0xF0, 0xBF, 0x0F,
-    0xD0, 0x2A, 0x86, 0xA4, 0xFF, 0x1F, 0xD3, 0xF8, 0x7F, 0x0F, 0xD2, 0xF8, 0x7F, 0x0F, 0xD3, 0xF8,
-    0x7F, 0x00, 0x2A, 0x83, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0F, 0xE0, 0xAA, 0x1A, 0x92, 0xFC, 0x3F,
-    0x87, 0xF0, 0xFD, 0x0F, 0xD2, 0xF8, 0x3F, 0x87, 0xF0, 0xBF, 0x0F, 0xD0, 0x00, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xC5, 0x2F, 0x54, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0xE0,
-    0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xF5, 0x47, 0xFF, 0xFC, 0xBF, 0xFF, 0xD0, 0x1F,
-    0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xC0, 0x2F, 0x40,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0x90,
-    0x00, 0x03, 0x80, 0x7F, 0x87, 0xFD, 0x7F, 0x43, 0x40, 0x00, 0x00, 0x28, 0x7D, 0xBE, 0xBF, 0x28,
-    0x7D, 0xBE, 0xBF, 0x29, 0x02, 0x90, 0x68, 0x3E, 0x07, 0xE0, 0xFC, 0x7F, 0x0B, 0xE0, 0xFC, 0xBF,
-    0x0B, 0xF0, 0xFD, 0x79, 0xE0, 0x05, 0x00, 0x2C, 0x06, 0x50, 0x1E, 0x02, 0xA8, 0x0F, 0x00, 0xA6,
-    0x0B, 0x80, 0x1E, 0x87, 0xC0, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x28, 0xA0, 0x1F, 0x1E, 0x39, 0x0F, 0x85, 0xCA, 0x4B,
-    0xC0, 0xE2, 0xC2, 0x90, 0x00, 0x00, 0x0A, 0xA0, 0x3F, 0xC0, 0xFE, 0x03, 0xF0, 0x1F, 0xC0, 0xFE,
-    0x00, 0x0A, 0xA1, 0xA9, 0x0F, 0xF1, 0xFD, 0x0F, 0xE1, 0xFC, 0x0F, 0xC2, 0xF8, 0x1F, 0xC3, 0xF4,
-    0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xD1, 0xD2, 0xF0, 0xF4, 0xF8, 0xF4, 0xB8, 0xBC,
-    0x74, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x7C, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0xF0, 0x7C, 0xF8, 0x2E, 0x3C, 0x0F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E,
-    0x0F, 0x07, 0xC7, 0xD3, 0xE0, 0xB8, 0xBC, 0x3C, 0x0F, 0x0B, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x1F, 0xD0, 0x0B, 0xEF, 0x42, 0xA4, 0xA9, 0x00, 0x00, 0x20, 0x3C, 0x3E, 0x7D, 0x3F,
-    0x07, 0xE0, 0x7E, 0x07, 0x80, 0x50, 0x00, 0x02, 0x00, 0x38, 0x02, 0xF0, 0x0B, 0xD0, 0x3F, 0x0F,
-    0xD2, 0xF4, 0x2D, 0x01, 0x40, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x01, 0xFD, 0x2F, 0xC3, 0xF4, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x3E, 0x2F, 0xFF, 0x87, 0xD7, 0xE0, 0xFF,
-    0xF0, 0xBD, 0x7F, 0x0B, 0xFD, 0x0B, 0xE6, 0xA1, 0xFF, 0xF0, 0xA9, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFB, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0xF0, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0F, 0x00, 0xF4, 0x0F, 0x40,
-    0xF4, 0x0F, 0x40, 0xF4, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x3F, 0x83, 0xF8, 0x7F, 0xC6, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFD, 0x02, 0xFF, 0xFD, 0x0B, 0x6F, 0xFC, 0x00,
-    0xBD, 0xF4, 0x02, 0xF3, 0xD0, 0x0B, 0xCF, 0x40, 0x3F, 0x7C, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF4,
-    0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x43, 0xC3, 0xFF, 0xF0,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x4D, 0x50, 0x00, 0x3F, 0xF4, 0x00, 0x03,
-    0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x9E, 0x90, 0x00, 0x32, 0x8E, 0x10, 0xEE, 0xFF, 0xF4, 0x2F,
-    0xD3, 0xF8, 0x0B, 0xFF, 0xFF, 0x83, 0x76, 0x5A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00,
-    0x3E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x0B, 0xF8,
-    0x02, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xF9, 0x1F, 0x8F, 0xD1, 0xFC, 0x14, 0x02, 0xF0, 0x80, 0x1F,
-    0x00, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3D,
-    0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x1B, 0xF0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0xBF, 0x40,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x19, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x02, 0x90, 0x00, 0x1F, 0x40, 0x00, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x03,
-    0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x20, 0x1F, 0xFF,
-    0xC0, 0x03, 0x83, 0xF4, 0x7E, 0x00, 0x3C, 0x14, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x7C,
-    0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xFD,
-    0x00, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x02, 0xFD, 0x02,
-    0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x7F, 0x80, 0x07,
-    0xBF, 0xFF, 0x40, 0xBF, 0xD1, 0xFC, 0x0B, 0xA0, 0x03, 0xD0, 0xB8, 0x00, 0x3E, 0x0F, 0x80, 0x03,
-    0xE0, 0xF8, 0x00, 0x3D, 0x0F, 0x80, 0x0B, 0xC0, 0xF4, 0x07, 0xF8, 0x0F, 0x42, 0xFE, 0x00, 0xF4,
-    0x2F, 0x80, 0x03, 0x42, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x2A, 0x00, 0x2F, 0xC3, 0xF0, 0x03, 0xFC, 0x3F, 0x00, 0x3F, 0xC7,
-    0xF0, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0xBC, 0x0F, 0x40, 0x2F,
-    0x43, 0xC0, 0x0F, 0xD2, 0xF0, 0x02, 0xA4, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x07, 0xC0,
-    0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0xFD, 0x03, 0xF0, 0x2A, 0x40, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x0A, 0x0C, 0xA3, 0x9D, 0xEB, 0x72, 0xCF, 0xE1, 0xA0, 0x01, 0x00, 0x74,
-    0x0F, 0x43, 0x78, 0x7F, 0xC0, 0x38, 0x00, 0x03, 0xF8, 0x30, 0x03, 0xF4, 0x02, 0xC2, 0x2C, 0x3F,
-    0x81, 0x90, 0x0F, 0xC3, 0x40, 0x3F, 0x47, 0x5C, 0x34, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x01, 0xC0, 0x2C, 0x03, 0xC0, 0x38, 0x07, 0x40, 0x50, 0x0A, 0x43, 0x5C, 0x35, 0xC1, 0xF8, 0x35,
-    0xC3, 0xFC, 0x00, 0x00, 0x1F, 0x43, 0x1C, 0x60, 0xC3, 0x5D, 0x1F, 0xC1, 0x5C, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xEF, 0xE0, 0x3F, 0xFF, 0xC3, 0xF4, 0x7D, 0x3D, 0x03, 0xD3, 0xD0, 0x3E, 0x3D,
-    0x03, 0xE7, 0xE0, 0x3F, 0x7E, 0x03, 0xF7, 0xF0, 0x3F, 0x0A, 0x03, 0x5C, 0x39, 0xC7, 0xAC, 0x35,
-    0xC3, 0xFC, 0x1F, 0x00, 0x08, 0x0F, 0x40, 0xD0, 0x34, 0x0D, 0x07, 0x97, 0xFC, 0x2F, 0x42, 0x6C,
-    0x00, 0xC0, 0x3C, 0x0F, 0x43, 0xF4, 0x3F, 0xD0, 0x2F, 0x40, 0x0C, 0x01, 0xC0, 0xF8, 0x01, 0xC3,
-    0xFC, 0x2A, 0x40, 0x01, 0x40, 0x38, 0x0E, 0x82, 0x68, 0x7F, 0xD0, 0x3C, 0x03, 0xC0, 0x00, 0x0F,
-    0xE3, 0x00, 0xC0, 0x3F, 0x40, 0xB3, 0xF8, 0x64, 0x0B, 0xC3, 0x40, 0x3F, 0x47, 0x9C, 0x30, 0xD3,
-    0x9C, 0x1F, 0x80, 0x00, 0x07, 0xFC, 0x01, 0xC0, 0x2C, 0x03, 0xC0, 0x38, 0x07, 0x40, 0x60, 0x0B,
-    0x43, 0x4C, 0x39, 0xC1, 0xF8, 0x34, 0xD3, 0xAD, 0x2F, 0x80, 0x1F, 0x43, 0x1C, 0x60, 0xC3, 0x5D,
-    0x1F, 0xD1, 0x5C, 0x3F, 0x40, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xFC,
-    0x03, 0xD0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC0,
-    0x1F, 0x40, 0x3E, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x0F, 0xC0, 0x1A, 0x40, 0x3D,
-    0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xF8, 0x01,
-    0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x6A, 0x00, 0x00, 0x03, 0x8E,
-    0x00, 0x03, 0x8E, 0x00, 0x07, 0x5D, 0x00, 0x0B, 0x2C, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFD, 0x0F, 0xFE, 0x78, 0x2F, 0xEC, 0xB0, 0x3F, 0xBC, 0xF0, 0x3F, 0x7C, 0xF0, 0x3F, 0x78,
-    0xE0, 0x3F, 0xF5, 0xD0, 0x3F, 0xF6, 0xD4, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD,
-    0x02, 0xFF, 0xFD, 0x02, 0xCB, 0x00, 0x03, 0xCF, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0F, 0xF4, 0x04, 0x1F, 0xC0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x42, 0xA8, 0x7F, 0x43, 0xFD, 0x7F, 0x43, 0xC0, 0x3F, 0xD3, 0xC4,
-    0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xBE, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0x01, 0x90, 0xBF, 0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x07, 0x80,
-    0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x02, 0xE0, 0x00, 0x1B, 0xE0, 0x00, 0x3F, 0xFF, 0x90,
-    0x3F, 0xFF, 0xF4, 0x2A, 0xAA, 0xA4, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0xF4, 0x00,
-    0x07, 0xFC, 0x07, 0xD0, 0x00, 0x1F, 0xF4, 0x1F, 0x40, 0x00, 0xBF, 0xF0, 0x7D, 0x00, 0x02, 0xFF,
-    0xD2, 0xF4, 0x02, 0xAF, 0xFF, 0xEF, 0xEA, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFE, 0x3E, 0xFC,
-    0x00, 0x03, 0xF8, 0xFF, 0xF0, 0x00, 0x0F, 0xE1, 0xFF, 0xC0, 0x00, 0x3F, 0x83, 0xFF, 0x00, 0x00,
-    0xFF, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x2F, 0xFF, 0xD0, 0x05, 0xBD, 0x5F, 0xD4, 0x7F, 0xFF, 0xFF, 0xF8, 0x0F, 0xC0, 0x7D, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x78, 0x2C, 0x00, 0x00, 0x07,
-    0x81, 0xD0, 0x00, 0x00, 0x78, 0x1D, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x0B, 0xF0, 0xBE, 0xFC, 0x01,
-    0xEB, 0x0B, 0xFF, 0x80, 0x2C, 0x00, 0xBF, 0xFC, 0x00, 0xF9, 0x0B, 0xC3, 0xD0, 0x02, 0xF8, 0xBC,
-    0x3F, 0x00, 0x03, 0xDF, 0xC3, 0xF0, 0x2F, 0xBD, 0xFC, 0x3F, 0x47, 0xFF, 0xCA, 0x82, 0xA4, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x40, 0xF0, 0x00, 0x78, 0x0F, 0x00, 0x0B,
-    0x40, 0xF0, 0x00, 0xB0, 0x0F, 0x07, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x79,
-    0xFD, 0xE0, 0x07, 0xFF, 0xEE, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFD, 0xFC, 0x00, 0x3F, 0x8F, 0xC0,
-    0x03, 0xF4, 0xFC, 0x00, 0x2F, 0x0B, 0x80, 0x15, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x14, 0x7F, 0xFF,
-    0x43, 0xC7, 0xD0, 0x7C, 0x3C, 0x78, 0x02, 0xC3, 0xC7, 0x4A, 0x2D, 0x3C, 0x75, 0xF2, 0xD3, 0xC7,
-    0x4F, 0x2D, 0x3C, 0x74, 0xF0, 0x03, 0xC7, 0x4F, 0x80, 0x3C, 0x74, 0xBF, 0x9F, 0xC7, 0x42, 0xFF,
-    0xFC, 0x00, 0x01, 0xAF, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x1A, 0xFA, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xE0, 0x00, 0xBE, 0xE0, 0x03, 0xFF, 0xE0, 0x0B, 0x47, 0xE0, 0x0B, 0x03, 0xD0, 0x0B, 0x47, 0xD0,
-    0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x54, 0x40, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xAD, 0x00, 0xFC, 0x00, 0x2F, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xC0, 0x01, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0xFE, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0xBD, 0x50, 0x00,
-    0x2F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x10, 0x00, 0x3F, 0xF8, 0x00,
-    0x1F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xC7, 0xF8, 0x01, 0xAB, 0xFA, 0xFF,
-    0xE9, 0x00, 0xFC, 0x03, 0xE0, 0x05, 0x7F, 0x5B, 0xF9, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xA4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xF5, 0xF0, 0x00, 0x3F, 0x87,
-    0x80, 0x00, 0xFC, 0x1E, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x1F, 0xC1, 0xFF, 0xFC, 0x3F, 0x07, 0xFF,
-    0xF4, 0xFE, 0x1E, 0x1F, 0x92, 0xFF, 0xB9, 0xBD, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xE8, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x41, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x90, 0x00, 0x3F, 0xEB,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x3C, 0x00, 0x7F, 0xD0, 0x7F, 0xF8, 0x3E, 0xF0, 0x1F, 0x3C, 0x07, 0xCF, 0x01, 0xF7,
-    0xC0, 0x3F, 0xF8, 0x0B, 0xFF, 0x80, 0x7F, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFC, 0x15, 0x7F, 0x95, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xFF, 0xDF, 0xFF, 0xF0, 0x0F, 0x01, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xDF, 0xFC, 0x07, 0xFD, 0x01, 0xFF, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF4,
-    0x00, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x04, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0xC0, 0x3F, 0xF5,
-    0x00, 0xFF, 0xBD, 0x01, 0xBF, 0xF4, 0x0F, 0xFE, 0x2E, 0x3F, 0xC1, 0xF4, 0x4F, 0xBF, 0x80, 0x3F,
-    0xF4, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x0F, 0xFF, 0xE0, 0x1F, 0xBA, 0xF0, 0x2F, 0x79, 0xF0, 0x2E,
-    0x78, 0xF0, 0x1E, 0x78, 0xF0, 0x1E, 0x7C, 0xF0, 0x1F, 0x3D, 0xF0, 0x1F, 0x3D, 0xF0, 0x1F, 0x7D,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xC0, 0xBC,
-    0x00, 0x2F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xD0, 0x17, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x90, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0x1F, 0x80, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x2F, 0xAE, 0xBE, 0x0F, 0x4B, 0x8B, 0x40, 0x42,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x0F, 0x4B, 0x87, 0x42, 0xFA, 0xEB, 0xE0, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xD0,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x50, 0x00, 0x3C, 0x0F,
-    0x00, 0x0F, 0x40, 0x7C, 0x02, 0xE0, 0x01, 0xF0, 0xBF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x1E,
-    0x00, 0x2E, 0x00, 0x78, 0x0B, 0x80, 0x01, 0x80, 0x60, 0x00, 0x00, 0x90, 0x00, 0x3F, 0x40, 0x0F,
-    0xFE, 0x07, 0xEE, 0xF8, 0xB4, 0xE2, 0xC0, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x70, 0xE2,
-    0x87, 0xDE, 0xBC, 0x1F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAF, 0xF0, 0xBF, 0xFF, 0x0B, 0xF9, 0x00, 0xBF, 0xC0, 0x0F, 0x7F, 0x00, 0xF4, 0xFC, 0x0F, 0x03,
-    0xF0, 0xF0, 0x0F, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x01, 0xFF, 0xA8, 0x1F, 0xFF, 0xD0, 0x06, 0xFD,
-    0x00, 0x7F, 0xD0, 0x1F, 0xAE, 0x07, 0xE2, 0xE1, 0xF8, 0x1E, 0x3E, 0x01, 0xE1, 0x80, 0x00, 0x18,
-    0x00, 0x03, 0xE0, 0x09, 0x1F, 0x82, 0xE0, 0xBD, 0x2D, 0x02, 0xF7, 0xD0, 0x0F, 0xFC, 0x00, 0x3F,
-    0xC2, 0xFF, 0xFC, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0x80, 0x3E, 0x3C, 0x0F, 0xC3,
-    0xC3, 0xF0, 0x2D, 0xBD, 0x02, 0xFF, 0x40, 0x1F, 0xE0, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xEA,
-    0xAA, 0x2F, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x1F, 0xEA, 0xAA, 0x01, 0xF8,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x07, 0x6C, 0x00, 0x01,
-    0xF6, 0xF0, 0x00, 0x7F, 0x6F, 0xC0, 0x1F, 0xF6, 0xFF, 0x07, 0xF7, 0x6D, 0xFC, 0xBC, 0x76, 0xD3,
-    0xD2, 0x07, 0x6D, 0x04, 0x00, 0x76, 0xD0, 0x00, 0x07, 0x6D, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x07,
-    0x6D, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xF3,
-    0xFF, 0xFF, 0xF4, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x10, 0x40, 0x00, 0x07, 0x6D, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x07, 0x6D, 0x00, 0x00, 0x76,
-    0xD0, 0x00, 0x07, 0x6D, 0x00, 0x20, 0x76, 0xD0, 0x4B, 0xC7, 0x6D, 0x3D, 0x7F, 0x76, 0xDF, 0xC1,
-    0xFF, 0x6F, 0xF0, 0x07, 0xF6, 0xFC, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x76, 0xC0, 0x00, 0x01, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x3E, 0x07, 0xD0, 0x02, 0xF0, 0x0B, 0xC0,
-    0x2F, 0xEA, 0xAF, 0xC2, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x2F, 0x0F, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xEA, 0xBF, 0x80, 0x1F, 0x81, 0xF8, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x3F, 0xD0, 0x07, 0xFF, 0xE0, 0xBF, 0x6F, 0xF7, 0xFD, 0xB7, 0xE1, 0x76,
-    0xC1, 0x00, 0xDB, 0x00, 0x03, 0x6C, 0x00, 0x9D, 0xB1, 0x8F, 0xF6, 0xEF, 0x9F, 0xEB, 0xFC, 0x0F,
-    0xFF, 0x40, 0x0B, 0xF0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFF,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0xFF, 0x6D, 0x0F, 0xFF,
-    0xF4, 0xFD, 0x2F, 0xC3, 0xE0, 0x3F, 0x0F, 0x40, 0xB8, 0x3F, 0x47, 0xD0, 0xBF, 0xFF, 0x00, 0xFF,
-    0xF4, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x3C, 0x00, 0x2F, 0xFF,
-    0xEF, 0xC0, 0x0F, 0xF9, 0x7F, 0xE0, 0x01, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x00, 0x7F, 0xF0, 0x03,
-    0xF0, 0x2F, 0x7F, 0x00, 0x3E, 0x0B, 0xD3, 0xF0, 0x07, 0xE3, 0xF0, 0x3F, 0x00, 0x3F, 0xFC, 0x03,
-    0xF0, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3E, 0x0B, 0xFF, 0x90, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x1F, 0x8F,
-    0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x41, 0xFC, 0x02, 0xFC, 0x3F,
-    0x40, 0x0F, 0xC3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B,
-    0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2,
-    0xF0, 0x0B, 0xC2, 0xF0, 0x05, 0x41, 0x50, 0x05, 0x41, 0x50, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0,
-    0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B,
-    0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC2, 0xF0, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC2, 0xAA, 0xA8, 0x1A, 0xBF, 0xC3, 0xFF, 0xFC, 0x15, 0x55, 0x00, 0x00, 0x02, 0xAA, 0x90,
-    0x00, 0x3F, 0xFC, 0x00, 0x07, 0xD4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xB0,
-    0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x50, 0x04, 0x00, 0x2F, 0xF5, 0xFF, 0x02, 0xFF, 0xFF, 0xFE, 0x0F, 0x81, 0xF8, 0x3C,
-    0x3C, 0x02, 0xC0, 0xB4, 0xF4, 0x0F, 0x43, 0xD3, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x07,
-    0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0xF8, 0x10, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x65, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0x0F, 0xD3, 0xF8, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x29, 0x7F, 0xF2, 0xEB, 0xCB, 0xFD, 0x14,
-    0x1A, 0x41, 0xA4, 0x14, 0x7F, 0xE3, 0xEB, 0xDF, 0x7D, 0x68, 0x7F, 0xC0, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0xFF, 0x43, 0xFF, 0xFF, 0xF2, 0xFF, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xFF, 0x47, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x01, 0xBC, 0x03, 0xFE, 0x94, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x01, 0x6A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0xBF, 0x90, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x6F, 0xFD, 0x01, 0xBF, 0xFF, 0xE4, 0x0F, 0xFF, 0x90, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x5A,
-    0xB8, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xFA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_8_boldBitmaps[17571] = {
+    0x7D, 0x55, 0xBF, 0x6F, 0x14, 0x47, 0x14, 0x7E, 0xBB, 0x1B, 0xDF, 0x2A, 0xAC, 0xC4, 0x50, 0x80,
+    0x84, 0x80, 0x64, 0x9A, 0x34, 0x21, 0xC8, 0xDB, 0x50, 0xA0, 0xC8, 0xBE, 0x59, 0xD9, 0x05, 0x52,
+    0x7E, 0xC8, 0x2E, 0x82, 0x52, 0x24, 0x12, 0x4D, 0x8A, 0x28, 0x8D, 0xFF, 0x81, 0xBB, 0xDB, 0x15,
+    0x96, 0x92, 0x22, 0x05, 0x4E, 0x41, 0x13, 0x0A, 0xA7, 0xA0, 0x48, 0xA0, 0x80, 0x82, 0x82, 0xE2,
+    0xCC, 0x2D, 0xBE, 0xC2, 0x45, 0x0A, 0xD6, 0x9C, 0x14, 0x8A, 0x14, 0x5E, 0xC0, 0x91, 0xA5, 0x50,
+    0x78, 0x4C, 0xC6, 0xC9, 0xDA, 0xCC, 0xEE, 0xCB, 0x37, 0x77, 0x96, 0x42, 0x95, 0xBD, 0x99, 0xD9,
+    0x99, 0xB9, 0xB7, 0x6F, 0xDE, 0xFB, 0xDE, 0xF7, 0xDE, 0x50, 0x40, 0x7A, 0x46, 0x04, 0x8F, 0x74,
+    0x47, 0x46, 0xEB, 0xBA, 0x13, 0x92, 0x7B, 0xC4, 0x70, 0xBF, 0x19, 0xFC, 0xB8, 0x72, 0xFE, 0xDB,
+    0x5B, 0x2C, 0x47, 0x26, 0x15, 0x9B, 0x56, 0x5D, 0xD6, 0x4D, 0x9C, 0x53, 0x74, 0xAD, 0x24, 0x6A,
+    0x8B, 0x8C, 0xC8, 0xCC, 0x12, 0x05, 0x85, 0x21, 0xC1, 0xCC, 0x26, 0xC5, 0x90, 0x7F, 0xBE, 0xBF,
+    0xF6, 0x19, 0x89, 0x75, 0x4D, 0xA4, 0x44, 0x4E, 0x6E, 0x6B, 0x88, 0x5E, 0x4F, 0x2D, 0xDD, 0xFC,
+    0x63, 0x91, 0x1E, 0xCA, 0x8C, 0x7C, 0xB3, 0x46, 0x74, 0xEC, 0x87, 0x5B, 0x34, 0x79, 0x04, 0xFA,
+    0x0C, 0x51, 0xEB, 0x20, 0xF1, 0x98, 0xA1, 0x47, 0xD3, 0xC3, 0x0E, 0xF9, 0xFB, 0x9A, 0xA2, 0xD7,
+    0x39, 0x96, 0x2B, 0xE8, 0x15, 0xF9, 0xE8, 0xE1, 0xAA, 0x3E, 0xFE, 0xAE, 0xCC, 0xB9, 0xE1, 0x88,
+    0x59, 0xB7, 0xF8, 0x80, 0x68, 0x1A, 0xDF, 0x3E, 0x20, 0xF2, 0x0A, 0xBC, 0x5B, 0x09, 0x91, 0x8E,
+    0xB3, 0xE9, 0xE8, 0x9D, 0x20, 0x2F, 0x4B, 0x13, 0x1D, 0x97, 0x94, 0x8E, 0x0A, 0xDF, 0xF4, 0x89,
+    0x64, 0x9C, 0x05, 0x3B, 0x9F, 0x52, 0xE7, 0x5E, 0x29, 0xBE, 0x3F, 0xEE, 0xEB, 0xB4, 0xE8, 0x7A,
+    0xD5, 0x31, 0x18, 0x2F, 0xB7, 0xA9, 0xDB, 0xA5, 0x7B, 0xC2, 0xB5, 0x7E, 0x4C, 0xCA, 0x92, 0x28,
+    0x49, 0xE9, 0x93, 0xFD, 0xFE, 0xAC, 0x95, 0x6B, 0x75, 0x68, 0x07, 0x5C, 0x29, 0xB6, 0xD1, 0x01,
+    0xA9, 0x61, 0xA5, 0xE6, 0x8D, 0x9A, 0xFB, 0x89, 0x74, 0x94, 0x77, 0x82, 0x52, 0x92, 0x0D, 0x0A,
+    0x49, 0x7D, 0x5F, 0x8B, 0xAC, 0x8D, 0x39, 0x76, 0x65, 0x82, 0x89, 0x5F, 0x61, 0x5A, 0x8A, 0xFC,
+    0x4C, 0x32, 0x4B, 0x31, 0x89, 0x2C, 0xCC, 0x83, 0xD2, 0xD7, 0x64, 0xA8, 0xA2, 0x3E, 0x7E, 0x1D,
+    0xFC, 0xDC, 0xDB, 0x52, 0xE5, 0x99, 0x40, 0x43, 0xB6, 0x90, 0xB9, 0x4A, 0xBE, 0x99, 0xE0, 0x70,
+    0x7A, 0x6F, 0xC8, 0xF5, 0xD9, 0x86, 0x52, 0xA3, 0xF8, 0xD9, 0xEF, 0x5F, 0xD2, 0x7D, 0xB7, 0x7D,
+    0x82, 0xA2, 0x0C, 0x3E, 0x46, 0x99, 0xE2, 0x11, 0xD7, 0xD0, 0x33, 0x5E, 0x7A, 0x74, 0x7E, 0xD9,
+    0xAA, 0x65, 0xC4, 0xA4, 0x1C, 0xF0, 0x2E, 0xEB, 0xF7, 0xDB, 0xE9, 0x60, 0x8C, 0xE6, 0x05, 0x84,
+    0x04, 0x38, 0x90, 0xA7, 0xC9, 0x2F, 0x11, 0x19, 0x0A, 0x10, 0x2D, 0xE0, 0x98, 0x91, 0x48, 0x48,
+    0x8E, 0x11, 0x43, 0xC4, 0x3A, 0x04, 0x23, 0xA0, 0x0B, 0xB2, 0xB0, 0x2E, 0x40, 0x2B, 0x29, 0x2C,
+    0x8E, 0x04, 0x65, 0x02, 0xD3, 0xA9, 0x4D, 0x74, 0x91, 0x08, 0x98, 0xFA, 0x15, 0x1D, 0x9A, 0xE9,
+    0x70, 0x58, 0xCC, 0x74, 0xFE, 0x7A, 0xFA, 0xB8, 0xD7, 0xFF, 0xE7, 0xE5, 0xE3, 0x76, 0x37, 0xDC,
+    0xD1, 0xB5, 0xE2, 0x75, 0xB6, 0x82, 0x29, 0xCE, 0xBC, 0x95, 0xB0, 0x0A, 0x1A, 0xDA, 0xCA, 0xA0,
+    0xA6, 0xC2, 0x97, 0x62, 0x3C, 0x09, 0xF9, 0x15, 0xD7, 0x03, 0x4E, 0xCE, 0x56, 0x01, 0xEB, 0xDE,
+    0x52, 0x8E, 0x23, 0x71, 0x80, 0x85, 0x7C, 0xA4, 0xC3, 0xDA, 0x63, 0x78, 0xB4, 0xC1, 0x75, 0xCA,
+    0x85, 0x13, 0x30, 0x27, 0xC2, 0x1C, 0x34, 0x08, 0xF3, 0xD4, 0x44, 0x9C, 0x78, 0x96, 0xC2, 0x27,
+    0x37, 0x6A, 0x27, 0x50, 0xC5, 0xB5, 0xC3, 0x06, 0x36, 0x0E, 0x48, 0xEA, 0x60, 0x8B, 0xEE, 0x1B,
+    0x29, 0xE6, 0xFF, 0x6C, 0x06, 0xFC, 0xF7, 0x1D, 0x26, 0x99, 0x79, 0x15, 0x14, 0x3A, 0xCF, 0xA1,
+    0x43, 0xF1, 0xBC, 0x53, 0x02, 0x97, 0x15, 0x4E, 0x37, 0x27, 0x25, 0xCE, 0x7C, 0x4F, 0x0E, 0xD9,
+    0xA6, 0x7C, 0x99, 0x0B, 0x2F, 0x21, 0x8F, 0x73, 0xB6, 0xF1, 0x15, 0x48, 0x75, 0xEB, 0x90, 0xAB,
+    0xC1, 0xD5, 0x5F, 0x8B, 0xF6, 0x5A, 0xB0, 0x53, 0xB6, 0xD5, 0xEE, 0x26, 0xDB, 0xB0, 0x81, 0x9A,
+    0x88, 0x11, 0x75, 0x67, 0xA6, 0xC8, 0x3C, 0x43, 0x71, 0x82, 0x83, 0x53, 0x8A, 0x34, 0x35, 0xE0,
+    0x86, 0x57, 0x93, 0xF7, 0x33, 0xA9, 0xDA, 0xD7, 0x7D, 0x91, 0x18, 0x15, 0xE5, 0xA9, 0x0B, 0x96,
+    0xF8, 0xCD, 0x74, 0x83, 0x57, 0x5A, 0x6C, 0x94, 0x29, 0xA8, 0x1A, 0x73, 0x1E, 0x6D, 0x53, 0x58,
+    0xF9, 0x6C, 0x66, 0xA2, 0x8D, 0x64, 0xF6, 0x7E, 0xF0, 0x34, 0x6B, 0xB7, 0x97, 0x9E, 0x73, 0xD3,
+    0xE2, 0x92, 0x66, 0xDB, 0x77, 0x87, 0xE0, 0x54, 0x3D, 0x0E, 0xF8, 0xC6, 0x9E, 0x1D, 0x07, 0x4D,
+    0xC9, 0x8D, 0x57, 0x96, 0xBC, 0x2A, 0x46, 0x48, 0x73, 0xB7, 0x31, 0x35, 0x67, 0xE3, 0xF5, 0x0A,
+    0xB9, 0x76, 0xCA, 0xAD, 0x60, 0x76, 0x05, 0xCB, 0x33, 0x9F, 0x0B, 0x9F, 0x57, 0x30, 0x21, 0xD9,
+    0x60, 0x8D, 0xCC, 0x58, 0xE2, 0x82, 0xCE, 0xD6, 0x13, 0xFE, 0xFB, 0x6C, 0x15, 0xBB, 0xAF, 0xAF,
+    0xCC, 0x61, 0xD6, 0x64, 0x27, 0xB1, 0x05, 0x26, 0xC4, 0xD5, 0x51, 0xAF, 0xC7, 0xEF, 0x90, 0x93,
+    0x25, 0xC7, 0xE9, 0x95, 0xA0, 0x49, 0xE8, 0xD2, 0x24, 0x01, 0x23, 0xE3, 0x21, 0x8E, 0x9B, 0xD5,
+    0x69, 0x70, 0x06, 0x84, 0x01, 0x4F, 0x3A, 0x63, 0xB8, 0x13, 0x61, 0x48, 0x25, 0x40, 0x02, 0x8B,
+    0xB7, 0x8F, 0x92, 0xD5, 0x5F, 0x71, 0x0C, 0x49, 0xC9, 0xB7, 0x58, 0x7C, 0x85, 0x0C, 0x82, 0x35,
+    0x6B, 0x7E, 0x09, 0xAA, 0x5D, 0x0C, 0x86, 0xF6, 0x42, 0xF4, 0xD1, 0x85, 0x73, 0xE2, 0x93, 0x73,
+    0xE7, 0xC4, 0x75, 0x7B, 0x49, 0x0C, 0x77, 0x91, 0x0A, 0xAD, 0x24, 0xA8, 0x3D, 0x97, 0xD9, 0xAE,
+    0x14, 0xE4, 0xD4, 0x6A, 0xB2, 0x49, 0xD2, 0x27, 0x63, 0x15, 0xAA, 0x20, 0x07, 0xFA, 0xA1, 0x26,
+    0xB9, 0x90, 0xF8, 0xDA, 0x92, 0x8A, 0x8A, 0xB0, 0xEC, 0x11, 0xF2, 0x5B, 0x32, 0x5F, 0x63, 0x78,
+    0x92, 0x88, 0xA7, 0x00, 0xDF, 0x01, 0xCD, 0x79, 0x2F, 0xD4, 0x5D, 0xCF, 0xB5, 0xDE, 0x17, 0x25,
+    0x96, 0x29, 0x9B, 0xAE, 0x67, 0xBB, 0x64, 0xD3, 0x3B, 0x88, 0x30, 0x1A, 0x0A, 0xD0, 0x8A, 0xD3,
+    0x1E, 0x37, 0x1E, 0x37, 0x21, 0xD7, 0xC2, 0xBC, 0x05, 0x0A, 0xC0, 0x07, 0xB4, 0x14, 0x2D, 0x23,
+    0x55, 0x4E, 0x29, 0xAE, 0x25, 0xD7, 0x11, 0x83, 0x81, 0x75, 0xDA, 0x64, 0xD2, 0x49, 0xF2, 0xB3,
+    0xCA, 0xB7, 0x3D, 0x8A, 0xAF, 0xA2, 0x4E, 0x94, 0x74, 0x50, 0x91, 0xEA, 0x91, 0x58, 0xCD, 0x96,
+    0x76, 0x98, 0xF7, 0xD9, 0x69, 0xB6, 0x12, 0x05, 0xE8, 0x03, 0xD6, 0x28, 0x66, 0x87, 0x57, 0x50,
+    0xD6, 0x14, 0x51, 0xFD, 0x35, 0x18, 0x27, 0x38, 0xC7, 0x14, 0x10, 0x1D, 0xDE, 0x16, 0x4E, 0x0E,
+    0xD2, 0xA5, 0xE4, 0x27, 0x5C, 0xC7, 0x37, 0xE6, 0x34, 0xA4, 0x02, 0x07, 0xF6, 0x32, 0x98, 0xE9,
+    0x40, 0x3C, 0x1A, 0x42, 0x94, 0xC6, 0x33, 0xBF, 0x80, 0x68, 0x35, 0xFC, 0xAC, 0x50, 0x5C, 0x16,
+    0x5D, 0xD4, 0x11, 0x1F, 0xFC, 0x4B, 0x32, 0xFF, 0x70, 0x31, 0x25, 0xD6, 0xB5, 0x37, 0x18, 0x59,
+    0xEA, 0x45, 0xCD, 0x1D, 0x9C, 0xC1, 0x05, 0x7A, 0xD2, 0x82, 0x73, 0x8A, 0x62, 0x91, 0x47, 0x23,
+    0xED, 0x1B, 0x4B, 0x6B, 0x8A, 0xD4, 0x42, 0x2E, 0x46, 0x3A, 0x30, 0xCD, 0xED, 0x46, 0x31, 0x5F,
+    0x67, 0x7E, 0x01, 0x8D, 0x35, 0xE0, 0x4A, 0xD4, 0x6A, 0x21, 0xB4, 0x12, 0x43, 0x6D, 0xDF, 0x18,
+    0x64, 0xE1, 0x38, 0x21, 0x0A, 0x9A, 0xD8, 0xAC, 0x09, 0x9E, 0xF4, 0x1C, 0xBB, 0xC2, 0x12, 0x4C,
+    0xA7, 0xB5, 0xC9, 0xD6, 0x62, 0x0A, 0xAB, 0x05, 0x17, 0x60, 0xE9, 0x54, 0x82, 0x3B, 0xA0, 0x0A,
+    0xF6, 0x50, 0xAF, 0x6A, 0x6A, 0xA7, 0x24, 0x07, 0x60, 0x50, 0x86, 0x2C, 0xA2, 0x41, 0xE1, 0xE8,
+    0x24, 0x38, 0x0B, 0xD8, 0x92, 0x05, 0x0A, 0xC2, 0xCA, 0x47, 0x5C, 0xC4, 0xAE, 0xB0, 0xA0, 0xA4,
+    0x44, 0xF9, 0x9B, 0x67, 0x1C, 0x4D, 0x4F, 0x09, 0x46, 0x4A, 0x03, 0xA2, 0x42, 0xE5, 0xA1, 0xE6,
+    0x44, 0x0D, 0x1B, 0x62, 0x61, 0xA3, 0x5A, 0x55, 0xCA, 0xF0, 0x1E, 0xEA, 0xDB, 0x16, 0x2F, 0xEC,
+    0xF2, 0x9A, 0x52, 0x87, 0xC6, 0xF2, 0xD6, 0x8B, 0x3D, 0x56, 0xD7, 0x87, 0x55, 0x93, 0x8A, 0xD1,
+    0x41, 0x3D, 0x25, 0xCA, 0xA9, 0x44, 0x7C, 0xA7, 0x83, 0xCD, 0xC6, 0x33, 0x69, 0xDE, 0x8D, 0x2B,
+    0xF9, 0x31, 0x87, 0x4F, 0x5E, 0x3F, 0xD7, 0x4D, 0xBF, 0xAF, 0x56, 0xEF, 0x8A, 0x17, 0x3C, 0xAC,
+    0x52, 0xDD, 0x08, 0xAB, 0xD6, 0x59, 0x6A, 0x20, 0xBA, 0xB4, 0x0D, 0x88, 0x2B, 0xE2, 0x9B, 0x55,
+    0x08, 0x84, 0x1C, 0xEC, 0xC8, 0xE9, 0x21, 0xEA, 0x3B, 0xAE, 0x20, 0xEB, 0x42, 0xC1, 0x49, 0xEA,
+    0x6E, 0x26, 0x44, 0x1F, 0x25, 0x87, 0xB3, 0x16, 0x6F, 0x1F, 0x91, 0x9C, 0x06, 0xC8, 0xDE, 0x3A,
+    0xCA, 0x71, 0x25, 0x18, 0x1B, 0x8E, 0x98, 0x17, 0x5C, 0x6E, 0x65, 0xCD, 0xCA, 0x91, 0x37, 0x09,
+    0x82, 0x15, 0x1A, 0x97, 0xA7, 0x89, 0x93, 0x05, 0x24, 0xB8, 0xB7, 0xCA, 0x34, 0x8B, 0x33, 0x01,
+    0x36, 0x84, 0x05, 0x94, 0x83, 0xC3, 0x81, 0x6E, 0xA3, 0x2B, 0x2F, 0x28, 0xD5, 0xFC, 0xCB, 0x22,
+    0x46, 0x06, 0x20, 0x88, 0x99, 0x93, 0xA5, 0x01, 0xB2, 0x86, 0x50, 0x0D, 0x50, 0xA6, 0xDC, 0x71,
+    0x48, 0x67, 0x54, 0x8D, 0x69, 0xBF, 0x9C, 0xF6, 0x34, 0x5A, 0x1B, 0x5F, 0x01, 0x22, 0x60, 0x8A,
+    0x71, 0x5E, 0xBB, 0x7B, 0x67, 0x1E, 0xB7, 0x8F, 0x4D, 0x97, 0x2D, 0x4D, 0x0E, 0x95, 0x9C, 0x83,
+    0x7B, 0xF4, 0xD0, 0x73, 0xE6, 0x00, 0x5A, 0x02, 0x89, 0x48, 0x71, 0x02, 0xC5, 0xD0, 0xE6, 0xB2,
+    0x3D, 0x7F, 0xE0, 0x83, 0xB2, 0x60, 0x1E, 0xEB, 0x63, 0xFF, 0xF9, 0xF5, 0x3F, 0xCF, 0xBF, 0x8D,
+    0x55, 0xBF, 0x6F, 0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x23, 0x79, 0xE0, 0x8C, 0x81, 0x71, 0x21, 0x27,
+    0x46, 0x22, 0x60, 0x54, 0xA8, 0x48, 0x14, 0x8A, 0xEB, 0xC2, 0x05, 0x11, 0xDC, 0xED, 0x8C, 0x92,
+    0x22, 0x80, 0x04, 0x98, 0x2A, 0xE4, 0x22, 0x9D, 0x0A, 0x17, 0x76, 0x20, 0x03, 0x29, 0x58, 0x28,
+    0xC0, 0xDD, 0xED, 0x46, 0x42, 0xE0, 0x42, 0x40, 0xCC, 0x3F, 0x20, 0x88, 0x5D, 0xD8, 0x85, 0x15,
+    0x01, 0x12, 0x10, 0x22, 0x60, 0x00, 0x8A, 0x37, 0xE2, 0x15, 0x2C, 0x52, 0x68, 0xE8, 0x33, 0xA0,
+    0xC2, 0x06, 0x38, 0x14, 0x61, 0x38, 0x80, 0x02, 0x70, 0x98, 0x5B, 0x8B, 0x6B, 0x71, 0x77, 0x5F,
+    0xDE, 0x9C, 0xA5, 0x22, 0x5D, 0x96, 0x73, 0x9C, 0x9B, 0xD9, 0x99, 0xF7, 0xE3, 0x7B, 0xDF, 0xFB,
+    0xAE, 0x40, 0xDC, 0x45, 0x3C, 0x42, 0x6C, 0x60, 0x03, 0x20, 0x33, 0x20, 0x1C, 0xA4, 0x15, 0x40,
+    0x0B, 0xA0, 0x0D, 0x48, 0x07, 0xEC, 0xF9, 0xA2, 0x04, 0xE9, 0xA1, 0x30, 0xFA, 0x23, 0x27, 0xA7,
+    0x81, 0x55, 0x0D, 0xB4, 0x1A, 0xF4, 0xB2, 0x8D, 0x8B, 0xD0, 0x40, 0x43, 0x0B, 0xE9, 0xD4, 0x04,
+    0x31, 0x8C, 0xB1, 0x56, 0xD8, 0x26, 0x48, 0x97, 0xE8, 0x1A, 0xC4, 0xB7, 0xEA, 0x46, 0x0D, 0x2D,
+    0xA3, 0x83, 0xD2, 0x65, 0x65, 0x66, 0x5B, 0x28, 0x44, 0x80, 0x4E, 0x97, 0x69, 0xD7, 0x02, 0xC7,
+    0x00, 0x12, 0x4B, 0xC8, 0xE8, 0x7C, 0x11, 0x00, 0xE8, 0x2B, 0x7C, 0x7F, 0x13, 0x92, 0x86, 0x42,
+    0x48, 0x6B, 0x72, 0xCD, 0xAA, 0xCC, 0x9E, 0x62, 0x41, 0xD9, 0xFB, 0x9C, 0x6C, 0xA0, 0xF0, 0xF2,
+    0x31, 0x2E, 0x3B, 0x31, 0xC3, 0x87, 0x96, 0x1F, 0xE3, 0x81, 0xE5, 0xF8, 0x04, 0x4B, 0x86, 0x8F,
+    0xD0, 0x30, 0x9C, 0x20, 0xA4, 0x78, 0x03, 0x21, 0x41, 0x40, 0x50, 0xA5, 0xB0, 0x0D, 0xD4, 0x3C,
+    0x68, 0xC8, 0x2E, 0x39, 0x68, 0x1B, 0x10, 0x68, 0x40, 0x7B, 0x48, 0x63, 0x4E, 0x73, 0xCF, 0x31,
+    0x88, 0x62, 0x39, 0xC8, 0xA0, 0x27, 0x4D, 0xDA, 0x69, 0x90, 0x5B, 0x55, 0x5A, 0x4B, 0xAB, 0x61,
+    0x53, 0xF8, 0x18, 0x7C, 0x76, 0xB7, 0x84, 0x18, 0x63, 0x47, 0xF1, 0x59, 0x60, 0xF5, 0x1C, 0x8B,
+    0x17, 0x53, 0x43, 0x16, 0xD0, 0x8D, 0xB1, 0xE5, 0x34, 0x81, 0xAA, 0x81, 0x21, 0xA5, 0x60, 0xE7,
+    0xA6, 0x5B, 0x5A, 0xD0, 0x55, 0x0F, 0xBA, 0xBB, 0x4D, 0xAF, 0xAB, 0x02, 0xF1, 0x03, 0xC2, 0x59,
+    0x36, 0x3A, 0x54, 0xCC, 0x29, 0x18, 0x24, 0x81, 0x5B, 0x9A, 0xD2, 0x20, 0x6C, 0x06, 0x1B, 0x69,
+    0x90, 0x65, 0x0E, 0x35, 0xF3, 0xB2, 0xEC, 0x03, 0x4E, 0x71, 0x79, 0x0E, 0xE0, 0x19, 0x78, 0x13,
+    0x96, 0xA0, 0x07, 0xE7, 0x41, 0x81, 0x04, 0x49, 0xE9, 0x30, 0xC7, 0x7C, 0x1A, 0x92, 0x0A, 0x62,
+    0xC5, 0x56, 0xE0, 0x0D, 0x78, 0x55, 0x07, 0x24, 0x03, 0xCF, 0xCD, 0xF5, 0x80, 0x8C, 0x4B, 0xD3,
+    0xA7, 0xC9, 0x3F, 0x37, 0x28, 0x4A, 0x32, 0x5F, 0x1C, 0xE2, 0x36, 0xCE, 0x91, 0x95, 0x31, 0xEC,
+    0xE3, 0xD0, 0x17, 0x36, 0x2E, 0x90, 0x5C, 0x61, 0xF5, 0xF6, 0xDB, 0x57, 0x86, 0x30, 0x82, 0x62,
+    0x7E, 0xA0, 0x58, 0x57, 0x38, 0x71, 0xCD, 0x12, 0xDF, 0x36, 0xBD, 0x15, 0x3E, 0xC5, 0x36, 0x43,
+    0x3F, 0x1E, 0x51, 0x3D, 0x02, 0x70, 0x4B, 0x71, 0x90, 0x0F, 0x38, 0x5C, 0x65, 0x58, 0x49, 0x0C,
+    0xFA, 0x97, 0xBE, 0x61, 0x93, 0x20, 0x85, 0xDD, 0xA0, 0x53, 0x05, 0xC2, 0x38, 0xC0, 0xA9, 0x68,
+    0x64, 0x7C, 0x01, 0x7D, 0x4B, 0x27, 0x15, 0x70, 0xC2, 0xFD, 0xAA, 0xC2, 0x64, 0x4C, 0x95, 0x7D,
+    0x61, 0x61, 0x40, 0xC6, 0xC4, 0x13, 0x8B, 0x28, 0xBF, 0x6C, 0x7A, 0xFC, 0xD0, 0xAB, 0x0F, 0xDC,
+    0xA6, 0x8C, 0xC4, 0x09, 0x3F, 0x79, 0x62, 0xA9, 0x36, 0x5D, 0x9D, 0xFF, 0x68, 0x82, 0xDD, 0xE8,
+    0xD3, 0x5F, 0x3B, 0xD0, 0xB8, 0x87, 0x5D, 0x4A, 0x65, 0x23, 0x06, 0x8E, 0x6F, 0x3A, 0x99, 0x10,
+    0x5D, 0xB7, 0xBF, 0x9E, 0xE7, 0xC6, 0xBD, 0x2A, 0x47, 0xF0, 0xD2, 0xD3, 0x43, 0xEC, 0xFA, 0xEA,
+    0x9B, 0x72, 0x73, 0x85, 0xD3, 0x3F, 0x8D, 0x9F, 0x63, 0x2B, 0xD0, 0x9D, 0xE8, 0x81, 0xD8, 0x3A,
+    0xAE, 0x35, 0xA6, 0x58, 0x92, 0xCB, 0x0D, 0x48, 0x03, 0x50, 0xCE, 0x39, 0x40, 0xD7, 0x32, 0xAA,
+    0xC3, 0x4E, 0x95, 0x27, 0xBE, 0xE6, 0x13, 0x9F, 0xA9, 0x72, 0xA3, 0x60, 0x87, 0x8D, 0xB4, 0xC3,
+    0xFB, 0x9B, 0x9F, 0x51, 0x7A, 0xF1, 0x19, 0x0C, 0x86, 0x43, 0xF8, 0x98, 0x13, 0xB0, 0xF3, 0x27,
+    0x83, 0xF5, 0x94, 0x80, 0x5C, 0x84, 0xB5, 0x74, 0x8E, 0x6E, 0xD0, 0x16, 0x79, 0x15, 0xF7, 0xA3,
+    0x61, 0x0F, 0xA2, 0x8C, 0x86, 0xAB, 0x4F, 0xD8, 0xAE, 0x95, 0x0D, 0x68, 0x0B, 0x91, 0x8A, 0x46,
+    0x61, 0x39, 0x1C, 0xFF, 0xA1, 0x1A, 0xDB, 0x45, 0xE6, 0xFA, 0x71, 0xD8, 0x1E, 0xB7, 0x83, 0x38,
+    0xBE, 0x28, 0xB6, 0xE7, 0xF5, 0x55, 0x9B, 0x97, 0xBC, 0xC2, 0x83, 0x3A, 0xBB, 0x59, 0x0F, 0xB3,
+    0xB4, 0xCA, 0x75, 0x1A, 0x72, 0xCD, 0x82, 0x8E, 0x9F, 0x11, 0xF7, 0x7A, 0x24, 0x1C, 0x75, 0x02,
+    0x3B, 0xF0, 0x1A, 0x27, 0xD5, 0xB0, 0xCF, 0xA6, 0x2E, 0xEF, 0xB3, 0x6F, 0x68, 0x9F, 0x1D, 0x05,
+    0x9D, 0x52, 0x9B, 0xD5, 0x39, 0x7F, 0x64, 0xF3, 0x01, 0x9B, 0x7D, 0x4B, 0x89, 0xEF, 0x60, 0x1D,
+    0x89, 0x7D, 0x02, 0xD4, 0xD8, 0xCA, 0x67, 0xD4, 0x2A, 0x4B, 0xD2, 0xF6, 0xE2, 0x70, 0x3D, 0xD9,
+    0x35, 0x0A, 0x2B, 0x85, 0x2E, 0x3B, 0x19, 0x7B, 0x8B, 0x06, 0x55, 0xF4, 0xBD, 0x79, 0x6E, 0xE9,
+    0xB3, 0xA0, 0xD0, 0xF7, 0xA4, 0xBF, 0x2E, 0xDC, 0x0A, 0x77, 0x03, 0x61, 0x35, 0x11, 0x0A, 0xAD,
+    0xC0, 0x07, 0xC0, 0xBA, 0xF9, 0xF8, 0x0E, 0x52, 0x93, 0x6D, 0x64, 0x6D, 0xF6, 0x45, 0x46, 0x29,
+    0xEB, 0xF9, 0x5F, 0x61, 0x22, 0x2E, 0x95, 0xFC, 0x2B, 0x55, 0x55, 0x7C, 0x07, 0xA2, 0x01, 0xEE,
+    0xBB, 0x4E, 0xE3, 0x83, 0xB1, 0xFF, 0x1E, 0xB3, 0xEB, 0x04, 0x89, 0x2C, 0x35, 0x4A, 0x74, 0x7D,
+    0x90, 0x86, 0x39, 0xA8, 0x20, 0xFF, 0x58, 0x36, 0x2C, 0xD6, 0xF2, 0x3A, 0x7B, 0x64, 0xFB, 0x03,
+    0x36, 0xB5, 0x79, 0x8F, 0xEF, 0x3B, 0x8A, 0xFD, 0x31, 0x76, 0xE2, 0xD8, 0xF7, 0x21, 0x27, 0x2A,
+    0x2B, 0x53, 0xCB, 0xAD, 0xC0, 0xF7, 0x3D, 0x3B, 0xB6, 0x09, 0x46, 0x30, 0x61, 0x6C, 0x86, 0xC0,
+    0x66, 0x1E, 0x72, 0x2D, 0xF8, 0xE7, 0x87, 0xCD, 0x86, 0x2A, 0x76, 0x89, 0x3E, 0x35, 0xF1, 0xD7,
+    0x8C, 0x31, 0xB0, 0xBA, 0x03, 0x4D, 0xD2, 0x15, 0x19, 0x6D, 0x1B, 0xF6, 0x38, 0x24, 0xD4, 0x8E,
+    0x44, 0xB8, 0x82, 0x64, 0xC0, 0xB2, 0xE3, 0x20, 0xA7, 0x24, 0x23, 0x6D, 0x1F, 0xEA, 0x0D, 0xE6,
+    0x6A, 0x95, 0x56, 0x35, 0x9B, 0x39, 0x81, 0x20, 0x6B, 0xC8, 0x5C, 0xC4, 0x82, 0x74, 0x21, 0xAE,
+    0xB3, 0x0A, 0x36, 0x63, 0x4F, 0x04, 0x02, 0x80, 0x54, 0x4F, 0xDA, 0x84, 0xFA, 0xDF, 0xB2, 0xEE,
+    0x8A, 0x8C, 0xED, 0x1B, 0x28, 0x88, 0x31, 0x95, 0x43, 0x5A, 0xE6, 0xA1, 0x26, 0xFC, 0x90, 0x34,
+    0x80, 0x94, 0x6C, 0x08, 0xCA, 0x70, 0x47, 0x1D, 0x59, 0x78, 0x32, 0xF8, 0x1B, 0x48, 0x9F, 0xBC,
+    0xFF, 0xF7, 0x2F, 0xDF, 0x3F, 0xDA, 0xED, 0xCD, 0x1E, 0xF6, 0x74, 0x49, 0x74, 0xC8, 0x60, 0xFE,
+    0x7A, 0x48, 0x68, 0x10, 0x98, 0x45, 0xA9, 0x1D, 0x99, 0x08, 0xE4, 0x54, 0x93, 0xDC, 0x15, 0xF6,
+    0x07, 0x06, 0xD4, 0x42, 0xF7, 0xB7, 0x8F, 0xFE, 0x78, 0xEA, 0xDC, 0xCD, 0x46, 0x6F, 0x35, 0xD9,
+    0x73, 0x09, 0x3C, 0x2B, 0x2F, 0x54, 0xD2, 0xD0, 0xA8, 0x65, 0xB9, 0x2E, 0xCA, 0xB5, 0x97, 0x68,
+    0xEF, 0x77, 0x70, 0x1A, 0x04, 0x88, 0x4A, 0x75, 0xF2, 0x0E, 0xFF, 0x67, 0xF2, 0x1F, 0x3B, 0xBC,
+    0x27, 0xDB, 0x14, 0x3D, 0x49, 0x8F, 0x27, 0xA1, 0x38, 0x19, 0xEF, 0x25, 0x9B, 0xA4, 0x72, 0xD4,
+    0x27, 0xAB, 0x32, 0x36, 0x3B, 0x70, 0x82, 0x01, 0x2D, 0x0D, 0xA2, 0x29, 0xB5, 0x80, 0x22, 0x41,
+    0xC2, 0x55, 0x8D, 0xD5, 0xB9, 0xDB, 0x9F, 0x44, 0x27, 0x22, 0x45, 0xE4, 0xD4, 0xCB, 0xB7, 0x6C,
+    0xAE, 0x0C, 0xB5, 0x05, 0x36, 0x1A, 0xC3, 0x99, 0x94, 0x6A, 0xA7, 0x85, 0xD7, 0x24, 0xD3, 0x26,
+    0x8A, 0x64, 0xD4, 0x34, 0x4B, 0x62, 0x0D, 0xC4, 0x0B, 0x49, 0x3A, 0xA2, 0xFE, 0x67, 0x51, 0x52,
+    0xE9, 0xA3, 0xE7, 0x05, 0xCA, 0xD8, 0xC0, 0x4F, 0xF7, 0xFF, 0xB4, 0xB4, 0x47, 0x12, 0xC9, 0xF0,
+    0x81, 0xBB, 0x3A, 0x32, 0xB2, 0x15, 0x07, 0x13, 0x5B, 0x45, 0x19, 0x49, 0xC8, 0x52, 0xE5, 0xFB,
+    0x63, 0x14, 0x1D, 0xFC, 0xEC, 0xC7, 0xF2, 0xD6, 0xF6, 0xEC, 0x69, 0xD3, 0x2A, 0xF7, 0xFB, 0xB5,
+    0xA7, 0xD7, 0xBE, 0x3A, 0x7D, 0x7C, 0x6D, 0xB4, 0x46, 0x3F, 0x38, 0xD0, 0x9C, 0x9D, 0xBE, 0xFC,
+    0x8B, 0xBD, 0x67, 0x51, 0xFC, 0xCE, 0x2C, 0x2C, 0xE5, 0xC3, 0x7C, 0x98, 0xE5, 0xFC, 0xD8, 0x8F,
+    0xEE, 0xF3, 0x5B, 0xE6, 0xB2, 0xD1, 0x9F, 0xFD, 0x0A, 0x9B, 0x1F, 0xDE, 0xB5, 0x24, 0x21, 0x24,
+    0x2C, 0xEF, 0x52, 0x5B, 0x60, 0xA3, 0x5C, 0x51, 0xFD, 0xEB, 0xCE, 0xEE, 0x9F, 0x9B, 0x7F, 0x8F,
+    0x2A, 0x45, 0x16, 0xB2, 0xF6, 0xDC, 0xA7, 0x14, 0x15, 0xED, 0xD6, 0x83, 0xAA, 0xD7, 0x35, 0x45,
+    0xDC, 0x7D, 0x27, 0xF6, 0xE8, 0x3A, 0xC3, 0xF6, 0x5C, 0xB7, 0x1A, 0xBF, 0x45, 0xF2, 0xC6, 0xCB,
+    0x34, 0x2F, 0x9E, 0x70, 0x6F, 0x2E, 0x9C, 0x97, 0x7B, 0x97, 0x17, 0xE1, 0xEA, 0xEB, 0xC3, 0xF4,
+    0xE1, 0xDE, 0xEA, 0x49, 0x76, 0xC3, 0x85, 0x45, 0xA8, 0x1A, 0x36, 0x0D, 0x72, 0xD9, 0xE6, 0x3A,
+    0xA9, 0x5B, 0xB1, 0x8F, 0xF8, 0x21, 0x76, 0x79, 0x57, 0x07, 0x60, 0x54, 0x22, 0x31, 0xDB, 0xC2,
+    0x9E, 0x9E, 0x3D, 0xEA, 0xFA, 0x7A, 0x7F, 0xA7, 0xEB, 0x13, 0x8B, 0xEF, 0xF7, 0xE5, 0xD4, 0xB5,
+    0x7D, 0x39, 0xD9, 0x69, 0xCE, 0x67, 0x5B, 0xD3, 0xE6, 0xFC, 0x6B, 0xC6, 0xE4, 0xA3, 0xE2, 0xB7,
+    0x27, 0x04, 0x0B, 0x7F, 0xD1, 0x17, 0xCD, 0xEB, 0x12, 0xEC, 0x1B, 0xAF, 0xA8, 0x9D, 0xCB, 0x00,
+    0xF5, 0xD2, 0xFE, 0x45, 0xED, 0xE9, 0x57, 0x24, 0x39, 0x09, 0x4B, 0x2B, 0xEC, 0xC8, 0x8B, 0xDD,
+    0x32, 0x1F, 0xCA, 0x83, 0xC9, 0x51, 0x58, 0xE8, 0x25, 0x29, 0xC4, 0x5A, 0x67, 0x26, 0x75, 0x3F,
+    0x37, 0xDC, 0x72, 0x23, 0x8D, 0x30, 0x8B, 0x20, 0x0C, 0x29, 0x9A, 0x59, 0x07, 0x7D, 0x18, 0xEE,
+    0xE9, 0xD9, 0x5E, 0x05, 0x7C, 0xB2, 0x06, 0xF2, 0xAD, 0x15, 0xC8, 0x16, 0xFF, 0x01, 0x43, 0xDD,
+    0x12, 0xA1, 0xAE, 0x13, 0xCD, 0xD6, 0x93, 0xCB, 0xF0, 0x7F, 0x3F, 0xFF, 0x05, 0xA5, 0x55, 0x31,
+    0x6C, 0xDD, 0x54, 0x14, 0x3D, 0xF6, 0x23, 0xB1, 0x14, 0x0F, 0x6F, 0x01, 0x09, 0xA8, 0x90, 0x17,
+    0x98, 0x2A, 0xC5, 0x0B, 0x43, 0x87, 0x24, 0xCF, 0x2A, 0x03, 0x03, 0x43, 0x33, 0x94, 0x85, 0x85,
+    0x35, 0x5B, 0x3A, 0x74, 0xE8, 0xD0, 0xC4, 0x1F, 0xA2, 0xAE, 0x34, 0x0B, 0x13, 0x03, 0x11, 0x6A,
+    0x51, 0xC9, 0x92, 0x0E, 0x19, 0x32, 0x94, 0xD8, 0x55, 0x86, 0x3F, 0x62, 0x11, 0x89, 0xAE, 0x06,
+    0x2A, 0x45, 0xC0, 0xF2, 0xD2, 0x3A, 0xC2, 0x09, 0xB6, 0x2F, 0xE7, 0xD9, 0x3F, 0x21, 0x2A, 0x85,
+    0x21, 0x7D, 0xDF, 0xCF, 0xDF, 0xFF, 0xDB, 0xF7, 0x9E, 0x7B, 0xEE, 0x3D, 0xF7, 0xDA, 0x03, 0xE0,
+    0x55, 0x98, 0xC2, 0xE5, 0x44, 0x15, 0xB8, 0x89, 0x5B, 0x08, 0x12, 0x0D, 0x6C, 0xFB, 0x25, 0xC2,
+    0x64, 0x0E, 0xC8, 0xF4, 0x9D, 0xC4, 0x1C, 0x3E, 0x93, 0x04, 0xF3, 0xAF, 0x5F, 0x41, 0x98, 0xAB,
+    0x1C, 0x15, 0x6E, 0xC3, 0x20, 0x46, 0x90, 0xEB, 0x02, 0xB5, 0x2F, 0x79, 0x8C, 0xB8, 0x81, 0x5B,
+    0x51, 0x09, 0xBC, 0xB7, 0xED, 0x17, 0xB8, 0x12, 0xE4, 0x53, 0x0F, 0x75, 0xA2, 0xAB, 0x59, 0xE0,
+    0xF6, 0x1C, 0xE2, 0xBA, 0x7A, 0x68, 0x9E, 0x1D, 0x56, 0x50, 0xFB, 0xDB, 0xD0, 0x5F, 0xDC, 0x44,
+    0x34, 0xBB, 0x83, 0x05, 0xD3, 0xE2, 0x11, 0x6E, 0x11, 0x7C, 0xC7, 0x5B, 0xA4, 0x71, 0x07, 0xBF,
+    0x42, 0x58, 0xE0, 0x6D, 0x0C, 0xCB, 0x1B, 0x11, 0x05, 0x0D, 0x94, 0x45, 0x9A, 0x07, 0xC7, 0xEE,
+    0x47, 0x45, 0x4C, 0x44, 0xC0, 0x3C, 0x92, 0x36, 0xCC, 0xA5, 0x43, 0xB6, 0x3E, 0x84, 0x8F, 0x80,
+    0xC8, 0x51, 0x8E, 0xD3, 0xC5, 0x7F, 0xE2, 0x1C, 0xAA, 0x05, 0xD2, 0x12, 0x7A, 0x8B, 0x8F, 0x54,
+    0x88, 0x75, 0xAE, 0xEC, 0xF7, 0x58, 0x0D, 0x4A, 0x2D, 0xE2, 0x89, 0xD4, 0xB1, 0xC8, 0x5E, 0x85,
+    0x36, 0x85, 0x2E, 0xE1, 0x25, 0x00, 0xD9, 0x86, 0xFC, 0xB2, 0x78, 0x61, 0xE9, 0x04, 0x3E, 0xF9,
+    0x99, 0x02, 0x41, 0x07, 0x9C, 0x58, 0x44, 0xD7, 0x12, 0xDF, 0x36, 0x30, 0x61, 0x11, 0x94, 0xAB,
+    0x10, 0xB1, 0x91, 0xC8, 0xE7, 0x22, 0x8D, 0x49, 0xF4, 0x13, 0x4B, 0x1E, 0x41, 0x02, 0x8F, 0x06,
+    0x29, 0x9F, 0xFC, 0xB0, 0xB8, 0xB0, 0x97, 0xB9, 0x1B, 0x08, 0xFF, 0x04, 0x0E, 0x2C, 0x66, 0xDE,
+    0xBA, 0x20, 0xAB, 0x8D, 0x25, 0xA2, 0xE4, 0x7E, 0x4D, 0x94, 0xAF, 0xF3, 0x0B, 0x07, 0x32, 0x31,
+    0x20, 0xB4, 0x8B, 0xE0, 0xA2, 0x5E, 0xF0, 0x6D, 0x26, 0xC0, 0xAE, 0x08, 0xCB, 0x2A, 0xF7, 0x13,
+    0x9E, 0x46, 0x2C, 0x19, 0x89, 0x40, 0xDF, 0x6D, 0x97, 0x10, 0xEC, 0x8B, 0xB0, 0xD4, 0x99, 0xE4,
+    0x7E, 0xE5, 0x64, 0x44, 0x26, 0x14, 0x9F, 0xC8, 0xE6, 0x7A, 0x2A, 0xCE, 0xCB, 0x88, 0xF4, 0xA2,
+    0x5C, 0x89, 0x9C, 0x25, 0x14, 0x71, 0xE7, 0x49, 0x17, 0x48, 0xAB, 0xAB, 0xD7, 0x58, 0x7A, 0x93,
+    0xB8, 0x23, 0xE5, 0x41, 0x80, 0x72, 0xCA, 0x48, 0x1B, 0x49, 0x1B, 0x4A, 0xEB, 0x49, 0x8B, 0x90,
+    0x20, 0x05, 0x66, 0x98, 0xB4, 0x91, 0xCE, 0x9D, 0xC6, 0xC2, 0x72, 0x70, 0xB1, 0x25, 0x7B, 0x22,
+    0xFA, 0xB7, 0xEB, 0x83, 0xD0, 0x8E, 0x36, 0xB4, 0x14, 0x46, 0x06, 0xCD, 0xE9, 0xDF, 0x1F, 0x18,
+    0x39, 0x14, 0x79, 0xE2, 0x22, 0x7E, 0xC7, 0xC9, 0x82, 0xDA, 0x7B, 0xE3, 0xBC, 0x2E, 0x2E, 0x8B,
+    0x65, 0xAE, 0x4F, 0x3E, 0xA6, 0x4B, 0xDA, 0xB7, 0x4B, 0x4A, 0x2A, 0x2D, 0xF9, 0xE0, 0xEA, 0x64,
+    0x53, 0x4B, 0x93, 0xCA, 0x91, 0x48, 0x8F, 0x64, 0x5D, 0x35, 0xFE, 0xB2, 0xFA, 0xEA, 0x20, 0xAE,
+    0x19, 0x12, 0x12, 0xDB, 0x7D, 0xF9, 0x01, 0xFF, 0xA7, 0xF1, 0x27, 0x90, 0x56, 0x89, 0x1D, 0xFC,
+    0x74, 0x9B, 0x6B, 0x64, 0x2A, 0x6D, 0x2A, 0xB5, 0x1E, 0x17, 0x26, 0x4E, 0x9A, 0xDD, 0xE9, 0x6F,
+    0xEE, 0xF5, 0x66, 0x7E, 0x26, 0xF4, 0x6A, 0xEE, 0x2F, 0x0E, 0x01, 0xFE, 0x34, 0x32, 0x92, 0x48,
+    0xA3, 0x06, 0x27, 0x9B, 0x1B, 0x22, 0x63, 0x91, 0x4F, 0xA5, 0x5B, 0x80, 0xD3, 0xC4, 0x10, 0xA3,
+    0xB2, 0xFF, 0xF5, 0x09, 0x2A, 0x4F, 0x3D, 0x2E, 0x27, 0x05, 0xD5, 0x7B, 0xB6, 0x31, 0xE7, 0x4E,
+    0xE3, 0x0A, 0x25, 0xD3, 0xA9, 0x5B, 0x55, 0x9C, 0x95, 0xDC, 0x38, 0xD0, 0xFF, 0x39, 0x05, 0x15,
+    0x16, 0xE2, 0xE8, 0xEE, 0xF8, 0xF9, 0xD1, 0x83, 0xEF, 0x4E, 0x45, 0xE2, 0xE2, 0xA0, 0x26, 0x5E,
+    0x7A, 0xC1, 0xE7, 0x59, 0x3F, 0x6E, 0x29, 0x9D, 0x6E, 0xBD, 0xDA, 0x6F, 0xBC, 0x1A, 0x2B, 0xDC,
+    0x0B, 0x86, 0x65, 0x70, 0x9B, 0xD7, 0xAB, 0x5E, 0x3D, 0xCD, 0x3A, 0xBB, 0x3A, 0x4A, 0xC3, 0x6D,
+    0xB9, 0x39, 0x8B, 0x6E, 0xB8, 0x91, 0x13, 0xCE, 0x9E, 0x8E, 0x8A, 0x45, 0xF5, 0x73, 0x83, 0x2A,
+    0x1D, 0xAD, 0x44, 0x36, 0xFA, 0xA8, 0x0B, 0x7E, 0x94, 0xC7, 0xD5, 0x6E, 0xFD, 0xC8, 0x6C, 0xC5,
+    0xFA, 0xE0, 0x8F, 0xBD, 0x9A, 0xA9, 0x8E, 0x1A, 0xB3, 0x26, 0xDA, 0x66, 0xE3, 0x46, 0x5B, 0x50,
+    0x59, 0x70, 0x03, 0xAB, 0x3D, 0x2B, 0xA5, 0xC7, 0x41, 0x12, 0x4B, 0xA9, 0xBA, 0xE5, 0x32, 0xE2,
+    0x54, 0x6B, 0x10, 0xED, 0x91, 0x92, 0x1E, 0xA1, 0x59, 0x25, 0xB9, 0x86, 0xF9, 0x21, 0x3E, 0x15,
+    0xD8, 0x50, 0xD4, 0x45, 0xCC, 0xA8, 0x2F, 0xC9, 0xFA, 0x60, 0xC9, 0x81, 0xC1, 0x71, 0xC9, 0x89,
+    0x08, 0x55, 0xBC, 0x38, 0x38, 0xB0, 0xFC, 0x14, 0x21, 0x75, 0x2C, 0x5F, 0xD5, 0x81, 0x55, 0x15,
+    0x53, 0xD4, 0xBB, 0x62, 0x66, 0x23, 0x7A, 0x76, 0x69, 0x93, 0x24, 0xA5, 0x00, 0x25, 0x10, 0xA9,
+    0x42, 0xEA, 0x6C, 0x5A, 0x9E, 0x4E, 0xCA, 0xC6, 0x5E, 0xA3, 0x9A, 0x95, 0xA3, 0xCA, 0x28, 0x26,
+    0x6B, 0xBA, 0x4B, 0xD8, 0x12, 0x23, 0x7D, 0x9C, 0x8D, 0x52, 0x18, 0x8A, 0x27, 0x65, 0xE1, 0x9B,
+    0x05, 0xA8, 0xC3, 0xDA, 0x55, 0x90, 0x01, 0x57, 0x01, 0x85, 0x25, 0x96, 0x2D, 0x93, 0x64, 0x04,
+    0x5E, 0xA6, 0x81, 0x5B, 0xF3, 0xEF, 0xC3, 0x6B, 0xA9, 0x7A, 0xCA, 0xEB, 0xCD, 0x77, 0x5F, 0x8D,
+    0xF0, 0xBD, 0x25, 0xA8, 0x5F, 0xD8, 0xED, 0x3F, 0x14, 0xC8, 0x4C, 0xF2, 0xAA, 0x91, 0x99, 0x28,
+    0x91, 0x42, 0xD5, 0xC8, 0x8A, 0x38, 0xBB, 0xB3, 0x78, 0xFD, 0x5C, 0xEA, 0x2E, 0x8D, 0x06, 0x01,
+    0xF5, 0xE7, 0x3E, 0xB3, 0x81, 0x1D, 0x04, 0xDD, 0x77, 0x42, 0xDD, 0x93, 0x18, 0xDE, 0x3A, 0x43,
+    0x19, 0xB3, 0x9E, 0x55, 0x46, 0xB7, 0xBE, 0xEB, 0x58, 0x38, 0x6A, 0xEE, 0x11, 0xED, 0x6E, 0x37,
+    0x6C, 0x4C, 0xA2, 0x05, 0xCF, 0x69, 0xAD, 0xD7, 0x38, 0x0F, 0x11, 0xFC, 0xCA, 0x02, 0xB0, 0xDB,
+    0x1A, 0x07, 0x61, 0xBA, 0xC8, 0xDD, 0x20, 0x5D, 0x38, 0x3D, 0x3A, 0x0B, 0x43, 0xCE, 0x1C, 0x31,
+    0x72, 0xEC, 0xF0, 0xFB, 0x1E, 0xD6, 0x3D, 0x72, 0xD0, 0x23, 0xAB, 0x1E, 0xD9, 0x1F, 0x90, 0x65,
+    0xC0, 0xEF, 0x09, 0xAD, 0xF4, 0xD7, 0x43, 0x8E, 0xC1, 0x77, 0xA8, 0xEB, 0x68, 0xFF, 0x9F, 0xA9,
+    0xC9, 0x26, 0x51, 0xC7, 0x2D, 0x5A, 0x03, 0x73, 0x2D, 0xD7, 0xFB, 0x14, 0x45, 0xD3, 0xFF, 0xD0,
+    0x39, 0xB3, 0xA4, 0x6C, 0xEB, 0xB9, 0x24, 0x51, 0x09, 0x9F, 0x31, 0xEB, 0xD1, 0x64, 0xD4, 0x79,
+    0xF4, 0x50, 0xF4, 0xAF, 0xA5, 0x9D, 0x7F, 0x09, 0x2C, 0x2A, 0xF4, 0x41, 0x75, 0xEA, 0xE4, 0xCC,
+    0x63, 0x33, 0xF1, 0x58, 0x05, 0x1C, 0x50, 0x4D, 0xEC, 0x86, 0x24, 0x85, 0x26, 0x09, 0x5E, 0xB2,
+    0xFE, 0x06, 0xA5, 0x55, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0xFE, 0xEC, 0x4B, 0x6A, 0x09, 0x4B, 0xB9,
+    0x19, 0x22, 0x58, 0x40, 0x77, 0x61, 0x01, 0x29, 0xF1, 0x9A, 0xE1, 0xF9, 0x5D, 0x57, 0x48, 0x64,
+    0x60, 0x78, 0x0C, 0x6C, 0x0C, 0xF0, 0x17, 0xD0, 0x0E, 0x19, 0x32, 0xF8, 0x3D, 0x3B, 0xC9, 0xC8,
+    0x40, 0x97, 0xEE, 0x45, 0xA2, 0x52, 0xA5, 0x22, 0x65, 0xCD, 0xD0, 0xBC, 0xE7, 0xE6, 0x0D, 0x19,
+    0xEB, 0x92, 0x21, 0x23, 0x6E, 0x23, 0x51, 0x09, 0x21, 0xB8, 0x6A, 0x5D, 0xD5, 0x50, 0xDB, 0x87,
+    0x73, 0xDF, 0x4B, 0xD2, 0x17, 0x35, 0x3F, 0x04, 0x5C, 0x5B, 0x7E, 0xF2, 0xF3, 0xE7, 0x73, 0xEE,
+    0x39, 0xDF, 0x77, 0x3E, 0x43, 0x02, 0x7E, 0x01, 0xBF, 0x85, 0xBF, 0x59, 0xE0, 0x64, 0x39, 0x0D,
+    0xDA, 0x24, 0xD2, 0xBD, 0x4C, 0x1E, 0x18, 0x51, 0xD6, 0x68, 0x34, 0xEC, 0xCD, 0xD8, 0x08, 0x53,
+    0xA3, 0xD6, 0x51, 0x22, 0x89, 0xF6, 0x88, 0x8A, 0x84, 0x4A, 0x8F, 0x4A, 0xFB, 0x86, 0x7B, 0xEB,
+    0x0E, 0xEA, 0x3E, 0x74, 0x90, 0xAA, 0x47, 0xFF, 0x27, 0x0E, 0x9C, 0x08, 0x58, 0x03, 0x78, 0x5B,
+    0x8E, 0xC1, 0xB9, 0x4B, 0x43, 0xEE, 0x95, 0x6E, 0x25, 0x33, 0x8D, 0xA1, 0x5F, 0xD8, 0x48, 0xC1,
+    0x76, 0x0A, 0x32, 0x90, 0x2D, 0x90, 0x64, 0x10, 0x15, 0x63, 0xD2, 0xD3, 0x9F, 0x1A, 0x36, 0x9A,
+    0xC8, 0x40, 0x91, 0xAE, 0xE5, 0x8D, 0xAD, 0xCC, 0x98, 0x38, 0xE4, 0xC4, 0xA2, 0x85, 0x41, 0xC7,
+    0x26, 0x72, 0x5B, 0xE8, 0xD6, 0x31, 0x1D, 0x7F, 0xB3, 0x5C, 0x5E, 0x8E, 0x76, 0x8C, 0x78, 0x5E,
+    0xC8, 0x71, 0xA9, 0x85, 0x69, 0xC4, 0x01, 0x51, 0x8F, 0xEA, 0x4F, 0xBE, 0x8D, 0x54, 0x84, 0x01,
+    0x9C, 0x7A, 0xBA, 0x83, 0x64, 0x47, 0xD1, 0x38, 0xAF, 0x57, 0xBC, 0xFD, 0xA8, 0xB3, 0xE6, 0x1D,
+    0x50, 0x13, 0x50, 0x31, 0x1A, 0x70, 0x30, 0x2F, 0x45, 0x89, 0xB9, 0x99, 0xBD, 0x7A, 0xAF, 0x37,
+    0xA8, 0x0E, 0xE5, 0x38, 0x8D, 0xD7, 0xC4, 0x7E, 0xD4, 0xD7, 0xF4, 0x33, 0xB5, 0xFE, 0x2B, 0xDB,
+    0x20, 0x3F, 0xE5, 0xE6, 0x0C, 0x4A, 0x25, 0xF2, 0x4B, 0x42, 0xBA, 0x9F, 0x61, 0x78, 0x73, 0x7E,
+    0x84, 0xE7, 0xC5, 0x65, 0xD1, 0x54, 0x6F, 0xAF, 0xAC, 0x83, 0xEF, 0xF7, 0x7E, 0xBC, 0x77, 0x69,
+    0xCE, 0x05, 0xA8, 0xD4, 0xFD, 0x1D, 0x41, 0x86, 0x3B, 0x97, 0x96, 0x61, 0x49, 0x68, 0x7F, 0xAD,
+    0x1C, 0x22, 0xCA, 0x4A, 0xFD, 0x78, 0x67, 0xC5, 0x23, 0xFA, 0x10, 0xED, 0xED, 0xD5, 0x28, 0xC1,
+    0x02, 0xFF, 0x59, 0x07, 0x7C, 0x71, 0x1B, 0x6A, 0x99, 0x29, 0x8C, 0xAE, 0x53, 0xD1, 0x70, 0xE5,
+    0x0A, 0x5E, 0x8E, 0xE6, 0x9B, 0x80, 0x1C, 0x4A, 0x65, 0x74, 0xCD, 0xA0, 0x46, 0x1F, 0x72, 0xB6,
+    0x69, 0x93, 0x15, 0xE4, 0xF2, 0xCF, 0xAD, 0x27, 0xB1, 0xA6, 0x67, 0xBF, 0x7D, 0xD9, 0x87, 0xA0,
+    0x56, 0x51, 0x11, 0x94, 0x58, 0xB4, 0xFC, 0xAC, 0x5B, 0x2E, 0xCE, 0x2E, 0x97, 0xF5, 0x53, 0x75,
+    0xDF, 0x1F, 0x53, 0x3B, 0xB8, 0xBB, 0x9A, 0x43, 0xD3, 0x13, 0x6A, 0x5D, 0x8A, 0x2C, 0x34, 0x17,
+    0x14, 0x95, 0xFD, 0x2B, 0xA1, 0xEF, 0x5E, 0xDB, 0xB0, 0xBD, 0x19, 0x57, 0xCD, 0x95, 0xD0, 0x3E,
+    0x6F, 0x76, 0x52, 0xBD, 0xE4, 0x7A, 0x8C, 0xC8, 0x24, 0x62, 0xC7, 0x78, 0xB9, 0x8A, 0xE6, 0x97,
+    0x3A, 0x8B, 0xFC, 0xF7, 0x62, 0xC7, 0xAE, 0x38, 0xEE, 0xDB, 0xAC, 0x32, 0x72, 0x6B, 0x0C, 0xCD,
+    0xB2, 0x97, 0x61, 0xFA, 0x0A, 0x8B, 0xE9, 0xF8, 0xC2, 0xBA, 0x55, 0x70, 0x4A, 0xB0, 0x64, 0xD0,
+    0x61, 0xF4, 0xEE, 0xAE, 0x45, 0x88, 0xEC, 0xE4, 0xF0, 0xEC, 0x91, 0x7B, 0x53, 0xDE, 0xD7, 0xF9,
+    0x5D, 0xD6, 0x39, 0x63, 0x35, 0x71, 0x49, 0xBC, 0xCB, 0x12, 0xC9, 0x23, 0x28, 0xE2, 0x11, 0x19,
+    0x21, 0x14, 0x85, 0x97, 0x77, 0xA1, 0x3F, 0xCF, 0x04, 0xD5, 0x90, 0x5C, 0x79, 0x90, 0xC2, 0x79,
+    0x9A, 0xEA, 0x9F, 0xC4, 0x8D, 0xF4, 0xA3, 0x29, 0x8D, 0xDD, 0x96, 0x9F, 0xE9, 0xD5, 0x83, 0x3C,
+    0x0C, 0xC5, 0x51, 0xDE, 0x1D, 0x88, 0x57, 0x85, 0x4E, 0x84, 0x39, 0x23, 0xD8, 0x20, 0x57, 0xB4,
+    0x55, 0xF4, 0x63, 0xF1, 0x2C, 0xD3, 0xFA, 0xAB, 0x23, 0x6A, 0x14, 0xA5, 0x41, 0x3E, 0x6D, 0xFB,
+    0xCE, 0x99, 0xB6, 0xBB, 0x8D, 0x43, 0x55, 0xD7, 0x3B, 0xCC, 0xBA, 0xB1, 0x78, 0xF1, 0x72, 0xA8,
+    0xE9, 0x31, 0x55, 0xDC, 0x2F, 0x1E, 0x49, 0x95, 0x79, 0x74, 0xFD, 0xB8, 0xE3, 0x17, 0xA0, 0xC4,
+    0x3E, 0x46, 0x37, 0xE7, 0x13, 0xFC, 0x70, 0xEB, 0xC2, 0x9C, 0x27, 0x7C, 0xFC, 0x55, 0x5F, 0x9A,
+    0xEE, 0x63, 0x6E, 0x49, 0x0A, 0xAF, 0x80, 0x3B, 0xC1, 0xB1, 0x02, 0xB7, 0x88, 0xCC, 0x17, 0x78,
+    0xEB, 0x09, 0xF0, 0x01, 0x10, 0x83, 0xAB, 0xE0, 0xC6, 0x71, 0xE7, 0x5D, 0x03, 0x51, 0xD8, 0xB2,
+    0x98, 0x98, 0x11, 0xEF, 0xB8, 0x90, 0xDB, 0xA5, 0xEA, 0x56, 0x2A, 0x7C, 0xA0, 0x9A, 0x4A, 0x5A,
+    0x9B, 0x29, 0x98, 0x6A, 0x31, 0x41, 0x31, 0x05, 0x7E, 0x06, 0xC9, 0x67, 0x8A, 0x00, 0x58, 0x01,
+    0x8F, 0x08, 0x66, 0xFB, 0xE6, 0xA5, 0x61, 0x2C, 0x0E, 0xB3, 0xB0, 0x23, 0x8E, 0xB2, 0x41, 0xE8,
+    0x1F, 0x51, 0x6B, 0x27, 0x64, 0x78, 0x5E, 0xDF, 0xD6, 0x2D, 0x2E, 0x16, 0x07, 0x59, 0xB7, 0xE3,
+    0x1D, 0xE5, 0x5C, 0xC8, 0x53, 0x1E, 0xBA, 0xD7, 0xC5, 0x44, 0xA9, 0x6F, 0xFA, 0x76, 0x01, 0x4A,
+    0xF5, 0x1E, 0xCE, 0x0E, 0xF0, 0x45, 0xB1, 0xA4, 0x95, 0x0B, 0x67, 0x9E, 0x7B, 0xCB, 0x12, 0x45,
+    0x2E, 0xBF, 0xCB, 0x42, 0xB9, 0x61, 0x82, 0x5E, 0xAA, 0x43, 0x8C, 0x0C, 0x28, 0xB5, 0x7C, 0x18,
+    0x5B, 0xDD, 0x2E, 0xDF, 0x73, 0xCD, 0xEC, 0xF2, 0x21, 0xCB, 0x96, 0xFD, 0x86, 0x52, 0x36, 0xC2,
+    0xAF, 0xC7, 0xB9, 0x29, 0x97, 0x42, 0xD9, 0x5B, 0x1D, 0x1F, 0x16, 0x64, 0x74, 0x21, 0x53, 0x7E,
+    0x54, 0x32, 0xC6, 0x16, 0x3E, 0xE6, 0x48, 0x59, 0x93, 0xB8, 0x77, 0xEF, 0xCD, 0x64, 0x09, 0x51,
+    0x3D, 0x10, 0x79, 0xA5, 0xDC, 0xB2, 0x12, 0x2F, 0x72, 0x9F, 0x20, 0x2B, 0x66, 0x99, 0xFD, 0x98,
+    0x87, 0xDD, 0xB7, 0xF7, 0x3C, 0xC9, 0x43, 0x0B, 0x5C, 0x40, 0x40, 0x13, 0xC5, 0xCE, 0x2C, 0xF6,
+    0x02, 0xCB, 0x98, 0xCE, 0xE1, 0xB1, 0x4D, 0xFF, 0xCD, 0x33, 0xD2, 0x8B, 0x5C, 0xF6, 0x6E, 0xED,
+    0xE7, 0x5E, 0x31, 0x00, 0xB3, 0xAB, 0x88, 0x36, 0xD9, 0x5D, 0x74, 0x24, 0x0F, 0x0D, 0xDA, 0xF7,
+    0xEE, 0x6F, 0xB1, 0xF1, 0xDE, 0x8E, 0xAE, 0x30, 0xD2, 0x68, 0x11, 0x6A, 0x9B, 0xBD, 0xBD, 0x84,
+    0xD7, 0xFC, 0xE7, 0x5C, 0xAC, 0x43, 0x13, 0xB3, 0x3C, 0x47, 0xA7, 0x5F, 0xAE, 0x0B, 0xAC, 0xF1,
+    0xDF, 0x07, 0xE6, 0x37, 0x9C, 0x97, 0xAC, 0x2A, 0x9E, 0xF1, 0xE4, 0x38, 0xB6, 0xFA, 0xC3, 0xA1,
+    0x5A, 0x7E, 0x6A, 0x56, 0xBC, 0x87, 0xB9, 0xF4, 0xA2, 0x3E, 0xAB, 0x92, 0xA3, 0x07, 0xBF, 0x64,
+    0x58, 0x82, 0xCB, 0x9F, 0xE2, 0x12, 0xB2, 0x38, 0xFE, 0x12, 0xFA, 0x91, 0x25, 0x7D, 0xF9, 0xD4,
+    0x3D, 0x5B, 0x87, 0x5A, 0x8F, 0x1A, 0x59, 0xBE, 0xA3, 0x32, 0xE8, 0xC8, 0x9E, 0x09, 0x9F, 0x29,
+    0x74, 0x31, 0xA7, 0xED, 0x84, 0x35, 0x3E, 0xF1, 0x44, 0x35, 0x3C, 0xAE, 0xD6, 0x92, 0xE7, 0xCE,
+    0x71, 0x68, 0x45, 0xCE, 0x28, 0x7D, 0x43, 0xCB, 0x3F, 0xAD, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14,
+    0xFE, 0xE6, 0xC6, 0xF6, 0x0A, 0xAF, 0xC4, 0x52, 0x18, 0x81, 0x8C, 0xF0, 0xB4, 0x28, 0x48, 0x5E,
+    0x21, 0x51, 0x20, 0x64, 0xDF, 0xAC, 0xED, 0x82, 0x32, 0x2E, 0x12, 0x81, 0xD2, 0x40, 0x09, 0x95,
+    0x1B, 0x0A, 0x17, 0xE7, 0xBB, 0x8D, 0x53, 0xA4, 0x8C, 0x0B, 0x52, 0x27, 0x05, 0x96, 0xE0, 0x52,
+    0xB8, 0xA0, 0x49, 0x71, 0xBE, 0x1D, 0x48, 0x41, 0x81, 0x84, 0x36, 0x44, 0x82, 0x76, 0xA3, 0x20,
+    0x59, 0x72, 0xE3, 0xB1, 0xD8, 0x98, 0xB5, 0xBD, 0xB3, 0x8F, 0x37, 0x77, 0x71, 0x94, 0x44, 0xCA,
+    0x9F, 0xC4, 0x68, 0xDE, 0xDE, 0xDC, 0xEC, 0xCC, 0xFB, 0xBE, 0xF7, 0xBB, 0x00, 0xA0, 0x00, 0x9D,
+    0xE2, 0xB4, 0x90, 0xF9, 0x6D, 0x8C, 0x47, 0xDC, 0x08, 0x6A, 0x02, 0x72, 0x51, 0x39, 0xA1, 0x0C,
+    0x74, 0xE2, 0x67, 0x8F, 0x67, 0x0A, 0x5D, 0x4C, 0x6A, 0x72, 0x8A, 0x5C, 0x48, 0x4E, 0x90, 0xE3,
+    0xB3, 0x73, 0x90, 0x95, 0x38, 0x2D, 0x3A, 0x61, 0x0A, 0xB4, 0x78, 0xAF, 0xD0, 0x89, 0x34, 0xE8,
+    0x20, 0xC8, 0xA1, 0xBF, 0x10, 0x64, 0xA7, 0x1A, 0x60, 0x9A, 0x55, 0x26, 0x7E, 0x32, 0xCE, 0x6B,
+    0x22, 0x88, 0x9B, 0xD8, 0xE5, 0x97, 0x51, 0xC1, 0x97, 0xB2, 0x25, 0x2A, 0x1C, 0x16, 0x98, 0x30,
+    0x2B, 0x77, 0x5F, 0x29, 0x12, 0x59, 0x2A, 0xCD, 0x3A, 0x4E, 0x2C, 0xB4, 0xF1, 0x66, 0x4C, 0xE0,
+    0x75, 0xD5, 0x7F, 0x30, 0x75, 0xF9, 0xC8, 0x06, 0xB5, 0xBF, 0xBC, 0x8A, 0xE7, 0x1A, 0x30, 0x89,
+    0x55, 0x51, 0x56, 0x50, 0x15, 0x44, 0x05, 0xBC, 0xFB, 0x08, 0x44, 0xD0, 0x09, 0x7A, 0x54, 0x29,
+    0xA2, 0xAB, 0x45, 0x78, 0x58, 0x61, 0xB7, 0x8B, 0xE8, 0x46, 0x2A, 0xF7, 0x0A, 0xB8, 0x0A, 0xED,
+    0xAE, 0xC8, 0x6E, 0x10, 0xFD, 0x45, 0x74, 0x48, 0x64, 0x7B, 0xE4, 0xF9, 0x5B, 0xF6, 0xF5, 0x0C,
+    0xC4, 0x3F, 0x39, 0xD4, 0x02, 0xC4, 0xBF, 0x26, 0xDE, 0xE9, 0x44, 0x64, 0xE5, 0x11, 0x61, 0x21,
+    0xB0, 0x41, 0xDA, 0xC5, 0x46, 0x58, 0x48, 0x6A, 0xA0, 0xC8, 0x62, 0x6D, 0x87, 0xF5, 0x37, 0x2C,
+    0x54, 0xB0, 0x54, 0xA2, 0x6A, 0xD5, 0x8C, 0xBD, 0xC1, 0xD2, 0xD6, 0x94, 0x6B, 0x2F, 0xBC, 0xEE,
+    0x8A, 0x6A, 0x8A, 0x4D, 0xF5, 0xA6, 0x50, 0xCD, 0x62, 0x59, 0x92, 0x11, 0x50, 0x07, 0x21, 0xEF,
+    0xEC, 0xEC, 0x43, 0x58, 0x0C, 0x07, 0x20, 0x82, 0xCB, 0x0C, 0xC3, 0xCC, 0x89, 0x2A, 0xC8, 0x87,
+    0xFC, 0x3F, 0x65, 0x14, 0xC1, 0x6F, 0xA6, 0x77, 0x4C, 0x46, 0x4B, 0xD7, 0x2F, 0x9C, 0xB9, 0xAE,
+    0x95, 0x51, 0x44, 0xB5, 0xDE, 0x5E, 0xAD, 0x21, 0x2D, 0xA2, 0x3F, 0x53, 0x4D, 0x09, 0xD5, 0x7E,
+    0xC9, 0x8E, 0xEC, 0xDF, 0x24, 0xFA, 0x95, 0xE8, 0x4B, 0x66, 0xF6, 0xF6, 0x32, 0x9F, 0xA2, 0xB3,
+    0x78, 0x8E, 0xAF, 0x3A, 0x34, 0x55, 0xFB, 0x9D, 0x3B, 0xD4, 0x74, 0xB7, 0x3F, 0x63, 0xEF, 0xD1,
+    0x7D, 0x6A, 0x5A, 0x9E, 0x0F, 0x16, 0x23, 0xD6, 0x01, 0x32, 0x78, 0x6B, 0x7C, 0x72, 0xDA, 0xDF,
+    0xB5, 0xCD, 0xF5, 0x95, 0xB1, 0xDA, 0x4B, 0x20, 0x27, 0xC9, 0xFA, 0x25, 0xD0, 0xF4, 0xAF, 0x10,
+    0x71, 0x80, 0xD8, 0xB5, 0x13, 0x4B, 0x4B, 0x54, 0x47, 0x94, 0xAC, 0xE5, 0x2F, 0x07, 0x19, 0x60,
+    0xCC, 0xF1, 0xDC, 0xEB, 0x99, 0x51, 0x21, 0x4A, 0x45, 0x8D, 0xD9, 0xF4, 0xA5, 0x08, 0x1F, 0x92,
+    0x25, 0xBA, 0x73, 0x72, 0x71, 0xCC, 0xD2, 0x7D, 0x2D, 0xA9, 0x8C, 0xC8, 0xF0, 0x92, 0x11, 0x4E,
+    0xFA, 0x0C, 0xD6, 0xA3, 0x87, 0x1C, 0xAD, 0x79, 0xEF, 0x7E, 0x59, 0x21, 0x28, 0x5E, 0xEC, 0x92,
+    0x4F, 0x10, 0x25, 0xA2, 0x80, 0xCA, 0x39, 0xBF, 0x7D, 0xE6, 0xAE, 0xB6, 0x15, 0xB4, 0xF5, 0xAA,
+    0x3F, 0x7E, 0xCC, 0xE4, 0x55, 0x21, 0xA5, 0x19, 0xDA, 0x56, 0xCD, 0x0A, 0x9F, 0x8C, 0x06, 0xE2,
+    0x3C, 0x3A, 0xB8, 0x72, 0xBF, 0xA3, 0x69, 0x6F, 0xFF, 0xC2, 0x06, 0x38, 0xB1, 0x14, 0x15, 0x71,
+    0x09, 0x4E, 0x6E, 0xC4, 0x29, 0x5A, 0x1C, 0xBB, 0xF9, 0xF0, 0xA9, 0xF8, 0xF9, 0x31, 0xFB, 0x23,
+    0x27, 0x8E, 0xE3, 0xFC, 0xA8, 0xC2, 0x63, 0xAC, 0x72, 0x59, 0x81, 0x8B, 0x5C, 0xFA, 0xCC, 0x35,
+    0x9F, 0xAE, 0xF6, 0x40, 0xD6, 0x89, 0xEC, 0x5E, 0x8D, 0x6E, 0xD8, 0xDC, 0x62, 0x2E, 0x94, 0xB3,
+    0x24, 0x53, 0xB4, 0x05, 0x2E, 0x4B, 0x59, 0x42, 0x97, 0x32, 0xAF, 0xCE, 0x54, 0x89, 0xDD, 0x01,
+    0x23, 0x96, 0xBD, 0xAB, 0xE9, 0xF0, 0x7D, 0x51, 0xAD, 0x87, 0x05, 0xD1, 0x32, 0xB9, 0x16, 0x95,
+    0x58, 0x31, 0x88, 0x5B, 0xA7, 0x15, 0xDB, 0x12, 0x8F, 0x4F, 0x0B, 0xCB, 0xF5, 0xC6, 0x35, 0x12,
+    0x36, 0xF8, 0xDF, 0x08, 0x01, 0xB7, 0xE7, 0x43, 0xCA, 0xD9, 0xE2, 0x47, 0x49, 0xB7, 0xB6, 0xA6,
+    0xE8, 0xC1, 0xDD, 0x66, 0x3D, 0xDC, 0x4B, 0xBA, 0xEB, 0xE1, 0x03, 0x72, 0x31, 0xE5, 0x99, 0xF3,
+    0x64, 0x06, 0x71, 0x76, 0x85, 0xAC, 0xE7, 0x22, 0x39, 0x6A, 0x8A, 0x9D, 0xD2, 0x63, 0x4E, 0x3F,
+    0x3C, 0xC5, 0x63, 0xAA, 0x9F, 0xB4, 0x58, 0xB5, 0xE6, 0xF8, 0x35, 0xC9, 0x4C, 0xC4, 0x04, 0xB8,
+    0xA7, 0x70, 0x20, 0x10, 0xD8, 0x37, 0xBF, 0x53, 0x46, 0xD7, 0x3A, 0x59, 0x2B, 0x09, 0x6A, 0x93,
+    0xFA, 0x9C, 0xCB, 0x54, 0xB2, 0xE4, 0x22, 0xFB, 0x1B, 0xD8, 0x40, 0x98, 0x63, 0x88, 0xE9, 0xAD,
+    0xB1, 0x9A, 0xA3, 0x43, 0x6A, 0x16, 0xD5, 0x5E, 0x3A, 0xFC, 0x36, 0xE0, 0x87, 0xA6, 0x3F, 0x7C,
+    0x2B, 0xCA, 0x27, 0x16, 0x10, 0xFE, 0x72, 0x5A, 0x69, 0xF2, 0x61, 0xF1, 0xCD, 0xCE, 0x77, 0x4A,
+    0xE7, 0x95, 0x73, 0xB0, 0xC6, 0x36, 0x3F, 0x33, 0x44, 0x7F, 0x0B, 0xD9, 0xC8, 0xDC, 0x34, 0xDB,
+    0x9A, 0x94, 0x4C, 0x24, 0xE2, 0x2A, 0xE1, 0xDC, 0x10, 0xB5, 0xDC, 0x0E, 0x6C, 0x44, 0x51, 0xFE,
+    0x9E, 0xD3, 0x26, 0x28, 0xB2, 0xFD, 0x2C, 0xA1, 0x91, 0x07, 0x4B, 0xAC, 0x1D, 0x03, 0xE4, 0xF5,
+    0x3B, 0xAE, 0x03, 0xCE, 0x98, 0x73, 0xC9, 0x2B, 0xFA, 0x85, 0x47, 0x90, 0x8E, 0xD2, 0xFA, 0x20,
+    0x0D, 0xCC, 0xD9, 0x77, 0xA2, 0xC6, 0x40, 0x23, 0x3E, 0x6F, 0xC2, 0x7B, 0xB6, 0x55, 0xD6, 0x70,
+    0x1A, 0xFA, 0xBC, 0x89, 0xEE, 0x9D, 0xDC, 0xAA, 0x88, 0x1A, 0x4D, 0x74, 0x8D, 0xE8, 0x41, 0x29,
+    0x8F, 0xB9, 0x06, 0x7A, 0x09, 0x47, 0xAE, 0x18, 0xD9, 0x41, 0x39, 0xCA, 0xC5, 0x33, 0x2B, 0xB8,
+    0xEF, 0x86, 0x06, 0x2D, 0xB6, 0x72, 0x00, 0xB4, 0xD9, 0x86, 0x83, 0x5C, 0x72, 0xA7, 0x70, 0x2A,
+    0x69, 0x8B, 0x22, 0x4A, 0x3B, 0xB2, 0x88, 0x45, 0x15, 0x9A, 0x9E, 0xB4, 0xCA, 0xD4, 0x91, 0x09,
+    0x39, 0xF9, 0xE3, 0xA4, 0xC6, 0x6E, 0xF0, 0xF0, 0x73, 0x76, 0x16, 0x95, 0xC4, 0x5E, 0xAE, 0xD1,
+    0x48, 0x86, 0x64, 0x4F, 0x14, 0xBC, 0x95, 0x32, 0xB4, 0x2C, 0x65, 0xA5, 0xF2, 0xA8, 0xF0, 0xA8,
+    0x62, 0xA4, 0x5B, 0x64, 0x85, 0x4F, 0x3C, 0x0F, 0xD4, 0x38, 0x2E, 0x43, 0x13, 0xDD, 0x2D, 0x65,
+    0x31, 0x87, 0x2A, 0x30, 0xED, 0x96, 0x55, 0xE9, 0x20, 0xB0, 0x5A, 0x30, 0xC0, 0xE2, 0x47, 0xF4,
+    0xDB, 0xFC, 0x23, 0x6E, 0x92, 0x1B, 0x92, 0x46, 0xFD, 0xEC, 0x8F, 0xCA, 0xDF, 0x98, 0x71, 0x3F,
+    0x65, 0xBF, 0x8F, 0x6C, 0x98, 0x81, 0x95, 0x26, 0xE2, 0xE4, 0xB7, 0x81, 0x51, 0xDC, 0x9E, 0xCB,
+    0xC9, 0x4B, 0x9B, 0xDC, 0x76, 0xFA, 0x4F, 0xD4, 0x15, 0x17, 0x6F, 0xFD, 0xA2, 0x87, 0x70, 0x98,
+    0xDD, 0x59, 0xA1, 0xFA, 0x9B, 0x8B, 0xE3, 0xF2, 0x9D, 0xF4, 0x0D, 0x24, 0x7A, 0xFC, 0x50, 0xBE,
+    0x83, 0xAB, 0x44, 0x94, 0x7C, 0xB4, 0x7E, 0x76, 0xFE, 0xEC, 0xE6, 0xA4, 0xD1, 0x97, 0x39, 0x40,
+    0x6A, 0xB9, 0x8C, 0x37, 0xBF, 0xF7, 0x70, 0xB0, 0x7E, 0x0A, 0xAB, 0x44, 0xA9, 0x96, 0xEC, 0x82,
+    0xAC, 0xF9, 0x0B, 0xF8, 0xDC, 0xF1, 0x1F, 0xA5, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0xFE, 0xEC,
+    0xE1, 0xB0, 0x90, 0x25, 0x86, 0xE2, 0xAE, 0x89, 0x84, 0xDC, 0x52, 0xC0, 0xB9, 0x4D, 0xB1, 0xF6,
+    0x38, 0xBA, 0xE2, 0x8A, 0x34, 0x29, 0x8E, 0x7F, 0x22, 0xCD, 0xB5, 0x14, 0xDE, 0xB5, 0x51, 0x84,
+    0xAE, 0xA0, 0x80, 0x86, 0x3A, 0x14, 0x14, 0xA1, 0x4A, 0x43, 0x41, 0xB1, 0xB9, 0x75, 0xD8, 0xE2,
+    0x0A, 0x0A, 0x26, 0x3F, 0x44, 0x3A, 0x32, 0x90, 0x48, 0x48, 0x50, 0xDC, 0x1C, 0x38, 0xC2, 0x77,
+    0x19, 0xFB, 0xF1, 0x66, 0x77, 0x6F, 0xEF, 0x90, 0x20, 0x12, 0x30, 0x7E, 0x9A, 0xF1, 0x8F, 0xE7,
+    0xF7, 0xCD, 0xBC, 0xF9, 0xBE, 0x37, 0xB9, 0x3C, 0x3A, 0xB9, 0x03, 0x6E, 0x4E, 0xC9, 0xB9, 0xBD,
+    0xD4, 0x55, 0xC5, 0xE6, 0xC8, 0xB7, 0xB2, 0x1C, 0x8F, 0xEF, 0x41, 0x1E, 0x69, 0xB8, 0x31, 0x92,
+    0x23, 0x1D, 0x74, 0x3C, 0x1C, 0xE8, 0x90, 0x87, 0x74, 0x57, 0x87, 0xED, 0x04, 0x2A, 0x32, 0xC2,
+    0xFA, 0xC1, 0x0A, 0x3B, 0x83, 0x8A, 0x79, 0x00, 0x26, 0x78, 0x43, 0x1A, 0x50, 0x8F, 0x84, 0x9A,
+    0x90, 0x5A, 0x5C, 0xE9, 0x3D, 0x08, 0xDE, 0x09, 0x0F, 0x74, 0x76, 0x28, 0x9E, 0x1A, 0x2C, 0x1F,
+    0xC5, 0xA3, 0x66, 0x34, 0x12, 0x73, 0xDF, 0x1D, 0x35, 0xA3, 0x71, 0x74, 0xA4, 0xCB, 0x49, 0x5C,
+    0xA3, 0xC3, 0xAC, 0x96, 0x16, 0x5F, 0x2E, 0x9C, 0x24, 0xA0, 0x1A, 0x90, 0x15, 0xBA, 0x5C, 0xFE,
+    0x85, 0xB0, 0x85, 0x60, 0xB3, 0x17, 0x16, 0x99, 0x95, 0xC5, 0xDA, 0x9B, 0x6C, 0xD8, 0x36, 0x93,
+    0x46, 0x51, 0xAD, 0xA8, 0x50, 0x3D, 0x82, 0x1B, 0xFE, 0xBF, 0x0F, 0x50, 0x15, 0x93, 0xB6, 0x94,
+    0xC5, 0x2A, 0x8C, 0xC5, 0xD7, 0xD8, 0x46, 0x5C, 0x87, 0x06, 0x5F, 0xE1, 0x3D, 0xC8, 0x42, 0x68,
+    0x58, 0xE1, 0x40, 0xEC, 0xB7, 0x82, 0x4A, 0x1B, 0xC4, 0x8C, 0xD0, 0x01, 0xBC, 0x80, 0x0A, 0xB8,
+    0x72, 0xFE, 0x41, 0xD8, 0x01, 0xAE, 0x42, 0xAE, 0x0A, 0x79, 0xBB, 0x89, 0x8E, 0x9B, 0x80, 0x0C,
+    0x2A, 0x8B, 0xB4, 0x45, 0x3C, 0x40, 0xF0, 0x03, 0x11, 0x94, 0xB2, 0x72, 0x4E, 0x91, 0xAD, 0xDA,
+    0x14, 0x98, 0x82, 0x61, 0x78, 0x6D, 0x39, 0xD0, 0x7E, 0x21, 0x9E, 0x36, 0xD2, 0x2D, 0x96, 0x55,
+    0x08, 0x2A, 0x12, 0xAA, 0xC7, 0xB3, 0x0F, 0xDB, 0x59, 0x83, 0x73, 0x54, 0xCD, 0x58, 0xA1, 0x83,
+    0xF4, 0x63, 0xB0, 0x07, 0xBC, 0x7D, 0x35, 0xCE, 0xC2, 0x1F, 0xC0, 0xE9, 0x2D, 0xA4, 0x16, 0x3D,
+    0x5E, 0x9A, 0xF2, 0x10, 0x01, 0xF0, 0x2E, 0x60, 0x7D, 0x50, 0x2C, 0xE2, 0xF3, 0x6D, 0x03, 0x86,
+    0x72, 0x3E, 0x25, 0x9C, 0x03, 0xB5, 0xBE, 0xDD, 0x53, 0xD4, 0x12, 0x3D, 0x21, 0x2A, 0xA2, 0xC2,
+    0x26, 0xCB, 0x6C, 0x84, 0x26, 0x13, 0x9A, 0x6D, 0x24, 0x9A, 0x32, 0xF2, 0x36, 0xDE, 0x75, 0x95,
+    0x4E, 0x34, 0x92, 0xC6, 0x5B, 0x5A, 0x33, 0x98, 0x5F, 0xF2, 0xB2, 0x71, 0xE4, 0xB5, 0xC9, 0xBF,
+    0xB1, 0x3D, 0x49, 0x3D, 0x5B, 0x42, 0x7D, 0x5C, 0x67, 0x68, 0x85, 0x96, 0xC5, 0x08, 0x36, 0x6A,
+    0x12, 0x94, 0x81, 0x8D, 0x1E, 0x27, 0xB6, 0xD2, 0x8B, 0x38, 0x37, 0xAF, 0xF5, 0x91, 0x4D, 0x6B,
+    0xEE, 0xB0, 0x4C, 0x8A, 0xDD, 0x8C, 0x9B, 0x56, 0x89, 0xC6, 0x49, 0x61, 0xCB, 0x8B, 0x49, 0x6F,
+    0x71, 0x30, 0x45, 0x2F, 0x88, 0x34, 0x36, 0x90, 0x60, 0x7B, 0x3B, 0xCF, 0xF2, 0x0C, 0xFE, 0x1A,
+    0xF1, 0x55, 0xAE, 0xAE, 0x71, 0x51, 0x35, 0x95, 0x5E, 0x05, 0xCA, 0xE3, 0xFB, 0x1D, 0xB3, 0xD0,
+    0x5D, 0xB9, 0x75, 0x79, 0xF5, 0x17, 0x81, 0xB6, 0x17, 0xBF, 0x67, 0x59, 0x36, 0x19, 0x1D, 0x8E,
+    0x6E, 0xFE, 0x35, 0xC4, 0x7A, 0x99, 0x3E, 0x97, 0x9E, 0x67, 0xC2, 0x53, 0x94, 0x03, 0x23, 0x68,
+    0xF9, 0xED, 0x77, 0xBC, 0x35, 0xE9, 0x94, 0x9F, 0x66, 0xFC, 0x3A, 0x24, 0xCF, 0x4A, 0x7E, 0xED,
+    0x37, 0xD0, 0x83, 0x78, 0x36, 0xAC, 0x9E, 0x82, 0xC5, 0x37, 0xB7, 0x51, 0x60, 0xE6, 0x93, 0x4D,
+    0xAC, 0x00, 0x55, 0x51, 0x1B, 0x7A, 0x6F, 0xE9, 0xBD, 0xBD, 0x0E, 0x22, 0x1F, 0xFB, 0x2A, 0xD6,
+    0x8D, 0x89, 0x01, 0x76, 0xC8, 0xD8, 0xA5, 0x00, 0x73, 0x90, 0xF7, 0x14, 0xB9, 0x45, 0x62, 0x3C,
+    0x11, 0x66, 0x36, 0xE8, 0x79, 0x42, 0xC9, 0x0D, 0x44, 0x8E, 0xC3, 0xB3, 0x43, 0x83, 0xC0, 0x2C,
+    0x7C, 0x36, 0xCF, 0x03, 0xEC, 0xA1, 0xAB, 0x90, 0x25, 0x26, 0xD9, 0x75, 0xD1, 0x43, 0x62, 0x26,
+    0xD9, 0x71, 0x7A, 0x98, 0xCA, 0x5F, 0xBF, 0x9D, 0x9F, 0x9E, 0xD9, 0x41, 0x39, 0x75, 0x40, 0xD2,
+    0xD0, 0xDC, 0xA5, 0x27, 0xC4, 0xF4, 0xDE, 0x40, 0xA8, 0x39, 0x87, 0x4B, 0xDA, 0xF8, 0xC9, 0x1F,
+    0x1B, 0x45, 0xF3, 0x76, 0x9C, 0x89, 0x47, 0x3A, 0xCF, 0xC4, 0xCF, 0x46, 0x4D, 0xC4, 0x1F, 0x56,
+    0x6D, 0x14, 0xF2, 0xC0, 0x8A, 0x07, 0x43, 0xD0, 0x56, 0xCD, 0x38, 0xED, 0x92, 0xEB, 0x14, 0x3D,
+    0x7C, 0xF9, 0x93, 0x1D, 0xA6, 0x53, 0x75, 0xFB, 0xAE, 0x7C, 0x46, 0xF3, 0xAE, 0xB2, 0x83, 0x74,
+    0xEA, 0x1B, 0x4A, 0xEC, 0x22, 0x11, 0x18, 0xE0, 0x29, 0x23, 0xD7, 0x92, 0xD9, 0x7B, 0x45, 0x74,
+    0xFE, 0x98, 0xE8, 0xC0, 0xB1, 0xC0, 0x58, 0xCA, 0x95, 0x17, 0x68, 0x68, 0x4A, 0x9F, 0x63, 0xA6,
+    0xBD, 0xCF, 0xC4, 0xBA, 0x6D, 0x21, 0x4F, 0x1A, 0xB9, 0xDB, 0x45, 0x0F, 0x28, 0x68, 0x67, 0x66,
+    0x9C, 0xBA, 0xE4, 0xFA, 0xF1, 0xC7, 0xF3, 0xB3, 0xDF, 0xEC, 0x30, 0x99, 0xAA, 0x4F, 0x48, 0xFE,
+    0xC8, 0x33, 0x51, 0x96, 0x62, 0x57, 0x35, 0x84, 0x37, 0x03, 0x23, 0xEF, 0x82, 0x6B, 0x47, 0x02,
+    0xBC, 0xB5, 0x8E, 0x91, 0x0F, 0x2C, 0x47, 0xD1, 0x8E, 0x65, 0xD1, 0x66, 0xC2, 0xB4, 0xF2, 0xC0,
+    0xA8, 0xA4, 0x76, 0xD5, 0x62, 0xD7, 0x58, 0x35, 0xF7, 0x98, 0xEC, 0xD1, 0xE7, 0x17, 0xCE, 0x82,
+    0x9C, 0xDA, 0x7D, 0xA4, 0xB3, 0x4C, 0x3C, 0xD3, 0x39, 0xCF, 0xD6, 0x28, 0x76, 0xFD, 0x97, 0xE9,
+    0xE0, 0xEA, 0xA7, 0x3A, 0x24, 0xEE, 0x95, 0x29, 0x06, 0xD7, 0xCC, 0x01, 0xD5, 0x6A, 0x23, 0x22,
+    0xB2, 0x50, 0xA4, 0x2F, 0xAD, 0x1D, 0xAF, 0x0F, 0x9E, 0x48, 0xB5, 0x3C, 0x9D, 0xD5, 0x15, 0xD4,
+    0x8E, 0x45, 0xC5, 0xD9, 0x75, 0x39, 0xC4, 0x49, 0x07, 0xAE, 0xD2, 0x50, 0xB2, 0x8D, 0x9C, 0x22,
+    0xB2, 0x15, 0xB3, 0x6D, 0x46, 0x1D, 0xF6, 0x87, 0x65, 0x81, 0x0A, 0x42, 0x5E, 0x03, 0x9D, 0x17,
+    0x94, 0xB0, 0x0F, 0xA8, 0xCB, 0xA3, 0x27, 0x4D, 0x5E, 0x8A, 0xDF, 0x5F, 0x1C, 0x2A, 0x7A, 0x40,
+    0x5D, 0xC8, 0x4C, 0x2C, 0x36, 0x21, 0x7E, 0x61, 0xB1, 0x50, 0x8D, 0xB8, 0xFD, 0xDF, 0xA0, 0xAF,
+    0x05, 0xD7, 0xCE, 0x9C, 0xA4, 0x62, 0xA5, 0xA6, 0x7F, 0x02, 0xCD, 0x30, 0x0D, 0x3A, 0x61, 0x63,
+    0x93, 0xAC, 0xEB, 0x1D, 0xF6, 0x9F, 0xB3, 0xAA, 0x06, 0x78, 0x48, 0xDE, 0x6C, 0xED, 0x13, 0xA3,
+    0x58, 0x54, 0x8C, 0xC9, 0x27, 0x8B, 0x58, 0xDC, 0x2B, 0xCD, 0x79, 0x65, 0xD0, 0x84, 0x95, 0x1C,
+    0x13, 0xD5, 0xC1, 0xEC, 0x74, 0xB9, 0xD2, 0x56, 0x98, 0xB4, 0x98, 0x88, 0x36, 0x36, 0x6B, 0x3D,
+    0xF9, 0x5A, 0xCD, 0x55, 0xD8, 0xF0, 0x51, 0xC5, 0x67, 0x49, 0xC9, 0xFB, 0xDC, 0xEF, 0xD7, 0x82,
+    0xB5, 0x18, 0x71, 0x61, 0xF6, 0x5F, 0xB1, 0x6F, 0xB6, 0xDE, 0x0F, 0x89, 0xE5, 0xC9, 0x90, 0xE4,
+    0x3C, 0x26, 0xD7, 0x0B, 0x8E, 0xC0, 0xDD, 0x8B, 0x4F, 0x73, 0xC4, 0x64, 0x26, 0xBE, 0xAB, 0x3C,
+    0x95, 0x94, 0x3F, 0x8B, 0x18, 0xFA, 0xEC, 0x4E, 0xE2, 0xFF, 0x60, 0x70, 0x1A, 0x02, 0x96, 0x37,
+    0x2D, 0xC1, 0x4E, 0xE3, 0xE7, 0xAC, 0xF3, 0xE3, 0x1D, 0x53, 0x7D, 0x74, 0x62, 0xB9, 0xD8, 0x94,
+    0xE2, 0xEC, 0x33, 0xF9, 0x7D, 0xCF, 0x87, 0x00, 0x51, 0xCB, 0x29, 0xEA, 0xC3, 0x3E, 0x66, 0xC8,
+    0x91, 0x3F, 0x7F, 0xBC, 0x6A, 0x17, 0xC5, 0x37, 0x19, 0x90, 0x52, 0xB3, 0x1D, 0x9A, 0xED, 0xC0,
+    0xB2, 0xE5, 0xBC, 0x3E, 0xD2, 0xBC, 0x61, 0xBE, 0xDF, 0xB1, 0x6A, 0xA7, 0x55, 0x3B, 0x9D, 0xDA,
+    0x71, 0xD5, 0x2D, 0x4F, 0xA0, 0xA0, 0x10, 0x4D, 0x5C, 0x4B, 0x5F, 0x90, 0xA6, 0x69, 0x9F, 0x3E,
+    0x4E, 0xB9, 0x30, 0xA9, 0xC5, 0xB5, 0x3E, 0xA7, 0xFE, 0x6B, 0xFB, 0x13, 0xAD, 0x55, 0xB1, 0x6E,
+    0x1D, 0x45, 0x14, 0x3D, 0xBB, 0x23, 0x58, 0xE1, 0x95, 0x18, 0x17, 0x89, 0x90, 0xB0, 0xF0, 0x36,
+    0x14, 0x08, 0x09, 0xEF, 0x0F, 0xD8, 0x9E, 0x51, 0x1E, 0x55, 0x28, 0x4C, 0x61, 0xFE, 0x80, 0x82,
+    0x0E, 0x4A, 0x17, 0x8E, 0xDF, 0x8A, 0x7C, 0x00, 0xF9, 0x03, 0xD2, 0x53, 0x84, 0x22, 0x85, 0x8B,
+    0x97, 0xB7, 0x93, 0xF8, 0x03, 0xB2, 0x8A, 0x91, 0x5C, 0x66, 0xB0, 0xA9, 0xA0, 0xF0, 0x40, 0x16,
+    0xB1, 0x38, 0xFB, 0xF6, 0x72, 0x76, 0xFD, 0x1C, 0x3B, 0x51, 0x12, 0x44, 0xCC, 0xBC, 0xD5, 0x7B,
+    0xBA, 0x7A, 0x3B, 0xF7, 0xCC, 0xB9, 0xF7, 0x9C, 0x3B, 0x00, 0x54, 0x0B, 0xD5, 0x40, 0xD5, 0x48,
+    0x02, 0xD2, 0x80, 0x85, 0x5B, 0x38, 0x5D, 0x59, 0x87, 0x5C, 0xDC, 0x4A, 0xEC, 0x57, 0xA2, 0xC0,
+    0x67, 0x5D, 0x05, 0x23, 0x95, 0x11, 0xD7, 0x7F, 0x8F, 0x82, 0x19, 0xD5, 0x66, 0xD4, 0x98, 0x51,
+    0x3B, 0xBE, 0xD9, 0xF2, 0xE5, 0xAB, 0xD6, 0xB8, 0xBC, 0x30, 0x76, 0x8C, 0x12, 0x9B, 0x8C, 0xF3,
+    0x49, 0x3E, 0xCB, 0x7F, 0xCA, 0x91, 0xC3, 0x0C, 0x9F, 0xB1, 0xBD, 0x12, 0xD9, 0xEC, 0xB3, 0x22,
+    0xE9, 0x10, 0xF1, 0xFD, 0x6F, 0xDE, 0x04, 0xE3, 0xCB, 0xB7, 0x37, 0xBE, 0x2B, 0xA4, 0xD0, 0x0E,
+    0x05, 0xA3, 0x69, 0xC8, 0x67, 0xE9, 0x9F, 0x71, 0xC0, 0x84, 0xE9, 0xB5, 0x53, 0x21, 0x9A, 0x01,
+    0x91, 0x05, 0xEE, 0x02, 0x1A, 0x88, 0xFD, 0x29, 0xC2, 0x26, 0x22, 0x69, 0x61, 0xC4, 0xA6, 0x7E,
+    0x11, 0xCC, 0xC2, 0xDD, 0x28, 0x6F, 0x41, 0x49, 0x8D, 0x54, 0x02, 0xFF, 0x2C, 0x10, 0xB7, 0x69,
+    0x91, 0xDF, 0x17, 0x69, 0x8C, 0x08, 0xEE, 0x74, 0x76, 0xD8, 0x77, 0x05, 0xCA, 0x61, 0x0B, 0xBA,
+    0x8F, 0xF2, 0x5A, 0xFF, 0x00, 0x16, 0xE7, 0x6F, 0xA4, 0x2D, 0x12, 0xDF, 0x75, 0x46, 0xEE, 0x97,
+    0x43, 0xFE, 0x77, 0xD1, 0x17, 0x0E, 0x52, 0x61, 0x4D, 0xDB, 0x39, 0x27, 0xBC, 0x65, 0x91, 0x89,
+    0xEB, 0x11, 0xA6, 0xD1, 0x80, 0x47, 0x58, 0xEE, 0xED, 0x0F, 0x81, 0x52, 0x48, 0xBA, 0x61, 0x4A,
+    0xB7, 0x1B, 0xB7, 0x99, 0xC8, 0x4D, 0x91, 0xB0, 0x20, 0xBF, 0xCC, 0x77, 0xA6, 0x36, 0x6E, 0x49,
+    0x6C, 0x25, 0xE1, 0xA6, 0x58, 0xEC, 0xC9, 0x8F, 0x7A, 0x38, 0x6C, 0xE9, 0xB0, 0xA3, 0x8F, 0x8F,
+    0xA4, 0x5D, 0xEA, 0xDE, 0x24, 0xFF, 0x12, 0xF3, 0xF3, 0x74, 0xD1, 0x84, 0x7F, 0x39, 0x44, 0xB7,
+    0x07, 0xA8, 0x97, 0x70, 0x7A, 0x20, 0x3E, 0x61, 0x5D, 0xB1, 0xE0, 0xD1, 0x20, 0x2E, 0xBE, 0x42,
+    0xF6, 0x35, 0x30, 0xE6, 0x8E, 0x40, 0xCC, 0x4B, 0x51, 0x5B, 0x8E, 0xAB, 0x7B, 0x4D, 0xDC, 0x21,
+    0x2D, 0xB0, 0x88, 0xD7, 0x50, 0x1B, 0x8B, 0x3C, 0x16, 0xF9, 0x4B, 0xD8, 0x31, 0x1E, 0x36, 0xB7,
+    0x48, 0x2B, 0xC4, 0xAC, 0x2F, 0x3B, 0x6B, 0x2C, 0x74, 0x35, 0x14, 0xBB, 0x0F, 0x0A, 0x68, 0xD6,
+    0xBF, 0x02, 0x6E, 0x00, 0xEF, 0x39, 0xA4, 0x1E, 0xF1, 0x20, 0xDB, 0x2D, 0xAC, 0x43, 0x17, 0x46,
+    0xB4, 0x54, 0x6B, 0xE4, 0xAC, 0x2A, 0xD4, 0x58, 0xBF, 0xAD, 0x5B, 0x25, 0xD6, 0x63, 0x8C, 0x25,
+    0x97, 0x30, 0xA1, 0xFD, 0x10, 0x93, 0x49, 0x4F, 0xBB, 0x07, 0x79, 0x67, 0x5E, 0xFA, 0x48, 0x44,
+    0x4E, 0xE1, 0x03, 0x35, 0x85, 0x7B, 0x67, 0xF0, 0xEA, 0x45, 0xF8, 0x6E, 0x80, 0x07, 0x56, 0x81,
+    0x6D, 0x3E, 0x91, 0x9F, 0x28, 0xBF, 0xA9, 0x3C, 0x4B, 0xD0, 0x57, 0x81, 0x88, 0xE7, 0xCF, 0xAF,
+    0x94, 0x19, 0x1F, 0xFB, 0x0A, 0x66, 0xA5, 0xB8, 0x9C, 0x12, 0x7C, 0x19, 0x33, 0x20, 0x29, 0xD8,
+    0x04, 0x5D, 0x68, 0x71, 0x32, 0x43, 0xAD, 0x64, 0x46, 0x4B, 0xB0, 0x89, 0x27, 0x85, 0x6E, 0x7B,
+    0xB9, 0x01, 0xBB, 0x15, 0xCC, 0x16, 0x3E, 0x98, 0x21, 0xBE, 0x8E, 0x67, 0x8B, 0x1E, 0xE8, 0xC6,
+    0xD6, 0x6C, 0x38, 0xBD, 0x1F, 0x54, 0xDD, 0x62, 0x46, 0xEF, 0x31, 0xD8, 0x0B, 0x2A, 0xB4, 0x68,
+    0x69, 0x4F, 0x2D, 0x6C, 0xB3, 0xF8, 0xB1, 0xD4, 0x09, 0x9B, 0xC8, 0xA5, 0x0E, 0x50, 0x06, 0xBD,
+    0x72, 0x96, 0x60, 0x4B, 0x1D, 0xB8, 0xB5, 0x6D, 0xB5, 0xEF, 0xD6, 0x57, 0x93, 0xA3, 0x6A, 0x6A,
+    0xE4, 0x50, 0xBA, 0xF4, 0xA9, 0x47, 0xF4, 0x79, 0xC4, 0x73, 0x94, 0x62, 0x81, 0xCB, 0xA0, 0xE1,
+    0x8B, 0x91, 0xB4, 0xE6, 0xA4, 0x78, 0x3D, 0x5A, 0xF4, 0xE9, 0x22, 0x58, 0xA8, 0x5C, 0x10, 0x77,
+    0x97, 0x42, 0xA3, 0x74, 0xB7, 0x33, 0x29, 0xCA, 0xF9, 0x2C, 0x60, 0x51, 0x89, 0x46, 0xC8, 0x55,
+    0x75, 0xE4, 0x76, 0xD6, 0xD2, 0x23, 0xE9, 0x72, 0xF1, 0xE5, 0x14, 0xA4, 0xBF, 0x5C, 0xF5, 0xF3,
+    0x0F, 0xBB, 0x78, 0x6E, 0x11, 0xEF, 0xFB, 0xEA, 0x79, 0xBC, 0xFD, 0x39, 0x1E, 0x8C, 0xAE, 0xB2,
+    0x3D, 0xCA, 0xA5, 0x94, 0x26, 0x93, 0x59, 0x5F, 0x9E, 0x01, 0x10, 0xC6, 0x71, 0xA2, 0x66, 0xF8,
+    0x17, 0xC8, 0x26, 0x0E, 0x59, 0x61, 0xE2, 0xA6, 0x07, 0x7D, 0xB6, 0x92, 0x5A, 0x35, 0x59, 0xA5,
+    0x2B, 0x26, 0xB7, 0x04, 0x54, 0xC4, 0xD5, 0x6E, 0x08, 0x69, 0xB4, 0x96, 0x61, 0x20, 0xA6, 0xEB,
+    0xC7, 0x14, 0x41, 0xA9, 0xD8, 0x6A, 0x8E, 0x8A, 0xA8, 0x56, 0x3E, 0xB7, 0x3B, 0x2A, 0xA4, 0xFE,
+    0xBC, 0x93, 0x55, 0x14, 0xB4, 0x4D, 0x1C, 0x8D, 0x40, 0x29, 0xAD, 0x26, 0x1E, 0x75, 0x5E, 0x28,
+    0xA1, 0x0B, 0xA5, 0x41, 0xDF, 0xD3, 0xFF, 0x48, 0x8E, 0x82, 0xFF, 0x04, 0xFD, 0x0D, 0xD1, 0x2B,
+    0xF8, 0x85, 0xDE, 0x79, 0xF6, 0xEE, 0x67, 0xE9, 0x12, 0x66, 0xDD, 0xC5, 0x72, 0x3F, 0xE2, 0x53,
+    0x87, 0x53, 0x93, 0xD0, 0xE6, 0x83, 0xE5, 0x19, 0xA7, 0xDF, 0x5E, 0x24, 0x7B, 0xB5, 0x9F, 0xCE,
+    0x14, 0x7F, 0xD4, 0x52, 0xF4, 0x71, 0x93, 0x17, 0xF4, 0x40, 0xEE, 0x3E, 0x52, 0x21, 0x73, 0xD3,
+    0x84, 0x44, 0x25, 0xF5, 0xFA, 0x50, 0x36, 0xAA, 0xF4, 0x89, 0x3C, 0x74, 0xC9, 0x53, 0x39, 0xE6,
+    0xDC, 0xF9, 0x4D, 0xC8, 0xE0, 0x80, 0x36, 0x93, 0x3D, 0x8A, 0x43, 0xAE, 0x09, 0x7D, 0x0B, 0x99,
+    0x13, 0xE6, 0xF8, 0x61, 0x13, 0x8F, 0x6D, 0x14, 0xD6, 0x2E, 0xC0, 0xDC, 0x80, 0x7A, 0xE2, 0xB1,
+    0x6E, 0xD2, 0xE4, 0xD1, 0xEF, 0xED, 0x24, 0x1B, 0x3F, 0x76, 0x9C, 0xF4, 0x94, 0x8A, 0x2D, 0x25,
+    0xA8, 0xA6, 0x83, 0x49, 0xAB, 0xE1, 0xBD, 0xFE, 0xCE, 0xE0, 0x48, 0x28, 0x03, 0x56, 0x4E, 0xCF,
+    0x7E, 0xBE, 0x78, 0xBF, 0x3C, 0xA8, 0xE3, 0x46, 0x3B, 0x83, 0x69, 0xEA, 0xFB, 0x0A, 0xE5, 0x77,
+    0x0A, 0xD0, 0xBA, 0xBA, 0x1B, 0x06, 0x24, 0xAF, 0xCF, 0xDE, 0xB8, 0x67, 0x3F, 0xED, 0xB0, 0xE9,
+    0x2E, 0xBB, 0x89, 0x9D, 0x3A, 0x2D, 0xEA, 0x0B, 0x99, 0x6A, 0x75, 0x18, 0xF4, 0xC8, 0x6F, 0xA7,
+    0xFB, 0x5E, 0x3F, 0xB4, 0x39, 0x2F, 0x26, 0x8F, 0xD2, 0xB2, 0xB9, 0x2A, 0x70, 0x28, 0x30, 0x2E,
+    0xAB, 0x98, 0x59, 0xE2, 0xD0, 0xC0, 0x64, 0x85, 0xFA, 0xA3, 0xC5, 0xC7, 0xEF, 0x17, 0xFF, 0xC3,
+    0x61, 0x5E, 0xB9, 0xFE, 0x01, 0x9D, 0x55, 0x4F, 0x6C, 0x15, 0x45, 0x18, 0xFF, 0xED, 0x9B, 0xD6,
+    0x55, 0x36, 0x61, 0x6A, 0xD2, 0x26, 0xA6, 0x91, 0xAE, 0x07, 0x3D, 0x94, 0x50, 0xD6, 0x63, 0x63,
+    0xDA, 0x37, 0x0B, 0xC4, 0x34, 0x91, 0x03, 0x3D, 0xB4, 0x1E, 0xC5, 0x23, 0x37, 0x2E, 0x1C, 0x4C,
+    0x7C, 0xAF, 0xBB, 0xF0, 0x62, 0x38, 0x60, 0x22, 0x5C, 0xBC, 0x29, 0x8D, 0xC1, 0x44, 0x31, 0x11,
+    0x12, 0x89, 0x21, 0xA6, 0xED, 0x5B, 0x78, 0x07, 0x0E, 0xBD, 0xAC, 0x12, 0xE4, 0xC8, 0x12, 0x20,
+    0x4D, 0xE0, 0xD0, 0x11, 0x36, 0x74, 0x0B, 0xB3, 0xFB, 0xF9, 0xCD, 0x7B, 0xAF, 0xA5, 0x46, 0x8C,
+    0xD1, 0x69, 0xBF, 0x37, 0xB3, 0xBB, 0xF3, 0xFD, 0x99, 0xDF, 0xF7, 0xFB, 0xBE, 0x81, 0x13, 0x02,
+    0x27, 0x00, 0x09, 0x38, 0x1A, 0x76, 0x10, 0x95, 0x1E, 0x51, 0x1A, 0x51, 0x09, 0x87, 0x62, 0x28,
+    0x0D, 0x69, 0x20, 0x88, 0x3F, 0xA4, 0x50, 0x05, 0x64, 0xC5, 0x0F, 0x0F, 0x17, 0x23, 0xA2, 0x19,
+    0xA2, 0x82, 0xA7, 0x04, 0x7B, 0x00, 0x0D, 0x37, 0xC6, 0x30, 0xD0, 0xB7, 0x20, 0xC8, 0x40, 0xA6,
+    0x30, 0xF0, 0x93, 0x9A, 0x81, 0x7A, 0x10, 0x76, 0x77, 0x03, 0x7E, 0x08, 0x27, 0x07, 0x82, 0x18,
+    0xB5, 0x0B, 0xFF, 0xD3, 0xD9, 0x12, 0x6A, 0xB9, 0xB5, 0xBD, 0x37, 0xFC, 0x37, 0x67, 0x3C, 0xA6,
+    0xBD, 0x04, 0xA4, 0x21, 0x4C, 0xF7, 0x80, 0xDB, 0xE1, 0xFD, 0x57, 0x9F, 0x40, 0x5D, 0x86, 0x2A,
+    0x87, 0x0A, 0x31, 0xB9, 0x6D, 0x46, 0x92, 0x56, 0xFC, 0xAD, 0x84, 0x4C, 0x1C, 0x83, 0x20, 0x11,
+    0xD5, 0x9C, 0xA4, 0x3C, 0x62, 0x77, 0xA1, 0xBA, 0x4B, 0x67, 0x52, 0x85, 0x42, 0x64, 0x32, 0x56,
+    0x30, 0x42, 0xCB, 0x84, 0x27, 0xD6, 0x69, 0x62, 0x01, 0x11, 0x30, 0x28, 0x4E, 0xA5, 0x16, 0xEC,
+    0x31, 0xB8, 0xB9, 0xF3, 0x3C, 0x6B, 0x78, 0xB1, 0xBF, 0xAF, 0xFA, 0xE9, 0xFC, 0x67, 0xC3, 0x98,
+    0x3F, 0x48, 0x46, 0x55, 0x31, 0x30, 0x17, 0x50, 0x19, 0x5D, 0xFC, 0x9E, 0xDD, 0x1C, 0xEA, 0x90,
+    0x8E, 0xD8, 0x28, 0xC6, 0x65, 0xE7, 0x0F, 0x36, 0x32, 0xD5, 0x68, 0x36, 0x97, 0x97, 0x27, 0x5F,
+    0xDB, 0x37, 0xE4, 0xEF, 0xBE, 0x57, 0x34, 0x50, 0xD4, 0xB4, 0x1F, 0x07, 0xB5, 0x42, 0x74, 0xD3,
+    0xD7, 0xF0, 0x4E, 0x3E, 0xCF, 0xDC, 0x82, 0x4D, 0x77, 0xDD, 0x15, 0xEC, 0xD0, 0xB0, 0xCB, 0xD2,
+    0x3E, 0xB6, 0x5D, 0xAD, 0x44, 0x11, 0x24, 0xDF, 0x8D, 0x9E, 0x2B, 0xFD, 0xEB, 0x85, 0x9A, 0xD1,
+    0x7B, 0x5B, 0x26, 0x38, 0x69, 0x64, 0x5A, 0x79, 0x87, 0x6F, 0xE6, 0x13, 0x0E, 0x26, 0x65, 0x2B,
+    0xCF, 0x86, 0x30, 0x3E, 0x2B, 0xE9, 0xDA, 0x87, 0x1A, 0x53, 0x8C, 0xDA, 0x9E, 0xB1, 0x89, 0xC6,
+    0x5B, 0x03, 0x13, 0x93, 0xD3, 0xAF, 0x62, 0x10, 0x5A, 0x75, 0x0C, 0xFF, 0x4B, 0xCC, 0x62, 0x78,
+    0x65, 0x18, 0xA3, 0xED, 0x16, 0x99, 0x91, 0x79, 0x8E, 0xEC, 0xF4, 0x63, 0x33, 0x35, 0x65, 0xE3,
+    0xE2, 0x1C, 0xDB, 0xA8, 0xD8, 0xB0, 0x6A, 0xE5, 0x91, 0xCC, 0x06, 0x3C, 0xA1, 0xBF, 0x56, 0x1F,
+    0x84, 0x63, 0xFE, 0x91, 0x43, 0x65, 0x14, 0x62, 0xA4, 0xCE, 0x63, 0x21, 0x2A, 0x69, 0x63, 0xF5,
+    0x8E, 0x3F, 0x8E, 0xC5, 0x7A, 0xD0, 0x07, 0xF6, 0x13, 0xE0, 0x6D, 0xF0, 0x19, 0x94, 0x16, 0x1B,
+    0xBA, 0x5E, 0xD3, 0xD3, 0xEF, 0x95, 0xEB, 0x6A, 0xA9, 0x31, 0x4A, 0x92, 0x32, 0x60, 0x2F, 0xF9,
+    0x74, 0x6B, 0x3E, 0xEC, 0xBF, 0x6C, 0xD3, 0x3A, 0xE9, 0xA1, 0xC6, 0x9E, 0x06, 0x13, 0x17, 0x45,
+    0xB3, 0x68, 0x52, 0x49, 0xE5, 0xFC, 0x5C, 0xB4, 0x49, 0x6B, 0x33, 0x5F, 0x8D, 0xF1, 0x94, 0x0D,
+    0x7E, 0x4C, 0x37, 0x3F, 0xFD, 0xFC, 0xE1, 0xEB, 0x78, 0x27, 0xD4, 0x52, 0x1C, 0xEB, 0xC3, 0x2B,
+    0xBE, 0xF8, 0xF1, 0x2C, 0x93, 0x7D, 0x0A, 0x3E, 0x06, 0x43, 0xBC, 0x18, 0xDE, 0x99, 0xD6, 0x13,
+    0x6D, 0x4C, 0x3F, 0xAA, 0xD1, 0x76, 0xA7, 0x7B, 0x2A, 0xE6, 0x29, 0xF1, 0xCA, 0xD2, 0x68, 0x62,
+    0xBA, 0x3F, 0x98, 0x24, 0x1D, 0x7A, 0x7F, 0xD9, 0xC9, 0x6D, 0xD9, 0xE0, 0x5D, 0xB5, 0xD2, 0x5E,
+    0x7F, 0x5A, 0xFD, 0x6C, 0x44, 0x2C, 0x42, 0x8F, 0xC1, 0xDA, 0x8D, 0x37, 0x31, 0xD4, 0xB3, 0x59,
+    0xE3, 0xA8, 0x85, 0x15, 0xBD, 0xED, 0xC6, 0xAD, 0x1C, 0xE3, 0xD3, 0xAF, 0x46, 0xAD, 0x3E, 0x35,
+    0xEA, 0x1A, 0xE5, 0x23, 0x1F, 0x8D, 0x86, 0x1C, 0x0A, 0x30, 0xDA, 0x55, 0x28, 0xC6, 0xA3, 0xC7,
+    0x8F, 0x56, 0xCB, 0xE1, 0xD1, 0x03, 0x17, 0x86, 0xA3, 0x7B, 0x8F, 0xEE, 0x34, 0x8F, 0x45, 0x89,
+    0x73, 0x01, 0xCE, 0x80, 0xB8, 0x9D, 0x0C, 0x85, 0x78, 0x63, 0xDF, 0x80, 0xDD, 0xC6, 0x26, 0xEF,
+    0xE6, 0x38, 0xEE, 0x10, 0xC3, 0x32, 0x32, 0x07, 0x8C, 0xCC, 0x32, 0x13, 0x2B, 0xAE, 0xAA, 0xE3,
+    0xBB, 0xC1, 0xFE, 0x77, 0x8C, 0x45, 0x41, 0x4C, 0x75, 0xC9, 0x3F, 0x5C, 0x72, 0x98, 0xE8, 0xB3,
+    0x36, 0xB1, 0xB5, 0xE2, 0xA5, 0x5B, 0x9B, 0x78, 0x8F, 0xA4, 0x42, 0xCD, 0x31, 0x53, 0x38, 0x5A,
+    0x79, 0x2B, 0x56, 0x04, 0x32, 0x76, 0x19, 0x23, 0xBA, 0x78, 0x8E, 0xE8, 0x34, 0x31, 0xF4, 0x46,
+    0xDE, 0x48, 0x55, 0x10, 0x9A, 0x95, 0x57, 0xBE, 0xE9, 0xD5, 0x6D, 0xAD, 0xCD, 0x6A, 0x46, 0x7D,
+    0x3B, 0x6B, 0xEC, 0x01, 0xE5, 0xEF, 0xAC, 0x16, 0xB2, 0x9A, 0xB6, 0xF6, 0xD5, 0xC5, 0x45, 0xA2,
+    0x1B, 0x44, 0x47, 0xA9, 0xB2, 0x3B, 0xFB, 0x45, 0xE4, 0x72, 0x19, 0x35, 0x18, 0x03, 0x9E, 0x98,
+    0x24, 0x1E, 0x47, 0xDF, 0xA6, 0xC4, 0xD3, 0x0B, 0x58, 0xAA, 0x69, 0x2F, 0xF1, 0xBB, 0xD3, 0xF5,
+    0x0A, 0xCB, 0x41, 0x32, 0x78, 0x60, 0x16, 0x7C, 0xD4, 0x2B, 0x10, 0x09, 0xF6, 0xEF, 0x28, 0x37,
+    0xA3, 0x48, 0xF7, 0xDC, 0xB1, 0x0F, 0xE0, 0xAF, 0xCB, 0xDC, 0x2E, 0x71, 0x9C, 0x2B, 0x98, 0x12,
+    0x99, 0x45, 0x9C, 0xA0, 0x3C, 0xC0, 0xE0, 0x21, 0xEE, 0x03, 0xAC, 0x65, 0xF3, 0xC0, 0xDB, 0x44,
+    0x29, 0x4C, 0x40, 0x14, 0x33, 0x20, 0x2E, 0xC7, 0xE6, 0x51, 0x8F, 0x03, 0x4C, 0x05, 0x9F, 0x12,
+    0xC1, 0x28, 0xAD, 0x38, 0x5D, 0x2B, 0x9C, 0x72, 0x6F, 0x93, 0x35, 0xF8, 0x7B, 0xDB, 0x36, 0xAD,
+    0x82, 0x99, 0x90, 0x5C, 0xAD, 0x71, 0xEE, 0xA8, 0x45, 0xA4, 0x77, 0xD1, 0x7D, 0xAB, 0xA6, 0x64,
+    0x47, 0x9B, 0x1D, 0x3F, 0x3E, 0x63, 0x5A, 0xAF, 0x2B, 0x1E, 0x7D, 0x64, 0xF5, 0x3F, 0xFD, 0xB9,
+    0x79, 0xBF, 0x87, 0xED, 0x38, 0xC5, 0x02, 0x9C, 0x02, 0x6E, 0x86, 0x20, 0x64, 0x78, 0xBA, 0xAF,
+    0x66, 0x23, 0x41, 0x85, 0xA4, 0x54, 0x95, 0x36, 0x42, 0x1B, 0x9E, 0x63, 0x01, 0x9D, 0xF2, 0x42,
+    0xC8, 0x5A, 0xCA, 0xE0, 0x5C, 0xE1, 0x8E, 0x3D, 0x61, 0x2B, 0x9E, 0x62, 0xBF, 0x46, 0xC6, 0x8D,
+    0xAF, 0x06, 0x07, 0xB3, 0xFD, 0x22, 0xBB, 0xEA, 0x7D, 0x99, 0xAF, 0xF0, 0x0B, 0x15, 0xB6, 0x8B,
+    0x5D, 0x3B, 0x69, 0x5E, 0x58, 0xA9, 0x25, 0xDC, 0x97, 0x5E, 0x08, 0xD1, 0xB3, 0xD8, 0x32, 0xA4,
+    0xE0, 0x2E, 0x5A, 0x88, 0x74, 0x89, 0xA5, 0x59, 0x88, 0x07, 0xBC, 0xA6, 0x82, 0x25, 0x9B, 0xEB,
+    0xEB, 0xDA, 0x14, 0x6E, 0x89, 0x0D, 0xD2, 0xF6, 0xF0, 0x6D, 0x51, 0xB6, 0x73, 0x72, 0x80, 0x2A,
+    0x29, 0xA0, 0xE2, 0x06, 0x97, 0xB3, 0x95, 0x25, 0x5E, 0xF7, 0xC4, 0x81, 0xCD, 0xA5, 0xC3, 0x59,
+    0xC8, 0x7B, 0xC8, 0x54, 0x30, 0x11, 0xEA, 0x2A, 0x94, 0xE7, 0x13, 0x77, 0x3D, 0x71, 0x98, 0x0C,
+    0xDC, 0xE1, 0x82, 0x1C, 0x9E, 0xED, 0xBD, 0x19, 0x6C, 0xD6, 0x94, 0x96, 0x1D, 0x72, 0x75, 0x94,
+    0xBB, 0x8C, 0xEB, 0x02, 0x13, 0x47, 0xEF, 0xE4, 0xB6, 0xBD, 0x46, 0x66, 0xA7, 0x51, 0xC9, 0x38,
+    0x6A, 0x65, 0x2A, 0x2B, 0x7C, 0x53, 0x97, 0x24, 0x6F, 0xAC, 0x77, 0x9E, 0x6C, 0xE8, 0x72, 0xD3,
+    0x28, 0x13, 0xC9, 0xCA, 0xFF, 0x8D, 0x66, 0xF2, 0xF6, 0xF5, 0x32, 0x48, 0xDB, 0xB1, 0xC3, 0x4D,
+    0xF9, 0x52, 0xD8, 0xE6, 0x56, 0x18, 0x6F, 0x59, 0x18, 0xC1, 0x70, 0xD3, 0xC9, 0x8D, 0x77, 0xAD,
+    0xA8, 0x0B, 0x9D, 0xBB, 0x6B, 0x09, 0x37, 0x7E, 0xDF, 0x9E, 0x81, 0xDB, 0xA5, 0x63, 0xE9, 0xC4,
+    0xCF, 0x7C, 0x37, 0x54, 0x3D, 0x6F, 0x62, 0x2D, 0x95, 0xE7, 0xC3, 0x7A, 0x13, 0x9B, 0x7F, 0x5B,
+    0x52, 0x15, 0x51, 0xF1, 0xC3, 0xB3, 0xB3, 0x4C, 0x6D, 0x2E, 0xE6, 0x63, 0x4C, 0xD5, 0x10, 0x7C,
+    0x11, 0x41, 0xA5, 0x5C, 0xF1, 0xC0, 0x33, 0x0D, 0xFF, 0x48, 0x58, 0x63, 0xEA, 0x2A, 0x2F, 0x75,
+    0xB3, 0x05, 0x3E, 0x9D, 0x66, 0x26, 0x9D, 0x22, 0x9B, 0x21, 0x79, 0x9B, 0x3D, 0xCC, 0xCF, 0x07,
+    0xB4, 0x7A, 0xEB, 0xA0, 0xE6, 0xBB, 0xCD, 0xDF, 0x74, 0xE9, 0xAE, 0x6E, 0x34, 0xDC, 0xA3, 0x62,
+    0x8D, 0x72, 0xDE, 0x71, 0x1F, 0x23, 0xA1, 0x47, 0xE9, 0x65, 0xE9, 0xE1, 0xC4, 0x65, 0xEF, 0x30,
+    0x65, 0xED, 0xC2, 0x9B, 0xCF, 0x2F, 0x8B, 0x55, 0x4C, 0xFD, 0x72, 0x69, 0x95, 0x4C, 0xBB, 0xDA,
+    0xBA, 0xD4, 0x3A, 0x5C, 0xC9, 0x2F, 0x29, 0x8C, 0xDE, 0x32, 0xEC, 0x5E, 0x3F, 0x2F, 0x19, 0x7F,
+    0x02, 0x95, 0x55, 0x31, 0x6C, 0xDD, 0x44, 0x18, 0xFE, 0x9F, 0xAF, 0xA9, 0xA5, 0x5A, 0xE2, 0x3A,
+    0x14, 0x81, 0x8A, 0xC4, 0x2D, 0x1D, 0x3A, 0xD5, 0x6B, 0x87, 0xF7, 0x7C, 0x4E, 0x33, 0x30, 0x74,
+    0x78, 0x1D, 0xA8, 0x18, 0x18, 0xE8, 0x8A, 0x84, 0x94, 0x85, 0x31, 0x79, 0x76, 0x9B, 0x21, 0x12,
+    0x1D, 0x12, 0x16, 0x16, 0x86, 0x30, 0x80, 0x84, 0x02, 0x12, 0x19, 0x40, 0x0A, 0xC8, 0x8D, 0x2F,
+    0x78, 0xE8, 0x90, 0x01, 0x87, 0x27, 0xDA, 0xA1, 0x43, 0xDD, 0xA6, 0x52, 0xA5, 0x76, 0xC8, 0x85,
+    0x5C, 0xE9, 0x29, 0x39, 0xFB, 0xE7, 0xBF, 0xF7, 0x82, 0x94, 0x8E, 0xF8, 0xFD, 0xB2, 0xFD, 0xDB,
+    0x77, 0xF7, 0xFE, 0xFB, 0xBE, 0xEF, 0xFF, 0x0C, 0xD8, 0x82, 0xC0, 0xBA, 0xF7, 0x6A, 0x11, 0x04,
+    0x6B, 0x7A, 0x3A, 0xF1, 0x97, 0x80, 0x2E, 0xF1, 0xF4, 0x32, 0x62, 0x4D, 0x7C, 0x84, 0x4B, 0x88,
+    0x2E, 0x46, 0xBC, 0xAD, 0x7B, 0xE6, 0x1C, 0x5C, 0x04, 0x3A, 0x10, 0x2B, 0xEC, 0xF8, 0x5F, 0x90,
+    0x00, 0x58, 0x60, 0xAF, 0x6E, 0x71, 0x54, 0x12, 0xFD, 0x6D, 0x03, 0xE2, 0xC5, 0xB7, 0x19, 0x3E,
+    0x41, 0xBC, 0x8F, 0x08, 0xA1, 0x2E, 0x97, 0x0C, 0x74, 0xF1, 0x53, 0x07, 0xFC, 0xBE, 0x69, 0x21,
+    0x68, 0xDB, 0x2D, 0x00, 0x59, 0x96, 0x00, 0x21, 0x62, 0x0A, 0x50, 0xA2, 0x02, 0xE0, 0xFE, 0x14,
+    0xA2, 0x99, 0x3C, 0xCC, 0x21, 0x42, 0xB4, 0x10, 0x75, 0x1D, 0xE6, 0xBC, 0xCD, 0x3E, 0x71, 0xBC,
+    0x13, 0x4F, 0x51, 0xC5, 0x46, 0xE0, 0x6C, 0xA0, 0x61, 0x81, 0x2A, 0x43, 0xA0, 0x51, 0x05, 0x88,
+    0x4B, 0xD1, 0x0E, 0xFE, 0x8D, 0x76, 0xDE, 0xC0, 0x22, 0x5C, 0xE0, 0xA9, 0x5C, 0x6A, 0x44, 0x63,
+    0xB9, 0x4D, 0x42, 0xE4, 0x4B, 0x58, 0x1D, 0x1C, 0x6B, 0xD7, 0x3A, 0x39, 0xCA, 0x38, 0x8A, 0x0A,
+    0x97, 0x4D, 0xB9, 0xDB, 0xC6, 0xBA, 0xBC, 0x6E, 0xE2, 0x66, 0x06, 0x52, 0xF6, 0x42, 0x03, 0x3A,
+    0x88, 0x2C, 0xBC, 0x71, 0xFC, 0xBF, 0x75, 0x78, 0x65, 0xD9, 0x81, 0x03, 0xDB, 0x42, 0x92, 0x81,
+    0x28, 0xA9, 0xFA, 0xBC, 0x47, 0x5B, 0x29, 0x6B, 0x88, 0x2D, 0x6D, 0x2A, 0x67, 0xF4, 0x0F, 0x8E,
+    0x80, 0xE1, 0x4E, 0x6C, 0x13, 0xC6, 0x37, 0x3F, 0xE4, 0xA8, 0x25, 0x2A, 0x27, 0x99, 0x76, 0xBC,
+    0xD2, 0x09, 0x57, 0x56, 0xB2, 0xC6, 0x89, 0x39, 0xBD, 0xC8, 0x7F, 0x37, 0x52, 0x2A, 0xD7, 0x32,
+    0x4D, 0x55, 0xC8, 0x5C, 0x54, 0x2E, 0x70, 0xB2, 0x96, 0x15, 0x46, 0x4E, 0x6A, 0xC2, 0x7A, 0xCD,
+    0x25, 0x78, 0x5C, 0x3D, 0xEF, 0x8A, 0x44, 0x3E, 0xAA, 0x0E, 0x5D, 0x21, 0xC5, 0xDD, 0x4A, 0x43,
+    0x21, 0x81, 0x2B, 0x3F, 0x01, 0x62, 0xAE, 0xA2, 0xB1, 0x0E, 0x8C, 0x83, 0x7B, 0x12, 0xE4, 0x50,
+    0xF1, 0xB1, 0x66, 0xA6, 0x5B, 0xEF, 0x24, 0xE2, 0x0A, 0xE2, 0x1E, 0x21, 0xDA, 0x42, 0x97, 0xA5,
+    0x72, 0xAD, 0xE6, 0x1A, 0xE6, 0x9F, 0x11, 0xC6, 0x16, 0xF0, 0x6B, 0x1B, 0xD2, 0x28, 0x49, 0x2C,
+    0x11, 0x3D, 0x55, 0x03, 0x52, 0xE4, 0xE0, 0x24, 0x30, 0x8D, 0x69, 0x56, 0x21, 0x22, 0xB1, 0x61,
+    0x88, 0x8C, 0xFC, 0x2C, 0x3E, 0x9B, 0xA0, 0xF3, 0xF6, 0xCD, 0x1B, 0x9E, 0x77, 0xE4, 0xF9, 0x62,
+    0xD2, 0x33, 0x36, 0x1C, 0x37, 0x62, 0x78, 0xEA, 0x56, 0x2D, 0xCA, 0x9E, 0xF9, 0xFE, 0xEC, 0x2A,
+    0x8D, 0x2C, 0x6D, 0x80, 0x6D, 0xA4, 0x8A, 0x18, 0x8C, 0x0B, 0xC7, 0x88, 0x43, 0x74, 0x12, 0xF3,
+    0x6E, 0x95, 0xB6, 0x47, 0x05, 0xCB, 0x14, 0x5A, 0x08, 0xCD, 0x14, 0xF2, 0xB8, 0xEB, 0x61, 0x17,
+    0x62, 0xCB, 0xCD, 0x19, 0x31, 0x79, 0x45, 0x91, 0x51, 0xE4, 0x20, 0x9B, 0x19, 0x89, 0xAD, 0xA0,
+    0x85, 0xB0, 0xED, 0x61, 0x9B, 0x21, 0x3E, 0x46, 0x7C, 0x4D, 0x52, 0x24, 0xEE, 0x21, 0x4E, 0x21,
+    0xAA, 0x21, 0xA0, 0x45, 0x5A, 0xF0, 0x53, 0x78, 0x0D, 0xEC, 0x24, 0xC9, 0x81, 0x37, 0xB4, 0x70,
+    0xCF, 0xB0, 0xB1, 0x8E, 0xC3, 0xDA, 0xF2, 0xAA, 0x16, 0x6B, 0x20, 0x2D, 0x64, 0x35, 0x20, 0xF4,
+    0x1C, 0x84, 0x35, 0x21, 0x46, 0x39, 0x2A, 0x36, 0xE5, 0x3F, 0xC0, 0x8E, 0xBD, 0x3C, 0x7E, 0xAA,
+    0x6C, 0x7F, 0x63, 0xC4, 0x05, 0xEE, 0xD3, 0x1E, 0x6B, 0x89, 0x0D, 0x8C, 0x00, 0xA8, 0xA6, 0x50,
+    0xFB, 0x49, 0x40, 0x9A, 0x15, 0x79, 0xA4, 0x88, 0xEF, 0x50, 0x13, 0xE0, 0xD7, 0x6B, 0x68, 0x49,
+    0x40, 0x24, 0x62, 0xD9, 0x90, 0xAE, 0xE9, 0x7F, 0xB5, 0xE7, 0x3C, 0xE8, 0x5A, 0xC8, 0x86, 0x9A,
+    0x6B, 0x49, 0x14, 0x76, 0x17, 0x20, 0x1D, 0x04, 0xCD, 0xA9, 0xD0, 0xC9, 0x34, 0xD8, 0x49, 0x48,
+    0x0F, 0x8C, 0x0F, 0xDF, 0x47, 0x3E, 0xE0, 0x7C, 0xEF, 0xFD, 0xDE, 0xF3, 0xF4, 0xD7, 0xFA, 0xCA,
+    0x46, 0xF4, 0x23, 0x7B, 0x79, 0xA7, 0x45, 0x94, 0xC7, 0xDB, 0x5F, 0x7A, 0xE1, 0x0B, 0x08, 0xD5,
+    0x05, 0x98, 0xE1, 0xCB, 0xE3, 0xBD, 0x27, 0xC6, 0xDA, 0xC5, 0x24, 0x11, 0xC3, 0x95, 0xA5, 0xF1,
+    0x5E, 0x43, 0xC9, 0x20, 0x49, 0x38, 0x25, 0x7F, 0x52, 0xB2, 0x89, 0xE8, 0x69, 0xFF, 0x62, 0x7D,
+    0x7D, 0x35, 0x39, 0xC7, 0x73, 0x1A, 0xC7, 0x68, 0x38, 0xCD, 0x6A, 0x68, 0x48, 0x6E, 0x06, 0x09,
+    0xAB, 0x29, 0x9D, 0x1B, 0x37, 0x83, 0x49, 0x7A, 0x85, 0xD1, 0x78, 0x8E, 0xBE, 0x08, 0x24, 0xF1,
+    0xF1, 0x1C, 0x7C, 0x53, 0xC3, 0x37, 0x94, 0x48, 0xAA, 0x8A, 0x03, 0x30, 0x92, 0x18, 0xBD, 0x91,
+    0x2D, 0xED, 0xAF, 0x66, 0x04, 0x80, 0x8E, 0x61, 0x30, 0xAF, 0x7C, 0x82, 0xF5, 0x44, 0x7D, 0x00,
+    0x51, 0x95, 0x43, 0xA0, 0x69, 0x54, 0xD1, 0x27, 0x6E, 0xB8, 0x7F, 0xA0, 0xE8, 0x01, 0xF5, 0x74,
+    0x21, 0x31, 0x8D, 0x87, 0x4C, 0x47, 0x63, 0x55, 0x04, 0xE6, 0x55, 0x09, 0x5B, 0xF4, 0x40, 0xAE,
+    0x60, 0xCA, 0x9B, 0xCB, 0x7E, 0xE9, 0xFE, 0xC9, 0xC9, 0x23, 0x3E, 0xA7, 0x5C, 0x3F, 0xAA, 0x1E,
+    0x50, 0x29, 0x73, 0xB4, 0x72, 0xB9, 0x0A, 0xD8, 0x41, 0x1B, 0x35, 0x05, 0x2C, 0xBE, 0x4D, 0x85,
+    0x49, 0xD4, 0xDC, 0x03, 0x45, 0xFF, 0xC7, 0xFF, 0x68, 0x04, 0x89, 0xDA, 0x64, 0xE8, 0x38, 0x39,
+    0x58, 0xF6, 0x5F, 0x1B, 0x47, 0xB3, 0x98, 0xFF, 0x9C, 0x61, 0x34, 0xDC, 0x36, 0xBF, 0xE8, 0xE8,
+    0x2E, 0xC2, 0x42, 0xD9, 0xB0, 0x9D, 0x0E, 0xFA, 0xBF, 0xE9, 0x70, 0x47, 0x3C, 0xB0, 0x1B, 0x88,
+    0xD7, 0x43, 0x6C, 0x36, 0xDE, 0x33, 0x5E, 0xA3, 0x0C, 0x6D, 0xA4, 0x36, 0xA3, 0xBC, 0xE0, 0x79,
+    0x41, 0x62, 0x0D, 0xD1, 0x05, 0xE8, 0xA8, 0x69, 0xA3, 0x6D, 0xC7, 0x15, 0xF5, 0x6C, 0x2B, 0x27,
+    0x31, 0x5D, 0x3A, 0xDB, 0x14, 0x58, 0xD5, 0xEE, 0x6A, 0x78, 0x3F, 0xED, 0x7F, 0x4E, 0x9A, 0x6E,
+    0x63, 0x6C, 0xCA, 0xD1, 0xE4, 0xD5, 0x0D, 0x98, 0xA7, 0xD5, 0x22, 0x54, 0x23, 0x60, 0x07, 0xE9,
+    0xA4, 0xC9, 0x75, 0xC7, 0xF7, 0xB4, 0x58, 0x51, 0xA3, 0x78, 0xD9, 0x52, 0xCB, 0x97, 0x54, 0x63,
+    0x8E, 0xCD, 0xD1, 0xA6, 0xEE, 0x1F, 0x59, 0xB4, 0xFA, 0xCA, 0x51, 0x89, 0x1D, 0xD2, 0x9B, 0x0A,
+    0x5D, 0x42, 0x0D, 0x07, 0xF2, 0xCD, 0xD3, 0xC4, 0x62, 0x8D, 0x8F, 0x7F, 0x4C, 0xEF, 0xC0, 0x04,
+    0x07, 0x86, 0x1D, 0x98, 0x68, 0xD7, 0x10, 0x47, 0x12, 0xBB, 0x78, 0xFD, 0x9E, 0x20, 0x3D, 0x80,
+    0x97, 0x5D, 0x67, 0x93, 0x77, 0xC8, 0x8A, 0x47, 0xDF, 0x7D, 0x40, 0xA2, 0x26, 0xDB, 0xED, 0x02,
+    0x4C, 0xC3, 0xA6, 0xE3, 0x35, 0x33, 0x18, 0x53, 0x3B, 0x6F, 0x11, 0x5A, 0xA3, 0x7B, 0xB4, 0x87,
+    0x98, 0x3A, 0x9E, 0x08, 0xD4, 0xDE, 0x64, 0x89, 0xB5, 0x88, 0xE4, 0x0D, 0x5E, 0x77, 0x3D, 0x6A,
+    0xF4, 0x34, 0x6A, 0x31, 0xAB, 0x63, 0x9A, 0x61, 0x45, 0xFD, 0x95, 0x62, 0xB3, 0x9F, 0x71, 0x1D,
+    0xEC, 0x7E, 0xB4, 0xD2, 0xC6, 0x4D, 0x9F, 0x69, 0x1D, 0x57, 0x0A, 0x39, 0x77, 0x83, 0x2D, 0xFD,
+    0xFA, 0x79, 0x85, 0x82, 0x9B, 0x05, 0xB9, 0x4D, 0x7D, 0xED, 0xB9, 0x3F, 0x7F, 0x26, 0xFE, 0x69,
+    0x19, 0x15, 0x75, 0xEB, 0xF4, 0x68, 0x2E, 0x5D, 0x8D, 0xDF, 0xE2, 0xD5, 0x8E, 0x3E, 0x2C, 0x92,
+    0xC7, 0xC3, 0xC3, 0xB1, 0x31, 0x2E, 0x21, 0xC5, 0xED, 0xA8, 0x81, 0x66, 0x1E, 0x83, 0xD0, 0x42,
+    0xA9, 0xA3, 0xB5, 0xDA, 0x66, 0xF9, 0xD9, 0xF5, 0x88, 0x88, 0xA2, 0x1F, 0x9F, 0x1C, 0x42, 0x8A,
+    0xCB, 0x33, 0xDE, 0x0F, 0xC0, 0xCA, 0xDB, 0x56, 0x56, 0x56, 0x8E, 0x9D, 0x7C, 0x49, 0xB6, 0x57,
+    0x0C, 0x28, 0xB6, 0x8A, 0xC1, 0xA0, 0x48, 0xDE, 0x25, 0xF6, 0xA3, 0x7C, 0xB0, 0xC9, 0x1E, 0xA9,
+    0x41, 0xE1, 0x4F, 0x5B, 0x3F, 0x3C, 0x26, 0x1C, 0x71, 0x5F, 0x8D, 0x5C, 0xD8, 0x04, 0xE4, 0x12,
+    0x64, 0xDA, 0x0F, 0x55, 0xB2, 0xC0, 0x0E, 0x5F, 0x91, 0xCC, 0x76, 0xD1, 0x12, 0x42, 0x44, 0x06,
+    0xB9, 0x56, 0x13, 0x13, 0xC9, 0xD4, 0x79, 0x36, 0x3A, 0x75, 0xEB, 0xBD, 0x13, 0xCE, 0x90, 0x75,
+    0x2B, 0x7E, 0xA4, 0x79, 0x7D, 0x95, 0xAB, 0xBE, 0x8F, 0xBA, 0xCF, 0x3B, 0x27, 0x90, 0xBE, 0x38,
+    0x75, 0x3C, 0xE3, 0xE5, 0xE6, 0x31, 0x04, 0xF8, 0x74, 0xB2, 0xC3, 0x72, 0x16, 0x9B, 0x96, 0x04,
+    0x2B, 0xBC, 0x8D, 0xB4, 0xB7, 0x04, 0xF6, 0x4A, 0x52, 0xA6, 0x45, 0x7C, 0x12, 0x2A, 0x2A, 0x9E,
+    0xBC, 0x89, 0xBE, 0x52, 0xD1, 0xE4, 0xD6, 0x9D, 0x50, 0x39, 0x00, 0x5B, 0xB0, 0xDA, 0x8A, 0xC0,
+    0x58, 0x76, 0x58, 0x47, 0x08, 0xDC, 0x42, 0xEC, 0x3D, 0x88, 0x46, 0x44, 0x3E, 0x8F, 0x0D, 0x6C,
+    0x79, 0xF5, 0x02, 0xCC, 0x63, 0x23, 0xF6, 0xF7, 0xAB, 0xDA, 0x24, 0x7D, 0x7E, 0x6D, 0x4F, 0x99,
+    0x44, 0x0E, 0x3F, 0xDE, 0x45, 0x2F, 0xCC, 0x0E, 0x80, 0x44, 0xCB, 0xD3, 0xC9, 0x65, 0x66, 0x82,
+    0x13, 0xBF, 0xA3, 0xC3, 0x87, 0x75, 0x40, 0x1F, 0x43, 0x04, 0xE8, 0xC8, 0xC5, 0xF2, 0x08, 0x6B,
+    0x51, 0x69, 0x79, 0x8D, 0x70, 0x82, 0x84, 0x35, 0xA7, 0x63, 0xEA, 0x40, 0x53, 0xB3, 0xB9, 0xB8,
+    0x3E, 0x35, 0x1B, 0x03, 0xFF, 0x02, 0x8D, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x43,
+    0xB2, 0x28, 0x8B, 0x32, 0x29, 0xF8, 0x11, 0x22, 0x78, 0x1A, 0x8A, 0x28, 0x72, 0xBC, 0x0D, 0x45,
+    0x8A, 0xBD, 0xDB, 0x8D, 0x52, 0x58, 0xC2, 0x12, 0x49, 0x41, 0x1F, 0x0A, 0x1A, 0x22, 0x94, 0x50,
+    0x44, 0x08, 0xC1, 0xD9, 0xBB, 0x91, 0x8B, 0x48, 0x18, 0xC9, 0xAE, 0x68, 0xA1, 0x00, 0x24, 0x4C,
+    0x91, 0x02, 0x17, 0x46, 0x9C, 0xBD, 0x1B, 0xAE, 0x48, 0x61, 0x09, 0x6F, 0x72, 0xA0, 0x14, 0x08,
+    0x32, 0xC1, 0x42, 0x46, 0x20, 0xE1, 0x71, 0x58, 0xC8, 0x26, 0xCC, 0xDE, 0xE3, 0x9B, 0x23, 0x51,
+    0x1C, 0x2A, 0x66, 0xDE, 0xEE, 0xCE, 0xEC, 0xBC, 0x79, 0x3F, 0xF3, 0xBE, 0xF7, 0xE6, 0xD0, 0xA1,
+    0x6A, 0x4B, 0xBC, 0x7F, 0xF0, 0xC5, 0x55, 0xD6, 0x9F, 0xE6, 0x07, 0xE9, 0x78, 0xF7, 0x80, 0x5C,
+    0xBC, 0x34, 0xDC, 0xBA, 0x55, 0x37, 0x4D, 0xA7, 0xDB, 0x95, 0xA7, 0x16, 0xE7, 0x87, 0x5B, 0xBA,
+    0x5E, 0x65, 0x1E, 0x25, 0xCC, 0xEF, 0x2D, 0x2F, 0x2F, 0x81, 0x21, 0x6F, 0x66, 0xBB, 0x02, 0x1C,
+    0x72, 0x7E, 0xA8, 0xC1, 0x92, 0x83, 0x53, 0x80, 0x47, 0x32, 0x5B, 0x30, 0x99, 0xE5, 0xE5, 0xCB,
+    0x39, 0xD1, 0x1C, 0x91, 0x57, 0xE3, 0x49, 0x9F, 0x2E, 0x85, 0x25, 0xAF, 0xA4, 0xC3, 0xE4, 0xFD,
+    0x4C, 0xAA, 0xF5, 0xAE, 0xE9, 0xE7, 0xA5, 0xC7, 0x5A, 0x35, 0x44, 0x07, 0x88, 0xC4, 0x55, 0xA2,
+    0xDD, 0x92, 0xE2, 0x37, 0x49, 0x4E, 0x9C, 0x16, 0x57, 0x99, 0x76, 0xAF, 0xEB, 0xCE, 0x85, 0xE3,
+    0xF2, 0xCC, 0x48, 0xDC, 0x18, 0x11, 0x04, 0x94, 0x01, 0x76, 0xBE, 0x73, 0x82, 0x6F, 0x4C, 0xFF,
+    0x20, 0xB3, 0xBB, 0x0C, 0xC9, 0xAA, 0xDD, 0x2F, 0x2A, 0xEA, 0x91, 0x12, 0x5C, 0xD1, 0x6E, 0xDA,
+    0x2F, 0x6C, 0xD8, 0x90, 0x2E, 0x4E, 0x2E, 0xF0, 0xCB, 0xB1, 0xEC, 0x56, 0x93, 0x9C, 0x7E, 0xF1,
+    0xBB, 0xF8, 0x26, 0x29, 0x8E, 0x73, 0x5D, 0x15, 0x29, 0x3D, 0x45, 0x59, 0x23, 0xC5, 0x45, 0x1D,
+    0x2B, 0x51, 0xB2, 0x0D, 0xF9, 0x4A, 0x6D, 0x93, 0x70, 0x60, 0xDA, 0x42, 0x56, 0x61, 0x4E, 0x09,
+    0xD1, 0x1A, 0xED, 0x6D, 0x7E, 0x4B, 0xA3, 0xA6, 0xFB, 0xCC, 0x80, 0x47, 0x73, 0x9F, 0x4C, 0x57,
+    0x94, 0xF0, 0x2D, 0x1E, 0xF9, 0x9C, 0xCA, 0x53, 0x69, 0xD3, 0xA8, 0x0F, 0xF3, 0x87, 0x8C, 0x51,
+    0x25, 0x77, 0xE6, 0x6F, 0xF5, 0x12, 0xDE, 0xFE, 0xF5, 0x95, 0x59, 0x12, 0x3C, 0x52, 0xAC, 0xA3,
+    0xDA, 0x33, 0x44, 0x7D, 0xF2, 0x0A, 0xED, 0x73, 0x4D, 0x3E, 0x26, 0xA3, 0x16, 0x32, 0x4A, 0x79,
+    0xAD, 0x16, 0x7A, 0x82, 0x9A, 0xA0, 0xEC, 0xFA, 0x46, 0xE5, 0xFD, 0xC0, 0x24, 0x17, 0x6D, 0xA6,
+    0x29, 0x32, 0x14, 0x2C, 0xD1, 0x0A, 0x49, 0xF2, 0x35, 0x3D, 0x09, 0xCE, 0x01, 0xDB, 0x2E, 0x09,
+    0x03, 0xBB, 0x1E, 0x79, 0x39, 0xC3, 0x1A, 0xEF, 0x9E, 0x89, 0x83, 0xF9, 0xEF, 0xD2, 0xCC, 0x06,
+    0x39, 0x75, 0xF6, 0xCF, 0xB3, 0x55, 0x9C, 0x9E, 0x5D, 0x72, 0xB6, 0xD4, 0xF2, 0x73, 0x32, 0x14,
+    0xDE, 0xA5, 0xD0, 0x52, 0xA0, 0x47, 0x08, 0xD6, 0x95, 0x42, 0x63, 0x61, 0x76, 0x6D, 0xFD, 0x33,
+    0xA2, 0xD8, 0xB5, 0x5E, 0x6F, 0x76, 0x16, 0x43, 0xBC, 0xD7, 0xC6, 0x1E, 0x8B, 0xF2, 0x41, 0x0F,
+    0x5C, 0xAF, 0x82, 0x8A, 0x3E, 0x0A, 0xCA, 0xE8, 0xBE, 0x73, 0xB4, 0xEA, 0xEB, 0x30, 0x9F, 0xA2,
+    0x15, 0xBF, 0x92, 0x69, 0x87, 0x4C, 0x52, 0x72, 0x80, 0x68, 0xEC, 0x7B, 0x8D, 0x22, 0x4B, 0x87,
+    0x27, 0x1D, 0x4D, 0x46, 0x66, 0xF2, 0x58, 0x7F, 0x72, 0x32, 0x8E, 0xA7, 0xFA, 0xAB, 0x91, 0x79,
+    0x95, 0x48, 0x1F, 0x12, 0x79, 0x79, 0x50, 0x50, 0xE7, 0x1C, 0x31, 0x6F, 0xE5, 0xDB, 0x3F, 0x8A,
+    0xE9, 0xB7, 0x0F, 0xAE, 0xE9, 0x44, 0xFF, 0xFF, 0x53, 0xF1, 0xAC, 0x2C, 0xE9, 0x34, 0xCE, 0xC3,
+    0xD3, 0xD4, 0x71, 0x56, 0x0E, 0x75, 0xDC, 0x17, 0x37, 0x29, 0xA9, 0x82, 0x86, 0xB2, 0x3C, 0x64,
+    0xFA, 0xB2, 0x95, 0x97, 0xB0, 0x83, 0xC2, 0x0A, 0x9E, 0x3E, 0x08, 0x86, 0x28, 0x13, 0xE9, 0xDB,
+    0x58, 0x1A, 0xC3, 0x83, 0xEF, 0x77, 0xE4, 0x5C, 0x2F, 0xD9, 0x35, 0x3C, 0x3D, 0xB0, 0xEA, 0x54,
+    0x09, 0xA7, 0xC9, 0x3B, 0x94, 0x46, 0x9C, 0x67, 0x96, 0xB2, 0xA5, 0x3D, 0xA1, 0xEE, 0x50, 0xD3,
+    0x17, 0x55, 0xA3, 0xFC, 0xBA, 0x11, 0x7F, 0x54, 0x10, 0x2D, 0x1B, 0x44, 0xD5, 0x41, 0xC2, 0x42,
+    0x3A, 0xE6, 0x51, 0x4D, 0xEB, 0x8E, 0xD1, 0x4C, 0xEC, 0xED, 0x3C, 0xE2, 0x91, 0xC8, 0x45, 0xEE,
+    0x8D, 0x15, 0x57, 0x94, 0x71, 0x09, 0xC2, 0x40, 0x68, 0xC0, 0x40, 0x0B, 0xB6, 0xC2, 0xC4, 0xC2,
+    0x74, 0x04, 0xB7, 0x3E, 0x5B, 0x02, 0x1D, 0x75, 0x5A, 0xDD, 0xEA, 0x98, 0xE0, 0xB8, 0x1B, 0x8C,
+    0x96, 0xC6, 0x9C, 0x1D, 0x61, 0xA6, 0xFC, 0x7B, 0xEB, 0x3E, 0xB7, 0x1E, 0x38, 0xCF, 0x7E, 0x7C,
+    0x60, 0x79, 0xF9, 0x63, 0x64, 0x52, 0xE3, 0x1E, 0xD1, 0x28, 0xE3, 0xB5, 0x49, 0x09, 0x15, 0x44,
+    0x49, 0x4B, 0x1E, 0x73, 0x2E, 0xEE, 0xFC, 0x56, 0x06, 0xC8, 0x49, 0x39, 0xF8, 0xC9, 0xC8, 0xF9,
+    0x5B, 0x75, 0x74, 0x52, 0xDB, 0x68, 0xBA, 0x72, 0x21, 0x95, 0x6E, 0x57, 0x13, 0x0C, 0xB5, 0xC7,
+    0xB9, 0xCF, 0x79, 0x38, 0xAB, 0x65, 0x6C, 0x26, 0xE2, 0x95, 0x4E, 0xDC, 0x0B, 0xEA, 0x48, 0xF0,
+    0xA5, 0xEB, 0x7F, 0xFF, 0x09, 0xF0, 0xDB, 0x24, 0x18, 0xED, 0xE7, 0xBB, 0x54, 0x30, 0x15, 0x97,
+    0x4D, 0x92, 0x8E, 0x54, 0xAE, 0x36, 0xB4, 0xB8, 0xDD, 0x90, 0x2D, 0x28, 0x53, 0x3F, 0x67, 0x03,
+    0x66, 0x5D, 0xB0, 0x09, 0x11, 0xAB, 0xF3, 0x9A, 0xC2, 0x6B, 0x26, 0xDB, 0xFE, 0x7A, 0x9B, 0xE5,
+    0x02, 0xFE, 0xC0, 0x12, 0xA1, 0xE7, 0x14, 0x35, 0x3D, 0x61, 0xDA, 0xF3, 0xF3, 0xDC, 0x06, 0xAC,
+    0x91, 0x31, 0x68, 0xCF, 0x39, 0xD4, 0x94, 0xC8, 0x4E, 0x6D, 0x49, 0x96, 0x09, 0x62, 0x13, 0x6A,
+    0x00, 0xD7, 0xA2, 0x27, 0xE9, 0x3A, 0x85, 0x50, 0xE4, 0x59, 0x30, 0x24, 0x8B, 0x10, 0xF9, 0x77,
+    0x4D, 0xCE, 0x5B, 0x4A, 0x46, 0x44, 0x21, 0xA7, 0x98, 0x60, 0x67, 0xF2, 0x20, 0x9A, 0x53, 0xC0,
+    0x6D, 0x4C, 0x66, 0xCA, 0xD3, 0x4A, 0x54, 0x72, 0xBA, 0x0C, 0x37, 0x73, 0xB1, 0x93, 0x0A, 0x26,
+    0x1F, 0xEC, 0x50, 0x76, 0x84, 0xE2, 0xA3, 0x70, 0x83, 0x62, 0x74, 0xA0, 0x3E, 0x80, 0xBD, 0x12,
+    0xA5, 0xC7, 0x85, 0x0D, 0x1A, 0x81, 0x9F, 0x47, 0x87, 0xED, 0xFD, 0x04, 0x22, 0xD4, 0x0C, 0xF0,
+    0xA2, 0x46, 0x0D, 0xF4, 0x7F, 0xF3, 0x2B, 0xB9, 0xAF, 0x1A, 0x72, 0x1C, 0x95, 0x6E, 0x2B, 0x73,
+    0x0D, 0xFA, 0x77, 0xFC, 0x90, 0x2A, 0x47, 0x07, 0x3E, 0x53, 0x3C, 0x41, 0x45, 0x1B, 0xBD, 0xA2,
+    0xE8, 0xDF, 0x8E, 0xC6, 0x48, 0x5E, 0x0E, 0x4B, 0xE4, 0x0E, 0xB0, 0x0E, 0x90, 0x87, 0xA8, 0x07,
+    0x6C, 0xD6, 0xC3, 0xEB, 0x46, 0x2E, 0x94, 0x53, 0x09, 0x35, 0x36, 0x19, 0x1A, 0xDE, 0x77, 0x22,
+    0x65, 0xF1, 0xAD, 0xA4, 0x38, 0xE5, 0xE1, 0x60, 0x33, 0x88, 0x7B, 0xB7, 0x2B, 0x60, 0xA3, 0xCE,
+    0x4C, 0x41, 0x01, 0xC0, 0x5B, 0x93, 0xDC, 0xE2, 0x28, 0x27, 0xB9, 0x69, 0x71, 0x3E, 0x51, 0xB1,
+    0x83, 0x43, 0x41, 0x51, 0x85, 0xF8, 0x0C, 0xE1, 0x20, 0x04, 0x0D, 0x25, 0x48, 0x8C, 0x7F, 0x8C,
+    0x7F, 0x63, 0x88, 0x77, 0xB6, 0xFD, 0x17, 0xA7, 0x01, 0xAB, 0x21, 0xA7, 0x85, 0xC9, 0x4E, 0x3A,
+    0x1E, 0x97, 0x40, 0x68, 0xC1, 0xB8, 0x62, 0x3D, 0x4B, 0x52, 0x0D, 0x2B, 0x95, 0x9C, 0xA3, 0x4E,
+    0x0B, 0x67, 0x71, 0xE2, 0x45, 0x43, 0x3E, 0xA3, 0xFE, 0x00, 0xAF, 0xF7, 0xEE, 0x98, 0x64, 0x61,
+    0x03, 0xC2, 0x05, 0x38, 0x9F, 0x00, 0xE8, 0x15, 0x9F, 0x80, 0xF9, 0x3D, 0x02, 0x64, 0x08, 0xA2,
+    0xFA, 0xA4, 0x5E, 0x90, 0x1B, 0x7C, 0x9B, 0x9B, 0xF3, 0xAE, 0xBC, 0xF5, 0xC0, 0xA5, 0xAA, 0x0F,
+    0x4A, 0x71, 0xE2, 0x0D, 0x69, 0xFC, 0x6B, 0xD3, 0x8B, 0x6D, 0x52, 0x1D, 0xC7, 0x79, 0x5F, 0x90,
+    0xE5, 0x11, 0x0A, 0xBF, 0xB6, 0xD4, 0x4F, 0x52, 0xB9, 0xA1, 0xA9, 0x05, 0x0E, 0x50, 0x7E, 0xD9,
+    0x90, 0x42, 0xFD, 0x87, 0x1C, 0xE5, 0x54, 0x1A, 0xA8, 0x2C, 0x05, 0xAC, 0x4D, 0x4E, 0xB5, 0xA2,
+    0x76, 0xF1, 0x77, 0x76, 0x4E, 0x40, 0xE6, 0xE9, 0xC9, 0x9E, 0xD8, 0x4C, 0xBB, 0x46, 0x38, 0xC0,
+    0xA0, 0xD6, 0x64, 0x3A, 0xBC, 0x5C, 0xAE, 0x16, 0xE3, 0x8B, 0x23, 0x7F, 0x0C, 0x17, 0x49, 0x84,
+    0x93, 0x8F, 0x80, 0xB1, 0x2E, 0x65, 0xD4, 0xBD, 0x30, 0xA2, 0xEE, 0x5B, 0x96, 0xBA, 0x45, 0x0D,
+    0x77, 0x9C, 0x4B, 0x35, 0xCD, 0x7D, 0xD5, 0xD2, 0xDC, 0x0A, 0xA7, 0xB3, 0x94, 0x21, 0x1D, 0x54,
+    0xF3, 0x3A, 0xC2, 0xF4, 0x38, 0xD1, 0xF3, 0x9E, 0x39, 0x76, 0xB2, 0x3C, 0xB6, 0x99, 0x4F, 0xED,
+    0xB8, 0x1C, 0xEA, 0x70, 0xDA, 0xD9, 0xD0, 0xB1, 0x6F, 0xE5, 0xA0, 0x91, 0xAD, 0xF5, 0xDA, 0x96,
+    0xBA, 0x19, 0xA9, 0x02, 0xC7, 0x97, 0x3B, 0x18, 0x16, 0x15, 0x45, 0x0D, 0x70, 0x90, 0x23, 0x3B,
+    0xC9, 0x32, 0xEA, 0x8A, 0x55, 0x57, 0xB8, 0x42, 0x5C, 0x31, 0xBF, 0xFC, 0x0B, 0xE1, 0xCE, 0x90,
+    0xA0, 0x97, 0x52, 0x99, 0x91, 0x84, 0x8B, 0xF5, 0x98, 0x5A, 0x52, 0x9C, 0xAB, 0xF3, 0x5A, 0xCD,
+    0x58, 0xB6, 0xD1, 0x3C, 0xEF, 0x62, 0x65, 0xB1, 0x72, 0x92, 0x3D, 0x60, 0x3D, 0x70, 0xDE, 0x23,
+    0x9C, 0x90, 0x8D, 0xBC, 0x74, 0xC2, 0x5D, 0x11, 0x70, 0xD2, 0x85, 0xE1, 0xD2, 0x89, 0xE7, 0xC5,
+    0x8B, 0xE7, 0x7A, 0xF4, 0x6E, 0x05, 0x84, 0x87, 0xC6, 0xE5, 0x11, 0x96, 0x6E, 0x56, 0x52, 0x55,
+    0x73, 0x94, 0x04, 0xC8, 0xA3, 0x3D, 0x1F, 0x23, 0x4C, 0x46, 0x49, 0x78, 0xEF, 0x73, 0x53, 0x00,
+    0x6E, 0xB8, 0x6F, 0xF1, 0x99, 0x31, 0x41, 0x8D, 0xDC, 0x5D, 0x30, 0x81, 0x75, 0xB5, 0x10, 0x65,
+    0x7E, 0x45, 0x86, 0xB9, 0x59, 0x95, 0x33, 0x79, 0xBD, 0x76, 0x66, 0x86, 0xEB, 0x82, 0x67, 0xCA,
+    0xC6, 0xE1, 0xFA, 0x30, 0x51, 0xBE, 0xF7, 0xBA, 0xFB, 0x07, 0x8D, 0x55, 0x3D, 0x6C, 0x1C, 0x45,
+    0x14, 0x7E, 0xBB, 0x13, 0x7B, 0x45, 0x56, 0x62, 0x8C, 0x44, 0xAA, 0x90, 0x6C, 0x43, 0x11, 0xA4,
+    0x38, 0xDB, 0x52, 0xEC, 0xDD, 0xAC, 0xB1, 0x04, 0x05, 0x45, 0x5C, 0x98, 0x8A, 0x22, 0x14, 0x14,
+    0x74, 0xA1, 0x48, 0x41, 0x71, 0xCE, 0x6E, 0xEC, 0x22, 0x12, 0x11, 0x4A, 0x1A, 0x44, 0xEB, 0x06,
+    0x21, 0x41, 0x44, 0x90, 0x48, 0x91, 0x48, 0x67, 0xDF, 0x98, 0x2B, 0x90, 0x82, 0x44, 0xD6, 0x71,
+    0x91, 0x32, 0x2B, 0x25, 0x11, 0x52, 0x28, 0x32, 0x16, 0x2B, 0xD8, 0x38, 0xB3, 0xF7, 0xF8, 0xDE,
+    0x39, 0x8E, 0x82, 0x14, 0xA4, 0xAC, 0xF7, 0xCD, 0xDC, 0xAE, 0x77, 0xBE, 0x79, 0x3F, 0xDF, 0xF7,
+    0xC6, 0x50, 0xCA, 0x8D, 0xA7, 0x11, 0xEF, 0xB8, 0xB0, 0x21, 0x6D, 0xE3, 0x8A, 0x0C, 0x99, 0x9C,
+    0x3C, 0x75, 0xA4, 0x9C, 0xC2, 0xAB, 0x47, 0xD7, 0x6A, 0x32, 0xCC, 0x25, 0x31, 0x4F, 0x48, 0x31,
+    0xB7, 0xA4, 0x2B, 0x5D, 0x53, 0x91, 0x9B, 0x32, 0xE8, 0x88, 0x89, 0x32, 0xC5, 0x63, 0xDB, 0x5B,
+    0xCE, 0x22, 0xAB, 0xEC, 0x80, 0x7A, 0x98, 0xD8, 0x63, 0x85, 0x55, 0x0F, 0x87, 0xF2, 0x44, 0x72,
+    0x69, 0xE6, 0x1C, 0x00, 0x02, 0x37, 0x02, 0xB8, 0x02, 0x88, 0x35, 0xE5, 0xC1, 0x0F, 0xAE, 0x3C,
+    0x80, 0x4F, 0x5B, 0x53, 0x79, 0xBC, 0x89, 0x6E, 0x5B, 0x93, 0xF7, 0x7C, 0xD4, 0xE0, 0x47, 0x71,
+    0xD1, 0xFB, 0xA8, 0x2D, 0xDE, 0xCF, 0xDF, 0x59, 0xC8, 0x05, 0xA7, 0x60, 0xEC, 0x0C, 0x87, 0x06,
+    0x71, 0x4D, 0x2B, 0xCF, 0xCD, 0x3D, 0x33, 0xAE, 0x61, 0x9E, 0xE2, 0x66, 0x83, 0x62, 0xDB, 0x87,
+    0xA5, 0xFB, 0xF3, 0xB8, 0x83, 0x79, 0x9A, 0x59, 0x58, 0x9A, 0x3A, 0x93, 0xC2, 0x27, 0xB3, 0xBB,
+    0x49, 0xE9, 0x1E, 0xBB, 0x64, 0xAB, 0x39, 0x1F, 0xDB, 0x26, 0x5E, 0x73, 0x99, 0xAA, 0xDA, 0x24,
+    0x74, 0xFD, 0xE8, 0x4E, 0xAB, 0xED, 0x84, 0x57, 0x3B, 0xC3, 0x0E, 0x71, 0x77, 0x91, 0x84, 0x7C,
+    0xF4, 0xCA, 0x74, 0x25, 0x0D, 0x29, 0xE0, 0xB4, 0x6C, 0xCF, 0xB7, 0x83, 0x4C, 0x9F, 0xD2, 0xEA,
+    0xB7, 0xB5, 0xF1, 0x76, 0xF3, 0xD4, 0xE3, 0xB3, 0x55, 0x04, 0x18, 0xE4, 0xFB, 0xF0, 0x93, 0x80,
+    0x27, 0x11, 0x77, 0xBA, 0x39, 0x94, 0x58, 0xC9, 0xE5, 0xB3, 0xBB, 0x24, 0x53, 0xCF, 0x18, 0xBC,
+    0x17, 0x4C, 0x64, 0xAE, 0xA3, 0x1F, 0x89, 0x5A, 0x59, 0x31, 0x5A, 0xE0, 0xBA, 0xA3, 0x8C, 0x12,
+    0x8A, 0x2A, 0xEA, 0x3E, 0x49, 0x78, 0x96, 0x4B, 0x4F, 0x9F, 0x21, 0x5A, 0xBE, 0xC7, 0xFC, 0x0F,
+    0x23, 0xA6, 0x0D, 0xE0, 0xE6, 0x84, 0xEA, 0xA0, 0x4A, 0xF2, 0x00, 0x40, 0x5D, 0x11, 0xEA, 0x43,
+    0x13, 0x3C, 0xD4, 0xA4, 0x3D, 0x92, 0x4C, 0xA4, 0x6C, 0x81, 0x25, 0xEE, 0x38, 0x45, 0x65, 0x80,
+    0x2C, 0x09, 0xA2, 0x0D, 0x90, 0x11, 0x0A, 0x72, 0x43, 0xFA, 0x97, 0x26, 0x44, 0x6C, 0x86, 0x36,
+    0xE3, 0x5A, 0x39, 0x4F, 0xE9, 0x35, 0x14, 0xD5, 0x91, 0x06, 0x42, 0x61, 0x09, 0xA5, 0x10, 0x1F,
+    0x0F, 0x26, 0x4F, 0x2B, 0xA1, 0xF3, 0x7A, 0xD5, 0xAD, 0xA8, 0x3B, 0x4E, 0xDF, 0x2E, 0xD3, 0x21,
+    0x19, 0x47, 0x5C, 0x02, 0x4D, 0x61, 0x0D, 0x02, 0x23, 0x90, 0xE4, 0x05, 0xD0, 0x8D, 0xB8, 0x8E,
+    0x00, 0x6A, 0xCE, 0x96, 0x81, 0x80, 0x32, 0x25, 0xCC, 0x01, 0xE3, 0xE7, 0x7F, 0x40, 0xDF, 0xA4,
+    0xA5, 0x56, 0x8F, 0x91, 0xE5, 0x2D, 0xA7, 0x2F, 0x5B, 0xD3, 0xA3, 0x02, 0xA0, 0x36, 0xEC, 0xD4,
+    0x34, 0xD4, 0x7C, 0x0A, 0x1A, 0xAE, 0x23, 0x56, 0x6D, 0x7D, 0xD0, 0xC4, 0x35, 0xC8, 0xA8, 0x6D,
+    0xD0, 0xB5, 0x02, 0x48, 0xA6, 0x12, 0x08, 0x2A, 0x10, 0x2E, 0xE7, 0x6A, 0x02, 0xDA, 0x6A, 0x97,
+    0xD4, 0xA3, 0x35, 0x1F, 0x77, 0x44, 0x37, 0x88, 0xE2, 0x92, 0x68, 0x8E, 0xE6, 0x95, 0x75, 0xD7,
+    0xA3, 0x7B, 0x52, 0xE6, 0x16, 0x43, 0xC4, 0xD4, 0xB6, 0x06, 0xC9, 0xAA, 0xE9, 0x35, 0xDA, 0xE7,
+    0xD0, 0xFD, 0x4A, 0x0C, 0xEC, 0xFB, 0x7F, 0x63, 0xA9, 0xD0, 0x33, 0x23, 0x5A, 0x39, 0xB0, 0x51,
+    0xBB, 0x7D, 0xED, 0x9B, 0xFC, 0xDD, 0x63, 0x54, 0x9F, 0x53, 0x17, 0xAA, 0xD7, 0xA3, 0x3C, 0x3B,
+    0x8E, 0x4F, 0x84, 0xF0, 0xE4, 0x90, 0x7C, 0xA2, 0xE5, 0x60, 0x69, 0xA8, 0xEA, 0xFD, 0x7B, 0x30,
+    0xBD, 0x7B, 0x08, 0x82, 0x6B, 0x0D, 0xE2, 0xAA, 0xE7, 0xF7, 0x03, 0x89, 0x43, 0x42, 0x19, 0xE0,
+    0x5E, 0x3F, 0xE1, 0xB2, 0x9F, 0xF0, 0x77, 0x6E, 0x60, 0xFC, 0xCC, 0x00, 0x34, 0xC8, 0x90, 0xD6,
+    0x94, 0xF4, 0x5C, 0x70, 0x3C, 0xF8, 0x23, 0xBF, 0x59, 0x9D, 0xFA, 0xF9, 0xD2, 0xD5, 0xBF, 0xFE,
+    0xDC, 0xEC, 0x98, 0xCD, 0xD3, 0xAD, 0x5D, 0x97, 0x0D, 0x0E, 0x4B, 0x55, 0xE7, 0xE6, 0xAA, 0xFB,
+    0xEA, 0xAB, 0xDF, 0xCD, 0x0D, 0xAE, 0xFF, 0xBE, 0x70, 0x8B, 0xB2, 0x79, 0xE1, 0x12, 0xB0, 0x75,
+    0x49, 0x7D, 0x49, 0xA2, 0xE2, 0x56, 0x73, 0x63, 0xDE, 0x73, 0x6D, 0x34, 0xAE, 0x13, 0x5D, 0x0E,
+    0xFA, 0x81, 0xF3, 0xF1, 0xF6, 0xD2, 0x11, 0x70, 0x02, 0x34, 0x0E, 0x1D, 0xA4, 0x21, 0x5F, 0x4E,
+    0x90, 0x7A, 0xAF, 0xB7, 0x9B, 0x7E, 0x50, 0xCB, 0x97, 0x69, 0x52, 0x0E, 0x0B, 0xB5, 0xEB, 0x51,
+    0x60, 0x8A, 0x1F, 0xC0, 0x50, 0xC0, 0xA0, 0x4B, 0x51, 0x2A, 0x1A, 0x32, 0xAE, 0xBB, 0xB0, 0xC9,
+    0xCC, 0x99, 0xBD, 0x6F, 0x97, 0x84, 0x85, 0x14, 0x3D, 0xA1, 0x75, 0x68, 0x7D, 0x02, 0x59, 0x48,
+    0x80, 0x92, 0xAC, 0x60, 0x19, 0x86, 0xF9, 0x7C, 0x9B, 0x69, 0x35, 0x46, 0xFE, 0x8E, 0x32, 0x5F,
+    0x09, 0x6B, 0xA2, 0xE4, 0x51, 0x45, 0xA3, 0x0E, 0x5F, 0xA2, 0x4A, 0xB3, 0x4F, 0x84, 0xF6, 0x20,
+    0x1E, 0xB4, 0x2A, 0xE4, 0x19, 0x42, 0x42, 0xDC, 0x8C, 0x30, 0xD4, 0x47, 0x8A, 0x47, 0x5F, 0x13,
+    0x49, 0xD6, 0xC3, 0x49, 0xFE, 0xB6, 0x74, 0x9C, 0x8A, 0x22, 0x69, 0x1F, 0x21, 0x8B, 0x58, 0x6E,
+    0xCA, 0x3F, 0x2A, 0x0C, 0xB3, 0x52, 0x4B, 0xEC, 0x55, 0xB8, 0x4F, 0x93, 0x0F, 0x2E, 0x42, 0x23,
+    0x80, 0xB0, 0xA8, 0x9C, 0x04, 0x15, 0x4E, 0xAE, 0x82, 0x22, 0x96, 0x52, 0xE8, 0xE3, 0x73, 0x78,
+    0x09, 0x12, 0x8D, 0x9D, 0x7F, 0x61, 0x48, 0xAA, 0x7D, 0x3D, 0x53, 0x93, 0x61, 0x30, 0x2C, 0xA1,
+    0xC8, 0x40, 0x87, 0xE8, 0xE5, 0x57, 0xE0, 0x53, 0x48, 0xD4, 0x5C, 0x6A, 0x47, 0xA4, 0x76, 0x3B,
+    0xA8, 0x6F, 0x54, 0x9C, 0x2D, 0x49, 0x3F, 0x7E, 0x6C, 0x25, 0x74, 0xA0, 0xA5, 0x48, 0x14, 0x9C,
+    0xC5, 0x10, 0x4C, 0xB3, 0x20, 0xF9, 0x08, 0xA5, 0x65, 0x86, 0x3C, 0x1A, 0xD5, 0x8A, 0xCF, 0xDC,
+    0x05, 0x4D, 0x2E, 0xB6, 0x23, 0xB7, 0x8F, 0x17, 0xAF, 0xD6, 0xB2, 0x25, 0x16, 0x86, 0x92, 0x8F,
+    0x97, 0x5C, 0x91, 0x63, 0x5D, 0x85, 0xED, 0x24, 0x45, 0x9B, 0xDC, 0x2C, 0x10, 0xE7, 0x46, 0x27,
+    0xBB, 0xB4, 0xD2, 0x4C, 0x9D, 0xAC, 0x95, 0x0A, 0x61, 0x13, 0x78, 0xEF, 0x65, 0x3B, 0xCE, 0xE3,
+    0x8E, 0x8B, 0x2A, 0x6D, 0x38, 0x6D, 0xE7, 0x75, 0xD9, 0x6E, 0xA8, 0x1D, 0xA7, 0x8B, 0xBC, 0xDF,
+    0x06, 0x6C, 0xA3, 0x0E, 0x6A, 0xCC, 0x47, 0xBC, 0xDA, 0x98, 0x0F, 0xAD, 0x31, 0x84, 0x36, 0xBB,
+    0xBB, 0x94, 0xC8, 0xEB, 0xB4, 0x9E, 0xD6, 0x91, 0xDE, 0xFA, 0xE2, 0xA4, 0x3B, 0x55, 0x1B, 0x34,
+    0x65, 0xD3, 0x64, 0x83, 0xEC, 0xD8, 0x60, 0x9E, 0x7A, 0x90, 0x3A, 0xE0, 0x83, 0x8F, 0x96, 0x41,
+    0x71, 0x69, 0xE8, 0xC8, 0x9C, 0xB4, 0x0D, 0x6F, 0xA8, 0xAF, 0xAD, 0x5E, 0x73, 0xAA, 0x86, 0x44,
+    0x0D, 0xAD, 0x68, 0x9B, 0x2E, 0x7A, 0x63, 0xE1, 0x2E, 0x34, 0x0E, 0xA1, 0x45, 0x8E, 0x42, 0x4F,
+    0xB3, 0xDF, 0x87, 0x6C, 0xAF, 0xBB, 0xF9, 0x2C, 0x06, 0x0D, 0xAC, 0x73, 0x59, 0x66, 0xF4, 0x97,
+    0xA8, 0x8F, 0x43, 0xB1, 0x29, 0x55, 0x38, 0x6E, 0x30, 0x2D, 0x4E, 0x27, 0xB3, 0x88, 0x93, 0x46,
+    0xA6, 0xBD, 0x1F, 0x5A, 0x54, 0x71, 0x0D, 0x1D, 0x57, 0xA6, 0x46, 0x79, 0x9C, 0x32, 0x77, 0x1B,
+    0x05, 0x9E, 0xE0, 0xC4, 0xD1, 0xC2, 0x1D, 0x4B, 0xC9, 0x03, 0xF1, 0x37, 0x03, 0x66, 0x96, 0x45,
+    0x63, 0x3B, 0xE8, 0x45, 0x63, 0xA9, 0xFD, 0xF8, 0xE1, 0xB0, 0x17, 0xD5, 0x28, 0xBE, 0xAE, 0x03,
+    0xE1, 0xC9, 0x2B, 0xEF, 0xD1, 0x62, 0x8F, 0x5F, 0x1B, 0xD5, 0x4D, 0xF7, 0x10, 0xDE, 0x81, 0xFA,
+    0x70, 0x5F, 0xFA, 0x95, 0x6C, 0x63, 0x9D, 0x56, 0x36, 0xD3, 0x81, 0xEB, 0x7F, 0x6C, 0xA7, 0x4A,
+    0xD7, 0x0B, 0xAE, 0x87, 0x36, 0xAD, 0xA7, 0xEA, 0x71, 0x34, 0x5B, 0x1E, 0x09, 0x96, 0x7C, 0xBC,
+    0x53, 0x27, 0xA7, 0xCB, 0x95, 0x7E, 0xD0, 0xDC, 0x88, 0xEE, 0x38, 0xB3, 0x28, 0x2D, 0xBE, 0x11,
+    0x85, 0x25, 0xA2, 0xF1, 0xE0, 0xA0, 0x61, 0x42, 0x4B, 0xF9, 0xDC, 0x1B, 0x5B, 0xB7, 0xE2, 0x13,
+    0x27, 0xD7, 0x77, 0x79, 0xEB, 0x3B, 0x1A, 0x2A, 0xA7, 0xA1, 0xF7, 0x39, 0x63, 0x23, 0xA7, 0x11,
+    0x2F, 0x42, 0x65, 0xF4, 0xC3, 0x51, 0x65, 0x5A, 0xD3, 0x68, 0x4E, 0x20, 0xCE, 0x7B, 0x9C, 0x4F,
+    0xF8, 0x69, 0x65, 0xCC, 0x5E, 0xA3, 0x6F, 0x77, 0x13, 0xB5, 0xCB, 0xA6, 0xF4, 0xE6, 0x72, 0x5D,
+    0xE8, 0x9D, 0x36, 0xA9, 0x96, 0x26, 0x72, 0xBA, 0x82, 0x0F, 0xE2, 0xB2, 0x9C, 0x05, 0x72, 0x32,
+    0x10, 0xCE, 0x1D, 0x3A, 0x7C, 0x85, 0x5E, 0xE1, 0xFA, 0x17, 0x8D, 0x55, 0x3D, 0x6C, 0x1C, 0x45,
+    0x14, 0x7E, 0xBB, 0x83, 0xB3, 0x82, 0x15, 0x9A, 0x14, 0x48, 0x08, 0x45, 0x30, 0x0D, 0x14, 0x14,
+    0x64, 0x5A, 0x0A, 0xDF, 0xCE, 0x5A, 0x48, 0xB8, 0xA0, 0xB0, 0x0B, 0xA0, 0x41, 0xA2, 0x46, 0x21,
+    0x92, 0x1B, 0x2A, 0xE4, 0xBB, 0x5D, 0xE2, 0x22, 0x65, 0xDC, 0x50, 0x47, 0x20, 0x42, 0xE1, 0x14,
+    0x69, 0x5D, 0x9C, 0xBD, 0x93, 0x2C, 0x92, 0x0B, 0x17, 0xAC, 0x63, 0x89, 0x14, 0x29, 0xB2, 0x81,
+    0xFC, 0x48, 0x34, 0x19, 0x27, 0xA3, 0x64, 0x4C, 0x66, 0xF7, 0xF1, 0xE6, 0x92, 0xF3, 0x9F, 0x00,
+    0x31, 0xC5, 0xEA, 0x76, 0xF6, 0xE6, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xDF, 0xA8, 0xC8, 0x28, 0x66,
+    0xD4, 0x45, 0xA3, 0xB6, 0x8D, 0x7A, 0x64, 0x06, 0xBD, 0x99, 0xED, 0xEC, 0xEC, 0xD8, 0x0E, 0xDE,
+    0xB3, 0x00, 0x43, 0x80, 0x65, 0x80, 0x31, 0x80, 0x5D, 0xA6, 0x35, 0x0C, 0x6B, 0x30, 0x18, 0xBC,
+    0x0F, 0xB4, 0xE4, 0x55, 0x1D, 0xA1, 0x85, 0xB4, 0x87, 0xE9, 0xE2, 0x39, 0xC4, 0x1E, 0x40, 0x35,
+    0x90, 0xD0, 0xE6, 0x5F, 0x06, 0xC4, 0x42, 0x1E, 0x1B, 0x0F, 0x2A, 0x6D, 0x92, 0x76, 0x04, 0x88,
+    0x46, 0x20, 0x5E, 0x40, 0xF4, 0x2A, 0xE7, 0xB7, 0x0C, 0xF4, 0xA7, 0x67, 0xD8, 0x9F, 0x46, 0xF5,
+    0x50, 0xE5, 0x93, 0xE3, 0xC9, 0xF3, 0xEF, 0xD0, 0x0F, 0x78, 0x5D, 0x2E, 0x7F, 0xC3, 0xB6, 0xF2,
+    0xA1, 0xC2, 0x9B, 0xD8, 0xA7, 0xCF, 0x5A, 0xB0, 0x16, 0xF8, 0x42, 0x1E, 0xED, 0xBB, 0x03, 0x20,
+    0x4A, 0x4C, 0x6A, 0x60, 0x1D, 0x40, 0xD1, 0x02, 0xBF, 0x06, 0x11, 0xFD, 0x45, 0x72, 0xCD, 0xCC,
+    0x06, 0x8C, 0x92, 0x96, 0x23, 0x46, 0x88, 0x4E, 0x22, 0xD6, 0x16, 0xBA, 0x02, 0x78, 0x9B, 0x49,
+    0xF6, 0xBB, 0x2D, 0xD4, 0xC7, 0x3F, 0xFE, 0xF4, 0x9F, 0x40, 0xF0, 0x73, 0x85, 0x00, 0x9B, 0x88,
+    0x25, 0x28, 0xBC, 0x92, 0xD3, 0xA3, 0x04, 0x10, 0x04, 0x01, 0xFC, 0x52, 0xF7, 0x15, 0x24, 0xBB,
+    0x88, 0xC0, 0x4C, 0x85, 0x3A, 0xB6, 0x82, 0x36, 0x09, 0x03, 0xA0, 0x42, 0x5C, 0x5B, 0x2D, 0x30,
+    0x14, 0x55, 0x12, 0xB0, 0xD0, 0x0C, 0xB1, 0x39, 0x48, 0x34, 0xEA, 0x1F, 0x38, 0xCA, 0x05, 0xB5,
+    0x55, 0x3B, 0xEB, 0x1F, 0x26, 0x88, 0x6F, 0x43, 0xFF, 0xFD, 0x7C, 0x5E, 0xC0, 0xE9, 0x70, 0x82,
+    0x32, 0xC4, 0xB8, 0xC3, 0x3E, 0x94, 0x3F, 0x16, 0x44, 0x66, 0x1C, 0x00, 0x5F, 0x72, 0x49, 0x01,
+    0xB1, 0xED, 0x16, 0x19, 0x15, 0x48, 0xE9, 0x7C, 0x0E, 0xE8, 0x19, 0x1A, 0xFA, 0x99, 0x51, 0xD0,
+    0xB5, 0x79, 0xEC, 0x05, 0xFA, 0x02, 0xCD, 0x2B, 0xD1, 0xDC, 0xFE, 0x98, 0x63, 0x5E, 0x1C, 0x62,
+    0x42, 0xDC, 0x41, 0xEF, 0xB2, 0x37, 0x6B, 0xEC, 0x47, 0x57, 0xE6, 0x1B, 0xAA, 0xE2, 0x2E, 0xF6,
+    0x31, 0x06, 0x90, 0x18, 0x57, 0x29, 0xBD, 0xD0, 0x88, 0x6F, 0xAF, 0x11, 0x79, 0xAA, 0x04, 0xB6,
+    0xB7, 0x16, 0xE2, 0xF4, 0x94, 0xFA, 0x47, 0x2D, 0xD7, 0xA3, 0xB4, 0x4D, 0xB1, 0x85, 0xA5, 0xD5,
+    0x10, 0x47, 0xB8, 0x14, 0xA9, 0xDA, 0x5F, 0xA8, 0xFD, 0xC9, 0x6D, 0xEC, 0x0A, 0xAC, 0xF5, 0xBA,
+    0xA8, 0xA0, 0x98, 0xE6, 0x48, 0xA4, 0x0F, 0x87, 0x20, 0x2E, 0x4F, 0xDF, 0xAB, 0x7B, 0x14, 0x59,
+    0x2B, 0xF4, 0xEF, 0x5C, 0x25, 0x34, 0x4E, 0x0C, 0xF9, 0x73, 0x15, 0x52, 0xCB, 0x57, 0x88, 0x12,
+    0xC7, 0x8C, 0xB8, 0xE0, 0x62, 0xA2, 0xEC, 0xCC, 0xBD, 0x7F, 0x0B, 0x2E, 0x43, 0x70, 0x21, 0xE2,
+    0xC7, 0x46, 0xA9, 0xC3, 0x72, 0xC6, 0xE3, 0x30, 0x6C, 0x32, 0x70, 0xF2, 0xAB, 0x86, 0x7F, 0x5C,
+    0xCC, 0x14, 0xB5, 0x83, 0x4A, 0xEC, 0x79, 0xE0, 0xBB, 0xAE, 0x83, 0xC8, 0xF7, 0x15, 0x95, 0x57,
+    0xD1, 0x83, 0x85, 0x6E, 0x52, 0x97, 0x74, 0xA0, 0xB4, 0x09, 0xEF, 0xD4, 0xB4, 0x24, 0x6C, 0x26,
+    0xA1, 0x7F, 0x69, 0xDF, 0xA3, 0x4E, 0x7B, 0x75, 0xC9, 0xA7, 0x28, 0xEE, 0x4E, 0x3B, 0xC7, 0x76,
+    0xE9, 0x47, 0x72, 0x2B, 0x3C, 0x1E, 0xB6, 0x27, 0xC1, 0x4E, 0xAD, 0xAE, 0xBD, 0x56, 0x32, 0x4B,
+    0xAD, 0x26, 0x18, 0xCA, 0x73, 0x73, 0x73, 0x83, 0xB0, 0x36, 0x7D, 0x00, 0x30, 0x21, 0x36, 0x1D,
+    0x4B, 0xC3, 0x43, 0x51, 0xFC, 0xD0, 0x7C, 0x48, 0x3A, 0xAC, 0x1A, 0x69, 0x51, 0x12, 0xB4, 0x10,
+    0xE9, 0xF6, 0x8D, 0xA7, 0xF6, 0x20, 0x9A, 0xB4, 0x02, 0xE7, 0x62, 0x43, 0x2A, 0x93, 0x8C, 0x3A,
+    0x53, 0x12, 0x1F, 0xE2, 0xDD, 0x74, 0x1B, 0x1F, 0xA3, 0x5B, 0xB2, 0x30, 0x18, 0x64, 0x59, 0xE0,
+    0x22, 0xB1, 0xAF, 0x9E, 0x87, 0xD7, 0xA3, 0xF3, 0xCC, 0xC3, 0x07, 0x33, 0x5F, 0xF2, 0x2E, 0x75,
+    0x01, 0xAD, 0x26, 0xBC, 0x31, 0x6C, 0x40, 0x17, 0x68, 0xF3, 0x20, 0x72, 0xD6, 0xFE, 0xE0, 0xB0,
+    0x93, 0x08, 0x9B, 0x30, 0xFD, 0xEE, 0x8F, 0x7F, 0xBF, 0x7B, 0xF8, 0x1D, 0xE2, 0xCA, 0xC4, 0xD8,
+    0xC1, 0x67, 0x8B, 0xC7, 0xEB, 0x1B, 0xC2, 0x1B, 0x3C, 0x57, 0x2B, 0xAD, 0x68, 0x1D, 0x77, 0x59,
+    0x82, 0x7C, 0x05, 0xEB, 0xBD, 0xE7, 0xC6, 0x77, 0x5E, 0x8D, 0x0A, 0x8E, 0xA2, 0xC6, 0x8B, 0xB6,
+    0xDA, 0xE9, 0xA4, 0xA9, 0x3E, 0xB1, 0x92, 0xD8, 0xC9, 0x0B, 0x64, 0x14, 0x66, 0xDA, 0x0A, 0xAD,
+    0x78, 0xEC, 0x67, 0xB9, 0x31, 0x58, 0xDF, 0x7E, 0xC4, 0x47, 0xCB, 0x6A, 0xCF, 0xE0, 0x7C, 0xED,
+    0xC5, 0x82, 0x26, 0x2F, 0x81, 0x74, 0x5B, 0x53, 0x7B, 0xC1, 0xFB, 0x63, 0x90, 0x91, 0x85, 0xC5,
+    0x01, 0xF4, 0xBC, 0x2C, 0x56, 0x5A, 0xD5, 0x3A, 0xE1, 0x33, 0x8E, 0x7C, 0xEB, 0x51, 0xFD, 0xE4,
+    0x99, 0xE9, 0xF6, 0xBD, 0xF2, 0x05, 0xEF, 0xC5, 0x4D, 0x9C, 0xB7, 0xD5, 0x8D, 0x4E, 0x36, 0x55,
+    0x49, 0x41, 0x88, 0x94, 0x69, 0x0C, 0xC3, 0x6B, 0x5D, 0x71, 0xE6, 0x67, 0x95, 0x79, 0xFA, 0xBC,
+    0xBE, 0x73, 0x99, 0xFB, 0x65, 0xB5, 0x63, 0x30, 0xD9, 0x35, 0x22, 0xCC, 0xFC, 0xFA, 0x3A, 0xB0,
+    0x27, 0xE6, 0xE8, 0xEC, 0x44, 0xD5, 0x2A, 0x48, 0x6C, 0x59, 0xBF, 0xD4, 0x0A, 0xCD, 0x1B, 0x22,
+    0xA6, 0x36, 0xA0, 0x48, 0x5A, 0x7E, 0x44, 0x93, 0x44, 0x23, 0x54, 0x77, 0x11, 0x92, 0x20, 0x3C,
+    0x8D, 0x6E, 0x23, 0xB1, 0x87, 0x33, 0x38, 0xD1, 0xC3, 0xD9, 0xB3, 0x84, 0x19, 0x62, 0x1D, 0x59,
+    0xB2, 0x49, 0xB0, 0xCD, 0x92, 0x1D, 0xC3, 0x2F, 0x52, 0xE1, 0xBF, 0x39, 0x85, 0x4D, 0xD1, 0xD3,
+    0x2E, 0xBC, 0x45, 0xFE, 0xE0, 0x82, 0x1E, 0x30, 0xB1, 0x05, 0x14, 0xA2, 0xE4, 0xDB, 0x48, 0x4D,
+    0x45, 0x5F, 0x81, 0x12, 0xF7, 0xAB, 0x1A, 0xB1, 0x25, 0xF9, 0xA6, 0x64, 0xA0, 0x4B, 0x2D, 0x29,
+    0x36, 0x42, 0xA2, 0xFA, 0xD6, 0x83, 0xCD, 0x02, 0x9F, 0xDD, 0xDF, 0x54, 0xB8, 0x83, 0x2E, 0x7E,
+    0x41, 0xA9, 0x73, 0x90, 0x65, 0x20, 0xEE, 0x4C, 0xB2, 0x3F, 0x45, 0x9E, 0xD4, 0xD3, 0x5C, 0x19,
+    0x75, 0xBD, 0x13, 0x5A, 0x6C, 0xB5, 0x6C, 0x12, 0x11, 0x51, 0x6A, 0xBE, 0xB5, 0xBF, 0x64, 0x68,
+    0xA2, 0xC9, 0x16, 0x42, 0x53, 0xCF, 0xB8, 0xE0, 0x99, 0xCE, 0x4D, 0xD5, 0x29, 0x1B, 0x81, 0x2B,
+    0xED, 0x70, 0xF4, 0xF5, 0x43, 0xC4, 0xD1, 0x17, 0x7F, 0x60, 0x27, 0xB0, 0xA4, 0x2C, 0x49, 0xC2,
+    0x21, 0xFA, 0x81, 0x84, 0x5F, 0x1A, 0x48, 0x9F, 0x93, 0x4C, 0x98, 0x95, 0x17, 0x4C, 0x64, 0x3F,
+    0x25, 0xC7, 0x99, 0xC8, 0x9A, 0xEA, 0x0E, 0xE6, 0xAE, 0xCA, 0xE2, 0x12, 0x52, 0x82, 0x94, 0x04,
+    0xDA, 0x08, 0x5F, 0xCA, 0x43, 0xCA, 0x74, 0xBB, 0x0E, 0xD4, 0x88, 0xEE, 0x14, 0x6B, 0x68, 0x9A,
+    0x05, 0x23, 0x09, 0xEC, 0xE5, 0xE3, 0xCA, 0xA7, 0x13, 0xDF, 0x56, 0x38, 0x47, 0xB6, 0x7C, 0x62,
+    0xD0, 0xAC, 0x4F, 0xAF, 0xDB, 0x8C, 0x19, 0x9B, 0x3C, 0xD4, 0xBC, 0x07, 0x61, 0x41, 0x69, 0x28,
+    0xC2, 0x38, 0xF0, 0xF0, 0xAE, 0xE8, 0x8E, 0x00, 0x98, 0x39, 0xB7, 0xAA, 0xF0, 0xFA, 0xDA, 0x95,
+    0xE3, 0x53, 0x3A, 0x00, 0x37, 0x66, 0x8D, 0x13, 0xB1, 0x75, 0xEC, 0x49, 0x93, 0x22, 0x70, 0x17,
+    0x68, 0x57, 0x21, 0xC9, 0x34, 0xBC, 0x4B, 0x1B, 0xA6, 0x3C, 0xD9, 0xD2, 0x42, 0xC0, 0xC6, 0xC6,
+    0xF4, 0xD8, 0x4C, 0x3E, 0x23, 0xC8, 0xF1, 0x63, 0x33, 0xE2, 0xA5, 0x1F, 0x44, 0xFB, 0x86, 0x61,
+    0x99, 0x74, 0xC0, 0xE9, 0xAE, 0xD2, 0x94, 0x10, 0x0B, 0xEF, 0xDC, 0x07, 0x67, 0x0C, 0x0A, 0x5A,
+    0xC8, 0x87, 0xC3, 0xA3, 0xF7, 0xCE, 0xFF, 0x86, 0x85, 0x71, 0x64, 0xB9, 0x96, 0x73, 0x44, 0xE2,
+    0xD1, 0x31, 0x5F, 0x8C, 0xF2, 0xA4, 0x11, 0x39, 0xD7, 0x24, 0xF2, 0x95, 0x96, 0x66, 0x2E, 0x87,
+    0x11, 0x5D, 0xAF, 0x44, 0x62, 0x44, 0x8E, 0x49, 0xE2, 0x86, 0x24, 0x50, 0x98, 0x4F, 0x98, 0xA6,
+    0x5D, 0x72, 0x84, 0x89, 0x8F, 0xC6, 0x26, 0x69, 0x15, 0x5D, 0x6D, 0x26, 0x6D, 0x4E, 0x98, 0x11,
+    0xCF, 0x33, 0x90, 0x74, 0x1F, 0x66, 0x89, 0x86, 0x8D, 0x8C, 0xCE, 0x59, 0x32, 0x79, 0xBA, 0x1A,
+    0x89, 0xB7, 0x94, 0xA0, 0x39, 0x8D, 0x0D, 0xE5, 0x16, 0xBF, 0xD8, 0x4D, 0x69, 0xA4, 0x64, 0x79,
+    0xD2, 0xCF, 0xFE, 0x06, 0x75, 0x55, 0x41, 0x6C, 0xDC, 0x44, 0x14, 0xFD, 0xF6, 0x40, 0x5D, 0xD6,
+    0xA5, 0xD3, 0x43, 0x2F, 0x94, 0xB2, 0xEE, 0xB1, 0x44, 0x69, 0x5C, 0xA1, 0x54, 0xDA, 0x4A, 0xBB,
+    0x3B, 0xA3, 0xEC, 0xA1, 0x87, 0x82, 0xC8, 0xA1, 0xBD, 0xA0, 0x54, 0xE4, 0xC0, 0xA1, 0x42, 0x48,
+    0x95, 0x50, 0x85, 0x52, 0x69, 0x13, 0xBB, 0x8D, 0x20, 0xB7, 0x76, 0xE1, 0xC2, 0xA5, 0xA0, 0x54,
+    0x44, 0x28, 0x89, 0x8A, 0xA8, 0x44, 0x0F, 0x41, 0xDA, 0x76, 0x27, 0x59, 0x41, 0x24, 0x7A, 0x88,
+    0x93, 0x45, 0xE2, 0x88, 0x0B, 0x88, 0x1E, 0x8A, 0xE8, 0x44, 0x9D, 0x80, 0x4B, 0xED, 0x1D, 0xFE,
+    0x78, 0xB7, 0x6D, 0xA8, 0xCA, 0x8C, 0xED, 0xF9, 0x1E, 0xCF, 0xFC, 0xF9, 0xFF, 0xFD, 0xF7, 0xBF,
+    0x01, 0xDC, 0x5B, 0xED, 0xFB, 0x32, 0x4D, 0x01, 0x8A, 0xD6, 0x1D, 0xFE, 0x6D, 0x34, 0x74, 0xCD,
+    0xBD, 0x4A, 0xEE, 0x9E, 0x7F, 0xA0, 0x35, 0x7B, 0xB8, 0xFC, 0xB1, 0x84, 0x3A, 0x78, 0xE0, 0x08,
+    0x80, 0x7A, 0xBD, 0xD9, 0xCC, 0x32, 0x80, 0xE1, 0xD2, 0x70, 0xE9, 0x70, 0x69, 0x78, 0x89, 0x25,
+    0x85, 0xD3, 0x50, 0xC2, 0x0E, 0xA0, 0x75, 0x5B, 0x6B, 0x2A, 0x80, 0x01, 0xA4, 0x40, 0x24, 0x3C,
+    0x25, 0x0A, 0xF8, 0x1A, 0xA0, 0x0C, 0x70, 0x0D, 0x58, 0x3A, 0x35, 0x3F, 0x01, 0x13, 0xA8, 0xB3,
+    0xD7, 0xA7, 0x60, 0x37, 0xBC, 0x00, 0x79, 0xAB, 0x56, 0x01, 0xE8, 0x9A, 0x00, 0x72, 0x5F, 0xC2,
+    0xB3, 0x1A, 0x2A, 0x04, 0xB7, 0x1D, 0x82, 0x2D, 0xF1, 0x7B, 0x13, 0xB5, 0xF9, 0xD4, 0x4C, 0x08,
+    0x9C, 0xD0, 0x0A, 0x9A, 0x4C, 0x73, 0xFF, 0x4D, 0x22, 0xDD, 0x8E, 0x68, 0xDA, 0x6A, 0xAB, 0x05,
+    0x37, 0x71, 0x82, 0x5D, 0xD2, 0x9C, 0xC6, 0xB8, 0xCF, 0xDA, 0x94, 0x30, 0x39, 0x09, 0xFE, 0x19,
+    0xBE, 0x5D, 0xE3, 0x41, 0x3C, 0x70, 0x3F, 0x90, 0x55, 0x80, 0x4D, 0x01, 0xE5, 0x73, 0x9C, 0x7A,
+    0x29, 0x59, 0x3D, 0x1E, 0x6E, 0x45, 0x71, 0x25, 0x48, 0xE8, 0xDB, 0x09, 0x89, 0xBC, 0xD0, 0x15,
+    0x54, 0xD0, 0x90, 0x48, 0x06, 0xB6, 0xBA, 0x01, 0x90, 0x21, 0x4A, 0x01, 0x9E, 0xCF, 0x50, 0xAB,
+    0x1F, 0xE1, 0x88, 0xB2, 0x4E, 0xC1, 0xEE, 0x76, 0xC1, 0x51, 0x7A, 0x9C, 0x4A, 0x96, 0x32, 0xE1,
+    0x23, 0x48, 0xEE, 0x6F, 0xE6, 0x84, 0xA2, 0x1D, 0xD1, 0x63, 0x21, 0xF9, 0x19, 0xEC, 0xCC, 0xC0,
+    0x61, 0x65, 0x40, 0x34, 0xD0, 0x4B, 0x91, 0xEF, 0xE0, 0x1E, 0x85, 0x0B, 0x5A, 0xFA, 0x9E, 0x96,
+    0xFD, 0x07, 0x3E, 0xB5, 0x71, 0x9D, 0x6A, 0xDD, 0xD1, 0x5A, 0x9D, 0x3C, 0x79, 0xC2, 0xA8, 0x20,
+    0x1A, 0x1B, 0xC3, 0x7B, 0xF3, 0x24, 0xB6, 0x67, 0xCD, 0x2C, 0x1D, 0xBA, 0x5E, 0xC1, 0x5E, 0xEE,
+    0x75, 0x85, 0x5D, 0x6E, 0xEB, 0xB8, 0x50, 0xE1, 0xDA, 0xE8, 0x11, 0x8A, 0xFD, 0xD7, 0x45, 0x57,
+    0x06, 0x44, 0xB1, 0x0B, 0xE9, 0xC0, 0x74, 0xCA, 0xA6, 0x55, 0x40, 0xE3, 0xC7, 0xC2, 0xE3, 0x4F,
+    0x8B, 0xFB, 0x3E, 0x49, 0xD9, 0x8C, 0xCC, 0xE8, 0x46, 0x82, 0x43, 0x8B, 0x46, 0x03, 0x1F, 0xCD,
+    0x69, 0xAF, 0x93, 0x04, 0x38, 0x11, 0x50, 0x1C, 0xE1, 0xC9, 0x9E, 0xA7, 0x97, 0x02, 0x07, 0x0C,
+    0x8F, 0x44, 0xEA, 0x58, 0xBD, 0x07, 0xD1, 0x69, 0x4B, 0x7F, 0xE7, 0x9F, 0xE8, 0xBF, 0x82, 0x8F,
+    0x71, 0x7B, 0xFC, 0x88, 0x61, 0x08, 0x20, 0x86, 0x1D, 0x00, 0x7B, 0x8C, 0x91, 0x8D, 0xDE, 0x5E,
+    0xDA, 0xDB, 0x6B, 0x6F, 0x1D, 0x33, 0x7B, 0xA3, 0x6D, 0xAA, 0x92, 0x96, 0x16, 0x3E, 0x7F, 0xA4,
+    0x60, 0x37, 0xC0, 0x38, 0xD8, 0x7D, 0x68, 0xD0, 0x43, 0x69, 0x86, 0x40, 0x2B, 0x57, 0x6B, 0xAE,
+    0x75, 0x82, 0x78, 0x86, 0x5A, 0xA7, 0x9E, 0xD6, 0x2B, 0x38, 0xF8, 0x39, 0xBA, 0xD9, 0xC0, 0xE2,
+    0x62, 0x03, 0x48, 0x18, 0xCC, 0x64, 0x41, 0x0D, 0x49, 0x71, 0x70, 0xF2, 0x66, 0xCB, 0xDC, 0xAF,
+    0xDA, 0x8D, 0xD3, 0x55, 0x27, 0x4E, 0x03, 0x37, 0x4E, 0x5B, 0xAE, 0xCC, 0xCE, 0xC5, 0xCF, 0xC3,
+    0xE0, 0x8E, 0xD1, 0xA2, 0x3D, 0x4F, 0xE1, 0x4B, 0x37, 0x2C, 0xCE, 0x08, 0xD2, 0x8E, 0x8C, 0x1D,
+    0x80, 0xD1, 0x6B, 0x62, 0x4E, 0x20, 0x6F, 0x0F, 0xCE, 0x7A, 0xC5, 0xA3, 0xF4, 0xC3, 0x1F, 0x8E,
+    0x8B, 0x5F, 0x56, 0x1A, 0x00, 0x85, 0x59, 0x26, 0xBA, 0x44, 0x7A, 0xA2, 0x0B, 0x85, 0x2B, 0x0B,
+    0x74, 0x33, 0xA3, 0xB7, 0x53, 0xBA, 0x92, 0x78, 0x6D, 0x85, 0xC8, 0x18, 0x1B, 0x57, 0xD6, 0x37,
+    0xA4, 0x4A, 0xD4, 0x52, 0xF3, 0x6C, 0xA9, 0x9C, 0xC7, 0x84, 0x92, 0xA8, 0xEE, 0x1A, 0x61, 0x42,
+    0xD6, 0x93, 0xA1, 0x32, 0x7D, 0x25, 0x9F, 0x2D, 0x16, 0xA9, 0xB3, 0xDA, 0x89, 0x97, 0x9A, 0x65,
+    0xEA, 0x3A, 0x39, 0x6F, 0xAF, 0x83, 0x17, 0xB9, 0xF7, 0x46, 0xE6, 0x16, 0x00, 0x0E, 0x94, 0xAB,
+    0x93, 0xCC, 0x89, 0xA7, 0x9C, 0x70, 0x14, 0x3D, 0x2F, 0xD9, 0xD2, 0x8D, 0x18, 0xDD, 0x50, 0x87,
+    0x2C, 0x5C, 0x38, 0x67, 0x54, 0x86, 0x48, 0x7A, 0x43, 0x38, 0xBF, 0xAD, 0x5C, 0x09, 0x5D, 0xCC,
+    0x41, 0xCC, 0xC2, 0x2E, 0x8A, 0xCE, 0x3F, 0x19, 0x54, 0x7D, 0x3D, 0xF3, 0x53, 0xAC, 0xE5, 0x8D,
+    0xC0, 0xCD, 0xDC, 0xDF, 0xAF, 0x68, 0xB9, 0x80, 0x70, 0x09, 0xF0, 0x1E, 0x6A, 0x44, 0x90, 0xA6,
+    0xA0, 0x45, 0x20, 0x99, 0xB4, 0x70, 0x2A, 0x07, 0xD5, 0x64, 0xD0, 0x14, 0xDE, 0x8E, 0x31, 0xFF,
+    0xDD, 0x3C, 0x40, 0x14, 0x14, 0xE5, 0xE6, 0xF2, 0x2C, 0x89, 0x17, 0xE9, 0x91, 0x0B, 0x59, 0x33,
+    0x9D, 0x04, 0xDF, 0xCF, 0x1B, 0x39, 0x04, 0x92, 0x53, 0x00, 0xAB, 0x47, 0x66, 0xEB, 0xCC, 0x3D,
+    0x93, 0xC2, 0x0D, 0x65, 0xDF, 0x8F, 0xDC, 0x35, 0xCE, 0xEA, 0x60, 0x62, 0x04, 0x54, 0x02, 0xE3,
+    0x90, 0x99, 0x03, 0x9E, 0xEB, 0xD3, 0x13, 0x0B, 0x86, 0x27, 0x20, 0x30, 0xF9, 0x42, 0x95, 0xC9,
+    0xB2, 0x3C, 0x37, 0xD0, 0x9F, 0x5A, 0x5B, 0x4B, 0xDF, 0x18, 0x62, 0x18, 0xF2, 0xC6, 0x28, 0x30,
+    0x85, 0xA7, 0x81, 0xAD, 0x43, 0xF8, 0xBC, 0x01, 0xAF, 0x5D, 0xDC, 0xF3, 0xA7, 0x56, 0x7E, 0x27,
+    0xC1, 0x88, 0x4F, 0x7F, 0xF0, 0x16, 0xEC, 0xEC, 0xA1, 0x45, 0x04, 0x54, 0x4C, 0xAC, 0xD0, 0x8A,
+    0x25, 0x53, 0xC1, 0xAA, 0x86, 0x2C, 0x94, 0x63, 0xDC, 0x9C, 0xA8, 0xF7, 0xF2, 0xA4, 0xDD, 0xE4,
+    0x6E, 0x62, 0xEB, 0xC4, 0xD3, 0xE2, 0x81, 0x77, 0x69, 0x3D, 0xDD, 0x6B, 0xCB, 0xD0, 0x33, 0xC6,
+    0x93, 0x08, 0x29, 0x87, 0xC1, 0x76, 0x8C, 0x2E, 0x34, 0x94, 0xC1, 0xCB, 0x12, 0x5A, 0x1C, 0x8D,
+    0x6B, 0x71, 0x92, 0xDB, 0x9F, 0x02, 0xB2, 0x9D, 0x19, 0xCB, 0x5F, 0x32, 0xCC, 0xFD, 0x4F, 0x7D,
+    0xB1, 0x1B, 0xE0, 0x71, 0x48, 0xC0, 0x8D, 0xD1, 0x27, 0x92, 0x18, 0xDF, 0xF2, 0x86, 0xA5, 0xE3,
+    0x00, 0x1E, 0x45, 0xA6, 0xD5, 0x14, 0x94, 0xF7, 0x5A, 0x12, 0xB5, 0x53, 0x8E, 0x5C, 0x52, 0x2E,
+    0x46, 0x01, 0xED, 0xC3, 0x3A, 0x26, 0x10, 0x02, 0x8C, 0x04, 0xC7, 0xF2, 0x13, 0xA1, 0x80, 0xF5,
+    0x22, 0xA4, 0x22, 0xC7, 0x75, 0x5B, 0x2B, 0x98, 0xE3, 0x8D, 0x5A, 0x0F, 0x97, 0xDB, 0x29, 0x30,
+    0x4C, 0x73, 0x7B, 0xC1, 0x7C, 0x19, 0x0D, 0x42, 0xA7, 0xA5, 0x79, 0x6B, 0x3D, 0x75, 0x67, 0x49,
+    0xB4, 0x04, 0x55, 0x2C, 0x62, 0x71, 0x02, 0x15, 0x8A, 0x15, 0x4D, 0x39, 0x09, 0x1D, 0xE9, 0x82,
+    0xF2, 0x43, 0x32, 0x82, 0x34, 0x46, 0x1F, 0xEC, 0x47, 0x75, 0xD1, 0x4E, 0x06, 0xC0, 0x6F, 0x4B,
+    0x92, 0x32, 0x60, 0xAB, 0xD2, 0x9E, 0xEF, 0x4F, 0x23, 0x3B, 0xD1, 0x44, 0x4C, 0x53, 0x43, 0x7B,
+    0xB4, 0x73, 0x08, 0x9A, 0x94, 0xFB, 0x35, 0x41, 0x37, 0xA4, 0x3D, 0x97, 0x00, 0x42, 0x63, 0x50,
+    0x42, 0xE3, 0x11, 0x21, 0x93, 0x1C, 0x98, 0x19, 0x55, 0x47, 0xD0, 0x11, 0xF4, 0x27, 0x23, 0x72,
+    0x80, 0xE3, 0x92, 0x49, 0xF4, 0x1A, 0xCC, 0xDF, 0xC0, 0x89, 0x73, 0xE4, 0xE3, 0x5E, 0xAE, 0x17,
+    0x76, 0x7D, 0xF1, 0xD9, 0xDD, 0xF7, 0xD7, 0x6E, 0xCF, 0x5A, 0x70, 0x96, 0xD6, 0x26, 0x02, 0x51,
+    0x42, 0x9C, 0x0E, 0x13, 0x65, 0xAF, 0x0C, 0xB2, 0xF3, 0x0D, 0xDA, 0xE6, 0xEC, 0xD8, 0xD8, 0xF0,
+    0x4A, 0x62, 0xD8, 0x97, 0x5A, 0x62, 0x90, 0x88, 0x92, 0xC3, 0x47, 0x0B, 0xB5, 0xB1, 0x23, 0xCB,
+    0xC9, 0x91, 0x36, 0x16, 0x63, 0xAF, 0xB6, 0x7F, 0xBC, 0x7D, 0xCA, 0x5B, 0x1E, 0x63, 0xC6, 0x05,
+    0x72, 0x2F, 0x66, 0xBA, 0xAD, 0x26, 0x2B, 0xA4, 0x13, 0x55, 0x2B, 0xE4, 0x4E, 0xCC, 0xA6, 0xC8,
+    0xDF, 0x92, 0x15, 0xC8, 0xD8, 0xD1, 0xD5, 0xAB, 0xB8, 0xDE, 0x83, 0x9D, 0x94, 0x47, 0xC3, 0x2F,
+    0x3A, 0x9F, 0xA6, 0xFE, 0xC8, 0x7B, 0x20, 0xCA, 0xB4, 0xA6, 0x58, 0xE4, 0xF3, 0x5D, 0x96, 0x48,
+    0xAC, 0x76, 0x3A, 0xC0, 0x2D, 0x5E, 0xDA, 0x7D, 0xE1, 0x74, 0x10, 0x95, 0x91, 0x3B, 0xF4, 0x57,
+    0x10, 0x8C, 0x7F, 0x93, 0xBC, 0xE3, 0x1A, 0x2B, 0x2E, 0x1F, 0xEE, 0x5C, 0xF6, 0xC2, 0x6D, 0x56,
+    0x8C, 0xBB, 0xB5, 0xD7, 0x8F, 0x2E, 0x27, 0xC3, 0x9D, 0xAF, 0xFC, 0xB0, 0x6F, 0xC5, 0x7A, 0x6E,
+    0x05, 0xC6, 0xAE, 0x4E, 0x62, 0x0F, 0x52, 0xFC, 0x7F, 0x40, 0xD3, 0x96, 0x34, 0xAC, 0xA2, 0x8C,
+    0xB3, 0x1E, 0x47, 0xC1, 0x4E, 0x50, 0x8C, 0xA9, 0xD8, 0xC7, 0x2B, 0x08, 0x08, 0x0D, 0x1D, 0x41,
+    0x62, 0xC4, 0x43, 0x61, 0x18, 0x9B, 0xD8, 0xCD, 0x4F, 0xD1, 0x8C, 0x18, 0x56, 0x4B, 0x11, 0x89,
+    0x6B, 0x23, 0x0F, 0xAD, 0xC0, 0xAC, 0x23, 0x17, 0xCD, 0xE5, 0x9C, 0x02, 0x77, 0x10, 0xBC, 0xAE,
+    0xA5, 0xBB, 0x8E, 0xCE, 0x68, 0x77, 0xC2, 0xFF, 0xE3, 0x1A, 0x6B, 0x4A, 0x56, 0x97, 0x6C, 0x22,
+    0x66, 0x5B, 0x11, 0xFB, 0xEB, 0x47, 0xA6, 0x33, 0x0F, 0x13, 0x4E, 0x9B, 0xB4, 0xB3, 0x6F, 0x01,
+    0x59, 0x33, 0xD7, 0xFF, 0xB7, 0x7F, 0x01, 0x7D, 0x55, 0x41, 0x6B, 0x15, 0x57, 0x14, 0xFE, 0x66,
+    0x26, 0x3A, 0x95, 0x01, 0x6F, 0x0A, 0x4A, 0x8B, 0xA5, 0x99, 0x6E, 0x5B, 0x8C, 0xD3, 0x1F, 0xF0,
+    0x7C, 0x77, 0xA2, 0x0B, 0xA1, 0x2E, 0xCC, 0xA2, 0x5D, 0x75, 0xD1, 0x6E, 0x0A, 0x5D, 0x18, 0xE2,
+    0xC2, 0x86, 0x08, 0x49, 0x67, 0xB4, 0x0B, 0x17, 0x5D, 0x18, 0x0A, 0x5D, 0x16, 0x37, 0x59, 0xD8,
+    0x27, 0x35, 0x16, 0x84, 0xDA, 0x92, 0xF8, 0x46, 0x5F, 0x21, 0xD0, 0x2E, 0x1C, 0x8C, 0xBB, 0x42,
+    0x33, 0x6A, 0x17, 0x35, 0x01, 0xBD, 0xD8, 0x31, 0x99, 0xC8, 0xBC, 0x77, 0xFA, 0xDD, 0x79, 0x0A,
+    0xE2, 0xC2, 0xE1, 0x0E, 0x77, 0x66, 0xEE, 0xB9, 0xE7, 0x9E, 0xF3, 0x7D, 0xDF, 0x39, 0x03, 0x00,
+    0xD1, 0xC0, 0x91, 0x81, 0x2F, 0x7D, 0x55, 0x8E, 0x84, 0x19, 0x74, 0x0A, 0x7D, 0xE4, 0x52, 0x72,
+    0xB4, 0x9F, 0x1C, 0xCD, 0xF4, 0xDA, 0xEF, 0x5A, 0xFA, 0xA1, 0xF4, 0x03, 0xE9, 0x3B, 0xD2, 0xA7,
+    0xAD, 0x73, 0x03, 0x81, 0xE4, 0xCA, 0x59, 0xE8, 0x4A, 0xC6, 0xE1, 0xA7, 0x48, 0x24, 0xE3, 0x70,
+    0x0B, 0xBC, 0x53, 0x40, 0xCB, 0x82, 0x96, 0xF2, 0x83, 0xCE, 0x22, 0xF6, 0xA3, 0x0D, 0xA7, 0x46,
+    0x09, 0xBF, 0xF6, 0x73, 0x84, 0x65, 0x18, 0xA3, 0x6B, 0xE6, 0xE1, 0xCA, 0x9D, 0xD2, 0x5D, 0x92,
+    0xC7, 0x1B, 0x4A, 0x84, 0xFE, 0x06, 0xED, 0x1A, 0x5E, 0x25, 0x06, 0xEA, 0x9E, 0xF0, 0xE4, 0x6F,
+    0x04, 0x90, 0xA0, 0xE6, 0x1E, 0x65, 0x60, 0xAF, 0x40, 0x16, 0x10, 0x49, 0xBE, 0x6B, 0xE5, 0xB3,
+    0xBB, 0x89, 0x48, 0xA5, 0xB2, 0x79, 0x1E, 0x51, 0x42, 0x24, 0xF3, 0xA4, 0x82, 0x7A, 0x08, 0x68,
+    0x5A, 0xD5, 0x80, 0x57, 0x02, 0x2A, 0x07, 0x92, 0x98, 0x9F, 0x0A, 0xBE, 0x4B, 0x0A, 0xCC, 0x1E,
+    0x04, 0xFC, 0xB3, 0xFC, 0x3A, 0xFB, 0x2E, 0x1F, 0xCE, 0xE5, 0x81, 0xB9, 0x51, 0x3B, 0x9B, 0x81,
+    0xA4, 0x07, 0xD1, 0xAD, 0xB1, 0x13, 0xF4, 0x72, 0xB7, 0x5A, 0xD6, 0xF0, 0xD6, 0x7B, 0x26, 0x5A,
+    0xA9, 0xF5, 0x31, 0xF9, 0xE3, 0xDC, 0x62, 0x58, 0x34, 0x07, 0xEF, 0x81, 0x1B, 0x1B, 0xCC, 0x2A,
+    0x04, 0x9C, 0xAE, 0x2A, 0x5F, 0xD9, 0x78, 0xBB, 0x22, 0xE6, 0x4C, 0xBF, 0xF0, 0xE5, 0x11, 0xA3,
+    0xC8, 0xBD, 0x7E, 0x0D, 0x7D, 0x21, 0xF3, 0xCA, 0x1A, 0x51, 0x90, 0xEE, 0xE7, 0x09, 0x92, 0xEF,
+    0x4B, 0xE4, 0xE8, 0x6A, 0x3E, 0xD7, 0x9A, 0x75, 0x7B, 0xAB, 0x1F, 0x8D, 0xB7, 0xBE, 0x7A, 0xB2,
+    0xB6, 0x7A, 0x62, 0xBC, 0x75, 0xDA, 0x78, 0xAB, 0x27, 0xD2, 0xD6, 0xE9, 0xEE, 0xC5, 0xD5, 0x23,
+    0x52, 0xC3, 0x59, 0xCA, 0x80, 0x02, 0x07, 0x9E, 0x31, 0x35, 0xFB, 0x70, 0xA3, 0xF0, 0xA4, 0x08,
+    0x8E, 0x15, 0x81, 0x97, 0x07, 0xC7, 0x72, 0x7A, 0x71, 0xA5, 0xC0, 0xC7, 0x71, 0xA7, 0xB3, 0x20,
+    0xD2, 0x44, 0x13, 0xF4, 0x91, 0x0C, 0x20, 0x3F, 0x31, 0xD1, 0x48, 0x32, 0x2D, 0x99, 0x53, 0xC2,
+    0x31, 0xCF, 0x9F, 0x6D, 0xF6, 0x03, 0x82, 0x3B, 0x80, 0x1E, 0x58, 0x4B, 0x62, 0x20, 0xB2, 0x2E,
+    0xB2, 0x2D, 0x3C, 0x6A, 0x65, 0x12, 0x51, 0x85, 0xA8, 0x0F, 0x4D, 0xB4, 0xFA, 0xA3, 0x76, 0x0A,
+    0x9F, 0xBF, 0xC0, 0x21, 0xD1, 0x8A, 0xFE, 0xBB, 0x15, 0xAC, 0x2B, 0x04, 0xAB, 0x95, 0x73, 0xF9,
+    0x99, 0x3C, 0x44, 0xED, 0x15, 0xBB, 0x92, 0x4F, 0x77, 0x62, 0x45, 0x82, 0x3C, 0xB1, 0x94, 0x0C,
+    0x08, 0xEA, 0x22, 0x01, 0x66, 0xDC, 0x9E, 0x25, 0xC6, 0x9E, 0xA2, 0x89, 0x74, 0x98, 0x5B, 0x45,
+    0xF0, 0x41, 0x71, 0x6E, 0xF1, 0xE6, 0x22, 0x03, 0xA1, 0x5E, 0x48, 0x51, 0x15, 0x3C, 0x35, 0xD0,
+    0xE7, 0x53, 0xD4, 0x63, 0xDC, 0x35, 0x87, 0xF0, 0xA6, 0xD4, 0xDA, 0x97, 0x72, 0x30, 0x16, 0x7E,
+    0x27, 0xBF, 0xAE, 0xD0, 0x73, 0xE9, 0x8B, 0x4D, 0xF6, 0x5F, 0xE0, 0x1A, 0xE0, 0xD2, 0xD7, 0x2E,
+    0x0C, 0xAF, 0x68, 0xC7, 0x52, 0xCF, 0x0F, 0x13, 0x4C, 0x0E, 0x21, 0xC3, 0x13, 0xD9, 0xE4, 0x5D,
+    0xD9, 0x45, 0xB2, 0x20, 0x4B, 0xBC, 0x8B, 0x1A, 0x0B, 0xD0, 0x9B, 0x4D, 0x8C, 0x19, 0xCF, 0x4C,
+    0x87, 0x7B, 0x0B, 0x06, 0x92, 0xE4, 0x49, 0xD5, 0x36, 0x61, 0xCB, 0xBF, 0xED, 0x6C, 0x67, 0xBA,
+    0x22, 0xE3, 0x49, 0x61, 0xFD, 0xDB, 0x4B, 0x49, 0xA3, 0x63, 0x0C, 0x81, 0x5A, 0x25, 0x4A, 0xFB,
+    0x93, 0xEF, 0x63, 0x97, 0x91, 0x47, 0x31, 0xDC, 0xB2, 0x49, 0xCC, 0x7B, 0x69, 0x4A, 0x29, 0x50,
+    0x5A, 0xAE, 0x8B, 0x51, 0x8E, 0x08, 0x1F, 0x6A, 0x9F, 0xA5, 0x60, 0x29, 0xD0, 0x04, 0x84, 0x26,
+    0x03, 0x78, 0x19, 0xD4, 0x08, 0x74, 0xE9, 0x92, 0x90, 0xA7, 0x90, 0x15, 0xA7, 0x5B, 0xAA, 0xC1,
+    0x21, 0x7D, 0xB3, 0x3C, 0xD1, 0x4D, 0x75, 0x89, 0x9D, 0xE6, 0xB0, 0x49, 0xE0, 0xBA, 0x1D, 0x9E,
+    0x10, 0xD8, 0x5C, 0x49, 0x11, 0xFE, 0x66, 0xA2, 0x33, 0xE6, 0xD0, 0xAC, 0x19, 0xE3, 0x98, 0x33,
+    0xE1, 0xE1, 0x66, 0xCC, 0x0F, 0x85, 0x4F, 0x52, 0x5C, 0xC6, 0x19, 0x64, 0xCB, 0x88, 0x58, 0x44,
+    0xCB, 0x7E, 0xFE, 0x96, 0xC8, 0x04, 0x83, 0x25, 0x64, 0x69, 0x38, 0x58, 0xB0, 0x3C, 0x30, 0x93,
+    0x58, 0xDB, 0x64, 0x38, 0x7C, 0x86, 0x8A, 0x0F, 0x81, 0x0A, 0x5E, 0x01, 0xC5, 0x0A, 0x96, 0x7E,
+    0xC2, 0xC2, 0x4D, 0xE9, 0x01, 0x36, 0x37, 0x2E, 0x8F, 0x02, 0x6F, 0x34, 0x1C, 0x52, 0x01, 0xA1,
+    0xE4, 0xD1, 0x95, 0x1B, 0xEA, 0xF8, 0xB7, 0xF1, 0x91, 0xA2, 0x89, 0xEB, 0x10, 0x01, 0x4F, 0xE1,
+    0xBE, 0x10, 0x3F, 0x58, 0xAE, 0x2C, 0x5B, 0xA7, 0xA4, 0x1F, 0x4D, 0xFA, 0x9D, 0xAA, 0x39, 0x30,
+    0x6B, 0x88, 0x7E, 0xD9, 0xBA, 0xD9, 0xAA, 0x8E, 0x9F, 0x3F, 0xF2, 0x6C, 0xB3, 0x60, 0xA1, 0x3A,
+    0x24, 0xCD, 0x8A, 0x22, 0x6B, 0xCC, 0xE2, 0x49, 0xB4, 0x14, 0x54, 0x3C, 0xE7, 0x16, 0x8E, 0x21,
+    0x6D, 0xE7, 0xC9, 0xE0, 0x18, 0xED, 0x67, 0x83, 0xD4, 0x49, 0x3F, 0x87, 0xA5, 0x2F, 0x56, 0x03,
+    0xFF, 0x51, 0x75, 0xED, 0x7E, 0xB6, 0xD7, 0x32, 0xB7, 0x17, 0xA7, 0xEE, 0x9F, 0xFF, 0x7B, 0x39,
+    0x14, 0x0B, 0xFB, 0x30, 0x96, 0xDD, 0x4B, 0xDC, 0x19, 0xEC, 0xA0, 0x9B, 0xA9, 0x04, 0x65, 0xAD,
+    0x3C, 0x63, 0x18, 0x06, 0x33, 0x75, 0xE4, 0x12, 0xB3, 0xD8, 0xCD, 0xD2, 0xC8, 0xC3, 0x2B, 0xFE,
+    0xFD, 0x7B, 0xD5, 0x58, 0xDB, 0xB9, 0x97, 0xE2, 0x6D, 0x02, 0xB0, 0x27, 0x3C, 0x57, 0xAC, 0x8C,
+    0xBB, 0xDB, 0xB9, 0x62, 0x85, 0xDE, 0x92, 0x3A, 0x1A, 0x6A, 0xE3, 0x5C, 0xDA, 0x6E, 0xA9, 0x5E,
+    0xCF, 0x8C, 0xAF, 0xB8, 0x12, 0x87, 0x85, 0x23, 0xB5, 0x92, 0x61, 0xA0, 0x38, 0x05, 0xB6, 0x2B,
+    0x22, 0x8D, 0x68, 0xA3, 0x43, 0xB1, 0xAD, 0xF3, 0x33, 0x65, 0x12, 0x6E, 0x74, 0x98, 0x38, 0xC6,
+    0x79, 0x18, 0x6D, 0xDE, 0x24, 0xCA, 0x27, 0xE1, 0x6C, 0x19, 0x24, 0xD3, 0x59, 0xB8, 0x25, 0xFE,
+    0xF6, 0x54, 0xBD, 0x3C, 0xB3, 0x76, 0xC7, 0x9F, 0x1A, 0xC1, 0x4C, 0x0E, 0x7F, 0x0A, 0x2F, 0x4D,
+    0xCE, 0xC8, 0x0B, 0x35, 0x62, 0x9E, 0x60, 0x65, 0x9D, 0x4E, 0xAD, 0xAD, 0x4C, 0xDD, 0xFF, 0x28,
+    0xFB, 0xCE, 0xE5, 0xCA, 0x32, 0x65, 0x2B, 0x86, 0x66, 0xA3, 0xF1, 0x2B, 0x7B, 0x39, 0xBD, 0x37,
+    0x93, 0x1F, 0x5F, 0x9D, 0x3A, 0x9C, 0xCC, 0xAC, 0xDF, 0x94, 0x69, 0xE3, 0x6F, 0xD5, 0x08, 0xA7,
+    0xB9, 0x96, 0xC1, 0x19, 0x6D, 0xDC, 0xFA, 0x74, 0xDC, 0xF6, 0x73, 0xD7, 0x04, 0x59, 0xB4, 0xB1,
+    0x74, 0x8B, 0xD5, 0x70, 0x3B, 0x43, 0x44, 0x41, 0x94, 0xE1, 0x46, 0x37, 0x0D, 0xCF, 0x56, 0x18,
+    0xA7, 0x28, 0x47, 0x9B, 0x20, 0xBC, 0x1C, 0x9A, 0x5D, 0xA5, 0xE8, 0x4E, 0x6F, 0xF7, 0x7F, 0xB9,
+    0x37, 0x73, 0x13, 0x7F, 0xC1, 0x3B, 0x89, 0x1F, 0x7E, 0xBE, 0xB0, 0xF5, 0xF8, 0xE2, 0x26, 0x21,
+    0x88, 0x03, 0x83, 0x60, 0x18, 0x2D, 0x59, 0x97, 0x06, 0x89, 0xEB, 0x96, 0xDC, 0x20, 0x96, 0x29,
+    0x25, 0x65, 0x3F, 0xEA, 0x15, 0x5A, 0xC5, 0xD7, 0xF5, 0xB1, 0xBC, 0x2B, 0x60, 0xF7, 0xED, 0xC6,
+    0x43, 0xEB, 0xE9, 0x7F, 0x5A, 0xAC, 0xCC, 0xC7, 0x99, 0xDA, 0x49, 0x0A, 0xA7, 0x76, 0xD8, 0x57,
+    0x90, 0x18, 0xCF, 0x44, 0x09, 0xDA, 0xC1, 0x9A, 0xF1, 0x1F, 0x18, 0x0D, 0x5D, 0x7B, 0xC6, 0xA3,
+    0x6E, 0xA9, 0x47, 0x31, 0x94, 0x2E, 0x2B, 0x87, 0xFA, 0x6D, 0xDB, 0xB6, 0xDE, 0x38, 0x61, 0xC1,
+    0xF3, 0x27, 0xC1, 0xF8, 0xD8, 0x3C, 0xD9, 0xC6, 0x4A, 0x84, 0x6C, 0xA8, 0x66, 0x05, 0x5F, 0xFB,
+    0x46, 0xE5, 0x7A, 0xA2, 0x76, 0x6B, 0x2A, 0xA4, 0x27, 0x56, 0x84, 0x72, 0xA7, 0xD3, 0xF9, 0xD1,
+    0xF6, 0x1D, 0xFB, 0xD2, 0x0F, 0x6E, 0x99, 0xD7, 0x8C, 0x5D, 0x13, 0x93, 0x1C, 0xAF, 0xB7, 0x19,
+    0xFA, 0x69, 0x12, 0xF1, 0xD8, 0x98, 0xE4, 0x56, 0x69, 0xF5, 0xAD, 0xAD, 0xD4, 0xFD, 0x8C, 0x00,
+    0xB4, 0x11, 0x66, 0xC3, 0x85, 0xCE, 0xA5, 0x03, 0xDD, 0x1E, 0xDB, 0xC4, 0x27, 0x6C, 0x52, 0x1D,
+    0x6A, 0x96, 0xFF, 0xA7, 0xBB, 0x0D, 0x7F, 0x2A, 0xB6, 0x6D, 0xD8, 0xFE, 0x82, 0xBC, 0x21, 0xCF,
+    0x74, 0x70, 0x95, 0xAB, 0x94, 0x1B, 0xCB, 0xDE, 0x61, 0x46, 0xCD, 0x6F, 0x6C, 0x72, 0x04, 0xD1,
+    0x53, 0x71, 0x45, 0x06, 0xEA, 0x6C, 0xD5, 0x6A, 0xB9, 0xD9, 0xB5, 0x52, 0x1D, 0x5D, 0x23, 0x10,
+    0x04, 0xA4, 0xF2, 0xAB, 0x84, 0x62, 0xDB, 0x67, 0xC1, 0x5F, 0x80, 0xCF, 0x78, 0xAA, 0xD1, 0x17,
+    0x7E, 0x29, 0x47, 0x5B, 0x62, 0xED, 0x86, 0x42, 0x1C, 0x86, 0x8D, 0x0B, 0x73, 0x56, 0x4D, 0xF8,
+    0xA2, 0x22, 0x0E, 0xB1, 0xCB, 0x1F, 0xA7, 0x5F, 0x0D, 0xC9, 0x08, 0x7A, 0xE5, 0x40, 0x5B, 0x99,
+    0x47, 0x6A, 0xAD, 0x62, 0xBF, 0x76, 0xAB, 0xF7, 0x93, 0x27, 0x9B, 0x7F, 0xF6, 0xF7, 0x1D, 0x98,
+    0x58, 0xDC, 0x97, 0x3C, 0xD8, 0x5C, 0x9F, 0xFF, 0x32, 0xC9, 0x9C, 0x45, 0xBC, 0x7A, 0xFD, 0x0F,
+    0x35, 0x8D, 0xB1, 0x0D, 0xC2, 0x30, 0x00, 0x04, 0xCF, 0x76, 0xE1, 0x82, 0xC2, 0x03, 0x50, 0x30,
+    0x01, 0x8C, 0x40, 0x2C, 0x51, 0xB0, 0x00, 0x15, 0x23, 0xD0, 0x30, 0x02, 0x19, 0x21, 0x05, 0xC3,
+    0x50, 0x20, 0xC5, 0x23, 0x78, 0x84, 0x14, 0x0C, 0x10, 0xA1, 0x34, 0x20, 0x25, 0x8F, 0x89, 0xE0,
+    0xA5, 0xEB, 0xFE, 0xFE, 0xA1, 0xC4, 0x47, 0x5C, 0xC2, 0x66, 0xE8, 0x40, 0x3B, 0xE9, 0xA9, 0x11,
+    0xB6, 0x04, 0x69, 0x2F, 0xF5, 0x21, 0xE3, 0x13, 0xAE, 0xC3, 0xF6, 0xFC, 0xB2, 0x86, 0xC5, 0x80,
+    0x57, 0x6D, 0x94, 0xB9, 0x0C, 0x58, 0xC5, 0xD2, 0x7E, 0x61, 0xA4, 0x9A, 0xA5, 0xC0, 0xDC, 0xDD,
+    0x74, 0xFD, 0x0E, 0x64, 0x73, 0x52, 0xFA, 0x6B, 0x9B, 0x42, 0xDB, 0x14, 0x06, 0x58, 0x4D, 0xCC,
+    0xDA, 0x79, 0x34, 0xAD, 0x1E, 0x41, 0x0D, 0x55, 0x0D, 0xF1, 0x78, 0xF3, 0xE5, 0xB2, 0x7A, 0x1F,
+    0x66, 0xE1, 0x03,
+};
+
+static const uint32_t opendyslexic_8_boldBlockOffsets[16] = {
+    0, 1407, 2877, 3906, 4921, 6007, 7148, 8117,
+    9377, 10758, 12154, 13450, 14708, 16071, 17440, 17571,
+};
+
+static const uint16_t opendyslexic_8_boldDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_8_boldGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_8_boldPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
@@ -1845,679 +1297,679 @@ static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 16, 18, 18, 1, 15, 72, 1844 }, // Q
     { 12, 15, 16, 2, 14, 45, 1916 }, // R
     { 14, 16, 18, 2, 15, 56, 1961 }, // S
-    { 13, 14, 18, 2, 14, 46, 2017 }, // T
-    { 13, 15, 17, 2, 14, 49, 2063 }, // U
-    { 15, 14, 19, 2, 14, 53, 2112 }, // V
-    { 20, 15, 24, 2, 15, 75, 2165 }, // W
-    { 14, 14, 19, 2, 14, 49, 2240 }, // X
-    { 14, 14, 18, 2, 14, 49, 2289 }, // Y
-    { 14, 14, 18, 2, 14, 49, 2338 }, // Z
-    { 7, 25, 8, 0, 18, 44, 2387 }, // [
-    { 8, 19, 8, 0, 15, 38, 2431 }, // <backslash>
-    { 7, 25, 8, 0, 18, 44, 2469 }, // ]
-    { 10, 5, 9, 0, 17, 13, 2513 }, // ^
-    { 13, 4, 11, -1, 0, 13, 2526 }, // _
-    { 7, 4, 7, 0, 13, 7, 2539 }, // `
-    { 10, 10, 14, 2, 10, 25, 2546 }, // a
-    { 11, 16, 15, 2, 15, 44, 2571 }, // b
-    { 9, 10, 13, 2, 10, 23, 2615 }, // c
-    { 11, 14, 15, 2, 14, 39, 2638 }, // d
-    { 10, 9, 14, 2, 9, 23, 2677 }, // e
-    { 7, 14, 11, 2, 14, 25, 2700 }, // f
-    { 10, 14, 14, 2, 9, 35, 2725 }, // g
-    { 11, 14, 15, 2, 14, 39, 2760 }, // h
-    { 4, 15, 8, 2, 15, 15, 2799 }, // i
-    { 7, 20, 10, 2, 15, 35, 2814 }, // j
-    { 11, 14, 15, 2, 14, 39, 2849 }, // k
-    { 6, 14, 10, 2, 14, 21, 2888 }, // l
-    { 16, 10, 20, 2, 10, 40, 2909 }, // m
-    { 10, 10, 15, 2, 10, 25, 2949 }, // n
-    { 10, 9, 14, 2, 9, 23, 2974 }, // o
-    { 12, 15, 16, 2, 10, 45, 2997 }, // p
-    { 12, 14, 16, 2, 10, 42, 3042 }, // q
-    { 8, 9, 12, 2, 9, 18, 3084 }, // r
-    { 10, 11, 14, 2, 10, 28, 3102 }, // s
-    { 9, 14, 13, 2, 13, 32, 3130 }, // t
-    { 10, 9, 14, 2, 9, 23, 3162 }, // u
-    { 12, 9, 16, 2, 9, 27, 3185 }, // v
-    { 14, 11, 19, 2, 9, 39, 3212 }, // w
-    { 12, 9, 16, 2, 9, 27, 3251 }, // x
-    { 11, 14, 15, 2, 9, 39, 3278 }, // y
-    { 11, 9, 15, 2, 9, 25, 3317 }, // z
-    { 9, 17, 9, 0, 13, 39, 3342 }, // {
-    { 3, 16, 7, 2, 13, 12, 3381 }, // |
-    { 9, 17, 9, 0, 13, 39, 3393 }, // }
-    { 7, 4, 8, 0, 12, 7, 3432 }, // ~
-    { 0, 0, 14, 0, 0, 0, 3439 }, //  
-    { 6, 22, 12, 3, 19, 33, 3439 }, // ¡
-    { 9, 15, 13, 2, 12, 34, 3472 }, // ¢
-    { 12, 15, 12, 0, 14, 45, 3506 }, // £
-    { 11, 10, 11, 0, 11, 28, 3551 }, // ¤
-    { 13, 16, 13, 0, 13, 52, 3579 }, // ¥
-    { 3, 15, 7, 1, 12, 12, 3631 }, // ¦
-    { 9, 14, 13, 2, 13, 32, 3643 }, // §
-    { 9, 4, 9, 0, 14, 9, 3675 }, // ¨
-    { 8, 7, 11, 2, 16, 14, 3684 }, // ©
-    { 6, 6, 11, 3, 13, 9, 3698 }, // ª
-    { 9, 10, 9, 0, 10, 23, 3707 }, // «
-    { 10, 6, 10, 0, 6, 15, 3730 }, // ¬
-    { 10, 2, 10, 0, 6, 5, 3745 }, // ­
-    { 8, 7, 11, 2, 18, 14, 3750 }, // ®
-    { 8, 3, 9, 0, 13, 6, 3764 }, // ¯
-    { 8, 8, 11, 2, 13, 16, 3770 }, // °
-    { 10, 11, 10, 0, 9, 28, 3786 }, // ±
-    { 5, 7, 5, 0, 14, 9, 3814 }, // ²
-    { 5, 7, 6, 0, 14, 9, 3823 }, // ³
-    { 5, 4, 5, 0, 13, 5, 3832 }, // ´
-    { 11, 11, 14, 1, 9, 31, 3837 }, // µ
-    { 10, 15, 13, 1, 12, 38, 3868 }, // ¶
-    { 4, 4, 4, 0, 8, 4, 3906 }, // ·
-    { 5, 6, 5, 0, 1, 8, 3910 }, // ¸
-    { 5, 7, 5, 0, 14, 9, 3918 }, // ¹
-    { 6, 6, 11, 3, 13, 9, 3927 }, // º
-    { 10, 10, 12, 1, 10, 25, 3936 }, // »
-    { 16, 16, 21, 2, 14, 64, 3961 }, // ¼
-    { 18, 17, 21, 2, 15, 77, 4025 }, // ½
-    { 16, 15, 21, 2, 13, 60, 4102 }, // ¾
-    { 11, 21, 11, 0, 12, 58, 4162 }, // ¿
-    { 14, 19, 16, 1, 19, 67, 4220 }, // À
-    { 14, 22, 16, 1, 22, 77, 4287 }, // Á
-    { 14, 20, 16, 1, 20, 70, 4364 }, // Â
-    { 14, 19, 16, 1, 19, 67, 4434 }, // Ã
-    { 14, 20, 16, 1, 20, 70, 4501 }, // Ä
-    { 14, 20, 16, 1, 20, 70, 4571 }, // Å
-    { 21, 15, 23, 1, 14, 79, 4641 }, // Æ
-    { 12, 19, 17, 2, 15, 57, 4720 }, // Ç
-    { 11, 19, 15, 2, 19, 53, 4777 }, // È
-    { 11, 22, 15, 2, 22, 61, 4830 }, // É
-    { 11, 21, 15, 2, 21, 58, 4891 }, // Ê
-    { 11, 20, 15, 2, 20, 55, 4949 }, // Ë
-    { 8, 20, 9, 0, 20, 40, 5004 }, // Ì
-    { 5, 23, 9, 2, 23, 29, 5044 }, // Í
-    { 10, 21, 9, 0, 21, 53, 5073 }, // Î
-    { 9, 21, 9, 0, 21, 48, 5126 }, // Ï
-    { 16, 14, 18, -1, 14, 56, 5174 }, // Ð
-    { 13, 19, 17, 2, 19, 62, 5230 }, // Ñ
-    { 15, 20, 19, 2, 19, 75, 5292 }, // Ò
-    { 15, 23, 19, 2, 22, 87, 5367 }, // Ó
-    { 15, 21, 19, 2, 20, 79, 5454 }, // Ô
-    { 15, 20, 19, 2, 19, 75, 5533 }, // Õ
-    { 15, 21, 19, 2, 20, 79, 5608 }, // Ö
-    { 10, 6, 10, 0, 7, 15, 5687 }, // ×
-    { 25, 33, 19, -3, 24, 207, 5702 }, // Ø
-    { 13, 21, 17, 2, 20, 69, 5909 }, // Ù
-    { 13, 24, 17, 2, 23, 78, 5978 }, // Ú
-    { 13, 22, 17, 2, 21, 72, 6056 }, // Û
-    { 13, 22, 17, 2, 21, 72, 6128 }, // Ü
-    { 14, 24, 18, 2, 24, 84, 6200 }, // Ý
-    { 9, 14, 9, 0, 14, 32, 6284 }, // Þ
-    { 11, 13, 11, 0, 12, 36, 6316 }, // ß
-    { 10, 14, 14, 2, 14, 35, 6352 }, // à
-    { 10, 17, 14, 2, 17, 43, 6387 }, // á
-    { 10, 16, 14, 2, 16, 40, 6430 }, // â
-    { 10, 15, 14, 2, 15, 38, 6470 }, // ã
-    { 10, 15, 14, 2, 15, 38, 6508 }, // ä
-    { 10, 16, 14, 2, 16, 40, 6546 }, // å
-    { 17, 10, 21, 2, 10, 43, 6586 }, // æ
-    { 9, 14, 13, 2, 10, 32, 6629 }, // ç
-    { 10, 16, 14, 2, 16, 40, 6661 }, // è
-    { 10, 19, 14, 2, 19, 48, 6701 }, // é
-    { 10, 17, 14, 2, 17, 43, 6749 }, // ê
-    { 10, 17, 14, 2, 17, 43, 6792 }, // ë
-    { 7, 14, 8, 0, 14, 25, 6835 }, // ì
-    { 4, 17, 8, 2, 17, 17, 6860 }, // í
-    { 10, 16, 8, -1, 16, 40, 6877 }, // î
-    { 8, 15, 8, 0, 15, 30, 6917 }, // ï
-    { 14, 16, 12, -1, 15, 56, 6947 }, // ð
-    { 10, 15, 15, 2, 15, 38, 7003 }, // ñ
-    { 10, 14, 14, 2, 14, 35, 7041 }, // ò
-    { 10, 17, 14, 2, 17, 43, 7076 }, // ó
-    { 10, 15, 14, 2, 15, 38, 7119 }, // ô
-    { 10, 14, 14, 2, 14, 35, 7157 }, // õ
-    { 10, 15, 14, 2, 15, 38, 7192 }, // ö
-    { 13, 12, 15, 1, 12, 39, 7230 }, // ÷
-    { 12, 28, 14, 1, 19, 84, 7269 }, // ø
-    { 10, 14, 14, 2, 14, 35, 7353 }, // ù
-    { 10, 17, 14, 2, 17, 43, 7388 }, // ú
-    { 10, 15, 14, 2, 15, 38, 7431 }, // û
-    { 10, 15, 14, 2, 15, 38, 7469 }, // ü
-    { 11, 24, 15, 2, 19, 66, 7507 }, // ý
-    { 9, 18, 9, 0, 14, 41, 7573 }, // þ
-    { 11, 22, 15, 2, 17, 61, 7614 }, // ÿ
-    { 14, 20, 16, 1, 20, 70, 7675 }, // Ā
-    { 10, 15, 14, 2, 15, 38, 7745 }, // ā
-    { 14, 20, 16, 1, 20, 70, 7783 }, // Ă
-    { 10, 16, 14, 2, 16, 40, 7853 }, // ă
-    { 14, 19, 16, 1, 14, 67, 7893 }, // Ą
-    { 11, 15, 14, 2, 10, 42, 7960 }, // ą
-    { 12, 20, 17, 2, 20, 60, 8002 }, // Ć
-    { 9, 14, 13, 2, 14, 32, 8062 }, // ć
-    { 12, 21, 17, 2, 21, 63, 8094 }, // Ĉ
-    { 10, 15, 13, 2, 15, 38, 8157 }, // ĉ
-    { 12, 20, 17, 2, 20, 60, 8195 }, // Ċ
-    { 9, 14, 13, 2, 14, 32, 8255 }, // ċ
-    { 12, 21, 17, 2, 21, 63, 8287 }, // Č
-    { 10, 15, 13, 2, 15, 38, 8350 }, // č
-    { 13, 21, 18, 2, 21, 69, 8388 }, // Ď
-    { 14, 14, 15, 2, 14, 49, 8457 }, // ď
-    { 16, 14, 18, -1, 14, 56, 8506 }, // Đ
-    { 13, 14, 15, 2, 14, 46, 8562 }, // đ
-    { 11, 20, 15, 2, 20, 55, 8608 }, // Ē
-    { 10, 17, 14, 2, 17, 43, 8663 }, // ē
-    { 11, 21, 15, 2, 21, 58, 8706 }, // Ĕ
-    { 10, 17, 14, 2, 17, 43, 8764 }, // ĕ
-    { 11, 20, 15, 2, 20, 55, 8807 }, // Ė
-    { 10, 17, 14, 2, 17, 43, 8862 }, // ė
-    { 11, 19, 15, 2, 14, 53, 8905 }, // Ę
-    { 10, 16, 14, 2, 9, 40, 8958 }, // ę
-    { 11, 22, 15, 2, 22, 61, 8998 }, // Ě
-    { 10, 18, 14, 2, 18, 45, 9059 }, // ě
-    { 15, 23, 19, 2, 23, 87, 9104 }, // Ĝ
-    { 11, 21, 14, 2, 16, 58, 9191 }, // ĝ
-    { 15, 23, 19, 2, 23, 87, 9249 }, // Ğ
-    { 10, 21, 14, 2, 16, 53, 9336 }, // ğ
-    { 15, 22, 19, 2, 22, 83, 9389 }, // Ġ
-    { 10, 20, 14, 2, 15, 50, 9472 }, // ġ
-    { 15, 25, 19, 2, 25, 94, 9522 }, // Ģ
-    { 10, 21, 14, 2, 16, 53, 9616 }, // ģ
-    { 13, 21, 18, 2, 21, 69, 9669 }, // Ĥ
-    { 13, 20, 15, 0, 20, 65, 9738 }, // ĥ
-    { 15, 14, 18, 1, 14, 53, 9803 }, // Ħ
-    { 13, 14, 15, 0, 14, 46, 9856 }, // ħ
-    { 7, 21, 9, 1, 21, 37, 9902 }, // Ĩ
-    { 7, 16, 8, 0, 16, 28, 9939 }, // ĩ
-    { 10, 21, 9, -1, 21, 53, 9967 }, // Ī
-    { 10, 15, 8, -1, 15, 38, 10020 }, // ī
-    { 6, 19, 9, 1, 14, 29, 10058 }, // Į
-    { 6, 20, 8, 1, 15, 30, 10087 }, // į
-    { 5, 21, 9, 2, 21, 27, 10117 }, // İ
-    { 4, 10, 8, 2, 10, 10, 10144 }, // ı
-    { 14, 21, 26, 6, 14, 74, 10154 }, // Ĳ
-    { 10, 19, 8, 2, 15, 48, 10228 }, // ĳ
-    { 12, 25, 15, 2, 21, 75, 10276 }, // Ĵ
-    { 9, 22, 10, 2, 17, 50, 10351 }, // ĵ
-    { 13, 23, 18, 2, 23, 75, 10401 }, // Ķ
-    { 11, 23, 15, 2, 14, 64, 10476 }, // ķ
-    { 9, 9, 11, 1, 9, 21, 10540 }, // ĸ
-    { 11, 19, 15, 2, 19, 53, 10561 }, // Ĺ
-    { 6, 21, 10, 2, 21, 32, 10614 }, // ĺ
-    { 12, 22, 15, 1, 22, 66, 10646 }, // Ļ
-    { 7, 23, 10, 1, 14, 41, 10712 }, // ļ
-    { 11, 14, 15, 2, 14, 39, 10753 }, // Ľ
-    { 8, 17, 10, 2, 17, 34, 10792 }, // ľ
-    { 11, 14, 15, 2, 14, 39, 10826 }, // Ŀ
-    { 8, 14, 10, 2, 14, 28, 10865 }, // ŀ
-    { 19, 26, 15, -5, 20, 124, 10893 }, // Ł
-    { 13, 14, 10, -4, 14, 46, 11017 }, // ł
-    { 13, 20, 17, 2, 20, 65, 11063 }, // Ń
-    { 10, 16, 15, 2, 16, 40, 11128 }, // ń
-    { 13, 21, 17, 2, 14, 69, 11168 }, // Ņ
-    { 10, 17, 15, 2, 10, 43, 11237 }, // ņ
-    { 13, 21, 17, 2, 21, 69, 11280 }, // Ň
-    { 11, 17, 15, 2, 17, 47, 11349 }, // ň
-    { 10, 17, 15, 2, 17, 43, 11396 }, // ŉ
-    { 13, 18, 17, 2, 14, 59, 11439 }, // Ŋ
-    { 10, 14, 15, 2, 10, 35, 11498 }, // ŋ
-    { 15, 21, 19, 2, 20, 79, 11533 }, // Ō
-    { 10, 15, 14, 2, 15, 38, 11612 }, // ō
-    { 15, 21, 19, 2, 20, 79, 11650 }, // Ŏ
-    { 10, 15, 14, 2, 15, 38, 11729 }, // ŏ
-    { 16, 20, 19, 2, 19, 80, 11767 }, // Ő
-    { 15, 14, 14, 1, 14, 53, 11847 }, // ő
-    { 20, 15, 20, 2, 14, 75, 11900 }, // Œ
-    { 17, 9, 18, 2, 9, 39, 11975 }, // œ
-    { 12, 20, 16, 2, 19, 60, 12014 }, // Ŕ
-    { 8, 14, 12, 2, 14, 28, 12074 }, // ŕ
-    { 12, 24, 16, 2, 23, 72, 12102 }, // Ŗ
-    { 8, 17, 12, 2, 17, 34, 12174 }, // ŗ
-    { 12, 22, 16, 2, 21, 66, 12208 }, // Ř
-    { 9, 15, 12, 1, 15, 34, 12274 }, // ř
-    { 14, 21, 18, 2, 20, 74, 12308 }, // Ś
-    { 10, 15, 14, 2, 14, 38, 12382 }, // ś
-    { 14, 22, 18, 2, 21, 77, 12420 }, // Ŝ
-    { 10, 16, 14, 2, 15, 40, 12497 }, // ŝ
-    { 14, 19, 18, 2, 15, 67, 12537 }, // Ş
-    { 10, 14, 14, 2, 10, 35, 12604 }, // ş
-    { 14, 22, 18, 2, 21, 77, 12639 }, // Š
-    { 10, 16, 14, 2, 15, 40, 12716 }, // š
-    { 13, 19, 18, 2, 14, 62, 12756 }, // Ţ
-    { 9, 17, 13, 2, 13, 39, 12818 }, // ţ
-    { 13, 21, 18, 2, 21, 69, 12857 }, // Ť
-    { 12, 16, 13, 2, 15, 48, 12926 }, // ť
-    { 13, 14, 18, 2, 14, 46, 12974 }, // Ŧ
-    { 10, 14, 13, 1, 13, 35, 13020 }, // ŧ
-    { 13, 22, 17, 2, 21, 72, 13055 }, // Ũ
-    { 10, 15, 14, 2, 15, 38, 13127 }, // ũ
-    { 13, 22, 17, 2, 21, 72, 13165 }, // Ū
-    { 10, 15, 14, 2, 15, 38, 13237 }, // ū
-    { 13, 22, 17, 2, 21, 72, 13275 }, // Ŭ
-    { 10, 16, 14, 2, 16, 40, 13347 }, // ŭ
-    { 13, 23, 17, 2, 22, 75, 13387 }, // Ů
-    { 10, 16, 14, 2, 16, 40, 13462 }, // ů
-    { 15, 21, 17, 2, 20, 79, 13502 }, // Ű
-    { 15, 14, 14, 1, 14, 53, 13581 }, // ű
-    { 13, 19, 17, 2, 14, 62, 13634 }, // Ų
-    { 10, 14, 14, 2, 9, 35, 13696 }, // ų
-    { 20, 21, 24, 2, 21, 105, 13731 }, // Ŵ
-    { 14, 19, 19, 2, 17, 67, 13836 }, // ŵ
-    { 14, 22, 18, 2, 22, 77, 13903 }, // Ŷ
-    { 11, 23, 15, 2, 18, 64, 13980 }, // ŷ
-    { 14, 22, 18, 2, 22, 77, 14044 }, // Ÿ
-    { 14, 19, 18, 2, 19, 67, 14121 }, // Ź
-    { 11, 15, 15, 2, 15, 42, 14188 }, // ź
-    { 14, 19, 18, 2, 19, 67, 14230 }, // Ż
-    { 11, 15, 15, 2, 15, 42, 14297 }, // ż
-    { 14, 21, 18, 2, 21, 74, 14339 }, // Ž
-    { 11, 17, 15, 2, 17, 47, 14413 }, // ž
-    { 7, 15, 10, 1, 14, 27, 14460 }, // ſ
-    { 7, 4, 0, 0, 13, 7, 14487 }, // ̀
-    { 5, 4, 0, 0, 13, 5, 14494 }, // ́
-    { 10, 5, 0, 0, 1, 13, 14499 }, // ̂
-    { 7, 4, 0, 0, 12, 7, 14512 }, // ̃
-    { 10, 3, 0, 0, 12, 8, 14519 }, // ̄
-    { 12, 3, 0, 0, 15, 9, 14527 }, // ̅
-    { 9, 5, 0, 0, 13, 12, 14536 }, // ̆
-    { 5, 4, 0, 2, 14, 5, 14548 }, // ̇
-    { 8, 4, 0, 0, 13, 8, 14553 }, // ̈
-    { 4, 4, 0, 3, 11, 4, 14561 }, // ̉
-    { 5, 4, 0, 0, 13, 5, 14565 }, // ̊
-    { 15, 4, 0, 0, 13, 15, 14570 }, // ̋
-    { 10, 5, 0, 0, 13, 13, 14585 }, // ̌
-    { 15, 4, 0, -4, 13, 15, 14598 }, // ̏
-    { 6, 6, 0, 0, 13, 9, 14613 }, // ̒
-    { 6, 6, 0, 0, 13, 9, 14622 }, // ̓
-    { 6, 6, 0, -1, 13, 9, 14631 }, // ̔
-    { 5, 5, 0, 0, 0, 7, 14640 }, // ̘
-    { 5, 5, 0, 0, 0, 7, 14647 }, // ̙
-    { 9, 5, 0, 0, 14, 12, 14654 }, // ̚
-    { 4, 5, 0, 0, 11, 5, 14666 }, // ̛
-    { 4, 6, 0, 0, 0, 6, 14671 }, // ̜
-    { 6, 4, 0, 0, 3, 6, 14677 }, // ̝
-    { 6, 4, 0, 0, 0, 6, 14683 }, // ̞
-    { 4, 5, 0, 1, -1, 5, 14689 }, // ̟
-    { 10, 3, 0, 0, -2, 8, 14694 }, // ̠
-    { 5, 4, 0, 0, 2, 5, 14702 }, // ̣
-    { 8, 4, 0, 0, -1, 8, 14707 }, // ̤
-    { 5, 4, 0, 0, 13, 5, 14715 }, // ̥
-    { 6, 6, 0, 0, 3, 9, 14720 }, // ̦
-    { 5, 6, 0, 0, 1, 8, 14729 }, // ̧
-    { 5, 6, 0, 1, 1, 8, 14737 }, // ̨
-    { 4, 6, 0, 0, 0, 6, 14745 }, // ̩
-    { 7, 4, 0, 0, 0, 7, 14751 }, // ̪
-    { 11, 5, 0, -1, 1, 14, 14758 }, // ̬
-    { 11, 5, 0, -1, 1, 14, 14772 }, // ̭
-    { 7, 4, 0, 1, 14, 7, 14786 }, // ̰
-    { 9, 3, 0, 0, 14, 7, 14793 }, // ̱
-    { 9, 3, 0, 0, -1, 7, 14800 }, // ̲
-    { 7, 4, 0, 1, 14, 7, 14807 }, // ̴
-    { 9, 2, 0, 0, 6, 5, 14814 }, // ̵
-    { 4, 6, 0, 0, 0, 6, 14819 }, // ̹
-    { 8, 6, 0, 0, 1, 12, 14825 }, // ̺
-    { 7, 6, 0, 0, 1, 11, 14837 }, // ̻
-    { 7, 5, 0, 0, 1, 9, 14848 }, // ̼
-    { 6, 4, 0, 1, 13, 6, 14857 }, // ̽
-    { 7, 4, 0, 0, 12, 7, 14863 }, // ͂
-    { 3, 5, 0, 4, 15, 4, 14870 }, // ̓
-    { 9, 12, 0, 0, 21, 27, 14874 }, // ̈́
-    { 7, 4, 0, 0, 14, 7, 14901 }, // ͆
-    { 10, 7, 0, 0, 0, 18, 14908 }, // ͇
-    { 8, 5, 0, 0, 0, 10, 14926 }, // ͈
-    { 7, 6, 0, 0, 0, 11, 14936 }, // ͉
-    { 8, 13, 0, 1, 18, 26, 14947 }, // ͊
-    { 16, 13, 0, 0, 19, 52, 14973 }, // ͋
-    { 10, 10, 0, 7, 10, 25, 15025 }, // ͌
-    { 9, 4, 0, 1, -2, 9, 15050 }, // ͍
-    { 4, 3, 0, 0, 2, 3, 15059 }, // ͎
-    { 15, 5, 0, 0, 1, 19, 15062 }, // ͜
-    { 15, 5, 0, 0, 14, 19, 15081 }, // ͡
-    { 19, 6, 0, 0, 0, 29, 15100 }, // ͢
-    { 11, 20, 15, 2, 20, 55, 15129 }, // Ѐ
-    { 11, 20, 15, 2, 20, 55, 15184 }, // Ё
-    { 14, 16, 11, -2, 15, 56, 15239 }, // Ђ
-    { 11, 20, 11, 0, 19, 55, 15295 }, // Ѓ
-    { 14, 15, 14, 0, 13, 53, 15350 }, // Є
-    { 14, 16, 18, 2, 15, 56, 15403 }, // Ѕ
-    { 5, 14, 9, 2, 14, 18, 15459 }, // І
-    { 8, 21, 9, 0, 21, 42, 15477 }, // Ї
-    { 11, 18, 15, 2, 14, 50, 15519 }, // Ј
-    { 17, 15, 19, 1, 13, 64, 15569 }, // Љ
-    { 16, 15, 10, -3, 14, 60, 15633 }, // Њ
-    { 16, 16, 18, 2, 16, 64, 15693 }, // Ћ
-    { 13, 19, 18, 2, 19, 62, 15757 }, // Ќ
-    { 13, 21, 17, 2, 21, 69, 15819 }, // Ѝ
-    { 11, 22, 13, 1, 20, 61, 15888 }, // Ў
-    { 11, 17, 13, 1, 13, 47, 15949 }, // Џ
-    { 14, 14, 16, 1, 14, 49, 15996 }, // А
-    { 9, 13, 11, 1, 13, 30, 16045 }, // Б
-    { 10, 14, 11, 1, 13, 35, 16075 }, // В
-    { 11, 14, 11, 0, 13, 39, 16110 }, // Г
-    { 14, 15, 14, 0, 13, 53, 16149 }, // Д
-    { 11, 15, 15, 2, 15, 42, 16202 }, // Е
-    { 21, 14, 19, -1, 14, 74, 16244 }, // Ж
-    { 9, 13, 11, 1, 13, 30, 16318 }, // З
-    { 13, 14, 17, 2, 14, 46, 16348 }, // И
-    { 13, 22, 17, 2, 22, 72, 16394 }, // Й
-    { 13, 14, 18, 2, 14, 46, 16466 }, // К
-    { 11, 15, 10, -1, 13, 42, 16512 }, // Л
-    { 14, 14, 14, 0, 13, 49, 16554 }, // М
-    { 13, 14, 18, 2, 14, 46, 16603 }, // Н
-    { 15, 15, 19, 2, 14, 57, 16649 }, // О
-    { 11, 14, 11, 0, 13, 39, 16706 }, // П
-    { 11, 15, 15, 2, 15, 42, 16745 }, // Р
-    { 12, 15, 17, 2, 15, 45, 16787 }, // С
-    { 13, 14, 18, 2, 14, 46, 16832 }, // Т
-    { 11, 15, 13, 1, 13, 42, 16878 }, // У
-    { 13, 13, 15, 1, 13, 43, 16920 }, // Ф
-    { 14, 14, 19, 2, 14, 49, 16963 }, // Х
-    { 12, 17, 12, 0, 13, 51, 17012 }, // Ц
-    { 9, 13, 11, 1, 13, 30, 17063 }, // Ч
-    { 13, 14, 14, 0, 13, 46, 17093 }, // Ш
-    { 15, 16, 15, 0, 13, 60, 17139 }, // Щ
-    { 13, 12, 10, -3, 12, 39, 17199 }, // Ъ
-    { 17, 14, 19, 0, 14, 60, 17238 }, // Ы
-    { 10, 12, 10, 0, 12, 30, 17298 }, // Ь
-    { 13, 15, 14, 0, 13, 49, 17328 }, // Э
-    { 14, 13, 15, 1, 13, 46, 17377 }, // Ю
-    { 12, 15, 16, 2, 14, 45, 17423 }, // Я
-    { 10, 10, 14, 2, 10, 25, 17468 }, // а
-    { 11, 16, 12, 0, 15, 44, 17493 }, // б
-    { 8, 9, 12, 2, 9, 18, 17537 }, // в
-    { 10, 11, 10, 0, 9, 28, 17555 }, // г
-    { 12, 12, 13, 0, 9, 36, 17583 }, // д
-    { 10, 9, 14, 2, 9, 23, 17619 }, // е
-    { 20, 12, 24, 2, 12, 60, 17642 }, // ж
-    { 7, 9, 8, 0, 9, 16, 17702 }, // з
-    { 11, 11, 11, 0, 9, 31, 17718 }, // и
-    { 9, 16, 11, 1, 16, 36, 17749 }, // й
-    { 10, 9, 13, 2, 9, 23, 17785 }, // к
-    { 8, 10, 7, -1, 9, 20, 17808 }, // л
-    { 12, 11, 14, 1, 11, 33, 17828 }, // м
-    { 10, 11, 14, 2, 11, 28, 17861 }, // н
-    { 10, 9, 14, 2, 9, 23, 17889 }, // о
-    { 11, 11, 11, 0, 9, 31, 17912 }, // п
-    { 12, 15, 16, 2, 10, 45, 17943 }, // р
-    { 9, 10, 13, 2, 10, 23, 17988 }, // с
-    { 11, 11, 11, 0, 9, 31, 18011 }, // т
-    { 11, 14, 15, 2, 9, 39, 18042 }, // у
-    { 14, 13, 15, 0, 9, 46, 18081 }, // ф
-    { 12, 11, 12, 0, 9, 33, 18127 }, // х
-    { 12, 12, 12, 0, 9, 36, 18160 }, // ц
-    { 7, 9, 8, 0, 9, 16, 18196 }, // ч
-    { 13, 10, 14, 0, 9, 33, 18212 }, // ш
-    { 15, 13, 15, 0, 9, 49, 18245 }, // щ
-    { 10, 10, 8, -3, 10, 25, 18294 }, // ъ
-    { 13, 11, 15, 0, 11, 36, 18319 }, // ы
-    { 7, 10, 8, 0, 10, 18, 18355 }, // ь
-    { 9, 10, 11, 1, 10, 23, 18373 }, // э
-    { 11, 9, 12, 1, 9, 25, 18396 }, // ю
-    { 10, 11, 14, 2, 11, 28, 18421 }, // я
-    { 10, 17, 14, 2, 17, 43, 18449 }, // ѐ
-    { 10, 16, 14, 2, 16, 40, 18492 }, // ё
-    { 13, 16, 15, 0, 14, 52, 18532 }, // ђ
-    { 10, 15, 10, 0, 13, 38, 18584 }, // ѓ
-    { 10, 10, 10, 0, 9, 25, 18622 }, // є
-    { 10, 11, 14, 2, 10, 28, 18647 }, // ѕ
-    { 4, 15, 8, 2, 15, 15, 18675 }, // і
-    { 8, 15, 8, 0, 15, 30, 18690 }, // ї
-    { 7, 20, 10, 2, 15, 35, 18720 }, // ј
-    { 12, 10, 13, 1, 9, 30, 18755 }, // љ
-    { 11, 9, 7, -2, 9, 25, 18785 }, // њ
-    { 13, 14, 15, 0, 14, 46, 18810 }, // ћ
-    { 10, 14, 13, 2, 14, 35, 18856 }, // ќ
-    { 11, 17, 11, 0, 15, 47, 18891 }, // ѝ
-    { 11, 22, 15, 2, 17, 61, 18938 }, // ў
-    { 8, 13, 10, 1, 10, 26, 18999 }, // џ
-    { 12, 14, 12, 0, 13, 42, 19025 }, // Ѣ
-    { 12, 14, 11, -1, 13, 42, 19067 }, // ѣ
-    { 16, 14, 14, -1, 13, 56, 19109 }, // Ѫ
-    { 12, 10, 10, -1, 10, 30, 19165 }, // ѫ
-    { 13, 18, 18, 3, 18, 59, 19195 }, // Ѳ
-    { 11, 13, 14, 2, 13, 36, 19254 }, // ѳ
-    { 17, 17, 19, 2, 17, 73, 19290 }, // Ѵ
-    { 12, 12, 14, 1, 12, 36, 19363 }, // ѵ
-    { 8, 6, 0, 1, 16, 12, 19399 }, // ҆
-    { 11, 15, 11, 0, 14, 42, 19411 }, // Ґ
-    { 10, 14, 10, 0, 12, 35, 19453 }, // ґ
-    { 12, 14, 11, -1, 13, 42, 19488 }, // Ғ
-    { 8, 9, 8, -1, 9, 18, 19530 }, // ғ
-    { 11, 16, 10, -1, 15, 44, 19548 }, // Ҕ
-    { 7, 10, 6, 0, 9, 18, 19592 }, // ҕ
-    { 23, 17, 24, 1, 14, 98, 19610 }, // Җ
-    { 15, 11, 17, 1, 9, 42, 19708 }, // җ
-    { 9, 16, 11, 1, 13, 36, 19750 }, // Ҙ
-    { 7, 14, 8, 0, 9, 25, 19786 }, // ҙ
-    { 14, 17, 12, 1, 14, 60, 19811 }, // Қ
-    { 10, 11, 8, 1, 9, 28, 19871 }, // қ
-    { 16, 14, 18, 1, 13, 56, 19899 }, // Ҝ
-    { 12, 9, 12, 0, 9, 27, 19955 }, // ҝ
-    { 13, 14, 18, 2, 14, 46, 19982 }, // Ҟ
-    { 12, 14, 15, 1, 14, 42, 20028 }, // ҟ
-    { 15, 14, 18, 0, 14, 53, 20070 }, // Ҡ
-    { 11, 9, 12, 0, 9, 25, 20123 }, // ҡ
-    { 14, 16, 13, 0, 14, 56, 20148 }, // Ң
-    { 10, 11, 9, 0, 9, 28, 20204 }, // ң
-    { 19, 14, 18, 2, 14, 67, 20232 }, // Ҥ
-    { 14, 9, 12, 1, 9, 32, 20299 }, // ҥ
-    { 18, 16, 21, 2, 15, 72, 20331 }, // Ҧ
-    { 16, 17, 21, 2, 12, 68, 20403 }, // ҧ
-    { 17, 14, 11, -3, 13, 60, 20471 }, // Ҩ
-    { 13, 11, 9, -2, 10, 36, 20531 }, // ҩ
-    { 12, 17, 17, 2, 15, 51, 20567 }, // Ҫ
-    { 9, 12, 13, 2, 10, 27, 20618 }, // ҫ
-    { 13, 16, 13, 0, 14, 52, 20645 }, // Ҭ
-    { 9, 11, 9, 0, 9, 25, 20697 }, // ҭ
-    { 14, 14, 18, 2, 14, 49, 20722 }, // Ү
-    { 11, 13, 13, 1, 9, 36, 20771 }, // ү
-    { 14, 14, 18, 2, 14, 49, 20807 }, // Ұ
-    { 11, 14, 13, 1, 10, 39, 20856 }, // ұ
-    { 14, 17, 13, 2, 14, 60, 20895 }, // Ҳ
-    { 10, 11, 9, 1, 9, 28, 20955 }, // ҳ
-    { 16, 16, 10, -3, 13, 64, 20983 }, // Ҵ
-    { 11, 12, 7, -2, 9, 33, 21047 }, // ҵ
-    { 12, 17, 11, 0, 13, 51, 21080 }, // Ҷ
-    { 8, 12, 8, 0, 9, 24, 21131 }, // ҷ
-    { 9, 13, 11, 1, 13, 30, 21155 }, // Ҹ
-    { 7, 9, 8, 0, 9, 16, 21185 }, // ҹ
-    { 11, 15, 11, 0, 14, 42, 21201 }, // Һ
-    { 11, 14, 15, 2, 14, 39, 21243 }, // һ
-    { 18, 13, 16, -3, 12, 59, 21282 }, // Ҽ
-    { 14, 9, 12, -3, 9, 32, 21341 }, // ҽ
-    { 19, 15, 15, -3, 12, 72, 21373 }, // Ҿ
-    { 14, 12, 11, -2, 10, 42, 21445 }, // ҿ
-    { 5, 14, 9, 2, 14, 18, 21487 }, // Ӏ
-    { 21, 23, 19, -1, 23, 121, 21505 }, // Ӂ
-    { 20, 20, 24, 2, 20, 100, 21626 }, // ӂ
-    { 11, 18, 12, 1, 13, 50, 21726 }, // Ӄ
-    { 8, 13, 8, 0, 9, 26, 21776 }, // ӄ
-    { 13, 17, 10, -1, 13, 56, 21802 }, // Ӆ
-    { 9, 12, 7, -1, 9, 27, 21858 }, // ӆ
-    { 14, 19, 18, 2, 14, 67, 21885 }, // Ӈ
-    { 10, 13, 12, 1, 9, 33, 21952 }, // ӈ
-    { 14, 20, 18, 2, 14, 70, 21985 }, // Ӊ
-    { 11, 13, 12, 1, 9, 36, 22055 }, // ӊ
-    { 11, 17, 11, 0, 13, 47, 22091 }, // Ӌ
-    { 7, 12, 10, 2, 9, 21, 22138 }, // ӌ
-    { 17, 20, 19, 2, 14, 85, 22159 }, // Ӎ
-    { 12, 13, 13, 1, 9, 39, 22244 }, // ӎ
-    { 4, 13, 10, 3, 12, 13, 22283 }, // ӏ
-    { 14, 20, 16, 1, 20, 70, 22296 }, // Ӑ
-    { 10, 15, 14, 2, 15, 38, 22366 }, // ӑ
-    { 14, 19, 16, 1, 19, 67, 22404 }, // Ӓ
-    { 10, 15, 14, 2, 15, 38, 22471 }, // ӓ
-    { 21, 15, 23, 1, 14, 79, 22509 }, // Ӕ
-    { 17, 10, 21, 2, 10, 43, 22588 }, // ӕ
-    { 11, 21, 15, 2, 21, 58, 22631 }, // Ӗ
-    { 10, 17, 14, 2, 17, 43, 22689 }, // ӗ
-    { 13, 15, 18, 3, 14, 49, 22732 }, // Ә
-    { 10, 11, 14, 3, 10, 28, 22781 }, // ә
-    { 13, 20, 18, 3, 19, 65, 22809 }, // Ӛ
-    { 10, 14, 14, 3, 10, 35, 22874 }, // ӛ
-    { 21, 22, 23, 1, 22, 116, 22909 }, // Ӝ
-    { 20, 19, 24, 2, 19, 95, 23025 }, // ӝ
-    { 9, 21, 11, 1, 21, 48, 23120 }, // Ӟ
-    { 8, 13, 8, -1, 13, 26, 23168 }, // ӟ
-    { 9, 14, 11, 1, 13, 32, 23194 }, // Ӡ
-    { 9, 14, 11, 1, 10, 32, 23226 }, // ӡ
-    { 13, 22, 17, 2, 22, 72, 23258 }, // Ӣ
-    { 11, 17, 11, 0, 15, 47, 23330 }, // ӣ
-    { 13, 21, 17, 2, 21, 69, 23377 }, // Ӥ
-    { 11, 16, 11, 0, 14, 44, 23446 }, // ӥ
-    { 15, 20, 19, 2, 19, 75, 23490 }, // Ӧ
-    { 11, 16, 14, 1, 16, 44, 23565 }, // ӧ
-    { 13, 14, 19, 3, 14, 46, 23609 }, // Ө
-    { 10, 9, 14, 2, 9, 23, 23655 }, // ө
-    { 13, 19, 19, 3, 19, 62, 23678 }, // Ӫ
-    { 10, 14, 14, 2, 14, 35, 23740 }, // ӫ
-    { 13, 22, 14, 0, 20, 72, 23775 }, // Ӭ
-    { 9, 14, 11, 1, 14, 32, 23847 }, // ӭ
-    { 11, 22, 13, 1, 20, 61, 23879 }, // Ӯ
-    { 11, 22, 15, 2, 17, 61, 23940 }, // ӯ
-    { 11, 21, 13, 1, 19, 58, 24001 }, // Ӱ
-    { 11, 22, 15, 2, 17, 61, 24059 }, // ӱ
-    { 15, 21, 13, 0, 19, 79, 24120 }, // Ӳ
-    { 15, 21, 15, 2, 16, 79, 24199 }, // ӳ
-    { 9, 17, 11, 1, 17, 39, 24278 }, // Ӵ
-    { 8, 13, 8, 0, 13, 26, 24317 }, // ӵ
-    { 11, 16, 11, 0, 13, 44, 24343 }, // Ӷ
-    { 8, 11, 8, 0, 9, 22, 24387 }, // ӷ
-    { 17, 22, 19, 0, 22, 94, 24409 }, // Ӹ
-    { 13, 18, 15, 0, 18, 59, 24503 }, // ӹ
-    { 16, 16, 19, 2, 14, 64, 24562 }, // Ӽ
-    { 12, 11, 13, 1, 9, 33, 24626 }, // ӽ
-    { 0, 0, 11, 0, 0, 0, 24659 }, //  
-    { 0, 0, 19, 0, 0, 0, 24659 }, //  
-    { 0, 0, 11, 0, 0, 0, 24659 }, //  
-    { 0, 0, 19, 0, 0, 0, 24659 }, //  
-    { 0, 0, 8, 0, 0, 0, 24659 }, //  
-    { 0, 0, 7, 0, 0, 0, 24659 }, //  
-    { 0, 0, 5, 0, 0, 0, 24659 }, //  
-    { 0, 0, 12, 0, 0, 0, 24659 }, //  
-    { 0, 0, 4, 0, 0, 0, 24659 }, //  
-    { 0, 0, 6, 0, 0, 0, 24659 }, //  
-    { 0, 0, 5, 0, 0, 0, 24659 }, //  
-    { 0, 0, 3, 0, 0, 0, 24659 }, // ​
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 24659 }, // ‏
-    { 9, 2, 9, 0, 6, 5, 24659 }, // ‐
-    { 9, 2, 9, 0, 6, 5, 24664 }, // ‑
-    { 13, 2, 9, -2, 6, 7, 24669 }, // ‒
-    { 13, 4, 13, 0, 7, 13, 24676 }, // –
-    { 18, 4, 19, 0, 7, 18, 24689 }, // —
-    { 18, 4, 19, 0, 7, 18, 24707 }, // ―
-    { 8, 16, 9, 2, 13, 32, 24725 }, // ‖
-    { 15, 6, 9, -3, -1, 23, 24757 }, // ‗
-    { 6, 6, 7, 1, 15, 9, 24780 }, // ‘
-    { 6, 6, 7, 1, 15, 9, 24789 }, // ’
-    { 6, 6, 5, 0, 3, 9, 24798 }, // ‚
-    { 6, 6, 7, 1, 15, 9, 24807 }, // ‛
-    { 11, 6, 13, 1, 15, 17, 24816 }, // “
-    { 11, 6, 13, 1, 15, 17, 24833 }, // ”
-    { 6, 6, 5, 0, 3, 9, 24850 }, // „
-    { 11, 6, 13, 1, 15, 17, 24859 }, // ‟
-    { 10, 24, 13, 2, 18, 60, 24876 }, // †
-    { 10, 23, 14, 3, 17, 58, 24936 }, // ‡
-    { 14, 13, 8, -3, 15, 46, 24994 }, // •
-    { 6, 7, 10, 2, 8, 11, 25040 }, // ‣
-    { 4, 4, 10, 3, 4, 4, 25051 }, // ․
-    { 4, 4, 10, 3, 4, 4, 25055 }, // ‥
-    { 16, 4, 16, 0, 4, 16, 25059 }, // …
-    { 3, 2, 9, 3, 6, 2, 25075 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 25077 }, //  
-    { 13, 15, 19, 3, 13, 49, 25077 }, // ‰
-    { 7, 6, 9, 2, 15, 11, 25126 }, // ′
-    { 12, 6, 13, 2, 15, 18, 25137 }, // ″
-    { 13, 6, 7, 1, 14, 20, 25155 }, // ‴
-    { 5, 6, 7, 1, 14, 8, 25175 }, // ‵
-    { 8, 6, 7, 0, 14, 12, 25183 }, // ‶
-    { 13, 6, 7, -3, 14, 20, 25195 }, // ‷
-    { 10, 4, 11, 0, 14, 10, 25215 }, // ‸
-    { 5, 10, 7, 1, 10, 13, 25225 }, // ‹
-    { 6, 10, 7, 0, 10, 15, 25238 }, // ›
-    { 18, 22, 23, 3, 17, 99, 25253 }, // ※
-    { 6, 22, 10, 2, 19, 33, 25352 }, // ‼
-    { 11, 27, 14, 1, 23, 75, 25385 }, // ‽
-    { 9, 2, 9, 0, 14, 5, 25460 }, // ‾
-    { 9, 5, 9, 0, 12, 12, 25465 }, // ‿
-    { 13, 12, 11, -1, 15, 39, 25477 }, // ⁂
-    { 11, 15, 21, 5, 13, 42, 25516 }, // ⁄
-    { 21, 21, 25, 2, 19, 111, 25558 }, // ⁇
-    { 18, 22, 20, 1, 19, 99, 25669 }, // ⁈
-    { 14, 22, 13, -1, 19, 77, 25768 }, // ⁉
-    { 13, 29, 15, 1, 20, 95, 25845 }, // ⁒
-    { 0, 0, 78, 0, 0, 0, 25940 }, //  
-    { 5, 7, 6, 0, 14, 9, 25940 }, // ⁰
-    { 6, 6, 6, 0, 14, 9, 25949 }, // ⁴
-    { 6, 8, 6, 0, 14, 12, 25958 }, // ⁵
-    { 6, 7, 6, 0, 14, 11, 25970 }, // ⁶
-    { 6, 8, 6, 0, 15, 12, 25981 }, // ⁷
-    { 6, 7, 6, 0, 14, 11, 25993 }, // ⁸
-    { 6, 8, 6, 0, 14, 12, 26004 }, // ⁹
-    { 10, 10, 15, 2, 10, 25, 26016 }, // ⁿ
-    { 6, 7, 6, 0, 4, 11, 26041 }, // ₀
-    { 5, 7, 6, 0, 4, 9, 26052 }, // ₁
-    { 6, 7, 6, 0, 4, 11, 26061 }, // ₂
-    { 6, 7, 6, 0, 4, 11, 26072 }, // ₃
-    { 6, 7, 6, 0, 4, 11, 26083 }, // ₄
-    { 5, 8, 6, 0, 5, 10, 26094 }, // ₅
-    { 6, 7, 6, 0, 4, 11, 26104 }, // ₆
-    { 6, 8, 6, 0, 5, 12, 26115 }, // ₇
-    { 6, 7, 6, 0, 4, 11, 26127 }, // ₈
-    { 6, 8, 6, 0, 4, 12, 26138 }, // ₉
-    { 7, 23, 8, 1, 17, 41, 26150 }, // ₍
-    { 8, 23, 7, -1, 17, 46, 26191 }, // ₎
-    { 12, 22, 17, 2, 18, 66, 26237 }, // ₡
-    { 12, 15, 17, 2, 15, 45, 26303 }, // ₢
-    { 12, 14, 12, 0, 13, 42, 26348 }, // ₤
-    { 19, 14, 17, -1, 14, 67, 26390 }, // ₦
-    { 15, 15, 15, 0, 15, 57, 26457 }, // ₧
-    { 18, 15, 22, 2, 14, 68, 26514 }, // ₨
-    { 14, 14, 14, 0, 14, 49, 26582 }, // ₩
-    { 14, 13, 18, 2, 13, 46, 26631 }, // ₪
-    { 12, 14, 9, -1, 13, 42, 26677 }, // ₫
-    { 12, 17, 12, 0, 14, 51, 26719 }, // €
-    { 13, 14, 18, 2, 14, 46, 26770 }, // ₮
-    { 17, 15, 11, -1, 15, 64, 26816 }, // ₱
-    { 15, 21, 19, 2, 18, 79, 26880 }, // ₲
-    { 17, 15, 17, 3, 14, 64, 26959 }, // ₴
-    { 9, 13, 10, 2, 11, 30, 27023 }, // ₵
-    { 14, 16, 18, 2, 16, 56, 27053 }, // ₸
-    { 9, 13, 12, 1, 12, 30, 27109 }, // ₹
-    { 11, 13, 12, 0, 11, 36, 27139 }, // ₺
-    { 12, 14, 14, 1, 14, 42, 27175 }, // ₼
-    { 15, 15, 15, -2, 15, 57, 27217 }, // ₽
-    { 12, 11, 12, 0, 9, 33, 27274 }, // ←
-    { 13, 12, 13, 0, 10, 39, 27307 }, // ↑
-    { 12, 11, 13, 0, 9, 33, 27346 }, // →
-    { 13, 12, 13, 0, 11, 39, 27379 }, // ↓
-    { 14, 9, 17, 2, 9, 32, 27418 }, // ↔
-    { 10, 14, 13, 2, 15, 35, 27450 }, // ↕
-    { 10, 10, 13, 2, 10, 25, 27485 }, // ↖
-    { 10, 10, 11, 0, 10, 25, 27510 }, // ↗
-    { 10, 10, 11, 0, 9, 25, 27535 }, // ↘
-    { 10, 10, 11, 0, 9, 25, 27560 }, // ↙
-    { 13, 12, 16, 2, 10, 39, 27585 }, // ⇐
-    { 14, 14, 18, 2, 13, 49, 27624 }, // ⇑
-    { 13, 12, 16, 2, 10, 39, 27673 }, // ⇒
-    { 14, 14, 18, 2, 13, 49, 27712 }, // ⇓
-    { 15, 12, 18, 2, 10, 45, 27761 }, // ⇔
-    { 11, 15, 15, 2, 9, 42, 27806 }, // ⇕
-    { 11, 16, 11, 0, 15, 44, 27848 }, // ∂
-    { 18, 16, 19, 0, 15, 72, 27892 }, // ∅
-    { 14, 14, 14, 0, 13, 49, 27964 }, // ∆
-    { 12, 14, 12, 0, 13, 42, 28013 }, // ∏
-    { 12, 14, 12, 0, 13, 42, 28055 }, // ∐
-    { 10, 14, 10, 0, 13, 35, 28097 }, // ∑
-    { 10, 3, 10, 0, 6, 8, 28132 }, // −
-    { 14, 15, 16, 1, 14, 53, 28140 }, // √
-    { 15, 10, 15, 0, 11, 38, 28193 }, // ∞
-    { 14, 18, 14, 0, 13, 63, 28231 }, // ∫
-    { 5, 12, 5, 0, 12, 15, 28294 }, // ∶
-    { 10, 10, 24, 7, 10, 25, 28309 }, // ≈
-    { 13, 15, 21, 4, 14, 49, 28334 }, // ≠
-    { 15, 15, 13, -1, 13, 57, 28383 }, // ≤
-    { 15, 14, 14, 0, 12, 53, 28440 }, // ≥
+    { 13, 14, 18, 2, 14, 46, 2048 }, // T
+    { 13, 15, 17, 2, 14, 49, 2094 }, // U
+    { 15, 14, 19, 2, 14, 53, 2143 }, // V
+    { 20, 15, 24, 2, 15, 75, 2196 }, // W
+    { 14, 14, 19, 2, 14, 49, 2271 }, // X
+    { 14, 14, 18, 2, 14, 49, 2320 }, // Y
+    { 14, 14, 18, 2, 14, 49, 2369 }, // Z
+    { 7, 25, 8, 0, 18, 44, 2418 }, // [
+    { 8, 19, 8, 0, 15, 38, 2462 }, // <backslash>
+    { 7, 25, 8, 0, 18, 44, 2500 }, // ]
+    { 10, 5, 9, 0, 17, 13, 2544 }, // ^
+    { 13, 4, 11, -1, 0, 13, 2557 }, // _
+    { 7, 4, 7, 0, 13, 7, 2570 }, // `
+    { 10, 10, 14, 2, 10, 25, 2577 }, // a
+    { 11, 16, 15, 2, 15, 44, 2602 }, // b
+    { 9, 10, 13, 2, 10, 23, 2646 }, // c
+    { 11, 14, 15, 2, 14, 39, 2669 }, // d
+    { 10, 9, 14, 2, 9, 23, 2708 }, // e
+    { 7, 14, 11, 2, 14, 25, 2731 }, // f
+    { 10, 14, 14, 2, 9, 35, 2756 }, // g
+    { 11, 14, 15, 2, 14, 39, 2791 }, // h
+    { 4, 15, 8, 2, 15, 15, 2830 }, // i
+    { 7, 20, 10, 2, 15, 35, 2845 }, // j
+    { 11, 14, 15, 2, 14, 39, 2880 }, // k
+    { 6, 14, 10, 2, 14, 21, 2919 }, // l
+    { 16, 10, 20, 2, 10, 40, 2940 }, // m
+    { 10, 10, 15, 2, 10, 25, 2980 }, // n
+    { 10, 9, 14, 2, 9, 23, 3005 }, // o
+    { 12, 15, 16, 2, 10, 45, 3028 }, // p
+    { 12, 14, 16, 2, 10, 42, 3073 }, // q
+    { 8, 9, 12, 2, 9, 18, 3115 }, // r
+    { 10, 11, 14, 2, 10, 28, 3133 }, // s
+    { 9, 14, 13, 2, 13, 32, 3161 }, // t
+    { 10, 9, 14, 2, 9, 23, 3193 }, // u
+    { 12, 9, 16, 2, 9, 27, 3216 }, // v
+    { 14, 11, 19, 2, 9, 39, 3243 }, // w
+    { 12, 9, 16, 2, 9, 27, 3282 }, // x
+    { 11, 14, 15, 2, 9, 39, 3309 }, // y
+    { 11, 9, 15, 2, 9, 25, 3348 }, // z
+    { 9, 17, 9, 0, 13, 39, 3373 }, // {
+    { 3, 16, 7, 2, 13, 12, 3412 }, // |
+    { 9, 17, 9, 0, 13, 39, 3424 }, // }
+    { 7, 4, 8, 0, 12, 7, 3463 }, // ~
+    { 0, 0, 14, 0, 0, 0, 3470 }, //  
+    { 6, 22, 12, 3, 19, 33, 3470 }, // ¡
+    { 9, 15, 13, 2, 12, 34, 3503 }, // ¢
+    { 12, 15, 12, 0, 14, 45, 3537 }, // £
+    { 11, 10, 11, 0, 11, 28, 3582 }, // ¤
+    { 13, 16, 13, 0, 13, 52, 3610 }, // ¥
+    { 3, 15, 7, 1, 12, 12, 3662 }, // ¦
+    { 9, 14, 13, 2, 13, 32, 3674 }, // §
+    { 9, 4, 9, 0, 14, 9, 3706 }, // ¨
+    { 8, 7, 11, 2, 16, 14, 3715 }, // ©
+    { 6, 6, 11, 3, 13, 9, 3729 }, // ª
+    { 9, 10, 9, 0, 10, 23, 3738 }, // «
+    { 10, 6, 10, 0, 6, 15, 3761 }, // ¬
+    { 10, 2, 10, 0, 6, 5, 3776 }, // ­
+    { 8, 7, 11, 2, 18, 14, 3781 }, // ®
+    { 8, 3, 9, 0, 13, 6, 3795 }, // ¯
+    { 8, 8, 11, 2, 13, 16, 3801 }, // °
+    { 10, 11, 10, 0, 9, 28, 3817 }, // ±
+    { 5, 7, 5, 0, 14, 9, 3845 }, // ²
+    { 5, 7, 6, 0, 14, 9, 3854 }, // ³
+    { 5, 4, 5, 0, 13, 5, 3863 }, // ´
+    { 11, 11, 14, 1, 9, 31, 3868 }, // µ
+    { 10, 15, 13, 1, 12, 38, 3899 }, // ¶
+    { 4, 4, 4, 0, 8, 4, 3937 }, // ·
+    { 5, 6, 5, 0, 1, 8, 3941 }, // ¸
+    { 5, 7, 5, 0, 14, 9, 3949 }, // ¹
+    { 6, 6, 11, 3, 13, 9, 3958 }, // º
+    { 10, 10, 12, 1, 10, 25, 3967 }, // »
+    { 16, 16, 21, 2, 14, 64, 3992 }, // ¼
+    { 18, 17, 21, 2, 15, 77, 4096 }, // ½
+    { 16, 15, 21, 2, 13, 60, 4173 }, // ¾
+    { 11, 21, 11, 0, 12, 58, 4233 }, // ¿
+    { 14, 19, 16, 1, 19, 67, 4291 }, // À
+    { 14, 22, 16, 1, 22, 77, 4358 }, // Á
+    { 14, 20, 16, 1, 20, 70, 4435 }, // Â
+    { 14, 19, 16, 1, 19, 67, 4505 }, // Ã
+    { 14, 20, 16, 1, 20, 70, 4572 }, // Ä
+    { 14, 20, 16, 1, 20, 70, 4642 }, // Å
+    { 21, 15, 23, 1, 14, 79, 4712 }, // Æ
+    { 12, 19, 17, 2, 15, 57, 4791 }, // Ç
+    { 11, 19, 15, 2, 19, 53, 4848 }, // È
+    { 11, 22, 15, 2, 22, 61, 4901 }, // É
+    { 11, 21, 15, 2, 21, 58, 4962 }, // Ê
+    { 11, 20, 15, 2, 20, 55, 5020 }, // Ë
+    { 8, 20, 9, 0, 20, 40, 5075 }, // Ì
+    { 5, 23, 9, 2, 23, 29, 5115 }, // Í
+    { 10, 21, 9, 0, 21, 53, 5144 }, // Î
+    { 9, 21, 9, 0, 21, 48, 5197 }, // Ï
+    { 16, 14, 18, -1, 14, 56, 5245 }, // Ð
+    { 13, 19, 17, 2, 19, 62, 5301 }, // Ñ
+    { 15, 20, 19, 2, 19, 75, 5363 }, // Ò
+    { 15, 23, 19, 2, 22, 87, 5438 }, // Ó
+    { 15, 21, 19, 2, 20, 79, 5525 }, // Ô
+    { 15, 20, 19, 2, 19, 75, 5604 }, // Õ
+    { 15, 21, 19, 2, 20, 79, 5679 }, // Ö
+    { 10, 6, 10, 0, 7, 15, 5758 }, // ×
+    { 25, 33, 19, -3, 24, 207, 5773 }, // Ø
+    { 13, 21, 17, 2, 20, 69, 5980 }, // Ù
+    { 13, 24, 17, 2, 23, 78, 6049 }, // Ú
+    { 13, 22, 17, 2, 21, 72, 6144 }, // Û
+    { 13, 22, 17, 2, 21, 72, 6216 }, // Ü
+    { 14, 24, 18, 2, 24, 84, 6288 }, // Ý
+    { 9, 14, 9, 0, 14, 32, 6372 }, // Þ
+    { 11, 13, 11, 0, 12, 36, 6404 }, // ß
+    { 10, 14, 14, 2, 14, 35, 6440 }, // à
+    { 10, 17, 14, 2, 17, 43, 6475 }, // á
+    { 10, 16, 14, 2, 16, 40, 6518 }, // â
+    { 10, 15, 14, 2, 15, 38, 6558 }, // ã
+    { 10, 15, 14, 2, 15, 38, 6596 }, // ä
+    { 10, 16, 14, 2, 16, 40, 6634 }, // å
+    { 17, 10, 21, 2, 10, 43, 6674 }, // æ
+    { 9, 14, 13, 2, 10, 32, 6717 }, // ç
+    { 10, 16, 14, 2, 16, 40, 6749 }, // è
+    { 10, 19, 14, 2, 19, 48, 6789 }, // é
+    { 10, 17, 14, 2, 17, 43, 6837 }, // ê
+    { 10, 17, 14, 2, 17, 43, 6880 }, // ë
+    { 7, 14, 8, 0, 14, 25, 6923 }, // ì
+    { 4, 17, 8, 2, 17, 17, 6948 }, // í
+    { 10, 16, 8, -1, 16, 40, 6965 }, // î
+    { 8, 15, 8, 0, 15, 30, 7005 }, // ï
+    { 14, 16, 12, -1, 15, 56, 7035 }, // ð
+    { 10, 15, 15, 2, 15, 38, 7091 }, // ñ
+    { 10, 14, 14, 2, 14, 35, 7129 }, // ò
+    { 10, 17, 14, 2, 17, 43, 7164 }, // ó
+    { 10, 15, 14, 2, 15, 38, 7207 }, // ô
+    { 10, 14, 14, 2, 14, 35, 7245 }, // õ
+    { 10, 15, 14, 2, 15, 38, 7280 }, // ö
+    { 13, 12, 15, 1, 12, 39, 7318 }, // ÷
+    { 12, 28, 14, 1, 19, 84, 7357 }, // ø
+    { 10, 14, 14, 2, 14, 35, 7441 }, // ù
+    { 10, 17, 14, 2, 17, 43, 7476 }, // ú
+    { 10, 15, 14, 2, 15, 38, 7519 }, // û
+    { 10, 15, 14, 2, 15, 38, 7557 }, // ü
+    { 11, 24, 15, 2, 19, 66, 7595 }, // ý
+    { 9, 18, 9, 0, 14, 41, 7661 }, // þ
+    { 11, 22, 15, 2, 17, 61, 7702 }, // ÿ
+    { 14, 20, 16, 1, 20, 70, 7763 }, // Ā
+    { 10, 15, 14, 2, 15, 38, 7833 }, // ā
+    { 14, 20, 16, 1, 20, 70, 7871 }, // Ă
+    { 10, 16, 14, 2, 16, 40, 7941 }, // ă
+    { 14, 19, 16, 1, 14, 67, 7981 }, // Ą
+    { 11, 15, 14, 2, 10, 42, 8048 }, // ą
+    { 12, 20, 17, 2, 20, 60, 8090 }, // Ć
+    { 9, 14, 13, 2, 14, 32, 8150 }, // ć
+    { 12, 21, 17, 2, 21, 63, 8192 }, // Ĉ
+    { 10, 15, 13, 2, 15, 38, 8255 }, // ĉ
+    { 12, 20, 17, 2, 20, 60, 8293 }, // Ċ
+    { 9, 14, 13, 2, 14, 32, 8353 }, // ċ
+    { 12, 21, 17, 2, 21, 63, 8385 }, // Č
+    { 10, 15, 13, 2, 15, 38, 8448 }, // č
+    { 13, 21, 18, 2, 21, 69, 8486 }, // Ď
+    { 14, 14, 15, 2, 14, 49, 8555 }, // ď
+    { 16, 14, 18, -1, 14, 56, 8604 }, // Đ
+    { 13, 14, 15, 2, 14, 46, 8660 }, // đ
+    { 11, 20, 15, 2, 20, 55, 8706 }, // Ē
+    { 10, 17, 14, 2, 17, 43, 8761 }, // ē
+    { 11, 21, 15, 2, 21, 58, 8804 }, // Ĕ
+    { 10, 17, 14, 2, 17, 43, 8862 }, // ĕ
+    { 11, 20, 15, 2, 20, 55, 8905 }, // Ė
+    { 10, 17, 14, 2, 17, 43, 8960 }, // ė
+    { 11, 19, 15, 2, 14, 53, 9003 }, // Ę
+    { 10, 16, 14, 2, 9, 40, 9056 }, // ę
+    { 11, 22, 15, 2, 22, 61, 9096 }, // Ě
+    { 10, 18, 14, 2, 18, 45, 9157 }, // ě
+    { 15, 23, 19, 2, 23, 87, 9202 }, // Ĝ
+    { 11, 21, 14, 2, 16, 58, 9289 }, // ĝ
+    { 15, 23, 19, 2, 23, 87, 9347 }, // Ğ
+    { 10, 21, 14, 2, 16, 53, 9434 }, // ğ
+    { 15, 22, 19, 2, 22, 83, 9487 }, // Ġ
+    { 10, 20, 14, 2, 15, 50, 9570 }, // ġ
+    { 15, 25, 19, 2, 25, 94, 9620 }, // Ģ
+    { 10, 21, 14, 2, 16, 53, 9714 }, // ģ
+    { 13, 21, 18, 2, 21, 69, 9767 }, // Ĥ
+    { 13, 20, 15, 0, 20, 65, 9836 }, // ĥ
+    { 15, 14, 18, 1, 14, 53, 9901 }, // Ħ
+    { 13, 14, 15, 0, 14, 46, 9954 }, // ħ
+    { 7, 21, 9, 1, 21, 37, 10000 }, // Ĩ
+    { 7, 16, 8, 0, 16, 28, 10037 }, // ĩ
+    { 10, 21, 9, -1, 21, 53, 10065 }, // Ī
+    { 10, 15, 8, -1, 15, 38, 10118 }, // ī
+    { 6, 19, 9, 1, 14, 29, 10156 }, // Į
+    { 6, 20, 8, 1, 15, 30, 10185 }, // į
+    { 5, 21, 9, 2, 21, 27, 10240 }, // İ
+    { 4, 10, 8, 2, 10, 10, 10267 }, // ı
+    { 14, 21, 26, 6, 14, 74, 10277 }, // Ĳ
+    { 10, 19, 8, 2, 15, 48, 10351 }, // ĳ
+    { 12, 25, 15, 2, 21, 75, 10399 }, // Ĵ
+    { 9, 22, 10, 2, 17, 50, 10474 }, // ĵ
+    { 13, 23, 18, 2, 23, 75, 10524 }, // Ķ
+    { 11, 23, 15, 2, 14, 64, 10599 }, // ķ
+    { 9, 9, 11, 1, 9, 21, 10663 }, // ĸ
+    { 11, 19, 15, 2, 19, 53, 10684 }, // Ĺ
+    { 6, 21, 10, 2, 21, 32, 10737 }, // ĺ
+    { 12, 22, 15, 1, 22, 66, 10769 }, // Ļ
+    { 7, 23, 10, 1, 14, 41, 10835 }, // ļ
+    { 11, 14, 15, 2, 14, 39, 10876 }, // Ľ
+    { 8, 17, 10, 2, 17, 34, 10915 }, // ľ
+    { 11, 14, 15, 2, 14, 39, 10949 }, // Ŀ
+    { 8, 14, 10, 2, 14, 28, 10988 }, // ŀ
+    { 19, 26, 15, -5, 20, 124, 11016 }, // Ł
+    { 13, 14, 10, -4, 14, 46, 11140 }, // ł
+    { 13, 20, 17, 2, 20, 65, 11186 }, // Ń
+    { 10, 16, 15, 2, 16, 40, 11251 }, // ń
+    { 13, 21, 17, 2, 14, 69, 11291 }, // Ņ
+    { 10, 17, 15, 2, 10, 43, 11360 }, // ņ
+    { 13, 21, 17, 2, 21, 69, 11403 }, // Ň
+    { 11, 17, 15, 2, 17, 47, 11472 }, // ň
+    { 10, 17, 15, 2, 17, 43, 11519 }, // ŉ
+    { 13, 18, 17, 2, 14, 59, 11562 }, // Ŋ
+    { 10, 14, 15, 2, 10, 35, 11621 }, // ŋ
+    { 15, 21, 19, 2, 20, 79, 11656 }, // Ō
+    { 10, 15, 14, 2, 15, 38, 11735 }, // ō
+    { 15, 21, 19, 2, 20, 79, 11773 }, // Ŏ
+    { 10, 15, 14, 2, 15, 38, 11852 }, // ŏ
+    { 16, 20, 19, 2, 19, 80, 11890 }, // Ő
+    { 15, 14, 14, 1, 14, 53, 11970 }, // ő
+    { 20, 15, 20, 2, 14, 75, 12023 }, // Œ
+    { 17, 9, 18, 2, 9, 39, 12098 }, // œ
+    { 12, 20, 16, 2, 19, 60, 12137 }, // Ŕ
+    { 8, 14, 12, 2, 14, 28, 12197 }, // ŕ
+    { 12, 24, 16, 2, 23, 72, 12288 }, // Ŗ
+    { 8, 17, 12, 2, 17, 34, 12360 }, // ŗ
+    { 12, 22, 16, 2, 21, 66, 12394 }, // Ř
+    { 9, 15, 12, 1, 15, 34, 12460 }, // ř
+    { 14, 21, 18, 2, 20, 74, 12494 }, // Ś
+    { 10, 15, 14, 2, 14, 38, 12568 }, // ś
+    { 14, 22, 18, 2, 21, 77, 12606 }, // Ŝ
+    { 10, 16, 14, 2, 15, 40, 12683 }, // ŝ
+    { 14, 19, 18, 2, 15, 67, 12723 }, // Ş
+    { 10, 14, 14, 2, 10, 35, 12790 }, // ş
+    { 14, 22, 18, 2, 21, 77, 12825 }, // Š
+    { 10, 16, 14, 2, 15, 40, 12902 }, // š
+    { 13, 19, 18, 2, 14, 62, 12942 }, // Ţ
+    { 9, 17, 13, 2, 13, 39, 13004 }, // ţ
+    { 13, 21, 18, 2, 21, 69, 13043 }, // Ť
+    { 12, 16, 13, 2, 15, 48, 13112 }, // ť
+    { 13, 14, 18, 2, 14, 46, 13160 }, // Ŧ
+    { 10, 14, 13, 1, 13, 35, 13206 }, // ŧ
+    { 13, 22, 17, 2, 21, 72, 13241 }, // Ũ
+    { 10, 15, 14, 2, 15, 38, 13313 }, // ũ
+    { 13, 22, 17, 2, 21, 72, 13351 }, // Ū
+    { 10, 15, 14, 2, 15, 38, 13423 }, // ū
+    { 13, 22, 17, 2, 21, 72, 13461 }, // Ŭ
+    { 10, 16, 14, 2, 16, 40, 13533 }, // ŭ
+    { 13, 23, 17, 2, 22, 75, 13573 }, // Ů
+    { 10, 16, 14, 2, 16, 40, 13648 }, // ů
+    { 15, 21, 17, 2, 20, 79, 13688 }, // Ű
+    { 15, 14, 14, 1, 14, 53, 13767 }, // ű
+    { 13, 19, 17, 2, 14, 62, 13820 }, // Ų
+    { 10, 14, 14, 2, 9, 35, 13882 }, // ų
+    { 20, 21, 24, 2, 21, 105, 13917 }, // Ŵ
+    { 14, 19, 19, 2, 17, 67, 14022 }, // ŵ
+    { 14, 22, 18, 2, 22, 77, 14089 }, // Ŷ
+    { 11, 23, 15, 2, 18, 64, 14166 }, // ŷ
+    { 14, 22, 18, 2, 22, 77, 14230 }, // Ÿ
+    { 14, 19, 18, 2, 19, 67, 14336 }, // Ź
+    { 11, 15, 15, 2, 15, 42, 14403 }, // ź
+    { 14, 19, 18, 2, 19, 67, 14445 }, // Ż
+    { 11, 15, 15, 2, 15, 42, 14512 }, // ż
+    { 14, 21, 18, 2, 21, 74, 14554 }, // Ž
+    { 11, 17, 15, 2, 17, 47, 14628 }, // ž
+    { 7, 15, 10, 1, 14, 27, 14675 }, // ſ
+    { 7, 4, 0, 0, 13, 7, 14702 }, // ̀
+    { 5, 4, 0, 0, 13, 5, 14709 }, // ́
+    { 10, 5, 0, 0, 1, 13, 14714 }, // ̂
+    { 7, 4, 0, 0, 12, 7, 14727 }, // ̃
+    { 10, 3, 0, 0, 12, 8, 14734 }, // ̄
+    { 12, 3, 0, 0, 15, 9, 14742 }, // ̅
+    { 9, 5, 0, 0, 13, 12, 14751 }, // ̆
+    { 5, 4, 0, 2, 14, 5, 14763 }, // ̇
+    { 8, 4, 0, 0, 13, 8, 14768 }, // ̈
+    { 4, 4, 0, 3, 11, 4, 14776 }, // ̉
+    { 5, 4, 0, 0, 13, 5, 14780 }, // ̊
+    { 15, 4, 0, 0, 13, 15, 14785 }, // ̋
+    { 10, 5, 0, 0, 13, 13, 14800 }, // ̌
+    { 15, 4, 0, -4, 13, 15, 14813 }, // ̏
+    { 6, 6, 0, 0, 13, 9, 14828 }, // ̒
+    { 6, 6, 0, 0, 13, 9, 14837 }, // ̓
+    { 6, 6, 0, -1, 13, 9, 14846 }, // ̔
+    { 5, 5, 0, 0, 0, 7, 14855 }, // ̘
+    { 5, 5, 0, 0, 0, 7, 14862 }, // ̙
+    { 9, 5, 0, 0, 14, 12, 14869 }, // ̚
+    { 4, 5, 0, 0, 11, 5, 14881 }, // ̛
+    { 4, 6, 0, 0, 0, 6, 14886 }, // ̜
+    { 6, 4, 0, 0, 3, 6, 14892 }, // ̝
+    { 6, 4, 0, 0, 0, 6, 14898 }, // ̞
+    { 4, 5, 0, 1, -1, 5, 14904 }, // ̟
+    { 10, 3, 0, 0, -2, 8, 14909 }, // ̠
+    { 5, 4, 0, 0, 2, 5, 14917 }, // ̣
+    { 8, 4, 0, 0, -1, 8, 14922 }, // ̤
+    { 5, 4, 0, 0, 13, 5, 14930 }, // ̥
+    { 6, 6, 0, 0, 3, 9, 14935 }, // ̦
+    { 5, 6, 0, 0, 1, 8, 14944 }, // ̧
+    { 5, 6, 0, 1, 1, 8, 14952 }, // ̨
+    { 4, 6, 0, 0, 0, 6, 14960 }, // ̩
+    { 7, 4, 0, 0, 0, 7, 14966 }, // ̪
+    { 11, 5, 0, -1, 1, 14, 14973 }, // ̬
+    { 11, 5, 0, -1, 1, 14, 14987 }, // ̭
+    { 7, 4, 0, 1, 14, 7, 15001 }, // ̰
+    { 9, 3, 0, 0, 14, 7, 15008 }, // ̱
+    { 9, 3, 0, 0, -1, 7, 15015 }, // ̲
+    { 7, 4, 0, 1, 14, 7, 15022 }, // ̴
+    { 9, 2, 0, 0, 6, 5, 15029 }, // ̵
+    { 4, 6, 0, 0, 0, 6, 15034 }, // ̹
+    { 8, 6, 0, 0, 1, 12, 15040 }, // ̺
+    { 7, 6, 0, 0, 1, 11, 15052 }, // ̻
+    { 7, 5, 0, 0, 1, 9, 15063 }, // ̼
+    { 6, 4, 0, 1, 13, 6, 15072 }, // ̽
+    { 7, 4, 0, 0, 12, 7, 15078 }, // ͂
+    { 3, 5, 0, 4, 15, 4, 15085 }, // ̓
+    { 9, 12, 0, 0, 21, 27, 15089 }, // ̈́
+    { 7, 4, 0, 0, 14, 7, 15116 }, // ͆
+    { 10, 7, 0, 0, 0, 18, 15123 }, // ͇
+    { 8, 5, 0, 0, 0, 10, 15141 }, // ͈
+    { 7, 6, 0, 0, 0, 11, 15151 }, // ͉
+    { 8, 13, 0, 1, 18, 26, 15162 }, // ͊
+    { 16, 13, 0, 0, 19, 52, 15188 }, // ͋
+    { 10, 10, 0, 7, 10, 25, 15240 }, // ͌
+    { 9, 4, 0, 1, -2, 9, 15265 }, // ͍
+    { 4, 3, 0, 0, 2, 3, 15274 }, // ͎
+    { 15, 5, 0, 0, 1, 19, 15277 }, // ͜
+    { 15, 5, 0, 0, 14, 19, 15296 }, // ͡
+    { 19, 6, 0, 0, 0, 29, 15315 }, // ͢
+    { 11, 20, 15, 2, 20, 55, 15344 }, // Ѐ
+    { 11, 20, 15, 2, 20, 55, 15399 }, // Ё
+    { 14, 16, 11, -2, 15, 56, 15454 }, // Ђ
+    { 11, 20, 11, 0, 19, 55, 15510 }, // Ѓ
+    { 14, 15, 14, 0, 13, 53, 15565 }, // Є
+    { 14, 16, 18, 2, 15, 56, 15618 }, // Ѕ
+    { 5, 14, 9, 2, 14, 18, 15674 }, // І
+    { 8, 21, 9, 0, 21, 42, 15692 }, // Ї
+    { 11, 18, 15, 2, 14, 50, 15734 }, // Ј
+    { 17, 15, 19, 1, 13, 64, 15784 }, // Љ
+    { 16, 15, 10, -3, 14, 60, 15848 }, // Њ
+    { 16, 16, 18, 2, 16, 64, 15908 }, // Ћ
+    { 13, 19, 18, 2, 19, 62, 15972 }, // Ќ
+    { 13, 21, 17, 2, 21, 69, 16034 }, // Ѝ
+    { 11, 22, 13, 1, 20, 61, 16103 }, // Ў
+    { 11, 17, 13, 1, 13, 47, 16164 }, // Џ
+    { 14, 14, 16, 1, 14, 49, 16211 }, // А
+    { 9, 13, 11, 1, 13, 30, 16260 }, // Б
+    { 10, 14, 11, 1, 13, 35, 16290 }, // В
+    { 11, 14, 11, 0, 13, 39, 16325 }, // Г
+    { 14, 15, 14, 0, 13, 53, 16384 }, // Д
+    { 11, 15, 15, 2, 15, 42, 16437 }, // Е
+    { 21, 14, 19, -1, 14, 74, 16479 }, // Ж
+    { 9, 13, 11, 1, 13, 30, 16553 }, // З
+    { 13, 14, 17, 2, 14, 46, 16583 }, // И
+    { 13, 22, 17, 2, 22, 72, 16629 }, // Й
+    { 13, 14, 18, 2, 14, 46, 16701 }, // К
+    { 11, 15, 10, -1, 13, 42, 16747 }, // Л
+    { 14, 14, 14, 0, 13, 49, 16789 }, // М
+    { 13, 14, 18, 2, 14, 46, 16838 }, // Н
+    { 15, 15, 19, 2, 14, 57, 16884 }, // О
+    { 11, 14, 11, 0, 13, 39, 16941 }, // П
+    { 11, 15, 15, 2, 15, 42, 16980 }, // Р
+    { 12, 15, 17, 2, 15, 45, 17022 }, // С
+    { 13, 14, 18, 2, 14, 46, 17067 }, // Т
+    { 11, 15, 13, 1, 13, 42, 17113 }, // У
+    { 13, 13, 15, 1, 13, 43, 17155 }, // Ф
+    { 14, 14, 19, 2, 14, 49, 17198 }, // Х
+    { 12, 17, 12, 0, 13, 51, 17247 }, // Ц
+    { 9, 13, 11, 1, 13, 30, 17298 }, // Ч
+    { 13, 14, 14, 0, 13, 46, 17328 }, // Ш
+    { 15, 16, 15, 0, 13, 60, 17374 }, // Щ
+    { 13, 12, 10, -3, 12, 39, 17434 }, // Ъ
+    { 17, 14, 19, 0, 14, 60, 17473 }, // Ы
+    { 10, 12, 10, 0, 12, 30, 17533 }, // Ь
+    { 13, 15, 14, 0, 13, 49, 17563 }, // Э
+    { 14, 13, 15, 1, 13, 46, 17612 }, // Ю
+    { 12, 15, 16, 2, 14, 45, 17658 }, // Я
+    { 10, 10, 14, 2, 10, 25, 17703 }, // а
+    { 11, 16, 12, 0, 15, 44, 17728 }, // б
+    { 8, 9, 12, 2, 9, 18, 17772 }, // в
+    { 10, 11, 10, 0, 9, 28, 17790 }, // г
+    { 12, 12, 13, 0, 9, 36, 17818 }, // д
+    { 10, 9, 14, 2, 9, 23, 17854 }, // е
+    { 20, 12, 24, 2, 12, 60, 17877 }, // ж
+    { 7, 9, 8, 0, 9, 16, 17937 }, // з
+    { 11, 11, 11, 0, 9, 31, 17953 }, // и
+    { 9, 16, 11, 1, 16, 36, 17984 }, // й
+    { 10, 9, 13, 2, 9, 23, 18020 }, // к
+    { 8, 10, 7, -1, 9, 20, 18043 }, // л
+    { 12, 11, 14, 1, 11, 33, 18063 }, // м
+    { 10, 11, 14, 2, 11, 28, 18096 }, // н
+    { 10, 9, 14, 2, 9, 23, 18124 }, // о
+    { 11, 11, 11, 0, 9, 31, 18147 }, // п
+    { 12, 15, 16, 2, 10, 45, 18178 }, // р
+    { 9, 10, 13, 2, 10, 23, 18223 }, // с
+    { 11, 11, 11, 0, 9, 31, 18246 }, // т
+    { 11, 14, 15, 2, 9, 39, 18277 }, // у
+    { 14, 13, 15, 0, 9, 46, 18316 }, // ф
+    { 12, 11, 12, 0, 9, 33, 18362 }, // х
+    { 12, 12, 12, 0, 9, 36, 18395 }, // ц
+    { 7, 9, 8, 0, 9, 16, 18432 }, // ч
+    { 13, 10, 14, 0, 9, 33, 18448 }, // ш
+    { 15, 13, 15, 0, 9, 49, 18481 }, // щ
+    { 10, 10, 8, -3, 10, 25, 18530 }, // ъ
+    { 13, 11, 15, 0, 11, 36, 18555 }, // ы
+    { 7, 10, 8, 0, 10, 18, 18591 }, // ь
+    { 9, 10, 11, 1, 10, 23, 18609 }, // э
+    { 11, 9, 12, 1, 9, 25, 18632 }, // ю
+    { 10, 11, 14, 2, 11, 28, 18657 }, // я
+    { 10, 17, 14, 2, 17, 43, 18685 }, // ѐ
+    { 10, 16, 14, 2, 16, 40, 18728 }, // ё
+    { 13, 16, 15, 0, 14, 52, 18768 }, // ђ
+    { 10, 15, 10, 0, 13, 38, 18820 }, // ѓ
+    { 10, 10, 10, 0, 9, 25, 18858 }, // є
+    { 10, 11, 14, 2, 10, 28, 18883 }, // ѕ
+    { 4, 15, 8, 2, 15, 15, 18911 }, // і
+    { 8, 15, 8, 0, 15, 30, 18926 }, // ї
+    { 7, 20, 10, 2, 15, 35, 18956 }, // ј
+    { 12, 10, 13, 1, 9, 30, 18991 }, // љ
+    { 11, 9, 7, -2, 9, 25, 19021 }, // њ
+    { 13, 14, 15, 0, 14, 46, 19046 }, // ћ
+    { 10, 14, 13, 2, 14, 35, 19092 }, // ќ
+    { 11, 17, 11, 0, 15, 47, 19127 }, // ѝ
+    { 11, 22, 15, 2, 17, 61, 19174 }, // ў
+    { 8, 13, 10, 1, 10, 26, 19235 }, // џ
+    { 12, 14, 12, 0, 13, 42, 19261 }, // Ѣ
+    { 12, 14, 11, -1, 13, 42, 19303 }, // ѣ
+    { 16, 14, 14, -1, 13, 56, 19345 }, // Ѫ
+    { 12, 10, 10, -1, 10, 30, 19401 }, // ѫ
+    { 13, 18, 18, 3, 18, 59, 19431 }, // Ѳ
+    { 11, 13, 14, 2, 13, 36, 19490 }, // ѳ
+    { 17, 17, 19, 2, 17, 73, 19526 }, // Ѵ
+    { 12, 12, 14, 1, 12, 36, 19599 }, // ѵ
+    { 8, 6, 0, 1, 16, 12, 19635 }, // ҆
+    { 11, 15, 11, 0, 14, 42, 19647 }, // Ґ
+    { 10, 14, 10, 0, 12, 35, 19689 }, // ґ
+    { 12, 14, 11, -1, 13, 42, 19724 }, // Ғ
+    { 8, 9, 8, -1, 9, 18, 19766 }, // ғ
+    { 11, 16, 10, -1, 15, 44, 19784 }, // Ҕ
+    { 7, 10, 6, 0, 9, 18, 19828 }, // ҕ
+    { 23, 17, 24, 1, 14, 98, 19846 }, // Җ
+    { 15, 11, 17, 1, 9, 42, 19944 }, // җ
+    { 9, 16, 11, 1, 13, 36, 19986 }, // Ҙ
+    { 7, 14, 8, 0, 9, 25, 20022 }, // ҙ
+    { 14, 17, 12, 1, 14, 60, 20047 }, // Қ
+    { 10, 11, 8, 1, 9, 28, 20107 }, // қ
+    { 16, 14, 18, 1, 13, 56, 20135 }, // Ҝ
+    { 12, 9, 12, 0, 9, 27, 20191 }, // ҝ
+    { 13, 14, 18, 2, 14, 46, 20218 }, // Ҟ
+    { 12, 14, 15, 1, 14, 42, 20264 }, // ҟ
+    { 15, 14, 18, 0, 14, 53, 20306 }, // Ҡ
+    { 11, 9, 12, 0, 9, 25, 20359 }, // ҡ
+    { 14, 16, 13, 0, 14, 56, 20384 }, // Ң
+    { 10, 11, 9, 0, 9, 28, 20440 }, // ң
+    { 19, 14, 18, 2, 14, 67, 20480 }, // Ҥ
+    { 14, 9, 12, 1, 9, 32, 20547 }, // ҥ
+    { 18, 16, 21, 2, 15, 72, 20579 }, // Ҧ
+    { 16, 17, 21, 2, 12, 68, 20651 }, // ҧ
+    { 17, 14, 11, -3, 13, 60, 20719 }, // Ҩ
+    { 13, 11, 9, -2, 10, 36, 20779 }, // ҩ
+    { 12, 17, 17, 2, 15, 51, 20815 }, // Ҫ
+    { 9, 12, 13, 2, 10, 27, 20866 }, // ҫ
+    { 13, 16, 13, 0, 14, 52, 20893 }, // Ҭ
+    { 9, 11, 9, 0, 9, 25, 20945 }, // ҭ
+    { 14, 14, 18, 2, 14, 49, 20970 }, // Ү
+    { 11, 13, 13, 1, 9, 36, 21019 }, // ү
+    { 14, 14, 18, 2, 14, 49, 21055 }, // Ұ
+    { 11, 14, 13, 1, 10, 39, 21104 }, // ұ
+    { 14, 17, 13, 2, 14, 60, 21143 }, // Ҳ
+    { 10, 11, 9, 1, 9, 28, 21203 }, // ҳ
+    { 16, 16, 10, -3, 13, 64, 21231 }, // Ҵ
+    { 11, 12, 7, -2, 9, 33, 21295 }, // ҵ
+    { 12, 17, 11, 0, 13, 51, 21328 }, // Ҷ
+    { 8, 12, 8, 0, 9, 24, 21379 }, // ҷ
+    { 9, 13, 11, 1, 13, 30, 21403 }, // Ҹ
+    { 7, 9, 8, 0, 9, 16, 21433 }, // ҹ
+    { 11, 15, 11, 0, 14, 42, 21449 }, // Һ
+    { 11, 14, 15, 2, 14, 39, 21491 }, // һ
+    { 18, 13, 16, -3, 12, 59, 21530 }, // Ҽ
+    { 14, 9, 12, -3, 9, 32, 21589 }, // ҽ
+    { 19, 15, 15, -3, 12, 72, 21621 }, // Ҿ
+    { 14, 12, 11, -2, 10, 42, 21693 }, // ҿ
+    { 5, 14, 9, 2, 14, 18, 21735 }, // Ӏ
+    { 21, 23, 19, -1, 23, 121, 21753 }, // Ӂ
+    { 20, 20, 24, 2, 20, 100, 21874 }, // ӂ
+    { 11, 18, 12, 1, 13, 50, 21974 }, // Ӄ
+    { 8, 13, 8, 0, 9, 26, 22024 }, // ӄ
+    { 13, 17, 10, -1, 13, 56, 22050 }, // Ӆ
+    { 9, 12, 7, -1, 9, 27, 22106 }, // ӆ
+    { 14, 19, 18, 2, 14, 67, 22133 }, // Ӈ
+    { 10, 13, 12, 1, 9, 33, 22200 }, // ӈ
+    { 14, 20, 18, 2, 14, 70, 22233 }, // Ӊ
+    { 11, 13, 12, 1, 9, 36, 22303 }, // ӊ
+    { 11, 17, 11, 0, 13, 47, 22339 }, // Ӌ
+    { 7, 12, 10, 2, 9, 21, 22386 }, // ӌ
+    { 17, 20, 19, 2, 14, 85, 22407 }, // Ӎ
+    { 12, 13, 13, 1, 9, 39, 22528 }, // ӎ
+    { 4, 13, 10, 3, 12, 13, 22567 }, // ӏ
+    { 14, 20, 16, 1, 20, 70, 22580 }, // Ӑ
+    { 10, 15, 14, 2, 15, 38, 22650 }, // ӑ
+    { 14, 19, 16, 1, 19, 67, 22688 }, // Ӓ
+    { 10, 15, 14, 2, 15, 38, 22755 }, // ӓ
+    { 21, 15, 23, 1, 14, 79, 22793 }, // Ӕ
+    { 17, 10, 21, 2, 10, 43, 22872 }, // ӕ
+    { 11, 21, 15, 2, 21, 58, 22915 }, // Ӗ
+    { 10, 17, 14, 2, 17, 43, 22973 }, // ӗ
+    { 13, 15, 18, 3, 14, 49, 23016 }, // Ә
+    { 10, 11, 14, 3, 10, 28, 23065 }, // ә
+    { 13, 20, 18, 3, 19, 65, 23093 }, // Ӛ
+    { 10, 14, 14, 3, 10, 35, 23158 }, // ӛ
+    { 21, 22, 23, 1, 22, 116, 23193 }, // Ӝ
+    { 20, 19, 24, 2, 19, 95, 23309 }, // ӝ
+    { 9, 21, 11, 1, 21, 48, 23404 }, // Ӟ
+    { 8, 13, 8, -1, 13, 26, 23452 }, // ӟ
+    { 9, 14, 11, 1, 13, 32, 23478 }, // Ӡ
+    { 9, 14, 11, 1, 10, 32, 23510 }, // ӡ
+    { 13, 22, 17, 2, 22, 72, 23542 }, // Ӣ
+    { 11, 17, 11, 0, 15, 47, 23614 }, // ӣ
+    { 13, 21, 17, 2, 21, 69, 23661 }, // Ӥ
+    { 11, 16, 11, 0, 14, 44, 23730 }, // ӥ
+    { 15, 20, 19, 2, 19, 75, 23774 }, // Ӧ
+    { 11, 16, 14, 1, 16, 44, 23849 }, // ӧ
+    { 13, 14, 19, 3, 14, 46, 23893 }, // Ө
+    { 10, 9, 14, 2, 9, 23, 23939 }, // ө
+    { 13, 19, 19, 3, 19, 62, 23962 }, // Ӫ
+    { 10, 14, 14, 2, 14, 35, 24024 }, // ӫ
+    { 13, 22, 14, 0, 20, 72, 24059 }, // Ӭ
+    { 9, 14, 11, 1, 14, 32, 24131 }, // ӭ
+    { 11, 22, 13, 1, 20, 61, 24163 }, // Ӯ
+    { 11, 22, 15, 2, 17, 61, 24224 }, // ӯ
+    { 11, 21, 13, 1, 19, 58, 24285 }, // Ӱ
+    { 11, 22, 15, 2, 17, 61, 24343 }, // ӱ
+    { 15, 21, 13, 0, 19, 79, 24404 }, // Ӳ
+    { 15, 21, 15, 2, 16, 79, 24483 }, // ӳ
+    { 9, 17, 11, 1, 17, 39, 24576 }, // Ӵ
+    { 8, 13, 8, 0, 13, 26, 24615 }, // ӵ
+    { 11, 16, 11, 0, 13, 44, 24641 }, // Ӷ
+    { 8, 11, 8, 0, 9, 22, 24685 }, // ӷ
+    { 17, 22, 19, 0, 22, 94, 24707 }, // Ӹ
+    { 13, 18, 15, 0, 18, 59, 24801 }, // ӹ
+    { 16, 16, 19, 2, 14, 64, 24860 }, // Ӽ
+    { 12, 11, 13, 1, 9, 33, 24924 }, // ӽ
+    { 0, 0, 11, 0, 0, 0, 24957 }, //  
+    { 0, 0, 19, 0, 0, 0, 24957 }, //  
+    { 0, 0, 11, 0, 0, 0, 24957 }, //  
+    { 0, 0, 19, 0, 0, 0, 24957 }, //  
+    { 0, 0, 8, 0, 0, 0, 24957 }, //  
+    { 0, 0, 7, 0, 0, 0, 24957 }, //  
+    { 0, 0, 5, 0, 0, 0, 24957 }, //  
+    { 0, 0, 12, 0, 0, 0, 24957 }, //  
+    { 0, 0, 4, 0, 0, 0, 24957 }, //  
+    { 0, 0, 6, 0, 0, 0, 24957 }, //  
+    { 0, 0, 5, 0, 0, 0, 24957 }, //  
+    { 0, 0, 3, 0, 0, 0, 24957 }, // ​
+    { 0, 0, 0, 0, 0, 0, 24957 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 24957 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 24957 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 24957 }, // ‏
+    { 9, 2, 9, 0, 6, 5, 24957 }, // ‐
+    { 9, 2, 9, 0, 6, 5, 24962 }, // ‑
+    { 13, 2, 9, -2, 6, 7, 24967 }, // ‒
+    { 13, 4, 13, 0, 7, 13, 24974 }, // –
+    { 18, 4, 19, 0, 7, 18, 24987 }, // —
+    { 18, 4, 19, 0, 7, 18, 25005 }, // ―
+    { 8, 16, 9, 2, 13, 32, 25023 }, // ‖
+    { 15, 6, 9, -3, -1, 23, 25055 }, // ‗
+    { 6, 6, 7, 1, 15, 9, 25078 }, // ‘
+    { 6, 6, 7, 1, 15, 9, 25087 }, // ’
+    { 6, 6, 5, 0, 3, 9, 25096 }, // ‚
+    { 6, 6, 7, 1, 15, 9, 25105 }, // ‛
+    { 11, 6, 13, 1, 15, 17, 25114 }, // “
+    { 11, 6, 13, 1, 15, 17, 25131 }, // ”
+    { 6, 6, 5, 0, 3, 9, 25148 }, // „
+    { 11, 6, 13, 1, 15, 17, 25157 }, // ‟
+    { 10, 24, 13, 2, 18, 60, 25174 }, // †
+    { 10, 23, 14, 3, 17, 58, 25234 }, // ‡
+    { 14, 13, 8, -3, 15, 46, 25292 }, // •
+    { 6, 7, 10, 2, 8, 11, 25338 }, // ‣
+    { 4, 4, 10, 3, 4, 4, 25349 }, // ․
+    { 4, 4, 10, 3, 4, 4, 25353 }, // ‥
+    { 16, 4, 16, 0, 4, 16, 25357 }, // …
+    { 3, 2, 9, 3, 6, 2, 25373 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 25375 }, //  
+    { 13, 15, 19, 3, 13, 49, 25375 }, // ‰
+    { 7, 6, 9, 2, 15, 11, 25424 }, // ′
+    { 12, 6, 13, 2, 15, 18, 25435 }, // ″
+    { 13, 6, 7, 1, 14, 20, 25453 }, // ‴
+    { 5, 6, 7, 1, 14, 8, 25473 }, // ‵
+    { 8, 6, 7, 0, 14, 12, 25481 }, // ‶
+    { 13, 6, 7, -3, 14, 20, 25493 }, // ‷
+    { 10, 4, 11, 0, 14, 10, 25513 }, // ‸
+    { 5, 10, 7, 1, 10, 13, 25523 }, // ‹
+    { 6, 10, 7, 0, 10, 15, 25536 }, // ›
+    { 18, 22, 23, 3, 17, 99, 25551 }, // ※
+    { 6, 22, 10, 2, 19, 33, 25650 }, // ‼
+    { 11, 27, 14, 1, 23, 75, 25683 }, // ‽
+    { 9, 2, 9, 0, 14, 5, 25758 }, // ‾
+    { 9, 5, 9, 0, 12, 12, 25763 }, // ‿
+    { 13, 12, 11, -1, 15, 39, 25775 }, // ⁂
+    { 11, 15, 21, 5, 13, 42, 25814 }, // ⁄
+    { 21, 21, 25, 2, 19, 111, 25856 }, // ⁇
+    { 18, 22, 20, 1, 19, 99, 25967 }, // ⁈
+    { 14, 22, 13, -1, 19, 77, 26066 }, // ⁉
+    { 13, 29, 15, 1, 20, 95, 26143 }, // ⁒
+    { 0, 0, 78, 0, 0, 0, 26238 }, //  
+    { 5, 7, 6, 0, 14, 9, 26238 }, // ⁰
+    { 6, 6, 6, 0, 14, 9, 26247 }, // ⁴
+    { 6, 8, 6, 0, 14, 12, 26256 }, // ⁵
+    { 6, 7, 6, 0, 14, 11, 26268 }, // ⁶
+    { 6, 8, 6, 0, 15, 12, 26279 }, // ⁷
+    { 6, 7, 6, 0, 14, 11, 26291 }, // ⁸
+    { 6, 8, 6, 0, 14, 12, 26302 }, // ⁹
+    { 10, 10, 15, 2, 10, 25, 26314 }, // ⁿ
+    { 6, 7, 6, 0, 4, 11, 26339 }, // ₀
+    { 5, 7, 6, 0, 4, 9, 26350 }, // ₁
+    { 6, 7, 6, 0, 4, 11, 26359 }, // ₂
+    { 6, 7, 6, 0, 4, 11, 26370 }, // ₃
+    { 6, 7, 6, 0, 4, 11, 26381 }, // ₄
+    { 5, 8, 6, 0, 5, 10, 26392 }, // ₅
+    { 6, 7, 6, 0, 4, 11, 26402 }, // ₆
+    { 6, 8, 6, 0, 5, 12, 26413 }, // ₇
+    { 6, 7, 6, 0, 4, 11, 26425 }, // ₈
+    { 6, 8, 6, 0, 4, 12, 26436 }, // ₉
+    { 7, 23, 8, 1, 17, 41, 26448 }, // ₍
+    { 8, 23, 7, -1, 17, 46, 26489 }, // ₎
+    { 12, 22, 17, 2, 18, 66, 26535 }, // ₡
+    { 12, 15, 17, 2, 15, 45, 26624 }, // ₢
+    { 12, 14, 12, 0, 13, 42, 26669 }, // ₤
+    { 19, 14, 17, -1, 14, 67, 26711 }, // ₦
+    { 15, 15, 15, 0, 15, 57, 26778 }, // ₧
+    { 18, 15, 22, 2, 14, 68, 26835 }, // ₨
+    { 14, 14, 14, 0, 14, 49, 26903 }, // ₩
+    { 14, 13, 18, 2, 13, 46, 26952 }, // ₪
+    { 12, 14, 9, -1, 13, 42, 26998 }, // ₫
+    { 12, 17, 12, 0, 14, 51, 27040 }, // €
+    { 13, 14, 18, 2, 14, 46, 27091 }, // ₮
+    { 17, 15, 11, -1, 15, 64, 27137 }, // ₱
+    { 15, 21, 19, 2, 18, 79, 27201 }, // ₲
+    { 17, 15, 17, 3, 14, 64, 27280 }, // ₴
+    { 9, 13, 10, 2, 11, 30, 27344 }, // ₵
+    { 14, 16, 18, 2, 16, 56, 27374 }, // ₸
+    { 9, 13, 12, 1, 12, 30, 27430 }, // ₹
+    { 11, 13, 12, 0, 11, 36, 27460 }, // ₺
+    { 12, 14, 14, 1, 14, 42, 27496 }, // ₼
+    { 15, 15, 15, -2, 15, 57, 27538 }, // ₽
+    { 12, 11, 12, 0, 9, 33, 27595 }, // ←
+    { 13, 12, 13, 0, 10, 39, 27628 }, // ↑
+    { 12, 11, 13, 0, 9, 33, 27667 }, // →
+    { 13, 12, 13, 0, 11, 39, 27700 }, // ↓
+    { 14, 9, 17, 2, 9, 32, 27739 }, // ↔
+    { 10, 14, 13, 2, 15, 35, 27771 }, // ↕
+    { 10, 10, 13, 2, 10, 25, 27806 }, // ↖
+    { 10, 10, 11, 0, 10, 25, 27831 }, // ↗
+    { 10, 10, 11, 0, 9, 25, 27856 }, // ↘
+    { 10, 10, 11, 0, 9, 25, 27881 }, // ↙
+    { 13, 12, 16, 2, 10, 39, 27906 }, // ⇐
+    { 14, 14, 18, 2, 13, 49, 27945 }, // ⇑
+    { 13, 12, 16, 2, 10, 39, 27994 }, // ⇒
+    { 14, 14, 18, 2, 13, 49, 28033 }, // ⇓
+    { 15, 12, 18, 2, 10, 45, 28082 }, // ⇔
+    { 11, 15, 15, 2, 9, 42, 28127 }, // ⇕
+    { 11, 16, 11, 0, 15, 44, 28169 }, // ∂
+    { 18, 16, 19, 0, 15, 72, 28213 }, // ∅
+    { 14, 14, 14, 0, 13, 49, 28285 }, // ∆
+    { 12, 14, 12, 0, 13, 42, 28334 }, // ∏
+    { 12, 14, 12, 0, 13, 42, 28376 }, // ∐
+    { 10, 14, 10, 0, 13, 35, 28418 }, // ∑
+    { 10, 3, 10, 0, 6, 8, 28453 }, // −
+    { 14, 15, 16, 1, 14, 53, 28461 }, // √
+    { 15, 10, 15, 0, 11, 38, 28514 }, // ∞
+    { 14, 18, 14, 0, 13, 63, 28552 }, // ∫
+    { 5, 12, 5, 0, 12, 15, 28615 }, // ∶
+    { 10, 10, 24, 7, 10, 25, 28630 }, // ≈
+    { 13, 15, 21, 4, 14, 49, 28672 }, // ≠
+    { 15, 15, 13, -1, 13, 57, 28721 }, // ≤
+    { 15, 14, 14, 0, 12, 53, 28778 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
@@ -2588,4 +2040,9 @@ static const EpdFontData opendyslexic_8_bold = {
     22,
     -9,
     true,
+    opendyslexic_8_boldBlockOffsets,
+    opendyslexic_8_boldDirectGlyphs,
+    opendyslexic_8_boldGlyphPages,
+    35,
+    opendyslexic_8_boldPageGlyphs,
 };
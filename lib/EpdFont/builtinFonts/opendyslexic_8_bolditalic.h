@@ -2,2127 +2,1397 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_bolditalic
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_bolditalic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_8_bolditalic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_bolditalicBitmaps[33813] = {
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x02,
-    0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xA8, 0x00, 0x2A, 0x4A, 0xA0, 0x3F, 0x8B, 0xF0, 0x3F, 0x87, 0xF0,
-    0x2F, 0xC3, 0xF0, 0x1F, 0xC3, 0xF8, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00,
-    0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x15, 0xFD, 0x6F, 0x55, 0x40, 0x00, 0x3E,
-    0x0F, 0x80, 0x00, 0x00, 0x2F, 0x47, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x57, 0xF5, 0xFD, 0x55, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x1F,
-    0x40, 0x00, 0x00, 0x2A, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0x7E, 0x00, 0x0F,
-    0xD0, 0xF0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0xFE, 0x6E, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x1D, 0x02, 0xFF, 0xC1, 0xFF, 0xAF, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xB4, 0x02, 0xF8, 0x02, 0xE0, 0x0B,
-    0x1C, 0x07, 0xC0, 0x0D, 0x1C, 0x1F, 0x00, 0x1C, 0x3C, 0x3C, 0x00, 0x1F, 0xF4, 0xF4, 0x00, 0x0B,
-    0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x9F, 0xD0, 0x00, 0x2F, 0x78, 0xE0, 0x00, 0xBC, 0xB0, 0xE0, 0x01,
-    0xF0, 0xE1, 0xD0, 0x07, 0xD0, 0xFF, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0x5B, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x3C, 0x03, 0x80, 0x03, 0xC1, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x14, 0x1F, 0x8F, 0x4B, 0xC3, 0xF0,
-    0x3E, 0xF4, 0x3F, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x7F, 0xE0, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xC7, 0xF0, 0xFC, 0x3F, 0x86, 0xA0, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x63, 0xC7, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0x40, 0x1F,
-    0xFE, 0x03, 0xFF, 0xFE, 0x0B, 0x3C, 0xA0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x00, 0xF4, 0x00, 0x0F,
-    0x00, 0x01, 0xF0, 0x00, 0x04, 0x00, 0x02, 0xA4, 0x1F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x81, 0xFC,
-    0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x0A, 0x4B, 0xD3, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00,
-    0xBE, 0xF4, 0x02, 0xF0, 0x3C, 0x07, 0xC0, 0x3C, 0x0F, 0xDE, 0x3C, 0x0F, 0x7E, 0x7C, 0x1F, 0x3D,
-    0xF8, 0x2F, 0x3C, 0xF8, 0x3F, 0x02, 0xF0, 0x3F, 0x4B, 0xF0, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0x80,
-    0x1F, 0xFE, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x06, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x0D, 0xF4,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x1F,
-    0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0x97,
-    0xF0, 0x01, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xFF, 0x40, 0x09, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7D, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x02,
-    0xE6, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x07, 0xD0, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x00, 0x7A, 0xF0, 0x07, 0x8F, 0x80, 0x7C, 0x3D,
-    0x07, 0xEB, 0xFD, 0x3F, 0xFF, 0xF4, 0xAA, 0xFF, 0xC0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x01, 0x41, 0xF8, 0x00,
-    0x00, 0xF8, 0x09, 0x07, 0xF4, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xFD, 0x02, 0xF9, 0x54, 0x03, 0xC0, 0x00, 0x0F, 0xBF, 0x80,
-    0x1F, 0xFF, 0xE0, 0x2F, 0xD7, 0xF0, 0x3F, 0x41, 0xF0, 0x3E, 0x01, 0xF0, 0x3E, 0x03, 0xF0, 0x3F,
-    0xAF, 0xD0, 0x2F, 0xFF, 0x80, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0xC0,
-    0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x3F,
-    0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x0B, 0xFF, 0xC0,
-    0x0B, 0xD1, 0xF0, 0x03, 0xD0, 0x3C, 0x01, 0xF4, 0x7F, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0x40,
-    0x0F, 0xD7, 0xF0, 0x0F, 0xC0, 0x7D, 0x07, 0xE0, 0x2F, 0x01, 0xF8, 0x1F, 0xC0, 0x7F, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xE0, 0x00, 0x6E, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0xF8, 0x03, 0xD0, 0x7C,
-    0x0B, 0x40, 0x3C, 0x0F, 0x00, 0x3C, 0x0E, 0x00, 0xFC, 0x0F, 0x9B, 0xF8, 0x0F, 0xFF, 0xF4, 0x02,
-    0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x3A, 0xAF, 0xC0, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0xBE, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F,
-    0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0x90, 0x00, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFA, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1B, 0xFE,
-    0x00, 0x6F, 0xFF, 0xF8, 0x1F, 0xFF, 0xE4, 0x00, 0xBF, 0x90, 0x00, 0x03, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xD0, 0xFC, 0x00, 0x40, 0x1F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xFC,
-    0x00, 0x0B, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x24, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xBE, 0xAF, 0x00, 0x00, 0x3E, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x03, 0xC7, 0xF4, 0x0C,
-    0x00, 0xB4, 0xD7, 0x00, 0xC0, 0x0F, 0x30, 0x70, 0x2C, 0x01, 0xF3, 0xFF, 0x0B, 0x40, 0x2F, 0x2F,
-    0xFB, 0xD0, 0x02, 0xF4, 0x01, 0x90, 0x00, 0x1F, 0xE0, 0x14, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xCF, 0x80, 0x00,
-    0xF8, 0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x00, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x3F, 0x00, 0xF4, 0x03, 0xE0, 0x1F, 0x00,
-    0x7E, 0x5B, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0x80, 0x3F, 0x02, 0xF4, 0x03,
-    0xF0, 0x3F, 0xAA, 0xFE, 0x03, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF8, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF,
-    0x90, 0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x20, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0xF8,
-    0x0B, 0xD0, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x1F, 0x80, 0x07, 0xF0, 0x2F, 0x80, 0x6F, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0x0F, 0xE5, 0x50, 0x07, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xA4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x04, 0x02,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x1E, 0x94, 0x0F,
-    0xD0, 0x2F, 0xFD, 0x0F, 0xC0, 0x1B, 0xFD, 0x1F, 0xD0, 0x02, 0xF4, 0x0F, 0xFE, 0xAF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00,
-    0xFC, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0xFC, 0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03,
-    0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF,
-    0x00, 0x7F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07,
-    0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x10, 0x2F, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0x0B, 0xF0, 0x00, 0xFC, 0x7F, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0xFB, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x0F, 0xDB, 0xFC, 0x00,
-    0x3F, 0x0F, 0xFC, 0x02, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x7E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x7E, 0x00, 0x02, 0xF8, 0x15, 0x4F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x2F, 0xF8, 0x0F,
-    0xF8, 0x03, 0xFF, 0x83, 0xFF, 0x40, 0x3F, 0xFC, 0xBF, 0xF0, 0x07, 0xEF, 0xCF, 0xFF, 0x00, 0xBD,
-    0xFF, 0xFB, 0xE0, 0x0F, 0xCF, 0xFE, 0xBE, 0x01, 0xF8, 0xFF, 0xCF, 0xD0, 0x2F, 0x8F, 0xF5, 0xFC,
-    0x03, 0xF4, 0xFF, 0x3F, 0xC0, 0x7F, 0x0F, 0xD3, 0xF8, 0x0B, 0xF0, 0x54, 0xBF, 0x40, 0x00, 0x15,
-    0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF,
-    0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7,
-    0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82,
-    0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03,
-    0xFD, 0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF8, 0x06, 0xFE,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x00, 0x0F, 0x80, 0xF8, 0x01, 0xF4, 0x0B, 0x80, 0x2F, 0x02, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x94, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFD, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x7E,
-    0x00, 0xFD, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x01, 0xF4, 0x0F, 0xC0, 0x00,
-    0xFC, 0x03, 0xF0, 0x10, 0x3E, 0x00, 0xFC, 0x0F, 0xBF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x0F,
-    0x40, 0xF4, 0x03, 0xC0, 0x3C, 0x02, 0xF0, 0x1F, 0x00, 0xF8, 0x1F, 0x80, 0x3F, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x3E, 0x02, 0xFC, 0x1F, 0x80, 0xFE, 0x0B, 0xF0, 0x3F,
-    0x43, 0xFC, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0xFE, 0x01, 0xE0, 0x07, 0xF4, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03,
-    0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x0B, 0xCF, 0xC0, 0x01, 0xF8, 0xFD, 0x00, 0x3F, 0x0F, 0xD0, 0x0F, 0xD0, 0xFE, 0x02, 0xFC,
-    0x0B, 0xE0, 0x7F, 0x00, 0xBF, 0x0F, 0xE0, 0x0B, 0xF2, 0xFC, 0x00, 0xBF, 0xBF, 0x40, 0x0B, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x3F,
-    0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x50, 0x0B, 0xE0, 0x3F, 0x41, 0xF8, 0x1F, 0xC0, 0x7F, 0x03,
-    0xF8, 0x3F, 0x80, 0x7F, 0x0F, 0xFC, 0x7F, 0x00, 0x7F, 0x3F, 0xFC, 0xFD, 0x00, 0x7F, 0xBF, 0xFE,
-    0xFC, 0x00, 0xBF, 0xFD, 0xFF, 0xF4, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0xBF, 0xD0,
-    0x00, 0xBF, 0xD0, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40,
-    0x0F, 0xC0, 0x1F, 0x80, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x0F, 0xE2, 0xFD, 0x00, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F,
-    0x81, 0xFC, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x0F, 0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFA, 0xA4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x28, 0x38, 0x7C, 0x7C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E,
-    0x3F, 0x3F, 0x3E, 0x3C, 0x30, 0x10, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0xF0, 0x01,
-    0xFB, 0xD0, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x81,
-    0x55, 0x55, 0x50, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE0,
-    0x2F, 0xFF, 0x81, 0xF0, 0x7D, 0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3, 0xC0, 0x7F, 0x0F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xE0, 0x2F, 0xDF, 0x40, 0x01, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x64, 0x00, 0xFF, 0xFC, 0x07, 0xFE, 0xF8, 0x1F, 0xC0, 0xF0, 0xBC,
-    0x03, 0xC3, 0xF0, 0x1F, 0x0F, 0x81, 0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x02, 0xFF, 0xD0, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xD0, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF9, 0x90, 0x1F, 0xFF, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xFA, 0xF0,
-    0x01, 0xFF, 0xFE, 0x00, 0x7E, 0x6F, 0xD0, 0x0F, 0x40, 0xFC, 0x01, 0xE0, 0x1F, 0x80, 0x2E, 0x07,
-    0xF4, 0x02, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x2F, 0xD0, 0x01,
-    0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F, 0x00, 0x10, 0x2F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x1F,
-    0x00, 0x02, 0xE0, 0x01, 0xFF, 0xF0, 0x2F, 0xFE, 0x01, 0xFD, 0x40, 0x0F, 0xC0, 0x00, 0xF8, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1B, 0xDB, 0xC0, 0x0B, 0xFF,
-    0xF8, 0x01, 0xF4, 0xBF, 0x00, 0x3C, 0x07, 0xF0, 0x07, 0x40, 0xBE, 0x00, 0xB4, 0x1F, 0xC0, 0x0B,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x0B, 0xD0,
-    0x02, 0xFB, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFB, 0xF4, 0x03, 0xFF, 0xFC,
-    0x0B, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40, 0xF8, 0x3F, 0x01, 0xF4, 0x7F,
-    0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00, 0x0A, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0x1B, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x4A, 0x40, 0x3D,
-    0xF8, 0x02, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x7E,
-    0x7F, 0xC2, 0xF4, 0xFF, 0x80, 0x00, 0x78, 0x00, 0xB8, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xE0, 0x03,
-    0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x7F, 0xC0, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xBF, 0x4B, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0x43, 0xF4, 0x7C, 0x07, 0xD0, 0x3E, 0x07, 0xC0, 0xFC, 0x0B, 0xC0, 0xF8, 0x1F, 0x80, 0xF8, 0x0F,
-    0x42, 0xF0, 0x2F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x0B, 0xD0, 0xBD, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xEF, 0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8,
-    0x1F, 0x00, 0xF4, 0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x01,
-    0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x01,
-    0xFF, 0xAF, 0x00, 0x0B, 0xF0, 0x2C, 0x00, 0x3F, 0x40, 0xB0, 0x00, 0xFC, 0x03, 0xC0, 0x07, 0xF0,
-    0x1E, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0x15, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xD7, 0xC0, 0x2F, 0xFF, 0xE0, 0x1E, 0x07, 0xF0, 0x0F, 0x00, 0xFC,
-    0x07, 0x40, 0x7D, 0x02, 0xD0, 0x7F, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0xF0,
-    0x00, 0x05, 0x7E, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFB, 0xD0, 0x2F, 0xFD, 0x03, 0xF9, 0x40, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x2F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xAB,
-    0x00, 0xB4, 0x00, 0x01, 0xFA, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB, 0xFC, 0x3F, 0xFF,
-    0xD0, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x1F, 0x00, 0x0B, 0xC0,
-    0x2F, 0xFF, 0x5F, 0xFF, 0xD0, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xFA, 0x00,
-    0xFF, 0xD0, 0x3F, 0xF4, 0x00, 0x1F, 0x00, 0xF8, 0xB8, 0x03, 0xD2, 0xD0, 0x2F, 0x0F, 0x00, 0xFC,
-    0x3C, 0x07, 0xE1, 0xF0, 0x3F, 0x47, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x3D, 0x00,
-    0x3E, 0x0F, 0xC0, 0x2F, 0x02, 0xF0, 0x1F, 0x00, 0xBD, 0x0F, 0x40, 0x1F, 0x8F, 0x80, 0x03, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xF0,
-    0xF4, 0x00, 0x0F, 0x43, 0xD0, 0xF0, 0xFC, 0x0F, 0x4F, 0xC7, 0xD0, 0x3E, 0xFF, 0x7F, 0x00, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x07, 0xE3, 0xF0, 0x00, 0x3F, 0xFC,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0xFD,
-    0x2F, 0x80, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0,
-    0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF,
-    0x54, 0x00, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x1F, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x0F, 0x40, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3C, 0x00, 0xF0, 0x07,
-    0x80, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0x2D, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xFE, 0x00, 0x07,
-    0xF4, 0x00, 0x3F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x01, 0xFF,
-    0x80, 0x0B, 0xF8, 0x00, 0x29, 0x00, 0x00, 0x09, 0x18, 0x3F, 0x6C, 0x76, 0xF8, 0x20, 0x90, 0x00,
-    0xAA, 0x00, 0x7F, 0xC0, 0x1F, 0xD0, 0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x07, 0x00, 0x02, 0xFD, 0x02, 0xFF, 0xD0, 0x7F, 0xD4,
-    0x0F, 0x9C, 0x01, 0xF2, 0xC0, 0x2F, 0x38, 0x02, 0xF7, 0x80, 0x1F, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
-    0xA0, 0x00, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF,
-    0xF4, 0x01, 0xF4, 0x19, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xFF,
-    0xA0, 0x0F, 0xFF, 0xFD, 0x02, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x38, 0x03, 0xFF,
-    0xFC, 0x03, 0xFF, 0xF4, 0x03, 0xE2, 0xF0, 0x0B, 0xC3, 0xF0, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xE0, 0x14, 0x01, 0x40, 0x03, 0xF0, 0x02, 0xF0, 0x0B, 0xE0, 0x3F, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x03, 0xC0, 0x0D, 0x00, 0xB0, 0x03, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00, 0x34, 0x02, 0xC0, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0x42, 0x40, 0x00, 0xF9, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F,
-    0xEF, 0xF0, 0x01, 0xE0, 0x0B, 0x00, 0x2E, 0x55, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0xA4, 0x2E, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xBF, 0x90, 0x00, 0x1A, 0x0A,
-    0x4F, 0xC7, 0xE7, 0xF2, 0xF6, 0xFC, 0xFD, 0x01, 0xFD, 0x00, 0x79, 0xB0, 0x0F, 0xA3, 0x82, 0xF0,
-    0x34, 0x2F, 0xCB, 0x01, 0xEB, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x28, 0xD3, 0x0D, 0x7B,
-    0xC3, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x78, 0x1D, 0x02, 0xF0, 0xBC, 0x0F, 0x87,
-    0xD0, 0x3E, 0x0F, 0x80, 0x3F, 0x4F, 0xC0, 0x0F, 0xC3, 0xF0, 0x07, 0x81, 0xD0, 0x02, 0x00, 0x80,
-    0x2F, 0xE9, 0x43, 0xFF, 0xFD, 0x16, 0xAF, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xA4, 0x2F,
-    0xFF, 0xE3, 0xFF, 0xFD, 0x02, 0xF8, 0x03, 0xFB, 0xC2, 0xE5, 0x70, 0xEF, 0x1C, 0x3D, 0xDE, 0x0F,
-    0xBF, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x2A, 0xA5, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x07,
-    0xFF, 0x00, 0xF4, 0xB8, 0x2F, 0x0F, 0x42, 0xFB, 0xF0, 0x1F, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xFF, 0xFC, 0x02, 0xAF, 0xE9, 0x00, 0x03,
-    0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0x4C, 0x01, 0xC0, 0x74, 0x3D, 0x0B, 0xF4, 0x00, 0x00,
-    0x0F, 0x80, 0x0C, 0x01, 0xC1, 0xF4, 0x03, 0x8B, 0xF0, 0x64, 0x00, 0x01, 0x03, 0xC3, 0xD2, 0xE0,
-    0x00, 0x7C, 0x03, 0xE0, 0x0B, 0x80, 0x3D, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xFC, 0x02, 0xF0,
-    0x1F, 0x80, 0x3F, 0x03, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xBF, 0xFE, 0x02,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0x40, 0x3F, 0xE3,
-    0xC0, 0x2F, 0xF5, 0xF0, 0x0F, 0xFC, 0xB8, 0x03, 0xFE, 0x3D, 0x00, 0x7F, 0x4F, 0x00, 0x0F, 0xC7,
-    0xC0, 0x07, 0xE2, 0xE0, 0x03, 0xF4, 0xF4, 0x01, 0xFC, 0x3C, 0x00, 0xFE, 0x1F, 0x00, 0x7F, 0x4B,
-    0x80, 0x3F, 0xC3, 0xD0, 0x0F, 0xE0, 0xF0, 0x01, 0x50, 0x14, 0x00, 0x0F, 0x8B, 0xD3, 0xF5, 0xA8,
-    0x01, 0x00, 0xB0, 0x0F, 0x41, 0x7C, 0x3F, 0x82, 0x90, 0x06, 0x03, 0xC0, 0xA0, 0x34, 0x0C, 0x2F,
-    0xC1, 0x50, 0x00, 0x00, 0x2F, 0x02, 0x8A, 0x0C, 0x38, 0x3F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x04, 0x00, 0x3C, 0x0E, 0x00, 0x1F, 0x47, 0xD0, 0x02, 0xF0, 0xF8, 0x00, 0xF8, 0x3E, 0x02,
-    0xF8, 0xBE, 0x03, 0xF1, 0xF8, 0x03, 0xC0, 0xF0, 0x01, 0x40, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00, 0xF0, 0x01, 0xD0, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x02, 0xE0, 0x03, 0xFF, 0x40, 0xBC, 0x34, 0x3F,
-    0xF0, 0x1F, 0x0F, 0x00, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0xF4, 0xDF, 0x00, 0x00, 0x3E, 0x38,
-    0xE0, 0x00, 0x0F, 0xCF, 0xFF, 0x40, 0x02, 0xF0, 0xBF, 0xF0, 0x00, 0xBC, 0x00, 0x3C, 0x00, 0x1F,
-    0x40, 0x07, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x01, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x01, 0xD0, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0xFD, 0x02, 0xE0, 0x50, 0x3F, 0xF0,
-    0x2F, 0x2F, 0xF4, 0x00, 0x01, 0xF0, 0x91, 0xE0, 0x00, 0x1F, 0x40, 0x07, 0x40, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x0F, 0xFD, 0x00,
-    0xBC, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x25, 0xB0,
-    0x00, 0x7C, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2F, 0xC0, 0x03, 0xC0, 0x03, 0xFC, 0x00, 0xF0, 0x00,
-    0x43, 0xC0, 0x3D, 0x00, 0x2F, 0xF8, 0x0F, 0x43, 0x43, 0xFF, 0x03, 0xE0, 0xF0, 0x00, 0x00, 0xB8,
-    0x3F, 0x00, 0x00, 0x2F, 0x0C, 0xE0, 0x00, 0x0B, 0xC3, 0xAE, 0x00, 0x01, 0xF0, 0xFF, 0xF4, 0x00,
-    0x7D, 0x05, 0x7E, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x40, 0x07, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x40,
-    0x3D, 0x07, 0xD0, 0x2F, 0xFF, 0xC0, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7C, 0xF8, 0x00,
-    0x0F, 0x8F, 0x80, 0x02, 0xF0, 0xFC, 0x00, 0x7E, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x02, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD3, 0xF8, 0x00, 0xFE, 0x7F, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xCF, 0x80,
-    0x00, 0x3E, 0x3E, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x3F, 0x80, 0x0F, 0xE1, 0xFC, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00,
-    0x2F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x43, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0x2C, 0x00, 0x00, 0xFD, 0xE0, 0x00, 0x0B, 0x3F, 0x40, 0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x1F, 0x3E, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x7E, 0x0F, 0xC0, 0x03, 0xF0,
-    0x3F, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0xFE, 0x00, 0x3F,
-    0x87, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x29, 0x1A, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0xFC,
-    0x7E, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xCF,
-    0x80, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFC, 0x0F,
-    0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x0F,
-    0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03,
-    0xE3, 0xE0, 0x00, 0x2F, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x43, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xAB, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xEA,
-    0x54, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xCB,
-    0xE5, 0xA0, 0x00, 0x00, 0x7D, 0x3F, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0x07, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xAA, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x2F, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x90, 0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x60,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xED, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xE9, 0x50, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF5, 0xA0, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x02, 0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xD1, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0xFD, 0x7F,
-    0x00, 0x02, 0xA1, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xD0,
-    0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFB, 0xC0, 0x1F, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xA4, 0x68, 0x01,
-    0xF8, 0xFC, 0x03, 0xF4, 0xFC, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x3E,
-    0x00, 0xBD, 0x00, 0x0F, 0x4B, 0xFF, 0xFC, 0x07, 0xD3, 0xFF, 0xFE, 0x02, 0xF0, 0x07, 0xE0, 0x01,
-    0xF8, 0x02, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xB2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3E, 0x00,
-    0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02,
-    0xFF, 0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F,
-    0xD3, 0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF,
-    0x41, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0x5B, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3E, 0x00,
-    0x03, 0xF0, 0x2F, 0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x01, 0xFE,
-    0x01, 0xBF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC,
-    0x07, 0xF8, 0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x3E, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x2C, 0x00, 0x00, 0x0F, 0xDE, 0x00, 0x00, 0x0B, 0x3F,
-    0x40, 0x00, 0x01, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0x5B, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3E,
-    0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x01,
-    0xFE, 0x01, 0xBF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1A, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xD0, 0x0F, 0xEF,
-    0xC0, 0x54, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xAF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xFD,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF5, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03,
-    0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x28, 0x00, 0x00, 0xF8, 0xBD, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF2, 0xF4, 0x02, 0xF4, 0x7E, 0x01,
-    0xF8, 0x1F, 0xC0, 0xFC, 0x03, 0xF0, 0xFC, 0x00, 0xFD, 0xFD, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0xD0,
-    0x02, 0xFF, 0xE0, 0x0F, 0x47, 0xC0, 0x3C, 0x0F, 0x01, 0xE0, 0xFC, 0x0B, 0xEF, 0xC0, 0x3F, 0xFC,
-    0x01, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x0F, 0xFF, 0x80, 0x0B, 0xC0, 0xF0, 0x03, 0xD1, 0xBC, 0x01, 0xF1, 0xFD, 0x00, 0xB8, 0xF0, 0x00,
-    0x3E, 0x3C, 0x00, 0x1F, 0x4F, 0x80, 0x0B, 0xC2, 0xF8, 0x03, 0xF0, 0x2F, 0x01, 0xFC, 0x07, 0xC0,
-    0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x05, 0x5B, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE0, 0x2F, 0xFF, 0x81, 0xF0, 0x7D,
-    0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3, 0xC0, 0x7F, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x2F, 0xDF,
-    0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x02, 0xFF, 0xF8, 0x07,
-    0xC1, 0xF4, 0x0F, 0x00, 0xF4, 0x2D, 0x00, 0xF0, 0x3C, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xE0, 0x0B, 0xF7, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xE0, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x02, 0xFF, 0xF8, 0x07, 0xC1, 0xF4, 0x0F,
-    0x00, 0xF4, 0x2D, 0x00, 0xF0, 0x3C, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x0B, 0xF7,
-    0xD0, 0x00, 0x06, 0x09, 0x00, 0x1F, 0xCD, 0x00, 0x2D, 0xFC, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x02, 0xFF, 0xF8, 0x07, 0xC1, 0xF4, 0x0F, 0x00, 0xF4, 0x2D,
-    0x00, 0xF0, 0x3C, 0x07, 0xF0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x0B, 0xF7, 0xD0, 0x00, 0x2F,
-    0x0F, 0x80, 0x0F, 0xCB, 0xD0, 0x07, 0xF3, 0xF4, 0x02, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFB, 0x80, 0x0B, 0xFF, 0xE0, 0x07, 0xC1, 0xF4, 0x03, 0xC0, 0x3D, 0x02, 0xD0,
-    0x0F, 0x00, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0xBF, 0x7D, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x77, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEE, 0x02, 0xFF, 0xF8, 0x1F, 0x07, 0xD0, 0xF0, 0x0F, 0x4B, 0x40, 0x3C,
-    0x3C, 0x07, 0xF0, 0xFF, 0xFF, 0xC2, 0xFF, 0xFE, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFB, 0xDB, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7C, 0x1F, 0xF4, 0x6C, 0x0F, 0x00, 0xFF,
-    0xFF, 0xD2, 0xD0, 0x0F, 0xEA, 0xA4, 0x3C, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x7E, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xD0,
-    0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x90, 0x1F, 0xFF, 0x00, 0x7F,
-    0xE0, 0x01, 0xF0, 0x00, 0x17, 0x40, 0x07, 0xF0, 0x00, 0x68, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F,
-    0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07,
-    0xFB, 0xD0, 0x07, 0xE1, 0x78, 0x03, 0xFF, 0xFE, 0x01, 0xFA, 0xA9, 0x40, 0xBC, 0x00, 0x40, 0x2F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xFC, 0x00, 0x02, 0xFB, 0xC0, 0x01, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xBD, 0x00, 0x7E, 0x17, 0x80, 0x3F, 0xFF, 0xE0,
-    0x1F, 0xAA, 0x94, 0x0B, 0xC0, 0x04, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x0A, 0x42, 0x80, 0x01, 0xF8, 0xBC, 0x00, 0x2F, 0x4F, 0xC0, 0x03, 0xF6, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xAA, 0x94, 0x02, 0xF0,
-    0x01, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B,
-    0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x02, 0xE0,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF4, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x07, 0xF4, 0x00, 0xFB, 0xE0, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC7, 0xC0, 0xFC, 0xFC, 0x1F, 0x9F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F,
-    0x40, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0x3C, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0x83, 0xF4,
-    0x00, 0x3F, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD3, 0x40, 0x02, 0xFD, 0xD0,
-    0x00, 0xF3, 0xF0, 0x00, 0x28, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0x00,
-    0x0F, 0xFF, 0xE0, 0x07, 0xF4, 0xBC, 0x02, 0xF0, 0x1F, 0x00, 0xF4, 0x0F, 0x80, 0x7C, 0x03, 0xD0,
-    0x3F, 0x02, 0xF0, 0x0F, 0xC0, 0xFC, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07,
-    0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01,
-    0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0xFB, 0xE0, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07,
-    0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x02, 0xF9, 0x00, 0x00, 0x0B, 0x8E, 0x00, 0x1F, 0xDD, 0x00, 0x3C, 0xFC, 0x00, 0x28, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F,
-    0x00, 0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x1A,
-    0x0A, 0x40, 0x0F, 0xC7, 0xE0, 0x07, 0xF3, 0xF4, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xE0, 0xBC, 0x03, 0xD0, 0x1F, 0x01, 0xF0,
-    0x0F, 0x80, 0xBD, 0x6F, 0xD0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x1F, 0x7F, 0xF0, 0x00, 0x00, 0xF9, 0xFB, 0xC0, 0x00, 0x07, 0xCF, 0x7F, 0x00, 0x00, 0x2F, 0xFE,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xE2, 0xE0, 0x0F, 0x4B, 0x40,
-    0xBC, 0x3C, 0x03, 0xF0, 0xF0, 0x1F, 0x87, 0xC0, 0xFD, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0xB8, 0x03, 0xD2, 0xD0, 0x2F,
-    0x0F, 0x00, 0xFC, 0x3C, 0x07, 0xE1, 0xF0, 0x3F, 0x47, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0xFB, 0xE0, 0x0F, 0x42, 0xE0, 0x00,
-    0x00, 0x01, 0xF0, 0x0F, 0x8B, 0x80, 0x3D, 0x2D, 0x02, 0xF0, 0xF0, 0x0F, 0xC3, 0xC0, 0x7E, 0x1F,
-    0x03, 0xF4, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0xFC,
-    0xBD, 0x01, 0xFC, 0xFD, 0x02, 0xA4, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8,
-    0x2E, 0x00, 0xF4, 0x2D, 0x02, 0xF0, 0x3C, 0x03, 0xF0, 0x3C, 0x07, 0xE0, 0x7C, 0x0F, 0xD0, 0x7F,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x01, 0xF8, 0xBC, 0x00, 0x03, 0xF3, 0xD0,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0xD0,
-    0x0F, 0x8F, 0xC0, 0x3D, 0x0F, 0x01, 0xF0, 0x3C, 0x0B, 0xC2, 0xE0, 0x3E, 0x1F, 0x40, 0xF6, 0xF8,
-    0x07, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x03, 0xF2, 0xF8,
-    0x00, 0x06, 0xA2, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x80,
-    0x00, 0x7E, 0x2F, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
-    0x2F, 0x0F, 0xC0, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x16, 0xAB, 0x40, 0x1F, 0xFF, 0xE0, 0x0A, 0xA9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x80, 0x0B, 0xFF, 0xE0, 0x07, 0xC1, 0xF4, 0x03, 0xC0,
-    0x3D, 0x02, 0xD0, 0x0F, 0x00, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0xBF,
-    0x7D, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0xAB, 0xD0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7C, 0xF8,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x0F, 0xC0,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xF8,
-    0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x1E, 0x06, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x00,
-    0x2F, 0xFF, 0x80, 0x07, 0xC1, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x7F,
-    0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xCF, 0x80, 0x00, 0xF8,
-    0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F, 0xE7, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0xE0, 0x2F, 0xFF, 0x81, 0xF0, 0x7D, 0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3,
-    0xC0, 0x7F, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x2F, 0xDF, 0x80, 0x00, 0x7E, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x40, 0x1F,
-    0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xFD, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xE6, 0x40, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xE0, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0x90, 0x10, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x02, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0xF4, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x99, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x40, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x80, 0x0F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0xA4, 0x00, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFD, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xE6, 0x40, 0x1F, 0xFF, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x1E, 0x00, 0x00, 0x1F, 0xBE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xF9, 0x01,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x02, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x68, 0x06, 0x40,
-    0x03, 0xF7, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x99, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x01, 0xF1, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x07, 0xF4, 0x03, 0xF0, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x1F, 0x80, 0x07,
-    0xF0, 0x2F, 0x80, 0x6F, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF1, 0x40, 0x00, 0x00,
-    0x7C, 0xF4, 0x00, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x0B, 0xEB, 0xCF, 0x40, 0x1F,
-    0xFF, 0xE0, 0x00, 0x1F, 0x9B, 0xF4, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x07, 0x80, 0x7E, 0x00, 0x02,
-    0xE0, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xF0,
-    0x03, 0xF4, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x0F, 0x4B, 0xFF, 0xFC, 0x07, 0xD3, 0xFF,
-    0xFE, 0x02, 0xF0, 0x07, 0xE0, 0x01, 0xF8, 0x02, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0xAF, 0xE9, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x2F, 0xAF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xE6, 0xFD, 0x00, 0x0F, 0x40, 0xFC,
-    0x00, 0x1E, 0x01, 0xF8, 0x00, 0x2E, 0x07, 0xF4, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xAB, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xA5, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD,
-    0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xAA, 0x94, 0x02, 0xF0, 0x01,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x78,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x95, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x68, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0x41, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF,
-    0x80, 0x1F, 0xAA, 0x94, 0x02, 0xF0, 0x01, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00,
-    0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5A, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x03, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94,
-    0x2F, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x95, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x5A,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F, 0x00,
-    0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x14, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x95, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF5, 0xA0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x1F, 0xBE, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xEF, 0x40,
-    0x01, 0xF8, 0x5E, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0x50, 0x02, 0xF0, 0x01, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x01, 0xE9, 0x40, 0x0F, 0xD0, 0x2F, 0xFD, 0x00, 0xFC, 0x01, 0xBF, 0xD0, 0x1F, 0xD0, 0x02, 0xF4,
-    0x00, 0xFF, 0xEA, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xAF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6,
-    0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x07, 0xD2, 0xFC, 0x00, 0x3C, 0x07, 0xF0, 0x01, 0xD0, 0x2F, 0x80,
-    0x0B, 0x41, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x12, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x02, 0xFB, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x6F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0x80, 0x04, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x1E, 0x94, 0x00, 0xFD, 0x02, 0xFF, 0xD0, 0x0F, 0xC0, 0x1B, 0xFD, 0x01, 0xFD,
-    0x00, 0x2F, 0x40, 0x0F, 0xFE, 0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xDB,
-    0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xF4, 0xBF, 0x00, 0x03, 0xC0, 0x7F, 0x00, 0x07, 0x40, 0xBE,
-    0x00, 0x0B, 0x41, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x12, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0x80,
-    0x04, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x1E,
-    0x94, 0x0F, 0xD0, 0x2F, 0xFD, 0x0F, 0xC0, 0x1B, 0xFD, 0x1F, 0xD0, 0x02, 0xF4, 0x0F, 0xFE, 0xAF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xDB, 0xC0, 0x0B, 0xFF, 0xF8, 0x01, 0xF4, 0xBF, 0x00, 0x3C, 0x07, 0xF0,
-    0x07, 0x40, 0xBE, 0x00, 0xB4, 0x1F, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF,
-    0xF0, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xFB, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x06,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAA, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xA5, 0x00,
-    0xFD, 0x02, 0xFF, 0xD0, 0x3F, 0x00, 0x6F, 0xF4, 0x1F, 0xD0, 0x02, 0xF4, 0x03, 0xFF, 0xAB, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0xBC, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0x4B,
-    0xF0, 0x03, 0xC0, 0x7F, 0x00, 0x74, 0x0B, 0xE0, 0x0B, 0x41, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x12, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xBF, 0x80,
-    0x03, 0xFF, 0xF0, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0xFC,
-    0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x07, 0xF0,
-    0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x7F, 0x40, 0x00, 0x2D, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0xFF, 0xD0, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFB, 0xF4,
-    0x03, 0xFF, 0xFC, 0x0B, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40, 0xF8, 0x3F,
-    0x01, 0xF4, 0x7F, 0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC,
-    0x01, 0xF8, 0x00, 0xFC, 0x06, 0xF9, 0x56, 0xFD, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x7F, 0x40,
-    0x00, 0x3D, 0x00, 0x00, 0x7D, 0x50, 0x07, 0xFF, 0xE0, 0x0B, 0xFE, 0x40, 0x01, 0xF0, 0x00, 0x02,
-    0xFB, 0xF4, 0x03, 0xFF, 0xFC, 0x07, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40,
-    0xF8, 0x3F, 0x01, 0xF4, 0x3F, 0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00, 0x3D, 0x34, 0x02, 0xFD, 0xC0,
-    0x0E, 0x7F, 0x00, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xF2, 0xC0, 0x3F, 0xAC, 0x07, 0x6F, 0x40, 0x20, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00,
-    0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x54, 0x01, 0xFF, 0xFC,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x50, 0xBF, 0xFF, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D,
-    0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x1F, 0x40, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x40,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80,
-    0x02, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xE0, 0x3D, 0x03, 0xC0,
-    0x7C, 0x0B, 0x80, 0xF4, 0x1F, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xD0,
-    0x01, 0xF8, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00,
-    0x1F, 0x40, 0x0F, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x03,
-    0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x09, 0x0B, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x07, 0xD0, 0x07,
-    0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xF0, 0x01, 0xF0,
-    0x00, 0xB4, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0F,
-    0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x04, 0x0B,
-    0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0xC0, 0x03, 0xF1, 0xFC, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0xFC,
-    0xFD, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x3F, 0x6F, 0xF0, 0x00,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xE0, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x4A, 0x40, 0x03, 0xDF, 0x80, 0x02,
-    0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x07,
-    0xE7, 0xFC, 0x02, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0xE2, 0xC0, 0x1D, 0xB4, 0x02, 0xEE, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
-    0xFD, 0x00, 0x0F, 0xF4, 0x02, 0xDF, 0xC0, 0x3C, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1E, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x55, 0x3F, 0xFF, 0xF5, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xFC,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xE0, 0x55, 0x0F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00,
-    0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x05, 0x01, 0xF8, 0x2E, 0x02, 0xF0, 0x3D, 0x03, 0xF0, 0x7C, 0x07, 0xE0, 0xF8, 0x0B, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x81, 0x54, 0x3F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x01, 0xE1, 0xF0,
-    0x00, 0xB8, 0xF8, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x07, 0xE0, 0xFC, 0x02, 0xF0, 0x7F, 0x00, 0xFC, 0x1A, 0x80, 0x7E,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x15, 0x40, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x0B, 0x80, 0x00, 0xF4,
-    0x00, 0x1F, 0x1A, 0x03, 0xE3, 0xF0, 0x3D, 0x7E, 0x07, 0xCF, 0xE0, 0xF8, 0x00, 0x0F, 0x40, 0x01,
-    0xF0, 0x00, 0x2E, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x05, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x10, 0x00, 0x01, 0x7F, 0xFE,
-    0x81, 0xBF, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01,
-    0xFF, 0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F,
-    0xE7, 0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F,
-    0x82, 0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4, 0x3F, 0x02,
-    0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7D, 0x00,
-    0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02, 0xFF, 0xC2, 0xF0, 0x03,
-    0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F, 0xD3, 0xFF, 0xC0, 0x2F,
-    0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF,
-    0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4,
-    0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x01, 0x54, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x1F, 0x40, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xF8,
-    0x00, 0x7F, 0x00, 0x7D, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x0F, 0xF8, 0x0F, 0xC0, 0x07, 0xFF, 0x07,
-    0xD0, 0x02, 0xFF, 0xC2, 0xF0, 0x00, 0xFE, 0xF0, 0xFC, 0x00, 0x7F, 0x7D, 0x7D, 0x00, 0x3F, 0x9F,
-    0xAF, 0x00, 0x0F, 0xD3, 0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xD0, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0xFE,
-    0x0B, 0xFC, 0x00, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0F, 0xAF, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0x4B,
-    0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x03, 0xF0, 0x2F, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7F,
-    0x00, 0x7D, 0x00, 0xBF, 0x40, 0xBC, 0x00, 0xFF, 0x80, 0xFC, 0x01, 0xFF, 0xC1, 0xF4, 0x02, 0xFF,
-    0xC2, 0xF0, 0x03, 0xFB, 0xC3, 0xF0, 0x07, 0xF7, 0xD7, 0xD0, 0x0F, 0xE7, 0xEB, 0xC0, 0x0F, 0xD3,
-    0xFF, 0xC0, 0x2F, 0xC3, 0xFF, 0x40, 0x3F, 0xC3, 0xFF, 0x00, 0x3F, 0x82, 0xFF, 0x00, 0xBF, 0x41,
-    0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0,
-    0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00, 0xF4, 0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0,
-    0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xD6, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xE0,
-    0x07, 0xE0, 0xBC, 0x03, 0xD0, 0x1F, 0x01, 0xF0, 0x0F, 0x80, 0xBD, 0x6F, 0xD0, 0x1F, 0xFF, 0xE0,
-    0x03, 0xFF, 0xF0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0xAB, 0xC0,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xD6, 0xFD, 0x00, 0x3F, 0x40,
-    0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x6F, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFA, 0xBC, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x7F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xE0, 0xBC,
-    0x00, 0xF4, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF5, 0xBF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x1F, 0x80,
-    0x00, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xF5, 0xBF, 0x40, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x0F, 0x80, 0x0F,
-    0xC0, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0x01, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x07, 0xE0, 0xBC, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x2F, 0x5B, 0xF4,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD6, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x58,
-    0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0xA9, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xBE, 0x40, 0x07, 0xFF, 0xFF, 0xEF,
-    0x00, 0x7E, 0x0B, 0xF4, 0x6E, 0x03, 0xE0, 0x1F, 0xFF, 0xF8, 0x1F, 0x00, 0xFE, 0xAA, 0x50, 0xBD,
-    0x6F, 0xF0, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xF9, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0xF0, 0x0F, 0x00,
-    0xBC, 0x07, 0xC0, 0x3E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x00,
-    0xFC, 0x0F, 0x80, 0xBF, 0x07, 0xE0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xFF, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x05, 0x40, 0x01, 0xFB, 0xD0,
-    0x2F, 0xFD, 0x03, 0xF9, 0x40, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0xF0, 0x0F, 0x00, 0xBC,
-    0x07, 0xC0, 0x3E, 0x07, 0xE0, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0xFC,
-    0x0F, 0x80, 0xBF, 0x07, 0xE0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xFF, 0x0B, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xD0, 0x2F, 0xFD, 0x03, 0xF9, 0x40, 0x7D, 0x00,
-    0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03,
-    0xD0, 0x3D, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x7E, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0xBF, 0x07, 0xE0,
-    0x03, 0xF8, 0x2F, 0xC0, 0x0F, 0xD0, 0xFF, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x28, 0x01, 0xF5, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFB, 0xD0, 0x02, 0xFF, 0xD0, 0x03, 0xF9, 0x40, 0x07, 0xD0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x7F, 0x40, 0x40, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x07, 0x80, 0x1F, 0xD0, 0x7F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xC0, 0x00, 0x2D,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xAB, 0x00, 0xB4, 0x00, 0x01, 0xFA,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB, 0xFC, 0x3F, 0xFF, 0xD0, 0x6F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x7F, 0x40, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0x80, 0x1F, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x07, 0xEA, 0xC0,
-    0x02, 0xD0, 0x00, 0x00, 0x7E, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xEF, 0xF0,
-    0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0xFE, 0x00, 0xE0, 0x07, 0xF4, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x01, 0xBF,
-    0xFE, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xAB, 0x00, 0xB4, 0x00, 0x01, 0xFA, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB, 0xFC, 0x3F, 0xFF, 0xD0, 0xBF, 0xF8, 0x00, 0xE0, 0x00,
-    0x0B, 0xE0, 0x00, 0x3B, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1A, 0x00, 0x00, 0x2F,
-    0x7E, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x1F, 0xD0, 0x10, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x01, 0xE0, 0x07, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2D, 0x02, 0x80, 0x01, 0xF6, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xAB, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xEF, 0xF0,
-    0x03, 0xFF, 0xFD, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x17, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x0B, 0xFF, 0xD1, 0xFF, 0xFD, 0x02, 0xF0, 0x00,
-    0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0xE8, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x01, 0xD0,
-    0x00, 0x3F, 0x00, 0x06, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x24, 0x02, 0x40, 0x03, 0xE2, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0xBC,
-    0x01, 0xF0, 0x15, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xFD, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x07,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0,
-    0x02, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x0B, 0xC0, 0x0B, 0xFF, 0xF8, 0x3F, 0xFF, 0xD0, 0x07, 0xC0,
-    0x00, 0x3F, 0xA0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x7F,
-    0x74, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0xA1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01,
-    0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x38, 0x00, 0xFF, 0xE0, 0x0B, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x0F, 0x8B, 0x80, 0x3D, 0x2D, 0x02, 0xF0, 0xF0, 0x0F, 0xC3, 0xC0, 0x7E, 0x1F,
-    0x03, 0xF4, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFD, 0x02,
-    0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03, 0xF0, 0x0B,
-    0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x1F,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0xFF, 0xFE, 0x02, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x2E, 0x00, 0xF4, 0x2D, 0x02, 0xF0, 0x3C, 0x03,
-    0xF0, 0x3C, 0x07, 0xE0, 0x7C, 0x0F, 0xD0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x74, 0x1E, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE,
-    0x01, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4,
-    0x07, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1A, 0x00, 0x1F, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0xB8,
-    0x03, 0xD0, 0x2D, 0x02, 0xF0, 0x0F, 0x00, 0xFC, 0x03, 0xC0, 0x7E, 0x01, 0xF0, 0x3F, 0x40, 0x7F,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1E,
-    0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC, 0x00,
-    0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0, 0x03,
-    0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3B, 0x80, 0x01, 0xFD, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3E, 0x2E, 0x00, 0xF4, 0xB4, 0x0B,
-    0xC3, 0xC0, 0x3F, 0x0F, 0x01, 0xF8, 0x7C, 0x0F, 0xD1, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xE0, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x3F,
-    0x40, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x1F, 0xC0, 0x3F, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x02, 0xE0, 0x0F, 0x40, 0x0B,
-    0x40, 0xBC, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0xF0, 0x1F, 0x80, 0x07, 0xC0, 0xFD, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0xFD, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x03, 0xF4, 0x03, 0xF4, 0x07, 0xF0,
-    0x03, 0xF0, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0xB8, 0x03, 0xD3, 0xD0, 0x2F, 0x0F, 0x00,
-    0xFC, 0x3C, 0x07, 0xE1, 0xF0, 0x7F, 0x47, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x01,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xEF, 0x40,
-    0x00, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x3F,
-    0x40, 0x50, 0x0F, 0xE0, 0x3F, 0x01, 0xF8, 0x1F, 0xC0, 0x7F, 0x07, 0xF8, 0x3F, 0x40, 0x7F, 0x0F,
-    0xFC, 0x7F, 0x00, 0x7F, 0x3F, 0xFC, 0xFD, 0x00, 0x7F, 0xBF, 0xFE, 0xFC, 0x00, 0xBF, 0xFD, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFC, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0xBF, 0xC0,
-    0x00, 0xBF, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xD0, 0xF4, 0x3C, 0x3F, 0x03, 0xD3, 0xF1, 0xF4, 0x0F,
-    0xBF, 0xDF, 0xC0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xE3,
-    0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F, 0x81, 0xFC, 0x0F,
-    0xC0, 0x3F, 0x0F, 0xC0, 0x0F, 0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFB,
-    0xC0, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00,
-    0x3F, 0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0F, 0xCB, 0xE0, 0x06,
-    0xA2, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x2F, 0x40, 0x2F, 0x47, 0xE0, 0x1F, 0x81, 0xFC, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x0F,
-    0xDF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0xA9,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF5, 0x40, 0x0F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF,
-    0xFE, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF5, 0x40, 0x0F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xEA, 0x90, 0x03, 0xFF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xFF, 0x54, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF,
-    0xC0, 0x07, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x03, 0xC3, 0xD2,
-    0xE0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x07, 0xF4, 0x00, 0xFB, 0xE0, 0x3E, 0x07, 0xC0, 0x09, 0x18,
-    0x3F, 0x6C, 0x76, 0xF8, 0x20, 0x90, 0x00, 0x15, 0x41, 0xFF, 0xFD, 0x3F, 0xFE, 0x90, 0x00, 0x00,
-    0x54, 0x1F, 0xFF, 0xFE, 0x7F, 0xAA, 0xA9, 0x2D, 0x07, 0x8B, 0xFF, 0xD1, 0xFF, 0xD0, 0x05, 0x40,
-    0x0A, 0x47, 0xD3, 0xF5, 0xFC, 0x00, 0x00, 0x07, 0xC7, 0xC3, 0xF3, 0xF0, 0xFC, 0xFC, 0x78, 0x1C,
-    0x38, 0xA0, 0x00, 0x0F, 0x0E, 0xE3, 0xF4, 0xB8, 0x02, 0xE0, 0x07, 0xC0, 0xFC, 0x01, 0xF4, 0x3F,
-    0x40, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0xFB, 0xE0, 0x07, 0xF4, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x02, 0xF4, 0x07, 0xE0, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0xFE, 0x01, 0xFC, 0x03, 0xF4, 0x07, 0xF0, 0x0A, 0x90, 0x02, 0xA8, 0x1F, 0xD0,
-    0xBF, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x6A, 0x40, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x07,
-    0xF0, 0x03, 0xF8, 0x0F, 0x1B, 0xCF, 0xE0, 0xB0, 0x04, 0x00, 0x3C, 0x02, 0xF8, 0x1F, 0xC0, 0xF0,
-    0x05, 0x00, 0x69, 0x50, 0xBF, 0xFD, 0x55, 0xBC, 0x00, 0x7C, 0x00, 0xB8, 0x0A, 0x02, 0xC1, 0xF1,
-    0xF4, 0x30, 0x00, 0x01, 0x0F, 0x2C, 0x3D, 0x08, 0x00, 0x00, 0x03, 0x46, 0xE1, 0xFF, 0x0B, 0xC0,
-    0x00, 0x78, 0x1F, 0xF0, 0xFC, 0x38, 0x00, 0x00, 0x04, 0x0C, 0xBE, 0x24, 0x00, 0x0A, 0xBF, 0xC3,
-    0xFF, 0xFC, 0x15, 0x55, 0x00, 0x1A, 0x0F, 0xC7, 0xF2, 0xF8, 0x0F, 0x8F, 0x87, 0xD7, 0xD2, 0xF6,
-    0xF0, 0x00, 0x00, 0x0F, 0x0E, 0xE3, 0xF4, 0xB8, 0x01, 0xA9, 0x02, 0xFC, 0x03, 0xF4, 0x07, 0xF0,
-    0x0F, 0xD0, 0x3F, 0xC0, 0x01, 0x00, 0xB0, 0x0F, 0x41, 0x7C, 0x3F, 0x82, 0x90, 0x00, 0x01, 0xF1,
-    0xF4, 0xF0, 0x7F, 0x8B, 0xE0, 0x00, 0x05, 0x07, 0xC2, 0xF0, 0xF8, 0x7D, 0x2F, 0x00, 0x2F, 0xFE,
-    0x3F, 0xFD, 0x3D, 0x7C, 0x7C, 0x7C, 0x29, 0x00, 0xA0, 0x7E, 0x2F, 0x40, 0xBF, 0xF0, 0x00, 0xFE,
-    0x00, 0x01, 0xE0, 0x00, 0x01, 0x90, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xD0, 0x07, 0xE7, 0xE0, 0x3E,
-    0x02, 0xF0, 0x1F, 0x0D, 0x3F, 0x9D, 0xB7, 0xFC, 0xB0, 0xF4, 0x1A, 0xFF, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x1A, 0xBF, 0x8F, 0xFF, 0xE5, 0x55, 0x40, 0x0F, 0x8B, 0x0B, 0xF3, 0xC3, 0xDF, 0xD0, 0xE2,
-    0xE0, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x50, 0xB8, 0x2C, 0x3D, 0x38, 0x00, 0x00, 0x00, 0x03, 0xD2,
-    0xF0, 0x3E, 0x1F, 0x42, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x55, 0x54, 0x1F, 0xFE, 0x2F, 0xFD, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x7F, 0xF8, 0xBF, 0xF4, 0x01, 0x54, 0x0F, 0xFC, 0x2D, 0xEC, 0x3A, 0xDC, 0x10,
-    0x00, 0x08, 0x90, 0xB4, 0x0F, 0x03, 0x68, 0x09, 0x18, 0x3F, 0x6C, 0x76, 0xF8, 0x20, 0x90, 0x00,
-    0x34, 0x7C, 0xBC, 0xA0, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x1E, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x0B,
-    0xDB, 0xD0, 0x3F, 0xFD, 0x3F, 0xFC, 0xBC, 0xBC, 0xF8, 0xB8, 0x01, 0xAB, 0xF8, 0x1F, 0xFF, 0xF0,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x4F,
-    0x43, 0xC3, 0xC2, 0xF1, 0xF0, 0xF4, 0xF8, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xBF, 0xE3, 0xFF, 0x85,
-    0xBD, 0x02, 0xF0, 0x05, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x02, 0xFD, 0xB0, 0x01,
-    0xFF, 0x3C, 0x00, 0xBB, 0xFE, 0x00, 0x3F, 0xBF, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x38, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x05, 0x00, 0x0B, 0xFF, 0x02, 0xFC, 0x07, 0xFF, 0xFD, 0x7F, 0x81, 0xFF, 0x0F, 0xFF, 0xF0,
-    0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x14, 0x0B, 0xFD, 0x3D, 0x1F, 0x5F, 0xFC, 0x0B, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xE0,
-    0x3F, 0xF5, 0xF0, 0xBC, 0x7F, 0xD0, 0x14, 0x1A, 0x40, 0x14, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x20, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xD2, 0xE4,
-    0x00, 0x7F, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x55, 0x50, 0x00, 0x00, 0x55, 0x40, 0x00, 0x3F, 0xFF,
-    0xF8, 0x03, 0xD0, 0x01, 0xBE, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x01, 0xF5, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x7E, 0x55, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0xE1, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0xFD, 0x7F, 0x00, 0x02, 0xA1, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE,
-    0x95, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x68, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x00,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x81, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x3F, 0x43, 0xF0,
-    0x01, 0xF4, 0x07, 0xC0, 0x0B, 0xC0, 0x2F, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0xF8, 0x7F, 0xC0, 0x07,
-    0xD1, 0xFD, 0x00, 0x16, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x7E, 0x00, 0xFC, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x50,
-    0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFE,
-    0x01, 0xFF, 0x03, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFC, 0x00, 0x1F, 0xD0, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF9, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x01,
-    0xE0, 0x07, 0xF4, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0xF4, 0x07, 0xC7,
-    0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x10, 0x2F, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0xB8,
-    0x00, 0x00, 0xB8, 0x0F, 0xFF, 0x40, 0x0F, 0x40, 0xFF, 0xFD, 0x01, 0xF0, 0x1F, 0x03, 0xE0, 0x2E,
-    0x02, 0xE0, 0x3E, 0x03, 0xD0, 0x3E, 0x6F, 0xC1, 0xFC, 0x03, 0xFF, 0xF8, 0x3F, 0x80, 0xBF, 0xFD,
-    0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x05, 0x00, 0x00, 0xB8,
-    0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x78, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03,
-    0xFF, 0xFF, 0xE9, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x02, 0xF5, 0xBD, 0x2E, 0x00, 0xB4, 0x0F,
-    0x4F, 0x40, 0x3C, 0x07, 0xC3, 0xC0, 0x1F, 0x5B, 0xF1, 0xF0, 0x0B, 0xFF, 0xF4, 0xB8, 0x03, 0xFF,
-    0xE0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xFD, 0x0F, 0x80, 0x3F, 0x00, 0xF4,
-    0x07, 0xF0, 0x0F, 0x40, 0xBE, 0x02, 0xF0, 0x0F, 0xD0, 0x3F, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x2F, 0xC0, 0x03, 0xF1, 0xFC, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0xFC, 0xFD, 0x00,
-    0x03, 0xEF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x3F, 0x6F, 0xF0, 0x00, 0xFC, 0x3F,
-    0xF0, 0x0B, 0xE0, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x54, 0x03, 0xE0, 0x0F, 0xE0, 0x1F, 0x40, 0xBF,
-    0x40, 0xBC, 0x07, 0xFC, 0x03, 0xF0, 0x7F, 0xF0, 0x0F, 0x83, 0xFF, 0x80, 0xBC, 0x3F, 0xFD, 0x03,
-    0xF3, 0xF7, 0xF0, 0x0F, 0xAF, 0x6F, 0xC0, 0x7F, 0xF4, 0xFE, 0x02, 0xFF, 0x87, 0xF4, 0x0F, 0xFC,
-    0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x02, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x40, 0x00, 0xFA,
-    0xBD, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0xF8, 0x00, 0xFC, 0x2F,
-    0x00, 0x0F, 0xC3, 0xD0, 0x00, 0xBE, 0xBC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x02, 0xF0,
-    0x03, 0xE0, 0x3F, 0x00, 0x7D, 0x03, 0xE0, 0x0B, 0xC0, 0x7D, 0x00, 0xF8, 0x0B, 0xC0, 0x0F, 0x40,
-    0xFC, 0x01, 0xF0, 0x0F, 0x80, 0x2F, 0x01, 0xF4, 0x03, 0xE0, 0x2F, 0x00, 0x7D, 0x03, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFC, 0x02, 0xAF, 0xEA, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F,
-    0xF4, 0x00, 0x07, 0xCF, 0x80, 0x00, 0xF8, 0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00,
-    0xFC, 0x0F, 0xC0, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x0F,
-    0xE7, 0xF0, 0x00, 0xFE, 0x00, 0x55, 0x54, 0x02, 0xFF, 0xFC, 0x03, 0xF5, 0x50, 0x03, 0xE0, 0x00,
-    0x07, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x0F, 0x83, 0xF0, 0x0F, 0x01, 0xE0, 0x1F,
-    0x03, 0xD0, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFF,
-    0xF0, 0x03, 0xC0, 0x3C, 0x03, 0x80, 0x3C, 0x07, 0x40, 0xB8, 0x0B, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
-    0x0E, 0x56, 0xE0, 0x1D, 0x00, 0xF0, 0x2C, 0x02, 0xF0, 0x3E, 0xAF, 0xF0, 0x7F, 0xFF, 0xD0, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0,
-    0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFD, 0x00, 0x2F, 0x5B,
-    0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x7C, 0x0F, 0x80, 0x0B, 0xC0, 0xF4, 0x00, 0xF8, 0x1F, 0x40, 0x0F,
-    0x42, 0xF0, 0x02, 0xF0, 0x3F, 0x00, 0xBD, 0x07, 0xE0, 0x7F, 0xEA, 0xFF, 0x4B, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFE, 0x0B, 0xC0, 0x0B, 0xC0, 0x68, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0x54, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xE5, 0x50, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x03, 0xFA, 0xAA, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0xFF, 0xD1, 0xFC, 0x00, 0x07, 0xF0, 0xFF, 0xC3, 0xF4, 0x00, 0x03, 0xF4, 0xFF,
-    0x8F, 0xD0, 0x00, 0x02, 0xFD, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0xFF, 0xBE, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xCF, 0xE7, 0xFE, 0x00, 0x07, 0xFF, 0x0F, 0xD3, 0xFF, 0x40, 0x2F, 0xFC,
-    0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0xBF, 0x90, 0x07, 0xFF, 0xC0, 0x04, 0x0F, 0x40, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x80, 0x7F, 0x03,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x54, 0x03,
-    0xE0, 0x0F, 0xE0, 0x1F, 0x40, 0xBF, 0x40, 0xBC, 0x07, 0xFC, 0x03, 0xF0, 0x7F, 0xF0, 0x0F, 0x83,
-    0xFF, 0x80, 0xBC, 0x3F, 0xFD, 0x03, 0xF3, 0xF7, 0xF0, 0x0F, 0xAF, 0x6F, 0xC0, 0x7F, 0xF4, 0xFE,
-    0x02, 0xFF, 0x87, 0xF4, 0x0F, 0xFC, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x02, 0xFD, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x40, 0x10, 0x00, 0x0F, 0xAB, 0xE0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x50, 0x0F, 0x80, 0x3F, 0x80, 0x7D, 0x02, 0xFD, 0x02, 0xF0,
-    0x1F, 0xF0, 0x0F, 0xC1, 0xFF, 0xC0, 0x3E, 0x0F, 0xFE, 0x02, 0xF0, 0xFF, 0xF4, 0x0F, 0xCF, 0xDF,
-    0xC0, 0x3E, 0xBD, 0xBF, 0x01, 0xFF, 0xD3, 0xF8, 0x0B, 0xFE, 0x1F, 0xD0, 0x3F, 0xF0, 0xFF, 0x01,
-    0xFF, 0x03, 0xFC, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0x0B, 0xF0, 0x00, 0xFC, 0x7F, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0xFB, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x02, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x2F, 0x0B, 0xD0,
-    0x00, 0xFC, 0x3F, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0xFC, 0x2F, 0x00, 0x07,
-    0xD0, 0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x02, 0xFC, 0x2F, 0x40, 0x2F, 0xD0, 0xFC, 0x00, 0xFD, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x0F,
-    0xF0, 0x1F, 0xE0, 0x07, 0xFC, 0x0F, 0xF4, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0xEB, 0xFF, 0x00,
-    0x7E, 0xFF, 0xEF, 0xC0, 0x2F, 0x3F, 0xF7, 0xE0, 0x0F, 0xCF, 0xF6, 0xF4, 0x03, 0xE3, 0xFC, 0xFC,
-    0x02, 0xF4, 0xFC, 0x3F, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xF8, 0x00, 0xFC, 0x02, 0xF4,
-    0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x07, 0xF0, 0x0F, 0xFA,
-    0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0x80,
-    0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x6F, 0xD0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC,
-    0x07, 0xF8, 0x06, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x0F, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xF4, 0x07,
-    0xD0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x07, 0xD0, 0x1F, 0x40, 0xBC,
-    0x02, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xF8, 0x02, 0xA0, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0x80, 0xF8, 0x01, 0xF4, 0x0B, 0x80, 0x2F, 0x02, 0xF8,
-    0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x94, 0x00, 0x1F, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00,
-    0xBF, 0x90, 0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x20, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x7C, 0x01, 0xF8, 0x0F, 0x80, 0x0F, 0xC1, 0xF0, 0x00, 0xFC, 0x3D, 0x00, 0x0B, 0xDB, 0xC0, 0x00,
-    0x7F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x41, 0xFA, 0xF9, 0xB4, 0xF0, 0xFC, 0x0E, 0x74, 0x3F, 0x0F, 0x5F,
-    0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0F,
-    0xC0, 0x1F, 0x80, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x0F, 0xE2, 0xFD, 0x00, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x10, 0x01, 0x40, 0x0F, 0x80, 0x7C, 0x00, 0xF4, 0x0B,
-    0x80, 0x1F, 0x00, 0xF4, 0x02, 0xF0, 0x0F, 0x00, 0x3E, 0x02, 0xF0, 0x03, 0xD0, 0x3E, 0x00, 0x7C,
-    0x03, 0xD0, 0x0F, 0xC0, 0x7C, 0x00, 0xF8, 0x0F, 0xC0, 0x1F, 0x40, 0xF8, 0x02, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x1E, 0x01, 0xE0, 0xB4, 0x0B, 0x43, 0xC0, 0x3C, 0x1D, 0x01, 0xF0,
-    0xB0, 0x0F, 0x83, 0xC1, 0xFD, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x19, 0x5F, 0x00, 0x00, 0xB8,
-    0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x14, 0x00, 0x04, 0x00, 0xFC, 0x3D, 0x3E, 0x00, 0xF8,
-    0x7C, 0x3D, 0x01, 0xF0, 0xBC, 0x7C, 0x02, 0xF0, 0xF8, 0xBC, 0x03, 0xE0, 0xF4, 0xF8, 0x07, 0xD1,
-    0xF0, 0xF4, 0x0B, 0xC2, 0xF0, 0xF0, 0x0F, 0xC3, 0xE1, 0xF0, 0x0F, 0x83, 0xD2, 0xE0, 0x1F, 0x07,
-    0xC3, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xAA, 0x40, 0x00, 0xFC,
-    0x29, 0x2F, 0x00, 0xF8, 0x7D, 0x3E, 0x01, 0xF4, 0xBC, 0x3D, 0x02, 0xF0, 0xF8, 0x7C, 0x03, 0xE0,
-    0xF4, 0xB8, 0x03, 0xD1, 0xF0, 0xF4, 0x07, 0xC2, 0xF0, 0xF0, 0x0B, 0xC3, 0xE1, 0xF0, 0x0F, 0x43,
-    0xD2, 0xE0, 0x0F, 0x07, 0xC3, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0A, 0x40, 0x3F, 0xFC,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFC, 0x03, 0xD0, 0x7C, 0x03, 0xC0, 0xBC, 0x07, 0xD6, 0xF8, 0x0B, 0xFF, 0xF0, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0B,
-    0x00, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x01, 0xE0, 0x00, 0x07, 0xD0, 0x0B, 0x40, 0x00,
-    0x2F, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0xE0, 0x03, 0xE0, 0x0B, 0xFF, 0xF0, 0x1F, 0x40,
-    0x3D, 0x07, 0xC0, 0xFC, 0x00, 0xF0, 0x2F, 0x03, 0xF0, 0x07, 0xD6, 0xF8, 0x1F, 0xC0, 0x2F, 0xFF,
-    0xC0, 0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0xBF, 0xFF,
-    0x03, 0xD0, 0x7C, 0x0F, 0x02, 0xF0, 0x7D, 0x6F, 0x82, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xF9, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0x81, 0xFD, 0x00, 0xF4, 0x01, 0xF8,
-    0x05, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0xFF, 0x01, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xD0,
-    0x7F, 0xE0, 0x03, 0xD2, 0xFF, 0xF8, 0x03, 0xCB, 0xE0, 0x7C, 0x07, 0x8F, 0x80, 0x3C, 0x0B, 0xFF,
-    0x00, 0x3C, 0x0F, 0xFD, 0x00, 0x78, 0x0F, 0xFC, 0x00, 0xF8, 0x1F, 0xBC, 0x02, 0xF0, 0x2C, 0x7E,
-    0x5B, 0xF0, 0x3C, 0x7F, 0xFF, 0xC0, 0x38, 0x3F, 0xFF, 0x40, 0x74, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xF0, 0x2E, 0x00, 0x0F, 0x40,
-    0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x01, 0xF4, 0x1F, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0x80, 0x07, 0xD0, 0xFD, 0x00, 0x3F, 0x03, 0xF0, 0x02, 0xFC, 0x2F, 0xC0, 0x1F,
-    0xE0, 0xFF, 0x00, 0xFF, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0xE0, 0x2F, 0xFF, 0x81, 0xF0, 0x7D, 0x0F, 0x00, 0xF4, 0xB4, 0x03, 0xC3, 0xC0, 0x7F, 0x0F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xE0, 0x2F, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
-    0x6F, 0x40, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xD5, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFD, 0x1F, 0xC0, 0x2F, 0x40, 0xFC, 0x03, 0xF0, 0x1F,
-    0x80, 0x3F, 0x47, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0x90, 0x00, 0x02,
-    0xFF, 0x80, 0x0F, 0xAB, 0x80, 0x78, 0x1E, 0x02, 0xFB, 0xF0, 0x0F, 0xFF, 0x80, 0x78, 0x0F, 0x42,
-    0xE6, 0xBC, 0x0F, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFD, 0x00,
-    0x7C, 0xBC, 0x00, 0xF8, 0xFC, 0x00, 0xF4, 0xF8, 0x03, 0xF1, 0xF4, 0x0F, 0xC2, 0xF0, 0xBF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFC, 0xBE, 0xAA, 0xF4, 0xB8, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F, 0x00, 0x10, 0x2F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x02, 0xF4, 0x3E, 0x03, 0xD1, 0xF8, 0x00, 0xFC,
-    0x3F, 0x0B, 0xC7, 0xF0, 0x00, 0xBF, 0x3F, 0x0F, 0x9F, 0xC0, 0x00, 0x3F, 0x7F, 0x2F, 0x7F, 0x00,
-    0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xEF, 0xFB, 0xFC, 0x00, 0x07, 0xFF, 0x1F, 0xE3, 0xFF, 0x00, 0x2F, 0xFC, 0x2F, 0xC1, 0xFF, 0xC0,
-    0x01, 0xFD, 0x00, 0x96, 0xC0, 0x00, 0xB0, 0x01, 0xB4, 0x03, 0xFC, 0x00, 0x0B, 0x00, 0x97, 0xC0,
-    0xBF, 0xE0, 0x2F, 0xE0, 0x00, 0x02, 0xE0, 0x1F, 0x40, 0xF4, 0x1F, 0xC0, 0x3C, 0x1F, 0xF0, 0x1F,
-    0x1F, 0xF8, 0x0B, 0x8F, 0xBD, 0x03, 0xEF, 0xCF, 0x41, 0xFF, 0xC7, 0xC0, 0xBF, 0xC3, 0xF0, 0x3F,
-    0xC0, 0xF8, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0xFA, 0xBE, 0x00,
-    0xBF, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x80, 0xA0, 0x07, 0x43, 0xE0, 0x0B, 0x0B,
-    0xD0, 0x0F, 0x2F, 0xC0, 0x1E, 0x7B, 0xC0, 0x2E, 0xEB, 0x80, 0x3F, 0xCF, 0x40, 0x3F, 0x1F, 0x00,
-    0x7D, 0x3F, 0x00, 0x00, 0x7C, 0xBC, 0x00, 0xF6, 0xF0, 0x01, 0xFB, 0xC0, 0x02, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0x7F, 0x80, 0x3D, 0x2F, 0xE0, 0x00, 0xAA,
-    0x90, 0x1F, 0xFC, 0x02, 0xD3, 0xC0, 0x3C, 0x78, 0x03, 0xCB, 0x40, 0xB4, 0xF0, 0x0F, 0x0F, 0x01,
-    0xE2, 0xE0, 0x7D, 0x3D, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x3F, 0x42,
-    0xF4, 0x1F, 0xD1, 0xFC, 0x0B, 0xF8, 0xFF, 0x03, 0xFE, 0xBF, 0xC0, 0xFB, 0xFE, 0xE0, 0x79, 0xFD,
-    0xF4, 0x3E, 0x7F, 0x7C, 0x0F, 0x5F, 0x3F, 0x07, 0xC2, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x2F, 0x00, 0xF4, 0x03, 0xE0, 0x1F, 0x00, 0x7D, 0x02, 0xF0,
-    0x0B, 0xEA, 0xBE, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x02, 0xF4, 0x0F, 0xC0, 0x3F, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00,
-    0xF8, 0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xC0, 0x3D, 0x02, 0xF0, 0x1F, 0x00, 0xF8, 0x0B, 0xC0, 0x3D, 0x03, 0xE0, 0x2F,
-    0x01, 0xF4, 0x0F, 0xC0, 0xBC, 0x03, 0xE0, 0x3F, 0x01, 0xF4, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x01, 0xFF, 0xAF, 0x00, 0x0B, 0xF0, 0x2C,
-    0x00, 0x3F, 0x40, 0xB0, 0x00, 0xFC, 0x03, 0xC0, 0x07, 0xF0, 0x1E, 0x00, 0x2F, 0xFB, 0xF4, 0x00,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0x15, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01,
-    0xFF, 0xD0, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x90, 0x1F, 0xFF,
-    0x00, 0x6F, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x10, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xF8, 0x00,
-    0x1F, 0x8B, 0xC0, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x06, 0xFF, 0xFE,
-    0x00, 0xBF, 0xBE, 0xBF, 0x07, 0xD1, 0xF0, 0x3C, 0x3D, 0x0B, 0x81, 0xF0, 0xF0, 0x3D, 0x0F, 0xC3,
-    0xE6, 0xF5, 0xFD, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x0F, 0xC2,
-    0xF0, 0x00, 0x7C, 0xBD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x3F, 0xBF, 0x00, 0x0F, 0xD3, 0xF4, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0xBC, 0x0F, 0x80, 0xF8, 0x0F, 0x40, 0xF4, 0x1F, 0x00, 0xF0, 0x2F, 0x01, 0xF0,
-    0x3D, 0x02, 0xE0, 0x3C, 0x03, 0xD0, 0x7F, 0xFF, 0xF4, 0xBF, 0xFF, 0xF0, 0x6A, 0xAB, 0xE0, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0x80, 0x04, 0x04, 0x2C, 0x2C, 0x34, 0x38, 0x30, 0x74, 0x71, 0xF0, 0x7F,
-    0xF0, 0x2A, 0xA0, 0x00, 0xD0, 0x01, 0xC0, 0x02, 0xF0, 0xA4, 0xBC, 0x03, 0xF0, 0xF4, 0xF8, 0x03,
-    0xD1, 0xF0, 0xF4, 0x07, 0xC2, 0xF1, 0xF0, 0x0F, 0xC3, 0xE2, 0xF0, 0x0F, 0x83, 0xD2, 0xE0, 0x1F,
-    0x07, 0xC3, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xAA, 0x40, 0x02,
-    0xF0, 0xA4, 0xBC, 0x03, 0xF0, 0xF4, 0xF8, 0x03, 0xD1, 0xF0, 0xF4, 0x07, 0xC2, 0xF1, 0xF0, 0x0F,
-    0xC3, 0xE1, 0xF0, 0x0F, 0x83, 0xD2, 0xE0, 0x1F, 0x07, 0xC3, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x2A, 0xAA, 0xAB, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x05, 0x00, 0x16, 0xC0, 0x1F, 0xF0, 0x00, 0x2C, 0x00, 0x0E, 0x00, 0x03, 0xD4, 0x01, 0xFF,
-    0xC0, 0xB0, 0xB4, 0x3C, 0x3D, 0x0F, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x3D, 0x07, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x7C, 0x0E, 0x00, 0x0B, 0x40, 0xE5, 0x00,
-    0xF0, 0x1F, 0xFC, 0x0F, 0x02, 0xC2, 0xC1, 0xF0, 0x38, 0x3C, 0x3E, 0x07, 0xFF, 0x83, 0xD0, 0xBF,
-    0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x90,
-    0x1F, 0xFC, 0x2C, 0x1D, 0x3C, 0x2D, 0x3F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x0A, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x06, 0xE0, 0x2F, 0xFE, 0x00, 0x03, 0xC2, 0x01, 0xF8,
-    0x3F, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC1, 0xFE, 0x00, 0xF2,
-    0xFF, 0xD0, 0x39, 0xF0, 0x38, 0x1F, 0xF4, 0x0E, 0x0B, 0xF8, 0x07, 0x43, 0xAD, 0x03, 0xC0, 0xCB,
-    0xEB, 0xE0, 0x71, 0xFF, 0xF0, 0x28, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xBF,
-    0xF0, 0x2D, 0x0B, 0x42, 0xC0, 0x74, 0x2E, 0x07, 0x80, 0xFF, 0xFC, 0x0B, 0xFF, 0xC1, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFD, 0x7F, 0x0F, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFE, 0xF4, 0x07, 0xE1, 0x78, 0x0F, 0xFF, 0xF8, 0x1F, 0xAA, 0x94, 0x2F,
-    0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0x4F, 0x40, 0x07,
-    0xC7, 0xC0, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xFE, 0xF4, 0x01, 0xF8, 0x5E, 0x00, 0xFF, 0xFF, 0x80, 0x7E,
-    0xAA, 0x50, 0x2F, 0x00, 0x10, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7D, 0x50, 0x07, 0xFF, 0xE0, 0x0B, 0xFE, 0x40, 0x01, 0xF0, 0x00, 0x02, 0xFB,
-    0xF4, 0x03, 0xFF, 0xFC, 0x07, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x2F, 0x40, 0xF8,
-    0x3F, 0x01, 0xF4, 0x3F, 0x03, 0xF0, 0xBE, 0x2B, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-    0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x05,
-    0x00, 0x02, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x3E, 0xBD, 0x0F, 0x40, 0xE1, 0xF5, 0x40, 0x2F, 0xFD, 0x03, 0xC0,
-    0x00, 0x3D, 0x06, 0x83, 0xFF, 0xF8, 0x2F, 0xFF, 0x00, 0xAE, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x1F, 0xAB, 0x00, 0xB4, 0x00, 0x01, 0xFA, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x03, 0xFB,
-    0xFC, 0x3F, 0xFF, 0xD0, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0,
-    0x00, 0xB8, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x07, 0xC7, 0xC0, 0xFC,
-    0xFC, 0x1F, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1B, 0xE0, 0x00, 0xFF, 0x40,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x1C, 0x1C, 0x00,
-    0x0B, 0x0A, 0x00, 0x03, 0x83, 0xFD, 0x00, 0xD0, 0xE7, 0xC0, 0xB0, 0xB0, 0xB0, 0x38, 0x3E, 0xF8,
-    0x3C, 0x0F, 0xF8, 0x09, 0x00, 0x00, 0x00, 0x03, 0x40, 0x40, 0x0B, 0x02, 0x80, 0x0F, 0x03, 0x40,
-    0x0F, 0x5F, 0x40, 0x1F, 0xFF, 0xFC, 0x2C, 0x0F, 0x6E, 0x38, 0x0D, 0x1E, 0x34, 0x1E, 0xBC, 0x70,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x50, 0x07, 0xFF, 0xE0, 0x0B, 0xFE,
-    0x40, 0x01, 0xF0, 0x00, 0x02, 0xFB, 0xF4, 0x03, 0xFF, 0xFC, 0x07, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C,
-    0x0F, 0x80, 0x7C, 0x2F, 0x40, 0xF8, 0x3F, 0x01, 0xF4, 0x3F, 0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x2F, 0x00, 0x0F, 0x6F, 0x00, 0x07, 0xEF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0x7F, 0x80, 0x0F, 0x4B, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x01, 0xF4, 0x0F, 0x41, 0xFC, 0x03, 0xC1, 0xFF, 0x01, 0xF1, 0xFF, 0x80, 0xB8, 0xFB,
-    0xD0, 0x3E, 0xFC, 0xF4, 0x1F, 0xFC, 0x7C, 0x0B, 0xFC, 0x3F, 0x03, 0xFC, 0x0F, 0x80, 0xFC, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2D, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F,
-    0x80, 0x00, 0x7E, 0x2F, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x02, 0xD0, 0x38, 0x0F, 0x02, 0xD0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C, 0x0B, 0x41, 0xE0, 0x3C,
-    0x0B, 0x40, 0xF0, 0x3F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF8, 0x0B, 0x80, 0x00, 0xF8, 0x00,
-    0x1F, 0xFF, 0x42, 0xFF, 0xFC, 0x3F, 0x02, 0xD3, 0xE0, 0x3D, 0x3F, 0xFF, 0xC3, 0xFF, 0xF8, 0x3F,
-    0xFF, 0x00, 0x6A, 0x40, 0x00, 0x50, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0xBF,
-    0xFF, 0x40, 0x3E, 0x00, 0x00, 0xFF, 0xA0, 0x07, 0xFF, 0xF0, 0x2F, 0x42, 0xE0, 0xFC, 0x0B, 0x43,
-    0xFA, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x40, 0x2A, 0xA4, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x90,
-    0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFD, 0x0B, 0xF4, 0x00, 0x0F, 0xF3,
-    0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0xFC, 0xF8, 0xF4, 0x00, 0x3F, 0x1F, 0x4F, 0x80, 0x07, 0xD2, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x0F,
-    0xC0, 0x3F, 0x4B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xF0, 0x07, 0xD3, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x7E, 0xDF,
-    0x00, 0x3C, 0xF2, 0xC0, 0x2D, 0x38, 0xB0, 0x1F, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0xA0, 0x00, 0x07, 0xFF, 0x47, 0xE0, 0x00, 0x3F, 0xBF, 0x3F, 0x00, 0x01, 0xF8, 0xBF,
-    0xFC, 0x00, 0x0B, 0xD0, 0xFF, 0xC0, 0x00, 0x2F, 0xF9, 0xA8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xEB, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xBE, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0x95, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xF4, 0x00, 0x7F, 0xE3, 0xC0, 0x03, 0xE3, 0xFF, 0x00,
-    0x0F, 0x47, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xBE, 0x0B, 0xC0, 0x03, 0xD0,
-    0x1F, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0xBD, 0x6F, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE3, 0xF0, 0x00, 0x2F, 0xF0, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x0F, 0xC0, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0xBE, 0x07, 0xF4, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x0B,
-    0xF2, 0xFC, 0x00, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0xBD, 0x78, 0x01, 0xD0, 0x7C, 0x03, 0xC0, 0x7C, 0x0F, 0x00, 0x7C, 0x3E, 0x00,
-    0x7C, 0xBC, 0x00, 0x3E, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x28, 0x00, 0x7C, 0x6A, 0xF8, 0xFF, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xFF, 0xF8, 0x03, 0xFF, 0xFD,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xAA, 0x80, 0x3F, 0xFD, 0x03, 0x80, 0x02, 0xFF, 0xF4, 0x1F, 0x95, 0x00, 0xF0, 0x00, 0x1F, 0x00,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4,
-    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF4, 0x07, 0xF4, 0x3F, 0x02, 0xF4, 0x0B, 0xC0, 0xFC, 0x02, 0xE0, 0x3E, 0x01, 0xF4,
-    0x1F, 0x47, 0xFC, 0x0B, 0xC2, 0xFC, 0x01, 0x60, 0x54, 0x00, 0x07, 0xFF, 0x03, 0xD5, 0x40, 0xE0,
-    0x00, 0x75, 0x00, 0x2F, 0xF4, 0x0F, 0x4F, 0x03, 0x83, 0xC1, 0xC6, 0xD0, 0xB2, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xE0, 0xFD, 0x00, 0x07, 0xF0, 0xFF, 0xD3, 0xF8, 0x00, 0x03, 0xF4,
-    0xFF, 0xCB, 0xE0, 0x00, 0x02, 0xFD, 0xFF, 0xAF, 0xC0, 0x00, 0x00, 0xFE, 0xFF, 0xBF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xCF, 0xF3, 0xFE, 0x00, 0x07, 0xFF, 0x0F, 0xE2, 0xFF, 0x80, 0x2F,
-    0xFC, 0x1F, 0xD0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x3C, 0x7F, 0x4F, 0x40, 0x0F, 0x9F, 0xCF, 0x40,
-    0x01, 0xFB, 0xEB, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xEB, 0xDF, 0xC0, 0x1F, 0xD3, 0xE3, 0xFC, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0xBF, 0x90, 0x07, 0xFF, 0xC0, 0x04, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x80,
-    0x7F, 0x03, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0x40, 0x00, 0x01, 0xFD, 0x00, 0x96, 0xC0, 0x00, 0xB0, 0x01, 0xB4, 0x03, 0xFC, 0x00, 0x0B, 0x00,
-    0x97, 0xC0, 0xBF, 0xF0, 0x2F, 0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x80, 0x0E, 0xE0, 0x03, 0xE0, 0x00,
-    0x00, 0x1F, 0x47, 0xF0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xE3, 0xF4, 0x00, 0x2F, 0x3F, 0x40, 0x00,
-    0xFE, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0B, 0xDB, 0xFD, 0x00, 0x3F, 0x0F, 0xFD,
-    0x01, 0xFC, 0x1F, 0xFE, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0xF1, 0xF0, 0x07, 0x9F, 0x00, 0x2E, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x80, 0x0B, 0x7F, 0x80, 0x3C, 0x3F, 0xA4, 0x00, 0x00, 0xD0, 0x00, 0x02, 0x00, 0x00,
-    0x14, 0x00, 0x05, 0x40, 0x07, 0xC0, 0x02, 0xF8, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0x40, 0x2F,
-    0xC0, 0x01, 0xF7, 0x4B, 0xF0, 0x00, 0x3F, 0xB6, 0xFC, 0x00, 0x03, 0xEF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xF9, 0xEF, 0xF4, 0x00, 0x2F, 0x6D, 0x7F, 0xD0,
-    0x03, 0xF0, 0x03, 0xFF, 0x00, 0x7E, 0x00, 0x0F, 0xFC, 0x06, 0x90, 0x00, 0x6A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x0B, 0x80, 0x3C, 0x0B, 0x80, 0x1E, 0xCB, 0xC0, 0x0F, 0xBB, 0xC0, 0x03, 0xFF,
-    0xC0, 0x02, 0xDF, 0xF8, 0x00, 0xF3, 0x6F, 0x80, 0x78, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0x0B, 0xF0,
-    0x03, 0xFF, 0x7F, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0xFB, 0xF4, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x02, 0xF8, 0x2F, 0xFC,
-    0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFF, 0x00, 0xAF, 0xA4, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0x4A, 0x40, 0x3D, 0xF8, 0x02, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xC0, 0x7E, 0x7F, 0xC2, 0xF4, 0xFF, 0x80, 0x3F, 0xFF, 0x0B, 0xF0, 0xFF, 0xFC, 0x7F, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x2F, 0x3F, 0x40, 0x00, 0xFB, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x02, 0xF8, 0x2F, 0xFC, 0x00, 0x3F, 0xE3, 0xD1,
-    0x7C, 0xF4, 0x03, 0xAE, 0x00, 0xBF, 0x80, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xDF,
-    0xC0, 0xB8, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xD0, 0x07,
-    0xE0, 0x03, 0xF0, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x3F, 0x40,
-    0x2F, 0x80, 0x0F, 0xEA, 0xAF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x1F, 0xE9, 0x0F, 0xF0, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x3C,
-    0x03, 0xC0, 0x7C, 0x07, 0xC0, 0xB8, 0x0B, 0x80, 0xF4, 0x0F, 0x96, 0xF0, 0x1F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xE0, 0x3E, 0x07, 0xD0, 0x3D, 0x0B, 0xF8, 0x00, 0x00, 0x34, 0x00, 0x00, 0x20, 0x00, 0xBC,
-    0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xC0, 0x0B, 0xFF, 0xFD, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xE0, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xAA, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x00,
-    0x7F, 0x40, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x7F, 0xFC, 0x07,
-    0x80, 0xB9, 0x54, 0x0B, 0x40, 0xF0, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7E, 0x5F, 0xC0, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFE,
-    0xAB, 0xF4, 0x00, 0x01, 0xF4, 0x0B, 0xF4, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xF0, 0x0F,
-    0xF0, 0x00, 0x03, 0xE0, 0x1F, 0xFF, 0xF0, 0x07, 0xD0, 0x2F, 0xFF, 0xFC, 0x0B, 0xC0, 0x3F, 0xE0,
-    0x7D, 0x0F, 0xC0, 0x3F, 0xC0, 0x3D, 0x0F, 0x80, 0x7F, 0x40, 0x3C, 0x1F, 0x40, 0xBF, 0x00, 0xBC,
-    0x2F, 0x40, 0xFF, 0x0F, 0xF4, 0x3F, 0x00, 0xFE, 0x0F, 0xE0, 0x15, 0x00, 0x59, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xEB, 0xFD, 0x00, 0x0F, 0x81, 0xFC, 0x00, 0x1F,
-    0x42, 0xFC, 0x00, 0x2F, 0x03, 0xF8, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x7D,
-    0x0B, 0xFF, 0xD0, 0xBC, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xD1, 0xF8, 0x00, 0x2F, 0x40, 0xBC, 0x00,
-    0x3F, 0x00, 0xB8, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x7D, 0x2F, 0xF0, 0x00, 0xBC, 0x2F, 0xC0, 0x00,
-    0x68, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x03, 0xFF, 0xBF, 0xFF, 0x80, 0xBF, 0x07, 0xD0, 0xB8, 0x0F, 0xC0,
-    0xF4, 0x0F, 0x42, 0xF4, 0x2E, 0x02, 0xF0, 0x3F, 0x03, 0xD0, 0xBD, 0x03, 0xF0, 0x3E, 0x7F, 0xD0,
-    0x3F, 0x83, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x1B, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xFD, 0x7F, 0x40, 0xBE, 0x7F, 0xBC,
-    0x1F, 0x0F, 0x43, 0xC3, 0xC1, 0xE0, 0xB8, 0x3C, 0x3D, 0x3F, 0x07, 0xD3, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x41, 0xFF, 0xFF, 0x90, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x90, 0x10, 0x07, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF,
-    0x40, 0x60, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x6F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFF,
-    0xD0, 0x7E, 0x04, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xFA, 0xD0, 0x1F, 0xFF, 0x01,
-    0xBF, 0xE0, 0x2F, 0x80, 0x02, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0x80, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x0F, 0xD6, 0x00, 0x01, 0xFD, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x2F,
-    0xFF, 0xE3, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0,
-    0x00, 0xB8, 0x00, 0x0F, 0x74, 0x00, 0x07, 0x00, 0x00, 0x50, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0x40,
-    0x2F, 0x47, 0xE0, 0x1F, 0x81, 0xFC, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x0F, 0xDF, 0xD0, 0x02, 0xFF,
-    0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3E, 0x01, 0xF4, 0xFC, 0x0F, 0x83, 0xF0,
-    0xBC, 0x0F, 0xC3, 0xD0, 0x2F, 0x3F, 0x00, 0xBE, 0xF0, 0x02, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F,
-    0xD0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x40, 0x2F, 0x80, 0x7E, 0x01, 0xFC, 0x01, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0xFD, 0x00,
-    0x0F, 0xDB, 0xE0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x0F, 0x80, 0xBC, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0xC3, 0xF0,
-    0x00, 0xBC, 0x7D, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F,
-    0x80, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x03, 0xF4, 0x1F, 0x40,
-    0x00, 0x7E, 0x1F, 0x80, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x1F, 0xEF,
-    0xE0, 0x00, 0x1F, 0xD3, 0xFC, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x00,
-    0x2D, 0x1E, 0x00, 0x07, 0xDE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x2F, 0xF8, 0x00, 0x2F, 0x2F, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x3D, 0xBF, 0xFF, 0xD3, 0xC0, 0x1F, 0x40, 0xBC, 0x02, 0xF0,
-    0x0F, 0x80, 0x3E, 0x00, 0xF4, 0x03, 0xD0, 0x1F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0xC0, 0x3D, 0x00,
-    0xF8, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xFD, 0xB0, 0xAF, 0xA3, 0x80, 0x3C, 0x0D,
-    0x01, 0xE0, 0x70, 0x0B, 0x02, 0xC0, 0x3C, 0x0E, 0x00, 0xF0, 0x78, 0x07, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x15, 0x00, 0xA4, 0xBC, 0x03, 0xE3, 0xF0,
-    0x1F, 0x4F, 0x40, 0xBC, 0x3C, 0x03, 0xF1, 0xF0, 0x0F, 0x87, 0xC1, 0xFD, 0x1F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0x00,
-    0x07, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x28, 0x09, 0x3C, 0x1E, 0x74, 0x2C, 0xB0, 0x3C,
-    0xB0, 0xB8, 0x7F, 0xF4, 0x15, 0xF0, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xF4, 0x01, 0xF0, 0x00, 0xF0,
-    0x01, 0x40, 0x14, 0x1E, 0x01, 0xE0, 0xB4, 0x0B, 0x43, 0xC0, 0x3C, 0x1D, 0xA1, 0xF0, 0xB3, 0xCF,
-    0x83, 0xEF, 0xFD, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F, 0x5F, 0x00, 0x74, 0xB8, 0x01, 0x83,
-    0xD0, 0x00, 0x0F, 0x00, 0x04, 0x04, 0x1C, 0x1C, 0x34, 0x38, 0x36, 0x34, 0x7F, 0xF0, 0x7F, 0xF0,
-    0x3E, 0xA0, 0x28, 0xE0, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x0B, 0xF0,
-    0x3C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80, 0x7C, 0x1F, 0x00, 0xFC, 0x3F, 0x00, 0xF8, 0x3F, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0x03, 0xFB, 0xF4, 0x03, 0xFF, 0xFC, 0x0B, 0xF4, 0x7C, 0x0F, 0xC0, 0x3C, 0x0F, 0x80,
-    0x7C, 0x2F, 0x40, 0xF8, 0x3F, 0x01, 0xF4, 0x7F, 0x03, 0xF0, 0xBE, 0x03, 0xF0, 0x39, 0x00, 0x01,
-    0xBE, 0x41, 0xF8, 0x00, 0x2F, 0xFF, 0x83, 0xFE, 0x43, 0xF9, 0x2F, 0x07, 0xFF, 0xFF, 0xC1, 0x7D,
-    0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xEA, 0x95, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x50, 0x00, 0xB0, 0x01, 0xBE, 0x0B, 0x90,
-    0x7E, 0xB8, 0x2F, 0xFF, 0x57, 0xC0, 0x1B, 0xFF, 0xFC, 0x00, 0x7F, 0xEA, 0x40, 0x0B, 0x80, 0x00,
-    0x00, 0xBF, 0xAB, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0x00, 0x79, 0x00, 0x01, 0xBE, 0x41,
-    0xF8, 0x00, 0x3F, 0xFF, 0x43, 0xFE, 0x43, 0xF9, 0x2F, 0x07, 0xFF, 0xFF, 0x81, 0x7D, 0x01, 0xAF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFA, 0xA5, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x01, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x01, 0x2F, 0xFF, 0xD0, 0x00, 0x3C, 0x05, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x00, 0xF0, 0x07, 0xFF, 0x03, 0xFE, 0xBD, 0x1D, 0x01, 0xFF,
-    0xFA, 0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xBE, 0xA5, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xEA,
-    0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0x5F, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x3F, 0x40, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xD1, 0xFC, 0x00, 0x07, 0xF0, 0xFF, 0xC3, 0xF4, 0x00, 0x03,
-    0xF4, 0xFF, 0x8F, 0xD0, 0x00, 0x02, 0xFD, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0xFF, 0xBE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xCF, 0xE7, 0xFE, 0x00, 0x07, 0xFF, 0x0F, 0xD3, 0xFF, 0x40,
-    0x2F, 0xFC, 0x1F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x3E, 0x03, 0xD1, 0xF8, 0x00, 0xFC, 0x3F, 0x0B, 0xC7, 0xF0, 0x00, 0xBF, 0x3F, 0x0F,
-    0x9F, 0xC0, 0x00, 0x3F, 0x7F, 0x2F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xEF, 0xFB, 0xFC, 0x00, 0x07, 0xFF, 0x1F, 0xE3,
-    0xFF, 0x00, 0x2F, 0xFC, 0x2F, 0xC1, 0xFF, 0xC0, 0x00, 0x1E, 0x0B, 0xC0, 0x03, 0xE2, 0xF4, 0x00,
-    0x3D, 0x7E, 0x00, 0x0B, 0xDF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x07, 0xEB, 0xF8, 0x00, 0xBC, 0x0F, 0xC0, 0x0F, 0xC0, 0x7D, 0x01, 0xF8,
-    0x07, 0xD0, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xC0, 0x1D, 0xB4, 0x02, 0xEE, 0x00, 0x3F,
-    0x80, 0x07, 0xF0, 0x00, 0xFF, 0xD0, 0x0F, 0x0F, 0x01, 0xE0, 0xF0, 0x3C, 0x0F, 0x00, 0x02, 0xD0,
-    0x01, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0xFC, 0x3F, 0x00, 0x07,
-    0xD0, 0xF8, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0xFC, 0x2F, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x3F, 0x07,
-    0xE0, 0x07, 0xF8, 0x2F, 0xF4, 0x2F, 0xC0, 0xFF, 0x80, 0xA8, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0xAA, 0x90, 0x0F, 0xFD, 0x01, 0xE2, 0xC0,
-    0x2D, 0x3C, 0x03, 0xC7, 0x80, 0x3C, 0xB4, 0x0B, 0x4F, 0x00, 0xF0, 0xF0, 0x3E, 0x1F, 0xC7, 0x82,
-    0xF4, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xF8,
-    0x00, 0xFC, 0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xE0,
-    0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0xD0, 0xBF, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x78, 0x1E, 0x02, 0xD0, 0xB4, 0x0F, 0x03, 0xC0, 0x7C, 0x1F, 0x02, 0xE0,
-    0xBF, 0xFF, 0x43, 0xFF, 0xFD, 0x1F, 0x97, 0xF0, 0xBC, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xF8,
-    0x00, 0xFC, 0x02, 0xF4, 0x01, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xE0,
-    0x07, 0xF0, 0x0F, 0xFA, 0xAF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x78, 0x07, 0x80, 0xF4, 0x0F,
-    0x40, 0xF0, 0x0F, 0x96, 0xF0, 0x1F, 0xFF, 0xE0, 0x2F, 0xFF, 0xD0, 0x3D, 0x07, 0xC0, 0x7C, 0x0B,
-    0xC0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x19, 0x00, 0x05, 0x40, 0x29,
-    0x0F, 0xC0, 0x7D, 0x1F, 0x40, 0xBC, 0x1F, 0x00, 0xFC, 0x2E, 0x00, 0xF8, 0x2D, 0x02, 0xF0, 0x3E,
-    0x0B, 0xF0, 0x2F, 0xFF, 0xE0, 0x0F, 0xFF, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x50, 0x00,
-    0x04, 0x04, 0x0C, 0x0D, 0x1C, 0x1C, 0x34, 0x3C, 0x30, 0xB8, 0x3F, 0xF4, 0x1A, 0xB0, 0x00, 0xF8,
-    0x00, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x40, 0xBF, 0xC0, 0x2F, 0xF8, 0x0F, 0xF8, 0x03, 0xFF, 0x83, 0xFF, 0x40, 0x3F,
-    0xFC, 0xBF, 0xF0, 0x07, 0xEF, 0xCF, 0xFF, 0x00, 0xBD, 0xFF, 0xFB, 0xE0, 0x0F, 0xCF, 0xFE, 0xBE,
-    0x01, 0xF8, 0xFF, 0xCF, 0xD0, 0x2F, 0x8F, 0xF5, 0xFC, 0x03, 0xF4, 0xFF, 0x3F, 0xC0, 0x7F, 0x0F,
-    0xD3, 0xF8, 0x0B, 0xF0, 0x54, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01,
-    0xA8, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0xFC, 0x0F, 0xC0, 0x7F, 0x0F, 0xE0, 0x3F, 0xDB, 0xF4, 0x0F,
-    0xFB, 0xFC, 0x07, 0xAF, 0xEF, 0x02, 0xDB, 0xEB, 0x80, 0xF2, 0xF3, 0xD0, 0x7C, 0x66, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF4, 0x0B,
-    0xC0, 0x3F, 0x00, 0xF8, 0x07, 0xD0, 0x2F, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x40, 0xBC, 0x03, 0xF0,
-    0x0F, 0x80, 0x29, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0xAB, 0xC0, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x7C, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x1F, 0x83, 0xF0, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4,
-    0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x05, 0x00, 0x40, 0x00, 0xFA, 0xBD,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xB8, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xC1, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2D, 0x00, 0xF0, 0x03,
-    0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00, 0x00,
-    0x3C, 0x7C, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x7E,
-    0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x80, 0x0F, 0xE0, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x8B, 0xC0, 0x02, 0xF4,
-    0xFC, 0x00, 0x3F, 0x5F, 0xC0, 0x02, 0xA2, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xB8, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xC1, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2D, 0x00, 0xF0,
-    0x03, 0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xF7, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xAB, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xEA, 0x54,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xE5,
-    0xA0, 0x00, 0x00, 0x7D, 0x3F, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xAA, 0x80, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x2F, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xDB, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x7C, 0x1F, 0xF4, 0x6C, 0x0F, 0x00, 0xFF, 0xFF, 0xD2, 0xD0, 0x0F, 0xEA,
-    0xA4, 0x3C, 0x07, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0x7E, 0xFF, 0x90, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x40, 0x01, 0xF5, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07,
-    0xE5, 0x50, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x3F, 0xAA, 0xA0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0xFA, 0xBD, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x1F, 0xEF, 0x40, 0x07, 0xE1, 0x78, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xAA, 0x94,
-    0x02, 0xF0, 0x01, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x06, 0x40,
-    0x6F, 0xD0, 0x00, 0x00, 0x2F, 0x41, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0x00, 0x7C, 0x02, 0xF8, 0x00, 0xF4, 0x6F, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x7C, 0x00,
-    0x15, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x0F, 0x03, 0xE0, 0x2F, 0xFF, 0x00, 0x2F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x1F,
-    0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x64, 0x06, 0xFD, 0x00, 0x00, 0x02, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xC0, 0x2F, 0x80, 0x0F,
-    0x46, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xD0, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0x00, 0x7C, 0x00, 0x05, 0x7C, 0x0F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xF4, 0x0F, 0x03, 0xF0, 0x0B, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x1F, 0x1F, 0x00, 0x3F,
-    0x3F, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0xE0, 0xFD, 0x00, 0x03,
-    0xF4, 0xFF, 0xC3, 0xF4, 0x00, 0x03, 0xF8, 0xFF, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0x6F, 0x80,
-    0x00, 0x00, 0xFE, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xDB, 0xE7, 0xFE, 0x00,
-    0x03, 0xFF, 0x4F, 0xD2, 0xFF, 0x80, 0x1F, 0xFC, 0x0F, 0xC0, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x29, 0x02, 0x90, 0xA8, 0x01, 0xFC, 0x3E, 0x0B,
-    0xC3, 0xF0, 0x00, 0xBE, 0x3F, 0x0F, 0x8F, 0xC0, 0x00, 0x3F, 0x7F, 0x1F, 0x7F, 0x00, 0x00, 0x0F,
-    0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xEF, 0xFB,
-    0xFC, 0x00, 0x07, 0xFF, 0x1F, 0xE3, 0xFF, 0x00, 0x2F, 0xFC, 0x2F, 0xC1, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC7, 0xC0, 0x03, 0xF3, 0xF0, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x7F, 0xFC, 0x00, 0x04,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xD0, 0x08, 0x07, 0xF0, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2E, 0x00, 0x3E, 0x3E, 0x00, 0xBD, 0xBD, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x02, 0x5B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x6D, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x2C, 0x00, 0x09, 0x7C, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x2F, 0xD0,
-    0x00, 0xBF, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0xD2, 0xF4, 0x1F, 0xFF, 0xC0, 0x3F, 0xFD,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00,
-    0xD2, 0xF4, 0x1F, 0xFF, 0xC0, 0x3F, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x40, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x01, 0x50, 0x0F, 0x80, 0x3F, 0x80, 0x7D, 0x02, 0xFD, 0x02, 0xF0, 0x1F, 0xF0, 0x0F, 0xC1, 0xFF,
-    0xC0, 0x3E, 0x0F, 0xFE, 0x02, 0xF0, 0xFF, 0xF4, 0x0F, 0xCF, 0xDF, 0xC0, 0x3E, 0xBD, 0xBF, 0x01,
-    0xFF, 0xD3, 0xF8, 0x0B, 0xFE, 0x1F, 0xD0, 0x3F, 0xF0, 0xFF, 0x01, 0xFF, 0x03, 0xFC, 0x0B, 0xF4,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0x40, 0x3D, 0x07, 0xF0, 0x03,
-    0xC1, 0xFF, 0x00, 0x7C, 0x7F, 0xE0, 0x0B, 0x8F, 0xBD, 0x00, 0xFB, 0xF3, 0xD0, 0x1F, 0xFC, 0x7C,
-    0x02, 0xFF, 0x0F, 0xC0, 0x3F, 0xC0, 0xF8, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD3, 0xD0, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x54, 0x03, 0xE0, 0x0F, 0xE0, 0x1F, 0x40, 0xBF, 0x40, 0xBC, 0x07, 0xFC, 0x03, 0xF0, 0x7F,
-    0xF0, 0x0F, 0x83, 0xFF, 0x80, 0xBC, 0x3F, 0xFD, 0x03, 0xF3, 0xF7, 0xF0, 0x0F, 0xAF, 0x6F, 0xC0,
-    0x7F, 0xF4, 0xFE, 0x02, 0xFF, 0x87, 0xF4, 0x0F, 0xFC, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x02, 0xFD,
-    0x0B, 0xF4, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x07, 0xC7, 0xC0, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xD0, 0x3D, 0x07, 0xF0, 0x0F, 0x07, 0xFC, 0x07, 0xC7, 0xFE,
-    0x02, 0xE3, 0xEF, 0x40, 0xFB, 0xF3, 0xD0, 0x7F, 0xF1, 0xF0, 0x2F, 0xF0, 0xFC, 0x0F, 0xF0, 0x3E,
-    0x03, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2F, 0x2F, 0x00,
-    0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x5B, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0x3F, 0x01, 0xFE, 0x01, 0xBF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00,
-    0x3F, 0x3F, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xF8,
-    0x2F, 0x5B, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x01, 0x64, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0x42, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x2F,
-    0x80, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x1F, 0xC0, 0xBF, 0x96,
-    0xFF, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0xDA, 0xFC, 0x1F, 0xFF, 0xFC,
-    0x2F, 0x96, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x3E, 0x3E, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x90, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x02, 0xFD, 0x0B, 0xE0, 0x0F, 0xD0,
-    0x0F, 0xC0, 0xBE, 0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0x7F,
-    0x02, 0xFE, 0x5B, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x3E, 0x3E, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0xBC, 0x0F, 0xDA, 0xFC, 0x1F,
-    0xFF, 0xFC, 0x2F, 0x96, 0xF4, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF6,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x2F, 0x2F,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xA0, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x06,
-    0xE0, 0x0B, 0xFF, 0x80, 0x00, 0x3C, 0x08, 0x07, 0xE0, 0x3F, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x07, 0xC0, 0x1F, 0x80, 0xF8, 0x00, 0xFC, 0x1F, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0xBD, 0xBC, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x06, 0xAA, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x7E, 0x2F, 0x00, 0x00,
-    0x3F, 0x3D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x02, 0xF2, 0xF0, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x40,
-    0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x0F, 0x80, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x3D, 0x00, 0x0B, 0xDB,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7E, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x02, 0xF0, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x3F,
-    0x3D, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x7E, 0x00, 0xBD, 0x01, 0xF8, 0x02, 0xF4, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x40,
-    0x01, 0xF0, 0x07, 0xC0, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x3D, 0x00,
-    0x00, 0xBD, 0xBC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0xFC, 0x01,
-    0xF8, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0xFC, 0x07, 0xC0,
-    0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x7E, 0x2F, 0x00, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x0F, 0x8F, 0x80,
-    0x7E, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0xB4, 0x0B, 0x43, 0xC0, 0x3D, 0x1D, 0x01, 0xF0,
-    0xB0, 0x0F, 0xC3, 0xC1, 0xFE, 0x0F, 0xFF, 0xF4, 0x1F, 0xFF, 0xC0, 0x19, 0x5F, 0x00, 0x00, 0xB8,
-    0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xD2, 0xF2, 0xF0, 0xFC, 0xFC, 0x00,
-    0x00, 0x07, 0x0B, 0x03, 0x43, 0x80, 0xC1, 0xD0, 0x71, 0xF0, 0x1F, 0xFC, 0x02, 0xAA, 0x00, 0x03,
-    0x40, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x02, 0xBC, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x3E,
-    0xA8, 0x03, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0xA0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x02, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x01,
-    0xF4, 0x02, 0xD0, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xF8, 0x00, 0xF8, 0x02,
-    0xFF, 0xFC, 0x07, 0xD0, 0x0F, 0x41, 0xF0, 0x3F, 0x00, 0x3C, 0x0B, 0xC0, 0xFC, 0x01, 0xF5, 0xBE,
-    0x07, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0x80, 0x3F, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x1F, 0x5F, 0x40, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x03, 0xD0, 0x1C, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x7C, 0x03, 0x80, 0x02, 0xD0, 0x0E, 0x50,
-    0x0F, 0x00, 0x7F, 0xF0, 0x3C, 0x02, 0xC2, 0xC1, 0xF0, 0x0E, 0x0F, 0x0F, 0x80, 0x7F, 0xF8, 0x3D,
-    0x02, 0xFF, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0F, 0xC0,
-    0x1F, 0x80, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x0F, 0xE2, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xF0,
-    0x1F, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x02, 0xE0, 0x2D,
-    0x00, 0xF0, 0xF4, 0x00, 0xFB, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x0F, 0x8F, 0xD0, 0x7E, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC7, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x41, 0x55, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
-    0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2D, 0x00, 0xF4, 0x3C, 0x00, 0xF0, 0x3C,
-    0x01, 0xE0, 0xB8, 0x02, 0xD0, 0xF0, 0x03, 0xC0, 0xF0, 0x07, 0xC1, 0xE0, 0x0B, 0x82, 0xD0, 0x0F,
-    0x03, 0xC0, 0x0F, 0x07, 0x80, 0x1E, 0x0B, 0x40, 0x2D, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x78, 0x2E,
-    0x00, 0xB4, 0x3C, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x2A, 0x40, 0x3F, 0xC0,
-    0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x02, 0xFC, 0x02, 0xA8, 0x03, 0xF4, 0x07, 0xF0, 0x0F, 0xD0,
-    0x2F, 0xC0, 0x7F, 0x00, 0x02, 0xA4, 0x1F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x2A,
-    0x40, 0x3F, 0xC0, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x02, 0xFC, 0x2A, 0x4A, 0xA0, 0x0F, 0xF1,
-    0xFD, 0x01, 0xFC, 0x3F, 0x80, 0x2F, 0x87, 0xF0, 0x03, 0xF4, 0xBE, 0x00, 0xBF, 0x0F, 0xD0, 0x02,
-    0xA8, 0x6A, 0x40, 0xFD, 0x3F, 0xC0, 0x7F, 0x0F, 0xD0, 0x3F, 0x4B, 0xF0, 0x2F, 0xC3, 0xF4, 0x1F,
-    0xC3, 0xF8, 0x00, 0x02, 0xA4, 0x1F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x2A, 0x4A,
-    0xA0, 0x0F, 0xF1, 0xFD, 0x01, 0xFC, 0x3F, 0x80, 0x3F, 0x83, 0xF0, 0x03, 0xF0, 0xBE, 0x00, 0xBF,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03,
-    0xD0, 0x00, 0x7C, 0x01, 0xFF, 0xFE, 0x3F, 0xFF, 0xE1, 0x1F, 0x54, 0x02, 0xF0, 0x00, 0x3E, 0x00,
-    0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E,
-    0x00, 0x03, 0xD0, 0x00, 0x2C, 0x00, 0x01, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0,
-    0x00, 0x1B, 0xD4, 0x02, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x01, 0xF5, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0xD0, 0x3F, 0x83, 0xFE, 0x7F, 0x87, 0x40, 0x00, 0x00, 0x0A,
-    0x0B, 0xC3, 0xF2, 0xFC, 0x0A, 0x0B, 0xC3, 0xF2, 0xFC, 0x0A, 0x40, 0xA0, 0x1A, 0x2F, 0x42, 0xF0,
-    0x3E, 0x3F, 0x03, 0xF0, 0xBE, 0x7F, 0x0B, 0xF0, 0xFD, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x0A, 0x00, 0xF0, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x37, 0x0F, 0x40, 0x00, 0x7A, 0x2E, 0x00, 0x00,
-    0x3C, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF8, 0x61, 0x90, 0x03, 0xF0, 0xE6, 0xA0, 0x0B, 0xC1, 0xA3, 0x90, 0x2F,
-    0x00, 0xD3, 0x80, 0x29, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xD0, 0x2F,
-    0xC0, 0x7F, 0x00, 0x02, 0xA8, 0x6A, 0x01, 0xFD, 0x3F, 0xC0, 0xBF, 0x0F, 0xD0, 0x3F, 0x4B, 0xF0,
-    0x2F, 0xC3, 0xF0, 0x1F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0xC2, 0xC2, 0xE0, 0xF0,
-    0xF0, 0xF0, 0xB8, 0x78, 0x38, 0x2C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x78,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xB4, 0x3C, 0xB8, 0x2D, 0x3C, 0x0E, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x0F, 0x0B, 0x43, 0xC3, 0xD2, 0xE0, 0xB4, 0xB8, 0x3C, 0x0E, 0x0E, 0x0B, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xE0, 0x0B, 0xEF, 0x82, 0xA4, 0xA9, 0x00, 0x00, 0x00,
-    0x40, 0x0F, 0x01, 0xF4, 0x2F, 0x02, 0xF0, 0x0B, 0xE0, 0x0B, 0xD0, 0x0F, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x40, 0x03, 0x80, 0x07, 0xD0, 0x03, 0xE0, 0x03, 0xE0, 0x2F, 0x41, 0xF8, 0x03, 0xC0, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0xBF, 0x03, 0xF9, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0,
-    0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x2F, 0xBF,
-    0xFE, 0x03, 0xE0, 0x03, 0xF3, 0xFF, 0x80, 0x7E, 0x00, 0xBE, 0x3F, 0xF0, 0x0F, 0xD0, 0x0A, 0xAF,
-    0xFF, 0x40, 0xA8, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFF, 0xE0, 0x07, 0xFC, 0x7C, 0x00, 0x1F, 0x0F, 0x00, 0x0F,
-    0x87, 0xC0, 0x03, 0xD2, 0xF0, 0x01, 0xF5, 0xF4, 0x00, 0xBE, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xD7, 0xFF, 0xFC, 0x29, 0x06,
-    0x8B, 0xFF, 0xD1, 0xFF, 0xD0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xC8, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x27, 0x68, 0x00, 0x29, 0xD7, 0x20, 0xEF, 0xFF,
-    0xF8, 0x2F, 0xD3, 0xF8, 0x1F, 0xFF, 0xFF, 0x46, 0xA5, 0x5C, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x06, 0xF9, 0x00, 0x1F, 0xFF, 0xC1, 0xFF, 0xFD, 0x00, 0xF9, 0x0F, 0x8B, 0xD0,
-    0xBC, 0x01, 0x40, 0x2F, 0x04, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x80, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x24, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x01, 0xA0,
-    0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x14, 0x01, 0xFF, 0xFC,
-    0x00, 0x2C, 0x03, 0xF4, 0x3F, 0x00, 0x3C, 0x00, 0x40, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x03, 0xE0,
-    0x00, 0x2F, 0xF0, 0x03, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x03, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xFD, 0x00, 0x0F, 0x80, 0x01,
-    0xFD, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0xE0, 0xBC, 0x00, 0x0F, 0xA0, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x7F, 0xC0, 0x00, 0xF8,
-    0x1F, 0xF0, 0x00, 0x0F, 0x42, 0xF8, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1A,
-    0x00, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0x8B, 0xF0, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x03,
-    0xF4, 0x0B, 0x80, 0x00, 0x0A, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x07,
-    0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x1A, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0xC9, 0x2B, 0xA3, 0xAD, 0x35, 0xC3, 0xF8, 0x1E, 0x00, 0x00, 0x50, 0x1D, 0x06, 0xC1, 0x9C, 0x3F,
-    0xD0, 0x34, 0x00, 0x00, 0xFE, 0x18, 0x02, 0xF8, 0x01, 0xC2, 0x3C, 0x7F, 0x46, 0x90, 0x07, 0xF1,
-    0xD0, 0x3F, 0x83, 0x9C, 0x71, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xC0, 0x34, 0x0B,
-    0x00, 0xE0, 0x2C, 0x01, 0x40, 0x06, 0x80, 0xCA, 0x1C, 0xD0, 0xFC, 0x71, 0xC7, 0xF8, 0x04, 0x00,
-    0x0B, 0xC2, 0x89, 0x30, 0x93, 0x5D, 0x2F, 0xC1, 0x68, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xEF, 0xE0, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0xBC, 0x0B, 0xC0, 0x7C, 0x0F, 0x40, 0xF8, 0x1F, 0x00,
-    0xF4, 0x3F, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x06, 0x81, 0xC9, 0x3A, 0x93, 0x6D,
-    0x72, 0xC7, 0xF4, 0x2E, 0x00, 0x01, 0x80, 0x7C, 0x02, 0x80, 0x34, 0x07, 0x01, 0xB4, 0x3F, 0xC0,
-    0x07, 0xF0, 0x24, 0xD0, 0x03, 0x40, 0x3C, 0x07, 0xC0, 0x7E, 0x43, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x90, 0x07, 0x01, 0xF8, 0x00, 0xB0, 0xBF, 0x41, 0xA4, 0x00, 0x00, 0x80, 0x3C, 0x0E, 0xC3, 0x68,
-    0xBF, 0xC0, 0x74, 0x0B, 0x00, 0x00, 0x01, 0xFD, 0x28, 0x03, 0x40, 0x3F, 0x40, 0x38, 0xBF, 0x06,
-    0x80, 0x01, 0xF8, 0x19, 0x00, 0xFD, 0x07, 0x6C, 0x2C, 0x70, 0xB7, 0x80, 0xF8, 0x00, 0x00, 0x0B,
-    0xFC, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xD0, 0x3C, 0x02, 0x40, 0x06, 0xC0, 0xCA, 0x1C, 0xD0, 0xFC,
-    0x34, 0xCB, 0x6C, 0x3E, 0x40, 0x0B, 0xC2, 0x89, 0x30, 0xA3, 0x5D, 0x2F, 0xC1, 0x68, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x2C, 0x00, 0x00, 0x0E, 0x38, 0x00, 0x00,
-    0x2C, 0xB0, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xCF, 0x40, 0x07, 0xFF, 0x5D, 0x00, 0x0F, 0xDF, 0x3C, 0x00, 0x2F, 0xDD,
-    0x74, 0x00, 0x3F, 0xBC, 0xF0, 0x00, 0x3F, 0xF5, 0xD0, 0x00, 0x7F, 0xF3, 0xD8, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0E, 0x38,
-    0x00, 0x00, 0x2C, 0xB0, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0x90,
-    0x10, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x1A, 0xA0, 0x0F, 0xE0, 0xBF, 0xC0,
-    0x3F, 0x83, 0xD0, 0x01, 0xFF, 0x1E, 0x60, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF,
-    0xF4, 0x01, 0xF0, 0x05, 0x03, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x6F, 0x40, 0x00, 0xFF, 0xFE, 0x80, 0x3F, 0xFF,
-    0xF4, 0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x01, 0x50, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00,
-    0x0B, 0xF4, 0x0B, 0xC0, 0x00, 0x0F, 0xF8, 0x0F, 0x80, 0x00, 0x1F, 0xFC, 0x1F, 0x40, 0x00, 0x3F,
-    0xFC, 0x2F, 0x00, 0x1A, 0xBF, 0xFE, 0xBF, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFE, 0x3E,
-    0xFC, 0x00, 0x01, 0xFD, 0x3F, 0xF8, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x00, 0x03, 0xFC, 0x3F, 0xF0,
-    0x00, 0x07, 0xF8, 0x2F, 0xF0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x05, 0xFD, 0x6F, 0x94, 0x3F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xF0, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F,
-    0xE9, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x00, 0x07, 0x81, 0xD0, 0x00, 0x00, 0x02, 0xD0, 0xB4, 0x00,
-    0x00, 0x00, 0xF0, 0x3C, 0x00, 0x3F, 0x80, 0x3E, 0xFF, 0x00, 0x3E, 0xA0, 0x1F, 0xFF, 0x00, 0x0C,
-    0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xE4, 0x03, 0xF0, 0xF0, 0x00, 0x2F, 0x40, 0xF8, 0x7C, 0x00, 0x01,
-    0xF0, 0xBD, 0x2F, 0x40, 0x7E, 0xF8, 0x3F, 0x0F, 0xD0, 0x3F, 0xFC, 0x0A, 0x82, 0xA0, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x3C, 0x00, 0x1E, 0x00, 0xF0, 0x00,
-    0xB4, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0x0A, 0x0F, 0x01, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF,
-    0x07, 0xDF, 0xCF, 0x00, 0x1F, 0xFF, 0xB8, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFE, 0xBF, 0x00, 0x07,
-    0xF2, 0xF8, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x01, 0x40, 0x2F, 0xFF, 0xC0, 0xF0, 0x0F, 0xC0, 0xB4, 0x78, 0x03, 0xC0, 0x1D, 0x2D,
-    0x01, 0xD2, 0x8B, 0x4F, 0x00, 0xB2, 0xE3, 0xC3, 0xC0, 0x3C, 0xB4, 0xF2, 0xE0, 0x0E, 0x3C, 0x00,
-    0xF4, 0x07, 0x4F, 0x40, 0x7C, 0x02, 0xC3, 0xF9, 0xBF, 0x00, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x01,
-    0xAB, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x06, 0xBE, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x2F, 0xBC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2D, 0x1F, 0x40, 0x00, 0xE0, 0x7C,
-    0x00, 0x07, 0x43, 0xE0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x14, 0x50, 0x00,
-    0x2A, 0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x1F, 0xFF, 0x80, 0x03, 0xFE, 0xA4, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x80, 0x03,
-    0xE6, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x02, 0xFF, 0x84, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x4F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x3E,
-    0x1F, 0xD0, 0x01, 0xAB, 0xFA, 0xFF, 0xA9, 0x00, 0x7D, 0x02, 0xF0, 0x01, 0x5F, 0xD6, 0xFF, 0x54,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xA5,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xBC, 0x04, 0x02, 0xFC, 0x3C, 0x00, 0x03, 0xF4, 0x78,
-    0x00, 0x07, 0xF0, 0xB4, 0x00, 0x0F, 0xE0, 0xFE, 0x94, 0x0F, 0xD0, 0xFF, 0xFD, 0x0F, 0xC1, 0xFF,
-    0xFD, 0x1F, 0xD2, 0xE2, 0xF4, 0x0F, 0xFB, 0xEB, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xF0, 0x06, 0x40, 0x00, 0x0F, 0xEA, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x6F,
-    0xD0, 0x2F, 0xFD, 0x07, 0xEE, 0x00, 0xFA, 0xD0, 0x1F, 0x3C, 0x02, 0xF3, 0xC0, 0x2F, 0xFC, 0x01,
-    0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x1E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xFF, 0x80, 0x55, 0x7F, 0x55, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFC,
-    0x00, 0x1F, 0x00, 0x0F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x7C, 0x00, 0x02, 0xF1, 0x80, 0x0F, 0xFE, 0x01, 0xBF, 0xF4, 0x1F, 0xF9, 0x80, 0xBF,
-    0xFF, 0x01, 0x7F, 0xF8, 0x0F, 0xF9, 0x2E, 0x7F, 0xC3, 0xF0, 0x1F, 0xBF, 0x00, 0xBF, 0xE0, 0x02,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFE, 0xBC, 0x00, 0xFA, 0xDB,
-    0x80, 0x0F, 0x3C, 0xF4, 0x01, 0xF3, 0xCF, 0x00, 0x2E, 0x79, 0xF0, 0x03, 0xDB, 0x6E, 0x00, 0x3C,
-    0xF3, 0xD0, 0x07, 0xDF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0xD0, 0x2E, 0x00,
-    0x02, 0xF0, 0x2F, 0x80, 0x05, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xE9, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xC1, 0xBD, 0x0F, 0xEF, 0xFD, 0x2F, 0xFF, 0x90, 0x7F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x2F, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x3F, 0x7D, 0xFC, 0xB8, 0x7C, 0x38,
-    0x10, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x7E, 0x43,
-    0xD0, 0x3F, 0xFE, 0xF0, 0x06, 0xFF, 0xFC, 0x00, 0x06, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x1F, 0x80, 0x00, 0x09, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0x4B, 0x87, 0x41, 0xF9, 0xF7, 0xF0, 0x0F, 0xFF, 0xF0,
-    0x00, 0xBF, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x0C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x2C, 0x01, 0x00, 0xB4, 0x01, 0xE6, 0xFF, 0xE4, 0xF0,
-    0x0F, 0xFF, 0x9B, 0xFF, 0xF0, 0xFF, 0x90, 0x00, 0x6F, 0xD1, 0xF8, 0x00, 0x00, 0x3F, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x01, 0xFD, 0x00, 0xBF, 0xF4, 0x3E, 0xFB, 0xCB, 0x4E, 0x28, 0x01, 0xD0, 0x00, 0x2C,
-    0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x02, 0xC0, 0x01, 0x1D, 0x00,
-    0xB8, 0xE3, 0xC2, 0xFF, 0xFC, 0x07, 0xFF, 0x00, 0x0B, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x1A, 0x81,
-    0xBF, 0xFF, 0x0F, 0xFE, 0x40, 0x3F, 0xF8, 0x00, 0xFE, 0xFD, 0x02, 0xE1, 0xFF, 0x4B, 0xC0, 0x7F,
-    0x6E, 0x00, 0x28, 0x0E, 0x90, 0x00, 0x3F, 0xFF, 0x90, 0x06, 0xFF, 0x80, 0x0B, 0xFE, 0x02, 0xFE,
-    0xF8, 0x7F, 0xC3, 0xDB, 0xF4, 0x0F, 0x4D, 0x00, 0x3D, 0x08, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x02,
-    0x80, 0xF4, 0x3C, 0x07, 0xC7, 0x80, 0x3D, 0xB4, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xFE, 0x07,
-    0xFF, 0xD0, 0x06, 0xBC, 0x00, 0x00, 0x05, 0x00, 0x00, 0xF4, 0x24, 0x1F, 0x03, 0x83, 0xD0, 0x3C,
-    0x7C, 0x02, 0xCF, 0x40, 0x1F, 0xF0, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0xBF, 0xFC, 0x07, 0xE5,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x83, 0xFA, 0xAA, 0xA8, 0x2F, 0xEA, 0xAA, 0x90, 0x7F, 0xFF, 0xFE, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1D, 0xB0, 0x00,
-    0x02, 0xF3, 0xE0, 0x00, 0x3F, 0xCF, 0xE0, 0x03, 0xFE, 0x7F, 0xD0, 0x7F, 0xB6, 0xDF, 0xC3, 0xE2,
-    0xCF, 0x1F, 0x09, 0x0F, 0x38, 0x10, 0x00, 0x3A, 0xD0, 0x00, 0x02, 0xDF, 0x00, 0x00, 0x0F, 0x3C,
-    0x00, 0x00, 0x3D, 0xE0, 0x00, 0x01, 0xDB, 0x40, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0xFF, 0xFF, 0x81, 0xAA,
-    0xAA, 0xFD, 0x2A, 0xAA, 0xAF, 0xC7, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x41, 0x00, 0x00, 0x03, 0x9E, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00,
-    0x2C, 0xF0, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x00, 0xE7, 0x80, 0x01, 0x43, 0xCF, 0x04, 0x0F, 0x8B,
-    0x3C, 0x3C, 0x0F, 0xDE, 0xB7, 0xF4, 0x0F, 0xFD, 0xFF, 0x40, 0x0B, 0xF3, 0xF8, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x07, 0x9C, 0x00, 0x00, 0x01, 0x10, 0x00, 0x02, 0x40, 0x00, 0x0C, 0x00, 0x3D, 0x00,
-    0x03, 0xC0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFA, 0xAA, 0xAA, 0xFD, 0x2F, 0xEA, 0xAA, 0xAF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x18, 0x01, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0xBF,
-    0x40, 0x02, 0xFF, 0xF9, 0x0B, 0xDF, 0xFD, 0x2F, 0xCE, 0x14, 0x3F, 0xCE, 0x00, 0x0A, 0xCE, 0x00,
-    0x01, 0xCE, 0x00, 0x01, 0xCE, 0x00, 0x01, 0xCE, 0x00, 0x2E, 0xCE, 0x00, 0x3F, 0xCE, 0x00, 0x0F,
-    0xCE, 0x78, 0x03, 0xEF, 0xFD, 0x01, 0xFF, 0xE4, 0x00, 0x7E, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x07, 0xFD, 0xB4, 0x07, 0xFF, 0xFC, 0x07, 0xF0, 0xFE, 0x02, 0xF0,
-    0x2F, 0x40, 0xF8, 0x0B, 0xC0, 0x3E, 0x0B, 0xD0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x06, 0xFE, 0xBD, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x5F, 0xF4, 0x00, 0x3F, 0x42, 0xFF, 0x80, 0x0F, 0xD0, 0xBD, 0xFC, 0x00, 0xF8, 0x2F,
-    0x0F, 0xC0, 0x2F, 0x4F, 0xC0, 0xF8, 0x03, 0xF3, 0xF0, 0x2F, 0x40, 0x3F, 0xF8, 0x03, 0xF0, 0x07,
-    0xFE, 0x06, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3D, 0x6F, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0x80, 0x01, 0xF8, 0xFC, 0x00,
-    0x3F, 0x0F, 0xC0, 0x0F, 0xC0, 0xFD, 0x02, 0xF8, 0x0F, 0xD0, 0x7F, 0x00, 0xBE, 0x0F, 0xC0, 0x0B,
-    0xF2, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x0F, 0x43, 0xE0, 0x07, 0xC1, 0xF4, 0x02, 0xF0, 0xBC, 0x00, 0xF8,
-    0x3E, 0x00, 0x3D, 0x0F, 0x40, 0x1F, 0x07, 0xC0, 0x0B, 0xC2, 0xF0, 0x03, 0xE0, 0xF8, 0x01, 0xF4,
-    0x3D, 0x00, 0xBC, 0x1F, 0x00, 0x15, 0x05, 0x40, 0x00, 0x54, 0x05, 0x00, 0x1F, 0x07, 0xC0, 0x03,
-    0xD0, 0xF4, 0x00, 0xF8, 0x3F, 0x00, 0x2F, 0x0B, 0xC0, 0x07, 0xC0, 0xF4, 0x00, 0xF4, 0x3E, 0x00,
-    0x3E, 0x0B, 0xC0, 0x0B, 0xC1, 0xF0, 0x01, 0xF4, 0x3D, 0x00, 0x3E, 0x0F, 0x80, 0x3F, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xD0, 0x0A, 0xAA, 0xA0, 0x00, 0x0A, 0xBF, 0xC2, 0xFF, 0xFD, 0x15, 0x55, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x40, 0x01, 0xFF, 0xCF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0x81, 0xF8, 0x3C, 0x1F, 0x00, 0xE0,
-    0x3C, 0x2E, 0x02, 0xE0, 0x7C, 0x2F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xF8, 0xBF,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x3E, 0x04, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0x9B, 0xE0, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x01, 0xA4, 0x14, 0x0B, 0xFD, 0x3D,
-    0x1F, 0x5F, 0xFC, 0x0B, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xE0, 0x3F, 0xF5, 0xF0, 0xBC,
-    0x7F, 0xD0, 0x14, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x01, 0xF9, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x90,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xFA, 0x50,
-    0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x15, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xE4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x6F, 0xFC, 0x01, 0x6F, 0xFF, 0xE8, 0x03, 0xFF, 0xE4,
-    0x00, 0x07, 0xE4, 0x00, 0x00, 0x04, 0x05, 0x6B, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFA, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_8_bolditalicBitmaps[19982] = {
+    0x85, 0x55, 0x3D, 0x8C, 0xDE, 0x44, 0x10, 0x7D, 0x6B, 0x87, 0x98, 0xC4, 0x84, 0x4D, 0x91, 0xAB,
+    0x2E, 0xB0, 0x14, 0x14, 0x28, 0x42, 0x32, 0x25, 0x42, 0xDF, 0x7D, 0xEB, 0x54, 0x48, 0xA4, 0x20,
+    0x45, 0x22, 0x24, 0x52, 0xD2, 0x51, 0xE4, 0x28, 0x23, 0xF4, 0xE5, 0xBC, 0x80, 0x04, 0x05, 0x45,
+    0xAE, 0x00, 0x51, 0x50, 0x70, 0x45, 0x0A, 0x94, 0xE6, 0x28, 0x52, 0x20, 0x74, 0x39, 0x3B, 0xBA,
+    0xE2, 0x4A, 0x0C, 0x29, 0x52, 0x20, 0x21, 0x23, 0x05, 0x90, 0xA0, 0x59, 0x88, 0x91, 0x7C, 0x89,
+    0xED, 0xE5, 0x8D, 0xEF, 0x27, 0xA2, 0xC2, 0xF2, 0xE7, 0x6F, 0xB5, 0x9E, 0xD9, 0x79, 0xF3, 0xE6,
+    0xCD, 0x18, 0x00, 0x9E, 0x46, 0x54, 0x63, 0x05, 0x49, 0x85, 0x6F, 0xA1, 0x73, 0xE5, 0x91, 0x21,
+    0x6E, 0xB0, 0x90, 0x8D, 0x97, 0xF0, 0xE4, 0xDA, 0x86, 0xAE, 0xA3, 0x01, 0xB6, 0x8A, 0xBE, 0xC6,
+    0xB9, 0x37, 0x36, 0xEC, 0xA7, 0xDE, 0x7E, 0xE2, 0xB3, 0x1D, 0x6F, 0x76, 0x3A, 0xFD, 0x63, 0x0F,
+    0xCC, 0x34, 0x8D, 0xB2, 0xB4, 0x02, 0xF4, 0x47, 0x0D, 0x90, 0xDC, 0xF5, 0x88, 0x02, 0x2F, 0x4C,
+    0x8F, 0xA5, 0x61, 0xF5, 0x72, 0x8E, 0xB9, 0x76, 0xB4, 0x79, 0xBD, 0x46, 0xC2, 0xBD, 0x3E, 0xE6,
+    0x63, 0xC0, 0x5B, 0xFF, 0x0C, 0x97, 0xA1, 0x7A, 0x4B, 0xEF, 0x3B, 0x26, 0x07, 0xCE, 0x9D, 0x74,
+    0x12, 0x4E, 0x71, 0x29, 0x27, 0xCE, 0x80, 0x62, 0x0F, 0x26, 0x78, 0x15, 0xD6, 0x88, 0xC0, 0xC3,
+    0x12, 0xD7, 0x78, 0x15, 0x71, 0xE8, 0x78, 0x3E, 0xE3, 0xAE, 0xF2, 0x57, 0xF8, 0xE7, 0xA2, 0x70,
+    0x37, 0x6C, 0x0E, 0x59, 0x08, 0xF5, 0x72, 0x68, 0x81, 0x34, 0x9F, 0x5C, 0xE1, 0xE5, 0x2C, 0x49,
+    0xE3, 0x76, 0xD4, 0x45, 0x4D, 0x7A, 0x36, 0xA9, 0x4E, 0x9D, 0x35, 0x38, 0x3B, 0x9B, 0xC1, 0xB4,
+    0x2D, 0xD2, 0x7B, 0x35, 0xA3, 0x7C, 0x55, 0x23, 0xBB, 0xD6, 0x60, 0xEB, 0x9B, 0x46, 0xF9, 0x5F,
+    0xEA, 0xA4, 0x0E, 0x95, 0x76, 0x73, 0x9C, 0x13, 0xCF, 0xAC, 0x86, 0xBE, 0x92, 0xC7, 0xD5, 0x0C,
+    0xB3, 0xD8, 0xC5, 0x77, 0x5B, 0x98, 0x01, 0x2A, 0x30, 0x60, 0x7D, 0xC6, 0xDC, 0xB8, 0xB0, 0xE3,
+    0xE7, 0xAD, 0x55, 0x81, 0x79, 0xD4, 0x19, 0x33, 0x29, 0x9A, 0x5C, 0x7C, 0x42, 0xB6, 0xEB, 0x7B,
+    0xFB, 0xF1, 0x06, 0xC8, 0x67, 0xD4, 0x22, 0xA9, 0x61, 0x1C, 0x98, 0xDE, 0x16, 0xD0, 0x22, 0xF6,
+    0xB2, 0x41, 0x96, 0xC8, 0x84, 0xE1, 0xF9, 0x90, 0x37, 0xF3, 0xC3, 0xDB, 0x4E, 0x37, 0x37, 0x49,
+    0x84, 0xAE, 0xC4, 0x6C, 0x01, 0x30, 0xBF, 0x0E, 0x8A, 0xD9, 0x7A, 0xF1, 0x8E, 0x0F, 0xBD, 0x69,
+    0x75, 0x5D, 0xDE, 0x70, 0x9B, 0x1B, 0x3C, 0x6B, 0x01, 0x35, 0x2D, 0x33, 0x71, 0x61, 0x05, 0xB3,
+    0x9C, 0x6F, 0xE5, 0xBA, 0x8D, 0x77, 0x76, 0x93, 0xD0, 0xA7, 0x21, 0x37, 0x63, 0x1C, 0xC6, 0x74,
+    0xB6, 0xA1, 0x26, 0x5A, 0xF0, 0x14, 0xA2, 0x86, 0x95, 0x8F, 0xAB, 0x2C, 0x3C, 0x0C, 0x23, 0xD1,
+    0x69, 0x39, 0xE2, 0x18, 0xA2, 0x9B, 0xA6, 0xDE, 0x8E, 0xBD, 0xFD, 0xA0, 0x87, 0x0D, 0xBB, 0xA1,
+    0x3F, 0x79, 0xE1, 0xDE, 0x5F, 0xFD, 0x91, 0x10, 0x26, 0x51, 0xC8, 0x01, 0x74, 0x06, 0x9D, 0xF9,
+    0x48, 0xA5, 0x64, 0x46, 0xF6, 0x57, 0xE4, 0xB1, 0x90, 0x47, 0x2B, 0x16, 0x62, 0x46, 0xC4, 0x10,
+    0x5C, 0x07, 0x16, 0xF3, 0x23, 0x8B, 0xEE, 0xC8, 0xA2, 0x39, 0xB4, 0xD0, 0xC2, 0xA0, 0x48, 0x41,
+    0x72, 0x9B, 0x52, 0x87, 0x6A, 0xFF, 0x63, 0x71, 0x4A, 0xF6, 0x4F, 0x4F, 0x40, 0x96, 0x6B, 0x6C,
+    0xB7, 0x91, 0x9F, 0x25, 0xD5, 0x4C, 0xFF, 0x3C, 0xD3, 0x6B, 0x0B, 0xB3, 0xD2, 0x65, 0xB3, 0xCE,
+    0x46, 0xDE, 0x5E, 0xF0, 0x36, 0xD4, 0x36, 0x38, 0x33, 0xE2, 0xF8, 0x03, 0xE0, 0xB8, 0x4B, 0x7A,
+    0x04, 0x77, 0x8A, 0xF5, 0x93, 0x88, 0x73, 0xA9, 0xC1, 0x16, 0x19, 0x36, 0x61, 0x27, 0xF4, 0x36,
+    0x90, 0xB3, 0x96, 0x99, 0xE6, 0xFA, 0x0B, 0xAF, 0xA4, 0x4C, 0x84, 0x48, 0xF2, 0x32, 0x87, 0xA2,
+    0x42, 0x59, 0x29, 0xBE, 0xA7, 0x82, 0xCB, 0x50, 0xD9, 0x40, 0xB4, 0x34, 0xCD, 0x42, 0x7E, 0x42,
+    0x28, 0x5C, 0x08, 0x4C, 0x3D, 0x22, 0xA5, 0x22, 0x12, 0x22, 0xEC, 0xA2, 0xDF, 0x86, 0x7D, 0xD3,
+    0x7C, 0x79, 0x14, 0x84, 0xD7, 0x24, 0x50, 0x01, 0x06, 0x7F, 0xDF, 0x27, 0x37, 0xDC, 0x62, 0x25,
+    0xF9, 0x73, 0xB0, 0xA1, 0xBD, 0x15, 0x2A, 0xD6, 0x33, 0xAD, 0xF7, 0x33, 0x95, 0xAB, 0x64, 0x9B,
+    0x8C, 0x24, 0x95, 0xA7, 0x92, 0xD5, 0x38, 0xB8, 0x84, 0x82, 0x3F, 0x4F, 0x82, 0xBA, 0x13, 0x49,
+    0x4B, 0xF1, 0x67, 0x0C, 0x3E, 0x42, 0x5D, 0x24, 0x09, 0x23, 0x8A, 0x21, 0xDA, 0xBB, 0x44, 0xDE,
+    0x75, 0xE9, 0x4C, 0x68, 0xB2, 0xFB, 0xDE, 0x9E, 0xF7, 0x73, 0xE5, 0xE7, 0xAC, 0xD8, 0x26, 0x85,
+    0xE8, 0xD2, 0x3D, 0x61, 0x2C, 0x8C, 0x05, 0x81, 0xF7, 0x94, 0x12, 0x55, 0x73, 0x87, 0xC9, 0x46,
+    0x1D, 0xE3, 0xE9, 0x46, 0x49, 0x0F, 0x93, 0xF8, 0x9B, 0x84, 0x5D, 0xA5, 0x3F, 0xF8, 0xB8, 0x9E,
+    0xA9, 0xB6, 0x60, 0xFA, 0x6C, 0xCA, 0x5C, 0xDF, 0xF7, 0xBA, 0xBA, 0x9E, 0x34, 0x99, 0xEA, 0x4C,
+    0x55, 0x84, 0x46, 0x87, 0x06, 0x57, 0xA5, 0x67, 0x1B, 0x15, 0xBA, 0xB8, 0x5E, 0xA4, 0x39, 0xDB,
+    0x7C, 0xF6, 0x2C, 0x7A, 0xFD, 0x65, 0xA7, 0x43, 0x1B, 0x91, 0x90, 0xB8, 0x79, 0x6D, 0x93, 0xA6,
+    0x79, 0xB9, 0x2F, 0x36, 0x12, 0x91, 0xB9, 0x21, 0xDD, 0x17, 0x98, 0x76, 0xDB, 0x71, 0x9B, 0x49,
+    0xFD, 0x75, 0x15, 0xFB, 0x88, 0x35, 0x38, 0xC8, 0x57, 0x5D, 0x02, 0xF3, 0x80, 0x75, 0xA6, 0xD2,
+    0xB5, 0xA4, 0x45, 0xD5, 0x4D, 0x5A, 0x28, 0xD9, 0x8B, 0x03, 0x91, 0xE5, 0x08, 0x35, 0xFB, 0x7B,
+    0x9D, 0xA0, 0xC6, 0x1C, 0xAB, 0x84, 0xA1, 0x4A, 0xA2, 0x4E, 0xC5, 0x39, 0x0D, 0x4D, 0x19, 0x44,
+    0x71, 0x4B, 0x17, 0x6D, 0xF8, 0x30, 0x3C, 0x02, 0xF2, 0x7D, 0x85, 0xE8, 0x6E, 0xE2, 0x87, 0x3E,
+    0x0E, 0x52, 0x35, 0x16, 0x61, 0x35, 0x74, 0x26, 0x3C, 0x40, 0xB9, 0x8E, 0x78, 0xFD, 0x20, 0xF6,
+    0xF1, 0x8E, 0xE3, 0x84, 0x61, 0x7B, 0xE4, 0x66, 0x12, 0x15, 0x5D, 0x29, 0x32, 0xD5, 0x23, 0xE5,
+    0xDD, 0x21, 0x9E, 0xD6, 0x9C, 0x77, 0x78, 0xF1, 0xB0, 0x3C, 0x6A, 0x63, 0x52, 0x2B, 0xB7, 0x6C,
+    0x7E, 0xD4, 0x07, 0x25, 0x21, 0x6C, 0x6F, 0x8A, 0x5A, 0x5E, 0x95, 0xC6, 0xA9, 0xE2, 0xDD, 0xF6,
+    0x19, 0xDC, 0xBE, 0x8F, 0x4A, 0xBF, 0xF2, 0xDE, 0xCB, 0xEA, 0x61, 0x48, 0xF3, 0x2C, 0x7B, 0x5C,
+    0x47, 0xAD, 0x5A, 0x87, 0x69, 0xCE, 0x70, 0x2E, 0x4C, 0x19, 0x0D, 0x3C, 0xED, 0xBB, 0xC3, 0x43,
+    0xD8, 0xAA, 0x09, 0x93, 0x66, 0xB6, 0x54, 0x55, 0xF2, 0xBD, 0x43, 0xD7, 0x21, 0xD3, 0x55, 0xD2,
+    0xF4, 0x64, 0x98, 0x5D, 0xD9, 0x73, 0x4E, 0xD6, 0x1C, 0x92, 0xD6, 0xE9, 0xDF, 0x3D, 0x19, 0x0B,
+    0x02, 0xDD, 0x47, 0xAD, 0xC9, 0x2D, 0xDA, 0xB8, 0x31, 0x58, 0xBB, 0xD2, 0xA4, 0xDC, 0xA4, 0x95,
+    0x71, 0x36, 0x6A, 0xA9, 0x80, 0x5B, 0xA3, 0x8C, 0xA3, 0x22, 0x74, 0x69, 0xD8, 0x3B, 0x00, 0x5F,
+    0x36, 0x28, 0xA8, 0x0A, 0x0E, 0xCB, 0x72, 0xFD, 0x74, 0xD2, 0x4E, 0x49, 0xB0, 0x16, 0xD4, 0x02,
+    0x97, 0xC2, 0x14, 0x5E, 0xA0, 0x4F, 0xA5, 0xA9, 0x40, 0x13, 0x44, 0xDD, 0x2C, 0x18, 0xD7, 0x8A,
+    0xE7, 0x70, 0x82, 0xFB, 0xD8, 0x27, 0x3C, 0x58, 0x75, 0x54, 0x78, 0x47, 0xCD, 0xB6, 0x54, 0x92,
+    0x37, 0x2E, 0xF1, 0x99, 0x5B, 0x65, 0x8B, 0x49, 0x57, 0x84, 0xBC, 0x60, 0x5E, 0x25, 0xAB, 0x45,
+    0xBE, 0x6B, 0xCD, 0x40, 0xE3, 0xE7, 0x92, 0x1B, 0x85, 0x07, 0xFB, 0x36, 0xCB, 0xE1, 0x51, 0x8E,
+    0x32, 0xD0, 0xA8, 0x7A, 0x64, 0x7F, 0x6C, 0xC4, 0x93, 0x87, 0x4F, 0xD9, 0x2A, 0x74, 0x70, 0x0C,
+    0xA8, 0x7F, 0xBD, 0xC8, 0x4E, 0x11, 0x01, 0x30, 0x30, 0xC5, 0x44, 0xBD, 0xD3, 0x9C, 0x11, 0x39,
+    0x40, 0x41, 0xCA, 0x0A, 0xFA, 0x49, 0xF7, 0xE3, 0x5D, 0x91, 0x2D, 0x15, 0xCC, 0x5F, 0x70, 0xC7,
+    0x24, 0x0B, 0x96, 0x6B, 0x22, 0x51, 0x37, 0xCF, 0x7F, 0xA6, 0xEB, 0x6C, 0xD0, 0xD5, 0xF2, 0x60,
+    0x48, 0xBB, 0x1E, 0x37, 0xBD, 0x0E, 0xA1, 0x11, 0x3A, 0xB0, 0xB9, 0x27, 0xF3, 0xF7, 0x3A, 0xDB,
+    0x61, 0x8B, 0x18, 0x7A, 0x16, 0xA5, 0xA7, 0x1E, 0xBB, 0xD8, 0xC7, 0x6D, 0xDA, 0x24, 0x5E, 0x3F,
+    0xDA, 0xB7, 0x35, 0xD3, 0x24, 0x67, 0x4A, 0xCE, 0x56, 0x45, 0x6E, 0x5D, 0x89, 0x22, 0xA7, 0x4F,
+    0xAF, 0x38, 0x66, 0x68, 0xDB, 0x24, 0x75, 0x4A, 0x5C, 0xDA, 0x65, 0xCE, 0xE6, 0x85, 0x80, 0x9A,
+    0x32, 0x22, 0x52, 0xE9, 0x64, 0x81, 0x2A, 0xCB, 0xB5, 0xFF, 0x2C, 0x85, 0x03, 0x59, 0xDE, 0x99,
+    0x96, 0xA7, 0x33, 0xA7, 0x48, 0x8F, 0xB4, 0x55, 0x41, 0xA1, 0x2E, 0xE5, 0xD3, 0x37, 0xD3, 0xA3,
+    0xE7, 0x90, 0xB8, 0xC7, 0x6F, 0x1B, 0x2B, 0xF3, 0xB8, 0x9D, 0xE4, 0x6F, 0x39, 0xF3, 0x29, 0x63,
+    0x91, 0xB3, 0x95, 0x6F, 0xCE, 0x00, 0xFD, 0x13, 0xC7, 0xB1, 0xEE, 0xA3, 0x2E, 0xEB, 0x65, 0xEE,
+    0x90, 0x2C, 0x9E, 0xBB, 0xF6, 0xE4, 0xBF, 0x3D, 0xF8, 0xEF, 0x96, 0xDE, 0x0C, 0x43, 0x11, 0xFE,
+    0x66, 0x1E, 0xF8, 0xBF, 0xEB, 0x5F, 0x4D, 0x55, 0x31, 0x73, 0xDC, 0x44, 0x14, 0x7E, 0xDA, 0x9D,
+    0x44, 0x0C, 0x2A, 0xD6, 0x4D, 0xAA, 0xCC, 0x44, 0x2D, 0x05, 0x64, 0x29, 0x29, 0xEE, 0x6E, 0x15,
+    0x52, 0x64, 0x26, 0x14, 0xA4, 0x48, 0x2A, 0x0A, 0x9A, 0xF4, 0x6E, 0x53, 0x9C, 0x2D, 0x19, 0x4A,
+    0x8A, 0xA4, 0xC8, 0x0F, 0xA0, 0xA0, 0x82, 0x02, 0x8A, 0x14, 0x29, 0xCE, 0xD6, 0x12, 0x17, 0x29,
+    0xBD, 0x43, 0x8A, 0x14, 0x14, 0x51, 0xA0, 0xA0, 0xA0, 0xC8, 0x0E, 0x23, 0x86, 0xB5, 0x6F, 0xA5,
+    0xC7, 0xB7, 0x92, 0x0D, 0x3E, 0x5B, 0x77, 0x9A, 0xD5, 0xBE, 0xF7, 0xBD, 0xF7, 0xBD, 0x6F, 0x3F,
+    0x51, 0x4B, 0xCA, 0x29, 0x2F, 0x23, 0x71, 0xD5, 0x5A, 0x1D, 0x54, 0x90, 0xFC, 0x35, 0x57, 0x26,
+    0xB6, 0x3E, 0x7F, 0x77, 0xC2, 0x74, 0xC8, 0xDB, 0x4E, 0x9D, 0x8C, 0x47, 0x59, 0xE0, 0x13, 0xA7,
+    0x1F, 0xFF, 0x1D, 0x65, 0xCF, 0xC6, 0xD6, 0xEA, 0x55, 0x28, 0xFC, 0xFD, 0xB6, 0xA2, 0x6B, 0xB4,
+    0xA2, 0x9A, 0xF6, 0xA8, 0xAD, 0x36, 0xC4, 0x4D, 0xCC, 0xF8, 0xE7, 0x5E, 0xF0, 0x0B, 0x2F, 0xB7,
+    0xC7, 0x3E, 0xFF, 0xE7, 0xB5, 0x53, 0x7F, 0xFC, 0x69, 0xD5, 0x2B, 0xB6, 0xFA, 0x18, 0x39, 0x8F,
+    0x99, 0xCC, 0x57, 0x4C, 0xED, 0xAD, 0x91, 0x28, 0x6B, 0x9F, 0x90, 0xE4, 0x91, 0xE4, 0xB0, 0xEB,
+    0x64, 0x9F, 0x21, 0x2D, 0x19, 0x0A, 0xA4, 0xEC, 0x21, 0xC9, 0xCE, 0x90, 0xE8, 0x95, 0xA5, 0x98,
+    0x87, 0xAB, 0x63, 0xC6, 0x8C, 0x50, 0xE6, 0xA6, 0xC0, 0x45, 0xBB, 0x08, 0xBD, 0xF8, 0xE4, 0x6C,
+    0xA9, 0x65, 0x52, 0x4D, 0xC8, 0xFA, 0xA2, 0xD1, 0x02, 0x95, 0x33, 0xD5, 0xEC, 0x0A, 0xEE, 0x69,
+    0x7C, 0x4A, 0xA5, 0x25, 0x11, 0x88, 0x4C, 0x45, 0x79, 0x4F, 0xD4, 0x4E, 0x21, 0xD7, 0x70, 0xB5,
+    0x81, 0x90, 0xB3, 0xC9, 0x86, 0x1C, 0xB0, 0xB4, 0x4F, 0x03, 0x32, 0xEC, 0x53, 0xDE, 0xE9, 0x2A,
+    0x9B, 0x40, 0xA5, 0xDF, 0x59, 0x51, 0x54, 0xED, 0x04, 0xAA, 0x98, 0x2D, 0x76, 0x5B, 0x4A, 0x49,
+    0x81, 0x88, 0x78, 0xEE, 0x66, 0x78, 0x13, 0x48, 0xB3, 0x55, 0x55, 0x2F, 0xED, 0x42, 0xF8, 0x92,
+    0x42, 0xD9, 0x18, 0x34, 0x8A, 0x25, 0xEE, 0xA5, 0x5F, 0x89, 0x58, 0x36, 0x63, 0xE1, 0xCD, 0xED,
+    0xA8, 0x1D, 0xD3, 0x05, 0x7A, 0xC9, 0x56, 0x70, 0xA4, 0xD2, 0xED, 0xD0, 0x86, 0x48, 0x7A, 0x22,
+    0x75, 0x4A, 0xC8, 0xD3, 0xA4, 0x27, 0xA8, 0xAB, 0x22, 0x1A, 0xB3, 0x2E, 0xEF, 0x4B, 0x60, 0x32,
+    0x07, 0x6A, 0xD1, 0x2F, 0xEA, 0x78, 0xC9, 0x1C, 0x5B, 0x94, 0x23, 0x81, 0x7D, 0x88, 0x18, 0x4B,
+    0x14, 0x91, 0xAC, 0x21, 0xD0, 0x06, 0xDE, 0x28, 0x47, 0xA2, 0x23, 0xAC, 0x3B, 0x42, 0x4B, 0x48,
+    0x81, 0x24, 0x91, 0x06, 0x11, 0xC1, 0x6B, 0x10, 0xE0, 0x56, 0xF6, 0xB9, 0x97, 0xBE, 0xE8, 0x72,
+    0xAF, 0x5C, 0xE1, 0x94, 0x4D, 0x7F, 0xDA, 0x02, 0xA4, 0xC2, 0x05, 0xE8, 0x61, 0xEE, 0x8F, 0x52,
+    0xDA, 0xE2, 0xC4, 0x66, 0x61, 0x20, 0x03, 0x59, 0xB8, 0x51, 0xC4, 0xA2, 0xAB, 0xA9, 0x55, 0x5D,
+    0xF1, 0x57, 0xA4, 0xB6, 0xAD, 0x0A, 0xF6, 0x54, 0x47, 0x10, 0xD1, 0x50, 0xED, 0x29, 0x1F, 0xCE,
+    0x47, 0x01, 0x92, 0x29, 0xE2, 0x4B, 0x04, 0x7C, 0x49, 0x6F, 0xAA, 0x7B, 0x45, 0x67, 0x6E, 0x85,
+    0xD2, 0xD6, 0x32, 0x98, 0xA6, 0x56, 0xB1, 0xA6, 0xDA, 0xC4, 0x81, 0xEA, 0x76, 0x44, 0x9A, 0x01,
+    0x58, 0x6D, 0x44, 0xA6, 0xD6, 0xB7, 0x8E, 0x5A, 0xD7, 0x62, 0x8E, 0x16, 0x5A, 0x82, 0x94, 0xCA,
+    0x4A, 0xD9, 0xB2, 0x11, 0x41, 0x35, 0x28, 0xC0, 0x92, 0x7A, 0x83, 0x21, 0x82, 0x18, 0xAA, 0x1D,
+    0xBA, 0x43, 0xF3, 0x0A, 0xED, 0x29, 0x80, 0xAB, 0x77, 0x9E, 0xD4, 0x6F, 0x03, 0x95, 0xDE, 0xD8,
+    0xD2, 0xAB, 0x1E, 0x75, 0x1B, 0x5D, 0xE9, 0x3B, 0x5D, 0x79, 0x10, 0x95, 0x45, 0xA8, 0x7A, 0xE3,
+    0x04, 0x26, 0x85, 0x22, 0x4B, 0x9F, 0x58, 0x4A, 0xBC, 0x40, 0x03, 0x06, 0x44, 0x3B, 0x9A, 0x38,
+    0x4D, 0xB3, 0xC5, 0x1E, 0x94, 0x41, 0xE6, 0xD2, 0x55, 0x03, 0xA5, 0xED, 0xA6, 0x31, 0x67, 0xEC,
+    0x80, 0x7E, 0xF6, 0x1D, 0x31, 0x84, 0x5A, 0x23, 0x42, 0x73, 0x1A, 0x7E, 0x06, 0x7C, 0xD4, 0xBD,
+    0xC2, 0x00, 0x88, 0x0A, 0x4B, 0x69, 0x28, 0x08, 0xDC, 0xA4, 0xFA, 0x49, 0x41, 0x6E, 0xF3, 0x12,
+    0xF8, 0x5C, 0x13, 0xDD, 0xBC, 0x58, 0x12, 0xFE, 0x62, 0x49, 0x63, 0x69, 0x80, 0xF8, 0xE7, 0xCE,
+    0xD2, 0xE7, 0xBD, 0x0F, 0x3E, 0x59, 0xAF, 0x17, 0x8B, 0xC5, 0x72, 0xB9, 0x5A, 0x19, 0xB3, 0x5A,
+    0x7C, 0xBC, 0x83, 0x27, 0x3A, 0x4C, 0x5B, 0x11, 0x9A, 0xE2, 0xFE, 0xBF, 0x5B, 0x5D, 0xBE, 0x2B,
+    0x2E, 0xDF, 0x65, 0xFE, 0xF2, 0xDD, 0x72, 0xCA, 0x0F, 0x02, 0xD4, 0xC5, 0x94, 0x16, 0x54, 0xF8,
+    0x6C, 0xEB, 0x96, 0x45, 0x43, 0xA9, 0x0B, 0x8E, 0x60, 0xE1, 0xE0, 0xC1, 0x83, 0x7B, 0x2B, 0x44,
+    0xED, 0x4F, 0x3B, 0xB2, 0xB1, 0xD3, 0x7C, 0xE0, 0xF7, 0x14, 0xF5, 0xCF, 0xE4, 0x31, 0x8E, 0x39,
+    0x47, 0xCD, 0x9D, 0x7E, 0x53, 0x65, 0x53, 0x1B, 0xEB, 0x94, 0x18, 0xD1, 0xCB, 0x87, 0xC4, 0x31,
+    0x1F, 0x31, 0x5F, 0xBF, 0x91, 0xC7, 0xBE, 0x54, 0x07, 0x01, 0xD2, 0xE7, 0x41, 0x80, 0xB0, 0x7B,
+    0x29, 0x8F, 0x18, 0xC0, 0xDD, 0x3E, 0x0E, 0x16, 0xF6, 0x6B, 0x12, 0xA7, 0x4F, 0x4A, 0xA6, 0x5D,
+    0x70, 0x92, 0x78, 0x59, 0xCC, 0xF5, 0x3F, 0x4F, 0x19, 0xC5, 0x99, 0xCF, 0xC0, 0xED, 0xFE, 0xAE,
+    0x53, 0x55, 0xCC, 0xBA, 0xB2, 0xB9, 0x99, 0xC3, 0x3E, 0x92, 0x22, 0x21, 0x33, 0x08, 0x5A, 0xBB,
+    0x6C, 0xEC, 0xF3, 0xB7, 0x8F, 0x14, 0x87, 0xF2, 0xFB, 0xA7, 0x9A, 0x76, 0x34, 0x7B, 0xC5, 0x9D,
+    0x48, 0xE7, 0x84, 0x92, 0x67, 0x35, 0x25, 0x89, 0x2E, 0x63, 0xAF, 0xC7, 0x6C, 0x80, 0x74, 0xE0,
+    0x20, 0xBA, 0xC2, 0xA9, 0x32, 0x54, 0x00, 0xE9, 0xFA, 0xAF, 0xB6, 0x60, 0x98, 0x43, 0x4B, 0x8B,
+    0xDC, 0xE7, 0xD5, 0x11, 0x3D, 0x2B, 0xB1, 0x10, 0x31, 0xCA, 0x46, 0x00, 0x20, 0x03, 0xA7, 0x85,
+    0x13, 0xDB, 0x00, 0x35, 0xD0, 0x55, 0x0C, 0x15, 0x94, 0xA5, 0xF9, 0x84, 0x44, 0x29, 0x0A, 0x97,
+    0xDB, 0x5E, 0x72, 0x2C, 0xFA, 0xB5, 0xB2, 0x0B, 0xD5, 0xAC, 0x75, 0x15, 0x4C, 0xD6, 0xD7, 0xD2,
+    0x1F, 0x01, 0xE0, 0x7D, 0xB0, 0x2C, 0xBD, 0x88, 0x13, 0x6B, 0x37, 0xD0, 0x89, 0xB4, 0x88, 0x78,
+    0x8E, 0x0C, 0x25, 0x4E, 0x67, 0x3A, 0xD7, 0xF4, 0x30, 0x75, 0x5B, 0x56, 0x33, 0xF5, 0x57, 0x52,
+    0x66, 0xD1, 0x25, 0x12, 0x17, 0xFF, 0xFD, 0x66, 0xDD, 0x4C, 0xEA, 0xF5, 0x0E, 0xE6, 0x2B, 0xC3,
+    0xF9, 0x8C, 0x20, 0x14, 0xA8, 0x7F, 0xFE, 0xBD, 0x5B, 0x2D, 0x83, 0x80, 0x52, 0x7B, 0xAA, 0xE1,
+    0x1B, 0x70, 0x16, 0xBB, 0x5F, 0xBF, 0xE8, 0x51, 0xEA, 0x23, 0x60, 0xF5, 0x99, 0x97, 0x9D, 0xB4,
+    0xB9, 0x55, 0x8D, 0xAA, 0x4A, 0x28, 0x0D, 0x4E, 0x6C, 0xDB, 0x59, 0x52, 0xAA, 0xFD, 0x0C, 0x2C,
+    0x41, 0xB2, 0xE6, 0x76, 0xBF, 0xCE, 0xDD, 0x2A, 0xB7, 0xB1, 0xB0, 0x70, 0xA8, 0xA0, 0x3E, 0xF5,
+    0x5A, 0x78, 0x83, 0x33, 0x5A, 0xB8, 0xC3, 0x3C, 0x59, 0x99, 0x78, 0xD7, 0x49, 0x0E, 0x79, 0xBF,
+    0x29, 0xEC, 0x5A, 0x55, 0xA1, 0xA4, 0xDE, 0x4C, 0x1B, 0x8E, 0x60, 0x2A, 0xE0, 0x1F, 0x8F, 0xBA,
+    0x8D, 0xAA, 0xD6, 0x30, 0x38, 0xFD, 0x05, 0x7C, 0xA9, 0x43, 0x11, 0xE2, 0x74, 0xEE, 0x6A, 0xC5,
+    0x90, 0xD1, 0x8F, 0x50, 0xD5, 0x87, 0x70, 0x80, 0x9F, 0x60, 0x9D, 0x36, 0xF7, 0x37, 0x48, 0x6F,
+    0x7B, 0x9A, 0xFC, 0x1A, 0xC4, 0x5E, 0x83, 0x93, 0xCF, 0x7E, 0x05, 0x81, 0x89, 0x6F, 0xCF, 0x85,
+    0x78, 0xFD, 0x35, 0x7C, 0xB2, 0xBB, 0x01, 0x37, 0x82, 0xC7, 0x57, 0x7B, 0xC2, 0xC1, 0x62, 0x30,
+    0xCA, 0x74, 0x1C, 0x3D, 0x5D, 0xD9, 0x87, 0xF6, 0xD1, 0x7B, 0x4F, 0x57, 0x27, 0xF2, 0xA0, 0x58,
+    0x3D, 0xC8, 0xD3, 0x6A, 0x2F, 0x09, 0x7B, 0x9A, 0x2F, 0xD8, 0x98, 0xD5, 0x8A, 0x98, 0x1F, 0xE8,
+    0x19, 0x65, 0x67, 0x38, 0xB2, 0x30, 0x0C, 0xB9, 0x85, 0xA2, 0xDD, 0x6E, 0x38, 0x47, 0xF9, 0x08,
+    0xB3, 0x28, 0x00, 0xF4, 0x25, 0xBB, 0x0D, 0xB8, 0x51, 0x90, 0x9D, 0x3C, 0x23, 0x76, 0xA6, 0xC7,
+    0x83, 0xF0, 0x5C, 0xFE, 0xE2, 0x34, 0xF0, 0x17, 0xF9, 0x5B, 0x6F, 0xEE, 0x70, 0x84, 0xE4, 0x60,
+    0xC3, 0x4B, 0x5A, 0xC1, 0x19, 0x93, 0x9D, 0x1F, 0x82, 0xD3, 0xC7, 0x8D, 0xC4, 0x11, 0xC2, 0xBF,
+    0xC1, 0xA4, 0xE6, 0x23, 0xE5, 0x7B, 0x52, 0xB7, 0x9D, 0x8F, 0xEA, 0xF3, 0x97, 0x6E, 0xC5, 0x35,
+    0x1A, 0x85, 0x48, 0xD2, 0x64, 0xE0, 0x98, 0x8F, 0x3B, 0x98, 0xE0, 0x39, 0x38, 0xE8, 0xCE, 0x7F,
+    0x87, 0x10, 0x23, 0x09, 0x58, 0xB8, 0xC6, 0x0B, 0x64, 0x24, 0xB1, 0xF5, 0x34, 0xE8, 0xC6, 0xDC,
+    0x82, 0x6C, 0x82, 0x80, 0x21, 0xA7, 0xFA, 0x02, 0x95, 0xDF, 0x00, 0x00, 0xD2, 0x43, 0xEF, 0x02,
+    0x6F, 0x8A, 0x3C, 0xCC, 0x84, 0xED, 0x4D, 0xB6, 0x5E, 0x60, 0x05, 0x05, 0xD3, 0xF4, 0xDE, 0xC3,
+    0xC9, 0xC0, 0x39, 0x4B, 0xBE, 0xAF, 0xAB, 0xC4, 0xC1, 0x08, 0x0A, 0xEE, 0x63, 0xB5, 0x6A, 0x93,
+    0x2F, 0xE5, 0x91, 0x74, 0x7A, 0x8B, 0xA6, 0xC8, 0x4D, 0x72, 0xF2, 0xAC, 0x4F, 0x44, 0x1A, 0x3B,
+    0xC1, 0xDB, 0x94, 0x14, 0xC2, 0x82, 0x22, 0xB1, 0x0B, 0xA6, 0x98, 0x4D, 0xD3, 0xF8, 0x17, 0x9D,
+    0x55, 0x3D, 0x8C, 0x15, 0x55, 0x18, 0x3D, 0x73, 0x2F, 0x30, 0xCA, 0x2C, 0x5C, 0x0A, 0x62, 0x10,
+    0xC5, 0xA1, 0x31, 0x01, 0xA3, 0x4C, 0xB3, 0xC5, 0x16, 0x6F, 0xDF, 0x8C, 0x6C, 0x61, 0xA1, 0x09,
+    0x5B, 0x68, 0x63, 0x65, 0x61, 0x61, 0x61, 0x22, 0x05, 0x31, 0x12, 0x97, 0x7D, 0x03, 0x16, 0x24,
+    0x52, 0xB0, 0x16, 0x76, 0x16, 0x6B, 0xC4, 0x84, 0xAC, 0x89, 0x6C, 0xB9, 0xC5, 0xC2, 0xBB, 0xB8,
+    0x05, 0x05, 0x05, 0xA3, 0x6B, 0xAD, 0x03, 0x84, 0x18, 0x50, 0xC3, 0x95, 0x0C, 0x3A, 0x84, 0x99,
+    0x77, 0x3D, 0xDF, 0xBC, 0x5D, 0x02, 0x74, 0x3A, 0x79, 0x79, 0x33, 0xF3, 0xDE, 0xBD, 0xE7, 0x3B,
+    0xE7, 0x7C, 0x3F, 0x17, 0x08, 0x4A, 0x93, 0xF5, 0x82, 0x32, 0xE2, 0x97, 0x8B, 0xF2, 0x1E, 0x5C,
+    0x98, 0xBF, 0x36, 0xFE, 0x42, 0x5C, 0x62, 0x58, 0x20, 0x05, 0x1A, 0xE8, 0x12, 0x71, 0x86, 0x8B,
+    0x50, 0x23, 0x84, 0x15, 0xD2, 0x5C, 0x39, 0x98, 0x1C, 0x27, 0xA0, 0x5C, 0xE0, 0xF3, 0xA8, 0xC6,
+    0x41, 0xE0, 0xD9, 0x3D, 0xE9, 0x87, 0x1F, 0xD7, 0xFB, 0x17, 0xB0, 0x84, 0x81, 0x8D, 0x8B, 0xC8,
+    0xA9, 0x1A, 0x8F, 0xAE, 0xA3, 0x58, 0x45, 0x9F, 0x10, 0xA1, 0xE5, 0xCE, 0x1A, 0xD3, 0x30, 0x08,
+    0x6D, 0x50, 0x62, 0xA1, 0xFB, 0x57, 0x67, 0x5C, 0x10, 0x42, 0xB5, 0xCA, 0x17, 0x83, 0x9F, 0xCD,
+    0x57, 0xC1, 0x3D, 0x9B, 0x4C, 0xA9, 0x7F, 0xF2, 0xD8, 0x63, 0x50, 0x62, 0x11, 0x3B, 0x81, 0x6C,
+    0x8C, 0x33, 0xCC, 0x94, 0xAF, 0x82, 0xEA, 0x79, 0x1C, 0x03, 0xF6, 0x01, 0x61, 0x8E, 0xD8, 0x97,
+    0x91, 0xAF, 0x11, 0x03, 0x91, 0x45, 0x42, 0xBA, 0x7E, 0xD1, 0xF8, 0x56, 0x2D, 0x2D, 0x75, 0x3B,
+    0xF2, 0x29, 0xED, 0x1B, 0xED, 0x2B, 0x7D, 0xC3, 0x45, 0x6B, 0xCE, 0xF8, 0x22, 0xF5, 0x2E, 0xF5,
+    0xE5, 0xEE, 0x20, 0xD3, 0x4E, 0xB9, 0xA8, 0x4C, 0x61, 0xD6, 0x1D, 0x12, 0x0F, 0x0C, 0x1C, 0xC0,
+    0x9B, 0xF2, 0x19, 0xFC, 0x08, 0x86, 0x8F, 0x01, 0xF9, 0x47, 0x2D, 0x34, 0xD1, 0xD3, 0x86, 0xB1,
+    0x4A, 0x20, 0xD9, 0xA0, 0x71, 0x54, 0xDB, 0x1D, 0x58, 0xD6, 0x76, 0x8B, 0xBC, 0x6C, 0xC7, 0x31,
+    0x65, 0x0D, 0x26, 0x95, 0xDD, 0x2A, 0xAF, 0x97, 0x20, 0xCB, 0xA3, 0xC3, 0x19, 0x1E, 0xD0, 0xC2,
+    0x16, 0xE6, 0xAE, 0xA3, 0xBD, 0x38, 0xF4, 0x8E, 0x53, 0xBE, 0x45, 0x28, 0x31, 0x1C, 0xCE, 0x1D,
+    0x62, 0x50, 0x1B, 0x0C, 0x17, 0xB0, 0x77, 0xFB, 0x91, 0x2B, 0xBF, 0xDD, 0xFB, 0xBB, 0x69, 0x83,
+    0x16, 0xC7, 0x97, 0xCD, 0x37, 0xA7, 0xDC, 0x64, 0x72, 0x35, 0xF8, 0xBD, 0x90, 0x70, 0xB8, 0x74,
+    0x60, 0x7D, 0xC7, 0xA7, 0x6B, 0x7F, 0x08, 0xEC, 0x33, 0x0A, 0x9F, 0xEC, 0x53, 0x6E, 0xD5, 0x9C,
+    0x2E, 0xFA, 0x26, 0x4F, 0x8F, 0x58, 0xB3, 0xE6, 0xC2, 0x93, 0x85, 0x42, 0x9E, 0xDC, 0x9E, 0xF1,
+    0xED, 0x73, 0x17, 0x2C, 0x2D, 0x66, 0x4E, 0xCE, 0x25, 0xFE, 0x26, 0xF5, 0xD7, 0xFA, 0xE1, 0x0F,
+    0xB7, 0x8E, 0xDE, 0x7D, 0x71, 0xFA, 0x17, 0x33, 0x14, 0x4A, 0x64, 0xF2, 0xCA, 0xB7, 0xBC, 0xBD,
+    0x50, 0x90, 0x41, 0xB5, 0x92, 0x98, 0xC3, 0x0F, 0x1D, 0xC9, 0xCD, 0xF3, 0xA7, 0x45, 0x60, 0x05,
+    0x4C, 0x49, 0xE4, 0x1B, 0x75, 0xE1, 0x36, 0x74, 0x81, 0xC0, 0x6D, 0xA4, 0x6D, 0x9B, 0x77, 0xA1,
+    0x6F, 0xE4, 0x29, 0x3E, 0xF9, 0x56, 0x60, 0x8F, 0x4D, 0x47, 0x15, 0x18, 0x64, 0x22, 0xB8, 0x5C,
+    0xE9, 0x33, 0xEE, 0x7D, 0x04, 0x7A, 0xED, 0xA7, 0x12, 0x73, 0xBA, 0x8C, 0xF2, 0x69, 0x54, 0x11,
+    0x5D, 0x68, 0x94, 0x8B, 0xF3, 0x54, 0x57, 0xA1, 0xF7, 0x18, 0x7A, 0x67, 0x86, 0x23, 0x55, 0x00,
+    0xBD, 0x0D, 0xBC, 0xE4, 0x5A, 0x96, 0xDE, 0xB4, 0xC9, 0x7D, 0x67, 0x9A, 0x15, 0x3D, 0x9A, 0xC6,
+    0xE0, 0x08, 0xCC, 0x15, 0x1B, 0xDE, 0x28, 0x75, 0x55, 0x05, 0x4D, 0x0F, 0xA3, 0x18, 0x83, 0x37,
+    0xF3, 0x74, 0xAD, 0x30, 0xA5, 0x0B, 0x66, 0x77, 0xC3, 0x9C, 0x59, 0xBF, 0x7F, 0x3E, 0xC0, 0xB2,
+    0x79, 0x7D, 0x2E, 0x3D, 0xB5, 0xB0, 0x4D, 0xDB, 0xC5, 0xC9, 0x89, 0xE4, 0xF2, 0x2C, 0x81, 0xD4,
+    0xE7, 0x13, 0x53, 0xA9, 0xBD, 0x28, 0xA0, 0xFB, 0xB7, 0xA0, 0xB7, 0x13, 0xF1, 0x1B, 0x85, 0x72,
+    0x35, 0xEA, 0xBE, 0xAA, 0x2F, 0xE9, 0xBF, 0x6A, 0x6D, 0x5D, 0x90, 0x65, 0xD8, 0x25, 0x41, 0xD1,
+    0x59, 0x1E, 0x5A, 0x96, 0x91, 0x0B, 0x0A, 0x92, 0xE9, 0xC1, 0x64, 0xDA, 0xAA, 0x52, 0xFB, 0x6C,
+    0x75, 0x32, 0x75, 0xB1, 0x61, 0x76, 0xD7, 0xA8, 0xB9, 0xFA, 0x15, 0xE8, 0x4F, 0x95, 0x30, 0xD7,
+    0x7C, 0xA6, 0xDC, 0xD0, 0xD1, 0xD1, 0x9E, 0x14, 0x6D, 0x1E, 0xCC, 0x4A, 0x20, 0x01, 0x63, 0x91,
+    0x05, 0x82, 0x38, 0x87, 0x29, 0x68, 0xDB, 0xA1, 0x19, 0xB1, 0xAC, 0xC7, 0xF2, 0x36, 0xAD, 0x2A,
+    0x67, 0x53, 0x97, 0x24, 0x15, 0x1D, 0xFC, 0x42, 0x3A, 0x26, 0xCC, 0x50, 0x71, 0xA9, 0xC9, 0xB9,
+    0xAD, 0x09, 0x58, 0x15, 0xD6, 0xB4, 0x04, 0x1D, 0x8E, 0xFD, 0x55, 0x2D, 0xBF, 0x5E, 0x5E, 0x96,
+    0x05, 0xAC, 0xDF, 0xC4, 0x6A, 0xAB, 0x1B, 0x38, 0xCC, 0xD8, 0x69, 0x24, 0xB5, 0x99, 0x99, 0xF1,
+    0xBA, 0xE4, 0xC2, 0x15, 0x36, 0x60, 0x32, 0x51, 0x22, 0x5A, 0xFB, 0x9E, 0xB0, 0xBE, 0xC2, 0x89,
+    0xAD, 0xF3, 0x5D, 0x27, 0x8D, 0x49, 0x61, 0x24, 0xFD, 0x29, 0x9F, 0x73, 0x9B, 0xCD, 0xB6, 0x00,
+    0x53, 0x20, 0x66, 0x37, 0xE4, 0xF0, 0x59, 0xD8, 0xCA, 0x5B, 0x22, 0x09, 0x96, 0x34, 0xCC, 0x21,
+    0x9B, 0x0E, 0x0B, 0xD6, 0x5E, 0xF8, 0x60, 0xBC, 0x78, 0x8E, 0xED, 0xC7, 0x28, 0x5C, 0xB3, 0x71,
+    0xD1, 0x2A, 0x0C, 0xF8, 0x43, 0xD5, 0xF5, 0xC2, 0x5C, 0x0D, 0x73, 0x96, 0xED, 0xDE, 0x60, 0xDE,
+    0x58, 0x63, 0x1B, 0xE5, 0xBD, 0x1D, 0xF8, 0xD6, 0x78, 0xBF, 0x5E, 0x63, 0x34, 0x80, 0x91, 0x32,
+    0xDD, 0xCD, 0x5D, 0x16, 0x78, 0x89, 0x8F, 0x0E, 0x4F, 0x5F, 0x0C, 0x4D, 0xE5, 0x82, 0x27, 0xD3,
+    0x24, 0xBC, 0x96, 0xA3, 0xDF, 0x87, 0x00, 0xC6, 0x9F, 0x39, 0x34, 0xC6, 0x46, 0xAC, 0x14, 0x22,
+    0x6A, 0xEF, 0xAB, 0x34, 0x37, 0xD7, 0x1B, 0x4E, 0x97, 0x31, 0x0F, 0x22, 0x0B, 0xBA, 0x77, 0x88,
+    0x4E, 0xBA, 0x47, 0xD4, 0xA8, 0x8B, 0xAA, 0xA4, 0x31, 0x85, 0x9B, 0xBE, 0x59, 0x22, 0x31, 0x36,
+    0xA8, 0xD9, 0xC8, 0xB6, 0x91, 0x8A, 0x63, 0xE1, 0xB1, 0xC9, 0xFD, 0x0C, 0xD9, 0xC5, 0x56, 0xB3,
+    0x85, 0xE3, 0x57, 0x81, 0x96, 0xF6, 0xA5, 0x19, 0xF6, 0x1C, 0x18, 0x53, 0x5A, 0x65, 0xBE, 0x09,
+    0x95, 0x16, 0x9D, 0xC4, 0xB8, 0x0F, 0xD4, 0x35, 0xFD, 0x75, 0xA2, 0x51, 0xBB, 0x94, 0xAD, 0xD9,
+    0x04, 0xA4, 0x43, 0x91, 0xC5, 0x08, 0xE9, 0x69, 0x27, 0x1E, 0xE3, 0xE0, 0x5E, 0xE0, 0xA2, 0x0C,
+    0xC3, 0x79, 0xEA, 0x19, 0x3D, 0xA1, 0x4F, 0xFC, 0x12, 0x52, 0x82, 0x26, 0x02, 0xE9, 0x98, 0xB0,
+    0x12, 0x38, 0x51, 0x28, 0x9E, 0x09, 0x2D, 0xC1, 0xA3, 0xC4, 0x72, 0xEC, 0x1A, 0x8B, 0x06, 0xA9,
+    0xED, 0xF2, 0x27, 0x52, 0x1F, 0x73, 0xFF, 0x3F, 0x4B, 0x0C, 0xBE, 0xF3, 0xB2, 0xCD, 0x7B, 0x3A,
+    0xE7, 0xEF, 0xBC, 0x8D, 0x6E, 0x7C, 0x11, 0x59, 0x06, 0x70, 0x74, 0xF5, 0x16, 0x1B, 0xFC, 0x44,
+    0xCA, 0xFF, 0xC2, 0x92, 0x03, 0x08, 0xA9, 0x48, 0xA7, 0xDB, 0x0C, 0x42, 0x90, 0xA5, 0x9C, 0xEC,
+    0x98, 0x81, 0xC4, 0x8A, 0xE8, 0x06, 0xDE, 0x3F, 0x91, 0xC1, 0x60, 0x58, 0x32, 0x39, 0x39, 0x47,
+    0x03, 0x86, 0x0B, 0xBB, 0x38, 0xFA, 0x41, 0x1B, 0x55, 0x33, 0xCE, 0x0C, 0x13, 0x15, 0xF8, 0xEC,
+    0x3D, 0xC1, 0x32, 0x9C, 0x99, 0x31, 0x6B, 0x33, 0xF1, 0x05, 0x74, 0x3E, 0x1E, 0x94, 0x7F, 0x8E,
+    0x67, 0xA6, 0x9C, 0x1D, 0x88, 0xF3, 0x6E, 0x30, 0x6E, 0x4E, 0x95, 0x16, 0xB2, 0xE7, 0xF6, 0xAC,
+    0xA8, 0xA5, 0xA5, 0xFA, 0xFE, 0x22, 0xA3, 0x70, 0x00, 0x95, 0x52, 0xC7, 0x5C, 0xAB, 0x46, 0x4B,
+    0x24, 0xB7, 0x39, 0x44, 0x04, 0xC3, 0x76, 0xA5, 0x75, 0x88, 0x8C, 0xB2, 0xA7, 0xEA, 0xEB, 0x23,
+    0x31, 0xB6, 0xC1, 0xE8, 0x4B, 0xC9, 0x84, 0x94, 0x72, 0xFA, 0x2E, 0xA7, 0xAC, 0xC3, 0x90, 0x53,
+    0xDC, 0x76, 0x43, 0x3C, 0xB9, 0xB3, 0x48, 0x8E, 0xD9, 0xC0, 0x3B, 0xA9, 0xB5, 0x8E, 0x1F, 0xB9,
+    0xC4, 0x3C, 0xD5, 0x7E, 0xAC, 0xFE, 0x3F, 0xCA, 0x75, 0x87, 0xF8, 0xAC, 0x45, 0x3B, 0x80, 0xFA,
+    0xFA, 0xFC, 0xE3, 0xD2, 0x78, 0xC4, 0x08, 0x4E, 0x64, 0x3B, 0x6D, 0x68, 0x3F, 0xE8, 0x80, 0x12,
+    0x26, 0x60, 0xF3, 0x14, 0xB9, 0xB3, 0x48, 0xFD, 0x85, 0xA8, 0xA3, 0xE9, 0x08, 0x2A, 0x44, 0xC5,
+    0xA3, 0xA3, 0x45, 0x5A, 0x99, 0xD9, 0xA6, 0x95, 0x42, 0xA3, 0x8F, 0xB0, 0x90, 0xB9, 0x6E, 0x79,
+    0x68, 0x26, 0xB9, 0xAE, 0x58, 0x69, 0x92, 0x3E, 0xCC, 0x82, 0xA3, 0xA5, 0xD7, 0xD5, 0xD0, 0xE3,
+    0x17, 0x77, 0x70, 0xA9, 0x1C, 0xCB, 0x72, 0xEF, 0x77, 0xD0, 0x56, 0x58, 0xB0, 0xBC, 0x4B, 0xA6,
+    0x8E, 0x09, 0x0E, 0x9F, 0xC8, 0xEF, 0xBF, 0xAD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0x33,
+    0x43, 0x6E, 0x84, 0x5C, 0x0C, 0x45, 0xA2, 0x48, 0x89, 0x14, 0xB7, 0x44, 0xE2, 0xE2, 0x96, 0x62,
+    0x59, 0x9B, 0x8A, 0x22, 0x45, 0x52, 0xD0, 0xE5, 0x1F, 0xB8, 0x02, 0xE9, 0x4A, 0x52, 0xE4, 0xD6,
+    0x4E, 0xFE, 0x82, 0x2B, 0xF8, 0x03, 0x28, 0xAE, 0x00, 0x1A, 0x24, 0x44, 0x71, 0xC5, 0x6D, 0x3C,
+    0xB9, 0x2B, 0x28, 0x10, 0x92, 0x49, 0x24, 0x52, 0x20, 0x81, 0x41, 0x48, 0x48, 0x20, 0x71, 0x03,
+    0x99, 0x70, 0x3E, 0xCE, 0xF6, 0xE3, 0x1B, 0xAF, 0xF7, 0x60, 0x95, 0xA0, 0x20, 0xE5, 0xDE, 0xEE,
+    0xC8, 0x5A, 0xEF, 0x7B, 0xDF, 0x7B, 0xEF, 0x7B, 0x3F, 0x86, 0x88, 0xB4, 0xA5, 0xB4, 0x90, 0x27,
+    0x36, 0x56, 0x15, 0x0D, 0x92, 0x12, 0xB5, 0xA4, 0x2B, 0x4A, 0xC2, 0x53, 0xD5, 0x14, 0x67, 0xB4,
+    0x47, 0xCA, 0x91, 0x29, 0xE8, 0x3E, 0x29, 0x4F, 0xB1, 0xA5, 0x1C, 0x6A, 0x3B, 0x1B, 0xA2, 0x69,
+    0x95, 0x6F, 0xD5, 0x9F, 0x2D, 0x9D, 0x4A, 0x1B, 0xBE, 0xC2, 0x93, 0x74, 0xC1, 0x02, 0xC6, 0xC0,
+    0x89, 0x2C, 0x19, 0x1B, 0xAC, 0x93, 0x82, 0xD2, 0x2C, 0xD8, 0x06, 0xF3, 0x94, 0x0B, 0x8A, 0xB9,
+    0xA3, 0x88, 0xD9, 0x2A, 0xA7, 0xBC, 0x68, 0x69, 0x4A, 0x73, 0x32, 0xD7, 0xB9, 0xD5, 0x8F, 0xB8,
+    0x97, 0x4E, 0xD7, 0xA2, 0x91, 0x5E, 0x77, 0xC4, 0xCC, 0xD0, 0x66, 0x68, 0x73, 0x16, 0xF1, 0x71,
+    0x70, 0x73, 0xED, 0x4D, 0x80, 0x78, 0xA2, 0xCF, 0xEA, 0x53, 0xCF, 0x17, 0x60, 0x9E, 0xD3, 0x16,
+    0x95, 0xD9, 0x1E, 0x71, 0xD1, 0x0A, 0x7E, 0xE0, 0x25, 0xEF, 0x3B, 0x75, 0x72, 0xE0, 0xF4, 0xD1,
+    0xE3, 0xCA, 0xFC, 0xFC, 0xAB, 0x35, 0x8F, 0xD8, 0x26, 0x07, 0x9C, 0xA5, 0x07, 0x00, 0xBC, 0xC7,
+    0x54, 0xBE, 0xDD, 0xC3, 0xF0, 0x0E, 0x0E, 0xE2, 0x1B, 0x62, 0x3F, 0x95, 0xCD, 0x9F, 0x08, 0x7E,
+    0x0B, 0xE2, 0x5B, 0x9E, 0x3A, 0xE0, 0x76, 0x50, 0x99, 0x22, 0xA5, 0x24, 0xA3, 0x06, 0xCA, 0x73,
+    0x24, 0x97, 0x8A, 0x5E, 0x94, 0x45, 0xCE, 0x5C, 0x19, 0xE6, 0x5A, 0xE2, 0xD0, 0x65, 0x58, 0x8C,
+    0x72, 0x1E, 0xE7, 0x0D, 0x9C, 0x2B, 0x01, 0x9D, 0x9E, 0x15, 0x51, 0x6E, 0x93, 0xE2, 0x9E, 0x54,
+    0xB7, 0x59, 0x85, 0xE4, 0xC1, 0x6B, 0x4A, 0x0D, 0xBC, 0xCC, 0xC1, 0x5A, 0x4A, 0xD2, 0xC3, 0x4B,
+    0xAB, 0x9B, 0xB5, 0x5E, 0x20, 0xFD, 0x0C, 0xE9, 0x17, 0x51, 0x88, 0x67, 0xB3, 0xFF, 0x37, 0xC8,
+    0xB5, 0x00, 0x0E, 0x0A, 0x0C, 0x13, 0x45, 0x77, 0xDD, 0xE2, 0xE5, 0xE5, 0xE3, 0x40, 0x6E, 0x4D,
+    0xE9, 0x37, 0x1D, 0xE8, 0x8E, 0x6D, 0x9A, 0x29, 0x07, 0xF2, 0xDB, 0xA8, 0xA2, 0x29, 0xC2, 0x4E,
+    0xB2, 0x16, 0x5E, 0xF2, 0x62, 0xB3, 0x06, 0x9F, 0x5E, 0x31, 0x37, 0x54, 0xE2, 0xAC, 0xF1, 0x29,
+    0x95, 0x57, 0x10, 0xB7, 0xF9, 0x0E, 0x88, 0x28, 0x96, 0xB8, 0x97, 0x9D, 0x0D, 0x21, 0x57, 0x2F,
+    0x11, 0x25, 0x37, 0xD0, 0x06, 0x5F, 0xA0, 0x27, 0x9E, 0x34, 0xFF, 0xE4, 0xF0, 0x92, 0xE1, 0xAA,
+    0x1F, 0x9D, 0x66, 0x32, 0x8E, 0xCA, 0xCA, 0x1C, 0xDA, 0x77, 0x2F, 0x8C, 0xE1, 0xD2, 0xA5, 0xD1,
+    0x71, 0x34, 0xB2, 0x22, 0x97, 0xD5, 0x2D, 0xC7, 0x67, 0x62, 0xFF, 0x43, 0x21, 0x1F, 0xEB, 0xF3,
+    0xE9, 0x62, 0x1C, 0xE0, 0x75, 0x31, 0x15, 0x8F, 0x17, 0xD4, 0x9B, 0xAA, 0x1C, 0x5C, 0x2B, 0x9F,
+    0xF0, 0xF0, 0x62, 0x1A, 0x1D, 0x0D, 0x10, 0xD1, 0xC3, 0x6E, 0xBA, 0x98, 0x81, 0x32, 0x1A, 0x4C,
+    0x0D, 0xDB, 0x01, 0x53, 0xF0, 0xD3, 0x72, 0x88, 0x26, 0x5E, 0x62, 0x31, 0x2F, 0xB0, 0x42, 0x59,
+    0x17, 0x9A, 0x8B, 0xA7, 0x5A, 0x56, 0x77, 0x49, 0x5B, 0x32, 0x66, 0x19, 0x8D, 0x84, 0xC9, 0xA5,
+    0xC2, 0xFD, 0x31, 0xCF, 0xAB, 0xCF, 0x76, 0x56, 0x50, 0x9D, 0x05, 0xDB, 0x62, 0xE5, 0x75, 0x4F,
+    0x3D, 0x46, 0xAC, 0x93, 0x2D, 0x7A, 0xAD, 0x91, 0xE8, 0x37, 0xE5, 0xB5, 0x53, 0x2E, 0xAA, 0xB5,
+    0x33, 0x55, 0x54, 0x19, 0x1B, 0x3E, 0x89, 0x0D, 0x43, 0x16, 0x0F, 0xC3, 0x16, 0x46, 0xD3, 0x2F,
+    0xAD, 0x6F, 0x22, 0x0D, 0xC4, 0xA2, 0x40, 0x9A, 0xC9, 0xE8, 0x79, 0xF2, 0x72, 0xF8, 0x10, 0xB7,
+    0xA8, 0x81, 0x3E, 0xCC, 0xC8, 0xC8, 0xFA, 0x6C, 0x70, 0x37, 0x5E, 0x07, 0x1F, 0x73, 0x92, 0x0D,
+    0x16, 0xD9, 0xD3, 0xF6, 0xEC, 0xE2, 0x3D, 0x3F, 0x0C, 0x37, 0xC6, 0x2F, 0x7E, 0x1E, 0x15, 0xC6,
+    0xAA, 0x3F, 0xBC, 0xF4, 0x33, 0xD1, 0xC4, 0xB6, 0x55, 0x0E, 0x5E, 0x3A, 0x4A, 0x7A, 0x42, 0x9F,
+    0x0A, 0xB4, 0x0C, 0xA6, 0x0A, 0x1B, 0x14, 0x6D, 0xA7, 0x1A, 0x12, 0xDD, 0xC0, 0x2D, 0x68, 0x05,
+    0xAB, 0x79, 0x25, 0xB9, 0x36, 0xEF, 0xD8, 0x89, 0x11, 0x75, 0x1B, 0x1D, 0xDA, 0xB4, 0x15, 0x3D,
+    0x45, 0x05, 0x4D, 0x88, 0x3E, 0x84, 0x9A, 0xC6, 0x76, 0xC0, 0x16, 0xB0, 0x4E, 0x7D, 0xBD, 0x27,
+    0x7E, 0xEF, 0x68, 0xD7, 0xD1, 0x74, 0x42, 0xF1, 0x8D, 0x22, 0xDA, 0x6F, 0x30, 0x87, 0xA2, 0xD5,
+    0xB6, 0x64, 0x97, 0xB2, 0x3B, 0x77, 0x6B, 0x7B, 0x58, 0xE2, 0xE9, 0xB2, 0x97, 0x49, 0xF4, 0x75,
+    0xC2, 0x77, 0xDD, 0x96, 0x21, 0xFF, 0xB9, 0x3A, 0xB0, 0xB9, 0xE1, 0x36, 0xE1, 0x3A, 0xF9, 0x3E,
+    0x1B, 0xD2, 0xB8, 0x1D, 0xB8, 0x17, 0x37, 0x57, 0x52, 0xC8, 0x77, 0x25, 0x37, 0xFA, 0x81, 0x87,
+    0xC5, 0x3A, 0xB9, 0x89, 0x0E, 0xB8, 0x30, 0x89, 0x8E, 0xAA, 0x10, 0x0E, 0x60, 0xB9, 0x52, 0xF5,
+    0xEE, 0x8B, 0x95, 0xD7, 0x5E, 0xA5, 0xF8, 0x2B, 0x5A, 0x6F, 0x69, 0xF2, 0x3F, 0x94, 0x13, 0x53,
+    0x98, 0x2F, 0x2B, 0xFD, 0xC4, 0xCB, 0x9D, 0x8F, 0x46, 0x6D, 0x7D, 0x82, 0xBD, 0x57, 0x43, 0x5D,
+    0xD9, 0xB7, 0x64, 0x65, 0xC8, 0x61, 0x41, 0xB0, 0x8B, 0xC2, 0x16, 0xD8, 0xC2, 0xDF, 0x19, 0x61,
+    0xD4, 0xDE, 0xCF, 0x50, 0x48, 0x39, 0x5E, 0x5E, 0xF1, 0x6F, 0x80, 0x8F, 0x75, 0xE5, 0xCC, 0xF5,
+    0x6C, 0x02, 0x74, 0xE6, 0x7D, 0x5C, 0x26, 0x9D, 0x1F, 0xD1, 0xBE, 0x0D, 0x7B, 0x89, 0xED, 0x9D,
+    0xD8, 0xBF, 0x67, 0x30, 0x86, 0x0F, 0x2B, 0xF3, 0xCB, 0xCE, 0x44, 0x7B, 0xAC, 0x62, 0xCC, 0x66,
+    0x12, 0x6E, 0x9A, 0x72, 0xC6, 0xDB, 0x61, 0xD2, 0x3A, 0xC1, 0xD5, 0x0C, 0xB7, 0x96, 0xC0, 0x0E,
+    0x22, 0x79, 0xBC, 0x1D, 0x33, 0xE5, 0x35, 0x7E, 0x5C, 0xCC, 0xB4, 0xA3, 0x8D, 0x61, 0x0C, 0xE0,
+    0x5B, 0xFA, 0x15, 0xDA, 0x92, 0x4A, 0xF4, 0x5E, 0xFF, 0x70, 0xDB, 0x20, 0x86, 0x4F, 0x3E, 0x48,
+    0xE8, 0xB5, 0x84, 0x9D, 0x09, 0xBB, 0x10, 0x4C, 0x9F, 0x83, 0xFF, 0x2C, 0x94, 0x7A, 0x79, 0xCF,
+    0xAE, 0x8A, 0xEC, 0x10, 0x5E, 0x05, 0x5B, 0xDC, 0x0A, 0xE2, 0xAF, 0x8F, 0x71, 0x8B, 0x65, 0x30,
+    0x56, 0xC8, 0x34, 0x19, 0x83, 0x87, 0x25, 0xF2, 0x3C, 0xB1, 0xC2, 0xAD, 0xAF, 0xB8, 0xA4, 0x7C,
+    0x4E, 0xB3, 0x8B, 0x05, 0x96, 0x28, 0x7C, 0x46, 0xF6, 0x15, 0x39, 0xDC, 0x97, 0xC5, 0xE0, 0xF4,
+    0x45, 0xF2, 0x37, 0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0x33, 0x83, 0xCE, 0xD2, 0xB9,
+    0x98, 0x34, 0x50, 0x80, 0x74, 0xD3, 0xD2, 0xDC, 0xFA, 0x0F, 0xEC, 0x9E, 0x47, 0x69, 0x28, 0x28,
+    0x68, 0xE8, 0xD2, 0x52, 0xD0, 0x5D, 0x9B, 0x62, 0x73, 0x36, 0x4A, 0x41, 0x81, 0x04, 0x29, 0x68,
+    0xA8, 0x88, 0xD0, 0x15, 0x40, 0xDA, 0x2B, 0xAE, 0xD8, 0xB0, 0x13, 0xAE, 0x48, 0x99, 0x11, 0xD4,
+    0x88, 0x09, 0x42, 0x50, 0x32, 0xE2, 0xAC, 0xE0, 0xD3, 0x79, 0x3D, 0x7C, 0xCF, 0x76, 0xF6, 0x38,
+    0x41, 0x40, 0x08, 0xBC, 0x6B, 0x69, 0x77, 0xFC, 0xE6, 0x9B, 0xEF, 0x7D, 0xEF, 0x7B, 0xCF, 0xB4,
+    0x7B, 0xB3, 0x16, 0xED, 0x8A, 0x8A, 0xB7, 0x9C, 0x7A, 0xD6, 0xD1, 0xF5, 0xAB, 0xF0, 0x64, 0x7E,
+    0xB1, 0xD9, 0xD3, 0xDB, 0x94, 0x52, 0x6D, 0xBE, 0xFC, 0x58, 0x46, 0x41, 0x45, 0x8A, 0x94, 0x7A,
+    0x92, 0xC9, 0x52, 0xEE, 0x54, 0xA4, 0x61, 0x8F, 0x08, 0xCA, 0x2B, 0x97, 0xB9, 0xBC, 0xD6, 0xD6,
+    0x50, 0x89, 0x0F, 0x09, 0xAB, 0x9C, 0x0C, 0x22, 0x6E, 0xC1, 0x44, 0xA0, 0x86, 0xE6, 0x64, 0x28,
+    0xAF, 0x95, 0x17, 0xBC, 0xB1, 0x1C, 0xD6, 0xF7, 0x29, 0x6B, 0xE8, 0x32, 0xCC, 0x32, 0x87, 0x3F,
+    0xB7, 0x49, 0x5B, 0x8A, 0x08, 0x92, 0x81, 0x16, 0x84, 0xA5, 0x8E, 0xB4, 0xA3, 0xEC, 0xB1, 0xEB,
+    0x3A, 0xF3, 0x69, 0x3D, 0xC4, 0xEF, 0x91, 0xF2, 0xC0, 0xC1, 0xB3, 0x53, 0x04, 0x03, 0xA8, 0x24,
+    0xF5, 0xFC, 0x94, 0x05, 0xEE, 0x35, 0x6E, 0x80, 0x64, 0xA9, 0xA3, 0x1C, 0x37, 0xCD, 0x48, 0xA4,
+    0xF9, 0xF0, 0xD3, 0xDC, 0x6D, 0xA8, 0x94, 0x91, 0x16, 0x2A, 0xD0, 0x51, 0xEE, 0xA8, 0x42, 0x0E,
+    0x65, 0x4F, 0x94, 0x37, 0xD8, 0x22, 0xBF, 0xB5, 0x72, 0xE3, 0xE9, 0x3C, 0xD2, 0xEB, 0xEF, 0x4C,
+    0x68, 0xB3, 0x9E, 0x74, 0x0A, 0x59, 0xB3, 0x92, 0xD1, 0x50, 0xA3, 0xEB, 0xA5, 0xF2, 0xD8, 0xAE,
+    0x5D, 0x97, 0x87, 0x8A, 0x71, 0x07, 0x6A, 0x71, 0xAB, 0x95, 0x48, 0x6D, 0x16, 0x56, 0xDA, 0x2E,
+    0x0D, 0xB5, 0xC5, 0xAD, 0xC6, 0xA4, 0xA0, 0x93, 0x93, 0x17, 0x78, 0xF6, 0x12, 0x81, 0x30, 0x9D,
+    0xB0, 0x04, 0xD7, 0xE5, 0x7D, 0xF1, 0x96, 0x21, 0x97, 0xCA, 0x42, 0x18, 0xE5, 0x57, 0xFF, 0x10,
+    0x9C, 0x7F, 0x48, 0xE6, 0x3B, 0x9A, 0x77, 0x13, 0xF3, 0xBF, 0x89, 0x7C, 0x75, 0xD7, 0xEA, 0xC7,
+    0x21, 0x3B, 0x6F, 0x64, 0xB7, 0x99, 0x48, 0xC8, 0x0D, 0xA4, 0x0A, 0x08, 0x57, 0xDE, 0x88, 0xA8,
+    0xEB, 0x87, 0x87, 0x1E, 0xF1, 0x0A, 0x55, 0x2E, 0xEE, 0x11, 0xED, 0x42, 0x48, 0x4F, 0xAA, 0x21,
+    0x31, 0xD4, 0x39, 0x4B, 0xE9, 0x2C, 0xA5, 0x68, 0xF1, 0xF3, 0x3E, 0x11, 0x78, 0xA1, 0x84, 0x85,
+    0xDB, 0x26, 0x24, 0xDD, 0x54, 0x03, 0xC9, 0x89, 0x6A, 0x5E, 0x3A, 0xC5, 0xAD, 0x78, 0xF9, 0x80,
+    0x2D, 0x10, 0xC7, 0xDA, 0x50, 0x0E, 0x34, 0x99, 0x5A, 0x22, 0x53, 0x61, 0xE9, 0xE2, 0x12, 0x3A,
+    0x3E, 0x81, 0xA4, 0x45, 0x8F, 0x4A, 0xAC, 0x13, 0xC2, 0xD3, 0x10, 0x60, 0xC7, 0xE8, 0xC1, 0x63,
+    0xA0, 0x31, 0x1C, 0x47, 0x82, 0xAB, 0xA5, 0x19, 0x92, 0x75, 0x51, 0xFC, 0xFC, 0x06, 0x4D, 0x47,
+    0x75, 0x13, 0x4F, 0xA2, 0xA5, 0xFA, 0x21, 0xE8, 0x37, 0xED, 0x6A, 0xAE, 0x62, 0x34, 0xEF, 0xBB,
+    0x8D, 0x49, 0xB1, 0x4A, 0x6E, 0xDD, 0x0F, 0xD1, 0x20, 0xB4, 0x18, 0x39, 0x3E, 0xBF, 0x20, 0xD4,
+    0xA9, 0xFA, 0xC6, 0x17, 0x9A, 0xBA, 0x79, 0xF6, 0x34, 0x96, 0x6F, 0xA4, 0x0E, 0x3B, 0x8A, 0x54,
+    0x8F, 0xF4, 0x8D, 0x47, 0x21, 0xF4, 0xCD, 0xC0, 0x29, 0xE8, 0x0F, 0xEA, 0xC5, 0xBE, 0x8C, 0x51,
+    0x9F, 0xB9, 0x23, 0xA3, 0x9A, 0x2A, 0x3D, 0x4A, 0x69, 0xC8, 0x65, 0x75, 0x40, 0xDD, 0x43, 0xD1,
+    0x6D, 0xE4, 0xF1, 0xE7, 0x5B, 0xD0, 0x19, 0x35, 0x88, 0x05, 0x89, 0x79, 0x16, 0x96, 0xDA, 0x83,
+    0x02, 0xBE, 0x03, 0x2C, 0x7B, 0x81, 0x15, 0x3A, 0xE1, 0x56, 0xA1, 0xBF, 0xBE, 0x74, 0x5D, 0x50,
+    0x09, 0xD1, 0x56, 0x7A, 0xE8, 0x51, 0x75, 0xEE, 0x61, 0x48, 0xC8, 0x04, 0xCD, 0xAA, 0x7A, 0x90,
+    0x85, 0x55, 0x81, 0x70, 0xEB, 0x48, 0x0A, 0x6A, 0xE9, 0x30, 0xA8, 0x02, 0x7B, 0x43, 0xB6, 0xCA,
+    0xCB, 0xE4, 0xF5, 0x47, 0x6E, 0xA1, 0x45, 0x9C, 0xE7, 0x5F, 0x87, 0x03, 0x63, 0x9F, 0xB5, 0x59,
+    0xAA, 0x8B, 0x86, 0x5A, 0x6E, 0x21, 0x33, 0x0A, 0xC8, 0x57, 0xB3, 0x22, 0xD9, 0x74, 0xA4, 0x7E,
+    0x6D, 0x69, 0xE7, 0xB3, 0xE3, 0x3F, 0xD1, 0x68, 0xD1, 0x33, 0x1D, 0xFA, 0x0D, 0x34, 0xE8, 0xA8,
+    0x40, 0x15, 0x50, 0xE2, 0xB2, 0x1B, 0x79, 0x98, 0x30, 0x16, 0xC3, 0xD8, 0x81, 0x48, 0x81, 0xE5,
+    0x12, 0x05, 0x2A, 0xC7, 0x5E, 0x15, 0x58, 0x41, 0x39, 0x21, 0xE5, 0x75, 0x44, 0x00, 0x8E, 0x95,
+    0xE2, 0x12, 0xAF, 0x91, 0xC3, 0x12, 0xFA, 0x1D, 0xC0, 0x22, 0x05, 0xB0, 0xCC, 0xDD, 0x08, 0x48,
+    0xEE, 0xDE, 0xC4, 0x86, 0xF3, 0x2A, 0xA5, 0x46, 0xB5, 0xD4, 0x63, 0x03, 0x60, 0x5F, 0x79, 0x60,
+    0xE1, 0xCF, 0xDD, 0x2F, 0xDE, 0xBE, 0x42, 0xCB, 0x2E, 0xEB, 0x1C, 0x16, 0x7E, 0xD4, 0x28, 0xB7,
+    0x90, 0x5E, 0x53, 0x34, 0xAE, 0x4C, 0x31, 0x47, 0x4D, 0xD6, 0x77, 0xB8, 0xDE, 0x60, 0xA1, 0x1F,
+    0xC0, 0xC5, 0x09, 0x5C, 0x4B, 0xFF, 0xBF, 0xB0, 0xD8, 0xDB, 0xA9, 0xD1, 0x64, 0xA4, 0xE1, 0xA7,
+    0x97, 0xB7, 0x78, 0xD5, 0x29, 0xB2, 0xAD, 0xC1, 0x83, 0xA2, 0xB6, 0xFB, 0x14, 0x95, 0xAB, 0x08,
+    0x44, 0x24, 0xC6, 0x65, 0xFE, 0x1B, 0x9F, 0x0B, 0xED, 0x78, 0x5E, 0xE0, 0x38, 0x14, 0x21, 0x7B,
+    0x52, 0x53, 0xDB, 0xF2, 0x59, 0x59, 0xE8, 0xA8, 0xD3, 0xB0, 0x45, 0xC7, 0x07, 0xA5, 0xB4, 0x29,
+    0x6B, 0xFD, 0x73, 0xA4, 0x9E, 0x0D, 0x40, 0xF2, 0x47, 0x90, 0x76, 0x57, 0xB5, 0x12, 0x7D, 0x28,
+    0xD2, 0x7B, 0xF1, 0x8E, 0xA6, 0xE6, 0x44, 0x9D, 0xB9, 0x4A, 0xA7, 0xAE, 0x48, 0xA1, 0xF8, 0x1E,
+    0xA5, 0xE1, 0x99, 0x58, 0x04, 0x2A, 0x27, 0x3B, 0xD9, 0xAD, 0xC1, 0xB2, 0x7A, 0xCB, 0x71, 0x27,
+    0x81, 0x78, 0xCF, 0x53, 0x5C, 0xF6, 0xD6, 0xC2, 0xD7, 0x84, 0x41, 0x90, 0xC7, 0xB1, 0x62, 0x38,
+    0x31, 0xEB, 0xA8, 0xD6, 0x48, 0xB9, 0x44, 0x76, 0x55, 0xF2, 0xE8, 0x46, 0xC0, 0x44, 0x06, 0x3A,
+    0x9D, 0x7C, 0xBA, 0xB6, 0xC5, 0x46, 0xB4, 0x4C, 0x6D, 0xC9, 0x0A, 0xE6, 0x3F, 0xA1, 0x1E, 0xF4,
+    0x5A, 0x3B, 0xE1, 0xEF, 0xD3, 0x08, 0x05, 0xAD, 0x65, 0x58, 0x5E, 0x69, 0x7D, 0xD8, 0x42, 0xC5,
+    0x76, 0x78, 0x7B, 0xAC, 0xEF, 0xDD, 0x10, 0x38, 0x14, 0x43, 0x65, 0x38, 0x98, 0x4D, 0xCB, 0xB7,
+    0x89, 0x92, 0xF8, 0x64, 0x0D, 0x7A, 0x59, 0xDA, 0xA0, 0xFD, 0xC7, 0x11, 0x85, 0xF6, 0x93, 0xE8,
+    0xEB, 0x4B, 0x4F, 0xCD, 0x6C, 0x3B, 0xB0, 0x6C, 0x16, 0xD8, 0xE6, 0x3C, 0x50, 0x20, 0x4C, 0xF1,
+    0x09, 0x96, 0x1C, 0x1D, 0xB2, 0xFD, 0xC5, 0xFD, 0xD1, 0x90, 0x5F, 0x61, 0x67, 0xFB, 0xDF, 0xD2,
+    0x3E, 0xE6, 0xF6, 0x2A, 0xA7, 0x91, 0xB2, 0xB6, 0xE6, 0x05, 0x69, 0x37, 0x7B, 0x20, 0x8F, 0xE3,
+    0x64, 0x3F, 0x4D, 0x3F, 0xF1, 0x07, 0xA7, 0x8B, 0x75, 0x18, 0x12, 0xE7, 0xF7, 0x4F, 0x7E, 0x21,
+    0xF8, 0x5D, 0x37, 0x64, 0x2E, 0x19, 0xB4, 0x9F, 0xC4, 0xE2, 0xD4, 0xE1, 0x2F, 0x87, 0xD7, 0x6C,
+    0x40, 0xB3, 0x34, 0x53, 0xEE, 0xEF, 0xEE, 0x58, 0x05, 0xDF, 0x68, 0x84, 0x2F, 0xB7, 0xA8, 0xFC,
+    0x4E, 0x86, 0x02, 0x48, 0x95, 0xC7, 0xE7, 0x68, 0x62, 0xE4, 0x2F, 0x20, 0xEC, 0x4E, 0x4F, 0xFF,
+    0xFA, 0xFA, 0x1D, 0xA5, 0x55, 0x3D, 0x8F, 0xDC, 0x54, 0x14, 0x3D, 0xEF, 0x19, 0xF6, 0x49, 0x3C,
+    0x09, 0x23, 0x44, 0x24, 0xA4, 0x48, 0x31, 0x05, 0x05, 0x42, 0x22, 0xAF, 0xA1, 0xDC, 0x8D, 0x5F,
+    0xEA, 0x34, 0x29, 0x80, 0x82, 0x82, 0x1A, 0xD1, 0x4C, 0x93, 0x62, 0x8B, 0xC9, 0xDA, 0x3F, 0x21,
+    0x45, 0xA8, 0x68, 0xB6, 0x48, 0x24, 0xB4, 0x41, 0xDA, 0x86, 0x82, 0x62, 0x77, 0xC7, 0xFF, 0x00,
+    0x2B, 0x29, 0x69, 0x9C, 0x06, 0x29, 0xA1, 0xC0, 0x41, 0x06, 0x39, 0xAC, 0xED, 0xC7, 0xB9, 0xCF,
+    0xC3, 0x7E, 0x24, 0x8B, 0x02, 0xC2, 0xDA, 0x19, 0x69, 0x67, 0xEE, 0xBD, 0xE7, 0xDC, 0x73, 0xCF,
+    0xBD, 0x03, 0xE5, 0xDF, 0x81, 0x7A, 0xD6, 0x01, 0xAB, 0x0A, 0xC8, 0x01, 0xBC, 0x8B, 0x93, 0x27,
+    0x4C, 0x50, 0x21, 0xD4, 0x3A, 0x84, 0x36, 0x69, 0x4D, 0x97, 0xB4, 0xAA, 0x37, 0x0D, 0x7A, 0x5B,
+    0xA3, 0x4B, 0x2B, 0xDD, 0x66, 0xA5, 0x69, 0x5D, 0xB9, 0xA8, 0xF3, 0x10, 0x2A, 0xBE, 0x7C, 0x11,
+    0x46, 0xAC, 0xC2, 0x1D, 0x26, 0x26, 0x0D, 0xDF, 0x9E, 0x79, 0x60, 0xC9, 0xC2, 0x57, 0x97, 0x40,
+    0xBA, 0x03, 0xFB, 0xCB, 0x8F, 0x3E, 0x0B, 0x0D, 0xB2, 0x6F, 0x3A, 0xA4, 0x7E, 0x80, 0x29, 0x77,
+    0xA0, 0x9B, 0xC2, 0x33, 0xA5, 0x42, 0x16, 0x5A, 0xA8, 0xA9, 0x67, 0x56, 0x1E, 0x4A, 0xFE, 0x37,
+    0xC2, 0xB2, 0x68, 0xD2, 0x26, 0x9D, 0x1A, 0x70, 0x0D, 0x87, 0x48, 0x6F, 0x84, 0xC1, 0x3C, 0x0A,
+    0x93, 0x6E, 0x4D, 0xA3, 0x7A, 0xDD, 0x99, 0x11, 0x21, 0x04, 0x46, 0x07, 0x46, 0x07, 0x6F, 0xC3,
+    0x73, 0xAC, 0x71, 0x93, 0x1A, 0x9A, 0xC4, 0xF5, 0xFE, 0x13, 0xC2, 0x02, 0x6E, 0x9F, 0x3D, 0x4C,
+    0x30, 0x3F, 0x8F, 0x11, 0xF5, 0x8A, 0xEA, 0x71, 0xD5, 0x74, 0x70, 0x04, 0x14, 0x50, 0x73, 0xCC,
+    0x14, 0xFD, 0xA0, 0xE5, 0x07, 0x35, 0xEE, 0x7F, 0x8A, 0x33, 0xCF, 0x06, 0x59, 0xE4, 0x0C, 0x99,
+    0xBE, 0x86, 0x5D, 0x6B, 0x33, 0x7E, 0x09, 0x13, 0x24, 0xB6, 0xC4, 0x00, 0x50, 0x0B, 0xB8, 0xA7,
+    0xBB, 0x24, 0x52, 0x1B, 0xF2, 0x70, 0x81, 0x9F, 0xE1, 0x92, 0x57, 0x31, 0xEF, 0x0E, 0x5E, 0x7A,
+    0x5C, 0x8D, 0xEC, 0x57, 0x6F, 0x1E, 0x6F, 0x33, 0xA3, 0xCC, 0xF6, 0xEE, 0xEA, 0x56, 0x45, 0x1E,
+    0xC2, 0x36, 0x50, 0x2C, 0x5D, 0x6F, 0x23, 0x25, 0x8D, 0x6C, 0x04, 0x5E, 0xF7, 0xFF, 0x8B, 0x86,
+    0xBD, 0x5E, 0x83, 0x79, 0x86, 0x65, 0x4F, 0x2B, 0xFD, 0x4B, 0x1A, 0x48, 0x4B, 0x50, 0x25, 0xE4,
+    0x1E, 0x7A, 0xF7, 0xEF, 0xA4, 0x45, 0xA8, 0x53, 0x16, 0x26, 0x09, 0x47, 0x89, 0x5B, 0x7E, 0xFB,
+    0x79, 0xE4, 0xB0, 0x9A, 0x90, 0x56, 0x31, 0x9C, 0x14, 0x92, 0x68, 0x82, 0x96, 0xA3, 0x63, 0xC6,
+    0x35, 0x60, 0x87, 0x54, 0x81, 0x6F, 0x5F, 0x40, 0x57, 0x53, 0x47, 0xF0, 0x34, 0xF4, 0xC4, 0x76,
+    0x78, 0x8B, 0xD0, 0x69, 0x68, 0x04, 0xF9, 0xBF, 0x62, 0x70, 0xD2, 0x60, 0x54, 0xCA, 0xFE, 0x6F,
+    0xBF, 0xBA, 0x3A, 0x24, 0x98, 0x29, 0xD6, 0x4B, 0x46, 0x74, 0x28, 0x20, 0xEE, 0x4F, 0x1E, 0xD3,
+    0xA4, 0xF4, 0xA0, 0xD0, 0xC5, 0x07, 0xE7, 0xB5, 0x22, 0x25, 0xAA, 0x54, 0x09, 0x27, 0xDD, 0xCE,
+    0xA4, 0x92, 0xDF, 0x77, 0x23, 0x2B, 0x4B, 0x2F, 0x93, 0x16, 0xB2, 0x72, 0x96, 0x3F, 0x0F, 0x1D,
+    0x0A, 0x61, 0x1B, 0x84, 0x93, 0xA2, 0xD1, 0x8F, 0xA2, 0xD6, 0xD8, 0xC4, 0x45, 0xCF, 0xCA, 0xCB,
+    0x14, 0x54, 0xFF, 0x05, 0x47, 0xDE, 0x63, 0x67, 0xEF, 0xA6, 0x8C, 0xC1, 0xB2, 0x7D, 0xD2, 0x85,
+    0x1D, 0xA3, 0x9B, 0x59, 0x1D, 0x85, 0x0C, 0x64, 0x14, 0x6B, 0xFF, 0x70, 0x51, 0x99, 0xAF, 0xEE,
+    0xB1, 0x14, 0x49, 0xE6, 0x9C, 0x76, 0xDA, 0xC3, 0x6B, 0xF1, 0x20, 0x27, 0x07, 0x43, 0x16, 0x98,
+    0xD4, 0x13, 0x9F, 0xD6, 0x6E, 0xC4, 0xA0, 0x56, 0x75, 0x56, 0xEB, 0x0E, 0xE1, 0x69, 0x20, 0x02,
+    0x21, 0x24, 0x01, 0xFB, 0x71, 0x6B, 0x6E, 0xB1, 0x3A, 0x25, 0x70, 0x3D, 0x54, 0xBB, 0x3C, 0xB7,
+    0x01, 0x7F, 0x48, 0x3B, 0xA5, 0x79, 0x38, 0x60, 0xD3, 0xB4, 0xAA, 0x76, 0xA5, 0xBD, 0x3E, 0x44,
+    0xAF, 0x14, 0xB4, 0xDE, 0x8A, 0x50, 0x6F, 0x13, 0xC5, 0x79, 0x7D, 0xDC, 0xB3, 0x68, 0x85, 0x85,
+    0x2C, 0x30, 0xAC, 0x66, 0xD3, 0xD1, 0x84, 0xA2, 0xFA, 0x4B, 0xF6, 0xDB, 0xD8, 0xF3, 0xFC, 0x66,
+    0x04, 0x07, 0x49, 0x6D, 0xCB, 0xD7, 0xE0, 0xAA, 0x19, 0x7F, 0x6E, 0xB5, 0xB9, 0x72, 0x17, 0xA3,
+    0xA6, 0x13, 0xAA, 0xCB, 0xA3, 0x1A, 0x59, 0x3C, 0x9D, 0xF6, 0xE9, 0x4D, 0x9A, 0x33, 0x26, 0xBC,
+    0x21, 0x8B, 0xA5, 0x9A, 0x6D, 0x5A, 0x95, 0x60, 0xEC, 0x03, 0x97, 0x4E, 0x4B, 0x5F, 0xFE, 0xA9,
+    0x12, 0xBE, 0xAA, 0x5B, 0x51, 0xBB, 0x02, 0xC6, 0x1F, 0x41, 0x08, 0x8B, 0xAA, 0x86, 0xE1, 0x5A,
+    0x26, 0x23, 0x8C, 0x79, 0xC0, 0xDC, 0xAA, 0xA4, 0x04, 0x58, 0x53, 0x16, 0xB3, 0xF2, 0xC8, 0x44,
+    0xBB, 0xBE, 0xE0, 0x57, 0x51, 0xD8, 0xC6, 0x15, 0x1C, 0x85, 0xAD, 0xE8, 0x2B, 0x64, 0x4D, 0x3B,
+    0x73, 0x15, 0x75, 0x85, 0xAA, 0x88, 0x2B, 0x4C, 0x45, 0xDB, 0x48, 0x34, 0x4A, 0x2B, 0x0B, 0xCB,
+    0x04, 0x57, 0x42, 0xDF, 0x3B, 0x43, 0xD2, 0x86, 0x5E, 0x38, 0x52, 0x53, 0xA1, 0xF8, 0x7D, 0x56,
+    0x09, 0x43, 0x4A, 0x2A, 0x04, 0x95, 0x13, 0x7E, 0xA2, 0x28, 0xE9, 0x6D, 0x50, 0x66, 0x19, 0xA3,
+    0x88, 0x43, 0x1D, 0x45, 0xA9, 0x94, 0xE2, 0xDA, 0x66, 0x3D, 0x5F, 0x5C, 0xA0, 0xAD, 0xA3, 0x0F,
+    0x85, 0x6C, 0xDE, 0xA8, 0x93, 0x04, 0x09, 0x4E, 0x7A, 0x73, 0x3F, 0x2A, 0x9B, 0x63, 0xD1, 0x09,
+    0xDD, 0x24, 0x3C, 0x18, 0xA2, 0xB0, 0xE4, 0xEC, 0xD7, 0x56, 0xC8, 0x2B, 0xC6, 0xC5, 0x49, 0x30,
+    0x4D, 0x7A, 0xFD, 0x30, 0x8E, 0x4F, 0x1D, 0x1E, 0x88, 0xB0, 0xD9, 0x8D, 0x56, 0x74, 0xBD, 0x65,
+    0x1B, 0x91, 0x95, 0x77, 0x5B, 0x54, 0x75, 0x61, 0x16, 0xF5, 0x50, 0x34, 0x4D, 0xD8, 0xC1, 0x5A,
+    0x52, 0x3E, 0x5B, 0x6B, 0xDE, 0xC7, 0xB2, 0x6F, 0xA7, 0xCE, 0x3A, 0xE0, 0xBA, 0x0E, 0x38, 0xE0,
+    0x42, 0x0F, 0x9A, 0xF7, 0x3D, 0x69, 0x75, 0x2F, 0x97, 0xDE, 0x36, 0xA6, 0x4D, 0xFF, 0x9C, 0x25,
+    0xE4, 0x4D, 0xAF, 0x9D, 0xFC, 0xAC, 0x94, 0x79, 0x55, 0xF8, 0xBC, 0x5C, 0x49, 0x9D, 0x8F, 0xA2,
+    0xB3, 0xF9, 0x7B, 0x74, 0xB2, 0x0A, 0x04, 0x60, 0x59, 0xE2, 0x75, 0xB4, 0x2E, 0x92, 0x63, 0xF6,
+    0x34, 0xD8, 0x6E, 0x99, 0x56, 0x9B, 0x69, 0xB9, 0x74, 0xBE, 0xCF, 0x55, 0x57, 0x24, 0xED, 0x11,
+    0xD7, 0xF6, 0x0C, 0xE6, 0xC6, 0xF3, 0xCF, 0x46, 0x62, 0x4C, 0x7C, 0x8D, 0xAF, 0xC4, 0x24, 0xC2,
+    0xED, 0x9B, 0x26, 0x34, 0x76, 0xF2, 0x44, 0xD0, 0x11, 0xC1, 0x9C, 0x47, 0xC8, 0x67, 0x84, 0xAD,
+    0x8F, 0xF5, 0x58, 0xBD, 0x59, 0xE0, 0xFD, 0x93, 0x9B, 0x29, 0xB7, 0x9A, 0xCE, 0xAB, 0xE5, 0x9C,
+    0x0D, 0x72, 0x71, 0x32, 0x4F, 0x1E, 0x0C, 0xE5, 0x81, 0x3D, 0x12, 0x17, 0x65, 0x95, 0x28, 0xAD,
+    0x7E, 0xAB, 0xF2, 0xEF, 0xCC, 0xC2, 0xBF, 0x37, 0x27, 0xF2, 0x72, 0x6C, 0xC9, 0xEA, 0x2F, 0x61,
+    0x4B, 0xF6, 0x95, 0x49, 0x82, 0x1C, 0x7D, 0xF5, 0x89, 0x0A, 0x43, 0x12, 0xFA, 0x73, 0x03, 0x1F,
+    0xE4, 0x4F, 0x75, 0x72, 0x9C, 0x18, 0x46, 0x08, 0xA2, 0xD1, 0x74, 0xBC, 0x4B, 0xC4, 0xA0, 0xED,
+    0xA8, 0x57, 0x31, 0x2F, 0xD6, 0x3F, 0x3C, 0x7F, 0x01, 0x9D, 0x54, 0xB1, 0xAE, 0xDC, 0x44, 0x14,
+    0x3D, 0xF6, 0xB0, 0x8C, 0xC0, 0xC5, 0xA4, 0x79, 0xCD, 0x43, 0xC4, 0x3D, 0x48, 0xEB, 0x1A, 0xE9,
+    0xED, 0xDA, 0xB4, 0x50, 0x90, 0xE2, 0xF1, 0x13, 0x34, 0x69, 0x29, 0xF6, 0xAD, 0x1D, 0x7E, 0x84,
+    0x94, 0x50, 0x85, 0x22, 0xC5, 0x16, 0x1B, 0x3C, 0xE1, 0x95, 0x14, 0x58, 0xA2, 0xA0, 0x8C, 0x13,
+    0x8A, 0x14, 0x48, 0xBC, 0x41, 0x32, 0xC2, 0x12, 0xDE, 0x1D, 0xCE, 0x1D, 0x7B, 0xF7, 0x6D, 0x24,
+    0x50, 0x50, 0x46, 0xDA, 0xF5, 0xEE, 0x8C, 0xE7, 0xDC, 0x73, 0xEF, 0x39, 0xF7, 0x22, 0xBA, 0x57,
+    0xFB, 0xD4, 0xB7, 0x18, 0x57, 0xD4, 0x62, 0x01, 0x65, 0xB1, 0x42, 0x52, 0xA1, 0x43, 0x0A, 0xE5,
+    0x90, 0x73, 0xDF, 0x58, 0x0C, 0x48, 0x8B, 0x58, 0xFE, 0xA9, 0x16, 0x57, 0x48, 0x64, 0xC3, 0x54,
+    0x71, 0x8F, 0xBC, 0xD0, 0x0E, 0x35, 0x0F, 0x79, 0x2D, 0xAF, 0xA2, 0x6E, 0x04, 0x7A, 0x28, 0x6F,
+    0xE4, 0x88, 0x87, 0x23, 0xAE, 0x29, 0x70, 0x81, 0xC8, 0x09, 0xF0, 0x42, 0x9E, 0x26, 0x9C, 0x3B,
+    0xCC, 0x01, 0x5F, 0x44, 0xE3, 0x7B, 0x84, 0x5E, 0xC3, 0x34, 0xF8, 0x66, 0xA2, 0xF3, 0xDA, 0xB8,
+    0xA5, 0x40, 0x2F, 0x94, 0x5D, 0x25, 0x55, 0x97, 0x2A, 0x47, 0xAA, 0x4B, 0x9E, 0xEA, 0x26, 0xEA,
+    0xB1, 0xE5, 0x1B, 0xC6, 0x92, 0x7F, 0x4F, 0xCC, 0xB4, 0x30, 0x0D, 0x41, 0x06, 0xC2, 0xA4, 0x95,
+    0x6E, 0x55, 0x87, 0x27, 0xFC, 0x69, 0xAC, 0x6E, 0x19, 0x79, 0x87, 0xCC, 0x1A, 0x1B, 0xF7, 0xBC,
+    0x04, 0x5E, 0xC2, 0x3B, 0x89, 0x23, 0xA7, 0x3D, 0x90, 0x7A, 0x0B, 0xE5, 0xF9, 0xE7, 0xC3, 0x1E,
+    0xC7, 0xF5, 0x2E, 0x74, 0xA3, 0x89, 0xAB, 0x04, 0x0E, 0xF8, 0x62, 0xDA, 0xBE, 0xCB, 0xC4, 0x0C,
+    0x6B, 0xA0, 0x6C, 0xE4, 0x98, 0xDD, 0x63, 0x6C, 0x98, 0xEE, 0x82, 0xDB, 0x29, 0x33, 0x27, 0x0F,
+    0xDE, 0x88, 0x59, 0x65, 0xA9, 0x8F, 0xE2, 0xBD, 0x98, 0xF0, 0xF8, 0x16, 0xB7, 0x65, 0x07, 0x64,
+    0x67, 0xCF, 0x60, 0x9B, 0xB4, 0xB8, 0x8D, 0xA6, 0x79, 0xC2, 0x48, 0x08, 0xB1, 0x9E, 0x08, 0x3F,
+    0x7E, 0xD2, 0x0A, 0x48, 0x9A, 0xF1, 0x20, 0x90, 0x1E, 0xA6, 0x83, 0xAC, 0x08, 0x25, 0x7B, 0x2B,
+    0x69, 0xA1, 0xC9, 0x5B, 0xF9, 0x1E, 0x11, 0x3F, 0x98, 0xDD, 0x3B, 0xE0, 0xB1, 0xDA, 0x8A, 0x1B,
+    0x3C, 0x9C, 0x6B, 0x7B, 0x1B, 0x46, 0x34, 0x67, 0xC5, 0x44, 0x24, 0x38, 0x49, 0x06, 0x8A, 0xF8,
+    0x17, 0x8C, 0xCF, 0x50, 0xA4, 0x9C, 0x02, 0xEF, 0xB5, 0x50, 0x3B, 0x86, 0xA9, 0x4E, 0x6E, 0x95,
+    0x55, 0x50, 0x98, 0x8A, 0xD1, 0x01, 0x60, 0x55, 0x71, 0x7E, 0xCB, 0x7D, 0x9B, 0x59, 0xF5, 0x07,
+    0xD5, 0xFB, 0x8C, 0x92, 0xED, 0xA0, 0x6E, 0x1A, 0x64, 0xBC, 0x4F, 0xAB, 0x69, 0x66, 0x9A, 0x09,
+    0x89, 0x8E, 0x2C, 0x3B, 0xE4, 0xF7, 0x59, 0xC9, 0xDC, 0x25, 0x6D, 0xED, 0x02, 0x0F, 0xEA, 0x44,
+    0xCD, 0x24, 0x78, 0x46, 0xE8, 0x4F, 0x0A, 0xF5, 0xAC, 0x8A, 0x7D, 0x45, 0x93, 0xA0, 0xB4, 0xC8,
+    0xA8, 0xBE, 0xB7, 0xFA, 0xE5, 0x10, 0x77, 0xFE, 0x84, 0x89, 0x0F, 0xC4, 0x52, 0x2B, 0x54, 0xA8,
+    0x5E, 0x24, 0xF9, 0xBE, 0xB0, 0xEF, 0x3F, 0x8E, 0x7F, 0xE7, 0x3E, 0x7D, 0xB2, 0x83, 0xE9, 0xE2,
+    0x67, 0xF6, 0x42, 0xFC, 0x52, 0x48, 0x7A, 0x2E, 0xA4, 0x2A, 0x72, 0x04, 0x9F, 0xB2, 0x8A, 0xC7,
+    0x67, 0x33, 0x3D, 0xDB, 0xCF, 0x73, 0xFF, 0xA7, 0xF7, 0x3F, 0x7A, 0x82, 0xA3, 0x25, 0x1F, 0x3A,
+    0xF7, 0x58, 0x47, 0xD6, 0x65, 0x43, 0x08, 0x2A, 0xBD, 0x1C, 0xFB, 0xC5, 0x8C, 0xFD, 0x42, 0x8D,
+    0x97, 0xD0, 0x03, 0x6A, 0xD6, 0x93, 0x3A, 0x66, 0x41, 0x97, 0x75, 0xA8, 0xED, 0x20, 0xA8, 0x71,
+    0x27, 0xAA, 0x51, 0x55, 0xC2, 0x1B, 0xBF, 0x4B, 0xFD, 0x90, 0xF9, 0xA9, 0x47, 0x70, 0x29, 0xC5,
+    0xA4, 0x3A, 0x7C, 0xC1, 0xB4, 0x92, 0xCC, 0x59, 0x11, 0xAC, 0x71, 0xEC, 0x98, 0x6A, 0xEC, 0x20,
+    0x33, 0xFD, 0xE7, 0xFE, 0x92, 0xFA, 0x22, 0x19, 0x8E, 0x75, 0x78, 0xFB, 0x21, 0x72, 0xCB, 0x6C,
+    0x69, 0x80, 0x32, 0x08, 0xCD, 0x96, 0x09, 0xB1, 0x67, 0x51, 0x3F, 0x8F, 0xDD, 0x42, 0xB9, 0x95,
+    0x6E, 0x7B, 0xA6, 0x48, 0x97, 0xD0, 0x45, 0xD9, 0x83, 0xCB, 0xDC, 0x77, 0xA5, 0x77, 0xB5, 0xB8,
+    0x7C, 0x06, 0x81, 0x54, 0x4D, 0xF4, 0xDC, 0x61, 0xD3, 0x33, 0x86, 0xC8, 0xCE, 0x60, 0xCC, 0x2F,
+    0x1A, 0x35, 0x19, 0xB7, 0xE4, 0xA5, 0x56, 0x02, 0x87, 0x2C, 0x25, 0x82, 0x08, 0xF5, 0xD4, 0xE9,
+    0x76, 0x88, 0x5D, 0x89, 0xE1, 0xBC, 0x5A, 0x07, 0x2B, 0x32, 0x06, 0x13, 0x8D, 0xFB, 0xB3, 0xC2,
+    0xFB, 0x86, 0x41, 0x42, 0xA6, 0x5F, 0x4E, 0x93, 0xE5, 0x5C, 0xFD, 0xEA, 0x16, 0x6B, 0xFD, 0x53,
+    0xDB, 0x8F, 0x65, 0x9C, 0x0B, 0x66, 0x69, 0x4F, 0x72, 0x91, 0x35, 0xF6, 0xDD, 0x72, 0x9C, 0x05,
+    0xD5, 0x34, 0x22, 0x44, 0xB6, 0x70, 0x90, 0xAD, 0xC3, 0x8E, 0x0F, 0x46, 0x2E, 0xA5, 0x4B, 0x0E,
+    0xB5, 0xF0, 0xE1, 0x3B, 0x0D, 0x07, 0x2A, 0x8C, 0xA4, 0x68, 0xDC, 0xCA, 0xC3, 0xA4, 0x33, 0x7B,
+    0xE9, 0x08, 0xE5, 0xFD, 0x4E, 0x7A, 0xCE, 0x0B, 0x40, 0x7E, 0xDF, 0x4F, 0x4E, 0x3E, 0xDC, 0xC0,
+    0x2E, 0x7C, 0x7F, 0xF4, 0x0A, 0xA1, 0xB1, 0x55, 0xE7, 0x53, 0xC7, 0x50, 0xF7, 0x89, 0x97, 0x04,
+    0x4F, 0x03, 0xBD, 0x3B, 0x88, 0xCA, 0xFD, 0x83, 0xDA, 0x37, 0x74, 0xDA, 0x66, 0x3A, 0x0E, 0xC1,
+    0xB3, 0x40, 0xB0, 0x1D, 0x6F, 0x26, 0x45, 0xA8, 0xF7, 0x61, 0x9D, 0x31, 0xC7, 0x92, 0x95, 0xAC,
+    0x8B, 0x2D, 0x7C, 0x35, 0x44, 0xFE, 0x69, 0x17, 0xFB, 0x1F, 0x9C, 0xFA, 0xFB, 0xDA, 0xE9, 0xBF,
+    0x7E, 0x69, 0xCC, 0xCB, 0xDF, 0xAC, 0xF9, 0xD9, 0xDB, 0xEC, 0xDA, 0x17, 0xF9, 0xB5, 0x47, 0xFE,
+    0x95, 0x47, 0xFD, 0xB1, 0x0C, 0x8C, 0x59, 0x68, 0x94, 0x4D, 0x10, 0x68, 0x5A, 0xF1, 0x4D, 0xCB,
+    0xC6, 0xD7, 0xDD, 0x36, 0xB1, 0x2B, 0x53, 0xF4, 0x29, 0xBA, 0x3C, 0x76, 0xB9, 0x72, 0xDF, 0xB3,
+    0x0F, 0xDE, 0x38, 0xCE, 0x58, 0x53, 0x19, 0xD3, 0x1C, 0xBD, 0x20, 0x92, 0x58, 0x14, 0xB3, 0xE2,
+    0x75, 0x11, 0xA3, 0x4B, 0xB1, 0xA1, 0x3E, 0x38, 0x9A, 0xD3, 0xF5, 0x4C, 0x6E, 0xC8, 0x8C, 0x33,
+    0x37, 0xD3, 0xD0, 0xBB, 0xFB, 0x6A, 0x85, 0xD9, 0x07, 0x7D, 0x20, 0x99, 0x35, 0x19, 0x4C, 0xCF,
+    0x21, 0xED, 0x75, 0x23, 0x2C, 0x39, 0x1D, 0x07, 0x94, 0x57, 0x57, 0xC8, 0xBF, 0x7E, 0x04, 0xA1,
+    0x99, 0x38, 0xDF, 0x28, 0x8E, 0x0E, 0xEC, 0x29, 0xFB, 0xC8, 0x33, 0x29, 0xBE, 0x83, 0x79, 0x44,
+    0x2D, 0xDA, 0xD1, 0x36, 0x77, 0x4E, 0x81, 0xC9, 0x93, 0xD3, 0x83, 0x36, 0xFB, 0xD4, 0xC6, 0x4E,
+    0xE6, 0x72, 0x8F, 0x95, 0x6A, 0x94, 0x63, 0x18, 0x3B, 0x40, 0xEA, 0x33, 0x35, 0x77, 0x73, 0x74,
+    0x5D, 0x98, 0xBD, 0xF8, 0xA0, 0xC0, 0x7F, 0xAC, 0xA4, 0x16, 0xF5, 0x73, 0x99, 0x45, 0xD1, 0x2E,
+    0x93, 0x0D, 0x2B, 0x9E, 0x58, 0x88, 0x4D, 0x23, 0x67, 0xC2, 0x3C, 0xDE, 0xCA, 0x1B, 0x02, 0x14,
+    0xF7, 0xD2, 0xD4, 0x6F, 0x28, 0x81, 0x0C, 0xDA, 0x7C, 0x1C, 0xDD, 0xFF, 0x43, 0x68, 0xB6, 0xB8,
+    0xB7, 0xD1, 0xE9, 0x88, 0xFC, 0xF7, 0xF5, 0x0F, 0xAD, 0x55, 0x3D, 0x8F, 0x1C, 0x45, 0x10, 0x7D,
+    0xDD, 0xCD, 0xDD, 0x48, 0x4C, 0xD0, 0x97, 0x58, 0x20, 0x2C, 0x3C, 0x09, 0x01, 0x04, 0xE7, 0x49,
+    0x2D, 0x71, 0xBE, 0x19, 0xC9, 0x7F, 0xE0, 0x02, 0x5B, 0x42, 0xE2, 0x17, 0x90, 0x70, 0x04, 0x84,
+    0xEB, 0xDB, 0x11, 0x29, 0xC9, 0xFD, 0x84, 0x43, 0x22, 0x31, 0x4E, 0x1D, 0x38, 0xD8, 0xF3, 0x8E,
+    0x45, 0x40, 0x40, 0x32, 0x4E, 0x88, 0x5B, 0x88, 0x00, 0x91, 0xB8, 0x25, 0xC6, 0x68, 0x0E, 0xCF,
+    0x4C, 0xF1, 0x6A, 0x66, 0x6F, 0x39, 0x23, 0x23, 0x81, 0xA0, 0xF7, 0x4B, 0xDB, 0xD3, 0x55, 0xF5,
+    0x5E, 0xD5, 0xAB, 0x6A, 0x00, 0x06, 0xC8, 0xA5, 0x46, 0x26, 0x11, 0xAF, 0xAC, 0xEB, 0x17, 0x40,
+    0x21, 0x01, 0xC5, 0x0F, 0x03, 0x8A, 0x32, 0xAB, 0x8B, 0xD2, 0x45, 0x5F, 0xA1, 0x4F, 0x1B, 0x1C,
+    0xBA, 0x88, 0xBC, 0xEC, 0xE1, 0xEB, 0x65, 0x75, 0x1C, 0x32, 0x91, 0xD6, 0x89, 0x74, 0x58, 0xF3,
+    0xB3, 0x4B, 0x8B, 0xCD, 0x32, 0xF0, 0x12, 0x52, 0xEE, 0x6D, 0x97, 0x1D, 0x90, 0x48, 0x48, 0xC2,
+    0xCA, 0x35, 0x99, 0xA1, 0xB3, 0xF3, 0xE3, 0x26, 0x93, 0xE0, 0x18, 0x39, 0x3F, 0xE5, 0xE3, 0x3D,
+    0x42, 0xF1, 0x0F, 0x6B, 0x38, 0xF5, 0xB1, 0x6C, 0xFE, 0x3F, 0x28, 0x6F, 0x10, 0xCC, 0xEF, 0x2B,
+    0x52, 0x2C, 0xB1, 0x3C, 0xBD, 0x74, 0x9A, 0x37, 0xDC, 0xA8, 0x08, 0x06, 0x6D, 0x52, 0x67, 0xE8,
+    0xEC, 0x8B, 0x75, 0x49, 0x34, 0x90, 0x1E, 0xF6, 0x42, 0x0F, 0xAC, 0x4C, 0x8B, 0xB4, 0xCE, 0x2A,
+    0x0C, 0xE6, 0x0A, 0x07, 0xEC, 0x8E, 0x25, 0x20, 0x52, 0xC1, 0xD3, 0x00, 0x03, 0x96, 0xF0, 0x0D,
+    0x7A, 0x1C, 0xC2, 0x45, 0xDB, 0xC2, 0x57, 0xBE, 0xC6, 0x39, 0x0A, 0xFE, 0x33, 0xA3, 0x59, 0x57,
+    0x89, 0xC8, 0xC0, 0x3C, 0xD0, 0x6F, 0x2E, 0x23, 0x99, 0xD0, 0x6E, 0x5E, 0x87, 0x58, 0xA1, 0xB7,
+    0xAD, 0x8B, 0xE9, 0x36, 0x61, 0x0A, 0xC9, 0x10, 0xB8, 0x62, 0xF2, 0xE5, 0x02, 0x04, 0x85, 0xFC,
+    0xE3, 0x16, 0x8A, 0xCA, 0xB3, 0x44, 0x13, 0x2C, 0xFA, 0xBC, 0x77, 0x17, 0xA9, 0x90, 0x29, 0xF3,
+    0x21, 0xCC, 0x9D, 0x42, 0x80, 0x6B, 0xA7, 0xEF, 0x08, 0xF9, 0x08, 0x4C, 0x8B, 0x68, 0x46, 0xCC,
+    0xF4, 0xED, 0x7A, 0x20, 0x6B, 0x12, 0x52, 0x60, 0x76, 0xC6, 0x07, 0x0A, 0x86, 0x48, 0xD2, 0xE9,
+    0xDB, 0xAC, 0x15, 0xDE, 0x36, 0xFA, 0x93, 0x92, 0x70, 0x9F, 0xE3, 0x24, 0x6D, 0x3F, 0x75, 0xCC,
+    0x65, 0x97, 0x61, 0xFC, 0xE6, 0xE8, 0xFC, 0x38, 0x1A, 0xC3, 0xD3, 0x1D, 0x13, 0x2B, 0xC1, 0x5E,
+    0xA4, 0x6A, 0xF0, 0x2E, 0x2B, 0x35, 0xBD, 0x4D, 0xA9, 0xA6, 0x5E, 0x1D, 0x46, 0xD7, 0xDC, 0x46,
+    0xF4, 0x58, 0x25, 0xF5, 0x61, 0x12, 0xBC, 0x44, 0xDD, 0xA2, 0xFB, 0xDE, 0x57, 0xEB, 0x24, 0x14,
+    0x5F, 0xF4, 0xBE, 0x91, 0xB4, 0x2D, 0x6A, 0x35, 0x48, 0x4B, 0x13, 0x70, 0x80, 0x9D, 0xD2, 0xBC,
+    0x6C, 0xF2, 0xC1, 0x5D, 0x94, 0xF7, 0x99, 0x6A, 0xA5, 0x5B, 0xCE, 0x44, 0x2E, 0xD3, 0xE1, 0x83,
+    0x72, 0x72, 0x1D, 0x0C, 0x59, 0x7C, 0x72, 0x89, 0xF4, 0x5F, 0x87, 0xDB, 0x29, 0x6D, 0x8F, 0xA2,
+    0x4A, 0x34, 0x59, 0x79, 0x6D, 0x8E, 0x34, 0x8F, 0x7F, 0x13, 0x78, 0x07, 0x47, 0xC8, 0x28, 0xAE,
+    0xBC, 0xA5, 0xE6, 0xF8, 0xFF, 0x33, 0x5C, 0x89, 0x4A, 0x5D, 0x41, 0xC3, 0x7A, 0x44, 0x8D, 0xEB,
+    0xC2, 0x09, 0xD3, 0x19, 0xA7, 0x5D, 0x2D, 0x73, 0x4D, 0xE1, 0x25, 0xC1, 0x75, 0x79, 0xCD, 0xD8,
+    0x58, 0xDF, 0xE9, 0x67, 0xD5, 0x57, 0xEF, 0x9B, 0x17, 0x2D, 0xD6, 0x35, 0x6B, 0x8E, 0xB7, 0x31,
+    0xC7, 0xB6, 0xD2, 0x30, 0x78, 0xD2, 0x68, 0x74, 0x8D, 0x56, 0x52, 0xD8, 0x33, 0x71, 0xCD, 0xE8,
+    0x0D, 0xFE, 0x46, 0xCD, 0xD2, 0x1C, 0xF9, 0x2E, 0xDB, 0x41, 0x94, 0x32, 0x96, 0x65, 0x69, 0xF9,
+    0x80, 0x1A, 0x43, 0xF1, 0x13, 0xE1, 0x8C, 0xD3, 0x13, 0x24, 0xAC, 0x89, 0xEB, 0x92, 0x2A, 0x6B,
+    0x96, 0x22, 0x4E, 0xCB, 0x34, 0xB5, 0xDD, 0x1E, 0x5C, 0x8D, 0x7D, 0x18, 0xED, 0x6C, 0x23, 0x55,
+    0xF6, 0x10, 0x8F, 0xD8, 0x08, 0x34, 0xAB, 0x50, 0xB8, 0x97, 0x7D, 0x21, 0xCD, 0xF1, 0x46, 0xD9,
+    0x07, 0xFC, 0x68, 0x74, 0x69, 0xE0, 0xC2, 0xE3, 0x3F, 0xC5, 0x7E, 0x8D, 0xBE, 0xB5, 0x3D, 0xA9,
+    0x3E, 0x86, 0xA6, 0x64, 0x01, 0x25, 0x25, 0xA7, 0x73, 0xEC, 0x8C, 0xFB, 0x53, 0xA7, 0xFA, 0xA0,
+    0xC1, 0x29, 0xB0, 0xBA, 0x98, 0xC4, 0x35, 0x6B, 0xDA, 0xF2, 0x87, 0xA7, 0xE8, 0xE0, 0x71, 0x36,
+    0xB7, 0x0E, 0x92, 0x5F, 0x6A, 0xCB, 0xF3, 0x27, 0x15, 0xEC, 0xA8, 0x3C, 0xFC, 0xF3, 0xE8, 0xA5,
+    0x35, 0xEB, 0xB0, 0x8D, 0x47, 0x9F, 0x96, 0xC2, 0xCD, 0x9A, 0x3D, 0x0D, 0xE7, 0x94, 0xED, 0x85,
+    0x8E, 0xA8, 0x6A, 0x8A, 0x66, 0xD8, 0xC3, 0xF4, 0x19, 0x92, 0x96, 0x3A, 0xAE, 0xA9, 0x4A, 0xA3,
+    0x38, 0x1E, 0x31, 0x16, 0x0F, 0xE6, 0x6C, 0xAE, 0xAF, 0x37, 0xC3, 0xE7, 0xB5, 0x74, 0xD7, 0x1D,
+    0x02, 0xD8, 0x70, 0x1F, 0x96, 0x73, 0x4B, 0x9F, 0xBD, 0x43, 0xA3, 0x13, 0x46, 0x51, 0x4D, 0xDF,
+    0x9F, 0xAA, 0xBF, 0x31, 0x3F, 0x9A, 0xC9, 0x4D, 0x93, 0x91, 0x48, 0x58, 0xA5, 0x09, 0xCA, 0xC4,
+    0x5C, 0xB1, 0x68, 0x6F, 0xCD, 0x60, 0x7C, 0x30, 0x44, 0xC3, 0x0E, 0xE9, 0xA1, 0x93, 0x67, 0xE6,
+    0xBE, 0x6F, 0x2B, 0xF3, 0x5B, 0x44, 0xDA, 0x69, 0xA3, 0x03, 0x73, 0x1D, 0x97, 0x01, 0xC4, 0xA4,
+    0xF4, 0xB3, 0x33, 0x7A, 0x09, 0x2A, 0x30, 0xF2, 0x57, 0xE9, 0x5C, 0x1F, 0xA7, 0x13, 0x85, 0xC8,
+    0x77, 0x74, 0xC4, 0xAE, 0xAC, 0x1C, 0x1F, 0x9F, 0xCF, 0x95, 0xD6, 0x06, 0xAE, 0xB4, 0xC3, 0x55,
+    0x90, 0xD4, 0x30, 0x9E, 0x40, 0x67, 0x8E, 0xB6, 0xC4, 0x9B, 0x04, 0xC1, 0xFD, 0xB7, 0xE6, 0xC7,
+    0x1F, 0x6C, 0xC6, 0x6C, 0x83, 0x05, 0x11, 0xA7, 0xF2, 0x4C, 0x06, 0xA6, 0xE5, 0x50, 0x55, 0xB0,
+    0x80, 0xFF, 0x99, 0xD5, 0xF5, 0x83, 0x69, 0xE8, 0x65, 0x37, 0xAA, 0x6F, 0xBC, 0x67, 0x4B, 0xF7,
+    0x63, 0x84, 0xEF, 0x26, 0xF2, 0x76, 0xA3, 0x36, 0x6A, 0x59, 0x7A, 0xEA, 0xE8, 0x7B, 0xA5, 0x43,
+    0xF4, 0x1C, 0x27, 0x0A, 0x81, 0x48, 0x34, 0x69, 0x94, 0xA9, 0x26, 0x82, 0x62, 0xD1, 0xC1, 0xC5,
+    0xBC, 0x65, 0x53, 0x87, 0x25, 0x1C, 0xDB, 0x3C, 0x17, 0x6D, 0x58, 0x99, 0x78, 0x8D, 0x95, 0xB3,
+    0xAC, 0x2A, 0x89, 0x31, 0x71, 0xCA, 0x84, 0x16, 0x0B, 0xDA, 0x9E, 0xC1, 0x0F, 0x74, 0x5F, 0x5E,
+    0x25, 0x9A, 0x6C, 0x89, 0xB2, 0x40, 0x09, 0xB3, 0xF8, 0x5A, 0xA2, 0xBA, 0x26, 0x25, 0xA7, 0x54,
+    0x47, 0x9B, 0x49, 0xA3, 0xFC, 0x3A, 0xB5, 0xA8, 0xD5, 0x2D, 0xBB, 0x49, 0x6B, 0x71, 0xF3, 0x16,
+    0x91, 0x7D, 0x0E, 0xFC, 0x4A, 0xDB, 0xAF, 0x4E, 0x5F, 0xB9, 0xCE, 0x46, 0x8C, 0xF4, 0x33, 0xD8,
+    0xDE, 0xF4, 0xAE, 0xB3, 0xBD, 0x6B, 0x5D, 0x9B, 0x44, 0x9D, 0xBE, 0x49, 0xF4, 0x4D, 0xDA, 0x50,
+    0x89, 0x7C, 0xE5, 0x35, 0x25, 0xCC, 0x5B, 0x40, 0x58, 0x7C, 0x62, 0xE7, 0x88, 0x9D, 0xD6, 0x8D,
+    0x5B, 0xE0, 0x4D, 0x96, 0x6D, 0x2F, 0xB6, 0xE8, 0xBF, 0xAC, 0x6E, 0xEF, 0xDB, 0x18, 0xFD, 0xB7,
+    0xF5, 0x49, 0xE6, 0xDA, 0xA5, 0x3C, 0x15, 0x99, 0x5B, 0x4E, 0x7B, 0x55, 0x86, 0x69, 0x1C, 0xFC,
+    0x75, 0xFD, 0x17, 0x04, 0x3B, 0xF7, 0x20, 0xA3, 0x95, 0x07, 0x5B, 0x67, 0xBC, 0x1B, 0x6E, 0xA2,
+    0x25, 0x86, 0x03, 0x17, 0x0F, 0x92, 0xB0, 0xF0, 0xEC, 0xFC, 0x9A, 0xEF, 0x7C, 0x7B, 0xC1, 0xFC,
+    0xA3, 0xF5, 0x07, 0xAD, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0xFD, 0x66, 0x37, 0x66, 0x82, 0x37,
+    0x30, 0x14, 0xB1, 0x84, 0x0C, 0x78, 0x29, 0x68, 0x40, 0x71, 0x96, 0x22, 0x45, 0x04, 0x77, 0x37,
+    0x9B, 0x20, 0x91, 0x12, 0x17, 0x76, 0x4D, 0x0B, 0x88, 0x12, 0x21, 0x17, 0x17, 0xEF, 0x1A, 0x09,
+    0x51, 0xB8, 0xC8, 0xFD, 0x01, 0x24, 0x0B, 0xA5, 0xC0, 0xD0, 0xB8, 0x88, 0xC4, 0x49, 0x1C, 0xD9,
+    0x21, 0x57, 0xA4, 0xA0, 0x60, 0x93, 0x14, 0x14, 0x20, 0x65, 0x82, 0x41, 0x48, 0x08, 0x89, 0x31,
+    0xD9, 0xA0, 0x95, 0x3C, 0x7B, 0xC3, 0x9B, 0xF5, 0xC5, 0x3A, 0x43, 0x03, 0x0A, 0x73, 0x9A, 0xBB,
+    0xDB, 0xDD, 0x99, 0x6F, 0xDE, 0xF7, 0xDE, 0xFB, 0xBE, 0x25, 0x7A, 0x6F, 0x89, 0xA8, 0x68, 0x88,
+    0xB2, 0x9A, 0x68, 0x2E, 0xA5, 0xD9, 0x31, 0xA1, 0x09, 0xB3, 0xD4, 0x04, 0x96, 0xD9, 0xB0, 0x0E,
+    0x6C, 0x58, 0x85, 0x15, 0x37, 0xA1, 0x89, 0x34, 0x37, 0xA2, 0x8C, 0x4A, 0xA1, 0xFC, 0x27, 0x51,
+    0xB1, 0x73, 0x29, 0x26, 0xC5, 0xAE, 0xA1, 0xC8, 0x55, 0x87, 0x7B, 0xD7, 0x17, 0x71, 0x9D, 0x87,
+    0x2E, 0xA7, 0x85, 0x69, 0x34, 0x66, 0x44, 0x3E, 0x0C, 0xCB, 0xE5, 0xC0, 0x08, 0xB2, 0xA1, 0xDA,
+    0x60, 0x46, 0xA6, 0x99, 0xC3, 0x6E, 0x13, 0x38, 0x9C, 0x4D, 0x51, 0x4E, 0xB4, 0x54, 0x12, 0x25,
+    0x8A, 0x48, 0x1C, 0x07, 0xF2, 0xA8, 0x60, 0xB8, 0xA2, 0x57, 0x73, 0xD6, 0x50, 0x58, 0x3E, 0x8C,
+    0xC6, 0x55, 0xEF, 0x2C, 0x55, 0xD7, 0xA2, 0xB1, 0x92, 0x82, 0xD5, 0x7D, 0x71, 0xCB, 0x39, 0xEE,
+    0x6C, 0xE4, 0x34, 0xB1, 0x2A, 0xD4, 0x14, 0xE7, 0x92, 0x58, 0x1D, 0x9A, 0xBF, 0x61, 0x10, 0x5A,
+    0x68, 0xCA, 0x48, 0xA6, 0x1E, 0x05, 0xAE, 0x22, 0x83, 0xFF, 0x32, 0xC5, 0x7F, 0x4B, 0x1E, 0x08,
+    0xAE, 0x92, 0x94, 0xFC, 0x15, 0x80, 0x19, 0xF2, 0x58, 0x28, 0x73, 0x96, 0x98, 0x73, 0x25, 0x05,
+    0x40, 0x34, 0x1D, 0x75, 0x60, 0x62, 0x25, 0x91, 0x48, 0xF5, 0xF0, 0x4E, 0x3F, 0xD4, 0x81, 0x16,
+    0x69, 0x94, 0x8E, 0xA8, 0x83, 0x63, 0x4D, 0x9C, 0x73, 0xD5, 0x20, 0x80, 0xC1, 0x7E, 0x45, 0xC5,
+    0xE4, 0x11, 0x08, 0x10, 0x9E, 0x57, 0x3A, 0xE4, 0x35, 0x52, 0xED, 0x69, 0x31, 0xD5, 0xC3, 0xF0,
+    0x4E, 0x99, 0x40, 0x88, 0x0E, 0xBF, 0x67, 0xB2, 0x4B, 0xCE, 0xE2, 0xA8, 0xC4, 0xE5, 0xCC, 0x90,
+    0x80, 0x1D, 0x88, 0x46, 0x33, 0x59, 0x7B, 0x16, 0x02, 0xEB, 0x49, 0xFB, 0x1D, 0xB2, 0x88, 0x8B,
+    0x7A, 0xE6, 0x99, 0xC4, 0x1D, 0x8B, 0xAF, 0xA0, 0xC6, 0x17, 0x87, 0xA2, 0x2B, 0x42, 0x4B, 0x56,
+    0xC7, 0x2A, 0xE3, 0xB8, 0x93, 0x09, 0x9B, 0x51, 0x26, 0x6D, 0x43, 0x59, 0x31, 0xB1, 0xB0, 0x19,
+    0xF0, 0x14, 0x16, 0x49, 0x15, 0xA6, 0x28, 0xA9, 0x28, 0x0B, 0xA4, 0xA6, 0x0A, 0x84, 0x78, 0x0E,
+    0xA1, 0xC0, 0x4E, 0x84, 0x3C, 0xFB, 0xF1, 0x31, 0xC6, 0x53, 0x1A, 0x75, 0xA1, 0x5B, 0xD5, 0x91,
+    0xE1, 0x9D, 0xFD, 0x4A, 0x14, 0x77, 0x95, 0x44, 0x62, 0xCE, 0x99, 0x10, 0x79, 0x8A, 0xBD, 0x9A,
+    0xA4, 0x50, 0x47, 0xAB, 0x97, 0xBD, 0x44, 0x24, 0x26, 0x14, 0x6D, 0xCE, 0x48, 0x67, 0x49, 0x26,
+    0x69, 0x72, 0x49, 0xC7, 0x9B, 0x56, 0x40, 0x6E, 0x25, 0xEE, 0x96, 0x01, 0x84, 0xCE, 0x20, 0x90,
+    0x21, 0x48, 0x00, 0x56, 0x7D, 0xCA, 0x32, 0xA7, 0xF8, 0xA1, 0x3F, 0x78, 0xDE, 0x5E, 0x87, 0x07,
+    0x8A, 0xCE, 0xF2, 0x72, 0x16, 0x10, 0xA4, 0x0B, 0x4D, 0x0C, 0x22, 0x6B, 0x8A, 0xB7, 0x14, 0xC9,
+    0x2E, 0x11, 0xF2, 0x09, 0x1C, 0xF6, 0xC0, 0xC4, 0x1E, 0xCB, 0x65, 0xFC, 0x35, 0xA0, 0x1E, 0x11,
+    0x2A, 0xAF, 0x1A, 0xC6, 0x65, 0x09, 0x98, 0xB9, 0xF8, 0x46, 0x3F, 0xF6, 0xC9, 0xD5, 0x63, 0x86,
+    0xFA, 0xAF, 0xD0, 0x58, 0x3A, 0xD5, 0xC3, 0xCF, 0xE1, 0x94, 0x22, 0xE7, 0x34, 0xC8, 0x00, 0xB3,
+    0x70, 0x1A, 0x89, 0x99, 0x19, 0x03, 0x51, 0x82, 0x29, 0x31, 0x33, 0x60, 0x29, 0x26, 0x3B, 0x24,
+    0x9D, 0xCB, 0x61, 0x0F, 0x1D, 0xB9, 0xB6, 0xE8, 0xCE, 0xB4, 0xA4, 0x81, 0xF2, 0xB9, 0x23, 0xC6,
+    0x3D, 0xB5, 0xB0, 0x6C, 0x4D, 0x41, 0xE5, 0x13, 0x01, 0xA1, 0xF1, 0x83, 0x54, 0xB8, 0x2A, 0x72,
+    0x3E, 0x17, 0x14, 0x87, 0x7F, 0xD6, 0xCA, 0x45, 0x2F, 0xFD, 0x0F, 0x08, 0x7A, 0x58, 0x95, 0x93,
+    0x40, 0x7D, 0x6C, 0xFF, 0x3B, 0x04, 0x7E, 0x74, 0xD1, 0x2C, 0x5A, 0x37, 0x16, 0x7E, 0xFD, 0x0C,
+    0xA1, 0x0E, 0x4B, 0x70, 0x40, 0x8A, 0xE0, 0x90, 0x62, 0x66, 0x32, 0x74, 0xA2, 0x00, 0xD3, 0x77,
+    0x24, 0x8E, 0xB2, 0x8C, 0xDC, 0xAF, 0x03, 0x60, 0xAE, 0x99, 0xDF, 0x51, 0x00, 0xD2, 0xE1, 0xFE,
+    0x1E, 0x0C, 0xE7, 0x65, 0xCB, 0xA6, 0x1C, 0xCF, 0x46, 0x26, 0x8F, 0xCA, 0x83, 0x0D, 0x0E, 0x17,
+    0x00, 0x17, 0x73, 0xAB, 0x80, 0xEB, 0x13, 0xF7, 0xB4, 0x00, 0x8E, 0xE2, 0xCE, 0xD7, 0x44, 0xE5,
+    0x5B, 0xCE, 0x59, 0xF2, 0xBF, 0x25, 0x25, 0x5E, 0x67, 0xDF, 0x54, 0x7C, 0x6B, 0x68, 0x0F, 0xC1,
+    0x67, 0x03, 0xEB, 0xC3, 0xF1, 0x6D, 0xDD, 0xBA, 0x96, 0x57, 0x74, 0xA0, 0x7B, 0x5C, 0x3D, 0xFE,
+    0xB4, 0x7C, 0xF7, 0xFD, 0xFA, 0xF9, 0x01, 0x2D, 0x5C, 0x70, 0x8D, 0x9C, 0x0C, 0x88, 0x56, 0x63,
+    0x37, 0xC9, 0x3E, 0xDB, 0x59, 0xE6, 0x5B, 0xEE, 0x96, 0x2B, 0xE7, 0xD2, 0xF9, 0x4B, 0x77, 0x1E,
+    0x20, 0x08, 0xBF, 0x39, 0xBE, 0x6F, 0xAC, 0x5D, 0x7F, 0xF6, 0xFC, 0x36, 0x89, 0x27, 0xF7, 0xAA,
+    0x61, 0xA0, 0xB9, 0xB2, 0xAC, 0x92, 0xE9, 0xF5, 0x96, 0x1E, 0xAE, 0x0E, 0x34, 0x82, 0x76, 0xDB,
+    0xD6, 0x02, 0xCF, 0x56, 0x5C, 0x8B, 0x32, 0xF1, 0x39, 0x16, 0xE9, 0xC4, 0xF7, 0x1D, 0x6E, 0xE6,
+    0x07, 0xC1, 0xA7, 0x71, 0x59, 0x84, 0x46, 0x6E, 0x5A, 0x7A, 0x27, 0x95, 0x79, 0xAC, 0x44, 0x89,
+    0x86, 0x52, 0x8B, 0x67, 0xBE, 0xD5, 0xBB, 0x27, 0xA8, 0x13, 0xA0, 0x8A, 0xCD, 0x1C, 0xBD, 0xBD,
+    0x52, 0x34, 0x6B, 0x23, 0x44, 0x19, 0xCE, 0x07, 0x5F, 0xEF, 0x57, 0x2F, 0x13, 0x13, 0x67, 0xBA,
+    0x27, 0x61, 0x84, 0xD7, 0xEF, 0x39, 0xB4, 0x93, 0xF5, 0xD8, 0xD8, 0xF3, 0x44, 0x27, 0x4E, 0x5D,
+    0x7F, 0x81, 0xE6, 0x8B, 0xB1, 0xB3, 0x0B, 0x6B, 0xB4, 0x28, 0x6E, 0xFE, 0x51, 0x8B, 0x2B, 0x1F,
+    0x7D, 0x77, 0xFB, 0x4F, 0x70, 0xD8, 0xE2, 0x63, 0x3B, 0x41, 0x7B, 0xAA, 0x28, 0xA5, 0x62, 0xB4,
+    0x2B, 0x2E, 0xF4, 0xE5, 0x07, 0x03, 0x62, 0xFB, 0x95, 0xC9, 0xB6, 0x34, 0xCD, 0xF1, 0x1B, 0xA6,
+    0xBE, 0x9C, 0x50, 0x32, 0x91, 0x4D, 0xB7, 0xDF, 0xEF, 0xBF, 0x48, 0xDB, 0x1B, 0x49, 0x5A, 0x18,
+    0x54, 0x0F, 0x03, 0xC9, 0x03, 0x5F, 0x57, 0x59, 0xC9, 0x7F, 0xD1, 0x3D, 0x34, 0xCE, 0x27, 0xE4,
+    0xC7, 0x5F, 0xD8, 0xDD, 0x6A, 0xD1, 0xC5, 0x5E, 0xDA, 0xC5, 0xE2, 0x8A, 0xFB, 0x79, 0x2D, 0x15,
+    0x5B, 0xD1, 0xFD, 0xF1, 0xDD, 0xF2, 0x47, 0x2D, 0xDD, 0x4D, 0x67, 0x57, 0x86, 0x67, 0xBA, 0xE7,
+    0xBD, 0x59, 0x6F, 0x9B, 0x5E, 0x7C, 0xD1, 0xD5, 0x58, 0xB9, 0xB6, 0x1A, 0x4F, 0x92, 0xA6, 0x83,
+    0x91, 0xD5, 0x45, 0xC5, 0x56, 0x85, 0x5D, 0xFE, 0xED, 0x95, 0x1F, 0x9E, 0xA2, 0x93, 0x83, 0x6B,
+    0x22, 0x7C, 0xEB, 0x88, 0xF8, 0x73, 0xFD, 0xD1, 0x36, 0x85, 0x8A, 0xAE, 0xA1, 0x65, 0xB2, 0x63,
+    0x2F, 0xA1, 0x70, 0x4F, 0xF7, 0x7A, 0xD1, 0xF7, 0xA5, 0x6C, 0xA4, 0x1D, 0x8D, 0xEA, 0x21, 0xFB,
+    0x1C, 0x61, 0xCD, 0xDA, 0xAA, 0x7F, 0x73, 0x39, 0x9D, 0xB5, 0x06, 0x12, 0x6F, 0xBC, 0x36, 0xBE,
+    0xB1, 0x6F, 0xAA, 0xBA, 0xE3, 0x99, 0x2F, 0xF6, 0xDC, 0x87, 0x5F, 0x05, 0xC6, 0xBF, 0x54, 0x4F,
+    0x10, 0x9D, 0xA2, 0xA0, 0xD9, 0x65, 0xAE, 0x43, 0x5F, 0xC2, 0xA1, 0x05, 0x05, 0xC0, 0x8E, 0x92,
+    0x86, 0xFE, 0xBB, 0x44, 0xE7, 0x88, 0x00, 0xF7, 0xF4, 0x31, 0xBF, 0x2D, 0x4D, 0x8B, 0xCD, 0x3B,
+    0xE5, 0x68, 0x30, 0xD4, 0x69, 0xE4, 0x02, 0xCB, 0x5D, 0x93, 0x6D, 0x3A, 0x14, 0x0A, 0x54, 0xFD,
+    0x89, 0xE9, 0xC3, 0x32, 0xC2, 0xE3, 0xAB, 0xA7, 0xA3, 0xA6, 0x1B, 0xBF, 0x69, 0xA3, 0xC8, 0x9B,
+    0x37, 0xD6, 0x5A, 0x3E, 0x30, 0xA3, 0xAC, 0x3C, 0xBD, 0xF8, 0xCF, 0xF7, 0xE9, 0xE1, 0xF8, 0x0B,
+    0x9D, 0x55, 0x31, 0x8F, 0x1D, 0x35, 0x10, 0x9E, 0x5D, 0xE7, 0xE2, 0x62, 0x25, 0x7C, 0x45, 0x42,
+    0x81, 0x84, 0x96, 0x92, 0xE2, 0x12, 0xB7, 0x14, 0xC7, 0xB3, 0x45, 0x4A, 0x8A, 0x5C, 0x91, 0xA3,
+    0xC9, 0x1F, 0x48, 0x77, 0x2D, 0x45, 0xEE, 0x76, 0x51, 0x0A, 0xCA, 0xA4, 0x80, 0xFE, 0xE8, 0xA2,
+    0x50, 0x5C, 0x43, 0x71, 0xC5, 0x7B, 0xF7, 0x1C, 0xA5, 0xA0, 0xA0, 0xB8, 0x0D, 0x57, 0x52, 0x60,
+    0x44, 0x50, 0x44, 0x28, 0xE2, 0x08, 0x87, 0x2C, 0xC1, 0xBB, 0xC3, 0xE7, 0xBD, 0xBB, 0xE8, 0x51,
+    0x21, 0x65, 0xA5, 0x7D, 0xCF, 0x6B, 0x7B, 0xC6, 0x33, 0xDF, 0xF7, 0xCD, 0xF8, 0x12, 0x5D, 0xA1,
+    0xFF, 0x7D, 0x4A, 0x92, 0x2D, 0xD1, 0x07, 0x1F, 0x5E, 0xC8, 0x1F, 0x1D, 0x15, 0x3F, 0x3E, 0xA1,
+    0xA6, 0x64, 0xEE, 0x68, 0x7B, 0x8B, 0x68, 0xDB, 0x92, 0xE1, 0x5E, 0x74, 0xC5, 0xD1, 0x06, 0xD1,
+    0xC6, 0xAA, 0xD9, 0x47, 0xD8, 0xC3, 0x83, 0xC2, 0x4F, 0xCC, 0x5F, 0xE7, 0xD3, 0x73, 0x22, 0x11,
+    0x88, 0x54, 0xB7, 0xB2, 0x75, 0xC9, 0x4E, 0x71, 0x2C, 0x5E, 0x5A, 0xD2, 0x58, 0xF5, 0x44, 0x7B,
+    0xDB, 0x54, 0xB1, 0x27, 0x4E, 0xA4, 0x5A, 0x2A, 0x60, 0x6F, 0x1E, 0xEC, 0x0B, 0x66, 0x6A, 0x38,
+    0x54, 0xF8, 0x23, 0xF1, 0x4B, 0xA0, 0xFA, 0xAE, 0xA3, 0xA1, 0xA1, 0xF2, 0x9B, 0xFB, 0xE7, 0x6E,
+    0x2E, 0xF2, 0x80, 0x60, 0x02, 0x8D, 0x5F, 0x53, 0xE5, 0x60, 0x83, 0xA9, 0xE1, 0x16, 0x49, 0xCC,
+    0x68, 0x6E, 0x29, 0x11, 0x49, 0xB8, 0xD6, 0xCF, 0xF6, 0x09, 0xC1, 0x4B, 0xB8, 0xD1, 0xF0, 0x9F,
+    0x1F, 0xC4, 0xD8, 0x21, 0xCC, 0x2F, 0x16, 0xC8, 0x35, 0x87, 0x86, 0x6C, 0x77, 0x31, 0xE4, 0x1E,
+    0x2B, 0x3D, 0x99, 0x6B, 0xA1, 0x88, 0xD2, 0x55, 0x4E, 0xD3, 0xAC, 0xE8, 0xA9, 0x6F, 0x9C, 0x7C,
+    0x3C, 0xD0, 0xBB, 0x6B, 0x16, 0x96, 0x05, 0x5E, 0x58, 0x00, 0x44, 0xE9, 0x56, 0xF2, 0xA9, 0xE0,
+    0x98, 0xD9, 0xD5, 0x76, 0xF2, 0x67, 0x4E, 0x33, 0xDE, 0xC3, 0x3C, 0x92, 0xC6, 0x91, 0xB5, 0xA3,
+    0xB2, 0xC7, 0xBC, 0x9D, 0xE6, 0xE9, 0xE2, 0x48, 0xD8, 0x0D, 0x44, 0xF6, 0xB0, 0x38, 0x47, 0xE4,
+    0x5B, 0x48, 0xA2, 0x60, 0x6E, 0xCF, 0x93, 0x18, 0x0B, 0x46, 0xF2, 0x11, 0x99, 0x03, 0xA6, 0x04,
+    0xEF, 0xF6, 0xEC, 0x9C, 0xCB, 0xF0, 0xC5, 0xAE, 0xC4, 0x5C, 0xDD, 0xAD, 0xBF, 0x41, 0xF6, 0x6F,
+    0x9A, 0xF2, 0xC5, 0x0A, 0x15, 0x79, 0xEB, 0x58, 0x78, 0x19, 0x6B, 0x18, 0x33, 0xB2, 0x59, 0xE2,
+    0x30, 0x1C, 0x93, 0x8A, 0x58, 0x06, 0x11, 0x84, 0x97, 0x5D, 0xE5, 0x94, 0x53, 0xAD, 0x6E, 0x8D,
+    0x6D, 0xA8, 0x21, 0x8A, 0x51, 0x7E, 0xEF, 0x8C, 0x79, 0x93, 0x8B, 0x72, 0x88, 0x01, 0x14, 0x54,
+    0xF9, 0x9F, 0x7A, 0x92, 0x5D, 0x26, 0x29, 0x65, 0x9A, 0x74, 0x4B, 0x03, 0xC9, 0x90, 0xF3, 0x01,
+    0x14, 0xFD, 0xB4, 0x37, 0x6F, 0x2A, 0xE3, 0xE9, 0x70, 0xEF, 0x3F, 0xC3, 0x29, 0x36, 0x0C, 0x17,
+    0xD3, 0x70, 0x5D, 0xB7, 0x45, 0xA6, 0x17, 0x2C, 0x37, 0x08, 0xE9, 0xB2, 0x9D, 0x78, 0xF0, 0x88,
+    0x18, 0x5F, 0x5A, 0x00, 0xA1, 0x6E, 0x93, 0x68, 0x13, 0xB0, 0x0A, 0x77, 0x48, 0x74, 0xA8, 0xD8,
+    0x2A, 0xCB, 0x43, 0x11, 0x6A, 0xE1, 0xAF, 0x96, 0x7E, 0x26, 0xBA, 0xD9, 0xCE, 0xC3, 0x24, 0xB8,
+    0x37, 0xED, 0x72, 0x28, 0xEF, 0x9D, 0x47, 0x5B, 0xF8, 0x35, 0x6C, 0x86, 0xF9, 0xC7, 0xE0, 0xA5,
+    0xA6, 0xCF, 0x11, 0xF6, 0x15, 0x02, 0x78, 0xBF, 0x03, 0x61, 0x0E, 0xB7, 0xCB, 0x97, 0x8B, 0xAB,
+    0xF4, 0x9D, 0xBA, 0x6E, 0x37, 0xE5, 0x23, 0x57, 0xDF, 0x7C, 0x01, 0x35, 0xC5, 0x43, 0xC1, 0xFE,
+    0xD2, 0x99, 0x39, 0x76, 0xA6, 0x86, 0xF9, 0x87, 0x8C, 0x94, 0x39, 0xD5, 0xCB, 0x30, 0x69, 0x35,
+    0x87, 0xA5, 0x39, 0x8A, 0x41, 0xB5, 0x86, 0xA2, 0x0C, 0xCA, 0x1E, 0x95, 0x41, 0x75, 0xA6, 0x48,
+    0x59, 0xAE, 0xB4, 0x0E, 0x53, 0xA4, 0x86, 0x88, 0x4B, 0x7F, 0xAA, 0x72, 0xED, 0xC4, 0x0B, 0xD0,
+    0x72, 0xDD, 0x51, 0x1A, 0x48, 0x3C, 0x07, 0x68, 0x70, 0x84, 0xFC, 0x64, 0x4E, 0x0F, 0x50, 0xA1,
+    0x28, 0x24, 0x5E, 0xB3, 0x13, 0x28, 0x99, 0x50, 0xF9, 0x65, 0x38, 0x05, 0x2B, 0xBF, 0x22, 0x4E,
+    0x3E, 0x12, 0xDD, 0x10, 0x5E, 0xF9, 0xDA, 0x2E, 0xED, 0x5C, 0x26, 0x11, 0x9A, 0xA0, 0xEE, 0x70,
+    0x3B, 0x37, 0x83, 0xF8, 0xF3, 0x55, 0x50, 0x07, 0x3B, 0xAE, 0x89, 0x63, 0xC9, 0x5F, 0x46, 0x95,
+    0x8C, 0x6B, 0x1C, 0x97, 0x43, 0x05, 0xBB, 0x35, 0xB2, 0xF4, 0x7A, 0x01, 0x28, 0x5B, 0xD2, 0xAB,
+    0x25, 0x76, 0x99, 0x2E, 0x15, 0x41, 0x82, 0xE8, 0x9E, 0x92, 0x26, 0xF5, 0xA8, 0xA3, 0xA3, 0x39,
+    0x22, 0x00, 0x5F, 0x9E, 0x04, 0x34, 0x09, 0x2E, 0x33, 0x41, 0x88, 0x15, 0xB2, 0x31, 0x81, 0xE4,
+    0x93, 0x33, 0xFA, 0xAD, 0x81, 0x50, 0xBC, 0xA1, 0x5D, 0xE1, 0x2B, 0xB7, 0x4B, 0x3D, 0xE4, 0x62,
+    0x53, 0x11, 0xA0, 0x98, 0x22, 0x0A, 0xAF, 0x31, 0x0F, 0x65, 0x19, 0x4E, 0xE5, 0xC1, 0x33, 0x4B,
+    0x99, 0x6D, 0x18, 0xED, 0x67, 0x4B, 0xA8, 0x04, 0xDA, 0x20, 0x28, 0x50, 0x23, 0xD7, 0xE3, 0x96,
+    0xFA, 0x9E, 0xB4, 0x72, 0xD2, 0x43, 0x7D, 0xCA, 0xA1, 0xF6, 0xE4, 0x54, 0x76, 0x83, 0x69, 0xD5,
+    0x53, 0xD4, 0x2C, 0x6D, 0xDF, 0x80, 0x90, 0xC5, 0xCB, 0x2D, 0x00, 0x0A, 0x8D, 0x55, 0x90, 0x3F,
+    0x7B, 0x75, 0x27, 0xA8, 0xC2, 0xD7, 0xA2, 0xD3, 0xF9, 0x0C, 0x32, 0x08, 0x6A, 0x1B, 0x85, 0x19,
+    0x84, 0xDB, 0x14, 0xED, 0xA6, 0xB4, 0x87, 0x79, 0x0F, 0xB7, 0xEF, 0x7C, 0xE6, 0xDF, 0xA7, 0xB0,
+    0x51, 0x86, 0xD9, 0x41, 0x68, 0xB8, 0x5B, 0x8E, 0xF6, 0xAD, 0x0A, 0x11, 0xFA, 0x2B, 0xD0, 0x42,
+    0xF4, 0x4D, 0x27, 0xFC, 0x9C, 0x6E, 0x2B, 0x14, 0x60, 0xA4, 0xBE, 0xB6, 0xEA, 0x93, 0x50, 0x06,
+    0x43, 0x0B, 0xE9, 0x9B, 0x67, 0xFC, 0x29, 0x74, 0xB4, 0xE4, 0xB1, 0x42, 0x43, 0xB8, 0x45, 0xF7,
+    0x57, 0x4E, 0xB1, 0xF5, 0x8D, 0xE9, 0x94, 0x19, 0xF2, 0xFE, 0x6D, 0x2B, 0x17, 0x9A, 0x02, 0x94,
+    0x70, 0x8F, 0xD3, 0xC5, 0xEB, 0x07, 0xB9, 0x33, 0xE5, 0xA6, 0xB3, 0x44, 0x3B, 0xA2, 0x2A, 0xF0,
+    0xE3, 0x04, 0x78, 0xF8, 0x51, 0x04, 0xDB, 0x7C, 0xB7, 0xA3, 0x72, 0xE0, 0x06, 0x7D, 0x67, 0xE4,
+    0x23, 0xCA, 0xDD, 0x20, 0x4D, 0x5D, 0x31, 0x07, 0x65, 0xD8, 0x9D, 0x76, 0xC8, 0x49, 0x9D, 0x21,
+    0x57, 0x3C, 0xC4, 0x49, 0xCB, 0xE3, 0xA7, 0x23, 0xF8, 0x53, 0x27, 0x6C, 0x75, 0xAA, 0x1F, 0x62,
+    0x79, 0x79, 0x4F, 0xB2, 0xBB, 0xA0, 0x2C, 0xA4, 0x0F, 0xC6, 0x10, 0x4E, 0xCC, 0xBD, 0x49, 0x74,
+    0x6D, 0x23, 0x38, 0xA1, 0x19, 0x64, 0xD5, 0xBD, 0xAD, 0xAA, 0xC8, 0xAE, 0x93, 0xFA, 0x16, 0x15,
+    0x0F, 0xC1, 0xE8, 0x49, 0xE1, 0x22, 0x14, 0x5B, 0xA8, 0x85, 0x76, 0xB7, 0x1C, 0xCA, 0x50, 0x07,
+    0x85, 0x08, 0x66, 0x6A, 0x2C, 0x03, 0x47, 0x75, 0xFC, 0xB3, 0x9B, 0x2D, 0x96, 0x05, 0x9F, 0xF4,
+    0xD5, 0x58, 0x77, 0x26, 0x30, 0xDA, 0x57, 0xAA, 0x62, 0x96, 0xA3, 0xAE, 0x20, 0xF7, 0x86, 0xE4,
+    0x49, 0x20, 0x03, 0xD4, 0xFF, 0x89, 0x53, 0x33, 0x33, 0x3D, 0xEA, 0xAB, 0xA5, 0x0A, 0xA5, 0x61,
+    0x06, 0xCA, 0x14, 0xA8, 0x9F, 0x12, 0x19, 0x95, 0xCA, 0x5E, 0x03, 0x88, 0x35, 0xDC, 0x33, 0x19,
+    0x05, 0x80, 0x27, 0x3D, 0x34, 0x04, 0xF2, 0x92, 0xA1, 0xAC, 0x23, 0x0D, 0xA1, 0x40, 0xCD, 0xB2,
+    0xC3, 0x6E, 0xE9, 0xCB, 0xA4, 0xAD, 0xC6, 0x70, 0x10, 0xFE, 0xEC, 0x5A, 0x01, 0xE3, 0xC6, 0x69,
+    0xA7, 0x42, 0xED, 0x65, 0x52, 0x51, 0xF0, 0x75, 0x10, 0xF5, 0x07, 0xD3, 0x1E, 0x3F, 0x77, 0xDA,
+    0xBC, 0xF2, 0xEA, 0xF8, 0xAF, 0x28, 0x7E, 0x4D, 0xA9, 0x8C, 0x70, 0x88, 0x6A, 0x45, 0x6D, 0x57,
+    0xDD, 0xF9, 0x35, 0xB5, 0x9B, 0xBB, 0x31, 0xBA, 0x1A, 0x56, 0x51, 0xE5, 0xA1, 0xEC, 0xD1, 0x2E,
+    0x63, 0xE5, 0x51, 0xFB, 0xAF, 0x0F, 0x02, 0xAE, 0x0C, 0x0F, 0x22, 0xA0, 0x4B, 0x08, 0xB3, 0x05,
+    0x52, 0x16, 0x7D, 0x88, 0x1A, 0x4B, 0xC5, 0xF2, 0x1E, 0x78, 0x1A, 0x49, 0x0C, 0x3B, 0x9D, 0xC8,
+    0x86, 0xA8, 0x71, 0x88, 0x40, 0xB9, 0x05, 0xE5, 0x2A, 0x2A, 0x23, 0x5A, 0x60, 0x92, 0xFD, 0x45,
+    0xF4, 0x74, 0x48, 0xC6, 0xE4, 0x2E, 0x8F, 0x97, 0x76, 0xC6, 0xF3, 0x3A, 0xDD, 0xB6, 0x0A, 0x00,
+    0x64, 0xD1, 0xD2, 0x1C, 0x2D, 0xA6, 0x9D, 0xA1, 0xDD, 0x74, 0x9A, 0xE6, 0x22, 0x28, 0x37, 0xA3,
+    0x5E, 0x76, 0xB5, 0xCD, 0xF3, 0x0E, 0x5E, 0xCB, 0xFD, 0xF7, 0x26, 0xA1, 0xCB, 0xCC, 0x3E, 0x2E,
+    0x90, 0xB6, 0x2F, 0x62, 0xD5, 0x6A, 0x44, 0x3A, 0x5D, 0x95, 0x1D, 0x9A, 0x1B, 0x8D, 0x5F, 0xAD,
+    0xA8, 0x5C, 0xC6, 0x0C, 0xCA, 0xCA, 0xF3, 0x2F, 0x75, 0x55, 0x3F, 0x8C, 0x14, 0x55, 0x1C, 0xFE,
+    0xDE, 0x3C, 0x60, 0x0C, 0x2F, 0xE1, 0x5D, 0xA1, 0x26, 0x16, 0xDC, 0xB3, 0x54, 0x72, 0x30, 0x16,
+    0x16, 0x98, 0xEC, 0xEE, 0x0C, 0x5C, 0x61, 0x89, 0x85, 0x56, 0x24, 0xD2, 0xDB, 0x10, 0x12, 0x8A,
+    0x33, 0xEE, 0xDD, 0x0C, 0x52, 0x5A, 0x40, 0x61, 0xB4, 0x94, 0xC2, 0xEA, 0x88, 0xF1, 0x8A, 0x2B,
+    0x28, 0x96, 0x9B, 0x77, 0x77, 0x05, 0x05, 0x05, 0x03, 0xA8, 0x8D, 0x05, 0x0F, 0x8C, 0x14, 0x52,
+    0xF0, 0xD0, 0xD1, 0x3C, 0xB8, 0xD9, 0xFD, 0xF9, 0x7B, 0xB3, 0x68, 0x82, 0x7F, 0x26, 0xBB, 0xD9,
+    0xDD, 0x99, 0xF7, 0xFD, 0xFE, 0x7D, 0xDF, 0xEF, 0x5B, 0x80, 0x2F, 0x51, 0x3B, 0x94, 0x54, 0x29,
+    0xEA, 0x50, 0x5F, 0x5E, 0x48, 0x5B, 0x20, 0x2F, 0x90, 0x74, 0x80, 0x76, 0xFC, 0xB5, 0x82, 0x20,
+    0xBC, 0x2E, 0x89, 0xAC, 0xA6, 0x19, 0x0C, 0xB5, 0xC8, 0xA8, 0x41, 0x4E, 0x74, 0x83, 0xA8, 0xAB,
+    0x89, 0x2A, 0xC9, 0xA7, 0xAE, 0xF3, 0x61, 0x0B, 0x30, 0xC6, 0x54, 0x90, 0x31, 0x02, 0x90, 0x7A,
+    0x60, 0x8B, 0xEF, 0x37, 0x10, 0x1D, 0xFA, 0x2B, 0xC3, 0x58, 0x04, 0x5D, 0xE9, 0x6D, 0x8F, 0x6E,
+    0x08, 0xF5, 0xA3, 0x45, 0xD9, 0x42, 0xCE, 0xF8, 0xB4, 0x45, 0x12, 0x7A, 0x10, 0x9F, 0xCE, 0x3B,
+    0x48, 0x02, 0xD6, 0x0A, 0xCC, 0x8B, 0xA3, 0x13, 0xCF, 0x9E, 0x6E, 0xFA, 0xEE, 0xD0, 0xF9, 0x5C,
+    0x9F, 0xA9, 0x69, 0x97, 0xA8, 0x29, 0xA9, 0x89, 0x21, 0xB7, 0xFA, 0x42, 0x39, 0x6F, 0xCC, 0x84,
+    0x11, 0x4C, 0xA1, 0xAD, 0xA9, 0x12, 0xCE, 0x80, 0x9C, 0xEF, 0xEA, 0x7B, 0x1C, 0x95, 0xB8, 0xAA,
+    0xB2, 0x99, 0xB7, 0xA2, 0x63, 0x4B, 0x54, 0x41, 0x3F, 0xF6, 0xD0, 0x0F, 0xA6, 0x30, 0x3E, 0xB7,
+    0xC6, 0x6B, 0xAE, 0x76, 0x41, 0x14, 0xBA, 0x1A, 0xA3, 0x55, 0x95, 0x41, 0x9B, 0x78, 0x8D, 0x51,
+    0xE2, 0x65, 0x33, 0xC2, 0x58, 0x36, 0xDA, 0x8E, 0x11, 0x38, 0x6E, 0x11, 0x12, 0x22, 0x97, 0x53,
+    0x17, 0x27, 0x01, 0x31, 0x6F, 0x31, 0xD6, 0x57, 0xBC, 0xBC, 0x28, 0xDC, 0xA6, 0x5A, 0xB6, 0x83,
+    0xC3, 0xC2, 0x6F, 0xE8, 0x8B, 0xDB, 0x53, 0x4D, 0xDE, 0x90, 0x7D, 0xED, 0x0C, 0x70, 0x0D, 0xB2,
+    0x81, 0x06, 0x5E, 0xC6, 0x3E, 0xEE, 0x78, 0x84, 0x30, 0x1E, 0x0A, 0x3F, 0x19, 0x27, 0x3E, 0x4C,
+    0xA4, 0x6B, 0x43, 0x7A, 0xDB, 0xB7, 0x6A, 0xC7, 0x7B, 0xBD, 0x7B, 0xDF, 0xEB, 0x8B, 0x77, 0x9C,
+    0x49, 0x77, 0x9B, 0x8C, 0xC3, 0xF3, 0x70, 0xED, 0x91, 0xF5, 0xF5, 0x02, 0xDD, 0x9B, 0x19, 0xC2,
+    0xEA, 0x48, 0xB4, 0x93, 0x21, 0x63, 0xC6, 0x8C, 0xB9, 0x26, 0x19, 0x93, 0x32, 0x46, 0x45, 0xCC,
+    0xF2, 0x1D, 0xA7, 0xE7, 0x98, 0x36, 0x9F, 0xBF, 0x79, 0x12, 0x9C, 0x12, 0x8A, 0xDB, 0x3E, 0x58,
+    0xF0, 0x24, 0x4B, 0xEE, 0x79, 0x05, 0xE0, 0x72, 0x3D, 0xF3, 0xE8, 0x12, 0xAE, 0xBF, 0x19, 0x4B,
+    0x3B, 0x49, 0x7F, 0x08, 0x8A, 0x7C, 0x9C, 0xC6, 0xBC, 0x0B, 0x3E, 0xC0, 0x20, 0x15, 0xBB, 0x1A,
+    0x00, 0x41, 0x38, 0xA4, 0x8D, 0x2A, 0x98, 0x31, 0xFE, 0xD5, 0x31, 0x50, 0x3A, 0x3E, 0x6E, 0x8A,
+    0x61, 0x6A, 0x3B, 0xF8, 0x4C, 0x7A, 0xC6, 0x1B, 0x9B, 0x91, 0x9D, 0x81, 0x42, 0xE4, 0xBB, 0xBF,
+    0xAE, 0x40, 0x5A, 0x2C, 0x02, 0x9B, 0xF1, 0xD3, 0xCC, 0x50, 0x13, 0x27, 0xD3, 0x89, 0x5F, 0x3D,
+    0xFB, 0x29, 0x75, 0xCF, 0x73, 0x1D, 0x78, 0xCA, 0x75, 0xB0, 0x8E, 0x2E, 0x4C, 0xD1, 0x8A, 0xB0,
+    0x1F, 0xD2, 0x09, 0x8A, 0xDA, 0x9B, 0x02, 0x89, 0x8F, 0x2A, 0x22, 0x31, 0x4D, 0x29, 0x96, 0x46,
+    0x45, 0x1E, 0xC5, 0xF6, 0xEC, 0x79, 0x70, 0x08, 0x88, 0xA6, 0x74, 0xF2, 0x0E, 0x27, 0xBC, 0xE9,
+    0xC6, 0xE9, 0xA5, 0x6A, 0xA0, 0x08, 0x03, 0x3D, 0xC5, 0x0A, 0x13, 0x1B, 0xCC, 0x24, 0xF1, 0x4B,
+    0x6B, 0xA7, 0xFD, 0xA0, 0x24, 0x7B, 0x3C, 0xA7, 0xE2, 0xBC, 0x0A, 0xCF, 0x71, 0xB5, 0x67, 0xC5,
+    0x5A, 0xE1, 0x8F, 0x41, 0x17, 0x21, 0x52, 0x2A, 0x5A, 0x83, 0x94, 0xC5, 0xCE, 0x3C, 0x71, 0x89,
+    0x55, 0xDA, 0x4C, 0x91, 0x4B, 0x9F, 0x74, 0x99, 0x35, 0x8E, 0x40, 0xCB, 0xE1, 0xEF, 0x8C, 0x33,
+    0x97, 0xD1, 0x05, 0xBF, 0xAA, 0xD1, 0x6E, 0xCA, 0x5D, 0x5B, 0x6A, 0xEA, 0x32, 0x72, 0xD9, 0xBD,
+    0xB9, 0x32, 0xF1, 0x12, 0xC4, 0xD9, 0x22, 0x21, 0x07, 0x8E, 0xC5, 0x42, 0x54, 0xDF, 0x03, 0x44,
+    0xBC, 0x21, 0x21, 0x99, 0xF2, 0x6C, 0x8A, 0x4E, 0x7A, 0x53, 0xE5, 0xEF, 0xB6, 0x09, 0xB7, 0x1B,
+    0x9B, 0xCF, 0x2E, 0xB3, 0x1C, 0x2B, 0x7D, 0xB5, 0x5A, 0x59, 0x4C, 0xF6, 0xE2, 0xE8, 0x57, 0xF4,
+    0xC9, 0x87, 0x13, 0x4D, 0xAE, 0x9C, 0xF1, 0x83, 0xA9, 0x64, 0x6A, 0xE2, 0xD4, 0x23, 0x77, 0xBA,
+    0x7F, 0x65, 0x55, 0x0C, 0x3B, 0x97, 0x59, 0x1C, 0x67, 0x3E, 0xC5, 0x78, 0x82, 0xD0, 0xA1, 0x0D,
+    0xF2, 0x49, 0xAB, 0x77, 0x7C, 0x4D, 0xD3, 0x9A, 0xBA, 0xAD, 0xF5, 0xF6, 0x5A, 0x1C, 0x1D, 0xEF,
+    0x57, 0x23, 0x66, 0x6D, 0x7A, 0x7F, 0x45, 0x53, 0x30, 0xEB, 0x9F, 0x67, 0x58, 0xC8, 0xE2, 0x1C,
+    0x99, 0xF4, 0x22, 0x69, 0x47, 0xF2, 0x76, 0x40, 0x97, 0xAB, 0x1B, 0xDC, 0x73, 0xAE, 0xBF, 0xB2,
+    0xC8, 0xCB, 0xAC, 0x8C, 0xFB, 0xC0, 0x22, 0xE1, 0x69, 0xF0, 0x90, 0xB8, 0x88, 0xB8, 0x2D, 0xBD,
+    0xBE, 0xB9, 0x8B, 0x28, 0xA5, 0xFA, 0xF1, 0x5E, 0xC7, 0x0F, 0xCD, 0x4F, 0x84, 0xAC, 0xCB, 0xB6,
+    0x79, 0x8A, 0x53, 0x7C, 0x61, 0xB1, 0x21, 0x36, 0x65, 0x07, 0x85, 0x2F, 0x6D, 0xED, 0x32, 0x87,
+    0xC4, 0x99, 0xA2, 0x35, 0x76, 0x60, 0xBC, 0x31, 0x41, 0x5D, 0xBA, 0x2E, 0x1F, 0xDF, 0x3A, 0x41,
+    0x37, 0x6C, 0xBD, 0xCB, 0xFB, 0xC5, 0xAB, 0xB3, 0xDA, 0xD7, 0xBF, 0xB0, 0x0F, 0xCF, 0xB6, 0x50,
+    0x77, 0x60, 0x00, 0x27, 0xA9, 0xAE, 0xA4, 0xCB, 0x4E, 0xA9, 0x46, 0x67, 0x76, 0xF1, 0x13, 0x7B,
+    0xEC, 0x51, 0x95, 0xDF, 0x2A, 0x72, 0x83, 0x55, 0xEE, 0x96, 0x7B, 0xFC, 0xC3, 0x8B, 0x3D, 0x9B,
+    0x10, 0x62, 0x96, 0x16, 0x4C, 0x71, 0x56, 0x56, 0x43, 0x06, 0xAE, 0x5F, 0x36, 0x5D, 0x72, 0xD7,
+    0x0E, 0x56, 0xE4, 0xCD, 0x62, 0xD3, 0x6B, 0x2D, 0x1E, 0xB8, 0xD5, 0xE1, 0x7E, 0xD1, 0xF3, 0xC1,
+    0x1B, 0x95, 0x9F, 0x6C, 0xCD, 0xED, 0x4E, 0x05, 0x92, 0xB3, 0xDA, 0xEE, 0xCD, 0xDC, 0xC7, 0xD3,
+    0x76, 0x54, 0x8E, 0xF5, 0x99, 0x3C, 0xDD, 0x39, 0xD5, 0x8B, 0x4F, 0x17, 0x63, 0xE1, 0x55, 0x95,
+    0xA1, 0x95, 0x8E, 0x93, 0x25, 0x5E, 0xFD, 0xB2, 0xC5, 0x9C, 0x35, 0x86, 0xBA, 0xA4, 0xD5, 0x36,
+    0x17, 0xA1, 0x1F, 0x22, 0x85, 0xD4, 0x4D, 0xF8, 0xAC, 0x41, 0xC8, 0x4E, 0xB7, 0x86, 0x9C, 0x26,
+    0x9B, 0x3C, 0x8D, 0xF3, 0x29, 0x78, 0x38, 0xBC, 0x8A, 0xFC, 0x40, 0xD9, 0xA1, 0x74, 0x99, 0x60,
+    0x54, 0x4C, 0xCC, 0x9F, 0xD5, 0xE4, 0x2F, 0xD9, 0x60, 0x44, 0xAC, 0xF1, 0x6F, 0xA1, 0xFC, 0x12,
+    0x13, 0xB8, 0x81, 0x4E, 0xDA, 0xD4, 0x2F, 0x22, 0xDB, 0x6B, 0xD1, 0x4B, 0x3D, 0x20, 0x7F, 0x05,
+    0x49, 0x3B, 0xB7, 0xCC, 0x35, 0x9E, 0xFB, 0x95, 0x39, 0x2C, 0x99, 0x0A, 0x6A, 0xD6, 0xA0, 0x2B,
+    0xC1, 0x8A, 0x45, 0xF2, 0xF4, 0xB2, 0x21, 0x9C, 0x65, 0x05, 0x76, 0x39, 0x85, 0x05, 0x8E, 0x1E,
+    0xE2, 0x1E, 0x33, 0xD3, 0x92, 0x5F, 0xBD, 0x52, 0xD8, 0x2C, 0xE3, 0x15, 0xD8, 0xAC, 0xB8, 0x24,
+    0x65, 0x03, 0xCC, 0x67, 0x4C, 0xEC, 0x90, 0x75, 0xE8, 0xB9, 0x5A, 0xE6, 0x35, 0xCC, 0x93, 0xAC,
+    0xF6, 0x6E, 0xCC, 0xEB, 0x82, 0x9C, 0xD3, 0xCE, 0x7A, 0x54, 0x83, 0x03, 0x2C, 0xCC, 0x7A, 0xAB,
+    0x66, 0x17, 0x1A, 0x0C, 0xD5, 0x05, 0xEF, 0x87, 0x7A, 0xF7, 0xE1, 0xEF, 0x53, 0xC5, 0xF3, 0x88,
+    0x35, 0xB2, 0x61, 0x20, 0x65, 0xEC, 0x31, 0x3E, 0xFB, 0x7E, 0x74, 0x08, 0x65, 0x59, 0x72, 0x18,
+    0x5F, 0x67, 0x85, 0xB0, 0x31, 0x34, 0x91, 0x1C, 0xC4, 0x7F, 0x82, 0x1A, 0xFA, 0x6E, 0x2B, 0x59,
+    0x00, 0xE8, 0x3D, 0x64, 0xA2, 0xAB, 0xA0, 0x59, 0x0F, 0x6C, 0x13, 0xC2, 0x0F, 0x13, 0x37, 0x90,
+    0xEC, 0xD7, 0x6D, 0x4D, 0xFE, 0xA3, 0xAB, 0x2E, 0x06, 0x54, 0xD5, 0xBE, 0x7D, 0x4B, 0x4B, 0x6F,
+    0x1F, 0x7F, 0xEB, 0xFC, 0x39, 0x5F, 0xFA, 0x23, 0x57, 0xD0, 0x08, 0x9B, 0xF8, 0xAF, 0x27, 0xD2,
+    0xB3, 0xAC, 0x7B, 0x73, 0x7B, 0xC2, 0x86, 0xF8, 0xE0, 0x3F, 0x0D, 0xF1, 0xDF, 0xE7, 0x5E, 0x30,
+    0xCE, 0xDE, 0x00, 0x8F, 0xAC, 0x73, 0x9E, 0xDE, 0x00, 0x63, 0xE7, 0xFB, 0xF1, 0x2A, 0x7B, 0x3C,
+    0x96, 0x70, 0x08, 0xF2, 0x3B, 0x41, 0x76, 0x63, 0x73, 0x30, 0xD4, 0x94, 0xCE, 0x47, 0x20, 0x58,
+    0x14, 0xC3, 0x94, 0xCD, 0x6A, 0x03, 0xE3, 0x43, 0x50, 0xC5, 0xCF, 0xF0, 0xA6, 0xD3, 0xC9, 0xCE,
+    0xB6, 0x3F, 0x3E, 0x18, 0xA5, 0x74, 0xB1, 0xA9, 0xDD, 0x78, 0x4E, 0x8D, 0x44, 0xCA, 0x7A, 0xD7,
+    0x2C, 0xBF, 0xA5, 0xC3, 0x83, 0xA3, 0x79, 0x57, 0xBA, 0xFE, 0x76, 0xD9, 0x1E, 0xEC, 0x1D, 0xEF,
+    0x80, 0xCB, 0x66, 0x90, 0x3B, 0x22, 0xE4, 0x33, 0x41, 0xCF, 0xDD, 0x21, 0xD9, 0x9E, 0xE1, 0x57,
+    0x6A, 0xDE, 0xF1, 0xC7, 0x4D, 0x7B, 0x48, 0x85, 0x74, 0xF9, 0x1B, 0x69, 0x6F, 0x3E, 0x72, 0xE7,
+    0xC8, 0xBF, 0x61, 0xE6, 0xE8, 0x0F, 0xD8, 0x9A, 0x8E, 0xAA, 0x93, 0xF6, 0xFC, 0xB1, 0xB4, 0xA2,
+    0x4E, 0xD1, 0xB6, 0xEF, 0x72, 0xBD, 0xEB, 0xA7, 0x25, 0xF3, 0xCA, 0x83, 0x62, 0x9A, 0xD1, 0xE1,
+    0x1F, 0xD7, 0xFF, 0xAF, 0x38, 0xF4, 0xA9, 0x22, 0xBD, 0x61, 0xE5, 0x6F, 0xFE, 0x45, 0x44, 0x5D,
+    0x30, 0x42, 0x84, 0x0F, 0xA3, 0xF6, 0xD6, 0xD6, 0xDF, 0x63, 0x48, 0xFC, 0xA3, 0x67, 0xEA, 0x15,
+    0x5B, 0xEE, 0x9F, 0x8D, 0x55, 0xBF, 0x8F, 0x15, 0x55, 0x18, 0x3D, 0x33, 0x57, 0x98, 0xC8, 0x44,
+    0x6E, 0xA3, 0x8D, 0x90, 0x1D, 0x4B, 0xA3, 0xC0, 0x34, 0x14, 0x5B, 0xBC, 0xF7, 0xEE, 0x05, 0x0B,
+    0x12, 0x29, 0xA0, 0xD0, 0x5A, 0x0B, 0x2B, 0x12, 0x5D, 0x1B, 0x13, 0x8A, 0xC7, 0xBE, 0x49, 0xF8,
+    0x07, 0xB6, 0x01, 0x4B, 0x28, 0x28, 0xCC, 0x9A, 0xC0, 0xC6, 0x10, 0xB3, 0x89, 0xCB, 0xBE, 0x0B,
+    0x24, 0x5A, 0x50, 0x30, 0xBA, 0xB1, 0xA2, 0xD8, 0xD1, 0x2D, 0x88, 0x52, 0x30, 0xC0, 0x18, 0x07,
+    0xF6, 0xCE, 0xFB, 0x3C, 0x77, 0x1E, 0x10, 0x43, 0xC5, 0xCD, 0xBE, 0xBC, 0x7D, 0x77, 0xBE, 0x9F,
+    0xE7, 0x3B, 0xE7, 0x1B, 0x0C, 0x81, 0x73, 0xA7, 0x13, 0xA9, 0xD2, 0x99, 0x8D, 0x6A, 0xC4, 0xBB,
+    0x8D, 0x12, 0x9F, 0x34, 0x63, 0xED, 0x06, 0xBA, 0x18, 0xE7, 0xB6, 0x35, 0x51, 0x63, 0x54, 0xBD,
+    0xF9, 0x61, 0x0D, 0x53, 0x63, 0x52, 0xE3, 0x40, 0x81, 0x70, 0x68, 0xEA, 0x90, 0x16, 0xD8, 0x83,
+    0x58, 0x3A, 0xBA, 0xA8, 0x0A, 0x49, 0x89, 0xD4, 0x41, 0xF7, 0x7F, 0x79, 0x01, 0x63, 0x61, 0x7A,
+    0x53, 0x4C, 0xED, 0xE8, 0x86, 0xB6, 0x7F, 0xFC, 0x63, 0xF3, 0x4E, 0x39, 0x0C, 0xF7, 0x9E, 0x97,
+    0x36, 0x17, 0x5C, 0xB5, 0x7C, 0x14, 0x49, 0x91, 0x7D, 0x8F, 0xEB, 0x88, 0x9E, 0xD1, 0x8C, 0x3E,
+    0x6A, 0xD7, 0x1B, 0x29, 0x97, 0xDA, 0xDE, 0x6F, 0x1F, 0xE3, 0xA9, 0x3A, 0xF6, 0xFD, 0x8F, 0x05,
+    0x68, 0xAB, 0x1C, 0x4B, 0x5C, 0xC7, 0x10, 0x19, 0x73, 0xA8, 0x1A, 0xC9, 0x2F, 0xCE, 0xFB, 0xEC,
+    0x52, 0xF1, 0xDC, 0x40, 0x95, 0x18, 0x20, 0x71, 0xB4, 0xD0, 0xA1, 0x17, 0x03, 0x9A, 0x00, 0x5F,
+    0x80, 0xB5, 0x65, 0x76, 0x5E, 0xCA, 0x1E, 0x60, 0x8C, 0xB8, 0xA2, 0x01, 0x4D, 0x5F, 0x7C, 0x47,
+    0xFD, 0xF7, 0x18, 0x07, 0x2A, 0x88, 0x55, 0xF3, 0xDC, 0x9F, 0xB2, 0x98, 0x06, 0x07, 0x0F, 0x22,
+    0xDD, 0x07, 0x75, 0xBE, 0x43, 0x79, 0xDF, 0xAD, 0xAD, 0xAD, 0x2D, 0x8E, 0xDA, 0x81, 0x6E, 0xDF,
+    0xE4, 0x73, 0x65, 0x6D, 0x1A, 0x17, 0x5A, 0x59, 0xFD, 0x99, 0xCD, 0xC4, 0x1F, 0xD2, 0x5F, 0x2D,
+    0xBE, 0xB5, 0x70, 0x74, 0x61, 0xE3, 0xEB, 0xBC, 0x09, 0xEE, 0xAF, 0x89, 0x6A, 0x28, 0x90, 0x25,
+    0xA9, 0x02, 0x04, 0x86, 0xE5, 0xF0, 0x64, 0x39, 0xF4, 0x12, 0x92, 0x87, 0xC4, 0x15, 0x90, 0x00,
+    0x5E, 0x28, 0x24, 0x9F, 0x14, 0xFA, 0x24, 0x2B, 0x63, 0x77, 0x20, 0x1E, 0x44, 0xF8, 0xE5, 0x39,
+    0x12, 0x35, 0xFA, 0x98, 0x57, 0x37, 0x25, 0x7A, 0x24, 0xC5, 0xFA, 0x6E, 0x39, 0xF2, 0x4D, 0xE6,
+    0xC7, 0xA9, 0x37, 0xCA, 0xEB, 0xC2, 0x73, 0x28, 0xFD, 0xA9, 0x0E, 0x33, 0x1A, 0x3D, 0xA7, 0xCC,
+    0xF8, 0x8E, 0xC5, 0xAB, 0xA7, 0x8D, 0x6B, 0x78, 0x06, 0xDF, 0xD0, 0x05, 0x96, 0x73, 0xC0, 0xB0,
+    0x01, 0x43, 0xF3, 0x9C, 0xE6, 0x59, 0x35, 0x4F, 0x18, 0x30, 0x9C, 0xF0, 0x8A, 0xD7, 0xAC, 0x08,
+    0x66, 0x0E, 0xBB, 0x8E, 0xCB, 0x45, 0x7E, 0x06, 0x3A, 0xAA, 0x06, 0xE9, 0x31, 0x7E, 0x6C, 0x6D,
+    0xA4, 0x60, 0xAA, 0x43, 0x81, 0x24, 0x51, 0x6F, 0x33, 0xC2, 0x54, 0xEE, 0x4A, 0x4B, 0xBA, 0xB4,
+    0xC8, 0xE4, 0xB8, 0x78, 0x13, 0x6F, 0x55, 0x43, 0x23, 0xB7, 0xA5, 0x35, 0x82, 0x33, 0x16, 0xA7,
+    0x03, 0x95, 0x86, 0x88, 0x1A, 0x1A, 0xDA, 0x11, 0x2B, 0xBD, 0x9C, 0x48, 0x9D, 0x1F, 0xAF, 0x7C,
+    0xFA, 0xD1, 0x33, 0xAF, 0x85, 0x11, 0xED, 0x07, 0x57, 0x80, 0x77, 0x57, 0x57, 0x57, 0x94, 0xC8,
+    0x0C, 0x46, 0xA4, 0x8C, 0xBB, 0xB4, 0x81, 0x7E, 0x12, 0xAA, 0x99, 0x01, 0xA9, 0x94, 0xE0, 0x23,
+    0xA2, 0xD3, 0x36, 0x30, 0xD9, 0xA9, 0x22, 0xF9, 0xAD, 0xF6, 0xF0, 0x46, 0x3B, 0x73, 0xB2, 0xF2,
+    0x2F, 0xFB, 0x9C, 0x8A, 0x33, 0x52, 0x27, 0x5B, 0x15, 0xA6, 0x65, 0x60, 0xF3, 0xF2, 0x36, 0x06,
+    0x8F, 0xDD, 0xE1, 0xC5, 0xB5, 0xEC, 0xF0, 0x70, 0x6E, 0x31, 0xB1, 0x97, 0x91, 0xC8, 0x89, 0x0A,
+    0x66, 0x6A, 0x10, 0xB5, 0x53, 0x8F, 0xB4, 0x14, 0x12, 0xFA, 0xE9, 0x77, 0x8C, 0x1F, 0x92, 0x3D,
+    0x68, 0x11, 0x7B, 0x0E, 0x2E, 0x73, 0x04, 0x65, 0xB3, 0x67, 0x59, 0xE4, 0x09, 0x90, 0x66, 0xC0,
+    0x0B, 0x61, 0x66, 0xD2, 0x84, 0x4A, 0x0A, 0x46, 0xE1, 0xC0, 0xE2, 0x59, 0x08, 0x9A, 0x54, 0x0D,
+    0x26, 0x3B, 0x4E, 0xED, 0x08, 0xF4, 0x89, 0x3A, 0xE4, 0xD6, 0x52, 0x61, 0x93, 0xF4, 0x2E, 0x33,
+    0x92, 0xB9, 0xC5, 0x8D, 0xA5, 0x32, 0x62, 0x5F, 0x4A, 0x48, 0x96, 0xA7, 0x2F, 0xAB, 0xCD, 0x89,
+    0xBA, 0xD9, 0xA9, 0x39, 0x05, 0xCF, 0x74, 0xC6, 0x86, 0x24, 0xBA, 0x52, 0x6D, 0x5A, 0x63, 0x33,
+    0x21, 0x29, 0x6E, 0xB7, 0x48, 0x1F, 0x7B, 0xE6, 0xE8, 0x42, 0x67, 0x9C, 0x90, 0x58, 0x66, 0x2D,
+    0xA8, 0x2A, 0x3A, 0x4E, 0xE6, 0x93, 0x27, 0x59, 0x6F, 0x9C, 0x8D, 0xCA, 0xB1, 0x72, 0x63, 0x8D,
+    0xF1, 0x08, 0xE3, 0x0D, 0x8C, 0x88, 0x10, 0xFB, 0x73, 0x41, 0xA2, 0x78, 0x1F, 0xE3, 0x33, 0x2D,
+    0x4B, 0xAE, 0xC9, 0xD3, 0xA0, 0x04, 0x8E, 0x81, 0x20, 0x69, 0xF1, 0x1C, 0x06, 0xC8, 0x84, 0x40,
+    0x51, 0x13, 0x3A, 0x60, 0x9C, 0x9E, 0x07, 0x51, 0xA0, 0x05, 0x09, 0xDB, 0xE0, 0x85, 0xBE, 0x7B,
+    0x5A, 0xC6, 0x75, 0x2A, 0xAD, 0x92, 0x8E, 0xCD, 0xE0, 0x5C, 0xEF, 0x49, 0x5B, 0x3A, 0xC7, 0xFC,
+    0xDD, 0xFD, 0xCF, 0x34, 0x8C, 0xCA, 0x13, 0x24, 0x47, 0x3A, 0x91, 0x74, 0xB1, 0x48, 0x65, 0x78,
+    0xB1, 0xCC, 0xFB, 0xB2, 0xE7, 0x76, 0xE6, 0x7A, 0x1F, 0x33, 0x4F, 0x11, 0xAD, 0x16, 0xA6, 0x53,
+    0x45, 0x2C, 0x4D, 0x76, 0x81, 0x7C, 0xCA, 0x82, 0x4A, 0x5E, 0x4C, 0x4A, 0xAA, 0x5C, 0x1A, 0xAE,
+    0x1C, 0xEA, 0x1B, 0xCD, 0x3C, 0xAB, 0x14, 0x5A, 0x9A, 0xA4, 0x31, 0x31, 0xEF, 0x7D, 0x5C, 0x8D,
+    0xA2, 0x26, 0x3B, 0xE1, 0xD3, 0x5B, 0x3E, 0xFA, 0xFC, 0x13, 0x22, 0xA3, 0x7E, 0xB7, 0x15, 0xBE,
+    0x41, 0xDE, 0xE8, 0x53, 0xEA, 0xFC, 0xCD, 0x9F, 0xCB, 0x1F, 0x7A, 0xC5, 0xA5, 0xB5, 0x54, 0x1D,
+    0x92, 0x5A, 0xB6, 0x5A, 0xA6, 0x94, 0x3B, 0x15, 0xE2, 0x4E, 0xAE, 0x11, 0xC1, 0x99, 0x4C, 0x11,
+    0xE6, 0xE9, 0x7B, 0xE2, 0x84, 0x5D, 0xC2, 0xDD, 0x34, 0x27, 0x11, 0xC2, 0x88, 0x83, 0x36, 0xFA,
+    0xA7, 0xD3, 0xBB, 0x4F, 0x66, 0x0C, 0xAF, 0xFF, 0x94, 0x22, 0xF7, 0x59, 0x29, 0xD5, 0x73, 0x4C,
+    0x42, 0xF0, 0x62, 0xBE, 0xC9, 0x30, 0x98, 0x9C, 0xB2, 0xFA, 0xD2, 0x5D, 0x1B, 0xED, 0x3E, 0xE0,
+    0x6A, 0xE1, 0x90, 0x34, 0xA3, 0xC4, 0xFD, 0x87, 0x14, 0x7B, 0xB0, 0xED, 0xB2, 0xAD, 0x9D, 0x90,
+    0x68, 0x7F, 0xBF, 0x5C, 0x30, 0x5D, 0x49, 0xC4, 0xBD, 0xC1, 0xB5, 0x34, 0x24, 0x4A, 0x4A, 0x6C,
+    0xD6, 0x04, 0x39, 0xA9, 0xB2, 0x98, 0x28, 0x69, 0x33, 0x71, 0x79, 0x8B, 0x23, 0xA1, 0xEB, 0xC8,
+    0x22, 0xEA, 0x70, 0xD1, 0x61, 0x2D, 0xBA, 0xAE, 0x18, 0x08, 0xDF, 0xBA, 0x69, 0x4D, 0xD5, 0x0E,
+    0x38, 0xA3, 0xFD, 0x55, 0x40, 0x26, 0x23, 0xE1, 0xBC, 0xB1, 0x6A, 0x87, 0x84, 0xE1, 0xC0, 0x67,
+    0x6D, 0x4F, 0x91, 0xA0, 0x62, 0x26, 0x4F, 0x64, 0x2E, 0x1F, 0x72, 0x2F, 0xBD, 0xD7, 0xC1, 0xE8,
+    0x2E, 0xF2, 0xD9, 0x8C, 0x5E, 0x29, 0xA9, 0x31, 0x60, 0x29, 0xA7, 0xF1, 0xA8, 0x4E, 0x2E, 0xE1,
+    0x48, 0xCD, 0x5D, 0x94, 0x70, 0xA7, 0x3A, 0x6E, 0xEC, 0x74, 0x52, 0x0C, 0x0C, 0xE5, 0x58, 0x22,
+    0x06, 0xDE, 0xC6, 0x1E, 0x9B, 0x38, 0x4E, 0xAC, 0xA5, 0x18, 0xB4, 0xCD, 0x5D, 0xF4, 0xEF, 0x49,
+    0xDA, 0xFD, 0xE8, 0xA1, 0x1E, 0x86, 0xF5, 0x25, 0x81, 0xEB, 0x33, 0x44, 0x4F, 0x1F, 0x32, 0xFF,
+    0x97, 0x93, 0x52, 0xB1, 0x1B, 0x4E, 0x5B, 0xFB, 0xBD, 0x2B, 0x38, 0xB3, 0x12, 0xC0, 0x59, 0x4B,
+    0x8B, 0x41, 0x5A, 0x2C, 0xDC, 0x71, 0xFA, 0x27, 0xA7, 0xC4, 0xC5, 0xDB, 0x2D, 0x9E, 0x2C, 0x15,
+    0x67, 0xC3, 0x22, 0xCE, 0x53, 0x5A, 0x4F, 0x90, 0xDE, 0x67, 0x44, 0xD6, 0xBE, 0xDB, 0x90, 0x3C,
+    0x44, 0xAF, 0x0D, 0xEF, 0x0D, 0xA4, 0xAC, 0xDB, 0x74, 0xFC, 0xB7, 0x83, 0xBE, 0xE7, 0x59, 0xBB,
+    0x8F, 0xDB, 0xD0, 0xD6, 0x80, 0xF0, 0xE2, 0xDA, 0x95, 0xB0, 0xE0, 0x6B, 0xE8, 0x8F, 0xED, 0xB0,
+    0x8D, 0x49, 0x0B, 0x72, 0xDE, 0xC5, 0x81, 0xD8, 0x6E, 0x79, 0x72, 0xAB, 0x91, 0xC2, 0x08, 0xE7,
+    0xEE, 0x27, 0x48, 0xB6, 0xEA, 0x1E, 0x97, 0xD7, 0x8A, 0x6D, 0x76, 0x7E, 0x1D, 0x37, 0xEA, 0x2A,
+    0x5F, 0x55, 0xBA, 0x22, 0xEC, 0xA6, 0x56, 0xDB, 0x6E, 0x7D, 0x1A, 0xD8, 0x6D, 0x90, 0x15, 0xDA,
+    0xA5, 0x65, 0x52, 0xF1, 0x8D, 0xD5, 0x50, 0x23, 0x9E, 0x70, 0x4C, 0xA8, 0xB0, 0xBC, 0xD0, 0x7F,
+    0x5F, 0x2B, 0x13, 0xB2, 0x45, 0x49, 0x4F, 0x7C, 0x09, 0xD7, 0x45, 0xEE, 0xB2, 0xBF, 0x74, 0xAD,
+    0x29, 0xD8, 0xB0, 0xFA, 0x11, 0xC4, 0xC7, 0xC3, 0x3D, 0x4A, 0x9D, 0x26, 0x6E, 0x3D, 0x2D, 0x1A,
+    0x7D, 0xB1, 0xCE, 0xB8, 0x04, 0xA5, 0x1A, 0x25, 0xE5, 0x30, 0x25, 0x18, 0x47, 0x81, 0xF7, 0xB0,
+    0x11, 0x68, 0xCF, 0x44, 0xD2, 0x45, 0x6D, 0x50, 0x4B, 0x6E, 0xB3, 0x20, 0xB3, 0x5E, 0x31, 0x41,
+    0xCF, 0x69, 0xC5, 0x29, 0x41, 0x56, 0x09, 0xBD, 0xA6, 0xB4, 0xD8, 0x01, 0x5B, 0xA0, 0x2E, 0x38,
+    0x6B, 0xD5, 0x92, 0x20, 0xDC, 0x6F, 0x54, 0x56, 0x5A, 0x27, 0xCD, 0x5C, 0x44, 0xFF, 0x01, 0x95,
+    0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xB3, 0x63, 0x6B, 0x05, 0x4B, 0x32, 0x29, 0x92, 0x82,
+    0xFC, 0xDC, 0x52, 0x06, 0x89, 0x64, 0x29, 0x22, 0x04, 0xD2, 0xFA, 0x66, 0x13, 0x17, 0x94, 0x71,
+    0x01, 0x42, 0x54, 0xA1, 0xA4, 0x0B, 0x45, 0x8A, 0x20, 0xF9, 0xBC, 0x13, 0x5C, 0x50, 0xE2, 0x06,
+    0x28, 0x01, 0x91, 0x48, 0x88, 0x14, 0xB1, 0x84, 0x0B, 0x23, 0x5D, 0x6E, 0xC7, 0xB8, 0x70, 0x99,
+    0x8D, 0x22, 0xD1, 0x20, 0x91, 0x55, 0x52, 0x20, 0x25, 0x12, 0x19, 0xA4, 0x29, 0x36, 0xCE, 0xDE,
+    0x3D, 0xBE, 0xD9, 0x33, 0x81, 0x26, 0x05, 0x2B, 0xDF, 0x6A, 0x6F, 0xFD, 0xEE, 0x7B, 0xEF, 0x7D,
+    0xEF, 0x7B, 0xDF, 0x48, 0x5B, 0x76, 0xB1, 0xF9, 0xF9, 0xBD, 0xA4, 0x70, 0xA4, 0x84, 0xA3, 0x34,
+    0x6A, 0x28, 0xE3, 0x9A, 0x34, 0x5B, 0x5A, 0xBB, 0x64, 0x69, 0xAC, 0x0C, 0xCD, 0xAF, 0x8A, 0x3B,
+    0x22, 0xE6, 0x96, 0x68, 0x76, 0xD3, 0x93, 0xF0, 0x89, 0xA7, 0xC8, 0x29, 0x47, 0xB2, 0xBF, 0x35,
+    0x29, 0xBB, 0xB8, 0xCE, 0xB8, 0x4B, 0xAC, 0x6E, 0x46, 0xCA, 0x6A, 0xBB, 0xA4, 0x4C, 0x59, 0xE4,
+    0x69, 0x51, 0xD1, 0x38, 0x2B, 0x58, 0x79, 0x4D, 0x33, 0xD5, 0x1C, 0xA3, 0x0F, 0x17, 0x7B, 0xB4,
+    0x98, 0x67, 0x94, 0x3C, 0x9E, 0x92, 0xBA, 0xD6, 0x51, 0x7A, 0xA1, 0xA3, 0x4C, 0xB6, 0xA4, 0xA5,
+    0xA7, 0x61, 0xEC, 0x68, 0x94, 0x70, 0x3D, 0x56, 0xEC, 0x29, 0xBD, 0xDB, 0x52, 0x56, 0x8C, 0x49,
+    0xD3, 0x36, 0x0D, 0x85, 0xA7, 0x51, 0xE6, 0x00, 0x66, 0xE9, 0xE3, 0xA3, 0x07, 0x35, 0x1D, 0xC7,
+    0x27, 0x75, 0x44, 0x6A, 0x56, 0x35, 0x92, 0x2B, 0x36, 0x55, 0x5C, 0x6F, 0x2B, 0xEB, 0xD5, 0x05,
+    0x7F, 0x36, 0x72, 0x5A, 0xD6, 0xB7, 0xA5, 0x1B, 0x96, 0xB5, 0x5E, 0xE7, 0x59, 0xC4, 0xCC, 0x4E,
+    0x31, 0x50, 0x4F, 0x6C, 0xCC, 0x7F, 0x8C, 0x4E, 0xA3, 0x69, 0x59, 0x4C, 0xCA, 0x71, 0xAA, 0x96,
+    0x77, 0x77, 0x9A, 0xED, 0x7C, 0x49, 0xC7, 0xF7, 0xD8, 0x69, 0xE6, 0xF3, 0xCC, 0x1B, 0xB4, 0x72,
+    0x90, 0x44, 0x54, 0x0D, 0x9A, 0x37, 0x09, 0xFA, 0xAF, 0x36, 0x8E, 0xC4, 0x9E, 0x48, 0x17, 0x14,
+    0x81, 0x0C, 0xD5, 0xE0, 0xD1, 0x90, 0xE0, 0xE2, 0x23, 0xC9, 0x6C, 0x15, 0x5A, 0x4A, 0x43, 0xD5,
+    0xA0, 0xEF, 0x32, 0x81, 0x97, 0x79, 0x96, 0xA9, 0xE0, 0x7A, 0x6D, 0x41, 0x15, 0x20, 0x37, 0xA3,
+    0x68, 0xBF, 0x4E, 0x19, 0x80, 0x99, 0x89, 0x36, 0xC0, 0x31, 0xEF, 0x31, 0x77, 0x15, 0xB3, 0x91,
+    0x80, 0xBA, 0x0D, 0x44, 0x4B, 0x04, 0xE0, 0xD4, 0x50, 0x14, 0xD2, 0x80, 0x26, 0x80, 0x4C, 0xF0,
+    0xFE, 0x57, 0x12, 0xD3, 0xD0, 0x67, 0x5F, 0x75, 0xC6, 0x0F, 0x79, 0x4A, 0x8E, 0x06, 0x14, 0xD5,
+    0x94, 0x53, 0x6C, 0x41, 0x8F, 0xBA, 0x42, 0x31, 0xA1, 0xE4, 0x8E, 0x74, 0x56, 0x64, 0xEF, 0x36,
+    0xE9, 0xB5, 0x0E, 0x43, 0x50, 0x56, 0xDD, 0xAF, 0x23, 0x6E, 0xA8, 0x74, 0x81, 0x27, 0xF0, 0x2B,
+    0x00, 0x5F, 0xF5, 0x65, 0xA7, 0x35, 0x05, 0x52, 0x3B, 0xB5, 0xEE, 0xC6, 0x6A, 0xB7, 0xCE, 0x34,
+    0x4D, 0x5C, 0xC4, 0x26, 0xEE, 0xC2, 0x7F, 0x4A, 0x8A, 0xDA, 0x50, 0x8D, 0x0E, 0x35, 0x49, 0x07,
+    0x48, 0xB3, 0x26, 0x3A, 0xD1, 0x85, 0x2F, 0x18, 0xDA, 0x6F, 0xA1, 0x08, 0x00, 0x39, 0xF4, 0xD0,
+    0x81, 0x59, 0xD7, 0x57, 0x0E, 0x5C, 0x4C, 0xB1, 0x07, 0xA6, 0x15, 0x51, 0x28, 0x33, 0xA6, 0x4E,
+    0x19, 0xB5, 0x8B, 0xA1, 0x8D, 0x28, 0xB9, 0x63, 0x42, 0x7C, 0x3C, 0x25, 0x2A, 0x0D, 0xE8, 0xAA,
+    0xF1, 0x4B, 0x4A, 0xEA, 0xBE, 0xDF, 0x97, 0xA1, 0xB1, 0x11, 0xD8, 0x51, 0x36, 0x2D, 0xA4, 0x4F,
+    0x0B, 0x5A, 0x03, 0x03, 0xEA, 0xBE, 0x21, 0xC9, 0x01, 0xD6, 0xCE, 0x31, 0xD3, 0xC0, 0x0C, 0x17,
+    0x94, 0x3E, 0x69, 0x28, 0xBD, 0x87, 0x32, 0x9B, 0xD2, 0xA4, 0x0D, 0xC4, 0x17, 0x68, 0x20, 0x0A,
+    0x74, 0x07, 0x5D, 0xB8, 0x01, 0x9D, 0x19, 0x50, 0xFC, 0x3B, 0xC4, 0xDA, 0x53, 0x98, 0xD5, 0x94,
+    0x41, 0x46, 0x19, 0x24, 0x06, 0x92, 0xF1, 0xF7, 0xDA, 0x81, 0xFE, 0x96, 0x2A, 0xBE, 0x87, 0x84,
+    0x63, 0xA8, 0xD8, 0x0C, 0xC9, 0xCB, 0x3A, 0xA5, 0xD5, 0xA8, 0x51, 0x76, 0x89, 0x5A, 0x69, 0x53,
+    0xE6, 0x5F, 0x20, 0x76, 0x8C, 0x08, 0xB3, 0x76, 0x3D, 0x90, 0x6C, 0xF4, 0x74, 0xF3, 0xD6, 0xF7,
+    0x26, 0x3F, 0x24, 0x9A, 0x4F, 0x92, 0xC8, 0xE6, 0x87, 0xC9, 0x5D, 0x8D, 0x43, 0x4C, 0x1D, 0x06,
+    0x93, 0x03, 0xF5, 0x18, 0x5D, 0x1F, 0xCB, 0x87, 0x2E, 0xBD, 0x58, 0x8C, 0x73, 0xF9, 0x97, 0x53,
+    0x9F, 0xEF, 0x4C, 0xB1, 0x17, 0x19, 0xBA, 0x18, 0x12, 0xE6, 0x9F, 0xD8, 0x20, 0x1D, 0xA6, 0xB8,
+    0x25, 0x59, 0x53, 0x4A, 0xA7, 0x5F, 0xCA, 0x07, 0x57, 0xDE, 0xD8, 0xCC, 0x37, 0xB7, 0x4B, 0x7F,
+    0xCC, 0xA1, 0x83, 0x46, 0x78, 0x84, 0x39, 0x51, 0x1C, 0x1D, 0x88, 0x66, 0x2B, 0x59, 0xB6, 0xF9,
+    0xA9, 0xEF, 0xDC, 0x4F, 0x77, 0xD6, 0x9F, 0x4C, 0x15, 0xBB, 0x94, 0x6D, 0x7A, 0x89, 0xAE, 0x6C,
+    0x8B, 0xF5, 0x90, 0x6F, 0x61, 0xE1, 0xE4, 0xC9, 0x73, 0x6F, 0xBF, 0x75, 0xAE, 0x74, 0xA5, 0x1B,
+    0x7E, 0x7B, 0xBA, 0x11, 0x41, 0x0A, 0x34, 0x26, 0xC2, 0x04, 0x7C, 0x48, 0x86, 0xAA, 0x25, 0xFB,
+    0x18, 0x1B, 0xE9, 0x72, 0x65, 0x73, 0x65, 0x56, 0x53, 0xEA, 0x34, 0xB5, 0x3A, 0x48, 0x8B, 0x68,
+    0x89, 0x68, 0xF5, 0xDF, 0x60, 0xF9, 0xCC, 0x4B, 0x44, 0xFA, 0xD5, 0x79, 0x64, 0x56, 0xB4, 0x5A,
+    0xF8, 0x52, 0xBA, 0x89, 0x74, 0xEF, 0x90, 0x98, 0x9C, 0x07, 0x81, 0xBC, 0x3E, 0x5B, 0x7E, 0x9A,
+    0xC5, 0xCC, 0x3B, 0x23, 0xBA, 0x1C, 0xF6, 0x08, 0xCB, 0x04, 0x9F, 0x78, 0xF4, 0x25, 0x89, 0x36,
+    0x10, 0xDA, 0x8A, 0x0D, 0x8C, 0x07, 0x74, 0x85, 0xC1, 0x22, 0x1C, 0x4C, 0x2F, 0xAE, 0xD0, 0xA6,
+    0x98, 0x24, 0x1B, 0x6B, 0xDB, 0x19, 0x7F, 0x60, 0x4F, 0xE0, 0x7D, 0xF9, 0xA8, 0x48, 0x30, 0xEC,
+    0xEA, 0x26, 0x6A, 0x03, 0x1F, 0x4F, 0xE9, 0xD3, 0x39, 0xBA, 0xE6, 0xE5, 0x03, 0xF4, 0x6B, 0x23,
+    0x71, 0xEB, 0x39, 0x7A, 0xB9, 0x7F, 0xA3, 0xDF, 0x04, 0x4A, 0xFC, 0x1C, 0x9D, 0x7A, 0x74, 0x11,
+    0x1C, 0x2A, 0x07, 0x7A, 0x3F, 0xF4, 0x38, 0x38, 0xD4, 0x11, 0x70, 0xEF, 0x62, 0x96, 0xB3, 0xDB,
+    0xA7, 0x04, 0xEF, 0xB7, 0x7D, 0xFE, 0xC9, 0x8D, 0x40, 0x33, 0xA9, 0x47, 0x10, 0x3F, 0x1B, 0x71,
+    0xA9, 0xA5, 0xC3, 0x88, 0x3C, 0x47, 0x41, 0x73, 0x9D, 0xF0, 0x91, 0x93, 0x4E, 0x36, 0x71, 0x9D,
+    0x58, 0xAC, 0x89, 0xC9, 0x8C, 0x2E, 0x4A, 0xE8, 0xFE, 0x9F, 0x4B, 0xDA, 0xAD, 0x70, 0xE7, 0x90,
+    0x21, 0x0A, 0x32, 0x0C, 0xD3, 0x7D, 0xF1, 0x95, 0x38, 0xBE, 0xDB, 0x61, 0x5D, 0x79, 0xD7, 0x63,
+    0xCD, 0xF8, 0x8B, 0x1A, 0x8B, 0xCF, 0x25, 0x2A, 0x9B, 0x31, 0xF6, 0x17, 0xBE, 0xD9, 0xF5, 0x16,
+    0x1A, 0xD0, 0x74, 0x8F, 0x56, 0x85, 0xBB, 0x0C, 0xAB, 0x13, 0xFA, 0x02, 0x83, 0xD5, 0x9D, 0x3F,
+    0x66, 0x90, 0xA5, 0xBA, 0xC7, 0x45, 0xD6, 0xA5, 0x3B, 0x7D, 0x50, 0xF4, 0x9F, 0x22, 0x60, 0x23,
+    0x2F, 0x2A, 0x22, 0xF2, 0x43, 0x09, 0xAB, 0xEC, 0x74, 0xB2, 0xE7, 0xA8, 0xD2, 0xEA, 0x1B, 0xE8,
+    0xAC, 0xCC, 0xD0, 0x8B, 0x62, 0xDD, 0x05, 0xAD, 0x57, 0x61, 0x49, 0xF8, 0x20, 0xA3, 0xED, 0x33,
+    0xE2, 0x4D, 0xF5, 0xE4, 0x19, 0x4A, 0xE6, 0xF4, 0x21, 0x53, 0xD6, 0x65, 0x21, 0xE3, 0x20, 0xB1,
+    0xF2, 0x81, 0xA7, 0xA5, 0x35, 0x4A, 0xB0, 0x7D, 0x88, 0xC1, 0xCE, 0x45, 0x81, 0x74, 0x54, 0xF6,
+    0xB8, 0xC5, 0x61, 0x00, 0xAA, 0x46, 0xA2, 0x8D, 0x6B, 0x1D, 0xD6, 0x36, 0x33, 0xA4, 0xB1, 0xD1,
+    0x78, 0x5A, 0x9B, 0xD7, 0xF1, 0xC0, 0x9E, 0xDA, 0x8A, 0xFE, 0x84, 0xB9, 0xC0, 0xB6, 0xB8, 0x56,
+    0x4A, 0x34, 0x90, 0x1E, 0xB6, 0x13, 0x02, 0x19, 0xF4, 0x01, 0x8B, 0xEF, 0xAF, 0xF4, 0xED, 0x63,
+    0x90, 0x71, 0x83, 0x21, 0x61, 0xFF, 0x21, 0xC9, 0xB8, 0xC6, 0x63, 0x8C, 0xC7, 0x0C, 0x8F, 0x30,
+    0xB0, 0xB8, 0x89, 0xDB, 0xCC, 0x67, 0x96, 0xCD, 0x0F, 0xC1, 0x66, 0x13, 0x28, 0x09, 0xBD, 0x44,
+    0xD7, 0x89, 0x7E, 0xDC, 0x50, 0x53, 0xF1, 0xC0, 0x9E, 0xC9, 0xE5, 0x9E, 0xC9, 0xB7, 0x92, 0x8B,
+    0xE4, 0xDC, 0x30, 0xDD, 0xFB, 0x0C, 0x9E, 0x1B, 0x26, 0x3D, 0x86, 0x89, 0x74, 0x34, 0x46, 0xB6,
+    0x2E, 0xF2, 0xA2, 0x93, 0x2E, 0x6A, 0x31, 0x61, 0x9F, 0x34, 0xB1, 0x53, 0xFB, 0xB7, 0x82, 0xF9,
+    0xE3, 0x94, 0x62, 0x1C, 0x52, 0x6C, 0xB5, 0xD1, 0xB6, 0x2C, 0x74, 0x5D, 0x51, 0x09, 0x56, 0x71,
+    0xA4, 0x04, 0xA7, 0x91, 0x10, 0x6F, 0x3C, 0x3B, 0x98, 0xFE, 0xD5, 0x41, 0x54, 0x6F, 0x29, 0x69,
+    0x57, 0x71, 0x22, 0x56, 0xBC, 0xCC, 0xD3, 0xF4, 0x6B, 0xF8, 0xA4, 0x85, 0x4B, 0x49, 0x58, 0x4F,
+    0xAF, 0x87, 0xFF, 0x9F, 0xCF, 0x3C, 0xCF, 0x17, 0x1C, 0xB8, 0x57, 0x1B, 0xFC, 0x30, 0x34, 0xD9,
+    0xE7, 0xCC, 0x91, 0x36, 0x36, 0x5E, 0x15, 0x4E, 0x7D, 0x85, 0x75, 0x6F, 0x20, 0xF3, 0xA5, 0xD8,
+    0xAE, 0xC2, 0x36, 0xC0, 0x0E, 0xF6, 0x06, 0x2E, 0xF3, 0x2A, 0x2D, 0x16, 0xAF, 0x63, 0x08, 0xF0,
+    0x2D, 0xAC, 0xF3, 0x59, 0x6A, 0xCF, 0x44, 0x6E, 0x98, 0xC0, 0x62, 0x1A, 0x05, 0x7D, 0x20, 0x12,
+    0x25, 0xE2, 0xC8, 0x56, 0x45, 0x00, 0x9F, 0x84, 0xED, 0xC6, 0xA1, 0xB0, 0xB0, 0xF0, 0xCA, 0x21,
+    0xB8, 0x45, 0xFE, 0xE6, 0xB6, 0xF6, 0xC7, 0x37, 0xB1, 0xF4, 0x9E, 0x82, 0xDB, 0x14, 0x48, 0xFA,
+    0x37, 0x8D, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0x9E, 0xE1, 0xCE, 0x80, 0x8B, 0xA1, 0x80,
+    0xEA, 0x8A, 0xA9, 0x23, 0x91, 0xF8, 0x0F, 0x24, 0x3B, 0x86, 0x82, 0x36, 0x29, 0x42, 0x75, 0x05,
+    0x4D, 0x44, 0x05, 0xBA, 0x96, 0x62, 0x73, 0xB6, 0x94, 0x82, 0x82, 0xE2, 0xAE, 0x40, 0xA9, 0x23,
+    0x94, 0x22, 0x4A, 0x8A, 0xB4, 0x29, 0x76, 0xCF, 0x13, 0x5D, 0x91, 0x22, 0xC5, 0x59, 0x49, 0x81,
+    0xC4, 0x15, 0x18, 0x85, 0x08, 0x29, 0x14, 0x37, 0x70, 0x0E, 0x31, 0xB9, 0xB1, 0x1F, 0xDF, 0xD8,
+    0x7B, 0x7B, 0x47, 0xE0, 0x10, 0x96, 0xC6, 0xF2, 0xAE, 0xDF, 0xBC, 0xF7, 0xE6, 0xFB, 0xBE, 0xF7,
+    0x99, 0x4A, 0x52, 0x95, 0x72, 0xD2, 0x13, 0x67, 0xA5, 0x4D, 0x5B, 0xD5, 0x4A, 0xBE, 0xC1, 0x99,
+    0xF1, 0xA5, 0x8B, 0x0F, 0xF6, 0x98, 0xE6, 0x7C, 0x54, 0xAB, 0xBD, 0x7E, 0x27, 0x6A, 0x79, 0xAF,
+    0x4A, 0xB7, 0x5E, 0x7A, 0xD9, 0xB0, 0xB1, 0xB9, 0x7A, 0xDA, 0x26, 0xEE, 0x6A, 0x99, 0x11, 0x45,
+    0x3D, 0x11, 0xA5, 0x96, 0x48, 0x36, 0x78, 0xC8, 0xB1, 0x54, 0x85, 0x7F, 0xEF, 0x90, 0x74, 0x9A,
+    0xBC, 0x42, 0x68, 0x6D, 0xF6, 0x1B, 0x75, 0xE4, 0xE3, 0xFB, 0x07, 0x62, 0xFF, 0xD7, 0xE2, 0xF7,
+    0xC3, 0x6A, 0xFA, 0xB9, 0x23, 0x32, 0x08, 0xCC, 0x28, 0x29, 0x48, 0x5A, 0x8A, 0x9A, 0xC4, 0x1A,
+    0x6A, 0xE3, 0x2A, 0x25, 0x2F, 0x6B, 0x9D, 0xCD, 0xA4, 0x53, 0xC5, 0x39, 0xA4, 0x7A, 0x2F, 0x42,
+    0xD4, 0x3D, 0x4B, 0x92, 0x6B, 0xE4, 0x46, 0xDE, 0xE3, 0x4B, 0x20, 0x43, 0xE4, 0xF1, 0xC0, 0x68,
+    0xA1, 0xC4, 0x8B, 0x69, 0x4B, 0x34, 0x99, 0xA0, 0x13, 0x65, 0x49, 0xDF, 0x70, 0xA4, 0xAC, 0xA7,
+    0x84, 0x99, 0x62, 0xE6, 0x4A, 0x32, 0x37, 0xB2, 0xA5, 0x1E, 0x1B, 0x4C, 0x41, 0x2B, 0x94, 0xD1,
+    0xEB, 0x39, 0x29, 0x2E, 0x28, 0x5D, 0x66, 0xCC, 0x1F, 0x50, 0xCA, 0x45, 0xFC, 0xB0, 0x21, 0xA7,
+    0xB2, 0xF3, 0xE4, 0xA4, 0xCD, 0xC9, 0xB0, 0x13, 0xDC, 0x53, 0xF2, 0x2A, 0x44, 0x5D, 0x9C, 0x12,
+    0xCD, 0x66, 0x44, 0xDE, 0x9F, 0x34, 0x91, 0x2E, 0x0E, 0x8C, 0x1E, 0x04, 0x56, 0xBC, 0x57, 0x90,
+    0xDA, 0x2A, 0x86, 0x16, 0x36, 0xB1, 0x70, 0x78, 0xC1, 0x6C, 0x43, 0x07, 0x0A, 0xCB, 0x14, 0xAA,
+    0xCE, 0x49, 0xD5, 0xA4, 0xBE, 0xB1, 0xA2, 0x41, 0x2B, 0x9F, 0x59, 0xF1, 0xDD, 0xED, 0xFF, 0xDD,
+    0x40, 0x74, 0x8F, 0x71, 0x66, 0xCD, 0x68, 0x9B, 0xF8, 0xC5, 0x55, 0xE0, 0xC2, 0x61, 0x5F, 0x8F,
+    0x73, 0x53, 0xF2, 0xF8, 0xF9, 0x2D, 0xA2, 0xEB, 0x06, 0xEF, 0xE2, 0x9A, 0x3B, 0x80, 0x1B, 0x23,
+    0x16, 0xC7, 0x06, 0x2D, 0x86, 0xF9, 0x6E, 0x81, 0x3E, 0x80, 0x45, 0x6A, 0x53, 0xF6, 0x00, 0x81,
+    0x43, 0xA6, 0x93, 0x2B, 0x3E, 0xDA, 0xAF, 0x43, 0x80, 0x9D, 0xEA, 0xE6, 0x0B, 0x85, 0xB7, 0x4F,
+    0x2A, 0xF5, 0xE2, 0xF6, 0xC5, 0xB8, 0x09, 0x19, 0xB8, 0x49, 0xC3, 0xD6, 0x72, 0x93, 0xB7, 0x89,
+    0xDC, 0x79, 0xD4, 0x06, 0x00, 0x25, 0xA8, 0x5E, 0xC9, 0x96, 0x09, 0x4A, 0xD4, 0x61, 0xCE, 0xA2,
+    0x97, 0xD9, 0xC0, 0x8B, 0x04, 0x57, 0xF1, 0xF3, 0x2B, 0x80, 0x1F, 0x67, 0xC5, 0x2B, 0x85, 0x8E,
+    0x35, 0xA2, 0xCD, 0xDD, 0x5B, 0xE1, 0x48, 0x94, 0x63, 0x95, 0xA1, 0x85, 0xE8, 0x98, 0x09, 0x7B,
+    0x8A, 0x89, 0x63, 0x6C, 0x2B, 0xD2, 0x07, 0x59, 0xFC, 0xD3, 0x57, 0xC8, 0x5C, 0xE8, 0xBB, 0xDF,
+    0x0A, 0x17, 0x01, 0x20, 0x47, 0xC0, 0x23, 0x60, 0x1D, 0xCA, 0xC7, 0xDC, 0x20, 0x5F, 0x8B, 0x80,
+    0x66, 0x35, 0xDB, 0x40, 0x82, 0xF4, 0x23, 0x66, 0x0F, 0xB8, 0x6B, 0xB4, 0x4C, 0x53, 0xD1, 0x52,
+    0xB3, 0x01, 0x06, 0x5A, 0x48, 0x74, 0xEC, 0x75, 0x15, 0xBA, 0xE6, 0x82, 0x39, 0xA2, 0x29, 0x7D,
+    0xE0, 0x98, 0x77, 0xB9, 0x53, 0x12, 0xC1, 0x94, 0x6E, 0x2F, 0xEB, 0x82, 0x63, 0xF9, 0xAC, 0x26,
+    0x7D, 0xBF, 0x58, 0xFE, 0x05, 0xAC, 0x73, 0xCE, 0x80, 0x45, 0x01, 0x1A, 0xB3, 0x6B, 0xAB, 0xC0,
+    0x57, 0x34, 0x20, 0xC2, 0xE6, 0xDC, 0x03, 0x37, 0x17, 0xDB, 0xB4, 0x50, 0x9F, 0xF8, 0xC0, 0x1F,
+    0xE9, 0x9F, 0x87, 0x2D, 0x51, 0x09, 0xD1, 0x61, 0x92, 0x7C, 0x28, 0xB5, 0x32, 0x55, 0xEC, 0x15,
+    0x37, 0x4A, 0xBA, 0x84, 0xAD, 0xE8, 0x48, 0x6B, 0x32, 0x86, 0x36, 0x37, 0x4F, 0x9F, 0x57, 0x3E,
+    0x0D, 0x08, 0xC4, 0xDF, 0x87, 0xBB, 0xDA, 0xB3, 0x74, 0xE6, 0x15, 0xBB, 0xB2, 0xEE, 0x30, 0x6C,
+    0xBC, 0x0B, 0x7E, 0x5A, 0x7E, 0x5C, 0x63, 0x0E, 0x78, 0x03, 0xDD, 0xF6, 0x5C, 0x0E, 0x5C, 0x04,
+    0x81, 0xE6, 0x03, 0xC3, 0x26, 0xF0, 0x8F, 0x67, 0xDC, 0x05, 0x2F, 0xD4, 0x13, 0xD8, 0xDB, 0xFF,
+    0xA5, 0x07, 0xB5, 0x97, 0x9F, 0x00, 0x58, 0x68, 0x94, 0xAB, 0x37, 0x9A, 0x48, 0x1E, 0xDB, 0xB3,
+    0x9A, 0x10, 0xB7, 0xCF, 0x89, 0xED, 0x3B, 0x91, 0x9F, 0x24, 0xBB, 0x8E, 0x76, 0x8C, 0xDA, 0xB2,
+    0x64, 0x72, 0x9D, 0x07, 0x31, 0x1A, 0x64, 0x4E, 0x38, 0x5F, 0xEA, 0x6E, 0xBC, 0xEB, 0xA1, 0x6E,
+    0x79, 0x70, 0xE4, 0x41, 0x97, 0x7E, 0x06, 0xA8, 0x7D, 0xFA, 0x70, 0x68, 0x8B, 0xE2, 0x47, 0x56,
+    0x1E, 0x3A, 0xEA, 0xFC, 0xDF, 0x4B, 0x94, 0xDB, 0x94, 0x7B, 0x7A, 0x0B, 0xDE, 0x20, 0xAB, 0x20,
+    0x27, 0xD3, 0x90, 0x86, 0xDC, 0x14, 0x32, 0x56, 0x6F, 0xC7, 0x2E, 0x60, 0x8A, 0x43, 0xA4, 0xED,
+    0x18, 0x7D, 0xE1, 0x42, 0x98, 0xFA, 0xF9, 0x3C, 0x60, 0xDE, 0x91, 0x58, 0x47, 0x0F, 0x44, 0x5F,
+    0x12, 0xEC, 0x8C, 0x3E, 0xA4, 0x77, 0xA6, 0x21, 0x2E, 0xAD, 0x43, 0xA0, 0x0A, 0x74, 0x51, 0x84,
+    0x9F, 0x05, 0x8C, 0x0A, 0xEA, 0x82, 0x69, 0x40, 0x98, 0x13, 0x7A, 0x02, 0x2A, 0xAD, 0xE9, 0xF0,
+    0xFF, 0x22, 0xCC, 0x60, 0xAE, 0x50, 0xC0, 0x42, 0x3F, 0x7A, 0x08, 0x4B, 0xFE, 0x19, 0x46, 0xF4,
+    0xEE, 0x42, 0xF3, 0x9F, 0x8E, 0xC0, 0xB9, 0xE8, 0x8A, 0x2A, 0x4C, 0x71, 0x5D, 0x74, 0xC2, 0x69,
+    0xA7, 0x70, 0xC4, 0x89, 0xEA, 0x85, 0x03, 0xE9, 0x7B, 0x3F, 0xDA, 0xC9, 0xBC, 0x8C, 0x18, 0x86,
+    0xD9, 0xEB, 0xCA, 0x38, 0x8E, 0x58, 0xFA, 0xA4, 0x19, 0x05, 0x9F, 0x45, 0x98, 0x56, 0xC3, 0xA7,
+    0x8D, 0x0D, 0xF6, 0x77, 0x09, 0xC7, 0x7C, 0x08, 0x05, 0xE7, 0x75, 0xB2, 0x35, 0xA7, 0xA3, 0xC3,
+    0x4A, 0xFB, 0xA9, 0x60, 0x65, 0x8D, 0x6D, 0x61, 0xAA, 0xD9, 0x92, 0x2A, 0xE8, 0xE8, 0xD8, 0x8F,
+    0x3C, 0x5D, 0x95, 0xB5, 0xC2, 0xDE, 0x32, 0x9B, 0xC5, 0x5E, 0xBA, 0xDC, 0xA9, 0x1B, 0x5C, 0xCC,
+    0x4C, 0x27, 0x0F, 0x5F, 0x39, 0x75, 0x7F, 0xC3, 0xE6, 0x0D, 0xB4, 0xFA, 0x75, 0xA3, 0x3C, 0xCC,
+    0xDB, 0xB2, 0xE8, 0x92, 0x80, 0xE9, 0xE5, 0x6C, 0x41, 0xC2, 0x78, 0x3D, 0x88, 0x2B, 0x94, 0x56,
+    0xB1, 0x8F, 0x1F, 0xF5, 0xE2, 0xD9, 0x41, 0x86, 0xCA, 0xF9, 0x6F, 0x2E, 0x75, 0x5E, 0xB9, 0xC9,
+    0xB2, 0xF0, 0x14, 0x46, 0x98, 0xA6, 0x6F, 0xE8, 0x63, 0x03, 0xB2, 0x0F, 0xCE, 0xC4, 0xEB, 0x0D,
+    0x75, 0xF0, 0xC4, 0x0E, 0xFE, 0x3B, 0x01, 0x2A, 0x69, 0x46, 0x2D, 0x9C, 0x70, 0x2E, 0xC1, 0x63,
+    0xD4, 0x47, 0x65, 0x91, 0x8F, 0x66, 0x18, 0xFC, 0xA6, 0xA6, 0x35, 0x5E, 0x80, 0xF9, 0x6F, 0x03,
+    0x01, 0x8E, 0x22, 0x6E, 0xE3, 0x7A, 0xA6, 0xB2, 0xA9, 0xA6, 0x36, 0x5D, 0x07, 0x01, 0x35, 0xE8,
+    0x11, 0x7F, 0x82, 0xEA, 0x6B, 0x90, 0x75, 0x07, 0xB9, 0x75, 0x54, 0x7E, 0xDC, 0xCA, 0x06, 0x85,
+    0x0A, 0x6D, 0xE1, 0x53, 0x18, 0xFE, 0x56, 0x5B, 0x6D, 0xCB, 0x9B, 0x80, 0x19, 0xA6, 0x0F, 0x86,
+    0x82, 0x4B, 0xAC, 0xF6, 0xA7, 0xF3, 0xFD, 0xE0, 0x35, 0xFB, 0xF4, 0xE6, 0xA9, 0x7C, 0xB4, 0x50,
+    0x3D, 0xA4, 0x24, 0x5E, 0x8F, 0xCA, 0x5A, 0xD9, 0xA6, 0x08, 0x3B, 0x53, 0x6E, 0x80, 0x55, 0x8D,
+    0x4F, 0xA4, 0xDD, 0xA1, 0x1C, 0xF9, 0xB0, 0x97, 0x61, 0xE3, 0xB9, 0xE8, 0xD7, 0xFD, 0xE8, 0xEC,
+    0x98, 0x67, 0x10, 0xB8, 0x16, 0xB6, 0x01, 0x17, 0xA4, 0x58, 0x9E, 0xE3, 0xBF, 0x2B, 0x86, 0x4F,
+    0xC5, 0xF1, 0xC4, 0x8B, 0x3F, 0xDC, 0xD9, 0x13, 0xBF, 0x36, 0x78, 0x4A, 0x3E, 0x80, 0xB5, 0x19,
+    0x87, 0xAF, 0xEC, 0x25, 0x0A, 0x25, 0xDE, 0x1F, 0x9C, 0x15, 0x2F, 0x82, 0xC0, 0xD1, 0xE8, 0xE8,
+    0x5F, 0xC3, 0xDD, 0x84, 0x65, 0xF3, 0x6C, 0x18, 0xC0, 0x71, 0x18, 0x43, 0x99, 0xF1, 0x9E, 0xF4,
+    0x27, 0xDE, 0x46, 0x7F, 0x01, 0x75, 0x55, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x87, 0x78,
+    0x21, 0x83, 0x3C, 0x0D, 0x0D, 0xC1, 0xB0, 0x14, 0x48, 0x28, 0x56, 0x9C, 0x2D, 0xA1, 0x58, 0xDF,
+    0x6E, 0xB0, 0x44, 0x01, 0x05, 0x2E, 0xE2, 0x06, 0x21, 0x05, 0x3A, 0x94, 0x0E, 0x89, 0xC2, 0x42,
+    0xCE, 0xED, 0x26, 0x29, 0x52, 0xA4, 0x48, 0x0A, 0xFE, 0x00, 0x4B, 0x04, 0xE9, 0x70, 0x43, 0x0A,
+    0x17, 0x2E, 0x1C, 0xDF, 0xD8, 0x57, 0x84, 0x72, 0x88, 0x91, 0x52, 0x50, 0xB0, 0x20, 0x44, 0x9B,
+    0xC1, 0xD9, 0x88, 0x45, 0xEC, 0xDD, 0xF0, 0xDE, 0x9C, 0x1D, 0x4C, 0x30, 0xA3, 0xDB, 0x1F, 0xF7,
+    0x76, 0xDF, 0x9B, 0xEF, 0x7D, 0xEF, 0x7B, 0x6F, 0x01, 0xC8, 0x91, 0x49, 0x53, 0x74, 0x1D, 0x80,
+    0x64, 0x8C, 0xF5, 0x0C, 0x58, 0xC5, 0x4C, 0xAD, 0x7C, 0x85, 0xEC, 0xF9, 0xB8, 0xCE, 0x27, 0x28,
+    0x2D, 0x8E, 0x96, 0xEF, 0x90, 0x7B, 0x2B, 0xF0, 0xCC, 0x8A, 0x5C, 0x6C, 0x92, 0xAA, 0x45, 0x97,
+    0x40, 0x8F, 0x2C, 0xEE, 0x6D, 0x23, 0xF6, 0x05, 0xF2, 0x1A, 0x92, 0xA2, 0xA6, 0x15, 0xA4, 0x03,
+    0xC6, 0x90, 0xDE, 0x20, 0x77, 0x88, 0x7F, 0x65, 0x97, 0x0F, 0x07, 0xF4, 0xBF, 0xC3, 0xCC, 0xC6,
+    0x97, 0x38, 0x69, 0xB5, 0x91, 0x43, 0x17, 0x1B, 0x6C, 0xEB, 0x0A, 0xFD, 0x14, 0xC8, 0x17, 0xE9,
+    0xE0, 0x60, 0x14, 0x29, 0xA9, 0x01, 0x6D, 0xE8, 0x5A, 0x00, 0x25, 0x99, 0xC8, 0x9C, 0x37, 0x74,
+    0x54, 0xE4, 0xA7, 0x3F, 0x28, 0xA2, 0x03, 0x87, 0x3C, 0x3F, 0x16, 0x4B, 0x2C, 0x8B, 0x22, 0xC1,
+    0x1A, 0x5A, 0x5D, 0xE9, 0x3D, 0x0A, 0xBB, 0x08, 0xF5, 0xA3, 0x41, 0xD9, 0x40, 0x4E, 0xC8, 0xCB,
+    0x20, 0x6A, 0xE9, 0x42, 0xAE, 0x96, 0x77, 0x90, 0x1E, 0xE8, 0x17, 0x87, 0x9E, 0xF1, 0x7D, 0x03,
+    0xE2, 0x66, 0x4A, 0xCE, 0xB3, 0xF8, 0xA4, 0x4B, 0xA0, 0x4C, 0x8B, 0xE4, 0xA6, 0x09, 0xF0, 0xBC,
+    0x43, 0x44, 0xCE, 0x71, 0x3B, 0x45, 0x77, 0x85, 0x6E, 0x1D, 0x94, 0x9F, 0x82, 0x9B, 0xB0, 0x53,
+    0x8A, 0x3E, 0xEE, 0x89, 0x36, 0x6A, 0xE8, 0xC1, 0x33, 0xF8, 0x04, 0x31, 0xC8, 0x00, 0xD1, 0xF1,
+    0x76, 0x14, 0x8D, 0x38, 0x64, 0x88, 0x4C, 0x22, 0x63, 0x64, 0x16, 0x19, 0x24, 0xD1, 0x18, 0x78,
+    0x20, 0x1E, 0xA7, 0x30, 0x89, 0x7A, 0x8B, 0x4E, 0xB4, 0xC8, 0x8B, 0xFE, 0x09, 0x3C, 0xEA, 0x8A,
+    0xE3, 0x51, 0x6C, 0x46, 0x1A, 0x98, 0x94, 0x8F, 0xED, 0x34, 0x04, 0x83, 0x0D, 0x5C, 0x22, 0x94,
+    0xBE, 0x08, 0x78, 0x03, 0x9B, 0x92, 0x8A, 0x37, 0xA5, 0x93, 0x37, 0x38, 0x70, 0xFA, 0x56, 0xD5,
+    0xDF, 0xE1, 0x60, 0xA2, 0xDE, 0x54, 0x4B, 0x66, 0xF1, 0x55, 0xE1, 0xEE, 0xEA, 0xD1, 0xEE, 0x44,
+    0xFB, 0x26, 0xF1, 0xE6, 0xE5, 0x4B, 0xC0, 0x16, 0xA4, 0x85, 0xA6, 0x57, 0xE4, 0xFE, 0x83, 0x03,
+    0xC7, 0x74, 0xC5, 0x4A, 0x2E, 0x55, 0xBB, 0xF6, 0x33, 0x97, 0x74, 0xD1, 0x06, 0x64, 0x21, 0x4C,
+    0x88, 0xA6, 0xA8, 0xE6, 0xDE, 0x1B, 0xDA, 0x8D, 0x0A, 0xCC, 0x09, 0xB1, 0x34, 0x08, 0xB8, 0xB2,
+    0x01, 0x46, 0x72, 0x58, 0x0D, 0x8B, 0x88, 0xF2, 0x8F, 0x09, 0xC2, 0xE7, 0x0C, 0xD4, 0xF6, 0x06,
+    0xB2, 0x22, 0x59, 0xEA, 0x02, 0x0E, 0x09, 0xA2, 0x9A, 0x3D, 0xD7, 0xF1, 0x02, 0x47, 0x4C, 0x12,
+    0x3A, 0x6D, 0x6F, 0x73, 0x62, 0x0E, 0x27, 0xAF, 0x2B, 0x81, 0xA7, 0xC8, 0x50, 0x5D, 0x08, 0x63,
+    0x8F, 0x02, 0x89, 0x26, 0xB2, 0x44, 0x89, 0x66, 0x08, 0x65, 0x4B, 0xD5, 0xF4, 0x5D, 0x6C, 0xF5,
+    0x05, 0x97, 0x23, 0x53, 0xA6, 0x13, 0x4F, 0x76, 0x62, 0xA7, 0xBC, 0xCB, 0x2B, 0x52, 0xFF, 0xF8,
+    0x58, 0x20, 0xB9, 0x6F, 0x91, 0x5C, 0x2A, 0xFE, 0xA3, 0x87, 0x8F, 0xE9, 0x91, 0x9D, 0x23, 0x02,
+    0xEE, 0x62, 0x4D, 0x56, 0x91, 0x9D, 0x5D, 0xD6, 0x28, 0x5D, 0x16, 0xED, 0xED, 0xBA, 0x59, 0xAD,
+    0xAB, 0xB2, 0x5D, 0x8C, 0xFC, 0xD5, 0x43, 0x74, 0x3D, 0xA2, 0x5A, 0x53, 0xB7, 0x44, 0x5C, 0xED,
+    0x9C, 0x94, 0xA2, 0x7F, 0xA2, 0xA4, 0xA9, 0x35, 0x42, 0x9F, 0x69, 0xD6, 0x36, 0x45, 0xD7, 0xD4,
+    0x7E, 0xFA, 0x91, 0x83, 0xFE, 0x65, 0x82, 0xC4, 0xE5, 0x2E, 0x71, 0x9A, 0x80, 0x08, 0x2E, 0xCC,
+    0x73, 0x94, 0xFF, 0x02, 0x5C, 0x83, 0xBF, 0x2C, 0xCA, 0x82, 0xC9, 0xF3, 0x5C, 0x31, 0x7D, 0xCB,
+    0xF6, 0x95, 0x83, 0xE4, 0x82, 0xE6, 0xFE, 0xBE, 0xEF, 0xC2, 0x29, 0xF5, 0xDE, 0x79, 0xEF, 0xB9,
+    0x96, 0xC2, 0xB3, 0xCD, 0x5F, 0x58, 0x59, 0x59, 0x0E, 0x40, 0x4A, 0xB2, 0xEF, 0xD3, 0xE1, 0x4F,
+    0xAD, 0xAC, 0xAC, 0x5C, 0xFC, 0x1F, 0xD3, 0xEA, 0x02, 0x9A, 0x0C, 0x2E, 0x13, 0xF5, 0x56, 0x64,
+    0x9D, 0x34, 0x2E, 0xDE, 0xAD, 0xD5, 0x35, 0xAB, 0xA5, 0xD1, 0x71, 0xF5, 0x9A, 0x2A, 0x16, 0x34,
+    0x32, 0x8D, 0xD5, 0xF3, 0xD8, 0xCC, 0xA8, 0xB6, 0x9E, 0x24, 0xE1, 0x9F, 0x72, 0x43, 0x7B, 0xB7,
+    0xB4, 0x61, 0x33, 0x5F, 0xE4, 0x26, 0x31, 0xAA, 0x96, 0x4D, 0xD4, 0x45, 0x03, 0x49, 0xEA, 0xD7,
+    0x36, 0x35, 0x25, 0xA2, 0x3B, 0x89, 0xDD, 0x91, 0x2E, 0xBF, 0xDA, 0xE1, 0xF8, 0x2B, 0xF3, 0xEF,
+    0xAD, 0xEB, 0xDF, 0xC7, 0xA2, 0xCB, 0xAB, 0xF4, 0x86, 0x93, 0xCD, 0x0E, 0x86, 0xDA, 0x46, 0x83,
+    0xCB, 0xC5, 0x38, 0x37, 0xA5, 0xB6, 0xF9, 0xFB, 0x2E, 0x1D, 0x35, 0xC9, 0xA8, 0xFD, 0x97, 0xFB,
+    0x53, 0x97, 0xFC, 0x3A, 0xF5, 0x65, 0x70, 0x61, 0x04, 0x0D, 0x95, 0x44, 0x38, 0x9C, 0x67, 0x75,
+    0xAE, 0x09, 0x3F, 0xC9, 0xFD, 0xCF, 0xC9, 0x45, 0x12, 0x5E, 0x2F, 0x18, 0xA0, 0x2A, 0x7A, 0x23,
+    0xC1, 0x91, 0xE1, 0x1C, 0x44, 0x45, 0xEC, 0x86, 0xB5, 0xCC, 0xCE, 0xE4, 0x4A, 0x52, 0xA3, 0x27,
+    0xD2, 0xE0, 0x95, 0x1F, 0x22, 0x3F, 0x89, 0x3D, 0x55, 0x03, 0x14, 0x0F, 0xD4, 0xA1, 0x6B, 0x48,
+    0x7C, 0x9D, 0xFB, 0x5A, 0x3C, 0xE1, 0x08, 0xF2, 0xE8, 0xC5, 0x88, 0xB8, 0x9E, 0xCE, 0x0F, 0xED,
+    0x5B, 0x62, 0xB4, 0x96, 0xDE, 0x17, 0x89, 0x1F, 0x93, 0xEC, 0x5D, 0x4C, 0xD2, 0x27, 0x46, 0xE8,
+    0xB6, 0x23, 0xB2, 0xC8, 0xD9, 0x5F, 0xF3, 0x7E, 0x4C, 0x9C, 0xB9, 0xF9, 0x8D, 0x8D, 0x0A, 0xC2,
+    0xE6, 0xD7, 0x27, 0xE5, 0x0D, 0xF2, 0x3E, 0xAD, 0x46, 0x07, 0xDD, 0xF4, 0x54, 0xAC, 0x9F, 0x49,
+    0xDF, 0x71, 0xBD, 0x9C, 0xD2, 0x2A, 0x95, 0x1B, 0x67, 0x2C, 0xA3, 0x55, 0x9C, 0xA6, 0x46, 0xE8,
+    0xD1, 0x6E, 0x6F, 0x51, 0x4B, 0x7C, 0x41, 0x78, 0xB2, 0x2D, 0x30, 0x5C, 0x50, 0xA7, 0x73, 0x97,
+    0x30, 0x3E, 0xB4, 0x9F, 0xDC, 0x96, 0xEE, 0xB7, 0x75, 0xB5, 0xFB, 0xD5, 0xED, 0x14, 0xFB, 0xD5,
+    0x59, 0xEE, 0x82, 0x41, 0xDC, 0xA8, 0x23, 0xFA, 0x07, 0x97, 0x05, 0x71, 0x3A, 0x3C, 0xE4, 0xD4,
+    0x31, 0xA7, 0xAC, 0xF1, 0xEB, 0x7B, 0x7B, 0xB5, 0x73, 0x6E, 0x6B, 0xF5, 0xED, 0x73, 0x73, 0xD3,
+    0x3C, 0xA4, 0x5D, 0xE5, 0xDE, 0x46, 0xB6, 0x99, 0x6D, 0x2D, 0x64, 0xB3, 0xE7, 0xA6, 0x56, 0xAD,
+    0x96, 0x46, 0x0F, 0xEA, 0xCD, 0xAD, 0x6C, 0x76, 0x56, 0x05, 0x4B, 0x46, 0xEA, 0x55, 0x8F, 0xAE,
+    0xDD, 0xF9, 0x86, 0xEE, 0x0B, 0x2D, 0x9A, 0x34, 0x72, 0xAA, 0x56, 0x56, 0x07, 0x4E, 0x0B, 0x59,
+    0xC5, 0x56, 0xD6, 0xB2, 0x4E, 0x2F, 0xB4, 0xD2, 0x04, 0x96, 0x67, 0xC2, 0x84, 0x09, 0x72, 0xE1,
+    0xE9, 0x36, 0x94, 0x7F, 0xD2, 0xF8, 0x6D, 0x31, 0xE4, 0x81, 0x97, 0x1A, 0x88, 0x89, 0xA6, 0x84,
+    0xF4, 0x1F, 0x3C, 0xF5, 0x87, 0x13, 0x72, 0x7D, 0xEC, 0xAB, 0x3E, 0x76, 0x72, 0x82, 0x7F, 0xFA,
+    0x5B, 0x5F, 0x0C, 0xC2, 0x2C, 0xA1, 0xCE, 0x19, 0x52, 0xA9, 0xFD, 0x88, 0x86, 0x59, 0x59, 0xA7,
+    0x2D, 0xD2, 0x06, 0xDE, 0x1C, 0x29, 0x70, 0x2D, 0x00, 0xE5, 0xBF, 0x22, 0x6C, 0x73, 0xE6, 0x70,
+    0xA6, 0xBD, 0x08, 0x51, 0x63, 0x81, 0xAB, 0xB5, 0x46, 0x13, 0x92, 0x2A, 0x9D, 0x72, 0xFD, 0x16,
+    0x99, 0xBD, 0xB9, 0x63, 0x6D, 0x5D, 0x52, 0x42, 0x62, 0x42, 0xD3, 0x28, 0x1A, 0x4C, 0x0D, 0x05,
+    0x27, 0xC9, 0x73, 0x8E, 0x07, 0xEA, 0x84, 0x04, 0x5E, 0xC7, 0x1D, 0xC9, 0x40, 0x43, 0xDF, 0x30,
+    0xF2, 0x81, 0x13, 0x4F, 0x1A, 0xEC, 0xB4, 0x3C, 0x5C, 0x35, 0x7D, 0x5C, 0x9A, 0x90, 0x1B, 0xCD,
+    0xCD, 0x97, 0xFE, 0xF9, 0x4C, 0x06, 0x53, 0x48, 0x90, 0xBA, 0x1A, 0x8A, 0x07, 0xB9, 0x7F, 0xE8,
+    0xBB, 0xB3, 0x33, 0x37, 0xFD, 0xF7, 0xE1, 0xBB, 0x4A, 0xBF, 0x53, 0xDF, 0x85, 0xAF, 0x06, 0x39,
+    0x0E, 0x6B, 0xBC, 0xF9, 0x29, 0xCE, 0x3E, 0x7C, 0xFD, 0x91, 0x6F, 0xD3, 0xFD, 0x36, 0xF1, 0xFE,
+    0xDD, 0xAF, 0x3F, 0xC2, 0x1B, 0x87, 0x64, 0x83, 0x24, 0xC0, 0x9A, 0x63, 0x19, 0xB3, 0x24, 0x39,
+    0xDB, 0xE3, 0x12, 0xE8, 0xB1, 0x04, 0xA6, 0x9B, 0x2A, 0xFE, 0x80, 0x9C, 0x38, 0x1A, 0xFF, 0x06,
+    0x75, 0x55, 0x4D, 0x8C, 0xD5, 0x54, 0x18, 0x3D, 0xED, 0x65, 0x5E, 0x93, 0xA9, 0x99, 0xBA, 0x60,
+    0xA1, 0x83, 0x50, 0x17, 0x2C, 0xFC, 0x19, 0xA7, 0x2C, 0xC6, 0x84, 0x98, 0x32, 0xAD, 0x92, 0xB8,
+    0x85, 0x85, 0x2C, 0x09, 0x2C, 0x59, 0xA0, 0x03, 0x86, 0x05, 0x26, 0xC3, 0xBC, 0x8B, 0xB8, 0x31,
+    0xB3, 0x99, 0x04, 0x96, 0x2C, 0x26, 0x01, 0x13, 0x7E, 0x62, 0x42, 0xCC, 0x24, 0xB2, 0x18, 0xE9,
+    0x85, 0x59, 0x10, 0x74, 0x41, 0x65, 0xA1, 0x26, 0xC4, 0xD0, 0x28, 0x31, 0x51, 0x12, 0x2D, 0x4C,
+    0x4D, 0x3A, 0xD8, 0xBE, 0xEB, 0xF9, 0xFA, 0x66, 0x60, 0x62, 0x62, 0xD3, 0xDB, 0xF7, 0x7A, 0xDB,
+    0xEF, 0xEF, 0x7C, 0xE7, 0x3B, 0x05, 0xBA, 0xA3, 0xAF, 0x7B, 0x6B, 0x08, 0xED, 0x4D, 0xDB, 0x62,
+    0x2D, 0x98, 0xCF, 0x97, 0x9D, 0x34, 0xDA, 0xE2, 0x94, 0xC0, 0x75, 0x78, 0x06, 0xAA, 0x40, 0x04,
+    0x84, 0x40, 0x05, 0xA7, 0x46, 0x68, 0x90, 0x69, 0xAF, 0x41, 0x50, 0xF3, 0x17, 0x09, 0x14, 0x77,
+    0x79, 0x67, 0x10, 0xE4, 0xC8, 0x80, 0x9D, 0x70, 0x53, 0x6C, 0x3E, 0x5E, 0x87, 0xB3, 0x28, 0x76,
+    0x7C, 0xC3, 0xCF, 0x31, 0x07, 0x24, 0xA9, 0xAA, 0x37, 0x1E, 0x6E, 0x2B, 0xB0, 0xD5, 0xB1, 0x0D,
+    0x26, 0x54, 0x95, 0x20, 0x46, 0x1A, 0x62, 0x16, 0x0C, 0xC6, 0xE7, 0xD3, 0x60, 0xF8, 0x53, 0x6E,
+    0x49, 0x53, 0x89, 0x5F, 0x2A, 0x7A, 0xD7, 0xBE, 0x81, 0x84, 0x62, 0x3C, 0x95, 0xBA, 0xE2, 0xE4,
+    0x3F, 0xB1, 0x7A, 0x1A, 0x2D, 0x02, 0xED, 0xB4, 0x88, 0xB4, 0x6A, 0x24, 0x52, 0x23, 0xBB, 0x97,
+    0xD6, 0x1F, 0xBF, 0x3A, 0x93, 0x43, 0x59, 0xAB, 0xD1, 0x2F, 0x96, 0x11, 0x2C, 0x2A, 0xC3, 0x18,
+    0x31, 0x0B, 0xF3, 0x0D, 0x43, 0xD4, 0xD8, 0xC3, 0x6A, 0x7C, 0xD3, 0x37, 0xA8, 0xC3, 0x12, 0xC1,
+    0x7B, 0xF4, 0xBF, 0x2B, 0xA1, 0x95, 0xC7, 0x44, 0x70, 0x78, 0x53, 0x94, 0x66, 0x9C, 0x39, 0xAE,
+    0x94, 0x50, 0x4D, 0x9F, 0xC8, 0xCD, 0x97, 0xE8, 0x5D, 0xDC, 0xF4, 0xD4, 0x35, 0xBC, 0x4C, 0x72,
+    0x09, 0x7E, 0x08, 0x24, 0x41, 0xD6, 0x04, 0xE6, 0x1F, 0x68, 0xC2, 0x38, 0x47, 0x14, 0x55, 0xE5,
+    0x6B, 0x8C, 0xEA, 0x58, 0xB6, 0x0B, 0x74, 0xD0, 0x42, 0x6A, 0x66, 0x74, 0x5E, 0xF6, 0x88, 0x93,
+    0xCE, 0xF6, 0x90, 0x04, 0x63, 0x05, 0xDE, 0x8F, 0xBC, 0x4D, 0xC6, 0xF5, 0xBA, 0x4B, 0xCD, 0xCB,
+    0xF2, 0x86, 0x6D, 0x24, 0x91, 0x2A, 0x5E, 0xC6, 0xC4, 0xC9, 0xFE, 0x2E, 0x03, 0x7D, 0xE7, 0xCD,
+    0x0B, 0x5F, 0xBE, 0xBD, 0x52, 0xEF, 0xE0, 0xC6, 0xF6, 0xDE, 0xCD, 0xF3, 0x49, 0x3E, 0x05, 0x0C,
+    0x5E, 0x72, 0x6B, 0xE7, 0x56, 0xDC, 0x7F, 0x7F, 0xC1, 0x7B, 0x9C, 0x27, 0x67, 0xCE, 0x1F, 0x5F,
+    0x11, 0x2B, 0xD5, 0xB8, 0x66, 0xCA, 0x47, 0x31, 0xE1, 0xA4, 0x3D, 0xFD, 0xED, 0x2B, 0x79, 0x73,
+    0xFC, 0x76, 0xBD, 0x05, 0xFE, 0xAD, 0xCF, 0x77, 0x9D, 0x3D, 0x18, 0xDD, 0x3C, 0x72, 0x63, 0x58,
+    0xD2, 0x5F, 0x85, 0xB2, 0xB5, 0x57, 0x2D, 0xFB, 0x66, 0x36, 0x48, 0xEB, 0x10, 0x55, 0xE2, 0x96,
+    0x89, 0x2A, 0x6F, 0x78, 0x65, 0xEF, 0xF4, 0x9D, 0x77, 0xCE, 0x7E, 0xF8, 0xF1, 0xED, 0x6A, 0x12,
+    0x8E, 0x9E, 0x75, 0xF5, 0x94, 0xE7, 0x2C, 0x25, 0xC6, 0x2B, 0x77, 0xE6, 0x2A, 0x8D, 0x3D, 0x33,
+    0xB7, 0xB7, 0x85, 0x2A, 0xB1, 0xE0, 0x91, 0x00, 0xD7, 0xB2, 0x77, 0x89, 0x93, 0x8E, 0xC7, 0x56,
+    0x8E, 0x64, 0xE6, 0x84, 0xCF, 0xB4, 0xDB, 0xD7, 0x54, 0x9A, 0xA4, 0xBB, 0xB3, 0x9E, 0x76, 0xEA,
+    0x97, 0xD1, 0x7A, 0x47, 0x27, 0x8E, 0x7D, 0xAD, 0x89, 0x83, 0xDF, 0x28, 0x7D, 0x6C, 0xCC, 0xC9,
+    0x63, 0x37, 0xED, 0x19, 0x49, 0x6A, 0xEA, 0xBB, 0xA3, 0xD3, 0xA9, 0x24, 0x75, 0xE1, 0x59, 0x52,
+    0xD7, 0xE1, 0x56, 0xF0, 0x72, 0x84, 0xC2, 0x41, 0x81, 0xA3, 0x92, 0x40, 0xDC, 0x20, 0x86, 0x44,
+    0x28, 0xEC, 0x90, 0x49, 0x84, 0x47, 0xEB, 0x67, 0xD2, 0x9D, 0x42, 0xE4, 0xB4, 0xE3, 0xA2, 0x91,
+    0xB6, 0x34, 0x82, 0x3B, 0x73, 0x23, 0xDE, 0xB4, 0x56, 0x1B, 0xD6, 0x7C, 0xEB, 0x94, 0x3C, 0xE1,
+    0x36, 0x37, 0x42, 0xE9, 0xA0, 0xD3, 0xFD, 0x8D, 0xC4, 0x44, 0xF8, 0x98, 0x0E, 0xFB, 0x35, 0x41,
+    0xDC, 0x77, 0x03, 0x13, 0xD7, 0x80, 0xDD, 0x05, 0x1C, 0x5B, 0x70, 0x88, 0x0A, 0x64, 0xD6, 0xB8,
+    0xF6, 0x6E, 0xEA, 0xD9, 0x83, 0x08, 0x1E, 0xC4, 0x88, 0x7E, 0x3E, 0x81, 0x64, 0xB9, 0x44, 0xF2,
+    0x77, 0x8E, 0xFE, 0xEA, 0x4F, 0xE8, 0x93, 0xF0, 0x89, 0xAD, 0x11, 0xD9, 0x0A, 0x01, 0xD7, 0x26,
+    0x0F, 0xCF, 0x0F, 0x27, 0x2B, 0xF8, 0xA2, 0xF6, 0xF9, 0x6E, 0xB6, 0xF0, 0xA2, 0x57, 0xC9, 0xDC,
+    0xC0, 0x6D, 0xC6, 0x17, 0x83, 0x22, 0x33, 0xC9, 0x99, 0xDC, 0xB1, 0x3B, 0x0E, 0x93, 0xCB, 0x26,
+    0xB0, 0x03, 0xC6, 0xAC, 0xE8, 0x2C, 0x1F, 0x1A, 0x66, 0xA9, 0x6B, 0x2B, 0xA7, 0x1C, 0x51, 0xB6,
+    0x75, 0xAC, 0x85, 0x47, 0x2C, 0x6C, 0xE9, 0x33, 0x1C, 0xCB, 0x98, 0x49, 0x61, 0x07, 0x3A, 0xB1,
+    0xD5, 0xE8, 0x95, 0xCB, 0x0C, 0xB1, 0x9F, 0x95, 0x78, 0xA5, 0x60, 0x56, 0x49, 0xDD, 0xB5, 0xE0,
+    0xD6, 0x10, 0x9E, 0xA4, 0x89, 0x30, 0x9E, 0x0D, 0xB2, 0x4B, 0x89, 0xB5, 0x74, 0x3D, 0x98, 0x6E,
+    0xD8, 0xAB, 0x84, 0x70, 0x34, 0x09, 0x51, 0x6E, 0x12, 0xE2, 0x5C, 0x47, 0xC4, 0xA3, 0x0A, 0xD7,
+    0x63, 0xF6, 0x89, 0x63, 0x66, 0x31, 0xD2, 0xCE, 0x9C, 0xA3, 0x49, 0xE3, 0x96, 0xA1, 0x56, 0x12,
+    0x9B, 0x72, 0xE2, 0x4B, 0x91, 0xBF, 0xA7, 0x22, 0x1B, 0x1C, 0xCA, 0xAE, 0x0A, 0xF4, 0xB9, 0xB2,
+    0x2E, 0x57, 0xB1, 0x4F, 0x64, 0x46, 0x03, 0x8F, 0x7B, 0xDE, 0x69, 0xDE, 0xBB, 0xF9, 0x12, 0xEF,
+    0xCB, 0x18, 0x89, 0x9E, 0xB6, 0x98, 0x5E, 0x0C, 0x2D, 0x5E, 0xA0, 0x17, 0xA3, 0x1E, 0xAA, 0xB2,
+    0x24, 0xF0, 0xB5, 0xF4, 0xE2, 0x9B, 0x28, 0x9D, 0xAB, 0x93, 0x20, 0x4F, 0x9A, 0xD1, 0x4F, 0x17,
+    0xBD, 0x75, 0x39, 0x19, 0x25, 0xF3, 0x63, 0xEC, 0xE0, 0x50, 0x2F, 0x29, 0xA3, 0x4C, 0x30, 0x1A,
+    0x10, 0x00, 0xFB, 0x88, 0xCB, 0x7B, 0x70, 0x97, 0x28, 0x5C, 0x27, 0xA0, 0xC6, 0x19, 0x64, 0xF0,
+    0x9E, 0x10, 0x8D, 0x79, 0x83, 0x53, 0x32, 0x3C, 0xE7, 0xBA, 0xFC, 0x29, 0x78, 0xD6, 0x94, 0x81,
+    0x59, 0x3A, 0xA9, 0xCC, 0xF6, 0xB7, 0x9C, 0x7B, 0xF3, 0xFB, 0xF0, 0xD5, 0xAF, 0x2B, 0x26, 0x5E,
+    0x7A, 0x52, 0x8C, 0xC5, 0xA8, 0xBC, 0x7D, 0xE9, 0xAC, 0xBB, 0xB2, 0x96, 0xA1, 0x4C, 0x28, 0x1F,
+    0xCE, 0x55, 0xC9, 0x9B, 0x0C, 0xEE, 0xDD, 0x20, 0xFB, 0x2C, 0xFF, 0xA6, 0x88, 0x96, 0x29, 0x2D,
+    0x05, 0xDE, 0x22, 0x7C, 0xC5, 0x2C, 0xBC, 0xBD, 0xC2, 0x84, 0xB4, 0xAB, 0x6D, 0xEB, 0x7E, 0xBC,
+    0x71, 0x65, 0xD1, 0x65, 0xAF, 0x86, 0x69, 0x46, 0x0C, 0x6E, 0xB5, 0x1A, 0x5C, 0x04, 0x89, 0xDC,
+    0xB7, 0x1D, 0x05, 0xC8, 0x27, 0x25, 0xFC, 0x11, 0x62, 0x74, 0x22, 0x29, 0x0D, 0xE7, 0x33, 0x71,
+    0xE9, 0xB7, 0x9D, 0x19, 0x81, 0xBD, 0x4D, 0x6C, 0x33, 0xEA, 0x97, 0xFA, 0x8D, 0xD0, 0x91, 0x84,
+    0x2D, 0xC2, 0x16, 0xAE, 0xFD, 0x8C, 0xAF, 0x51, 0xD3, 0x2A, 0x39, 0xFD, 0x01, 0xB0, 0x2F, 0x17,
+    0x45, 0x26, 0xD1, 0xF9, 0xDF, 0xA5, 0x4B, 0x4C, 0x87, 0xB9, 0x73, 0xF5, 0xA9, 0xBD, 0x2C, 0x7A,
+    0xEA, 0x1C, 0xFA, 0xC1, 0x7E, 0x00, 0x49, 0x46, 0x58, 0xE3, 0xB2, 0x43, 0x48, 0xBE, 0x58, 0x17,
+    0x39, 0x19, 0x2C, 0xAA, 0x38, 0x9B, 0x2D, 0x69, 0x9A, 0x67, 0x5C, 0x64, 0x79, 0x08, 0x30, 0x5C,
+    0x33, 0x17, 0xD9, 0x8C, 0x96, 0xD9, 0xB4, 0xB0, 0xCB, 0x5B, 0xDC, 0x26, 0xA6, 0x9A, 0x9D, 0xA4,
+    0xF9, 0x12, 0x82, 0x62, 0x70, 0x2E, 0xC8, 0x6D, 0x1B, 0xF0, 0x2B, 0x12, 0xDE, 0xFB, 0xA5, 0x0A,
+    0xFE, 0x79, 0x54, 0x06, 0xD6, 0x52, 0x3A, 0x58, 0x52, 0xB6, 0xF6, 0xDC, 0xCD, 0xC8, 0x86, 0xDF,
+    0xAC, 0x92, 0x04, 0x19, 0xD9, 0xF1, 0x8A, 0xA1, 0xB0, 0x09, 0xE1, 0xEE, 0x71, 0x0D, 0x36, 0x4A,
+    0xB6, 0xDF, 0x73, 0x59, 0x55, 0xF6, 0x38, 0xB4, 0x7F, 0x10, 0xE9, 0x48, 0x12, 0xDE, 0x66, 0x17,
+    0x36, 0x5C, 0x28, 0x8D, 0x13, 0x98, 0xC9, 0xA3, 0xD6, 0xFB, 0x13, 0x4F, 0xF3, 0x30, 0x76, 0x57,
+    0x4D, 0xD4, 0x38, 0xB6, 0xF4, 0x06, 0x24, 0x02, 0x86, 0x5F, 0x07, 0x26, 0xD1, 0x6E, 0xBC, 0x4F,
+    0x97, 0xA6, 0x4F, 0x08, 0x0F, 0xF4, 0x0F, 0x74, 0x33, 0x2E, 0x0A, 0x20, 0x8B, 0x1A, 0x20, 0x5F,
+    0x32, 0x51, 0x01, 0xF8, 0x5C, 0x01, 0x13, 0x12, 0xCA, 0x2A, 0xDB, 0x78, 0x84, 0x30, 0x94, 0x2E,
+    0x05, 0xB6, 0x0C, 0xD9, 0xA0, 0x52, 0x4E, 0xA7, 0xFB, 0x16, 0xF2, 0x1B, 0xA4, 0xBA, 0x93, 0x02,
+    0xE1, 0x3E, 0xD6, 0xC1, 0xC0, 0xC9, 0xAA, 0x70, 0x4D, 0x67, 0xD6, 0xE9, 0xD7, 0xC1, 0xDA, 0x64,
+    0x7F, 0xA5, 0x0C, 0x33, 0x76, 0xCA, 0x7D, 0x38, 0x1C, 0xE9, 0xB4, 0xFB, 0x14, 0x50, 0xFB, 0xDD,
+    0x01, 0x7B, 0x5D, 0x33, 0x19, 0xE3, 0x0F, 0x96, 0xF1, 0xF4, 0xBE, 0x0E, 0xE2, 0xCA, 0x59, 0xBD,
+    0x8B, 0xC9, 0x4F, 0x4A, 0x75, 0xFF, 0x23, 0xC4, 0xAB, 0xB9, 0xF7, 0x60, 0x76, 0x93, 0x18, 0xC8,
+    0x7C, 0x91, 0x9F, 0x44, 0xA8, 0xA6, 0xC4, 0x4D, 0x52, 0x97, 0x22, 0x3D, 0xD2, 0x0D, 0xBF, 0xCD,
+    0x3B, 0x78, 0x2D, 0x27, 0x8C, 0xA9, 0x93, 0xEF, 0x25, 0x7B, 0xDB, 0x0C, 0xC7, 0x6C, 0x53, 0x07,
+    0xFF, 0xF7, 0xF8, 0x17, 0x4D, 0x54, 0x3B, 0x6C, 0xDC, 0x46, 0x10, 0x7D, 0xCB, 0x95, 0x8E, 0xB1,
+    0x56, 0xC8, 0xAA, 0x90, 0x00, 0xC3, 0x80, 0xC1, 0xC6, 0x85, 0x11, 0x28, 0x62, 0x2B, 0x04, 0x77,
+    0x47, 0x3A, 0x2A, 0x8D, 0x7C, 0x0A, 0xA7, 0xB6, 0xFB, 0x00, 0x51, 0x17, 0xA4, 0x90, 0x4D, 0x0A,
+    0x2E, 0x52, 0xA4, 0xB9, 0xDE, 0x41, 0x90, 0x22, 0x85, 0xC1, 0x46, 0x2E, 0x04, 0x47, 0x85, 0xE4,
+    0x5B, 0xC9, 0x85, 0x8B, 0x00, 0x77, 0x0C, 0x90, 0xCE, 0x40, 0x44, 0x3B, 0xCE, 0x07, 0x69, 0xB4,
+    0x88, 0x18, 0x84, 0x52, 0x48, 0x4E, 0x66, 0x79, 0x8A, 0xE1, 0xC1, 0x1D, 0x70, 0xDC, 0x9B, 0xF7,
+    0xE6, 0xCD, 0x9B, 0x59, 0x02, 0xC0, 0x3A, 0x50, 0xC2, 0x2B, 0x20, 0x0F, 0x0F, 0xF4, 0x49, 0x13,
+    0xD2, 0x28, 0xC9, 0x11, 0x1A, 0x28, 0x0B, 0x51, 0x02, 0x77, 0x80, 0x1E, 0x10, 0xA6, 0x82, 0x72,
+    0x45, 0x65, 0x74, 0xB7, 0xDE, 0xDB, 0x5A, 0x5F, 0xDA, 0x73, 0x10, 0x70, 0x82, 0x75, 0xC0, 0x8B,
+    0xB8, 0x0A, 0x68, 0x40, 0xA5, 0xF7, 0x36, 0xF2, 0xA8, 0xB5, 0x3D, 0xAA, 0xD1, 0x6B, 0x20, 0x6B,
+    0xE8, 0x02, 0x41, 0x8A, 0x4B, 0x2E, 0x1F, 0xEF, 0x02, 0xBE, 0xE9, 0x7E, 0x0D, 0xA0, 0x6E, 0x7E,
+    0x79, 0xE3, 0xEC, 0x1F, 0xAB, 0xC9, 0x62, 0x5C, 0xC2, 0x67, 0xC2, 0x6B, 0x1D, 0xCF, 0x1D, 0x2C,
+    0x42, 0x1A, 0x96, 0xB5, 0x2A, 0xB0, 0x2B, 0x7E, 0xA3, 0x57, 0x9C, 0xF2, 0x80, 0x2C, 0x8D, 0xB0,
+    0xF9, 0x63, 0x05, 0x44, 0xA2, 0x82, 0xB4, 0x28, 0x5C, 0xB1, 0x8B, 0xF0, 0x52, 0xD1, 0x30, 0xC7,
+    0xF0, 0xDF, 0x1F, 0x3E, 0xBC, 0x2E, 0x72, 0xAC, 0xCE, 0xE0, 0x32, 0x45, 0x1F, 0x9E, 0x11, 0x57,
+    0xB1, 0xF7, 0xCB, 0x11, 0xD5, 0x3E, 0x41, 0x19, 0x2C, 0x03, 0x57, 0xB6, 0xC7, 0xA4, 0xDB, 0x38,
+    0xAA, 0xD0, 0x36, 0xDE, 0x0B, 0xBA, 0x69, 0x92, 0xCF, 0x70, 0xFD, 0xED, 0x11, 0x22, 0x1A, 0xF5,
+    0x28, 0x55, 0xAD, 0xD7, 0x56, 0xC9, 0xD3, 0xE7, 0xA5, 0xFE, 0x00, 0x83, 0xB7, 0x5C, 0x7B, 0x81,
+    0x97, 0x96, 0x7D, 0xFF, 0x59, 0x3A, 0xD8, 0x15, 0x04, 0x6D, 0xA3, 0xD6, 0xA7, 0xBC, 0xB7, 0x0F,
+    0xCC, 0xB3, 0x09, 0xD7, 0x02, 0x79, 0x3F, 0xEF, 0x6F, 0x79, 0xD3, 0x38, 0xB0, 0x68, 0xA0, 0xC9,
+    0x8C, 0x6B, 0xFF, 0x57, 0x78, 0xB1, 0x6B, 0xB0, 0x6B, 0x95, 0x15, 0x07, 0x44, 0xF7, 0xCF, 0xB3,
+    0x87, 0xE1, 0x9F, 0xD9, 0x28, 0xA1, 0x56, 0xD4, 0x70, 0xFA, 0x70, 0xD9, 0x29, 0x5F, 0x62, 0xDB,
+    0x1E, 0xC1, 0x3B, 0x2D, 0x10, 0x4D, 0x0B, 0xD9, 0x26, 0x79, 0xF2, 0xF8, 0xF8, 0xE9, 0xCB, 0x69,
+    0x70, 0x49, 0xAF, 0x2F, 0xE1, 0xBD, 0x1C, 0xDE, 0x31, 0x9B, 0xDA, 0x67, 0xB2, 0x02, 0xE2, 0x79,
+    0x0C, 0x31, 0xE7, 0x40, 0x8B, 0x4C, 0x90, 0x03, 0x43, 0xB0, 0xFF, 0xCC, 0xBD, 0x9D, 0x65, 0xCD,
+    0x3B, 0xD9, 0xCE, 0x33, 0x22, 0x9E, 0x61, 0x35, 0x3B, 0x4F, 0x81, 0x1B, 0x9C, 0xF5, 0xCD, 0x0C,
+    0xBD, 0xCA, 0x7E, 0x7F, 0xCE, 0x88, 0xDF, 0x53, 0xB1, 0x31, 0x9D, 0xD3, 0x5F, 0xF5, 0xFB, 0xFA,
+    0xE7, 0xEF, 0x4B, 0xDD, 0x50, 0xAC, 0x4E, 0x2B, 0xA8, 0x63, 0x03, 0xFF, 0x6B, 0x06, 0x2D, 0x39,
+    0xDD, 0x8B, 0x2C, 0x5C, 0x1A, 0x56, 0x3E, 0x64, 0xE9, 0x1D, 0xBF, 0x13, 0x9F, 0x35, 0xAC, 0x7E,
+    0xC7, 0x24, 0x5C, 0x43, 0xD4, 0xB2, 0xE4, 0x0C, 0x6E, 0xEF, 0xB2, 0x2B, 0xC3, 0xDB, 0x33, 0x8E,
+    0x3D, 0x3A, 0x53, 0xC7, 0x4D, 0x38, 0x59, 0x8E, 0x26, 0x58, 0x98, 0x40, 0xFC, 0xFF, 0x59, 0x9B,
+    0x80, 0x4F, 0xF4, 0xE4, 0x0B, 0x79, 0xD2, 0x08, 0x7A, 0x85, 0x7B, 0x70, 0x03, 0x70, 0xA1, 0xD3,
+    0x6E, 0xE2, 0xCC, 0xA2, 0x63, 0x67, 0x87, 0xB0, 0x7E, 0xB3, 0xEB, 0xF3, 0x94, 0x6C, 0xEB, 0xD9,
+    0x30, 0xAE, 0x94, 0x19, 0xAA, 0x5C, 0x53, 0xE1, 0x71, 0x53, 0x61, 0xEE, 0x10, 0x22, 0x46, 0xAF,
+    0x3D, 0x80, 0x24, 0x4A, 0x41, 0xB7, 0x4B, 0x44, 0xEF, 0x53, 0xAA, 0xF3, 0x83, 0x1A, 0x55, 0xA8,
+    0x4D, 0xF8, 0x91, 0xA9, 0xE4, 0x29, 0x03, 0xA3, 0x4A, 0x5A, 0xBF, 0xED, 0xB5, 0x60, 0xA9, 0xBC,
+    0xB0, 0x54, 0x79, 0x44, 0x2D, 0x06, 0x9B, 0x2D, 0x10, 0x77, 0x85, 0x57, 0x78, 0x2C, 0x6C, 0x07,
+    0xC5, 0x88, 0x4A, 0xA8, 0x93, 0x54, 0x54, 0x35, 0x22, 0x6D, 0xB4, 0x69, 0xBC, 0x4A, 0xE7, 0x09,
+    0x9E, 0x68, 0xA3, 0xFE, 0xE2, 0xA6, 0x23, 0xA2, 0x97, 0x59, 0xF6, 0x90, 0x11, 0x5C, 0xF1, 0x05,
+    0x91, 0xD5, 0x1B, 0x85, 0x7F, 0x58, 0x7A, 0x76, 0x1F, 0xD5, 0x10, 0x03, 0x1D, 0x07, 0xBE, 0x51,
+    0x47, 0x56, 0x16, 0x95, 0x28, 0x07, 0xD8, 0x0F, 0xB0, 0x32, 0x1F, 0xE3, 0xD6, 0x3C, 0xF8, 0x58,
+    0xE6, 0x25, 0xAA, 0x08, 0xA1, 0x62, 0x1B, 0x4B, 0x94, 0x43, 0x0C, 0x95, 0x51, 0x87, 0xD6, 0xE5,
+    0x0D, 0x75, 0x1A, 0x51, 0xA3, 0x5D, 0x0F, 0xB3, 0x88, 0xC8, 0x04, 0x64, 0x79, 0x9F, 0x71, 0xC0,
+    0x56, 0x98, 0xEE, 0xCA, 0xB1, 0x29, 0x6B, 0x70, 0x5E, 0x3D, 0x61, 0x6F, 0x89, 0x01, 0xF9, 0x42,
+    0xF6, 0x2D, 0x16, 0xC6, 0x47, 0xD4, 0xAC, 0x7C, 0xC2, 0x98, 0x85, 0x8C, 0x53, 0x99, 0xC1, 0xFF,
+    0x69, 0xB6, 0x08, 0x1E, 0xA3, 0xDD, 0x7D, 0x04, 0x6F, 0x16, 0xEE, 0x3A, 0x52, 0xFE, 0x86, 0x31,
+    0x14, 0xF3, 0x49, 0xE2, 0x84, 0x31, 0x27, 0x04, 0x9C, 0x20, 0x5D, 0x02, 0xE6, 0x10, 0x0B, 0x9A,
+    0x96, 0x3E, 0x51, 0xAD, 0xB7, 0xAB, 0x7E, 0x80, 0xA2, 0xBF, 0xE6, 0x15, 0x5B, 0x21, 0x51, 0xC9,
+    0xD3, 0x2E, 0x54, 0x35, 0x4E, 0x5D, 0x12, 0x47, 0xC2, 0x96, 0x25, 0x7C, 0xBF, 0x87, 0xFC, 0x14,
+    0xA2, 0x1B, 0x95, 0xBB, 0x43, 0x90, 0x85, 0x5B, 0x3D, 0x74, 0xCB, 0xED, 0xD4, 0xBE, 0xF9, 0xA7,
+    0x78, 0x50, 0xC0, 0x27, 0xE7, 0x30, 0x17, 0x54, 0xE5, 0xEB, 0x3B, 0x8A, 0x5A, 0xD4, 0x5E, 0xED,
+    0xF6, 0xD3, 0x85, 0x62, 0xC3, 0x43, 0x13, 0x19, 0xF1, 0xDD, 0xB2, 0x6A, 0x06, 0xC1, 0xED, 0x5A,
+    0x29, 0xC7, 0x17, 0x14, 0x45, 0xF4, 0xB7, 0xDD, 0x4F, 0xF2, 0xE5, 0x2B, 0xF1, 0x05, 0x8C, 0xD7,
+    0xD7, 0xBD, 0x2E, 0x3C, 0x2E, 0xAB, 0xF8, 0x2C, 0x68, 0xD8, 0xB2, 0xB6, 0x23, 0xE7, 0x1D, 0x15,
+    0x3C, 0x17, 0xEE, 0xC3, 0x8A, 0xB3, 0x99, 0x28, 0x6E, 0xB8, 0xD3, 0x32, 0x8B, 0x5D, 0x86, 0x54,
+    0x5D, 0xF7, 0x8A, 0xC7, 0x9D, 0x94, 0xB3, 0x66, 0x12, 0x7E, 0x91, 0xF4, 0xDC, 0x00, 0x7A, 0xE4,
+    0x38, 0x73, 0x79, 0xFE, 0x31, 0x0B, 0x66, 0xC2, 0x95, 0x9D, 0xFA, 0x35, 0x74, 0xCD, 0xB9, 0xC8,
+    0xC9, 0x01, 0xEF, 0x8D, 0x5B, 0x5C, 0x57, 0x17, 0x9B, 0xB5, 0xD8, 0xA4, 0x3F, 0x24, 0x3F, 0xFA,
+    0x7C, 0x32, 0x37, 0xFF, 0x29, 0x8F, 0x8E, 0x4C, 0x74, 0x7E, 0xAB, 0x83, 0xFC, 0x07,
+};
+
+static const uint32_t opendyslexic_8_bolditalicBlockOffsets[18] = {
+    0, 1286, 2591, 3847, 4819, 5875, 6905, 7912,
+    8963, 10112, 11336, 12691, 13999, 15329, 16501, 17728,
+    19044, 19982,
+};
+
+static const uint16_t opendyslexic_8_bolditalicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_8_bolditalicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_8_bolditalicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
@@ -2171,686 +1441,686 @@ static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 15, 18, 15, 0, 14, 68, 1855 }, // J
     { 15, 14, 17, 1, 14, 53, 1923 }, // K
     { 11, 14, 15, 1, 14, 39, 1976 }, // L
-    { 18, 14, 19, 1, 14, 63, 2015 }, // M
-    { 16, 14, 17, 1, 14, 56, 2078 }, // N
-    { 17, 15, 19, 1, 14, 64, 2134 }, // O
-    { 14, 15, 15, 1, 15, 53, 2198 }, // P
-    { 17, 18, 19, 1, 15, 77, 2251 }, // Q
-    { 13, 15, 16, 1, 14, 49, 2328 }, // R
-    { 15, 15, 17, 1, 15, 57, 2377 }, // S
-    { 14, 14, 17, 4, 14, 49, 2434 }, // T
-    { 16, 15, 17, 1, 14, 60, 2483 }, // U
-    { 14, 14, 18, 5, 14, 49, 2543 }, // V
-    { 20, 15, 23, 4, 15, 75, 2592 }, // W
-    { 17, 14, 18, 1, 14, 60, 2667 }, // X
-    { 13, 14, 18, 5, 14, 46, 2727 }, // Y
-    { 17, 14, 18, 1, 14, 60, 2773 }, // Z
-    { 13, 25, 8, -1, 18, 82, 2833 }, // [
-    { 4, 19, 8, 3, 15, 19, 2915 }, // <backslash>
-    { 13, 25, 8, -4, 18, 82, 2934 }, // ]
-    { 10, 5, 9, 2, 16, 13, 3016 }, // ^
-    { 14, 4, 11, -2, 0, 14, 3029 }, // _
-    { 7, 4, 7, 3, 13, 7, 3043 }, // `
-    { 11, 10, 14, 1, 10, 28, 3050 }, // a
-    { 11, 16, 14, 2, 15, 44, 3078 }, // b
-    { 10, 10, 13, 1, 10, 25, 3122 }, // c
-    { 14, 14, 15, 1, 14, 49, 3147 }, // d
-    { 12, 9, 14, 1, 9, 27, 3196 }, // e
-    { 10, 14, 11, 2, 14, 35, 3223 }, // f
-    { 14, 14, 14, 0, 9, 49, 3258 }, // g
-    { 12, 14, 15, 1, 14, 42, 3307 }, // h
-    { 9, 15, 7, 0, 15, 34, 3349 }, // i
-    { 11, 20, 10, 1, 15, 55, 3383 }, // j
-    { 11, 14, 15, 1, 14, 39, 3438 }, // k
-    { 8, 14, 10, 1, 14, 28, 3477 }, // l
-    { 18, 10, 20, 1, 10, 45, 3505 }, // m
-    { 12, 10, 14, 1, 10, 30, 3550 }, // n
-    { 12, 9, 14, 1, 9, 27, 3580 }, // o
-    { 15, 15, 16, -1, 10, 57, 3607 }, // p
-    { 13, 15, 16, 1, 10, 49, 3664 }, // q
-    { 10, 9, 12, 1, 9, 23, 3713 }, // r
-    { 11, 11, 14, 1, 10, 31, 3736 }, // s
-    { 9, 13, 13, 3, 13, 30, 3767 }, // t
-    { 11, 9, 14, 2, 9, 25, 3797 }, // u
-    { 13, 9, 16, 3, 9, 30, 3822 }, // v
-    { 15, 11, 18, 3, 9, 42, 3852 }, // w
-    { 14, 9, 16, 1, 9, 32, 3894 }, // x
-    { 15, 14, 15, 0, 9, 53, 3926 }, // y
-    { 13, 9, 15, 1, 9, 30, 3979 }, // z
-    { 12, 17, 12, 1, 13, 51, 4009 }, // {
-    { 7, 16, 7, 1, 13, 28, 4060 }, // |
-    { 11, 17, 12, -1, 13, 47, 4088 }, // }
-    { 8, 4, 8, 3, 12, 8, 4135 }, // ~
-    { 0, 0, 14, 0, 0, 0, 4143 }, //  
-    { 9, 22, 9, 2, 19, 50, 4143 }, // ¡
-    { 10, 15, 13, 1, 12, 38, 4193 }, // ¢
-    { 13, 15, 12, 0, 14, 49, 4231 }, // £
-    { 12, 10, 11, 1, 11, 30, 4280 }, // ¤
-    { 15, 16, 13, 1, 13, 60, 4310 }, // ¥
-    { 7, 15, 7, 1, 12, 27, 4370 }, // ¦
-    { 14, 14, 13, 0, 13, 49, 4397 }, // §
-    { 9, 4, 9, 3, 14, 9, 4446 }, // ¨
-    { 10, 7, 11, 4, 16, 18, 4455 }, // ©
-    { 6, 6, 11, 5, 13, 9, 4473 }, // ª
-    { 12, 10, 14, 1, 10, 30, 4482 }, // «
-    { 10, 6, 10, 1, 6, 15, 4512 }, // ¬
-    { 10, 2, 10, 1, 6, 5, 4527 }, // ­
-    { 9, 7, 11, 5, 18, 16, 4532 }, // ®
-    { 8, 3, 9, 3, 13, 6, 4548 }, // ¯
-    { 10, 8, 11, 3, 13, 20, 4554 }, // °
-    { 13, 12, 14, 0, 9, 39, 4574 }, // ±
-    { 6, 7, 5, 6, 14, 11, 4613 }, // ²
-    { 6, 7, 6, 6, 14, 11, 4624 }, // ³
-    { 5, 4, 5, 3, 13, 5, 4635 }, // ´
-    { 14, 12, 14, -1, 9, 42, 4640 }, // µ
-    { 13, 15, 13, 1, 12, 49, 4682 }, // ¶
-    { 5, 4, 4, 1, 8, 5, 4731 }, // ·
-    { 6, 6, 5, -1, 1, 9, 4736 }, // ¸
-    { 5, 7, 5, 6, 14, 9, 4745 }, // ¹
-    { 7, 6, 11, 5, 13, 11, 4754 }, // º
-    { 12, 10, 12, -3, 10, 30, 4765 }, // »
-    { 18, 17, 22, 1, 15, 77, 4795 }, // ¼
-    { 19, 17, 22, 1, 15, 81, 4872 }, // ½
-    { 18, 15, 22, 1, 13, 68, 4953 }, // ¾
-    { 12, 21, 11, -1, 12, 63, 5021 }, // ¿
-    { 14, 19, 19, 1, 19, 67, 5084 }, // À
-    { 15, 22, 19, 1, 22, 83, 5151 }, // Á
-    { 15, 20, 19, 1, 20, 75, 5234 }, // Â
-    { 15, 19, 19, 1, 19, 72, 5309 }, // Ã
-    { 16, 20, 19, 1, 20, 80, 5381 }, // Ä
-    { 15, 20, 19, 1, 20, 75, 5461 }, // Å
-    { 23, 15, 23, 1, 14, 87, 5536 }, // Æ
-    { 15, 19, 16, 1, 15, 72, 5623 }, // Ç
-    { 14, 19, 15, 1, 19, 67, 5695 }, // È
-    { 14, 22, 15, 1, 22, 77, 5762 }, // É
-    { 14, 20, 15, 1, 20, 70, 5839 }, // Ê
-    { 15, 20, 15, 1, 20, 75, 5909 }, // Ë
-    { 10, 20, 9, 1, 20, 50, 5984 }, // Ì
-    { 11, 23, 9, 1, 23, 64, 6034 }, // Í
-    { 11, 21, 9, 1, 21, 58, 6098 }, // Î
-    { 12, 21, 9, 1, 21, 63, 6156 }, // Ï
-    { 17, 14, 17, 0, 14, 60, 6219 }, // Ð
-    { 16, 19, 17, 1, 19, 76, 6279 }, // Ñ
-    { 17, 20, 19, 1, 19, 85, 6355 }, // Ò
-    { 17, 23, 19, 1, 22, 98, 6440 }, // Ó
-    { 17, 21, 19, 1, 20, 90, 6538 }, // Ô
-    { 17, 20, 19, 1, 19, 85, 6628 }, // Õ
-    { 17, 21, 19, 1, 20, 90, 6713 }, // Ö
-    { 11, 6, 10, 0, 7, 17, 6803 }, // ×
-    { 34, 30, 19, -7, 22, 255, 6820 }, // Ø
-    { 16, 21, 17, 1, 20, 84, 7075 }, // Ù
-    { 16, 24, 17, 1, 23, 96, 7159 }, // Ú
-    { 16, 22, 17, 1, 21, 88, 7255 }, // Û
-    { 16, 22, 17, 1, 21, 88, 7343 }, // Ü
-    { 13, 24, 18, 5, 24, 78, 7431 }, // Ý
-    { 11, 14, 9, 0, 14, 39, 7509 }, // Þ
-    { 13, 14, 11, 0, 13, 46, 7548 }, // ß
-    { 11, 14, 14, 1, 14, 39, 7594 }, // à
-    { 12, 17, 14, 1, 17, 51, 7633 }, // á
-    { 12, 15, 14, 1, 15, 45, 7684 }, // â
-    { 12, 15, 14, 1, 15, 45, 7729 }, // ã
-    { 13, 15, 14, 1, 15, 49, 7774 }, // ä
-    { 11, 16, 14, 1, 16, 44, 7823 }, // å
-    { 18, 10, 21, 1, 10, 45, 7867 }, // æ
-    { 10, 14, 13, 1, 10, 35, 7912 }, // ç
-    { 12, 16, 14, 1, 16, 48, 7947 }, // è
-    { 13, 19, 14, 1, 19, 62, 7995 }, // é
-    { 13, 17, 14, 1, 17, 56, 8057 }, // ê
-    { 14, 17, 14, 1, 17, 60, 8113 }, // ë
-    { 8, 14, 7, 0, 14, 28, 8173 }, // ì
-    { 9, 17, 7, 0, 17, 39, 8201 }, // í
-    { 10, 15, 7, -1, 15, 38, 8240 }, // î
-    { 10, 14, 7, 0, 14, 35, 8278 }, // ï
-    { 16, 16, 12, 0, 15, 64, 8313 }, // ð
-    { 13, 15, 14, 1, 15, 49, 8377 }, // ñ
-    { 12, 14, 14, 1, 14, 42, 8426 }, // ò
-    { 12, 17, 14, 1, 17, 51, 8468 }, // ó
-    { 12, 15, 14, 1, 15, 45, 8519 }, // ô
-    { 12, 14, 14, 1, 14, 42, 8564 }, // õ
-    { 13, 15, 14, 1, 15, 49, 8606 }, // ö
-    { 13, 12, 15, 3, 12, 39, 8655 }, // ÷
-    { 19, 28, 14, -2, 19, 133, 8694 }, // ø
-    { 11, 14, 14, 2, 14, 39, 8827 }, // ù
-    { 11, 17, 14, 2, 17, 47, 8866 }, // ú
-    { 11, 15, 14, 2, 15, 42, 8913 }, // û
-    { 12, 15, 14, 2, 15, 45, 8955 }, // ü
-    { 15, 24, 15, 0, 19, 90, 9000 }, // ý
-    { 11, 18, 9, 0, 14, 50, 9090 }, // þ
-    { 16, 22, 15, 0, 17, 88, 9140 }, // ÿ
-    { 17, 20, 19, 1, 20, 85, 9228 }, // Ā
-    { 13, 15, 14, 1, 15, 49, 9313 }, // ā
-    { 17, 20, 19, 1, 20, 85, 9362 }, // Ă
-    { 14, 15, 14, 1, 15, 53, 9447 }, // ă
-    { 14, 19, 19, 1, 14, 67, 9500 }, // Ą
-    { 11, 15, 14, 1, 10, 42, 9567 }, // ą
-    { 15, 20, 16, 1, 20, 75, 9609 }, // Ć
-    { 11, 14, 13, 1, 14, 39, 9684 }, // ć
-    { 16, 21, 16, 1, 21, 84, 9723 }, // Ĉ
-    { 13, 15, 13, 1, 15, 49, 9807 }, // ĉ
-    { 15, 20, 16, 1, 20, 75, 9856 }, // Ċ
-    { 11, 14, 13, 1, 14, 39, 9931 }, // ċ
-    { 17, 21, 16, 1, 21, 90, 9970 }, // Č
-    { 14, 15, 13, 1, 15, 53, 10060 }, // č
-    { 16, 21, 17, 1, 21, 84, 10113 }, // Ď
-    { 17, 14, 15, 1, 14, 60, 10197 }, // ď
-    { 17, 14, 17, 0, 14, 60, 10257 }, // Đ
-    { 16, 14, 15, 1, 14, 56, 10317 }, // đ
-    { 15, 20, 15, 1, 20, 75, 10373 }, // Ē
-    { 14, 17, 14, 1, 17, 60, 10448 }, // ē
-    { 15, 20, 15, 1, 20, 75, 10508 }, // Ĕ
-    { 14, 17, 14, 1, 17, 60, 10583 }, // ĕ
-    { 14, 20, 15, 1, 20, 70, 10643 }, // Ė
-    { 12, 17, 14, 1, 17, 51, 10713 }, // ė
-    { 14, 19, 15, 1, 14, 67, 10764 }, // Ę
-    { 12, 16, 14, 1, 9, 48, 10831 }, // ę
-    { 16, 22, 15, 1, 22, 88, 10879 }, // Ě
-    { 15, 18, 14, 1, 18, 68, 10967 }, // ě
-    { 18, 23, 19, 1, 23, 104, 11035 }, // Ĝ
-    { 15, 21, 14, 0, 16, 79, 11139 }, // ĝ
-    { 18, 22, 19, 1, 22, 99, 11218 }, // Ğ
-    { 16, 20, 14, 0, 15, 80, 11317 }, // ğ
-    { 16, 22, 19, 1, 22, 88, 11397 }, // Ġ
-    { 14, 20, 14, 0, 15, 70, 11485 }, // ġ
-    { 17, 25, 19, 1, 25, 107, 11555 }, // Ģ
-    { 14, 21, 14, 0, 16, 74, 11662 }, // ģ
-    { 16, 21, 17, 1, 21, 84, 11736 }, // Ĥ
-    { 12, 20, 15, 1, 20, 60, 11820 }, // ĥ
-    { 16, 14, 17, 1, 14, 56, 11880 }, // Ħ
-    { 12, 14, 15, 1, 14, 42, 11936 }, // ħ
-    { 11, 21, 9, 1, 21, 58, 11978 }, // Ĩ
-    { 10, 15, 7, 0, 15, 38, 12036 }, // ĩ
-    { 12, 21, 9, 1, 21, 63, 12074 }, // Ī
-    { 10, 15, 7, 0, 15, 38, 12137 }, // ī
-    { 10, 19, 9, -1, 14, 48, 12175 }, // Į
-    { 11, 20, 7, -2, 15, 55, 12223 }, // į
-    { 10, 21, 9, 1, 21, 53, 12278 }, // İ
-    { 6, 9, 7, 0, 9, 14, 12331 }, // ı
-    { 18, 21, 26, 4, 14, 95, 12345 }, // Ĳ
-    { 17, 19, 7, 0, 15, 81, 12440 }, // ĳ
-    { 17, 25, 15, 0, 21, 107, 12521 }, // Ĵ
-    { 14, 22, 10, 1, 17, 77, 12628 }, // ĵ
-    { 15, 23, 17, 1, 23, 87, 12705 }, // Ķ
-    { 13, 23, 15, -1, 14, 75, 12792 }, // ķ
-    { 10, 9, 11, -2, 9, 23, 12867 }, // ĸ
-    { 11, 19, 15, 1, 19, 53, 12890 }, // Ĺ
-    { 10, 21, 10, 1, 21, 53, 12943 }, // ĺ
-    { 12, 23, 15, 0, 14, 69, 12996 }, // Ļ
-    { 11, 23, 10, -2, 14, 64, 13065 }, // ļ
-    { 12, 14, 15, 1, 14, 42, 13129 }, // Ľ
-    { 13, 17, 10, 1, 17, 56, 13171 }, // ľ
-    { 13, 14, 15, 1, 14, 46, 13227 }, // Ŀ
-    { 10, 14, 10, 1, 14, 35, 13273 }, // ŀ
-    { 26, 24, 15, -8, 19, 156, 13308 }, // Ł
-    { 18, 14, 10, -6, 14, 63, 13464 }, // ł
-    { 16, 20, 17, 1, 20, 80, 13527 }, // Ń
-    { 12, 16, 14, 1, 16, 48, 13607 }, // ń
-    { 16, 21, 17, 1, 14, 84, 13655 }, // Ņ
-    { 12, 17, 14, 1, 10, 51, 13739 }, // ņ
-    { 17, 21, 17, 1, 21, 90, 13790 }, // Ň
-    { 15, 17, 14, 1, 17, 64, 13880 }, // ň
-    { 23, 17, 14, -10, 17, 98, 13944 }, // ŉ
-    { 16, 18, 17, 1, 14, 72, 14042 }, // Ŋ
-    { 12, 14, 14, 1, 10, 42, 14114 }, // ŋ
-    { 17, 21, 19, 1, 20, 90, 14156 }, // Ō
-    { 13, 15, 14, 1, 15, 49, 14246 }, // ō
-    { 17, 21, 19, 1, 20, 90, 14295 }, // Ŏ
-    { 14, 15, 14, 1, 15, 53, 14385 }, // ŏ
-    { 19, 20, 19, 1, 19, 95, 14438 }, // Ő
-    { 16, 14, 14, 1, 14, 56, 14533 }, // ő
-    { 24, 15, 20, 1, 14, 90, 14589 }, // Œ
-    { 19, 9, 18, 1, 9, 43, 14679 }, // œ
-    { 13, 20, 16, 1, 19, 65, 14722 }, // Ŕ
-    { 10, 13, 12, 1, 13, 33, 14787 }, // ŕ
-    { 13, 24, 16, 1, 23, 78, 14820 }, // Ŗ
-    { 10, 17, 12, 1, 17, 43, 14898 }, // ŗ
-    { 15, 22, 16, 1, 21, 83, 14941 }, // Ř
-    { 12, 15, 12, 1, 15, 45, 15024 }, // ř
-    { 15, 20, 17, 1, 20, 75, 15069 }, // Ś
-    { 11, 15, 14, 1, 14, 42, 15144 }, // ś
-    { 16, 21, 17, 1, 21, 84, 15186 }, // Ŝ
-    { 13, 16, 14, 1, 15, 52, 15270 }, // ŝ
-    { 15, 19, 17, 1, 15, 72, 15322 }, // Ş
-    { 11, 14, 14, 1, 10, 39, 15394 }, // ş
-    { 17, 21, 17, 1, 21, 90, 15433 }, // Š
-    { 14, 16, 14, 1, 15, 56, 15523 }, // š
-    { 14, 19, 17, 4, 14, 67, 15579 }, // Ţ
-    { 10, 17, 13, 2, 13, 43, 15646 }, // ţ
-    { 14, 21, 17, 4, 21, 74, 15689 }, // Ť
-    { 13, 15, 13, 3, 15, 49, 15763 }, // ť
-    { 14, 14, 17, 4, 14, 49, 15812 }, // Ŧ
-    { 11, 13, 13, 1, 13, 36, 15861 }, // ŧ
-    { 16, 22, 17, 1, 21, 88, 15897 }, // Ũ
-    { 11, 15, 14, 2, 15, 42, 15985 }, // ũ
-    { 16, 22, 17, 1, 21, 88, 16027 }, // Ū
-    { 12, 15, 14, 2, 15, 45, 16115 }, // ū
-    { 16, 22, 17, 1, 21, 88, 16160 }, // Ŭ
-    { 13, 15, 14, 2, 15, 49, 16248 }, // ŭ
-    { 16, 23, 17, 1, 22, 92, 16297 }, // Ů
-    { 11, 16, 14, 2, 16, 44, 16389 }, // ů
-    { 19, 21, 17, 1, 20, 100, 16433 }, // Ű
-    { 15, 14, 14, 2, 14, 53, 16533 }, // ű
-    { 16, 19, 17, 1, 14, 76, 16586 }, // Ų
-    { 11, 14, 14, 2, 9, 39, 16662 }, // ų
-    { 20, 21, 23, 4, 21, 105, 16701 }, // Ŵ
-    { 15, 18, 18, 3, 16, 68, 16806 }, // ŵ
-    { 13, 22, 18, 5, 22, 72, 16874 }, // Ŷ
-    { 15, 22, 15, 0, 17, 83, 16946 }, // ŷ
-    { 13, 22, 18, 5, 22, 72, 17029 }, // Ÿ
-    { 17, 19, 18, 1, 19, 81, 17101 }, // Ź
-    { 13, 15, 15, 1, 15, 49, 17182 }, // ź
-    { 17, 19, 18, 1, 19, 81, 17231 }, // Ż
-    { 13, 15, 15, 1, 15, 49, 17312 }, // ż
-    { 17, 21, 18, 1, 21, 90, 17361 }, // Ž
-    { 15, 17, 15, 1, 17, 64, 17451 }, // ž
-    { 11, 15, 10, 1, 14, 42, 17515 }, // ſ
-    { 7, 4, 0, 3, 13, 7, 17557 }, // ̀
-    { 5, 4, 0, 3, 13, 5, 17564 }, // ́
-    { 10, 5, 0, -1, 1, 13, 17569 }, // ̂
-    { 8, 4, 0, 3, 12, 8, 17582 }, // ̃
-    { 10, 3, 0, 3, 12, 8, 17590 }, // ̄
-    { 12, 3, 0, 4, 15, 9, 17598 }, // ̅
-    { 9, 4, 0, 3, 12, 9, 17607 }, // ̆
-    { 5, 4, 0, 3, 14, 5, 17616 }, // ̇
-    { 9, 4, 0, 2, 13, 9, 17621 }, // ̈
-    { 4, 5, 0, 6, 11, 5, 17630 }, // ̉
-    { 5, 4, 0, 3, 13, 5, 17635 }, // ̊
-    { 14, 4, 0, 3, 13, 14, 17640 }, // ̋
-    { 10, 5, 0, 3, 13, 13, 17654 }, // ̌
-    { 14, 4, 0, -6, 13, 14, 17667 }, // ̏
-    { 7, 6, 0, 2, 13, 11, 17681 }, // ̒
-    { 7, 6, 0, 2, 13, 11, 17692 }, // ̓
-    { 8, 6, 0, -4, 13, 12, 17703 }, // ̔
-    { 5, 5, 0, 0, 0, 7, 17715 }, // ̘
-    { 6, 5, 0, 0, 0, 8, 17722 }, // ̙
-    { 8, 5, 0, 4, 14, 10, 17730 }, // ̚
-    { 5, 5, 0, 2, 11, 7, 17740 }, // ̛
-    { 4, 6, 0, -1, 0, 6, 17747 }, // ̜
-    { 5, 6, 0, 1, 4, 8, 17753 }, // ̝
-    { 5, 5, 0, -1, 0, 7, 17761 }, // ̞
-    { 4, 5, 0, 0, -1, 5, 17768 }, // ̟
-    { 10, 3, 0, -1, -2, 8, 17773 }, // ̠
-    { 5, 4, 0, -2, 2, 5, 17781 }, // ̣
-    { 9, 4, 0, -2, -1, 9, 17786 }, // ̤
-    { 5, 4, 0, 3, 13, 5, 17795 }, // ̥
-    { 8, 6, 0, -1, 3, 12, 17800 }, // ̦
-    { 6, 6, 0, -1, 1, 9, 17812 }, // ̧
-    { 5, 7, 0, 0, 2, 9, 17821 }, // ̨
-    { 5, 6, 0, -1, 0, 8, 17830 }, // ̩
-    { 8, 4, 0, -1, 0, 8, 17838 }, // ̪
-    { 11, 5, 0, -1, 1, 14, 17846 }, // ̬
-    { 11, 5, 0, -1, 1, 14, 17860 }, // ̭
-    { 8, 4, 0, 4, 14, 8, 17874 }, // ̰
-    { 9, 3, 0, 4, 14, 7, 17882 }, // ̱
-    { 9, 3, 0, -1, -1, 7, 17889 }, // ̲
-    { 9, 4, 0, 4, 14, 9, 17896 }, // ̴
-    { 10, 2, 0, 1, 6, 5, 17905 }, // ̵
-    { 4, 6, 0, 1, 0, 6, 17910 }, // ̹
-    { 10, 6, 0, -3, 1, 15, 17916 }, // ̺
-    { 8, 6, 0, -1, 1, 12, 17931 }, // ̻
-    { 8, 5, 0, -1, 1, 10, 17943 }, // ̼
-    { 6, 4, 0, 3, 13, 6, 17953 }, // ̽
-    { 8, 4, 0, 3, 12, 8, 17959 }, // ͂
-    { 4, 5, 0, 7, 15, 5, 17967 }, // ̓
-    { 10, 12, 0, 3, 21, 30, 17972 }, // ̈́
-    { 8, 4, 0, 3, 14, 8, 18002 }, // ͆
-    { 11, 7, 0, -2, 0, 20, 18010 }, // ͇
-    { 9, 5, 0, -1, 0, 12, 18030 }, // ͈
-    { 7, 6, 0, -1, 0, 11, 18042 }, // ͉
-    { 13, 14, 0, 2, 18, 46, 18053 }, // ͊
-    { 18, 13, 0, 5, 19, 59, 18099 }, // ͋
-    { 12, 9, 0, 9, 9, 27, 18158 }, // ͌
-    { 9, 19, 0, 1, 6, 43, 18185 }, // ͍
-    { 4, 3, 0, 8, 2, 3, 18228 }, // ͎
-    { 15, 5, 0, 0, 1, 19, 18231 }, // ͜
-    { 15, 5, 0, 3, 14, 19, 18250 }, // ͡
-    { 19, 6, 0, -1, 0, 29, 18269 }, // ͢
-    { 14, 20, 14, 1, 20, 70, 18298 }, // Ѐ
-    { 15, 20, 15, 1, 20, 75, 18368 }, // Ё
-    { 15, 16, 11, 2, 15, 60, 18443 }, // Ђ
-    { 14, 20, 11, 0, 19, 70, 18503 }, // Ѓ
-    { 15, 15, 14, 1, 13, 57, 18573 }, // Є
-    { 15, 15, 17, 1, 15, 57, 18630 }, // Ѕ
-    { 8, 14, 9, 1, 14, 28, 18687 }, // І
-    { 11, 20, 9, 1, 20, 55, 18715 }, // Ї
-    { 15, 18, 15, 0, 14, 68, 18770 }, // Ј
-    { 18, 15, 19, 1, 13, 68, 18838 }, // Љ
-    { 17, 14, 10, -3, 13, 60, 18906 }, // Њ
-    { 14, 16, 17, 4, 16, 56, 18966 }, // Ћ
-    { 15, 19, 17, 1, 19, 72, 19022 }, // Ќ
-    { 15, 18, 16, 1, 18, 68, 19094 }, // Ѝ
-    { 14, 22, 13, 0, 20, 77, 19162 }, // Ў
-    { 14, 17, 13, 1, 13, 60, 19239 }, // Џ
-    { 14, 14, 19, 1, 14, 49, 19299 }, // А
-    { 12, 13, 11, 1, 13, 39, 19348 }, // Б
-    { 12, 14, 11, 1, 13, 42, 19387 }, // В
-    { 14, 14, 11, 0, 13, 49, 19429 }, // Г
-    { 14, 15, 14, 1, 13, 53, 19478 }, // Д
-    { 14, 15, 14, 1, 15, 53, 19531 }, // Е
-    { 24, 14, 25, 0, 14, 84, 19584 }, // Ж
-    { 11, 14, 11, 1, 13, 39, 19668 }, // З
-    { 15, 14, 16, 1, 14, 53, 19707 }, // И
-    { 15, 19, 16, 1, 19, 72, 19760 }, // Й
-    { 15, 14, 17, 1, 14, 53, 19832 }, // К
-    { 15, 15, 10, -1, 13, 57, 19885 }, // Л
-    { 17, 14, 14, 0, 13, 60, 19942 }, // М
-    { 16, 14, 17, 1, 14, 56, 20002 }, // Н
-    { 17, 15, 19, 1, 14, 64, 20058 }, // О
-    { 14, 14, 11, 0, 13, 49, 20122 }, // П
-    { 14, 15, 15, 1, 15, 53, 20171 }, // Р
-    { 15, 15, 16, 1, 15, 57, 20224 }, // С
-    { 14, 14, 17, 4, 14, 49, 20281 }, // Т
-    { 14, 15, 13, 0, 13, 53, 20330 }, // У
-    { 13, 13, 15, 3, 13, 43, 20383 }, // Ф
-    { 17, 14, 18, 1, 14, 60, 20426 }, // Х
-    { 14, 17, 12, 0, 13, 60, 20486 }, // Ц
-    { 11, 13, 11, 2, 13, 36, 20546 }, // Ч
-    { 16, 14, 14, 0, 13, 56, 20582 }, // Ш
-    { 16, 16, 15, 0, 13, 64, 20638 }, // Щ
-    { 12, 13, 10, -1, 12, 39, 20702 }, // Ъ
-    { 19, 15, 19, 0, 14, 72, 20741 }, // Ы
-    { 11, 13, 10, 0, 12, 36, 20813 }, // Ь
-    { 15, 15, 16, 1, 13, 57, 20849 }, // Э
-    { 16, 14, 15, 1, 13, 56, 20906 }, // Ю
-    { 15, 15, 15, 0, 14, 57, 20962 }, // Я
-    { 11, 10, 14, 1, 10, 28, 21019 }, // а
-    { 14, 16, 12, 1, 15, 56, 21047 }, // б
-    { 11, 9, 12, -1, 9, 25, 21103 }, // в
-    { 12, 11, 10, 0, 9, 33, 21128 }, // г
-    { 12, 12, 13, 1, 9, 36, 21161 }, // д
-    { 12, 9, 14, 1, 9, 27, 21197 }, // е
-    { 24, 12, 25, 0, 12, 72, 21224 }, // ж
-    { 9, 9, 8, -2, 9, 21, 21296 }, // з
-    { 13, 11, 11, 0, 9, 36, 21317 }, // и
-    { 12, 14, 11, 0, 14, 42, 21353 }, // й
-    { 12, 9, 13, -1, 9, 27, 21395 }, // к
-    { 10, 10, 7, -2, 9, 25, 21422 }, // л
-    { 13, 11, 14, -1, 11, 36, 21447 }, // м
-    { 14, 11, 14, -1, 11, 39, 21483 }, // н
-    { 12, 9, 14, 1, 9, 27, 21522 }, // о
-    { 13, 11, 11, 0, 9, 36, 21549 }, // п
-    { 15, 15, 16, -1, 10, 57, 21585 }, // р
-    { 10, 10, 13, 1, 10, 25, 21642 }, // с
-    { 12, 11, 11, 2, 9, 33, 21667 }, // т
-    { 15, 14, 15, 0, 9, 53, 21700 }, // у
-    { 15, 13, 15, 1, 9, 49, 21753 }, // ф
-    { 14, 11, 12, 0, 9, 39, 21802 }, // х
-    { 12, 12, 12, 1, 9, 36, 21841 }, // ц
-    { 8, 9, 8, 0, 9, 18, 21877 }, // ч
-    { 16, 10, 14, 0, 9, 40, 21895 }, // ш
-    { 16, 13, 15, 0, 9, 52, 21935 }, // щ
-    { 9, 11, 8, -2, 10, 25, 21987 }, // ъ
-    { 14, 12, 15, -1, 11, 42, 22012 }, // ы
-    { 8, 11, 8, -1, 10, 22, 22054 }, // ь
-    { 10, 11, 11, 1, 10, 28, 22076 }, // э
-    { 13, 11, 12, 0, 10, 36, 22104 }, // ю
-    { 10, 11, 14, 1, 11, 28, 22140 }, // я
-    { 12, 17, 14, 1, 17, 51, 22168 }, // ѐ
-    { 13, 16, 14, 1, 16, 52, 22219 }, // ё
-    { 12, 18, 15, 1, 14, 54, 22271 }, // ђ
-    { 12, 15, 10, 0, 13, 45, 22325 }, // ѓ
-    { 10, 10, 10, -1, 9, 25, 22370 }, // є
-    { 11, 11, 14, 1, 10, 31, 22395 }, // ѕ
-    { 9, 15, 7, 0, 15, 34, 22426 }, // і
-    { 10, 14, 7, 0, 14, 35, 22460 }, // ї
-    { 11, 20, 10, 1, 15, 55, 22495 }, // ј
-    { 13, 10, 13, -1, 9, 33, 22550 }, // љ
-    { 12, 10, 7, -4, 9, 30, 22583 }, // њ
-    { 12, 14, 15, 1, 14, 42, 22613 }, // ћ
-    { 13, 14, 13, -1, 14, 46, 22655 }, // ќ
-    { 13, 17, 11, 0, 15, 56, 22701 }, // ѝ
-    { 16, 22, 15, 0, 17, 88, 22757 }, // ў
-    { 11, 13, 10, -1, 10, 36, 22845 }, // џ
-    { 10, 14, 12, 3, 13, 35, 22881 }, // Ѣ
-    { 11, 14, 11, 2, 13, 39, 22916 }, // ѣ
-    { 18, 14, 14, -1, 13, 63, 22955 }, // Ѫ
-    { 13, 11, 10, -2, 10, 36, 23018 }, // ѫ
-    { 19, 18, 19, 1, 18, 86, 23054 }, // Ѳ
-    { 15, 13, 14, 1, 13, 49, 23140 }, // ѳ
-    { 17, 17, 18, 5, 17, 73, 23189 }, // Ѵ
-    { 12, 11, 14, 3, 11, 33, 23262 }, // ѵ
-    { 8, 6, 0, 5, 16, 12, 23295 }, // ҆
-    { 14, 15, 11, 0, 14, 53, 23307 }, // Ґ
-    { 13, 14, 10, 0, 12, 46, 23360 }, // ґ
-    { 14, 14, 11, 0, 13, 49, 23406 }, // Ғ
-    { 10, 9, 8, -2, 9, 23, 23455 }, // ғ
-    { 13, 16, 10, 0, 15, 52, 23478 }, // Ҕ
-    { 9, 10, 6, -2, 9, 23, 23530 }, // ҕ
-    { 24, 17, 25, 0, 14, 102, 23553 }, // Җ
-    { 17, 11, 17, -2, 9, 47, 23655 }, // җ
-    { 11, 16, 11, 1, 13, 44, 23702 }, // Ҙ
-    { 9, 13, 8, -2, 9, 30, 23746 }, // ҙ
-    { 15, 17, 12, 0, 14, 64, 23776 }, // Қ
-    { 11, 11, 8, -2, 9, 31, 23840 }, // қ
-    { 18, 14, 18, 1, 13, 63, 23871 }, // Ҝ
-    { 13, 9, 12, 0, 9, 30, 23934 }, // ҝ
-    { 15, 14, 17, 1, 14, 53, 23964 }, // Ҟ
-    { 11, 14, 15, 1, 14, 39, 24017 }, // ҟ
-    { 15, 14, 17, 1, 14, 53, 24056 }, // Ҡ
-    { 10, 9, 12, -1, 9, 23, 24109 }, // ҡ
-    { 17, 17, 13, -2, 14, 73, 24132 }, // Ң
-    { 12, 11, 9, -3, 9, 33, 24205 }, // ң
-    { 22, 14, 17, 1, 14, 77, 24238 }, // Ҥ
-    { 16, 9, 12, -1, 9, 36, 24315 }, // ҥ
-    { 20, 16, 21, 1, 15, 80, 24351 }, // Ҧ
-    { 16, 17, 21, 3, 12, 68, 24431 }, // ҧ
-    { 18, 14, 11, -2, 13, 63, 24499 }, // Ҩ
-    { 14, 11, 17, 1, 10, 39, 24562 }, // ҩ
-    { 15, 17, 16, 1, 15, 64, 24601 }, // Ҫ
-    { 10, 12, 13, 1, 10, 30, 24665 }, // ҫ
-    { 14, 16, 13, 2, 14, 56, 24695 }, // Ҭ
-    { 10, 11, 9, -1, 9, 28, 24751 }, // ҭ
-    { 13, 14, 18, 5, 14, 46, 24779 }, // Ү
-    { 11, 13, 13, 3, 9, 36, 24825 }, // ү
-    { 15, 14, 18, 3, 14, 53, 24861 }, // Ұ
-    { 14, 14, 13, 0, 10, 49, 24914 }, // ұ
-    { 17, 17, 13, 1, 14, 73, 24963 }, // Ҳ
-    { 13, 11, 13, 0, 9, 36, 25036 }, // ҳ
-    { 14, 16, 10, 0, 13, 56, 25072 }, // Ҵ
-    { 11, 12, 15, 2, 9, 33, 25128 }, // ҵ
-    { 11, 17, 11, 2, 13, 47, 25161 }, // Ҷ
-    { 8, 12, 8, 0, 9, 24, 25208 }, // ҷ
-    { 11, 13, 11, 2, 13, 36, 25232 }, // Ҹ
-    { 8, 9, 8, 0, 9, 18, 25268 }, // ҹ
-    { 12, 15, 11, 0, 14, 45, 25286 }, // Һ
-    { 12, 14, 15, 1, 14, 42, 25331 }, // һ
-    { 19, 13, 24, 3, 12, 62, 25373 }, // Ҽ
-    { 14, 9, 12, 1, 9, 32, 25435 }, // ҽ
-    { 19, 15, 15, 4, 12, 72, 25467 }, // Ҿ
-    { 15, 12, 11, 1, 10, 45, 25539 }, // ҿ
-    { 8, 14, 9, 1, 14, 28, 25584 }, // Ӏ
-    { 24, 23, 25, 0, 23, 138, 25612 }, // Ӂ
-    { 24, 19, 25, 0, 19, 114, 25750 }, // ӂ
-    { 14, 18, 12, 0, 13, 63, 25864 }, // Ӄ
-    { 10, 13, 8, -2, 9, 33, 25927 }, // ӄ
-    { 15, 17, 10, -1, 13, 64, 25960 }, // Ӆ
-    { 10, 12, 7, -1, 9, 30, 26024 }, // ӆ
-    { 16, 19, 17, 1, 14, 76, 26054 }, // Ӈ
-    { 11, 13, 12, -1, 9, 36, 26130 }, // ӈ
-    { 16, 20, 17, 1, 14, 80, 26166 }, // Ӊ
-    { 12, 13, 12, 0, 9, 39, 26246 }, // ӊ
-    { 12, 17, 11, 2, 13, 51, 26285 }, // Ӌ
-    { 8, 12, 10, 1, 9, 24, 26336 }, // ӌ
-    { 18, 20, 19, 1, 14, 90, 26360 }, // Ӎ
-    { 13, 13, 13, 0, 9, 43, 26450 }, // ӎ
-    { 7, 13, 10, 3, 12, 23, 26493 }, // ӏ
-    { 17, 20, 19, 1, 20, 85, 26516 }, // Ӑ
-    { 14, 15, 14, 1, 15, 53, 26601 }, // ӑ
-    { 16, 19, 19, 1, 19, 76, 26654 }, // Ӓ
-    { 14, 15, 14, 1, 15, 53, 26730 }, // ӓ
-    { 23, 15, 23, 1, 14, 87, 26783 }, // Ӕ
-    { 18, 10, 21, 1, 10, 45, 26870 }, // ӕ
-    { 16, 20, 14, 1, 20, 80, 26915 }, // Ӗ
-    { 14, 17, 14, 1, 17, 60, 26995 }, // ӗ
-    { 15, 14, 18, 5, 13, 53, 27055 }, // Ә
-    { 11, 11, 14, 5, 10, 31, 27108 }, // ә
-    { 15, 20, 18, 5, 19, 75, 27139 }, // Ӛ
-    { 12, 14, 14, 4, 10, 42, 27214 }, // ӛ
-    { 24, 22, 23, 2, 22, 132, 27256 }, // Ӝ
-    { 24, 19, 25, 0, 19, 114, 27388 }, // ӝ
-    { 13, 22, 11, 1, 21, 72, 27502 }, // Ӟ
-    { 12, 13, 8, -2, 13, 39, 27574 }, // ӟ
-    { 11, 14, 11, 2, 13, 39, 27613 }, // Ӡ
-    { 11, 14, 11, 1, 10, 39, 27652 }, // ӡ
-    { 15, 19, 15, 1, 19, 72, 27691 }, // Ӣ
-    { 14, 17, 11, 0, 15, 60, 27763 }, // ӣ
-    { 15, 18, 16, 1, 18, 68, 27823 }, // Ӥ
-    { 13, 16, 11, 0, 14, 52, 27891 }, // ӥ
-    { 17, 20, 19, 1, 19, 85, 27943 }, // Ӧ
-    { 12, 16, 14, 1, 16, 48, 28028 }, // ӧ
-    { 15, 14, 18, 2, 14, 53, 28076 }, // Ө
-    { 12, 9, 14, 1, 9, 27, 28129 }, // ө
-    { 15, 19, 18, 2, 19, 72, 28156 }, // Ӫ
-    { 12, 14, 14, 1, 14, 42, 28228 }, // ӫ
-    { 25, 22, 16, 1, 20, 138, 28270 }, // Ӭ
-    { 11, 15, 11, 1, 14, 42, 28408 }, // ӭ
-    { 14, 22, 13, 0, 20, 77, 28450 }, // Ӯ
-    { 16, 22, 15, 0, 17, 88, 28527 }, // ӯ
-    { 14, 21, 13, 0, 19, 74, 28615 }, // Ӱ
-    { 15, 22, 15, 0, 17, 83, 28689 }, // ӱ
-    { 16, 21, 13, 0, 19, 84, 28772 }, // Ӳ
-    { 18, 21, 15, 0, 16, 95, 28856 }, // ӳ
-    { 11, 17, 11, 2, 17, 47, 28951 }, // Ӵ
-    { 9, 13, 8, 0, 13, 30, 28998 }, // ӵ
-    { 14, 16, 11, 0, 13, 56, 29028 }, // Ӷ
-    { 10, 11, 8, -2, 9, 28, 29084 }, // ӷ
-    { 19, 22, 19, 0, 21, 105, 29112 }, // Ӹ
-    { 15, 19, 15, -1, 18, 72, 29217 }, // ӹ
-    { 17, 16, 18, 1, 14, 68, 29289 }, // Ӽ
-    { 12, 11, 13, -1, 9, 33, 29357 }, // ӽ
-    { 0, 0, 11, 0, 0, 0, 29390 }, //  
-    { 0, 0, 19, 0, 0, 0, 29390 }, //  
-    { 0, 0, 11, 0, 0, 0, 29390 }, //  
-    { 0, 0, 19, 0, 0, 0, 29390 }, //  
-    { 0, 0, 8, 0, 0, 0, 29390 }, //  
-    { 0, 0, 7, 0, 0, 0, 29390 }, //  
-    { 0, 0, 5, 0, 0, 0, 29390 }, //  
-    { 0, 0, 12, 0, 0, 0, 29390 }, //  
-    { 0, 0, 4, 0, 0, 0, 29390 }, //  
-    { 0, 0, 6, 0, 0, 0, 29390 }, //  
-    { 0, 0, 5, 0, 0, 0, 29390 }, //  
-    { 0, 0, 3, 0, 0, 0, 29390 }, // ​
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 29390 }, // ‏
-    { 10, 2, 9, 1, 6, 5, 29390 }, // ‐
-    { 10, 2, 9, 1, 6, 5, 29395 }, // ‑
-    { 15, 2, 9, -1, 6, 8, 29400 }, // ‒
-    { 14, 4, 13, 1, 7, 14, 29408 }, // –
-    { 19, 4, 19, 1, 7, 19, 29422 }, // —
-    { 19, 4, 19, 1, 7, 19, 29441 }, // ―
-    { 12, 16, 9, 1, 13, 48, 29460 }, // ‖
-    { 16, 6, 9, -4, -1, 24, 29508 }, // ‗
-    { 8, 6, 7, 3, 15, 12, 29532 }, // ‘
-    { 8, 6, 7, 3, 15, 12, 29544 }, // ’
-    { 7, 6, 5, -1, 3, 11, 29556 }, // ‚
-    { 8, 6, 7, 3, 15, 12, 29567 }, // ‛
-    { 13, 6, 13, 3, 15, 20, 29579 }, // “
-    { 13, 6, 13, 3, 15, 20, 29599 }, // ”
-    { 7, 6, 5, -1, 3, 11, 29619 }, // „
-    { 13, 6, 13, 3, 15, 20, 29630 }, // ‟
-    { 10, 24, 13, 4, 18, 60, 29650 }, // †
-    { 12, 23, 14, 3, 17, 69, 29710 }, // ‡
-    { 15, 13, 8, -2, 15, 49, 29779 }, // •
-    { 6, 7, 10, 3, 8, 11, 29828 }, // ‣
-    { 5, 4, 10, 3, 4, 5, 29839 }, // ․
-    { 5, 4, 10, 3, 4, 5, 29844 }, // ‥
-    { 16, 4, 16, 0, 4, 16, 29849 }, // …
-    { 3, 2, 9, 3, 6, 2, 29865 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 29867 }, //  
-    { 16, 15, 19, 2, 13, 60, 29867 }, // ‰
-    { 8, 6, 9, 5, 15, 12, 29927 }, // ′
-    { 13, 6, 13, 5, 15, 20, 29939 }, // ″
-    { 13, 6, 7, -2, 14, 20, 29959 }, // ‴
-    { 5, 6, 7, 4, 14, 8, 29979 }, // ‵
-    { 8, 6, 7, 3, 14, 12, 29987 }, // ‶
-    { 13, 6, 7, 0, 14, 20, 29999 }, // ‷
-    { 10, 4, 11, 3, 14, 10, 30019 }, // ‸
-    { 7, 10, 7, 2, 10, 18, 30029 }, // ‹
-    { 7, 10, 7, -2, 10, 18, 30047 }, // ›
-    { 22, 22, 23, 1, 17, 121, 30065 }, // ※
-    { 10, 22, 10, 1, 19, 55, 30186 }, // ‼
-    { 13, 27, 14, 3, 23, 88, 30241 }, // ‽
-    { 10, 2, 9, 3, 14, 5, 30329 }, // ‾
-    { 9, 4, 13, 3, 11, 9, 30334 }, // ‿
-    { 13, 12, 11, 1, 15, 39, 30343 }, // ⁂
-    { 16, 15, 22, 3, 13, 60, 30382 }, // ⁄
-    { 23, 21, 25, 4, 19, 121, 30442 }, // ⁇
-    { 20, 22, 20, 3, 19, 110, 30563 }, // ⁈
-    { 18, 22, 13, -1, 19, 99, 30673 }, // ⁉
-    { 19, 29, 15, -1, 20, 138, 30772 }, // ⁒
-    { 0, 0, 78, 0, 0, 0, 30910 }, //  
-    { 6, 7, 6, 6, 14, 11, 30910 }, // ⁰
-    { 6, 6, 6, 6, 14, 9, 30921 }, // ⁴
-    { 6, 8, 6, 6, 14, 12, 30930 }, // ⁵
-    { 6, 7, 6, 6, 14, 11, 30942 }, // ⁶
-    { 6, 8, 6, 7, 15, 12, 30953 }, // ⁷
-    { 6, 7, 6, 6, 14, 11, 30965 }, // ⁸
-    { 6, 8, 6, 6, 14, 12, 30976 }, // ⁹
-    { 12, 10, 14, 1, 10, 30, 30988 }, // ⁿ
-    { 6, 7, 6, -5, 4, 11, 31018 }, // ₀
-    { 6, 7, 6, -6, 4, 11, 31029 }, // ₁
-    { 7, 7, 6, -6, 4, 13, 31040 }, // ₂
-    { 7, 7, 6, -6, 4, 13, 31053 }, // ₃
-    { 6, 7, 6, -5, 4, 11, 31066 }, // ₄
-    { 6, 8, 6, -5, 5, 12, 31077 }, // ₅
-    { 7, 7, 6, -6, 4, 13, 31089 }, // ₆
-    { 6, 8, 6, -4, 5, 12, 31102 }, // ₇
-    { 6, 7, 6, -5, 4, 11, 31114 }, // ₈
-    { 6, 8, 6, -5, 4, 12, 31125 }, // ₉
-    { 12, 23, 8, 1, 17, 69, 31137 }, // ₍
-    { 11, 23, 7, -5, 17, 64, 31206 }, // ₎
-    { 16, 22, 16, 2, 18, 88, 31270 }, // ₡
-    { 15, 15, 16, 1, 15, 57, 31358 }, // ₢
-    { 13, 14, 12, 0, 13, 46, 31415 }, // ₤
-    { 20, 14, 17, -1, 14, 70, 31461 }, // ₦
-    { 16, 15, 15, 1, 15, 60, 31531 }, // ₧
-    { 21, 15, 22, -1, 14, 79, 31591 }, // ₨
-    { 15, 14, 14, -1, 14, 53, 31670 }, // ₩
-    { 17, 13, 18, 2, 13, 56, 31723 }, // ₪
-    { 15, 14, 9, -1, 13, 53, 31779 }, // ₫
-    { 14, 17, 14, 1, 14, 60, 31832 }, // €
-    { 14, 14, 17, 4, 14, 49, 31892 }, // ₮
-    { 18, 15, 11, 0, 15, 68, 31941 }, // ₱
-    { 16, 22, 19, 1, 19, 88, 32009 }, // ₲
-    { 19, 15, 17, 5, 14, 72, 32097 }, // ₴
-    { 10, 13, 10, 1, 11, 33, 32169 }, // ₵
-    { 16, 16, 17, 4, 16, 64, 32202 }, // ₸
-    { 12, 13, 12, 2, 12, 39, 32266 }, // ₹
-    { 11, 13, 12, 1, 11, 36, 32305 }, // ₺
-    { 14, 15, 14, 2, 14, 53, 32341 }, // ₼
-    { 17, 15, 15, -2, 15, 64, 32394 }, // ₽
-    { 12, 12, 12, -3, 9, 36, 32458 }, // ←
-    { 12, 12, 13, 2, 10, 36, 32494 }, // ↑
-    { 12, 12, 13, 3, 9, 36, 32530 }, // →
-    { 13, 12, 13, 4, 11, 39, 32566 }, // ↓
-    { 19, 10, 17, -1, 8, 48, 32605 }, // ↔
-    { 10, 19, 13, 3, 18, 48, 32653 }, // ↕
-    { 11, 8, 13, -1, 8, 22, 32701 }, // ↖
-    { 11, 8, 11, 2, 8, 22, 32723 }, // ↗
-    { 10, 11, 11, 3, 9, 28, 32745 }, // ↘
-    { 10, 11, 11, -2, 9, 28, 32773 }, // ↙
-    { 14, 11, 16, 0, 10, 39, 32801 }, // ⇐
-    { 15, 14, 18, 3, 13, 53, 32840 }, // ⇑
-    { 14, 11, 16, 2, 10, 39, 32893 }, // ⇒
-    { 15, 14, 18, 6, 13, 53, 32932 }, // ⇓
-    { 18, 11, 18, 0, 10, 50, 32985 }, // ⇔
-    { 12, 17, 15, 4, 9, 51, 33035 }, // ⇕
-    { 13, 16, 11, 1, 15, 52, 33086 }, // ∂
-    { 18, 16, 19, 0, 15, 72, 33138 }, // ∅
-    { 14, 14, 14, 0, 13, 49, 33210 }, // ∆
-    { 13, 14, 12, 2, 13, 46, 33259 }, // ∏
-    { 13, 14, 12, 5, 13, 46, 33305 }, // ∐
-    { 13, 14, 10, 0, 13, 46, 33351 }, // ∑
-    { 10, 3, 10, 1, 6, 8, 33397 }, // −
-    { 17, 15, 16, 2, 14, 64, 33405 }, // √
-    { 16, 10, 15, 1, 11, 40, 33469 }, // ∞
-    { 17, 18, 14, 0, 13, 77, 33509 }, // ∫
-    { 8, 12, 5, 0, 12, 24, 33586 }, // ∶
-    { 12, 9, 24, 9, 9, 27, 33610 }, // ≈
-    { 16, 15, 22, 3, 14, 60, 33637 }, // ≠
-    { 16, 15, 13, -2, 13, 60, 33697 }, // ≤
-    { 16, 14, 14, 0, 12, 56, 33757 }, // ≥
+    { 18, 14, 19, 1, 14, 63, 2048 }, // M
+    { 16, 14, 17, 1, 14, 56, 2111 }, // N
+    { 17, 15, 19, 1, 14, 64, 2167 }, // O
+    { 14, 15, 15, 1, 15, 53, 2231 }, // P
+    { 17, 18, 19, 1, 15, 77, 2284 }, // Q
+    { 13, 15, 16, 1, 14, 49, 2361 }, // R
+    { 15, 15, 17, 1, 15, 57, 2410 }, // S
+    { 14, 14, 17, 4, 14, 49, 2467 }, // T
+    { 16, 15, 17, 1, 14, 60, 2516 }, // U
+    { 14, 14, 18, 5, 14, 49, 2576 }, // V
+    { 20, 15, 23, 4, 15, 75, 2625 }, // W
+    { 17, 14, 18, 1, 14, 60, 2700 }, // X
+    { 13, 14, 18, 5, 14, 46, 2760 }, // Y
+    { 17, 14, 18, 1, 14, 60, 2806 }, // Z
+    { 13, 25, 8, -1, 18, 82, 2866 }, // [
+    { 4, 19, 8, 3, 15, 19, 2948 }, // <backslash>
+    { 13, 25, 8, -4, 18, 82, 2967 }, // ]
+    { 10, 5, 9, 2, 16, 13, 3049 }, // ^
+    { 14, 4, 11, -2, 0, 14, 3062 }, // _
+    { 7, 4, 7, 3, 13, 7, 3076 }, // `
+    { 11, 10, 14, 1, 10, 28, 3083 }, // a
+    { 11, 16, 14, 2, 15, 44, 3111 }, // b
+    { 10, 10, 13, 1, 10, 25, 3155 }, // c
+    { 14, 14, 15, 1, 14, 49, 3180 }, // d
+    { 12, 9, 14, 1, 9, 27, 3229 }, // e
+    { 10, 14, 11, 2, 14, 35, 3256 }, // f
+    { 14, 14, 14, 0, 9, 49, 3291 }, // g
+    { 12, 14, 15, 1, 14, 42, 3340 }, // h
+    { 9, 15, 7, 0, 15, 34, 3382 }, // i
+    { 11, 20, 10, 1, 15, 55, 3416 }, // j
+    { 11, 14, 15, 1, 14, 39, 3471 }, // k
+    { 8, 14, 10, 1, 14, 28, 3510 }, // l
+    { 18, 10, 20, 1, 10, 45, 3538 }, // m
+    { 12, 10, 14, 1, 10, 30, 3583 }, // n
+    { 12, 9, 14, 1, 9, 27, 3613 }, // o
+    { 15, 15, 16, -1, 10, 57, 3640 }, // p
+    { 13, 15, 16, 1, 10, 49, 3697 }, // q
+    { 10, 9, 12, 1, 9, 23, 3746 }, // r
+    { 11, 11, 14, 1, 10, 31, 3769 }, // s
+    { 9, 13, 13, 3, 13, 30, 3800 }, // t
+    { 11, 9, 14, 2, 9, 25, 3830 }, // u
+    { 13, 9, 16, 3, 9, 30, 3855 }, // v
+    { 15, 11, 18, 3, 9, 42, 3885 }, // w
+    { 14, 9, 16, 1, 9, 32, 3927 }, // x
+    { 15, 14, 15, 0, 9, 53, 3959 }, // y
+    { 13, 9, 15, 1, 9, 30, 4012 }, // z
+    { 12, 17, 12, 1, 13, 51, 4042 }, // {
+    { 7, 16, 7, 1, 13, 28, 4096 }, // |
+    { 11, 17, 12, -1, 13, 47, 4124 }, // }
+    { 8, 4, 8, 3, 12, 8, 4171 }, // ~
+    { 0, 0, 14, 0, 0, 0, 4179 }, //  
+    { 9, 22, 9, 2, 19, 50, 4179 }, // ¡
+    { 10, 15, 13, 1, 12, 38, 4229 }, // ¢
+    { 13, 15, 12, 0, 14, 49, 4267 }, // £
+    { 12, 10, 11, 1, 11, 30, 4316 }, // ¤
+    { 15, 16, 13, 1, 13, 60, 4346 }, // ¥
+    { 7, 15, 7, 1, 12, 27, 4406 }, // ¦
+    { 14, 14, 13, 0, 13, 49, 4433 }, // §
+    { 9, 4, 9, 3, 14, 9, 4482 }, // ¨
+    { 10, 7, 11, 4, 16, 18, 4491 }, // ©
+    { 6, 6, 11, 5, 13, 9, 4509 }, // ª
+    { 12, 10, 14, 1, 10, 30, 4518 }, // «
+    { 10, 6, 10, 1, 6, 15, 4548 }, // ¬
+    { 10, 2, 10, 1, 6, 5, 4563 }, // ­
+    { 9, 7, 11, 5, 18, 16, 4568 }, // ®
+    { 8, 3, 9, 3, 13, 6, 4584 }, // ¯
+    { 10, 8, 11, 3, 13, 20, 4590 }, // °
+    { 13, 12, 14, 0, 9, 39, 4610 }, // ±
+    { 6, 7, 5, 6, 14, 11, 4649 }, // ²
+    { 6, 7, 6, 6, 14, 11, 4660 }, // ³
+    { 5, 4, 5, 3, 13, 5, 4671 }, // ´
+    { 14, 12, 14, -1, 9, 42, 4676 }, // µ
+    { 13, 15, 13, 1, 12, 49, 4718 }, // ¶
+    { 5, 4, 4, 1, 8, 5, 4767 }, // ·
+    { 6, 6, 5, -1, 1, 9, 4772 }, // ¸
+    { 5, 7, 5, 6, 14, 9, 4781 }, // ¹
+    { 7, 6, 11, 5, 13, 11, 4790 }, // º
+    { 12, 10, 12, -3, 10, 30, 4801 }, // »
+    { 18, 17, 22, 1, 15, 77, 4831 }, // ¼
+    { 19, 17, 22, 1, 15, 81, 4908 }, // ½
+    { 18, 15, 22, 1, 13, 68, 4989 }, // ¾
+    { 12, 21, 11, -1, 12, 63, 5057 }, // ¿
+    { 14, 19, 19, 1, 19, 67, 5120 }, // À
+    { 15, 22, 19, 1, 22, 83, 5187 }, // Á
+    { 15, 20, 19, 1, 20, 75, 5270 }, // Â
+    { 15, 19, 19, 1, 19, 72, 5345 }, // Ã
+    { 16, 20, 19, 1, 20, 80, 5417 }, // Ä
+    { 15, 20, 19, 1, 20, 75, 5497 }, // Å
+    { 23, 15, 23, 1, 14, 87, 5572 }, // Æ
+    { 15, 19, 16, 1, 15, 72, 5659 }, // Ç
+    { 14, 19, 15, 1, 19, 67, 5731 }, // È
+    { 14, 22, 15, 1, 22, 77, 5798 }, // É
+    { 14, 20, 15, 1, 20, 70, 5875 }, // Ê
+    { 15, 20, 15, 1, 20, 75, 5945 }, // Ë
+    { 10, 20, 9, 1, 20, 50, 6020 }, // Ì
+    { 11, 23, 9, 1, 23, 64, 6070 }, // Í
+    { 11, 21, 9, 1, 21, 58, 6144 }, // Î
+    { 12, 21, 9, 1, 21, 63, 6202 }, // Ï
+    { 17, 14, 17, 0, 14, 60, 6265 }, // Ð
+    { 16, 19, 17, 1, 19, 76, 6325 }, // Ñ
+    { 17, 20, 19, 1, 19, 85, 6401 }, // Ò
+    { 17, 23, 19, 1, 22, 98, 6486 }, // Ó
+    { 17, 21, 19, 1, 20, 90, 6584 }, // Ô
+    { 17, 20, 19, 1, 19, 85, 6674 }, // Õ
+    { 17, 21, 19, 1, 20, 90, 6759 }, // Ö
+    { 11, 6, 10, 0, 7, 17, 6849 }, // ×
+    { 34, 30, 19, -7, 22, 255, 6866 }, // Ø
+    { 16, 21, 17, 1, 20, 84, 7121 }, // Ù
+    { 16, 24, 17, 1, 23, 96, 7205 }, // Ú
+    { 16, 22, 17, 1, 21, 88, 7301 }, // Û
+    { 16, 22, 17, 1, 21, 88, 7389 }, // Ü
+    { 13, 24, 18, 5, 24, 78, 7477 }, // Ý
+    { 11, 14, 9, 0, 14, 39, 7555 }, // Þ
+    { 13, 14, 11, 0, 13, 46, 7594 }, // ß
+    { 11, 14, 14, 1, 14, 39, 7640 }, // à
+    { 12, 17, 14, 1, 17, 51, 7679 }, // á
+    { 12, 15, 14, 1, 15, 45, 7730 }, // â
+    { 12, 15, 14, 1, 15, 45, 7775 }, // ã
+    { 13, 15, 14, 1, 15, 49, 7820 }, // ä
+    { 11, 16, 14, 1, 16, 44, 7869 }, // å
+    { 18, 10, 21, 1, 10, 45, 7913 }, // æ
+    { 10, 14, 13, 1, 10, 35, 7958 }, // ç
+    { 12, 16, 14, 1, 16, 48, 7993 }, // è
+    { 13, 19, 14, 1, 19, 62, 8041 }, // é
+    { 13, 17, 14, 1, 17, 56, 8103 }, // ê
+    { 14, 17, 14, 1, 17, 60, 8192 }, // ë
+    { 8, 14, 7, 0, 14, 28, 8252 }, // ì
+    { 9, 17, 7, 0, 17, 39, 8280 }, // í
+    { 10, 15, 7, -1, 15, 38, 8319 }, // î
+    { 10, 14, 7, 0, 14, 35, 8357 }, // ï
+    { 16, 16, 12, 0, 15, 64, 8392 }, // ð
+    { 13, 15, 14, 1, 15, 49, 8456 }, // ñ
+    { 12, 14, 14, 1, 14, 42, 8505 }, // ò
+    { 12, 17, 14, 1, 17, 51, 8547 }, // ó
+    { 12, 15, 14, 1, 15, 45, 8598 }, // ô
+    { 12, 14, 14, 1, 14, 42, 8643 }, // õ
+    { 13, 15, 14, 1, 15, 49, 8685 }, // ö
+    { 13, 12, 15, 3, 12, 39, 8734 }, // ÷
+    { 19, 28, 14, -2, 19, 133, 8773 }, // ø
+    { 11, 14, 14, 2, 14, 39, 8906 }, // ù
+    { 11, 17, 14, 2, 17, 47, 8945 }, // ú
+    { 11, 15, 14, 2, 15, 42, 8992 }, // û
+    { 12, 15, 14, 2, 15, 45, 9034 }, // ü
+    { 15, 24, 15, 0, 19, 90, 9079 }, // ý
+    { 11, 18, 9, 0, 14, 50, 9169 }, // þ
+    { 16, 22, 15, 0, 17, 88, 9219 }, // ÿ
+    { 17, 20, 19, 1, 20, 85, 9307 }, // Ā
+    { 13, 15, 14, 1, 15, 49, 9392 }, // ā
+    { 17, 20, 19, 1, 20, 85, 9441 }, // Ă
+    { 14, 15, 14, 1, 15, 53, 9526 }, // ă
+    { 14, 19, 19, 1, 14, 67, 9579 }, // Ą
+    { 11, 15, 14, 1, 10, 42, 9646 }, // ą
+    { 15, 20, 16, 1, 20, 75, 9688 }, // Ć
+    { 11, 14, 13, 1, 14, 39, 9763 }, // ć
+    { 16, 21, 16, 1, 21, 84, 9802 }, // Ĉ
+    { 13, 15, 13, 1, 15, 49, 9886 }, // ĉ
+    { 15, 20, 16, 1, 20, 75, 9935 }, // Ċ
+    { 11, 14, 13, 1, 14, 39, 10010 }, // ċ
+    { 17, 21, 16, 1, 21, 90, 10049 }, // Č
+    { 14, 15, 13, 1, 15, 53, 10139 }, // č
+    { 16, 21, 17, 1, 21, 84, 10240 }, // Ď
+    { 17, 14, 15, 1, 14, 60, 10324 }, // ď
+    { 17, 14, 17, 0, 14, 60, 10384 }, // Đ
+    { 16, 14, 15, 1, 14, 56, 10444 }, // đ
+    { 15, 20, 15, 1, 20, 75, 10500 }, // Ē
+    { 14, 17, 14, 1, 17, 60, 10575 }, // ē
+    { 15, 20, 15, 1, 20, 75, 10635 }, // Ĕ
+    { 14, 17, 14, 1, 17, 60, 10710 }, // ĕ
+    { 14, 20, 15, 1, 20, 70, 10770 }, // Ė
+    { 12, 17, 14, 1, 17, 51, 10840 }, // ė
+    { 14, 19, 15, 1, 14, 67, 10891 }, // Ę
+    { 12, 16, 14, 1, 9, 48, 10958 }, // ę
+    { 16, 22, 15, 1, 22, 88, 11006 }, // Ě
+    { 15, 18, 14, 1, 18, 68, 11094 }, // ě
+    { 18, 23, 19, 1, 23, 104, 11162 }, // Ĝ
+    { 15, 21, 14, 0, 16, 79, 11266 }, // ĝ
+    { 18, 22, 19, 1, 22, 99, 11345 }, // Ğ
+    { 16, 20, 14, 0, 15, 80, 11444 }, // ğ
+    { 16, 22, 19, 1, 22, 88, 11524 }, // Ġ
+    { 14, 20, 14, 0, 15, 70, 11612 }, // ġ
+    { 17, 25, 19, 1, 25, 107, 11682 }, // Ģ
+    { 14, 21, 14, 0, 16, 74, 11789 }, // ģ
+    { 16, 21, 17, 1, 21, 84, 11863 }, // Ĥ
+    { 12, 20, 15, 1, 20, 60, 11947 }, // ĥ
+    { 16, 14, 17, 1, 14, 56, 12007 }, // Ħ
+    { 12, 14, 15, 1, 14, 42, 12063 }, // ħ
+    { 11, 21, 9, 1, 21, 58, 12105 }, // Ĩ
+    { 10, 15, 7, 0, 15, 38, 12163 }, // ĩ
+    { 12, 21, 9, 1, 21, 63, 12201 }, // Ī
+    { 10, 15, 7, 0, 15, 38, 12288 }, // ī
+    { 10, 19, 9, -1, 14, 48, 12326 }, // Į
+    { 11, 20, 7, -2, 15, 55, 12374 }, // į
+    { 10, 21, 9, 1, 21, 53, 12429 }, // İ
+    { 6, 9, 7, 0, 9, 14, 12482 }, // ı
+    { 18, 21, 26, 4, 14, 95, 12496 }, // Ĳ
+    { 17, 19, 7, 0, 15, 81, 12591 }, // ĳ
+    { 17, 25, 15, 0, 21, 107, 12672 }, // Ĵ
+    { 14, 22, 10, 1, 17, 77, 12779 }, // ĵ
+    { 15, 23, 17, 1, 23, 87, 12856 }, // Ķ
+    { 13, 23, 15, -1, 14, 75, 12943 }, // ķ
+    { 10, 9, 11, -2, 9, 23, 13018 }, // ĸ
+    { 11, 19, 15, 1, 19, 53, 13041 }, // Ĺ
+    { 10, 21, 10, 1, 21, 53, 13094 }, // ĺ
+    { 12, 23, 15, 0, 14, 69, 13147 }, // Ļ
+    { 11, 23, 10, -2, 14, 64, 13216 }, // ļ
+    { 12, 14, 15, 1, 14, 42, 13280 }, // Ľ
+    { 13, 17, 10, 1, 17, 56, 13322 }, // ľ
+    { 13, 14, 15, 1, 14, 46, 13378 }, // Ŀ
+    { 10, 14, 10, 1, 14, 35, 13424 }, // ŀ
+    { 26, 24, 15, -8, 19, 156, 13459 }, // Ł
+    { 18, 14, 10, -6, 14, 63, 13615 }, // ł
+    { 16, 20, 17, 1, 20, 80, 13678 }, // Ń
+    { 12, 16, 14, 1, 16, 48, 13758 }, // ń
+    { 16, 21, 17, 1, 14, 84, 13806 }, // Ņ
+    { 12, 17, 14, 1, 10, 51, 13890 }, // ņ
+    { 17, 21, 17, 1, 21, 90, 13941 }, // Ň
+    { 15, 17, 14, 1, 17, 64, 14031 }, // ň
+    { 23, 17, 14, -10, 17, 98, 14095 }, // ŉ
+    { 16, 18, 17, 1, 14, 72, 14193 }, // Ŋ
+    { 12, 14, 14, 1, 10, 42, 14265 }, // ŋ
+    { 17, 21, 19, 1, 20, 90, 14336 }, // Ō
+    { 13, 15, 14, 1, 15, 49, 14426 }, // ō
+    { 17, 21, 19, 1, 20, 90, 14475 }, // Ŏ
+    { 14, 15, 14, 1, 15, 53, 14565 }, // ŏ
+    { 19, 20, 19, 1, 19, 95, 14618 }, // Ő
+    { 16, 14, 14, 1, 14, 56, 14713 }, // ő
+    { 24, 15, 20, 1, 14, 90, 14769 }, // Œ
+    { 19, 9, 18, 1, 9, 43, 14859 }, // œ
+    { 13, 20, 16, 1, 19, 65, 14902 }, // Ŕ
+    { 10, 13, 12, 1, 13, 33, 14967 }, // ŕ
+    { 13, 24, 16, 1, 23, 78, 15000 }, // Ŗ
+    { 10, 17, 12, 1, 17, 43, 15078 }, // ŗ
+    { 15, 22, 16, 1, 21, 83, 15121 }, // Ř
+    { 12, 15, 12, 1, 15, 45, 15204 }, // ř
+    { 15, 20, 17, 1, 20, 75, 15249 }, // Ś
+    { 11, 15, 14, 1, 14, 42, 15324 }, // ś
+    { 16, 21, 17, 1, 21, 84, 15366 }, // Ŝ
+    { 13, 16, 14, 1, 15, 52, 15450 }, // ŝ
+    { 15, 19, 17, 1, 15, 72, 15502 }, // Ş
+    { 11, 14, 14, 1, 10, 39, 15574 }, // ş
+    { 17, 21, 17, 1, 21, 90, 15613 }, // Š
+    { 14, 16, 14, 1, 15, 56, 15703 }, // š
+    { 14, 19, 17, 4, 14, 67, 15759 }, // Ţ
+    { 10, 17, 13, 2, 13, 43, 15826 }, // ţ
+    { 14, 21, 17, 4, 21, 74, 15869 }, // Ť
+    { 13, 15, 13, 3, 15, 49, 15943 }, // ť
+    { 14, 14, 17, 4, 14, 49, 15992 }, // Ŧ
+    { 11, 13, 13, 1, 13, 36, 16041 }, // ŧ
+    { 16, 22, 17, 1, 21, 88, 16077 }, // Ũ
+    { 11, 15, 14, 2, 15, 42, 16165 }, // ũ
+    { 16, 22, 17, 1, 21, 88, 16207 }, // Ū
+    { 12, 15, 14, 2, 15, 45, 16295 }, // ū
+    { 16, 22, 17, 1, 21, 88, 16384 }, // Ŭ
+    { 13, 15, 14, 2, 15, 49, 16472 }, // ŭ
+    { 16, 23, 17, 1, 22, 92, 16521 }, // Ů
+    { 11, 16, 14, 2, 16, 44, 16613 }, // ů
+    { 19, 21, 17, 1, 20, 100, 16657 }, // Ű
+    { 15, 14, 14, 2, 14, 53, 16757 }, // ű
+    { 16, 19, 17, 1, 14, 76, 16810 }, // Ų
+    { 11, 14, 14, 2, 9, 39, 16886 }, // ų
+    { 20, 21, 23, 4, 21, 105, 16925 }, // Ŵ
+    { 15, 18, 18, 3, 16, 68, 17030 }, // ŵ
+    { 13, 22, 18, 5, 22, 72, 17098 }, // Ŷ
+    { 15, 22, 15, 0, 17, 83, 17170 }, // ŷ
+    { 13, 22, 18, 5, 22, 72, 17253 }, // Ÿ
+    { 17, 19, 18, 1, 19, 81, 17325 }, // Ź
+    { 13, 15, 15, 1, 15, 49, 17406 }, // ź
+    { 17, 19, 18, 1, 19, 81, 17455 }, // Ż
+    { 13, 15, 15, 1, 15, 49, 17536 }, // ż
+    { 17, 21, 18, 1, 21, 90, 17585 }, // Ž
+    { 15, 17, 15, 1, 17, 64, 17675 }, // ž
+    { 11, 15, 10, 1, 14, 42, 17739 }, // ſ
+    { 7, 4, 0, 3, 13, 7, 17781 }, // ̀
+    { 5, 4, 0, 3, 13, 5, 17788 }, // ́
+    { 10, 5, 0, -1, 1, 13, 17793 }, // ̂
+    { 8, 4, 0, 3, 12, 8, 17806 }, // ̃
+    { 10, 3, 0, 3, 12, 8, 17814 }, // ̄
+    { 12, 3, 0, 4, 15, 9, 17822 }, // ̅
+    { 9, 4, 0, 3, 12, 9, 17831 }, // ̆
+    { 5, 4, 0, 3, 14, 5, 17840 }, // ̇
+    { 9, 4, 0, 2, 13, 9, 17845 }, // ̈
+    { 4, 5, 0, 6, 11, 5, 17854 }, // ̉
+    { 5, 4, 0, 3, 13, 5, 17859 }, // ̊
+    { 14, 4, 0, 3, 13, 14, 17864 }, // ̋
+    { 10, 5, 0, 3, 13, 13, 17878 }, // ̌
+    { 14, 4, 0, -6, 13, 14, 17891 }, // ̏
+    { 7, 6, 0, 2, 13, 11, 17905 }, // ̒
+    { 7, 6, 0, 2, 13, 11, 17916 }, // ̓
+    { 8, 6, 0, -4, 13, 12, 17927 }, // ̔
+    { 5, 5, 0, 0, 0, 7, 17939 }, // ̘
+    { 6, 5, 0, 0, 0, 8, 17946 }, // ̙
+    { 8, 5, 0, 4, 14, 10, 17954 }, // ̚
+    { 5, 5, 0, 2, 11, 7, 17964 }, // ̛
+    { 4, 6, 0, -1, 0, 6, 17971 }, // ̜
+    { 5, 6, 0, 1, 4, 8, 17977 }, // ̝
+    { 5, 5, 0, -1, 0, 7, 17985 }, // ̞
+    { 4, 5, 0, 0, -1, 5, 17992 }, // ̟
+    { 10, 3, 0, -1, -2, 8, 17997 }, // ̠
+    { 5, 4, 0, -2, 2, 5, 18005 }, // ̣
+    { 9, 4, 0, -2, -1, 9, 18010 }, // ̤
+    { 5, 4, 0, 3, 13, 5, 18019 }, // ̥
+    { 8, 6, 0, -1, 3, 12, 18024 }, // ̦
+    { 6, 6, 0, -1, 1, 9, 18036 }, // ̧
+    { 5, 7, 0, 0, 2, 9, 18045 }, // ̨
+    { 5, 6, 0, -1, 0, 8, 18054 }, // ̩
+    { 8, 4, 0, -1, 0, 8, 18062 }, // ̪
+    { 11, 5, 0, -1, 1, 14, 18070 }, // ̬
+    { 11, 5, 0, -1, 1, 14, 18084 }, // ̭
+    { 8, 4, 0, 4, 14, 8, 18098 }, // ̰
+    { 9, 3, 0, 4, 14, 7, 18106 }, // ̱
+    { 9, 3, 0, -1, -1, 7, 18113 }, // ̲
+    { 9, 4, 0, 4, 14, 9, 18120 }, // ̴
+    { 10, 2, 0, 1, 6, 5, 18129 }, // ̵
+    { 4, 6, 0, 1, 0, 6, 18134 }, // ̹
+    { 10, 6, 0, -3, 1, 15, 18140 }, // ̺
+    { 8, 6, 0, -1, 1, 12, 18155 }, // ̻
+    { 8, 5, 0, -1, 1, 10, 18167 }, // ̼
+    { 6, 4, 0, 3, 13, 6, 18177 }, // ̽
+    { 8, 4, 0, 3, 12, 8, 18183 }, // ͂
+    { 4, 5, 0, 7, 15, 5, 18191 }, // ̓
+    { 10, 12, 0, 3, 21, 30, 18196 }, // ̈́
+    { 8, 4, 0, 3, 14, 8, 18226 }, // ͆
+    { 11, 7, 0, -2, 0, 20, 18234 }, // ͇
+    { 9, 5, 0, -1, 0, 12, 18254 }, // ͈
+    { 7, 6, 0, -1, 0, 11, 18266 }, // ͉
+    { 13, 14, 0, 2, 18, 46, 18277 }, // ͊
+    { 18, 13, 0, 5, 19, 59, 18323 }, // ͋
+    { 12, 9, 0, 9, 9, 27, 18382 }, // ͌
+    { 9, 19, 0, 1, 6, 43, 18432 }, // ͍
+    { 4, 3, 0, 8, 2, 3, 18475 }, // ͎
+    { 15, 5, 0, 0, 1, 19, 18478 }, // ͜
+    { 15, 5, 0, 3, 14, 19, 18497 }, // ͡
+    { 19, 6, 0, -1, 0, 29, 18516 }, // ͢
+    { 14, 20, 14, 1, 20, 70, 18545 }, // Ѐ
+    { 15, 20, 15, 1, 20, 75, 18615 }, // Ё
+    { 15, 16, 11, 2, 15, 60, 18690 }, // Ђ
+    { 14, 20, 11, 0, 19, 70, 18750 }, // Ѓ
+    { 15, 15, 14, 1, 13, 57, 18820 }, // Є
+    { 15, 15, 17, 1, 15, 57, 18877 }, // Ѕ
+    { 8, 14, 9, 1, 14, 28, 18934 }, // І
+    { 11, 20, 9, 1, 20, 55, 18962 }, // Ї
+    { 15, 18, 15, 0, 14, 68, 19017 }, // Ј
+    { 18, 15, 19, 1, 13, 68, 19085 }, // Љ
+    { 17, 14, 10, -3, 13, 60, 19153 }, // Њ
+    { 14, 16, 17, 4, 16, 56, 19213 }, // Ћ
+    { 15, 19, 17, 1, 19, 72, 19269 }, // Ќ
+    { 15, 18, 16, 1, 18, 68, 19341 }, // Ѝ
+    { 14, 22, 13, 0, 20, 77, 19409 }, // Ў
+    { 14, 17, 13, 1, 13, 60, 19486 }, // Џ
+    { 14, 14, 19, 1, 14, 49, 19546 }, // А
+    { 12, 13, 11, 1, 13, 39, 19595 }, // Б
+    { 12, 14, 11, 1, 13, 42, 19634 }, // В
+    { 14, 14, 11, 0, 13, 49, 19676 }, // Г
+    { 14, 15, 14, 1, 13, 53, 19725 }, // Д
+    { 14, 15, 14, 1, 15, 53, 19778 }, // Е
+    { 24, 14, 25, 0, 14, 84, 19831 }, // Ж
+    { 11, 14, 11, 1, 13, 39, 19915 }, // З
+    { 15, 14, 16, 1, 14, 53, 19954 }, // И
+    { 15, 19, 16, 1, 19, 72, 20007 }, // Й
+    { 15, 14, 17, 1, 14, 53, 20079 }, // К
+    { 15, 15, 10, -1, 13, 57, 20132 }, // Л
+    { 17, 14, 14, 0, 13, 60, 20189 }, // М
+    { 16, 14, 17, 1, 14, 56, 20249 }, // Н
+    { 17, 15, 19, 1, 14, 64, 20305 }, // О
+    { 14, 14, 11, 0, 13, 49, 20369 }, // П
+    { 14, 15, 15, 1, 15, 53, 20418 }, // Р
+    { 15, 15, 16, 1, 15, 57, 20480 }, // С
+    { 14, 14, 17, 4, 14, 49, 20537 }, // Т
+    { 14, 15, 13, 0, 13, 53, 20586 }, // У
+    { 13, 13, 15, 3, 13, 43, 20639 }, // Ф
+    { 17, 14, 18, 1, 14, 60, 20682 }, // Х
+    { 14, 17, 12, 0, 13, 60, 20742 }, // Ц
+    { 11, 13, 11, 2, 13, 36, 20802 }, // Ч
+    { 16, 14, 14, 0, 13, 56, 20838 }, // Ш
+    { 16, 16, 15, 0, 13, 64, 20894 }, // Щ
+    { 12, 13, 10, -1, 12, 39, 20958 }, // Ъ
+    { 19, 15, 19, 0, 14, 72, 20997 }, // Ы
+    { 11, 13, 10, 0, 12, 36, 21069 }, // Ь
+    { 15, 15, 16, 1, 13, 57, 21105 }, // Э
+    { 16, 14, 15, 1, 13, 56, 21162 }, // Ю
+    { 15, 15, 15, 0, 14, 57, 21218 }, // Я
+    { 11, 10, 14, 1, 10, 28, 21275 }, // а
+    { 14, 16, 12, 1, 15, 56, 21303 }, // б
+    { 11, 9, 12, -1, 9, 25, 21359 }, // в
+    { 12, 11, 10, 0, 9, 33, 21384 }, // г
+    { 12, 12, 13, 1, 9, 36, 21417 }, // д
+    { 12, 9, 14, 1, 9, 27, 21453 }, // е
+    { 24, 12, 25, 0, 12, 72, 21480 }, // ж
+    { 9, 9, 8, -2, 9, 21, 21552 }, // з
+    { 13, 11, 11, 0, 9, 36, 21573 }, // и
+    { 12, 14, 11, 0, 14, 42, 21609 }, // й
+    { 12, 9, 13, -1, 9, 27, 21651 }, // к
+    { 10, 10, 7, -2, 9, 25, 21678 }, // л
+    { 13, 11, 14, -1, 11, 36, 21703 }, // м
+    { 14, 11, 14, -1, 11, 39, 21739 }, // н
+    { 12, 9, 14, 1, 9, 27, 21778 }, // о
+    { 13, 11, 11, 0, 9, 36, 21805 }, // п
+    { 15, 15, 16, -1, 10, 57, 21841 }, // р
+    { 10, 10, 13, 1, 10, 25, 21898 }, // с
+    { 12, 11, 11, 2, 9, 33, 21923 }, // т
+    { 15, 14, 15, 0, 9, 53, 21956 }, // у
+    { 15, 13, 15, 1, 9, 49, 22009 }, // ф
+    { 14, 11, 12, 0, 9, 39, 22058 }, // х
+    { 12, 12, 12, 1, 9, 36, 22097 }, // ц
+    { 8, 9, 8, 0, 9, 18, 22133 }, // ч
+    { 16, 10, 14, 0, 9, 40, 22151 }, // ш
+    { 16, 13, 15, 0, 9, 52, 22191 }, // щ
+    { 9, 11, 8, -2, 10, 25, 22243 }, // ъ
+    { 14, 12, 15, -1, 11, 42, 22268 }, // ы
+    { 8, 11, 8, -1, 10, 22, 22310 }, // ь
+    { 10, 11, 11, 1, 10, 28, 22332 }, // э
+    { 13, 11, 12, 0, 10, 36, 22360 }, // ю
+    { 10, 11, 14, 1, 11, 28, 22396 }, // я
+    { 12, 17, 14, 1, 17, 51, 22424 }, // ѐ
+    { 13, 16, 14, 1, 16, 52, 22475 }, // ё
+    { 12, 18, 15, 1, 14, 54, 22528 }, // ђ
+    { 12, 15, 10, 0, 13, 45, 22582 }, // ѓ
+    { 10, 10, 10, -1, 9, 25, 22627 }, // є
+    { 11, 11, 14, 1, 10, 31, 22652 }, // ѕ
+    { 9, 15, 7, 0, 15, 34, 22683 }, // і
+    { 10, 14, 7, 0, 14, 35, 22717 }, // ї
+    { 11, 20, 10, 1, 15, 55, 22752 }, // ј
+    { 13, 10, 13, -1, 9, 33, 22807 }, // љ
+    { 12, 10, 7, -4, 9, 30, 22840 }, // њ
+    { 12, 14, 15, 1, 14, 42, 22870 }, // ћ
+    { 13, 14, 13, -1, 14, 46, 22912 }, // ќ
+    { 13, 17, 11, 0, 15, 56, 22958 }, // ѝ
+    { 16, 22, 15, 0, 17, 88, 23014 }, // ў
+    { 11, 13, 10, -1, 10, 36, 23102 }, // џ
+    { 10, 14, 12, 3, 13, 35, 23138 }, // Ѣ
+    { 11, 14, 11, 2, 13, 39, 23173 }, // ѣ
+    { 18, 14, 14, -1, 13, 63, 23212 }, // Ѫ
+    { 13, 11, 10, -2, 10, 36, 23275 }, // ѫ
+    { 19, 18, 19, 1, 18, 86, 23311 }, // Ѳ
+    { 15, 13, 14, 1, 13, 49, 23397 }, // ѳ
+    { 17, 17, 18, 5, 17, 73, 23446 }, // Ѵ
+    { 12, 11, 14, 3, 11, 33, 23519 }, // ѵ
+    { 8, 6, 0, 5, 16, 12, 23552 }, // ҆
+    { 14, 15, 11, 0, 14, 53, 23564 }, // Ґ
+    { 13, 14, 10, 0, 12, 46, 23617 }, // ґ
+    { 14, 14, 11, 0, 13, 49, 23663 }, // Ғ
+    { 10, 9, 8, -2, 9, 23, 23712 }, // ғ
+    { 13, 16, 10, 0, 15, 52, 23735 }, // Ҕ
+    { 9, 10, 6, -2, 9, 23, 23787 }, // ҕ
+    { 24, 17, 25, 0, 14, 102, 23810 }, // Җ
+    { 17, 11, 17, -2, 9, 47, 23912 }, // җ
+    { 11, 16, 11, 1, 13, 44, 23959 }, // Ҙ
+    { 9, 13, 8, -2, 9, 30, 24003 }, // ҙ
+    { 15, 17, 12, 0, 14, 64, 24033 }, // Қ
+    { 11, 11, 8, -2, 9, 31, 24097 }, // қ
+    { 18, 14, 18, 1, 13, 63, 24128 }, // Ҝ
+    { 13, 9, 12, 0, 9, 30, 24191 }, // ҝ
+    { 15, 14, 17, 1, 14, 53, 24221 }, // Ҟ
+    { 11, 14, 15, 1, 14, 39, 24274 }, // ҟ
+    { 15, 14, 17, 1, 14, 53, 24313 }, // Ҡ
+    { 10, 9, 12, -1, 9, 23, 24366 }, // ҡ
+    { 17, 17, 13, -2, 14, 73, 24389 }, // Ң
+    { 12, 11, 9, -3, 9, 33, 24462 }, // ң
+    { 22, 14, 17, 1, 14, 77, 24495 }, // Ҥ
+    { 16, 9, 12, -1, 9, 36, 24576 }, // ҥ
+    { 20, 16, 21, 1, 15, 80, 24612 }, // Ҧ
+    { 16, 17, 21, 3, 12, 68, 24692 }, // ҧ
+    { 18, 14, 11, -2, 13, 63, 24760 }, // Ҩ
+    { 14, 11, 17, 1, 10, 39, 24823 }, // ҩ
+    { 15, 17, 16, 1, 15, 64, 24862 }, // Ҫ
+    { 10, 12, 13, 1, 10, 30, 24926 }, // ҫ
+    { 14, 16, 13, 2, 14, 56, 24956 }, // Ҭ
+    { 10, 11, 9, -1, 9, 28, 25012 }, // ҭ
+    { 13, 14, 18, 5, 14, 46, 25040 }, // Ү
+    { 11, 13, 13, 3, 9, 36, 25086 }, // ү
+    { 15, 14, 18, 3, 14, 53, 25122 }, // Ұ
+    { 14, 14, 13, 0, 10, 49, 25175 }, // ұ
+    { 17, 17, 13, 1, 14, 73, 25224 }, // Ҳ
+    { 13, 11, 13, 0, 9, 36, 25297 }, // ҳ
+    { 14, 16, 10, 0, 13, 56, 25333 }, // Ҵ
+    { 11, 12, 15, 2, 9, 33, 25389 }, // ҵ
+    { 11, 17, 11, 2, 13, 47, 25422 }, // Ҷ
+    { 8, 12, 8, 0, 9, 24, 25469 }, // ҷ
+    { 11, 13, 11, 2, 13, 36, 25493 }, // Ҹ
+    { 8, 9, 8, 0, 9, 18, 25529 }, // ҹ
+    { 12, 15, 11, 0, 14, 45, 25547 }, // Һ
+    { 12, 14, 15, 1, 14, 42, 25592 }, // һ
+    { 19, 13, 24, 3, 12, 62, 25634 }, // Ҽ
+    { 14, 9, 12, 1, 9, 32, 25696 }, // ҽ
+    { 19, 15, 15, 4, 12, 72, 25728 }, // Ҿ
+    { 15, 12, 11, 1, 10, 45, 25800 }, // ҿ
+    { 8, 14, 9, 1, 14, 28, 25845 }, // Ӏ
+    { 24, 23, 25, 0, 23, 138, 25873 }, // Ӂ
+    { 24, 19, 25, 0, 19, 114, 26011 }, // ӂ
+    { 14, 18, 12, 0, 13, 63, 26125 }, // Ӄ
+    { 10, 13, 8, -2, 9, 33, 26188 }, // ӄ
+    { 15, 17, 10, -1, 13, 64, 26221 }, // Ӆ
+    { 10, 12, 7, -1, 9, 30, 26285 }, // ӆ
+    { 16, 19, 17, 1, 14, 76, 26315 }, // Ӈ
+    { 11, 13, 12, -1, 9, 36, 26391 }, // ӈ
+    { 16, 20, 17, 1, 14, 80, 26427 }, // Ӊ
+    { 12, 13, 12, 0, 9, 39, 26507 }, // ӊ
+    { 12, 17, 11, 2, 13, 51, 26546 }, // Ӌ
+    { 8, 12, 10, 1, 9, 24, 26597 }, // ӌ
+    { 18, 20, 19, 1, 14, 90, 26624 }, // Ӎ
+    { 13, 13, 13, 0, 9, 43, 26714 }, // ӎ
+    { 7, 13, 10, 3, 12, 23, 26757 }, // ӏ
+    { 17, 20, 19, 1, 20, 85, 26780 }, // Ӑ
+    { 14, 15, 14, 1, 15, 53, 26865 }, // ӑ
+    { 16, 19, 19, 1, 19, 76, 26918 }, // Ӓ
+    { 14, 15, 14, 1, 15, 53, 26994 }, // ӓ
+    { 23, 15, 23, 1, 14, 87, 27047 }, // Ӕ
+    { 18, 10, 21, 1, 10, 45, 27134 }, // ӕ
+    { 16, 20, 14, 1, 20, 80, 27179 }, // Ӗ
+    { 14, 17, 14, 1, 17, 60, 27259 }, // ӗ
+    { 15, 14, 18, 5, 13, 53, 27319 }, // Ә
+    { 11, 11, 14, 5, 10, 31, 27372 }, // ә
+    { 15, 20, 18, 5, 19, 75, 27403 }, // Ӛ
+    { 12, 14, 14, 4, 10, 42, 27478 }, // ӛ
+    { 24, 22, 23, 2, 22, 132, 27520 }, // Ӝ
+    { 24, 19, 25, 0, 19, 114, 27652 }, // ӝ
+    { 13, 22, 11, 1, 21, 72, 27766 }, // Ӟ
+    { 12, 13, 8, -2, 13, 39, 27838 }, // ӟ
+    { 11, 14, 11, 2, 13, 39, 27877 }, // Ӡ
+    { 11, 14, 11, 1, 10, 39, 27916 }, // ӡ
+    { 15, 19, 15, 1, 19, 72, 27955 }, // Ӣ
+    { 14, 17, 11, 0, 15, 60, 28027 }, // ӣ
+    { 15, 18, 16, 1, 18, 68, 28087 }, // Ӥ
+    { 13, 16, 11, 0, 14, 52, 28155 }, // ӥ
+    { 17, 20, 19, 1, 19, 85, 28207 }, // Ӧ
+    { 12, 16, 14, 1, 16, 48, 28292 }, // ӧ
+    { 15, 14, 18, 2, 14, 53, 28340 }, // Ө
+    { 12, 9, 14, 1, 9, 27, 28393 }, // ө
+    { 15, 19, 18, 2, 19, 72, 28420 }, // Ӫ
+    { 12, 14, 14, 1, 14, 42, 28492 }, // ӫ
+    { 25, 22, 16, 1, 20, 138, 28534 }, // Ӭ
+    { 11, 15, 11, 1, 14, 42, 28672 }, // ӭ
+    { 14, 22, 13, 0, 20, 77, 28714 }, // Ӯ
+    { 16, 22, 15, 0, 17, 88, 28791 }, // ӯ
+    { 14, 21, 13, 0, 19, 74, 28879 }, // Ӱ
+    { 15, 22, 15, 0, 17, 83, 28953 }, // ӱ
+    { 16, 21, 13, 0, 19, 84, 29036 }, // Ӳ
+    { 18, 21, 15, 0, 16, 95, 29120 }, // ӳ
+    { 11, 17, 11, 2, 17, 47, 29215 }, // Ӵ
+    { 9, 13, 8, 0, 13, 30, 29262 }, // ӵ
+    { 14, 16, 11, 0, 13, 56, 29292 }, // Ӷ
+    { 10, 11, 8, -2, 9, 28, 29348 }, // ӷ
+    { 19, 22, 19, 0, 21, 105, 29376 }, // Ӹ
+    { 15, 19, 15, -1, 18, 72, 29481 }, // ӹ
+    { 17, 16, 18, 1, 14, 68, 29553 }, // Ӽ
+    { 12, 11, 13, -1, 9, 33, 29621 }, // ӽ
+    { 0, 0, 11, 0, 0, 0, 29654 }, //  
+    { 0, 0, 19, 0, 0, 0, 29654 }, //  
+    { 0, 0, 11, 0, 0, 0, 29654 }, //  
+    { 0, 0, 19, 0, 0, 0, 29654 }, //  
+    { 0, 0, 8, 0, 0, 0, 29654 }, //  
+    { 0, 0, 7, 0, 0, 0, 29654 }, //  
+    { 0, 0, 5, 0, 0, 0, 29654 }, //  
+    { 0, 0, 12, 0, 0, 0, 29654 }, //  
+    { 0, 0, 4, 0, 0, 0, 29654 }, //  
+    { 0, 0, 6, 0, 0, 0, 29654 }, //  
+    { 0, 0, 5, 0, 0, 0, 29654 }, //  
+    { 0, 0, 3, 0, 0, 0, 29654 }, // ​
+    { 0, 0, 0, 0, 0, 0, 29654 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 29654 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 29654 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 29654 }, // ‏
+    { 10, 2, 9, 1, 6, 5, 29654 }, // ‐
+    { 10, 2, 9, 1, 6, 5, 29659 }, // ‑
+    { 15, 2, 9, -1, 6, 8, 29664 }, // ‒
+    { 14, 4, 13, 1, 7, 14, 29672 }, // –
+    { 19, 4, 19, 1, 7, 19, 29686 }, // —
+    { 19, 4, 19, 1, 7, 19, 29705 }, // ―
+    { 12, 16, 9, 1, 13, 48, 29724 }, // ‖
+    { 16, 6, 9, -4, -1, 24, 29772 }, // ‗
+    { 8, 6, 7, 3, 15, 12, 29796 }, // ‘
+    { 8, 6, 7, 3, 15, 12, 29808 }, // ’
+    { 7, 6, 5, -1, 3, 11, 29820 }, // ‚
+    { 8, 6, 7, 3, 15, 12, 29831 }, // ‛
+    { 13, 6, 13, 3, 15, 20, 29843 }, // “
+    { 13, 6, 13, 3, 15, 20, 29863 }, // ”
+    { 7, 6, 5, -1, 3, 11, 29883 }, // „
+    { 13, 6, 13, 3, 15, 20, 29894 }, // ‟
+    { 10, 24, 13, 4, 18, 60, 29914 }, // †
+    { 12, 23, 14, 3, 17, 69, 29974 }, // ‡
+    { 15, 13, 8, -2, 15, 49, 30043 }, // •
+    { 6, 7, 10, 3, 8, 11, 30092 }, // ‣
+    { 5, 4, 10, 3, 4, 5, 30103 }, // ․
+    { 5, 4, 10, 3, 4, 5, 30108 }, // ‥
+    { 16, 4, 16, 0, 4, 16, 30113 }, // …
+    { 3, 2, 9, 3, 6, 2, 30129 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 30131 }, //  
+    { 16, 15, 19, 2, 13, 60, 30131 }, // ‰
+    { 8, 6, 9, 5, 15, 12, 30191 }, // ′
+    { 13, 6, 13, 5, 15, 20, 30203 }, // ″
+    { 13, 6, 7, -2, 14, 20, 30223 }, // ‴
+    { 5, 6, 7, 4, 14, 8, 30243 }, // ‵
+    { 8, 6, 7, 3, 14, 12, 30251 }, // ‶
+    { 13, 6, 7, 0, 14, 20, 30263 }, // ‷
+    { 10, 4, 11, 3, 14, 10, 30283 }, // ‸
+    { 7, 10, 7, 2, 10, 18, 30293 }, // ‹
+    { 7, 10, 7, -2, 10, 18, 30311 }, // ›
+    { 22, 22, 23, 1, 17, 121, 30329 }, // ※
+    { 10, 22, 10, 1, 19, 55, 30450 }, // ‼
+    { 13, 27, 14, 3, 23, 88, 30505 }, // ‽
+    { 10, 2, 9, 3, 14, 5, 30593 }, // ‾
+    { 9, 4, 13, 3, 11, 9, 30598 }, // ‿
+    { 13, 12, 11, 1, 15, 39, 30607 }, // ⁂
+    { 16, 15, 22, 3, 13, 60, 30646 }, // ⁄
+    { 23, 21, 25, 4, 19, 121, 30720 }, // ⁇
+    { 20, 22, 20, 3, 19, 110, 30841 }, // ⁈
+    { 18, 22, 13, -1, 19, 99, 30951 }, // ⁉
+    { 19, 29, 15, -1, 20, 138, 31050 }, // ⁒
+    { 0, 0, 78, 0, 0, 0, 31188 }, //  
+    { 6, 7, 6, 6, 14, 11, 31188 }, // ⁰
+    { 6, 6, 6, 6, 14, 9, 31199 }, // ⁴
+    { 6, 8, 6, 6, 14, 12, 31208 }, // ⁵
+    { 6, 7, 6, 6, 14, 11, 31220 }, // ⁶
+    { 6, 8, 6, 7, 15, 12, 31231 }, // ⁷
+    { 6, 7, 6, 6, 14, 11, 31243 }, // ⁸
+    { 6, 8, 6, 6, 14, 12, 31254 }, // ⁹
+    { 12, 10, 14, 1, 10, 30, 31266 }, // ⁿ
+    { 6, 7, 6, -5, 4, 11, 31296 }, // ₀
+    { 6, 7, 6, -6, 4, 11, 31307 }, // ₁
+    { 7, 7, 6, -6, 4, 13, 31318 }, // ₂
+    { 7, 7, 6, -6, 4, 13, 31331 }, // ₃
+    { 6, 7, 6, -5, 4, 11, 31344 }, // ₄
+    { 6, 8, 6, -5, 5, 12, 31355 }, // ₅
+    { 7, 7, 6, -6, 4, 13, 31367 }, // ₆
+    { 6, 8, 6, -4, 5, 12, 31380 }, // ₇
+    { 6, 7, 6, -5, 4, 11, 31392 }, // ₈
+    { 6, 8, 6, -5, 4, 12, 31403 }, // ₉
+    { 12, 23, 8, 1, 17, 69, 31415 }, // ₍
+    { 11, 23, 7, -5, 17, 64, 31484 }, // ₎
+    { 16, 22, 16, 2, 18, 88, 31548 }, // ₡
+    { 15, 15, 16, 1, 15, 57, 31636 }, // ₢
+    { 13, 14, 12, 0, 13, 46, 31693 }, // ₤
+    { 20, 14, 17, -1, 14, 70, 31739 }, // ₦
+    { 16, 15, 15, 1, 15, 60, 31809 }, // ₧
+    { 21, 15, 22, -1, 14, 79, 31869 }, // ₨
+    { 15, 14, 14, -1, 14, 53, 31948 }, // ₩
+    { 17, 13, 18, 2, 13, 56, 32001 }, // ₪
+    { 15, 14, 9, -1, 13, 53, 32057 }, // ₫
+    { 14, 17, 14, 1, 14, 60, 32110 }, // €
+    { 14, 14, 17, 4, 14, 49, 32170 }, // ₮
+    { 18, 15, 11, 0, 15, 68, 32219 }, // ₱
+    { 16, 22, 19, 1, 19, 88, 32287 }, // ₲
+    { 19, 15, 17, 5, 14, 72, 32375 }, // ₴
+    { 10, 13, 10, 1, 11, 33, 32447 }, // ₵
+    { 16, 16, 17, 4, 16, 64, 32480 }, // ₸
+    { 12, 13, 12, 2, 12, 39, 32544 }, // ₹
+    { 11, 13, 12, 1, 11, 36, 32583 }, // ₺
+    { 14, 15, 14, 2, 14, 53, 32619 }, // ₼
+    { 17, 15, 15, -2, 15, 64, 32672 }, // ₽
+    { 12, 12, 12, -3, 9, 36, 32768 }, // ←
+    { 12, 12, 13, 2, 10, 36, 32804 }, // ↑
+    { 12, 12, 13, 3, 9, 36, 32840 }, // →
+    { 13, 12, 13, 4, 11, 39, 32876 }, // ↓
+    { 19, 10, 17, -1, 8, 48, 32915 }, // ↔
+    { 10, 19, 13, 3, 18, 48, 32963 }, // ↕
+    { 11, 8, 13, -1, 8, 22, 33011 }, // ↖
+    { 11, 8, 11, 2, 8, 22, 33033 }, // ↗
+    { 10, 11, 11, 3, 9, 28, 33055 }, // ↘
+    { 10, 11, 11, -2, 9, 28, 33083 }, // ↙
+    { 14, 11, 16, 0, 10, 39, 33111 }, // ⇐
+    { 15, 14, 18, 3, 13, 53, 33150 }, // ⇑
+    { 14, 11, 16, 2, 10, 39, 33203 }, // ⇒
+    { 15, 14, 18, 6, 13, 53, 33242 }, // ⇓
+    { 18, 11, 18, 0, 10, 50, 33295 }, // ⇔
+    { 12, 17, 15, 4, 9, 51, 33345 }, // ⇕
+    { 13, 16, 11, 1, 15, 52, 33396 }, // ∂
+    { 18, 16, 19, 0, 15, 72, 33448 }, // ∅
+    { 14, 14, 14, 0, 13, 49, 33520 }, // ∆
+    { 13, 14, 12, 2, 13, 46, 33569 }, // ∏
+    { 13, 14, 12, 5, 13, 46, 33615 }, // ∐
+    { 13, 14, 10, 0, 13, 46, 33661 }, // ∑
+    { 10, 3, 10, 1, 6, 8, 33707 }, // −
+    { 17, 15, 16, 2, 14, 64, 33715 }, // √
+    { 16, 10, 15, 1, 11, 40, 33779 }, // ∞
+    { 17, 18, 14, 0, 13, 77, 33819 }, // ∫
+    { 8, 12, 5, 0, 12, 24, 33896 }, // ∶
+    { 12, 9, 24, 9, 9, 27, 33920 }, // ≈
+    { 16, 15, 22, 3, 14, 60, 33947 }, // ≠
+    { 16, 15, 13, -2, 13, 60, 34007 }, // ≤
+    { 16, 14, 14, 0, 12, 56, 34067 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
@@ -2921,4 +2191,9 @@ static const EpdFontData opendyslexic_8_bolditalic = {
     22,
     -9,
     true,
+    opendyslexic_8_bolditalicBlockOffsets,
+    opendyslexic_8_bolditalicDirectGlyphs,
+    opendyslexic_8_bolditalicGlyphPages,
+    35,
+    opendyslexic_8_bolditalicPageGlyphs,
 };
@@ -2,1894 +2,1293 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_italic
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_italic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_8_italic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_italicBitmaps[30087] = {
-    0x00, 0x01, 0x00, 0x01, 0xC0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0,
-    0x01, 0xD0, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x00, 0x40, 0x01, 0x40, 0x00,
-    0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x15, 0x0F, 0x4F, 0xC3, 0xE2, 0xF0, 0xF8, 0x7C,
-    0x2F, 0x0F, 0x06, 0x82, 0x90, 0x00, 0x00, 0xD0, 0x34, 0x00, 0x00, 0x07, 0x01, 0xC0, 0x00, 0x00,
-    0x3C, 0x0F, 0x00, 0x00, 0x00, 0xD0, 0x34, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0xBD, 0x5F,
-    0x55, 0x00, 0x01, 0xD0, 0x74, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x0E, 0x00, 0x00,
-    0x57, 0xE5, 0xB9, 0x54, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x1E, 0x00, 0x00, 0x03, 0xC0,
-    0xF0, 0x00, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-    0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xC9, 0x00,
-    0x01, 0xFA, 0x34, 0x00, 0x0F, 0x74, 0xC0, 0x00, 0x3F, 0xD7, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0xA3, 0xFF, 0x00, 0x03, 0x4E, 0xFD, 0x01, 0x0C, 0x7F, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xF4, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x31, 0xC0, 0x00, 0x00, 0x85, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x34, 0x07, 0xE0, 0x09, 0x02, 0x83, 0x02, 0x80, 0x30,
-    0x30, 0x60, 0x03, 0x06, 0x18, 0x00, 0x3F, 0xC7, 0x00, 0x00, 0x50, 0xF8, 0x00, 0x00, 0x38, 0x70,
-    0x00, 0x0F, 0x03, 0x00, 0x03, 0xE0, 0x60, 0x00, 0xB7, 0x6C, 0x00, 0x2C, 0x2F, 0x40, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xF5, 0x7C, 0x00, 0x1D, 0x03, 0xC0,
-    0x02, 0xC0, 0xB8, 0x00, 0x1E, 0x3E, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xDF,
-    0x00, 0x41, 0xF4, 0x3C, 0x2D, 0x3F, 0x00, 0xF7, 0xC3, 0xE0, 0x07, 0xF0, 0x3F, 0x96, 0xFE, 0x01,
-    0xFF, 0xFE, 0xB0, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0xBC, 0x7C, 0x3C, 0x3E, 0x00,
-    0x03, 0x80, 0x02, 0xC0, 0x01, 0xC0, 0x00, 0xD0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C,
-    0x00, 0x0E, 0x00, 0x07, 0x40, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x07, 0x00,
-    0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x0F, 0x00,
-    0x01, 0x40, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x34, 0x00, 0x02, 0xC0, 0x00,
-    0x0E, 0x00, 0x00, 0x74, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x00, 0x00,
-    0x70, 0x00, 0x03, 0x40, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38,
-    0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x05, 0x00, 0x00, 0x10, 0x00,
-    0x18, 0x02, 0xC9, 0x38, 0x2F, 0xE0, 0x02, 0xF4, 0x0B, 0x67, 0xC2, 0x28, 0x00, 0x09, 0x00, 0x00,
-    0x20, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x7F, 0xFF, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x2A, 0xAA, 0x1F,
-    0xFF, 0xC0, 0x0A, 0x1E, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x34, 0x30, 0x00, 0xD0, 0x28, 0x03, 0xC0, 0x28,
-    0x07, 0x4D, 0x28, 0x0B, 0x1D, 0x38, 0x0F, 0x1C, 0x74, 0x0E, 0x00, 0xF0, 0x1E, 0x01, 0xE0, 0x1F,
-    0x07, 0xD0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0xED, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x74, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x17,
-    0xE5, 0x7F, 0xFE, 0xBF, 0xFD, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0x90, 0xB4, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0xBE, 0x00,
-    0x0B, 0xF4, 0x00, 0x2F, 0xE5, 0x40, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00,
-    0x90, 0x74, 0x00, 0x00, 0x28, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x16, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x19, 0x6F, 0x80, 0x3F, 0xFF, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0xF7, 0x00,
-    0x3C, 0xB0, 0x0F, 0x0E, 0x03, 0xD1, 0xE4, 0x7F, 0xFF, 0xC1, 0x57, 0xD4, 0x00, 0x7C, 0x00, 0x0B,
-    0x80, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x1C, 0x00, 0x00, 0xD0, 0x00, 0x03,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x55, 0x7C, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x02,
-    0xEB, 0xF4, 0x0F, 0xFF, 0x80, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x1F, 0xFC, 0x00, 0xB4,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x40, 0x00, 0x0B, 0xBF, 0xC0, 0x0F, 0xD1, 0xE0, 0x0F, 0x00, 0xF0,
-    0x1D, 0x00, 0xF0, 0x1D, 0x01, 0xE0, 0x1F, 0x0B, 0xC0, 0x0F, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xE0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x0B,
-    0x80, 0x03, 0xC0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0A, 0x90,
-    0x00, 0xB4, 0x28, 0x00, 0xD0, 0x1C, 0x02, 0xC0, 0x2C, 0x02, 0xC0, 0x74, 0x00, 0xFB, 0xE0, 0x00,
-    0xBF, 0x80, 0x07, 0x81, 0xE0, 0x0E, 0x00, 0xF0, 0x2C, 0x00, 0xF0, 0x3D, 0x02, 0xD0, 0x2F, 0xAF,
-    0x80, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0x4B, 0x40, 0xB0, 0x0E, 0x03, 0x40, 0x3C, 0x1C,
-    0x00, 0xE0, 0xB0, 0x07, 0x81, 0xD0, 0x7D, 0x03, 0xFF, 0xF0, 0x01, 0xA7, 0xC0, 0x00, 0x1D, 0x01,
-    0x01, 0xF0, 0x2F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x07, 0xC0, 0x15, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x1B, 0xC0, 0x06, 0xFF, 0x90, 0xBF, 0xF8, 0x00, 0x3E, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x02, 0xEA, 0xF4, 0x02, 0x00, 0x78, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0x02, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0x51, 0xD0, 0x00, 0x2D, 0x00, 0x0C, 0x00, 0x2C, 0x00,
-    0x02, 0x40, 0x1D, 0x7E, 0x00, 0x90, 0x0E, 0x20, 0xC0, 0x24, 0x07, 0x60, 0x30, 0x0C, 0x03, 0xCC,
-    0x28, 0x0A, 0x00, 0xF3, 0xFE, 0x1F, 0x00, 0x3D, 0x14, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xFD, 0x05, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03,
-    0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80,
-    0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00,
-    0x7D, 0x00, 0xBF, 0xF8, 0x00, 0x3D, 0x57, 0xC0, 0x0E, 0x00, 0x34, 0x07, 0x40, 0x1D, 0x02, 0xC0,
-    0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x3E, 0xAF, 0xC0, 0x1D, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x03, 0xC0,
-    0x07, 0xC1, 0xE0, 0x07, 0xE0, 0xBE, 0xBF, 0xF0, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x01, 0xF8, 0x01, 0xD0, 0x01, 0xF0, 0x0B, 0x00,
-    0x03, 0xD0, 0x3C, 0x00, 0x0F, 0x41, 0xE0, 0x00, 0x3D, 0x0B, 0x40, 0x00, 0xF0, 0x3C, 0x00, 0x0B,
-    0xC0, 0xF0, 0x00, 0xBE, 0x07, 0xEA, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x03, 0xE9, 0x50, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x02, 0xFF,
-    0xFF, 0x00, 0xFE, 0x40, 0x10, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xE2, 0xE0, 0x01, 0x7F, 0x3F, 0x00, 0x03,
-    0x43, 0xF8, 0x01, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0x78, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F,
-    0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x3E,
-    0x40, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x02, 0xD0, 0xF4, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0x8F, 0x80,
-    0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xBF, 0x40, 0x00, 0xF1, 0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03,
-    0xE0, 0xBF, 0x40, 0x3D, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x2D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xAA, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0B,
-    0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0E, 0xFC, 0x0F, 0xBC, 0x02, 0xDF, 0xC2, 0xFB,
-    0x80, 0x3D, 0xBC, 0x7C, 0xF4, 0x03, 0xCB, 0xDF, 0x9F, 0x40, 0x7C, 0x7F, 0xF2, 0xF0, 0x0F, 0x87,
-    0xFD, 0x3F, 0x00, 0xF4, 0x3F, 0x87, 0xE0, 0x1F, 0x43, 0xF0, 0xBE, 0x03, 0xF0, 0x3D, 0x0F, 0xD0,
-    0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0, 0x03, 0xF0,
-    0x02, 0xE0, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E, 0x00, 0x1F,
-    0x7C, 0x0F, 0x40, 0x0B, 0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4, 0xF4, 0x00,
-    0xBC, 0x2E, 0x7C, 0x00, 0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xC0,
-    0x03, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01,
-    0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00,
-    0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B,
-    0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x03, 0xEA, 0xF8, 0x00, 0x74, 0x03, 0xC0,
-    0x0B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x1E, 0x01, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xFE,
-    0x40, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x3E, 0x42, 0xF0, 0x00, 0xF4, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x78, 0x07, 0xC0,
-    0x00, 0x3C, 0x0F, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x01, 0xF0, 0x3E, 0x01, 0x43, 0xD0, 0x3F, 0x47, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0E, 0xAB, 0xC0, 0x07, 0x00, 0xB0, 0x03, 0x80, 0x2C, 0x00,
-    0xD0, 0x1F, 0x00, 0x79, 0x6F, 0x40, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xC0, 0xB4, 0x03,
-    0xE0, 0x1E, 0x00, 0xF4, 0x0B, 0x80, 0x7C, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBE, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xF9, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x94, 0x1B, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0,
-    0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0xB8,
-    0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x3C,
-    0x7C, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x3D, 0x03, 0xC0, 0x0B, 0x80, 0x3C, 0x01,
-    0xF0, 0x03, 0xD0, 0x3E, 0x00, 0x3D, 0x0F, 0xC0, 0x03, 0xE1, 0xF4, 0x00, 0x3E, 0x3E, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00,
-    0xF0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0xF8, 0x0F, 0xD0, 0x3C, 0x03, 0xE0, 0xFF, 0x43, 0xE0, 0x0F,
-    0x4B, 0xFE, 0x1F, 0x00, 0x3D, 0x7D, 0xBC, 0xF8, 0x00, 0xFB, 0xE1, 0xFB, 0xC0, 0x03, 0xFF, 0x07,
-    0xFD, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x3D,
-    0x03, 0xD0, 0x00, 0x07, 0x83, 0xD0, 0x00, 0x00, 0xF3, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00,
-    0x02, 0xF0, 0xFC, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC,
-    0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40,
-    0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x5B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xFA, 0xAA, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2D,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x01, 0x0D, 0x34, 0xE2, 0x8A, 0x2C, 0xB2, 0xCB, 0x2D, 0xB5, 0xD6, 0x10, 0x2A, 0x80,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x03, 0xFE,
-    0x00, 0x02, 0xFF, 0x0A, 0x00, 0x7E, 0x03, 0x46, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80,
-    0xB8, 0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F, 0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0,
-    0x3F, 0xFF, 0x80, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0xFF, 0x03, 0xF9, 0x7C, 0x3E, 0x01, 0xD3, 0xC0, 0x1D, 0x78,
-    0x02, 0xCB, 0x40, 0x78, 0xFE, 0x6F, 0x0F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
-    0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0xCB, 0x00, 0x2F, 0xFB, 0x80,
-    0x2D, 0x0B, 0xD0, 0x1D, 0x01, 0xF0, 0x0B, 0x00, 0x78, 0x03, 0x80, 0x2D, 0x00, 0xE0, 0x1F, 0x00,
-    0x3F, 0xBF, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40,
-    0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A, 0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03, 0x80, 0x00,
-    0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0x00,
-    0x03, 0x40, 0x01, 0xC0, 0x03, 0xFF, 0x40, 0x7D, 0x40, 0x0E, 0x00, 0x07, 0x40, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x4D, 0x01, 0xFB, 0xFC, 0x03,
-    0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0, 0x0C, 0x03, 0xE0, 0x0F, 0xAF,
-    0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10, 0x7F, 0x00, 0x7F, 0xFC, 0x00,
-    0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xD6, 0x90, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0,
-    0x38, 0x07, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0, 0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0,
-    0x3C, 0x02, 0xD0, 0x00, 0x24, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x00,
-    0xE0, 0x03, 0x40, 0x1C, 0x00, 0xA0, 0x03, 0x80, 0x1D, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x1D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00,
-    0x0D, 0x00, 0x00, 0x30, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x6F, 0x80, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00,
-    0xD0, 0x00, 0x2C, 0x28, 0x03, 0xCF, 0x00, 0x3B, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x0E, 0xF8,
-    0x01, 0xD7, 0xD0, 0x3C, 0x3F, 0x03, 0xC1, 0xFC, 0x00, 0x10, 0x01, 0xD0, 0x0B, 0x00, 0x38, 0x01,
-    0xD0, 0x0B, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x00, 0x3F, 0xC0, 0xFF,
-    0x00, 0x00, 0xE7, 0xF0, 0x7E, 0x00, 0x3F, 0xAF, 0xBF, 0xD0, 0x2F, 0x03, 0xF0, 0x38, 0x0F, 0x00,
-    0xB4, 0x0D, 0x07, 0x80, 0x3C, 0x03, 0x42, 0xD0, 0x1D, 0x02, 0xC0, 0xF0, 0x0B, 0x00, 0xF0, 0x78,
-    0x03, 0xC0, 0x38, 0x2D, 0x02, 0xD0, 0x2D, 0x0F, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x01, 0x40, 0x07,
-    0xFF, 0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80, 0x74, 0x2C, 0x03, 0xC0, 0xF0, 0x0F, 0x07,
-    0xC0, 0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0xAB, 0x40, 0xF0, 0x0E,
-    0x07, 0x00, 0x2C, 0x3C, 0x00, 0xE0, 0xE0, 0x03, 0x83, 0x80, 0x2C, 0x0F, 0xAB, 0xE0, 0x2F, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x14, 0xBD, 0x00, 0x03, 0xFE, 0xB4, 0x00, 0x3F, 0x02, 0x80, 0x03,
-    0xC0, 0x2C, 0x00, 0x78, 0x02, 0x80, 0x0B, 0x40, 0x34, 0x00, 0xF8, 0x07, 0x00, 0x1F, 0xE6, 0xE0,
-    0x02, 0xFF, 0xFC, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x14, 0x02, 0xFF, 0x7C, 0x0B,
-    0x42, 0xF4, 0x1D, 0x01, 0xF0, 0x2C, 0x02, 0xE0, 0x34, 0x03, 0xD0, 0x34, 0x0B, 0xC0, 0x3D, 0x7F,
-    0x80, 0x2F, 0xFF, 0x40, 0x0B, 0xE7, 0x00, 0x00, 0x0E, 0x10, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x36, 0xE0, 0x1F, 0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0x95, 0x00,
-    0x28, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x3C, 0x01, 0x96, 0xF0,
-    0x2F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xE0, 0x02, 0xD0, 0x2F, 0xFE,
-    0x03, 0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x2E, 0x00, 0x3F, 0xE0, 0x3F, 0xE0,
-    0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0, 0xF0, 0x0F,
-    0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x03, 0x8B, 0x00, 0x2C, 0x1D, 0x01, 0xC0, 0x38, 0x0E, 0x00, 0xF0, 0xF0, 0x03, 0xCB, 0x00, 0x0B,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x00,
-    0x01, 0xE3, 0xC0, 0x80, 0xF0, 0xF0, 0xF8, 0x78, 0x3C, 0xFF, 0x3C, 0x0F, 0xFF, 0xFD, 0x03, 0xFE,
-    0xFF, 0x00, 0xFD, 0x3F, 0x40, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x78, 0x0B, 0x00, 0x0F, 0x0B, 0x40,
-    0x02, 0xDB, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xBC, 0x00,
-    0x0B, 0x8F, 0x40, 0x0B, 0x82, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xC0, 0x0F, 0x00, 0x74, 0x07,
-    0x40, 0x0E, 0x03, 0xC0, 0x03, 0xC1, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x2E, 0xB4, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xD0,
-    0x00, 0x7F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6A,
-    0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78,
-    0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x00,
-    0xE0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xA4,
-    0x00, 0x00, 0x70, 0x02, 0x80, 0x0D, 0x00, 0x30, 0x01, 0x80, 0x0D, 0x00, 0x30, 0x01, 0xC0, 0x0A,
-    0x00, 0x30, 0x00, 0xC0, 0x0A, 0x00, 0x34, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x40, 0x02, 0xD0, 0x00, 0x7E, 0x00, 0x1F,
-    0x40, 0x0E, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00, 0xF0, 0x0B, 0xF4, 0x02, 0x90, 0x00,
-    0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x01, 0x50, 0x0F, 0xC0, 0x3E, 0x00, 0xF4, 0x00, 0x00,
-    0x0B, 0x00, 0x7C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x1D, 0x00, 0xB0, 0x03,
-    0xC0, 0x0E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xD0, 0x00, 0x30,
-    0x00, 0xBF, 0x01, 0xFE, 0x80, 0xF3, 0x00, 0x74, 0xC0, 0x3C, 0x60, 0x0E, 0x34, 0x03, 0x8C, 0x00,
-    0xFB, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0x00, 0x30, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x02, 0xE4, 0x2C, 0x00, 0x38, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x34, 0x00, 0x00, 0x1B, 0xEA, 0x40, 0x03, 0xFF,
-    0xF4, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xFA, 0x90, 0x03,
-    0xFF, 0xFF, 0x80, 0x02, 0x00, 0x90, 0xBF, 0xFD, 0x07, 0x47, 0x80, 0xE0, 0x38, 0x0E, 0x0F, 0x02,
-    0xFF, 0xF0, 0xBB, 0xEF, 0x41, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x2D, 0x03,
-    0xC0, 0x03, 0xC7, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD4, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x50, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0x80, 0x0D, 0x00, 0x30, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x01, 0xC0, 0x0A, 0x00, 0x34, 0x00, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x39, 0x1C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0x96, 0xF0, 0x01, 0xC0, 0x03, 0x40, 0x2C, 0x00, 0x70, 0x01,
-    0xFE, 0x6F, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0A, 0x0F, 0x43, 0xC3, 0xD2, 0xF0, 0x06,
-    0xA0, 0x19, 0x04, 0x28, 0x04, 0x60, 0x08, 0x6D, 0x14, 0x20, 0x90, 0x05, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x83, 0x05, 0x0C, 0x29, 0xE0, 0x7E, 0x40, 0x00, 0x20, 0x01, 0x00, 0xE0, 0x2C, 0x07, 0x40,
-    0xE0, 0x2C, 0x07, 0x40, 0x3D, 0x0B, 0x80, 0x1F, 0x03, 0xD0, 0x07, 0x00, 0xD0, 0x01, 0x00, 0x40,
-    0x2A, 0x54, 0x1F, 0xFF, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x2A, 0xAA, 0x1F, 0xFF,
-    0xC0, 0x00, 0x50, 0x07, 0x44, 0x18, 0x81, 0x27, 0x81, 0x18, 0x88, 0x18, 0xA0, 0x06, 0x40, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x79, 0x74, 0x34, 0x0E, 0x2C, 0x03,
-    0x4B, 0x43, 0xC1, 0xFF, 0xD0, 0x2F, 0x80, 0x00, 0x02, 0x00, 0x00, 0x28, 0x00, 0x00, 0xD0, 0x02,
-    0xFF, 0xFC, 0x00, 0x28, 0x00, 0x00, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x14, 0x2C, 0x38, 0x3F, 0x80, 0x00, 0x05, 0x00, 0x08, 0x00,
-    0x80, 0xA0, 0x02, 0x40, 0x70, 0xBD, 0x00, 0x07, 0x03, 0x43, 0x80, 0x40, 0x00, 0xE0, 0x0B, 0x00,
-    0x38, 0x03, 0xC0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0x74, 0x03, 0xC0, 0x2C, 0x01, 0xF0, 0x0F, 0x00,
-    0xBC, 0x0B, 0x80, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x0D, 0x7F, 0x6C, 0x03, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x3F, 0x0A, 0x00, 0xFF, 0x0D, 0x01, 0xFD, 0x0C, 0x01,
-    0xFC, 0x1C, 0x00, 0xFC, 0x28, 0x00, 0xB4, 0x34, 0x00, 0xF0, 0x30, 0x01, 0xF0, 0x70, 0x03, 0xD0,
-    0xA0, 0x07, 0xC0, 0xD0, 0x0F, 0xC0, 0xC0, 0x1F, 0x41, 0xC0, 0x3F, 0x02, 0x80, 0x0F, 0x07, 0xC2,
-    0xA0, 0x00, 0x04, 0x01, 0x50, 0x18, 0xB8, 0x00, 0x0A, 0x05, 0x08, 0x0C, 0x18, 0xFE, 0x00, 0x0A,
-    0x43, 0x4C, 0x50, 0xC9, 0x18, 0x7F, 0x00, 0x00, 0x40, 0x14, 0x01, 0xD0, 0x38, 0x01, 0xE0, 0x2D,
-    0x00, 0xB0, 0x1D, 0x03, 0xD0, 0xB8, 0x2E, 0x07, 0xC0, 0xF0, 0x1C, 0x01, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x80, 0x00, 0x40, 0x24, 0x00, 0x24, 0x03, 0x00, 0x0A, 0x00,
-    0x70, 0x01, 0x80, 0x0A, 0x00, 0x70, 0x06, 0xE8, 0x1C, 0x00, 0xFF, 0xC3, 0x02, 0x00, 0x00, 0xD0,
-    0xB0, 0x00, 0x34, 0x2B, 0x00, 0x0E, 0x0A, 0x60, 0x02, 0xC2, 0x8A, 0x00, 0xB0, 0x3F, 0xF4, 0x2C,
-    0x00, 0x1C, 0x02, 0x40, 0x02, 0xC0, 0x02, 0xC0, 0x00, 0x00, 0x1A, 0x00, 0x01, 0x00, 0x24, 0x00,
-    0x24, 0x00, 0xC0, 0x02, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x28, 0x01, 0xC0, 0x06, 0xE8, 0x0E, 0xF8,
-    0x3F, 0xF0, 0xD8, 0x28, 0x00, 0x0D, 0x00, 0xA0, 0x00, 0xE0, 0x03, 0x40, 0x0A, 0x00, 0x3C, 0x00,
-    0xB0, 0x0B, 0xC0, 0x0B, 0x00, 0xF8, 0x00, 0x70, 0x0B, 0xFD, 0x03, 0x40, 0x2A, 0xA0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x01, 0x80, 0x0D, 0x00, 0xF8, 0x00, 0x90, 0x00, 0x34,
-    0x0A, 0x00, 0x00, 0xC0, 0x60, 0x02, 0xAF, 0x07, 0x00, 0x1F, 0xE0, 0x70, 0x20, 0x00, 0x03, 0x42,
-    0xC0, 0x00, 0x34, 0x2B, 0x00, 0x03, 0x82, 0x98, 0x00, 0x38, 0x28, 0xA0, 0x02, 0xC0, 0xEF, 0xD0,
-    0x2C, 0x00, 0x1C, 0x00, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x0B, 0x80, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x7F,
-    0x00, 0x0B, 0xD0, 0x00, 0xB8, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x40,
-    0x00, 0x1E, 0x00, 0x80, 0x3E, 0xAF, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x3C, 0xB0,
-    0x00, 0x0B, 0x4B, 0x40, 0x01, 0xE0, 0x74, 0x00, 0x3C, 0x07, 0x80, 0x0B, 0x80, 0x78, 0x01, 0xF0,
-    0x07, 0xC0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xC1, 0xF4, 0x00, 0x7C, 0x3E, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7A, 0xC0, 0x00, 0x03, 0xCB,
-    0x00, 0x00, 0x2D, 0x2D, 0x00, 0x01, 0xE0, 0x74, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0xB8, 0x07, 0x80,
-    0x07, 0xC0, 0x1F, 0x00, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0xF8,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xA8, 0x00, 0x00,
-    0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x0F, 0x2C, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x07, 0x81, 0xD0,
-    0x00, 0x3C, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x7D, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x00,
-    0x00, 0xC9, 0x60, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x0F, 0x2C,
-    0x00, 0x00, 0xB4, 0xB4, 0x00, 0x07, 0x81, 0xD0, 0x00, 0x3C, 0x07, 0x80, 0x02, 0xE0, 0x1E, 0x00,
-    0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xC0, 0x7D, 0x00, 0x1F, 0x03, 0xE0,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0xA4, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00,
-    0x1E, 0x07, 0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x86, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78,
-    0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40,
-    0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x7F, 0xFD, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x0B,
-    0x80, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3D, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x80, 0xA0, 0x00, 0x3C, 0x2E, 0x00, 0x0B, 0xC3,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x1D, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00,
-    0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x80, 0x03,
-    0xD0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x02,
-    0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x34, 0x00, 0x0B, 0xD0, 0x01, 0xC2, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xA0, 0x64, 0x07, 0xC3, 0xD0, 0x3F, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-    0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x02, 0xF8,
-    0x01, 0xE0, 0x01, 0xF0, 0x0B, 0x40, 0x03, 0xD0, 0x3C, 0x00, 0x0F, 0x5A, 0xFA, 0x80, 0x3D, 0xFF,
-    0xFE, 0x00, 0xF0, 0x3C, 0x00, 0x0B, 0xC0, 0xF0, 0x00, 0xBE, 0x07, 0xEA, 0xBF, 0xF0, 0x2F, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x18, 0x00, 0x00,
-    0x1C, 0xC8, 0x00, 0x00, 0x09, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0F, 0x00,
-    0x0F, 0xC0, 0x07, 0x80, 0x07, 0xF0, 0x03, 0xD0, 0x02, 0xFD, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0xB8,
-    0x00, 0x7D, 0xF0, 0x3D, 0x00, 0x2E, 0x3C, 0x0F, 0x00, 0x0F, 0x4F, 0x0B, 0x80, 0x07, 0xC3, 0xD3,
-    0xD0, 0x02, 0xF0, 0xB9, 0xF0, 0x00, 0xF8, 0x1F, 0xB8, 0x00, 0x7D, 0x03, 0xFD, 0x00, 0x2F, 0x00,
-    0xFF, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x01, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D,
-    0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x20, 0x00,
-    0x00, 0xCC, 0x60, 0x00, 0x01, 0xC3, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07,
-    0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x64, 0x00, 0x01, 0xE0, 0xF4, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02,
-    0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E,
-    0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F,
-    0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xF7, 0x40, 0x0F, 0x00, 0x1F, 0xE0, 0x2E, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xAF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x02, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x2D, 0x02, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x01, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x02, 0xD1, 0xF0,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC,
-    0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F,
-    0x00, 0x0F, 0x40, 0xB8, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x0F,
-    0x80, 0x07, 0xC0, 0x3D, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xF8, 0x0B, 0xC0, 0x03, 0xD0, 0x3E, 0x00,
-    0x1F, 0x00, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x03, 0xD0, 0x2E, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0xB8,
-    0x03, 0xF4, 0x0B, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0xC0, 0x00,
-    0x01, 0xC0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0x40, 0xF4,
-    0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02,
-    0xE0, 0x1F, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40,
-    0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0xE0, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x68, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0x40, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03,
-    0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40,
-    0x78, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xA0,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03,
-    0xD0, 0x2F, 0x0F, 0x40, 0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0xB0, 0xB8, 0x03, 0xC0, 0xB0, 0x0E, 0x00, 0xD0,
-    0x70, 0x0B, 0x02, 0xC1, 0xF4, 0x0F, 0xBF, 0x00, 0x3F, 0x90, 0x01, 0xC0, 0x00, 0x0B, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0xB4, 0x34, 0x01, 0xC0, 0x18, 0x02, 0x80, 0xB4, 0x03,
-    0x43, 0x40, 0x07, 0x09, 0x00, 0x0B, 0x0A, 0x00, 0x0F, 0x07, 0x40, 0x1E, 0x02, 0xD0, 0x2D, 0x00,
-    0xF0, 0x3C, 0x01, 0xE0, 0x3D, 0xFF, 0xC0, 0xB9, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xFF, 0xE0, 0x2E, 0x0B, 0x81, 0xD0, 0x1D,
-    0x0E, 0x00, 0xB0, 0x30, 0x03, 0xC1, 0xC0, 0x2F, 0x07, 0xEB, 0xF8, 0x0F, 0xFF, 0xE0, 0x1F, 0xE7,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x0A, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0xF8, 0x0B, 0x82, 0xE0, 0x74, 0x07, 0x43,
-    0x80, 0x2C, 0x0C, 0x00, 0xF0, 0x70, 0x0B, 0xC1, 0xFA, 0xFE, 0x03, 0xFF, 0xF8, 0x07, 0xF9, 0xD0,
-    0x00, 0x03, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02,
-    0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x1F, 0x0C, 0x00, 0x35, 0x58,
-    0x00, 0x30, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA8, 0x00, 0xE0, 0xB8, 0x03, 0x40, 0x74, 0x0B,
-    0x00, 0xB0, 0x0D, 0x00, 0xF0, 0x1C, 0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9,
-    0xD0, 0x00, 0x28, 0x09, 0x00, 0x7C, 0x2D, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C,
-    0x02, 0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x08,
-    0x80, 0x00, 0x52, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80, 0xB8,
-    0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F, 0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0, 0x3F,
-    0xFF, 0x80, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0xFF,
-    0xFF, 0xD1, 0xC0, 0x2E, 0x0B, 0xE0, 0x0D, 0x07, 0x40, 0x7D, 0x6B, 0xD0, 0xE0, 0x0B, 0xFF, 0xE8,
-    0x0C, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0xAF, 0xFD, 0x06, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF9, 0xEB, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00,
-    0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0,
-    0x08, 0x00, 0x00, 0x80, 0x00, 0x30, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xB4, 0x34, 0x0B,
-    0x00, 0x60, 0x79, 0xAF, 0xC2, 0xFF, 0xE9, 0x0D, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF9, 0x05, 0x02,
-    0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD,
-    0x00, 0x2D, 0x0D, 0x02, 0xC0, 0x18, 0x1E, 0x6B, 0xF0, 0xBF, 0xFA, 0x43, 0x40, 0x00, 0x0E, 0x00,
-    0x00, 0x3E, 0x41, 0x40, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xBD, 0x00,
-    0x07, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x2D, 0x0D, 0x02, 0xC0, 0x18,
-    0x1E, 0x6B, 0xF0, 0xBF, 0xFA, 0x43, 0x40, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x41, 0x40, 0xBF, 0xFD,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x28, 0x19, 0x00, 0x7C, 0x3D, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x02, 0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E,
-    0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF,
-    0x40, 0x07, 0xFE, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x38,
-    0x00, 0xD0, 0x07, 0x00, 0x28, 0x00, 0xE0, 0x07, 0x40, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00,
-    0x02, 0x80, 0x01, 0xC0, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0xA0, 0x00, 0x34, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x00, 0x02, 0x80, 0x00, 0xF8, 0x00, 0xD1, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0xE0, 0x00, 0x34, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x01, 0xD0, 0x00, 0xF0, 0x00, 0x3C,
-    0x00, 0x00, 0x0F, 0x07, 0x87, 0xC3, 0xE2, 0xA0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x38, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x6B,
-    0xEA, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x10, 0x34, 0x00, 0x1F, 0xF1, 0xC0, 0x01, 0xE0, 0xAD, 0x00,
-    0x0E, 0x00, 0xF0, 0x00, 0x70, 0x03, 0x80, 0x02, 0xC0, 0x1C, 0x00, 0x0B, 0x86, 0xD0, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x03, 0x59, 0x80, 0x00, 0xC3,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x2F, 0x07, 0x40, 0x0F, 0x01,
-    0xD0, 0x07, 0x80, 0x74, 0x02, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x7C, 0x07, 0x80, 0x2E, 0x02,
-    0xE0, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xFA, 0xB4, 0x0F, 0x00, 0xE0, 0x70, 0x02,
-    0xC3, 0xC0, 0x0E, 0x0E, 0x00, 0x38, 0x38, 0x02, 0xC0, 0xFA, 0xBE, 0x02, 0xFF, 0xE0, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0D, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3E, 0xAD, 0x03,
-    0xC0, 0x38, 0x1C, 0x00, 0xB0, 0xF0, 0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0xB0, 0x3E, 0xAF, 0x80,
-    0xBF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xBD, 0x00, 0x06, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x3E, 0xAD, 0x03, 0xC0, 0x38, 0x1C, 0x00, 0xB0, 0xF0,
-    0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0xB0, 0x3E, 0xAF, 0x80, 0xBF, 0xF8, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x1D, 0x08, 0x00, 0xCC, 0x60, 0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0xFA, 0xB4, 0x0F, 0x00, 0xE0, 0x70, 0x02, 0xC3, 0xC0, 0x0E, 0x0E, 0x00,
-    0x38, 0x38, 0x02, 0xC0, 0xFA, 0xBE, 0x02, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x28, 0x19, 0x00,
-    0x78, 0x3D, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x03, 0xEA, 0xD0, 0x0F, 0x00, 0xE0, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0,
-    0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0xF4, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xBF, 0x40,
-    0x00, 0x3C, 0x37, 0xC0, 0x00, 0x70, 0xB2, 0xC0, 0x00, 0xF0, 0xD3, 0xC0, 0x00, 0xE2, 0xC3, 0x80,
-    0x00, 0xD7, 0x4B, 0x00, 0x00, 0xFF, 0xBE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x38, 0x02, 0xC0, 0xE0, 0x0F, 0x03, 0x40, 0x38, 0x1C, 0x01, 0xD0, 0xB0, 0x0B, 0x03,
-    0xC0, 0x3C, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80, 0xFF, 0xFD, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x28, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C,
-    0x02, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00,
-    0x00, 0x34, 0x00, 0x02, 0xF8, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03,
-    0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF,
-    0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0xA0, 0x24, 0x07, 0xC2, 0xD0, 0x2F, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xC0, 0xE0, 0x0F, 0x03, 0x40, 0x38, 0x1C, 0x01, 0xD0,
-    0xB0, 0x0B, 0x03, 0xC0, 0x3C, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80, 0xFF, 0xFD, 0x01, 0xFD, 0xB0,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x03, 0xC0, 0x1D, 0x01, 0xD0, 0x03, 0x80, 0xF0, 0x00, 0xF0, 0x74, 0x00, 0x3C, 0x3C, 0x00, 0x0B,
-    0xAD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x4F, 0x00,
-    0x1C, 0x0E, 0x00, 0xA0, 0x28, 0x03, 0x40, 0xD0, 0x0C, 0x07, 0x00, 0x70, 0x74, 0x02, 0x8B, 0x80,
-    0x0F, 0xF4, 0x00, 0x34, 0x00, 0x01, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x07, 0x80, 0x07, 0xC2, 0xE0, 0x02, 0xA0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00, 0x3C,
-    0x1D, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0xEB, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B,
-    0x4B, 0x40, 0x00, 0x1E, 0x07, 0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0,
-    0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF,
-    0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02, 0xF0,
-    0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x0C, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07,
-    0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x20, 0x04,
-    0x00, 0x34, 0x1C, 0x00, 0x3F, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0xFF, 0xF8, 0x02, 0xE0, 0xB8, 0x07, 0x40, 0x74, 0x0E, 0x00, 0xB0, 0x0C, 0x00, 0xF0, 0x1C, 0x02,
-    0xF0, 0x1F, 0xAF, 0xE0, 0x0F, 0xFF, 0xE0, 0x07, 0xF9, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00,
-    0x1E, 0x07, 0x40, 0x03, 0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80, 0xB8, 0x2E, 0x07, 0x40, 0x74, 0x38, 0x02, 0xC0, 0xC0, 0x0F,
-    0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0xAD, 0x00, 0x02, 0x80, 0x00, 0x0C,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xEB, 0xC0, 0x2F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x38,
-    0x00, 0x0B, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x60, 0x0F,
-    0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0xF8,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0D,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xFA, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x02,
-    0xEC, 0x00, 0x18, 0x08, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7E, 0x60, 0x03, 0xC0, 0x00, 0x1D,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0,
-    0x00, 0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x24, 0x00, 0x01, 0xEC, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xEB, 0xC0,
-    0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x50, 0x0E, 0x74, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x7E, 0x60, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0xD0,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0A,
-    0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x1F, 0x80, 0x1D,
-    0x00, 0x1F, 0x00, 0xB0, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0xF4, 0x1E, 0x00, 0x03, 0xD0, 0xB4, 0x00,
-    0x0F, 0x03, 0xC0, 0x00, 0xBC, 0x0F, 0x00, 0x0B, 0xE0, 0x7E, 0xAB, 0xFF, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x07, 0x08,
-    0x00, 0x00, 0x0B, 0x1C, 0x00, 0x00, 0x0D, 0x2C, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x6F, 0x2C, 0x10,
-    0x02, 0xFF, 0xB8, 0x00, 0x0B, 0x42, 0xF4, 0x00, 0x1D, 0x01, 0xF0, 0x00, 0x2C, 0x01, 0xE0, 0x00,
-    0x38, 0x02, 0xD0, 0x00, 0x38, 0x07, 0xC0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x0B, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x3C, 0x02, 0xF8, 0x01, 0xE0, 0x01, 0xF0, 0x0B, 0x40, 0x03, 0xD0, 0x3C,
-    0x00, 0x0F, 0x5A, 0xFA, 0x80, 0x3D, 0xFF, 0xFE, 0x00, 0xF0, 0x3C, 0x00, 0x0B, 0xC0, 0xF0, 0x00,
-    0xBE, 0x07, 0xEA, 0xBF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x2A, 0xFA, 0x40, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x1C, 0x00, 0x01, 0xBC, 0xB0, 0x00, 0x2F, 0xFB, 0x80, 0x02, 0xD0, 0xBD, 0x00, 0x1D,
-    0x01, 0xF0, 0x00, 0xB0, 0x07, 0x80, 0x03, 0x80, 0x2D, 0x00, 0x0E, 0x01, 0xF0, 0x00, 0x3F, 0xBF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x40, 0x02, 0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x30, 0x0D, 0x00, 0x03, 0xEB, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x20, 0x08, 0x00, 0x74, 0x1C, 0x00, 0x3F, 0xF0,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x02,
-    0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE, 0x90, 0x34, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xE4, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF4, 0x00, 0xB4, 0x34, 0x0B, 0x00, 0x60, 0x79, 0xAF, 0xC2, 0xFF, 0xE9, 0x0D, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0xF9, 0x05, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x0C, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x40, 0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A, 0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03,
-    0x80, 0x00, 0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00,
-    0x0C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x24,
-    0x00, 0x01, 0xEC, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x60, 0x24, 0x00, 0xBB, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x02, 0xD0, 0xD0, 0x2C, 0x01, 0x81, 0xE6,
-    0xBF, 0x0B, 0xFF, 0xA4, 0x34, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xE4, 0x14, 0x0B, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xE4, 0x01, 0x00, 0xBC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x5F, 0xC3, 0xF0, 0x00, 0x34, 0x0F, 0xE0, 0x07, 0xD0, 0x2F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xD0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0x40, 0x1F, 0xBF,
-    0xC0, 0x0E, 0x03, 0xF0, 0x07, 0x00, 0xF8, 0x03, 0x80, 0x3D, 0x00, 0xC0, 0x0F, 0x00, 0x30, 0x0F,
-    0x80, 0x0F, 0xAF, 0xD0, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x10, 0x7F,
-    0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x03, 0x00, 0xC0, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x40, 0x10, 0x0B, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x07, 0xFE, 0x0B, 0x80, 0x05, 0xFC, 0x3F, 0x00, 0x03, 0x40, 0xFE, 0x00, 0x7D, 0x02, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x24, 0x01, 0x00, 0x28, 0x1D,
-    0x00, 0x1F, 0xF8, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4D, 0x01,
-    0xFB, 0xFC, 0x03, 0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0, 0x0C, 0x03,
-    0xE0, 0x0F, 0xAF, 0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10, 0x7F, 0x00,
-    0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x2F,
-    0xFF, 0xF0, 0x0F, 0xE4, 0x01, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFE, 0x2E, 0x00, 0x17, 0xF3, 0xF0, 0x00,
-    0x34, 0x3F, 0x80, 0x1F, 0x42, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x4D, 0x01, 0xFB, 0xFC, 0x03, 0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0,
-    0x0C, 0x03, 0xE0, 0x0F, 0xAF, 0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10,
-    0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x02,
-    0xFF, 0xFF, 0x00, 0xFE, 0x40, 0x10, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xE2, 0xE0, 0x01, 0x7F, 0x3F, 0x00,
-    0x03, 0x43, 0xF8, 0x01, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x4D, 0x01, 0xFB, 0xFC, 0x03, 0x80, 0xFC, 0x07, 0x00, 0xF8, 0x0E, 0x00, 0xF4, 0x0C, 0x00, 0xF0,
-    0x0C, 0x03, 0xE0, 0x0F, 0xAF, 0xD0, 0x0F, 0xFF, 0xC0, 0x02, 0xFB, 0x80, 0x00, 0x0F, 0x40, 0x10,
-    0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x00,
-    0x78, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x01,
-    0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x0D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x70, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0xD6, 0x90, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0, 0x38, 0x07, 0x40,
-    0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0, 0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0, 0x3C, 0x02, 0xD0,
-    0x00, 0x24, 0x00, 0x18, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C,
-    0x01, 0xF0, 0x00, 0xB8, 0x0B, 0xFF, 0xFF, 0xFC, 0x07, 0xEA, 0xAA, 0xF4, 0x03, 0xD0, 0x02, 0xF0,
-    0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x0F, 0xC0,
-    0x2F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x2C, 0x00, 0x00,
-    0x39, 0x50, 0x01, 0xFF, 0xA0, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xDA, 0x90, 0x02, 0xFF,
-    0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0,
-    0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0, 0x3C, 0x02, 0xD0, 0x00, 0x78, 0x30, 0x0C, 0x96, 0x01, 0x83,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00,
-    0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8,
-    0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x82,
-    0x02, 0x98, 0xC0, 0xC2, 0xD0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x0D, 0x00,
-    0x03, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x50, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00,
-    0x74, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F,
-    0x80, 0x1F, 0x40, 0x2F, 0x40, 0x24, 0x00, 0x60, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xB0, 0x00, 0xE0, 0x00, 0xC0, 0x01,
-    0xC0, 0x02, 0x80, 0x03, 0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x18, 0x00, 0x30, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x03, 0x80, 0x34, 0x07, 0x00, 0xA0, 0x0E, 0x01, 0xD0, 0x3C,
-    0x03, 0xC0, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x80, 0x3C, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xF8,
-    0x01, 0xF0, 0x0F, 0x00, 0x2E, 0x01, 0xF0, 0x03, 0xD0, 0x2E, 0x00, 0x3C, 0x03, 0xD0, 0x07, 0xC0,
-    0x3C, 0x00, 0xB8, 0x0B, 0x80, 0x0F, 0x80, 0xF4, 0x00, 0xF4, 0x0F, 0x00, 0x1F, 0x01, 0xF0, 0x03,
-    0xF0, 0x2D, 0x00, 0x3F, 0x03, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x1E, 0x00, 0xF4, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x70, 0x03, 0x80, 0x00, 0xB0, 0x03, 0x40, 0x00, 0xE0, 0x07, 0x00, 0x01, 0xC0, 0x0A, 0x00, 0x02,
-    0xC0, 0x0E, 0x00, 0x03, 0x80, 0x1D, 0x00, 0x03, 0x40, 0x3C, 0x00, 0x07, 0x00, 0x3C, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xC1, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xEE,
-    0x00, 0x00, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB0,
-    0x00, 0x01, 0xBE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xC0,
-    0x02, 0xD0, 0xF4, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0x8F, 0x80, 0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x7C,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B,
-    0xBF, 0x40, 0x00, 0xF1, 0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03, 0xE0, 0xBF, 0x40, 0x3D, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00,
-    0x00, 0xD0, 0x00, 0x2C, 0x28, 0x03, 0xCF, 0x00, 0x3B, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x0E,
-    0xF8, 0x01, 0xD7, 0xD0, 0x3C, 0x3F, 0x03, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x00, 0x50, 0x00, 0x03, 0x0A, 0x07,
-    0x2C, 0x0A, 0xB0, 0x0E, 0xC0, 0x1F, 0x00, 0x3F, 0x40, 0x3B, 0xC0, 0x72, 0xE0, 0xE1, 0xF4, 0x00,
-    0x01, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB4, 0x00,
-    0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7E, 0xAB,
-    0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x80, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00, 0x0E, 0x00, 0x01,
-    0xD0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00,
-    0x02, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80,
-    0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
-    0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xAA, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07,
-    0xC0, 0x00, 0x29, 0x00, 0x00, 0x00, 0x10, 0x01, 0xD0, 0x0B, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x00,
-    0x38, 0x01, 0xD0, 0x0B, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x3F, 0x00, 0xF0, 0x0F, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x0C, 0x01, 0xF0, 0x2C, 0x02, 0xD0, 0x34, 0x03,
-    0xC0, 0x20, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xAA,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x34, 0x00, 0xD1, 0xC0, 0x0B, 0x0E, 0x00,
-    0x38, 0x24, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x38, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00,
-    0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0xF0, 0x3D, 0x02, 0xE0, 0x68,
-    0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F,
-    0xAA, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x07, 0x40, 0x00, 0xB0, 0x00,
-    0x0E, 0x00, 0x01, 0xD1, 0xD0, 0x2C, 0x3D, 0x03, 0x86, 0x80, 0x74, 0x00, 0x0B, 0x00, 0x00, 0xF0,
-    0x00, 0x1E, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0F,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x78, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFA, 0xAF,
-    0x00, 0x00, 0x07, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x74, 0x04, 0x00, 0x05, 0xFA, 0x94, 0x1B, 0xE9, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xB8, 0x00, 0x7F,
-    0x40, 0x3D, 0x00, 0x2F, 0xD0, 0x0F, 0x00, 0x0F, 0xF8, 0x0B, 0x80, 0x07, 0xDF, 0x03, 0xD0, 0x02,
-    0xE3, 0xC1, 0xF0, 0x00, 0xF4, 0xF4, 0xB8, 0x00, 0x7C, 0x3D, 0x3D, 0x00, 0x2F, 0x0B, 0x9F, 0x00,
-    0x0F, 0x81, 0xFB, 0x80, 0x07, 0xD0, 0x3F, 0xD0, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xF0, 0x02, 0xF0, 0x74, 0x03, 0xC0, 0x74, 0x07,
-    0x80, 0x74, 0x0B, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x1F, 0x01, 0xE0, 0x2E, 0x02, 0xE0, 0x3D, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x00, 0xFC,
-    0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E, 0x00, 0x1F, 0x7C, 0x0F, 0x40, 0x0B,
-    0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4, 0xF4, 0x00, 0xBC, 0x2E, 0x7C, 0x00,
-    0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0xFF,
-    0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80, 0x74, 0x2C, 0x03, 0xC0, 0xF0, 0x0F, 0x07, 0xC0,
-    0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xF0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x1C, 0x74, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xB8, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x2F, 0xD0,
-    0x0F, 0x00, 0x0F, 0xF8, 0x0B, 0x80, 0x07, 0xDF, 0x03, 0xD0, 0x02, 0xE3, 0xC0, 0xF0, 0x00, 0xF4,
-    0xF0, 0xB8, 0x00, 0x7C, 0x3D, 0x3D, 0x00, 0x2F, 0x0B, 0x9F, 0x00, 0x0F, 0x81, 0xFB, 0x80, 0x07,
-    0xD0, 0x3F, 0xD0, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x18, 0x05, 0x00,
-    0x0A, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x01, 0xFF, 0xF0, 0x02, 0xF0, 0x74, 0x03, 0xC0, 0x74, 0x07, 0x80, 0x74, 0x0B, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x1F, 0x01, 0xE0, 0x2E, 0x02, 0xE0, 0x3D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0xF8, 0x2C, 0x00, 0xE0, 0x1C,
-    0x02, 0xD0, 0x2C, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0x78, 0x0B, 0x80, 0xB8, 0x0F, 0x40, 0xF4, 0x1F,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x00,
-    0xFC, 0x00, 0xF4, 0x00, 0xBF, 0x40, 0x3C, 0x00, 0x3F, 0xE0, 0x2E, 0x00, 0x1F, 0x7C, 0x0F, 0x40,
-    0x0B, 0x8F, 0x03, 0xC0, 0x03, 0xD3, 0xC2, 0xE0, 0x01, 0xF0, 0xF4, 0xF4, 0x00, 0xBC, 0x2E, 0x7C,
-    0x00, 0x3E, 0x07, 0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x07, 0xFF, 0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80,
-    0x74, 0x2C, 0x03, 0xC0, 0xF0, 0x0F, 0x07, 0xC0, 0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F,
-    0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40,
-    0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFC, 0x00, 0xA5, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xEA, 0xD0, 0x0F,
-    0x00, 0xE0, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF,
-    0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0x80, 0x20, 0x00, 0x01, 0xC0, 0xA0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00, 0xB8, 0x07,
-    0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0xB4, 0x2D,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF, 0x80, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x3E, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xEA, 0xD0, 0x0F, 0x00, 0xE0,
-    0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F,
-    0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x01, 0x50,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x02,
-    0xFA, 0xBE, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0x2F, 0x00,
-    0xB4, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0xB4, 0x0B, 0x40, 0x00, 0x3C,
-    0x02, 0xD0, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x2F, 0xEA, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x38, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xEA, 0xD0, 0x00, 0xF0,
-    0x0E, 0x00, 0x1C, 0x00, 0xB0, 0x03, 0xC0, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x2C, 0x00,
-    0x3E, 0xAF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x6B, 0xFF,
-    0xD0, 0x02, 0xFA, 0xBF, 0xFF, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x02, 0xFF,
-    0xF0, 0x01, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x2D, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE4, 0x1F, 0xD0, 0x03, 0xEA, 0xDF, 0x43, 0x40, 0xF0, 0x0F, 0xC0, 0x18,
-    0x1C, 0x00, 0xBA, 0xBF, 0x83, 0xC0, 0x0F, 0xFE, 0xA4, 0x38, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x2E,
-    0x00, 0x00, 0x3E, 0xAF, 0xF9, 0x05, 0x02, 0xFF, 0xEB, 0xFF, 0xD0, 0x0B, 0xE4, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xEA, 0xBC, 0x00, 0x70, 0x0B, 0x00, 0x38, 0x02,
-    0xC0, 0x0D, 0x01, 0xF0, 0x07, 0x96, 0xF4, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x7C, 0x0B,
-    0x40, 0x3E, 0x01, 0xE0, 0x0F, 0x40, 0xB8, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0B,
-    0xE0, 0x00, 0x03, 0x40, 0x02, 0x80, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x36, 0xE0, 0x1F,
-    0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0E, 0xAB, 0xC0, 0x07, 0x00, 0xB0, 0x03, 0x80, 0x2C, 0x00, 0xD0,
-    0x1F, 0x00, 0x79, 0x6F, 0x40, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xC0, 0xB4, 0x03, 0xE0,
-    0x1E, 0x00, 0xF4, 0x0B, 0x80, 0x7C, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6E, 0x00, 0x7F,
-    0xE0, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xFC,
-    0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x80,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0xEA, 0xBC, 0x00, 0x70, 0x0B, 0x00, 0x38, 0x02, 0xC0, 0x0D, 0x01, 0xF0, 0x07, 0x96, 0xF4,
-    0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x7C, 0x0B, 0x40, 0x3E, 0x01, 0xE0, 0x0F, 0x40, 0xB8,
-    0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0B, 0xE0, 0x05, 0x01, 0x40, 0xA3, 0x40, 0x0F,
-    0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x36, 0xE0, 0x1F, 0xF8, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xE0,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0x90, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x06, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x09, 0x41, 0xBF, 0xC0, 0xBF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x0B, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x39, 0x50, 0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x1B, 0xE0, 0x00, 0x03,
-    0xC0, 0x19, 0x6F, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, 0x30, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x6F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0x50, 0x6F, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x3E, 0x00, 0x03, 0x46, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0E, 0x54,
-    0x00, 0xA0, 0x00, 0x02, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF0, 0x06, 0x5B,
-    0xC0, 0xBF, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x01,
-    0xF9, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x94, 0x1B, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x03, 0x95, 0x00, 0x28, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x3C, 0x01, 0x96, 0xF0, 0x2F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x08, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x20, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0x40, 0x00, 0x03,
-    0xB0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x7E, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x25, 0x06, 0xFF, 0x02, 0xFF, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50,
-    0x02, 0xDD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x39, 0x50, 0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x1B, 0xE0, 0x00, 0x03,
-    0xC0, 0x19, 0x6F, 0x02, 0xFF, 0xF8, 0x07, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xE0, 0x02, 0xD0, 0x2F, 0xFE, 0x03,
-    0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x2E, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x09,
-    0x00, 0x00, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0D,
-    0x00, 0xB1, 0xC0, 0x0E, 0x14, 0x02, 0xD0, 0x02, 0xFF, 0xE0, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x1D, 0x00, 0x02, 0xE0, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x0A, 0xFE, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x0B, 0xFF, 0x80, 0x38, 0x02, 0xBF, 0xA2, 0xFF,
-    0xFC, 0x03, 0x80, 0x01, 0xD0, 0x00, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xA0,
-    0x80, 0x00, 0x09, 0x53, 0x00, 0x00, 0x30, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x01, 0x40, 0x2F, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0, 0x1F,
-    0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3D, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x00, 0x0B, 0x80, 0x7C, 0x00,
-    0x3D, 0x02, 0xE0, 0x00, 0xF0, 0x0B, 0x80, 0x0B, 0x80, 0x3F, 0x40, 0xBD, 0x00, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x03,
-    0x25, 0x80, 0x08, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xC0, 0xE0, 0x0F, 0x03,
-    0x40, 0x38, 0x1C, 0x01, 0xD0, 0xB0, 0x0B, 0x03, 0xC0, 0x3C, 0x0F, 0x02, 0xE0, 0x3F, 0xFF, 0x80,
-    0xFF, 0xFD, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x3F, 0x00, 0x1F,
-    0x40, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03,
-    0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x3C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0,
-    0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38,
-    0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x02, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x6C, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x0D, 0x07, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x00, 0xBC, 0x00, 0x3E, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00,
-    0x3E, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0xF4,
-    0x0B, 0x80, 0x03, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xFD, 0x02, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x03, 0x41,
-    0xC0, 0x0F, 0xFC, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x03, 0x80,
-    0x3C, 0x0D, 0x00, 0xE0, 0x70, 0x07, 0x42, 0xC0, 0x2C, 0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x80, 0xFF,
-    0xFE, 0x03, 0xFF, 0xF4, 0x07, 0xF6, 0xC0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
-    0x02, 0x20, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x3E, 0x03, 0xF0, 0x01, 0xF4, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x3E,
-    0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0xF4, 0x07,
-    0x80, 0x03, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xFD, 0x02, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x53, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x03, 0x80, 0x3C,
-    0x0D, 0x00, 0xE0, 0x70, 0x07, 0x42, 0xC0, 0x2C, 0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x80, 0xFF, 0xFE,
-    0x03, 0xFF, 0xF4, 0x07, 0xF6, 0xC0, 0x00, 0x02, 0x40, 0x09, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x28,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0xF8, 0x03, 0xE0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xC0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x0F, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x0F, 0x40, 0x2E, 0x00,
-    0x0F, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x0B, 0x01, 0xE0, 0x0B,
-    0x40, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x2C, 0x00, 0xE0, 0x0F,
-    0x00, 0x34, 0x03, 0x80, 0x1C, 0x01, 0xD0, 0x0B, 0x00, 0xB0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x2E,
-    0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x01, 0xFD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xBC, 0x07, 0xC0, 0x03, 0xE0, 0x2F, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x3C,
-    0x02, 0xE0, 0x02, 0xE0, 0x0F, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0xB0, 0x38, 0x03, 0xC0, 0xD0, 0x0E, 0x07, 0x00, 0x74, 0x2C, 0x03,
-    0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0xB8, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x40, 0x7F, 0x7C, 0x00, 0x03,
-    0x80, 0x00, 0x28, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x80,
-    0x00, 0x00, 0xF0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0xF8, 0x0F, 0xD0, 0x3C, 0x03, 0xE0, 0xFF, 0x43,
-    0xE0, 0x0F, 0x4B, 0xFE, 0x1F, 0x00, 0x3D, 0x7D, 0xBC, 0xF8, 0x00, 0xFB, 0xE1, 0xFB, 0xC0, 0x03,
-    0xFF, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x3C, 0x00, 0x03, 0xCF, 0x00, 0x02, 0xD3, 0xC0, 0xC0, 0xF0, 0xF0, 0xF8, 0xB4,
-    0x3C, 0xFF, 0x3C, 0x0F, 0xFF, 0xFD, 0x03, 0xFE, 0xFF, 0x00, 0xFD, 0x3F, 0x40, 0x3E, 0x0B, 0xC0,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xD1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40, 0x1F,
-    0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xBB, 0x00, 0x00, 0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00, 0x3C, 0x1D, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0xEB,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x28, 0x00, 0xF0, 0x7C, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40,
-    0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x05, 0x55,
-    0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x15,
-    0x56, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0xAA, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x40, 0x10, 0x00, 0x00, 0x28, 0x60, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x05, 0x55, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x20, 0x08, 0x00, 0x0D, 0xA0, 0x00, 0x07, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x6A, 0xBD, 0x00, 0x00, 0xF4, 0x00, 0x03,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0x40, 0x03, 0x80, 0x02, 0xC0, 0x00, 0xF0,
-    0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x3C, 0x00,
-    0x1F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0xF0, 0x07, 0x03, 0x43, 0x80, 0x40, 0x03, 0x00, 0x0F, 0xD0,
-    0x28, 0x28, 0x00, 0x00, 0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x0D, 0x3E, 0xB8,
-    0x0F, 0xD0, 0x19, 0x3D, 0x7C, 0x09, 0x0A, 0x0F, 0x43, 0xC3, 0xD2, 0xF0, 0x64, 0x49, 0x28, 0x10,
-    0x0A, 0x08, 0x12, 0x24, 0xB8, 0x02, 0x40, 0x08, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xE0, 0x00, 0x00,
-    0x34, 0x24, 0x0F, 0xC0, 0x0B, 0x00, 0x60, 0x01, 0x40, 0x3C, 0x00, 0xE0, 0x1E, 0x00, 0x78, 0x14,
-    0x02, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xE0, 0x03, 0xE0, 0xBC, 0x0F, 0x81, 0xF0, 0x29, 0x00, 0x7D,
-    0x02, 0xF0, 0x0F, 0x00, 0xBC, 0x02, 0x80, 0x00, 0x09, 0x7C, 0x0C, 0x00, 0x00, 0x60, 0x3D, 0x20,
-    0x00, 0x3F, 0xA8, 0x15, 0x7C, 0x00, 0x38, 0x00, 0x34, 0x04, 0x32, 0x64, 0x21, 0x42, 0x00, 0x00,
-    0x20, 0xB4, 0x19, 0x00, 0xE4, 0x29, 0x24, 0x00, 0x08, 0x69, 0x10, 0x00, 0x15, 0x7F, 0xFE, 0x00,
-    0x00, 0x28, 0x3C, 0xBC, 0x0A, 0x06, 0x47, 0xC3, 0xD3, 0xE1, 0xF4, 0x0A, 0x08, 0x12, 0x24, 0xB8,
-    0x01, 0x40, 0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x00, 0x04, 0x01, 0x50, 0x18, 0xB8, 0x00,
-    0x05, 0x0A, 0x03, 0x00, 0xB4, 0x00, 0x00, 0x0E, 0x0D, 0x2C, 0x3C, 0x10, 0x3F, 0xE7, 0x09, 0x50,
-    0x80, 0x60, 0x20, 0xAA, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1E, 0xC0, 0x30, 0x24,
-    0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00, 0x2A, 0xAA, 0x1F, 0xFF, 0xC0, 0x20,
-    0x12, 0x40, 0x50, 0x86, 0x0D, 0x3F, 0xE0, 0x00, 0x2A, 0x92, 0x05, 0x50, 0x8B, 0xFC, 0x1A, 0x52,
-    0x22, 0x51, 0x50, 0x00, 0x00, 0x02, 0x80, 0xD0, 0x8C, 0x1D, 0x08, 0xCC, 0x96, 0x1F, 0x00, 0x00,
-    0x24, 0x08, 0x20, 0x00, 0x00, 0x00, 0x02, 0x40, 0x01, 0xC0, 0x01, 0xD0, 0x00, 0x00, 0x02, 0x42,
-    0x83, 0xD0, 0xF0, 0xF4, 0xBC, 0x7F, 0xDA, 0x0C, 0x40, 0x80, 0x00, 0x05, 0x40, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x01, 0x50, 0x00, 0x2C, 0x1C, 0x38, 0x38, 0x74, 0x34, 0xB0,
-    0xB0, 0x50, 0x50, 0x15, 0x47, 0xFC, 0x03, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-    0x10, 0x1D, 0x28, 0x33, 0xA4, 0x62, 0xF0, 0x02, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xBF, 0x80, 0x1E, 0x0B, 0xC1, 0xE0, 0x7C, 0x1F,
-    0x00, 0x7F, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x09, 0x0F, 0x0D, 0x1C, 0x09, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x20, 0x3C, 0x34, 0xB0,
-    0x20, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x09, 0x00, 0x20, 0x80, 0x00, 0x40, 0x00, 0x00, 0x42, 0x00, 0x00, 0x64, 0x06, 0xAA, 0xA4, 0x00,
-    0x02, 0xAA, 0xA4, 0x01, 0x40, 0x00, 0x28, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x03, 0xD5, 0x54, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x0E, 0x55, 0x40, 0x1C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3E, 0xAA, 0x40, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFF, 0x40, 0x00, 0x18, 0x08, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x03, 0xD5, 0x54, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x0E, 0x55, 0x40, 0x1C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3E, 0xAA, 0x40, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x2F, 0xFF, 0xFF, 0x00, 0x74, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xF5, 0x78, 0x03, 0xC0, 0x2C, 0x07,
-    0x40, 0x1C, 0x0B, 0x00, 0x2C, 0x0F, 0x00, 0x38, 0x0E, 0x02, 0xF0, 0x2D, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x02, 0xD5, 0x54, 0x03, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0x47,
-    0xC0, 0x2D, 0x00, 0x38, 0x1E, 0x00, 0x0A, 0x0F, 0x00, 0x00, 0x03, 0xEA, 0xA0, 0x02, 0xFF, 0xFC,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xD0, 0x6F, 0x83, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xD0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0,
-    0x01, 0xF9, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x94, 0x1B, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFC, 0x01, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0,
-    0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0xA0, 0x60, 0x0B, 0x83, 0xC0, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80,
-    0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80,
-    0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0x00,
-    0x34, 0x00, 0x01, 0xC0, 0x1C, 0x00, 0x00, 0xA0, 0x0B, 0x00, 0x00, 0x34, 0x03, 0x80, 0x00, 0x1C,
-    0x00, 0xFF, 0xE0, 0x0A, 0x00, 0xB0, 0x0E, 0x03, 0x40, 0x3C, 0x02, 0x81, 0xC0, 0x0E, 0x00, 0xE0,
-    0xA0, 0x07, 0x42, 0xF4, 0x74, 0x02, 0xFF, 0xF8, 0xBC, 0x00, 0xFF, 0xF4, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x80, 0x00, 0x34, 0x00, 0xA0, 0x00, 0x1C, 0x00,
-    0x34, 0x00, 0x0A, 0x00, 0x1C, 0x00, 0x03, 0x95, 0x5F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xB0,
-    0x00, 0xD0, 0x2C, 0x38, 0x00, 0x70, 0x07, 0x0D, 0x00, 0x3C, 0x02, 0xC7, 0x00, 0x0E, 0x07, 0xE2,
-    0xC0, 0x07, 0xFF, 0xF0, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03,
-    0xEF, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xC0, 0xB0, 0x00, 0xF0, 0x0B, 0x00, 0x1F, 0x00, 0xB0,
-    0x03, 0xE0, 0x0E, 0x00, 0x3D, 0x01, 0xD0, 0x07, 0xC0, 0x3C, 0x00, 0xFC, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x7C, 0x00, 0x0B, 0x43, 0xD0, 0x00, 0x3C, 0x3D, 0x00,
-    0x01, 0xE3, 0xE0, 0x00, 0x0B, 0x6F, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xBF, 0x40, 0x00, 0x3C, 0x7F,
-    0x00, 0x01, 0xF0, 0xFF, 0x00, 0x0F, 0x82, 0xFD, 0x00, 0x3D, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x68,
-    0x03, 0xD0, 0x07, 0xE0, 0x0F, 0x00, 0x3F, 0x40, 0x78, 0x03, 0xFC, 0x02, 0xD0, 0x2F, 0xF0, 0x0F,
-    0x02, 0xEB, 0x80, 0x7C, 0x1F, 0x3D, 0x02, 0xE0, 0xF1, 0xF0, 0x0F, 0x4F, 0x4B, 0xC0, 0x3C, 0xF4,
-    0x3E, 0x01, 0xFB, 0x81, 0xF4, 0x0F, 0xFC, 0x0F, 0xC0, 0x3F, 0xC0, 0x3F, 0x01, 0xFC, 0x02, 0xF4,
-    0x00, 0x00, 0x14, 0x02, 0x00, 0x07, 0x02, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x34, 0x03, 0xC0, 0x3C, 0x00, 0xB0, 0x1D, 0x00, 0x1D,
-    0x0F, 0x00, 0x03, 0xC7, 0x40, 0x00, 0xF3, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xF9,
-    0x00, 0x00, 0x01, 0x80, 0x02, 0x40, 0xF0, 0x01, 0xD0, 0x38, 0x00, 0xB0, 0x1D, 0x00, 0x38, 0x0B,
-    0x00, 0x1D, 0x03, 0xC0, 0x0B, 0x00, 0xE0, 0x03, 0xC0, 0x74, 0x00, 0xE0, 0x2C, 0x00, 0x74, 0x0F,
-    0x00, 0x2C, 0x07, 0xEA, 0xAF, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xD0, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x1E, 0xB0, 0x00, 0x03, 0xCB, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x1E, 0x07, 0x40, 0x03,
-    0xC0, 0x78, 0x00, 0xB8, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC,
-    0x1F, 0x40, 0x07, 0xC3, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x03, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x0F, 0x00, 0xD0, 0x0E,
-    0x00, 0xA0, 0x1D, 0x00, 0xE0, 0x2E, 0x5B, 0xC0, 0x3F, 0xFF, 0x40, 0x3F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x3C, 0x03, 0x40, 0xE0, 0x09, 0x07, 0x40, 0x34, 0x2C,
-    0x07, 0x80, 0xFF, 0xF8, 0x03, 0x95, 0xB4, 0x1C, 0x00, 0xB0, 0xB0, 0x03, 0xC3, 0xD5, 0xBE, 0x1F,
-    0xFF, 0xF0, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x02, 0xD5, 0x54, 0x03, 0xC0,
-    0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0xE5, 0x7C, 0x00, 0x1C, 0x03, 0x80, 0x02, 0xC0, 0x74, 0x00, 0x38, 0x0B, 0x00, 0x07, 0x40,
-    0xF0, 0x00, 0xB0, 0x0E, 0x00, 0x0E, 0x01, 0xD0, 0x02, 0xD0, 0x2C, 0x00, 0xB8, 0x03, 0xC0, 0x3F,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x38, 0x00, 0x3C, 0x02, 0x40, 0x02, 0x40, 0x02, 0xFF, 0xFC,
-    0x03, 0xD5, 0x54, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x0E,
-    0x55, 0x40, 0x1C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3E, 0xAA, 0x40, 0x7F, 0xFF, 0x80, 0xBF, 0xFF,
-    0x40, 0x00, 0x3E, 0x07, 0xF4, 0x2E, 0x00, 0x07, 0xC1, 0xFC, 0x1F, 0x00, 0x00, 0xF4, 0xBE, 0x1F,
-    0x00, 0x00, 0x2F, 0x2F, 0x4F, 0x40, 0x00, 0x03, 0xCF, 0xCF, 0x40, 0x00, 0x00, 0xFB, 0xEB, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0xFF, 0xFC, 0x00,
-    0x02, 0xFD, 0xFE, 0x7F, 0x40, 0x02, 0xFD, 0x3F, 0x8F, 0xF0, 0x02, 0xFE, 0x1F, 0xE1, 0xFF, 0x00,
-    0x00, 0x15, 0x00, 0x0F, 0xFF, 0x40, 0x10, 0x0F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x01, 0x6F,
-    0x00, 0x3F, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x0A, 0x46, 0xF0, 0x3F, 0xFF,
-    0x40, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xA0, 0x0F,
-    0x40, 0x1F, 0x80, 0x3C, 0x00, 0xFD, 0x01, 0xE0, 0x0F, 0xF0, 0x0B, 0x40, 0xBF, 0xC0, 0x3C, 0x0B,
-    0xAE, 0x01, 0xF0, 0x7C, 0xF4, 0x0B, 0x83, 0xC7, 0xC0, 0x3D, 0x3D, 0x2F, 0x00, 0xF3, 0xD0, 0xF8,
-    0x07, 0xEE, 0x07, 0xD0, 0x3F, 0xF0, 0x3F, 0x00, 0xFF, 0x00, 0xFC, 0x07, 0xF0, 0x0B, 0xD0, 0x00,
-    0x00, 0x02, 0x00, 0x50, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x50, 0x0F, 0x40, 0x0F, 0x80, 0x3C, 0x00, 0xFD, 0x01, 0xF0,
-    0x0F, 0xF0, 0x0B, 0x40, 0xBF, 0xC0, 0x3C, 0x07, 0xEE, 0x01, 0xF0, 0x7C, 0xF4, 0x0B, 0x83, 0xC7,
-    0xC0, 0x3D, 0x3D, 0x2F, 0x00, 0xF2, 0xE0, 0xF8, 0x07, 0xEE, 0x07, 0xD0, 0x3F, 0xF0, 0x3F, 0x00,
-    0xFF, 0x00, 0xFC, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x02, 0xD0, 0xF4, 0x00,
-    0x3C, 0x3D, 0x00, 0x07, 0x8F, 0x80, 0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x7C, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xBF, 0x40, 0x00, 0xF1,
-    0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03, 0xE0, 0xBF, 0x40, 0x3D, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x07, 0xEA, 0xE0, 0x03, 0xD0, 0xB4, 0x00, 0xF0, 0x3C, 0x00, 0x78, 0x0F, 0x00, 0x2D, 0x07,
-    0x40, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF0, 0x02, 0xC0, 0x78, 0x00, 0xF0, 0x2D, 0x00, 0xB8, 0x0F,
-    0x00, 0xFC, 0x07, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x0B, 0xE0, 0x0B, 0xD0,
-    0x3B, 0x80, 0x7B, 0x00, 0xDF, 0x03, 0xAC, 0x07, 0x3C, 0x2C, 0xE0, 0x3C, 0xF1, 0xD7, 0x40, 0xE2,
-    0xDF, 0x2C, 0x07, 0x4B, 0xF0, 0xF0, 0x2D, 0x2F, 0x87, 0x80, 0xF0, 0x7C, 0x2D, 0x03, 0xC0, 0x00,
-    0xF0, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x14, 0x00, 0x14, 0x00, 0x78, 0x00, 0x3D, 0x00, 0xB4, 0x00,
-    0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03, 0xD0, 0x01,
-    0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x2F,
-    0x40, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x00,
-    0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00,
-    0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0xEA, 0xBF,
-    0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3D, 0x55, 0xE0, 0x0E, 0x00, 0x74, 0x07, 0x40,
-    0x2C, 0x02, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0x80, 0x38, 0x01, 0xD0, 0x1D, 0x00, 0xB0, 0x0B, 0x00,
-    0x3C, 0x03, 0xC0, 0x1E, 0x01, 0xE0, 0x0B, 0x40, 0xB4, 0x03, 0xC0, 0x00, 0x00, 0x3F, 0xF9, 0x00,
-    0x03, 0xEA, 0xF8, 0x00, 0x74, 0x03, 0xC0, 0x0B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x1E, 0x01,
-    0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0x40, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xBC, 0x02, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x90,
-    0x02, 0x40, 0x38, 0x02, 0xC0, 0x0B, 0x00, 0xE0, 0x01, 0xD0, 0xB0, 0x00, 0x38, 0x78, 0x00, 0x0F,
-    0x3C, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x1E, 0x0F, 0x03, 0x43, 0x41, 0xE0, 0x28, 0x70, 0x2D, 0x03, 0x47, 0x43, 0xC1,
-    0xF0, 0x7F, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x07, 0x83, 0xD0, 0x00,
-    0x00, 0xF3, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x02, 0xF0, 0x2F,
-    0x00, 0x02, 0xF4, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x0D,
-    0x02, 0xC0, 0x1C, 0x03, 0x80, 0x2C, 0x07, 0x40, 0x38, 0x0B, 0x00, 0x34, 0x0F, 0x00, 0xB0, 0x0E,
-    0x00, 0xF0, 0x1D, 0x00, 0xE0, 0x2C, 0x01, 0xD0, 0x3C, 0x02, 0xC0, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x1C, 0x00, 0xE2, 0x80, 0x0D, 0x34,
-    0x02, 0xC7, 0x00, 0x3C, 0xB0, 0x03, 0x8E, 0x00, 0xF4, 0xF0, 0x2F, 0x0B, 0xFF, 0xF0, 0x2F, 0x9E,
-    0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x42, 0x81, 0xC0,
-    0x3C, 0x0E, 0x0B, 0x00, 0xE0, 0x74, 0x38, 0x07, 0x42, 0xC0, 0xD0, 0x2C, 0x0F, 0x07, 0x00, 0xF0,
-    0x38, 0x2C, 0x03, 0x80, 0xD0, 0xE0, 0x1D, 0x07, 0x03, 0x40, 0xB0, 0x28, 0x1C, 0x03, 0x80, 0xD0,
-    0xB0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x42, 0x81,
-    0xC0, 0x3C, 0x0E, 0x0B, 0x00, 0xE0, 0x74, 0x38, 0x07, 0x42, 0xC0, 0xD0, 0x2C, 0x0B, 0x07, 0x00,
-    0xE0, 0x38, 0x2C, 0x03, 0x40, 0xD0, 0xE0, 0x1C, 0x07, 0x03, 0x40, 0xB0, 0x28, 0x1C, 0x03, 0x80,
-    0xD0, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x02, 0x00, 0x3F, 0xE0, 0x02, 0xBC, 0x00, 0x02, 0xC0, 0x00, 0x38, 0x00, 0x03,
-    0x40, 0x00, 0x7F, 0xF4, 0x0F, 0x01, 0xD0, 0xE0, 0x0D, 0x1D, 0x00, 0xD2, 0xC1, 0xBC, 0x3F, 0xFF,
-    0x43, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0C, 0x00, 0x00, 0x7C, 0x01,
-    0xC0, 0x00, 0x0B, 0x80, 0x2C, 0x00, 0x00, 0xF4, 0x03, 0x80, 0x00, 0x0F, 0x00, 0x34, 0x00, 0x02,
-    0xE0, 0x07, 0xFF, 0x40, 0x3D, 0x00, 0xF0, 0x1D, 0x03, 0xC0, 0x0E, 0x00, 0xD0, 0x7C, 0x01, 0xD0,
-    0x0D, 0x0F, 0x80, 0x2C, 0x1B, 0xC0, 0xF4, 0x03, 0xFF, 0xF4, 0x2F, 0x00, 0x3F, 0xF8, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0x02, 0xC0, 0x00, 0x38, 0x00, 0x03,
-    0x40, 0x00, 0x7F, 0xF4, 0x0F, 0x01, 0xD0, 0xE0, 0x0D, 0x1D, 0x00, 0xD2, 0xC1, 0xBC, 0x3F, 0xFF,
-    0x43, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0x96, 0xF0, 0x02, 0xC0, 0x0B,
-    0x40, 0x70, 0x00, 0x38, 0x00, 0x00, 0x03, 0x80, 0x02, 0xAA, 0xB8, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x1F, 0x07, 0xF4, 0x0B, 0xD0, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x7F, 0xD0, 0x03,
-    0x82, 0xD0, 0xB0, 0x07, 0x4B, 0x00, 0x38, 0x0B, 0x0D, 0x00, 0x38, 0x0F, 0x2C, 0x00, 0x38, 0x0D,
-    0x38, 0x00, 0x34, 0x1F, 0xF4, 0x00, 0xB0, 0x2D, 0xF0, 0x00, 0xE0, 0x38, 0xB4, 0x03, 0xD0, 0x34,
-    0xBE, 0x6F, 0x80, 0x70, 0x7F, 0xFF, 0x00, 0xA0, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0xFA, 0xAC, 0x00, 0x2C, 0x01, 0xC0, 0x03, 0x40, 0x28, 0x00, 0x78, 0x03,
-    0x80, 0x07, 0xE5, 0xB4, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xF0, 0x2E, 0x00, 0x3C,
-    0x03, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xF8, 0x0B, 0xC0, 0x1F, 0x40, 0xFC, 0x03, 0xF0, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xFF, 0x80, 0xB8, 0x2E, 0x07, 0x40, 0x74, 0x38, 0x02,
-    0xC0, 0xC0, 0x0F, 0x07, 0x00, 0xBC, 0x1F, 0xAF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0x9D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x90, 0x0B, 0xFE, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x00, 0x74, 0x64, 0x02,
-    0xFF, 0xFC, 0x0F, 0xD0, 0xF4, 0x3C, 0x02, 0xE1, 0xE0, 0x0B, 0x47, 0x40, 0x3C, 0x1F, 0x47, 0xE0,
-    0x3F, 0xFE, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0x01, 0xC0, 0xB0, 0x1C,
-    0x0E, 0x07, 0x40, 0xFF, 0xD0, 0x1C, 0x03, 0x83, 0x80, 0x38, 0x34, 0x0B, 0x47, 0xFF, 0xF0, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0,
-    0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x28, 0x3C, 0x00, 0x34, 0x38, 0x00, 0x70, 0x74, 0x00, 0xE0, 0xB0, 0x02, 0xC0, 0xF0,
-    0x07, 0x40, 0xE0, 0x2F, 0xAB, 0xF4, 0x3F, 0xFF, 0xF4, 0x34, 0x00, 0xB0, 0x20, 0x00, 0x80, 0x00,
-    0x6F, 0x40, 0x0B, 0x43, 0x40, 0xB0, 0x06, 0x07, 0x9A, 0xFC, 0x2F, 0xFE, 0x90, 0xD0, 0x00, 0x03,
-    0x80, 0x00, 0x0F, 0x90, 0x50, 0x2F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x14, 0x05, 0x00, 0x40,
-    0x03, 0xC2, 0xF4, 0x78, 0x00, 0x2D, 0x3F, 0x1E, 0x00, 0x00, 0xF3, 0xD7, 0x80, 0x00, 0x0F, 0x7D,
-    0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xBF, 0xBD, 0x00, 0x0B, 0xE7, 0xE7, 0xF0, 0x03, 0xF8, 0xFE, 0x3F,
-    0x80, 0x01, 0xA8, 0x01, 0x06, 0x00, 0x02, 0x00, 0x0C, 0x02, 0xF4, 0x00, 0x2C, 0x00, 0x28, 0x2E,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xF0, 0xB0, 0x1F, 0x83, 0x81, 0xDD, 0x0D, 0x0D,
-    0x30, 0x70, 0xE2, 0xC2, 0xCE, 0x0E, 0x0E, 0xE0, 0x34, 0x7F, 0x02, 0xC2, 0xF0, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFB, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x07, 0x00, 0x7C, 0x2C, 0x07, 0xE0,
-    0xE0, 0x77, 0x43, 0x43, 0x4C, 0x1C, 0x38, 0xB0, 0xB3, 0x83, 0x83, 0xB8, 0x0D, 0x1F, 0xC0, 0xB0,
-    0xBC, 0x03, 0xC0, 0x00, 0x90, 0xA0, 0x07, 0x4F, 0x00, 0x2C, 0xF0, 0x00, 0xEF, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0x40, 0x01, 0xFF, 0x00, 0x0B, 0x3E, 0x00, 0x38, 0xBD, 0x02, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0xD2, 0x80, 0x1C, 0x34, 0x03, 0x83, 0x00, 0x30, 0xB0, 0x07, 0x0E,
-    0x00, 0xD0, 0xD0, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x90, 0x02, 0x80, 0xBC, 0x02, 0xF0, 0x3F,
-    0x01, 0xF8, 0x1F, 0xC0, 0xFD, 0x0B, 0xB4, 0xBB, 0x03, 0xAD, 0x77, 0xC1, 0xD7, 0xBC, 0xF0, 0xB1,
-    0xFC, 0xB8, 0x3C, 0x3E, 0x3D, 0x1F, 0x0F, 0x0F, 0x4B, 0x80, 0x0B, 0xC0, 0x00, 0x90, 0x01, 0x80,
-    0x74, 0x00, 0xE0, 0x2C, 0x00, 0x74, 0x0F, 0x00, 0x2C, 0x07, 0x80, 0x0F, 0x02, 0xD0, 0x07, 0x80,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x2E, 0x55, 0xBC, 0x0F, 0x40, 0x3E, 0x07, 0xC0, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0B, 0x87, 0x81, 0xD0, 0x1C, 0x38, 0x01, 0xC7, 0x40, 0x2C, 0x70,
-    0x03, 0xCB, 0x00, 0xB4, 0xBE, 0xBF, 0x03, 0xFF, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0xB0, 0x03, 0x83, 0xC0, 0x1D, 0x0E, 0x00, 0xB0, 0x74, 0x03, 0xC2, 0xC0,
-    0x0E, 0x0F, 0x00, 0xB4, 0x78, 0x03, 0xC2, 0xD0, 0x0F, 0x00, 0x00, 0x14, 0xBD, 0x00, 0x03, 0xFE,
-    0xB4, 0x00, 0x3F, 0x02, 0x80, 0x03, 0xC0, 0x2C, 0x00, 0x78, 0x02, 0x80, 0x0B, 0x40, 0x34, 0x00,
-    0xF8, 0x07, 0x00, 0x1F, 0xE6, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0xE0,
-    0x00, 0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD1, 0x0D, 0x04, 0x01,
-    0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0x02, 0xC0, 0x0F, 0x00, 0x74, 0x07, 0x40, 0x0E, 0x03, 0xC0, 0x03, 0xC1, 0xD0, 0x00, 0xF0,
-    0xF0, 0x00, 0x2E, 0xB4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x0E, 0x4F, 0x07, 0x03, 0x80, 0xF0, 0x28,
-    0x30, 0x1E, 0x03, 0x46, 0x02, 0xD0, 0x34, 0xB0, 0x3C, 0x0F, 0x0B, 0xEB, 0xEB, 0xE0, 0x7F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x2C, 0x00, 0xD0, 0xB0, 0x00, 0xB2, 0xC0, 0x00,
-    0x7B, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xDF, 0x00, 0x0F, 0x4B, 0x80, 0x3D, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0xD0, 0xB0, 0x07, 0x03, 0xC0, 0x2C, 0x0E, 0x00, 0xE0, 0x74,
-    0x03, 0x42, 0xC0, 0x1C, 0x0A, 0x00, 0xB0, 0x3E, 0xAB, 0xE0, 0xFF, 0xFF, 0x40, 0x00, 0x2C, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x24, 0x0C, 0x30, 0x28, 0x30, 0x34, 0x35,
-    0xF0, 0x2F, 0xB0, 0x00, 0xA0, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1C, 0x0D, 0x0B, 0x03,
-    0xC1, 0xC0, 0xF0, 0x38, 0x2C, 0x0E, 0x07, 0x43, 0x81, 0xD0, 0xB0, 0x34, 0x2C, 0x0B, 0x07, 0x03,
-    0x80, 0xD0, 0xB0, 0x3E, 0xAF, 0xAE, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1C,
-    0x0D, 0x0B, 0x03, 0xC1, 0xC0, 0xF0, 0x38, 0x2C, 0x0E, 0x07, 0x43, 0x81, 0xD0, 0xB0, 0x34, 0x2C,
-    0x0B, 0x07, 0x03, 0x80, 0xD0, 0xB0, 0x3E, 0xAF, 0xAF, 0x87, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x3F, 0x80, 0x06, 0xB4, 0x00, 0x07, 0x00, 0x00,
-    0xBF, 0xE0, 0x0E, 0x02, 0x80, 0xD0, 0x1C, 0x1C, 0x03, 0xC2, 0xEB, 0xF4, 0x3F, 0xF9, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x40, 0x74, 0x00, 0x0D, 0x0B, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x2C, 0x0F,
-    0xF9, 0x03, 0x81, 0xD0, 0x28, 0x74, 0x1C, 0x02, 0x8B, 0x02, 0xC0, 0x38, 0xF0, 0x3E, 0xBF, 0x0E,
-    0x03, 0xFF, 0x81, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0xC0, 0x00, 0xB0, 0x00, 0x38,
-    0x00, 0x0F, 0xFD, 0x07, 0x00, 0xD2, 0xC0, 0x28, 0xE0, 0x1D, 0x7E, 0xBF, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x0A, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x0F, 0xFE,
-    0x00, 0x02, 0xC1, 0x00, 0xB8, 0x3F, 0xFE, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x03, 0x41, 0xF8,
-    0x01, 0xC3, 0x82, 0xC0, 0xB2, 0x80, 0x30, 0x34, 0xC0, 0x0C, 0x0C, 0xA0, 0x07, 0x07, 0xF4, 0x02,
-    0x82, 0x9D, 0x00, 0xD0, 0xD3, 0xC1, 0xF0, 0x30, 0xFF, 0xF0, 0x18, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD0, 0x0D, 0x07, 0x00, 0x60, 0x2C, 0x01, 0x80, 0xE0, 0x03,
-    0xFF, 0x40, 0x2E, 0x6C, 0x02, 0xD0, 0xE0, 0x1D, 0x03, 0x41, 0xE0, 0x1C, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4,
-    0x00, 0xB4, 0x34, 0x0B, 0x00, 0x60, 0x79, 0xAF, 0xC2, 0xFF, 0xE9, 0x0D, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0xF9, 0x05, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x01, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x2B, 0xD0, 0x06, 0x02, 0xC0, 0x70, 0x03, 0x43, 0xFF, 0xFC, 0x1C, 0x00, 0x00, 0xB4,
-    0x00, 0x02, 0xF5, 0x18, 0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x39, 0x50, 0x01, 0xFF, 0xA0, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xDA, 0x90, 0x02,
-    0xFF, 0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00,
-    0xB0, 0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0, 0x3C, 0x07, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x70, 0x00, 0x0D, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0,
-    0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x6A, 0x00, 0x38, 0x2C, 0x0A, 0x00, 0xC1, 0xC0, 0x00,
-    0x2F, 0xF4, 0x03, 0x40, 0x00, 0x3D, 0x1A, 0x03, 0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x03, 0x95, 0x00, 0x28, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x3C, 0x01, 0x96, 0xF0, 0x2F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x24, 0x02, 0xE0, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0x00, 0xE0, 0x03, 0x40, 0x1C, 0x00, 0xA0, 0x03, 0x80,
-    0x1D, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x0F, 0x07, 0x87, 0xC3, 0xE2, 0xA0, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x74,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00,
-    0x0D, 0x00, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x0D, 0x00, 0x00, 0x30, 0x00, 0x02, 0xC0, 0x00,
-    0x0E, 0x00, 0x00, 0xB0, 0x00, 0x6F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x20, 0x24, 0x00, 0x0C, 0x0C, 0x00, 0x02, 0x03, 0x00, 0x02, 0x41, 0xFE, 0x00, 0xC0, 0xA0,
-    0x90, 0x60, 0x34, 0x24, 0x24, 0x0D, 0xBC, 0x3C, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x24, 0x06, 0x00, 0x3F, 0xFF, 0xF4, 0x30, 0x0C, 0x0C,
-    0x60, 0x1C, 0x0C, 0x90, 0x2E, 0xB8, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x39, 0x50, 0x01, 0xFF, 0xA0, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xDA, 0x90, 0x02, 0xFF,
-    0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0,
-    0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x43, 0x80, 0x1C, 0x3C, 0x00, 0xF3, 0xC0, 0x03,
-    0xBC, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2C, 0xF8, 0x00, 0xE2, 0xF4, 0x0B,
-    0x43, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x01, 0xF0, 0xB0, 0x1F, 0x83, 0x81, 0xDD, 0x0D, 0x0D, 0x30, 0x70, 0xE2, 0xC2, 0xCE,
-    0x0E, 0x0E, 0xE0, 0x34, 0x7F, 0x02, 0xC2, 0xF0, 0x0F, 0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x41,
-    0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x3C, 0x01, 0xD0, 0x1D, 0x00, 0x38, 0x0F, 0x00, 0x0F, 0x07, 0x40, 0x03, 0xC3,
-    0xC0, 0x00, 0xBA, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xFF, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x50, 0x70, 0x0D, 0x0A, 0x00, 0xC0, 0xD0, 0x1C, 0x0C, 0x02, 0x81, 0xC0,
-    0x34, 0x28, 0x07, 0x03, 0x40, 0xA0, 0x3F, 0xFD, 0x00, 0x24, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00,
-    0x02, 0xC0, 0x03, 0xFF, 0xF8, 0x2F, 0xEA, 0x00, 0x70, 0x00, 0x0B, 0x00, 0x00, 0xFF, 0xE0, 0x0F,
-    0x02, 0x81, 0xD0, 0x1C, 0x2C, 0x02, 0x83, 0xFA, 0xF4, 0x3F, 0xFF, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0xE0, 0x00, 0x74, 0x00, 0xFF, 0xFC, 0x0F, 0x00, 0x03, 0xD4, 0x01, 0xFE,
-    0xB0, 0xB8, 0x0A, 0x3C, 0x02, 0x8F, 0x06, 0xD3, 0xFF, 0xF0, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x1F, 0xEA, 0xAF, 0xC0, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0x0B, 0xC0,
-    0x00, 0x0B, 0x8B, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x02, 0xD3, 0x8B,
-    0x00, 0x02, 0xC1, 0xD0, 0xD0, 0x01, 0xD0, 0xB0, 0x34, 0x00, 0xF0, 0x38, 0x0D, 0x00, 0xB4, 0x1E,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x3C, 0x0F, 0x00, 0x75, 0xD0, 0x01, 0xFD, 0x00,
-    0x29, 0xCD, 0x01, 0xC7, 0x18, 0x0C, 0x28, 0x60, 0xA0, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x3C, 0x02, 0xE7, 0x80, 0xD0, 0x0F, 0x07, 0x4F, 0x00, 0xB6, 0xBF, 0xF4, 0x00, 0xBF, 0xFF,
-    0x40, 0x07, 0xD0, 0x1F, 0x00, 0x3D, 0x00, 0x3D, 0x01, 0xE0, 0x00, 0xF4, 0x0F, 0x00, 0x03, 0xC0,
-    0x3C, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0xB4, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1C, 0x07, 0x4D, 0x38,
-    0x0F, 0xBF, 0xE0, 0x03, 0xEA, 0xD0, 0x0F, 0x00, 0xE0, 0x1C, 0x00, 0xB0, 0x3C, 0x00, 0xF0, 0x38,
-    0x00, 0xE0, 0x38, 0x02, 0xC0, 0x3E, 0xAF, 0x80, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x45, 0x00, 0x00, 0x7F,
-    0xF8, 0x78, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x02, 0xF0, 0x00, 0x1F,
-    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x3D,
-    0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDE, 0x00, 0x2D, 0x3C, 0x01, 0xD0, 0xB0,
-    0x0E, 0x02, 0xC0, 0xB0, 0x0B, 0x03, 0x80, 0x2C, 0x3C, 0x00, 0xB6, 0xD0, 0x01, 0xFF, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x38, 0x00, 0xD3, 0xFF, 0x00, 0x2C, 0x00, 0x90, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x01, 0xC0, 0x1F, 0xFF, 0xE0, 0x0B, 0x55, 0x50, 0x03, 0xC0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x07, 0x01, 0xFF, 0xFC, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07,
-    0x80, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x02, 0xD5, 0x54, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0x1F, 0xEA, 0xA0, 0x0F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x07, 0xFF, 0x02, 0x80, 0x00, 0xE0, 0x00, 0xBF, 0xF4, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80,
-    0x01, 0xD0, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x0F, 0xFF, 0xFC, 0x01, 0xC0, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFD, 0x5E, 0x00, 0x0F,
-    0x00, 0xB0, 0x01, 0xD0, 0x07, 0x00, 0x2C, 0x00, 0xB0, 0x03, 0xC0, 0x0E, 0x00, 0x78, 0x0B, 0xC0,
-    0x0B, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x09, 0x00, 0x0C, 0x00, 0x1E, 0xA0, 0x2C, 0x24,
-    0x34, 0x24, 0x30, 0x30, 0x61, 0xD0, 0x00, 0x3D, 0x0B, 0xF0, 0x3E, 0x00, 0x2F, 0x0B, 0xF0, 0xB8,
-    0x00, 0x0F, 0x0B, 0xD1, 0xF0, 0x00, 0x0F, 0x8F, 0xC7, 0xC0, 0x00, 0x07, 0xCF, 0xCF, 0x40, 0x00,
-    0x03, 0xDF, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xBE,
-    0xFE, 0x00, 0x02, 0xFC, 0xFE, 0xBF, 0x40, 0x0B, 0xF4, 0xFD, 0x3F, 0xC0, 0x3F, 0xD2, 0xFD, 0x2F,
-    0xE9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x82, 0x90, 0x80, 0x1D, 0x3D, 0x38, 0x00, 0xF3, 0xCE, 0x00, 0x07, 0x7B, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xAF, 0x7C, 0x03,
-    0xE3, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x15, 0x40, 0x03, 0xFF, 0xC0,
-    0x04, 0x07, 0x80, 0x00, 0x0E, 0x00, 0x00, 0xB4, 0x01, 0x5B, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0xD0, 0x00, 0x0B, 0x43, 0x41, 0xBC, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x01, 0xA8, 0x01, 0x06, 0x00, 0x02, 0x00, 0x0C, 0x02, 0xF4, 0x00, 0x2C,
-    0x00, 0x28, 0x2E, 0xF0, 0x3F, 0x80, 0x10, 0x00, 0x15, 0x00, 0x06, 0x00, 0xB8, 0x00, 0x00, 0x2D,
-    0x07, 0xC0, 0x03, 0xC1, 0xF0, 0x00, 0x3C, 0x3D, 0x00, 0x0B, 0x4F, 0x40, 0x00, 0xF2, 0xE0, 0x00,
-    0x0F, 0xBC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0F, 0x7F, 0x40, 0x01, 0xF2, 0xFC, 0x00, 0x2F, 0x0F, 0xE0, 0x03, 0xD0, 0xBF, 0x40, 0x7C,
-    0x07, 0xFC, 0x20, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xD0, 0x01, 0x82, 0x80, 0x28, 0xB0, 0x03,
-    0x6C, 0x00, 0x77, 0x40, 0x0B, 0xD0, 0x00, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xDF, 0x00, 0x34, 0xF8,
-    0x07, 0x0B, 0xD0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3D, 0x01, 0xD0, 0x0B,
-    0x40, 0x2D, 0x91, 0xE0, 0x03, 0xAC, 0x78, 0x00, 0x77, 0xCF, 0x00, 0x0B, 0x3F, 0xC0, 0x00, 0xFF,
-    0xF0, 0x00, 0x1E, 0xBF, 0x80, 0x03, 0xCB, 0xBD, 0x00, 0x3C, 0xF3, 0xF4, 0x07, 0x8F, 0x1F, 0xC0,
-    0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x80, 0x75, 0x2C, 0x02, 0xB6, 0xC0, 0x0D,
-    0xFC, 0x00, 0x7F, 0xD0, 0x03, 0xAF, 0xC0, 0x1C, 0xE7, 0xC0, 0xB1, 0x4F, 0x80, 0x00, 0x1E, 0x07,
-    0xC0, 0x1F, 0xFC, 0xF4, 0x00, 0x7C, 0x3D, 0x00, 0x07, 0x8F, 0x80, 0x00, 0xF6, 0xE0, 0x00, 0x0F,
-    0xBC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x0F, 0xBF, 0x80, 0x00, 0xF1, 0xFC, 0x00, 0x1F, 0x0F, 0xF0, 0x03, 0xE0, 0xBF, 0x40, 0x3D, 0x03,
-    0xFC, 0x00, 0x00, 0x10, 0x00, 0x07, 0x40, 0x0F, 0xFF, 0x00, 0x5F, 0x50, 0x01, 0xD0, 0x00, 0x2C,
-    0x38, 0x03, 0xCF, 0x00, 0x3B, 0xC0, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0E, 0xF8, 0x01, 0xD7, 0xD0,
-    0x3C, 0x3F, 0x03, 0xC1, 0xFC, 0x3F, 0xFF, 0x81, 0xF0, 0xAA, 0xBD, 0x0F, 0x40, 0x00, 0xF0, 0xF4,
-    0x00, 0x07, 0x8F, 0x80, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3E, 0xFE, 0x00, 0x00, 0xF1,
-    0xFC, 0x00, 0x07, 0xC3, 0xFC, 0x00, 0x3E, 0x0B, 0xF4, 0x00, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x1D, 0x00, 0xD3, 0x80, 0x1C, 0xE0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00,
-    0xBF, 0x00, 0x0E, 0xB8, 0x01, 0xC3, 0xD0, 0x2C, 0x3F, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0xB4,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xF0, 0x00, 0xF4, 0x02, 0xE0,
-    0x00, 0xF0, 0x03, 0xD0, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0x80, 0x3F, 0x00,
-    0x2F, 0x40, 0x7E, 0x00, 0x3F, 0x0C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0xD0, 0x70, 0x07, 0x02, 0xC0, 0x2C, 0x0E, 0x00, 0xE0, 0x34, 0x07, 0x41, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xF0, 0x3C, 0x07, 0xC0, 0xE0, 0x1E, 0x0B, 0x40, 0xB5, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0xB4, 0x00, 0x3E, 0xAA, 0x80,
-    0x0F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0x00, 0x3F, 0xF0, 0x1C, 0x02, 0xC0, 0x00, 0xA0, 0x0E, 0x00, 0x03, 0x80, 0x34,
-    0x00, 0x1D, 0x01, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0E, 0x01, 0xE0, 0x00,
-    0x74, 0x0B, 0x40, 0x02, 0xC0, 0x3C, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x03, 0x80, 0x1F, 0x00, 0x00, 0x74, 0x02, 0xE0, 0x00, 0x0B, 0x00, 0x3D, 0x00, 0x00, 0xF0,
-    0x03, 0xC0, 0x00, 0x0E, 0x00, 0x7E, 0xFD, 0x01, 0xD0, 0x0B, 0xE5, 0xB4, 0x2C, 0x00, 0xF8, 0x03,
-    0x83, 0xC0, 0x0F, 0x00, 0x38, 0x3C, 0x01, 0xE0, 0x03, 0x47, 0x80, 0x2D, 0x00, 0x70, 0xB4, 0x03,
-    0xC0, 0x6E, 0x0F, 0x00, 0x3C, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x03,
-    0x80, 0x2C, 0x00, 0x07, 0x40, 0x3C, 0x00, 0x0B, 0x00, 0x78, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x1E,
-    0x00, 0xF0, 0x00, 0x2D, 0x00, 0xE0, 0x00, 0x3C, 0x01, 0xFF, 0xF4, 0x38, 0x02, 0xF4, 0x3C, 0x00,
-    0x03, 0xC0, 0x1D, 0x00, 0x07, 0x40, 0x0D, 0x00, 0x0B, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x78, 0x00,
-    0x0F, 0x03, 0xF0, 0x00, 0x09, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x07, 0xFD, 0x00, 0xE0, 0x0F, 0x42,
-    0xC0, 0xB0, 0x0B, 0x00, 0x70, 0x38, 0x07, 0x00, 0x38, 0x1D, 0x02, 0xC0, 0x2C, 0x0B, 0x00, 0xE0,
-    0x3D, 0x03, 0xC0, 0x3C, 0x7E, 0x00, 0xFD, 0x0F, 0xFE, 0x6C, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
-    0xFF, 0xF9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x38, 0x07, 0xF4, 0x0B, 0x02, 0x81, 0xC0, 0xD0, 0x70, 0x18, 0x1C, 0x0D, 0x03, 0x42,
-    0x80, 0xC1, 0xE0, 0x3C, 0x0D, 0xB8, 0x42, 0xFF, 0xFF, 0xBC, 0x07, 0xFA, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x40, 0x3F, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x60, 0x3C, 0x00, 0x2D, 0x00, 0x0F,
-    0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x80, 0x0B,
-    0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE0, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3F, 0xFF, 0x85, 0x75, 0x40, 0x1C, 0x00, 0x0A, 0x00, 0x03,
-    0x40, 0x01, 0xC0, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x2E, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xF0, 0x2E, 0x03, 0xD0, 0x2F, 0x0F, 0x40,
-    0x1F, 0x2E, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x74, 0x03, 0x87, 0x80, 0xB0,
-    0x38, 0x0E, 0x03, 0x83, 0xC0, 0x3C, 0x74, 0x03, 0xCE, 0x00, 0x3E, 0xC0, 0x02, 0xF4, 0x00, 0x2F,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x0B, 0x83, 0xC0, 0x07, 0x80,
-    0xF4, 0x03, 0xC0, 0x2E, 0x03, 0xC0, 0x0B, 0xC3, 0xD0, 0x01, 0xF6, 0xE0, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x0A, 0xFE, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x74, 0x07, 0x40, 0x0E, 0x03,
-    0xC0, 0x03, 0x82, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0x3C, 0xF0, 0x00, 0x0F, 0x74, 0x00, 0x03, 0xF8,
-    0x00, 0x2A, 0xFF, 0xA0, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x03, 0xC0, 0x00,
-    0x3C, 0x03, 0xC0, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x01, 0xF3, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xC0,
-    0x00, 0x03, 0xF0, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x03, 0xF4, 0x00,
-    0xFC, 0x30, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x18, 0x00, 0xC0,
-    0x70, 0x00, 0xE1, 0xD0, 0x00, 0x77, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFD, 0x00,
-    0x03, 0x8F, 0x00, 0x0F, 0x0F, 0x40, 0x3C, 0x07, 0x84, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xC2, 0x85, 0x7D, 0x40, 0xD0, 0x0E, 0x00, 0x30, 0x07, 0x40, 0x1C, 0x02, 0xC0, 0x0A, 0x00,
-    0xF0, 0x03, 0x40, 0x38, 0x00, 0xC0, 0x1D, 0x00, 0xB0, 0x0B, 0x00, 0x38, 0x03, 0xC0, 0x0E, 0x00,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x40, 0x00, 0x02, 0xC0,
-    0xBF, 0xF1, 0x82, 0x80, 0x90, 0xD0, 0x30, 0x30, 0x0C, 0x1C, 0x09, 0x0A, 0x03, 0x03, 0xAA, 0xE1,
-    0xFF, 0xFC, 0x00, 0x07, 0x00, 0x02, 0x80, 0x00, 0x00, 0x18, 0x00, 0xA0, 0xB0, 0x03, 0x83, 0xC0,
-    0x1D, 0x0D, 0x00, 0xB0, 0x70, 0x03, 0xC1, 0xC0, 0x2E, 0x07, 0x46, 0xF4, 0x0B, 0xFB, 0xC0, 0x00,
-    0x0E, 0x00, 0x00, 0x74, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3B, 0x80, 0x00, 0x9D, 0x00,
-    0x00, 0x70, 0x00, 0x01, 0x40, 0x04, 0x05, 0x1C, 0x0A, 0x28, 0x0D, 0x24, 0x0C, 0x24, 0x3C, 0x1F,
-    0xF8, 0x00, 0x34, 0x00, 0x30, 0x00, 0x60, 0x00, 0xAC, 0x00, 0x18, 0x00, 0x14, 0x0E, 0x00, 0x2C,
-    0x34, 0x00, 0xE2, 0xC0, 0x07, 0x4F, 0x00, 0x2C, 0x38, 0x00, 0xF1, 0xD3, 0x4B, 0x87, 0x8D, 0xFD,
-    0x0F, 0xFF, 0xF0, 0x1F, 0xE7, 0x80, 0x0D, 0x2D, 0x00, 0x70, 0xF0, 0x00, 0x47, 0xC0, 0x00, 0x00,
-    0x03, 0x00, 0xC1, 0xC0, 0x70, 0x90, 0x34, 0x36, 0x5C, 0x0E, 0xEF, 0x01, 0xFB, 0x80, 0x18, 0xD0,
-    0x09, 0x70, 0x00, 0x00, 0x80, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00,
-    0xB0, 0x00, 0x0F, 0xBF, 0x80, 0xF9, 0x1D, 0x1E, 0x00, 0xD3, 0xC0, 0x0D, 0x38, 0x01, 0xC7, 0x40,
-    0x2C, 0xB4, 0x03, 0xCF, 0x00, 0x78, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xD6, 0x90, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x78, 0x03, 0xC0,
-    0x38, 0x07, 0x40, 0x34, 0x0F, 0x00, 0x70, 0x0F, 0x00, 0xB0, 0x1E, 0x00, 0xF0, 0x3D, 0x01, 0xE0,
-    0x3C, 0x02, 0xD0, 0x00, 0x00, 0x50, 0x07, 0x40, 0xFF, 0xE0, 0x7D, 0xBD, 0x03, 0x41, 0xBF, 0xE4,
-    0x2C, 0x03, 0xDF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x0F, 0xA9, 0x50, 0x01, 0xE0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xE4,
-    0x00, 0x20, 0x2F, 0x43, 0x9D, 0x09, 0x0B, 0xF9, 0xA0, 0xFF, 0xFE, 0x0E, 0x54, 0x01, 0xC0, 0x00,
-    0x1E, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x0B, 0x00, 0xFF, 0xD0, 0x7D,
-    0xB9, 0x03, 0x41, 0xBF, 0xE4, 0x28, 0x03, 0xAF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x0F, 0xA9, 0x54,
-    0x01, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x70, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x0B, 0xE0, 0xF7, 0x81, 0x81, 0xFE, 0x9C, 0x1E, 0xFF, 0xC3, 0x95, 0x40, 0x34, 0x00, 0x03, 0xD0,
-    0x10, 0x2F, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x60, 0x00, 0x04, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F,
-    0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-    0x07, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7F, 0x42, 0xE0, 0x00, 0x7C,
-    0x1F, 0xC1, 0xF0, 0x00, 0x0F, 0x4B, 0xE1, 0xF0, 0x00, 0x02, 0xF2, 0xF4, 0xF4, 0x00, 0x00, 0x3C,
-    0xFC, 0xF4, 0x00, 0x00, 0x0F, 0xBE, 0xB8, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xFF, 0xC0, 0x00, 0x2F, 0xDF, 0xE7, 0xF4, 0x00, 0x2F, 0xD3, 0xF8,
-    0xFF, 0x00, 0x2F, 0xE1, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00, 0x0B, 0x03,
-    0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x41, 0x40, 0x03, 0xC2, 0xF4, 0x78, 0x00, 0x2E, 0x3F, 0x1E,
-    0x00, 0x00, 0xF3, 0xD7, 0x80, 0x00, 0x0F, 0x7D, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xBF, 0xBD, 0x00,
-    0x0B, 0xE7, 0xE7, 0xF0, 0x03, 0xF8, 0xFE, 0x3F, 0x80, 0x00, 0x50, 0x14, 0x00, 0xE0, 0xB4, 0x01,
-    0xC2, 0xD0, 0x02, 0xC7, 0x80, 0x03, 0x9E, 0x00, 0x07, 0x7C, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF9,
-    0x00, 0x1D, 0x1F, 0x80, 0x3C, 0x03, 0xC0, 0x3C, 0x01, 0xD0, 0x78, 0x02, 0xD0, 0xF4, 0x03, 0xC0,
-    0x00, 0x07, 0x80, 0x00, 0x6F, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x61,
-    0xC0, 0x24, 0xC0, 0x0C, 0xD0, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0xD2, 0xC0, 0x70, 0x34, 0x38, 0x0D,
-    0x00, 0x0B, 0x00, 0x1F, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xAA, 0x80, 0x07, 0xFF, 0xE0, 0x02, 0xD0,
-    0x74, 0x00, 0xF0, 0x2C, 0x00, 0x3C, 0x0F, 0x00, 0x2D, 0x07, 0x80, 0x0F, 0x02, 0xD0, 0x03, 0xC0,
-    0xF0, 0x02, 0xD0, 0x3C, 0x00, 0xF0, 0x1E, 0x00, 0x78, 0x0F, 0x40, 0x7D, 0x03, 0xFC, 0x3E, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0xD2, 0xC0, 0x1C, 0x34, 0x03, 0x83, 0x00, 0x30, 0x70, 0x07, 0x0E, 0x00, 0xD0, 0xE0, 0x3C,
-    0x1F, 0x00, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x78, 0x00, 0x3D, 0x00,
-    0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0xF4, 0x03,
-    0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0xC0, 0x3E,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0xC0, 0x70, 0x0B, 0x02, 0x80, 0x38, 0x0E, 0x00,
-    0xD0, 0x74, 0x07, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x38, 0x07, 0x81, 0xD0, 0x2E, 0x0B, 0x00,
-    0xF8, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x78,
-    0x00, 0x3D, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xB8, 0x02, 0xE0,
-    0x00, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xD0, 0x02, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x1F, 0x80, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0xC0,
-    0x70, 0x0B, 0x02, 0x80, 0x38, 0x0E, 0x00, 0xD0, 0x74, 0x07, 0x42, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0,
-    0x38, 0x07, 0x81, 0xD0, 0x2D, 0x0B, 0x00, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xA0, 0x74, 0x03, 0xC2, 0xC0, 0x0F, 0x0E, 0x00, 0x78, 0x34,
-    0x02, 0xC0, 0xD0, 0x0F, 0x03, 0x85, 0xF8, 0x07, 0xFF, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x52, 0x03, 0x64, 0x0C, 0xD0, 0xB3, 0x9B, 0x87, 0xED, 0x00, 0xB0, 0x03, 0xC0, 0x18, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x0F, 0xD0,
-    0x0B, 0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0E, 0xFC, 0x0F, 0xBC, 0x02, 0xDF, 0xC2,
-    0xFB, 0x80, 0x3D, 0xBC, 0x7C, 0xF4, 0x03, 0xCB, 0xDF, 0x9F, 0x40, 0x7C, 0x7F, 0xF2, 0xF0, 0x0F,
-    0x87, 0xFD, 0x3F, 0x00, 0xF4, 0x3F, 0x87, 0xE0, 0x1F, 0x43, 0xF0, 0xBE, 0x03, 0xF0, 0x3D, 0x0F,
-    0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x02, 0x80, 0x09, 0x03,
-    0xD0, 0x3D, 0x07, 0xD0, 0x7D, 0x0F, 0xE0, 0xFC, 0x0D, 0xE3, 0xEC, 0x1C, 0xF7, 0x78, 0x3C, 0xFE,
-    0x78, 0x38, 0xFC, 0xB4, 0x74, 0xB4, 0xF0, 0xB4, 0x01, 0xF0, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x3C, 0x03, 0x80, 0x74, 0x0B, 0x00, 0xF0, 0x0E,
-    0x01, 0xD0, 0x2C, 0x02, 0xC0, 0x38, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C,
-    0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x1E, 0x07, 0x40,
-    0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x34, 0x0A, 0x00, 0x02, 0xEB, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xE0, 0xB8, 0x00, 0x74, 0x07, 0x40, 0x0E,
-    0x00, 0xB0, 0x00, 0xC0, 0x0F, 0x00, 0x1C, 0x02, 0xF0, 0x01, 0xFA, 0xFE, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0xA4, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x00, 0x0B, 0x4B, 0x40,
-    0x00, 0x1E, 0x07, 0x40, 0x00, 0x3C, 0x07, 0x80, 0x00, 0xB8, 0x07, 0x80, 0x01, 0xF0, 0x07, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F, 0x40, 0x07, 0xC0, 0x3E, 0x00, 0x07, 0xD0,
-    0x00, 0x01, 0xD0, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x68, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x60, 0x00, 0x0F, 0xAF, 0x80, 0x00, 0xB0, 0x1D, 0x00, 0x07, 0x00,
-    0x74, 0x00, 0x38, 0x02, 0xC0, 0x00, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0xBC, 0x00, 0x1F, 0xAF, 0xE0,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x7F, 0xFD, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x0B,
-    0x80, 0x00, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3D, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0xFF,
-    0xFF, 0xD1, 0xC0, 0x2E, 0x0B, 0xE0, 0x0D, 0x07, 0x40, 0x7D, 0x6B, 0xD0, 0xE0, 0x0B, 0xFF, 0xE8,
-    0x0C, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0xAF, 0xFD, 0x06, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF9, 0xEB, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x09, 0x00, 0x2E, 0xBC,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x03, 0xD5, 0x54, 0x03,
-    0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x0E, 0x55, 0x40, 0x1C, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x3E, 0xAA, 0x40, 0x7F, 0xFF, 0x80, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x0C, 0x00, 0x3E, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x40, 0x02, 0xD0, 0xD0, 0x0B, 0x00, 0x60, 0x1E, 0x6B, 0xF0, 0x2F, 0xFE,
-    0x90, 0x34, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3E, 0x41, 0x40, 0x2F, 0xFF, 0x40, 0x07, 0xFE, 0x00,
-    0x02, 0xFE, 0x40, 0x2F, 0xFF, 0x40, 0x90, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0xAA, 0xFF,
-    0x43, 0xFE, 0x6C, 0x0C, 0x00, 0xD0, 0x24, 0x1E, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFE, 0x01, 0x51, 0xBC, 0x00, 0x00, 0xB0, 0x00, 0x01, 0xC1,
-    0xAF, 0xFF, 0x0F, 0xE9, 0xB4, 0x24, 0x03, 0x80, 0x70, 0x78, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x43, 0xC0, 0x03, 0xC2, 0xE0, 0x01, 0xA0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0x41, 0xF8,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x2A, 0xBF, 0xD0, 0x0F, 0xF9, 0xB0, 0x03, 0x00, 0x34,
-    0x00, 0x90, 0x78, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x01, 0xFF, 0xF8, 0x01, 0x41, 0xBC, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1C, 0x06, 0xBF, 0xFC,
-    0x0F, 0xE9, 0xB4, 0x09, 0x00, 0xE0, 0x07, 0x07, 0xC0, 0x0F, 0xFF, 0x40, 0x1F, 0x0F, 0x40, 0x19,
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x06, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x00, 0x03, 0xD2,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFD,
-    0x0B, 0x80, 0x01, 0xF0, 0x7F, 0x07, 0xC0, 0x00, 0x3D, 0x2F, 0x87, 0xC0, 0x00, 0x0B, 0xCB, 0xD3,
-    0xD0, 0x00, 0x00, 0xF3, 0xF3, 0xD0, 0x00, 0x00, 0x3E, 0xFA, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0x7F, 0x9F, 0xD0,
-    0x00, 0xBF, 0x4F, 0xE3, 0xFC, 0x00, 0xBF, 0x87, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x64, 0x28, 0x00,
-    0x00, 0x0F, 0x47, 0xC0, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x50, 0x04, 0x00, 0x3C, 0x2F, 0x47, 0x80, 0x02, 0xD3, 0xF1, 0xE0, 0x00,
-    0x0F, 0x3E, 0x78, 0x00, 0x00, 0xF7, 0xDE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFB, 0xFB, 0xD0, 0x00, 0xBE,
-    0x7E, 0x7F, 0x00, 0x3F, 0x8F, 0xE3, 0xF8, 0x00, 0x00, 0x74, 0x3C, 0x00, 0xF4, 0x7C, 0x01, 0xA0,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0xFF, 0xD0, 0x01, 0x00, 0xF0, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0xE0, 0x00, 0x5B, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xC0, 0x00,
-    0x03, 0x80, 0xA4, 0x6F, 0x00, 0xFF, 0xFD, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x19, 0x00, 0x7C, 0x3D, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00,
-    0x01, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x28, 0x00, 0x2E, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x01, 0x57, 0xC0,
-    0x00, 0xB4, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xD0, 0x00, 0x0E, 0x00, 0x01,
-    0xE0, 0x28, 0x7C, 0x0B, 0xFF, 0x80, 0x1F, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x7F, 0xFC, 0x00, 0x02,
-    0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x01, 0x6D, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x01,
-    0x83, 0xD0, 0x7F, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x05, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xC0, 0x0F,
-    0xD0, 0x1F, 0x00, 0xFF, 0x00, 0xB8, 0x0B, 0xFC, 0x03, 0xC0, 0x7E, 0xE0, 0x1F, 0x07, 0xCF, 0x40,
-    0xB8, 0x3C, 0x7C, 0x03, 0xD3, 0xD2, 0xF0, 0x0F, 0x2E, 0x0F, 0x80, 0x7E, 0xE0, 0x7D, 0x03, 0xFF,
-    0x03, 0xF0, 0x0F, 0xF0, 0x0F, 0xC0, 0x7F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x7C, 0x0B, 0x01, 0xF8, 0x0E, 0x07, 0x74, 0x0D,
-    0x0D, 0x30, 0x1C, 0x38, 0xB0, 0x2C, 0xE0, 0xE0, 0x3B, 0x80, 0xD0, 0x7F, 0x02, 0xC0, 0xBC, 0x03,
-    0xC0, 0x00, 0x02, 0x80, 0x90, 0x00, 0x1F, 0x0B, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x68, 0x03, 0xD0, 0x07, 0xE0, 0x0F, 0x00, 0x3F, 0x40, 0x78, 0x03, 0xFC, 0x02,
-    0xD0, 0x2F, 0xF0, 0x0F, 0x02, 0xEB, 0x80, 0x7C, 0x1F, 0x3D, 0x02, 0xE0, 0xF1, 0xF0, 0x0F, 0x4F,
-    0x4B, 0xC0, 0x3C, 0xF4, 0x3E, 0x01, 0xFB, 0x81, 0xF4, 0x0F, 0xFC, 0x0F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0x01, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x28, 0x18, 0x00, 0xB8, 0x3C, 0x00, 0xF8, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x7C, 0x0B, 0x01, 0xF8, 0x0E, 0x07, 0x74, 0x0D, 0x0D, 0x30,
-    0x1C, 0x38, 0xB0, 0x2C, 0xE0, 0xE0, 0x3B, 0x80, 0xD0, 0x7F, 0x02, 0xC0, 0xBC, 0x03, 0xC0, 0x00,
-    0x00, 0x90, 0xA0, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x2F, 0xAB, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x02,
-    0xF0, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0xBC, 0x0B, 0x40, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x1E,
-    0x00, 0x00, 0xB4, 0x2D, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xD0, 0x2F,
-    0xEA, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x07, 0xC3, 0xD0, 0x2A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0xB8, 0x78, 0x07, 0x40, 0x70, 0x38, 0x01, 0xC1, 0xD0, 0x0B, 0x07, 0x00,
-    0x3C, 0x2C, 0x02, 0xD0, 0xBE, 0xBF, 0x00, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF9, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0x40, 0x3C, 0x00, 0xF0, 0x00, 0xB4, 0x0B, 0x80,
-    0x02, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x7C, 0x07, 0xC0, 0x02, 0xE0, 0x1F, 0x40, 0x2F,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x0F, 0xAB, 0x40, 0xF0, 0x0F, 0x0B, 0x00, 0x3C, 0x3F, 0xFF, 0xE0, 0xE0, 0x07,
-    0x43, 0x80, 0x3C, 0x0F, 0xAB, 0xD0, 0x2F, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0x90, 0xA0,
-    0x00, 0x0F, 0x47, 0xC0, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xD0,
-    0x0F, 0x00, 0x3C, 0x00, 0x2D, 0x02, 0xE0, 0x00, 0xB4, 0x0F, 0xFF, 0xFF, 0xC0, 0x3D, 0x00, 0x1F,
-    0x01, 0xF0, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x00, 0xF4, 0x7C, 0x00, 0xA4, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xEA, 0xD0, 0x0F,
-    0x00, 0xF0, 0x2C, 0x00, 0xF0, 0x3F, 0xFF, 0xE0, 0x38, 0x01, 0xD0, 0x38, 0x03, 0xC0, 0x3E, 0xAF,
-    0x40, 0x2F, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0A, 0x02, 0x40, 0x01, 0xF0, 0xB4, 0x00, 0x2F,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xB9, 0x6F, 0x00,
-    0x2C, 0x00, 0xB4, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x38, 0x00, 0x2A, 0xAB, 0x80, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0x40, 0xBD, 0x07, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xF0, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x60, 0x0B, 0x83, 0xC0,
-    0x3E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xA0, 0x2C, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x2C, 0x04, 0x02, 0xE0, 0x3F, 0xFE, 0x00, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x02, 0x40, 0x38, 0x02, 0xC0, 0x0B, 0x00, 0xE0, 0x01, 0xD0, 0xF0, 0x00, 0x38,
-    0x78, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00, 0x3C, 0x1D, 0x00,
-    0x0F, 0x0F, 0x00, 0x02, 0xEB, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x00, 0x0F, 0x47, 0xC0, 0x07, 0xD2, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xD0, 0x0F, 0x00, 0xB0, 0x02, 0xC0, 0x78, 0x00, 0x74,
-    0x3C, 0x00, 0x0E, 0x1E, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xE4,
-    0x00, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x0B, 0xC3, 0xD0, 0x02, 0xA1, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xF0, 0x07, 0x40, 0x74, 0x00, 0xE0, 0x3C, 0x00,
-    0x3C, 0x1D, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0xEB, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xA0, 0x02, 0xD0, 0x0B, 0x40, 0x19,
-    0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x09, 0x00, 0x0E, 0x00,
-    0xB0, 0x00, 0x2C, 0x03, 0x80, 0x00, 0x74, 0x2C, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x03, 0xCF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0xB0, 0x03, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x03, 0xC0, 0x01, 0xD0, 0x1D,
-    0x00, 0x03, 0x80, 0xF0, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xBA, 0xD0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xE0, 0xF0, 0x0F, 0x47, 0xC0, 0x28, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x03, 0x83, 0x80, 0x0D, 0x0D, 0x00, 0xB0, 0x70, 0x03, 0xC2, 0xC0, 0x0E, 0x0E, 0x00, 0xF4,
-    0x3C, 0x0B, 0xC0, 0xBF, 0xFF, 0x00, 0xBE, 0x78, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C,
-    0x00, 0x02, 0x42, 0x80, 0xB8, 0x3C, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
-    0x14, 0x0C, 0x02, 0x01, 0xC0, 0x30, 0x28, 0x03, 0x03, 0x40, 0x36, 0xF0, 0x02, 0xFB, 0x00, 0x00,
-    0xA0, 0x00, 0x0D, 0x00, 0x01, 0xFF, 0xFE, 0x02, 0xD5, 0x54, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00,
-    0x07, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x42, 0xC0, 0x00, 0xE0, 0x00, 0x34, 0x00, 0x1C, 0x00, 0x0B, 0x00, 0x03, 0x80,
-    0x01, 0xE0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xB0, 0x00, 0x00, 0x2E, 0x0F,
-    0x00, 0x00, 0x02, 0x91, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0xC0, 0x00, 0x07, 0xC0, 0x1C, 0x00, 0x00, 0xB8, 0x02, 0xC0, 0x00, 0x0F,
-    0x40, 0x38, 0x00, 0x00, 0xF0, 0x03, 0x40, 0x00, 0x2E, 0x00, 0x7F, 0xF4, 0x03, 0xD0, 0x0F, 0x01,
-    0xD0, 0x3C, 0x00, 0xE0, 0x0D, 0x07, 0xC0, 0x1D, 0x00, 0xD0, 0xF8, 0x02, 0xC1, 0xBC, 0x0F, 0x40,
-    0x3F, 0xFF, 0x42, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x02, 0x80, 0x00, 0xF0, 0xB8, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xD0, 0xB0, 0x00, 0x1C, 0x0F, 0x00, 0x02, 0xC0, 0xFF, 0x90,
-    0x38, 0x0D, 0x02, 0x83, 0x41, 0xC0, 0x28, 0xB0, 0x2C, 0x03, 0x8F, 0x03, 0xEB, 0xF0, 0xE0, 0x3F,
-    0xF8, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00,
-    0xF0, 0x02, 0xC0, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x07, 0x82, 0xD0, 0x00, 0x00, 0xF2, 0xE0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x02, 0xFB, 0xD0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x02, 0xF4, 0x07,
-    0xE0, 0x02, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x28, 0x01, 0xC0, 0xA0, 0x00, 0xE2, 0xC0, 0x00,
-    0xBB, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFD, 0x00, 0x07, 0x8F, 0x00, 0x1E, 0x0F,
-    0x40, 0x7C, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x1F, 0xFF, 0xC0, 0x2A,
-    0xAA, 0x1F, 0xFF, 0xC0, 0x1A, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xD0, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA9, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xA9, 0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x18, 0x02, 0x80, 0x90, 0x0D, 0x03, 0x00, 0x30, 0x1C, 0x01, 0x80, 0xA0, 0x0D, 0x03, 0x00, 0x30,
-    0x0C, 0x01, 0xC0, 0xA0, 0x0A, 0x03, 0x40, 0x30, 0x0C, 0x00, 0xC0, 0x60, 0x0A, 0x02, 0x40, 0x34,
-    0x0C, 0x00, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x92, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x4A, 0xAA, 0xAA, 0xA0, 0x14, 0x03, 0xE0,
-    0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x28, 0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x68, 0x00, 0x01, 0x40,
-    0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x14, 0x03, 0xE0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x28,
-    0x14, 0x14, 0x03, 0xE3, 0xE0, 0x2F, 0x2F, 0x00, 0xF4, 0xF0, 0x0B, 0xCB, 0xC0, 0x28, 0x28, 0x01,
-    0x41, 0x40, 0xBC, 0xFC, 0x0F, 0x8F, 0x41, 0xF1, 0xF0, 0x3D, 0x3D, 0x06, 0x86, 0x80, 0x01, 0x40,
-    0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x06, 0x80, 0x3E, 0x3E, 0x02, 0xF2, 0xF0, 0x0F, 0x4F, 0x40, 0xBC,
-    0xBC, 0x02, 0x92, 0x90, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xD0, 0x00,
-    0x30, 0x00, 0x1D, 0x51, 0xFF, 0xFD, 0x53, 0x80, 0x00, 0xC0, 0x00, 0x70, 0x00, 0x28, 0x00, 0x0D,
-    0x00, 0x03, 0x00, 0x01, 0xC0, 0x00, 0xA0, 0x00, 0x34, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x01, 0x80,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x30, 0x00, 0x01,
-    0xC0, 0x00, 0x0A, 0x00, 0x00, 0x34, 0x00, 0x00, 0xD5, 0x00, 0xFF, 0xFE, 0x01, 0x38, 0x00, 0x00,
-    0xD0, 0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xA0, 0x00, 0x17, 0x94, 0x03, 0xFF, 0xE0, 0x00,
-    0x70, 0x00, 0x02, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0xFF, 0xFD, 0x03, 0xFF,
-    0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xFF, 0x0B, 0xFF, 0xFC, 0x3F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x00,
-    0x0D, 0x07, 0xE2, 0xF8, 0xA0, 0x00, 0x00, 0x0A, 0x1E, 0x3E, 0x0A, 0x1E, 0x3E, 0x0A, 0x00, 0xA0,
-    0x18, 0x1E, 0x02, 0xE0, 0x3C, 0x3E, 0x03, 0xD0, 0xBC, 0x25, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x05,
-    0x00, 0x30, 0x02, 0x10, 0x09, 0x00, 0x26, 0x02, 0x80, 0x03, 0x20, 0x70, 0x00, 0x3C, 0x1C, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x02, 0xC5,
-    0x00, 0x00, 0x71, 0x55, 0x40, 0x1D, 0x25, 0x94, 0x03, 0x82, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x68, 0x00, 0x01, 0x41, 0x40, 0xBC, 0xFC, 0x0F, 0x8F, 0x41,
-    0xF1, 0xF0, 0x3D, 0x3D, 0x06, 0x86, 0x80, 0x00, 0x00, 0x00, 0x18, 0x0D, 0x0D, 0x3C, 0x1C, 0x1D,
-    0x34, 0x38, 0x2C, 0x60, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x30, 0x34, 0x28, 0x0C, 0x00, 0x00,
-    0x00, 0x28, 0x70, 0x3C, 0x74, 0x1C, 0x38, 0x09, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x34,
-    0x28, 0x34, 0x38, 0x2C, 0x28, 0x2C, 0x0C, 0x0C, 0x0C, 0x09, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x2B,
-    0x47, 0x47, 0x40, 0x00, 0x10, 0x1D, 0x0B, 0x03, 0x80, 0x7C, 0x02, 0xE0, 0x0F, 0x00, 0x10, 0x40,
-    0x07, 0x40, 0x0E, 0x00, 0x2C, 0x03, 0xD0, 0xF8, 0x0F, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x3C, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x1F,
-    0x40, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x06, 0x7F, 0xFC,
-    0x00, 0x90, 0x00, 0xF5, 0xFE, 0x00, 0x2E, 0x00, 0x1F, 0x6F, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xC0, 0x00, 0xB0,
-    0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x01, 0xD0, 0x00, 0xB0, 0x00, 0x3C, 0x00,
-    0x1E, 0x00, 0x0B, 0x40, 0x00, 0x40, 0x01, 0x40, 0x00, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFE, 0xF8, 0x01, 0x1C, 0x3C, 0x00,
-    0x2C, 0x3C, 0x00, 0x38, 0x38, 0x00, 0x78, 0xB4, 0x00, 0xB5, 0xE0, 0x00, 0xFB, 0xC0, 0x00, 0xFF,
-    0x00, 0x01, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2A,
-    0xAA, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x30, 0x09, 0x3E, 0xB8, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x99, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xAA, 0x40, 0x00, 0x20, 0x00, 0x02, 0x00,
-    0x84, 0x66, 0x9A, 0xE4, 0x1F, 0x02, 0xD0, 0xA9, 0xD9, 0x54, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x2F, 0xE0, 0x07, 0xEB, 0xE1, 0xFA, 0xFC,
-    0x05, 0x00, 0xF0, 0x40, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x02, 0xD0, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x01, 0xFC,
-    0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x02,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x0B, 0x40, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00, 0x68, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x0B, 0xAB, 0xD0, 0x10, 0x90, 0x1F, 0x0E, 0x00, 0x00,
-    0xF0, 0xD0, 0x00, 0x0E, 0x1C, 0x00, 0x02, 0xD3, 0xC0, 0x00, 0x78, 0x38, 0x00, 0x1F, 0x07, 0x40,
-    0x0B, 0xC0, 0xF0, 0x07, 0xF0, 0x0F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03,
-    0xC0, 0x19, 0x00, 0x14, 0x00, 0x00, 0x05, 0x00, 0x28, 0x01, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0xBC,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xEB, 0xF0,
-    0x00, 0x08, 0x80, 0x2D, 0x00, 0x0B, 0x00, 0x07, 0x40, 0x03, 0x80, 0x02, 0xD0, 0x01, 0xD0, 0x00,
-    0xF0, 0x00, 0xB0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x1D, 0x01, 0xF8, 0x00, 0x0B, 0x03,
-    0xF8, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x01, 0xE0, 0x7C, 0x00, 0x00, 0xB4, 0x2E, 0x00, 0x00, 0x3C,
-    0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0xA0, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x2D, 0x1C, 0x00, 0x00, 0x0F, 0x0D, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2C, 0xB0, 0x00, 0x00, 0x0D, 0x3C, 0x00,
-    0x00, 0x0B, 0x1A, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x20, 0x82, 0x48, 0x62, 0x47, 0xF0,
-    0x14, 0x00, 0x00, 0x00, 0x90, 0x64, 0x4C, 0x7F, 0x82, 0x80, 0x0A, 0x81, 0x40, 0x20, 0x02, 0xA4,
-    0x02, 0x4B, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x80, 0x3A, 0x03, 0x18, 0x61, 0x43, 0xE0, 0x00, 0x00,
-    0x2A, 0x40, 0x50, 0x30, 0x28, 0x0C, 0x0B, 0x02, 0x40, 0x01, 0x00, 0x88, 0x14, 0xC1, 0xF0, 0x20,
-    0x8A, 0x28, 0x29, 0x00, 0x01, 0x40, 0x8C, 0x20, 0x83, 0x0C, 0x1E, 0xC0, 0x24, 0x7E, 0x00, 0x00,
-    0x01, 0x40, 0x07, 0xFF, 0xC0, 0x2F, 0x07, 0x40, 0xF0, 0x1D, 0x07, 0x80, 0x74, 0x2C, 0x03, 0xC0,
-    0xF0, 0x0F, 0x07, 0xC0, 0x78, 0x2E, 0x02, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0x10, 0x00, 0x92, 0x40,
-    0x60, 0x60, 0x32, 0x18, 0x1C, 0xC9, 0x0A, 0x03, 0x02, 0xC3, 0x80, 0xBF, 0xC0, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xC0, 0x30, 0x14, 0x08, 0x03, 0x0B, 0xF0, 0x06, 0x80, 0x49, 0x00, 0x90, 0x1C, 0x0B,
-    0x03, 0xD0, 0x7F, 0x40, 0x05, 0x40, 0x05, 0x00, 0x40, 0xB8, 0x00, 0xC1, 0x28, 0x7E, 0x00, 0x00,
-    0x00, 0x1C, 0x05, 0x81, 0x54, 0x3F, 0xC0, 0x30, 0x07, 0x00, 0x0A, 0x80, 0x40, 0x10, 0x01, 0xA4,
-    0x02, 0x47, 0xE0, 0x00, 0x00, 0x01, 0x90, 0x90, 0x2A, 0x43, 0x8C, 0x30, 0xC3, 0x18, 0x2E, 0x00,
-    0x2A, 0x80, 0x18, 0x03, 0x00, 0x70, 0x0D, 0x01, 0xC0, 0x24, 0x00, 0x00, 0x40, 0x82, 0x0C, 0x90,
-    0xF8, 0x30, 0xC3, 0x1C, 0x2E, 0x00, 0x01, 0x40, 0x89, 0x14, 0x62, 0x49, 0x0A, 0xC0, 0x18, 0x3F,
-    0x00, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x01, 0xC0, 0x00, 0xD0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38,
-    0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x40, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x00,
-    0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x38, 0x00,
-    0x0F, 0x00, 0x01, 0x40, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x34, 0x00, 0x02,
-    0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0B,
-    0x00, 0x00, 0x70, 0x00, 0x03, 0x40, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80,
-    0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x1C, 0x38, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xE2, 0xC0, 0x00, 0x3F, 0xC3, 0x40, 0x00,
-    0xFB, 0x8B, 0x00, 0x01, 0xF7, 0x0D, 0x00, 0x03, 0xDE, 0x2C, 0x00, 0x07, 0xDC, 0x34, 0x00, 0x0B,
-    0xF8, 0xB0, 0x00, 0x0F, 0xF0, 0xD0, 0x00, 0x0F, 0xF2, 0xC1, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0E, 0xFF, 0xF8, 0x00, 0x2C, 0x34, 0x00, 0x00, 0x34,
-    0xB0, 0x00, 0x00, 0xB0, 0xC0, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0xEE, 0x02, 0xF0, 0x0F, 0x90, 0x3F, 0x02,
-    0xC0, 0x03, 0xF8, 0x38, 0x00, 0x3F, 0xFB, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07,
-    0xFF, 0x40, 0x02, 0xE4, 0x2C, 0x00, 0x38, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0xBE, 0xA8, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x1B, 0xEA, 0x40, 0x03, 0xFF, 0xF4, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xFA, 0x90, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x02, 0xE0, 0x01, 0xFD, 0x00, 0xF0,
-    0x00, 0xBF, 0x40, 0x7C, 0x00, 0x3E, 0xE0, 0x2E, 0x00, 0x1F, 0x7C, 0x0F, 0x40, 0x0B, 0x8F, 0x07,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x46, 0xF5, 0xFE, 0xF9, 0x40, 0xFC, 0x2E, 0x7C, 0x00, 0x3E, 0x07,
-    0xEE, 0x00, 0x1F, 0x40, 0xFF, 0x40, 0x0F, 0xC0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0xFA, 0xBE, 0x00, 0x0B, 0x40, 0x3C, 0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xF0,
-    0x0B, 0x80, 0x07, 0x80, 0x7C, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x24, 0x0D, 0x00, 0x00, 0x00, 0xD0, 0x34, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00,
-    0x1C, 0x1F, 0x00, 0x1F, 0xC0, 0xBF, 0xF4, 0x01, 0xD5, 0x03, 0xFF, 0x40, 0x09, 0x00, 0x0F, 0xEF,
-    0x00, 0x38, 0x00, 0x78, 0x2C, 0x00, 0xBD, 0x02, 0xD0, 0xB0, 0x00, 0xBD, 0x0F, 0x03, 0xC0, 0x00,
-    0x38, 0x3C, 0x0F, 0x00, 0x66, 0xE1, 0xF0, 0x3C, 0x03, 0xFF, 0x0B, 0x81, 0xF0, 0x0B, 0xF4, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x38, 0x00, 0x0D, 0x03, 0x80, 0x01, 0xC0, 0x34, 0x00, 0x28, 0x03, 0x43,
-    0x43, 0x42, 0xFF, 0xFF, 0xFE, 0x2B, 0xEF, 0xEF, 0x80, 0x35, 0xF8, 0xE0, 0x03, 0x6E, 0xCC, 0x00,
-    0x3B, 0xAE, 0xC0, 0x03, 0xF2, 0xF8, 0x00, 0x3F, 0x1F, 0x40, 0x03, 0xD1, 0xF0, 0x00, 0x3C, 0x1F,
-    0x00, 0x03, 0x81, 0xE0, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x40, 0x2F, 0x57,
-    0xC0, 0xB0, 0x0F, 0x00, 0x34, 0x38, 0x03, 0x40, 0x0D, 0x0D, 0x01, 0xC1, 0x83, 0x47, 0x00, 0xB0,
-    0xE1, 0xC2, 0xC0, 0x38, 0x34, 0xB0, 0xE0, 0x0D, 0x0C, 0x00, 0x34, 0x07, 0x07, 0x00, 0x2C, 0x02,
-    0xC0, 0xE0, 0x1F, 0x00, 0xD0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x17, 0xD4, 0x00, 0xBC, 0xD0, 0x00, 0xE7, 0xF0,
-    0x00, 0xA0, 0x3C, 0x00, 0x30, 0x0D, 0x00, 0x28, 0x0B, 0x00, 0x0B, 0x47, 0xC0, 0x01, 0xFF, 0xE0,
-    0x00, 0x2F, 0xA4, 0x00, 0x15, 0x55, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x10, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE1, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x1B, 0xE4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x13, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xAB, 0xE0, 0x00, 0x07, 0x40, 0x3C, 0x00, 0x2B, 0xEA, 0xAF,
-    0xA8, 0x0A, 0xFA, 0xAB, 0xE9, 0x00, 0x78, 0x07, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0x90, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x1F,
-    0xFF, 0xF0, 0x0F, 0xE7, 0x01, 0x02, 0xF0, 0x70, 0x00, 0x7D, 0x0A, 0x00, 0x0B, 0xC0, 0xD0, 0x00,
-    0xF4, 0x0C, 0x00, 0x1F, 0x00, 0xD0, 0x01, 0xF0, 0x1F, 0xFE, 0x2E, 0x02, 0x97, 0xF3, 0xF0, 0x34,
-    0x34, 0x3F, 0x83, 0x1F, 0x42, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x6A, 0xAA, 0xAA, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xAA, 0xAA, 0xA8, 0x07, 0xF9,
-    0x15, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x02, 0xFC, 0x07,
-    0xFA, 0x03, 0xCC, 0x01, 0xD3, 0x00, 0xF1, 0x80, 0x38, 0x90, 0x0E, 0x30, 0x03, 0xEC, 0x00, 0xFF,
-    0xE0, 0x0B, 0xFC, 0x00, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x2A, 0xAF, 0x6A, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x28, 0x00, 0x01, 0xC0, 0x1F, 0xFF, 0xC0, 0x0B,
-    0x00, 0x3F, 0x90, 0x03, 0xF8, 0x00, 0x02, 0xC0, 0x00, 0x2D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x01, 0xC6, 0x40, 0x2F, 0xF0, 0x1F, 0xD0, 0x03,
-    0xB4, 0x50, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x02, 0xC0, 0xD0, 0xF0, 0x1E, 0xB8, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xFF, 0xD0,
-    0x03, 0xFE, 0xE0, 0x0B, 0x68, 0xF0, 0x0F, 0x34, 0xA0, 0x0D, 0x30, 0xD0, 0x1C, 0x30, 0xC0, 0x28,
-    0x61, 0xC0, 0x34, 0x92, 0x80, 0x30, 0xC3, 0x40, 0x70, 0xC7, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00,
-    0x03, 0xEA, 0xF8, 0x00, 0x07, 0x40, 0x3C, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x38, 0x00,
-    0x1E, 0x01, 0xF0, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x40, 0x05, 0xBC, 0x00, 0x00, 0x2A,
-    0xFE, 0xA0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0x00, 0x00, 0x34, 0x00, 0x02,
-    0xC0, 0x1D, 0x0D, 0x6F, 0xE0, 0xFF, 0x90, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xFD, 0x00, 0x1E, 0xED, 0x02, 0xC7,
-    0x2C, 0x38, 0x28, 0x38, 0x00, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x28, 0x00, 0x00, 0xD0, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xD0, 0x29, 0x00, 0xC0, 0x6F, 0xE6, 0xC0,
-    0x01, 0xBF, 0x80, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x70, 0x00, 0xD0,
-    0xC0, 0xD0, 0xE3, 0x8F, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x18, 0x00, 0xC0, 0x66, 0x40, 0x90, 0x2A,
-    0xF9, 0x1B, 0xE7, 0x07, 0xE4, 0x00, 0x01, 0xBC, 0x38, 0x00, 0x00, 0x07, 0x40, 0xE0, 0x00, 0x01,
-    0xD0, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x7F, 0x00, 0xAA, 0xE0, 0xD3, 0x4D, 0x00,
-    0xC0, 0x00, 0x60, 0x00, 0x24, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x00, 0x24, 0x00, 0x06,
-    0x00, 0x00, 0xC0, 0x1D, 0x30, 0x90, 0xEA, 0xB0, 0x07, 0xF0, 0x00, 0x30, 0x00, 0x00, 0x6B, 0x07,
-    0xFA, 0x40, 0x7E, 0x00, 0x07, 0x3D, 0x00, 0x70, 0x7D, 0x07, 0x00, 0xBC, 0x30, 0x00, 0x90, 0x07,
-    0x94, 0x00, 0x05, 0xBF, 0xC0, 0x00, 0x7F, 0x00, 0x0B, 0x9C, 0x02, 0xE0, 0x70, 0x7D, 0x01, 0xC2,
-    0x40, 0x07, 0x00, 0x20, 0x00, 0x34, 0x00, 0x2C, 0x09, 0x0D, 0x0C, 0x0B, 0x0C, 0x03, 0x58, 0x02,
-    0xE4, 0x00, 0xF0, 0xFF, 0xF0, 0x05, 0xA0, 0x00, 0x14, 0x00, 0x38, 0x80, 0x70, 0x90, 0xE0, 0x60,
-    0xC0, 0x32, 0x80, 0x37, 0x00, 0x2E, 0x00, 0x1F, 0xFD, 0x0A, 0x50, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2C, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x04, 0x40, 0x00, 0x0D, 0x28, 0x00, 0x1F, 0x0F, 0x40, 0x2D, 0xC3, 0x74, 0x2D, 0x21, 0x8B, 0x2C,
-    0x14, 0x90, 0xD0, 0x08, 0x30, 0x00, 0x03, 0x1C, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x93, 0x00, 0x00,
-    0x30, 0xC0, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xD2, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x83, 0x00,
-    0x00, 0x14, 0x90, 0x00, 0x02, 0x18, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x20, 0xC0, 0x0A, 0x06, 0x24,
-    0x24, 0xF0, 0xC6, 0x1D, 0x0B, 0x70, 0xCE, 0x00, 0x7D, 0x3F, 0x00, 0x07, 0x8B, 0x00, 0x00, 0x21,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0xD0, 0x00,
-    0x07, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x2C, 0x00, 0x00, 0x03, 0xC3, 0x80,
-    0x00, 0x02, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x3C, 0x02, 0xC0, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x07, 0xF4, 0x00, 0x35, 0xFE, 0x03, 0xC5, 0x28, 0x3F,
-    0x14, 0x01, 0xCC, 0x50, 0x00, 0x31, 0x40, 0x00, 0xC5, 0x00, 0x03, 0x14, 0x00, 0x0C, 0x50, 0x07,
-    0x31, 0x40, 0x0F, 0xC5, 0x00, 0x0F, 0x14, 0xA0, 0x0D, 0x7F, 0x80, 0x1F, 0xD0, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0A,
-    0x00, 0x01, 0x03, 0x40, 0x1F, 0xF1, 0xC0, 0x1E, 0x0A, 0xD0, 0x0E, 0x00, 0xF0, 0x07, 0x00, 0x38,
-    0x02, 0xC0, 0x1C, 0x00, 0xB8, 0x6D, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0xA0, 0x00, 0xBE, 0xAF, 0xF0, 0x00, 0xFC, 0x01, 0xF4, 0x00,
-    0xBC, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0xEB, 0xC0, 0x2D, 0x00, 0xE1, 0xE0, 0x0F, 0x00, 0xE0, 0x78,
-    0x07, 0x80, 0xE0, 0x2D, 0x02, 0xD0, 0xE0, 0x0F, 0x00, 0xB4, 0xE0, 0x0B, 0x80, 0x3F, 0xE0, 0x0B,
-    0xD0, 0x0B, 0xFA, 0xAF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xD1, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x1E, 0xE0, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x0B, 0x43, 0xD0, 0x07, 0x80,
-    0xB8, 0x03, 0xC0, 0x1F, 0x03, 0xD0, 0x07, 0xC2, 0xE0, 0x00, 0xF1, 0xFA, 0xAA, 0xBD, 0xBF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xB4, 0x2D, 0x00, 0x3C, 0x0B, 0x00, 0x0E, 0x03, 0x80, 0x07,
-    0x40, 0xD0, 0x02, 0xC0, 0x70, 0x00, 0xF0, 0x2C, 0x00, 0x38, 0x0E, 0x00, 0x1D, 0x03, 0x40, 0x0B,
-    0x01, 0xC0, 0x03, 0xC0, 0xB0, 0x00, 0xE0, 0x38, 0x00, 0x24, 0x0A, 0x00, 0x0F, 0x02, 0xC0, 0x02,
-    0xC0, 0x70, 0x00, 0x74, 0x0E, 0x00, 0x0E, 0x03, 0xC0, 0x02, 0xC0, 0xB0, 0x00, 0x70, 0x1D, 0x00,
-    0x0D, 0x03, 0x80, 0x03, 0x80, 0xF0, 0x00, 0xB0, 0x2C, 0x00, 0x2D, 0x07, 0x40, 0x2F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30,
-    0x00, 0x01, 0x80, 0x00, 0x28, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x07, 0xFF, 0xF0, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x50, 0xF4,
-    0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFD, 0x1F, 0x80, 0x3E, 0xBD, 0xFB, 0x41, 0xC0, 0x3D, 0x06, 0x0D, 0x00, 0xE0,
-    0x18, 0x30, 0x03, 0x40, 0xD0, 0xD0, 0x7F, 0xAF, 0x03, 0xFF, 0xAF, 0xF0, 0x07, 0xF8, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x41, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x09, 0x0F, 0x0D,
-    0x1C, 0x09, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x20, 0x3C, 0x34, 0xB0, 0x20, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x24, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x75, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0x07, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x38, 0x14, 0x01, 0xFF, 0xFF, 0xD0, 0x02, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x40, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x19, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0xFF, 0xE9, 0x50, 0x00, 0x01, 0x6A, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xBF, 0xD0, 0x1B, 0xFF, 0x90, 0x0F, 0xF9, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x5A, 0xFF, 0xE0, 0xBE, 0x95, 0x00, 0x00,
+static const uint8_t opendyslexic_8_italicBitmaps[18327] = {
+    0x6D, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x18, 0x7D, 0x3B, 0x43, 0xBC, 0x8A, 0x37, 0xBA, 0x09, 0x92,
+    0x0D, 0x41, 0xF1, 0xDD, 0xA6, 0x48, 0x61, 0x21, 0xDB, 0x6B, 0x24, 0x17, 0x2E, 0xEE, 0x6E, 0x27,
+    0xA4, 0x44, 0x40, 0x90, 0x12, 0x45, 0x54, 0xA4, 0xA3, 0x41, 0x8A, 0x8B, 0x2B, 0x5C, 0x5C, 0x72,
+    0x1B, 0x10, 0x4A, 0x83, 0x94, 0xAB, 0x68, 0x41, 0xA2, 0x40, 0x0A, 0x45, 0x5C, 0x58, 0x60, 0xA4,
+    0x8B, 0x6F, 0x12, 0x17, 0x28, 0x0A, 0xC5, 0x46, 0x20, 0x51, 0x66, 0x15, 0x25, 0x05, 0x46, 0xA0,
+    0x01, 0x16, 0xE1, 0x90, 0xBB, 0x1B, 0xDE, 0xAC, 0x9D, 0x28, 0x42, 0xAC, 0x3D, 0x77, 0xDA, 0x99,
+    0xF9, 0x7E, 0xDE, 0xF7, 0xDE, 0xF7, 0x1D, 0x02, 0x04, 0x06, 0x1B, 0x58, 0x45, 0x1D, 0x11, 0xA4,
+    0x09, 0x72, 0xBE, 0x34, 0xD1, 0x40, 0xA4, 0xA1, 0x03, 0x8D, 0x12, 0x37, 0x91, 0x02, 0x33, 0xB3,
+    0xEA, 0xED, 0x9D, 0x07, 0x76, 0xAF, 0x9B, 0xA8, 0xA9, 0x0F, 0xFB, 0x40, 0xBE, 0x02, 0x84, 0x34,
+    0x44, 0x53, 0xA1, 0x7A, 0x8B, 0x9C, 0x73, 0x76, 0xF6, 0xE6, 0x7B, 0xE7, 0x10, 0xE4, 0x1D, 0x40,
+    0x49, 0x9E, 0xAD, 0xD7, 0x80, 0xF3, 0x8F, 0xBE, 0x3D, 0xEB, 0xCF, 0x0A, 0x6C, 0x35, 0x40, 0xFF,
+    0x16, 0x88, 0xFD, 0xD9, 0xD9, 0x17, 0xE0, 0x9F, 0x17, 0x01, 0xF1, 0x09, 0xB7, 0x26, 0x5A, 0xBA,
+    0x31, 0xD2, 0x3B, 0x08, 0xFE, 0x59, 0x81, 0xEA, 0x18, 0xA4, 0x3F, 0x01, 0xBD, 0x31, 0x90, 0x38,
+    0x8D, 0x2F, 0x1C, 0xE4, 0x5B, 0xE3, 0xE0, 0x48, 0xCF, 0xA6, 0xCE, 0x5D, 0x75, 0xAE, 0x3C, 0xEE,
+    0x1E, 0x03, 0xAF, 0xD1, 0xCB, 0xC7, 0x95, 0x13, 0x0D, 0xAC, 0x84, 0xC5, 0x61, 0xF1, 0x91, 0xC8,
+    0x96, 0x97, 0x2F, 0xC8, 0xA9, 0x63, 0x48, 0xBF, 0x03, 0xCE, 0xEC, 0x01, 0xAB, 0x6B, 0xCC, 0x04,
+    0xB2, 0xB8, 0x80, 0x6F, 0x3E, 0xC0, 0x42, 0xA2, 0x05, 0xF6, 0x9F, 0x60, 0x02, 0xFC, 0xD5, 0x45,
+    0x5D, 0x1A, 0x61, 0xB6, 0xD0, 0x68, 0x03, 0x43, 0x8D, 0x38, 0x47, 0x74, 0x1F, 0xA7, 0xCA, 0xE6,
+    0x62, 0x8A, 0xBF, 0x77, 0x8A, 0xD0, 0xA6, 0x9F, 0x4E, 0x02, 0x37, 0xD9, 0x98, 0x9A, 0x68, 0x6F,
+    0x73, 0x76, 0xD0, 0x6D, 0xB6, 0x21, 0x33, 0x61, 0x88, 0x3B, 0x87, 0xC5, 0x1A, 0x8B, 0x36, 0x87,
+    0x1A, 0x42, 0x2D, 0x0C, 0x8A, 0xAA, 0x82, 0xA1, 0x2F, 0xE6, 0x1A, 0x77, 0x43, 0xCD, 0x42, 0xAE,
+    0x42, 0x81, 0x25, 0x5C, 0x03, 0xCF, 0x59, 0x8A, 0x95, 0x83, 0xEF, 0x0E, 0x9D, 0xF0, 0x0A, 0x4D,
+    0x22, 0xF0, 0x50, 0x6A, 0x5E, 0xE4, 0xCE, 0xF3, 0x1F, 0x61, 0xC6, 0x5B, 0x87, 0x80, 0xA3, 0x38,
+    0x26, 0xEE, 0xAC, 0x26, 0x85, 0x28, 0xA3, 0xF7, 0x6F, 0xCF, 0xE3, 0x30, 0x70, 0x82, 0x96, 0xE4,
+    0x29, 0xEB, 0x39, 0x9A, 0x2E, 0x78, 0x77, 0x44, 0xA3, 0x47, 0xF1, 0xEB, 0xB6, 0x35, 0x95, 0xBD,
+    0x7A, 0x3D, 0x76, 0x66, 0xDA, 0xC3, 0x81, 0x47, 0x4A, 0xCF, 0x3E, 0x24, 0xF9, 0xE1, 0xFA, 0x9C,
+    0x6B, 0x99, 0x6B, 0x95, 0x8B, 0xC1, 0x2B, 0xCB, 0xE8, 0xBF, 0x97, 0xC8, 0x0E, 0x03, 0xFF, 0xCF,
+    0xA5, 0xCC, 0x73, 0xC7, 0x48, 0xCF, 0x5F, 0x5A, 0xC1, 0xD3, 0x67, 0x4A, 0x63, 0x65, 0x19, 0xF9,
+    0xBC, 0x34, 0xF3, 0xE1, 0x9B, 0xF3, 0x51, 0x7D, 0x55, 0xCD, 0x75, 0x6A, 0xB0, 0x8D, 0xA0, 0x88,
+    0xC3, 0x3C, 0x76, 0x99, 0x72, 0x10, 0x7B, 0xFE, 0xE2, 0x65, 0xFC, 0x4A, 0xBF, 0x4D, 0xFA, 0xEF,
+    0xD0, 0x8D, 0x0D, 0x8A, 0x97, 0x1F, 0xF5, 0x26, 0xC3, 0x31, 0xA1, 0x06, 0xAE, 0x10, 0xFD, 0xCD,
+    0xCA, 0x69, 0xC7, 0x87, 0x90, 0x39, 0xE2, 0x0C, 0xDB, 0x88, 0x4A, 0x24, 0x8F, 0x74, 0xEA, 0x08,
+    0x58, 0x63, 0x98, 0xA3, 0xCF, 0xD3, 0x79, 0xE0, 0xA4, 0x07, 0xF3, 0x52, 0x0E, 0x6E, 0x32, 0x79,
+    0xA6, 0x25, 0xCC, 0x2B, 0x17, 0xB3, 0xD4, 0x21, 0x29, 0x2B, 0x41, 0xB0, 0xF4, 0x5A, 0x5A, 0xFC,
+    0x8D, 0xE6, 0x86, 0xAA, 0xC9, 0x7B, 0x0F, 0x7B, 0xEE, 0xD6, 0xF9, 0x1F, 0xD1, 0x45, 0x94, 0xA1,
+    0x4A, 0x44, 0xBA, 0x7C, 0xCE, 0x43, 0x96, 0xD4, 0xDE, 0x1E, 0xCE, 0x75, 0x81, 0x4D, 0x08, 0x86,
+    0x14, 0xBF, 0x94, 0xCA, 0x65, 0xC9, 0x43, 0xCF, 0x37, 0xE2, 0x11, 0x77, 0x49, 0x28, 0x4B, 0x14,
+    0x0D, 0x8D, 0xBA, 0x57, 0x28, 0xD8, 0x3A, 0xFF, 0x09, 0x2B, 0x32, 0xCA, 0xE9, 0x0A, 0x53, 0xE2,
+    0x4C, 0x50, 0x30, 0xE7, 0x26, 0xE9, 0x57, 0xF4, 0x4F, 0x49, 0x59, 0x76, 0xCD, 0x80, 0x58, 0x81,
+    0xE9, 0x3E, 0x36, 0xE7, 0x91, 0xCF, 0x09, 0xB3, 0x20, 0x4C, 0x07, 0x4F, 0x0A, 0x0C, 0xB3, 0xF0,
+    0x4A, 0xC1, 0xDA, 0x2C, 0xC0, 0xB6, 0x44, 0x9E, 0xDC, 0xC8, 0x22, 0x8A, 0xBC, 0xA7, 0xD5, 0x1B,
+    0x7A, 0xA3, 0x26, 0x75, 0x73, 0x0E, 0xC5, 0x46, 0x78, 0x25, 0xBF, 0x24, 0x9D, 0x0D, 0xBE, 0x34,
+    0xA8, 0x07, 0x81, 0x65, 0x07, 0x0C, 0x0B, 0x96, 0x24, 0x32, 0xE9, 0x41, 0xB9, 0xA5, 0x49, 0x30,
+    0x02, 0xCA, 0xF0, 0xE9, 0xCE, 0x8C, 0xB4, 0x31, 0xB6, 0x42, 0x33, 0x0B, 0x2F, 0xA8, 0x60, 0x84,
+    0xB0, 0x44, 0x5C, 0x20, 0xCD, 0xA0, 0x88, 0x64, 0xC8, 0x34, 0x2F, 0x72, 0x25, 0x99, 0x17, 0x14,
+    0xDF, 0xC7, 0x87, 0x2A, 0x41, 0xCF, 0x0A, 0xE7, 0xA9, 0x14, 0xDC, 0xDE, 0xA6, 0x53, 0xDE, 0xA0,
+    0x0D, 0x73, 0xC1, 0x71, 0x33, 0xE5, 0xFA, 0xB4, 0x6A, 0xEB, 0x67, 0x0C, 0x5F, 0xEC, 0x8B, 0xDD,
+    0x52, 0x60, 0x9D, 0x0D, 0x0F, 0xFF, 0xB9, 0x01, 0x82, 0x0E, 0x0D, 0x12, 0x4F, 0xAC, 0x2C, 0xBC,
+    0x38, 0xF8, 0x36, 0x55, 0x19, 0x4C, 0xD3, 0x11, 0xF0, 0x34, 0x59, 0x84, 0x04, 0x18, 0xBF, 0x93,
+    0x63, 0x11, 0x47, 0x28, 0x58, 0xA1, 0xEB, 0x97, 0xD1, 0xAF, 0x9D, 0x30, 0x27, 0xC3, 0x0B, 0xCB,
+    0x47, 0xE4, 0xF7, 0xF3, 0xD3, 0xF8, 0x73, 0x12, 0xA3, 0x35, 0xD3, 0x86, 0xA2, 0xC0, 0x84, 0xCF,
+    0x2D, 0x75, 0xE4, 0xD3, 0x31, 0x9F, 0x43, 0x67, 0x50, 0xF9, 0x22, 0x93, 0x18, 0x02, 0x8D, 0x0D,
+    0xC8, 0xBB, 0x64, 0x6A, 0x13, 0x8D, 0x50, 0x4B, 0xB3, 0x4E, 0xC8, 0x59, 0x8C, 0xAE, 0x74, 0xCE,
+    0x0C, 0xDD, 0x28, 0xD6, 0xE1, 0x4E, 0x81, 0x4B, 0x1E, 0x6E, 0xEB, 0xBC, 0xA9, 0x71, 0x24, 0xE8,
+    0xBA, 0x30, 0x31, 0x38, 0x57, 0xDA, 0x37, 0x4C, 0xDD, 0x4F, 0x2A, 0x4E, 0xA5, 0xF0, 0x56, 0x11,
+    0x16, 0xDB, 0x43, 0x4E, 0x12, 0x12, 0xFD, 0xF0, 0x40, 0xBE, 0x63, 0x8E, 0xAF, 0x5C, 0x52, 0x39,
+    0x8C, 0xC9, 0xE6, 0x21, 0x12, 0x32, 0xE8, 0x03, 0x93, 0x4A, 0x0F, 0xC4, 0xD7, 0x26, 0x9D, 0x0C,
+    0x84, 0xF3, 0x52, 0x2E, 0xD1, 0x9B, 0x3C, 0xAB, 0x8B, 0x4F, 0x53, 0xB9, 0x11, 0x9A, 0xC1, 0x5E,
+    0x90, 0x07, 0x96, 0x9D, 0x99, 0x37, 0xA1, 0x4E, 0x15, 0x68, 0x71, 0x7E, 0xDA, 0x26, 0x22, 0x0E,
+    0xBC, 0xED, 0x70, 0x77, 0x48, 0x16, 0x9D, 0xE6, 0x84, 0x94, 0xAE, 0x3C, 0xE0, 0x90, 0x46, 0xC3,
+    0x89, 0x56, 0xFB, 0xFD, 0xC4, 0xD1, 0x48, 0xF5, 0x31, 0x06, 0x42, 0x62, 0xDF, 0xE2, 0xFC, 0xDC,
+    0xDF, 0x4F, 0xBC, 0x85, 0x63, 0x41, 0x6C, 0x65, 0xA4, 0x98, 0xE5, 0xCF, 0x67, 0xFC, 0x4D, 0x5B,
+    0x11, 0x91, 0x38, 0x6E, 0x19, 0xD6, 0x9E, 0x64, 0xF8, 0x8C, 0x9B, 0x55, 0xD2, 0x2A, 0xF3, 0xDD,
+    0xC3, 0xE7, 0x5D, 0xCD, 0x8C, 0x31, 0xD1, 0x47, 0x13, 0x62, 0xE2, 0xCE, 0x80, 0x67, 0x1A, 0x81,
+    0x1F, 0xC1, 0xE8, 0x3D, 0x28, 0x82, 0x5E, 0x0A, 0x79, 0x7A, 0x2F, 0x28, 0x99, 0x1B, 0x98, 0x9B,
+    0xF0, 0xF5, 0x98, 0xE1, 0xDF, 0x3A, 0x5A, 0x14, 0x7E, 0x93, 0x41, 0xBA, 0x5C, 0x5B, 0xA2, 0x40,
+    0x29, 0x09, 0x4E, 0xE6, 0xC2, 0x86, 0x9C, 0xE4, 0x1C, 0xE7, 0xB9, 0xF2, 0x4B, 0x2B, 0x0A, 0x51,
+    0x51, 0x84, 0x71, 0xD6, 0x46, 0xA2, 0x79, 0x7B, 0x8B, 0x59, 0xD8, 0xC0, 0x8A, 0x42, 0xE6, 0x2C,
+    0xB5, 0x89, 0x32, 0x95, 0x29, 0x1D, 0xB3, 0x84, 0x07, 0x6A, 0x58, 0x02, 0x5D, 0xF3, 0x9E, 0x87,
+    0x58, 0x7A, 0x14, 0xA2, 0xEA, 0xF4, 0x7D, 0xF5, 0xB0, 0x37, 0x55, 0x05, 0xA0, 0xED, 0x53, 0x65,
+    0x5B, 0xA6, 0x45, 0x25, 0xC1, 0x46, 0x68, 0x44, 0x5E, 0xA2, 0xD9, 0x42, 0x78, 0x2D, 0xC3, 0xD7,
+    0x16, 0xAA, 0xCB, 0x71, 0x41, 0xF4, 0x34, 0x64, 0x1B, 0xF4, 0x2C, 0xBB, 0x53, 0xE3, 0xF7, 0x11,
+    0x62, 0x65, 0x65, 0x31, 0xD4, 0x2D, 0xBF, 0x5B, 0xD5, 0x8F, 0x63, 0x74, 0xB1, 0xFA, 0x36, 0x3E,
+    0xB2, 0xF5, 0x71, 0x96, 0x7C, 0x60, 0x7E, 0xC7, 0xD7, 0xAD, 0x73, 0x3B, 0xEE, 0x80, 0x49, 0x0A,
+    0xEC, 0x32, 0x52, 0xAD, 0xF2, 0xA8, 0x14, 0x23, 0x70, 0xD8, 0x98, 0xDA, 0x48, 0x0D, 0xC4, 0xFD,
+    0xDB, 0x4F, 0xB2, 0xD6, 0xA0, 0x5B, 0xCA, 0xBB, 0xF7, 0x3F, 0xD3, 0xDD, 0xDE, 0x1F, 0x56, 0x5D,
+    0x1D, 0xA7, 0x28, 0xD3, 0xAB, 0x45, 0x7C, 0xDA, 0x6E, 0x4B, 0xDB, 0x52, 0x79, 0xEA, 0xDB, 0x6D,
+    0x5F, 0x45, 0x6C, 0x7D, 0x49, 0xE8, 0x6C, 0xCD, 0x92, 0x3F, 0x27, 0x4D, 0xA6, 0xBF, 0x84, 0xB8,
+    0xAB, 0x74, 0x74, 0x8D, 0x07, 0x3F, 0xDC, 0x2E, 0x02, 0x5B, 0x72, 0x2E, 0x2C, 0x75, 0xD1, 0x0E,
+    0x7F, 0x43, 0xAC, 0x9D, 0x66, 0x47, 0xD3, 0x42, 0x91, 0x0F, 0xC1, 0x9F, 0x98, 0xE4, 0x2B, 0x9A,
+    0x06, 0x25, 0x2B, 0xC2, 0x4E, 0xC6, 0x80, 0xFA, 0x59, 0x67, 0x39, 0xD6, 0x29, 0x8D, 0x4D, 0x0F,
+    0x62, 0x11, 0xA2, 0x48, 0x11, 0xE5, 0xC9, 0xEE, 0x30, 0x8B, 0x9D, 0xAB, 0x54, 0x27, 0x5C, 0x7F,
+    0x3F, 0x76, 0xFA, 0x18, 0x72, 0x77, 0x0F, 0x1D, 0x69, 0x22, 0xCF, 0x9B, 0xCC, 0x1A, 0x24, 0xC1,
+    0xFF, 0xA0, 0x4E, 0xB4, 0x17, 0xF3, 0xA0, 0x12, 0xC5, 0x81, 0xA6, 0xA5, 0x7D, 0xAE, 0x39, 0xF1,
+    0x2F, 0x3D, 0x55, 0x31, 0x88, 0x5C, 0x45, 0x18, 0xFE, 0x66, 0x06, 0xF2, 0xE4, 0x5E, 0x6E, 0xE7,
+    0x8A, 0x34, 0x92, 0xEC, 0x6D, 0x63, 0x11, 0xC2, 0xEE, 0xBE, 0x2B, 0x0E, 0xB9, 0xE0, 0xDB, 0x7D,
+    0x63, 0x02, 0xA6, 0x10, 0x21, 0x4D, 0x2A, 0x9B, 0xD4, 0x22, 0x5C, 0x8A, 0x2B, 0x56, 0xD8, 0xDC,
+    0x0E, 0xA6, 0x10, 0x54, 0xF0, 0x0A, 0x4D, 0x21, 0x08, 0x16, 0x16, 0x92, 0x14, 0x39, 0xE4, 0x84,
+    0x03, 0x2F, 0xD9, 0x89, 0x16, 0x16, 0x27, 0xF8, 0x40, 0x89, 0x85, 0xCD, 0x8B, 0x8A, 0x01, 0x1B,
+    0x07, 0xB2, 0xC5, 0xC6, 0xDB, 0xDB, 0xF1, 0x9B, 0xB7, 0x97, 0x0C, 0xCC, 0x7B, 0xBB, 0xF3, 0xFE,
+    0xFF, 0x9F, 0xFF, 0xFF, 0xE6, 0xFB, 0xBF, 0x01, 0xAE, 0x01, 0x49, 0x70, 0xE8, 0x5F, 0xF2, 0x98,
+    0x60, 0x5F, 0x95, 0x18, 0x24, 0x0E, 0xB9, 0x36, 0x18, 0x68, 0x60, 0xB0, 0x0A, 0xF8, 0x0E, 0x84,
+    0xEF, 0x8B, 0xCB, 0x65, 0x71, 0x25, 0xB8, 0x2C, 0x04, 0xE8, 0x30, 0x83, 0xE4, 0x84, 0x9C, 0x03,
+    0x08, 0x06, 0x71, 0x14, 0x53, 0x34, 0xEE, 0xBA, 0x04, 0xBB, 0xCA, 0xB6, 0x51, 0xB6, 0xF0, 0xDE,
+    0xA6, 0x29, 0xE6, 0x34, 0x75, 0x89, 0xDB, 0x53, 0xD5, 0x2A, 0x26, 0xA9, 0x1D, 0xAA, 0xAA, 0x10,
+    0x53, 0xED, 0x1E, 0xD0, 0x7C, 0xEC, 0x91, 0x05, 0x27, 0x9E, 0x01, 0xDC, 0x09, 0x1B, 0x80, 0x98,
+    0x00, 0x8A, 0xB1, 0x54, 0xA8, 0x80, 0x4D, 0xCE, 0xCC, 0xD1, 0x0A, 0x9F, 0x9E, 0x9D, 0xA5, 0x21,
+    0x94, 0xE3, 0x30, 0x13, 0xE3, 0x79, 0xBD, 0x13, 0x33, 0xF8, 0x21, 0x84, 0x29, 0x98, 0x99, 0x2C,
+    0x81, 0x9C, 0x6E, 0xB4, 0xDC, 0x5F, 0x04, 0xF2, 0x40, 0x8B, 0x0B, 0x74, 0xEF, 0xB1, 0x2C, 0xAE,
+    0xCF, 0xEA, 0xE4, 0x90, 0x3A, 0x55, 0xF5, 0xF9, 0x69, 0x82, 0x83, 0x84, 0x3F, 0x33, 0x1A, 0x4F,
+    0x31, 0x54, 0x4E, 0x56, 0x2D, 0xFE, 0xDC, 0x47, 0x2E, 0x2B, 0x59, 0xE9, 0x32, 0x33, 0x05, 0xEB,
+    0xE2, 0x7E, 0x18, 0x3F, 0xC3, 0xC9, 0x48, 0x2C, 0xF2, 0x21, 0xD2, 0x0F, 0x9C, 0xF0, 0x43, 0xF4,
+    0x94, 0x4B, 0x6D, 0x2E, 0xBC, 0x2A, 0xFB, 0xE8, 0x69, 0xA7, 0x1E, 0x4F, 0xD0, 0xEF, 0x33, 0x67,
+    0x17, 0xEB, 0x57, 0x81, 0x30, 0x30, 0x25, 0x66, 0x86, 0x7D, 0x26, 0xA4, 0xBE, 0x67, 0x1E, 0xDD,
+    0xD4, 0x32, 0xAD, 0x2E, 0x7C, 0x6A, 0xA7, 0xBA, 0xCC, 0x55, 0x15, 0x2E, 0x57, 0xFA, 0xCD, 0x79,
+    0x0B, 0xBD, 0x9B, 0x07, 0x53, 0x1C, 0x3D, 0x3E, 0x72, 0x2A, 0x24, 0xC7, 0xD0, 0x93, 0x96, 0x47,
+    0x61, 0x0B, 0xC3, 0x8C, 0x4F, 0x72, 0x46, 0x6A, 0x58, 0x99, 0xE7, 0xEC, 0xF1, 0x54, 0x92, 0x5B,
+    0x8C, 0xFC, 0x94, 0xB3, 0x60, 0xD0, 0x84, 0x53, 0x12, 0x30, 0xC9, 0x1D, 0xE5, 0x51, 0x09, 0xE9,
+    0x79, 0x22, 0x3E, 0xE3, 0x5A, 0x52, 0x71, 0x7D, 0x86, 0x01, 0xBA, 0x39, 0x86, 0x3D, 0x6E, 0xAC,
+    0xCA, 0x4C, 0x9B, 0x56, 0x17, 0x7A, 0x06, 0xED, 0x91, 0x96, 0x84, 0x02, 0xDA, 0x22, 0x33, 0x28,
+    0x22, 0xBE, 0x84, 0x2D, 0x04, 0xAB, 0x02, 0x2B, 0xB8, 0xF6, 0x36, 0xD1, 0x4B, 0x38, 0x53, 0x46,
+    0xD7, 0x9C, 0x2D, 0xEE, 0x96, 0xC5, 0x1D, 0xDD, 0x62, 0x8E, 0x58, 0xC9, 0xF8, 0xBF, 0x3B, 0x28,
+    0x68, 0x4D, 0x2F, 0x5A, 0xE2, 0x0E, 0x57, 0x1D, 0x3A, 0xB4, 0x67, 0xB9, 0xB6, 0x3E, 0x10, 0x5F,
+    0x1F, 0xE7, 0x8B, 0x25, 0xF1, 0x62, 0xA9, 0xB9, 0x58, 0x72, 0xF5, 0xD2, 0x6E, 0x7D, 0x72, 0x5C,
+    0x4A, 0x67, 0x50, 0xC7, 0x3C, 0xFE, 0xE5, 0xF5, 0x3F, 0x3E, 0x6C, 0x7F, 0x73, 0xD8, 0xF9, 0xF6,
+    0xD1, 0xCA, 0x05, 0x1B, 0xB7, 0x8B, 0x56, 0x55, 0xED, 0xBB, 0x55, 0xBB, 0xE7, 0x75, 0xD0, 0x46,
+    0x1D, 0x24, 0x35, 0x31, 0x34, 0x43, 0x71, 0x43, 0xB1, 0x30, 0x62, 0xC0, 0x41, 0x6D, 0xD4, 0x86,
+    0x9A, 0x13, 0x98, 0x25, 0x6C, 0xAB, 0x37, 0x80, 0x0B, 0x77, 0xBE, 0x1E, 0x45, 0xAA, 0xE2, 0xBA,
+    0x8E, 0x56, 0xC0, 0x03, 0x16, 0x6C, 0xF7, 0xBB, 0x89, 0xD9, 0xDA, 0x90, 0xCE, 0xE9, 0x04, 0x07,
+    0xAD, 0x7B, 0x55, 0x11, 0xEC, 0xE8, 0x8B, 0xF8, 0x75, 0x3F, 0xB2, 0xC8, 0x73, 0x0B, 0x46, 0xED,
+    0x06, 0xF5, 0x6C, 0xD8, 0x17, 0xBF, 0xB8, 0xE6, 0x40, 0x1E, 0x9A, 0xC1, 0x7C, 0x93, 0x64, 0x8E,
+    0xE0, 0xD7, 0x24, 0x74, 0xDB, 0xD7, 0x73, 0xA6, 0xAF, 0x63, 0x1E, 0x15, 0xC9, 0xA6, 0xE7, 0x18,
+    0xBB, 0xF8, 0x45, 0x19, 0x08, 0x57, 0xA7, 0xB3, 0x0E, 0x9C, 0xC3, 0xD9, 0x43, 0x64, 0x47, 0xB6,
+    0x93, 0x96, 0x4D, 0xE1, 0x53, 0x0C, 0x94, 0xED, 0x80, 0x94, 0x2B, 0xC6, 0x04, 0xD0, 0x63, 0x3C,
+    0xA8, 0x83, 0x6D, 0x9A, 0xF4, 0xB2, 0xD9, 0x3D, 0x95, 0x7C, 0x3E, 0xCB, 0xE6, 0x3B, 0x65, 0x8C,
+    0xA8, 0x77, 0xAE, 0x66, 0xC1, 0xB4, 0xA6, 0xF1, 0xAB, 0x2E, 0x53, 0x06, 0x15, 0xA4, 0x89, 0xB9,
+    0x69, 0x1A, 0x48, 0x6A, 0x52, 0xB0, 0xD6, 0x4E, 0x04, 0x02, 0xD9, 0x5B, 0xE2, 0x68, 0xA6, 0xEC,
+    0x2C, 0xC1, 0xB4, 0x81, 0xC9, 0x69, 0xF8, 0xD3, 0xAA, 0xD2, 0xF7, 0x4A, 0xA6, 0x2A, 0x8F, 0x18,
+    0xC7, 0xAC, 0x8C, 0x30, 0x9A, 0x61, 0xE4, 0x21, 0x10, 0xA1, 0x89, 0x40, 0xAE, 0xD5, 0xD9, 0xB1,
+    0x90, 0x47, 0x3B, 0x32, 0x4C, 0xD4, 0x64, 0xA0, 0xDC, 0x46, 0x62, 0xD6, 0x35, 0x6E, 0x68, 0xEC,
+    0xAE, 0xC2, 0xF7, 0x44, 0x95, 0x13, 0xD7, 0x57, 0xD8, 0x10, 0xB1, 0xE1, 0x04, 0xDD, 0x2A, 0x65,
+    0xCE, 0xE1, 0x4B, 0x65, 0x9B, 0x35, 0x1D, 0x23, 0xCC, 0xD2, 0x63, 0xC9, 0x2E, 0xB0, 0x60, 0xBE,
+    0xCD, 0x18, 0x92, 0xEF, 0x65, 0xE0, 0x06, 0xA4, 0x8B, 0xEF, 0xB5, 0xF8, 0x6E, 0xC4, 0xF5, 0x4D,
+    0xAB, 0xA6, 0x27, 0x8C, 0x26, 0x38, 0xBB, 0x31, 0xED, 0x12, 0xED, 0xF3, 0xEA, 0x67, 0xBC, 0xE6,
+    0x48, 0xB7, 0x80, 0xC6, 0x54, 0xFC, 0x56, 0xE6, 0x85, 0x7A, 0x38, 0xC3, 0x8A, 0x60, 0xB5, 0x1B,
+    0x2F, 0x1E, 0xB9, 0xA8, 0x52, 0x72, 0x81, 0x2C, 0x7F, 0xE2, 0xB7, 0x51, 0xDC, 0x1B, 0x97, 0x99,
+    0xF2, 0x1B, 0x1A, 0x7B, 0xCB, 0x89, 0xCD, 0xD5, 0xA5, 0xB2, 0x29, 0x1D, 0x51, 0xF5, 0xB1, 0x82,
+    0x8E, 0x2C, 0x3B, 0x3C, 0x62, 0xA6, 0x2C, 0x0C, 0xF5, 0x2C, 0x4B, 0x8C, 0x6F, 0x26, 0x76, 0xAB,
+    0xAD, 0x9C, 0xD7, 0x89, 0x1B, 0x74, 0x65, 0x35, 0xE1, 0xB7, 0xB1, 0xD1, 0x77, 0x8D, 0x6F, 0x24,
+    0x68, 0xE7, 0xA8, 0x2A, 0x75, 0xCB, 0xB6, 0xF5, 0xDD, 0x2A, 0x9B, 0xD7, 0x34, 0x3F, 0x73, 0x9F,
+    0xCC, 0xD9, 0x43, 0x21, 0xAD, 0x72, 0x6D, 0x0C, 0xA4, 0x4D, 0xCD, 0x3A, 0xA6, 0x09, 0x5A, 0x7F,
+    0x57, 0x51, 0xED, 0x2E, 0xCE, 0x23, 0xED, 0x22, 0x89, 0x3A, 0x0B, 0xC9, 0xA9, 0xC7, 0xCB, 0x67,
+    0x64, 0x18, 0xA6, 0x97, 0x26, 0x3C, 0xDE, 0xB6, 0xAC, 0xD6, 0x55, 0xB9, 0x9E, 0xBA, 0xDE, 0xC8,
+    0xF2, 0xF4, 0xD2, 0x27, 0x64, 0xEB, 0x4A, 0x6C, 0xA4, 0x96, 0xC5, 0x4A, 0xB4, 0x7D, 0xB5, 0x6A,
+    0x4D, 0x35, 0x83, 0x93, 0x5B, 0x13, 0x42, 0x48, 0x11, 0x62, 0x94, 0xAC, 0x52, 0x9F, 0xE1, 0x7C,
+    0xC4, 0x49, 0x1C, 0x43, 0x50, 0x1A, 0x73, 0x71, 0xDB, 0x67, 0xE4, 0x63, 0x8D, 0xD9, 0x2E, 0x2A,
+    0x59, 0x66, 0x73, 0x65, 0x13, 0xA3, 0x09, 0x5C, 0x13, 0x5D, 0xF6, 0x7F, 0x51, 0x35, 0xB0, 0xBB,
+    0xA1, 0x5C, 0xC9, 0x3A, 0xB6, 0xDA, 0x84, 0x40, 0x2B, 0xB7, 0xAF, 0x03, 0x59, 0x6C, 0x46, 0xEF,
+    0xD2, 0x49, 0x3A, 0xF5, 0x11, 0xDA, 0x4D, 0xE1, 0x36, 0x1A, 0xF0, 0x5E, 0x1D, 0x22, 0x9D, 0x44,
+    0x35, 0x7D, 0x50, 0x27, 0x9C, 0x83, 0xC0, 0x8B, 0x3F, 0x9D, 0xF5, 0x7E, 0x3A, 0xC8, 0x43, 0xAE,
+    0xC3, 0xB1, 0x9A, 0x07, 0x1C, 0x17, 0xA6, 0x4F, 0x65, 0xC0, 0x20, 0x85, 0x4E, 0x8D, 0xFC, 0xDD,
+    0x60, 0x64, 0xA2, 0x4E, 0x50, 0x0B, 0xD2, 0x03, 0xA4, 0x9F, 0x98, 0xF4, 0x7D, 0x2A, 0x58, 0x8F,
+    0xB1, 0x35, 0xB6, 0x12, 0xD3, 0x50, 0x4E, 0x3D, 0x2C, 0x19, 0x1D, 0xDD, 0x3D, 0x24, 0xEC, 0x2F,
+    0xDE, 0x04, 0xD4, 0x13, 0x3A, 0x50, 0x74, 0x29, 0x32, 0xA3, 0x12, 0xD9, 0x09, 0x3D, 0x46, 0xC7,
+    0x78, 0xE7, 0x3E, 0x58, 0x31, 0x31, 0xA3, 0x36, 0x1F, 0x44, 0xEA, 0xB0, 0x70, 0xAA, 0x7F, 0x11,
+    0x22, 0x8A, 0x32, 0xAA, 0x55, 0xDD, 0x70, 0x1D, 0x9A, 0x28, 0x8F, 0x61, 0x24, 0xE7, 0x6A, 0x6C,
+    0xED, 0x3C, 0xFA, 0x14, 0x16, 0x5F, 0x91, 0x56, 0xD2, 0x2E, 0x63, 0x4D, 0xD4, 0x0F, 0xB7, 0x44,
+    0x76, 0xF1, 0xB1, 0x0E, 0xF7, 0xBC, 0x1B, 0x6B, 0x40, 0x35, 0x9B, 0x83, 0x5E, 0xDB, 0x68, 0xB1,
+    0x4F, 0x62, 0x67, 0xF2, 0x8F, 0x4F, 0x27, 0x72, 0x07, 0xCD, 0x97, 0x7E, 0xBA, 0xCD, 0xBD, 0xC5,
+    0x55, 0xED, 0xFA, 0x34, 0x45, 0x8A, 0x21, 0x99, 0x65, 0x72, 0xD2, 0x99, 0x9C, 0xDE, 0x55, 0xAE,
+    0x11, 0xBB, 0x35, 0x0E, 0x61, 0x49, 0xCE, 0x35, 0x8C, 0xC5, 0xDC, 0x3E, 0xC5, 0x96, 0xCB, 0xAF,
+    0x37, 0xD6, 0xD5, 0xC7, 0x38, 0xA2, 0xBC, 0x53, 0x6B, 0xD7, 0x70, 0xE6, 0xC4, 0xCA, 0xF0, 0xCE,
+    0x34, 0xF2, 0xAF, 0x76, 0xEC, 0x27, 0x92, 0x3A, 0x7A, 0x9F, 0xBC, 0xCE, 0xFE, 0x63, 0x54, 0x98,
+    0xC4, 0x66, 0xC0, 0x1E, 0xC0, 0xC2, 0x8B, 0xFF, 0x76, 0x28, 0xAF, 0x56, 0x62, 0x67, 0x7C, 0x9C,
+    0x5C, 0xB1, 0xD5, 0x46, 0x43, 0xCB, 0xE0, 0xBF, 0xFB, 0xF7, 0xF5, 0x05, 0x29, 0xD8, 0x50, 0x1D,
+    0x96, 0xFD, 0xA3, 0x8B, 0xFA, 0x41, 0x5C, 0xD4, 0xAF, 0xD4, 0xD7, 0xFA, 0x3E, 0xE3, 0x0D, 0xD6,
+    0xBA, 0x0A, 0x32, 0x4F, 0x2D, 0x24, 0x34, 0x8E, 0xE7, 0x30, 0xD4, 0x7F, 0x96, 0x16, 0x58, 0x3C,
+    0x87, 0x61, 0x6C, 0x70, 0xF1, 0x1C, 0x4E, 0x45, 0x2B, 0x42, 0x32, 0x85, 0xBE, 0xED, 0xA9, 0x1A,
+    0xA6, 0x8D, 0x1B, 0x62, 0xBE, 0x89, 0x53, 0x04, 0x9B, 0xC8, 0xA3, 0x1F, 0xEF, 0xE4, 0xFA, 0x92,
+    0xAD, 0xC7, 0xFF, 0xAD, 0x94, 0x3F, 0x6C, 0x1B, 0x55, 0x1C, 0xC7, 0xBF, 0xEF, 0x5E, 0xE2, 0x4B,
+    0x7D, 0x4D, 0x8E, 0xA1, 0x83, 0xA9, 0x1C, 0x5F, 0x86, 0x4A, 0x84, 0x60, 0xC7, 0x0C, 0x19, 0x32,
+    0x38, 0xBD, 0x07, 0x61, 0x2B, 0x12, 0x19, 0x98, 0x98, 0x32, 0x30, 0x30, 0x80, 0xC8, 0x90, 0x21,
+    0x45, 0x09, 0x79, 0x29, 0x12, 0x42, 0x4C, 0x19, 0x19, 0x3D, 0x30, 0x20, 0x18, 0xEA, 0x21, 0x83,
+    0x91, 0x52, 0xF2, 0x9A, 0x2C, 0x54, 0x2C, 0x27, 0xBA, 0x30, 0xDE, 0xC0, 0x50, 0x95, 0x81, 0x1B,
+    0x3C, 0x18, 0x64, 0xE7, 0xF1, 0xFD, 0x9D, 0x53, 0x68, 0x60, 0xA1, 0x85, 0x27, 0x9D, 0xEF, 0xFC,
+    0xEE, 0x7E, 0x9F, 0xDF, 0xF7, 0xF7, 0xEF, 0x5D, 0xA9, 0xC6, 0xEB, 0x67, 0x3F, 0x16, 0x95, 0xEE,
+    0x8B, 0x53, 0x8B, 0x53, 0x9B, 0x33, 0x1F, 0x5C, 0x5B, 0x38, 0x9C, 0x06, 0x10, 0xD9, 0x4F, 0xA6,
+    0xAF, 0xBE, 0x9C, 0x7F, 0x6C, 0xB0, 0xA0, 0x90, 0x37, 0x43, 0x23, 0xD7, 0x5A, 0x64, 0x13, 0x9D,
+    0x85, 0xC8, 0x14, 0xCC, 0xD2, 0xDB, 0x89, 0x77, 0xC8, 0xB1, 0x8D, 0x26, 0x96, 0xBE, 0x96, 0xE7,
+    0x8D, 0xF0, 0x8D, 0xDA, 0xC1, 0x4B, 0x07, 0xB5, 0xCF, 0x6A, 0xDD, 0x8A, 0x81, 0xE2, 0x8E, 0xAC,
+    0x0F, 0xCD, 0xED, 0xED, 0x95, 0xB9, 0xA6, 0xBE, 0xB5, 0x7E, 0xDF, 0x67, 0x6D, 0x8B, 0x00, 0x58,
+    0x04, 0xB2, 0xC0, 0x8F, 0xCA, 0x3B, 0x94, 0x7C, 0xD4, 0xF6, 0xF2, 0x5B, 0xC1, 0xE6, 0xB5, 0xE6,
+    0x6A, 0x6A, 0x31, 0x8D, 0x19, 0xD8, 0x6E, 0x60, 0xB6, 0xEE, 0x21, 0xD4, 0xEB, 0xD6, 0x20, 0x8F,
+    0xB0, 0xAA, 0xDD, 0xBC, 0xDC, 0xB7, 0xB5, 0x6B, 0xAA, 0x22, 0xC6, 0x71, 0x64, 0x53, 0x9F, 0x27,
+    0x7E, 0x30, 0xBB, 0xFF, 0xBE, 0xA6, 0xB1, 0xE1, 0xA5, 0x14, 0xD2, 0x2A, 0xFC, 0xAC, 0x1A, 0x5F,
+    0x55, 0xA3, 0x3A, 0x46, 0x8B, 0x38, 0x5A, 0x41, 0xF1, 0xAA, 0x2A, 0xB6, 0x74, 0xD6, 0x0D, 0x5D,
+    0x16, 0x3B, 0x97, 0xBC, 0xE6, 0xD2, 0xC0, 0xC6, 0xE1, 0x69, 0x17, 0x53, 0x6A, 0xA3, 0xD6, 0x47,
+    0x75, 0x7A, 0xE6, 0x6A, 0xED, 0x1C, 0xD5, 0xF5, 0x37, 0x37, 0x1E, 0xD4, 0xF6, 0xC9, 0xB9, 0xA6,
+    0xB2, 0x55, 0x95, 0xB7, 0xD0, 0x9B, 0xD7, 0x59, 0x7F, 0x39, 0x74, 0x45, 0x5D, 0xE1, 0x05, 0x91,
+    0xD7, 0x01, 0xA6, 0x2D, 0xCC, 0x0D, 0xDC, 0xD0, 0xA8, 0x62, 0x4B, 0x59, 0xFE, 0x54, 0x1E, 0xD5,
+    0xE1, 0xCF, 0x18, 0x53, 0xD6, 0xC3, 0xCA, 0x2B, 0x98, 0xAB, 0x6E, 0x06, 0xA7, 0x9F, 0xA3, 0x97,
+    0x0E, 0x9A, 0xA8, 0x07, 0x26, 0x70, 0x01, 0x93, 0x70, 0x9D, 0x31, 0xD2, 0x08, 0x2E, 0xB0, 0x21,
+    0xEA, 0x58, 0x54, 0xAE, 0xF2, 0x68, 0x6E, 0x98, 0x16, 0x3F, 0x2D, 0x62, 0x16, 0x5D, 0xE4, 0xDA,
+    0x54, 0xC9, 0xEE, 0x45, 0x2E, 0xC2, 0x10, 0x5B, 0xD1, 0x58, 0x9B, 0xA5, 0x2E, 0xF4, 0x90, 0x1E,
+    0x17, 0x60, 0x94, 0x9D, 0xE5, 0xEE, 0x21, 0x56, 0xAA, 0x80, 0xDB, 0x0C, 0xEE, 0x86, 0x48, 0xF2,
+    0xAD, 0x05, 0xE8, 0xD7, 0x9D, 0xF8, 0xD3, 0x77, 0xBE, 0xC0, 0xEA, 0x62, 0x37, 0x70, 0xBF, 0x66,
+    0x74, 0x08, 0x8B, 0x82, 0x49, 0xE8, 0xB2, 0x78, 0x22, 0x96, 0x8F, 0x06, 0xCB, 0xC0, 0x00, 0xDA,
+    0x61, 0x1F, 0x51, 0x86, 0x3E, 0x42, 0x79, 0xA3, 0x72, 0x44, 0x06, 0x0D, 0xD8, 0x9B, 0x77, 0xD1,
+    0xCE, 0xCA, 0x2A, 0x51, 0x9E, 0x6C, 0x8B, 0xE5, 0xC5, 0x52, 0x44, 0xA5, 0xDC, 0x28, 0xA0, 0x7E,
+    0x61, 0xEC, 0x3D, 0x44, 0xB7, 0x8C, 0xCA, 0xB7, 0xD1, 0x09, 0x6D, 0x64, 0x77, 0x54, 0x11, 0xBA,
+    0xD4, 0x8F, 0x22, 0xEF, 0xEF, 0x0F, 0xB0, 0x7B, 0x13, 0xA1, 0x60, 0x56, 0x80, 0x80, 0xF6, 0xF5,
+    0x8B, 0x6A, 0x5C, 0x5E, 0x09, 0xAF, 0x51, 0xC9, 0xC3, 0x47, 0x0E, 0xFA, 0x07, 0xA0, 0xD5, 0x82,
+    0x00, 0x63, 0xFA, 0xED, 0x87, 0x36, 0x74, 0x09, 0x48, 0x0C, 0xBC, 0x2F, 0x12, 0x13, 0xBA, 0x21,
+    0x92, 0x0B, 0xC6, 0x0E, 0xA0, 0xBF, 0xA2, 0xC0, 0xDA, 0xE4, 0xEF, 0x2E, 0xFF, 0x92, 0xD1, 0x76,
+    0xA5, 0xAE, 0xB8, 0x09, 0x1C, 0x1D, 0x21, 0x3C, 0xC8, 0x44, 0x58, 0x90, 0x37, 0xE8, 0x67, 0x17,
+    0x64, 0x50, 0x99, 0xDB, 0x43, 0xA2, 0x73, 0xEC, 0xD1, 0x68, 0x7E, 0x06, 0x78, 0xB0, 0x89, 0x4A,
+    0xFC, 0x97, 0x9E, 0xE7, 0xE2, 0x74, 0x5A, 0x40, 0x7F, 0x0D, 0xF8, 0xF2, 0xBD, 0xCB, 0x81, 0x31,
+    0x51, 0x38, 0x41, 0x49, 0x92, 0xC8, 0x98, 0x2A, 0x34, 0x42, 0x23, 0x28, 0x09, 0x4D, 0x92, 0xA5,
+    0xC9, 0x11, 0x96, 0xC4, 0x36, 0x49, 0x57, 0x70, 0x08, 0x7C, 0x0A, 0xA9, 0xC8, 0xE5, 0x2C, 0x89,
+    0x2A, 0xB2, 0x1A, 0xBD, 0x12, 0x45, 0x51, 0x24, 0x69, 0xB7, 0x23, 0x20, 0x6A, 0x12, 0xCE, 0x89,
+    0x1F, 0x11, 0x73, 0x36, 0x91, 0x54, 0xAE, 0xD0, 0xCB, 0xB4, 0xA5, 0xFE, 0x37, 0x9A, 0x97, 0xA3,
+    0xD4, 0x92, 0xF6, 0x09, 0x1E, 0x4A, 0x55, 0x1A, 0x22, 0x10, 0xC5, 0xFE, 0x98, 0x51, 0x2A, 0x4F,
+    0xF8, 0x40, 0x8A, 0x1C, 0x59, 0x86, 0x81, 0x7D, 0x3F, 0x10, 0x0B, 0xEF, 0x87, 0x58, 0xA3, 0x79,
+    0xAE, 0x73, 0xE5, 0xFD, 0xD3, 0x82, 0x2A, 0x63, 0x44, 0x3E, 0xD3, 0xFC, 0x8A, 0xC0, 0x9B, 0x74,
+    0xE4, 0xA4, 0x9F, 0x44, 0x66, 0x30, 0xE9, 0x0F, 0xE9, 0xD3, 0xF4, 0xFC, 0x98, 0x65, 0xB3, 0x31,
+    0x61, 0xED, 0x73, 0xC8, 0xB0, 0xA8, 0x0D, 0x99, 0xE6, 0x32, 0x36, 0xF6, 0x20, 0xE6, 0x26, 0xF9,
+    0x9E, 0x2C, 0xCD, 0xC9, 0x3F, 0x39, 0x37, 0x52, 0x0A, 0x22, 0x1A, 0x24, 0x65, 0x82, 0x60, 0x0C,
+    0xD2, 0xA0, 0xB8, 0xD8, 0x6F, 0xFB, 0x82, 0xBA, 0xA8, 0xA9, 0xC0, 0x9F, 0x0D, 0x1A, 0x92, 0x96,
+    0xFD, 0xAD, 0xAD, 0x52, 0x49, 0xEB, 0xCF, 0x62, 0x11, 0x4F, 0x3A, 0xB8, 0x25, 0x1E, 0x72, 0x30,
+    0x5C, 0x09, 0x73, 0xB2, 0x1F, 0x4C, 0x48, 0x02, 0x04, 0x8F, 0x2C, 0x24, 0x16, 0x9A, 0xF2, 0x30,
+    0xF5, 0xEC, 0xE6, 0xCA, 0x76, 0xD1, 0x59, 0x46, 0xC4, 0xEC, 0x3F, 0x6F, 0x38, 0x06, 0xF3, 0xE5,
+    0x47, 0x93, 0xCA, 0xB9, 0x20, 0x67, 0x46, 0x3B, 0x4C, 0x69, 0x64, 0x75, 0xC6, 0x6F, 0x77, 0x39,
+    0xB3, 0x31, 0x1F, 0x39, 0x80, 0xA3, 0xB2, 0xB1, 0xB8, 0x66, 0x65, 0xB0, 0xB6, 0x2E, 0x05, 0xCE,
+    0x4A, 0xF4, 0x11, 0x1B, 0x1A, 0x24, 0x20, 0x62, 0x4D, 0x86, 0x7C, 0x57, 0x44, 0x0F, 0xB9, 0x4B,
+    0xDB, 0xB4, 0x6C, 0xA4, 0x15, 0x8E, 0xBD, 0x3A, 0xB5, 0xCF, 0x60, 0xD1, 0x7D, 0x37, 0x3C, 0xCB,
+    0xD2, 0xC4, 0x3C, 0xE5, 0xE7, 0xC9, 0x19, 0xC2, 0xAA, 0xF7, 0x41, 0x8D, 0xB1, 0x54, 0x93, 0x84,
+    0xD8, 0x12, 0x42, 0xC3, 0xD8, 0x3D, 0xD1, 0x19, 0xB0, 0x91, 0x62, 0x26, 0xA4, 0x13, 0x0C, 0x55,
+    0xAE, 0x8A, 0xC8, 0xE8, 0xAC, 0x83, 0xF8, 0x9D, 0xDF, 0xED, 0x9A, 0x3F, 0x47, 0xD1, 0x41, 0xE4,
+    0x0A, 0x7C, 0x17, 0x3E, 0x3E, 0x29, 0xDA, 0xDE, 0x1B, 0x2F, 0x39, 0x19, 0x96, 0xDD, 0xCA, 0xD9,
+    0xAE, 0x7F, 0x0F, 0x5C, 0x69, 0x4C, 0x30, 0xD7, 0xE9, 0x22, 0x76, 0x3C, 0x13, 0x0A, 0x9D, 0x05,
+    0x63, 0x0A, 0xF6, 0xB6, 0x8F, 0xBD, 0x62, 0x0D, 0xCB, 0x1D, 0xBE, 0x78, 0x2B, 0xB2, 0xE1, 0xD9,
+    0xC3, 0x2C, 0x28, 0xBE, 0x2D, 0x30, 0x4C, 0xF8, 0x42, 0x8F, 0xD1, 0x86, 0xA7, 0x45, 0xEA, 0x2E,
+    0x44, 0xF7, 0x78, 0x49, 0x7F, 0xAB, 0x0B, 0x59, 0xE7, 0x06, 0xED, 0x6F, 0x72, 0x8C, 0xD4, 0x80,
+    0x6D, 0xDB, 0x67, 0x48, 0xC7, 0x3C, 0x00, 0x77, 0x18, 0xC7, 0x0E, 0x3D, 0x1E, 0xB1, 0xE6, 0x45,
+    0x8B, 0x01, 0xA5, 0x4C, 0x56, 0xFB, 0xF1, 0x89, 0x4D, 0x58, 0x29, 0x89, 0x22, 0xF0, 0x87, 0x4F,
+    0x67, 0x9C, 0x70, 0x2D, 0x93, 0xF3, 0x8F, 0xA3, 0xED, 0xBF, 0xF3, 0x79, 0x72, 0xE2, 0x1E, 0xE5,
+    0xDE, 0xB1, 0xFF, 0xA3, 0xDE, 0x7F, 0xB7, 0xFE, 0x00, 0xA5, 0x55, 0xBF, 0x6F, 0x23, 0x45, 0x18,
+    0x7D, 0x3B, 0x23, 0x32, 0xB9, 0x6C, 0x9C, 0xB9, 0x82, 0x22, 0x88, 0x24, 0x4B, 0x41, 0x11, 0x24,
+    0xEC, 0x4D, 0x91, 0x13, 0x2E, 0x9C, 0x78, 0x50, 0x4A, 0x1A, 0x84, 0x28, 0xA0, 0x4B, 0x41, 0x81,
+    0x94, 0x02, 0x17, 0x2E, 0x8C, 0xE4, 0x23, 0x73, 0x20, 0x41, 0x9B, 0x7F, 0xE0, 0xA4, 0x14, 0x14,
+    0x48, 0xE8, 0x14, 0x0B, 0x05, 0xC9, 0x48, 0xB9, 0x78, 0x82, 0x5B, 0x8A, 0x89, 0x28, 0x68, 0x87,
+    0x13, 0x12, 0x90, 0x6B, 0xF6, 0xA4, 0x95, 0xCE, 0x09, 0x8E, 0x87, 0x6F, 0xD6, 0x09, 0x97, 0xE4,
+    0xEE, 0x20, 0xC0, 0x68, 0x57, 0xDF, 0x6A, 0xE7, 0xCD, 0x9B, 0xF7, 0xFD, 0x9A, 0x01, 0x9A, 0xAF,
+    0x00, 0x3F, 0xAC, 0x23, 0xEA, 0x1B, 0x40, 0xA1, 0x18, 0x6C, 0xA4, 0x90, 0x7E, 0xED, 0x30, 0x8C,
+    0x72, 0x96, 0xA1, 0x2B, 0x0C, 0xF6, 0x62, 0x85, 0x96, 0x04, 0x5A, 0x0B, 0xC0, 0x6E, 0x19, 0xC8,
+    0xCA, 0x60, 0xAE, 0x8E, 0xD8, 0xA6, 0x47, 0x3D, 0x9D, 0x78, 0x0F, 0xE9, 0x87, 0x60, 0x7E, 0x6B,
+    0xBC, 0x1E, 0xDB, 0x1F, 0x20, 0x72, 0x39, 0xF8, 0xCF, 0x19, 0xCE, 0xC7, 0xFF, 0xE4, 0x64, 0x0C,
+    0x8F, 0x95, 0x44, 0xE2, 0x2A, 0x15, 0x5C, 0x1A, 0xDC, 0x5C, 0x32, 0xF6, 0xB9, 0x26, 0x7D, 0x5C,
+    0x98, 0xFD, 0x1D, 0x17, 0xCC, 0x90, 0xE7, 0xC1, 0xEC, 0xB1, 0x51, 0x30, 0x6D, 0xF6, 0x47, 0x58,
+    0x5F, 0x66, 0x8F, 0xC2, 0xA4, 0x8C, 0xB2, 0x16, 0x19, 0x71, 0x87, 0x14, 0xD1, 0xCE, 0x87, 0x99,
+    0x0C, 0x98, 0x6F, 0xF3, 0x58, 0x93, 0xA9, 0xE7, 0x71, 0xE0, 0x89, 0x47, 0x05, 0x4F, 0xE4, 0x7D,
+    0xE1, 0xE2, 0x99, 0x39, 0x19, 0xAB, 0x1D, 0x8C, 0xA5, 0x0D, 0xFF, 0xC6, 0xFC, 0x72, 0xD9, 0x0B,
+    0x44, 0x66, 0xAC, 0x33, 0xD2, 0xE7, 0x7F, 0x62, 0xC3, 0xDD, 0x2A, 0x12, 0xE4, 0xD8, 0x13, 0xF4,
+    0x99, 0x42, 0xAA, 0x01, 0xDA, 0xDC, 0x30, 0x97, 0xD0, 0x67, 0x17, 0x35, 0xE6, 0x98, 0x93, 0x36,
+    0x55, 0x75, 0x0A, 0x93, 0xF7, 0x16, 0xBD, 0xE3, 0x73, 0x2E, 0xE2, 0x98, 0x23, 0x1B, 0xE8, 0xAE,
+    0x6C, 0x03, 0x8A, 0xFD, 0x40, 0x6A, 0x61, 0x56, 0x90, 0x46, 0xF4, 0x49, 0x9B, 0xD8, 0xB0, 0x49,
+    0x91, 0x11, 0x6E, 0x2B, 0x90, 0xE8, 0xA2, 0xCB, 0xC9, 0x47, 0x49, 0x09, 0xA8, 0xFB, 0x1C, 0xE9,
+    0x48, 0x5D, 0x0E, 0x76, 0xC5, 0x90, 0xD8, 0xAD, 0x73, 0x85, 0x75, 0x24, 0xEA, 0xD9, 0x0A, 0x5B,
+    0xCF, 0x57, 0xC8, 0x8C, 0x83, 0xA4, 0x68, 0x7E, 0xF8, 0xDA, 0x45, 0x67, 0xFF, 0x13, 0x15, 0x6E,
+    0x52, 0xB5, 0x85, 0xE8, 0x71, 0x75, 0xC5, 0xD3, 0x16, 0x2A, 0x35, 0xB4, 0x57, 0x90, 0x55, 0xB8,
+    0x4D, 0xA5, 0x4A, 0xC8, 0xB7, 0x21, 0x64, 0x46, 0xF5, 0x45, 0xBB, 0x41, 0x6A, 0xA4, 0x0A, 0x75,
+    0xA0, 0x47, 0xD0, 0x4E, 0x70, 0x2C, 0xC9, 0xD1, 0xE9, 0x72, 0xD3, 0x99, 0x81, 0x6D, 0xC4, 0xEC,
+    0x20, 0x97, 0x3D, 0xD4, 0xB7, 0x88, 0x38, 0x06, 0xAA, 0x84, 0x79, 0xD9, 0x62, 0x77, 0x39, 0x32,
+    0xB3, 0x4C, 0xEF, 0xF2, 0x35, 0x25, 0x6E, 0x20, 0x9E, 0x82, 0x14, 0x6A, 0x81, 0xD9, 0x32, 0xB2,
+    0x5A, 0xE4, 0x56, 0xBC, 0xF9, 0x8E, 0x6A, 0xE9, 0xC5, 0x02, 0xDD, 0x2A, 0x0A, 0x4E, 0x73, 0xEF,
+    0x2A, 0xF1, 0x1D, 0x3B, 0x3F, 0x83, 0xCE, 0x12, 0x3F, 0x30, 0xA9, 0x78, 0x38, 0x90, 0xDE, 0x25,
+    0xBF, 0x8E, 0xA5, 0x5A, 0x4C, 0x01, 0x8D, 0xBF, 0xF4, 0xC6, 0x0E, 0x7E, 0x10, 0x7F, 0xEA, 0x9A,
+    0x62, 0x4D, 0xBF, 0x3E, 0x8D, 0xAC, 0x11, 0x1F, 0x9C, 0x8C, 0xB8, 0x1F, 0x88, 0x63, 0x0B, 0xAE,
+    0x21, 0x1C, 0xA6, 0x67, 0xC7, 0xB4, 0x84, 0x63, 0xAE, 0x2B, 0x54, 0x93, 0x78, 0x09, 0x38, 0xC7,
+    0xB2, 0x64, 0xC7, 0x11, 0x71, 0x40, 0x26, 0xD3, 0xB8, 0xF5, 0x1E, 0x96, 0x8A, 0x6A, 0x4C, 0xBF,
+    0x82, 0xEB, 0x72, 0xD5, 0x8C, 0xD1, 0x29, 0x5D, 0x81, 0x2D, 0xDE, 0x40, 0xBB, 0x8C, 0xBD, 0x95,
+    0x7F, 0x26, 0xA4, 0x33, 0x61, 0x52, 0xE3, 0x1D, 0xA0, 0x68, 0x9B, 0x7D, 0x6A, 0x4A, 0xDD, 0xAD,
+    0x10, 0xB4, 0xCA, 0x8C, 0x91, 0x02, 0x7B, 0x84, 0xAC, 0x7B, 0xBD, 0x79, 0xF7, 0x2C, 0xB3, 0x83,
+    0xE0, 0x86, 0x3F, 0x34, 0x95, 0xD8, 0x95, 0x84, 0xBA, 0xBD, 0x61, 0x5D, 0xEC, 0x7F, 0x23, 0x4E,
+    0x4A, 0x51, 0x0A, 0x24, 0x3B, 0xA7, 0x13, 0x34, 0xED, 0x33, 0x71, 0xFC, 0xB0, 0x48, 0x60, 0x6A,
+    0x3E, 0x59, 0xAF, 0x61, 0x9E, 0xCA, 0x8E, 0x5C, 0x74, 0x58, 0x81, 0x1C, 0xA1, 0x67, 0x26, 0x01,
+    0x8D, 0x25, 0xAA, 0xFC, 0x90, 0xDD, 0xDD, 0xE2, 0x39, 0x1B, 0x13, 0x39, 0x65, 0x21, 0xC6, 0xFA,
+    0xC7, 0x3B, 0xDF, 0xFB, 0xDF, 0x4B, 0x45, 0xAC, 0x8F, 0x5F, 0x60, 0x3E, 0x8F, 0xFC, 0xB8, 0x6F,
+    0x4C, 0x88, 0x69, 0xE7, 0x4A, 0x6B, 0xDD, 0x47, 0xB9, 0xC4, 0xCC, 0xEC, 0xC2, 0x46, 0xD6, 0x3B,
+    0x59, 0x53, 0x98, 0x01, 0x56, 0xDF, 0x54, 0xBD, 0x53, 0x6C, 0x92, 0x4B, 0xC4, 0x71, 0x1F, 0x62,
+    0xEA, 0x1A, 0xC8, 0xC5, 0x97, 0x42, 0x35, 0x0D, 0x6E, 0x3F, 0x21, 0xFE, 0x48, 0x31, 0x6B, 0x49,
+    0x0C, 0xC1, 0xD3, 0xD1, 0xD6, 0x72, 0xA1, 0x86, 0xF0, 0xA9, 0x57, 0x62, 0x84, 0x09, 0xF2, 0xA9,
+    0xA0, 0x8D, 0xE9, 0xB7, 0x15, 0x58, 0x84, 0x13, 0xAA, 0x46, 0x81, 0xA0, 0x9E, 0x64, 0x9A, 0xEA,
+    0xCA, 0x5E, 0xEC, 0xFD, 0x6D, 0x2C, 0x53, 0xCB, 0xC6, 0x14, 0x85, 0xC8, 0x12, 0xA6, 0x46, 0x91,
+    0xD4, 0x74, 0x8C, 0x1C, 0xEA, 0x62, 0xD6, 0x3D, 0x35, 0x2B, 0xC5, 0x17, 0xFD, 0x07, 0xDB, 0x5F,
+    0x16, 0xCB, 0x1B, 0xB4, 0x41, 0x09, 0x82, 0xBA, 0x8A, 0x80, 0x4D, 0x9A, 0x95, 0xE7, 0xC4, 0xDD,
+    0x62, 0x16, 0x1B, 0x47, 0x74, 0x8C, 0x0E, 0x70, 0x73, 0x19, 0xC9, 0x23, 0x13, 0xB9, 0x7B, 0xE4,
+    0x57, 0x86, 0x06, 0xD7, 0xCC, 0x10, 0xE9, 0xE7, 0x54, 0x33, 0x54, 0xB7, 0x49, 0x90, 0xC3, 0xFB,
+    0xE0, 0xEF, 0x6B, 0xF4, 0x8B, 0xB3, 0x34, 0x52, 0xD8, 0x1C, 0x22, 0x15, 0x4A, 0x46, 0x56, 0xE8,
+    0x26, 0x33, 0x24, 0x5E, 0xA2, 0x2D, 0x74, 0x85, 0x3A, 0x51, 0x3D, 0x23, 0x37, 0x71, 0x8E, 0x93,
+    0x5D, 0x09, 0xD7, 0x60, 0x7D, 0x33, 0x33, 0x83, 0x2A, 0x55, 0xC8, 0xC9, 0x3E, 0xF3, 0x8E, 0x9D,
+    0xE2, 0x2C, 0x37, 0xA5, 0xA7, 0x72, 0x43, 0x73, 0xAB, 0xF7, 0xB8, 0xA9, 0xCE, 0xA1, 0x93, 0xF1,
+    0xCF, 0x34, 0x2D, 0xEB, 0xAC, 0xEE, 0xE8, 0xDE, 0x00, 0x3D, 0x75, 0x96, 0x9B, 0x89, 0xA9, 0x6B,
+    0x20, 0xE7, 0x27, 0xE9, 0x0A, 0x9B, 0x90, 0xD7, 0x92, 0x42, 0x79, 0x6C, 0x51, 0x1E, 0xDB, 0x4F,
+    0x44, 0xF4, 0x14, 0x3F, 0xB2, 0x84, 0x26, 0xEA, 0x1A, 0x5C, 0x95, 0x1E, 0x66, 0x88, 0x3B, 0x1D,
+    0x05, 0x1E, 0xD0, 0xED, 0x94, 0x83, 0x15, 0x07, 0x5E, 0xF4, 0x6E, 0xCF, 0x87, 0x36, 0x78, 0x95,
+    0x2E, 0x2A, 0x3A, 0x96, 0x8A, 0x5F, 0xF4, 0x4E, 0xD3, 0xBB, 0x48, 0xEF, 0x12, 0x8A, 0x2E, 0x29,
+    0x8E, 0x72, 0x4A, 0x9C, 0x08, 0x97, 0x1E, 0xA5, 0x8A, 0x04, 0xD6, 0xDE, 0x30, 0x68, 0x7C, 0x63,
+    0x90, 0xFD, 0x68, 0xF0, 0xA0, 0xAF, 0xF1, 0xD3, 0x5B, 0x74, 0x65, 0xEC, 0xD3, 0x4B, 0x37, 0x45,
+    0xDD, 0x8E, 0xA3, 0xE2, 0xC2, 0xB9, 0x38, 0x5E, 0x19, 0x1C, 0x99, 0xA7, 0x97, 0x12, 0x8D, 0xB7,
+    0x2F, 0x14, 0xB2, 0x05, 0xB3, 0xE3, 0x4B, 0x9A, 0x14, 0x3A, 0xC9, 0x55, 0x75, 0x2E, 0xB2, 0x9D,
+    0x98, 0x9B, 0x9A, 0x64, 0xA1, 0x0B, 0xFD, 0x69, 0x74, 0xDA, 0xC1, 0xBF, 0x1A, 0x7F, 0x02, 0xAD,
+    0x94, 0xBF, 0x6F, 0x1B, 0x37, 0x14, 0xC7, 0xBF, 0x47, 0x36, 0x66, 0x9A, 0xB3, 0xC5, 0x0E, 0x19,
+    0x1C, 0x54, 0x3F, 0x32, 0x78, 0x30, 0x0A, 0x25, 0x97, 0x41, 0x83, 0x86, 0xB3, 0xEF, 0xDA, 0x8E,
+    0x1D, 0xEA, 0xA1, 0x53, 0x27, 0x8F, 0x05, 0x5A, 0x20, 0x19, 0x34, 0xA4, 0x40, 0x62, 0xB1, 0x73,
+    0x97, 0xCC, 0x9D, 0x3C, 0x64, 0x2B, 0x82, 0x68, 0xF0, 0x20, 0xA0, 0x4E, 0x44, 0x38, 0x63, 0x97,
+    0xFB, 0x13, 0x6E, 0x08, 0x0A, 0xB4, 0xCE, 0x70, 0xC3, 0x01, 0x55, 0x5C, 0x49, 0xEC, 0x97, 0xA7,
+    0x58, 0x92, 0x83, 0xA2, 0x75, 0x82, 0x12, 0x10, 0xC4, 0xE3, 0x1D, 0xF9, 0x79, 0xDF, 0xF7, 0xBE,
+    0x7C, 0x00, 0x20, 0x53, 0x6C, 0x23, 0xB0, 0x58, 0x8E, 0x1A, 0x06, 0x5D, 0x69, 0xB3, 0x9A, 0x42,
+    0xAF, 0x2D, 0x6C, 0xA1, 0xA5, 0x1D, 0x6A, 0x97, 0x27, 0x2E, 0xED, 0x7F, 0x07, 0x74, 0x20, 0xC6,
+    0xA8, 0x6F, 0xFE, 0xD7, 0x67, 0x87, 0x5B, 0xEA, 0x24, 0x8B, 0x74, 0x5A, 0x1D, 0xD8, 0x15, 0x36,
+    0xD7, 0x32, 0xED, 0xD6, 0x83, 0x6C, 0x10, 0x4A, 0x1B, 0x6B, 0xC1, 0xCF, 0x8C, 0x9B, 0x06, 0xD3,
+    0x01, 0xDF, 0x5E, 0x03, 0x54, 0x15, 0x06, 0x52, 0xBC, 0x3D, 0x06, 0xD2, 0x36, 0x82, 0x4C, 0x9A,
+    0x02, 0x45, 0x0F, 0x71, 0x8C, 0xF0, 0x09, 0x02, 0x07, 0x24, 0x06, 0xDA, 0x42, 0xE6, 0x08, 0x0A,
+    0x88, 0x12, 0xAD, 0x12, 0x61, 0xBE, 0xD8, 0x63, 0xFD, 0x71, 0x6D, 0xC0, 0x41, 0x7E, 0x89, 0x7A,
+    0x0D, 0x87, 0xDB, 0x32, 0xCD, 0xD6, 0x15, 0xEE, 0xF5, 0xC4, 0x8F, 0x46, 0x97, 0x54, 0x40, 0xB5,
+    0xD7, 0xBC, 0x92, 0x0A, 0xA8, 0x95, 0x51, 0x27, 0xB9, 0x38, 0x7C, 0xBC, 0xA4, 0xB6, 0x51, 0xA8,
+    0xB4, 0x87, 0x3C, 0x46, 0xDC, 0x80, 0xD6, 0x10, 0xA7, 0x29, 0xFA, 0x16, 0x3A, 0x87, 0x2C, 0x80,
+    0x31, 0xF0, 0x00, 0x78, 0x06, 0x35, 0xF5, 0xA9, 0x58, 0x19, 0xA3, 0x09, 0xF0, 0xD5, 0xCA, 0x73,
+    0x8B, 0xBF, 0xC4, 0xAF, 0x03, 0xC1, 0x29, 0x15, 0xFE, 0x0A, 0x84, 0x5F, 0xA4, 0x68, 0xAA, 0x14,
+    0xB1, 0x32, 0x18, 0x2A, 0x13, 0x14, 0xCA, 0x4A, 0xE7, 0x6C, 0xC8, 0x5F, 0x2B, 0x55, 0x76, 0x17,
+    0x2A, 0x03, 0xAE, 0x63, 0x34, 0xF5, 0xFB, 0x23, 0x03, 0x37, 0x16, 0xF9, 0x90, 0xB1, 0x30, 0xD7,
+    0xEB, 0x28, 0xEA, 0xA2, 0x68, 0x3D, 0xCD, 0x99, 0x64, 0xF5, 0x3A, 0x9B, 0x23, 0xEE, 0xAD, 0x03,
+    0xBB, 0x25, 0x51, 0xE6, 0x62, 0xDE, 0xDE, 0x13, 0x7D, 0xF3, 0x03, 0x74, 0xEA, 0x48, 0x0A, 0xAC,
+    0xA5, 0x97, 0x08, 0x80, 0x10, 0x9F, 0x0F, 0x32, 0x9A, 0x83, 0x0A, 0x71, 0x74, 0xE4, 0x09, 0xD2,
+    0xDE, 0xF7, 0x80, 0x16, 0x1E, 0xF8, 0xF3, 0x47, 0x6E, 0xC2, 0xE3, 0x5F, 0xE4, 0x78, 0x58, 0x55,
+    0x5A, 0xF0, 0xE0, 0x3B, 0xFC, 0x5B, 0x94, 0xEB, 0x39, 0xB4, 0x33, 0xC3, 0xDB, 0x44, 0xD0, 0x25,
+    0x56, 0x2B, 0x1C, 0x93, 0x40, 0x77, 0xF4, 0x9F, 0x40, 0x18, 0x50, 0x5E, 0x73, 0xA9, 0xAA, 0x53,
+    0x1D, 0x71, 0xC1, 0xAB, 0xD5, 0xB8, 0x9B, 0xF9, 0x8C, 0x25, 0x29, 0xB4, 0xF1, 0xA6, 0xF0, 0xE5,
+    0xA1, 0xF3, 0xE8, 0x0D, 0x44, 0xF3, 0x10, 0xE9, 0x17, 0xE9, 0x4E, 0x6D, 0xE4, 0xC6, 0x70, 0x2E,
+    0x55, 0x2E, 0x3F, 0x77, 0x4A, 0x17, 0xE1, 0xC2, 0x76, 0x23, 0x1C, 0xEC, 0x6B, 0x04, 0x19, 0x62,
+    0x48, 0xC3, 0x37, 0x32, 0x43, 0x32, 0xC6, 0x68, 0x4E, 0xDB, 0x46, 0x55, 0xF8, 0x8D, 0xCD, 0x0B,
+    0xE0, 0x35, 0x5A, 0xC0, 0x95, 0x9E, 0xEC, 0xB1, 0xBB, 0xA8, 0x98, 0xDE, 0xF4, 0x8C, 0x40, 0xF8,
+    0xA9, 0xAD, 0xD8, 0x70, 0x67, 0x85, 0x70, 0xCE, 0x48, 0x37, 0xC5, 0x02, 0xEE, 0xEF, 0x05, 0xC4,
+    0x2B, 0x6C, 0x5E, 0xE5, 0x4C, 0x4C, 0x08, 0x97, 0x16, 0x0D, 0xA0, 0xF0, 0xF4, 0x1A, 0xB0, 0xC3,
+    0x6D, 0xF9, 0x39, 0xFE, 0x43, 0xF8, 0x70, 0xFC, 0x1A, 0xDE, 0x0E, 0x20, 0x74, 0x99, 0x2C, 0xAB,
+    0xE0, 0xC8, 0x57, 0xFC, 0xBC, 0xAC, 0x2A, 0xE3, 0xF1, 0x74, 0x80, 0xE4, 0x7A, 0x32, 0x3B, 0xF6,
+    0x74, 0xCD, 0x48, 0xFB, 0xB3, 0xF9, 0xBE, 0x90, 0x55, 0x0A, 0x0E, 0xAB, 0x69, 0x64, 0x0F, 0xF6,
+    0x63, 0x82, 0xB5, 0xE7, 0xE6, 0x44, 0xE8, 0xD9, 0x39, 0x95, 0xA5, 0xDA, 0x42, 0xF0, 0x0A, 0x3E,
+    0x49, 0xFF, 0x4B, 0xCA, 0x83, 0x74, 0xAF, 0xC6, 0x7B, 0x8C, 0x00, 0x97, 0x48, 0xB9, 0x97, 0xCD,
+    0x72, 0xD7, 0xA8, 0xBB, 0x71, 0x81, 0x1D, 0x39, 0xFA, 0xD2, 0x59, 0x69, 0x5B, 0xA6, 0x41, 0xA9,
+    0x03, 0xEC, 0x30, 0x73, 0x65, 0x93, 0xBB, 0x8F, 0xC0, 0x2E, 0x84, 0x63, 0xCD, 0x76, 0x70, 0xF0,
+    0xB3, 0xA3, 0xE8, 0x52, 0x3B, 0x07, 0xB6, 0xA4, 0x79, 0x9F, 0x83, 0x62, 0xAE, 0xC3, 0x3A, 0xCB,
+    0xC8, 0xF6, 0x50, 0xEF, 0xE2, 0x6E, 0xFB, 0x23, 0xE1, 0x86, 0x08, 0x3F, 0x2B, 0xD1, 0x60, 0xE8,
+    0xED, 0x20, 0x67, 0xAB, 0xCA, 0xD0, 0x65, 0x16, 0x13, 0x06, 0x91, 0x38, 0x8B, 0xF0, 0xCF, 0xE5,
+    0xCD, 0x12, 0xD4, 0xA2, 0xDD, 0x04, 0xB1, 0x18, 0x07, 0x79, 0x50, 0x30, 0x87, 0x59, 0x0C, 0xFD,
+    0xF5, 0x99, 0xD9, 0x71, 0x33, 0x14, 0x6C, 0x4E, 0xB6, 0xC0, 0x73, 0xF5, 0xC7, 0xA8, 0x88, 0xA8,
+    0xD8, 0xB9, 0x42, 0xBA, 0xAA, 0x3D, 0x78, 0x30, 0x99, 0x9F, 0x9C, 0xA5, 0x60, 0xFD, 0x39, 0x0D,
+    0x8E, 0x07, 0x88, 0xFE, 0x32, 0x22, 0x7B, 0x56, 0x61, 0x07, 0xCA, 0x48, 0x73, 0x0B, 0x35, 0x4E,
+    0x3D, 0x95, 0x01, 0x63, 0x74, 0x7F, 0xA9, 0x96, 0x25, 0xBB, 0xB2, 0x77, 0xFE, 0x20, 0x89, 0x1F,
+    0xCD, 0x52, 0x0D, 0xEF, 0x13, 0x7F, 0x35, 0x18, 0x2E, 0xEB, 0x4B, 0x57, 0x65, 0x18, 0xB2, 0x04,
+    0xF3, 0xF5, 0xC8, 0xB3, 0xBD, 0x6E, 0xCE, 0x17, 0xDD, 0xE4, 0x4D, 0xDD, 0x52, 0x91, 0x65, 0x21,
+    0xF6, 0x9B, 0xDF, 0x16, 0xD1, 0xEC, 0x51, 0xC7, 0x7B, 0x10, 0xBB, 0x9F, 0xA6, 0x11, 0x4B, 0x44,
+    0x6B, 0xF8, 0xBA, 0xDC, 0xD9, 0x80, 0x3C, 0x65, 0x7F, 0xCD, 0x56, 0x32, 0xFE, 0xEE, 0xD8, 0x9B,
+    0x57, 0xD1, 0x5B, 0xE9, 0x24, 0x97, 0x81, 0xE3, 0xC6, 0xDC, 0xE4, 0x0F, 0x57, 0x6B, 0x9D, 0xF8,
+    0x0E, 0xF5, 0xD2, 0x9F, 0x4E, 0x08, 0xEB, 0x83, 0x5B, 0x3E, 0x9A, 0x1C, 0x7D, 0x1A, 0xDF, 0xE0,
+    0xCD, 0xBA, 0x98, 0x53, 0x3D, 0x1C, 0xC2, 0xFA, 0x95, 0x6F, 0x96, 0x37, 0xA4, 0xC4, 0x51, 0x87,
+    0xCC, 0xEF, 0x9F, 0x9E, 0xB8, 0xDF, 0x37, 0x2A, 0xE4, 0xEB, 0x2B, 0xBC, 0xB4, 0x81, 0x33, 0xEF,
+    0xA5, 0x6C, 0x7D, 0xDE, 0xC3, 0x5A, 0x0B, 0x49, 0xE1, 0xE7, 0xE9, 0x60, 0x4D, 0xFD, 0x34, 0xA1,
+    0xA2, 0xCC, 0xBB, 0x58, 0x3F, 0xDA, 0xA3, 0xA0, 0xD6, 0x18, 0x9B, 0x08, 0xAA, 0x06, 0x76, 0x7B,
+    0xA9, 0xE6, 0x9F, 0xAE, 0xD3, 0xBB, 0xE7, 0x76, 0x7F, 0x0B, 0xBF, 0x00, 0xF9, 0xEA, 0x21, 0x1F,
+    0x67, 0xCC, 0x6C, 0x3B, 0xF8, 0xE1, 0xB7, 0x51, 0xE8, 0x1E, 0x77, 0xFC, 0x4B, 0xF9, 0xF2, 0x3A,
+    0x3B, 0x83, 0x9A, 0xE1, 0xDF, 0xC6, 0xDF, 0x9D, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xB3,
+    0x93, 0x64, 0x85, 0xF7, 0x72, 0xE3, 0x22, 0x12, 0x11, 0x92, 0xBD, 0x2E, 0x5C, 0x04, 0xC9, 0xB9,
+    0x73, 0xE1, 0xC2, 0x28, 0x7B, 0xD9, 0x15, 0x48, 0x74, 0x48, 0x2E, 0x68, 0x52, 0x41, 0x49, 0x19,
+    0xA1, 0x14, 0x46, 0xBA, 0xC4, 0x2B, 0x90, 0xD2, 0xC6, 0x05, 0x42, 0x94, 0xAE, 0x83, 0x44, 0xAE,
+    0x88, 0xD0, 0x15, 0x11, 0x9E, 0x90, 0x1F, 0xC0, 0x44, 0x48, 0x20, 0x41, 0xB3, 0xA0, 0x54, 0x14,
+    0x68, 0x10, 0x5B, 0x9C, 0xC8, 0xC9, 0xC3, 0xFB, 0x66, 0xEF, 0xEC, 0x28, 0xA1, 0x81, 0xD3, 0xD9,
+    0x3B, 0x9E, 0x9D, 0xEF, 0x7D, 0xEF, 0xFB, 0xDE, 0xFB, 0xC6, 0x40, 0x1F, 0xC0, 0x1D, 0x40, 0x5F,
+    0x40, 0xFC, 0xDC, 0xA8, 0x70, 0x1C, 0xAC, 0x79, 0xA6, 0xF0, 0x08, 0x48, 0x1D, 0x30, 0xE4, 0x66,
+    0xCB, 0xA5, 0x05, 0x72, 0x1C, 0x34, 0x53, 0x7C, 0xF0, 0xC4, 0x63, 0xC7, 0x34, 0xA9, 0x1B, 0x86,
+    0x80, 0x32, 0xCC, 0x31, 0x3C, 0xA9, 0x00, 0xC5, 0xF7, 0x73, 0xC0, 0x1D, 0x76, 0x30, 0xC8, 0x7E,
+    0xA8, 0xF2, 0x63, 0xDB, 0xD7, 0x3E, 0xC5, 0x4C, 0xD7, 0x23, 0x58, 0x83, 0x6D, 0x53, 0x9B, 0x07,
+    0x4E, 0x07, 0x8F, 0xE1, 0x14, 0x18, 0x61, 0xF5, 0x00, 0x79, 0x40, 0x1A, 0x80, 0x73, 0x12, 0x41,
+    0x10, 0x0D, 0x0B, 0xF3, 0x35, 0x60, 0x1C, 0x96, 0x9F, 0xF3, 0x9F, 0x23, 0x63, 0x8E, 0x93, 0x6A,
+    0x35, 0x63, 0x86, 0xDB, 0x40, 0xE2, 0xF9, 0x9E, 0x67, 0xC7, 0xCC, 0xE9, 0xD3, 0x93, 0xAC, 0x3E,
+    0x3F, 0x2F, 0xA1, 0xAB, 0x13, 0xDC, 0x4E, 0x42, 0xF0, 0x3A, 0x04, 0x9B, 0x84, 0x67, 0xC0, 0xA6,
+    0xC2, 0x95, 0x35, 0xE4, 0x33, 0x5C, 0xA8, 0x16, 0x48, 0xC3, 0xF7, 0xD4, 0xF3, 0xB9, 0xAE, 0xE7,
+    0x24, 0xD4, 0x47, 0xDB, 0x83, 0xEF, 0xE9, 0x86, 0x7C, 0x0C, 0x03, 0x9E, 0xD7, 0x84, 0x24, 0x9D,
+    0x83, 0x39, 0x0E, 0x3C, 0x94, 0x9C, 0x96, 0xB0, 0x56, 0x4A, 0x7E, 0x81, 0xC8, 0x30, 0x78, 0x36,
+    0x46, 0x08, 0x90, 0x87, 0xD0, 0xE9, 0x0E, 0x08, 0x8D, 0x01, 0x5E, 0xFF, 0x8B, 0x6D, 0x29, 0xEB,
+    0xFC, 0x6D, 0xB2, 0x30, 0xEC, 0x4C, 0xEC, 0x4A, 0x83, 0x84, 0xDF, 0xC3, 0xFF, 0xC5, 0xE0, 0x46,
+    0xC5, 0x82, 0xA4, 0xF0, 0x61, 0x27, 0xC4, 0xA3, 0x58, 0xB7, 0xF2, 0x51, 0x87, 0xDF, 0x1A, 0x75,
+    0xC0, 0xB2, 0xDF, 0x99, 0xA9, 0x56, 0x64, 0x60, 0xCE, 0x58, 0xF5, 0xE2, 0x73, 0xE9, 0xC5, 0x08,
+    0xE1, 0x7B, 0x49, 0x76, 0xE7, 0x42, 0x98, 0xF1, 0xDA, 0xE1, 0x42, 0xFD, 0xDF, 0xF9, 0x4C, 0x3A,
+    0x08, 0xFD, 0xEE, 0x32, 0xC7, 0x39, 0xEC, 0x53, 0xC5, 0x87, 0x28, 0xE0, 0xA9, 0x86, 0xC7, 0x54,
+    0x35, 0x68, 0xB5, 0x53, 0x5E, 0xBB, 0xC4, 0xA7, 0x21, 0x34, 0x59, 0x08, 0x04, 0xE3, 0x4F, 0x65,
+    0xEC, 0x10, 0xC6, 0x96, 0xC8, 0xEB, 0xEB, 0x18, 0x56, 0xB8, 0x08, 0xF9, 0x7D, 0xF3, 0x48, 0x70,
+    0xB6, 0x80, 0x5D, 0x60, 0x3B, 0xE2, 0x37, 0xC0, 0x8F, 0x87, 0x49, 0x68, 0x75, 0xBB, 0xAF, 0xED,
+    0x6E, 0x5A, 0xED, 0x18, 0xDC, 0x34, 0x98, 0xAC, 0xC3, 0x8F, 0x54, 0x53, 0x24, 0x0E, 0x9B, 0xB8,
+    0xCC, 0xA4, 0xC5, 0x32, 0x29, 0x8B, 0x99, 0x32, 0xC9, 0x3C, 0xFD, 0xFD, 0x7E, 0xFB, 0x52, 0x52,
+    0x9B, 0xBF, 0x9C, 0x94, 0x89, 0xDE, 0xDA, 0x53, 0xE1, 0xA8, 0x4B, 0xA4, 0x7E, 0x3E, 0x4B, 0x94,
+    0xBD, 0x9A, 0x68, 0x7F, 0xBB, 0xF7, 0x85, 0xFA, 0xCC, 0x2E, 0x1B, 0x3A, 0x46, 0x56, 0xB3, 0x79,
+    0x46, 0xDA, 0x37, 0x90, 0x06, 0x16, 0x32, 0x10, 0x53, 0x18, 0xD9, 0xCD, 0xA1, 0x3D, 0x4A, 0x3A,
+    0xF3, 0xD3, 0xE4, 0x4B, 0xFB, 0x9D, 0xDB, 0x90, 0x80, 0x0D, 0xA6, 0xBB, 0x48, 0x3F, 0x73, 0x2C,
+    0x1A, 0xD6, 0xB7, 0xC6, 0x50, 0x2D, 0x68, 0x7B, 0x59, 0x38, 0xF5, 0x36, 0xB1, 0x88, 0x3A, 0x02,
+    0x2B, 0x21, 0xD8, 0x40, 0xD4, 0xE1, 0x19, 0x1A, 0x6A, 0x0A, 0xDD, 0x88, 0x72, 0x63, 0x01, 0x36,
+    0x12, 0xA6, 0x43, 0xF3, 0x7E, 0x37, 0x23, 0x13, 0xA2, 0xF5, 0x90, 0x42, 0xD7, 0x04, 0xBE, 0x45,
+    0x1E, 0x06, 0x32, 0x4B, 0x05, 0x0F, 0x4F, 0x09, 0xE0, 0x95, 0x4F, 0x1A, 0xED, 0xB4, 0x4D, 0x6D,
+    0x66, 0x4D, 0x9D, 0x57, 0xC3, 0x6A, 0x13, 0x1F, 0xCA, 0xB0, 0x00, 0xAF, 0x31, 0xC7, 0x28, 0x66,
+    0x5E, 0x25, 0x4C, 0x03, 0xAB, 0x6C, 0x52, 0xEB, 0x3A, 0xAD, 0x0C, 0x41, 0x2E, 0x53, 0x82, 0x41,
+    0x1C, 0x5C, 0x92, 0x50, 0x47, 0x0B, 0x8A, 0xA9, 0xA5, 0x7F, 0x5B, 0xA2, 0xE7, 0xA4, 0xCA, 0xB2,
+    0x45, 0xE8, 0x01, 0xAB, 0x16, 0x95, 0x69, 0x86, 0x32, 0x0A, 0xA8, 0xEB, 0x9D, 0x14, 0x47, 0x7D,
+    0xE5, 0x0A, 0xD2, 0x1F, 0x6B, 0x97, 0xD5, 0x05, 0x5A, 0x66, 0xC7, 0x4C, 0x79, 0x83, 0x81, 0xF8,
+    0x61, 0x80, 0x42, 0xBB, 0xD4, 0x16, 0x94, 0xAB, 0x36, 0x75, 0x8B, 0xD6, 0x20, 0xE7, 0xBE, 0xBF,
+    0x8A, 0x92, 0x31, 0x6A, 0xC6, 0x02, 0x81, 0xD2, 0x21, 0xA5, 0x03, 0x28, 0xB2, 0xB4, 0x60, 0x9D,
+    0x79, 0x85, 0xED, 0x9B, 0x58, 0x5C, 0x0E, 0x89, 0xC5, 0x4D, 0x56, 0x3D, 0xD1, 0x15, 0x9A, 0x94,
+    0x8D, 0x5D, 0xE1, 0x4E, 0x9F, 0x7D, 0x58, 0xE3, 0xF4, 0x53, 0x0E, 0x92, 0x94, 0xAB, 0x8C, 0xD6,
+    0xE2, 0x0A, 0x2B, 0x32, 0x9A, 0xCB, 0x4E, 0xD3, 0x5F, 0x02, 0xFC, 0x38, 0x9A, 0x1E, 0x6F, 0x40,
+    0xDA, 0x2B, 0x87, 0xE4, 0x4E, 0x9B, 0x9E, 0x4E, 0x15, 0xAB, 0x67, 0x85, 0xCB, 0xFD, 0x87, 0x90,
+    0xCE, 0xCA, 0xFE, 0x28, 0xCE, 0x3A, 0x6F, 0x12, 0x7D, 0x02, 0x5C, 0x5F, 0xDE, 0x26, 0x29, 0x17,
+    0x7F, 0x90, 0xEB, 0xE5, 0xF8, 0x17, 0x33, 0x2B, 0x17, 0xBD, 0x4C, 0x86, 0xD8, 0xE1, 0xEB, 0x6E,
+    0x60, 0x84, 0x8D, 0x3D, 0xDD, 0x9F, 0x40, 0x7D, 0xCB, 0x32, 0x3B, 0x1A, 0x58, 0x67, 0x73, 0x1D,
+    0x7B, 0x3B, 0x42, 0x7A, 0xAF, 0xC6, 0x37, 0x54, 0x7A, 0x0C, 0xC5, 0x36, 0x0C, 0x1D, 0x34, 0xE7,
+    0x8C, 0x63, 0x97, 0x1D, 0x57, 0xF8, 0x73, 0x8E, 0xDC, 0x78, 0xDD, 0x1C, 0x57, 0x23, 0xD9, 0x45,
+    0xBC, 0x90, 0x85, 0x3F, 0x25, 0xA5, 0xFB, 0x16, 0x4A, 0x69, 0x31, 0x06, 0xF9, 0x3A, 0x6C, 0x5D,
+    0xD1, 0xDF, 0xE3, 0x9A, 0x4D, 0x3D, 0x02, 0xFA, 0x33, 0xF5, 0x93, 0x2B, 0x4A, 0xFD, 0xB8, 0x0B,
+    0xC4, 0x1E, 0xF2, 0x8A, 0xA1, 0x85, 0x04, 0xEE, 0x41, 0xAF, 0xA4, 0x5B, 0x2B, 0x93, 0xBE, 0xCD,
+    0x51, 0x56, 0xD7, 0xEC, 0xC7, 0xCD, 0xAF, 0xAD, 0xB8, 0xB5, 0x17, 0x87, 0x63, 0x71, 0x9C, 0xDA,
+    0xAC, 0x4B, 0x2B, 0x3A, 0x5B, 0xC6, 0xA7, 0x89, 0xF6, 0x74, 0xF2, 0xBC, 0xF3, 0xD5, 0x93, 0x10,
+    0x4C, 0x98, 0xC9, 0xD9, 0x9E, 0x14, 0x38, 0xC1, 0xC2, 0x5D, 0x91, 0x4E, 0x5F, 0x5A, 0xB2, 0x25,
+    0xFB, 0xB7, 0x68, 0x2A, 0x5A, 0x67, 0x5D, 0x24, 0x2C, 0xED, 0xA2, 0x0C, 0x9A, 0xBE, 0xC6, 0xD5,
+    0x33, 0xF3, 0x7B, 0x41, 0x3F, 0x1D, 0x82, 0xFB, 0x3E, 0x84, 0x27, 0xE1, 0xA4, 0x03, 0x24, 0x67,
+    0xA6, 0x9F, 0xC9, 0x41, 0x71, 0xC3, 0xAA, 0x72, 0x19, 0x76, 0x4F, 0x7F, 0x15, 0xAA, 0xC9, 0x08,
+    0x1B, 0xA2, 0x2A, 0xAE, 0x84, 0x37, 0xF5, 0x95, 0x18, 0x46, 0x25, 0xF7, 0xA3, 0x90, 0xBE, 0xA7,
+    0xFC, 0x56, 0xE2, 0x76, 0xB4, 0xDD, 0x20, 0x76, 0x26, 0x57, 0x9B, 0xF0, 0x67, 0x92, 0x32, 0xF0,
+    0xDB, 0x88, 0x62, 0x4F, 0x6D, 0xD6, 0xC7, 0xEE, 0x26, 0x29, 0x67, 0x62, 0x98, 0xEE, 0x59, 0x80,
+    0x57, 0x1A, 0x9F, 0xA5, 0x45, 0xE8, 0x00, 0xC7, 0x1D, 0xE0, 0x1A, 0x2F, 0x8A, 0xA4, 0xF9, 0x88,
+    0x68, 0xFC, 0xA6, 0xAF, 0x02, 0x5E, 0x12, 0x7F, 0xC4, 0x16, 0x3C, 0x75, 0x5B, 0x23, 0x7D, 0xB7,
+    0xFE, 0xD7, 0x16, 0x70, 0x30, 0xE3, 0xC0, 0x2D, 0x6F, 0x57, 0x13, 0x97, 0xFB, 0x4C, 0x80, 0xE4,
+    0x17, 0x31, 0x9A, 0x91, 0x25, 0x0E, 0x64, 0x99, 0xB4, 0xB2, 0x34, 0x55, 0x77, 0x1B, 0xA1, 0x73,
+    0xF4, 0xE2, 0x5D, 0x1A, 0xE1, 0x3E, 0xF9, 0xFB, 0x01, 0x97, 0xF7, 0xF8, 0xCF, 0x12, 0x63, 0xE1,
+    0x90, 0xDA, 0xB3, 0xB3, 0xB6, 0xD3, 0xE5, 0xD5, 0xCF, 0x3F, 0xAD, 0x55, 0x3D, 0x6F, 0x1C, 0x45,
+    0x18, 0x7E, 0x66, 0xC6, 0xBE, 0x05, 0x6F, 0xB8, 0xA1, 0x4C, 0x64, 0xC7, 0x9B, 0x06, 0x29, 0x85,
+    0xED, 0x4D, 0x81, 0x22, 0x23, 0x9D, 0x7D, 0x03, 0x48, 0xD4, 0x2E, 0xD2, 0xD1, 0x50, 0x50, 0x20,
+    0x45, 0xC2, 0x2E, 0xAE, 0x30, 0xD2, 0x11, 0x4F, 0xE0, 0x07, 0xE0, 0x22, 0x49, 0x4B, 0x24, 0xA0,
+    0x4A, 0x81, 0x0B, 0x17, 0x16, 0xB2, 0xB2, 0x03, 0xBF, 0x60, 0x25, 0x6A, 0x94, 0x95, 0x48, 0x83,
+    0x91, 0xD0, 0x14, 0x5B, 0x5C, 0xCC, 0xE5, 0x86, 0x67, 0xF6, 0x36, 0xF6, 0x11, 0x89, 0x10, 0x05,
+    0x46, 0x3B, 0x77, 0x7B, 0x37, 0x33, 0xEF, 0xF3, 0xF1, 0xBE, 0x33, 0x03, 0x08, 0x00, 0x89, 0x01,
+    0x52, 0x7E, 0x77, 0xD9, 0x2F, 0xB3, 0xAF, 0xB0, 0xAF, 0xB3, 0x0F, 0xE6, 0x30, 0x7F, 0x7A, 0x67,
+    0xF1, 0xB7, 0x0A, 0x10, 0x25, 0x20, 0x1D, 0xA0, 0xC6, 0xD3, 0x0E, 0x7C, 0xC4, 0x7E, 0xAD, 0x9D,
+    0x38, 0x87, 0xB6, 0x09, 0x23, 0x2B, 0x78, 0x8C, 0x71, 0x84, 0x3D, 0xB3, 0x81, 0xBC, 0xD4, 0xD0,
+    0xA3, 0xD4, 0x26, 0x8F, 0x54, 0x29, 0x7F, 0xFD, 0xD1, 0xA3, 0xAE, 0x8F, 0x30, 0xDC, 0xE0, 0x40,
+    0xFA, 0x35, 0xF4, 0xED, 0x3F, 0x6D, 0x52, 0xF6, 0x4B, 0xE9, 0x35, 0x57, 0x34, 0x41, 0x2F, 0x00,
+    0x57, 0x81, 0x1D, 0xC0, 0x9C, 0xC5, 0x13, 0xC1, 0x4B, 0x3F, 0x50, 0x6E, 0x90, 0xD8, 0x41, 0x0A,
+    0xAF, 0xE1, 0x33, 0x51, 0xAD, 0xC9, 0x6A, 0x43, 0x95, 0xCD, 0x8C, 0x8E, 0x55, 0x4E, 0x79, 0xA2,
+    0x8E, 0x51, 0xA3, 0x30, 0x3D, 0xF4, 0xAB, 0x35, 0x64, 0x43, 0x6D, 0xD2, 0xAF, 0x38, 0xF0, 0xF3,
+    0x4F, 0x95, 0xF0, 0x75, 0x8D, 0xE3, 0xB5, 0x21, 0x36, 0x93, 0x3F, 0x90, 0x99, 0x60, 0x52, 0xD7,
+    0xE7, 0x0A, 0x62, 0x36, 0xAD, 0xCF, 0x9E, 0x45, 0xFD, 0x96, 0xC2, 0x28, 0x50, 0xDE, 0x9F, 0xE2,
+    0x26, 0xC1, 0xE5, 0x89, 0xF1, 0x97, 0x09, 0xBB, 0xA2, 0x9C, 0xD7, 0x89, 0xDB, 0x25, 0x6A, 0xAD,
+    0x23, 0xB3, 0x31, 0x92, 0x12, 0x39, 0x28, 0x74, 0x81, 0xAB, 0x60, 0xDE, 0x04, 0x96, 0x06, 0x5C,
+    0x1A, 0x43, 0x5E, 0xC1, 0x59, 0x13, 0xF7, 0x5B, 0x2B, 0xFA, 0x78, 0xDE, 0x0A, 0x47, 0x2B, 0xFC,
+    0x8B, 0xAC, 0xB8, 0x38, 0x8F, 0x85, 0x41, 0x24, 0x24, 0xF0, 0x92, 0x56, 0x28, 0x0B, 0x0D, 0x02,
+    0x3D, 0xD7, 0x0C, 0x8A, 0x11, 0x46, 0x2B, 0xA8, 0x96, 0x64, 0x49, 0x21, 0x3D, 0xEA, 0x48, 0xED,
+    0x91, 0x36, 0x75, 0x06, 0xFF, 0x9F, 0x0D, 0x54, 0x35, 0x55, 0x93, 0x6D, 0x36, 0x02, 0x16, 0xCC,
+    0xBF, 0xF8, 0x36, 0x44, 0xEA, 0x51, 0xB4, 0x62, 0xB6, 0xA0, 0x82, 0x3F, 0x23, 0x29, 0x27, 0x06,
+    0xF9, 0x03, 0x52, 0x10, 0x35, 0x4D, 0x3C, 0x4A, 0x1C, 0x8E, 0x53, 0x83, 0x5D, 0xEA, 0xD9, 0x5D,
+    0x06, 0x0E, 0x57, 0x69, 0xF5, 0x2A, 0x64, 0xD5, 0x47, 0x5A, 0xE6, 0x27, 0x85, 0xCD, 0x42, 0x80,
+    0x0E, 0x63, 0xC8, 0xB0, 0x3F, 0x5D, 0x7F, 0x73, 0x8C, 0xEF, 0x6E, 0x9C, 0x6B, 0x2E, 0x8C, 0x3A,
+    0xA1, 0xDD, 0xD5, 0x12, 0x0E, 0x7A, 0xA8, 0xD6, 0xF9, 0x48, 0xB7, 0xF9, 0xBD, 0xCD, 0x27, 0x48,
+    0x49, 0x58, 0xD8, 0x2B, 0x10, 0x8E, 0x69, 0x0E, 0x4C, 0xF7, 0x25, 0xFC, 0x6F, 0x24, 0xD8, 0x76,
+    0x2E, 0x60, 0xB3, 0x46, 0x66, 0xFF, 0x96, 0x81, 0x17, 0xB3, 0x91, 0x2E, 0x85, 0xE4, 0xB0, 0xD8,
+    0x9A, 0x9F, 0x5D, 0xB3, 0x0F, 0x79, 0xFA, 0x10, 0xCA, 0x27, 0x65, 0xE4, 0x22, 0x3C, 0xCB, 0xED,
+    0x10, 0x89, 0xED, 0x41, 0x54, 0x91, 0x0C, 0x89, 0xF5, 0x64, 0x89, 0x35, 0x26, 0x2D, 0x37, 0x91,
+    0x4D, 0x12, 0xA8, 0x26, 0xF6, 0x74, 0x62, 0xCE, 0xC3, 0x68, 0xAC, 0x2B, 0x47, 0x01, 0x62, 0x96,
+    0x0F, 0x51, 0x49, 0x08, 0xBE, 0x0B, 0x32, 0x52, 0xAE, 0xCB, 0x1D, 0x5C, 0x29, 0xBB, 0x02, 0x72,
+    0x92, 0xA1, 0x6A, 0x48, 0x51, 0xD4, 0xCD, 0x50, 0xCA, 0xD3, 0x82, 0xFA, 0xC6, 0x82, 0xC9, 0xCD,
+    0xA1, 0x2D, 0xE8, 0x08, 0x73, 0x5D, 0xC7, 0x57, 0xCD, 0x19, 0x5E, 0x54, 0xE8, 0x4F, 0xB0, 0x4A,
+    0x96, 0x54, 0x80, 0x5B, 0x71, 0x2F, 0xA5, 0x25, 0x07, 0x42, 0xAC, 0x88, 0x10, 0x98, 0x5F, 0x7E,
+    0x04, 0x88, 0x50, 0x3C, 0x4B, 0x75, 0xFA, 0x38, 0x2B, 0xD5, 0xC9, 0xA3, 0xF7, 0x8D, 0xD7, 0xEE,
+    0xE2, 0x12, 0x7E, 0x28, 0xBE, 0x74, 0x7A, 0xF2, 0x2D, 0xF1, 0x59, 0xBD, 0x6B, 0x20, 0x83, 0x27,
+    0xF3, 0x32, 0xFC, 0x1E, 0x4A, 0xCE, 0x1B, 0xA1, 0xA1, 0x2D, 0x98, 0x23, 0x3E, 0x55, 0xCB, 0x5D,
+    0x05, 0x8B, 0x93, 0x63, 0xEC, 0xA4, 0xA0, 0x89, 0x6F, 0x08, 0x9F, 0xDC, 0xAB, 0x15, 0x39, 0x13,
+    0x71, 0x98, 0x9A, 0x4D, 0x51, 0x69, 0xC3, 0xBC, 0x6D, 0x2A, 0x9F, 0xD9, 0x71, 0xCA, 0xA0, 0x46,
+    0x5A, 0x06, 0x88, 0x86, 0x5C, 0xAF, 0xB2, 0x91, 0x66, 0xA5, 0x93, 0x73, 0x8D, 0x5E, 0xD4, 0xC3,
+    0xA8, 0xFD, 0x11, 0xBA, 0x0F, 0x5C, 0x42, 0x17, 0x28, 0xBF, 0xCC, 0xF0, 0xD9, 0xB6, 0xA1, 0x20,
+    0x1D, 0x5C, 0xE2, 0x0E, 0x15, 0x7D, 0xAE, 0x53, 0x3B, 0x54, 0x55, 0x5F, 0x8C, 0xB4, 0x7B, 0x38,
+    0x6B, 0xA0, 0x83, 0xAA, 0xC0, 0x9C, 0x80, 0x24, 0x3F, 0x99, 0xF2, 0xFA, 0x14, 0x7B, 0x15, 0x7D,
+    0xF1, 0x58, 0x06, 0x77, 0x63, 0x2F, 0xCE, 0x19, 0xCF, 0x2C, 0xE9, 0x58, 0xFE, 0xCC, 0x0C, 0x9D,
+    0x1A, 0xB6, 0x1B, 0xE0, 0x0B, 0xCB, 0xCC, 0x91, 0xE1, 0xAB, 0x08, 0x9B, 0x17, 0xE6, 0x1B, 0xA3,
+    0x8D, 0xF8, 0x47, 0x61, 0x00, 0xCB, 0x3B, 0xE1, 0xD7, 0xDB, 0x38, 0x3F, 0x4B, 0x49, 0x3C, 0x30,
+    0x3B, 0xE4, 0xB1, 0x1F, 0xB3, 0x18, 0x0F, 0x8C, 0xE6, 0xE4, 0xEB, 0xF3, 0x9D, 0xB2, 0xD1, 0x99,
+    0x4C, 0x37, 0x73, 0xEA, 0x5F, 0x7F, 0xB7, 0x70, 0x45, 0x78, 0x9A, 0xB2, 0x9E, 0x16, 0xC3, 0xE3,
+    0x76, 0x71, 0x19, 0xAF, 0x88, 0x9D, 0x99, 0xDD, 0x82, 0x77, 0xB6, 0xA4, 0x8D, 0x7F, 0x66, 0x25,
+    0x16, 0x69, 0xB6, 0xBB, 0xB4, 0x2D, 0xC3, 0x28, 0x09, 0x6D, 0xF5, 0xC7, 0x0B, 0x65, 0x99, 0x07,
+    0xD3, 0xB5, 0xAB, 0x6D, 0x49, 0x7B, 0xE2, 0xFB, 0x06, 0x7C, 0xA3, 0xBD, 0x36, 0x3E, 0xC7, 0x14,
+    0x5D, 0xC7, 0x35, 0xDB, 0x55, 0x84, 0x8E, 0x5D, 0x6E, 0x6D, 0x7B, 0x62, 0x97, 0x39, 0x8B, 0xE7,
+    0x0C, 0x7F, 0x81, 0xE5, 0x01, 0xF5, 0x01, 0xE6, 0x9A, 0x5A, 0x2E, 0x6C, 0xF7, 0x06, 0x35, 0xF2,
+    0x46, 0x4A, 0x6A, 0x74, 0x98, 0x06, 0xDF, 0xF9, 0xD0, 0x15, 0x13, 0x11, 0xAA, 0x29, 0x52, 0x1E,
+    0x9C, 0x78, 0xC2, 0xC0, 0xA6, 0x01, 0x12, 0x51, 0x6D, 0xA0, 0xDB, 0x71, 0x38, 0xE2, 0xE4, 0xF4,
+    0xA8, 0xC0, 0x9D, 0xC5, 0x71, 0x84, 0x61, 0x91, 0x8B, 0x82, 0xBB, 0x46, 0x4C, 0x51, 0xF0, 0x1A,
+    0xD0, 0x1C, 0xA8, 0x79, 0xA5, 0xEE, 0xC6, 0xEB, 0xE8, 0x00, 0xE2, 0x29, 0x04, 0x0B, 0xA0, 0x27,
+    0xEE, 0xF9, 0x3C, 0xD8, 0xBD, 0x51, 0x9C, 0xF2, 0x71, 0x3C, 0xEA, 0x75, 0xEB, 0xAD, 0x7A, 0x8F,
+    0xC1, 0x0F, 0xA6, 0x9A, 0x67, 0x5A, 0x3E, 0x6E, 0x24, 0xDF, 0x32, 0x4D, 0xC0, 0x6E, 0xAB, 0x38,
+    0xF0, 0x3D, 0x90, 0xF2, 0xE2, 0x68, 0x2A, 0x38, 0x77, 0x6F, 0x75, 0x02, 0x77, 0x4D, 0x1D, 0xF5,
+    0x6E, 0x3F, 0x3B, 0x4D, 0xEC, 0x96, 0xFC, 0xA5, 0xB9, 0x90, 0x5E, 0xD6, 0xEF, 0x57, 0x6A, 0x7F,
+    0x01, 0xAD, 0x55, 0x31, 0x6B, 0x1C, 0x47, 0x14, 0xFE, 0x76, 0x46, 0xD2, 0x9E, 0xB4, 0x3E, 0x8D,
+    0x30, 0x16, 0x58, 0xC6, 0xD2, 0x29, 0xE1, 0x02, 0xB2, 0x11, 0x3A, 0x11, 0x54, 0xA8, 0xD8, 0xD3,
+    0x4E, 0xEC, 0x22, 0x84, 0x34, 0x97, 0x04, 0xA7, 0xBE, 0xC2, 0x4D, 0x42, 0x0A, 0x17, 0x2A, 0x54,
+    0x9C, 0xD1, 0x04, 0x42, 0x9A, 0xA4, 0x08, 0x29, 0x52, 0x8B, 0x90, 0x22, 0xA8, 0x52, 0x40, 0xC5,
+    0x41, 0x4E, 0xD1, 0x10, 0xB5, 0x81, 0x6C, 0xE2, 0x3F, 0x30, 0x06, 0x43, 0x8A, 0x34, 0x5B, 0x1C,
+    0xE1, 0x82, 0xEF, 0x6E, 0xF2, 0xCD, 0xDD, 0x49, 0x4E, 0xB0, 0x30, 0x36, 0x64, 0xC5, 0x83, 0x9D,
+    0xD5, 0x7B, 0xF3, 0xBD, 0xF7, 0xBE, 0xEF, 0xBD, 0xAB, 0x79, 0x7F, 0xE6, 0x7D, 0x0F, 0x2B, 0x80,
+    0xC8, 0x81, 0x14, 0x90, 0x16, 0x68, 0x03, 0x4A, 0x03, 0x05, 0x50, 0xE1, 0x07, 0x07, 0xD4, 0x81,
+    0x98, 0xDF, 0xFB, 0x40, 0x64, 0xE8, 0xC9, 0x8F, 0x74, 0xE6, 0x73, 0x04, 0x27, 0xF2, 0xDA, 0x50,
+    0x9A, 0x58, 0x2B, 0x28, 0x2C, 0x63, 0x03, 0x99, 0xCB, 0xDC, 0x2C, 0x60, 0x2B, 0x3A, 0x38, 0xC8,
+    0x19, 0xDE, 0xC1, 0x90, 0x03, 0x4C, 0x9E, 0xDA, 0xAB, 0x02, 0x06, 0x90, 0x32, 0x7E, 0xB0, 0xF3,
+    0xD7, 0x44, 0x2E, 0xBC, 0x93, 0x06, 0xBB, 0x44, 0xA2, 0xEB, 0x32, 0x84, 0x23, 0x9A, 0x1C, 0x5E,
+    0x72, 0x27, 0x63, 0xE7, 0x86, 0x46, 0xF8, 0xFE, 0xE8, 0xCE, 0xDA, 0xF3, 0x77, 0x22, 0x81, 0x34,
+    0x22, 0x4F, 0xBC, 0xD9, 0x16, 0xA7, 0xDF, 0xFA, 0xBE, 0x34, 0x51, 0x8E, 0x1E, 0xAF, 0x53, 0x3D,
+    0xFE, 0xF3, 0xC0, 0x60, 0xF6, 0x03, 0x60, 0xB3, 0x7B, 0x9E, 0x75, 0xA4, 0x23, 0x5D, 0x83, 0x32,
+    0x3D, 0xB4, 0x64, 0x2E, 0x8A, 0x0A, 0x5F, 0x3B, 0xA8, 0x4B, 0x17, 0x15, 0x0A, 0x89, 0x69, 0xA1,
+    0xCE, 0x54, 0x8A, 0xC4, 0x24, 0x26, 0xD3, 0x27, 0xF0, 0xBE, 0x90, 0xDE, 0x6B, 0xE1, 0x9F, 0x8C,
+    0x83, 0xF7, 0x36, 0xE5, 0x1B, 0xA6, 0x94, 0x8E, 0x0F, 0xDB, 0xC2, 0x3A, 0x25, 0xF5, 0xF6, 0xCD,
+    0x28, 0x3F, 0x4A, 0xA4, 0x4D, 0x95, 0x70, 0x99, 0x37, 0x7E, 0x10, 0x0D, 0x8E, 0xC6, 0x0E, 0xCA,
+    0x1B, 0xDC, 0x3B, 0xC7, 0x45, 0x62, 0xA5, 0xCB, 0x50, 0xD1, 0x5D, 0x74, 0x62, 0xBE, 0x32, 0x07,
+    0x1D, 0x72, 0xB0, 0xC2, 0x31, 0x07, 0xBD, 0x87, 0x54, 0x38, 0xE1, 0x54, 0x5E, 0xD3, 0x19, 0x6B,
+    0xF5, 0x3E, 0xC7, 0xE9, 0xDF, 0x93, 0xC8, 0x46, 0xE2, 0xC7, 0x1C, 0xCD, 0xE3, 0x68, 0x5B, 0xDA,
+    0x7C, 0x3E, 0xC6, 0xEE, 0xBA, 0xB0, 0x85, 0x92, 0xB6, 0xAD, 0x3C, 0x41, 0xF5, 0xFE, 0x27, 0x81,
+    0xCA, 0x06, 0xCA, 0x31, 0x5B, 0xC4, 0x52, 0x97, 0x2E, 0x50, 0xA7, 0xF9, 0xD7, 0xC1, 0xCE, 0xA8,
+    0x3E, 0x9D, 0xD8, 0x16, 0x76, 0x44, 0x81, 0xAE, 0x32, 0xB1, 0x4D, 0xB1, 0x11, 0xF1, 0x35, 0x31,
+    0xD2, 0x6E, 0x90, 0xEC, 0x81, 0xE8, 0xB2, 0x54, 0xAB, 0xFC, 0x00, 0x89, 0xFF, 0x6A, 0x1C, 0x6C,
+    0x16, 0xE4, 0x5B, 0x56, 0xF5, 0x31, 0xA3, 0xC7, 0x67, 0x97, 0x48, 0x93, 0x96, 0xE1, 0x1E, 0xC4,
+    0x77, 0xEC, 0xBA, 0x42, 0x91, 0x26, 0xC6, 0x0F, 0xA5, 0xEF, 0xC6, 0x7F, 0x91, 0x8C, 0x1B, 0x74,
+    0xF8, 0x8C, 0x69, 0xAC, 0x8E, 0x05, 0xF0, 0xEC, 0x09, 0xF0, 0x45, 0xD4, 0xBD, 0x1C, 0x3E, 0x7E,
+    0x01, 0xFC, 0x8C, 0x01, 0xA9, 0xBB, 0x60, 0xEE, 0x85, 0xF0, 0x42, 0xCF, 0x52, 0x4B, 0x29, 0xD6,
+    0x9E, 0xE9, 0x33, 0x3C, 0x44, 0xEB, 0x85, 0xDA, 0x03, 0xD5, 0xA1, 0xEB, 0x24, 0x21, 0x0F, 0xE8,
+    0x81, 0xEB, 0xD0, 0xF6, 0x0D, 0x06, 0x05, 0xF8, 0x40, 0x76, 0xE8, 0x7B, 0xE6, 0xBB, 0x17, 0xF8,
+    0x51, 0x9E, 0x44, 0x2E, 0xD1, 0x8D, 0xE9, 0x49, 0x35, 0xD2, 0xAC, 0xC3, 0x29, 0x6C, 0x49, 0x43,
+    0xC6, 0x13, 0x1C, 0x91, 0x72, 0x14, 0x0C, 0xF5, 0x46, 0xF9, 0xFC, 0x9C, 0xF4, 0xC0, 0xF2, 0x0E,
+    0xA5, 0x7F, 0x39, 0xCB, 0xED, 0x4B, 0x58, 0x1E, 0xF0, 0x66, 0x22, 0x54, 0x19, 0xDC, 0xC2, 0x73,
+    0x34, 0xCB, 0xFF, 0xD0, 0xDC, 0x62, 0x12, 0x2C, 0x11, 0x16, 0x91, 0x9B, 0x88, 0x30, 0x24, 0x1A,
+    0x84, 0x7E, 0xE5, 0xFA, 0xF8, 0x03, 0x27, 0x07, 0x6D, 0x0E, 0xA1, 0xFC, 0x99, 0x1E, 0x1B, 0x09,
+    0x07, 0x96, 0x39, 0x52, 0xD0, 0x3D, 0x95, 0xA7, 0xD2, 0xF9, 0xBB, 0x4E, 0xBD, 0x3B, 0xAC, 0xA0,
+    0xFE, 0xB0, 0xD3, 0xC3, 0xD3, 0xC7, 0x4F, 0xAD, 0xF4, 0xF1, 0x00, 0xAA, 0x5B, 0x29, 0x90, 0x51,
+    0xF1, 0x9C, 0xA8, 0x30, 0x53, 0xEB, 0xA4, 0xD0, 0xA2, 0x3C, 0x3B, 0x12, 0x1F, 0xA6, 0x53, 0xC8,
+    0x5F, 0x21, 0x1E, 0x59, 0x5B, 0x14, 0xBD, 0xE3, 0xD4, 0xA7, 0x24, 0x49, 0x0E, 0x3D, 0x06, 0x99,
+    0xDE, 0x49, 0x48, 0x3C, 0xF3, 0xD9, 0x01, 0x7E, 0x33, 0x93, 0x11, 0xC1, 0x46, 0x8A, 0x56, 0x9D,
+    0xA8, 0x32, 0xAF, 0x29, 0x5D, 0x61, 0x87, 0xFB, 0x50, 0x05, 0x92, 0x9C, 0xBD, 0xE1, 0xB0, 0xA1,
+    0xA6, 0x91, 0x01, 0xA7, 0x13, 0x82, 0x38, 0xD3, 0x3F, 0x02, 0xCD, 0xEA, 0xE4, 0xB8, 0x8E, 0x22,
+    0xD6, 0xBB, 0x70, 0x29, 0xD2, 0x65, 0x28, 0x05, 0xF1, 0xA7, 0xC6, 0x3E, 0xC3, 0x1C, 0x24, 0x3D,
+    0x7B, 0xA3, 0x16, 0x9D, 0x80, 0x29, 0x8B, 0xDE, 0x24, 0xA2, 0xB9, 0x86, 0xA2, 0x15, 0x15, 0xBD,
+    0x0B, 0xCA, 0x5F, 0x29, 0x81, 0x20, 0x96, 0x07, 0xB4, 0x2D, 0xDA, 0xD4, 0xBF, 0x74, 0x13, 0x76,
+    0x50, 0x60, 0x68, 0xFA, 0x5E, 0xF0, 0xDB, 0xA7, 0xFD, 0x44, 0x1B, 0xB2, 0xD7, 0xA4, 0x4B, 0x04,
+    0xCA, 0xFA, 0x63, 0x8B, 0x09, 0x9C, 0xF8, 0xC3, 0x03, 0x8A, 0x37, 0xF0, 0xE9, 0xE9, 0x75, 0x93,
+    0xEB, 0x86, 0x62, 0x05, 0xCE, 0xA7, 0x60, 0x7F, 0x80, 0x8F, 0x4F, 0x82, 0x90, 0xB9, 0x1F, 0x2B,
+    0x61, 0x1E, 0xA8, 0x4A, 0xF6, 0xB7, 0xE6, 0x6D, 0xE6, 0xD9, 0xBF, 0x38, 0xEC, 0xE1, 0x40, 0xE7,
+    0x77, 0xCF, 0xF0, 0x79, 0x9D, 0x0B, 0xDB, 0x07, 0x8B, 0x1F, 0x86, 0x4D, 0x4D, 0x0B, 0x05, 0x4B,
+    0x5A, 0xCC, 0x79, 0x48, 0x68, 0xAC, 0x68, 0x64, 0x15, 0x46, 0xD6, 0x86, 0x87, 0xD4, 0xE0, 0x68,
+    0x57, 0xF5, 0x47, 0x3D, 0x25, 0x80, 0x38, 0x78, 0x39, 0x74, 0xBD, 0x40, 0x06, 0x9B, 0xE3, 0xB5,
+    0x8A, 0xE6, 0xFF, 0xD3, 0x82, 0xD5, 0x12, 0xCA, 0x07, 0xA1, 0xAE, 0x08, 0x2F, 0x97, 0x04, 0x12,
+    0xD2, 0xCE, 0x2D, 0x6E, 0x99, 0xFB, 0x36, 0x7F, 0x0E, 0xB8, 0xD2, 0x2D, 0x15, 0x7E, 0xCC, 0x81,
+    0xA6, 0x77, 0x93, 0xB3, 0x1E, 0xCB, 0xBB, 0x46, 0x4B, 0xA8, 0x7C, 0x8D, 0x72, 0x5B, 0x2E, 0xFD,
+    0xF2, 0x4D, 0x25, 0x5C, 0x9B, 0x0D, 0x17, 0xC7, 0xA9, 0x86, 0xFD, 0xB8, 0x80, 0xCD, 0xF2, 0x4E,
+    0x5B, 0xE5, 0x4B, 0xF5, 0xD6, 0xEC, 0x9C, 0xBA, 0x7B, 0xF6, 0x7B, 0x71, 0xFF, 0x9D, 0xB5, 0x85,
+    0xB9, 0xD2, 0xD5, 0x6A, 0x5B, 0xE8, 0x12, 0x97, 0x43, 0x1A, 0x48, 0xD9, 0xAA, 0x2A, 0x9B, 0xA0,
+    0x19, 0x69, 0x9E, 0x56, 0xB0, 0x77, 0x4D, 0x70, 0x2F, 0xB6, 0xA4, 0x93, 0xAE, 0xA3, 0x3E, 0x2D,
+    0x6E, 0xE1, 0x21, 0xCF, 0xE8, 0x08, 0xFE, 0x6A, 0xB4, 0xAE, 0x10, 0xB9, 0xBE, 0x8A, 0xEC, 0xFB,
+    0xC5, 0x16, 0x93, 0xDA, 0x9A, 0x7A, 0xF3, 0xFE, 0x6B, 0x77, 0x58, 0xDB, 0xF1, 0x12, 0x9E, 0xDC,
+    0xAA, 0xA2, 0xF4, 0xD1, 0x02, 0x16, 0xF7, 0xD9, 0x8E, 0xB5, 0xB4, 0x33, 0x37, 0xF3, 0xF6, 0xD9,
+    0xA3, 0xC7, 0xDD, 0x11, 0x54, 0xA4, 0xFB, 0x95, 0x3B, 0x45, 0x9D, 0xBB, 0x6B, 0x2A, 0x6A, 0x5C,
+    0x6F, 0x63, 0x7A, 0x4E, 0xB2, 0x0E, 0xCC, 0x97, 0xD7, 0xD3, 0x85, 0xEC, 0x8F, 0xD9, 0x86, 0x69,
+    0xAE, 0x1E, 0x62, 0x34, 0xBC, 0x0A, 0x2B, 0x76, 0xB3, 0x7A, 0x5E, 0x4B, 0x34, 0xEA, 0x03, 0x48,
+    0xF9, 0x79, 0x79, 0xB7, 0x0F, 0x2B, 0xDE, 0xAE, 0x5E, 0xD5, 0x8D, 0xCF, 0xCB, 0x99, 0xC3, 0xED,
+    0xAF, 0xA7, 0x1B, 0x5F, 0xF4, 0x6F, 0xBC, 0xFF, 0xFA, 0x7B, 0x0D, 0xB6, 0xDF, 0xE4, 0x5F, 0x4E,
+    0xBC, 0xAA, 0xA5, 0xD5, 0x71, 0x8B, 0xFF, 0x01, 0x95, 0x55, 0x3D, 0x8C, 0x1B, 0x45, 0x14, 0xFE,
+    0x76, 0x46, 0xC9, 0xE4, 0x6E, 0x89, 0xE7, 0x8A, 0x8B, 0x04, 0xC2, 0x3F, 0x29, 0x53, 0xD8, 0xB7,
+    0x91, 0x70, 0x61, 0x89, 0xB5, 0x77, 0x14, 0x24, 0x52, 0xA4, 0xC8, 0x15, 0xA4, 0xA2, 0x00, 0x21,
+    0x0A, 0xBA, 0x4B, 0xE1, 0xE2, 0x24, 0x8C, 0xBC, 0xE1, 0x0A, 0xCA, 0xA4, 0x20, 0xBD, 0x8B, 0x54,
+    0x01, 0x81, 0x0B, 0x0B, 0xB9, 0x38, 0x65, 0x27, 0x4A, 0x91, 0x82, 0x22, 0xDB, 0x44, 0x48, 0x34,
+    0x19, 0x02, 0x34, 0x17, 0x29, 0x4C, 0xC8, 0x22, 0x39, 0x8A, 0xED, 0xE1, 0xCD, 0xDA, 0x39, 0x45,
+    0x42, 0x48, 0xB0, 0xAB, 0x5D, 0xAF, 0x77, 0xDF, 0xBC, 0xF7, 0xBD, 0xF7, 0xBE, 0xEF, 0x0D, 0x00,
+    0xA6, 0x02, 0x1D, 0xE4, 0xF4, 0x7B, 0xE1, 0x20, 0xB7, 0xC5, 0xE1, 0xF0, 0xE7, 0x37, 0x54, 0x8A,
+    0x13, 0x2A, 0x9B, 0xC3, 0x1F, 0x91, 0x0B, 0x76, 0xD1, 0xAC, 0x76, 0x3A, 0xFD, 0xF6, 0x78, 0xBC,
+    0xBB, 0x7B, 0xE6, 0xE2, 0x9C, 0xEB, 0x0E, 0xBD, 0x0F, 0x70, 0x0A, 0x5B, 0xB5, 0x73, 0xEF, 0xDC,
+    0xFA, 0xC4, 0x32, 0x7A, 0xDC, 0xF6, 0xB6, 0xDE, 0x0B, 0xD7, 0x08, 0xB2, 0xB4, 0x1E, 0xDE, 0x35,
+    0x83, 0x06, 0x86, 0xA6, 0x46, 0xAF, 0xBB, 0xA5, 0x23, 0xB0, 0xD9, 0x86, 0x3C, 0x5D, 0xDD, 0xE0,
+    0x05, 0x3D, 0x87, 0xF9, 0xD9, 0xB8, 0x3D, 0x3E, 0xDB, 0xD0, 0xF4, 0xBC, 0x4D, 0xCB, 0xFD, 0x71,
+    0x0A, 0x1B, 0x38, 0x9B, 0x42, 0x01, 0x17, 0x80, 0x4F, 0x4F, 0xDE, 0xBE, 0x05, 0x76, 0xFB, 0x56,
+    0xA0, 0x70, 0x6E, 0x0B, 0xD8, 0x5A, 0xB9, 0xC0, 0xE9, 0xD0, 0x39, 0x67, 0x28, 0x52, 0xBA, 0xFA,
+    0x7F, 0x02, 0x10, 0x0A, 0xCC, 0xAC, 0x23, 0xB8, 0x39, 0x7F, 0xF8, 0x01, 0x4F, 0xFD, 0xBB, 0x10,
+    0x90, 0xCE, 0x54, 0xAE, 0xA8, 0x2A, 0xD0, 0x04, 0x7A, 0xB7, 0xD5, 0xD0, 0xA5, 0x99, 0x53, 0x78,
+    0xF3, 0x14, 0x3A, 0xD5, 0xFF, 0x61, 0x8F, 0x33, 0x91, 0x73, 0xE8, 0x03, 0x63, 0xC0, 0x20, 0x30,
+    0xB4, 0xCA, 0xF0, 0xBF, 0xF6, 0xB9, 0x6E, 0x0A, 0x55, 0x0D, 0xD1, 0x94, 0xE8, 0x54, 0x98, 0x6D,
+    0x89, 0x15, 0x22, 0x5A, 0x7D, 0xDE, 0xDB, 0xBD, 0x76, 0x04, 0x6E, 0xC9, 0x28, 0x8A, 0x86, 0x0F,
+    0x94, 0x42, 0x2A, 0x48, 0xA0, 0x01, 0xEC, 0x94, 0x95, 0x89, 0x81, 0x43, 0x5F, 0x90, 0x19, 0xA2,
+    0x8B, 0xBA, 0x85, 0x4E, 0x1D, 0x9B, 0xF4, 0x99, 0x1F, 0x8D, 0x08, 0x1C, 0x6C, 0xF9, 0x5D, 0xE6,
+    0x7B, 0x07, 0xCE, 0xE9, 0xCC, 0xE5, 0xC2, 0xAD, 0xF3, 0xCE, 0x2C, 0x35, 0x46, 0x07, 0x2F, 0xE0,
+    0xDD, 0x81, 0xFA, 0x11, 0x50, 0x55, 0x39, 0xA1, 0xE5, 0xBE, 0x3A, 0x7B, 0x74, 0x45, 0x54, 0xDA,
+    0x0C, 0x5F, 0xBF, 0x3D, 0xA7, 0x8A, 0xE5, 0x99, 0x9B, 0x07, 0xD9, 0x52, 0x95, 0x4B, 0x07, 0x98,
+    0xA2, 0x80, 0x0D, 0x2C, 0x33, 0x3C, 0xE7, 0x5A, 0xE8, 0x30, 0x95, 0xA9, 0x54, 0x0D, 0x24, 0x74,
+    0x62, 0xF4, 0x71, 0x78, 0xA0, 0x7B, 0xD1, 0x31, 0x78, 0xA1, 0x3D, 0xCE, 0xC2, 0xB7, 0x95, 0x20,
+    0x4F, 0xC1, 0x73, 0x8F, 0x7E, 0xE0, 0x4B, 0x2E, 0x53, 0xC2, 0x1F, 0x58, 0x48, 0xED, 0x17, 0x96,
+    0xC7, 0x2A, 0xA5, 0x81, 0x37, 0xA4, 0x35, 0x04, 0x9F, 0x59, 0xBF, 0x82, 0x16, 0x93, 0x9F, 0x30,
+    0x5D, 0x27, 0xDE, 0xF3, 0x29, 0x37, 0x66, 0x48, 0x0C, 0x7A, 0x84, 0xE9, 0xC4, 0x95, 0xB2, 0xF4,
+    0xE0, 0x68, 0x23, 0xD0, 0x54, 0xC0, 0x11, 0xF5, 0xA2, 0x4D, 0xC5, 0xAA, 0xC2, 0x99, 0x4D, 0x8C,
+    0x2B, 0x5C, 0xC5, 0xEC, 0x9A, 0xAE, 0xC0, 0x8C, 0xC4, 0x85, 0xA2, 0xCF, 0xDC, 0xEC, 0x10, 0xAE,
+    0xD8, 0x3E, 0x86, 0x68, 0x88, 0x0C, 0x6D, 0x8C, 0xC8, 0xBC, 0x8D, 0x4D, 0xBA, 0xF3, 0x9B, 0x1F,
+    0x01, 0x44, 0x93, 0x74, 0x8C, 0xBC, 0xD9, 0xC1, 0x55, 0x71, 0x1A, 0x31, 0xBB, 0x8F, 0x8A, 0x78,
+    0xAC, 0x85, 0xB3, 0x86, 0x39, 0xB3, 0x26, 0xB6, 0xBB, 0xE7, 0xDC, 0x0C, 0x75, 0xE2, 0x41, 0x5E,
+    0xD6, 0x99, 0xFF, 0x91, 0x23, 0x73, 0x94, 0xCF, 0x18, 0x36, 0x24, 0xA0, 0x63, 0x6E, 0x2A, 0xE8,
+    0x06, 0xB9, 0xD0, 0x31, 0x88, 0xF5, 0xEB, 0x70, 0x64, 0x4B, 0xF8, 0x70, 0xF5, 0xB8, 0xBD, 0x66,
+    0x80, 0xF0, 0xBD, 0x1C, 0x31, 0x15, 0xE3, 0x57, 0x83, 0x70, 0x8F, 0x6A, 0x60, 0xA9, 0xE9, 0x64,
+    0x46, 0x25, 0x48, 0x48, 0x0E, 0x8E, 0x72, 0xCF, 0x14, 0xE2, 0x21, 0x55, 0x8B, 0xDC, 0x7F, 0xB9,
+    0x40, 0x97, 0x7B, 0x71, 0xDD, 0xF0, 0x8B, 0xE9, 0xBA, 0x51, 0xFA, 0x99, 0xE2, 0x33, 0x9E, 0x0B,
+    0x23, 0x91, 0xA8, 0x7D, 0x3E, 0x67, 0x79, 0x64, 0x25, 0x7B, 0x92, 0x0E, 0x1A, 0x5D, 0x66, 0x9E,
+    0x59, 0x79, 0xF9, 0x92, 0x8E, 0x8B, 0x5E, 0xF0, 0xF2, 0x5A, 0x21, 0xE7, 0x52, 0x27, 0x3A, 0x09,
+    0xE6, 0x8C, 0xDC, 0x6F, 0x33, 0x08, 0x96, 0x82, 0x68, 0x71, 0x52, 0xAD, 0xF1, 0x54, 0xA8, 0x76,
+    0x04, 0x78, 0x5C, 0x43, 0x4D, 0x82, 0xDF, 0x57, 0x78, 0xAE, 0x11, 0x11, 0x2E, 0xC2, 0x34, 0x2B,
+    0x7B, 0xD3, 0xF3, 0xC4, 0xE0, 0x4B, 0xE0, 0x85, 0xD7, 0x11, 0x53, 0x36, 0xC8, 0x3B, 0xDE, 0xBC,
+    0x13, 0xA2, 0xC6, 0x75, 0x08, 0xC3, 0x75, 0x1F, 0xA6, 0x89, 0xBE, 0x44, 0x53, 0x1C, 0x7D, 0xCF,
+    0xA8, 0x92, 0x3E, 0xE9, 0xF3, 0x25, 0xB9, 0xCB, 0x83, 0x7A, 0xC8, 0xAD, 0xF7, 0x82, 0xFA, 0x18,
+    0xFC, 0x47, 0x60, 0x32, 0x41, 0x5D, 0x28, 0xAE, 0xF7, 0x31, 0x15, 0x69, 0x03, 0x03, 0x5E, 0xD2,
+    0x75, 0xDE, 0x50, 0xE2, 0x9E, 0xC1, 0x17, 0xA5, 0xD2, 0x16, 0x5E, 0x00, 0xAF, 0x34, 0x10, 0xBA,
+    0x54, 0x22, 0xAF, 0x60, 0x54, 0x83, 0xD9, 0xF9, 0x50, 0x27, 0x4E, 0x25, 0x2F, 0xD6, 0xBE, 0xE9,
+    0x53, 0xCC, 0x95, 0xD9, 0x10, 0xAA, 0xDD, 0x14, 0xA9, 0x9B, 0xF1, 0x9B, 0x93, 0x2A, 0xC6, 0x63,
+    0x7E, 0xEF, 0xE1, 0x9D, 0x86, 0xB3, 0xD9, 0xE2, 0xBF, 0x2B, 0x8A, 0xCA, 0xFE, 0xFB, 0x00, 0x55,
+    0x9E, 0x32, 0xCA, 0x87, 0x92, 0x13, 0xCA, 0x12, 0x99, 0x50, 0x09, 0x72, 0x96, 0x37, 0x31, 0xE5,
+    0x14, 0xD6, 0x11, 0x50, 0x4A, 0x3E, 0x66, 0x8A, 0xCE, 0xFF, 0x32, 0x0C, 0x7A, 0xA2, 0xD8, 0x81,
+    0xB8, 0x3B, 0xA7, 0x60, 0xC5, 0x1D, 0xBA, 0x45, 0xD1, 0x65, 0xD2, 0xDC, 0x83, 0x07, 0x54, 0xFC,
+    0x97, 0x4F, 0x48, 0x9B, 0x0D, 0x0A, 0x4A, 0x1A, 0xD4, 0x1E, 0xA3, 0x2D, 0x81, 0xFA, 0x1B, 0xFD,
+    0x0F, 0x96, 0x24, 0x67, 0xB6, 0x58, 0x0E, 0x15, 0x5B, 0x24, 0xD7, 0x2D, 0x5B, 0x36, 0x7E, 0x21,
+    0x86, 0x9C, 0xA1, 0x30, 0x6A, 0x4B, 0x96, 0x41, 0x4C, 0xB0, 0xE7, 0x15, 0xE1, 0x07, 0x8C, 0x46,
+    0x65, 0xF3, 0x7D, 0x4B, 0x55, 0xC9, 0x7E, 0x7B, 0xC5, 0x32, 0x66, 0x82, 0x11, 0x89, 0x34, 0x8D,
+    0xB1, 0x08, 0x8C, 0xB4, 0xA1, 0xCA, 0x74, 0x1C, 0x7E, 0x17, 0xD8, 0x41, 0x11, 0x1E, 0xDC, 0xD7,
+    0xDD, 0x6E, 0x84, 0xE7, 0xF9, 0x4C, 0x3C, 0x15, 0x79, 0x62, 0x13, 0x38, 0xCC, 0x85, 0x0D, 0xFD,
+    0x48, 0xC7, 0x2E, 0xF1, 0x9E, 0x60, 0x12, 0x55, 0xDE, 0x5A, 0xFB, 0xC1, 0xAE, 0x54, 0xB2, 0xF4,
+    0x63, 0xD7, 0x7E, 0xC4, 0xD3, 0xD7, 0xFD, 0xFC, 0x69, 0xFE, 0xE9, 0xA7, 0x2E, 0x34, 0xCB, 0x0B,
+    0x4F, 0x71, 0x71, 0x3D, 0xC5, 0x0F, 0xA4, 0xF9, 0x41, 0xC9, 0xF0, 0x88, 0xB4, 0x4D, 0x4C, 0x1E,
+    0xDA, 0x92, 0xE0, 0xCF, 0xE6, 0x68, 0x48, 0xCB, 0x4D, 0xA6, 0x4A, 0x7E, 0x4B, 0xA7, 0xC5, 0x11,
+    0xCD, 0x98, 0x09, 0x6C, 0x8C, 0x7D, 0x89, 0x96, 0x50, 0x92, 0xE6, 0x4D, 0x6A, 0x19, 0xF1, 0xC4,
+    0xB6, 0x30, 0x95, 0xE4, 0x5E, 0x7B, 0x1D, 0xD3, 0xF0, 0x9A, 0x85, 0x26, 0xCC, 0xDF, 0x4D, 0x3F,
+    0xC7, 0x23, 0xFE, 0xAD, 0x88, 0x9B, 0x26, 0x7E, 0xF6, 0x93, 0x7A, 0xFC, 0xA8, 0x29, 0x2E, 0x59,
+    0xDB, 0x8A, 0xBE, 0x4A, 0xED, 0xA0, 0x45, 0xED, 0xB6, 0x3B, 0x9E, 0x42, 0xDB, 0x74, 0xEE, 0x53,
+    0xA3, 0x27, 0xD4, 0x69, 0x4B, 0x84, 0xB6, 0x98, 0x52, 0x56, 0x05, 0xCF, 0x03, 0xCB, 0x73, 0x66,
+    0x05, 0x6D, 0x10, 0x7E, 0xE6, 0x49, 0x7F, 0x29, 0xA9, 0x23, 0x12, 0x74, 0x82, 0x46, 0xDA, 0x43,
+    0x44, 0x3B, 0x05, 0x0D, 0xC1, 0xE8, 0x1B, 0x83, 0x79, 0x50, 0xD0, 0x68, 0x9A, 0xD2, 0x54, 0x3A,
+    0x0C, 0x95, 0x07, 0x87, 0x7D, 0x9A, 0x03, 0x93, 0x16, 0x3C, 0x30, 0x66, 0x12, 0xDA, 0xA0, 0xA2,
+    0xA3, 0x2C, 0x6D, 0xD0, 0xE4, 0x97, 0xBE, 0x71, 0xEE, 0xC6, 0xF1, 0xB8, 0xC9, 0x9C, 0xEE, 0x5E,
+    0xA1, 0xC1, 0xD0, 0x17, 0xAA, 0xC9, 0xB4, 0x84, 0xE5, 0x69, 0x27, 0xC8, 0x6B, 0x18, 0x87, 0x88,
+    0xB9, 0xAE, 0x07, 0x26, 0x54, 0x13, 0x3F, 0x2C, 0x88, 0xD1, 0xFC, 0x68, 0x86, 0xBE, 0x97, 0x54,
+    0xEC, 0xAD, 0xEA, 0x34, 0x72, 0xDD, 0x02, 0xC9, 0x52, 0x51, 0x58, 0x4F, 0x51, 0x1A, 0xA0, 0x7E,
+    0x4A, 0xAE, 0xD5, 0xF4, 0x6A, 0x86, 0xE2, 0xE4, 0x82, 0xB8, 0x9B, 0xFB, 0x6D, 0x72, 0x56, 0x8A,
+    0xD5, 0x5B, 0xAF, 0xCC, 0xD8, 0xCA, 0x8C, 0xD3, 0xFB, 0x64, 0x79, 0xE8, 0x85, 0x29, 0x5D, 0x81,
+    0xE1, 0xF2, 0xDF, 0xE6, 0x99, 0x2E, 0x07, 0xB1, 0xDF, 0x21, 0xEC, 0x2A, 0x8C, 0x29, 0x05, 0xE2,
+    0x1D, 0xCE, 0xD7, 0xC1, 0xFE, 0x06, 0x7D, 0x55, 0x4D, 0x88, 0x1C, 0x45, 0x18, 0x7D, 0x5D, 0xA5,
+    0x5B, 0x90, 0xDE, 0x9E, 0xBE, 0x44, 0x08, 0x66, 0x36, 0xED, 0x61, 0x0F, 0x03, 0xF6, 0xEE, 0xCC,
+    0xA1, 0x85, 0x16, 0x7A, 0xB7, 0x3B, 0x59, 0x30, 0x07, 0x85, 0xE4, 0xE2, 0x3D, 0x07, 0x4F, 0x22,
+    0x64, 0x0E, 0x03, 0x59, 0x31, 0x66, 0x6A, 0xB3, 0x87, 0x1C, 0x04, 0x99, 0x8B, 0x39, 0x08, 0x91,
+    0x3D, 0x78, 0x10, 0xFF, 0xD2, 0xEA, 0x1C, 0x16, 0xDD, 0x64, 0x6B, 0x37, 0x87, 0x1C, 0x04, 0x29,
+    0xE3, 0x41, 0x10, 0xC4, 0x32, 0xA0, 0x41, 0x72, 0xB0, 0xC0, 0x16, 0x26, 0x66, 0x32, 0xE5, 0xD7,
+    0xBD, 0xAB, 0x20, 0xA8, 0x0D, 0x45, 0x43, 0x55, 0x7D, 0x55, 0xDF, 0xFB, 0xDE, 0xFB, 0x5E, 0x61,
+    0xC4, 0x8A, 0x94, 0x29, 0x1F, 0xC6, 0xD3, 0x25, 0xD2, 0x75, 0x84, 0x19, 0xF8, 0x0C, 0xD8, 0x05,
+    0x22, 0x09, 0xA1, 0xC0, 0x0D, 0x84, 0x45, 0x6E, 0x10, 0x8E, 0xD0, 0x7C, 0x5D, 0xA7, 0x4F, 0x84,
+    0x7C, 0xED, 0xA4, 0xE9, 0xF4, 0x97, 0xF8, 0xE9, 0xB5, 0x3D, 0x3B, 0x74, 0x8F, 0x3C, 0xE7, 0x0A,
+    0x8C, 0x81, 0x90, 0xD6, 0x2D, 0xB0, 0x0C, 0x70, 0x7D, 0xB0, 0x1B, 0x7E, 0xC1, 0x15, 0x2C, 0x8D,
+    0x15, 0x9A, 0x12, 0x9B, 0x34, 0xFD, 0x1B, 0x0D, 0x3A, 0x0F, 0x82, 0x06, 0xAB, 0x68, 0x38, 0x1A,
+    0x0F, 0x35, 0x98, 0x9D, 0xD2, 0xE8, 0xD2, 0x9C, 0x30, 0x34, 0x3F, 0xAD, 0xA3, 0x3D, 0x15, 0x30,
+    0xD5, 0xE6, 0x32, 0x16, 0x45, 0xEA, 0x23, 0x09, 0x51, 0xB6, 0x60, 0x17, 0x60, 0x62, 0x4F, 0x67,
+    0x4C, 0xE5, 0xCE, 0xEE, 0x3A, 0x43, 0x9B, 0x40, 0xE7, 0x7B, 0x68, 0xE3, 0xAE, 0x0C, 0x12, 0x76,
+    0x1B, 0x59, 0xC9, 0xDF, 0x44, 0x65, 0xBB, 0xBE, 0xB3, 0xDD, 0x77, 0xC0, 0x34, 0xB2, 0x7A, 0x43,
+    0x9D, 0xCC, 0xA9, 0x0D, 0x95, 0xB5, 0x08, 0xEC, 0x20, 0x15, 0xA7, 0x94, 0x8E, 0x43, 0x01, 0x9B,
+    0xC6, 0x5C, 0x6A, 0xB3, 0x20, 0x78, 0x51, 0x76, 0xE8, 0x26, 0x5D, 0x86, 0xCE, 0x49, 0xC2, 0x84,
+    0x7F, 0x0B, 0xF0, 0x05, 0x0C, 0x05, 0x14, 0xDA, 0xB4, 0xFF, 0x11, 0x40, 0x45, 0x70, 0x12, 0x88,
+    0x29, 0xA4, 0x46, 0x45, 0xF8, 0xD8, 0x0E, 0x98, 0x42, 0x0A, 0x5E, 0x60, 0x58, 0x85, 0x9E, 0x36,
+    0xC1, 0x02, 0xEE, 0xEC, 0xED, 0xE4, 0x6E, 0xAD, 0xDE, 0xD8, 0x60, 0x2B, 0xE6, 0x81, 0x8B, 0x94,
+    0xBC, 0x2F, 0x29, 0xAE, 0xE2, 0x92, 0xCA, 0x97, 0x80, 0x19, 0xE1, 0x8A, 0x15, 0x02, 0xC9, 0x55,
+    0x0B, 0xFA, 0xA2, 0xA7, 0x83, 0x50, 0xC6, 0xC7, 0x55, 0xC5, 0x5D, 0xD5, 0x45, 0x3E, 0xE1, 0xF6,
+    0x20, 0x58, 0x11, 0xDA, 0xFF, 0x3D, 0xDF, 0x9F, 0xC0, 0xBF, 0x6A, 0x89, 0xD9, 0xA2, 0x4F, 0xBB,
+    0xC0, 0x25, 0x7B, 0x7F, 0x1B, 0x39, 0xD1, 0x84, 0x92, 0xA8, 0x15, 0x95, 0xAF, 0x87, 0x6E, 0xCA,
+    0x9D, 0xC3, 0xF1, 0x59, 0x71, 0x48, 0x15, 0x15, 0x69, 0xA8, 0xF9, 0x65, 0x5D, 0x8A, 0xE7, 0x91,
+    0xFA, 0x01, 0xD2, 0x30, 0x46, 0x1A, 0xA4, 0x48, 0xA2, 0x0A, 0xE5, 0x92, 0x25, 0xE4, 0x63, 0xAE,
+    0x93, 0x9B, 0xE7, 0x65, 0x7F, 0xE8, 0xB0, 0x75, 0xBC, 0x3A, 0x84, 0xE1, 0x34, 0xFE, 0xF8, 0x10,
+    0xB1, 0xA7, 0x78, 0xD1, 0xC1, 0x3A, 0x97, 0xE2, 0xA7, 0x31, 0x89, 0x04, 0xC2, 0x59, 0xD8, 0x65,
+    0x64, 0xDC, 0x08, 0xB5, 0x82, 0x89, 0xAF, 0xA2, 0x62, 0xCA, 0x6D, 0xD8, 0x24, 0x77, 0x13, 0xA1,
+    0x93, 0xDB, 0xCB, 0xA2, 0x18, 0x90, 0xF6, 0x14, 0xB1, 0xB0, 0x13, 0x5D, 0x37, 0x39, 0x95, 0xFD,
+    0x5A, 0x73, 0xE4, 0x13, 0x23, 0x7F, 0x86, 0xAA, 0x56, 0xD3, 0xE0, 0x25, 0xE6, 0xA6, 0xA1, 0xAE,
+    0x32, 0xF6, 0xA3, 0xF1, 0x4F, 0x17, 0x59, 0x74, 0xDA, 0xE4, 0x33, 0x74, 0x1B, 0x29, 0xE6, 0x95,
+    0xF0, 0x54, 0xD9, 0x6E, 0x89, 0xC2, 0xE9, 0x36, 0xDF, 0x94, 0x69, 0xE2, 0x9F, 0x26, 0x41, 0x4C,
+    0xEA, 0xB5, 0xA1, 0xF3, 0x6B, 0x25, 0x86, 0xF0, 0x0C, 0x96, 0x6A, 0xF2, 0x33, 0xF8, 0x8D, 0x02,
+    0x10, 0x4D, 0xD1, 0xC9, 0x90, 0xA4, 0xE8, 0x0F, 0x60, 0x4A, 0xA6, 0xAC, 0x28, 0x4C, 0xF7, 0x83,
+    0x2A, 0x77, 0x55, 0x82, 0xF2, 0x29, 0x48, 0x9C, 0x2F, 0xFC, 0xB5, 0xA2, 0x9C, 0x13, 0x6F, 0x4F,
+    0xBB, 0xB3, 0x91, 0x46, 0x4D, 0xCB, 0xE8, 0x6C, 0xD7, 0x15, 0x11, 0x1D, 0x7C, 0xF4, 0x71, 0x14,
+    0x7C, 0xBF, 0x5A, 0xC7, 0x52, 0x7E, 0x82, 0x84, 0xFC, 0x2D, 0xAD, 0xBD, 0x4E, 0x7C, 0x0F, 0x69,
+    0x89, 0x93, 0x8A, 0x41, 0x90, 0xE9, 0x6A, 0x89, 0x68, 0xF7, 0x06, 0xFC, 0x7B, 0xF7, 0x2C, 0x9F,
+    0xCC, 0x72, 0xE9, 0xBD, 0xE7, 0xCD, 0x91, 0x24, 0xE6, 0x49, 0xD3, 0x31, 0x3A, 0xCB, 0xB6, 0x5B,
+    0x97, 0xA0, 0xED, 0xD9, 0x32, 0xDA, 0xDC, 0xF8, 0x3E, 0x08, 0x7A, 0xFD, 0xBB, 0xFB, 0x5F, 0xB5,
+    0x5A, 0x26, 0x19, 0xB2, 0x7D, 0x1B, 0x36, 0x39, 0x3E, 0x2C, 0xB0, 0x45, 0x3F, 0x81, 0x8B, 0xB1,
+    0x30, 0xE6, 0xC2, 0xDA, 0xDA, 0x0B, 0xED, 0xB4, 0xFC, 0x6C, 0x73, 0x73, 0x3B, 0x88, 0x54, 0xB9,
+    0x43, 0x68, 0x46, 0x5B, 0xE2, 0x0C, 0x62, 0x8B, 0x5F, 0xE1, 0x53, 0x6F, 0x16, 0x9E, 0x83, 0xBF,
+    0x8A, 0xF4, 0x06, 0xD3, 0x4D, 0xD3, 0x84, 0x53, 0xDC, 0x91, 0xED, 0x84, 0x6F, 0xA2, 0x57, 0x0A,
+    0x12, 0x91, 0xCE, 0xDA, 0x35, 0x4F, 0x23, 0x26, 0x77, 0x98, 0xCD, 0xBD, 0x49, 0xA4, 0x1E, 0xF9,
+    0xE3, 0x2F, 0xF8, 0x47, 0x17, 0xF6, 0xBE, 0xDD, 0xB1, 0x9F, 0x4C, 0xB7, 0xB3, 0xD5, 0x95, 0x28,
+    0x0C, 0x9F, 0x97, 0x54, 0xA1, 0x91, 0x27, 0xA9, 0x2C, 0x31, 0x06, 0x21, 0x62, 0x21, 0x43, 0xA6,
+    0x85, 0x74, 0x8E, 0x94, 0x62, 0x97, 0x5F, 0xDC, 0x09, 0x8B, 0x55, 0xA1, 0xC2, 0x5A, 0x2C, 0x91,
+    0xF1, 0xAF, 0x6C, 0xE8, 0x76, 0xEA, 0xDD, 0x2E, 0xE2, 0x3E, 0xFF, 0x12, 0xE3, 0x9B, 0xBB, 0xDC,
+    0xA9, 0xC8, 0x1C, 0x08, 0x22, 0x72, 0xB6, 0xE4, 0x9B, 0x6A, 0xA1, 0x85, 0x72, 0xC0, 0xF7, 0x55,
+    0x2B, 0xC4, 0x78, 0x9D, 0xEF, 0x6B, 0x82, 0x76, 0xF4, 0x06, 0x79, 0xCB, 0x18, 0x39, 0x93, 0x5C,
+    0xC5, 0x58, 0x67, 0xD2, 0x2F, 0x12, 0x4C, 0x04, 0xA2, 0x9F, 0x0D, 0xD1, 0x8C, 0x67, 0x67, 0xE4,
+    0x16, 0x8D, 0x81, 0x2C, 0xE1, 0xB0, 0x61, 0x0F, 0x1C, 0x47, 0x5D, 0x3A, 0x97, 0x61, 0x81, 0xD8,
+    0x24, 0x32, 0x0C, 0x56, 0x10, 0xCE, 0xB0, 0xAB, 0xEA, 0x4A, 0x7F, 0x1D, 0x3C, 0xE6, 0x69, 0xAA,
+    0x2A, 0xAF, 0x3B, 0x81, 0x62, 0x6B, 0xC6, 0xA9, 0x2D, 0x42, 0x0C, 0x44, 0xD1, 0xE2, 0x8A, 0xEF,
+    0x69, 0x58, 0x8B, 0xE5, 0x31, 0x04, 0x15, 0x86, 0x5C, 0x2D, 0xA7, 0xE2, 0x34, 0xAE, 0xE6, 0x6B,
+    0x0C, 0x35, 0xBA, 0x87, 0x9D, 0x48, 0x3D, 0x44, 0xAE, 0xD6, 0x3A, 0x23, 0xB8, 0xB4, 0x9D, 0xDE,
+    0x09, 0xFE, 0x1C, 0xD3, 0x49, 0x99, 0x85, 0xFE, 0xFD, 0xFB, 0x86, 0x9A, 0xC4, 0x73, 0xB3, 0x26,
+    0xA9, 0x88, 0x8E, 0x26, 0x88, 0x47, 0x9B, 0x10, 0x46, 0x00, 0xC8, 0x30, 0x3F, 0x55, 0x78, 0xAD,
+    0xA0, 0x8C, 0xE8, 0x70, 0xFE, 0x03, 0xA8, 0x86, 0x2B, 0x4D, 0xDE, 0x0B, 0xB4, 0x26, 0x08, 0x63,
+    0x8B, 0x8C, 0x83, 0x9F, 0x52, 0xED, 0x23, 0x28, 0x57, 0x3F, 0x30, 0xB5, 0x49, 0xC6, 0x8D, 0x41,
+    0xD0, 0x77, 0x6C, 0x7E, 0x71, 0xBE, 0xD7, 0xE9, 0x25, 0xCF, 0xD8, 0x6E, 0x49, 0x6C, 0x37, 0x76,
+    0x39, 0x68, 0x07, 0x3E, 0xDF, 0x53, 0x64, 0x49, 0x2D, 0xB1, 0xB6, 0xA1, 0xCB, 0x84, 0xFC, 0xA6,
+    0x36, 0x98, 0xD5, 0xEB, 0x1F, 0x0B, 0xA2, 0xE1, 0xFF, 0xB7, 0x5C, 0xBF, 0xE2, 0xDC, 0xE4, 0xC0,
+    0x82, 0x4D, 0x9D, 0x41, 0x2E, 0xE7, 0x08, 0x37, 0x39, 0xB9, 0x69, 0x31, 0xA9, 0xDB, 0x6D, 0xBE,
+    0x7F, 0xBF, 0xCA, 0x1F, 0xD4, 0x42, 0x00, 0x8A, 0x01, 0x02, 0x9F, 0x7C, 0xD3, 0x22, 0x0E, 0x1F,
+    0xF0, 0x0D, 0xDD, 0x19, 0xB4, 0xD9, 0x1B, 0x4C, 0xA5, 0x76, 0x75, 0xB7, 0xC5, 0xDD, 0x46, 0x73,
+    0x13, 0xAB, 0x7D, 0x95, 0x9E, 0x04, 0x84, 0x8F, 0x04, 0xEE, 0xA8, 0x8E, 0x59, 0xB8, 0xB4, 0xDB,
+    0x9D, 0x1D, 0x32, 0x62, 0x8E, 0x90, 0xF9, 0xB4, 0xE8, 0x26, 0xA2, 0x82, 0xED, 0x61, 0x3B, 0x9F,
+    0xB1, 0xC6, 0x46, 0xF8, 0xC9, 0x89, 0x77, 0xEB, 0xB2, 0xFA, 0x54, 0xF6, 0x12, 0x35, 0x3F, 0xBF,
+    0x25, 0x44, 0xC5, 0x2E, 0x5F, 0x83, 0xFE, 0x66, 0xCF, 0xF6, 0x9C, 0x3D, 0xF6, 0x97, 0x42, 0x80,
+    0xCF, 0x75, 0x20, 0x70, 0x2E, 0xF6, 0xA4, 0xE1, 0xAE, 0x58, 0x7E, 0x85, 0x91, 0x01, 0xF3, 0x93,
+    0x86, 0x64, 0x1A, 0x34, 0xE4, 0x77, 0xFE, 0xE6, 0x7E, 0xAE, 0xC2, 0x38, 0xF1, 0x71, 0xEE, 0xD5,
+    0xEB, 0xFB, 0xEE, 0x17, 0x5A, 0x24, 0x2B, 0x7B, 0xF0, 0x38, 0x73, 0x95, 0xE7, 0xA4, 0xA7, 0x7A,
+    0x73, 0x5E, 0xCD, 0xE0, 0xD3, 0x7A, 0x8E, 0xA9, 0x3E, 0x5F, 0x73, 0x53, 0x3A, 0x60, 0x0C, 0xF6,
+    0xFB, 0x31, 0xF2, 0x1E, 0x71, 0x90, 0x2A, 0xD5, 0xFB, 0xD9, 0xB3, 0x9E, 0xDB, 0xAA, 0x5D, 0x8F,
+    0x5E, 0x8A, 0xEF, 0x46, 0x14, 0xCB, 0xAB, 0x75, 0xAE, 0x52, 0xD2, 0x5E, 0x88, 0x3E, 0xBD, 0x28,
+    0x27, 0x60, 0x57, 0x3C, 0x93, 0xD1, 0x73, 0x44, 0xF9, 0x45, 0x8D, 0xEC, 0x98, 0x44, 0xBF, 0x4E,
+    0xA5, 0xF8, 0x6F, 0x2B, 0x79, 0x19, 0x69, 0x7C, 0x04, 0x7B, 0x0A, 0xDD, 0x8A, 0xE4, 0xB3, 0xF2,
+    0x24, 0x77, 0x36, 0x9C, 0x1C, 0xD4, 0x86, 0xBF, 0x55, 0x03, 0x28, 0xE1, 0x3D, 0x82, 0x77, 0x13,
+    0xC8, 0xBC, 0xAB, 0xB6, 0x4B, 0xDE, 0x46, 0xAB, 0x8B, 0xCC, 0x34, 0x0D, 0xE4, 0x51, 0x5E, 0x86,
+    0x17, 0x6D, 0x6C, 0x71, 0xB9, 0xD0, 0xBC, 0x8E, 0xA1, 0xB8, 0x72, 0xEB, 0xEE, 0xD6, 0xBB, 0x4D,
+    0xCE, 0xB5, 0x61, 0x07, 0x44, 0x1D, 0x95, 0xD8, 0x60, 0x40, 0xF7, 0x35, 0xAE, 0x90, 0xD1, 0xE3,
+    0x88, 0x23, 0x7F, 0x29, 0x56, 0x12, 0xC3, 0x74, 0x05, 0xFD, 0x83, 0x3A, 0x80, 0xB6, 0xD2, 0xBF,
+    0x87, 0x03, 0x56, 0x4A, 0x9C, 0x97, 0xBC, 0x49, 0x06, 0x43, 0x8B, 0xA7, 0x16, 0x31, 0x3F, 0x0F,
+    0xC6, 0xC1, 0x4E, 0xCE, 0xA0, 0xB6, 0x46, 0xE7, 0x92, 0xC5, 0xC5, 0x60, 0x27, 0x13, 0x8D, 0x57,
+    0xFC, 0x09, 0x6D, 0x55, 0xCF, 0x8F, 0x14, 0x45, 0x14, 0xFE, 0xAA, 0x8B, 0x6C, 0x09, 0x3D, 0x33,
+    0xC5, 0x41, 0x12, 0x62, 0x66, 0xB7, 0x39, 0xEC, 0x61, 0x4D, 0x86, 0x6D, 0x0E, 0x73, 0x18, 0x63,
+    0xCF, 0x4E, 0x03, 0x31, 0x9E, 0x0C, 0x1C, 0xF4, 0x64, 0xA2, 0x78, 0x27, 0x66, 0x0F, 0x10, 0x36,
+    0x11, 0xD9, 0x06, 0xE2, 0x89, 0x03, 0xF8, 0x1F, 0xEC, 0xD1, 0x6C, 0x4C, 0x18, 0x93, 0x95, 0x6C,
+    0xCC, 0xC2, 0x14, 0x70, 0xE0, 0x60, 0x64, 0x0B, 0xD1, 0x98, 0x98, 0x28, 0x1D, 0x88, 0x21, 0x72,
+    0x6A, 0xA1, 0x63, 0x46, 0xEC, 0x99, 0xF2, 0xAB, 0x5E, 0xE0, 0x64, 0xCF, 0x54, 0x32, 0x53, 0x5D,
+    0xF5, 0xEA, 0xBD, 0xF7, 0xFD, 0xA8, 0x5D, 0x40, 0x43, 0xFA, 0xEF, 0xFC, 0x0C, 0x06, 0xAE, 0x3C,
+    0xD4, 0x68, 0x9C, 0x68, 0x37, 0xAE, 0x2C, 0x6E, 0x9A, 0x41, 0x0E, 0x3E, 0x1D, 0xE0, 0xAD, 0xE3,
+    0xC2, 0xAD, 0x61, 0x08, 0xE4, 0x10, 0xBF, 0x5E, 0x09, 0x5C, 0x29, 0xCB, 0x15, 0x69, 0x7A, 0x61,
+    0xDA, 0xD5, 0x58, 0xD6, 0x18, 0xCE, 0xA1, 0xE8, 0x8B, 0x3C, 0x09, 0x2C, 0xB0, 0x06, 0x05, 0x74,
+    0x81, 0x94, 0x3B, 0xE5, 0xD1, 0xAC, 0x9D, 0xE0, 0x99, 0x91, 0x5B, 0x88, 0x0D, 0x2A, 0xA8, 0x0A,
+    0x9D, 0x31, 0x1E, 0x96, 0xE1, 0xD1, 0x02, 0x78, 0x0D, 0x38, 0x58, 0x07, 0xF7, 0x4F, 0x5B, 0x14,
+    0xC3, 0xE8, 0xE2, 0xF9, 0xDF, 0x9A, 0xCD, 0x43, 0xCB, 0x0F, 0x6F, 0xDD, 0x6D, 0xB5, 0xF2, 0xEE,
+    0x6A, 0x70, 0xAB, 0xD0, 0x5C, 0x26, 0x20, 0x0F, 0x1B, 0x8C, 0x0C, 0x66, 0x52, 0xBC, 0x7A, 0x42,
+    0x24, 0xC2, 0xCE, 0xA2, 0xA7, 0xA1, 0x55, 0x2A, 0x6F, 0x1B, 0x7C, 0x67, 0x11, 0x15, 0x90, 0x63,
+    0xF0, 0x18, 0x2C, 0x01, 0x11, 0x10, 0xA7, 0xC2, 0xA5, 0xB8, 0xB1, 0xB3, 0x21, 0xC0, 0xF1, 0xE5,
+    0xE6, 0x1E, 0x18, 0xDB, 0x6E, 0x04, 0xE7, 0x4D, 0x77, 0x41, 0xC9, 0x74, 0x6D, 0x30, 0xC1, 0x3C,
+    0x24, 0xB0, 0x17, 0x81, 0x91, 0x6E, 0x1C, 0x3F, 0xC1, 0x32, 0x03, 0xC3, 0xE5, 0x3A, 0x38, 0x6F,
+    0xDB, 0x9D, 0xE0, 0xE2, 0xF3, 0x72, 0xE0, 0x84, 0xB3, 0x7E, 0x7B, 0xC6, 0xD2, 0x4F, 0xC1, 0x55,
+    0x1A, 0xF2, 0x27, 0x31, 0x1D, 0x6E, 0xEE, 0x49, 0x82, 0xCB, 0x33, 0xF7, 0x5D, 0xE1, 0x4A, 0x1F,
+    0x7D, 0xE0, 0x5C, 0x1A, 0x3D, 0xB9, 0x6A, 0x64, 0x11, 0x1A, 0x7C, 0xCE, 0x11, 0x5E, 0xCA, 0x18,
+    0x28, 0x85, 0xE0, 0xFB, 0xE0, 0xFE, 0x25, 0x04, 0x37, 0xAD, 0x15, 0x76, 0xD8, 0x45, 0xD1, 0x6B,
+    0x62, 0x63, 0x4E, 0xF2, 0x2D, 0x22, 0x57, 0x24, 0x1A, 0xA7, 0xAD, 0x98, 0xE0, 0xCD, 0x1F, 0xC4,
+    0x9D, 0xFD, 0x8D, 0x85, 0x13, 0x6B, 0xF7, 0x8C, 0x0F, 0x17, 0x67, 0x49, 0xF0, 0x38, 0xB3, 0x5A,
+    0x1D, 0xC3, 0xB5, 0x51, 0x89, 0x91, 0x4B, 0x95, 0x8D, 0xD0, 0x07, 0x7B, 0x8C, 0x92, 0x19, 0x98,
+    0x04, 0x91, 0x28, 0xB0, 0xA1, 0x6C, 0x68, 0xB4, 0x9B, 0x20, 0x66, 0x8E, 0xF1, 0xB8, 0xAE, 0x53,
+    0x94, 0x6D, 0xF5, 0x5E, 0x4F, 0x8F, 0x72, 0xF9, 0xC4, 0x6A, 0xE4, 0x6D, 0x0C, 0x13, 0x9E, 0x89,
+    0xBC, 0x17, 0x98, 0xA5, 0xAB, 0x59, 0x3C, 0x45, 0x58, 0xBE, 0x6A, 0xE2, 0x1B, 0xCC, 0x42, 0xBA,
+    0x77, 0x80, 0xD5, 0xF1, 0x0A, 0x64, 0xCE, 0x88, 0x7D, 0x28, 0x13, 0x14, 0x6C, 0x1E, 0x1B, 0x9F,
+    0x80, 0x11, 0x0B, 0x65, 0x20, 0x6D, 0x1F, 0xD0, 0x1E, 0xB2, 0xA5, 0x88, 0x10, 0x8C, 0xC7, 0x7E,
+    0x17, 0xF3, 0xD4, 0x53, 0x5F, 0x39, 0xA7, 0x7D, 0xA1, 0x2F, 0xBA, 0xFC, 0x3B, 0x0E, 0x12, 0x98,
+    0x61, 0x2B, 0x30, 0xC3, 0x50, 0x66, 0x9D, 0x04, 0xD7, 0xAC, 0x70, 0x50, 0x0C, 0xC9, 0xB3, 0x7A,
+    0xB8, 0xEF, 0x08, 0xF8, 0x15, 0x8F, 0x06, 0x84, 0x89, 0x5C, 0x1E, 0x7E, 0x70, 0x5C, 0x1A, 0xCF,
+    0x2A, 0xAC, 0x00, 0xFE, 0x14, 0x30, 0x01, 0x04, 0xFC, 0x5F, 0xFA, 0x04, 0x10, 0xBF, 0x4C, 0xD5,
+    0x42, 0x09, 0x57, 0x85, 0xF5, 0x64, 0x01, 0x95, 0x79, 0xEA, 0x10, 0x6E, 0xE3, 0x57, 0x08, 0x37,
+    0x0D, 0x7E, 0x7E, 0x9F, 0xBF, 0xD9, 0xD5, 0xC8, 0x95, 0xD1, 0x93, 0x35, 0x5D, 0xE3, 0xBF, 0x58,
+    0x87, 0xE4, 0x86, 0x2D, 0x46, 0x75, 0x35, 0x82, 0xA3, 0xB2, 0x4D, 0x84, 0x65, 0x26, 0x88, 0xE9,
+    0xFA, 0x7A, 0xA6, 0x5D, 0x25, 0x4C, 0xCD, 0x41, 0x0F, 0xC8, 0x29, 0xD2, 0xCA, 0x65, 0x98, 0x7C,
+    0xC4, 0x34, 0x86, 0xC2, 0x2A, 0xCE, 0x0F, 0xA5, 0x69, 0x61, 0x25, 0x34, 0xE1, 0x11, 0xAF, 0x04,
+    0x55, 0xED, 0x46, 0x03, 0x73, 0x6B, 0x9D, 0xF9, 0xEE, 0xFC, 0xA1, 0x43, 0x9F, 0x58, 0xF4, 0xC3,
+    0x62, 0x09, 0x71, 0x58, 0x6C, 0x42, 0x87, 0xF7, 0x0A, 0xE8, 0xCB, 0x77, 0x0C, 0xD4, 0xF6, 0x76,
+    0x0A, 0xF9, 0x80, 0xB4, 0x0B, 0x9C, 0x87, 0xC4, 0x15, 0x3E, 0xC3, 0xDC, 0xA7, 0xC0, 0x9A, 0x62,
+    0x47, 0x7A, 0x8E, 0x6E, 0x4C, 0x11, 0x54, 0xD3, 0x51, 0x1A, 0x96, 0x93, 0x81, 0x19, 0xFC, 0x38,
+    0x89, 0xFF, 0xF4, 0x35, 0x36, 0x6A, 0x21, 0xEC, 0xA0, 0x78, 0xE1, 0x4A, 0x36, 0xDB, 0xEF, 0xE1,
+    0xD9, 0x5D, 0xA8, 0xCF, 0x8C, 0x6F, 0xB2, 0x9C, 0x70, 0x5F, 0x41, 0xA2, 0x65, 0xFA, 0xEA, 0x59,
+    0xF9, 0xE8, 0x91, 0x47, 0x91, 0x39, 0xEF, 0xC2, 0xBE, 0x94, 0x60, 0xEC, 0x62, 0x47, 0x5A, 0xC0,
+    0x86, 0xF8, 0x30, 0xD3, 0x7C, 0x33, 0xF4, 0x0D, 0x0B, 0x8F, 0x1E, 0xDE, 0xD2, 0xCE, 0x90, 0x17,
+    0x14, 0xE4, 0x02, 0x63, 0x7E, 0x25, 0x66, 0xD8, 0xF8, 0x46, 0x50, 0xB2, 0xB0, 0x85, 0xC5, 0x62,
+    0x90, 0xED, 0xC5, 0x3E, 0xCC, 0x60, 0x93, 0x3A, 0x54, 0x46, 0xDE, 0x2C, 0x90, 0xF4, 0x11, 0x1E,
+    0x4B, 0xF1, 0x34, 0x87, 0xDE, 0x62, 0xF6, 0x04, 0xD7, 0x78, 0xC9, 0x62, 0xC4, 0x89, 0xD5, 0x54,
+    0x3C, 0xAD, 0x10, 0xEB, 0x5C, 0xDA, 0x51, 0x7A, 0x56, 0x55, 0x07, 0xC0, 0xAD, 0x3C, 0x46, 0x5C,
+    0xC8, 0x16, 0x86, 0xF2, 0x24, 0xCE, 0xA4, 0xA1, 0x25, 0x61, 0x22, 0x2B, 0x1F, 0xA0, 0x3B, 0x56,
+    0xFC, 0xE3, 0xD3, 0x03, 0xB3, 0xEA, 0x0B, 0x1B, 0xA6, 0x07, 0xBF, 0xCC, 0xE5, 0xD7, 0x2B, 0x38,
+    0xB3, 0x8D, 0x90, 0x41, 0xD9, 0x93, 0xB9, 0x51, 0x26, 0xBF, 0xBF, 0x8E, 0xE4, 0x59, 0xA9, 0x2E,
+    0x47, 0xA6, 0x84, 0xAB, 0x3B, 0x20, 0xB3, 0xD3, 0x9D, 0xE0, 0x9A, 0x69, 0x56, 0x58, 0xB5, 0xF2,
+    0xAA, 0x69, 0x3F, 0x36, 0xDF, 0x1C, 0xCB, 0x30, 0xA7, 0x4C, 0x54, 0x95, 0x38, 0x4B, 0x76, 0x5E,
+    0xCE, 0xF0, 0x77, 0x9D, 0x9E, 0xF0, 0xE9, 0x59, 0x48, 0xA6, 0xB7, 0xCA, 0xCE, 0x8F, 0x32, 0xFC,
+    0x55, 0x21, 0xD2, 0x85, 0xCC, 0x47, 0x69, 0xDF, 0xCF, 0xEE, 0x85, 0x4A, 0xB5, 0xC3, 0xC7, 0xC7,
+    0x89, 0x75, 0xA7, 0x27, 0xB7, 0xF1, 0xB6, 0x09, 0x0B, 0x1E, 0xD3, 0x1A, 0x8B, 0x5F, 0x6C, 0x32,
+    0x90, 0x37, 0xAB, 0x81, 0x3B, 0x5F, 0xAC, 0x5F, 0xD7, 0x29, 0x8A, 0xB2, 0x0E, 0xDC, 0x27, 0x4F,
+    0xFE, 0xDD, 0xA9, 0x98, 0x91, 0x7D, 0x46, 0x8A, 0x63, 0x89, 0x2C, 0x67, 0x68, 0x75, 0xBB, 0xC2,
+    0x12, 0xB5, 0x53, 0x6A, 0x4F, 0x78, 0x35, 0x9D, 0xC5, 0xFD, 0xAC, 0x9D, 0x07, 0x15, 0x06, 0x50,
+    0x16, 0x23, 0xB4, 0x36, 0xC5, 0x6D, 0xDB, 0x19, 0x00, 0xAF, 0xF3, 0xB3, 0x41, 0xD6, 0x15, 0x38,
+    0xCB, 0xB1, 0x49, 0x51, 0x95, 0xE4, 0x73, 0x21, 0xAD, 0xA0, 0x96, 0xE8, 0x0F, 0x8E, 0xF6, 0xE2,
+    0x9C, 0xE5, 0x30, 0x51, 0xAA, 0x4D, 0x0C, 0x9D, 0x0D, 0x68, 0x55, 0xE7, 0x30, 0x68, 0xBC, 0x80,
+    0x7F, 0x9E, 0xA3, 0x09, 0xBB, 0xAC, 0x02, 0xD3, 0x69, 0x21, 0xEF, 0xAA, 0xC3, 0x6E, 0x12, 0xD2,
+    0x2B, 0x94, 0xC9, 0xE7, 0xC2, 0xF4, 0xDB, 0x17, 0x44, 0xF1, 0x9C, 0x0D, 0xC8, 0xA6, 0x0D, 0x2C,
+    0x91, 0xC8, 0x5E, 0x36, 0xFE, 0x38, 0x4F, 0x7C, 0x56, 0x14, 0x78, 0x31, 0x93, 0xFD, 0xB1, 0xAF,
+    0xC1, 0x93, 0x6F, 0xE4, 0x58, 0x86, 0x3F, 0xD7, 0x2B, 0xAB, 0xF2, 0xC2, 0xD2, 0xD4, 0x4B, 0x21,
+    0xC6, 0xDE, 0x2C, 0x63, 0xCA, 0x57, 0x92, 0x64, 0xED, 0xC0, 0x60, 0xAD, 0xC5, 0xB8, 0x5D, 0xCC,
+    0xB2, 0x6B, 0x23, 0x47, 0x9D, 0x57, 0x68, 0xD1, 0x74, 0x4E, 0x85, 0x69, 0x40, 0xD3, 0x81, 0x58,
+    0x5F, 0xF7, 0x66, 0x47, 0x3A, 0x66, 0x14, 0xD8, 0x29, 0x16, 0x16, 0x7A, 0x8D, 0x15, 0x14, 0x5F,
+    0x0B, 0xE7, 0x26, 0x44, 0xFA, 0x8F, 0x8D, 0x0E, 0xC6, 0xF2, 0xA2, 0xD1, 0xE8, 0x25, 0x22, 0x97,
+    0xEF, 0x66, 0x07, 0xB1, 0xBC, 0x21, 0xCD, 0xA7, 0x1A, 0x89, 0xAE, 0x09, 0x21, 0xE9, 0x57, 0x74,
+    0x06, 0xA2, 0x93, 0x70, 0xF3, 0x0A, 0xB5, 0xB6, 0x01, 0x5E, 0x1F, 0x14, 0x74, 0x4E, 0x4F, 0x77,
+    0x65, 0x2F, 0x28, 0x13, 0x0A, 0x7B, 0x96, 0x0B, 0x9A, 0x5C, 0xD0, 0xE6, 0x02, 0x2E, 0x92, 0x05,
+    0x76, 0x8B, 0x1D, 0x97, 0x11, 0x2C, 0x32, 0xA0, 0x1A, 0x38, 0xC5, 0x3A, 0xD5, 0x04, 0xB9, 0x3E,
+    0x42, 0xB7, 0xC1, 0x72, 0x4F, 0xA1, 0x37, 0xCB, 0x9E, 0x85, 0xC8, 0xFB, 0xB4, 0xC8, 0x73, 0x98,
+    0xE8, 0xE9, 0xC9, 0xC8, 0x39, 0x5A, 0xB8, 0xFB, 0x07, 0xE2, 0xA5, 0x45, 0xB1, 0x1B, 0xAC, 0xBA,
+    0xA7, 0xCA, 0x90, 0x17, 0x81, 0x5D, 0xDE, 0xDF, 0x6E, 0xCA, 0x23, 0xD9, 0xCD, 0x3C, 0x69, 0x6E,
+    0x1E, 0x71, 0x6E, 0x4B, 0x3D, 0x9F, 0xBE, 0xF2, 0xC7, 0x99, 0x09, 0x0D, 0xC1, 0xCA, 0xB2, 0xDE,
+    0xB0, 0x54, 0x5B, 0x93, 0xF7, 0x25, 0x56, 0x4E, 0x8F, 0x24, 0xF0, 0xFE, 0xBA, 0x49, 0x07, 0xAE,
+    0x0A, 0x1C, 0x55, 0x49, 0x75, 0xC7, 0x6E, 0x47, 0x14, 0x07, 0x6A, 0xE3, 0xF1, 0x3E, 0x6E, 0xCE,
+    0x9D, 0x48, 0x58, 0x99, 0xF6, 0x96, 0x93, 0x73, 0x92, 0x96, 0x49, 0xA6, 0x66, 0x61, 0xE6, 0x6F,
+    0x8C, 0x6D, 0x22, 0xE3, 0x8D, 0xA8, 0xA8, 0x4D, 0x6A, 0x8E, 0xEE, 0x43, 0xE3, 0xB0, 0xF0, 0xC8,
+    0x6D, 0xED, 0xDC, 0x61, 0x29, 0x78, 0x95, 0xF8, 0x3B, 0xAD, 0x59, 0x5B, 0xE6, 0xC0, 0x7D, 0x71,
+    0x3A, 0x6D, 0x63, 0x0F, 0x64, 0x4A, 0xDB, 0x1A, 0x72, 0xD7, 0x1C, 0x18, 0xEA, 0x04, 0xBC, 0x7D,
+    0x2E, 0x26, 0x5E, 0x20, 0xC5, 0xA2, 0xB4, 0xB1, 0x4E, 0xA3, 0x45, 0xE8, 0x0A, 0xA4, 0x2A, 0x75,
+    0xC8, 0x10, 0xEC, 0x3C, 0x31, 0x66, 0xC2, 0x23, 0xFC, 0xDF, 0xF3, 0x1F, 0xA5, 0x55, 0x3D, 0x6C,
+    0x1C, 0x45, 0x14, 0xFE, 0x76, 0x27, 0xF6, 0x60, 0xEF, 0xDD, 0x0D, 0x85, 0x0B, 0x0B, 0xD9, 0xB7,
+    0x14, 0x2E, 0xA2, 0xC8, 0xF6, 0xB9, 0x38, 0xA1, 0x93, 0x58, 0x7B, 0x37, 0x89, 0x04, 0x45, 0x0A,
+    0x2C, 0x14, 0x3A, 0x8A, 0x20, 0x51, 0x20, 0x05, 0x89, 0x2B, 0x4E, 0xE2, 0x0A, 0x3B, 0x37, 0x49,
+    0x88, 0x5C, 0x21, 0xDC, 0x50, 0x41, 0xC0, 0x45, 0x0A, 0xB0, 0x90, 0x72, 0x12, 0x2E, 0x8C, 0xE4,
+    0xE4, 0x26, 0x4E, 0x91, 0x22, 0x12, 0x0C, 0x58, 0x40, 0xE9, 0x35, 0x44, 0x32, 0x52, 0x40, 0x99,
+    0x24, 0x2B, 0x72, 0x26, 0xE7, 0x1B, 0xDE, 0xDC, 0x99, 0xC4, 0x40, 0x83, 0xC4, 0x9C, 0x66, 0x6D,
+    0xED, 0xCC, 0xBC, 0xF7, 0xE6, 0xFB, 0x79, 0x5B, 0x63, 0x4B, 0xB2, 0x59, 0x29, 0xB0, 0x8B, 0x2A,
+    0xAA, 0xB1, 0xAF, 0x31, 0xA7, 0xFC, 0x0C, 0x25, 0x30, 0x8D, 0x08, 0x5C, 0xA1, 0x88, 0xE0, 0xA2,
+    0xE2, 0x32, 0x63, 0x6A, 0x9A, 0xA9, 0xE0, 0xA6, 0xF6, 0x7E, 0x4F, 0x11, 0x1B, 0x08, 0x83, 0xD8,
+    0xCA, 0xE1, 0xAE, 0xC4, 0x1C, 0x50, 0x4A, 0x20, 0x14, 0x02, 0x03, 0x40, 0x0E, 0xA0, 0xC6, 0x93,
+    0x02, 0x53, 0xEC, 0x82, 0x42, 0x9A, 0x22, 0xA2, 0xAD, 0x35, 0xB0, 0x36, 0x8E, 0xD9, 0x15, 0x61,
+    0x3B, 0x10, 0x70, 0x41, 0x31, 0x8F, 0xFE, 0x08, 0xC0, 0x94, 0x97, 0x32, 0x85, 0x88, 0x26, 0x25,
+    0x82, 0xF7, 0x50, 0x03, 0x31, 0xCD, 0x20, 0x05, 0x58, 0x46, 0xB3, 0x4B, 0xF3, 0xB1, 0x02, 0x33,
+    0x6D, 0x9A, 0x31, 0xCD, 0x20, 0xA5, 0xF7, 0x9D, 0x19, 0x3A, 0x3D, 0x46, 0x73, 0x18, 0x9E, 0x1C,
+    0x85, 0xAA, 0x62, 0x47, 0xE3, 0xDD, 0x04, 0xB3, 0xC0, 0x02, 0xBC, 0x7D, 0xB0, 0x0F, 0x20, 0x44,
+    0x12, 0xF1, 0xF7, 0x80, 0x67, 0x68, 0x57, 0x6C, 0x37, 0x2F, 0x2D, 0x26, 0xBA, 0x80, 0x19, 0x9E,
+    0x8C, 0xF9, 0x6A, 0x18, 0x86, 0x25, 0x15, 0xA8, 0x71, 0x34, 0x03, 0x54, 0x98, 0x2A, 0xC0, 0x5A,
+    0xD3, 0xA0, 0xF2, 0x50, 0xA0, 0xFA, 0x12, 0xF8, 0xAA, 0x75, 0xFF, 0x82, 0x5C, 0xD6, 0x33, 0x33,
+    0xB9, 0xB1, 0xA1, 0x61, 0xC6, 0x56, 0x77, 0x68, 0x8D, 0xC3, 0x97, 0xC0, 0x28, 0x56, 0x9A, 0x04,
+    0xD5, 0x78, 0x1E, 0xCD, 0x2A, 0xBB, 0xA1, 0xA6, 0xF9, 0x4B, 0x59, 0x40, 0xE5, 0xD1, 0xB9, 0x1A,
+    0x1D, 0x73, 0xF7, 0x7B, 0x51, 0xE2, 0x32, 0x50, 0x85, 0x97, 0x1C, 0x19, 0x18, 0x1B, 0x3E, 0x9A,
+    0x9F, 0xC8, 0x4D, 0x44, 0x61, 0x1B, 0x65, 0xCC, 0xE0, 0x0C, 0xBE, 0xA0, 0x00, 0x23, 0x05, 0x4C,
+    0x96, 0xF1, 0x93, 0xE2, 0xAF, 0x60, 0xB2, 0x82, 0xFB, 0x5B, 0xA7, 0x96, 0xDE, 0xDF, 0x17, 0xD6,
+    0x84, 0xBB, 0x32, 0x3F, 0x85, 0xAA, 0xC1, 0xCB, 0x04, 0x10, 0xC3, 0x0D, 0x55, 0x5D, 0x2E, 0xBF,
+    0xF0, 0x7A, 0xE1, 0x9E, 0xF7, 0x58, 0x8E, 0xEA, 0xA1, 0x2A, 0x61, 0x8B, 0x49, 0x82, 0x0B, 0x15,
+    0x57, 0x61, 0x13, 0xA2, 0x25, 0xF7, 0xC6, 0x8B, 0xD8, 0x52, 0xF9, 0x8A, 0x77, 0x2B, 0x99, 0x5C,
+    0x63, 0xDF, 0xA0, 0x4E, 0x1B, 0x68, 0x99, 0x12, 0xD1, 0x3A, 0x08, 0xC0, 0x1F, 0x96, 0x7D, 0x9B,
+    0xB1, 0xAC, 0xCE, 0x54, 0x85, 0x27, 0x65, 0x81, 0xAA, 0x40, 0xB3, 0x08, 0x33, 0xEB, 0xA5, 0x91,
+    0x4F, 0x18, 0xCF, 0xF3, 0xC4, 0xA6, 0x8B, 0xD7, 0xD8, 0xF1, 0xD6, 0x9D, 0x49, 0xB6, 0x6D, 0x55,
+    0xCB, 0x76, 0xC4, 0xE7, 0xF3, 0x1E, 0x1D, 0x0C, 0x01, 0xAF, 0x0D, 0x08, 0xBB, 0x8F, 0x86, 0x55,
+    0x68, 0xDD, 0xC1, 0xF3, 0xA5, 0x93, 0x97, 0x87, 0x82, 0xBD, 0x15, 0xDB, 0x2D, 0x9C, 0xF6, 0x9C,
+    0x2C, 0x60, 0x33, 0x9F, 0xB8, 0xC1, 0x7C, 0x00, 0xAB, 0x17, 0xBF, 0x72, 0x41, 0x8E, 0xB2, 0xAB,
+    0x07, 0x41, 0x4E, 0x3F, 0x0D, 0x92, 0x38, 0xDA, 0x0F, 0x82, 0x10, 0x2A, 0x18, 0x74, 0xBC, 0x0F,
+    0x05, 0xE9, 0xA3, 0xF3, 0xE7, 0xBB, 0x1F, 0x17, 0xED, 0xCD, 0x0F, 0x93, 0x32, 0x89, 0xED, 0xD9,
+    0x92, 0x45, 0x4B, 0x13, 0x40, 0x47, 0x1C, 0x81, 0xEB, 0xC8, 0x60, 0x3C, 0xE3, 0xA7, 0x4C, 0x33,
+    0xC5, 0x55, 0x20, 0x85, 0x14, 0x49, 0x88, 0x98, 0x7E, 0xC4, 0xA7, 0x4F, 0x0F, 0x4E, 0x58, 0x53,
+    0x09, 0xEE, 0x31, 0x98, 0xE0, 0xD0, 0x60, 0x69, 0xE3, 0x44, 0x8A, 0x85, 0xF0, 0x06, 0x09, 0xEF,
+    0xD4, 0x8E, 0x81, 0xFF, 0x20, 0x23, 0x15, 0x45, 0x1D, 0x7A, 0x88, 0xEB, 0xEB, 0x54, 0x91, 0x63,
+    0x19, 0xB1, 0x7B, 0x84, 0xB6, 0xF7, 0x70, 0x95, 0xBA, 0x97, 0xE1, 0x3D, 0x0A, 0x57, 0xDA, 0xDE,
+    0x25, 0xF5, 0x6F, 0xB5, 0x2D, 0x4A, 0x3B, 0xDD, 0xD0, 0x29, 0x7A, 0x9E, 0xF4, 0x13, 0x30, 0xCA,
+    0xD1, 0xA0, 0x8D, 0x58, 0x3E, 0x94, 0x6A, 0x64, 0xE0, 0x78, 0xC2, 0x36, 0xB3, 0x3A, 0xA6, 0x63,
+    0x82, 0xE3, 0xE1, 0x8F, 0x12, 0x62, 0x91, 0xF6, 0x34, 0x08, 0x38, 0xE6, 0x42, 0x5B, 0x3A, 0xDE,
+    0xB0, 0x12, 0x61, 0xEB, 0x1A, 0x82, 0xDD, 0x5D, 0xC3, 0xDA, 0xDD, 0x58, 0x62, 0x7E, 0x04, 0xE9,
+    0x9A, 0xB7, 0xA9, 0xFD, 0x5B, 0x92, 0x7D, 0x02, 0xBE, 0xE0, 0x7C, 0x23, 0xF6, 0x30, 0x1E, 0x4A,
+    0xF2, 0x40, 0xE4, 0xE9, 0xBA, 0xAF, 0xC9, 0x6C, 0xE0, 0x12, 0xEF, 0xC0, 0xEB, 0xC0, 0xEB, 0x65,
+    0x7C, 0x43, 0x4D, 0xA8, 0x9C, 0xE6, 0x9A, 0x94, 0xFF, 0x9D, 0xAA, 0x96, 0x2B, 0x79, 0x72, 0x4E,
+    0x88, 0x01, 0x92, 0xFF, 0xAA, 0xE4, 0x36, 0xF5, 0x75, 0x0D, 0x66, 0x12, 0x91, 0xC0, 0x14, 0x97,
+    0xC2, 0x27, 0xD0, 0x8C, 0xAF, 0x23, 0x98, 0x22, 0xEA, 0x22, 0x59, 0x64, 0x9D, 0x39, 0x72, 0x04,
+    0x79, 0xDA, 0xA9, 0x73, 0x90, 0x34, 0x0C, 0xD1, 0xA1, 0x30, 0x63, 0x65, 0x76, 0x11, 0x33, 0x55,
+    0x5E, 0x80, 0x4E, 0xA3, 0xD0, 0xE9, 0x85, 0xD4, 0x33, 0x42, 0xBF, 0x3A, 0xB9, 0x68, 0x8D, 0xDC,
+    0x6F, 0x88, 0x09, 0x83, 0x75, 0x3F, 0x45, 0xC6, 0xB4, 0x67, 0x98, 0xF6, 0x0D, 0xB7, 0x36, 0x0D,
+    0xAC, 0xD5, 0xC2, 0x5A, 0x25, 0x12, 0xA1, 0x4A, 0x64, 0xFC, 0x18, 0xA1, 0x9A, 0x43, 0x89, 0xA8,
+    0xA0, 0x26, 0x80, 0x92, 0xEC, 0x5F, 0xBE, 0x37, 0x72, 0x9E, 0xAA, 0x06, 0xBE, 0xAC, 0x50, 0x8A,
+    0x1A, 0xF7, 0x49, 0x18, 0xD6, 0x54, 0xF8, 0x79, 0x3D, 0x1D, 0xA0, 0xED, 0x1A, 0x4C, 0xAB, 0x0F,
+    0xE3, 0x7F, 0x4E, 0xA9, 0x0F, 0xA5, 0x94, 0x73, 0xAE, 0xED, 0x40, 0xC8, 0x9E, 0xCE, 0x5C, 0x17,
+    0xA2, 0xA3, 0xC0, 0x95, 0x7F, 0xA5, 0x3D, 0xF1, 0x24, 0xED, 0x54, 0x40, 0xB1, 0x49, 0xF7, 0xA2,
+    0xA7, 0x43, 0x12, 0x21, 0x56, 0x6A, 0x6C, 0x53, 0x89, 0x02, 0xEA, 0x65, 0x5F, 0x69, 0xC1, 0x2E,
+    0xB5, 0xB9, 0xED, 0x2D, 0x47, 0x0E, 0x0D, 0x72, 0x59, 0xFF, 0xAF, 0xDB, 0xAB, 0x5E, 0x65, 0x6F,
+    0xE6, 0xF4, 0x97, 0x1F, 0x2D, 0xFD, 0x86, 0x26, 0x53, 0xA3, 0x7F, 0xE9, 0x80, 0x19, 0x9C, 0x43,
+    0x9C, 0x08, 0x1D, 0x64, 0x7E, 0x07, 0x56, 0x36, 0x54, 0xA1, 0x23, 0x36, 0xFC, 0xED, 0xCD, 0xC7,
+    0x72, 0x76, 0x63, 0x21, 0x63, 0xB7, 0xB7, 0x3F, 0x4D, 0x16, 0x1A, 0x0F, 0x8C, 0x58, 0xDA, 0x8F,
+    0x91, 0xC5, 0x4B, 0x69, 0x78, 0xD2, 0x5C, 0x67, 0x66, 0x56, 0xE8, 0xD8, 0x91, 0xDB, 0x0B, 0x00,
+    0xD7, 0xB4, 0x10, 0x38, 0x29, 0x93, 0x48, 0xF1, 0x1C, 0xB5, 0x99, 0x21, 0xA6, 0x67, 0xB9, 0x5E,
+    0x14, 0x69, 0x27, 0xFF, 0xF3, 0xAF, 0x63, 0x8F, 0xEA, 0x51, 0xB7, 0x5E, 0xE9, 0xAC, 0xD5, 0xD6,
+    0xCC, 0x9A, 0x67, 0x5C, 0xA3, 0xA1, 0x7B, 0x78, 0xE4, 0x5F, 0x6A, 0x7D, 0x11, 0x93, 0x35, 0xBA,
+    0x56, 0xC1, 0xD3, 0x93, 0xBE, 0xAA, 0x30, 0xD9, 0x2F, 0xAB, 0x9A, 0x23, 0x44, 0x28, 0x58, 0x28,
+    0xF1, 0xB7, 0xE1, 0x90, 0x72, 0x16, 0x22, 0xE0, 0xBD, 0xBB, 0x94, 0xFC, 0x36, 0xE5, 0x3D, 0x95,
+    0xA0, 0xE8, 0xAE, 0x4A, 0x82, 0x5B, 0xE7, 0xD2, 0x33, 0x5C, 0x31, 0x22, 0x97, 0x10, 0x57, 0x61,
+    0xC2, 0x89, 0x58, 0xAE, 0x7B, 0x47, 0xCB, 0xC3, 0xF0, 0xEF, 0xAA, 0x5E, 0x5B, 0xEE, 0x0F, 0x22,
+    0x5A, 0x58, 0xE9, 0xA7, 0xEB, 0xBD, 0x86, 0x4F, 0x0D, 0x47, 0x09, 0x8C, 0xF9, 0xC6, 0xFB, 0xA3,
+    0x4B, 0xEF, 0x53, 0x34, 0xA8, 0x07, 0xA2, 0x4E, 0x00, 0x66, 0x44, 0xCB, 0x95, 0xCF, 0xFE, 0x77,
+    0x0D, 0x9E, 0x26, 0x9B, 0x50, 0x67, 0x7C, 0xEB, 0xD8, 0x93, 0x48, 0xD7, 0xCF, 0x40, 0x5C, 0x95,
+    0x68, 0x8E, 0x13, 0x45, 0x35, 0x54, 0xA8, 0x23, 0x50, 0x09, 0x1C, 0x1B, 0x08, 0xAF, 0xA6, 0xEE,
+    0xEB, 0xD4, 0xAF, 0xE1, 0x60, 0x90, 0x8C, 0x94, 0xFB, 0x0E, 0xEC, 0x1D, 0x98, 0x13, 0x53, 0x64,
+    0x53, 0xF8, 0x5B, 0xEE, 0x76, 0x45, 0x57, 0x13, 0x4C, 0x83, 0x4C, 0x22, 0x3C, 0xE7, 0xDA, 0x2C,
+    0x20, 0xE0, 0x02, 0xE9, 0x78, 0x69, 0x58, 0xF7, 0x11, 0xB2, 0xD6, 0xB6, 0x89, 0xA6, 0xD8, 0xA6,
+    0x2C, 0xF5, 0xAC, 0x3D, 0x0C, 0xAB, 0xDF, 0x26, 0x4C, 0xAC, 0xFD, 0x56, 0x4D, 0x07, 0x69, 0x9E,
+    0x27, 0x8B, 0x67, 0x35, 0xC9, 0xF5, 0x97, 0x9C, 0xA3, 0x88, 0xB4, 0x4A, 0xB5, 0xEC, 0x0F, 0xD2,
+    0xB2, 0x35, 0x7C, 0xEF, 0xEE, 0x5E, 0x1F, 0xC9, 0x21, 0x4C, 0x6F, 0x3C, 0x01, 0x92, 0x5C, 0xC1,
+    0xBE, 0x3F, 0x4D, 0xC4, 0xD1, 0xFD, 0x03, 0xD7, 0x71, 0xD3, 0xC2, 0x6B, 0x09, 0x7D, 0xD8, 0xC8,
+    0x8B, 0x73, 0xAB, 0x09, 0xB5, 0x8F, 0x96, 0x4D, 0x0E, 0x28, 0x25, 0x46, 0x43, 0xFD, 0x34, 0xF1,
+    0x3B, 0x89, 0xAF, 0x75, 0x80, 0x33, 0xC5, 0xB3, 0xA6, 0xD4, 0x5D, 0x2E, 0xF7, 0x3A, 0xFF, 0xDC,
+    0xF1, 0xA4, 0x64, 0x13, 0xDE, 0x85, 0xDF, 0x75, 0xFF, 0x2C, 0x9F, 0xEB, 0x69, 0xD9, 0xAC, 0xDA,
+    0x93, 0xDD, 0xB7, 0x73, 0xD0, 0x13, 0x45, 0x94, 0x34, 0xFE, 0x31, 0xFE, 0x04, 0xA5, 0x55, 0xBF,
+    0x6F, 0x14, 0x47, 0x14, 0xFE, 0x66, 0x86, 0x78, 0x83, 0xD7, 0xE7, 0x49, 0x01, 0x12, 0x44, 0xB6,
+    0xAF, 0x49, 0x71, 0xB2, 0x0E, 0xAF, 0x0B, 0x2B, 0x3A, 0x29, 0x6B, 0xEF, 0x00, 0x05, 0x05, 0x05,
+    0x44, 0x4A, 0x94, 0x22, 0x45, 0x28, 0x52, 0xA4, 0x89, 0x70, 0xE1, 0xE2, 0x8A, 0xC3, 0xB7, 0xC4,
+    0x05, 0x25, 0xCE, 0x5F, 0x90, 0x8B, 0x44, 0xE1, 0xD8, 0x05, 0x57, 0xB8, 0x70, 0x12, 0xE3, 0x1D,
+    0xA0, 0x4C, 0xC1, 0x08, 0x94, 0x36, 0x9A, 0x84, 0x34, 0x81, 0x66, 0x08, 0x27, 0xE5, 0x88, 0xCF,
+    0x1E, 0xDE, 0xDC, 0x9D, 0x7F, 0x40, 0x93, 0x22, 0x23, 0x79, 0x4E, 0xBB, 0x9E, 0xF7, 0xBD, 0xF7,
+    0xBE, 0xF9, 0xDE, 0xB7, 0x00, 0xE2, 0x3D, 0x34, 0xF7, 0xD9, 0xC7, 0xDB, 0x40, 0x1B, 0xEC, 0xFE,
+    0x5D, 0x2F, 0xFF, 0xDA, 0xFC, 0x40, 0xE4, 0x8B, 0x75, 0x2C, 0x2B, 0xD0, 0x8A, 0x2F, 0x6A, 0xF1,
+    0xC0, 0xB2, 0xD6, 0x1D, 0x1C, 0x5F, 0xF1, 0x2B, 0xC4, 0xDE, 0xF0, 0xF3, 0x5D, 0x40, 0x02, 0x42,
+    0x4F, 0x17, 0x46, 0xBE, 0x6A, 0x0B, 0xCC, 0x61, 0xB5, 0x8E, 0xB8, 0x73, 0x78, 0xAE, 0x30, 0xCC,
+    0x77, 0xD9, 0x79, 0x02, 0xAF, 0x02, 0x13, 0x23, 0x45, 0x8F, 0xD0, 0x4F, 0xC2, 0x46, 0x91, 0x96,
+    0x5E, 0x95, 0xA5, 0x3A, 0x3B, 0x4A, 0x87, 0x46, 0x47, 0x02, 0xE2, 0x8A, 0x26, 0xA0, 0xC7, 0xEE,
+    0x78, 0x16, 0x79, 0x73, 0x2F, 0xCE, 0x99, 0x6B, 0x46, 0x1A, 0xF3, 0xC9, 0x2D, 0x8D, 0xF8, 0x97,
+    0x27, 0x06, 0x78, 0xF9, 0x92, 0xB6, 0x85, 0x7F, 0x2D, 0x10, 0xF9, 0x70, 0xBC, 0xBF, 0x35, 0x7B,
+    0x61, 0xF3, 0x79, 0xD8, 0xE8, 0xB9, 0x59, 0x78, 0x4A, 0xDE, 0xFC, 0xCE, 0xA0, 0xB8, 0xF2, 0xB4,
+    0x87, 0xE2, 0x56, 0xB7, 0x49, 0xF0, 0x5F, 0x56, 0x08, 0xF3, 0x92, 0x06, 0x73, 0xDD, 0xA3, 0x24,
+    0x4C, 0x5D, 0x3D, 0x81, 0x34, 0xB9, 0x94, 0xF3, 0x27, 0x2F, 0x2C, 0xE4, 0x42, 0x1D, 0xF8, 0xE7,
+    0xB7, 0x80, 0x4D, 0x58, 0x19, 0x41, 0x49, 0x42, 0x12, 0xBE, 0x0B, 0xB6, 0xBB, 0x6B, 0xB0, 0xB3,
+    0xDC, 0x44, 0x76, 0xFB, 0x29, 0x85, 0x2F, 0xA5, 0xE8, 0x34, 0x58, 0x6B, 0x2D, 0x40, 0x9C, 0xA6,
+    0x03, 0x86, 0xC1, 0x05, 0x0A, 0x61, 0xF1, 0xB9, 0x16, 0xFB, 0x04, 0x90, 0x83, 0x6B, 0x88, 0xFC,
+    0xCE, 0x75, 0xF8, 0x3D, 0x14, 0x7F, 0xF6, 0x93, 0x55, 0xCE, 0xA2, 0x31, 0x8F, 0xEE, 0x8D, 0x61,
+    0xEA, 0x35, 0x30, 0xEA, 0x9D, 0x03, 0x63, 0xE0, 0x9D, 0x3E, 0x47, 0x15, 0xCC, 0x38, 0x24, 0x39,
+    0xFA, 0x2D, 0xB1, 0xCF, 0x34, 0x36, 0x91, 0x62, 0x0A, 0x82, 0xF2, 0x1B, 0x8C, 0x83, 0xD9, 0x4A,
+    0x23, 0xF6, 0x79, 0xD9, 0x82, 0x7D, 0x1A, 0x7A, 0xE6, 0x9A, 0x39, 0x6C, 0x21, 0x51, 0xEC, 0x6B,
+    0x50, 0xFE, 0x71, 0xB6, 0x62, 0x9A, 0x3D, 0xBE, 0x7F, 0xD0, 0x19, 0xCA, 0xBE, 0x0F, 0x35, 0x85,
+    0x77, 0xD0, 0x41, 0x57, 0x68, 0x69, 0xCA, 0xF0, 0xD8, 0x8A, 0x7B, 0x42, 0x2F, 0xDB, 0x72, 0xF4,
+    0x48, 0x6D, 0xA5, 0x0D, 0xF1, 0xE4, 0xB1, 0x93, 0x33, 0x32, 0x5F, 0xB6, 0x37, 0x84, 0x17, 0x4E,
+    0x3A, 0xA9, 0x9B, 0xB8, 0x47, 0x51, 0xA7, 0x50, 0xEC, 0x0D, 0x90, 0x22, 0x34, 0x62, 0xD6, 0x1D,
+    0x8F, 0x96, 0x4A, 0xA5, 0xD9, 0x89, 0x5A, 0xBB, 0x6A, 0xED, 0x47, 0xB9, 0x69, 0x72, 0xBD, 0x2D,
+    0x34, 0x78, 0xBE, 0x8A, 0x72, 0xAC, 0xB0, 0x3D, 0xDF, 0x3F, 0xBA, 0x85, 0xAF, 0x84, 0x89, 0xAC,
+    0x44, 0xA6, 0xEA, 0xA2, 0xC7, 0x4D, 0xE2, 0x24, 0x7F, 0x9E, 0x37, 0xCA, 0xF3, 0xDC, 0xBE, 0x70,
+    0xF2, 0xCA, 0x65, 0x9D, 0x76, 0x16, 0xD8, 0xEE, 0xCD, 0x8E, 0xEC, 0x49, 0x9D, 0xE9, 0x8C, 0xF5,
+    0x42, 0xE3, 0x95, 0x33, 0xD8, 0x4A, 0xD1, 0xDD, 0xFE, 0xEF, 0x6C, 0x58, 0x6D, 0x81, 0x5B, 0xF7,
+    0x86, 0x52, 0xF8, 0xBE, 0x42, 0xB2, 0x61, 0xD1, 0x63, 0x1D, 0x4E, 0x6C, 0x90, 0x5A, 0xB6, 0xA9,
+    0x9E, 0x3A, 0x09, 0xB3, 0x3E, 0x05, 0x6C, 0x9E, 0x23, 0x66, 0xCE, 0x51, 0x50, 0x86, 0xD8, 0x24,
+    0xCF, 0x8A, 0xBC, 0xEC, 0x3D, 0x5D, 0x2A, 0x71, 0xE7, 0x57, 0x07, 0xF1, 0xAE, 0x1E, 0x3D, 0x34,
+    0xD3, 0xA3, 0xC3, 0xE4, 0x5D, 0x6C, 0xD5, 0x23, 0xB5, 0x58, 0x63, 0xF7, 0x4D, 0x1C, 0x21, 0xAD,
+    0x72, 0xB3, 0x53, 0x90, 0xC6, 0xD8, 0x80, 0xD4, 0x91, 0x57, 0x60, 0x7E, 0x1F, 0x65, 0x95, 0x12,
+    0xDD, 0x9B, 0x71, 0xCE, 0x4D, 0x46, 0x70, 0x1D, 0x34, 0x22, 0xCD, 0x6D, 0x59, 0x25, 0xC8, 0x7C,
+    0x07, 0x85, 0x57, 0x28, 0xEC, 0x70, 0x02, 0x94, 0xDC, 0x50, 0x4E, 0xC6, 0x48, 0x33, 0x6F, 0x6D,
+    0x74, 0x31, 0x4F, 0xE5, 0x86, 0x49, 0xF6, 0x91, 0x90, 0x88, 0x19, 0x35, 0x13, 0xF4, 0xD8, 0x58,
+    0xC0, 0x5B, 0x8B, 0xED, 0xA8, 0xA0, 0xE6, 0xC8, 0x48, 0xBA, 0xFE, 0x73, 0xDC, 0x62, 0x53, 0x7A,
+    0xAF, 0xE7, 0x51, 0x0E, 0xD7, 0x1D, 0x99, 0x98, 0xC6, 0x67, 0x0F, 0x89, 0x37, 0x48, 0x86, 0x4A,
+    0xAE, 0x07, 0x39, 0xE2, 0xCE, 0xDA, 0x11, 0x44, 0xA1, 0xC4, 0x33, 0x0A, 0x77, 0x55, 0x38, 0xCA,
+    0x5C, 0x63, 0xA6, 0x26, 0xF4, 0xC2, 0x5D, 0x45, 0xA9, 0xC3, 0x7C, 0x8E, 0x72, 0xC5, 0xDC, 0x26,
+    0x12, 0xA9, 0x0E, 0xCF, 0xE7, 0xF8, 0xF1, 0x3A, 0x49, 0x70, 0x33, 0x22, 0xD1, 0x02, 0x35, 0x4C,
+    0x6F, 0xE4, 0x82, 0x9A, 0x41, 0x4C, 0xE5, 0xB8, 0xA6, 0xBA, 0x17, 0x51, 0x05, 0x19, 0x11, 0x31,
+    0x94, 0x32, 0x5A, 0xD7, 0x68, 0x66, 0x17, 0x92, 0xA1, 0x21, 0x74, 0xD1, 0xAA, 0x86, 0x28, 0x58,
+    0x41, 0x9A, 0xAB, 0x9E, 0x20, 0xBE, 0xF7, 0x51, 0x0C, 0x19, 0x3E, 0x4D, 0x84, 0xEB, 0x61, 0x9E,
+    0x55, 0xAE, 0x6A, 0x5C, 0xC7, 0xB0, 0xCC, 0x38, 0xD4, 0xEA, 0x90, 0x29, 0xC2, 0xB8, 0x14, 0x40,
+    0x39, 0x07, 0xDD, 0x9D, 0xB0, 0x88, 0x1C, 0x32, 0x1A, 0xC5, 0x61, 0x70, 0xE4, 0x2D, 0xBB, 0x7A,
+    0x8C, 0x1B, 0x6A, 0x28, 0x52, 0x4B, 0xB0, 0x29, 0xD2, 0x49, 0x48, 0x09, 0xFE, 0x9C, 0xB8, 0xD2,
+    0x90, 0x16, 0x82, 0x34, 0x41, 0x7C, 0x34, 0x40, 0xF2, 0x8D, 0xF6, 0xC0, 0x0F, 0xA6, 0x9C, 0x5C,
+    0x86, 0x68, 0x8E, 0x0E, 0x25, 0x33, 0x07, 0x22, 0xA6, 0xCD, 0x75, 0x3D, 0x4C, 0xF1, 0x38, 0x4D,
+    0xD7, 0x23, 0x72, 0x91, 0x1C, 0x89, 0x46, 0x44, 0x83, 0xD5, 0x07, 0x61, 0x3D, 0xC8, 0x2E, 0x44,
+    0x68, 0x55, 0xC6, 0x2A, 0x7E, 0x68, 0xF8, 0xF7, 0xAD, 0xFF, 0x53, 0xC2, 0x19, 0xB4, 0xB8, 0x89,
+    0xD5, 0x59, 0x1C, 0xFA, 0x28, 0x57, 0x27, 0x69, 0xA0, 0xDB, 0xA8, 0x12, 0xDB, 0x4B, 0x44, 0xDD,
+    0xEF, 0xB6, 0x5F, 0x07, 0x65, 0x0D, 0x85, 0x60, 0x19, 0xFD, 0x4A, 0x64, 0x1E, 0x4A, 0x09, 0xD5,
+    0xF5, 0x6B, 0xC1, 0x09, 0xBC, 0x87, 0x36, 0xCD, 0x31, 0xE9, 0xEF, 0xAD, 0x45, 0x6F, 0x99, 0x99,
+    0xA4, 0xBB, 0x73, 0x90, 0x91, 0x42, 0x4A, 0x07, 0x7E, 0x32, 0x24, 0x56, 0x04, 0xF3, 0x80, 0x24,
+    0xC8, 0x85, 0x01, 0x64, 0x42, 0xB6, 0x40, 0xD7, 0xBA, 0x73, 0x20, 0x35, 0xEB, 0x88, 0x9C, 0xCA,
+    0xF4, 0xE0, 0x69, 0x51, 0xAC, 0xE4, 0xA5, 0x12, 0xDA, 0x8B, 0xE2, 0x81, 0x1E, 0x1F, 0x47, 0x27,
+    0x8D, 0x35, 0x59, 0xE9, 0x4E, 0x1D, 0xDC, 0x04, 0xA7, 0x4F, 0xC1, 0x2F, 0xE4, 0x5B, 0xA9, 0xBC,
+    0x3C, 0xB8, 0x4D, 0xA5, 0x4E, 0x8D, 0x71, 0xA6, 0x67, 0x2B, 0x42, 0xA8, 0x0F, 0x1D, 0xDF, 0x25,
+    0x51, 0xA0, 0x14, 0x06, 0x84, 0xFF, 0xFA, 0x89, 0x08, 0xE6, 0x17, 0x5C, 0x90, 0x24, 0x46, 0x91,
+    0x65, 0x60, 0x06, 0x98, 0x0F, 0x10, 0x21, 0xF5, 0xC9, 0xE0, 0x79, 0x61, 0x09, 0x7F, 0x41, 0x93,
+    0x67, 0xCE, 0x61, 0x82, 0x84, 0x26, 0x72, 0x66, 0xF1, 0xEE, 0xA0, 0x12, 0x4B, 0x5E, 0x3A, 0x43,
+    0x81, 0xFC, 0xDB, 0xD6, 0x1B, 0x7D, 0x9E, 0x02, 0x5D, 0x93, 0x9E, 0x20, 0xA7, 0x21, 0x7B, 0x95,
+    0x8A, 0x14, 0xE7, 0x84, 0x22, 0xEC, 0x66, 0x47, 0x18, 0xC9, 0x4C, 0x0A, 0x5B, 0x8A, 0xF4, 0x24,
+    0x4C, 0x97, 0xDF, 0xDF, 0x96, 0x2A, 0xF3, 0x17, 0x1C, 0x09, 0x32, 0x1B, 0x06, 0x8F, 0xF0, 0x1C,
+    0x8E, 0xFC, 0x52, 0xE6, 0x47, 0x80, 0x44, 0x96, 0x69, 0x63, 0x82, 0x6E, 0x51, 0xFB, 0xD5, 0x5A,
+    0x89, 0xAF, 0x9C, 0xD7, 0x95, 0x76, 0x55, 0xDC, 0x16, 0xCF, 0x9D, 0xCD, 0xBA, 0x93, 0x47, 0xDF,
+    0x3C, 0x45, 0x2D, 0x39, 0x4A, 0x9A, 0x12, 0x17, 0xD1, 0x37, 0x34, 0xBF, 0x7F, 0xD3, 0x8C, 0x67,
+    0xE1, 0x3B, 0x44, 0x7F, 0xC1, 0xC6, 0x38, 0x91, 0xCD, 0xE9, 0x2B, 0xC1, 0x1D, 0xB9, 0x8B, 0x4B,
+    0xE8, 0x5D, 0x64, 0xE9, 0xFD, 0xC1, 0x97, 0x24, 0xB2, 0x87, 0x77, 0x9F, 0x57, 0x98, 0x6E, 0xE1,
+    0x0F, 0x8D, 0x9F, 0xFB, 0x5A, 0x69, 0x80, 0xED, 0x21, 0xBA, 0x8D, 0x29, 0xA9, 0x1A, 0x24, 0x7E,
+    0x11, 0x0E, 0x4E, 0xAF, 0x97, 0xBD, 0xEE, 0x6F, 0xEF, 0xAF, 0xAF, 0x5F, 0xF1, 0xDE, 0x4C, 0xAF,
+    0xAF, 0x35, 0x7D, 0xAF, 0xFF, 0x9F, 0xF5, 0x1F, 0xBE, 0xF0, 0xDE, 0xF7, 0xE1, 0xDE, 0x78, 0xC0,
+    0xE2, 0x19, 0xB2, 0xE3, 0x92, 0xC0, 0xEC, 0x04, 0xCB, 0x5B, 0xE1, 0x77, 0x8C, 0xF2, 0x8C, 0x0A,
+    0x35, 0x3B, 0x06, 0x7D, 0x8D, 0x66, 0x7E, 0x8E, 0x7E, 0x17, 0x8F, 0x91, 0xF9, 0x1A, 0x6D, 0x55,
+    0x41, 0x68, 0x1C, 0x55, 0x18, 0xFE, 0x66, 0x9E, 0x9B, 0x49, 0x76, 0x76, 0x33, 0x39, 0xA4, 0x34,
+    0xDA, 0x4D, 0x26, 0x87, 0x56, 0xD6, 0x74, 0x9B, 0x5D, 0x64, 0x85, 0x45, 0x27, 0xD9, 0xD7, 0x06,
+    0x8C, 0x55, 0x41, 0xC5, 0x16, 0xAF, 0xB5, 0x48, 0x29, 0x08, 0x1A, 0xA1, 0x87, 0x1C, 0xA2, 0x99,
+    0xA4, 0x22, 0xDA, 0x16, 0xBA, 0x94, 0x5E, 0xF4, 0x94, 0x43, 0x0F, 0x36, 0x82, 0xEC, 0xA1, 0x42,
+    0x0E, 0x69, 0xF3, 0x62, 0xF1, 0x20, 0x7A, 0x18, 0xD1, 0x1E, 0x04, 0x91, 0x49, 0x2D, 0x08, 0x16,
+    0xDA, 0x31, 0x6C, 0xE9, 0xDA, 0xEE, 0xE6, 0xF9, 0xBD, 0xDD, 0x34, 0x54, 0x70, 0xD8, 0xEC, 0xBE,
+    0xBC, 0xF7, 0xBF, 0xF7, 0xBE, 0xFF, 0xFB, 0xBF, 0xFF, 0x9B, 0xF4, 0xF2, 0xF2, 0x05, 0xAD, 0x5B,
+    0xE8, 0x3E, 0xF3, 0x5A, 0xBF, 0xBC, 0xBC, 0xBC, 0x34, 0x28, 0xE2, 0x22, 0x1A, 0xAE, 0xCA, 0xBB,
+    0xAA, 0xE9, 0x8B, 0xF8, 0x24, 0x2C, 0xD9, 0xF2, 0x0F, 0x25, 0x13, 0x3D, 0xE1, 0xCE, 0xCA, 0xE0,
+    0xA0, 0xF8, 0x23, 0x2E, 0x72, 0x9C, 0xB8, 0x3F, 0xA8, 0x7C, 0xDE, 0x3A, 0x28, 0x57, 0x5B, 0xDE,
+    0xF9, 0x83, 0x7F, 0x27, 0x13, 0x13, 0x3D, 0x9F, 0x84, 0x3B, 0xF1, 0x93, 0x93, 0xF6, 0x66, 0xE2,
+    0xBD, 0x26, 0x57, 0x57, 0xED, 0x0B, 0x35, 0x94, 0x91, 0x85, 0x03, 0x5B, 0x21, 0x42, 0x09, 0xC3,
+    0x6F, 0xE8, 0xF6, 0x9B, 0x21, 0x14, 0x66, 0x90, 0xE7, 0xBC, 0x80, 0xA5, 0xB0, 0xC4, 0x90, 0x0C,
+    0x43, 0xAC, 0x10, 0x03, 0x1D, 0x40, 0x76, 0xC8, 0x25, 0x06, 0x73, 0x2D, 0x0D, 0x2E, 0xE2, 0x06,
+    0xF4, 0x96, 0x55, 0x01, 0x4F, 0x10, 0x40, 0x0E, 0xDC, 0xB1, 0xFB, 0xA2, 0xD0, 0x31, 0x0F, 0xE9,
+    0x86, 0xCE, 0x98, 0x50, 0xBB, 0x9B, 0xCD, 0xAE, 0x23, 0x5C, 0xF1, 0x75, 0xA8, 0xDB, 0x42, 0x37,
+    0x8A, 0x5A, 0x69, 0xED, 0xEA, 0x56, 0x55, 0x6F, 0x6A, 0xCD, 0x50, 0xE7, 0x66, 0x73, 0x09, 0x48,
+    0x8F, 0x4C, 0x9A, 0x0F, 0x96, 0x86, 0x46, 0xEC, 0x38, 0x98, 0x14, 0xD1, 0xEA, 0xBE, 0x88, 0x3B,
+    0xC3, 0x14, 0x4A, 0xF6, 0x40, 0x1F, 0x9E, 0xB6, 0x43, 0x31, 0x3A, 0x83, 0x80, 0x17, 0xF1, 0x3A,
+    0x5E, 0x0A, 0x5E, 0x4D, 0x20, 0xF6, 0x77, 0xC0, 0x07, 0x47, 0xE5, 0xF0, 0xBE, 0x8B, 0x62, 0xF1,
+    0x4C, 0xE7, 0xAE, 0x1D, 0xA6, 0xFE, 0x4B, 0x04, 0x57, 0x86, 0xB2, 0xD9, 0x20, 0x37, 0x5C, 0xAE,
+    0x14, 0x8E, 0x95, 0xCA, 0x26, 0xB2, 0x54, 0xCE, 0x67, 0xF8, 0x93, 0x9F, 0x09, 0x4E, 0xE5, 0x2A,
+    0x7D, 0x39, 0x6C, 0xCF, 0x31, 0x20, 0x5F, 0xC8, 0x64, 0x32, 0x7D, 0x26, 0x6B, 0xB5, 0x7F, 0x7A,
+    0x5A, 0x62, 0x60, 0xD8, 0x15, 0xE1, 0x9C, 0x1D, 0x7B, 0x18, 0x90, 0x8E, 0xEC, 0x47, 0x41, 0x44,
+    0x4D, 0x0F, 0xB2, 0x4B, 0x0B, 0x26, 0x10, 0x34, 0x61, 0x27, 0x6E, 0x1B, 0xF0, 0x42, 0x9F, 0xB3,
+    0x2D, 0x4F, 0x01, 0xCE, 0xFD, 0x04, 0xE8, 0x99, 0x6F, 0xA1, 0x86, 0x7B, 0x5B, 0x18, 0x87, 0xFF,
+    0x7E, 0x24, 0x22, 0x78, 0x1A, 0x66, 0xA9, 0xC1, 0x9D, 0xAD, 0x22, 0xA3, 0x34, 0xB6, 0x80, 0x6A,
+    0xE8, 0x27, 0xF0, 0x63, 0xA1, 0x0D, 0xCA, 0x55, 0x03, 0x23, 0x65, 0xCE, 0xB6, 0x0C, 0x83, 0x75,
+    0x26, 0x3A, 0x0C, 0x17, 0x42, 0x59, 0x11, 0xFF, 0x09, 0x30, 0x02, 0x57, 0x42, 0x5A, 0x12, 0x0D,
+    0x5C, 0x45, 0xD5, 0x40, 0x60, 0xCE, 0x14, 0x4C, 0x6C, 0x6F, 0x35, 0xAD, 0x5C, 0x80, 0x42, 0x80,
+    0x4A, 0x05, 0xB3, 0x57, 0xF0, 0x4D, 0x8C, 0x87, 0x8A, 0x17, 0x58, 0x04, 0x17, 0x83, 0x77, 0x0B,
+    0xC5, 0x23, 0x0D, 0x69, 0x3E, 0x50, 0x84, 0xD9, 0x3B, 0x0F, 0x8C, 0x2D, 0xFB, 0x9A, 0x38, 0x4A,
+    0x7D, 0x93, 0x2B, 0x9E, 0x21, 0x1C, 0xBD, 0xC0, 0xE7, 0x21, 0x0E, 0x00, 0xCB, 0x12, 0xA3, 0x3C,
+    0xFC, 0xE3, 0x13, 0x5F, 0xDC, 0xF2, 0xED, 0xE8, 0xF2, 0xAF, 0x47, 0x7A, 0xAD, 0x6D, 0x71, 0x12,
+    0x5C, 0x9E, 0xB9, 0xC1, 0xE0, 0x63, 0x9D, 0x29, 0x14, 0x08, 0xD9, 0x29, 0x4A, 0xBE, 0x83, 0xC5,
+    0xEE, 0x4E, 0x0F, 0x77, 0xA7, 0x3B, 0x8F, 0xB5, 0x26, 0x8B, 0xB1, 0x73, 0x7B, 0xE3, 0x41, 0x2B,
+    0x85, 0x44, 0x06, 0x40, 0x82, 0x82, 0xF9, 0x0A, 0x60, 0x47, 0x98, 0x85, 0xA3, 0x38, 0xF6, 0x09,
+    0xD2, 0x6A, 0xA1, 0x28, 0x9D, 0x18, 0x2D, 0xB8, 0xA1, 0x95, 0xC0, 0x93, 0x84, 0xEE, 0x19, 0xF0,
+    0x4F, 0x50, 0xFA, 0xDD, 0xA3, 0x02, 0x43, 0x40, 0xC0, 0x25, 0x9C, 0xC4, 0x53, 0xDD, 0xA9, 0x3D,
+    0x0D, 0xB8, 0x5F, 0x45, 0x03, 0x35, 0xBF, 0x9F, 0x67, 0x46, 0xE8, 0xCF, 0xC1, 0xFE, 0x59, 0x61,
+    0xB6, 0x02, 0xDF, 0x91, 0xAE, 0x4A, 0x9C, 0xC4, 0xC3, 0x8A, 0x15, 0x7B, 0x72, 0x02, 0x89, 0x50,
+    0x4F, 0x62, 0x90, 0x04, 0x23, 0x6F, 0x71, 0x5C, 0xC5, 0xAA, 0x93, 0x6C, 0x43, 0xB4, 0x59, 0x09,
+    0x71, 0x3B, 0x41, 0x6F, 0x78, 0x80, 0x49, 0x38, 0x52, 0x84, 0x76, 0x44, 0xCE, 0x13, 0xB2, 0x7E,
+    0x85, 0xF7, 0xAD, 0x60, 0x98, 0x4C, 0xBA, 0xA2, 0x49, 0x1E, 0x1B, 0xB0, 0xE2, 0x39, 0xE0, 0xCA,
+    0x38, 0xD1, 0xA4, 0x4D, 0xA1, 0xCC, 0x81, 0x4B, 0xCC, 0x62, 0x05, 0x22, 0x99, 0x80, 0xB5, 0xDD,
+    0xC5, 0xD6, 0xB6, 0x40, 0xD8, 0x5A, 0x40, 0x8C, 0x0E, 0x29, 0x46, 0xB7, 0x07, 0xA8, 0x35, 0x8F,
+    0x2D, 0xD2, 0x73, 0x16, 0x5D, 0x8A, 0x58, 0x99, 0x0E, 0x97, 0x8F, 0x07, 0xA1, 0x50, 0x07, 0xB2,
+    0x64, 0xCA, 0x65, 0x92, 0xCE, 0xA3, 0x20, 0x53, 0x22, 0x03, 0xB8, 0xBE, 0x1D, 0x94, 0xC7, 0x23,
+    0x82, 0xF1, 0xE9, 0xE8, 0xE2, 0x4B, 0xC7, 0xA7, 0x13, 0x26, 0x87, 0xDA, 0x3B, 0xAF, 0xCE, 0x2F,
+    0x86, 0xE9, 0x05, 0x39, 0x6A, 0x5F, 0xB2, 0x5F, 0x89, 0x0D, 0x8A, 0xF0, 0x79, 0x31, 0xF4, 0xF6,
+    0x14, 0x87, 0x63, 0xF2, 0xF5, 0x52, 0x3E, 0xE3, 0xDA, 0x92, 0x3B, 0x06, 0xD7, 0x93, 0xD1, 0x33,
+    0xF9, 0x67, 0x48, 0xED, 0xB9, 0xD1, 0xD3, 0x99, 0x11, 0xB5, 0xF7, 0x23, 0x1E, 0x24, 0x1D, 0xAD,
+    0x8A, 0x8E, 0x4C, 0x86, 0x9D, 0xF0, 0x54, 0x41, 0xA8, 0xC4, 0x73, 0xD4, 0xEC, 0xB8, 0x1D, 0x37,
+    0x48, 0xF8, 0x00, 0x2E, 0xC8, 0x63, 0xC7, 0x9E, 0x1D, 0xCA, 0x7D, 0x9F, 0x16, 0xF6, 0xF5, 0x70,
+    0x4D, 0x79, 0xA1, 0xA9, 0x76, 0x69, 0xB0, 0x57, 0xB8, 0x49, 0x4F, 0x78, 0x18, 0xB5, 0x9C, 0x2B,
+    0xA2, 0x79, 0x99, 0x92, 0x29, 0xC8, 0x15, 0xAC, 0xE7, 0x79, 0x1E, 0x72, 0xA9, 0x85, 0x23, 0x55,
+    0x55, 0x72, 0x90, 0x0E, 0xE5, 0x80, 0x75, 0xC9, 0x9E, 0x26, 0x08, 0xAB, 0x56, 0x1B, 0x9B, 0x3A,
+    0x57, 0xBA, 0x3E, 0x34, 0x8E, 0xB1, 0x70, 0x48, 0x60, 0x26, 0x6B, 0xA9, 0xBD, 0x14, 0xD6, 0x62,
+    0xA6, 0xD6, 0x2C, 0x5D, 0xCF, 0x8D, 0x13, 0xC5, 0x67, 0x83, 0xC7, 0x0F, 0xA7, 0xD5, 0x10, 0x55,
+    0xCA, 0x42, 0x28, 0xCB, 0x58, 0x55, 0x42, 0x6E, 0x2A, 0xF4, 0x9A, 0x7E, 0xF2, 0x41, 0x8D, 0xC5,
+    0x9D, 0xD6, 0x70, 0x0C, 0x73, 0x33, 0x9C, 0x75, 0x24, 0xD9, 0xA9, 0x50, 0x2D, 0x14, 0xCA, 0x8C,
+    0xD1, 0x60, 0xBF, 0xF1, 0xA9, 0xEE, 0xEF, 0x29, 0x1E, 0x62, 0x4C, 0x2A, 0x36, 0xF2, 0x9C, 0x31,
+    0x9C, 0x57, 0xCC, 0xCC, 0xE3, 0x5F, 0x4E, 0xC8, 0xA8, 0xD4, 0x36, 0x9B, 0x82, 0x7B, 0xA8, 0x22,
+    0xE4, 0xC8, 0x71, 0x95, 0xFD, 0xA3, 0x1B, 0xF0, 0x6E, 0x2A, 0x54, 0xAF, 0x4B, 0x3C, 0x3C, 0x0B,
+    0xEB, 0x3E, 0x5D, 0xF2, 0xF7, 0x02, 0x9C, 0xDF, 0xCA, 0x70, 0x9B, 0x75, 0x78, 0xD4, 0x9C, 0xB7,
+    0xB9, 0xCE, 0xE6, 0xD6, 0x70, 0xF5, 0x16, 0xFF, 0xDA, 0xE8, 0xD7, 0x4D, 0x14, 0x68, 0x33, 0x65,
+    0x56, 0xAA, 0xCE, 0xCA, 0xC9, 0x47, 0x9D, 0xD0, 0xD3, 0xE6, 0x7A, 0x24, 0xE8, 0x00, 0x4D, 0xD0,
+    0x16, 0x8C, 0xF4, 0xD9, 0xCA, 0x84, 0x7D, 0xC7, 0x4E, 0xBC, 0x5A, 0xD5, 0x56, 0xA2, 0x59, 0x41,
+    0xF5, 0x61, 0xCB, 0xA6, 0x39, 0xFA, 0xBC, 0x77, 0x7E, 0x0B, 0x3B, 0x0F, 0x33, 0x73, 0xB4, 0xB4,
+    0x6F, 0x15, 0x4C, 0xED, 0x8D, 0x70, 0xAE, 0x7D, 0x09, 0xD3, 0xBE, 0xBC, 0x67, 0xCF, 0x5F, 0x92,
+    0xDE, 0x6A, 0x52, 0xA1, 0x5A, 0xE9, 0x0C, 0xA8, 0x3E, 0xA8, 0x09, 0xDD, 0x71, 0x94, 0x14, 0x7B,
+    0x49, 0x28, 0x91, 0xD8, 0xB1, 0xD5, 0x26, 0x87, 0x6B, 0x72, 0x0E, 0x93, 0x31, 0x0D, 0x69, 0xCE,
+    0x93, 0xEE, 0x79, 0x47, 0x55, 0xB5, 0xD6, 0x2F, 0xDE, 0xDB, 0xFA, 0x47, 0xB6, 0xC6, 0xB9, 0xE0,
+    0xDC, 0x81, 0x2F, 0xB5, 0xF4, 0x54, 0x95, 0x3B, 0x3C, 0x4A, 0xAD, 0x4A, 0x5B, 0x7B, 0x70, 0x8D,
+    0x3D, 0x17, 0x38, 0x7C, 0x3D, 0x59, 0x89, 0x1B, 0x3A, 0xE1, 0x1C, 0xAA, 0x3A, 0x02, 0x33, 0x34,
+    0xE0, 0x69, 0x25, 0x26, 0x15, 0xF6, 0x68, 0x67, 0x48, 0xED, 0x8B, 0x4E, 0x4B, 0x5D, 0x36, 0x4E,
+    0x67, 0xEC, 0x6E, 0x6F, 0xD6, 0x38, 0x76, 0xD9, 0x38, 0x37, 0xC3, 0x73, 0x3E, 0x7C, 0xB5, 0xD6,
+    0xB0, 0x6E, 0x08, 0x2D, 0xFB, 0xE0, 0xDD, 0x65, 0x2A, 0xB3, 0x05, 0x5C, 0xB5, 0xA3, 0x3A, 0xAE,
+    0x7A, 0xD4, 0x78, 0x25, 0xF0, 0x70, 0x62, 0x23, 0x09, 0x84, 0x76, 0x17, 0x12, 0xB7, 0x61, 0x1A,
+    0x68, 0xA9, 0x82, 0xAC, 0x08, 0x2D, 0x55, 0x46, 0x5E, 0x4C, 0x4D, 0x1D, 0xD2, 0x7A, 0x6B, 0xFF,
+    0xDD, 0xBB, 0xE1, 0x73, 0xCD, 0x58, 0xBC, 0xF7, 0x23, 0x5E, 0xF8, 0x5A, 0x89, 0xCD, 0x26, 0xAA,
+    0xBE, 0x14, 0x3F, 0xD1, 0x4F, 0x68, 0x22, 0x0B, 0x14, 0xD8, 0x45, 0xF3, 0x0E, 0x6D, 0x43, 0x16,
+    0xDF, 0x52, 0x75, 0x0F, 0xE5, 0x8A, 0x90, 0xD9, 0xAC, 0xB5, 0x7E, 0x7A, 0x1A, 0xF5, 0x8D, 0x6F,
+    0x55, 0xA5, 0x5C, 0x8F, 0xB3, 0x19, 0x94, 0x1D, 0x07, 0x05, 0x5B, 0xC5, 0x3E, 0xA2, 0xA2, 0x21,
+    0xEA, 0x5D, 0xD3, 0x5C, 0x6C, 0x1F, 0xC2, 0x5D, 0x4B, 0xB0, 0xFB, 0x17, 0xAC, 0x46, 0xF8, 0x33,
+    0xC1, 0x52, 0x80, 0x52, 0x16, 0x79, 0x17, 0xEE, 0xB4, 0xB2, 0xF8, 0x82, 0x2B, 0x5E, 0xC2, 0xAE,
+    0xA3, 0xD2, 0xD3, 0xDB, 0xBE, 0x41, 0xC9, 0xCC, 0x37, 0xF1, 0xA1, 0xF1, 0x25, 0xF4, 0x0F, 0x60,
+    0xAD, 0xDD, 0xF1, 0xD9, 0x0D, 0x8A, 0x21, 0x32, 0x2E, 0x6A, 0xEC, 0x90, 0x91, 0x6B, 0xB4, 0x8E,
+    0x36, 0x76, 0xF4, 0xF5, 0x3F, 0xCF, 0xBF, 0x4D, 0x54, 0xCF, 0x6F, 0x1B, 0x45, 0x14, 0xFE, 0x66,
+    0xA7, 0xC9, 0x34, 0x5E, 0x3B, 0x5B, 0x09, 0x57, 0x2A, 0xCA, 0x8F, 0x4D, 0xA5, 0x1C, 0x42, 0xB1,
+    0x6B, 0x17, 0x19, 0xE1, 0x43, 0x52, 0x6F, 0xE1, 0x8C, 0xF0, 0x11, 0x71, 0x2A, 0x17, 0x84, 0x8A,
+    0x50, 0x7D, 0x28, 0x52, 0x0F, 0x04, 0xAF, 0xD4, 0x1B, 0x3D, 0x60, 0xF1, 0x43, 0x5C, 0x38, 0xF8,
+    0x58, 0xA5, 0x87, 0xE4, 0x90, 0x43, 0x0E, 0x69, 0x3D, 0x6A, 0xD4, 0xF6, 0x52, 0xA1, 0x81, 0xF2,
+    0x07, 0x2C, 0x22, 0xA2, 0x6A, 0x01, 0x69, 0x23, 0x72, 0x70, 0x82, 0xED, 0xE1, 0x9B, 0xB5, 0x53,
+    0x98, 0xE4, 0xC9, 0x3B, 0x33, 0xEF, 0xD7, 0x7C, 0xEF, 0x7B, 0xAF, 0x62, 0xED, 0x9E, 0xB5, 0x7D,
+    0x2C, 0x02, 0x9E, 0x01, 0x1A, 0x06, 0x73, 0xFB, 0xF0, 0xFB, 0xC0, 0x7B, 0x7D, 0x78, 0x43, 0x08,
+    0x0B, 0xBC, 0x92, 0x00, 0x6B, 0x80, 0xD2, 0xC0, 0x00, 0x54, 0x19, 0x02, 0xC1, 0xDD, 0x04, 0x2A,
+    0x5A, 0xC5, 0xEB, 0x2F, 0x36, 0xEF, 0xE4, 0x8E, 0xEF, 0x3E, 0xC7, 0x4D, 0xDE, 0x56, 0xAC, 0x41,
+    0x60, 0x3B, 0x99, 0xA2, 0x97, 0x52, 0x93, 0x5E, 0x9C, 0x21, 0x2A, 0x94, 0x80, 0x87, 0xD2, 0x1D,
+    0x8E, 0x17, 0x77, 0xE7, 0xE8, 0xF2, 0x17, 0x84, 0x36, 0x0D, 0x9E, 0x09, 0x2F, 0x6D, 0x61, 0x3D,
+    0x07, 0x5F, 0x1B, 0x1C, 0xE6, 0x11, 0xC2, 0x88, 0x34, 0x1C, 0x5D, 0xF4, 0xBE, 0xFF, 0x3B, 0xAD,
+    0xD5, 0x1A, 0xB7, 0xC2, 0xB7, 0x2D, 0xB5, 0xAC, 0x45, 0x65, 0x14, 0x21, 0x3F, 0xB6, 0x76, 0x4B,
+    0xD9, 0x98, 0xCE, 0xAD, 0xDB, 0x5D, 0xC7, 0x24, 0x16, 0xB6, 0x28, 0x52, 0x33, 0x11, 0x6B, 0xA3,
+    0x6B, 0x1B, 0x1B, 0x77, 0x32, 0xCD, 0x0A, 0x77, 0x57, 0x2C, 0x77, 0xEA, 0xE8, 0x6C, 0xCC, 0x98,
+    0x36, 0x72, 0x47, 0xC0, 0x9C, 0xDD, 0x7F, 0x99, 0x92, 0xA4, 0x5F, 0x6F, 0xA0, 0x8E, 0xE5, 0x13,
+    0xF1, 0x14, 0x07, 0x71, 0xBD, 0x33, 0x5B, 0x95, 0x7F, 0xC2, 0x26, 0xFE, 0x00, 0x31, 0xA4, 0xC3,
+    0x68, 0xB2, 0x68, 0xA9, 0x2F, 0x6C, 0x5E, 0x8B, 0x1C, 0x66, 0x58, 0x9D, 0xC8, 0x0E, 0xE5, 0x10,
+    0x10, 0xE9, 0xF8, 0xED, 0x92, 0x98, 0x29, 0xE2, 0xE9, 0x8F, 0x53, 0xED, 0x59, 0xAC, 0x40, 0xE8,
+    0xD0, 0x6A, 0x1F, 0x8D, 0x8E, 0x24, 0xB4, 0x1A, 0x65, 0x48, 0xC3, 0x94, 0x9D, 0x16, 0x50, 0x80,
+    0x78, 0x14, 0x55, 0xD2, 0xD0, 0xC8, 0xED, 0xA6, 0x1A, 0x10, 0xF8, 0x91, 0xA7, 0x4D, 0xBA, 0xB8,
+    0xE3, 0x8D, 0xA3, 0x4E, 0x03, 0x39, 0xB8, 0x78, 0xD6, 0xC8, 0x51, 0xE2, 0x7F, 0x9C, 0x06, 0xB5,
+    0x6E, 0xA1, 0x6A, 0xE6, 0xAB, 0x7A, 0xE5, 0x43, 0x5D, 0xFB, 0x3A, 0xAE, 0xEE, 0x45, 0xAD, 0xC7,
+    0x8C, 0x4A, 0xF4, 0xE5, 0x8B, 0x7E, 0x56, 0x9A, 0x00, 0x4E, 0xEA, 0x58, 0x14, 0xA9, 0x6F, 0xAD,
+    0x09, 0xEC, 0x28, 0x9A, 0xDA, 0x05, 0x2E, 0x8C, 0xBA, 0x68, 0xDB, 0x14, 0xE2, 0x70, 0x92, 0xE8,
+    0x44, 0xD0, 0x74, 0x00, 0xD4, 0x98, 0xD8, 0x42, 0xE1, 0x7A, 0x62, 0x3B, 0x2C, 0x22, 0xFF, 0x09,
+    0xA4, 0x1C, 0x3F, 0x7A, 0x0A, 0x18, 0x62, 0xF1, 0x2F, 0xEF, 0x71, 0xA9, 0xBE, 0x52, 0x87, 0x81,
+    0x02, 0x5F, 0xC4, 0x5F, 0x77, 0xBD, 0x04, 0x74, 0xF9, 0xFD, 0x1A, 0xF4, 0xF5, 0xDF, 0xB5, 0xE8,
+    0x11, 0x60, 0x88, 0xC4, 0x65, 0xDB, 0x75, 0x96, 0x22, 0xF3, 0x51, 0xC8, 0xF4, 0x5B, 0x30, 0xDA,
+    0xFC, 0xF6, 0x15, 0x7A, 0x29, 0xDA, 0xC0, 0xF2, 0xD8, 0xF5, 0x32, 0xEF, 0xA7, 0x1D, 0x1F, 0xF4,
+    0x47, 0x51, 0xE7, 0xC2, 0xD1, 0xDC, 0x33, 0xB5, 0x0F, 0xB1, 0x5B, 0x27, 0x80, 0x51, 0x02, 0x61,
+    0xBC, 0x2C, 0xC0, 0x12, 0x0D, 0x36, 0x92, 0xA7, 0xEF, 0xB2, 0xF6, 0x57, 0x69, 0x91, 0x87, 0xE7,
+    0x68, 0xB0, 0xEC, 0x0C, 0xF5, 0x42, 0xB5, 0xF3, 0x62, 0x4B, 0xA5, 0xA8, 0x02, 0x9F, 0xA8, 0xE3,
+    0xE8, 0x0B, 0xA8, 0x35, 0xB4, 0xD6, 0x15, 0x76, 0xAB, 0xE8, 0xA8, 0x6F, 0x31, 0xD5, 0xD3, 0x34,
+    0xF6, 0x7F, 0xF0, 0x92, 0xD6, 0xBA, 0x78, 0x10, 0x29, 0xFA, 0xAA, 0xA1, 0x34, 0x53, 0xC8, 0xFB,
+    0x79, 0xF9, 0xBE, 0xB7, 0x8F, 0xD4, 0xA6, 0x53, 0x5D, 0x14, 0x51, 0x8F, 0x5B, 0x9D, 0xE4, 0xAA,
+    0x7E, 0x23, 0x7E, 0x0B, 0x17, 0x11, 0x0E, 0x73, 0x4D, 0xE6, 0xC6, 0x3A, 0xF1, 0x91, 0xCC, 0x1B,
+    0x0D, 0x3B, 0x2C, 0x11, 0xAA, 0xD8, 0x7D, 0x0D, 0x88, 0x8B, 0xAB, 0xBA, 0xA0, 0xC6, 0xA9, 0x08,
+    0x85, 0x15, 0x84, 0x41, 0x54, 0xDE, 0xBB, 0x51, 0x3E, 0x7F, 0xBB, 0x54, 0xEC, 0x98, 0xD3, 0x55,
+    0xC8, 0x79, 0x88, 0x2F, 0x81, 0x6F, 0x80, 0xAA, 0x46, 0xFE, 0x2A, 0xF5, 0xCE, 0x00, 0xB4, 0x27,
+    0x6C, 0x48, 0xE8, 0x20, 0xF3, 0xEC, 0xFD, 0x4C, 0x26, 0x39, 0x8C, 0xBD, 0x8C, 0x25, 0xDE, 0x69,
+    0xE0, 0x16, 0x50, 0xEC, 0xC0, 0x63, 0x6F, 0xEC, 0xF1, 0xCD, 0x3A, 0x37, 0xBD, 0xBC, 0x9C, 0x3E,
+    0x5A, 0xF0, 0x5B, 0x3F, 0x62, 0xBD, 0x01, 0x75, 0x1B, 0x38, 0x7F, 0xC2, 0xC2, 0x33, 0x34, 0x2A,
+    0x65, 0x85, 0x68, 0x65, 0x2E, 0xED, 0xC0, 0xA5, 0xB7, 0x17, 0xB3, 0x8D, 0xB9, 0xD1, 0x92, 0x7F,
+    0x58, 0xA5, 0x8E, 0xCB, 0x91, 0x85, 0x50, 0x87, 0x78, 0x73, 0x24, 0x1F, 0xAE, 0x34, 0x8A, 0xE2,
+    0x49, 0x13, 0x97, 0x22, 0x3C, 0x84, 0x2C, 0x22, 0xDF, 0x54, 0x97, 0xA2, 0xE0, 0x21, 0x82, 0x62,
+    0xB7, 0xD0, 0x8E, 0x43, 0xE3, 0x6A, 0xE4, 0x96, 0x1F, 0x67, 0x8D, 0x34, 0xEF, 0x68, 0x27, 0x64,
+    0x14, 0x1E, 0xE8, 0xC5, 0x9C, 0x99, 0x45, 0xAA, 0x50, 0xF7, 0xF4, 0x3C, 0x76, 0x3E, 0x45, 0x38,
+    0x82, 0x18, 0xBE, 0xEC, 0x88, 0xC3, 0x2E, 0xEE, 0x6F, 0xA6, 0x18, 0x90, 0x55, 0xBB, 0x18, 0xE1,
+    0x73, 0xFC, 0xA1, 0xCB, 0xF8, 0x35, 0x09, 0x90, 0xDC, 0x54, 0x71, 0x52, 0xF6, 0x0C, 0x3F, 0xB7,
+    0x13, 0x3F, 0x6E, 0x24, 0xBE, 0xF1, 0x8F, 0x37, 0x13, 0x8F, 0x0D, 0x2D, 0x9C, 0xFC, 0x44, 0xC6,
+    0xFE, 0xB7, 0xD8, 0xC0, 0x95, 0x18, 0x8B, 0x09, 0x02, 0x72, 0x37, 0x80, 0xFF, 0x8E, 0x51, 0xF1,
+    0x8E, 0xD4, 0xA1, 0x34, 0xEA, 0x41, 0x82, 0x83, 0xE3, 0x8D, 0x7B, 0x3D, 0x76, 0x2D, 0xE9, 0x8C,
+    0xED, 0x32, 0x56, 0x7D, 0xCC, 0xCA, 0x58, 0x45, 0xC6, 0xD3, 0x2D, 0xA4, 0x25, 0xD4, 0x67, 0xB1,
+    0x20, 0x23, 0x5F, 0xF0, 0xE1, 0x5B, 0x48, 0xEA, 0x58, 0xCE, 0x21, 0xF0, 0xB4, 0xBB, 0xBC, 0x31,
+    0x4B, 0x4D, 0x7E, 0x6D, 0xA1, 0xB5, 0x80, 0x82, 0x8C, 0x65, 0x9C, 0x62, 0xAB, 0x84, 0xB2, 0x8A,
+    0x2A, 0x76, 0xE0, 0xD9, 0x3E, 0x5B, 0x2B, 0x9F, 0x3D, 0x96, 0x84, 0xAC, 0x42, 0xC4, 0x44, 0x81,
+    0x75, 0xBE, 0xC1, 0xF9, 0x92, 0x56, 0xDC, 0x88, 0x01, 0xCE, 0x36, 0x46, 0xEE, 0x27, 0x18, 0x66,
+    0x45, 0xE4, 0x15, 0x21, 0x1F, 0x93, 0x43, 0xF1, 0x3E, 0xE0, 0xF6, 0xE2, 0x78, 0x0E, 0x34, 0xD9,
+    0x56, 0x07, 0x6C, 0xA7, 0x1E, 0x49, 0xD3, 0xE6, 0x75, 0x23, 0xA2, 0xDA, 0x30, 0x8C, 0x2F, 0xDF,
+    0xFB, 0xE7, 0x8A, 0x5E, 0x9B, 0x2E, 0x20, 0x39, 0x57, 0x95, 0x91, 0x31, 0xED, 0x4D, 0x69, 0x37,
+    0x53, 0xD5, 0xBF, 0x9C, 0xA1, 0x6D, 0xC6, 0x7E, 0x9C, 0xCF, 0xCC, 0xBF, 0x63, 0x59, 0x16, 0xC4,
+    0x79, 0x16, 0xE6, 0xFF, 0xA7, 0xDB, 0x27, 0xA7, 0xC9, 0x64, 0xF0, 0x38, 0xC3, 0x2B, 0x8C, 0xD8,
+    0x1E, 0xB9, 0xFE, 0x67, 0xC8, 0x5C, 0x86, 0x68, 0xEA, 0xEB, 0xC6, 0xC9, 0x60, 0xD3, 0x95, 0x6C,
+    0x70, 0xC3, 0xEB, 0xCF, 0x04, 0x85, 0xF9, 0x19, 0x79, 0x98, 0xC5, 0x5C, 0x5A, 0xAD, 0x6D, 0x2D,
+    0x85, 0x93, 0x51, 0x1A, 0x65, 0x8F, 0x9F, 0xA1, 0x0E, 0xDD, 0x7D, 0xC6, 0x11, 0x37, 0x10, 0x8E,
+    0xAA, 0x0C, 0x5D, 0x2F, 0xB2, 0x50, 0xC6, 0x3D, 0x95, 0x3C, 0x5B, 0x98, 0x64, 0x71, 0xB2, 0xC8,
+    0x13, 0x8F, 0xAE, 0x7B, 0x1C, 0xA7, 0x06, 0x82, 0xB3, 0x4A, 0x72, 0x42, 0xA3, 0x77, 0xC4, 0x89,
+    0xC5, 0xE9, 0x8A, 0x57, 0x1D, 0xEB, 0x61, 0x9F, 0x37, 0x21, 0xAE, 0x65, 0xB3, 0xDF, 0x25, 0x5B,
+    0x99, 0x48, 0x83, 0xD2, 0x86, 0xE8, 0x99, 0x39, 0xDB, 0x09, 0x68, 0x91, 0x4D, 0xE2, 0x53, 0xF8,
+    0xC0, 0x26, 0xF7, 0xBF, 0x03, 0xFE, 0x05,
+};
+
+static const uint32_t opendyslexic_8_italicBlockOffsets[16] = {
+    0, 1345, 2707, 3785, 4831, 5799, 6922, 7937,
+    9048, 10326, 11730, 13148, 14493, 15774, 17191, 18327,
+};
+
+static const uint16_t opendyslexic_8_italicDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_8_italicGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_8_italicPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
@@ -1942,682 +1341,682 @@ static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 17, 15, 16, 0, 15, 64, 1861 }, // N
     { 16, 16, 17, 1, 15, 64, 1925 }, // O
     { 14, 15, 13, 0, 15, 53, 1989 }, // P
-    { 16, 18, 18, 1, 15, 72, 2042 }, // Q
-    { 13, 14, 14, 0, 14, 46, 2114 }, // R
-    { 15, 16, 16, 0, 15, 60, 2160 }, // S
-    { 14, 14, 16, 3, 14, 49, 2220 }, // T
-    { 15, 16, 15, 1, 15, 60, 2269 }, // U
-    { 14, 15, 17, 4, 15, 53, 2329 }, // V
-    { 19, 14, 21, 3, 14, 67, 2382 }, // W
-    { 17, 15, 17, 0, 15, 64, 2449 }, // X
-    { 12, 14, 15, 4, 14, 42, 2513 }, // Y
-    { 17, 14, 16, 0, 14, 60, 2555 }, // Z
-    { 13, 23, 8, -1, 18, 75, 2615 }, // [
-    { 3, 16, 8, 4, 13, 12, 2690 }, // <backslash>
-    { 12, 23, 8, -4, 18, 69, 2702 }, // ]
-    { 7, 4, 9, 3, 15, 7, 2771 }, // ^
-    { 12, 3, 13, 0, -1, 9, 2778 }, // _
-    { 5, 3, 7, 4, 13, 4, 2787 }, // `
-    { 11, 11, 13, 0, 11, 31, 2791 }, // a
-    { 10, 16, 13, 2, 15, 40, 2822 }, // b
-    { 9, 12, 11, 1, 11, 27, 2862 }, // c
-    { 13, 16, 13, 1, 15, 52, 2889 }, // d
-    { 11, 10, 13, 1, 10, 28, 2941 }, // e
-    { 9, 14, 9, 1, 14, 32, 2969 }, // f
-    { 12, 15, 12, 0, 10, 45, 3001 }, // g
-    { 12, 15, 13, 0, 15, 45, 3046 }, // h
-    { 7, 15, 6, 0, 15, 27, 3091 }, // i
-    { 11, 20, 11, 1, 15, 55, 3118 }, // j
-    { 10, 14, 13, 0, 14, 35, 3173 }, // k
-    { 7, 14, 8, 0, 14, 25, 3208 }, // l
-    { 17, 10, 18, 0, 10, 43, 3233 }, // m
-    { 11, 10, 12, 0, 10, 28, 3276 }, // n
-    { 11, 10, 13, 1, 10, 28, 3304 }, // o
-    { 14, 15, 14, -1, 10, 53, 3332 }, // p
-    { 12, 14, 15, 1, 10, 42, 3385 }, // q
-    { 9, 10, 10, 0, 10, 23, 3427 }, // r
-    { 11, 10, 12, 0, 10, 28, 3450 }, // s
-    { 8, 13, 11, 2, 13, 26, 3478 }, // t
-    { 11, 10, 12, 1, 10, 28, 3504 }, // u
-    { 11, 10, 14, 3, 10, 28, 3532 }, // v
-    { 13, 10, 16, 3, 10, 33, 3560 }, // w
-    { 13, 10, 14, 0, 10, 33, 3593 }, // x
-    { 13, 15, 13, 0, 10, 49, 3626 }, // y
-    { 12, 10, 13, 0, 10, 30, 3675 }, // z
-    { 10, 16, 9, 2, 13, 40, 3705 }, // {
-    { 7, 15, 4, 0, 12, 27, 3745 }, // |
-    { 9, 16, 11, 0, 13, 36, 3772 }, // }
-    { 7, 4, 10, 3, 13, 7, 3808 }, // ~
-    { 0, 0, 14, 0, 0, 0, 3815 }, //  
-    { 7, 18, 7, 1, 13, 32, 3815 }, // ¡
-    { 9, 16, 11, 1, 14, 36, 3847 }, // ¢
-    { 14, 16, 12, 0, 16, 56, 3883 }, // £
-    { 10, 8, 11, 2, 10, 20, 3939 }, // ¤
-    { 13, 15, 13, 2, 13, 49, 3959 }, // ¥
-    { 7, 15, 4, 0, 12, 27, 4008 }, // ¦
-    { 14, 15, 14, 0, 13, 53, 4035 }, // §
-    { 9, 3, 9, 3, 13, 7, 4088 }, // ¨
-    { 8, 7, 9, 4, 16, 14, 4095 }, // ©
-    { 7, 6, 7, 2, 13, 11, 4109 }, // ª
-    { 12, 8, 14, 1, 8, 24, 4120 }, // «
-    { 9, 5, 10, 2, 6, 12, 4144 }, // ¬
-    { 9, 2, 9, 2, 6, 5, 4156 }, // ­
-    { 8, 7, 9, 4, 18, 14, 4161 }, // ®
-    { 7, 3, 9, 4, 13, 6, 4175 }, // ¯
-    { 9, 8, 9, 2, 14, 18, 4181 }, // °
-    { 11, 10, 12, 0, 9, 28, 4199 }, // ±
-    { 5, 7, 5, 2, 14, 9, 4227 }, // ²
-    { 6, 7, 5, 2, 14, 11, 4236 }, // ³
-    { 5, 4, 5, 3, 13, 5, 4247 }, // ´
-    { 13, 12, 12, -1, 10, 39, 4252 }, // µ
-    { 12, 14, 10, 0, 12, 42, 4291 }, // ¶
-    { 5, 3, 4, 1, 7, 4, 4333 }, // ·
-    { 5, 5, 5, 0, 1, 7, 4337 }, // ¸
-    { 4, 7, 5, 2, 14, 7, 4344 }, // ¹
-    { 6, 6, 7, 3, 12, 9, 4351 }, // º
-    { 11, 8, 11, -2, 8, 22, 4360 }, // »
-    { 14, 16, 18, 4, 15, 56, 4382 }, // ¼
-    { 15, 15, 18, 4, 14, 57, 4438 }, // ½
-    { 15, 15, 18, 3, 14, 57, 4495 }, // ¾
-    { 11, 19, 10, -1, 10, 53, 4552 }, // ¿
-    { 14, 19, 17, 0, 19, 67, 4605 }, // À
-    { 15, 22, 17, 0, 22, 83, 4672 }, // Á
-    { 15, 19, 17, 0, 19, 72, 4755 }, // Â
-    { 15, 19, 17, 0, 19, 72, 4827 }, // Ã
-    { 16, 19, 17, 0, 19, 76, 4899 }, // Ä
-    { 14, 20, 17, 0, 20, 70, 4975 }, // Å
-    { 23, 16, 24, 0, 15, 92, 5045 }, // Æ
-    { 14, 20, 14, 1, 16, 70, 5137 }, // Ç
-    { 14, 19, 13, 0, 19, 67, 5207 }, // È
-    { 14, 22, 13, 0, 22, 77, 5274 }, // É
-    { 14, 18, 13, 0, 18, 63, 5351 }, // Ê
-    { 14, 19, 13, 0, 19, 67, 5414 }, // Ë
-    { 9, 21, 7, 0, 21, 48, 5481 }, // Ì
-    { 10, 24, 7, 0, 24, 60, 5529 }, // Í
-    { 10, 20, 7, 0, 20, 50, 5589 }, // Î
-    { 11, 21, 7, 0, 21, 58, 5639 }, // Ï
-    { 15, 15, 16, 0, 15, 57, 5697 }, // Ð
-    { 17, 18, 16, 0, 18, 77, 5754 }, // Ñ
-    { 16, 21, 17, 1, 20, 84, 5831 }, // Ò
-    { 16, 24, 17, 1, 23, 96, 5915 }, // Ó
-    { 16, 20, 17, 1, 19, 80, 6011 }, // Ô
-    { 16, 21, 17, 1, 20, 84, 6091 }, // Õ
-    { 16, 21, 17, 1, 20, 84, 6175 }, // Ö
-    { 9, 5, 10, 1, 7, 12, 6259 }, // ×
-    { 29, 29, 17, -6, 22, 211, 6271 }, // Ø
-    { 15, 20, 15, 1, 19, 75, 6482 }, // Ù
-    { 15, 23, 15, 1, 22, 87, 6557 }, // Ú
-    { 15, 20, 15, 1, 19, 75, 6644 }, // Û
-    { 15, 20, 15, 1, 19, 75, 6719 }, // Ü
-    { 12, 23, 15, 4, 23, 69, 6794 }, // Ý
-    { 11, 13, 9, 0, 13, 36, 6863 }, // Þ
-    { 12, 13, 11, 1, 13, 39, 6899 }, // ß
-    { 11, 14, 13, 0, 14, 39, 6938 }, // à
-    { 11, 17, 13, 0, 17, 47, 6977 }, // á
-    { 12, 14, 13, 0, 14, 42, 7024 }, // â
-    { 12, 13, 13, 0, 13, 39, 7066 }, // ã
-    { 12, 14, 13, 0, 14, 42, 7105 }, // ä
-    { 11, 15, 13, 0, 15, 42, 7147 }, // å
-    { 18, 11, 20, 0, 11, 50, 7189 }, // æ
-    { 9, 15, 11, 1, 11, 34, 7239 }, // ç
-    { 11, 16, 13, 1, 16, 44, 7273 }, // è
-    { 11, 19, 13, 1, 19, 53, 7317 }, // é
-    { 11, 15, 13, 1, 15, 42, 7370 }, // ê
-    { 12, 16, 13, 1, 16, 48, 7412 }, // ë
-    { 7, 14, 6, 0, 14, 25, 7460 }, // ì
-    { 9, 17, 6, 0, 17, 39, 7485 }, // í
-    { 9, 13, 6, 0, 13, 30, 7524 }, // î
-    { 9, 14, 6, 0, 14, 32, 7554 }, // ï
-    { 15, 14, 14, 1, 14, 53, 7586 }, // ð
-    { 13, 14, 12, 0, 14, 46, 7639 }, // ñ
-    { 11, 16, 13, 1, 16, 44, 7685 }, // ò
-    { 11, 19, 13, 1, 19, 53, 7729 }, // ó
-    { 11, 15, 13, 1, 15, 42, 7782 }, // ô
-    { 11, 16, 13, 1, 16, 44, 7824 }, // õ
-    { 12, 16, 13, 1, 16, 48, 7868 }, // ö
-    { 11, 10, 13, 2, 10, 28, 7916 }, // ÷
-    { 16, 27, 13, -2, 18, 108, 7944 }, // ø
-    { 11, 15, 12, 1, 15, 42, 8052 }, // ù
-    { 11, 18, 12, 1, 18, 50, 8094 }, // ú
-    { 11, 14, 12, 1, 14, 39, 8144 }, // û
-    { 11, 15, 12, 1, 15, 42, 8183 }, // ü
-    { 13, 24, 13, 0, 19, 78, 8225 }, // ý
-    { 11, 18, 9, 0, 14, 50, 8303 }, // þ
-    { 13, 21, 13, 0, 16, 69, 8353 }, // ÿ
-    { 16, 19, 17, 0, 19, 76, 8422 }, // Ā
-    { 12, 13, 13, 0, 13, 39, 8498 }, // ā
-    { 16, 21, 17, 0, 21, 84, 8537 }, // Ă
-    { 12, 15, 13, 0, 15, 45, 8621 }, // ă
-    { 14, 19, 17, 0, 14, 67, 8666 }, // Ą
-    { 11, 15, 13, 0, 11, 42, 8733 }, // ą
-    { 14, 24, 14, 1, 23, 84, 8775 }, // Ć
-    { 10, 17, 11, 1, 16, 43, 8859 }, // ć
-    { 15, 22, 14, 1, 21, 83, 8902 }, // Ĉ
-    { 11, 16, 11, 1, 15, 44, 8985 }, // ĉ
-    { 14, 23, 14, 1, 22, 81, 9029 }, // Ċ
-    { 9, 16, 11, 1, 15, 36, 9110 }, // ċ
-    { 14, 24, 14, 1, 23, 84, 9146 }, // Č
-    { 10, 17, 11, 1, 16, 43, 9230 }, // č
-    { 15, 21, 16, 0, 21, 79, 9273 }, // Ď
-    { 16, 16, 13, 1, 15, 64, 9352 }, // ď
-    { 15, 15, 16, 0, 15, 57, 9416 }, // Đ
-    { 15, 16, 13, 1, 15, 60, 9473 }, // đ
-    { 14, 19, 13, 0, 19, 67, 9533 }, // Ē
-    { 12, 15, 13, 1, 15, 45, 9600 }, // ē
-    { 14, 21, 13, 0, 21, 74, 9645 }, // Ĕ
-    { 12, 17, 13, 1, 17, 51, 9719 }, // ĕ
-    { 14, 20, 13, 0, 20, 70, 9770 }, // Ė
-    { 11, 16, 13, 1, 16, 44, 9840 }, // ė
-    { 14, 19, 13, 0, 15, 67, 9884 }, // Ę
-    { 11, 15, 13, 1, 10, 42, 9951 }, // ę
-    { 14, 21, 13, 0, 21, 74, 9993 }, // Ě
-    { 11, 17, 13, 1, 17, 47, 10067 }, // ě
-    { 15, 19, 17, 1, 19, 72, 10114 }, // Ĝ
-    { 13, 20, 12, 0, 15, 65, 10186 }, // ĝ
-    { 15, 21, 17, 1, 21, 79, 10251 }, // Ğ
-    { 12, 21, 12, 0, 16, 63, 10330 }, // ğ
-    { 14, 20, 17, 1, 20, 70, 10393 }, // Ġ
-    { 12, 20, 12, 0, 15, 60, 10463 }, // ġ
-    { 14, 23, 17, 1, 15, 81, 10523 }, // Ģ
-    { 12, 21, 12, 0, 16, 63, 10604 }, // ģ
-    { 16, 19, 16, 0, 19, 76, 10667 }, // Ĥ
-    { 12, 19, 13, 0, 19, 57, 10743 }, // ĥ
-    { 16, 15, 16, 0, 15, 60, 10800 }, // Ħ
-    { 12, 15, 13, 0, 15, 45, 10860 }, // ħ
-    { 10, 21, 7, 0, 21, 53, 10905 }, // Ĩ
-    { 9, 15, 6, 0, 15, 34, 10958 }, // ĩ
-    { 11, 20, 7, 0, 20, 55, 10992 }, // Ī
-    { 9, 14, 6, 0, 14, 32, 11047 }, // ī
-    { 8, 19, 10, 2, 15, 38, 11079 }, // Į
-    { 8, 19, 6, -1, 15, 38, 11117 }, // į
-    { 9, 21, 7, 0, 21, 48, 11155 }, // İ
-    { 6, 10, 6, 0, 10, 15, 11203 }, // ı
-    { 14, 19, 15, 0, 15, 67, 11218 }, // Ĳ
-    { 16, 20, 6, 0, 15, 80, 11285 }, // ĳ
-    { 14, 23, 10, -1, 19, 81, 11365 }, // Ĵ
-    { 14, 20, 11, 1, 15, 70, 11446 }, // ĵ
-    { 14, 21, 15, 0, 15, 74, 11516 }, // Ķ
-    { 10, 22, 13, 0, 14, 55, 11590 }, // ķ
-    { 8, 9, 9, 0, 9, 18, 11645 }, // ĸ
-    { 11, 20, 13, 0, 20, 55, 11663 }, // Ĺ
-    { 10, 20, 8, 0, 20, 50, 11718 }, // ĺ
-    { 11, 22, 13, 0, 15, 61, 11768 }, // Ļ
-    { 7, 21, 8, 0, 14, 37, 11829 }, // ļ
-    { 12, 15, 13, 0, 15, 45, 11866 }, // Ľ
-    { 11, 14, 8, 0, 14, 39, 11911 }, // ľ
-    { 12, 14, 13, 0, 14, 42, 11950 }, // Ŀ
-    { 10, 14, 8, 0, 14, 35, 11992 }, // ŀ
-    { 23, 21, 13, -8, 17, 121, 12027 }, // Ł
-    { 16, 14, 8, -6, 14, 56, 12148 }, // ł
-    { 17, 20, 16, 0, 20, 85, 12204 }, // Ń
-    { 12, 16, 12, 0, 16, 48, 12289 }, // ń
-    { 17, 21, 16, 0, 15, 90, 12337 }, // Ņ
-    { 11, 16, 12, 0, 10, 44, 12427 }, // ņ
-    { 17, 20, 16, 0, 20, 85, 12471 }, // Ň
-    { 12, 16, 12, 0, 16, 48, 12556 }, // ň
-    { 12, 18, 11, -2, 18, 54, 12604 }, // ŉ
-    { 17, 19, 16, 0, 15, 81, 12658 }, // Ŋ
-    { 11, 14, 12, 0, 10, 39, 12739 }, // ŋ
-    { 16, 20, 17, 1, 19, 80, 12778 }, // Ō
-    { 12, 15, 13, 1, 15, 45, 12858 }, // ō
-    { 16, 22, 17, 1, 21, 88, 12903 }, // Ŏ
-    { 12, 18, 13, 1, 18, 54, 12991 }, // ŏ
-    { 17, 21, 17, 1, 20, 90, 13045 }, // Ő
-    { 14, 17, 13, 1, 17, 60, 13135 }, // ő
-    { 22, 15, 20, 1, 15, 83, 13195 }, // Œ
-    { 18, 11, 18, 1, 11, 50, 13278 }, // œ
-    { 13, 20, 14, 0, 20, 65, 13328 }, // Ŕ
-    { 9, 14, 10, 0, 14, 32, 13393 }, // ŕ
-    { 13, 22, 14, 0, 14, 72, 13425 }, // Ŗ
-    { 10, 19, 10, -1, 10, 48, 13497 }, // ŗ
-    { 13, 20, 14, 0, 20, 65, 13545 }, // Ř
-    { 9, 14, 10, 0, 14, 32, 13610 }, // ř
-    { 15, 22, 16, 0, 21, 83, 13642 }, // Ś
-    { 11, 16, 12, 0, 16, 44, 13725 }, // ś
-    { 16, 21, 16, 0, 20, 84, 13769 }, // Ŝ
-    { 11, 15, 12, 0, 15, 42, 13853 }, // ŝ
-    { 15, 19, 16, 0, 15, 72, 13895 }, // Ş
-    { 11, 14, 12, 0, 10, 39, 13967 }, // ş
-    { 15, 23, 16, 0, 22, 87, 14006 }, // Š
-    { 11, 16, 12, 0, 16, 44, 14093 }, // š
-    { 14, 17, 16, 3, 14, 60, 14137 }, // Ţ
-    { 8, 16, 11, 2, 13, 32, 14197 }, // ţ
-    { 14, 20, 16, 3, 20, 70, 14229 }, // Ť
-    { 10, 14, 11, 2, 14, 35, 14299 }, // ť
-    { 14, 14, 16, 3, 14, 49, 14334 }, // Ŧ
-    { 9, 13, 11, 1, 13, 30, 14383 }, // ŧ
-    { 15, 21, 15, 1, 20, 79, 14413 }, // Ũ
-    { 11, 15, 12, 1, 15, 42, 14492 }, // ũ
-    { 15, 20, 15, 1, 19, 75, 14534 }, // Ū
-    { 11, 14, 12, 1, 14, 39, 14609 }, // ū
-    { 15, 22, 15, 1, 21, 83, 14648 }, // Ŭ
-    { 11, 16, 12, 1, 16, 44, 14731 }, // ŭ
-    { 15, 22, 15, 1, 21, 83, 14775 }, // Ů
-    { 11, 16, 12, 1, 16, 44, 14858 }, // ů
-    { 16, 21, 15, 1, 20, 84, 14902 }, // Ű
-    { 13, 15, 12, 1, 15, 49, 14986 }, // ű
-    { 15, 19, 15, 1, 15, 72, 15035 }, // Ų
-    { 11, 15, 12, 1, 10, 42, 15107 }, // ų
-    { 19, 18, 21, 3, 18, 86, 15149 }, // Ŵ
-    { 13, 14, 16, 3, 14, 46, 15235 }, // ŵ
-    { 12, 19, 15, 4, 19, 57, 15281 }, // Ŷ
-    { 13, 21, 13, 0, 16, 69, 15338 }, // ŷ
-    { 12, 20, 15, 4, 20, 60, 15407 }, // Ÿ
-    { 17, 20, 16, 0, 20, 85, 15467 }, // Ź
-    { 12, 16, 13, 0, 16, 48, 15552 }, // ź
-    { 17, 19, 16, 0, 19, 81, 15600 }, // Ż
-    { 12, 15, 13, 0, 15, 45, 15681 }, // ż
-    { 17, 20, 16, 0, 20, 85, 15726 }, // Ž
-    { 12, 16, 13, 0, 16, 48, 15811 }, // ž
-    { 9, 14, 9, 2, 14, 32, 15859 }, // ſ
-    { 5, 3, 0, 4, 13, 4, 15891 }, // ̀
-    { 5, 4, 0, 3, 13, 5, 15895 }, // ́
-    { 8, 4, 0, -1, 0, 8, 15900 }, // ̂
-    { 7, 4, 0, 3, 13, 7, 15908 }, // ̃
-    { 8, 3, 0, 3, 12, 6, 15915 }, // ̄
-    { 11, 3, 0, 5, 15, 9, 15921 }, // ̅
-    { 8, 4, 0, 3, 13, 8, 15930 }, // ̆
-    { 4, 3, 0, 3, 13, 3, 15938 }, // ̇
-    { 9, 3, 0, 3, 13, 7, 15941 }, // ̈
-    { 4, 4, 0, 3, 11, 4, 15948 }, // ̉
-    { 5, 4, 0, 3, 13, 5, 15952 }, // ̊
-    { 12, 3, 0, 3, 13, 9, 15957 }, // ̋
-    { 8, 4, 0, 3, 13, 8, 15966 }, // ̌
-    { 12, 3, 0, -5, 14, 9, 15974 }, // ̏
-    { 6, 5, 0, 2, 13, 8, 15983 }, // ̒
-    { 6, 5, 0, 2, 12, 8, 15991 }, // ̓
-    { 6, 5, 0, -3, 12, 8, 15999 }, // ̔
-    { 4, 5, 0, 0, 0, 5, 16007 }, // ̘
-    { 4, 5, 0, 1, 0, 5, 16012 }, // ̙
-    { 8, 4, 0, 4, 13, 8, 16017 }, // ̚
-    { 3, 4, 0, 3, 11, 3, 16025 }, // ̛
-    { 3, 3, 0, 0, -1, 3, 16028 }, // ̜
-    { 4, 4, 0, 2, 3, 4, 16031 }, // ̝
-    { 4, 4, 0, 0, 0, 4, 16035 }, // ̞
-    { 4, 4, 0, 0, -1, 4, 16039 }, // ̟
-    { 8, 3, 0, 0, -2, 6, 16043 }, // ̠
-    { 4, 3, 0, 0, 1, 3, 16049 }, // ̣
-    { 9, 3, 0, -1, 0, 7, 16052 }, // ̤
-    { 5, 4, 0, 3, 13, 5, 16059 }, // ̥
-    { 6, 6, 0, 0, 3, 9, 16064 }, // ̦
-    { 5, 5, 0, 0, 1, 7, 16073 }, // ̧
-    { 5, 5, 0, 0, 0, 7, 16080 }, // ̨
-    { 4, 5, 0, -1, -1, 5, 16087 }, // ̩
-    { 6, 3, 0, 0, -1, 5, 16092 }, // ̪
-    { 7, 4, 0, 0, 0, 7, 16097 }, // ̬
-    { 8, 4, 0, -1, 0, 8, 16104 }, // ̭
-    { 7, 4, 0, 3, 13, 7, 16112 }, // ̰
-    { 7, 3, 0, 4, 13, 6, 16119 }, // ̱
-    { 7, 3, 0, 0, -1, 6, 16125 }, // ̲
-    { 7, 4, 0, 3, 13, 7, 16131 }, // ̴
-    { 9, 2, 0, 2, 6, 5, 16138 }, // ̵
-    { 3, 3, 0, 1, -1, 3, 16143 }, // ̹
-    { 6, 4, 0, -1, 0, 6, 16146 }, // ̺
-    { 6, 4, 0, 0, 0, 6, 16152 }, // ̻
-    { 6, 4, 0, 0, 0, 6, 16158 }, // ̼
-    { 5, 4, 0, 3, 13, 5, 16164 }, // ̽
-    { 7, 4, 0, 3, 13, 7, 16169 }, // ͂
-    { 4, 3, 0, 3, 14, 3, 16176 }, // ̓
-    { 9, 8, 0, 3, 18, 18, 16179 }, // ̈́
-    { 6, 3, 0, 4, 13, 5, 16197 }, // ͆
-    { 10, 6, 0, -1, 0, 15, 16202 }, // ͇
-    { 8, 5, 0, 0, 0, 10, 16217 }, // ͈
-    { 6, 5, 0, 0, -1, 8, 16227 }, // ͉
-    { 8, 10, 0, 3, 16, 20, 16235 }, // ͊
-    { 16, 7, 0, 5, 15, 28, 16255 }, // ͋
-    { 12, 9, 0, 3, 9, 27, 16283 }, // ͌
-    { 9, 5, 0, 1, 0, 12, 16310 }, // ͍
-    { 3, 3, 0, 2, 2, 3, 16322 }, // ͎
-    { 14, 3, 0, 1, 0, 11, 16325 }, // ͜
-    { 14, 3, 0, 3, 13, 11, 16336 }, // ͡
-    { 17, 5, 0, 0, -1, 22, 16347 }, // ͢
-    { 12, 17, 11, 1, 17, 51, 16369 }, // Ѐ
-    { 12, 16, 11, 1, 16, 48, 16420 }, // Ё
-    { 12, 14, 17, 5, 14, 42, 16468 }, // Ђ
-    { 12, 20, 11, 1, 20, 60, 16510 }, // Ѓ
-    { 13, 14, 15, 1, 13, 46, 16570 }, // Є
-    { 15, 16, 16, 0, 15, 60, 16616 }, // Ѕ
-    { 8, 15, 7, 0, 15, 30, 16676 }, // І
-    { 11, 21, 7, 0, 21, 58, 16706 }, // Ї
-    { 12, 19, 10, -1, 15, 57, 16764 }, // Ј
-    { 17, 14, 19, 2, 13, 60, 16821 }, // Љ
-    { 17, 14, 19, 2, 13, 60, 16881 }, // Њ
-    { 14, 14, 16, 3, 14, 49, 16941 }, // Ћ
-    { 15, 21, 15, 0, 21, 79, 16990 }, // Ќ
-    { 15, 18, 16, 1, 18, 68, 17069 }, // Ѝ
-    { 13, 20, 12, -1, 19, 65, 17137 }, // Ў
-    { 13, 16, 12, 1, 12, 52, 17202 }, // Џ
-    { 14, 14, 17, 0, 14, 49, 17254 }, // А
-    { 12, 14, 11, 1, 13, 42, 17303 }, // Б
-    { 11, 14, 11, 1, 13, 39, 17345 }, // В
-    { 12, 12, 11, 1, 12, 36, 17384 }, // Г
-    { 14, 14, 14, 1, 12, 49, 17420 }, // Д
-    { 12, 12, 11, 1, 12, 36, 17469 }, // Е
-    { 21, 15, 21, 0, 15, 79, 17505 }, // Ж
-    { 11, 14, 12, 1, 13, 39, 17584 }, // З
-    { 15, 15, 16, 1, 15, 57, 17623 }, // И
-    { 15, 19, 16, 1, 19, 72, 17680 }, // Й
-    { 14, 15, 15, 0, 15, 53, 17752 }, // К
-    { 13, 13, 12, 1, 12, 43, 17805 }, // Л
-    { 15, 12, 14, 1, 12, 45, 17848 }, // М
-    { 16, 15, 16, 0, 15, 60, 17893 }, // Н
-    { 16, 16, 17, 1, 15, 64, 17953 }, // О
-    { 13, 13, 11, 1, 13, 43, 18017 }, // П
-    { 14, 15, 13, 0, 15, 53, 18060 }, // Р
-    { 14, 17, 14, 1, 16, 60, 18113 }, // С
-    { 14, 14, 16, 3, 14, 49, 18173 }, // Т
-    { 13, 14, 12, -1, 13, 46, 18222 }, // У
-    { 14, 13, 15, 3, 13, 46, 18268 }, // Ф
-    { 17, 15, 17, 0, 15, 64, 18314 }, // Х
-    { 12, 16, 12, 1, 13, 48, 18378 }, // Ц
-    { 10, 12, 11, 3, 12, 30, 18426 }, // Ч
-    { 15, 13, 14, 1, 13, 49, 18456 }, // Ш
-    { 15, 16, 15, 1, 13, 60, 18505 }, // Щ
-    { 10, 13, 11, 1, 12, 33, 18565 }, // Ъ
-    { 18, 14, 18, 1, 13, 63, 18598 }, // Ы
-    { 10, 13, 11, 1, 12, 33, 18661 }, // Ь
-    { 14, 14, 15, 1, 13, 49, 18694 }, // Э
-    { 16, 14, 17, 2, 13, 56, 18743 }, // Ю
-    { 14, 14, 14, 0, 14, 49, 18799 }, // Я
-    { 11, 11, 13, 0, 11, 31, 18848 }, // а
-    { 11, 14, 12, 2, 14, 39, 18879 }, // б
-    { 10, 11, 10, 0, 11, 28, 18918 }, // в
-    { 10, 10, 10, 1, 10, 25, 18946 }, // г
-    { 12, 12, 13, 1, 10, 36, 18971 }, // д
-    { 11, 10, 13, 1, 10, 28, 19007 }, // е
-    { 18, 12, 18, 0, 12, 54, 19035 }, // ж
-    { 8, 9, 7, 0, 9, 18, 19089 }, // з
-    { 11, 10, 11, 1, 10, 28, 19107 }, // и
-    { 11, 13, 11, 1, 13, 36, 19135 }, // й
-    { 11, 10, 11, 0, 10, 28, 19171 }, // к
-    { 10, 10, 8, 0, 9, 25, 19199 }, // л
-    { 13, 11, 14, 0, 11, 36, 19224 }, // м
-    { 13, 11, 13, 0, 11, 36, 19260 }, // н
-    { 10, 12, 14, 2, 11, 30, 19296 }, // о
-    { 11, 10, 11, 1, 10, 28, 19326 }, // п
-    { 14, 15, 14, -1, 10, 53, 19354 }, // р
-    { 9, 12, 11, 1, 11, 27, 19407 }, // с
-    { 10, 9, 11, 3, 9, 23, 19434 }, // т
-    { 13, 15, 13, 0, 10, 49, 19457 }, // у
-    { 14, 14, 15, 2, 10, 49, 19506 }, // ф
-    { 12, 10, 12, 1, 10, 30, 19555 }, // х
-    { 11, 13, 12, 1, 10, 36, 19585 }, // ц
-    { 8, 9, 8, 1, 9, 18, 19621 }, // ч
-    { 14, 10, 14, 1, 10, 35, 19639 }, // ш
-    { 14, 13, 15, 1, 10, 46, 19674 }, // щ
-    { 10, 10, 13, 3, 9, 25, 19720 }, // ъ
-    { 14, 11, 14, 1, 10, 39, 19745 }, // ы
-    { 9, 11, 10, 1, 10, 25, 19784 }, // ь
-    { 10, 11, 11, 1, 10, 28, 19809 }, // э
-    { 13, 11, 13, 1, 10, 36, 19837 }, // ю
-    { 11, 10, 10, 1, 10, 28, 19873 }, // я
-    { 11, 16, 13, 1, 16, 44, 19901 }, // ѐ
-    { 11, 13, 11, 2, 12, 36, 19945 }, // ё
-    { 12, 18, 13, 0, 15, 54, 19981 }, // ђ
-    { 10, 14, 10, 1, 14, 35, 20035 }, // ѓ
-    { 10, 10, 10, 0, 9, 25, 20070 }, // є
-    { 11, 10, 12, 0, 10, 28, 20095 }, // ѕ
-    { 7, 15, 6, 0, 15, 27, 20123 }, // і
-    { 9, 14, 6, 0, 14, 32, 20150 }, // ї
-    { 11, 20, 11, 1, 15, 55, 20182 }, // ј
-    { 13, 10, 13, 0, 9, 33, 20237 }, // љ
-    { 12, 10, 13, 1, 9, 30, 20270 }, // њ
-    { 12, 15, 13, 0, 15, 45, 20300 }, // ћ
-    { 11, 15, 11, 0, 15, 42, 20345 }, // ќ
-    { 11, 14, 11, 1, 14, 39, 20387 }, // ѝ
-    { 13, 22, 13, 0, 17, 72, 20426 }, // ў
-    { 10, 12, 9, 0, 9, 30, 20498 }, // џ
-    { 10, 13, 14, 4, 12, 33, 20528 }, // Ѣ
-    { 9, 13, 12, 3, 12, 30, 20561 }, // ѣ
-    { 17, 12, 17, 1, 12, 51, 20591 }, // Ѫ
-    { 11, 10, 12, 1, 9, 28, 20642 }, // ѫ
-    { 15, 16, 16, 1, 15, 60, 20670 }, // Ѳ
-    { 12, 12, 13, 1, 12, 36, 20730 }, // ѳ
-    { 19, 18, 17, 4, 18, 86, 20766 }, // Ѵ
-    { 11, 12, 14, 3, 12, 33, 20852 }, // ѵ
-    { 7, 5, 0, 4, 15, 9, 20885 }, // ҆
-    { 13, 14, 11, 1, 14, 46, 20894 }, // Ґ
-    { 11, 12, 10, 1, 12, 33, 20940 }, // ґ
-    { 12, 12, 11, 1, 12, 36, 20973 }, // Ғ
-    { 9, 8, 8, 0, 8, 18, 21009 }, // ғ
-    { 14, 14, 11, 1, 14, 49, 21027 }, // Ҕ
-    { 8, 9, 7, 0, 9, 18, 21076 }, // ҕ
-    { 20, 18, 21, -1, 15, 90, 21094 }, // Җ
-    { 14, 12, 15, -1, 10, 42, 21184 }, // җ
-    { 11, 15, 12, 1, 13, 42, 21226 }, // Ҙ
-    { 8, 13, 7, 0, 9, 26, 21268 }, // ҙ
-    { 14, 17, 15, -1, 15, 60, 21294 }, // Қ
-    { 10, 11, 10, -1, 10, 28, 21354 }, // қ
-    { 14, 13, 16, 2, 13, 46, 21382 }, // Ҝ
-    { 11, 9, 12, 1, 9, 25, 21428 }, // ҝ
-    { 14, 15, 15, 0, 15, 53, 21453 }, // Ҟ
-    { 10, 14, 13, 0, 14, 35, 21506 }, // ҟ
-    { 15, 15, 15, -1, 15, 57, 21541 }, // Ҡ
-    { 10, 11, 10, -1, 11, 28, 21598 }, // ҡ
-    { 16, 17, 16, -1, 15, 68, 21626 }, // Ң
-    { 11, 12, 11, -1, 11, 33, 21694 }, // ң
-    { 22, 15, 16, 0, 15, 83, 21727 }, // Ҥ
-    { 15, 10, 11, 0, 10, 38, 21810 }, // ҥ
-    { 18, 14, 20, 2, 14, 63, 21848 }, // Ҧ
-    { 16, 16, 18, 1, 11, 64, 21911 }, // ҧ
-    { 17, 15, 20, 2, 14, 64, 21975 }, // Ҩ
-    { 14, 12, 16, 1, 11, 42, 22039 }, // ҩ
-    { 14, 19, 14, 1, 16, 67, 22081 }, // Ҫ
-    { 9, 13, 11, 1, 11, 30, 22148 }, // ҫ
-    { 13, 16, 16, 2, 14, 52, 22178 }, // Ҭ
-    { 9, 12, 11, 1, 10, 27, 22230 }, // ҭ
-    { 12, 14, 15, 4, 14, 42, 22257 }, // Ү
-    { 10, 12, 11, 3, 9, 30, 22299 }, // ү
-    { 13, 14, 15, 3, 14, 46, 22329 }, // Ұ
-    { 13, 13, 11, 0, 9, 43, 22375 }, // ұ
-    { 17, 17, 17, -1, 15, 73, 22418 }, // Ҳ
-    { 12, 12, 11, -1, 10, 36, 22491 }, // ҳ
-    { 13, 15, 18, 4, 12, 49, 22527 }, // Ҵ
-    { 9, 11, 13, 3, 8, 25, 22576 }, // ҵ
-    { 11, 16, 14, 3, 12, 44, 22601 }, // Ҷ
-    { 8, 12, 10, 1, 9, 24, 22645 }, // ҷ
-    { 11, 12, 12, 3, 12, 33, 22669 }, // Ҹ
-    { 9, 9, 8, 1, 9, 21, 22702 }, // ҹ
-    { 10, 14, 13, 2, 14, 35, 22723 }, // Һ
-    { 12, 15, 13, 0, 15, 45, 22758 }, // һ
-    { 14, 13, 16, 1, 13, 46, 22803 }, // Ҽ
-    { 10, 9, 12, 0, 9, 23, 22849 }, // ҽ
-    { 14, 15, 18, 3, 13, 53, 22872 }, // Ҿ
-    { 10, 12, 13, 2, 10, 30, 22925 }, // ҿ
-    { 8, 15, 7, 0, 15, 30, 22955 }, // Ӏ
-    { 21, 21, 21, 0, 21, 111, 22985 }, // Ӂ
-    { 18, 18, 18, 0, 18, 81, 23096 }, // ӂ
-    { 12, 17, 13, 2, 13, 51, 23177 }, // Ӄ
-    { 9, 12, 9, 0, 9, 27, 23228 }, // ӄ
-    { 13, 16, 12, 1, 13, 52, 23255 }, // Ӆ
-    { 10, 11, 9, 0, 9, 28, 23307 }, // ӆ
-    { 16, 19, 16, 0, 15, 76, 23335 }, // Ӈ
-    { 11, 14, 11, 0, 11, 39, 23411 }, // ӈ
-    { 16, 20, 16, 0, 15, 80, 23450 }, // Ӊ
-    { 11, 15, 11, 0, 11, 42, 23530 }, // ӊ
-    { 11, 15, 11, 2, 12, 42, 23572 }, // Ӌ
-    { 7, 11, 8, 2, 9, 20, 23614 }, // ӌ
-    { 18, 20, 21, 0, 15, 90, 23634 }, // Ӎ
-    { 12, 14, 14, 0, 10, 42, 23724 }, // ӎ
-    { 6, 12, 5, 1, 12, 18, 23766 }, // ӏ
-    { 16, 21, 17, 0, 21, 84, 23784 }, // Ӑ
-    { 14, 16, 13, 0, 16, 56, 23868 }, // ӑ
-    { 16, 19, 17, 0, 19, 76, 23924 }, // Ӓ
-    { 15, 15, 13, 0, 15, 57, 24000 }, // ӓ
-    { 23, 16, 24, 0, 15, 92, 24057 }, // Ӕ
-    { 18, 11, 20, 0, 11, 50, 24149 }, // ӕ
-    { 12, 18, 11, 1, 18, 54, 24199 }, // Ӗ
-    { 12, 17, 13, 1, 17, 51, 24253 }, // ӗ
-    { 11, 11, 13, 1, 10, 31, 24304 }, // Ә
-    { 11, 12, 14, 5, 11, 33, 24335 }, // ә
-    { 13, 18, 13, 1, 17, 59, 24368 }, // Ӛ
-    { 12, 13, 14, 4, 11, 39, 24427 }, // ӛ
-    { 21, 20, 22, 0, 20, 105, 24466 }, // Ӝ
-    { 18, 17, 18, 0, 17, 77, 24571 }, // ӝ
-    { 12, 18, 12, 1, 17, 54, 24648 }, // Ӟ
-    { 12, 14, 7, 0, 14, 42, 24702 }, // ӟ
-    { 10, 13, 10, 2, 13, 33, 24744 }, // Ӡ
-    { 10, 13, 10, 1, 9, 33, 24777 }, // ӡ
-    { 15, 17, 16, 1, 17, 64, 24810 }, // Ӣ
-    { 12, 13, 11, 1, 13, 39, 24874 }, // ӣ
-    { 15, 18, 16, 1, 18, 68, 24913 }, // Ӥ
-    { 12, 14, 11, 1, 14, 42, 24981 }, // ӥ
-    { 16, 21, 17, 1, 20, 84, 25023 }, // Ӧ
-    { 11, 16, 14, 2, 15, 44, 25107 }, // ӧ
-    { 15, 13, 16, 1, 12, 49, 25151 }, // Ө
-    { 11, 10, 13, 1, 10, 28, 25200 }, // ө
-    { 15, 20, 16, 1, 19, 75, 25228 }, // Ӫ
-    { 12, 16, 13, 1, 16, 48, 25303 }, // ӫ
-    { 14, 19, 15, 1, 18, 67, 25351 }, // Ӭ
-    { 11, 15, 11, 1, 14, 42, 25418 }, // ӭ
-    { 13, 18, 12, -1, 17, 59, 25460 }, // Ӯ
-    { 13, 21, 13, 0, 16, 69, 25519 }, // ӯ
-    { 13, 19, 12, -1, 18, 62, 25588 }, // Ӱ
-    { 13, 21, 13, 0, 16, 69, 25650 }, // ӱ
-    { 15, 19, 12, -1, 18, 72, 25719 }, // Ӳ
-    { 15, 22, 13, 0, 17, 83, 25791 }, // ӳ
-    { 11, 17, 11, 3, 17, 47, 25874 }, // Ӵ
-    { 10, 14, 8, 1, 14, 35, 25921 }, // ӵ
-    { 12, 15, 11, 1, 12, 45, 25956 }, // Ӷ
-    { 9, 10, 8, 0, 8, 23, 26001 }, // ӷ
-    { 18, 19, 18, 1, 18, 86, 26024 }, // Ӹ
-    { 14, 16, 14, 1, 15, 56, 26110 }, // ӹ
-    { 17, 18, 17, 0, 15, 77, 26166 }, // Ӽ
-    { 12, 13, 11, 0, 11, 39, 26243 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 26282 }, //  
-    { 0, 0, 22, 0, 0, 0, 26282 }, //  
-    { 0, 0, 14, 0, 0, 0, 26282 }, //  
-    { 0, 0, 22, 0, 0, 0, 26282 }, //  
-    { 0, 0, 11, 0, 0, 0, 26282 }, //  
-    { 0, 0, 10, 0, 0, 0, 26282 }, //  
-    { 0, 0, 8, 0, 0, 0, 26282 }, //  
-    { 0, 0, 11, 0, 0, 0, 26282 }, //  
-    { 0, 0, 4, 0, 0, 0, 26282 }, //  
-    { 0, 0, 9, 0, 0, 0, 26282 }, //  
-    { 0, 0, 8, 0, 0, 0, 26282 }, //  
-    { 0, 0, 5, 0, 0, 0, 26282 }, // ​
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 26282 }, // ‏
-    { 9, 2, 9, 2, 6, 5, 26282 }, // ‐
-    { 9, 2, 9, 2, 6, 5, 26287 }, // ‑
-    { 13, 2, 12, 2, 6, 7, 26292 }, // ‒
-    { 12, 3, 13, 2, 6, 9, 26299 }, // –
-    { 17, 3, 19, 2, 6, 13, 26308 }, // —
-    { 17, 3, 19, 2, 6, 13, 26321 }, // ―
-    { 11, 15, 9, 0, 12, 42, 26334 }, // ‖
-    { 14, 6, 13, 0, -1, 21, 26376 }, // ‗
-    { 6, 6, 6, 3, 15, 9, 26397 }, // ‘
-    { 6, 5, 6, 3, 14, 8, 26406 }, // ’
-    { 6, 6, 5, 0, 3, 9, 26414 }, // ‚
-    { 6, 6, 6, 3, 15, 9, 26423 }, // ‛
-    { 10, 6, 9, 3, 15, 15, 26432 }, // “
-    { 10, 6, 9, 3, 15, 15, 26447 }, // ”
-    { 6, 6, 5, 0, 3, 9, 26462 }, // „
-    { 10, 5, 9, 3, 15, 13, 26471 }, // ‟
-    { 9, 22, 10, 3, 17, 50, 26484 }, // †
-    { 11, 22, 10, 1, 17, 61, 26534 }, // ‡
-    { 11, 10, 8, 0, 12, 28, 26595 }, // •
-    { 5, 6, 7, 2, 8, 8, 26623 }, // ‣
-    { 4, 3, 4, 0, 3, 3, 26631 }, // ․
-    { 4, 3, 4, 0, 3, 3, 26634 }, // ‥
-    { 16, 3, 16, 0, 3, 12, 26637 }, // …
-    { 3, 2, 4, 1, 6, 2, 26649 }, // ‧
-    { 0, 0, 21, 0, 0, 0, 26651 }, //  
-    { 14, 15, 18, 4, 13, 53, 26651 }, // ‰
-    { 6, 5, 5, 3, 14, 8, 26704 }, // ′
-    { 10, 6, 9, 3, 15, 15, 26712 }, // ″
-    { 12, 6, 14, -2, 14, 18, 26727 }, // ‴
-    { 4, 6, 6, 4, 14, 6, 26745 }, // ‵
-    { 8, 6, 9, 3, 14, 12, 26751 }, // ‶
-    { 12, 6, 14, 4, 14, 18, 26763 }, // ‷
-    { 7, 3, 9, 4, 13, 6, 26781 }, // ‸
-    { 6, 8, 7, 2, 8, 12, 26787 }, // ‹
-    { 6, 8, 7, -1, 8, 12, 26799 }, // ›
-    { 22, 17, 22, 0, 15, 94, 26811 }, // ※
-    { 9, 17, 6, 0, 17, 39, 26905 }, // ‼
-    { 12, 21, 12, 3, 20, 63, 26944 }, // ‽
-    { 9, 2, 9, 4, 14, 5, 27007 }, // ‾
-    { 8, 4, 11, 3, 12, 8, 27012 }, // ‿
-    { 12, 12, 13, 3, 16, 36, 27020 }, // ⁂
-    { 14, 14, 18, 4, 13, 49, 27056 }, // ⁄
-    { 20, 19, 21, 4, 19, 95, 27105 }, // ⁇
-    { 14, 19, 17, 4, 19, 67, 27200 }, // ⁈
-    { 17, 20, 13, 0, 19, 85, 27267 }, // ⁉
-    { 17, 26, 12, -1, 18, 111, 27352 }, // ⁒
-    { 0, 0, 80, 0, 0, 0, 27463 }, //  
-    { 6, 7, 5, 2, 14, 11, 27463 }, // ⁰
-    { 5, 6, 5, 2, 14, 8, 27474 }, // ⁴
-    { 6, 7, 5, 2, 14, 11, 27482 }, // ⁵
-    { 6, 7, 5, 2, 14, 11, 27493 }, // ⁶
-    { 5, 7, 6, 3, 14, 9, 27504 }, // ⁷
-    { 6, 7, 6, 2, 14, 11, 27513 }, // ⁸
-    { 6, 7, 6, 2, 14, 11, 27524 }, // ⁹
-    { 11, 10, 12, 0, 10, 28, 27535 }, // ⁿ
-    { 9, 9, 8, 0, 9, 21, 27563 }, // ₀
-    { 5, 7, 5, -1, 4, 9, 27584 }, // ₁
-    { 6, 7, 5, -1, 4, 11, 27593 }, // ₂
-    { 6, 7, 5, -1, 4, 11, 27604 }, // ₃
-    { 6, 7, 6, -1, 4, 11, 27615 }, // ₄
-    { 6, 7, 5, -1, 4, 11, 27626 }, // ₅
-    { 6, 7, 6, -1, 4, 11, 27637 }, // ₆
-    { 6, 7, 5, 0, 4, 11, 27648 }, // ₇
-    { 6, 7, 6, -1, 4, 11, 27659 }, // ₈
-    { 6, 7, 6, -1, 4, 11, 27670 }, // ₉
-    { 9, 23, 7, 2, 17, 52, 27681 }, // ₍
-    { 10, 23, 7, -4, 17, 58, 27733 }, // ₎
-    { 16, 23, 14, 0, 19, 92, 27791 }, // ₡
-    { 14, 17, 14, 1, 16, 60, 27883 }, // ₢
-    { 14, 16, 12, 0, 16, 56, 27943 }, // ₤
-    { 17, 15, 16, 0, 15, 64, 27999 }, // ₦
-    { 15, 15, 13, 0, 15, 57, 28063 }, // ₧
-    { 19, 15, 19, 0, 15, 72, 28120 }, // ₨
-    { 14, 15, 13, -1, 15, 53, 28192 }, // ₩
-    { 17, 13, 18, 2, 13, 56, 28245 }, // ₪
-    { 13, 14, 11, 1, 14, 46, 28301 }, // ₫
-    { 13, 16, 14, 1, 14, 52, 28347 }, // €
-    { 14, 14, 16, 3, 14, 49, 28399 }, // ₮
-    { 17, 15, 11, 0, 15, 64, 28448 }, // ₱
-    { 14, 21, 17, 1, 18, 74, 28512 }, // ₲
-    { 19, 16, 15, 1, 15, 76, 28586 }, // ₴
-    { 9, 14, 11, 1, 13, 32, 28662 }, // ₵
-    { 16, 15, 16, 3, 15, 60, 28694 }, // ₸
-    { 10, 13, 10, 2, 13, 33, 28754 }, // ₹
-    { 10, 13, 11, 2, 12, 33, 28787 }, // ₺
-    { 12, 13, 10, 1, 13, 39, 28820 }, // ₼
-    { 16, 15, 13, -2, 15, 60, 28859 }, // ₽
-    { 11, 11, 13, -2, 8, 31, 28919 }, // ←
-    { 11, 10, 13, 2, 10, 28, 28950 }, // ↑
-    { 11, 11, 13, 4, 8, 31, 28978 }, // →
-    { 11, 10, 13, 5, 10, 28, 29009 }, // ↓
-    { 18, 9, 15, -1, 8, 41, 29037 }, // ↔
-    { 9, 17, 11, 2, 16, 39, 29078 }, // ↕
-    { 10, 7, 11, -2, 7, 18, 29117 }, // ↖
-    { 11, 7, 11, 2, 7, 20, 29135 }, // ↗
-    { 8, 10, 11, 4, 9, 20, 29155 }, // ↘
-    { 8, 10, 11, -1, 9, 20, 29175 }, // ↙
-    { 13, 11, 14, 0, 10, 36, 29195 }, // ⇐
-    { 13, 12, 15, 3, 12, 39, 29231 }, // ⇑
-    { 13, 11, 14, 2, 10, 36, 29270 }, // ⇒
-    { 13, 13, 15, 6, 12, 43, 29306 }, // ⇓
-    { 17, 11, 16, 0, 10, 47, 29349 }, // ⇔
-    { 11, 16, 13, 4, 10, 44, 29396 }, // ⇕
-    { 13, 14, 11, 1, 14, 46, 29440 }, // ∂
-    { 17, 17, 17, 0, 16, 73, 29486 }, // ∅
-    { 13, 13, 14, 1, 13, 43, 29559 }, // ∆
-    { 13, 12, 12, 2, 12, 39, 29602 }, // ∏
-    { 13, 12, 12, 5, 12, 39, 29641 }, // ∐
-    { 11, 13, 10, 1, 12, 36, 29680 }, // ∑
-    { 8, 3, 10, 2, 6, 6, 29716 }, // −
-    { 16, 14, 16, 2, 13, 56, 29722 }, // √
-    { 15, 8, 15, 2, 10, 30, 29778 }, // ∞
-    { 18, 19, 14, 0, 15, 86, 29808 }, // ∫
-    { 7, 10, 5, 0, 10, 18, 29894 }, // ∶
-    { 12, 9, 13, 3, 9, 27, 29912 }, // ≈
-    { 14, 15, 18, 4, 13, 53, 29939 }, // ≠
-    { 15, 13, 14, -1, 12, 49, 29992 }, // ≤
-    { 14, 13, 14, 1, 12, 46, 30041 }, // ≥
+    { 16, 18, 18, 1, 15, 72, 2048 }, // Q
+    { 13, 14, 14, 0, 14, 46, 2120 }, // R
+    { 15, 16, 16, 0, 15, 60, 2166 }, // S
+    { 14, 14, 16, 3, 14, 49, 2226 }, // T
+    { 15, 16, 15, 1, 15, 60, 2275 }, // U
+    { 14, 15, 17, 4, 15, 53, 2335 }, // V
+    { 19, 14, 21, 3, 14, 67, 2388 }, // W
+    { 17, 15, 17, 0, 15, 64, 2455 }, // X
+    { 12, 14, 15, 4, 14, 42, 2519 }, // Y
+    { 17, 14, 16, 0, 14, 60, 2561 }, // Z
+    { 13, 23, 8, -1, 18, 75, 2621 }, // [
+    { 3, 16, 8, 4, 13, 12, 2696 }, // <backslash>
+    { 12, 23, 8, -4, 18, 69, 2708 }, // ]
+    { 7, 4, 9, 3, 15, 7, 2777 }, // ^
+    { 12, 3, 13, 0, -1, 9, 2784 }, // _
+    { 5, 3, 7, 4, 13, 4, 2793 }, // `
+    { 11, 11, 13, 0, 11, 31, 2797 }, // a
+    { 10, 16, 13, 2, 15, 40, 2828 }, // b
+    { 9, 12, 11, 1, 11, 27, 2868 }, // c
+    { 13, 16, 13, 1, 15, 52, 2895 }, // d
+    { 11, 10, 13, 1, 10, 28, 2947 }, // e
+    { 9, 14, 9, 1, 14, 32, 2975 }, // f
+    { 12, 15, 12, 0, 10, 45, 3007 }, // g
+    { 12, 15, 13, 0, 15, 45, 3052 }, // h
+    { 7, 15, 6, 0, 15, 27, 3097 }, // i
+    { 11, 20, 11, 1, 15, 55, 3124 }, // j
+    { 10, 14, 13, 0, 14, 35, 3179 }, // k
+    { 7, 14, 8, 0, 14, 25, 3214 }, // l
+    { 17, 10, 18, 0, 10, 43, 3239 }, // m
+    { 11, 10, 12, 0, 10, 28, 3282 }, // n
+    { 11, 10, 13, 1, 10, 28, 3310 }, // o
+    { 14, 15, 14, -1, 10, 53, 3338 }, // p
+    { 12, 14, 15, 1, 10, 42, 3391 }, // q
+    { 9, 10, 10, 0, 10, 23, 3433 }, // r
+    { 11, 10, 12, 0, 10, 28, 3456 }, // s
+    { 8, 13, 11, 2, 13, 26, 3484 }, // t
+    { 11, 10, 12, 1, 10, 28, 3510 }, // u
+    { 11, 10, 14, 3, 10, 28, 3538 }, // v
+    { 13, 10, 16, 3, 10, 33, 3566 }, // w
+    { 13, 10, 14, 0, 10, 33, 3599 }, // x
+    { 13, 15, 13, 0, 10, 49, 3632 }, // y
+    { 12, 10, 13, 0, 10, 30, 3681 }, // z
+    { 10, 16, 9, 2, 13, 40, 3711 }, // {
+    { 7, 15, 4, 0, 12, 27, 3751 }, // |
+    { 9, 16, 11, 0, 13, 36, 3778 }, // }
+    { 7, 4, 10, 3, 13, 7, 3814 }, // ~
+    { 0, 0, 14, 0, 0, 0, 3821 }, //  
+    { 7, 18, 7, 1, 13, 32, 3821 }, // ¡
+    { 9, 16, 11, 1, 14, 36, 3853 }, // ¢
+    { 14, 16, 12, 0, 16, 56, 3889 }, // £
+    { 10, 8, 11, 2, 10, 20, 3945 }, // ¤
+    { 13, 15, 13, 2, 13, 49, 3965 }, // ¥
+    { 7, 15, 4, 0, 12, 27, 4014 }, // ¦
+    { 14, 15, 14, 0, 13, 53, 4041 }, // §
+    { 9, 3, 9, 3, 13, 7, 4096 }, // ¨
+    { 8, 7, 9, 4, 16, 14, 4103 }, // ©
+    { 7, 6, 7, 2, 13, 11, 4117 }, // ª
+    { 12, 8, 14, 1, 8, 24, 4128 }, // «
+    { 9, 5, 10, 2, 6, 12, 4152 }, // ¬
+    { 9, 2, 9, 2, 6, 5, 4164 }, // ­
+    { 8, 7, 9, 4, 18, 14, 4169 }, // ®
+    { 7, 3, 9, 4, 13, 6, 4183 }, // ¯
+    { 9, 8, 9, 2, 14, 18, 4189 }, // °
+    { 11, 10, 12, 0, 9, 28, 4207 }, // ±
+    { 5, 7, 5, 2, 14, 9, 4235 }, // ²
+    { 6, 7, 5, 2, 14, 11, 4244 }, // ³
+    { 5, 4, 5, 3, 13, 5, 4255 }, // ´
+    { 13, 12, 12, -1, 10, 39, 4260 }, // µ
+    { 12, 14, 10, 0, 12, 42, 4299 }, // ¶
+    { 5, 3, 4, 1, 7, 4, 4341 }, // ·
+    { 5, 5, 5, 0, 1, 7, 4345 }, // ¸
+    { 4, 7, 5, 2, 14, 7, 4352 }, // ¹
+    { 6, 6, 7, 3, 12, 9, 4359 }, // º
+    { 11, 8, 11, -2, 8, 22, 4368 }, // »
+    { 14, 16, 18, 4, 15, 56, 4390 }, // ¼
+    { 15, 15, 18, 4, 14, 57, 4446 }, // ½
+    { 15, 15, 18, 3, 14, 57, 4503 }, // ¾
+    { 11, 19, 10, -1, 10, 53, 4560 }, // ¿
+    { 14, 19, 17, 0, 19, 67, 4613 }, // À
+    { 15, 22, 17, 0, 22, 83, 4680 }, // Á
+    { 15, 19, 17, 0, 19, 72, 4763 }, // Â
+    { 15, 19, 17, 0, 19, 72, 4835 }, // Ã
+    { 16, 19, 17, 0, 19, 76, 4907 }, // Ä
+    { 14, 20, 17, 0, 20, 70, 4983 }, // Å
+    { 23, 16, 24, 0, 15, 92, 5053 }, // Æ
+    { 14, 20, 14, 1, 16, 70, 5145 }, // Ç
+    { 14, 19, 13, 0, 19, 67, 5215 }, // È
+    { 14, 22, 13, 0, 22, 77, 5282 }, // É
+    { 14, 18, 13, 0, 18, 63, 5359 }, // Ê
+    { 14, 19, 13, 0, 19, 67, 5422 }, // Ë
+    { 9, 21, 7, 0, 21, 48, 5489 }, // Ì
+    { 10, 24, 7, 0, 24, 60, 5537 }, // Í
+    { 10, 20, 7, 0, 20, 50, 5597 }, // Î
+    { 11, 21, 7, 0, 21, 58, 5647 }, // Ï
+    { 15, 15, 16, 0, 15, 57, 5705 }, // Ð
+    { 17, 18, 16, 0, 18, 77, 5762 }, // Ñ
+    { 16, 21, 17, 1, 20, 84, 5839 }, // Ò
+    { 16, 24, 17, 1, 23, 96, 5923 }, // Ó
+    { 16, 20, 17, 1, 19, 80, 6019 }, // Ô
+    { 16, 21, 17, 1, 20, 84, 6144 }, // Õ
+    { 16, 21, 17, 1, 20, 84, 6228 }, // Ö
+    { 9, 5, 10, 1, 7, 12, 6312 }, // ×
+    { 29, 29, 17, -6, 22, 211, 6324 }, // Ø
+    { 15, 20, 15, 1, 19, 75, 6535 }, // Ù
+    { 15, 23, 15, 1, 22, 87, 6610 }, // Ú
+    { 15, 20, 15, 1, 19, 75, 6697 }, // Û
+    { 15, 20, 15, 1, 19, 75, 6772 }, // Ü
+    { 12, 23, 15, 4, 23, 69, 6847 }, // Ý
+    { 11, 13, 9, 0, 13, 36, 6916 }, // Þ
+    { 12, 13, 11, 1, 13, 39, 6952 }, // ß
+    { 11, 14, 13, 0, 14, 39, 6991 }, // à
+    { 11, 17, 13, 0, 17, 47, 7030 }, // á
+    { 12, 14, 13, 0, 14, 42, 7077 }, // â
+    { 12, 13, 13, 0, 13, 39, 7119 }, // ã
+    { 12, 14, 13, 0, 14, 42, 7158 }, // ä
+    { 11, 15, 13, 0, 15, 42, 7200 }, // å
+    { 18, 11, 20, 0, 11, 50, 7242 }, // æ
+    { 9, 15, 11, 1, 11, 34, 7292 }, // ç
+    { 11, 16, 13, 1, 16, 44, 7326 }, // è
+    { 11, 19, 13, 1, 19, 53, 7370 }, // é
+    { 11, 15, 13, 1, 15, 42, 7423 }, // ê
+    { 12, 16, 13, 1, 16, 48, 7465 }, // ë
+    { 7, 14, 6, 0, 14, 25, 7513 }, // ì
+    { 9, 17, 6, 0, 17, 39, 7538 }, // í
+    { 9, 13, 6, 0, 13, 30, 7577 }, // î
+    { 9, 14, 6, 0, 14, 32, 7607 }, // ï
+    { 15, 14, 14, 1, 14, 53, 7639 }, // ð
+    { 13, 14, 12, 0, 14, 46, 7692 }, // ñ
+    { 11, 16, 13, 1, 16, 44, 7738 }, // ò
+    { 11, 19, 13, 1, 19, 53, 7782 }, // ó
+    { 11, 15, 13, 1, 15, 42, 7835 }, // ô
+    { 11, 16, 13, 1, 16, 44, 7877 }, // õ
+    { 12, 16, 13, 1, 16, 48, 7921 }, // ö
+    { 11, 10, 13, 2, 10, 28, 7969 }, // ÷
+    { 16, 27, 13, -2, 18, 108, 7997 }, // ø
+    { 11, 15, 12, 1, 15, 42, 8105 }, // ù
+    { 11, 18, 12, 1, 18, 50, 8192 }, // ú
+    { 11, 14, 12, 1, 14, 39, 8242 }, // û
+    { 11, 15, 12, 1, 15, 42, 8281 }, // ü
+    { 13, 24, 13, 0, 19, 78, 8323 }, // ý
+    { 11, 18, 9, 0, 14, 50, 8401 }, // þ
+    { 13, 21, 13, 0, 16, 69, 8451 }, // ÿ
+    { 16, 19, 17, 0, 19, 76, 8520 }, // Ā
+    { 12, 13, 13, 0, 13, 39, 8596 }, // ā
+    { 16, 21, 17, 0, 21, 84, 8635 }, // Ă
+    { 12, 15, 13, 0, 15, 45, 8719 }, // ă
+    { 14, 19, 17, 0, 14, 67, 8764 }, // Ą
+    { 11, 15, 13, 0, 11, 42, 8831 }, // ą
+    { 14, 24, 14, 1, 23, 84, 8873 }, // Ć
+    { 10, 17, 11, 1, 16, 43, 8957 }, // ć
+    { 15, 22, 14, 1, 21, 83, 9000 }, // Ĉ
+    { 11, 16, 11, 1, 15, 44, 9083 }, // ĉ
+    { 14, 23, 14, 1, 22, 81, 9127 }, // Ċ
+    { 9, 16, 11, 1, 15, 36, 9208 }, // ċ
+    { 14, 24, 14, 1, 23, 84, 9244 }, // Č
+    { 10, 17, 11, 1, 16, 43, 9328 }, // č
+    { 15, 21, 16, 0, 21, 79, 9371 }, // Ď
+    { 16, 16, 13, 1, 15, 64, 9450 }, // ď
+    { 15, 15, 16, 0, 15, 57, 9514 }, // Đ
+    { 15, 16, 13, 1, 15, 60, 9571 }, // đ
+    { 14, 19, 13, 0, 19, 67, 9631 }, // Ē
+    { 12, 15, 13, 1, 15, 45, 9698 }, // ē
+    { 14, 21, 13, 0, 21, 74, 9743 }, // Ĕ
+    { 12, 17, 13, 1, 17, 51, 9817 }, // ĕ
+    { 14, 20, 13, 0, 20, 70, 9868 }, // Ė
+    { 11, 16, 13, 1, 16, 44, 9938 }, // ė
+    { 14, 19, 13, 0, 15, 67, 9982 }, // Ę
+    { 11, 15, 13, 1, 10, 42, 10049 }, // ę
+    { 14, 21, 13, 0, 21, 74, 10091 }, // Ě
+    { 11, 17, 13, 1, 17, 47, 10165 }, // ě
+    { 15, 19, 17, 1, 19, 72, 10240 }, // Ĝ
+    { 13, 20, 12, 0, 15, 65, 10312 }, // ĝ
+    { 15, 21, 17, 1, 21, 79, 10377 }, // Ğ
+    { 12, 21, 12, 0, 16, 63, 10456 }, // ğ
+    { 14, 20, 17, 1, 20, 70, 10519 }, // Ġ
+    { 12, 20, 12, 0, 15, 60, 10589 }, // ġ
+    { 14, 23, 17, 1, 15, 81, 10649 }, // Ģ
+    { 12, 21, 12, 0, 16, 63, 10730 }, // ģ
+    { 16, 19, 16, 0, 19, 76, 10793 }, // Ĥ
+    { 12, 19, 13, 0, 19, 57, 10869 }, // ĥ
+    { 16, 15, 16, 0, 15, 60, 10926 }, // Ħ
+    { 12, 15, 13, 0, 15, 45, 10986 }, // ħ
+    { 10, 21, 7, 0, 21, 53, 11031 }, // Ĩ
+    { 9, 15, 6, 0, 15, 34, 11084 }, // ĩ
+    { 11, 20, 7, 0, 20, 55, 11118 }, // Ī
+    { 9, 14, 6, 0, 14, 32, 11173 }, // ī
+    { 8, 19, 10, 2, 15, 38, 11205 }, // Į
+    { 8, 19, 6, -1, 15, 38, 11243 }, // į
+    { 9, 21, 7, 0, 21, 48, 11281 }, // İ
+    { 6, 10, 6, 0, 10, 15, 11329 }, // ı
+    { 14, 19, 15, 0, 15, 67, 11344 }, // Ĳ
+    { 16, 20, 6, 0, 15, 80, 11411 }, // ĳ
+    { 14, 23, 10, -1, 19, 81, 11491 }, // Ĵ
+    { 14, 20, 11, 1, 15, 70, 11572 }, // ĵ
+    { 14, 21, 15, 0, 15, 74, 11642 }, // Ķ
+    { 10, 22, 13, 0, 14, 55, 11716 }, // ķ
+    { 8, 9, 9, 0, 9, 18, 11771 }, // ĸ
+    { 11, 20, 13, 0, 20, 55, 11789 }, // Ĺ
+    { 10, 20, 8, 0, 20, 50, 11844 }, // ĺ
+    { 11, 22, 13, 0, 15, 61, 11894 }, // Ļ
+    { 7, 21, 8, 0, 14, 37, 11955 }, // ļ
+    { 12, 15, 13, 0, 15, 45, 11992 }, // Ľ
+    { 11, 14, 8, 0, 14, 39, 12037 }, // ľ
+    { 12, 14, 13, 0, 14, 42, 12076 }, // Ŀ
+    { 10, 14, 8, 0, 14, 35, 12118 }, // ŀ
+    { 23, 21, 13, -8, 17, 121, 12153 }, // Ł
+    { 16, 14, 8, -6, 14, 56, 12288 }, // ł
+    { 17, 20, 16, 0, 20, 85, 12344 }, // Ń
+    { 12, 16, 12, 0, 16, 48, 12429 }, // ń
+    { 17, 21, 16, 0, 15, 90, 12477 }, // Ņ
+    { 11, 16, 12, 0, 10, 44, 12567 }, // ņ
+    { 17, 20, 16, 0, 20, 85, 12611 }, // Ň
+    { 12, 16, 12, 0, 16, 48, 12696 }, // ň
+    { 12, 18, 11, -2, 18, 54, 12744 }, // ŉ
+    { 17, 19, 16, 0, 15, 81, 12798 }, // Ŋ
+    { 11, 14, 12, 0, 10, 39, 12879 }, // ŋ
+    { 16, 20, 17, 1, 19, 80, 12918 }, // Ō
+    { 12, 15, 13, 1, 15, 45, 12998 }, // ō
+    { 16, 22, 17, 1, 21, 88, 13043 }, // Ŏ
+    { 12, 18, 13, 1, 18, 54, 13131 }, // ŏ
+    { 17, 21, 17, 1, 20, 90, 13185 }, // Ő
+    { 14, 17, 13, 1, 17, 60, 13275 }, // ő
+    { 22, 15, 20, 1, 15, 83, 13335 }, // Œ
+    { 18, 11, 18, 1, 11, 50, 13418 }, // œ
+    { 13, 20, 14, 0, 20, 65, 13468 }, // Ŕ
+    { 9, 14, 10, 0, 14, 32, 13533 }, // ŕ
+    { 13, 22, 14, 0, 14, 72, 13565 }, // Ŗ
+    { 10, 19, 10, -1, 10, 48, 13637 }, // ŗ
+    { 13, 20, 14, 0, 20, 65, 13685 }, // Ř
+    { 9, 14, 10, 0, 14, 32, 13750 }, // ř
+    { 15, 22, 16, 0, 21, 83, 13782 }, // Ś
+    { 11, 16, 12, 0, 16, 44, 13865 }, // ś
+    { 16, 21, 16, 0, 20, 84, 13909 }, // Ŝ
+    { 11, 15, 12, 0, 15, 42, 13993 }, // ŝ
+    { 15, 19, 16, 0, 15, 72, 14035 }, // Ş
+    { 11, 14, 12, 0, 10, 39, 14107 }, // ş
+    { 15, 23, 16, 0, 22, 87, 14146 }, // Š
+    { 11, 16, 12, 0, 16, 44, 14233 }, // š
+    { 14, 17, 16, 3, 14, 60, 14336 }, // Ţ
+    { 8, 16, 11, 2, 13, 32, 14396 }, // ţ
+    { 14, 20, 16, 3, 20, 70, 14428 }, // Ť
+    { 10, 14, 11, 2, 14, 35, 14498 }, // ť
+    { 14, 14, 16, 3, 14, 49, 14533 }, // Ŧ
+    { 9, 13, 11, 1, 13, 30, 14582 }, // ŧ
+    { 15, 21, 15, 1, 20, 79, 14612 }, // Ũ
+    { 11, 15, 12, 1, 15, 42, 14691 }, // ũ
+    { 15, 20, 15, 1, 19, 75, 14733 }, // Ū
+    { 11, 14, 12, 1, 14, 39, 14808 }, // ū
+    { 15, 22, 15, 1, 21, 83, 14847 }, // Ŭ
+    { 11, 16, 12, 1, 16, 44, 14930 }, // ŭ
+    { 15, 22, 15, 1, 21, 83, 14974 }, // Ů
+    { 11, 16, 12, 1, 16, 44, 15057 }, // ů
+    { 16, 21, 15, 1, 20, 84, 15101 }, // Ű
+    { 13, 15, 12, 1, 15, 49, 15185 }, // ű
+    { 15, 19, 15, 1, 15, 72, 15234 }, // Ų
+    { 11, 15, 12, 1, 10, 42, 15306 }, // ų
+    { 19, 18, 21, 3, 18, 86, 15348 }, // Ŵ
+    { 13, 14, 16, 3, 14, 46, 15434 }, // ŵ
+    { 12, 19, 15, 4, 19, 57, 15480 }, // Ŷ
+    { 13, 21, 13, 0, 16, 69, 15537 }, // ŷ
+    { 12, 20, 15, 4, 20, 60, 15606 }, // Ÿ
+    { 17, 20, 16, 0, 20, 85, 15666 }, // Ź
+    { 12, 16, 13, 0, 16, 48, 15751 }, // ź
+    { 17, 19, 16, 0, 19, 81, 15799 }, // Ż
+    { 12, 15, 13, 0, 15, 45, 15880 }, // ż
+    { 17, 20, 16, 0, 20, 85, 15925 }, // Ž
+    { 12, 16, 13, 0, 16, 48, 16010 }, // ž
+    { 9, 14, 9, 2, 14, 32, 16058 }, // ſ
+    { 5, 3, 0, 4, 13, 4, 16090 }, // ̀
+    { 5, 4, 0, 3, 13, 5, 16094 }, // ́
+    { 8, 4, 0, -1, 0, 8, 16099 }, // ̂
+    { 7, 4, 0, 3, 13, 7, 16107 }, // ̃
+    { 8, 3, 0, 3, 12, 6, 16114 }, // ̄
+    { 11, 3, 0, 5, 15, 9, 16120 }, // ̅
+    { 8, 4, 0, 3, 13, 8, 16129 }, // ̆
+    { 4, 3, 0, 3, 13, 3, 16137 }, // ̇
+    { 9, 3, 0, 3, 13, 7, 16140 }, // ̈
+    { 4, 4, 0, 3, 11, 4, 16147 }, // ̉
+    { 5, 4, 0, 3, 13, 5, 16151 }, // ̊
+    { 12, 3, 0, 3, 13, 9, 16156 }, // ̋
+    { 8, 4, 0, 3, 13, 8, 16165 }, // ̌
+    { 12, 3, 0, -5, 14, 9, 16173 }, // ̏
+    { 6, 5, 0, 2, 13, 8, 16182 }, // ̒
+    { 6, 5, 0, 2, 12, 8, 16190 }, // ̓
+    { 6, 5, 0, -3, 12, 8, 16198 }, // ̔
+    { 4, 5, 0, 0, 0, 5, 16206 }, // ̘
+    { 4, 5, 0, 1, 0, 5, 16211 }, // ̙
+    { 8, 4, 0, 4, 13, 8, 16216 }, // ̚
+    { 3, 4, 0, 3, 11, 3, 16224 }, // ̛
+    { 3, 3, 0, 0, -1, 3, 16227 }, // ̜
+    { 4, 4, 0, 2, 3, 4, 16230 }, // ̝
+    { 4, 4, 0, 0, 0, 4, 16234 }, // ̞
+    { 4, 4, 0, 0, -1, 4, 16238 }, // ̟
+    { 8, 3, 0, 0, -2, 6, 16242 }, // ̠
+    { 4, 3, 0, 0, 1, 3, 16248 }, // ̣
+    { 9, 3, 0, -1, 0, 7, 16251 }, // ̤
+    { 5, 4, 0, 3, 13, 5, 16258 }, // ̥
+    { 6, 6, 0, 0, 3, 9, 16263 }, // ̦
+    { 5, 5, 0, 0, 1, 7, 16272 }, // ̧
+    { 5, 5, 0, 0, 0, 7, 16279 }, // ̨
+    { 4, 5, 0, -1, -1, 5, 16286 }, // ̩
+    { 6, 3, 0, 0, -1, 5, 16291 }, // ̪
+    { 7, 4, 0, 0, 0, 7, 16296 }, // ̬
+    { 8, 4, 0, -1, 0, 8, 16303 }, // ̭
+    { 7, 4, 0, 3, 13, 7, 16311 }, // ̰
+    { 7, 3, 0, 4, 13, 6, 16318 }, // ̱
+    { 7, 3, 0, 0, -1, 6, 16324 }, // ̲
+    { 7, 4, 0, 3, 13, 7, 16330 }, // ̴
+    { 9, 2, 0, 2, 6, 5, 16337 }, // ̵
+    { 3, 3, 0, 1, -1, 3, 16342 }, // ̹
+    { 6, 4, 0, -1, 0, 6, 16345 }, // ̺
+    { 6, 4, 0, 0, 0, 6, 16351 }, // ̻
+    { 6, 4, 0, 0, 0, 6, 16357 }, // ̼
+    { 5, 4, 0, 3, 13, 5, 16363 }, // ̽
+    { 7, 4, 0, 3, 13, 7, 16368 }, // ͂
+    { 4, 3, 0, 3, 14, 3, 16375 }, // ̓
+    { 9, 8, 0, 3, 18, 18, 16384 }, // ̈́
+    { 6, 3, 0, 4, 13, 5, 16402 }, // ͆
+    { 10, 6, 0, -1, 0, 15, 16407 }, // ͇
+    { 8, 5, 0, 0, 0, 10, 16422 }, // ͈
+    { 6, 5, 0, 0, -1, 8, 16432 }, // ͉
+    { 8, 10, 0, 3, 16, 20, 16440 }, // ͊
+    { 16, 7, 0, 5, 15, 28, 16460 }, // ͋
+    { 12, 9, 0, 3, 9, 27, 16488 }, // ͌
+    { 9, 5, 0, 1, 0, 12, 16515 }, // ͍
+    { 3, 3, 0, 2, 2, 3, 16527 }, // ͎
+    { 14, 3, 0, 1, 0, 11, 16530 }, // ͜
+    { 14, 3, 0, 3, 13, 11, 16541 }, // ͡
+    { 17, 5, 0, 0, -1, 22, 16552 }, // ͢
+    { 12, 17, 11, 1, 17, 51, 16574 }, // Ѐ
+    { 12, 16, 11, 1, 16, 48, 16625 }, // Ё
+    { 12, 14, 17, 5, 14, 42, 16673 }, // Ђ
+    { 12, 20, 11, 1, 20, 60, 16715 }, // Ѓ
+    { 13, 14, 15, 1, 13, 46, 16775 }, // Є
+    { 15, 16, 16, 0, 15, 60, 16821 }, // Ѕ
+    { 8, 15, 7, 0, 15, 30, 16881 }, // І
+    { 11, 21, 7, 0, 21, 58, 16911 }, // Ї
+    { 12, 19, 10, -1, 15, 57, 16969 }, // Ј
+    { 17, 14, 19, 2, 13, 60, 17026 }, // Љ
+    { 17, 14, 19, 2, 13, 60, 17086 }, // Њ
+    { 14, 14, 16, 3, 14, 49, 17146 }, // Ћ
+    { 15, 21, 15, 0, 21, 79, 17195 }, // Ќ
+    { 15, 18, 16, 1, 18, 68, 17274 }, // Ѝ
+    { 13, 20, 12, -1, 19, 65, 17342 }, // Ў
+    { 13, 16, 12, 1, 12, 52, 17407 }, // Џ
+    { 14, 14, 17, 0, 14, 49, 17459 }, // А
+    { 12, 14, 11, 1, 13, 42, 17508 }, // Б
+    { 11, 14, 11, 1, 13, 39, 17550 }, // В
+    { 12, 12, 11, 1, 12, 36, 17589 }, // Г
+    { 14, 14, 14, 1, 12, 49, 17625 }, // Д
+    { 12, 12, 11, 1, 12, 36, 17674 }, // Е
+    { 21, 15, 21, 0, 15, 79, 17710 }, // Ж
+    { 11, 14, 12, 1, 13, 39, 17789 }, // З
+    { 15, 15, 16, 1, 15, 57, 17828 }, // И
+    { 15, 19, 16, 1, 19, 72, 17885 }, // Й
+    { 14, 15, 15, 0, 15, 53, 17957 }, // К
+    { 13, 13, 12, 1, 12, 43, 18010 }, // Л
+    { 15, 12, 14, 1, 12, 45, 18053 }, // М
+    { 16, 15, 16, 0, 15, 60, 18098 }, // Н
+    { 16, 16, 17, 1, 15, 64, 18158 }, // О
+    { 13, 13, 11, 1, 13, 43, 18222 }, // П
+    { 14, 15, 13, 0, 15, 53, 18265 }, // Р
+    { 14, 17, 14, 1, 16, 60, 18318 }, // С
+    { 14, 14, 16, 3, 14, 49, 18378 }, // Т
+    { 13, 14, 12, -1, 13, 46, 18432 }, // У
+    { 14, 13, 15, 3, 13, 46, 18478 }, // Ф
+    { 17, 15, 17, 0, 15, 64, 18524 }, // Х
+    { 12, 16, 12, 1, 13, 48, 18588 }, // Ц
+    { 10, 12, 11, 3, 12, 30, 18636 }, // Ч
+    { 15, 13, 14, 1, 13, 49, 18666 }, // Ш
+    { 15, 16, 15, 1, 13, 60, 18715 }, // Щ
+    { 10, 13, 11, 1, 12, 33, 18775 }, // Ъ
+    { 18, 14, 18, 1, 13, 63, 18808 }, // Ы
+    { 10, 13, 11, 1, 12, 33, 18871 }, // Ь
+    { 14, 14, 15, 1, 13, 49, 18904 }, // Э
+    { 16, 14, 17, 2, 13, 56, 18953 }, // Ю
+    { 14, 14, 14, 0, 14, 49, 19009 }, // Я
+    { 11, 11, 13, 0, 11, 31, 19058 }, // а
+    { 11, 14, 12, 2, 14, 39, 19089 }, // б
+    { 10, 11, 10, 0, 11, 28, 19128 }, // в
+    { 10, 10, 10, 1, 10, 25, 19156 }, // г
+    { 12, 12, 13, 1, 10, 36, 19181 }, // д
+    { 11, 10, 13, 1, 10, 28, 19217 }, // е
+    { 18, 12, 18, 0, 12, 54, 19245 }, // ж
+    { 8, 9, 7, 0, 9, 18, 19299 }, // з
+    { 11, 10, 11, 1, 10, 28, 19317 }, // и
+    { 11, 13, 11, 1, 13, 36, 19345 }, // й
+    { 11, 10, 11, 0, 10, 28, 19381 }, // к
+    { 10, 10, 8, 0, 9, 25, 19409 }, // л
+    { 13, 11, 14, 0, 11, 36, 19434 }, // м
+    { 13, 11, 13, 0, 11, 36, 19470 }, // н
+    { 10, 12, 14, 2, 11, 30, 19506 }, // о
+    { 11, 10, 11, 1, 10, 28, 19536 }, // п
+    { 14, 15, 14, -1, 10, 53, 19564 }, // р
+    { 9, 12, 11, 1, 11, 27, 19617 }, // с
+    { 10, 9, 11, 3, 9, 23, 19644 }, // т
+    { 13, 15, 13, 0, 10, 49, 19667 }, // у
+    { 14, 14, 15, 2, 10, 49, 19716 }, // ф
+    { 12, 10, 12, 1, 10, 30, 19765 }, // х
+    { 11, 13, 12, 1, 10, 36, 19795 }, // ц
+    { 8, 9, 8, 1, 9, 18, 19831 }, // ч
+    { 14, 10, 14, 1, 10, 35, 19849 }, // ш
+    { 14, 13, 15, 1, 10, 46, 19884 }, // щ
+    { 10, 10, 13, 3, 9, 25, 19930 }, // ъ
+    { 14, 11, 14, 1, 10, 39, 19955 }, // ы
+    { 9, 11, 10, 1, 10, 25, 19994 }, // ь
+    { 10, 11, 11, 1, 10, 28, 20019 }, // э
+    { 13, 11, 13, 1, 10, 36, 20047 }, // ю
+    { 11, 10, 10, 1, 10, 28, 20083 }, // я
+    { 11, 16, 13, 1, 16, 44, 20111 }, // ѐ
+    { 11, 13, 11, 2, 12, 36, 20155 }, // ё
+    { 12, 18, 13, 0, 15, 54, 20191 }, // ђ
+    { 10, 14, 10, 1, 14, 35, 20245 }, // ѓ
+    { 10, 10, 10, 0, 9, 25, 20280 }, // є
+    { 11, 10, 12, 0, 10, 28, 20305 }, // ѕ
+    { 7, 15, 6, 0, 15, 27, 20333 }, // і
+    { 9, 14, 6, 0, 14, 32, 20360 }, // ї
+    { 11, 20, 11, 1, 15, 55, 20392 }, // ј
+    { 13, 10, 13, 0, 9, 33, 20447 }, // љ
+    { 12, 10, 13, 1, 9, 30, 20480 }, // њ
+    { 12, 15, 13, 0, 15, 45, 20510 }, // ћ
+    { 11, 15, 11, 0, 15, 42, 20555 }, // ќ
+    { 11, 14, 11, 1, 14, 39, 20597 }, // ѝ
+    { 13, 22, 13, 0, 17, 72, 20636 }, // ў
+    { 10, 12, 9, 0, 9, 30, 20708 }, // џ
+    { 10, 13, 14, 4, 12, 33, 20738 }, // Ѣ
+    { 9, 13, 12, 3, 12, 30, 20771 }, // ѣ
+    { 17, 12, 17, 1, 12, 51, 20801 }, // Ѫ
+    { 11, 10, 12, 1, 9, 28, 20852 }, // ѫ
+    { 15, 16, 16, 1, 15, 60, 20880 }, // Ѳ
+    { 12, 12, 13, 1, 12, 36, 20940 }, // ѳ
+    { 19, 18, 17, 4, 18, 86, 20976 }, // Ѵ
+    { 11, 12, 14, 3, 12, 33, 21062 }, // ѵ
+    { 7, 5, 0, 4, 15, 9, 21095 }, // ҆
+    { 13, 14, 11, 1, 14, 46, 21104 }, // Ґ
+    { 11, 12, 10, 1, 12, 33, 21150 }, // ґ
+    { 12, 12, 11, 1, 12, 36, 21183 }, // Ғ
+    { 9, 8, 8, 0, 8, 18, 21219 }, // ғ
+    { 14, 14, 11, 1, 14, 49, 21237 }, // Ҕ
+    { 8, 9, 7, 0, 9, 18, 21286 }, // ҕ
+    { 20, 18, 21, -1, 15, 90, 21304 }, // Җ
+    { 14, 12, 15, -1, 10, 42, 21394 }, // җ
+    { 11, 15, 12, 1, 13, 42, 21436 }, // Ҙ
+    { 8, 13, 7, 0, 9, 26, 21478 }, // ҙ
+    { 14, 17, 15, -1, 15, 60, 21504 }, // Қ
+    { 10, 11, 10, -1, 10, 28, 21564 }, // қ
+    { 14, 13, 16, 2, 13, 46, 21592 }, // Ҝ
+    { 11, 9, 12, 1, 9, 25, 21638 }, // ҝ
+    { 14, 15, 15, 0, 15, 53, 21663 }, // Ҟ
+    { 10, 14, 13, 0, 14, 35, 21716 }, // ҟ
+    { 15, 15, 15, -1, 15, 57, 21751 }, // Ҡ
+    { 10, 11, 10, -1, 11, 28, 21808 }, // ҡ
+    { 16, 17, 16, -1, 15, 68, 21836 }, // Ң
+    { 11, 12, 11, -1, 11, 33, 21904 }, // ң
+    { 22, 15, 16, 0, 15, 83, 21937 }, // Ҥ
+    { 15, 10, 11, 0, 10, 38, 22020 }, // ҥ
+    { 18, 14, 20, 2, 14, 63, 22058 }, // Ҧ
+    { 16, 16, 18, 1, 11, 64, 22121 }, // ҧ
+    { 17, 15, 20, 2, 14, 64, 22185 }, // Ҩ
+    { 14, 12, 16, 1, 11, 42, 22249 }, // ҩ
+    { 14, 19, 14, 1, 16, 67, 22291 }, // Ҫ
+    { 9, 13, 11, 1, 11, 30, 22358 }, // ҫ
+    { 13, 16, 16, 2, 14, 52, 22388 }, // Ҭ
+    { 9, 12, 11, 1, 10, 27, 22440 }, // ҭ
+    { 12, 14, 15, 4, 14, 42, 22467 }, // Ү
+    { 10, 12, 11, 3, 9, 30, 22528 }, // ү
+    { 13, 14, 15, 3, 14, 46, 22558 }, // Ұ
+    { 13, 13, 11, 0, 9, 43, 22604 }, // ұ
+    { 17, 17, 17, -1, 15, 73, 22647 }, // Ҳ
+    { 12, 12, 11, -1, 10, 36, 22720 }, // ҳ
+    { 13, 15, 18, 4, 12, 49, 22756 }, // Ҵ
+    { 9, 11, 13, 3, 8, 25, 22805 }, // ҵ
+    { 11, 16, 14, 3, 12, 44, 22830 }, // Ҷ
+    { 8, 12, 10, 1, 9, 24, 22874 }, // ҷ
+    { 11, 12, 12, 3, 12, 33, 22898 }, // Ҹ
+    { 9, 9, 8, 1, 9, 21, 22931 }, // ҹ
+    { 10, 14, 13, 2, 14, 35, 22952 }, // Һ
+    { 12, 15, 13, 0, 15, 45, 22987 }, // һ
+    { 14, 13, 16, 1, 13, 46, 23032 }, // Ҽ
+    { 10, 9, 12, 0, 9, 23, 23078 }, // ҽ
+    { 14, 15, 18, 3, 13, 53, 23101 }, // Ҿ
+    { 10, 12, 13, 2, 10, 30, 23154 }, // ҿ
+    { 8, 15, 7, 0, 15, 30, 23184 }, // Ӏ
+    { 21, 21, 21, 0, 21, 111, 23214 }, // Ӂ
+    { 18, 18, 18, 0, 18, 81, 23325 }, // ӂ
+    { 12, 17, 13, 2, 13, 51, 23406 }, // Ӄ
+    { 9, 12, 9, 0, 9, 27, 23457 }, // ӄ
+    { 13, 16, 12, 1, 13, 52, 23484 }, // Ӆ
+    { 10, 11, 9, 0, 9, 28, 23536 }, // ӆ
+    { 16, 19, 16, 0, 15, 76, 23564 }, // Ӈ
+    { 11, 14, 11, 0, 11, 39, 23640 }, // ӈ
+    { 16, 20, 16, 0, 15, 80, 23679 }, // Ӊ
+    { 11, 15, 11, 0, 11, 42, 23759 }, // ӊ
+    { 11, 15, 11, 2, 12, 42, 23801 }, // Ӌ
+    { 7, 11, 8, 2, 9, 20, 23843 }, // ӌ
+    { 18, 20, 21, 0, 15, 90, 23863 }, // Ӎ
+    { 12, 14, 14, 0, 10, 42, 23953 }, // ӎ
+    { 6, 12, 5, 1, 12, 18, 23995 }, // ӏ
+    { 16, 21, 17, 0, 21, 84, 24013 }, // Ӑ
+    { 14, 16, 13, 0, 16, 56, 24097 }, // ӑ
+    { 16, 19, 17, 0, 19, 76, 24153 }, // Ӓ
+    { 15, 15, 13, 0, 15, 57, 24229 }, // ӓ
+    { 23, 16, 24, 0, 15, 92, 24286 }, // Ӕ
+    { 18, 11, 20, 0, 11, 50, 24378 }, // ӕ
+    { 12, 18, 11, 1, 18, 54, 24428 }, // Ӗ
+    { 12, 17, 13, 1, 17, 51, 24482 }, // ӗ
+    { 11, 11, 13, 1, 10, 31, 24533 }, // Ә
+    { 11, 12, 14, 5, 11, 33, 24576 }, // ә
+    { 13, 18, 13, 1, 17, 59, 24609 }, // Ӛ
+    { 12, 13, 14, 4, 11, 39, 24668 }, // ӛ
+    { 21, 20, 22, 0, 20, 105, 24707 }, // Ӝ
+    { 18, 17, 18, 0, 17, 77, 24812 }, // ӝ
+    { 12, 18, 12, 1, 17, 54, 24889 }, // Ӟ
+    { 12, 14, 7, 0, 14, 42, 24943 }, // ӟ
+    { 10, 13, 10, 2, 13, 33, 24985 }, // Ӡ
+    { 10, 13, 10, 1, 9, 33, 25018 }, // ӡ
+    { 15, 17, 16, 1, 17, 64, 25051 }, // Ӣ
+    { 12, 13, 11, 1, 13, 39, 25115 }, // ӣ
+    { 15, 18, 16, 1, 18, 68, 25154 }, // Ӥ
+    { 12, 14, 11, 1, 14, 42, 25222 }, // ӥ
+    { 16, 21, 17, 1, 20, 84, 25264 }, // Ӧ
+    { 11, 16, 14, 2, 15, 44, 25348 }, // ӧ
+    { 15, 13, 16, 1, 12, 49, 25392 }, // Ө
+    { 11, 10, 13, 1, 10, 28, 25441 }, // ө
+    { 15, 20, 16, 1, 19, 75, 25469 }, // Ӫ
+    { 12, 16, 13, 1, 16, 48, 25544 }, // ӫ
+    { 14, 19, 15, 1, 18, 67, 25592 }, // Ӭ
+    { 11, 15, 11, 1, 14, 42, 25659 }, // ӭ
+    { 13, 18, 12, -1, 17, 59, 25701 }, // Ӯ
+    { 13, 21, 13, 0, 16, 69, 25760 }, // ӯ
+    { 13, 19, 12, -1, 18, 62, 25829 }, // Ӱ
+    { 13, 21, 13, 0, 16, 69, 25891 }, // ӱ
+    { 15, 19, 12, -1, 18, 72, 25960 }, // Ӳ
+    { 15, 22, 13, 0, 17, 83, 26032 }, // ӳ
+    { 11, 17, 11, 3, 17, 47, 26115 }, // Ӵ
+    { 10, 14, 8, 1, 14, 35, 26162 }, // ӵ
+    { 12, 15, 11, 1, 12, 45, 26197 }, // Ӷ
+    { 9, 10, 8, 0, 8, 23, 26242 }, // ӷ
+    { 18, 19, 18, 1, 18, 86, 26265 }, // Ӹ
+    { 14, 16, 14, 1, 15, 56, 26351 }, // ӹ
+    { 17, 18, 17, 0, 15, 77, 26407 }, // Ӽ
+    { 12, 13, 11, 0, 11, 39, 26484 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 26523 }, //  
+    { 0, 0, 22, 0, 0, 0, 26523 }, //  
+    { 0, 0, 14, 0, 0, 0, 26523 }, //  
+    { 0, 0, 22, 0, 0, 0, 26523 }, //  
+    { 0, 0, 11, 0, 0, 0, 26523 }, //  
+    { 0, 0, 10, 0, 0, 0, 26523 }, //  
+    { 0, 0, 8, 0, 0, 0, 26523 }, //  
+    { 0, 0, 11, 0, 0, 0, 26523 }, //  
+    { 0, 0, 4, 0, 0, 0, 26523 }, //  
+    { 0, 0, 9, 0, 0, 0, 26523 }, //  
+    { 0, 0, 8, 0, 0, 0, 26523 }, //  
+    { 0, 0, 5, 0, 0, 0, 26523 }, // ​
+    { 0, 0, 0, 0, 0, 0, 26523 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 26523 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 26523 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 26523 }, // ‏
+    { 9, 2, 9, 2, 6, 5, 26523 }, // ‐
+    { 9, 2, 9, 2, 6, 5, 26528 }, // ‑
+    { 13, 2, 12, 2, 6, 7, 26533 }, // ‒
+    { 12, 3, 13, 2, 6, 9, 26540 }, // –
+    { 17, 3, 19, 2, 6, 13, 26549 }, // —
+    { 17, 3, 19, 2, 6, 13, 26562 }, // ―
+    { 11, 15, 9, 0, 12, 42, 26575 }, // ‖
+    { 14, 6, 13, 0, -1, 21, 26624 }, // ‗
+    { 6, 6, 6, 3, 15, 9, 26645 }, // ‘
+    { 6, 5, 6, 3, 14, 8, 26654 }, // ’
+    { 6, 6, 5, 0, 3, 9, 26662 }, // ‚
+    { 6, 6, 6, 3, 15, 9, 26671 }, // ‛
+    { 10, 6, 9, 3, 15, 15, 26680 }, // “
+    { 10, 6, 9, 3, 15, 15, 26695 }, // ”
+    { 6, 6, 5, 0, 3, 9, 26710 }, // „
+    { 10, 5, 9, 3, 15, 13, 26719 }, // ‟
+    { 9, 22, 10, 3, 17, 50, 26732 }, // †
+    { 11, 22, 10, 1, 17, 61, 26782 }, // ‡
+    { 11, 10, 8, 0, 12, 28, 26843 }, // •
+    { 5, 6, 7, 2, 8, 8, 26871 }, // ‣
+    { 4, 3, 4, 0, 3, 3, 26879 }, // ․
+    { 4, 3, 4, 0, 3, 3, 26882 }, // ‥
+    { 16, 3, 16, 0, 3, 12, 26885 }, // …
+    { 3, 2, 4, 1, 6, 2, 26897 }, // ‧
+    { 0, 0, 21, 0, 0, 0, 26899 }, //  
+    { 14, 15, 18, 4, 13, 53, 26899 }, // ‰
+    { 6, 5, 5, 3, 14, 8, 26952 }, // ′
+    { 10, 6, 9, 3, 15, 15, 26960 }, // ″
+    { 12, 6, 14, -2, 14, 18, 26975 }, // ‴
+    { 4, 6, 6, 4, 14, 6, 26993 }, // ‵
+    { 8, 6, 9, 3, 14, 12, 26999 }, // ‶
+    { 12, 6, 14, 4, 14, 18, 27011 }, // ‷
+    { 7, 3, 9, 4, 13, 6, 27029 }, // ‸
+    { 6, 8, 7, 2, 8, 12, 27035 }, // ‹
+    { 6, 8, 7, -1, 8, 12, 27047 }, // ›
+    { 22, 17, 22, 0, 15, 94, 27059 }, // ※
+    { 9, 17, 6, 0, 17, 39, 27153 }, // ‼
+    { 12, 21, 12, 3, 20, 63, 27192 }, // ‽
+    { 9, 2, 9, 4, 14, 5, 27255 }, // ‾
+    { 8, 4, 11, 3, 12, 8, 27260 }, // ‿
+    { 12, 12, 13, 3, 16, 36, 27268 }, // ⁂
+    { 14, 14, 18, 4, 13, 49, 27304 }, // ⁄
+    { 20, 19, 21, 4, 19, 95, 27353 }, // ⁇
+    { 14, 19, 17, 4, 19, 67, 27448 }, // ⁈
+    { 17, 20, 13, 0, 19, 85, 27515 }, // ⁉
+    { 17, 26, 12, -1, 18, 111, 27600 }, // ⁒
+    { 0, 0, 80, 0, 0, 0, 27711 }, //  
+    { 6, 7, 5, 2, 14, 11, 27711 }, // ⁰
+    { 5, 6, 5, 2, 14, 8, 27722 }, // ⁴
+    { 6, 7, 5, 2, 14, 11, 27730 }, // ⁵
+    { 6, 7, 5, 2, 14, 11, 27741 }, // ⁶
+    { 5, 7, 6, 3, 14, 9, 27752 }, // ⁷
+    { 6, 7, 6, 2, 14, 11, 27761 }, // ⁸
+    { 6, 7, 6, 2, 14, 11, 27772 }, // ⁹
+    { 11, 10, 12, 0, 10, 28, 27783 }, // ⁿ
+    { 9, 9, 8, 0, 9, 21, 27811 }, // ₀
+    { 5, 7, 5, -1, 4, 9, 27832 }, // ₁
+    { 6, 7, 5, -1, 4, 11, 27841 }, // ₂
+    { 6, 7, 5, -1, 4, 11, 27852 }, // ₃
+    { 6, 7, 6, -1, 4, 11, 27863 }, // ₄
+    { 6, 7, 5, -1, 4, 11, 27874 }, // ₅
+    { 6, 7, 6, -1, 4, 11, 27885 }, // ₆
+    { 6, 7, 5, 0, 4, 11, 27896 }, // ₇
+    { 6, 7, 6, -1, 4, 11, 27907 }, // ₈
+    { 6, 7, 6, -1, 4, 11, 27918 }, // ₉
+    { 9, 23, 7, 2, 17, 52, 27929 }, // ₍
+    { 10, 23, 7, -4, 17, 58, 27981 }, // ₎
+    { 16, 23, 14, 0, 19, 92, 28039 }, // ₡
+    { 14, 17, 14, 1, 16, 60, 28131 }, // ₢
+    { 14, 16, 12, 0, 16, 56, 28191 }, // ₤
+    { 17, 15, 16, 0, 15, 64, 28247 }, // ₦
+    { 15, 15, 13, 0, 15, 57, 28311 }, // ₧
+    { 19, 15, 19, 0, 15, 72, 28368 }, // ₨
+    { 14, 15, 13, -1, 15, 53, 28440 }, // ₩
+    { 17, 13, 18, 2, 13, 56, 28493 }, // ₪
+    { 13, 14, 11, 1, 14, 46, 28549 }, // ₫
+    { 13, 16, 14, 1, 14, 52, 28595 }, // €
+    { 14, 14, 16, 3, 14, 49, 28672 }, // ₮
+    { 17, 15, 11, 0, 15, 64, 28721 }, // ₱
+    { 14, 21, 17, 1, 18, 74, 28785 }, // ₲
+    { 19, 16, 15, 1, 15, 76, 28859 }, // ₴
+    { 9, 14, 11, 1, 13, 32, 28935 }, // ₵
+    { 16, 15, 16, 3, 15, 60, 28967 }, // ₸
+    { 10, 13, 10, 2, 13, 33, 29027 }, // ₹
+    { 10, 13, 11, 2, 12, 33, 29060 }, // ₺
+    { 12, 13, 10, 1, 13, 39, 29093 }, // ₼
+    { 16, 15, 13, -2, 15, 60, 29132 }, // ₽
+    { 11, 11, 13, -2, 8, 31, 29192 }, // ←
+    { 11, 10, 13, 2, 10, 28, 29223 }, // ↑
+    { 11, 11, 13, 4, 8, 31, 29251 }, // →
+    { 11, 10, 13, 5, 10, 28, 29282 }, // ↓
+    { 18, 9, 15, -1, 8, 41, 29310 }, // ↔
+    { 9, 17, 11, 2, 16, 39, 29351 }, // ↕
+    { 10, 7, 11, -2, 7, 18, 29390 }, // ↖
+    { 11, 7, 11, 2, 7, 20, 29408 }, // ↗
+    { 8, 10, 11, 4, 9, 20, 29428 }, // ↘
+    { 8, 10, 11, -1, 9, 20, 29448 }, // ↙
+    { 13, 11, 14, 0, 10, 36, 29468 }, // ⇐
+    { 13, 12, 15, 3, 12, 39, 29504 }, // ⇑
+    { 13, 11, 14, 2, 10, 36, 29543 }, // ⇒
+    { 13, 13, 15, 6, 12, 43, 29579 }, // ⇓
+    { 17, 11, 16, 0, 10, 47, 29622 }, // ⇔
+    { 11, 16, 13, 4, 10, 44, 29669 }, // ⇕
+    { 13, 14, 11, 1, 14, 46, 29713 }, // ∂
+    { 17, 17, 17, 0, 16, 73, 29759 }, // ∅
+    { 13, 13, 14, 1, 13, 43, 29832 }, // ∆
+    { 13, 12, 12, 2, 12, 39, 29875 }, // ∏
+    { 13, 12, 12, 5, 12, 39, 29914 }, // ∐
+    { 11, 13, 10, 1, 12, 36, 29953 }, // ∑
+    { 8, 3, 10, 2, 6, 6, 29989 }, // −
+    { 16, 14, 16, 2, 13, 56, 29995 }, // √
+    { 15, 8, 15, 2, 10, 30, 30051 }, // ∞
+    { 18, 19, 14, 0, 15, 86, 30081 }, // ∫
+    { 7, 10, 5, 0, 10, 18, 30167 }, // ∶
+    { 12, 9, 13, 3, 9, 27, 30185 }, // ≈
+    { 14, 15, 18, 4, 13, 53, 30212 }, // ≠
+    { 15, 13, 14, -1, 12, 49, 30265 }, // ≤
+    { 14, 13, 14, 1, 12, 46, 30314 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
@@ -2688,4 +2087,9 @@ static const EpdFontData opendyslexic_8_italic = {
     22,
     -9,
     true,
+    opendyslexic_8_italicBlockOffsets,
+    opendyslexic_8_italicDirectGlyphs,
+    opendyslexic_8_italicGlyphPages,
+    35,
+    opendyslexic_8_italicPageGlyphs,
 };
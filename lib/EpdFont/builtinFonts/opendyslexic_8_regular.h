@@ -2,1575 +2,1158 @@
  * generated by fontconvert.py
  * name: opendyslexic_8_regular
  * size: 8
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, compressed
+ * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_regularBitmaps[24982] = {
-    0x01, 0x01, 0xC0, 0xB0, 0x2C, 0x0B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x05,
-    0x01, 0x43, 0xF0, 0xFC, 0x3F, 0x00, 0x14, 0x05, 0x0F, 0x8B, 0xC3, 0xD2, 0xF0, 0xF0, 0xF8, 0x3D,
-    0x3E, 0x0A, 0x0A, 0x40, 0x00, 0x1C, 0x07, 0x00, 0x00, 0x0B, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0xF0,
-    0x00, 0x00, 0xE0, 0x38, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x45, 0x6E, 0x5B, 0x95, 0x40, 0x07, 0x41,
-    0xD0, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x00, 0xB4, 0x2D, 0x00, 0x05, 0x7E, 0x5F, 0x95, 0x47, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xC0, 0xF0, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x7C, 0x0F, 0x00, 0x00,
-    0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F,
-    0xFF, 0xC0, 0x0F, 0xF8, 0xD0, 0x00, 0xF2, 0x8C, 0x00, 0x0F, 0x28, 0xC0, 0x00, 0xFF, 0x8C, 0x00,
-    0x03, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x28, 0xFF, 0xC0, 0x02, 0x8E, 0xFE, 0x05, 0x28,
-    0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x80, 0x00, 0x28, 0xC0, 0x00,
-    0x01, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x30, 0x0F, 0x80, 0xA0, 0x30, 0x60, 0xC0, 0x30,
-    0x32, 0x40, 0x30, 0x77, 0x00, 0x2F, 0xDD, 0x00, 0x05, 0x2E, 0xE0, 0x00, 0x3D, 0x1C, 0x00, 0xEC,
-    0x0C, 0x01, 0xCC, 0x0C, 0x03, 0x4A, 0x6C, 0x0B, 0x02, 0xF0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x57, 0x80, 0x01, 0xC0, 0x2C, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0xF5,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xAE, 0x00, 0x02, 0xF0, 0x78, 0x3C,
-    0x3E, 0x01, 0xEB, 0x83, 0xF0, 0x07, 0xF0, 0x2F, 0xD5, 0xFF, 0x00, 0xFF, 0xFF, 0x78, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3E, 0x3D, 0x3C, 0x3C, 0x00, 0xC0, 0x28, 0x03, 0x00, 0xB0,
-    0x0D, 0x01, 0xC0, 0x2C, 0x03, 0x80, 0x34, 0x03, 0x40, 0x74, 0x07, 0x40, 0x34, 0x03, 0x40, 0x38,
-    0x03, 0xC0, 0x2C, 0x01, 0xD0, 0x0F, 0x00, 0xB0, 0x07, 0x80, 0x3C, 0x00, 0x40, 0x34, 0x01, 0xC0,
-    0x0D, 0x00, 0xB0, 0x03, 0x40, 0x38, 0x02, 0xC0, 0x1C, 0x00, 0xD0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xD0, 0x0D, 0x01, 0xC0, 0x2C, 0x03, 0xC0, 0x38, 0x0B, 0x40, 0xF0, 0x1E, 0x03, 0xC0, 0x14, 0x00,
-    0x00, 0x40, 0x00, 0x60, 0x07, 0x58, 0xB0, 0x7F, 0xD0, 0x07, 0xE0, 0x0B, 0x77, 0xC2, 0x0C, 0x10,
-    0x03, 0x00, 0x00, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xD0, 0xBF, 0xFF, 0x01, 0xC0, 0x01, 0xC0,
-    0x01, 0xC0, 0x00, 0x00, 0x05, 0x07, 0xD1, 0xF0, 0xBC, 0x3E, 0x0A, 0x40, 0x6A, 0xA9, 0xBF, 0xFE,
-    0x18, 0x3D, 0x3E, 0x00, 0x00, 0x80, 0x00, 0x1C, 0x00, 0x02, 0x80, 0x00, 0x34, 0x00, 0x07, 0x00,
-    0x00, 0xB0, 0x00, 0x0E, 0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x34, 0x00, 0x07,
-    0x00, 0x00, 0xB0, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x34, 0x00,
-    0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x03, 0x47, 0x03, 0x80, 0x70, 0xD0, 0x0D, 0x70, 0xC3, 0xAC,
-    0x34, 0xEB, 0x0D, 0x3A, 0xC1, 0x0E, 0x78, 0x07, 0x9F, 0x47, 0xD3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3B, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x07, 0x80, 0x07, 0x80, 0x1B, 0x94, 0xBF, 0xFD, 0xBF, 0xFD, 0x01, 0x40, 0x1F, 0xFE,
-    0x06, 0x41, 0xE0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x02, 0xF0, 0x03, 0xF4,
-    0x07, 0xF4, 0x03, 0xF9, 0x51, 0xFF, 0xFC, 0xBF, 0xFF, 0x40, 0x2F, 0xF4, 0x08, 0x07, 0x40, 0x00,
-    0x70, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x5B, 0x40, 0xBF, 0x40, 0x00, 0x7C, 0x00, 0x0B, 0x00, 0x02,
-    0xD2, 0x9A, 0xF1, 0xFF, 0xF4, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0B, 0x80, 0x07,
-    0xE0, 0x03, 0xAC, 0x03, 0xCB, 0x02, 0xD2, 0xC1, 0xE0, 0xF4, 0xBF, 0xFF, 0x85, 0x5F, 0x90, 0x03,
-    0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x47, 0x00, 0x01, 0xC0, 0x00, 0x70,
-    0x00, 0x1F, 0xF9, 0x05, 0x56, 0xD0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC7, 0xAB, 0xF1, 0xFF,
-    0xF4, 0x7F, 0xE0, 0x00, 0x00, 0x15, 0x01, 0xFF, 0xC1, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x2E,
-    0xFF, 0x4B, 0xD0, 0xF2, 0xE0, 0x0E, 0x74, 0x03, 0x9D, 0x00, 0xE3, 0xD1, 0xF4, 0x7F, 0xFC, 0x06,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x40,
-    0x02, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4, 0x00,
-    0x02, 0xE4, 0x01, 0xD0, 0xA0, 0x38, 0x03, 0x03, 0x40, 0x34, 0x3C, 0x0B, 0x01, 0xFA, 0xE0, 0x0B,
-    0xFC, 0x03, 0xD0, 0xF4, 0x74, 0x03, 0xCB, 0x40, 0x3C, 0xB8, 0x07, 0xC3, 0xFB, 0xF4, 0x0B, 0xF9,
-    0x00, 0x0B, 0xF4, 0x0B, 0x4B, 0x87, 0x00, 0xF2, 0xC0, 0x1D, 0xB0, 0x07, 0x9C, 0x01, 0xE3, 0x80,
-    0xF8, 0xBF, 0xFE, 0x01, 0xA7, 0x80, 0x00, 0xD1, 0x41, 0xF4, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x2D,
-    0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3E, 0x3E, 0x0F, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x7D, 0x1F, 0x0B, 0xC3, 0xE0, 0xA4, 0x00, 0x00, 0x24, 0x00, 0x02, 0xF4, 0x00, 0x7F,
-    0x40, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x7F, 0xFE, 0x00, 0x00, 0x24, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xBF, 0xE4, 0x7F, 0xF9, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x3E, 0xBF, 0x02, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x3E, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x2D, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xD5, 0xB4, 0x00, 0x74, 0x00,
-    0x30, 0x03, 0x40, 0x00, 0x60, 0x2C, 0x2F, 0xC0, 0xC0, 0xE0, 0x83, 0x03, 0x07, 0x45, 0x0C, 0x0C,
-    0x1E, 0x24, 0x70, 0x70, 0x7C, 0x3F, 0xC7, 0x40, 0xF4, 0x11, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xF4, 0x06, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4,
-    0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0xFF, 0xF8, 0x03, 0xD5,
-    0xBD, 0x0F, 0x00, 0x38, 0x3C, 0x00, 0xF0, 0xF0, 0x07, 0x83, 0xFF, 0xF8, 0x0F, 0xAB, 0xF8, 0x3C,
-    0x00, 0xB8, 0xF0, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x2F, 0x3E, 0xAF, 0xFC, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x03,
-    0xC0, 0x1F, 0xC0, 0xF0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0xBC,
-    0xF0, 0x00, 0x2F, 0x3C, 0x00, 0x0B, 0xCF, 0x00, 0x07, 0xF3, 0xEA, 0xAF, 0xF8, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40,
-    0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xC3, 0xE9, 0x50, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0xFF, 0xD1, 0xFF, 0xF0, 0xB8,
-    0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x2F, 0xFF, 0xF0, 0x0B, 0xE4, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xE2, 0xE0,
-    0x01, 0x7F, 0x2F, 0x00, 0x03, 0x81, 0xFD, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xF9, 0x00, 0x10, 0x00, 0x14, 0x78, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C,
-    0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xBC, 0x00, 0x3D, 0xBF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x7E, 0xFC, 0x00,
-    0x7E, 0x00, 0xBC, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD,
-    0x00, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-    0x03, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x2E, 0x01, 0xF8, 0xBF, 0xC3, 0xFE, 0x0B,
-    0x90, 0x00, 0x2D, 0x0B, 0xC0, 0xB4, 0x3D, 0x03, 0xC2, 0xE0, 0x0F, 0x1F, 0x00, 0x3C, 0xF8, 0x00,
-    0xF7, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xEF, 0x80,
-    0x2F, 0x3F, 0x80, 0xB8, 0x3F, 0x82, 0xE0, 0xBF, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xBE, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0xFD, 0x0F, 0xF0, 0x07, 0xF8, 0x7F, 0xC0, 0x2F,
-    0xE1, 0xEF, 0x80, 0xFB, 0x87, 0xAF, 0x07, 0xEF, 0x1E, 0x7D, 0x3E, 0xBC, 0x7C, 0xFD, 0xF2, 0xF2,
-    0xF2, 0xFF, 0xCB, 0xCB, 0xC3, 0xFE, 0x3F, 0x2F, 0x0B, 0xF0, 0xFC, 0xBC, 0x1F, 0xC3, 0xF7, 0xF0,
-    0x3D, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E,
-    0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xD0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C,
-    0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03,
-    0xFC, 0xFC, 0x01, 0xFC, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00,
-    0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x07, 0xEA, 0xF4, 0x74, 0x03, 0xC7,
-    0x40, 0x2D, 0x74, 0x02, 0xCB, 0x40, 0x7C, 0xBF, 0xFF, 0x8B, 0xFF, 0xD0, 0xB8, 0x00, 0x0B, 0x80,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7D, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x2E, 0x00, 0x03,
-    0xC0, 0xF0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x2D, 0x1F, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0x02, 0xD0,
-    0xF0, 0x00, 0x0F, 0x43, 0xD0, 0x14, 0x3C, 0x0F, 0xD1, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0xEA, 0xBC, 0x03, 0x00, 0x74, 0x0C, 0x00, 0xE0, 0x70, 0x07, 0x81,
-    0xE5, 0xBD, 0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0xBC, 0x0F, 0x42, 0xF0, 0x1F, 0x0B, 0xC0, 0x3C,
-    0x2F, 0x00, 0xF4, 0xFC, 0x07, 0xE3, 0xF0, 0x1F, 0xC0, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFC, 0x00,
-    0xF9, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xE4, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x25, 0x07, 0xFD,
-    0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x7C, 0x00,
-    0x0B, 0x83, 0xD0, 0x00, 0xF4, 0x2E, 0x00, 0x1F, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x40, 0x7D, 0x00,
-    0xB8, 0x0B, 0xC0, 0x07, 0xC0, 0xF8, 0x00, 0x3D, 0x1F, 0x40, 0x03, 0xF3, 0xF0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x02,
-    0xDB, 0x80, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0xB8, 0x3D, 0x01,
-    0xF0, 0x0F, 0x42, 0xE0, 0x3F, 0x40, 0xF0, 0x1F, 0x07, 0xFC, 0x1F, 0x00, 0xF0, 0xFF, 0xD2, 0xE0,
-    0x0F, 0x5F, 0x6F, 0x3D, 0x00, 0xFB, 0xF1, 0xF7, 0xC0, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x7F, 0xC0,
-    0xBF, 0x80, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x03, 0xC0, 0xF0, 0x02, 0xD0, 0x2E, 0x01, 0xE0, 0x03, 0xD0, 0xF0, 0x00, 0x7C, 0xF4, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x7E, 0x00, 0x1F,
-    0x8B, 0xD0, 0x0F, 0xC0, 0xFC, 0x0B, 0xD0, 0x1F, 0x87, 0xE0, 0x02, 0xF4, 0xB4, 0x00, 0x3D, 0x3C,
-    0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0, 0x15, 0x57, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x1A, 0x92, 0xFE, 0x2C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x07, 0x80, 0x78, 0x07, 0x40, 0x74, 0x07, 0x40, 0xB4,
-    0x0B, 0x40, 0xB0, 0x0B, 0xFC, 0xBF, 0xC0, 0x00, 0x08, 0x00, 0xA0, 0x07, 0x00, 0x30, 0x03, 0x80,
-    0x1C, 0x00, 0xD0, 0x0E, 0x00, 0xB0, 0x07, 0x40, 0x3C, 0x02, 0xC0, 0x1D, 0x00, 0xC0, 0x04, 0x6A,
-    0x4B, 0xF4, 0x07, 0x80, 0x78, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x02, 0xC0, 0x2C, 0x02, 0xC0, 0x2D, 0x02, 0xD0, 0x1D, 0x01, 0xD3, 0xFD,
-    0x3F, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0xED, 0x08, 0x09, 0x6A, 0xAA, 0xA6, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0xF0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0,
-    0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC,
-    0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x03,
-    0xC0, 0x00, 0x3E, 0xFE, 0x03, 0xF9, 0x7C, 0x3E, 0x01, 0xD3, 0xD0, 0x0E, 0x3C, 0x00, 0xE3, 0xD0,
-    0x1E, 0x2F, 0x9B, 0xC1, 0xFF, 0xF8, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F,
-    0x54, 0x3C, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0,
-    0x2F, 0x4D, 0x0F, 0xFE, 0xD2, 0xC0, 0xBC, 0x34, 0x03, 0xC7, 0x00, 0x3C, 0x70, 0x03, 0xC7, 0x80,
-    0x7C, 0x3F, 0xBF, 0xC1, 0xFF, 0xFC, 0x06, 0xF9, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70,
-    0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F,
-    0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x7F, 0x0E, 0x00, 0xD0, 0x0D, 0x07, 0xFF, 0x2F, 0x50, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1F, 0x01, 0xF0, 0x07, 0xE3, 0xC7, 0xFF, 0xF3, 0x81, 0xFD,
-    0xC0, 0x3E, 0x70, 0x0B, 0x9C, 0x02, 0xE7, 0x00, 0xF8, 0xFA, 0xFE, 0x1F, 0xFF, 0x81, 0xF9, 0xD0,
-    0x00, 0xF4, 0x50, 0xBC, 0x3F, 0xFE, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x02, 0xC0, 0x00,
-    0x2C, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0x8A, 0x80, 0x3F, 0xFF, 0x03, 0xE0, 0x78, 0x3C,
-    0x03, 0x83, 0xC0, 0x2C, 0x38, 0x02, 0xC3, 0x80, 0x2C, 0x7C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03,
-    0xC0, 0x28, 0x7C, 0x7C, 0x00, 0x00, 0x10, 0x34, 0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x7C,
-    0x00, 0xB4, 0x03, 0xD0, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70,
-    0x01, 0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xB0, 0x02, 0xC0, 0x0A, 0x00, 0x38, 0x02, 0xE0, 0xFF, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x03, 0x86,
-    0x40, 0x38, 0xF0, 0x03, 0xBC, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x7B, 0xD0, 0x07, 0x9F, 0x40,
-    0x78, 0xBD, 0x07, 0x82, 0xF8, 0x14, 0x0E, 0x03, 0x80, 0xD0, 0x74, 0x1D, 0x07, 0x01, 0xC0, 0xB0,
-    0x2C, 0x0B, 0x02, 0xC0, 0xBF, 0x2F, 0xD0, 0x1C, 0xBE, 0x0B, 0xD0, 0xBF, 0xBE, 0xFB, 0xC2, 0xF0,
-    0x3F, 0x03, 0x4F, 0x40, 0xB8, 0x0A, 0x3C, 0x01, 0xD0, 0x38, 0xF0, 0x0B, 0x00, 0xF3, 0xC0, 0x3C,
-    0x03, 0xCF, 0x00, 0xF0, 0x0F, 0x7C, 0x03, 0xC0, 0x3D, 0xE0, 0x1E, 0x00, 0xF0, 0x00, 0x10, 0x03,
-    0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0,
-    0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x08,
-    0x2E, 0x00, 0x3B, 0xEB, 0x40, 0xFC, 0x0B, 0x03, 0xD0, 0x1C, 0x0F, 0x00, 0x30, 0x3C, 0x00, 0xD0,
-    0xF8, 0x07, 0x03, 0xF9, 0x7C, 0x0F, 0xFF, 0xD0, 0x79, 0xFE, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x0F, 0xFD, 0xD0, 0x2C,
-    0x0B, 0xC0, 0x34, 0x07, 0xC0, 0x70, 0x03, 0xC0, 0x70, 0x07, 0xC0, 0x70, 0x0B, 0xC0, 0x3D, 0x6F,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x07, 0xF6, 0x80, 0x00, 0x03, 0x84, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0x00, 0x2D, 0xF0, 0xBF, 0xD2, 0xE0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-    0x40, 0x7D, 0x00, 0x07, 0xFD, 0x07, 0x55, 0x02, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x80, 0x00, 0xF0, 0x39, 0x7D, 0x3F, 0xFF, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80,
-    0x07, 0x80, 0x3F, 0xFC, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x80,
-    0x0B, 0xFC, 0x0B, 0xFC, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E,
-    0x01, 0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0xD0, 0x01,
-    0xC2, 0xC0, 0x0E, 0x07, 0x80, 0x74, 0x0F, 0x03, 0xC0, 0x1E, 0x1D, 0x00, 0x3C, 0xF0, 0x00, 0x7F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0xE3, 0xC0, 0x00,
-    0xB4, 0xF0, 0x20, 0x3C, 0x2D, 0x2F, 0x0F, 0x07, 0x9F, 0xE7, 0x80, 0xFF, 0xFF, 0xD0, 0x2F, 0xEF,
-    0xF0, 0x07, 0xF2, 0xFC, 0x00, 0xF4, 0x3E, 0x00, 0x0F, 0x01, 0xE0, 0x1E, 0x0F, 0x00, 0x2D, 0xF0,
-    0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x00, 0x3E, 0xF0, 0x02, 0xF2, 0xE0, 0x1F, 0x03,
-    0xD0, 0xF4, 0x0B, 0xC0, 0x34, 0x01, 0xD3, 0xC0, 0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B,
-    0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00,
-    0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xAA, 0xFC, 0x00,
-    0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xFF,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x07, 0x80, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x00, 0x0F,
-    0x00, 0xBD, 0x00, 0xBC, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0B,
-    0xF0, 0x01, 0xA0, 0x77, 0x77, 0x77, 0x66, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x07,
-    0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x02, 0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x01, 0xE0, 0x02,
-    0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x03, 0xD0, 0x3F, 0xC0, 0x2A, 0x00, 0x74, 0x2D, 0x92, 0xC2, 0xD0,
-    0x00, 0x15, 0x0F, 0xC3, 0xF0, 0xB8, 0x00, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
-    0x0B, 0x02, 0xC0, 0xB0, 0x2C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xC0,
-    0x0B, 0xF8, 0x2F, 0xE4, 0x3C, 0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x78, 0xC0, 0x3E, 0xC0,
-    0x2F, 0xFC, 0x07, 0xFD, 0x01, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xF8,
-    0x03, 0xD0, 0x74, 0x0D, 0x00, 0x00, 0x34, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x40,
-    0x00, 0x6F, 0xA9, 0x01, 0xFF, 0xFC, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xFF,
-    0xA5, 0x0F, 0xFF, 0xFD, 0x24, 0x06, 0x0F, 0xFF, 0xC1, 0xD1, 0xE0, 0xB0, 0x3C, 0x2D, 0x1E, 0x0B,
-    0xFF, 0xC7, 0xEE, 0xB8, 0x40, 0x04, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xC1, 0xE0, 0x3C, 0x02, 0xE3,
-    0xD0, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x90, 0x07, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x50, 0x07, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x77, 0x77, 0x70, 0x00, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x03, 0x41, 0x80,
-    0x60, 0x00, 0x07, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xEB, 0xC1, 0xC0, 0x0D, 0x1C, 0x01, 0xD0, 0xFF,
-    0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xC2, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x18, 0x0A, 0x0F, 0x47, 0xC3, 0xE2, 0xF0, 0x0A, 0x80, 0x84, 0x84, 0x80, 0x62, 0x02, 0x4B, 0x54,
-    0x91, 0x80, 0x64, 0x00, 0x00, 0x00, 0xFC, 0x20, 0xC2, 0x0C, 0x35, 0xD1, 0xF9, 0x00, 0x41, 0x01,
-    0xD1, 0xC1, 0xD2, 0xD1, 0xD2, 0xC0, 0x7C, 0xB8, 0x07, 0xCB, 0x80, 0x74, 0xB0, 0x04, 0x04, 0xAA,
-    0x54, 0xBF, 0xFE, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x6A, 0xA9, 0xBF, 0xFE, 0x05, 0x40, 0x95,
-    0x84, 0x44, 0x62, 0xD2, 0x48, 0x94, 0xA2, 0x80, 0x64, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x01, 0xE6, 0xD0, 0xE0, 0x2C, 0x38, 0x0B, 0x0F, 0x03, 0xC1, 0xFF, 0xD0,
-    0x1F, 0xD0, 0x00, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0xBF, 0xFF, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x18, 0x00, 0xC0, 0x30, 0x28, 0x2C, 0x1F, 0xC0, 0x00, 0x14,
-    0x00, 0x90, 0x04, 0x28, 0x02, 0x44, 0xA3, 0xF0, 0x28, 0xCB, 0x10, 0x3C, 0x00, 0xD3, 0xC0, 0x0D,
-    0x3D, 0x01, 0xE3, 0xD0, 0x1E, 0x3D, 0x01, 0xE3, 0xE0, 0x1E, 0x3F, 0x02, 0xE3, 0xFF, 0xFE, 0x3B,
-    0xFF, 0xE3, 0x2F, 0x8F, 0x30, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x2F, 0x4A, 0x7F, 0x0A, 0xBF,
-    0x0A, 0x7F, 0x0A, 0x3F, 0x0B, 0x0F, 0x0B, 0x1F, 0x07, 0x1F, 0x07, 0x2E, 0x07, 0x3E, 0x07, 0x3E,
-    0x07, 0x7E, 0x07, 0x7D, 0x07, 0x2C, 0x3D, 0x29, 0x00, 0x40, 0x58, 0x08, 0xB4, 0x28, 0x02, 0x00,
-    0x80, 0x20, 0x0C, 0x1F, 0xC0, 0x00, 0x0A, 0x42, 0x48, 0x30, 0x53, 0x09, 0x1F, 0xC0, 0x00, 0x40,
-    0x80, 0x2C, 0x3C, 0x02, 0xD2, 0xC0, 0x1D, 0x2C, 0x0F, 0x5F, 0x0F, 0x5F, 0x07, 0x4B, 0x00, 0x41,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x01, 0x80, 0x03, 0x40,
-    0x06, 0x00, 0x18, 0x00, 0x28, 0x00, 0xC0, 0x00, 0xA0, 0x0A, 0x00, 0x0B, 0xE4, 0x70, 0x00, 0x3F,
-    0xE3, 0x40, 0x80, 0x00, 0x2C, 0x0B, 0x00, 0x00, 0xD0, 0x7C, 0x00, 0x0E, 0x03, 0x30, 0x00, 0x70,
-    0x34, 0xD0, 0x03, 0x80, 0xFF, 0xD0, 0x2C, 0x00, 0x0D, 0x00, 0x90, 0x00, 0x34, 0x1E, 0x00, 0x00,
-    0x00, 0x58, 0x00, 0x00, 0x00, 0x60, 0x00, 0xD0, 0x01, 0x80, 0x07, 0x00, 0x0A, 0x00, 0x30, 0x00,
-    0x28, 0x02, 0x80, 0x02, 0xF9, 0x0D, 0xBD, 0x0F, 0xF8, 0xD5, 0x0D, 0x00, 0x07, 0x00, 0x28, 0x00,
-    0x34, 0x00, 0xE0, 0x02, 0xC0, 0x0B, 0x00, 0x1C, 0x00, 0xB4, 0x00, 0xE0, 0x0F, 0x80, 0x0B, 0x00,
-    0x7F, 0xE0, 0x34, 0x01, 0xAA, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00,
-    0xD0, 0x07, 0xE0, 0x06, 0x00, 0x01, 0xC0, 0x30, 0x00, 0x03, 0x42, 0x80, 0x06, 0xBC, 0x1C, 0x00,
-    0x2F, 0xD0, 0xD0, 0x20, 0x00, 0x0B, 0x02, 0xC0, 0x00, 0x34, 0x1F, 0x00, 0x03, 0x80, 0xCC, 0x00,
-    0x1C, 0x0D, 0x34, 0x00, 0xE0, 0x3F, 0xF4, 0x0B, 0x00, 0x03, 0x40, 0x24, 0x00, 0x0D, 0x00, 0x00,
-    0xA4, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07,
-    0x40, 0x00, 0x78, 0x00, 0x03, 0xD0, 0x14, 0x1F, 0xAB, 0x80, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00,
-    0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0,
-    0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x00, 0x03, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4,
-    0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03,
-    0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00,
-    0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x06,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x47, 0x40, 0x03, 0xC0, 0xF0, 0x01,
-    0xE0, 0x3D, 0x00, 0xB4, 0x07, 0x80, 0x3D, 0x01, 0xF0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xC7,
-    0xC0, 0x01, 0xF2, 0xF0, 0x00, 0x3E, 0x00, 0xA0, 0x50, 0x00, 0x33, 0x20, 0x00, 0x18, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4,
-    0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07,
-    0xCB, 0xC0, 0x00, 0xF8, 0x02, 0xD0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x29, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3,
-    0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0,
-    0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0,
-    0x00, 0xF8, 0x00, 0x19, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x3C, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x0B, 0x47, 0x40, 0x03, 0xC0, 0xF0, 0x01, 0xE0, 0x3D, 0x00,
-    0xB4, 0x07, 0x80, 0x3D, 0x01, 0xF0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xC7, 0xC0, 0x01, 0xF2,
-    0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xF9, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0xBC, 0x00, 0x00, 0x00, 0xB1, 0xF0, 0x00, 0x00,
-    0x07, 0x87, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0xFF, 0x80, 0x01, 0xE0, 0x3F, 0xFE, 0x00, 0x0F, 0x00,
-    0xF4, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xF4, 0x00, 0xFF, 0xFF, 0x8B, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40,
-    0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00,
-    0x02, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x74, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4,
-    0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00,
-    0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x70, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xE4, 0x74, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xFC,
-    0x0B, 0xFF, 0xC0, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFC, 0x00, 0xD0, 0x00, 0x2F, 0x40, 0x09, 0x0D, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0A, 0x06, 0x01, 0xF0, 0xF4, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x20, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x07, 0xC0,
-    0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBD,
-    0x04, 0x0C, 0x28, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x00, 0x00, 0x1C, 0x00, 0xFC, 0x1C, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
-    0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xD0, 0x2D, 0x0F, 0x0F, 0x47,
-    0xC2, 0x91, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x01, 0xF0,
-    0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0,
-    0x01, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xC0, 0x01,
-    0xF0, 0x03, 0xC0, 0x00, 0xF4, 0x2B, 0xEA, 0x00, 0xB8, 0x3F, 0xFF, 0x00, 0xBC, 0x03, 0xC0, 0x00,
-    0xBC, 0x03, 0xC0, 0x01, 0xFC, 0x03, 0xEA, 0xAF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x90, 0x01, 0x8C, 0x80, 0x01, 0x87, 0xC0, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xE0, 0x2E,
-    0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC,
-    0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x90, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4,
-    0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x0B, 0xEA, 0xF8, 0x0B, 0xD0, 0x1F, 0xC3, 0xD0, 0x01, 0xF5,
-    0xF0, 0x00, 0x3E, 0xB4, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F,
-    0xB4, 0x00, 0x07, 0xAF, 0x40, 0x03, 0xE3, 0xFE, 0xAF, 0xF0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0xB4,
-    0x00, 0x06, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xBE, 0xAF, 0x80, 0xBD, 0x01,
-    0xFC, 0x3D, 0x00, 0x1F, 0x5F, 0x00, 0x03, 0xEB, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x7A, 0xF4, 0x00, 0x3E, 0x3F, 0xEA, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x50, 0x00,
-    0x33, 0x54, 0x00, 0x08, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02,
-    0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC,
-    0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xF0,
-    0x00, 0xB8, 0x3C, 0x00, 0x2A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE,
-    0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB,
-    0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x24, 0x14,
-    0x1E, 0xF0, 0x07, 0xC0, 0x0F, 0xE0, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x6F, 0xEF, 0x40, 0x00, 0x00, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0xFC, 0x03,
-    0xF8, 0x00, 0x00, 0x7C, 0x02, 0xFF, 0x00, 0x00, 0x2E, 0x00, 0xF3, 0xD0, 0x00, 0x0F, 0x00, 0xF4,
-    0xB8, 0x00, 0x03, 0xC0, 0x7C, 0x2E, 0x00, 0x00, 0xF0, 0x3D, 0x07, 0x80, 0x00, 0x3C, 0x2F, 0x01,
-    0xE0, 0x00, 0x0F, 0x0F, 0x00, 0xB4, 0x00, 0x03, 0xFF, 0x80, 0x7D, 0x00, 0x00, 0x7F, 0xEA, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFB, 0xFF, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00,
-    0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC,
-    0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x78, 0x00, 0x01, 0xDE, 0x00, 0x02, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C,
-    0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x0B, 0xC3,
-    0xD0, 0x0A, 0x82, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3,
-    0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x38, 0x00, 0x0E, 0x40,
-    0x03, 0xFE, 0x00, 0xE1, 0xF0, 0x38, 0x0F, 0x0E, 0x00, 0xD3, 0x80, 0x74, 0xE0, 0xBC, 0x3E, 0xF8,
-    0x0F, 0xE0, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x07, 0xE4, 0x02, 0xC0, 0xD0, 0x34,
-    0x03, 0x03, 0x01, 0xB0, 0x30, 0x30, 0x07, 0x46, 0x00, 0x74, 0x70, 0x07, 0x43, 0xD0, 0x74, 0x0B,
-    0x47, 0x40, 0x2C, 0xB4, 0x03, 0xCB, 0xAF, 0xF8, 0xB9, 0xFE, 0x00, 0x04, 0x00, 0x00, 0xB4, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70,
-    0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xA0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00,
-    0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x03, 0xF0,
-    0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47,
-    0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x0B,
-    0x45, 0x00, 0xCC, 0x90, 0x1C, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B,
-    0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0,
-    0xBE, 0x6C, 0x19, 0x0A, 0x02, 0xE0, 0xF0, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA,
-    0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC,
-    0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x01, 0xA0, 0x00, 0x22, 0x00, 0x02, 0x20, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03,
-    0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF7, 0x1F, 0xE0, 0x0F, 0xAF, 0xF4, 0x28, 0x3C, 0x0B, 0xC0, 0x0C, 0x34, 0x07, 0xDA, 0xFE, 0x70,
-    0x03, 0xFE, 0xA9, 0x70, 0x03, 0x80, 0x00, 0x70, 0x0B, 0xC0, 0x00, 0x3E, 0xBF, 0xF9, 0x05, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x0B, 0xE6, 0xDF, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74,
-    0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x07, 0xFD, 0x00, 0x90, 0x00,
-    0x14, 0x00, 0x14, 0x01, 0xE0, 0x04, 0x00, 0x00, 0x74, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA,
-    0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0x90, 0x00,
-    0x2F, 0x00, 0x06, 0x1C, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4,
-    0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18,
-    0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x0A, 0x06, 0x01, 0xF0, 0xF4, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA,
-    0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x24, 0x01, 0xE0,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x34, 0x03, 0x40, 0x34, 0x03, 0x40, 0x34, 0x03, 0x80, 0x38, 0x03,
-    0x80, 0x7C, 0x00, 0x0D, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x34, 0x34, 0x38,
-    0x38, 0x38, 0x7C, 0x00, 0x00, 0x0D, 0x00, 0xED, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0xD0, 0x03, 0x40, 0x0D, 0x00, 0x34, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x7C, 0x00, 0x2D, 0x0F,
-    0x0F, 0x87, 0xC2, 0x91, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x03, 0x40,
-    0x00, 0xD0, 0x00, 0x34, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xAF, 0xA8, 0x00, 0x3F, 0xFF, 0x00, 0x10,
-    0x30, 0x00, 0xFF, 0x5C, 0x00, 0xF0, 0x7B, 0x00, 0x74, 0x0B, 0x80, 0x2C, 0x01, 0xD0, 0x0B, 0x00,
-    0x70, 0x01, 0xF4, 0x78, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x03, 0xC2, 0x00, 0x63,
-    0x30, 0x05, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34,
-    0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x04,
-    0x00, 0x00, 0x74, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3,
-    0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80,
-    0x1F, 0xAF, 0x03, 0x80, 0x38, 0x34, 0x02, 0xC7, 0x00, 0x1C, 0x74, 0x01, 0xC3, 0x80, 0x2C, 0x3E,
-    0xAF, 0x81, 0xFF, 0xF0, 0x06, 0xF8, 0x00, 0x00, 0xD0, 0x00, 0x2F, 0x00, 0x0A, 0x0C, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x07,
-    0x42, 0x00, 0xC9, 0x20, 0x0C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3,
-    0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x0A, 0x06, 0x01, 0xF0, 0xF4, 0x2F, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C,
-    0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x2C,
-    0x00, 0x03, 0x80, 0x00, 0x30, 0x00, 0x07, 0x00, 0x00, 0xA0, 0x00, 0x0D, 0x00, 0x01, 0xC0, 0x06,
-    0xFC, 0x01, 0xFB, 0xF0, 0x38, 0x37, 0xC3, 0x4B, 0x2C, 0x70, 0xF1, 0xC7, 0x0E, 0x1C, 0x79, 0xD2,
-    0xC3, 0xFE, 0xB8, 0x1F, 0xFF, 0x00, 0x7F, 0x80, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01,
-    0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x74, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1C, 0x00, 0xD7, 0x00, 0x35, 0xD0,
-    0x1E, 0x74, 0x07, 0x8D, 0x01, 0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F, 0xFF, 0x8B, 0xFF, 0xE0, 0xBE,
-    0x3C, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01,
-    0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF8, 0xF0, 0x00, 0x80, 0x00, 0xF8, 0x00, 0xD2,
-    0x80, 0x40, 0x10, 0x00, 0x00, 0x1C, 0x00, 0xD7, 0x00, 0x35, 0xD0, 0x1E, 0x74, 0x07, 0x8D, 0x01,
-    0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F, 0xFF, 0x8B, 0xFF, 0xE0, 0xBE, 0x3C, 0x18, 0x0A, 0x0F, 0x47,
-    0xC3, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xD7, 0x00, 0x35, 0xD0, 0x1E, 0x74, 0x07,
-    0x8D, 0x01, 0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F, 0xFF, 0x8B, 0xFF, 0xE0, 0xBE, 0x3C, 0x00, 0x18,
-    0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x1D, 0x3C, 0x02, 0xC1, 0xE0, 0x3C, 0x0F, 0x03, 0x80, 0x78,
-    0xB4, 0x03, 0xCF, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0,
-    0x01, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xB0, 0x00,
-    0xB0, 0x00, 0xBF, 0x40, 0xB1, 0xF0, 0xB0, 0x38, 0xB0, 0x1C, 0xB0, 0x1C, 0xB0, 0x38, 0xB0, 0xB0,
-    0x77, 0xD0, 0x7E, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x0F, 0x07, 0x80, 0xF0,
-    0xB8, 0x1A, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xD3, 0xC0, 0x2C,
-    0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38,
-    0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4,
-    0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x15, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B,
-    0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0,
-    0xBE, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x28, 0x00, 0x1F, 0xAC, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x0F, 0x38, 0x00, 0x03, 0x8F, 0x00, 0x02, 0xD1, 0xD0, 0x00, 0xF0, 0x3C, 0x00,
-    0x78, 0x0F, 0x40, 0x2D, 0x01, 0xE0, 0x0F, 0x40, 0x7C, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF1,
-    0xF0, 0x00, 0x7C, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0x80, 0x60, 0x0F, 0xAD, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74,
-    0x70, 0x03, 0x87, 0x00, 0x38, 0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3, 0xC0, 0x00,
-    0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0, 0x1F, 0x01,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00,
-    0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x60, 0x00, 0x09, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F,
-    0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xA0, 0x00,
-    0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00, 0x74,
-    0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x02, 0xD0, 0x0A, 0x74, 0x14, 0x08, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74,
-    0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x02, 0xE0, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC,
-    0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD0, 0x00, 0x3B, 0x40, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD,
-    0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x04, 0x0A, 0x34,
-    0x02, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00,
-    0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x81, 0xC0, 0x00, 0x1E, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x3C, 0x01, 0xFC, 0x0F, 0x00,
-    0x0F, 0x83, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x3E, 0x3C, 0x00, 0x0B, 0xCF, 0x00, 0x02, 0xF3, 0xC0,
-    0x00, 0xBC, 0xF0, 0x00, 0x7F, 0x3E, 0xAA, 0xFF, 0x8F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x34, 0x50, 0x00, 0x0D, 0x28, 0x00, 0x03, 0x4E,
-    0x00, 0x00, 0xD3, 0x80, 0xBD, 0x34, 0x00, 0xFF, 0xED, 0x00, 0xB0, 0x2F, 0x00, 0x34, 0x03, 0xC0,
-    0x1C, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x01, 0xE0, 0x1F, 0x00, 0x3F, 0xBF, 0xC0, 0x07, 0xFF, 0xF0,
-    0x00, 0x6F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xF0, 0x03,
-    0xC0, 0x00, 0xF4, 0x2B, 0xEA, 0x00, 0xB8, 0x3F, 0xFF, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0xBC, 0x03,
-    0xC0, 0x01, 0xFC, 0x03, 0xEA, 0xAF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x02, 0xAF, 0xA0, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0xD0, 0x00, 0xBD, 0x34, 0x00, 0xFF, 0xED, 0x00, 0xB0, 0x2F, 0x00, 0x34, 0x03, 0xC0,
-    0x1C, 0x00, 0xF0, 0x07, 0x00, 0x3C, 0x01, 0xE0, 0x1F, 0x00, 0x3F, 0xBF, 0xC0, 0x07, 0xFF, 0xF0,
-    0x00, 0x6F, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x01,
-    0xC0, 0x30, 0x0F, 0xAF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0D, 0x03, 0x00, 0xD0, 0x70, 0x07, 0xFC, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0xA0, 0x00,
-    0x0F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC7, 0xFF,
-    0xE4, 0x74, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xFC, 0x0B, 0xFF, 0xC0,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03,
-    0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x47, 0x40,
-    0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xFC, 0x0B, 0x40, 0x00,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x18, 0x00, 0x03,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A,
-    0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x14, 0x1F, 0xFF, 0xC0, 0x2F, 0xE4,
-    0x00, 0x60, 0x00, 0x08, 0x00, 0x02, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x90, 0xA0, 0x02, 0xB8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFC, 0x7F, 0xFE, 0x47, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x0B, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x09, 0x06, 0x00, 0x3A, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8,
-    0x70, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x02, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0xBE, 0x40, 0x10, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xFE, 0x2E, 0x00,
-    0x17, 0xF2, 0xF0, 0x00, 0x38, 0x1F, 0xD0, 0x07, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0x90, 0x00, 0x90, 0x00, 0x7C, 0x00, 0x71, 0xC0, 0x10, 0x04, 0x00, 0x00, 0x01, 0xF8,
-    0xF1, 0xFF, 0xFC, 0xE0, 0x7F, 0x70, 0x0F, 0x9C, 0x02, 0xE7, 0x00, 0xB9, 0xC0, 0x3E, 0x3E, 0xBF,
-    0x87, 0xFF, 0xE0, 0x7E, 0x74, 0x00, 0x3D, 0x14, 0x2F, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0xC0, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x2F, 0xFF, 0xF0, 0x0B, 0xE4, 0x01, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x00, 0xBF, 0xE2, 0xE0, 0x01, 0x7F, 0x2F, 0x00, 0x03, 0x81, 0xFD, 0x00, 0x7C, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xF9, 0x00, 0x1D, 0x03, 0x03, 0x41, 0xC0, 0xBF,
-    0xC0, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3C, 0x7F, 0xFF, 0x38, 0x1F, 0xDC, 0x03,
-    0xE7, 0x00, 0xB9, 0xC0, 0x2E, 0x70, 0x0F, 0x8F, 0xAF, 0xE1, 0xFF, 0xF8, 0x1F, 0x9D, 0x00, 0x0F,
-    0x45, 0x0B, 0xC3, 0xFF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x02,
-    0xFF, 0xFF, 0x00, 0xBE, 0x40, 0x10, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xFE, 0x2E, 0x00, 0x17, 0xF2, 0xF0,
-    0x00, 0x38, 0x1F, 0xD0, 0x07, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0x90,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xF1, 0xFF, 0xFC,
-    0xE0, 0x7F, 0x70, 0x0F, 0x9C, 0x02, 0xE7, 0x00, 0xB9, 0xC0, 0x3E, 0x3E, 0xBF, 0x87, 0xFF, 0xE0,
-    0x7E, 0x74, 0x00, 0x3D, 0x14, 0x2F, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x2F, 0xFF, 0xF0, 0x0B, 0xE4, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xE2, 0xE0, 0x01, 0x7F,
-    0x2F, 0x00, 0x03, 0x81, 0xFD, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F,
-    0x40, 0x07, 0xC0, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x7E, 0x3C, 0x7F, 0xFF, 0x38, 0x1F, 0xDC, 0x03,
-    0xE7, 0x00, 0xB9, 0xC0, 0x2E, 0x70, 0x0F, 0x8F, 0xAF, 0xE1, 0xFF, 0xF8, 0x1F, 0x9D, 0x00, 0x0F,
-    0x45, 0x0B, 0xC3, 0xFF, 0xE0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xAE, 0x00, 0x02, 0x42, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x78, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xBC, 0x00,
-    0x3D, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x3E,
-    0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x7E, 0x00, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x0A, 0x70, 0x00, 0x24,
-    0x08, 0x00, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0,
-    0x00, 0x03, 0x8A, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xE0, 0x78, 0x03, 0xC0, 0x38, 0x03, 0xC0, 0x2C,
-    0x03, 0x80, 0x2C, 0x03, 0x80, 0x2C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x09,
-    0x00, 0x06, 0x01, 0xE0, 0x00, 0xF0, 0x2E, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0xF0, 0x2E, 0x00, 0x0F,
-    0x4B, 0xFF, 0xFF, 0xFC, 0x7F, 0xAA, 0xAF, 0x82, 0xF0, 0x00, 0xF4, 0x2F, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0x83, 0xF0, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0x83, 0xF0, 0x01, 0xF8,
-    0x3F, 0x00, 0x1F, 0x80, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0x8A, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xE0, 0x78, 0x03, 0xC0, 0x38, 0x03,
-    0xC0, 0x2C, 0x03, 0x80, 0x2C, 0x03, 0x80, 0x2C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x07, 0xC0,
-    0x3C, 0x2C, 0x00, 0xCC, 0x96, 0x1F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x02, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xD0, 0x1D, 0x04, 0xC9, 0x63, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x34, 0x00, 0xD0, 0x03, 0x40, 0x0D, 0x00, 0x34, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2F,
-    0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7F, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40,
-    0x03, 0x40, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x00, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x3F, 0x20, 0x60, 0x3D, 0x00, 0x0A, 0x07, 0xC1,
-    0xF0, 0x00, 0x00, 0x01, 0x00, 0xD0, 0x34, 0x0D, 0x03, 0x40, 0xD0, 0x38, 0x0E, 0x03, 0x81, 0xF0,
-    0x90, 0x30, 0x0B, 0x80, 0x00, 0x64, 0xB8, 0xFC, 0x00, 0x00, 0x00, 0x10, 0xBC, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD, 0x00, 0xD3, 0x4D, 0x34, 0xD3, 0x8E,
-    0x39, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xC7, 0xC0, 0x0F, 0x1F, 0x00, 0x7C, 0x7C, 0x01, 0xF1,
-    0xF0, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0x7C, 0x7C, 0x01, 0xF1, 0xF0, 0x07, 0xC7, 0xC0, 0x2E,
-    0x1F, 0x00, 0xB8, 0xBC, 0x02, 0xE2, 0xF0, 0x0B, 0x8B, 0xD0, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x28, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xC7, 0xC0, 0x00,
-    0xF0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x40, 0x00, 0xB0, 0xD0, 0x00,
-    0x2C, 0x34, 0x00, 0x0F, 0x0D, 0x00, 0x03, 0x83, 0x40, 0x00, 0xE0, 0xE0, 0x00, 0x38, 0x38, 0x00,
-    0x0E, 0x0E, 0x00, 0x03, 0x47, 0xC0, 0x00, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0D, 0xA0, 0x20, 0x28,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
-    0x00, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0xE0, 0xBF, 0xC0,
-    0xFF, 0x80, 0xB9, 0x00, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x30, 0xA0, 0x10, 0x04, 0x00, 0x10, 0x00,
-    0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x02, 0xC0, 0x00,
-    0xB0, 0x00, 0x28, 0x00, 0x0E, 0x00, 0x0B, 0x80, 0x3F, 0xC0, 0x0A, 0x40, 0x00, 0x2D, 0x0B, 0xC0,
-    0xB4, 0x3D, 0x03, 0xC2, 0xE0, 0x0F, 0x1F, 0x00, 0x3C, 0xF8, 0x00, 0xF7, 0xC0, 0x03, 0xFD, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xEF, 0x80, 0x2F, 0x3F, 0x80, 0xB8, 0x3F,
-    0x82, 0xE0, 0xBF, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x7C,
-    0x00, 0x02, 0xF0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x38, 0x00, 0x03, 0x86, 0x40, 0x38, 0xF0, 0x03, 0xBC, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x7B, 0xD0, 0x07, 0x9F, 0x40, 0x78, 0xBD, 0x07, 0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x0C, 0x34, 0x1C, 0xB0,
-    0x1D, 0xC0, 0x2F, 0x80, 0x2F, 0x00, 0x2F, 0x40, 0x3B, 0xD0, 0x38, 0xF4, 0x38, 0x7D, 0x0C, 0x00,
-    0x0A, 0x00, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02,
-    0xE0, 0x00, 0xB4, 0x00, 0x2F, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0xC0, 0xD0, 0x70,
-    0x00, 0x00, 0x01, 0x40, 0xE0, 0x38, 0x0D, 0x07, 0x41, 0xD0, 0x70, 0x1C, 0x0B, 0x02, 0xC0, 0xB0,
-    0x2C, 0x0B, 0xF2, 0xFD, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E,
-    0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xBE,
-    0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x14, 0x0E, 0x03, 0x80, 0xD0, 0x74, 0x1D, 0x07, 0x01, 0xC0,
-    0xB0, 0x2C, 0x0B, 0x02, 0xC0, 0xBF, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x0F, 0x83, 0xD1, 0xF0, 0x68,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x0B, 0x1E, 0x02, 0x87, 0x80,
-    0xE1, 0xE0, 0x24, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xBE, 0xAB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x28, 0x34, 0xE0, 0xC3, 0x87, 0x0D, 0x08, 0x74, 0x01, 0xD0, 0x07, 0x00, 0x1C,
-    0x00, 0xB0, 0x02, 0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x07, 0x80, 0x01, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x02, 0x97, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x0B, 0x40, 0x02, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x14, 0x00, 0xE0, 0x03,
-    0x80, 0x0D, 0x00, 0x74, 0x79, 0xD2, 0xE7, 0x0A, 0x9C, 0x00, 0xB0, 0x02, 0xC0, 0x0B, 0x00, 0x2C,
-    0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF1, 0xD0, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x01, 0xEB,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x3E, 0xFA, 0xAF, 0x00, 0xB3, 0xFF, 0xFF, 0x01, 0xE3, 0xFF, 0xFF, 0x03, 0xC0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x74, 0x00, 0x01, 0xDA, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x2E, 0xB0, 0x07, 0x82, 0xC0, 0x00,
-    0x0B, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x03, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2E, 0x00, 0x1E, 0x3F, 0x00, 0x1E,
-    0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xE0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C,
-    0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03,
-    0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83,
-    0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F, 0xD0, 0x2E, 0x3D, 0xF0,
-    0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC,
-    0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0,
-    0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C,
-    0x03, 0xC7, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0,
-    0x00, 0x68, 0x00, 0x01, 0x00, 0x40, 0x00, 0xD2, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0,
-    0x2E, 0x3F, 0xD0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D,
-    0x7C, 0x1F, 0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x01, 0xFC, 0x05,
-    0x02, 0x00, 0x29, 0xD0, 0x00, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7,
-    0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x07, 0x40, 0x07, 0x80, 0x07, 0xC0,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0E, 0xFF, 0x43, 0xD0, 0xF0,
-    0xF0, 0x1D, 0x78, 0x07, 0x5E, 0x01, 0xE7, 0x80, 0x79, 0xE0, 0x1E, 0xB8, 0x07, 0xAF, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x1E, 0x3F, 0x00, 0x1E, 0x3F, 0x80, 0x2E, 0x3F, 0xC0, 0x2E, 0x3F,
-    0xD0, 0x2E, 0x3D, 0xF0, 0x3D, 0x3C, 0xF4, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0x3D, 0x3D, 0x7C, 0x1F,
-    0x3D, 0xBC, 0x0F, 0xBC, 0xBC, 0x07, 0xFC, 0xBC, 0x03, 0xFC, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x3F, 0xE0, 0x00, 0x14, 0x00, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B, 0x03, 0xC0, 0x34,
-    0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7, 0xC0, 0x7C, 0x00,
-    0x07, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0,
-    0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x41, 0x95, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x1F, 0xAF, 0x03, 0x80, 0x38, 0x34, 0x02,
-    0xC7, 0x00, 0x1C, 0x74, 0x01, 0xC3, 0x80, 0x2C, 0x3E, 0xAF, 0x81, 0xFF, 0xF0, 0x06, 0xF8, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x60, 0x1C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x2F, 0xAB, 0xE0, 0x2F, 0x40, 0x7F, 0x0F, 0x40, 0x07,
-    0xD7, 0xC0, 0x00, 0xFA, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3E, 0xD0, 0x00, 0x1E, 0xBD, 0x00, 0x0F, 0x8F, 0xFA, 0xBF, 0xC2, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF,
-    0xF0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x30, 0x0F, 0xAF, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA,
-    0xF0, 0x38, 0x03, 0x83, 0x40, 0x2C, 0x70, 0x01, 0xC7, 0x40, 0x1C, 0x38, 0x02, 0xC3, 0xEA, 0xF8,
-    0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x50, 0x01, 0x40, 0x2D, 0x00, 0xB0, 0x0B, 0x40, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x0B, 0xEA, 0xF8, 0x02, 0xF4, 0x07,
-    0xF0, 0x3D, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xF8, 0xB4, 0x00, 0x07, 0xCF, 0x40, 0x00, 0x3C, 0xF0,
-    0x00, 0x03, 0xCF, 0x40, 0x00, 0x3C, 0xB4, 0x00, 0x07, 0x8B, 0xD0, 0x00, 0xF8, 0x3F, 0xEA, 0xFF,
-    0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0x81, 0xF0, 0x07, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x07, 0xEB, 0xC0, 0x03, 0x80, 0x38, 0x00,
-    0xD0, 0x0B, 0x00, 0x70, 0x01, 0xC0, 0x1D, 0x00, 0x70, 0x03, 0x80, 0x2C, 0x00, 0xFA, 0xBE, 0x00,
-    0x1F, 0xFF, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x01, 0xBF, 0xDA, 0xFF, 0xF0, 0x2F, 0xAB, 0xFF, 0xFF,
-    0xC2, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xD0,
-    0x00, 0x3F, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0xF4, 0x3C, 0x00, 0x07, 0xFF, 0xD0, 0xF4, 0x00, 0x1F,
-    0xC0, 0x02, 0xE0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x0F, 0xFA, 0xBF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x1B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x03, 0xF8, 0x01, 0xFA, 0xF7, 0x81, 0xC0, 0xE0, 0x0F, 0x80, 0x28,
-    0x34, 0x02, 0xEA, 0xBF, 0x1C, 0x00, 0x7F, 0xAA, 0x47, 0x40, 0x2C, 0x00, 0x00, 0xE0, 0x0B, 0x80,
-    0x00, 0x3E, 0xAB, 0xFD, 0x05, 0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x6F, 0x80, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x0E, 0xAB, 0xC0, 0x30, 0x07, 0x40, 0xC0, 0x0E, 0x07, 0x00, 0x78, 0x1E, 0x5B, 0xD0, 0x7F,
-    0xFD, 0x01, 0xFF, 0xF8, 0x0B, 0xC0, 0xF4, 0x2F, 0x01, 0xF0, 0xBC, 0x03, 0xC2, 0xF0, 0x0F, 0x4F,
-    0xC0, 0x7E, 0x3F, 0x01, 0xFC, 0x02, 0x40, 0x0C, 0x00, 0xB0, 0x01, 0x00, 0x00, 0x00, 0xB7, 0xC2,
-    0xFF, 0x4B, 0x80, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x3F, 0xF8,
-    0x00, 0xEA, 0xBC, 0x03, 0x00, 0x74, 0x0C, 0x00, 0xE0, 0x70, 0x07, 0x81, 0xE5, 0xBD, 0x07, 0xFF,
-    0xD0, 0x1F, 0xFF, 0x80, 0xBC, 0x0F, 0x42, 0xF0, 0x1F, 0x0B, 0xC0, 0x3C, 0x2F, 0x00, 0xF4, 0xFC,
-    0x07, 0xE3, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1A, 0x00, 0x00, 0x0B, 0x7C, 0x0B, 0xFD, 0x0B,
-    0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x1F, 0x40, 0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x34, 0x00, 0x3B, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x0E, 0xAB, 0xC0, 0x30, 0x07, 0x40, 0xC0, 0x0E, 0x07, 0x00, 0x78, 0x1E, 0x5B, 0xD0,
-    0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x0B, 0xC0, 0xF4, 0x2F, 0x01, 0xF0, 0xBC, 0x03, 0xC2, 0xF0, 0x0F,
-    0x4F, 0xC0, 0x7E, 0x3F, 0x01, 0xFC, 0x20, 0x08, 0x1D, 0x70, 0x07, 0xC0, 0x01, 0x40, 0x00, 0x00,
-    0x0B, 0x7C, 0x0B, 0xFD, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x40,
-    0x1F, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x03, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0x90, 0x00, 0x07,
-    0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0xBF, 0xFD, 0x00,
-    0x01, 0xBF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x42, 0x50, 0x7F, 0xD2, 0xFF, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x0E,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x75, 0x50, 0x28, 0x00, 0x0B, 0x40,
-    0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0x03, 0x97, 0xD3, 0xFF, 0xF0, 0xBF, 0xF4, 0x00, 0x28,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x28, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x3E, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0xF9, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0xFD, 0x09, 0x41, 0xFF, 0x4B, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC0, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x78, 0x00, 0x77, 0x80, 0x60, 0x24, 0x00, 0x00, 0x01, 0xFF,
-    0x41, 0xD5, 0x40, 0xA0, 0x00, 0x2D, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3C, 0x0E, 0x5F,
-    0x4F, 0xFF, 0xC2, 0xFF, 0xD0, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xF9, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x25, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x10, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x02, 0xE0, 0x00, 0x07, 0xFD, 0x07, 0x55, 0x02, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x80, 0x00, 0xF0, 0x39, 0x7D, 0x3F, 0xFF, 0x0B, 0xFF, 0x40, 0x08, 0x00, 0x03, 0x40, 0x00, 0x08,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xA0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xFF, 0xF0,
-    0x03, 0xE4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFF, 0x90,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x94, 0x1F,
-    0xF4, 0xBF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
-    0x02, 0x8B, 0x00, 0x2F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x75, 0x50,
-    0x28, 0x00, 0x0B, 0x40, 0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0x03, 0x97, 0xD3, 0xFF, 0xF0,
-    0xBF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x07, 0x80, 0x3F, 0xFC, 0x07,
-    0x40, 0x07, 0x40, 0x07, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0x00,
-    0x90, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x00, 0x40, 0x02, 0x82, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0x00, 0x0B, 0x02, 0x8B, 0x03, 0x85, 0x07, 0x80, 0x3F, 0xFC, 0x07, 0x40, 0x07,
-    0x40, 0x07, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x80, 0x0B, 0xFC, 0x0B, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x0A,
-    0xFE, 0x90, 0x0F, 0xFF, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0E, 0x00, 0x07, 0x80,
-    0x0F, 0xFF, 0x00, 0x74, 0x02, 0xBF, 0xA0, 0xFF, 0xFC, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x2E, 0x00,
-    0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xD0, 0x80, 0x03, 0x35, 0x80, 0x03, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xBC, 0x00, 0x7D,
-    0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x09, 0x06, 0x32, 0x01, 0x47, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0xD7, 0x00, 0x35, 0xD0, 0x1E, 0x74, 0x07, 0x8D, 0x01, 0xE3, 0x80, 0x78, 0xF0, 0x2E, 0x3F,
-    0xFF, 0x8B, 0xFF, 0xE0, 0xBE, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00,
-    0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C,
-    0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7,
-    0x40, 0x79, 0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01, 0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82,
-    0xF8, 0xF0, 0x00, 0x40, 0x40, 0x07, 0x01, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xBC, 0x00, 0x7D,
-    0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x38, 0x06, 0x0A, 0x03, 0x40, 0xFF, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x35, 0xC0, 0x0D, 0x74, 0x07, 0x9D, 0x01, 0xE3, 0x40, 0x78, 0xE0, 0x1E, 0x3C,
-    0x0B, 0x8F, 0xFF, 0xE2, 0xFF, 0xF8, 0x2F, 0x8F, 0x00, 0x68, 0x00, 0x00, 0x85, 0x00, 0x00, 0x85,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8,
-    0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x88, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x35, 0xC0, 0x0D, 0x74, 0x07, 0x9D, 0x01,
-    0xE3, 0x40, 0x78, 0xE0, 0x1E, 0x3C, 0x0B, 0x8F, 0xFF, 0xE2, 0xFF, 0xF8, 0x2F, 0x8F, 0x01, 0x80,
-    0x06, 0x02, 0xD0, 0x0B, 0x42, 0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x07, 0xD3, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x7D, 0x2E, 0x00, 0x1F, 0x0B, 0x80,
-    0x07, 0xC2, 0xE0, 0x00, 0xF0, 0xB8, 0x00, 0x3C, 0x2E, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC1, 0xF0,
-    0x01, 0xF0, 0x7E, 0x01, 0xFC, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x1D, 0x1E, 0x00, 0xB8, 0x14, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0xD0, 0x1C, 0x00, 0xD0, 0x1D, 0x01, 0xE0, 0x1D, 0x01, 0xE0, 0x0D, 0x01,
-    0xE0, 0x0E, 0x01, 0xE0, 0x0F, 0x02, 0xE0, 0x0F, 0xFF, 0xE0, 0x0B, 0xFF, 0xE0, 0x02, 0xF8, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xB8, 0x00, 0x7C, 0xB8,
-    0x00, 0x7C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3C, 0x7C, 0x00,
-    0x7C, 0x7E, 0x01, 0xFC, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x06, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x03, 0x5C, 0x00, 0xD7, 0x40, 0x79,
-    0xD0, 0x1E, 0x34, 0x07, 0x8E, 0x01, 0xE3, 0xC0, 0xB8, 0xFF, 0xFE, 0x2F, 0xFF, 0x82, 0xF9, 0xF0,
-    0x00, 0x90, 0x00, 0x60, 0x00, 0x28, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0A, 0x2C, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0xB8, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x7C, 0x3C,
-    0x00, 0x00, 0x0B, 0x83, 0xD0, 0x1F, 0x00, 0xF4, 0x2E, 0x03, 0xF4, 0x0F, 0x01, 0xF0, 0x7F, 0xC1,
-    0xF0, 0x0F, 0x0F, 0xFD, 0x2E, 0x00, 0xF5, 0xF6, 0xF3, 0xD0, 0x0F, 0xBF, 0x1F, 0x7C, 0x00, 0xBF,
-    0xE0, 0xFF, 0xC0, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x03, 0xF4, 0x03, 0xF0,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0A, 0x28, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x78, 0xF0, 0x00, 0x2D, 0x3C, 0x08, 0x0F, 0x0B, 0x4B,
-    0xC3, 0xC1, 0xE7, 0xF9, 0xE0, 0x3F, 0xFF, 0xF4, 0x0B, 0xFB, 0xFC, 0x01, 0xFC, 0xBF, 0x00, 0x3D,
-    0x0F, 0x80, 0x00, 0x10, 0x00, 0x00, 0x78, 0x00, 0x01, 0xDA, 0x00, 0x02, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0,
-    0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x1D, 0x3C, 0x02, 0xC1, 0xE0, 0x3C, 0x0F, 0x03, 0x80, 0x78, 0xB4, 0x03, 0xCF, 0x00, 0x1F,
-    0xF0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x01, 0xF8, 0x03, 0xFF, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0x42, 0x80, 0x07, 0xC3, 0xD0, 0x0B, 0xC3, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4,
-    0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFC, 0x01, 0x55, 0x7F, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFD, 0x00, 0x28, 0x00, 0x03, 0x00, 0x00, 0xB0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0xAA, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xF8, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF0, 0x05, 0x55, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEA,
-    0xAA, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF4, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x0A, 0xAF, 0xC0, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x01, 0x00,
-    0x40, 0x00, 0x34, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFC, 0x01, 0x55, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFD, 0x08,
-    0x02, 0x00, 0x3A, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0xAA, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF0, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFD, 0x2C, 0x03, 0x80, 0x34, 0x03, 0x40,
-    0x38, 0x03, 0x80, 0x38, 0x07, 0x80, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0x14, 0x00, 0xF0, 0x02,
-    0xD0, 0x28, 0xCB, 0x10, 0x03, 0x40, 0x3F, 0x03, 0x43, 0x00, 0x00, 0x74, 0x2D, 0x92, 0xC2, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x73, 0xEB, 0x47, 0xF8, 0x00, 0x00, 0x18, 0x3D, 0x3E, 0x18, 0x0A, 0x0F, 0x47,
-    0xC3, 0xE2, 0xF0, 0x18, 0x07, 0x0C, 0x00, 0x28, 0x85, 0x85, 0x7C, 0x00, 0x90, 0x02, 0x40, 0xF0,
-    0x07, 0x81, 0xE0, 0x07, 0x80, 0x00, 0x00, 0xD0, 0xC0, 0xFC, 0x00, 0xD0, 0x14, 0x00, 0x90, 0x03,
-    0x80, 0x1E, 0x00, 0x2C, 0x01, 0xE0, 0x14, 0x0F, 0x83, 0xF0, 0x7C, 0x0F, 0x40, 0x1F, 0x47, 0xC1,
-    0xF0, 0xF8, 0x29, 0x00, 0x3E, 0x0F, 0x82, 0xF0, 0x7C, 0x0A, 0x40, 0x00, 0x3B, 0xC3, 0x00, 0x02,
-    0x4B, 0xA4, 0x00, 0xBE, 0xA4, 0x55, 0xE0, 0x03, 0x80, 0x0A, 0x00, 0x83, 0x24, 0x18, 0x20, 0x00,
-    0x14, 0xBE, 0xBE, 0x14, 0x00, 0x00, 0x14, 0x68, 0x00, 0x00, 0x14, 0x7F, 0xFE, 0x00, 0x00, 0x18,
-    0x3D, 0x3E, 0x18, 0x0A, 0x0F, 0x47, 0xC3, 0xE2, 0xF0, 0x28, 0x85, 0x85, 0x7C, 0x05, 0x07, 0xD1,
-    0xF0, 0xBC, 0x3E, 0x0A, 0x40, 0x00, 0x40, 0x58, 0x08, 0xB4, 0x14, 0x20, 0x90, 0x3D, 0x00, 0x7B,
-    0xBB, 0x50, 0xBF, 0xC9, 0x0C, 0x50, 0x80, 0x20, 0x24, 0x3B, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x01, 0xED, 0x18, 0x09, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x6A, 0xA9, 0xBF,
-    0xFE, 0x52, 0x90, 0x50, 0x89, 0x0C, 0xBF, 0xC0, 0x00, 0x6A, 0xA0, 0x38, 0x0E, 0xFF, 0x69, 0x48,
-    0x48, 0x84, 0x80, 0x00, 0x00, 0x06, 0x40, 0xC0, 0x88, 0x74, 0x2D, 0x92, 0xC2, 0xD0, 0x00, 0x90,
-    0xC5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0A, 0x00, 0x03, 0x40, 0x00, 0x00, 0x06, 0x02, 0x83,
-    0xD1, 0xF0, 0xF8, 0xBC, 0xBF, 0xC9, 0x0C, 0x50, 0x80, 0x00, 0x14, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x15, 0x00, 0x70, 0x72, 0xC1, 0xCB, 0x0B, 0x2C, 0x2C, 0x50, 0x10, 0x55, 0x2F,
-    0xF0, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x08, 0x01, 0x47, 0x62, 0xDB, 0x2C, 0x7D, 0x09, 0x00,
-    0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x80, 0x0A, 0xE8, 0x10, 0xE2, 0xE0,
-    0xB8, 0x1E, 0x3C, 0x01, 0xBF, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x0B, 0x80, 0x22, 0xCA, 0x07, 0x38, 0x38, 0xA2, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x3C,
-    0x74, 0xB2, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0xC2, 0x40, 0x00, 0x20, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x42, 0x40, 0x00, 0x24, 0x06, 0xAA, 0xA4, 0x00, 0x06, 0xAA, 0xA4, 0x02,
-    0x40, 0x00, 0x24, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
-    0xD0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x55, 0x52, 0xC0, 0x00, 0xB0,
-    0x00, 0x2C, 0x00, 0x0B, 0xFF, 0xF2, 0xD5, 0x54, 0xB0, 0x00, 0x2C, 0x00, 0x0B, 0xAA, 0xA2, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x00, 0x18, 0x08, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x2D,
-    0x55, 0x4B, 0x00, 0x02, 0xC0, 0x00, 0xB0, 0x00, 0x2F, 0xFF, 0xCB, 0x55, 0x52, 0xC0, 0x00, 0xB0,
-    0x00, 0x2E, 0xAA, 0x8B, 0xFF, 0xF2, 0xFF, 0xFC, 0x00, 0x00, 0x14, 0x1F, 0xFF, 0xFF, 0x00, 0x07,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02,
-    0xF9, 0x7C, 0x00, 0xB8, 0x03, 0x80, 0x2C, 0x00, 0xB0, 0x0B, 0x00, 0x1C, 0x02, 0xC0, 0x0B, 0x00,
-    0xB0, 0x1F, 0x80, 0x2D, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x5E, 0x55, 0x47, 0x40, 0x02, 0xD0,
-    0x00, 0xB4, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0x01, 0xBF, 0x40, 0x0B, 0x96, 0xE0, 0x2D, 0x00, 0x74, 0x38, 0x00, 0x2C, 0x74,
-    0x00, 0x00, 0xBA, 0xAA, 0x00, 0xBF, 0xFF, 0x00, 0xB0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x41,
-    0xBD, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x02, 0xFF, 0xFC, 0x00, 0xF9, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07,
-    0xF4, 0x25, 0x07, 0xFD, 0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC, 0xBC, 0xBD,
-    0x3C, 0x1E, 0x3C, 0x2E, 0x29, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x01, 0xF0,
-    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
-    0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
-    0xC0, 0x2E, 0x01, 0xF8, 0xBF, 0xC3, 0xFE, 0x0B, 0x90, 0x00, 0x05, 0x55, 0x80, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x0D, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0xE0, 0x00, 0x0C, 0x00, 0xE0, 0x00, 0x0C, 0x00,
-    0xE0, 0x00, 0x0C, 0x00, 0xFF, 0xF0, 0x0C, 0x00, 0xE0, 0x2C, 0x0C, 0x00, 0xE0, 0x0E, 0x1C, 0x00,
-    0xE0, 0x0E, 0x1C, 0x00, 0xE0, 0x6E, 0x2C, 0x00, 0xFF, 0xFC, 0xF8, 0x00, 0xFF, 0xE0, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x0A, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x34, 0x00, 0xB0,
-    0x00, 0xD0, 0x02, 0xC0, 0x03, 0x95, 0x5F, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x34, 0x00, 0xB0, 0x1D,
-    0xD0, 0x02, 0xC0, 0x2F, 0x40, 0x0B, 0x00, 0xBD, 0x00, 0x2C, 0x1B, 0xF4, 0x00, 0xFF, 0xFD, 0xD0,
-    0x03, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xDF, 0xD0, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xE0, 0x38, 0x00,
-    0x7C, 0x02, 0xC0, 0x07, 0xC0, 0x2C, 0x00, 0x7C, 0x02, 0xC0, 0x07, 0xC0, 0x2C, 0x00, 0x7C, 0x03,
-    0xC0, 0x07, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xBC, 0x0B, 0x43, 0xD0, 0x3C, 0x2E, 0x00, 0xF1, 0xF0, 0x03,
-    0xCF, 0x80, 0x0F, 0x7C, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x7E, 0xF8, 0x02, 0xF3, 0xF8, 0x0B, 0x83, 0xF8, 0x2E, 0x0B, 0xF8, 0xF8, 0x0F, 0xF4, 0x06, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x64,
-    0xF4, 0x00, 0xFC, 0xB4, 0x02, 0xFC, 0xB8, 0x03, 0xFC, 0xB8, 0x0B, 0xFC, 0xB8, 0x0F, 0x7C, 0x7C,
-    0x2F, 0x3C, 0x7C, 0x3D, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0xF4, 0x3D, 0x7E, 0xF0, 0x3E, 0x3F, 0xD0,
-    0x3E, 0x3F, 0xC0, 0x7E, 0x3F, 0x40, 0x7E, 0x01, 0x00, 0x00, 0xD0, 0x70, 0x0B, 0xFE, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x02, 0xC3, 0x80, 0x38, 0x2C, 0x07, 0x40, 0xE0, 0xB0,
-    0x0B, 0x4F, 0x00, 0x7C, 0xF0, 0x03, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0xF8, 0x00, 0x7F, 0x00, 0x7F, 0xD0, 0x07, 0xE0, 0x00, 0x60, 0x00, 0x9B, 0x00, 0x1D, 0xB0, 0x01,
-    0xDB, 0x00, 0x1D, 0xB0, 0x01, 0xDB, 0x00, 0x1D, 0xB0, 0x01, 0xDB, 0x00, 0x1D, 0xB0, 0x01, 0xDB,
-    0x00, 0x1D, 0xBA, 0xAA, 0xDB, 0xFF, 0xFD, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xCE, 0x00, 0x00, 0xE3,
-    0xC0, 0x00, 0xB4, 0x74, 0x00, 0x3C, 0x0F, 0x00, 0x1E, 0x03, 0xD0, 0x0B, 0x40, 0x78, 0x03, 0xD0,
-    0x1F, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x1F, 0x2F, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0xDB, 0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x1D, 0x00, 0x07, 0xFF, 0x81, 0xD0,
-    0x2C, 0x74, 0x03, 0x5E, 0x00, 0xE7, 0x96, 0xF4, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0xB0, 0x0E, 0x0B, 0x00, 0x70, 0xB0, 0x07, 0x0B, 0x00, 0xE0, 0xBF, 0xF8, 0x0B, 0x55,
-    0xF0, 0xB0, 0x03, 0xCB, 0x00, 0x3C, 0xB5, 0x5F, 0xCB, 0xFF, 0xF4, 0xBF, 0xF9, 0x00, 0x7F, 0xFF,
-    0x5E, 0x55, 0x47, 0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00,
-    0xB8, 0x00, 0x2E, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x03, 0xD5, 0xF0, 0x03,
-    0x80, 0xB0, 0x03, 0x80, 0xB0, 0x03, 0x80, 0xB0, 0x03, 0x80, 0xB0, 0x03, 0x40, 0xB0, 0x03, 0x40,
-    0xB0, 0x07, 0x40, 0xB4, 0x0F, 0x00, 0xB4, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0x38, 0x00, 0x2C,
-    0x28, 0x00, 0x28, 0xBF, 0xFF, 0x2D, 0x55, 0x4B, 0x00, 0x02, 0xC0, 0x00, 0xB0, 0x00, 0x2F, 0xFF,
-    0xCB, 0x55, 0x52, 0xC0, 0x00, 0xB0, 0x00, 0x2E, 0xAA, 0x8B, 0xFF, 0xF2, 0xFF, 0xFC, 0x0F, 0x81,
-    0xF0, 0x3D, 0x00, 0x3C, 0x0F, 0x07, 0xC0, 0x02, 0xF0, 0xF0, 0xF4, 0x00, 0x0F, 0x4F, 0x2F, 0x00,
-    0x00, 0x7D, 0xF3, 0xC0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xF7, 0xFA, 0xFD, 0x01, 0xFE, 0x3F, 0xCF, 0xF0, 0x7F, 0xC3, 0xFC,
-    0x3F, 0xC0, 0x05, 0x40, 0x1F, 0xFF, 0x01, 0x01, 0xE0, 0x00, 0x2C, 0x00, 0x0F, 0x01, 0x5B, 0x40,
-    0xFF, 0x80, 0x00, 0x78, 0x00, 0x07, 0x00, 0x02, 0xDA, 0x46, 0xF2, 0xFF, 0xF8, 0x6F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x64, 0xF4, 0x00, 0xFC, 0xB4, 0x02, 0xFC, 0xB8, 0x03, 0xFC, 0xB8,
-    0x0B, 0xFC, 0xB8, 0x0F, 0x7C, 0x7C, 0x2F, 0x3C, 0x7C, 0x3D, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0xF4,
-    0x3D, 0x7E, 0xF0, 0x3E, 0x3F, 0xD0, 0x3E, 0x3F, 0xC0, 0x7E, 0x3F, 0x40, 0x7E, 0x0D, 0x03, 0x00,
-    0x0D, 0x07, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF4,
-    0x00, 0x64, 0xF4, 0x00, 0xFC, 0xB4, 0x02, 0xFC, 0xB8, 0x03, 0xFC, 0xB8, 0x0B, 0xFC, 0xB8, 0x0F,
-    0x7C, 0x7C, 0x1E, 0x3C, 0x7C, 0x3D, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0xF4, 0x3D, 0x7E, 0xF0, 0x3D,
-    0x3F, 0xD0, 0x3E, 0x3F, 0xC0, 0x7E, 0x3F, 0x40, 0x7E, 0x2D, 0x0B, 0xC0, 0xB4, 0x3D, 0x03, 0xC2,
-    0xE0, 0x0F, 0x1F, 0x00, 0x3C, 0xF8, 0x00, 0xF7, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x01, 0xFF, 0xC0, 0x07, 0xEF, 0x80, 0x2F, 0x3F, 0x80, 0xB8, 0x3F, 0x82, 0xE0, 0xBF, 0x8F,
-    0x80, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x7E, 0xAE, 0x07, 0x80, 0xE0, 0x78, 0x0E, 0x07, 0x80, 0xE0,
-    0x74, 0x0E, 0x07, 0x41, 0xE0, 0xB4, 0x1E, 0x0B, 0x01, 0xE0, 0xF0, 0x1E, 0x0F, 0x01, 0xE3, 0xF0,
-    0x1E, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x7B, 0x00, 0xEE, 0x77, 0x81, 0xDE,
-    0xB3, 0xC3, 0xCE, 0xB2, 0xD3, 0x8E, 0xB0, 0xFB, 0x4E, 0xB4, 0xFF, 0x0E, 0xB4, 0x7E, 0x0E, 0xB4,
-    0x3C, 0x0E, 0xB4, 0x00, 0x1E, 0xB4, 0x00, 0x1F, 0x10, 0x00, 0x14, 0x78, 0x00, 0x3C, 0xB8, 0x00,
-    0x3C, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xBC, 0x00, 0x3D,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xFC,
-    0x00, 0x7E, 0xFC, 0x00, 0x7E, 0x01, 0xBF, 0x90, 0x02, 0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4,
-    0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8, 0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFB, 0x95, 0x7E,
-    0xC0, 0x0F, 0xB0, 0x03, 0xEC, 0x00, 0xFB, 0x00, 0x3E, 0xC0, 0x0F, 0xB0, 0x03, 0xED, 0x00, 0xFB,
-    0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xC0, 0x3F, 0xF8, 0x07, 0xEA, 0xF4, 0x74, 0x03, 0xC7, 0x40,
-    0x2D, 0x74, 0x02, 0xCB, 0x40, 0x7C, 0xBF, 0xFF, 0x8B, 0xFF, 0xD0, 0xB8, 0x00, 0x0B, 0x80, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x60, 0x01, 0x87, 0x40, 0x38, 0x3C,
-    0x03, 0x81, 0xE0, 0xB4, 0x0F, 0x0F, 0x00, 0x78, 0xF0, 0x03, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0xFC,
-    0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x7F, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0x03, 0x83, 0xC0, 0xE2, 0x80, 0xF0, 0x1C, 0xA0, 0x3C, 0x07, 0x2D, 0x0F, 0x03,
-    0xC3, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0xF0,
-    0x02, 0xD0, 0x2E, 0x01, 0xE0, 0x03, 0xD0, 0xF0, 0x00, 0x7C, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x7E, 0x00, 0x1F, 0x8B, 0xD0, 0x0F,
-    0xC0, 0xFC, 0x0B, 0xD0, 0x1F, 0x87, 0xE0, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0x00, 0x30, 0xB0, 0x03,
-    0x4B, 0x00, 0x34, 0xB0, 0x03, 0x4B, 0x00, 0x34, 0xB0, 0x07, 0x4B, 0x00, 0x74, 0xB0, 0x07, 0x4B,
-    0x00, 0x74, 0xB0, 0x07, 0x4B, 0xFF, 0xFE, 0xBF, 0xFF, 0xD0, 0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00,
-    0x14, 0xA0, 0x03, 0x6C, 0x00, 0xDB, 0x00, 0x36, 0xC0, 0x0D, 0xB0, 0x03, 0xAC, 0x01, 0xE7, 0x81,
-    0xF8, 0xFF, 0xFE, 0x0B, 0xE7, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xB0,
-    0x28, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x2C,
-    0x1C, 0xB0, 0x2C, 0x1C, 0xB0, 0x2C, 0x1C, 0xB0, 0x2C, 0x1C, 0xB0, 0x2C, 0x0C, 0xBF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2C, 0x0A, 0x0B, 0x0B, 0x03, 0xC1, 0xC2, 0xC0, 0xF0, 0x70,
-    0xB0, 0x3C, 0x1C, 0x2C, 0x0F, 0x07, 0x0B, 0x02, 0xC1, 0xC2, 0xC0, 0xB0, 0x70, 0xB0, 0x2C, 0x1C,
-    0x2C, 0x0B, 0x07, 0x0B, 0x02, 0xC1, 0xC2, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x18, 0x7F, 0xD0, 0x00, 0x2B, 0xD0, 0x00, 0x00, 0xC0, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xD0, 0x3C, 0x01, 0xD0, 0x0C, 0x01,
-    0xD0, 0x0D, 0x01, 0xD0, 0x7C, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x30,
-    0x00, 0x00, 0x7C, 0x30, 0x00, 0x00, 0x7C, 0x30, 0x00, 0x00, 0x7C, 0x30, 0x00, 0x00, 0x7C, 0x34,
-    0x00, 0x00, 0x7C, 0x3F, 0xF8, 0x00, 0x7C, 0x74, 0x0F, 0x00, 0x7C, 0x74, 0x03, 0x00, 0x7C, 0x74,
-    0x03, 0x40, 0x7C, 0x74, 0x1F, 0x00, 0x7C, 0x7F, 0xFF, 0x00, 0x7D, 0x7F, 0xF8, 0x00, 0xBD, 0x30,
-    0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x34, 0x00, 0x0F, 0xFE, 0x07, 0x40, 0xF1, 0xD0,
-    0x0C, 0x74, 0x03, 0x5D, 0x07, 0xC7, 0xFF, 0xF1, 0xFF, 0xE0, 0x02, 0xFE, 0x00, 0x1F, 0x47, 0xD0,
-    0x3C, 0x00, 0xF0, 0x70, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x01, 0xAA, 0xBC, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0xFD, 0x01, 0xFC, 0xBF, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xFD, 0x0F, 0x07, 0x81, 0xE3, 0xC3, 0x80,
-    0x2C, 0xF1, 0xC0, 0x03, 0x7C, 0xB0, 0x00, 0xEF, 0x3C, 0x00, 0x3B, 0xFF, 0x00, 0x0E, 0xF7, 0xC0,
-    0x03, 0xB8, 0xB8, 0x02, 0xDE, 0x1F, 0xEB, 0xF3, 0x83, 0xFF, 0xF4, 0xE0, 0x1F, 0xE4, 0x00, 0x01,
-    0xFF, 0xC0, 0x3E, 0xAB, 0x41, 0xD0, 0x0D, 0x07, 0x00, 0x34, 0x1E, 0x00, 0xD0, 0x3F, 0x57, 0x80,
-    0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x1F, 0x42, 0xE0, 0xB4, 0x0B, 0xC3, 0xD0, 0x2F, 0x0F, 0x40, 0xFC,
-    0x7D, 0x03, 0xF2, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4,
-    0x34, 0x07, 0x47, 0x00, 0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B,
-    0xE6, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x60, 0x0B, 0xFE, 0x02, 0xD0, 0x00, 0x74, 0x00, 0x0B, 0x06,
-    0x40, 0xBB, 0xFF, 0x0B, 0xD0, 0xBC, 0xB8, 0x03, 0xCB, 0x40, 0x3D, 0x78, 0x03, 0xC3, 0xE1, 0xBC,
-    0x1F, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0xB0, 0x28, 0xB0, 0x1C, 0xB0, 0x78, 0xBF,
-    0xF0, 0xB0, 0x1D, 0xB0, 0x0F, 0xB0, 0x1F, 0xBF, 0xFE, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFE, 0xB0,
-    0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x28, 0x3C, 0x00, 0xE0, 0xF0, 0x03, 0x83, 0xC0, 0x0D, 0x0F, 0x00,
-    0xB4, 0x3C, 0x03, 0xC0, 0xF0, 0x7F, 0xAB, 0xE1, 0xFF, 0xFF, 0xC3, 0x80, 0x0B, 0x09, 0x00, 0x14,
-    0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F, 0xEA, 0x87, 0x00, 0x00, 0x38,
-    0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x05, 0x01, 0x40, 0x40, 0x07, 0x83, 0xC3,
-    0xC0, 0x02, 0xD3, 0xC7, 0x80, 0x00, 0xF3, 0xCF, 0x00, 0x00, 0x7B, 0xED, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x0F, 0xDB, 0xEB, 0xE0, 0x3F, 0x8B, 0xE3, 0xF8, 0x1A, 0x80, 0x01, 0xC0, 0x02, 0x00, 0x0C,
-    0x0B, 0xD0, 0x01, 0xC0, 0x03, 0x4B, 0xBC, 0x2F, 0xD0, 0x00, 0x00, 0x28, 0x02, 0xEA, 0x01, 0xFA,
-    0xC0, 0xEA, 0xB0, 0xB2, 0xAC, 0x74, 0xEB, 0x38, 0x3A, 0xEC, 0x0F, 0xBD, 0x03, 0xEF, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xED, 0x00, 0x28, 0x00, 0x00, 0x00, 0xA0, 0x0B, 0xA8, 0x07, 0xEB, 0x03, 0xAA,
-    0xC2, 0xCA, 0xB1, 0xD3, 0xAC, 0xE0, 0xEB, 0xB0, 0x3E, 0xF4, 0x0F, 0xBC, 0x03, 0xC0, 0x18, 0x28,
-    0x0B, 0x1E, 0x03, 0x8F, 0x00, 0xEB, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xFC, 0x01, 0xDB, 0xC0,
-    0x74, 0xFC, 0x2D, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0xD1, 0xC3, 0x4B, 0x0D, 0x28, 0x34, 0xA0, 0xD2,
-    0x83, 0x4D, 0x0D, 0xB0, 0x34, 0x00, 0x00, 0x28, 0x00, 0x60, 0x3E, 0x00, 0xF4, 0x3F, 0x02, 0xF4,
-    0x3F, 0x43, 0xF8, 0x7B, 0x87, 0xB8, 0x77, 0xCB, 0x78, 0x76, 0xEF, 0x3C, 0x74, 0xFD, 0x7C, 0xB4,
-    0xBC, 0x7C, 0xB8, 0x78, 0x7C, 0xB8, 0x00, 0xBC, 0x24, 0x00, 0x60, 0xE0, 0x02, 0xC3, 0xC0, 0x0F,
-    0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3D, 0x55,
-    0xF5, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x40, 0x07, 0xF4, 0x0B, 0x47, 0x83, 0x40, 0x71, 0xC0, 0x0D,
-    0xB0, 0x03, 0xAC, 0x00, 0xE7, 0x40, 0x78, 0xFA, 0xBC, 0x2F, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xEB, 0x00, 0x3A, 0xC0, 0x0E, 0xB0, 0x03, 0xAC, 0x00, 0xEB, 0x00, 0x3A, 0xC0, 0x0E,
-    0xB0, 0x03, 0xAC, 0x01, 0xE0, 0x08, 0x2E, 0x00, 0x3B, 0xEB, 0x40, 0xFC, 0x0B, 0x03, 0xD0, 0x1C,
-    0x0F, 0x00, 0x30, 0x3C, 0x00, 0xD0, 0xF8, 0x07, 0x03, 0xF9, 0x7C, 0x0F, 0xFF, 0xD0, 0x79, 0xFE,
-    0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C, 0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E,
-    0x00, 0x2F, 0xFC, 0x06, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x0D, 0x04, 0x00, 0xD0, 0x00, 0x0E,
-    0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xF0, 0x00, 0x34, 0x01,
-    0xD3, 0xC0, 0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00,
-    0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xFF, 0xFD, 0x03, 0x93, 0xD1, 0xD1, 0xC0, 0xF0,
-    0x1C, 0xA0, 0x3C, 0x03, 0x28, 0x0F, 0x01, 0xCB, 0x03, 0xC0, 0xB1, 0xF9, 0xFA, 0xFC, 0x3F, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x0D, 0x0B, 0x00, 0x71, 0xD0, 0x03, 0xFC, 0x00, 0x0F,
-    0x00, 0x02, 0xF8, 0x00, 0xBA, 0xD0, 0x1F, 0x0F, 0x47, 0xC0, 0x7C, 0x00, 0x00, 0x0B, 0x00, 0x70,
-    0xB0, 0x07, 0x0B, 0x00, 0x70, 0xB0, 0x07, 0x07, 0x00, 0x70, 0x70, 0x07, 0x07, 0x00, 0x30, 0x7A,
-    0xAF, 0xD7, 0xFF, 0xFD, 0x00, 0x01, 0xC0, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x93,
-    0x02, 0x4C, 0x09, 0x30, 0x34, 0xE6, 0xE1, 0xFB, 0x80, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB0,
-    0x28, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x3C, 0x1C, 0xB0, 0x2C, 0x1C, 0xB0, 0x2C,
-    0x1C, 0xB0, 0x2C, 0x1C, 0xBA, 0xBE, 0xAC, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2C, 0x0A, 0x07,
-    0x0B, 0x03, 0xC1, 0xC2, 0xC0, 0xF0, 0x70, 0xB0, 0x3C, 0x1C, 0x2C, 0x0B, 0x07, 0x0B, 0x02, 0xC1,
-    0xC2, 0xC0, 0xB0, 0x70, 0xBA, 0xBE, 0xAE, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0x00, 0x7F, 0x40, 0x01, 0xAD, 0x00, 0x00, 0x34, 0x00, 0x00, 0xFF, 0x90,
-    0x03, 0x41, 0xE0, 0x0E, 0x00, 0xC0, 0x38, 0x07, 0x00, 0xFA, 0xFC, 0x03, 0xFF, 0x80, 0x50, 0x00,
-    0x04, 0xB0, 0x00, 0x1C, 0xB0, 0x00, 0x1C, 0xB4, 0x00, 0x1C, 0x7F, 0xE4, 0x1C, 0x74, 0x1D, 0x1C,
-    0x74, 0x07, 0x1C, 0x74, 0x0B, 0x1C, 0x7E, 0xBE, 0x1C, 0x3F, 0xF8, 0x2C, 0x50, 0x00, 0xB0, 0x00,
-    0xB0, 0x00, 0xB0, 0x00, 0xBF, 0xE4, 0xB0, 0x1D, 0xB0, 0x0A, 0xB0, 0x0E, 0xBA, 0xFD, 0xBF, 0xF4,
-    0x2F, 0xE0, 0x24, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x2C, 0x03, 0xFF, 0x40, 0x02, 0xC4, 0x01, 0xF2,
-    0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x70, 0x2F, 0x81, 0xC3, 0x82, 0xC7, 0x1C, 0x03, 0x5C, 0xA0, 0x0A,
-    0x73, 0x40, 0x29, 0xFD, 0x00, 0xA7, 0x78, 0x03, 0x9C, 0xB4, 0x2D, 0x71, 0xFF, 0xF1, 0xC1, 0xFE,
-    0x00, 0x02, 0xAF, 0x03, 0x01, 0xC0, 0xC0, 0x70, 0x34, 0x1C, 0x07, 0xFF, 0x01, 0xE6, 0xC0, 0xD0,
-    0xB0, 0xF0, 0x2C, 0x74, 0x0B, 0x00, 0x06, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xF4, 0x70, 0x28, 0x02, 0x83, 0x9A, 0xFC, 0x7F,
-    0xEA, 0x87, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF4, 0x18, 0x0F, 0xFF, 0xC0, 0x2F, 0xE4, 0x1C, 0x03,
-    0x06, 0x00, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x2C, 0x0B, 0x0C, 0x00, 0xD7, 0xFF, 0xFA, 0xC0, 0x00,
-    0x70, 0x00, 0x0F, 0x55, 0x92, 0xFF, 0xF4, 0x1B, 0xF8, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x3F,
-    0xFD, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x8A, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xE0,
-    0xB8, 0x03, 0xC0, 0x38, 0x03, 0xC0, 0x2C, 0x03, 0x80, 0x2C, 0x03, 0x80, 0x2C, 0x07, 0xC0, 0x3C,
-    0x07, 0xC0, 0x3D, 0x07, 0xC0, 0x7E, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x02, 0x80, 0x03, 0x40, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0xB0, 0x00, 0xB4, 0x00, 0xB4,
-    0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x07, 0x47, 0x43,
-    0x40, 0x60, 0xC0, 0x00, 0x7F, 0xF0, 0x1C, 0x00, 0x03, 0x91, 0xA0, 0xFF, 0xFC, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x07, 0x55, 0x02, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x80,
-    0x00, 0xF0, 0x39, 0x7D, 0x3F, 0xFF, 0x0B, 0xFF, 0x40, 0x28, 0x7C, 0x7C, 0x00, 0x00, 0x10, 0x34,
-    0x34, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x7C, 0x2D, 0x0F, 0x0F, 0x87, 0xC2, 0x91, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x00, 0xD0, 0x00, 0x34, 0x00, 0x0E,
-    0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0xB4, 0x03, 0xD0, 0x0A, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xB0, 0x02,
-    0xC0, 0x0A, 0x00, 0x38, 0x02, 0xE0, 0xFF, 0x02, 0x90, 0x00, 0x0F, 0xFC, 0x00, 0x08, 0x0C, 0x00,
-    0x08, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0F, 0xF0, 0x14, 0x0C, 0x0C, 0x14, 0x0C, 0x0C, 0x24,
-    0x0D, 0xBC, 0xB0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x90, 0x09, 0x02, 0x40,
-    0x24, 0x09, 0x00, 0xBF, 0xFF, 0xE2, 0x40, 0x90, 0x99, 0x02, 0x81, 0xA4, 0x0B, 0xAE, 0x90, 0x2F,
-    0xE0, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0x8A, 0x80, 0x03, 0xFF, 0xF0, 0x03, 0xE0, 0x78, 0x03, 0xC0, 0x38, 0x03, 0xC0, 0x2C, 0x03,
-    0x80, 0x2C, 0x03, 0x80, 0x2C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x07, 0xC0, 0x3C, 0x00, 0xA0,
-    0x00, 0x34, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0B, 0x03, 0xC7, 0x40, 0xE3, 0xC0,
-    0x3A, 0xC0, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x76, 0xF0, 0x1D, 0x3F, 0x0B, 0x43, 0xF4,
-    0x09, 0x00, 0x00, 0xE0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0xEA, 0x01, 0xFA,
-    0xC0, 0xEA, 0xB0, 0xB2, 0xAC, 0x74, 0xEB, 0x38, 0x3A, 0xEC, 0x0F, 0xBD, 0x03, 0xEF, 0x00, 0xF0,
-    0x0D, 0x02, 0x40, 0xE0, 0x30, 0x03, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x1D, 0x3C, 0x02, 0xC1, 0xE0, 0x3C, 0x0F, 0x03, 0x80, 0x78, 0xB4, 0x03, 0xCF,
-    0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x01, 0xF8, 0x03,
-    0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x20, 0x05, 0x34, 0x0A, 0x34, 0x0A, 0x34, 0x0A, 0x34,
-    0x0A, 0x34, 0x0A, 0x34, 0x0A, 0x34, 0x0A, 0x3F, 0xFE, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x0B,
-    0x00, 0x0B, 0xFF, 0xF0, 0x6F, 0xAA, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0x80,
-    0xD0, 0xB4, 0x07, 0x0B, 0x40, 0x70, 0x7E, 0xAF, 0x03, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0x00, 0x00, 0xF9, 0x00, 0x0F,
-    0xEB, 0x80, 0xF4, 0x0D, 0x0F, 0x00, 0x60, 0xB4, 0x1E, 0x0B, 0xFF, 0xE0, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x4F, 0xEA, 0xAF, 0xD1, 0xF4, 0x07, 0xE0, 0x2F, 0x03, 0xE0, 0x02, 0xE2,
-    0xE0, 0x00, 0x2E, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x38, 0x74, 0xF0, 0x2C, 0x1D, 0x1D, 0x0E, 0x07,
-    0x43, 0xC7, 0x41, 0xD0, 0xB3, 0xC0, 0xB4, 0x1E, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x2D, 0x0B, 0x40,
-    0x75, 0xD0, 0x02, 0xF8, 0x00, 0xCA, 0x70, 0x28, 0xA2, 0x43, 0x0A, 0x1C, 0x70, 0xA0, 0xC0, 0x2F,
-    0x80, 0x38, 0x79, 0xF0, 0x38, 0xB0, 0x38, 0x74, 0xF2, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x2E, 0x01,
-    0xF4, 0x7C, 0x00, 0x3C, 0x78, 0x00, 0x3D, 0xB4, 0x00, 0x2D, 0xB4, 0x00, 0x2D, 0xB8, 0x00, 0x3D,
-    0x7D, 0x00, 0xBC, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0x42, 0x87, 0x0D, 0x34, 0xB6, 0xFF, 0x01, 0xFA, 0xF0, 0x3C, 0x03, 0x87, 0x40, 0x2C, 0x70, 0x01,
-    0xC7, 0x40, 0x1C, 0x34, 0x02, 0xC3, 0xEA, 0xB8, 0x1F, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0x2D, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x1F, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x3E, 0x02, 0xF0, 0x00,
-    0x07, 0xC0, 0xF8, 0x00, 0x00, 0xF4, 0x7D, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xCA, 0x00, 0x2D, 0x1C, 0x00, 0xF0, 0x38, 0x03, 0x80, 0xB0, 0x2C, 0x01, 0xD0,
-    0xF0, 0x03, 0x87, 0x80, 0x0F, 0x3C, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x00,
-    0xA0, 0x0A, 0xBF, 0xE0, 0x0A, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x00, 0xE7, 0xFF, 0xF9, 0xE5, 0x54,
-    0x74, 0x00, 0x2D, 0x00, 0x0B, 0x40, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02,
-    0xE0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0xBF, 0xFE, 0xB0,
-    0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x1F,
-    0xFF, 0xD1, 0xE5, 0x54, 0x1D, 0x00, 0x02, 0xD0, 0x00, 0x7F, 0xFF, 0xD7, 0xFA, 0xA8, 0x2E, 0x00,
-    0x02, 0xE0, 0x00, 0x2E, 0x00, 0x02, 0xE0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0xF4, 0xD0,
-    0x03, 0x40, 0x2F, 0xFD, 0x34, 0x00, 0xD0, 0x03, 0x80, 0x0E, 0x00, 0x2A, 0xAA, 0x97, 0xFF, 0xFD,
-    0x70, 0x00, 0x0B, 0x00, 0x00, 0xB4, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0xF8, 0x0B, 0xE5, 0xF0, 0xB4,
-    0x03, 0x8B, 0x00, 0x2C, 0xB0, 0x01, 0xCB, 0x00, 0x2C, 0xB0, 0x1F, 0x8B, 0x42, 0xE0, 0x00, 0x00,
-    0xFF, 0x03, 0x00, 0x0C, 0x00, 0x3A, 0x80, 0xD1, 0xC3, 0x02, 0x0C, 0x0C, 0x30, 0xE0, 0x0F, 0x41,
-    0xF0, 0x3D, 0x00, 0x7C, 0x1F, 0x0B, 0xC0, 0x03, 0xE1, 0xE0, 0xF0, 0x00, 0x0F, 0x1F, 0x3E, 0x00,
-    0x00, 0xB9, 0xF7, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xF7, 0xFA, 0xFC, 0x02, 0xFD, 0x3F, 0x8F, 0xF0, 0xBF, 0x87, 0xF8,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x18, 0x28, 0x02, 0xC7, 0x1D, 0x00, 0x39, 0xCF, 0x00, 0x07, 0xBB, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x7E, 0xFC, 0x0F, 0x8F, 0x8F, 0xC0,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x05, 0x40, 0xBF, 0xF8, 0x00, 0x2D, 0x00, 0x0E, 0x00, 0x0E,
-    0x05, 0x7C, 0x1F, 0xF4, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x0F, 0xD0, 0x6F, 0xFF, 0xFC, 0xBF, 0xE0,
-    0x03, 0x00, 0x03, 0x00, 0x1A, 0x80, 0x01, 0xC0, 0x02, 0x00, 0x0C, 0x0B, 0xD0, 0x01, 0xC0, 0x03,
-    0x4B, 0xBC, 0x3F, 0xD0, 0x40, 0x01, 0x60, 0x00, 0x80, 0x2D, 0x00, 0x3C, 0x0B, 0x80, 0xF0, 0x7C,
-    0x03, 0xC3, 0xE0, 0x0F, 0x1F, 0x00, 0x3C, 0xF4, 0x00, 0xFB, 0xC0, 0x07, 0xFD, 0x00, 0x1F, 0xE0,
-    0x00, 0x7F, 0x80, 0x02, 0xFF, 0x80, 0x0B, 0xBF, 0x80, 0x2E, 0x3F, 0x40, 0xF8, 0x7F, 0x43, 0xD0,
-    0xBF, 0x4F, 0x40, 0xFF, 0x80, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x24, 0x60, 0x34, 0xF0, 0x35, 0xC0,
-    0x37, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x7F, 0x40, 0x77, 0xD0, 0x71, 0xF4, 0xB0, 0xBD, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3C, 0x03, 0x40, 0x1E, 0x00, 0xDB, 0x0F, 0x00, 0x37,
-    0xCB, 0x40, 0x1D, 0xF3, 0xC0, 0x07, 0x7F, 0xC0, 0x02, 0xFF, 0xE0, 0x00, 0xB7, 0xFD, 0x00, 0x2D,
-    0xF3, 0xE0, 0x0F, 0x7C, 0x7E, 0x03, 0xDF, 0x0B, 0xE0, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0xB0, 0x36, 0x1C, 0x03, 0x77, 0x80, 0x37, 0xB0, 0x03, 0xFE, 0x00, 0x77, 0xB8, 0x07, 0x72,
-    0xE0, 0x71, 0x0F, 0xC0, 0x0B, 0x42, 0xF0, 0x7F, 0xF3, 0xD0, 0x0F, 0x4B, 0x80, 0x0F, 0x1F, 0x00,
-    0x0F, 0x3E, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xFC, 0x00, 0x1F, 0xBF, 0x00, 0x2F, 0x3F, 0x80, 0x2E, 0x0F, 0xE0, 0x2E, 0x0B, 0xF8, 0x3E, 0x03,
-    0xFD, 0x01, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x17, 0xD4, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x87, 0x40, 0x03, 0x9E, 0x00, 0x03, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x07,
-    0xBD, 0x00, 0x07, 0x9F, 0x40, 0x07, 0x8B, 0xE0, 0x07, 0x82, 0xF8, 0x3F, 0xFF, 0x42, 0xF0, 0x2A,
-    0xAF, 0x43, 0xD0, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x0F, 0x3E, 0x00, 0x00,
-    0x0F, 0x7C, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x2F, 0x3F, 0x80, 0x00, 0x2E, 0x0F, 0xE0, 0x00,
-    0x2E, 0x0B, 0xF8, 0x00, 0x3E, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0x00, 0x1C, 0x74, 0x00,
-    0x33, 0xC0, 0x01, 0xEC, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x00, 0x02, 0xDF, 0x00,
-    0x0B, 0x2F, 0x00, 0x3C, 0x3F, 0x00, 0x50, 0x00, 0x14, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xB4,
-    0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF8, 0x00, 0x3C, 0xF8, 0x00, 0x3C, 0xF8, 0x00, 0x3C, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D,
-    0xFC, 0x00, 0x7F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1C, 0x01, 0xC7, 0x00, 0x71,
-    0xC0, 0x2C, 0x70, 0x0B, 0x1C, 0x02, 0xCB, 0xFF, 0xF2, 0xFF, 0xFC, 0xB4, 0x0B, 0x2D, 0x02, 0xDB,
-    0x40, 0xB4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xFF, 0xE7,
-    0x80, 0x03, 0xFA, 0xAA, 0xE0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x0F, 0x40,
-    0x0B, 0x80, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0xB0, 0x0B, 0xFE, 0xB0, 0x0B, 0x00, 0xB0, 0x0B, 0x00,
-    0xB0, 0x0F, 0x00, 0xB0, 0x0F, 0x00, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xAA, 0xAA, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xF0, 0x03, 0xC0,
-    0x00, 0xF0, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xEF,
-    0xE0, 0xF0, 0x03, 0xF5, 0x7C, 0xF0, 0x07, 0xC0, 0x1D, 0xF0, 0x07, 0xC0, 0x0E, 0xF0, 0x07, 0x80,
-    0x0E, 0xF0, 0x07, 0xC0, 0x0E, 0xF0, 0x07, 0xC0, 0xBC, 0xF0, 0x07, 0xC0, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0xB0, 0x03, 0x80, 0x00, 0xB0, 0x03, 0x80, 0x00, 0xB0, 0x03, 0x80,
-    0x00, 0xB0, 0x03, 0x80, 0x00, 0xB0, 0x03, 0x80, 0x00, 0xB0, 0x03, 0x80, 0x00, 0xB4, 0x03, 0xFF,
-    0xE0, 0xB4, 0x03, 0xE0, 0x78, 0x00, 0x03, 0x80, 0x2C, 0x00, 0x07, 0x80, 0x0D, 0x00, 0x07, 0x40,
-    0x0D, 0x00, 0x07, 0x80, 0x2C, 0x00, 0x07, 0x81, 0xF8, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xBF,
-    0x80, 0x74, 0x03, 0x81, 0xE0, 0xB0, 0x0B, 0x00, 0xB0, 0xF0, 0x0D, 0x00, 0xB0, 0xF0, 0x0D, 0x00,
-    0xE0, 0xF0, 0x0D, 0x03, 0xC0, 0xF4, 0x0F, 0x0F, 0x80, 0x7D, 0x0B, 0xFF, 0x2C, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xB0, 0x0B, 0xE0, 0x34, 0x0D, 0x0D, 0x0C, 0x0A, 0x02, 0x47, 0x03, 0x40, 0xD1,
-    0xC0, 0xD0, 0xB0, 0x38, 0x2D, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x7F, 0xAF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-    0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFE, 0xBD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0x54, 0x3C,
-    0x00, 0x74, 0x00, 0x74, 0x00, 0x74, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x1F, 0xFC, 0x02, 0xFD, 0x00,
-    0x08, 0x00, 0xF0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0x90, 0x00, 0xBF, 0xFF, 0x55, 0x71, 0x40, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70,
-    0x00, 0x2C, 0x00, 0x0B, 0x00, 0x02, 0xC0, 0x00, 0xB0, 0x00, 0x30, 0x00, 0xB4, 0x00, 0x3D, 0x3C,
-    0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0, 0x03, 0xDB, 0xC0, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x70, 0x03, 0x8E, 0x02, 0xC3, 0xC0, 0xF0, 0x74, 0x34, 0x0E,
-    0x2C, 0x03, 0xCF, 0x00, 0x7B, 0x40, 0x0F, 0xC0, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B,
-    0x80, 0xB4, 0x00, 0x3D, 0x3C, 0x00, 0x7C, 0x2E, 0x00, 0xF4, 0x0F, 0x01, 0xF0, 0x0B, 0xC3, 0xD0,
-    0x03, 0xDB, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x0A, 0xFE, 0x90, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x18, 0x00, 0x91, 0xD0, 0x1D,
-    0x0F, 0x02, 0xC0, 0xB0, 0x38, 0x07, 0x87, 0x40, 0x3C, 0xF0, 0x02, 0xDE, 0x00, 0x0F, 0xC0, 0x2A,
-    0xFE, 0xA3, 0xFF, 0xFF, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0xE0, 0x1E, 0x00, 0x3C, 0x00, 0xB4, 0x0B, 0x40, 0x03, 0xC1, 0xF0, 0x00, 0x1F, 0x3C,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02,
-    0xF7, 0xD0, 0x00, 0x7D, 0x2F, 0x00, 0x0F, 0xC0, 0xFC, 0x03, 0xF0, 0x0B, 0xE0, 0xBE, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x24, 0x02, 0x41, 0xC0, 0x70,
-    0x0E, 0x0D, 0x00, 0x37, 0x80, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF8, 0x00, 0xF2, 0xC0, 0x2E,
-    0x0F, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x05, 0x6D, 0x50, 0xA0,
-    0x02, 0xC0, 0x0A, 0x00, 0x2C, 0x00, 0xA0, 0x02, 0xC0, 0x0A, 0x00, 0x2C, 0x00, 0xA0, 0x02, 0xC0,
-    0x0A, 0x00, 0x2C, 0x00, 0xA0, 0x02, 0xC0, 0x0A, 0x00, 0x2D, 0x00, 0xF0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xBF, 0xF0,
-    0x80, 0x0C, 0x03, 0x00, 0x30, 0x0C, 0x00, 0xC0, 0x30, 0x03, 0x00, 0xC0, 0x0C, 0x03, 0x00, 0x3A,
-    0xAE, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x34, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x60, 0x02, 0x82,
-    0xD0, 0x0F, 0x07, 0x00, 0x3C, 0x1C, 0x00, 0xF0, 0x70, 0x03, 0xC0, 0xD0, 0x0F, 0x03, 0xD1, 0xFC,
-    0x03, 0xFE, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x03,
-    0xAC, 0x00, 0x05, 0xB0, 0x00, 0x02, 0xC0, 0x00, 0x05, 0x10, 0x04, 0x0D, 0x07, 0x03, 0x40, 0xC0,
-    0xC0, 0x70, 0x24, 0x2C, 0x03, 0xFF, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x0C, 0x00, 0x03, 0xA0,
-    0x00, 0x28, 0x00, 0x05, 0x70, 0x00, 0xD7, 0x00, 0x1D, 0x70, 0x01, 0xDB, 0x00, 0x1D, 0xB0, 0x41,
-    0xD7, 0x4C, 0x3D, 0x7D, 0xCB, 0xD3, 0xFF, 0xFE, 0x0B, 0xF6, 0xE0, 0x0C, 0x2E, 0x00, 0xC2, 0xE0,
-    0x04, 0x2E, 0x00, 0x03, 0x00, 0xCC, 0x03, 0x30, 0x0C, 0xC8, 0x73, 0xFB, 0xC3, 0xFB, 0x02, 0x0C,
-    0x08, 0x74, 0x90, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
-    0xBF, 0xC3, 0xF4, 0x78, 0xF0, 0x07, 0x3C, 0x00, 0xCF, 0x00, 0x37, 0xC0, 0x1D, 0xF0, 0x07, 0x7C,
-    0x01, 0xE0, 0x1C, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0x8A,
-    0x80, 0x3F, 0xFF, 0x03, 0xE0, 0x78, 0x3C, 0x03, 0x83, 0xC0, 0x2C, 0x38, 0x02, 0xC3, 0x80, 0x2C,
-    0x7C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC0, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xBE, 0x6D, 0x00,
-    0x07, 0x80, 0x1C, 0x3C, 0x3C, 0x00, 0x38, 0xFA, 0xF5, 0x5A, 0xF1, 0xFF, 0xFF, 0xFF, 0xC0, 0x2E,
-    0x95, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x40, 0x0B, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x0B, 0x43, 0x0D, 0x30,
-    0x0B, 0x2F, 0xFF, 0xFC, 0x0B, 0x50, 0x00, 0x2C, 0x00, 0x00, 0x7D, 0x01, 0x00, 0xBF, 0xFC, 0x00,
-    0x7F, 0xD0, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x0B, 0xE6, 0xC0, 0x00, 0x1E, 0x00, 0xB0, 0x3C, 0x3C,
-    0x00, 0x34, 0x3D, 0xB9, 0x56, 0xBC, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xFA, 0x54, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0E, 0x0A, 0x2C, 0xE0, 0x0C, 0x7F, 0xFF, 0xF8,
-    0x1D, 0x50, 0x00, 0x34, 0x00, 0x00, 0xF4, 0x04, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0xC0,
-    0x00, 0x01, 0x00, 0x00, 0xBC, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xBC,
-    0xBC, 0xBD, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xD0, 0x30, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xF0,
-    0x3D, 0x00, 0x3C, 0x0F, 0x07, 0xC0, 0x02, 0xF0, 0xF0, 0xF4, 0x00, 0x0F, 0x4F, 0x2F, 0x00, 0x00,
-    0x7D, 0xF3, 0xC0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xF7, 0xFA, 0xFD, 0x01, 0xFE, 0x3F, 0xCF, 0xF0, 0x7F, 0xC3, 0xFC, 0x3F,
-    0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x34, 0x0D, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x50, 0x03, 0xC3, 0xC3,
-    0xC0, 0x02, 0xD3, 0xC7, 0x80, 0x00, 0xF3, 0xCF, 0x00, 0x00, 0x7B, 0xED, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x0F, 0xEB, 0xEB, 0xE0, 0x3F, 0x8B, 0xE3, 0xF8, 0x10, 0x05, 0x03, 0x82, 0xD0, 0x34, 0x78,
-    0x03, 0x4F, 0x00, 0x75, 0xE0, 0x07, 0x7C, 0x00, 0x7F, 0x40, 0x0B, 0xFA, 0x00, 0xB4, 0x7E, 0x0B,
-    0x40, 0xF4, 0xF0, 0x03, 0xCF, 0x00, 0x3C, 0xF0, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x1F, 0x40, 0x0B,
-    0xE0, 0x00, 0x64, 0x00, 0x00, 0x00, 0xC3, 0x43, 0x2C, 0x0C, 0xC0, 0x3A, 0x01, 0xF9, 0x07, 0x1E,
-    0x2C, 0x0D, 0xB0, 0x38, 0x00, 0xD0, 0x2E, 0x00, 0x50, 0x02, 0xAA, 0x90, 0x07, 0xFF, 0xE0, 0x07,
-    0x80, 0xE0, 0x07, 0x80, 0xE0, 0x07, 0x80, 0xE0, 0x07, 0x80, 0xE0, 0x07, 0x41, 0xE0, 0x0B, 0x41,
-    0xE0, 0x0B, 0x41, 0xE0, 0x0B, 0x01, 0xE0, 0x0F, 0x01, 0xE0, 0x1F, 0x01, 0xFE, 0x3D, 0x01, 0xFD,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x1F, 0xF4, 0x1C, 0x34, 0x2C,
-    0x34, 0x2C, 0x34, 0x28, 0x34, 0x28, 0x34, 0x38, 0x38, 0xB0, 0x3D, 0x00, 0x1C, 0x00, 0x2C, 0x10,
-    0x00, 0x14, 0x1E, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0xF0, 0xB8, 0x00, 0x3D, 0x2E,
-    0x00, 0x0F, 0x4B, 0x80, 0x03, 0xD2, 0xF0, 0x00, 0xF4, 0xBF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0x4B,
-    0xFF, 0xFF, 0xE3, 0xF0, 0x01, 0xF8, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x1F, 0xDF, 0xC0, 0x07, 0xF4,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x02, 0x8B, 0x00, 0xB2, 0xC0, 0x2C, 0xB0, 0x0F, 0x2C, 0x03, 0xCB, 0xFF, 0xF2,
-    0xFF, 0xFC, 0xF0, 0x0F, 0x3C, 0x03, 0xDF, 0x00, 0xF8, 0x00, 0x2E, 0x00, 0x3F, 0x40, 0x05, 0x00,
-    0x10, 0x00, 0x14, 0x1E, 0x00, 0x0F, 0x0B, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0xF0, 0xB8, 0x00, 0x3D,
-    0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x03, 0xD2, 0xF0, 0x00, 0xF4, 0xBF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0x4B, 0xFF, 0xFF, 0xE3, 0xF0, 0x01, 0xF8, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x1F, 0x8F, 0xC0, 0x07,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x2C, 0x02, 0xCB, 0x00, 0xB2, 0xC0, 0x2C, 0xB0, 0x0B, 0x2C, 0x03, 0xCB, 0xFF,
-    0xF2, 0xFF, 0xFC, 0xF0, 0x0F, 0x3C, 0x03, 0xCF, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07, 0x40, 0x02,
-    0xC0, 0x00, 0x00, 0x24, 0x01, 0x83, 0x80, 0x2C, 0x38, 0x02, 0xC3, 0x40, 0x2C, 0x34, 0x02, 0xC3,
-    0x80, 0x3C, 0x2D, 0x1B, 0xC0, 0xBF, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0x02, 0xC0, 0x00,
-    0x2C, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x02, 0x80, 0x00, 0x02, 0x40, 0xC9, 0x03, 0x24, 0x0C,
-    0x90, 0xB1, 0xDB, 0xC2, 0xFB, 0x00, 0x2C, 0x01, 0xF0, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xD0, 0x3F, 0x40, 0x0F, 0xD0, 0x3F, 0xC0, 0x1F, 0xE0, 0x7F, 0xC0, 0x2F,
-    0xE0, 0x7B, 0xE0, 0x3E, 0xE0, 0x7A, 0xF0, 0x7E, 0xF0, 0x79, 0xF4, 0xFA, 0xF0, 0x7C, 0xFD, 0xF2,
-    0xF0, 0xBC, 0xBF, 0xF2, 0xF0, 0xBC, 0x3F, 0xE3, 0xF0, 0xBC, 0x2F, 0xC3, 0xF0, 0xBC, 0x1F, 0xC3,
-    0xF4, 0xFC, 0x0F, 0x43, 0xF4, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xA4, 0x24, 0x01, 0x81,
-    0xF0, 0x0F, 0x47, 0xD0, 0x7D, 0x1F, 0xC3, 0xF4, 0xBB, 0x4E, 0xD2, 0xCE, 0xB7, 0x8B, 0x3F, 0x8E,
-    0x2C, 0x7D, 0x78, 0xF0, 0xF1, 0xF3, 0xC0, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1D, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x62, 0xCB, 0x2C, 0xB2, 0xC7, 0x1D, 0x75, 0xD7, 0x5D, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x18, 0x00, 0x1F, 0xAD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0x38,
-    0x00, 0x03, 0x8F, 0x00, 0x02, 0xD1, 0xD0, 0x00, 0xF0, 0x3C, 0x00, 0x78, 0x0F, 0x40, 0x2D, 0x01,
-    0xE0, 0x0F, 0x40, 0x7C, 0x07, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF1, 0xF0, 0x00, 0x7C, 0xBC, 0x00,
-    0x0F, 0x80, 0x0D, 0x03, 0x00, 0xD0, 0x70, 0x07, 0xFD, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF7, 0x00, 0xFA, 0xF4, 0x3C, 0x0B, 0x43, 0x40, 0x74, 0x70, 0x03, 0x87, 0x00, 0x38,
-    0x70, 0x0B, 0xC3, 0xEB, 0xFC, 0x2F, 0xFF, 0xC0, 0xBE, 0x6C, 0x03, 0xC1, 0xE0, 0x00, 0xF0, 0xB8,
-    0x00, 0x28, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xF3, 0x80, 0x00, 0x38, 0xF0, 0x00, 0x2D, 0x1D, 0x00, 0x0F, 0x03,
-    0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x1E, 0x00, 0xF4, 0x07, 0xC0, 0x7F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0x1F, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xF8, 0x0F, 0x0B, 0x41, 0xF0, 0xF4, 0x1A, 0x0A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x0F, 0xAF, 0x43, 0xC0, 0xB4, 0x34, 0x07, 0x47, 0x00,
-    0x38, 0x70, 0x03, 0x87, 0x00, 0xBC, 0x3E, 0xBF, 0xC2, 0xFF, 0xFC, 0x0B, 0xE6, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x0E, 0xBC, 0x00, 0x00, 0x00, 0xB1, 0xF0, 0x00, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x00,
-    0x3C, 0x0F, 0xFF, 0x80, 0x01, 0xE0, 0x3F, 0xFE, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x03,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0xF4, 0x00, 0xFF, 0xFF,
-    0x8B, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7,
-    0x1F, 0xE0, 0x0F, 0xAF, 0xF4, 0x28, 0x3C, 0x0B, 0xC0, 0x0C, 0x34, 0x07, 0xDA, 0xFE, 0x70, 0x03,
-    0xFE, 0xA9, 0x70, 0x03, 0x80, 0x00, 0x70, 0x0B, 0xC0, 0x00, 0x3E, 0xBF, 0xF9, 0x05, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xE6, 0xDF, 0xF8, 0x00, 0x00, 0x09, 0x02, 0x81, 0xEA, 0xC0, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF2, 0xD5, 0x54, 0xB0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x02, 0xFF,
-    0xFC, 0xB5, 0x55, 0x2C, 0x00, 0x0B, 0x00, 0x02, 0xEA, 0xA8, 0xBF, 0xFF, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xC0, 0x30, 0x0B, 0xAF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x0F, 0x47, 0x02, 0x80, 0x28, 0x39, 0xAF, 0xC7, 0xFE, 0xA8, 0x70, 0x00, 0x03,
-    0x80, 0x00, 0x3F, 0x41, 0x80, 0xFF, 0xFC, 0x02, 0xFE, 0x40, 0x1F, 0xF8, 0x03, 0xFF, 0xF0, 0x24,
-    0x5F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xC1, 0xAA, 0xFC, 0x3F, 0xEA, 0xC3, 0x40, 0x38, 0x0C, 0x0B,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x1F, 0xFF, 0x82, 0x46, 0xF4, 0x00, 0x0E, 0x00,
-    0x02, 0xDA, 0xAF, 0xFB, 0xEA, 0x78, 0xC0, 0x1C, 0x28, 0x1D, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3C,
-    0x1E, 0x03, 0xC2, 0xE0, 0x29, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x3F, 0xFF, 0x02, 0x45, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x1A, 0xAF, 0xC3,
-    0xFE, 0xAC, 0x34, 0x03, 0x80, 0xC0, 0xB0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x1F, 0xFF,
-    0x82, 0x46, 0xF4, 0x00, 0x0E, 0x00, 0x02, 0xDA, 0xAF, 0xFB, 0xEA, 0x79, 0xC0, 0x1C, 0x38, 0x1E,
-    0x0F, 0xFF, 0x83, 0xC2, 0xE0, 0xA0, 0x64, 0x00, 0x09, 0x0A, 0x00, 0x00, 0x02, 0xE0, 0xF0, 0x00,
-    0x00, 0x2F, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-    0x03, 0xD0, 0x03, 0xC0, 0xF0, 0x7C, 0x00, 0x2F, 0x0F, 0x0F, 0x40, 0x00, 0xF4, 0xF2, 0xF0, 0x00,
-    0x07, 0xDF, 0x3C, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x7F, 0xAF, 0xD0, 0x1F, 0xE3, 0xFC, 0xFF, 0x07, 0xFC, 0x3F, 0xC3,
-    0xFC, 0x00, 0x24, 0x28, 0x00, 0x00, 0x78, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x40, 0x40, 0x07, 0x83, 0xC3, 0xC0, 0x02, 0xD3, 0xC7,
-    0x80, 0x00, 0xF3, 0xCF, 0x00, 0x00, 0x7B, 0xED, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xDB, 0xEB,
-    0xE0, 0x3F, 0x8B, 0xE3, 0xF8, 0x78, 0x3C, 0x2E, 0x0F, 0x4A, 0x82, 0x90, 0x00, 0x00, 0x05, 0x40,
-    0x1F, 0xFF, 0x01, 0x01, 0xE0, 0x00, 0x2C, 0x00, 0x0F, 0x01, 0x5B, 0x40, 0xFF, 0x80, 0x00, 0x78,
-    0x00, 0x07, 0x00, 0x02, 0xDA, 0x46, 0xF2, 0xFF, 0xF8, 0x6F, 0xF4, 0x00, 0x19, 0x0A, 0x0B, 0x83,
-    0xC3, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x07, 0x00, 0x00, 0x80, 0x00, 0x30,
-    0x02, 0xF4, 0x00, 0x07, 0x00, 0x00, 0xD0, 0x2E, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x15, 0x6C, 0x00, 0x3C, 0x01, 0xF0, 0x07, 0xC0, 0x0B, 0xF0, 0x00, 0x2C, 0x00, 0x0E, 0x00, 0x0E,
-    0x1D, 0x7E, 0x3F, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFC, 0x00, 0x2C, 0x00, 0xB4,
-    0x02, 0xD0, 0x0B, 0xD0, 0x01, 0xB8, 0x00, 0x0D, 0x00, 0x0E, 0x18, 0x2E, 0x3F, 0xFD, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x54, 0xF4, 0x00, 0xFC, 0xB4, 0x02, 0xFC, 0xB8, 0x03, 0xFC, 0xB8, 0x0B, 0xFC, 0xB8, 0x0F, 0x7C,
-    0x7C, 0x1F, 0x3C, 0x7C, 0x3D, 0x3D, 0x7C, 0x7C, 0x3D, 0x7C, 0xF4, 0x3D, 0x7E, 0xF0, 0x3D, 0x3F,
-    0xD0, 0x3E, 0x3F, 0xC0, 0x7E, 0x3F, 0x40, 0x7E, 0x00, 0x15, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x0B, 0xA8, 0x07, 0xEB, 0x03, 0xAA, 0xC2, 0xCA, 0xB1, 0xD3, 0xAC, 0xE0, 0xEB, 0xB0,
-    0x3E, 0xF4, 0x0F, 0xBC, 0x03, 0xC0, 0x19, 0x0A, 0x00, 0x2E, 0x0F, 0x00, 0x3F, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xA4, 0xF4, 0x00, 0xFC, 0xB4, 0x02, 0xFC, 0xB8, 0x03,
-    0xFC, 0xB8, 0x0B, 0xFC, 0xB8, 0x0F, 0x7C, 0x7C, 0x2F, 0x3C, 0x7C, 0x3D, 0x3D, 0x7C, 0x7C, 0x3D,
-    0x7C, 0xF4, 0x3D, 0x7E, 0xF0, 0x3E, 0x3F, 0xD0, 0x3E, 0x3F, 0xC0, 0x7E, 0x3F, 0x40, 0x7E, 0x28,
-    0x0A, 0x0F, 0x47, 0xC3, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0xEA, 0x01, 0xFA, 0xC0,
-    0xEA, 0xB0, 0xB2, 0xAC, 0x74, 0xEB, 0x38, 0x3A, 0xEC, 0x0F, 0xBD, 0x03, 0xEF, 0x00, 0xF0, 0x02,
-    0xC0, 0xE0, 0x00, 0xF4, 0x7C, 0x00, 0x29, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02,
-    0xFA, 0xBE, 0x02, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0x7D, 0x7C, 0x00, 0x0F, 0xAD, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xED, 0x00, 0x01, 0xEB, 0xD0, 0x00, 0xF8,
-    0xFF, 0xAB, 0xFC, 0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x0F, 0x0F, 0x47, 0xC2, 0x91, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xD1, 0xE0,
-    0xD0, 0x1C, 0x70, 0x03, 0x6C, 0x00, 0xEB, 0x00, 0x39, 0xD0, 0x1E, 0x3E, 0xAF, 0x0B, 0xFF, 0x80,
-    0x7F, 0x40, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x2E, 0x00, 0xB8, 0x7C, 0x00, 0x3C, 0x78, 0x00,
-    0x2D, 0xBF, 0xFF, 0xFE, 0xB9, 0x00, 0x2D, 0x78, 0x00, 0x3D, 0x7E, 0x00, 0xBC, 0x2F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFA, 0xF0, 0x38, 0x03,
-    0xC7, 0x40, 0x2C, 0x7F, 0xFF, 0xC7, 0x40, 0x2C, 0x38, 0x03, 0xC3, 0xEA, 0xF8, 0x1F, 0xFF, 0x00,
-    0x2F, 0x80, 0x06, 0x42, 0x80, 0x0B, 0x83, 0xC0, 0x0F, 0x87, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x2E, 0x00, 0xB8,
-    0x7C, 0x00, 0x3C, 0x78, 0x00, 0x2D, 0xBF, 0xFF, 0xFE, 0xB9, 0x00, 0x2D, 0x78, 0x00, 0x3D, 0x7E,
-    0x00, 0xBC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x0F,
-    0x02, 0xE0, 0xF0, 0x2A, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01,
-    0xFA, 0xF0, 0x38, 0x03, 0xC7, 0x40, 0x2C, 0x7F, 0xFF, 0xC7, 0x40, 0x2C, 0x38, 0x03, 0xC3, 0xEA,
-    0xF8, 0x1F, 0xFF, 0x00, 0x2F, 0x80, 0x64, 0x28, 0x00, 0xB8, 0x3C, 0x00, 0xFC, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0x47, 0xD0, 0x3C, 0x00, 0xF0, 0x70, 0x00,
-    0x78, 0x00, 0x00, 0x3C, 0x01, 0xAA, 0xBC, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-    0xFD, 0x01, 0xFC, 0xBF, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x18,
-    0x0A, 0x03, 0xD1, 0xF0, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x24, 0x0B,
-    0x40, 0x00, 0x3C, 0x00, 0x02, 0xC0, 0x0F, 0xFD, 0x00, 0x02, 0xC1, 0x00, 0x7C, 0x2F, 0xFF, 0x00,
-    0xBF, 0x80, 0x00, 0x15, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x87, 0x40,
-    0x38, 0x3C, 0x03, 0x81, 0xE0, 0xB4, 0x0F, 0x0F, 0x00, 0x78, 0xF0, 0x03, 0xFE, 0x00, 0x1F, 0xD0,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x7F, 0xD0, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01,
-    0xD3, 0xC0, 0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40, 0x3C, 0xF0, 0x01, 0xFF, 0x00,
-    0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x02, 0xE0, 0xF0, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x28, 0x34, 0x03, 0x83, 0xC0, 0x74, 0x1E, 0x0B, 0x40, 0xF0, 0xF0, 0x07, 0xCF, 0x00,
-    0x3F, 0xE0, 0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x07, 0xFD,
-    0x00, 0x7E, 0x00, 0x00, 0x0E, 0x0B, 0x01, 0xF0, 0xF4, 0x1A, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x34, 0x01, 0xD3, 0xC0, 0x2C, 0x1E, 0x03, 0xC0, 0xF0, 0x38, 0x07, 0x8B, 0x40,
-    0x3C, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x1F,
-    0x80, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x06, 0x02, 0xD0, 0x0B, 0x02,
-    0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x01, 0xD0, 0x0E, 0x00,
-    0x3C, 0x03, 0x80, 0x07, 0x82, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x1E, 0x3C, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0xB0, 0x03, 0xC1, 0xF0, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01,
-    0xD0, 0x0F, 0x00, 0xB0, 0x01, 0xE0, 0x3C, 0x00, 0x3C, 0x0E, 0x00, 0x07, 0x8B, 0x40, 0x00, 0xF3,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x1E, 0x0F, 0x0B, 0xC2, 0x92, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xDB, 0x00, 0x36, 0xC0,
-    0x0D, 0xB0, 0x03, 0x6C, 0x01, 0xEB, 0x00, 0x79, 0xE0, 0x7E, 0x3F, 0xFF, 0x82, 0xF9, 0xE0, 0x00,
-    0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x28, 0x09, 0x3C, 0x1F, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x0C, 0x09, 0x0C, 0x09, 0x0C, 0x09, 0x0C, 0x0D, 0x0E, 0x6E, 0x07, 0xEE, 0x00, 0x0E,
-    0x00, 0x0E, 0x7F, 0xFF, 0x5E, 0x55, 0x47, 0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x2E, 0x00, 0x0B,
-    0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0xC0, 0x02, 0xF4, 0x00, 0x06, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xD0, 0x03, 0x40, 0x0D, 0x00, 0x34, 0x00, 0xE0, 0x03, 0x80,
-    0x0F, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x06, 0x82,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00,
-    0x00, 0x7C, 0x30, 0x00, 0x00, 0x7C, 0x30, 0x00, 0x00, 0x7C, 0x30, 0x00, 0x00, 0x7C, 0x34, 0x00,
-    0x00, 0x7C, 0x3F, 0xF8, 0x00, 0x7C, 0x74, 0x0F, 0x00, 0x7C, 0x74, 0x03, 0x00, 0x7C, 0x74, 0x03,
-    0x40, 0x7C, 0x74, 0x1F, 0x00, 0x7C, 0x7F, 0xFF, 0x00, 0x7D, 0x7F, 0xF8, 0x00, 0xBD, 0x06, 0x42,
-    0x80, 0x0B, 0x83, 0xC0, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x1C, 0xB0, 0x00, 0x1C, 0xB4, 0x00, 0x1C, 0x7F, 0xE4, 0x1C, 0x74, 0x1D, 0x1C, 0x74,
-    0x07, 0x1C, 0x74, 0x0B, 0x1C, 0x7E, 0xBE, 0x1C, 0x3F, 0xF8, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x01,
-    0xF3, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x2F,
-    0x40, 0x7F, 0xB4, 0x7E, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x02, 0x00, 0xB0, 0x2C, 0x00, 0xD1, 0xC0, 0x01, 0xDE, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x7F, 0x40, 0x03, 0xCF, 0x00, 0x2D, 0x1F, 0x01, 0xE0, 0x2F, 0xD0, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x6A, 0xA9, 0xBF, 0xFE, 0x6A, 0xA9, 0xBF, 0xFE, 0x6A, 0xAA, 0xA9, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA,
-    0xA6, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x19, 0xC0, 0x67, 0x01, 0x9C, 0x0A, 0x70, 0x29, 0xC0, 0xA6, 0x02, 0x98, 0x0A, 0x60,
-    0x26, 0x80, 0x9A, 0x02, 0x68, 0x0D, 0xA0, 0x36, 0x80, 0xD0, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x1A, 0xAA, 0xAA, 0x80,
-    0x14, 0x0F, 0xC2, 0xF0, 0x7C, 0x0F, 0x42, 0x90, 0x05, 0x07, 0xD1, 0xF0, 0x7C, 0x3E, 0x0A, 0x40,
-    0x05, 0x07, 0xD1, 0xF0, 0xBC, 0x3E, 0x0A, 0x40, 0x14, 0x0F, 0xC2, 0xF0, 0x7C, 0x0F, 0x42, 0x90,
-    0x14, 0x14, 0x0F, 0xCF, 0x82, 0xF3, 0xF0, 0x7C, 0xBC, 0x0F, 0x5F, 0x02, 0x92, 0x90, 0x05, 0x05,
-    0x07, 0xD7, 0xD1, 0xF1, 0xF0, 0x7C, 0xBC, 0x3E, 0x3E, 0x0A, 0x4A, 0x40, 0x05, 0x07, 0xD1, 0xF0,
-    0xBC, 0x3E, 0x0A, 0x40, 0x3F, 0x3F, 0x0B, 0xCB, 0xC1, 0xF1, 0xF0, 0x3D, 0x3D, 0x0A, 0x4A, 0x40,
-    0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0D, 0x50,
-    0xFF, 0xFF, 0x15, 0xD0, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x03, 0x40, 0x00, 0xD0, 0x00, 0x34, 0x00,
-    0x0D, 0x00, 0x03, 0x40, 0x00, 0xD0, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x02, 0x40, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D,
-    0x00, 0x00, 0xE5, 0x43, 0xFF, 0xFC, 0x14, 0xD0, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00,
-    0x00, 0xD0, 0x00, 0x5E, 0x50, 0x2F, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00,
-    0xE0, 0x00, 0x0A, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x2F, 0xFF, 0x00, 0xFF,
-    0xFC, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x7F, 0xFF, 0x42, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x00, 0x28, 0x0B, 0xE2, 0xF8, 0xA0, 0x00, 0x00, 0x18, 0x3D, 0x3E,
-    0x18, 0x3D, 0x3E, 0x18, 0x02, 0x80, 0x24, 0xF4, 0x0F, 0x01, 0xE3, 0xE0, 0x3D, 0x0B, 0xC0, 0x62,
-    0xC0, 0x00, 0x00, 0x50, 0x50, 0x03, 0x04, 0x50, 0x28, 0x25, 0x40, 0xC0, 0x59, 0x0A, 0x00, 0xF0,
-    0x70, 0x00, 0x03, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x71, 0x45, 0x03,
-    0x85, 0x54, 0x1C, 0x25, 0xA0, 0xE0, 0xA2, 0x80, 0x00, 0x00, 0x00, 0x05, 0x07, 0xD1, 0xF0, 0x7C,
-    0x3E, 0x0A, 0x40, 0x05, 0x05, 0x07, 0xD7, 0xD1, 0xF1, 0xF0, 0x7C, 0xBC, 0x3E, 0x3E, 0x0A, 0x4A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0x28, 0x0B, 0x07, 0x43, 0x81, 0xD0, 0xE0, 0xF0, 0x28,
-    0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xD0, 0x2C, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x30, 0xA0, 0x3C, 0xB0, 0x1D, 0x3C, 0x06, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0xC0,
-    0xD0, 0x2D, 0x1D, 0x0F, 0x00, 0xB0, 0xB0, 0x34, 0x03, 0x42, 0x41, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x37, 0x43, 0x87, 0x40, 0x00, 0x41, 0xD1, 0xD1, 0xD0, 0x7C, 0x07, 0xC0, 0x74, 0x04, 0x40,
-    0x2C, 0x02, 0xD0, 0x1D, 0x0F, 0x4F, 0x47, 0x40, 0x40, 0x00, 0x00, 0x60, 0x00, 0x00, 0xBC, 0x0F,
-    0x41, 0xF0, 0x03, 0xE0, 0xF8, 0x7C, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0x7E, 0x03, 0xE0, 0x00,
-    0x01, 0xF4, 0xFC, 0x00, 0x18, 0x0B, 0xFF, 0x00, 0x03, 0xD0, 0x3F, 0xC0, 0x78, 0x3E, 0x03, 0xFC,
-    0x0B, 0x80, 0x00, 0xFF, 0xF0, 0xA8, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x02,
-    0xFC, 0x03, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xE0, 0x2F, 0xE0, 0xF0, 0x7F, 0x80, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x01, 0x01, 0xC0, 0xB0, 0x2C, 0x0B, 0x03, 0xC0, 0xF0, 0x3C,
-    0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x05, 0x01, 0x43, 0xF0, 0xFC, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x0B,
-    0x00, 0x0B, 0xF8, 0x03, 0xEF, 0xF0, 0x20, 0xFB, 0x80, 0x0F, 0x3C, 0x00, 0xF3, 0xC0, 0x0F, 0x3C,
-    0x00, 0xF3, 0x80, 0x0F, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x6A, 0xA9, 0xBF, 0xFE, 0x00, 0x02, 0x80, 0x73, 0x9B, 0x47, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x66, 0x90, 0x00, 0x3C, 0x00, 0x03, 0x69, 0x00, 0x00, 0x80, 0x00, 0x50, 0x08, 0x5A,
-    0x66, 0xB8, 0x0F, 0x02, 0xE0, 0xEB, 0x62, 0x20, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x01, 0xC0, 0x00, 0x30, 0x00, 0x0A, 0x00, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x07,
-    0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0x07, 0x40, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xF9, 0x03, 0xEB, 0xF0, 0xBA, 0xBD, 0x08, 0x02,
-    0xE2, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00,
-    0x0B, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x01, 0xF4, 0x00, 0x7E, 0x00,
-    0x2F, 0x40, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x0B, 0x80,
-    0x01, 0xF0, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x3C,
-    0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x2A, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x03, 0xEB, 0xF0, 0x14, 0x80, 0x2E, 0x0E, 0x00, 0x03, 0xC3, 0x80, 0x00, 0xF0, 0xE0, 0x00,
-    0x3C, 0x38, 0x00, 0x1E, 0x0E, 0x00, 0x0F, 0x07, 0x80, 0x1F, 0x41, 0xE0, 0x2F, 0x80, 0x78, 0x0B,
-    0x80, 0x1E, 0x02, 0xE0, 0x0B, 0x80, 0xB8, 0x02, 0xE0, 0x28, 0x00, 0x14, 0x00, 0x00, 0x14, 0x01,
-    0x90, 0x0F, 0x40, 0xB8, 0x07, 0xD0, 0x3E, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x07, 0xEB, 0xE0, 0x09, 0x80, 0x3D, 0x07, 0x00, 0x07, 0x82, 0xC0, 0x00, 0xE0, 0xB0, 0x00, 0x78,
-    0x2C, 0x00, 0x2C, 0x0F, 0x00, 0x1E, 0x03, 0xC0, 0x1F, 0x00, 0xF0, 0x3F, 0x00, 0x3C, 0x0F, 0x00,
-    0x0F, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x24, 0x00, 0x04, 0x00, 0x00, 0x05, 0x02, 0x80,
-    0x0F, 0xC0, 0xF0, 0x03, 0xF0, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x00,
-    0x01, 0xC0, 0x00, 0x28, 0x00, 0x03, 0x40, 0x00, 0x70, 0x0B, 0x4B, 0x00, 0xF4, 0xE0, 0x0A, 0x4D,
-    0x00, 0x01, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0B, 0x00, 0x00, 0xE0, 0x00,
-    0x1D, 0x78, 0x02, 0xCB, 0xC0, 0x3C, 0xA8, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0F, 0x00, 0x00, 0xE0,
-    0x00, 0x1D, 0x00, 0x02, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x41, 0x45, 0x62,
-    0x72, 0x8F, 0xC0, 0x40, 0x00, 0x01, 0x80, 0xA0, 0x8C, 0x7F, 0x80, 0xC0, 0x2A, 0x08, 0x02, 0x00,
-    0xA8, 0x02, 0x8F, 0xD0, 0x00, 0x06, 0x08, 0x02, 0x91, 0xC6, 0x31, 0x8B, 0xC0, 0x00, 0x2A, 0x40,
-    0x20, 0x18, 0x0D, 0x03, 0x01, 0xC0, 0x60, 0x04, 0x08, 0x53, 0x14, 0x7C, 0x30, 0x9C, 0x71, 0xA0,
-    0x05, 0x08, 0x95, 0x08, 0xC7, 0x1E, 0xC0, 0x63, 0xF0, 0x00, 0x10, 0x03, 0xFF, 0xD0, 0x3E, 0x0B,
-    0x03, 0xC0, 0x34, 0x3C, 0x03, 0x83, 0xC0, 0x38, 0x3C, 0x03, 0xC7, 0xC0, 0x3C, 0x7C, 0x03, 0xC7,
-    0xC0, 0x7C, 0x01, 0x40, 0x21, 0x82, 0x42, 0x0C, 0x85, 0x33, 0x68, 0xC0, 0xA3, 0x87, 0x4B, 0xFC,
-    0x0B, 0xD0, 0x04, 0x0B, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x07, 0xF4, 0x19, 0x04, 0x90, 0x18, 0x0D,
-    0x0B, 0x0F, 0x43, 0xF8, 0x15, 0x00, 0x50, 0x14, 0x2C, 0x01, 0x84, 0xA3, 0xF0, 0x00, 0x01, 0x80,
-    0xA0, 0x8C, 0x7F, 0x80, 0xC0, 0x30, 0x2A, 0x04, 0x01, 0x00, 0xA8, 0x02, 0x5F, 0xC0, 0x00, 0x06,
-    0x48, 0x02, 0x91, 0xC6, 0x60, 0xCC, 0x61, 0xF0, 0x2A, 0x40, 0x60, 0x24, 0x0D, 0x03, 0x01, 0xC0,
-    0x60, 0x04, 0x02, 0x14, 0x31, 0x81, 0xF0, 0x30, 0xC7, 0x1C, 0x1A, 0x00, 0x05, 0x08, 0x95, 0x08,
-    0xC7, 0x1E, 0xC0, 0x63, 0xF0, 0x00, 0xC0, 0x28, 0x03, 0x00, 0xB0, 0x0D, 0x01, 0xC0, 0x2C, 0x03,
-    0x80, 0x34, 0x03, 0x40, 0x74, 0x07, 0x40, 0x34, 0x03, 0x40, 0x38, 0x03, 0xC0, 0x2C, 0x01, 0xD0,
-    0x0F, 0x00, 0xB0, 0x07, 0x80, 0x3C, 0x00, 0x40, 0x34, 0x01, 0xC0, 0x0D, 0x00, 0xB0, 0x03, 0x40,
-    0x38, 0x02, 0xC0, 0x1C, 0x00, 0xD0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xD0, 0x0D, 0x01, 0xC0, 0x2C,
-    0x03, 0xC0, 0x38, 0x0B, 0x40, 0xF0, 0x1E, 0x03, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x0D, 0x00, 0x0B, 0x0C, 0x00, 0x0E, 0x2C, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xFD, 0x02, 0xFC, 0x70,
-    0x07, 0xF8, 0xB0, 0x0F, 0x74, 0xE0, 0x1F, 0x70, 0xD0, 0x2E, 0xB1, 0xC0, 0x2D, 0xE2, 0xC0, 0x3F,
-    0xD3, 0x80, 0x3F, 0xC3, 0x40, 0x2F, 0xD7, 0x00, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFD, 0x0B, 0xBF, 0xF9, 0x0E, 0x2C, 0x00, 0x0D, 0x38, 0x00, 0x1C, 0x34, 0x00, 0x04, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x02, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-    0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x01, 0xEC, 0x2E, 0x01, 0xF8, 0x3F, 0x01,
-    0xC0, 0x2F, 0xC2, 0xC0, 0x1F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFD, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xF8, 0x03, 0xD0, 0x74, 0x0D, 0x00,
-    0x00, 0x34, 0x00, 0x01, 0xFA, 0xA4, 0x0B, 0xFF, 0xE0, 0x03, 0x80, 0x00, 0x6F, 0xA9, 0x01, 0xFF,
-    0xFC, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xA5, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x40, 0x02, 0xE0, 0x01, 0xE0, 0x03, 0xF0, 0x01, 0xE0, 0x03, 0xF8, 0x02, 0xE0, 0x03,
-    0xFC, 0x02, 0xE0, 0x03, 0xEE, 0x02, 0xE0, 0x03, 0xDF, 0x03, 0xD0, 0x07, 0xCB, 0x83, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x1B, 0xE7, 0xF7, 0xE5, 0x0B, 0xC1, 0xF3, 0xD0, 0x0B, 0xC0, 0xFB, 0xC0, 0x0B,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xC0, 0x3F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x03, 0xFF, 0x90, 0x01, 0xFA,
-    0xBE, 0x00, 0x74, 0x03, 0xC3, 0xFF, 0xFF, 0xFD, 0x0B, 0x80, 0x3D, 0x02, 0xD0, 0x1F, 0x00, 0xBF,
-    0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0x02, 0xC0, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x30, 0x0D, 0x00,
-    0x00, 0x0C, 0x0B, 0x00, 0x2F, 0x83, 0xFF, 0xC0, 0x2D, 0x40, 0xFF, 0xC0, 0x09, 0x00, 0x3F, 0xB8,
-    0x02, 0x80, 0x0E, 0x07, 0x00, 0x7E, 0x07, 0x81, 0xD0, 0x06, 0xF1, 0xE0, 0x38, 0x00, 0x1D, 0x78,
-    0x1F, 0x01, 0x9B, 0x5F, 0x07, 0xC0, 0xFF, 0xD7, 0xC1, 0xF0, 0x2F, 0xE0, 0x0D, 0x00, 0x03, 0x40,
-    0xD0, 0x00, 0x30, 0x0E, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x70, 0x0B, 0x06, 0x0B, 0x03, 0xFF, 0xFF,
-    0xFC, 0x2B, 0xAF, 0xEF, 0x80, 0x31, 0xF8, 0xD0, 0x03, 0x6E, 0xCC, 0x00, 0x3B, 0x9D, 0xC0, 0x03,
-    0xF8, 0xFC, 0x00, 0x2F, 0x4F, 0xC0, 0x02, 0xF0, 0xF8, 0x00, 0x1F, 0x0B, 0x80, 0x01, 0xE0, 0x74,
-    0x00, 0x15, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x04, 0x7D, 0x5F, 0x41, 0xC7, 0x40, 0x2C, 0x1C, 0x70,
-    0x00, 0xC1, 0xC7, 0x06, 0x0D, 0x1C, 0x70, 0xB0, 0xD1, 0xC7, 0x07, 0x0D, 0x1C, 0x70, 0x70, 0x01,
-    0xC7, 0x07, 0x00, 0x1C, 0x70, 0x3D, 0x03, 0xC7, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xAF, 0xC0, 0x00,
-    0x01, 0x40, 0x00, 0x0A, 0x00, 0x03, 0xFF, 0x80, 0x05, 0xE4, 0x02, 0xF7, 0x40, 0x2D, 0xBD, 0x00,
-    0xC0, 0xF4, 0x07, 0x02, 0xD0, 0x2C, 0x0B, 0x00, 0x78, 0x7D, 0x00, 0xFF, 0xF4, 0x00, 0xBD, 0x90,
-    0x55, 0x55, 0x42, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x0B, 0xFF, 0x00, 0x7D,
-    0x04, 0x02, 0xC0, 0x00, 0x0F, 0x10, 0x03, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x03, 0x84, 0x01, 0xFF,
-    0xF8, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x00,
-    0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0xC0, 0x00, 0xBF, 0x40, 0x07, 0xFC, 0x00, 0x01, 0x3E, 0xC0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00,
-    0x01, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xE4, 0x00,
-    0x07, 0xEB, 0xF4, 0x00, 0x1D, 0x00, 0xF0, 0x1A, 0xFE, 0xAB, 0xF8, 0x6B, 0xFA, 0xAF, 0xA0, 0x0B,
-    0x40, 0xBC, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x06, 0xFF, 0xE0, 0x03, 0xFF, 0xEB, 0x00, 0xFC, 0x28, 0x00, 0x1F, 0x42, 0x80, 0x02, 0xF0, 0x28,
-    0x00, 0x3E, 0x02, 0x80, 0x03, 0xE0, 0x24, 0x00, 0x3E, 0x02, 0xD4, 0x02, 0xE0, 0x2F, 0xFE, 0x2F,
-    0x02, 0x47, 0xE2, 0xF0, 0x34, 0x38, 0x0F, 0xD3, 0x47, 0xC0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0x40, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x10, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0xB4, 0x0B, 0xFF, 0xFF, 0xFF, 0x9A, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xEB, 0xFE, 0xAA, 0xAA, 0x5F, 0xE4, 0x16, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x0B,
-    0xF8, 0x2F, 0xD4, 0x3C, 0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x74, 0xC0, 0x78, 0xC0, 0x3E, 0xD0, 0x2F,
-    0xFC, 0x07, 0xFD, 0x00, 0x80, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xAA, 0xBD, 0xA9, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x02, 0xC0, 0x00, 0xD0, 0xBF, 0xFE, 0x02, 0xC0, 0xBF, 0x40,
-    0xBF, 0x40, 0x03, 0xC0, 0x01, 0xD0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x0E, 0x18, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0x0A, 0xF0, 0x80, 0x0F, 0xFC, 0x02, 0xF9, 0x00,
-    0xBF, 0x02, 0xC0, 0xF0, 0xB4, 0x0F, 0xBD, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x02, 0x40, 0x00, 0x0E, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x76, 0x8F, 0x02, 0xCA, 0x2C,
-    0x0B, 0x18, 0x70, 0x28, 0x61, 0xC0, 0xA1, 0x87, 0x02, 0x87, 0x1C, 0x0B, 0x1C, 0x70, 0x2C, 0x71,
-    0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xEA, 0xF4, 0x00, 0x74, 0x03, 0xC0, 0x07, 0x40, 0x2D, 0x00,
-    0x74, 0x02, 0xC0, 0x0B, 0x40, 0x7C, 0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0, 0x05, 0xF8, 0x00,
-    0x02, 0xAF, 0xEA, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x80, 0x00, 0x07, 0x00, 0x00, 0x74, 0x00, 0x03, 0x80,
-    0x00, 0x3D, 0x55, 0x51, 0xFF, 0xFF, 0xD2, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0xF0, 0x00, 0x7B, 0xB4, 0x0B, 0x4C, 0x74,
-    0x74, 0x30, 0x70, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x15, 0x55, 0xE2, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xD0, 0x00, 0x0E, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x01, 0xC0, 0xC1,
-    0xC2, 0xD3, 0x1D, 0x01, 0xEE, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xD0, 0x1C, 0x00, 0xD0, 0x02, 0x80, 0xA0, 0x00, 0x38, 0x7F, 0xFF, 0xFF, 0x4E, 0x00, 0x02, 0x80,
-    0xD0, 0x02, 0xC0, 0x0C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB8, 0x00, 0xEE,
-    0xC0, 0xD3, 0x1C, 0x10, 0xC1, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x50, 0xC0, 0x0E, 0x31,
-    0xC0, 0xFE, 0xC0, 0x0B, 0xC0, 0x00, 0x40, 0x00, 0x2A, 0xFE, 0x1F, 0x95, 0x07, 0xE0, 0x01, 0xCE,
-    0x00, 0x60, 0xE0, 0x28, 0x0E, 0x0A, 0x00, 0xE0, 0x00, 0x08, 0x3F, 0xA9, 0x01, 0x5B, 0xC0, 0x03,
-    0xF0, 0x03, 0x8C, 0x03, 0x83, 0x03, 0x80, 0xC3, 0x80, 0x35, 0x80, 0x00, 0x10, 0x00, 0x1D, 0x00,
-    0x41, 0xD0, 0x30, 0x2C, 0x1C, 0x02, 0xC7, 0x00, 0x3E, 0x80, 0x03, 0xE0, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x14, 0x03, 0xCA, 0x02, 0xC1, 0xC1, 0xC0, 0x31, 0xD0, 0x0D, 0xD0, 0x03, 0xE0,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x0B,
-    0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x07, 0x80,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x11, 0x00, 0x00, 0x38, 0x70, 0x00, 0x3E, 0x1F,
-    0x00, 0x3D, 0x86, 0xB0, 0x2C, 0x21, 0x8B, 0x1C, 0x08, 0x60, 0xA0, 0x02, 0x18, 0x00, 0x00, 0x86,
-    0x00, 0x00, 0x21, 0x80, 0x00, 0x08, 0x60, 0x00, 0x02, 0x18, 0x00, 0x00, 0x86, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xB0, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x2C, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0xD0, 0x00, 0x03, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x21, 0x40, 0x00, 0x08, 0x60, 0x00, 0x02, 0x18, 0x00, 0x00, 0x86, 0x00, 0x00, 0x21, 0x80, 0x00,
-    0x08, 0x60, 0x07, 0x02, 0x18, 0x24, 0xF0, 0x86, 0x2D, 0x0F, 0x61, 0x9D, 0x00, 0xF8, 0x7C, 0x00,
-    0x0E, 0x1C, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x1C, 0x03,
-    0x80, 0x03, 0x80, 0x1C, 0x00, 0xB0, 0x00, 0xB0, 0x2F, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x0E, 0x38,
-    0x00, 0x02, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0x80, 0x1D, 0x00, 0x1C, 0x03, 0x80, 0x00, 0x40, 0x10,
-    0x00, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00, 0x74, 0xF0, 0x0B, 0xC2, 0xB8, 0x36, 0x08, 0x70, 0x08,
-    0x20, 0x00, 0x20, 0x80, 0x00, 0x82, 0x00, 0x12, 0x08, 0x11, 0xFC, 0x23, 0xD1, 0xF0, 0xF8, 0x00,
-    0xFB, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xC0,
-    0x00, 0x0C, 0x00, 0x00, 0xC0, 0x04, 0x0C, 0x0F, 0xF5, 0xC3, 0xC1, 0xEC, 0x74, 0x0B, 0x8B, 0x00,
-    0x74, 0xB0, 0x07, 0x07, 0xD1, 0xE0, 0x3F, 0xFC, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x40, 0xD0, 0x0B, 0xEA, 0xFD, 0xE0, 0x0B, 0xD0, 0x0F, 0xE0, 0x03, 0xD0, 0x01, 0xF4,
-    0x01, 0xF0, 0x00, 0xFE, 0x00, 0xB4, 0x00, 0xE7, 0x80, 0x3D, 0x00, 0xE0, 0xF0, 0x0F, 0x00, 0xE0,
-    0x3C, 0x03, 0xC0, 0xE0, 0x0F, 0x00, 0xB4, 0xE0, 0x07, 0x80, 0x2F, 0xE0, 0x03, 0xE0, 0x03, 0xFE,
-    0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xEF, 0xFF, 0xFC, 0x00, 0xE0, 0x6F, 0xF8, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFB, 0x00,
-    0x01, 0xE7, 0x80, 0x03, 0xC3, 0xC0, 0x07, 0x81, 0xE0, 0x0F, 0x40, 0xF0, 0x1F, 0x00, 0xB8, 0x3D,
-    0x00, 0x3C, 0x7C, 0x00, 0x3E, 0xBE, 0xAA, 0xBF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF1, 0xE0, 0x78,
-    0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D,
-    0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x09, 0x02, 0x40, 0xD0, 0x38, 0x0D, 0x03,
-    0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80, 0xD0, 0x38, 0x0D, 0x03, 0x80,
-    0xD0, 0x38, 0x1E, 0x07, 0x8B, 0xFF, 0xFF, 0xBF, 0xFE, 0x70, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0x90, 0x00, 0x90, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x14, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x01, 0x0F, 0x80, 0x00, 0x78, 0xF4, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0xBD, 0x0F, 0xAE, 0xBA, 0xC7, 0x00,
-    0xF4, 0x1A, 0x80, 0x2C, 0x03, 0xA0, 0x0B, 0x00, 0xDD, 0x07, 0xFA, 0xE3, 0xFF, 0xAF, 0xF0, 0x2F,
-    0x82, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xD1, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x07, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x02, 0xA4, 0x00, 0x00, 0x2D, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x3E, 0x3E, 0x0B,
-    0x80, 0x22, 0xCA, 0x07, 0x38, 0x38, 0xA2, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x3C, 0x74,
-    0xB2, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0xC0, 0x00, 0x1E, 0x51, 0xFF, 0xFF, 0xC0, 0x03, 0x40, 0x00, 0x2C, 0x00, 0x01, 0xE1, 0x52, 0xFF,
-    0xFF, 0xC0, 0x74, 0x00, 0x03, 0x80, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xBE, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x0B,
-    0x01, 0x40, 0x00, 0x00, 0xFF, 0xFA, 0x50, 0x00, 0x16, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x6F, 0xF0, 0x1B, 0xFF, 0x80, 0x2F, 0xE4, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x16,
-    0xBF, 0xF4, 0x7E, 0x95, 0x00, 0x00,
+static const uint8_t opendyslexic_8_regularBitmaps[16167] = {
+    0x5D, 0x55, 0x41, 0x6C, 0x15, 0xC7, 0x19, 0xFE, 0x66, 0x27, 0x66, 0x1A, 0xD6, 0x78, 0x12, 0xC9,
+    0x91, 0x12, 0x41, 0xBC, 0x97, 0x54, 0xE2, 0x60, 0xBF, 0xB5, 0x22, 0x1F, 0xAC, 0x66, 0xF7, 0xED,
+    0x12, 0x14, 0xB9, 0x0A, 0x17, 0x72, 0x48, 0x5B, 0x89, 0x03, 0x9C, 0xAB, 0x2A, 0xF8, 0x60, 0x29,
+    0x3E, 0xAC, 0xFD, 0x36, 0x41, 0x15, 0x07, 0x50, 0xC2, 0x21, 0xB9, 0x54, 0xAD, 0x9A, 0x43, 0xA4,
+    0x28, 0x22, 0x29, 0x3E, 0xF8, 0xF0, 0x0E, 0x0F, 0x76, 0xE0, 0x1D, 0x38, 0xB8, 0x6A, 0x06, 0x10,
+    0xA7, 0xAA, 0xEA, 0x52, 0xDC, 0x43, 0x20, 0x11, 0x83, 0xD9, 0x88, 0x75, 0xD8, 0xF7, 0x26, 0xFF,
+    0xAC, 0x11, 0x4A, 0x3B, 0x3B, 0x9A, 0xDD, 0x9D, 0x99, 0x7F, 0xFE, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF,
+    0x87, 0x31, 0xB5, 0x31, 0xEB, 0x73, 0x65, 0x22, 0xE9, 0x86, 0x09, 0x76, 0xD4, 0x34, 0x09, 0xA6,
+    0x27, 0xE4, 0xB9, 0xE1, 0x4D, 0x63, 0xEA, 0xB8, 0xBB, 0x7F, 0x7F, 0x8A, 0x43, 0x02, 0xF0, 0x3D,
+    0x05, 0xDA, 0x01, 0x94, 0x8B, 0x48, 0xAC, 0xB5, 0x6F, 0xBD, 0x77, 0xE2, 0xD3, 0x54, 0x1C, 0xD1,
+    0xF0, 0xF4, 0x0A, 0xB0, 0x39, 0x87, 0x89, 0xF5, 0x93, 0x9F, 0x2E, 0xD1, 0x82, 0x71, 0xBB, 0x98,
+    0x89, 0x80, 0x4C, 0x02, 0x13, 0x2C, 0x05, 0x90, 0xC2, 0x3B, 0x0F, 0xF4, 0x6A, 0x92, 0x54, 0xB2,
+    0xD6, 0xD8, 0x39, 0x0F, 0x79, 0x58, 0xC1, 0x9E, 0x07, 0xB7, 0xDB, 0x10, 0xD6, 0xE0, 0xB0, 0x55,
+    0xDE, 0x47, 0xE3, 0x89, 0xC3, 0xF6, 0x8E, 0xB5, 0x23, 0x3A, 0xFF, 0x43, 0x6B, 0x73, 0xD0, 0x16,
+    0xF6, 0x6B, 0x12, 0x7F, 0x0E, 0x98, 0x97, 0xF9, 0x67, 0xF3, 0xA7, 0xD4, 0xFC, 0xEB, 0xE9, 0xFC,
+    0xFB, 0x08, 0xFF, 0x85, 0x89, 0x4E, 0x89, 0xF8, 0x10, 0xBE, 0x9B, 0x64, 0x7F, 0x9F, 0xE4, 0x6F,
+    0xFF, 0xC1, 0xF7, 0xCC, 0xF3, 0x68, 0x5B, 0x58, 0x42, 0xFE, 0x36, 0x67, 0x6A, 0x16, 0x33, 0x5C,
+    0xE1, 0x07, 0x03, 0xDE, 0x90, 0xE6, 0x1C, 0xF2, 0x6F, 0xF0, 0xCC, 0x6A, 0xD4, 0x65, 0xF7, 0xCF,
+    0x18, 0x61, 0xC2, 0xDB, 0x16, 0xD6, 0xAE, 0x32, 0x52, 0x42, 0x6D, 0xBA, 0x1B, 0x47, 0x11, 0xD4,
+    0x61, 0x8E, 0x8D, 0x03, 0x24, 0xC9, 0xF3, 0x05, 0x9E, 0xAE, 0x88, 0x94, 0xC6, 0x45, 0xAE, 0x66,
+    0x99, 0x96, 0xD8, 0x10, 0x79, 0x84, 0x74, 0x81, 0xA9, 0x03, 0xD8, 0xA0, 0x59, 0x4F, 0x1D, 0x82,
+    0x9E, 0x42, 0x39, 0x05, 0xDD, 0x0A, 0xA8, 0x45, 0x3F, 0x35, 0xA4, 0x6F, 0xDA, 0x99, 0x7A, 0x4A,
+    0xFC, 0x6E, 0xA3, 0xA7, 0x45, 0xE9, 0xBF, 0x7F, 0x6D, 0xF2, 0x05, 0x0E, 0x10, 0x18, 0x7A, 0x74,
+    0x61, 0xDB, 0xB7, 0x22, 0x9F, 0x88, 0x1B, 0x66, 0xD0, 0xDD, 0x9F, 0xFE, 0xFE, 0xCB, 0x62, 0xFC,
+    0x72, 0xDC, 0xA5, 0x1D, 0x38, 0x04, 0x2F, 0xC7, 0x02, 0xC8, 0xCF, 0x1B, 0x98, 0x02, 0x34, 0x66,
+    0xC1, 0x7F, 0x36, 0xC1, 0xDA, 0x09, 0x45, 0x13, 0x3E, 0x60, 0x7E, 0x36, 0xB1, 0xEC, 0xE0, 0xB3,
+    0x0B, 0x7C, 0x89, 0xE7, 0xCB, 0xFA, 0xC0, 0xF2, 0xF0, 0xAB, 0x85, 0xFB, 0x07, 0x7E, 0x75, 0x75,
+    0x6A, 0x55, 0xFC, 0x75, 0xE9, 0x96, 0x35, 0xBD, 0x5A, 0x54, 0xB4, 0x1E, 0xE4, 0x6F, 0xE4, 0xFC,
+    0xD9, 0x23, 0xE8, 0x39, 0xF8, 0x49, 0x31, 0x2A, 0x46, 0x2C, 0x0D, 0xC6, 0xFB, 0x8E, 0x94, 0x74,
+    0x92, 0x4F, 0x67, 0x79, 0xA5, 0x67, 0x78, 0x25, 0x2A, 0xBE, 0xFB, 0x8E, 0x6D, 0x0A, 0x9B, 0x86,
+    0xD5, 0x2F, 0x44, 0x4A, 0x0A, 0x26, 0x09, 0xC4, 0x89, 0xB4, 0x48, 0x91, 0xD1, 0x36, 0xEF, 0xE6,
+    0x9F, 0x1E, 0xDA, 0xEA, 0xF4, 0xB6, 0x53, 0x3B, 0x05, 0x3F, 0x17, 0x25, 0xFF, 0x8A, 0x6F, 0x79,
+    0x37, 0xAF, 0x96, 0x55, 0x61, 0xFF, 0x78, 0xF2, 0x02, 0xD7, 0xA8, 0x10, 0xD3, 0xA2, 0xB4, 0x4B,
+    0x60, 0x0E, 0x5F, 0xB0, 0x3B, 0xF1, 0x1B, 0x8D, 0x08, 0x12, 0xFC, 0xFA, 0x45, 0x92, 0xED, 0x95,
+    0xC0, 0x4B, 0xCC, 0x5E, 0x2D, 0x51, 0xD2, 0x6A, 0xC7, 0x1E, 0xD3, 0x3B, 0xE5, 0xD4, 0x0A, 0xFF,
+    0x0B, 0xEE, 0xDE, 0xA8, 0x7A, 0xCD, 0xBE, 0xDA, 0x85, 0xD0, 0x2A, 0x66, 0x48, 0x64, 0x0A, 0x22,
+    0xF5, 0x34, 0xD9, 0x9B, 0x21, 0x84, 0xCC, 0x79, 0xC9, 0x2A, 0x78, 0xDB, 0x4C, 0x7F, 0xB6, 0xC8,
+    0x79, 0xBA, 0x10, 0xF9, 0xEC, 0xC7, 0xD2, 0x6F, 0xB8, 0xAE, 0x56, 0xF8, 0x56, 0x1A, 0xF5, 0xC5,
+    0xF0, 0x49, 0xE5, 0xEF, 0xC2, 0xAF, 0xFC, 0x63, 0x67, 0xB1, 0xA3, 0x5E, 0xDD, 0x10, 0x7F, 0x66,
+    0x77, 0xF3, 0xBA, 0x18, 0xB3, 0x2F, 0x72, 0xDC, 0x38, 0x52, 0xD9, 0x26, 0xA9, 0x31, 0xD7, 0xED,
+    0x3A, 0xE8, 0xF4, 0x92, 0xE2, 0x9A, 0x71, 0x9F, 0xC7, 0xD7, 0x02, 0x7F, 0x58, 0x7E, 0x0E, 0xBC,
+    0x06, 0xAF, 0x42, 0x2F, 0x15, 0x6E, 0xC0, 0x95, 0x14, 0xE1, 0xA8, 0x65, 0x2C, 0x1B, 0xB4, 0xFC,
+    0xEB, 0x8D, 0x5F, 0x6A, 0x99, 0xD2, 0x1B, 0xBB, 0x9D, 0x48, 0x52, 0x38, 0xA8, 0x61, 0x0E, 0xAF,
+    0x01, 0x6B, 0x58, 0xB1, 0xDD, 0xDB, 0xC5, 0x15, 0x3C, 0x6D, 0x45, 0xDE, 0x2D, 0x3C, 0xF4, 0x5D,
+    0x80, 0x22, 0x37, 0xAC, 0x92, 0xF5, 0x42, 0xD3, 0xF1, 0x5D, 0x90, 0x83, 0x62, 0x17, 0x6B, 0x17,
+    0x35, 0xCC, 0x81, 0x97, 0xCF, 0x58, 0x2B, 0x6E, 0x6F, 0x62, 0x05, 0xF3, 0x9C, 0x08, 0x34, 0x1B,
+    0x2A, 0x55, 0x9E, 0xE1, 0xE2, 0xAD, 0xC9, 0xC9, 0x99, 0xD7, 0x96, 0x97, 0xB3, 0xE4, 0x7A, 0x5A,
+    0xBD, 0x58, 0x71, 0xC2, 0x2B, 0xAA, 0x7D, 0x94, 0x2E, 0x0D, 0x3C, 0x4B, 0x81, 0x7D, 0x17, 0xE8,
+    0x90, 0xA7, 0x15, 0xCD, 0x82, 0xFF, 0x03, 0xB8, 0xAB, 0xB0, 0xB9, 0x82, 0x48, 0x12, 0xF3, 0xB5,
+    0x9F, 0xAE, 0x72, 0x1D, 0x30, 0x6B, 0xB5, 0xB5, 0x4D, 0x86, 0x20, 0x24, 0x55, 0xB6, 0xE6, 0xB7,
+    0x2F, 0x4B, 0x2C, 0x46, 0x30, 0x46, 0x9C, 0xB1, 0xB5, 0xBC, 0x58, 0x47, 0xE8, 0x1B, 0x3C, 0x52,
+    0xFC, 0x1B, 0x84, 0xDD, 0x4B, 0x8D, 0xB5, 0xB7, 0xEC, 0x6E, 0x8B, 0xC7, 0x1F, 0xA1, 0x37, 0x22,
+    0xC0, 0x42, 0x41, 0xA6, 0x08, 0x5A, 0x45, 0x73, 0xED, 0x98, 0x10, 0x58, 0x85, 0x60, 0x7C, 0x59,
+    0xDA, 0x11, 0xB7, 0x23, 0x14, 0x7B, 0x02, 0x94, 0xD9, 0xB9, 0xB4, 0x0D, 0x57, 0x01, 0x65, 0x3F,
+    0x1D, 0x2B, 0x29, 0xDE, 0x84, 0x67, 0x60, 0x10, 0x46, 0xF0, 0xBF, 0x81, 0x78, 0x74, 0xEF, 0x52,
+    0x4D, 0x50, 0x12, 0xDB, 0x48, 0xEB, 0x8C, 0x26, 0x2B, 0x7A, 0xE3, 0xA5, 0x14, 0x9B, 0xF0, 0xDB,
+    0xC1, 0xAA, 0xA2, 0xF1, 0x9F, 0xFE, 0x5A, 0xFB, 0xB1, 0x25, 0x30, 0xCA, 0xD1, 0x68, 0xF8, 0xED,
+    0x71, 0x43, 0x0E, 0x9C, 0x21, 0x81, 0x1B, 0xD6, 0xF4, 0x09, 0x82, 0x9F, 0x7B, 0x25, 0x39, 0xB7,
+    0x4B, 0x94, 0xA0, 0x5C, 0xFA, 0x84, 0xE8, 0x62, 0xFC, 0x6D, 0x06, 0x17, 0x0E, 0x80, 0x96, 0x68,
+    0xA5, 0xF5, 0x6B, 0x17, 0xC5, 0x7F, 0x4A, 0xD6, 0x23, 0xCB, 0x3F, 0x18, 0x51, 0x2D, 0xA2, 0xF3,
+    0x48, 0xB9, 0xC3, 0xFB, 0x02, 0xA6, 0x57, 0x11, 0xF5, 0x9F, 0xF6, 0x78, 0xAF, 0x0F, 0x10, 0x17,
+    0x76, 0xD4, 0xF6, 0x71, 0x83, 0xF5, 0x06, 0xDD, 0x76, 0x5C, 0xC7, 0x20, 0x7B, 0xD6, 0x06, 0x83,
+    0xCB, 0x74, 0xB4, 0x96, 0x69, 0x0C, 0xAA, 0x72, 0x92, 0x82, 0x4B, 0xAF, 0x00, 0x19, 0x33, 0x42,
+    0x75, 0x58, 0x5D, 0x0C, 0xC7, 0x3E, 0x05, 0xD5, 0x57, 0x9B, 0x31, 0xBF, 0x56, 0xCA, 0x00, 0x51,
+    0x8D, 0xC7, 0x8A, 0x8F, 0x20, 0x0D, 0x7A, 0x8A, 0x59, 0x25, 0x1E, 0xE4, 0x61, 0x92, 0xF7, 0x93,
+    0x0F, 0xCB, 0xE2, 0xE3, 0xDC, 0x52, 0x61, 0x24, 0x27, 0x29, 0x56, 0xEE, 0x99, 0x97, 0x33, 0x67,
+    0x55, 0x6B, 0x9E, 0xC6, 0x95, 0x8B, 0x54, 0x49, 0x09, 0x2D, 0xB5, 0x06, 0xC1, 0xD1, 0x0A, 0x23,
+    0x69, 0x44, 0xDD, 0x53, 0xE1, 0x9D, 0x07, 0xF9, 0x93, 0xB3, 0x97, 0xC4, 0x83, 0x99, 0xB5, 0xEE,
+    0x20, 0x1B, 0xED, 0xEC, 0xEC, 0xD8, 0xAD, 0xAD, 0xE1, 0x38, 0x09, 0x7D, 0xD3, 0x0C, 0x82, 0xE1,
+    0x63, 0x13, 0xCB, 0x7F, 0x2B, 0xC7, 0x4E, 0xE0, 0x15, 0xCC, 0x24, 0xD4, 0xF3, 0x4E, 0xA2, 0x3A,
+    0x89, 0xEE, 0xC4, 0x26, 0x8E, 0xAA, 0x38, 0xCB, 0xE2, 0x2C, 0x8E, 0xB3, 0x20, 0x1E, 0xC8, 0xC1,
+    0x40, 0x34, 0x03, 0xDE, 0x34, 0x8E, 0xBD, 0x17, 0xBC, 0x1F, 0xAF, 0x78, 0x95, 0x30, 0x15, 0xD6,
+    0x32, 0xC8, 0xAF, 0xC1, 0x08, 0x5C, 0x42, 0xA1, 0x27, 0x5E, 0x7D, 0x0F, 0x76, 0x5F, 0xA3, 0xB6,
+    0x17, 0x9B, 0xD0, 0x5A, 0xCF, 0x5A, 0x1C, 0x1C, 0xB7, 0xE1, 0xAE, 0xC5, 0x3D, 0x4A, 0xBC, 0xEB,
+    0xE9, 0xDC, 0x8A, 0xB7, 0x95, 0x66, 0x85, 0x3D, 0x67, 0x75, 0x9F, 0xB0, 0x53, 0x18, 0x88, 0x90,
+    0xCD, 0xDE, 0x40, 0x99, 0x9E, 0x52, 0x85, 0xD7, 0x58, 0xA3, 0x3A, 0xA1, 0xB8, 0xEE, 0xB4, 0x37,
+    0x08, 0x5D, 0x34, 0x98, 0x23, 0x4A, 0x6D, 0x66, 0x74, 0x77, 0xD0, 0xEF, 0x51, 0x3D, 0x1D, 0x49,
+    0x8A, 0x6D, 0x60, 0xA9, 0xE8, 0xD8, 0x1A, 0x07, 0x1D, 0x3F, 0x28, 0x21, 0x90, 0x94, 0x7B, 0x9A,
+    0x70, 0x6F, 0xC0, 0xB1, 0x32, 0x89, 0x72, 0x59, 0x7C, 0xF0, 0xDF, 0xCB, 0xC2, 0xEA, 0xC0, 0xE6,
+    0x03, 0xF9, 0xA6, 0x09, 0x7C, 0x15, 0x85, 0xA8, 0x1A, 0x71, 0xD7, 0x04, 0x8A, 0x15, 0xA5, 0x47,
+    0x0E, 0x23, 0x36, 0x66, 0x20, 0x77, 0x52, 0xBE, 0x01, 0x74, 0xB7, 0xF8, 0xA4, 0xDD, 0x21, 0x0E,
+    0x5D, 0x96, 0xFC, 0x52, 0x8C, 0xC8, 0x88, 0xC0, 0xD9, 0xD1, 0xB2, 0xD6, 0xF9, 0xD8, 0x8E, 0x29,
+    0x8C, 0xFF, 0xDF, 0xB3, 0xFF, 0xED, 0x6B, 0x7B, 0x71, 0x58, 0xDB, 0xEB, 0x7D, 0x64, 0x6D, 0x7F,
+    0xC6, 0xA0, 0x28, 0x43, 0xB6, 0xCE, 0x88, 0xDA, 0x75, 0x62, 0x2B, 0xA7, 0x70, 0x2F, 0x85, 0x72,
+    0xB7, 0xE0, 0x9F, 0xA1, 0x8A, 0xD8, 0x41, 0xC0, 0x0C, 0x2F, 0x65, 0xBA, 0x86, 0xBE, 0xAF, 0x84,
+    0xAA, 0x11, 0x07, 0x29, 0x7F, 0x64, 0x28, 0x8D, 0x08, 0x84, 0x86, 0x6C, 0x5C, 0xCD, 0x20, 0xEE,
+    0xC3, 0xFB, 0x27, 0x71, 0x9A, 0xC4, 0x20, 0x86, 0xC4, 0xFE, 0x7E, 0xCC, 0x8C, 0x7C, 0xB3, 0x4C,
+    0x52, 0x13, 0x88, 0x26, 0x80, 0xB1, 0x37, 0x4B, 0x79, 0xF2, 0x74, 0x8C, 0x27, 0x0F, 0x1F, 0x2B,
+    0x7F, 0x4C, 0x52, 0x3D, 0x55, 0xE4, 0xBC, 0xE6, 0x15, 0x45, 0x3C, 0x69, 0x75, 0x3A, 0x07, 0x7B,
+    0xBA, 0xC3, 0x4A, 0x4E, 0x9E, 0xCD, 0x2A, 0xF8, 0xB5, 0x03, 0xEE, 0x92, 0x36, 0xA1, 0x4C, 0x5C,
+    0x47, 0x70, 0x4E, 0x4B, 0xD5, 0xF8, 0x3A, 0x38, 0x5B, 0x7A, 0xEE, 0x6A, 0xC0, 0x4F, 0x9D, 0x55,
+    0x4F, 0x6C, 0x5C, 0xC5, 0x19, 0xFF, 0xCD, 0x8C, 0xF1, 0x84, 0x1D, 0xBC, 0x93, 0x43, 0x90, 0x22,
+    0xB4, 0xDE, 0xF5, 0x81, 0x83, 0x41, 0xCF, 0x59, 0x4B, 0xDD, 0x4A, 0x8B, 0x78, 0xDE, 0xF7, 0x02,
+    0x48, 0x41, 0x44, 0x15, 0x96, 0x9A, 0x0A, 0x0E, 0x48, 0x44, 0xA8, 0xEA, 0x21, 0x97, 0xEC, 0x61,
+    0x25, 0x1B, 0xB1, 0xC9, 0x0E, 0x24, 0x2A, 0x52, 0x2B, 0x41, 0x8A, 0xCA, 0x85, 0x56, 0xC2, 0xE2,
+    0x4F, 0x55, 0xCC, 0xA1, 0x3E, 0xF8, 0xE0, 0x83, 0xC3, 0x8E, 0x9D, 0x83, 0x0F, 0xA9, 0xCA, 0xC4,
+    0x11, 0xEA, 0xA1, 0x97, 0xA7, 0x3A, 0x02, 0x09, 0x54, 0x18, 0x25, 0xAB, 0x6A, 0x03, 0x6F, 0x77,
+    0xFA, 0xBD, 0x35, 0x41, 0xF4, 0xCA, 0x7C, 0xF3, 0x66, 0x9F, 0x76, 0xDE, 0xF7, 0xCD, 0x6F, 0xE6,
+    0xFB, 0xFD, 0xBE, 0xD9, 0xC4, 0x52, 0x8C, 0xEE, 0x09, 0x0C, 0x34, 0xF3, 0xEA, 0x9A, 0x13, 0xFF,
+    0xB2, 0x3C, 0xA4, 0x08, 0xC0, 0x55, 0x60, 0x7B, 0xD2, 0xF3, 0xA2, 0xB3, 0x1C, 0x3A, 0x84, 0x27,
+    0x43, 0xB0, 0x0F, 0x3E, 0xE7, 0x21, 0x06, 0x10, 0xC3, 0x7B, 0x3D, 0xFF, 0x51, 0x0F, 0xEB, 0x7F,
+    0x0D, 0x21, 0x24, 0x21, 0xB8, 0x87, 0xDE, 0x1A, 0x47, 0xC2, 0xC6, 0xF7, 0x7A, 0x53, 0x98, 0xA6,
+    0x34, 0xAB, 0x32, 0xED, 0xC8, 0x74, 0x53, 0xA5, 0x1B, 0x2A, 0xEF, 0x5B, 0x1C, 0xC1, 0x9A, 0xC4,
+    0xA2, 0x30, 0x15, 0xB8, 0x32, 0x36, 0x64, 0x1A, 0x73, 0x3B, 0x0B, 0x3B, 0x75, 0xEE, 0xF4, 0x80,
+    0x3E, 0x25, 0x07, 0x61, 0x7E, 0xF0, 0xA7, 0xA9, 0x88, 0xDB, 0x05, 0xEE, 0x66, 0xD9, 0xCD, 0x51,
+    0x92, 0x01, 0x65, 0xFC, 0xE7, 0xC8, 0xFD, 0xE7, 0xD6, 0xFF, 0x12, 0x82, 0x07, 0x70, 0x0C, 0x9E,
+    0x3B, 0xFA, 0x4D, 0xDA, 0xFA, 0x6F, 0x4F, 0xDA, 0xCD, 0x86, 0x3C, 0x85, 0x66, 0x5B, 0xBC, 0x8E,
+    0xED, 0x56, 0x7F, 0x37, 0xE4, 0xEA, 0x73, 0x0B, 0x48, 0x8B, 0x6E, 0x31, 0xC4, 0x10, 0x16, 0xAD,
+    0xB1, 0xB8, 0xDB, 0x6D, 0xB1, 0x9B, 0xAE, 0x1C, 0xE3, 0xC0, 0x55, 0xEB, 0x7F, 0xDA, 0x09, 0x43,
+    0x35, 0x42, 0xD1, 0xE4, 0xB0, 0x7E, 0x26, 0x46, 0x67, 0x62, 0xAB, 0x68, 0xA1, 0x9E, 0x4F, 0x4F,
+    0x26, 0x1C, 0x66, 0xEE, 0x0D, 0xF5, 0x5F, 0xE8, 0xF1, 0xBE, 0xDD, 0x6E, 0x88, 0x3D, 0xC4, 0x6D,
+    0xB1, 0x67, 0xBA, 0x49, 0x7F, 0x27, 0xE4, 0xD3, 0x77, 0x09, 0x01, 0x1F, 0x62, 0xD0, 0x9E, 0xE7,
+    0x97, 0xDE, 0xC9, 0x7B, 0x5F, 0xBE, 0x0E, 0x34, 0xE9, 0xA8, 0x8E, 0xEB, 0x60, 0xEB, 0xB7, 0x80,
+    0x5E, 0x19, 0x6E, 0x46, 0x86, 0xFA, 0x72, 0x56, 0x46, 0x56, 0x66, 0x59, 0x8D, 0x79, 0x79, 0xB0,
+    0x17, 0xEE, 0xBC, 0x3A, 0xB2, 0xAD, 0xB6, 0xFA, 0x33, 0xFF, 0x02, 0xC3, 0x6F, 0xC7, 0xB5, 0xF0,
+    0x2A, 0x85, 0x19, 0x2C, 0x6F, 0x27, 0x63, 0x35, 0xA6, 0x55, 0x2B, 0xE0, 0x16, 0xD1, 0xE1, 0x20,
+    0x7E, 0x67, 0x92, 0x20, 0xB2, 0xD5, 0x58, 0x5C, 0xB2, 0x51, 0x93, 0x5F, 0x33, 0x51, 0x57, 0xEC,
+    0xD9, 0xB8, 0x2B, 0xEC, 0x7C, 0xB7, 0x0B, 0x1C, 0x6D, 0x14, 0xAD, 0xD9, 0x6C, 0x76, 0xB1, 0x29,
+    0x5C, 0x29, 0x25, 0x6F, 0x66, 0x25, 0x45, 0x68, 0x33, 0xAB, 0xC8, 0x7D, 0x83, 0xDB, 0x12, 0x9A,
+    0x3C, 0x0B, 0xFC, 0x0A, 0x4D, 0x89, 0xEF, 0x4F, 0x82, 0x10, 0xFE, 0x36, 0x6D, 0x7A, 0xB1, 0x8D,
+    0x24, 0xA5, 0xB4, 0xBE, 0xE2, 0xE4, 0xBB, 0xE9, 0xEA, 0x55, 0xF9, 0xDA, 0xF0, 0x58, 0x59, 0x18,
+    0xD7, 0x99, 0x95, 0xCC, 0x6E, 0x44, 0x8A, 0xDB, 0x7E, 0xDD, 0x55, 0x3E, 0x51, 0xAE, 0xFF, 0xC9,
+    0x77, 0xBB, 0x3E, 0x11, 0xCF, 0xA6, 0x5B, 0xA5, 0x98, 0xB9, 0xA6, 0x57, 0xB8, 0x43, 0xE9, 0xF9,
+    0x14, 0x5E, 0x13, 0x8C, 0xA5, 0xAC, 0x0A, 0x8F, 0xA3, 0x22, 0xB8, 0x96, 0x12, 0xB6, 0x51, 0xE0,
+    0x6C, 0xC6, 0x87, 0x10, 0xF7, 0x6C, 0x77, 0x7A, 0xC8, 0xBE, 0xF5, 0x4D, 0x71, 0x29, 0x8D, 0xDA,
+    0x6C, 0x2F, 0xAD, 0xD0, 0x06, 0xBE, 0x1C, 0xD6, 0x02, 0xCE, 0x9B, 0x23, 0x27, 0xF0, 0xF8, 0x57,
+    0x69, 0xAE, 0x84, 0xAB, 0x68, 0x2C, 0xC6, 0x70, 0x43, 0x49, 0xD9, 0xD1, 0xC1, 0xBD, 0x3C, 0xA6,
+    0xA4, 0x6A, 0x10, 0x50, 0xF8, 0x49, 0x6E, 0xB0, 0x9C, 0xEA, 0x91, 0x8B, 0x94, 0x6D, 0x48, 0xDB,
+    0x16, 0xB6, 0x4D, 0xA3, 0xB2, 0x4B, 0xE7, 0x6D, 0x2D, 0x58, 0xF9, 0x5F, 0x03, 0x71, 0x79, 0x42,
+    0xC2, 0x01, 0x18, 0x16, 0x7C, 0x7F, 0x3F, 0xD3, 0x69, 0x0C, 0x2F, 0xAC, 0x4E, 0x2F, 0x40, 0x8E,
+    0xE4, 0xAF, 0xB8, 0xC1, 0x26, 0x74, 0x86, 0xBE, 0x81, 0x7F, 0xEC, 0x42, 0x12, 0x14, 0x11, 0x1D,
+    0xDC, 0x08, 0x23, 0x4D, 0x92, 0xCB, 0xB4, 0x30, 0x55, 0x98, 0x51, 0xB9, 0xCA, 0xDB, 0xE2, 0x05,
+    0xFC, 0x33, 0x7D, 0xD9, 0x55, 0x1B, 0xF2, 0x0D, 0x76, 0x60, 0xB7, 0xC2, 0xB8, 0x1E, 0x5E, 0x1B,
+    0x16, 0x30, 0x1C, 0xDB, 0xB5, 0x65, 0x69, 0x3A, 0x5A, 0xD8, 0xEA, 0x2C, 0x62, 0x8F, 0x9E, 0xC1,
+    0x08, 0x62, 0x82, 0xB0, 0x0A, 0xFA, 0x16, 0x9B, 0x7E, 0x2E, 0x5E, 0xA8, 0x6B, 0xF9, 0xEE, 0x17,
+    0x86, 0x94, 0x50, 0xFF, 0xC6, 0xCB, 0xDB, 0x39, 0x06, 0x2D, 0x68, 0x96, 0x55, 0x35, 0x41, 0x43,
+    0x62, 0x48, 0x58, 0x84, 0xB3, 0xE5, 0xF9, 0xED, 0xAC, 0x26, 0xDC, 0x80, 0x76, 0xC4, 0x6E, 0xDA,
+    0xA8, 0x2A, 0xAC, 0x6F, 0xCA, 0xDF, 0xA7, 0xB1, 0x67, 0xA1, 0x40, 0x7A, 0x11, 0xD2, 0x11, 0x6B,
+    0x6B, 0x26, 0xF1, 0xA4, 0x34, 0x6A, 0x44, 0xA5, 0x75, 0x52, 0x22, 0x84, 0xC3, 0x90, 0xB8, 0xA9,
+    0x2D, 0xA7, 0x60, 0x41, 0x06, 0x9A, 0xE4, 0xB9, 0x34, 0x13, 0xF8, 0x34, 0x7D, 0x95, 0xC2, 0x97,
+    0xE9, 0xF7, 0xD0, 0x94, 0x67, 0x6B, 0x2B, 0x2B, 0x2B, 0xBF, 0x39, 0xB7, 0xBE, 0x4E, 0x21, 0xFA,
+    0x90, 0x46, 0xD8, 0xC2, 0x88, 0x54, 0x39, 0xB6, 0x59, 0xC6, 0x5D, 0x61, 0xC2, 0x25, 0xF6, 0x51,
+    0x74, 0x16, 0xDE, 0xDA, 0x75, 0x78, 0x50, 0x5F, 0xF3, 0x5B, 0x44, 0x3A, 0x1F, 0xD3, 0x26, 0x7D,
+    0x4C, 0xE9, 0xDF, 0x88, 0x24, 0x0E, 0x55, 0xE0, 0x60, 0xD5, 0xB0, 0x7E, 0x2B, 0xB6, 0x9D, 0x89,
+    0xAD, 0xDA, 0x96, 0xAD, 0xE7, 0x72, 0xC4, 0x2C, 0xCC, 0x24, 0x43, 0x48, 0x86, 0xC2, 0x75, 0x48,
+    0x26, 0x0D, 0x60, 0x8D, 0x18, 0x08, 0x91, 0xE2, 0xFC, 0x47, 0x2C, 0xE4, 0xA4, 0x27, 0x4A, 0xE7,
+    0x45, 0x2A, 0x12, 0x1F, 0xEA, 0x30, 0x7A, 0x78, 0x5A, 0x87, 0x9D, 0x1B, 0xD9, 0x46, 0xBC, 0x50,
+    0x55, 0x61, 0xEF, 0xEB, 0xAD, 0x74, 0x8A, 0x9C, 0x33, 0xB1, 0x93, 0xC5, 0xFC, 0xC0, 0x89, 0x31,
+    0xA4, 0x87, 0xBE, 0x22, 0x43, 0x86, 0x41, 0xB1, 0x59, 0xBD, 0xFC, 0xFD, 0xAB, 0x2D, 0xD6, 0x58,
+    0x59, 0x69, 0xE3, 0x70, 0x33, 0xA8, 0x65, 0xE2, 0xA4, 0x39, 0x0B, 0x99, 0x22, 0x71, 0xFA, 0xAB,
+    0x1D, 0x3B, 0x53, 0x61, 0x2E, 0xE4, 0x45, 0x09, 0xCB, 0xA1, 0x76, 0xC3, 0x30, 0x29, 0x44, 0x74,
+    0xBC, 0xA4, 0x4F, 0x5D, 0xFB, 0xB7, 0x2F, 0x99, 0xCB, 0x97, 0xCD, 0x4B, 0xFC, 0xF4, 0x99, 0x3F,
+    0x98, 0x5F, 0xD3, 0xBF, 0xF9, 0xDC, 0xEE, 0x03, 0x3F, 0xBF, 0x71, 0x17, 0x27, 0xD9, 0x8D, 0x9D,
+    0xFD, 0x1B, 0xFB, 0xB6, 0xBB, 0x25, 0xAF, 0x9B, 0xCE, 0xC6, 0xD4, 0xD4, 0xFA, 0x99, 0xFE, 0xF8,
+    0xF0, 0xF8, 0xCE, 0x7D, 0xD4, 0x1F, 0xDF, 0x97, 0xBE, 0x7D, 0xF9, 0xA9, 0x97, 0xF6, 0x9F, 0xFE,
+    0xE3, 0x7B, 0x85, 0x17, 0x0B, 0x13, 0x04, 0x6C, 0xC4, 0x3E, 0x77, 0x59, 0xD4, 0x54, 0x5A, 0xEC,
+    0x04, 0x57, 0x73, 0x30, 0xCC, 0x32, 0xDB, 0x0F, 0xC5, 0x08, 0x62, 0x55, 0x8F, 0x96, 0x3D, 0x0E,
+    0xBB, 0x38, 0x1F, 0xD5, 0x2C, 0x15, 0xA7, 0x2B, 0x53, 0xF3, 0xFC, 0xA9, 0xF7, 0xFD, 0xFC, 0xF5,
+    0xA3, 0x31, 0x6E, 0xDA, 0x99, 0x25, 0x46, 0x35, 0x87, 0x86, 0xAC, 0x9A, 0xF0, 0x83, 0x30, 0x7E,
+    0x3C, 0x1C, 0xD4, 0xDF, 0x5C, 0x24, 0xD2, 0x82, 0xB1, 0xFA, 0x33, 0xBD, 0x52, 0xBF, 0xD4, 0x2B,
+    0x25, 0x4A, 0xAB, 0x9A, 0xAC, 0xC9, 0x13, 0xB2, 0x45, 0x76, 0x51, 0x5E, 0x90, 0xD1, 0xD2, 0x23,
+    0x48, 0x9F, 0x3F, 0xB2, 0x39, 0xCF, 0x61, 0xE6, 0x1E, 0xA0, 0xB0, 0xA5, 0x27, 0x9E, 0x5E, 0xFC,
+    0xE5, 0xFD, 0xF4, 0x92, 0x9A, 0x28, 0xE6, 0xFB, 0x76, 0x36, 0xD2, 0x2F, 0xEA, 0x17, 0xE5, 0x69,
+    0x9C, 0x9C, 0x64, 0x6A, 0x95, 0xC2, 0x9D, 0xA5, 0xC7, 0x88, 0x74, 0x9A, 0xB0, 0xCC, 0xC3, 0x62,
+    0xAD, 0x04, 0x75, 0xAB, 0x8D, 0xE4, 0x20, 0x35, 0x88, 0x14, 0x25, 0xB3, 0x8B, 0xB2, 0x58, 0x44,
+    0xBB, 0xE1, 0x84, 0x09, 0x2E, 0xA2, 0xDA, 0x76, 0x05, 0x8D, 0x2A, 0xF9, 0x3E, 0x4F, 0xCF, 0x59,
+    0x22, 0xBA, 0x91, 0x28, 0x61, 0x11, 0xF3, 0xDC, 0xF0, 0xBB, 0x33, 0x57, 0xF5, 0xF0, 0xB3, 0x19,
+    0x48, 0x8A, 0xD4, 0x40, 0xC6, 0xA9, 0xA4, 0x54, 0x48, 0x4E, 0x99, 0x36, 0x0A, 0xBD, 0xAC, 0xC1,
+    0xD6, 0xD3, 0x5E, 0xA1, 0x26, 0x4C, 0x51, 0x55, 0x77, 0x32, 0x9B, 0xA6, 0xCC, 0x2F, 0x42, 0x3C,
+    0x61, 0xA6, 0xB7, 0x2B, 0xA8, 0x3B, 0x37, 0x07, 0x22, 0x11, 0x1A, 0x35, 0x08, 0xF3, 0x77, 0x54,
+    0x66, 0x28, 0x42, 0x32, 0x50, 0x44, 0x8D, 0x87, 0x8B, 0x82, 0xFA, 0x01, 0x74, 0x7A, 0xA8, 0xF0,
+    0xA3, 0xC5, 0xDB, 0x80, 0x06, 0x3E, 0x20, 0x12, 0x57, 0x0F, 0x0B, 0x14, 0x25, 0x77, 0x95, 0x48,
+    0x70, 0xAC, 0xF6, 0xB1, 0x39, 0x5F, 0x14, 0x79, 0x46, 0x44, 0x5B, 0x00, 0x26, 0x05, 0x7F, 0xD2,
+    0x94, 0x29, 0xE4, 0xC7, 0xA8, 0x4C, 0xDF, 0x31, 0x68, 0x7A, 0x2C, 0xCC, 0x82, 0x78, 0x2B, 0xCD,
+    0x80, 0xBB, 0x2A, 0x06, 0xD2, 0xF6, 0xC2, 0x80, 0xAE, 0xA4, 0x1A, 0xE4, 0x75, 0x4B, 0xB2, 0x11,
+    0x85, 0xE8, 0x0B, 0x26, 0xD3, 0x6A, 0xFF, 0xDF, 0x4E, 0x90, 0xC0, 0x2C, 0x24, 0xD1, 0xEC, 0x1F,
+    0x40, 0xA1, 0xE3, 0x0E, 0x62, 0x8D, 0xAA, 0x70, 0x2A, 0x5D, 0x15, 0xAE, 0xC6, 0x48, 0xCC, 0x21,
+    0xE4, 0xA4, 0xC7, 0x3A, 0x44, 0x36, 0xB9, 0x2B, 0xA8, 0x6F, 0x60, 0x5A, 0xDE, 0x0B, 0xC0, 0xB3,
+    0xC9, 0x75, 0x49, 0x27, 0x11, 0x67, 0xA0, 0xAB, 0x45, 0x9D, 0x4A, 0x49, 0x3F, 0x2C, 0x5B, 0xC2,
+    0xA6, 0x34, 0x4B, 0xCC, 0xD7, 0xC2, 0x88, 0x6E, 0xD1, 0x3D, 0xCB, 0x6E, 0x7B, 0x52, 0xEF, 0xDA,
+    0x32, 0x7E, 0x36, 0x87, 0xE3, 0xDD, 0x9F, 0xB4, 0x0D, 0xEE, 0x3C, 0x06, 0x5D, 0x3C, 0xF2, 0xD0,
+    0x4F, 0x3B, 0x84, 0x1F, 0xDA, 0xFF, 0x00, 0x9D, 0x55, 0xBD, 0x6F, 0x23, 0x45, 0x14, 0xFF, 0xCD,
+    0x4E, 0xC8, 0x1E, 0xD9, 0xBB, 0x4C, 0x8A, 0x14, 0x17, 0x11, 0xC5, 0x11, 0xBA, 0x22, 0x02, 0x12,
+    0x9F, 0x44, 0x8A, 0x20, 0xED, 0x7A, 0x17, 0x45, 0x90, 0x96, 0xE2, 0x7A, 0xFE, 0x01, 0xA4, 0x73,
+    0xE1, 0xE2, 0x84, 0x36, 0x78, 0xC5, 0x15, 0x29, 0x40, 0xC2, 0xB4, 0x54, 0x29, 0x41, 0x08, 0xF9,
+    0x90, 0x5C, 0x04, 0x69, 0x13, 0x8F, 0x2E, 0x45, 0x0A, 0x90, 0x58, 0x44, 0x07, 0x12, 0x2C, 0x22,
+    0xBA, 0xC2, 0x11, 0x62, 0x05, 0x8B, 0xF0, 0xDD, 0xAD, 0xF7, 0xF1, 0x66, 0x9D, 0x84, 0x84, 0xC2,
+    0x3A, 0x32, 0x7E, 0x1E, 0xCF, 0xC8, 0xEF, 0xF3, 0xF7, 0x3E, 0x06, 0x0B, 0xC0, 0xB5, 0x08, 0x56,
+    0x8A, 0x7F, 0x97, 0xB9, 0x14, 0x40, 0x3B, 0x80, 0x9B, 0x62, 0xD6, 0x85, 0xB3, 0x15, 0x48, 0x9D,
+    0x89, 0xD4, 0x43, 0xCF, 0x8E, 0x3C, 0x91, 0xD5, 0x68, 0xA4, 0x88, 0x8E, 0xB4, 0xF8, 0x23, 0x43,
+    0x63, 0x2C, 0xE2, 0x10, 0x45, 0xF0, 0xE9, 0x31, 0x2C, 0xE2, 0xDB, 0x6C, 0xCC, 0xDB, 0x97, 0x19,
+    0x60, 0xEF, 0x68, 0xC0, 0x55, 0x14, 0x89, 0xD4, 0x2F, 0xA1, 0x90, 0x03, 0xA1, 0x4C, 0x21, 0x89,
+    0x34, 0x6A, 0x44, 0x94, 0xE4, 0x20, 0xFA, 0x40, 0xF3, 0xFD, 0xDC, 0xB8, 0x33, 0x42, 0x7B, 0x64,
+    0xE5, 0xB0, 0x35, 0x54, 0x80, 0x1A, 0xB0, 0x06, 0xAC, 0x56, 0xBB, 0x0F, 0xD4, 0x59, 0xAC, 0xDC,
+    0x57, 0x34, 0x92, 0x34, 0x42, 0x9F, 0xAD, 0xB1, 0xB3, 0xBB, 0xC0, 0x32, 0x64, 0x34, 0x05, 0xB4,
+    0x20, 0xC6, 0x61, 0xD8, 0x54, 0xB4, 0xCB, 0xAD, 0x00, 0x3D, 0x38, 0xD5, 0x46, 0xBA, 0x5F, 0x38,
+    0xA7, 0x57, 0xA2, 0x8F, 0xA8, 0x30, 0xF6, 0x01, 0x19, 0xA0, 0x89, 0xD9, 0x0B, 0x81, 0xB7, 0xE9,
+    0x88, 0x8E, 0x5B, 0x38, 0x63, 0x65, 0x21, 0xD2, 0xA7, 0x3A, 0x14, 0x0D, 0x89, 0xBE, 0xA5, 0x02,
+    0x09, 0xEA, 0xC1, 0xF3, 0x37, 0x80, 0xB9, 0x67, 0x33, 0x33, 0x33, 0x2D, 0xB2, 0xBC, 0xAE, 0xA2,
+    0x67, 0x75, 0x6B, 0xD9, 0x4A, 0xF8, 0x66, 0x70, 0xD0, 0xA1, 0x7D, 0x89, 0x62, 0x47, 0xEF, 0x4F,
+    0x5D, 0x5F, 0x59, 0xAF, 0x3C, 0xBD, 0x17, 0x9E, 0xAF, 0x38, 0xDE, 0x07, 0x16, 0x51, 0x2C, 0x2E,
+    0x8E, 0x93, 0x97, 0xD9, 0xBA, 0x86, 0x50, 0x5C, 0xFC, 0x89, 0xAD, 0xCC, 0x49, 0x56, 0x95, 0xDA,
+    0x7A, 0xF8, 0xF1, 0xEE, 0x69, 0xA8, 0x75, 0x06, 0x58, 0x64, 0x08, 0x19, 0xE1, 0xCB, 0x87, 0x98,
+    0xFF, 0x72, 0x12, 0xC3, 0x22, 0x69, 0x68, 0x32, 0x05, 0xA9, 0x6B, 0x5A, 0x6A, 0x99, 0x4A, 0xFE,
+    0x5B, 0x6A, 0xE4, 0x2F, 0x0F, 0xB0, 0xE7, 0x13, 0x62, 0x3E, 0xF3, 0x57, 0x14, 0x72, 0xD0, 0x1D,
+    0x32, 0x5F, 0x66, 0xB2, 0x6A, 0x64, 0x90, 0x77, 0xC4, 0x87, 0x91, 0x30, 0xA9, 0xC7, 0x02, 0x96,
+    0x7C, 0xA6, 0x68, 0xCD, 0xD7, 0x6B, 0x7E, 0xBA, 0xE6, 0x65, 0x9E, 0x9B, 0x7B, 0x61, 0xE8, 0x85,
+    0x9E, 0x17, 0xD6, 0xBC, 0x58, 0xC5, 0xB1, 0x5D, 0xC4, 0xB2, 0x28, 0x44, 0x81, 0x0E, 0xB0, 0x04,
+    0x88, 0xCA, 0x41, 0xD1, 0xEF, 0x58, 0x4F, 0x0E, 0xAC, 0xDC, 0xCE, 0x72, 0x6C, 0x87, 0x50, 0x5F,
+    0x40, 0x50, 0x00, 0x9F, 0x4B, 0x22, 0x87, 0xFC, 0x0D, 0xE2, 0x24, 0xC1, 0x90, 0x3E, 0x2F, 0xEA,
+    0x44, 0x16, 0x3B, 0xF8, 0x42, 0x59, 0x85, 0x24, 0x59, 0x8E, 0x6D, 0xA6, 0x55, 0x6E, 0xCE, 0xD7,
+    0x74, 0x19, 0x38, 0x83, 0xA1, 0x93, 0xD4, 0x0E, 0x13, 0xF1, 0x17, 0xD7, 0x6B, 0x0F, 0xF6, 0x08,
+    0xE0, 0x7A, 0xF3, 0x13, 0x28, 0xBE, 0x74, 0x03, 0xF9, 0x6B, 0xD9, 0xCD, 0xFA, 0xC4, 0xC9, 0x2E,
+    0x70, 0x77, 0x78, 0x26, 0x67, 0x07, 0xB0, 0x7B, 0x98, 0xB6, 0xAA, 0x64, 0xDC, 0x3D, 0xC6, 0x41,
+    0x37, 0xDA, 0x17, 0x85, 0x87, 0xDA, 0xDB, 0x90, 0x27, 0x01, 0xDA, 0x2C, 0x9D, 0x41, 0xB2, 0xAA,
+    0xA7, 0x01, 0xDE, 0xCD, 0xD1, 0xF0, 0x07, 0xC4, 0x4D, 0xA0, 0xFB, 0xA4, 0xA7, 0xA9, 0xCA, 0x36,
+    0x5A, 0x6F, 0xE1, 0xD5, 0x3B, 0xB8, 0xE6, 0x5E, 0x35, 0x20, 0x91, 0x64, 0xD8, 0x73, 0xF1, 0xD2,
+    0xCC, 0x55, 0x15, 0xDC, 0x9A, 0x5F, 0xE2, 0xF4, 0xAB, 0xD4, 0x0D, 0x2B, 0x7F, 0x82, 0x4A, 0xA7,
+    0x39, 0x65, 0x66, 0x7B, 0x50, 0xD5, 0x91, 0xD9, 0x2A, 0x0F, 0x57, 0xCD, 0xA6, 0x4C, 0xAC, 0xBF,
+    0x33, 0x63, 0xD9, 0x67, 0x24, 0x0B, 0xC9, 0x68, 0x84, 0xA6, 0xA3, 0xD7, 0xF0, 0x67, 0x62, 0xDA,
+    0x77, 0x8F, 0x8B, 0x21, 0xE4, 0x56, 0xCC, 0x3C, 0x3B, 0x82, 0x5B, 0xE7, 0x76, 0x53, 0x8A, 0xEB,
+    0x57, 0x52, 0xB4, 0xCD, 0xDD, 0x33, 0x60, 0x4E, 0x1E, 0x0C, 0x01, 0x0F, 0x01, 0x03, 0xC1, 0x53,
+    0x3E, 0xA1, 0xC2, 0xB3, 0xB2, 0xDF, 0x18, 0x97, 0x1D, 0xAF, 0x9A, 0xF1, 0xA4, 0x6A, 0x09, 0xC7,
+    0x6C, 0x62, 0x9C, 0xBD, 0xA8, 0xF2, 0xEB, 0xE6, 0x29, 0xFC, 0x05, 0xB6, 0xC7, 0xB4, 0x87, 0xB0,
+    0x22, 0xF7, 0x9C, 0x42, 0x84, 0xEF, 0x89, 0xC2, 0xA7, 0xA1, 0x4F, 0xB9, 0x43, 0x55, 0x40, 0x37,
+    0x4C, 0x07, 0x60, 0xE3, 0x72, 0xE6, 0xFF, 0xAF, 0x92, 0x39, 0x03, 0x87, 0xF8, 0x09, 0x96, 0x08,
+    0xAE, 0x20, 0x6E, 0xDF, 0xD7, 0xCE, 0x61, 0x32, 0xF3, 0x7E, 0xE7, 0x2A, 0xA6, 0x2F, 0x86, 0x70,
+    0x79, 0xF5, 0xE0, 0xB9, 0x60, 0xC8, 0x73, 0x25, 0x32, 0xD6, 0x2F, 0x7F, 0xD4, 0x16, 0xC3, 0xCA,
+    0x40, 0x73, 0xD3, 0xC7, 0x15, 0x15, 0x86, 0xB8, 0x7F, 0x36, 0x30, 0x1B, 0xC8, 0x12, 0xBF, 0x64,
+    0x1B, 0x6A, 0x16, 0xDF, 0x47, 0xAD, 0x34, 0x6E, 0x0C, 0x55, 0xCA, 0xB0, 0xA6, 0x46, 0xAB, 0x7D,
+    0x6C, 0xE9, 0x64, 0x5D, 0x4A, 0xF1, 0xE0, 0xF6, 0x6D, 0xFB, 0x4D, 0xB4, 0x9A, 0xF6, 0x66, 0xD2,
+    0xE2, 0xC1, 0xFE, 0x4A, 0x4F, 0x7E, 0xDD, 0x1D, 0x7E, 0x55, 0x62, 0xCA, 0xD8, 0xAA, 0x9E, 0x01,
+    0xF9, 0x37, 0x9E, 0xE4, 0xAE, 0xB3, 0x19, 0xB4, 0x9A, 0x72, 0x07, 0x1B, 0x4D, 0xE7, 0xF0, 0x84,
+    0xEB, 0x4A, 0x1F, 0xBC, 0x33, 0xEE, 0xB1, 0x5D, 0xE3, 0xEA, 0xE9, 0xF2, 0x9B, 0xAA, 0xBB, 0xA9,
+    0x7B, 0xEB, 0xF6, 0x16, 0xF3, 0x31, 0x73, 0xDC, 0xE8, 0x3F, 0xE4, 0x46, 0x7A, 0xA4, 0xAB, 0x80,
+    0x64, 0x86, 0xEF, 0xF4, 0x24, 0x2E, 0xE7, 0x0D, 0x7C, 0xD3, 0x59, 0x74, 0x27, 0xD9, 0x5C, 0x98,
+    0xB1, 0xD2, 0xAC, 0x51, 0x9B, 0xC4, 0xC2, 0x23, 0xE3, 0x45, 0x58, 0xCB, 0x66, 0x7A, 0x4C, 0xF6,
+    0x88, 0x55, 0xD4, 0x52, 0xD5, 0xCD, 0x57, 0x5C, 0x47, 0x5F, 0x5F, 0xB7, 0x7F, 0x28, 0x9B, 0xB2,
+    0xFC, 0xAC, 0xC9, 0x08, 0x35, 0x1D, 0x8D, 0x46, 0xFF, 0xF1, 0x73, 0xDC, 0x3D, 0x23, 0xE7, 0xD1,
+    0xCF, 0x5C, 0xB3, 0xF6, 0xB0, 0x7E, 0xC7, 0xE5, 0x07, 0xC5, 0x7C, 0xEE, 0x71, 0xE9, 0xD6, 0x0B,
+    0x9E, 0x1A, 0x1D, 0xCC, 0x63, 0x5E, 0xA4, 0x17, 0x5F, 0x1A, 0x33, 0x70, 0x87, 0xC8, 0x9B, 0x2B,
+    0xD6, 0xFD, 0x4F, 0x8A, 0xF6, 0x60, 0xC7, 0x64, 0x50, 0xE6, 0x37, 0x15, 0xE9, 0xFA, 0xF1, 0xD9,
+    0x0B, 0xA3, 0x2E, 0x67, 0xB4, 0x1E, 0xA9, 0x2D, 0x2B, 0x5A, 0x79, 0xAD, 0x7B, 0x54, 0x7E, 0xDA,
+    0x34, 0x65, 0xEF, 0xBF, 0x1E, 0x51, 0x61, 0x95, 0x01, 0xEB, 0xAF, 0x63, 0x7A, 0x11, 0xC1, 0xDC,
+    0x64, 0xBD, 0x17, 0x9F, 0x94, 0x49, 0x7C, 0xB7, 0x44, 0x6A, 0x1B, 0xA6, 0x75, 0x19, 0x54, 0x14,
+    0x6D, 0xC8, 0x28, 0xFC, 0x6F, 0x7D, 0xFD, 0x03, 0xA5, 0x54, 0x4D, 0x68, 0x1B, 0x47, 0x14, 0xFE,
+    0x66, 0x27, 0xF6, 0xB6, 0xDA, 0xC8, 0xEB, 0x43, 0x0C, 0xA6, 0x28, 0xDA, 0x1E, 0x0D, 0x95, 0xB3,
+    0x3A, 0xA8, 0x74, 0x4B, 0x17, 0x69, 0x5B, 0x1F, 0x7C, 0x28, 0x94, 0x16, 0x7A, 0xCC, 0x21, 0xD0,
+    0x6B, 0xC1, 0x3A, 0x08, 0xAA, 0x50, 0x35, 0xDA, 0xD4, 0x07, 0x1F, 0x42, 0x9B, 0xF6, 0x5A, 0x28,
+    0xE8, 0x18, 0x4A, 0x8B, 0x54, 0xF0, 0xC1, 0x07, 0x27, 0x9A, 0x5A, 0x07, 0x51, 0x0A, 0xF5, 0x26,
+    0x39, 0xE4, 0x2A, 0xEA, 0xD0, 0x83, 0x4B, 0x60, 0x42, 0x16, 0xAA, 0xA4, 0x6B, 0xBD, 0xBC, 0x95,
+    0xAC, 0x24, 0x3E, 0xD8, 0x31, 0xCD, 0x9B, 0xDD, 0xD9, 0xBF, 0xF7, 0xBE, 0xEF, 0xBD, 0x6F, 0x67,
+    0x1E, 0xB2, 0x39, 0x0F, 0x6C, 0xA5, 0xD4, 0x3C, 0xCF, 0x6B, 0x00, 0x59, 0x3C, 0xC8, 0x66, 0xC7,
+    0xEF, 0x10, 0xC9, 0x20, 0xCB, 0x97, 0x81, 0x0C, 0xE7, 0xD0, 0xC0, 0xB2, 0x6D, 0x6F, 0xEC, 0x7C,
+    0xDF, 0xC2, 0xE4, 0x5B, 0x16, 0x32, 0x40, 0xC4, 0x37, 0x73, 0x90, 0x21, 0x06, 0xFC, 0x3D, 0x35,
+    0x19, 0x01, 0x05, 0xA0, 0x7D, 0x03, 0x15, 0xC2, 0x7C, 0x11, 0x74, 0x11, 0xFA, 0x4B, 0xD4, 0xAC,
+    0xB0, 0x20, 0x22, 0x0B, 0x55, 0x11, 0xD7, 0x51, 0x49, 0x60, 0x3C, 0x66, 0xCF, 0x1D, 0x7C, 0x56,
+    0x9C, 0xC9, 0xA7, 0x41, 0xF3, 0x92, 0xA2, 0xB2, 0x25, 0x55, 0xC9, 0x97, 0xEB, 0xCA, 0xF3, 0x65,
+    0x5F, 0xF9, 0x0D, 0x9E, 0x1A, 0x67, 0x80, 0x1A, 0xC4, 0x00, 0x87, 0x36, 0x3B, 0x14, 0x4F, 0xB4,
+    0x27, 0xD7, 0x83, 0x42, 0x55, 0xF4, 0x83, 0x9C, 0x67, 0xF4, 0xF6, 0x87, 0x0E, 0x61, 0x2D, 0x4C,
+    0x79, 0x03, 0x54, 0x39, 0x93, 0x23, 0xB6, 0x16, 0x3A, 0x6D, 0x19, 0x7A, 0x25, 0xA3, 0x8F, 0x5C,
+    0x4D, 0xF4, 0xC2, 0x42, 0xB9, 0x7D, 0x95, 0xF4, 0xEC, 0x10, 0x9C, 0xB6, 0x8B, 0xCC, 0x59, 0x26,
+    0x3E, 0x19, 0xD7, 0xFC, 0x00, 0xBF, 0xBF, 0x79, 0x76, 0xF9, 0xA5, 0xFC, 0x99, 0x59, 0xA1, 0x63,
+    0xD7, 0x0E, 0x5F, 0x9A, 0xA7, 0x86, 0x54, 0xC8, 0x8C, 0x9D, 0x66, 0x3E, 0x21, 0x52, 0x7C, 0x5D,
+    0x02, 0xBF, 0x35, 0x59, 0x35, 0x84, 0x2C, 0x1C, 0x2B, 0x59, 0x84, 0x09, 0xB4, 0x58, 0x5E, 0xA1,
+    0x66, 0x13, 0xF1, 0x9F, 0xF6, 0xDE, 0xE9, 0x7D, 0x58, 0xA8, 0x3E, 0xEC, 0xCF, 0xE5, 0x2E, 0xDF,
+    0xE9, 0x8D, 0xB6, 0x18, 0xA8, 0x19, 0x5A, 0x69, 0xD0, 0x1C, 0x44, 0x94, 0x86, 0x28, 0x16, 0xE9,
+    0xF5, 0x43, 0x6A, 0x8E, 0xF7, 0x81, 0x00, 0xC8, 0xE1, 0x1E, 0xDE, 0x8E, 0xF2, 0x35, 0xF3, 0x1B,
+    0xB1, 0x17, 0xD6, 0xF5, 0x85, 0x0A, 0x5D, 0xA3, 0xC1, 0x2D, 0x9F, 0x2B, 0xCE, 0x71, 0xA0, 0xF9,
+    0x5C, 0xA4, 0xAA, 0xBC, 0x88, 0x7B, 0xC1, 0xE5, 0x28, 0x5F, 0x32, 0xBF, 0x15, 0x7B, 0x6A, 0x8B,
+    0x46, 0x2E, 0x7D, 0x3D, 0xD4, 0x9C, 0xCD, 0x10, 0x77, 0xC2, 0x60, 0xFE, 0x58, 0xA8, 0xC5, 0x8C,
+    0xBD, 0xDA, 0xFB, 0x4B, 0xA7, 0x18, 0xC7, 0x91, 0x2D, 0x4E, 0x7E, 0xCB, 0x51, 0x93, 0xC1, 0x79,
+    0xDF, 0xF8, 0x6D, 0xE0, 0xDB, 0x32, 0xAC, 0x6F, 0xCA, 0x5D, 0x38, 0x1A, 0x23, 0x98, 0x03, 0x7C,
+    0x05, 0x53, 0x89, 0xA1, 0x24, 0x54, 0x26, 0x3A, 0x76, 0xC6, 0xA3, 0x1B, 0xFC, 0xAA, 0x3B, 0x5E,
+    0x27, 0xC7, 0xC3, 0xEB, 0x74, 0xBE, 0x88, 0xAE, 0x30, 0xDE, 0x64, 0xD8, 0x66, 0xA8, 0xB7, 0xDE,
+    0xC8, 0x4C, 0x45, 0x2F, 0x89, 0xBB, 0xAA, 0x90, 0x97, 0x4A, 0x7B, 0xE6, 0xB5, 0xC0, 0xD7, 0x82,
+    0x60, 0x0F, 0x70, 0x25, 0x55, 0xB6, 0x01, 0x27, 0xAC, 0x68, 0x39, 0x9C, 0x26, 0xD0, 0x4D, 0xB0,
+    0xF0, 0x2C, 0x1B, 0x2B, 0x84, 0xD4, 0x10, 0x07, 0xC0, 0xA3, 0x10, 0x9E, 0xC6, 0xF2, 0x79, 0xD8,
+    0x52, 0x99, 0x61, 0x6C, 0x44, 0x79, 0xC4, 0xA6, 0x6A, 0x52, 0x5C, 0x21, 0x72, 0x60, 0xFE, 0xA1,
+    0x58, 0x10, 0x18, 0xA4, 0x17, 0x82, 0xB4, 0x88, 0x7F, 0xF1, 0x24, 0xF6, 0xAD, 0x95, 0xA0, 0x56,
+    0x95, 0x1B, 0xF0, 0xAA, 0x56, 0xEF, 0x9F, 0xC4, 0x25, 0x75, 0xEB, 0xF3, 0x14, 0xF3, 0xBB, 0x25,
+    0x38, 0x3F, 0x8F, 0x31, 0x9F, 0xDB, 0x16, 0x50, 0x01, 0x9C, 0x08, 0xB6, 0x07, 0x79, 0x1D, 0xC6,
+    0xED, 0x08, 0xDA, 0x47, 0xDD, 0x0E, 0x96, 0xC5, 0xC0, 0x0E, 0x1A, 0x26, 0xD1, 0x0A, 0xD1, 0x43,
+    0x8D, 0xC6, 0x36, 0xD2, 0x75, 0x64, 0x84, 0x97, 0xEC, 0x5F, 0xD0, 0x0C, 0x26, 0x8A, 0x1D, 0x4B,
+    0x76, 0x01, 0xB0, 0x15, 0xCC, 0x18, 0xF2, 0x4F, 0x60, 0x4F, 0x61, 0xB3, 0x06, 0xDF, 0x46, 0x5E,
+    0x46, 0x56, 0x50, 0x97, 0x91, 0x23, 0x88, 0x22, 0xA2, 0x84, 0x05, 0x70, 0x21, 0x79, 0x1B, 0xA9,
+    0xF1, 0x51, 0x04, 0x2B, 0x3D, 0xC9, 0xAA, 0x52, 0xB5, 0xDB, 0x2B, 0x6A, 0xB3, 0x64, 0xAE, 0x32,
+    0x2C, 0x63, 0x6F, 0x97, 0xBB, 0x3B, 0x94, 0x58, 0x7F, 0x2B, 0x5C, 0x4A, 0x97, 0x54, 0x63, 0xFA,
+    0xCB, 0x58, 0xA7, 0xB4, 0x2F, 0x1C, 0x31, 0xEB, 0x00, 0xCD, 0x03, 0x23, 0x4E, 0xB1, 0xEC, 0x00,
+    0x0E, 0xD2, 0x64, 0x96, 0xC7, 0x33, 0x17, 0xEA, 0x2A, 0x38, 0xA3, 0x9B, 0x36, 0x1D, 0x48, 0x3A,
+    0x40, 0xF7, 0x71, 0xEA, 0x5F, 0xE4, 0x45, 0x1D, 0x61, 0x5C, 0x91, 0x39, 0x74, 0x3F, 0xF5, 0x79,
+    0xD5, 0xA6, 0xA3, 0x8E, 0x32, 0xDC, 0x64, 0x36, 0x15, 0x2B, 0x3B, 0x0E, 0xBD, 0xAD, 0xFE, 0x3F,
+    0x47, 0x60, 0x44, 0x99, 0xDA, 0xB9, 0xD7, 0x8E, 0x65, 0xE0, 0x9A, 0x18, 0xC4, 0x7D, 0xA5, 0x42,
+    0x8C, 0xC8, 0x18, 0x18, 0xAD, 0x13, 0xCA, 0x60, 0x8B, 0x22, 0xBC, 0x17, 0xBC, 0xA2, 0x60, 0xE7,
+    0xCE, 0x64, 0x4A, 0xC6, 0x00, 0xE1, 0x89, 0x4C, 0xE2, 0xAA, 0x42, 0x5E, 0xC1, 0x78, 0x41, 0x33,
+    0x49, 0x43, 0x70, 0x6B, 0xF1, 0x45, 0x62, 0xC3, 0x5E, 0x57, 0xD0, 0x1A, 0x65, 0x1F, 0xD6, 0x2E,
+    0x8C, 0x47, 0x0A, 0xDB, 0x1A, 0xCD, 0xF2, 0x4F, 0x74, 0x9D, 0xA8, 0xC7, 0x3E, 0x34, 0x1A, 0x27,
+    0xCB, 0x9B, 0xE7, 0x63, 0x64, 0x97, 0x20, 0x3F, 0x02, 0xEE, 0x86, 0x37, 0x4B, 0xA0, 0x07, 0xE8,
+    0xB8, 0x28, 0x49, 0x95, 0x83, 0x36, 0xE1, 0x8B, 0x81, 0x83, 0x4A, 0x57, 0x99, 0xA4, 0xB1, 0xF6,
+    0xE3, 0x8B, 0x34, 0x92, 0x88, 0xDB, 0x8F, 0xA3, 0xA4, 0x92, 0x03, 0xA9, 0x84, 0xE6, 0x56, 0x14,
+    0xBF, 0xB5, 0x8F, 0x2D, 0x6E, 0xFD, 0xDB, 0x7C, 0xCF, 0xA7, 0x48, 0xE4, 0x7E, 0x9B, 0x37, 0x35,
+    0x69, 0x3E, 0x55, 0x1A, 0x33, 0xE1, 0x83, 0xD1, 0x6E, 0x81, 0x92, 0xF4, 0xE1, 0x54, 0x7C, 0x82,
+    0xE2, 0x85, 0xC9, 0x66, 0x30, 0x29, 0x69, 0x8E, 0x56, 0x03, 0x6C, 0xC2, 0x1A, 0x4F, 0xA4, 0xBA,
+    0x89, 0x75, 0xF8, 0x48, 0x5C, 0x58, 0x92, 0xB6, 0xD5, 0x19, 0xF6, 0x9F, 0x26, 0xEA, 0x86, 0xF6,
+    0xAA, 0x11, 0x2E, 0xBD, 0xDB, 0xEE, 0x8F, 0x6E, 0x54, 0xD3, 0x06, 0x59, 0x79, 0x3F, 0xA4, 0xC4,
+    0x18, 0x31, 0x9C, 0x50, 0x45, 0xBB, 0xCD, 0x0E, 0x87, 0x9E, 0xA7, 0x81, 0xCE, 0x4A, 0x44, 0x55,
+    0x33, 0x79, 0xD6, 0x70, 0x4F, 0xC2, 0x6F, 0xC1, 0x86, 0xD0, 0x53, 0xBF, 0x26, 0xF5, 0xE9, 0x7E,
+    0x0D, 0x53, 0x40, 0x86, 0x26, 0x75, 0xC8, 0x64, 0xD3, 0x90, 0x68, 0x97, 0xE5, 0xD0, 0x69, 0x44,
+    0x6B, 0x1A, 0x61, 0x0C, 0x11, 0x57, 0x97, 0x8C, 0xF5, 0x1F, 0x92, 0xE6, 0xFE, 0x06, 0xC0, 0x8D,
+    0x23, 0x5E, 0xB4, 0x49, 0xB9, 0xF7, 0x4F, 0x97, 0xEA, 0x62, 0xBA, 0x6F, 0x1D, 0x9C, 0x6C, 0x4F,
+    0x01, 0x9D, 0x55, 0x4F, 0x68, 0x1C, 0x55, 0x18, 0xFF, 0xCD, 0x7B, 0x69, 0x27, 0xD9, 0xC9, 0xEE,
+    0xE4, 0x10, 0x10, 0x25, 0xC9, 0xF6, 0xD0, 0x43, 0x0E, 0xE9, 0x4E, 0x0F, 0x7B, 0x98, 0xEA, 0xCE,
+    0xCE, 0xA4, 0x20, 0x39, 0x88, 0xE0, 0xA1, 0x17, 0x6F, 0x05, 0x3D, 0xF4, 0xB8, 0x42, 0x0E, 0x2B,
+    0xAE, 0xD9, 0xD7, 0x04, 0x0C, 0x28, 0x98, 0x1C, 0x44, 0x41, 0x2A, 0xE6, 0x28, 0x15, 0xCC, 0x82,
+    0x39, 0x6C, 0x61, 0x9A, 0x7D, 0xB5, 0x87, 0x20, 0x78, 0x18, 0xDB, 0x9B, 0x78, 0x98, 0xD6, 0x42,
+    0x41, 0x0F, 0x4E, 0xEA, 0x82, 0xDB, 0x32, 0xBB, 0xCF, 0xEF, 0xCD, 0x6E, 0x36, 0xA1, 0x48, 0xAD,
+    0xFD, 0xDE, 0x37, 0xEF, 0xCD, 0x30, 0xF3, 0xFD, 0xFF, 0x7D, 0xDF, 0xB0, 0x1E, 0xBA, 0xB5, 0x45,
+    0xB6, 0xF1, 0x65, 0xDA, 0xFC, 0x7D, 0x13, 0x70, 0xC1, 0xBB, 0xB3, 0x45, 0x25, 0x9D, 0x07, 0xB8,
+    0x8C, 0x49, 0x30, 0x01, 0x2B, 0x40, 0x46, 0xDB, 0x3B, 0xAC, 0x8D, 0x02, 0x46, 0x64, 0xAA, 0xB4,
+    0x39, 0x58, 0x09, 0xB0, 0xA7, 0xDF, 0xD3, 0xA6, 0x64, 0x27, 0xB5, 0x46, 0x8F, 0x4A, 0x6D, 0xA9,
+    0x54, 0x29, 0x39, 0x75, 0x1A, 0xAF, 0x0A, 0x24, 0x38, 0x26, 0x47, 0xD8, 0x2B, 0x4C, 0x2C, 0x5E,
+    0xD8, 0x3D, 0x18, 0x7C, 0x53, 0x03, 0x17, 0xF0, 0x97, 0x85, 0x4A, 0xD9, 0x60, 0x68, 0xC2, 0x05,
+    0x0A, 0x31, 0x18, 0xD9, 0xD4, 0xF4, 0x76, 0xC0, 0x94, 0xC2, 0x7E, 0x30, 0x63, 0x0B, 0x30, 0x52,
+    0x52, 0x02, 0x78, 0x0C, 0x54, 0xF5, 0x61, 0x0D, 0x4A, 0x78, 0xE9, 0x51, 0x02, 0xB7, 0x18, 0x99,
+    0x52, 0xA9, 0x94, 0x93, 0x35, 0x4B, 0x6D, 0x63, 0x1B, 0x0D, 0xBC, 0x27, 0x67, 0x26, 0x00, 0xA3,
+    0x77, 0xA8, 0xD2, 0xB8, 0x59, 0xB3, 0xAF, 0xB1, 0x87, 0xB8, 0x21, 0xAB, 0xD5, 0xCE, 0xA6, 0x8A,
+    0xD7, 0x56, 0xE1, 0xCD, 0x3A, 0xB6, 0x5A, 0x57, 0x99, 0x89, 0x09, 0x98, 0x90, 0xA8, 0xB6, 0x81,
+    0xFD, 0xB1, 0x87, 0xA7, 0x3E, 0x83, 0xA3, 0x12, 0xEB, 0x81, 0x81, 0x1E, 0xB9, 0x0B, 0xB0, 0x23,
+    0x93, 0xFA, 0xE8, 0xDC, 0x8F, 0x8D, 0xA6, 0x03, 0x7E, 0xB5, 0x8F, 0x86, 0x4D, 0x26, 0x7D, 0x95,
+    0xA2, 0xF3, 0x18, 0xF3, 0x9C, 0x2F, 0xCB, 0x8E, 0x3C, 0x3D, 0x8C, 0x62, 0xAD, 0xD2, 0x54, 0x6E,
+    0xF1, 0x57, 0xAE, 0xCD, 0x96, 0x6A, 0xF6, 0xD6, 0xEE, 0x3D, 0xD5, 0x2B, 0x7E, 0x05, 0xFB, 0x75,
+    0xEB, 0xB6, 0x8A, 0x3B, 0xB1, 0xFE, 0x44, 0x47, 0x58, 0xA1, 0x1C, 0xCA, 0xB1, 0xD9, 0x17, 0x09,
+    0x36, 0xA1, 0x60, 0x5F, 0xC9, 0xA4, 0x9F, 0x23, 0xD8, 0x17, 0x89, 0xEB, 0x88, 0x66, 0xC9, 0xD5,
+    0x08, 0x64, 0x0D, 0x16, 0xA9, 0xEA, 0x02, 0x29, 0xC9, 0xD8, 0x81, 0x29, 0xD9, 0xCE, 0xF3, 0xC5,
+    0x8B, 0x2C, 0xDC, 0xEF, 0xC0, 0x2E, 0x6A, 0x57, 0x66, 0x30, 0x5B, 0x47, 0xA5, 0x3D, 0x62, 0x6F,
+    0xC8, 0x21, 0xBC, 0x8E, 0xEA, 0x67, 0x3C, 0x48, 0xB1, 0x46, 0x16, 0xB2, 0x7D, 0x0D, 0x01, 0x98,
+    0x44, 0xAE, 0x86, 0xB3, 0x93, 0x30, 0xA4, 0xBE, 0x1F, 0x33, 0xFF, 0x58, 0x70, 0x95, 0xF0, 0xB8,
+    0xCE, 0xA5, 0xCB, 0xE5, 0x12, 0x17, 0x9A, 0x4D, 0x59, 0x19, 0xF2, 0x14, 0x4E, 0x1B, 0x31, 0x92,
+    0x12, 0x6C, 0x36, 0x3C, 0xDE, 0xA0, 0xD4, 0x35, 0xAF, 0xEF, 0xAE, 0x27, 0xE8, 0x3A, 0x4A, 0x5D,
+    0x54, 0x4A, 0x1F, 0x1B, 0x89, 0xD1, 0xF3, 0x61, 0x0F, 0x8F, 0xA2, 0x18, 0x5A, 0xF0, 0xFB, 0x99,
+    0xFA, 0xFF, 0xB2, 0xB0, 0x84, 0x9F, 0x3E, 0x2F, 0x4E, 0x64, 0xD1, 0x5D, 0x62, 0x89, 0x29, 0x8B,
+    0x68, 0x18, 0x27, 0x8F, 0x90, 0x25, 0x56, 0x34, 0x3F, 0xF1, 0xE3, 0x3B, 0xB6, 0xFE, 0xE8, 0x14,
+    0xCA, 0x88, 0x78, 0x90, 0xA7, 0x23, 0xE6, 0xA2, 0xA0, 0xB3, 0x49, 0x5D, 0x73, 0xEB, 0xAD, 0xA3,
+    0x14, 0x3B, 0x04, 0x07, 0x43, 0x97, 0xB4, 0xF8, 0xD4, 0x4D, 0x48, 0xAF, 0x2C, 0x4A, 0x7F, 0xB3,
+    0x7F, 0x49, 0x97, 0x1A, 0x3C, 0x18, 0x2F, 0xA1, 0x17, 0xA1, 0xC8, 0x1B, 0x53, 0xB5, 0x5A, 0xF5,
+    0xCF, 0x5C, 0xF6, 0x90, 0x33, 0x6F, 0x25, 0xFA, 0xE3, 0xA8, 0x9C, 0xE7, 0x41, 0xE4, 0x16, 0xF8,
+    0xD5, 0x64, 0xFB, 0x3C, 0x55, 0xEF, 0xDD, 0x76, 0xAA, 0x2B, 0x10, 0x36, 0xC6, 0x14, 0x86, 0x37,
+    0x71, 0xF7, 0xCD, 0xF2, 0xDD, 0x4F, 0x2F, 0x90, 0x00, 0x4B, 0xF8, 0x81, 0xB4, 0x29, 0x82, 0x86,
+    0x71, 0x98, 0x98, 0x07, 0xB2, 0x78, 0x7C, 0x5B, 0x2A, 0xA2, 0x1D, 0xB2, 0xFB, 0x89, 0xF5, 0x49,
+    0xE4, 0xC1, 0xE8, 0x42, 0x49, 0x3E, 0x80, 0x1D, 0x61, 0x11, 0xE4, 0x28, 0x49, 0xE9, 0x3E, 0xBF,
+    0x92, 0x35, 0x15, 0x79, 0x88, 0x56, 0x84, 0xA5, 0x32, 0xEC, 0x3C, 0xF8, 0x46, 0x80, 0x38, 0x86,
+    0xEB, 0xA2, 0x50, 0x00, 0x5F, 0x91, 0xA0, 0x48, 0xCA, 0xC0, 0x39, 0xA0, 0x43, 0x3C, 0xEC, 0x18,
+    0x2E, 0xF3, 0x3B, 0x67, 0x16, 0x09, 0x58, 0x7A, 0x25, 0xC7, 0xCB, 0x18, 0x2D, 0x16, 0x9B, 0x71,
+    0x47, 0x2A, 0x71, 0x03, 0xA8, 0x11, 0xF2, 0xCE, 0xEF, 0x50, 0x83, 0xCF, 0x60, 0x8E, 0xBA, 0x97,
+    0xEA, 0x55, 0xC3, 0x12, 0x2C, 0x5D, 0xAF, 0x16, 0xB9, 0x52, 0x20, 0x84, 0xFA, 0x32, 0x17, 0xE0,
+    0x9C, 0x25, 0xF7, 0x3C, 0xFE, 0x43, 0x4C, 0xB1, 0x54, 0x7A, 0xF8, 0x5B, 0xF2, 0x3E, 0xEC, 0x04,
+    0x4D, 0x69, 0x28, 0x69, 0xFE, 0x29, 0x1C, 0x5F, 0xB4, 0xFD, 0xF5, 0xB8, 0xB3, 0x25, 0x54, 0x90,
+    0xF5, 0x40, 0x31, 0xA0, 0x7C, 0x53, 0xDF, 0xE5, 0x82, 0xCC, 0x1D, 0x42, 0x2B, 0x6D, 0x34, 0x0A,
+    0x3F, 0x0A, 0xDC, 0x84, 0x87, 0xF0, 0x03, 0xDE, 0xC5, 0x07, 0x91, 0xF9, 0x75, 0x50, 0xBF, 0x69,
+    0xAE, 0xF7, 0x86, 0x3D, 0x17, 0x50, 0x65, 0x2C, 0x49, 0xED, 0x64, 0x07, 0x98, 0x2E, 0xCF, 0xB5,
+    0xE6, 0xA5, 0x23, 0x1C, 0x38, 0xC1, 0x6B, 0x91, 0xDB, 0x75, 0x3F, 0x9C, 0x46, 0x4E, 0xE7, 0x21,
+    0xC8, 0x2A, 0xCF, 0x75, 0x1D, 0xEB, 0x58, 0x80, 0x29, 0x08, 0x93, 0x75, 0xEA, 0x6E, 0x4B, 0x10,
+    0x2A, 0xF7, 0xE0, 0x5C, 0x57, 0x9A, 0x0C, 0x43, 0x46, 0x35, 0xAD, 0x32, 0x76, 0xF3, 0xE6, 0x72,
+    0x54, 0x9B, 0xB3, 0x98, 0x6C, 0x2D, 0x59, 0x8F, 0xFA, 0x80, 0xAD, 0x85, 0xE3, 0x63, 0xE1, 0xF6,
+    0x50, 0x38, 0xC2, 0xFE, 0xB7, 0x5A, 0x32, 0x1D, 0xA1, 0x87, 0x30, 0x2C, 0x78, 0x44, 0x56, 0x66,
+    0x0B, 0x5C, 0x44, 0xAB, 0xF3, 0xA6, 0xA1, 0x15, 0x30, 0xD9, 0x71, 0x28, 0xDF, 0xBE, 0xBD, 0xF1,
+    0x73, 0xA2, 0x6B, 0x63, 0x6B, 0x44, 0x91, 0x32, 0x6B, 0x81, 0x6D, 0x8A, 0x7B, 0xF1, 0xD9, 0xA7,
+    0x95, 0x2D, 0x96, 0xE3, 0xDB, 0x9B, 0xF9, 0xC9, 0x55, 0x23, 0x32, 0x29, 0xBD, 0x2D, 0x26, 0x2D,
+    0x4A, 0x6E, 0x87, 0xF5, 0x29, 0x1F, 0x76, 0x66, 0xBE, 0x52, 0xB7, 0x17, 0xD8, 0x17, 0xDA, 0xF7,
+    0x4C, 0x34, 0x60, 0x4F, 0x76, 0xB5, 0x60, 0x32, 0xAB, 0x31, 0x9D, 0xC7, 0xEA, 0xFB, 0x77, 0x1E,
+    0xE6, 0xAE, 0x9D, 0x14, 0x24, 0x9A, 0xA2, 0x6B, 0x0E, 0x59, 0xD5, 0xA9, 0x46, 0x38, 0x24, 0x87,
+    0xFE, 0x12, 0x30, 0xFE, 0xA0, 0x78, 0xE9, 0xBD, 0x41, 0x11, 0x10, 0x9A, 0x40, 0x6E, 0x65, 0x33,
+    0xC9, 0xA4, 0xCB, 0xA6, 0x4B, 0xFB, 0x5D, 0x7D, 0xB2, 0x8B, 0xEF, 0x29, 0x3B, 0xBF, 0x29, 0x45,
+    0xE5, 0xC8, 0x7E, 0x44, 0xF6, 0x70, 0x94, 0x50, 0xF9, 0xB3, 0xC4, 0xEA, 0x5F, 0x46, 0xAC, 0xF3,
+    0x3C, 0x0F, 0xAC, 0xC2, 0xF8, 0x45, 0x37, 0x4A, 0x88, 0x52, 0xCB, 0x5C, 0x97, 0x04, 0x0A, 0x38,
+    0x52, 0x43, 0x8C, 0x83, 0x6A, 0x81, 0x7C, 0x06, 0xCD, 0x6C, 0xEC, 0x97, 0xB0, 0xE0, 0x13, 0x8B,
+    0x92, 0x2F, 0x4B, 0x7E, 0x5C, 0xF2, 0x12, 0xAF, 0xD2, 0xF5, 0x1A, 0x0D, 0xAF, 0xE1, 0x79, 0x8D,
+    0xA2, 0x17, 0xDA, 0x61, 0x68, 0xA6, 0x21, 0x4F, 0x53, 0xF2, 0x6D, 0x5A, 0xCF, 0xEA, 0x32, 0x35,
+    0xD2, 0x90, 0x66, 0xB8, 0x8A, 0xAA, 0x16, 0x97, 0xE5, 0x0A, 0xDF, 0x90, 0x6E, 0x85, 0x60, 0x5F,
+    0x69, 0xD0, 0xA6, 0x7B, 0xF9, 0xE5, 0x93, 0x4A, 0xA3, 0x67, 0x2A, 0x25, 0x0A, 0xF5, 0x10, 0xD5,
+    0xA3, 0x34, 0x81, 0xB1, 0xF3, 0x4C, 0xBD, 0x8E, 0xC6, 0xA7, 0xA7, 0xF1, 0x78, 0x85, 0xDC, 0x08,
+    0x70, 0x47, 0xE8, 0xB9, 0x3D, 0x39, 0x72, 0xE8, 0xFF, 0x59, 0xFD, 0x37, 0xFA, 0x07, 0x95, 0x55,
+    0x41, 0x68, 0x1C, 0x55, 0x18, 0xFE, 0xDE, 0x3C, 0x9B, 0xD7, 0xE6, 0xB5, 0x19, 0x0F, 0xAD, 0x60,
+    0x9B, 0xEE, 0x78, 0x50, 0x88, 0x90, 0xEE, 0x14, 0x49, 0x21, 0xE2, 0x6E, 0xE6, 0xB5, 0x1E, 0x7A,
+    0xE8, 0xA1, 0xB9, 0x78, 0x52, 0xD4, 0xA3, 0x9E, 0x9A, 0x43, 0xC4, 0x14, 0x36, 0xDD, 0x97, 0x96,
+    0x82, 0x10, 0xB4, 0x39, 0x28, 0x9E, 0x84, 0x9C, 0x0D, 0x92, 0x1E, 0x0A, 0xF6, 0xB0, 0xCD, 0x3C,
+    0xD3, 0x43, 0x8E, 0x0E, 0x16, 0x29, 0x78, 0x71, 0x31, 0x15, 0x21, 0x45, 0x18, 0x61, 0xC0, 0x49,
+    0x98, 0xDD, 0xDF, 0x7F, 0x26, 0xDD, 0xB4, 0x6A, 0xA9, 0xE6, 0xBD, 0xC7, 0xEC, 0xBC, 0x9D, 0x37,
+    0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0x1C, 0xF0, 0xF0, 0x6A, 0x82, 0x5B, 0x10, 0xD8, 0x1D,
+    0xCF, 0x4B, 0x4A, 0xA6, 0xB4, 0x74, 0x13, 0x0D, 0x79, 0xCD, 0x4D, 0x36, 0xE4, 0x86, 0x6B, 0xB4,
+    0xF8, 0xD2, 0xE2, 0x47, 0xCA, 0x28, 0xAB, 0xDC, 0xE0, 0x20, 0x30, 0x3D, 0x42, 0x6F, 0x26, 0x69,
+    0x7A, 0x72, 0x4E, 0xBD, 0x2B, 0x7E, 0xB3, 0x97, 0xBB, 0xB5, 0xDB, 0x6A, 0x55, 0xA4, 0xFC, 0xE0,
+    0x45, 0xD4, 0x22, 0x5E, 0xB6, 0x1E, 0xB9, 0x7A, 0x94, 0xD4, 0x9B, 0x69, 0xB3, 0x91, 0x35, 0x5B,
+    0xAD, 0x66, 0xAB, 0xD9, 0x6C, 0x05, 0xCD, 0x8E, 0xDF, 0xE9, 0xA8, 0xA2, 0x23, 0x8B, 0xC2, 0x2B,
+    0x20, 0x73, 0x44, 0x5D, 0x1C, 0x7D, 0x06, 0xAE, 0x72, 0xB2, 0x40, 0xDB, 0xEC, 0x42, 0xC6, 0x05,
+    0x8E, 0x55, 0x37, 0x22, 0x5E, 0xF2, 0x76, 0xD6, 0xBC, 0x4C, 0xA5, 0x19, 0xE6, 0x5B, 0xF0, 0xBF,
+    0x81, 0x20, 0x83, 0xC8, 0xC1, 0xCF, 0x20, 0x7F, 0x87, 0x78, 0x98, 0x20, 0xA7, 0x95, 0x22, 0x24,
+    0xF2, 0x88, 0x70, 0xA2, 0x5F, 0xBE, 0x73, 0x9C, 0xCE, 0x7E, 0x31, 0x3D, 0x70, 0xFE, 0x92, 0x0D,
+    0x56, 0xA5, 0x9D, 0x9C, 0xF0, 0x36, 0x30, 0x3A, 0x2B, 0xEE, 0xDA, 0xF1, 0xA9, 0xD5, 0x05, 0x4A,
+    0x87, 0xF2, 0x32, 0x04, 0x78, 0x7F, 0xB4, 0xB2, 0xD8, 0x1B, 0x1C, 0x3E, 0xB1, 0x8D, 0x70, 0xA5,
+    0x1B, 0x9A, 0xB6, 0x6F, 0xD4, 0x7D, 0x87, 0x9D, 0x04, 0x01, 0xC3, 0x14, 0x00, 0x63, 0x4E, 0x25,
+    0xA8, 0xDD, 0x81, 0x7F, 0x63, 0x27, 0x5E, 0x27, 0x4A, 0x43, 0x4A, 0x45, 0xDC, 0xDD, 0x7D, 0x4B,
+    0xB8, 0xD3, 0xFE, 0x2A, 0x42, 0xBB, 0x17, 0x30, 0x0C, 0xE5, 0x62, 0x27, 0x9D, 0x94, 0xD7, 0xCC,
+    0xF8, 0x8C, 0xD8, 0x30, 0xA3, 0x93, 0xDE, 0xDD, 0xAD, 0x3C, 0x20, 0xF6, 0x05, 0xD3, 0xC2, 0x9C,
+    0xC2, 0x4D, 0x6D, 0x1A, 0x4F, 0x40, 0xEA, 0xAD, 0xBC, 0x24, 0xD8, 0x44, 0x70, 0xDE, 0x21, 0xBF,
+    0x05, 0xF5, 0xBD, 0x41, 0x23, 0x85, 0x2C, 0x7F, 0x78, 0xB7, 0xC8, 0x14, 0xA3, 0xAD, 0x92, 0x5F,
+    0xAA, 0xA9, 0x78, 0xC4, 0xB1, 0x1A, 0xA9, 0x5C, 0x48, 0x95, 0x35, 0x8F, 0x33, 0x55, 0x22, 0x43,
+    0x3D, 0x74, 0x4C, 0x18, 0x89, 0xC6, 0x8C, 0x70, 0x27, 0x31, 0x23, 0xED, 0x38, 0x76, 0xD6, 0xC0,
+    0xF8, 0x62, 0xAD, 0x0C, 0xE8, 0x4F, 0xEC, 0xFD, 0x0A, 0xD1, 0x7A, 0x26, 0x53, 0x30, 0xCF, 0x04,
+    0x1D, 0xF8, 0xD6, 0x4B, 0x10, 0xF1, 0x0E, 0x94, 0x35, 0xA0, 0x28, 0xC9, 0x10, 0x38, 0xAF, 0x8B,
+    0x2B, 0xD0, 0x89, 0xC8, 0xE1, 0xEF, 0xC4, 0x09, 0x38, 0xC4, 0x25, 0x6D, 0xA2, 0xE4, 0x04, 0x5F,
+    0xAA, 0x3C, 0x89, 0x35, 0xC9, 0x44, 0xFF, 0x5C, 0x70, 0x5D, 0xDF, 0x8E, 0x4D, 0x78, 0x5B, 0xF1,
+    0x28, 0xDA, 0x5F, 0x9F, 0x37, 0xE3, 0x40, 0x57, 0x5B, 0x4C, 0xAD, 0xF4, 0x0E, 0x28, 0xFA, 0x99,
+    0xEC, 0x25, 0x1B, 0x2F, 0x95, 0xC7, 0x1D, 0x34, 0x30, 0xB1, 0xEB, 0xA7, 0x24, 0x3B, 0xB2, 0xE2,
+    0x4E, 0x2B, 0xE3, 0x46, 0x14, 0xE6, 0x6A, 0x6F, 0x27, 0xED, 0x9E, 0xA0, 0x5C, 0xBB, 0x2C, 0x14,
+    0x69, 0x47, 0xAE, 0xA7, 0xFE, 0x45, 0x77, 0x25, 0x12, 0x85, 0x67, 0x0E, 0xE3, 0x66, 0xC9, 0xEF,
+    0xDB, 0x75, 0xBA, 0x60, 0x9B, 0xCC, 0xD8, 0xF9, 0x68, 0x8A, 0x0C, 0x51, 0x8E, 0xAD, 0x8E, 0xC4,
+    0xEC, 0x61, 0x74, 0x67, 0xD4, 0xC2, 0xAF, 0x77, 0xD8, 0xE7, 0x80, 0x6C, 0xC7, 0x3F, 0x97, 0x06,
+    0xDA, 0x35, 0x42, 0x64, 0x85, 0xDA, 0x4C, 0x03, 0x37, 0x08, 0x8B, 0x76, 0x4C, 0x0F, 0x39, 0x64,
+    0x82, 0xE3, 0xBC, 0x6B, 0xE9, 0x9E, 0xB6, 0xBE, 0xF1, 0x51, 0x4D, 0x13, 0x98, 0xC1, 0xB9, 0x61,
+    0xBE, 0x0F, 0x50, 0x47, 0xB3, 0xDC, 0x4C, 0x4C, 0xE0, 0x0D, 0xB3, 0x4F, 0x87, 0x5F, 0x3A, 0x78,
+    0x72, 0x86, 0xB5, 0x63, 0x9E, 0x0A, 0x32, 0xCC, 0x66, 0x0C, 0x3C, 0xF6, 0x6A, 0x0F, 0x90, 0xB3,
+    0x19, 0x92, 0xF3, 0x97, 0xB8, 0xFC, 0x21, 0xB8, 0x9E, 0xE6, 0x01, 0xBF, 0x6F, 0x10, 0xF7, 0x50,
+    0x96, 0x17, 0x0B, 0x07, 0xED, 0x73, 0xD3, 0xED, 0x1F, 0x88, 0xFE, 0xA8, 0xA2, 0x5F, 0xC5, 0x11,
+    0xA7, 0x31, 0x8A, 0x91, 0x81, 0x92, 0xDB, 0xC9, 0x47, 0xD3, 0x63, 0xD0, 0x06, 0x7D, 0x68, 0x4E,
+    0x95, 0xFC, 0xF2, 0x1E, 0xA5, 0x71, 0x86, 0x31, 0x20, 0x34, 0x18, 0x7B, 0x79, 0x4F, 0x07, 0x39,
+    0x62, 0xC2, 0x94, 0x41, 0xC0, 0x02, 0xB7, 0xE0, 0x10, 0x22, 0xDA, 0x86, 0x47, 0x19, 0x86, 0xC8,
+    0x42, 0xA7, 0xAC, 0x82, 0x43, 0x67, 0xE9, 0x02, 0xD1, 0x06, 0x91, 0x8B, 0xFB, 0xBB, 0x0E, 0x1A,
+    0xCC, 0xE1, 0x63, 0xFB, 0x3E, 0x1B, 0x11, 0x74, 0xF6, 0x47, 0xB3, 0x8C, 0x53, 0xA5, 0x90, 0xC3,
+    0x2E, 0x1A, 0x23, 0xEF, 0x5D, 0xA4, 0x75, 0x4A, 0xD8, 0x49, 0x8F, 0x6B, 0x72, 0x1B, 0xE0, 0xC6,
+    0x51, 0x63, 0xCB, 0x09, 0x6B, 0xE5, 0x01, 0x34, 0x25, 0x55, 0x9D, 0x86, 0x0E, 0x2A, 0x7B, 0x45,
+    0xF5, 0xB8, 0x6C, 0x82, 0x52, 0xA1, 0xDB, 0xA5, 0xE8, 0xF0, 0x42, 0xD9, 0x53, 0xC0, 0xE5, 0xA5,
+    0x7A, 0xEA, 0x2D, 0xCF, 0x72, 0x53, 0xF2, 0xBB, 0x88, 0x2D, 0xD2, 0xD7, 0xE7, 0x23, 0xD2, 0x64,
+    0x0E, 0x96, 0x51, 0x3A, 0xB8, 0x9B, 0x03, 0x2C, 0x2F, 0x43, 0x73, 0x5C, 0x6E, 0x3E, 0x59, 0xE3,
+    0x64, 0x35, 0xA5, 0xF2, 0x01, 0xCA, 0x26, 0x34, 0x07, 0x70, 0x64, 0x25, 0x47, 0x26, 0xE4, 0xA2,
+    0x64, 0x96, 0x88, 0xF9, 0x9F, 0xE4, 0xF3, 0x20, 0x8B, 0xA9, 0x68, 0x53, 0xA1, 0xD9, 0x1D, 0x1E,
+    0xCF, 0x09, 0x6F, 0x11, 0x21, 0xBC, 0x67, 0xC5, 0x8C, 0xCA, 0xD1, 0x07, 0x4B, 0xF3, 0x1F, 0xAB,
+    0xF5, 0xF7, 0xC5, 0x39, 0x3A, 0x52, 0x95, 0x33, 0xEB, 0x05, 0x9E, 0x95, 0x56, 0xD9, 0xA8, 0xE0,
+    0xA6, 0xC9, 0x53, 0x97, 0xD3, 0xEA, 0x42, 0x17, 0x58, 0x62, 0x0A, 0xEC, 0x8D, 0xF1, 0xAE, 0x1A,
+    0xDC, 0x41, 0x99, 0x8F, 0x6A, 0xEC, 0x03, 0x44, 0x41, 0x7B, 0x8B, 0xF2, 0xFA, 0xD3, 0xAC, 0xFF,
+    0xDB, 0xCA, 0x70, 0x7F, 0xC9, 0xA7, 0xEE, 0x53, 0xAC, 0x94, 0xD0, 0x23, 0x9C, 0x72, 0x9F, 0x30,
+    0xEB, 0xC5, 0xCB, 0x54, 0x78, 0xE5, 0x67, 0xA0, 0x0E, 0x5D, 0x78, 0xDC, 0x11, 0x12, 0x2B, 0xCF,
+    0x58, 0xE9, 0x0F, 0x3E, 0x0A, 0x38, 0x5A, 0x60, 0x9E, 0x57, 0x07, 0xF3, 0xB7, 0xD1, 0xAA, 0x56,
+    0x63, 0x6F, 0xB5, 0xD0, 0xBA, 0x22, 0x8A, 0x88, 0xF2, 0x88, 0xB2, 0x32, 0xC3, 0x5C, 0xAA, 0x87,
+    0x86, 0x5E, 0x13, 0xE7, 0xAB, 0xC6, 0x37, 0x8A, 0xFB, 0x38, 0x93, 0xD4, 0x66, 0xD5, 0xA7, 0x62,
+    0xD3, 0xCE, 0xA5, 0xF5, 0x88, 0x16, 0xA9, 0xBB, 0x56, 0xB6, 0x39, 0x96, 0xE6, 0x81, 0x41, 0xBD,
+    0xEF, 0x5A, 0x2F, 0xFE, 0x9F, 0x75, 0x1C, 0xF3, 0xA9, 0x52, 0xF0, 0x8C, 0x7C, 0x07, 0xF7, 0xCD,
+    0xE5, 0xA4, 0x36, 0xA1, 0x3E, 0x13, 0x9B, 0xEE, 0x36, 0xF5, 0x43, 0xBA, 0x9A, 0xA7, 0x30, 0x46,
+    0x09, 0xE7, 0x71, 0xDA, 0x3F, 0x7C, 0x64, 0xFE, 0xE8, 0x3E, 0xFD, 0x9F, 0x1C, 0x1A, 0x96, 0x86,
+    0xEC, 0x50, 0xF5, 0xB2, 0xC2, 0x19, 0x77, 0x64, 0x56, 0x7D, 0x25, 0x36, 0xCD, 0x5C, 0xB7, 0xD6,
+    0xD0, 0x37, 0xE8, 0x17, 0xCA, 0xC3, 0x1B, 0xF8, 0x00, 0xB8, 0x5E, 0xAD, 0xD6, 0xE3, 0x12, 0xDC,
+    0x17, 0x0F, 0x6F, 0x09, 0x9F, 0x70, 0xC0, 0xF1, 0x2C, 0x14, 0x61, 0x87, 0xBC, 0x44, 0x9F, 0x5B,
+    0x1A, 0x7E, 0x8C, 0xE1, 0x3B, 0x75, 0x2F, 0x15, 0x19, 0x83, 0xD4, 0x11, 0x68, 0xAB, 0xD6, 0xBB,
+    0x48, 0xD9, 0x7E, 0x1D, 0xBE, 0xB6, 0xF2, 0xBB, 0x54, 0xA4, 0x0C, 0xE3, 0x53, 0x5F, 0x72, 0x33,
+    0x0E, 0xC9, 0xE0, 0x3F, 0xC6, 0x5F, 0x9D, 0x55, 0x4F, 0x68, 0x1C, 0x55, 0x18, 0xFF, 0xCD, 0x7B,
+    0x4D, 0x26, 0xDD, 0x49, 0x33, 0x39, 0xAC, 0x10, 0x6C, 0x36, 0x1B, 0xA4, 0x42, 0x2A, 0x9B, 0xDD,
+    0x4B, 0x0E, 0x8B, 0x9D, 0xCD, 0x8C, 0xED, 0x21, 0x85, 0x1E, 0x0C, 0xC5, 0x05, 0x0F, 0xD2, 0x16,
+    0xF1, 0xA0, 0x3D, 0x48, 0xD0, 0x1C, 0x22, 0x4E, 0xB3, 0xD3, 0xC6, 0x82, 0x22, 0xE8, 0x22, 0xD8,
+    0x8B, 0x97, 0x52, 0x72, 0x31, 0x17, 0x17, 0x89, 0xB0, 0xD4, 0x4D, 0x77, 0xD2, 0x20, 0xA2, 0x01,
+    0x3B, 0x3D, 0x88, 0x60, 0x0E, 0x0E, 0xAD, 0x50, 0x51, 0x84, 0xB1, 0x5D, 0x65, 0xA2, 0x93, 0xFD,
+    0xFC, 0xDE, 0x6C, 0x12, 0x0A, 0x16, 0x44, 0xDF, 0x7E, 0x6F, 0xDE, 0xCC, 0xE3, 0x7B, 0xEF, 0xFB,
+    0x7D, 0xFF, 0x7E, 0x2B, 0xBD, 0xDC, 0x18, 0x9A, 0x59, 0x6D, 0x16, 0xE9, 0x18, 0x45, 0xC0, 0x92,
+    0xD3, 0x42, 0x96, 0x43, 0x5A, 0x38, 0xA4, 0x85, 0xA6, 0x08, 0x4D, 0x0A, 0x0D, 0x0A, 0x45, 0x1C,
+    0xB1, 0x42, 0x82, 0x0B, 0x3D, 0x69, 0xC2, 0x4D, 0xC5, 0xDA, 0x17, 0x17, 0xEE, 0xA2, 0x96, 0xD8,
+    0x14, 0xDB, 0x14, 0x19, 0x14, 0xA0, 0x1F, 0x38, 0x04, 0xE8, 0x3E, 0x9F, 0x9A, 0x93, 0x2F, 0xE0,
+    0x3B, 0xE7, 0x8D, 0x60, 0x6C, 0x4A, 0x7F, 0x4F, 0xBB, 0xEB, 0x37, 0xA9, 0x5B, 0xA2, 0x4B, 0xDB,
+    0x11, 0xEA, 0x38, 0x87, 0x09, 0x88, 0x40, 0x99, 0xF6, 0x78, 0x96, 0x78, 0x66, 0x0A, 0xFC, 0x70,
+    0x86, 0x53, 0x38, 0x86, 0x03, 0x4C, 0x36, 0x01, 0xF9, 0x25, 0xDF, 0xE2, 0x5A, 0xBC, 0xB1, 0x14,
+    0xE4, 0xD1, 0x29, 0xCA, 0x8E, 0xA9, 0x45, 0xB5, 0xF5, 0xC8, 0x34, 0x77, 0x8A, 0xF8, 0xFD, 0x8F,
+    0x07, 0x81, 0xD9, 0xCE, 0xBB, 0x68, 0x87, 0xE4, 0xEB, 0x89, 0x11, 0xC3, 0xF6, 0x6C, 0x47, 0x76,
+    0x24, 0xE3, 0x1D, 0xE0, 0x23, 0x1E, 0x32, 0x13, 0xE8, 0xD3, 0x9C, 0x9E, 0x87, 0xBA, 0x87, 0x85,
+    0x08, 0x93, 0xD6, 0x80, 0x69, 0x9C, 0xDA, 0x58, 0xBF, 0xB7, 0x1D, 0xDA, 0xD4, 0x31, 0xFE, 0x4A,
+    0xB4, 0xA4, 0x8D, 0x8A, 0xE9, 0x81, 0xED, 0x2E, 0x40, 0xFB, 0x1E, 0x62, 0x4F, 0x7F, 0x15, 0x15,
+    0x0B, 0x6E, 0x11, 0xCA, 0xA2, 0xB1, 0x11, 0xC8, 0x2D, 0x5F, 0x90, 0x03, 0x02, 0xD6, 0x80, 0x56,
+    0x2A, 0x89, 0x12, 0x2D, 0x51, 0xCA, 0x26, 0x44, 0x8C, 0xAB, 0x57, 0x7B, 0x27, 0x21, 0x9D, 0x9C,
+    0x25, 0xD6, 0x43, 0xCB, 0x94, 0xDE, 0xC2, 0xAA, 0xBC, 0x85, 0x7C, 0x84, 0x2E, 0xF4, 0x10, 0x17,
+    0x38, 0x28, 0x5A, 0x2C, 0x89, 0x71, 0xB2, 0x96, 0x38, 0xEE, 0xE9, 0x1B, 0x01, 0x5F, 0x8D, 0xBD,
+    0xF1, 0x1F, 0x4C, 0xF6, 0x2B, 0x2B, 0xD0, 0x38, 0x3A, 0xC3, 0x7B, 0xA7, 0x89, 0x3A, 0x36, 0x25,
+    0x5A, 0xB5, 0x06, 0xD8, 0x8E, 0x32, 0xB1, 0x2B, 0xFE, 0x43, 0xF2, 0xE7, 0xCA, 0xFB, 0x44, 0x0F,
+    0x88, 0x76, 0x38, 0xFA, 0x12, 0x68, 0xE0, 0x40, 0xEF, 0xAC, 0x49, 0xFE, 0x4A, 0xC2, 0x5E, 0xC8,
+    0x00, 0x31, 0xA6, 0x61, 0xFA, 0x22, 0x82, 0x4D, 0x3A, 0xC5, 0xE0, 0xA4, 0x98, 0x0E, 0x44, 0x7D,
+    0xCF, 0x35, 0xA2, 0x80, 0x28, 0xEA, 0xAB, 0x32, 0x86, 0x1D, 0xB0, 0x5B, 0xBB, 0x42, 0x0F, 0xCB,
+    0xCF, 0x2B, 0x36, 0xD1, 0x2D, 0xC6, 0x83, 0x88, 0xEF, 0xC4, 0x6E, 0x58, 0x28, 0xC9, 0x7C, 0xE2,
+    0xF3, 0x4E, 0x05, 0xA6, 0x27, 0x43, 0xF6, 0xA3, 0xC4, 0xB7, 0x45, 0x35, 0xF2, 0x34, 0x38, 0x98,
+    0x0A, 0x94, 0x6D, 0xAE, 0x8A, 0xFF, 0xE3, 0xCC, 0x80, 0xC0, 0xD3, 0xEA, 0x66, 0xFC, 0x9B, 0x33,
+    0xD8, 0x29, 0x48, 0x6F, 0x4A, 0x3A, 0x65, 0xE9, 0x95, 0x75, 0x6F, 0x21, 0x95, 0x2C, 0x22, 0x11,
+    0x4C, 0x6C, 0x0E, 0x4B, 0xC7, 0x96, 0x27, 0x80, 0xF9, 0xC9, 0x0F, 0x6E, 0xAA, 0x8C, 0xD8, 0xDD,
+    0xC7, 0x7A, 0x38, 0xD2, 0xF4, 0x08, 0xEF, 0xF5, 0x5F, 0x66, 0xF8, 0xFC, 0x48, 0x65, 0x7A, 0x24,
+    0x63, 0xCE, 0x6C, 0xDC, 0x89, 0x46, 0xF4, 0x41, 0x4C, 0x5C, 0xBE, 0xEC, 0xA2, 0x2E, 0x9C, 0x48,
+    0xBF, 0x18, 0x72, 0x79, 0x21, 0xF0, 0x13, 0x04, 0x59, 0xD4, 0xA5, 0x37, 0x86, 0x82, 0x16, 0x66,
+    0xCD, 0xA5, 0xC8, 0x35, 0x9D, 0xFC, 0xCC, 0x7A, 0x14, 0x1F, 0xC5, 0xB4, 0x79, 0x29, 0x72, 0x33,
+    0x0E, 0x8E, 0x6D, 0x40, 0x9C, 0x5A, 0xC6, 0x8D, 0xE5, 0x6A, 0x28, 0xBD, 0x0C, 0x96, 0x8E, 0x8C,
+    0x8C, 0x23, 0x7B, 0xE3, 0x46, 0x16, 0xC8, 0xBE, 0xCC, 0xB3, 0xD6, 0x7D, 0xD8, 0x8A, 0xB2, 0xD0,
+    0xA7, 0xDF, 0x8E, 0x5A, 0xD3, 0x7C, 0xD2, 0x79, 0x7E, 0x60, 0x35, 0x3B, 0x5E, 0xAF, 0xE0, 0xCD,
+    0xCF, 0x67, 0xDB, 0x5F, 0x0D, 0xCE, 0x7A, 0xE3, 0x47, 0x8E, 0x39, 0x0B, 0x0A, 0x5E, 0x4E, 0xFB,
+    0x75, 0xE4, 0xE0, 0x2E, 0x72, 0x8D, 0x54, 0xE3, 0x69, 0x0A, 0x77, 0x6F, 0xE7, 0xFC, 0xC7, 0xED,
+    0xEE, 0xE9, 0xFA, 0xEC, 0x3B, 0x83, 0x6D, 0x1F, 0xE7, 0xAF, 0x96, 0x87, 0xE8, 0x95, 0x93, 0x27,
+    0xDF, 0x62, 0xB4, 0xFD, 0x8E, 0xFF, 0x76, 0x4F, 0xA3, 0xFE, 0x85, 0xBA, 0x64, 0x10, 0x19, 0x55,
+    0x53, 0xE8, 0x17, 0x4B, 0xB7, 0xA3, 0xB8, 0x95, 0x5A, 0xE8, 0xE1, 0x01, 0x6A, 0x1C, 0x8D, 0xB9,
+    0xD7, 0xD6, 0x37, 0x8D, 0x42, 0x61, 0x76, 0xB8, 0x5A, 0x8A, 0x2C, 0x53, 0xF5, 0xEA, 0x80, 0x36,
+    0xF3, 0xE2, 0x56, 0xE1, 0xC2, 0x41, 0xF8, 0x03, 0x4A, 0xA9, 0xAC, 0x9A, 0x2C, 0xF3, 0xD3, 0xF0,
+    0x9D, 0xB0, 0x39, 0x66, 0x69, 0x6D, 0xDF, 0xE0, 0x3D, 0x4E, 0x4A, 0x9F, 0x6A, 0xC5, 0x27, 0xBE,
+    0xD6, 0xCB, 0xE5, 0x6B, 0x4E, 0x4B, 0x31, 0x49, 0xBF, 0x35, 0xFF, 0xA9, 0xB3, 0x96, 0xA6, 0xEA,
+    0xA0, 0xB8, 0xE9, 0x60, 0xDC, 0xE3, 0x02, 0xC0, 0x71, 0x07, 0x47, 0xFA, 0x57, 0x96, 0xC1, 0x53,
+    0xF0, 0x2B, 0xEF, 0xEC, 0x36, 0x22, 0x72, 0x06, 0x11, 0x85, 0xEC, 0x53, 0xAF, 0x53, 0x0E, 0x28,
+    0xDE, 0x28, 0xA6, 0xAF, 0x25, 0xDA, 0xAC, 0x9E, 0xF6, 0xB9, 0x8C, 0x0B, 0x30, 0xE8, 0xFE, 0xB7,
+    0xCF, 0xA5, 0x2F, 0x2B, 0xD7, 0x28, 0x69, 0x13, 0x46, 0x06, 0x0C, 0x99, 0x2A, 0xB5, 0x69, 0xB2,
+    0x7A, 0x0A, 0x42, 0xA9, 0xED, 0xEB, 0x17, 0x57, 0xDE, 0xA5, 0xFB, 0xC4, 0x35, 0x9C, 0xCD, 0x13,
+    0x41, 0x47, 0xDA, 0x49, 0xAB, 0xCC, 0x39, 0x8C, 0x95, 0x3C, 0xB1, 0xED, 0xA2, 0x29, 0xBD, 0x02,
+    0x1A, 0x06, 0x46, 0x05, 0xFB, 0xD1, 0xC8, 0x7B, 0x93, 0x86, 0xE2, 0x88, 0x51, 0x0C, 0x29, 0xED,
+    0xBD, 0x51, 0xA3, 0x33, 0xD5, 0x19, 0x87, 0xE1, 0xAC, 0x32, 0x20, 0xC3, 0x13, 0x21, 0x9A, 0xEA,
+    0x45, 0x15, 0x9C, 0xD6, 0x76, 0x8C, 0x2B, 0xE1, 0x24, 0xE6, 0xCB, 0x28, 0xCC, 0x03, 0xD7, 0x57,
+    0x18, 0x07, 0x1B, 0x66, 0x05, 0x2C, 0x3E, 0xB3, 0xC6, 0xB5, 0x5D, 0xA2, 0x8E, 0x20, 0xD5, 0x56,
+    0x5A, 0x3B, 0x14, 0x0C, 0x65, 0x9B, 0x89, 0x0E, 0x18, 0xE3, 0x18, 0xB2, 0x9B, 0xF4, 0x23, 0x14,
+    0x93, 0x1E, 0xE6, 0xE0, 0x97, 0x7C, 0xE8, 0x9D, 0x27, 0xF5, 0x9D, 0x12, 0x11, 0x63, 0x15, 0xB4,
+    0x9D, 0x5A, 0x6E, 0xB9, 0xFB, 0xA3, 0xD5, 0x5A, 0xB3, 0xC6, 0xAC, 0xE2, 0xD1, 0xA7, 0x7A, 0x98,
+    0x44, 0xA4, 0x3D, 0xE2, 0x27, 0xD4, 0xAF, 0xC3, 0xFD, 0x1B, 0x98, 0x4E, 0x05, 0x91, 0xF4, 0x4D,
+    0x58, 0x6A, 0xC9, 0xC3, 0xD5, 0x22, 0xDD, 0x2F, 0x6A, 0x71, 0x7B, 0xA3, 0x6B, 0xD4, 0xD1, 0x57,
+    0xF5, 0xB8, 0x7F, 0x42, 0x26, 0xF0, 0x80, 0x67, 0xC8, 0x45, 0xB1, 0x37, 0x29, 0xE2, 0xB5, 0xC0,
+    0x73, 0x68, 0xB4, 0x37, 0x5F, 0x2D, 0x70, 0x4B, 0xC7, 0xA0, 0x70, 0x76, 0x8F, 0xF5, 0x32, 0x7C,
+    0x64, 0x02, 0x53, 0xEC, 0x66, 0x20, 0x7C, 0xF9, 0xE1, 0x59, 0xBE, 0x89, 0x76, 0xF8, 0x33, 0xC7,
+    0x9F, 0x25, 0xC7, 0x60, 0x1A, 0x2B, 0x1C, 0xEE, 0x80, 0x76, 0x02, 0xA9, 0x48, 0x84, 0x4C, 0x95,
+    0x55, 0xE6, 0x76, 0xC9, 0xB1, 0x57, 0xCB, 0x0F, 0x01, 0xB7, 0xA9, 0x23, 0xC3, 0x32, 0x5C, 0xE1,
+    0xEB, 0x7E, 0x61, 0x7F, 0x91, 0xBE, 0x1E, 0x58, 0xCA, 0x44, 0xA0, 0x82, 0x5F, 0xDE, 0xF5, 0x33,
+    0x68, 0x19, 0x27, 0x02, 0xAB, 0x88, 0xDF, 0x22, 0x79, 0xCB, 0x33, 0x5D, 0xD8, 0x01, 0x93, 0x8F,
+    0x9E, 0x20, 0x9F, 0x60, 0x31, 0x16, 0x0F, 0x62, 0x63, 0x29, 0x2E, 0x1A, 0x71, 0x6C, 0x76, 0xFA,
+    0x91, 0xFE, 0xD3, 0x2C, 0xEF, 0x26, 0xAD, 0x83, 0x97, 0x3A, 0x48, 0x56, 0x45, 0xD2, 0x94, 0x49,
+    0xD3, 0x48, 0x9A, 0xA6, 0xEB, 0x96, 0x2C, 0xB7, 0x52, 0x71, 0xDD, 0x8A, 0xDB, 0xA9, 0x2C, 0x46,
+    0xD3, 0x76, 0x30, 0x6D, 0xFB, 0x8B, 0xB6, 0xB3, 0xA8, 0xB1, 0xC5, 0x39, 0xA3, 0x8B, 0xC7, 0x7B,
+    0x95, 0xD8, 0x10, 0x1B, 0x5E, 0xB9, 0xA0, 0x3B, 0x61, 0xC3, 0x78, 0x16, 0x6E, 0x24, 0xBB, 0xC8,
+    0x07, 0x4C, 0x63, 0x86, 0xCF, 0x34, 0x53, 0x43, 0x2D, 0x60, 0x86, 0x3F, 0x87, 0x8F, 0x90, 0x6B,
+    0x68, 0x5B, 0xFF, 0x78, 0x5C, 0x5F, 0xD9, 0x62, 0xD2, 0x0D, 0xB9, 0x7C, 0xF8, 0xC1, 0x83, 0xEB,
+    0xD7, 0x54, 0x89, 0x85, 0xFC, 0x06, 0xB8, 0xEB, 0x63, 0x75, 0x1E, 0xDC, 0x53, 0x63, 0x32, 0x30,
+    0x9C, 0x05, 0x19, 0xE4, 0xB5, 0x94, 0x66, 0x13, 0x17, 0x79, 0x26, 0xC9, 0x50, 0x15, 0xFA, 0x56,
+    0xAF, 0xCC, 0x72, 0xD0, 0xE9, 0x62, 0x50, 0x98, 0x97, 0x67, 0x70, 0xEF, 0x4A, 0x87, 0x12, 0x3B,
+    0x46, 0x5A, 0xB2, 0x8D, 0x21, 0x03, 0x73, 0x0D, 0xDD, 0x40, 0xD8, 0x8E, 0x8D, 0x6A, 0xD4, 0x90,
+    0x9B, 0xB0, 0x3E, 0x3B, 0xBB, 0x49, 0x9D, 0xF6, 0x36, 0x1E, 0x39, 0xFE, 0x06, 0x6D, 0x55, 0x41,
+    0x8C, 0xDB, 0xC6, 0x15, 0x7D, 0xC3, 0x89, 0x33, 0x4D, 0xB8, 0xD2, 0xE4, 0xB0, 0x07, 0xA3, 0x95,
+    0xC5, 0x4B, 0x0E, 0x02, 0xAA, 0xB5, 0xF6, 0xB0, 0x28, 0x16, 0x09, 0x25, 0xD2, 0x0D, 0xD0, 0x3D,
+    0x6C, 0xDB, 0x04, 0x45, 0x8D, 0x1E, 0x8A, 0x16, 0x3E, 0xF4, 0x18, 0x20, 0x0A, 0x20, 0x34, 0x4A,
+    0xCC, 0x95, 0xB8, 0xDD, 0xC3, 0x1E, 0x16, 0x68, 0x0C, 0x04, 0xBD, 0xF4, 0xE4, 0x63, 0x61, 0x3B,
+    0x09, 0x93, 0xF2, 0x20, 0xB8, 0xB2, 0x35, 0xB5, 0x0A, 0x18, 0xE8, 0x02, 0x0D, 0x5D, 0xA3, 0x08,
+    0x50, 0x03, 0x01, 0x5D, 0x1B, 0x31, 0x60, 0xC5, 0x35, 0x6D, 0xB3, 0x08, 0xBD, 0x4B, 0x69, 0xFA,
+    0xA9, 0xED, 0xA6, 0xDB, 0xA0, 0x33, 0x7F, 0xBE, 0x66, 0xC8, 0x99, 0xFF, 0xFF, 0xF0, 0xBF, 0xF7,
+    0xD5, 0xD7, 0x3F, 0x3F, 0xBD, 0xE6, 0x1A, 0x11, 0x42, 0x9C, 0x84, 0xE9, 0x1B, 0x31, 0x06, 0xC5,
+    0x44, 0x19, 0x09, 0xB8, 0x4E, 0xF8, 0xDF, 0x12, 0xEE, 0x07, 0xFF, 0x15, 0xB7, 0x10, 0xE1, 0x86,
+    0x12, 0x61, 0x5F, 0x4F, 0x49, 0x56, 0x51, 0xAF, 0xA1, 0x36, 0xD2, 0x4B, 0xA7, 0xD7, 0x61, 0x28,
+    0x04, 0x68, 0xE8, 0xDD, 0xD3, 0x3F, 0x2A, 0x26, 0x27, 0x2F, 0xEC, 0xE8, 0xC7, 0x3A, 0x97, 0x9B,
+    0x49, 0x13, 0xB6, 0x14, 0x64, 0x30, 0x49, 0x21, 0x5F, 0x6D, 0x00, 0x1B, 0x4F, 0x14, 0xD9, 0xCE,
+    0x00, 0x4B, 0x03, 0xD0, 0x31, 0x20, 0x67, 0x38, 0x78, 0x32, 0xD2, 0x11, 0x59, 0xD0, 0xAE, 0xF9,
+    0xE5, 0xDE, 0x94, 0xCD, 0x9C, 0x4F, 0x92, 0xFE, 0x38, 0x77, 0xD4, 0x31, 0xD7, 0xD2, 0x8C, 0xC5,
+    0xA8, 0x43, 0xB2, 0x9F, 0xBA, 0xDA, 0x47, 0x17, 0x02, 0xC6, 0xDF, 0xBF, 0xF7, 0x58, 0x67, 0x6F,
+    0xA4, 0x64, 0x02, 0x29, 0x7E, 0x91, 0x22, 0x0F, 0x8D, 0x7C, 0xC0, 0xF3, 0x81, 0x99, 0x0F, 0xA4,
+    0xE7, 0x35, 0x6C, 0xAF, 0xD9, 0xF4, 0xBC, 0xA6, 0x97, 0x36, 0x7B, 0x49, 0xCB, 0x89, 0x5A, 0x8E,
+    0xEA, 0x39, 0x6E, 0xAF, 0xC4, 0x51, 0x12, 0x10, 0x39, 0x70, 0xAE, 0x38, 0xF8, 0xC2, 0xFF, 0x3D,
+    0x5B, 0x3D, 0x7A, 0xB6, 0xF9, 0xD5, 0xD9, 0x25, 0x53, 0x85, 0x4D, 0x7E, 0x2D, 0x96, 0x16, 0xEC,
+    0x0C, 0x5F, 0x2A, 0x3E, 0x85, 0x4C, 0xD0, 0x57, 0x4C, 0x2B, 0xF1, 0xD0, 0x6F, 0x38, 0xFE, 0xC0,
+    0xF9, 0x55, 0x3C, 0x7A, 0xD7, 0xD7, 0xAE, 0xD0, 0x71, 0xEF, 0x03, 0xE1, 0xC7, 0xDD, 0x32, 0xA9,
+    0x4E, 0x59, 0x9C, 0x8A, 0xC3, 0xAA, 0xC9, 0xE2, 0xA4, 0x2A, 0xD9, 0x9D, 0xA4, 0xBA, 0x08, 0x78,
+    0x68, 0xF5, 0xD0, 0x3B, 0x8B, 0x7F, 0xBE, 0xB5, 0xF9, 0xD9, 0xEF, 0xC7, 0x7F, 0xF9, 0xF8, 0xE6,
+    0xAF, 0x83, 0xFD, 0x1F, 0x86, 0xBA, 0x1C, 0xF6, 0xCA, 0xA1, 0x5D, 0x0E, 0x51, 0x0D, 0x61, 0xBD,
+    0x80, 0xC5, 0x2E, 0xEC, 0xC1, 0x7F, 0xA4, 0x79, 0x20, 0x43, 0x34, 0x47, 0x7A, 0x3A, 0x97, 0x59,
+    0x8E, 0x5E, 0x8E, 0xD6, 0x5C, 0xF7, 0xD8, 0xE8, 0x9C, 0xB1, 0x77, 0xD5, 0x48, 0x05, 0x7D, 0xE4,
+    0x0D, 0x0F, 0xF2, 0x7D, 0x30, 0xED, 0xC2, 0x51, 0x90, 0x29, 0xF8, 0x03, 0xB0, 0x49, 0x84, 0x4C,
+    0x5F, 0xCC, 0xE9, 0xDB, 0x1A, 0x5A, 0xE3, 0x5B, 0x33, 0xCC, 0x5B, 0x43, 0xEF, 0xFF, 0xA6, 0xA7,
+    0x64, 0xC0, 0xBF, 0xC0, 0x3E, 0x5A, 0xC5, 0xE4, 0x01, 0xF6, 0xDD, 0x56, 0x24, 0x43, 0xAE, 0x9C,
+    0x4C, 0xDC, 0x4F, 0x3B, 0xFC, 0xBA, 0xBB, 0xD4, 0x31, 0x76, 0x5D, 0x6F, 0xA4, 0x77, 0x74, 0x34,
+    0x20, 0x84, 0x20, 0x83, 0x54, 0xC8, 0x0F, 0xD4, 0xBC, 0x99, 0x53, 0xF4, 0xA7, 0x46, 0x0A, 0x41,
+    0xDE, 0x5C, 0x58, 0x20, 0xFC, 0x60, 0x69, 0xAE, 0x1D, 0x72, 0xA1, 0x60, 0xCD, 0xAE, 0x48, 0x3D,
+    0xE5, 0x7A, 0x8A, 0xD1, 0xD3, 0x22, 0xE1, 0x45, 0x9B, 0xC1, 0xC6, 0xD7, 0xC5, 0xFB, 0x5F, 0xD9,
+    0xC0, 0x19, 0xB6, 0xED, 0xAE, 0xDA, 0x7C, 0x33, 0x0E, 0xA5, 0x44, 0x37, 0xE1, 0x33, 0x58, 0x11,
+    0x39, 0x35, 0x15, 0xC5, 0xD0, 0x47, 0x3F, 0x12, 0x71, 0xE1, 0xDE, 0x20, 0xDB, 0x5B, 0xEA, 0x1F,
+    0x7E, 0x52, 0x39, 0x6F, 0x8B, 0x25, 0xC9, 0xC7, 0x5A, 0xC7, 0x0E, 0xA1, 0xAA, 0x49, 0xB8, 0x22,
+    0x58, 0x29, 0x20, 0x41, 0xB1, 0x28, 0x22, 0xA5, 0x65, 0x62, 0x44, 0x27, 0x59, 0xCC, 0xA3, 0x04,
+    0x5E, 0x0A, 0x93, 0x30, 0x97, 0xCF, 0xE3, 0x74, 0x12, 0x34, 0x7A, 0xB0, 0x76, 0x22, 0xA9, 0x72,
+    0x33, 0xB2, 0xB6, 0x63, 0xBA, 0x10, 0xED, 0x5F, 0x0E, 0xF8, 0x3A, 0x56, 0x0E, 0x94, 0x58, 0x47,
+    0xE7, 0x50, 0xE9, 0x59, 0x01, 0xD5, 0x13, 0x05, 0xE6, 0x17, 0xCF, 0xF3, 0xD7, 0x71, 0x0B, 0xDF,
+    0x51, 0xA5, 0x80, 0x5F, 0x62, 0xF7, 0x36, 0x33, 0x3D, 0x33, 0xEF, 0xF9, 0x04, 0xD7, 0x2E, 0xAA,
+    0xE4, 0x33, 0xA8, 0x55, 0x02, 0xFB, 0x88, 0xD4, 0x8F, 0xCA, 0xC2, 0x48, 0xE7, 0x24, 0xB4, 0xAD,
+    0xFE, 0xBC, 0x69, 0xF2, 0x3F, 0x5E, 0x53, 0x49, 0x9B, 0x36, 0xD5, 0xA5, 0x30, 0x0D, 0x5A, 0x04,
+    0x6D, 0xDA, 0x55, 0x37, 0xE7, 0x0B, 0x5D, 0xB8, 0x24, 0xEC, 0xB3, 0x88, 0x6C, 0x02, 0xC7, 0xFB,
+    0x11, 0xBE, 0x4D, 0x53, 0x35, 0x97, 0x88, 0xD2, 0x1D, 0xB3, 0xC8, 0x66, 0xD1, 0x02, 0x8B, 0x4A,
+    0x2C, 0xF2, 0x98, 0xCE, 0x59, 0xC1, 0x2C, 0x2C, 0x2E, 0xD3, 0xC7, 0x3C, 0x3A, 0x56, 0x68, 0x38,
+    0x19, 0xBC, 0x8E, 0xA4, 0xC1, 0x8B, 0xE1, 0x7A, 0x1D, 0x0B, 0x5E, 0x5F, 0x63, 0xA3, 0x9F, 0xE1,
+    0xCA, 0x32, 0x16, 0xC0, 0x0B, 0xA3, 0x2B, 0x44, 0x4B, 0xE1, 0x3E, 0x8A, 0x16, 0x3A, 0xFC, 0x67,
+    0xE2, 0xBA, 0x7E, 0xA4, 0x63, 0x83, 0x12, 0xB0, 0x16, 0xD9, 0x48, 0xDA, 0x74, 0x37, 0xD8, 0xEC,
+    0xC2, 0x90, 0x15, 0xB1, 0x17, 0xD9, 0x9B, 0x32, 0xBA, 0x47, 0xEA, 0xE8, 0xC4, 0x24, 0xD8, 0xCD,
+    0x9B, 0x2D, 0xA6, 0x52, 0x6C, 0xDE, 0x19, 0xFB, 0xF5, 0x47, 0x8A, 0x7B, 0x01, 0x1E, 0xDA, 0x78,
+    0x59, 0xA3, 0x4C, 0xB4, 0x19, 0x0C, 0x8C, 0xCF, 0xAC, 0xC9, 0x93, 0x2D, 0x9D, 0xC6, 0xD6, 0x5D,
+    0x0A, 0x5C, 0xB5, 0x2E, 0x9E, 0x8A, 0x88, 0x95, 0x2B, 0x55, 0x44, 0xCE, 0x4F, 0xFC, 0xFE, 0x8C,
+    0xE9, 0xCC, 0xFA, 0x6E, 0x1C, 0x9A, 0xE3, 0xA8, 0x21, 0xDD, 0x7C, 0x83, 0x3F, 0xCE, 0x08, 0x6C,
+    0x94, 0xA2, 0xB6, 0xFC, 0xF0, 0x15, 0x15, 0xAE, 0x88, 0x35, 0xAC, 0xB6, 0xF9, 0x36, 0x86, 0xAD,
+    0xD1, 0x35, 0x9D, 0x9B, 0x9F, 0x17, 0xEF, 0x8E, 0x9D, 0x31, 0x67, 0x54, 0xC4, 0x3A, 0x30, 0x9F,
+    0x75, 0xFF, 0xA0, 0xCD, 0x68, 0x38, 0xE0, 0xBB, 0x6E, 0xB3, 0xCB, 0xC7, 0xB7, 0x87, 0x96, 0x76,
+    0x1B, 0x3E, 0x95, 0x96, 0x38, 0xA8, 0x05, 0x95, 0xA0, 0x3B, 0x4A, 0x82, 0x13, 0x81, 0x0C, 0xAC,
+    0xD1, 0x6C, 0x54, 0x14, 0x9C, 0x59, 0x40, 0x95, 0xEF, 0xA0, 0x0F, 0xE6, 0xBD, 0x80, 0x89, 0x46,
+    0xCD, 0x46, 0x9C, 0x10, 0xAC, 0x4A, 0x54, 0xE9, 0x6C, 0x02, 0x4D, 0xFF, 0xE2, 0x6D, 0xAD, 0xC7,
+    0xBE, 0xF9, 0x1C, 0x16, 0x8D, 0x0C, 0x69, 0xBB, 0x66, 0x6C, 0xFD, 0x36, 0xEF, 0xDF, 0xDF, 0x06,
+    0x56, 0xC1, 0xD3, 0xE3, 0x52, 0xAB, 0xC6, 0xDD, 0x63, 0xCC, 0x75, 0xC5, 0xD6, 0x58, 0x19, 0x37,
+    0xAF, 0xFB, 0x78, 0xF2, 0x09, 0x70, 0xF6, 0x01, 0x05, 0x4D, 0x4E, 0xA8, 0x4A, 0xA0, 0x41, 0xBF,
+    0x84, 0x7A, 0x4E, 0x29, 0x94, 0xB7, 0x26, 0xB1, 0xB3, 0x73, 0x27, 0xFB, 0xA6, 0xCF, 0x94, 0x81,
+    0x05, 0x33, 0x62, 0x8A, 0xAF, 0x0F, 0x1B, 0x94, 0xCC, 0x9A, 0x71, 0x9F, 0xED, 0xA9, 0xFB, 0xC1,
+    0xC7, 0x97, 0x3A, 0x93, 0xD5, 0x97, 0xBE, 0x90, 0x57, 0xF8, 0xC3, 0x02, 0xBC, 0xC4, 0xCA, 0x1A,
+    0x85, 0x75, 0xDE, 0xFC, 0x9D, 0x98, 0xF0, 0x0B, 0xD7, 0xFE, 0xFC, 0xD1, 0xCD, 0x4B, 0xF1, 0x24,
+    0x68, 0xA5, 0x72, 0xC8, 0xD5, 0xF1, 0x9A, 0x59, 0xE5, 0xEF, 0x62, 0x02, 0xC7, 0x97, 0x8A, 0xE7,
+    0xEC, 0x96, 0xEA, 0xE4, 0x4B, 0x92, 0x6C, 0xF5, 0x6F, 0x8C, 0xD7, 0x4B, 0xB5, 0x95, 0xF3, 0x7F,
+    0xDD, 0xFA, 0x41, 0x29, 0xA0, 0xA4, 0xD7, 0x70, 0xA6, 0x85, 0xD4, 0x31, 0x52, 0xE7, 0x95, 0xEC,
+    0xEC, 0xF6, 0xE0, 0xAD, 0xDD, 0xEE, 0x2F, 0x1F, 0xDA, 0x9D, 0xA9, 0x17, 0x0E, 0xBD, 0x41, 0xD7,
+    0x1B, 0x60, 0xF8, 0x22, 0xCE, 0xC4, 0xC6, 0x58, 0x11, 0xD5, 0x6C, 0x4A, 0x71, 0x52, 0xF0, 0xE8,
+    0x55, 0x3D, 0x6D, 0x9E, 0xFE, 0x57, 0xC2, 0x3F, 0x55, 0xD2, 0x15, 0xA9, 0xB9, 0xB6, 0xE5, 0xBE,
+    0x39, 0x47, 0x39, 0xEE, 0xB9, 0xDD, 0xBD, 0x61, 0x63, 0xC6, 0xA6, 0xF3, 0x22, 0x32, 0xC1, 0x4B,
+    0xAA, 0x5C, 0x3C, 0x3E, 0x9C, 0xB0, 0xF8, 0x1B, 0x27, 0xF1, 0xF2, 0xC4, 0xCD, 0x4D, 0x1E, 0x55,
+    0x24, 0x96, 0x6D, 0x44, 0x99, 0xE0, 0x4F, 0x3D, 0xA9, 0xA3, 0xB7, 0x8B, 0x34, 0xC9, 0x39, 0x68,
+    0x92, 0x03, 0xA0, 0x40, 0x64, 0x8D, 0x1F, 0xDB, 0x94, 0xBA, 0xA2, 0x77, 0xD1, 0x42, 0x23, 0x7F,
+    0x76, 0x5A, 0xFC, 0x15, 0xA8, 0xD2, 0x33, 0x04, 0xEC, 0x32, 0x10, 0x93, 0x22, 0x3E, 0x55, 0xC1,
+    0x12, 0xAC, 0xB0, 0x9B, 0xAA, 0x5E, 0xA5, 0x8C, 0xAC, 0x8A, 0x1D, 0xD7, 0x4E, 0x98, 0x86, 0x8C,
+    0xD1, 0x83, 0x88, 0xA8, 0x64, 0x58, 0xBE, 0x93, 0xF0, 0x6C, 0x6E, 0xB3, 0x3E, 0x2F, 0x0B, 0xEF,
+    0xDD, 0xB8, 0xA1, 0x8A, 0xB2, 0xC0, 0x6B, 0x92, 0xED, 0x72, 0xF5, 0xD1, 0xD3, 0xBD, 0xDC, 0xD1,
+    0x53, 0x7A, 0x73, 0xA4, 0x2C, 0x1C, 0x2B, 0xB6, 0x73, 0x65, 0x97, 0x4C, 0xBC, 0x19, 0x71, 0xAA,
+    0x6B, 0xA0, 0x04, 0x5F, 0x8E, 0x2C, 0xB9, 0xA6, 0xBC, 0xA2, 0x02, 0xB4, 0x03, 0x31, 0x57, 0x02,
+    0xED, 0x36, 0xA9, 0xE5, 0x77, 0x3E, 0xFC, 0x94, 0xCE, 0x33, 0x45, 0x2E, 0x8A, 0xA6, 0xDE, 0x33,
+    0xBE, 0xFF, 0xDC, 0xF2, 0xCA, 0xE7, 0xB7, 0xF7, 0xFD, 0x32, 0x61, 0xE1, 0x6B, 0x7C, 0x3F, 0x64,
+    0xFA, 0xE5, 0xAB, 0x97, 0x0E, 0x69, 0x2E, 0x8E, 0xD0, 0xDC, 0x3C, 0xA4, 0xF9, 0xE5, 0xAB, 0x1F,
+    0xBC, 0xA1, 0xF5, 0x01, 0xB3, 0xED, 0xA2, 0x6E, 0xF5, 0x5D, 0xF6, 0x3E, 0x88, 0x82, 0xD0, 0xE7,
+    0xF8, 0xA9, 0xB8, 0x0C, 0xB5, 0x2A, 0xB0, 0x97, 0x73, 0xED, 0xBF, 0x86, 0x67, 0x02, 0x54, 0x48,
+    0x42, 0x54, 0xFA, 0x77, 0x2B, 0x9D, 0x13, 0x95, 0x8E, 0xA8, 0x74, 0xCC, 0x4A, 0xEF, 0x6A, 0xC5,
+    0xC9, 0xEA, 0xAF, 0x91, 0x81, 0xA2, 0x8F, 0xEE, 0x12, 0xC8, 0x9F, 0x0F, 0xCA, 0x97, 0xA7, 0xA3,
+    0xB4, 0x11, 0xBF, 0x68, 0xBA, 0x74, 0xD9, 0x3A, 0xD7, 0xAE, 0xF1, 0x27, 0xF6, 0x58, 0x27, 0x8D,
+    0x18, 0x5F, 0xB5, 0x7F, 0x03, 0x85, 0x55, 0x4D, 0x6C, 0x5B, 0xC5, 0x16, 0xFE, 0xEE, 0x0C, 0xE5,
+    0x52, 0x8F, 0x9D, 0x61, 0x81, 0xF4, 0x2A, 0x70, 0xEA, 0x2E, 0xBA, 0x08, 0xC8, 0x8E, 0x91, 0xF0,
+    0x7B, 0x35, 0x95, 0x93, 0x3B, 0x34, 0x0B, 0x16, 0x5D, 0xC0, 0xA2, 0xEC, 0x58, 0x74, 0xC1, 0xBE,
+    0x2E, 0xE4, 0xD1, 0x20, 0x39, 0xF5, 0x94, 0xB7, 0x88, 0x44, 0x17, 0x2D, 0x6C, 0x10, 0x08, 0x41,
+    0x84, 0x90, 0x40, 0x11, 0x22, 0x16, 0x58, 0x10, 0x44, 0x2A, 0x0F, 0x74, 0x11, 0x89, 0x2E, 0xB8,
+    0x95, 0x90, 0x58, 0xB0, 0x60, 0xF8, 0xE9, 0x43, 0x4A, 0x2B, 0x31, 0xD0, 0x8B, 0x30, 0xC1, 0xD7,
+    0xF3, 0xCE, 0x38, 0xED, 0x03, 0x04, 0x88, 0x99, 0x33, 0x37, 0x73, 0xE3, 0xB9, 0xE7, 0xE7, 0x3B,
+    0xDF, 0x39, 0xD3, 0xAE, 0x9F, 0xB9, 0xF8, 0xF4, 0x56, 0x99, 0x3F, 0xBA, 0x5A, 0x78, 0x42, 0xDD,
+    0x9D, 0xE3, 0xF5, 0x25, 0xFE, 0x52, 0xBF, 0x76, 0xD2, 0x7F, 0xFF, 0xE1, 0x18, 0x6C, 0x9D, 0x47,
+    0xC6, 0xB4, 0x1B, 0xE5, 0xD8, 0x47, 0xFF, 0x35, 0x69, 0xCF, 0x55, 0x17, 0x05, 0x6E, 0x05, 0x6A,
+    0xC0, 0x63, 0xB8, 0x31, 0xD8, 0x10, 0x59, 0x7B, 0x86, 0xFD, 0xE7, 0xC5, 0x51, 0x77, 0x7B, 0x05,
+    0x68, 0x82, 0x67, 0xFB, 0xA4, 0x37, 0xF5, 0x6F, 0xCA, 0xFC, 0x56, 0x68, 0xA0, 0x62, 0xAB, 0xA2,
+    0x88, 0xCF, 0xFC, 0x8E, 0x41, 0x1B, 0xF2, 0x91, 0xE7, 0x7C, 0x76, 0xD7, 0x30, 0x32, 0x60, 0x06,
+    0x49, 0x1E, 0x9E, 0x9C, 0xE4, 0x19, 0xCD, 0xBD, 0xE3, 0x76, 0x83, 0x9B, 0x26, 0x37, 0x55, 0xAE,
+    0x83, 0xC4, 0xA6, 0x15, 0x9B, 0xB9, 0xD8, 0x9C, 0x46, 0x94, 0x23, 0x72, 0xC1, 0x94, 0x61, 0x9A,
+    0xAB, 0x88, 0x36, 0x83, 0x71, 0x0F, 0xFD, 0x1B, 0x73, 0x63, 0x32, 0x99, 0x8D, 0x1F, 0x5C, 0x50,
+    0xC7, 0x0D, 0xBA, 0xAE, 0x0C, 0xFE, 0xEC, 0xAA, 0x1F, 0x89, 0x21, 0x1D, 0x8C, 0xF3, 0xF8, 0x11,
+    0xA6, 0xE9, 0x94, 0xB4, 0x18, 0x68, 0xB8, 0xFB, 0x97, 0x13, 0x2F, 0xBC, 0x9A, 0xE9, 0x74, 0x80,
+    0xDB, 0x1B, 0x61, 0x34, 0x9B, 0xCD, 0x4E, 0x4D, 0xCA, 0x95, 0x8F, 0x9E, 0x5D, 0x9D, 0x84, 0xD3,
+    0x40, 0x09, 0x5C, 0x21, 0xA5, 0xCD, 0x14, 0xB8, 0x86, 0x05, 0x1D, 0xED, 0xF3, 0xB4, 0xA0, 0xE8,
+    0xC7, 0xC8, 0xC4, 0x28, 0xA3, 0x1D, 0x19, 0x81, 0x2A, 0x7A, 0xCC, 0x14, 0xD0, 0x64, 0xD6, 0xB3,
+    0xF3, 0x90, 0x23, 0xDC, 0x56, 0x0C, 0xB2, 0x8F, 0x44, 0xBA, 0x3B, 0x8A, 0x45, 0x92, 0x83, 0xA5,
+    0xCD, 0x9E, 0xCC, 0x76, 0x41, 0x52, 0xE7, 0xF7, 0x32, 0x75, 0x70, 0x2F, 0x06, 0xFE, 0x2B, 0x75,
+    0xFE, 0x05, 0x76, 0xE6, 0x35, 0xF1, 0xD6, 0xF9, 0xBA, 0xFD, 0x0B, 0x1C, 0x96, 0xFE, 0x80, 0x43,
+    0x10, 0xAC, 0x92, 0x4F, 0xE5, 0x89, 0xBA, 0x82, 0xE0, 0x5B, 0xEA, 0x6B, 0x73, 0xD8, 0xC8, 0x94,
+    0x3B, 0x78, 0x3C, 0xE9, 0xA6, 0x13, 0xB1, 0x90, 0xED, 0x05, 0xB9, 0x5B, 0x98, 0x9C, 0x98, 0x61,
+    0xDB, 0xD1, 0x8E, 0xD9, 0xEE, 0xBD, 0xFD, 0xE6, 0xE2, 0xD5, 0xE6, 0xE1, 0x6B, 0xF2, 0x02, 0xFF,
+    0x0E, 0xAE, 0xC4, 0x94, 0xBD, 0x97, 0xE7, 0xD8, 0x73, 0x33, 0x77, 0x5C, 0x4D, 0xB7, 0xD8, 0x87,
+    0xB6, 0x25, 0xB9, 0x5E, 0xEA, 0xF3, 0x4F, 0x50, 0x71, 0x18, 0x23, 0xB6, 0x58, 0x46, 0x6C, 0xA2,
+    0x21, 0xF7, 0x48, 0x28, 0x81, 0x38, 0xB0, 0xA7, 0x51, 0xF8, 0xED, 0x4C, 0xC6, 0x30, 0x34, 0x95,
+    0x80, 0xF0, 0xEE, 0xC4, 0x1A, 0x7A, 0x10, 0x94, 0x92, 0x6F, 0x84, 0x4E, 0xFB, 0xB1, 0x50, 0xED,
+    0xD3, 0xEB, 0xDC, 0xDB, 0xCA, 0x28, 0xB8, 0x19, 0xFC, 0x99, 0xA2, 0x53, 0xA9, 0x04, 0x7E, 0x86,
+    0xBC, 0xAA, 0xB3, 0x92, 0xC4, 0xF1, 0xFE, 0x7E, 0xE1, 0x2D, 0x05, 0x0D, 0x24, 0xDE, 0x3F, 0xB4,
+    0xBD, 0x7E, 0x39, 0x8B, 0x6D, 0x9D, 0x5B, 0xF6, 0x95, 0xC5, 0xAC, 0x45, 0x7D, 0x8C, 0xE6, 0xA2,
+    0xAB, 0x4E, 0x4F, 0x4F, 0xC5, 0x0B, 0x5B, 0x0F, 0xA4, 0xEF, 0x98, 0xFE, 0x7E, 0x72, 0xD4, 0x8F,
+    0x6A, 0x42, 0xFD, 0x3B, 0x25, 0xB2, 0x7D, 0xDC, 0x9E, 0x79, 0x75, 0xA1, 0x50, 0x6E, 0xAF, 0x9A,
+    0xBA, 0x6E, 0x3E, 0xE5, 0x9A, 0xBD, 0xE6, 0xE2, 0x0F, 0xDE, 0x55, 0xBC, 0x9D, 0x8D, 0xB2, 0x0E,
+    0x5A, 0x4B, 0x98, 0xEB, 0xA3, 0x46, 0xB2, 0x81, 0xB9, 0x65, 0x6C, 0x26, 0x7E, 0x28, 0xBD, 0x63,
+    0x3E, 0xC4, 0x51, 0x3F, 0xB2, 0x52, 0x6A, 0xBC, 0xEB, 0xA3, 0x1D, 0xD7, 0xE2, 0x2B, 0xAA, 0xDA,
+    0x8E, 0xB6, 0x54, 0xB9, 0xC1, 0x2E, 0x6E, 0x6F, 0x54, 0x3C, 0x4E, 0x68, 0xFC, 0x3A, 0xC8, 0x0A,
+    0x08, 0x26, 0x30, 0x4F, 0x44, 0xCF, 0x62, 0x43, 0xFC, 0x72, 0x98, 0xC3, 0x3C, 0x2A, 0x84, 0x8B,
+    0xD4, 0xC8, 0x78, 0x8A, 0x79, 0xE6, 0xE8, 0x85, 0x0E, 0x66, 0xCB, 0x14, 0x47, 0x02, 0x8A, 0x92,
+    0x54, 0xF8, 0x94, 0x5E, 0x88, 0xAB, 0x13, 0xF2, 0x05, 0x4D, 0x1F, 0xA3, 0x56, 0x86, 0x6B, 0x72,
+    0xDD, 0xAB, 0x46, 0xA9, 0xE3, 0x2B, 0x5A, 0xB6, 0x02, 0xCA, 0x84, 0x2B, 0x01, 0xB4, 0x5A, 0x18,
+    0xD8, 0x02, 0xA5, 0x35, 0x52, 0xF8, 0xD6, 0xFF, 0x7C, 0xE5, 0xD8, 0x22, 0x15, 0x96, 0x50, 0xCC,
+    0x92, 0xBD, 0x59, 0x08, 0x4D, 0x9B, 0x4D, 0xD4, 0x27, 0x7A, 0xA6, 0x30, 0xF5, 0x47, 0xCE, 0x57,
+    0xFC, 0xE5, 0x2B, 0xC7, 0xA6, 0xC1, 0x52, 0x74, 0xFD, 0x67, 0x3B, 0x6F, 0xCC, 0x52, 0x11, 0x60,
+    0xF2, 0xA8, 0x83, 0x9C, 0x4B, 0xB2, 0x94, 0xAB, 0x7A, 0xDE, 0x40, 0xCA, 0xF5, 0x14, 0xEE, 0x59,
+    0x7B, 0xDE, 0xE7, 0xED, 0x90, 0xA8, 0x3E, 0x99, 0xC0, 0x60, 0x28, 0xAE, 0xB8, 0x3E, 0x3F, 0x8B,
+    0x6A, 0x2F, 0xBA, 0x44, 0x8F, 0xCA, 0xD9, 0x23, 0x96, 0xBC, 0xE7, 0x28, 0xE2, 0xB0, 0xBE, 0x7C,
+    0x91, 0x15, 0x8B, 0xF7, 0x5A, 0xF9, 0x80, 0x9B, 0x43, 0xA7, 0x22, 0x0C, 0xFF, 0xD2, 0x3A, 0xC8,
+    0xCA, 0x3C, 0xF0, 0xFE, 0x4F, 0x44, 0x52, 0x4F, 0x94, 0xAE, 0x7B, 0xEC, 0x06, 0x2B, 0x73, 0xEC,
+    0xFE, 0xC7, 0xD3, 0x1B, 0xA5, 0x13, 0xE2, 0xA7, 0x9D, 0x11, 0xCB, 0x93, 0x73, 0x6E, 0xB0, 0x32,
+    0xEC, 0x9A, 0x49, 0x41, 0x05, 0x9E, 0x85, 0x20, 0xF6, 0xEE, 0x9B, 0x61, 0x5B, 0xD3, 0xB8, 0xFF,
+    0x13, 0xC4, 0x1F, 0xD0, 0x07, 0x1A, 0x15, 0x03, 0xE2, 0x09, 0x35, 0x0B, 0x79, 0x7A, 0x24, 0xCF,
+    0x9D, 0xA3, 0xD3, 0x07, 0x80, 0x5B, 0xF6, 0xA8, 0xC1, 0x90, 0x80, 0xA0, 0x90, 0xF7, 0x74, 0x2A,
+    0x19, 0xED, 0x24, 0x64, 0x7A, 0xC2, 0x8F, 0x06, 0x96, 0x83, 0xE3, 0x4E, 0x1D, 0x19, 0x86, 0xA2,
+    0x48, 0x23, 0xC3, 0x8F, 0x6E, 0x26, 0xA9, 0x8A, 0x8E, 0x43, 0xD7, 0xD0, 0x12, 0xDA, 0x75, 0xF8,
+    0x45, 0x2B, 0x2B, 0x68, 0x65, 0xF8, 0xC5, 0xC4, 0x39, 0x35, 0x1E, 0x74, 0x35, 0x65, 0x5E, 0x0C,
+    0xF4, 0x6C, 0xA2, 0x86, 0xDD, 0x85, 0x74, 0xF0, 0x90, 0x22, 0xAB, 0x31, 0x50, 0x3E, 0x78, 0xBC,
+    0xE1, 0xFE, 0x69, 0x0E, 0xE9, 0x84, 0x92, 0xDA, 0x55, 0xA7, 0xD2, 0x93, 0x59, 0xEF, 0x02, 0x29,
+    0x8F, 0x26, 0x50, 0xB7, 0xB8, 0xDA, 0x8F, 0xCF, 0x25, 0x0E, 0x5D, 0x52, 0xD3, 0xD7, 0x4D, 0xDC,
+    0x35, 0xCC, 0x5B, 0xBC, 0x97, 0xA3, 0x76, 0xDD, 0xCA, 0xCE, 0x69, 0xFE, 0x85, 0xB0, 0xA1, 0x4C,
+    0x42, 0x54, 0xBD, 0x7F, 0x95, 0xF9, 0x29, 0x7D, 0xA8, 0xC7, 0xC7, 0x38, 0xB5, 0x11, 0x3F, 0x6E,
+    0x4F, 0x4A, 0x23, 0x8E, 0xB8, 0xEE, 0xF5, 0x54, 0x1E, 0xD5, 0xE4, 0x89, 0x9C, 0x87, 0xEC, 0x80,
+    0x5A, 0x80, 0x74, 0x21, 0xE9, 0x14, 0x6B, 0x65, 0x80, 0x7A, 0xA2, 0x67, 0xA5, 0x9D, 0x15, 0xC3,
+    0x79, 0x9E, 0x53, 0xE2, 0xA9, 0xEC, 0xBB, 0x43, 0xFC, 0xE3, 0xD3, 0xD0, 0x6B, 0x88, 0x95, 0xFC,
+    0x65, 0xF0, 0x4D, 0x50, 0x51, 0xF3, 0x0C, 0xF1, 0x05, 0xC4, 0xAF, 0xA8, 0xF8, 0xAC, 0x8D, 0x9F,
+    0x1E, 0x26, 0xFE, 0x88, 0xBB, 0x67, 0x7D, 0x21, 0x85, 0x14, 0x9A, 0x72, 0x81, 0xA0, 0x3B, 0x28,
+    0x0F, 0xDA, 0x83, 0xFA, 0xA0, 0x3F, 0x18, 0x08, 0x16, 0x82, 0x09, 0x90, 0x0D, 0x90, 0x11, 0xCC,
+    0xF3, 0x49, 0x86, 0x8E, 0xA2, 0xBC, 0x88, 0xFB, 0x4C, 0x74, 0x2D, 0x94, 0x77, 0x85, 0x08, 0x00,
+    0xF6, 0x05, 0x44, 0x1D, 0xAD, 0x04, 0x0F, 0xE3, 0x8E, 0x3E, 0x5A, 0xFF, 0x97, 0xE1, 0x4D, 0xF1,
+    0x3E, 0xDF, 0x95, 0x11, 0x96, 0x6F, 0x4A, 0x17, 0x01, 0x3E, 0xBA, 0x01, 0xCA, 0xD1, 0x16, 0x4E,
+    0x9A, 0x6A, 0x5B, 0x94, 0xD9, 0x25, 0xFF, 0x83, 0x1F, 0xF5, 0x45, 0x8D, 0x7D, 0xAE, 0xFA, 0xE1,
+    0xA7, 0xC9, 0xD8, 0x4F, 0x69, 0xFD, 0x56, 0xF3, 0x9D, 0x35, 0x4B, 0xA5, 0xB3, 0x81, 0x16, 0x11,
+    0x53, 0x2A, 0xA1, 0x79, 0x4A, 0xCC, 0xCC, 0xA8, 0x0B, 0xE6, 0x44, 0x21, 0xAF, 0x04, 0xB1, 0x86,
+    0xB9, 0x68, 0x48, 0xC5, 0x30, 0x8F, 0x04, 0x15, 0x2D, 0x0D, 0xB9, 0xD7, 0x13, 0xE3, 0x9E, 0x40,
+    0x10, 0x19, 0x64, 0xE0, 0x83, 0x38, 0x79, 0x43, 0xD6, 0xD6, 0x14, 0x91, 0x8D, 0x7A, 0x39, 0x21,
+    0xF7, 0xFB, 0xF5, 0x9D, 0x75, 0xFC, 0xC7, 0x8E, 0x8B, 0xCD, 0x34, 0xAD, 0x29, 0x17, 0xEB, 0xA9,
+    0xDD, 0xBF, 0x66, 0x93, 0xD6, 0xA4, 0x0F, 0x0F, 0xE8, 0xBB, 0x1E, 0xFF, 0xF3, 0xD5, 0xA7, 0xAE,
+    0xD5, 0xA7, 0xDE, 0x4B, 0x89, 0xA8, 0x22, 0xD6, 0x25, 0xC4, 0x8A, 0x56, 0xD8, 0x9F, 0x19, 0x52,
+    0x85, 0x3E, 0x1C, 0xBE, 0x0F, 0xD7, 0x50, 0x00, 0x3B, 0x14, 0x65, 0x8B, 0x2E, 0x94, 0x45, 0x7E,
+    0xC6, 0x06, 0x3F, 0x5D, 0x69, 0xB2, 0xAC, 0x2B, 0x71, 0x93, 0x49, 0xA9, 0x97, 0x85, 0xAF, 0x52,
+    0x31, 0x8C, 0x29, 0x3E, 0x8B, 0xDB, 0x77, 0x11, 0xC9, 0x26, 0xD2, 0x13, 0xB6, 0x51, 0x2A, 0x15,
+    0x0B, 0xEC, 0x41, 0xAE, 0x2E, 0xD3, 0x8D, 0xDA, 0xAC, 0x39, 0x3A, 0xE4, 0xBA, 0xEB, 0xF6, 0x06,
+    0x70, 0x22, 0x47, 0x37, 0x67, 0x94, 0x7C, 0x43, 0x80, 0x51, 0xC3, 0x21, 0xE0, 0xC2, 0x75, 0x4B,
+    0x4F, 0xEA, 0x31, 0x75, 0x2A, 0x98, 0xF1, 0x05, 0xE9, 0x73, 0x4E, 0x00, 0x0E, 0xF2, 0x49, 0xBD,
+    0x1C, 0x00, 0x75, 0x23, 0xC4, 0xC3, 0xFA, 0xB1, 0x16, 0x16, 0x27, 0x73, 0x29, 0x74, 0x2A, 0x2A,
+    0x42, 0xDC, 0x06, 0x87, 0xBF, 0x1D, 0xFF, 0x03, 0xA5, 0x55, 0x4F, 0x6C, 0x14, 0x55, 0x1C, 0xFE,
+    0x66, 0x1E, 0xCB, 0x48, 0x67, 0xDB, 0xC7, 0x41, 0x13, 0xA2, 0xFB, 0xE7, 0xD2, 0x43, 0x25, 0xD3,
+    0xDD, 0x1E, 0x36, 0x61, 0x25, 0xD3, 0xCE, 0x34, 0x8D, 0x72, 0xC0, 0x48, 0x0F, 0xE0, 0xC1, 0xC4,
+    0x68, 0x0C, 0x47, 0x49, 0xD6, 0x08, 0x49, 0x91, 0x2D, 0x3B, 0xC0, 0x81, 0xC4, 0x26, 0x50, 0x0F,
+    0xDE, 0x9B, 0xC8, 0x01, 0x09, 0xDA, 0x85, 0xD4, 0x88, 0x71, 0xE9, 0x3E, 0xBA, 0x87, 0x6A, 0x6A,
+    0xEC, 0x00, 0x31, 0x24, 0x90, 0xC8, 0x24, 0x18, 0x0E, 0x25, 0x26, 0x8F, 0x76, 0xB4, 0x4B, 0x3B,
+    0xDD, 0xE7, 0x6F, 0x76, 0xA1, 0xD6, 0xA8, 0x07, 0xE3, 0x9B, 0xF7, 0xF6, 0xCD, 0xEE, 0xCE, 0xEF,
+    0xFB, 0xBD, 0xF7, 0x7D, 0xDF, 0xEF, 0x8D, 0x52, 0x2D, 0xA5, 0x5A, 0xB0, 0xF1, 0xB4, 0x97, 0xFF,
+    0xDA, 0x6B, 0xCF, 0x7A, 0x04, 0xF8, 0xC0, 0x24, 0xEA, 0xEA, 0xD0, 0x07, 0x6E, 0x0A, 0x06, 0x34,
+    0x81, 0x12, 0x2C, 0x98, 0xD0, 0x05, 0xAA, 0x18, 0xC0, 0x0C, 0x06, 0x6D, 0x94, 0x73, 0x08, 0xB9,
+    0x26, 0xCD, 0x86, 0xCF, 0xEE, 0x09, 0x5D, 0xB9, 0x50, 0xC0, 0xF5, 0x2D, 0x10, 0x11, 0xB4, 0x08,
+    0x25, 0x76, 0x4E, 0x6F, 0x08, 0x79, 0xB4, 0xD0, 0x63, 0xB1, 0x45, 0x9C, 0x70, 0xB9, 0xD0, 0x03,
+    0x5C, 0x43, 0x0E, 0xA6, 0xF7, 0x6F, 0x20, 0x5C, 0xF9, 0x5D, 0xAD, 0xC9, 0xAD, 0x20, 0xBB, 0xF0,
+    0x89, 0x9F, 0xE6, 0xBA, 0xA8, 0x16, 0x8D, 0xB3, 0xAE, 0x2D, 0xF5, 0x9F, 0xC1, 0xC5, 0xEE, 0xD6,
+    0x67, 0x4A, 0x11, 0x92, 0xE9, 0xE1, 0x20, 0xA8, 0x31, 0x81, 0x20, 0x43, 0x9B, 0x9A, 0x31, 0x5D,
+    0x76, 0x43, 0x22, 0x4B, 0xDB, 0x53, 0x1E, 0x98, 0x04, 0x2A, 0x00, 0x6F, 0x42, 0x5F, 0xF5, 0x31,
+    0x9E, 0xA7, 0xC0, 0x88, 0x49, 0x33, 0x98, 0x85, 0x23, 0x80, 0x24, 0xC5, 0xD1, 0x84, 0x5E, 0x7D,
+    0x58, 0x94, 0x7A, 0xBA, 0xB1, 0xC7, 0xD3, 0x29, 0x12, 0xAC, 0x89, 0x65, 0x91, 0xE3, 0x86, 0x20,
+    0x4E, 0x46, 0x09, 0x46, 0x21, 0x71, 0x64, 0x74, 0x4A, 0x17, 0x5D, 0x44, 0xC1, 0x3F, 0x4C, 0xFD,
+    0x90, 0xBA, 0x52, 0x41, 0x9E, 0x98, 0x05, 0x02, 0xA0, 0x27, 0x9E, 0xEA, 0xD2, 0x4B, 0x32, 0x0C,
+    0x24, 0x21, 0x06, 0x18, 0x04, 0xDD, 0xEE, 0xFD, 0x12, 0x6A, 0x03, 0x28, 0xB4, 0xA9, 0xC5, 0xBB,
+    0xFA, 0x69, 0x9F, 0x1B, 0xB0, 0x53, 0x90, 0x25, 0x26, 0x7C, 0xCE, 0x6E, 0x46, 0xAC, 0x25, 0xE3,
+    0x4D, 0xF0, 0xB6, 0x32, 0x01, 0xD8, 0x65, 0x24, 0xAA, 0x31, 0xDF, 0x89, 0x9D, 0xDB, 0xBA, 0x0D,
+    0xE6, 0x0A, 0x51, 0xEA, 0xB5, 0x98, 0xEA, 0x48, 0x91, 0x04, 0x9B, 0x42, 0x1F, 0x12, 0x25, 0xDC,
+    0x41, 0xBA, 0xA4, 0xDD, 0x43, 0xBA, 0x3A, 0x7C, 0xE7, 0xF5, 0xC1, 0xF1, 0x85, 0xDB, 0xAA, 0x65,
+    0xFE, 0x1E, 0x24, 0x73, 0x98, 0x0B, 0xB6, 0xE5, 0xC0, 0xF0, 0x03, 0x1B, 0x48, 0x7E, 0xF7, 0xE1,
+    0x7A, 0x63, 0x5D, 0x4F, 0x3E, 0x77, 0x74, 0x92, 0x90, 0x79, 0x9C, 0x43, 0xC6, 0x37, 0xF5, 0x46,
+    0x38, 0x26, 0x0D, 0x1B, 0x8B, 0xD8, 0x23, 0xD2, 0xD2, 0x28, 0x6B, 0x41, 0x2A, 0x4E, 0x67, 0x75,
+    0x3E, 0xD8, 0xC7, 0x9E, 0xA3, 0x58, 0x30, 0x66, 0xB3, 0x33, 0xC2, 0x2A, 0xEA, 0x0D, 0xCF, 0x2A,
+    0xB3, 0x79, 0x61, 0x97, 0x29, 0x7A, 0x7B, 0x13, 0x98, 0x3D, 0x02, 0xC3, 0x4B, 0xD9, 0x36, 0x8A,
+    0x6B, 0xBF, 0xBD, 0xF5, 0x58, 0x29, 0x25, 0x72, 0x9F, 0x82, 0x6C, 0x01, 0x8D, 0x08, 0x37, 0x42,
+    0xB8, 0x26, 0xB1, 0x61, 0xAA, 0x26, 0xB6, 0x93, 0xA4, 0x15, 0x98, 0x23, 0xDD, 0x03, 0x66, 0x5E,
+    0x45, 0xE6, 0x28, 0x41, 0x63, 0x5C, 0x43, 0x3D, 0x42, 0xC5, 0x87, 0x36, 0x0B, 0x98, 0x0F, 0x05,
+    0x32, 0xA8, 0x12, 0x54, 0x61, 0xF0, 0x9B, 0x37, 0x6B, 0x59, 0xA5, 0x22, 0xAC, 0x91, 0xA2, 0x84,
+    0x43, 0xEA, 0x02, 0x27, 0x69, 0x38, 0x04, 0xC4, 0x69, 0x68, 0x8A, 0xB8, 0x1B, 0x40, 0x67, 0x74,
+    0xDA, 0x75, 0xF4, 0x74, 0x59, 0x41, 0xB2, 0xA2, 0x9A, 0xE9, 0xD1, 0x98, 0xDC, 0x70, 0x9B, 0xA6,
+    0xA4, 0x46, 0xCA, 0x0B, 0x68, 0x64, 0xC4, 0xF2, 0x66, 0xAB, 0xD5, 0xAE, 0x23, 0xE1, 0x52, 0x84,
+    0x4F, 0xC1, 0x06, 0x59, 0x15, 0x5D, 0xEE, 0x26, 0x0A, 0xF8, 0x29, 0x39, 0x08, 0x9B, 0x24, 0xD7,
+    0xA5, 0x0C, 0xC1, 0x0F, 0xE4, 0x69, 0x95, 0x2B, 0x02, 0x8C, 0x92, 0x22, 0x1B, 0x3F, 0xAC, 0x48,
+    0x58, 0x4E, 0x02, 0xB7, 0x7F, 0xA9, 0xD3, 0x3A, 0xF2, 0x4A, 0xB9, 0xE6, 0xEA, 0xDA, 0x86, 0xD6,
+    0x72, 0x16, 0x65, 0xA5, 0x11, 0x91, 0x9F, 0x5E, 0xA0, 0xE7, 0x0A, 0xDD, 0x14, 0x40, 0xBE, 0xD5,
+    0xA6, 0x36, 0xB1, 0x13, 0x9A, 0x3B, 0xCA, 0x1A, 0x0D, 0xA1, 0xDF, 0x9E, 0xF7, 0xB0, 0xB2, 0x08,
+    0x9C, 0xF8, 0x15, 0xC8, 0x13, 0x0C, 0xA7, 0x3D, 0x3A, 0x34, 0x13, 0x55, 0x4C, 0x29, 0x8F, 0x3F,
+    0x7A, 0x14, 0x38, 0x13, 0x0F, 0x9A, 0x3B, 0x13, 0xEC, 0xB4, 0x5F, 0x18, 0x63, 0x07, 0x70, 0x2C,
+    0x30, 0xCA, 0xA8, 0xB8, 0xE6, 0x1A, 0x66, 0x4E, 0x9A, 0x6E, 0x28, 0xA9, 0x82, 0x6C, 0x49, 0x0A,
+    0xD8, 0xC8, 0xBA, 0x66, 0x80, 0xC3, 0x04, 0xDE, 0x18, 0xB1, 0x92, 0x62, 0xAF, 0xF6, 0xC4, 0xC8,
+    0x58, 0xDD, 0xD5, 0x22, 0xFC, 0x1C, 0x46, 0xF5, 0x4B, 0x93, 0x86, 0x0A, 0x0C, 0x6F, 0x4B, 0x1F,
+    0x0E, 0xCC, 0x4E, 0xD7, 0x02, 0xAE, 0x05, 0x59, 0xAD, 0x35, 0xA8, 0x6D, 0xB4, 0x4B, 0x9E, 0x18,
+    0xBE, 0x40, 0x0B, 0x0E, 0x53, 0x05, 0x8B, 0xAE, 0x3E, 0xBA, 0x8A, 0xC5, 0xEA, 0x20, 0x52, 0xB0,
+    0x76, 0xE2, 0xF9, 0x0C, 0xB8, 0xE9, 0xB1, 0xB9, 0x00, 0xF2, 0x1A, 0x06, 0x73, 0xE0, 0xFB, 0x3D,
+    0x76, 0x4B, 0x22, 0xAC, 0xAB, 0x0D, 0xDA, 0xFC, 0x7E, 0xA5, 0x1E, 0x48, 0xAD, 0x19, 0x61, 0xC8,
+    0x41, 0xF6, 0xBE, 0x20, 0xCD, 0xE3, 0xE2, 0x77, 0xA8, 0x80, 0x05, 0x9C, 0xC9, 0xF6, 0xC6, 0x2D,
+    0x7D, 0x02, 0x57, 0x85, 0x55, 0xE5, 0x16, 0x5B, 0x50, 0xCB, 0x2A, 0x92, 0xDC, 0x66, 0xF7, 0xD1,
+    0xA4, 0xE2, 0x77, 0xDC, 0x04, 0xFE, 0x53, 0x82, 0xF3, 0xC2, 0x20, 0x01, 0xC6, 0x89, 0x37, 0xC4,
+    0x15, 0xCF, 0xC8, 0x07, 0x53, 0x71, 0x82, 0x85, 0x76, 0x02, 0x73, 0x4B, 0x82, 0x45, 0x72, 0x4E,
+    0x06, 0x86, 0x4B, 0x2E, 0x46, 0xAF, 0x76, 0xC6, 0x8B, 0xCD, 0xEB, 0x5A, 0x05, 0x72, 0xB0, 0xDD,
+    0xFF, 0x92, 0xA8, 0xD7, 0x62, 0xFF, 0x5B, 0x5B, 0x8C, 0xAE, 0x7B, 0xD0, 0xDD, 0xEF, 0x59, 0x6F,
+    0x72, 0xF2, 0xCA, 0xBD, 0xB9, 0x75, 0x58, 0x9A, 0x34, 0x68, 0xFB, 0x71, 0x73, 0x60, 0xF8, 0x8E,
+    0xCB, 0x7D, 0x47, 0x64, 0x83, 0x8A, 0xC8, 0x07, 0x27, 0x82, 0xA1, 0xE0, 0x23, 0x79, 0x52, 0x1E,
+    0x0F, 0xD7, 0x64, 0x79, 0x63, 0x59, 0xD6, 0xEA, 0x34, 0x9C, 0x07, 0xB2, 0x96, 0x6F, 0xC8, 0x5A,
+    0xB6, 0x11, 0x46, 0x7C, 0x24, 0x8C, 0xC0, 0x88, 0x08, 0x0C, 0xA1, 0xBD, 0xD8, 0x98, 0xE1, 0xB6,
+    0x89, 0x2F, 0xF4, 0x6A, 0xA7, 0x24, 0xDF, 0xE7, 0x8F, 0xD3, 0x63, 0xDF, 0xBE, 0x71, 0xEB, 0xC7,
+    0xAF, 0x27, 0x9C, 0x73, 0xD6, 0xF8, 0x98, 0x7C, 0xBC, 0x22, 0x0C, 0x41, 0x95, 0x84, 0x34, 0xE8,
+    0x5C, 0x05, 0xDE, 0x5B, 0xB0, 0xAE, 0xCE, 0xA7, 0x8F, 0xDD, 0x79, 0x3B, 0xCE, 0x3F, 0xB5, 0x0B,
+    0xD9, 0x2F, 0xA0, 0xB5, 0xB0, 0xA5, 0x5D, 0x8B, 0x97, 0x85, 0xAC, 0x0F, 0x5E, 0x04, 0x3B, 0x0F,
+    0xFD, 0xA6, 0x0F, 0x69, 0x63, 0x8C, 0xBB, 0xFD, 0xA4, 0xAC, 0x5B, 0x36, 0x94, 0x1A, 0x51, 0xEA,
+    0xB1, 0x44, 0xB9, 0x06, 0xEE, 0x75, 0x33, 0xF8, 0x25, 0x63, 0x03, 0x3B, 0x3A, 0xB1, 0x6C, 0x15,
+    0x6B, 0xA1, 0x6D, 0x8E, 0xB8, 0x47, 0x4B, 0xEC, 0x2C, 0x8A, 0x25, 0xB3, 0xF1, 0x28, 0xCA, 0x2B,
+    0x31, 0xFB, 0x3E, 0xBB, 0xD1, 0x56, 0xA0, 0x6F, 0xF7, 0xB3, 0x2C, 0x66, 0xFB, 0xE0, 0x8C, 0x2D,
+    0xB2, 0xE2, 0xA1, 0x28, 0xD1, 0x9F, 0x06, 0x67, 0xC2, 0xF0, 0x42, 0xDD, 0xCF, 0x20, 0x34, 0x44,
+    0x45, 0x85, 0x8E, 0x52, 0x59, 0x18, 0x0B, 0x02, 0x4D, 0x6E, 0x0E, 0xCB, 0xF0, 0xC5, 0xA7, 0xC5,
+    0xE4, 0x94, 0xF8, 0xF4, 0x88, 0x98, 0x29, 0x18, 0xFB, 0x28, 0x01, 0x65, 0xA9, 0x0D, 0xD5, 0xE7,
+    0xA8, 0xEC, 0x1F, 0x8A, 0xA7, 0xC0, 0x64, 0x73, 0xAA, 0xE6, 0x27, 0xD0, 0xE3, 0x9A, 0xEA, 0xA1,
+    0x23, 0x1E, 0x57, 0xE2, 0x03, 0xE3, 0x2C, 0xFD, 0x6F, 0x73, 0xE5, 0x69, 0x81, 0xD3, 0xA2, 0x23,
+    0x8A, 0x28, 0x2C, 0xB3, 0x20, 0x2E, 0x0A, 0x41, 0xD5, 0xA7, 0x94, 0x1F, 0xD2, 0x21, 0x3C, 0x21,
+    0xE8, 0xFB, 0x26, 0x11, 0x6C, 0x35, 0x1B, 0xF0, 0xE9, 0xB0, 0xCF, 0x36, 0x45, 0xB2, 0x60, 0xDC,
+    0x6D, 0x95, 0x58, 0xEB, 0xF3, 0x12, 0xF3, 0x50, 0x32, 0x05, 0x86, 0xEA, 0x4F, 0x12, 0x64, 0xA0,
+    0x0D, 0xF3, 0xE1, 0x7D, 0xAA, 0xAE, 0x1D, 0xFA, 0xA9, 0x25, 0x91, 0x15, 0x9D, 0xF4, 0xCB, 0x3F,
+    0x1D, 0xAC, 0x76, 0x5E, 0x64, 0x2A, 0xFA, 0xEA, 0x50, 0xFB, 0x66, 0xE9, 0x62, 0x5D, 0x11, 0x0D,
+    0xF1, 0xAB, 0x60, 0xC0, 0x9C, 0x46, 0xDE, 0x7B, 0x96, 0x22, 0xEF, 0xF1, 0x7D, 0xBA, 0xD7, 0xF7,
+    0xCA, 0xF4, 0x7C, 0xEB, 0x62, 0x09, 0x84, 0xED, 0x0C, 0x7B, 0x2A, 0xD2, 0x5B, 0x6E, 0xB6, 0xC9,
+    0x94, 0xEC, 0x7D, 0xC7, 0xA3, 0x3A, 0xD4, 0x6E, 0x5C, 0x8A, 0x9C, 0xA5, 0x86, 0x5B, 0x4C, 0x9A,
+    0xA8, 0xC4, 0x91, 0xF9, 0x5F, 0xB2, 0xEA, 0xF4, 0x6B, 0x21, 0xBD, 0x04, 0xF4, 0xBB, 0xD3, 0xEB,
+    0x4B, 0x63, 0x22, 0xD5, 0x97, 0x8E, 0x89, 0x84, 0x9D, 0x21, 0xA3, 0xBF, 0xBC, 0xFB, 0x4F, 0x29,
+    0xE9, 0x90, 0x72, 0x94, 0xFE, 0x6A, 0x33, 0x36, 0x64, 0xEA, 0xC5, 0xE9, 0x46, 0xEB, 0x72, 0x81,
+    0x79, 0xA2, 0x6A, 0x34, 0xFF, 0x8E, 0x72, 0x5C, 0xA4, 0x8A, 0x19, 0xAE, 0xCE, 0xCC, 0x05, 0x53,
+    0x87, 0xF1, 0x3F, 0xDA, 0x1F, 0x95, 0x55, 0x4F, 0x68, 0x1C, 0x55, 0x18, 0xFF, 0xBD, 0x79, 0x4D,
+    0xC6, 0xEE, 0x74, 0xF7, 0x79, 0x48, 0x20, 0x8D, 0x9B, 0xAC, 0x87, 0x56, 0xB6, 0xB2, 0xC9, 0xE6,
+    0x10, 0x6A, 0x94, 0xD9, 0x9D, 0x69, 0x8A, 0x06, 0x7A, 0x31, 0x87, 0xF6, 0x20, 0x42, 0x2D, 0x22,
+    0x28, 0xA5, 0x68, 0x84, 0x1C, 0x22, 0x4E, 0x77, 0xA7, 0x09, 0xD2, 0x43, 0x2F, 0xB1, 0x27, 0x11,
+    0x0F, 0x41, 0xA4, 0xB4, 0xB1, 0xD2, 0x55, 0x72, 0x58, 0x21, 0xED, 0x4E, 0x92, 0x43, 0x41, 0x0F,
+    0x99, 0xD8, 0x83, 0x60, 0x41, 0xC7, 0xB6, 0x5E, 0x1A, 0xAB, 0xAF, 0xCD, 0x80, 0x6B, 0x99, 0xE4,
+    0xF9, 0xBD, 0x4D, 0x13, 0xD2, 0x82, 0xA0, 0xB3, 0xF3, 0x66, 0xDE, 0x7C, 0xEF, 0xFB, 0xFF, 0xFD,
+    0xBE, 0x6F, 0xB1, 0x3B, 0x05, 0x18, 0x91, 0x04, 0x8A, 0xC2, 0xC5, 0xF6, 0xD5, 0xCC, 0xF1, 0x90,
+    0x07, 0xD2, 0x23, 0x2A, 0x91, 0xE3, 0x07, 0x12, 0xE6, 0x2F, 0x36, 0xE0, 0x28, 0x1F, 0x4C, 0x11,
+    0xB3, 0xD8, 0x20, 0x26, 0x15, 0x6D, 0x52, 0x2C, 0xB5, 0x0E, 0x43, 0xA9, 0x18, 0x8D, 0xEA, 0x95,
+    0x30, 0x77, 0x3B, 0x51, 0x66, 0xE2, 0x2C, 0x25, 0xD8, 0x97, 0x07, 0x26, 0x4A, 0xC0, 0x7C, 0x69,
+    0x5B, 0x2D, 0x63, 0xAE, 0x6B, 0x4E, 0x2D, 0x05, 0xC6, 0x8D, 0xEB, 0x3E, 0xD6, 0x96, 0x81, 0x0F,
+    0xEF, 0x91, 0x8A, 0x26, 0xE9, 0xD3, 0x0E, 0xD0, 0xBB, 0xB1, 0x01, 0xAE, 0x94, 0x2F, 0x6E, 0xAE,
+    0x46, 0xCE, 0xB9, 0xDB, 0xCD, 0x09, 0xBB, 0x5F, 0x1C, 0x99, 0x9C, 0x06, 0xDA, 0xDC, 0x9C, 0x62,
+    0x2C, 0x42, 0x01, 0x82, 0xBD, 0xEE, 0x92, 0xCD, 0x09, 0x98, 0x30, 0x7E, 0x7A, 0xE5, 0x81, 0x6A,
+    0xBE, 0x17, 0x63, 0x6F, 0xCA, 0x9A, 0x5A, 0xFA, 0x35, 0xD6, 0x16, 0xDA, 0x67, 0xE8, 0x00, 0x3E,
+    0x06, 0x8C, 0x58, 0x6F, 0xC2, 0x7E, 0x69, 0x69, 0x7A, 0x35, 0xE9, 0x3C, 0x05, 0x9B, 0x49, 0x33,
+    0xB0, 0x24, 0x29, 0xC9, 0x20, 0xD3, 0x53, 0x71, 0xD6, 0xF5, 0x51, 0xE7, 0xD1, 0x6A, 0x42, 0x94,
+    0x39, 0x23, 0xB4, 0x42, 0x56, 0x47, 0x1A, 0x99, 0xAE, 0x7E, 0x3A, 0x21, 0x5F, 0xD0, 0x86, 0x1C,
+    0x59, 0x6A, 0x5D, 0x31, 0x8E, 0xC6, 0x48, 0xE6, 0x8C, 0xA4, 0xCE, 0x93, 0xBA, 0x95, 0xD4, 0x85,
+    0xE7, 0xE5, 0x6C, 0xAF, 0x54, 0xF2, 0xBC, 0x92, 0x17, 0x97, 0x2A, 0xB2, 0xE4, 0x84, 0x65, 0x27,
+    0xA8, 0x38, 0x6E, 0x05, 0x9D, 0x42, 0x05, 0x5A, 0x64, 0xC6, 0xBA, 0x68, 0xAE, 0xF2, 0xD9, 0xC5,
+    0xEF, 0xBE, 0xBE, 0x71, 0x39, 0x5A, 0xAD, 0x95, 0x63, 0x31, 0xCF, 0x83, 0xBD, 0x29, 0xF4, 0x0B,
+    0x38, 0x5B, 0xA9, 0x8E, 0xF1, 0xC5, 0x93, 0x6A, 0x8B, 0x3B, 0xD5, 0x96, 0xB7, 0xD5, 0xE6, 0x53,
+    0x62, 0x64, 0xE9, 0x07, 0xA9, 0x85, 0xF2, 0xC6, 0x5D, 0xF6, 0x30, 0xB8, 0x5B, 0xFB, 0xE6, 0xF2,
+    0xF8, 0xEA, 0xD0, 0x4B, 0xBF, 0x8B, 0xAB, 0xFC, 0x4F, 0x48, 0x23, 0x88, 0x10, 0x7B, 0x38, 0xD0,
+    0xDD, 0x4A, 0x73, 0x63, 0xDA, 0x78, 0x78, 0xCD, 0x88, 0x4D, 0x19, 0xE3, 0xB4, 0x07, 0xF1, 0x15,
+    0x15, 0xCD, 0x85, 0x13, 0x40, 0xC4, 0xE0, 0xF7, 0xC0, 0x56, 0x43, 0x34, 0xD5, 0x97, 0x49, 0x51,
+    0x29, 0x2A, 0x1B, 0x9E, 0xD1, 0xB5, 0x44, 0x9F, 0x10, 0x23, 0x8B, 0x1F, 0xCF, 0xB4, 0xC4, 0xD7,
+    0x8D, 0x95, 0x28, 0xCC, 0x8E, 0xF1, 0x53, 0x58, 0xC5, 0x8B, 0x61, 0x6F, 0xF9, 0x8A, 0xA5, 0xFC,
+    0xAA, 0xCB, 0xAE, 0xB9, 0x42, 0xC9, 0x7E, 0xD4, 0x3D, 0xD8, 0x13, 0xE8, 0x6B, 0xA8, 0x8D, 0x6F,
+    0xD1, 0x37, 0x81, 0x52, 0x05, 0xF3, 0x45, 0xD5, 0xA4, 0x23, 0xA3, 0x95, 0xAD, 0xF6, 0x26, 0x7B,
+    0x28, 0x87, 0xF8, 0x75, 0xB7, 0x50, 0x55, 0xF4, 0x18, 0xE2, 0x4B, 0x77, 0x9B, 0x39, 0x85, 0xA2,
+    0xDF, 0x3E, 0xEC, 0x5B, 0x53, 0x81, 0x38, 0x1B, 0x62, 0xC7, 0xF5, 0x1F, 0x95, 0xF6, 0x09, 0xC2,
+    0xE8, 0xF3, 0xDD, 0x5B, 0x52, 0xFF, 0x6A, 0xE3, 0xAD, 0x3C, 0xEA, 0x36, 0x92, 0xD3, 0x8F, 0xF8,
+    0x8C, 0x0D, 0xE4, 0x46, 0x42, 0x1B, 0x72, 0x8C, 0x00, 0x43, 0xF5, 0x9F, 0x9D, 0x67, 0x2A, 0xA1,
+    0x0D, 0xDD, 0xEB, 0x2C, 0x69, 0xA8, 0xD8, 0x51, 0xD2, 0x52, 0xBA, 0x18, 0x5D, 0x29, 0xBE, 0x22,
+    0xCB, 0xC5, 0x4D, 0xB1, 0x86, 0xBF, 0xCF, 0x72, 0x89, 0xCB, 0x08, 0x04, 0x21, 0x7B, 0x01, 0x5E,
+    0x51, 0x11, 0x0D, 0x9D, 0x86, 0x6A, 0x61, 0x0C, 0x27, 0xD8, 0x59, 0x77, 0xC8, 0xE6, 0x67, 0xA2,
+    0x39, 0x21, 0x30, 0x21, 0x39, 0x59, 0x09, 0x91, 0xC0, 0x0A, 0xD0, 0x44, 0x15, 0xD5, 0xD0, 0x8C,
+    0x34, 0x97, 0x6A, 0xB6, 0x6D, 0x77, 0xD4, 0x20, 0xBB, 0x11, 0x14, 0x7A, 0xA9, 0xA3, 0x86, 0xCC,
+    0x73, 0xAE, 0x2D, 0x99, 0x82, 0x88, 0x50, 0x81, 0x19, 0xC2, 0x43, 0xCE, 0x77, 0x24, 0xD7, 0x78,
+    0x23, 0x1C, 0x53, 0x94, 0xE5, 0x5C, 0x4B, 0x22, 0x85, 0xFC, 0x20, 0x9F, 0x0A, 0xC6, 0x7B, 0x2D,
+    0x57, 0x4A, 0x73, 0x19, 0x4E, 0xC4, 0xD6, 0x21, 0x02, 0xCC, 0x43, 0xF8, 0xA6, 0x34, 0xD7, 0x49,
+    0x1A, 0x19, 0x8B, 0xC9, 0xB8, 0x3B, 0xE5, 0xFE, 0x2F, 0x23, 0xCC, 0x6F, 0x27, 0xAC, 0x1B, 0xD3,
+    0xA9, 0xAD, 0x5C, 0xA2, 0x8B, 0x85, 0x19, 0xD8, 0xDC, 0x37, 0x27, 0x43, 0x48, 0x89, 0x5E, 0x1B,
+    0x14, 0x11, 0xAA, 0xAE, 0x36, 0x67, 0x10, 0xE4, 0x9A, 0x60, 0x09, 0xC8, 0x22, 0xD3, 0xF2, 0x2E,
+    0x43, 0x8D, 0x2F, 0x48, 0xD3, 0xDF, 0x59, 0x45, 0x32, 0x1D, 0x0A, 0xD4, 0x58, 0x64, 0xC3, 0xCE,
+    0x80, 0xAC, 0x63, 0x2D, 0x40, 0x4E, 0x42, 0x5B, 0x24, 0x3F, 0x73, 0x2E, 0xCC, 0x00, 0x94, 0x15,
+    0x47, 0x6A, 0x97, 0xF4, 0x65, 0xF7, 0x0A, 0x6B, 0xF1, 0x7C, 0x0B, 0x6E, 0x05, 0xDC, 0xC4, 0xC1,
+    0x20, 0x5D, 0xE3, 0xA7, 0xD8, 0x2A, 0x3E, 0x88, 0x2A, 0x8E, 0x9A, 0xFC, 0x3B, 0xA2, 0x7A, 0xF5,
+    0xC2, 0xF4, 0xF3, 0xBB, 0xED, 0x5C, 0xA9, 0x55, 0x95, 0x5D, 0xD8, 0xB3, 0xBB, 0xF5, 0x4B, 0x67,
+    0xDE, 0x35, 0xFF, 0xD0, 0x1D, 0x5C, 0x55, 0xC7, 0x8F, 0x8D, 0xB8, 0x46, 0x88, 0x39, 0xF4, 0xC3,
+    0xF2, 0x8D, 0x08, 0x75, 0xBD, 0x09, 0xA8, 0xF3, 0xDB, 0x29, 0x4A, 0xE8, 0xC9, 0x12, 0x72, 0x37,
+    0x8D, 0x41, 0x44, 0xDC, 0x17, 0x78, 0x8A, 0x28, 0x7C, 0x21, 0x04, 0x5F, 0x8C, 0xD0, 0x3E, 0x39,
+    0xB3, 0xD3, 0xFD, 0x8E, 0x01, 0xC0, 0xDB, 0xB9, 0x06, 0x69, 0xD1, 0x5C, 0xF2, 0xC6, 0x05, 0x2D,
+    0xAE, 0x97, 0xEB, 0x8D, 0xE7, 0xE0, 0x55, 0x15, 0x4E, 0x57, 0x9B, 0xB8, 0xBA, 0x85, 0xE5, 0x60,
+    0x5B, 0x45, 0x0D, 0x59, 0xBA, 0xE7, 0x90, 0xAD, 0xDE, 0xC9, 0x8E, 0xF7, 0x64, 0xC7, 0xCD, 0xEC,
+    0xB8, 0x95, 0xAD, 0x5C, 0xCB, 0x3A, 0xCD, 0x42, 0xAB, 0xBD, 0x20, 0xE8, 0x67, 0x93, 0x9F, 0x75,
+    0x10, 0xD2, 0xC0, 0xD6, 0x42, 0x8D, 0x33, 0xF2, 0x11, 0x9B, 0x8B, 0x86, 0x86, 0xF1, 0x57, 0x04,
+    0xF3, 0x56, 0x4C, 0x69, 0x4F, 0x50, 0x74, 0xAB, 0x73, 0x15, 0x14, 0x09, 0xAC, 0xD6, 0x1D, 0x2D,
+    0xFF, 0xAC, 0x81, 0x5A, 0x01, 0x2B, 0x01, 0xFB, 0x59, 0x97, 0xC4, 0xF2, 0xA9, 0x3C, 0x7C, 0x19,
+    0x7D, 0x39, 0x16, 0x15, 0x43, 0x8A, 0x1A, 0x38, 0x79, 0xA9, 0xB1, 0xD1, 0x5A, 0xB3, 0x97, 0x1A,
+    0x6A, 0xFD, 0xE4, 0xEC, 0x05, 0xA5, 0xE7, 0x34, 0x4E, 0xCE, 0xCE, 0x5E, 0xA2, 0x3E, 0x57, 0xAD,
+    0xA6, 0x7B, 0xEC, 0x63, 0x6C, 0x6F, 0xF0, 0x36, 0xFB, 0x2C, 0x35, 0x76, 0x20, 0xB8, 0x60, 0x7C,
+    0x92, 0x3A, 0xF1, 0x9C, 0xFF, 0xA9, 0xF1, 0x4E, 0x7A, 0xE6, 0xA0, 0x1F, 0xB6, 0xF8, 0x88, 0xED,
+    0x51, 0x6C, 0x0D, 0xA5, 0xBA, 0x67, 0x67, 0xFD, 0x0E, 0xB1, 0x28, 0x3D, 0x31, 0x3C, 0xDD, 0x66,
+    0xAE, 0x48, 0xAF, 0x9C, 0x72, 0xF5, 0x7B, 0x9E, 0xDE, 0x5B, 0xF4, 0x8E, 0x0E, 0xB1, 0x3C, 0xB9,
+    0x26, 0xBD, 0x79, 0xF1, 0x86, 0x71, 0x7E, 0xBA, 0xAD, 0xCD, 0xFC, 0x71, 0xE5, 0x3E, 0x7D, 0x95,
+    0xCB, 0xA9, 0x23, 0xDB, 0xBC, 0x8E, 0x63, 0x7D, 0xBF, 0x70, 0x5F, 0x96, 0x4A, 0x44, 0x43, 0x80,
+    0x01, 0xEC, 0x01, 0x47, 0x6B, 0x93, 0x1E, 0x55, 0xAA, 0x33, 0xA4, 0x4A, 0xA5, 0xC1, 0x5D, 0x3C,
+    0xB1, 0x31, 0x5C, 0x3C, 0xAD, 0x3D, 0x09, 0x69, 0xBF, 0xE3, 0xF1, 0xDB, 0x61, 0x95, 0x74, 0xEC,
+    0xA4, 0x1D, 0x1F, 0xA5, 0x3E, 0xCD, 0x00, 0xD1, 0xE6, 0x83, 0x00, 0xAE, 0xC5, 0xD8, 0x31, 0x97,
+    0xC8, 0x2A, 0xE1, 0x4A, 0x0A, 0x15, 0x56, 0xD5, 0xB0, 0xDA, 0x10, 0xAA, 0xE9, 0xA8, 0xFB, 0x3A,
+    0xC2, 0xBC, 0x75, 0xAB, 0x49, 0x48, 0xE8, 0x2A, 0x95, 0xF5, 0x6D, 0xF8, 0xFB, 0x62, 0xC1, 0x6E,
+    0x47, 0x25, 0x2B, 0x78, 0x93, 0xA2, 0x1F, 0x1D, 0xE5, 0xBB, 0x46, 0xF3, 0xFB, 0xDD, 0xE0, 0xB5,
+    0x94, 0x9E, 0x20, 0xE4, 0x4F, 0x41, 0x9B, 0xB1, 0x80, 0xF7, 0x5F, 0xE6, 0x1F, 0x1D, 0xCD, 0xEE,
+    0x9F, 0x89, 0x3E, 0xD7, 0x30, 0xDB, 0x4E, 0xC9, 0x63, 0x41, 0x6B, 0x8F, 0x07, 0x86, 0xF2, 0x96,
+    0x79, 0xF8, 0x4C, 0x18, 0xC9, 0x7C, 0x57, 0x76, 0xB3, 0xAD, 0x59, 0x58, 0xE0, 0xFA, 0x6C, 0x60,
+    0xC6, 0xAE, 0xF5, 0xD8, 0xED, 0xE9, 0xCD, 0x29, 0x78, 0x26, 0x08, 0xFB, 0x7A, 0xA8, 0x83, 0x6A,
+    0x83, 0x7C, 0xF8, 0x90, 0x4E, 0x3C, 0x77, 0x5F, 0x38, 0x7C, 0xD6, 0xC5, 0xA1, 0x95, 0x95, 0xD0,
+    0x33, 0x83, 0xF1, 0x5D, 0x6E, 0xC1, 0x08, 0x7B, 0xC4, 0xAB, 0x23, 0x2E, 0xC9, 0x9E, 0xA0, 0xFF,
+    0x54, 0x71, 0x48, 0xF2, 0xA8, 0x49, 0xB3, 0xDD, 0xA7, 0xE6, 0xAA, 0xF0, 0x08, 0x2C, 0x4E, 0xD0,
+    0x65, 0x29, 0xF0, 0xD0, 0x09, 0x26, 0xCA, 0x3C, 0x21, 0x88, 0x28, 0x79, 0x11, 0xC5, 0x2B, 0x01,
+    0x2C, 0xA9, 0x60, 0x24, 0xD4, 0x8B, 0x0D, 0x57, 0x44, 0xC5, 0x48, 0x56, 0x7D, 0xE8, 0x19, 0xC3,
+    0x74, 0x0B, 0xFC, 0x03, 0x75, 0x55, 0x5D, 0x68, 0x1C, 0xD7, 0x15, 0xFE, 0xEE, 0xBD, 0x2B, 0xDD,
+    0xB5, 0x46, 0xBB, 0xA3, 0x82, 0x5C, 0x14, 0x67, 0xED, 0xB5, 0xC1, 0x0F, 0x8A, 0xBA, 0xF2, 0xAC,
+    0xA8, 0x0A, 0x0B, 0x59, 0x69, 0xC7, 0x0E, 0xC5, 0x81, 0x34, 0xAD, 0x4A, 0xEB, 0x97, 0xE4, 0xC1,
+    0x4A, 0x0A, 0xA1, 0x4D, 0xA1, 0xD9, 0x24, 0x4B, 0x10, 0x44, 0x8E, 0xAE, 0xE3, 0x34, 0x7E, 0x48,
+    0xC0, 0xEA, 0x43, 0x5E, 0x9A, 0x16, 0x14, 0x92, 0x40, 0xA4, 0x3E, 0x78, 0x0B, 0x7E, 0x10, 0x25,
+    0xCA, 0x1E, 0xC5, 0xD0, 0x85, 0x24, 0x84, 0xDB, 0x3A, 0x90, 0xC7, 0x0E, 0xC6, 0x21, 0x10, 0x15,
+    0x67, 0x4A, 0x16, 0xB2, 0x72, 0x76, 0xF7, 0xE6, 0xCC, 0xAC, 0xF2, 0xF3, 0xD2, 0xD9, 0x3B, 0xF7,
+    0xCE, 0x9C, 0xB9, 0xE7, 0x9C, 0x3D, 0xDF, 0xF9, 0xCE, 0xB9, 0x42, 0x50, 0xB3, 0xE4, 0x29, 0x8A,
+    0xAB, 0x7E, 0x32, 0x8D, 0x88, 0xFB, 0xE2, 0x5E, 0x0D, 0x98, 0x80, 0x07, 0xAF, 0xAB, 0x3E, 0x8F,
+    0x8F, 0x7F, 0x65, 0xFC, 0x2A, 0xBE, 0xA0, 0x64, 0x32, 0x7E, 0x8C, 0x3E, 0x02, 0x23, 0x63, 0x04,
+    0xE0, 0xE9, 0x1E, 0xF0, 0xB5, 0x08, 0x15, 0xA1, 0x06, 0x1D, 0xE3, 0xF1, 0xCD, 0xD6, 0x00, 0xD2,
+    0x3C, 0xFD, 0xEA, 0xD9, 0x0E, 0xCB, 0x45, 0x88, 0xC7, 0xD6, 0x51, 0x85, 0xFA, 0x1D, 0x60, 0xB0,
+    0x94, 0x7D, 0xE8, 0xB1, 0x6D, 0x5F, 0x46, 0x7B, 0x8F, 0x1E, 0x5F, 0xCA, 0x60, 0x78, 0x1D, 0x82,
+    0x20, 0x94, 0x31, 0x06, 0x10, 0x2A, 0xD0, 0x80, 0x45, 0x09, 0x3A, 0x44, 0xC4, 0x8B, 0x32, 0xC3,
+    0x3D, 0x41, 0xA4, 0xF7, 0xD5, 0x5E, 0xFC, 0x8F, 0x9D, 0xAC, 0xBC, 0x19, 0xAE, 0x42, 0x11, 0xAE,
+    0xC1, 0x87, 0xB0, 0x6C, 0xD8, 0x83, 0x88, 0x78, 0xF1, 0x21, 0xAD, 0xE8, 0xE0, 0x39, 0x04, 0xA1,
+    0x8E, 0xB0, 0x8D, 0x22, 0x64, 0x84, 0x55, 0x78, 0x46, 0xC4, 0x98, 0x84, 0x18, 0x9A, 0x19, 0x2A,
+    0x24, 0xA2, 0x19, 0x8C, 0xA6, 0xA6, 0xE5, 0x00, 0x6C, 0x77, 0xD2, 0x9C, 0xCA, 0x43, 0x5D, 0x37,
+    0x88, 0xD9, 0x54, 0x05, 0xC7, 0xF2, 0xF0, 0xB5, 0x29, 0x9E, 0x8E, 0x02, 0xB3, 0xE2, 0x99, 0x63,
+    0x32, 0xF2, 0xCC, 0xB6, 0x8C, 0xA6, 0xD9, 0x0E, 0x26, 0xC5, 0xBA, 0x1F, 0x6E, 0x6B, 0xBB, 0x28,
+    0xBB, 0xA9, 0x7A, 0x1F, 0x7A, 0x2F, 0x3A, 0x64, 0x16, 0x34, 0xF4, 0xF3, 0x84, 0xA8, 0x89, 0x95,
+    0x12, 0x4A, 0x3E, 0x8E, 0x29, 0x2A, 0x22, 0xAE, 0xA1, 0xEA, 0x83, 0xF1, 0x64, 0x44, 0x11, 0x9F,
+    0x04, 0x07, 0x3C, 0x22, 0x8D, 0x4F, 0xB1, 0x8A, 0x17, 0xD0, 0x4B, 0xD4, 0x97, 0x90, 0x4B, 0x82,
+    0x9F, 0x86, 0x0A, 0x51, 0xF7, 0x1E, 0x40, 0x27, 0x1A, 0x7B, 0x30, 0x11, 0x54, 0x93, 0xC0, 0xEB,
+    0x1C, 0x1A, 0x83, 0x70, 0x74, 0x45, 0xBE, 0x4F, 0xD5, 0xB7, 0x58, 0xD0, 0xE0, 0x20, 0x13, 0x01,
+    0x24, 0x61, 0x3E, 0x51, 0xCF, 0x64, 0x4F, 0xFF, 0xF4, 0xD1, 0xA7, 0xAE, 0x50, 0x08, 0x61, 0x36,
+    0x5E, 0x5E, 0x33, 0x34, 0x93, 0x95, 0x78, 0x4B, 0x5E, 0xB1, 0x18, 0xCD, 0xCA, 0x3F, 0xFD, 0x73,
+    0xEE, 0x25, 0xC2, 0x4C, 0x78, 0x7C, 0x2A, 0xA7, 0x04, 0x2D, 0x67, 0xB2, 0xBF, 0x9A, 0x5C, 0x2D,
+    0xFF, 0xE5, 0xC9, 0x8D, 0x91, 0xEC, 0x2B, 0xD9, 0xF6, 0x31, 0xFA, 0x4D, 0x8C, 0x09, 0xE5, 0xEC,
+    0x22, 0xE7, 0x7C, 0xBE, 0xAA, 0x2E, 0x51, 0xA5, 0xAA, 0xDA, 0x54, 0x5D, 0xE5, 0x69, 0x55, 0x84,
+    0x27, 0x9E, 0x3F, 0x33, 0xFE, 0xC7, 0x1F, 0xFF, 0x96, 0x5E, 0xBF, 0xFC, 0x40, 0xCF, 0xB3, 0x19,
+    0x0F, 0x54, 0x1E, 0xD7, 0xBA, 0x73, 0x57, 0x66, 0x7D, 0x2A, 0xE7, 0xF9, 0xF7, 0x75, 0x0F, 0x63,
+    0x69, 0xB2, 0x24, 0x5E, 0x78, 0x3D, 0xFE, 0xC6, 0x71, 0x79, 0x26, 0x23, 0xD8, 0xF3, 0x79, 0xC2,
+    0xE8, 0xFD, 0xEC, 0x79, 0xF9, 0x83, 0x47, 0xE2, 0x99, 0x70, 0xF9, 0xE4, 0xD0, 0xB3, 0x9C, 0x9C,
+    0xBB, 0x18, 0x97, 0xDB, 0x85, 0x23, 0xF8, 0xCE, 0x37, 0x4D, 0x2B, 0x34, 0x73, 0x82, 0x4A, 0xCA,
+    0xCC, 0xAB, 0xB0, 0xA1, 0x43, 0x9E, 0x2B, 0x8A, 0x4A, 0xC2, 0xFA, 0x68, 0x6A, 0x53, 0x45, 0x38,
+    0x2F, 0x28, 0x87, 0x26, 0x4B, 0x25, 0x15, 0x60, 0xF3, 0x88, 0xF2, 0xB0, 0xA9, 0x02, 0x55, 0xBC,
+    0x30, 0x66, 0x80, 0x27, 0xD3, 0x94, 0xEA, 0x1C, 0xBC, 0x71, 0xE4, 0x4B, 0xF0, 0xFB, 0x68, 0xF5,
+    0x65, 0xAF, 0xAE, 0xBB, 0x4D, 0xBF, 0x11, 0x15, 0xEB, 0xF6, 0xD4, 0xDF, 0x69, 0xF6, 0x26, 0xD5,
+    0x6E, 0x98, 0xDA, 0xF5, 0x30, 0xF8, 0x18, 0x45, 0xD7, 0xF7, 0x5D, 0x5F, 0xBB, 0xBE, 0xD7, 0xDA,
+    0xE7, 0xED, 0xB9, 0x0A, 0x0A, 0xF3, 0xC8, 0x4C, 0xA4, 0x46, 0xBC, 0x3E, 0xD6, 0xFA, 0xB2, 0x03,
+    0x4D, 0xF0, 0x43, 0xA6, 0x0E, 0x4E, 0xF1, 0x10, 0xFF, 0x3D, 0x25, 0xBA, 0x35, 0x41, 0xC1, 0xBB,
+    0x34, 0xD4, 0x55, 0x8E, 0x5D, 0xEC, 0x1F, 0xB0, 0x76, 0x09, 0xB5, 0xAE, 0xB2, 0x8D, 0x1C, 0x38,
+    0x15, 0xE2, 0xCE, 0x1B, 0x9E, 0x8B, 0x38, 0x43, 0x4F, 0x6C, 0x0A, 0xD7, 0xE3, 0x3C, 0x49, 0xCB,
+    0x44, 0x54, 0xEE, 0x4D, 0x56, 0xE2, 0xAD, 0xA1, 0x8C, 0x44, 0xA4, 0x62, 0xBE, 0xBB, 0x32, 0x52,
+    0x3D, 0xBE, 0x6F, 0xF3, 0xFD, 0x1F, 0x65, 0xF5, 0xFB, 0x97, 0xEC, 0x9A, 0x73, 0xEE, 0xEE, 0x4F,
+    0xBF, 0xFC, 0xC4, 0xDB, 0xFD, 0xC2, 0x7A, 0xF4, 0x15, 0x79, 0xB4, 0xC6, 0x77, 0x8D, 0x7C, 0x2A,
+    0x92, 0x72, 0xEB, 0xE2, 0xCE, 0x3B, 0x68, 0xA8, 0xEB, 0x8E, 0xFF, 0xB6, 0x59, 0x90, 0xB6, 0x88,
+    0x96, 0x0B, 0x03, 0x17, 0x7A, 0x26, 0xA1, 0x37, 0x98, 0x83, 0x5C, 0xA4, 0x3E, 0x41, 0xC5, 0x48,
+    0x18, 0x75, 0x24, 0x44, 0x82, 0x03, 0x14, 0x33, 0x84, 0x73, 0x06, 0x94, 0xF9, 0xFF, 0x8D, 0x7B,
+    0x08, 0x2E, 0x39, 0x9A, 0x0D, 0x1D, 0x1D, 0x42, 0x6D, 0x5B, 0x9A, 0xBC, 0xC6, 0x73, 0xFA, 0xA2,
+    0x1D, 0xFD, 0x5F, 0x54, 0x61, 0x76, 0x15, 0xC5, 0xAB, 0xE7, 0x35, 0xB9, 0x8F, 0x77, 0xE3, 0x20,
+    0xCA, 0x31, 0x11, 0x2D, 0xCA, 0x79, 0xAE, 0xC2, 0x0D, 0x26, 0xE4, 0xA8, 0xA7, 0x9C, 0xEB, 0xFD,
+    0xE8, 0xEA, 0xE7, 0x66, 0xAE, 0x6B, 0xD5, 0x1F, 0x3E, 0xC0, 0xBD, 0x7F, 0x25, 0xD5, 0xED, 0x21,
+    0xF8, 0x05, 0xC9, 0xB8, 0x8B, 0x22, 0x57, 0x52, 0xD4, 0xC0, 0x61, 0x4E, 0x82, 0xB3, 0x99, 0x0B,
+    0xE7, 0x4F, 0xB7, 0xC3, 0x52, 0xA1, 0x8E, 0xDD, 0xF6, 0x68, 0xAE, 0x50, 0x6F, 0xFE, 0xAB, 0xAD,
+    0x79, 0xA9, 0x8B, 0xB6, 0x46, 0xA1, 0xBE, 0xA0, 0xDA, 0x60, 0x64, 0xC4, 0x55, 0x4A, 0x1A, 0xC2,
+    0x18, 0x63, 0x63, 0x46, 0x6E, 0xC9, 0x2F, 0xC3, 0xD9, 0x1D, 0x50, 0x47, 0x4B, 0x5B, 0xF2, 0xB0,
+    0x72, 0x01, 0xAE, 0x83, 0x9D, 0xF5, 0x73, 0xE7, 0xCE, 0xB8, 0x41, 0x0A, 0xF1, 0xE3, 0xC6, 0x73,
+    0xB8, 0x90, 0xE1, 0x58, 0x7C, 0xA6, 0x6A, 0xCC, 0xD4, 0x57, 0x2F, 0x08, 0xD7, 0xE5, 0xEA, 0x40,
+    0x9C, 0xF4, 0x1D, 0xED, 0x48, 0x3B, 0xE0, 0xD7, 0x2E, 0xB9, 0x06, 0x89, 0x98, 0xC7, 0x22, 0xA1,
+    0x15, 0x6A, 0x76, 0x95, 0x3E, 0x28, 0x7E, 0x58, 0x05, 0x86, 0xE3, 0x02, 0xE0, 0x6E, 0x71, 0xBD,
+    0x76, 0xB8, 0x84, 0xE2, 0x23, 0x83, 0xBF, 0x75, 0x7F, 0x7F, 0xE7, 0xEA, 0x86, 0x17, 0xBE, 0x8D,
+    0xC0, 0x59, 0xE6, 0x4E, 0x8A, 0x28, 0x03, 0xCB, 0xAD, 0x2C, 0x05, 0x33, 0xC1, 0x94, 0xA1, 0x4D,
+    0x10, 0x4E, 0xDB, 0x18, 0x97, 0x29, 0xB7, 0x35, 0x8C, 0x72, 0xA6, 0xDD, 0x1E, 0x7A, 0xD3, 0x28,
+    0x9E, 0xE1, 0x16, 0x38, 0x8D, 0x45, 0x69, 0x54, 0x74, 0x92, 0x97, 0x8F, 0x64, 0x14, 0x0C, 0x02,
+    0x79, 0xF6, 0x66, 0x3C, 0x5F, 0xF1, 0x6F, 0x9C, 0x25, 0xC6, 0x8E, 0xF1, 0x23, 0xCF, 0xAD, 0x27,
+    0xF5, 0x3D, 0x2C, 0x59, 0x48, 0x7E, 0xF3, 0xD9, 0xDF, 0x44, 0x91, 0x4D, 0x33, 0xD9, 0x30, 0xCB,
+    0xC2, 0x6B, 0x1E, 0x47, 0xF0, 0xE7, 0xAD, 0xAD, 0xCD, 0x74, 0x83, 0x73, 0x7B, 0x83, 0xAD, 0xAD,
+    0xF3, 0xB7, 0x7E, 0x88, 0x1A, 0x87, 0x55, 0x63, 0x0E, 0xDD, 0xED, 0xA2, 0x54, 0x99, 0x40, 0x5E,
+    0x37, 0xF8, 0xA8, 0x4A, 0x8D, 0xF4, 0xB7, 0x42, 0x8B, 0x36, 0xE8, 0xE9, 0x3E, 0x8C, 0x3B, 0x80,
+    0x0C, 0xAC, 0xBC, 0xB5, 0xB3, 0x79, 0x80, 0xC5, 0xB7, 0x63, 0xF5, 0x7B, 0x83, 0x51, 0x40, 0x6B,
+    0xC0, 0xA0, 0xDA, 0x64, 0x6E, 0x85, 0x0C, 0x12, 0x09, 0x2B, 0x62, 0xFE, 0x25, 0xFD, 0x3A, 0x42,
+    0x7E, 0x0A, 0xCE, 0xAC, 0x99, 0xB1, 0xD8, 0xF8, 0x3D, 0xB9, 0x8F, 0x96, 0xA4, 0xF8, 0x9A, 0xBF,
+    0x83, 0xFD, 0x03, 0xDA, 0xCB, 0x10, 0x79, 0x08, 0x67, 0x7C, 0x17, 0x3E, 0x73, 0x45, 0xBE, 0x57,
+    0xF2, 0xA6, 0xEA, 0xD3, 0x8F, 0xD0, 0x6B, 0x97, 0xE5, 0xE5, 0x82, 0x57, 0xA8, 0x97, 0x9E, 0x24,
+    0x2E, 0x0C, 0xE8, 0xCF, 0x3A, 0x4C, 0x5B, 0xD2, 0xE1, 0x2C, 0x1A, 0x92, 0xBC, 0x70, 0xB5, 0xE8,
+    0xDC, 0x45, 0xE7, 0xEC, 0x48, 0x17, 0xF2, 0xEA, 0x67, 0x1C, 0x53, 0x9C, 0x42, 0xDB, 0xC3, 0x37,
+    0x0B, 0x9F, 0x0D, 0xDC, 0xF9, 0x1B, 0x49, 0xDF, 0x5B, 0x38, 0xF7, 0x4B, 0xE7, 0xFE, 0x4D, 0xC9,
+    0x63, 0x32, 0x86, 0x71, 0x1D, 0x4F, 0x4E, 0x96, 0x67, 0xAF, 0x79, 0x3F, 0x6B, 0x34, 0xCA, 0x75,
+    0xC6, 0x81, 0xC5, 0xE3, 0x4C, 0xEF, 0x04, 0x12, 0x9C, 0x04, 0x9A, 0xE9, 0x88, 0x0E, 0x9F, 0xBB,
+    0xC9, 0x80, 0x73, 0x7A, 0xF9, 0x0C, 0xC9, 0x83, 0x39, 0x9C, 0x5C, 0xE9, 0xA6, 0x83, 0xFD, 0x82,
+    0x76, 0xDF, 0xBD, 0x71, 0x54, 0xDC, 0xB6, 0xA2, 0x97, 0xB8, 0xE4, 0xDA, 0x84, 0xE5, 0xEE, 0x22,
+    0xCD, 0x06, 0x2A, 0x5C, 0x89, 0x3F, 0xE7, 0x04, 0x5B, 0x49, 0xE3, 0xDC, 0x82, 0x91, 0x7E, 0xDC,
+    0xC6, 0x6D, 0xBA, 0x51, 0x98, 0xD8, 0x65, 0x23, 0xE3, 0x6C, 0x63, 0x89, 0xF2, 0x73, 0x34, 0xE0,
+    0xFA, 0xE4, 0x4F, 0x33, 0x83, 0xE2, 0x2B, 0x3A, 0x12, 0x1F, 0x62, 0x39, 0x9A, 0xCE, 0x8F, 0x31,
+    0x6E, 0xD9, 0xDA, 0xA6, 0x78, 0x98, 0x54, 0xAC, 0x5E, 0x56, 0x97, 0x94, 0xB9, 0x6E, 0x7E, 0x62,
+    0xF8, 0xF8, 0x3C, 0x8A, 0xD3, 0xB6, 0x5C, 0x2A, 0xC8, 0x36, 0x16, 0x99, 0x25, 0xAE, 0x93, 0x72,
+    0x69, 0x52, 0xBD, 0x27, 0x77, 0x77, 0x69, 0xCE, 0xE6, 0x2C, 0x1F, 0x9A, 0xAE, 0x3B, 0xF4, 0x25,
+    0xD2, 0x90, 0xB9, 0xE7, 0x07, 0x6E, 0x50, 0x07, 0x1F, 0x85, 0xCC, 0x93, 0x81, 0x36, 0x89, 0x9C,
+    0xBF, 0xE2, 0x07, 0x2C, 0xAA, 0x63, 0xB1, 0x88, 0x85, 0x17, 0x9B, 0xA5, 0x13, 0x2F, 0x15, 0xB2,
+    0xCB, 0x1B, 0x72, 0x0A, 0x78, 0x11, 0x38, 0x61, 0x90, 0x5D, 0xC6, 0xC1, 0x0B, 0x9F, 0x74, 0x6A,
+    0xA8, 0xD3, 0x6C, 0x25, 0x96, 0x19, 0x86, 0x52, 0x8B, 0xFD, 0xF2, 0xD1, 0x97, 0xC8, 0xF1, 0x7F,
+    0xAE, 0xAF, 0x01, 0x6D, 0x91, 0xBD, 0x4E, 0x14, 0x51, 0x14, 0xC7, 0x7F, 0x33, 0xD7, 0x30, 0x2B,
+    0x83, 0x0C, 0x1A, 0x43, 0x88, 0x7C, 0xAB, 0x85, 0xC5, 0xE2, 0x76, 0x66, 0x8B, 0x5D, 0xB8, 0x8F,
+    0x80, 0x3E, 0x01, 0x3E, 0x01, 0x14, 0x5B, 0x50, 0x10, 0xB8, 0x12, 0x83, 0x05, 0x0D, 0x0D, 0xA5,
+    0x89, 0x31, 0x56, 0x16, 0xB0, 0x31, 0x14, 0xC4, 0xC8, 0xEE, 0x28, 0x85, 0x89, 0xD5, 0xF0, 0x00,
+    0x26, 0xD7, 0x68, 0x42, 0x62, 0x4C, 0x1C, 0x93, 0x31, 0xD9, 0xC0, 0x32, 0xD7, 0x33, 0x13, 0xE9,
+    0x38, 0xC9, 0xBD, 0xE7, 0xFB, 0xFC, 0xCF, 0x07, 0xB3, 0x9A, 0xCA, 0x12, 0xFE, 0x18, 0x6C, 0xC1,
+    0xAC, 0x11, 0x25, 0xF0, 0xC7, 0xEE, 0xA7, 0x5B, 0x73, 0xD1, 0xD3, 0x97, 0xF4, 0xD6, 0x18, 0x9E,
+    0x80, 0xE7, 0x94, 0xA4, 0x47, 0x98, 0x50, 0x46, 0x99, 0x09, 0xDA, 0xB4, 0x6B, 0xCE, 0xBD, 0x80,
+    0xE1, 0x3A, 0x7E, 0xEC, 0x5C, 0x1A, 0x98, 0xC9, 0xC2, 0x57, 0x84, 0xB0, 0x44, 0x60, 0x69, 0xA5,
+    0xE1, 0xA7, 0xC3, 0x47, 0x95, 0x95, 0xCA, 0x0C, 0x33, 0x86, 0x4D, 0x6E, 0x55, 0x6E, 0xF6, 0xEF,
+    0x9D, 0xA4, 0x3D, 0xCE, 0x35, 0x19, 0xFF, 0x29, 0x93, 0x64, 0x86, 0x20, 0xBE, 0x36, 0x14, 0xFD,
+    0x3D, 0xFE, 0xF8, 0xAB, 0x15, 0x6E, 0xD3, 0x6A, 0x07, 0xC1, 0x89, 0x5D, 0xE8, 0xD3, 0xD1, 0x65,
+    0xCC, 0x40, 0xAE, 0x93, 0xF0, 0xE7, 0x85, 0x0D, 0x93, 0xC8, 0xAA, 0xC4, 0xCB, 0xBC, 0x94, 0x9C,
+    0x03, 0x4E, 0x4D, 0x13, 0x9B, 0x46, 0xD8, 0x86, 0x8A, 0x6D, 0xC4, 0x81, 0x0D, 0x4C, 0xCD, 0x2A,
+    0xAB, 0xF2, 0xFD, 0x14, 0xE7, 0xFA, 0xFC, 0x96, 0x67, 0x97, 0x7B, 0x8C, 0x5C, 0x62, 0x35, 0x61,
+    0x1D, 0xCE, 0xF1, 0x4E, 0x8D, 0x3A, 0x8E, 0x83, 0x67, 0x36, 0xD2, 0xE9, 0x34, 0x87, 0x4D, 0x1A,
+    0x6B, 0xCC, 0x77, 0xDE, 0x76, 0xBB, 0xCE, 0x75, 0xDD, 0x1F, 0xBB, 0x7A, 0x43, 0x99, 0xA4, 0x7E,
+    0xD5, 0x77, 0xDD, 0xD7, 0x57, 0x3B, 0xA6, 0x82, 0x6D, 0xC9, 0xCD, 0x57, 0x18, 0x63, 0x10, 0xDF,
+    0xB0, 0xC3, 0x8E, 0x32, 0xC3, 0xD4, 0xE9, 0xE6, 0xDD, 0x5C, 0x90, 0x6F, 0x6F, 0x14, 0xBF, 0xE7,
+    0x62, 0x1A, 0xA0, 0x64, 0xAA, 0x36, 0x44, 0x62, 0xB0, 0x30, 0x27, 0x86, 0x18, 0xD6, 0xF0, 0x22,
+    0xC3, 0x6A, 0x86, 0x72, 0x30, 0x2D, 0xF6, 0x0B, 0x08, 0xED, 0x51, 0xB4, 0xF7, 0xFE, 0x33, 0xD9,
+    0x1D, 0x53, 0x55, 0xAF, 0x42, 0xBE, 0x06, 0x67, 0xDF, 0xDD, 0x7E, 0x5A, 0xDB, 0xCC, 0x0A, 0x1F,
+    0xEA, 0x04, 0x5A, 0x22, 0x49, 0xE5, 0xB4, 0x2C, 0x87, 0xA4, 0x4D, 0x4A, 0xD5, 0x04, 0xAA, 0x14,
+    0x7B, 0x2D, 0xD1, 0x84, 0xD5, 0x21, 0xD0, 0x2C, 0xA6, 0x2C, 0x38, 0x7C, 0x97, 0xE0, 0xBF, 0x11,
+    0xDC, 0xF9, 0xF9, 0x62, 0x27, 0xC2, 0x42, 0x73, 0xF7, 0x4B, 0x50, 0xAF, 0xBF, 0xD6, 0x1F, 0x44,
+    0xEF, 0x0F, 0x34, 0x5A, 0xEF, 0xF4, 0x51, 0xB9, 0xAF, 0x11, 0x14, 0x3C, 0x90, 0xDB, 0x30, 0xF5,
+    0xD8, 0xB9, 0x58, 0xFA, 0xAE, 0xE2, 0x7D, 0x7B, 0x22, 0x62, 0x0B, 0x39, 0x74, 0xB5, 0x04, 0xBC,
+    0xA4, 0x87, 0x78, 0x1D, 0x82, 0x8C, 0xE9, 0x84, 0x9A, 0x26, 0x94, 0x79, 0xC7, 0x73, 0xCD, 0x78,
+    0x5F, 0x1A, 0xF4, 0x64, 0x60, 0x77, 0xB6, 0xC8, 0xE8, 0x5E, 0x11, 0xA8, 0x76, 0x60, 0x43, 0xE3,
+    0x49, 0x44, 0xD0, 0x93, 0x59, 0x63, 0x96, 0xD3, 0x71, 0x67, 0x6A, 0x3F, 0x18, 0x2C, 0xCF, 0xAD,
+    0x47, 0xBB, 0xD9, 0xFA, 0x2E, 0xFC, 0x03,
+};
+
+static const uint32_t opendyslexic_8_regularBlockOffsets[14] = {
+    0, 1454, 2903, 3928, 4961, 6110, 7270, 8589,
+    10053, 11464, 12837, 14196, 15683, 16167,
+};
+
+static const uint16_t opendyslexic_8_regularDirectGlyphs[592] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 0, 0, 236, 237,
+    238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+    254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t opendyslexic_8_regularGlyphPages[35] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5,
+};
+
+static const uint16_t opendyslexic_8_regularPageGlyphs[1280] = {
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0, 0, 331,
+    0, 0, 332, 333, 334, 0, 0, 0, 335, 336, 337, 338, 339, 340, 341, 342,
+    343, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 0, 352, 353, 0, 0,
+    354, 355, 356, 0, 357, 358, 0, 0, 0, 359, 360, 361, 362, 363, 0, 0,
+    0, 0, 364, 365, 366, 0, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0,
+    0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+    395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+    411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+    427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+    443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 477, 478, 0, 0, 0, 0,
+    0, 0, 479, 480, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+    532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+    564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 0, 0, 590, 591, 0, 0,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 0, 0, 0, 0, 0, 0, 0, 632,
+    633, 0, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+    0, 0, 648, 0, 649, 0, 0, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    655, 0, 0, 0, 656, 657, 658, 659, 660, 661, 0, 0, 0, 0, 0, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 0, 0, 0, 673, 674, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 675, 676, 0, 677, 0, 678, 679, 680, 681, 682, 683, 684, 0, 685, 0,
+    0, 686, 687, 0, 688, 689, 0, 0, 690, 691, 692, 0, 693, 694, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 711, 0, 0, 712, 713, 0, 0, 0, 0, 0, 0, 0, 0, 714,
+    715, 716, 717, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 719, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    723, 0, 0, 0, 724, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
 static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
@@ -1631,674 +1214,674 @@ static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 14, 15, 19, 3, 15, 53, 1879 }, // V
     { 18, 14, 24, 3, 14, 63, 1932 }, // W
     { 13, 15, 19, 3, 15, 49, 1995 }, // X
-    { 12, 14, 18, 3, 14, 42, 2044 }, // Y
-    { 13, 14, 19, 3, 14, 46, 2086 }, // Z
-    { 6, 23, 8, 1, 18, 35, 2132 }, // [
-    { 6, 16, 8, 1, 13, 24, 2167 }, // <backslash>
-    { 6, 23, 8, 1, 18, 35, 2191 }, // ]
-    { 7, 4, 9, 1, 16, 7, 2226 }, // ^
-    { 11, 3, 13, 1, -1, 9, 2233 }, // _
-    { 6, 3, 7, 0, 13, 5, 2242 }, // `
-    { 10, 11, 14, 2, 11, 28, 2247 }, // a
-    { 10, 16, 14, 2, 15, 40, 2275 }, // b
-    { 8, 12, 12, 2, 11, 24, 2315 }, // c
-    { 10, 16, 14, 2, 15, 40, 2339 }, // d
-    { 10, 10, 14, 2, 10, 25, 2379 }, // e
-    { 6, 14, 11, 2, 14, 21, 2404 }, // f
-    { 9, 15, 13, 2, 10, 34, 2425 }, // g
-    { 10, 15, 14, 2, 15, 38, 2459 }, // h
-    { 4, 15, 8, 2, 15, 15, 2497 }, // i
-    { 7, 19, 11, 2, 15, 34, 2512 }, // j
-    { 10, 14, 14, 2, 14, 35, 2546 }, // k
-    { 5, 14, 9, 2, 14, 18, 2581 }, // l
-    { 15, 10, 20, 2, 10, 38, 2599 }, // m
-    { 10, 10, 14, 2, 10, 25, 2637 }, // n
-    { 10, 10, 14, 2, 10, 25, 2662 }, // o
-    { 11, 15, 14, 1, 10, 42, 2687 }, // p
-    { 12, 14, 16, 2, 10, 42, 2729 }, // q
-    { 7, 9, 11, 2, 9, 16, 2771 }, // r
-    { 9, 10, 13, 2, 10, 23, 2787 }, // s
-    { 8, 13, 12, 2, 13, 26, 2810 }, // t
-    { 9, 10, 13, 2, 10, 23, 2836 }, // u
-    { 11, 10, 15, 2, 10, 28, 2859 }, // v
-    { 13, 10, 17, 2, 10, 33, 2887 }, // w
-    { 11, 10, 15, 2, 10, 28, 2920 }, // x
-    { 10, 15, 14, 2, 10, 38, 2948 }, // y
-    { 10, 10, 14, 2, 10, 25, 2986 }, // z
-    { 8, 16, 9, 1, 13, 32, 3011 }, // {
-    { 2, 15, 4, 1, 12, 8, 3043 }, // |
-    { 8, 16, 9, 1, 13, 32, 3051 }, // }
-    { 6, 4, 8, 1, 13, 6, 3083 }, // ~
-    { 0, 0, 14, 0, 0, 0, 3089 }, //  
-    { 5, 18, 6, 0, 13, 23, 3089 }, // ¡
-    { 8, 16, 12, 2, 14, 32, 3112 }, // ¢
-    { 11, 16, 12, 0, 16, 44, 3144 }, // £
-    { 9, 8, 11, 1, 10, 18, 3188 }, // ¤
-    { 11, 15, 13, 1, 13, 42, 3206 }, // ¥
-    { 2, 15, 4, 1, 12, 8, 3248 }, // ¦
-    { 10, 16, 14, 2, 14, 40, 3256 }, // §
-    { 9, 3, 9, 0, 13, 7, 3296 }, // ¨
-    { 7, 7, 9, 1, 16, 13, 3303 }, // ©
-    { 6, 6, 7, 1, 13, 9, 3316 }, // ª
-    { 9, 8, 11, 1, 8, 18, 3325 }, // «
-    { 8, 5, 10, 1, 6, 10, 3343 }, // ¬
-    { 8, 2, 9, 1, 6, 4, 3353 }, // ­
-    { 7, 7, 9, 1, 18, 13, 3357 }, // ®
-    { 7, 3, 9, 1, 13, 6, 3370 }, // ¯
-    { 9, 8, 9, 0, 14, 18, 3376 }, // °
-    { 8, 10, 10, 1, 9, 20, 3394 }, // ±
-    { 5, 7, 5, 0, 14, 9, 3414 }, // ²
-    { 5, 7, 5, 0, 14, 9, 3423 }, // ³
-    { 3, 4, 5, 1, 13, 3, 3432 }, // ´
-    { 10, 12, 13, 1, 10, 30, 3435 }, // µ
-    { 8, 14, 10, 1, 12, 28, 3465 }, // ¶
-    { 4, 3, 4, 0, 7, 3, 3493 }, // ·
-    { 4, 5, 5, 1, 1, 5, 3496 }, // ¸
-    { 5, 7, 5, 0, 14, 9, 3501 }, // ¹
-    { 6, 6, 7, 1, 12, 9, 3510 }, // º
-    { 9, 8, 11, 1, 8, 18, 3519 }, // »
-    { 15, 16, 18, 2, 15, 60, 3537 }, // ¼
-    { 15, 15, 18, 2, 14, 57, 3597 }, // ½
-    { 15, 15, 18, 2, 14, 57, 3654 }, // ¾
-    { 10, 19, 10, 0, 10, 48, 3711 }, // ¿
-    { 13, 19, 19, 3, 19, 62, 3759 }, // À
-    { 13, 22, 19, 3, 22, 72, 3821 }, // Á
-    { 13, 20, 19, 3, 20, 65, 3893 }, // Â
-    { 13, 19, 19, 3, 19, 62, 3958 }, // Ã
-    { 13, 19, 19, 3, 19, 62, 4020 }, // Ä
-    { 13, 20, 19, 3, 20, 65, 4082 }, // Å
-    { 19, 16, 24, 3, 15, 76, 4147 }, // Æ
-    { 12, 20, 17, 2, 16, 60, 4223 }, // Ç
-    { 10, 19, 15, 3, 19, 48, 4283 }, // È
-    { 10, 22, 15, 3, 22, 55, 4331 }, // É
-    { 10, 19, 15, 3, 19, 48, 4386 }, // Ê
-    { 10, 19, 15, 3, 19, 48, 4434 }, // Ë
-    { 6, 20, 8, 0, 20, 30, 4482 }, // Ì
-    { 4, 23, 8, 2, 23, 23, 4512 }, // Í
-    { 7, 21, 8, 0, 21, 37, 4535 }, // Î
-    { 9, 20, 8, -1, 20, 45, 4572 }, // Ï
-    { 16, 15, 18, 0, 15, 60, 4617 }, // Ð
-    { 12, 18, 18, 3, 18, 54, 4677 }, // Ñ
-    { 13, 20, 19, 3, 19, 65, 4731 }, // Ò
-    { 13, 23, 19, 3, 22, 75, 4796 }, // Ó
-    { 13, 21, 19, 3, 20, 69, 4871 }, // Ô
-    { 13, 20, 19, 3, 19, 65, 4940 }, // Õ
-    { 13, 20, 19, 3, 19, 65, 5005 }, // Ö
-    { 8, 5, 10, 1, 7, 10, 5070 }, // ×
-    { 21, 31, 20, -1, 23, 163, 5080 }, // Ø
-    { 12, 20, 18, 3, 19, 60, 5243 }, // Ù
-    { 12, 23, 18, 3, 22, 69, 5303 }, // Ú
-    { 12, 21, 18, 3, 20, 63, 5372 }, // Û
-    { 12, 20, 18, 3, 19, 60, 5435 }, // Ü
-    { 12, 23, 18, 3, 23, 69, 5495 }, // Ý
-    { 9, 13, 9, 0, 13, 30, 5564 }, // Þ
-    { 10, 13, 11, 1, 13, 33, 5594 }, // ß
-    { 10, 14, 14, 2, 14, 35, 5627 }, // à
-    { 10, 17, 14, 2, 17, 43, 5662 }, // á
-    { 10, 15, 14, 2, 15, 38, 5705 }, // â
-    { 10, 14, 14, 2, 14, 35, 5743 }, // ã
-    { 10, 14, 14, 2, 14, 35, 5778 }, // ä
-    { 10, 15, 14, 2, 15, 38, 5813 }, // å
-    { 16, 11, 20, 2, 11, 44, 5851 }, // æ
-    { 8, 15, 12, 2, 11, 30, 5895 }, // ç
-    { 10, 16, 14, 2, 16, 40, 5925 }, // è
-    { 10, 19, 14, 2, 19, 48, 5965 }, // é
-    { 10, 16, 14, 2, 16, 40, 6013 }, // ê
-    { 10, 16, 14, 2, 16, 40, 6053 }, // ë
-    { 6, 14, 8, 0, 14, 21, 6093 }, // ì
-    { 4, 17, 8, 2, 17, 17, 6114 }, // í
-    { 7, 15, 8, 0, 15, 27, 6131 }, // î
-    { 9, 14, 8, -1, 14, 32, 6158 }, // ï
-    { 13, 14, 14, 1, 14, 46, 6190 }, // ð
-    { 10, 14, 14, 2, 14, 35, 6236 }, // ñ
-    { 10, 16, 14, 2, 16, 40, 6271 }, // ò
-    { 10, 19, 14, 2, 19, 48, 6311 }, // ó
-    { 10, 16, 14, 2, 16, 40, 6359 }, // ô
-    { 10, 16, 14, 2, 16, 40, 6399 }, // õ
-    { 10, 16, 14, 2, 16, 40, 6439 }, // ö
-    { 11, 10, 13, 1, 10, 28, 6479 }, // ÷
-    { 10, 27, 14, 2, 18, 68, 6507 }, // ø
-    { 9, 15, 13, 2, 15, 34, 6575 }, // ù
-    { 9, 18, 13, 2, 18, 41, 6609 }, // ú
-    { 9, 15, 13, 2, 15, 34, 6650 }, // û
-    { 9, 15, 13, 2, 15, 34, 6684 }, // ü
-    { 10, 24, 14, 2, 19, 60, 6718 }, // ý
-    { 8, 17, 9, 1, 14, 34, 6778 }, // þ
-    { 10, 21, 14, 2, 16, 53, 6812 }, // ÿ
-    { 13, 19, 19, 3, 19, 62, 6865 }, // Ā
-    { 10, 14, 14, 2, 14, 35, 6927 }, // ā
-    { 13, 21, 19, 3, 21, 69, 6962 }, // Ă
-    { 10, 16, 14, 2, 16, 40, 7031 }, // ă
-    { 13, 19, 19, 3, 14, 62, 7071 }, // Ą
-    { 10, 15, 14, 2, 11, 38, 7133 }, // ą
-    { 12, 24, 17, 2, 23, 72, 7171 }, // Ć
-    { 8, 17, 12, 2, 16, 34, 7243 }, // ć
-    { 12, 22, 17, 2, 21, 66, 7277 }, // Ĉ
-    { 8, 16, 12, 2, 15, 32, 7343 }, // ĉ
-    { 12, 23, 17, 2, 22, 69, 7375 }, // Ċ
-    { 8, 16, 12, 2, 15, 32, 7444 }, // ċ
-    { 12, 24, 17, 2, 23, 72, 7476 }, // Č
-    { 8, 17, 12, 2, 16, 34, 7548 }, // č
-    { 13, 21, 18, 3, 21, 69, 7582 }, // Ď
-    { 13, 16, 14, 2, 15, 52, 7651 }, // ď
-    { 16, 15, 18, 0, 15, 60, 7703 }, // Đ
-    { 13, 16, 14, 2, 15, 52, 7763 }, // đ
-    { 10, 19, 15, 3, 19, 48, 7815 }, // Ē
-    { 10, 15, 14, 2, 15, 38, 7863 }, // ē
-    { 10, 21, 15, 3, 21, 53, 7901 }, // Ĕ
-    { 10, 17, 14, 2, 17, 43, 7954 }, // ĕ
-    { 10, 20, 15, 3, 20, 50, 7997 }, // Ė
-    { 10, 16, 14, 2, 16, 40, 8047 }, // ė
-    { 10, 19, 15, 3, 15, 48, 8087 }, // Ę
-    { 10, 15, 14, 2, 10, 38, 8135 }, // ę
-    { 10, 21, 15, 3, 21, 53, 8173 }, // Ě
-    { 10, 17, 14, 2, 17, 43, 8226 }, // ě
-    { 14, 20, 19, 2, 20, 70, 8269 }, // Ĝ
-    { 9, 20, 13, 2, 15, 45, 8339 }, // ĝ
-    { 14, 21, 19, 2, 21, 74, 8384 }, // Ğ
-    { 9, 21, 13, 2, 16, 48, 8458 }, // ğ
-    { 14, 20, 19, 2, 20, 70, 8506 }, // Ġ
-    { 9, 20, 13, 2, 15, 45, 8576 }, // ġ
-    { 14, 22, 19, 2, 15, 77, 8621 }, // Ģ
-    { 9, 21, 13, 2, 16, 48, 8698 }, // ģ
-    { 12, 20, 18, 3, 20, 60, 8746 }, // Ĥ
-    { 12, 19, 14, 0, 19, 57, 8806 }, // ĥ
-    { 14, 15, 18, 2, 15, 53, 8863 }, // Ħ
-    { 12, 15, 14, 0, 15, 45, 8916 }, // ħ
-    { 7, 21, 8, 0, 21, 37, 8961 }, // Ĩ
-    { 7, 15, 8, 0, 15, 27, 8998 }, // ĩ
-    { 9, 20, 8, -1, 20, 45, 9025 }, // Ī
-    { 8, 14, 8, 0, 14, 28, 9070 }, // ī
-    { 4, 19, 10, 4, 15, 19, 9098 }, // Į
-    { 5, 19, 8, 1, 15, 24, 9117 }, // į
-    { 4, 21, 8, 2, 21, 21, 9141 }, // İ
-    { 3, 10, 8, 2, 10, 8, 9162 }, // ı
-    { 11, 19, 15, 2, 15, 53, 9170 }, // Ĳ
-    { 13, 20, 8, 2, 15, 65, 9223 }, // ĳ
-    { 8, 22, 13, 3, 18, 44, 9288 }, // Ĵ
-    { 9, 18, 11, 2, 14, 41, 9332 }, // ĵ
-    { 11, 21, 17, 3, 15, 58, 9373 }, // Ķ
-    { 10, 21, 14, 2, 14, 53, 9431 }, // ķ
-    { 8, 9, 11, 1, 9, 18, 9484 }, // ĸ
-    { 9, 20, 15, 3, 20, 45, 9502 }, // Ĺ
-    { 5, 20, 9, 2, 20, 25, 9547 }, // ĺ
-    { 9, 22, 15, 3, 15, 50, 9572 }, // Ļ
-    { 5, 21, 9, 2, 14, 27, 9622 }, // ļ
-    { 9, 15, 15, 3, 15, 34, 9649 }, // Ľ
-    { 7, 14, 9, 2, 14, 25, 9683 }, // ľ
-    { 9, 14, 15, 3, 14, 32, 9708 }, // Ŀ
-    { 7, 14, 9, 2, 14, 25, 9740 }, // ŀ
-    { 16, 23, 15, -4, 18, 92, 9765 }, // Ł
-    { 11, 14, 9, -3, 14, 39, 9857 }, // ł
-    { 12, 20, 18, 3, 20, 60, 9896 }, // Ń
-    { 10, 16, 14, 2, 16, 40, 9956 }, // ń
-    { 12, 21, 18, 3, 15, 63, 9996 }, // Ņ
-    { 10, 16, 14, 2, 10, 40, 10059 }, // ņ
-    { 12, 20, 18, 3, 20, 60, 10099 }, // Ň
-    { 10, 16, 14, 2, 16, 40, 10159 }, // ň
-    { 9, 18, 11, 1, 18, 41, 10199 }, // ŉ
-    { 12, 18, 18, 3, 15, 54, 10240 }, // Ŋ
-    { 10, 14, 14, 2, 10, 35, 10294 }, // ŋ
-    { 13, 20, 19, 3, 19, 65, 10329 }, // Ō
-    { 10, 15, 14, 2, 15, 38, 10394 }, // ō
-    { 13, 22, 19, 3, 21, 72, 10432 }, // Ŏ
-    { 10, 18, 14, 2, 18, 45, 10504 }, // ŏ
-    { 14, 21, 19, 3, 20, 74, 10549 }, // Ő
-    { 13, 17, 14, 1, 17, 56, 10623 }, // ő
-    { 19, 15, 20, 3, 15, 72, 10679 }, // Œ
-    { 17, 11, 18, 2, 11, 47, 10751 }, // œ
-    { 11, 20, 16, 3, 20, 55, 10798 }, // Ŕ
-    { 7, 14, 11, 2, 14, 25, 10853 }, // ŕ
-    { 11, 22, 16, 3, 14, 61, 10878 }, // Ŗ
-    { 8, 18, 11, 1, 9, 36, 10939 }, // ŗ
-    { 11, 20, 16, 3, 20, 55, 10975 }, // Ř
-    { 8, 14, 11, 1, 14, 28, 11030 }, // ř
-    { 13, 22, 19, 3, 21, 72, 11058 }, // Ś
-    { 9, 16, 13, 2, 16, 36, 11130 }, // ś
-    { 13, 21, 19, 3, 20, 69, 11166 }, // Ŝ
-    { 9, 15, 13, 2, 15, 34, 11235 }, // ŝ
-    { 13, 19, 19, 3, 15, 62, 11269 }, // Ş
-    { 9, 14, 13, 2, 10, 32, 11331 }, // ş
-    { 13, 23, 19, 3, 22, 75, 11363 }, // Š
-    { 9, 16, 13, 2, 16, 36, 11438 }, // š
-    { 12, 17, 18, 3, 14, 51, 11474 }, // Ţ
-    { 8, 16, 12, 2, 13, 32, 11525 }, // ţ
-    { 12, 20, 18, 3, 20, 60, 11557 }, // Ť
-    { 8, 14, 12, 2, 14, 28, 11617 }, // ť
-    { 12, 14, 18, 3, 14, 42, 11645 }, // Ŧ
-    { 9, 13, 12, 1, 13, 30, 11687 }, // ŧ
-    { 12, 21, 18, 3, 20, 63, 11717 }, // Ũ
-    { 9, 15, 13, 2, 15, 34, 11780 }, // ũ
-    { 12, 20, 18, 3, 19, 60, 11814 }, // Ū
-    { 9, 14, 13, 2, 14, 32, 11874 }, // ū
-    { 12, 22, 18, 3, 21, 66, 11906 }, // Ŭ
-    { 9, 16, 13, 2, 16, 36, 11972 }, // ŭ
-    { 12, 22, 18, 3, 21, 66, 12008 }, // Ů
-    { 9, 16, 13, 2, 16, 36, 12074 }, // ů
-    { 13, 21, 18, 3, 20, 69, 12110 }, // Ű
-    { 12, 15, 13, 1, 15, 45, 12179 }, // ű
-    { 12, 19, 18, 3, 15, 57, 12224 }, // Ų
-    { 9, 15, 13, 2, 10, 34, 12281 }, // ų
-    { 18, 19, 24, 3, 19, 86, 12315 }, // Ŵ
-    { 13, 15, 17, 2, 15, 49, 12401 }, // ŵ
-    { 12, 20, 18, 3, 20, 60, 12450 }, // Ŷ
-    { 10, 22, 14, 2, 17, 55, 12510 }, // ŷ
-    { 12, 20, 18, 3, 20, 60, 12565 }, // Ÿ
-    { 13, 20, 19, 3, 20, 65, 12625 }, // Ź
-    { 10, 16, 14, 2, 16, 40, 12690 }, // ź
-    { 13, 19, 19, 3, 19, 62, 12730 }, // Ż
-    { 10, 15, 14, 2, 15, 38, 12792 }, // ż
-    { 13, 20, 19, 3, 20, 65, 12830 }, // Ž
-    { 10, 16, 14, 2, 16, 40, 12895 }, // ž
-    { 6, 14, 9, 2, 14, 21, 12935 }, // ſ
-    { 6, 3, 0, 0, 13, 5, 12956 }, // ̀
-    { 3, 4, 0, 1, 13, 3, 12961 }, // ́
-    { 7, 4, 0, 1, 0, 7, 12964 }, // ̂
-    { 6, 4, 0, 1, 13, 6, 12971 }, // ̃
-    { 8, 3, 0, 1, 12, 6, 12977 }, // ̄
-    { 11, 3, 0, 1, 15, 9, 12983 }, // ̅
-    { 7, 5, 0, 1, 13, 9, 12992 }, // ̆
-    { 4, 3, 0, 0, 13, 3, 13001 }, // ̇
-    { 9, 3, 0, 0, 13, 7, 13004 }, // ̈
-    { 4, 4, 0, 0, 11, 4, 13011 }, // ̉
-    { 4, 4, 0, 1, 13, 4, 13015 }, // ̊
-    { 13, 3, 0, 0, 13, 10, 13019 }, // ̋
-    { 7, 4, 0, 1, 13, 7, 13029 }, // ̌
-    { 13, 3, 0, -4, 14, 10, 13036 }, // ̏
-    { 5, 5, 0, 0, 13, 7, 13046 }, // ̒
-    { 5, 5, 0, 0, 12, 7, 13053 }, // ̓
-    { 5, 5, 0, 0, 12, 7, 13060 }, // ̔
-    { 3, 5, 0, 1, 0, 4, 13067 }, // ̘
-    { 3, 5, 0, 1, 0, 4, 13071 }, // ̙
-    { 7, 4, 0, 1, 13, 7, 13075 }, // ̚
-    { 3, 4, 0, 1, 11, 3, 13082 }, // ̛
-    { 2, 3, 0, 1, -1, 2, 13085 }, // ̜
-    { 4, 3, 0, 1, 2, 3, 13087 }, // ̝
-    { 4, 3, 0, 1, -1, 3, 13090 }, // ̞
-    { 4, 4, 0, 1, -1, 4, 13093 }, // ̟
-    { 8, 3, 0, 1, -2, 6, 13097 }, // ̠
-    { 4, 3, 0, 0, 1, 3, 13103 }, // ̣
-    { 9, 3, 0, 0, 0, 7, 13106 }, // ̤
-    { 4, 4, 0, 1, 13, 4, 13113 }, // ̥
-    { 5, 6, 0, 0, 3, 8, 13117 }, // ̦
-    { 4, 5, 0, 1, 1, 5, 13125 }, // ̧
-    { 4, 5, 0, 1, 0, 5, 13130 }, // ̨
-    { 2, 5, 0, 1, -1, 3, 13135 }, // ̩
-    { 6, 3, 0, 1, -1, 5, 13138 }, // ̪
-    { 7, 4, 0, 1, 0, 7, 13143 }, // ̬
-    { 7, 4, 0, 1, 0, 7, 13150 }, // ̭
-    { 6, 4, 0, 1, 13, 6, 13157 }, // ̰
-    { 7, 3, 0, 1, 13, 6, 13163 }, // ̱
-    { 7, 3, 0, 1, -1, 6, 13169 }, // ̲
-    { 6, 4, 0, 1, 13, 6, 13175 }, // ̴
-    { 8, 2, 0, 1, 6, 4, 13181 }, // ̵
-    { 2, 3, 0, 1, -1, 2, 13185 }, // ̹
-    { 6, 4, 0, 1, 0, 6, 13187 }, // ̺
-    { 5, 4, 0, 1, 0, 5, 13193 }, // ̻
-    { 6, 4, 0, 1, 0, 6, 13198 }, // ̼
-    { 5, 4, 0, 1, 13, 5, 13204 }, // ̽
-    { 6, 4, 0, 1, 13, 6, 13209 }, // ͂
-    { 3, 3, 0, 1, 14, 3, 13215 }, // ̓
-    { 9, 8, 0, 0, 18, 18, 13218 }, // ̈́
-    { 6, 3, 0, 1, 13, 5, 13236 }, // ͆
-    { 8, 6, 0, 1, 0, 12, 13241 }, // ͇
-    { 7, 5, 0, 1, 0, 9, 13253 }, // ͈
-    { 5, 5, 0, 1, -1, 7, 13262 }, // ͉
-    { 6, 10, 0, 1, 16, 15, 13269 }, // ͊
-    { 14, 8, 0, 0, 15, 28, 13284 }, // ͋
-    { 10, 9, 0, 1, 9, 23, 13312 }, // ͌
-    { 9, 3, 0, 1, -2, 7, 13335 }, // ͍
-    { 3, 3, 0, 1, 2, 3, 13342 }, // ͎
-    { 14, 3, 0, 1, 0, 11, 13345 }, // ͜
-    { 14, 3, 0, 1, 13, 11, 13356 }, // ͡
-    { 17, 5, 0, 1, -1, 22, 13367 }, // ͢
-    { 9, 17, 11, 1, 17, 39, 13389 }, // Ѐ
-    { 9, 16, 11, 1, 16, 36, 13428 }, // Ё
-    { 13, 14, 17, 2, 14, 46, 13464 }, // Ђ
-    { 9, 20, 11, 1, 20, 45, 13510 }, // Ѓ
-    { 12, 14, 15, 2, 13, 42, 13555 }, // Є
-    { 13, 16, 19, 3, 15, 52, 13597 }, // Ѕ
-    { 4, 15, 8, 2, 15, 15, 13649 }, // І
-    { 8, 20, 8, -1, 20, 40, 13664 }, // Ї
-    { 7, 19, 13, 3, 15, 34, 13704 }, // Ј
-    { 16, 14, 19, 2, 13, 56, 13738 }, // Љ
-    { 15, 13, 19, 2, 13, 49, 13794 }, // Њ
-    { 14, 14, 18, 3, 14, 49, 13843 }, // Ћ
-    { 11, 21, 17, 3, 21, 58, 13892 }, // Ќ
-    { 12, 19, 18, 3, 19, 57, 13950 }, // Ѝ
-    { 10, 20, 12, 1, 19, 50, 14007 }, // Ў
-    { 10, 16, 12, 1, 12, 40, 14057 }, // Џ
-    { 13, 14, 19, 3, 14, 46, 14097 }, // А
-    { 9, 13, 11, 1, 13, 30, 14143 }, // Б
-    { 10, 13, 11, 1, 13, 33, 14173 }, // В
-    { 9, 12, 11, 1, 12, 27, 14206 }, // Г
-    { 12, 14, 14, 1, 12, 42, 14233 }, // Д
-    { 9, 12, 11, 1, 12, 27, 14275 }, // Е
-    { 18, 15, 24, 3, 15, 68, 14302 }, // Ж
-    { 9, 13, 11, 1, 13, 30, 14370 }, // З
-    { 12, 15, 18, 3, 15, 45, 14400 }, // И
-    { 12, 20, 18, 3, 20, 60, 14445 }, // Й
-    { 11, 15, 17, 3, 15, 42, 14505 }, // К
-    { 10, 13, 12, 1, 12, 33, 14547 }, // Л
-    { 12, 12, 14, 1, 12, 36, 14580 }, // М
-    { 12, 15, 18, 3, 15, 45, 14616 }, // Н
-    { 13, 16, 19, 3, 15, 52, 14661 }, // О
-    { 9, 13, 11, 1, 13, 30, 14713 }, // П
-    { 10, 15, 15, 3, 15, 38, 14743 }, // Р
-    { 12, 17, 17, 2, 16, 51, 14781 }, // С
-    { 12, 14, 18, 3, 14, 42, 14832 }, // Т
-    { 10, 14, 12, 1, 13, 35, 14874 }, // У
-    { 13, 13, 15, 1, 13, 43, 14909 }, // Ф
-    { 13, 15, 19, 3, 15, 49, 14952 }, // Х
-    { 10, 16, 12, 1, 13, 40, 15001 }, // Ц
-    { 9, 12, 11, 1, 12, 27, 15041 }, // Ч
-    { 12, 13, 14, 1, 13, 39, 15068 }, // Ш
-    { 13, 16, 15, 1, 13, 52, 15107 }, // Щ
-    { 12, 12, 11, -2, 12, 36, 15159 }, // Ъ
-    { 16, 13, 19, 1, 13, 52, 15195 }, // Ы
-    { 9, 12, 11, 1, 12, 27, 15247 }, // Ь
-    { 12, 14, 15, 2, 13, 42, 15274 }, // Э
-    { 13, 13, 17, 2, 13, 43, 15316 }, // Ю
-    { 11, 14, 16, 3, 14, 39, 15359 }, // Я
-    { 10, 11, 14, 2, 11, 28, 15398 }, // а
-    { 10, 14, 12, 1, 14, 35, 15426 }, // б
-    { 8, 11, 12, 2, 11, 22, 15461 }, // в
-    { 8, 10, 10, 1, 10, 20, 15483 }, // г
-    { 11, 12, 13, 1, 10, 33, 15503 }, // д
-    { 10, 10, 14, 2, 10, 25, 15536 }, // е
-    { 16, 12, 20, 2, 12, 48, 15561 }, // ж
-    { 7, 9, 7, 0, 9, 16, 15609 }, // з
-    { 9, 10, 11, 1, 10, 23, 15625 }, // и
-    { 9, 13, 11, 1, 13, 30, 15648 }, // й
-    { 9, 10, 13, 2, 10, 23, 15678 }, // к
-    { 7, 10, 8, 1, 9, 18, 15701 }, // л
-    { 12, 11, 15, 2, 11, 33, 15719 }, // м
-    { 11, 11, 15, 2, 11, 31, 15752 }, // н
-    { 9, 10, 11, 1, 10, 23, 15783 }, // о
-    { 9, 10, 11, 1, 10, 23, 15806 }, // п
-    { 11, 15, 14, 1, 10, 42, 15829 }, // р
-    { 8, 12, 12, 2, 11, 24, 15871 }, // с
-    { 10, 9, 11, 1, 9, 23, 15895 }, // т
-    { 10, 15, 14, 2, 10, 38, 15918 }, // у
-    { 13, 14, 15, 1, 10, 46, 15956 }, // ф
-    { 10, 10, 12, 1, 10, 25, 16002 }, // х
-    { 10, 13, 12, 1, 10, 33, 16027 }, // ц
-    { 7, 9, 8, 0, 9, 16, 16060 }, // ч
-    { 12, 10, 14, 1, 10, 30, 16076 }, // ш
-    { 13, 13, 15, 1, 10, 43, 16106 }, // щ
-    { 11, 9, 13, 1, 9, 25, 16149 }, // ъ
-    { 12, 10, 14, 1, 10, 30, 16174 }, // ы
-    { 8, 10, 10, 1, 10, 20, 16204 }, // ь
-    { 9, 9, 11, 1, 9, 21, 16224 }, // э
-    { 11, 10, 13, 1, 10, 28, 16245 }, // ю
-    { 9, 9, 10, 1, 9, 21, 16273 }, // я
-    { 10, 16, 14, 2, 16, 40, 16294 }, // ѐ
-    { 9, 12, 11, 1, 12, 27, 16334 }, // ё
-    { 12, 18, 14, 0, 15, 54, 16361 }, // ђ
-    { 8, 14, 10, 1, 14, 28, 16415 }, // ѓ
-    { 9, 10, 11, 1, 9, 23, 16443 }, // є
-    { 9, 10, 13, 2, 10, 23, 16466 }, // ѕ
-    { 4, 15, 8, 2, 15, 15, 16489 }, // і
-    { 9, 14, 8, -1, 14, 32, 16504 }, // ї
-    { 7, 19, 11, 2, 15, 34, 16536 }, // ј
-    { 12, 10, 13, 1, 9, 30, 16570 }, // љ
-    { 11, 9, 13, 1, 9, 25, 16600 }, // њ
-    { 12, 15, 14, 0, 15, 45, 16625 }, // ћ
-    { 9, 15, 13, 2, 15, 34, 16670 }, // ќ
-    { 9, 14, 11, 1, 14, 32, 16704 }, // ѝ
-    { 10, 22, 14, 2, 17, 55, 16736 }, // ў
-    { 8, 12, 9, 0, 9, 24, 16791 }, // џ
-    { 10, 13, 14, 2, 12, 33, 16815 }, // Ѣ
-    { 10, 13, 12, 1, 12, 33, 16848 }, // ѣ
-    { 13, 12, 17, 2, 12, 39, 16881 }, // Ѫ
-    { 10, 9, 12, 1, 9, 23, 16920 }, // ѫ
-    { 12, 16, 18, 3, 15, 48, 16943 }, // Ѳ
-    { 10, 12, 14, 2, 12, 30, 16991 }, // ѳ
-    { 17, 19, 19, 3, 19, 81, 17021 }, // Ѵ
-    { 11, 12, 14, 2, 12, 33, 17102 }, // ѵ
-    { 6, 5, 0, 1, 15, 8, 17135 }, // ҆
-    { 9, 14, 11, 1, 14, 32, 17143 }, // Ґ
-    { 8, 12, 10, 1, 12, 24, 17175 }, // ґ
-    { 10, 12, 11, 0, 12, 30, 17199 }, // Ғ
-    { 7, 8, 8, 0, 8, 14, 17229 }, // ғ
-    { 10, 14, 11, 1, 14, 35, 17243 }, // Ҕ
-    { 7, 9, 7, 0, 9, 16, 17278 }, // ҕ
-    { 18, 18, 21, 2, 15, 81, 17294 }, // Җ
-    { 13, 12, 15, 1, 10, 39, 17375 }, // җ
-    { 8, 15, 12, 2, 13, 30, 17414 }, // Ҙ
-    { 7, 13, 7, 0, 9, 23, 17444 }, // ҙ
-    { 11, 17, 15, 2, 15, 47, 17467 }, // Қ
-    { 8, 12, 10, 1, 10, 24, 17514 }, // қ
-    { 13, 13, 16, 2, 13, 43, 17538 }, // Ҝ
-    { 10, 9, 12, 1, 9, 23, 17581 }, // ҝ
-    { 12, 15, 17, 2, 15, 45, 17604 }, // Ҟ
-    { 12, 14, 14, 0, 14, 42, 17649 }, // ҟ
-    { 16, 15, 17, -2, 15, 60, 17691 }, // Ҡ
-    { 11, 11, 12, -1, 11, 31, 17751 }, // ҡ
-    { 12, 17, 16, 2, 15, 51, 17782 }, // Ң
-    { 9, 13, 11, 1, 11, 30, 17833 }, // ң
-    { 17, 15, 18, 3, 15, 64, 17863 }, // Ҥ
-    { 12, 10, 12, 2, 10, 30, 17927 }, // ҥ
-    { 16, 14, 20, 2, 14, 56, 17957 }, // Ҧ
-    { 16, 16, 18, 1, 11, 64, 18013 }, // ҧ
-    { 16, 15, 20, 2, 14, 60, 18077 }, // Ҩ
-    { 13, 12, 16, 1, 11, 39, 18137 }, // ҩ
-    { 12, 19, 17, 2, 16, 57, 18176 }, // Ҫ
-    { 8, 13, 12, 2, 11, 26, 18233 }, // ҫ
-    { 12, 16, 16, 2, 14, 48, 18259 }, // Ҭ
-    { 9, 11, 11, 1, 10, 25, 18307 }, // ҭ
-    { 12, 14, 18, 3, 14, 42, 18332 }, // Ү
-    { 9, 12, 11, 1, 9, 27, 18374 }, // ү
-    { 12, 14, 18, 3, 14, 42, 18401 }, // Ұ
-    { 10, 13, 11, 0, 9, 33, 18443 }, // ұ
-    { 14, 18, 17, 2, 15, 63, 18476 }, // Ҳ
-    { 10, 12, 11, 1, 10, 30, 18539 }, // ҳ
-    { 14, 15, 18, 2, 12, 53, 18569 }, // Ҵ
-    { 11, 11, 13, 1, 8, 31, 18622 }, // ҵ
-    { 11, 16, 14, 1, 12, 44, 18653 }, // Ҷ
-    { 9, 12, 10, 0, 9, 27, 18697 }, // ҷ
-    { 10, 12, 12, 1, 12, 30, 18724 }, // Ҹ
-    { 7, 9, 8, 1, 9, 16, 18754 }, // ҹ
-    { 9, 14, 13, 2, 14, 32, 18770 }, // Һ
-    { 10, 15, 14, 2, 15, 38, 18802 }, // һ
-    { 15, 13, 16, 0, 13, 49, 18840 }, // Ҽ
-    { 11, 9, 12, 0, 9, 25, 18889 }, // ҽ
-    { 16, 16, 18, 1, 13, 64, 18914 }, // Ҿ
-    { 11, 12, 13, 1, 10, 33, 18978 }, // ҿ
-    { 4, 15, 8, 2, 15, 15, 19011 }, // Ӏ
-    { 18, 21, 24, 3, 21, 95, 19026 }, // Ӂ
-    { 16, 18, 20, 2, 18, 72, 19121 }, // ӂ
-    { 10, 17, 13, 2, 13, 43, 19193 }, // Ӄ
-    { 7, 12, 9, 1, 9, 21, 19236 }, // ӄ
-    { 12, 16, 12, 1, 13, 48, 19257 }, // Ӆ
-    { 8, 11, 9, 1, 9, 22, 19305 }, // ӆ
-    { 13, 20, 18, 3, 15, 65, 19327 }, // Ӈ
-    { 9, 14, 12, 2, 11, 32, 19392 }, // ӈ
-    { 13, 20, 18, 3, 15, 65, 19424 }, // Ӊ
-    { 9, 15, 12, 2, 11, 34, 19489 }, // ӊ
-    { 10, 15, 11, 0, 12, 38, 19523 }, // Ӌ
-    { 7, 11, 8, 1, 9, 20, 19561 }, // ӌ
-    { 16, 20, 21, 3, 15, 80, 19581 }, // Ӎ
-    { 11, 14, 14, 2, 10, 39, 19661 }, // ӎ
-    { 3, 12, 5, 1, 12, 9, 19700 }, // ӏ
-    { 13, 21, 19, 3, 21, 69, 19709 }, // Ӑ
-    { 10, 16, 14, 2, 16, 40, 19778 }, // ӑ
-    { 13, 19, 19, 3, 19, 62, 19818 }, // Ӓ
-    { 10, 15, 14, 2, 15, 38, 19880 }, // ӓ
-    { 19, 16, 24, 3, 15, 76, 19918 }, // Ӕ
-    { 16, 11, 20, 2, 11, 44, 19994 }, // ӕ
-    { 9, 18, 11, 1, 18, 41, 20038 }, // Ӗ
-    { 10, 17, 14, 2, 17, 43, 20079 }, // ӗ
-    { 10, 11, 14, 2, 10, 28, 20122 }, // Ә
-    { 9, 11, 14, 3, 10, 25, 20150 }, // ә
-    { 10, 18, 14, 2, 17, 45, 20175 }, // Ӛ
-    { 9, 12, 14, 3, 10, 27, 20220 }, // ӛ
-    { 18, 20, 22, 3, 20, 90, 20247 }, // Ӝ
-    { 16, 17, 20, 2, 17, 68, 20337 }, // ӝ
-    { 9, 17, 11, 1, 17, 39, 20405 }, // Ӟ
-    { 9, 14, 7, 0, 14, 32, 20444 }, // ӟ
-    { 8, 14, 10, 1, 13, 28, 20476 }, // Ӡ
-    { 8, 13, 10, 1, 9, 26, 20504 }, // ӡ
-    { 12, 18, 18, 3, 18, 54, 20530 }, // Ӣ
-    { 9, 13, 11, 1, 13, 30, 20584 }, // ӣ
-    { 12, 19, 18, 3, 19, 57, 20614 }, // Ӥ
-    { 9, 14, 11, 1, 14, 32, 20671 }, // ӥ
-    { 13, 20, 19, 3, 19, 65, 20703 }, // Ӧ
-    { 9, 15, 11, 1, 15, 34, 20768 }, // ӧ
-    { 12, 13, 18, 3, 12, 39, 20802 }, // Ө
-    { 10, 10, 14, 2, 10, 25, 20841 }, // ө
-    { 12, 20, 18, 3, 19, 60, 20866 }, // Ӫ
-    { 10, 16, 14, 2, 16, 40, 20926 }, // ӫ
-    { 12, 19, 15, 2, 18, 57, 20966 }, // Ӭ
-    { 10, 14, 11, 0, 14, 35, 21023 }, // ӭ
-    { 10, 18, 12, 1, 17, 45, 21058 }, // Ӯ
-    { 10, 21, 14, 2, 16, 53, 21103 }, // ӯ
-    { 10, 19, 12, 1, 18, 48, 21156 }, // Ӱ
-    { 10, 21, 14, 2, 16, 53, 21204 }, // ӱ
-    { 13, 19, 12, 0, 18, 62, 21257 }, // Ӳ
-    { 13, 22, 14, 1, 17, 72, 21319 }, // ӳ
-    { 9, 17, 11, 1, 17, 39, 21391 }, // Ӵ
-    { 8, 14, 8, -1, 14, 28, 21430 }, // ӵ
-    { 9, 15, 11, 1, 12, 34, 21458 }, // Ӷ
-    { 7, 10, 8, 0, 8, 18, 21492 }, // ӷ
-    { 16, 18, 19, 1, 18, 72, 21510 }, // Ӹ
-    { 12, 15, 14, 1, 15, 45, 21582 }, // ӹ
-    { 16, 17, 19, 3, 15, 68, 21627 }, // Ӽ
-    { 11, 12, 13, 2, 10, 33, 21695 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 21728 }, //  
-    { 0, 0, 22, 0, 0, 0, 21728 }, //  
-    { 0, 0, 14, 0, 0, 0, 21728 }, //  
-    { 0, 0, 22, 0, 0, 0, 21728 }, //  
-    { 0, 0, 11, 0, 0, 0, 21728 }, //  
-    { 0, 0, 10, 0, 0, 0, 21728 }, //  
-    { 0, 0, 8, 0, 0, 0, 21728 }, //  
-    { 0, 0, 11, 0, 0, 0, 21728 }, //  
-    { 0, 0, 4, 0, 0, 0, 21728 }, //  
-    { 0, 0, 9, 0, 0, 0, 21728 }, //  
-    { 0, 0, 8, 0, 0, 0, 21728 }, //  
-    { 0, 0, 5, 0, 0, 0, 21728 }, // ​
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‏
-    { 8, 2, 9, 1, 6, 4, 21728 }, // ‐
-    { 8, 2, 9, 1, 6, 4, 21732 }, // ‑
-    { 12, 2, 12, 1, 6, 6, 21736 }, // ‒
-    { 11, 3, 13, 1, 6, 9, 21742 }, // –
-    { 17, 3, 19, 1, 6, 13, 21751 }, // —
-    { 17, 3, 19, 1, 6, 13, 21764 }, // ―
-    { 7, 15, 9, 1, 12, 27, 21777 }, // ‖
-    { 13, 6, 13, 1, -1, 20, 21804 }, // ‗
-    { 5, 6, 6, 0, 15, 8, 21824 }, // ‘
-    { 5, 6, 6, 0, 15, 8, 21832 }, // ’
-    { 5, 6, 5, 0, 3, 8, 21840 }, // ‚
-    { 5, 6, 6, 0, 15, 8, 21848 }, // ‛
-    { 9, 6, 9, 0, 15, 14, 21856 }, // “
-    { 9, 6, 9, 0, 15, 14, 21870 }, // ”
-    { 5, 6, 5, 0, 3, 8, 21884 }, // „
-    { 9, 5, 9, 0, 15, 12, 21892 }, // ‟
-    { 9, 22, 10, 0, 17, 50, 21904 }, // †
-    { 10, 22, 10, 0, 17, 55, 21954 }, // ‡
-    { 11, 10, 8, -1, 12, 28, 22009 }, // •
-    { 5, 6, 7, 1, 8, 8, 22037 }, // ‣
-    { 4, 3, 4, 0, 3, 3, 22045 }, // ․
-    { 4, 3, 4, 0, 3, 3, 22048 }, // ‥
-    { 15, 3, 16, 0, 3, 12, 22051 }, // …
-    { 3, 2, 4, 1, 6, 2, 22063 }, // ‧
-    { 0, 0, 21, 0, 0, 0, 22065 }, //  
-    { 11, 15, 18, 4, 13, 42, 22065 }, // ‰
-    { 5, 6, 5, 0, 15, 8, 22107 }, // ′
-    { 9, 6, 9, 0, 15, 14, 22115 }, // ″
-    { 14, 6, 14, 0, 14, 21, 22129 }, // ‴
-    { 5, 6, 6, 0, 14, 8, 22150 }, // ‵
-    { 8, 6, 9, 0, 14, 12, 22158 }, // ‶
-    { 14, 6, 14, 0, 14, 21, 22170 }, // ‷
-    { 7, 3, 9, 1, 13, 6, 22191 }, // ‸
-    { 5, 8, 7, 1, 8, 10, 22197 }, // ‹
-    { 5, 8, 7, 1, 8, 10, 22207 }, // ›
-    { 18, 17, 22, 3, 15, 77, 22217 }, // ※
-    { 5, 17, 6, 0, 17, 22, 22294 }, // ‼
-    { 10, 21, 12, 1, 20, 53, 22316 }, // ‽
-    { 8, 2, 9, 1, 14, 4, 22369 }, // ‾
-    { 7, 4, 9, 1, 12, 7, 22373 }, // ‿
-    { 11, 12, 13, 1, 16, 33, 22380 }, // ⁂
-    { 10, 14, 18, 4, 13, 35, 22413 }, // ⁄
-    { 19, 19, 21, 1, 19, 91, 22448 }, // ⁇
-    { 13, 19, 17, 1, 19, 62, 22539 }, // ⁈
-    { 13, 20, 13, 0, 19, 65, 22601 }, // ⁉
-    { 10, 26, 12, 1, 18, 65, 22666 }, // ⁒
-    { 0, 0, 80, 0, 0, 0, 22731 }, //  
-    { 5, 7, 5, 0, 14, 9, 22731 }, // ⁰
-    { 5, 6, 5, 0, 14, 8, 22740 }, // ⁴
-    { 5, 7, 5, 0, 14, 9, 22748 }, // ⁵
-    { 5, 7, 5, 0, 14, 9, 22757 }, // ⁶
-    { 5, 7, 6, 0, 14, 9, 22766 }, // ⁷
-    { 5, 7, 6, 0, 14, 9, 22775 }, // ⁸
-    { 5, 7, 6, 0, 14, 9, 22784 }, // ⁹
-    { 10, 10, 14, 2, 10, 25, 22793 }, // ⁿ
-    { 7, 9, 8, 0, 9, 16, 22818 }, // ₀
-    { 5, 7, 5, 0, 4, 9, 22834 }, // ₁
-    { 5, 7, 5, 0, 4, 9, 22843 }, // ₂
-    { 5, 7, 5, 0, 4, 9, 22852 }, // ₃
-    { 5, 7, 6, 0, 4, 9, 22861 }, // ₄
-    { 5, 7, 5, 0, 4, 9, 22870 }, // ₅
-    { 5, 7, 6, 0, 4, 9, 22879 }, // ₆
-    { 5, 7, 5, 0, 4, 9, 22888 }, // ₇
-    { 6, 7, 6, 0, 4, 11, 22897 }, // ₈
-    { 5, 7, 6, 0, 4, 9, 22908 }, // ₉
-    { 6, 23, 7, 1, 17, 35, 22917 }, // ₍
-    { 6, 23, 7, 0, 17, 35, 22952 }, // ₎
-    { 12, 23, 17, 2, 19, 69, 22987 }, // ₡
-    { 12, 17, 17, 2, 16, 51, 23056 }, // ₢
-    { 11, 16, 12, 0, 16, 44, 23107 }, // ₤
-    { 16, 15, 18, 1, 15, 60, 23151 }, // ₦
-    { 13, 15, 15, 1, 15, 49, 23211 }, // ₧
-    { 17, 15, 19, 2, 15, 64, 23260 }, // ₨
-    { 14, 15, 14, 0, 15, 53, 23324 }, // ₩
-    { 14, 13, 18, 2, 13, 46, 23377 }, // ₪
-    { 11, 14, 11, 1, 14, 39, 23423 }, // ₫
-    { 11, 16, 12, 1, 14, 44, 23462 }, // €
-    { 12, 14, 18, 3, 14, 42, 23506 }, // ₮
-    { 15, 15, 11, 0, 15, 57, 23548 }, // ₱
-    { 14, 21, 19, 2, 18, 74, 23605 }, // ₲
-    { 15, 16, 15, 1, 15, 60, 23679 }, // ₴
-    { 8, 13, 12, 2, 12, 26, 23739 }, // ₵
-    { 12, 15, 18, 3, 15, 45, 23765 }, // ₸
-    { 8, 13, 10, 1, 13, 26, 23810 }, // ₹
-    { 10, 13, 11, 1, 12, 33, 23836 }, // ₺
-    { 11, 13, 10, 0, 13, 36, 23869 }, // ₼
-    { 14, 15, 15, -1, 15, 53, 23905 }, // ₽
-    { 11, 11, 13, 1, 10, 31, 23958 }, // ←
-    { 11, 10, 13, 1, 10, 28, 23989 }, // ↑
-    { 11, 11, 13, 1, 10, 31, 24017 }, // →
-    { 11, 10, 13, 1, 10, 28, 24048 }, // ↓
-    { 13, 9, 15, 1, 9, 30, 24076 }, // ↔
-    { 9, 13, 11, 1, 14, 30, 24106 }, // ↕
-    { 9, 8, 11, 1, 8, 18, 24136 }, // ↖
-    { 9, 8, 11, 1, 8, 18, 24154 }, // ↗
-    { 9, 9, 11, 1, 9, 21, 24172 }, // ↘
-    { 9, 9, 11, 1, 9, 21, 24193 }, // ↙
-    { 12, 11, 14, 1, 10, 33, 24214 }, // ⇐
-    { 13, 12, 15, 1, 12, 39, 24247 }, // ⇑
-    { 12, 11, 14, 1, 10, 33, 24286 }, // ⇒
-    { 13, 13, 15, 1, 12, 43, 24319 }, // ⇓
-    { 14, 11, 16, 1, 10, 39, 24362 }, // ⇔
-    { 11, 14, 13, 1, 9, 39, 24401 }, // ⇕
-    { 10, 14, 11, 1, 14, 35, 24440 }, // ∂
-    { 17, 17, 19, 1, 16, 73, 24475 }, // ∅
-    { 12, 13, 14, 1, 13, 39, 24548 }, // ∆
-    { 10, 12, 12, 1, 12, 30, 24587 }, // ∏
-    { 10, 12, 12, 1, 12, 30, 24617 }, // ∐
-    { 8, 13, 10, 1, 12, 26, 24647 }, // ∑
-    { 8, 3, 10, 1, 6, 6, 24673 }, // −
-    { 14, 14, 16, 1, 13, 49, 24679 }, // √
-    { 13, 8, 15, 1, 10, 26, 24728 }, // ∞
-    { 14, 19, 14, 0, 15, 67, 24754 }, // ∫
-    { 4, 10, 5, 0, 10, 10, 24821 }, // ∶
-    { 10, 9, 13, 1, 9, 23, 24831 }, // ≈
-    { 11, 15, 18, 4, 13, 42, 24854 }, // ≠
-    { 13, 13, 14, 1, 12, 43, 24896 }, // ≤
-    { 13, 13, 14, 1, 12, 43, 24939 }, // ≥
+    { 12, 14, 18, 3, 14, 42, 2048 }, // Y
+    { 13, 14, 19, 3, 14, 46, 2090 }, // Z
+    { 6, 23, 8, 1, 18, 35, 2136 }, // [
+    { 6, 16, 8, 1, 13, 24, 2171 }, // <backslash>
+    { 6, 23, 8, 1, 18, 35, 2195 }, // ]
+    { 7, 4, 9, 1, 16, 7, 2230 }, // ^
+    { 11, 3, 13, 1, -1, 9, 2237 }, // _
+    { 6, 3, 7, 0, 13, 5, 2246 }, // `
+    { 10, 11, 14, 2, 11, 28, 2251 }, // a
+    { 10, 16, 14, 2, 15, 40, 2279 }, // b
+    { 8, 12, 12, 2, 11, 24, 2319 }, // c
+    { 10, 16, 14, 2, 15, 40, 2343 }, // d
+    { 10, 10, 14, 2, 10, 25, 2383 }, // e
+    { 6, 14, 11, 2, 14, 21, 2408 }, // f
+    { 9, 15, 13, 2, 10, 34, 2429 }, // g
+    { 10, 15, 14, 2, 15, 38, 2463 }, // h
+    { 4, 15, 8, 2, 15, 15, 2501 }, // i
+    { 7, 19, 11, 2, 15, 34, 2516 }, // j
+    { 10, 14, 14, 2, 14, 35, 2550 }, // k
+    { 5, 14, 9, 2, 14, 18, 2585 }, // l
+    { 15, 10, 20, 2, 10, 38, 2603 }, // m
+    { 10, 10, 14, 2, 10, 25, 2641 }, // n
+    { 10, 10, 14, 2, 10, 25, 2666 }, // o
+    { 11, 15, 14, 1, 10, 42, 2691 }, // p
+    { 12, 14, 16, 2, 10, 42, 2733 }, // q
+    { 7, 9, 11, 2, 9, 16, 2775 }, // r
+    { 9, 10, 13, 2, 10, 23, 2791 }, // s
+    { 8, 13, 12, 2, 13, 26, 2814 }, // t
+    { 9, 10, 13, 2, 10, 23, 2840 }, // u
+    { 11, 10, 15, 2, 10, 28, 2863 }, // v
+    { 13, 10, 17, 2, 10, 33, 2891 }, // w
+    { 11, 10, 15, 2, 10, 28, 2924 }, // x
+    { 10, 15, 14, 2, 10, 38, 2952 }, // y
+    { 10, 10, 14, 2, 10, 25, 2990 }, // z
+    { 8, 16, 9, 1, 13, 32, 3015 }, // {
+    { 2, 15, 4, 1, 12, 8, 3047 }, // |
+    { 8, 16, 9, 1, 13, 32, 3055 }, // }
+    { 6, 4, 8, 1, 13, 6, 3087 }, // ~
+    { 0, 0, 14, 0, 0, 0, 3093 }, //  
+    { 5, 18, 6, 0, 13, 23, 3093 }, // ¡
+    { 8, 16, 12, 2, 14, 32, 3116 }, // ¢
+    { 11, 16, 12, 0, 16, 44, 3148 }, // £
+    { 9, 8, 11, 1, 10, 18, 3192 }, // ¤
+    { 11, 15, 13, 1, 13, 42, 3210 }, // ¥
+    { 2, 15, 4, 1, 12, 8, 3252 }, // ¦
+    { 10, 16, 14, 2, 14, 40, 3260 }, // §
+    { 9, 3, 9, 0, 13, 7, 3300 }, // ¨
+    { 7, 7, 9, 1, 16, 13, 3307 }, // ©
+    { 6, 6, 7, 1, 13, 9, 3320 }, // ª
+    { 9, 8, 11, 1, 8, 18, 3329 }, // «
+    { 8, 5, 10, 1, 6, 10, 3347 }, // ¬
+    { 8, 2, 9, 1, 6, 4, 3357 }, // ­
+    { 7, 7, 9, 1, 18, 13, 3361 }, // ®
+    { 7, 3, 9, 1, 13, 6, 3374 }, // ¯
+    { 9, 8, 9, 0, 14, 18, 3380 }, // °
+    { 8, 10, 10, 1, 9, 20, 3398 }, // ±
+    { 5, 7, 5, 0, 14, 9, 3418 }, // ²
+    { 5, 7, 5, 0, 14, 9, 3427 }, // ³
+    { 3, 4, 5, 1, 13, 3, 3436 }, // ´
+    { 10, 12, 13, 1, 10, 30, 3439 }, // µ
+    { 8, 14, 10, 1, 12, 28, 3469 }, // ¶
+    { 4, 3, 4, 0, 7, 3, 3497 }, // ·
+    { 4, 5, 5, 1, 1, 5, 3500 }, // ¸
+    { 5, 7, 5, 0, 14, 9, 3505 }, // ¹
+    { 6, 6, 7, 1, 12, 9, 3514 }, // º
+    { 9, 8, 11, 1, 8, 18, 3523 }, // »
+    { 15, 16, 18, 2, 15, 60, 3541 }, // ¼
+    { 15, 15, 18, 2, 14, 57, 3601 }, // ½
+    { 15, 15, 18, 2, 14, 57, 3658 }, // ¾
+    { 10, 19, 10, 0, 10, 48, 3715 }, // ¿
+    { 13, 19, 19, 3, 19, 62, 3763 }, // À
+    { 13, 22, 19, 3, 22, 72, 3825 }, // Á
+    { 13, 20, 19, 3, 20, 65, 3897 }, // Â
+    { 13, 19, 19, 3, 19, 62, 3962 }, // Ã
+    { 13, 19, 19, 3, 19, 62, 4024 }, // Ä
+    { 13, 20, 19, 3, 20, 65, 4096 }, // Å
+    { 19, 16, 24, 3, 15, 76, 4161 }, // Æ
+    { 12, 20, 17, 2, 16, 60, 4237 }, // Ç
+    { 10, 19, 15, 3, 19, 48, 4297 }, // È
+    { 10, 22, 15, 3, 22, 55, 4345 }, // É
+    { 10, 19, 15, 3, 19, 48, 4400 }, // Ê
+    { 10, 19, 15, 3, 19, 48, 4448 }, // Ë
+    { 6, 20, 8, 0, 20, 30, 4496 }, // Ì
+    { 4, 23, 8, 2, 23, 23, 4526 }, // Í
+    { 7, 21, 8, 0, 21, 37, 4549 }, // Î
+    { 9, 20, 8, -1, 20, 45, 4586 }, // Ï
+    { 16, 15, 18, 0, 15, 60, 4631 }, // Ð
+    { 12, 18, 18, 3, 18, 54, 4691 }, // Ñ
+    { 13, 20, 19, 3, 19, 65, 4745 }, // Ò
+    { 13, 23, 19, 3, 22, 75, 4810 }, // Ó
+    { 13, 21, 19, 3, 20, 69, 4885 }, // Ô
+    { 13, 20, 19, 3, 19, 65, 4954 }, // Õ
+    { 13, 20, 19, 3, 19, 65, 5019 }, // Ö
+    { 8, 5, 10, 1, 7, 10, 5084 }, // ×
+    { 21, 31, 20, -1, 23, 163, 5094 }, // Ø
+    { 12, 20, 18, 3, 19, 60, 5257 }, // Ù
+    { 12, 23, 18, 3, 22, 69, 5317 }, // Ú
+    { 12, 21, 18, 3, 20, 63, 5386 }, // Û
+    { 12, 20, 18, 3, 19, 60, 5449 }, // Ü
+    { 12, 23, 18, 3, 23, 69, 5509 }, // Ý
+    { 9, 13, 9, 0, 13, 30, 5578 }, // Þ
+    { 10, 13, 11, 1, 13, 33, 5608 }, // ß
+    { 10, 14, 14, 2, 14, 35, 5641 }, // à
+    { 10, 17, 14, 2, 17, 43, 5676 }, // á
+    { 10, 15, 14, 2, 15, 38, 5719 }, // â
+    { 10, 14, 14, 2, 14, 35, 5757 }, // ã
+    { 10, 14, 14, 2, 14, 35, 5792 }, // ä
+    { 10, 15, 14, 2, 15, 38, 5827 }, // å
+    { 16, 11, 20, 2, 11, 44, 5865 }, // æ
+    { 8, 15, 12, 2, 11, 30, 5909 }, // ç
+    { 10, 16, 14, 2, 16, 40, 5939 }, // è
+    { 10, 19, 14, 2, 19, 48, 5979 }, // é
+    { 10, 16, 14, 2, 16, 40, 6027 }, // ê
+    { 10, 16, 14, 2, 16, 40, 6067 }, // ë
+    { 6, 14, 8, 0, 14, 21, 6107 }, // ì
+    { 4, 17, 8, 2, 17, 17, 6144 }, // í
+    { 7, 15, 8, 0, 15, 27, 6161 }, // î
+    { 9, 14, 8, -1, 14, 32, 6188 }, // ï
+    { 13, 14, 14, 1, 14, 46, 6220 }, // ð
+    { 10, 14, 14, 2, 14, 35, 6266 }, // ñ
+    { 10, 16, 14, 2, 16, 40, 6301 }, // ò
+    { 10, 19, 14, 2, 19, 48, 6341 }, // ó
+    { 10, 16, 14, 2, 16, 40, 6389 }, // ô
+    { 10, 16, 14, 2, 16, 40, 6429 }, // õ
+    { 10, 16, 14, 2, 16, 40, 6469 }, // ö
+    { 11, 10, 13, 1, 10, 28, 6509 }, // ÷
+    { 10, 27, 14, 2, 18, 68, 6537 }, // ø
+    { 9, 15, 13, 2, 15, 34, 6605 }, // ù
+    { 9, 18, 13, 2, 18, 41, 6639 }, // ú
+    { 9, 15, 13, 2, 15, 34, 6680 }, // û
+    { 9, 15, 13, 2, 15, 34, 6714 }, // ü
+    { 10, 24, 14, 2, 19, 60, 6748 }, // ý
+    { 8, 17, 9, 1, 14, 34, 6808 }, // þ
+    { 10, 21, 14, 2, 16, 53, 6842 }, // ÿ
+    { 13, 19, 19, 3, 19, 62, 6895 }, // Ā
+    { 10, 14, 14, 2, 14, 35, 6957 }, // ā
+    { 13, 21, 19, 3, 21, 69, 6992 }, // Ă
+    { 10, 16, 14, 2, 16, 40, 7061 }, // ă
+    { 13, 19, 19, 3, 14, 62, 7101 }, // Ą
+    { 10, 15, 14, 2, 11, 38, 7163 }, // ą
+    { 12, 24, 17, 2, 23, 72, 7201 }, // Ć
+    { 8, 17, 12, 2, 16, 34, 7273 }, // ć
+    { 12, 22, 17, 2, 21, 66, 7307 }, // Ĉ
+    { 8, 16, 12, 2, 15, 32, 7373 }, // ĉ
+    { 12, 23, 17, 2, 22, 69, 7405 }, // Ċ
+    { 8, 16, 12, 2, 15, 32, 7474 }, // ċ
+    { 12, 24, 17, 2, 23, 72, 7506 }, // Č
+    { 8, 17, 12, 2, 16, 34, 7578 }, // č
+    { 13, 21, 18, 3, 21, 69, 7612 }, // Ď
+    { 13, 16, 14, 2, 15, 52, 7681 }, // ď
+    { 16, 15, 18, 0, 15, 60, 7733 }, // Đ
+    { 13, 16, 14, 2, 15, 52, 7793 }, // đ
+    { 10, 19, 15, 3, 19, 48, 7845 }, // Ē
+    { 10, 15, 14, 2, 15, 38, 7893 }, // ē
+    { 10, 21, 15, 3, 21, 53, 7931 }, // Ĕ
+    { 10, 17, 14, 2, 17, 43, 7984 }, // ĕ
+    { 10, 20, 15, 3, 20, 50, 8027 }, // Ė
+    { 10, 16, 14, 2, 16, 40, 8077 }, // ė
+    { 10, 19, 15, 3, 15, 48, 8117 }, // Ę
+    { 10, 15, 14, 2, 10, 38, 8192 }, // ę
+    { 10, 21, 15, 3, 21, 53, 8230 }, // Ě
+    { 10, 17, 14, 2, 17, 43, 8283 }, // ě
+    { 14, 20, 19, 2, 20, 70, 8326 }, // Ĝ
+    { 9, 20, 13, 2, 15, 45, 8396 }, // ĝ
+    { 14, 21, 19, 2, 21, 74, 8441 }, // Ğ
+    { 9, 21, 13, 2, 16, 48, 8515 }, // ğ
+    { 14, 20, 19, 2, 20, 70, 8563 }, // Ġ
+    { 9, 20, 13, 2, 15, 45, 8633 }, // ġ
+    { 14, 22, 19, 2, 15, 77, 8678 }, // Ģ
+    { 9, 21, 13, 2, 16, 48, 8755 }, // ģ
+    { 12, 20, 18, 3, 20, 60, 8803 }, // Ĥ
+    { 12, 19, 14, 0, 19, 57, 8863 }, // ĥ
+    { 14, 15, 18, 2, 15, 53, 8920 }, // Ħ
+    { 12, 15, 14, 0, 15, 45, 8973 }, // ħ
+    { 7, 21, 8, 0, 21, 37, 9018 }, // Ĩ
+    { 7, 15, 8, 0, 15, 27, 9055 }, // ĩ
+    { 9, 20, 8, -1, 20, 45, 9082 }, // Ī
+    { 8, 14, 8, 0, 14, 28, 9127 }, // ī
+    { 4, 19, 10, 4, 15, 19, 9155 }, // Į
+    { 5, 19, 8, 1, 15, 24, 9174 }, // į
+    { 4, 21, 8, 2, 21, 21, 9198 }, // İ
+    { 3, 10, 8, 2, 10, 8, 9219 }, // ı
+    { 11, 19, 15, 2, 15, 53, 9227 }, // Ĳ
+    { 13, 20, 8, 2, 15, 65, 9280 }, // ĳ
+    { 8, 22, 13, 3, 18, 44, 9345 }, // Ĵ
+    { 9, 18, 11, 2, 14, 41, 9389 }, // ĵ
+    { 11, 21, 17, 3, 15, 58, 9430 }, // Ķ
+    { 10, 21, 14, 2, 14, 53, 9488 }, // ķ
+    { 8, 9, 11, 1, 9, 18, 9541 }, // ĸ
+    { 9, 20, 15, 3, 20, 45, 9559 }, // Ĺ
+    { 5, 20, 9, 2, 20, 25, 9604 }, // ĺ
+    { 9, 22, 15, 3, 15, 50, 9629 }, // Ļ
+    { 5, 21, 9, 2, 14, 27, 9679 }, // ļ
+    { 9, 15, 15, 3, 15, 34, 9706 }, // Ľ
+    { 7, 14, 9, 2, 14, 25, 9740 }, // ľ
+    { 9, 14, 15, 3, 14, 32, 9765 }, // Ŀ
+    { 7, 14, 9, 2, 14, 25, 9797 }, // ŀ
+    { 16, 23, 15, -4, 18, 92, 9822 }, // Ł
+    { 11, 14, 9, -3, 14, 39, 9914 }, // ł
+    { 12, 20, 18, 3, 20, 60, 9953 }, // Ń
+    { 10, 16, 14, 2, 16, 40, 10013 }, // ń
+    { 12, 21, 18, 3, 15, 63, 10053 }, // Ņ
+    { 10, 16, 14, 2, 10, 40, 10116 }, // ņ
+    { 12, 20, 18, 3, 20, 60, 10156 }, // Ň
+    { 10, 16, 14, 2, 16, 40, 10240 }, // ň
+    { 9, 18, 11, 1, 18, 41, 10280 }, // ŉ
+    { 12, 18, 18, 3, 15, 54, 10321 }, // Ŋ
+    { 10, 14, 14, 2, 10, 35, 10375 }, // ŋ
+    { 13, 20, 19, 3, 19, 65, 10410 }, // Ō
+    { 10, 15, 14, 2, 15, 38, 10475 }, // ō
+    { 13, 22, 19, 3, 21, 72, 10513 }, // Ŏ
+    { 10, 18, 14, 2, 18, 45, 10585 }, // ŏ
+    { 14, 21, 19, 3, 20, 74, 10630 }, // Ő
+    { 13, 17, 14, 1, 17, 56, 10704 }, // ő
+    { 19, 15, 20, 3, 15, 72, 10760 }, // Œ
+    { 17, 11, 18, 2, 11, 47, 10832 }, // œ
+    { 11, 20, 16, 3, 20, 55, 10879 }, // Ŕ
+    { 7, 14, 11, 2, 14, 25, 10934 }, // ŕ
+    { 11, 22, 16, 3, 14, 61, 10959 }, // Ŗ
+    { 8, 18, 11, 1, 9, 36, 11020 }, // ŗ
+    { 11, 20, 16, 3, 20, 55, 11056 }, // Ř
+    { 8, 14, 11, 1, 14, 28, 11111 }, // ř
+    { 13, 22, 19, 3, 21, 72, 11139 }, // Ś
+    { 9, 16, 13, 2, 16, 36, 11211 }, // ś
+    { 13, 21, 19, 3, 20, 69, 11247 }, // Ŝ
+    { 9, 15, 13, 2, 15, 34, 11316 }, // ŝ
+    { 13, 19, 19, 3, 15, 62, 11350 }, // Ş
+    { 9, 14, 13, 2, 10, 32, 11412 }, // ş
+    { 13, 23, 19, 3, 22, 75, 11444 }, // Š
+    { 9, 16, 13, 2, 16, 36, 11519 }, // š
+    { 12, 17, 18, 3, 14, 51, 11555 }, // Ţ
+    { 8, 16, 12, 2, 13, 32, 11606 }, // ţ
+    { 12, 20, 18, 3, 20, 60, 11638 }, // Ť
+    { 8, 14, 12, 2, 14, 28, 11698 }, // ť
+    { 12, 14, 18, 3, 14, 42, 11726 }, // Ŧ
+    { 9, 13, 12, 1, 13, 30, 11768 }, // ŧ
+    { 12, 21, 18, 3, 20, 63, 11798 }, // Ũ
+    { 9, 15, 13, 2, 15, 34, 11861 }, // ũ
+    { 12, 20, 18, 3, 19, 60, 11895 }, // Ū
+    { 9, 14, 13, 2, 14, 32, 11955 }, // ū
+    { 12, 22, 18, 3, 21, 66, 11987 }, // Ŭ
+    { 9, 16, 13, 2, 16, 36, 12053 }, // ŭ
+    { 12, 22, 18, 3, 21, 66, 12089 }, // Ů
+    { 9, 16, 13, 2, 16, 36, 12155 }, // ů
+    { 13, 21, 18, 3, 20, 69, 12191 }, // Ű
+    { 12, 15, 13, 1, 15, 45, 12288 }, // ű
+    { 12, 19, 18, 3, 15, 57, 12333 }, // Ų
+    { 9, 15, 13, 2, 10, 34, 12390 }, // ų
+    { 18, 19, 24, 3, 19, 86, 12424 }, // Ŵ
+    { 13, 15, 17, 2, 15, 49, 12510 }, // ŵ
+    { 12, 20, 18, 3, 20, 60, 12559 }, // Ŷ
+    { 10, 22, 14, 2, 17, 55, 12619 }, // ŷ
+    { 12, 20, 18, 3, 20, 60, 12674 }, // Ÿ
+    { 13, 20, 19, 3, 20, 65, 12734 }, // Ź
+    { 10, 16, 14, 2, 16, 40, 12799 }, // ź
+    { 13, 19, 19, 3, 19, 62, 12839 }, // Ż
+    { 10, 15, 14, 2, 15, 38, 12901 }, // ż
+    { 13, 20, 19, 3, 20, 65, 12939 }, // Ž
+    { 10, 16, 14, 2, 16, 40, 13004 }, // ž
+    { 6, 14, 9, 2, 14, 21, 13044 }, // ſ
+    { 6, 3, 0, 0, 13, 5, 13065 }, // ̀
+    { 3, 4, 0, 1, 13, 3, 13070 }, // ́
+    { 7, 4, 0, 1, 0, 7, 13073 }, // ̂
+    { 6, 4, 0, 1, 13, 6, 13080 }, // ̃
+    { 8, 3, 0, 1, 12, 6, 13086 }, // ̄
+    { 11, 3, 0, 1, 15, 9, 13092 }, // ̅
+    { 7, 5, 0, 1, 13, 9, 13101 }, // ̆
+    { 4, 3, 0, 0, 13, 3, 13110 }, // ̇
+    { 9, 3, 0, 0, 13, 7, 13113 }, // ̈
+    { 4, 4, 0, 0, 11, 4, 13120 }, // ̉
+    { 4, 4, 0, 1, 13, 4, 13124 }, // ̊
+    { 13, 3, 0, 0, 13, 10, 13128 }, // ̋
+    { 7, 4, 0, 1, 13, 7, 13138 }, // ̌
+    { 13, 3, 0, -4, 14, 10, 13145 }, // ̏
+    { 5, 5, 0, 0, 13, 7, 13155 }, // ̒
+    { 5, 5, 0, 0, 12, 7, 13162 }, // ̓
+    { 5, 5, 0, 0, 12, 7, 13169 }, // ̔
+    { 3, 5, 0, 1, 0, 4, 13176 }, // ̘
+    { 3, 5, 0, 1, 0, 4, 13180 }, // ̙
+    { 7, 4, 0, 1, 13, 7, 13184 }, // ̚
+    { 3, 4, 0, 1, 11, 3, 13191 }, // ̛
+    { 2, 3, 0, 1, -1, 2, 13194 }, // ̜
+    { 4, 3, 0, 1, 2, 3, 13196 }, // ̝
+    { 4, 3, 0, 1, -1, 3, 13199 }, // ̞
+    { 4, 4, 0, 1, -1, 4, 13202 }, // ̟
+    { 8, 3, 0, 1, -2, 6, 13206 }, // ̠
+    { 4, 3, 0, 0, 1, 3, 13212 }, // ̣
+    { 9, 3, 0, 0, 0, 7, 13215 }, // ̤
+    { 4, 4, 0, 1, 13, 4, 13222 }, // ̥
+    { 5, 6, 0, 0, 3, 8, 13226 }, // ̦
+    { 4, 5, 0, 1, 1, 5, 13234 }, // ̧
+    { 4, 5, 0, 1, 0, 5, 13239 }, // ̨
+    { 2, 5, 0, 1, -1, 3, 13244 }, // ̩
+    { 6, 3, 0, 1, -1, 5, 13247 }, // ̪
+    { 7, 4, 0, 1, 0, 7, 13252 }, // ̬
+    { 7, 4, 0, 1, 0, 7, 13259 }, // ̭
+    { 6, 4, 0, 1, 13, 6, 13266 }, // ̰
+    { 7, 3, 0, 1, 13, 6, 13272 }, // ̱
+    { 7, 3, 0, 1, -1, 6, 13278 }, // ̲
+    { 6, 4, 0, 1, 13, 6, 13284 }, // ̴
+    { 8, 2, 0, 1, 6, 4, 13290 }, // ̵
+    { 2, 3, 0, 1, -1, 2, 13294 }, // ̹
+    { 6, 4, 0, 1, 0, 6, 13296 }, // ̺
+    { 5, 4, 0, 1, 0, 5, 13302 }, // ̻
+    { 6, 4, 0, 1, 0, 6, 13307 }, // ̼
+    { 5, 4, 0, 1, 13, 5, 13313 }, // ̽
+    { 6, 4, 0, 1, 13, 6, 13318 }, // ͂
+    { 3, 3, 0, 1, 14, 3, 13324 }, // ̓
+    { 9, 8, 0, 0, 18, 18, 13327 }, // ̈́
+    { 6, 3, 0, 1, 13, 5, 13345 }, // ͆
+    { 8, 6, 0, 1, 0, 12, 13350 }, // ͇
+    { 7, 5, 0, 1, 0, 9, 13362 }, // ͈
+    { 5, 5, 0, 1, -1, 7, 13371 }, // ͉
+    { 6, 10, 0, 1, 16, 15, 13378 }, // ͊
+    { 14, 8, 0, 0, 15, 28, 13393 }, // ͋
+    { 10, 9, 0, 1, 9, 23, 13421 }, // ͌
+    { 9, 3, 0, 1, -2, 7, 13444 }, // ͍
+    { 3, 3, 0, 1, 2, 3, 13451 }, // ͎
+    { 14, 3, 0, 1, 0, 11, 13454 }, // ͜
+    { 14, 3, 0, 1, 13, 11, 13465 }, // ͡
+    { 17, 5, 0, 1, -1, 22, 13476 }, // ͢
+    { 9, 17, 11, 1, 17, 39, 13498 }, // Ѐ
+    { 9, 16, 11, 1, 16, 36, 13537 }, // Ё
+    { 13, 14, 17, 2, 14, 46, 13573 }, // Ђ
+    { 9, 20, 11, 1, 20, 45, 13619 }, // Ѓ
+    { 12, 14, 15, 2, 13, 42, 13664 }, // Є
+    { 13, 16, 19, 3, 15, 52, 13706 }, // Ѕ
+    { 4, 15, 8, 2, 15, 15, 13758 }, // І
+    { 8, 20, 8, -1, 20, 40, 13773 }, // Ї
+    { 7, 19, 13, 3, 15, 34, 13813 }, // Ј
+    { 16, 14, 19, 2, 13, 56, 13847 }, // Љ
+    { 15, 13, 19, 2, 13, 49, 13903 }, // Њ
+    { 14, 14, 18, 3, 14, 49, 13952 }, // Ћ
+    { 11, 21, 17, 3, 21, 58, 14001 }, // Ќ
+    { 12, 19, 18, 3, 19, 57, 14059 }, // Ѝ
+    { 10, 20, 12, 1, 19, 50, 14116 }, // Ў
+    { 10, 16, 12, 1, 12, 40, 14166 }, // Џ
+    { 13, 14, 19, 3, 14, 46, 14206 }, // А
+    { 9, 13, 11, 1, 13, 30, 14252 }, // Б
+    { 10, 13, 11, 1, 13, 33, 14282 }, // В
+    { 9, 12, 11, 1, 12, 27, 14336 }, // Г
+    { 12, 14, 14, 1, 12, 42, 14363 }, // Д
+    { 9, 12, 11, 1, 12, 27, 14405 }, // Е
+    { 18, 15, 24, 3, 15, 68, 14432 }, // Ж
+    { 9, 13, 11, 1, 13, 30, 14500 }, // З
+    { 12, 15, 18, 3, 15, 45, 14530 }, // И
+    { 12, 20, 18, 3, 20, 60, 14575 }, // Й
+    { 11, 15, 17, 3, 15, 42, 14635 }, // К
+    { 10, 13, 12, 1, 12, 33, 14677 }, // Л
+    { 12, 12, 14, 1, 12, 36, 14710 }, // М
+    { 12, 15, 18, 3, 15, 45, 14746 }, // Н
+    { 13, 16, 19, 3, 15, 52, 14791 }, // О
+    { 9, 13, 11, 1, 13, 30, 14843 }, // П
+    { 10, 15, 15, 3, 15, 38, 14873 }, // Р
+    { 12, 17, 17, 2, 16, 51, 14911 }, // С
+    { 12, 14, 18, 3, 14, 42, 14962 }, // Т
+    { 10, 14, 12, 1, 13, 35, 15004 }, // У
+    { 13, 13, 15, 1, 13, 43, 15039 }, // Ф
+    { 13, 15, 19, 3, 15, 49, 15082 }, // Х
+    { 10, 16, 12, 1, 13, 40, 15131 }, // Ц
+    { 9, 12, 11, 1, 12, 27, 15171 }, // Ч
+    { 12, 13, 14, 1, 13, 39, 15198 }, // Ш
+    { 13, 16, 15, 1, 13, 52, 15237 }, // Щ
+    { 12, 12, 11, -2, 12, 36, 15289 }, // Ъ
+    { 16, 13, 19, 1, 13, 52, 15325 }, // Ы
+    { 9, 12, 11, 1, 12, 27, 15377 }, // Ь
+    { 12, 14, 15, 2, 13, 42, 15404 }, // Э
+    { 13, 13, 17, 2, 13, 43, 15446 }, // Ю
+    { 11, 14, 16, 3, 14, 39, 15489 }, // Я
+    { 10, 11, 14, 2, 11, 28, 15528 }, // а
+    { 10, 14, 12, 1, 14, 35, 15556 }, // б
+    { 8, 11, 12, 2, 11, 22, 15591 }, // в
+    { 8, 10, 10, 1, 10, 20, 15613 }, // г
+    { 11, 12, 13, 1, 10, 33, 15633 }, // д
+    { 10, 10, 14, 2, 10, 25, 15666 }, // е
+    { 16, 12, 20, 2, 12, 48, 15691 }, // ж
+    { 7, 9, 7, 0, 9, 16, 15739 }, // з
+    { 9, 10, 11, 1, 10, 23, 15755 }, // и
+    { 9, 13, 11, 1, 13, 30, 15778 }, // й
+    { 9, 10, 13, 2, 10, 23, 15808 }, // к
+    { 7, 10, 8, 1, 9, 18, 15831 }, // л
+    { 12, 11, 15, 2, 11, 33, 15849 }, // м
+    { 11, 11, 15, 2, 11, 31, 15882 }, // н
+    { 9, 10, 11, 1, 10, 23, 15913 }, // о
+    { 9, 10, 11, 1, 10, 23, 15936 }, // п
+    { 11, 15, 14, 1, 10, 42, 15959 }, // р
+    { 8, 12, 12, 2, 11, 24, 16001 }, // с
+    { 10, 9, 11, 1, 9, 23, 16025 }, // т
+    { 10, 15, 14, 2, 10, 38, 16048 }, // у
+    { 13, 14, 15, 1, 10, 46, 16086 }, // ф
+    { 10, 10, 12, 1, 10, 25, 16132 }, // х
+    { 10, 13, 12, 1, 10, 33, 16157 }, // ц
+    { 7, 9, 8, 0, 9, 16, 16190 }, // ч
+    { 12, 10, 14, 1, 10, 30, 16206 }, // ш
+    { 13, 13, 15, 1, 10, 43, 16236 }, // щ
+    { 11, 9, 13, 1, 9, 25, 16279 }, // ъ
+    { 12, 10, 14, 1, 10, 30, 16304 }, // ы
+    { 8, 10, 10, 1, 10, 20, 16334 }, // ь
+    { 9, 9, 11, 1, 9, 21, 16354 }, // э
+    { 11, 10, 13, 1, 10, 28, 16384 }, // ю
+    { 9, 9, 10, 1, 9, 21, 16412 }, // я
+    { 10, 16, 14, 2, 16, 40, 16433 }, // ѐ
+    { 9, 12, 11, 1, 12, 27, 16473 }, // ё
+    { 12, 18, 14, 0, 15, 54, 16500 }, // ђ
+    { 8, 14, 10, 1, 14, 28, 16554 }, // ѓ
+    { 9, 10, 11, 1, 9, 23, 16582 }, // є
+    { 9, 10, 13, 2, 10, 23, 16605 }, // ѕ
+    { 4, 15, 8, 2, 15, 15, 16628 }, // і
+    { 9, 14, 8, -1, 14, 32, 16643 }, // ї
+    { 7, 19, 11, 2, 15, 34, 16675 }, // ј
+    { 12, 10, 13, 1, 9, 30, 16709 }, // љ
+    { 11, 9, 13, 1, 9, 25, 16739 }, // њ
+    { 12, 15, 14, 0, 15, 45, 16764 }, // ћ
+    { 9, 15, 13, 2, 15, 34, 16809 }, // ќ
+    { 9, 14, 11, 1, 14, 32, 16843 }, // ѝ
+    { 10, 22, 14, 2, 17, 55, 16875 }, // ў
+    { 8, 12, 9, 0, 9, 24, 16930 }, // џ
+    { 10, 13, 14, 2, 12, 33, 16954 }, // Ѣ
+    { 10, 13, 12, 1, 12, 33, 16987 }, // ѣ
+    { 13, 12, 17, 2, 12, 39, 17020 }, // Ѫ
+    { 10, 9, 12, 1, 9, 23, 17059 }, // ѫ
+    { 12, 16, 18, 3, 15, 48, 17082 }, // Ѳ
+    { 10, 12, 14, 2, 12, 30, 17130 }, // ѳ
+    { 17, 19, 19, 3, 19, 81, 17160 }, // Ѵ
+    { 11, 12, 14, 2, 12, 33, 17241 }, // ѵ
+    { 6, 5, 0, 1, 15, 8, 17274 }, // ҆
+    { 9, 14, 11, 1, 14, 32, 17282 }, // Ґ
+    { 8, 12, 10, 1, 12, 24, 17314 }, // ґ
+    { 10, 12, 11, 0, 12, 30, 17338 }, // Ғ
+    { 7, 8, 8, 0, 8, 14, 17368 }, // ғ
+    { 10, 14, 11, 1, 14, 35, 17382 }, // Ҕ
+    { 7, 9, 7, 0, 9, 16, 17417 }, // ҕ
+    { 18, 18, 21, 2, 15, 81, 17433 }, // Җ
+    { 13, 12, 15, 1, 10, 39, 17514 }, // җ
+    { 8, 15, 12, 2, 13, 30, 17553 }, // Ҙ
+    { 7, 13, 7, 0, 9, 23, 17583 }, // ҙ
+    { 11, 17, 15, 2, 15, 47, 17606 }, // Қ
+    { 8, 12, 10, 1, 10, 24, 17653 }, // қ
+    { 13, 13, 16, 2, 13, 43, 17677 }, // Ҝ
+    { 10, 9, 12, 1, 9, 23, 17720 }, // ҝ
+    { 12, 15, 17, 2, 15, 45, 17743 }, // Ҟ
+    { 12, 14, 14, 0, 14, 42, 17788 }, // ҟ
+    { 16, 15, 17, -2, 15, 60, 17830 }, // Ҡ
+    { 11, 11, 12, -1, 11, 31, 17890 }, // ҡ
+    { 12, 17, 16, 2, 15, 51, 17921 }, // Ң
+    { 9, 13, 11, 1, 11, 30, 17972 }, // ң
+    { 17, 15, 18, 3, 15, 64, 18002 }, // Ҥ
+    { 12, 10, 12, 2, 10, 30, 18066 }, // ҥ
+    { 16, 14, 20, 2, 14, 56, 18096 }, // Ҧ
+    { 16, 16, 18, 1, 11, 64, 18152 }, // ҧ
+    { 16, 15, 20, 2, 14, 60, 18216 }, // Ҩ
+    { 13, 12, 16, 1, 11, 39, 18276 }, // ҩ
+    { 12, 19, 17, 2, 16, 57, 18315 }, // Ҫ
+    { 8, 13, 12, 2, 11, 26, 18372 }, // ҫ
+    { 12, 16, 16, 2, 14, 48, 18432 }, // Ҭ
+    { 9, 11, 11, 1, 10, 25, 18480 }, // ҭ
+    { 12, 14, 18, 3, 14, 42, 18505 }, // Ү
+    { 9, 12, 11, 1, 9, 27, 18547 }, // ү
+    { 12, 14, 18, 3, 14, 42, 18574 }, // Ұ
+    { 10, 13, 11, 0, 9, 33, 18616 }, // ұ
+    { 14, 18, 17, 2, 15, 63, 18649 }, // Ҳ
+    { 10, 12, 11, 1, 10, 30, 18712 }, // ҳ
+    { 14, 15, 18, 2, 12, 53, 18742 }, // Ҵ
+    { 11, 11, 13, 1, 8, 31, 18795 }, // ҵ
+    { 11, 16, 14, 1, 12, 44, 18826 }, // Ҷ
+    { 9, 12, 10, 0, 9, 27, 18870 }, // ҷ
+    { 10, 12, 12, 1, 12, 30, 18897 }, // Ҹ
+    { 7, 9, 8, 1, 9, 16, 18927 }, // ҹ
+    { 9, 14, 13, 2, 14, 32, 18943 }, // Һ
+    { 10, 15, 14, 2, 15, 38, 18975 }, // һ
+    { 15, 13, 16, 0, 13, 49, 19013 }, // Ҽ
+    { 11, 9, 12, 0, 9, 25, 19062 }, // ҽ
+    { 16, 16, 18, 1, 13, 64, 19087 }, // Ҿ
+    { 11, 12, 13, 1, 10, 33, 19151 }, // ҿ
+    { 4, 15, 8, 2, 15, 15, 19184 }, // Ӏ
+    { 18, 21, 24, 3, 21, 95, 19199 }, // Ӂ
+    { 16, 18, 20, 2, 18, 72, 19294 }, // ӂ
+    { 10, 17, 13, 2, 13, 43, 19366 }, // Ӄ
+    { 7, 12, 9, 1, 9, 21, 19409 }, // ӄ
+    { 12, 16, 12, 1, 13, 48, 19430 }, // Ӆ
+    { 8, 11, 9, 1, 9, 22, 19478 }, // ӆ
+    { 13, 20, 18, 3, 15, 65, 19500 }, // Ӈ
+    { 9, 14, 12, 2, 11, 32, 19565 }, // ӈ
+    { 13, 20, 18, 3, 15, 65, 19597 }, // Ӊ
+    { 9, 15, 12, 2, 11, 34, 19662 }, // ӊ
+    { 10, 15, 11, 0, 12, 38, 19696 }, // Ӌ
+    { 7, 11, 8, 1, 9, 20, 19734 }, // ӌ
+    { 16, 20, 21, 3, 15, 80, 19754 }, // Ӎ
+    { 11, 14, 14, 2, 10, 39, 19834 }, // ӎ
+    { 3, 12, 5, 1, 12, 9, 19873 }, // ӏ
+    { 13, 21, 19, 3, 21, 69, 19882 }, // Ӑ
+    { 10, 16, 14, 2, 16, 40, 19951 }, // ӑ
+    { 13, 19, 19, 3, 19, 62, 19991 }, // Ӓ
+    { 10, 15, 14, 2, 15, 38, 20053 }, // ӓ
+    { 19, 16, 24, 3, 15, 76, 20091 }, // Ӕ
+    { 16, 11, 20, 2, 11, 44, 20167 }, // ӕ
+    { 9, 18, 11, 1, 18, 41, 20211 }, // Ӗ
+    { 10, 17, 14, 2, 17, 43, 20252 }, // ӗ
+    { 10, 11, 14, 2, 10, 28, 20295 }, // Ә
+    { 9, 11, 14, 3, 10, 25, 20323 }, // ә
+    { 10, 18, 14, 2, 17, 45, 20348 }, // Ӛ
+    { 9, 12, 14, 3, 10, 27, 20393 }, // ӛ
+    { 18, 20, 22, 3, 20, 90, 20480 }, // Ӝ
+    { 16, 17, 20, 2, 17, 68, 20570 }, // ӝ
+    { 9, 17, 11, 1, 17, 39, 20638 }, // Ӟ
+    { 9, 14, 7, 0, 14, 32, 20677 }, // ӟ
+    { 8, 14, 10, 1, 13, 28, 20709 }, // Ӡ
+    { 8, 13, 10, 1, 9, 26, 20737 }, // ӡ
+    { 12, 18, 18, 3, 18, 54, 20763 }, // Ӣ
+    { 9, 13, 11, 1, 13, 30, 20817 }, // ӣ
+    { 12, 19, 18, 3, 19, 57, 20847 }, // Ӥ
+    { 9, 14, 11, 1, 14, 32, 20904 }, // ӥ
+    { 13, 20, 19, 3, 19, 65, 20936 }, // Ӧ
+    { 9, 15, 11, 1, 15, 34, 21001 }, // ӧ
+    { 12, 13, 18, 3, 12, 39, 21035 }, // Ө
+    { 10, 10, 14, 2, 10, 25, 21074 }, // ө
+    { 12, 20, 18, 3, 19, 60, 21099 }, // Ӫ
+    { 10, 16, 14, 2, 16, 40, 21159 }, // ӫ
+    { 12, 19, 15, 2, 18, 57, 21199 }, // Ӭ
+    { 10, 14, 11, 0, 14, 35, 21256 }, // ӭ
+    { 10, 18, 12, 1, 17, 45, 21291 }, // Ӯ
+    { 10, 21, 14, 2, 16, 53, 21336 }, // ӯ
+    { 10, 19, 12, 1, 18, 48, 21389 }, // Ӱ
+    { 10, 21, 14, 2, 16, 53, 21437 }, // ӱ
+    { 13, 19, 12, 0, 18, 62, 21490 }, // Ӳ
+    { 13, 22, 14, 1, 17, 72, 21552 }, // ӳ
+    { 9, 17, 11, 1, 17, 39, 21624 }, // Ӵ
+    { 8, 14, 8, -1, 14, 28, 21663 }, // ӵ
+    { 9, 15, 11, 1, 12, 34, 21691 }, // Ӷ
+    { 7, 10, 8, 0, 8, 18, 21725 }, // ӷ
+    { 16, 18, 19, 1, 18, 72, 21743 }, // Ӹ
+    { 12, 15, 14, 1, 15, 45, 21815 }, // ӹ
+    { 16, 17, 19, 3, 15, 68, 21860 }, // Ӽ
+    { 11, 12, 13, 2, 10, 33, 21928 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 21961 }, //  
+    { 0, 0, 22, 0, 0, 0, 21961 }, //  
+    { 0, 0, 14, 0, 0, 0, 21961 }, //  
+    { 0, 0, 22, 0, 0, 0, 21961 }, //  
+    { 0, 0, 11, 0, 0, 0, 21961 }, //  
+    { 0, 0, 10, 0, 0, 0, 21961 }, //  
+    { 0, 0, 8, 0, 0, 0, 21961 }, //  
+    { 0, 0, 11, 0, 0, 0, 21961 }, //  
+    { 0, 0, 4, 0, 0, 0, 21961 }, //  
+    { 0, 0, 9, 0, 0, 0, 21961 }, //  
+    { 0, 0, 8, 0, 0, 0, 21961 }, //  
+    { 0, 0, 5, 0, 0, 0, 21961 }, // ​
+    { 0, 0, 0, 0, 0, 0, 21961 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 21961 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 21961 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 21961 }, // ‏
+    { 8, 2, 9, 1, 6, 4, 21961 }, // ‐
+    { 8, 2, 9, 1, 6, 4, 21965 }, // ‑
+    { 12, 2, 12, 1, 6, 6, 21969 }, // ‒
+    { 11, 3, 13, 1, 6, 9, 21975 }, // –
+    { 17, 3, 19, 1, 6, 13, 21984 }, // —
+    { 17, 3, 19, 1, 6, 13, 21997 }, // ―
+    { 7, 15, 9, 1, 12, 27, 22010 }, // ‖
+    { 13, 6, 13, 1, -1, 20, 22037 }, // ‗
+    { 5, 6, 6, 0, 15, 8, 22057 }, // ‘
+    { 5, 6, 6, 0, 15, 8, 22065 }, // ’
+    { 5, 6, 5, 0, 3, 8, 22073 }, // ‚
+    { 5, 6, 6, 0, 15, 8, 22081 }, // ‛
+    { 9, 6, 9, 0, 15, 14, 22089 }, // “
+    { 9, 6, 9, 0, 15, 14, 22103 }, // ”
+    { 5, 6, 5, 0, 3, 8, 22117 }, // „
+    { 9, 5, 9, 0, 15, 12, 22125 }, // ‟
+    { 9, 22, 10, 0, 17, 50, 22137 }, // †
+    { 10, 22, 10, 0, 17, 55, 22187 }, // ‡
+    { 11, 10, 8, -1, 12, 28, 22242 }, // •
+    { 5, 6, 7, 1, 8, 8, 22270 }, // ‣
+    { 4, 3, 4, 0, 3, 3, 22278 }, // ․
+    { 4, 3, 4, 0, 3, 3, 22281 }, // ‥
+    { 15, 3, 16, 0, 3, 12, 22284 }, // …
+    { 3, 2, 4, 1, 6, 2, 22296 }, // ‧
+    { 0, 0, 21, 0, 0, 0, 22298 }, //  
+    { 11, 15, 18, 4, 13, 42, 22298 }, // ‰
+    { 5, 6, 5, 0, 15, 8, 22340 }, // ′
+    { 9, 6, 9, 0, 15, 14, 22348 }, // ″
+    { 14, 6, 14, 0, 14, 21, 22362 }, // ‴
+    { 5, 6, 6, 0, 14, 8, 22383 }, // ‵
+    { 8, 6, 9, 0, 14, 12, 22391 }, // ‶
+    { 14, 6, 14, 0, 14, 21, 22403 }, // ‷
+    { 7, 3, 9, 1, 13, 6, 22424 }, // ‸
+    { 5, 8, 7, 1, 8, 10, 22430 }, // ‹
+    { 5, 8, 7, 1, 8, 10, 22440 }, // ›
+    { 18, 17, 22, 3, 15, 77, 22450 }, // ※
+    { 5, 17, 6, 0, 17, 22, 22528 }, // ‼
+    { 10, 21, 12, 1, 20, 53, 22550 }, // ‽
+    { 8, 2, 9, 1, 14, 4, 22603 }, // ‾
+    { 7, 4, 9, 1, 12, 7, 22607 }, // ‿
+    { 11, 12, 13, 1, 16, 33, 22614 }, // ⁂
+    { 10, 14, 18, 4, 13, 35, 22647 }, // ⁄
+    { 19, 19, 21, 1, 19, 91, 22682 }, // ⁇
+    { 13, 19, 17, 1, 19, 62, 22773 }, // ⁈
+    { 13, 20, 13, 0, 19, 65, 22835 }, // ⁉
+    { 10, 26, 12, 1, 18, 65, 22900 }, // ⁒
+    { 0, 0, 80, 0, 0, 0, 22965 }, //  
+    { 5, 7, 5, 0, 14, 9, 22965 }, // ⁰
+    { 5, 6, 5, 0, 14, 8, 22974 }, // ⁴
+    { 5, 7, 5, 0, 14, 9, 22982 }, // ⁵
+    { 5, 7, 5, 0, 14, 9, 22991 }, // ⁶
+    { 5, 7, 6, 0, 14, 9, 23000 }, // ⁷
+    { 5, 7, 6, 0, 14, 9, 23009 }, // ⁸
+    { 5, 7, 6, 0, 14, 9, 23018 }, // ⁹
+    { 10, 10, 14, 2, 10, 25, 23027 }, // ⁿ
+    { 7, 9, 8, 0, 9, 16, 23052 }, // ₀
+    { 5, 7, 5, 0, 4, 9, 23068 }, // ₁
+    { 5, 7, 5, 0, 4, 9, 23077 }, // ₂
+    { 5, 7, 5, 0, 4, 9, 23086 }, // ₃
+    { 5, 7, 6, 0, 4, 9, 23095 }, // ₄
+    { 5, 7, 5, 0, 4, 9, 23104 }, // ₅
+    { 5, 7, 6, 0, 4, 9, 23113 }, // ₆
+    { 5, 7, 5, 0, 4, 9, 23122 }, // ₇
+    { 6, 7, 6, 0, 4, 11, 23131 }, // ₈
+    { 5, 7, 6, 0, 4, 9, 23142 }, // ₉
+    { 6, 23, 7, 1, 17, 35, 23151 }, // ₍
+    { 6, 23, 7, 0, 17, 35, 23186 }, // ₎
+    { 12, 23, 17, 2, 19, 69, 23221 }, // ₡
+    { 12, 17, 17, 2, 16, 51, 23290 }, // ₢
+    { 11, 16, 12, 0, 16, 44, 23341 }, // ₤
+    { 16, 15, 18, 1, 15, 60, 23385 }, // ₦
+    { 13, 15, 15, 1, 15, 49, 23445 }, // ₧
+    { 17, 15, 19, 2, 15, 64, 23494 }, // ₨
+    { 14, 15, 14, 0, 15, 53, 23558 }, // ₩
+    { 14, 13, 18, 2, 13, 46, 23611 }, // ₪
+    { 11, 14, 11, 1, 14, 39, 23657 }, // ₫
+    { 11, 16, 12, 1, 14, 44, 23696 }, // €
+    { 12, 14, 18, 3, 14, 42, 23740 }, // ₮
+    { 15, 15, 11, 0, 15, 57, 23782 }, // ₱
+    { 14, 21, 19, 2, 18, 74, 23839 }, // ₲
+    { 15, 16, 15, 1, 15, 60, 23913 }, // ₴
+    { 8, 13, 12, 2, 12, 26, 23973 }, // ₵
+    { 12, 15, 18, 3, 15, 45, 23999 }, // ₸
+    { 8, 13, 10, 1, 13, 26, 24044 }, // ₹
+    { 10, 13, 11, 1, 12, 33, 24070 }, // ₺
+    { 11, 13, 10, 0, 13, 36, 24103 }, // ₼
+    { 14, 15, 15, -1, 15, 53, 24139 }, // ₽
+    { 11, 11, 13, 1, 10, 31, 24192 }, // ←
+    { 11, 10, 13, 1, 10, 28, 24223 }, // ↑
+    { 11, 11, 13, 1, 10, 31, 24251 }, // →
+    { 11, 10, 13, 1, 10, 28, 24282 }, // ↓
+    { 13, 9, 15, 1, 9, 30, 24310 }, // ↔
+    { 9, 13, 11, 1, 14, 30, 24340 }, // ↕
+    { 9, 8, 11, 1, 8, 18, 24370 }, // ↖
+    { 9, 8, 11, 1, 8, 18, 24388 }, // ↗
+    { 9, 9, 11, 1, 9, 21, 24406 }, // ↘
+    { 9, 9, 11, 1, 9, 21, 24427 }, // ↙
+    { 12, 11, 14, 1, 10, 33, 24448 }, // ⇐
+    { 13, 12, 15, 1, 12, 39, 24481 }, // ⇑
+    { 12, 11, 14, 1, 10, 33, 24520 }, // ⇒
+    { 13, 13, 15, 1, 12, 43, 24576 }, // ⇓
+    { 14, 11, 16, 1, 10, 39, 24619 }, // ⇔
+    { 11, 14, 13, 1, 9, 39, 24658 }, // ⇕
+    { 10, 14, 11, 1, 14, 35, 24697 }, // ∂
+    { 17, 17, 19, 1, 16, 73, 24732 }, // ∅
+    { 12, 13, 14, 1, 13, 39, 24805 }, // ∆
+    { 10, 12, 12, 1, 12, 30, 24844 }, // ∏
+    { 10, 12, 12, 1, 12, 30, 24874 }, // ∐
+    { 8, 13, 10, 1, 12, 26, 24904 }, // ∑
+    { 8, 3, 10, 1, 6, 6, 24930 }, // −
+    { 14, 14, 16, 1, 13, 49, 24936 }, // √
+    { 13, 8, 15, 1, 10, 26, 24985 }, // ∞
+    { 14, 19, 14, 0, 15, 67, 25011 }, // ∫
+    { 4, 10, 5, 0, 10, 10, 25078 }, // ∶
+    { 10, 9, 13, 1, 9, 23, 25088 }, // ≈
+    { 11, 15, 18, 4, 13, 42, 25111 }, // ≠
+    { 13, 13, 14, 1, 12, 43, 25153 }, // ≤
+    { 13, 13, 14, 1, 12, 43, 25196 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
@@ -2369,4 +1952,9 @@ static const EpdFontData opendyslexic_8_regular = {
     22,
     -9,
     true,
+    opendyslexic_8_regularBlockOffsets,
+    opendyslexic_8_regularDirectGlyphs,
+    opendyslexic_8_regularGlyphPages,
+    35,
+    opendyslexic_8_regularPageGlyphs,
 };
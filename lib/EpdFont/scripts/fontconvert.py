@@ -5,6 +5,7 @@ import sys
 import re
 import math
 import argparse
+import struct
 from collections import namedtuple
 
 # Originally from https://github.com/vroland/epdiy
@@ -15,7 +16,21 @@ parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
+parser.add_argument("--epdfont", dest="epdfont", action="store", help="write a binary .epdfont file for the SD card to this path instead of printing a header.")
+parser.add_argument("--compress", dest="compress", action="store_true", help="store the bitmaps in the header as deflated blocks, inflated as glyphs are drawn.")
 args = parser.parse_args()
+if args.epdfont and args.compress:
+    parser.error("--compress only applies to headers")
+
+# Glyph bitmaps in .epdfont files are read a page at a time; no glyph may cross a page
+EPDFONT_VERSION = 1
+EPDFONT_PAGE_SIZE = 1024
+# Compressed bitmaps are inflated a block at a time, same as EPD_FONT_COMPRESSED_BLOCK_SIZE in EpdFontData.h
+COMPRESSED_BLOCK_SIZE = 2048
+# Glyph lookup tables, same as EPD_FONT_DIRECT_GLYPHS and EPD_FONT_GLYPH_PAGE_SHIFT in EpdFontData.h
+DIRECT_GLYPHS = 0x250
+GLYPH_PAGE_SHIFT = 8
+page_size = EPDFONT_PAGE_SIZE if args.epdfont else COMPRESSED_BLOCK_SIZE if args.compress else None
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
 
@@ -247,6 +262,11 @@ for i_start, i_end in intervals:
 
         # Build output data
         packed = bytes(pixels)
+        if page_size and len(packed) > 0:
+            if len(packed) > page_size:
+                sys.exit(f"glyph {hex(code_point)} has {len(packed)} bytes of bitmap, more than a page")
+            if total_size // page_size != (total_size + len(packed) - 1) // page_size:
+                total_size = (total_size // page_size + 1) * page_size
         glyph = GlyphProps(
             width = bitmap.width,
             height = bitmap.rows,
@@ -270,11 +290,64 @@ for index, glyph in enumerate(all_glyphs):
     glyph_data.extend([b for b in packed])
     glyph_props.append(props)
 
+# Bitmaps laid out by offset, with the gaps that keep glyphs from crossing pages
+bitmaps = bytearray(total_size)
+for props, packed in all_glyphs:
+    bitmaps[props.data_offset:props.data_offset + len(packed)] = packed
+
+if args.epdfont:
+    # Layout in docs/file-formats.md, read by EpdFontFile
+    with open(args.epdfont, "wb") as out:
+        out.write(struct.pack("<4sHHHBBhhIII", b"EPDF", EPDFONT_VERSION, 1 if is2Bit else 0, EPDFONT_PAGE_SIZE,
+                              norm_ceil(face.size.height), 0, norm_ceil(face.size.ascender),
+                              norm_floor(face.size.descender), len(intervals), len(glyph_props), len(bitmaps)))
+        offset = 0
+        for i_start, i_end in intervals:
+            out.write(struct.pack("<III", i_start, i_end, offset))
+            offset += i_end - i_start + 1
+        for g in glyph_props:
+            out.write(struct.pack("<BBBxhhHxxI", g.width, g.height, g.advance_x, g.left, g.top, g.data_length,
+                                  g.data_offset))
+        out.write(bitmaps)
+    print(f"Wrote {args.epdfont}: {len(glyph_props)} glyphs, {len(bitmaps)} bytes of bitmaps", file=sys.stderr)
+    sys.exit(0)
+
+block_offsets = []
+if args.compress:
+    # Raw deflate streams, one per block, inflated by EpdGlyphCache
+    glyph_data = []
+    for start in range(0, total_size, COMPRESSED_BLOCK_SIZE):
+        block_offsets.append(len(glyph_data))
+        compressor = zlib.compressobj(9, zlib.DEFLATED, -15)
+        glyph_data.extend(compressor.compress(bitmaps[start:start + COMPRESSED_BLOCK_SIZE]) + compressor.flush())
+    block_offsets.append(len(glyph_data))
+
+# Glyph index plus one by code point: a flat table up to DIRECT_GLYPHS, then pages for those with glyphs in them
+glyph_numbers = {}
+offset = 0
+for i_start, i_end in intervals:
+    for code_point in range(i_start, i_end + 1):
+        glyph_numbers[code_point] = offset + code_point - i_start + 1
+    offset += i_end - i_start + 1
+if offset >= 0xFFFF:
+    sys.exit(f"{offset} glyphs don't fit the 16-bit glyph lookup tables")
+direct_glyphs = [glyph_numbers.get(cp, 0) for cp in range(DIRECT_GLYPHS)]
+lookup_page_size = 1 << GLYPH_PAGE_SHIFT
+glyph_pages = []
+page_glyphs = []
+for cp in sorted(cp for cp in glyph_numbers if cp >= DIRECT_GLYPHS):
+    page = cp >> GLYPH_PAGE_SHIFT
+    if page >= len(glyph_pages) or glyph_pages[page] == 0:
+        glyph_pages.extend([0] * (page + 1 - len(glyph_pages)))
+        glyph_pages[page] = len(page_glyphs) // lookup_page_size + 1
+        page_start = page << GLYPH_PAGE_SHIFT
+        page_glyphs.extend(glyph_numbers.get(c, 0) for c in range(page_start, page_start + lookup_page_size))
+
 print(f"""/**
  * generated by fontconvert.py
  * name: {font_name}
  * size: {size}
- * mode: {'2-bit' if is2Bit else '1-bit'}
+ * mode: {'2-bit' if is2Bit else '1-bit'}{', compressed' if args.compress else ''}
  * Command used: {' '.join(sys.argv)}
  */
 #pragma once
@@ -286,6 +359,27 @@ for c in chunks(glyph_data, 16):
     print ("    " + " ".join(f"0x{b:02X}," for b in c))
 print ("};\n");
 
+if args.compress:
+    print(f"static const uint32_t {font_name}BlockOffsets[{len(block_offsets)}] = {{")
+    for c in chunks(block_offsets, 8):
+        print ("    " + " ".join(f"{o}," for o in c))
+    print ("};\n");
+
+print(f"static const uint16_t {font_name}DirectGlyphs[{len(direct_glyphs)}] = {{")
+for c in chunks(direct_glyphs, 16):
+    print ("    " + " ".join(f"{n}," for n in c))
+print ("};\n");
+
+if glyph_pages:
+    print(f"static const uint16_t {font_name}GlyphPages[{len(glyph_pages)}] = {{")
+    for c in chunks(glyph_pages, 16):
+        print ("    " + " ".join(f"{n}," for n in c))
+    print ("};\n");
+    print(f"static const uint16_t {font_name}PageGlyphs[{len(page_glyphs)}] = {{")
+    for c in chunks(page_glyphs, 16):
+        print ("    " + " ".join(f"{n}," for n in c))
+    print ("};\n");
+
 print(f"static const EpdGlyph {font_name}Glyphs[] = {{")
 for i, g in enumerate(glyph_props):
     print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
@@ -307,4 +401,9 @@ print(f"    {norm_ceil(face.size.height)},")
 print(f"    {norm_ceil(face.size.ascender)},")
 print(f"    {norm_floor(face.size.descender)},")
 print(f"    {'true' if is2Bit else 'false'},")
+print(f"    {font_name}BlockOffsets," if args.compress else "    nullptr,")
+print(f"    {font_name}DirectGlyphs,")
+print(f"    {font_name}GlyphPages," if glyph_pages else "    nullptr,")
+print(f"    {len(glyph_pages)},")
+print(f"    {font_name}PageGlyphs," if glyph_pages else "    nullptr,")
 print("};")
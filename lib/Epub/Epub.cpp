@@ -103,50 +103,24 @@ bool Epub::parseTocNcxFile() const {
 
   Serial.printf("[%lu] [EBP] Parsing toc ncx file: %s\n", millis(), tocNcxItem.c_str());
 
-  const auto tmpNcxPath = getCachePath() + "/toc.ncx";
-  FsFile tempNcxFile;
-  if (!Storage.openFileForWrite("EBP", tmpNcxPath, tempNcxFile)) {
+  size_t ncxSize;
+  if (!getItemSize(tocNcxItem, &ncxSize)) {
+    Serial.printf("[%lu] [EBP] Could not get size of toc ncx\n", millis());
     return false;
   }
-  readItemContentsToStream(tocNcxItem, tempNcxFile, 1024);
-  tempNcxFile.close();
-  if (!Storage.openFileForRead("EBP", tmpNcxPath, tempNcxFile)) {
-    return false;
-  }
-  const auto ncxSize = tempNcxFile.size();
 
   TocNcxParser ncxParser(contentBasePath, ncxSize, bookMetadataCache.get());
 
   if (!ncxParser.setup()) {
     Serial.printf("[%lu] [EBP] Could not setup toc ncx parser\n", millis());
-    tempNcxFile.close();
     return false;
   }
 
-  const auto ncxBuffer = static_cast<uint8_t*>(malloc(1024));
-  if (!ncxBuffer) {
-    Serial.printf("[%lu] [EBP] Could not allocate memory for toc ncx parser\n", millis());
-    tempNcxFile.close();
+  if (!readItemContentsToStream(tocNcxItem, ncxParser, 1024)) {
+    Serial.printf("[%lu] [EBP] Could not process all toc ncx data\n", millis());
     return false;
   }
 
-  while (tempNcxFile.available()) {
-    const auto readSize = tempNcxFile.read(ncxBuffer, 1024);
-    if (readSize == 0) break;
-    const auto processedSize = ncxParser.write(ncxBuffer, readSize);
-
-    if (processedSize != readSize) {
-      Serial.printf("[%lu] [EBP] Could not process all toc ncx data\n", millis());
-      free(ncxBuffer);
-      tempNcxFile.close();
-      return false;
-    }
-  }
-
-  free(ncxBuffer);
-  tempNcxFile.close();
-  Storage.remove(tmpNcxPath.c_str());
-
   Serial.printf("[%lu] [EBP] Parsed TOC items\n", millis());
   return true;
 }
@@ -160,17 +134,11 @@ bool Epub::parseTocNavFile() const {
 
   Serial.printf("[%lu] [EBP] Parsing toc nav file: %s\n", millis(), tocNavItem.c_str());
 
-  const auto tmpNavPath = getCachePath() + "/toc.nav";
-  FsFile tempNavFile;
-  if (!Storage.openFileForWrite("EBP", tmpNavPath, tempNavFile)) {
+  size_t navSize;
+  if (!getItemSize(tocNavItem, &navSize)) {
+    Serial.printf("[%lu] [EBP] Could not get size of toc nav\n", millis());
     return false;
   }
-  readItemContentsToStream(tocNavItem, tempNavFile, 1024);
-  tempNavFile.close();
-  if (!Storage.openFileForRead("EBP", tmpNavPath, tempNavFile)) {
-    return false;
-  }
-  const auto navSize = tempNavFile.size();
 
   // Note: We can't use `contentBasePath` here as the nav file may be in a different folder to the content.opf
   // and the HTMLX nav file will have hrefs relative to itself
@@ -182,28 +150,11 @@ bool Epub::parseTocNavFile() const {
     return false;
   }
 
-  const auto navBuffer = static_cast<uint8_t*>(malloc(1024));
-  if (!navBuffer) {
-    Serial.printf("[%lu] [EBP] Could not allocate memory for toc nav parser\n", millis());
+  if (!readItemContentsToStream(tocNavItem, navParser, 1024)) {
+    Serial.printf("[%lu] [EBP] Could not process all toc nav data\n", millis());
     return false;
   }
 
-  while (tempNavFile.available()) {
-    const auto readSize = tempNavFile.read(navBuffer, 1024);
-    const auto processedSize = navParser.write(navBuffer, readSize);
-
-    if (processedSize != readSize) {
-      Serial.printf("[%lu] [EBP] Could not process all toc nav data\n", millis());
-      free(navBuffer);
-      tempNavFile.close();
-      return false;
-    }
-  }
-
-  free(navBuffer);
-  tempNavFile.close();
-  Storage.remove(tmpNavPath.c_str());
-
   Serial.printf("[%lu] [EBP] Parsed TOC nav items\n", millis());
   return true;
 }
@@ -235,30 +186,12 @@ void Epub::parseCssFiles() const {
     for (const auto& cssPath : cssFiles) {
       Serial.printf("[%lu] [EBP] Parsing CSS file: %s\n", millis(), cssPath.c_str());
 
-      // Extract CSS file to temp location
-      const auto tmpCssPath = getCachePath() + "/.tmp.css";
-      FsFile tempCssFile;
-      if (!Storage.openFileForWrite("EBP", tmpCssPath, tempCssFile)) {
-        Serial.printf("[%lu] [EBP] Could not create temp CSS file\n", millis());
-        continue;
-      }
-      if (!readItemContentsToStream(cssPath, tempCssFile, 1024)) {
+      ZipFile::EntryReader cssReader;
+      if (!openItemReader(cssPath, cssReader)) {
         Serial.printf("[%lu] [EBP] Could not read CSS file: %s\n", millis(), cssPath.c_str());
-        tempCssFile.close();
-        Storage.remove(tmpCssPath.c_str());
         continue;
       }
-      tempCssFile.close();
-
-      // Parse the CSS file
-      if (!Storage.openFileForRead("EBP", tmpCssPath, tempCssFile)) {
-        Serial.printf("[%lu] [EBP] Could not open temp CSS file for reading\n", millis());
-        Storage.remove(tmpCssPath.c_str());
-        continue;
-      }
-      cssParser->loadFromStream(tempCssFile);
-      tempCssFile.close();
-      Storage.remove(tmpCssPath.c_str());
+      cssParser->loadFromStream(cssReader);
     }
 
     // Save to cache for next time
@@ -273,6 +206,25 @@ void Epub::parseCssFiles() const {
   }
 }
 
+std::string Epub::getZipIndexPath() const { return cachePath + "/zip.idx"; }
+
+bool Epub::loadZipIndex() {
+  zipIndex.reset(new ZipFile::EntryIndex());
+  if (zipIndex->load(getZipIndexPath())) {
+    return true;
+  }
+
+  // Missing (first load or cache from an older build) or stale, (re)build it from the central directory
+  const uint32_t indexStart = millis();
+  if (!ZipFile(filepath).buildEntryIndex(getZipIndexPath()) || !zipIndex->load(getZipIndexPath())) {
+    Serial.printf("[%lu] [EBP] Could not build ZIP entry index, falling back to central directory lookups\n", millis());
+    zipIndex.reset();
+    return false;
+  }
+  Serial.printf("[%lu] [EBP] ZIP entry index built in %lu ms\n", millis(), millis() - indexStart);
+  return true;
+}
+
 // load in the meta data for the epub file
 bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
   Serial.printf("[%lu] [EBP] Loading ePub: %s\n", millis(), filepath.c_str());
@@ -284,6 +236,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   // Try to load existing cache first
   if (bookMetadataCache->load()) {
+    loadZipIndex();
     if (!skipLoadingCss && !loadCssRulesFromCache()) {
       Serial.printf("[%lu] [EBP] Warning: CSS rules cache not found, attempting to parse CSS files\n", millis());
       // to get CSS file list
@@ -308,6 +261,9 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   const uint32_t indexingStart = millis();
 
+  // Index the archive first so every item read below is a binary search plus one seek
+  loadZipIndex();
+
   // Begin building cache - stream entries to disk immediately
   if (!bookMetadataCache->beginWrite()) {
     Serial.printf("[%lu] [EBP] Could not begin writing cache\n", millis());
@@ -371,7 +327,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   // Build final book.bin
   const uint32_t buildStart = millis();
-  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
+  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata, zipIndex.get())) {
     Serial.printf("[%lu] [EBP] Could not update mappings and sizes\n", millis());
     return false;
   }
@@ -399,6 +355,11 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 }
 
 bool Epub::clearCache() const {
+  if (zipIndex) {
+    // Release the index file handle before its directory is removed
+    zipIndex->close();
+  }
+
   if (!Storage.exists(cachePath.c_str())) {
     Serial.printf("[%lu] [EPB] Cache does not exist, no action needed\n", millis());
     return true;
@@ -587,7 +548,8 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 
   const std::string path = FsHelpers::normalisePath(itemHref);
 
-  const auto content = ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
+  const auto content =
+      ZipFile(filepath, zipIndex.get(), inflateContext.get()).readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
     Serial.printf("[%lu] [EBP] Failed to read item %s\n", millis(), path.c_str());
     return nullptr;
@@ -603,12 +565,26 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  return ZipFile(filepath, zipIndex.get(), inflateContext.get()).readFileToStream(path.c_str(), out, chunkSize);
+}
+
+bool Epub::openItemReader(const std::string& itemHref, ZipFile::EntryReader& reader, const size_t chunkSize) const {
+  if (itemHref.empty()) {
+    Serial.printf("[%lu] [EBP] Failed to open item, empty href\n", millis());
+    return false;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  if (!ZipFile(filepath, zipIndex.get(), inflateContext.get()).openEntry(path.c_str(), reader, chunkSize)) {
+    Serial.printf("[%lu] [EBP] Failed to open item %s\n", millis(), path.c_str());
+    return false;
+  }
+  return true;
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
+  return ZipFile(filepath, zipIndex.get()).getInflatedFileSize(path.c_str(), size);
 }
 
 int Epub::getSpineItemsCount() const {
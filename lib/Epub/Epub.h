@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Print.h>
+#include <ZipFile.h>
 
 #include <memory>
 #include <string>
@@ -10,8 +11,6 @@
 #include "Epub/BookMetadataCache.h"
 #include "Epub/css/CssParser.h"
 
-class ZipFile;
-
 class Epub {
   // the ncx file (EPUB 2)
   std::string tocNcxItem;
@@ -25,6 +24,10 @@ class Epub {
   std::string cachePath;
   // Spine and TOC cache
   std::unique_ptr<BookMetadataCache> bookMetadataCache;
+  // Persistent ZIP entry index, lets item lookups skip the central directory
+  std::unique_ptr<ZipFile::EntryIndex> zipIndex;
+  // Inflate buffers reused by every item read while the book is open
+  std::unique_ptr<ZipFile::InflateContext> inflateContext;
   // CSS parser for styling
   std::unique_ptr<CssParser> cssParser;
   // CSS files
@@ -37,9 +40,12 @@ class Epub {
   void parseCssFiles() const;
   std::string getCssRulesCache() const;
   bool loadCssRulesFromCache() const;
+  std::string getZipIndexPath() const;
+  bool loadZipIndex();
 
  public:
-  explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
+  explicit Epub(std::string filepath, const std::string& cacheDir)
+      : filepath(std::move(filepath)), inflateContext(new ZipFile::InflateContext()) {
     // create a cache key based on the filepath
     cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
   }
@@ -61,6 +67,7 @@ class Epub {
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  bool openItemReader(const std::string& itemHref, ZipFile::EntryReader& reader, size_t chunkSize = 1024) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
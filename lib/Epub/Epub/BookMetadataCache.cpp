@@ -96,7 +96,8 @@ bool BookMetadataCache::endWrite() {
   return true;
 }
 
-bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata) {
+bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata,
+                                     ZipFile::EntryIndex* zipIndex) {
   // Open all three files, writing to meta, reading from spine and toc
   if (!Storage.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
     return false;
@@ -164,7 +165,7 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     }
   }
 
-  ZipFile zip(epubPath);
+  ZipFile zip(epubPath, zipIndex);
   // Pre-open zip file to speed up size calculations
   if (!zip.open()) {
     Serial.printf("[%lu] [BMC] Could not open EPUB zip for size calculations\n", millis());
@@ -184,7 +185,8 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   std::vector<uint32_t> spineSizes;
   bool useBatchSizes = false;
 
-  if (spineCount >= LARGE_SPINE_THRESHOLD) {
+  // With a loaded entry index every size lookup is already a binary search, so the batch scan isn't needed
+  if (spineCount >= LARGE_SPINE_THRESHOLD && !(zipIndex && zipIndex->isLoaded())) {
     Serial.printf("[%lu] [BMC] Using batch size lookup for %d spine items\n", millis(), spineCount);
 
     std::vector<ZipFile::SizeTarget> targets;
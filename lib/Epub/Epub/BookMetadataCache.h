@@ -1,6 +1,7 @@
 #pragma once
 
 #include <HalStorage.h>
+#include <ZipFile.h>
 
 #include <algorithm>
 #include <string>
@@ -100,7 +101,7 @@ class BookMetadataCache {
   bool cleanupTmpFiles() const;
 
   // Post-processing to update mappings and sizes
-  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata);
+  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata, ZipFile::EntryIndex* zipIndex = nullptr);
 
   // Reading phase (read mode)
   bool load();
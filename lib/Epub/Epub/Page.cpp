@@ -1,8 +1,11 @@
 #include "Page.h"
 
+#include <GfxRenderer.h>
 #include <HardwareSerial.h>
 #include <Serialization.h>
 
+#include <cstring>
+
 void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
   block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
 }
@@ -67,3 +70,112 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
 
   return page;
 }
+
+bool PageView::load(FsFile& file, const uint32_t offset, const uint32_t size) {
+  clear();
+  if (size > MAX_PAGE_BYTES) {
+    Serial.printf("[%lu] [PGE] Page view failed: %u bytes is too large for a page\n", millis(), size);
+    return false;
+  }
+  buffer.resize(size);
+  file.seek(offset);
+  if (file.read(buffer.data(), size) != static_cast<int>(size)) {
+    Serial.printf("[%lu] [PGE] Failed to read page bytes (%u at %u)\n", millis(), size, offset);
+    clear();
+    return false;
+  }
+  if (!indexLines()) {
+    clear();
+    return false;
+  }
+  return true;
+}
+
+void PageView::clear() {
+  // Keep capacity, the next page reuses it
+  buffer.clear();
+  lines.clear();
+}
+
+void PageView::release() {
+  std::vector<uint8_t>().swap(buffer);
+  std::vector<LineRef>().swap(lines);
+}
+
+// Validates the page layout once and rewrites every length-prefixed word in place as a C string (the 4 prefix bytes
+// become the terminator plus padding), so render() never has to bounds-check or copy
+bool PageView::indexLines() {
+  static_assert(sizeof(EpdFontFamily::Style) == 1, "PageView reads word styles as bytes");
+  uint8_t* data = buffer.data();
+  const size_t size = buffer.size();
+  size_t pos = 0;
+
+  const auto readU16 = [&](uint16_t* value) {
+    if (pos + sizeof(uint16_t) > size) return false;
+    memcpy(value, data + pos, sizeof(uint16_t));
+    pos += sizeof(uint16_t);
+    return true;
+  };
+
+  uint16_t count;
+  if (!readU16(&count)) {
+    return false;
+  }
+  lines.reserve(count);
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (pos >= size || data[pos] != TAG_PageLine) {
+      Serial.printf("[%lu] [PGE] Page view failed: Unknown tag %u\n", millis(), pos < size ? data[pos] : 0);
+      return false;
+    }
+    pos++;
+
+    LineRef line = {};
+    uint16_t xPos, yPos;
+    if (!readU16(&xPos) || !readU16(&yPos) || !readU16(&line.wordCount)) {
+      return false;
+    }
+    line.xPos = static_cast<int16_t>(xPos);
+    line.yPos = static_cast<int16_t>(yPos);
+    line.wordsOffset = pos;
+
+    for (uint16_t w = 0; w < line.wordCount; w++) {
+      uint32_t len;
+      if (pos + sizeof(len) > size) return false;
+      memcpy(&len, data + pos, sizeof(len));
+      if (len > size - pos - sizeof(len) || memchr(data + pos + sizeof(len), '\0', len)) {
+        Serial.printf("[%lu] [PGE] Page view failed: bad word length %u\n", millis(), len);
+        return false;
+      }
+      memmove(data + pos, data + pos + sizeof(len), len);
+      data[pos + len] = '\0';
+      pos += sizeof(len) + len;
+    }
+
+    line.xPosOffset = pos;
+    pos += line.wordCount * sizeof(uint16_t);
+    line.stylesOffset = pos;
+    pos += line.wordCount * sizeof(EpdFontFamily::Style) + TextBlock::SERIALIZED_BLOCK_STYLE_SIZE;
+    if (pos > size) {
+      return false;
+    }
+    lines.push_back(line);
+  }
+
+  return true;
+}
+
+void PageView::render(const GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  const uint8_t* data = buffer.data();
+  for (const auto& line : lines) {
+    const char* word = reinterpret_cast<const char*>(data + line.wordsOffset);
+    for (uint16_t w = 0; w < line.wordCount; w++) {
+      const size_t len = strlen(word);
+      uint16_t wordX;
+      memcpy(&wordX, data + line.xPosOffset + w * sizeof(uint16_t), sizeof(wordX));
+      const auto style = static_cast<EpdFontFamily::Style>(data[line.stylesOffset + w]);
+      TextBlock::renderWord(renderer, fontId, wordX + line.xPos + xOffset, line.yPos + yOffset, word, len, style);
+      word += len + sizeof(uint32_t);
+    }
+  }
+}
@@ -41,3 +41,35 @@ class Page {
   bool serialize(FsFile& file) const;
   static std::unique_ptr<Page> deserialize(FsFile& file);
 };
+
+// Read-only view of one serialized page. load() reads the page's byte range into a single buffer and indexes its lines;
+// render() then draws straight out of that buffer, so no PageElements, TextBlocks or per-word strings are built.
+// Keep one view alive across page turns and the buffers are reused without touching the heap.
+class PageView {
+  struct LineRef {
+    int16_t xPos;
+    int16_t yPos;
+    uint16_t wordCount;
+    uint32_t wordsOffset;   // Null-terminated words, each followed by padding up to its original length prefix
+    uint32_t xPosOffset;    // uint16_t[wordCount], unaligned
+    uint32_t stylesOffset;  // EpdFontFamily::Style[wordCount]
+  };
+
+  std::vector<uint8_t> buffer;
+  std::vector<LineRef> lines;
+
+  bool indexLines();
+
+ public:
+  // Larger byte ranges are rejected as corrupt rather than allocated; a dense page of the smallest font is under 3KB
+  static constexpr uint32_t MAX_PAGE_BYTES = 32 * 1024;
+
+  bool load(FsFile& file, uint32_t offset, uint32_t size);
+  void clear();
+  // Like clear(), but also frees the buffers instead of keeping them for the next load()
+  void release();
+  bool isEmpty() const { return lines.empty(); }
+  // Heap held by the view, including capacity kept for reuse
+  size_t memoryUsage() const { return buffer.capacity() + lines.capacity() * sizeof(LineRef); }
+  void render(const GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
+};
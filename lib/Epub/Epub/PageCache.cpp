@@ -0,0 +1,91 @@
+#include "PageCache.h"
+
+#include <utility>
+
+PageCache::Slot* PageCache::find(const int spineIndex, const int page) {
+  for (auto& slot : slots) {
+    if (slot.spineIndex == spineIndex && slot.page == page) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+void PageCache::trim(Slot& slot) {
+  if (slot.view.memoryUsage() > MAX_SLOT_BYTES) {
+    slot.view.release();
+  }
+}
+
+void PageCache::setLayout(const uint32_t key) {
+  if (key != layoutKey) {
+    clear();
+    layoutKey = key;
+  }
+}
+
+void PageCache::clear() {
+  for (auto& slot : slots) {
+    slot.spineIndex = -1;
+    slot.page = -1;
+    slot.view.clear();
+  }
+}
+
+bool PageCache::contains(const int spineIndex, const int page) const {
+  for (const auto& slot : slots) {
+    if (slot.spineIndex == spineIndex && slot.page == page) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const PageView* PageCache::peek(const int spineIndex, const int page) const {
+  for (const auto& slot : slots) {
+    if (slot.spineIndex == spineIndex && slot.page == page) {
+      return &slot.view;
+    }
+  }
+  return nullptr;
+}
+
+bool PageCache::take(const int spineIndex, const int page, PageView& view) {
+  Slot* slot = find(spineIndex, page);
+  if (!slot) {
+    return false;
+  }
+
+  std::swap(slot->view, view);
+  slot->spineIndex = -1;
+  slot->page = -1;
+  slot->view.clear();
+  trim(*slot);
+  return true;
+}
+
+void PageCache::insert(const int spineIndex, const int page, PageView& view) {
+  if (view.isEmpty() || view.memoryUsage() > MAX_SLOT_BYTES) {
+    return;
+  }
+
+  Slot* target = find(spineIndex, page);
+  if (!target) {
+    target = &slots[0];
+    for (auto& slot : slots) {
+      if (slot.spineIndex < 0) {
+        target = &slot;
+        break;
+      }
+      if (slot.lastUse < target->lastUse) {
+        target = &slot;
+      }
+    }
+  }
+
+  std::swap(target->view, view);
+  target->spineIndex = spineIndex;
+  target->page = page;
+  target->lastUse = ++useCounter;
+  view.clear();
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "Page.h"
+
+// A few pages held in RAM ahead of the reader, so an anticipated page turn skips the SD card. Entries are keyed by
+// spine index and page number, and all of them are dropped when the layout they were produced with changes. Views are
+// swapped in and out rather than copied, so their buffers stay in circulation instead of going back to the heap.
+class PageCache {
+ public:
+  static constexpr int SLOT_COUNT = 2;
+  // Per slot, counting buffer capacity. A page that needs more is not cached, and a slot that ends up holding more
+  // after a swap gives it back.
+  static constexpr size_t MAX_SLOT_BYTES = 8 * 1024;
+
+ private:
+  struct Slot {
+    int spineIndex = -1;
+    int page = -1;
+    uint32_t lastUse = 0;
+    PageView view;
+  };
+
+  Slot slots[SLOT_COUNT];
+  uint32_t layoutKey = 0;
+  uint32_t useCounter = 0;
+
+  Slot* find(int spineIndex, int page);
+  void trim(Slot& slot);
+
+ public:
+  // Identifies everything that affects pagination; a different key than last time empties the cache
+  void setLayout(uint32_t key);
+  void clear();
+  bool contains(int spineIndex, int page) const;
+  // Look at a cached page without taking it out; nullptr on a miss
+  const PageView* peek(int spineIndex, int page) const;
+  // Swap a cached page into view. The view's previous buffers take the slot. Returns false on a miss.
+  bool take(int spineIndex, int page, PageView& view);
+  // Swap a freshly loaded page into the least recently used slot; view is left holding that slot's old buffers
+  void insert(int spineIndex, int page, PageView& view);
+};
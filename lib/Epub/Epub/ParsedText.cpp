@@ -4,11 +4,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
-#include <iterator>
 #include <limits>
+#include <string>
 #include <vector>
 
+#include "WordWidthCache.h"
 #include "hyphenation/Hyphenator.h"
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
@@ -19,41 +21,82 @@ namespace {
 constexpr char SOFT_HYPHEN_UTF8[] = "\xC2\xAD";
 constexpr size_t SOFT_HYPHEN_BYTES = 2;
 
-bool containsSoftHyphen(const std::string& word) { return word.find(SOFT_HYPHEN_UTF8) != std::string::npos; }
-
-// Removes every soft hyphen in-place so rendered glyphs match measured widths.
-void stripSoftHyphensInPlace(std::string& word) {
-  size_t pos = 0;
-  while ((pos = word.find(SOFT_HYPHEN_UTF8, pos)) != std::string::npos) {
-    word.erase(pos, SOFT_HYPHEN_BYTES);
+bool containsSoftHyphen(const char* word, const size_t len) {
+  for (size_t i = 0; i + 1 < len; i++) {
+    if (word[i] == SOFT_HYPHEN_UTF8[0] && word[i + 1] == SOFT_HYPHEN_UTF8[1]) {
+      return true;
+    }
   }
+  return false;
 }
 
-// Returns the rendered width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
-uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
-                          const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  const bool hasSoftHyphen = containsSoftHyphen(word);
-  if (!hasSoftHyphen && !appendHyphen) {
-    return renderer.getTextWidth(fontId, word.c_str(), style);
+// Removes every soft hyphen in-place so rendered glyphs match measured widths. Returns the new length.
+size_t stripSoftHyphensInPlace(char* word, const size_t len) {
+  size_t out = 0;
+  for (size_t i = 0; i < len; i++) {
+    if (i + 1 < len && word[i] == SOFT_HYPHEN_UTF8[0] && word[i + 1] == SOFT_HYPHEN_UTF8[1]) {
+      i += SOFT_HYPHEN_BYTES - 1;
+      continue;
+    }
+    word[out++] = word[i];
   }
+  return out;
+}
 
-  std::string sanitized = word;
-  if (hasSoftHyphen) {
-    stripSoftHyphensInPlace(sanitized);
+// Returns the rendered width for a word while ignoring soft hyphen glyphs, from the cache if it has been measured.
+uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const char* word, const size_t len,
+                          const EpdFontFamily::Style style, WordWidthCache* widthCache) {
+  WordWidthCache::Key key{};
+  uint16_t width;
+  if (widthCache) {
+    key = widthCache->key(fontId, style, word, len);
+    if (widthCache->get(key, &width)) {
+      return width;
+    }
   }
-  if (appendHyphen) {
-    sanitized.push_back('-');
+  width = renderer.measureText(fontId, std::string_view(word, len), style, EpdFont::MEASURE_SKIP_SOFT_HYPHENS);
+  if (widthCache) {
+    widthCache->put(key, width);
   }
-  return renderer.getTextWidth(fontId, sanitized.c_str(), style);
+  return width;
 }
 
 }  // namespace
 
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool underline,
+uint32_t ParsedText::appendToArena(const char* word, const size_t len) {
+  if (!arena) {
+    arena = std::make_shared<TextArena>();
+  }
+  const auto offset = static_cast<uint32_t>(arena->size());
+  arena->resize(offset + len + 1);
+  memcpy(arena->data() + offset, word, len);
+  (*arena)[offset + len] = '\0';
+  return offset;
+}
+
+// Copies prefix + arena[sourceOffset, sourceOffset + sourceLen) + suffix into a new word at the end of the arena.
+// The source is addressed by offset because growing the arena may move it.
+uint32_t ParsedText::appendToArena(const char* prefix, const uint32_t sourceOffset, const size_t sourceLen,
+                                   const char* suffix) {
+  const size_t prefixLen = strlen(prefix);
+  const size_t suffixLen = strlen(suffix);
+  const auto offset = static_cast<uint32_t>(arena->size());
+  arena->resize(offset + prefixLen + sourceLen + suffixLen + 1);
+  char* out = arena->data() + offset;
+  memcpy(out, prefix, prefixLen);
+  memcpy(out + prefixLen, arena->data() + sourceOffset, sourceLen);
+  memcpy(out + prefixLen + sourceLen, suffix, suffixLen);
+  out[prefixLen + sourceLen + suffixLen] = '\0';
+  return offset;
+}
+
+void ParsedText::addWord(const char* word, const EpdFontFamily::Style fontStyle, const bool underline,
                          const bool attachToPrevious) {
-  if (word.empty()) return;
+  const size_t len = strlen(word);
+  if (len == 0 || len > UINT16_MAX) return;
 
-  words.push_back(std::move(word));
+  wordOffsets.push_back(appendToArena(word, len));
+  wordLengths.push_back(static_cast<uint16_t>(len));
   EpdFontFamily::Style combinedStyle = fontStyle;
   if (underline) {
     combinedStyle = static_cast<EpdFontFamily::Style>(combinedStyle | EpdFontFamily::UNDERLINE);
@@ -65,8 +108,8 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle,
 // Consumes data to minimize memory usage
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine) {
-  if (words.empty()) {
+                                       const bool includeLastLine, WordWidthCache* widthCache) {
+  if (wordOffsets.empty()) {
     return;
   }
 
@@ -75,39 +118,61 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
 
   const int pageWidth = viewportWidth;
   const int spaceWidth = renderer.getSpaceWidth(fontId);
-  auto wordWidths = calculateWordWidths(renderer, fontId);
-
-  // Build indexed continues vector from the parallel list for O(1) access during layout
-  std::vector<bool> continuesVec(wordContinues.begin(), wordContinues.end());
+  auto wordWidths = calculateWordWidths(renderer, fontId, widthCache);
 
   std::vector<size_t> lineBreakIndices;
   if (hyphenationEnabled) {
     // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, widthCache);
   } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, widthCache);
   }
   const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, processLine);
+    extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
   }
+
+  consumeWords(lineCount > 0 ? lineBreakIndices[lineCount - 1] : 0);
 }
 
-std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
-  const size_t totalWordCount = words.size();
+// Drops the first count words. Extracted lines keep the old arena alive, so the words left over are moved to a new
+// one instead of being compacted in place.
+void ParsedText::consumeWords(const size_t count) {
+  if (count == 0) {
+    return;
+  }
 
-  std::vector<uint16_t> wordWidths;
-  wordWidths.reserve(totalWordCount);
+  if (count >= wordOffsets.size()) {
+    arena.reset();
+    wordOffsets.clear();
+    wordLengths.clear();
+    wordStyles.clear();
+    wordContinues.clear();
+    return;
+  }
+
+  wordOffsets.erase(wordOffsets.begin(), wordOffsets.begin() + count);
+  wordLengths.erase(wordLengths.begin(), wordLengths.begin() + count);
+  wordStyles.erase(wordStyles.begin(), wordStyles.begin() + count);
+  wordContinues.erase(wordContinues.begin(), wordContinues.begin() + count);
 
-  auto wordsIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
+  const auto previous = std::move(arena);
+  arena = std::make_shared<TextArena>();
+  for (size_t i = 0; i < wordOffsets.size(); i++) {
+    wordOffsets[i] = appendToArena(previous->data() + wordOffsets[i], wordLengths[i]);
+  }
+}
 
-  while (wordsIt != words.end()) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, *wordsIt, *wordStylesIt));
+std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId,
+                                                     WordWidthCache* widthCache) {
+  const size_t totalWordCount = wordOffsets.size();
 
-    std::advance(wordsIt, 1);
-    std::advance(wordStylesIt, 1);
+  std::vector<uint16_t> wordWidths;
+  wordWidths.reserve(totalWordCount);
+
+  for (size_t i = 0; i < totalWordCount; i++) {
+    wordWidths.push_back(measureWordWidth(renderer, fontId, wordAt(i), wordLengths[i], wordStyles[i], widthCache));
   }
 
   return wordWidths;
@@ -115,8 +180,8 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
 
 std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
                                                   const int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec) {
-  if (words.empty()) {
+                                                  WordWidthCache* widthCache) {
+  if (wordOffsets.empty()) {
     return {};
   }
 
@@ -133,13 +198,13 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
     while (wordWidths[i] > effectiveWidth) {
       if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true,
-                                &continuesVec)) {
+                                widthCache)) {
         break;
       }
     }
   }
 
-  const size_t totalWordCount = words.size();
+  const size_t totalWordCount = wordOffsets.size();
 
   // DP table to store the minimum badness (cost) of lines starting at index i
   std::vector<int> dp(totalWordCount);
@@ -159,7 +224,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
 
     for (size_t j = i; j < totalWordCount; ++j) {
       // Add space before word j, unless it's the first word on the line or a continuation
-      const int gap = j > static_cast<size_t>(i) && !continuesVec[j] ? spaceWidth : 0;
+      const int gap = j > static_cast<size_t>(i) && !wordContinues[j] ? spaceWidth : 0;
       currlen += wordWidths[j] + gap;
 
       if (currlen > effectivePageWidth) {
@@ -167,7 +232,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
       }
 
       // Cannot break after word j if the next word attaches to it (continuation group)
-      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
+      if (j + 1 < totalWordCount && wordContinues[j + 1]) {
         continue;
       }
 
@@ -226,7 +291,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
 }
 
 void ParsedText::applyParagraphIndent() {
-  if (extraParagraphSpacing || words.empty()) {
+  if (extraParagraphSpacing || wordOffsets.empty()) {
     return;
   }
 
@@ -235,7 +300,8 @@ void ParsedText::applyParagraphIndent() {
     // The actual indent positioning is handled in extractLine()
   } else if (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left) {
     // No CSS text-indent defined - use EmSpace fallback for visual indent
-    words.front().insert(0, "\xe2\x80\x83");
+    wordOffsets.front() = appendToArena("\xe2\x80\x83", wordOffsets.front(), wordLengths.front(), "");
+    wordLengths.front() += 3;
   }
 }
 
@@ -243,7 +309,7 @@ void ParsedText::applyParagraphIndent() {
 std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
                                                             const int pageWidth, const int spaceWidth,
                                                             std::vector<uint16_t>& wordWidths,
-                                                            std::vector<bool>& continuesVec) {
+                                                            WordWidthCache* widthCache) {
   // Calculate first line indent (only for left/justified text without extra paragraph spacing)
   const int firstLineIndent =
       blockStyle.textIndent > 0 && !extraParagraphSpacing &&
@@ -265,7 +331,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
     // Consume as many words as possible for current line, splitting when prefixes fit
     while (currentIndex < wordWidths.size()) {
       const bool isFirstWord = currentIndex == lineStart;
-      const int spacing = isFirstWord || continuesVec[currentIndex] ? 0 : spaceWidth;
+      const int spacing = isFirstWord || wordContinues[currentIndex] ? 0 : spaceWidth;
       const int candidateWidth = spacing + wordWidths[currentIndex];
 
       // Word fits on current line
@@ -280,7 +346,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
       const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
 
       if (availableWidth > 0 && hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths,
-                                                     allowFallbackBreaks, &continuesVec)) {
+                                                     allowFallbackBreaks, widthCache)) {
         // Prefix now fits; append it to this line and move to next line
         lineWidth += spacing + wordWidths[currentIndex];
         ++currentIndex;
@@ -297,7 +363,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
 
     // Don't break before a continuation word (e.g., orphaned "?" after "question").
     // Backtrack to the start of the continuation group so the whole group moves to the next line.
-    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continuesVec[currentIndex]) {
+    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && wordContinues[currentIndex]) {
       --currentIndex;
     }
 
@@ -308,24 +374,19 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
   return lineBreakIndices;
 }
 
-// Splits words[wordIndex] into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint fits the
-// available width.
+// Splits the word at wordIndex into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint
+// fits the available width. The remainder keeps pointing at the tail of the original bytes, the prefix is copied.
 bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availableWidth, const GfxRenderer& renderer,
                                       const int fontId, std::vector<uint16_t>& wordWidths,
-                                      const bool allowFallbackBreaks, std::vector<bool>* continuesVec) {
+                                      const bool allowFallbackBreaks, WordWidthCache* widthCache) {
   // Guard against invalid indices or zero available width before attempting to split.
-  if (availableWidth <= 0 || wordIndex >= words.size()) {
+  if (availableWidth <= 0 || wordIndex >= wordOffsets.size()) {
     return false;
   }
 
-  // Get iterators to target word and style.
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
-  std::advance(wordIt, wordIndex);
-  std::advance(styleIt, wordIndex);
-
-  const std::string& word = *wordIt;
-  const auto style = *styleIt;
+  const uint32_t wordOffset = wordOffsets[wordIndex];
+  const std::string word(wordAt(wordIndex), wordLengths[wordIndex]);
+  const auto style = wordStyles[wordIndex];
 
   // Collect candidate breakpoints (byte offsets and hyphen requirements).
   auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
@@ -337,6 +398,27 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   int chosenWidth = -1;
   bool chosenNeedsHyphen = true;
 
+  // Widths of every prefix with and without an inserted hyphen, each measured in one pass that stops once no longer
+  // prefix can fit. Prefixes that weren't measured are UINT16_MAX wide.
+  const bool anyWithoutHyphen =
+      std::any_of(breakInfos.begin(), breakInfos.end(),
+                  [](const Hyphenator::BreakInfo& info) { return !info.requiresInsertedHyphen; });
+  const size_t prefixCount = word.size() + 1;
+  uint16_t stackWidths[2 * 64];  // Enough for words of up to 63 bytes without touching the heap
+  std::vector<uint16_t> heapWidths;
+  uint16_t* hyphenatedWidths = stackWidths;
+  if (2 * prefixCount > sizeof(stackWidths) / sizeof(stackWidths[0])) {
+    heapWidths.resize(2 * prefixCount);
+    hyphenatedWidths = heapWidths.data();
+  }
+  uint16_t* plainWidths = hyphenatedWidths + prefixCount;
+  const uint8_t flags = EpdFont::MEASURE_SKIP_SOFT_HYPHENS;
+  renderer.measureText(fontId, word, style, flags | EpdFont::MEASURE_APPEND_HYPHEN, availableWidth, nullptr,
+                       hyphenatedWidths);
+  if (anyWithoutHyphen) {
+    renderer.measureText(fontId, word, style, flags, availableWidth, nullptr, plainWidths);
+  }
+
   // Iterate over each legal breakpoint and retain the widest prefix that still fits.
   for (const auto& info : breakInfos) {
     const size_t offset = info.byteOffset;
@@ -345,7 +427,7 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     }
 
     const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
+    const int prefixWidth = needsHyphen ? hyphenatedWidths[offset] : plainWidths[offset];
     if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
       continue;  // Skip if too wide or not an improvement
     }
@@ -360,45 +442,34 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     return false;
   }
 
-  // Split the word at the selected breakpoint and append a hyphen if required.
-  std::string remainder = word.substr(chosenOffset);
-  wordIt->resize(chosenOffset);
-  if (chosenNeedsHyphen) {
-    wordIt->push_back('-');
-  }
+  // The remainder is the tail of the existing (already terminated) bytes; the prefix needs its own terminator and
+  // possibly a hyphen, so it is appended to the arena.
+  const uint32_t remainderOffset = wordOffset + chosenOffset;
+  const auto remainderLen = static_cast<uint16_t>(word.size() - chosenOffset);
+  wordOffsets[wordIndex] = appendToArena("", wordOffset, chosenOffset, chosenNeedsHyphen ? "-" : "");
+  wordLengths[wordIndex] = static_cast<uint16_t>(chosenOffset + (chosenNeedsHyphen ? 1 : 0));
 
   // Insert the remainder word (with matching style and continuation flag) directly after the prefix.
-  auto insertWordIt = std::next(wordIt);
-  auto insertStyleIt = std::next(styleIt);
-  words.insert(insertWordIt, remainder);
-  wordStyles.insert(insertStyleIt, style);
+  wordOffsets.insert(wordOffsets.begin() + wordIndex + 1, remainderOffset);
+  wordLengths.insert(wordLengths.begin() + wordIndex + 1, remainderLen);
+  wordStyles.insert(wordStyles.begin() + wordIndex + 1, style);
 
   // The remainder inherits whatever continuation status the original word had with the word after it.
-  // Find the continues entry for the original word and insert the remainder's entry after it.
-  auto continuesIt = wordContinues.begin();
-  std::advance(continuesIt, wordIndex);
-  const bool originalContinuedToNext = *continuesIt;
+  const bool originalContinuedToNext = wordContinues[wordIndex];
   // The original word (now prefix) does NOT continue to remainder (hyphen separates them)
-  *continuesIt = false;
-  const auto insertContinuesIt = std::next(continuesIt);
-  wordContinues.insert(insertContinuesIt, originalContinuedToNext);
-
-  // Keep the indexed vector in sync if provided
-  if (continuesVec) {
-    (*continuesVec)[wordIndex] = false;
-    continuesVec->insert(continuesVec->begin() + wordIndex + 1, originalContinuedToNext);
-  }
+  wordContinues[wordIndex] = false;
+  wordContinues.insert(wordContinues.begin() + wordIndex + 1, originalContinuedToNext);
 
   // Update cached widths to reflect the new prefix/remainder pairing.
   wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
+  const uint16_t remainderWidth =
+      measureWordWidth(renderer, fontId, wordAt(wordIndex + 1), remainderLen, style, widthCache);
   wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
   return true;
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<bool>& continuesVec,
-                             const std::vector<size_t>& lineBreakIndices,
+                             const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
@@ -420,7 +491,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineWordWidthSum += wordWidths[lastBreakAt + wordIdx];
     // Count gaps: each word after the first creates a gap, unless it's a continuation
-    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx]) {
+    if (wordIdx > 0 && !wordContinues[lastBreakAt + wordIdx]) {
       actualGapCount++;
     }
   }
@@ -447,7 +518,8 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
 
   // Pre-calculate X positions for words
   // Continuation words attach to the previous word with no space before them
-  std::list<uint16_t> lineXPos;
+  std::vector<uint16_t> lineXPos;
+  lineXPos.reserve(lineWordCount);
 
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     const uint16_t currentWordWidth = wordWidths[lastBreakAt + wordIdx];
@@ -455,35 +527,24 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     lineXPos.push_back(xpos);
 
     // Add spacing after this word, unless the next word is a continuation
-    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continuesVec[lastBreakAt + wordIdx + 1];
+    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && wordContinues[lastBreakAt + wordIdx + 1];
 
     xpos += currentWordWidth + (nextIsContinuation ? 0 : spacing);
   }
 
-  // Iterators always start at the beginning as we are moving content with splice below
-  auto wordEndIt = words.begin();
-  auto wordStyleEndIt = wordStyles.begin();
-  auto wordContinuesEndIt = wordContinues.begin();
-  std::advance(wordEndIt, lineWordCount);
-  std::advance(wordStyleEndIt, lineWordCount);
-  std::advance(wordContinuesEndIt, lineWordCount);
-
-  // *** CRITICAL STEP: CONSUME DATA USING SPLICE ***
-  std::list<std::string> lineWords;
-  lineWords.splice(lineWords.begin(), words, words.begin(), wordEndIt);
-  std::list<EpdFontFamily::Style> lineWordStyles;
-  lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
-
-  // Consume continues flags (not passed to TextBlock, but must be consumed to stay in sync)
-  std::list<bool> lineContinues;
-  lineContinues.splice(lineContinues.begin(), wordContinues, wordContinues.begin(), wordContinuesEndIt);
-
-  for (auto& word : lineWords) {
-    if (containsSoftHyphen(word)) {
-      stripSoftHyphensInPlace(word);
+  // Soft hyphens were only needed for measuring. Each word owns its bytes, so they can be dropped in place.
+  for (size_t i = lastBreakAt; i < lineBreak; i++) {
+    char* word = arena->data() + wordOffsets[i];
+    if (containsSoftHyphen(word, wordLengths[i])) {
+      wordLengths[i] = static_cast<uint16_t>(stripSoftHyphensInPlace(word, wordLengths[i]));
+      word[wordLengths[i]] = '\0';
     }
   }
 
-  processLine(
-      std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), blockStyle));
+  // The line shares the arena; consumeWords() drops the paragraph's reference once every line is out
+  processLine(std::make_shared<TextBlock>(
+      arena, std::vector<uint32_t>(wordOffsets.begin() + lastBreakAt, wordOffsets.begin() + lineBreak),
+      std::vector<uint16_t>(wordLengths.begin() + lastBreakAt, wordLengths.begin() + lineBreak), std::move(lineXPos),
+      std::vector<EpdFontFamily::Style>(wordStyles.begin() + lastBreakAt, wordStyles.begin() + lineBreak),
+      blockStyle));
 }
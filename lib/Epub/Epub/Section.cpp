@@ -9,11 +9,27 @@
 
 namespace {
 constexpr uint8_t SECTION_FILE_VERSION = 12;
+constexpr uint8_t CHECKPOINT_FILE_VERSION = 1;
+// A checkpoint costs one small write of the LUT and the unfinished page; this keeps the work lost on interruption low
+constexpr uint16_t CHECKPOINT_INTERVAL_PAGES = 8;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint32_t);
 }  // namespace
 
+Section::Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
+    : epub(epub),
+      spineIndex(spineIndex),
+      renderer(renderer),
+      filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin"),
+      checkpointPath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".ckpt") {}
+
+Section::~Section() {
+  if (build) {
+    suspendSectionFile();
+  }
+}
+
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   if (!file) {
     Serial.printf("[%lu] [SCT] File not open for writing page %d\n", millis(), pageCount);
@@ -27,10 +43,42 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   }
   Serial.printf("[%lu] [SCT] Page %d processed\n", millis(), pageCount);
 
+  build->writeEnd = file.position();
   pageCount++;
   return position;
 }
 
+void Section::onBlockBoundary() {
+  if (pageCount < build->checkpointPageCount + CHECKPOINT_INTERVAL_PAGES) {
+    return;
+  }
+
+  // Pages the checkpoint refers to must be on the card before it is
+  file.flush();
+
+  FsFile checkpointFile;
+  if (!Storage.openFileForWrite("SCT", checkpointPath, checkpointFile)) {
+    return;
+  }
+  // Version goes in last, so a checkpoint cut short by power loss is never read back
+  serialization::writePod(checkpointFile, static_cast<uint8_t>(0));
+  serialization::writePod(checkpointFile, pageCount);
+  serialization::writePod(checkpointFile, build->writeEnd);
+  for (const uint32_t& pos : build->lut) {
+    serialization::writePod(checkpointFile, pos);
+  }
+  if (!build->parser->saveResumeState(checkpointFile)) {
+    checkpointFile.close();
+    Storage.remove(checkpointPath.c_str());
+    return;
+  }
+  checkpointFile.seek(0);
+  serialization::writePod(checkpointFile, CHECKPOINT_FILE_VERSION);
+  checkpointFile.close();
+  build->checkpointPageCount = pageCount;
+  Serial.printf("[%lu] [SCT] Checkpoint saved after %d pages\n", millis(), pageCount);
+}
+
 void Section::writeSectionFileHeader(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                      const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                      const uint16_t viewportHeight, const bool hyphenationEnabled,
@@ -57,21 +105,16 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
   serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset
 }
 
-bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                              const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                              const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
-  if (!Storage.openFileForRead("SCT", filePath, file)) {
-    return false;
-  }
-
+bool Section::readSectionFileHeader(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                    const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                    const uint16_t viewportHeight, const bool hyphenationEnabled,
+                                    const bool embeddedStyle, uint32_t& lutOffset) {
   // Match parameters
   {
     uint8_t version;
     serialization::readPod(file, version);
     if (version != SECTION_FILE_VERSION) {
-      file.close();
       Serial.printf("[%lu] [SCT] Deserialization failed: Unknown version %u\n", millis(), version);
-      clearCache();
       return false;
     }
 
@@ -95,21 +138,48 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
         extraParagraphSpacing != fileExtraParagraphSpacing || paragraphAlignment != fileParagraphAlignment ||
         viewportWidth != fileViewportWidth || viewportHeight != fileViewportHeight ||
         hyphenationEnabled != fileHyphenationEnabled || embeddedStyle != fileEmbeddedStyle) {
-      file.close();
       Serial.printf("[%lu] [SCT] Deserialization failed: Parameters do not match\n", millis());
-      clearCache();
       return false;
     }
   }
 
   serialization::readPod(file, pageCount);
+  serialization::readPod(file, lutOffset);
+  return true;
+}
+
+bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                              const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                              const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
+  if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return false;
+  }
+
+  uint32_t lutOffset;
+  if (!readSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                             viewportHeight, hyphenationEnabled, embeddedStyle, lutOffset)) {
+    file.close();
+    pageCount = 0;
+    clearCache();
+    return false;
+  }
   file.close();
+  if (lutOffset == 0) {
+    // Left for beginSectionFile() to resume from its checkpoint, or to overwrite if there is none
+    Serial.printf("[%lu] [SCT] Deserialization failed: Section build was not completed\n", millis());
+    pageCount = 0;
+    return false;
+  }
   Serial.printf("[%lu] [SCT] Deserialization succeeded: %d pages\n", millis(), pageCount);
   return true;
 }
 
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
 bool Section::clearCache() const {
+  if (Storage.exists(checkpointPath.c_str())) {
+    Storage.remove(checkpointPath.c_str());
+  }
+
   if (!Storage.exists(filePath.c_str())) {
     Serial.printf("[%lu] [SCT] Cache does not exist, no action needed\n", millis());
     return true;
@@ -127,9 +197,33 @@ bool Section::clearCache() const {
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const std::function<void()>& popupFn) {
+                                const std::function<void()>& popupFn, const std::function<bool()>& cancelFn) {
+  if (!beginSectionFile(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                        viewportHeight, hyphenationEnabled, embeddedStyle, popupFn)) {
+    return false;
+  }
+
+  while (build) {
+    // Polled during the replay up to a checkpoint as well, so a cancel never waits on more than one chunk; the replay
+    // is cheap next to layout and the checkpoint stays for the next attempt
+    if (cancelFn && cancelFn()) {
+      Serial.printf("[%lu] [SCT] Build cancelled after %d pages%s\n", millis(), pageCount,
+                    build->parser->isResuming() ? " while replaying to its checkpoint" : "");
+      suspendSectionFile();
+      return false;
+    }
+    if (!continueSectionFile(-1, 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Section::beginSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                               const std::function<void()>& popupFn) {
   const auto localPath = epub->getSpineItem(spineIndex).href;
-  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
   // Create cache directory if it doesn't exist
   {
@@ -138,68 +232,139 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   }
 
   // Retry logic for SD card timing issues
+  auto newBuild = std::unique_ptr<Build>(new Build());
   bool success = false;
-  uint32_t fileSize = 0;
   for (int attempt = 0; attempt < 3 && !success; attempt++) {
     if (attempt > 0) {
-      Serial.printf("[%lu] [SCT] Retrying stream (attempt %d)...\n", millis(), attempt + 1);
+      Serial.printf("[%lu] [SCT] Retrying open (attempt %d)...\n", millis(), attempt + 1);
       delay(50);  // Brief delay before retry
     }
+    success = epub->openItemReader(localPath, newBuild->reader);
+  }
 
-    // Remove any incomplete file from previous attempt before retrying
-    if (Storage.exists(tmpHtmlPath.c_str())) {
-      Storage.remove(tmpHtmlPath.c_str());
-    }
+  if (!success) {
+    Serial.printf("[%lu] [SCT] Failed to open item contents after retries\n", millis());
+    return false;
+  }
 
-    FsFile tmpHtml;
-    if (!Storage.openFileForWrite("SCT", tmpHtmlPath, tmpHtml)) {
-      continue;
-    }
-    success = epub->readItemContentsToStream(localPath, tmpHtml, 1024);
-    fileSize = tmpHtml.size();
-    tmpHtml.close();
-
-    // If streaming failed, remove the incomplete file immediately
-    if (!success && Storage.exists(tmpHtmlPath.c_str())) {
-      Storage.remove(tmpHtmlPath.c_str());
-      Serial.printf("[%lu] [SCT] Removed incomplete temp file after failed attempt\n", millis());
+  Serial.printf("[%lu] [SCT] Streaming %s (%zu bytes) into parser\n", millis(), localPath.c_str(),
+                newBuild->reader.size());
+
+  Build* const state = newBuild.get();
+  newBuild->parser.reset(new ChapterHtmlSlimParser(
+      newBuild->reader, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+      viewportHeight, hyphenationEnabled,
+      [this, state](std::unique_ptr<Page> page) { state->lut.emplace_back(this->onPageComplete(std::move(page))); },
+      embeddedStyle, popupFn, embeddedStyle ? epub->getCssParser() : nullptr, [this]() { onBlockBoundary(); }));
+  build = std::move(newBuild);
+  Hyphenator::setPreferredLanguage(epub->getLanguage());
+
+  if (!resumeSectionFile(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                         viewportHeight, hyphenationEnabled, embeddedStyle)) {
+    if (!Storage.openFileForWrite("SCT", filePath, file)) {
+      build.reset();
+      return false;
     }
+    pageCount = 0;
+    writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                           viewportHeight, hyphenationEnabled, embeddedStyle);
+    build->writeEnd = file.position();
   }
 
-  if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to stream item contents to temp file after retries\n", millis());
+  if (!build->parser->beginParsing()) {
+    abortSectionFile();
     return false;
   }
+  return true;
+}
 
-  Serial.printf("[%lu] [SCT] Streamed temp HTML to %s (%d bytes)\n", millis(), tmpHtmlPath.c_str(), fileSize);
-
-  if (!Storage.openFileForWrite("SCT", filePath, file)) {
+bool Section::resumeSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                const uint16_t viewportHeight, const bool hyphenationEnabled,
+                                const bool embeddedStyle) {
+  FsFile checkpointFile;
+  if (!Storage.openFileForRead("SCT", checkpointPath, checkpointFile)) {
     return false;
   }
-  writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-                         viewportHeight, hyphenationEnabled, embeddedStyle);
-  std::vector<uint32_t> lut = {};
 
-  ChapterHtmlSlimParser visitor(
-      tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-      viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, popupFn, embeddedStyle ? epub->getCssParser() : nullptr);
-  Hyphenator::setPreferredLanguage(epub->getLanguage());
-  success = visitor.parseAndBuildPages();
+  // The partial section must have been written with the same settings and never finished
+  bool resumable = false;
+  if (Storage.openFileForRead("SCT", filePath, file)) {
+    uint32_t lutOffset = 0;
+    resumable = readSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
+                                      viewportWidth, viewportHeight, hyphenationEnabled, embeddedStyle, lutOffset) &&
+                lutOffset == 0;
+    file.close();
+  }
 
-  Storage.remove(tmpHtmlPath.c_str());
-  if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to parse XML and build pages\n", millis());
+  uint8_t version = 0;
+  uint16_t checkpointPageCount = 0;
+  uint32_t writeEnd = 0;
+  if (resumable) {
+    serialization::readPod(checkpointFile, version);
+    serialization::readPod(checkpointFile, checkpointPageCount);
+    serialization::readPod(checkpointFile, writeEnd);
+    resumable = version == CHECKPOINT_FILE_VERSION && checkpointPageCount > 0;
+  }
+  if (resumable) {
+    build->lut.resize(checkpointPageCount);
+    for (uint32_t& pos : build->lut) {
+      serialization::readPod(checkpointFile, pos);
+    }
+    resumable = build->parser->loadResumeState(checkpointFile);
+  }
+  checkpointFile.close();
+
+  if (resumable) {
+    file = Storage.open(filePath.c_str(), O_RDWR);
+    // Pages written after the checkpoint are laid out again, drop them
+    resumable = file && file.truncate(writeEnd) && file.seek(writeEnd);
+  }
+  if (!resumable) {
+    Serial.printf("[%lu] [SCT] Discarding unusable checkpoint\n", millis());
     file.close();
-    Storage.remove(filePath.c_str());
+    Storage.remove(checkpointPath.c_str());
+    build->lut.clear();
     return false;
   }
 
+  pageCount = checkpointPageCount;
+  build->writeEnd = writeEnd;
+  build->checkpointPageCount = checkpointPageCount;
+  Serial.printf("[%lu] [SCT] Resuming section build after %d pages\n", millis(), pageCount);
+  return true;
+}
+
+bool Section::continueSectionFile(const int untilPage, const size_t maxChunks) {
+  if (!build) {
+    return true;
+  }
+
+  size_t chunks = 0;
+  while (!build->parser->isFinished()) {
+    if ((untilPage >= 0 && pageCount > untilPage) || (maxChunks > 0 && chunks == maxChunks)) {
+      return true;
+    }
+    if (!build->parser->parseNextChunk()) {
+      Serial.printf("[%lu] [SCT] Failed to parse XML and build pages\n", millis());
+      abortSectionFile();
+      return false;
+    }
+    chunks++;
+  }
+
+  return finishSectionFile();
+}
+
+bool Section::finishSectionFile() {
+  build->reader.close();
+  Serial.printf("[%lu] [SCT] Inflate buffers peaked at %zu bytes\n", millis(), ZipFile::InflateContext::peakBytes());
+
+  file.seek(build->writeEnd);
   const uint32_t lutOffset = file.position();
   bool hasFailedLutRecords = false;
   // Write LUT
-  for (const uint32_t& pos : lut) {
+  for (const uint32_t& pos : build->lut) {
     if (pos == 0) {
       hasFailedLutRecords = true;
       break;
@@ -209,19 +374,39 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 
   if (hasFailedLutRecords) {
     Serial.printf("[%lu] [SCT] Failed to write LUT due to invalid page positions\n", millis());
-    file.close();
-    Storage.remove(filePath.c_str());
+    abortSectionFile();
     return false;
   }
 
-  // Go back and write LUT offset
+  // Go back and write LUT offset, which also marks the file as complete
   file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
   serialization::writePod(file, pageCount);
   serialization::writePod(file, lutOffset);
   file.close();
+  build.reset();
+  if (Storage.exists(checkpointPath.c_str())) {
+    Storage.remove(checkpointPath.c_str());
+  }
   return true;
 }
 
+void Section::suspendSectionFile() {
+  build.reset();
+  file.close();
+  pageCount = 0;
+}
+
+void Section::abortSectionFile() {
+  // Parser before reader, it reads through it
+  build.reset();
+  file.close();
+  Storage.remove(filePath.c_str());
+  if (Storage.exists(checkpointPath.c_str())) {
+    Storage.remove(checkpointPath.c_str());
+  }
+  pageCount = 0;
+}
+
 std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return nullptr;
@@ -239,3 +424,57 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.close();
   return page;
 }
+
+bool Section::loadPageView(const int page, PageView& view) {
+  if (build) {
+    // Page still being built: positions come from the in-memory LUT and the bytes from the open write handle
+    if (page < 0 || page >= static_cast<int>(build->lut.size())) {
+      return false;
+    }
+    const uint32_t pagePos = build->lut[page];
+    const uint32_t pageEnd = page + 1 < static_cast<int>(build->lut.size()) ? build->lut[page + 1] : build->writeEnd;
+    if (pagePos == 0 || pageEnd <= pagePos) {
+      Serial.printf("[%lu] [SCT] Invalid page range %u-%u\n", millis(), pagePos, pageEnd);
+      return false;
+    }
+    const bool success = view.load(file, pagePos, pageEnd - pagePos);
+    file.seek(build->writeEnd);
+    return success;
+  }
+
+  if (page < 0 || page >= pageCount) {
+    return false;
+  }
+  if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return false;
+  }
+  const auto readOffset = [this](uint32_t* offset) {
+    return file.read(offset, sizeof(uint32_t)) == static_cast<int>(sizeof(uint32_t));
+  };
+
+  // A truncated or corrupt file must not turn into a huge page buffer: reads are checked and the range kept in the file
+  const uint32_t fileSize = file.size();
+  uint32_t lutOffset = 0;
+  uint32_t pagePos = 0;
+  file.seek(HEADER_SIZE - sizeof(uint32_t));
+  bool valid = readOffset(&lutOffset);
+  if (valid) {
+    file.seek(lutOffset + sizeof(uint32_t) * page);
+    valid = readOffset(&pagePos);
+  }
+  // Pages are written back to back, so a page ends where the next one (or the LUT) starts
+  uint32_t pageEnd = lutOffset;
+  if (valid && page + 1 < pageCount) {
+    valid = readOffset(&pageEnd);
+  }
+
+  if (!valid || pagePos < HEADER_SIZE || pageEnd <= pagePos || pageEnd > fileSize) {
+    Serial.printf("[%lu] [SCT] Invalid page range %u-%u\n", millis(), pagePos, pageEnd);
+    file.close();
+    return false;
+  }
+
+  const bool success = view.load(file, pagePos, pageEnd - pagePos);
+  file.close();
+  return success;
+}
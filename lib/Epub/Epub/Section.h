@@ -1,39 +1,75 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "Epub.h"
 
 class Page;
+class PageView;
 class GfxRenderer;
+class ChapterHtmlSlimParser;
 
 class Section {
+  // A build started by beginSectionFile() that has not written its LUT yet
+  struct Build {
+    ZipFile::EntryReader reader;
+    std::unique_ptr<ChapterHtmlSlimParser> parser;
+    std::vector<uint32_t> lut;
+    uint32_t writeEnd = 0;  // File offset just past the last complete page
+    uint16_t checkpointPageCount = 0;
+  };
+
   std::shared_ptr<Epub> epub;
   const int spineIndex;
   GfxRenderer& renderer;
   std::string filePath;
+  std::string checkpointPath;
   FsFile file;
+  std::unique_ptr<Build> build;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
+  bool readSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                             uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
+                             bool embeddedStyle, uint32_t& lutOffset);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  void onBlockBoundary();
+  bool resumeSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                         uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
+  bool finishSectionFile();
+  // Stop building but keep the partial file and its checkpoint for a later beginSectionFile() to resume
+  void suspendSectionFile();
+  // Stop building and delete everything written so far
+  void abortSectionFile();
 
  public:
   uint16_t pageCount = 0;
   int currentPage = 0;
 
-  explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
-      : epub(epub),
-        spineIndex(spineIndex),
-        renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
-  ~Section() = default;
+  explicit Section(const std::shared_ptr<Epub>& epub, int spineIndex, GfxRenderer& renderer);
+  ~Section();
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
   bool clearCache() const;
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
-                         const std::function<void()>& popupFn = nullptr);
+                         const std::function<void()>& popupFn = nullptr,
+                         const std::function<bool()>& cancelFn = nullptr);
+  // Incremental build: writes the header and readies the parser, after which continueSectionFile() appends pages.
+  // Pages can be loaded as soon as they exist. The LUT offset in the header stays 0 until the whole chapter is done,
+  // which is how loadSectionFile() tells an interrupted build from a complete one. An interrupted build that left a
+  // checkpoint is picked up from there instead of starting over.
+  bool beginSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
+                        const std::function<void()>& popupFn = nullptr);
+  // Parse until page untilPage exists (-1 for no target) or maxChunks 1KB input chunks are consumed (0 for no limit).
+  // Finishes the file when the chapter ends. Returns false if the build failed and was discarded.
+  bool continueSectionFile(int untilPage, size_t maxChunks = 0);
+  bool isBuilding() const { return build != nullptr; }
   std::unique_ptr<Page> loadPageFromSectionFile();
+  // Load a page into view without deserializing it; view's buffers are reused between calls
+  bool loadPageView(int page, PageView& view);
+  bool loadPageView(PageView& view) { return loadPageView(currentPage, view); }
 };
@@ -0,0 +1,79 @@
+#include "WordWidthCache.h"
+
+#include <HardwareSerial.h>
+
+#include <cstdlib>
+
+namespace {
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+
+uint32_t fnv1a(uint32_t hash, const uint8_t* bytes, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ bytes[i]) * FNV_PRIME;
+  }
+  return hash;
+}
+}  // namespace
+
+WordWidthCache::~WordWidthCache() { clear(); }
+
+void WordWidthCache::clear() {
+  free(entries);
+  entries = nullptr;
+}
+
+WordWidthCache::Key WordWidthCache::key(const int fontId, const EpdFontFamily::Style style, const char* word,
+                                        const size_t len) {
+  if (fontId != this->fontId) {
+    clear();
+    this->fontId = fontId;
+  }
+  // Underlining doesn't change a word's width
+  const uint8_t fontStyle = style & EpdFontFamily::BOLD_ITALIC;
+  uint32_t hash = fnv1a(FNV_OFFSET_BASIS, reinterpret_cast<const uint8_t*>(&fontId), sizeof(fontId));
+  hash = fnv1a(hash, &fontStyle, 1);
+  hash = fnv1a(hash, reinterpret_cast<const uint8_t*>(word), len);
+  return {hash, static_cast<uint16_t>(len <= UINT16_MAX ? len : 0)};
+}
+
+bool WordWidthCache::get(const Key& key, uint16_t* width) {
+  if (entries && key.length > 0) {
+    for (int i = 0; i < PROBES; i++) {
+      const Entry& entry = entries[(key.hash + i) & (capacity - 1)];
+      if (entry.length == 0) {
+        break;
+      }
+      if (entry.hash == key.hash && entry.length == key.length) {
+        hits++;
+        *width = entry.width;
+        return true;
+      }
+    }
+  }
+  misses++;
+  return false;
+}
+
+void WordWidthCache::put(const Key& key, const uint16_t width) {
+  if (key.length == 0) {
+    return;
+  }
+  if (!entries) {
+    entries = static_cast<Entry*>(calloc(capacity, sizeof(Entry)));
+    if (!entries) {
+      Serial.printf("[%lu] [WWC] !! Not enough memory for the word width cache\n", millis());
+      return;
+    }
+  }
+
+  Entry* slot = &entries[key.hash & (capacity - 1)];
+  for (int i = 0; i < PROBES; i++) {
+    Entry& entry = entries[(key.hash + i) & (capacity - 1)];
+    if (entry.length == 0 || (entry.hash == key.hash && entry.length == key.length)) {
+      slot = &entry;
+      break;
+    }
+  }
+  *slot = {key.hash, key.length, width};
+}
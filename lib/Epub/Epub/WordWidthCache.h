@@ -0,0 +1,51 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Widths of the words laid out while building a section, so that words a book uses over and over ("the", "said", its
+// characters' names) are measured glyph by glyph once. A fixed-size open-addressed table keyed by font, style and an
+// FNV-1a hash of the word's bytes: a word is looked for in the PROBES slots from where its hash lands, and when none
+// of them is free the first is overwritten, so the table never grows. Entries keep the word's length as well, which
+// leaves a wrong width only for words of the same length whose 32-bit hashes collide.
+class WordWidthCache {
+ public:
+  static constexpr int DEFAULT_CAPACITY = 1024;
+  static constexpr int PROBES = 8;
+
+  struct Key {
+    uint32_t hash;
+    uint16_t length;
+  };
+
+  // capacity must be a power of two; nothing is allocated until the first width is stored
+  explicit WordWidthCache(int capacity = DEFAULT_CAPACITY) : capacity(capacity) {}
+  ~WordWidthCache();
+  WordWidthCache(const WordWidthCache&) = delete;
+  WordWidthCache& operator=(const WordWidthCache&) = delete;
+
+  // Empties the cache when fontId isn't the font its widths were measured with
+  Key key(int fontId, EpdFontFamily::Style style, const char* word, size_t len);
+  bool get(const Key& key, uint16_t* width);
+  void put(const Key& key, uint16_t width);
+  void clear();
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+  size_t getAllocatedBytes() const { return entries ? capacity * sizeof(Entry) : 0; }
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    uint16_t length;  // 0 for a free slot
+    uint16_t width;
+  };
+
+  int capacity;
+  Entry* entries = nullptr;
+  int fontId = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+};
@@ -4,63 +4,72 @@
 #include <Serialization.h>
 
 void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y) const {
-  // Validate iterator bounds before rendering
-  if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
+  // Validate array bounds before rendering
+  if (wordOffsets.size() != wordLengths.size() || wordOffsets.size() != wordXpos.size() ||
+      wordOffsets.size() != wordStyles.size()) {
     Serial.printf("[%lu] [TXB] Render skipped: size mismatch (words=%u, xpos=%u, styles=%u)\n", millis(),
-                  (uint32_t)words.size(), (uint32_t)wordXpos.size(), (uint32_t)wordStyles.size());
+                  (uint32_t)wordOffsets.size(), (uint32_t)wordXpos.size(), (uint32_t)wordStyles.size());
     return;
   }
 
-  auto wordIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
-  auto wordXposIt = wordXpos.begin();
-  for (size_t i = 0; i < words.size(); i++) {
-    const int wordX = *wordXposIt + x;
-    const EpdFontFamily::Style currentStyle = *wordStylesIt;
-    renderer.drawText(fontId, wordX, y, wordIt->c_str(), true, currentStyle);
-
-    if ((currentStyle & EpdFontFamily::UNDERLINE) != 0) {
-      const std::string& w = *wordIt;
-      const int fullWordWidth = renderer.getTextWidth(fontId, w.c_str(), currentStyle);
-      // y is the top of the text line; add ascender to reach baseline, then offset 2px below
-      const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
-
-      int startX = wordX;
-      int underlineWidth = fullWordWidth;
-
-      // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
-      if (w.size() >= 3 && static_cast<uint8_t>(w[0]) == 0xE2 && static_cast<uint8_t>(w[1]) == 0x80 &&
-          static_cast<uint8_t>(w[2]) == 0x83) {
-        const char* visiblePtr = w.c_str() + 3;
-        const int prefixWidth = renderer.getTextAdvanceX(fontId, std::string("\xe2\x80\x83").c_str());
-        const int visibleWidth = renderer.getTextWidth(fontId, visiblePtr, currentStyle);
-        startX = wordX + prefixWidth;
-        underlineWidth = visibleWidth;
-      }
-
-      renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
+  for (size_t i = 0; i < wordOffsets.size(); i++) {
+    renderWord(renderer, fontId, wordXpos[i] + x, y, getWord(i), wordLengths[i], wordStyles[i]);
+  }
+}
+
+void TextBlock::renderWord(const GfxRenderer& renderer, const int fontId, const int x, const int y, const char* word,
+                           const size_t len, const EpdFontFamily::Style style) {
+  renderer.drawText(fontId, x, y, word, true, style);
+
+  if ((style & EpdFontFamily::UNDERLINE) != 0) {
+    const int fullWordWidth = renderer.getTextWidth(fontId, word, style);
+    // y is the top of the text line; add ascender to reach baseline, then offset 2px below
+    const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
+
+    int startX = x;
+    int underlineWidth = fullWordWidth;
+
+    // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
+    if (len >= 3 && static_cast<uint8_t>(word[0]) == 0xE2 && static_cast<uint8_t>(word[1]) == 0x80 &&
+        static_cast<uint8_t>(word[2]) == 0x83) {
+      const char* visiblePtr = word + 3;
+      const int prefixWidth = renderer.getTextAdvanceX(fontId, "\xe2\x80\x83");
+      const int visibleWidth = renderer.getTextWidth(fontId, visiblePtr, style);
+      startX = x + prefixWidth;
+      underlineWidth = visibleWidth;
     }
 
-    std::advance(wordIt, 1);
-    std::advance(wordStylesIt, 1);
-    std::advance(wordXposIt, 1);
+    renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
   }
 }
 
 bool TextBlock::serialize(FsFile& file) const {
-  if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
+  if (wordOffsets.size() != wordLengths.size() || wordOffsets.size() != wordXpos.size() ||
+      wordOffsets.size() != wordStyles.size()) {
     Serial.printf("[%lu] [TXB] Serialization failed: size mismatch (words=%u, xpos=%u, styles=%u)\n", millis(),
-                  words.size(), wordXpos.size(), wordStyles.size());
+                  wordOffsets.size(), wordXpos.size(), wordStyles.size());
     return false;
   }
 
-  // Word data
-  serialization::writePod(file, static_cast<uint16_t>(words.size()));
-  for (const auto& w : words) serialization::writeString(file, w);
-  for (auto x : wordXpos) serialization::writePod(file, x);
-  for (auto s : wordStyles) serialization::writePod(file, s);
-
-  // Style (alignment + margins/padding/indent)
+  // Word data, same layout as serialization::writeString() per word
+  serialization::writePod(file, static_cast<uint16_t>(wordOffsets.size()));
+  for (size_t i = 0; i < wordOffsets.size(); i++) {
+    const uint32_t len = wordLengths[i];
+    serialization::writePod(file, len);
+    file.write(reinterpret_cast<const uint8_t*>(getWord(i)), len);
+  }
+  file.write(reinterpret_cast<const uint8_t*>(wordXpos.data()), wordXpos.size() * sizeof(uint16_t));
+  file.write(reinterpret_cast<const uint8_t*>(wordStyles.data()), wordStyles.size() * sizeof(EpdFontFamily::Style));
+
+  // Style (alignment + margins/padding/indent), PageView::indexLines() skips it by SERIALIZED_BLOCK_STYLE_SIZE
+  static_assert(sizeof(blockStyle.alignment) + sizeof(blockStyle.textAlignDefined) + sizeof(blockStyle.marginTop) +
+                        sizeof(blockStyle.marginBottom) + sizeof(blockStyle.marginLeft) +
+                        sizeof(blockStyle.marginRight) + sizeof(blockStyle.paddingTop) +
+                        sizeof(blockStyle.paddingBottom) + sizeof(blockStyle.paddingLeft) +
+                        sizeof(blockStyle.paddingRight) + sizeof(blockStyle.textIndent) +
+                        sizeof(blockStyle.textIndentDefined) ==
+                    SERIALIZED_BLOCK_STYLE_SIZE,
+                "SERIALIZED_BLOCK_STYLE_SIZE must match the style fields written below");
   serialization::writePod(file, blockStyle.alignment);
   serialization::writePod(file, blockStyle.textAlignDefined);
   serialization::writePod(file, blockStyle.marginTop);
@@ -79,9 +88,6 @@ bool TextBlock::serialize(FsFile& file) const {
 
 std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   uint16_t wc;
-  std::list<std::string> words;
-  std::list<uint16_t> wordXpos;
-  std::list<EpdFontFamily::Style> wordStyles;
   BlockStyle blockStyle;
 
   // Word count
@@ -94,12 +100,26 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   }
 
   // Word data
-  words.resize(wc);
-  wordXpos.resize(wc);
-  wordStyles.resize(wc);
-  for (auto& w : words) serialization::readString(file, w);
-  for (auto& x : wordXpos) serialization::readPod(file, x);
-  for (auto& s : wordStyles) serialization::readPod(file, s);
+  auto arena = std::make_shared<TextArena>();
+  std::vector<uint32_t> wordOffsets(wc);
+  std::vector<uint16_t> wordLengths(wc);
+  std::vector<uint16_t> wordXpos(wc);
+  std::vector<EpdFontFamily::Style> wordStyles(wc);
+  for (uint16_t i = 0; i < wc; i++) {
+    uint32_t len;
+    serialization::readPod(file, len);
+    if (len > UINT16_MAX) {
+      Serial.printf("[%lu] [TXB] Deserialization failed: word length %u exceeds maximum\n", millis(), len);
+      return nullptr;
+    }
+    wordOffsets[i] = arena->size();
+    wordLengths[i] = len;
+    arena->resize(arena->size() + len + 1);
+    file.read(arena->data() + wordOffsets[i], len);
+    arena->back() = '\0';
+  }
+  file.read(wordXpos.data(), wc * sizeof(uint16_t));
+  file.read(wordStyles.data(), wc * sizeof(EpdFontFamily::Style));
 
   // Style (alignment + margins/padding/indent)
   serialization::readPod(file, blockStyle.alignment);
@@ -115,6 +135,6 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   serialization::readPod(file, blockStyle.textIndent);
   serialization::readPod(file, blockStyle.textIndentDefined);
 
-  return std::unique_ptr<TextBlock>(
-      new TextBlock(std::move(words), std::move(wordXpos), std::move(wordStyles), blockStyle));
+  return std::unique_ptr<TextBlock>(new TextBlock(std::move(arena), std::move(wordOffsets), std::move(wordLengths),
+                                                  std::move(wordXpos), std::move(wordStyles), blockStyle));
 }
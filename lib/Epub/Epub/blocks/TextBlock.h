@@ -2,36 +2,56 @@
 #include <EpdFontFamily.h>
 #include <HalStorage.h>
 
-#include <list>
 #include <memory>
-#include <string>
+#include <vector>
 
 #include "Block.h"
 #include "BlockStyle.h"
 
+// Word bytes stored back to back, each followed by a terminator so it can go to the renderer as a C string.
+// Lines extracted from one paragraph share its arena; the bytes a TextBlock points at are never written again.
+using TextArena = std::vector<char>;
+
 // Represents a line of text on a page
 class TextBlock final : public Block {
  private:
-  std::list<std::string> words;
-  std::list<uint16_t> wordXpos;
-  std::list<EpdFontFamily::Style> wordStyles;
+  std::shared_ptr<const TextArena> arena;
+  std::vector<uint32_t> wordOffsets;
+  std::vector<uint16_t> wordLengths;
+  std::vector<uint16_t> wordXpos;
+  std::vector<EpdFontFamily::Style> wordStyles;
   BlockStyle blockStyle;
 
  public:
-  explicit TextBlock(std::list<std::string> words, std::list<uint16_t> word_xpos,
-                     std::list<EpdFontFamily::Style> word_styles, const BlockStyle& blockStyle = BlockStyle())
-      : words(std::move(words)),
+  explicit TextBlock(std::shared_ptr<const TextArena> arena, std::vector<uint32_t> word_offsets,
+                     std::vector<uint16_t> word_lengths, std::vector<uint16_t> word_xpos,
+                     std::vector<EpdFontFamily::Style> word_styles, const BlockStyle& blockStyle = BlockStyle())
+      : arena(std::move(arena)),
+        wordOffsets(std::move(word_offsets)),
+        wordLengths(std::move(word_lengths)),
         wordXpos(std::move(word_xpos)),
         wordStyles(std::move(word_styles)),
         blockStyle(blockStyle) {}
   ~TextBlock() override = default;
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   const BlockStyle& getBlockStyle() const { return blockStyle; }
-  bool isEmpty() override { return words.empty(); }
+  bool isEmpty() override { return wordOffsets.empty(); }
+  size_t wordCount() const { return wordOffsets.size(); }
+  const char* getWord(const size_t index) const { return arena->data() + wordOffsets[index]; }
   void layout(GfxRenderer& renderer) override {};
   // given a renderer works out where to break the words into lines
   void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
+  // Draw one word (null-terminated, len bytes) including its underline, shared with PageView
+  static void renderWord(const GfxRenderer& renderer, int fontId, int x, int y, const char* word, size_t len,
+                         EpdFontFamily::Style style);
   BlockType getType() override { return TEXT_BLOCK; }
   bool serialize(FsFile& file) const;
   static std::unique_ptr<TextBlock> deserialize(FsFile& file);
+
+  // Bytes written by serialize() for the block style that follows the word data
+  static constexpr size_t SERIALIZED_BLOCK_STYLE_SIZE =
+      sizeof(BlockStyle::alignment) + sizeof(BlockStyle::textAlignDefined) + sizeof(BlockStyle::marginTop) +
+      sizeof(BlockStyle::marginBottom) + sizeof(BlockStyle::marginLeft) + sizeof(BlockStyle::marginRight) +
+      sizeof(BlockStyle::paddingTop) + sizeof(BlockStyle::paddingBottom) + sizeof(BlockStyle::paddingLeft) +
+      sizeof(BlockStyle::paddingRight) + sizeof(BlockStyle::textIndent) + sizeof(BlockStyle::textIndentDefined);
 };
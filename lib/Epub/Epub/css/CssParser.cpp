@@ -16,16 +16,16 @@ constexpr size_t MAX_CSS_SIZE = 64 * 1024;
 // Check if character is CSS whitespace
 bool isCssWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
 
-// Read entire file into string (with size limit)
-std::string readFileContent(FsFile& file) {
+// Read entire entry into string (with size limit)
+std::string readFileContent(ZipFile::EntryReader& file) {
   std::string content;
-  content.reserve(std::min(static_cast<size_t>(file.size()), MAX_CSS_SIZE));
+  content.reserve(std::min(file.size(), MAX_CSS_SIZE));
 
-  char buffer[READ_BUFFER_SIZE];
+  uint8_t buffer[READ_BUFFER_SIZE];
   while (file.available() && content.size() < MAX_CSS_SIZE) {
     const int bytesRead = file.read(buffer, sizeof(buffer));
     if (bytesRead <= 0) break;
-    content.append(buffer, bytesRead);
+    content.append(reinterpret_cast<const char*>(buffer), bytesRead);
   }
   return content;
 }
@@ -447,9 +447,9 @@ void CssParser::processRuleBlock(const std::string& selectorGroup, const std::st
 
 // Main parsing entry point
 
-bool CssParser::loadFromStream(FsFile& source) {
-  if (!source) {
-    Serial.printf("[%lu] [CSS] Cannot read from invalid file\n", millis());
+bool CssParser::loadFromStream(ZipFile::EntryReader& source) {
+  if (!source.isOpen()) {
+    Serial.printf("[%lu] [CSS] Cannot read from unopened entry\n", millis());
     return false;
   }
 
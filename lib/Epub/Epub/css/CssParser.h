@@ -1,6 +1,7 @@
 #pragma once
 
 #include <HalStorage.h>
+#include <ZipFile.h>
 
 #include <string>
 #include <unordered_map>
@@ -37,12 +38,12 @@ class CssParser {
   CssParser& operator=(const CssParser&) = delete;
 
   /**
-   * Load and parse CSS from a file stream.
+   * Load and parse CSS from a ZIP entry stream.
    * Can be called multiple times to accumulate rules from multiple stylesheets.
-   * @param source Open file handle to read from
+   * @param source Open entry reader to read from
    * @return true if parsing completed (even if no rules found)
    */
-  bool loadFromStream(FsFile& source);
+  bool loadFromStream(ZipFile::EntryReader& source);
 
   /**
    * Look up the style for an HTML element, considering tag name and class attributes.
@@ -1,8 +1,8 @@
 #include "ChapterHtmlSlimParser.h"
 
 #include <GfxRenderer.h>
-#include <HalStorage.h>
 #include <HardwareSerial.h>
+#include <Serialization.h>
 #include <expat.h>
 
 #include "../Page.h"
@@ -98,6 +98,16 @@ void ChapterHtmlSlimParser::flushPartWordBuffer() {
 // start a new text block if needed
 void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
   nextWordContinues = false;  // New block = new paragraph, no continuation
+  if (resume) {
+    if (XML_GetCurrentByteIndex(parser) == static_cast<XML_Index>(resume->byteOffset)) {
+      restoreResumeState();
+      return;
+    }
+    // Still replaying: blocks stay empty and are never laid out, they only exist for the handlers to refer to
+    currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle));
+    return;
+  }
+
   if (currentTextBlock) {
     // already have a text block running and it is empty - just reuse it
     if (currentTextBlock->isEmpty()) {
@@ -109,10 +119,58 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
     }
 
     makePages();
+    if (blockBoundaryFn) {
+      boundaryBlockStyle = blockStyle;
+      blockBoundaryFn();
+    }
   }
   currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle));
 }
 
+void ChapterHtmlSlimParser::restoreResumeState() {
+  Serial.printf("[%lu] [EHP] Resumed layout at byte %u\n", millis(), resume->byteOffset);
+  currentPage = std::move(resume->page);
+  currentPageNextY = resume->pageNextY;
+  partWordBufferIndex = static_cast<int>(resume->pendingWord.size());
+  memcpy(partWordBuffer, resume->pendingWord.data(), partWordBufferIndex);
+  // The saved style, not the one passed in: a <br> continues the style of a block that was not rebuilt in the replay
+  currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, resume->blockStyle));
+  resume.reset();
+}
+
+bool ChapterHtmlSlimParser::saveResumeState(FsFile& file) const {
+  if (!parser) {
+    return false;
+  }
+  serialization::writePod(file, static_cast<uint32_t>(XML_GetCurrentByteIndex(parser)));
+  serialization::writePod(file, currentPageNextY);
+  serialization::writePod(file, boundaryBlockStyle);
+  serialization::writeString(file, std::string(partWordBuffer, partWordBufferIndex));
+  serialization::writePod(file, static_cast<bool>(currentPage));
+  return !currentPage || currentPage->serialize(file);
+}
+
+bool ChapterHtmlSlimParser::loadResumeState(FsFile& file) {
+  auto state = std::unique_ptr<ResumeState>(new ResumeState());
+  bool hasPage = false;
+  serialization::readPod(file, state->byteOffset);
+  serialization::readPod(file, state->pageNextY);
+  serialization::readPod(file, state->blockStyle);
+  serialization::readString(file, state->pendingWord);
+  serialization::readPod(file, hasPage);
+  if (state->pendingWord.size() > MAX_WORD_SIZE) {
+    return false;
+  }
+  if (hasPage) {
+    state->page = Page::deserialize(file);
+    if (!state->page) {
+      return false;
+    }
+  }
+  resume = std::move(state);
+  return true;
+}
+
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
@@ -342,8 +400,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
 void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char* s, const int len) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
-  // Middle of skip
-  if (self->skipUntilDepth < self->depth) {
+  // Middle of skip, or replaying markup that was laid out before the resume point
+  if (self->skipUntilDepth < self->depth || self->resume) {
     return;
   }
 
@@ -389,7 +447,8 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     Serial.printf("[%lu] [EHP] Text block too long, splitting into multiple pages\n", millis());
     self->currentTextBlock->layoutAndExtractLines(
         self->renderer, self->fontId, self->viewportWidth,
-        [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false);
+        [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false,
+        &self->widthCache);
   }
 }
 
@@ -463,7 +522,7 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 }
 
-bool ChapterHtmlSlimParser::parseAndBuildPages() {
+bool ChapterHtmlSlimParser::beginParsing() {
   auto paragraphAlignmentBlockStyle = BlockStyle();
   paragraphAlignmentBlockStyle.textAlignDefined = true;
   // Resolve None sentinel to Justify for initial block (no CSS context yet)
@@ -471,84 +530,85 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
                          ? CssTextAlign::Justify
                          : static_cast<CssTextAlign>(this->paragraphAlignment);
   paragraphAlignmentBlockStyle.alignment = align;
-  startNewTextBlock(paragraphAlignmentBlockStyle);
-
-  const XML_Parser parser = XML_ParserCreate(nullptr);
-  int done;
-
+  parser = XML_ParserCreate(nullptr);
   if (!parser) {
     Serial.printf("[%lu] [EHP] Couldn't allocate memory for parser\n", millis());
     return false;
   }
 
-  FsFile file;
-  if (!Storage.openFileForRead("EHP", filepath, file)) {
-    XML_ParserFree(parser);
-    return false;
-  }
+  startNewTextBlock(paragraphAlignmentBlockStyle);
 
-  // Get file size to decide whether to show indexing popup.
-  if (popupFn && file.size() >= MIN_SIZE_FOR_POPUP) {
+  // Use the inflated entry size to decide whether to show indexing popup.
+  if (popupFn && reader.size() >= MIN_SIZE_FOR_POPUP) {
     popupFn();
   }
 
   XML_SetUserData(parser, this);
   XML_SetElementHandler(parser, startElement, endElement);
   XML_SetCharacterDataHandler(parser, characterData);
+  return true;
+}
 
-  do {
-    void* const buf = XML_GetBuffer(parser, 1024);
-    if (!buf) {
-      Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
-      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      file.close();
-      return false;
-    }
+bool ChapterHtmlSlimParser::parseNextChunk() {
+  if (!parser) {
+    return false;
+  }
 
-    const size_t len = file.read(buf, 1024);
+  void* const buf = XML_GetBuffer(parser, 1024);
+  if (!buf) {
+    Serial.printf("[%lu] [EHP] Couldn't allocate memory for buffer\n", millis());
+    releaseParser();
+    return false;
+  }
 
-    if (len == 0 && file.available() > 0) {
-      Serial.printf("[%lu] [EHP] File read error\n", millis());
-      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      file.close();
-      return false;
-    }
+  const int len = reader.read(static_cast<uint8_t*>(buf), 1024);
 
-    done = file.available() == 0;
+  if (len < 0 || (len == 0 && reader.available() > 0)) {
+    Serial.printf("[%lu] [EHP] Entry read error\n", millis());
+    releaseParser();
+    return false;
+  }
+
+  const bool done = reader.available() == 0;
+
+  if (XML_ParseBuffer(parser, len, done) == XML_STATUS_ERROR) {
+    Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(), XML_GetCurrentLineNumber(parser),
+                  XML_ErrorString(XML_GetErrorCode(parser)));
+    releaseParser();
+    return false;
+  }
 
-    if (XML_ParseBuffer(parser, static_cast<int>(len), done) == XML_STATUS_ERROR) {
-      Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(), XML_GetCurrentLineNumber(parser),
-                    XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
-      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
-      XML_SetCharacterDataHandler(parser, nullptr);
-      XML_ParserFree(parser);
-      file.close();
+  if (done) {
+    releaseParser();
+    if (resume) {
+      Serial.printf("[%lu] [EHP] Chapter ended before the resume point at byte %u\n", millis(), resume->byteOffset);
       return false;
     }
-  } while (!done);
+    finished = true;
+
+    // Process last page if there is still text
+    if (currentTextBlock) {
+      makePages();
+      completePageFn(std::move(currentPage));
+      currentPage.reset();
+      currentTextBlock.reset();
+    }
+    Serial.printf("[%lu] [EHP] Word widths: %u measured, %u from cache\n", millis(), widthCache.getMisses(),
+                  widthCache.getHits());
+    widthCache.clear();
+  }
+  return true;
+}
 
+void ChapterHtmlSlimParser::releaseParser() {
+  if (!parser) {
+    return;
+  }
   XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
   XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
   XML_SetCharacterDataHandler(parser, nullptr);
   XML_ParserFree(parser);
-  file.close();
-
-  // Process last page if there is still text
-  if (currentTextBlock) {
-    makePages();
-    completePageFn(std::move(currentPage));
-    currentPage.reset();
-    currentTextBlock.reset();
-  }
-
-  return true;
+  parser = nullptr;
 }
 
 void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
@@ -595,7 +655,7 @@ void ChapterHtmlSlimParser::makePages() {
 
   currentTextBlock->layoutAndExtractLines(
       renderer, fontId, effectiveWidth,
-      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); }, true, &widthCache);
 
   // Apply bottom spacing after the paragraph (stored in pixels)
   if (blockStyle.marginBottom > 0) {
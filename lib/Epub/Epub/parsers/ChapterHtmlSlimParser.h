@@ -1,12 +1,15 @@
 #pragma once
 
+#include <ZipFile.h>
 #include <expat.h>
 
 #include <climits>
 #include <functional>
 #include <memory>
+#include <string>
 
 #include "../ParsedText.h"
+#include "../WordWidthCache.h"
 #include "../blocks/TextBlock.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
@@ -17,10 +20,11 @@ class GfxRenderer;
 #define MAX_WORD_SIZE 200
 
 class ChapterHtmlSlimParser {
-  const std::string& filepath;
+  ZipFile::EntryReader& reader;
   GfxRenderer& renderer;
   std::function<void(std::unique_ptr<Page>)> completePageFn;
   std::function<void()> popupFn;  // Popup callback
+  std::function<void()> blockBoundaryFn;
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -32,7 +36,12 @@ class ChapterHtmlSlimParser {
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  WordWidthCache widthCache;  // Word widths measured in this chapter so far
   std::unique_ptr<Page> currentPage = nullptr;
+  XML_Parser parser = nullptr;
+  bool finished = false;
+  // Style of the block startNewTextBlock() is opening while blockBoundaryFn runs
+  BlockStyle boundaryBlockStyle;
   int16_t currentPageNextY = 0;
   int fontId;
   float lineCompression;
@@ -57,25 +66,40 @@ class ChapterHtmlSlimParser {
   bool effectiveItalic = false;
   bool effectiveUnderline = false;
 
+  // Layout state saved at a block boundary. While resuming, the chapter is replayed from the start with text and
+  // layout switched off, which rebuilds the depth and style tracking above, until the start tag at byteOffset is
+  // reached and the rest is restored from here.
+  struct ResumeState {
+    uint32_t byteOffset = 0;
+    int16_t pageNextY = 0;
+    BlockStyle blockStyle;
+    std::string pendingWord;
+    std::unique_ptr<Page> page;
+  };
+  std::unique_ptr<ResumeState> resume;
+
   void updateEffectiveInlineStyle();
   void startNewTextBlock(const BlockStyle& blockStyle);
   void flushPartWordBuffer();
   void makePages();
+  void restoreResumeState();
+  void releaseParser();
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
 
  public:
-  explicit ChapterHtmlSlimParser(const std::string& filepath, GfxRenderer& renderer, const int fontId,
+  explicit ChapterHtmlSlimParser(ZipFile::EntryReader& reader, GfxRenderer& renderer, const int fontId,
                                  const float lineCompression, const bool extraParagraphSpacing,
                                  const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                  const uint16_t viewportHeight, const bool hyphenationEnabled,
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
                                  const bool embeddedStyle, const std::function<void()>& popupFn = nullptr,
-                                 const CssParser* cssParser = nullptr)
+                                 const CssParser* cssParser = nullptr,
+                                 const std::function<void()>& blockBoundaryFn = nullptr)
 
-      : filepath(filepath),
+      : reader(reader),
         renderer(renderer),
         fontId(fontId),
         lineCompression(lineCompression),
@@ -86,10 +110,24 @@ class ChapterHtmlSlimParser {
         hyphenationEnabled(hyphenationEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        blockBoundaryFn(blockBoundaryFn),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle) {}
 
-  ~ChapterHtmlSlimParser() = default;
-  bool parseAndBuildPages();
+  ~ChapterHtmlSlimParser() { releaseParser(); }
+  // Call beginParsing() once, then parseNextChunk() until isFinished(). Pages are handed to completePageFn as they
+  // fill up; the last one follows the final chunk.
+  bool beginParsing();
+  // Feed the next 1KB of the entry to the parser. Returns false on a read or parse error.
+  bool parseNextChunk();
+  bool isFinished() const { return finished; }
+  // True while replaying up to a state loaded with loadResumeState()
+  bool isResuming() const { return resume != nullptr; }
+  // blockBoundaryFn is called whenever a finished block has been laid out and the next one is about to start, the only
+  // point a build can be resumed from. From inside it, saveResumeState() records that point; every page completed so
+  // far has already been handed to completePageFn.
+  bool saveResumeState(FsFile& file) const;
+  // Read a state written by saveResumeState() before beginParsing(). Pages up to it are not produced again.
+  bool loadResumeState(FsFile& file);
   void addLineToPage(std::shared_ptr<TextBlock> line);
 };
@@ -1,5 +1,6 @@
 #include "Bitmap.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -17,6 +18,8 @@ Bitmap::~Bitmap() {
 
   delete atkinsonDitherer;
   delete fsDitherer;
+
+  free(columnEdges);
 }
 
 uint16_t Bitmap::readLE16(FsFile& f) {
@@ -140,22 +143,68 @@ BmpReaderError Bitmap::parseHeaders() {
     return BmpReaderError::SeekPixelDataFailed;
   }
 
-  // Create ditherer if enabled (only for 2-bit output)
-  // Use OUTPUT dimensions for dithering (after prescaling)
+  createDitherer(width);
+
+  return BmpReaderError::Ok;
+}
+
+// Create ditherer if enabled (only for 2-bit output), as wide as the rows it will dither
+void Bitmap::createDitherer(const int ditherWidth) const {
+  delete atkinsonDitherer;
+  delete fsDitherer;
+  atkinsonDitherer = nullptr;
+  fsDitherer = nullptr;
   if (bpp > 2 && dithering) {
     if (USE_ATKINSON) {
-      atkinsonDitherer = new AtkinsonDitherer(width);
+      atkinsonDitherer = new AtkinsonDitherer(ditherWidth);
     } else {
-      fsDitherer = new FloydSteinbergDitherer(width);
+      fsDitherer = new FloydSteinbergDitherer(ditherWidth);
+    }
+  }
+}
+
+bool Bitmap::setOutputSize(const int outputWidth, const int outputHeight) const {
+  if (outputWidth == width && outputHeight == height) {
+    if (outWidth) {
+      free(columnEdges);
+      columnEdges = rowSums = outputSums = carrySums = nullptr;
+      outWidth = outHeight = 0;
+      createDitherer(width);
     }
+    return true;
+  }
+  if (bpp < 8 || outputWidth <= 0 || outputHeight <= 0 || outputWidth > width || outputHeight > height ||
+      width > outputWidth * MAX_BOX_FOOTPRINT || height > outputHeight * MAX_BOX_FOOTPRINT) {
+    return false;
   }
 
-  return BmpReaderError::Ok;
+  // Edges, then the row, output and carry sums
+  auto* buffers = static_cast<uint32_t*>(realloc(columnEdges, (4 * outputWidth + 1) * sizeof(uint32_t)));
+  if (!buffers) {
+    return false;
+  }
+  columnEdges = buffers;
+  rowSums = columnEdges + outputWidth + 1;
+  outputSums = rowSums + outputWidth;
+  carrySums = outputSums + outputWidth;
+  for (int x = 0; x <= outputWidth; x++) {
+    columnEdges[x] = static_cast<uint64_t>(x) * width * 256 / outputWidth;
+  }
+  averageScale = (static_cast<uint64_t>(outputWidth) * outputHeight << 32) / (static_cast<uint64_t>(width) * height);
+
+  outWidth = outputWidth;
+  outHeight = outputHeight;
+  nextSourceRow = 0;
+  nextOutputRow = 0;
+  carryRow = false;
+  createDitherer(outputWidth);
+  return true;
 }
 
 // packed 2bpp output, 0 = black, 1 = dark gray, 2 = light gray, 3 = white
 BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
   // Note: rowBuffer should be pre-allocated by the caller to size 'rowBytes'
+  if (outWidth) return readBoxFilteredRow(data, rowBuffer);
   if (file.read(rowBuffer, rowBytes) != rowBytes) return BmpReaderError::ShortReadRow;
 
   prevRowY += 1;
@@ -251,6 +300,142 @@ BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
   return BmpReaderError::Ok;
 }
 
+namespace {
+// Sums the luminance of a source row into output columns with edges in 1/256 pixels: the pixels wholly inside a
+// column in a register, the one on its right edge split by its coverage with the next column
+template <typename Lum>
+void sumColumns(const uint32_t* columnEdges, const int outWidth, uint32_t* rowSums, Lum lum) {
+  int x = 0;
+  uint32_t split = 0;
+  for (int outX = 0; outX < outWidth; outX++) {
+    const uint32_t edge = columnEdges[outX + 1];
+    const int wholeEnd = static_cast<int>(edge >> 8);
+    uint32_t whole = 0;
+    for (; x < wholeEnd; x++) {
+      whole += lum(x);
+    }
+    uint32_t sum = (whole << 8) + split;
+    const uint32_t coverage = edge & 0xFF;
+    if (coverage) {
+      const uint32_t edgeLum = lum(x++);
+      sum += edgeLum * coverage;
+      split = edgeLum * (256 - coverage);
+    } else {
+      split = 0;
+    }
+    rowSums[outX] = sum;
+  }
+}
+}  // namespace
+
+// Sums the source rows under the next output row, each source pixel split between the output columns it covers and
+// each source row between the output rows it covers, then averages and packs the sums like readNextRow
+BmpReaderError Bitmap::readBoxFilteredRow(uint8_t* data, uint8_t* rowBuffer) const {
+  const uint32_t top = static_cast<uint64_t>(nextOutputRow) * height * 256 / outHeight;
+  const uint32_t bottom = static_cast<uint64_t>(nextOutputRow + 1) * height * 256 / outHeight;
+
+  if (carryRow) {
+    std::swap(outputSums, carrySums);
+  } else {
+    memset(outputSums, 0, outWidth * sizeof(uint32_t));
+  }
+  memset(carrySums, 0, outWidth * sizeof(uint32_t));
+  carryRow = false;
+
+  while (static_cast<uint32_t>(nextSourceRow) * 256 < bottom) {
+    if (file.read(rowBuffer, rowBytes) != rowBytes) return BmpReaderError::ShortReadRow;
+
+    switch (bpp) {
+      case 32:
+        sumColumns(columnEdges, outWidth, rowSums, [rowBuffer](const int x) {
+          const uint8_t* p = rowBuffer + x * 4;
+          return (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
+        });
+        break;
+      case 24:
+        sumColumns(columnEdges, outWidth, rowSums, [rowBuffer](const int x) {
+          const uint8_t* p = rowBuffer + x * 3;
+          return (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
+        });
+        break;
+      default:
+        sumColumns(columnEdges, outWidth, rowSums,
+                   [rowBuffer, this](const int x) { return static_cast<uint32_t>(paletteLum[rowBuffer[x]]); });
+        break;
+    }
+
+    const uint32_t rowTop = nextSourceRow * 256;
+    const uint32_t rowBottom = rowTop + 256;
+    const uint32_t coverage = std::min(bottom, rowBottom) - std::max(top, rowTop);
+    for (int x = 0; x < outWidth; x++) {
+      outputSums[x] += rowSums[x] * coverage >> 8;
+    }
+    if (rowBottom > bottom) {
+      for (int x = 0; x < outWidth; x++) {
+        carrySums[x] += rowSums[x] * (rowBottom - bottom) >> 8;
+      }
+      carryRow = true;
+    }
+    nextSourceRow++;
+  }
+
+  const int y = nextOutputRow++;
+  uint8_t* outPtr = data;
+  uint8_t currentOutByte = 0;
+  int bitShift = 6;
+  for (int x = 0; x < outWidth; x++) {
+    const int lum = std::min<uint64_t>(255, outputSums[x] * averageScale >> 40);
+    uint8_t color;
+    if (atkinsonDitherer) {
+      color = atkinsonDitherer->processPixel(adjustPixel(lum), x);
+    } else if (fsDitherer) {
+      color = fsDitherer->processPixel(adjustPixel(lum), x);
+    } else {
+      color = quantize(adjustPixel(lum), x, y);
+    }
+    currentOutByte |= color << bitShift;
+    if (bitShift == 0) {
+      *outPtr++ = currentOutByte;
+      currentOutByte = 0;
+      bitShift = 6;
+    } else {
+      bitShift -= 2;
+    }
+  }
+  if (bitShift != 6) *outPtr = currentOutByte;
+
+  if (atkinsonDitherer)
+    atkinsonDitherer->nextRow();
+  else if (fsDitherer)
+    fsDitherer->nextRow();
+
+  return BmpReaderError::Ok;
+}
+
+BmpReaderError Bitmap::skipRows(const int count) const {
+  if (count <= 0) {
+    return BmpReaderError::Ok;
+  }
+  if (outWidth) {
+    // Seek to the first source row under the next output row to be read, back one if it was read already
+    const int targetRow = nextOutputRow + count;
+    const int sourceRow = static_cast<uint64_t>(targetRow) * height / outHeight;
+    if (sourceRow != nextSourceRow && !file.seekCur(static_cast<int64_t>(sourceRow - nextSourceRow) * rowBytes)) {
+      return BmpReaderError::SeekPixelDataFailed;
+    }
+    nextSourceRow = sourceRow;
+    nextOutputRow = targetRow;
+    carryRow = false;
+    return BmpReaderError::Ok;
+  }
+  if (!file.seekCur(static_cast<int64_t>(count) * rowBytes)) {
+    return BmpReaderError::SeekPixelDataFailed;
+  }
+  // Keeps noise dithering, which goes by row number, lined up with the rows that are read
+  prevRowY += count;
+  return BmpReaderError::Ok;
+}
+
 BmpReaderError Bitmap::rewindToData() const {
   if (!file.seek(bfOffBits)) {
     return BmpReaderError::SeekPixelDataFailed;
@@ -259,6 +444,9 @@ BmpReaderError Bitmap::rewindToData() const {
   // Reset dithering when rewinding
   if (fsDitherer) fsDitherer->reset();
   if (atkinsonDitherer) atkinsonDitherer->reset();
+  nextSourceRow = 0;
+  nextOutputRow = 0;
+  carryRow = false;
 
   return BmpReaderError::Ok;
 }
@@ -36,9 +36,20 @@ class Bitmap {
   ~Bitmap();
   BmpReaderError parseHeaders();
   BmpReaderError readNextRow(uint8_t* data, uint8_t* rowBuffer) const;
+  // Moves past rows without reading them. Error diffusion carries on from the last row read, as if the rows were
+  // adjacent.
+  BmpReaderError skipRows(int count) const;
   BmpReaderError rewindToData() const;
+  // Box filters the image down to outputWidth x outputHeight: from then on readNextRow and skipRows go by output
+  // rows. Each output pixel is the average luminance over its footprint in the source, edge rows and columns weighted
+  // by their coverage in 1/256 pixels, then dithered or quantized at the output size. Works for 8, 24 and 32-bit
+  // images at most MAX_BOX_FOOTPRINT times the output size either way; returns false and reads full size rows for
+  // anything else. Call with the data not yet read; passing the image size goes back to full size rows.
+  bool setOutputSize(int outputWidth, int outputHeight) const;
   int getWidth() const { return width; }
   int getHeight() const { return height; }
+  int getOutputWidth() const { return outWidth ? outWidth : width; }
+  int getOutputHeight() const { return outWidth ? outHeight : height; }
   bool isTopDown() const { return topDown; }
   bool hasGreyscale() const { return bpp > 1; }
   int getRowBytes() const { return rowBytes; }
@@ -46,8 +57,12 @@ class Bitmap {
   uint16_t getBpp() const { return bpp; }
 
  private:
+  static constexpr int MAX_BOX_FOOTPRINT = 64;
+
   static uint16_t readLE16(FsFile& f);
   static uint32_t readLE32(FsFile& f);
+  BmpReaderError readBoxFilteredRow(uint8_t* data, uint8_t* rowBuffer) const;
+  void createDitherer(int ditherWidth) const;
 
   FsFile& file;
   bool dithering = false;
@@ -66,4 +81,17 @@ class Bitmap {
 
   mutable AtkinsonDitherer* atkinsonDitherer = nullptr;
   mutable FloydSteinbergDitherer* fsDitherer = nullptr;
+
+  // Box filter state, see setOutputSize. Sums are luminance times coverage in 1/256 pixels: of the source row read,
+  // of the output row being filled, and of the one after it, which a source row straddling both contributes to.
+  mutable int outWidth = 0;  // 0 while reading full size rows
+  mutable int outHeight = 0;
+  mutable int nextSourceRow = 0;
+  mutable int nextOutputRow = 0;
+  mutable bool carryRow = false;
+  mutable uint64_t averageScale = 0;  // Output to source area ratio times 2^32
+  mutable uint32_t* columnEdges = nullptr;  // outWidth + 1 column footprint edges in 1/256 source pixels
+  mutable uint32_t* rowSums = nullptr;
+  mutable uint32_t* outputSums = nullptr;
+  mutable uint32_t* carrySums = nullptr;
 };
@@ -0,0 +1,117 @@
+#include "FrameDiff.h"
+
+#include <algorithm>
+#include <cstring>
+
+void FrameDiff::compare(const uint8_t* frame) {
+  stats = Stats();
+  stats.panelKnown = panelKnown;
+
+  for (int tileRow = 0; tileRow < TILE_ROWS; tileRow++) {
+    uint64_t hash[TILE_COLUMNS];
+    uint32_t ink[TILE_COLUMNS] = {};
+    for (auto& h : hash) {
+      h = 0xcbf29ce484222325ULL;
+    }
+
+    const uint8_t* row = frame + tileRow * TILE_HEIGHT * HalDisplay::DISPLAY_WIDTH_BYTES;
+    for (int y = 0; y < TILE_HEIGHT; y++, row += HalDisplay::DISPLAY_WIDTH_BYTES) {
+      for (int column = 0; column < TILE_COLUMNS; column++) {
+        // A tile row is 5 bytes, taken as one word
+        uint64_t bits = 0;
+        memcpy(&bits, row + column * TILE_WIDTH_BYTES, TILE_WIDTH_BYTES);
+        hash[column] = (hash[column] ^ bits) * 0x100000001b3ULL;
+        // 0 bits are black
+        ink[column] += TILE_WIDTH_BYTES * 8 - __builtin_popcountll(bits);
+      }
+    }
+
+    for (int column = 0; column < TILE_COLUMNS; column++) {
+      const int tile = tileRow * TILE_COLUMNS + column;
+      const auto newHash = static_cast<uint32_t>(hash[column] ^ hash[column] >> 32);
+      const auto newInk = static_cast<uint16_t>(ink[column]);
+      if (panelKnown && tileHash[tile] == newHash && tileInk[tile] == newInk) {
+        continue;
+      }
+
+      stats.changedTiles++;
+      // Without a known panel assume it was white
+      const uint16_t oldInk = panelKnown ? tileInk[tile] : 0;
+      stats.flippedPixels += oldInk + newInk;
+      stats.blackToWhitePixels += oldInk;
+      const int x = column * TILE_WIDTH_BYTES * 8;
+      const int y = tileRow * TILE_HEIGHT;
+      if (stats.changedTiles == 1) {
+        stats.minX = x;
+        stats.minY = y;
+      }
+      stats.minX = std::min<int16_t>(stats.minX, x);
+      stats.maxX = std::max<int16_t>(stats.maxX, x + TILE_WIDTH_BYTES * 8 - 1);
+      stats.maxY = y + TILE_HEIGHT - 1;
+      tileHash[tile] = newHash;
+      tileInk[tile] = newInk;
+    }
+  }
+}
+
+FrameDiff::Update FrameDiff::plan(const uint8_t* frame, const int budgetPages) {
+  compare(frame);
+  const bool wasKnown = panelKnown;
+  panelKnown = true;
+
+  if (stats.changedTiles == 0) {
+    stats.update = SKIP;
+    return SKIP;
+  }
+
+  ghostingPressure += stats.flippedPixels;
+  whitePressure += stats.blackToWhitePixels;
+  const uint32_t budget = static_cast<uint32_t>(std::max(1, budgetPages)) * PAGE_FLIPS;
+  const uint32_t area = static_cast<uint32_t>(stats.maxX - stats.minX + 1) * (stats.maxY - stats.minY + 1);
+
+  if (whitePressure >= FULL_REFRESH_BUDGETS * budget) {
+    stats.update = FULL;
+  } else if (!wasKnown || ghostingPressure >= budget) {
+    // Content the panel was last cleared from is unknown, so start over with a half refresh
+    stats.update = HALF;
+  } else if (area <= WINDOW_MAX_AREA) {
+    stats.update = WINDOW;
+  } else {
+    stats.update = FAST;
+  }
+
+  if (stats.update == FULL) {
+    whitePressure = 0;
+  }
+  if (stats.update == FULL || stats.update == HALF) {
+    ghostingPressure = 0;
+  }
+  stats.ghostingPressure = ghostingPressure;
+  stats.whitePressure = whitePressure;
+  return stats.update;
+}
+
+void FrameDiff::record(const uint8_t* frame, const HalDisplay::RefreshMode mode) {
+  compare(frame);
+  panelKnown = true;
+
+  ghostingPressure += stats.flippedPixels;
+  whitePressure += stats.blackToWhitePixels;
+  switch (mode) {
+    case HalDisplay::FULL_REFRESH:
+      whitePressure = 0;
+      ghostingPressure = 0;
+      stats.update = FULL;
+      break;
+    case HalDisplay::HALF_REFRESH:
+      ghostingPressure = 0;
+      stats.update = HALF;
+      break;
+    case HalDisplay::FAST_REFRESH:
+    default:
+      stats.update = FAST;
+      break;
+  }
+  stats.ghostingPressure = ghostingPressure;
+  stats.whitePressure = whitePressure;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <HalDisplay.h>
+
+#include <cstdint>
+
+// Remembers what the panel shows as a signature (hash and black pixel count) per 40x16 pixel tile and compares frame
+// buffers against it before they are sent. From the tiles that changed it estimates how many pixels flip, which adds
+// up to the ghosting pressure that decides between fast, half and full refreshes. Pixel counts are upper bounds: a
+// changed tile counts all its black pixels before and after as flipped, about 1.7x the real count for text whose
+// lines share baselines from page to page. The budgets below are calibrated in that unit with test/frame_diff_trace.
+class FrameDiff {
+ public:
+  static constexpr int TILE_WIDTH_BYTES = 5;
+  static constexpr int TILE_HEIGHT = 16;
+  static constexpr int TILE_COLUMNS = HalDisplay::DISPLAY_WIDTH_BYTES / TILE_WIDTH_BYTES;
+  static constexpr int TILE_ROWS = HalDisplay::DISPLAY_HEIGHT / TILE_HEIGHT;
+  static constexpr int TILE_COUNT = TILE_COLUMNS * TILE_ROWS;
+  static_assert(TILE_COLUMNS * TILE_WIDTH_BYTES == HalDisplay::DISPLAY_WIDTH_BYTES &&
+                    TILE_ROWS * TILE_HEIGHT == HalDisplay::DISPLAY_HEIGHT,
+                "Tiles do not line up with the panel");
+
+  // Estimated flipped pixels of a turn between two dense pages of text, the unit the refresh budget is counted in
+  static constexpr uint32_t PAGE_FLIPS = HalDisplay::DISPLAY_WIDTH * HalDisplay::DISPLAY_HEIGHT / 4;
+  // Black to white pressure, in refresh budgets, after which a half refresh is not enough and a full one is due
+  static constexpr uint32_t FULL_REFRESH_BUDGETS = 8;
+  // Largest changed area, as a fraction of the panel, still sent as a window
+  static constexpr uint32_t WINDOW_MAX_AREA = HalDisplay::DISPLAY_WIDTH * HalDisplay::DISPLAY_HEIGHT / 4;
+
+  enum Update { SKIP, WINDOW, FAST, HALF, FULL };
+
+  struct Stats {
+    uint16_t changedTiles = 0;
+    // Box around the changed tiles in panel pixels, inclusive; empty while minX > maxX
+    int16_t minX = 0;
+    int16_t minY = 0;
+    int16_t maxX = -1;
+    int16_t maxY = -1;
+    uint32_t flippedPixels = 0;
+    uint32_t blackToWhitePixels = 0;
+    // Flipped pixels since the last half or full refresh, and black to white ones since the last full refresh
+    uint32_t ghostingPressure = 0;
+    uint32_t whitePressure = 0;
+    // False when the panel content wasn't known, e.g. for the first frame
+    bool panelKnown = false;
+    Update update = SKIP;
+  };
+
+  // Compare frame with what the panel shows and pick how to send it, then take it as shown. The caller must send at
+  // least the box around the changed tiles. budgetPages is how many page turns' worth of flipped pixels may pile up
+  // before a half refresh.
+  Update plan(const uint8_t* frame, int budgetPages);
+  // Take a frame sent without plan() as shown
+  void record(const uint8_t* frame, HalDisplay::RefreshMode mode);
+  void invalidate() { panelKnown = false; }
+  const Stats& getStats() const { return stats; }
+
+ private:
+  uint32_t tileHash[TILE_COUNT] = {};
+  uint16_t tileInk[TILE_COUNT] = {};
+  bool panelKnown = false;
+  uint32_t ghostingPressure = 0;
+  uint32_t whitePressure = 0;
+  Stats stats;
+
+  void compare(const uint8_t* frame);
+};
@@ -46,6 +46,29 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
   }
 }
 
+// Logical coordinates of a physical panel pixel, the inverse of rotateCoordinates()
+static inline void unrotateCoordinates(const GfxRenderer::Orientation orientation, const int phyX, const int phyY,
+                                       int* x, int* y) {
+  switch (orientation) {
+    case GfxRenderer::Portrait:
+      *x = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      *y = phyX;
+      break;
+    case GfxRenderer::LandscapeClockwise:
+      *x = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      *y = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      break;
+    case GfxRenderer::PortraitInverted:
+      *x = phyY;
+      *y = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      break;
+    case GfxRenderer::LandscapeCounterClockwise:
+      *x = phyX;
+      *y = phyY;
+      break;
+  }
+}
+
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
 // efficient as possible.
 void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
@@ -55,11 +78,14 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   // Note: this call should be inlined for better performance
   rotateCoordinates(orientation, x, y, &phyX, &phyY);
 
-  // Bounds checking against physical panel dimensions
-  if (phyX < 0 || phyX >= HalDisplay::DISPLAY_WIDTH || phyY < 0 || phyY >= HalDisplay::DISPLAY_HEIGHT) {
-    Serial.printf("[%lu] [GFX] !! Outside range (%d, %d) -> (%d, %d)\n", millis(), x, y, phyX, phyY);
+  // Bounds checking against the clip box, which lies within the physical panel
+  if (phyX < clipBox.minX || phyX > clipBox.maxX || phyY < clipBox.minY || phyY > clipBox.maxY) {
+    if (phyX < 0 || phyX >= HalDisplay::DISPLAY_WIDTH || phyY < 0 || phyY >= HalDisplay::DISPLAY_HEIGHT) {
+      Serial.printf("[%lu] [GFX] !! Outside range (%d, %d) -> (%d, %d)\n", millis(), x, y, phyX, phyY);
+    }
     return;
   }
+  dirtyRegion.add(phyX, phyX, phyY);
 
   // Calculate byte position and bit position
   const uint16_t byteIndex = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + (phyX / 8);
@@ -73,14 +99,21 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  if (fontMap.count(fontId) == 0) {
+  return measureText(fontId, text, style);
+}
+
+int GfxRenderer::measureText(const int fontId, const std::string_view text, const EpdFontFamily::Style style,
+                             const uint8_t flags, const int maxWidth, size_t* fitBytes, uint16_t* prefixWidths) const {
+  const auto font = fontMap.find(fontId);
+  if (font == fontMap.end()) {
     Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    if (fitBytes) {
+      *fitBytes = 0;
+    }
     return 0;
   }
 
-  int w = 0, h = 0;
-  fontMap.at(fontId).getTextDimensions(text, &w, &h, style);
-  return w;
+  return font->second.measureText(text, style, flags, maxWidth, fitBytes, prefixWidths);
 }
 
 void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* text, const bool black,
@@ -121,16 +154,12 @@ void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) con
     if (y2 < y1) {
       std::swap(y1, y2);
     }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
-    }
+    fillSpans(x1, y1, 1, y2 - y1 + 1, state ? Color::Black : Color::White);
   } else if (y1 == y2) {
     if (x2 < x1) {
       std::swap(x1, x2);
     }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
-    }
+    fillSpans(x1, y1, x2 - x1 + 1, 1, state ? Color::Black : Color::White);
   } else {
     // TODO: Implement
     Serial.printf("[%lu] [GFX] Line drawing not supported\n", millis());
@@ -168,17 +197,22 @@ void GfxRenderer::drawArc(const int maxRadius, const int cx, const int cy, const
   const int outerRadiusSq = maxRadius * maxRadius;
   const int innerRadiusSq = innerRadius * innerRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      if (distSq > outerRadiusSq || distSq < innerRadiusSq) {
-        continue;
-      }
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      drawPixel(px, py, state);
+    // The distance grows with dx, so the ring's pixels on this row are one span
+    int firstDx = 0;
+    while (firstDx * firstDx + dy * dy < innerRadiusSq) {
+      firstDx++;
+    }
+    int lastDx = firstDx - 1;
+    while (lastDx < maxRadius && (lastDx + 1) * (lastDx + 1) + dy * dy <= outerRadiusSq) {
+      lastDx++;
     }
+    if (lastDx < firstDx) {
+      continue;
+    }
+    const int spanX = xDir > 0 ? cx + firstDx : cx - lastDx;
+    fillSpans(spanX, cy + yDir * dy, lastDx - firstDx + 1, 1, state ? Color::Black : Color::White);
   }
-};
+}
 
 // Border is inside the rectangle, rounded corners
 void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, const int height, const int lineWidth,
@@ -239,71 +273,96 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
-  }
-}
-
-// NOTE: Those are in critical path, and need to be templated to avoid runtime checks for every pixel.
-// Any branching must be done outside the loops to avoid performance degradation.
-template <>
-void GfxRenderer::drawPixelDither<Color::Clear>(const int x, const int y) const {
-  // Do nothing
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::Black>(const int x, const int y) const {
-  drawPixel(x, y, true);
+  fillSpans(x, y, width, height, state ? Color::Black : Color::White);
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::White>(const int x, const int y) const {
-  drawPixel(x, y, false);
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::LightGray>(const int x, const int y) const {
-  drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
+// 4x4 Bayer matrix, indexed [y % 4][x % 4]: a pixel is black where its entry is below the color's level
+static constexpr uint8_t BAYER_4X4[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+// Black pixels per 4x4 block. The grays keep the patterns they always had: LightGray every other pixel of every other
+// row, DarkGray a checkerboard.
+static int ditherLevel(const Color color) {
+  switch (color) {
+    case Color::Black:
+      return 16;
+    case Color::DarkGray:
+      return 8;
+    case Color::LightGray:
+      return 4;
+    default:
+      return 0;
+  }
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::DarkGray>(const int x, const int y) const {
-  drawPixel(x, y, (x + y) % 2 == 0);  // TODO: maybe find a better pattern?
-}
+// Fills a logical rectangle, every pixel of it black or white as the dithered color has it, one span per frame buffer
+// row: clipped once, whole bytes set with memset and the partial bytes at either end masked. A 4x4 Bayer pattern
+// repeats every 8 pixels along a row and every 4 rows, so the byte written across a row only depends on the row's
+// phase and is worked out for the four phases up front, in logical coordinates so it comes out the same in every
+// orientation.
+void GfxRenderer::fillSpans(const int x, const int y, const int width, const int height, const Color color) const {
+  if (color == Color::Clear || width <= 0 || height <= 0) {
+    return;
+  }
 
-void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
-  if (color == Color::Clear) {
-  } else if (color == Color::Black) {
-    fillRect(x, y, width, height, true);
-  } else if (color == Color::White) {
-    fillRect(x, y, width, height, false);
-  } else if (color == Color::LightGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::LightGray>(fillX, fillY);
-      }
+  int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+  rotateCoordinates(orientation, x, y, &x0, &y0);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &x1, &y1);
+  const int minX = std::max<int>(clipBox.minX, std::min(x0, x1));
+  const int maxX = std::min<int>(clipBox.maxX, std::max(x0, x1));
+  const int minY = std::max<int>(clipBox.minY, std::min(y0, y1));
+  const int maxY = std::min<int>(clipBox.maxY, std::max(y0, y1));
+  if (minX > maxX || minY > maxY) {
+    return;
+  }
+  dirtyRegion.add(minX, maxX, minY);
+  dirtyRegion.add(minX, maxX, maxY);
+
+  // 0 bits are black on the panel
+  const int level = ditherLevel(color);
+  uint8_t phaseBits[4];
+  for (int phase = 0; phase < 4; phase++) {
+    uint8_t bits = 0;
+    for (int i = 0; i < 8; i++) {
+      int logicalX = 0, logicalY = 0;
+      unrotateCoordinates(orientation, i, minY + phase, &logicalX, &logicalY);
+      bits = (bits << 1) | (BAYER_4X4[logicalY & 3][logicalX & 3] >= level);
     }
-  } else if (color == Color::DarkGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::DarkGray>(fillX, fillY);
-      }
+    phaseBits[phase] = bits;
+  }
+
+  const int firstByte = minX >> 3;
+  const int lastByte = maxX >> 3;
+  const uint8_t firstMask = 0xFF >> (minX & 7);
+  const uint8_t lastMask = 0xFF << (7 - (maxX & 7));
+  uint8_t* row = frameBuffer + minY * HalDisplay::DISPLAY_WIDTH_BYTES;
+  for (int rowY = minY; rowY <= maxY; rowY++, row += HalDisplay::DISPLAY_WIDTH_BYTES) {
+    const uint8_t bits = phaseBits[(rowY - minY) & 3];
+    if (firstByte == lastByte) {
+      const uint8_t mask = firstMask & lastMask;
+      row[firstByte] = (row[firstByte] & ~mask) | (bits & mask);
+      continue;
     }
+    row[firstByte] = (row[firstByte] & ~firstMask) | (bits & firstMask);
+    memset(row + firstByte + 1, bits, lastByte - firstByte - 1);
+    row[lastByte] = (row[lastByte] & ~lastMask) | (bits & lastMask);
   }
 }
 
-template <Color color>
-void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir) const {
+void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
+  fillSpans(x, y, width, height, color);
+}
+
+void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+                          const Color color) const {
   const int radiusSq = maxRadius * maxRadius;
+  int lastDx = maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      if (distSq <= radiusSq) {
-        drawPixelDither<color>(px, py);
-      }
+    // The quarter disc narrows as dy grows
+    while (lastDx * lastDx + dy * dy > radiusSq) {
+      lastDx--;
     }
+    const int spanX = xDir > 0 ? cx : cx - lastDx;
+    fillSpans(spanX, cy + yDir * dy, lastDx + 1, 1, color);
   }
 }
 
@@ -336,50 +395,45 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
     fillRectDither(x + width - maxRadius - 1, y + maxRadius + 1, maxRadius + 1, verticalHeight, color);
   }
 
-  auto fillArcTemplated = [this](int maxRadius, int cx, int cy, int xDir, int yDir, Color color) {
-    switch (color) {
-      case Color::Clear:
-        break;
-      case Color::Black:
-        fillArc<Color::Black>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::White:
-        fillArc<Color::White>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::LightGray:
-        fillArc<Color::LightGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::DarkGray:
-        fillArc<Color::DarkGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-    }
-  };
-
   if (roundTopLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+    fillArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
   } else {
     fillRectDither(x, y, maxRadius + 1, maxRadius + 1, color);
   }
 
   if (roundTopRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
   } else {
     fillRectDither(x + width - maxRadius - 1, y, maxRadius + 1, maxRadius + 1, color);
   }
 
   if (roundBottomRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
   } else {
     fillRectDither(x + width - maxRadius - 1, y + height - maxRadius - 1, maxRadius + 1, maxRadius + 1, color);
   }
 
   if (roundBottomLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+    fillArc(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
   } else {
     fillRectDither(x, y + height - maxRadius - 1, maxRadius + 1, maxRadius + 1, color);
   }
 }
 
+// Images go through the display driver, which knows nothing of the clip box. Skip the ones that miss it and note the
+// rest as dirty.
+bool GfxRenderer::clipImage(const int phyX, const int phyY, const int width, const int height) const {
+  if (phyX > clipBox.maxX || phyY > clipBox.maxY || phyX + width - 1 < clipBox.minX ||
+      phyY + height - 1 < clipBox.minY) {
+    return false;
+  }
+  const int x0 = std::max(0, phyX);
+  const int x1 = std::min<int>(HalDisplay::DISPLAY_WIDTH, phyX + width) - 1;
+  dirtyRegion.add(x0, x1, std::max(0, phyY));
+  dirtyRegion.add(x0, x1, std::min<int>(HalDisplay::DISPLAY_HEIGHT, phyY + height) - 1);
+  return true;
+}
+
 void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
   int rotatedX = 0;
   int rotatedY = 0;
@@ -400,10 +454,16 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
       break;
   }
   // TODO: Rotate bits
+  if (!clipImage(rotatedX, rotatedY, width, height)) {
+    return;
+  }
   display.drawImage(bitmap, rotatedX, rotatedY, width, height);
 }
 
 void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
+  if (!clipImage(y, getScreenWidth() - width - x, height, width)) {
+    return;
+  }
   display.drawImage(bitmap, y, getScreenWidth() - width - x, height, width);
 }
 
@@ -416,159 +476,162 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   }
 
   float scale = 1.0f;
-  bool isScaled = false;
-  int cropPixX = std::floor(bitmap.getWidth() * cropX / 2.0f);
-  int cropPixY = std::floor(bitmap.getHeight() * cropY / 2.0f);
-  Serial.printf("[%lu] [GFX] Cropping %dx%d by %dx%d pix, is %s\n", millis(), bitmap.getWidth(), bitmap.getHeight(),
-                cropPixX, cropPixY, bitmap.isTopDown() ? "top-down" : "bottom-up");
-
+  const int cropPixX = std::floor(bitmap.getWidth() * cropX / 2.0f);
+  const int cropPixY = std::floor(bitmap.getHeight() * cropY / 2.0f);
   if (maxWidth > 0 && (1.0f - cropX) * bitmap.getWidth() > maxWidth) {
     scale = static_cast<float>(maxWidth) / static_cast<float>((1.0f - cropX) * bitmap.getWidth());
-    isScaled = true;
   }
   if (maxHeight > 0 && (1.0f - cropY) * bitmap.getHeight() > maxHeight) {
     scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>((1.0f - cropY) * bitmap.getHeight()));
-    isScaled = true;
   }
-  Serial.printf("[%lu] [GFX] Scaling by %f - %s\n", millis(), scale, isScaled ? "scaled" : "not scaled");
-
-  // Calculate output row size (2 bits per pixel, packed into bytes)
-  // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
-  const int outputRowSize = (bitmap.getWidth() + 3) / 4;
-  auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
-  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
-
-  if (!outputRow || !rowBytes) {
-    Serial.printf("[%lu] [GFX] !! Failed to allocate BMP row buffers\n", millis());
-    free(outputRow);
-    free(rowBytes);
-    return;
-  }
-
-  for (int bmpY = 0; bmpY < (bitmap.getHeight() - cropPixY); bmpY++) {
-    // The BMP's (0, 0) is the bottom-left corner (if the height is positive, top-left if negative).
-    // Screen's (0, 0) is the top-left corner.
-    int screenY = -cropPixY + (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY);
-    if (isScaled) {
-      screenY = std::floor(screenY * scale);
-    }
-    screenY += y;  // the offset should not be scaled
-    if (screenY >= getScreenHeight()) {
-      break;
-    }
-
-    if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
-      Serial.printf("[%lu] [GFX] Failed to read row %d from bitmap\n", millis(), bmpY);
-      free(outputRow);
-      free(rowBytes);
-      return;
-    }
-
-    if (screenY < 0) {
-      continue;
-    }
-
-    if (bmpY < cropPixY) {
-      // Skip the row if it's outside the crop area
-      continue;
-    }
-
-    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
-      int screenX = bmpX - cropPixX;
-      if (isScaled) {
-        screenX = std::floor(screenX * scale);
-      }
-      screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
-        continue;
-      }
-
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
-      }
-    }
-  }
-
-  free(outputRow);
-  free(rowBytes);
+  blitBitmap(bitmap, x, y, cropPixX, cropPixY, scale, false);
 }
 
 void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y, const int maxWidth,
                                  const int maxHeight) const {
   float scale = 1.0f;
-  bool isScaled = false;
   if (maxWidth > 0 && bitmap.getWidth() > maxWidth) {
     scale = static_cast<float>(maxWidth) / static_cast<float>(bitmap.getWidth());
-    isScaled = true;
   }
   if (maxHeight > 0 && bitmap.getHeight() > maxHeight) {
     scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>(bitmap.getHeight()));
-    isScaled = true;
   }
+  // 1-bit sources only have black and white, drawn black in every render mode
+  blitBitmap(bitmap, x, y, 0, 0, scale, true);
+}
 
-  // For 1-bit BMP, output is still 2-bit packed (for consistency with readNextRow)
+// Draws the set bits of a packed 1-bit row of pixels starting at logical (x, y) through the glyph line blitter. Rows
+// that run along frame buffer rows go in pieces of 256 pixels, as much as its line masks hold.
+void GfxRenderer::drawRowMask(const uint8_t* mask, const int x, const int y, const int width, const bool state) const {
+  constexpr int maxPiece = 256;
+  switch (orientation) {
+    case Portrait:
+      blitGlyphLines<Portrait, BW, false>(mask, width, 1, x, y, state);
+      break;
+    case PortraitInverted:
+      blitGlyphLines<PortraitInverted, BW, false>(mask, width, 1, x, y, state);
+      break;
+    case LandscapeClockwise:
+      for (int offset = 0; offset < width; offset += maxPiece) {
+        blitGlyphLines<LandscapeClockwise, BW, false>(mask + offset / 8, std::min(maxPiece, width - offset), 1,
+                                                      x + offset, y, state);
+      }
+      break;
+    case LandscapeCounterClockwise:
+      for (int offset = 0; offset < width; offset += maxPiece) {
+        blitGlyphLines<LandscapeCounterClockwise, BW, false>(mask + offset / 8, std::min(maxPiece, width - offset), 1,
+                                                             x + offset, y, state);
+      }
+      break;
+  }
+}
+
+// Draws a bitmap with cropPixX/cropPixY pixels cut off either side, scaled down by scale. 8-bit and deeper images are
+// box filtered down to the destination size by the reader. Others are sampled nearest neighbour in 16.16 fixed point:
+// destination pixel d of a row or column shows the first source pixel s for which floor(s * scale) == d. The source
+// column of every destination column is worked out once; source rows that aren't shown, whether sampled over,
+// cropped away or off screen, are seeked past instead of read and dithered. Each destination row is packed into a bit
+// mask and drawn a frame buffer row at a time.
+void GfxRenderer::blitBitmap(const Bitmap& bitmap, const int x, const int y, const int cropPixX, const int cropPixY,
+                             const float scale, const bool blackOnly) const {
+  int srcWidth = bitmap.getWidth() - 2 * cropPixX;
+  int srcHeight = bitmap.getHeight() - 2 * cropPixY;
+  if (srcWidth <= 0 || srcHeight <= 0) {
+    return;
+  }
+  uint32_t scale16 = std::min<uint32_t>(1u << 16, static_cast<uint32_t>(scale * 65536.0f));
+  const auto toDest = [&scale16](const int src) {
+    return static_cast<int>(static_cast<uint32_t>(src) * scale16 >> 16);
+  };
+  const int destWidth = toDest(srcWidth - 1) + 1;
+  const int destHeight = toDest(srcHeight - 1) + 1;
+
+  // Bit v set when pixels of the 2-bit value v (0 black to 3 white) get drawn, in the state drawn with. The gray
+  // buffers are flagged in reverse: 1 updates a pixel.
+  uint8_t drawnValues = 0b0111;
+  bool state = true;
+  if (!blackOnly && renderMode == GRAYSCALE_MSB) {
+    drawnValues = 0b0110;
+    state = false;
+  } else if (!blackOnly && renderMode == GRAYSCALE_LSB) {
+    drawnValues = 0b0010;
+    state = false;
+  }
+
+  // Calculate output row size (2 bits per pixel, packed into bytes)
+  // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
+  const int maskBytes = (destWidth + 7) / 8;
   auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  auto* mask = static_cast<uint8_t*>(malloc(maskBytes));
+  auto* srcColumns = static_cast<uint16_t*>(malloc(destWidth * sizeof(uint16_t)));
 
-  if (!outputRow || !rowBytes) {
-    Serial.printf("[%lu] [GFX] !! Failed to allocate 1-bit BMP row buffers\n", millis());
+  if (!outputRow || !rowBytes || !mask || !srcColumns) {
+    Serial.printf("[%lu] [GFX] !! Failed to allocate BMP row buffers\n", millis());
     free(outputRow);
     free(rowBytes);
+    free(mask);
+    free(srcColumns);
     return;
   }
 
-  for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
-    // Read rows sequentially using readNextRow
-    if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
-      Serial.printf("[%lu] [GFX] Failed to read row %d from 1-bit bitmap\n", millis(), bmpY);
-      free(outputRow);
-      free(rowBytes);
-      return;
-    }
+  // The box filtered image comes at the destination size, so from here on it is cropped but not scaled
+  int cropLeft = cropPixX;
+  int cropTop = cropPixY;
+  const bool boxFiltered =
+      scale16 < (1u << 16) &&
+      bitmap.setOutputSize(toDest(bitmap.getWidth() - 1) + 1, toDest(bitmap.getHeight() - 1) + 1);
+  if (boxFiltered) {
+    cropLeft = toDest(cropPixX);
+    cropTop = toDest(cropPixY);
+    srcWidth = destWidth;
+    srcHeight = destHeight;
+    scale16 = 1u << 16;
+  }
+  const int imageHeight = bitmap.getOutputHeight();
 
-    // Calculate screen Y based on whether BMP is top-down or bottom-up
-    const int bmpYOffset = bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY;
-    int screenY = y + (isScaled ? static_cast<int>(std::floor(bmpYOffset * scale)) : bmpYOffset);
-    if (screenY >= getScreenHeight()) {
-      continue;  // Continue reading to keep row counter in sync
-    }
-    if (screenY < 0) {
+  // Walking backwards leaves the first source column of each destination column
+  for (int src = srcWidth - 1; src >= 0; src--) {
+    srcColumns[toDest(src)] = src + cropLeft;
+  }
+
+  const int screenHeight = getScreenHeight();
+  int skippedRows = 0;
+  for (int bmpY = 0; bmpY < imageHeight; bmpY++) {
+    // The BMP's (0, 0) is the bottom-left corner (if the height is positive, top-left if negative).
+    // Screen's (0, 0) is the top-left corner.
+    const int srcY = (bitmap.isTopDown() ? bmpY : imageHeight - 1 - bmpY) - cropTop;
+    const int destY = y + toDest(srcY);
+    if (srcY < 0 || srcY >= srcHeight || (srcY > 0 && toDest(srcY - 1) == toDest(srcY)) || destY < 0 ||
+        destY >= screenHeight) {
+      skippedRows++;
       continue;
     }
 
-    for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
-      int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
-        continue;
-      }
-
-      // Get 2-bit value (result of readNextRow quantization)
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+    if (bitmap.skipRows(skippedRows) != BmpReaderError::Ok ||
+        bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
+      Serial.printf("[%lu] [GFX] Failed to read row %d from bitmap\n", millis(), bmpY);
+      break;
+    }
+    skippedRows = 0;
 
-      // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
-      // val < 3 means black pixel (draw it)
-      if (val < 3) {
-        drawPixel(screenX, screenY, true);
-      }
-      // White pixels (val == 3) are not drawn (leave background)
+    memset(mask, 0, maskBytes);
+    for (int destX = 0; destX < destWidth; destX++) {
+      const int srcX = srcColumns[destX];
+      const uint8_t val = outputRow[srcX >> 2] >> (6 - (srcX & 3) * 2) & 0x3;
+      mask[destX >> 3] |= ((drawnValues >> val) & 1) << (7 - (destX & 7));
     }
+    drawRowMask(mask, x, destY, destWidth, state);
   }
 
+  if (boxFiltered) {
+    bitmap.setOutputSize(bitmap.getWidth(), bitmap.getHeight());
+  }
   free(outputRow);
   free(rowBytes);
+  free(mask);
+  free(srcColumns);
 }
 
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
@@ -630,8 +693,8 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       if (endX >= getScreenWidth()) endX = getScreenWidth() - 1;
 
       // Draw horizontal line
-      for (int x = startX; x <= endX; x++) {
-        drawPixel(x, scanY, state);
+      if (startX <= endX) {
+        fillSpans(startX, scanY, endX - startX + 1, 1, state ? Color::Black : Color::White);
       }
     }
   }
@@ -644,10 +707,30 @@ static unsigned long start_ms = 0;
 
 void GfxRenderer::clearScreen(const uint8_t color) const {
   start_ms = millis();
+  if (clipBox.empty()) {
+    return;
+  }
+  dirtyRegion.add(clipBox);
+  if (clipBox.minX != 0 || clipBox.minY != 0 || clipBox.maxX != HalDisplay::DISPLAY_WIDTH - 1 ||
+      clipBox.maxY != HalDisplay::DISPLAY_HEIGHT - 1) {
+    // The clip box is byte aligned, see setClipRect()
+    const int firstByte = clipBox.minX / 8;
+    const int byteCount = clipBox.maxX / 8 - firstByte + 1;
+    for (int y = clipBox.minY; y <= clipBox.maxY; y++) {
+      memset(frameBuffer + y * HalDisplay::DISPLAY_WIDTH_BYTES + firstByte, color, byteCount);
+    }
+    return;
+  }
+  grayCoverage = PanelBox();
+  if (frameBuffer != display.getFrameBuffer()) {
+    memset(frameBuffer, color, HalDisplay::BUFFER_SIZE);
+    return;
+  }
   display.clearScreen(color);
 }
 
 void GfxRenderer::invertScreen() const {
+  dirtyRegion = PanelBox::panel();
   for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
     frameBuffer[i] = ~frameBuffer[i];
   }
@@ -657,25 +740,92 @@ void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const
   auto elapsed = millis() - start_ms;
   Serial.printf("[%lu] [GFX] Time = %lu ms from clearScreen to displayBuffer\n", millis(), elapsed);
   display.displayBuffer(refreshMode, fadingFix);
+  frameDiff.record(display.getFrameBuffer(), refreshMode);
+  dirtyRegion = PanelBox();
+}
+
+FrameDiff::Update GfxRenderer::displayChanges(const int refreshPages) const {
+  const auto update = frameDiff.plan(display.getFrameBuffer(), refreshPages);
+  const auto& stats = frameDiff.getStats();
+  static constexpr const char* UPDATE_NAMES[] = {"skip", "window", "fast", "half", "full"};
+  Serial.printf("[%lu] [GFX] Frame diff: %u tiles, ~%lu px flipped, ~%lu to white, pressure %lu/%lu -> %s\n", millis(),
+                stats.changedTiles, static_cast<unsigned long>(stats.flippedPixels),
+                static_cast<unsigned long>(stats.blackToWhitePixels), static_cast<unsigned long>(stats.ghostingPressure),
+                static_cast<unsigned long>(stats.whitePressure), UPDATE_NAMES[update]);
+
+  switch (update) {
+    case FrameDiff::SKIP:
+      return update;
+    case FrameDiff::WINDOW:
+      display.displayWindow(stats.minX, stats.minY, stats.maxX - stats.minX + 1, stats.maxY - stats.minY + 1);
+      break;
+    case FrameDiff::FAST:
+      display.displayBuffer(HalDisplay::FAST_REFRESH, fadingFix);
+      break;
+    case FrameDiff::HALF:
+      display.displayBuffer(HalDisplay::HALF_REFRESH, fadingFix);
+      break;
+    case FrameDiff::FULL:
+      display.displayBuffer(HalDisplay::FULL_REFRESH, fadingFix);
+      break;
+  }
+  dirtyRegion = PanelBox();
+  return update;
+}
+
+void GfxRenderer::displayDirtyRegion() const {
+  if (dirtyRegion.empty()) {
+    return;
+  }
+
+  // The controller addresses the panel in whole bytes across
+  const int x = dirtyRegion.minX & ~7;
+  const int y = dirtyRegion.minY;
+  const int width = (dirtyRegion.maxX | 7) + 1 - x;
+  const int height = dirtyRegion.maxY - y + 1;
+  // Past half the panel the window saves little and a full update refreshes more evenly
+  if (width * height > HalDisplay::DISPLAY_WIDTH * HalDisplay::DISPLAY_HEIGHT / 2) {
+    displayBuffer();
+    return;
+  }
+
+  Serial.printf("[%lu] [GFX] Window %dx%d at (%d, %d), %d bytes\n", millis(), width, height, x, y, width / 8 * height);
+  display.displayWindow(x, y, width, height);
+  frameDiff.record(display.getFrameBuffer(), HalDisplay::FAST_REFRESH);
+  dirtyRegion = PanelBox();
+}
+
+void GfxRenderer::setClipRect(const int x, const int y, const int width, const int height) {
+  int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+  rotateCoordinates(orientation, x, y, &x0, &y0);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &x1, &y1);
+
+  // Widened to whole bytes so clearScreen() can clear it a byte at a time
+  const int minX = std::max(0, std::min(x0, x1)) & ~7;
+  const int maxX = std::min<int>(HalDisplay::DISPLAY_WIDTH - 1, std::max(x0, x1) | 7);
+  const int minY = std::max(0, std::min(y0, y1));
+  const int maxY = std::min<int>(HalDisplay::DISPLAY_HEIGHT - 1, std::max(y0, y1));
+  clipBox = PanelBox();
+  if (width > 0 && height > 0 && minX <= maxX && minY <= maxY) {
+    clipBox.add(minX, maxX, minY);
+    clipBox.add(minX, maxX, maxY);
+  }
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
                                        const EpdFontFamily::Style style) const {
   if (!text || maxWidth <= 0) return "";
 
-  std::string item = text;
-  const char* ellipsis = "...";
-  int textWidth = getTextWidth(fontId, item.c_str(), style);
-  if (textWidth <= maxWidth) {
+  const std::string_view item = text;
+  if (measureText(fontId, item, style, 0, maxWidth) <= maxWidth) {
     // Text fits, return as is
-    return item;
+    return std::string(item);
   }
 
-  while (!item.empty() && getTextWidth(fontId, (item + ellipsis).c_str(), style) >= maxWidth) {
-    utf8RemoveLastChar(item);
-  }
-
-  return item.empty() ? ellipsis : item + ellipsis;
+  // Longest prefix that stays narrower than maxWidth with the ellipsis, found in one pass
+  size_t fitBytes = 0;
+  measureText(fontId, item, style, EpdFont::MEASURE_APPEND_ELLIPSIS, maxWidth - 1, &fitBytes);
+  return std::string(item.substr(0, fitBytes)) + "...";
 }
 
 // Note: Internal driver treats screen in command orientation; this library exposes a logical orientation
@@ -791,13 +941,12 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     }
 
     const int is2Bit = font.getData(style)->is2Bit;
-    const uint32_t offset = glyph->dataOffset;
     const uint8_t width = glyph->width;
     const uint8_t height = glyph->height;
     const int left = glyph->left;
     const int top = glyph->top;
 
-    const uint8_t* bitmap = &font.getData(style)->bitmap[offset];
+    const uint8_t* bitmap = font.getGlyphBitmap(glyph, style, &glyphCache);
 
     if (bitmap != nullptr) {
       for (int glyphY = 0; glyphY < height; glyphY++) {
@@ -815,7 +964,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
             const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
             const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
 
-            if (renderMode == BW && bmpVal < 3) {
+            if ((renderMode == BW || renderMode == BW_AND_GRAYSCALE) && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
             } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
               drawPixel(screenX, screenY, false);
@@ -852,6 +1001,115 @@ void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuff
 
 void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
 
+bool GfxRenderer::beginOffscreen() {
+  if (!offscreenBuffer) {
+    offscreenBuffer = static_cast<uint8_t*>(malloc(HalDisplay::BUFFER_SIZE));
+    if (!offscreenBuffer) {
+      Serial.printf("[%lu] [GFX] Not enough contiguous memory for off-screen canvas\n", millis());
+      return false;
+    }
+    if (ESP.getFreeHeap() < OFFSCREEN_HEAP_RESERVE) {
+      Serial.printf("[%lu] [GFX] Off-screen canvas would leave only %lu bytes free, not using it\n", millis(),
+                    static_cast<unsigned long>(ESP.getFreeHeap()));
+      releaseOffscreen();
+      return false;
+    }
+  }
+
+  offscreenTag = 0;
+  frameBuffer = offscreenBuffer;
+  panelGrayCoverage = grayCoverage;
+  grayCoverage = PanelBox();
+  panelDirtyRegion = dirtyRegion;
+  return true;
+}
+
+void GfxRenderer::endOffscreen(const uint32_t tag) {
+  frameBuffer = display.getFrameBuffer();
+  offscreenTag = tag;
+  offscreenGrayCoverage = grayCoverage;
+  grayCoverage = panelGrayCoverage;
+  dirtyRegion = panelDirtyRegion;
+  if (grayscalePlanesOffscreen) {
+    grayscalePlanesTag = tag;
+    grayscalePlanesOffscreen = false;
+  }
+}
+
+bool GfxRenderer::presentOffscreen(const uint32_t tag) {
+  if (!offscreenBuffer || offscreenTag == 0 || offscreenTag != tag) {
+    return false;
+  }
+  start_ms = millis();
+  memcpy(frameBuffer, offscreenBuffer, HalDisplay::BUFFER_SIZE);
+  grayCoverage = offscreenGrayCoverage;
+  dirtyRegion = PanelBox::panel();
+  offscreenTag = 0;
+  return true;
+}
+
+void GfxRenderer::releaseOffscreen() {
+  if (offscreenBuffer) {
+    free(offscreenBuffer);
+    offscreenBuffer = nullptr;
+  }
+  offscreenTag = 0;
+}
+
+bool GfxRenderer::beginGrayscalePlanes() {
+  if (!grayscaleLsbPlane) {
+    grayscaleLsbPlane = static_cast<uint8_t*>(malloc(HalDisplay::BUFFER_SIZE));
+    grayscaleMsbPlane = static_cast<uint8_t*>(malloc(HalDisplay::BUFFER_SIZE));
+    // Fresh from the heap, so all of it needs clearing
+    grayscalePlanesDirty = PanelBox();
+    grayscalePlanesDirty.add(0, HalDisplay::DISPLAY_WIDTH - 1, 0);
+    grayscalePlanesDirty.add(0, HalDisplay::DISPLAY_WIDTH - 1, HalDisplay::DISPLAY_HEIGHT - 1);
+    if (!grayscaleLsbPlane || !grayscaleMsbPlane) {
+      Serial.printf("[%lu] [GFX] Not enough contiguous memory for grayscale planes\n", millis());
+      releaseGrayscalePlanes();
+      return false;
+    }
+    if (ESP.getFreeHeap() < GRAYSCALE_PLANES_HEAP_RESERVE) {
+      Serial.printf("[%lu] [GFX] Grayscale planes would leave only %lu bytes free, not using them\n", millis(),
+                    static_cast<unsigned long>(ESP.getFreeHeap()));
+      releaseGrayscalePlanes();
+      return false;
+    }
+  }
+
+  if (!grayscalePlanesDirty.empty()) {
+    const int firstByte = grayscalePlanesDirty.minX / 8;
+    const int byteCount = grayscalePlanesDirty.maxX / 8 - firstByte + 1;
+    for (int y = grayscalePlanesDirty.minY; y <= grayscalePlanesDirty.maxY; y++) {
+      const size_t offset = y * HalDisplay::DISPLAY_WIDTH_BYTES + firstByte;
+      memset(grayscaleLsbPlane + offset, 0x00, byteCount);
+      memset(grayscaleMsbPlane + offset, 0x00, byteCount);
+    }
+    grayscalePlanesDirty = PanelBox();
+  }
+  // Drawn for whatever the frame buffer is about to hold; only a page drawn off-screen gets to keep them
+  grayscalePlanesTag = 0;
+  grayscalePlanesOffscreen = frameBuffer != display.getFrameBuffer();
+  renderMode = BW_AND_GRAYSCALE;
+  return true;
+}
+
+void GfxRenderer::endGrayscalePlanes() { renderMode = BW; }
+
+void GfxRenderer::copyGrayscalePlanes() const {
+  if (grayscaleLsbPlane && grayscaleMsbPlane) {
+    display.copyGrayscaleBuffers(grayscaleLsbPlane, grayscaleMsbPlane);
+  }
+}
+
+void GfxRenderer::releaseGrayscalePlanes() {
+  free(grayscaleLsbPlane);
+  free(grayscaleMsbPlane);
+  grayscaleLsbPlane = nullptr;
+  grayscaleMsbPlane = nullptr;
+  grayscalePlanesTag = 0;
+}
+
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
     if (bwBufferChunk) {
@@ -912,8 +1170,10 @@ void GfxRenderer::restoreBwBuffer() {
     }
   }
 
+  // Without the BW frame the controller keeps the gray planes, so the next frame can't be sent as a diff
   if (missingChunks) {
     freeBwBufferChunks();
+    frameDiff.invalidate();
     return;
   }
 
@@ -922,6 +1182,7 @@ void GfxRenderer::restoreBwBuffer() {
     if (!bwBufferChunks[i]) {
       Serial.printf("[%lu] [GFX] !! BW buffer chunks not stored - this is likely a bug\n", millis());
       freeBwBufferChunks();
+      frameDiff.invalidate();
       return;
     }
 
@@ -945,6 +1206,198 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   }
 }
 
+// Whether the glyph pixel at pos gets drawn in the given render mode
+template <GfxRenderer::RenderMode mode, bool is2Bit>
+static inline uint8_t glyphPixelSet(const uint8_t* bitmap, const int pos) {
+  if (!is2Bit) {
+    return (bitmap[pos >> 3] >> (7 - (pos & 7))) & 1;
+  }
+  // Raw font values: 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+  const uint8_t raw = bitmap[pos >> 2] >> ((3 - (pos & 3)) * 2);
+  switch (mode) {
+    case GfxRenderer::BW:
+    case GfxRenderer::BW_AND_GRAYSCALE:
+      // Anything but white, the grays get painted black too
+      return (raw | raw >> 1) & 1;
+    case GfxRenderer::GRAYSCALE_MSB:
+      // Light or dark gray
+      return (raw ^ raw >> 1) & 1;
+    case GfxRenderer::GRAYSCALE_LSB:
+      // Dark gray
+      return raw >> 1 & ~raw & 1;
+  }
+  return 0;
+}
+
+template <GfxRenderer::Orientation glyphOrientation>
+void GfxRenderer::blitGlyph(const uint8_t* bitmap, const bool is2Bit, const int width, const int height,
+                            const int left, const int top, const bool state) const {
+  if (!is2Bit) {
+    blitGlyphLines<glyphOrientation, BW, false>(bitmap, width, height, left, top, state);
+    return;
+  }
+  // The gray buffers are flagged in reverse: 0 leaves a pixel alone, 1 updates it
+  switch (renderMode) {
+    case BW:
+      blitGlyphLines<glyphOrientation, BW, true>(bitmap, width, height, left, top, state);
+      break;
+    case GRAYSCALE_MSB:
+      blitGlyphLines<glyphOrientation, GRAYSCALE_MSB, true>(bitmap, width, height, left, top, false);
+      break;
+    case GRAYSCALE_LSB:
+      blitGlyphLines<glyphOrientation, GRAYSCALE_LSB, true>(bitmap, width, height, left, top, false);
+      break;
+    case BW_AND_GRAYSCALE:
+      blitGlyphLines<glyphOrientation, BW_AND_GRAYSCALE, true>(bitmap, width, height, left, top, state);
+      break;
+  }
+}
+
+// ORs (clearBits false) or clears (clearBits true) a line mask into a frame buffer row starting shift bits into it
+static inline void applyLineMask(uint8_t* row, const uint8_t* mask, const int maskBytes, const int shift,
+                                 const bool clearBits) {
+  uint8_t carry = 0;
+  for (int b = 0; b < maskBytes; b++) {
+    const uint8_t out = carry | (mask[b] >> shift);
+    carry = static_cast<uint8_t>(mask[b] << (8 - shift));
+    if (out) {
+      row[b] = clearBits ? row[b] & ~out : row[b] | out;
+    }
+  }
+  if (carry) {
+    row[maskBytes] = clearBits ? row[maskBytes] & ~carry : row[maskBytes] | carry;
+  }
+}
+
+// Draws a glyph one physical frame buffer row at a time. In landscape each row is a glyph row, in portrait a glyph
+// column; either way it is a run of pixels stepping through the packed glyph bitmap at a fixed stride, which is
+// gathered into a bit mask and applied a byte at a time. Clipping against the panel happens once, up front.
+// BW_AND_GRAYSCALE decodes each pixel once into three masks, for the frame buffer and both gray planes.
+template <GfxRenderer::Orientation glyphOrientation, GfxRenderer::RenderMode mode, bool is2Bit>
+void GfxRenderer::blitGlyphLines(const uint8_t* bitmap, const int width, const int height, const int left,
+                                 const int top, const bool state) const {
+  constexpr bool landscape = glyphOrientation == LandscapeClockwise || glyphOrientation == LandscapeCounterClockwise;
+  const int lineCount = landscape ? height : width;
+  const int lineLength = landscape ? width : height;
+
+  // Line l lands on physical row firstRow + rowStep * l, starting at physical column firstColumn. Pixel i of it is
+  // glyph pixel lineBase(l) + pixelStep * i.
+  int firstRow, rowStep, firstColumn, pixelStep;
+  switch (glyphOrientation) {
+    case Portrait:
+      firstRow = HalDisplay::DISPLAY_HEIGHT - 1 - left;
+      rowStep = -1;
+      firstColumn = top;
+      pixelStep = width;
+      break;
+    case LandscapeClockwise:
+      firstRow = HalDisplay::DISPLAY_HEIGHT - 1 - top;
+      rowStep = -1;
+      firstColumn = HalDisplay::DISPLAY_WIDTH - left - width;
+      pixelStep = -1;
+      break;
+    case PortraitInverted:
+      firstRow = left;
+      rowStep = 1;
+      firstColumn = HalDisplay::DISPLAY_WIDTH - top - height;
+      pixelStep = -width;
+      break;
+    case LandscapeCounterClockwise:
+    default:
+      firstRow = top;
+      rowStep = 1;
+      firstColumn = left;
+      pixelStep = 1;
+      break;
+  }
+  const auto lineBase = [width, height](const int line) {
+    switch (glyphOrientation) {
+      case Portrait:
+        return line;
+      case LandscapeClockwise:
+        return line * width + width - 1;
+      case PortraitInverted:
+        return (height - 1) * width + line;
+      case LandscapeCounterClockwise:
+      default:
+        return line * width;
+    }
+  };
+
+  // Clip lines to the clip box's rows and pixels to its columns
+  int firstLine, endLine;
+  if (rowStep > 0) {
+    firstLine = std::max(0, clipBox.minY - firstRow);
+    endLine = std::min(lineCount, clipBox.maxY + 1 - firstRow);
+  } else {
+    firstLine = std::max(0, firstRow - clipBox.maxY);
+    endLine = std::min(lineCount, firstRow - clipBox.minY + 1);
+  }
+  const int firstPixel = std::max(0, clipBox.minX - firstColumn);
+  const int endPixel = std::min(lineLength, clipBox.maxX + 1 - firstColumn);
+  if (firstLine >= endLine || firstPixel >= endPixel) {
+    return;
+  }
+
+  const int pixelCount = endPixel - firstPixel;
+  const int maskBytes = (pixelCount + 7) / 8;
+  const int startColumn = firstColumn + firstPixel;
+  const int shift = startColumn & 7;
+  dirtyRegion.add(startColumn, startColumn + pixelCount - 1, firstRow + rowStep * firstLine);
+  dirtyRegion.add(startColumn, startColumn + pixelCount - 1, firstRow + rowStep * (endLine - 1));
+  // Glyph dimensions are 8 bit, so a line never needs more than 256 bits
+  constexpr int planeCount = mode == BW_AND_GRAYSCALE ? 3 : 1;
+  // The BW render also notes where the gray pixels are, so the gray passes can be skipped when there are none
+  constexpr bool tracksGray = is2Bit && (mode == BW || mode == BW_AND_GRAYSCALE);
+  uint8_t mask[planeCount][32];
+
+  for (int line = firstLine; line < endLine; line++) {
+    int pos = lineBase(line) + pixelStep * firstPixel;
+    uint8_t any = 0;
+    uint8_t gray = 0;
+    for (int b = 0; b < maskBytes; b++) {
+      const int count = std::min(8, pixelCount - b * 8);
+      uint8_t bits[planeCount] = {};
+      for (int i = 0; i < count; i++, pos += pixelStep) {
+        if constexpr (tracksGray) {
+          const uint8_t raw = bitmap[pos >> 2] >> ((3 - (pos & 3)) * 2);
+          bits[0] = (bits[0] << 1) | ((raw | raw >> 1) & 1);
+          gray |= raw ^ raw >> 1;
+          if constexpr (planeCount == 3) {
+            bits[1] = (bits[1] << 1) | ((raw ^ raw >> 1) & 1);
+            bits[2] = (bits[2] << 1) | (raw >> 1 & ~raw & 1);
+          }
+        } else {
+          bits[0] = (bits[0] << 1) | glyphPixelSet<mode, is2Bit>(bitmap, pos);
+        }
+      }
+      for (int plane = 0; plane < planeCount; plane++) {
+        mask[plane][b] = bits[plane] << (8 - count);
+      }
+      any |= mask[0][b];
+    }
+    // Gray pixels are never white, so an empty first mask means no gray either
+    if (!any) {
+      continue;
+    }
+
+    // 0 bits are black on the panel
+    const int row = firstRow + rowStep * line;
+    const int rowOffset = row * HalDisplay::DISPLAY_WIDTH_BYTES + (startColumn >> 3);
+    applyLineMask(frameBuffer + rowOffset, mask[0], maskBytes, shift, state);
+    if constexpr (tracksGray) {
+      if (gray & 1) {
+        grayCoverage.add(startColumn, startColumn + pixelCount - 1, row);
+        if constexpr (planeCount == 3) {
+          grayscalePlanesDirty.add(startColumn, startColumn + pixelCount - 1, row);
+          applyLineMask(grayscaleMsbPlane + rowOffset, mask[1], maskBytes, shift, false);
+          applyLineMask(grayscaleLsbPlane + rowOffset, mask[2], maskBytes, shift, false);
+        }
+      }
+    }
+  }
+}
+
 void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp, int* x, const int* y,
                              const bool pixelState, const EpdFontFamily::Style style) const {
   const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
@@ -959,49 +1412,30 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
   }
 
   const int is2Bit = fontFamily.getData(style)->is2Bit;
-  const uint32_t offset = glyph->dataOffset;
   const uint8_t width = glyph->width;
   const uint8_t height = glyph->height;
   const int left = glyph->left;
 
-  const uint8_t* bitmap = nullptr;
-  bitmap = &fontFamily.getData(style)->bitmap[offset];
+  // Fonts read from a file or compressed may have to fetch or inflate the bitmap, so empty glyphs such as spaces
+  // don't ask for one
+  const uint8_t* bitmap = width > 0 && height > 0 ? fontFamily.getGlyphBitmap(glyph, style, &glyphCache) : nullptr;
 
   if (bitmap != nullptr) {
-    for (int glyphY = 0; glyphY < height; glyphY++) {
-      const int screenY = *y - glyph->top + glyphY;
-      for (int glyphX = 0; glyphX < width; glyphX++) {
-        const int pixelPosition = glyphY * width + glyphX;
-        const int screenX = *x + left + glyphX;
-
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            drawPixel(screenX, screenY, false);
-          }
-        } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
-
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
-          }
-        }
-      }
+    const int glyphX = *x + left;
+    const int glyphY = *y - glyph->top;
+    switch (orientation) {
+      case Portrait:
+        blitGlyph<Portrait>(bitmap, is2Bit, width, height, glyphX, glyphY, pixelState);
+        break;
+      case LandscapeClockwise:
+        blitGlyph<LandscapeClockwise>(bitmap, is2Bit, width, height, glyphX, glyphY, pixelState);
+        break;
+      case PortraitInverted:
+        blitGlyph<PortraitInverted>(bitmap, is2Bit, width, height, glyphX, glyphY, pixelState);
+        break;
+      case LandscapeCounterClockwise:
+        blitGlyph<LandscapeCounterClockwise>(bitmap, is2Bit, width, height, glyphX, glyphY, pixelState);
+        break;
     }
   }
 
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <EpdFontFamily.h>
+#include <EpdGlyphCache.h>
 #include <HalDisplay.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 
 #include "Bitmap.h"
+#include "FrameDiff.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -13,7 +17,9 @@ enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray =
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // BW_AND_GRAYSCALE: 2-bit glyphs write the BW frame buffer and both gray planes in one pass, see
+  // beginGrayscalePlanes(). Everything else draws as in BW.
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, BW_AND_GRAYSCALE };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -28,6 +34,35 @@ class GfxRenderer {
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  // The reserves below are only checked when a buffer is allocated; callers about to need more heap than ordinary page
+  // work, such as a section build, release the buffers first.
+  // Free heap the off-screen canvas must leave behind, enough for storeBwBuffer() plus ordinary page work
+  static constexpr uint32_t OFFSCREEN_HEAP_RESERVE = HalDisplay::BUFFER_SIZE + 16 * 1024;
+  // Free heap the grayscale planes must leave behind for laying out and loading pages
+  static constexpr uint32_t GRAYSCALE_PLANES_HEAP_RESERVE = 32 * 1024;
+
+  // Rectangle in panel coordinates, inclusive; empty while minX > maxX
+  struct PanelBox {
+    int16_t minX = INT16_MAX;
+    int16_t minY = INT16_MAX;
+    int16_t maxX = -1;
+    int16_t maxY = -1;
+
+    bool empty() const { return minX > maxX; }
+    void add(const int x0, const int x1, const int y) {
+      minX = std::min<int16_t>(minX, x0);
+      maxX = std::max<int16_t>(maxX, x1);
+      minY = std::min<int16_t>(minY, y);
+      maxY = std::max<int16_t>(maxY, y);
+    }
+    void add(const PanelBox& other) {
+      if (!other.empty()) {
+        add(other.minX, other.maxX, other.minY);
+        add(other.minX, other.maxX, other.maxY);
+      }
+    }
+    static PanelBox panel() { return {0, 0, HalDisplay::DISPLAY_WIDTH - 1, HalDisplay::DISPLAY_HEIGHT - 1}; }
+  };
 
   HalDisplay& display;
   RenderMode renderMode;
@@ -35,19 +70,52 @@ class GfxRenderer {
   bool fadingFix;
   uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  uint8_t* offscreenBuffer = nullptr;
+  uint32_t offscreenTag = 0;
+  uint8_t* grayscaleLsbPlane = nullptr;
+  uint8_t* grayscaleMsbPlane = nullptr;
+  // Off-screen canvas tag the planes were drawn with, 0 if they belong to the panel buffer
+  uint32_t grayscalePlanesTag = 0;
+  bool grayscalePlanesOffscreen = false;
+  // Where 2-bit glyphs left gray pixels in the buffer being drawn, and in the canvas and panel buffer while the other
+  // one is being drawn
+  mutable PanelBox grayCoverage;
+  PanelBox offscreenGrayCoverage;
+  PanelBox panelGrayCoverage;
+  // Part of the gray planes that isn't blank, the only part beginGrayscalePlanes() has to clear
+  mutable PanelBox grayscalePlanesDirty;
+  // Part of the panel buffer drawn to since it was last sent to the panel, and the same for the panel buffer while
+  // the canvas is being drawn
+  mutable PanelBox dirtyRegion;
+  PanelBox panelDirtyRegion;
+  // Drawing outside this box is discarded, see setClipRect()
+  PanelBox clipBox = PanelBox::panel();
+  // What the panel shows, kept up to date by everything that sends the frame buffer
+  mutable FrameDiff frameDiff;
   std::map<int, EpdFontFamily> fontMap;
+  // Bitmaps of glyphs from compressed fonts, inflated as they are drawn
+  mutable EpdGlyphCache glyphCache;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
+  template <Orientation glyphOrientation>
+  void blitGlyph(const uint8_t* bitmap, bool is2Bit, int width, int height, int left, int top, bool state) const;
+  template <Orientation glyphOrientation, RenderMode mode, bool is2Bit>
+  void blitGlyphLines(const uint8_t* bitmap, int width, int height, int left, int top, bool state) const;
   void freeBwBufferChunks();
-  template <Color color>
-  void drawPixelDither(int x, int y) const;
-  template <Color color>
-  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
+  bool clipImage(int phyX, int phyY, int width, int height) const;
+  void fillSpans(int x, int y, int width, int height, Color color) const;
+  void drawRowMask(const uint8_t* mask, int x, int y, int width, bool state) const;
+  void blitBitmap(const Bitmap& bitmap, int x, int y, int cropPixX, int cropPixY, float scale, bool blackOnly) const;
+  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir, Color color) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
       : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    releaseOffscreen();
+    releaseGrayscalePlanes();
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -69,8 +137,19 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
+  // Sends the frame buffer as far as it differs from what the panel shows: not at all when nothing changed, as a
+  // window when little did, otherwise with a fast refresh, or a half or full one once enough pixels have flipped since
+  // the last, see FrameDiff. refreshPages is the number of dense page turns a half refresh is spaced by.
+  FrameDiff::Update displayChanges(int refreshPages) const;
+  const FrameDiff::Stats& getFrameStats() const { return frameDiff.getStats(); }
+  // Windowed update: sends and refreshes only the part of the panel drawn to since the last displayBuffer() or
+  // displayDirtyRegion(). Falls back to displayBuffer() when that part is most of the panel.
+  void displayDirtyRegion() const;
+  // Drawing calls, clearScreen() included, only touch the given logical rectangle until clearClipRect(). Lets a
+  // screen redraw just what changed, e.g. the rows a list cursor moved between, and send only that with
+  // displayDirtyRegion(). drawImage() and drawIcon() are skipped outside the rectangle but drawn whole inside it.
+  void setClipRect(int x, int y, int width, int height);
+  void clearClipRect() { clipBox = PanelBox::panel(); }
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
@@ -99,6 +178,11 @@ class GfxRenderer {
 
   // Text
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  // getTextWidth() of text that need not be NUL-terminated, with EpdFont::MeasureFlags, stopping past maxWidth and
+  // giving the length that fits and every prefix's width in the same pass; see EpdFont::measureText()
+  int measureText(int fontId, std::string_view text, EpdFontFamily::Style style = EpdFontFamily::REGULAR,
+                  uint8_t flags = 0, int maxWidth = INT_MAX, size_t* fitBytes = nullptr,
+                  uint16_t* prefixWidths = nullptr) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
@@ -114,16 +198,39 @@ class GfxRenderer {
   void drawTextRotated90CW(int fontId, int x, int y, const char* text, bool black = true,
                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getTextHeight(int fontId) const;
+  const EpdGlyphCache& getGlyphCache() const { return glyphCache; }
+  void releaseGlyphCache() { glyphCache.clear(); }  // Free the inflated glyphs, e.g. when leaving the reader
 
   // Grayscale functions
   void setRenderMode(const RenderMode mode) { this->renderMode = mode; }
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
+  // Grayscale planes: LSB and MSB planes kept allocated between pages, so anti-aliased text is drawn once per page
+  // in BW_AND_GRAYSCALE instead of once per plane with the BW buffer stashed in between. Planes begun while drawing
+  // off-screen stay with that page; grayscalePlanesHold() tells whether a presented page's planes are still intact.
+  bool beginGrayscalePlanes();  // Clears the planes and enters BW_AND_GRAYSCALE; false if they can't be allocated
+  void endGrayscalePlanes();
+  bool grayscalePlanesHold(const uint32_t tag) const { return tag != 0 && grayscalePlanesTag == tag; }
+  void copyGrayscalePlanes() const;
+  void releaseGrayscalePlanes();
+  // Whether 2-bit glyphs drawn in BW or BW_AND_GRAYSCALE since the last clearScreen() produced any gray pixels. When
+  // they didn't, the gray passes and the gray waveform have nothing to show.
+  bool hasGrayCoverage() const { return !grayCoverage.empty(); }
   bool storeBwBuffer();    // Returns true if buffer was stored successfully
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
 
+  // Off-screen canvas: a second frame buffer, allocated on first use if the heap can spare it, that a page can be
+  // drawn into ahead of time. Between beginOffscreen() and endOffscreen() every drawing call except drawImage() and
+  // drawIcon() lands in the canvas instead of the panel buffer. The tag names what was drawn so presentOffscreen()
+  // only copies the canvas to the panel buffer when it holds the page the caller is about to show; tag 0 means empty.
+  bool beginOffscreen();  // Returns false if the canvas can't be allocated
+  void endOffscreen(uint32_t tag);
+  bool presentOffscreen(uint32_t tag);
+  void discardOffscreen() { offscreenTag = 0; }
+  void releaseOffscreen();  // Free the canvas, e.g. when leaving the reader
+
   // Low level functions
   uint8_t* getFrameBuffer() const;
   static size_t getBufferSize();
@@ -1,5 +1,7 @@
 #include "Utf8.h"
 
+#include <algorithm>
+
 int utf8CodepointLen(const unsigned char c) {
   if (c < 0x80) return 1;          // 0xxxxxxx
   if ((c >> 5) == 0x6) return 2;   // 110xxxxx
@@ -30,6 +32,28 @@ uint32_t utf8NextCodepoint(const unsigned char** string) {
   return cp;
 }
 
+uint32_t utf8NextCodepoint(const unsigned char** string, const unsigned char* end) {
+  if (*string >= end || **string == 0) {
+    return 0;
+  }
+
+  const int bytes = std::min<int>(utf8CodepointLen(**string), end - *string);
+  const uint8_t* chr = *string;
+  *string += bytes;
+
+  if (bytes == 1) {
+    return chr[0];
+  }
+
+  uint32_t cp = chr[0] & ((1 << (7 - utf8CodepointLen(chr[0]))) - 1);  // mask header bits
+
+  for (int i = 1; i < bytes; i++) {
+    cp = (cp << 6) | (chr[i] & 0x3F);
+  }
+
+  return cp;
+}
+
 size_t utf8RemoveLastChar(std::string& str) {
   if (str.empty()) return 0;
   size_t pos = str.size() - 1;
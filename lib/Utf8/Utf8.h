@@ -5,6 +5,8 @@
 #define REPLACEMENT_GLYPH 0xFFFD
 
 uint32_t utf8NextCodepoint(const unsigned char** string);
+// Same for text that need not be NUL-terminated: returns 0 at end, and never reads or moves past it
+uint32_t utf8NextCodepoint(const unsigned char** string, const unsigned char* end);
 // Remove the last UTF-8 codepoint from a std::string and return the new size.
 size_t utf8RemoveLastChar(std::string& str);
 // Truncate string by removing N UTF-8 codepoints from the end.
@@ -2,80 +2,249 @@
 
 #include <HalStorage.h>
 #include <HardwareSerial.h>
+#include <Serialization.h>
 #include <miniz.h>
 
 #include <algorithm>
 
-bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
-  // Setup inflator
-  const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+namespace {
+constexpr uint8_t ENTRY_INDEX_VERSION = 2;
+constexpr uint32_t ENTRY_INDEX_HEADER_SIZE = sizeof(ENTRY_INDEX_VERSION) + sizeof(uint32_t);
+// Entry paths are compared against the index's name table this many bytes at a time
+constexpr size_t NAME_COMPARE_CHUNK = 64;
+// Above this the index is searched on the card instead of being held in RAM (512 * 24 bytes = 12KB)
+constexpr uint32_t MAX_IN_MEMORY_INDEX_ENTRIES = 512;
+
+constexpr uint32_t CENTRAL_DIR_HEADER_SIG = 0x02014b50;
+constexpr size_t CENTRAL_DIR_HEADER_SIZE = 46;
+constexpr uint32_t CENTRAL_DIR_BLOCK_ALIGN = 512;
+
+uint16_t readLe16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+uint32_t readLe32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+bool cachedFileStatLess(const uint64_t aHash, const uint16_t aLen, const uint64_t bHash, const uint16_t bLen) {
+  return aHash < bHash || (aHash == bHash && aLen < bLen);
+}
+}  // namespace
+
+size_t ZipFile::InflateContext::liveBytes = 0;
+size_t ZipFile::InflateContext::peakLiveBytes = 0;
+
+bool ZipFile::InflateContext::ensureInflator() {
+  if (inflator) {
+    return true;
+  }
+  inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
   if (!inflator) {
     Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflator\n", millis());
     return false;
   }
-  memset(inflator, 0, sizeof(tinfl_decompressor));
-  tinfl_init(inflator);
+  liveBytes += sizeof(tinfl_decompressor);
+  peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+  return true;
+}
+
+bool ZipFile::InflateContext::ensureDictionary() {
+  if (dictionary) {
+    return true;
+  }
+  dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  if (!dictionary) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflate dictionary\n", millis());
+    return false;
+  }
+  liveBytes += TINFL_LZ_DICT_SIZE;
+  peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+  return true;
+}
 
-  size_t inBytes = deflatedSize;
-  size_t outBytes = inflatedSize;
-  const tinfl_status status = tinfl_decompress(inflator, inputBuf, &inBytes, nullptr, outputBuf, &outBytes,
-                                               TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+bool ZipFile::InflateContext::ensureInputBuffer(const size_t size) {
+  if (inputBufferSize >= size) {
+    return true;
+  }
+  // Grow only, and free first so the old block can be reused by the new one
+  free(inputBuffer);
+  liveBytes -= inputBufferSize;
+  inputBufferSize = 0;
+  inputBuffer = static_cast<uint8_t*>(malloc(size));
+  if (!inputBuffer) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflate input buffer\n", millis());
+    return false;
+  }
+  inputBufferSize = size;
+  liveBytes += size;
+  peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+  return true;
+}
+
+bool ZipFile::InflateContext::ensureOutputBuffer(const size_t size) {
+  if (outputBufferSize >= size) {
+    return true;
+  }
+  free(outputBuffer);
+  liveBytes -= outputBufferSize;
+  outputBufferSize = 0;
+  outputBuffer = static_cast<uint8_t*>(malloc(size));
+  if (!outputBuffer) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for buffer\n", millis());
+    return false;
+  }
+  outputBufferSize = size;
+  liveBytes += size;
+  peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+  return true;
+}
+
+size_t ZipFile::InflateContext::allocatedBytes() const {
+  return (inflator ? sizeof(tinfl_decompressor) : 0) + (dictionary ? TINFL_LZ_DICT_SIZE : 0) + inputBufferSize +
+         outputBufferSize;
+}
+
+void ZipFile::InflateContext::release() {
+  liveBytes -= allocatedBytes();
   free(inflator);
+  free(dictionary);
+  free(inputBuffer);
+  free(outputBuffer);
+  inflator = nullptr;
+  dictionary = nullptr;
+  inputBuffer = nullptr;
+  outputBuffer = nullptr;
+  inputBufferSize = 0;
+  outputBufferSize = 0;
+  inUse = false;
+}
+
+ZipFile::InflateContext* ZipFile::acquireInflateContext(InflateContext& fallback) {
+  if (inflateContext && !inflateContext->inUse) {
+    inflateContext->inUse = true;
+    return inflateContext;
+  }
+  return &fallback;
+}
+
+void ZipFile::releaseInflateContext(InflateContext* context, InflateContext& fallback) {
+  if (context == &fallback) {
+    fallback.release();
+  } else if (context) {
+    context->inUse = false;
+  }
+}
 
-  if (status != TINFL_STATUS_DONE) {
-    Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
+ZipFile::CentralDirReader::CentralDirReader(FsFile& file, const uint32_t dirStart, const uint32_t dirEnd,
+                                            const size_t readBudget)
+    : file(file), dirStart(dirStart), dirEnd(dirEnd), cursor(dirStart) {
+  const size_t dirSize = dirEnd > dirStart ? dirEnd - dirStart : 0;
+  wholeDirectory = dirSize > 0 && dirSize <= readBudget;
+  bufferSize = wholeDirectory ? dirSize : CENTRAL_DIR_BLOCK_SIZE;
+  buffer = static_cast<uint8_t*>(malloc(bufferSize));
+}
+
+bool ZipFile::CentralDirReader::ensureBuffered(const size_t len) {
+  if (cursor >= bufferStart && cursor + len <= bufferStart + bufferFilled) {
+    return true;
+  }
+  if (cursor < dirStart || cursor + len > dirEnd) {
+    return false;
+  }
+
+  // Refill so that the record at the cursor sits at the front of the buffer. Block reads start on a sector
+  // boundary, which keeps a header that straddled the previous block inside the new one.
+  const uint32_t start = wholeDirectory ? dirStart : cursor & ~(CENTRAL_DIR_BLOCK_ALIGN - 1);
+  const size_t toRead = dirEnd - start < bufferSize ? dirEnd - start : bufferSize;
+  file.seek(start);
+  const int dataRead = file.read(buffer, toRead);
+  if (dataRead <= 0) {
+    bufferFilled = 0;
     return false;
   }
+  bufferStart = start;
+  bufferFilled = dataRead;
+  return cursor + len <= bufferStart + bufferFilled;
+}
 
+bool ZipFile::CentralDirReader::next(CentralDirRecord* record) {
+  if (!ensureBuffered(CENTRAL_DIR_HEADER_SIZE)) {
+    return false;
+  }
+
+  const uint8_t* header = buffer + (cursor - bufferStart);
+  if (readLe32(header) != CENTRAL_DIR_HEADER_SIG) {
+    return false;  // End of list
+  }
+
+  record->stat.method = readLe16(header + 10);
+  record->stat.compressedSize = readLe32(header + 20);
+  record->stat.uncompressedSize = readLe32(header + 24);
+  record->nameLen = readLe16(header + 28);
+  const uint16_t extraLen = readLe16(header + 30);
+  const uint16_t commentLen = readLe16(header + 32);
+  record->stat.localHeaderOffset = readLe32(header + 42);
+  record->name = nullptr;
+
+  if (record->nameLen < 256) {
+    if (!ensureBuffered(CENTRAL_DIR_HEADER_SIZE + record->nameLen)) {
+      return false;
+    }
+    record->name = reinterpret_cast<const char*>(buffer + (cursor - bufferStart) + CENTRAL_DIR_HEADER_SIZE);
+  }
+
+  cursor += CENTRAL_DIR_HEADER_SIZE + record->nameLen + extraLen + commentLen;
   return true;
 }
 
+ZipFile::CentralDirReader* ZipFile::getCentralDirReader() {
+  if (centralDirReader) {
+    return centralDirReader.get();
+  }
+
+  // Older writers leave the directory size unset, fall back to scanning up to the end of the file
+  const uint32_t fileSize = file.size();
+  uint32_t dirEnd = zipDetails.centralDirOffset + zipDetails.centralDirSize;
+  if (zipDetails.centralDirSize == 0 || dirEnd > fileSize) {
+    dirEnd = fileSize;
+  }
+
+  centralDirReader.reset(new CentralDirReader(file, zipDetails.centralDirOffset, dirEnd, centralDirReadBudget));
+  if (!centralDirReader->isValid()) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for central directory buffer\n", millis());
+    centralDirReader.reset();
+    return nullptr;
+  }
+  return centralDirReader.get();
+}
+
 bool ZipFile::loadAllFileStatSlims() {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
   }
 
-  if (!loadZipDetails()) {
+  CentralDirReader* reader = loadZipDetails() ? getCentralDirReader() : nullptr;
+  if (!reader) {
     if (!wasOpen) {
       close();
     }
     return false;
   }
 
-  file.seek(zipDetails.centralDirOffset);
-
-  uint32_t sig;
-  char itemName[256];
   fileStatSlimCache.clear();
   fileStatSlimCache.reserve(zipDetails.totalEntries);
 
-  while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
-
-    FileStatSlim fileStat = {};
-
-    file.seekCur(6);
-    file.read(&fileStat.method, 2);
-    file.seekCur(8);
-    file.read(&fileStat.compressedSize, 4);
-    file.read(&fileStat.uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat.localHeaderOffset, 4);
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
-
-    fileStatSlimCache.emplace(itemName, fileStat);
-
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
+  reader->seek(zipDetails.centralDirOffset);
+  CentralDirRecord record = {};
+  while (reader->next(&record)) {
+    if (record.name) {
+      fileStatSlimCache.push_back({fnvHash64(record.name, record.nameLen), record.nameLen, record.stat});
+    }
   }
 
+  std::sort(fileStatSlimCache.begin(), fileStatSlimCache.end(), [](const CachedFileStat& a, const CachedFileStat& b) {
+    return cachedFileStatLess(a.hash, a.nameLen, b.hash, b.nameLen);
+  });
+
   // Set cursor to start of central directory for sequential access
   lastCentralDirPos = zipDetails.centralDirOffset;
   lastCentralDirPosValid = true;
@@ -87,10 +256,16 @@ bool ZipFile::loadAllFileStatSlims() {
 }
 
 bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
+  const size_t filenameLen = strlen(filename);
+
   if (!fileStatSlimCache.empty()) {
-    const auto it = fileStatSlimCache.find(filename);
-    if (it != fileStatSlimCache.end()) {
-      *fileStat = it->second;
+    const uint64_t hash = fnvHash64(filename, filenameLen);
+    const auto it = std::lower_bound(fileStatSlimCache.begin(), fileStatSlimCache.end(), hash,
+                                     [filenameLen](const CachedFileStat& a, const uint64_t hash) {
+                                       return cachedFileStatLess(a.hash, a.nameLen, hash, filenameLen);
+                                     });
+    if (it != fileStatSlimCache.end() && it->hash == hash && it->nameLen == filenameLen) {
+      *fileStat = it->stat;
       return true;
     }
     return false;
@@ -101,7 +276,8 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
     return false;
   }
 
-  if (!loadZipDetails()) {
+  CentralDirReader* reader = loadZipDetails() ? getCentralDirReader() : nullptr;
+  if (!reader) {
     if (!wasOpen) {
       close();
     }
@@ -110,23 +286,20 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
 
   // Phase 1: Try scanning from cursor position first
   uint32_t startPos = lastCentralDirPosValid ? lastCentralDirPos : zipDetails.centralDirOffset;
-  uint32_t wrapPos = zipDetails.centralDirOffset;
   bool wrapped = false;
   bool found = false;
 
-  file.seek(startPos);
-
-  uint32_t sig;
-  char itemName[256];
+  reader->seek(startPos);
+  CentralDirRecord record = {};
 
   while (true) {
-    uint32_t entryStart = file.position();
+    const uint32_t entryStart = reader->position();
 
-    if (file.read(&sig, 4) != 4 || sig != 0x02014b50) {
+    if (!reader->next(&record)) {
       // End of central directory
       if (!wrapped && lastCentralDirPosValid && startPos != zipDetails.centralDirOffset) {
         // Wrap around to beginning
-        file.seek(zipDetails.centralDirOffset);
+        reader->seek(zipDetails.centralDirOffset);
         wrapped = true;
         continue;
       }
@@ -138,37 +311,14 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
       break;
     }
 
-    file.seekCur(6);
-    file.read(&fileStat->method, 2);
-    file.seekCur(8);
-    file.read(&fileStat->compressedSize, 4);
-    file.read(&fileStat->uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat->localHeaderOffset, 4);
-
-    if (nameLen < 256) {
-      file.read(itemName, nameLen);
-      itemName[nameLen] = '\0';
-
-      if (strcmp(itemName, filename) == 0) {
-        // Found it! Update cursor to next entry
-        file.seekCur(m + k);
-        lastCentralDirPos = file.position();
-        lastCentralDirPosValid = true;
-        found = true;
-        break;
-      }
-    } else {
-      // Name too long, skip it
-      file.seekCur(nameLen);
+    if (record.name && record.nameLen == filenameLen && memcmp(record.name, filename, filenameLen) == 0) {
+      // Found it! Update cursor to next entry
+      *fileStat = record.stat;
+      lastCentralDirPos = reader->position();
+      lastCentralDirPosValid = true;
+      found = true;
+      break;
     }
-
-    // Skip extra field + comment
-    file.seekCur(m + k);
   }
 
   if (!wasOpen) {
@@ -210,6 +360,28 @@ long ZipFile::getDataOffset(const FileStatSlim& fileStat) {
   return fileOffset + localHeaderSize + filenameLength + extraOffset;
 }
 
+bool ZipFile::locateEntry(const char* filename, FileStatSlim* fileStat, long* dataOffset) {
+  if (entryIndex && entryIndex->isLoaded()) {
+    IndexEntry entry = {};
+    if (!entryIndex->find(filename, &entry)) {
+      return false;
+    }
+    fileStat->method = entry.method;
+    fileStat->compressedSize = entry.compressedSize;
+    fileStat->uncompressedSize = entry.uncompressedSize;
+    fileStat->localHeaderOffset = 0;
+    *dataOffset = entry.dataOffset;
+    return true;
+  }
+
+  if (!loadFileStatSlim(filename, fileStat)) {
+    return false;
+  }
+
+  *dataOffset = getDataOffset(*fileStat);
+  return *dataOffset >= 0;
+}
+
 bool ZipFile::loadZipDetails() {
   if (zipDetails.isSet) {
     return true;
@@ -266,8 +438,10 @@ bool ZipFile::loadZipDetails() {
   // Now extract the values we need from the EOCD record
   // Relative positions within EOCD:
   // Offset 10: Total number of entries (2 bytes)
+  // Offset 12: Size of the central directory (4 bytes)
   // Offset 16: Offset of start of central directory with respect to the starting disk number (4 bytes)
   zipDetails.totalEntries = *reinterpret_cast<uint16_t*>(&buffer[foundOffset + 10]);
+  zipDetails.centralDirSize = *reinterpret_cast<uint32_t*>(&buffer[foundOffset + 12]);
   zipDetails.centralDirOffset = *reinterpret_cast<uint32_t*>(&buffer[foundOffset + 16]);
   zipDetails.isSet = true;
 
@@ -286,6 +460,7 @@ bool ZipFile::open() {
 }
 
 bool ZipFile::close() {
+  centralDirReader.reset();
   if (file) {
     file.close();
   }
@@ -295,6 +470,15 @@ bool ZipFile::close() {
 }
 
 bool ZipFile::getInflatedFileSize(const char* filename, size_t* size) {
+  if (entryIndex && entryIndex->isLoaded()) {
+    IndexEntry entry = {};
+    if (!entryIndex->find(filename, &entry)) {
+      return false;
+    }
+    *size = static_cast<size_t>(entry.uncompressedSize);
+    return true;
+  }
+
   FileStatSlim fileStat = {};
   if (!loadFileStatSlim(filename, &fileStat)) {
     return false;
@@ -314,61 +498,38 @@ int ZipFile::fillUncompressedSizes(std::vector<SizeTarget>& targets, std::vector
     return 0;
   }
 
-  if (!loadZipDetails()) {
+  CentralDirReader* reader = loadZipDetails() ? getCentralDirReader() : nullptr;
+  if (!reader) {
     if (!wasOpen) {
       close();
     }
     return 0;
   }
 
-  file.seek(zipDetails.centralDirOffset);
+  reader->seek(zipDetails.centralDirOffset);
 
   int matched = 0;
-  uint32_t sig;
-  char itemName[256];
-
-  while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;
-
-    file.seekCur(6);
-    uint16_t method;
-    file.read(&method, 2);
-    file.seekCur(8);
-    uint32_t compressedSize, uncompressedSize;
-    file.read(&compressedSize, 4);
-    file.read(&uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    uint32_t localHeaderOffset;
-    file.read(&localHeaderOffset, 4);
-
-    if (nameLen < 256) {
-      file.read(itemName, nameLen);
-      itemName[nameLen] = '\0';
-
-      uint64_t hash = fnvHash64(itemName, nameLen);
-      SizeTarget key = {hash, nameLen, 0};
-
-      auto it = std::lower_bound(targets.begin(), targets.end(), key, [](const SizeTarget& a, const SizeTarget& b) {
-        return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
-      });
-
-      while (it != targets.end() && it->hash == hash && it->len == nameLen) {
-        if (it->index < sizes.size()) {
-          sizes[it->index] = uncompressedSize;
-          matched++;
-        }
-        ++it;
-      }
-    } else {
-      file.seekCur(nameLen);
+  CentralDirRecord record = {};
+
+  while (reader->next(&record)) {
+    if (!record.name) {
+      continue;
     }
 
-    file.seekCur(m + k);
+    uint64_t hash = fnvHash64(record.name, record.nameLen);
+    SizeTarget key = {hash, record.nameLen, 0};
+
+    auto it = std::lower_bound(targets.begin(), targets.end(), key, [](const SizeTarget& a, const SizeTarget& b) {
+      return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
+    });
+
+    while (it != targets.end() && it->hash == hash && it->len == record.nameLen) {
+      if (it->index < sizes.size()) {
+        sizes[it->index] = record.stat.uncompressedSize;
+        matched++;
+      }
+      ++it;
+    }
   }
 
   if (!wasOpen) {
@@ -378,22 +539,298 @@ int ZipFile::fillUncompressedSizes(std::vector<SizeTarget>& targets, std::vector
   return matched;
 }
 
-uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const bool trailingNullByte) {
+bool ZipFile::buildEntryIndex(const std::string& indexPath) {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
-    return nullptr;
+    return false;
   }
 
-  FileStatSlim fileStat = {};
-  if (!loadFileStatSlim(filename, &fileStat)) {
+  CentralDirReader* reader = loadZipDetails() ? getCentralDirReader() : nullptr;
+  if (!reader) {
     if (!wasOpen) {
       close();
     }
+    return false;
+  }
+
+  // An entry and where its path starts in the name table, which keeps central directory order
+  struct NamedEntry {
+    IndexEntry entry;
+    uint32_t nameOffset;
+  };
+  std::vector<NamedEntry> entries;
+  entries.reserve(zipDetails.totalEntries);
+  std::string names;
+
+  reader->seek(zipDetails.centralDirOffset);
+  CentralDirRecord record = {};
+  while (reader->next(&record)) {
+    if (record.name) {
+      // dataOffset holds the local header offset until it is resolved below
+      entries.push_back({{fnvHash64(record.name, record.nameLen), record.nameLen, record.stat.method,
+                          record.stat.compressedSize, record.stat.uncompressedSize, record.stat.localHeaderOffset},
+                         static_cast<uint32_t>(names.size())});
+      names.append(record.name, record.nameLen);
+    }
+  }
+
+  // Resolve data offsets in archive order so the local header reads only ever seek forward
+  std::sort(entries.begin(), entries.end(),
+            [](const NamedEntry& a, const NamedEntry& b) { return a.entry.dataOffset < b.entry.dataOffset; });
+  for (auto& named : entries) {
+    IndexEntry& entry = named.entry;
+    FileStatSlim fileStat = {entry.method, entry.compressedSize, entry.uncompressedSize, entry.dataOffset};
+    const long dataOffset = getDataOffset(fileStat);
+    if (dataOffset < 0) {
+      if (!wasOpen) {
+        close();
+      }
+      return false;
+    }
+    entry.dataOffset = static_cast<uint32_t>(dataOffset);
+  }
+
+  if (!wasOpen) {
+    close();
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const NamedEntry& a, const NamedEntry& b) {
+    return a.entry.hash < b.entry.hash || (a.entry.hash == b.entry.hash && a.entry.nameLen < b.entry.nameLen);
+  });
+
+  FsFile indexFile;
+  if (!Storage.openFileForWrite("ZIP", indexPath, indexFile)) {
+    return false;
+  }
+
+  const uint32_t entryCount = entries.size();
+  std::vector<IndexEntry> sortedEntries;
+  std::vector<uint32_t> nameOffsets;
+  sortedEntries.reserve(entryCount);
+  nameOffsets.reserve(entryCount);
+  for (const auto& named : entries) {
+    sortedEntries.push_back(named.entry);
+    nameOffsets.push_back(named.nameOffset);
+  }
+
+  const size_t entriesSize = entryCount * sizeof(IndexEntry);
+  const size_t nameOffsetsSize = entryCount * sizeof(uint32_t);
+  serialization::writePod(indexFile, ENTRY_INDEX_VERSION);
+  serialization::writePod(indexFile, entryCount);
+  const bool success =
+      indexFile.write(reinterpret_cast<const uint8_t*>(sortedEntries.data()), entriesSize) == entriesSize &&
+      indexFile.write(reinterpret_cast<const uint8_t*>(nameOffsets.data()), nameOffsetsSize) == nameOffsetsSize &&
+      indexFile.write(reinterpret_cast<const uint8_t*>(names.data()), names.size()) == names.size();
+  indexFile.close();
+
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] Failed to write entry index\n", millis());
+    Storage.remove(indexPath.c_str());
+    return false;
+  }
+
+  Serial.printf("[%lu] [ZIP] Wrote entry index with %u entries\n", millis(), entryCount);
+  return true;
+}
+
+bool ZipFile::EntryIndex::load(const std::string& indexPath) {
+  close();
+
+  path = indexPath;
+  if (!Storage.openFileForRead("ZIP", indexPath, file)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(file, version);
+  serialization::readPod(file, entryCount);
+  if (version != ENTRY_INDEX_VERSION ||
+      file.size() < ENTRY_INDEX_HEADER_SIZE + static_cast<uint64_t>(entryCount) * (sizeof(IndexEntry) + 4)) {
+    Serial.printf("[%lu] [ZIP] Entry index invalid or out of date\n", millis());
+    close();
+    return false;
+  }
+
+  if (entryCount > MAX_IN_MEMORY_INDEX_ENTRIES) {
+    // Keep the file open and binary search it on lookup
+    Serial.printf("[%lu] [ZIP] Using on-card entry index with %u entries\n", millis(), entryCount);
+    return true;
+  }
+
+  entries.resize(entryCount);
+  const size_t entriesSize = entryCount * sizeof(IndexEntry);
+  const bool success = file.read(entries.data(), entriesSize) == static_cast<int>(entriesSize);
+  // Paths are only read for the rare hash and length shared by several entries, which reopens the file
+  file.close();
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] Failed to read entry index\n", millis());
+    close();
+    return false;
+  }
+
+  Serial.printf("[%lu] [ZIP] Loaded entry index with %u entries\n", millis(), entryCount);
+  return true;
+}
+
+void ZipFile::EntryIndex::close() {
+  if (file) {
+    file.close();
+  }
+  path.clear();
+  entries.clear();
+  entries.shrink_to_fit();
+  entryCount = 0;
+}
+
+bool ZipFile::EntryIndex::readEntry(const uint32_t position, IndexEntry* entry) {
+  if (!entries.empty()) {
+    *entry = entries[position];
+    return true;
+  }
+  file.seek(ENTRY_INDEX_HEADER_SIZE + static_cast<uint64_t>(position) * sizeof(IndexEntry));
+  return file.read(entry, sizeof(IndexEntry)) == static_cast<int>(sizeof(IndexEntry));
+}
+
+bool ZipFile::EntryIndex::nameMatches(const uint32_t position, const char* filename, const uint16_t nameLen) {
+  // An index held in RAM has closed its file
+  FsFile pathFile;
+  if (!file && !Storage.openFileForRead("ZIP", path, pathFile)) {
+    return false;
+  }
+  FsFile& source = file ? file : pathFile;
+
+  const uint64_t nameOffsetsStart = ENTRY_INDEX_HEADER_SIZE + static_cast<uint64_t>(entryCount) * sizeof(IndexEntry);
+  const uint64_t namesStart = nameOffsetsStart + static_cast<uint64_t>(entryCount) * sizeof(uint32_t);
+  uint32_t nameOffset = 0;
+  source.seek(nameOffsetsStart + static_cast<uint64_t>(position) * sizeof(uint32_t));
+  bool matches = source.read(&nameOffset, sizeof(nameOffset)) == static_cast<int>(sizeof(nameOffset));
+
+  source.seek(namesStart + nameOffset);
+  char chunk[NAME_COMPARE_CHUNK];
+  for (size_t compared = 0; matches && compared < nameLen;) {
+    const size_t length = std::min(NAME_COMPARE_CHUNK, nameLen - compared);
+    matches = source.read(chunk, length) == static_cast<int>(length) && memcmp(chunk, filename + compared, length) == 0;
+    compared += length;
+  }
+
+  if (pathFile) {
+    pathFile.close();
+  }
+  return matches;
+}
+
+bool ZipFile::EntryIndex::find(const char* filename, IndexEntry* entry) {
+  if (!isLoaded()) {
+    return false;
+  }
+
+  const uint16_t nameLen = strlen(filename);
+  const uint64_t hash = fnvHash64(filename, nameLen);
+  const auto less = [](const IndexEntry& a, const uint64_t hash, const uint16_t nameLen) {
+    return a.hash < hash || (a.hash == hash && a.nameLen < nameLen);
+  };
+
+  uint32_t lo = 0;
+  if (!entries.empty()) {
+    lo = std::lower_bound(entries.begin(), entries.end(), IndexEntry{hash, nameLen, 0, 0, 0, 0},
+                          [&less](const IndexEntry& a, const IndexEntry& b) { return less(a, b.hash, b.nameLen); }) -
+         entries.begin();
+  } else {
+    uint32_t hi = entryCount;
+    while (lo < hi) {
+      const uint32_t mid = lo + (hi - lo) / 2;
+      IndexEntry candidate = {};
+      if (!readEntry(mid, &candidate)) {
+        return false;
+      }
+      if (less(candidate, hash, nameLen)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+  }
+
+  IndexEntry candidate = {};
+  if (lo >= entryCount || !readEntry(lo, &candidate) || candidate.hash != hash || candidate.nameLen != nameLen) {
+    return false;
+  }
+
+  // Entries whose paths share a hash and length sit next to each other. Only then are the paths read to tell them
+  // apart; a lone entry is taken on its 64-bit hash and length.
+  IndexEntry next = {};
+  if (lo + 1 >= entryCount || !readEntry(lo + 1, &next) || next.hash != hash || next.nameLen != nameLen) {
+    *entry = candidate;
+    return true;
+  }
+  for (; lo < entryCount; lo++) {
+    if (!readEntry(lo, &candidate) || candidate.hash != hash || candidate.nameLen != nameLen) {
+      return false;
+    }
+    if (nameMatches(lo, filename, nameLen)) {
+      *entry = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ZipFile::inflateToMemory(InflateContext& context, const size_t deflatedSize, uint8_t* out,
+                              const size_t inflatedSize) {
+  constexpr size_t inputChunkSize = 1024;
+  if (!context.ensureInflator() || !context.ensureInputBuffer(inputChunkSize)) {
+    return false;
+  }
+  memset(context.inflator, 0, sizeof(tinfl_decompressor));
+  tinfl_init(context.inflator);
+
+  size_t compressedRemaining = deflatedSize;
+  size_t inputFilled = 0;
+  size_t inputCursor = 0;
+  size_t outputPos = 0;
+
+  while (true) {
+    if (inputCursor >= inputFilled && compressedRemaining > 0) {
+      const size_t toRead = std::min(compressedRemaining, context.inputBufferSize);
+      const int dataRead = file.read(context.inputBuffer, toRead);
+      if (dataRead <= 0) {
+        Serial.printf("[%lu] [ZIP] Could not read more compressed bytes\n", millis());
+        return false;
+      }
+      compressedRemaining -= dataRead;
+      inputFilled = dataRead;
+      inputCursor = 0;
+    }
+
+    size_t inBytes = inputFilled - inputCursor;
+    size_t outBytes = inflatedSize - outputPos;
+    const tinfl_status status =
+        tinfl_decompress(context.inflator, context.inputBuffer + inputCursor, &inBytes, out, out + outputPos, &outBytes,
+                         TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF |
+                             (compressedRemaining > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0));
+    inputCursor += inBytes;
+    outputPos += outBytes;
+
+    if (status == TINFL_STATUS_DONE) {
+      return true;
+    }
+    if (status < 0 || status == TINFL_STATUS_HAS_MORE_OUTPUT ||
+        (compressedRemaining == 0 && inputCursor >= inputFilled)) {
+      Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
+      return false;
+    }
+  }
+}
+
+uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const bool trailingNullByte) {
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
     return nullptr;
   }
 
-  const long fileOffset = getDataOffset(fileStat);
-  if (fileOffset < 0) {
+  FileStatSlim fileStat = {};
+  long fileOffset = -1;
+  if (!locateEntry(filename, &fileStat, &fileOffset)) {
     if (!wasOpen) {
       close();
     }
@@ -429,31 +866,15 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
 
     // Continue out of block with data set
   } else if (fileStat.method == MZ_DEFLATED) {
-    // Read out deflated content from file
-    const auto deflatedData = static_cast<uint8_t*>(malloc(deflatedDataSize));
-    if (deflatedData == nullptr) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for decompression buffer\n", millis());
-      if (!wasOpen) {
-        close();
-      }
-      return nullptr;
-    }
-
-    const size_t dataRead = file.read(deflatedData, deflatedDataSize);
+    // Inflate straight from the card into the output buffer, the compressed data is never held in full
+    InflateContext fallbackContext;
+    InflateContext* context = acquireInflateContext(fallbackContext);
+    const bool success = inflateToMemory(*context, deflatedDataSize, data, inflatedDataSize);
+    releaseInflateContext(context, fallbackContext);
     if (!wasOpen) {
       close();
     }
 
-    if (dataRead != deflatedDataSize) {
-      Serial.printf("[%lu] [ZIP] Failed to read data, expected %d got %d\n", millis(), deflatedDataSize, dataRead);
-      free(deflatedData);
-      free(data);
-      return nullptr;
-    }
-
-    const bool success = inflateOneShot(deflatedData, deflatedDataSize, data, inflatedDataSize);
-    free(deflatedData);
-
     if (!success) {
       Serial.printf("[%lu] [ZIP] Failed to inflate file\n", millis());
       free(data);
@@ -474,189 +895,176 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
   return data;
 }
 
-bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
-  const bool wasOpen = isOpen();
-  if (!wasOpen && !open()) {
-    return false;
-  }
+bool ZipFile::openEntry(const char* filename, EntryReader& reader, const size_t chunkSize) {
+  reader.close();
 
   FileStatSlim fileStat = {};
-  if (!loadFileStatSlim(filename, &fileStat)) {
+  long fileOffset = -1;
+  if (!locateEntry(filename, &fileStat, &fileOffset)) {
     return false;
   }
 
-  const long fileOffset = getDataOffset(fileStat);
-  if (fileOffset < 0) {
+  if (fileStat.method != MZ_NO_COMPRESSION && fileStat.method != MZ_DEFLATED) {
+    Serial.printf("[%lu] [ZIP] Unsupported compression method\n", millis());
     return false;
   }
 
-  file.seek(fileOffset);
-  const auto deflatedDataSize = fileStat.compressedSize;
-  const auto inflatedDataSize = fileStat.uncompressedSize;
+  if (!Storage.openFileForRead("ZIP", filePath, reader.file)) {
+    return false;
+  }
+  reader.file.seek(fileOffset);
+  reader.method = fileStat.method;
+  reader.inflatedSize = fileStat.uncompressedSize;
+  reader.compressedRemaining = fileStat.compressedSize;
+  reader.context = acquireInflateContext(reader.ownedContext);
 
   if (fileStat.method == MZ_NO_COMPRESSION) {
-    // no deflation, just read content
-    const auto buffer = static_cast<uint8_t*>(malloc(chunkSize));
-    if (!buffer) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for buffer\n", millis());
-      if (!wasOpen) {
-        close();
-      }
-      return false;
-    }
+    return true;
+  }
 
-    size_t remaining = inflatedDataSize;
-    while (remaining > 0) {
-      const size_t dataRead = file.read(buffer, remaining < chunkSize ? remaining : chunkSize);
-      if (dataRead == 0) {
-        Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
-        free(buffer);
-        if (!wasOpen) {
-          close();
-        }
-        return false;
-      }
+  InflateContext& context = *reader.context;
+  if (!context.ensureInflator() || !context.ensureInputBuffer(chunkSize) || !context.ensureDictionary()) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for entry reader\n", millis());
+    reader.close();
+    return false;
+  }
+  memset(context.inflator, 0, sizeof(tinfl_decompressor));
+  tinfl_init(context.inflator);
+  return true;
+}
 
-      out.write(buffer, dataRead);
-      remaining -= dataRead;
-    }
+bool ZipFile::EntryReader::fillInputBuffer() {
+  if (compressedRemaining == 0) {
+    return false;
+  }
 
-    if (!wasOpen) {
-      close();
-    }
-    free(buffer);
-    return true;
+  const size_t toRead = std::min(compressedRemaining, context->inputBufferSize);
+  const int dataRead = file.read(context->inputBuffer, toRead);
+  if (dataRead <= 0) {
+    Serial.printf("[%lu] [ZIP] Could not read more compressed bytes\n", millis());
+    return false;
   }
 
-  if (fileStat.method == MZ_DEFLATED) {
-    // Setup inflator
-    const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
-    if (!inflator) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflator\n", millis());
-      if (!wasOpen) {
-        close();
-      }
-      return false;
-    }
-    memset(inflator, 0, sizeof(tinfl_decompressor));
-    tinfl_init(inflator);
+  compressedRemaining -= dataRead;
+  inputFilled = dataRead;
+  inputCursor = 0;
+  return true;
+}
 
-    // Setup file read buffer
-    const auto fileReadBuffer = static_cast<uint8_t*>(malloc(chunkSize));
-    if (!fileReadBuffer) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for zip file read buffer\n", millis());
-      free(inflator);
-      if (!wasOpen) {
-        close();
-      }
-      return false;
+int ZipFile::EntryReader::read(uint8_t* buf, const size_t len) {
+  if (!file) {
+    return -1;
+  }
+
+  if (method == MZ_NO_COMPRESSION) {
+    const size_t remaining = inflatedSize - producedBytes;
+    const size_t toRead = len < remaining ? len : remaining;
+    if (toRead == 0) {
+      return 0;
+    }
+    const int dataRead = file.read(buf, toRead);
+    if (dataRead <= 0) {
+      Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
+      return -1;
     }
+    producedBytes += dataRead;
+    return dataRead;
+  }
 
-    const auto outputBuffer = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
-    if (!outputBuffer) {
-      Serial.printf("[%lu] [ZIP] Failed to allocate memory for dictionary\n", millis());
-      free(inflator);
-      free(fileReadBuffer);
-      if (!wasOpen) {
-        close();
-      }
-      return false;
+  size_t copied = 0;
+  while (copied < len) {
+    // Hand out whatever the last inflate step left in the dictionary window first
+    if (pendingBytes > 0) {
+      const size_t toCopy = pendingBytes < len - copied ? pendingBytes : len - copied;
+      memcpy(buf + copied, context->dictionary + pendingStart, toCopy);
+      pendingStart += toCopy;
+      pendingBytes -= toCopy;
+      copied += toCopy;
+      continue;
     }
-    memset(outputBuffer, 0, TINFL_LZ_DICT_SIZE);
-
-    size_t fileRemainingBytes = deflatedDataSize;
-    size_t processedOutputBytes = 0;
-    size_t fileReadBufferFilledBytes = 0;
-    size_t fileReadBufferCursor = 0;
-    size_t outputCursor = 0;  // Current offset in the circular dictionary
-
-    while (true) {
-      // Load more compressed bytes when needed
-      if (fileReadBufferCursor >= fileReadBufferFilledBytes) {
-        if (fileRemainingBytes == 0) {
-          // Should not be hit, but a safe protection
-          break;  // EOF
-        }
-
-        fileReadBufferFilledBytes =
-            file.read(fileReadBuffer, fileRemainingBytes < chunkSize ? fileRemainingBytes : chunkSize);
-        fileRemainingBytes -= fileReadBufferFilledBytes;
-        fileReadBufferCursor = 0;
-
-        if (fileReadBufferFilledBytes == 0) {
-          // Bad read
-          break;  // EOF
-        }
-      }
 
-      // Available bytes in fileReadBuffer to process
-      size_t inBytes = fileReadBufferFilledBytes - fileReadBufferCursor;
-      // Space remaining in outputBuffer
-      size_t outBytes = TINFL_LZ_DICT_SIZE - outputCursor;
-
-      const tinfl_status status = tinfl_decompress(inflator, fileReadBuffer + fileReadBufferCursor, &inBytes,
-                                                   outputBuffer, outputBuffer + outputCursor, &outBytes,
-                                                   fileRemainingBytes > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
-
-      // Update input position
-      fileReadBufferCursor += inBytes;
-
-      // Write output chunk
-      if (outBytes > 0) {
-        processedOutputBytes += outBytes;
-        if (out.write(outputBuffer + outputCursor, outBytes) != outBytes) {
-          Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
-          if (!wasOpen) {
-            close();
-          }
-          free(outputBuffer);
-          free(fileReadBuffer);
-          free(inflator);
-          return false;
-        }
-        // Update output position in buffer (with wraparound)
-        outputCursor = (outputCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
-      }
+    if (finished) {
+      break;
+    }
 
-      if (status < 0) {
-        Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
-        if (!wasOpen) {
-          close();
-        }
-        free(outputBuffer);
-        free(fileReadBuffer);
-        free(inflator);
-        return false;
-      }
+    if (inputCursor >= inputFilled && compressedRemaining > 0 && !fillInputBuffer()) {
+      return -1;
+    }
 
-      if (status == TINFL_STATUS_DONE) {
-        Serial.printf("[%lu] [ZIP] Decompressed %d bytes into %d bytes\n", millis(), deflatedDataSize,
-                      inflatedDataSize);
-        if (!wasOpen) {
-          close();
-        }
-        free(inflator);
-        free(fileReadBuffer);
-        free(outputBuffer);
-        return true;
-      }
+    size_t inBytes = inputFilled - inputCursor;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - dictionaryCursor;
+    const tinfl_status status = tinfl_decompress(context->inflator, context->inputBuffer + inputCursor, &inBytes,
+                                                 context->dictionary, context->dictionary + dictionaryCursor,
+                                                 &outBytes, compressedRemaining > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+    inputCursor += inBytes;
+
+    pendingStart = dictionaryCursor;
+    pendingBytes = outBytes;
+    producedBytes += outBytes;
+    dictionaryCursor = (dictionaryCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+    if (status < 0) {
+      Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
+      return -1;
     }
 
-    // If we get here, EOF reached without TINFL_STATUS_DONE
-    Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
-    if (!wasOpen) {
-      close();
+    if (status == TINFL_STATUS_DONE) {
+      finished = true;
+    } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && compressedRemaining == 0 && inputCursor >= inputFilled) {
+      Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
+      return -1;
     }
-    free(outputBuffer);
-    free(fileReadBuffer);
-    free(inflator);
+  }
+
+  return static_cast<int>(copied);
+}
+
+void ZipFile::EntryReader::close() {
+  if (file) {
+    file.close();
+  }
+  releaseInflateContext(context, ownedContext);
+  context = nullptr;
+  method = 0;
+  inflatedSize = 0;
+  producedBytes = 0;
+  compressedRemaining = 0;
+  finished = false;
+  inputFilled = 0;
+  inputCursor = 0;
+  dictionaryCursor = 0;
+  pendingStart = 0;
+  pendingBytes = 0;
+}
+
+bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
+  EntryReader reader;
+  if (!openEntry(filename, reader, chunkSize)) {
     return false;
   }
 
-  if (!wasOpen) {
-    close();
+  // Output chunks come from the reader's inflate context so that it is the only buffer set touched per read
+  if (!reader.context->ensureOutputBuffer(chunkSize)) {
+    return false;
   }
+  uint8_t* buffer = reader.context->outputBuffer;
 
-  Serial.printf("[%lu] [ZIP] Unsupported compression method\n", millis());
-  return false;
+  bool success = true;
+  while (true) {
+    const int dataRead = reader.read(buffer, chunkSize);
+    if (dataRead < 0) {
+      success = false;
+      break;
+    }
+    if (dataRead == 0) {
+      break;
+    }
+    if (out.write(buffer, dataRead) != static_cast<size_t>(dataRead)) {
+      Serial.printf("[%lu] [ZIP] Failed to write all output bytes to stream\n", millis());
+      success = false;
+      break;
+    }
+  }
+
+  return success;
 }
@@ -1,10 +1,12 @@
 #pragma once
 #include <HalStorage.h>
 
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+struct tinfl_decompressor_tag;
+
 class ZipFile {
  public:
   struct FileStatSlim {
@@ -16,10 +18,15 @@ class ZipFile {
 
   struct ZipDetails {
     uint32_t centralDirOffset;
+    uint32_t centralDirSize;
     uint16_t totalEntries;
     bool isSet;
   };
 
+  // Central directories up to this size are read in one go, larger ones in CENTRAL_DIR_BLOCK_SIZE blocks
+  static constexpr size_t DEFAULT_CENTRAL_DIR_READ_BUDGET = 16 * 1024;
+  static constexpr size_t CENTRAL_DIR_BLOCK_SIZE = 4096;
+
   // Target for batch uncompressed size lookup (sorted by hash, then len)
   struct SizeTarget {
     uint64_t hash;   // FNV-1a 64-bit hash of normalized path
@@ -27,6 +34,43 @@ class ZipFile {
     uint16_t index;  // Caller's index (e.g. spine index)
   };
 
+  // Record of the persistent entry index: everything needed to open an entry without touching the central directory
+  struct IndexEntry {
+    uint64_t hash;              // FNV-1a 64-bit hash of the entry path
+    uint16_t nameLen;           // Length of path for collision reduction
+    uint16_t method;            // Compression method
+    uint32_t compressedSize;    // Compressed size
+    uint32_t uncompressedSize;  // Uncompressed size
+    uint32_t dataOffset;        // Offset of entry data (local header already skipped)
+  };
+  static_assert(sizeof(IndexEntry) == 24, "IndexEntry must stay packed, it is written to disk as-is");
+
+  // Sorted (hash, nameLen) copy of the central directory, built once per book by buildEntryIndex().
+  // Small indexes are loaded with a single read; large ones stay on the card and are binary searched so that
+  // books with thousands of entries don't pin their whole index in RAM, and only the latter keep the file open. Entry
+  // paths stay on the card and are only read when several entries share a hash and length.
+  class EntryIndex {
+    std::string path;
+    FsFile file;
+    std::vector<IndexEntry> entries;
+    uint32_t entryCount = 0;
+
+    bool readEntry(uint32_t position, IndexEntry* entry);
+    bool nameMatches(uint32_t position, const char* filename, uint16_t nameLen);
+
+   public:
+    EntryIndex() = default;
+    ~EntryIndex() { close(); }
+    EntryIndex(const EntryIndex&) = delete;
+    EntryIndex& operator=(const EntryIndex&) = delete;
+
+    bool load(const std::string& indexPath);
+    void close();
+    bool isLoaded() const { return !entries.empty() || !!file; }
+    uint32_t size() const { return entryCount; }
+    bool find(const char* filename, IndexEntry* entry);
+  };
+
   // FNV-1a 64-bit hash computed from char buffer (no std::string allocation)
   static uint64_t fnvHash64(const char* s, size_t len) {
     uint64_t hash = 14695981039346656037ull;
@@ -37,11 +81,144 @@ class ZipFile {
     return hash;
   }
 
+  // Decompressor state, 32KB dictionary window and I/O buffers shared by the inflate paths. Each part is allocated
+  // on first use and kept until release(), so a context owned by an open book (see Epub) replaces the 40KB+ of
+  // transient blocks every read used to malloc and free. A context serves one read at a time; reads that find it
+  // busy, or that were given none, fall back to a private context that lives only as long as the read.
+  class InflateContext {
+    friend class ZipFile;
+
+    tinfl_decompressor_tag* inflator = nullptr;
+    uint8_t* dictionary = nullptr;
+    uint8_t* inputBuffer = nullptr;
+    size_t inputBufferSize = 0;
+    uint8_t* outputBuffer = nullptr;
+    size_t outputBufferSize = 0;
+    bool inUse = false;
+
+    // Bytes held by all contexts right now, and the most they ever held at once
+    static size_t liveBytes;
+    static size_t peakLiveBytes;
+
+    bool ensureInflator();
+    bool ensureDictionary();
+    bool ensureInputBuffer(size_t size);
+    bool ensureOutputBuffer(size_t size);
+
+   public:
+    InflateContext() = default;
+    ~InflateContext() { release(); }
+    InflateContext(const InflateContext&) = delete;
+    InflateContext& operator=(const InflateContext&) = delete;
+
+    // Heap currently held by this context
+    size_t allocatedBytes() const;
+    void release();
+
+    // Highest number of bytes held by all inflate contexts at once since boot or the last resetPeakBytes()
+    static size_t peakBytes() { return peakLiveBytes; }
+    static void resetPeakBytes() { peakLiveBytes = liveBytes; }
+  };
+
+  // Pull-style reader over a single entry, opened with ZipFile::openEntry().
+  // Stored entries are a plain ranged read; deflated entries are inflated on demand through a 32KB dictionary window.
+  // The reader holds its own file handle, so the ZipFile it came from does not need to outlive it, but a borrowed
+  // InflateContext does.
+  class EntryReader {
+    friend class ZipFile;
+
+    FsFile file;
+    uint16_t method = 0;
+    size_t inflatedSize = 0;
+    size_t producedBytes = 0;
+    size_t compressedRemaining = 0;
+    bool finished = false;
+
+    // Inflate buffers, either borrowed from the ZipFile's context or ownedContext
+    InflateContext* context = nullptr;
+    InflateContext ownedContext;
+    size_t inputFilled = 0;
+    size_t inputCursor = 0;
+    size_t dictionaryCursor = 0;
+    size_t pendingStart = 0;
+    size_t pendingBytes = 0;
+
+    bool fillInputBuffer();
+
+   public:
+    EntryReader() = default;
+    ~EntryReader() { close(); }
+    EntryReader(const EntryReader&) = delete;
+    EntryReader& operator=(const EntryReader&) = delete;
+
+    bool isOpen() const { return !!file; }
+    // Uncompressed size of the entry as recorded in the central directory
+    size_t size() const { return inflatedSize; }
+    // Uncompressed bytes not yet returned by read()
+    size_t available() const {
+      if (finished && pendingBytes == 0) return 0;
+      // producedBytes already counts the inflated bytes still waiting in the dictionary window
+      const size_t returnedBytes = producedBytes - pendingBytes;
+      return inflatedSize > returnedBytes ? inflatedSize - returnedBytes : 0;
+    }
+    // Read up to len uncompressed bytes into buf. Returns bytes read, 0 at end of entry, -1 on error.
+    int read(uint8_t* buf, size_t len);
+    void close();
+  };
+
  private:
+  // One parsed central directory record. name points into the reader's buffer and is only valid until the next
+  // call to CentralDirReader::next(); it is nullptr for names of 256 bytes or more, which are never looked up.
+  struct CentralDirRecord {
+    FileStatSlim stat;
+    uint16_t nameLen;
+    const char* name;
+  };
+
+  // Buffered walk over the central directory shared by every scan. Reads whole 512-byte aligned blocks (or the
+  // entire directory when it fits the read budget), parses the fixed 46-byte headers from memory and refills
+  // when a record straddles the end of the buffer.
+  class CentralDirReader {
+    FsFile& file;
+    uint8_t* buffer = nullptr;
+    size_t bufferSize = 0;
+    uint32_t bufferStart = 0;  // Archive offset of buffer[0]
+    size_t bufferFilled = 0;
+    uint32_t dirStart;
+    uint32_t dirEnd;
+    uint32_t cursor;  // Archive offset of the next record
+    bool wholeDirectory = false;
+
+    bool ensureBuffered(size_t len);
+
+   public:
+    CentralDirReader(FsFile& file, uint32_t dirStart, uint32_t dirEnd, size_t readBudget);
+    ~CentralDirReader() { free(buffer); }
+    CentralDirReader(const CentralDirReader&) = delete;
+    CentralDirReader& operator=(const CentralDirReader&) = delete;
+
+    bool isValid() const { return buffer != nullptr; }
+    uint32_t position() const { return cursor; }
+    void seek(const uint32_t offset) { cursor = offset; }
+    // Parse the record at the cursor and advance past it. Returns false at the end of the directory.
+    bool next(CentralDirRecord* record);
+  };
+
+  // Flat (hash, nameLen) sorted replacement for a name-keyed map, filled by loadAllFileStatSlims()
+  struct CachedFileStat {
+    uint64_t hash;
+    uint16_t nameLen;
+    FileStatSlim stat;
+  };
+
   const std::string& filePath;
+  EntryIndex* entryIndex;
+  InflateContext* inflateContext;
   FsFile file;
-  ZipDetails zipDetails = {0, 0, false};
-  std::unordered_map<std::string, FileStatSlim> fileStatSlimCache;
+  ZipDetails zipDetails = {0, 0, 0, false};
+  size_t centralDirReadBudget = DEFAULT_CENTRAL_DIR_READ_BUDGET;
+  std::unique_ptr<CentralDirReader> centralDirReader;
+  std::vector<CachedFileStat> fileStatSlimCache;
 
   // Cursor for sequential central-dir scanning optimization
   uint32_t lastCentralDirPos = 0;
@@ -49,18 +226,33 @@ class ZipFile {
 
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
   long getDataOffset(const FileStatSlim& fileStat);
+  bool locateEntry(const char* filename, FileStatSlim* fileStat, long* dataOffset);
   bool loadZipDetails();
+  CentralDirReader* getCentralDirReader();
+  InflateContext* acquireInflateContext(InflateContext& fallback);
+  static void releaseInflateContext(InflateContext* context, InflateContext& fallback);
+  bool inflateToMemory(InflateContext& context, size_t deflatedSize, uint8_t* out, size_t inflatedSize);
 
  public:
-  explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
+  // entryIndex is optional; when set, entry lookups are served from it instead of the central directory.
+  // inflateContext is optional; when set, inflating reuses its buffers instead of allocating them per read.
+  explicit ZipFile(const std::string& filePath, EntryIndex* entryIndex = nullptr,
+                   InflateContext* inflateContext = nullptr)
+      : filePath(filePath), entryIndex(entryIndex), inflateContext(inflateContext) {}
   ~ZipFile() = default;
   // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
   // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
   bool isOpen() const { return !!file; }
+  // Bytes of central directory that may be buffered in one piece; larger directories are read in blocks
+  void setCentralDirReadBudget(const size_t bytes) { centralDirReadBudget = bytes; }
   bool open();
   bool close();
   bool loadAllFileStatSlims();
+  // Scan the central directory once, resolve every entry's data offset and write the sorted index to indexPath
+  bool buildEntryIndex(const std::string& indexPath);
   bool getInflatedFileSize(const char* filename, size_t* size);
+  // Open a pull-style reader for filename. chunkSize is the compressed read size used for deflated entries.
+  bool openEntry(const char* filename, EntryReader& reader, size_t chunkSize = 1024);
   // Batch lookup: scan ZIP central dir once and fill sizes for matching targets.
   // targets must be sorted by (hash, len). sizes[target.index] receives uncompressedSize.
   // Returns number of targets matched.
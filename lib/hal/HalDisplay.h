@@ -33,6 +33,9 @@ class HalDisplay {
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Sends only the given part of the frame buffer and fast refreshes just that window. x and width are in pixels and
+  // must be multiples of 8.
+  void displayWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
 
   // Power management
   void deepSleep();
@@ -119,6 +119,9 @@ class CrossPointSettings {
   // UI Theme
   enum UI_THEME { CLASSIC = 0, LYRA = 1 };
 
+  // Neighbouring chapters indexed in the background on each side of the current one
+  enum PREINDEX_CHAPTERS { PREINDEX_OFF = 0, PREINDEX_1 = 1, PREINDEX_2 = 2, PREINDEX_CHAPTERS_COUNT };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -171,6 +174,8 @@ class CrossPointSettings {
   uint8_t fadingFix = 0;
   // Use book's embedded CSS styles for EPUB rendering (1 = enabled, 0 = disabled)
   uint8_t embeddedStyle = 1;
+  // Background chapter indexing depth
+  uint8_t preindexChapters = PREINDEX_1;
 
   ~CrossPointSettings() = default;
 
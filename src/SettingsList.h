@@ -46,6 +46,8 @@ inline std::vector<SettingInfo> getSettingsList() {
       SettingInfo::Toggle("Extra Paragraph Spacing", &CrossPointSettings::extraParagraphSpacing,
                           "extraParagraphSpacing", "Reader"),
       SettingInfo::Toggle("Text Anti-Aliasing", &CrossPointSettings::textAntiAliasing, "textAntiAliasing", "Reader"),
+      SettingInfo::Enum("Pre-index Chapters", &CrossPointSettings::preindexChapters, {"Off", "1 Each Side", "2 Each Side"},
+                        "preindexChapters", "Reader"),
 
       // --- Controls ---
       SettingInfo::Enum("Side Button Layout (reader)", &CrossPointSettings::sideButtonLayout,
@@ -73,6 +73,7 @@ void MyLibraryActivity::taskTrampoline(void* param) {
 
 void MyLibraryActivity::loadFiles() {
   files.clear();
+  filesVersion++;
 
   auto root = Storage.open(basepath.c_str());
   if (!root || !root.isDirectory()) {
@@ -225,31 +226,51 @@ void MyLibraryActivity::displayTaskLoop() {
   }
 }
 
-void MyLibraryActivity::render() const {
-  renderer.clearScreen();
-
+void MyLibraryActivity::render() {
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
   auto metrics = UITheme::getInstance().getMetrics();
 
+  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
+  const Rect listRect{0, contentTop, pageWidth, contentHeight};
+
+  // A cursor move within the page only changes the rows it left and entered
+  const int selected = static_cast<int>(selectorIndex);
+  const uint32_t version = filesVersion;
+  const int pageItems = std::max(1, contentHeight / metrics.listRowHeight);
+  const bool cursorOnly = renderedSelectorIndex >= 0 && renderedFilesVersion == version &&
+                          renderedSelectorIndex != selected && renderedSelectorIndex / pageItems == selected / pageItems;
+  if (cursorOnly) {
+    const Rect rows = GUI.getListRowsRect(listRect, renderedSelectorIndex, selected, false);
+    renderer.setClipRect(rows.x, rows.y, rows.width, rows.height);
+  }
+
+  renderer.clearScreen();
+
   auto folderName = basepath == "/" ? "SD card" : basepath.substr(basepath.rfind('/') + 1).c_str();
   GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, folderName);
 
-  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
-  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
   if (files.empty()) {
     renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, contentTop + 20, "No books found");
   } else {
     GUI.drawList(
-        renderer, Rect{0, contentTop, pageWidth, contentHeight}, files.size(), selectorIndex,
-        [this](int index) { return files[index]; }, nullptr, nullptr, nullptr);
+        renderer, listRect, files.size(), selectorIndex, [this](int index) { return files[index]; }, nullptr, nullptr,
+        nullptr);
   }
 
   // Help text
   const auto labels = mappedInput.mapLabels("« Home", "Open", "Up", "Down");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  if (cursorOnly) {
+    renderer.clearClipRect();
+    renderer.displayDirtyRegion();
+  } else {
+    renderer.displayBuffer();
+  }
+  renderedSelectorIndex = files.empty() ? -1 : selected;
+  renderedFilesVersion = version;
 }
 
 size_t MyLibraryActivity::findEntry(const std::string& name) const {
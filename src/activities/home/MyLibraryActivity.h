@@ -19,6 +19,10 @@ class MyLibraryActivity final : public Activity {
 
   size_t selectorIndex = 0;
   bool updateRequired = false;
+  // Selection on screen and the file list it was drawn from, bumped by every loadFiles()
+  int renderedSelectorIndex = -1;
+  uint32_t filesVersion = 0;
+  uint32_t renderedFilesVersion = 0;
 
   // Files state
   std::string basepath = "/";
@@ -30,7 +34,7 @@ class MyLibraryActivity final : public Activity {
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
-  void render() const;
+  void render();
 
   // Data loading
   void loadFiles();
@@ -5,6 +5,8 @@
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 
+#include <cstring>
+
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
@@ -17,12 +19,48 @@
 #include "fontIds.h"
 
 namespace {
-// pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
 constexpr unsigned long goHomeMs = 1000;
+// Background indexing only runs once no button has been touched for this long, and stops as soon as one is
+constexpr unsigned long indexingIdleMs = 1500;
+constexpr unsigned long indexingPollMs = 250;
+// 1KB input chunks the display task parses per turn while the open chapter is still being laid out
+constexpr size_t sectionBuildChunksPerTurn = 4;
+// Free heap a section build wants on top of the book's inflate buffers: the XML parser, the words of a long paragraph
+// and the pages laid out from it. Below this the draw-ahead buffers are let go before building.
+constexpr uint32_t sectionBuildHeapReserve = 48 * 1024;
 constexpr int statusBarMargin = 19;
 constexpr int progressBarMarginTop = 1;
 
+// Folds every setting pagination depends on into one value, so cached pages are dropped when any of them changes
+uint32_t pageLayoutKey(const uint16_t viewportWidth, const uint16_t viewportHeight) {
+  uint32_t key = 2166136261u;
+  const auto mix = [&key](const uint32_t value) { key = (key ^ value) * 16777619u; };
+  const float lineCompression = SETTINGS.getReaderLineCompression();
+  uint32_t lineCompressionBits;
+  memcpy(&lineCompressionBits, &lineCompression, sizeof(lineCompressionBits));
+  mix(SETTINGS.getReaderFontId());
+  mix(lineCompressionBits);
+  mix(SETTINGS.extraParagraphSpacing);
+  mix(SETTINGS.paragraphAlignment);
+  mix(SETTINGS.hyphenationEnabled);
+  mix(SETTINGS.embeddedStyle);
+  mix((viewportWidth << 16) | viewportHeight);
+  return key;
+}
+
+// Names one page as drawn with a given layout, for checking what the renderer's off-screen canvas holds
+uint32_t pageCanvasTag(const uint32_t layoutKey, const GfxRenderer::Orientation orientation, const int marginTop,
+                       const int marginLeft, const int spineIndex, const int page) {
+  uint32_t tag = layoutKey;
+  const auto mix = [&tag](const uint32_t value) { tag = (tag ^ value) * 16777619u; };
+  mix(orientation);
+  mix((marginTop << 16) | marginLeft);
+  mix(spineIndex);
+  mix(page);
+  return tag != 0 ? tag : 1;
+}
+
 int clampPercent(int percent) {
   if (percent < 0) {
     return 0;
@@ -61,6 +99,11 @@ void EpubReaderActivity::taskTrampoline(void* param) {
   self->displayTaskLoop();
 }
 
+void EpubReaderActivity::indexingTaskTrampoline(void* param) {
+  auto* self = static_cast<EpubReaderActivity*>(param);
+  self->indexingTaskLoop();
+}
+
 void EpubReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -116,6 +159,16 @@ void EpubReaderActivity::onEnter() {
               1,                  // Priority
               &displayTaskHandle  // Task handle
   );
+
+  if (SETTINGS.preindexChapters != CrossPointSettings::PREINDEX_OFF) {
+    lastInputTime = millis();
+    xTaskCreate(&EpubReaderActivity::indexingTaskTrampoline, "EpubIndexingTask",
+                8192,                // Stack size, same as the display task which builds sections too
+                this,                // Parameters
+                0,                   // Priority: only gets the CPU while input and display tasks are idle
+                &indexingTaskHandle  // Task handle
+    );
+  }
 }
 
 void EpubReaderActivity::onExit() {
@@ -124,14 +177,24 @@ void EpubReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
+  // Counts as input, so a background build in progress gives up the mutex at its next check
+  lastInputTime = millis();
+
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
   }
+  if (indexingTaskHandle) {
+    vTaskDelete(indexingTaskHandle);
+    indexingTaskHandle = nullptr;
+  }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  renderer.releaseOffscreen();
+  renderer.releaseGrayscalePlanes();
+  renderer.releaseGlyphCache();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   section.reset();
@@ -139,6 +202,11 @@ void EpubReaderActivity::onExit() {
 }
 
 void EpubReaderActivity::loop() {
+  // Any button activity pauses background indexing, including input handled by a subactivity
+  if (mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased()) {
+    lastInputTime = millis();
+  }
+
   // Pass input responsibility to sub activity if exists
   if (subActivity) {
     subActivity->loop();
@@ -189,11 +257,10 @@ void EpubReaderActivity::loop() {
     // Don't start activity transition while rendering
     xSemaphoreTake(renderingMutex, portMAX_DELAY);
     const int currentPage = section ? section->currentPage + 1 : 0;
-    const int totalPages = section ? section->pageCount : 0;
+    const int totalPages = knownPageCount();
     float bookProgress = 0.0f;
-    if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
-      const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-      bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
+    if (epub && epub->getBookSize() > 0 && section) {
+      bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress()) * 100.0f;
     }
     const int bookProgressPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
     exitActivity();
@@ -233,6 +300,7 @@ void EpubReaderActivity::loop() {
   if (!prevTriggered && !nextTriggered) {
     return;
   }
+  lastTurnBackward = prevTriggered;
 
   // any botton press when at end of the book goes back to the last page
   if (currentSpineIndex > 0 && currentSpineIndex >= epub->getSpineItemsCount()) {
@@ -274,7 +342,8 @@ void EpubReaderActivity::loop() {
     }
     updateRequired = true;
   } else {
-    if (section->currentPage < section->pageCount - 1) {
+    // A chapter that is still being laid out may have more pages than pageCount says so far
+    if (section->currentPage < section->pageCount - 1 || section->isBuilding()) {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
@@ -363,7 +432,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     case EpubReaderMenuActivity::MenuAction::SELECT_CHAPTER: {
       // Calculate values BEFORE we start destroying things
       const int currentP = section ? section->currentPage : 0;
-      const int totalP = section ? section->pageCount : 0;
+      const int totalP = knownPageCount();
       const int spineIdx = currentSpineIndex;
       const std::string path = epub->getPath();
 
@@ -404,9 +473,8 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     case EpubReaderMenuActivity::MenuAction::GO_TO_PERCENT: {
       // Launch the slider-based percent selector and return here on confirm/cancel.
       float bookProgress = 0.0f;
-      if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
-        const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-        bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
+      if (epub && epub->getBookSize() > 0 && section) {
+        bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress()) * 100.0f;
       }
       const int initialPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
@@ -439,7 +507,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
         // We use the current variables that track our position
         uint16_t backupSpine = currentSpineIndex;
         uint16_t backupPage = section->currentPage;
-        uint16_t backupPageCount = section->pageCount;
+        uint16_t backupPageCount = knownPageCount();
 
         section.reset();
         // 3. WIPE: Clear the cache directory
@@ -458,6 +526,15 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     case EpubReaderMenuActivity::MenuAction::SYNC: {
       if (KOREADER_STORE.hasCredentials()) {
         xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        // The position sent is relative to the chapter's length, so finish laying it out first
+        if (section && section->isBuilding()) {
+          GUI.drawPopup(renderer, "Indexing...");
+          if (!section->continueSectionFile(-1)) {
+            Serial.printf("[%lu] [ERS] Section build failed before sync\n", millis());
+            section.reset();
+          }
+          sectionBuildPending = false;
+        }
         const int currentPage = section ? section->currentPage : 0;
         const int totalPages = section ? section->pageCount : 0;
         exitActivity();
@@ -493,7 +570,7 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   if (section) {
     cachedSpineIndex = currentSpineIndex;
-    cachedChapterTotalPageCount = section->pageCount;
+    cachedChapterTotalPageCount = knownPageCount();
     nextPageNumber = section->currentPage;
   }
 
@@ -516,11 +593,211 @@ void EpubReaderActivity::displayTaskLoop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       renderScreen();
       xSemaphoreGive(renderingMutex);
+    } else if (prefetchPending) {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      prefetchPending = false;
+      prefetchAdjacentPages();
+      prerenderPending = true;
+      xSemaphoreGive(renderingMutex);
+    } else if (prerenderPending) {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      prerenderPending = false;
+      prerenderAdjacentPage();
+      xSemaphoreGive(renderingMutex);
+    } else if (sectionBuildPending) {
+      // Lay out a little more of the open chapter, then let input and rendering back in
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      const bool wasBuilding = section && section->isBuilding();
+      if (wasBuilding) {
+        makeRoomForSectionBuild();
+      }
+      if (section && section->isBuilding() && !section->continueSectionFile(-1, sectionBuildChunksPerTurn)) {
+        Serial.printf("[%lu] [ERS] Section build failed in the background\n", millis());
+        section.reset();
+      }
+      sectionBuildPending = section && section->isBuilding();
+      if (wasBuilding && section && !sectionBuildPending) {
+        // The page count is final now: save it with the position and show it in the status bar
+        saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+        updateRequired = !subActivity;
+      }
+      xSemaphoreGive(renderingMutex);
     }
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
 }
 
+bool EpubReaderActivity::indexingCancelled() const { return millis() - lastInputTime < indexingIdleMs; }
+
+// Pre-builds the sections around the current chapter so crossing a chapter boundary only has to load a page.
+// Runs one chapter at a time under renderingMutex, which keeps it off the renderer, the SD card and the book's
+// inflate buffers while the display task is using them.
+void EpubReaderActivity::indexingTaskLoop() {
+  while (true) {
+    vTaskDelay(indexingPollMs / portTICK_PERIOD_MS);
+    if (subActivity || updateRequired || sectionBuildPending || indexingCancelled() || indexingCenterSpineIndex < 0 ||
+        indexingNextSlot >= SETTINGS.preindexChapters * 2) {
+      continue;
+    }
+
+    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    if (!indexingCancelled()) {
+      indexNextNeighbour();
+    }
+    xSemaphoreGive(renderingMutex);
+  }
+}
+
+// Builds the nearest neighbour of indexingCenterSpineIndex that has no usable section file yet.
+// Must be called with renderingMutex held.
+void EpubReaderActivity::indexNextNeighbour() {
+  if (!epub) {
+    return;
+  }
+
+  const int spineCount = epub->getSpineItemsCount();
+  while (indexingNextSlot < SETTINGS.preindexChapters * 2) {
+    // Nearest first, forward before backward: +1, -1, +2, -2
+    const int distance = indexingNextSlot / 2 + 1;
+    const int spineIndex = indexingCenterSpineIndex + (indexingNextSlot % 2 == 0 ? distance : -distance);
+    if (spineIndex < 0 || spineIndex >= spineCount) {
+      indexingNextSlot++;
+      continue;
+    }
+
+    Section neighbour(epub, spineIndex, renderer);
+    if (neighbour.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                  SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, shownViewportWidth,
+                                  shownViewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle)) {
+      indexingNextSlot++;
+      continue;
+    }
+
+    Serial.printf("[%lu] [ERS] Background indexing spine %d\n", millis(), spineIndex);
+    makeRoomForSectionBuild();
+    const auto start = millis();
+    if (neighbour.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                    SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, shownViewportWidth,
+                                    shownViewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                    nullptr, [this] { return indexingCancelled(); })) {
+      Serial.printf("[%lu] [ERS] Background indexed spine %d (%d pages) in %lums\n", millis(), spineIndex,
+                    neighbour.pageCount, millis() - start);
+      indexingNextSlot++;
+    } else if (indexingCancelled()) {
+      // Keep the slot so this chapter's build resumes once the reader is idle again
+      Serial.printf("[%lu] [ERS] Background indexing paused at spine %d\n", millis(), spineIndex);
+    } else {
+      Serial.printf("[%lu] [ERS] Background indexing failed for spine %d\n", millis(), spineIndex);
+      indexingNextSlot++;
+    }
+    // One build per call so a pending render can take the mutex in between
+    return;
+  }
+}
+
+// The off-screen canvas, the grayscale planes and the inflated glyphs only check the heap when they are allocated and
+// then stay put, so a build that grows afterwards could run out. Must be called with renderingMutex held.
+void EpubReaderActivity::makeRoomForSectionBuild() {
+  if (ESP.getFreeHeap() >= sectionBuildHeapReserve) {
+    return;
+  }
+  renderer.releaseOffscreen();
+  renderer.releaseGrayscalePlanes();
+  renderer.releaseGlyphCache();
+  Serial.printf("[%lu] [ERS] Released draw-ahead buffers for section build, %lu bytes free\n", millis(),
+                static_cast<unsigned long>(ESP.getFreeHeap()));
+}
+
+void EpubReaderActivity::prefetchAdjacentPages() {
+  if (!section || section->pageCount == 0) {
+    return;
+  }
+
+  prefetchPage(currentSpineIndex, section->currentPage + 1);
+  if (lastTurnBackward) {
+    prefetchPage(currentSpineIndex, section->currentPage - 1);
+  }
+}
+
+// Pages past either end of the section come from the neighbouring chapter, but only if it has already been built
+void EpubReaderActivity::prefetchPage(const int spineIndex, const int page) {
+  if (page >= 0 && page < section->pageCount) {
+    if (!pageCache.contains(spineIndex, page) && section->loadPageView(page, prefetchView)) {
+      pageCache.insert(spineIndex, page, prefetchView);
+    }
+    return;
+  }
+  if (page >= 0 && section->isBuilding()) {
+    // Not laid out yet
+    return;
+  }
+
+  const int neighbourSpineIndex = page < 0 ? spineIndex - 1 : spineIndex + 1;
+  if (neighbourSpineIndex < 0 || neighbourSpineIndex >= epub->getSpineItemsCount() ||
+      (page >= 0 && pageCache.contains(neighbourSpineIndex, 0))) {
+    return;
+  }
+
+  Section neighbour(epub, neighbourSpineIndex, renderer);
+  if (!neighbour.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                 SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, shownViewportWidth,
+                                 shownViewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle) ||
+      neighbour.pageCount == 0) {
+    return;
+  }
+  const int neighbourPage = page < 0 ? neighbour.pageCount - 1 : 0;
+  if (!pageCache.contains(neighbourSpineIndex, neighbourPage) && neighbour.loadPageView(neighbourPage, prefetchView)) {
+    pageCache.insert(neighbourSpineIndex, neighbourPage, prefetchView);
+  }
+}
+
+// Draws the page the reader is likely to turn to next into the renderer's off-screen canvas, so that turn only has to
+// copy it into the frame buffer. Works from the prefetched pages; going back into the previous chapter isn't covered
+// because its page count isn't known here. Skipped when the heap can't spare the canvas.
+void EpubReaderActivity::prerenderAdjacentPage() {
+  // A subactivity draws from its own task, which must not find the frame buffer redirected
+  if (subActivity || !section || section->pageCount == 0) {
+    return;
+  }
+
+  int spineIndex = currentSpineIndex;
+  int page = section->currentPage + (lastTurnBackward ? -1 : 1);
+  if (page < 0) {
+    return;
+  }
+  if (page >= section->pageCount) {
+    if (section->isBuilding()) {
+      return;
+    }
+    spineIndex++;
+    page = 0;
+  }
+
+  const PageView* view = pageCache.peek(spineIndex, page);
+  if (!view && spineIndex == currentSpineIndex && section->loadPageView(page, prefetchView)) {
+    // Too large for the cache, but can still be drawn
+    view = &prefetchView;
+  }
+  if (!view) {
+    return;
+  }
+
+  if (!renderer.beginOffscreen()) {
+    return;
+  }
+  const auto start = millis();
+  renderer.clearScreen();
+  if (SETTINGS.textAntiAliasing) {
+    renderer.beginGrayscalePlanes();
+  }
+  view->render(renderer, SETTINGS.getReaderFontId(), shownMarginLeft, shownMarginTop);
+  renderer.endGrayscalePlanes();
+  renderer.endOffscreen(pageCanvasTag(pageLayoutKey(shownViewportWidth, shownViewportHeight), renderer.getOrientation(),
+                                      shownMarginTop, shownMarginLeft, spineIndex, page));
+  Serial.printf("[%lu] [ERS] Drew spine %d page %d off-screen in %lums\n", millis(), spineIndex, page,
+                millis() - start);
+}
+
 // TODO: Failure handling
 void EpubReaderActivity::renderScreen() {
   if (!epub) {
@@ -565,24 +842,33 @@ void EpubReaderActivity::renderScreen() {
                             (showProgressBar ? (metrics.bookProgressBarHeight + progressBarMarginTop) : 0);
   }
 
+  const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+  const uint32_t layoutKey = pageLayoutKey(viewportWidth, viewportHeight);
+  pageCache.setLayout(layoutKey);
+
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     Serial.printf("[%lu] [ERS] Loading file: %s, index: %d\n", millis(), filepath.c_str(), currentSpineIndex);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
 
-    const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
-    const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
-
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                   viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle)) {
       Serial.printf("[%lu] [ERS] Cache not found, building...\n", millis());
 
+      // Opening at a known page only has to wait for that page, the rest is laid out after it is shown. Jumping to
+      // the last page or to a relative position needs the final page count.
+      const bool needsPageCount = nextPageNumber == UINT16_MAX || pendingPercentJump ||
+                                  (cachedChapterTotalPageCount > 0 && currentSpineIndex == cachedSpineIndex);
       const auto popupFn = [this]() { GUI.drawPopup(renderer, "Indexing..."); };
+      makeRoomForSectionBuild();
 
-      if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
-                                      SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
-                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, popupFn)) {
+      if (!section->beginSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                     SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                     viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
+                                     needsPageCount || nextPageNumber > 0 ? popupFn : std::function<void()>()) ||
+          !section->continueSectionFile(needsPageCount ? -1 : nextPageNumber)) {
         Serial.printf("[%lu] [ERS] Failed to persist page data to SD\n", millis());
         section.reset();
         return;
@@ -619,6 +905,22 @@ void EpubReaderActivity::renderScreen() {
     }
   }
 
+  if (section->isBuilding() && section->currentPage >= section->pageCount) {
+    // Turned past the pages laid out so far; wait for this one
+    if (!section->continueSectionFile(section->currentPage)) {
+      Serial.printf("[%lu] [ERS] Failed to build page %d\n", millis(), section->currentPage);
+      section.reset();
+      return;
+    }
+    if (!section->isBuilding() && section->pageCount > 0 && section->currentPage == section->pageCount) {
+      // The chapter ended on the previous page, so this turn moves on to the next chapter
+      nextPageNumber = 0;
+      currentSpineIndex++;
+      section.reset();
+      return renderScreen();
+    }
+  }
+
   renderer.clearScreen();
 
   if (section->pageCount == 0) {
@@ -638,18 +940,49 @@ void EpubReaderActivity::renderScreen() {
   }
 
   {
-    auto p = section->loadPageFromSectionFile();
-    if (!p) {
+    if (pageCache.take(currentSpineIndex, section->currentPage, pageView)) {
+      Serial.printf("[%lu] [ERS] Page %d served from prefetch cache\n", millis(), section->currentPage);
+    } else if (!section->loadPageView(pageView)) {
+      if (section->isBuilding() && section->continueSectionFile(-1)) {
+        // Reading back through the build's file handle failed; the finished file is read the normal way
+        return renderScreen();
+      }
       Serial.printf("[%lu] [ERS] Failed to load page from SD - clearing section cache\n", millis());
       section->clearCache();
       section.reset();
+      pageCache.clear();
       return renderScreen();
     }
     const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    renderContents(pageView, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft,
+                   pageCanvasTag(layoutKey, renderer.getOrientation(), orientedMarginTop, orientedMarginLeft,
+                                 currentSpineIndex, section->currentPage));
     Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(), millis() - start);
   }
-  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+  // The page count is only final once the build is done; 0 keeps it from being used to remap the saved position
+  saveProgress(currentSpineIndex, section->currentPage, knownPageCount());
+  sectionBuildPending = section->isBuilding();
+  prefetchPending = true;
+  shownMarginTop = orientedMarginTop;
+  shownMarginLeft = orientedMarginLeft;
+
+  // The page is on screen; point background indexing at this chapter's neighbours
+  if (indexingCenterSpineIndex != currentSpineIndex || shownViewportWidth != viewportWidth ||
+      shownViewportHeight != viewportHeight) {
+    indexingCenterSpineIndex = currentSpineIndex;
+    shownViewportWidth = viewportWidth;
+    shownViewportHeight = viewportHeight;
+    indexingNextSlot = 0;
+  }
+}
+
+// 0 while the chapter is still being laid out: the pages so far are not its length and nothing may be derived from them
+int EpubReaderActivity::knownPageCount() const { return section && !section->isBuilding() ? section->pageCount : 0; }
+
+// Progress through the chapter, counted from its start until its length is known
+float EpubReaderActivity::chapterProgress() const {
+  const int pageCount = knownPageCount();
+  return pageCount > 0 ? static_cast<float>(section->currentPage) / static_cast<float>(pageCount) : 0.0f;
 }
 
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
@@ -669,40 +1002,60 @@ void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageC
     Serial.printf("[ERS] Could not save progress!\n");
   }
 }
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
+void EpubReaderActivity::renderContents(const PageView& page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
-                                        const int orientedMarginLeft) {
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+                                        const int orientedMarginLeft, const uint32_t canvasTag) {
+  // A page drawn ahead of time may come with its gray planes. Otherwise draw it once, filling the planes on the way;
+  // drawing it again over the presented BW changes nothing there.
+  const bool presented = renderer.presentOffscreen(canvasTag);
+  bool planesReady = presented && renderer.grayscalePlanesHold(canvasTag);
+  if (presented) {
+    Serial.printf("[%lu] [ERS] Page drawn ahead of time, copied from off-screen canvas\n", millis());
+  }
+  if (!planesReady) {
+    planesReady = SETTINGS.textAntiAliasing && renderer.beginGrayscalePlanes();
+    if (!presented || planesReady) {
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    }
+    renderer.endGrayscalePlanes();
+  }
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  // The same page drawn again is already on the panel, gray levels included
+  if (renderer.displayChanges(SETTINGS.getRefreshFrequency()) == FrameDiff::SKIP) {
+    return;
+  }
+
+  // 1-bit fonts and pages without anti-aliased edges leave nothing for the gray waveform to do
+  if (!SETTINGS.textAntiAliasing || !renderer.hasGrayCoverage()) {
+    return;
+  }
+
+  if (planesReady) {
+    renderer.copyGrayscalePlanes();
+    renderer.displayGrayBuffer();
+    renderer.cleanupGrayscaleWithFrameBuffer();
+    return;
   }
 
+  // Without the planes every gray plane takes a pass of its own over the page
   // Save bw buffer to reset buffer state after grayscale data sync
   renderer.storeBwBuffer();
 
   // grayscale rendering
-  // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
-
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
-
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
-  }
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleLsbBuffers();
+
+  // Render and copy to MSB buffer
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleMsbBuffers();
+
+  // display grayscale part
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
 
   // restore the bw data
   renderer.restoreBwBuffer();
@@ -736,22 +1089,28 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
   const auto textY = screenHeight - orientedMarginBottom - 4;
   int progressTextWidth = 0;
 
-  // Calculate progress in book
-  const float sectionChapterProg = static_cast<float>(section->currentPage) / section->pageCount;
-  const float bookProgress = epub->calculateProgress(currentSpineIndex, sectionChapterProg) * 100;
+  // Calculate progress in book; the page total is left out until the chapter is fully laid out
+  const int pageCount = knownPageCount();
+  const float bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress()) * 100;
 
   if (showProgressText || showProgressPercentage || showBookPercentage) {
     // Right aligned text for progress counter
     char progressStr[32];
 
+    char pageStr[16];
+    if (pageCount > 0) {
+      snprintf(pageStr, sizeof(pageStr), "%d/%d", section->currentPage + 1, pageCount);
+    } else {
+      snprintf(pageStr, sizeof(pageStr), "%d", section->currentPage + 1);
+    }
+
     // Hide percentage when progress bar is shown to reduce clutter
     if (showProgressPercentage) {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d  %.0f%%", section->currentPage + 1, section->pageCount,
-               bookProgress);
+      snprintf(progressStr, sizeof(progressStr), "%s  %.0f%%", pageStr, bookProgress);
     } else if (showBookPercentage) {
       snprintf(progressStr, sizeof(progressStr), "%.0f%%", bookProgress);
     } else {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d", section->currentPage + 1, section->pageCount);
+      snprintf(progressStr, sizeof(progressStr), "%s", pageStr);
     }
 
     progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
@@ -764,11 +1123,10 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
     GUI.drawReadingProgressBar(renderer, static_cast<size_t>(bookProgress));
   }
 
-  if (showChapterProgressBar) {
+  if (showChapterProgressBar && pageCount > 0) {
     // Draw chapter progress bar at the very bottom of the screen, from edge to edge of viewable area
-    const float chapterProgress =
-        (section->pageCount > 0) ? (static_cast<float>(section->currentPage + 1) / section->pageCount) * 100 : 0;
-    GUI.drawReadingProgressBar(renderer, static_cast<size_t>(chapterProgress));
+    const float chapterPercent = (static_cast<float>(section->currentPage + 1) / pageCount) * 100;
+    GUI.drawReadingProgressBar(renderer, static_cast<size_t>(chapterPercent));
   }
 
   if (showBattery) {
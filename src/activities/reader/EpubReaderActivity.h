@@ -1,5 +1,7 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/Page.h>
+#include <Epub/PageCache.h>
 #include <Epub/Section.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
@@ -11,11 +13,16 @@
 class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  // Reused for every page turn so rendering a page doesn't allocate
+  PageView pageView;
+  // Pages around the one on screen, loaded while the reader is looking at it; prefetchView is their landing buffer
+  PageCache pageCache;
+  PageView prefetchView;
   TaskHandle_t displayTaskHandle = nullptr;
+  TaskHandle_t indexingTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
-  int pagesUntilFullRefresh = 0;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
   // Signals that the next render should reposition within the newly loaded section
@@ -24,18 +31,44 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   // Normalized 0.0-1.0 progress within the target spine item, computed from book percentage.
   float pendingSpineProgress = 0.0f;
   bool updateRequired = false;
+  // Set while the current section is still being laid out; the display task keeps parsing it between renders
+  bool sectionBuildPending = false;
+  // Set after a page is shown until its neighbours have been prefetched
+  bool prefetchPending = false;
+  bool lastTurnBackward = false;
+  // Set after prefetching until the page the reader is likely to turn to has been drawn off-screen
+  bool prerenderPending = false;
   bool pendingSubactivityExit = false;  // Defer subactivity exit to avoid use-after-free
   bool pendingGoHome = false;           // Defer go home to avoid race condition with display task
   bool skipNextButtonCheck = false;     // Skip button processing for one frame after subactivity exit
+  // Background indexing of the chapters around the one on screen, see indexingTaskLoop()
+  int indexingCenterSpineIndex = -1;  // Spine index neighbours are counted from, -1 until a page has been shown
+  int indexingNextSlot = 0;           // Next neighbour to look at; kept when a build is cancelled so it resumes
+  // Viewport of the page on screen, for the work done between renders
+  uint16_t shownViewportWidth = 0;
+  uint16_t shownViewportHeight = 0;
+  int shownMarginTop = 0;
+  int shownMarginLeft = 0;
+  unsigned long lastInputTime = 0;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
   static void taskTrampoline(void* param);
+  static void indexingTaskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
+  [[noreturn]] void indexingTaskLoop();
+  bool indexingCancelled() const;
+  void indexNextNeighbour();
+  void makeRoomForSectionBuild();
+  void prefetchAdjacentPages();
+  void prefetchPage(int spineIndex, int page);
+  void prerenderAdjacentPage();
   void renderScreen();
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
-                      int orientedMarginBottom, int orientedMarginLeft);
+  void renderContents(const PageView& page, int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                      int orientedMarginLeft, uint32_t canvasTag);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  int knownPageCount() const;
+  float chapterProgress() const;
   void saveProgress(int spineIndex, int currentPage, int pageCount);
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
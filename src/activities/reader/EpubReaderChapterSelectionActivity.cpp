@@ -120,8 +120,6 @@ void EpubReaderChapterSelectionActivity::displayTaskLoop() {
 }
 
 void EpubReaderChapterSelectionActivity::renderScreen() {
-  renderer.clearScreen();
-
   const auto pageWidth = renderer.getScreenWidth();
   const auto orientation = renderer.getOrientation();
   // Landscape orientation: reserve a horizontal gutter for button hints.
@@ -138,20 +136,32 @@ void EpubReaderChapterSelectionActivity::renderScreen() {
   const int pageItems = getPageItems();
   const int totalItems = getTotalItems();
 
+  // A cursor move within the page only changes the rows it left and entered
+  const int selected = selectorIndex;
+  const bool cursorOnly = renderedSelectorIndex >= 0 && renderedSelectorIndex != selected &&
+                          renderedSelectorIndex / pageItems == selected / pageItems;
+  if (cursorOnly) {
+    const int firstRow = std::min(renderedSelectorIndex, selected) % pageItems;
+    const int lastRow = std::max(renderedSelectorIndex, selected) % pageItems;
+    renderer.setClipRect(contentX, 60 + contentY + firstRow * 30 - 2, contentWidth, (lastRow - firstRow + 1) * 30);
+  }
+
+  renderer.clearScreen();
+
   // Manual centering to honor content gutters.
   const int titleX =
       contentX + (contentWidth - renderer.getTextWidth(UI_12_FONT_ID, "Go to Chapter", EpdFontFamily::BOLD)) / 2;
   renderer.drawText(UI_12_FONT_ID, titleX, 15 + contentY, "Go to Chapter", true, EpdFontFamily::BOLD);
 
-  const auto pageStartIndex = selectorIndex / pageItems * pageItems;
+  const auto pageStartIndex = selected / pageItems * pageItems;
   // Highlight only the content area, not the hint gutters.
-  renderer.fillRect(contentX, 60 + contentY + (selectorIndex % pageItems) * 30 - 2, contentWidth - 1, 30);
+  renderer.fillRect(contentX, 60 + contentY + (selected % pageItems) * 30 - 2, contentWidth - 1, 30);
 
   for (int i = 0; i < pageItems; i++) {
     int itemIndex = pageStartIndex + i;
     if (itemIndex >= totalItems) break;
     const int displayY = 60 + contentY + i * 30;
-    const bool isSelected = (itemIndex == selectorIndex);
+    const bool isSelected = (itemIndex == selected);
 
     auto item = epub->getTocItem(itemIndex);
 
@@ -166,5 +176,11 @@ void EpubReaderChapterSelectionActivity::renderScreen() {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "Up", "Down");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  if (cursorOnly) {
+    renderer.clearClipRect();
+    renderer.displayDirtyRegion();
+  } else {
+    renderer.displayBuffer();
+  }
+  renderedSelectorIndex = selected;
 }
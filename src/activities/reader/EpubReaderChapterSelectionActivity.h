@@ -19,6 +19,8 @@ class EpubReaderChapterSelectionActivity final : public ActivityWithSubactivity
   int currentPage = 0;
   int totalPagesInSpine = 0;
   int selectorIndex = 0;
+  // Selection on screen, -1 until the first render
+  int renderedSelectorIndex = -1;
   bool updateRequired = false;
   const std::function<void()> onGoBack;
   const std::function<void(int newSpineIndex)> onSelectSpineIndex;
@@ -87,25 +87,33 @@ void EpubReaderPercentSelectionActivity::loop() {
 }
 
 void EpubReaderPercentSelectionActivity::renderScreen() {
+  const int screenWidth = renderer.getScreenWidth();
+  constexpr int percentY = 90;
+  constexpr int barWidth = 360;
+  constexpr int barHeight = 16;
+  const int barX = (screenWidth - barWidth) / 2;
+  const int barY = 140;
+
+  // Changing the percent only touches the band from the value down to the bottom of the knob.
+  const int value = percent;
+  const bool sliderOnly = renderedPercent >= 0 && renderedPercent != value;
+  if (sliderOnly) {
+    renderer.setClipRect(0, percentY - 2, screenWidth, barY + barHeight + 6 - percentY);
+  }
+
   renderer.clearScreen();
 
   // Title and numeric percent value.
   renderer.drawCenteredText(UI_12_FONT_ID, 15, "Go to Position", true, EpdFontFamily::BOLD);
 
-  const std::string percentText = std::to_string(percent) + "%";
-  renderer.drawCenteredText(UI_12_FONT_ID, 90, percentText.c_str(), true, EpdFontFamily::BOLD);
+  const std::string percentText = std::to_string(value) + "%";
+  renderer.drawCenteredText(UI_12_FONT_ID, percentY, percentText.c_str(), true, EpdFontFamily::BOLD);
 
   // Draw slider track.
-  const int screenWidth = renderer.getScreenWidth();
-  constexpr int barWidth = 360;
-  constexpr int barHeight = 16;
-  const int barX = (screenWidth - barWidth) / 2;
-  const int barY = 140;
-
   renderer.drawRect(barX, barY, barWidth, barHeight);
 
   // Fill slider based on percent.
-  const int fillWidth = (barWidth - 4) * percent / 100;
+  const int fillWidth = (barWidth - 4) * value / 100;
   if (fillWidth > 0) {
     renderer.fillRect(barX + 2, barY + 2, fillWidth, barHeight - 4);
   }
@@ -121,5 +129,11 @@ void EpubReaderPercentSelectionActivity::renderScreen() {
   const auto labels = mappedInput.mapLabels("« Back", "Select", "-", "+");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  renderer.displayBuffer();
+  if (sliderOnly) {
+    renderer.clearClipRect();
+    renderer.displayDirtyRegion();
+  } else {
+    renderer.displayBuffer();
+  }
+  renderedPercent = value;
 }
@@ -27,6 +27,8 @@ class EpubReaderPercentSelectionActivity final : public ActivityWithSubactivity
  private:
   // Current percent value (0-100) shown on the slider.
   int percent = 0;
+  // Percent on screen, -1 until the first render.
+  int renderedPercent = -1;
   // Render dirty flag for the task loop.
   bool updateRequired = false;
   // FreeRTOS task and mutex for rendering.
@@ -89,8 +89,13 @@ void TxtReaderActivity::onExit() {
   }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  renderer.releaseOffscreen();
+  renderer.releaseGrayscalePlanes();
+  renderer.releaseGlyphCache();
   pageOffsets.clear();
   currentPageLines.clear();
+  prerenderedPageLines.clear();
+  prerenderedPage = -1;
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   txt.reset();
@@ -134,9 +139,11 @@ void TxtReaderActivity::loop() {
 
   if (prevTriggered && currentPage > 0) {
     currentPage--;
+    lastTurnBackward = true;
     updateRequired = true;
   } else if (nextTriggered && currentPage < totalPages - 1) {
     currentPage++;
+    lastTurnBackward = false;
     updateRequired = true;
   }
 }
@@ -148,6 +155,11 @@ void TxtReaderActivity::displayTaskLoop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       renderScreen();
       xSemaphoreGive(renderingMutex);
+    } else if (prerenderPending) {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      prerenderPending = false;
+      prerenderAdjacentPage();
+      xSemaphoreGive(renderingMutex);
     }
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
@@ -394,17 +406,52 @@ void TxtReaderActivity::renderScreen() {
   if (currentPage < 0) currentPage = 0;
   if (currentPage >= totalPages) currentPage = totalPages - 1;
 
-  // Load current page content
-  size_t offset = pageOffsets[currentPage];
-  size_t nextOffset;
-  currentPageLines.clear();
-  loadPageAtOffset(offset, currentPageLines, nextOffset);
+  // Load current page content, unless it was loaded ahead of time
+  if (prerenderedPage == currentPage) {
+    std::swap(currentPageLines, prerenderedPageLines);
+  } else {
+    size_t offset = pageOffsets[currentPage];
+    size_t nextOffset;
+    currentPageLines.clear();
+    loadPageAtOffset(offset, currentPageLines, nextOffset);
+  }
+  prerenderedPage = -1;
 
   renderer.clearScreen();
   renderPage();
 
   // Save progress
   saveProgress();
+  prerenderPending = true;
+}
+
+// Loads the page the reader is likely to turn to next and draws it into the renderer's off-screen canvas, so that
+// turn only has to copy it into the frame buffer. Without the canvas the lines are still read ahead.
+void TxtReaderActivity::prerenderAdjacentPage() {
+  const int page = currentPage + (lastTurnBackward ? -1 : 1);
+  if (page < 0 || page >= totalPages || page == prerenderedPage) {
+    return;
+  }
+
+  size_t nextOffset;
+  prerenderedPageLines.clear();
+  if (!loadPageAtOffset(pageOffsets[page], prerenderedPageLines, nextOffset)) {
+    prerenderedPage = -1;
+    return;
+  }
+  prerenderedPage = page;
+
+  if (!renderer.beginOffscreen()) {
+    return;
+  }
+  renderer.clearScreen();
+  if (SETTINGS.textAntiAliasing) {
+    renderer.beginGrayscalePlanes();
+  }
+  renderLines(prerenderedPageLines);
+  renderer.endGrayscalePlanes();
+  // The page number is enough of a tag, the canvas is released whenever the reader exits
+  renderer.endOffscreen(page + 1);
 }
 
 void TxtReaderActivity::renderPage() {
@@ -416,76 +463,98 @@ void TxtReaderActivity::renderPage() {
   orientedMarginRight += cachedScreenMargin;
   orientedMarginBottom += statusBarMargin;
 
-  const int lineHeight = renderer.getLineHeight(cachedFontId);
-  const int contentWidth = viewportWidth;
-
-  // Render text lines with alignment
-  auto renderLines = [&]() {
-    int y = orientedMarginTop;
-    for (const auto& line : currentPageLines) {
-      if (!line.empty()) {
-        int x = orientedMarginLeft;
-
-        // Apply text alignment
-        switch (cachedParagraphAlignment) {
-          case CrossPointSettings::LEFT_ALIGN:
-          default:
-            // x already set to left margin
-            break;
-          case CrossPointSettings::CENTER_ALIGN: {
-            int textWidth = renderer.getTextWidth(cachedFontId, line.c_str());
-            x = orientedMarginLeft + (contentWidth - textWidth) / 2;
-            break;
-          }
-          case CrossPointSettings::RIGHT_ALIGN: {
-            int textWidth = renderer.getTextWidth(cachedFontId, line.c_str());
-            x = orientedMarginLeft + contentWidth - textWidth;
-            break;
-          }
-          case CrossPointSettings::JUSTIFIED:
-            // For plain text, justified is treated as left-aligned
-            // (true justification would require word spacing adjustments)
-            break;
-        }
-
-        renderer.drawText(cachedFontId, x, y, line.c_str());
-      }
-      y += lineHeight;
+  // A page drawn ahead of time may come with its gray planes. Otherwise draw it once, filling the planes on the way;
+  // drawing it again over the presented BW changes nothing there.
+  const bool presented = renderer.presentOffscreen(currentPage + 1);
+  bool planesReady = presented && renderer.grayscalePlanesHold(currentPage + 1);
+  if (!planesReady) {
+    planesReady = SETTINGS.textAntiAliasing && renderer.beginGrayscalePlanes();
+    if (!presented || planesReady) {
+      renderLines(currentPageLines);
     }
-  };
-
-  // First pass: BW rendering
-  renderLines();
+    renderer.endGrayscalePlanes();
+  }
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  // The same page drawn again is already on the panel, gray levels included
+  if (renderer.displayChanges(SETTINGS.getRefreshFrequency()) == FrameDiff::SKIP) {
+    return;
   }
 
-  // Grayscale rendering pass (for anti-aliased fonts)
-  if (SETTINGS.textAntiAliasing) {
-    // Save BW buffer for restoration after grayscale pass
-    renderer.storeBwBuffer();
+  // 1-bit fonts and pages without anti-aliased edges leave nothing for the gray waveform to do
+  if (!SETTINGS.textAntiAliasing || !renderer.hasGrayCoverage()) {
+    return;
+  }
 
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    renderLines();
-    renderer.copyGrayscaleLsbBuffers();
+  if (planesReady) {
+    renderer.copyGrayscalePlanes();
+    renderer.displayGrayBuffer();
+    renderer.cleanupGrayscaleWithFrameBuffer();
+    return;
+  }
 
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    renderLines();
-    renderer.copyGrayscaleMsbBuffers();
+  // Grayscale rendering pass (for anti-aliased fonts), one render per plane when the planes couldn't be allocated
+  // Save BW buffer for restoration after grayscale pass
+  renderer.storeBwBuffer();
 
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  renderLines(currentPageLines);
+  renderer.copyGrayscaleLsbBuffers();
+
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  renderLines(currentPageLines);
+  renderer.copyGrayscaleMsbBuffers();
+
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  // Restore BW buffer
+  renderer.restoreBwBuffer();
+}
 
-    // Restore BW buffer
-    renderer.restoreBwBuffer();
+// Render text lines with alignment
+void TxtReaderActivity::renderLines(const std::vector<std::string>& lines) const {
+  int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
+  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
+                                   &orientedMarginLeft);
+  orientedMarginTop += cachedScreenMargin;
+  orientedMarginLeft += cachedScreenMargin;
+
+  const int lineHeight = renderer.getLineHeight(cachedFontId);
+  const int contentWidth = viewportWidth;
+
+  int y = orientedMarginTop;
+  for (const auto& line : lines) {
+    if (!line.empty()) {
+      int x = orientedMarginLeft;
+
+      // Apply text alignment
+      switch (cachedParagraphAlignment) {
+        case CrossPointSettings::LEFT_ALIGN:
+        default:
+          // x already set to left margin
+          break;
+        case CrossPointSettings::CENTER_ALIGN: {
+          int textWidth = renderer.getTextWidth(cachedFontId, line.c_str());
+          x = orientedMarginLeft + (contentWidth - textWidth) / 2;
+          break;
+        }
+        case CrossPointSettings::RIGHT_ALIGN: {
+          int textWidth = renderer.getTextWidth(cachedFontId, line.c_str());
+          x = orientedMarginLeft + contentWidth - textWidth;
+          break;
+        }
+        case CrossPointSettings::JUSTIFIED:
+          // For plain text, justified is treated as left-aligned
+          // (true justification would require word spacing adjustments)
+          break;
+      }
+
+      renderer.drawText(cachedFontId, x, y, line.c_str());
+    }
+    y += lineHeight;
   }
 }
 
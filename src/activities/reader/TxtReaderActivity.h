@@ -16,14 +16,19 @@ class TxtReaderActivity final : public ActivityWithSubactivity {
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentPage = 0;
   int totalPages = 1;
-  int pagesUntilFullRefresh = 0;
   bool updateRequired = false;
+  // Set after a page is shown until the page the reader is likely to turn to has been drawn off-screen
+  bool prerenderPending = false;
+  bool lastTurnBackward = false;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
   // Streaming text reader - stores file offsets for each page
   std::vector<size_t> pageOffsets;  // File offset for start of each page
   std::vector<std::string> currentPageLines;
+  // Lines of the page drawn off-screen ahead of time, -1 when there is none
+  std::vector<std::string> prerenderedPageLines;
+  int prerenderedPage = -1;
   int linesPerPage = 0;
   int viewportWidth = 0;
   bool initialized = false;
@@ -37,6 +42,8 @@ class TxtReaderActivity final : public ActivityWithSubactivity {
   [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
+  void renderLines(const std::vector<std::string>& lines) const;
+  void prerenderAdjacentPage();
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
 
   void initializeReader();
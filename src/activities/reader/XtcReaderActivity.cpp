@@ -70,6 +70,7 @@ void XtcReaderActivity::onExit() {
   }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  renderer.releaseOffscreen();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   xtc.reset();
@@ -148,12 +149,14 @@ void XtcReaderActivity::loop() {
     } else {
       currentPage = 0;
     }
+    lastTurnBackward = true;
     updateRequired = true;
   } else if (nextTriggered) {
     currentPage += skipAmount;
     if (currentPage >= xtc->getPageCount()) {
       currentPage = xtc->getPageCount();  // Allow showing "End of book"
     }
+    lastTurnBackward = false;
     updateRequired = true;
   }
 }
@@ -165,6 +168,11 @@ void XtcReaderActivity::displayTaskLoop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       renderScreen();
       xSemaphoreGive(renderingMutex);
+    } else if (prerenderPending) {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      prerenderPending = false;
+      prerenderAdjacentPage();
+      xSemaphoreGive(renderingMutex);
     }
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
@@ -186,25 +194,117 @@ void XtcReaderActivity::renderScreen() {
 
   renderPage();
   saveProgress();
+  prerenderPending = true;
 }
 
-void XtcReaderActivity::renderPage() {
+size_t XtcReaderActivity::getPageBufferSize() const {
   const uint16_t pageWidth = xtc->getPageWidth();
   const uint16_t pageHeight = xtc->getPageHeight();
-  const uint8_t bitDepth = xtc->getBitDepth();
 
-  // Calculate buffer size for one page
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t pageBufferSize;
-  if (bitDepth == 2) {
-    pageBufferSize = ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
-  } else {
-    pageBufferSize = ((pageWidth + 7) / 8) * pageHeight;
+  if (xtc->getBitDepth() == 2) {
+    return ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
+  }
+  return ((pageWidth + 7) / 8) * pageHeight;
+}
+
+// Draws every pixel of the page that isn't white as black, on top of a cleared screen
+void XtcReaderActivity::drawBwPage(const uint8_t* pageBuffer) const {
+  const uint16_t pageWidth = xtc->getPageWidth();
+  const uint16_t pageHeight = xtc->getPageHeight();
+
+  if (xtc->getBitDepth() == 2) {
+    // Column-major bit planes, columns right to left, MSB = topmost pixel; non-white wherever either plane is set
+    const size_t planeSize = (static_cast<size_t>(pageWidth) * pageHeight + 7) / 8;
+    const uint8_t* plane1 = pageBuffer;
+    const uint8_t* plane2 = pageBuffer + planeSize;
+    const size_t colBytes = (pageHeight + 7) / 8;
+
+    for (uint16_t y = 0; y < pageHeight; y++) {
+      for (uint16_t x = 0; x < pageWidth; x++) {
+        const size_t byteOffset = (pageWidth - 1 - x) * colBytes + y / 8;
+        const size_t bitInByte = 7 - (y % 8);
+        if (((plane1[byteOffset] | plane2[byteOffset]) >> bitInByte) & 1) {
+          renderer.drawPixel(x, y, true);
+        }
+      }
+    }
+    return;
+  }
+
+  // 1-bit mode: 8 pixels per byte, MSB first
+  const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
+
+  for (uint16_t srcY = 0; srcY < pageHeight; srcY++) {
+    const size_t srcRowStart = srcY * srcRowBytes;
+
+    for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
+      // Read source pixel (MSB first, bit 7 = leftmost pixel)
+      const size_t srcByte = srcRowStart + srcX / 8;
+      const size_t srcBit = 7 - (srcX % 8);
+      const bool isBlack = !((pageBuffer[srcByte] >> srcBit) & 1);  // XTC: 0 = black, 1 = white
+
+      if (isBlack) {
+        renderer.drawPixel(srcX, srcY, true);
+      }
+    }
+  }
+  // White pixels are already cleared by clearScreen()
+}
+
+// Loads the page the reader is likely to turn to next and draws its black and white pass into the renderer's
+// off-screen canvas, so that turn skips the SD card and the per-pixel copy. Skipped when the heap can't hold both the
+// page data and the canvas.
+void XtcReaderActivity::prerenderAdjacentPage() {
+  // A subactivity draws from its own task, which must not find the frame buffer redirected
+  if (subActivity || !xtc) {
+    return;
+  }
+  const uint32_t page = lastTurnBackward ? currentPage - 1 : currentPage + 1;
+  if ((lastTurnBackward && currentPage == 0) || page >= xtc->getPageCount()) {
+    return;
+  }
+
+  const size_t pageBufferSize = getPageBufferSize();
+  uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
+  if (!pageBuffer) {
+    return;
+  }
+  if (xtc->loadPage(page, pageBuffer, pageBufferSize) == 0 || !renderer.beginOffscreen()) {
+    free(pageBuffer);
+    return;
   }
 
-  // Allocate page buffer
+  renderer.clearScreen();
+  drawBwPage(pageBuffer);
+  renderer.endOffscreen(page + 1);
+  free(pageBuffer);
+}
+
+void XtcReaderActivity::renderPage() {
+  const uint16_t pageWidth = xtc->getPageWidth();
+  const uint16_t pageHeight = xtc->getPageHeight();
+  const uint8_t bitDepth = xtc->getBitDepth();
+
+  // A page drawn ahead of time is complete in 1-bit mode; in 2-bit mode its gray planes still need the page data
+  const bool prerendered = renderer.presentOffscreen(currentPage + 1);
+  if (prerendered && bitDepth != 2) {
+    renderer.displayChanges(SETTINGS.getRefreshFrequency());
+    Serial.printf("[%lu] [XTR] Rendered page %lu/%lu from off-screen canvas\n", millis(), currentPage + 1,
+                  xtc->getPageCount());
+    return;
+  }
+
+  // Calculate buffer size for one page
+  const size_t pageBufferSize = getPageBufferSize();
+
+  // Allocate page buffer, letting go of the off-screen canvas if that is what stands in the way
   uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
+  if (!pageBuffer) {
+    renderer.releaseOffscreen();
+    pageBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
+  }
   if (!pageBuffer) {
     Serial.printf("[%lu] [XTR] Failed to allocate page buffer (%lu bytes)\n", millis(), pageBufferSize);
     renderer.clearScreen();
@@ -224,13 +324,13 @@ void XtcReaderActivity::renderPage() {
     return;
   }
 
-  // Clear screen first
-  renderer.clearScreen();
+  // Clear screen first, unless it already holds the page's BW pass
+  if (!prerendered) {
+    renderer.clearScreen();
+  }
 
   // Copy page bitmap using GfxRenderer's drawPixel
   // XTC/XTCH pages are pre-rendered with status bar included, so render full page
-  const uint16_t maxSrcY = pageHeight;
-
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
     // - Columns scanned right to left (x = width-1 down to 0)
@@ -269,21 +369,20 @@ void XtcReaderActivity::renderPage() {
                   pixelCounts[0], pixelCounts[1], pixelCounts[2], pixelCounts[3]);
 
     // Pass 1: BW buffer - draw all non-white pixels as black
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
+    if (!prerendered) {
+      drawBwPage(pageBuffer);
     }
 
-    // Display BW with conditional refresh based on pagesUntilFullRefresh
-    if (pagesUntilFullRefresh <= 1) {
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-      pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-    } else {
-      renderer.displayBuffer();
-      pagesUntilFullRefresh--;
+    // Display BW, refreshing as much as the pixels that changed call for. The same page drawn again is already on
+    // the panel, gray levels included.
+    const bool unchanged = renderer.displayChanges(SETTINGS.getRefreshFrequency()) == FrameDiff::SKIP;
+
+    // Pure black and white page, the BW pass already shows all of it
+    if (unchanged || pixelCounts[1] + pixelCounts[2] == 0) {
+      free(pageBuffer);
+      Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (2-bit, no gray)\n", millis(), currentPage + 1,
+                    xtc->getPageCount());
+      return;
     }
 
     // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
@@ -316,13 +415,7 @@ void XtcReaderActivity::renderPage() {
 
     // Pass 4: Re-render BW to framebuffer (restore for next frame, instead of restoreBwBuffer)
     renderer.clearScreen();
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    drawBwPage(pageBuffer);
 
     // Cleanup grayscale buffers with current frame buffer
     renderer.cleanupGrayscaleWithFrameBuffer();
@@ -333,38 +426,15 @@ void XtcReaderActivity::renderPage() {
                   xtc->getPageCount());
     return;
   } else {
-    // 1-bit mode: 8 pixels per byte, MSB first
-    const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
-
-    for (uint16_t srcY = 0; srcY < maxSrcY; srcY++) {
-      const size_t srcRowStart = srcY * srcRowBytes;
-
-      for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
-        // Read source pixel (MSB first, bit 7 = leftmost pixel)
-        const size_t srcByte = srcRowStart + srcX / 8;
-        const size_t srcBit = 7 - (srcX % 8);
-        const bool isBlack = !((pageBuffer[srcByte] >> srcBit) & 1);  // XTC: 0 = black, 1 = white
-
-        if (isBlack) {
-          renderer.drawPixel(srcX, srcY, true);
-        }
-      }
-    }
+    drawBwPage(pageBuffer);
   }
-  // White pixels are already cleared by clearScreen()
 
   free(pageBuffer);
 
   // XTC pages already have status bar pre-rendered, no need to add our own
 
-  // Display with appropriate refresh
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  // Display with a refresh matching how much changed
+  renderer.displayChanges(SETTINGS.getRefreshFrequency());
 
   Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (%u-bit)\n", millis(), currentPage + 1, xtc->getPageCount(),
                 bitDepth);
@@ -19,8 +19,10 @@ class XtcReaderActivity final : public ActivityWithSubactivity {
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   uint32_t currentPage = 0;
-  int pagesUntilFullRefresh = 0;
   bool updateRequired = false;
+  // Set after a page is shown until the page the reader is likely to turn to has been drawn off-screen
+  bool prerenderPending = false;
+  bool lastTurnBackward = false;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
@@ -28,6 +30,9 @@ class XtcReaderActivity final : public ActivityWithSubactivity {
   [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
+  size_t getPageBufferSize() const;
+  void drawBwPage(const uint8_t* pageBuffer) const;
+  void prerenderAdjacentPage();
   void saveProgress() const;
   void loadProgress();
 
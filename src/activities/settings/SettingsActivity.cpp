@@ -3,6 +3,8 @@
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
 
+#include <algorithm>
+
 #include "ButtonRemapActivity.h"
 #include "CalibreSettingsActivity.h"
 #include "ClearCacheActivity.h"
@@ -136,6 +138,7 @@ void SettingsActivity::loop() {
   });
 
   if (hasChangedCategory) {
+    settingsVersion++;
     selectedSettingIndex = (selectedSettingIndex == 0) ? 0 : 1;
     switch (selectedCategoryIndex) {
       case 0:
@@ -162,6 +165,7 @@ void SettingsActivity::toggleCurrentSetting() {
   }
 
   const auto& setting = (*currentSettings)[selectedSetting];
+  settingsVersion++;
 
   if (setting.type == SettingType::TOGGLE && setting.valuePtr != nullptr) {
     // Toggle the boolean value using the member pointer
@@ -238,13 +242,29 @@ void SettingsActivity::displayTaskLoop() {
   }
 }
 
-void SettingsActivity::render() const {
-  renderer.clearScreen();
-
+void SettingsActivity::render() {
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
 
   auto metrics = UITheme::getInstance().getMetrics();
+  const Rect listRect{
+      0, metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.verticalSpacing, pageWidth,
+      pageHeight - (metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.buttonHintsHeight +
+                    metrics.verticalSpacing * 2)};
+
+  // A cursor move within the page of a list only changes the rows it left and entered. Index 0 is the tab bar.
+  const int selected = selectedSettingIndex;
+  const uint32_t version = settingsVersion;
+  const int pageItems = std::max(1, listRect.height / metrics.listRowHeight);
+  const bool cursorOnly = renderedSettingIndex > 0 && selected > 0 && renderedSettingsVersion == version &&
+                          renderedSettingIndex != selected &&
+                          (renderedSettingIndex - 1) / pageItems == (selected - 1) / pageItems;
+  if (cursorOnly) {
+    const Rect rows = GUI.getListRowsRect(listRect, renderedSettingIndex - 1, selected - 1, false);
+    renderer.setClipRect(rows.x, rows.y, rows.width, rows.height);
+  }
+
+  renderer.clearScreen();
 
   GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, "Settings");
 
@@ -258,12 +278,8 @@ void SettingsActivity::render() const {
 
   const auto& settings = *currentSettings;
   GUI.drawList(
-      renderer,
-      Rect{0, metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.verticalSpacing, pageWidth,
-           pageHeight - (metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.buttonHintsHeight +
-                         metrics.verticalSpacing * 2)},
-      settingsCount, selectedSettingIndex - 1, [&settings](int index) { return std::string(settings[index].name); },
-      nullptr, nullptr,
+      renderer, listRect, settingsCount, selected - 1,
+      [&settings](int index) { return std::string(settings[index].name); }, nullptr, nullptr,
       [&settings](int i) {
         std::string valueText = "";
         if (settings[i].type == SettingType::TOGGLE && settings[i].valuePtr != nullptr) {
@@ -288,5 +304,12 @@ void SettingsActivity::render() const {
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
   // Always use standard refresh for settings screen
-  renderer.displayBuffer();
+  if (cursorOnly) {
+    renderer.clearClipRect();
+    renderer.displayDirtyRegion();
+  } else {
+    renderer.displayBuffer();
+  }
+  renderedSettingIndex = selected;
+  renderedSettingsVersion = version;
 }
@@ -130,6 +130,10 @@ class SettingsActivity final : public ActivityWithSubactivity {
   int selectedCategoryIndex = 0;  // Currently selected category
   int selectedSettingIndex = 0;
   int settingsCount = 0;
+  // Selection on screen and the settings state it was drawn from, bumped on category changes and toggles
+  int renderedSettingIndex = -1;
+  uint32_t settingsVersion = 0;
+  uint32_t renderedSettingsVersion = 0;
 
   // Per-category settings derived from shared list + device-only actions
   std::vector<SettingInfo> displaySettings;
@@ -145,7 +149,7 @@ class SettingsActivity final : public ActivityWithSubactivity {
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
-  void render() const;
+  void render();
   void enterCategory(int categoryIndex);
   void toggleCurrentSetting();
 
@@ -4,6 +4,7 @@
 #include <HalStorage.h>
 #include <Utf8.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -227,6 +228,15 @@ void BaseTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
   }
 }
 
+Rect BaseTheme::getListRowsRect(Rect rect, int firstIndex, int secondIndex, bool hasSubtitle) const {
+  const int rowHeight = hasSubtitle ? BaseMetrics::values.listWithSubtitleRowHeight : BaseMetrics::values.listRowHeight;
+  const int pageItems = rect.height / rowHeight;
+  const int firstRow = std::min(firstIndex % pageItems, secondIndex % pageItems);
+  const int lastRow = std::max(firstIndex % pageItems, secondIndex % pageItems);
+  // Rows start 2px above their text, like the selection
+  return Rect{rect.x, rect.y + firstRow * rowHeight - 2, rect.width, (lastRow - firstRow + 1) * rowHeight};
+}
+
 void BaseTheme::drawHeader(const GfxRenderer& renderer, Rect rect, const char* title) const {
   const bool showBatteryPercentage =
       SETTINGS.hideBatteryPercentage != CrossPointSettings::HIDE_BATTERY_PERCENTAGE::HIDE_ALWAYS;
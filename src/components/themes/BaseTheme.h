@@ -102,6 +102,9 @@ class BaseTheme {
                         const std::function<std::string(int index)>& rowSubtitle,
                         const std::function<std::string(int index)>& rowIcon,
                         const std::function<std::string(int index)>& rowValue) const;
+  // Smallest rectangle holding the rows at firstIndex and secondIndex as drawList() lays them out, for redrawing
+  // just those when the selection moves between them on the same page
+  virtual Rect getListRowsRect(Rect rect, int firstIndex, int secondIndex, bool hasSubtitle) const;
 
   virtual void drawHeader(const GfxRenderer& renderer, Rect rect, const char* title) const;
   virtual void drawTabBar(const GfxRenderer& renderer, Rect rect, const std::vector<TabInfo>& tabs,
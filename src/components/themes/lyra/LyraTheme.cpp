@@ -3,6 +3,7 @@
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -188,6 +189,14 @@ void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
   }
 }
 
+Rect LyraTheme::getListRowsRect(Rect rect, int firstIndex, int secondIndex, bool hasSubtitle) const {
+  const int rowHeight = hasSubtitle ? LyraMetrics::values.listWithSubtitleRowHeight : LyraMetrics::values.listRowHeight;
+  const int pageItems = rect.height / rowHeight;
+  const int firstRow = std::min(firstIndex % pageItems, secondIndex % pageItems);
+  const int lastRow = std::max(firstIndex % pageItems, secondIndex % pageItems);
+  return Rect{rect.x, rect.y + firstRow * rowHeight, rect.width, (lastRow - firstRow + 1) * rowHeight};
+}
+
 void LyraTheme::drawButtonHints(GfxRenderer& renderer, const char* btn1, const char* btn2, const char* btn3,
                                 const char* btn4) const {
   const GfxRenderer::Orientation orig_orientation = renderer.getOrientation();
@@ -45,6 +45,7 @@ class LyraTheme : public BaseTheme {
                 const std::function<std::string(int index)>& rowSubtitle,
                 const std::function<std::string(int index)>& rowIcon,
                 const std::function<std::string(int index)>& rowValue) const override;
+  Rect getListRowsRect(Rect rect, int firstIndex, int secondIndex, bool hasSubtitle) const override;
   void drawButtonHints(GfxRenderer& renderer, const char* btn1, const char* btn2, const char* btn3,
                        const char* btn4) const override;
   void drawSideButtonHints(const GfxRenderer& renderer, const char* topBtn, const char* bottomBtn) const override;
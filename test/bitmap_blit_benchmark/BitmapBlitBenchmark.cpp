@@ -0,0 +1,266 @@
+#include <Bitmap.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Writes 1, 2, 8 and 24-bit BMPs, both top-down and bottom-up, and draws them the way the sleep and home screens do:
+// scaled down to fit, cropped, unscaled and partly off screen. Every case is drawn in each render mode and orientation
+// and compared byte for byte with a per-pixel reference that reads every row and samples the same source pixels, box
+// filtered by the reader where drawBitmap has it box filter. Reports the time per draw and the file reads and seeks
+// it took, next to the reference.
+
+namespace {
+constexpr int ITERATIONS = 20;
+
+struct Case {
+  const char* name;
+  int width;
+  int height;
+  int bpp;
+  bool topDown;
+  int x;
+  int y;
+  int maxWidth;
+  int maxHeight;
+  float cropX;
+  float cropY;
+  bool dithering;
+};
+
+// Luminance with gradients in both directions and some fine detail, so every quantized level shows up
+uint8_t sourceLum(const int x, const int y) { return static_cast<uint8_t>((x * 3 + y * 2) ^ ((x * y) >> 7)); }
+
+std::string writeBmp(const Case& c) {
+  const std::string path = std::string("/tmp/bitmap_blit_") + std::to_string(c.bpp) + "_" + std::to_string(c.width) +
+                           "x" + std::to_string(c.height) + (c.topDown ? "_td" : "_bu") + ".bmp";
+  const int colors = c.bpp <= 8 ? 1 << c.bpp : 0;
+  const int rowBytes = (c.width * c.bpp + 31) / 32 * 4;
+  const uint32_t offBits = 14 + 40 + colors * 4;
+
+  std::vector<uint8_t> out;
+  const auto le16 = [&out](const uint16_t v) {
+    out.push_back(v & 0xFF);
+    out.push_back(v >> 8);
+  };
+  const auto le32 = [&le16](const uint32_t v) {
+    le16(v & 0xFFFF);
+    le16(v >> 16);
+  };
+  le16(0x4D42);
+  le32(offBits + rowBytes * c.height);
+  le32(0);
+  le32(offBits);
+  le32(40);
+  le32(c.width);
+  le32(c.topDown ? -c.height : c.height);
+  le16(1);
+  le16(c.bpp);
+  le32(0);
+  le32(rowBytes * c.height);
+  le32(2835);
+  le32(2835);
+  le32(colors);
+  le32(0);
+  for (int i = 0; i < colors; i++) {
+    const uint8_t lum = i * 255 / (colors - 1);
+    le32(lum * 0x010101u);
+  }
+
+  for (int row = 0; row < c.height; row++) {
+    const int y = c.topDown ? row : c.height - 1 - row;
+    std::vector<uint8_t> bytes(rowBytes, 0);
+    for (int x = 0; x < c.width; x++) {
+      const uint8_t lum = sourceLum(x, y);
+      switch (c.bpp) {
+        case 1:
+          bytes[x / 8] |= (lum >> 7) << (7 - x % 8);
+          break;
+        case 2:
+          bytes[x / 4] |= (lum >> 6) << (6 - x % 4 * 2);
+          break;
+        case 8:
+          bytes[x] = lum;
+          break;
+        default:
+          bytes[x * 3] = lum;
+          bytes[x * 3 + 1] = lum;
+          bytes[x * 3 + 2] = lum;
+          break;
+      }
+    }
+    out.insert(out.end(), bytes.begin(), bytes.end());
+  }
+
+  FILE* f = fopen(path.c_str(), "wb");
+  fwrite(out.data(), 1, out.size(), f);
+  fclose(f);
+  return path;
+}
+
+// The old loop: every row read and every source pixel looked at, with drawPixel for those shown. A source row or
+// column is shown when it is the first to land on its destination row or column. Images the reader can box filter
+// come at the destination size and are drawn unscaled.
+void drawReference(const GfxRenderer& renderer, const Bitmap& bitmap, const Case& c,
+                   const GfxRenderer::RenderMode mode) {
+  const bool blackOnly = bitmap.is1Bit() && c.cropX == 0.0f && c.cropY == 0.0f;
+  float scale = 1.0f;
+  const int cropPixX = std::floor(bitmap.getWidth() * c.cropX / 2.0f);
+  const int cropPixY = std::floor(bitmap.getHeight() * c.cropY / 2.0f);
+  if (c.maxWidth > 0 && (1.0f - c.cropX) * bitmap.getWidth() > c.maxWidth) {
+    scale = static_cast<float>(c.maxWidth) / static_cast<float>((1.0f - c.cropX) * bitmap.getWidth());
+  }
+  if (c.maxHeight > 0 && (1.0f - c.cropY) * bitmap.getHeight() > c.maxHeight) {
+    scale = std::min(scale,
+                     static_cast<float>(c.maxHeight) / static_cast<float>((1.0f - c.cropY) * bitmap.getHeight()));
+  }
+  uint32_t scale16 = std::min<uint32_t>(1u << 16, static_cast<uint32_t>(scale * 65536.0f));
+  const auto toDest = [&scale16](const int src) {
+    return static_cast<int>(static_cast<uint32_t>(src) * scale16 >> 16);
+  };
+  int srcWidth = bitmap.getWidth() - 2 * cropPixX;
+  int srcHeight = bitmap.getHeight() - 2 * cropPixY;
+  int cropLeft = cropPixX;
+  int cropTop = cropPixY;
+  const bool boxFiltered =
+      scale16 < (1u << 16) &&
+      bitmap.setOutputSize(toDest(bitmap.getWidth() - 1) + 1, toDest(bitmap.getHeight() - 1) + 1);
+  if (boxFiltered) {
+    srcWidth = toDest(srcWidth - 1) + 1;
+    srcHeight = toDest(srcHeight - 1) + 1;
+    cropLeft = toDest(cropPixX);
+    cropTop = toDest(cropPixY);
+    scale16 = 1u << 16;
+  }
+  const int imageHeight = bitmap.getOutputHeight();
+
+  std::vector<uint8_t> outputRow((bitmap.getWidth() + 3) / 4);
+  std::vector<uint8_t> rowBytes(bitmap.getRowBytes());
+  for (int bmpY = 0; bmpY < imageHeight; bmpY++) {
+    bitmap.readNextRow(outputRow.data(), rowBytes.data());
+    const int srcY = (bitmap.isTopDown() ? bmpY : imageHeight - 1 - bmpY) - cropTop;
+    if (srcY < 0 || srcY >= srcHeight || (srcY > 0 && toDest(srcY - 1) == toDest(srcY))) continue;
+    const int screenY = c.y + toDest(srcY);
+    if (screenY < 0 || screenY >= renderer.getScreenHeight()) continue;
+
+    for (int srcX = 0; srcX < srcWidth; srcX++) {
+      if (srcX > 0 && toDest(srcX - 1) == toDest(srcX)) continue;
+      const int screenX = c.x + toDest(srcX);
+      if (screenX < 0 || screenX >= renderer.getScreenWidth()) continue;
+      const int bmpX = srcX + cropLeft;
+      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+      if (blackOnly || mode == GfxRenderer::BW) {
+        if (val < 3) renderer.drawPixel(screenX, screenY);
+      } else if (mode == GfxRenderer::GRAYSCALE_MSB && (val == 1 || val == 2)) {
+        renderer.drawPixel(screenX, screenY, false);
+      } else if (mode == GfxRenderer::GRAYSCALE_LSB && val == 1) {
+        renderer.drawPixel(screenX, screenY, false);
+      }
+    }
+  }
+  if (boxFiltered) {
+    bitmap.setOutputSize(bitmap.getWidth(), bitmap.getHeight());
+  }
+}
+
+std::vector<uint8_t> render(GfxRenderer& renderer, const Bitmap& bitmap, const Case& c,
+                            const GfxRenderer::RenderMode mode, const bool reference) {
+  renderer.setRenderMode(mode);
+  bitmap.rewindToData();
+  renderer.clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+  if (reference) {
+    drawReference(renderer, bitmap, c, mode);
+  } else {
+    renderer.drawBitmap(bitmap, c.x, c.y, c.maxWidth, c.maxHeight, c.cropX, c.cropY);
+  }
+  const uint8_t* frame = renderer.getFrameBuffer();
+  return std::vector<uint8_t>(frame, frame + HalDisplay::BUFFER_SIZE);
+}
+
+struct Timing {
+  double us;
+  uint32_t reads;
+  uint32_t seeks;
+};
+
+Timing timeRender(GfxRenderer& renderer, const Bitmap& bitmap, const Case& c, const bool reference) {
+  FsFile::resetCounters();
+  render(renderer, bitmap, c, GfxRenderer::BW, reference);
+  Timing timing{0, FsFile::readCalls, FsFile::seekCalls};
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++) {
+    render(renderer, bitmap, c, GfxRenderer::BW, reference);
+  }
+  const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  timing.us = elapsed.count() / ITERATIONS;
+  return timing;
+}
+}  // namespace
+
+int main() {
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+
+  const Case cases[] = {
+      {"sleep cover 8-bit", 960, 1440, 8, false, 0, 40, 480, 800, 0, 0, false},
+      {"sleep crop 24-bit", 900, 1100, 24, true, 0, 0, 480, 800, 0.2f, 0, false},
+      {"sleep image dithered", 1600, 2400, 24, false, 0, 40, 480, 800, 0, 0, true},
+      {"sleep 1-bit", 1000, 1400, 1, false, 0, 0, 480, 800, 0, 0, false},
+      {"home cover 2-bit", 300, 450, 2, true, 20, 60, 140, 210, 0, 0, false},
+      {"home cover 24-bit", 480, 720, 24, false, 200, 100, 220, 330, 0, 0, false},
+      {"unscaled off screen", 400, 600, 8, false, 120, 500, 0, 0, 0, 0, false},
+  };
+  const GfxRenderer::RenderMode modes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB};
+  const GfxRenderer::Orientation orientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                   GfxRenderer::PortraitInverted,
+                                                   GfxRenderer::LandscapeCounterClockwise};
+
+  bool ok = true;
+  printf("%-22s %10s %8s %8s %12s %8s %8s %8s\n", "case", "blit us", "reads", "seeks", "per-pixel us", "reads",
+         "seeks", "result");
+  for (const auto& c : cases) {
+    const std::string path = writeBmp(c);
+    FsFile file(fopen(path.c_str(), "rb"));
+    Bitmap bitmap(file, c.dithering);
+    if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+      printf("!! %s: bad BMP\n", c.name);
+      return 1;
+    }
+
+    bool match = true;
+    for (const auto orientation : orientations) {
+      // Error diffusion doesn't run through rows skipped off screen, so dithered images are compared where they fit
+      const bool landscape =
+          orientation == GfxRenderer::LandscapeClockwise || orientation == GfxRenderer::LandscapeCounterClockwise;
+      if (c.dithering && landscape) continue;
+      renderer.setOrientation(orientation);
+      for (const auto mode : modes) {
+        match = match && render(renderer, bitmap, c, mode, false) == render(renderer, bitmap, c, mode, true);
+      }
+    }
+    ok = ok && match;
+
+    renderer.setOrientation(GfxRenderer::Portrait);
+    const Timing blit = timeRender(renderer, bitmap, c, false);
+    const Timing perPixel = timeRender(renderer, bitmap, c, true);
+    printf("%-22s %10.1f %8u %8u %12.1f %8u %8u %8s\n", c.name, blit.us, blit.reads, blit.seeks, perPixel.us,
+           perPixel.reads, perPixel.seeks, match ? "match" : "DIFFER");
+    file.close();
+    remove(path.c_str());
+  }
+
+  if (!ok) {
+    printf("!! Bitmap blit differs from the per-pixel reference\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,286 @@
+#include <EpdFontFamily.h>
+#include <EpdGlyphCache.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <Utf8.h>
+#include <builtinFonts/all.h>
+#include <miniz.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Reports the flash the compressed built-in fonts take against their inflated bitmaps, and checks that every glyph
+// EpdGlyphCache hands out matches its block inflated in one go, with a cache that evicts all the time and with the
+// renderer's. Then lays out pages of text with words in all four styles of a family, draws them with fonts inflated
+// up front and with the compressed fonts through the renderer's glyph cache, cold and warm, and reports the time per
+// page and the cache hit rate. Glyph lookups of the same pages are replayed through caches of other sizes. The frame
+// buffers must match the inflated fonts' byte for byte.
+
+namespace {
+constexpr int MARGIN = 12;
+constexpr int ITERATIONS = 50;
+
+struct Family {
+  const char* name;
+  const EpdFontData* styles[4];  // Indexed by EpdFontFamily::Style
+};
+
+#define FAMILY(face, size)                                                     \
+  {#face " " #size,                                                            \
+   {&face##_##size##_regular, &face##_##size##_bold, &face##_##size##_italic, \
+    &face##_##size##_bolditalic}}
+
+const Family FAMILIES[] = {
+    FAMILY(bookerly, 12),     FAMILY(bookerly, 14),     FAMILY(bookerly, 16),     FAMILY(bookerly, 18),
+    FAMILY(notosans, 12),     FAMILY(notosans, 14),     FAMILY(notosans, 16),     FAMILY(notosans, 18),
+    FAMILY(opendyslexic, 8),  FAMILY(opendyslexic, 10), FAMILY(opendyslexic, 12), FAMILY(opendyslexic, 14),
+};
+
+const char* const TEXT =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way. \xE2\x80\x9CWhat\xE2\x80"
+    "\x99s the matter?\xE2\x80\x9D she asked \xE2\x80\x94 caf\xC3\xA9s, na\xC3\xAFve se\xC3\xB1ora, 1848\xE2\x80\x93"
+    "1851.";
+
+uint32_t glyphCount(const EpdFontData& font) {
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < font.intervalCount; i++) {
+    count = std::max(count, font.intervals[i].offset + font.intervals[i].last - font.intervals[i].first + 1);
+  }
+  return count;
+}
+
+uint32_t blockCount(const EpdFontData& font) {
+  uint32_t end = 0;
+  for (uint32_t i = 0; i < glyphCount(font); i++) {
+    end = std::max(end, font.glyph[i].dataOffset + font.glyph[i].dataLength);
+  }
+  return (end + EPD_FONT_COMPRESSED_BLOCK_SIZE - 1) / EPD_FONT_COMPRESSED_BLOCK_SIZE;
+}
+
+// The bitmap bytes a header without --compress stores: every glyph's, back to back
+uint32_t rawBytes(const EpdFontData& font) {
+  uint32_t bytes = 0;
+  for (uint32_t i = 0; i < glyphCount(font); i++) {
+    bytes += font.glyph[i].dataLength;
+  }
+  return bytes;
+}
+
+uint32_t compressedBytes(const EpdFontData& font) {
+  const uint32_t blocks = blockCount(font);
+  return font.blockOffsets[blocks] + (blocks + 1) * sizeof(uint32_t);
+}
+
+// The font with every block inflated up front, glyph offsets unchanged
+struct InflatedFont {
+  std::vector<uint8_t> bitmap;
+  EpdFontData data;
+};
+
+bool inflateFont(const EpdFontData& font, InflatedFont& out) {
+  const uint32_t blocks = blockCount(font);
+  out.bitmap.assign(blocks * EPD_FONT_COMPRESSED_BLOCK_SIZE, 0);
+  for (uint32_t block = 0; block < blocks; block++) {
+    const size_t size = tinfl_decompress_mem_to_mem(
+        &out.bitmap[block * EPD_FONT_COMPRESSED_BLOCK_SIZE], EPD_FONT_COMPRESSED_BLOCK_SIZE,
+        font.bitmap + font.blockOffsets[block], font.blockOffsets[block + 1] - font.blockOffsets[block], 0);
+    if (size == TINFL_DECOMPRESS_MEM_TO_MEM_FAILED) {
+      return false;
+    }
+  }
+  out.data = font;
+  out.data.bitmap = out.bitmap.data();
+  out.data.blockOffsets = nullptr;
+  return true;
+}
+
+// Every glyph through the cache in the given order, against the font inflated up front
+bool checkGlyphs(EpdGlyphCache& cache, const EpdFontData& font, const InflatedFont& inflated, const bool reverse) {
+  const uint32_t count = glyphCount(font);
+  for (uint32_t n = 0; n < count; n++) {
+    const EpdGlyph* glyph = &font.glyph[reverse ? count - 1 - n : n];
+    const uint8_t* bitmap = cache.get(&font, glyph);
+    if (glyph->dataLength > 0 &&
+        (!bitmap || memcmp(bitmap, &inflated.bitmap[glyph->dataOffset], glyph->dataLength) != 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+struct Word {
+  int x;
+  int y;
+  EpdFontFamily::Style style;
+  std::string text;
+};
+
+EpdFontFamily::Style wordStyle(const size_t word) {
+  if (word % 29 == 5) return EpdFontFamily::BOLD_ITALIC;
+  if (word % 11 == 3) return EpdFontFamily::ITALIC;
+  if (word % 13 == 7) return EpdFontFamily::BOLD;
+  return EpdFontFamily::REGULAR;
+}
+
+// Greedy word wrap of TEXT, a word at a time as the reader draws it, repeated until the page is full
+std::vector<Word> layoutPage(const GfxRenderer& renderer, const int fontId) {
+  std::vector<std::string> words;
+  for (const char* p = TEXT; *p;) {
+    const char* end = strchr(p, ' ');
+    if (!end) end = p + strlen(p);
+    words.emplace_back(p, end);
+    p = *end ? end + 1 : end;
+  }
+
+  std::vector<Word> page;
+  const int maxX = renderer.getScreenWidth() - MARGIN;
+  const int lineHeight = renderer.getLineHeight(fontId);
+  const int spaceWidth = renderer.getSpaceWidth(fontId);
+  size_t word = 0;
+  for (int y = MARGIN; y + lineHeight <= renderer.getScreenHeight() - MARGIN; y += lineHeight) {
+    int x = MARGIN;
+    while (true) {
+      const auto style = wordStyle(word);
+      const int width = renderer.getTextWidth(fontId, words[word % words.size()].c_str(), style);
+      if (x > MARGIN && x + width > maxX) break;
+      page.push_back({x, y, style, words[word % words.size()]});
+      x += width + spaceWidth;
+      word++;
+    }
+  }
+  return page;
+}
+
+void drawPage(const GfxRenderer& renderer, const int fontId, const std::vector<Word>& page) {
+  renderer.clearScreen();
+  for (const auto& word : page) {
+    renderer.drawText(fontId, word.x, word.y, word.text.c_str(), true, word.style);
+  }
+}
+
+std::vector<uint8_t> frame(const GfxRenderer& renderer) {
+  return std::vector<uint8_t>(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+}
+
+double elapsedUs(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+int main() {
+  // Flash taken by the bitmaps, and every glyph through a one-set cache forwards and backwards, then the default one
+  bool ok = true;
+  uint64_t totalRaw = 0;
+  uint64_t totalCompressed = 0;
+  std::vector<std::vector<InflatedFont>> inflated(std::size(FAMILIES));
+  printf("%-18s %12s %12s %8s %8s\n", "family", "raw bytes", "compressed", "ratio", "glyphs");
+  for (size_t f = 0; f < std::size(FAMILIES); f++) {
+    uint32_t raw = 0;
+    uint32_t compressed = 0;
+    bool match = true;
+    inflated[f].resize(4);
+    for (int style = 0; style < 4; style++) {
+      const EpdFontData& font = *FAMILIES[f].styles[style];
+      raw += rawBytes(font);
+      compressed += compressedBytes(font);
+      EpdGlyphCache evicting(1);
+      EpdGlyphCache cache;
+      match = match && inflateFont(font, inflated[f][style]) &&
+              checkGlyphs(evicting, font, inflated[f][style], false) &&
+              checkGlyphs(evicting, font, inflated[f][style], true) &&
+              checkGlyphs(cache, font, inflated[f][style], true) && checkGlyphs(cache, font, inflated[f][style], false);
+    }
+    totalRaw += raw;
+    totalCompressed += compressed;
+    ok = ok && match;
+    printf("%-18s %12u %12u %7.1f%% %8s\n", FAMILIES[f].name, raw, compressed, 100.0 * compressed / raw,
+           match ? "match" : "DIFFER");
+  }
+  printf("%-18s %12llu %12llu %7.1f%%\n\n", "total", static_cast<unsigned long long>(totalRaw),
+         static_cast<unsigned long long>(totalCompressed), 100.0 * totalCompressed / totalRaw);
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  renderer.setOrientation(GfxRenderer::Portrait);
+
+  printf("%-18s %10s %10s %10s %10s %10s %8s\n", "page", "inflated", "warm", "cold", "hit rate", "heap", "result");
+  for (const size_t f : {1u, 7u}) {
+    const Family& family = FAMILIES[f];
+    const EpdFont compressed[4] = {EpdFont(family.styles[0]), EpdFont(family.styles[1]), EpdFont(family.styles[2]),
+                                   EpdFont(family.styles[3])};
+    const EpdFont plain[4] = {EpdFont(&inflated[f][0].data), EpdFont(&inflated[f][1].data),
+                              EpdFont(&inflated[f][2].data), EpdFont(&inflated[f][3].data)};
+    const int compressedId = 2 * f + 1;
+    const int plainId = 2 * f + 2;
+    renderer.insertFont(compressedId, EpdFontFamily(&compressed[0], &compressed[1], &compressed[2], &compressed[3]));
+    renderer.insertFont(plainId, EpdFontFamily(&plain[0], &plain[1], &plain[2], &plain[3]));
+    const std::vector<Word> page = layoutPage(renderer, compressedId);
+
+    drawPage(renderer, plainId, page);
+    const std::vector<uint8_t> expected = frame(renderer);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) drawPage(renderer, plainId, page);
+    const double plainUs = elapsedUs(start) / ITERATIONS;
+
+    // Cold: the cache freed before every page, as on the first page after opening a book
+    bool match = true;
+    double coldUs = 0;
+    for (int i = 0; i < ITERATIONS; i++) {
+      renderer.releaseGlyphCache();
+      start = std::chrono::steady_clock::now();
+      drawPage(renderer, compressedId, page);
+      coldUs += elapsedUs(start);
+      match = match && frame(renderer) == expected;
+    }
+    const size_t heapBytes = renderer.getGlyphCache().getAllocatedBytes();
+
+    const uint32_t hitsBefore = renderer.getGlyphCache().getHits();
+    const uint32_t missesBefore = renderer.getGlyphCache().getMisses();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) drawPage(renderer, compressedId, page);
+    const double warmUs = elapsedUs(start) / ITERATIONS;
+    match = match && frame(renderer) == expected;
+    const uint32_t hits = renderer.getGlyphCache().getHits() - hitsBefore;
+    const uint32_t misses = renderer.getGlyphCache().getMisses() - missesBefore;
+    ok = ok && match;
+    renderer.releaseGlyphCache();
+
+    printf("%-18s %10.1f %10.1f %10.1f %9.2f%% %10zu %8s\n", family.name, plainUs, warmUs, coldUs / ITERATIONS,
+           100.0 * hits / (hits + misses), heapBytes, match ? "match" : "DIFFER");
+
+    // The page's glyph lookups through caches of other sizes
+    std::vector<std::pair<const EpdFontData*, const EpdGlyph*>> lookups;
+    for (const auto& word : page) {
+      const EpdFont& font = compressed[word.style];
+      const auto* text = reinterpret_cast<const unsigned char*>(word.text.c_str());
+      while (const uint32_t cp = utf8NextCodepoint(&text)) {
+        const EpdGlyph* glyph = font.getGlyph(cp);
+        if (glyph && glyph->dataLength > 0) lookups.emplace_back(font.data, glyph);
+      }
+    }
+    for (const int sets : {4, 8, 16, 32, 64}) {
+      EpdGlyphCache cache(sets);
+      start = std::chrono::steady_clock::now();
+      for (int i = 0; i < ITERATIONS; i++) {
+        for (const auto& [font, glyph] : lookups) cache.get(font, glyph);
+      }
+      const double lookupUs = elapsedUs(start) / ITERATIONS;
+      printf("  %3d glyphs %16s lookups %7.1f us/page, hit rate %6.2f%%, heap %6zu\n", sets * EpdGlyphCache::WAYS, "",
+             lookupUs, 100.0 * cache.getHits() / (cache.getHits() + cache.getMisses()), cache.getAllocatedBytes());
+    }
+  }
+
+  if (!ok) {
+    printf("!! Glyphs inflated through the cache differ from the inflated fonts\n");
+    return 1;
+  }
+  return 0;
+}
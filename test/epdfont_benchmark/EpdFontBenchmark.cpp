@@ -0,0 +1,276 @@
+#include <EpdFontFamily.h>
+#include <EpdFontFile.h>
+#include <EpdGlyphCache.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Writes the built-in bookerly_14_regular out as an .epdfont file laid out like fontconvert.py --epdfont does, or
+// takes one converted from the same TTF as the first argument, and checks that EpdFontFile reads back the same
+// metrics, glyphs and bitmaps. Then draws pages of text with the built-in font and with the file, with a cold and a
+// warm page cache of several sizes, and reports the time per page, page reads and cache hit rate. The frame buffers
+// must match the built-in font's byte for byte.
+
+namespace {
+constexpr int MARGIN = 12;
+constexpr int ITERATIONS = 50;
+constexpr uint16_t PAGE_SIZE = 1024;
+
+const char* const PAGES[] = {
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way.",
+    "\xE2\x80\x9CWhat\xE2\x80\x99s the matter?\xE2\x80\x9D she asked \xE2\x80\x94 and then, quieter: "
+    "\xE2\x80\x9CNothing at all.\xE2\x80\x9D 1848, 1851 & 1862; caf\xC3\xA9s, na\xC3\xAFve se\xC3\xB1ora, "
+    "Stra\xC3\x9F" "e, \xC3\x85ngstr\xC3\xB6m, \xC5\x81\xC3\xB3" "d\xC5\xBA, \xC4\x8C" "esk\xC3\xA9 Bud\xC4\x9Bjovice.",
+    "\xD0\x92\xD1\x81\xD0\xB5 \xD1\x81\xD1\x87\xD0\xB0\xD1\x81\xD1\x82\xD0\xBB\xD0\xB8\xD0\xB2\xD1\x8B\xD0\xB5 "
+    "\xD1\x81\xD0\xB5\xD0\xBC\xD1\x8C\xD0\xB8 \xD0\xBF\xD0\xBE\xD1\x85\xD0\xBE\xD0\xB6\xD0\xB8 \xD0\xB4\xD1\x80"
+    "\xD1\x83\xD0\xB3 \xD0\xBD\xD0\xB0 \xD0\xB4\xD1\x80\xD1\x83\xD0\xB3\xD0\xB0, \xD0\xBA\xD0\xB0\xD0\xB6\xD0\xB4"
+    "\xD0\xB0\xD1\x8F \xD0\xBD\xD0\xB5\xD1\x81\xD1\x87\xD0\xB0\xD1\x81\xD1\x82\xD0\xBB\xD0\xB8\xD0\xB2\xD0\xB0"
+    "\xD1\x8F \xD1\x81\xD0\xB5\xD0\xBC\xD1\x8C\xD1\x8F \xD0\xBD\xD0\xB5\xD1\x81\xD1\x87\xD0\xB0\xD1\x81\xD1\x82"
+    "\xD0\xBB\xD0\xB8\xD0\xB2\xD0\xB0 \xD0\xBF\xD0\xBE-\xD1\x81\xD0\xB2\xD0\xBE\xD0\xB5\xD0\xBC\xD1\x83.",
+};
+
+void put16(std::vector<uint8_t>& out, const uint16_t v) {
+  out.push_back(v & 0xFF);
+  out.push_back(v >> 8);
+}
+
+void put32(std::vector<uint8_t>& out, const uint32_t v) {
+  put16(out, v & 0xFFFF);
+  put16(out, v >> 16);
+}
+
+// The layout fontconvert.py --epdfont writes: bitmaps moved on to the next page where they would cross one
+std::string writeEpdFont(const EpdFontData& font, const char* path) {
+  uint32_t glyphCount = 0;
+  for (uint32_t i = 0; i < font.intervalCount; i++) {
+    glyphCount = std::max(glyphCount, font.intervals[i].offset + font.intervals[i].last - font.intervals[i].first + 1);
+  }
+
+  // The built-in fonts are compressed, so their bitmaps come through a glyph cache
+  const EpdFont builtIn(&font);
+  EpdGlyphCache cache;
+  std::vector<uint8_t> bitmaps;
+  std::vector<uint32_t> offsets;
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    const EpdGlyph& glyph = font.glyph[i];
+    uint32_t offset = bitmaps.size();
+    if (glyph.dataLength > 0 && offset / PAGE_SIZE != (offset + glyph.dataLength - 1) / PAGE_SIZE) {
+      offset = (offset / PAGE_SIZE + 1) * PAGE_SIZE;
+    }
+    bitmaps.resize(offset);
+    if (glyph.dataLength > 0) {
+      const uint8_t* bitmap = builtIn.getGlyphBitmap(&glyph, &cache);
+      bitmaps.insert(bitmaps.end(), bitmap, bitmap + glyph.dataLength);
+    }
+    offsets.push_back(offset);
+  }
+
+  std::vector<uint8_t> out = {'E', 'P', 'D', 'F'};
+  put16(out, EpdFontFile::VERSION);
+  put16(out, font.is2Bit ? 1 : 0);
+  put16(out, PAGE_SIZE);
+  out.push_back(font.advanceY);
+  out.push_back(0);
+  put16(out, font.ascender);
+  put16(out, font.descender);
+  put32(out, font.intervalCount);
+  put32(out, glyphCount);
+  put32(out, bitmaps.size());
+  for (uint32_t i = 0; i < font.intervalCount; i++) {
+    put32(out, font.intervals[i].first);
+    put32(out, font.intervals[i].last);
+    put32(out, font.intervals[i].offset);
+  }
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    const EpdGlyph& glyph = font.glyph[i];
+    out.push_back(glyph.width);
+    out.push_back(glyph.height);
+    out.push_back(glyph.advanceX);
+    out.push_back(0);
+    put16(out, glyph.left);
+    put16(out, glyph.top);
+    put16(out, glyph.dataLength);
+    put16(out, 0);
+    put32(out, offsets[i]);
+  }
+  out.insert(out.end(), bitmaps.begin(), bitmaps.end());
+
+  FILE* f = fopen(path, "wb");
+  fwrite(out.data(), 1, out.size(), f);
+  fclose(f);
+  return path;
+}
+
+bool checkFont(const EpdFontData& builtIn, EpdFontFile& file) {
+  const EpdFontData& data = *file.getData();
+  if (data.advanceY != builtIn.advanceY || data.ascender != builtIn.ascender ||
+      data.descender != builtIn.descender || data.is2Bit != builtIn.is2Bit ||
+      data.intervalCount != builtIn.intervalCount) {
+    printf("!! font metrics differ\n");
+    return false;
+  }
+  const EpdFont builtInFont(&builtIn);
+  const EpdFont fileFont(&file);
+  EpdGlyphCache cache;
+  for (uint32_t i = 0; i < builtIn.intervalCount; i++) {
+    for (uint32_t cp = builtIn.intervals[i].first; cp <= builtIn.intervals[i].last; cp++) {
+      const EpdGlyph* a = builtInFont.getGlyph(cp);
+      const EpdGlyph* b = fileFont.getGlyph(cp);
+      if (!b || a->width != b->width || a->height != b->height || a->advanceX != b->advanceX ||
+          a->left != b->left || a->top != b->top || a->dataLength != b->dataLength) {
+        printf("!! glyph U+%04X differs\n", cp);
+        return false;
+      }
+      const uint8_t* bitmap = fileFont.getGlyphBitmap(b);
+      if (b->dataLength > 0 &&
+          (!bitmap || memcmp(bitmap, builtInFont.getGlyphBitmap(a, &cache), a->dataLength) != 0)) {
+        printf("!! bitmap of U+%04X differs\n", cp);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Greedy word wrap of text, repeated until the page is full
+void drawPage(const GfxRenderer& renderer, const int fontId, const char* text) {
+  std::vector<std::string> words;
+  for (const char* p = text; *p;) {
+    const char* end = strchr(p, ' ');
+    if (!end) end = p + strlen(p);
+    words.emplace_back(p, end);
+    p = *end ? end + 1 : end;
+  }
+
+  renderer.clearScreen();
+  const int maxWidth = renderer.getScreenWidth() - 2 * MARGIN;
+  const int lineHeight = renderer.getLineHeight(fontId);
+  size_t word = 0;
+  for (int y = MARGIN; y + lineHeight <= renderer.getScreenHeight() - MARGIN; y += lineHeight) {
+    std::string line;
+    while (true) {
+      const std::string candidate = line.empty() ? words[word] : line + " " + words[word];
+      if (!line.empty() && renderer.getTextWidth(fontId, candidate.c_str()) > maxWidth) break;
+      line = candidate;
+      word = (word + 1) % words.size();
+    }
+    renderer.drawText(fontId, MARGIN, y, line.c_str());
+  }
+}
+
+std::vector<uint8_t> frame(const GfxRenderer& renderer) {
+  return std::vector<uint8_t>(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+}
+
+double elapsedUs(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::string path = argc > 1 ? argv[1] : writeEpdFont(bookerly_14_regular, "/tmp/bookerly_14_regular.epdfont");
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  renderer.setOrientation(GfxRenderer::Portrait);
+
+  EpdFontFile check;
+  if (!check.open(path)) {
+    printf("!! could not open %s\n", path.c_str());
+    return 1;
+  }
+  if (!checkFont(bookerly_14_regular, check)) {
+    return 1;
+  }
+  printf("%s: glyphs and bitmaps match the built-in font\n\n", path.c_str());
+  check.close();
+
+  // The built-in font's pages, and its time per page. insertFont keeps the first font for an id, so each font drawn
+  // below gets an id of its own.
+  int fontId = 1;
+  const EpdFont builtInFont(&bookerly_14_regular);
+  renderer.insertFont(fontId, EpdFontFamily(&builtInFont));
+  std::vector<std::vector<uint8_t>> expected;
+  for (const char* text : PAGES) {
+    drawPage(renderer, fontId, text);
+    expected.push_back(frame(renderer));
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++) {
+    for (const char* text : PAGES) drawPage(renderer, fontId, text);
+  }
+  const double builtInUs = elapsedUs(start) / (ITERATIONS * std::size(PAGES));
+  printf("%-22s %10s %10s %10s %10s %8s\n", "font", "page us", "misses", "reads", "hit rate", "result");
+  printf("%-22s %10.1f %10s %10s %10s %8s\n", "built-in", builtInUs, "-", "-", "-", "-");
+
+  bool ok = true;
+  for (const int cachePages : {2, 4, 8, 16}) {
+    // Cold: a freshly opened file for every page
+    double coldUs = 0;
+    uint32_t coldMisses = 0;
+    uint32_t coldReads = 0;
+    bool match = true;
+    for (int i = 0; i < ITERATIONS; i++) {
+      for (size_t page = 0; page < std::size(PAGES); page++) {
+        EpdFontFile file(cachePages);
+        file.open(path);
+        const EpdFont font(&file);
+        renderer.insertFont(++fontId, EpdFontFamily(&font));
+        FsFile::resetCounters();
+        start = std::chrono::steady_clock::now();
+        drawPage(renderer, fontId, PAGES[page]);
+        coldUs += elapsedUs(start);
+        coldReads += FsFile::readCalls;
+        coldMisses += file.getCacheMisses();
+        match = match && frame(renderer) == expected[page];
+      }
+    }
+
+    // Warm: one file, pages drawn one after the other as when reading
+    EpdFontFile file(cachePages);
+    file.open(path);
+    const EpdFont font(&file);
+    renderer.insertFont(++fontId, EpdFontFamily(&font));
+    for (const char* text : PAGES) drawPage(renderer, fontId, text);
+    const uint32_t hitsBefore = file.getCacheHits();
+    const uint32_t missesBefore = file.getCacheMisses();
+    FsFile::resetCounters();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+      for (size_t page = 0; page < std::size(PAGES); page++) {
+        drawPage(renderer, fontId, PAGES[page]);
+        match = match && frame(renderer) == expected[page];
+      }
+    }
+    const int pages = ITERATIONS * std::size(PAGES);
+    const double warmUs = elapsedUs(start) / pages;
+    const uint32_t hits = file.getCacheHits() - hitsBefore;
+    const uint32_t misses = file.getCacheMisses() - missesBefore;
+    ok = ok && match;
+
+    const std::string name = std::to_string(cachePages) + " x " + std::to_string(PAGE_SIZE) + " B";
+    printf("%-22s %10.1f %10.1f %10.1f %10s %8s\n", (name + " cold").c_str(), coldUs / pages,
+           static_cast<double>(coldMisses) / pages, static_cast<double>(coldReads) / pages, "-",
+           match ? "match" : "DIFFER");
+    printf("%-22s %10.1f %10.1f %10.1f %9.2f%% %8s\n", (name + " warm").c_str(), warmUs,
+           static_cast<double>(misses) / pages, static_cast<double>(FsFile::readCalls) / pages,
+           100.0 * hits / (hits + misses), match ? "match" : "DIFFER");
+  }
+
+  if (!ok) {
+    printf("!! Pages drawn with the font file differ from the built-in font\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,329 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/notosans_8_regular.h>
+#include <builtinFonts/ubuntu_10_bold.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+#include <builtinFonts/ubuntu_12_bold.h>
+#include <builtinFonts/ubuntu_12_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CrossPointSettings.h"
+#include "RecentBooksStore.h"
+#include "components/UITheme.h"
+#include "components/themes/BaseTheme.h"
+#include "components/themes/lyra/LyraTheme.h"
+#include "fontIds.h"
+
+// Part one draws every filled primitive in every orientation through GfxRenderer and through a per-pixel reference
+// that mirrors the drawPixel loops the span writer replaced, and fails unless the frame buffers match byte for byte.
+// Part two draws the Home and Settings screens of both themes with the theme code itself and reports the time per
+// frame.
+
+CrossPointSettings CrossPointSettings::instance;
+std::string UITheme::getCoverThumbPath(std::string coverBmpPath, int) { return coverBmpPath; }
+
+namespace {
+constexpr int ITERATIONS = 200;
+
+// Per-pixel reference, as the primitives were drawn before they went through spans
+void refLine(const GfxRenderer& r, int x1, int y1, int x2, int y2, const bool state) {
+  if (x1 == x2) {
+    if (y2 < y1) std::swap(y1, y2);
+    for (int y = y1; y <= y2; y++) r.drawPixel(x1, y, state);
+  } else if (y1 == y2) {
+    if (x2 < x1) std::swap(x1, x2);
+    for (int x = x1; x <= x2; x++) r.drawPixel(x, y1, state);
+  }
+}
+
+void refFillRect(const GfxRenderer& r, const int x, const int y, const int width, const int height, const bool state) {
+  for (int fillY = y; fillY < y + height; fillY++) refLine(r, x, fillY, x + width - 1, fillY, state);
+}
+
+void refDitherPixel(const GfxRenderer& r, const int x, const int y, const Color color) {
+  switch (color) {
+    case Color::Black:
+      r.drawPixel(x, y, true);
+      break;
+    case Color::White:
+      r.drawPixel(x, y, false);
+      break;
+    case Color::LightGray:
+      r.drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
+      break;
+    case Color::DarkGray:
+      r.drawPixel(x, y, (x + y) % 2 == 0);
+      break;
+    default:
+      break;
+  }
+}
+
+void refFillRectDither(const GfxRenderer& r, const int x, const int y, const int width, const int height,
+                       const Color color) {
+  for (int fillY = y; fillY < y + height; fillY++) {
+    for (int fillX = x; fillX < x + width; fillX++) refDitherPixel(r, fillX, fillY, color);
+  }
+}
+
+void refArc(const GfxRenderer& r, const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+            const int lineWidth, const bool state) {
+  const int stroke = std::min(lineWidth, maxRadius);
+  const int innerRadius = std::max(maxRadius - stroke, 0);
+  for (int dy = 0; dy <= maxRadius; ++dy) {
+    for (int dx = 0; dx <= maxRadius; ++dx) {
+      const int distSq = dx * dx + dy * dy;
+      if (distSq > maxRadius * maxRadius || distSq < innerRadius * innerRadius) continue;
+      r.drawPixel(cx + xDir * dx, cy + yDir * dy, state);
+    }
+  }
+}
+
+void refFillArc(const GfxRenderer& r, const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+                const Color color) {
+  for (int dy = 0; dy <= maxRadius; ++dy) {
+    for (int dx = 0; dx <= maxRadius; ++dx) {
+      if (dx * dx + dy * dy <= maxRadius * maxRadius) refDitherPixel(r, cx + xDir * dx, cy + yDir * dy, color);
+    }
+  }
+}
+
+void refFillRoundedRect(const GfxRenderer& r, const int x, const int y, const int width, const int height,
+                        const int cornerRadius, const Color color) {
+  const int maxRadius = std::min({cornerRadius, width / 2, height / 2});
+  if (maxRadius <= 0) {
+    refFillRectDither(r, x, y, width, height, color);
+    return;
+  }
+  const int horizontalWidth = width - 2 * maxRadius;
+  if (horizontalWidth > 0) refFillRectDither(r, x + maxRadius + 1, y, horizontalWidth - 2, height, color);
+  const int verticalHeight = height - 2 * maxRadius - 2;
+  if (verticalHeight > 0) {
+    refFillRectDither(r, x, y + maxRadius + 1, maxRadius + 1, verticalHeight, color);
+    refFillRectDither(r, x + width - maxRadius - 1, y + maxRadius + 1, maxRadius + 1, verticalHeight, color);
+  }
+  refFillArc(r, maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+  refFillArc(r, maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+  refFillArc(r, maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+  refFillArc(r, maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+}
+
+void refDrawRoundedRect(const GfxRenderer& r, const int x, const int y, const int width, const int height,
+                        const int lineWidth, const int cornerRadius, const bool state) {
+  const int maxRadius = std::min({cornerRadius, width / 2, height / 2});
+  const int stroke = std::min(lineWidth, maxRadius);
+  const int right = x + width - 1;
+  const int bottom = y + height - 1;
+  const int horizontalWidth = width - 2 * maxRadius;
+  if (horizontalWidth > 0) {
+    refFillRect(r, x + maxRadius, y, horizontalWidth, stroke, state);
+    refFillRect(r, x + maxRadius, bottom - stroke + 1, horizontalWidth, stroke, state);
+  }
+  const int verticalHeight = height - 2 * maxRadius;
+  if (verticalHeight > 0) {
+    refFillRect(r, x, y + maxRadius, stroke, verticalHeight, state);
+    refFillRect(r, right - stroke + 1, y + maxRadius, stroke, verticalHeight, state);
+  }
+  refArc(r, maxRadius, x + maxRadius, y + maxRadius, -1, -1, lineWidth, state);
+  refArc(r, maxRadius, right - maxRadius, y + maxRadius, 1, -1, lineWidth, state);
+  refArc(r, maxRadius, right - maxRadius, bottom - maxRadius, 1, 1, lineWidth, state);
+  refArc(r, maxRadius, x + maxRadius, bottom - maxRadius, -1, 1, lineWidth, state);
+}
+
+void refFillPolygon(const GfxRenderer& r, const int* xs, const int* ys, const int n, const bool state) {
+  int minY = ys[0], maxY = ys[0];
+  for (int i = 1; i < n; i++) {
+    minY = std::min(minY, ys[i]);
+    maxY = std::max(maxY, ys[i]);
+  }
+  minY = std::max(minY, 0);
+  maxY = std::min(maxY, r.getScreenHeight() - 1);
+  std::vector<int> nodeX(n);
+  for (int scanY = minY; scanY <= maxY; scanY++) {
+    int nodes = 0;
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+      if ((ys[i] < scanY && ys[j] >= scanY) || (ys[j] < scanY && ys[i] >= scanY)) {
+        nodeX[nodes++] = xs[i] + (scanY - ys[i]) * (xs[j] - xs[i]) / (ys[j] - ys[i]);
+      }
+    }
+    std::sort(nodeX.begin(), nodeX.begin() + nodes);
+    for (int i = 0; i < nodes - 1; i += 2) {
+      const int startX = std::max(nodeX[i], 0);
+      const int endX = std::min(nodeX[i + 1], r.getScreenWidth() - 1);
+      for (int x = startX; x <= endX; x++) r.drawPixel(x, scanY, state);
+    }
+  }
+}
+
+const int POLY_X[] = {40, 200, 120, 60, 10};
+const int POLY_Y[] = {420, 440, 560, 520, 470};
+
+// The same shapes both ways; odd positions and sizes exercise the masked edge bytes, some shapes hang off the screen
+void drawPrimitives(const GfxRenderer& r, const bool reference) {
+  const int w = r.getScreenWidth();
+  const int h = r.getScreenHeight();
+  if (reference) {
+    refFillRect(r, 3, 5, 123, 77, true);
+    refFillRect(r, 60, 21, 31, 17, false);
+    refFillRect(r, -20, h - 30, 60, 50, true);
+    refLine(r, 5, 200, w - 7, 200, true);
+    refLine(r, w / 2, 130, w / 2, h + 20, true);
+    refFillRectDither(r, 171, 41, 101, 93, Color::LightGray);
+    refFillRectDither(r, 21, 231, 141, 61, Color::DarkGray);
+    refFillRectDither(r, w - 50, 7, 90, 33, Color::DarkGray);
+    refFillRoundedRect(r, 31, 321, 160, 70, 12, Color::DarkGray);
+    refFillRoundedRect(r, 221, 353, 121, 81, 20, Color::LightGray);
+    refFillRoundedRect(r, 240, 250, 90, 60, 9, Color::Black);
+    refDrawRoundedRect(r, 190, 150, 150, 90, 2, 14, true);
+    refDrawRoundedRect(r, 17, 600, 201, 47, 1, 6, true);
+    refFillPolygon(r, POLY_X, POLY_Y, 5, true);
+  } else {
+    r.fillRect(3, 5, 123, 77, true);
+    r.fillRect(60, 21, 31, 17, false);
+    r.fillRect(-20, h - 30, 60, 50, true);
+    r.drawLine(5, 200, w - 7, 200, true);
+    r.drawLine(w / 2, 130, w / 2, h + 20, true);
+    r.fillRectDither(171, 41, 101, 93, Color::LightGray);
+    r.fillRectDither(21, 231, 141, 61, Color::DarkGray);
+    r.fillRectDither(w - 50, 7, 90, 33, Color::DarkGray);
+    r.fillRoundedRect(31, 321, 160, 70, 12, Color::DarkGray);
+    r.fillRoundedRect(221, 353, 121, 81, 20, Color::LightGray);
+    r.fillRoundedRect(240, 250, 90, 60, 9, Color::Black);
+    r.drawRoundedRect(190, 150, 150, 90, 2, 14, true);
+    r.drawRoundedRect(17, 600, 201, 47, 1, 6, true);
+    r.fillPolygon(POLY_X, POLY_Y, 5, true);
+  }
+}
+
+void drawHome(GfxRenderer& r, const BaseTheme& theme, const ThemeMetrics& metrics) {
+  static const std::vector<RecentBook> books = {{"/a.epub", "A Tale of Two Cities", "Charles Dickens", ""},
+                                                {"/b.epub", "Bleak House", "Charles Dickens", ""},
+                                                {"/c.epub", "Middlemarch", "George Eliot", ""}};
+  static const char* const menuItems[] = {"Browse Files", "Recents", "File Transfer", "Settings"};
+  const int pageWidth = r.getScreenWidth();
+  const int pageHeight = r.getScreenHeight();
+  bool coverRendered = false;
+  bool coverBufferStored = false;
+  bool bufferRestored = false;
+
+  r.clearScreen();
+  theme.drawHeader(r, Rect{0, metrics.topPadding, pageWidth, metrics.homeTopPadding}, nullptr);
+  theme.drawRecentBookCover(r, Rect{0, metrics.homeTopPadding, pageWidth, metrics.homeCoverTileHeight}, books, 1,
+                            coverRendered, coverBufferStored, bufferRestored, [] { return false; });
+  theme.drawButtonMenu(
+      r,
+      Rect{0, metrics.homeTopPadding + metrics.homeCoverTileHeight + metrics.verticalSpacing, pageWidth,
+           pageHeight - (metrics.headerHeight + metrics.homeTopPadding + metrics.verticalSpacing * 2 +
+                         metrics.buttonHintsHeight)},
+      4, 1, [](const int index) { return std::string(menuItems[index]); }, nullptr);
+  theme.drawButtonHints(r, "", "Select", "Up", "Down");
+}
+
+void drawSettings(GfxRenderer& r, const BaseTheme& theme, const ThemeMetrics& metrics) {
+  static const char* const names[] = {"Sleep Screen", "Status Bar",   "Hide Battery %", "Refresh Frequency",
+                                      "Font Family",  "Font Size",    "Line Spacing",   "Paragraph Alignment",
+                                      "Hyphenation",  "Anti-Aliasing"};
+  static const char* const values[] = {"Dark", "Full", "Never", "15 pages", "Bookerly",
+                                       "Medium", "Normal", "Justify", "ON", "ON"};
+  const int pageWidth = r.getScreenWidth();
+  const int pageHeight = r.getScreenHeight();
+  const Rect listRect{0, metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight + metrics.verticalSpacing,
+                      pageWidth,
+                      pageHeight - (metrics.topPadding + metrics.headerHeight + metrics.tabBarHeight +
+                                    metrics.buttonHintsHeight + metrics.verticalSpacing * 2)};
+
+  r.clearScreen();
+  theme.drawHeader(r, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, "Settings");
+  theme.drawTabBar(r, Rect{0, metrics.topPadding + metrics.headerHeight, pageWidth, metrics.tabBarHeight},
+                   {{"Display", false}, {"Reader", true}, {"Controls", false}, {"System", false}}, false);
+  theme.drawList(
+      r, listRect, 10, 3, [](const int i) { return std::string(names[i]); }, nullptr, nullptr,
+      [](const int i) { return std::string(values[i]); });
+  r.drawText(SMALL_FONT_ID, pageWidth - metrics.versionTextRightX - r.getTextWidth(SMALL_FONT_ID, "1.0.0"),
+             metrics.versionTextY, "1.0.0");
+  theme.drawButtonHints(r, "« Back", "Toggle", "Up", "Down");
+}
+
+template <typename F>
+double timeUs(F&& draw) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++) {
+    draw();
+  }
+  const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / ITERATIONS;
+}
+}  // namespace
+
+int main() {
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+
+  EpdFont smallFont(&notosans_8_regular);
+  EpdFont ui10Regular(&ubuntu_10_regular);
+  EpdFont ui10Bold(&ubuntu_10_bold);
+  EpdFont ui12Regular(&ubuntu_12_regular);
+  EpdFont ui12Bold(&ubuntu_12_bold);
+  renderer.insertFont(SMALL_FONT_ID, EpdFontFamily(&smallFont));
+  renderer.insertFont(UI_10_FONT_ID, EpdFontFamily(&ui10Regular, &ui10Bold));
+  renderer.insertFont(UI_12_FONT_ID, EpdFontFamily(&ui12Regular, &ui12Bold));
+
+  const struct {
+    const char* name;
+    GfxRenderer::Orientation orientation;
+  } orientations[] = {
+      {"Portrait", GfxRenderer::Portrait},
+      {"LandscapeClockwise", GfxRenderer::LandscapeClockwise},
+      {"PortraitInverted", GfxRenderer::PortraitInverted},
+      {"LandscapeCounterClockwise", GfxRenderer::LandscapeCounterClockwise},
+  };
+
+  bool ok = true;
+  std::vector<uint8_t> expected(HalDisplay::BUFFER_SIZE);
+  printf("%-26s %12s %12s %8s %8s\n", "primitives", "per-pixel us", "spans us", "speedup", "result");
+  for (const auto& o : orientations) {
+    renderer.setOrientation(o.orientation);
+    renderer.clearScreen();
+    drawPrimitives(renderer, true);
+    memcpy(expected.data(), renderer.getFrameBuffer(), HalDisplay::BUFFER_SIZE);
+    renderer.clearScreen();
+    drawPrimitives(renderer, false);
+    const bool match = memcmp(expected.data(), renderer.getFrameBuffer(), HalDisplay::BUFFER_SIZE) == 0;
+    ok = ok && match;
+
+    const double refUs = timeUs([&] { drawPrimitives(renderer, true); });
+    const double spanUs = timeUs([&] { drawPrimitives(renderer, false); });
+    printf("%-26s %12.1f %12.1f %7.1fx %8s\n", o.name, refUs, spanUs, refUs / spanUs, match ? "match" : "DIFFER");
+  }
+
+  const LyraTheme lyra;
+  const BaseTheme base;
+  const struct {
+    const char* name;
+    const BaseTheme& theme;
+    const ThemeMetrics& metrics;
+  } themes[] = {{"Lyra", lyra, LyraMetrics::values}, {"Base", base, BaseMetrics::values}};
+
+  renderer.setOrientation(GfxRenderer::Portrait);
+  printf("\n%-26s %12s\n", "screen", "us/frame");
+  for (const auto& t : themes) {
+    const std::string home = std::string(t.name) + " Home";
+    const std::string settings = std::string(t.name) + " Settings";
+    printf("%-26s %12.1f\n", home.c_str(), timeUs([&] { drawHome(renderer, t.theme, t.metrics); }));
+    printf("%-26s %12.1f\n", settings.c_str(), timeUs([&] { drawSettings(renderer, t.theme, t.metrics); }));
+  }
+
+  if (!ok) {
+    printf("!! Span fills differ from the per-pixel reference\n");
+    return 1;
+  }
+  return 0;
+}
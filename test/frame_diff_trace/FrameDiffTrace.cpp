@@ -0,0 +1,186 @@
+#include <EpdFontFamily.h>
+#include <FrameDiff.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Replays a reading session through FrameDiff: page turns, a page drawn again, a status bar only change, a sparse
+// chapter opening, a dense picture page and a menu. For every frame it prints the estimated and the exact flipped and
+// black to white pixel counts, the ghosting pressure and the update picked. Pass the refresh budget in pages as the
+// first argument (default 15) to see how it spaces half and full refreshes.
+
+namespace {
+constexpr int BOOK_FONT_ID = 1;
+constexpr int UI_FONT_ID = 2;
+constexpr int MARGIN = 12;
+
+const char* const TEXT =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way.";
+
+std::vector<std::string> words() {
+  std::vector<std::string> result;
+  for (const char* p = TEXT; *p;) {
+    const char* end = strchr(p, ' ');
+    if (!end) end = p + strlen(p);
+    result.emplace_back(p, end);
+    p = *end ? end + 1 : end;
+  }
+  return result;
+}
+
+void drawStatusBar(const GfxRenderer& renderer, const int page, const int battery) {
+  const std::string left = std::to_string(page) + " / 240";
+  const std::string right = std::to_string(battery) + "%";
+  const int y = renderer.getScreenHeight() - MARGIN - renderer.getLineHeight(UI_FONT_ID);
+  renderer.drawText(UI_FONT_ID, MARGIN, y, left.c_str());
+  renderer.drawText(UI_FONT_ID, renderer.getScreenWidth() - MARGIN - renderer.getTextWidth(UI_FONT_ID, right.c_str()),
+                    y, right.c_str());
+}
+
+// Greedy word wrap starting at word firstWord, stopping after maxLines lines
+void drawTextPage(const GfxRenderer& renderer, const size_t firstWord, const int top, const int maxLines) {
+  static const std::vector<std::string> allWords = words();
+  const int maxWidth = renderer.getScreenWidth() - 2 * MARGIN;
+  const int lineHeight = renderer.getLineHeight(BOOK_FONT_ID);
+  const int bottom = renderer.getScreenHeight() - 2 * MARGIN - renderer.getLineHeight(UI_FONT_ID);
+  size_t word = firstWord % allWords.size();
+  int lines = 0;
+  for (int y = top; y + lineHeight <= bottom && lines < maxLines; y += lineHeight, lines++) {
+    std::string text;
+    while (true) {
+      const std::string candidate = text.empty() ? allWords[word] : text + " " + allWords[word];
+      if (!text.empty() && renderer.getTextWidth(BOOK_FONT_ID, candidate.c_str()) > maxWidth) break;
+      text = candidate;
+      word = (word + 1) % allWords.size();
+    }
+    renderer.drawText(BOOK_FONT_ID, MARGIN, y, text.c_str());
+  }
+}
+
+struct Frame {
+  const char* name;
+  int page;
+  int battery;
+  enum Kind { TEXT_PAGE, CHAPTER_START, PICTURE, MENU } kind;
+  // The panel no longer holds the last frame sent, as when a grayscale pass couldn't restore the BW frame
+  bool panelLost = false;
+};
+
+void drawFrame(const GfxRenderer& renderer, const Frame& frame) {
+  renderer.clearScreen();
+  switch (frame.kind) {
+    case Frame::TEXT_PAGE:
+      drawTextPage(renderer, frame.page * 97, MARGIN, 1000);
+      break;
+    case Frame::CHAPTER_START:
+      renderer.drawCenteredText(BOOK_FONT_ID, 200, "Chapter Two", true, EpdFontFamily::BOLD);
+      drawTextPage(renderer, frame.page * 97, 300, 4);
+      break;
+    case Frame::PICTURE:
+      renderer.fillRectDither(MARGIN, MARGIN, renderer.getScreenWidth() - 2 * MARGIN, 500, Color::DarkGray);
+      break;
+    case Frame::MENU:
+      drawTextPage(renderer, frame.page * 97, MARGIN, 1000);
+      renderer.fillRect(40, 200, renderer.getScreenWidth() - 80, 260, false);
+      renderer.drawRect(40, 200, renderer.getScreenWidth() - 80, 260);
+      for (int i = 0; i < 5; i++) {
+        renderer.drawText(UI_FONT_ID, 60, 220 + i * 45, "Menu entry");
+      }
+      break;
+  }
+  drawStatusBar(renderer, frame.page, frame.battery);
+}
+
+const char* updateName(const FrameDiff::Update update) {
+  static constexpr const char* NAMES[] = {"skip", "window", "fast", "half", "full"};
+  return NAMES[update];
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int budgetPages = argc > 1 ? atoi(argv[1]) : 15;
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  EpdFont bookFont(&bookerly_14_regular);
+  EpdFont uiFont(&ubuntu_10_regular);
+  renderer.insertFont(BOOK_FONT_ID, EpdFontFamily(&bookFont));
+  renderer.insertFont(UI_FONT_ID, EpdFontFamily(&uiFont));
+  renderer.setOrientation(GfxRenderer::Portrait);
+
+  std::vector<Frame> frames;
+  for (int page = 1; page <= 12; page++) {
+    frames.push_back({"page turn", page, 80, Frame::TEXT_PAGE});
+  }
+  frames.push_back({"same page", 12, 80, Frame::TEXT_PAGE});
+  frames.push_back({"battery", 12, 79, Frame::TEXT_PAGE});
+  frames.push_back({"gray lost", 12, 79, Frame::TEXT_PAGE, true});
+  frames.push_back({"menu open", 12, 79, Frame::MENU});
+  frames.push_back({"menu close", 12, 79, Frame::TEXT_PAGE});
+  frames.push_back({"chapter", 13, 79, Frame::CHAPTER_START});
+  frames.push_back({"picture", 14, 79, Frame::PICTURE});
+  for (int page = 15; page <= 50; page++) {
+    frames.push_back({"page turn", page, 79, Frame::TEXT_PAGE});
+  }
+
+  FrameDiff diff;
+  std::vector<uint8_t> panel(HalDisplay::BUFFER_SIZE, 0xFF);
+  uint64_t estimatedTotal = 0;
+  uint64_t exactTotal = 0;
+  int counts[5] = {};
+
+  printf("budget %d pages, %lu px each\n\n", budgetPages, static_cast<unsigned long>(FrameDiff::PAGE_FLIPS));
+  printf("%-4s %-11s %6s %9s %9s %9s %9s %9s %9s %-6s\n", "#", "frame", "tiles", "flip~", "flip", "white~", "white",
+         "pressure", "w-press", "update");
+  for (size_t i = 0; i < frames.size(); i++) {
+    drawFrame(renderer, frames[i]);
+    const uint8_t* frame = renderer.getFrameBuffer();
+
+    uint32_t flipped = 0;
+    uint32_t toWhite = 0;
+    for (uint32_t b = 0; b < HalDisplay::BUFFER_SIZE; b++) {
+      flipped += __builtin_popcount(panel[b] ^ frame[b]);
+      toWhite += __builtin_popcount(~panel[b] & frame[b] & 0xFF);
+    }
+
+    if (frames[i].panelLost) {
+      diff.invalidate();
+    }
+    const auto update = diff.plan(frame, budgetPages);
+    const auto& stats = diff.getStats();
+    counts[update]++;
+    if (update != FrameDiff::SKIP) {
+      memcpy(panel.data(), frame, HalDisplay::BUFFER_SIZE);
+      estimatedTotal += stats.flippedPixels;
+      exactTotal += flipped;
+    }
+    printf("%-4zu %-11s %6u %9lu %9lu %9lu %9lu %9lu %9lu %-6s", i, frames[i].name, stats.changedTiles,
+           static_cast<unsigned long>(stats.flippedPixels), static_cast<unsigned long>(flipped),
+           static_cast<unsigned long>(stats.blackToWhitePixels), static_cast<unsigned long>(toWhite),
+           static_cast<unsigned long>(stats.ghostingPressure), static_cast<unsigned long>(stats.whitePressure),
+           updateName(update));
+    if (update == FrameDiff::WINDOW) {
+      printf(" %dx%d, %d bytes", stats.maxX - stats.minX + 1, stats.maxY - stats.minY + 1,
+             (stats.maxX - stats.minX + 1) / 8 * (stats.maxY - stats.minY + 1));
+    }
+    printf("\n");
+  }
+
+  printf("\n%d skipped, %d windowed, %d fast, %d half, %d full; flipped pixels estimated %llu, exact %llu (%.2fx)\n",
+         counts[FrameDiff::SKIP], counts[FrameDiff::WINDOW], counts[FrameDiff::FAST], counts[FrameDiff::HALF],
+         counts[FrameDiff::FULL], static_cast<unsigned long long>(estimatedTotal),
+         static_cast<unsigned long long>(exactTotal), exactTotal ? static_cast<double>(estimatedTotal) / exactTotal : 0);
+  return 0;
+}
@@ -0,0 +1,189 @@
+#include <EpdFont.h>
+#include <Utf8.h>
+#include <builtinFonts/all.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Checks that looking glyphs up in the built-in fonts' direct and paged tables finds the same glyph as a binary search
+// of their intervals for every code point up to U+30000, then measures lookups per second of English, Russian and
+// Chinese text with the tables and with the binary search alone. None of the built-in fonts has CJK glyphs, so the
+// Chinese text is also looked up in a synthetic font with about a thousand CJK intervals, whose tables are built here
+// the same way fontconvert.py builds them.
+
+namespace {
+constexpr uint32_t LAST_CHECKED_CP = 0x30000;
+constexpr int LOOKUPS = 20000000;
+
+struct Font {
+  const char* name;
+  const EpdFontData* data;
+};
+
+const Font FONTS[] = {
+    {"bookerly 14", &bookerly_14_regular}, {"bookerly 14 bold", &bookerly_14_bold},
+    {"notosans 14", &notosans_14_regular}, {"opendyslexic 10", &opendyslexic_10_regular},
+    {"ubuntu 10", &ubuntu_10_regular},     {"notosans 8", &notosans_8_regular},
+};
+
+struct Text {
+  const char* name;
+  const char* utf8;
+};
+
+const Text TEXTS[] = {
+    {"English",
+     "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+     "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+     "Darkness, it was the spring of hope, it was the winter of despair."},
+    {"Russian",
+     "Все счастливые семьи похожи друг на друга, каждая несчастливая семья несчастлива по-своему. Всё смешалось в "
+     "доме Облонских. Жена узнала, что муж был в связи с бывшею в их доме француженкою-гувернанткой, и объявила мужу, "
+     "что не может жить с ним в одном доме."},
+    {"Chinese",
+     "天下皆知美之为美，斯恶已。皆知善之为善，斯不善已。故有无相生，难易相成，长短相形，高下相倾，音声相和，前后相随。"
+     "是以圣人处无为之事，行不言之教；万物作焉而不辞，生而不有，为而不恃，功成而弗居。夫唯弗居，是以不去。"},
+};
+
+std::vector<uint32_t> decode(const char* utf8) {
+  std::vector<uint32_t> cps;
+  const auto* p = reinterpret_cast<const unsigned char*>(utf8);
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(&p))) {
+    cps.push_back(cp);
+  }
+  return cps;
+}
+
+EpdFontData withoutTables(const EpdFontData& data) {
+  EpdFontData copy = data;
+  copy.directGlyphs = nullptr;
+  copy.glyphPages = nullptr;
+  copy.glyphPageCount = 0;
+  copy.pageGlyphs = nullptr;
+  return copy;
+}
+
+// A font with ASCII and runs of 1 to 40 code points of the CJK Unified Ideographs, every glyph empty
+struct SyntheticCjkFont {
+  std::vector<EpdUnicodeInterval> intervals;
+  std::vector<EpdGlyph> glyphs;
+  std::vector<uint16_t> directGlyphs;
+  std::vector<uint16_t> glyphPages;
+  std::vector<uint16_t> pageGlyphs;
+  EpdFontData data{};
+
+  SyntheticCjkFont() {
+    uint32_t next = 0;
+    intervals.push_back({0x20, 0x7E, next});
+    next += 0x7E - 0x20 + 1;
+    uint32_t seed = 12345;
+    for (uint32_t cp = 0x4E00; cp <= 0x9FFF;) {
+      seed = seed * 1103515245 + 12345;
+      const uint32_t last = std::min<uint32_t>(cp + (seed >> 16) % 40, 0x9FFF);
+      intervals.push_back({cp, last, next});
+      next += last - cp + 1;
+      cp = last + 2 + (seed >> 8) % 3;
+    }
+    glyphs.resize(next);
+
+    const uint32_t pageSize = 1u << EPD_FONT_GLYPH_PAGE_SHIFT;
+    directGlyphs.assign(EPD_FONT_DIRECT_GLYPHS, 0);
+    for (const EpdUnicodeInterval& interval : intervals) {
+      for (uint32_t cp = interval.first; cp <= interval.last; cp++) {
+        const uint16_t number = interval.offset + (cp - interval.first) + 1;
+        if (cp < EPD_FONT_DIRECT_GLYPHS) {
+          directGlyphs[cp] = number;
+          continue;
+        }
+        const uint32_t page = cp >> EPD_FONT_GLYPH_PAGE_SHIFT;
+        if (page >= glyphPages.size()) {
+          glyphPages.resize(page + 1, 0);
+        }
+        if (glyphPages[page] == 0) {
+          glyphPages[page] = pageGlyphs.size() / pageSize + 1;
+          pageGlyphs.resize(pageGlyphs.size() + pageSize, 0);
+        }
+        pageGlyphs[(glyphPages[page] - 1) * pageSize + (cp & (pageSize - 1))] = number;
+      }
+    }
+
+    data.glyph = glyphs.data();
+    data.intervals = intervals.data();
+    data.intervalCount = intervals.size();
+    data.directGlyphs = directGlyphs.data();
+    data.glyphPages = glyphPages.data();
+    data.glyphPageCount = glyphPages.size();
+    data.pageGlyphs = pageGlyphs.data();
+  }
+};
+
+bool checkFont(const char* name, const EpdFontData& data) {
+  const EpdFontData searched = withoutTables(data);
+  const EpdFont tableFont(&data);
+  const EpdFont searchFont(&searched);
+  for (uint32_t cp = 0; cp <= LAST_CHECKED_CP; cp++) {
+    if (tableFont.getGlyph(cp) != searchFont.getGlyph(cp)) {
+      printf("MISMATCH %s: U+%04X\n", name, cp);
+      return false;
+    }
+  }
+  return true;
+}
+
+double lookupsPerSecond(const EpdFont& font, const std::vector<uint32_t>& cps, int* found) {
+  const auto start = std::chrono::steady_clock::now();
+  int hits = 0;
+  for (int i = 0; i < LOOKUPS;) {
+    for (const uint32_t cp : cps) {
+      hits += font.getGlyph(cp) != nullptr;
+    }
+    i += cps.size();
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  *found = hits;
+  return LOOKUPS / seconds;
+}
+
+void benchmark(const char* fontName, const EpdFontData& data, const Text& text) {
+  const std::vector<uint32_t> cps = decode(text.utf8);
+  const EpdFontData searched = withoutTables(data);
+  const EpdFont tableFont(&data);
+  const EpdFont searchFont(&searched);
+
+  int tableFound = 0;
+  int searchFound = 0;
+  const double tableRate = lookupsPerSecond(tableFont, cps, &tableFound);
+  const double searchRate = lookupsPerSecond(searchFont, cps, &searchFound);
+  printf("%-18s %-8s %4u intervals  search %7.1f M/s  tables %7.1f M/s  x%.1f%s\n", fontName, text.name,
+         data.intervalCount, searchRate / 1e6, tableRate / 1e6, tableRate / searchRate,
+         tableFound == searchFound ? "" : "  MISMATCH");
+}
+}  // namespace
+
+int main() {
+  const SyntheticCjkFont cjk;
+  bool ok = checkFont("synthetic CJK", cjk.data);
+  size_t tableBytes = 0;
+  for (const Font& font : FONTS) {
+    ok = checkFont(font.name, *font.data) && ok;
+    tableBytes += (EPD_FONT_DIRECT_GLYPHS + font.data->glyphPageCount) * sizeof(uint16_t);
+    for (uint32_t page = 0; page < font.data->glyphPageCount; page++) {
+      tableBytes += font.data->glyphPages[page] ? (1u << EPD_FONT_GLYPH_PAGE_SHIFT) * sizeof(uint16_t) : 0;
+    }
+  }
+  printf("Tables match a search of the intervals up to U+%X: %s\n", LAST_CHECKED_CP, ok ? "yes" : "NO");
+  printf("Table flash for the %zu fonts above: %zu bytes\n\n", sizeof(FONTS) / sizeof(FONTS[0]), tableBytes);
+
+  for (const Font& font : FONTS) {
+    for (const Text& text : TEXTS) {
+      benchmark(font.name, *font.data, text);
+    }
+  }
+  for (const Text& text : TEXTS) {
+    benchmark("synthetic CJK", cjk.data, text);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+#include <EpdFontFamily.h>
+#include <EpdGlyphCache.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <Utf8.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Fills a page with text in every orientation and render mode, once through GfxRenderer::drawText and once through
+// a per-pixel reference that mirrors the drawPixel based glyph loop it replaced, and reports glyphs per second for
+// both. The frame buffers of the two must match byte for byte.
+
+namespace {
+constexpr int BOOK_FONT_ID = 1;
+constexpr int UI_FONT_ID = 2;
+constexpr int MARGIN = 12;
+constexpr int ITERATIONS = 200;
+
+const char* const TEXT =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way.";
+
+struct Line {
+  int y;
+  std::string text;
+};
+
+// Greedy word wrap of TEXT, repeated until the page is full
+std::vector<Line> layoutPage(const GfxRenderer& renderer, const int fontId) {
+  const int maxWidth = renderer.getScreenWidth() - 2 * MARGIN;
+  const int lineHeight = renderer.getLineHeight(fontId);
+  std::vector<std::string> words;
+  for (const char* p = TEXT; *p;) {
+    const char* end = strchr(p, ' ');
+    if (!end) end = p + strlen(p);
+    words.emplace_back(p, end);
+    p = *end ? end + 1 : end;
+  }
+
+  std::vector<Line> lines;
+  size_t word = 0;
+  for (int y = MARGIN; y + lineHeight <= renderer.getScreenHeight() - MARGIN; y += lineHeight) {
+    std::string text;
+    while (true) {
+      const std::string candidate = text.empty() ? words[word] : text + " " + words[word];
+      if (!text.empty() && renderer.getTextWidth(fontId, candidate.c_str()) > maxWidth) break;
+      text = candidate;
+      word = (word + 1) % words.size();
+    }
+    lines.push_back({y, text});
+  }
+  return lines;
+}
+
+// The glyph loop GfxRenderer::renderChar used before the line blitter, kept as the baseline
+void referenceDrawText(const GfxRenderer& renderer, const EpdFontFamily& font, const int fontId,
+                       const GfxRenderer::RenderMode mode, const int x, const int y, const char* text) {
+  const int yPos = y + renderer.getFontAscenderSize(fontId);
+  int xPos = x;
+  const EpdFontData* data = font.getData();
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    const EpdGlyph* glyph = font.getGlyph(cp);
+    if (!glyph) continue;
+    static EpdGlyphCache glyphCache;
+    const uint8_t* bitmap = font.getGlyphBitmap(glyph, EpdFontFamily::REGULAR, &glyphCache);
+    if (!bitmap) {
+      xPos += glyph->advanceX;
+      continue;
+    }
+    for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+      const int screenY = yPos - glyph->top + glyphY;
+      for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+        const int pixelPosition = glyphY * glyph->width + glyphX;
+        const int screenX = xPos + glyph->left + glyphX;
+        if (data->is2Bit) {
+          // Grouped the way the old loop's precedence grouped it; modulo 4 this is 3 minus the 2-bit value
+          const uint8_t bmpVal = (3 - (bitmap[pixelPosition / 4] >> ((3 - pixelPosition % 4) * 2))) & 0x3;
+          if (mode == GfxRenderer::BW && bmpVal < 3) {
+            renderer.drawPixel(screenX, screenY, true);
+          } else if (mode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+            renderer.drawPixel(screenX, screenY, false);
+          } else if (mode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
+            renderer.drawPixel(screenX, screenY, false);
+          }
+        } else if ((bitmap[pixelPosition / 8] >> (7 - pixelPosition % 8)) & 1) {
+          renderer.drawPixel(screenX, screenY, true);
+        }
+      }
+    }
+    xPos += glyph->advanceX;
+  }
+}
+
+size_t countGlyphs(const std::vector<Line>& lines) {
+  size_t count = 0;
+  for (const auto& line : lines) {
+    const char* text = line.text.c_str();
+    while (utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text))) count++;
+  }
+  return count;
+}
+
+template <typename Fn>
+double timeMs(Fn&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; i++) fn();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+int main() {
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+
+  EpdFont bookRegular(&bookerly_14_regular);
+  EpdFont uiRegular(&ubuntu_10_regular);
+  const EpdFontFamily bookFont(&bookRegular);
+  const EpdFontFamily uiFont(&uiRegular);
+  renderer.insertFont(BOOK_FONT_ID, bookFont);
+  renderer.insertFont(UI_FONT_ID, uiFont);
+
+  struct Case {
+    const char* name;
+    int fontId;
+    const EpdFontFamily* font;
+    GfxRenderer::RenderMode mode;
+  };
+  const Case cases[] = {
+      {"2-bit BW", BOOK_FONT_ID, &bookFont, GfxRenderer::BW},
+      {"2-bit MSB", BOOK_FONT_ID, &bookFont, GfxRenderer::GRAYSCALE_MSB},
+      {"2-bit LSB", BOOK_FONT_ID, &bookFont, GfxRenderer::GRAYSCALE_LSB},
+      {"1-bit", UI_FONT_ID, &uiFont, GfxRenderer::BW},
+  };
+  const struct {
+    const char* name;
+    GfxRenderer::Orientation orientation;
+  } orientations[] = {{"Portrait", GfxRenderer::Portrait},
+                      {"LandscapeCW", GfxRenderer::LandscapeClockwise},
+                      {"PortraitInverted", GfxRenderer::PortraitInverted},
+                      {"LandscapeCCW", GfxRenderer::LandscapeCounterClockwise}};
+
+  std::vector<uint8_t> expected(HalDisplay::BUFFER_SIZE);
+  bool allMatch = true;
+  printf("%-17s %-10s %7s %14s %14s %8s\n", "orientation", "font/mode", "glyphs", "per-pixel g/s", "blit g/s",
+         "speedup");
+  for (const auto& o : orientations) {
+    renderer.setOrientation(o.orientation);
+    for (const auto& c : cases) {
+      const auto lines = layoutPage(renderer, c.fontId);
+      const size_t glyphs = countGlyphs(lines);
+      const uint8_t clearColor = c.mode == GfxRenderer::BW ? 0xFF : 0x00;
+      renderer.setRenderMode(c.mode);
+
+      const double referenceMs = timeMs([&] {
+        renderer.clearScreen(clearColor);
+        for (const auto& line : lines) {
+          referenceDrawText(renderer, *c.font, c.fontId, c.mode, MARGIN, line.y, line.text.c_str());
+        }
+      });
+      memcpy(expected.data(), renderer.getFrameBuffer(), HalDisplay::BUFFER_SIZE);
+
+      const double blitMs = timeMs([&] {
+        renderer.clearScreen(clearColor);
+        for (const auto& line : lines) {
+          renderer.drawText(c.fontId, MARGIN, line.y, line.text.c_str());
+        }
+      });
+      const bool match = memcmp(expected.data(), renderer.getFrameBuffer(), HalDisplay::BUFFER_SIZE) == 0;
+      allMatch &= match;
+
+      const double referenceRate = glyphs * ITERATIONS / (referenceMs / 1000.0);
+      const double blitRate = glyphs * ITERATIONS / (blitMs / 1000.0);
+      printf("%-17s %-10s %7zu %14.0f %14.0f %7.1fx%s\n", o.name, c.name, glyphs, referenceRate, blitRate,
+             blitRate / referenceRate, match ? "" : "  MISMATCH");
+    }
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  return allMatch ? 0 : 1;
+}
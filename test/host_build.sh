@@ -0,0 +1,82 @@
+#!/usr/bin/env bash
+# Shared build step for the host runners in this directory. Source it, then call
+#
+#   host_build <build dir name> <test source> [library sources...]
+#
+# which compiles the test, the host stubs and the given library sources into build/<build dir name>/ and sets
+# BUILD_DIR and BINARY. Pick the library sources from the groups below.
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+
+FONT_SOURCES=(
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFile.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdGlyphCache.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+RENDERER_SOURCES=(
+  "$ROOT_DIR/test/host_stubs/HostDisplay.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/FrameDiff.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "${FONT_SOURCES[@]}"
+)
+
+LAYOUT_SOURCES=(
+  "$ROOT_DIR/lib/Epub/Epub/Page.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/WordWidthCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "${RENDERER_SOURCES[@]}"
+)
+
+# Global operator new/delete that count allocations and the heap high-water mark, see CountingAllocator.h
+ALLOCATOR_SOURCES=(
+  "$ROOT_DIR/test/host_stubs/CountingAllocator.cpp"
+)
+
+ZIP_SOURCES=(
+  "$ROOT_DIR/lib/ZipFile/ZipFile.cpp"
+)
+
+# The generated font headers hold bidi control characters in their glyph comments; miniz is vendored and built with
+# its warnings off
+HOST_CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -include Arduino.h
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/test/host_stubs"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/miniz"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/ZipFile"
+  -I"$ROOT_DIR/src"
+)
+
+host_build() {
+  local name="$1"
+  local testSource="$2"
+  shift 2
+  BUILD_DIR="$ROOT_DIR/build/$name"
+  BINARY="$BUILD_DIR/$(basename "$testSource" .cpp)"
+
+  mkdir -p "$BUILD_DIR"
+  cc -O2 -w -DMINIZ_NO_ZLIB_COMPATIBLE_NAMES=1 -c "$ROOT_DIR/lib/miniz/miniz.c" -o "$BUILD_DIR/miniz.o"
+  c++ "${HOST_CXXFLAGS[@]}" "$testSource" "$ROOT_DIR/test/host_stubs/HostStubs.cpp" "$@" "$BUILD_DIR/miniz.o" \
+    -o "$BINARY"
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+// Minimal host-side stand-in for the Arduino core, just enough to build library code into desktop benchmarks.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t*>(addr))
+
+unsigned long millis();
+unsigned long micros();
+inline void delay(unsigned long) {}
+inline void yield() {}
+
+class EspClass {
+ public:
+  uint32_t getFreeHeap() { return 256 * 1024; }
+};
+inline EspClass ESP;
+
+class String {
+  std::string value;
+
+ public:
+  String(const char* s = "") : value(s) {}
+  String(const std::string& s) : value(s) {}
+  const char* c_str() const { return value.c_str(); }
+  size_t length() const { return value.length(); }
+  bool isEmpty() const { return value.empty(); }
+};
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), strlen(str)); }
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+#include <HardwareSerial.h>
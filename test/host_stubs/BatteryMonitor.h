@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+
+// Battery gauge with a fixed charge, enough for the themes to draw their status bar on the host
+class BatteryMonitor {
+ public:
+  explicit BatteryMonitor(int) {}
+  uint16_t readPercentage() const { return 73; }
+};
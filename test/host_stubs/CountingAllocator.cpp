@@ -0,0 +1,32 @@
+#include "CountingAllocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+size_t hostLiveBytes = 0;
+size_t hostPeakBytes = 0;
+size_t hostAllocationCount = 0;
+size_t hostAllocatedBytes = 0;
+
+// Size-prefixed global allocator so frees can be accounted for
+void* operator new(const size_t size) {
+  auto* block = static_cast<size_t*>(malloc(size + sizeof(size_t) * 2));
+  if (!block) throw std::bad_alloc();
+  block[0] = size;
+  hostLiveBytes += size;
+  hostAllocationCount++;
+  hostAllocatedBytes += size;
+  hostPeakBytes = std::max(hostPeakBytes, hostLiveBytes);
+  return block + 2;
+}
+
+// Kept out of line: inlined into std::string's destructor, GCC takes the size prefix for a read before the string
+__attribute__((noinline)) void operator delete(void* ptr) noexcept {
+  if (!ptr) return;
+  auto* block = static_cast<size_t*>(ptr) - 2;
+  hostLiveBytes -= block[0];
+  free(block);
+}
+
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+// Heap counters kept by the size-prefixed global allocator in CountingAllocator.cpp, for benchmarks to read and reset.
+// Link that file by adding ALLOCATOR_SOURCES to host_build.
+extern size_t hostLiveBytes;
+extern size_t hostPeakBytes;
+extern size_t hostAllocationCount;
+extern size_t hostAllocatedBytes;
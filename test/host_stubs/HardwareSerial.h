@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+
+// Log output is dropped unless HOST_STUBS_VERBOSE is set in the environment
+class HardwareSerial : public Print {
+ public:
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,51 @@
+#include <HalDisplay.h>
+
+#include <cstring>
+
+// HalDisplay over a static frame buffer so GfxRenderer can run unmodified on the host
+namespace {
+uint8_t frameBuffer[HalDisplay::BUFFER_SIZE];
+}  // namespace
+
+// Last gray planes handed to copyGrayscaleBuffers(), for tests to compare
+uint8_t hostGrayscaleLsb[HalDisplay::BUFFER_SIZE];
+uint8_t hostGrayscaleMsb[HalDisplay::BUFFER_SIZE];
+
+HalDisplay::HalDisplay() {}
+
+HalDisplay::~HalDisplay() {}
+
+void HalDisplay::begin() { clearScreen(); }
+
+void HalDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, BUFFER_SIZE); }
+
+void HalDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                           const uint16_t h, bool) const {
+  const uint16_t widthBytes = w / 8;
+  for (uint16_t row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+    memcpy(frameBuffer + (y + row) * DISPLAY_WIDTH_BYTES + x / 8, imageData + row * widthBytes, widthBytes);
+  }
+}
+
+void HalDisplay::displayBuffer(RefreshMode, bool) {}
+
+void HalDisplay::refreshDisplay(RefreshMode, bool) {}
+
+void HalDisplay::displayWindow(uint16_t, uint16_t, uint16_t, uint16_t) {}
+
+void HalDisplay::deepSleep() {}
+
+uint8_t* HalDisplay::getFrameBuffer() const { return frameBuffer; }
+
+void HalDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  memcpy(hostGrayscaleLsb, lsbBuffer, BUFFER_SIZE);
+  memcpy(hostGrayscaleMsb, msbBuffer, BUFFER_SIZE);
+}
+
+void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t*) {}
+
+void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t*) {}
+
+void HalDisplay::cleanupGrayscaleBuffers(const uint8_t*) {}
+
+void HalDisplay::displayGrayBuffer(bool) {}
@@ -0,0 +1,86 @@
+#include <Arduino.h>
+#include <HalStorage.h>
+#include <HardwareSerial.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <sys/stat.h>
+
+namespace {
+const auto startTime = std::chrono::steady_clock::now();
+
+bool verboseLogging() { return getenv("HOST_STUBS_VERBOSE") != nullptr; }
+}  // namespace
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+int Print::printf(const char* format, ...) {
+  char buffer[512];
+  va_list args;
+  va_start(args, format);
+  const int len = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (len > 0) {
+    write(reinterpret_cast<const uint8_t*>(buffer), strlen(buffer));
+  }
+  return len;
+}
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::write(const uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t* buffer, const size_t size) {
+  if (verboseLogging()) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
+
+// Only the file handle helpers are backed on the host; the SdFat-specific listing/streaming calls are not needed
+HalStorage HalStorage::instance;
+
+HalStorage::HalStorage() {}
+
+bool HalStorage::exists(const char* path) {
+  struct stat st;
+  return ::stat(path, &st) == 0;
+}
+
+bool HalStorage::remove(const char* path) { return ::remove(path) == 0; }
+
+bool HalStorage::mkdir(const char* path, const bool) { return ::mkdir(path, 0755) == 0 || exists(path); }
+
+bool HalStorage::openFileForRead(const char*, const char* path, FsFile& file) {
+  FILE* handle = fopen(path, "rb");
+  if (!handle) {
+    return false;
+  }
+  file = FsFile(handle);
+  return true;
+}
+
+bool HalStorage::openFileForRead(const char* moduleName, const std::string& path, FsFile& file) {
+  return openFileForRead(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForWrite(const char*, const char* path, FsFile& file) {
+  FILE* handle = fopen(path, "w+b");
+  if (!handle) {
+    return false;
+  }
+  file = FsFile(handle);
+  return true;
+}
+
+bool HalStorage::openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) {
+  return openFileForWrite(moduleName, path.c_str(), file);
+}
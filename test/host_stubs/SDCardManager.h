@@ -0,0 +1,75 @@
+#pragma once
+#include <Arduino.h>
+
+#include <cstdio>
+
+typedef int oflag_t;
+#define O_RDONLY 0x00
+#define O_WRONLY 0x01
+#define O_RDWR 0x02
+#define O_CREAT 0x40
+#define O_TRUNC 0x200
+
+// SdFat FsFile over a stdio FILE. Copies share the handle like SdFat's do. Every call that would reach the card
+// on device bumps the static counters so benchmarks can report SD traffic next to wall time.
+class FsFile : public Stream {
+  FILE* handle = nullptr;
+
+ public:
+  static inline uint32_t readCalls = 0;
+  static inline uint32_t writeCalls = 0;
+  static inline uint32_t seekCalls = 0;
+  static void resetCounters() { readCalls = writeCalls = seekCalls = 0; }
+
+  FsFile() = default;
+  explicit FsFile(FILE* handle) : handle(handle) {}
+
+  int read(void* buffer, size_t size) {
+    readCalls++;
+    return static_cast<int>(fread(buffer, 1, size, handle));
+  }
+  int read() override {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int peek() override {
+    const int c = fgetc(handle);
+    if (c >= 0) ungetc(c, handle);
+    return c;
+  }
+  int available() override { return static_cast<int>(size() - position()); }
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    writeCalls++;
+    return fwrite(buffer, 1, size, handle);
+  }
+  size_t write(const void* buffer, size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+  bool seek(uint64_t pos) {
+    seekCalls++;
+    return fseek(handle, static_cast<long>(pos), SEEK_SET) == 0;
+  }
+  bool seekSet(uint64_t pos) { return seek(pos); }
+  bool seekCur(int64_t offset) {
+    seekCalls++;
+    return fseek(handle, static_cast<long>(offset), SEEK_CUR) == 0;
+  }
+  uint64_t position() const { return ftell(handle); }
+  uint64_t curPosition() const { return position(); }
+  uint64_t size() const {
+    const long pos = ftell(handle);
+    fseek(handle, 0, SEEK_END);
+    const long end = ftell(handle);
+    fseek(handle, pos, SEEK_SET);
+    return end;
+  }
+  uint64_t fileSize() const { return size(); }
+  void flush() override { fflush(handle); }
+  bool sync() { return fflush(handle) == 0; }
+  bool isOpen() const { return handle != nullptr; }
+  operator bool() const { return isOpen(); }
+  bool close() {
+    if (handle) fclose(handle);
+    handle = nullptr;
+    return true;
+  }
+};
@@ -0,0 +1,4 @@
+#pragma once
+
+// String lives in the Arduino.h stub
+#include <Arduino.h>
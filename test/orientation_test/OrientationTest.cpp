@@ -0,0 +1,198 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Draws the same scenes in every orientation through the row-wise drawing paths, turns each frame buffer and gray
+// plane back into the picture the reader sees a pixel at a time, and fails unless the two orientations sharing a
+// screen size, Portrait with PortraitInverted and LandscapeClockwise with LandscapeCounterClockwise (the panel's own
+// layout), show the same picture pixel for pixel.
+
+extern uint8_t hostGrayscaleLsb[HalDisplay::BUFFER_SIZE];
+extern uint8_t hostGrayscaleMsb[HalDisplay::BUFFER_SIZE];
+
+namespace {
+constexpr int BOOK_FONT_ID = 1;
+constexpr int UI_FONT_ID = 2;
+constexpr int MARGIN = 12;
+
+const char* const TEXT =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way.";
+
+// Greedy word wrap of TEXT, repeated until the page is full
+void drawTextPage(GfxRenderer& renderer) {
+  std::vector<std::string> words;
+  for (const char* p = TEXT; *p;) {
+    const char* end = strchr(p, ' ');
+    if (!end) end = p + strlen(p);
+    words.emplace_back(p, end);
+    p = *end ? end + 1 : end;
+  }
+
+  const int maxWidth = renderer.getScreenWidth() - 2 * MARGIN;
+  const int lineHeight = renderer.getLineHeight(BOOK_FONT_ID);
+  size_t word = 0;
+  for (int y = MARGIN; y + lineHeight <= renderer.getScreenHeight() - 3 * MARGIN; y += lineHeight) {
+    std::string text;
+    while (true) {
+      const std::string candidate = text.empty() ? words[word] : text + " " + words[word];
+      if (!text.empty() && renderer.getTextWidth(BOOK_FONT_ID, candidate.c_str()) > maxWidth) break;
+      text = candidate;
+      word = (word + 1) % words.size();
+    }
+    renderer.drawText(BOOK_FONT_ID, MARGIN, y, text.c_str());
+  }
+  renderer.drawText(UI_FONT_ID, MARGIN, renderer.getScreenHeight() - 2 * MARGIN, "12 / 240   Chapter 3");
+}
+
+void drawShapes(GfxRenderer& renderer) {
+  const int w = renderer.getScreenWidth();
+  const int h = renderer.getScreenHeight();
+  renderer.drawRect(MARGIN, MARGIN, w - 2 * MARGIN, h - 2 * MARGIN, 3, true);
+  renderer.fillRect(30, 40, 123, 77);
+  renderer.fillRect(60, 60, 31, 17, false);
+  renderer.drawLine(5, 200, w - 7, 200, 2, true);
+  renderer.drawLine(w / 2, 130, w / 2, h - 20);
+  renderer.fillRectDither(170, 40, 101, 93, Color::LightGray);
+  renderer.fillRectDither(20, 230, 141, 61, Color::DarkGray);
+  renderer.drawRoundedRect(190, 240, 150, 90, 2, 14, true);
+  renderer.fillRoundedRect(30, 320, 160, 70, 12, Color::DarkGray);
+  renderer.fillRoundedRect(220, 350, 120, 80, 20, true, false, false, true, Color::Black);
+  const int xs[] = {40, 200, 120, 60};
+  const int ys[] = {420, 440, 560, 520};
+  renderer.fillPolygon(xs, ys, 4);
+  renderer.drawText(BOOK_FONT_ID, 20, h - 80, "Shapes and text", true, EpdFontFamily::BOLD);
+}
+
+void drawNothing(GfxRenderer&) {}
+
+// The clip rectangle is widened to whole bytes along panel rows, which run down the screen in portrait, so this one is
+// byte aligned both ways
+void drawClipped(GfxRenderer& renderer) {
+  drawTextPage(renderer);
+  renderer.setClipRect(40, 96, 152, 96);
+  renderer.clearScreen();
+  renderer.fillRectDither(0, 0, renderer.getScreenWidth(), renderer.getScreenHeight(), Color::LightGray);
+  renderer.drawText(BOOK_FONT_ID, 20, 120, "Clipped to the box and beyond it");
+}
+
+struct Scene {
+  const char* name;
+  void (*draw)(GfxRenderer&);
+  bool grayPlanes;
+};
+
+// Picture as the reader sees it, a byte per pixel, read back from a panel buffer through the orientation's rotation
+std::vector<uint8_t> logicalPicture(const uint8_t* buffer, const GfxRenderer::Orientation orientation, const int width,
+                                    const int height) {
+  std::vector<uint8_t> picture(width * height);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      int phyX = x, phyY = y;
+      switch (orientation) {
+        case GfxRenderer::Portrait:
+          phyX = y;
+          phyY = HalDisplay::DISPLAY_HEIGHT - 1 - x;
+          break;
+        case GfxRenderer::LandscapeClockwise:
+          phyX = HalDisplay::DISPLAY_WIDTH - 1 - x;
+          phyY = HalDisplay::DISPLAY_HEIGHT - 1 - y;
+          break;
+        case GfxRenderer::PortraitInverted:
+          phyX = HalDisplay::DISPLAY_WIDTH - 1 - y;
+          phyY = x;
+          break;
+        case GfxRenderer::LandscapeCounterClockwise:
+          break;
+      }
+      picture[y * width + x] = buffer[phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8] >> (7 - phyX % 8) & 1;
+    }
+  }
+  return picture;
+}
+
+struct Result {
+  std::vector<uint8_t> bw;
+  std::vector<uint8_t> lsb;
+  std::vector<uint8_t> msb;
+};
+
+Result render(GfxRenderer& renderer, const Scene& scene, const GfxRenderer::Orientation orientation) {
+  renderer.setOrientation(orientation);
+  renderer.clearScreen();
+  if (scene.grayPlanes) {
+    renderer.beginGrayscalePlanes();
+  }
+  scene.draw(renderer);
+  if (scene.grayPlanes) {
+    renderer.endGrayscalePlanes();
+  }
+  renderer.clearClipRect();
+
+  const int width = renderer.getScreenWidth();
+  const int height = renderer.getScreenHeight();
+  Result result;
+  result.bw = logicalPicture(renderer.getFrameBuffer(), orientation, width, height);
+  if (scene.grayPlanes) {
+    renderer.copyGrayscalePlanes();
+    result.lsb = logicalPicture(hostGrayscaleLsb, orientation, width, height);
+    result.msb = logicalPicture(hostGrayscaleMsb, orientation, width, height);
+  }
+  return result;
+}
+}  // namespace
+
+int main() {
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  EpdFont bookFont(&bookerly_14_regular);
+  EpdFont uiFont(&ubuntu_10_regular);
+  renderer.insertFont(BOOK_FONT_ID, EpdFontFamily(&bookFont, &bookFont));
+  renderer.insertFont(UI_FONT_ID, EpdFontFamily(&uiFont));
+
+  const Scene scenes[] = {
+      {"blank", drawNothing, false},
+      {"text", drawTextPage, false},
+      {"shapes", drawShapes, false},
+      {"clipped", drawClipped, false},
+      {"gray planes", drawTextPage, true},
+  };
+  const struct {
+    const char* name;
+    GfxRenderer::Orientation orientation;
+    GfxRenderer::Orientation reference;
+  } orientations[] = {
+      {"PortraitInverted", GfxRenderer::PortraitInverted, GfxRenderer::Portrait},
+      {"LandscapeClockwise", GfxRenderer::LandscapeClockwise, GfxRenderer::LandscapeCounterClockwise},
+  };
+
+  bool ok = true;
+  printf("%-20s %-12s %8s\n", "orientation", "scene", "result");
+  for (const auto& o : orientations) {
+    for (const auto& scene : scenes) {
+      const Result reference = render(renderer, scene, o.reference);
+      const Result rotated = render(renderer, scene, o.orientation);
+      const bool match = reference.bw == rotated.bw && reference.lsb == rotated.lsb && reference.msb == rotated.msb;
+      ok = ok && match;
+      printf("%-20s %-12s %8s\n", o.name, scene.name, match ? "match" : "DIFFER");
+    }
+  }
+
+  renderer.releaseGrayscalePlanes();
+  if (!ok) {
+    printf("!! Drawing differs between orientations of the same screen size\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,183 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <builtinFonts/bookerly_12_bold.h>
+#include <builtinFonts/bookerly_12_bolditalic.h>
+#include <builtinFonts/bookerly_12_italic.h>
+#include <builtinFonts/bookerly_12_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CountingAllocator.h"
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+// Lays out dense pages of the smallest reader font into a section-like file, then turns through them loading each
+// page with Page::deserialize and with PageView, and reports the load time, the time with the BW and both grayscale
+// render passes on top, and the heap churn and high-water mark per page turn. Also checks that PageView turns down
+// every page cut short by a byte or claiming more than MAX_PAGE_BYTES instead of allocating for it.
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr uint16_t VIEWPORT_WIDTH = 464;
+constexpr uint16_t VIEWPORT_HEIGHT = 760;
+constexpr float LINE_COMPRESSION = 0.95f;
+constexpr int PAGES = 200;
+constexpr int RUNS = 5;
+
+struct PageRange {
+  uint32_t offset;
+  uint32_t size;
+};
+
+// Writes PAGES pages of generated text to path, back to back like a section file, and returns their byte ranges
+std::vector<PageRange> writePages(const GfxRenderer& renderer, const std::string& path) {
+  static const char* const vocabulary[] = {
+      "the",     "of",         "and",      "reading", "light",   "quietly", "through",   "window", "remembered",
+      "she",     "he",         "they",     "was",     "morning", "library", "a",         "in",     "river,",
+      "said.",   "\"Perhaps",  "never\"",  "it",      "to",      "walked",  "slowly",    "toward", "home.",
+      "I",       "had",        "not",      "known",   "what",    "to",      "say,",      "but",    "smiled."};
+  constexpr size_t vocabularySize = sizeof(vocabulary) / sizeof(vocabulary[0]);
+
+  FsFile file;
+  Storage.openFileForWrite("BENCH", path, file);
+  std::vector<PageRange> ranges;
+  const int lineHeight = renderer.getLineHeight(FONT_ID) * LINE_COMPRESSION;
+  const int linesPerPage = VIEWPORT_HEIGHT / lineHeight;
+
+  auto page = std::unique_ptr<Page>(new Page());
+  int linesOnPage = 0;
+  const auto addLine = [&](const std::shared_ptr<TextBlock>& line) {
+    if (linesOnPage == linesPerPage) {
+      const uint32_t offset = file.position();
+      page->serialize(file);
+      ranges.push_back({offset, static_cast<uint32_t>(file.position() - offset)});
+      page.reset(new Page());
+      linesOnPage = 0;
+    }
+    page->elements.push_back(std::make_shared<PageLine>(line, 0, linesOnPage * lineHeight));
+    linesOnPage++;
+  };
+
+  std::mt19937 rng(1234);
+  while (ranges.size() < PAGES) {
+    ParsedText text(false, true);
+    const size_t wordCount = 30 + rng() % 150;
+    for (size_t i = 0; i < wordCount; i++) {
+      text.addWord(vocabulary[rng() % vocabularySize], i % 37 == 5 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR);
+    }
+    text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, addLine);
+  }
+  file.close();
+  ranges.resize(PAGES);
+  return ranges;
+}
+
+struct Result {
+  double micros;
+  double allocations;
+  double bytes;
+  size_t highWater;
+};
+
+// Loads (and with render set, draws in all three passes) every page RUNS times through load, best time per page
+template <typename Load>
+Result turnPages(GfxRenderer& renderer, const std::vector<PageRange>& ranges, const bool render, Load&& load) {
+  const size_t baselineBytes = hostLiveBytes;
+  hostPeakBytes = hostLiveBytes;
+  hostAllocationCount = 0;
+  hostAllocatedBytes = 0;
+  double best = 1e18;
+  for (int run = 0; run < RUNS; run++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& range : ranges) {
+      load(range, [&](const auto& page) {
+        if (render) {
+          for (const auto mode : {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB}) {
+            renderer.setRenderMode(mode);
+            page.render(renderer, FONT_ID, 0, 0);
+          }
+        }
+      });
+    }
+    best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+  const double turns = static_cast<double>(RUNS) * ranges.size();
+  return {best / ranges.size(), hostAllocationCount / turns, hostAllocatedBytes / turns,
+          hostPeakBytes - baselineBytes};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string workDir = argc > 1 ? argv[1] : ".";
+  const std::string path = workDir + "/pages.bin";
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+
+  EpdFont regular(&bookerly_12_regular);
+  EpdFont bold(&bookerly_12_bold);
+  EpdFont italic(&bookerly_12_italic);
+  EpdFont boldItalic(&bookerly_12_bolditalic);
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+  Hyphenator::setPreferredLanguage("en");
+
+  const std::vector<PageRange> ranges = writePages(renderer, path);
+  uint32_t largestPage = 0;
+  for (const auto& range : ranges) {
+    largestPage = std::max(largestPage, range.size);
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("BENCH", path, file)) {
+    fprintf(stderr, "Failed to open %s\n", path.c_str());
+    return 1;
+  }
+
+  // As Section::loadPageFromSectionFile and EpubReaderActivity used it
+  const auto loadPage = [&](const PageRange& range, const auto& use) {
+    file.seek(range.offset);
+    const auto page = Page::deserialize(file);
+    use(*page);
+  };
+  // As EpubReaderActivity keeps one view alive across page turns
+  PageView view;
+  const auto loadView = [&](const PageRange& range, const auto& use) {
+    view.load(file, range.offset, range.size);
+    use(view);
+  };
+
+  printf("%d pages, largest %u bytes, average %u bytes\n\n", PAGES, largestPage,
+         static_cast<uint32_t>((ranges.back().offset + ranges.back().size) / ranges.size()));
+  printf("%-17s %10s %14s %12s %14s %12s\n", "", "load", "load + render", "allocations", "bytes", "high-water");
+  for (const bool useView : {false, true}) {
+    const Result loaded =
+        useView ? turnPages(renderer, ranges, false, loadView) : turnPages(renderer, ranges, false, loadPage);
+    const Result rendered =
+        useView ? turnPages(renderer, ranges, true, loadView) : turnPages(renderer, ranges, true, loadPage);
+    printf("%-17s %7.1f us %11.1f us %12.1f %14.0f %12zu\n", useView ? "PageView" : "Page::deserialize",
+           loaded.micros, rendered.micros, rendered.allocations, rendered.bytes, rendered.highWater);
+  }
+
+  bool rejected = true;
+  for (const auto& range : ranges) {
+    rejected = rejected && !view.load(file, range.offset, range.size - 1);
+  }
+  rejected = rejected && !view.load(file, 0, PageView::MAX_PAGE_BYTES + 1);
+  file.close();
+  Storage.remove(path.c_str());
+  printf("\nTruncated and oversized pages rejected: %s\n", rejected ? "yes" : "NO");
+  return rejected ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build bitmap_blit_benchmark "$ROOT_DIR/test/bitmap_blit_benchmark/BitmapBlitBenchmark.cpp" \
+  "${RENDERER_SOURCES[@]}"
+
+"$BINARY" "$@"
@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build compressed_font_benchmark "$ROOT_DIR/test/compressed_font_benchmark/CompressedFontBenchmark.cpp" \
+  "${RENDERER_SOURCES[@]}"
+
+"$BINARY" "$@"
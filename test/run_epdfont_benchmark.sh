@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build epdfont_benchmark "$ROOT_DIR/test/epdfont_benchmark/EpdFontBenchmark.cpp" \
+  "${RENDERER_SOURCES[@]}"
+
+"$BINARY" "$@"
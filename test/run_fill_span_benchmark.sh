@@ -0,0 +1,10 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build fill_span_benchmark "$ROOT_DIR/test/fill_span_benchmark/FillSpanBenchmark.cpp" \
+  "${RENDERER_SOURCES[@]}" \
+  "$ROOT_DIR/src/components/themes/BaseTheme.cpp" "$ROOT_DIR/src/components/themes/lyra/LyraTheme.cpp"
+
+"$BINARY" "$@"
@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build frame_diff_trace "$ROOT_DIR/test/frame_diff_trace/FrameDiffTrace.cpp" \
+  "${RENDERER_SOURCES[@]}"
+
+"$BINARY" "$@"
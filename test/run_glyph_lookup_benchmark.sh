@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build glyph_lookup_benchmark "$ROOT_DIR/test/glyph_lookup_benchmark/GlyphLookupBenchmark.cpp" \
+  "${FONT_SOURCES[@]}"
+
+"$BINARY" "$@"
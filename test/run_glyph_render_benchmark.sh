@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build glyph_render_benchmark "$ROOT_DIR/test/glyph_render_benchmark/GlyphRenderBenchmark.cpp" \
+  "${RENDERER_SOURCES[@]}"
+
+"$BINARY" "$@"
@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build orientation_test "$ROOT_DIR/test/orientation_test/OrientationTest.cpp" \
+  "${RENDERER_SOURCES[@]}"
+
+"$BINARY" "$@"
@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build page_load_benchmark "$ROOT_DIR/test/page_load_benchmark/PageLoadBenchmark.cpp" \
+  "${LAYOUT_SOURCES[@]}" "${ALLOCATOR_SOURCES[@]}"
+
+"$BINARY" "$BUILD_DIR" "$@"
@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build text_layout_benchmark "$ROOT_DIR/test/text_layout_benchmark/TextLayoutBenchmark.cpp" \
+  "${LAYOUT_SOURCES[@]}" "${ALLOCATOR_SOURCES[@]}"
+
+"$BINARY" "$@"
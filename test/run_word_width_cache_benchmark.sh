@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build word_width_cache_benchmark "$ROOT_DIR/test/word_width_cache_benchmark/WordWidthCacheBenchmark.cpp" \
+  "${LAYOUT_SOURCES[@]}"
+
+"$BINARY" "$ROOT_DIR/test/hyphenation_eval/resources/english_hyphenation_tests.txt" "$BUILD_DIR" "$@"
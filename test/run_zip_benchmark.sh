@@ -0,0 +1,9 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+source "$(dirname "${BASH_SOURCE[0]}")/host_build.sh"
+
+host_build zip_benchmark "$ROOT_DIR/test/zip_benchmark/ZipCentralDirBenchmark.cpp" \
+  "${ZIP_SOURCES[@]}"
+
+"$BINARY" "$BUILD_DIR" "$@"
@@ -0,0 +1,130 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CountingAllocator.h"
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+// Runs roughly 1MB of generated chapter text through the same ParsedText -> TextBlock -> Page path that
+// ChapterHtmlSlimParser drives, and reports wall time, heap allocations and the heap high-water mark.
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr uint16_t VIEWPORT_WIDTH = 464;
+constexpr int LINES_PER_PAGE = 26;
+constexpr size_t TARGET_TEXT_BYTES = 1024 * 1024;
+// Matches ChapterHtmlSlimParser's split threshold for very long paragraphs
+constexpr size_t MAX_BUFFERED_WORDS = 750;
+
+std::vector<std::vector<std::string>> generateParagraphs() {
+  static const char* const vocabulary[] = {
+      "the",        "of",          "and",         "reading",    "light",     "quietly",           "through",
+      "window",     "remembered",  "extraordinary", "she",      "he",        "they",              "was",
+      "morning",    "conversation", "unbelievably", "library",  "a",         "in",                "river,",
+      "said.",      "\"Perhaps",   "never\"",     "internationalization", "mountains", "counterrevolutionary", "it",
+      "to",         "yesterday",   "characteristically", "walked", "slowly",  "toward",            "home."};
+  constexpr size_t vocabularySize = sizeof(vocabulary) / sizeof(vocabulary[0]);
+
+  std::mt19937 rng(1234);
+  std::vector<std::vector<std::string>> paragraphs;
+  size_t totalBytes = 0;
+  while (totalBytes < TARGET_TEXT_BYTES) {
+    // Mostly ordinary paragraphs with the occasional very long one that trips the split path
+    const size_t wordCount = rng() % 20 == 0 ? 1500 + rng() % 1500 : 20 + rng() % 180;
+    std::vector<std::string> paragraph;
+    paragraph.reserve(wordCount);
+    for (size_t i = 0; i < wordCount; i++) {
+      paragraph.emplace_back(vocabulary[rng() % vocabularySize]);
+      totalBytes += paragraph.back().size() + 1;
+    }
+    paragraphs.push_back(std::move(paragraph));
+  }
+  return paragraphs;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  // Pages go to /dev/null unless a path is given, which allows comparing the output of two builds
+  const char* outputPath = argc > 1 ? argv[1] : "/dev/null";
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+
+  EpdFont regular(&bookerly_14_regular);
+  EpdFont bold(&bookerly_14_bold);
+  EpdFont italic(&bookerly_14_italic);
+  EpdFont boldItalic(&bookerly_14_bolditalic);
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+  Hyphenator::setPreferredLanguage("en");
+
+  const auto paragraphs = generateParagraphs();
+
+  FsFile sink;
+  if (!Storage.openFileForWrite("BENCH", outputPath, sink)) {
+    fprintf(stderr, "Failed to open %s\n", outputPath);
+    return 1;
+  }
+
+  size_t lineCount = 0;
+  size_t pageCount = 0;
+  const size_t baselineBytes = hostLiveBytes;
+  hostPeakBytes = hostLiveBytes;
+  hostAllocationCount = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  {
+    auto page = std::unique_ptr<Page>(new Page());
+    int linesOnPage = 0;
+    const auto addLine = [&](const std::shared_ptr<TextBlock>& line) {
+      if (linesOnPage == LINES_PER_PAGE) {
+        page->serialize(sink);
+        page.reset(new Page());
+        linesOnPage = 0;
+        pageCount++;
+      }
+      page->elements.push_back(std::make_shared<PageLine>(line, 0, linesOnPage * 30));
+      linesOnPage++;
+      lineCount++;
+    };
+
+    for (const auto& paragraph : paragraphs) {
+      ParsedText text(false, true);
+      for (size_t i = 0; i < paragraph.size(); i++) {
+        text.addWord(paragraph[i].c_str(), i % 37 == 0 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR);
+        if (text.size() > MAX_BUFFERED_WORDS) {
+          text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, addLine, false);
+        }
+      }
+      text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, addLine);
+    }
+    page->serialize(sink);
+    pageCount++;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  sink.close();
+
+  printf("paragraphs:      %zu\n", paragraphs.size());
+  printf("lines:           %zu\n", lineCount);
+  printf("pages:           %zu\n", pageCount);
+  printf("time:            %.1f ms\n", std::chrono::duration<double, std::milli>(end - start).count());
+  printf("allocations:     %zu\n", hostAllocationCount);
+  printf("heap high-water: %zu bytes\n", hostPeakBytes - baselineBytes);
+  return 0;
+}
@@ -0,0 +1,297 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/WordWidthCache.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+// Lays out a novel-length book chapter by chapter through the ParsedText -> TextBlock -> Page path that
+// ChapterHtmlSlimParser drives, with one WordWidthCache per chapter the way the parser keeps one per section build,
+// and reports the cache's hit rate, the total indexing time and the time spent measuring words against doing without
+// it. Pages must come out byte for byte the same. No book ships with the repo, so the text is drawn from the word
+// frequencies of the novel behind the English hyphenation test data (its 5000 most common words of six letters or
+// more) and the usual frequencies of short English words, with punctuation, capitals after full stops, and some
+// italics.
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr uint16_t VIEWPORT_WIDTH = 464;
+constexpr int LINES_PER_PAGE = 26;
+constexpr int CHAPTERS = 30;
+constexpr int WORDS_PER_CHAPTER = 4000;
+// Share of words in English fiction with six letters or more
+constexpr double LONG_WORD_SHARE = 0.22;
+// Matches ChapterHtmlSlimParser's split threshold for very long paragraphs
+constexpr size_t MAX_BUFFERED_WORDS = 750;
+constexpr int RUNS = 5;
+
+struct WeightedWord {
+  std::string word;
+  double weight;
+};
+
+// Words of up to five letters by rough frequency in fiction, per 10000 words
+const WeightedWord SHORT_WORDS[] = {
+    {"the", 560}, {"and", 300}, {"of", 280}, {"to", 260}, {"a", 220}, {"he", 160}, {"was", 150}, {"in", 150},
+    {"I", 120},   {"it", 110},  {"that", 110}, {"his", 100}, {"you", 90}, {"had", 90}, {"her", 80}, {"she", 70},
+    {"with", 70}, {"for", 70},  {"on", 60},   {"as", 60},  {"at", 55},  {"not", 50}, {"but", 50}, {"him", 45},
+    {"they", 40}, {"be", 40},   {"said", 40}, {"have", 40}, {"from", 30}, {"all", 30}, {"were", 30}, {"by", 30},
+    {"this", 30}, {"would", 28}, {"there", 25}, {"what", 25}, {"one", 25}, {"so", 25}, {"out", 20}, {"up", 20},
+    {"no", 20},   {"if", 20},   {"or", 20},   {"them", 20}, {"been", 20}, {"could", 20}, {"into", 18}, {"me", 18},
+    {"an", 17},   {"my", 17},   {"we", 17},   {"is", 15},  {"then", 15}, {"do", 15},  {"like", 14}, {"back", 14},
+    {"now", 13},  {"their", 13}, {"who", 13}, {"when", 13}, {"did", 12}, {"just", 12}, {"about", 12}, {"know", 11},
+    {"over", 10}, {"down", 10}, {"only", 10}, {"more", 10}, {"how", 10}, {"some", 10}, {"can", 10}, {"see", 9},
+    {"its", 9},   {"your", 9},  {"man", 9},   {"time", 9}, {"eyes", 8}, {"away", 8}, {"head", 8}, {"still", 8},
+    {"even", 8},  {"other", 7}, {"hand", 7},  {"face", 7}, {"door", 7}, {"than", 7}, {"again", 7}, {"where", 7},
+    {"which", 7}, {"after", 6}, {"well", 6},  {"here", 6}, {"way", 6},  {"any", 5},  {"why", 5},  {"too", 5},
+    {"got", 5},   {"long", 5},  {"two", 5},   {"our", 5},  {"us", 5},   {"room", 5}, {"told", 5}, {"went", 5},
+    {"came", 5},  {"make", 5},  {"felt", 4},  {"think", 4}, {"first", 4}, {"last", 4}, {"want", 4}, {"yes", 4},
+    {"must", 4},  {"never", 4}, {"much", 4},  {"may", 4},  {"am", 4},   {"are", 4},  {"will", 4}, {"off", 4},
+};
+
+std::vector<WeightedWord> loadLongWords(const char* path) {
+  std::vector<WeightedWord> words;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t firstBar = line.find('|');
+    const size_t lastBar = line.rfind('|');
+    if (firstBar == std::string::npos || lastBar == firstBar) {
+      continue;
+    }
+    words.push_back({line.substr(0, firstBar), std::stod(line.substr(lastBar + 1))});
+  }
+  return words;
+}
+
+std::discrete_distribution<size_t> distributionOf(const std::vector<WeightedWord>& words) {
+  std::vector<double> weights;
+  for (const auto& word : words) {
+    weights.push_back(word.weight);
+  }
+  return std::discrete_distribution<size_t>(weights.begin(), weights.end());
+}
+
+// Chapters of paragraphs of words
+using Book = std::vector<std::vector<std::vector<std::string>>>;
+
+Book generateBook(const std::vector<WeightedWord>& longWords) {
+  const std::vector<WeightedWord> shortWords(std::begin(SHORT_WORDS), std::end(SHORT_WORDS));
+  auto pickShort = distributionOf(shortWords);
+  auto pickLong = distributionOf(longWords);
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+  Book book(CHAPTERS);
+  for (auto& chapter : book) {
+    int words = 0;
+    while (words < WORDS_PER_CHAPTER) {
+      const int wordCount = chance(rng) < 0.03 ? 800 + rng() % 800 : 15 + rng() % 150;
+      std::vector<std::string> paragraph;
+      bool sentenceStart = true;
+      bool quoted = chance(rng) < 0.3;
+      for (int i = 0; i < wordCount; i++) {
+        std::string word =
+            chance(rng) < LONG_WORD_SHARE ? longWords[pickLong(rng)].word : shortWords[pickShort(rng)].word;
+        if (sentenceStart) {
+          word[0] = static_cast<char>(toupper(word[0]));
+          if (quoted && i == 0) {
+            word = "\xE2\x80\x9C" + word;
+          }
+        }
+        sentenceStart = false;
+        const double punctuation = chance(rng);
+        if (i == wordCount - 1 || punctuation < 0.07) {
+          word += i == wordCount - 1 && quoted ? ".\xE2\x80\x9D" : ".";
+          sentenceStart = true;
+        } else if (punctuation < 0.15) {
+          word += ",";
+        } else if (punctuation < 0.16) {
+          word += "?";
+          sentenceStart = true;
+        }
+        paragraph.push_back(std::move(word));
+      }
+      words += wordCount;
+      chapter.push_back(std::move(paragraph));
+    }
+  }
+  return book;
+}
+
+struct Result {
+  double milliseconds;
+  uint32_t hits;
+  uint32_t misses;
+  size_t cacheBytes;
+};
+
+// Lays out every chapter, each with a fresh cache of the given capacity (0 for none), writing the pages to outputPath
+Result layoutBook(const GfxRenderer& renderer, const Book& book, const int capacity, const std::string& outputPath) {
+  FsFile sink;
+  Storage.openFileForWrite("BENCH", outputPath, sink);
+  Result result{};
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& chapter : book) {
+    std::unique_ptr<WordWidthCache> widthCache(capacity > 0 ? new WordWidthCache(capacity) : nullptr);
+    auto page = std::unique_ptr<Page>(new Page());
+    int linesOnPage = 0;
+    const auto addLine = [&](const std::shared_ptr<TextBlock>& line) {
+      if (linesOnPage == LINES_PER_PAGE) {
+        page->serialize(sink);
+        page.reset(new Page());
+        linesOnPage = 0;
+      }
+      page->elements.push_back(std::make_shared<PageLine>(line, 0, linesOnPage * 30));
+      linesOnPage++;
+    };
+
+    for (const auto& paragraph : chapter) {
+      ParsedText text(false, true);
+      for (size_t i = 0; i < paragraph.size(); i++) {
+        text.addWord(paragraph[i].c_str(), i % 40 == 7 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR);
+        if (text.size() > MAX_BUFFERED_WORDS) {
+          text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, addLine, false, widthCache.get());
+        }
+      }
+      text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH, addLine, true, widthCache.get());
+    }
+    page->serialize(sink);
+    if (widthCache) {
+      result.hits += widthCache->getHits();
+      result.misses += widthCache->getMisses();
+      result.cacheBytes = widthCache->getAllocatedBytes();
+    }
+  }
+  result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  sink.close();
+  return result;
+}
+
+// Time to measure every word of the book, each chapter with a fresh cache of the given capacity (0 for none), as
+// ParsedText::calculateWordWidths does before breaking lines
+double measureBook(const GfxRenderer& renderer, const Book& book, const int capacity, uint32_t* checksum) {
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& chapter : book) {
+    std::unique_ptr<WordWidthCache> widthCache(capacity > 0 ? new WordWidthCache(capacity) : nullptr);
+    for (const auto& paragraph : chapter) {
+      for (size_t i = 0; i < paragraph.size(); i++) {
+        const std::string& word = paragraph[i];
+        const auto style = i % 40 == 7 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR;
+        uint16_t width;
+        WordWidthCache::Key key{};
+        if (widthCache) {
+          key = widthCache->key(FONT_ID, style, word.data(), word.size());
+        }
+        if (!widthCache || !widthCache->get(key, &width)) {
+          width = renderer.measureText(FONT_ID, word, style, EpdFont::MEASURE_SKIP_SOFT_HYPHENS);
+          if (widthCache) {
+            widthCache->put(key, width);
+          }
+        }
+        *checksum = *checksum * 31 + width;
+      }
+    }
+  }
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string readFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <english_hyphenation_tests.txt> <output dir>\n", argv[0]);
+    return 1;
+  }
+  const std::vector<WeightedWord> longWords = loadLongWords(argv[1]);
+  if (longWords.empty()) {
+    fprintf(stderr, "No words in %s\n", argv[1]);
+    return 1;
+  }
+  const std::string outputDir = argv[2];
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  EpdFont regular(&bookerly_14_regular);
+  EpdFont bold(&bookerly_14_bold);
+  EpdFont italic(&bookerly_14_italic);
+  EpdFont boldItalic(&bookerly_14_bolditalic);
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+  Hyphenator::setPreferredLanguage("en");
+
+  const Book book = generateBook(longWords);
+  size_t words = 0;
+  size_t bytes = 0;
+  for (const auto& chapter : book) {
+    for (const auto& paragraph : chapter) {
+      for (const auto& word : paragraph) {
+        words++;
+        bytes += word.size() + 1;
+      }
+    }
+  }
+  printf("%d chapters, %zu words, %zu bytes of text\n\n", CHAPTERS, words, bytes);
+
+  const std::string referencePath = outputDir + "/pages_uncached.bin";
+  double uncached = 1e9;
+  double uncachedMeasuring = 1e9;
+  uint32_t referenceChecksum = 0;
+  for (int run = 0; run < RUNS; run++) {
+    uncached = std::min(uncached, layoutBook(renderer, book, 0, referencePath).milliseconds);
+    referenceChecksum = 0;
+    uncachedMeasuring = std::min(uncachedMeasuring, measureBook(renderer, book, 0, &referenceChecksum));
+  }
+  const std::string reference = readFile(referencePath);
+  printf("                         indexing          measuring words\n");
+  printf("no cache:              %7.1f ms          %6.1f ms\n", uncached, uncachedMeasuring);
+
+  bool ok = true;
+  for (const int capacity : {256, 512, 1024, 2048, 4096}) {
+    const std::string path = outputDir + "/pages_cached.bin";
+    Result best{};
+    best.milliseconds = 1e9;
+    double measuring = 1e9;
+    uint32_t checksum = 0;
+    for (int run = 0; run < RUNS; run++) {
+      const Result result = layoutBook(renderer, book, capacity, path);
+      if (result.milliseconds < best.milliseconds) {
+        best = result;
+      }
+      checksum = 0;
+      measuring = std::min(measuring, measureBook(renderer, book, capacity, &checksum));
+    }
+    const bool same = readFile(path) == reference && checksum == referenceChecksum;
+    ok = ok && same;
+    printf("%4d entries %5zu bytes: %7.1f ms (%.2fx)  %6.1f ms (%.2fx)  hit rate %5.1f%%%s\n", capacity,
+           best.cacheBytes, best.milliseconds, uncached / best.milliseconds, measuring, uncachedMeasuring / measuring,
+           100.0 * best.hits / (best.hits + best.misses), same ? "" : "  PAGES DIFFER");
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+#include <HalStorage.h>
+#include <ZipFile.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Times the central directory scans ZipFile runs while opening a book and counts the SD calls they make.
+// Archives are generated on the fly with stored entries laid out like a typical EPUB.
+
+namespace {
+
+void writeLe16(std::vector<uint8_t>& out, const uint16_t v) {
+  out.push_back(v & 0xFF);
+  out.push_back(v >> 8);
+}
+
+void writeLe32(std::vector<uint8_t>& out, const uint32_t v) {
+  writeLe16(out, v & 0xFFFF);
+  writeLe16(out, v >> 16);
+}
+
+std::string entryName(const int i) {
+  char name[64];
+  snprintf(name, sizeof(name), "OEBPS/Text/chapter%05d.xhtml", i);
+  return name;
+}
+
+bool writeArchive(const std::string& path, const int entryCount) {
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> centralDir;
+
+  for (int i = 0; i < entryCount; i++) {
+    const std::string name = entryName(i);
+    const std::string body = "<html><body><p>" + name + "</p></body></html>";
+    const uint32_t localHeaderOffset = data.size();
+
+    writeLe32(data, 0x04034b50);
+    writeLe16(data, 20);  // Version needed
+    writeLe16(data, 0);   // Flags
+    writeLe16(data, 0);   // Stored
+    writeLe32(data, 0);   // Time + date
+    writeLe32(data, 0);   // CRC (not checked by ZipFile)
+    writeLe32(data, body.size());
+    writeLe32(data, body.size());
+    writeLe16(data, name.size());
+    writeLe16(data, 0);
+    data.insert(data.end(), name.begin(), name.end());
+    data.insert(data.end(), body.begin(), body.end());
+
+    // Give every central record an extra field so the scan has to skip variable-length data
+    constexpr uint16_t extraLen = 12;
+    writeLe32(centralDir, 0x02014b50);
+    writeLe16(centralDir, 20);  // Version made by
+    writeLe16(centralDir, 20);  // Version needed
+    writeLe16(centralDir, 0);
+    writeLe16(centralDir, 0);
+    writeLe32(centralDir, 0);
+    writeLe32(centralDir, 0);
+    writeLe32(centralDir, body.size());
+    writeLe32(centralDir, body.size());
+    writeLe16(centralDir, name.size());
+    writeLe16(centralDir, extraLen);
+    writeLe16(centralDir, 0);  // Comment
+    writeLe16(centralDir, 0);  // Disk
+    writeLe16(centralDir, 0);  // Internal attributes
+    writeLe32(centralDir, 0);  // External attributes
+    writeLe32(centralDir, localHeaderOffset);
+    centralDir.insert(centralDir.end(), name.begin(), name.end());
+    centralDir.insert(centralDir.end(), extraLen, 0);
+  }
+
+  const uint32_t centralDirOffset = data.size();
+  data.insert(data.end(), centralDir.begin(), centralDir.end());
+  writeLe32(data, 0x06054b50);
+  writeLe16(data, 0);
+  writeLe16(data, 0);
+  writeLe16(data, entryCount);
+  writeLe16(data, entryCount);
+  writeLe32(data, centralDir.size());
+  writeLe32(data, centralDirOffset);
+  writeLe16(data, 0);
+
+  FILE* out = fopen(path.c_str(), "wb");
+  if (!out) {
+    return false;
+  }
+  const bool ok = fwrite(data.data(), 1, data.size(), out) == data.size();
+  fclose(out);
+  return ok;
+}
+
+struct Measurement {
+  double ms;
+  uint32_t sdCalls;
+};
+
+template <typename Fn>
+Measurement measure(Fn&& fn) {
+  FsFile::resetCounters();
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  const auto end = std::chrono::steady_clock::now();
+  return {std::chrono::duration<double, std::milli>(end - start).count(),
+          FsFile::readCalls + FsFile::seekCalls + FsFile::writeCalls};
+}
+
+void report(const char* label, const int entries, const size_t budget, const Measurement& m, const bool ok) {
+  printf("%-22s %6d %8zu %10.3f %10u %s\n", label, entries, budget, m.ms, m.sdCalls, ok ? "" : "FAILED");
+}
+
+bool runBenchmark(const std::string& zipPath, const std::string& indexPath, const int entryCount,
+                  const size_t budget) {
+  bool allOk = true;
+
+  // Batch size lookup used by BookMetadataCache for every spine item
+  {
+    std::vector<ZipFile::SizeTarget> targets;
+    for (int i = 0; i < entryCount; i++) {
+      const std::string name = entryName(i);
+      targets.push_back({ZipFile::fnvHash64(name.c_str(), name.size()), static_cast<uint16_t>(name.size()),
+                         static_cast<uint16_t>(i)});
+    }
+    std::sort(targets.begin(), targets.end(), [](const ZipFile::SizeTarget& a, const ZipFile::SizeTarget& b) {
+      return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
+    });
+    std::vector<uint32_t> sizes(entryCount, 0);
+    int matched = 0;
+    ZipFile zip(zipPath);
+    zip.setCentralDirReadBudget(budget);
+    const auto m = measure([&] { matched = zip.fillUncompressedSizes(targets, sizes); });
+    const bool ok = matched == entryCount;
+    report("fillUncompressedSizes", entryCount, budget, m, ok);
+    allOk &= ok;
+  }
+
+  // Sequential lookups on an open archive exercise the scan cursor
+  {
+    bool ok = true;
+    ZipFile zip(zipPath);
+    zip.setCentralDirReadBudget(budget);
+    const auto m = measure([&] {
+      zip.open();
+      for (int i = 0; i < entryCount; i++) {
+        size_t size = 0;
+        ok &= zip.getInflatedFileSize(entryName(i).c_str(), &size) && size > 0;
+      }
+      zip.close();
+    });
+    report("sequential lookups", entryCount, budget, m, ok);
+    allOk &= ok;
+  }
+
+  {
+    bool ok = true;
+    ZipFile zip(zipPath);
+    zip.setCentralDirReadBudget(budget);
+    const auto m = measure([&] {
+      ok = zip.loadAllFileStatSlims();
+      for (int i = entryCount - 1; i >= 0; i--) {
+        size_t size = 0;
+        ok &= zip.getInflatedFileSize(entryName(i).c_str(), &size);
+      }
+    });
+    report("loadAll + lookups", entryCount, budget, m, ok);
+    allOk &= ok;
+  }
+
+  {
+    bool ok = true;
+    ZipFile zip(zipPath);
+    zip.setCentralDirReadBudget(budget);
+    const auto m = measure([&] { ok = zip.buildEntryIndex(indexPath); });
+    report("buildEntryIndex", entryCount, budget, m, ok);
+    allOk &= ok;
+  }
+
+  // Lookups through the index must find every entry by its path and nothing else, in RAM and on the card
+  {
+    bool ok = true;
+    ZipFile::EntryIndex index;
+    ZipFile zip(zipPath, &index);
+    const auto m = measure([&] {
+      ok = index.load(indexPath);
+      for (int i = 0; i < entryCount; i++) {
+        const std::string name = entryName(i);
+        size_t size = 0;
+        ok &= zip.getInflatedFileSize(name.c_str(), &size) && size == name.size() + 33;
+      }
+      size_t size = 0;
+      ok &= !zip.getInflatedFileSize(entryName(99999).c_str(), &size);
+    });
+    report("index lookups", entryCount, budget, m, ok);
+    allOk &= ok;
+  }
+
+  return allOk;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::string workDir = argc > 1 ? argv[1] : ".";
+  const std::string indexPath = workDir + "/zip.idx";
+
+  printf("%-22s %6s %8s %10s %10s\n", "scan", "items", "budget", "ms", "sd calls");
+
+  bool allOk = true;
+  for (const int entryCount : {50, 500, 5000}) {
+    const std::string zipPath = workDir + "/bench_" + std::to_string(entryCount) + ".zip";
+    if (!writeArchive(zipPath, entryCount)) {
+      fprintf(stderr, "Failed to write %s\n", zipPath.c_str());
+      return 1;
+    }
+    // Budget 0 forces block reads so both paths are covered
+    for (const size_t budget : {static_cast<size_t>(0), ZipFile::DEFAULT_CENTRAL_DIR_READ_BUDGET}) {
+      allOk &= runBenchmark(zipPath, indexPath, entryCount, budget);
+    }
+    Storage.remove(zipPath.c_str());
+  }
+  Storage.remove(indexPath.c_str());
+
+  return allOk ? 0 : 1;
+}